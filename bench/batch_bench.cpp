@@ -0,0 +1,162 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "synth.hpp"
+#include "../src/thread_pool.hpp"
+
+namespace {
+    std::string compiler = "build/program";
+    std::string work_dir = "build/bench/batch";
+    unsigned files = 400;
+    unsigned reps = 3;
+
+    auto spawn(const std::vector<std::string>& args) {
+        auto pid = fork();
+        if (pid == 0) {
+            std::vector<char*> argv;
+            for (auto& a : args) {
+                argv.push_back(const_cast<char*>(a.c_str()));
+            }
+            argv.push_back(nullptr);
+            execv(argv[0], argv.data());
+            _exit(127);
+        }
+        return pid;
+    }
+
+    auto wait_ok(pid_t pid) {
+        int status;
+        waitpid(pid, &status, 0);
+        return WIFEXITED(status) and WEXITSTATUS(status) == 0;
+    }
+
+    // One process per file, at most `jobs` of them running at a time, the
+    // way a make -j build drives the compiler.
+    auto per_process(unsigned jobs) {
+        auto ok = true;
+        std::vector<pid_t> running;
+        for (auto i = 0u; i < files; i++) {
+            if (running.size() == jobs) {
+                int status;
+                auto pid = wait(&status);
+                ok = ok and WIFEXITED(status) and WEXITSTATUS(status) == 0;
+                running.erase(std::find(running.begin(), running.end(), pid));
+            }
+            auto base = work_dir + "/f" + std::to_string(i);
+            running.push_back(spawn({compiler, base + ".c", base + ".s"}));
+        }
+        for (auto pid : running) {
+            ok = wait_ok(pid) and ok;
+        }
+        return ok;
+    }
+
+    auto batch(unsigned jobs) {
+        return wait_ok(spawn({compiler, "--batch",
+                              "--jobs=" + std::to_string(jobs),
+                              "--manifest=" + work_dir + "/manifest"}));
+    }
+
+    template <typename t_fn>
+    auto best_time(t_fn fn, bool& ok) {
+        auto best = 1e30;
+        for (auto i = 0u; i < reps; i++) {
+            auto t = std::chrono::steady_clock::now();
+            ok = fn() and ok;
+            auto d = std::chrono::steady_clock::now() - t;
+            best = std::min(best, std::chrono::duration<double>(d).count());
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv) {
+    auto max_jobs = default_thread_count();
+    auto usage = [] {
+        std::cerr << "usage : batch_bench [--files=N] [--reps=N] "
+                  << "[--jobs=N] [--compiler=PATH]\n";
+        return 1;
+    };
+    for (auto i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = arg.substr(arg.find('=') + 1);
+        if (arg.compare(0, 8, "--files=") == 0) {
+            if (not parse_count(value, files)) {
+                return usage();
+            }
+            files = std::max(1u, files);
+        } else if (arg.compare(0, 7, "--reps=") == 0) {
+            if (not parse_count(value, reps)) {
+                return usage();
+            }
+            reps = std::max(1u, reps);
+        } else if (arg.compare(0, 7, "--jobs=") == 0) {
+            if (not parse_count(value, max_jobs)) {
+                return usage();
+            }
+            max_jobs = std::max(1u, max_jobs);
+        } else if (arg.compare(0, 11, "--compiler=") == 0) {
+            compiler = value;
+        } else {
+            return usage();
+        }
+    }
+    if (std::system(("mkdir -p " + work_dir).c_str()) != 0) {
+        std::cerr << "error : could not create " << work_dir << "\n";
+        return 1;
+    }
+
+    // Mostly small files with the occasional large one, as in a real tree.
+    std::ofstream manifest(work_dir + "/manifest");
+    for (auto i = 0u; i < files; i++) {
+        t_synth_params params;
+        params.seed = i + 1;
+        params.functions = i % 25 == 0 ? 40 : 1 + i % 4;
+        params.statements = 10;
+        auto base = work_dir + "/f" + std::to_string(i);
+        std::ofstream(base + ".c") << gen_program(params);
+        manifest << base << ".c " << base << ".s\n";
+    }
+    manifest.close();
+
+    std::cout << files << " files\n";
+    std::cout << std::setw(6) << "jobs"
+              << std::setw(16) << "per-process ms"
+              << std::setw(11) << "batch ms"
+              << std::setw(16) << "per-process f/s"
+              << std::setw(11) << "batch f/s"
+              << std::setw(10) << "speedup" << "\n";
+    auto ok = true;
+    std::vector<unsigned> job_counts = {1};
+    for (auto j = 2u; j < max_jobs; j *= 2) {
+        job_counts.push_back(j);
+    }
+    if (max_jobs > 1) {
+        job_counts.push_back(max_jobs);
+    }
+    for (auto jobs : job_counts) {
+        auto p = best_time([&]() { return per_process(jobs); }, ok);
+        auto b = best_time([&]() { return batch(jobs); }, ok);
+        std::cout << std::setw(6) << jobs << std::fixed
+                  << std::setprecision(1)
+                  << std::setw(16) << p * 1e3
+                  << std::setw(11) << b * 1e3
+                  << std::setprecision(0)
+                  << std::setw(16) << files / p
+                  << std::setw(11) << files / b
+                  << std::setprecision(2)
+                  << std::setw(9) << p / b << "x" << std::endl;
+    }
+    if (not ok) {
+        std::cerr << "error : some compiles failed\n";
+        return 1;
+    }
+}
@@ -0,0 +1,244 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include "synth.hpp"
+#include "../src/lex.hpp"
+#include "../src/ast.hpp"
+#include "../src/asm_gen.hpp"
+#include "../src/thread_pool.hpp"
+
+namespace {
+    struct t_result {
+        bool ok;
+        unsigned long lines;
+        unsigned long tokens;
+        double lex_s;
+        double parse_s;
+        double codegen_s;
+    };
+
+    unsigned reps = 3;
+
+    auto seconds_since(std::chrono::steady_clock::time_point t) {
+        auto d = std::chrono::steady_clock::now() - t;
+        return std::chrono::duration<double>(d).count();
+    }
+
+    auto measure(const t_synth_params& params) {
+        t_result r = {false, 0, 0, 1e30, 1e30, 1e30};
+        auto src = gen_program(params);
+        r.lines = std::count(src.begin(), src.end(), '\n');
+        try {
+            for (auto i = 0u; i < reps; i++) {
+                auto t = std::chrono::steady_clock::now();
+                auto tokens = lex(src);
+                r.lex_s = std::min(r.lex_s, seconds_since(t));
+                r.tokens = tokens.size();
+                t = std::chrono::steady_clock::now();
+                auto ast = parse_program(tokens);
+                r.parse_s = std::min(r.parse_s, seconds_since(t));
+                t = std::chrono::steady_clock::now();
+                auto res = gen_asm(ast);
+                r.codegen_s = std::min(r.codegen_s, seconds_since(t));
+            }
+            r.ok = true;
+        } catch (const std::runtime_error& e) {
+            std::cerr << "error : " << e.what() << "\n";
+        }
+        return r;
+    }
+
+    // Each measurement runs in a child process so that its peak RSS is
+    // reported on its own rather than as the maximum of the whole sweep.
+    auto run_isolated(const t_synth_params& params, long& peak_rss_kb) {
+        t_result r = {false, 0, 0, 0, 0, 0};
+        int fds[2];
+        if (pipe(fds) != 0) {
+            throw std::runtime_error("pipe failed");
+        }
+        auto pid = fork();
+        if (pid == 0) {
+            close(fds[0]);
+            auto res = measure(params);
+            auto n = write(fds[1], &res, sizeof(res));
+            _exit(n == sizeof(res) ? 0 : 1);
+        }
+        close(fds[1]);
+        auto n = read(fds[0], &r, sizeof(r));
+        close(fds[0]);
+        int status;
+        rusage ru;
+        wait4(pid, &status, 0, &ru);
+        peak_rss_kb = ru.ru_maxrss;
+        if (n != sizeof(r)) {
+            r.ok = false;
+        }
+        return r;
+    }
+
+    void sweep(
+        const std::string& title,
+        const std::string& param_name,
+        const std::vector<unsigned>& values,
+        std::function<void(t_synth_params&, unsigned)> set
+        ) {
+        std::cout << "\n== " << title << "\n";
+        std::cout << std::setw(14) << param_name
+                  << std::setw(10) << "lines"
+                  << std::setw(10) << "tokens"
+                  << std::setw(11) << "lex ms"
+                  << std::setw(11) << "parse ms"
+                  << std::setw(11) << "codegen ms"
+                  << std::setw(12) << "lines/s"
+                  << std::setw(12) << "tokens/s"
+                  << std::setw(10) << "ns/tok"
+                  << std::setw(11) << "peak kB" << "\n";
+        for (auto v : values) {
+            t_synth_params params;
+            set(params, v);
+            long peak_rss_kb;
+            auto r = run_isolated(params, peak_rss_kb);
+            std::cout << std::setw(14) << v;
+            if (not r.ok) {
+                std::cout << "  failed\n";
+                continue;
+            }
+            auto total = r.lex_s + r.parse_s + r.codegen_s;
+            std::cout << std::fixed
+                      << std::setw(10) << r.lines
+                      << std::setw(10) << r.tokens
+                      << std::setprecision(2)
+                      << std::setw(11) << r.lex_s * 1e3
+                      << std::setw(11) << r.parse_s * 1e3
+                      << std::setw(11) << r.codegen_s * 1e3
+                      << std::setprecision(0)
+                      << std::setw(12) << r.lines / total
+                      << std::setw(12) << r.tokens / total
+                      << std::setprecision(1)
+                      << std::setw(10) << total * 1e9 / r.tokens
+                      << std::setw(11) << peak_rss_kb << std::endl;
+        }
+    }
+
+    // Codegen of one large translation unit at increasing thread counts.
+    // The output must not depend on the thread count.
+    void thread_sweep(unsigned functions, unsigned max_threads) {
+        std::cout << "\n== codegen threads (" << functions << " functions)\n";
+        std::cout << std::setw(14) << "threads"
+                  << std::setw(13) << "codegen ms"
+                  << std::setw(10) << "speedup"
+                  << std::setw(12) << "identical" << "\n";
+        t_synth_params params;
+        params.functions = functions;
+        auto tokens = lex(gen_program(params));
+        auto ast = parse_program(tokens);
+        std::string reference;
+        auto base_s = 0.0;
+        for (auto threads = 1u; threads <= max_threads; threads *= 2) {
+            auto best = 1e30;
+            std::string out;
+            for (auto i = 0u; i < reps; i++) {
+                auto t = std::chrono::steady_clock::now();
+                t_gen_options opts;
+                opts.threads = threads;
+                out = gen_asm(ast, opts);
+                best = std::min(best, seconds_since(t));
+            }
+            if (threads == 1) {
+                reference = out;
+                base_s = best;
+            }
+            std::cout << std::setw(14) << threads << std::fixed
+                      << std::setprecision(2)
+                      << std::setw(13) << best * 1e3
+                      << std::setw(9) << base_s / best << "x"
+                      << std::setw(12) << (out == reference ? "yes" : "NO")
+                      << std::endl;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    auto quick = false;
+    auto max_threads = std::max(8u, default_thread_count());
+    auto usage = [] {
+        std::cerr << "usage : compile_bench [--quick] [--reps=N] "
+                  << "[--max-threads=N]\n";
+        return 1;
+    };
+    for (auto i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--quick") {
+            quick = true;
+        } else if (arg.compare(0, 7, "--reps=") == 0) {
+            if (not parse_count(arg.substr(7), reps)) {
+                return usage();
+            }
+            reps = std::max(1u, reps);
+        } else if (arg.compare(0, 14, "--max-threads=") == 0) {
+            if (not parse_count(arg.substr(14), max_threads)) {
+                return usage();
+            }
+            max_threads = std::max(1u, max_threads);
+        } else {
+            return usage();
+        }
+    }
+    auto pick = [&](std::vector<unsigned> full, unsigned quick_count) {
+        if (quick) {
+            full.resize(std::min<std::size_t>(quick_count, full.size()));
+        }
+        return full;
+    };
+
+    sweep("program size", "functions", pick({10, 100, 1000}, 2),
+          [](t_synth_params& p, unsigned v) { p.functions = v; });
+    sweep("function length", "statements",
+          pick({100, 1000, 5000}, 2),
+          [](t_synth_params& p, unsigned v) {
+              p.functions = 1;
+              p.statements = v;
+          });
+    sweep("locals per scope", "locals", pick({8, 64, 256, 1024}, 2),
+          [](t_synth_params& p, unsigned v) {
+              p.functions = 20;
+              p.locals = v;
+          });
+    sweep("loop nesting", "loop-nesting", pick({2, 8, 32, 128}, 2),
+          [](t_synth_params& p, unsigned v) {
+              p.functions = 20;
+              p.statements = 10;
+              p.locals = 32;
+              p.block_size = 2;
+              p.loop_nesting = v;
+          });
+    sweep("nested scopes", "loop-nesting", pick({32, 128, 256}, 2),
+          [](t_synth_params& p, unsigned v) {
+              p.functions = 4;
+              p.statements = 4;
+              p.locals = 1024;
+              p.block_size = 2;
+              p.loop_nesting = v;
+          });
+    sweep("expression depth", "exp-depth", pick({2, 3, 4, 5, 6, 7}, 3),
+          [](t_synth_params& p, unsigned v) {
+              p.functions = 20;
+              p.exp_depth = v;
+          });
+    sweep("expression width", "exp-width", pick({2, 8, 32, 128}, 2),
+          [](t_synth_params& p, unsigned v) {
+              p.functions = 20;
+              p.exp_depth = 1;
+              p.exp_width = v;
+          });
+    thread_sweep(quick ? 200 : 2000, max_threads);
+}
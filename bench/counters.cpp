@@ -0,0 +1,100 @@
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <x86intrin.h>
+
+#include "counters.hpp"
+
+namespace {
+    bool have_perf = true;
+
+    auto perf_open(std::uint64_t config, pid_t pid, int group) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = group == -1;
+        attr.enable_on_exec = group == -1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return int(syscall(SYS_perf_event_open, &attr, pid, -1, group, 0));
+    }
+
+    auto read_counter(int fd) {
+        std::uint64_t v = 0;
+        if (read(fd, &v, sizeof(v)) != sizeof(v)) {
+            v = 0;
+        }
+        close(fd);
+        return v;
+    }
+
+    auto redirect(const std::string& path, int flags, int to) {
+        if (path.empty()) {
+            return true;
+        }
+        auto fd = open(path.c_str(), flags, 0644);
+        return fd >= 0 and dup2(fd, to) == to and close(fd) == 0;
+    }
+}
+
+// The child blocks on a pipe until the counters are attached, so that
+// only the exec'd program is counted.
+t_sample run_counted(const std::string& path, const std::string& input,
+                     const std::string& output) {
+    t_sample s = {false, 0, 0, 0};
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return s;
+    }
+    auto pid = fork();
+    if (pid == 0) {
+        close(fds[1]);
+        char ch;
+        if (read(fds[0], &ch, 1) != 1
+            or not redirect(input, O_RDONLY, 0)
+            or not redirect(output, O_WRONLY | O_CREAT | O_TRUNC, 1)) {
+            _exit(127);
+        }
+        execl(path.c_str(), path.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+    close(fds[0]);
+    auto cycles_fd = -1;
+    auto instr_fd = -1;
+    if (have_perf) {
+        cycles_fd = perf_open(PERF_COUNT_HW_CPU_CYCLES, pid, -1);
+        if (cycles_fd >= 0) {
+            instr_fd = perf_open(PERF_COUNT_HW_INSTRUCTIONS, pid,
+                                 cycles_fd);
+        } else {
+            have_perf = false;
+        }
+    }
+    auto tsc = __rdtsc();
+    auto n = write(fds[1], "x", 1);
+    close(fds[1]);
+    int status;
+    waitpid(pid, &status, 0);
+    tsc = __rdtsc() - tsc;
+    if (cycles_fd >= 0) {
+        s.cycles = read_counter(cycles_fd);
+        if (instr_fd >= 0) {
+            s.instructions = read_counter(instr_fd);
+        }
+    } else {
+        s.cycles = tsc;
+    }
+    s.ok = n == 1 and WIFEXITED(status) and WEXITSTATUS(status) != 127;
+    s.status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    return s;
+}
+
+bool have_perf_counters() {
+    return have_perf;
+}
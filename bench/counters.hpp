@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+struct t_sample {
+    bool ok;
+    int status;
+    std::uint64_t cycles;
+    std::uint64_t instructions;
+};
+
+// Runs the program at path and counts its user-space cycles and
+// instructions. stdin is read from input and stdout written to output
+// when these are given; otherwise they are inherited.
+t_sample run_counted(const std::string& path, const std::string& input = "",
+                     const std::string& output = "");
+
+// False once perf_event_open has failed (e.g. perf_event_paranoid or no
+// PMU in a VM). Cycles are then elapsed TSC ticks around the child, which
+// include process startup, and no instructions are counted.
+bool have_perf_counters();
@@ -0,0 +1,19 @@
+#include <iostream>
+#include <string>
+
+#include "synth.hpp"
+
+int main(int argc, char** argv) {
+    t_synth_params params;
+    for (auto i = 1; i < argc; i++) {
+        if (not set_synth_param(params, argv[i])) {
+            std::cerr << "error : bad argument " << argv[i] << "\n";
+            std::cerr << "usage : gen [--functions=N] [--statements=N] "
+                      << "[--locals=N] [--exp-depth=N] [--exp-width=N] "
+                      << "[--loop-nesting=N] [--block-size=N] [--arrays=N] "
+                      << "[--array-size=N] [--seed=N]\n";
+            return 1;
+        }
+    }
+    std::cout << gen_program(params);
+}
@@ -0,0 +1,14 @@
+int main() {
+    int a[10000];
+    for (int i = 0; i < 10000; i = i + 1) {
+        a[i] = i % 7;
+    }
+    int s = 0;
+    for (int r = 0; r < 500; r = r + 1) {
+        for (int i = 0; i < 10000; i = i + 1) {
+            s = s + a[i];
+        }
+        s = s % 1000003;
+    }
+    return s % 256;
+}
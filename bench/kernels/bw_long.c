@@ -0,0 +1,13 @@
+int main() {
+    long a[16000000];
+    for (int i = 0; i < 16000000; i = i + 1) {
+        a[i] = i % 101;
+    }
+    long s = 0;
+    for (int r = 0; r < 3; r = r + 1) {
+        for (int i = 0; i < 16000000; i = i + 1) {
+            s = s + a[i];
+        }
+    }
+    return s % 256;
+}
@@ -0,0 +1,16 @@
+int one() {
+    return 1;
+}
+
+int step() {
+    int x = 3;
+    return x * x - 8;
+}
+
+int main() {
+    int s = 0;
+    for (int i = 0; i < 3000000; i = i + 1) {
+        s = s + one() + step();
+    }
+    return s % 256;
+}
@@ -0,0 +1,17 @@
+int main() {
+    int a[2048][2048];
+    for (int i = 0; i < 2048; i = i + 1) {
+        for (int j = 0; j < 2048; j = j + 1) {
+            a[i][j] = i * 3 + j;
+        }
+    }
+    long sum = 0;
+    for (int r = 0; r < 4; r = r + 1) {
+        for (int j = 0; j < 2048; j = j + 1) {
+            for (int i = 0; i < 2048; i = i + 1) {
+                sum = sum + a[i][j] * (j % 5 + 1);
+            }
+        }
+    }
+    return sum % 251;
+}
@@ -0,0 +1,36 @@
+int main() {
+    int code[16];
+    int arg[16];
+    code[0] = 1; arg[0] = 3;
+    code[1] = 2; arg[1] = 0;
+    code[2] = 7; arg[2] = 0;
+    code[3] = 8; arg[3] = 7;
+    code[4] = 3; arg[4] = 1000003;
+    code[5] = 9; arg[5] = 0;
+    code[6] = 4; arg[6] = 1;
+    code[7] = 5; arg[7] = 0;
+    code[8] = 0; arg[8] = 0;
+    int acc = 1;
+    int i = 0;
+    int lim = 3000000;
+    int pc = 0;
+    int running = 1;
+    while (running) {
+        int op = code[pc];
+        int x = arg[pc];
+        pc = pc + 1;
+        switch (op) {
+        case 0: running = 0; break;
+        case 1: acc = acc * x; break;
+        case 2: acc = acc + i; break;
+        case 3: acc = acc % x; break;
+        case 4: i = i + x; break;
+        case 5: if (i < lim) pc = x; break;
+        case 6: acc = acc - x; break;
+        case 7: acc = acc + acc; break;
+        case 8: acc = acc + x; break;
+        case 9: break;
+        }
+    }
+    return acc % 256;
+}
@@ -0,0 +1,36 @@
+int main() {
+    int code[16];
+    int arg[16];
+    code[0] = 17; arg[0] = 3;
+    code[1] = 101; arg[1] = 0;
+    code[2] = 77777; arg[2] = 0;
+    code[3] = 123456; arg[3] = 7;
+    code[4] = 256; arg[4] = 1000003;
+    code[5] = 1000000; arg[5] = 0;
+    code[6] = 999; arg[6] = 1;
+    code[7] = 4096; arg[7] = 0;
+    code[8] = 3; arg[8] = 0;
+    int acc = 1;
+    int i = 0;
+    int lim = 3000000;
+    int pc = 0;
+    int running = 1;
+    while (running) {
+        int op = code[pc];
+        int x = arg[pc];
+        pc = pc + 1;
+        switch (op) {
+        case 3: running = 0; break;
+        case 17: acc = acc * x; break;
+        case 101: acc = acc + i; break;
+        case 256: acc = acc % x; break;
+        case 999: i = i + x; break;
+        case 4096: if (i < lim) pc = x; break;
+        case 5000: acc = acc - x; break;
+        case 77777: acc = acc + acc; break;
+        case 123456: acc = acc + x; break;
+        case 1000000: break;
+        }
+    }
+    return acc % 256;
+}
@@ -0,0 +1,14 @@
+int main() {
+    int res = 0;
+    for (int r = 0; r < 20000; r = r + 1) {
+        int a = 0;
+        int b = 1;
+        for (int i = 0; i < 300; i = i + 1) {
+            int t = (a + b) % 1000003;
+            a = b;
+            b = t;
+        }
+        res = (res + a + r) % 1000003;
+    }
+    return res % 256;
+}
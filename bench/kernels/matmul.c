@@ -0,0 +1,28 @@
+int main() {
+    int a[96][96];
+    int b[96][96];
+    int c[96][96];
+    for (int i = 0; i < 96; i = i + 1) {
+        for (int j = 0; j < 96; j = j + 1) {
+            a[i][j] = (i + j) % 10;
+            b[i][j] = (i * j) % 7;
+            c[i][j] = 0;
+        }
+    }
+    for (int i = 0; i < 96; i = i + 1) {
+        for (int j = 0; j < 96; j = j + 1) {
+            int s = 0;
+            for (int k = 0; k < 96; k = k + 1) {
+                s = s + a[i][k] * b[k][j];
+            }
+            c[i][j] = s;
+        }
+    }
+    int sum = 0;
+    for (int i = 0; i < 96; i = i + 1) {
+        for (int j = 0; j < 96; j = j + 1) {
+            sum = (sum + c[i][j]) % 1000003;
+        }
+    }
+    return sum % 256;
+}
@@ -0,0 +1,28 @@
+int main() {
+    int a[128][128];
+    int b[128][128];
+    int c[128][128];
+    for (int i = 0; i < 128; i = i + 1) {
+        for (int j = 0; j < 128; j = j + 1) {
+            a[i][j] = (i + j) % 10;
+            b[i][j] = (i * j) % 7;
+            c[i][j] = 0;
+        }
+    }
+    for (int r = 0; r < 2; r = r + 1) {
+        for (int i = 0; i < 128; i = i + 1) {
+            for (int j = 0; j < 128; j = j + 1) {
+                for (int k = 0; k < 128; k = k + 1) {
+                    c[i][j] = c[i][j] + a[i][k] * b[k][j];
+                }
+            }
+        }
+    }
+    int sum = 0;
+    for (int i = 0; i < 128; i = i + 1) {
+        for (int j = 0; j < 128; j = j + 1) {
+            sum = (sum + c[i][j] * (i + 1)) % 1000003;
+        }
+    }
+    return sum % 256;
+}
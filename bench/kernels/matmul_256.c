@@ -0,0 +1,26 @@
+int main() {
+    int a[256][256];
+    int b[256][256];
+    int c[256][256];
+    for (int i = 0; i < 256; i = i + 1) {
+        for (int j = 0; j < 256; j = j + 1) {
+            a[i][j] = (i + j) % 10;
+            b[i][j] = (i * j) % 7;
+            c[i][j] = 0;
+        }
+    }
+    for (int i = 0; i < 256; i = i + 1) {
+        for (int j = 0; j < 256; j = j + 1) {
+            for (int k = 0; k < 256; k = k + 1) {
+                c[i][j] = c[i][j] + a[i][k] * b[k][j];
+            }
+        }
+    }
+    int sum = 0;
+    for (int i = 0; i < 256; i = i + 1) {
+        for (int j = 0; j < 256; j = j + 1) {
+            sum = (sum + c[i][j] * (i + 1)) % 1000003;
+        }
+    }
+    return sum % 256;
+}
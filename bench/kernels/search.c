@@ -0,0 +1,17 @@
+int main() {
+    int a[1500];
+    for (int i = 0; i < 1500; i = i + 1) {
+        a[i] = (i * 7919) % 2003;
+    }
+    int found = 0;
+    for (int t = 1000; t < 1004; t = t + 1) {
+        for (int i = 0; i < 1500; i = i + 1) {
+            for (int j = i + 1; j < 1500; j = j + 1) {
+                if (a[i] + a[j] == t) {
+                    found = found + 1;
+                }
+            }
+        }
+    }
+    return found % 256;
+}
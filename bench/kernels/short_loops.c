@@ -0,0 +1,13 @@
+int main() {
+    int a[8];
+    int s = 0;
+    for (int r = 0; r < 2000000; r = r + 1) {
+        for (int k = 0; k < 8; k = k + 1) {
+            a[k] = r + k;
+        }
+        for (int k = 0; k < 8; k = k + 1) {
+            s = s + a[k] % 7;
+        }
+    }
+    return s % 256;
+}
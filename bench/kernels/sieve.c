@@ -0,0 +1,24 @@
+int limit() {
+    return 100000;
+}
+
+int main() {
+    int n = limit();
+    int composite[100000];
+    int count = 0;
+    for (int r = 0; r < 20; r = r + 1) {
+        for (int i = 0; i < n; i = i + 1) {
+            composite[i] = 0;
+        }
+        count = 0;
+        for (int i = 2; i < n; i = i + 1) {
+            if (!composite[i]) {
+                count = count + 1;
+                for (int j = i + i; j < n; j = j + i) {
+                    composite[j] = 1;
+                }
+            }
+        }
+    }
+    return count % 256;
+}
@@ -0,0 +1,20 @@
+int main() {
+    int a[1024];
+    int b[1024];
+    for (int i = 0; i < 1024; i = i + 1) {
+        a[i] = i % 17;
+    }
+    for (int r = 0; r < 4000; r = r + 1) {
+        for (int i = 1; i < 1023; i = i + 1) {
+            b[i] = a[i - 1] + a[i] * 2 + a[i + 1] + r;
+        }
+        for (int i = 1; i < 1023; i = i + 1) {
+            a[i] = (b[i] + i * 8 + 3) % 1000;
+        }
+    }
+    int s = 0;
+    for (int i = 0; i < 1024; i = i + 1) {
+        s = s + a[i];
+    }
+    return s % 256;
+}
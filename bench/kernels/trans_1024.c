@@ -0,0 +1,28 @@
+int main() {
+    int a[1024][1024];
+    int b[1024][1024];
+    for (int i = 0; i < 1024; i = i + 1) {
+        for (int j = 0; j < 1024; j = j + 1) {
+            a[i][j] = i * 3 + j;
+        }
+    }
+    for (int r = 0; r < 4; r = r + 1) {
+        for (int i = 0; i < 1024; i = i + 1) {
+            for (int j = 0; j < 1024; j = j + 1) {
+                b[j][i] = a[i][j] + r;
+            }
+        }
+        for (int i = 0; i < 1024; i = i + 1) {
+            for (int j = 0; j < 1024; j = j + 1) {
+                a[j][i] = b[i][j] - r;
+            }
+        }
+    }
+    int sum = 0;
+    for (int i = 0; i < 1024; i = i + 1) {
+        for (int j = 0; j < 1024; j = j + 1) {
+            sum = (sum + a[i][j] * (j % 7 + 1)) % 1000003;
+        }
+    }
+    return sum % 256;
+}
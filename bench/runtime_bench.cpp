@@ -0,0 +1,300 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <cmath>
+#include <dirent.h>
+#include <sys/resource.h>
+
+#include "counters.hpp"
+
+namespace {
+    struct t_variant {
+        std::string name;
+        std::string build;
+    };
+
+    std::string kernel_dir = "bench/kernels";
+    std::string work_dir = "build/bench/kernels";
+    std::string compiler = "build/program";
+    std::string baseline_path;
+    bool update_baseline = false;
+    unsigned runs = 5;
+    double threshold = 0.05;
+
+    auto best_of(const std::string& path) {
+        auto best = run_counted(path);
+        for (auto i = 1u; best.ok and i < runs; i++) {
+            auto s = run_counted(path);
+            if (s.status != best.status) {
+                best.ok = false;
+            }
+            best.cycles = std::min(best.cycles, s.cycles);
+            best.instructions = std::min(best.instructions, s.instructions);
+        }
+        return best;
+    }
+
+    auto list_kernels() {
+        std::vector<std::string> res;
+        auto dir = opendir(kernel_dir.c_str());
+        if (dir == nullptr) {
+            return res;
+        }
+        while (auto e = readdir(dir)) {
+            std::string name = e->d_name;
+            if (name.size() > 2 and name.substr(name.size() - 2) == ".c") {
+                res.push_back(name.substr(0, name.size() - 2));
+            }
+        }
+        closedir(dir);
+        std::sort(res.begin(), res.end());
+        return res;
+    }
+
+    auto replace_all(std::string s, const std::string& from,
+                     const std::string& to) {
+        for (auto pos = s.find(from); pos != std::string::npos;
+             pos = s.find(from, pos + to.size())) {
+            s.replace(pos, from.size(), to);
+        }
+        return s;
+    }
+
+    // Baselines are stored one kernel per line so they can be read back
+    // without a JSON library and diffed in review.
+    auto load_baseline(std::map<std::string, t_sample>& baseline) {
+        std::ifstream is(baseline_path);
+        if (not is.good()) {
+            return false;
+        }
+        std::string line;
+        while (std::getline(is, line)) {
+            auto q0 = line.find('"');
+            auto q1 = line.find('"', q0 + 1);
+            auto c = line.find("\"cycles\":");
+            auto i = line.find("\"instructions\":");
+            if (q0 == std::string::npos or q1 == std::string::npos
+                or c == std::string::npos or i == std::string::npos) {
+                continue;
+            }
+            t_sample s = {true, 0, 0, 0};
+            s.cycles = std::stoull(line.substr(c + 9));
+            s.instructions = std::stoull(line.substr(i + 15));
+            baseline[line.substr(q0 + 1, q1 - q0 - 1)] = s;
+        }
+        return true;
+    }
+
+    auto save_baseline(const std::map<std::string, t_sample>& results) {
+        std::ofstream os(baseline_path);
+        os << "{\n";
+        auto count = 0u;
+        for (auto& r : results) {
+            os << "  \"" << r.first << "\": {\"cycles\": " << r.second.cycles
+               << ", \"instructions\": " << r.second.instructions << "}";
+            os << (++count < results.size() ? ",\n" : "\n");
+        }
+        os << "}\n";
+        return os.good();
+    }
+
+    auto parse_count(const std::string& s, unsigned& value) {
+        if (s.empty() or s.size() > 10
+            or s.find_first_not_of("0123456789") != std::string::npos) {
+            return false;
+        }
+        auto v = std::stoull(s);
+        if (v > UINT_MAX) {
+            return false;
+        }
+        value = unsigned(v);
+        return true;
+    }
+
+    auto parse_percent(const std::string& s, double& value) {
+        char* end;
+        auto v = std::strtod(s.c_str(), &end);
+        if (s.empty() or *end != '\0' or not std::isfinite(v)) {
+            return false;
+        }
+        value = v / 100;
+        return true;
+    }
+
+    auto usage() {
+        std::cerr << "usage : runtime_bench [--kernels=DIR] [--work=DIR] "
+                  << "[--compiler=PATH] [--runs=N] [--baseline=FILE] "
+                  << "[--update-baseline] [--threshold=PERCENT]\n";
+        return 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    for (auto i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = arg.substr(arg.find('=') + 1);
+        if (arg.compare(0, 10, "--kernels=") == 0) {
+            kernel_dir = value;
+        } else if (arg.compare(0, 7, "--work=") == 0) {
+            work_dir = value;
+        } else if (arg.compare(0, 11, "--compiler=") == 0) {
+            compiler = value;
+        } else if (arg.compare(0, 7, "--runs=") == 0) {
+            if (not parse_count(value, runs)) {
+                return usage();
+            }
+            runs = std::max(1u, runs);
+        } else if (arg.compare(0, 11, "--baseline=") == 0) {
+            baseline_path = value;
+        } else if (arg == "--update-baseline") {
+            update_baseline = true;
+        } else if (arg.compare(0, 12, "--threshold=") == 0) {
+            if (not parse_percent(value, threshold)) {
+                return usage();
+            }
+        } else {
+            return usage();
+        }
+    }
+
+    // Kernels keep their arrays on the stack, and the limit is inherited
+    // by the training runs as well as the timed ones.
+    rlimit stack = {1ull << 30, 1ull << 30};
+    getrlimit(RLIMIT_STACK, &stack);
+    stack.rlim_cur = std::min<rlim_t>(std::max<rlim_t>(stack.rlim_cur,
+                                                       1ull << 30),
+                                      stack.rlim_max);
+    setrlimit(RLIMIT_STACK, &stack);
+
+    std::vector<t_variant> variants = {
+        {"cc", compiler + " $src $out.s && "
+               "gcc -Wl,-z,noexecstack $out.s -o $out"},
+        // The branch and block layout of the source, for comparison.
+        {"cc-src", compiler + " --layout=source $src $out.s && "
+                   "gcc -Wl,-z,noexecstack $out.s -o $out"},
+        // Loop nests in source order and untiled, for comparison.
+        {"cc-nest", compiler + " --param=interchange=0 --param=tile-size=0"
+                    " $src $out.s && gcc -Wl,-z,noexecstack $out.s -o $out"},
+        // Trains on the kernel itself, then rebuilds with its profile.
+        {"cc-pgo", compiler + " --profile-generate=$out.prof $src $out.i.s"
+                   " && gcc -Wl,-z,noexecstack $out.i.s -o $out.i"
+                   " && { $out.i; true; } && " + compiler
+                   + " --profile-use=$out.prof $src $out.s"
+                   " && gcc -Wl,-z,noexecstack $out.s -o $out"},
+        {"gcc-O0", "gcc -O0 -w $src -o $out"},
+        {"gcc-O2", "gcc -O2 -w $src -o $out"},
+    };
+
+    auto kernels = list_kernels();
+    if (kernels.empty()) {
+        std::cerr << "error : no kernels in " << kernel_dir << "\n";
+        return 1;
+    }
+    if (std::system(("mkdir -p " + work_dir).c_str()) != 0) {
+        std::cerr << "error : could not create " << work_dir << "\n";
+        return 1;
+    }
+
+    std::map<std::string, t_sample> baseline;
+    auto have_baseline = false;
+    if (not baseline_path.empty() and not update_baseline) {
+        have_baseline = load_baseline(baseline);
+    }
+
+    std::cout << std::left << std::setw(12) << "kernel"
+              << std::setw(9) << "variant" << std::right
+              << std::setw(8) << "result"
+              << std::setw(15) << "cycles"
+              << std::setw(15) << "instructions"
+              << std::setw(7) << "ipc"
+              << std::setw(10) << "vs O2" << "  note\n";
+
+    std::map<std::string, t_sample> results;
+    auto failures = 0u;
+    for (auto& k : kernels) {
+        std::vector<t_sample> samples;
+        for (auto& v : variants) {
+            auto out = work_dir + "/" + k + "." + v.name;
+            auto src = kernel_dir + "/" + k + ".c";
+            auto cmd = replace_all(v.build, "$src", src);
+            cmd = replace_all(cmd, "$out", out);
+            t_sample s = {false, 0, 0, 0};
+            if (std::system(cmd.c_str()) == 0) {
+                s = best_of(out);
+            }
+            samples.push_back(s);
+        }
+        auto& o2 = samples.back();
+        for (auto i = 0u; i < variants.size(); i++) {
+            auto& s = samples[i];
+            std::string note;
+            if (not s.ok) {
+                note = "FAILED";
+            } else if (s.status != o2.status) {
+                note = "MISMATCH";
+            }
+            if (i == 0 and s.ok) {
+                results[k] = s;
+                if (have_baseline and baseline.count(k)) {
+                    auto& b = baseline[k];
+                    auto regressed = [&](std::uint64_t x, std::uint64_t y) {
+                        return y > 0 and x > y * (1 + threshold);
+                    };
+                    if (regressed(s.instructions, b.instructions)
+                        or (b.instructions == 0
+                            and regressed(s.cycles, b.cycles))) {
+                        std::ostringstream ss;
+                        ss << "REGRESSION (baseline " << b.cycles
+                           << " cycles, " << b.instructions << " instr)";
+                        note += note.empty() ? ss.str() : " " + ss.str();
+                    }
+                }
+            }
+            if (not note.empty()) {
+                failures++;
+            }
+            std::cout << std::left << std::setw(12) << k
+                      << std::setw(9) << variants[i].name << std::right
+                      << std::setw(8) << s.status
+                      << std::setw(15) << s.cycles;
+            if (s.instructions > 0) {
+                std::cout << std::setw(15) << s.instructions
+                          << std::setw(7) << std::fixed
+                          << std::setprecision(2)
+                          << double(s.instructions) / s.cycles;
+            } else {
+                std::cout << std::setw(15) << "-" << std::setw(7) << "-";
+            }
+            if (o2.ok and o2.cycles > 0) {
+                std::cout << std::setw(9) << std::fixed
+                          << std::setprecision(2)
+                          << double(s.cycles) / o2.cycles << "x";
+            } else {
+                std::cout << std::setw(10) << "-";
+            }
+            std::cout << "  " << note << std::endl;
+        }
+    }
+    if (not have_perf_counters()) {
+        std::cout << "\nperf_event_open unavailable: cycles are TSC ticks "
+                  << "including process startup\n";
+    }
+
+    if (not baseline_path.empty() and (update_baseline or not have_baseline)) {
+        if (not save_baseline(results)) {
+            std::cerr << "error : could not write " << baseline_path << "\n";
+            return 1;
+        }
+        std::cout << "\nbaseline written to " << baseline_path << "\n";
+    }
+    return failures == 0 ? 0 : 1;
+}
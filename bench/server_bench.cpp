@@ -0,0 +1,217 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "synth.hpp"
+#include "../src/server.hpp"
+#include "../src/thread_pool.hpp"
+
+namespace {
+    std::string compiler = "build/program";
+    std::string work_dir = "build/bench/server";
+    unsigned requests = 500;
+
+    auto now() {
+        return std::chrono::steady_clock::now();
+    }
+
+    auto ms_since(std::chrono::steady_clock::time_point t) {
+        return std::chrono::duration<double, std::milli>(now() - t).count();
+    }
+
+    auto spawn(const std::vector<std::string>& args) {
+        auto pid = fork();
+        if (pid == 0) {
+            std::vector<char*> argv;
+            for (auto& a : args) {
+                argv.push_back(const_cast<char*>(a.c_str()));
+            }
+            argv.push_back(nullptr);
+            execv(argv[0], argv.data());
+            _exit(127);
+        }
+        return pid;
+    }
+
+    auto wait_ok(pid_t pid) {
+        int status;
+        waitpid(pid, &status, 0);
+        return WIFEXITED(status) and WEXITSTATUS(status) == 0;
+    }
+
+    void report(const std::string& name, std::vector<double> lat,
+                double wall_ms, unsigned failed) {
+        std::sort(lat.begin(), lat.end());
+        auto pct = [&](double p) {
+            return lat[std::min<std::size_t>(lat.size() - 1,
+                                             p / 100 * lat.size())];
+        };
+        std::cout << std::left << std::setw(22) << name << std::right
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(10) << pct(50)
+                  << std::setw(10) << pct(90)
+                  << std::setw(10) << pct(99)
+                  << std::setw(10) << lat.back()
+                  << std::setprecision(0)
+                  << std::setw(10) << lat.size() / wall_ms * 1e3
+                  << std::setw(8) << failed << std::endl;
+    }
+
+    auto source_path(unsigned i) {
+        return work_dir + "/r" + std::to_string(i) + ".c";
+    }
+
+    // Every mode writes its own outputs so that none of them pays for
+    // truncating files left by an earlier one.
+    auto output_path(unsigned i, const std::string& mode) {
+        return work_dir + "/r" + std::to_string(i) + "." + mode + ".s";
+    }
+
+    void run_server_clients(const std::string& sock, unsigned clients,
+                            bool inline_source,
+                            const std::vector<std::string>& sources) {
+        std::vector<double> lat(requests);
+        std::vector<unsigned> failures(clients, 0);
+        auto mode = std::string(inline_source ? "inline" : "path")
+            + std::to_string(clients);
+        std::vector<std::thread> threads;
+        auto start = now();
+        for (auto c = 0u; c < clients; c++) {
+            threads.emplace_back([&, c]() {
+                for (auto i = c; i < requests; i += clients) {
+                    t_request req;
+                    req.output = output_path(i, mode);
+                    if (inline_source) {
+                        req.source = sources[i];
+                        req.has_source = true;
+                    } else {
+                        req.input = source_path(i);
+                    }
+                    auto t = now();
+                    try {
+                        if (send_request(sock, req).status != 0) {
+                            failures[c]++;
+                        }
+                    } catch (const std::runtime_error&) {
+                        failures[c]++;
+                    }
+                    lat[i] = ms_since(t);
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        auto failed = 0u;
+        for (auto f : failures) {
+            failed += f;
+        }
+        report("server " + mode, lat, ms_since(start), failed);
+    }
+}
+
+int main(int argc, char** argv) {
+    auto jobs = default_thread_count();
+    auto usage = [] {
+        std::cerr << "usage : server_bench [--requests=N] [--jobs=N] "
+                  << "[--compiler=PATH]\n";
+        return 1;
+    };
+    for (auto i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = arg.substr(arg.find('=') + 1);
+        if (arg.compare(0, 11, "--requests=") == 0) {
+            if (not parse_count(value, requests)) {
+                return usage();
+            }
+            requests = std::max(1u, requests);
+        } else if (arg.compare(0, 7, "--jobs=") == 0) {
+            if (not parse_count(value, jobs)) {
+                return usage();
+            }
+            jobs = std::max(1u, jobs);
+        } else if (arg.compare(0, 11, "--compiler=") == 0) {
+            compiler = value;
+        } else {
+            return usage();
+        }
+    }
+    if (std::system(("mkdir -p " + work_dir).c_str()) != 0) {
+        std::cerr << "error : could not create " << work_dir << "\n";
+        return 1;
+    }
+    char cwd[4096];
+    if (getcwd(cwd, sizeof(cwd)) == nullptr) {
+        return 1;
+    }
+    work_dir = std::string(cwd) + "/" + work_dir;
+
+    // Tiny translation units, where fixed per-compile costs dominate.
+    std::vector<std::string> sources;
+    for (auto i = 0u; i < requests; i++) {
+        t_synth_params params;
+        params.seed = i + 1;
+        params.functions = 1 + i % 3;
+        params.statements = 5;
+        sources.push_back(gen_program(params));
+        std::ofstream(source_path(i)) << sources.back();
+    }
+
+    std::cout << requests << " requests, latency in ms\n";
+    std::cout << std::left << std::setw(22) << "mode" << std::right
+              << std::setw(10) << "p50"
+              << std::setw(10) << "p90"
+              << std::setw(10) << "p99"
+              << std::setw(10) << "max"
+              << std::setw(10) << "req/s"
+              << std::setw(8) << "failed" << "\n";
+
+    std::vector<double> lat;
+    auto failed = 0u;
+    auto start = now();
+    for (auto i = 0u; i < requests; i++) {
+        auto t = now();
+        if (not wait_ok(spawn({compiler, source_path(i),
+                                    output_path(i, "process")}))) {
+            failed++;
+        }
+        lat.push_back(ms_since(t));
+    }
+    report("process per file", lat, ms_since(start), failed);
+
+    auto sock = work_dir + "/cc.sock";
+    auto server = spawn({compiler, "--serve=" + sock,
+                         "--jobs=" + std::to_string(jobs)});
+    auto up = false;
+    for (auto i = 0; i < 500 and not up; i++) {
+        try {
+            t_request req;
+            req.has_source = true;
+            req.source = "int main() { return 0; }";
+            req.output = work_dir + "/warmup.s";
+            up = send_request(sock, req).status == 0;
+        } catch (const std::runtime_error&) {
+            usleep(10000);
+        }
+    }
+    if (not up) {
+        std::cerr << "error : server did not start\n";
+        kill(server, SIGTERM);
+        return 1;
+    }
+    run_server_clients(sock, 1, false, sources);
+    run_server_clients(sock, 1, true, sources);
+    if (jobs > 1) {
+        run_server_clients(sock, jobs, true, sources);
+    }
+    send_shutdown(sock);
+    return wait_ok(server) ? 0 : 1;
+}
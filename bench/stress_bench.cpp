@@ -0,0 +1,240 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include "../src/lex.hpp"
+#include "../src/ast.hpp"
+#include "../src/asm_gen.hpp"
+
+// Compiles pathologically deep programs: every case nests one construct
+// depth times, so a compiler that recurses on the native stack crashes
+// long before the largest depths. Time per level should stay flat as the
+// depth grows. With --run the output is also assembled and executed and
+// its exit status checked.
+namespace {
+    struct t_case {
+        std::string name;
+        std::function<std::string(unsigned)> gen;
+        // Expected exit status, or -1 when the program is not run (its
+        // runtime stack use grows with the depth).
+        int expect;
+    };
+
+    struct t_result {
+        bool ok;
+        unsigned long bytes;
+        double lex_s;
+        double parse_s;
+        double codegen_s;
+        double free_s;
+    };
+
+    std::string work_dir = "build/bench/stress";
+    bool run = false;
+
+    auto seconds_since(std::chrono::steady_clock::time_point t) {
+        auto d = std::chrono::steady_clock::now() - t;
+        return std::chrono::duration<double>(d).count();
+    }
+
+    auto repeat(const std::string& s, unsigned n) {
+        std::string res;
+        res.reserve(s.size() * n);
+        for (auto i = 0u; i < n; i++) {
+            res += s;
+        }
+        return res;
+    }
+
+    auto wrap(const std::string& body) {
+        return "int main() {\n    int a;\n    a = 1;\n" + body + "}\n";
+    }
+
+    std::vector<t_case> cases = {
+        {"parens", [](unsigned n) {
+            return wrap("return " + repeat("(", n) + "7" + repeat(")", n)
+                        + ";\n");
+        }, 7},
+        {"add chain", [](unsigned n) {
+            return wrap("return 0" + repeat(" + a", n) + " - "
+                        + std::to_string(n) + ";\n");
+        }, 0},
+        {"unary chain", [](unsigned n) {
+            return wrap("return " + repeat("- ", n * 2) + "5;\n");
+        }, 5},
+        {"ternary chain", [](unsigned n) {
+            return wrap("return " + repeat("a - 1 ? 0 : ", n) + "9;\n");
+        }, 9},
+        {"assign chain", [](unsigned n) {
+            return wrap(repeat("a = ", n) + "3;\nreturn a;\n");
+        }, -1},
+        {"blocks", [](unsigned n) {
+            return wrap(repeat("{", n) + "a = 4;" + repeat("}", n)
+                        + "\nreturn a;\n");
+        }, 4},
+        {"ifs", [](unsigned n) {
+            return wrap(repeat("if (a) ", n) + "a = 6;\nreturn a;\n");
+        }, 6},
+        {"if-else", [](unsigned n) {
+            return wrap(repeat("if (a - 1) a = 0; else ", n)
+                        + "a = 8;\nreturn a;\n");
+        }, 8},
+        {"whiles", [](unsigned n) {
+            return wrap(repeat("while (a) ", n) + "a = 0;\nreturn 2;\n");
+        }, 2},
+        {"pointer", [](unsigned n) {
+            return wrap("int " + repeat("*", n) + "p;\nreturn 3;\n");
+        }, 3},
+    };
+
+    auto measure(const t_case& c, unsigned depth, const std::string& out) {
+        t_result r = {false, 0, 0, 0, 0, 0};
+        auto src = c.gen(depth);
+        r.bytes = src.size();
+        try {
+            auto t = std::chrono::steady_clock::now();
+            auto tokens = lex(src);
+            r.lex_s = seconds_since(t);
+            t = std::chrono::steady_clock::now();
+            auto ast = new t_ast(parse_program(tokens));
+            r.parse_s = seconds_since(t);
+            t = std::chrono::steady_clock::now();
+            auto res = gen_asm(*ast);
+            r.codegen_s = seconds_since(t);
+            t = std::chrono::steady_clock::now();
+            delete ast;
+            r.free_s = seconds_since(t);
+            if (not out.empty()) {
+                std::ofstream os(out + ".s");
+                os << res;
+            }
+            r.ok = true;
+        } catch (const std::runtime_error& e) {
+            std::cerr << "error : " << e.what() << "\n";
+        }
+        return r;
+    }
+
+    // As in compile_bench, each measurement runs in a child process so
+    // that its peak RSS is its own, and so that a crash on a deep input
+    // is reported instead of ending the sweep.
+    auto run_isolated(const t_case& c, unsigned depth, const std::string& out,
+                      long& peak_rss_kb) {
+        t_result r = {false, 0, 0, 0, 0, 0};
+        int fds[2];
+        if (pipe(fds) != 0) {
+            throw std::runtime_error("pipe failed");
+        }
+        auto pid = fork();
+        if (pid == 0) {
+            close(fds[0]);
+            auto res = measure(c, depth, out);
+            auto n = write(fds[1], &res, sizeof(res));
+            _exit(n == sizeof(res) ? 0 : 1);
+        }
+        close(fds[1]);
+        auto n = read(fds[0], &r, sizeof(r));
+        close(fds[0]);
+        int status;
+        rusage ru;
+        wait4(pid, &status, 0, &ru);
+        peak_rss_kb = ru.ru_maxrss;
+        if (n != sizeof(r) or not WIFEXITED(status)) {
+            r.ok = false;
+        }
+        return r;
+    }
+
+    auto run_program(const std::string& out) {
+        auto cmd = "gcc -Wl,-z,noexecstack " + out + ".s -o " + out;
+        if (std::system(cmd.c_str()) != 0) {
+            return -2;
+        }
+        auto status = std::system(out.c_str());
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -3;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<unsigned> depths = {1000, 10000, 100000, 1000000};
+    for (auto i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--quick") {
+            depths = {1000, 100000};
+        } else if (arg == "--run") {
+            run = true;
+        } else if (arg.compare(0, 7, "--work=") == 0) {
+            work_dir = arg.substr(7);
+        } else {
+            std::cerr << "usage : stress_bench [--quick] [--run] "
+                      << "[--work=DIR]\n";
+            return 1;
+        }
+    }
+    if (run and std::system(("mkdir -p " + work_dir).c_str()) != 0) {
+        std::cerr << "error : could not create " << work_dir << "\n";
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(15) << "case" << std::right
+              << std::setw(9) << "depth"
+              << std::setw(11) << "kB src"
+              << std::setw(10) << "lex ms"
+              << std::setw(10) << "parse ms"
+              << std::setw(12) << "codegen ms"
+              << std::setw(9) << "free ms"
+              << std::setw(10) << "ns/level"
+              << std::setw(11) << "peak kB"
+              << std::setw(8) << "result" << "\n";
+    auto failures = 0u;
+    for (auto& c : cases) {
+        for (auto depth : depths) {
+            std::string out;
+            if (run and c.expect >= 0) {
+                out = work_dir + "/" + c.name + "." + std::to_string(depth);
+                std::replace(out.begin(), out.end(), ' ', '_');
+            }
+            long peak_rss_kb;
+            auto r = run_isolated(c, depth, out, peak_rss_kb);
+            std::cout << std::left << std::setw(15) << c.name << std::right
+                      << std::setw(9) << depth;
+            if (not r.ok) {
+                std::cout << "  FAILED" << std::endl;
+                failures++;
+                continue;
+            }
+            auto total = r.lex_s + r.parse_s + r.codegen_s + r.free_s;
+            std::cout << std::fixed << std::setprecision(2)
+                      << std::setw(11) << r.bytes / 1024.0
+                      << std::setw(10) << r.lex_s * 1e3
+                      << std::setw(10) << r.parse_s * 1e3
+                      << std::setw(12) << r.codegen_s * 1e3
+                      << std::setw(9) << r.free_s * 1e3
+                      << std::setprecision(1)
+                      << std::setw(10) << total * 1e9 / depth
+                      << std::setw(11) << peak_rss_kb;
+            if (not out.empty()) {
+                auto status = run_program(out);
+                std::cout << std::setw(8) << status;
+                if (status != c.expect) {
+                    std::cout << "  MISMATCH (expected " << c.expect << ")";
+                    failures++;
+                }
+            } else {
+                std::cout << std::setw(8) << "-";
+            }
+            std::cout << std::endl;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,265 @@
+#include <string>
+#include <vector>
+#include <random>
+#include <climits>
+
+#include "synth.hpp"
+
+namespace {
+    t_synth_params p;
+    std::mt19937 rng;
+    std::string out;
+    std::vector<std::string> vars;
+    std::vector<std::string> arrays;
+    unsigned indent;
+    unsigned loop_var_count;
+
+    auto rand_below(unsigned n) {
+        return unsigned(rng() % n);
+    }
+
+    auto constant(unsigned lo, unsigned hi) {
+        return std::to_string(lo + rand_below(hi - lo + 1));
+    }
+
+    auto line(const std::string& s) {
+        out.append(4 * indent, ' ');
+        out += s;
+        out += "\n";
+    }
+
+    auto is_2d(unsigned array_idx) {
+        return array_idx % 2 == 1;
+    }
+
+    std::string element(unsigned array_idx) {
+        auto res = arrays[array_idx];
+        if (is_2d(array_idx)) {
+            res += "[" + constant(0, 3) + "]";
+        }
+        res += "[" + constant(0, p.array_size - 1) + "]";
+        return res;
+    }
+
+    std::string leaf() {
+        auto k = rand_below(4);
+        if (k == 0 or vars.empty()) {
+            return constant(0, 99);
+        } else if (k == 1 and not arrays.empty()) {
+            return element(rand_below(arrays.size()));
+        } else {
+            return vars[rand_below(vars.size())];
+        }
+    }
+
+    std::string exp(unsigned depth) {
+        if (depth == 0) {
+            return leaf();
+        }
+        if (rand_below(8) == 0) {
+            return "(" + exp(depth - 1) + " ? " + exp(depth - 1) + " : "
+                + exp(depth - 1) + ")";
+        }
+        static const std::vector<std::string> ops = {
+            "+", "-", "*", "/", "%", "<", "<=", ">", ">=", "==", "!=",
+            "&&", "||"
+        };
+        auto res = "(" + exp(depth - 1);
+        for (auto i = 1u; i < p.exp_width; i++) {
+            auto& op = ops[rand_below(ops.size())];
+            res += " " + op + " ";
+            if (op == "/" or op == "%") {
+                res += constant(1, 9);
+            } else {
+                res += exp(depth - 1);
+            }
+        }
+        return res + ")";
+    }
+
+    void simple_statement() {
+        if (not arrays.empty() and rand_below(3) == 0) {
+            line(element(rand_below(arrays.size())) + " = "
+                 + exp(p.exp_depth) + ";");
+        } else {
+            line(vars[rand_below(p.locals)] + " = " + exp(p.exp_depth) + ";");
+        }
+    }
+
+    void statement(unsigned level, bool allow_loop);
+
+    void loop(unsigned level);
+
+    void block(unsigned level, bool nested_loop) {
+        auto loop_pos = nested_loop ? rand_below(p.block_size) : p.block_size;
+        for (auto i = 0u; i < p.block_size; i++) {
+            if (i == loop_pos) {
+                loop(level);
+            } else {
+                simple_statement();
+            }
+        }
+    }
+
+    void loop(unsigned level) {
+        auto iv = "i" + std::to_string(loop_var_count++);
+        auto bound = constant(2, 8);
+        auto nested = level + 1 < p.loop_nesting;
+        auto kind = rand_below(3);
+        if (kind == 0) {
+            line("for (int " + iv + " = 0; " + iv + " < " + bound + "; "
+                 + iv + " = " + iv + " + 1) {");
+        } else {
+            line("{");
+            indent++;
+            line("int " + iv + " = 0;");
+            line(kind == 1 ? "while (" + iv + " < " + bound + ") {" : "do {");
+        }
+        indent++;
+        vars.push_back(iv);
+        if (rand_below(4) == 0) {
+            line("if (" + exp(1) + " > " + constant(50, 99) + ") break;");
+        }
+        block(level + 1, nested);
+        if (kind != 0) {
+            line(iv + " = " + iv + " + 1;");
+        }
+        vars.pop_back();
+        indent--;
+        if (kind == 0) {
+            line("}");
+            return;
+        }
+        if (kind == 1) {
+            line("}");
+        } else {
+            line("} while (" + iv + " < " + bound + ");");
+        }
+        indent--;
+        line("}");
+    }
+
+    void statement(unsigned level, bool allow_loop) {
+        auto k = rand_below(4);
+        if (allow_loop and level < p.loop_nesting and k < 2) {
+            loop(level);
+        } else if (k == 2) {
+            line("if (" + exp(p.exp_depth) + ") {");
+            indent++;
+            block(level, false);
+            indent--;
+            line("} else {");
+            indent++;
+            block(level, false);
+            indent--;
+            line("}");
+        } else {
+            simple_statement();
+        }
+    }
+
+    void function(unsigned idx) {
+        vars.clear();
+        arrays.clear();
+        loop_var_count = 0;
+        line("int f" + std::to_string(idx) + "() {");
+        indent++;
+        for (auto i = 0u; i < p.locals; i++) {
+            vars.push_back("v" + std::to_string(i));
+            line("int " + vars.back() + " = " + constant(0, 99) + ";");
+        }
+        for (auto i = 0u; i < p.arrays; i++) {
+            arrays.push_back("a" + std::to_string(i));
+            auto dims = std::string();
+            if (is_2d(i)) {
+                dims += "[4]";
+            }
+            dims += "[" + std::to_string(p.array_size) + "]";
+            line("int " + arrays.back() + dims + ";");
+        }
+        for (auto i = 0u; i < p.statements; i++) {
+            statement(0, true);
+        }
+        line("return " + exp(p.exp_depth) + ";");
+        indent--;
+        line("}");
+    }
+}
+
+bool parse_count(const std::string& s, unsigned& value) {
+    if (s.empty() or s.size() > 10
+        or s.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    auto v = std::stoull(s);
+    if (v > UINT_MAX) {
+        return false;
+    }
+    value = unsigned(v);
+    return true;
+}
+
+bool set_synth_param(t_synth_params& params, const std::string& arg) {
+    auto eq = arg.find('=');
+    unsigned value;
+    if (arg.compare(0, 2, "--") != 0 or eq == std::string::npos
+        or not parse_count(arg.substr(eq + 1), value)) {
+        return false;
+    }
+    auto key = arg.substr(2, eq - 2);
+    if (key == "functions") {
+        params.functions = value;
+    } else if (key == "statements") {
+        params.statements = value;
+    } else if (key == "locals") {
+        params.locals = value;
+    } else if (key == "exp-depth") {
+        params.exp_depth = value;
+    } else if (key == "exp-width") {
+        params.exp_width = value;
+    } else if (key == "loop-nesting") {
+        params.loop_nesting = value;
+    } else if (key == "block-size") {
+        params.block_size = value;
+    } else if (key == "arrays") {
+        params.arrays = value;
+    } else if (key == "array-size") {
+        params.array_size = value;
+    } else if (key == "seed") {
+        params.seed = value;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string gen_program(const t_synth_params& params) {
+    p = params;
+    if (p.locals == 0) {
+        p.locals = 1;
+    }
+    if (p.block_size == 0) {
+        p.block_size = 1;
+    }
+    if (p.array_size == 0) {
+        p.array_size = 1;
+    }
+    rng.seed(p.seed);
+    out.clear();
+    indent = 0;
+    for (auto i = 0u; i < p.functions; i++) {
+        function(i);
+    }
+    // Every function is called and its value used, so that none is
+    // dropped as unreachable or as a call without effect.
+    line("int main() {");
+    indent++;
+    line("int s = 0;");
+    for (auto i = 0u; i < p.functions; i++) {
+        line("s = s + f" + std::to_string(i) + "();");
+    }
+    line("return s;");
+    indent--;
+    line("}");
+    return out;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+
+struct t_synth_params {
+    unsigned functions = 10;
+    unsigned statements = 20;
+    unsigned locals = 4;
+    unsigned exp_depth = 3;
+    unsigned exp_width = 2;
+    unsigned loop_nesting = 2;
+    unsigned block_size = 3;
+    unsigned arrays = 2;
+    unsigned array_size = 16;
+    unsigned seed = 1;
+};
+
+// Parses a decimal count, rejecting anything that does not fit unsigned.
+bool parse_count(const std::string& s, unsigned& value);
+bool set_synth_param(t_synth_params& params, const std::string& arg);
+std::string gen_program(const t_synth_params& params);
@@ -0,0 +1,498 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <climits>
+#include <sys/resource.h>
+
+#include "counters.hpp"
+
+// Searches the compiler's code generation parameters for the fastest
+// build of one program on one input. The space is what the compiler lists
+// with --list-params, optionally narrowed by a space file. Each candidate
+// is written as a parameter file, compiled with --params=, checked against
+// the output of the default build and timed several times; its score is
+// the median of those runs. A random search over the space is followed by
+// hill climbing from the best point found, and the winner is timed again
+// against the defaults before it is written out.
+namespace {
+    struct t_param {
+        std::string name;
+        unsigned value;
+        unsigned min;
+        unsigned max;
+    };
+
+    typedef std::vector<unsigned> t_config;
+
+    struct t_result {
+        bool ok;
+        std::string note;
+        std::uint64_t median;
+        std::uint64_t min;
+        std::uint64_t instructions;
+    };
+
+    struct t_trial {
+        std::string phase;
+        t_config config;
+        t_result result;
+    };
+
+    std::string program_path;
+    std::string input_path;
+    std::string compiler = "build/program";
+    std::string work_dir = "build/tune";
+    std::string space_path;
+    std::string out_path;
+    std::string report_path;
+    unsigned budget = 40;
+    unsigned runs = 5;
+    unsigned seed = 1;
+    double min_gain = 0.01;
+
+    std::vector<t_param> params;
+    std::vector<t_trial> trials;
+    // Candidates that compile to the same assembly share a measurement.
+    std::map<std::string, t_result> by_code;
+    int ref_status;
+    std::string ref_output;
+
+    auto read_file(const std::string& path, std::string& text) {
+        std::ifstream is(path, std::ios::binary);
+        std::stringstream buf;
+        buf << is.rdbuf();
+        text = buf.str();
+        return is.good() or is.eof();
+    }
+
+    auto load_space() {
+        auto list = work_dir + "/params.list";
+        if (std::system((compiler + " --list-params > " + list).c_str())
+            != 0) {
+            return false;
+        }
+        std::ifstream is(list);
+        t_param p;
+        while (is >> p.name >> p.value >> p.min >> p.max) {
+            params.push_back(p);
+        }
+        if (space_path.empty()) {
+            return not params.empty();
+        }
+        // Lines of the space file are "<name> <min> <max>"; parameters
+        // not named keep their defaults.
+        std::ifstream ss(space_path);
+        if (not ss.good()) {
+            return false;
+        }
+        std::set<std::string> named;
+        std::string line;
+        while (std::getline(ss, line)) {
+            std::istringstream ls(line.substr(0, line.find('#')));
+            std::string name;
+            unsigned lo, hi;
+            if (not (ls >> name)) {
+                continue;
+            }
+            auto it = std::find_if(params.begin(), params.end(),
+                                   [&](auto& p) { return p.name == name; });
+            if (not (ls >> lo >> hi) or it == params.end()
+                or lo > hi or lo < it->min or hi > it->max) {
+                std::cerr << "error : bad space line: " << line << "\n";
+                return false;
+            }
+            it->min = lo;
+            it->max = hi;
+            it->value = std::min(std::max(it->value, lo), hi);
+            named.insert(name);
+        }
+        for (auto& p : params) {
+            if (not named.count(p.name)) {
+                p.min = p.max = p.value;
+            }
+        }
+        return true;
+    }
+
+    auto defaults() {
+        t_config c;
+        for (auto& p : params) {
+            c.push_back(p.value);
+        }
+        return c;
+    }
+
+    auto write_config(const std::string& path, const t_config& c) {
+        std::ofstream os(path);
+        for (auto i = 0u; i < params.size(); i++) {
+            os << params[i].name << " = " << c[i] << "\n";
+        }
+        return os.good();
+    }
+
+    // The parameters that differ from the defaults.
+    auto describe(const t_config& c) {
+        std::string res;
+        for (auto i = 0u; i < params.size(); i++) {
+            if (c[i] != params[i].value) {
+                res += (res.empty() ? "" : " ") + params[i].name + "="
+                    + std::to_string(c[i]);
+            }
+        }
+        return res.empty() ? std::string("defaults") : res;
+    }
+
+    auto median(std::vector<std::uint64_t> v) {
+        std::sort(v.begin(), v.end());
+        return v[v.size() / 2];
+    }
+
+    // Times the built candidate n times. The first run's output is
+    // checked against the reference unless this is the reference.
+    t_result measure(unsigned n, bool reference) {
+        auto exe = work_dir + "/cand";
+        auto out = work_dir + "/cand.out";
+        t_result r = {false, "", 0, 0, 0};
+        std::vector<std::uint64_t> cycles;
+        std::vector<std::uint64_t> instructions;
+        for (auto i = 0u; i < n; i++) {
+            auto s = run_counted(exe, input_path, i == 0 ? out : "/dev/null");
+            if (not s.ok) {
+                r.note = "run failed";
+                return r;
+            }
+            if (i == 0) {
+                std::string output;
+                read_file(out, output);
+                if (reference) {
+                    ref_status = s.status;
+                    ref_output = output;
+                } else if (s.status != ref_status or output != ref_output) {
+                    r.note = "wrong output";
+                    return r;
+                }
+            }
+            cycles.push_back(s.cycles);
+            instructions.push_back(s.instructions);
+        }
+        r.ok = true;
+        r.median = median(cycles);
+        r.min = *std::min_element(cycles.begin(), cycles.end());
+        r.instructions = median(instructions);
+        return r;
+    }
+
+    auto build(const t_config& c, std::string& code) {
+        auto base = work_dir + "/cand";
+        write_config(base + ".params", c);
+        auto cmd = compiler + " --params=" + base + ".params "
+            + program_path + " " + base + ".s && gcc -Wl,-z,noexecstack "
+            + base + ".s -o " + base;
+        return std::system(cmd.c_str()) == 0 and read_file(base + ".s", code);
+    }
+
+    auto print_header(std::ostream& os) {
+        os << std::left << std::setw(5) << "#" << std::setw(9) << "phase"
+           << std::right << std::setw(15) << "median" << std::setw(15)
+           << "min" << std::setw(15) << "instructions" << std::setw(10)
+           << "speedup" << "  config\n";
+    }
+
+    auto print_trial(std::ostream& os, unsigned k, const t_trial& t,
+                     std::uint64_t base) {
+        auto& r = t.result;
+        os << std::left << std::setw(5) << k << std::setw(9) << t.phase
+           << std::right;
+        if (r.ok) {
+            os << std::setw(15) << r.median << std::setw(15) << r.min
+               << std::setw(15) << r.instructions << std::setw(9)
+               << std::fixed << std::setprecision(3)
+               << double(base) / r.median << "x";
+        } else {
+            os << std::setw(55) << "-";
+        }
+        os << "  " << describe(t.config);
+        if (not r.note.empty()) {
+            os << " (" << r.note << ")";
+        }
+        os << std::endl;
+    }
+
+    const t_result& evaluate(const std::string& phase, const t_config& c) {
+        t_trial t = {phase, c, {false, "", 0, 0, 0}};
+        std::string code;
+        if (not build(c, code)) {
+            t.result.note = "build failed";
+        } else if (by_code.count(code)) {
+            t.result = by_code[code];
+            t.result.note = "same code";
+        } else {
+            t.result = measure(runs, trials.empty());
+            by_code[code] = t.result;
+        }
+        trials.push_back(t);
+        auto base = trials[0].result.ok ? trials[0].result.median : 0;
+        print_trial(std::cout, unsigned(trials.size() - 1), t, base);
+        return trials.back().result;
+    }
+
+    // Wide ranges are sampled on a log scale, so that small values are
+    // tried as often as large ones.
+    unsigned random_value(const t_param& p, std::mt19937& rng) {
+        if (p.max - p.min <= 16) {
+            return std::uniform_int_distribution<unsigned>(p.min, p.max)(rng);
+        }
+        auto lo = std::log(double(std::max(p.min, 1u)));
+        auto hi = std::log(double(p.max) + 1);
+        auto v = unsigned(std::exp(
+            std::uniform_real_distribution<double>(lo, hi)(rng)));
+        return std::min(std::max(v, p.min), p.max);
+    }
+
+    auto neighbors(const t_param& p, unsigned v) {
+        std::vector<unsigned> res;
+        if (p.max - p.min <= 16) {
+            res = {v - 1, v + 1};
+        } else {
+            res = {v / 2, v == 0 ? 1 : 2 * v};
+        }
+        res.erase(std::remove_if(res.begin(), res.end(), [&](unsigned x) {
+            return x < p.min or x > p.max or x == v;
+        }), res.end());
+        return res;
+    }
+
+    auto better(const t_result& r, const t_result& best) {
+        return r.ok and r.median < best.median * (1 - min_gain);
+    }
+
+    auto write_report(std::ostream& os, const t_config& best,
+                      const t_result& base, const t_result& tuned) {
+        os << "program      " << program_path << "\n"
+           << "input        " << (input_path.empty() ? "-" : input_path)
+           << "\n"
+           << "compiler     " << compiler << "\n"
+           << "candidates   " << trials.size() << " of " << budget
+           << ", " << runs << " runs each, seed " << seed << "\n"
+           << "min gain     " << min_gain * 100 << "%\n";
+        if (not have_perf_counters()) {
+            os << "cycles       TSC ticks including process startup\n";
+        }
+        os << "\nspace\n";
+        for (auto& p : params) {
+            os << "  " << std::left << std::setw(24) << p.name << std::right
+               << p.min << ".." << p.max << " (default " << p.value
+               << ")\n";
+        }
+        os << "\n";
+        print_header(os);
+        for (auto k = 0u; k < trials.size(); k++) {
+            print_trial(os, k, trials[k], trials[0].result.median);
+        }
+        os << "\nconfirmed over " << 2 * runs << " runs each\n"
+           << "  defaults  " << base.median << " cycles\n"
+           << "  best      " << tuned.median << " cycles, "
+           << std::fixed << std::setprecision(3)
+           << double(base.median) / tuned.median << "x\n"
+           << "\nbest: " << describe(best) << "\n";
+    }
+
+    auto parse_count(const std::string& s, unsigned& value) {
+        if (s.empty() or s.size() > 10
+            or s.find_first_not_of("0123456789") != std::string::npos) {
+            return false;
+        }
+        auto v = std::stoull(s);
+        if (v > UINT_MAX) {
+            return false;
+        }
+        value = unsigned(v);
+        return true;
+    }
+
+    auto parse_percent(const std::string& s, double& value) {
+        char* end;
+        auto v = std::strtod(s.c_str(), &end);
+        if (s.empty() or *end != '\0' or not std::isfinite(v)) {
+            return false;
+        }
+        value = v / 100;
+        return true;
+    }
+
+    auto usage() {
+        std::cerr << "usage : tune --program=FILE [--input=FILE] "
+                  << "[--compiler=PATH] [--work=DIR] [--space=FILE] "
+                  << "[--budget=N] [--runs=N] [--seed=N] "
+                  << "[--min-gain=PERCENT] [--out=FILE] [--report=FILE]\n";
+        return 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    for (auto i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = arg.substr(arg.find('=') + 1);
+        if (arg.compare(0, 10, "--program=") == 0) {
+            program_path = value;
+        } else if (arg.compare(0, 8, "--input=") == 0) {
+            input_path = value;
+        } else if (arg.compare(0, 11, "--compiler=") == 0) {
+            compiler = value;
+        } else if (arg.compare(0, 7, "--work=") == 0) {
+            work_dir = value;
+        } else if (arg.compare(0, 8, "--space=") == 0) {
+            space_path = value;
+        } else if (arg.compare(0, 9, "--budget=") == 0) {
+            if (not parse_count(value, budget)) {
+                return usage();
+            }
+            budget = std::max(1u, budget);
+        } else if (arg.compare(0, 7, "--runs=") == 0) {
+            if (not parse_count(value, runs)) {
+                return usage();
+            }
+            runs = std::max(1u, runs);
+        } else if (arg.compare(0, 7, "--seed=") == 0) {
+            if (not parse_count(value, seed)) {
+                return usage();
+            }
+        } else if (arg.compare(0, 11, "--min-gain=") == 0) {
+            if (not parse_percent(value, min_gain)) {
+                return usage();
+            }
+        } else if (arg.compare(0, 6, "--out=") == 0) {
+            out_path = value;
+        } else if (arg.compare(0, 9, "--report=") == 0) {
+            report_path = value;
+        } else {
+            return usage();
+        }
+    }
+    if (program_path.empty()) {
+        return usage();
+    }
+    if (out_path.empty()) {
+        out_path = work_dir + "/best.params";
+    }
+    if (report_path.empty()) {
+        report_path = work_dir + "/report.txt";
+    }
+    if (std::system(("mkdir -p " + work_dir).c_str()) != 0) {
+        std::cerr << "error : could not create " << work_dir << "\n";
+        return 1;
+    }
+    if (not load_space()) {
+        std::cerr << "error : could not read the parameter space\n";
+        return 1;
+    }
+
+    // Programs keep their arrays on the stack.
+    rlimit stack = {1ull << 30, 1ull << 30};
+    getrlimit(RLIMIT_STACK, &stack);
+    stack.rlim_cur = std::min<rlim_t>(std::max<rlim_t>(stack.rlim_cur,
+                                                       1ull << 30),
+                                      stack.rlim_max);
+    setrlimit(RLIMIT_STACK, &stack);
+
+    print_header(std::cout);
+    auto best = defaults();
+    auto best_result = evaluate("default", best);
+    if (not best_result.ok) {
+        std::cerr << "error : the default build does not run\n";
+        return 1;
+    }
+
+    std::mt19937 rng(seed);
+    std::set<t_config> tried = {best};
+    auto try_config = [&](const std::string& phase, const t_config& c) {
+        if (not tried.insert(c).second) {
+            return false;
+        }
+        auto& r = evaluate(phase, c);
+        if (better(r, best_result)) {
+            best = c;
+            best_result = r;
+            return true;
+        }
+        return false;
+    };
+
+    // Half the budget samples the space; the misses are bounded so that a
+    // small space does not spin.
+    for (auto misses = 0u; trials.size() < (budget + 1) / 2
+             and misses < 100 * budget; ) {
+        t_config c;
+        for (auto& p : params) {
+            c.push_back(random_value(p, rng));
+        }
+        auto n = trials.size();
+        try_config("random", c);
+        if (trials.size() == n) {
+            misses++;
+        }
+    }
+
+    // Then one parameter at a time is moved from the best point, keeping
+    // every move that helps, until no move does.
+    auto improved = true;
+    while (improved and trials.size() < budget) {
+        improved = false;
+        std::vector<unsigned> order(params.size());
+        for (auto i = 0u; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), rng);
+        for (auto i : order) {
+            for (auto v : neighbors(params[i], best[i])) {
+                if (trials.size() >= budget) {
+                    break;
+                }
+                auto c = best;
+                c[i] = v;
+                if (try_config("climb", c)) {
+                    improved = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // The winner was picked out of many noisy measurements, so it is
+    // timed again against the defaults before it is believed.
+    std::string code;
+    build(defaults(), code);
+    auto base = measure(2 * runs, false);
+    auto tuned = base;
+    if (best != defaults()) {
+        build(best, code);
+        tuned = measure(2 * runs, false);
+        if (not tuned.ok or not better(tuned, base)) {
+            std::cout << "\nno confirmed gain over the defaults\n";
+            best = defaults();
+            tuned = base;
+        }
+    }
+    if (not base.ok or not write_config(out_path, best)) {
+        std::cerr << "error : could not write " << out_path << "\n";
+        return 1;
+    }
+    std::ofstream report(report_path);
+    write_report(report, best, base, tuned);
+    std::cout << "\nbest: " << describe(best) << ", " << std::fixed
+              << std::setprecision(3) << double(base.median) / tuned.median
+              << "x\nconfiguration written to " << out_path
+              << "\nreport written to " << report_path << "\n";
+    return report.good() ? 0 : 1;
+}
@@ -0,0 +1,4477 @@
+int f0() {
+    int v0 = 45;
+    int v1 = 39;
+    int v2 = 24;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((48 + 43) || (v1 / 8)) < ((23 * v0) <= (v0 <= v1)));
+    a0[4] = (((a1[0][8] >= v0) * (65 * a0[15])) ? ((20 >= v3) && (46 == v2)) : ((a1[3][15] > v1) / 5));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v1 = (((v3 / 9) ? (a1[2][8] < v0) : (a1[3][14] - a0[11])) == ((v0 != 32) * (a1[1][3] - 1)));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v0 = (((a1[3][13] || v0) <= (v0 * i1)) == ((v1 ? 13 : 26) > (i1 % 7)));
+            v1 = (((46 >= a1[2][1]) ? (94 || a1[2][4]) : (v0 + v3)) ? ((44 % 4) / 1) : ((v2 % 5) / 1));
+            v0 = (((87 || a0[11]) ? (v3 * v3) : (a0[9] && v0)) >= ((a0[14] > i0) ? (a0[5] * a1[1][1]) : (a0[7] % 6)));
+        }
+        a0[15] = (((i0 + 1) != (v0 != a0[4])) || ((24 / 2) ? (74 * 45) : (77 > v3)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a1[3][5] = (((v2 && v0) > (v3 && v1)) != ((75 >= 8) <= (v2 == a0[6])));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            a0[3] = (((a0[0] ? i2 : 50) != (23 / 2)) ? ((v1 || i3) >= (i3 < a0[9])) : ((v0 <= v3) / 1));
+            a1[3][9] = (((v0 <= a0[12]) * (v3 ? v0 : 92)) / 6);
+            a1[2][8] = (((a0[14] < 41) && (v0 <= 91)) >= ((v1 < i2) < (v2 == a0[1])));
+        }
+        a0[12] = (((v3 > v3) < (98 ? v3 : v1)) - ((v3 <= v1) + (i2 ? 3 : a0[13])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v0 = (((v3 / 3) ? (i4 <= 48) : (v0 != 6)) && ((i4 % 1) % 4));
+            {
+                int i5 = 0;
+                do {
+                    if ((a1[1][4] >= 78) > 50) break;
+                    v2 = (((v2 > v0) % 8) == ((v1 <= i4) % 3));
+                    v3 = (((v0 * v2) * (3 - v1)) ? ((42 ? a0[10] : i5) * (74 <= 69)) : ((a1[0][10] / 8) > (v3 ? i5 : i4)));
+                    a1[2][6] = (((a0[12] < i5) ? (72 > 29) : (36 <= v1)) / 3);
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v2 = (((v0 == v0) ? (50 ? a0[4] : a1[0][9]) : (v1 + a0[8])) >= ((i4 ? v2 : 41) / 6));
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v1 >= 5) + (v1 <= v1)) ? ((v2 > v2) != (v0 && a0[5])) : ((v3 ? 67 : 83) != (83 ? a1[1][1] : v3)));
+    v0 = (((a1[3][3] * a1[3][0]) * (89 - v2)) - ((54 > v3) * (v0 + 35)));
+    if ((((v3 == v0) + (v3 * v0)) >= ((v2 || a1[2][4]) ? (a1[3][9] * 52) : (v2 == 10)))) {
+        v1 = (((v1 <= a1[3][6]) <= (56 * v1)) - ((v0 < v3) % 9));
+        v0 = (((a1[3][10] / 1) < (28 || a1[0][6])) > ((v2 / 5) ? (v0 + 48) : (v3 != 74)));
+        v1 = (((63 ? 75 : a0[13]) || (v1 - a0[6])) ? ((v3 ? v1 : v3) < (a1[2][7] >= 97)) : ((a1[3][9] <= 64) / 9));
+    } else {
+        v1 = (((a0[15] % 9) <= (91 == v3)) < ((26 && a1[0][5]) != (a0[0] ? 72 : v0)));
+        v2 = (((v3 - 18) >= (a1[0][8] ? v2 : a1[0][6])) != ((a1[3][7] - a1[3][12]) / 3));
+        v3 = (((v2 ? 66 : v2) >= (28 ? v1 : a0[14])) + ((a1[2][5] - v1) ? (40 - a1[2][5]) : (v2 || v0)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        a0[11] = (((a0[8] || 16) || (60 >= v2)) / 9);
+        a1[3][12] = (((35 / 8) ? (i6 > 12) : (v1 / 7)) - ((a1[1][5] || 42) - (v1 / 7)));
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            v0 = (((i7 != 3) || (v2 ? a0[0] : 30)) <= ((73 - a1[2][0]) > (v3 * a1[2][10])));
+            v1 = (((60 == v1) || (i7 != 24)) <= ((v3 > i7) == (v1 ? v0 : v0)));
+            v1 = (((v2 * a0[15]) * (a0[14] + i7)) != ((v3 <= v1) <= (98 < a0[14])));
+        }
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        v1 = (((a0[1] * a0[2]) - (11 - 27)) ? ((v3 - a1[2][13]) <= (a1[1][4] - v1)) : ((a1[0][13] ? 94 : v2) && (1 + i8)));
+        v0 = (((a1[0][11] + i8) / 1) ? ((v3 >= v1) && (90 / 6)) : ((v0 + v1) ? (v1 == a1[3][2]) : (i8 != v3)));
+        {
+            int i9 = 0;
+            do {
+                v2 = (((63 > i9) / 9) ? ((a1[2][14] == a1[2][7]) - (v3 + v3)) : ((a0[4] / 6) != (v1 <= v1)));
+                a0[10] = (((i8 > a1[1][6]) <= (i9 >= a0[2])) >= ((v3 < a1[2][2]) > (v0 ? 40 : 19)));
+                v2 = (((v3 > 69) && (v3 / 7)) <= ((a1[1][10] <= a0[6]) >= (9 % 1)));
+                i9 = i9 + 1;
+            } while (i9 < 3);
+        }
+    }
+    return (((v0 > 9) != (v0 * 54)) < ((v0 && a0[12]) != (62 <= v0)));
+}
+int f1() {
+    int v0 = 21;
+    int v1 = 26;
+    int v2 = 38;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((81 != 31) <= (v2 - v3)) % 9);
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((a0[6] != a0[9]) > 51) break;
+            a0[6] = (((v3 >= a0[8]) < (19 < v0)) && ((v2 / 8) && (v1 <= a0[3])));
+            v3 = (((v2 && v2) && (i0 == a0[13])) - ((v2 ? v0 : i0) < (a0[2] - a0[6])));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a1[0][8] = (((69 * i0) + (37 < a0[8])) % 5);
+                v3 = (((i0 % 1) > (a1[2][9] - v2)) > ((v2 != 91) - (v3 + a0[2])));
+                v1 = (((v1 + v1) || (a0[11] != 3)) >= ((i1 >= v0) > (75 || a1[1][7])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a1[2][0] = (((a1[1][11] * 30) == (a0[9] * 26)) / 6);
+        a0[14] = (((a0[14] || a0[15]) && (v2 % 1)) != ((i2 ? v2 : v1) + (v0 * i2)));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((v1 ? v0 : v0) == (i3 + i2)) == ((i3 ? i2 : v1) * (a0[8] + v1)));
+                a1[3][6] = (((a0[1] == a1[2][8]) - (i2 - i3)) % 6);
+                a1[0][0] = (((v0 - i3) == (v0 - a0[3])) || ((i2 % 4) < (a1[2][13] != v2)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    if ((((v0 < 59) * (v0 >= v1)) * ((v3 && a0[10]) - (a1[1][13] <= a1[1][8])))) {
+        v1 = (((v0 + v2) < (15 && v3)) >= ((26 == v1) - (v3 < v3)));
+        a1[2][12] = (((70 ? a1[2][2] : 13) != (a0[0] ? v3 : v3)) ? ((v3 || 34) / 5) : ((35 > v2) || (a1[0][12] < v0)));
+        v0 = (((v0 + v0) / 8) || ((v0 == 91) * (v0 && a0[14])));
+    } else {
+        v3 = (((v0 - 19) != (v1 + 73)) <= ((v3 ? v0 : 66) < (35 ? a0[8] : 20)));
+        a1[1][4] = (((50 || v2) || (23 != v3)) < ((v2 || a0[3]) && (a1[0][0] != v0)));
+        a1[3][2] = (((v0 / 6) && (73 ? v2 : 64)) <= ((a1[2][7] * a1[0][14]) <= (v1 > v1)));
+    }
+    if ((((a0[7] != v3) - (v0 ? a1[0][15] : a0[14])) + ((v2 ? v0 : 6) != (v0 == v1)))) {
+        v0 = (((v1 <= v1) <= (a1[0][8] * a1[1][0])) != ((v2 % 8) > (32 % 2)));
+        v2 = (((v3 <= a0[6]) ? (a1[1][15] < v2) : (v2 - v3)) / 8);
+        a0[8] = (((36 >= v3) && (v0 / 8)) > ((34 != v3) && (v0 >= v3)));
+    } else {
+        v0 = (((a1[0][5] != a0[6]) + (v0 / 8)) ? ((v1 == v2) || (v1 / 2)) : ((v1 ? 56 : a0[0]) || (56 * 57)));
+        v2 = (((v0 || a0[11]) - (52 && a1[1][15])) % 3);
+        a1[3][8] = (((v1 % 8) <= (a1[3][7] > a1[2][7])) >= ((v0 * 16) / 7));
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v2 + 2) <= (v1 <= a1[1][9])) ? ((a1[3][13] > v2) + (i4 / 8)) : ((v1 == v3) % 8));
+            v2 = (((v1 ? 94 : 59) ? (v2 * 41) : (v1 || v1)) * ((a0[1] || v3) + (a1[2][14] ? v3 : v2)));
+            {
+                int i5 = 0;
+                do {
+                    a1[3][9] = (((a1[2][8] >= a0[11]) || (v1 > i4)) - ((v1 < 67) * (i5 || 11)));
+                    v0 = (((80 < v1) < (a1[2][12] >= 90)) == ((10 % 7) && (v1 >= a0[7])));
+                    v2 = (((48 - a1[0][12]) * (72 - i5)) > ((v2 - a0[3]) <= (v3 > v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        do {
+            v0 = (((v0 % 3) >= (i6 != v2)) > ((i6 ? a0[6] : v2) > (a0[15] <= a1[0][9])));
+            a0[8] = (((a1[2][2] > v1) ? (v0 % 4) : (i6 % 7)) ? ((40 % 6) <= (v1 + a0[12])) : ((i6 != v0) > (a1[0][9] >= v0)));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v0 = (((a0[6] / 1) == (v2 % 9)) >= ((v1 > 2) < (i6 != v1)));
+                    v0 = (((a0[14] && i7) <= (i6 % 8)) && ((a0[15] ? 10 : v3) == (v2 == 98)));
+                    v3 = (((i6 < i6) < (v2 == i7)) ? ((a1[2][10] - 95) + (v1 * a0[12])) : ((v3 ? v3 : i6) > (i6 <= i6)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            if ((v3 > 44) > 54) break;
+            v2 = (((v2 ? v3 : a1[1][12]) - (v2 * v1)) % 6);
+            v0 = (((i8 / 7) || (v2 + v1)) || ((7 && 97) + (v2 <= v0)));
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                v2 = (((v1 == i9) < (v0 + i9)) || ((i8 ? i9 : v3) && (v0 > v0)));
+                a0[0] = (((a0[1] ? a0[4] : 99) % 8) - ((v3 > 78) - (a1[2][15] && v1)));
+                v0 = (((a1[1][4] < a0[11]) == (v0 != 72)) - ((a1[0][7] != i8) % 4));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 2) {
+            {
+                int i11 = 0;
+                do {
+                    v0 = (((49 * v3) == (a0[15] ? 17 : v0)) <= ((v2 / 4) != (a1[3][9] > 61)));
+                    v1 = (((v2 > a0[11]) <= (i11 != v2)) % 9);
+                    v3 = (((a1[0][13] - 28) % 9) * ((a1[1][9] >= v2) <= (a0[11] > v0)));
+                    i11 = i11 + 1;
+                } while (i11 < 3);
+            }
+            v3 = (((23 == 76) && (v2 ? v0 : a0[12])) ? ((v1 > 53) ? (a0[8] ? 23 : 50) : (v0 + a1[0][14])) : ((v0 || a1[1][3]) ? (i10 && 37) : (87 < v1)));
+            v3 = (((v0 || 8) < (72 < a1[2][7])) - ((v1 + a0[9]) > (v0 > 76)));
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 6; i12 = i12 + 1) {
+        {
+            int i13 = 0;
+            do {
+                if ((36 % 1) > 84) break;
+                a0[2] = (((i12 / 9) <= (i12 <= v1)) % 8);
+                a1[0][6] = (((v1 > 48) && (i13 ? a0[9] : i13)) <= ((v1 < 27) != (i12 > a0[13])));
+                v1 = (((6 && v2) ? (v3 >= v1) : (a0[3] % 4)) && ((v0 + 46) % 5));
+                i13 = i13 + 1;
+            } while (i13 < 6);
+        }
+        v3 = (((v3 < v1) && (i12 - 36)) ? ((v2 > i12) * (97 > 90)) : ((7 || a0[2]) / 3));
+        v3 = (((v0 == 68) + (27 && i12)) >= ((v0 % 5) ? (v1 - v1) : (v2 * v1)));
+    }
+    return (((65 >= v2) < (a0[0] * 79)) % 5);
+}
+int f2() {
+    int v0 = 18;
+    int v1 = 51;
+    int v2 = 44;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v0 = (((97 * v1) < (57 >= a1[2][4])) * ((90 / 5) <= (v2 != 47)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v0 = (((73 <= a1[0][1]) >= (i0 && a1[0][11])) % 5);
+                v3 = (((a1[0][11] ? v1 : i0) * (i0 >= v1)) % 5);
+                v1 = (((a1[2][5] == v1) - (i1 != a0[5])) ? ((34 ? 30 : i0) > (v2 * v2)) : ((a0[13] > a1[1][7]) != (a1[1][0] == v1)));
+            }
+            v0 = (((28 == 41) ? (34 / 2) : (a0[13] ? v3 : v2)) || ((2 == v2) > (a1[1][2] || v2)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            a1[1][13] = (((v3 || a0[9]) == (v3 * a0[14])) && ((v1 * a0[6]) + (v3 != a1[1][12])));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v0 = (((i3 > a1[1][1]) / 8) || ((47 && v0) >= (43 && a1[1][4])));
+                    a0[5] = (((11 * 28) - (21 / 1)) ? ((i3 / 3) + (v1 * 27)) : ((a1[2][4] + 79) <= (i3 % 7)));
+                    v1 = (((v1 % 1) * (67 ? 21 : v3)) > ((28 / 4) < (v0 != v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[1][5] = (((a0[11] - v3) > (a1[1][11] / 6)) ? ((a1[2][13] == a0[6]) != (a1[0][12] >= v3)) : ((v0 >= i2) - (a0[2] <= 90)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((i4 + v2) > 94) break;
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                v1 = (((72 % 4) <= (v3 ? i4 : i5)) || ((90 || v0) <= (v1 >= a0[13])));
+                v3 = (((10 - i4) > (a1[3][14] + v2)) != ((a1[3][7] / 2) ? (94 != i4) : (i5 == a1[0][8])));
+                v2 = (((78 + v1) + (i5 <= a0[10])) != ((v1 || 27) >= (a0[12] == a1[3][0])));
+            }
+            v1 = (((a1[2][11] / 7) && (78 || a0[15])) && ((v1 && v3) % 6));
+            a0[7] = (((a0[3] - a1[2][12]) != (59 / 3)) / 5);
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        v2 = (((v0 ? v3 : a0[14]) < (a1[1][7] || v1)) && ((a0[12] && 47) * (v2 ? a0[13] : v3)));
+        v3 = (((v2 ? 28 : a1[0][8]) - (v1 < i6)) ? ((41 % 9) || (93 < v0)) : ((v3 / 5) / 3));
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            if ((v0 ? v3 : i7) > 99) break;
+            v0 = (((i7 ? a0[3] : v1) ? (i6 ? v1 : 47) : (v0 > 78)) != ((i7 - a1[2][0]) % 4));
+            v1 = (((a1[0][1] == v0) == (v3 + i7)) == ((i6 <= 21) != (v0 + i7)));
+            a0[14] = (((v3 - a0[15]) ? (63 < a0[7]) : (v3 % 7)) + ((a1[2][11] / 2) / 4));
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((v2 ? 72 : v0) || (i9 || a0[7])) < ((v3 % 3) && (a1[3][0] > v3)));
+                    a0[11] = (((v1 + v0) / 4) + ((v1 % 9) * (a1[1][13] && 34)));
+                    a1[1][10] = (((47 + a1[1][8]) * (v0 == v1)) < ((v2 ? a1[0][9] : 12) / 8));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            v2 = (((v1 < a1[1][5]) % 6) - ((v1 - a1[3][0]) ? (91 != a0[6]) : (i8 / 1)));
+            v2 = (((v2 ? v3 : v2) != (v1 - 85)) > ((a0[7] * 64) == (v0 == 2)));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    if ((((86 % 8) ? (v0 && v2) : (v2 > v2)) - ((v3 ? v3 : v1) <= (a1[2][15] % 6)))) {
+        a1[3][8] = (((v3 > 61) ? (v3 + a1[3][12]) : (v2 == a0[6])) + ((29 > a0[7]) / 6));
+        v0 = (((v2 && v3) > (68 != v0)) == ((v2 != v1) > (a1[1][8] == v0)));
+        v2 = (((a0[1] >= v3) * (a0[2] && v3)) - ((v2 ? a1[3][9] : a1[3][15]) ? (69 != v2) : (v1 % 7)));
+    } else {
+        v2 = (((80 <= v3) % 3) != ((0 > v3) + (v2 <= 8)));
+        v3 = (((23 - 27) ? (v1 >= v2) : (v2 != v1)) >= ((v3 < v3) / 2));
+        v1 = (((v2 == 99) + (v0 == a1[2][7])) * ((a1[2][8] < a1[0][5]) > (a1[0][10] == 8)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            {
+                int i11 = 0;
+                while (i11 < 3) {
+                    a1[2][9] = (((v3 >= a1[1][1]) == (i10 <= 18)) < ((v0 == 71) >= (46 / 5)));
+                    v2 = (((i11 ? i11 : i11) ? (90 > v0) : (v0 > a1[1][14])) - ((v3 * i10) >= (v3 / 5)));
+                    v3 = (((v0 && i10) == (2 > i10)) / 1);
+                    i11 = i11 + 1;
+                }
+            }
+            v2 = (((v3 != 81) && (80 - 40)) > ((0 ? v1 : a1[0][10]) <= (v1 + a0[7])));
+            v1 = (((i10 ? v3 : 44) == (a1[2][3] - v3)) ? ((5 ? a0[12] : i10) / 9) : ((v2 / 5) % 8));
+            i10 = i10 + 1;
+        }
+    }
+    v2 = (((13 || 95) == (v1 > 7)) < ((a0[1] + a1[1][6]) >= (v2 || v3)));
+    a1[2][3] = (((v3 < v1) * (32 % 3)) <= ((a1[3][0] / 5) + (a0[8] + v0)));
+    if ((((98 ? a0[12] : a0[7]) || (v1 % 5)) || ((v1 == v0) ? (2 * v3) : (a1[1][0] <= 33)))) {
+        v3 = (((a0[7] * v2) % 8) % 4);
+        v2 = (((v1 && 95) < (36 > a1[1][14])) + ((a0[13] ? v2 : v0) ? (v1 ? v1 : v0) : (v1 + 66)));
+        v2 = (((v1 % 4) == (v2 == v3)) - ((a1[0][14] * 8) / 2));
+    } else {
+        v3 = (((v0 && v3) == (63 == v2)) <= ((v2 ? v2 : 58) ? (v1 ? v1 : v1) : (v0 > v2)));
+        v3 = (((v1 || v1) && (a1[2][6] ? v0 : v1)) * ((76 != v3) || (v2 == 78)));
+        v0 = (((v3 >= v1) != (2 <= v2)) + ((v2 / 4) >= (v1 ? v0 : v2)));
+    }
+    return (((a1[1][14] <= v3) - (a0[3] && a0[3])) - ((12 && a0[15]) && (v3 ? a1[3][13] : v3)));
+}
+int f3() {
+    int v0 = 15;
+    int v1 = 86;
+    int v2 = 2;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 && 2) ? (59 ? 92 : v2) : (v2 != a0[11])) + ((v2 ? v3 : v3) ? (v1 >= v1) : (a1[1][9] ? v2 : a0[12])))) {
+        v1 = (((v0 + v1) - (36 != v0)) % 8);
+        v2 = (((34 > 22) >= (a1[1][12] >= 9)) && ((v0 || v1) > (v1 > a0[7])));
+        v3 = (((v3 || v0) % 3) % 8);
+    } else {
+        a0[2] = (((v3 > 1) >= (21 * a1[0][10])) != ((a1[1][4] / 3) <= (v2 + a1[3][6])));
+        a0[13] = (((18 / 4) % 6) + ((25 / 3) <= (v2 - a1[2][8])));
+        a1[1][3] = (((v3 ? 41 : 49) - (a0[7] || v1)) % 2);
+    }
+    v2 = (((a1[3][13] % 7) <= (13 != a0[5])) == ((v0 % 8) * (v0 || v1)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[13] == a1[3][4]) + (a0[15] >= 89)) / 4);
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v2 = (((a1[1][7] && a1[2][5]) - (v3 ? v1 : a1[3][14])) < ((i1 - 13) && (i1 ? v0 : a1[0][4])));
+                v1 = (((6 - i1) != (v0 >= a1[1][0])) * ((a1[2][15] || v3) + (55 >= v3)));
+                v0 = (((a1[2][4] && i1) + (74 != v1)) == ((23 ? v1 : a1[0][5]) != (v0 < i1)));
+            }
+            v3 = (((15 <= 82) / 1) || ((a1[2][8] >= v2) > (a1[0][4] < 41)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    v3 = (((a0[7] < 96) + (v2 / 4)) <= ((v2 / 2) / 8));
+    a0[15] = (((a0[7] - v0) == (v0 % 9)) % 9);
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((v1 - a1[1][11]) > 81) break;
+            a0[15] = (((i2 % 9) != (i2 == 67)) >= ((v2 ? a0[9] : i2) != (v3 ? 84 : v1)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    if ((i3 >= v2) > 53) break;
+                    v3 = (((65 >= a0[11]) ? (a0[1] % 9) : (a0[4] * i2)) == ((a0[9] > v1) / 2));
+                    v0 = (((a1[1][2] != a1[1][5]) * (v3 == a1[2][14])) > ((i2 != v2) * (a1[2][0] ? v2 : v2)));
+                    v0 = (((v2 + 15) || (v0 + i2)) || ((v2 > v1) * (v0 ? v1 : v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[5] = (((a1[3][2] >= v3) ? (a0[3] != i2) : (a1[1][14] >= v0)) ? ((v1 > v3) || (v3 >= v1)) : ((v3 && a1[2][12]) % 4));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v1 = (((a0[2] % 2) % 6) <= ((a0[0] <= v3) && (a0[15] == i4)));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            a0[7] = (((v2 && a1[0][8]) > (v3 % 2)) >= ((v1 || a0[6]) % 5));
+            v1 = (((3 != v0) != (96 && i4)) > ((a0[3] && 55) + (v1 >= 15)));
+            v2 = (((i5 > a1[3][0]) > (i5 != v2)) % 8);
+        }
+        a0[7] = (((a0[2] <= a1[1][3]) != (57 == a0[5])) ? ((a1[2][6] && i4) * (31 || a0[15])) : ((v1 && v3) >= (17 || v1)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v0 = (((i6 + 88) / 8) <= ((v1 % 1) / 6));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    a1[3][6] = (((i7 ? v1 : v3) / 2) * ((v0 || 63) - (a0[2] / 9)));
+                    v1 = (((48 ? a1[2][7] : v2) <= (27 - i6)) && ((11 ? a1[1][11] : 1) % 7));
+                    a0[11] = (((98 != v2) < (i6 < 28)) <= ((v1 ? a0[5] : a0[12]) ? (v2 < a1[3][11]) : (v1 < v0)));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((37 || v3) * (a0[5] / 5)) == ((a0[3] >= v3) <= (i6 ? i6 : a1[1][1])));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[2][15] = (((v1 ? i8 : v1) / 4) > ((i8 && v3) / 6));
+            {
+                int i9 = 0;
+                do {
+                    if ((26 >= a1[0][14]) > 84) break;
+                    v0 = (((a1[0][13] % 9) % 4) && ((48 && v3) != (v1 <= 9)));
+                    v2 = (((v0 == i8) && (a1[3][0] % 8)) / 4);
+                    v1 = (((a0[2] / 4) && (42 % 3)) % 7);
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            a1[0][11] = (((i8 != v0) < (v0 || i8)) <= ((v3 - v1) || (52 >= v0)));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    {
+        int i10 = 0;
+        do {
+            v2 = (((v3 <= i10) == (34 * a0[8])) != ((54 - a0[13]) * (v0 * a1[2][14])));
+            a1[0][14] = (((a1[1][5] / 5) >= (v2 / 6)) > ((v3 && a1[0][13]) != (13 ? a0[6] : v1)));
+            for (int i11 = 0; i11 < 8; i11 = i11 + 1) {
+                v3 = (((v2 && i11) != (a0[0] < v3)) - ((v0 + i10) == (v3 ? a1[0][1] : 90)));
+                v2 = (((12 <= v2) ? (76 + v3) : (v3 && i11)) || ((v3 > i11) % 3));
+                a0[6] = (((98 % 9) <= (a0[7] && v0)) / 7);
+            }
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    return (((79 / 8) >= (a1[0][5] / 9)) - ((v0 + a1[2][6]) < (a0[3] >= v0)));
+}
+int f4() {
+    int v0 = 36;
+    int v1 = 3;
+    int v2 = 32;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 != 7) || (v1 % 2)) <= ((a1[2][12] - v1) * (17 % 7)))) {
+        v1 = (((11 + 28) < (v2 - v3)) % 5);
+        v0 = (((v2 ? a0[14] : v1) + (25 / 7)) - ((a1[2][5] ? 81 : v0) * (3 * v2)));
+        v3 = (((a0[1] || a1[1][14]) < (a0[13] * a0[8])) && ((v1 / 4) < (9 >= v1)));
+    } else {
+        v0 = (((v3 != a1[2][15]) < (a1[1][10] != 39)) > ((v2 != 14) < (v3 == a0[12])));
+        v3 = (((5 && v0) / 5) >= ((v1 > 41) || (24 * v0)));
+        v2 = (((v1 % 7) >= (a0[13] + 73)) != ((47 + v0) * (a0[14] - 52)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((21 <= v3) > 60) break;
+        v0 = (((i0 >= v3) / 6) <= ((a1[2][3] - v0) ? (a1[2][2] ? v1 : v3) : (v3 / 7)));
+        v3 = (((89 ? a1[2][2] : v3) == (v0 ? a1[3][10] : 0)) == ((v2 / 2) <= (a0[5] / 3)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                v2 = (((v2 + a1[2][0]) < (i0 || v3)) ? ((v3 + v0) == (i0 ? 4 : v0)) : ((a1[3][11] > v3) < (a0[9] >= v2)));
+                v3 = (((v1 - i1) % 1) == ((a1[2][9] - v2) - (i1 > 36)));
+                v0 = (((v0 - 59) > (v3 ? 95 : v1)) < ((v2 ? 59 : 82) / 4));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((i2 < 40) / 1) && ((i3 ? a1[2][13] : 85) % 5));
+                    v1 = (((v1 != v0) ? (85 ? 28 : 13) : (i2 && i3)) + ((a0[5] ? a0[2] : i2) + (v2 ? v2 : 24)));
+                    v1 = (((i3 % 8) >= (a1[1][0] < a1[0][10])) == ((v3 * v2) / 2));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            v3 = (((a0[7] == v0) != (v1 >= v0)) && ((15 > v0) + (v2 != a0[5])));
+            v2 = (((54 > 60) - (98 == 41)) / 7);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((90 < a0[1]) > 81) break;
+        v2 = (((v2 >= v2) && (v0 >= v1)) - ((v3 != i4) && (i4 != v3)));
+        v3 = (((91 * v0) || (v3 || i4)) / 2);
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v1 = (((v3 ? v2 : a1[1][9]) || (v0 > 17)) % 8);
+                v3 = (((v0 ? v3 : v3) % 9) ? ((v2 >= i5) != (i4 ? a1[0][9] : v0)) : ((a0[11] > a0[5]) || (v0 * 66)));
+                v1 = (((a1[3][13] * a0[8]) + (i5 < a0[15])) - ((93 != a1[0][0]) * (i5 <= a0[14])));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            {
+                int i7 = 0;
+                do {
+                    a0[13] = (((96 < 90) && (v3 % 5)) + ((a0[6] && a0[6]) && (v0 != 43)));
+                    a1[2][11] = (((a1[1][10] % 9) != (63 ? 71 : v2)) + ((92 && 63) * (57 <= v0)));
+                    a1[0][12] = (((18 - v1) == (85 != v3)) == ((a1[3][2] / 6) ? (a1[1][14] * v2) : (a1[1][14] / 7)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            v2 = (((v1 < 14) >= (49 % 7)) ? ((a1[2][6] == v1) ? (i6 <= v0) : (v0 + i6)) : ((v1 != 38) || (v0 ? a1[2][15] : v1)));
+            v1 = (((v1 + v3) < (v0 > v0)) <= ((7 || 72) >= (v1 / 3)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                v3 = (((a0[5] > a0[1]) && (46 - v2)) != ((i9 % 3) && (23 / 7)));
+                v1 = (((55 * a1[1][0]) >= (a0[4] + v1)) ? ((a0[9] * v1) - (v2 % 7)) : ((a0[2] >= v2) - (a1[0][8] > 17)));
+                a0[8] = (((v0 ? v2 : v2) < (v1 > a0[1])) == ((i8 > 1) % 4));
+                i9 = i9 + 1;
+            } while (i9 < 8);
+        }
+        v0 = (((29 >= i8) >= (a1[3][9] < 21)) % 5);
+        v3 = (((i8 / 1) - (v3 - v1)) - ((84 && a1[2][9]) / 5));
+    }
+    {
+        int i10 = 0;
+        do {
+            a0[4] = (((97 == v3) * (v2 && a1[0][6])) / 2);
+            a1[1][10] = (((a1[2][9] % 9) <= (v3 % 7)) && ((v3 - a1[2][9]) + (v2 / 4)));
+            for (int i11 = 0; i11 < 2; i11 = i11 + 1) {
+                a1[2][6] = (((v2 >= v2) || (v2 ? a0[0] : v0)) ? ((v3 == a0[6]) >= (v0 && a0[2])) : ((a0[14] + a1[0][5]) != (a1[3][7] >= a0[10])));
+                v1 = (((a1[0][5] * 86) ? (v3 ? v1 : v1) : (a1[1][2] ? i10 : v0)) % 1);
+                v3 = (((v1 >= v0) <= (v2 ? i10 : a1[2][0])) <= ((v0 ? i10 : i11) - (i10 <= i11)));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    {
+        int i12 = 0;
+        do {
+            for (int i13 = 0; i13 < 8; i13 = i13 + 1) {
+                a1[2][5] = (((a0[2] == v3) * (a0[11] == v2)) < ((i13 / 8) >= (v1 >= i12)));
+                v1 = (((v2 && a1[2][15]) > (a1[2][14] / 5)) % 3);
+                v0 = (((v3 * a0[6]) > (a0[14] && i12)) / 9);
+            }
+            v3 = (((6 > a1[3][2]) ? (11 ? v2 : i12) : (v1 - a1[3][12])) % 9);
+            v2 = (((v3 * v3) <= (i12 + a1[1][10])) < ((v2 || 84) < (v0 * v3)));
+            i12 = i12 + 1;
+        } while (i12 < 8);
+    }
+    if ((((v1 * a0[15]) != (v2 <= a1[2][6])) * ((78 != v0) <= (v1 / 8)))) {
+        v0 = (((a1[3][13] ? v0 : v0) - (v3 / 8)) || ((a1[1][2] != v2) <= (v0 == a1[0][6])));
+        v1 = (((98 * 47) || (4 >= v3)) == ((v2 == a1[2][12]) / 1));
+        v1 = (((v2 != v2) >= (v0 / 3)) ? ((a0[1] && v3) ? (v1 >= 8) : (v0 && a1[2][2])) : ((v1 < v3) || (v2 ? v3 : 70)));
+    } else {
+        v3 = (((7 == v3) ? (v3 / 3) : (80 <= a1[3][5])) >= ((v2 + v3) ? (v1 == a1[2][6]) : (a1[2][11] + v1)));
+        v0 = (((78 && v3) == (a0[3] % 8)) && ((v2 <= 21) > (a1[1][0] < a1[1][1])));
+        v0 = (((a1[2][12] <= v1) * (v0 && 47)) * ((73 && v2) || (76 ? v2 : v2)));
+    }
+    v3 = (((v0 == a1[3][12]) / 3) && ((v3 || v2) - (v0 >= 32)));
+    return (((v3 != 16) >= (v3 >= v3)) >= ((v2 > a1[1][6]) * (v1 && a0[6])));
+}
+int f5() {
+    int v0 = 32;
+    int v1 = 50;
+    int v2 = 97;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((79 && v2) ? (v0 > i0) : (27 >= v0)) && ((v1 >= 36) + (i0 + v2)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((a0[12] - a0[4]) > 91) break;
+                v1 = (((14 - a1[1][13]) ? (a0[3] + a0[4]) : (a0[8] <= a1[0][3])) / 3);
+                v0 = (((v1 == a0[7]) && (a0[14] || a1[2][0])) / 9);
+                a0[0] = (((41 == v2) != (a1[0][6] * v2)) > ((i1 - v0) > (a0[14] && v0)));
+            }
+            v3 = (((v0 - v0) >= (i0 && v2)) == ((i0 / 4) ? (a1[2][9] + v1) : (a1[1][11] + v2)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((30 % 2) != (a0[7] + v3)) ? ((10 > a1[3][15]) + (a0[8] <= a0[8])) : ((a0[15] != v3) && (v3 >= 53)))) {
+        v3 = (((v1 < v3) >= (v1 % 4)) == ((v1 * a0[5]) != (v0 ? v0 : v0)));
+        a0[8] = (((v1 + v0) * (6 ? v2 : a1[2][15])) > ((3 && v0) || (a0[2] / 2)));
+        v2 = (((a0[7] == v1) <= (v3 != v0)) && ((v0 > v2) <= (a1[0][14] != v1)));
+    } else {
+        v0 = (((48 >= v1) != (24 <= v0)) ? ((v2 % 7) || (v0 ? 3 : a1[1][0])) : ((a0[1] ? v3 : 93) || (v2 ? v2 : v0)));
+        a1[2][4] = (((27 / 7) || (72 > v3)) + ((79 != 61) - (v3 * 12)));
+        a0[8] = (((32 != 42) * (v3 > a1[3][8])) ? ((v2 % 2) - (a0[1] + 62)) : ((a1[0][2] ? v3 : 42) || (v3 - 4)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v0 = (((64 != a1[2][14]) != (v0 <= 71)) || ((i2 % 3) > (a1[2][14] >= a0[15])));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v2 = (((v3 % 3) == (22 ? 70 : 89)) && ((i2 * i2) != (a1[0][12] > a0[2])));
+                v0 = (((68 * i2) ? (13 / 6) : (42 > a0[0])) / 3);
+                a1[3][9] = (((i3 - v3) / 1) - ((a0[9] == i3) + (17 * 49)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((11 <= v1) && (38 || 27)) / 5);
+    }
+    v0 = (((15 && v3) < (a0[9] / 3)) != ((v0 / 5) <= (v3 != a1[0][2])));
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v1 = (((v0 == i4) <= (7 / 3)) * ((i4 >= a1[2][6]) != (v3 != i4)));
+        a1[2][3] = (((a1[0][11] ? 82 : v3) <= (i4 != 52)) || ((v3 % 8) <= (v0 && v2)));
+        {
+            int i5 = 0;
+            do {
+                if ((a0[5] == v0) > 67) break;
+                v0 = (((92 % 4) / 2) ? ((a0[1] % 3) < (i5 ? a1[3][6] : v0)) : ((v1 % 9) && (v1 ? a1[3][6] : 77)));
+                a1[2][7] = (((i4 / 4) - (a0[1] <= v2)) >= ((v2 >= v2) ? (a1[1][10] ? a0[6] : 92) : (61 * i4)));
+                v3 = (((v2 % 5) ? (a1[2][3] || v2) : (v1 - a0[1])) * ((v0 ? v2 : v1) || (i5 || 57)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+    }
+    if ((((v3 * v1) * (v3 / 4)) > ((a1[2][13] != v3) > (v1 % 6)))) {
+        v0 = (((a1[2][9] != a1[2][9]) > (v3 - a1[2][12])) < ((v2 == 35) * (a1[1][13] && a0[1])));
+        v2 = (((a1[2][1] >= a1[2][1]) % 5) ? ((a0[14] != 77) / 3) : ((26 < v0) < (1 ? a1[2][9] : v0)));
+        v2 = (((v2 ? v0 : v3) - (v0 > 53)) > ((45 - v0) < (44 < v3)));
+    } else {
+        a1[3][2] = (((v3 && a1[1][8]) - (v1 >= v3)) == ((v2 / 1) <= (a1[1][2] == v1)));
+        a0[12] = (((v1 < v3) >= (58 * v0)) || ((v3 < v3) == (v2 + a1[2][6])));
+        v2 = (((v0 / 4) < (a0[9] <= 98)) % 4);
+    }
+    v3 = (((v0 ? a0[12] : a0[4]) >= (48 + 98)) + ((v3 * a1[0][15]) && (78 != v1)));
+    {
+        int i6 = 0;
+        do {
+            a0[3] = (((90 * 42) % 6) + ((49 < a1[1][7]) != (a0[14] ? v2 : 84)));
+            v2 = (((52 > v1) + (a1[3][15] == a0[12])) == ((26 % 6) - (i6 && i6)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v2 = (((v1 != a0[12]) <= (v1 * i7)) ? ((v1 - a0[1]) && (a0[14] ? v0 : v1)) : ((v2 && v2) && (v0 + 83)));
+                    v1 = (((83 != i7) % 4) ? ((a0[5] >= i6) && (a0[6] == i7)) : ((54 >= a1[2][4]) && (a1[0][9] < 16)));
+                    v3 = (((1 < i6) - (95 ? i7 : a0[11])) + ((56 != 27) ? (62 % 4) : (i7 >= 10)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[14] = (((v0 == v0) < (a0[12] - v0)) >= ((v2 / 8) || (0 % 9)));
+            v0 = (((a1[2][2] <= v2) == (a1[2][1] / 7)) ? ((v1 - 17) - (46 || v2)) : ((v2 ? v0 : i8) - (a1[0][8] < v0)));
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                a0[12] = (((v1 ? a1[0][5] : 47) % 3) || ((v1 == a0[4]) >= (0 ? i9 : a0[3])));
+                a0[8] = (((i9 <= v3) / 4) >= ((v3 < 88) <= (12 + v2)));
+                v1 = (((i8 <= 71) || (i8 || 92)) * ((a1[0][4] - i8) ? (16 % 2) : (v3 && i8)));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    a1[2][14] = (((v1 * 15) * (94 < a0[5])) && ((95 > v3) == (a1[1][9] >= 62)));
+    return (((v0 || v0) || (a1[0][4] ? a0[1] : v1)) >= ((v2 >= a0[0]) - (v1 && 3)));
+}
+int f6() {
+    int v0 = 79;
+    int v1 = 67;
+    int v2 = 61;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    a0[15] = (((a0[4] - v0) <= (a1[3][11] == v3)) == ((a1[1][6] * v3) && (6 == a0[3])));
+    a1[2][4] = (((v1 + v1) && (v3 ? v3 : v1)) < ((8 * v1) / 1));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 > 86) >= (29 * 44)) / 7);
+            v0 = (((28 && 72) / 5) <= ((a1[0][7] - v0) >= (70 != i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v3 ? 46 : 25) > 86) break;
+                    v3 = (((v3 + v3) / 7) != ((24 / 7) ? (i1 ? v1 : a1[0][1]) : (10 - 2)));
+                    v0 = (((v0 && i0) - (35 >= v1)) ? ((a0[13] < 55) == (73 >= a0[10])) : ((v1 + i1) || (a1[1][14] - v2)));
+                    v3 = (((v1 && i1) >= (v3 != a0[15])) < ((v3 / 9) % 6));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a0[5] >= a0[4]) < (v1 ? 84 : i2)) < ((43 != v2) != (a1[1][7] != v3)));
+            v1 = (((v0 && 66) || (v1 * v2)) * ((a0[6] % 3) <= (a1[2][5] || 64)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((v3 / 5) > 83) break;
+                v1 = (((a1[3][11] <= v3) > (v1 * i3)) < ((a0[7] >= v1) - (i2 && a1[3][4])));
+                v0 = (((a0[5] / 4) ? (i3 != 67) : (v1 * v1)) < ((i2 >= v1) / 6));
+                a0[1] = (((v1 >= v3) % 2) == ((a0[11] ? a0[5] : 81) < (i2 ? v3 : a1[1][9])));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v0 = (((a0[2] >= v3) >= (v0 > a1[0][12])) + ((v2 < a1[2][13]) == (48 == v1)));
+    {
+        int i4 = 0;
+        do {
+            if ((v3 != 27) > 86) break;
+            v2 = (((a1[1][15] != a1[2][8]) && (v0 < 34)) - ((12 >= v2) == (92 >= v1)));
+            v0 = (((69 - 29) * (v2 == a0[9])) > ((a1[3][14] * 5) && (19 + i4)));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v2 = (((76 * v2) && (a0[0] || a0[12])) >= ((v3 == 17) != (v3 <= 34)));
+                    v3 = (((v2 < v3) <= (v2 + v0)) >= ((a1[1][8] ? i5 : 10) <= (a1[1][0] && 18)));
+                    a1[3][7] = (((v1 ? 1 : v3) >= (i4 > a1[3][1])) != ((v2 ? 31 : i5) != (a1[0][11] && a1[0][8])));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        a1[2][6] = (((77 <= a0[10]) || (7 ? 96 : v2)) * ((48 < a1[2][10]) % 5));
+        a0[15] = (((a1[0][4] + 0) % 4) == ((a1[3][5] >= v0) <= (a1[1][5] + v1)));
+        {
+            int i7 = 0;
+            do {
+                if ((a0[4] > v0) > 71) break;
+                a1[3][5] = (((79 / 9) >= (a1[2][7] * a0[4])) < ((i7 - v3) || (a1[3][15] && v1)));
+                v3 = (((a0[6] || 20) * (v3 % 6)) == ((v1 == a1[1][3]) > (a0[6] + a0[1])));
+                a1[2][11] = (((a1[0][13] >= a0[14]) - (62 % 8)) >= ((v0 - 42) >= (v2 != i6)));
+                i7 = i7 + 1;
+            } while (i7 < 4);
+        }
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        v0 = (((56 / 4) ? (v0 != v3) : (84 != a1[0][11])) || ((v0 < a1[1][9]) > (i8 || 42)));
+        a1[3][9] = (((a0[12] == i8) % 8) || ((a0[6] < v0) / 5));
+        for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+            a1[0][0] = (((v3 > a0[12]) / 5) ? ((a1[3][9] + 63) >= (v1 || a0[2])) : ((a0[8] && i8) == (v2 * a0[5])));
+            v2 = (((58 <= v2) < (a1[2][10] || v2)) == ((i9 * 64) - (v1 * v1)));
+            v1 = (((a1[1][9] > a1[3][8]) != (v0 * v2)) && ((i8 - a0[5]) || (v3 != 41)));
+        }
+    }
+    {
+        int i10 = 0;
+        do {
+            v2 = (((83 <= 15) < (v3 && a0[13])) > ((v2 < v2) + (70 % 8)));
+            {
+                int i11 = 0;
+                do {
+                    if ((a1[3][15] >= i10) > 66) break;
+                    v1 = (((a0[9] == 20) < (v3 - a0[12])) && ((a1[2][7] < 40) * (i10 && a1[3][6])));
+                    v3 = (((v0 + i11) && (v1 || 2)) == ((32 == i10) >= (a0[1] != a1[0][10])));
+                    a1[1][9] = (((v0 * a1[0][10]) ? (95 >= v1) : (3 > 30)) < ((v1 / 7) != (i10 / 6)));
+                    i11 = i11 + 1;
+                } while (i11 < 3);
+            }
+            a0[10] = (((v3 <= a0[7]) < (v3 <= a0[0])) - ((v1 > 52) >= (64 - v3)));
+            i10 = i10 + 1;
+        } while (i10 < 6);
+    }
+    for (int i12 = 0; i12 < 3; i12 = i12 + 1) {
+        {
+            int i13 = 0;
+            while (i13 < 5) {
+                if ((i12 >= 97) > 70) break;
+                v2 = (((v3 ? a1[1][13] : i12) >= (i12 <= 34)) <= ((a1[0][15] == v1) && (36 >= i12)));
+                v2 = (((v0 <= v0) * (i13 / 5)) > ((20 % 9) ? (v0 > v0) : (v3 > 21)));
+                v3 = (((0 ? v1 : a1[2][14]) * (a0[10] ? i12 : v0)) ? ((83 < 23) < (i13 >= 58)) : ((v2 + v3) - (v1 || a0[12])));
+                i13 = i13 + 1;
+            }
+        }
+        v1 = (((a0[1] >= v3) && (v2 <= 89)) * ((a0[11] != v3) == (61 + v2)));
+        v0 = (((a0[5] + 48) + (a1[0][10] ? i12 : i12)) ? ((a1[0][3] != 99) % 3) : ((v2 >= a1[1][3]) / 7));
+    }
+    return (((v0 != a1[2][10]) + (v3 % 1)) || ((v1 - v2) ? (v0 <= a0[10]) : (v3 >= 82)));
+}
+int f7() {
+    int v0 = 20;
+    int v1 = 59;
+    int v2 = 85;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][1] == 99) <= (v2 * v3)) + ((v2 + v0) / 3))) {
+        v3 = (((a0[10] >= v1) > (v2 / 2)) / 9);
+        v0 = (((21 - a0[0]) > (v3 && a1[0][12])) ? ((13 != a1[0][4]) / 2) : ((86 > 84) == (v1 - v1)));
+        a1[2][2] = (((a0[5] ? a1[2][5] : 66) > (2 >= v3)) + ((v0 >= a0[9]) + (84 < v0)));
+    } else {
+        a1[0][15] = (((v1 ? 62 : 53) % 3) < ((v2 % 5) < (a1[0][11] >= a0[7])));
+        a0[14] = (((29 == 19) % 3) == ((89 == v2) > (v1 * v3)));
+        v2 = (((v1 ? v2 : 42) ? (18 < 23) : (56 * v2)) / 4);
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((i0 || 47) && (a0[15] == i0)) < ((v1 + 13) > (a1[3][9] != v1)));
+            v2 = (((v0 / 6) >= (a0[11] <= i0)) < ((90 <= v2) || (56 % 6)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v3 = (((a1[0][0] / 3) ? (65 == 59) : (a0[1] || v1)) / 9);
+                    v2 = (((a0[5] / 8) * (v0 + 30)) || ((a1[3][0] / 3) ? (i0 * a1[1][5]) : (i1 == v0)));
+                    a1[2][12] = (((v3 % 3) == (v3 % 6)) ? ((a0[14] == a1[0][14]) / 8) : ((a1[1][1] < v2) < (41 >= v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((i2 / 7) > 62) break;
+            v1 = (((a0[10] != 53) ? (i2 < 74) : (v2 % 7)) / 4);
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v0 = (((88 > v1) && (v1 ? i3 : a0[15])) ? ((v2 + a1[1][2]) < (42 || v0)) : ((a1[0][8] < 47) > (a0[2] < 67)));
+                v0 = (((v3 >= v3) < (v3 / 6)) != ((a0[8] % 7) * (21 ? v0 : v0)));
+                v2 = (((24 ? a0[8] : 4) || (83 == a1[1][5])) && ((a1[0][15] / 1) || (v2 ? a1[0][14] : a0[0])));
+            }
+            v3 = (((17 ? v0 : 61) / 1) % 7);
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v1 * 38) + (i4 <= 44)) * ((80 != i4) / 5));
+            v1 = (((v3 >= a1[0][10]) ? (25 - 50) : (a0[14] <= v3)) ? ((35 * a0[12]) >= (v1 != v0)) : ((v1 == v3) && (20 * a0[8])));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                a1[2][9] = (((v0 <= i4) + (53 ? i5 : a1[0][0])) + ((a1[3][8] == v1) < (13 + v2)));
+                v2 = (((80 >= v1) > (v1 < 64)) + ((v0 && 64) % 1));
+                v0 = (((15 / 2) < (27 < 12)) == ((i4 && a0[5]) < (a1[1][11] % 5)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    v3 = (((v0 && a0[13]) > (11 >= 78)) == ((15 / 1) >= (v2 && v2)));
+    v1 = (((v0 <= a1[0][7]) * (a0[4] / 6)) > ((a1[0][14] > a0[14]) <= (v1 / 8)));
+    if ((((v3 ? 62 : v1) == (v1 ? a0[14] : 90)) >= ((58 / 2) ? (v2 != v3) : (v1 && v3)))) {
+        v0 = (((23 == v0) ? (v2 ? v2 : a0[7]) : (v3 || v0)) < ((v3 ? v1 : a1[0][15]) != (v3 >= a0[9])));
+        v0 = (((a1[0][1] && v1) - (v3 ? v0 : v3)) / 6);
+        a0[0] = (((a0[7] * 31) - (63 * 33)) - ((v3 || v1) + (a1[3][0] * 0)));
+    } else {
+        a0[0] = (((a1[3][10] * v3) ? (v3 == a1[2][14]) : (v2 || 99)) < ((v2 <= 75) + (v1 ? v1 : 10)));
+        v1 = (((12 + v3) ? (a0[14] ? a1[2][5] : a0[11]) : (v1 % 2)) % 7);
+        a1[3][8] = (((a1[0][6] % 9) * (v0 != v2)) != ((v3 <= v3) == (34 && v1)));
+    }
+    if ((((15 ? a0[10] : v0) + (v1 && a1[0][11])) ? ((a1[1][4] == 77) - (v3 == v1)) : ((10 != v3) / 2))) {
+        a0[7] = (((v2 != v3) != (v1 * 84)) < ((v1 < a1[2][14]) && (v3 / 9)));
+        v3 = (((v3 / 9) <= (v1 - 39)) * ((v1 && v0) * (12 + v3)));
+        a1[0][12] = (((v0 < 83) - (a0[12] / 4)) != ((v2 == v3) == (v3 || 15)));
+    } else {
+        v2 = (((v2 - v2) + (v3 * v2)) * ((14 || v0) ? (63 >= 73) : (45 ? a0[0] : v2)));
+        v1 = (((42 / 6) && (v2 || v1)) ? ((v1 != a0[13]) <= (v0 || v3)) : ((v1 + 62) % 9));
+        a0[0] = (((6 - a0[12]) <= (v3 / 9)) || ((v1 && v0) + (v1 ? v2 : v3)));
+    }
+    a0[6] = (((a0[4] ? v3 : v2) ? (a0[4] <= v2) : (a1[2][9] ? 76 : 82)) || ((a0[8] ? a0[13] : a1[2][7]) >= (v1 <= 70)));
+    if ((((v1 >= a0[3]) / 1) + ((v0 < a0[9]) || (v3 >= 12)))) {
+        v2 = (((v2 <= a1[1][3]) != (v1 ? v0 : 44)) ? ((9 == v3) + (a0[9] - v3)) : ((v2 || a0[7]) > (37 || v3)));
+        v3 = (((a1[2][0] - v2) > (v2 && v1)) == ((43 + 8) > (v0 + v1)));
+        v0 = (((17 < 98) + (32 > v3)) % 1);
+    } else {
+        v2 = (((v3 > v1) + (a1[1][11] > v3)) && ((a0[15] + v3) + (a0[5] % 4)));
+        a0[5] = (((3 || v2) >= (16 < a1[2][9])) || ((78 >= v0) + (a0[10] / 2)));
+        v3 = (((v0 - v0) % 1) * ((94 % 4) <= (v1 == v1)));
+    }
+    return (((40 - a1[3][14]) <= (a1[1][13] >= v2)) > ((v0 % 5) || (54 || v3)));
+}
+int f8() {
+    int v0 = 37;
+    int v1 = 90;
+    int v2 = 89;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    if ((((68 + v1) && (v3 ? 36 : v1)) + ((v2 - a0[8]) - (42 ? 17 : v0)))) {
+        v0 = (((v1 - a1[3][13]) * (90 == 84)) >= ((77 + 65) < (v2 < v1)));
+        v2 = (((v3 || v0) > (v2 - v3)) != ((a0[0] % 2) <= (a0[10] - v0)));
+        v2 = (((v0 / 7) == (v1 || a1[2][8])) / 8);
+    } else {
+        v1 = (((v3 - v2) ? (v0 / 9) : (v0 % 7)) == ((v0 < 2) > (a1[3][3] % 7)));
+        a1[3][11] = (((v3 / 3) * (v2 <= v1)) - ((v1 && 13) ? (v2 - v0) : (v2 / 1)));
+        v3 = (((a0[7] != a1[2][14]) ? (a0[5] / 8) : (5 / 3)) && ((v3 + a1[3][4]) > (v3 ? 68 : v0)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a0[12] = (((77 < a0[9]) * (13 < a1[3][4])) + ((a0[9] == 48) > (v2 <= a1[3][0])));
+                    a0[11] = (((v3 - v1) > (62 ? v2 : a1[0][5])) == ((22 / 8) % 2));
+                    a0[13] = (((i0 / 7) != (i0 ? a1[1][14] : i0)) * ((i0 || a1[3][10]) <= (i0 + i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[0] = (((v0 < v1) + (v0 || v1)) || ((a0[11] * a1[2][8]) / 8));
+            v0 = (((v0 ? a1[2][7] : v0) > (a1[3][8] ? i0 : v1)) / 7);
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v1 = (((v1 < v0) < (i2 ? a1[3][0] : v1)) || ((v1 + a0[2]) / 4));
+            v1 = (((v0 / 8) || (v1 && v2)) ? ((i2 ? 80 : a1[0][10]) < (31 / 3)) : ((v2 ? v0 : 1) == (v1 + a1[1][10])));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                a0[15] = (((v0 >= a1[2][14]) || (i3 <= v3)) && ((a1[0][9] || a0[3]) + (i3 ? a0[11] : 0)));
+                a1[0][14] = (((37 >= i2) || (a1[3][8] / 2)) * ((i3 * v0) && (53 % 5)));
+                v1 = (((27 > i3) / 9) * ((v2 ? v0 : i2) < (v0 == a1[2][0])));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((v0 == v2) * (78 && a0[5])) > ((i4 == v0) % 4));
+        v2 = (((v1 ? v3 : i4) < (v2 == v0)) > ((a1[0][11] - v1) > (48 || a0[5])));
+        {
+            int i5 = 0;
+            do {
+                a1[3][9] = (((v0 < i4) < (a0[7] < 0)) != ((a0[15] < 98) + (v0 == a1[1][12])));
+                a0[6] = (((a1[3][10] + v0) >= (v3 + i4)) || ((94 < 67) && (v0 >= 2)));
+                a0[15] = (((a0[14] < v0) && (i4 < a1[3][15])) != ((i5 % 6) ? (v0 <= 73) : (v3 / 4)));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+    }
+    if ((((a1[0][3] != 31) <= (v1 < v3)) <= ((0 / 7) < (a0[9] - a0[5])))) {
+        v3 = (((75 + 64) ? (a0[5] % 2) : (v1 + a0[12])) && ((47 + v0) ? (v3 && a0[4]) : (42 < v0)));
+        v2 = (((a1[0][3] + v1) ? (87 <= v1) : (v3 + v0)) / 8);
+        a0[14] = (((13 ? v1 : v3) ? (55 != a0[6]) : (v3 || v3)) < ((v1 && 74) ? (v0 && 75) : (v1 && 77)));
+    } else {
+        a0[3] = (((v3 ? v3 : v2) > (a1[0][14] ? v2 : v1)) < ((a1[1][0] - a0[7]) % 8));
+        a1[3][13] = (((a1[3][14] ? v3 : 73) / 6) ? ((v0 ? a0[9] : a1[1][8]) % 5) : ((83 >= v3) < (69 * a0[8])));
+        v3 = (((v2 + v3) ? (99 > 40) : (v1 || v3)) > ((a0[9] > 12) != (v0 > v2)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        v0 = (((11 == v3) < (48 + 4)) || ((58 + v0) <= (v0 == v3)));
+        a0[9] = (((i6 >= 49) >= (v2 == 33)) + ((i6 >= i6) == (v2 ? v1 : v1)));
+        {
+            int i7 = 0;
+            while (i7 < 7) {
+                v1 = (((i7 < 80) >= (i7 == v1)) == ((94 != a0[14]) + (v3 && 15)));
+                a0[3] = (((51 <= a0[5]) + (a1[2][10] >= 32)) * ((46 < 96) || (87 >= v1)));
+                v3 = (((v0 < 56) * (v0 / 8)) % 7);
+                i7 = i7 + 1;
+            }
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 2) {
+                    v3 = (((i8 + i8) < (50 >= 14)) && ((a1[2][4] ? a0[2] : a0[9]) && (8 <= a0[3])));
+                    v1 = (((92 * v0) / 8) && ((49 ? v3 : i8) >= (v1 == a1[0][12])));
+                    a1[1][7] = (((90 % 9) >= (i9 ? 55 : a1[2][4])) + ((36 > v1) % 2));
+                    i9 = i9 + 1;
+                }
+            }
+            a1[2][8] = (((v2 != v0) || (v1 ? 70 : a1[0][4])) <= ((a1[3][4] >= v2) < (v2 / 6)));
+            a0[1] = (((89 <= v2) > (v3 <= 34)) ? ((a1[0][7] - v0) == (a1[0][5] <= 94)) : ((v2 <= a0[9]) >= (a0[7] >= 56)));
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    v3 = (((a0[1] < a0[10]) ? (v2 ? 57 : a1[0][1]) : (a0[2] || v0)) || ((18 ? v3 : v1) > (v3 / 9)));
+    if ((((37 > 84) ? (v3 || v3) : (v2 != v1)) >= ((v2 - 76) || (v0 * 20)))) {
+        v0 = (((11 >= 62) ? (v2 || a0[2]) : (v0 != 99)) + ((a0[14] && 38) + (98 && 14)));
+        v2 = (((v1 || 88) && (v3 || v1)) >= ((34 && 50) != (a1[3][15] <= v1)));
+        a1[1][14] = (((a1[2][7] && v1) && (a0[8] != 75)) || ((0 ? v2 : 18) >= (57 ? v3 : 66)));
+    } else {
+        v3 = (((27 >= v0) ? (v0 % 9) : (v3 > a1[2][6])) + ((v3 % 2) + (41 != 99)));
+        v0 = (((a0[8] ? v2 : v1) ? (v1 + 67) : (42 && v1)) != ((59 ? v3 : v2) - (v0 >= a0[6])));
+        a0[6] = (((24 - v1) + (a0[15] - a0[2])) >= ((46 / 3) || (v1 && a1[2][9])));
+    }
+    {
+        int i10 = 0;
+        do {
+            a0[6] = (((a1[1][9] && 23) * (v0 ? v2 : a0[15])) <= ((a1[1][5] <= a0[0]) * (a0[1] < i10)));
+            v3 = (((86 ? a1[0][6] : a0[7]) == (v1 * a0[5])) < ((i10 || a0[12]) != (89 || v2)));
+            {
+                int i11 = 0;
+                while (i11 < 4) {
+                    v1 = (((3 < a1[0][2]) == (i10 == 30)) + ((7 - a1[2][2]) || (v3 == v3)));
+                    v1 = (((a0[13] * a1[3][12]) + (a0[12] >= a1[2][2])) * ((a0[4] || a0[7]) - (i10 ? 40 : 74)));
+                    a0[8] = (((v1 ? a1[3][5] : a1[1][4]) * (a1[1][4] != i10)) % 2);
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    return (((77 && 99) != (61 % 1)) != ((19 != v1) * (v3 * 0)));
+}
+int f9() {
+    int v0 = 72;
+    int v1 = 82;
+    int v2 = 36;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 ? a0[14] : v2) * (57 <= v2)) <= ((93 < v3) || (v1 <= a0[1])))) {
+        a1[3][13] = (((a1[2][14] >= 76) * (v2 && v2)) && ((v0 > v3) == (70 > a1[0][2])));
+        v1 = (((a1[0][4] && v0) == (25 * 18)) ? ((10 + v3) % 6) : ((v3 <= v3) - (v3 / 1)));
+        v2 = (((v0 ? 65 : v3) + (v1 ? v3 : 26)) ? ((v2 && a1[2][11]) || (a0[4] != a0[6])) : ((22 / 4) <= (v1 / 1)));
+    } else {
+        v1 = (((66 - a1[0][12]) >= (a1[1][12] % 1)) % 5);
+        v3 = (((v1 < v3) + (v2 == v1)) <= ((v1 < a1[1][1]) <= (v3 * 81)));
+        v1 = (((v1 && v2) % 4) <= ((v2 <= a0[2]) < (54 || v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[9] = (((i0 - 24) != (v1 % 1)) * ((v1 == v3) <= (55 != a0[2])));
+            a0[8] = (((v1 && v0) - (v2 * v1)) == ((28 == a0[13]) > (v1 <= a0[0])));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((83 + a0[8]) / 8) * ((v2 == v2) <= (i1 <= a0[9])));
+                v0 = (((86 || a1[3][8]) < (a0[8] % 6)) == ((i0 != i1) > (v2 ? a0[4] : i0)));
+                v0 = (((v0 ? 64 : i1) - (a1[3][1] != i0)) - ((a1[3][10] ? i1 : 62) < (21 ? v2 : a0[6])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    a0[12] = (((a1[3][11] - a0[12]) != (62 >= 1)) <= ((62 && v1) >= (v0 && v1)));
+    v2 = (((35 || v2) % 5) || ((v1 == v0) && (a1[2][11] && 16)));
+    if ((((a0[1] >= v1) * (v2 < v2)) + ((v0 > a0[4]) <= (6 && 24)))) {
+        v2 = (((a1[3][9] || v1) <= (a1[2][8] || a1[2][9])) % 8);
+        a0[1] = (((v0 % 3) <= (v1 > v0)) < ((a0[11] == v3) - (4 + v0)));
+        v2 = (((v2 ? a1[3][15] : v0) <= (v0 - 96)) - ((v3 - v1) - (v0 + v3)));
+    } else {
+        v1 = (((a1[2][3] || 83) % 1) || ((a1[2][12] == v3) != (v1 + v3)));
+        a0[12] = (((a1[3][5] % 7) + (a1[3][14] != v1)) < ((v3 == a1[3][6]) ? (27 / 5) : (v2 ? a0[4] : 6)));
+        a0[13] = (((v0 / 2) / 8) ? ((33 && 38) ? (a0[13] + v0) : (v1 * 55)) : ((v1 % 4) < (v1 > v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v1 = (((a0[7] >= i3) && (v2 == a1[0][6])) * ((50 * i3) - (a0[14] < v1)));
+                    a0[5] = (((a1[0][3] == 90) % 2) + ((v0 - 66) / 2));
+                    v2 = (((i3 * a0[9]) - (43 < v3)) ? ((90 != v1) > (v0 == a0[3])) : ((52 / 2) == (i2 && 61)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a1[3][5] == v2) < (a0[14] >= i2)) / 9);
+            a1[2][8] = (((v2 % 5) > (74 * a0[13])) ? ((i2 + 17) == (23 || 80)) : ((i2 >= 66) < (v0 - v1)));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((a1[2][1] >= v3) ? (v3 && 92) : (v0 != v3)) + ((73 - v1) * (v0 >= 56)));
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v2 = (((a0[1] >= 16) ? (6 ? v0 : a1[1][11]) : (75 == a0[1])) + ((i4 || a1[0][7]) != (i4 || 38)));
+        v1 = (((72 % 9) ? (i4 ? 34 : v1) : (17 + v3)) == ((v2 + v3) || (a1[2][14] > a0[0])));
+        {
+            int i5 = 0;
+            do {
+                if ((i5 || a0[6]) > 52) break;
+                a1[3][3] = (((30 ? 13 : i5) <= (v1 / 1)) % 6);
+                a1[3][12] = (((v0 ? 89 : 60) ? (v3 / 2) : (v1 <= v0)) != ((v2 * i4) - (31 % 8)));
+                v1 = (((26 ? v2 : 84) - (6 - v0)) * ((24 == v2) || (a1[3][6] > i4)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((46 >= v1) > 75) break;
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v2 = (((i6 < a1[0][0]) == (a1[2][4] || a1[2][14])) % 4);
+                    v0 = (((a0[4] % 6) && (v1 % 3)) + ((39 - v1) <= (i6 - v2)));
+                    v1 = (((47 * a1[1][7]) == (v3 % 6)) == ((v1 > v3) && (v0 != v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((a0[15] ? 92 : i6) ? (94 + 83) : (a0[15] == 46)) > ((v2 - 47) * (i6 ? 95 : v2)));
+            a1[3][6] = (((87 > 30) * (v2 - 70)) == ((i6 || i6) ? (v1 - a0[15]) : (i6 ? i6 : a0[1])));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    v0 = (((v0 ? 61 : a1[0][12]) == (22 ? 15 : a1[1][5])) + ((v0 % 9) - (v1 >= a0[15])));
+    return (((v1 < v3) <= (42 == v2)) > ((v3 + a0[0]) - (v0 != 26)));
+}
+int f10() {
+    int v0 = 57;
+    int v1 = 42;
+    int v2 = 53;
+    int v3 = 42;
+    int a0[16];
+    int a1[4][16];
+    a1[3][3] = (((v1 % 6) >= (v2 < v0)) != ((a0[6] < 46) - (a1[2][2] && 20)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v3 = (((v0 && i0) == (v3 / 2)) <= ((a0[1] ? i1 : a0[3]) ? (v1 && 90) : (a0[4] < a0[2])));
+                a0[7] = (((i0 - v1) ? (v3 + a1[1][7]) : (a1[1][2] % 4)) - ((a0[1] && a1[2][5]) <= (52 >= i1)));
+                v3 = (((0 >= v0) + (v3 <= v3)) * ((v2 > i0) / 6));
+            }
+            v0 = (((v3 + a1[0][8]) * (v1 ? 6 : a0[11])) <= ((v2 * a1[2][9]) % 4));
+            v2 = (((v2 ? v0 : 2) / 4) ? ((v1 * a1[2][2]) - (27 % 8)) : ((69 && a1[1][6]) ? (v2 > v3) : (a1[0][2] == 53)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v0 = (((a0[12] / 6) > (11 < v1)) + ((v0 % 9) == (v3 != v1)));
+        a0[7] = (((v1 ? a1[3][11] : 47) == (a0[3] && v3)) > ((v2 - v2) || (25 ? v2 : 1)));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v2 = (((v1 == a1[3][1]) * (i3 && a1[0][13])) == ((i2 > a1[3][6]) % 7));
+            v1 = (((v1 + i2) || (a1[2][5] >= v0)) % 2);
+            v1 = (((v0 >= 26) < (a0[2] < v1)) ? ((44 / 4) <= (a1[0][0] <= 26)) : ((i3 % 5) ? (i2 + i3) : (i2 <= v2)));
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v1 = (((v0 == a1[1][3]) >= (a1[0][0] || v2)) && ((v0 - v0) * (v2 ? v3 : a1[3][8])));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v0 = (((v2 <= a0[12]) <= (v1 > 74)) ? ((a0[15] + v0) && (a1[0][13] + a0[0])) : ((v1 ? v3 : v0) > (54 % 5)));
+                    a1[3][6] = (((92 <= v1) / 2) / 2);
+                    a1[1][5] = (((a1[0][3] > 50) ? (i5 + a0[10]) : (v0 || a1[1][10])) && ((a0[13] ? v0 : v0) + (53 >= a0[8])));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((8 / 3) && (a1[3][4] % 5)) >= ((92 ? v2 : a1[0][15]) >= (v3 < a1[2][6])));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v1 = (((67 >= 27) > (28 ? i7 : v0)) && ((36 && 31) || (62 + i6)));
+                v2 = (((v1 > v1) || (14 / 4)) || ((i6 % 9) * (i7 == a1[1][0])));
+                v1 = (((v1 || 82) - (53 ? i6 : v0)) ? ((v3 / 2) < (v2 >= v0)) : ((87 == i6) > (i7 - v3)));
+            }
+            v0 = (((v1 || 39) <= (v0 || v2)) ? ((77 % 4) == (86 == 84)) : ((81 != v0) ? (a0[4] < v0) : (v1 % 1)));
+            v2 = (((90 ? v0 : 25) < (v2 * v2)) ? ((i6 / 6) < (i6 * a1[3][1])) : ((i6 * v1) != (v2 ? a0[12] : a1[3][9])));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((1 != 15) == (v3 <= v3)) >= ((v0 && 58) + (v3 && 79)));
+            {
+                int i9 = 0;
+                do {
+                    a1[1][6] = (((v0 >= v0) * (a1[2][9] ? v3 : 17)) || ((a1[3][1] <= 70) <= (a1[3][10] % 8)));
+                    a1[2][10] = (((a0[13] / 3) < (v2 <= a1[1][6])) ? ((i9 || a1[1][5]) >= (v0 != v1)) : ((68 ? v2 : 61) <= (a0[15] == a1[3][8])));
+                    a1[0][0] = (((29 || i8) ? (i9 ? 26 : v1) : (a0[6] / 4)) && ((20 % 9) / 7));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            v3 = (((i8 != a0[0]) >= (v0 / 6)) ? ((61 || i8) % 8) : ((a1[1][15] && 34) == (a1[1][9] * 44)));
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    v1 = (((a0[14] ? a0[12] : v0) / 8) || ((v3 - 94) ? (a0[0] || v3) : (a0[5] <= a0[8])));
+    v3 = (((v3 >= a1[3][10]) || (v1 - a1[0][7])) == ((v2 - v2) + (v0 == v2)));
+    if ((((68 <= v1) != (v0 ? a1[0][3] : v2)) ? ((v3 + a0[9]) + (29 ? a1[0][1] : v0)) : ((v2 >= v2) ? (v2 ? v2 : a0[6]) : (81 + v1)))) {
+        v1 = (((v3 == v1) ? (v3 * v0) : (v2 ? 30 : 66)) && ((75 || v1) && (51 || a0[8])));
+        v3 = (((69 && 21) < (a0[7] > a0[7])) ? ((a1[1][1] <= v0) / 1) : ((v2 || a1[0][11]) || (v3 ? a0[9] : a1[3][0])));
+        v3 = (((v0 ? v3 : v3) - (v3 && v0)) / 8);
+    } else {
+        v2 = (((a0[4] == 85) ? (v1 == v0) : (v0 / 2)) && ((v3 && v0) <= (v3 * v2)));
+        v2 = (((65 >= v0) == (a0[11] || v1)) + ((v2 ? v1 : v3) + (a0[5] % 2)));
+        a1[1][2] = (((25 ? v3 : a0[2]) <= (a1[0][2] > v1)) * ((v1 < v2) <= (v0 || 26)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            {
+                int i11 = 0;
+                while (i11 < 4) {
+                    a0[11] = (((7 <= i11) > (v2 / 9)) == ((v1 % 5) ? (19 == 75) : (a0[9] * a0[4])));
+                    a1[0][9] = (((v3 == a1[1][3]) < (77 ? a0[1] : v0)) % 5);
+                    v1 = (((i10 < 23) * (a1[3][6] + 5)) || ((30 && 63) ? (i10 && a1[0][15]) : (v3 > v3)));
+                    i11 = i11 + 1;
+                }
+            }
+            v2 = (((v1 / 2) * (v2 - v1)) ? ((v0 && 85) ? (i10 != a1[3][5]) : (i10 / 6)) : ((v1 * v3) && (84 <= 96)));
+            v0 = (((a0[5] / 2) % 6) + ((20 / 4) == (i10 ? i10 : v0)));
+            i10 = i10 + 1;
+        }
+    }
+    return (((v0 <= v0) || (a0[5] ? 54 : v3)) + ((v2 % 3) == (a0[10] < 47)));
+}
+int f11() {
+    int v0 = 62;
+    int v1 = 91;
+    int v2 = 86;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    a1[2][8] = (((v2 * 48) != (v1 % 6)) ? ((v0 > v3) - (v0 - a1[1][7])) : ((a0[10] ? 96 : 51) == (v3 / 7)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v3 = (((v1 >= a0[5]) && (a0[9] >= 24)) ? ((a0[13] / 5) * (a1[2][3] >= i0)) : ((i0 > v1) && (a0[7] > a0[6])));
+        {
+            int i1 = 0;
+            do {
+                a0[8] = (((v2 % 3) - (v0 - v0)) % 7);
+                v3 = (((a0[1] == a1[3][0]) == (a1[1][1] + v0)) ? ((v3 - a0[0]) % 6) : ((a1[2][3] / 5) < (v3 ? v3 : i1)));
+                v0 = (((57 ? v0 : 69) == (63 < v2)) / 2);
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v3 = (((a1[2][8] && i0) && (v1 || v2)) < ((47 <= 77) == (v2 ? v2 : v1)));
+    }
+    v1 = (((a0[9] ? v0 : v0) <= (12 && 55)) || ((v2 / 8) > (v0 < a1[2][12])));
+    if ((((87 < 79) || (v3 * v1)) >= ((40 - v2) / 6))) {
+        v2 = (((a0[3] ? v0 : v1) < (23 * 27)) > ((v1 < 56) > (v0 * v3)));
+        v1 = (((v2 + 53) ? (v3 <= v1) : (35 % 4)) ? ((a0[1] / 5) && (v0 ? v2 : v0)) : ((v0 / 1) * (v0 ? 60 : 9)));
+        v2 = (((58 ? a1[1][1] : v1) <= (40 == v3)) + ((v2 && v1) - (v1 <= a1[1][3])));
+    } else {
+        v3 = (((v0 > 33) != (v2 || 70)) >= ((v0 == 89) || (v3 || v0)));
+        v0 = (((v2 - 31) + (v2 != v0)) * ((v1 % 2) >= (v2 && v1)));
+        v1 = (((v2 > 70) && (a1[0][2] < a0[12])) * ((a1[1][6] >= a1[3][12]) ? (v1 % 5) : (v0 || 80)));
+    }
+    if ((((48 ? a0[0] : 60) % 1) + ((41 <= v2) <= (59 || v1)))) {
+        a1[1][9] = (((34 * a1[0][6]) == (a0[4] != v1)) || ((v0 + 90) ? (v2 >= v0) : (v2 ? 53 : v1)));
+        v2 = (((a0[2] - 15) + (v3 - 32)) != ((v0 > v1) % 3));
+        v3 = (((2 * a1[1][8]) && (v0 == a0[8])) ? ((74 / 1) / 5) : ((v2 && v2) % 9));
+    } else {
+        a1[2][3] = (((v0 > 21) / 2) < ((v2 || a1[3][12]) != (v2 / 9)));
+        a0[5] = (((a1[3][13] / 8) >= (v2 != 12)) - ((v3 * a1[1][14]) || (a1[0][5] != a0[11])));
+        v3 = (((v1 || a0[7]) - (v1 % 5)) ? ((a0[8] * a1[1][1]) < (v3 <= a1[2][12])) : ((v2 && v2) || (59 == 56)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((50 ? v1 : i2) > 95) break;
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    a1[0][2] = (((v0 / 2) <= (i3 != i3)) && ((v1 >= a0[15]) / 1));
+                    a1[3][0] = (((99 != 83) < (i3 < i3)) / 8);
+                    v2 = (((v0 && 44) > (a1[1][1] && 46)) && ((v1 || a0[8]) != (a0[2] && i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a1[1][12] ? a1[0][0] : v3) < (v3 != 95)) * ((i2 || 17) % 4));
+            v0 = (((7 - i2) < (a1[3][10] || 16)) + ((93 * 73) + (v0 / 8)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v3 = (((v0 / 3) != (50 > v1)) % 1);
+    v0 = (((a0[0] != a1[0][15]) ? (v0 <= v3) : (v1 ? v0 : v2)) == ((22 + v0) + (a1[0][5] || v2)));
+    v0 = (((v0 < v1) || (v1 + v3)) ? ((v2 % 5) && (79 * 64)) : ((a0[14] <= 69) - (a0[4] / 4)));
+    v0 = (((v1 > v2) <= (v0 < v1)) / 2);
+    return (((a1[0][4] <= v1) != (a1[0][7] != v3)) >= ((v2 && 57) >= (v2 < v3)));
+}
+int f12() {
+    int v0 = 53;
+    int v1 = 47;
+    int v2 = 25;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v3 = (((v0 ? i1 : i0) != (v1 ? a0[4] : v0)) < ((80 < 76) * (v1 && v2)));
+                v3 = (((v3 < a1[3][6]) >= (v1 - i0)) ? ((80 >= v0) >= (92 - i1)) : ((a0[10] / 8) && (84 - v0)));
+                v0 = (((a1[2][11] < v1) / 2) && ((i1 || v0) ? (i1 == v3) : (v2 + i0)));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v2 = (((a1[2][11] % 3) && (a0[8] > a1[3][4])) || ((v1 ? v0 : v0) ? (88 ? 17 : 80) : (16 || a0[2])));
+        v3 = (((a0[2] < 60) ? (40 % 7) : (a0[6] * v2)) / 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((16 <= 42) > 96) break;
+            v0 = (((a1[1][2] <= 22) ? (2 * v0) : (a0[5] < v3)) != ((a0[11] ? v2 : v3) < (37 != 70)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((a1[3][6] != a1[1][11]) && (78 == v2)) - ((a0[10] || i2) / 5));
+                v2 = (((50 - i2) + (60 * a1[3][10])) != ((v2 / 4) <= (28 == v2)));
+                v1 = (((v0 / 6) >= (a0[2] - v1)) * ((i3 % 5) >= (35 != 67)));
+            }
+            v0 = (((v3 ? v2 : v1) && (a0[1] == v0)) || ((i2 <= v2) != (v1 == v2)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v2 != v1) < (0 - v3)) >= ((a0[12] >= v2) == (a1[1][11] && 92)))) {
+        a1[2][8] = (((a1[2][12] == 58) + (v2 % 6)) != ((v0 <= v3) == (v3 > 21)));
+        a0[3] = (((v2 > v2) % 2) ? ((71 % 2) != (25 > 47)) : ((a0[9] != v0) < (v2 || 37)));
+        v0 = (((a0[4] % 5) - (63 / 2)) > ((76 > 94) || (85 - v3)));
+    } else {
+        v3 = (((a1[2][5] / 4) <= (v3 != 60)) * ((37 != v1) || (a0[6] > v2)));
+        a1[3][7] = (((v3 + v1) == (v0 != 78)) || ((v2 && 97) * (v3 == v3)));
+        v3 = (((v2 % 7) || (a1[1][15] + a0[0])) / 5);
+    }
+    if ((((v0 != 26) <= (a1[3][14] <= v0)) ? ((47 && v1) - (93 == v0)) : ((a0[4] - v3) ? (56 - v2) : (92 != a1[1][1])))) {
+        v3 = (((56 || a0[0]) >= (v1 || 3)) <= ((v3 == a0[9]) * (11 ? 41 : v1)));
+        v1 = (((v3 ? 13 : v1) / 5) <= ((v0 != v1) < (a0[10] || v2)));
+        v0 = (((15 > v0) < (a0[9] + a0[2])) * ((v1 - 43) < (a1[1][4] == v0)));
+    } else {
+        a1[0][10] = (((v2 < a0[14]) + (a0[1] == v3)) ? ((a0[14] != v3) + (v3 <= v3)) : ((v2 * v3) / 8));
+        v3 = (((v0 ? v3 : v3) < (v1 * v0)) ? ((a0[3] < v1) > (a0[3] || v0)) : ((v3 < v0) ? (82 - v3) : (v2 && a0[1])));
+        v1 = (((v0 == 49) > (a0[10] < 76)) * ((v2 ? a0[13] : 11) || (v2 || v0)));
+    }
+    if ((((v1 ? a0[10] : v3) == (a0[4] / 3)) ? ((v3 == 72) == (a1[0][10] || 78)) : ((v1 != a0[13]) ? (66 != 33) : (v1 * v3)))) {
+        v0 = (((a0[11] ? 96 : a0[1]) < (a0[5] < v0)) <= ((a0[9] > v2) || (v2 - v1)));
+        v2 = (((a0[6] || a0[1]) > (v2 % 8)) + ((v0 ? v0 : v0) != (v0 <= v0)));
+        a0[7] = (((40 * v0) * (v3 && a0[8])) / 6);
+    } else {
+        a1[1][3] = (((a0[6] * v3) != (67 && 19)) <= ((a0[0] % 4) < (71 || a1[0][6])));
+        a0[9] = (((a0[0] < a1[0][8]) <= (a1[0][14] % 1)) != ((v1 != v0) >= (v1 - v1)));
+        v1 = (((a1[0][1] && a0[11]) < (v2 && v3)) * ((a1[0][1] || v3) > (89 > v3)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        if ((26 + 8) > 64) break;
+        a0[11] = (((23 > v3) >= (a1[2][5] || a1[0][8])) > ((52 >= a0[15]) || (90 % 2)));
+        v0 = (((v2 >= a1[0][1]) <= (a0[1] > a1[1][9])) > ((v3 || 88) == (i4 >= 35)));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            a1[3][13] = (((a1[3][7] - 95) || (v2 - a1[2][7])) <= ((60 * 21) == (i5 ? a0[6] : i4)));
+            v0 = (((a0[11] && v2) ? (a1[2][7] > i5) : (i4 * v2)) - ((86 != 65) <= (a0[12] >= a1[0][11])));
+            a0[14] = (((i5 - a0[1]) > (32 * 18)) >= ((71 <= v2) || (v2 ? a0[6] : v2)));
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((a0[6] == v1) / 2) ? ((i6 ? a1[1][15] : a0[5]) / 1) : ((v1 < 99) >= (84 * 36)));
+            v1 = (((v1 <= v2) == (a1[1][0] == 26)) + ((v3 * 48) + (i6 % 3)));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v2 = (((v0 ? a0[3] : v2) >= (32 ? v3 : i7)) || ((67 * v1) < (a1[1][15] % 2)));
+                a0[1] = (((83 / 3) > (v0 || i7)) ? ((v1 ? a1[3][10] : 70) ? (90 - i6) : (v2 ? a1[1][1] : v2)) : ((8 ? i7 : v1) >= (27 <= a0[14])));
+                v2 = (((i6 - 53) == (v0 + v3)) % 8);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    {
+        int i8 = 0;
+        do {
+            v3 = (((v3 - 73) != (a0[2] + v3)) > ((v3 == v3) == (25 || a1[2][13])));
+            v1 = (((v3 / 1) ? (v0 > v3) : (34 * v3)) / 5);
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    a0[2] = (((52 ? v1 : v3) / 2) < ((6 == a0[2]) == (v1 == i9)));
+                    v2 = (((i8 + v3) * (61 % 2)) * ((i8 <= v1) * (v1 - 76)));
+                    v2 = (((a1[0][10] ? i8 : a0[11]) + (89 || 89)) ? ((i9 + i8) - (v0 >= a0[2])) : ((a1[0][14] % 6) + (v3 == a0[7])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    if ((((a0[7] < 10) < (v1 < 96)) >= ((v0 / 2) != (a0[6] <= v1)))) {
+        a0[13] = (((v2 < a1[0][8]) * (v1 * a0[11])) > ((75 >= v2) > (31 <= a1[2][14])));
+        v3 = (((a0[5] <= a1[0][12]) <= (22 != v3)) || ((v0 * 99) >= (v3 + 44)));
+        v1 = (((v1 < a0[14]) ? (a1[1][1] != v2) : (v2 <= a1[0][9])) == ((v0 <= 53) <= (v3 ? a1[3][8] : v3)));
+    } else {
+        a1[2][3] = (((v2 && v0) >= (v2 / 5)) ? ((15 != a1[1][0]) % 6) : ((27 || v2) / 7));
+        v3 = (((v2 < a1[2][1]) ? (v0 ? 47 : v3) : (v0 ? a1[1][9] : 82)) / 5);
+        a1[2][15] = (((v0 ? 58 : a1[1][10]) + (51 - v1)) > ((90 > 18) ? (96 || v1) : (a1[1][2] - a0[2])));
+    }
+    if ((((71 || 64) ? (v1 ? a1[3][0] : a0[15]) : (38 ? v1 : v3)) && ((63 != v2) || (v1 / 9)))) {
+        a1[2][3] = (((86 > 10) + (a1[0][14] + 15)) < ((24 + v2) > (v2 * v0)));
+        v0 = (((52 && 56) && (v3 <= v0)) ? ((v1 ? v0 : v3) ? (a1[0][13] != a1[2][5]) : (64 >= v1)) : ((68 < v2) <= (54 ? v1 : 63)));
+        v2 = (((v3 * 52) + (v3 ? v0 : a0[10])) / 2);
+    } else {
+        v2 = (((99 != a1[3][8]) - (v3 + a0[9])) == ((a0[14] && v2) || (85 / 2)));
+        v2 = (((a1[1][0] > v3) <= (v3 / 4)) >= ((33 || a1[0][6]) + (a1[0][12] / 8)));
+        a1[3][12] = (((a0[10] == v1) ? (v2 / 9) : (v2 && 21)) != ((80 == v0) || (a0[0] / 3)));
+    }
+    return (((a1[3][11] || v1) / 8) % 4);
+}
+int f13() {
+    int v0 = 17;
+    int v1 = 79;
+    int v2 = 64;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    if ((((52 * v2) == (v2 ? a1[3][11] : v2)) + ((a1[3][9] ? 60 : 81) / 8))) {
+        v0 = (((v0 + a0[6]) / 9) == ((a1[2][11] * v3) ? (v3 % 6) : (47 % 1)));
+        v2 = (((50 / 5) > (a1[3][9] ? a1[0][6] : a0[0])) * ((26 - a1[2][1]) != (v3 ? 76 : a1[0][0])));
+        v3 = (((71 ? v2 : 68) % 9) >= ((80 || v0) <= (v1 && v2)));
+    } else {
+        v1 = (((a1[2][2] / 4) ? (v0 > v0) : (v2 % 8)) != ((67 != a1[2][4]) % 4));
+        v2 = (((v1 || 47) <= (v1 ? v2 : v0)) ? ((v1 ? v3 : a1[2][10]) % 7) : ((40 - a1[1][1]) ? (13 ? a0[8] : a1[0][8]) : (a0[8] * v3)));
+        v0 = (((55 * a1[0][0]) <= (a1[1][3] || v3)) * ((a1[0][10] < v0) ? (v2 && 52) : (88 && v2)));
+    }
+    if ((((v2 < v0) <= (v2 % 7)) || ((a1[1][0] && a1[0][1]) - (v0 % 9)))) {
+        v0 = (((36 <= v1) > (v0 == v2)) ? ((v2 > v3) < (v3 * a0[6])) : ((v3 && a0[3]) < (a0[8] != v0)));
+        v3 = (((v1 - a0[12]) ? (v0 ? 26 : a0[2]) : (v0 ? v0 : v1)) > ((10 >= v0) != (v0 ? a1[1][6] : v3)));
+        v0 = (((v1 * v1) && (69 * v1)) > ((a1[1][7] > a1[2][13]) >= (a0[0] ? a0[6] : v2)));
+    } else {
+        v0 = (((a1[0][9] || v3) + (a0[11] % 2)) >= ((a0[0] % 8) % 4));
+        v3 = (((36 >= v2) && (v1 <= 15)) == ((a1[2][1] ? a0[3] : a0[5]) >= (a1[1][10] * v1)));
+        a1[2][10] = (((46 ? 37 : 40) + (v0 / 8)) > ((v1 ? v0 : v0) - (88 > v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v2 = (((v0 % 1) && (v0 || v1)) / 9);
+            {
+                int i1 = 0;
+                do {
+                    if ((v1 && 14) > 61) break;
+                    a0[1] = (((i1 - a0[0]) > (a1[0][10] / 8)) < ((v3 <= 89) == (i1 > a0[11])));
+                    v0 = (((v3 && a1[1][15]) / 2) ? ((a1[3][12] + i0) + (a0[5] ? i1 : a1[0][6])) : ((a1[1][3] == 53) + (32 <= a1[2][11])));
+                    v3 = (((v3 % 8) || (v1 != v1)) ? ((i1 >= 17) <= (a1[3][10] ? 24 : v1)) : ((a1[2][5] && a0[2]) + (a1[3][9] % 8)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v2 = (((v1 > 4) + (v0 || 41)) <= ((a1[1][3] < 6) && (v0 - v0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    a0[15] = (((a0[9] / 1) != (19 ? v1 : v1)) && ((a0[7] + a1[2][5]) > (a1[0][3] != v2)));
+                    a1[0][12] = (((v3 >= a1[3][0]) <= (i2 - 16)) && ((v2 ? a1[2][7] : 92) && (v3 / 7)));
+                    v1 = (((99 ? v1 : a1[1][4]) % 2) < ((v1 < 36) == (v1 || 31)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((a1[1][13] < 41) ? (v1 == v0) : (v0 < a0[12])) < ((v0 < a1[0][12]) < (43 + v3)));
+            v1 = (((v3 && a1[3][13]) + (v2 > v0)) - ((v0 != 80) * (21 > 11)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v3 && 98) >= (75 + v2)) >= ((75 + 27) > (a1[3][2] + v1)))) {
+        a0[0] = (((v2 == a0[5]) ? (a0[10] == v0) : (a0[15] || a0[12])) ? ((v3 ? a1[1][3] : v1) > (75 < v3)) : ((v3 + v1) != (v0 ? a1[0][7] : 57)));
+        v0 = (((v1 >= v0) >= (v3 + a1[2][12])) <= ((v0 < v3) == (v2 < v0)));
+        a1[2][11] = (((a0[3] < v0) && (v2 >= 21)) || ((38 + 99) % 4));
+    } else {
+        v2 = (((29 ? 31 : v2) % 5) != ((15 < v3) > (a0[4] == a0[1])));
+        a0[10] = (((v1 / 5) ? (a1[0][14] % 2) : (a0[7] || v1)) <= ((v1 - 55) && (v3 >= v1)));
+        v2 = (((a1[0][1] == v1) && (v1 % 9)) >= ((v1 <= 15) ? (a1[3][3] > v0) : (v0 + v1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v0 = (((15 != v0) * (82 < i5)) != ((v2 / 7) ? (56 > 55) : (i5 == a0[11])));
+                v1 = (((i5 || i4) ? (v3 * a0[0]) : (72 && a0[15])) + ((a1[2][2] < i4) > (v2 ? 64 : v0)));
+                a0[8] = (((i4 > 2) == (60 || v0)) == ((35 > i4) / 8));
+            }
+            v2 = (((16 ? a0[11] : v0) || (v2 > a0[2])) && ((2 - i4) && (v1 >= 79)));
+            v3 = (((v2 / 3) ? (v1 + a1[1][1]) : (v3 != v2)) == ((a0[9] && v2) + (v0 || v2)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    v1 = (((v0 * 50) < (83 || v2)) > ((20 / 5) != (v2 > 97)));
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            v0 = (((a1[2][12] || 21) * (i6 * v1)) > ((82 ? a0[2] : 86) >= (73 % 9)));
+            a0[2] = (((a0[2] >= 27) > (20 / 8)) == ((80 && v1) < (a0[12] < a0[2])));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v2 = (((a1[3][15] != a1[0][2]) >= (v2 || 78)) > ((i7 == v0) * (a0[14] && v0)));
+                a1[2][9] = (((v1 + i6) == (a1[3][4] - 20)) > ((v3 < i7) > (i6 ? a0[14] : i6)));
+                v0 = (((v0 + 28) && (91 < v2)) / 2);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            a0[6] = (((v0 && 73) * (i8 >= 56)) == ((10 ? v0 : i8) == (a1[3][7] && 65)));
+            v0 = (((a0[8] ? v2 : a0[6]) != (20 ? v3 : v1)) != ((34 != v0) < (i8 < i8)));
+            {
+                int i9 = 0;
+                do {
+                    a0[1] = (((i8 != v3) ? (v0 == a1[2][3]) : (v1 == i9)) >= ((v2 - 51) + (53 / 5)));
+                    v3 = (((v3 ? a0[15] : a1[1][15]) / 2) / 5);
+                    v2 = (((v3 > v1) % 3) ? ((a0[9] * a1[3][3]) / 9) : ((i9 % 1) + (i9 ? a0[7] : i8)));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 8; i10 = i10 + 1) {
+        for (int i11 = 0; i11 < 3; i11 = i11 + 1) {
+            v2 = (((i10 > 3) / 5) + ((i10 != v3) ? (i10 || v1) : (i11 % 4)));
+            a0[5] = (((v2 == 49) % 4) && ((v3 < i11) != (i11 == v3)));
+            v0 = (((v1 + 38) % 6) == ((17 * v0) <= (v1 / 4)));
+        }
+        v0 = (((a0[10] % 2) > (a1[1][7] < a1[0][11])) || ((a1[0][13] == a1[2][11]) ? (a0[4] ? 99 : i10) : (36 >= a1[1][12])));
+        a0[13] = (((a0[3] - v3) != (a1[0][5] > 72)) * ((v3 ? i10 : a1[2][4]) * (71 > a1[3][7])));
+    }
+    return (((68 / 1) <= (v1 < a0[4])) - ((85 > v0) ? (a0[8] ? a0[7] : 86) : (27 != v1)));
+}
+int f14() {
+    int v0 = 78;
+    int v1 = 36;
+    int v2 = 64;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 != 78) > (v0 && a0[7])) ? ((a1[1][10] * 34) - (a1[2][1] == a0[15])) : ((v1 ? 96 : v2) * (a0[14] ? v2 : v0)))) {
+        v3 = (((v2 == v2) - (91 <= v3)) || ((72 + a1[3][11]) < (89 - a1[3][5])));
+        v1 = (((a1[1][10] * v1) - (35 != v0)) ? ((5 ? 46 : a1[2][7]) % 9) : ((74 / 7) >= (a0[14] % 9)));
+        v3 = (((17 > v1) ? (67 > 77) : (a0[9] <= v0)) / 2);
+    } else {
+        a0[15] = (((a0[8] % 7) ? (v3 / 3) : (v2 || a0[7])) != ((a0[8] != 7) + (v3 > v3)));
+        v2 = (((v3 * v2) ? (v2 / 9) : (v2 ? 97 : v3)) >= ((v0 ? a0[1] : a1[0][9]) == (31 ? v3 : 67)));
+        v1 = (((v0 >= a0[7]) <= (v1 && 0)) ? ((a1[3][4] * a1[0][7]) / 2) : ((11 == 55) * (v0 - a1[2][11])));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((i0 + a0[15]) > 60) break;
+        a0[6] = (((i0 > a1[0][4]) || (v1 > 42)) <= ((a0[11] || a0[14]) - (v0 >= v3)));
+        {
+            int i1 = 0;
+            do {
+                v2 = (((i0 % 7) <= (v2 != a0[0])) && ((v2 > 58) >= (v1 * 19)));
+                v3 = (((v3 != 3) > (a1[0][15] * a0[9])) % 6);
+                v0 = (((v0 % 2) || (i0 + 43)) >= ((i0 >= 93) >= (v2 - v3)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v1 = (((a0[3] > v3) || (37 ? v1 : v3)) / 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v3 = (((v1 == v0) <= (v1 == v0)) / 5);
+            {
+                int i3 = 0;
+                do {
+                    if ((i3 && v2) > 92) break;
+                    v1 = (((i2 > v1) ? (v3 != v2) : (a1[2][3] || v2)) ? ((a1[0][10] != 45) - (i2 < a1[2][10])) : ((v0 / 9) <= (41 < 45)));
+                    v1 = (((i3 ? i2 : v1) - (v1 < v2)) % 1);
+                    v0 = (((43 && v3) >= (v3 / 5)) ? ((i3 || 4) || (a1[1][4] ? 29 : a1[0][11])) : ((16 ? a1[1][5] : v0) - (v0 || v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v0 = (((v2 || 83) - (62 * a0[15])) ? ((v0 == a1[1][5]) != (a0[13] < a0[7])) : ((90 || 74) <= (a1[3][7] ? 45 : 32)));
+            i2 = i2 + 1;
+        }
+    }
+    a0[3] = (((v3 || v1) ? (16 && 21) : (72 <= a0[10])) > ((90 < v1) * (93 + v2)));
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a0[15] = (((v0 >= a1[2][7]) || (62 / 2)) && ((a1[0][14] || 85) <= (90 > 10)));
+        v0 = (((v2 == a1[2][10]) > (a0[5] + 32)) && ((87 > i4) >= (v0 != 61)));
+        {
+            int i5 = 0;
+            do {
+                a0[1] = (((i4 <= 48) / 7) < ((46 + a0[0]) - (i5 ? v3 : i4)));
+                a1[0][15] = (((i4 > i5) ? (a0[5] || 19) : (a0[6] && v0)) % 6);
+                v3 = (((a1[3][2] <= a1[3][10]) > (v2 % 4)) - ((v3 % 1) >= (80 - v0)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+    }
+    if ((((v2 ? 89 : a0[15]) == (v2 >= v0)) + ((v0 >= v0) / 6))) {
+        a0[1] = (((v1 != v1) * (v2 * v3)) + ((v2 + a1[2][8]) - (v3 ? v0 : v0)));
+        a0[15] = (((v3 >= v1) ? (v1 > a1[2][6]) : (v3 == v3)) || ((74 != 82) > (v2 && a0[13])));
+        v0 = (((v1 < v1) / 7) && ((v1 || v2) <= (v1 == v3)));
+    } else {
+        a0[10] = (((a1[0][0] <= 29) / 6) % 8);
+        v2 = (((12 % 6) <= (93 + a1[0][10])) <= ((0 < a0[1]) >= (47 != 10)));
+        a1[0][0] = (((a0[12] % 6) && (v3 > v3)) - ((a0[2] <= 56) ? (51 > 40) : (v2 || 84)));
+    }
+    if ((((27 / 7) <= (v0 <= 54)) >= ((a1[0][14] != v2) % 9))) {
+        a1[3][11] = (((v3 || a0[15]) % 1) + ((a0[5] ? 79 : 33) + (v0 % 6)));
+        a1[1][6] = (((v1 && v1) % 7) == ((66 == a1[2][11]) || (v2 > a1[2][2])));
+        v2 = (((a1[0][13] * 43) >= (v1 - 91)) - ((v1 / 5) != (v0 ? v1 : 78)));
+    } else {
+        v0 = (((a0[3] != 95) - (a0[9] ? 33 : v2)) + ((v0 ? 24 : v3) % 7));
+        v2 = (((25 >= 16) && (v1 % 6)) ? ((v0 ? v0 : v2) / 3) : ((87 >= v1) || (a0[14] <= 57)));
+        v2 = (((v2 != v0) + (v3 + v3)) == ((v0 ? 18 : a0[2]) % 6));
+    }
+    if ((((60 && v0) != (v0 ? v1 : 31)) != ((29 >= v3) || (v0 + v3)))) {
+        v1 = (((v0 ? 30 : v1) * (a0[15] % 6)) * ((v0 % 5) ? (36 || v2) : (a0[8] ? v0 : 40)));
+        a1[0][15] = (((v0 <= a1[2][1]) % 9) * ((a1[3][5] > 11) < (v1 < v3)));
+        v2 = (((10 + v3) || (83 + v1)) == ((55 * 42) <= (a0[10] / 6)));
+    } else {
+        v2 = (((v2 > v0) * (v2 > v0)) <= ((a1[1][9] * v0) && (a0[1] != v0)));
+        v1 = (((v0 || v1) && (v0 < a1[0][13])) - ((v0 || a0[1]) / 8));
+        a1[3][1] = (((v2 == v3) >= (a1[2][14] * v0)) == ((v0 == a0[12]) < (v1 == v1)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((v0 < a0[5]) + (a0[4] != 89)) <= ((v1 * v1) == (v3 || i6)));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v2 = (((i6 == 70) >= (i6 % 4)) <= ((a1[2][10] ? v1 : v3) % 1));
+                v0 = (((i7 > v0) ? (v0 == v1) : (i7 || a0[8])) + ((a1[0][10] != a0[5]) - (90 <= v0)));
+                v3 = (((84 ? v1 : a0[15]) && (v2 || v2)) - ((v2 <= i7) != (i7 || i6)));
+            }
+            v0 = (((v1 == i6) >= (31 != 41)) - ((i6 < v2) > (a0[2] - i6)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    if ((((a0[13] == v0) < (82 >= v2)) > ((86 < 30) || (89 != v3)))) {
+        v1 = (((v2 <= v1) >= (v0 < v3)) <= ((a1[1][0] && v2) * (46 > v0)));
+        v3 = (((v1 || a0[14]) + (96 || a1[0][1])) > ((93 + v2) - (v1 == 39)));
+        a0[13] = (((v2 % 1) % 1) % 9);
+    } else {
+        a1[0][12] = (((v3 / 4) ? (a1[2][12] && 16) : (86 > a1[2][6])) && ((v0 && 44) - (v0 || a1[2][1])));
+        a1[2][6] = (((1 >= 50) + (a0[13] % 6)) / 5);
+        a1[0][11] = (((v2 == v1) ? (a0[8] && a0[5]) : (a0[7] > v3)) - ((93 / 8) >= (a1[1][7] * a0[14])));
+    }
+    return (((a1[1][1] > 14) && (30 % 6)) != ((a1[2][8] || v1) ? (90 < v2) : (48 < v0)));
+}
+int f15() {
+    int v0 = 68;
+    int v1 = 57;
+    int v2 = 59;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v3 = (((a1[3][7] >= i0) * (v2 != v2)) / 2);
+            v3 = (((v1 >= v2) <= (97 < a0[9])) - ((a1[2][4] >= v3) > (83 - v3)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v2 = (((57 + a0[1]) * (i1 / 7)) ? ((i1 / 1) < (v0 * 34)) : ((i0 || 18) >= (v3 + a1[3][13])));
+                v2 = (((v0 ? v1 : v1) * (i1 * i0)) % 8);
+                v1 = (((v3 || v3) && (a1[0][6] - 89)) - ((a1[3][11] / 3) <= (v2 * a0[5])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 % 4) > 70) break;
+            v1 = (((a0[2] ? 8 : i2) && (18 * 0)) < ((i2 >= v1) ? (85 * a1[1][2]) : (i2 != a1[3][11])));
+            a0[14] = (((v2 - 87) == (a0[1] > v0)) % 1);
+            {
+                int i3 = 0;
+                do {
+                    a0[14] = (((i3 <= a0[11]) * (v1 > a1[0][10])) < ((i2 && v2) + (i3 == v0)));
+                    v0 = (((7 <= a0[9]) % 7) / 4);
+                    a0[13] = (((99 < 51) || (a0[14] > a1[3][14])) && ((v2 / 5) != (i2 || a1[3][1])));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((a0[15] <= 83) > 67) break;
+                    a1[1][10] = (((i5 < 98) - (v1 != v1)) % 3);
+                    v2 = (((7 < 50) % 2) - ((4 - a0[9]) > (50 + i5)));
+                    a0[13] = (((46 < i5) ? (v3 > 11) : (a0[14] > a0[7])) > ((a0[14] <= v0) != (i5 || 34)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((v3 ? v3 : a0[14]) && (v0 == v2)) || ((49 || v3) == (v1 || a0[3])));
+            v0 = (((v1 ? a0[4] : a1[3][15]) ? (i4 / 4) : (a1[2][13] * a1[1][1])) != ((v0 ? i4 : 48) && (v3 ? 96 : i4)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v3 = (((23 || 74) == (69 >= a0[1])) - ((v2 - a1[0][12]) != (i7 * i7)));
+                v0 = (((v3 - a0[4]) || (a0[15] == v0)) && ((i6 % 5) != (35 > a1[0][4])));
+                v3 = (((v3 <= v0) < (26 && v0)) - ((v1 && v0) ? (a0[15] != i6) : (v2 || v3)));
+                i7 = i7 + 1;
+            } while (i7 < 8);
+        }
+        a1[3][7] = (((a0[12] * v3) > (v2 <= a1[0][14])) != ((i6 < v1) % 4));
+        a0[11] = (((a0[6] < 25) % 9) + ((69 + i6) == (a0[2] <= 26)));
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    v2 = (((a1[0][12] % 8) != (v0 < a1[0][13])) * ((a1[3][13] > 2) || (v0 <= v2)));
+                    v1 = (((i9 ? a0[6] : 63) % 6) > ((a0[4] && i8) == (70 < v1)));
+                    v0 = (((a0[8] / 8) >= (7 < i9)) ? ((i9 == 80) > (a0[12] / 2)) : ((v2 - a1[1][14]) / 2));
+                    i9 = i9 + 1;
+                } while (i9 < 2);
+            }
+            v3 = (((a1[3][7] / 5) ? (v0 == a0[7]) : (v1 * v1)) || ((v2 % 9) ? (v0 * v1) : (v3 < 11)));
+            a1[3][2] = (((i8 ? v2 : 18) == (27 >= v1)) && ((v2 <= v2) && (a0[13] || i8)));
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 3) {
+            if ((21 / 8) > 86) break;
+            a1[3][4] = (((a0[3] * v0) ? (i10 != 56) : (a0[15] % 1)) == ((11 ? 21 : a1[3][8]) && (90 / 7)));
+            {
+                int i11 = 0;
+                do {
+                    a0[9] = (((v1 == i11) < (75 * i11)) > ((i10 >= 25) + (74 == 74)));
+                    v1 = (((79 > i10) > (a1[2][6] || 38)) - ((i11 <= a0[10]) / 8));
+                    a0[12] = (((i11 % 8) > (70 <= v1)) || ((v2 && a0[4]) != (v1 >= 17)));
+                    i11 = i11 + 1;
+                } while (i11 < 5);
+            }
+            v3 = (((a0[9] ? v2 : i10) / 9) / 1);
+            i10 = i10 + 1;
+        }
+    }
+    if ((((v0 / 8) % 1) >= ((v1 + a0[7]) && (13 <= 94)))) {
+        v3 = (((v0 - 20) % 4) < ((a1[2][3] < a1[1][14]) ? (v0 <= 1) : (v2 == 38)));
+        a1[3][6] = (((a0[14] || v0) - (v3 - v1)) && ((a1[2][0] ? v2 : v0) && (v1 ? v2 : a0[0])));
+        a1[2][6] = (((a0[10] != v3) && (a1[1][15] + v3)) ? ((84 > 79) % 9) : ((v1 ? a1[3][14] : a1[1][7]) % 7));
+    } else {
+        a1[1][5] = (((v0 ? 49 : a0[5]) >= (a1[2][6] % 2)) < ((v0 ? 12 : a1[1][15]) || (v1 - a1[3][15])));
+        v0 = (((27 - v2) == (25 * v3)) == ((v3 ? 81 : a1[3][1]) >= (41 && 5)));
+        v0 = (((66 * v0) * (29 / 7)) >= ((v3 * 27) < (v1 + 93)));
+    }
+    {
+        int i12 = 0;
+        do {
+            if ((11 == 23) > 55) break;
+            a1[2][12] = (((14 - 28) - (v0 != v2)) * ((47 == v1) && (15 / 6)));
+            v1 = (((v2 <= v0) < (v3 && v0)) == ((v2 * 59) < (a1[0][13] == v3)));
+            for (int i13 = 0; i13 < 5; i13 = i13 + 1) {
+                v3 = (((66 && 9) != (79 != i13)) < ((i12 != 29) % 6));
+                a1[1][1] = (((v2 && a1[0][2]) != (11 + a0[13])) % 1);
+                a1[1][3] = (((i12 * 81) != (i12 >= v1)) / 1);
+            }
+            i12 = i12 + 1;
+        } while (i12 < 7);
+    }
+    if ((((a0[1] <= a0[5]) ? (70 >= a1[1][12]) : (v3 ? a1[0][9] : 86)) > ((a1[0][8] * a1[0][6]) - (a0[9] / 4)))) {
+        v0 = (((v1 && v3) < (v2 ? v1 : 52)) >= ((v2 + a1[1][4]) > (v3 ? v0 : v3)));
+        v0 = (((a1[2][9] && 98) * (a1[0][11] ? 74 : a0[3])) >= ((v0 <= a1[1][5]) + (v0 / 7)));
+        a0[14] = (((v1 <= v3) - (v1 / 6)) + ((a1[1][7] / 1) / 1));
+    } else {
+        v2 = (((20 >= a0[9]) < (18 ? a1[0][14] : v2)) && ((v0 != a1[0][7]) || (v3 - v0)));
+        v0 = (((v1 == a0[5]) > (3 ? v0 : v3)) * ((v1 != 9) <= (v1 > v1)));
+        a0[2] = (((v0 == v2) != (a1[0][3] && v1)) / 8);
+    }
+    if ((((a1[0][2] % 1) >= (50 || v2)) ? ((v3 || v2) <= (a0[5] - v2)) : ((a1[0][14] <= v2) ? (v1 < v1) : (v0 && a0[4])))) {
+        v0 = (((v1 < v1) > (a0[12] >= v3)) > ((v0 * a1[2][9]) && (a1[3][1] % 2)));
+        a0[9] = (((39 >= a0[9]) >= (v2 / 7)) < ((v1 - v0) < (v1 && v3)));
+        v2 = (((v3 && v1) > (a0[1] && v1)) / 4);
+    } else {
+        a0[15] = (((v3 ? 91 : a1[0][5]) - (v1 || 34)) / 8);
+        a1[1][4] = (((v3 ? a1[2][9] : 26) < (v2 - v3)) && ((v1 % 9) ? (v2 - 13) : (v1 < 40)));
+        v0 = (((v3 + a0[9]) == (a1[2][3] % 7)) <= ((v3 ? 20 : v0) + (v2 > a0[5])));
+    }
+    return (((v3 >= v2) || (v3 ? v0 : 87)) - ((v2 ? 37 : v2) >= (a1[2][8] <= a0[0])));
+}
+int f16() {
+    int v0 = 72;
+    int v1 = 60;
+    int v2 = 88;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v2 != 69) > 92) break;
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a1[3][11] = (((a1[3][15] - v3) || (v2 - 17)) || ((42 != v0) == (a1[3][7] * i0)));
+                    v0 = (((a1[2][5] == a1[1][3]) > (v1 != v2)) ? ((i1 != i1) >= (a0[5] < i1)) : ((a0[4] - 62) != (a0[12] ? v2 : 3)));
+                    v2 = (((i0 / 7) * (v2 * a0[12])) ? ((98 != v2) <= (i1 % 7)) : ((94 < 53) ? (i1 >= a0[12]) : (43 >= 91)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((54 * 14) < (v2 < 2)) * ((v2 > 99) < (a0[8] + 27)));
+            v3 = (((a0[12] + v2) + (v3 && v1)) || ((a0[15] && v3) && (v2 + v3)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a0[4] && a1[1][15]) > 61) break;
+        v2 = (((a1[1][4] == i2) && (v2 + 17)) == ((41 - v2) ? (v2 > 73) : (v1 < v2)));
+        v0 = (((a1[2][3] && a0[4]) != (99 / 8)) % 7);
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            v2 = (((v0 != v0) < (v3 < 47)) * ((a1[2][8] + v2) / 3));
+            v2 = (((v1 || v3) % 3) + ((44 || a0[3]) + (v2 || a0[5])));
+            v3 = (((i2 <= 61) - (a1[3][3] > a1[0][8])) * ((a0[9] || 2) == (a0[8] && v3)));
+        }
+    }
+    a0[0] = (((v3 % 7) || (a1[1][6] != v1)) ? ((23 <= 25) ? (a0[11] / 8) : (v0 ? v1 : v3)) : ((91 + v0) ? (v0 > a0[14]) : (10 % 8)));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    if ((v0 == v1) > 62) break;
+                    v0 = (((i5 >= i4) * (7 ? i5 : i4)) < ((56 * a0[11]) * (a0[2] ? 80 : 37)));
+                    v3 = (((i5 / 2) * (v1 < v2)) != ((a1[3][2] >= i5) > (i4 % 1)));
+                    a0[13] = (((i5 / 8) % 4) > ((v2 == v2) <= (79 == 87)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((i4 < 35) && (69 * 86)) == ((a0[6] > a1[3][3]) ? (v1 != i4) : (i4 + v0)));
+            v3 = (((v2 ? v1 : v3) && (a0[14] && 62)) - ((v1 == v2) + (a1[3][12] || 51)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[3] > a0[9]) || (a0[10] == v0)) != ((v2 - a0[0]) ? (v2 ? v3 : 79) : (a1[1][5] ? 92 : v1)))) {
+        v3 = (((v3 == a0[13]) + (69 - 91)) % 8);
+        a0[7] = (((57 / 7) + (60 && 7)) % 5);
+        v0 = (((a1[0][9] <= v1) - (v3 != 50)) ? ((a0[10] - 4) ? (36 * v3) : (v3 ? a1[0][9] : a0[11])) : ((a1[3][1] >= a0[11]) > (v2 + v2)));
+    } else {
+        v0 = (((v0 < 24) < (a0[1] && v1)) != ((v1 == v1) ? (v1 == v1) : (87 + v0)));
+        a1[1][1] = (((v1 ? a1[1][7] : v1) == (a0[11] != a1[2][11])) >= ((v2 == a1[2][10]) - (a0[15] / 2)));
+        v1 = (((a0[4] >= a1[2][0]) ? (54 > v2) : (v0 > 31)) - ((a0[8] && v0) || (v3 / 9)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((a1[1][11] != v0) > 90) break;
+            v0 = (((a0[12] + v3) >= (90 + a1[0][10])) || ((v1 - a0[11]) != (a1[0][8] == v3)));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v3 = (((v1 ? v3 : v3) > (54 + i6)) % 1);
+                v0 = (((v1 ? a1[1][3] : v1) + (a1[3][15] + a0[15])) < ((34 % 2) != (15 * a0[14])));
+                a0[15] = (((v0 != a1[3][5]) >= (v2 + i6)) < ((a1[3][1] < 77) ? (a1[2][0] / 7) : (v1 <= 22)));
+            }
+            v2 = (((21 || v0) / 3) >= ((i6 / 7) * (v1 + a0[6])));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        v2 = (((a1[2][6] + 27) <= (a0[14] + 74)) - ((v3 - a0[12]) >= (v0 >= i8)));
+        for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+            v3 = (((a0[4] != a0[1]) - (i9 ? a0[7] : 5)) > ((i8 % 9) <= (a1[2][8] ? a0[6] : 24)));
+            a0[12] = (((48 && v2) <= (75 - 97)) >= ((42 * i9) * (62 + a1[1][15])));
+            v1 = (((a1[0][6] + 24) != (v2 >= i8)) || ((v3 + v2) + (a1[0][14] == a1[3][1])));
+        }
+        v0 = (((a0[10] + a0[1]) - (a0[3] - v0)) < ((a1[1][11] - a1[0][9]) ? (42 == v1) : (v0 && 97)));
+    }
+    v0 = (((53 == 25) - (22 < a0[5])) >= ((v3 * v2) != (98 || v2)));
+    v3 = (((16 / 8) > (v0 * a1[0][2])) ? ((84 != v3) ? (v2 % 2) : (v2 == a1[3][13])) : ((v0 == v3) && (v2 + v1)));
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        if ((a0[4] % 7) > 90) break;
+        a0[3] = (((v0 == 63) && (v1 ? i10 : v0)) < ((i10 * v1) >= (i10 % 6)));
+        a0[12] = (((a1[3][4] && 22) * (a0[0] || v2)) == ((v3 >= v0) + (v0 * v1)));
+        {
+            int i11 = 0;
+            do {
+                v0 = (((v2 && 5) % 9) < ((a1[0][12] * 52) + (v3 > i11)));
+                v2 = (((a0[4] ? a1[1][15] : v1) == (v1 == a0[2])) && ((v0 ? a0[3] : a1[1][2]) || (v1 + 19)));
+                v2 = (((32 || v3) <= (a0[5] && a1[1][11])) ? ((v3 <= i11) >= (86 != i11)) : ((19 != 3) || (i10 < 20)));
+                i11 = i11 + 1;
+            } while (i11 < 2);
+        }
+    }
+    return (((5 < v3) - (a0[3] != v3)) <= ((v2 <= v2) == (a1[3][13] + v1)));
+}
+int f17() {
+    int v0 = 46;
+    int v1 = 91;
+    int v2 = 22;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    if ((((77 <= v0) - (v1 > v1)) <= ((v2 * 12) - (v1 / 1)))) {
+        v2 = (((56 ? a1[1][8] : v2) != (v1 ? v1 : v1)) / 3);
+        v1 = (((v1 <= 33) && (v0 && a1[3][14])) != ((93 != a0[3]) ? (v0 + a0[11]) : (a0[14] ? 24 : a1[0][14])));
+        v2 = (((v0 * a1[2][1]) % 3) ? ((v2 || 37) || (27 ? 80 : v3)) : ((a1[3][0] % 4) * (98 / 7)));
+    } else {
+        a1[1][9] = (((6 < v0) <= (v2 >= a0[2])) ? ((v0 % 5) <= (34 * v3)) : ((v0 + v1) <= (v3 == v2)));
+        v2 = (((a1[3][10] / 2) * (v1 > 85)) + ((v1 ? v0 : v0) ? (a1[1][10] ? v0 : v1) : (a0[15] != v3)));
+        v3 = (((v2 ? v2 : 18) > (a0[7] >= a0[3])) / 4);
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v0 = (((i0 + a0[15]) > (2 % 1)) + ((a1[1][12] * v1) % 9));
+            v1 = (((96 * 46) || (v0 <= 64)) || ((57 / 2) * (v3 % 4)));
+            v0 = (((v2 || v1) ? (55 ? i1 : 50) : (v3 != v3)) >= ((v0 <= v1) != (i0 % 5)));
+        }
+        v2 = (((a0[7] / 6) || (v2 * v2)) != ((4 ? v0 : a0[0]) != (v0 >= v3)));
+        v0 = (((v1 >= i0) + (53 != i0)) != ((v1 + 80) == (a0[10] > a0[14])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v0 = (((v2 / 3) ? (86 + a1[3][12]) : (a0[4] <= a0[5])) == ((a0[11] || a1[3][14]) >= (a0[14] <= 20)));
+            v1 = (((a0[4] <= v1) > (a0[1] >= v3)) % 7);
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((v0 && a0[10]) > 97) break;
+                    v1 = (((v2 ? i2 : a1[1][13]) > (88 + a1[2][5])) > ((v1 ? 39 : v2) <= (v2 * v2)));
+                    v1 = (((71 == a0[14]) <= (v3 != v1)) < ((10 >= a1[2][9]) - (a1[2][5] ? i3 : v2)));
+                    v3 = (((v3 / 8) >= (i2 ? 89 : a0[6])) >= ((v2 ? v3 : 18) || (v2 * 49)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                if ((30 - v1) > 78) break;
+                v0 = (((a1[2][14] + a0[3]) && (v1 > a0[4])) - ((i4 != 39) == (25 / 9)));
+                v1 = (((v1 < 73) <= (v0 / 4)) ? ((18 >= a1[0][6]) ? (a1[3][1] % 9) : (a1[2][15] >= v0)) : ((v2 == 35) || (88 - 48)));
+                v1 = (((a0[13] ? 1 : v3) <= (i5 || i4)) / 5);
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((i4 - v0) ? (a1[0][0] * v3) : (a1[1][1] && a1[0][1])) * ((i4 % 8) < (a1[3][4] <= i4)));
+        v2 = (((64 > v1) <= (v0 <= v2)) || ((v3 * v0) ? (71 != 16) : (v3 >= v3)));
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                if ((5 > v1) > 74) break;
+                v3 = (((57 / 5) > (v0 < a0[4])) - ((v1 % 8) == (i7 == v1)));
+                v1 = (((v1 <= 45) >= (i6 % 3)) - ((53 + v2) ? (i6 / 3) : (v1 - v1)));
+                a0[0] = (((v0 / 1) || (18 ? i6 : v1)) != ((v1 <= 22) ? (v3 != 0) : (v1 < v2)));
+                i7 = i7 + 1;
+            } while (i7 < 4);
+        }
+        v1 = (((85 * 37) * (v1 > a1[2][11])) >= ((a1[2][13] < v2) <= (67 != v2)));
+        v2 = (((v1 ? v2 : i6) ? (v0 / 7) : (94 <= 99)) < ((22 + 10) == (a0[3] ? 50 : v1)));
+    }
+    if ((((v0 + 87) / 2) > ((a0[14] / 9) < (a1[1][15] >= v0)))) {
+        v1 = (((a0[14] * a0[0]) + (85 + v1)) ? ((a0[11] + v2) ? (87 || 11) : (69 / 7)) : ((97 <= v1) && (a1[0][2] < v2)));
+        a0[10] = (((v2 + a0[15]) || (v1 > v0)) * ((a1[2][3] * 64) * (70 || v1)));
+        v0 = (((v0 || a1[3][11]) - (v1 && v3)) - ((v0 != 39) >= (a1[2][3] < v1)));
+    } else {
+        a1[3][12] = (((a0[2] / 9) + (a0[8] || 67)) - ((a1[3][0] <= 52) && (v3 <= 96)));
+        v0 = (((v2 || v3) % 4) * ((v0 / 2) ? (a0[4] != 28) : (v0 && v2)));
+        v2 = (((70 && 37) && (32 ? v2 : 70)) != ((63 >= v3) % 7));
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        if ((v2 * v2) > 90) break;
+        v1 = (((a0[1] / 4) ? (a0[7] != a0[3]) : (i8 / 4)) > ((a0[12] ? 88 : a1[0][14]) > (a0[4] && v0)));
+        v0 = (((v0 ? i8 : a0[2]) * (v3 != v0)) < ((v0 % 4) < (97 && a1[1][2])));
+        {
+            int i9 = 0;
+            do {
+                a1[3][12] = (((v2 % 9) * (a0[6] || 25)) - ((v0 * v0) || (v3 ? i8 : 92)));
+                v1 = (((v1 % 4) + (a0[1] ? a1[1][0] : a1[2][6])) <= ((v0 <= 76) < (i8 / 4)));
+                v3 = (((23 % 5) == (a0[8] ? v3 : i8)) + ((a1[2][6] % 2) ? (25 + v0) : (v1 ? i9 : v3)));
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 3) {
+            a1[2][10] = (((v3 == v0) <= (a0[1] > 29)) <= ((76 <= a1[2][4]) >= (i10 > a1[3][15])));
+            a1[1][0] = (((v2 > a1[1][15]) == (96 - 99)) >= ((v1 > 53) ? (v3 || a1[1][2]) : (60 || v1)));
+            {
+                int i11 = 0;
+                while (i11 < 7) {
+                    a0[1] = (((a1[2][6] + a1[2][5]) != (v2 >= v3)) == ((a1[3][5] - v2) > (a0[3] > a0[6])));
+                    v0 = (((v1 || 79) != (i10 || 28)) % 1);
+                    v0 = (((i11 && 36) ? (v1 > 4) : (a1[3][8] <= i10)) / 1);
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        }
+    }
+    {
+        int i12 = 0;
+        do {
+            v0 = (((i12 < 33) > (a1[3][1] > a0[7])) != ((v0 && 8) > (7 != v2)));
+            v3 = (((a0[15] / 3) <= (v3 * a1[3][8])) || ((v0 < v3) || (v3 < 9)));
+            for (int i13 = 0; i13 < 8; i13 = i13 + 1) {
+                v2 = (((v3 >= v0) <= (a1[0][2] - 85)) % 5);
+                a1[1][10] = (((v2 ? a1[0][7] : a0[12]) > (a0[13] || a1[2][0])) <= ((22 >= v0) - (a0[1] / 2)));
+                v2 = (((i12 * a1[2][10]) % 5) * ((a0[10] - 27) > (59 >= v2)));
+            }
+            i12 = i12 + 1;
+        } while (i12 < 5);
+    }
+    v3 = (((v0 + v1) ? (45 > 23) : (92 - v2)) != ((v2 > v0) || (v1 + v2)));
+    return (((v3 * 73) % 7) / 7);
+}
+int f18() {
+    int v0 = 97;
+    int v1 = 51;
+    int v2 = 82;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                a1[0][10] = (((a1[2][13] && v0) + (i1 ? a0[6] : 85)) || ((a1[0][14] ? v3 : i0) * (a0[14] ? v3 : a1[3][6])));
+                v0 = (((v0 ? 99 : i1) - (v2 == 91)) + ((i1 || 61) % 3));
+                v1 = (((i1 > v0) >= (68 ? 20 : a1[2][4])) + ((a0[13] < i0) < (50 - 33)));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((v1 <= a0[10]) * (v0 <= 79)) + ((v2 ? a1[3][5] : v1) ? (68 * 20) : (v1 - i0)));
+        v2 = (((v2 < 20) && (a1[3][13] || 19)) >= ((v2 / 2) != (v0 == 49)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v2 = (((20 * a1[0][2]) || (v2 && a1[0][6])) + ((30 * v0) / 8));
+            v0 = (((v3 / 1) || (a0[10] ? v0 : i2)) + ((a0[1] ? v0 : v3) > (i2 == a1[1][9])));
+            {
+                int i3 = 0;
+                do {
+                    a0[7] = (((i3 % 6) * (10 < a0[15])) + ((i3 < v3) ? (69 - a1[1][7]) : (v1 || a0[9])));
+                    a0[9] = (((a0[15] % 3) * (v2 == 51)) % 4);
+                    v2 = (((a0[9] ? 32 : a1[2][10]) + (a1[2][9] ? v0 : a0[8])) < ((34 + a1[2][8]) * (i3 || a1[0][9])));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((i4 ? v2 : v2) > 88) break;
+            v2 = (((18 >= a1[3][15]) && (61 - v3)) || ((38 + a0[10]) <= (a0[14] < v1)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((a0[6] != 63) > 70) break;
+                    v2 = (((v0 / 3) ? (a1[2][7] && v0) : (94 <= v0)) ? ((v2 ? v3 : i5) >= (v2 >= v3)) : ((i4 / 3) <= (v3 / 1)));
+                    v0 = (((v2 ? a1[2][2] : i4) <= (a0[10] < v0)) || ((v2 && 9) || (i5 + 22)));
+                    v0 = (((v2 % 5) == (78 ? a0[3] : i4)) == ((v2 == v3) - (i5 + 70)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((i4 > 86) ? (90 >= v1) : (v2 ? 43 : v3)) ? ((7 % 1) < (a0[14] != 31)) : ((v1 == 29) || (i4 == a0[2])));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        a1[2][1] = (((v3 ? 18 : i6) > (78 < v3)) != ((v1 - a0[6]) != (70 > 64)));
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            v1 = (((v1 ? 26 : a0[14]) == (v1 > a0[10])) != ((v1 / 7) && (a0[4] == 86)));
+            v1 = (((v2 < a0[9]) && (a0[11] % 8)) || ((a1[1][6] * a1[0][0]) != (v1 && v1)));
+            v1 = (((90 + 30) + (a1[0][3] || i6)) + ((v1 == 48) >= (v2 + 10)));
+        }
+        v3 = (((v2 % 4) + (v2 % 5)) * ((v3 * v2) > (v1 - i6)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            v2 = (((v2 ? v2 : v1) ? (a1[0][0] / 8) : (v1 || 54)) % 8);
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((70 && a0[0]) / 8) && ((v1 / 6) || (i8 < 53)));
+                    v1 = (((a0[7] % 3) * (i9 >= v3)) * ((v0 >= v1) + (v0 || a0[11])));
+                    a1[1][15] = (((8 ? i9 : 86) || (v3 / 9)) + ((61 - v0) - (76 % 5)));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            a1[1][10] = (((v3 != a0[8]) / 4) + ((30 == v0) * (a0[5] * 78)));
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+                if ((v3 >= v3) > 58) break;
+                v0 = (((a0[12] ? v3 : v2) / 5) ? ((i10 >= v3) ? (51 ? a0[10] : a1[3][7]) : (v1 <= v3)) : ((v0 ? a0[11] : a1[3][3]) || (i10 + i11)));
+                v0 = (((i11 * v3) + (19 - v1)) > ((11 - 54) >= (v1 >= 98)));
+                v3 = (((21 || 7) > (i10 > a1[1][7])) / 1);
+            }
+            v1 = (((93 && a1[2][4]) || (93 || a1[3][10])) ? ((25 - v2) == (a0[1] > a0[11])) : ((v3 - v2) >= (28 >= a0[7])));
+            a1[2][11] = (((v0 != v1) ? (7 >= v1) : (73 ? i10 : a0[13])) ? ((v2 - 81) < (v2 != 63)) : ((a1[2][3] >= a0[0]) != (v3 <= a1[0][10])));
+            i10 = i10 + 1;
+        }
+    }
+    if ((((v2 / 7) >= (a1[1][11] == v0)) >= ((v0 + v3) == (99 % 3)))) {
+        a1[0][12] = (((a1[1][1] > v3) ? (a1[1][14] % 6) : (v3 != 11)) >= ((a0[11] % 6) + (v3 && v2)));
+        a1[1][0] = (((v0 > a0[11]) ? (v2 == 86) : (a1[0][10] + v3)) <= ((6 >= 59) || (v1 >= v3)));
+        a0[13] = (((37 * 25) + (a1[1][4] - v2)) + ((6 != v2) - (v2 == 49)));
+    } else {
+        v3 = (((v1 % 3) % 3) || ((23 == a1[1][6]) / 4));
+        v3 = (((v0 ? 25 : v3) % 4) * ((v3 + v2) > (25 ? a0[6] : a0[15])));
+        v1 = (((v1 == 25) >= (v2 % 3)) > ((a0[2] - v0) ? (v1 < 72) : (43 < v0)));
+    }
+    for (int i12 = 0; i12 < 7; i12 = i12 + 1) {
+        a1[1][15] = (((29 > 87) % 6) <= ((a0[7] <= a0[10]) > (v2 - v3)));
+        v0 = (((56 || 6) % 2) ? ((a1[2][4] >= i12) != (v3 ? a1[1][6] : a0[2])) : ((45 % 8) / 6));
+        for (int i13 = 0; i13 < 2; i13 = i13 + 1) {
+            v3 = (((42 % 9) <= (i13 ? v1 : 66)) / 8);
+            v0 = (((v3 * v3) ? (a1[0][8] / 7) : (a1[0][15] >= v1)) ? ((a0[11] ? 60 : v1) ? (84 && v0) : (a1[0][2] % 3)) : ((v2 / 5) - (27 ? a0[7] : a1[2][2])));
+            v2 = (((38 % 2) - (a1[0][8] * 61)) + ((i13 > v3) > (a0[14] > v1)));
+        }
+    }
+    for (int i14 = 0; i14 < 8; i14 = i14 + 1) {
+        a0[2] = (((61 + v0) <= (v0 - 69)) % 9);
+        {
+            int i15 = 0;
+            while (i15 < 3) {
+                a1[3][1] = (((v1 != v3) * (v3 ? i14 : 55)) && ((37 || i15) > (a0[9] % 4)));
+                a0[2] = (((i15 > 9) || (i15 ? 15 : v2)) >= ((v3 <= 8) == (a0[13] == v3)));
+                a0[8] = (((33 ? i14 : v2) / 4) && ((v1 - a1[3][12]) <= (v2 == a0[11])));
+                i15 = i15 + 1;
+            }
+        }
+        v0 = (((v1 == 42) <= (6 - 64)) != ((v3 && v0) >= (a0[12] + v1)));
+    }
+    {
+        int i16 = 0;
+        while (i16 < 6) {
+            if ((17 < v0) > 81) break;
+            v3 = (((i16 - v3) * (v3 > 46)) / 4);
+            {
+                int i17 = 0;
+                do {
+                    a0[5] = (((v1 + v0) != (65 ? v0 : 34)) - ((v3 >= 96) == (v1 * 18)));
+                    a0[4] = (((i16 % 3) > (46 ? 16 : v3)) > ((69 > i16) <= (89 * v3)));
+                    a0[1] = (((v2 == i16) < (v1 / 6)) + ((23 - a0[3]) % 7));
+                    i17 = i17 + 1;
+                } while (i17 < 5);
+            }
+            a1[2][2] = (((a0[4] ? v2 : a1[3][8]) / 4) * ((61 == a1[2][8]) ? (a1[1][14] - v0) : (a1[2][5] == v0)));
+            i16 = i16 + 1;
+        }
+    }
+    return (((a1[1][10] < v3) + (v1 ? v1 : a0[10])) > ((v1 != v3) != (5 != 23)));
+}
+int f19() {
+    int v0 = 46;
+    int v1 = 5;
+    int v2 = 75;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 != 4) - (v1 && 59)) < ((43 + v1) - (v1 ? v0 : v2)))) {
+        v1 = (((a0[15] < v1) * (v3 || v1)) && ((a1[3][9] > v2) - (a0[13] + a1[2][4])));
+        v0 = (((60 / 9) ? (v3 < v0) : (a0[10] && a1[2][0])) >= ((a1[3][6] < v3) > (a0[13] || 82)));
+        v3 = (((a1[1][7] - 54) <= (v2 - 3)) != ((25 != v1) ? (v2 * v2) : (13 - a1[2][3])));
+    } else {
+        v2 = (((10 > 41) || (v3 >= v3)) >= ((a0[1] + v3) ? (v2 ? v1 : v2) : (a1[1][3] - a1[2][5])));
+        v1 = (((81 != a1[1][10]) <= (27 > v2)) <= ((v3 + 71) && (a0[1] / 3)));
+        v2 = (((v3 || a0[5]) == (v3 && v0)) && ((v2 > v2) != (a1[2][5] - v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((v0 == a1[3][2]) > 74) break;
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v0 = (((v1 ? 53 : v3) == (i0 / 5)) == ((21 >= i0) || (40 ? i0 : v2)));
+                a0[14] = (((v1 + i1) ? (a1[3][3] / 1) : (i0 >= 94)) / 9);
+                v0 = (((v3 != 69) <= (v1 < i1)) * ((v1 <= a1[3][7]) / 5));
+            }
+            a1[1][1] = (((a0[0] ? a1[2][14] : 15) > (v0 > 20)) / 7);
+            a0[11] = (((v2 % 5) != (68 % 4)) ? ((v3 / 4) == (v2 + 73)) : ((v0 >= v1) > (a0[1] ? 62 : 46)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            {
+                int i3 = 0;
+                do {
+                    if ((76 ? a1[1][6] : i3) > 72) break;
+                    v2 = (((i2 - v1) % 5) * ((a1[2][8] + v2) - (62 ? v2 : a1[1][5])));
+                    a1[3][0] = (((82 && 61) ? (v0 ? v1 : v2) : (8 || v1)) <= ((a1[1][10] * v0) || (24 ? 28 : a0[8])));
+                    a1[2][9] = (((42 % 6) ? (v0 && 15) : (i3 * 24)) - ((v1 == 72) < (v3 == i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v0 = (((92 + v1) && (v3 <= 83)) < ((v3 <= 31) <= (a1[1][1] != a1[2][5])));
+            a0[11] = (((i2 / 3) && (v1 >= a1[1][5])) <= ((54 + v2) > (v1 - v0)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[3][15] ? v1 : a0[11]) && (a0[10] % 6)) < ((a0[1] != a0[8]) != (a0[2] * v0)))) {
+        v0 = (((v0 + 63) == (a1[0][14] > v3)) != ((a1[3][8] % 5) != (69 ? a1[3][10] : 28)));
+        v0 = (((a0[12] == 21) * (v2 / 2)) % 6);
+        v0 = (((80 - 82) * (49 >= a0[12])) >= ((8 && v0) < (51 || v2)));
+    } else {
+        a0[8] = (((v0 || v0) * (93 <= v2)) != ((a1[2][0] == v1) <= (a1[1][11] < a0[15])));
+        v1 = (((13 && v2) <= (v0 && v3)) / 9);
+        a1[2][9] = (((v0 + 99) < (a1[2][4] != v1)) <= ((v0 / 6) || (v0 - v1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a1[2][10] % 4) > 59) break;
+            v2 = (((a1[0][9] > 90) != (21 == v0)) - ((16 / 6) ? (a0[9] || v2) : (v0 % 3)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                a1[3][8] = (((a1[0][9] <= v0) <= (a0[8] < 41)) <= ((v1 / 1) <= (v2 > a0[11])));
+                v1 = (((31 - a0[8]) >= (v1 >= a0[8])) % 2);
+                v0 = (((a0[12] != i4) - (v0 < i5)) ? ((94 > a1[0][9]) > (a1[3][14] * v2)) : ((70 * v0) && (99 || a0[9])));
+            }
+            v3 = (((39 >= 43) + (v2 ? v3 : i4)) < ((96 * a0[13]) != (63 % 4)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    if ((((a0[6] / 1) % 8) != ((a0[8] == v2) < (v2 < a0[4])))) {
+        v2 = (((49 ? v1 : v3) < (87 != a0[7])) / 3);
+        v0 = (((v2 >= v1) ? (64 || v2) : (v0 ? a0[3] : a1[1][2])) > ((v1 / 7) - (v0 > 79)));
+        v2 = (((11 >= 32) ? (a0[1] && v3) : (41 > v1)) && ((94 * a1[3][12]) != (v2 == v2)));
+    } else {
+        v0 = (((61 > v2) - (63 / 8)) + ((v0 || a1[2][9]) != (a0[3] != 33)));
+        a0[8] = (((10 - v3) || (v0 % 8)) <= ((v3 - 68) <= (v2 && v3)));
+        v0 = (((v2 - 16) < (78 ? a0[9] : a1[3][12])) > ((v2 % 9) ? (30 / 7) : (v2 || 9)));
+    }
+    v0 = (((v1 * v2) || (v3 % 5)) != ((v3 != v3) >= (v1 + v0)));
+    {
+        int i6 = 0;
+        do {
+            a0[11] = (((2 / 4) * (a0[11] / 2)) < ((i6 != i6) + (a1[0][4] / 2)));
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    v2 = (((v1 > a0[1]) % 6) < ((v1 > 52) && (v1 ? a0[15] : v3)));
+                    a0[9] = (((i6 || v3) + (v0 < v3)) % 2);
+                    a0[2] = (((a0[11] / 3) == (19 * a0[15])) + ((v0 == 24) || (v1 <= v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((51 - 70) ? (v0 && a1[3][11]) : (a0[6] && 0)) < ((69 || a0[5]) > (a0[3] % 2)));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[3][4] = (((v1 - v2) ? (v0 <= a0[0]) : (v1 > v2)) != ((a0[2] % 8) * (v0 || v1)));
+            v0 = (((i8 - a0[12]) && (90 && 23)) == ((a0[10] % 1) == (v3 / 3)));
+            {
+                int i9 = 0;
+                do {
+                    a1[2][5] = (((v1 != v1) - (i8 ? a1[1][11] : a0[1])) <= ((a1[0][4] < i8) >= (a1[2][0] >= 54)));
+                    v3 = (((89 < v3) == (v1 || i9)) > ((v3 >= 80) != (a1[2][3] ? v0 : 37)));
+                    v0 = (((v2 != v3) <= (75 <= a0[5])) * ((v1 < a0[0]) > (v0 / 3)));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 5) {
+            v2 = (((v2 || v0) + (98 + v2)) <= ((a1[2][14] == v0) * (a1[2][11] - a0[8])));
+            v1 = (((a0[8] / 4) && (i10 < i10)) || ((v1 <= 38) > (v3 ? v3 : 49)));
+            for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+                v1 = (((v1 != 29) * (v0 <= v3)) < ((v2 <= i11) > (i10 / 5)));
+                a0[8] = (((a0[15] / 6) + (v3 > a1[0][4])) >= ((v1 || i11) > (i11 + v0)));
+                a0[9] = (((v1 / 1) % 1) || ((i11 < 14) >= (a0[9] < a0[12])));
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((v2 * 26) % 4) != ((a1[1][10] / 5) && (a1[3][13] / 7)));
+}
+int f20() {
+    int v0 = 26;
+    int v1 = 44;
+    int v2 = 98;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v2 = (((v0 <= a0[8]) >= (a1[2][6] % 9)) <= ((v2 != v2) ? (v0 < 92) : (a1[3][13] != v1)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a0[4] = (((a1[1][0] != a1[0][3]) && (v3 % 3)) && ((57 || 53) == (v2 <= 28)));
+                    v3 = (((i0 && a1[1][11]) ? (v2 * a0[8]) : (42 + 84)) > ((a1[2][15] >= 97) + (a1[3][5] && 43)));
+                    v1 = (((42 ? i0 : i0) - (a1[3][5] < 34)) && ((v0 + a0[7]) || (v2 != i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v0 / 8) != (a0[4] <= v2)) - ((36 <= a0[6]) ? (v0 <= v3) : (v3 % 5)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((i2 ? v2 : 18) ? (i2 >= a0[2]) : (a1[0][15] + v1)) * ((92 == v1) % 3));
+            v2 = (((a0[10] / 6) / 3) >= ((v2 && v1) ? (a0[3] != 23) : (46 > v0)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((i2 == v1) - (a1[0][8] || a1[3][12])) > ((6 < v0) || (26 && v0)));
+                    v0 = (((v2 + a0[14]) >= (v0 ? a1[2][11] : v2)) % 9);
+                    a1[0][5] = (((a1[1][1] / 3) >= (v3 - 54)) == ((i3 >= v2) >= (v3 / 2)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v3 = (((a0[15] == a0[13]) ? (91 == v1) : (22 == a0[15])) == ((v2 - a1[1][4]) + (v3 + a0[0])));
+        v2 = (((a0[5] <= a1[2][10]) != (v0 * a0[12])) + ((52 != 47) - (v0 > v2)));
+        {
+            int i5 = 0;
+            while (i5 < 8) {
+                v1 = (((i5 == 11) * (75 % 4)) ? ((a0[15] ? i4 : v3) >= (1 > 34)) : ((i5 != 74) <= (v2 > 53)));
+                v1 = (((i5 + 11) ? (27 * 70) : (v0 ? a1[1][7] : v1)) % 4);
+                v0 = (((v0 - i5) % 1) && ((i5 || a0[10]) % 5));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    if ((((49 ? a1[0][12] : a0[10]) + (49 != v2)) - ((v1 <= a0[14]) || (a1[2][4] != a1[1][1])))) {
+        v0 = (((v3 >= v2) + (v0 == v0)) ? ((v1 * 51) != (v2 >= v0)) : ((a0[7] <= v1) / 2));
+        v0 = (((a1[2][6] % 3) == (89 > v0)) - ((v2 ? a1[1][2] : a0[1]) || (v1 / 6)));
+        a0[0] = (((v0 + v3) >= (98 < a1[0][0])) || ((16 * 72) + (v0 != v1)));
+    } else {
+        v3 = (((v3 >= v2) % 1) >= ((v0 <= v3) == (v1 >= v3)));
+        v3 = (((v0 <= a0[2]) > (v2 < a0[3])) * ((a1[2][11] || a1[3][13]) / 5));
+        a1[0][11] = (((a1[0][15] - 22) <= (a0[8] + v3)) < ((v2 / 8) < (v0 / 1)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((v2 > a0[8]) != (v3 * v2)) % 1);
+            v2 = (((28 % 4) < (67 - a0[14])) / 2);
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v2 = (((50 != v1) - (50 == v1)) - ((v0 ? a0[3] : v1) != (i7 && v1)));
+                v1 = (((a1[1][8] / 6) == (64 % 6)) / 4);
+                a1[2][5] = (((24 == a0[11]) % 1) <= ((a1[1][3] && 70) && (v0 == 72)));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((a1[1][10] * v3) > 51) break;
+            {
+                int i9 = 0;
+                do {
+                    v0 = (((i9 > i8) > (82 || a1[1][14])) + ((19 > a0[5]) != (v2 / 1)));
+                    v1 = (((51 < a1[1][4]) != (a1[0][0] - a1[1][7])) / 3);
+                    v2 = (((0 ? a1[1][9] : 11) != (v0 > v3)) == ((95 > 92) < (84 < a1[3][0])));
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            v3 = (((v0 ? a0[6] : v1) && (i8 < a0[6])) > ((v0 < v2) / 7));
+            v3 = (((75 * v1) != (87 - a0[3])) % 8);
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    v0 = (((v0 != a0[13]) || (v2 < 99)) && ((v0 && 47) / 5));
+    a0[10] = (((v3 * a1[0][8]) != (v0 - a1[3][4])) <= ((v3 <= a0[0]) < (v1 >= v2)));
+    if ((((v2 - 6) ? (a1[0][1] <= a1[2][8]) : (v3 / 8)) < ((v1 ? a0[7] : a0[3]) <= (66 <= 67)))) {
+        a1[1][1] = (((97 * 98) * (v1 != v3)) || ((73 > v1) == (69 / 3)));
+        a0[9] = (((a1[3][1] < v0) < (45 == 98)) == ((v3 ? v0 : v2) <= (41 / 4)));
+        v2 = (((29 + 13) && (v2 <= a1[0][3])) / 4);
+    } else {
+        a0[15] = (((7 > v0) ? (v1 || a0[9]) : (v2 - a0[10])) ? ((a1[0][10] / 8) == (a1[0][10] || a1[3][9])) : ((91 ? 21 : a0[6]) - (a0[0] ? v1 : a0[6])));
+        v0 = (((v0 / 5) + (v2 < a1[2][0])) - ((v1 + a0[0]) % 3));
+        v3 = (((v1 % 8) % 2) > ((v2 / 7) == (v1 - v2)));
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        {
+            int i11 = 0;
+            while (i11 < 8) {
+                v0 = (((a1[2][14] <= 37) == (75 % 9)) || ((i11 >= i10) % 4));
+                v0 = (((v3 % 4) != (a0[8] % 2)) <= ((4 ? a0[5] : v3) > (v3 % 1)));
+                a0[11] = (((v3 ? a0[1] : 13) > (i10 && 91)) ? ((v3 ? 93 : i10) % 5) : ((v0 >= v1) > (50 - v0)));
+                i11 = i11 + 1;
+            }
+        }
+        v3 = (((99 <= i10) <= (a1[2][6] != a1[0][12])) / 2);
+        v1 = (((v0 % 3) - (v0 ? i10 : 31)) != ((v0 * i10) && (i10 % 3)));
+    }
+    return (((a1[2][9] / 1) >= (v3 || a1[0][5])) || ((v0 < v1) >= (a1[1][9] > v1)));
+}
+int f21() {
+    int v0 = 56;
+    int v1 = 13;
+    int v2 = 54;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    a0[1] = (((v2 > v1) < (94 + v0)) != ((v1 != v3) || (a1[2][5] && v2)));
+    if ((((v1 - v3) % 7) || ((a0[5] - a0[1]) != (v1 < a0[2])))) {
+        a0[14] = (((29 + v2) / 4) <= ((66 % 3) * (v3 / 7)));
+        v3 = (((35 ? 10 : v2) - (20 > 82)) - ((v3 <= 93) >= (v0 != v0)));
+        v2 = (((a0[11] * a1[0][13]) * (7 / 6)) * ((v0 - a0[1]) || (v0 > 81)));
+    } else {
+        v0 = (((v1 >= v0) ? (a1[1][13] < a0[15]) : (v1 > v0)) % 6);
+        v2 = (((v3 == v0) < (v1 - v0)) <= ((a1[2][14] > v1) * (a0[3] < 18)));
+        v2 = (((v0 / 1) != (v3 <= a0[8])) != ((19 ? 61 : v3) ? (23 - 34) : (11 || a0[10])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((38 <= i0) > 96) break;
+            v0 = (((v1 || i0) ? (v1 > v3) : (v2 % 4)) ? ((i0 * v0) ? (v1 ? a0[11] : a0[10]) : (v0 > 88)) : ((a1[2][2] != v0) == (81 < a1[3][6])));
+            v0 = (((v2 != v0) != (a1[3][4] != i0)) >= ((v1 + v1) + (v0 ? a1[2][8] : i0)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v3 = (((v2 * v2) / 7) < ((a1[3][6] + a1[0][13]) % 1));
+                    v1 = (((i0 + a0[12]) != (56 || v1)) < ((v1 ? 66 : 93) || (v1 ? i1 : a0[9])));
+                    v2 = (((38 + 89) % 5) != ((v3 && i1) - (a1[3][10] * a1[1][11])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 == a1[0][14]) == (40 % 8)) < ((46 < 67) ? (a1[2][5] / 6) : (v2 <= v0)))) {
+        v1 = (((58 != v1) + (95 && v3)) == ((79 ? 97 : v1) < (54 ? a1[2][9] : v2)));
+        v2 = (((80 % 9) * (v2 ? v0 : v0)) >= ((v1 <= 75) != (a0[14] == 90)));
+        v2 = (((a0[1] || v2) ? (v1 > 1) : (v2 != 52)) ? ((v2 % 1) ? (v2 == 45) : (v2 == 85)) : ((69 == a1[1][11]) ? (60 ? v2 : a0[11]) : (v0 ? v3 : v2)));
+    } else {
+        a1[3][8] = (((a0[12] && a1[3][4]) != (v0 * v0)) == ((v0 >= a1[3][9]) == (v2 > a0[8])));
+        v0 = (((95 < v3) || (a1[2][12] < a1[3][15])) / 3);
+        v3 = (((a1[3][15] > 49) - (v1 < v3)) > ((v2 % 9) >= (v2 ? a0[11] : a1[3][14])));
+    }
+    if ((((v0 ? v0 : a0[15]) ? (a0[7] <= v0) : (v3 == v2)) >= ((a1[0][13] % 7) || (v1 + a0[2])))) {
+        a1[2][5] = (((49 % 2) * (v0 <= 7)) ? ((54 == 39) / 4) : ((v1 <= a0[12]) ? (34 * 1) : (v3 ? v3 : v0)));
+        a1[3][8] = (((30 - 44) > (v3 || a0[4])) == ((67 == a0[3]) * (a1[0][7] ? v1 : v0)));
+        v3 = (((v3 <= 91) < (v0 ? a1[3][0] : v0)) >= ((v3 ? v1 : 15) / 8));
+    } else {
+        v3 = (((v0 / 2) || (44 <= v1)) < ((a0[11] + a1[2][3]) ? (v1 > v2) : (v3 && a0[11])));
+        v0 = (((v1 && a1[0][4]) > (v2 ? 42 : v2)) * ((60 + 23) > (v2 - v0)));
+        a0[0] = (((v3 && a0[15]) ? (a1[2][2] + 41) : (v2 && v2)) < ((91 % 3) * (a0[15] > v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[1] = (((a1[2][3] ? v3 : 89) || (v2 || i2)) <= ((a0[8] || v1) && (v1 ? 61 : v3)));
+            v1 = (((a1[2][13] != 77) ? (v1 != 86) : (i2 * v2)) || ((v2 - v0) ? (a0[6] ? 2 : v0) : (a0[12] % 1)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((45 && i2) || (46 % 2)) ? ((12 ? v0 : 13) && (97 % 2)) : ((v3 < v3) * (30 / 8)));
+                    a1[0][10] = (((i3 != v1) || (v1 != a1[3][12])) * ((v0 >= v3) && (a0[0] - a1[0][15])));
+                    v3 = (((a1[3][9] ? 13 : 81) * (v1 / 5)) <= ((i3 && i3) ? (a1[3][0] ? a1[0][13] : i3) : (a0[15] && a0[3])));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            v1 = (((i5 != 95) ? (a1[2][0] ? 6 : v3) : (v1 > 21)) != ((30 - a1[1][2]) <= (v3 <= a0[14])));
+            v3 = (((a1[3][10] - a0[15]) ? (v3 - v1) : (i5 ? i4 : a1[3][3])) * ((v1 || v1) ? (a1[2][13] ? a0[12] : 44) : (46 >= v3)));
+            v1 = (((a1[3][9] + a1[0][10]) + (v2 * 88)) >= ((i4 + v0) - (v1 && i5)));
+        }
+        v1 = (((10 <= a0[9]) % 4) + ((v2 > i4) % 9));
+        v0 = (((43 ? v3 : v1) + (v2 != 49)) && ((19 > 54) ? (81 * v1) : (v2 * 8)));
+    }
+    if ((((a0[8] ? v1 : v3) ? (38 && v2) : (v3 < 67)) && ((v0 < v0) && (18 || v3)))) {
+        v3 = (((a0[7] <= a1[2][10]) < (a1[3][14] <= v2)) < ((v1 < v1) > (a0[9] ? 12 : a1[1][8])));
+        a1[2][3] = (((81 ? 71 : v2) < (a1[3][5] * 75)) * ((v1 > v1) && (v1 ? v1 : a0[13])));
+        v1 = (((a0[11] < 29) != (94 ? 12 : 5)) / 9);
+    } else {
+        v3 = (((a1[3][1] / 4) / 9) && ((v2 > 82) ? (v3 / 6) : (52 % 4)));
+        v0 = (((v3 >= a0[12]) != (12 == v0)) <= ((a1[1][4] / 4) || (22 - v0)));
+        v2 = (((v1 != a1[0][6]) == (v3 / 8)) - ((v2 == 92) == (v0 ? 59 : v1)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[1][9] = (((v2 + 37) / 2) == ((v3 % 2) + (v0 <= v1)));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v0 = (((v1 || v1) || (v0 ? a1[1][1] : v2)) >= ((a1[0][9] * v3) && (v2 <= 33)));
+                v0 = (((v2 + 51) > (v1 >= 18)) * ((i6 - 13) || (v3 != a1[2][6])));
+                a1[2][4] = (((i6 >= 33) - (v2 - i7)) * ((i7 - a1[0][8]) >= (i7 ? 1 : a1[3][7])));
+            }
+            v1 = (((v2 && i6) != (v2 / 7)) / 3);
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    if ((((a0[5] == 86) < (v2 * v1)) <= ((v1 || a1[2][3]) % 2))) {
+        a0[9] = (((a0[1] == v3) < (v3 <= v2)) / 2);
+        v2 = (((a0[6] - 13) <= (v3 < v0)) <= ((v3 > 62) == (75 != 71)));
+        a1[0][10] = (((v0 != v2) <= (a0[11] % 9)) ? ((v1 / 5) || (v2 < a1[3][10])) : ((v3 + v2) >= (a0[6] != a0[5])));
+    } else {
+        a1[2][14] = (((v3 % 8) * (v3 && a0[10])) + ((a0[12] + v3) < (v1 <= v1)));
+        v3 = (((v0 <= 58) + (v0 || 94)) != ((a1[2][1] < v2) >= (14 > 84)));
+        v3 = (((87 == a0[14]) % 4) ? ((v1 - 46) % 7) : ((63 > a1[2][9]) + (v2 - a1[1][4])));
+    }
+    return (((a1[1][5] * v1) >= (a0[10] / 7)) != ((v0 * v1) || (a0[12] < v1)));
+}
+int f22() {
+    int v0 = 54;
+    int v1 = 54;
+    int v2 = 89;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((v2 % 2) > 78) break;
+            a1[2][10] = (((v0 == v3) || (a0[14] % 8)) - ((v3 ? v2 : a0[13]) || (v1 >= a1[0][15])));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((a1[0][15] && 41) > 51) break;
+                    v0 = (((44 / 9) * (a1[1][15] >= 75)) % 8);
+                    v2 = (((a1[0][10] <= v0) > (a1[1][10] + v3)) - ((v0 && v2) ? (61 || v2) : (i1 >= v2)));
+                    a1[3][9] = (((v1 && i1) > (65 != v3)) ? ((v1 ? v1 : v0) / 1) : ((i0 ? i1 : i1) - (75 >= v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][6] = (((v3 > i0) || (a0[7] < a1[3][2])) - ((v0 + v1) - (95 * 22)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                do {
+                    a0[12] = (((28 || i3) * (17 >= a0[0])) / 1);
+                    v0 = (((a1[2][0] / 3) < (a1[1][8] + v0)) > ((v1 / 8) * (v1 == v0)));
+                    a0[6] = (((v3 < 12) != (v1 && 10)) ? ((v3 || v0) || (v0 - 3)) : ((v0 != i3) - (78 ? v0 : i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v3 = (((58 && i2) || (58 ? v1 : 35)) * ((43 || 66) && (69 * v2)));
+            v2 = (((17 - v1) || (8 <= a1[3][14])) && ((v2 != i2) + (v0 != v3)));
+            i2 = i2 + 1;
+        }
+    }
+    a1[2][7] = (((91 + v1) >= (v2 || 73)) <= ((55 ? a1[0][9] : v1) ? (v0 > 83) : (v2 + v1)));
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v2 = (((82 ? v2 : v3) / 1) / 2);
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            a0[13] = (((i4 != v0) + (33 ? i4 : v0)) > ((a0[5] / 3) == (i4 || 2)));
+            v1 = (((v2 > 86) != (i5 ? i5 : v1)) < ((v2 != v1) ? (a0[1] / 6) : (v2 != i5)));
+            a0[5] = (((i4 == 51) ? (v2 + v0) : (35 != i5)) != ((31 * v2) <= (v2 ? 81 : a0[7])));
+        }
+        v0 = (((53 <= a0[7]) - (v2 || 0)) && ((v1 / 4) ? (a1[3][1] ? a0[12] : 56) : (a0[4] - v1)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((v1 / 8) > 59) break;
+            v2 = (((v1 <= v0) != (v2 * a1[3][5])) < ((a0[7] && 19) && (v0 / 6)));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                a0[14] = (((v0 || a0[14]) % 1) < ((i6 % 1) && (v1 / 1)));
+                a0[8] = (((40 >= a1[3][1]) + (i7 <= i7)) / 1);
+                v0 = (((33 ? v1 : a0[7]) >= (48 + v2)) + ((v2 < i7) >= (33 && 45)));
+            }
+            a0[8] = (((a1[3][4] % 1) > (v3 != v1)) == ((i6 == i6) >= (a0[6] || 74)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    a0[0] = (((90 * a1[0][5]) < (v1 > 59)) * ((a1[0][0] / 4) > (i9 != i8)));
+                    v0 = (((a1[2][14] ? 24 : a0[2]) - (19 <= a0[3])) * ((i8 ? i8 : i9) != (i8 > i9)));
+                    v0 = (((a1[1][4] || v2) || (i9 > v0)) >= ((a1[3][8] > v2) >= (v0 || v1)));
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            a0[9] = (((v1 - i8) || (v3 / 9)) % 6);
+            v2 = (((a1[1][2] % 8) && (v0 || a1[0][3])) || ((58 + v1) ? (a1[0][9] ? 95 : v1) : (v3 <= 22)));
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        if ((48 % 4) > 87) break;
+        {
+            int i11 = 0;
+            do {
+                if ((a1[2][6] + v0) > 68) break;
+                v2 = (((i11 * v0) - (v0 * v3)) >= ((a0[8] * a0[9]) >= (v1 == i10)));
+                a0[5] = (((a0[14] || a0[15]) - (52 - 45)) ? ((44 / 7) / 6) : ((31 > v2) <= (v2 > a1[1][3])));
+                a1[1][4] = (((a1[2][10] || v2) <= (58 / 7)) / 3);
+                i11 = i11 + 1;
+            } while (i11 < 8);
+        }
+        v0 = (((v0 ? v3 : v3) && (38 == i10)) <= ((v3 <= 82) * (v3 - a1[2][12])));
+        v0 = (((v2 >= v1) ? (a1[0][12] / 2) : (a0[10] < 86)) > ((i10 ? v1 : v2) - (79 >= 40)));
+    }
+    {
+        int i12 = 0;
+        do {
+            v1 = (((v0 > v0) >= (a1[2][14] / 7)) - ((v3 == v2) ? (v1 - a1[2][0]) : (v3 < i12)));
+            v2 = (((69 ? v1 : v3) > (i12 ? v1 : a1[0][11])) / 2);
+            {
+                int i13 = 0;
+                do {
+                    if ((v0 % 7) > 91) break;
+                    a0[5] = (((v3 > 39) ? (a1[3][9] || v1) : (a0[6] % 1)) % 7);
+                    a1[1][7] = (((a0[1] / 1) + (v3 < 41)) < ((i13 ? 2 : v1) ? (61 <= i13) : (v1 == v2)));
+                    a1[2][2] = (((v1 && 2) % 9) > ((v2 - 4) && (a1[1][3] / 1)));
+                    i13 = i13 + 1;
+                } while (i13 < 8);
+            }
+            i12 = i12 + 1;
+        } while (i12 < 3);
+    }
+    if ((((54 - v3) == (v3 <= v0)) + ((v0 < v3) <= (v0 || a0[9])))) {
+        a1[1][5] = (((51 && v0) + (v3 || v0)) - ((v2 <= a1[1][5]) >= (v2 != v1)));
+        a1[3][1] = (((v3 * 87) < (v2 < v0)) <= ((v2 || v3) != (a1[1][3] && 27)));
+        a0[0] = (((75 < 26) < (3 / 1)) > ((v0 / 9) >= (75 % 4)));
+    } else {
+        v2 = (((96 + v1) <= (v3 != v1)) && ((a1[1][1] * v3) && (a0[11] * 55)));
+        v3 = (((v0 && v1) + (v1 ? v3 : v0)) || ((a1[0][9] % 3) != (40 >= a0[8])));
+        v2 = (((v3 <= v1) || (80 < v1)) >= ((v2 != 3) < (a1[0][0] ? a0[0] : a1[1][1])));
+    }
+    for (int i14 = 0; i14 < 4; i14 = i14 + 1) {
+        v2 = (((a0[3] + a1[1][9]) + (a1[2][9] == a0[3])) > ((a1[1][13] <= i14) ? (a1[3][9] || 2) : (v1 && a1[3][12])));
+        {
+            int i15 = 0;
+            while (i15 < 7) {
+                v0 = (((a1[2][11] % 8) == (i15 + a0[3])) && ((a1[2][12] >= i14) > (v0 / 9)));
+                v0 = (((64 ? 56 : 82) ? (v3 % 1) : (v2 ? i15 : i15)) ? ((v3 / 6) == (14 > a0[13])) : ((v2 + i15) > (21 <= v2)));
+                a1[3][8] = (((v3 / 3) ? (a1[3][11] + i15) : (a1[1][4] && v3)) ? ((v1 * a1[0][7]) > (57 != a0[7])) : ((i15 - i15) && (v2 / 7)));
+                i15 = i15 + 1;
+            }
+        }
+        v0 = (((v2 < i14) > (68 / 1)) + ((v3 == 80) < (a0[8] + 13)));
+    }
+    return (((55 ? v0 : v0) + (a0[11] < v1)) == ((v3 != v1) - (v2 - v0)));
+}
+int f23() {
+    int v0 = 87;
+    int v1 = 78;
+    int v2 = 84;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[2][8] = (((38 >= a0[11]) != (v3 ? a1[0][9] : 54)) == ((v1 * i0) + (18 * v0)));
+                    v0 = (((v2 || i1) / 2) > ((v3 + v3) <= (v1 + 18)));
+                    v3 = (((v3 < v2) ? (15 || i1) : (6 <= a1[1][2])) && ((v1 % 9) + (36 / 1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[9] = (((v3 > i0) / 3) || ((v1 || 11) * (v3 - a1[0][15])));
+            v0 = (((v3 <= a1[3][8]) >= (v0 <= v0)) % 7);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 + v0) - (v2 ? v2 : v2)) + ((a0[13] < a0[2]) - (32 <= a0[4])))) {
+        v3 = (((a0[7] != a0[14]) ? (v3 > 97) : (a0[10] < 16)) || ((v3 && 6) == (v1 > a0[7])));
+        v1 = (((a1[2][9] > a0[8]) * (a1[2][15] + a1[3][1])) != ((87 * v1) - (v3 <= v0)));
+        v2 = (((a1[0][3] || v3) > (v0 ? v2 : a1[3][5])) || ((6 >= v0) == (v0 * 96)));
+    } else {
+        a1[2][5] = (((v1 * v2) || (59 >= v2)) ? ((a0[8] + v1) + (a1[0][3] - a1[0][9])) : ((86 >= v1) + (a1[1][3] >= 50)));
+        v2 = (((v0 && a0[15]) <= (a0[1] >= a1[0][14])) || ((38 || v1) && (v1 || a0[0])));
+        a1[1][13] = (((v1 ? a0[10] : v1) + (v2 ? v0 : v0)) || ((a1[3][6] && a1[3][11]) && (v0 % 2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v1 = (((v1 / 9) < (v2 >= 59)) * ((v1 ? 82 : i2) / 9));
+            a1[3][13] = (((60 > 53) >= (a0[7] - 39)) * ((a0[6] % 7) != (v0 && a0[13])));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                a1[1][3] = (((v0 ? a1[3][11] : 8) ? (v3 >= 59) : (i3 < 45)) % 8);
+                v0 = (((0 || 7) / 2) < ((v2 ? v3 : 48) % 2));
+                v1 = (((a1[0][4] < v0) * (a0[7] && v1)) - ((a1[2][4] > a1[1][9]) != (84 ? a1[2][0] : a0[0])));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((v0 <= a0[5]) == (78 >= v0)) ? ((a1[0][4] ? v2 : v0) <= (70 && a1[3][10])) : ((v0 < a0[2]) / 9));
+    {
+        int i4 = 0;
+        do {
+            if ((v3 && a1[2][15]) > 94) break;
+            {
+                int i5 = 0;
+                do {
+                    a0[4] = (((i4 ? a0[11] : i5) % 3) ? ((53 == a0[2]) < (66 < a1[3][11])) : ((v1 || a0[3]) ? (a1[2][11] || a1[1][7]) : (v2 || 42)));
+                    v2 = (((i5 == v2) % 6) == ((v3 && v3) <= (i4 - v3)));
+                    v2 = (((7 < 49) % 8) == ((v1 || v1) != (a0[9] * a0[10])));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            a0[13] = (((v1 - a1[0][8]) - (v3 / 8)) ? ((v0 ? v2 : 49) / 4) : ((a0[11] - 61) + (v0 == v0)));
+            v1 = (((75 != 96) == (a0[11] ? 78 : v0)) != ((a1[3][9] ? 79 : a1[3][14]) % 8));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v2 = (((v0 ? i6 : a1[1][14]) - (46 < 15)) == ((i7 < i6) <= (a0[1] != v3)));
+                v1 = (((v3 ? v1 : v3) - (v2 + a1[2][3])) + ((v1 ? v1 : a0[5]) || (a1[3][6] || a1[3][6])));
+                v2 = (((v1 < 43) * (v3 <= v1)) > ((v2 && 51) % 2));
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        v0 = (((v1 && v1) % 9) != ((a0[12] >= 25) - (i6 < v1)));
+        a1[3][2] = (((7 || 29) + (v0 / 2)) / 4);
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        if ((76 < v2) > 53) break;
+        a1[2][6] = (((14 < a1[1][2]) < (v2 <= a0[8])) == ((v1 != 54) >= (a0[12] < a1[2][7])));
+        for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+            v1 = (((a0[6] - a0[2]) / 2) - ((59 <= a0[5]) <= (v3 < 8)));
+            v0 = (((a0[13] >= i8) / 6) * ((99 / 9) >= (i9 * 90)));
+            v1 = (((a0[13] ? a0[12] : 98) <= (a1[1][13] ? i9 : 56)) <= ((i8 < a1[1][5]) ? (i9 || v3) : (i8 && v3)));
+        }
+        v2 = (((v2 ? i8 : v1) != (34 || v2)) >= ((v0 > v1) < (i8 ? v1 : v3)));
+    }
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+            v1 = (((19 * 56) < (v2 % 2)) % 3);
+            v3 = (((i11 ? 37 : i10) == (15 && v1)) % 3);
+            v1 = (((92 ? i10 : v2) < (a0[4] && 11)) && ((a0[5] >= i11) < (v2 - i11)));
+        }
+        v1 = (((48 * v1) * (a1[0][5] != a0[12])) || ((a1[0][0] < v0) != (v0 / 9)));
+        v1 = (((a0[13] < i10) || (v1 * a1[1][11])) || ((i10 < 29) ? (45 < a0[0]) : (55 != i10)));
+    }
+    if ((((v3 + v2) == (v3 <= v0)) / 7)) {
+        v3 = (((v3 && 5) + (v1 > v1)) > ((v0 >= v2) == (v0 && a0[0])));
+        a1[3][5] = (((v1 * 92) && (v1 - v1)) >= ((a0[5] || a0[14]) || (v3 > a1[1][8])));
+        a1[3][15] = (((v0 / 3) + (a1[2][1] * 60)) >= ((17 >= v1) && (a1[0][1] / 7)));
+    } else {
+        v2 = (((41 * v2) != (v0 >= v1)) + ((a1[0][6] / 6) ? (v1 >= v0) : (30 < v2)));
+        a0[6] = (((v1 + v3) || (v3 % 7)) && ((73 && v1) && (v3 + 32)));
+        v1 = (((a1[2][15] || a1[2][13]) - (60 == 62)) != ((v1 - v0) >= (v1 || v2)));
+    }
+    {
+        int i12 = 0;
+        do {
+            {
+                int i13 = 0;
+                do {
+                    v3 = (((v2 / 7) < (9 != 71)) == ((v1 >= a1[0][3]) || (a1[2][0] <= a1[3][9])));
+                    a1[2][5] = (((v1 <= 67) == (84 % 6)) <= ((v2 != v2) == (23 && a1[1][11])));
+                    a0[7] = (((v3 || a1[1][1]) + (v1 || a1[1][3])) + ((a1[0][12] == 86) * (a0[7] + 69)));
+                    i13 = i13 + 1;
+                } while (i13 < 4);
+            }
+            v2 = (((v0 ? v3 : a1[0][15]) ? (a1[3][3] >= 52) : (v0 == i12)) != ((20 * i12) / 3));
+            a1[2][6] = (((a0[11] - 26) ? (v1 % 4) : (a1[1][9] / 6)) * ((v3 ? a1[2][10] : a0[14]) && (v1 < v3)));
+            i12 = i12 + 1;
+        } while (i12 < 8);
+    }
+    return (((v0 * a1[0][13]) + (a1[0][13] + v2)) > ((v3 > v2) ? (v1 - v0) : (45 < a1[3][5])));
+}
+int f24() {
+    int v0 = 66;
+    int v1 = 38;
+    int v2 = 9;
+    int v3 = 94;
+    int a0[16];
+    int a1[4][16];
+    a0[6] = (((v2 / 6) || (a1[0][3] * v3)) % 6);
+    v0 = (((a1[3][0] >= v1) % 3) / 5);
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v0 = (((39 >= a1[0][3]) || (v1 > a0[5])) != ((v2 && 55) || (80 * v0)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                if ((v3 + a0[15]) > 79) break;
+                v1 = (((a1[3][11] != v2) - (v3 > 40)) >= ((a0[11] * a1[1][11]) % 6));
+                v0 = (((i0 + v0) ? (v1 / 8) : (v3 > a0[7])) ? ((v0 >= v2) || (v3 != v1)) : ((v1 < a0[3]) - (v3 % 5)));
+                v2 = (((17 <= 44) < (v2 + v0)) + ((66 % 3) + (a0[15] >= a1[1][5])));
+                i1 = i1 + 1;
+            }
+        }
+        a0[3] = (((v2 || i0) >= (a1[3][12] != v1)) * ((v1 < 7) != (17 || i0)));
+    }
+    v1 = (((v3 ? v2 : v3) || (v2 / 5)) / 8);
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a0[3] ? a0[7] : v1) < (a1[1][1] ? a0[1] : v2)) % 1);
+            a1[3][7] = (((a1[1][13] < a1[1][14]) % 4) <= ((v3 - v2) && (v0 + 90)));
+            {
+                int i3 = 0;
+                do {
+                    a0[8] = (((i2 > i3) * (v2 / 6)) * ((32 > a0[6]) * (i2 && 97)));
+                    a0[10] = (((i2 > i2) > (v3 % 4)) + ((a1[3][2] * 24) / 3));
+                    v1 = (((a0[11] / 5) >= (95 && i2)) >= ((97 >= 7) * (v3 || 73)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    v2 = (((65 ? 10 : a0[10]) <= (57 + v0)) != ((a1[1][14] < 68) != (a0[13] == v0)));
+    v0 = (((v2 >= 77) * (a0[14] >= v0)) == ((12 || v1) - (91 <= v0)));
+    {
+        int i4 = 0;
+        do {
+            if ((a0[7] % 2) > 52) break;
+            {
+                int i5 = 0;
+                do {
+                    if ((75 / 4) > 53) break;
+                    v1 = (((a0[5] / 9) == (a1[0][10] + v3)) > ((v2 == i4) ? (a0[3] - 50) : (v2 - v3)));
+                    a0[6] = (((i5 >= v3) && (v3 <= v1)) == ((a0[9] * a0[15]) - (i5 - v0)));
+                    v2 = (((i4 ? a0[0] : v0) * (i4 <= v1)) < ((i4 + a0[2]) ? (53 ? a1[3][10] : v1) : (v3 && a0[6])));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v1 = (((12 / 9) < (v0 != v1)) != ((44 % 7) < (v0 % 6)));
+            v0 = (((a0[14] % 3) || (a1[1][3] <= i4)) ? ((v0 - a1[0][1]) > (a1[2][7] || i4)) : ((4 == 92) >= (v2 ? v0 : 43)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v0 = (((6 && a0[15]) < (66 ? 59 : a0[1])) <= ((v2 + i6) % 5));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    a1[3][13] = (((32 || v1) >= (v2 - a0[11])) > ((i7 && i7) ? (a1[2][10] < 17) : (v0 == i6)));
+                    v0 = (((v3 || 40) % 7) + ((v0 < a0[10]) || (31 + v3)));
+                    v0 = (((59 < v0) - (49 * a0[12])) < ((a0[8] % 5) != (v3 >= 67)));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((v3 - a1[2][7]) + (24 / 3)) - ((a1[1][12] != a0[7]) < (a1[3][14] <= 56)));
+            i6 = i6 + 1;
+        }
+    }
+    a1[1][4] = (((v2 == v1) * (a1[0][9] && a0[15])) >= ((v1 != 16) ? (v2 > v1) : (v0 <= a0[3])));
+    return (((v3 < v1) || (80 || 12)) + ((34 / 9) == (v0 == a0[9])));
+}
+int f25() {
+    int v0 = 79;
+    int v1 = 35;
+    int v2 = 94;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a1[3][1] = (((a1[0][1] % 1) / 4) < ((v2 || a1[3][7]) <= (a1[1][7] != v3)));
+            {
+                int i1 = 0;
+                do {
+                    a1[3][10] = (((43 != i0) - (a0[3] != a0[14])) < ((v1 ? 11 : a0[15]) / 8));
+                    v3 = (((v0 * a1[0][12]) || (v1 || 0)) < ((81 ? a0[3] : 49) && (a0[15] / 3)));
+                    v1 = (((a1[2][9] * 47) / 3) / 8);
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a1[1][1] = (((v0 || a1[0][8]) - (v3 >= a1[3][14])) % 4);
+            i0 = i0 + 1;
+        }
+    }
+    a0[10] = (((4 < a1[2][0]) == (v0 <= 12)) % 5);
+    if ((((v1 * v0) * (a1[2][14] || 48)) >= ((v2 || 63) * (a1[1][6] % 9)))) {
+        v1 = (((v2 <= v0) || (22 + a1[1][13])) ? ((29 <= 79) < (v3 ? a1[2][10] : v0)) : ((27 % 9) <= (a0[3] / 4)));
+        a0[12] = (((v1 >= v1) % 4) == ((a0[12] >= a1[2][7]) - (v0 % 9)));
+        a1[1][6] = (((v1 * v3) % 6) % 3);
+    } else {
+        v1 = (((v3 > v1) - (4 <= v3)) / 8);
+        v2 = (((a1[2][15] - v1) * (9 - v1)) ? ((v1 - v0) != (v3 > a1[3][3])) : ((a0[0] != a1[3][15]) || (v1 < v1)));
+        v1 = (((v2 < v0) != (v0 || a0[10])) ? ((43 < 87) == (v1 || a1[3][3])) : ((24 != v0) % 5));
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a0[10] - v0) <= (50 == 59)) + ((v3 + v1) % 1));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                a1[3][9] = (((i2 ? a1[0][13] : a0[5]) - (a1[3][2] * i2)) * ((i3 + v0) / 9));
+                v1 = (((v0 - i2) < (47 * a1[3][15])) / 9);
+                v2 = (((v3 % 3) < (48 == a0[6])) * ((62 / 8) ? (a1[1][9] != v3) : (v3 % 6)));
+            }
+            v1 = (((v1 < a0[12]) == (94 / 1)) + ((48 + v0) ? (v1 > v1) : (i2 != a1[1][2])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            a0[11] = (((a1[0][1] * i5) || (6 + a0[8])) && ((v3 > 51) / 1));
+            v1 = (((i5 < 68) ? (a0[6] > a1[1][9]) : (94 ? 64 : 24)) + ((v1 / 8) != (v0 ? i5 : a1[2][6])));
+            v0 = (((a1[0][5] - v0) % 9) * ((i4 || 14) <= (i5 ? i4 : a0[15])));
+        }
+        a0[5] = (((89 > 43) + (a1[3][3] ? v1 : v3)) <= ((v0 / 9) >= (v0 || i4)));
+        a0[14] = (((v1 > 50) - (v0 * 9)) || ((a0[13] || 73) * (a1[2][12] / 8)));
+    }
+    a0[0] = (((v0 * 98) && (a1[0][6] <= a0[2])) > ((v0 || v3) && (94 < v2)));
+    if ((((72 >= v3) || (v3 ? v3 : v0)) || ((54 ? 22 : v2) <= (v0 ? 23 : v2)))) {
+        v0 = (((v3 && 64) ? (v1 <= a1[3][8]) : (v1 != 68)) ? ((v2 ? a1[3][2] : v0) / 6) : ((v2 * a0[15]) % 3));
+        a0[15] = (((7 > a0[2]) <= (v3 * 53)) >= ((a1[0][15] ? v1 : 90) - (a0[1] || a0[10])));
+        a0[3] = (((a1[3][1] <= v1) + (a1[0][4] / 8)) >= ((a1[1][9] + v2) / 8));
+    } else {
+        a1[2][7] = (((v3 >= 76) && (a0[3] % 9)) ? ((v0 != 10) < (v3 ? v1 : v3)) : ((59 > 70) && (v1 > 66)));
+        a1[3][8] = (((25 != v1) ? (32 && 13) : (89 - v1)) && ((v2 >= a1[0][14]) ? (12 - a0[10]) : (31 <= a1[3][9])));
+        v2 = (((a0[6] - 11) == (91 > v3)) % 3);
+    }
+    a0[3] = (((96 % 8) * (v0 % 2)) > ((a1[1][2] / 4) ? (v2 && v1) : (79 <= v2)));
+    if ((((0 == v1) * (84 >= a0[13])) > ((v2 > a0[9]) && (v1 <= a1[3][2])))) {
+        v0 = (((v1 ? 74 : v3) > (37 == v3)) ? ((v1 == a1[3][4]) >= (97 / 4)) : ((76 ? a1[0][8] : 95) % 7));
+        v2 = (((48 <= v1) ? (79 ? a0[5] : v1) : (v2 - v1)) > ((v1 ? v2 : 84) <= (v2 && v0)));
+        v2 = (((v0 <= a1[0][2]) <= (47 + a1[3][6])) * ((a1[3][2] && a0[7]) != (v3 ? v1 : v1)));
+    } else {
+        a1[2][11] = (((98 <= v0) - (a0[12] < v1)) != ((v2 ? v1 : 96) ? (v2 ? v3 : v1) : (v2 == a1[3][1])));
+        v0 = (((47 || 78) ? (a0[14] == v1) : (v2 < a1[2][8])) || ((v0 < a0[14]) != (68 != a1[2][4])));
+        a0[12] = (((v0 ? a0[8] : v2) ? (37 * a1[2][12]) : (97 || v1)) - ((a0[14] < v1) <= (a0[14] && 67)));
+    }
+    if ((((v3 <= v3) <= (v3 % 6)) && ((66 != a0[12]) + (v3 > 40)))) {
+        a1[0][1] = (((v1 - v0) % 7) <= ((v1 >= v2) * (a0[6] > v2)));
+        v0 = (((a0[7] % 2) + (v2 % 5)) - ((v3 ? v1 : a1[3][2]) - (v2 || a1[1][10])));
+        a1[2][10] = (((v1 - a1[3][6]) != (a1[1][11] && v0)) / 2);
+    } else {
+        a0[10] = (((85 * a0[9]) ? (76 < 10) : (v1 && v1)) == ((a1[1][15] ? v1 : a1[3][15]) && (9 + v3)));
+        v3 = (((v2 != a0[1]) == (21 && v1)) <= ((a1[1][7] + v2) * (a1[3][15] - v2)));
+        v0 = (((v2 ? v1 : 93) - (a1[0][8] % 6)) >= ((86 < v1) < (v0 ? a0[13] : v0)));
+    }
+    return (((v0 / 4) - (v2 * v2)) ? ((97 / 1) + (a1[0][0] ? 39 : v3)) : ((v2 / 3) ? (58 < v2) : (v1 ? v3 : 34)));
+}
+int f26() {
+    int v0 = 60;
+    int v1 = 2;
+    int v2 = 84;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 != a0[11]) % 2) > ((86 || 32) + (56 >= v1)));
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((v0 < v0) > 74) break;
+            v0 = (((a1[2][13] <= v1) != (a0[10] ? v1 : a1[1][12])) == ((v2 % 6) || (89 < v2)));
+            a1[3][2] = (((a1[2][6] < 67) || (v1 % 3)) >= ((21 > i0) + (71 > v0)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a1[2][7] = (((v2 - a1[0][1]) != (a0[10] ? v1 : v0)) < ((70 >= v2) >= (88 ? v2 : v3)));
+                    v1 = (((a1[3][10] > v0) + (v1 == a1[1][4])) - ((v0 >= 3) ? (a0[13] == v1) : (a0[0] < a0[13])));
+                    v3 = (((v3 <= v0) - (i0 - v3)) * ((i1 || i0) != (97 || a1[0][2])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    a1[3][8] = (((v3 <= i2) ? (5 < 77) : (v0 >= v0)) * ((v2 ? i3 : 21) != (v0 <= v1)));
+                    a1[3][6] = (((a0[7] <= a0[8]) / 5) / 5);
+                    v3 = (((53 * 13) >= (a0[6] == v3)) != ((v1 != v2) % 3));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v1 ? 96 : v2) + (v1 > a1[3][5])) % 8);
+            v1 = (((0 || a1[3][13]) < (95 <= v3)) != ((v2 ? 14 : v3) || (v1 / 5)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v2 || 0) % 7) > ((v1 / 2) + (v2 != 75)))) {
+        v3 = (((a1[1][10] - a1[0][10]) % 7) % 6);
+        a0[14] = (((v3 / 1) % 6) < ((a1[2][2] - a1[2][9]) / 7));
+        v0 = (((89 + v2) || (65 > v0)) != ((a0[8] > a0[4]) != (v1 == a0[15])));
+    } else {
+        v2 = (((62 >= v1) > (a1[1][15] <= a1[3][10])) > ((82 && a1[3][0]) >= (a1[3][10] > 93)));
+        v0 = (((72 % 9) * (a1[0][13] - v1)) == ((v3 == a0[0]) != (v2 + v0)));
+        v0 = (((v3 * 66) || (65 >= a0[3])) || ((v2 <= v1) - (68 / 1)));
+    }
+    a0[14] = (((55 || 23) * (v1 ? v1 : a0[5])) || ((v3 <= v3) || (v1 != v0)));
+    a0[10] = (((a0[13] + 54) + (27 == a1[1][0])) / 1);
+    if ((((v1 % 5) > (v1 ? 84 : a1[2][13])) <= ((v3 > 74) && (a0[11] <= v3)))) {
+        a1[1][12] = (((73 || 8) && (v1 * v1)) >= ((v3 > v2) && (v2 / 6)));
+        v1 = (((v3 != v0) / 8) ? ((v0 % 1) % 5) : ((v0 % 1) < (v2 * v0)));
+        v0 = (((v2 && 83) / 4) >= ((a1[1][2] <= v3) > (a0[0] != v0)));
+    } else {
+        a0[0] = (((53 >= v3) && (60 > v3)) ? ((77 - a0[0]) + (a1[3][11] < v2)) : ((v3 > a0[11]) ? (a1[1][4] <= v1) : (97 % 5)));
+        v2 = (((a1[1][13] * 49) * (a0[6] || a1[2][12])) > ((a0[12] % 8) > (a1[2][10] <= a1[1][9])));
+        a1[0][6] = (((15 == v1) - (17 != v3)) || ((v2 || v1) >= (v1 <= 39)));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v1 = (((14 <= v1) >= (v1 < i4)) >= ((v0 == a1[0][12]) || (a1[0][8] || 16)));
+        {
+            int i5 = 0;
+            do {
+                if ((i5 <= 47) > 62) break;
+                v2 = (((i4 > v3) && (a0[6] && a0[14])) < ((v2 / 3) ? (v3 != 77) : (v0 > 87)));
+                v3 = (((i4 ? v0 : a0[10]) > (v2 != v2)) == ((v2 <= i5) || (i4 <= i5)));
+                v0 = (((a1[3][1] % 2) + (72 ? v0 : 74)) ? ((v0 == v3) % 1) : ((i4 / 1) < (v2 % 4)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        a0[8] = (((a0[14] <= v1) - (i4 >= v3)) - ((i4 || a1[1][12]) || (i4 != v3)));
+    }
+    v3 = (((v0 != v2) % 9) == ((v2 > a1[1][4]) && (a1[3][10] >= v0)));
+    a0[4] = (((v0 > a0[12]) ? (36 && a1[0][6]) : (a0[8] != v2)) ? ((v1 && 66) >= (v0 < 59)) : ((a0[13] ? v1 : v0) < (94 - v0)));
+    return (((a0[3] ? a1[2][0] : v1) * (a1[1][8] % 6)) * ((v3 > v2) > (a0[7] - a1[3][12])));
+}
+int f27() {
+    int v0 = 73;
+    int v1 = 22;
+    int v2 = 7;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    a0[11] = (((v2 > a0[8]) > (63 || a1[3][15])) - ((19 <= 55) - (v1 != a0[3])));
+    {
+        int i0 = 0;
+        do {
+            if ((v3 <= 86) > 55) break;
+            {
+                int i1 = 0;
+                do {
+                    if ((9 || v3) > 75) break;
+                    v1 = (((i1 >= a1[0][10]) && (v1 + 51)) < ((i1 / 7) > (13 > v0)));
+                    a1[3][1] = (((i0 >= i1) <= (a0[12] && v0)) * ((i0 / 7) < (40 / 7)));
+                    v3 = (((13 / 9) % 3) + ((a1[3][4] ? v0 : a1[1][2]) / 8));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            a0[12] = (((a0[9] ? a1[2][0] : a1[1][13]) * (i0 % 6)) ? ((v3 / 8) % 5) : ((48 > 37) != (73 != 20)));
+            v2 = (((v0 + v0) + (a0[0] ? a0[5] : a0[10])) ? ((a0[9] / 6) && (41 >= 5)) : ((v2 ? v3 : 91) > (v3 > 13)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    a0[4] = (((v1 <= 95) < (v2 > a1[0][15])) * ((a0[5] > v0) < (v0 < v3)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v0 = (((a1[3][6] < v1) && (a0[1] + v2)) <= ((v2 < a1[0][0]) - (14 >= 59)));
+        v3 = (((v2 == i2) / 6) * ((a0[11] * a1[2][2]) ? (v3 + a1[1][2]) : (a1[0][0] ? v1 : i2)));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v2 = (((v2 != 10) ? (i3 ? 9 : a0[14]) : (v1 * 85)) < ((a1[0][1] % 1) / 1));
+                a0[13] = (((v0 != 94) + (20 - i3)) == ((a0[8] == v1) * (v1 != a1[0][4])));
+                a0[9] = (((16 >= 77) == (v2 ? a1[3][13] : v0)) <= ((78 ? 67 : v1) == (a1[3][14] + a1[0][10])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[3][6] = (((v2 ? 4 : a0[13]) == (36 || v2)) / 7);
+            v3 = (((a0[8] || a1[3][2]) + (a1[1][8] > v0)) / 1);
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v0 = (((i4 > i5) - (i4 <= v3)) ? ((66 || 9) % 1) : ((v1 > a0[9]) % 9));
+                    a0[13] = (((v3 + 16) < (v2 != v0)) % 6);
+                    v1 = (((v3 + a1[3][1]) ? (a0[13] ? i4 : 86) : (v3 ? a1[3][5] : v0)) <= ((49 - a1[3][13]) || (53 + v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v3 = (((i6 % 6) < (59 >= i6)) ? ((77 ? v1 : i6) && (v1 == a1[3][3])) : ((i6 > v1) ? (v3 != i6) : (99 > i6)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v3 = (((i7 + a0[0]) == (i7 / 2)) || ((82 <= 98) <= (i7 + 70)));
+                    v3 = (((v0 + i6) || (v2 < a1[1][12])) + ((i6 == v3) + (v3 / 7)));
+                    v1 = (((v1 / 8) < (a1[0][11] <= a1[0][15])) || ((89 && v0) ? (a1[0][12] - v3) : (i6 == 49)));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((a1[1][14] - a1[3][5]) <= (a0[15] != 38)) && ((v0 < a0[4]) && (81 >= v0)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            if ((13 == v0) > 78) break;
+            for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+                v1 = (((79 < v1) != (a1[2][8] - a1[1][11])) * ((a1[3][8] || 36) + (v0 >= a0[12])));
+                v2 = (((54 < v0) * (v1 != i8)) != ((a0[10] == v0) % 6));
+                v0 = (((a1[0][13] || v1) ? (77 >= v2) : (43 ? 18 : a1[3][7])) != ((i9 || a1[0][8]) ? (a1[0][11] != a1[1][12]) : (i9 % 1)));
+            }
+            v3 = (((a1[3][12] ? v0 : v2) == (v1 ? v2 : 94)) || ((i8 >= a1[3][1]) == (34 <= a1[2][12])));
+            a0[2] = (((v2 >= i8) != (v1 < 43)) < ((v0 * 78) / 9));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((a1[3][6] || 78) < (v2 && a0[9])) - ((v3 >= v0) + (v2 ? v2 : v0)))) {
+        v3 = (((a0[3] - 50) < (a0[9] ? a1[0][10] : a0[0])) ? ((v2 / 9) != (68 == v1)) : ((v0 ? v0 : v1) <= (15 != a0[1])));
+        a0[5] = (((v1 >= 76) - (v3 * a1[0][1])) - ((a1[3][2] != v3) ? (26 == v0) : (a1[3][3] - v0)));
+        a1[2][7] = (((15 < v1) <= (a0[9] + a0[15])) * ((v2 || v1) != (v2 == a1[0][15])));
+    } else {
+        a0[10] = (((a1[1][2] / 3) * (v2 > v1)) <= ((6 <= a0[9]) ? (v3 < 8) : (a1[2][1] / 8)));
+        v3 = (((v0 < v2) < (88 - v0)) ? ((92 == v1) || (19 < v1)) : ((v1 - 42) != (v1 + v2)));
+        a0[14] = (((a0[1] >= 13) * (54 < a1[3][3])) > ((v0 < a1[1][11]) >= (44 * v2)));
+    }
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        {
+            int i11 = 0;
+            while (i11 < 3) {
+                if ((a0[10] || v1) > 50) break;
+                v1 = (((v2 > i10) ? (97 ? v2 : a1[3][2]) : (v0 && v2)) <= ((12 > i10) && (a0[11] ? v3 : a1[2][11])));
+                a0[12] = (((v0 == v1) >= (a1[2][7] - i10)) && ((v0 % 8) && (82 != v3)));
+                a0[11] = (((v3 && v0) ? (v1 >= v0) : (35 || i10)) ? ((a1[1][2] > v0) * (44 % 1)) : ((50 >= a1[0][6]) != (v2 || i11)));
+                i11 = i11 + 1;
+            }
+        }
+        a1[2][1] = (((v2 * v0) >= (a0[1] && 89)) <= ((a1[2][12] < v0) > (86 + a1[2][0])));
+        v1 = (((a1[3][9] * a1[3][8]) ? (v1 * a1[3][15]) : (90 && v0)) != ((68 < 24) - (v2 ? v1 : v2)));
+    }
+    {
+        int i12 = 0;
+        while (i12 < 2) {
+            {
+                int i13 = 0;
+                while (i13 < 6) {
+                    if ((v1 / 7) > 82) break;
+                    v3 = (((v1 || i12) || (i12 * 83)) % 2);
+                    a1[0][3] = (((26 > 92) + (v2 / 1)) * ((i13 < a0[3]) <= (v0 + v0)));
+                    a1[0][1] = (((a1[1][9] && a1[3][2]) != (42 == a1[2][9])) == ((a0[6] < v2) != (v3 + v2)));
+                    i13 = i13 + 1;
+                }
+            }
+            v1 = (((a1[3][11] + 97) && (a1[0][15] == a1[1][0])) - ((a1[0][1] == i12) != (v3 % 8)));
+            v2 = (((v1 + v0) + (a0[15] + a0[9])) || ((29 < 92) + (v3 - v3)));
+            i12 = i12 + 1;
+        }
+    }
+    return (((a1[1][1] != a0[0]) + (a0[8] && 48)) || ((v3 || v1) * (a0[1] > v3)));
+}
+int f28() {
+    int v0 = 95;
+    int v1 = 43;
+    int v2 = 50;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 - a0[2]) != (v2 + v3)) ? ((v0 == v0) > (v3 * v3)) : ((v0 <= v2) && (22 ? v2 : v1)))) {
+        a1[0][12] = (((v3 % 4) * (59 >= v0)) != ((v1 ? v3 : v1) ? (v1 != a1[0][11]) : (v1 || v1)));
+        a0[11] = (((a1[1][15] < v0) <= (a1[2][11] || v2)) || ((a1[3][2] ? v0 : v2) >= (v2 <= v0)));
+        a0[15] = (((v2 && 89) ? (23 < v3) : (a1[3][15] || 89)) % 3);
+    } else {
+        v2 = (((a0[8] - a0[15]) > (a0[9] >= v0)) || ((46 < a1[2][10]) % 5));
+        v2 = (((v3 % 3) * (36 / 5)) && ((v2 ? a1[3][0] : v0) != (v0 == v3)));
+        v2 = (((65 ? v3 : 97) < (v0 / 2)) - ((a1[3][7] > 90) > (a0[12] / 5)));
+    }
+    if ((((v3 % 8) <= (v2 % 5)) ? ((v1 ? 7 : v1) * (v1 != a0[10])) : ((72 != a0[8]) <= (v2 != a1[3][0])))) {
+        v1 = (((a1[3][1] - 35) ? (a0[10] ? v0 : v3) : (a1[3][5] <= v1)) == ((v0 ? v3 : v0) - (18 != v1)));
+        v1 = (((v2 % 3) != (33 * 1)) + ((a1[0][15] == a1[3][10]) + (99 == 61)));
+        v1 = (((v0 % 9) <= (41 && a0[3])) * ((v3 % 9) - (a0[0] + a0[14])));
+    } else {
+        a1[0][13] = (((a1[2][15] ? a1[3][9] : v1) < (v0 <= v2)) || ((a1[0][0] * v0) > (57 ? v1 : a1[0][12])));
+        a1[0][0] = (((77 + a0[7]) >= (20 <= v0)) == ((a1[3][10] || v2) / 3));
+        v1 = (((v1 >= v0) * (v2 + v2)) / 1);
+    }
+    v3 = (((a1[2][4] != a1[2][0]) * (v2 + v0)) >= ((v0 == v2) ? (a1[0][5] % 7) : (v3 ? 72 : v0)));
+    {
+        int i0 = 0;
+        do {
+            if ((56 ? v3 : v0) > 94) break;
+            v3 = (((v2 / 8) / 4) < ((a0[7] / 8) != (a1[0][5] * 50)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a1[2][15] > v0) && (0 == 99)) > ((a0[10] ? v2 : v2) * (a1[0][0] ? 17 : i1)));
+                    v1 = (((i1 >= a0[0]) < (96 >= v0)) < ((v3 % 8) ? (a1[2][4] * a0[1]) : (v2 != v2)));
+                    a0[13] = (((23 || i0) >= (v2 > i1)) * ((a0[10] && a0[14]) < (i0 ? a0[13] : 42)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((v2 > v0) - (v3 - 63)) != ((a1[3][7] / 6) <= (88 * v0)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    a1[3][3] = (((v3 < 65) % 6) / 3);
+    a1[1][0] = (((v1 < v1) >= (v3 - a1[0][1])) + ((v1 < v3) || (42 <= v1)));
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v3 < v1) - (v3 - v2)) + ((v2 - 10) % 1));
+            v2 = (((a1[3][3] ? v2 : v2) <= (v2 <= 9)) % 6);
+            {
+                int i3 = 0;
+                do {
+                    a1[3][4] = (((i2 && v2) % 2) >= ((i2 + v0) || (63 ? v3 : 19)));
+                    v0 = (((v0 / 5) || (v2 <= i3)) == ((v2 / 8) % 3));
+                    v2 = (((i2 % 4) ? (v2 >= a0[1]) : (a1[0][0] > i2)) >= ((23 || v2) != (24 + v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v1 > v3) ? (21 - i4) : (v1 == a1[3][0])) > ((v3 || a1[2][5]) % 5));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    if ((a0[1] ? 96 : a0[12]) > 68) break;
+                    v1 = (((i4 > v3) == (v1 + v2)) % 4);
+                    v2 = (((6 / 4) <= (a1[3][3] * a0[15])) <= ((a1[3][3] * 18) && (a0[2] <= a0[5])));
+                    a1[2][6] = (((a1[2][2] >= 55) || (v2 - a0[0])) / 2);
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((a0[9] != i4) != (i4 % 5)) + ((v2 - 84) ? (a1[0][6] != a1[3][6]) : (50 - v1)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((v2 % 5) > 92) break;
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            a1[3][5] = (((75 ? v2 : a0[1]) || (v1 ? i7 : a1[0][14])) + ((a0[15] >= i6) + (i7 % 3)));
+            v1 = (((26 && i7) ? (a0[8] < i7) : (v3 - a0[2])) <= ((80 == 6) % 5));
+            v1 = (((a1[3][12] < v0) <= (95 % 1)) ? ((a1[1][0] / 3) / 1) : ((a0[14] != a0[2]) >= (40 > a0[12])));
+        }
+        v1 = (((v1 == a0[11]) ? (v1 < v3) : (a0[12] <= v0)) < ((39 <= a1[1][8]) % 8));
+        a1[0][2] = (((i6 == 77) % 3) >= ((10 + a0[13]) ? (v3 && v0) : (94 <= v2)));
+    }
+    if ((((v0 <= 38) * (4 && a1[0][4])) * ((v1 || v0) > (a1[3][0] < a0[7])))) {
+        a0[6] = (((a1[2][3] * 38) >= (v2 && v0)) ? ((v0 + v0) - (a1[1][1] - 18)) : ((1 == 72) - (v1 && 73)));
+        a1[0][2] = (((v3 - v2) <= (a1[0][1] == 35)) ? ((93 || a0[13]) != (86 + v0)) : ((v1 ? v0 : v0) != (a1[3][8] >= a1[1][2])));
+        a1[0][4] = (((v2 != v2) || (59 < v1)) - ((26 ? a0[6] : a0[14]) != (28 - a0[10])));
+    } else {
+        v0 = (((v2 > a0[7]) ? (92 > v3) : (53 < a0[2])) < ((a0[3] != v2) % 6));
+        v1 = (((a0[13] == 25) && (v1 ? a0[12] : a0[4])) / 4);
+        v2 = (((v2 ? v2 : a1[1][2]) ? (v2 + a1[2][3]) : (v2 - v1)) / 9);
+    }
+    return (((a0[13] ? 7 : 5) * (a0[9] && v2)) * ((29 || v3) + (40 + a0[13])));
+}
+int f29() {
+    int v0 = 66;
+    int v1 = 43;
+    int v2 = 61;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 < v3) > (a1[0][2] && a0[9])) < ((v3 ? v3 : a1[2][0]) + (80 && v0)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v3 = (((34 >= v0) || (v3 <= v1)) || ((14 && 22) * (v1 <= v0)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v3 = (((v0 % 2) > (a0[10] + v3)) || ((55 ? v1 : v2) != (85 % 6)));
+                    v2 = (((63 || 5) % 2) % 2);
+                    v1 = (((i0 > 7) ? (a0[1] != v2) : (v1 + a1[3][10])) - ((i0 + a1[0][1]) ? (44 ? v2 : v3) : (i1 || a0[14])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][11] = (((i0 || v0) >= (v0 - v0)) && ((i0 < v1) <= (i0 || 9)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 >= v0) + (v0 <= v3)) < ((a0[4] || v2) == (6 ? v3 : v0)))) {
+        v1 = (((v0 <= 75) && (v0 % 8)) / 4);
+        v0 = (((v1 ? v0 : 89) || (v3 && 15)) >= ((v2 > v3) != (a0[15] && a0[14])));
+        v1 = (((v1 / 6) > (6 * a1[2][7])) >= ((a0[4] || v1) % 7));
+    } else {
+        a1[1][11] = (((v1 + v3) == (51 != v3)) > ((v1 + v2) ? (v1 < v0) : (46 != v3)));
+        v2 = (((55 < 54) <= (v0 || a1[2][11])) && ((v3 ? v0 : v3) && (94 != a1[2][8])));
+        v1 = (((v3 / 4) && (a1[3][15] <= 36)) != ((v3 > a0[5]) != (a1[2][0] % 6)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a1[1][10] = (((a1[1][5] > a0[15]) && (45 >= a0[11])) && ((a1[3][12] / 4) / 3));
+        v0 = (((v0 < v0) - (v1 / 1)) != ((a1[0][15] != a1[3][2]) > (v3 % 6)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v1 = (((v0 / 6) - (87 ? i2 : v0)) - ((v3 <= i3) == (41 >= 82)));
+            v3 = (((i2 != i3) ? (a0[1] || a0[0]) : (a0[6] % 3)) * ((v3 % 8) <= (a1[3][4] ? 12 : v0)));
+            v0 = (((a1[3][13] / 9) >= (58 < 35)) ? ((a1[1][4] - v2) <= (i3 && 28)) : ((36 != a1[1][14]) || (a1[1][11] < a1[0][15])));
+        }
+    }
+    if ((((v2 != v2) && (47 && a0[15])) % 9)) {
+        v2 = (((2 > v2) ? (v0 == a0[15]) : (v3 >= v1)) + ((v2 && v2) <= (48 / 5)));
+        v2 = (((a0[5] * 77) <= (v3 >= v3)) * ((30 - v0) == (v1 && 6)));
+        v1 = (((23 / 3) && (38 ? v0 : 51)) + ((a0[14] <= v3) % 2));
+    } else {
+        a0[2] = (((54 <= v1) % 8) != ((v2 && a1[2][13]) != (v3 < 14)));
+        v3 = (((v2 <= v2) % 3) % 6);
+        a0[11] = (((a1[1][6] <= v2) > (v0 - 38)) <= ((v2 > v2) > (v1 + v3)));
+    }
+    v2 = (((v2 ? v3 : v1) ? (a1[2][13] > v3) : (a0[3] || v2)) <= ((75 + v1) + (a0[12] || 18)));
+    if ((((7 == 15) + (v3 - v2)) % 9)) {
+        v1 = (((a0[5] - v1) + (a1[2][12] ? a1[3][7] : 77)) + ((a1[1][10] * 55) ? (a0[0] * a0[12]) : (v2 - v1)));
+        v0 = (((v0 != v1) || (v2 != v2)) < ((42 <= 22) == (a1[1][12] == v1)));
+        v3 = (((14 > v0) > (a0[14] && v0)) && ((a0[15] && 4) + (v3 * v1)));
+    } else {
+        v3 = (((v0 ? v2 : v3) > (v0 - v1)) || ((v1 <= a1[3][13]) && (a1[1][14] > v3)));
+        v0 = (((a1[1][8] ? v1 : 58) / 4) ? ((94 + v3) ? (v0 + 10) : (75 != a0[15])) : ((v2 > v2) ? (29 - v0) : (v2 && a0[7])));
+        v2 = (((v3 ? v0 : 16) + (a0[7] && v0)) * ((a0[5] != 14) ? (85 - a0[4]) : (49 - v2)));
+    }
+    if ((((v0 > v0) == (v1 ? a0[13] : 92)) <= ((v3 * v3) ? (v2 % 7) : (29 >= v3)))) {
+        v0 = (((v2 <= v1) == (v1 > 46)) * ((v3 < v2) ? (v1 <= a1[0][6]) : (v1 > v1)));
+        v0 = (((v1 / 3) * (a0[3] < v2)) == ((v1 == 50) > (v3 && a0[5])));
+        a0[13] = (((55 > a1[0][15]) < (v1 <= 58)) == ((v2 ? a0[9] : 41) != (77 > v2)));
+    } else {
+        v0 = (((49 <= v3) || (16 <= a1[1][14])) == ((v0 < v3) >= (a0[4] <= a1[2][8])));
+        a0[6] = (((v3 ? a1[3][0] : a0[11]) % 3) < ((a0[10] != 54) && (12 == v3)));
+        v1 = (((25 / 5) * (45 + v1)) <= ((v0 != v0) != (a1[1][6] % 1)));
+    }
+    if ((((84 - a1[0][11]) > (v2 ? a0[15] : a1[0][6])) != ((v2 ? a1[1][15] : v0) < (56 || v1)))) {
+        v3 = (((v1 < 75) && (v2 ? v1 : a1[0][2])) / 1);
+        a0[4] = (((v1 != a1[0][12]) && (86 % 4)) >= ((a0[6] < v1) == (v2 > v3)));
+        v0 = (((v3 < v2) >= (a1[3][14] < v2)) >= ((v2 || a0[7]) <= (56 + v0)));
+    } else {
+        v3 = (((a0[8] && v2) - (v3 < v0)) > ((55 / 5) <= (v0 > v3)));
+        v1 = (((v2 ? v0 : 39) || (v3 || v3)) && ((v0 ? 91 : a1[3][3]) >= (v2 * v0)));
+        v3 = (((v0 / 8) * (v2 ? v0 : v2)) % 5);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((37 != v0) > 90) break;
+            a1[1][1] = (((v2 > v1) <= (25 < a0[9])) > ((51 % 2) != (14 - a0[1])));
+            v0 = (((a0[2] + 68) + (v2 ? v3 : 33)) % 8);
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v1 = (((91 <= v1) - (17 >= v3)) / 1);
+                a1[3][9] = (((a1[2][14] != 12) - (86 - v1)) <= ((v0 + i4) - (v0 * v1)));
+                v3 = (((13 <= a1[2][9]) < (i5 > i5)) / 8);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v2 || a0[8]) < (a0[12] != a1[1][5])) - ((v2 == v0) == (v3 || v2)));
+}
+int f30() {
+    int v0 = 86;
+    int v1 = 3;
+    int v2 = 17;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((v3 < i1) > 65) break;
+                    a1[1][3] = (((a0[2] / 4) <= (i0 / 5)) + ((26 > 50) >= (i1 - v0)));
+                    v1 = (((a1[0][11] >= a1[1][11]) ? (3 < a0[1]) : (i1 >= 66)) % 2);
+                    v0 = (((v0 - i0) >= (a1[0][11] == a0[11])) * ((a0[12] % 2) / 4));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((99 == v1) > (v3 % 9)) - ((v1 * 12) || (38 + a0[8])));
+            v0 = (((51 ? i0 : a0[13]) - (a1[0][10] || i0)) * ((i0 && 41) && (25 < 70)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v0 = (((a0[14] > v3) && (68 && a0[2])) == ((v2 < v3) ? (i2 ? v1 : a0[7]) : (v0 >= v2)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v1 = (((79 < i2) * (41 == 16)) && ((v3 / 8) < (66 ? 78 : v2)));
+            v2 = (((i2 == i2) && (a0[8] % 8)) + ((a0[3] ? v2 : a0[9]) || (i2 + v1)));
+            v3 = (((55 < v0) ? (a0[0] > a1[0][13]) : (v2 || 33)) != ((91 < v0) ? (v1 < 14) : (i2 ? v0 : 16)));
+        }
+        a0[9] = (((a0[3] < a0[2]) ? (v3 < i2) : (2 || a1[0][15])) >= ((a1[2][12] / 4) % 4));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[8] = (((i4 ? v0 : a1[1][1]) % 2) && ((a1[3][9] >= i4) < (a0[5] < i4)));
+            a1[1][3] = (((v3 < i4) % 5) < ((32 || v1) % 7));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v1 = (((v1 ? i5 : a0[3]) && (3 % 3)) != ((i4 || v0) >= (a1[1][5] >= 86)));
+                v3 = (((a0[0] * 99) * (i4 / 8)) == ((v2 * v3) + (a0[9] + a0[11])));
+                v0 = (((i5 && 0) / 8) * ((v1 && v2) + (v3 == a1[3][13])));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((v3 > a0[12]) > 72) break;
+        a0[4] = (((53 % 9) > (a1[1][2] != v3)) + ((v3 >= 47) * (v2 / 9)));
+        v2 = (((v1 || a0[9]) - (30 + a1[1][8])) != ((i6 <= a1[0][2]) > (94 % 5)));
+        {
+            int i7 = 0;
+            do {
+                if ((i6 % 6) > 71) break;
+                v0 = (((a0[12] ? 34 : 37) >= (v2 < a1[0][13])) != ((a0[12] + v2) ? (v2 >= 4) : (80 * 30)));
+                v0 = (((a1[2][1] * 52) >= (0 * 35)) < ((i7 ? 98 : a1[1][15]) - (90 / 1)));
+                a0[0] = (((a1[0][6] && i6) % 3) <= ((v2 - i7) + (i7 ? 1 : a1[2][1])));
+                i7 = i7 + 1;
+            } while (i7 < 5);
+        }
+    }
+    if ((((v1 > a1[3][1]) - (a0[4] != v2)) + ((a0[4] || a1[0][14]) < (v0 - 39)))) {
+        v0 = (((a0[14] < 76) >= (20 / 9)) % 9);
+        a0[2] = (((v1 % 5) / 2) > ((96 && 15) >= (2 / 6)));
+        v0 = (((v3 || 52) + (v2 / 8)) - ((v0 * a0[6]) ? (64 != v0) : (v0 != 64)));
+    } else {
+        a0[2] = (((a1[2][12] - a1[3][6]) == (39 ? v1 : a0[3])) == ((38 - a0[7]) == (22 ? a0[14] : a1[3][3])));
+        v3 = (((v3 ? a1[2][13] : a1[3][2]) / 1) ? ((v3 % 9) > (v2 >= a1[0][6])) : ((a1[3][14] > a0[11]) % 6));
+        a1[0][0] = (((37 || a1[2][14]) != (v2 < v3)) + ((v2 < 33) + (77 ? v1 : 59)));
+    }
+    if ((((a0[10] < a0[9]) && (v3 / 8)) < ((a1[2][2] || v2) && (a1[1][8] >= v0)))) {
+        v3 = (((v0 < v2) - (v2 * 48)) - ((72 ? v3 : v2) - (44 >= 88)));
+        v1 = (((v3 < v3) > (a1[2][11] - 96)) || ((a0[14] || v1) ? (v0 <= v2) : (v2 % 9)));
+        v0 = (((a0[0] || v3) <= (a0[6] ? a1[0][5] : 58)) > ((v3 + v0) ? (v0 > 18) : (v1 < v0)));
+    } else {
+        v1 = (((a0[15] + 83) % 8) < ((v1 % 3) % 8));
+        v3 = (((a0[0] <= 40) == (v3 && a1[3][3])) > ((27 == v3) - (v2 > a1[1][4])));
+        v3 = (((18 > 46) ? (a1[3][5] * v1) : (a0[3] - v1)) == ((v0 ? a0[8] : a0[2]) == (52 >= 58)));
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        v2 = (((v0 < v3) % 7) - ((v2 % 7) - (v3 > v0)));
+        {
+            int i9 = 0;
+            do {
+                a1[3][5] = (((a1[0][11] * 70) / 5) ? ((v2 % 8) * (v1 * a1[0][4])) : ((a0[1] <= 86) > (i9 * i8)));
+                v3 = (((13 > v2) ? (v1 < i9) : (a1[1][1] != v0)) * ((a1[1][5] == 26) <= (a1[1][8] >= v2)));
+                a1[2][5] = (((v0 % 9) ? (v3 <= v3) : (36 ? 70 : a0[0])) < ((a0[6] <= a1[2][14]) <= (i8 * 38)));
+                i9 = i9 + 1;
+            } while (i9 < 2);
+        }
+        v1 = (((v3 || v3) / 8) * ((v2 && 27) || (v3 * 38)));
+    }
+    if ((((v1 * v2) && (v3 == a0[15])) >= ((69 <= v1) > (48 > 50)))) {
+        v1 = (((a0[7] && v3) == (a1[3][14] ? v0 : v2)) ? ((38 && a1[1][12]) ? (v3 == v2) : (24 > a1[2][10])) : ((a0[15] - 15) % 6));
+        v1 = (((48 / 3) / 7) && ((a1[2][5] && v3) * (36 != v0)));
+        v1 = (((a0[15] + 69) < (v1 != 88)) && ((45 ? 47 : v2) < (66 >= v2)));
+    } else {
+        v2 = (((44 - a0[7]) > (13 - a0[2])) - ((a1[2][6] % 8) - (v1 != 95)));
+        a1[3][4] = (((a0[6] == v0) ? (v3 % 8) : (63 % 5)) >= ((8 != a1[0][12]) - (v2 ? a1[0][15] : v3)));
+        a0[1] = (((v2 * 50) ? (a0[5] + 19) : (v2 ? a1[1][0] : 75)) - ((a1[2][13] != v0) <= (0 ? a0[3] : v2)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            a0[6] = (((v1 ? v0 : v0) ? (a1[1][5] <= i10) : (21 % 5)) * ((v1 != v0) ? (48 > v2) : (v3 + a0[6])));
+            a1[2][5] = (((v0 < 50) >= (v1 * v2)) % 7);
+            {
+                int i11 = 0;
+                do {
+                    v3 = (((v0 ? a0[5] : i10) <= (i11 && i10)) != ((99 && 29) - (27 * v1)));
+                    a0[5] = (((a0[12] == v3) ? (v0 >= i10) : (v1 >= v0)) || ((a1[3][12] && 64) ? (80 / 6) : (a1[3][9] <= v0)));
+                    v1 = (((24 ? i10 : a0[6]) || (a0[12] == 66)) > ((v0 ? v0 : v0) > (v0 + a0[6])));
+                    i11 = i11 + 1;
+                } while (i11 < 5);
+            }
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 4; i12 = i12 + 1) {
+        {
+            int i13 = 0;
+            while (i13 < 6) {
+                v1 = (((i12 + i12) + (a1[2][10] * v0)) > ((i13 != a0[3]) - (a1[2][5] + 75)));
+                v0 = (((67 || 22) % 4) <= ((i12 ? v2 : v0) != (41 || v0)));
+                a0[13] = (((62 || 50) != (i13 - i13)) < ((51 ? 96 : 34) + (v0 < v2)));
+                i13 = i13 + 1;
+            }
+        }
+        a1[1][15] = (((19 != i12) == (a1[0][11] <= v1)) >= ((v3 > 61) ? (a1[2][8] <= 52) : (i12 + a0[4])));
+        v0 = (((a1[1][11] % 6) || (v1 == a0[9])) >= ((v0 || a1[1][12]) % 5));
+    }
+    return (((v3 / 8) * (v0 - v1)) && ((a1[2][8] || 60) && (v1 >= a0[0])));
+}
+int f31() {
+    int v0 = 91;
+    int v1 = 17;
+    int v2 = 2;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 - 38) >= (v0 > v0)) ? ((v1 / 8) || (v2 < v1)) : ((v2 <= v1) / 5));
+    v0 = (((16 * 46) < (v2 ? 33 : a0[1])) ? ((a1[2][12] * a1[2][6]) || (a1[0][2] + v0)) : ((v1 * v3) < (v0 + v2)));
+    {
+        int i0 = 0;
+        do {
+            if ((v1 < v3) > 99) break;
+            v0 = (((v1 != a1[1][12]) >= (a0[0] * v1)) && ((v0 % 9) <= (i0 && 78)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v2 = (((a1[0][8] != v0) * (a0[1] || v1)) <= ((a0[1] * v0) || (20 < v0)));
+                a1[1][4] = (((a1[0][11] == 55) < (23 % 3)) > ((i0 * i0) - (v2 || a0[6])));
+                a1[0][12] = (((a0[7] && v0) < (v2 > a0[4])) || ((v3 > a1[3][6]) || (i1 != i0)));
+            }
+            v0 = (((38 + v3) <= (44 < v2)) * ((23 / 7) ? (a0[3] ? v1 : 30) : (v3 / 3)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v2 = (((v2 == a1[1][7]) == (v3 / 5)) * ((v0 < 70) ? (a0[7] == v0) : (39 && v1)));
+            a1[1][3] = (((a0[12] > v2) <= (96 % 4)) < ((i2 && v1) && (97 <= v0)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((i3 * i3) > 98) break;
+                    v0 = (((a0[6] * v3) > (i2 ? a1[1][8] : a0[11])) <= ((a0[14] * i3) && (99 + a0[3])));
+                    v0 = (((v3 % 2) % 8) != ((v1 * 62) == (v2 != v3)));
+                    v2 = (((v2 >= i2) % 2) ? ((v1 % 6) / 8) : ((v3 < v1) ? (a1[0][15] != a1[0][14]) : (63 / 4)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v2 = (((a0[2] * a1[1][8]) <= (7 > a1[1][0])) / 6);
+            {
+                int i5 = 0;
+                do {
+                    a0[3] = (((11 < v1) ? (39 * a1[0][8]) : (v1 * v2)) * ((9 || v1) < (i4 - 67)));
+                    v3 = (((v2 == a0[1]) <= (a0[7] && v3)) || ((v3 % 8) / 8));
+                    a1[3][15] = (((a1[0][5] ? 4 : i5) != (v0 || 99)) + ((v3 + a1[0][4]) <= (a1[1][9] ? v0 : 60)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v1 = (((48 < i4) + (a0[14] == v2)) <= ((v1 ? v0 : v0) * (i4 < a0[15])));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v0 = (((v2 % 9) * (i6 != v0)) - ((50 % 5) ? (v3 % 6) : (a1[1][4] % 1)));
+            a1[1][4] = (((i6 < 91) || (v2 ? a0[10] : 76)) % 2);
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v0 = (((i7 >= v2) / 3) - ((a0[11] != a1[0][8]) / 9));
+                    a1[1][7] = (((88 ? v0 : 83) % 2) <= ((a0[14] < v1) == (70 / 8)));
+                    v3 = (((a1[0][12] + 49) > (i6 || a0[15])) >= ((v3 ? v1 : v2) > (a1[1][0] || 21)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    if ((v0 ? v2 : v0) > 60) break;
+                    a1[1][15] = (((v2 <= i8) < (a1[1][12] <= i8)) / 4);
+                    v3 = (((a0[7] - a1[3][14]) * (v2 < v3)) && ((a0[7] == i8) - (v3 * i8)));
+                    a1[3][1] = (((76 - v2) ? (a1[1][10] ? 16 : v1) : (v2 == v0)) == ((v3 && 82) > (v3 || v3)));
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((v1 || a1[1][11]) < (a1[0][13] ? v1 : v2)) <= ((v0 >= v1) - (66 / 2)));
+            v0 = (((a1[1][14] <= i8) % 6) / 4);
+            i8 = i8 + 1;
+        }
+    }
+    v3 = (((v0 - a0[11]) == (88 - v2)) < ((a0[13] == v1) >= (v3 * v3)));
+    {
+        int i10 = 0;
+        do {
+            a1[1][12] = (((v0 == 59) ? (i10 ? i10 : a0[3]) : (a1[3][1] + i10)) + ((48 <= v2) > (v3 && 86)));
+            for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+                v3 = (((v1 - i10) >= (a1[2][6] > a0[2])) ? ((2 < a1[2][3]) / 6) : ((a1[0][4] > v3) && (7 && 32)));
+                v1 = (((89 < i10) || (v1 || v0)) ? ((6 ? 92 : a0[13]) ? (v2 ? 67 : a1[1][7]) : (i11 % 6)) : ((v3 != 57) <= (a0[12] + a0[14])));
+                v0 = (((a0[15] <= 91) < (i10 ? v0 : v0)) + ((v3 ? a0[9] : a1[0][3]) ? (i10 == a1[0][15]) : (i11 >= v0)));
+            }
+            a1[3][4] = (((v1 - v2) / 1) >= ((a1[3][1] % 9) - (a1[0][15] && 60)));
+            i10 = i10 + 1;
+        } while (i10 < 5);
+    }
+    for (int i12 = 0; i12 < 3; i12 = i12 + 1) {
+        if ((a0[5] <= 47) > 78) break;
+        v2 = (((a0[9] - v3) / 2) + ((v2 >= 58) ? (91 || v3) : (i12 ? 11 : i12)));
+        for (int i13 = 0; i13 < 4; i13 = i13 + 1) {
+            a0[9] = (((a0[12] >= 34) ? (i12 != 43) : (37 < v3)) - ((a0[5] >= a1[3][2]) % 3));
+            a0[10] = (((a1[1][7] || a0[5]) != (v0 * v3)) >= ((v1 >= 89) ? (i13 != a0[4]) : (68 / 4)));
+            a1[2][10] = (((v0 + i13) % 7) % 3);
+        }
+        v0 = (((v1 - 13) ? (a1[0][14] <= v3) : (v3 > v3)) % 1);
+    }
+    return (((v0 * a1[0][11]) + (60 > a0[14])) ? ((17 ? v3 : a1[2][6]) >= (a0[1] / 7)) : ((a0[13] >= v3) && (v1 == v3)));
+}
+int f32() {
+    int v0 = 74;
+    int v1 = 97;
+    int v2 = 87;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 + v0) > (93 % 1)) - ((v1 - v0) < (v2 % 5)));
+    v0 = (((67 ? a0[2] : a0[12]) + (a0[11] <= a1[0][2])) || ((v1 != v1) <= (21 % 8)));
+    a1[1][12] = (((v1 > v0) % 8) > ((a0[12] ? a0[8] : v1) == (a0[0] % 4)));
+    if ((((v2 || 28) && (83 ? a0[13] : 26)) % 7)) {
+        v1 = (((39 && v0) ? (24 ? v3 : v2) : (v1 % 3)) * ((16 ? a0[11] : v3) - (v0 != v3)));
+        v3 = (((28 ? a0[6] : 84) % 3) >= ((10 * v3) != (a1[0][11] != v2)));
+        v2 = (((4 - v0) * (a0[13] % 3)) || ((v3 ? v2 : v1) ? (91 && v1) : (32 != a1[1][15])));
+    } else {
+        a1[3][2] = (((v1 <= v0) > (v0 ? v0 : 83)) - ((19 % 4) && (v2 ? v1 : 94)));
+        v2 = (((v3 * v0) != (a0[9] <= v0)) ? ((v1 - a0[2]) <= (57 <= a1[0][2])) : ((a0[8] == a0[14]) ? (99 >= v3) : (73 >= a1[3][7])));
+        v2 = (((v0 == 75) != (v0 - v0)) * ((v0 / 8) > (a0[0] ? v3 : v2)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((85 == 62) > 57) break;
+        a1[3][9] = (((a1[2][4] + a1[1][1]) && (v0 && v2)) / 5);
+        {
+            int i1 = 0;
+            do {
+                a1[0][13] = (((v0 < a0[1]) - (a1[2][2] < a1[3][10])) < ((v0 >= i1) ? (25 / 3) : (66 != a0[2])));
+                a0[8] = (((a1[0][2] > a1[2][0]) == (71 * 38)) ? ((i0 >= 50) + (v0 ? 85 : 59)) : ((90 > 81) / 9));
+                v2 = (((62 < a1[0][2]) && (86 && v0)) ? ((a1[1][2] ? 56 : a1[2][2]) == (v1 != v0)) : ((62 <= v1) >= (v0 || 83)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        a1[2][4] = (((a1[2][10] + i0) >= (a1[2][4] + a0[10])) || ((27 >= a1[1][3]) + (v1 ? 77 : a1[0][0])));
+    }
+    if ((((v1 || v1) < (a1[1][0] ? a1[2][9] : 55)) <= ((a0[12] / 7) ? (v0 < v2) : (v1 <= 20)))) {
+        v2 = (((v3 - v1) == (a1[2][5] * a0[15])) + ((v1 >= 69) != (71 ? v1 : 24)));
+        v1 = (((v1 ? v1 : 74) / 5) >= ((v1 == 77) < (a0[0] / 4)));
+        a1[0][1] = (((v1 <= v3) - (8 <= v2)) ? ((38 < a0[8]) % 6) : ((87 >= v3) / 6));
+    } else {
+        a0[0] = (((v3 + 89) + (a0[7] * 16)) && ((a0[7] * v3) % 8));
+        v2 = (((a0[12] * v3) ? (v3 < v1) : (v3 && a1[1][15])) - ((67 * v0) % 7));
+        v0 = (((v3 % 7) ? (33 * a1[1][13]) : (v2 && v1)) >= ((26 + v1) == (v1 || 28)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v0 = (((57 && i2) < (v0 % 4)) < ((97 > i2) != (a0[7] != a1[1][1])));
+        v2 = (((87 <= 98) + (i2 ? 18 : a1[1][14])) - ((v2 || 53) || (v2 ? 8 : v1)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v2 = (((v1 > 46) ? (v2 >= v1) : (i3 * 22)) <= ((74 - v3) < (79 >= 86)));
+                v1 = (((9 + v0) <= (v3 || v3)) + ((v0 && v0) < (a0[1] % 4)));
+                a0[9] = (((v3 > a1[2][10]) - (30 ? i3 : i3)) < ((31 ? a0[13] : 71) == (v1 < a1[2][13])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((i4 + v1) || (a1[3][11] ? v2 : v2)) || ((17 != i4) == (86 + a0[5])));
+                    v0 = (((a1[2][4] + v0) == (a0[2] / 6)) == ((v1 ? v3 : v3) <= (v3 % 5)));
+                    a0[15] = (((3 < i4) > (94 * 27)) / 4);
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            a1[1][9] = (((v3 ? 81 : 29) < (i4 <= v3)) || ((v0 % 8) * (v2 > v0)));
+            v0 = (((v1 / 1) < (38 != a0[2])) < ((a1[2][0] % 9) + (i4 + 58)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            if ((v0 / 3) > 77) break;
+            v0 = (((i6 && v3) - (v0 + v0)) < ((a1[2][10] * 95) * (86 % 8)));
+            v2 = (((a1[3][11] == a0[11]) * (9 % 2)) || ((i6 && 99) || (a1[1][1] == v0)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    a1[3][0] = (((v3 - v0) ? (76 < v1) : (v2 == 72)) + ((v1 ? v0 : v2) == (v1 * i7)));
+                    a0[7] = (((56 ? i7 : i7) > (a0[11] + a1[1][3])) / 8);
+                    v0 = (((i6 >= v3) - (a1[3][5] == 65)) != ((7 >= v1) == (50 * i7)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a1[1][7] * 63) <= (v3 / 3)) == ((v3 != v1) * (v3 || a0[6])))) {
+        v0 = (((70 ? a0[5] : v0) % 8) || ((v2 > v1) / 8));
+        v0 = (((a1[0][0] ? v1 : 25) > (v3 && v2)) ? ((v0 != 53) || (77 < v2)) : ((v3 - a1[2][8]) < (v0 / 7)));
+        v1 = (((a0[8] - v1) * (v1 > v2)) ? ((v2 % 7) ? (v0 % 9) : (a1[2][3] ? v0 : v1)) : ((v1 % 7) <= (a0[14] && 36)));
+    } else {
+        v3 = (((v3 && v3) - (v0 > v1)) && ((v0 ? a1[2][11] : v1) >= (58 == v1)));
+        v0 = (((99 / 9) - (v1 + a1[1][11])) * ((v1 * v0) >= (48 ? v2 : a0[13])));
+        v1 = (((71 / 9) + (v3 - 27)) > ((v2 + v1) == (30 < v1)));
+    }
+    return (((v1 ? v0 : 72) ? (v0 * v2) : (a0[2] / 1)) >= ((a1[1][15] * v2) == (a1[2][11] < v0)));
+}
+int f33() {
+    int v0 = 38;
+    int v1 = 59;
+    int v2 = 98;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v1 > a1[2][1]) > 81) break;
+            a0[4] = (((23 != a0[1]) * (69 < v1)) && ((v1 && 7) != (a1[3][6] && 79)));
+            a1[2][6] = (((v0 ? v3 : a1[1][14]) <= (43 && v3)) / 7);
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v0 = (((a1[1][4] + a1[0][9]) == (2 == 51)) + ((90 && a1[0][0]) ? (v3 - v2) : (76 != 3)));
+                v0 = (((95 && v3) > (v3 < 1)) <= ((v0 != 90) - (v1 ? v3 : 28)));
+                v3 = (((26 ? v3 : i0) / 7) + ((0 + a1[0][11]) && (73 * a0[6])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 * a1[1][8]) - (v0 <= a1[0][4])) >= ((v0 * v2) ? (31 - 78) : (85 == v1)))) {
+        v2 = (((v2 * a0[11]) >= (v0 - a0[14])) * ((v1 - 0) * (v1 < 37)));
+        a1[1][9] = (((v2 * v0) && (7 % 8)) <= ((a1[0][15] ? v3 : v3) != (a0[8] >= 24)));
+        v1 = (((v3 || v3) <= (v2 % 4)) || ((1 % 9) ? (59 ? 46 : v3) : (96 < v1)));
+    } else {
+        v1 = (((47 - a1[2][14]) != (v2 > a1[0][12])) % 9);
+        a1[3][10] = (((v0 || a1[2][13]) - (a0[13] || a0[14])) - ((a0[14] / 3) + (v0 >= 24)));
+        v2 = (((96 == v1) > (a1[0][9] - a0[14])) || ((v3 && 58) <= (v3 < a1[1][3])));
+    }
+    if ((((a1[0][0] / 2) < (a0[12] < v0)) % 2)) {
+        v3 = (((a0[7] * v1) < (v0 != v2)) || ((v0 || a1[3][0]) <= (v2 && v0)));
+        a1[1][7] = (((a0[15] ? v3 : a1[0][1]) == (v2 ? v0 : v1)) ? ((v1 != 57) + (v0 || 56)) : ((v3 == a1[0][3]) <= (v1 && v0)));
+        v1 = (((v1 > v1) <= (a0[6] + v3)) - ((67 ? v2 : a1[2][3]) && (a0[3] ? v2 : v1)));
+    } else {
+        v3 = (((92 ? a0[8] : v3) ? (a1[1][1] != 32) : (50 <= v2)) > ((v2 < a1[1][15]) >= (a0[5] > 99)));
+        a1[3][3] = (((85 < v3) || (10 ? 1 : v2)) * ((79 - 35) + (76 * 25)));
+        v2 = (((10 + 79) + (v2 == a0[12])) <= ((a1[2][10] * v2) && (a0[4] && 55)));
+    }
+    a1[2][3] = (((v2 != a0[1]) - (55 || a1[0][13])) - ((v1 % 9) * (v3 * v0)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v1 = (((i2 ? v1 : v1) || (87 * v0)) != ((i2 && v3) < (v0 < a1[0][7])));
+        {
+            int i3 = 0;
+            do {
+                a1[2][1] = (((v1 ? 86 : a1[1][6]) || (a1[2][4] ? v2 : v3)) > ((a0[2] * v3) >= (v2 ? i2 : v1)));
+                v0 = (((80 < i2) ? (61 + a0[4]) : (v1 && v2)) * ((a0[12] * v3) - (i3 > i3)));
+                a0[10] = (((a0[14] && v0) % 6) % 4);
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        a1[1][9] = (((v2 % 5) >= (v3 ? v3 : v2)) < ((a0[5] != i2) <= (v3 > v2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v0 = (((v2 == v3) - (67 <= a0[15])) <= ((a1[0][8] || v1) ? (i4 <= v3) : (81 * a0[4])));
+            v2 = (((2 ? 17 : 7) / 7) >= ((i4 ? i4 : v1) ? (v2 == 56) : (18 % 7)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((v0 <= v2) / 5) % 5);
+                    v2 = (((1 + v2) != (v0 != v3)) + ((95 == v2) <= (63 * v2)));
+                    a1[1][7] = (((a0[0] > a0[2]) >= (v2 && a1[2][1])) != ((v2 <= v2) / 2));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    a1[0][14] = (((a0[12] == a0[15]) > (v2 - v0)) == ((v0 ? v0 : v3) % 2));
+    a0[4] = (((v1 + v1) % 6) < ((76 * v0) + (v2 != 98)));
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        a0[12] = (((a1[2][2] - 0) % 7) % 4);
+        v2 = (((97 != i6) * (v0 - v3)) + ((i6 || v2) - (15 ? 70 : v3)));
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            v3 = (((v2 < i7) + (92 / 5)) <= ((i7 == 23) ? (v3 || a0[6]) : (96 ? 32 : v0)));
+            v1 = (((a0[3] * a0[7]) * (a1[0][7] >= 47)) * ((a0[1] ? 38 : 2) / 4));
+            a0[9] = (((a0[7] == a0[1]) > (a0[5] ? a1[1][15] : a0[6])) < ((v1 <= 83) + (a0[2] * v1)));
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            v0 = (((64 < 15) <= (v1 >= a0[8])) + ((a0[9] == v3) > (v2 || 43)));
+            {
+                int i9 = 0;
+                while (i9 < 6) {
+                    a1[2][11] = (((i9 || 26) <= (39 ? a1[0][3] : 8)) ? ((v0 != v1) < (i9 >= i9)) : ((v3 != a0[2]) <= (10 / 1)));
+                    v0 = (((v2 < i9) / 7) || ((60 > a0[5]) || (64 * a0[8])));
+                    v3 = (((v3 > 30) == (a1[2][6] || i8)) <= ((35 % 5) >= (v0 == 20)));
+                    i9 = i9 + 1;
+                }
+            }
+            v0 = (((22 + 87) + (v0 - v0)) != ((35 ? a0[8] : 25) * (v3 ? 2 : a1[1][15])));
+            i8 = i8 + 1;
+        }
+    }
+    return (((v3 - a0[3]) - (42 <= 36)) - ((45 * 74) / 6));
+}
+int f34() {
+    int v0 = 0;
+    int v1 = 13;
+    int v2 = 88;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((a1[2][9] > v0) > 55) break;
+        v0 = (((v3 + v1) % 9) && ((a1[2][9] / 8) < (i0 < 53)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v1 = (((a0[13] + 60) ? (v1 || v0) : (i1 != v0)) > ((i1 != i0) % 8));
+            v1 = (((v0 > v0) >= (98 ? a1[3][3] : 94)) || ((48 ? a0[15] : 40) != (a1[3][10] % 6)));
+            v0 = (((a1[2][7] ? v1 : i0) / 2) && ((a1[0][11] <= a0[1]) ? (v0 != v1) : (i0 / 4)));
+        }
+        v0 = (((v3 + 11) <= (29 && v3)) && ((i0 >= a1[3][0]) != (v3 - 53)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((93 || v1) >= (v2 / 9)) == ((2 > 59) == (v1 / 8)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a1[3][1] = (((v0 < 45) || (i3 < v1)) <= ((i3 - i2) || (v3 > 25)));
+                    v2 = (((v0 + i2) < (i3 + v3)) == ((v0 / 5) == (v2 || v2)));
+                    v3 = (((a0[11] != a0[6]) * (a1[1][0] + 29)) == ((50 % 6) >= (23 / 4)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v3 >= i2) == (v2 / 1)) % 6);
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((a1[2][2] * 61) && (v3 ? v3 : v1)) != ((a0[5] != v1) % 6))) {
+        v2 = (((20 * v0) ? (v1 || a1[3][4]) : (47 < 66)) <= ((v0 + v2) != (a1[3][7] == 76)));
+        v1 = (((70 - 5) && (v2 && 49)) + ((80 ? v3 : v0) > (a0[11] / 5)));
+        v1 = (((85 ? a1[3][0] : a0[0]) * (a1[3][2] ? v2 : a0[14])) ? ((v3 < 47) >= (a0[13] == 21)) : ((73 ? a0[4] : 48) > (a1[1][1] >= v0)));
+    } else {
+        v2 = (((v2 != a0[14]) != (a0[15] + 16)) && ((v0 * 31) || (v0 || 6)));
+        v1 = (((94 >= 66) > (v3 > v0)) + ((v2 ? v0 : 5) != (6 != v0)));
+        v2 = (((64 < v2) ? (v0 < v0) : (34 ? a0[15] : v1)) - ((v1 && 14) ? (v0 != 27) : (v3 ? v0 : 59)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((a0[9] - v2) == (v0 < a0[5])) % 2);
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((57 == v3) > 60) break;
+                v3 = (((a0[4] && i5) > (v3 * v1)) > ((a1[1][13] < v3) != (i4 * a0[2])));
+                a1[2][6] = (((i5 > 55) ? (a0[11] != 45) : (v0 || a0[5])) > ((a1[3][10] || 46) != (a1[0][5] ? 74 : 34)));
+                v0 = (((i5 != i5) ? (i5 * a0[13]) : (v0 || a1[2][1])) * ((20 - 63) - (a1[2][1] > v1)));
+            }
+            a1[2][5] = (((a0[1] + v2) / 3) - ((a0[2] == a0[12]) != (30 <= v1)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    v2 = (((74 - 44) - (v2 < 90)) <= ((a0[0] != v2) / 3));
+    v0 = (((a0[10] && 93) * (a0[3] < 30)) / 3);
+    v1 = (((v0 || v1) % 7) % 8);
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((82 % 3) >= (v1 > a1[2][1])) > ((a1[2][9] > a0[8]) - (v3 + 26)));
+                    a1[3][0] = (((i6 || a0[8]) + (i6 && a0[8])) != ((a1[3][14] <= v3) && (v3 / 1)));
+                    a1[3][15] = (((a0[2] >= i7) % 7) * ((a1[3][14] != i7) >= (i6 * v3)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            v1 = (((v1 >= a0[6]) - (a1[1][6] < a0[8])) == ((v1 != 78) - (v2 / 6)));
+            a1[2][15] = (((a0[5] % 8) || (v3 >= v3)) % 2);
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((v0 < v1) - (38 || v1)) ? ((i9 != 45) == (a0[10] < i8)) : ((v0 - v1) >= (18 % 1)));
+                    v1 = (((v0 / 4) < (v0 / 2)) ? ((a0[5] > a1[0][7]) ? (53 <= 34) : (38 <= v2)) : ((v1 % 9) - (64 >= 4)));
+                    v2 = (((22 && v0) ? (i8 >= a0[8]) : (i8 != a1[3][14])) / 5);
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            v1 = (((a1[0][13] || 52) != (a1[1][4] * 1)) ? ((v1 == a1[3][9]) - (a0[8] * a1[0][6])) : ((a0[4] ? 24 : 28) == (v0 % 6)));
+            a1[0][3] = (((v3 % 5) || (v0 ? v1 : v2)) ? ((77 / 4) && (74 < a0[9])) : ((v3 != 99) && (v3 < i8)));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v2 || a0[13]) ? (82 < v3) : (61 / 8)) && ((v2 + 37) ? (a1[1][4] == v1) : (v0 || v1)))) {
+        v2 = (((19 && 34) ? (v3 <= v3) : (a1[0][2] % 5)) && ((v1 >= 93) == (a1[1][4] ? 43 : v2)));
+        v0 = (((74 > 55) % 1) < ((v1 >= v1) % 8));
+        v0 = (((68 ? 23 : v1) > (a1[0][9] ? v1 : a1[0][10])) - ((68 != v1) >= (13 < v3)));
+    } else {
+        a1[0][6] = (((v0 + v1) || (68 > v1)) ? ((31 <= a0[2]) / 5) : ((20 ? v3 : 56) <= (75 / 9)));
+        a0[7] = (((51 == 62) - (v1 - 59)) % 3);
+        v0 = (((v0 == v3) / 9) ? ((v2 / 7) + (v1 - v1)) : ((a0[3] ? a1[1][14] : v0) <= (v1 ? 84 : v2)));
+    }
+    return (((v2 >= 90) * (a1[0][14] && 51)) / 2);
+}
+int f35() {
+    int v0 = 0;
+    int v1 = 24;
+    int v2 = 57;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v1 || 72) == (v0 * i1)) + ((a0[10] + a0[14]) > (a0[11] != a1[3][8])));
+                    a1[1][8] = (((v3 + v2) * (v2 && v0)) % 2);
+                    v0 = (((a0[14] <= a0[4]) / 3) == ((18 / 1) >= (v0 > a1[2][4])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v3 = (((i0 ? v2 : v0) <= (i0 ? v3 : 48)) == ((v1 < i0) >= (v3 % 4)));
+            v0 = (((a1[1][11] - v1) > (a1[3][3] >= 87)) && ((a1[0][2] > a0[10]) || (a0[6] / 8)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 && v1) ? (66 / 8) : (v3 / 4)) <= ((v0 < v2) > (v3 % 5)))) {
+        v1 = (((v0 - v0) ? (35 - 70) : (v3 < v2)) + ((27 || a0[6]) && (v1 - a0[13])));
+        a1[3][13] = (((v2 + a1[1][15]) >= (80 == 98)) * ((a0[3] ? v3 : v1) + (v3 || v3)));
+        v0 = (((v2 >= 72) || (18 >= 72)) % 1);
+    } else {
+        v0 = (((52 ? v0 : a0[11]) != (5 > 7)) > ((a1[2][0] < 27) < (v0 || v1)));
+        a0[11] = (((v2 == 15) % 7) - ((v2 + v1) * (v0 * a0[14])));
+        v2 = (((a0[10] == 57) != (v2 && 37)) + ((a0[10] != v1) - (1 < v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[2][14] <= 65) > 54) break;
+            v3 = (((i2 ? a0[3] : v2) > (v0 * 86)) == ((v3 <= v3) < (92 < 97)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a0[10] = (((v3 != a0[6]) + (a0[4] % 5)) >= ((a1[0][4] && v1) == (a1[1][8] || i2)));
+                    v0 = (((v2 != 1) && (99 * 25)) >= ((v0 >= i2) || (2 >= v0)));
+                    v3 = (((a1[2][6] <= v2) < (v2 - i2)) != ((27 < 37) < (a1[1][5] ? i2 : 58)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[0][4] = (((v0 != 46) ? (v3 * 43) : (a0[12] == v1)) <= ((4 * v3) + (v0 <= v3)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v3 < 29) > 64) break;
+            v0 = (((v0 && 91) + (a0[6] >= v1)) < ((v2 - i4) ? (v2 ? v0 : 31) : (i4 != i4)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((85 < 26) && (58 + 19)) ? ((v3 < v3) || (v2 && a1[3][14])) : ((i5 == a0[6]) - (a1[2][3] % 9)));
+                    v2 = (((i5 - v2) && (a1[0][8] == a0[3])) % 4);
+                    v0 = (((v0 <= v1) / 8) != ((a1[0][14] - a1[1][10]) >= (a0[12] % 3)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[0][1] = (((63 == 33) <= (52 ? 87 : 9)) < ((a1[1][7] >= a0[1]) || (v0 || v0)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v1 = (((v2 * v3) >= (7 != a1[3][11])) != ((7 != a0[13]) == (45 != a0[11])));
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            v1 = (((v1 != a1[1][5]) || (31 > v2)) ? ((a0[9] > 78) - (v0 + i6)) : ((v3 != v3) <= (a0[1] == v3)));
+            v2 = (((v2 == v1) - (a0[7] / 7)) != ((a0[10] + 25) > (79 > v1)));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    if ((v0 >= v3) > 61) break;
+                    a1[3][4] = (((i6 || v1) > (v2 && 95)) <= ((v2 != a1[0][10]) * (0 ? a1[0][14] : v1)));
+                    a0[8] = (((a1[1][4] == 79) || (10 - v0)) + ((v0 / 3) <= (4 == a1[1][12])));
+                    a0[2] = (((43 && 30) >= (i6 * v1)) - ((i6 * v3) && (a1[3][10] % 3)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((8 / 3) == (v2 < 91)) > ((v0 + v1) <= (53 < v2)))) {
+        v1 = (((a0[1] != 82) || (20 != 75)) - ((a1[3][15] * v3) > (v1 <= 93)));
+        a0[5] = (((96 ? 44 : v3) <= (a0[5] ? a0[14] : 51)) && ((2 == 21) != (26 == 88)));
+        v3 = (((a1[2][7] >= a0[7]) - (a0[12] > a0[4])) - ((v2 / 7) != (a0[10] + v2)));
+    } else {
+        v2 = (((v1 || a1[1][5]) + (v3 && v2)) > ((a0[10] || v0) % 5));
+        a1[3][6] = (((v3 > v1) == (a1[1][3] || 1)) == ((v3 && v3) ? (v1 > 99) : (v2 * v2)));
+        v3 = (((v2 + v1) < (v0 < v1)) == ((v2 == v0) - (79 ? v0 : a0[11])));
+    }
+    a1[0][4] = (((30 < v2) - (27 == a1[0][13])) >= ((a0[0] - a1[2][8]) ? (v2 && v0) : (a0[5] - v1)));
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            v0 = (((v1 < i8) ? (v0 * a1[3][2]) : (74 || v0)) % 7);
+            v1 = (((v3 > i8) || (v1 ? v3 : a1[0][1])) + ((i8 / 5) || (a1[1][0] < 46)));
+            for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+                a0[0] = (((v3 ? v2 : a1[3][0]) <= (v3 > a1[2][3])) % 8);
+                v2 = (((i9 + v0) > (a1[1][14] / 5)) + ((i9 >= 74) == (v1 ? v3 : i9)));
+                v0 = (((a1[1][15] > a1[2][2]) >= (v0 * v2)) <= ((v1 >= 38) + (v2 * a0[15])));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 6) {
+            v2 = (((i10 > 18) ? (v2 ? v0 : a1[2][8]) : (45 != v3)) != ((14 != 65) > (i10 % 2)));
+            v0 = (((v3 && 8) <= (v1 * a0[8])) || ((a0[5] - 3) || (v0 >= a0[14])));
+            {
+                int i11 = 0;
+                do {
+                    v1 = (((v3 == v1) - (52 || v1)) && ((35 <= v0) > (a0[0] - i10)));
+                    a1[0][7] = (((v0 - i11) == (v3 > v2)) < ((v0 || v3) >= (a0[2] > a1[0][7])));
+                    a1[3][0] = (((a1[1][6] || a1[0][14]) ? (v1 + i11) : (v2 ? v1 : i10)) + ((v1 % 1) ? (70 ? i11 : a0[13]) : (v3 || v3)));
+                    i11 = i11 + 1;
+                } while (i11 < 5);
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((v3 == v3) != (a0[5] ? a0[4] : a0[12])) <= ((v3 < v2) ? (v3 || 65) : (a1[3][1] - 71)));
+}
+int f36() {
+    int v0 = 60;
+    int v1 = 55;
+    int v2 = 4;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    a1[1][7] = (((72 % 5) > (91 && 85)) < ((v1 != 77) - (v2 <= v0)));
+    if ((((v2 != 12) * (v2 - 84)) ? ((v2 * v1) && (v2 ? v0 : v1)) : ((v1 != a1[3][7]) % 1))) {
+        a0[10] = (((64 + v2) / 1) || ((a0[9] - a0[0]) || (v0 - v1)));
+        a1[3][15] = (((v2 * 76) != (4 != a0[10])) + ((a0[3] * 28) < (v2 / 9)));
+        v1 = (((31 + 20) % 3) % 2);
+    } else {
+        v0 = (((a1[1][0] != v3) >= (v2 ? a0[11] : v0)) < ((a0[5] || 48) + (v1 + a1[1][12])));
+        v1 = (((a0[2] == v2) % 7) / 3);
+        v2 = (((v1 * v0) == (v3 % 8)) != ((v2 && v3) % 5));
+    }
+    v3 = (((a0[9] - v3) || (a0[8] || v2)) <= ((43 + v2) && (v0 + a1[0][8])));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (((v1 / 9) / 9) <= ((i0 > v0) - (a1[1][6] > i0)));
+        a1[2][6] = (((i0 != v1) <= (v2 * a0[3])) <= ((v1 == 57) ? (v1 < 8) : (v1 != a0[6])));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v1 = (((i1 - a1[2][4]) % 3) > ((72 > a1[0][4]) == (i0 ? i1 : a0[5])));
+                v1 = (((i0 - 73) == (58 - v0)) != ((77 && 65) ? (i1 % 7) : (a0[10] >= v1)));
+                v0 = (((i1 - a1[0][6]) > (a1[3][10] || v2)) ? ((i0 % 5) && (i0 ? i0 : a1[2][1])) : ((v1 > i0) == (i1 / 6)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    if ((((v2 % 4) + (4 > v1)) && ((v0 >= 48) ? (a1[1][0] + a1[2][12]) : (a1[3][10] > 77)))) {
+        v1 = (((v3 || v1) >= (63 ? v1 : 4)) >= ((91 / 1) ? (a1[3][3] > a0[2]) : (74 % 2)));
+        v0 = (((v3 + v0) || (62 ? v2 : v3)) ? ((a1[3][2] / 3) <= (a1[2][3] >= v2)) : ((v0 <= 14) == (3 <= 67)));
+        v2 = (((v3 >= a0[8]) == (v2 + v0)) >= ((a1[1][1] % 8) > (a1[0][1] % 7)));
+    } else {
+        v3 = (((a1[0][8] * a1[3][1]) >= (15 * 44)) == ((40 * v2) > (a1[3][0] / 6)));
+        v2 = (((a1[0][15] || 22) * (52 / 2)) % 1);
+        v1 = (((99 && a0[9]) % 6) / 4);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((a0[14] / 3) > 59) break;
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                a1[3][9] = (((v1 > 55) == (v3 != i3)) + ((v2 < v0) * (97 || v3)));
+                a1[0][0] = (((93 >= i3) + (a0[5] + i3)) >= ((a0[7] ? i2 : 55) == (a1[0][6] + 16)));
+                v1 = (((v3 > 37) > (a1[3][9] >= v1)) && ((a1[0][5] == 78) && (v0 ? 46 : i3)));
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((9 ? a1[3][12] : v3) > (v3 != a1[3][6])) * ((a1[0][10] == a0[15]) == (v2 / 9)));
+        a1[2][12] = (((i2 || v3) / 5) / 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v3 * a1[0][2]) > 88) break;
+            {
+                int i5 = 0;
+                do {
+                    a1[3][5] = (((87 - i5) ? (v2 > i5) : (i4 * a0[9])) != ((i5 > v2) > (v0 <= i5)));
+                    v2 = (((i4 * i4) - (i4 <= v0)) / 5);
+                    v1 = (((a1[0][9] && v3) / 5) || ((v3 * i5) ? (v1 || a0[13]) : (i5 != 28)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v0 = (((v1 != 58) > (a1[2][5] < a0[2])) ? ((a0[2] != a1[1][3]) <= (9 * a0[0])) : ((i4 != 86) == (1 % 2)));
+            a1[2][13] = (((v1 != v2) ? (69 == a1[0][13]) : (34 == a0[12])) < ((77 * a1[1][3]) && (82 < 65)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    a1[3][10] = (((a1[3][0] > a1[0][1]) && (a1[1][5] / 1)) % 2);
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            v3 = (((i7 < 41) / 3) - ((90 > i7) <= (a0[9] >= a1[1][10])));
+            a0[14] = (((a1[1][1] + v1) + (v3 - i6)) + ((v1 - 56) > (a1[2][12] * i6)));
+            a1[1][11] = (((15 != i7) >= (v2 <= v0)) ? ((v1 || a0[5]) % 1) : ((v1 / 5) + (v2 ? 47 : 75)));
+        }
+        v1 = (((v2 || a1[3][13]) - (i6 <= v1)) && ((v2 % 7) <= (v3 && 65)));
+        v2 = (((i6 % 2) >= (v2 != a1[1][10])) / 5);
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[3][9] = (((90 / 2) <= (30 + v1)) < ((51 != 40) * (v2 * i8)));
+            a0[15] = (((a0[4] || i8) >= (a1[3][6] < v2)) > ((a0[10] % 4) ? (88 % 9) : (a1[1][14] / 8)));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                a1[0][9] = (((i8 && v0) <= (v3 != v2)) != ((i9 / 4) <= (82 == v1)));
+                v1 = (((91 == 33) && (v3 ? i8 : 63)) - ((v0 ? a0[13] : 9) + (v0 && a0[3])));
+                v2 = (((i8 != 23) > (v2 ? v1 : 25)) * ((a0[15] <= v2) <= (i8 + v0)));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    return (((v1 / 3) ? (56 <= 35) : (a0[6] > a0[1])) / 4);
+}
+int f37() {
+    int v0 = 31;
+    int v1 = 87;
+    int v2 = 50;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    if ((((91 && v3) + (v0 / 9)) < ((a1[3][7] != v1) >= (a1[3][2] < v2)))) {
+        v1 = (((a1[1][10] > a0[6]) <= (v2 <= v2)) != ((a1[3][6] % 2) <= (28 > 65)));
+        a0[5] = (((v0 / 4) && (a0[9] ? 65 : a0[13])) ? ((73 / 8) ? (a0[11] || 25) : (v1 / 9)) : ((v0 - v0) ? (a0[13] % 6) : (48 == v2)));
+        a0[10] = (((a0[5] / 6) && (v1 < a0[15])) ? ((19 < v2) < (v0 % 1)) : ((58 <= v1) >= (a0[5] ? a1[0][4] : 3)));
+    } else {
+        v2 = (((v3 > v0) != (v1 % 6)) % 4);
+        a0[15] = (((a0[12] < a0[5]) ? (a1[1][3] < v2) : (81 < v3)) || ((a1[2][13] - 18) >= (a1[3][4] * v2)));
+        v0 = (((96 > 75) || (v1 ? v2 : 81)) / 5);
+    }
+    if ((((v3 % 9) - (31 / 6)) / 8)) {
+        a0[7] = (((a0[10] && v3) - (v1 || v3)) >= ((v2 % 1) < (v0 && v1)));
+        v2 = (((66 > v2) == (a0[0] + v3)) - ((v3 * a0[11]) > (v1 == v1)));
+        v2 = (((a0[15] - 99) % 8) / 8);
+    } else {
+        v0 = (((a1[0][7] % 9) != (a0[7] * 73)) ? ((v2 >= a0[12]) <= (a0[5] || v0)) : ((v3 ? 76 : v1) / 7));
+        a1[3][12] = (((v2 <= a1[3][4]) - (a0[5] % 5)) ? ((25 >= 26) >= (5 || v2)) : ((v2 - a0[4]) + (a1[1][12] - v2)));
+        v0 = (((20 < v0) - (v1 ? a0[0] : v2)) >= ((19 - v2) * (a1[3][8] < v0)));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                if ((25 * 52) > 85) break;
+                a1[1][13] = (((v2 - a1[3][5]) != (v2 - v3)) % 8);
+                v0 = (((i1 >= i1) + (i0 - 41)) - ((v3 ? v2 : a0[15]) * (47 / 3)));
+                v0 = (((70 >= a1[0][11]) || (i1 && 97)) ? ((76 >= i1) || (v0 >= v0)) : ((v1 <= v3) < (21 <= v2)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[2][4] = (((98 || 26) - (a0[3] ? 75 : 60)) <= ((i0 < 68) < (a0[9] ? a1[1][4] : 40)));
+        v0 = (((a0[11] || v0) && (a1[3][14] ? v1 : a0[8])) / 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((v3 != 17) > 63) break;
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v0 = (((40 || 73) != (52 && v0)) - ((a0[13] - 80) || (i2 - a1[1][11])));
+                v2 = (((66 - v1) >= (21 >= 36)) ? ((i3 >= v3) > (v1 / 4)) : ((v3 == v2) != (v1 / 6)));
+                v2 = (((v3 + i2) * (v1 <= 55)) / 8);
+            }
+            v1 = (((v3 % 1) % 6) - ((v3 / 8) >= (i2 + v2)));
+            v2 = (((1 ? v3 : 53) > (v0 && i2)) == ((84 % 1) * (v2 >= 28)));
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((a0[11] == v0) < (v0 >= a0[14])) > ((v2 < 32) && (a0[3] < 8)));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v1 = (((a0[5] * i4) && (v3 ? 25 : i4)) || ((a1[2][1] + v3) && (v2 != 53)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    a1[0][6] = (((84 != a0[15]) ? (a0[0] >= i5) : (v3 < v0)) % 5);
+                    a1[0][12] = (((a0[6] % 4) % 7) ? ((v0 && i5) < (73 / 3)) : ((23 || 1) - (v3 >= 5)));
+                    v1 = (((86 ? v0 : 28) || (29 / 5)) < ((v0 ? v2 : 74) ? (i5 - v0) : (i5 % 7)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((i4 == a1[0][8]) == (v2 > a1[0][9])) + ((89 != 77) || (v3 ? v1 : v1)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                a1[2][4] = (((v0 < v3) % 4) + ((i7 + a0[13]) != (v0 && 50)));
+                v0 = (((i7 > a0[5]) + (v1 == 89)) / 3);
+                v2 = (((v2 ? a0[1] : a1[3][13]) % 9) >= ((v2 / 6) <= (a1[2][9] + i7)));
+            }
+            a1[0][0] = (((v0 - v3) ? (20 >= v1) : (a0[14] ? 93 : a1[3][13])) == ((v2 + v1) && (v1 && 99)));
+            v1 = (((v3 != v0) ? (a0[12] <= 1) : (28 || i6)) == ((v2 == a1[1][15]) ? (v3 ? a0[1] : a0[10]) : (a1[3][2] - a0[12])));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        a1[1][1] = (((a1[3][12] == 20) + (v2 % 4)) <= ((a0[3] - i8) != (i8 * i8)));
+        v0 = (((v0 % 4) - (a0[3] > i8)) * ((a1[2][8] <= v2) != (66 || 24)));
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                v0 = (((85 ? i8 : a0[5]) != (13 == v3)) - ((a1[2][13] >= v3) / 6));
+                v3 = (((i9 >= a1[1][0]) != (a1[1][1] / 3)) > ((96 / 5) ? (v2 ? 2 : a0[7]) : (v3 || v0)));
+                v2 = (((v0 % 8) * (i8 % 2)) != ((51 && v2) > (46 % 2)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 3) {
+            v3 = (((v3 <= v3) ? (v0 != 51) : (v2 - v1)) && ((67 != v2) > (v3 + a1[2][14])));
+            {
+                int i11 = 0;
+                while (i11 < 4) {
+                    a0[13] = (((69 <= 88) == (a1[0][15] <= i10)) ? ((a1[3][8] < v1) * (i11 / 4)) : ((v3 == 10) > (v2 == v2)));
+                    a1[1][7] = (((i11 + 86) >= (47 ? 29 : v2)) - ((a0[4] && v0) % 1));
+                    v3 = (((v2 && v3) == (i10 / 8)) <= ((v2 ? 61 : v1) < (v0 <= i10)));
+                    i11 = i11 + 1;
+                }
+            }
+            a0[4] = (((83 > v2) % 9) && ((55 && 5) % 6));
+            i10 = i10 + 1;
+        }
+    }
+    {
+        int i12 = 0;
+        do {
+            {
+                int i13 = 0;
+                do {
+                    if ((v3 || v1) > 96) break;
+                    a1[3][9] = (((v2 * v0) + (v2 ? i12 : v1)) + ((a1[0][9] - a0[12]) / 1));
+                    v2 = (((i12 + 34) && (v2 + 18)) <= ((9 + a1[1][15]) < (v2 ? a0[0] : a1[0][5])));
+                    v3 = (((3 > 61) ? (a1[2][12] > 67) : (v1 ? v0 : a1[0][14])) == ((55 && a0[12]) % 6));
+                    i13 = i13 + 1;
+                } while (i13 < 4);
+            }
+            v3 = (((a0[15] - v2) != (86 > v1)) / 9);
+            a0[8] = (((18 % 8) ? (i12 < v2) : (v1 * v3)) >= ((15 < v0) <= (v2 % 9)));
+            i12 = i12 + 1;
+        } while (i12 < 5);
+    }
+    return (((v3 && 18) >= (a1[0][7] == v3)) + ((a0[3] == v1) <= (v0 < v3)));
+}
+int f38() {
+    int v0 = 92;
+    int v1 = 11;
+    int v2 = 78;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a0[6] != v3) % 7) ? ((v2 ? a1[1][2] : v2) ? (v0 == 5) : (a0[14] % 1)) : ((58 > v0) >= (a1[0][8] >= a0[10])));
+    v0 = (((56 ? a1[1][7] : 82) > (a0[6] / 8)) / 9);
+    if ((((v2 * v0) >= (77 * 36)) == ((v2 < a0[6]) || (64 || a1[3][10])))) {
+        v2 = (((v0 != a1[1][7]) <= (v1 ? 55 : 93)) * ((v1 || v1) * (v2 > 97)));
+        v2 = (((a1[3][10] % 9) != (v0 == v1)) / 8);
+        v1 = (((a1[1][0] < a1[2][10]) || (21 != v0)) || ((61 / 2) + (a1[2][13] ? 89 : a1[1][12])));
+    } else {
+        a1[2][5] = (((a0[3] >= 58) >= (60 <= v2)) / 1);
+        v2 = (((v2 && a1[0][15]) ? (v0 ? 69 : 32) : (v1 ? 49 : v1)) ? ((v0 ? v3 : 78) < (v2 > 96)) : ((37 && v3) >= (v2 < v0)));
+        v1 = (((v0 || v0) != (v2 <= 72)) != ((12 <= v3) / 3));
+    }
+    a1[0][10] = (((25 && v3) % 5) || ((43 < 34) * (v1 > v3)));
+    v2 = (((a1[2][2] <= v3) <= (a1[1][14] || a0[13])) - ((55 / 6) % 7));
+    v2 = (((24 && 18) / 1) % 4);
+    {
+        int i0 = 0;
+        do {
+            if ((v0 + i0) > 57) break;
+            v3 = (((a0[12] + a0[7]) <= (v1 == v2)) && ((43 ? 12 : v2) != (a0[6] != 63)));
+            v2 = (((i0 || 48) > (12 >= v2)) + ((v2 ? a0[5] : v0) - (a0[7] + a1[2][3])));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((i0 >= 52) > 95) break;
+                v2 = (((a1[1][0] != 86) - (30 < 94)) + ((21 < a1[0][11]) / 8));
+                v2 = (((22 >= a0[2]) > (v2 >= 58)) + ((9 && a1[2][10]) || (i0 ? 66 : a1[3][4])));
+                a0[4] = (((a0[9] <= v2) >= (68 % 5)) && ((81 > a1[0][3]) != (i0 - a0[3])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    a1[3][5] = (((86 - v0) ? (v3 <= v0) : (a0[5] || 95)) + ((v1 && v2) && (54 * v0)));
+    v2 = (((v0 / 5) * (v2 > v3)) ? ((v1 - v1) == (v3 != v3)) : ((84 < a0[9]) == (a0[5] ? 3 : 73)));
+    a1[3][8] = (((a0[6] || v1) && (v1 >= a1[1][8])) ? ((a1[2][6] + 24) ? (v0 + a1[2][3]) : (a0[4] == a1[1][7])) : ((v2 > v2) ? (51 + v2) : (v0 % 2)));
+    return (((a1[3][0] / 1) - (58 * v2)) * ((72 > a0[5]) >= (v0 ? a0[13] : a1[1][2])));
+}
+int f39() {
+    int v0 = 79;
+    int v1 = 16;
+    int v2 = 56;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((v2 && i0) == (70 * 45)) + ((v0 <= v0) != (v1 - 25)));
+            a0[14] = (((13 ? a0[7] : a1[0][1]) < (72 >= a1[3][0])) ? ((10 ? v3 : v2) >= (v0 - v0)) : ((a0[1] >= 54) > (v2 > i0)));
+            {
+                int i1 = 0;
+                do {
+                    a1[1][10] = (((92 > a0[4]) / 1) - ((v1 || v2) > (20 || 30)));
+                    a0[2] = (((v1 <= a0[12]) ? (4 >= 61) : (6 || i1)) <= ((a0[8] - 83) * (a0[2] * a0[9])));
+                    a1[2][6] = (((i1 + v3) * (v2 / 6)) * ((i1 <= v0) * (i0 > a1[0][15])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 * a0[8]) - (v2 % 5)) > ((v0 == a1[1][1]) ? (v0 >= a0[2]) : (v3 ? v2 : 72)))) {
+        a1[2][7] = (((v0 || a1[2][1]) % 7) >= ((v3 % 7) ? (v0 != 38) : (a0[15] <= v3)));
+        a0[1] = (((v1 > v1) + (a0[10] + v2)) < ((v2 && v3) >= (a1[1][10] * a1[1][11])));
+        v2 = (((39 > a0[13]) - (a0[4] == v2)) - ((v2 != v3) < (v3 % 6)));
+    } else {
+        a1[2][7] = (((a0[1] % 8) + (v3 != 99)) - ((v3 * v3) != (v2 < v2)));
+        v3 = (((99 <= v2) + (74 % 9)) || ((31 / 8) == (a0[15] < a0[11])));
+        a1[2][13] = (((57 >= a0[2]) < (v0 || v0)) != ((v0 > v1) < (a1[0][4] == v1)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                v1 = (((v0 == a0[11]) && (i3 != 50)) + ((a0[15] < 96) <= (v2 || v3)));
+                a0[15] = (((v3 + v1) == (a0[2] + i2)) * ((68 || v1) >= (v1 > v2)));
+                v2 = (((65 + i2) || (v2 - v2)) || ((v2 + 4) ? (a0[2] / 8) : (36 != v2)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((82 - v1) && (a0[13] ? 15 : i2)) != ((25 == a0[5]) ? (a0[3] - 78) : (a0[10] + 16)));
+        a1[3][14] = (((64 - a1[0][10]) / 4) && ((62 && v2) % 7));
+    }
+    a1[3][11] = (((35 == v3) / 6) / 2);
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a1[2][11] = (((i5 + i5) * (v1 && i5)) * ((v3 - 52) ? (98 < v2) : (i4 - 12)));
+                    v3 = (((88 || 55) + (i5 - v1)) / 8);
+                    v2 = (((a1[1][10] > a0[10]) * (a0[7] < v1)) >= ((i4 >= i5) >= (i5 >= v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v0 = (((v3 < v2) * (13 / 1)) <= ((a1[2][13] > v0) >= (v1 <= a0[9])));
+            v3 = (((v0 * v0) ? (a0[0] * v3) : (a1[0][13] % 4)) + ((v0 < 21) != (v3 + 10)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    if ((((v3 / 7) && (59 == v2)) >= ((v3 * v3) <= (v1 ? v3 : v0)))) {
+        v1 = (((v0 && v2) != (a0[5] / 4)) <= ((v2 / 4) % 1));
+        v0 = (((v1 <= a0[2]) + (a0[13] > v1)) == ((a1[0][10] && 11) >= (v2 > v2)));
+        v3 = (((28 + 31) != (a0[11] ? a1[2][2] : v1)) * ((v3 % 4) * (v0 == v1)));
+    } else {
+        a0[15] = (((a0[3] * v3) != (a0[6] < v2)) + ((a1[2][8] - a1[0][8]) || (a0[11] / 1)));
+        v3 = (((v0 >= a1[0][6]) <= (v1 - a1[1][0])) >= ((37 - v0) > (a0[7] && v0)));
+        v2 = (((89 > a0[6]) != (41 % 4)) >= ((a1[2][13] >= 86) <= (a0[2] && v0)));
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        if ((a1[0][9] || v0) > 58) break;
+        v0 = (((i6 / 1) || (v2 / 7)) * ((a0[11] != a0[8]) && (a0[6] != 34)));
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            v0 = (((v3 <= 39) <= (v1 >= i6)) % 4);
+            a0[14] = (((v1 <= v2) % 3) >= ((a0[7] + i6) ? (v1 - i7) : (v3 > 81)));
+            v2 = (((a0[7] % 3) >= (v3 < 40)) > ((v3 ? i6 : v0) / 9));
+        }
+        v0 = (((v2 % 5) && (a1[2][3] / 8)) ? ((v0 >= 36) >= (v3 / 9)) : ((a1[1][12] && v2) + (33 / 4)));
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        if ((a0[14] == a0[1]) > 54) break;
+        v2 = (((v0 <= v1) > (i8 || a1[1][14])) <= ((a1[0][13] <= i8) * (a0[10] - i8)));
+        v3 = (((59 % 6) % 4) + ((3 - v0) / 7));
+        {
+            int i9 = 0;
+            while (i9 < 2) {
+                if ((26 - 37) > 71) break;
+                v3 = (((a1[1][1] == a1[3][14]) || (i9 && 25)) ? ((1 * 70) != (v1 == a1[2][8])) : ((v3 * a1[1][8]) > (0 < v2)));
+                v1 = (((i9 || v0) / 1) / 9);
+                v3 = (((76 ? a1[3][0] : a0[0]) < (a0[14] > a1[3][13])) % 1);
+                i9 = i9 + 1;
+            }
+        }
+    }
+    if ((((a1[3][13] % 1) + (v2 * 99)) % 9)) {
+        a0[7] = (((a1[1][0] == a0[12]) <= (a1[3][10] ? 21 : v1)) ? ((84 ? v0 : v0) ? (v1 != 98) : (v3 ? 25 : a1[1][8])) : ((v3 > 95) - (6 < 25)));
+        v1 = (((74 * 12) - (10 / 2)) && ((v1 > a1[3][13]) + (v1 / 3)));
+        v3 = (((v2 <= v1) ? (v0 - 61) : (49 ? v0 : v2)) <= ((v0 == v2) == (38 % 1)));
+    } else {
+        v0 = (((a1[0][5] + 7) == (v1 >= v1)) < ((26 && v3) < (v1 ? v2 : v2)));
+        v1 = (((v1 < 74) > (v3 - 51)) > ((v2 * 97) / 4));
+        a0[4] = (((89 * 54) ? (a0[14] - 33) : (39 || v1)) ? ((68 || 3) / 3) : ((v2 != v0) == (a1[0][10] * 67)));
+    }
+    v1 = (((v0 >= v2) + (a0[3] - v2)) != ((62 == a1[3][3]) > (36 / 1)));
+    return (((v1 + 91) != (v3 > v0)) || ((a0[4] ? v1 : 4) % 8));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    s = s + f4();
+    s = s + f5();
+    s = s + f6();
+    s = s + f7();
+    s = s + f8();
+    s = s + f9();
+    s = s + f10();
+    s = s + f11();
+    s = s + f12();
+    s = s + f13();
+    s = s + f14();
+    s = s + f15();
+    s = s + f16();
+    s = s + f17();
+    s = s + f18();
+    s = s + f19();
+    s = s + f20();
+    s = s + f21();
+    s = s + f22();
+    s = s + f23();
+    s = s + f24();
+    s = s + f25();
+    s = s + f26();
+    s = s + f27();
+    s = s + f28();
+    s = s + f29();
+    s = s + f30();
+    s = s + f31();
+    s = s + f32();
+    s = s + f33();
+    s = s + f34();
+    s = s + f35();
+    s = s + f36();
+    s = s + f37();
+    s = s + f38();
+    s = s + f39();
+    return s;
+}
@@ -0,0 +1,178 @@
+int f0() {
+    int v0 = 48;
+    int v1 = 87;
+    int v2 = 1;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    if ((((11 > a1[3][5]) > (v2 + 12)) && ((v0 + v3) + (v1 - 19)))) {
+        a0[10] = (((18 < v1) ? (v0 < v0) : (v2 * v1)) == ((62 / 1) + (a0[7] / 2)));
+        v3 = (((v0 && v3) % 1) - ((8 < v0) <= (a0[5] + v2)));
+        v1 = (((81 <= v1) || (a0[4] + v2)) % 5);
+    } else {
+        v2 = (((v3 != 42) > (a0[4] >= v2)) ? ((v2 < v3) || (v0 <= v3)) : ((v0 != a1[3][5]) && (80 < v1)));
+        v2 = (((v1 && v2) <= (a0[12] < v1)) <= ((v3 >= v0) % 4));
+        v0 = (((v3 == 99) + (v1 ? 31 : v2)) >= ((v3 < a0[15]) >= (a1[3][2] >= v0)));
+    }
+    if ((((a0[5] - a0[2]) < (92 ? v2 : v3)) + ((a1[3][11] ? v1 : 64) / 7))) {
+        a1[1][6] = (((v1 * 60) >= (93 != a0[8])) == ((v1 + a0[15]) >= (v1 < 69)));
+        v1 = (((v3 != v0) != (a1[3][13] >= v0)) ? ((a1[1][4] / 7) > (58 / 6)) : ((a1[1][12] / 3) > (v0 - v3)));
+        v0 = (((v2 % 4) * (a1[2][11] + v0)) - ((v3 + v2) == (a0[7] <= v3)));
+    } else {
+        a1[2][6] = (((v1 - v3) || (a1[1][9] + v0)) || ((v1 <= v1) ? (v1 ? v3 : v3) : (69 / 7)));
+        v1 = (((a0[12] > v1) < (34 != v2)) < ((v2 * v3) % 4));
+        a1[3][12] = (((v2 && a0[1]) - (v2 % 5)) * ((v2 % 6) < (v1 ? v3 : v0)));
+    }
+    v3 = (((57 == a0[9]) ? (v2 >= v1) : (v2 > 70)) == ((68 - v3) || (v0 != v3)));
+    v2 = (((v0 + v0) ? (a0[0] || 15) : (a0[14] + v2)) > ((a0[14] == a1[2][3]) ? (v3 || v0) : (a1[1][7] + a1[3][0])));
+    {
+        int i0 = 0;
+        do {
+            if ((v2 || a1[0][14]) > 63) break;
+            a1[1][5] = (((73 ? v3 : v1) && (12 == 16)) ? ((37 - i0) - (38 != v3)) : ((a0[9] < v3) + (v2 == a1[1][8])));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v0 = (((38 ? i0 : v1) < (71 != 39)) <= ((a1[3][6] + i0) / 2));
+                    v0 = (((a0[6] > v2) ? (i0 == a1[1][12]) : (i1 >= v1)) - ((65 - i1) > (a1[3][9] <= v0)));
+                    v1 = (((a0[6] + 17) / 5) != ((a0[7] < 71) + (i0 == v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((14 >= v3) < (a0[5] > a0[13])) || ((i0 && i0) - (a1[3][12] == a0[3])));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v1 = (((v1 ? v0 : v2) + (a0[2] && v3)) ? ((a1[2][14] ? i2 : i2) <= (v2 && v2)) : ((v0 == a0[1]) - (a0[2] >= v0)));
+            v1 = (((a0[12] ? a0[9] : v3) && (78 <= i2)) != ((v0 * 88) == (v0 ? 28 : v3)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    a0[10] = (((a0[15] ? 6 : v2) == (a1[1][12] >= v1)) + ((v3 ? v1 : i3) > (v1 && a1[2][10])));
+                    a0[3] = (((4 - 92) ? (a1[1][10] ? v0 : i2) : (90 < 18)) + ((98 || v2) <= (v2 ? v1 : a0[5])));
+                    v2 = (((87 > 90) - (a0[14] + 37)) <= ((v3 && a1[0][10]) ? (i3 ? 86 : v3) : (i2 && i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((v3 - v0) && (v3 != v1)) && ((38 ? 38 : v1) <= (v0 || v0)));
+    if ((((a1[0][2] - v3) != (4 % 9)) ? ((v2 / 6) == (a0[6] ? v2 : v2)) : ((77 > v0) != (v0 == v2)))) {
+        v3 = (((a1[1][14] ? v3 : v0) - (16 <= a0[9])) <= ((a1[0][10] / 7) || (v3 * a0[9])));
+        v3 = (((4 - 66) < (a0[8] ? v0 : 32)) * ((v3 == v3) && (a0[3] <= a0[14])));
+        a1[1][10] = (((v1 + 67) == (v1 ? v2 : 98)) - ((v2 - a0[4]) <= (68 - v3)));
+    } else {
+        v1 = (((14 < v0) ? (11 && v3) : (70 / 2)) < ((v2 >= a1[0][10]) || (v1 || a1[1][6])));
+        a1[0][8] = (((v1 < v2) / 3) % 5);
+        v3 = (((v1 ? 77 : v1) && (a0[6] && v2)) / 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v1 == v2) && (a0[11] == i4)) <= ((a0[15] != 22) && (97 == 43)));
+                    a1[0][6] = (((v1 == i5) && (v3 > a1[1][8])) / 3);
+                    a1[1][6] = (((v1 <= i4) + (v1 / 6)) ? ((v0 >= a0[10]) < (a0[2] % 1)) : ((v1 >= v0) && (57 || v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v3 = (((a1[0][3] <= v1) ? (a0[8] * a0[3]) : (a0[5] % 7)) + ((v3 / 4) - (v0 % 7)));
+            v2 = (((a0[3] < a1[1][9]) <= (a0[0] == a0[15])) ? ((a1[3][15] % 7) > (66 || 51)) : ((62 * i4) >= (v2 ? v1 : v1)));
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((v0 || v3) + (v0 ? v1 : 69)) + ((v1 - 68) != (a1[3][4] || v3)));
+    return (((v0 * a0[4]) == (86 ? 13 : v1)) / 8);
+}
+int f1() {
+    int v0 = 65;
+    int v1 = 7;
+    int v2 = 9;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    a1[0][12] = (((v2 && 40) == (v3 <= 91)) < ((v2 == a1[0][1]) / 4));
+    a0[7] = (((45 <= a1[3][12]) != (a0[7] > v3)) - ((v1 + 27) + (v0 < v1)));
+    if ((((v1 == v1) / 8) * ((a1[1][0] ? v2 : v3) < (v1 && a0[10])))) {
+        v3 = (((99 ? v3 : v2) % 2) < ((v2 ? v3 : 29) && (a1[0][8] - a0[15])));
+        v1 = (((v1 && v2) && (a1[0][9] || a1[0][4])) * ((v3 < a1[3][1]) <= (v3 * v0)));
+        v1 = (((a0[0] + v1) + (a1[0][10] || v1)) / 2);
+    } else {
+        a0[11] = (((v3 && v3) ? (a0[7] < a1[1][1]) : (v1 * 45)) != ((a0[8] < v0) == (46 * v1)));
+        v3 = (((v0 >= a0[13]) == (97 > a0[10])) + ((v3 + v3) % 5));
+        v3 = (((a0[4] != v3) || (14 != v2)) / 4);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                do {
+                    a1[1][4] = (((i0 > 64) ? (i1 > v3) : (a0[6] / 2)) * ((a1[2][5] != 56) > (a0[0] - v2)));
+                    v2 = (((65 / 2) ? (v2 + a1[3][12]) : (a0[13] * v3)) && ((v1 && 95) % 7));
+                    a0[9] = (((i0 >= 82) >= (a1[3][9] && v3)) % 4);
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v3 = (((37 / 6) ? (a0[0] % 2) : (73 == v1)) + ((v2 / 5) < (14 / 2)));
+            a1[2][3] = (((i0 ? 99 : a1[2][1]) % 7) <= ((v3 / 1) > (85 >= v0)));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((14 != v1) && (v0 && 71)) == ((25 / 6) ? (v2 <= v0) : (83 != v3)));
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 == v0) + (v2 - 14)) == ((v1 > a1[3][9]) * (59 + v3)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v0 = (((i2 * a0[2]) % 6) <= ((v2 < a1[1][6]) > (v2 >= i3)));
+                v1 = (((i2 || a1[1][1]) != (92 < 93)) && ((a1[0][3] >= i2) || (i2 + i3)));
+                v2 = (((6 % 2) % 2) ? ((a0[0] % 8) >= (a0[0] <= a1[0][7])) : ((a0[6] <= a1[2][0]) <= (v2 && a1[3][3])));
+            }
+            v2 = (((v2 >= v2) / 6) == ((i2 != v0) / 9));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((v0 * v2) + (91 && v2)) - ((59 ? v0 : v2) + (18 <= v3)))) {
+        a0[12] = (((a1[0][13] > a0[0]) > (18 / 5)) || ((90 % 3) < (v3 % 8)));
+        v1 = (((a1[1][10] + v3) != (33 ? 82 : v0)) ? ((v1 == v0) ? (v0 != a0[0]) : (a0[7] == 39)) : ((a1[1][13] <= a1[1][14]) > (v2 || 45)));
+        v1 = (((a0[10] / 3) ? (a0[14] >= a1[3][10]) : (v2 ? v1 : v1)) || ((v2 > v1) != (a1[0][9] <= v3)));
+    } else {
+        a0[7] = (((34 * 33) ? (38 && 68) : (84 >= v1)) % 9);
+        a0[12] = (((v3 - 43) && (v2 + a0[1])) > ((v3 < v2) && (a1[1][5] * v1)));
+        a1[3][5] = (((87 || v1) * (35 ? v0 : v2)) >= ((v3 % 4) == (a0[6] == v2)));
+    }
+    v3 = (((v1 < v2) ? (a0[12] || a0[15]) : (12 < 15)) + ((1 <= 71) > (v0 > 85)));
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v1 = (((v0 <= i4) / 1) / 4);
+            v3 = (((v3 || a0[15]) == (v2 - v2)) ? ((a1[1][11] - v3) + (v2 == v2)) : ((62 && v3) <= (v1 / 7)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    if ((v0 + a1[2][1]) > 67) break;
+                    v1 = (((99 / 7) + (94 * 15)) || ((92 || a0[8]) && (i5 == v3)));
+                    a1[1][2] = (((a1[1][2] && v2) / 3) < ((v0 % 5) || (v1 < v3)));
+                    v3 = (((v2 <= a1[2][14]) || (v2 != a0[4])) <= ((a1[0][9] > a0[7]) / 8));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    a0[3] = (((a1[2][13] == 91) > (v0 / 9)) || ((49 < 54) == (a1[3][0] == v0)));
+    return (((v0 / 6) && (v1 % 6)) ? ((a1[0][8] == a1[1][9]) - (v1 == 64)) : ((a0[0] >= a1[2][5]) % 4));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,4022 @@
+    .file 1 "build/bench/batch/f1.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 173 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 174 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 175 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 176 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 177 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $48, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $87, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $44, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    movq $11, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $12, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_3
+    jmp .Lf0_2
+.Lf0_3:
+    movslq -8(%rbp), %rax
+    subq $19, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_2:
+    cmpq $0, %rax
+    je .Lf0_4
+    .loc 1 9 9
+    movq $18, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_5
+    jmp .Lf0_6
+.Lf0_5:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_7
+.Lf0_6:
+    movslq -12(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_7:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $62, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -40(%rbp)
+    .loc 1 10 9
+    movq $8, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -60(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_8
+.Lf0_9:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_8:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 11 9
+    movq $5, %rax
+    push %rax
+    movq $81, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_11
+    jmp .Lf0_10
+.Lf0_11:
+    movslq -64(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_10:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_1
+.Lf0_4:
+    .loc 1 13 9
+    cmpl $42, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_13
+.Lf0_12:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_16
+    jmp .Lf0_15
+.Lf0_16:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_15:
+    jmp .Lf0_14
+.Lf0_13:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_18
+    jmp .Lf0_17
+.Lf0_18:
+    movq $80, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_17:
+.Lf0_14:
+    movl %eax, -12(%rbp)
+    .loc 1 14 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_19
+.Lf0_20:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_19:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 15 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_22
+.Lf0_21:
+    movq $31, %rax
+    jmp .Lf0_23
+.Lf0_22:
+    movslq -12(%rbp), %rax
+.Lf0_23:
+    push %rax
+    cmpl $99, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_1:
+    .loc 1 17 5
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_25
+    jmp .Lf0_26
+.Lf0_25:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_27
+.Lf0_26:
+    movq $64, %rax
+.Lf0_27:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    subl -72(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $92, %rax
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_30
+.Lf0_29:
+    movslq -16(%rbp), %rax
+.Lf0_30:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_31
+    .loc 1 18 9
+    movslq -8(%rbp), %rax
+    imulq $60, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $93, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $69, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 19 9
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_33
+.Lf0_32:
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $58, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_34
+.Lf0_33:
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_34:
+    movl %eax, -8(%rbp)
+    .loc 1 20 9
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_24
+.Lf0_31:
+    .loc 1 22 9
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_36
+    jmp .Lf0_35
+.Lf0_36:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_35:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_38
+    jmp .Lf0_37
+.Lf0_38:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_42
+    jmp .Lf0_43
+.Lf0_42:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_44
+.Lf0_43:
+    movslq -16(%rbp), %rax
+.Lf0_44:
+    jmp .Lf0_41
+.Lf0_40:
+    movq $7, %rax
+    push %rax
+    movq $69, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_41:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_37:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 23 9
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $34, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 24 9
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_45
+    jmp .Lf0_46
+.Lf0_45:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_47
+.Lf0_46:
+    movslq -4(%rbp), %rax
+.Lf0_47:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_49
+    jmp .Lf0_48
+.Lf0_49:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_48:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_24:
+    .loc 1 26 5
+    movq $57, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_51
+.Lf0_50:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_52
+.Lf0_51:
+    cmpl $70, -12(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_52:
+    push %rax
+    movq $68, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_54
+    jmp .Lf0_53
+.Lf0_54:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_53:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 27 5
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_56
+.Lf0_55:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_59
+    jmp .Lf0_58
+.Lf0_59:
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_58:
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -24(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_57:
+    push %rax
+    movslq -24(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_60
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_64
+    jmp .Lf0_63
+.Lf0_64:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_63:
+    jmp .Lf0_62
+.Lf0_61:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_62:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 29 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 30 9
+    .p2align 4,,10
+.Lf0_67:
+    .loc 1 31 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_70
+    jmp .Lf0_69
+.Lf0_70:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_69:
+    cmpq $63, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_68
+    jmp .Lf0_65
+.Lf0_68:
+    .loc 1 32 13
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf0_74
+    jmp .Lf0_75
+.Lf0_74:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_76
+.Lf0_75:
+    movslq -8(%rbp), %rax
+.Lf0_76:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_77
+.Lf0_78:
+    movq $12, %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_77:
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_72
+.Lf0_71:
+    movq $38, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $37, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_73:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 34 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 35 17
+    jmp .Lf0_82
+    .p2align 4,,10
+.Lf0_81:
+    .loc 1 36 21
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_84
+.Lf0_83:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_85
+.Lf0_84:
+    movslq -8(%rbp), %rax
+.Lf0_85:
+    push %rax
+    movq $71, %rax
+    cmpq $39, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 37 21
+    movq $65, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_86
+    jmp .Lf0_87
+.Lf0_86:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_88
+.Lf0_87:
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_88:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 38 21
+    movq $5, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    addq $17, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $71, -52(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 39 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_80:
+.Lf0_82:
+    .loc 1 35 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_81
+.Lf0_79:
+    addq $0, %rsp
+    .loc 1 42 13
+    movq $14, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_90
+    jmp .Lf0_89
+.Lf0_90:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_91
+.Lf0_92:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_91:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_89:
+    movl %eax, -8(%rbp)
+    .loc 1 43 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_66:
+    .loc 1 44 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_67
+.Lf0_65:
+    addq $8, %rsp
+    .loc 1 47 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 48 9
+    jmp .Lf0_96
+    .p2align 4,,10
+.Lf0_95:
+    .loc 1 49 13
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_101
+    jmp .Lf0_100
+.Lf0_101:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_100:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_102
+    jmp .Lf0_103
+.Lf0_102:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_104
+.Lf0_103:
+    movslq -12(%rbp), %rax
+.Lf0_104:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_97
+    jmp .Lf0_98
+.Lf0_97:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_105
+    jmp .Lf0_106
+.Lf0_105:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_107
+.Lf0_106:
+    movslq -340(%rbp), %rax
+.Lf0_107:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_108
+.Lf0_109:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_108:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_99
+.Lf0_98:
+    movslq -72(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_99:
+    movl %eax, -8(%rbp)
+    .loc 1 50 13
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_110
+    jmp .Lf0_111
+.Lf0_110:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_112
+.Lf0_111:
+    movslq -16(%rbp), %rax
+.Lf0_112:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_113
+.Lf0_114:
+    movq $78, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_113:
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $88, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_115
+    jmp .Lf0_116
+.Lf0_115:
+    movq $28, %rax
+    jmp .Lf0_117
+.Lf0_116:
+    movslq -16(%rbp), %rax
+.Lf0_117:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 52 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 53 17
+    jmp .Lf0_121
+    .p2align 4,,10
+.Lf0_120:
+    .loc 1 54 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_122
+    jmp .Lf0_123
+.Lf0_122:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -344(%rbp), %rax
+.Lf0_124:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_125
+.Lf0_126:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_125:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_128
+.Lf0_127:
+    movq $6, %rax
+    jmp .Lf0_129
+.Lf0_128:
+    movslq -12(%rbp), %rax
+.Lf0_129:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 55 21
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_131
+    jmp .Lf0_130
+.Lf0_131:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_130:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_132
+    jmp .Lf0_133
+.Lf0_132:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_134
+.Lf0_133:
+    movslq -60(%rbp), %rax
+.Lf0_134:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    subq $92, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_135
+    jmp .Lf0_136
+.Lf0_135:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_140
+.Lf0_139:
+    movslq -340(%rbp), %rax
+.Lf0_140:
+    jmp .Lf0_137
+.Lf0_136:
+    movq $90, %rax
+    cmpq $18, %rax
+    movq $0, %rax
+    setl %al
+.Lf0_137:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 56 21
+    movslq -24(%rbp), %rax
+    addq $37, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $87, %rax
+    cmpq $90, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_146
+    jmp .Lf0_147
+.Lf0_146:
+    movq $86, %rax
+    jmp .Lf0_148
+.Lf0_147:
+    movslq -16(%rbp), %rax
+.Lf0_148:
+    jmp .Lf0_143
+.Lf0_142:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_149
+.Lf0_150:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_149:
+.Lf0_143:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 57 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_119:
+.Lf0_121:
+    .loc 1 53 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_120
+.Lf0_118:
+    addq $0, %rsp
+    .loc 1 60 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_94:
+.Lf0_96:
+    .loc 1 48 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_95
+.Lf0_93:
+    addq $8, %rsp
+    .loc 1 63 5
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_152
+    jmp .Lf0_151
+.Lf0_152:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_151:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_154
+    jmp .Lf0_153
+.Lf0_154:
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_156
+.Lf0_155:
+    movq $38, %rax
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -8(%rbp), %rax
+.Lf0_157:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_159
+    jmp .Lf0_158
+.Lf0_159:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_158:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_153:
+    movl %eax, -4(%rbp)
+    .loc 1 64 5
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $4, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_161
+    jmp .Lf0_162
+.Lf0_161:
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_165
+.Lf0_164:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_166
+.Lf0_165:
+    movslq -12(%rbp), %rax
+.Lf0_166:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_163
+.Lf0_162:
+    movq $77, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_163:
+    cmpq $0, %rax
+    je .Lf0_167
+    .loc 1 65 9
+    movq $16, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_170
+.Lf0_169:
+    movslq -4(%rbp), %rax
+.Lf0_170:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movslq -16(%rbp), %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 66 9
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_173
+.Lf0_174:
+    movslq -68(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_173:
+    push %rax
+    movq $4, %rax
+    subq $66, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_177
+.Lf0_176:
+    movq $32, %rax
+.Lf0_177:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 67 9
+    movslq -12(%rbp), %rax
+    subl -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $68, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $67, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_179
+.Lf0_178:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_180
+.Lf0_179:
+    movq $98, %rax
+.Lf0_180:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_160
+.Lf0_167:
+    .loc 1 69 9
+    movq $14, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_181
+    jmp .Lf0_182
+.Lf0_181:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_184
+.Lf0_185:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_184:
+    jmp .Lf0_183
+.Lf0_182:
+    movq $2, %rax
+    push %rax
+    movq $70, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_183:
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_187
+    jmp .Lf0_186
+.Lf0_187:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_189
+    jmp .Lf0_188
+.Lf0_189:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_188:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 70 9
+    movq $5, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 71 9
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_190
+    jmp .Lf0_191
+.Lf0_190:
+    movq $77, %rax
+    jmp .Lf0_192
+.Lf0_191:
+    movslq -8(%rbp), %rax
+.Lf0_192:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_193
+.Lf0_194:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_196
+    jmp .Lf0_195
+.Lf0_196:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_195:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_193:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_160:
+    .loc 1 74 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 75 9
+    jmp .Lf0_200
+    .p2align 4,,10
+.Lf0_199:
+    .loc 1 77 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 78 17
+    .p2align 4,,10
+.Lf0_203:
+    .loc 1 79 21
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_204
+.Lf0_205:
+    movslq -36(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_204:
+    push %rax
+    cmpl $22, -20(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_207
+    jmp .Lf0_206
+.Lf0_207:
+    movq $97, %rax
+    cmpq $43, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_206:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 80 21
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_208
+.Lf0_209:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_208:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 81 21
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_211
+.Lf0_210:
+    movslq -4(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_212
+.Lf0_211:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_216
+    jmp .Lf0_215
+.Lf0_216:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_215:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+.Lf0_212:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 82 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_202:
+    .loc 1 83 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_203
+.Lf0_201:
+    addq $0, %rsp
+    .loc 1 85 13
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_217
+    jmp .Lf0_218
+.Lf0_217:
+    movslq -48(%rbp), %rax
+    imull -68(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_219
+.Lf0_218:
+    movq $7, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_219:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 86 13
+    movslq -68(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_221
+.Lf0_220:
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_224
+    jmp .Lf0_223
+.Lf0_224:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_223:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_222
+.Lf0_221:
+    movq $62, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_227
+.Lf0_226:
+    movslq -8(%rbp), %rax
+.Lf0_227:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_222:
+    movl %eax, -12(%rbp)
+    .loc 1 87 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_198:
+.Lf0_200:
+    .loc 1 75 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_199
+.Lf0_197:
+    addq $8, %rsp
+    .loc 1 90 5
+    movslq -8(%rbp), %rax
+    subq $68, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_229
+    jmp .Lf0_228
+.Lf0_229:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_228:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_230
+    jmp .Lf0_231
+.Lf0_230:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_232
+.Lf0_231:
+    movq $69, %rax
+.Lf0_232:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_234
+    jmp .Lf0_233
+.Lf0_234:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_233:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 91 5
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $86, %rax
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_236
+.Lf0_235:
+    movq $13, %rax
+    jmp .Lf0_237
+.Lf0_236:
+    movslq -8(%rbp), %rax
+.Lf0_237:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 93 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 94 5
+    subq $8, %rsp
+    movq $65, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 95 5
+    movq $7, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 96 5
+    subq $8, %rsp
+    movq $9, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 97 5
+    movq $59, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 98 5
+    subq $64, %rsp
+    .loc 1 99 5
+    subq $256, %rsp
+    .loc 1 100 5
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_2
+    jmp .Lf1_1
+.Lf1_2:
+    movq $40, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_1:
+    push %rax
+    cmpl $91, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 101 5
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $27, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 102 5
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_4
+    jmp .Lf1_5
+.Lf1_4:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_6
+.Lf1_5:
+    movslq -16(%rbp), %rax
+.Lf1_6:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_8
+    jmp .Lf1_7
+.Lf1_8:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_9
+    .loc 1 103 9
+    movq $2, %rax
+    push %rax
+    movq $99, %rax
+    cmpq $0, %rax
+    jne .Lf1_10
+    jmp .Lf1_11
+.Lf1_10:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_12
+.Lf1_11:
+    movslq -12(%rbp), %rax
+.Lf1_12:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_13
+    jmp .Lf1_14
+.Lf1_13:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_15
+.Lf1_14:
+    movq $29, %rax
+.Lf1_15:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_17
+    jmp .Lf1_16
+.Lf1_17:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    subl -20(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_16:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 104 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_19
+    jmp .Lf1_18
+.Lf1_19:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_18:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_21
+    jmp .Lf1_20
+.Lf1_21:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_23
+    jmp .Lf1_22
+.Lf1_23:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_22:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_20:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 105 9
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_25
+    jmp .Lf1_24
+.Lf1_25:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_24:
+    push %rax
+    movslq -80(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_3
+.Lf1_9:
+    .loc 1 107 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_29
+.Lf1_30:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_29:
+    cmpq $0, %rax
+    jne .Lf1_26
+    jmp .Lf1_27
+.Lf1_26:
+    movslq -52(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_28
+.Lf1_27:
+    movslq -8(%rbp), %rax
+    imulq $45, %rax
+    movslq %eax, %rax
+.Lf1_28:
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $46, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -36(%rbp)
+    .loc 1 108 9
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $97, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 109 9
+    movq $4, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_32
+    jmp .Lf1_31
+.Lf1_32:
+    movq $14, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_31:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_3:
+    .loc 1 112 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 113 9
+    jmp .Lf1_36
+    .p2align 4,,10
+.Lf1_35:
+    .loc 1 115 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 116 17
+    .p2align 4,,10
+.Lf1_39:
+    .loc 1 117 21
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -80(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $64, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_40
+    jmp .Lf1_41
+.Lf1_40:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_42
+.Lf1_41:
+    movq $2, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_42:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 118 21
+    movq $2, %rax
+    push %rax
+    movq $65, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_43
+    jmp .Lf1_44
+.Lf1_43:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_45
+.Lf1_44:
+    movslq -28(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_45:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_46
+.Lf1_47:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_49
+    jmp .Lf1_48
+.Lf1_49:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_48:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_46:
+    movl %eax, -12(%rbp)
+    .loc 1 119 21
+    movq $4, %rax
+    push %rax
+    cmpl $82, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 120 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_38:
+    .loc 1 121 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_39
+.Lf1_37:
+    addq $0, %rsp
+    .loc 1 123 13
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $14, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $37, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_53
+.Lf1_52:
+    movq $2, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_54
+.Lf1_53:
+    movq $73, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_54:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 124 13
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_55
+    jmp .Lf1_56
+.Lf1_55:
+    movq $99, %rax
+    jmp .Lf1_57
+.Lf1_56:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf1_57:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $85, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 125 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_34:
+.Lf1_36:
+    .loc 1 113 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_35
+.Lf1_33:
+    addq $8, %rsp
+    .loc 1 128 5
+    movq $14, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_59
+    jmp .Lf1_58
+.Lf1_59:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_61
+    jmp .Lf1_60
+.Lf1_61:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_60:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_58:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $25, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_62
+    jmp .Lf1_63
+.Lf1_62:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_64
+.Lf1_63:
+    movq $83, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_64:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 130 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 131 9
+    .p2align 4,,10
+.Lf1_67:
+    .loc 1 132 13
+    movslq -12(%rbp), %rax
+    subq $14, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $59, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 133 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_73
+    .p2align 4,,10
+.Lf1_72:
+    .loc 1 134 17
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 135 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_75
+    jmp .Lf1_74
+.Lf1_75:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_74:
+    push %rax
+    movq $92, %rax
+    cmpq $93, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_77
+    jmp .Lf1_76
+.Lf1_77:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_79
+    jmp .Lf1_78
+.Lf1_79:
+    movslq -340(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_78:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_76:
+    movl %eax, -8(%rbp)
+    .loc 1 136 17
+    movq $2, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $6, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_81
+.Lf1_80:
+    movq $8, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_82
+.Lf1_81:
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_83
+.Lf1_84:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_83:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_82:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_71:
+    .loc 1 133 38
+    incl -344(%rbp)
+.Lf1_73:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_72
+.Lf1_70:
+    addq $0, %rsp
+    .loc 1 138 13
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 139 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_66:
+    .loc 1 140 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_67
+.Lf1_65:
+    addq $8, %rsp
+    .loc 1 142 5
+    movq $18, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $59, %rax
+    cmpq $0, %rax
+    jne .Lf1_86
+    jmp .Lf1_87
+.Lf1_86:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_88
+.Lf1_87:
+    movslq -12(%rbp), %rax
+.Lf1_88:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_90
+    jmp .Lf1_89
+.Lf1_90:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_89:
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_91
+    .loc 1 143 9
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $18, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_93
+    jmp .Lf1_92
+.Lf1_93:
+    movq $3, %rax
+    push %rax
+    movq $90, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_92:
+    movl %eax, -32(%rbp)
+    .loc 1 144 9
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $33, %rax
+    cmpq $0, %rax
+    jne .Lf1_97
+    jmp .Lf1_98
+.Lf1_97:
+    movq $82, %rax
+    jmp .Lf1_99
+.Lf1_98:
+    movslq -4(%rbp), %rax
+.Lf1_99:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_94
+    jmp .Lf1_95
+.Lf1_94:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_100
+    jmp .Lf1_101
+.Lf1_100:
+    movslq -4(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_102
+.Lf1_101:
+    cmpl $39, -52(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_102:
+    jmp .Lf1_96
+.Lf1_95:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_104
+    jmp .Lf1_103
+.Lf1_104:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_103:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_96:
+    movl %eax, -8(%rbp)
+    .loc 1 145 9
+    movq $3, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_105
+    jmp .Lf1_106
+.Lf1_105:
+    movslq -24(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_107
+.Lf1_106:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_108
+    jmp .Lf1_109
+.Lf1_108:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_110
+.Lf1_109:
+    movslq -8(%rbp), %rax
+.Lf1_110:
+.Lf1_107:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_112
+    jmp .Lf1_111
+.Lf1_112:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_111:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_85
+.Lf1_91:
+    .loc 1 147 9
+    movq $9, %rax
+    push %rax
+    movq $34, %rax
+    imulq $33, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_113
+    jmp .Lf1_114
+.Lf1_113:
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_117
+    jmp .Lf1_116
+.Lf1_117:
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_116:
+    jmp .Lf1_115
+.Lf1_114:
+    movq $84, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_115:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 148 9
+    movslq -16(%rbp), %rax
+    subq $43, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_119
+    jmp .Lf1_118
+.Lf1_119:
+    movslq -12(%rbp), %rax
+    addl -76(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_118:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_121
+    jmp .Lf1_120
+.Lf1_121:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_120:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -32(%rbp)
+    .loc 1 149 9
+    movq $35, %rax
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_123
+.Lf1_122:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_124
+.Lf1_123:
+    movslq -12(%rbp), %rax
+.Lf1_124:
+    push %rax
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_126
+    jmp .Lf1_125
+.Lf1_126:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_125:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_85:
+    .loc 1 151 5
+    movq $1, %rax
+    cmpq $71, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $85, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_127
+    jmp .Lf1_128
+.Lf1_127:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_131
+    jmp .Lf1_130
+.Lf1_131:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_130:
+    jmp .Lf1_129
+.Lf1_128:
+    movq $12, %rax
+    cmpq $15, %rax
+    movq $0, %rax
+    setl %al
+.Lf1_129:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 153 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 154 9
+    jmp .Lf1_135
+    .p2align 4,,10
+.Lf1_134:
+    .loc 1 155 13
+    movq $4, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 156 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_140
+    jmp .Lf1_139
+.Lf1_140:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_139:
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_136
+    jmp .Lf1_137
+.Lf1_136:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_138
+.Lf1_137:
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_142
+    jmp .Lf1_141
+.Lf1_142:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_141:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_138:
+    movl %eax, -16(%rbp)
+    .loc 1 158 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 159 17
+    jmp .Lf1_146
+    .p2align 4,,10
+.Lf1_145:
+    .loc 1 160 21
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_147
+    jmp .Lf1_143
+.Lf1_147:
+    .loc 1 161 21
+    movq $94, %rax
+    imulq $15, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $99, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_149
+    jmp .Lf1_148
+.Lf1_149:
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_151
+    jmp .Lf1_150
+.Lf1_151:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_150:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_152
+.Lf1_153:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_152:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_148:
+    movl %eax, -8(%rbp)
+    .loc 1 162 21
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_157
+    jmp .Lf1_156
+.Lf1_157:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_156:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 163 21
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_159
+    jmp .Lf1_158
+.Lf1_159:
+    movslq -12(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_158:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 164 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_144:
+.Lf1_146:
+    .loc 1 159 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_145
+.Lf1_143:
+    addq $0, %rsp
+    .loc 1 167 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_133:
+.Lf1_135:
+    .loc 1 154 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_134
+.Lf1_132:
+    addq $8, %rsp
+    .loc 1 170 5
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_161
+    jmp .Lf1_160
+.Lf1_161:
+    movq $49, %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_160:
+    movl %eax, -68(%rbp)
+    .loc 1 171 5
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_163
+.Lf1_162:
+    cmpl $64, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_164
+.Lf1_163:
+    movq $4, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_164:
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
@@ -0,0 +1,361 @@
+int f0() {
+    int v0 = 41;
+    int v1 = 79;
+    int v2 = 20;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v0 * 4) > 87) break;
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((v2 != v1) > 81) break;
+                v0 = (((i0 <= a1[2][11]) != (9 < 7)) > ((v2 / 1) < (v3 <= i0)));
+                v0 = (((78 - a1[2][6]) ? (96 ? i1 : i0) : (a1[3][2] <= v1)) < ((i1 != v1) < (a1[3][9] ? 64 : 20)));
+                v3 = (((v2 + 8) ? (86 == v1) : (0 * v1)) * ((a0[10] % 2) != (a1[1][14] <= v0)));
+            }
+            a1[3][10] = (((a0[12] * a0[1]) / 8) || ((v1 / 5) % 6));
+            a0[8] = (((v3 < a0[1]) ? (v0 * 30) : (v1 % 4)) >= ((i0 + v3) && (i0 < v0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    a1[0][6] = (((v1 || 75) || (v2 < a0[10])) < ((a0[6] * a1[2][1]) % 8));
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a0[6] = (((v2 <= 93) ? (a1[3][4] * i2) : (v1 || v1)) <= ((76 ? i2 : a1[2][0]) >= (a0[2] > v3)));
+            v3 = (((v3 * 81) < (i2 ? v1 : 73)) + ((v1 ? v2 : a1[1][6]) != (91 ? a0[1] : a1[2][3])));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((v0 ? i3 : i2) > 62) break;
+                    a0[12] = (((75 % 6) != (63 / 8)) % 9);
+                    v2 = (((v1 != a0[0]) && (i3 + a1[3][11])) / 3);
+                    v0 = (((i3 <= i2) % 9) < ((a1[1][3] % 6) == (a0[2] / 9)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[0][4] = (((v3 > v1) >= (a1[3][4] <= a1[2][2])) <= ((91 % 1) <= (v0 / 4)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((9 >= a1[3][10]) * (90 - 18)) > ((22 ? 77 : 55) || (76 ? 7 : i4)));
+                    a0[11] = (((a1[3][2] / 6) - (25 && a0[6])) != ((57 || a1[1][3]) * (a0[7] && v1)));
+                    v0 = (((v0 || v0) / 7) < ((87 < v3) ? (v0 >= v0) : (a0[15] ? v0 : v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((a1[0][7] == 54) && (a1[3][6] * a1[0][13])) + ((46 || i4) < (v1 ? a1[1][13] : a0[14])));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v1 + v2) > 71) break;
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((i6 ? 48 : a0[0]) > 52) break;
+                v0 = (((i6 && v0) / 2) <= ((68 != v0) - (a0[7] || i6)));
+                v2 = (((a0[3] && v0) % 4) > ((a1[2][3] / 6) || (88 <= a1[2][11])));
+                v1 = (((68 && i6) * (i7 % 9)) ? ((7 ? a0[12] : i7) % 8) : ((13 >= v0) % 6));
+            }
+            a0[3] = (((v1 > a1[1][14]) % 5) != ((94 >= i6) <= (v3 ? v3 : v3)));
+            v3 = (((a0[13] == i6) ? (i6 && 7) : (v3 >= v1)) >= ((a1[1][15] || 15) ? (v2 - v0) : (v0 >= v1)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((90 <= 85) > (v3 && i8)) % 7);
+            a1[3][0] = (((i8 ? i8 : 71) >= (i8 && 63)) >= ((a0[9] == a0[9]) >= (a0[2] < 2)));
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    a0[10] = (((50 + a1[2][15]) ? (24 > v2) : (v1 <= a0[5])) % 6);
+                    v2 = (((a1[3][0] ? i9 : v0) + (v0 ? a1[3][14] : v1)) != ((a0[7] == v1) * (a0[13] != a1[1][11])));
+                    v2 = (((v0 && 20) >= (v3 % 2)) <= ((a0[6] >= 86) || (i8 % 6)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    if ((((v0 - v2) && (v1 ? a1[2][1] : v1)) * ((a0[12] * a1[3][0]) > (v1 * v3)))) {
+        v0 = (((a0[12] + 10) - (v3 + 92)) - ((a0[8] >= v0) >= (26 > a0[7])));
+        v3 = (((a1[1][14] && v2) && (16 % 5)) / 8);
+        v0 = (((4 * 73) <= (a1[1][15] == v2)) < ((v1 <= v2) + (v3 >= v2)));
+    } else {
+        v0 = (((88 || 7) + (70 == v2)) > ((a0[8] > a1[0][8]) ? (50 >= v2) : (v1 >= a0[0])));
+        v1 = (((30 % 1) > (v3 - v1)) >= ((a0[3] && 79) != (a1[2][3] == v1)));
+        v2 = (((89 && v1) == (v3 % 3)) > ((v1 - v0) % 3));
+    }
+    if ((((53 && a1[0][11]) % 7) != ((7 % 2) != (v0 <= 87)))) {
+        v3 = (((v2 != a0[5]) + (v3 - 65)) ? ((v3 ? v3 : v0) % 8) : ((v0 ? a1[1][9] : a0[1]) != (3 - a1[3][14])));
+        v3 = (((23 ? v3 : a1[2][3]) ? (v0 ? v2 : v2) : (v1 != v3)) < ((v2 ? 27 : v3) ? (v2 - v3) : (a1[2][11] - 42)));
+        a0[15] = (((76 / 9) && (v0 && a0[2])) > ((v0 * 11) <= (a0[5] ? v3 : v0)));
+    } else {
+        v3 = (((a1[3][8] % 1) > (v3 <= a0[5])) >= ((v2 != a0[7]) + (v1 % 2)));
+        v2 = (((v3 > 56) < (21 == v3)) ? ((v0 || v1) / 5) : ((a0[13] != v2) == (v3 + v1)));
+        v1 = (((v2 <= 53) >= (v0 % 6)) % 4);
+    }
+    if ((((v3 <= 60) == (79 >= v2)) % 6)) {
+        v3 = (((73 != 85) && (a1[0][11] * v2)) / 7);
+        v0 = (((v3 && v3) ? (v0 / 8) : (v2 != 51)) != ((a0[12] && a1[3][2]) || (v0 * 82)));
+        v1 = (((56 * 67) * (58 ? v0 : a1[2][13])) == ((v0 % 8) || (v1 != a0[4])));
+    } else {
+        a0[6] = (((8 * a0[5]) + (a1[1][6] == a0[7])) + ((v3 == a0[10]) && (a1[0][8] >= 84)));
+        v3 = (((v0 % 3) && (v3 != a0[10])) && ((v1 ? v2 : a0[4]) ? (v3 && a1[3][4]) : (v0 + v1)));
+        v0 = (((v2 <= v0) / 7) / 7);
+    }
+    for (int i10 = 0; i10 < 4; i10 = i10 + 1) {
+        v1 = (((v2 == i10) - (v0 ? i10 : 41)) ? ((65 < v2) && (i10 && a1[0][12])) : ((90 && a0[1]) + (v0 ? v3 : v3)));
+        {
+            int i11 = 0;
+            while (i11 < 4) {
+                a0[2] = (((v1 && 21) <= (88 || 22)) * ((v3 - v3) + (17 + a0[3])));
+                v1 = (((a0[14] > a1[3][5]) - (a0[4] ? i11 : v2)) < ((a1[3][3] && 90) + (67 * v2)));
+                v2 = (((v0 * 55) <= (12 > i10)) || ((v0 > i11) >= (a0[11] && v0)));
+                i11 = i11 + 1;
+            }
+        }
+        v1 = (((a1[3][10] <= a1[3][0]) || (a1[1][15] % 5)) != ((i10 || 24) >= (i10 <= i10)));
+    }
+    return (((10 / 2) <= (v3 != 52)) <= ((v1 ? v3 : v2) / 8));
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 6;
+    int v2 = 81;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((64 ? 21 : 92) || (v2 ? v2 : 40)) - ((a0[11] ? i0 : 7) ? (a1[1][15] ? a0[6] : 31) : (i1 <= v0)));
+                    v3 = (((a0[11] <= v0) % 3) ? ((i1 >= a1[3][3]) || (43 - a0[11])) : ((v2 >= i0) / 8));
+                    v1 = (((v1 != 5) <= (v3 - v2)) - ((43 >= i0) > (72 ? a0[10] : v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a0[10] = (((a1[2][5] - v2) == (v1 >= v2)) == ((v3 == v3) && (v0 && a0[14])));
+            v2 = (((a0[15] == v3) == (v3 < 55)) <= ((a1[2][5] > 8) * (v0 + 91)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 > v2) > 90) break;
+            v0 = (((v0 * a1[2][7]) || (v1 % 2)) < ((v1 != v3) / 3));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a1[3][10] = (((v3 ? v0 : i2) + (v0 > 87)) % 5);
+                    v0 = (((i2 ? v0 : 25) % 1) / 1);
+                    a1[3][7] = (((49 * 47) > (a1[3][1] ? i2 : 40)) + ((23 % 3) - (v2 ? v1 : i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[10] = (((v2 % 8) <= (77 >= v1)) - ((v3 > v2) - (v1 ? v3 : v0)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v1 = (((a0[8] % 8) + (v3 * 87)) == ((65 && 11) >= (v3 - v2)));
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((a0[15] <= i5) > 78) break;
+                a0[1] = (((a1[2][12] % 8) <= (v3 + v2)) * ((27 < a0[15]) || (81 <= 88)));
+                v0 = (((31 <= 28) || (54 ? i5 : a1[0][8])) % 8);
+                v2 = (((v0 ? v1 : 50) < (a0[7] + 86)) || ((a0[9] ? 68 : a0[9]) % 1));
+            }
+            v2 = (((v1 / 7) && (v3 - 88)) >= ((v2 == a0[8]) != (70 && i4)));
+            a1[1][6] = (((a1[1][10] ? 31 : 96) / 6) != ((v2 <= v2) + (v0 <= a1[0][5])));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    a0[0] = (((a0[3] + a1[1][3]) && (a0[1] ? a1[1][5] : 38)) - ((90 ? v3 : a0[1]) + (a1[1][9] * v0)));
+                    v0 = (((41 - 92) * (v2 == v1)) - ((a1[3][2] <= v3) * (v0 == 27)));
+                    a1[0][14] = (((a1[0][4] ? 6 : 66) == (a1[0][4] % 5)) && ((65 ? a0[12] : v1) + (61 % 7)));
+                    i7 = i7 + 1;
+                }
+            }
+            a1[2][4] = (((v3 % 2) >= (16 % 5)) * ((v0 || a0[3]) + (41 <= v0)));
+            a0[3] = (((a1[1][3] > i6) + (58 < 73)) || ((a1[2][3] < a0[0]) * (a0[5] / 3)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    v3 = (((83 % 9) || (i9 != a1[0][12])) / 8);
+                    v0 = (((v2 != v0) >= (a0[2] ? v3 : 18)) || ((a0[8] % 5) ? (a1[3][3] >= a1[2][9]) : (v1 + v2)));
+                    a1[3][2] = (((i8 - v1) && (v2 * v2)) != ((a0[14] && v2) && (v0 || v3)));
+                    i9 = i9 + 1;
+                }
+            }
+            a1[1][7] = (((v0 != a0[15]) - (v3 - v2)) - ((v2 ? i8 : a1[2][11]) * (a1[1][4] * v2)));
+            v1 = (((18 >= 76) || (a0[14] - v0)) * ((v2 >= a1[2][0]) >= (v0 % 3)));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    v1 = (((a0[7] >= a0[8]) / 1) * ((a0[10] ? v3 : a1[0][11]) > (v0 == 95)));
+    a1[3][7] = (((2 || v1) || (v1 % 6)) == ((95 > v1) % 9));
+    for (int i10 = 0; i10 < 4; i10 = i10 + 1) {
+        {
+            int i11 = 0;
+            do {
+                if ((i11 == a0[7]) > 51) break;
+                a1[0][11] = (((59 % 5) % 1) > ((a0[3] / 5) ? (a1[3][5] / 3) : (i11 + v1)));
+                a0[14] = (((13 && v2) <= (i11 == v3)) || ((10 != 13) - (35 ? v1 : v0)));
+                v1 = (((20 / 3) ? (95 != v3) : (a1[2][12] && v2)) || ((a1[1][2] % 5) || (a0[11] != a0[2])));
+                i11 = i11 + 1;
+            } while (i11 < 3);
+        }
+        v0 = (((i10 > a1[2][6]) <= (a0[4] != 95)) && ((v3 > v1) || (a1[1][10] < a1[1][5])));
+        a0[3] = (((v1 ? a0[15] : v2) * (v2 != 52)) ? ((a0[1] ? v1 : v1) ? (10 > v2) : (a0[2] % 9)) : ((v2 <= v3) < (v0 ? a0[1] : 13)));
+    }
+    {
+        int i12 = 0;
+        while (i12 < 5) {
+            if ((a0[14] <= v0) > 62) break;
+            v2 = (((a1[3][9] % 7) ? (v1 % 5) : (v1 / 4)) * ((a0[12] ? a1[0][8] : v0) >= (v3 - v0)));
+            v1 = (((v1 + v1) || (75 > i12)) ? ((i12 < 55) == (46 || 2)) : ((a1[0][13] >= i12) > (i12 % 5)));
+            for (int i13 = 0; i13 < 7; i13 = i13 + 1) {
+                v3 = (((a1[1][5] > a1[0][4]) != (a0[3] <= v3)) ? ((56 / 5) && (i12 + v3)) : ((9 == 44) == (a0[9] * v2)));
+                v1 = (((v1 % 8) % 7) <= ((v0 % 9) == (v2 < a1[0][6])));
+                v3 = (((v3 <= i12) - (20 || 55)) / 1);
+            }
+            i12 = i12 + 1;
+        }
+    }
+    return (((v3 >= v1) ? (v1 >= a1[0][4]) : (v0 != a0[12])) > ((v2 % 8) <= (a1[3][4] >= v1)));
+}
+int f2() {
+    int v0 = 8;
+    int v1 = 78;
+    int v2 = 87;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    if ((((44 || v1) > (a1[2][13] ? a1[3][9] : 92)) / 8)) {
+        v3 = (((a1[2][10] > a0[8]) > (62 == v2)) - ((a0[4] ? v0 : 36) ? (95 < v1) : (44 == 40)));
+        v2 = (((a0[4] > v3) == (a0[11] >= 9)) > ((9 ? 19 : 14) + (v0 * v1)));
+        a0[9] = (((87 != a1[2][14]) + (v2 * 64)) - ((a1[1][15] != 58) < (v1 ? a1[2][0] : v2)));
+    } else {
+        v1 = (((38 ? v1 : a1[1][3]) / 8) == ((a1[2][1] + a0[3]) > (43 ? v0 : a1[2][4])));
+        v1 = (((38 > 1) != (v3 <= a1[1][12])) + ((47 - v3) && (v0 > v2)));
+        a0[14] = (((a0[6] ? v1 : v2) < (v0 ? v1 : v2)) || ((v0 <= a0[6]) ? (a1[3][7] || v1) : (v3 == 28)));
+    }
+    a1[0][13] = (((16 && a1[3][2]) != (a0[9] && v1)) - ((a1[2][14] == 84) && (v3 == a0[11])));
+    {
+        int i0 = 0;
+        do {
+            if ((a0[11] + a0[1]) > 80) break;
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a1[0][6] = (((v2 && a0[0]) != (a1[1][1] * a0[0])) * ((92 % 1) + (v1 % 1)));
+                v3 = (((8 ? i1 : 64) && (a1[3][2] > i1)) / 8);
+                a0[12] = (((69 > 26) / 1) && ((v1 < v1) % 3));
+            }
+            a0[4] = (((v1 + i0) < (v1 * v0)) % 9);
+            v2 = (((v0 >= v0) ? (v1 <= 44) : (v3 ? a1[2][10] : i0)) && ((i0 && i0) >= (v1 != 83)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((67 != i2) > 85) break;
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            if ((a1[1][15] < i3) > 93) break;
+            v3 = (((a1[2][5] / 2) - (i3 && i3)) ? ((67 ? v3 : v2) <= (0 ? v0 : 89)) : ((a0[7] <= i3) % 3));
+            a0[12] = (((v0 > v3) ? (i3 % 4) : (i2 > v1)) == ((i3 && a1[3][2]) ? (22 == v3) : (v2 > v2)));
+            a0[0] = (((18 == 29) * (v0 ? a0[9] : v1)) ? ((70 == v2) >= (a0[4] >= a1[0][1])) : ((a1[2][7] - v1) > (22 / 6)));
+        }
+        v0 = (((a1[2][2] < 74) == (a0[11] <= a1[3][15])) || ((a1[0][7] + v3) && (v1 ? a0[13] : v1)));
+        a1[0][1] = (((a0[12] ? 86 : 1) <= (v1 < v1)) + ((v0 - v2) || (i2 + v3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v1 && v0) || (88 == 92)) > ((a1[1][9] == 61) && (v1 != v1)));
+            a0[0] = (((v1 <= 21) * (a1[1][5] - i4)) + ((v0 > v1) ? (v1 + 30) : (a1[0][12] - v2)));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                if ((a1[0][15] < 87) > 65) break;
+                a0[10] = (((i4 < v1) ? (a1[0][6] % 2) : (55 && 51)) ? ((a0[14] * i5) * (v3 && v0)) : ((a0[5] && i5) || (a1[1][15] < a1[3][5])));
+                v2 = (((i4 * v0) + (v0 || a0[6])) + ((i5 || 60) == (69 ? v1 : v1)));
+                v2 = (((a1[0][2] ? a0[3] : i5) + (a0[4] != 49)) == ((i5 - 22) < (a1[3][12] ? i5 : v2)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            v1 = (((3 || a1[1][13]) || (v3 ? v0 : v1)) || ((v2 != v0) * (83 >= v2)));
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    v2 = (((a1[1][7] + i7) % 8) + ((23 * v0) ? (v3 != 96) : (i6 <= v0)));
+                    v0 = (((18 ? v3 : v2) >= (a1[2][10] == v1)) <= ((i6 > a0[11]) ? (i7 ? v1 : 41) : (a0[10] <= 36)));
+                    v0 = (((v2 ? v0 : v3) ? (v3 + v1) : (a0[5] ? 55 : 71)) || ((83 >= a0[11]) / 7));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((47 % 5) - (i6 - 40)) == ((a1[2][8] && 36) >= (v2 ? v0 : a1[2][2])));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((v3 != v0) > (1 <= v3)) + ((v1 / 1) / 8));
+            a1[1][14] = (((v3 > 77) >= (19 - a1[0][14])) / 3);
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                v1 = (((i9 ? i9 : i9) % 7) <= ((v3 ? a1[3][13] : v3) > (a1[3][11] || v0)));
+                v2 = (((v0 >= i8) && (i9 < v3)) - ((v3 / 7) >= (48 - 89)));
+                v2 = (((a0[1] == a0[10]) == (a0[4] || a0[5])) == ((i9 && a0[8]) <= (v3 % 7)));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    v2 = (((v2 || v3) && (v3 || a0[1])) + ((10 || v0) != (v3 <= 46)));
+    if ((((36 != v0) * (99 ? v1 : v2)) < ((v1 + v0) - (v2 > v2)))) {
+        a0[1] = (((74 == v1) ? (60 == v0) : (v0 != 45)) ? ((a0[1] % 2) || (a1[0][2] / 6)) : ((77 > a0[9]) < (v2 >= a0[6])));
+        v0 = (((v0 >= 39) / 6) && ((v3 % 1) && (v1 >= a0[2])));
+        v1 = (((v0 || 16) ? (v2 >= a0[1]) : (v2 * a1[0][14])) && ((v0 || a0[12]) - (a1[1][1] >= 91)));
+    } else {
+        v2 = (((v0 / 6) * (v1 / 4)) < ((a1[3][5] < v1) != (v0 || v2)));
+        v2 = (((v0 == v1) > (v0 * a1[2][11])) == ((79 - 19) && (a0[9] >= a1[1][12])));
+        a1[2][12] = (((40 < v1) - (91 > v2)) + ((a0[1] == v3) * (v3 - 78)));
+    }
+    v3 = (((11 % 7) * (v3 - v1)) || ((62 && v1) % 3));
+    return (((a0[3] % 3) == (36 / 4)) - ((v1 + 26) % 5));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,7983 @@
+    .file 1 "build/bench/batch/f10.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 355 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 356 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 357 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 358 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 359 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 360 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $41, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $79, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $20, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $27, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movslq -4(%rbp), %rax
+    imulq $4, %rax
+    movslq %eax, %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_4
+    jmp .Lf0_1
+.Lf0_4:
+    .loc 1 12 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_10
+    .p2align 4,,10
+.Lf0_9:
+    .loc 1 13 17
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_11
+    jmp .Lf0_7
+.Lf0_11:
+    .loc 1 14 17
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $9, %rax
+    cmpq $7, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 15 17
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movq $78, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_13
+.Lf0_12:
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf0_15
+    jmp .Lf0_16
+.Lf0_15:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_17
+.Lf0_16:
+    movslq -340(%rbp), %rax
+.Lf0_17:
+    jmp .Lf0_14
+.Lf0_13:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_14:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_18
+    jmp .Lf0_19
+.Lf0_18:
+    movq $64, %rax
+    jmp .Lf0_20
+.Lf0_19:
+    movq $20, %rax
+.Lf0_20:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 16 17
+    movq $2, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_22
+.Lf0_21:
+    movq $86, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_23
+.Lf0_22:
+    movq $0, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_23:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_8:
+    .loc 1 12 38
+    incl -344(%rbp)
+.Lf0_10:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_9
+.Lf0_7:
+    addq $0, %rsp
+    .loc 1 18 13
+    movq $8, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_25
+    jmp .Lf0_24
+.Lf0_25:
+    movq $6, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_24:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 19 13
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_26
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -4(%rbp), %rax
+    imulq $30, %rax
+    movslq %eax, %rax
+    jmp .Lf0_28
+.Lf0_27:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_28:
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_29
+.Lf0_30:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_29:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -48(%rbp)
+    .loc 1 20 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 21 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 23 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    movslq -12(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 25 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 26 9
+    jmp .Lf0_38
+    .p2align 4,,10
+.Lf0_37:
+    .loc 1 27 13
+    cmpl $93, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_40
+.Lf0_39:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_41
+.Lf0_40:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_43
+    jmp .Lf0_42
+.Lf0_43:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_42:
+.Lf0_41:
+    push %rax
+    movq $76, %rax
+    cmpq $0, %rax
+    jne .Lf0_44
+    jmp .Lf0_45
+.Lf0_44:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_46
+.Lf0_45:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf0_46:
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -56(%rbp)
+    .loc 1 28 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_47
+    jmp .Lf0_48
+.Lf0_47:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_49
+.Lf0_48:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_49:
+    push %rax
+    movq $91, %rax
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_51
+.Lf0_50:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_52
+.Lf0_51:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf0_52:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $81, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_53
+    jmp .Lf0_54
+.Lf0_53:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_55
+.Lf0_54:
+    movq $73, %rax
+.Lf0_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 30 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 31 17
+    jmp .Lf0_59
+    .p2align 4,,10
+.Lf0_58:
+    .loc 1 32 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_62
+.Lf0_61:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_63
+.Lf0_62:
+    movslq -340(%rbp), %rax
+.Lf0_63:
+    cmpq $62, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_60
+    jmp .Lf0_56
+.Lf0_60:
+    .loc 1 33 21
+    movq $9, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $75, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 34 21
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_65
+    jmp .Lf0_64
+.Lf0_65:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_64:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 35 21
+    movq $9, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 36 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_57:
+.Lf0_59:
+    .loc 1 31 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_58
+.Lf0_56:
+    addq $0, %rsp
+    .loc 1 39 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_36:
+.Lf0_38:
+    .loc 1 26 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_37
+.Lf0_35:
+    addq $8, %rsp
+    .loc 1 43 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 44 9
+    .p2align 4,,10
+.Lf0_68:
+    .loc 1 45 13
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $91, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 47 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 48 17
+    jmp .Lf0_72
+    .p2align 4,,10
+.Lf0_71:
+    .loc 1 49 21
+    movq $90, %rax
+    subq $18, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    jne .Lf0_73
+    jmp .Lf0_74
+.Lf0_73:
+    movq $77, %rax
+    jmp .Lf0_75
+.Lf0_74:
+    movq $55, %rax
+.Lf0_75:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_77
+    jmp .Lf0_76
+.Lf0_77:
+    movq $76, %rax
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_79
+.Lf0_78:
+    movq $7, %rax
+    jmp .Lf0_80
+.Lf0_79:
+    movslq -340(%rbp), %rax
+.Lf0_80:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_76:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 50 21
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_82
+    jmp .Lf0_81
+.Lf0_82:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_81:
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_84
+    jmp .Lf0_83
+.Lf0_84:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_83:
+    push %rax
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_86
+    jmp .Lf0_85
+.Lf0_86:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_85:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -36(%rbp)
+    .loc 1 51 21
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_88
+    jmp .Lf0_87
+.Lf0_88:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_87:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $87, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_91
+.Lf0_90:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_93
+.Lf0_92:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_94
+.Lf0_93:
+    movslq -8(%rbp), %rax
+.Lf0_94:
+.Lf0_91:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 52 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_70:
+.Lf0_72:
+    .loc 1 48 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_71
+.Lf0_69:
+    addq $0, %rsp
+    .loc 1 55 13
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_96
+    jmp .Lf0_95
+.Lf0_96:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_95:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_97
+    jmp .Lf0_98
+.Lf0_97:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf0_99
+.Lf0_98:
+    movslq -24(%rbp), %rax
+.Lf0_99:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_101
+    jmp .Lf0_100
+.Lf0_101:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_100:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 56 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_67:
+    .loc 1 57 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_68
+.Lf0_66:
+    addq $8, %rsp
+    .loc 1 60 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 61 9
+    .p2align 4,,10
+.Lf0_104:
+    .loc 1 62 13
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_105
+    jmp .Lf0_102
+.Lf0_105:
+    .loc 1 63 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_111
+    .p2align 4,,10
+.Lf0_110:
+    .loc 1 64 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_114
+.Lf0_113:
+    movq $48, %rax
+    jmp .Lf0_115
+.Lf0_114:
+    movslq -80(%rbp), %rax
+.Lf0_115:
+    cmpq $52, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_112
+    jmp .Lf0_108
+.Lf0_112:
+    .loc 1 65 17
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_119
+    jmp .Lf0_118
+.Lf0_119:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_118:
+    push %rax
+    movq $68, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 66 17
+    movq $4, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_120
+.Lf0_121:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_120:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_123
+    jmp .Lf0_122
+.Lf0_123:
+    movq $88, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_122:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 67 17
+    movq $9, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_128
+    jmp .Lf0_127
+.Lf0_128:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_127:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_124
+    jmp .Lf0_125
+.Lf0_124:
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_130
+.Lf0_129:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_131
+.Lf0_130:
+    movslq -344(%rbp), %rax
+.Lf0_131:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_126
+.Lf0_125:
+    movq $6, %rax
+    push %rax
+    movq $13, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_126:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_109:
+    .loc 1 63 38
+    incl -344(%rbp)
+.Lf0_111:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_110
+.Lf0_108:
+    addq $0, %rsp
+    .loc 1 69 13
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $94, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_132
+    jmp .Lf0_133
+.Lf0_132:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_134
+.Lf0_133:
+    movslq -16(%rbp), %rax
+.Lf0_134:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -68(%rbp)
+    .loc 1 70 13
+    movslq -28(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_135
+    jmp .Lf0_136
+.Lf0_135:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_139
+    jmp .Lf0_138
+.Lf0_139:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_138:
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_137:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_144
+    jmp .Lf0_143
+.Lf0_144:
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_143:
+    cmpq $0, %rax
+    jne .Lf0_140
+    jmp .Lf0_141
+.Lf0_140:
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_142:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 71 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_103:
+    .loc 1 72 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_104
+.Lf0_102:
+    addq $8, %rsp
+    .loc 1 75 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 76 9
+    .p2align 4,,10
+.Lf0_147:
+    .loc 1 77 13
+    movq $7, %rax
+    push %rax
+    movq $90, %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_149
+    jmp .Lf0_148
+.Lf0_149:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_148:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 78 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_152
+.Lf0_151:
+    movq $71, %rax
+.Lf0_152:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_154
+    jmp .Lf0_153
+.Lf0_154:
+    movq $63, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_153:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $2, -72(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 80 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 81 17
+    jmp .Lf0_158
+    .p2align 4,,10
+.Lf0_157:
+    .loc 1 82 21
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    addq $50, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_159
+    jmp .Lf0_160
+.Lf0_159:
+    movq $24, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_161
+.Lf0_160:
+    movslq -8(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_161:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 83 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_162
+    jmp .Lf0_163
+.Lf0_162:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf0_164
+.Lf0_163:
+    movslq -8(%rbp), %rax
+.Lf0_164:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_165
+    jmp .Lf0_166
+.Lf0_165:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_167
+.Lf0_166:
+    movslq -4(%rbp), %rax
+.Lf0_167:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 84 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_169
+    jmp .Lf0_168
+.Lf0_169:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_168:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $86, -56(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_171
+    jmp .Lf0_170
+.Lf0_171:
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_170:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 85 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_156:
+.Lf0_158:
+    .loc 1 81 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_157
+.Lf0_155:
+    addq $0, %rsp
+    .loc 1 88 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_146:
+    .loc 1 89 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_147
+.Lf0_145:
+    addq $8, %rsp
+    .loc 1 91 5
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_173
+.Lf0_174:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf0_177
+.Lf0_176:
+    movslq -8(%rbp), %rax
+.Lf0_177:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_173:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_178
+    .loc 1 92 9
+    movslq -48(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $26, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $92, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    addq $10, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 93 9
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_180
+    jmp .Lf0_179
+.Lf0_180:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_179:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_182
+    jmp .Lf0_181
+.Lf0_182:
+    movq $5, %rax
+    push %rax
+    movq $16, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_181:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 94 9
+    movq $4, %rax
+    imulq $73, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_172
+.Lf0_178:
+    .loc 1 96 9
+    movq $70, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_184
+    jmp .Lf0_183
+.Lf0_184:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_183:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_186
+.Lf0_185:
+    movq $50, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_187
+.Lf0_186:
+    movslq -8(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_187:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 97 9
+    movq $1, %rax
+    push %rax
+    movq $30, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_189
+    jmp .Lf0_188
+.Lf0_189:
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_188:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 98 9
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_191
+    jmp .Lf0_190
+.Lf0_191:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_190:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_172:
+    .loc 1 100 5
+    movq $7, %rax
+    push %rax
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_193
+.Lf0_194:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_193:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $87, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_195
+    .loc 1 101 9
+    movslq -16(%rbp), %rax
+    subq $65, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_196
+    jmp .Lf0_197
+.Lf0_196:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_200
+.Lf0_199:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_201
+.Lf0_200:
+    movslq -4(%rbp), %rax
+.Lf0_201:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_198
+.Lf0_197:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_203
+.Lf0_202:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -76(%rbp), %rax
+.Lf0_204:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    movl %eax, -16(%rbp)
+    .loc 1 102 9
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_208
+    jmp .Lf0_209
+.Lf0_208:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_210
+.Lf0_209:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf0_210:
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_206
+.Lf0_205:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_211
+    jmp .Lf0_212
+.Lf0_211:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_213
+.Lf0_212:
+    movslq -12(%rbp), %rax
+.Lf0_213:
+    jmp .Lf0_207
+.Lf0_206:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_207:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_217
+    jmp .Lf0_218
+.Lf0_217:
+    movq $27, %rax
+    jmp .Lf0_219
+.Lf0_218:
+    movslq -16(%rbp), %rax
+.Lf0_219:
+    cmpq $0, %rax
+    jne .Lf0_214
+    jmp .Lf0_215
+.Lf0_214:
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_216
+.Lf0_215:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    subq $42, %rax
+    movslq %eax, %rax
+.Lf0_216:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 103 9
+    movq $9, %rax
+    push %rax
+    movq $76, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_221
+    jmp .Lf0_220
+.Lf0_221:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_223
+    jmp .Lf0_222
+.Lf0_223:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_222:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_220:
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $11, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_224
+    jmp .Lf0_225
+.Lf0_224:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -4(%rbp), %rax
+.Lf0_226:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_192
+.Lf0_195:
+    .loc 1 105 9
+    movq $1, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 106 9
+    cmpl $56, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $21, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_227
+    jmp .Lf0_228
+.Lf0_227:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_231
+    jmp .Lf0_230
+.Lf0_231:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_230:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_229
+.Lf0_228:
+    movslq -28(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_229:
+    movl %eax, -12(%rbp)
+    .loc 1 107 9
+    movq $4, %rax
+    push %rax
+    cmpl $53, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_192:
+    .loc 1 109 5
+    movq $6, %rax
+    push %rax
+    cmpl $60, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $79, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_233
+    .loc 1 110 9
+    movq $7, %rax
+    push %rax
+    movq $73, %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_234
+.Lf0_235:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_234:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 111 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_240
+    jmp .Lf0_239
+.Lf0_240:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_239:
+    cmpq $0, %rax
+    jne .Lf0_236
+    jmp .Lf0_237
+.Lf0_236:
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_238
+.Lf0_237:
+    cmpl $51, -12(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf0_238:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_242
+    jmp .Lf0_241
+.Lf0_242:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_241:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_244
+    jmp .Lf0_243
+.Lf0_244:
+    movslq -4(%rbp), %rax
+    imulq $82, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_243:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 112 9
+    movq $58, %rax
+    cmpq $0, %rax
+    jne .Lf0_245
+    jmp .Lf0_246
+.Lf0_245:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_247
+.Lf0_246:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf0_247:
+    push %rax
+    movq $56, %rax
+    imulq $67, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_249
+    jmp .Lf0_248
+.Lf0_249:
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_248:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_232
+.Lf0_233:
+    .loc 1 114 9
+    movslq -16(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_251
+    jmp .Lf0_250
+.Lf0_251:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_250:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $8, %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 115 9
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_253
+    jmp .Lf0_252
+.Lf0_253:
+    movslq -16(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_252:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_255
+    jmp .Lf0_254
+.Lf0_255:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_259
+    jmp .Lf0_260
+.Lf0_259:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_261
+.Lf0_260:
+    movslq -64(%rbp), %rax
+.Lf0_261:
+    cmpq $0, %rax
+    jne .Lf0_256
+    jmp .Lf0_257
+.Lf0_256:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_263
+    jmp .Lf0_262
+.Lf0_263:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_262:
+    jmp .Lf0_258
+.Lf0_257:
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_258:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_254:
+    movl %eax, -16(%rbp)
+    .loc 1 116 9
+    movq $7, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_232:
+    .loc 1 118 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_269
+    .p2align 4,,10
+.Lf0_268:
+    .loc 1 119 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_273
+    jmp .Lf0_274
+.Lf0_273:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_275
+.Lf0_274:
+    movq $41, %rax
+.Lf0_275:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_270
+    jmp .Lf0_271
+.Lf0_270:
+    movq $65, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_277
+    jmp .Lf0_276
+.Lf0_277:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_279
+    jmp .Lf0_278
+.Lf0_279:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_278:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_276:
+    jmp .Lf0_272
+.Lf0_271:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_280
+    jmp .Lf0_281
+.Lf0_280:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_282
+.Lf0_281:
+    movslq -16(%rbp), %rax
+.Lf0_282:
+    push %rax
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_284
+    jmp .Lf0_283
+.Lf0_284:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_283:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_272:
+    movl %eax, -8(%rbp)
+    .loc 1 121 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 122 13
+    jmp .Lf0_288
+    .p2align 4,,10
+.Lf0_287:
+    .loc 1 123 17
+    movq $17, %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_290
+    jmp .Lf0_289
+.Lf0_290:
+    movq $21, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_289:
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_292
+    jmp .Lf0_291
+.Lf0_292:
+    movq $22, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_291:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 124 17
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_293
+    jmp .Lf0_294
+.Lf0_293:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_295
+.Lf0_294:
+    movslq -12(%rbp), %rax
+.Lf0_295:
+    push %rax
+    movslq -24(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $67, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_297
+    jmp .Lf0_296
+.Lf0_297:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_296:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 125 17
+    movslq -4(%rbp), %rax
+    imulq $55, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $12, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_299
+    jmp .Lf0_298
+.Lf0_299:
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_301
+    jmp .Lf0_300
+.Lf0_301:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_300:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_298:
+    movl %eax, -12(%rbp)
+    .loc 1 126 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_286:
+.Lf0_288:
+    .loc 1 122 20
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_287
+.Lf0_285:
+    addq $0, %rsp
+    .loc 1 129 9
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_303
+    jmp .Lf0_302
+.Lf0_303:
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_302:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_305
+    jmp .Lf0_304
+.Lf0_305:
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_304:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_267:
+    .loc 1 118 32
+    incl -340(%rbp)
+.Lf0_269:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_268
+.Lf0_266:
+    addq $8, %rsp
+    .loc 1 131 5
+    movq $2, %rax
+    push %rax
+    movq $10, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $52, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_306
+    jmp .Lf0_307
+.Lf0_306:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_308
+.Lf0_307:
+    movslq -12(%rbp), %rax
+.Lf0_308:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 133 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 134 5
+    subq $8, %rsp
+    movq $42, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 135 5
+    movq $6, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 136 5
+    subq $8, %rsp
+    movq $81, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 137 5
+    movq $59, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 138 5
+    subq $64, %rsp
+    .loc 1 139 5
+    subq $256, %rsp
+    .loc 1 141 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 142 9
+    jmp .Lf1_4
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 144 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 145 17
+    .p2align 4,,10
+.Lf1_7:
+    .loc 1 146 21
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_11
+    jmp .Lf1_12
+.Lf1_11:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_13
+.Lf1_12:
+    movq $7, %rax
+.Lf1_13:
+    cmpq $0, %rax
+    jne .Lf1_8
+    jmp .Lf1_9
+.Lf1_8:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_14
+    jmp .Lf1_15
+.Lf1_14:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_16
+.Lf1_15:
+    movq $31, %rax
+.Lf1_16:
+    jmp .Lf1_10
+.Lf1_9:
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf1_10:
+    push %rax
+    movq $64, %rax
+    cmpq $0, %rax
+    jne .Lf1_17
+    jmp .Lf1_18
+.Lf1_17:
+    movq $21, %rax
+    jmp .Lf1_19
+.Lf1_18:
+    movq $92, %rax
+.Lf1_19:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_21
+    jmp .Lf1_20
+.Lf1_21:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_23
+.Lf1_22:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_24
+.Lf1_23:
+    movq $40, %rax
+.Lf1_24:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_20:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 147 21
+    movq $3, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_25
+    jmp .Lf1_26
+.Lf1_25:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_29
+    jmp .Lf1_28
+.Lf1_29:
+    movq $43, %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_28:
+    jmp .Lf1_27
+.Lf1_26:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_27:
+    movl %eax, -16(%rbp)
+    .loc 1 148 21
+    movq $43, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $72, %rax
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_31
+.Lf1_30:
+    movslq -40(%rbp), %rax
+    jmp .Lf1_32
+.Lf1_31:
+    movslq -16(%rbp), %rax
+.Lf1_32:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $5, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 149 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_6:
+    .loc 1 150 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_7
+.Lf1_5:
+    addq $0, %rsp
+    .loc 1 152 13
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_34
+    jmp .Lf1_33
+.Lf1_34:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_36
+    jmp .Lf1_35
+.Lf1_36:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_35:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -40(%rbp)
+    .loc 1 153 13
+    movslq -20(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $55, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $91, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $8, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 154 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+.Lf1_4:
+    .loc 1 142 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 158 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 159 9
+    .p2align 4,,10
+.Lf1_39:
+    .loc 1 160 13
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $90, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_40
+    jmp .Lf1_37
+.Lf1_40:
+    .loc 1 161 13
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_42
+    jmp .Lf1_41
+.Lf1_42:
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_41:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 163 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 164 17
+    jmp .Lf1_46
+    .p2align 4,,10
+.Lf1_45:
+    .loc 1 165 21
+    movq $5, %rax
+    push %rax
+    cmpl $87, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_48
+.Lf1_47:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_49
+.Lf1_48:
+    movslq -340(%rbp), %rax
+.Lf1_49:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 166 21
+    movq $1, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_50
+    jmp .Lf1_51
+.Lf1_50:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_52
+.Lf1_51:
+    movq $25, %rax
+.Lf1_52:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 167 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_53
+    jmp .Lf1_54
+.Lf1_53:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_55
+.Lf1_54:
+    movslq -344(%rbp), %rax
+.Lf1_55:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $23, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $49, %rax
+    imulq $47, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_57
+.Lf1_56:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_58
+.Lf1_57:
+    movq $40, %rax
+.Lf1_58:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 168 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_44:
+.Lf1_46:
+    .loc 1 164 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_45
+.Lf1_43:
+    addq $0, %rsp
+    .loc 1 171 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_59
+    jmp .Lf1_60
+.Lf1_59:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_61
+.Lf1_60:
+    movslq -4(%rbp), %rax
+.Lf1_61:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $77, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 172 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_38:
+    .loc 1 173 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_39
+.Lf1_37:
+    addq $8, %rsp
+    .loc 1 175 5
+    movslq -16(%rbp), %rax
+    imulq $87, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_63
+    jmp .Lf1_62
+.Lf1_63:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_62:
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 177 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 178 9
+    jmp .Lf1_67
+    .p2align 4,,10
+.Lf1_66:
+    .loc 1 179 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_73
+    .p2align 4,,10
+.Lf1_72:
+    .loc 1 180 17
+    movslq -20(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $78, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_74
+    jmp .Lf1_70
+.Lf1_74:
+    .loc 1 181 17
+    movq $27, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_76
+    jmp .Lf1_75
+.Lf1_76:
+    movq $81, %rax
+    cmpq $88, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_75:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 182 17
+    movq $8, %rax
+    push %rax
+    movq $31, %rax
+    cmpq $28, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_78
+    jmp .Lf1_77
+.Lf1_78:
+    movq $54, %rax
+    cmpq $0, %rax
+    jne .Lf1_79
+    jmp .Lf1_80
+.Lf1_79:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_81
+.Lf1_80:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf1_81:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_77:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 183 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_82
+    jmp .Lf1_83
+.Lf1_82:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_84
+.Lf1_83:
+    movq $50, %rax
+.Lf1_84:
+    push %rax
+    movslq -52(%rbp), %rax
+    addq $86, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_86
+    jmp .Lf1_85
+.Lf1_86:
+    movq $1, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_87
+    jmp .Lf1_88
+.Lf1_87:
+    movq $68, %rax
+    jmp .Lf1_89
+.Lf1_88:
+    movslq -44(%rbp), %rax
+.Lf1_89:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_85:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_71:
+    .loc 1 179 38
+    incl -344(%rbp)
+.Lf1_73:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_72
+.Lf1_70:
+    addq $0, %rsp
+    .loc 1 185 13
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_90
+.Lf1_91:
+    movslq -16(%rbp), %rax
+    subq $88, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_90:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_93
+    jmp .Lf1_92
+.Lf1_93:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_92:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 186 13
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_94
+    jmp .Lf1_95
+.Lf1_94:
+    movq $31, %rax
+    jmp .Lf1_96
+.Lf1_95:
+    movq $96, %rax
+.Lf1_96:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 187 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_65:
+.Lf1_67:
+    .loc 1 178 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_66
+.Lf1_64:
+    addq $8, %rsp
+    .loc 1 191 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 192 9
+    jmp .Lf1_100
+    .p2align 4,,10
+.Lf1_99:
+    .loc 1 194 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 195 17
+    jmp .Lf1_104
+    .p2align 4,,10
+.Lf1_103:
+    .loc 1 196 21
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $90, %rax
+    cmpq $0, %rax
+    jne .Lf1_105
+    jmp .Lf1_106
+.Lf1_105:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_107
+.Lf1_106:
+    movslq -76(%rbp), %rax
+.Lf1_107:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_109
+    jmp .Lf1_108
+.Lf1_109:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_111
+.Lf1_110:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf1_112
+.Lf1_111:
+    movq $38, %rax
+.Lf1_112:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_108:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 197 21
+    cmpl $27, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $41, %rax
+    subq $92, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 198 21
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_113
+    jmp .Lf1_114
+.Lf1_113:
+    movq $6, %rax
+    jmp .Lf1_115
+.Lf1_114:
+    movq $66, %rax
+.Lf1_115:
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_117
+    jmp .Lf1_116
+.Lf1_117:
+    movq $7, %rax
+    push %rax
+    movq $61, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $65, %rax
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_119
+.Lf1_118:
+    movslq -32(%rbp), %rax
+    jmp .Lf1_120
+.Lf1_119:
+    movslq -8(%rbp), %rax
+.Lf1_120:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_116:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 199 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_102:
+.Lf1_104:
+    .loc 1 195 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_103
+.Lf1_101:
+    addq $0, %rsp
+    .loc 1 202 13
+    movq $41, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_122
+    jmp .Lf1_121
+.Lf1_122:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_121:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $16, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 203 13
+    movq $58, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_124
+    jmp .Lf1_123
+.Lf1_124:
+    movq $3, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_123:
+    movl %eax, -68(%rbp)
+    .loc 1 204 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_98:
+.Lf1_100:
+    .loc 1 192 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_99
+.Lf1_97:
+    addq $8, %rsp
+    .loc 1 208 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 209 9
+    .p2align 4,,10
+.Lf1_127:
+    .loc 1 211 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 212 17
+    jmp .Lf1_131
+    .p2align 4,,10
+.Lf1_130:
+    .loc 1 213 21
+    movq $8, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $83, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_133
+    jmp .Lf1_132
+.Lf1_133:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_132:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 214 21
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_134
+    jmp .Lf1_135
+.Lf1_134:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_136
+.Lf1_135:
+    movq $18, %rax
+.Lf1_136:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_138
+    jmp .Lf1_137
+.Lf1_138:
+    movq $5, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_139
+    jmp .Lf1_140
+.Lf1_139:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_141
+.Lf1_140:
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_141:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_137:
+    movl %eax, -4(%rbp)
+    .loc 1 215 21
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_143
+    jmp .Lf1_142
+.Lf1_143:
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_142:
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_145
+    jmp .Lf1_144
+.Lf1_145:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_144:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_147
+    jmp .Lf1_146
+.Lf1_147:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_149
+    jmp .Lf1_148
+.Lf1_149:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_148:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_146:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 216 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_129:
+.Lf1_131:
+    .loc 1 212 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_130
+.Lf1_128:
+    addq $0, %rsp
+    .loc 1 219 13
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_150
+    jmp .Lf1_151
+.Lf1_150:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_152
+.Lf1_151:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_152:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 220 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $18, %rax
+    cmpq $76, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_154
+    jmp .Lf1_153
+.Lf1_154:
+    movslq -24(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_153:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 221 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_126:
+    .loc 1 222 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_127
+.Lf1_125:
+    addq $8, %rsp
+    .loc 1 224 5
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_155
+    jmp .Lf1_156
+.Lf1_155:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_157
+.Lf1_156:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_157:
+    push %rax
+    cmpl $95, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 225 5
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_159
+    jmp .Lf1_158
+.Lf1_159:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_158:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_161
+    jmp .Lf1_160
+.Lf1_161:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_160:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $95, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 226 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_167
+    .p2align 4,,10
+.Lf1_166:
+    .loc 1 228 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 229 13
+    .p2align 4,,10
+.Lf1_170:
+    .loc 1 230 17
+    movslq -344(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $51, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_171
+    jmp .Lf1_168
+.Lf1_171:
+    .loc 1 231 17
+    movq $1, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $59, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_172
+    jmp .Lf1_173
+.Lf1_172:
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_174
+.Lf1_173:
+    movslq -344(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_174:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 232 17
+    movq $13, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_176
+    jmp .Lf1_175
+.Lf1_176:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_175:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_178
+    jmp .Lf1_177
+.Lf1_178:
+    movq $35, %rax
+    cmpq $0, %rax
+    jne .Lf1_179
+    jmp .Lf1_180
+.Lf1_179:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_181
+.Lf1_180:
+    movslq -4(%rbp), %rax
+.Lf1_181:
+    push %rax
+    movq $10, %rax
+    cmpq $13, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_177:
+    movl %eax, -24(%rbp)
+    .loc 1 233 17
+    movq $3, %rax
+    push %rax
+    movq $20, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_182
+    jmp .Lf1_183
+.Lf1_182:
+    movq $95, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_184
+.Lf1_183:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_185
+.Lf1_186:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_185:
+.Lf1_184:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_188
+    jmp .Lf1_187
+.Lf1_188:
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_190
+    jmp .Lf1_189
+.Lf1_190:
+    movslq -36(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_189:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_187:
+    movl %eax, -8(%rbp)
+    .loc 1 234 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_169:
+    .loc 1 235 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_170
+.Lf1_168:
+    addq $0, %rsp
+    .loc 1 237 9
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $95, -64(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_192
+    jmp .Lf1_191
+.Lf1_192:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_194
+    jmp .Lf1_193
+.Lf1_194:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_193:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_191:
+    movl %eax, -4(%rbp)
+    .loc 1 238 9
+    cmpl $52, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_199
+.Lf1_198:
+    movslq -20(%rbp), %rax
+    jmp .Lf1_200
+.Lf1_199:
+    movslq -12(%rbp), %rax
+.Lf1_200:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_195
+    jmp .Lf1_196
+.Lf1_195:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_204
+    jmp .Lf1_205
+.Lf1_204:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_206
+.Lf1_205:
+    movslq -8(%rbp), %rax
+.Lf1_206:
+    cmpq $0, %rax
+    jne .Lf1_201
+    jmp .Lf1_202
+.Lf1_201:
+    movq $10, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_203
+.Lf1_202:
+    movq $9, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_203:
+    jmp .Lf1_197
+.Lf1_196:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_207
+    jmp .Lf1_208
+.Lf1_207:
+    movslq -76(%rbp), %rax
+    jmp .Lf1_209
+.Lf1_208:
+    movq $13, %rax
+.Lf1_209:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_197:
+    movl %eax, -68(%rbp)
+    addq $0, %rsp
+.Lf1_165:
+    .loc 1 226 32
+    incl -340(%rbp)
+.Lf1_167:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_166
+.Lf1_164:
+    addq $8, %rsp
+    .loc 1 241 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 242 9
+    jmp .Lf1_213
+    .p2align 4,,10
+.Lf1_212:
+    .loc 1 243 13
+    movslq -24(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $62, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_214
+    jmp .Lf1_210
+.Lf1_214:
+    .loc 1 244 13
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_215
+    jmp .Lf1_216
+.Lf1_215:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -4(%rbp), %rax
+.Lf1_217:
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_218
+    jmp .Lf1_219
+.Lf1_218:
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_220
+.Lf1_219:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_220:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 245 13
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_225
+    jmp .Lf1_224
+.Lf1_225:
+    movq $75, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_224:
+    cmpq $0, %rax
+    jne .Lf1_221
+    jmp .Lf1_222
+.Lf1_221:
+    cmpl $55, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_227
+    jmp .Lf1_226
+.Lf1_227:
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_226:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_223
+.Lf1_222:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_223:
+    movl %eax, -8(%rbp)
+    .loc 1 246 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_233
+    .p2align 4,,10
+.Lf1_232:
+    .loc 1 247 17
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_237
+    jmp .Lf1_238
+.Lf1_237:
+    movq $5, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_241
+    jmp .Lf1_240
+.Lf1_241:
+    movslq -340(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_240:
+    jmp .Lf1_239
+.Lf1_238:
+    movq $9, %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -44(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_239:
+    movl %eax, -16(%rbp)
+    .loc 1 248 17
+    movq $7, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 249 17
+    movq $1, %rax
+    push %rax
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_243
+    jmp .Lf1_242
+.Lf1_243:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_242:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_236:
+    .loc 1 246 40
+    incl -344(%rbp)
+    .loc 1 247 17
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_244
+    jmp .Lf1_245
+.Lf1_244:
+    movq $5, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_248
+    jmp .Lf1_247
+.Lf1_248:
+    movslq -340(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_247:
+    jmp .Lf1_246
+.Lf1_245:
+    movq $9, %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -44(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_246:
+    movl %eax, -16(%rbp)
+    .loc 1 248 17
+    movq $7, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 249 17
+    movq $1, %rax
+    push %rax
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_250
+    jmp .Lf1_249
+.Lf1_250:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_249:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_235:
+    .loc 1 246 40
+    incl -344(%rbp)
+.Lf1_233:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $7, %rax
+    jl .Lf1_232
+.Lf1_234:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_230
+    .loc 1 247 17
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_251
+    jmp .Lf1_252
+.Lf1_251:
+    movq $5, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_254
+.Lf1_255:
+    movslq -340(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_254:
+    jmp .Lf1_253
+.Lf1_252:
+    movq $9, %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -44(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_253:
+    movl %eax, -16(%rbp)
+    .loc 1 248 17
+    movq $7, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 249 17
+    movq $1, %rax
+    push %rax
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_257
+    jmp .Lf1_256
+.Lf1_257:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_256:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_231:
+    .loc 1 246 40
+    incl -344(%rbp)
+    jmp .Lf1_234
+.Lf1_230:
+    addq $0, %rsp
+    .loc 1 251 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_211:
+.Lf1_213:
+    .loc 1 242 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_212
+.Lf1_210:
+    addq $8, %rsp
+    .loc 1 254 5
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_258
+    jmp .Lf1_259
+.Lf1_258:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_260
+.Lf1_259:
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_260:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 256 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 257 5
+    subq $8, %rsp
+    movq $8, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 258 5
+    movq $78, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 259 5
+    subq $8, %rsp
+    movq $87, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 260 5
+    movq $22, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 261 5
+    subq $64, %rsp
+    .loc 1 262 5
+    subq $256, %rsp
+    .loc 1 263 5
+    movq $8, %rax
+    push %rax
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_3
+    jmp .Lf2_2
+.Lf2_3:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_2:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_4
+    jmp .Lf2_5
+.Lf2_4:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf2_6
+.Lf2_5:
+    movq $92, %rax
+.Lf2_6:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_7
+    .loc 1 264 9
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_11
+    jmp .Lf2_12
+.Lf2_11:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_13
+.Lf2_12:
+    movq $36, %rax
+.Lf2_13:
+    cmpq $0, %rax
+    jne .Lf2_8
+    jmp .Lf2_9
+.Lf2_8:
+    movq $95, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_10
+.Lf2_9:
+    movq $44, %rax
+    cmpq $40, %rax
+    movq $0, %rax
+    sete %al
+.Lf2_10:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $62, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 265 9
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $9, -36(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    cmpq $0, %rax
+    jne .Lf2_14
+    jmp .Lf2_15
+.Lf2_14:
+    movq $19, %rax
+    jmp .Lf2_16
+.Lf2_15:
+    movq $14, %rax
+.Lf2_16:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 266 9
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $58, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_17
+    jmp .Lf2_18
+.Lf2_17:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf2_19
+.Lf2_18:
+    movslq -12(%rbp), %rax
+.Lf2_19:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $64, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $87, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_1
+.Lf2_7:
+    .loc 1 268 9
+    movq $8, %rax
+    push %rax
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf2_20
+    jmp .Lf2_21
+.Lf2_20:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_22
+.Lf2_21:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf2_22:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $43, %rax
+    cmpq $0, %rax
+    jne .Lf2_23
+    jmp .Lf2_24
+.Lf2_23:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_25
+.Lf2_24:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf2_25:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 269 9
+    movq $47, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_27
+    jmp .Lf2_26
+.Lf2_27:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_26:
+    push %rax
+    movq $38, %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 270 9
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_28
+    jmp .Lf2_29
+.Lf2_28:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_30
+.Lf2_29:
+    movslq -12(%rbp), %rax
+.Lf2_30:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_32
+.Lf2_31:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_33
+.Lf2_32:
+    movslq -12(%rbp), %rax
+.Lf2_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_35
+    jmp .Lf2_34
+.Lf2_35:
+    movslq -4(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_36
+    jmp .Lf2_37
+.Lf2_36:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_40
+    jmp .Lf2_39
+.Lf2_40:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_39:
+    jmp .Lf2_38
+.Lf2_37:
+    cmpl $28, -16(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf2_38:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_34:
+    movl %eax, -24(%rbp)
+    addq $0, %rsp
+.Lf2_1:
+    .loc 1 272 5
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_42
+    jmp .Lf2_41
+.Lf2_42:
+    movslq -16(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_41:
+    push %rax
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_44
+    jmp .Lf2_43
+.Lf2_44:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_43:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_46
+    jmp .Lf2_45
+.Lf2_46:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_45:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 274 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 275 9
+    .p2align 4,,10
+.Lf2_49:
+    .loc 1 276 13
+    movslq -36(%rbp), %rax
+    addl -76(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $80, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_50
+    jmp .Lf2_47
+.Lf2_50:
+    .loc 1 277 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 278 17
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $92, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_57
+    jmp .Lf2_56
+.Lf2_57:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_56:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 279 17
+    movq $8, %rax
+    push %rax
+    movq $8, %rax
+    cmpq $0, %rax
+    jne .Lf2_58
+    jmp .Lf2_59
+.Lf2_58:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_60
+.Lf2_59:
+    movq $64, %rax
+.Lf2_60:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_62
+    jmp .Lf2_61
+.Lf2_62:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_61:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 280 17
+    movq $1, %rax
+    push %rax
+    movq $69, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_64
+    jmp .Lf2_63
+.Lf2_64:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_63:
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf2_55:
+    .loc 1 277 38
+    incl -344(%rbp)
+    .loc 1 278 17
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $92, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_67
+    jmp .Lf2_66
+.Lf2_67:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_66:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 279 17
+    movq $8, %rax
+    push %rax
+    movq $8, %rax
+    cmpq $0, %rax
+    jne .Lf2_68
+    jmp .Lf2_69
+.Lf2_68:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_70
+.Lf2_69:
+    movq $64, %rax
+.Lf2_70:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_72
+    jmp .Lf2_71
+.Lf2_72:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_71:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 280 17
+    movq $1, %rax
+    push %rax
+    movq $69, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_74
+    jmp .Lf2_73
+.Lf2_74:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_73:
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf2_65:
+    .loc 1 277 38
+    incl -344(%rbp)
+    .loc 1 278 17
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $92, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_76
+    jmp .Lf2_75
+.Lf2_76:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_75:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 279 17
+    movq $8, %rax
+    push %rax
+    movq $8, %rax
+    cmpq $0, %rax
+    jne .Lf2_77
+    jmp .Lf2_78
+.Lf2_77:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_79
+.Lf2_78:
+    movq $64, %rax
+.Lf2_79:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_80
+.Lf2_81:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_80:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 280 17
+    movq $1, %rax
+    push %rax
+    movq $69, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_83
+    jmp .Lf2_82
+.Lf2_83:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_82:
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf2_54:
+    .loc 1 277 38
+    incl -344(%rbp)
+.Lf2_53:
+    addq $0, %rsp
+    .loc 1 282 13
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 283 13
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_84
+    jmp .Lf2_85
+.Lf2_84:
+    cmpl $44, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_86
+.Lf2_85:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_87
+    jmp .Lf2_88
+.Lf2_87:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf2_89
+.Lf2_88:
+    movslq -340(%rbp), %rax
+.Lf2_89:
+.Lf2_86:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_91
+    jmp .Lf2_90
+.Lf2_91:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_93
+    jmp .Lf2_92
+.Lf2_93:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_92:
+    push %rax
+    cmpl $83, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_90:
+    movl %eax, -12(%rbp)
+    .loc 1 284 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_48:
+    .loc 1 285 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_49
+.Lf2_47:
+    addq $8, %rsp
+    .loc 1 287 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_99
+    .p2align 4,,10
+.Lf2_98:
+    .loc 1 288 9
+    movq $67, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $85, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_100
+    jmp .Lf2_96
+.Lf2_100:
+    .loc 1 289 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_106
+    .p2align 4,,10
+.Lf2_105:
+    .loc 1 290 13
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $93, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_107
+    jmp .Lf2_103
+.Lf2_107:
+    .loc 1 291 13
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_112
+    jmp .Lf2_111
+.Lf2_112:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_111:
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_108
+    jmp .Lf2_109
+.Lf2_108:
+    movq $67, %rax
+    cmpq $0, %rax
+    jne .Lf2_113
+    jmp .Lf2_114
+.Lf2_113:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_115
+.Lf2_114:
+    movslq -12(%rbp), %rax
+.Lf2_115:
+    push %rax
+    movq $0, %rax
+    cmpq $0, %rax
+    jne .Lf2_116
+    jmp .Lf2_117
+.Lf2_116:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_118
+.Lf2_117:
+    movq $89, %rax
+.Lf2_118:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_110
+.Lf2_109:
+    movq $3, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_110:
+    movl %eax, -16(%rbp)
+    .loc 1 292 13
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_119
+    jmp .Lf2_120
+.Lf2_119:
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_121
+.Lf2_120:
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_121:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_126
+    jmp .Lf2_125
+.Lf2_126:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_125:
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_123
+.Lf2_122:
+    movq $22, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_124
+.Lf2_123:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_124:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -32(%rbp)
+    .loc 1 293 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_130
+    jmp .Lf2_131
+.Lf2_130:
+    movslq -44(%rbp), %rax
+    jmp .Lf2_132
+.Lf2_131:
+    movslq -8(%rbp), %rax
+.Lf2_132:
+    push %rax
+    movq $18, %rax
+    cmpq $29, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_127
+    jmp .Lf2_128
+.Lf2_127:
+    movq $70, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -64(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_129
+.Lf2_128:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $22, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_129:
+    movl %eax, -80(%rbp)
+    addq $0, %rsp
+.Lf2_104:
+    .loc 1 289 34
+    incl -344(%rbp)
+.Lf2_106:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_105
+.Lf2_103:
+    addq $0, %rsp
+    .loc 1 295 9
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $74, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -36(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_134
+    jmp .Lf2_133
+.Lf2_134:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_136
+    jmp .Lf2_135
+.Lf2_136:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_137
+    jmp .Lf2_138
+.Lf2_137:
+    movslq -28(%rbp), %rax
+    jmp .Lf2_139
+.Lf2_138:
+    movslq -8(%rbp), %rax
+.Lf2_139:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_135:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_133:
+    movl %eax, -4(%rbp)
+    .loc 1 296 9
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_141
+    jmp .Lf2_140
+.Lf2_141:
+    movslq -340(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_140:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_142
+    jmp .Lf2_143
+.Lf2_142:
+    movq $86, %rax
+    jmp .Lf2_144
+.Lf2_143:
+    movq $1, %rax
+.Lf2_144:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_97:
+    .loc 1 287 30
+    incl -340(%rbp)
+.Lf2_99:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_98
+.Lf2_96:
+    addq $8, %rsp
+    .loc 1 299 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 300 9
+    .p2align 4,,10
+.Lf2_147:
+    .loc 1 301 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_149
+    jmp .Lf2_148
+.Lf2_149:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_148:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_151
+    jmp .Lf2_150
+.Lf2_151:
+    movq $88, %rax
+    cmpq $92, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_150:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $61, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_153
+    jmp .Lf2_152
+.Lf2_153:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_152:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 302 13
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_154
+    jmp .Lf2_155
+.Lf2_154:
+    movslq -8(%rbp), %rax
+    addq $30, %rax
+    movslq %eax, %rax
+    jmp .Lf2_156
+.Lf2_155:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_156:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $21, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 303 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_162
+    .p2align 4,,10
+.Lf2_161:
+    .loc 1 304 17
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_163
+    jmp .Lf2_159
+.Lf2_163:
+    .loc 1 305 17
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_167
+    jmp .Lf2_168
+.Lf2_167:
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_169
+.Lf2_168:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_171
+    jmp .Lf2_170
+.Lf2_171:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_170:
+.Lf2_169:
+    cmpq $0, %rax
+    jne .Lf2_164
+    jmp .Lf2_165
+.Lf2_164:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_173
+    jmp .Lf2_172
+.Lf2_173:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_172:
+    push %rax
+    movslq -24(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_166
+.Lf2_165:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_175
+    jmp .Lf2_174
+.Lf2_175:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_174:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_177
+    jmp .Lf2_176
+.Lf2_177:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_176:
+.Lf2_166:
+    movl %eax, -40(%rbp)
+    .loc 1 306 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_179
+    jmp .Lf2_178
+.Lf2_179:
+    movq $60, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_178:
+    push %rax
+    movq $69, %rax
+    cmpq $0, %rax
+    jne .Lf2_180
+    jmp .Lf2_181
+.Lf2_180:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_182
+.Lf2_181:
+    movslq -8(%rbp), %rax
+.Lf2_182:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_184
+    jmp .Lf2_183
+.Lf2_184:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_183:
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 307 17
+    cmpl $49, -64(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_185
+    jmp .Lf2_186
+.Lf2_185:
+    movslq -68(%rbp), %rax
+    jmp .Lf2_187
+.Lf2_186:
+    movslq -344(%rbp), %rax
+.Lf2_187:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    subq $22, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_188
+    jmp .Lf2_189
+.Lf2_188:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_190
+.Lf2_189:
+    movslq -12(%rbp), %rax
+.Lf2_190:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_160:
+    .loc 1 303 38
+    incl -344(%rbp)
+.Lf2_162:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_161
+.Lf2_159:
+    addq $0, %rsp
+    .loc 1 309 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_146:
+    .loc 1 310 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_147
+.Lf2_145:
+    addq $8, %rsp
+    .loc 1 313 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 314 9
+    jmp .Lf2_194
+    .p2align 4,,10
+.Lf2_193:
+    .loc 1 315 13
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_196
+    jmp .Lf2_195
+.Lf2_196:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_195:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_198
+    jmp .Lf2_197
+.Lf2_198:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_199
+    jmp .Lf2_200
+.Lf2_199:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_201
+.Lf2_200:
+    movslq -8(%rbp), %rax
+.Lf2_201:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_197:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_203
+    jmp .Lf2_202
+.Lf2_203:
+    movq $83, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_202:
+    movl %eax, -8(%rbp)
+    .loc 1 317 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 318 17
+    jmp .Lf2_207
+    .p2align 4,,10
+.Lf2_206:
+    .loc 1 319 21
+    movq $23, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_208
+    jmp .Lf2_209
+.Lf2_208:
+    cmpl $96, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_210
+.Lf2_209:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_210:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 320 21
+    movq $18, %rax
+    cmpq $0, %rax
+    jne .Lf2_211
+    jmp .Lf2_212
+.Lf2_211:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_213
+.Lf2_212:
+    movslq -12(%rbp), %rax
+.Lf2_213:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_214
+    jmp .Lf2_215
+.Lf2_214:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_217
+    jmp .Lf2_218
+.Lf2_217:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_219
+.Lf2_218:
+    movq $41, %rax
+.Lf2_219:
+    jmp .Lf2_216
+.Lf2_215:
+    cmpl $36, -40(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf2_216:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 321 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_223
+    jmp .Lf2_224
+.Lf2_223:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_225
+.Lf2_224:
+    movslq -16(%rbp), %rax
+.Lf2_225:
+    cmpq $0, %rax
+    jne .Lf2_220
+    jmp .Lf2_221
+.Lf2_220:
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_222
+.Lf2_221:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_226
+    jmp .Lf2_227
+.Lf2_226:
+    movq $55, %rax
+    jmp .Lf2_228
+.Lf2_227:
+    movq $71, %rax
+.Lf2_228:
+.Lf2_222:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_230
+    jmp .Lf2_229
+.Lf2_230:
+    movq $7, %rax
+    push %rax
+    movq $83, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_229:
+    movl %eax, -4(%rbp)
+    .loc 1 322 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_205:
+.Lf2_207:
+    .loc 1 318 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_206
+.Lf2_204:
+    addq $0, %rsp
+    .loc 1 325 13
+    movslq -340(%rbp), %rax
+    subq $40, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_232
+    jmp .Lf2_231
+.Lf2_232:
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_231:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_233
+    jmp .Lf2_234
+.Lf2_233:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_235
+.Lf2_234:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf2_235:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 326 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_192:
+.Lf2_194:
+    .loc 1 314 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_193
+.Lf2_191:
+    addq $8, %rsp
+    .loc 1 330 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 331 9
+    .p2align 4,,10
+.Lf2_238:
+    .loc 1 332 13
+    movq $8, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $1, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 333 13
+    movq $3, %rax
+    push %rax
+    cmpl $77, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movq $19, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 334 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_244
+    .p2align 4,,10
+.Lf2_243:
+    .loc 1 335 17
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_245
+    jmp .Lf2_246
+.Lf2_245:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_247
+.Lf2_246:
+    movslq -344(%rbp), %rax
+.Lf2_247:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_248
+    jmp .Lf2_249
+.Lf2_248:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf2_250
+.Lf2_249:
+    movslq -16(%rbp), %rax
+.Lf2_250:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_252
+    jmp .Lf2_251
+.Lf2_252:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_251:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 336 17
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $48, %rax
+    subq $89, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_254
+    jmp .Lf2_253
+.Lf2_254:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_253:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 337 17
+    movslq -76(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_256
+    jmp .Lf2_255
+.Lf2_256:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_255:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_258
+    jmp .Lf2_257
+.Lf2_258:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_257:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_242:
+    .loc 1 334 38
+    incl -344(%rbp)
+.Lf2_244:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_243
+.Lf2_241:
+    addq $0, %rsp
+    .loc 1 339 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_237:
+    .loc 1 340 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_238
+.Lf2_236:
+    addq $8, %rsp
+    .loc 1 342 5
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_260
+    jmp .Lf2_259
+.Lf2_260:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_259:
+    push %rax
+    cmpl $46, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_262
+    jmp .Lf2_261
+.Lf2_262:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_261:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_264
+    jmp .Lf2_263
+.Lf2_264:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_266
+    jmp .Lf2_265
+.Lf2_266:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_265:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_263:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 343 5
+    movq $99, %rax
+    cmpq $0, %rax
+    jne .Lf2_268
+    jmp .Lf2_269
+.Lf2_268:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_270
+.Lf2_269:
+    movslq -12(%rbp), %rax
+.Lf2_270:
+    push %rax
+    movq $36, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf2_271
+    .loc 1 344 9
+    movq $74, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_275
+    jmp .Lf2_276
+.Lf2_275:
+    movq $60, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_277
+.Lf2_276:
+    cmpl $45, -4(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf2_277:
+    cmpq $0, %rax
+    jne .Lf2_272
+    jmp .Lf2_273
+.Lf2_272:
+    movq $2, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_279
+    jmp .Lf2_278
+.Lf2_279:
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_278:
+    jmp .Lf2_274
+.Lf2_273:
+    movq $77, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_274:
+    movl %eax, -76(%rbp)
+    .loc 1 345 9
+    movq $6, %rax
+    push %rax
+    cmpl $39, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_281
+    jmp .Lf2_280
+.Lf2_281:
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_283
+    jmp .Lf2_282
+.Lf2_283:
+    movslq -8(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_282:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_280:
+    movl %eax, -4(%rbp)
+    .loc 1 346 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_288
+    jmp .Lf2_287
+.Lf2_288:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_287:
+    cmpq $0, %rax
+    jne .Lf2_284
+    jmp .Lf2_285
+.Lf2_284:
+    movslq -12(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_286
+.Lf2_285:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_286:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_290
+    jmp .Lf2_289
+.Lf2_290:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_292
+    jmp .Lf2_291
+.Lf2_292:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_291:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_289:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_267
+.Lf2_271:
+    .loc 1 348 9
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_294
+    jmp .Lf2_293
+.Lf2_294:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_293:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 349 9
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $79, %rax
+    subq $19, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_296
+    jmp .Lf2_295
+.Lf2_296:
+    movslq -44(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_295:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 350 9
+    movslq -16(%rbp), %rax
+    subq $78, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $40, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_267:
+    .loc 1 352 5
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $11, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_298
+    jmp .Lf2_297
+.Lf2_298:
+    movq $3, %rax
+    push %rax
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_300
+    jmp .Lf2_299
+.Lf2_300:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_299:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_297:
+    movl %eax, -16(%rbp)
+    .loc 1 353 5
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $26, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $36, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
@@ -0,0 +1,458 @@
+int f0() {
+    int v0 = 63;
+    int v1 = 3;
+    int v2 = 22;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a0[3] = (((a1[1][2] > v3) > (64 && v2)) / 9);
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a1[0][5] <= a1[3][12]) - (v2 * v2)) ? ((v2 >= a0[1]) || (64 == v0)) : ((v2 - i1) - (a0[0] || v1)));
+                v0 = (((v1 >= i0) * (a0[13] != a1[1][11])) + ((a1[2][4] || i0) >= (v2 + a0[0])));
+                a0[4] = (((v0 ? i1 : i1) != (a0[9] > v3)) * ((v0 % 7) % 8));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v2 = (((v1 < 70) || (v1 < 90)) % 1);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((45 % 5) > 99) break;
+        v3 = (((v1 ? a0[1] : v3) != (a0[2] >= i2)) * ((a0[2] - a0[10]) + (i2 && v2)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                a0[11] = (((v1 || v1) ? (86 && v1) : (v0 != 64)) || ((v2 >= 57) < (i3 * i3)));
+                a1[3][10] = (((a1[3][4] != a0[14]) || (i2 ? 78 : v1)) == ((v0 != 63) / 7));
+                v0 = (((a0[11] > 16) != (v1 != v2)) && ((v0 % 1) * (v3 < a1[0][0])));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((63 - v2) == (v1 <= 17)) <= ((19 && i2) < (v1 ? a0[4] : v3)));
+    }
+    if ((((89 < v1) <= (v3 / 4)) || ((v2 ? 10 : a0[1]) == (79 / 7)))) {
+        a1[0][0] = (((v3 * a0[1]) > (v2 * v3)) != ((22 == a1[2][12]) * (49 <= a1[2][10])));
+        v0 = (((a1[1][2] ? v0 : 88) + (a1[2][15] != 34)) <= ((a0[11] - 86) == (v3 > a1[0][3])));
+        v0 = (((78 <= v2) || (v0 == 3)) ? ((v2 + v3) || (a0[8] ? v1 : v1)) : ((v2 % 2) < (a1[2][15] == v2)));
+    } else {
+        v0 = (((25 ? v1 : a0[13]) && (v2 && 88)) - ((a0[14] - v0) || (a1[2][9] % 2)));
+        v2 = (((30 && v0) ? (a0[8] * v1) : (a1[2][11] && a0[0])) || ((a0[11] ? v0 : v2) ? (a0[9] / 5) : (v2 <= v1)));
+        a0[12] = (((v0 / 9) ? (a1[3][9] == v0) : (40 * 7)) - ((54 > v3) < (6 && 32)));
+    }
+    v0 = (((v3 >= a1[1][0]) <= (a1[1][1] ? a0[5] : a1[1][13])) || ((v2 > 65) != (11 % 3)));
+    if ((((a1[2][12] % 7) && (v0 <= v2)) - ((v1 != a0[13]) - (a1[1][9] && 36)))) {
+        a0[6] = (((v3 >= v2) - (v2 ? a0[1] : a0[11])) - ((v1 == v0) % 9));
+        a1[1][3] = (((42 - v0) % 3) * ((a1[1][3] <= 89) / 3));
+        v3 = (((a1[1][12] >= a1[1][11]) % 7) > ((a1[0][14] + 97) || (v3 % 2)));
+    } else {
+        v3 = (((a0[9] || a0[0]) != (v2 && a0[10])) > ((v0 * v3) >= (56 < a1[1][9])));
+        v1 = (((84 != a0[2]) + (v1 && 8)) || ((a0[4] < 0) != (a1[3][0] > a0[12])));
+        a0[12] = (((98 == v3) <= (v1 >= a1[2][7])) || ((v2 / 5) % 1));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v0 = (((v3 < v3) + (a1[3][6] || a1[3][10])) > ((51 >= 79) == (v0 <= v0)));
+        {
+            int i5 = 0;
+            while (i5 < 8) {
+                v0 = (((28 ? i4 : v3) * (v0 ? v2 : a1[1][14])) > ((v1 == 57) <= (44 < i4)));
+                v3 = (((64 != v1) ? (v0 ? v1 : a1[0][8]) : (v1 >= 1)) < ((i5 - i5) / 6));
+                v2 = (((a0[15] != a0[2]) == (i4 == a0[6])) == ((v1 < a0[7]) - (i5 == a0[2])));
+                i5 = i5 + 1;
+            }
+        }
+        a0[9] = (((v2 ? 93 : v1) ? (v3 <= 84) : (36 > i4)) && ((a1[0][5] - a1[0][2]) && (a1[3][5] ? a1[3][0] : a1[1][6])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            a0[3] = (((a1[1][2] ? a1[1][1] : a1[3][5]) || (v0 == v0)) < ((v3 + v0) - (49 <= 4)));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                a1[0][7] = (((68 % 5) <= (v3 % 4)) + ((v3 == a1[2][11]) >= (a0[13] == 59)));
+                a1[1][8] = (((i6 ? v0 : v3) && (32 + a0[1])) != ((81 == i6) || (v0 - v1)));
+                a1[1][4] = (((a0[4] * v1) - (a1[0][7] && v2)) || ((v0 != i7) - (80 || v0)));
+            }
+            a0[14] = (((v1 > v2) < (v3 < v3)) != ((69 || a1[1][13]) || (v2 >= v2)));
+            i6 = i6 + 1;
+        }
+    }
+    a0[4] = (((v3 > v2) > (v3 && v2)) % 8);
+    a0[14] = (((a1[0][1] > v2) == (a1[1][10] ? a0[8] : v3)) <= ((v0 / 9) / 8));
+    if ((((74 + v2) + (v2 >= a1[2][2])) && ((1 ? 14 : 72) ? (v1 ? a1[3][12] : a1[0][9]) : (v3 || v1)))) {
+        v2 = (((3 <= v1) <= (v3 * v2)) && ((v2 / 5) ? (a1[3][2] ? 26 : 66) : (a1[2][4] ? 69 : 56)));
+        a0[6] = (((v3 && 45) + (a1[2][9] >= 4)) || ((49 == v2) != (0 ? v1 : a0[3])));
+        v1 = (((v2 != a0[3]) / 9) < ((v3 == 86) % 4));
+    } else {
+        a1[1][7] = (((v3 / 1) > (v0 + v0)) < ((51 < v1) && (87 && v1)));
+        v0 = (((v1 ? a1[3][8] : 71) ? (70 == v1) : (v0 <= 28)) <= ((19 ? v1 : a0[15]) != (v0 % 7)));
+        a0[12] = (((a0[1] % 2) % 8) == ((59 / 3) * (2 >= v3)));
+    }
+    return (((58 ? 63 : v1) <= (v3 && a0[12])) < ((19 - v1) != (v3 ? 81 : a1[3][6])));
+}
+int f1() {
+    int v0 = 44;
+    int v1 = 95;
+    int v2 = 41;
+    int v3 = 5;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 % 2) >= (a1[0][2] % 6)) / 3)) {
+        v2 = (((v3 / 6) ? (a1[1][6] + v3) : (24 ? 23 : v1)) != ((v2 != a1[3][14]) % 1));
+        v2 = (((v2 < 77) > (v1 >= v3)) < ((v1 ? v2 : v1) % 3));
+        v0 = (((a1[0][6] / 4) ? (a0[5] + 54) : (v2 - v0)) * ((73 ? v0 : 85) + (v0 > a1[3][0])));
+    } else {
+        v0 = (((v1 / 2) <= (v2 == a0[3])) + ((a1[0][0] != v2) + (v2 % 4)));
+        v2 = (((a0[8] + a1[3][14]) % 5) > ((v0 && a1[0][12]) + (47 ? v1 : 8)));
+        v3 = (((v0 && a1[2][12]) != (v2 - v2)) < ((v0 * v2) && (v2 * a0[13])));
+    }
+    a0[7] = (((11 < 44) == (v2 && 0)) + ((a1[1][13] ? 64 : a1[1][12]) - (v0 != 99)));
+    a1[1][10] = (((97 || v2) % 6) % 7);
+    if ((((v0 != a0[5]) <= (v1 * 80)) % 5)) {
+        v0 = (((a0[8] || a0[7]) ? (a1[0][1] || a0[5]) : (69 % 2)) / 9);
+        v0 = (((53 ? 58 : v2) + (a1[1][11] ? a1[1][15] : 37)) * ((v3 * v3) > (11 || 54)));
+        v1 = (((v0 % 4) + (a1[3][4] && 9)) != ((91 ? a0[3] : v0) < (51 + v0)));
+    } else {
+        v2 = (((v0 <= v1) ? (v1 % 1) : (49 ? 67 : a0[9])) + ((v0 / 4) ? (a1[0][12] < v1) : (a1[0][8] == 36)));
+        v2 = (((v3 + 9) / 5) == ((39 || a0[6]) && (v3 ? 51 : 19)));
+        a0[9] = (((a1[2][15] / 9) < (v1 ? v3 : v3)) >= ((v1 < v3) * (a0[4] ? 74 : v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a1[1][0] * 20) * (i1 < v3)) + ((i0 - a1[0][4]) % 4));
+                    a1[2][3] = (((a0[9] && i1) ? (i0 != a1[0][5]) : (i0 - v3)) + ((v3 ? v3 : a1[2][12]) + (a0[15] < 41)));
+                    v3 = (((96 && 61) > (a1[2][10] ? 76 : a1[1][6])) || ((94 + v0) >= (a0[11] + 63)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v0 = (((23 || a1[1][6]) && (a1[3][10] <= v1)) ? ((v1 || 46) && (93 / 4)) : ((v2 / 7) > (a0[2] / 4)));
+            a0[15] = (((v0 / 2) > (v0 % 1)) > ((v3 % 9) <= (26 <= a1[1][0])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            a1[0][3] = (((a0[11] != 53) % 2) ? ((a0[12] < v0) < (v0 % 3)) : ((v3 && v3) / 9));
+            v0 = (((a0[12] * v3) == (58 != v1)) < ((a0[3] < 70) + (v1 != a1[0][12])));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((i3 >= i2) > 78) break;
+                    v1 = (((a0[7] == i3) % 8) <= ((v1 + 9) % 6));
+                    v0 = (((a0[12] >= a0[11]) > (60 * v2)) ? ((72 == v1) ? (a0[3] - 25) : (a0[14] >= v0)) : ((81 * 53) >= (v0 > v2)));
+                    v0 = (((51 ? a1[3][4] : 22) == (16 || 26)) != ((v2 * v3) < (a0[5] || i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                if ((a0[15] < v3) > 78) break;
+                a1[3][7] = (((v3 != a1[2][1]) <= (61 || a1[2][5])) + ((v1 == v0) < (38 < a1[2][3])));
+                v3 = (((v3 || 46) && (i4 && 50)) ? ((61 && v2) >= (v2 <= v0)) : ((v2 % 2) / 8));
+                v0 = (((i5 - v1) % 5) > ((i4 == 27) == (a1[1][3] ? a1[3][10] : 90)));
+            }
+            a1[2][12] = (((89 && a0[9]) ? (v3 ? v2 : 67) : (a0[3] - v2)) > ((a1[0][11] ? a1[0][5] : v1) < (i4 >= v2)));
+            v1 = (((a0[0] % 8) < (i4 - v2)) ? ((a1[3][10] && a0[4]) != (v0 < v1)) : ((i4 ? a1[2][15] : v0) && (v3 - 12)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            a0[14] = (((a0[5] ? 86 : v2) >= (i6 - v2)) * ((v1 / 9) != (10 > 73)));
+            {
+                int i7 = 0;
+                do {
+                    a0[14] = (((a1[1][13] != a0[15]) && (a0[8] >= i6)) + ((a0[5] && i7) > (36 + v0)));
+                    a0[13] = (((i6 + v2) ? (84 * i7) : (a1[2][8] % 5)) % 2);
+                    a1[3][12] = (((a0[13] * a1[1][14]) + (i7 + v0)) <= ((i6 > v0) / 4));
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            v1 = (((a0[14] && i6) >= (84 * v1)) && ((22 >= v3) < (a1[2][5] && v0)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        v0 = (((54 && v3) / 1) == ((v2 + v0) / 2));
+        a1[2][6] = (((88 ? a0[14] : v2) % 9) + ((v1 - v0) ? (3 - a0[14]) : (16 ? a1[0][15] : a1[3][5])));
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                if ((12 >= a0[2]) > 73) break;
+                a1[1][9] = (((i8 - a0[13]) || (v2 <= i9)) || ((v1 * i8) ? (i9 * v3) : (a0[0] >= 94)));
+                v1 = (((i9 + v3) < (v3 != 60)) ? ((v0 != i9) == (i8 % 3)) : ((18 != v2) ? (i8 <= a1[0][5]) : (i8 == 6)));
+                a0[11] = (((i8 <= 70) - (v1 && i8)) != ((i8 != v0) % 7));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    a0[0] = (((v1 && a0[15]) ? (a0[9] ? 49 : 69) : (v3 - v0)) != ((v0 >= v2) || (a0[14] < v0)));
+    return (((v3 * a1[1][13]) ? (v1 == 63) : (v0 < v2)) == ((a1[1][6] / 3) && (a0[12] - 22)));
+}
+int f2() {
+    int v0 = 79;
+    int v1 = 21;
+    int v2 = 66;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v2 + i0) * (a0[12] ? 10 : a0[6])) ? ((94 && v2) != (81 <= a1[3][12])) : ((a0[8] * v1) != (79 ? a0[15] : v2)));
+            v2 = (((v0 ? v0 : v0) / 4) ? ((v3 && v2) && (v2 ? i0 : a0[8])) : ((v0 / 5) != (a1[1][6] != a0[14])));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v0 = (((v2 ? 66 : v3) * (i1 > 53)) ? ((70 || 4) >= (30 && v3)) : ((a1[3][15] <= i1) == (65 == 3)));
+                    v1 = (((a1[1][13] < a0[10]) % 6) ? ((i0 % 6) == (a0[9] ? v1 : v0)) : ((i0 && a1[0][12]) || (22 <= v2)));
+                    a0[1] = (((v1 * 43) > (i1 || v0)) + ((v3 - v0) <= (i0 + a1[3][7])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v3 = (((a0[8] < a1[3][10]) > (9 / 2)) / 1);
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v1 = (((i3 >= v1) - (v0 == v1)) ? ((v1 ? a0[1] : 25) <= (v2 < v3)) : ((v2 - v0) >= (a0[11] <= v2)));
+                v1 = (((a0[2] * 97) || (19 < 21)) + ((54 + i2) > (a1[0][0] <= i2)));
+                v1 = (((v0 % 6) * (i2 == v0)) ? ((92 != v2) || (a0[7] - v3)) : ((61 * v2) != (a1[1][10] <= v2)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((66 / 4) ? (i2 == a0[6]) : (a0[3] == a0[8])) <= ((55 + v1) && (i2 + a1[0][12])));
+        v0 = (((i2 && a1[1][0]) != (a1[0][12] ? a0[10] : v0)) > ((v1 || a0[1]) != (a0[4] > v0)));
+    }
+    v1 = (((a1[3][11] && v3) != (v3 % 2)) || ((v1 % 2) || (v0 / 7)));
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a1[0][2] = (((v2 <= a0[11]) < (i4 <= 59)) + ((36 || 87) / 8));
+        v2 = (((v2 + 97) || (a1[3][12] >= 62)) >= ((82 ? a0[5] : 78) == (40 % 2)));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            if ((a1[3][11] / 2) > 61) break;
+            a0[9] = (((i5 ? a0[7] : v3) <= (32 || v1)) * ((47 <= v1) != (68 < a0[9])));
+            v0 = (((v1 >= v3) + (v2 == 58)) % 5);
+            a0[4] = (((37 / 8) + (a1[2][12] % 6)) - ((v2 - i4) ? (v3 && 3) : (i4 * i4)));
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((a1[2][8] * i6) ? (21 / 1) : (v3 != a1[3][11])) ? ((v0 ? v0 : v3) || (a0[11] / 9)) : ((a1[0][9] != v3) ? (v0 >= 57) : (v3 >= a1[3][7])));
+            v0 = (((v2 != i6) && (i6 >= a0[9])) ? ((v1 > a0[5]) > (v3 < 45)) : ((47 % 3) == (32 % 2)));
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((2 >= i7) ? (a0[12] ? a0[10] : v2) : (i6 == a0[6])) && ((4 + 73) ? (a0[7] || v0) : (i6 > v0)));
+                    v0 = (((v2 * a1[0][6]) + (28 || a1[1][14])) == ((85 - 82) / 7));
+                    a0[2] = (((i7 <= 5) ? (a1[2][10] % 4) : (71 >= v3)) && ((a0[6] && 58) && (a1[1][10] && v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((47 ? v1 : v3) > 74) break;
+            v1 = (((v3 >= 24) / 9) <= ((64 == a0[5]) >= (94 > 86)));
+            {
+                int i9 = 0;
+                do {
+                    if ((i8 + i8) > 83) break;
+                    v2 = (((a1[3][11] + a0[4]) % 8) < ((a1[3][3] > v1) <= (i9 <= a1[1][8])));
+                    v0 = (((a0[0] <= 68) + (v3 == 51)) ? ((a1[0][14] >= 50) || (v2 * i9)) : ((a0[6] ? v2 : 54) % 5));
+                    v3 = (((a1[0][2] % 5) || (v1 - a1[1][2])) ? ((v3 % 3) || (v3 != a1[0][7])) : ((96 ? 21 : v0) >= (a0[2] ? a1[0][14] : v3)));
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            a1[1][0] = (((v1 == v3) && (v0 != 3)) < ((60 ? v1 : v3) != (33 % 2)));
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 2) {
+            {
+                int i11 = 0;
+                do {
+                    v2 = (((i10 ? a0[7] : v1) / 6) ? ((i11 || v2) < (v2 && 77)) : ((a0[0] + 78) ? (v3 * v0) : (0 + v0)));
+                    v0 = (((v0 != v3) >= (v3 <= 2)) < ((a1[1][10] > v0) == (v3 <= 35)));
+                    a0[5] = (((i11 ? v2 : v1) / 9) >= ((v3 / 3) - (a0[14] != v2)));
+                    i11 = i11 + 1;
+                } while (i11 < 4);
+            }
+            v2 = (((v2 - v0) * (v0 && v3)) < ((8 == v2) || (66 < a0[8])));
+            v3 = (((46 || a1[0][8]) != (29 > i10)) >= ((a1[3][1] < a1[2][14]) == (i10 - v3)));
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 2; i12 = i12 + 1) {
+        if ((72 / 8) > 61) break;
+        a1[2][5] = (((v2 * v0) <= (a0[13] ? a1[0][2] : 3)) < ((v3 < v1) == (a1[3][11] && v1)));
+        {
+            int i13 = 0;
+            while (i13 < 7) {
+                a1[0][15] = (((v0 < v1) ? (i12 < a0[6]) : (90 ? i13 : v1)) != ((v3 < 93) + (v3 != v0)));
+                v2 = (((i12 && v2) / 6) ? ((v2 < v3) / 3) : ((v1 / 7) % 6));
+                a0[7] = (((a0[3] ? v0 : v0) > (i13 % 6)) && ((v2 ? 9 : v3) > (53 == v0)));
+                i13 = i13 + 1;
+            }
+        }
+        v1 = (((a0[11] != 8) && (v0 && v2)) || ((78 % 7) < (v2 % 9)));
+    }
+    for (int i14 = 0; i14 < 2; i14 = i14 + 1) {
+        {
+            int i15 = 0;
+            while (i15 < 8) {
+                a1[0][9] = (((a1[3][13] && a1[1][1]) ? (55 + v3) : (i14 != a1[2][11])) == ((51 ? a1[1][3] : i15) && (82 % 8)));
+                v1 = (((v1 * i15) != (v0 && v2)) ? ((67 && 38) ? (a0[11] % 4) : (v1 * v0)) : ((a0[0] ? v3 : i15) && (a0[5] * a0[4])));
+                v0 = (((13 >= v1) / 8) * ((a0[0] - 37) - (6 ? i15 : v2)));
+                i15 = i15 + 1;
+            }
+        }
+        v2 = (((v2 != v2) >= (v3 % 5)) - ((v0 || v0) <= (a0[12] == a1[3][8])));
+        a1[0][13] = (((v0 + a1[3][9]) != (i14 % 9)) * ((a0[8] && a0[3]) - (60 / 2)));
+    }
+    return (((v0 && a1[0][4]) > (1 * v3)) % 4);
+}
+int f3() {
+    int v0 = 48;
+    int v1 = 64;
+    int v2 = 20;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((i0 ? i0 : i0) > 76) break;
+        v0 = (((a0[1] ? v1 : v3) + (v2 && a1[0][10])) == ((i0 || a0[7]) / 4));
+        v2 = (((v2 && v0) && (v2 ? a1[2][6] : 2)) + ((52 || v2) == (i0 <= v2)));
+        {
+            int i1 = 0;
+            do {
+                a0[1] = (((i1 * i1) == (v3 >= a0[1])) * ((v0 + 49) * (i0 - i1)));
+                a0[7] = (((a1[1][5] / 9) ? (v2 + a1[2][10]) : (94 ? a1[2][0] : 18)) <= ((85 * v1) && (a0[9] >= i1)));
+                a0[4] = (((i0 < v2) >= (i0 >= i1)) * ((a0[5] ? v1 : 72) || (98 > 10)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v2 % 6) != (v3 && v0)) >= ((v0 + v1) ? (a1[2][0] > v0) : (a1[2][6] > v3)));
+            a0[2] = (((a0[5] - v3) == (v0 <= v1)) * ((a0[7] <= 62) > (a0[14] * 69)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v2 = (((a0[1] == v1) ? (i3 % 8) : (a0[4] != 15)) ? ((v1 ? a1[1][7] : i3) % 5) : ((v3 + v2) || (v1 ? i2 : 23)));
+                    a0[1] = (((a1[1][6] || i2) % 3) <= ((a1[1][8] && 10) % 5));
+                    v2 = (((71 != v0) + (v0 != a1[1][9])) <= ((v1 < i3) ? (2 ? v1 : a1[2][5]) : (v0 % 5)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        a0[11] = (((v3 - v0) / 4) || ((v1 - v0) < (49 && v2)));
+        a1[1][5] = (((66 || a1[0][3]) / 8) % 2);
+        {
+            int i5 = 0;
+            do {
+                a0[0] = (((a0[10] < 13) ? (v1 != 67) : (i5 != v3)) > ((v2 < 92) >= (4 + 85)));
+                a0[3] = (((i5 * a1[3][12]) < (a0[4] < i4)) + ((a0[10] < v2) % 3));
+                v3 = (((70 ? v0 : v1) != (v0 ? 73 : v0)) * ((i4 || 80) > (v0 / 3)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+    }
+    v2 = (((v2 == a0[14]) ? (v0 == v1) : (v2 ? v3 : a1[3][7])) == ((66 / 5) ? (v0 + 27) : (v0 + a1[0][7])));
+    {
+        int i6 = 0;
+        do {
+            a1[0][14] = (((87 == 50) - (v3 || v2)) == ((v1 ? a1[3][8] : v0) + (80 > 54)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    if ((v0 + v2) > 95) break;
+                    a0[2] = (((a0[0] > v0) >= (v3 <= 83)) != ((a1[1][14] == v3) != (i6 / 3)));
+                    a1[0][7] = (((v2 <= 99) - (70 || v0)) ? ((a0[2] < a0[9]) % 3) : ((96 % 8) || (v3 && v2)));
+                    v3 = (((v3 <= 14) * (a0[1] + a1[3][3])) < ((2 ? i7 : i6) || (72 + a1[0][7])));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((v1 ? 87 : v3) - (v3 % 6)) < ((v3 + v1) ? (90 - v1) : (v0 ? v1 : a0[3])));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            v2 = (((i8 * i8) >= (v2 ? 56 : i8)) ? ((v0 % 9) * (a0[8] == 89)) : ((a1[2][12] - 21) * (v2 < i8)));
+            v2 = (((i8 || a0[2]) > (v1 >= a1[1][3])) <= ((i8 ? 32 : v2) - (v1 >= v2)));
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((v2 <= i9) % 6) * ((a1[3][9] != 31) - (i8 < 58)));
+                    a1[2][5] = (((a1[0][12] <= v0) || (v0 - v1)) ? ((i8 && i8) < (a0[10] && i9)) : ((v1 != 74) == (4 > v1)));
+                    v1 = (((54 ? v1 : v1) % 1) ? ((97 < v3) * (a0[14] || a0[11])) : ((v3 < a1[1][13]) ? (v0 > 64) : (i8 || 2)));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    a0[10] = (((75 <= v3) == (10 && v3)) < ((a0[10] * a1[0][1]) <= (a1[1][3] < a1[3][12])));
+    v1 = (((a0[12] > a0[13]) % 9) ? ((v1 >= a1[3][1]) ? (v0 / 6) : (a1[2][12] != v0)) : ((v3 - v3) <= (a1[1][1] / 4)));
+    {
+        int i10 = 0;
+        while (i10 < 2) {
+            {
+                int i11 = 0;
+                do {
+                    v2 = (((v0 + 90) >= (7 != a1[3][10])) || ((i11 ? i10 : a1[2][13]) && (41 && i11)));
+                    a0[2] = (((a1[1][1] % 6) / 9) ? ((9 < v0) != (92 <= v2)) : ((19 <= a1[1][3]) - (a0[15] < a0[1])));
+                    v0 = (((v3 * v2) % 7) > ((i11 * 20) != (41 % 3)));
+                    i11 = i11 + 1;
+                } while (i11 < 3);
+            }
+            v2 = (((v2 ? v2 : a1[2][7]) == (v3 <= v1)) <= ((57 >= a0[4]) || (2 <= v1)));
+            v1 = (((v3 && a1[2][5]) >= (44 ? 7 : v2)) > ((v0 > v0) == (v0 || a0[11])));
+            i10 = i10 + 1;
+        }
+    }
+    if ((((v0 / 3) - (63 + v1)) / 1)) {
+        a0[11] = (((v1 && a0[12]) < (v2 || a0[3])) ? ((71 ? 85 : 29) <= (v3 >= v1)) : ((a1[1][2] >= a0[15]) ? (29 ? a0[6] : a0[1]) : (v3 * v3)));
+        v3 = (((20 != 40) != (v2 && v2)) >= ((89 + a1[2][3]) >= (a1[2][10] < 53)));
+        a0[12] = (((v2 % 8) ? (65 == 93) : (a0[4] || v3)) != ((v2 + 88) * (v3 < v1)));
+    } else {
+        a1[0][1] = (((v2 / 7) != (v0 - a0[6])) + ((a0[10] * v2) ? (80 + v3) : (v2 < v1)));
+        v1 = (((v1 ? v2 : v1) > (a1[3][15] <= 51)) * ((v1 == v1) % 3));
+        a1[2][14] = (((75 - 77) != (v2 ? v0 : v0)) > ((a1[0][4] > v1) - (v0 + a0[15])));
+    }
+    return (((a0[1] || v3) + (v1 ? 99 : v3)) && ((v1 + 82) == (51 ? v0 : v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
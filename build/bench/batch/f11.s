@@ -0,0 +1,9858 @@
+    .file 1 "build/bench/batch/f11.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 451 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 452 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 453 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 454 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 455 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 456 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 457 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $63, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $3, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $22, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $77, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_6
+    .p2align 4,,10
+.Lf0_5:
+    .loc 1 9 9
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 11 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 12 13
+    .p2align 4,,10
+.Lf0_11:
+    .loc 1 13 17
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_13
+.Lf0_12:
+    movslq -12(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_16
+    jmp .Lf0_15
+.Lf0_16:
+    movq $64, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_15:
+    jmp .Lf0_14
+.Lf0_13:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_18
+    jmp .Lf0_17
+.Lf0_18:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_17:
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_14:
+    movl %eax, -4(%rbp)
+    .loc 1 14 17
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_20
+    jmp .Lf0_19
+.Lf0_20:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_19:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 15 17
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_22
+.Lf0_21:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_23
+.Lf0_22:
+    movslq -344(%rbp), %rax
+.Lf0_23:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 16 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_10:
+    .loc 1 17 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_11
+.Lf0_9:
+    addq $0, %rsp
+    .loc 1 19 9
+    movq $1, %rax
+    push %rax
+    cmpl $70, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_25
+    jmp .Lf0_24
+.Lf0_25:
+    cmpl $90, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_24:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_4:
+    .loc 1 8 30
+    incl -340(%rbp)
+.Lf0_6:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_5
+.Lf0_3:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_31
+    .p2align 4,,10
+.Lf0_30:
+    .loc 1 22 9
+    movq $5, %rax
+    push %rax
+    movq $45, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_32
+    jmp .Lf0_28
+.Lf0_32:
+    .loc 1 23 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    push %rax
+    movslq -72(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_35
+    jmp .Lf0_36
+.Lf0_35:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_37
+.Lf0_36:
+    movslq -16(%rbp), %rax
+.Lf0_37:
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 25 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 26 13
+    jmp .Lf0_41
+    .p2align 4,,10
+.Lf0_40:
+    .loc 1 27 17
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_46
+    jmp .Lf0_45
+.Lf0_46:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_45:
+    cmpq $0, %rax
+    jne .Lf0_42
+    jmp .Lf0_43
+.Lf0_42:
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_48
+    jmp .Lf0_47
+.Lf0_48:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_47:
+    jmp .Lf0_44
+.Lf0_43:
+    cmpl $64, -4(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf0_44:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_50
+    jmp .Lf0_49
+.Lf0_50:
+    cmpl $57, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_49:
+    movl %eax, -36(%rbp)
+    .loc 1 28 17
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_52
+    jmp .Lf0_51
+.Lf0_52:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_53
+    jmp .Lf0_54
+.Lf0_53:
+    movq $78, %rax
+    jmp .Lf0_55
+.Lf0_54:
+    movslq -8(%rbp), %rax
+.Lf0_55:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_51:
+    push %rax
+    movq $7, %rax
+    push %rax
+    cmpl $63, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 29 17
+    cmpl $16, -36(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_57
+    jmp .Lf0_56
+.Lf0_57:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_56:
+    movl %eax, -4(%rbp)
+    .loc 1 30 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_39:
+.Lf0_41:
+    .loc 1 26 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_40
+.Lf0_38:
+    addq $0, %rsp
+    .loc 1 33 9
+    movq $63, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $17, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_58
+.Lf0_59:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_58:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_60
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -64(%rbp), %rax
+    jmp .Lf0_62
+.Lf0_61:
+    movslq -16(%rbp), %rax
+.Lf0_62:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_29:
+    .loc 1 21 30
+    incl -340(%rbp)
+.Lf0_31:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_30
+.Lf0_28:
+    addq $8, %rsp
+    .loc 1 35 5
+    movq $89, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_65
+    jmp .Lf0_64
+.Lf0_65:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_66
+    jmp .Lf0_67
+.Lf0_66:
+    movq $10, %rax
+    jmp .Lf0_68
+.Lf0_67:
+    movslq -76(%rbp), %rax
+.Lf0_68:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $79, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_64:
+    cmpq $0, %rax
+    je .Lf0_69
+    .loc 1 36 9
+    movslq -16(%rbp), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $49, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $22, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 37 9
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $34, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_70
+    jmp .Lf0_71
+.Lf0_70:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_72
+.Lf0_71:
+    movq $88, %rax
+.Lf0_72:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    subq $86, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 38 9
+    movq $78, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_77
+    jmp .Lf0_76
+.Lf0_77:
+    cmpl $3, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_76:
+    cmpq $0, %rax
+    jne .Lf0_73
+    jmp .Lf0_74
+.Lf0_73:
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_79
+    jmp .Lf0_78
+.Lf0_79:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_80
+    jmp .Lf0_81
+.Lf0_80:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_82
+.Lf0_81:
+    movslq -8(%rbp), %rax
+.Lf0_82:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_78:
+    jmp .Lf0_75
+.Lf0_74:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_75:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_63
+.Lf0_69:
+    .loc 1 40 9
+    movslq -24(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_84
+    jmp .Lf0_83
+.Lf0_84:
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_83:
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    jne .Lf0_85
+    jmp .Lf0_86
+.Lf0_85:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_87
+.Lf0_86:
+    movslq -28(%rbp), %rax
+.Lf0_87:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_88
+.Lf0_89:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_90
+.Lf0_91:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_90:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_88:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 41 9
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_96
+    jmp .Lf0_95
+.Lf0_96:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_95:
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_93
+.Lf0_92:
+    movslq -48(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_94
+.Lf0_93:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+.Lf0_94:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_100
+    jmp .Lf0_99
+.Lf0_100:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_104
+    jmp .Lf0_105
+.Lf0_104:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_106
+.Lf0_105:
+    movslq -12(%rbp), %rax
+.Lf0_106:
+    cmpq $0, %rax
+    jne .Lf0_101
+    jmp .Lf0_102
+.Lf0_101:
+    movq $5, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_103
+.Lf0_102:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_103:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_99:
+    movl %eax, -12(%rbp)
+    .loc 1 42 9
+    movq $54, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_108
+    jmp .Lf0_107
+.Lf0_108:
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_107:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_110
+.Lf0_109:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_111
+.Lf0_110:
+    movq $40, %rax
+    imulq $7, %rax
+    movslq %eax, %rax
+.Lf0_111:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf0_63:
+    .loc 1 44 5
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_112
+    jmp .Lf0_113
+.Lf0_112:
+    movslq -60(%rbp), %rax
+    jmp .Lf0_114
+.Lf0_113:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf0_114:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_116
+    jmp .Lf0_115
+.Lf0_116:
+    cmpl $65, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $11, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_115:
+    movl %eax, -4(%rbp)
+    .loc 1 45 5
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_118
+.Lf0_119:
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_118:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_120
+.Lf0_121:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_120:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_122
+    .loc 1 46 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_125
+.Lf0_124:
+    movslq -36(%rbp), %rax
+.Lf0_125:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 47 9
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $89, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $42, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 48 9
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $97, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_117
+.Lf0_122:
+    .loc 1 50 9
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_131
+    jmp .Lf0_130
+.Lf0_131:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_130:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $56, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 51 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_132
+.Lf0_133:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_132:
+    push %rax
+    movq $84, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_135
+    jmp .Lf0_134
+.Lf0_135:
+    cmpl $0, -64(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_134:
+    movl %eax, -8(%rbp)
+    .loc 1 52 9
+    movq $98, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_137
+    jmp .Lf0_136
+.Lf0_137:
+    movq $1, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_136:
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf0_117:
+    .loc 1 54 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_143
+    .p2align 4,,10
+.Lf0_142:
+    .loc 1 55 9
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $51, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 57 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 58 13
+    jmp .Lf0_149
+    .p2align 4,,10
+.Lf0_148:
+    .loc 1 59 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_152
+.Lf0_151:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf0_152:
+    push %rax
+    movq $28, %rax
+    cmpq $0, %rax
+    jne .Lf0_153
+    jmp .Lf0_154
+.Lf0_153:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_155
+.Lf0_154:
+    movslq -16(%rbp), %rax
+.Lf0_155:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $57, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $44, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 60 17
+    movq $64, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_156
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_159
+    jmp .Lf0_160
+.Lf0_159:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_161
+.Lf0_160:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf0_161:
+    jmp .Lf0_158
+.Lf0_157:
+    cmpl $1, -8(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_158:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 61 17
+    movslq -20(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 62 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_147:
+.Lf0_149:
+    .loc 1 58 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_148
+.Lf0_146:
+    addq $0, %rsp
+    .loc 1 65 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_165
+    jmp .Lf0_166
+.Lf0_165:
+    movq $93, %rax
+    jmp .Lf0_167
+.Lf0_166:
+    movslq -8(%rbp), %rax
+.Lf0_167:
+    cmpq $0, %rax
+    jne .Lf0_162
+    jmp .Lf0_163
+.Lf0_162:
+    cmpl $84, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_164
+.Lf0_163:
+    movq $36, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_164:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_169
+    jmp .Lf0_168
+.Lf0_169:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_171
+    jmp .Lf0_170
+.Lf0_171:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_172
+    jmp .Lf0_173
+.Lf0_172:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf0_174
+.Lf0_173:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_174:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_170:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_168:
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf0_141:
+    .loc 1 54 30
+    incl -340(%rbp)
+.Lf0_143:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_142
+.Lf0_140:
+    addq $8, %rsp
+    .loc 1 68 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 69 9
+    jmp .Lf0_178
+    .p2align 4,,10
+.Lf0_177:
+    .loc 1 70 13
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_180
+.Lf0_179:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf0_181
+.Lf0_180:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf0_181:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_183
+    jmp .Lf0_182
+.Lf0_183:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_182:
+    push %rax
+    movq $49, %rax
+    cmpq $4, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -68(%rbp)
+    .loc 1 71 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_189
+    .p2align 4,,10
+.Lf0_188:
+    .loc 1 72 17
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $59, -28(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $68, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 73 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_190
+    jmp .Lf0_191
+.Lf0_190:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_192
+.Lf0_191:
+    movslq -16(%rbp), %rax
+.Lf0_192:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_193
+.Lf0_194:
+    movq $32, %rax
+    addl -76(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_193:
+    push %rax
+    movq $81, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_196
+    jmp .Lf0_195
+.Lf0_196:
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_195:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 74 17
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_198
+    jmp .Lf0_197
+.Lf0_198:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_197:
+    push %rax
+    movslq -64(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_200
+    jmp .Lf0_199
+.Lf0_200:
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_202
+    jmp .Lf0_201
+.Lf0_202:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_201:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_199:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_187:
+    .loc 1 71 38
+    incl -344(%rbp)
+.Lf0_189:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_188
+.Lf0_186:
+    addq $0, %rsp
+    .loc 1 76 13
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $69, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_204
+    jmp .Lf0_203
+.Lf0_204:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_203:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_206
+    jmp .Lf0_205
+.Lf0_206:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_205:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -24(%rbp)
+    .loc 1 77 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_176:
+.Lf0_178:
+    .loc 1 69 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_177
+.Lf0_175:
+    addq $8, %rsp
+    .loc 1 80 5
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_208
+    jmp .Lf0_207
+.Lf0_208:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_207:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 81 5
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_210
+.Lf0_209:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_211
+.Lf0_210:
+    movslq -16(%rbp), %rax
+.Lf0_211:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -24(%rbp)
+    .loc 1 82 5
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $74, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    movq $1, %rax
+    cmpq $0, %rax
+    jne .Lf0_218
+    jmp .Lf0_219
+.Lf0_218:
+    movq $14, %rax
+    jmp .Lf0_220
+.Lf0_219:
+    movq $72, %rax
+.Lf0_220:
+    cmpq $0, %rax
+    jne .Lf0_215
+    jmp .Lf0_216
+.Lf0_215:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_221
+    jmp .Lf0_222
+.Lf0_221:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf0_223
+.Lf0_222:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf0_223:
+    jmp .Lf0_217
+.Lf0_216:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_225
+    jmp .Lf0_224
+.Lf0_225:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_224:
+.Lf0_217:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+    cmpq $0, %rax
+    je .Lf0_226
+    .loc 1 83 9
+    movq $3, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_228
+    jmp .Lf0_227
+.Lf0_228:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_229
+    jmp .Lf0_230
+.Lf0_229:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_233
+.Lf0_232:
+    movq $26, %rax
+    jmp .Lf0_234
+.Lf0_233:
+    movq $66, %rax
+.Lf0_234:
+    jmp .Lf0_231
+.Lf0_230:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_236
+.Lf0_235:
+    movq $69, %rax
+    jmp .Lf0_237
+.Lf0_236:
+    movq $56, %rax
+.Lf0_237:
+.Lf0_231:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_227:
+    movl %eax, -12(%rbp)
+    .loc 1 84 9
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $4, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_239
+    jmp .Lf0_238
+.Lf0_239:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_238:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_241
+    jmp .Lf0_240
+.Lf0_241:
+    movq $49, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $0, %rax
+    cmpq $0, %rax
+    jne .Lf0_242
+    jmp .Lf0_243
+.Lf0_242:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_244
+.Lf0_243:
+    movslq -68(%rbp), %rax
+.Lf0_244:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_240:
+    movl %eax, -56(%rbp)
+    .loc 1 85 9
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    cmpl $86, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_212
+.Lf0_226:
+    .loc 1 87 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $51, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_246
+    jmp .Lf0_245
+.Lf0_246:
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_248
+    jmp .Lf0_247
+.Lf0_248:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_247:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_245:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 88 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_252
+    jmp .Lf0_253
+.Lf0_252:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf0_254
+.Lf0_253:
+    movq $71, %rax
+.Lf0_254:
+    cmpq $0, %rax
+    jne .Lf0_249
+    jmp .Lf0_250
+.Lf0_249:
+    movq $70, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_251
+.Lf0_250:
+    cmpl $28, -4(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf0_251:
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf0_255
+    jmp .Lf0_256
+.Lf0_255:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_257
+.Lf0_256:
+    movslq -20(%rbp), %rax
+.Lf0_257:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 89 9
+    movq $8, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $59, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf0_212:
+    .loc 1 91 5
+    movq $58, %rax
+    cmpq $0, %rax
+    jne .Lf0_258
+    jmp .Lf0_259
+.Lf0_258:
+    movq $63, %rax
+    jmp .Lf0_260
+.Lf0_259:
+    movslq -8(%rbp), %rax
+.Lf0_260:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_262
+    jmp .Lf0_261
+.Lf0_262:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_261:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $19, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_263
+    jmp .Lf0_264
+.Lf0_263:
+    movq $81, %rax
+    jmp .Lf0_265
+.Lf0_264:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_265:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 93 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 94 5
+    subq $8, %rsp
+    movq $44, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 95 5
+    movq $95, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 96 5
+    subq $8, %rsp
+    movq $41, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 97 5
+    movq $5, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 98 5
+    subq $64, %rsp
+    .loc 1 99 5
+    subq $256, %rsp
+    .loc 1 100 5
+    movq $3, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_2
+    .loc 1 101 9
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_3
+    jmp .Lf1_4
+.Lf1_3:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_5
+.Lf1_4:
+    movq $24, %rax
+    cmpq $0, %rax
+    jne .Lf1_6
+    jmp .Lf1_7
+.Lf1_6:
+    movq $23, %rax
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -8(%rbp), %rax
+.Lf1_8:
+.Lf1_5:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 102 9
+    cmpl $77, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_9
+    jmp .Lf1_10
+.Lf1_9:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_11
+.Lf1_10:
+    movslq -8(%rbp), %rax
+.Lf1_11:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 103 9
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf1_12
+    jmp .Lf1_13
+.Lf1_12:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_14
+.Lf1_13:
+    movq $85, %rax
+.Lf1_14:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_15
+    jmp .Lf1_16
+.Lf1_15:
+    movslq -60(%rbp), %rax
+    addq $54, %rax
+    movslq %eax, %rax
+    jmp .Lf1_17
+.Lf1_16:
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_17:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_1
+.Lf1_2:
+    .loc 1 105 9
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 106 9
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $47, %rax
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_19
+.Lf1_18:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_20
+.Lf1_19:
+    movq $8, %rax
+.Lf1_20:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_21
+.Lf1_22:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_21:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 107 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_24
+    jmp .Lf1_23
+.Lf1_24:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_23:
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_26
+    jmp .Lf1_25
+.Lf1_26:
+    movslq -12(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_25:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_1:
+    .loc 1 109 5
+    cmpl $99, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_27
+    jmp .Lf1_28
+.Lf1_27:
+    movq $64, %rax
+    jmp .Lf1_29
+.Lf1_28:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf1_29:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_31
+    jmp .Lf1_30
+.Lf1_31:
+    movq $0, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_30:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 110 5
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_33
+    jmp .Lf1_32
+.Lf1_33:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_32:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 111 5
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $80, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_35
+    .loc 1 112 9
+    movq $9, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_40
+    jmp .Lf1_39
+.Lf1_40:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_39:
+    cmpq $0, %rax
+    jne .Lf1_36
+    jmp .Lf1_37
+.Lf1_36:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_42
+    jmp .Lf1_41
+.Lf1_42:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_41:
+    jmp .Lf1_38
+.Lf1_37:
+    movq $2, %rax
+    push %rax
+    movq $69, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_38:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 113 9
+    movslq -16(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_44
+    jmp .Lf1_43
+.Lf1_44:
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_43:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_45
+    jmp .Lf1_46
+.Lf1_45:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf1_47
+.Lf1_46:
+    movq $37, %rax
+.Lf1_47:
+    push %rax
+    movq $53, %rax
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_49
+.Lf1_48:
+    movq $58, %rax
+    jmp .Lf1_50
+.Lf1_49:
+    movslq -12(%rbp), %rax
+.Lf1_50:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 114 9
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_51
+.Lf1_52:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_51:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    cmpq $0, %rax
+    jne .Lf1_53
+    jmp .Lf1_54
+.Lf1_53:
+    movslq -68(%rbp), %rax
+    jmp .Lf1_55
+.Lf1_54:
+    movslq -4(%rbp), %rax
+.Lf1_55:
+    push %rax
+    movq $51, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_34
+.Lf1_35:
+    .loc 1 116 9
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_57
+.Lf1_56:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_58
+.Lf1_57:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $36, %rax
+    movq $0, %rax
+    sete %al
+.Lf1_58:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_59
+    jmp .Lf1_60
+.Lf1_59:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_61
+.Lf1_60:
+    movq $49, %rax
+    cmpq $0, %rax
+    jne .Lf1_62
+    jmp .Lf1_63
+.Lf1_62:
+    movq $67, %rax
+    jmp .Lf1_64
+.Lf1_63:
+    movslq -44(%rbp), %rax
+.Lf1_64:
+.Lf1_61:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 117 9
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $9, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_66
+    jmp .Lf1_65
+.Lf1_66:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_65:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_68
+    jmp .Lf1_67
+.Lf1_68:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_69
+    jmp .Lf1_70
+.Lf1_69:
+    movq $51, %rax
+    jmp .Lf1_71
+.Lf1_70:
+    movq $19, %rax
+.Lf1_71:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_67:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 118 9
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_72
+    jmp .Lf1_73
+.Lf1_72:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -16(%rbp), %rax
+.Lf1_74:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_75
+    jmp .Lf1_76
+.Lf1_75:
+    movq $74, %rax
+    jmp .Lf1_77
+.Lf1_76:
+    movslq -12(%rbp), %rax
+.Lf1_77:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf1_34:
+    .loc 1 121 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 122 9
+    jmp .Lf1_81
+    .p2align 4,,10
+.Lf1_80:
+    .loc 1 124 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 125 17
+    .p2align 4,,10
+.Lf1_84:
+    .loc 1 126 21
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    imulq $20, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 127 21
+    cmpl $41, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_85
+    jmp .Lf1_86
+.Lf1_85:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_87
+.Lf1_86:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf1_87:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_92
+    jmp .Lf1_91
+.Lf1_92:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_91:
+    cmpq $0, %rax
+    jne .Lf1_88
+    jmp .Lf1_89
+.Lf1_88:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_90
+.Lf1_89:
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_90:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 128 21
+    movq $96, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_94
+    jmp .Lf1_93
+.Lf1_94:
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_93:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_95
+    jmp .Lf1_96
+.Lf1_95:
+    movq $76, %rax
+    jmp .Lf1_97
+.Lf1_96:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf1_97:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_99
+    jmp .Lf1_98
+.Lf1_99:
+    movq $94, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    addq $63, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_98:
+    movl %eax, -16(%rbp)
+    .loc 1 129 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_83:
+    .loc 1 130 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_84
+.Lf1_82:
+    addq $0, %rsp
+    .loc 1 132 13
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_104
+    jmp .Lf1_103
+.Lf1_104:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_103:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_106
+    jmp .Lf1_105
+.Lf1_106:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_105:
+    cmpq $0, %rax
+    jne .Lf1_100
+    jmp .Lf1_101
+.Lf1_100:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_108
+    jmp .Lf1_107
+.Lf1_108:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_107:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_109
+.Lf1_110:
+    movq $4, %rax
+    push %rax
+    movq $93, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_109:
+    jmp .Lf1_102
+.Lf1_101:
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_102:
+    movl %eax, -4(%rbp)
+    .loc 1 133 13
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $26, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -20(%rbp)
+    .loc 1 134 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_79:
+.Lf1_81:
+    .loc 1 122 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_80
+.Lf1_78:
+    addq $8, %rsp
+    .loc 1 138 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 139 9
+    jmp .Lf1_114
+    .p2align 4,,10
+.Lf1_113:
+    .loc 1 140 13
+    movq $2, %rax
+    push %rax
+    cmpl $53, -36(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_115
+    jmp .Lf1_116
+.Lf1_115:
+    movslq -32(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_117
+.Lf1_116:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_119
+    jmp .Lf1_118
+.Lf1_119:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_118:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_117:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 141 13
+    movslq -32(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $58, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $70, -68(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 143 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 144 17
+    jmp .Lf1_123
+    .p2align 4,,10
+.Lf1_122:
+    .loc 1 145 21
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $78, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_124
+    jmp .Lf1_120
+.Lf1_124:
+    .loc 1 146 21
+    movq $8, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $9, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 147 21
+    movslq -32(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $60, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_125
+    jmp .Lf1_126
+.Lf1_125:
+    movq $72, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_128
+    jmp .Lf1_129
+.Lf1_128:
+    movslq -68(%rbp), %rax
+    subq $25, %rax
+    movslq %eax, %rax
+    jmp .Lf1_130
+.Lf1_129:
+    movslq -24(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_130:
+    jmp .Lf1_127
+.Lf1_126:
+    movq $81, %rax
+    imulq $53, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_127:
+    movl %eax, -4(%rbp)
+    .loc 1 148 21
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf1_131
+    jmp .Lf1_132
+.Lf1_131:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf1_133
+.Lf1_132:
+    movq $22, %rax
+.Lf1_133:
+    push %rax
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_135
+    jmp .Lf1_134
+.Lf1_135:
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_134:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_137
+    jmp .Lf1_136
+.Lf1_137:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_136:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 149 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_121:
+.Lf1_123:
+    .loc 1 144 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_122
+.Lf1_120:
+    addq $0, %rsp
+    .loc 1 152 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_112:
+.Lf1_114:
+    .loc 1 139 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_113
+.Lf1_111:
+    addq $8, %rsp
+    .loc 1 156 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 157 9
+    jmp .Lf1_141
+    .p2align 4,,10
+.Lf1_140:
+    .loc 1 158 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_147
+    .p2align 4,,10
+.Lf1_146:
+    .loc 1 159 17
+    movslq -20(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $78, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_148
+    jmp .Lf1_144
+.Lf1_148:
+    .loc 1 160 17
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $38, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_150
+    jmp .Lf1_149
+.Lf1_150:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_149:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 161 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_157
+    jmp .Lf1_156
+.Lf1_157:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_159
+    jmp .Lf1_158
+.Lf1_159:
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_158:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_156:
+    cmpq $0, %rax
+    jne .Lf1_151
+    jmp .Lf1_152
+.Lf1_151:
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_161
+    jmp .Lf1_160
+.Lf1_161:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_160:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_153
+.Lf1_152:
+    movq $8, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_153:
+    movl %eax, -16(%rbp)
+    .loc 1 162 17
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $27, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_163
+.Lf1_162:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf1_164
+.Lf1_163:
+    movq $90, %rax
+.Lf1_164:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_145:
+    .loc 1 158 38
+    incl -344(%rbp)
+.Lf1_147:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_146
+.Lf1_144:
+    addq $0, %rsp
+    .loc 1 164 13
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_169
+    jmp .Lf1_168
+.Lf1_169:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_168:
+    cmpq $0, %rax
+    jne .Lf1_165
+    jmp .Lf1_166
+.Lf1_165:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_170
+    jmp .Lf1_171
+.Lf1_170:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_172
+.Lf1_171:
+    movq $67, %rax
+.Lf1_172:
+    jmp .Lf1_167
+.Lf1_166:
+    movslq -68(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_167:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_173
+    jmp .Lf1_174
+.Lf1_173:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf1_175
+.Lf1_174:
+    movslq -8(%rbp), %rax
+.Lf1_175:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 165 13
+    movq $8, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_176
+    jmp .Lf1_177
+.Lf1_176:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_180
+    jmp .Lf1_179
+.Lf1_180:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_179:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_178
+.Lf1_177:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_181
+    jmp .Lf1_182
+.Lf1_181:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf1_183
+.Lf1_182:
+    movslq -4(%rbp), %rax
+.Lf1_183:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_185
+    jmp .Lf1_184
+.Lf1_185:
+    movslq -16(%rbp), %rax
+    subq $12, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_184:
+.Lf1_178:
+    movl %eax, -8(%rbp)
+    .loc 1 166 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_139:
+.Lf1_141:
+    .loc 1 157 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_140
+.Lf1_138:
+    addq $8, %rsp
+    .loc 1 170 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 171 9
+    jmp .Lf1_189
+    .p2align 4,,10
+.Lf1_188:
+    .loc 1 172 13
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $10, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_190
+    jmp .Lf1_191
+.Lf1_190:
+    movq $86, %rax
+    jmp .Lf1_192
+.Lf1_191:
+    movslq -12(%rbp), %rax
+.Lf1_192:
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 174 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 175 17
+    .p2align 4,,10
+.Lf1_195:
+    .loc 1 176 21
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_197
+    jmp .Lf1_196
+.Lf1_197:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_196:
+    push %rax
+    movq $36, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_199
+    jmp .Lf1_198
+.Lf1_199:
+    movslq -48(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_198:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 177 21
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_200
+    jmp .Lf1_201
+.Lf1_200:
+    movq $84, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_202
+.Lf1_201:
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_202:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    .loc 1 178 21
+    movslq -344(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 179 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_194:
+    .loc 1 180 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_195
+.Lf1_193:
+    addq $0, %rsp
+    .loc 1 182 13
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_204
+    jmp .Lf1_203
+.Lf1_204:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_203:
+    push %rax
+    movq $84, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_206
+    jmp .Lf1_205
+.Lf1_206:
+    movq $22, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_208
+    jmp .Lf1_207
+.Lf1_208:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_207:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_205:
+    movl %eax, -8(%rbp)
+    .loc 1 183 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_187:
+.Lf1_189:
+    .loc 1 171 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_188
+.Lf1_186:
+    addq $8, %rsp
+    .loc 1 186 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_214
+    .p2align 4,,10
+.Lf1_213:
+    .loc 1 187 9
+    movq $1, %rax
+    push %rax
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_215
+.Lf1_216:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_215:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 188 9
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_217
+    jmp .Lf1_218
+.Lf1_217:
+    movq $3, %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_219
+.Lf1_218:
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf1_220
+    jmp .Lf1_221
+.Lf1_220:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf1_222
+.Lf1_221:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf1_222:
+.Lf1_219:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    jne .Lf1_223
+    jmp .Lf1_224
+.Lf1_223:
+    movslq -24(%rbp), %rax
+    jmp .Lf1_225
+.Lf1_224:
+    movslq -12(%rbp), %rax
+.Lf1_225:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 190 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 191 13
+    jmp .Lf1_229
+    .p2align 4,,10
+.Lf1_228:
+    .loc 1 192 17
+    movq $12, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_230
+    jmp .Lf1_226
+.Lf1_230:
+    .loc 1 193 17
+    movslq -340(%rbp), %rax
+    subl -28(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_232
+    jmp .Lf1_231
+.Lf1_232:
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_231:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_234
+    jmp .Lf1_233
+.Lf1_234:
+    movslq -8(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_235
+    jmp .Lf1_236
+.Lf1_235:
+    movslq -344(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_237
+.Lf1_236:
+    cmpl $94, -80(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf1_237:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_233:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 194 17
+    movslq -344(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $60, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_238
+    jmp .Lf1_239
+.Lf1_238:
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_240
+.Lf1_239:
+    movq $18, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_241
+    jmp .Lf1_242
+.Lf1_241:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_243
+.Lf1_242:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_243:
+.Lf1_240:
+    movl %eax, -8(%rbp)
+    .loc 1 195 17
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_245
+    jmp .Lf1_244
+.Lf1_245:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_244:
+    push %rax
+    cmpl $70, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -36(%rbp)
+    .loc 1 196 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_227:
+.Lf1_229:
+    .loc 1 191 20
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_228
+.Lf1_226:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_212:
+    .loc 1 186 30
+    incl -340(%rbp)
+.Lf1_214:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_213
+.Lf1_211:
+    addq $8, %rsp
+    .loc 1 200 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_250
+    jmp .Lf1_249
+.Lf1_250:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_249:
+    cmpq $0, %rax
+    jne .Lf1_246
+    jmp .Lf1_247
+.Lf1_246:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_251
+    jmp .Lf1_252
+.Lf1_251:
+    movq $49, %rax
+    jmp .Lf1_253
+.Lf1_252:
+    movq $69, %rax
+.Lf1_253:
+    jmp .Lf1_248
+.Lf1_247:
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_248:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_255
+    jmp .Lf1_254
+.Lf1_255:
+    movslq -24(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_254:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -80(%rbp)
+    .loc 1 201 5
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_256
+    jmp .Lf1_257
+.Lf1_256:
+    cmpl $63, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_258
+.Lf1_257:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_258:
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_260
+    jmp .Lf1_259
+.Lf1_260:
+    movslq -32(%rbp), %rax
+    subq $22, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_259:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 203 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 204 5
+    subq $8, %rsp
+    movq $79, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 205 5
+    movq $21, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 206 5
+    subq $8, %rsp
+    movq $66, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 207 5
+    movq $84, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 208 5
+    subq $64, %rsp
+    .loc 1 209 5
+    subq $256, %rsp
+    .loc 1 211 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 212 9
+    .p2align 4,,10
+.Lf2_3:
+    .loc 1 213 13
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_7
+    jmp .Lf2_8
+.Lf2_7:
+    movq $10, %rax
+    jmp .Lf2_9
+.Lf2_8:
+    movslq -56(%rbp), %rax
+.Lf2_9:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_4
+    jmp .Lf2_5
+.Lf2_4:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_11
+    jmp .Lf2_10
+.Lf2_11:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_10:
+    push %rax
+    movq $81, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_6
+.Lf2_5:
+    movslq -48(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    cmpq $0, %rax
+    jne .Lf2_12
+    jmp .Lf2_13
+.Lf2_12:
+    movslq -20(%rbp), %rax
+    jmp .Lf2_14
+.Lf2_13:
+    movslq -12(%rbp), %rax
+.Lf2_14:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_6:
+    movl %eax, -12(%rbp)
+    .loc 1 214 13
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_18
+    jmp .Lf2_19
+.Lf2_18:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_20
+.Lf2_19:
+    movslq -4(%rbp), %rax
+.Lf2_20:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_15
+    jmp .Lf2_16
+.Lf2_15:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_22
+    jmp .Lf2_21
+.Lf2_22:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_21:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_24
+    jmp .Lf2_23
+.Lf2_24:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_25
+    jmp .Lf2_26
+.Lf2_25:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_27
+.Lf2_26:
+    movslq -48(%rbp), %rax
+.Lf2_27:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_23:
+    jmp .Lf2_17
+.Lf2_16:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_17:
+    movl %eax, -12(%rbp)
+    .loc 1 216 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 217 17
+    jmp .Lf2_31
+    .p2align 4,,10
+.Lf2_30:
+    .loc 1 218 21
+    cmpl $53, -344(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_35
+    jmp .Lf2_36
+.Lf2_35:
+    movq $66, %rax
+    jmp .Lf2_37
+.Lf2_36:
+    movslq -16(%rbp), %rax
+.Lf2_37:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_32
+    jmp .Lf2_33
+.Lf2_32:
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_39
+    jmp .Lf2_38
+.Lf2_39:
+    movq $4, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_38:
+    push %rax
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_41
+    jmp .Lf2_40
+.Lf2_41:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_40:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_34
+.Lf2_33:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $65, %rax
+    cmpq $3, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_34:
+    movl %eax, -4(%rbp)
+    .loc 1 219 21
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_42
+    jmp .Lf2_43
+.Lf2_42:
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_45
+    jmp .Lf2_46
+.Lf2_45:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_47
+.Lf2_46:
+    movslq -4(%rbp), %rax
+.Lf2_47:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_44
+.Lf2_43:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_49
+    jmp .Lf2_48
+.Lf2_49:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_48:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_51
+    jmp .Lf2_50
+.Lf2_51:
+    movq $22, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_50:
+.Lf2_44:
+    movl %eax, -8(%rbp)
+    .loc 1 220 21
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $43, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_53
+    jmp .Lf2_52
+.Lf2_53:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_52:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 221 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_29:
+.Lf2_31:
+    .loc 1 217 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_30
+.Lf2_28:
+    addq $0, %rsp
+    .loc 1 224 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_2:
+    .loc 1 225 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_3
+.Lf2_1:
+    addq $8, %rsp
+    .loc 1 227 5
+    movq $1, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $9, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 228 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_59
+    .p2align 4,,10
+.Lf2_58:
+    .loc 1 230 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 231 13
+    jmp .Lf2_63
+    .p2align 4,,10
+.Lf2_62:
+    .loc 1 232 17
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_64
+    jmp .Lf2_65
+.Lf2_64:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_67
+    jmp .Lf2_68
+.Lf2_67:
+    movslq -76(%rbp), %rax
+    jmp .Lf2_69
+.Lf2_68:
+    movq $25, %rax
+.Lf2_69:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_66
+.Lf2_65:
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_66:
+    movl %eax, -8(%rbp)
+    .loc 1 233 17
+    movq $54, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -72(%rbp), %rax
+    imulq $97, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_71
+    jmp .Lf2_70
+.Lf2_71:
+    movq $19, %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_70:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 234 17
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_72
+    jmp .Lf2_73
+.Lf2_72:
+    movq $92, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_76
+    jmp .Lf2_75
+.Lf2_76:
+    movslq -52(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_75:
+    jmp .Lf2_74
+.Lf2_73:
+    movq $61, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_74:
+    movl %eax, -8(%rbp)
+    .loc 1 235 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_61:
+.Lf2_63:
+    .loc 1 231 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_62
+.Lf2_60:
+    addq $0, %rsp
+    .loc 1 238 9
+    movq $4, %rax
+    push %rax
+    movq $66, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_77
+    jmp .Lf2_78
+.Lf2_77:
+    movslq -340(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_79
+.Lf2_78:
+    movslq -68(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf2_79:
+    push %rax
+    movq $55, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_80
+.Lf2_81:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_80:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 239 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_83
+    jmp .Lf2_82
+.Lf2_83:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_82:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_84
+    jmp .Lf2_85
+.Lf2_84:
+    movslq -40(%rbp), %rax
+    jmp .Lf2_86
+.Lf2_85:
+    movslq -4(%rbp), %rax
+.Lf2_86:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_88
+    jmp .Lf2_87
+.Lf2_88:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_87:
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_57:
+    .loc 1 228 30
+    incl -340(%rbp)
+.Lf2_59:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_58
+.Lf2_56:
+    addq $8, %rsp
+    .loc 1 241 5
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_90
+    jmp .Lf2_89
+.Lf2_90:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_89:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_92
+    jmp .Lf2_91
+.Lf2_92:
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_94
+    jmp .Lf2_93
+.Lf2_94:
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_93:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_91:
+    movl %eax, -8(%rbp)
+    .loc 1 242 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_100
+    .p2align 4,,10
+.Lf2_99:
+    .loc 1 243 9
+    movq $8, %rax
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_102
+    jmp .Lf2_101
+.Lf2_102:
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_101:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $59, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 244 9
+    movslq -12(%rbp), %rax
+    addq $97, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_104
+    jmp .Lf2_103
+.Lf2_104:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $62, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_103:
+    push %rax
+    movq $82, %rax
+    cmpq $0, %rax
+    jne .Lf2_105
+    jmp .Lf2_106
+.Lf2_105:
+    movslq -60(%rbp), %rax
+    jmp .Lf2_107
+.Lf2_106:
+    movq $78, %rax
+.Lf2_107:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $40, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 245 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_113
+    .p2align 4,,10
+.Lf2_112:
+    .loc 1 246 13
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $61, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_114
+    jmp .Lf2_110
+.Lf2_114:
+    .loc 1 247 13
+    movq $47, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $68, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_115
+    jmp .Lf2_116
+.Lf2_115:
+    movslq -52(%rbp), %rax
+    jmp .Lf2_117
+.Lf2_116:
+    movslq -16(%rbp), %rax
+.Lf2_117:
+    push %rax
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_119
+    jmp .Lf2_118
+.Lf2_119:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_118:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 248 13
+    movq $5, %rax
+    push %rax
+    cmpl $58, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 249 13
+    movslq -12(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_120
+    jmp .Lf2_121
+.Lf2_120:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_124
+    jmp .Lf2_123
+.Lf2_124:
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_123:
+    jmp .Lf2_122
+.Lf2_121:
+    movslq -340(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_122:
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $37, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    addq $0, %rsp
+.Lf2_111:
+    .loc 1 245 34
+    incl -344(%rbp)
+.Lf2_113:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_112
+.Lf2_110:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_98:
+    .loc 1 242 30
+    incl -340(%rbp)
+.Lf2_100:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_99
+.Lf2_97:
+    addq $8, %rsp
+    .loc 1 253 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 254 9
+    .p2align 4,,10
+.Lf2_127:
+    .loc 1 255 13
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_131
+    jmp .Lf2_132
+.Lf2_131:
+    movq $1, %rax
+    push %rax
+    movq $21, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_133
+.Lf2_132:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_133:
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_129
+.Lf2_128:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_134
+    jmp .Lf2_135
+.Lf2_134:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_136
+.Lf2_135:
+    movslq -16(%rbp), %rax
+.Lf2_136:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_138
+    jmp .Lf2_137
+.Lf2_138:
+    movq $9, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_137:
+    jmp .Lf2_130
+.Lf2_129:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_139
+    jmp .Lf2_140
+.Lf2_139:
+    cmpl $57, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_141
+.Lf2_140:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_141:
+.Lf2_130:
+    movl %eax, -8(%rbp)
+    .loc 1 256 13
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_146
+    jmp .Lf2_145
+.Lf2_146:
+    movslq -340(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_145:
+    cmpq $0, %rax
+    jne .Lf2_142
+    jmp .Lf2_143
+.Lf2_142:
+    movslq -8(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $45, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_144
+.Lf2_143:
+    movq $3, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $32, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_144:
+    movl %eax, -4(%rbp)
+    .loc 1 258 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 259 17
+    .p2align 4,,10
+.Lf2_149:
+    .loc 1 260 21
+    movq $2, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_150
+    jmp .Lf2_151
+.Lf2_150:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_153
+    jmp .Lf2_154
+.Lf2_153:
+    movslq -40(%rbp), %rax
+    jmp .Lf2_155
+.Lf2_154:
+    movslq -12(%rbp), %rax
+.Lf2_155:
+    jmp .Lf2_152
+.Lf2_151:
+    movslq -340(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf2_152:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_157
+    jmp .Lf2_156
+.Lf2_157:
+    movq $4, %rax
+    addq $73, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_158
+    jmp .Lf2_159
+.Lf2_158:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_162
+    jmp .Lf2_161
+.Lf2_162:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_161:
+    jmp .Lf2_160
+.Lf2_159:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_160:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_156:
+    movl %eax, -4(%rbp)
+    .loc 1 261 21
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_164
+    jmp .Lf2_163
+.Lf2_164:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_163:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $85, %rax
+    subq $82, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 262 21
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_165
+    jmp .Lf2_166
+.Lf2_165:
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_167
+.Lf2_166:
+    movq $71, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_167:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_169
+    jmp .Lf2_168
+.Lf2_169:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_171
+    jmp .Lf2_170
+.Lf2_171:
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_170:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_173
+    jmp .Lf2_172
+.Lf2_173:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_175
+    jmp .Lf2_174
+.Lf2_175:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_174:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_172:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_168:
+    movl %eax, -72(%rbp)
+    .loc 1 263 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_148:
+    .loc 1 264 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_149
+.Lf2_147:
+    addq $0, %rsp
+    .loc 1 266 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_126:
+    .loc 1 267 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_127
+.Lf2_125:
+    addq $8, %rsp
+    .loc 1 270 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 271 9
+    .p2align 4,,10
+.Lf2_178:
+    .loc 1 272 13
+    movq $47, %rax
+    cmpq $0, %rax
+    jne .Lf2_180
+    jmp .Lf2_181
+.Lf2_180:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_182
+.Lf2_181:
+    movslq -16(%rbp), %rax
+.Lf2_182:
+    cmpq $74, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_179
+    jmp .Lf2_176
+.Lf2_179:
+    .loc 1 273 13
+    movq $9, %rax
+    push %rax
+    cmpl $24, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $64, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $94, %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 275 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 276 17
+    .p2align 4,,10
+.Lf2_185:
+    .loc 1 277 21
+    movslq -340(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $83, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_186
+    jmp .Lf2_183
+.Lf2_186:
+    .loc 1 278 21
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    addl -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 279 21
+    cmpl $51, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $68, -80(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_187
+    jmp .Lf2_188
+.Lf2_187:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $50, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_191
+    jmp .Lf2_190
+.Lf2_191:
+    movslq -12(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_190:
+    jmp .Lf2_189
+.Lf2_188:
+    movq $5, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_192
+    jmp .Lf2_193
+.Lf2_192:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_194
+.Lf2_193:
+    movq $54, %rax
+.Lf2_194:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_189:
+    movl %eax, -4(%rbp)
+    .loc 1 280 21
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_199
+    jmp .Lf2_198
+.Lf2_199:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_198:
+    cmpq $0, %rax
+    jne .Lf2_195
+    jmp .Lf2_196
+.Lf2_195:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_201
+    jmp .Lf2_200
+.Lf2_201:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_200:
+    jmp .Lf2_197
+.Lf2_196:
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf2_202
+    jmp .Lf2_203
+.Lf2_202:
+    movq $21, %rax
+    jmp .Lf2_204
+.Lf2_203:
+    movslq -4(%rbp), %rax
+.Lf2_204:
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_205
+    jmp .Lf2_206
+.Lf2_205:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf2_207
+.Lf2_206:
+    movslq -16(%rbp), %rax
+.Lf2_207:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_197:
+    movl %eax, -16(%rbp)
+    .loc 1 281 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_184:
+    .loc 1 282 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_185
+.Lf2_183:
+    addq $0, %rsp
+    .loc 1 284 13
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_209
+    jmp .Lf2_208
+.Lf2_209:
+    cmpl $3, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_208:
+    push %rax
+    movq $60, %rax
+    cmpq $0, %rax
+    jne .Lf2_210
+    jmp .Lf2_211
+.Lf2_210:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_212
+.Lf2_211:
+    movslq -16(%rbp), %rax
+.Lf2_212:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $33, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 285 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_177:
+    .loc 1 286 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_178
+.Lf2_176:
+    addq $8, %rsp
+    .loc 1 289 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 290 9
+    jmp .Lf2_216
+    .p2align 4,,10
+.Lf2_215:
+    .loc 1 292 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 293 17
+    .p2align 4,,10
+.Lf2_219:
+    .loc 1 294 21
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_223
+    jmp .Lf2_224
+.Lf2_223:
+    movslq -52(%rbp), %rax
+    jmp .Lf2_225
+.Lf2_224:
+    movslq -8(%rbp), %rax
+.Lf2_225:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_220
+    jmp .Lf2_221
+.Lf2_220:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_227
+    jmp .Lf2_226
+.Lf2_227:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_226:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_229
+    jmp .Lf2_228
+.Lf2_229:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_228:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_222
+.Lf2_221:
+    movslq -80(%rbp), %rax
+    addq $78, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_230
+    jmp .Lf2_231
+.Lf2_230:
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_232
+.Lf2_231:
+    movq $0, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_232:
+.Lf2_222:
+    movl %eax, -12(%rbp)
+    .loc 1 295 21
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $2, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $35, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 296 21
+    movq $9, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_233
+    jmp .Lf2_234
+.Lf2_233:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_235
+.Lf2_234:
+    movslq -8(%rbp), %rax
+.Lf2_235:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -60(%rbp)
+    .loc 1 297 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_218:
+    .loc 1 298 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_219
+.Lf2_217:
+    addq $0, %rsp
+    .loc 1 300 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_237
+    jmp .Lf2_236
+.Lf2_237:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_236:
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_239
+    jmp .Lf2_238
+.Lf2_239:
+    movq $66, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_238:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 301 13
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_241
+    jmp .Lf2_240
+.Lf2_241:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_240:
+    push %rax
+    movq $29, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 302 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_214:
+.Lf2_216:
+    .loc 1 290 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_215
+.Lf2_213:
+    addq $8, %rsp
+    .loc 1 305 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_247
+    .p2align 4,,10
+.Lf2_246:
+    .loc 1 306 9
+    movq $8, %rax
+    push %rax
+    movq $72, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $61, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_248
+    jmp .Lf2_244
+.Lf2_248:
+    .loc 1 307 9
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_249
+    jmp .Lf2_250
+.Lf2_249:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf2_251
+.Lf2_250:
+    movq $3, %rax
+.Lf2_251:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_253
+    jmp .Lf2_252
+.Lf2_253:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_252:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 309 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 310 13
+    jmp .Lf2_257
+    .p2align 4,,10
+.Lf2_256:
+    .loc 1 311 17
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_258
+    jmp .Lf2_259
+.Lf2_258:
+    movslq -340(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_260
+.Lf2_259:
+    movq $90, %rax
+    cmpq $0, %rax
+    jne .Lf2_261
+    jmp .Lf2_262
+.Lf2_261:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_263
+.Lf2_262:
+    movslq -8(%rbp), %rax
+.Lf2_263:
+.Lf2_260:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $93, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 312 17
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_268
+    jmp .Lf2_267
+.Lf2_268:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_267:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_264
+    jmp .Lf2_265
+.Lf2_264:
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_266
+.Lf2_265:
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_266:
+    movl %eax, -12(%rbp)
+    .loc 1 313 17
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_269
+    jmp .Lf2_270
+.Lf2_269:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_271
+.Lf2_270:
+    movslq -4(%rbp), %rax
+.Lf2_271:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_273
+    jmp .Lf2_272
+.Lf2_273:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_274
+    jmp .Lf2_275
+.Lf2_274:
+    movq $9, %rax
+    jmp .Lf2_276
+.Lf2_275:
+    movslq -16(%rbp), %rax
+.Lf2_276:
+    push %rax
+    movq $53, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_272:
+    movl %eax, -52(%rbp)
+    .loc 1 314 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_255:
+.Lf2_257:
+    .loc 1 310 20
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_256
+.Lf2_254:
+    addq $0, %rsp
+    .loc 1 317 9
+    cmpl $8, -36(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_278
+    jmp .Lf2_277
+.Lf2_278:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_280
+    jmp .Lf2_279
+.Lf2_280:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_279:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_277:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_282
+    jmp .Lf2_281
+.Lf2_282:
+    movq $7, %rax
+    push %rax
+    movq $78, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_281:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_245:
+    .loc 1 305 32
+    incl -340(%rbp)
+.Lf2_247:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_246
+.Lf2_244:
+    addq $8, %rsp
+    .loc 1 319 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_288
+    .p2align 4,,10
+.Lf2_287:
+    .loc 1 321 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 322 13
+    jmp .Lf2_292
+    .p2align 4,,10
+.Lf2_291:
+    .loc 1 323 17
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_297
+    jmp .Lf2_296
+.Lf2_297:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_296:
+    cmpq $0, %rax
+    jne .Lf2_293
+    jmp .Lf2_294
+.Lf2_293:
+    movq $55, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_295
+.Lf2_294:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_295:
+    push %rax
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf2_298
+    jmp .Lf2_299
+.Lf2_298:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf2_300
+.Lf2_299:
+    movslq -344(%rbp), %rax
+.Lf2_300:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_302
+    jmp .Lf2_301
+.Lf2_302:
+    movq $8, %rax
+    push %rax
+    movq $82, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_301:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 324 17
+    movslq -8(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_307
+    jmp .Lf2_306
+.Lf2_307:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_306:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_303
+    jmp .Lf2_304
+.Lf2_303:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_312
+    jmp .Lf2_311
+.Lf2_312:
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_311:
+    cmpq $0, %rax
+    jne .Lf2_308
+    jmp .Lf2_309
+.Lf2_308:
+    movq $4, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_310
+.Lf2_309:
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_310:
+    jmp .Lf2_305
+.Lf2_304:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_313
+    jmp .Lf2_314
+.Lf2_313:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_315
+.Lf2_314:
+    movslq -344(%rbp), %rax
+.Lf2_315:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_317
+    jmp .Lf2_316
+.Lf2_317:
+    movslq -60(%rbp), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_316:
+.Lf2_305:
+    movl %eax, -8(%rbp)
+    .loc 1 325 17
+    movq $6, %rax
+    cmpq $0, %rax
+    jne .Lf2_318
+    jmp .Lf2_319
+.Lf2_318:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_320
+.Lf2_319:
+    movslq -12(%rbp), %rax
+.Lf2_320:
+    push %rax
+    movslq -80(%rbp), %rax
+    subq $37, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $13, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 326 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_290:
+.Lf2_292:
+    .loc 1 322 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_291
+.Lf2_289:
+    addq $0, %rsp
+    .loc 1 329 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_322
+    jmp .Lf2_321
+.Lf2_322:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_321:
+    push %rax
+    movslq -32(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 330 9
+    movq $2, %rax
+    push %rax
+    movq $60, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_324
+    jmp .Lf2_323
+.Lf2_324:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_323:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_286:
+    .loc 1 319 32
+    incl -340(%rbp)
+.Lf2_288:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_287
+.Lf2_285:
+    addq $8, %rsp
+    .loc 1 332 5
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_326
+    jmp .Lf2_325
+.Lf2_326:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_325:
+    push %rax
+    movq $1, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 334 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 335 5
+    subq $8, %rsp
+    movq $48, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 336 5
+    movq $64, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 337 5
+    subq $8, %rsp
+    movq $20, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 338 5
+    movq $38, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 339 5
+    subq $64, %rsp
+    .loc 1 340 5
+    subq $256, %rsp
+    .loc 1 341 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_6
+    .p2align 4,,10
+.Lf3_5:
+    .loc 1 342 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_8
+    jmp .Lf3_9
+.Lf3_8:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_10
+.Lf3_9:
+    movslq -340(%rbp), %rax
+.Lf3_10:
+    cmpq $76, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_7
+    jmp .Lf3_3
+.Lf3_7:
+    .loc 1 343 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_12
+    jmp .Lf3_11
+.Lf3_12:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_11:
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_13
+    jmp .Lf3_14
+.Lf3_13:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_15
+.Lf3_14:
+    movslq -16(%rbp), %rax
+.Lf3_15:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_17
+    jmp .Lf3_16
+.Lf3_17:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_16:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 344 9
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_19
+    jmp .Lf3_18
+.Lf3_19:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_18:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_21
+    jmp .Lf3_20
+.Lf3_21:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_20:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_23
+    jmp .Lf3_22
+.Lf3_23:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_24
+    jmp .Lf3_25
+.Lf3_24:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf3_26
+.Lf3_25:
+    movq $2, %rax
+.Lf3_26:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_22:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 346 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 347 13
+    .p2align 4,,10
+.Lf3_29:
+    .loc 1 348 17
+    movslq -340(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $49, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 349 17
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_30
+    jmp .Lf3_31
+.Lf3_30:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_32
+.Lf3_31:
+    movq $94, %rax
+    cmpq $0, %rax
+    jne .Lf3_33
+    jmp .Lf3_34
+.Lf3_33:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf3_35
+.Lf3_34:
+    movq $18, %rax
+.Lf3_35:
+.Lf3_32:
+    push %rax
+    movq $85, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_37
+    jmp .Lf3_36
+.Lf3_37:
+    movslq -44(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_36:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -52(%rbp)
+    .loc 1 350 17
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_38
+    jmp .Lf3_39
+.Lf3_38:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_40
+.Lf3_39:
+    movq $72, %rax
+.Lf3_40:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_42
+    jmp .Lf3_41
+.Lf3_42:
+    movq $98, %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_41:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 351 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_28:
+    .loc 1 352 22
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_29
+.Lf3_27:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf3_4:
+    .loc 1 341 30
+    incl -340(%rbp)
+.Lf3_6:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_5
+.Lf3_3:
+    addq $8, %rsp
+    .loc 1 356 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 357 9
+    .p2align 4,,10
+.Lf3_45:
+    .loc 1 358 13
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_47
+    jmp .Lf3_46
+.Lf3_47:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_46:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_48
+    jmp .Lf3_49
+.Lf3_48:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_50
+.Lf3_49:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf3_50:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 359 13
+    cmpl $62, -52(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -24(%rbp), %rax
+    imulq $69, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -60(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 361 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 362 17
+    jmp .Lf3_54
+    .p2align 4,,10
+.Lf3_53:
+    .loc 1 363 21
+    movslq -76(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf3_58
+    jmp .Lf3_59
+.Lf3_58:
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_60
+.Lf3_59:
+    cmpl $15, -64(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf3_60:
+    cmpq $0, %rax
+    jne .Lf3_55
+    jmp .Lf3_56
+.Lf3_55:
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_61
+    jmp .Lf3_62
+.Lf3_61:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf3_63
+.Lf3_62:
+    movslq -344(%rbp), %rax
+.Lf3_63:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_57
+.Lf3_56:
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_65
+    jmp .Lf3_64
+.Lf3_65:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_66
+    jmp .Lf3_67
+.Lf3_66:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_68
+.Lf3_67:
+    movq $23, %rax
+.Lf3_68:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_64:
+.Lf3_57:
+    movl %eax, -12(%rbp)
+    .loc 1 364 21
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_70
+    jmp .Lf3_69
+.Lf3_70:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_69:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_72
+    jmp .Lf3_71
+.Lf3_72:
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_71:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -76(%rbp)
+    .loc 1 365 21
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $71, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_73
+    jmp .Lf3_74
+.Lf3_73:
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf3_76
+    jmp .Lf3_77
+.Lf3_76:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_78
+.Lf3_77:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf3_78:
+    jmp .Lf3_75
+.Lf3_74:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_75:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 366 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_52:
+.Lf3_54:
+    .loc 1 362 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_53
+.Lf3_51:
+    addq $0, %rsp
+    .loc 1 369 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_44:
+    .loc 1 370 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_45
+.Lf3_43:
+    addq $8, %rsp
+    .loc 1 372 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_84
+    .p2align 4,,10
+.Lf3_83:
+    .loc 1 373 9
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_86
+    jmp .Lf3_85
+.Lf3_86:
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_88
+    jmp .Lf3_87
+.Lf3_88:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_87:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_85:
+    movl %eax, -36(%rbp)
+    .loc 1 374 9
+    movq $2, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_90
+    jmp .Lf3_89
+.Lf3_90:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_89:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 376 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 377 13
+    .p2align 4,,10
+.Lf3_93:
+    .loc 1 378 17
+    cmpl $13, -40(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_94
+    jmp .Lf3_95
+.Lf3_94:
+    cmpl $67, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_96
+.Lf3_95:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf3_96:
+    push %rax
+    cmpl $92, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    addq $85, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -80(%rbp)
+    .loc 1 379 17
+    movq $3, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 380 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_98
+    jmp .Lf3_97
+.Lf3_98:
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_97:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $70, %rax
+    cmpq $0, %rax
+    jne .Lf3_99
+    jmp .Lf3_100
+.Lf3_99:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_101
+.Lf3_100:
+    movslq -8(%rbp), %rax
+.Lf3_101:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_102
+    jmp .Lf3_103
+.Lf3_102:
+    movq $73, %rax
+    jmp .Lf3_104
+.Lf3_103:
+    movslq -4(%rbp), %rax
+.Lf3_104:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 381 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_92:
+    .loc 1 382 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_93
+.Lf3_91:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf3_82:
+    .loc 1 372 30
+    incl -340(%rbp)
+.Lf3_84:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_83
+.Lf3_81:
+    addq $8, %rsp
+    .loc 1 385 5
+    movslq -12(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf3_105
+    jmp .Lf3_106
+.Lf3_105:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_107
+.Lf3_106:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_108
+    jmp .Lf3_109
+.Lf3_108:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_110
+.Lf3_109:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf3_110:
+.Lf3_107:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $66, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_111
+    jmp .Lf3_112
+.Lf3_111:
+    movslq -4(%rbp), %rax
+    addq $27, %rax
+    movslq %eax, %rax
+    jmp .Lf3_113
+.Lf3_112:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_113:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 387 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 388 9
+    .p2align 4,,10
+.Lf3_116:
+    .loc 1 389 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_118
+    jmp .Lf3_117
+.Lf3_118:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_117:
+    push %rax
+    movq $87, %rax
+    cmpq $50, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_119
+    jmp .Lf3_120
+.Lf3_119:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf3_121
+.Lf3_120:
+    movslq -4(%rbp), %rax
+.Lf3_121:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 391 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 392 17
+    jmp .Lf3_125
+    .p2align 4,,10
+.Lf3_124:
+    .loc 1 393 21
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_126
+    jmp .Lf3_122
+.Lf3_126:
+    .loc 1 394 21
+    movslq -80(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $83, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -72(%rbp)
+    .loc 1 395 21
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_131
+    jmp .Lf3_130
+.Lf3_131:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_130:
+    push %rax
+    cmpl $99, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_127
+    jmp .Lf3_128
+.Lf3_127:
+    movq $3, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_129
+.Lf3_128:
+    movq $8, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_133
+    jmp .Lf3_132
+.Lf3_133:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_135
+    jmp .Lf3_134
+.Lf3_135:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_134:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_132:
+.Lf3_129:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 396 21
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -76(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $14, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf3_136
+    jmp .Lf3_137
+.Lf3_136:
+    movslq -344(%rbp), %rax
+    jmp .Lf3_138
+.Lf3_137:
+    movslq -340(%rbp), %rax
+.Lf3_138:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_140
+    jmp .Lf3_139
+.Lf3_140:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addq $72, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_139:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 397 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_123:
+.Lf3_125:
+    .loc 1 392 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_124
+.Lf3_122:
+    addq $0, %rsp
+    .loc 1 400 13
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_141
+    jmp .Lf3_142
+.Lf3_141:
+    movq $87, %rax
+    jmp .Lf3_143
+.Lf3_142:
+    movslq -16(%rbp), %rax
+.Lf3_143:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_144
+    jmp .Lf3_145
+.Lf3_144:
+    movq $90, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_146
+.Lf3_145:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_147
+    jmp .Lf3_148
+.Lf3_147:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_149
+.Lf3_148:
+    movslq -68(%rbp), %rax
+.Lf3_149:
+.Lf3_146:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 401 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_115:
+    .loc 1 402 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_116
+.Lf3_114:
+    addq $8, %rsp
+    .loc 1 405 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 406 9
+    jmp .Lf3_153
+    .p2align 4,,10
+.Lf3_152:
+    .loc 1 407 13
+    movslq -340(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_157
+    jmp .Lf3_158
+.Lf3_157:
+    movq $56, %rax
+    jmp .Lf3_159
+.Lf3_158:
+    movslq -340(%rbp), %rax
+.Lf3_159:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_154
+    jmp .Lf3_155
+.Lf3_154:
+    cmpl $89, -48(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_156
+.Lf3_155:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    subq $21, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf3_156:
+    movl %eax, -12(%rbp)
+    .loc 1 408 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_161
+    jmp .Lf3_160
+.Lf3_161:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_160:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_162
+    jmp .Lf3_163
+.Lf3_162:
+    movq $32, %rax
+    jmp .Lf3_164
+.Lf3_163:
+    movslq -12(%rbp), %rax
+.Lf3_164:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 410 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 411 17
+    .p2align 4,,10
+.Lf3_167:
+    .loc 1 412 21
+    cmpl $58, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $31, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 413 21
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_172
+    jmp .Lf3_171
+.Lf3_172:
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_171:
+    cmpq $0, %rax
+    jne .Lf3_168
+    jmp .Lf3_169
+.Lf3_168:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_174
+    jmp .Lf3_173
+.Lf3_174:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_173:
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_176
+    jmp .Lf3_175
+.Lf3_176:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_175:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_170
+.Lf3_169:
+    cmpl $74, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf3_170:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 414 21
+    movq $1, %rax
+    push %rax
+    movq $54, %rax
+    cmpq $0, %rax
+    jne .Lf3_180
+    jmp .Lf3_181
+.Lf3_180:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_182
+.Lf3_181:
+    movslq -8(%rbp), %rax
+.Lf3_182:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_177
+    jmp .Lf3_178
+.Lf3_177:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_184
+    jmp .Lf3_183
+.Lf3_184:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_183:
+    push %rax
+    movq $97, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_179
+.Lf3_178:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_185
+    jmp .Lf3_186
+.Lf3_185:
+    cmpl $64, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_187
+.Lf3_186:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_189
+    jmp .Lf3_188
+.Lf3_189:
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_188:
+.Lf3_187:
+.Lf3_179:
+    movl %eax, -8(%rbp)
+    .loc 1 415 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_166:
+    .loc 1 416 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_167
+.Lf3_165:
+    addq $0, %rsp
+    .loc 1 418 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_151:
+.Lf3_153:
+    .loc 1 406 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_152
+.Lf3_150:
+    addq $8, %rsp
+    .loc 1 421 5
+    movq $75, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_191
+    jmp .Lf3_190
+.Lf3_191:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_190:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -40(%rbp)
+    .loc 1 422 5
+    movq $9, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_192
+    jmp .Lf3_193
+.Lf3_192:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_195
+    jmp .Lf3_196
+.Lf3_195:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_197
+.Lf3_196:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf3_197:
+    jmp .Lf3_194
+.Lf3_193:
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf3_194:
+    movl %eax, -8(%rbp)
+    .loc 1 424 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 425 9
+    jmp .Lf3_201
+    .p2align 4,,10
+.Lf3_200:
+    .loc 1 427 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 428 17
+    .p2align 4,,10
+.Lf3_204:
+    .loc 1 429 21
+    movslq -4(%rbp), %rax
+    addq $90, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_206
+    jmp .Lf3_205
+.Lf3_206:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_207
+    jmp .Lf3_208
+.Lf3_207:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_209
+.Lf3_208:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf3_209:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_211
+    jmp .Lf3_210
+.Lf3_211:
+    movq $41, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_213
+    jmp .Lf3_212
+.Lf3_213:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_212:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_210:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_205:
+    movl %eax, -12(%rbp)
+    .loc 1 430 21
+    movq $9, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_214
+    jmp .Lf3_215
+.Lf3_214:
+    movq $9, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $92, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_216
+.Lf3_215:
+    movslq -20(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $19, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf3_216:
+    movl %eax, -72(%rbp)
+    .loc 1 431 21
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imulq $20, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $41, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 432 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_203:
+    .loc 1 433 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_204
+.Lf3_202:
+    addq $0, %rsp
+    .loc 1 435 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_217
+    jmp .Lf3_218
+.Lf3_217:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_219
+.Lf3_218:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf3_219:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $57, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_221
+    jmp .Lf3_220
+.Lf3_221:
+    movq $2, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_220:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 436 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_223
+    jmp .Lf3_222
+.Lf3_223:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_222:
+    push %rax
+    movq $44, %rax
+    cmpq $0, %rax
+    jne .Lf3_224
+    jmp .Lf3_225
+.Lf3_224:
+    movq $7, %rax
+    jmp .Lf3_226
+.Lf3_225:
+    movslq -12(%rbp), %rax
+.Lf3_226:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_228
+    jmp .Lf3_227
+.Lf3_228:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_227:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 437 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_199:
+.Lf3_201:
+    .loc 1 425 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_200
+.Lf3_198:
+    addq $8, %rsp
+    .loc 1 440 5
+    movq $1, %rax
+    push %rax
+    movq $63, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_230
+    .loc 1 441 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_235
+    jmp .Lf3_234
+.Lf3_235:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_234:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_237
+    jmp .Lf3_236
+.Lf3_237:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_236:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_231
+    jmp .Lf3_232
+.Lf3_231:
+    movq $71, %rax
+    cmpq $0, %rax
+    jne .Lf3_238
+    jmp .Lf3_239
+.Lf3_238:
+    movq $85, %rax
+    jmp .Lf3_240
+.Lf3_239:
+    movq $29, %rax
+.Lf3_240:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf3_233
+.Lf3_232:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_241
+    jmp .Lf3_242
+.Lf3_241:
+    movq $29, %rax
+    cmpq $0, %rax
+    jne .Lf3_244
+    jmp .Lf3_245
+.Lf3_244:
+    movslq -56(%rbp), %rax
+    jmp .Lf3_246
+.Lf3_245:
+    movslq -76(%rbp), %rax
+.Lf3_246:
+    jmp .Lf3_243
+.Lf3_242:
+    movslq -16(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_243:
+.Lf3_233:
+    movl %eax, -36(%rbp)
+    .loc 1 442 9
+    movq $20, %rax
+    cmpq $40, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_248
+    jmp .Lf3_247
+.Lf3_248:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_247:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    addq $89, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 443 9
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_249
+    jmp .Lf3_250
+.Lf3_249:
+    movq $65, %rax
+    cmpq $93, %rax
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_251
+.Lf3_250:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_253
+    jmp .Lf3_252
+.Lf3_253:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_252:
+.Lf3_251:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $88, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_229
+.Lf3_230:
+    .loc 1 445 9
+    movslq -40(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_254
+    jmp .Lf3_255
+.Lf3_254:
+    movq $80, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_256
+.Lf3_255:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf3_256:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 446 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_257
+    jmp .Lf3_258
+.Lf3_257:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_259
+.Lf3_258:
+    movslq -8(%rbp), %rax
+.Lf3_259:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 447 9
+    movq $75, %rax
+    subq $77, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_260
+    jmp .Lf3_261
+.Lf3_260:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_262
+.Lf3_261:
+    movslq -4(%rbp), %rax
+.Lf3_262:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_229:
+    .loc 1 449 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_263
+    jmp .Lf3_264
+.Lf3_263:
+    movq $99, %rax
+    jmp .Lf3_265
+.Lf3_264:
+    movslq -16(%rbp), %rax
+.Lf3_265:
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_267
+    jmp .Lf3_266
+.Lf3_267:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_266:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_269
+    jmp .Lf3_268
+.Lf3_269:
+    movslq -8(%rbp), %rax
+    addq $82, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf3_270
+    jmp .Lf3_271
+.Lf3_270:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_272
+.Lf3_271:
+    movslq -4(%rbp), %rax
+.Lf3_272:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_268:
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
@@ -0,0 +1,105 @@
+int f0() {
+    int v0 = 18;
+    int v1 = 52;
+    int v2 = 54;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    if ((((98 && v0) == (v2 > a0[9])) <= ((39 / 1) / 8))) {
+        v3 = (((84 - 84) < (v0 / 9)) >= ((a0[15] ? 49 : v2) && (v3 % 5)));
+        v0 = (((v3 || v3) <= (v0 && a0[13])) <= ((v1 > a1[1][13]) < (v2 * 31)));
+        a0[13] = (((v1 != a0[10]) >= (46 == a1[0][3])) + ((a0[1] != v0) > (71 < 87)));
+    } else {
+        v0 = (((59 ? v3 : 97) / 2) ? ((v0 ? v1 : v2) != (35 ? v1 : v3)) : ((v1 * 5) / 3));
+        a0[11] = (((a0[15] % 1) < (29 - v0)) ? ((v1 > a0[15]) < (26 >= a0[1])) : ((a1[2][6] || v0) * (a0[0] - v3)));
+        v1 = (((40 || v2) && (a0[1] >= v0)) <= ((a0[9] <= v2) ? (67 && 29) : (25 + 4)));
+    }
+    v2 = (((v3 >= v1) >= (a0[12] > a0[10])) < ((79 == v1) % 5));
+    if ((((v3 > a1[0][10]) >= (a0[1] == v0)) ? ((26 < 59) > (84 != v1)) : ((80 || v3) >= (a0[1] == a0[10])))) {
+        v0 = (((v2 + v3) - (v2 % 5)) || ((57 ? v1 : v2) || (70 <= 24)));
+        v2 = (((33 >= v0) < (v3 ? v3 : 4)) == ((a1[0][4] != a0[9]) != (a0[0] || v2)));
+        a0[8] = (((v3 ? v2 : v2) < (a1[3][2] - 37)) <= ((a0[4] && v3) <= (69 > v3)));
+    } else {
+        v2 = (((v3 > a0[13]) / 2) < ((a1[3][4] != 8) > (81 > v2)));
+        a1[0][10] = (((v1 ? v1 : a0[8]) + (a1[3][4] ? 27 : v0)) - ((v1 < v1) / 6));
+        a1[1][13] = (((v1 >= v0) / 1) && ((a0[1] < a0[10]) * (a1[0][14] >= v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((a1[2][10] == 29) + (10 != a0[12])) % 7);
+            v1 = (((v2 + v0) >= (61 > v2)) * ((a1[1][14] ? 62 : a0[10]) <= (v0 - v3)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v3 = (((54 % 6) / 8) + ((i1 == i0) ? (99 >= 22) : (v1 * v0)));
+                v3 = (((a1[3][0] ? v0 : v3) == (a0[12] % 6)) <= ((a0[12] == v1) - (v1 + v2)));
+                v3 = (((v1 / 6) > (98 - 10)) % 3);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 && v1) ? (62 <= v1) : (v2 + v1)) && ((v2 ? 45 : 61) % 5))) {
+        a1[1][2] = (((v1 / 9) != (v0 * v3)) ? ((v1 != 30) - (a1[2][11] <= 24)) : ((v1 <= v0) != (v0 <= 87)));
+        v3 = (((v1 == v1) % 9) + ((a1[1][15] && v3) != (v1 % 8)));
+        a1[0][11] = (((v3 / 1) == (77 && v0)) ? ((v1 <= a0[3]) == (63 % 2)) : ((a1[0][2] ? v2 : a1[1][15]) != (99 != v2)));
+    } else {
+        v0 = (((a1[2][2] - a1[1][9]) - (29 == v1)) || ((a0[5] <= v2) ? (v1 == a1[3][8]) : (a1[0][3] == 22)));
+        v0 = (((87 - a0[7]) ? (v2 != a1[0][1]) : (a1[1][10] || v1)) < ((v3 >= a0[13]) ? (v0 - v1) : (3 - v0)));
+        v3 = (((a1[1][10] <= v0) / 9) + ((v2 >= 13) % 5));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((a1[2][15] >= 18) > 87) break;
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                v3 = (((a1[3][6] - a1[1][11]) + (v3 ? a0[14] : 18)) * ((a0[0] + 48) ? (a1[1][14] * 45) : (v1 && v2)));
+                v3 = (((55 > a1[2][3]) / 7) && ((a0[14] && a1[0][14]) ? (51 > i2) : (48 ? v3 : a1[1][12])));
+                v3 = (((v3 + i3) <= (v3 * 10)) ? ((a0[15] % 6) * (2 ? 52 : v0)) : ((i2 ? 38 : 14) / 1));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((63 * v0) <= (i2 * 34)) ? ((a0[3] <= 94) ? (63 + v2) : (v0 - a0[1])) : ((67 > 81) * (v2 % 4)));
+        a1[3][9] = (((v2 ? v0 : v2) ? (i2 - 21) : (v2 ? v1 : 34)) || ((a0[14] / 6) * (v0 ? v2 : 0)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a1[0][9] == 20) || (v3 && a1[0][3])) / 6);
+            a1[3][5] = (((v3 == a0[7]) <= (v3 % 4)) - ((v3 % 7) > (v1 - a0[12])));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((a1[0][1] < v0) || (v2 || a1[0][14])) && ((v1 || 83) < (i5 % 5)));
+                    a1[2][12] = (((i4 <= 47) ? (a0[3] - i4) : (v1 % 9)) - ((96 ? 53 : v0) - (v2 && v3)));
+                    a1[2][15] = (((17 - v3) % 6) / 7);
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    a1[2][9] = (((v1 + v1) == (45 <= a0[10])) * ((v0 != a0[14]) < (a1[3][10] != a1[2][8])));
+    v2 = (((v2 != v2) / 4) <= ((a0[4] || v2) == (v3 < 34)));
+    {
+        int i6 = 0;
+        do {
+            v1 = (((a1[0][5] != a1[0][15]) - (88 ? v3 : a1[2][8])) >= ((a1[3][9] > v1) >= (a0[12] / 4)));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v3 = (((v0 - i7) || (7 && v1)) == ((v3 <= a0[12]) ? (v2 || v1) : (v0 > v1)));
+                    v0 = (((i7 == a0[10]) > (6 >= i6)) < ((a1[1][11] < 68) && (v0 ? i7 : v1)));
+                    v0 = (((52 > 30) - (a0[11] / 3)) != ((i7 <= v1) != (a0[8] ? i7 : a0[15])));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((v0 % 9) ? (v1 && a0[0]) : (a0[10] >= v3)) || ((a0[11] > v0) || (a0[0] != a1[2][7])));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    return (((91 ? v2 : a0[4]) < (a0[9] || 39)) || ((a1[0][15] * a0[4]) / 1));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
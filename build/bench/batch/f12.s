@@ -0,0 +1,2649 @@
+    .file 1 "build/bench/batch/f12.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 101 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 102 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 103 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 104 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $18, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $52, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $54, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $76, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_3
+    jmp .Lf0_2
+.Lf0_3:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_2:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $39, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf0_4
+    .loc 1 9 9
+    movq $84, %rax
+    subq $84, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_5
+    jmp .Lf0_6
+.Lf0_5:
+    movq $49, %rax
+    jmp .Lf0_7
+.Lf0_6:
+    movslq -12(%rbp), %rax
+.Lf0_7:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_8
+.Lf0_9:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_8:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 10 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_11
+    jmp .Lf0_10
+.Lf0_11:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_10:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_13
+    jmp .Lf0_12
+.Lf0_13:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_12:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $31, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 11 9
+    movslq -76(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $71, %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $46, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_1
+.Lf0_4:
+    .loc 1 13 9
+    movq $2, %rax
+    push %rax
+    movq $59, %rax
+    cmpq $0, %rax
+    jne .Lf0_17
+    jmp .Lf0_18
+.Lf0_17:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_19
+.Lf0_18:
+    movq $97, %rax
+.Lf0_19:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_14
+    jmp .Lf0_15
+.Lf0_14:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_21
+.Lf0_20:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_22
+.Lf0_21:
+    movslq -12(%rbp), %rax
+.Lf0_22:
+    push %rax
+    movq $35, %rax
+    cmpq $0, %rax
+    jne .Lf0_23
+    jmp .Lf0_24
+.Lf0_23:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_25
+.Lf0_24:
+    movslq -16(%rbp), %rax
+.Lf0_25:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_16
+.Lf0_15:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $5, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_16:
+    movl %eax, -4(%rbp)
+    .loc 1 14 9
+    movq $1, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $29, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_26
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -8(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $26, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_28
+.Lf0_27:
+    movslq -80(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_30
+    jmp .Lf0_29
+.Lf0_30:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_29:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_28:
+    movl %eax, -36(%rbp)
+    .loc 1 15 9
+    movq $40, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    movslq -76(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_35
+    jmp .Lf0_36
+.Lf0_35:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_38
+.Lf0_39:
+    movq $29, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_38:
+    jmp .Lf0_37
+.Lf0_36:
+    movq $25, %rax
+    addq $4, %rax
+    movslq %eax, %rax
+.Lf0_37:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_1:
+    .loc 1 17 5
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $79, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 18 5
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_42
+.Lf0_41:
+    movq $26, %rax
+    cmpq $59, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $84, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_43
+.Lf0_42:
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_45
+    jmp .Lf0_44
+.Lf0_45:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_44:
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_43:
+    cmpq $0, %rax
+    je .Lf0_46
+    .loc 1 19 9
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_48
+    jmp .Lf0_47
+.Lf0_48:
+    movq $57, %rax
+    cmpq $0, %rax
+    jne .Lf0_49
+    jmp .Lf0_50
+.Lf0_49:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_51
+.Lf0_50:
+    movslq -12(%rbp), %rax
+.Lf0_51:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_53
+    jmp .Lf0_52
+.Lf0_53:
+    movq $70, %rax
+    cmpq $24, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_52:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_47:
+    movl %eax, -4(%rbp)
+    .loc 1 20 9
+    movq $33, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_54
+    jmp .Lf0_55
+.Lf0_54:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_56
+.Lf0_55:
+    movq $4, %rax
+.Lf0_56:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_58
+    jmp .Lf0_57
+.Lf0_58:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_57:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 21 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -12(%rbp), %rax
+.Lf0_61:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    subq $37, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_63
+    jmp .Lf0_62
+.Lf0_63:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_62:
+    push %rax
+    movq $69, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_40
+.Lf0_46:
+    .loc 1 23 9
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $8, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $81, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 24 9
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_64
+    jmp .Lf0_65
+.Lf0_64:
+    movq $27, %rax
+    jmp .Lf0_66
+.Lf0_65:
+    movslq -4(%rbp), %rax
+.Lf0_66:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_68
+.Lf0_67:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_69
+.Lf0_68:
+    movslq -48(%rbp), %rax
+.Lf0_69:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 25 9
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_70
+.Lf0_71:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_70:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_40:
+    .loc 1 28 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 29 9
+    jmp .Lf0_75
+    .p2align 4,,10
+.Lf0_74:
+    .loc 1 30 13
+    movq $7, %rax
+    push %rax
+    movq $10, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $29, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 31 13
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_76
+    jmp .Lf0_77
+.Lf0_76:
+    movq $62, %rax
+    jmp .Lf0_78
+.Lf0_77:
+    movslq -40(%rbp), %rax
+.Lf0_78:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $61, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 32 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_84
+    .p2align 4,,10
+.Lf0_83:
+    .loc 1 33 17
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_89
+.Lf0_88:
+    movq $99, %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_90
+.Lf0_89:
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_90:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 34 17
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_92
+.Lf0_91:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_93
+.Lf0_92:
+    movslq -16(%rbp), %rax
+.Lf0_93:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 35 17
+    movq $3, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $98, %rax
+    subq $10, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_87:
+    .loc 1 32 38
+    incl -344(%rbp)
+    .loc 1 33 17
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_95
+.Lf0_94:
+    movq $99, %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_96
+.Lf0_95:
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_96:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 34 17
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_97
+    jmp .Lf0_98
+.Lf0_97:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_99
+.Lf0_98:
+    movslq -16(%rbp), %rax
+.Lf0_99:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 35 17
+    movq $3, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $98, %rax
+    subq $10, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_86:
+    .loc 1 32 38
+    incl -344(%rbp)
+.Lf0_84:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $4, %rax
+    jl .Lf0_83
+.Lf0_85:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_81
+    .loc 1 33 17
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_100
+    jmp .Lf0_101
+.Lf0_100:
+    movq $99, %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_102
+.Lf0_101:
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_102:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 34 17
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_104
+.Lf0_103:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_105
+.Lf0_104:
+    movslq -16(%rbp), %rax
+.Lf0_105:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 35 17
+    movq $3, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $98, %rax
+    subq $10, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_82:
+    .loc 1 32 38
+    incl -344(%rbp)
+    jmp .Lf0_85
+.Lf0_81:
+    addq $0, %rsp
+    .loc 1 37 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_73:
+.Lf0_75:
+    .loc 1 29 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_74
+.Lf0_72:
+    addq $8, %rsp
+    .loc 1 40 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_111
+    jmp .Lf0_110
+.Lf0_111:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_110:
+    cmpq $0, %rax
+    jne .Lf0_107
+    jmp .Lf0_108
+.Lf0_107:
+    movq $62, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_109
+.Lf0_108:
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_109:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_112
+.Lf0_113:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_115
+.Lf0_114:
+    movq $45, %rax
+    jmp .Lf0_116
+.Lf0_115:
+    movq $61, %rax
+.Lf0_116:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_112:
+    cmpq $0, %rax
+    je .Lf0_117
+    .loc 1 41 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_118
+    jmp .Lf0_119
+.Lf0_118:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $24, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $30, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_120
+.Lf0_119:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $87, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_120:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 42 9
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_122
+    jmp .Lf0_121
+.Lf0_122:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_121:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 43 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_125
+.Lf0_124:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_128
+    jmp .Lf0_129
+.Lf0_128:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_130
+.Lf0_129:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf0_130:
+    push %rax
+    movq $99, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_125:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_106
+.Lf0_117:
+    .loc 1 45 9
+    movq $29, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_132
+    jmp .Lf0_131
+.Lf0_132:
+    movslq -60(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_135
+.Lf0_134:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    sete %al
+.Lf0_135:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_131:
+    movl %eax, -4(%rbp)
+    .loc 1 46 9
+    movq $87, %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_136
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_138
+.Lf0_137:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_140
+    jmp .Lf0_139
+.Lf0_140:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_139:
+.Lf0_138:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_143
+.Lf0_142:
+    movq $3, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_143:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 47 9
+    movq $5, %rax
+    push %rax
+    cmpl $13, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_106:
+    .loc 1 49 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_149
+    .p2align 4,,10
+.Lf0_148:
+    .loc 1 50 9
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $18, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $87, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_150
+    jmp .Lf0_146
+.Lf0_150:
+    .loc 1 52 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 53 13
+    jmp .Lf0_154
+    .p2align 4,,10
+.Lf0_153:
+    .loc 1 54 17
+    movslq -80(%rbp), %rax
+    addq $48, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_156
+.Lf0_155:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    imulq $45, %rax
+    movslq %eax, %rax
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_159
+    jmp .Lf0_158
+.Lf0_159:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_158:
+.Lf0_157:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_160
+    jmp .Lf0_161
+.Lf0_160:
+    movslq -24(%rbp), %rax
+    jmp .Lf0_162
+.Lf0_161:
+    movq $18, %rax
+.Lf0_162:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 55 17
+    movq $7, %rax
+    push %rax
+    movq $55, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_163
+.Lf0_164:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_169
+    jmp .Lf0_168
+.Lf0_169:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_168:
+    cmpq $0, %rax
+    jne .Lf0_165
+    jmp .Lf0_166
+.Lf0_165:
+    movq $51, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_167
+.Lf0_166:
+    movq $48, %rax
+    cmpq $0, %rax
+    jne .Lf0_170
+    jmp .Lf0_171
+.Lf0_170:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_172
+.Lf0_171:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf0_172:
+.Lf0_167:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_163:
+    movl %eax, -16(%rbp)
+    .loc 1 56 17
+    movslq -16(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $10, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_174
+.Lf0_173:
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf0_176
+    jmp .Lf0_177
+.Lf0_176:
+    movq $52, %rax
+    jmp .Lf0_178
+.Lf0_177:
+    movslq -4(%rbp), %rax
+.Lf0_178:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_175
+.Lf0_174:
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_180
+.Lf0_179:
+    movq $38, %rax
+    jmp .Lf0_181
+.Lf0_180:
+    movq $14, %rax
+.Lf0_181:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_175:
+    movl %eax, -16(%rbp)
+    .loc 1 57 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_152:
+.Lf0_154:
+    .loc 1 53 20
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_153
+.Lf0_151:
+    addq $0, %rsp
+    .loc 1 60 9
+    movq $63, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imulq $34, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_182
+    jmp .Lf0_183
+.Lf0_182:
+    cmpl $94, -68(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_186
+.Lf0_185:
+    movq $63, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_187
+.Lf0_186:
+    movslq -4(%rbp), %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_187:
+    jmp .Lf0_184
+.Lf0_183:
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $67, %rax
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_184:
+    movl %eax, -12(%rbp)
+    .loc 1 61 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_191
+    jmp .Lf0_192
+.Lf0_191:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_193
+.Lf0_192:
+    movslq -12(%rbp), %rax
+.Lf0_193:
+    cmpq $0, %rax
+    jne .Lf0_188
+    jmp .Lf0_189
+.Lf0_188:
+    movslq -340(%rbp), %rax
+    subq $21, %rax
+    movslq %eax, %rax
+    jmp .Lf0_190
+.Lf0_189:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_195
+.Lf0_194:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_196
+.Lf0_195:
+    movq $34, %rax
+.Lf0_196:
+.Lf0_190:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_198
+    jmp .Lf0_197
+.Lf0_198:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_200
+.Lf0_199:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_201
+.Lf0_200:
+    movq $0, %rax
+.Lf0_201:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_197:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_147:
+    .loc 1 49 30
+    incl -340(%rbp)
+.Lf0_149:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_148
+.Lf0_146:
+    addq $8, %rsp
+    .loc 1 64 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 65 9
+    .p2align 4,,10
+.Lf0_204:
+    .loc 1 66 13
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $20, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_206
+    jmp .Lf0_205
+.Lf0_206:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_208
+    jmp .Lf0_207
+.Lf0_208:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_207:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_205:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 67 13
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 69 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 70 17
+    .p2align 4,,10
+.Lf0_211:
+    .loc 1 71 21
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_213
+    jmp .Lf0_212
+.Lf0_213:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_215
+    jmp .Lf0_214
+.Lf0_215:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_214:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_212:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_217
+    jmp .Lf0_216
+.Lf0_217:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_216:
+    movl %eax, -8(%rbp)
+    .loc 1 72 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_221
+    jmp .Lf0_220
+.Lf0_221:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_220:
+    push %rax
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf0_222
+    jmp .Lf0_223
+.Lf0_222:
+    movq $53, %rax
+    jmp .Lf0_224
+.Lf0_223:
+    movslq -4(%rbp), %rax
+.Lf0_224:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $47, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -68(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_227
+.Lf0_226:
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_227:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 73 21
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $17, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 74 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_210:
+    .loc 1 75 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_211
+.Lf0_209:
+    addq $0, %rsp
+    .loc 1 77 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_203:
+    .loc 1 78 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_204
+.Lf0_202:
+    addq $8, %rsp
+    .loc 1 80 5
+    movslq -4(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 81 5
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_229
+    jmp .Lf0_228
+.Lf0_229:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_228:
+    push %rax
+    cmpl $34, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 83 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 84 9
+    .p2align 4,,10
+.Lf0_232:
+    .loc 1 85 13
+    movq $88, %rax
+    cmpq $0, %rax
+    jne .Lf0_233
+    jmp .Lf0_234
+.Lf0_233:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_235
+.Lf0_234:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf0_235:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 87 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 88 17
+    jmp .Lf0_239
+    .p2align 4,,10
+.Lf0_238:
+    .loc 1 89 21
+    movslq -4(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_241
+    jmp .Lf0_240
+.Lf0_241:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_243
+    jmp .Lf0_242
+.Lf0_243:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_242:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_240:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_244
+    jmp .Lf0_245
+.Lf0_244:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_248
+    jmp .Lf0_247
+.Lf0_248:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_247:
+    jmp .Lf0_246
+.Lf0_245:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_246:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 90 21
+    movslq -344(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $68, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_249
+.Lf0_250:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_251
+    jmp .Lf0_252
+.Lf0_251:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_253
+.Lf0_252:
+    movslq -8(%rbp), %rax
+.Lf0_253:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_249:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 91 21
+    movq $3, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $52, %rax
+    cmpq $30, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_254
+    jmp .Lf0_255
+.Lf0_254:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_256
+.Lf0_255:
+    movslq -20(%rbp), %rax
+.Lf0_256:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 92 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_237:
+.Lf0_239:
+    .loc 1 88 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_238
+.Lf0_236:
+    addq $0, %rsp
+    .loc 1 95 13
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_257
+    jmp .Lf0_258
+.Lf0_257:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_261
+    jmp .Lf0_260
+.Lf0_261:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_260:
+    jmp .Lf0_259
+.Lf0_258:
+    movslq -40(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_259:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_263
+    jmp .Lf0_262
+.Lf0_263:
+    movslq -36(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_265
+    jmp .Lf0_264
+.Lf0_265:
+    movslq -80(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_264:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_262:
+    movl %eax, -16(%rbp)
+    .loc 1 96 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_231:
+    .loc 1 97 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_232
+.Lf0_230:
+    addq $8, %rsp
+    .loc 1 99 5
+    movq $91, %rax
+    cmpq $0, %rax
+    jne .Lf0_266
+    jmp .Lf0_267
+.Lf0_266:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_268
+.Lf0_267:
+    movslq -64(%rbp), %rax
+.Lf0_268:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_270
+    jmp .Lf0_269
+.Lf0_270:
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_269:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_272
+    jmp .Lf0_271
+.Lf0_272:
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_271:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
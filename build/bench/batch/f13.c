@@ -0,0 +1,203 @@
+int f0() {
+    int v0 = 35;
+    int v1 = 68;
+    int v2 = 4;
+    int v3 = 54;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 > 85) == (v2 >= 63)) || ((v0 || 77) == (37 ? v3 : a1[0][7])));
+    a0[3] = (((35 < v3) / 7) != ((a0[7] + v2) / 6));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a1[0][1] = (((v2 <= 25) ? (v2 / 5) : (a1[1][13] < a0[14])) % 7);
+        v2 = (((a0[1] == v3) / 7) || ((22 || 19) + (a0[8] < 15)));
+        {
+            int i1 = 0;
+            do {
+                if ((a0[11] + a1[0][15]) > 52) break;
+                v2 = (((78 ? a0[6] : v2) || (17 > v2)) >= ((v2 >= v3) ? (v1 * i0) : (v1 / 7)));
+                v3 = (((v1 - a0[9]) - (v2 == a0[13])) < ((v3 > i0) != (i1 != 4)));
+                v3 = (((v2 * a0[2]) == (v3 <= v2)) || ((a1[3][0] ? v3 : 40) + (v0 > v3)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+    }
+    if ((((v2 < v3) || (a1[1][10] / 7)) > ((v2 == 66) ? (v0 - v2) : (69 + v1)))) {
+        a1[3][14] = (((a0[15] || 8) * (v2 - v0)) || ((v1 + a1[1][0]) || (43 >= v3)));
+        a1[1][4] = (((v0 ? 7 : v3) == (88 == 69)) % 8);
+        v2 = (((v0 >= a1[0][0]) * (75 + v3)) != ((v2 <= a0[0]) >= (72 ? 66 : 89)));
+    } else {
+        a0[3] = (((v3 / 7) == (3 ? 26 : v0)) + ((61 && v2) != (2 ? v0 : v3)));
+        v1 = (((v1 <= a0[13]) < (v2 - 69)) / 1);
+        v2 = (((46 != v2) && (a0[7] % 8)) ? ((26 || 9) || (v0 + v3)) : ((a0[8] && a1[0][14]) || (v3 <= v0)));
+    }
+    if ((((5 < v3) - (v1 + v2)) % 7)) {
+        v2 = (((v1 <= v2) < (89 || 42)) == ((73 && 74) >= (v3 * v0)));
+        a1[1][7] = (((v3 % 2) <= (a1[3][8] <= v2)) / 5);
+        v2 = (((v3 == a1[0][2]) < (a0[2] != v2)) || ((8 - v1) ? (31 || v2) : (v3 % 4)));
+    } else {
+        a0[0] = (((a0[0] < 2) / 7) == ((v1 == a1[1][5]) * (v2 > 38)));
+        v1 = (((v1 / 8) < (v2 && v3)) / 4);
+        v3 = (((v2 == v1) - (a1[2][11] > v1)) < ((v3 + v3) - (a1[3][8] || v1)));
+    }
+    if ((((v3 < 66) && (v0 || v1)) + ((a1[3][2] ? a1[1][14] : a0[6]) < (a0[11] - v2)))) {
+        v1 = (((10 < v3) % 1) % 2);
+        a0[14] = (((a1[2][11] * a1[1][6]) == (v0 && a1[2][15])) % 5);
+        v0 = (((23 - 97) && (v1 != v1)) > ((v3 % 6) == (51 - v2)));
+    } else {
+        v2 = (((a0[2] != v1) || (a1[2][2] <= a0[8])) + ((v3 * v3) || (4 && 9)));
+        v1 = (((72 % 7) || (a0[14] > v3)) <= ((v2 >= 85) / 4));
+        a1[0][4] = (((a1[1][4] < v2) == (62 < 44)) > ((a1[0][8] == v0) != (v2 >= a1[3][14])));
+    }
+    v0 = (((v3 || 99) > (v1 <= a0[9])) < ((93 != v3) > (a0[11] || 2)));
+    if ((((v3 / 5) * (a0[8] >= a1[1][6])) % 3)) {
+        a0[10] = (((v3 + 61) <= (a1[0][0] ? a1[0][15] : v1)) % 7);
+        v2 = (((v1 % 6) % 7) + ((a0[0] * v0) >= (16 >= 7)));
+        a1[3][0] = (((v0 && v2) <= (v3 && a0[6])) == ((a0[2] == v1) ? (72 != v2) : (21 == v1)));
+    } else {
+        v2 = (((v2 * a0[7]) >= (v1 % 1)) ? ((1 >= v0) % 1) : ((3 >= 52) ? (42 - v1) : (v3 / 8)));
+        v0 = (((48 > v2) * (a0[4] ? v2 : v2)) * ((a0[8] <= v3) != (v3 >= v3)));
+        a1[0][2] = (((58 >= v2) <= (a0[14] ? v2 : v0)) % 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v2 = (((a0[6] >= v0) < (a0[6] || v0)) % 8);
+            v0 = (((a1[2][0] == v0) == (v0 || v2)) <= ((v0 > 79) ? (v0 != v0) : (54 || v3)));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    a1[2][15] = (((20 - 90) && (a1[3][7] >= v0)) >= ((v1 != v2) == (a1[0][5] ? v2 : a1[2][4])));
+                    v0 = (((11 && i2) + (i3 || v0)) + ((i3 && a1[3][12]) < (v0 - 95)));
+                    a0[7] = (((a0[4] < v3) ? (4 <= v0) : (i2 ? 65 : i2)) % 2);
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v1 = (((41 || a0[15]) < (a1[0][0] ? 69 : i4)) >= ((a1[0][5] >= a1[2][0]) >= (v0 != 42)));
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            v0 = (((a1[2][15] * a0[14]) % 3) / 3);
+            v0 = (((i5 >= v1) - (v1 - v1)) + ((a0[6] || i5) == (a0[6] || 59)));
+            v0 = (((v1 < v2) != (a0[3] ? v1 : v2)) != ((v0 != 84) && (i4 - 23)));
+        }
+        v3 = (((v2 <= i4) / 9) < ((a1[1][5] + a0[14]) > (a0[12] * v2)));
+    }
+    return (((46 ? v2 : 51) * (61 ? a0[2] : a0[13])) < ((a0[0] && a1[0][8]) != (v3 < a1[1][12])));
+}
+int f1() {
+    int v0 = 5;
+    int v1 = 65;
+    int v2 = 51;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 <= a1[3][9]) != (v2 >= v0)) % 5);
+    if ((((v0 <= v3) <= (68 ? a0[10] : a0[1])) <= ((65 < a0[3]) % 2))) {
+        a0[15] = (((41 < v1) || (95 >= 26)) - ((a1[2][14] * 89) > (v1 < v1)));
+        v1 = (((v2 * 16) ? (83 || v3) : (a0[8] > 62)) == ((v2 && a1[3][0]) || (v0 % 1)));
+        a0[4] = (((0 >= 95) && (1 ? a1[0][5] : a1[3][2])) == ((8 && v0) != (a0[8] * 78)));
+    } else {
+        v3 = (((v0 * a0[10]) < (v3 || v0)) && ((71 || a1[3][8]) < (a1[0][0] > 67)));
+        v0 = (((v2 * a1[3][11]) / 4) == ((v0 + 99) * (72 <= a0[12])));
+        a1[2][2] = (((95 != a1[3][5]) ? (v1 - v1) : (v1 < v3)) - ((a0[15] / 6) < (v3 ? a1[0][12] : 11)));
+    }
+    if ((((a0[8] || v0) == (a1[0][2] <= v1)) || ((v1 && v2) < (v1 ? 31 : v0)))) {
+        v0 = (((v3 * v1) < (a1[0][7] % 9)) == ((v1 != v3) - (v3 != v0)));
+        v1 = (((a1[1][13] >= a0[10]) < (15 - v2)) && ((a1[2][13] < a1[2][0]) / 1));
+        v1 = (((v0 / 3) ? (v2 ? a0[13] : a1[3][0]) : (v0 || v0)) < ((v0 * 57) != (a1[2][12] ? 85 : a1[0][6])));
+    } else {
+        v0 = (((v3 ? a1[2][6] : v0) / 2) < ((50 == a0[5]) <= (a1[2][5] - a1[0][2])));
+        a1[3][10] = (((v2 - v2) * (a0[10] - v3)) * ((v3 ? v1 : 34) / 1));
+        v0 = (((98 % 1) ? (v3 > 55) : (v2 ? v3 : v3)) >= ((2 && v1) > (v2 + v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v2 = (((i0 / 2) >= (a0[3] > v2)) < ((v3 - v2) || (a1[2][11] / 5)));
+            a1[3][4] = (((v2 <= 82) - (31 || a1[3][10])) > ((2 && v1) - (5 % 3)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((v0 * i1) > 79) break;
+                v0 = (((i0 || a1[3][13]) && (v3 % 8)) ? ((v1 * a0[13]) * (v2 + 54)) : ((a0[7] / 9) % 6));
+                v1 = (((78 - i0) > (i1 < a0[3])) >= ((v1 == i0) || (35 % 3)));
+                v0 = (((96 <= v2) && (98 || v2)) % 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v0 && v2) > 70) break;
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((i2 < 87) > (75 <= 44)) || ((58 > v3) >= (6 < v3)));
+                    v0 = (((v2 ? v0 : a1[0][3]) ? (a1[2][1] >= 49) : (i2 / 8)) != ((11 ? v1 : 83) > (a0[9] > a0[6])));
+                    a1[1][7] = (((v2 + a0[11]) ? (a1[0][2] - 68) : (v1 && a0[3])) + ((a0[0] ? 80 : a1[3][4]) != (a1[2][15] ? v3 : a0[2])));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v2 = (((i2 + a0[10]) * (3 != i2)) > ((v3 == a0[12]) == (v3 >= v3)));
+            a0[9] = (((v0 - v3) < (v3 - v2)) - ((i2 != v0) && (a0[1] ? a0[7] : v0)));
+            i2 = i2 + 1;
+        }
+    }
+    a1[3][6] = (((v3 > v2) < (v2 % 6)) ? ((v3 * 41) <= (v2 != v1)) : ((v0 + 14) >= (v1 + 78)));
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            a1[2][2] = (((v2 / 9) ? (a1[1][13] == v0) : (v2 || v3)) != ((65 / 1) ? (v0 / 3) : (46 * a1[0][2])));
+            v3 = (((a0[2] || v1) / 4) ? ((v0 >= 68) > (a1[3][10] + v2)) : ((24 ? i4 : 56) - (a0[15] % 3)));
+            a0[15] = (((a1[1][1] ? 89 : a1[1][8]) <= (v3 < i4)) ? ((v3 == a0[1]) ? (5 ? 39 : v3) : (72 % 8)) : ((4 >= a1[0][7]) / 8));
+        }
+        v1 = (((a0[8] / 3) || (v1 - a1[1][1])) ? ((v2 >= i4) == (41 > v3)) : ((v0 >= v2) != (a0[14] + 96)));
+        a0[9] = (((12 <= i4) * (v1 + i4)) % 2);
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[1][12] = (((v0 <= v1) / 5) != ((v1 < v1) + (v3 % 8)));
+            v3 = (((v0 + v2) && (v0 % 6)) + ((v1 + v3) / 1));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((i7 && 13) - (a1[3][6] == 92)) ? ((a0[7] && 25) ? (i7 || a0[8]) : (43 || v2)) : ((a1[0][10] % 3) < (25 * 57)));
+                    v2 = (((v0 / 8) && (v3 ? v3 : v0)) || ((v2 % 4) < (11 < v2)));
+                    v1 = (((i6 ? 57 : i6) == (a1[3][0] - i6)) != ((a1[0][15] * i6) ? (67 * 71) : (v2 / 7)));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            v1 = (((a0[2] % 7) ? (i8 ? a0[2] : v0) : (v1 > a0[5])) != ((v1 == v2) ? (i8 != v2) : (v3 != i8)));
+            v2 = (((v2 ? 82 : a1[3][11]) <= (i8 < a1[1][14])) == ((v2 % 2) - (75 * i8)));
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                a1[0][3] = (((a1[0][8] * a0[10]) <= (v0 > i8)) <= ((42 ? 71 : 62) == (a1[2][2] % 9)));
+                v3 = (((v0 != v2) && (a1[0][5] <= a0[12])) ? ((v3 != i8) - (a1[1][3] * a1[1][6])) : ((29 == a1[0][5]) % 5));
+                v1 = (((75 <= 16) < (v0 > v3)) ? ((23 == 16) <= (a0[6] == v3)) : ((v3 == v1) * (v2 + i8)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v0 % 8) <= (a1[1][0] + a0[0])) * ((a1[3][4] == v0) && (v1 <= a0[6])))) {
+        v0 = (((v2 < v1) != (v1 > 5)) <= ((v1 >= 16) ? (38 ? v0 : v1) : (a0[12] + a0[15])));
+        v0 = (((v1 >= a1[1][2]) == (v2 ? v3 : 98)) ? ((20 && v3) ? (a0[1] - v2) : (v1 / 7)) : ((v0 * v2) != (v0 && a1[0][13])));
+        v2 = (((v1 <= v1) < (a0[5] / 9)) > ((v0 - v2) == (a0[7] ? v0 : v3)));
+    } else {
+        v1 = (((v2 >= a1[0][5]) + (v2 || v1)) != ((a0[13] && a0[7]) ? (a1[0][9] || v2) : (43 - 68)));
+        v2 = (((v0 * v3) + (v1 % 2)) ? ((31 && 75) + (v2 - 41)) : ((v3 != 22) || (v1 || v3)));
+        v1 = (((93 > a1[3][7]) + (a1[1][1] || 5)) > ((v1 || v2) + (2 - a1[3][0])));
+    }
+    return (((a1[1][15] != a1[1][2]) == (a1[1][2] > v0)) % 4);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
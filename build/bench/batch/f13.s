@@ -0,0 +1,5532 @@
+    .file 1 "build/bench/batch/f13.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 198 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 199 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 200 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 201 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 202 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $35, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $68, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $4, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $54, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    cmpl $85, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $63, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_2
+    jmp .Lf0_1
+.Lf0_2:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_4
+    jmp .Lf0_3
+.Lf0_4:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_3:
+    push %rax
+    movq $37, %rax
+    cmpq $0, %rax
+    jne .Lf0_5
+    jmp .Lf0_6
+.Lf0_5:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_7
+.Lf0_6:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_1:
+    movl %eax, -8(%rbp)
+    .loc 1 9 5
+    movq $7, %rax
+    push %rax
+    movq $35, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -68(%rbp)
+    .loc 1 10 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_13
+    .p2align 4,,10
+.Lf0_12:
+    .loc 1 11 9
+    movq $7, %rax
+    push %rax
+    cmpl $25, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_14
+    jmp .Lf0_15
+.Lf0_14:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_16
+.Lf0_15:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf0_16:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 12 9
+    movq $7, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_18
+    jmp .Lf0_17
+.Lf0_18:
+    cmpl $15, -48(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_20
+    jmp .Lf0_19
+.Lf0_20:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_19:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_17:
+    movl %eax, -12(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 15 13
+    .p2align 4,,10
+.Lf0_23:
+    .loc 1 16 17
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $52, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_24
+    jmp .Lf0_21
+.Lf0_24:
+    .loc 1 17 17
+    movq $78, %rax
+    cmpq $0, %rax
+    jne .Lf0_25
+    jmp .Lf0_26
+.Lf0_25:
+    movslq -56(%rbp), %rax
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -12(%rbp), %rax
+.Lf0_27:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_29
+    jmp .Lf0_28
+.Lf0_29:
+    movq $17, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_28:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_31
+.Lf0_30:
+    movslq -8(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_32
+.Lf0_31:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_32:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 18 17
+    movslq -12(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 19 17
+    movslq -12(%rbp), %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_35
+    jmp .Lf0_36
+.Lf0_35:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_37
+.Lf0_36:
+    movq $40, %rax
+.Lf0_37:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    movl %eax, -16(%rbp)
+    .loc 1 20 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_22:
+    .loc 1 21 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_23
+.Lf0_21:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_11:
+    .loc 1 10 30
+    incl -340(%rbp)
+.Lf0_13:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_12
+.Lf0_10:
+    addq $8, %rsp
+    .loc 1 24 5
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_40
+    jmp .Lf0_39
+.Lf0_40:
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_39:
+    push %rax
+    cmpl $66, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_42
+.Lf0_41:
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_43
+.Lf0_42:
+    movq $69, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_43:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_44
+    .loc 1 25 9
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_46
+    jmp .Lf0_45
+.Lf0_46:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_45:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_48
+    jmp .Lf0_47
+.Lf0_48:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_50
+    jmp .Lf0_49
+.Lf0_50:
+    movq $43, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_49:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_47:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 26 9
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_51
+    jmp .Lf0_52
+.Lf0_51:
+    movq $7, %rax
+    jmp .Lf0_53
+.Lf0_52:
+    movslq -16(%rbp), %rax
+.Lf0_53:
+    push %rax
+    movq $88, %rax
+    cmpq $69, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 27 9
+    movq $75, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $72, %rax
+    cmpq $0, %rax
+    jne .Lf0_54
+    jmp .Lf0_55
+.Lf0_54:
+    movq $66, %rax
+    jmp .Lf0_56
+.Lf0_55:
+    movq $89, %rax
+.Lf0_56:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_38
+.Lf0_44:
+    .loc 1 29 9
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_58
+    jmp .Lf0_57
+.Lf0_58:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_57:
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -16(%rbp), %rax
+.Lf0_61:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_63
+.Lf0_62:
+    movq $26, %rax
+    jmp .Lf0_64
+.Lf0_63:
+    movslq -4(%rbp), %rax
+.Lf0_64:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 30 9
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $69, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 31 9
+    movq $46, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_69
+    jmp .Lf0_68
+.Lf0_69:
+    movq $8, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_68:
+    cmpq $0, %rax
+    jne .Lf0_65
+    jmp .Lf0_66
+.Lf0_65:
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_71
+    jmp .Lf0_70
+.Lf0_71:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_70:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_73
+    jmp .Lf0_72
+.Lf0_73:
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_72:
+    jmp .Lf0_67
+.Lf0_66:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_74
+.Lf0_75:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_74:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_77
+    jmp .Lf0_76
+.Lf0_77:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_76:
+.Lf0_67:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_38:
+    .loc 1 33 5
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_79
+    .loc 1 34 9
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_81
+    jmp .Lf0_80
+.Lf0_81:
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_80:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_82
+.Lf0_83:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_82:
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 35 9
+    movq $5, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 36 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_85
+    jmp .Lf0_84
+.Lf0_85:
+    movq $8, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_86
+    jmp .Lf0_87
+.Lf0_86:
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_90
+    jmp .Lf0_89
+.Lf0_90:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_89:
+    jmp .Lf0_88
+.Lf0_87:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_88:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_84:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_78
+.Lf0_79:
+    .loc 1 38 9
+    movq $7, %rax
+    push %rax
+    cmpl $2, -80(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -80(%rbp)
+    .loc 1 39 9
+    movq $4, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_91
+.Lf0_92:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_91:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 40 9
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_94
+    jmp .Lf0_93
+.Lf0_94:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_93:
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_78:
+    .loc 1 42 5
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_96
+    jmp .Lf0_97
+.Lf0_96:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf0_98
+.Lf0_97:
+    movslq -56(%rbp), %rax
+.Lf0_98:
+    push %rax
+    movslq -36(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $66, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_100
+    jmp .Lf0_99
+.Lf0_100:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_102
+    jmp .Lf0_101
+.Lf0_102:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_101:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_99:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_103
+    .loc 1 43 9
+    movq $2, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $10, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 44 9
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_105
+    jmp .Lf0_104
+.Lf0_105:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_104:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 45 9
+    movq $23, %rax
+    subq $97, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_107
+    jmp .Lf0_106
+.Lf0_107:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_106:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $51, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_95
+.Lf0_103:
+    .loc 1 47 9
+    movslq -16(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_109
+    jmp .Lf0_108
+.Lf0_109:
+    movq $4, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_111
+    jmp .Lf0_110
+.Lf0_111:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_110:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_108:
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_113
+    jmp .Lf0_112
+.Lf0_113:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_112:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 48 9
+    movq $7, %rax
+    push %rax
+    movq $72, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_115
+    jmp .Lf0_114
+.Lf0_115:
+    movslq -24(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_114:
+    push %rax
+    movq $4, %rax
+    push %rax
+    cmpl $85, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 49 9
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $62, %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_95:
+    .loc 1 51 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $93, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_119
+    jmp .Lf0_118
+.Lf0_119:
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_118:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 52 5
+    movq $3, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_121
+    .loc 1 53 9
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $61, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_122
+    jmp .Lf0_123
+.Lf0_122:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -8(%rbp), %rax
+.Lf0_124:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 54 9
+    movslq -80(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $16, %rax
+    cmpq $7, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 55 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_125
+.Lf0_126:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_125:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_128
+    jmp .Lf0_127
+.Lf0_128:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_127:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_130
+.Lf0_129:
+    movq $72, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_131
+.Lf0_130:
+    movq $21, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_131:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_120
+.Lf0_121:
+    .loc 1 57 9
+    movslq -12(%rbp), %rax
+    imull -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_132
+    jmp .Lf0_133
+.Lf0_132:
+    movq $1, %rax
+    push %rax
+    movq $1, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_134
+.Lf0_133:
+    movq $3, %rax
+    cmpq $52, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_135
+    jmp .Lf0_136
+.Lf0_135:
+    movq $42, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_137
+.Lf0_136:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_137:
+.Lf0_134:
+    movl %eax, -12(%rbp)
+    .loc 1 58 9
+    movslq -48(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_140
+.Lf0_139:
+    movslq -12(%rbp), %rax
+.Lf0_140:
+    push %rax
+    movq $48, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 59 9
+    movq $3, %rax
+    push %rax
+    movq $58, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_143
+.Lf0_142:
+    movslq -4(%rbp), %rax
+.Lf0_143:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_120:
+    .loc 1 62 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 63 9
+    jmp .Lf0_147
+    .p2align 4,,10
+.Lf0_146:
+    .loc 1 64 13
+    movq $8, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_149
+    jmp .Lf0_148
+.Lf0_149:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_148:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 65 13
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_151
+    jmp .Lf0_150
+.Lf0_151:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_150:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $79, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_152
+    jmp .Lf0_153
+.Lf0_152:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_154
+.Lf0_153:
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_156
+    jmp .Lf0_155
+.Lf0_156:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_155:
+.Lf0_154:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 67 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 68 17
+    jmp .Lf0_160
+    .p2align 4,,10
+.Lf0_159:
+    .loc 1 69 21
+    movq $20, %rax
+    subq $90, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_162
+    jmp .Lf0_161
+.Lf0_162:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_161:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_164
+.Lf0_163:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_165
+.Lf0_164:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf0_165:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 70 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_166
+.Lf0_167:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_166:
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $95, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_169
+    jmp .Lf0_168
+.Lf0_169:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_168:
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_171
+    jmp .Lf0_170
+.Lf0_171:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_170:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 71 21
+    movq $2, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_172
+    jmp .Lf0_173
+.Lf0_172:
+    movq $4, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_174
+.Lf0_173:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    movq $65, %rax
+    jmp .Lf0_177
+.Lf0_176:
+    movslq -340(%rbp), %rax
+.Lf0_177:
+.Lf0_174:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 72 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_158:
+.Lf0_160:
+    .loc 1 68 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_159
+.Lf0_157:
+    addq $0, %rsp
+    .loc 1 75 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_145:
+.Lf0_147:
+    .loc 1 63 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_146
+.Lf0_144:
+    addq $8, %rsp
+    .loc 1 78 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_183
+    .p2align 4,,10
+.Lf0_182:
+    .loc 1 79 9
+    movq $41, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_185
+    jmp .Lf0_184
+.Lf0_185:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_184:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_186
+    jmp .Lf0_187
+.Lf0_186:
+    movq $69, %rax
+    jmp .Lf0_188
+.Lf0_187:
+    movslq -340(%rbp), %rax
+.Lf0_188:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $42, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 80 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_194
+    .p2align 4,,10
+.Lf0_193:
+    .loc 1 81 13
+    movq $3, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 82 13
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_201
+    jmp .Lf0_200
+.Lf0_201:
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_200:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 83 13
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_203
+.Lf0_202:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -12(%rbp), %rax
+.Lf0_204:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $84, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_205
+.Lf0_206:
+    movslq -340(%rbp), %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_205:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_197:
+    .loc 1 80 34
+    incl -344(%rbp)
+    .loc 1 81 13
+    movq $3, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 82 13
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_208
+    jmp .Lf0_207
+.Lf0_208:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_207:
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_210
+    jmp .Lf0_209
+.Lf0_210:
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_209:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 83 13
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_211
+    jmp .Lf0_212
+.Lf0_211:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_213
+.Lf0_212:
+    movslq -12(%rbp), %rax
+.Lf0_213:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $84, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_215
+    jmp .Lf0_214
+.Lf0_215:
+    movslq -340(%rbp), %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_214:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_196:
+    .loc 1 80 34
+    incl -344(%rbp)
+.Lf0_194:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $4, %rax
+    jl .Lf0_193
+.Lf0_195:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_191
+    .loc 1 81 13
+    movq $3, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 82 13
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_217
+    jmp .Lf0_216
+.Lf0_217:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_216:
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 83 13
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_221
+.Lf0_220:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_222
+.Lf0_221:
+    movslq -12(%rbp), %rax
+.Lf0_222:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $84, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_224
+    jmp .Lf0_223
+.Lf0_224:
+    movslq -340(%rbp), %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_223:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_192:
+    .loc 1 80 34
+    incl -344(%rbp)
+    jmp .Lf0_195
+.Lf0_191:
+    addq $0, %rsp
+    .loc 1 85 9
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    addl -24(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_181:
+    .loc 1 78 30
+    incl -340(%rbp)
+.Lf0_183:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_182
+.Lf0_180:
+    addq $8, %rsp
+    .loc 1 87 5
+    movq $61, %rax
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -72(%rbp), %rax
+    jmp .Lf0_227
+.Lf0_226:
+    movslq -28(%rbp), %rax
+.Lf0_227:
+    push %rax
+    movq $46, %rax
+    cmpq $0, %rax
+    jne .Lf0_228
+    jmp .Lf0_229
+.Lf0_228:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_230
+.Lf0_229:
+    movq $51, %rax
+.Lf0_230:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_231
+.Lf0_232:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_231:
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 89 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 90 5
+    subq $8, %rsp
+    movq $5, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 91 5
+    movq $65, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 92 5
+    subq $8, %rsp
+    movq $51, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 93 5
+    movq $88, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 94 5
+    subq $64, %rsp
+    .loc 1 95 5
+    subq $256, %rsp
+    .loc 1 96 5
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 97 5
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $68, %rax
+    cmpq $0, %rax
+    jne .Lf1_2
+    jmp .Lf1_3
+.Lf1_2:
+    movslq -40(%rbp), %rax
+    jmp .Lf1_4
+.Lf1_3:
+    movslq -76(%rbp), %rax
+.Lf1_4:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $65, %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf1_5
+    .loc 1 98 9
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    imulq $89, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $41, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_7
+    jmp .Lf1_6
+.Lf1_7:
+    movq $95, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_6:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 99 9
+    movslq -12(%rbp), %rax
+    imulq $16, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_8
+    jmp .Lf1_9
+.Lf1_8:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_12
+    jmp .Lf1_11
+.Lf1_12:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_11:
+    jmp .Lf1_10
+.Lf1_9:
+    cmpl $62, -48(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf1_10:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_14
+    jmp .Lf1_13
+.Lf1_14:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_13:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_16
+    jmp .Lf1_15
+.Lf1_16:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_15:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 100 9
+    movq $0, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_17
+.Lf1_18:
+    movq $1, %rax
+    cmpq $0, %rax
+    jne .Lf1_19
+    jmp .Lf1_20
+.Lf1_19:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf1_21
+.Lf1_20:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf1_21:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_17:
+    push %rax
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_22
+.Lf1_23:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_22:
+    push %rax
+    movslq -48(%rbp), %rax
+    imulq $78, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -64(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_1
+.Lf1_5:
+    .loc 1 102 9
+    movslq -4(%rbp), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_25
+    jmp .Lf1_24
+.Lf1_25:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_24:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_27
+    jmp .Lf1_26
+.Lf1_27:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_29
+    jmp .Lf1_28
+.Lf1_29:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_28:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_26:
+    movl %eax, -16(%rbp)
+    .loc 1 103 9
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $72, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $99, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 104 9
+    movq $6, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_31
+.Lf1_30:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf1_32
+.Lf1_31:
+    movq $11, %rax
+.Lf1_32:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $95, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_33
+    jmp .Lf1_34
+.Lf1_33:
+    movslq -8(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_35
+.Lf1_34:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_35:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_1:
+    .loc 1 106 5
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_38
+    jmp .Lf1_37
+.Lf1_38:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_37:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_40
+    jmp .Lf1_39
+.Lf1_40:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_42
+    jmp .Lf1_41
+.Lf1_42:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_41:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_43
+    jmp .Lf1_44
+.Lf1_43:
+    movq $31, %rax
+    jmp .Lf1_45
+.Lf1_44:
+    movslq -4(%rbp), %rax
+.Lf1_45:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_39:
+    cmpq $0, %rax
+    je .Lf1_46
+    .loc 1 107 9
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 108 9
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $15, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_47
+.Lf1_48:
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_47:
+    movl %eax, -8(%rbp)
+    .loc 1 109 9
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_49
+    jmp .Lf1_50
+.Lf1_49:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_53
+.Lf1_52:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_54
+.Lf1_53:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf1_54:
+    jmp .Lf1_51
+.Lf1_50:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_56
+    jmp .Lf1_55
+.Lf1_56:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_55:
+.Lf1_51:
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $57, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_57
+    jmp .Lf1_58
+.Lf1_57:
+    movq $85, %rax
+    jmp .Lf1_59
+.Lf1_58:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf1_59:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_36
+.Lf1_46:
+    .loc 1 111 9
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_60
+    jmp .Lf1_61
+.Lf1_60:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_62
+.Lf1_61:
+    movslq -4(%rbp), %rax
+.Lf1_62:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $50, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 112 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_63
+    jmp .Lf1_64
+.Lf1_63:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_65
+.Lf1_64:
+    movq $34, %rax
+.Lf1_65:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 113 9
+    movq $1, %rax
+    push %rax
+    movq $98, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_67
+.Lf1_66:
+    cmpl $55, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_69
+    jmp .Lf1_70
+.Lf1_69:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_71
+.Lf1_70:
+    movslq -16(%rbp), %rax
+.Lf1_71:
+.Lf1_68:
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_72
+.Lf1_73:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_72:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_36:
+    .loc 1 116 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 117 9
+    jmp .Lf1_77
+    .p2align 4,,10
+.Lf1_76:
+    .loc 1 118 13
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_79
+    jmp .Lf1_78
+.Lf1_79:
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_78:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 119 13
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_81
+    jmp .Lf1_80
+.Lf1_81:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_80:
+    push %rax
+    cmpl $82, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_83
+    jmp .Lf1_82
+.Lf1_83:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_82:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 120 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_89
+    .p2align 4,,10
+.Lf1_88:
+    .loc 1 121 17
+    movslq -4(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_93
+    jmp .Lf1_86
+.Lf1_93:
+    .loc 1 122 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_98
+    jmp .Lf1_97
+.Lf1_98:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_97:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_100
+    jmp .Lf1_99
+.Lf1_100:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_99:
+    cmpq $0, %rax
+    jne .Lf1_94
+    jmp .Lf1_95
+.Lf1_94:
+    movslq -12(%rbp), %rax
+    addq $54, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_96
+.Lf1_95:
+    movq $6, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_96:
+    movl %eax, -4(%rbp)
+    .loc 1 123 17
+    movq $78, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_102
+    jmp .Lf1_101
+.Lf1_102:
+    movq $3, %rax
+    push %rax
+    movq $35, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_101:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 124 17
+    movq $8, %rax
+    push %rax
+    movq $96, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_104
+    jmp .Lf1_103
+.Lf1_104:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_106
+    jmp .Lf1_105
+.Lf1_106:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_105:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_103:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_92:
+    .loc 1 120 38
+    incl -344(%rbp)
+    .loc 1 121 17
+    movslq -4(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_107
+    jmp .Lf1_86
+.Lf1_107:
+    .loc 1 122 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_112
+    jmp .Lf1_111
+.Lf1_112:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_111:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+    cmpq $0, %rax
+    jne .Lf1_108
+    jmp .Lf1_109
+.Lf1_108:
+    movslq -12(%rbp), %rax
+    addq $54, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_110
+.Lf1_109:
+    movq $6, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_110:
+    movl %eax, -4(%rbp)
+    .loc 1 123 17
+    movq $78, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_116
+    jmp .Lf1_115
+.Lf1_116:
+    movq $3, %rax
+    push %rax
+    movq $35, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_115:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 124 17
+    movq $8, %rax
+    push %rax
+    movq $96, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_117
+.Lf1_118:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_120
+    jmp .Lf1_119
+.Lf1_120:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_119:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_117:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_91:
+    .loc 1 120 38
+    incl -344(%rbp)
+.Lf1_89:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $6, %rax
+    jl .Lf1_88
+.Lf1_90:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_86
+    .loc 1 121 17
+    movslq -4(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_121
+    jmp .Lf1_86
+.Lf1_121:
+    .loc 1 122 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_126
+    jmp .Lf1_125
+.Lf1_126:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_125:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_128
+    jmp .Lf1_127
+.Lf1_128:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_127:
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_123
+.Lf1_122:
+    movslq -12(%rbp), %rax
+    addq $54, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_124
+.Lf1_123:
+    movq $6, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_124:
+    movl %eax, -4(%rbp)
+    .loc 1 123 17
+    movq $78, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_130
+    jmp .Lf1_129
+.Lf1_130:
+    movq $3, %rax
+    push %rax
+    movq $35, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_129:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 124 17
+    movq $8, %rax
+    push %rax
+    movq $96, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_131
+.Lf1_132:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_134
+    jmp .Lf1_133
+.Lf1_134:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_133:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_131:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_87:
+    .loc 1 120 38
+    incl -344(%rbp)
+    jmp .Lf1_90
+.Lf1_86:
+    addq $0, %rsp
+    .loc 1 126 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_75:
+.Lf1_77:
+    .loc 1 117 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_76
+.Lf1_74:
+    addq $8, %rsp
+    .loc 1 130 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 131 9
+    jmp .Lf1_138
+    .p2align 4,,10
+.Lf1_137:
+    .loc 1 132 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_141
+    jmp .Lf1_140
+.Lf1_141:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_140:
+    cmpq $70, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_139
+    jmp .Lf1_135
+.Lf1_139:
+    .loc 1 134 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 135 17
+    .p2align 4,,10
+.Lf1_144:
+    .loc 1 136 21
+    cmpl $87, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $75, %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_146
+    jmp .Lf1_145
+.Lf1_146:
+    movq $58, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_145:
+    movl %eax, -4(%rbp)
+    .loc 1 137 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_150
+    jmp .Lf1_151
+.Lf1_150:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_152
+.Lf1_151:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf1_152:
+    cmpq $0, %rax
+    jne .Lf1_147
+    jmp .Lf1_148
+.Lf1_147:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $49, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_149
+.Lf1_148:
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_149:
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_154
+.Lf1_153:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_155
+.Lf1_154:
+    movq $83, %rax
+.Lf1_155:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 138 21
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    movq $80, %rax
+    jmp .Lf1_158
+.Lf1_157:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf1_158:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_159
+    jmp .Lf1_160
+.Lf1_159:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_161
+.Lf1_160:
+    movslq -72(%rbp), %rax
+.Lf1_161:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_163
+.Lf1_162:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    subq $68, %rax
+    movslq %eax, %rax
+    jmp .Lf1_164
+.Lf1_163:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+.Lf1_164:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 139 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_143:
+    .loc 1 140 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_144
+.Lf1_142:
+    addq $0, %rsp
+    .loc 1 142 13
+    movq $3, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 143 13
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_168
+    jmp .Lf1_167
+.Lf1_168:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_169
+    jmp .Lf1_170
+.Lf1_169:
+    movslq -52(%rbp), %rax
+    jmp .Lf1_171
+.Lf1_170:
+    movslq -4(%rbp), %rax
+.Lf1_171:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_167:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 144 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_136:
+.Lf1_138:
+    .loc 1 131 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_137
+.Lf1_135:
+    addq $8, %rsp
+    .loc 1 147 5
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_172
+    jmp .Lf1_173
+.Lf1_172:
+    movslq -16(%rbp), %rax
+    imulq $41, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_174
+.Lf1_173:
+    movslq -4(%rbp), %rax
+    addq $14, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $78, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_174:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 148 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_180
+    .p2align 4,,10
+.Lf1_179:
+    .loc 1 149 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_186
+    .p2align 4,,10
+.Lf1_185:
+    .loc 1 150 13
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_187
+    jmp .Lf1_188
+.Lf1_187:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_189
+.Lf1_188:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_191
+    jmp .Lf1_190
+.Lf1_191:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_190:
+.Lf1_189:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $65, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_192
+    jmp .Lf1_193
+.Lf1_192:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_194
+.Lf1_193:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imulq $46, %rax
+    movslq %eax, %rax
+.Lf1_194:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 151 13
+    movq $4, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_199
+    jmp .Lf1_198
+.Lf1_199:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_198:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_195
+    jmp .Lf1_196
+.Lf1_195:
+    cmpl $68, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_197
+.Lf1_196:
+    movq $3, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $24, %rax
+    cmpq $0, %rax
+    jne .Lf1_200
+    jmp .Lf1_201
+.Lf1_200:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_202
+.Lf1_201:
+    movq $56, %rax
+.Lf1_202:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_197:
+    movl %eax, -16(%rbp)
+    .loc 1 152 13
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_206
+    jmp .Lf1_207
+.Lf1_206:
+    movq $89, %rax
+    jmp .Lf1_208
+.Lf1_207:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf1_208:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_203
+    jmp .Lf1_204
+.Lf1_203:
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_209
+    jmp .Lf1_210
+.Lf1_209:
+    movq $5, %rax
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_213
+.Lf1_212:
+    movq $39, %rax
+    jmp .Lf1_214
+.Lf1_213:
+    movslq -16(%rbp), %rax
+.Lf1_214:
+    jmp .Lf1_211
+.Lf1_210:
+    movq $8, %rax
+    push %rax
+    movq $72, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_211:
+    jmp .Lf1_205
+.Lf1_204:
+    movq $8, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_205:
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+.Lf1_184:
+    .loc 1 149 34
+    incl -344(%rbp)
+.Lf1_186:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_185
+.Lf1_183:
+    addq $0, %rsp
+    .loc 1 154 9
+    movq $3, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_219
+    jmp .Lf1_218
+.Lf1_219:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_218:
+    cmpq $0, %rax
+    jne .Lf1_215
+    jmp .Lf1_216
+.Lf1_215:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $41, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -24(%rbp), %rax
+    addq $96, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_217:
+    movl %eax, -8(%rbp)
+    .loc 1 155 9
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $12, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf1_178:
+    .loc 1 148 30
+    incl -340(%rbp)
+.Lf1_180:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_179
+.Lf1_177:
+    addq $8, %rsp
+    .loc 1 158 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 159 9
+    .p2align 4,,10
+.Lf1_222:
+    .loc 1 160 13
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 161 13
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_224
+    jmp .Lf1_223
+.Lf1_224:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_223:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 163 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 164 17
+    .p2align 4,,10
+.Lf1_227:
+    .loc 1 165 21
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $92, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_232
+    jmp .Lf1_231
+.Lf1_232:
+    movq $13, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_231:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_228
+    jmp .Lf1_229
+.Lf1_228:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_237
+    jmp .Lf1_236
+.Lf1_237:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_236:
+    cmpq $0, %rax
+    jne .Lf1_233
+    jmp .Lf1_234
+.Lf1_233:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_239
+    jmp .Lf1_238
+.Lf1_239:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_238:
+    jmp .Lf1_235
+.Lf1_234:
+    movq $43, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_241
+    jmp .Lf1_240
+.Lf1_241:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_240:
+.Lf1_235:
+    jmp .Lf1_230
+.Lf1_229:
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $25, %rax
+    imulq $57, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_230:
+    movl %eax, -12(%rbp)
+    .loc 1 166 21
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_243
+    jmp .Lf1_242
+.Lf1_243:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_244
+    jmp .Lf1_245
+.Lf1_244:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_246
+.Lf1_245:
+    movslq -4(%rbp), %rax
+.Lf1_246:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_242:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_248
+    jmp .Lf1_247
+.Lf1_248:
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_247:
+    movl %eax, -12(%rbp)
+    .loc 1 167 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_249
+    jmp .Lf1_250
+.Lf1_249:
+    movq $57, %rax
+    jmp .Lf1_251
+.Lf1_250:
+    movslq -340(%rbp), %rax
+.Lf1_251:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_252
+    jmp .Lf1_253
+.Lf1_252:
+    movq $67, %rax
+    imulq $71, %rax
+    movslq %eax, %rax
+    jmp .Lf1_254
+.Lf1_253:
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_254:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 168 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_226:
+    .loc 1 169 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_227
+.Lf1_225:
+    addq $0, %rsp
+    .loc 1 171 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_221:
+    .loc 1 172 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_222
+.Lf1_220:
+    addq $8, %rsp
+    .loc 1 175 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 176 9
+    jmp .Lf1_258
+    .p2align 4,,10
+.Lf1_257:
+    .loc 1 177 13
+    movq $7, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_259
+    jmp .Lf1_260
+.Lf1_259:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_262
+    jmp .Lf1_263
+.Lf1_262:
+    movslq -72(%rbp), %rax
+    jmp .Lf1_264
+.Lf1_263:
+    movslq -4(%rbp), %rax
+.Lf1_264:
+    jmp .Lf1_261
+.Lf1_260:
+    movslq -8(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_261:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_265
+    jmp .Lf1_266
+.Lf1_265:
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_267
+.Lf1_266:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_267:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 178 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_268
+    jmp .Lf1_269
+.Lf1_268:
+    movq $82, %rax
+    jmp .Lf1_270
+.Lf1_269:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_270:
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $75, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 179 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_276
+    .p2align 4,,10
+.Lf1_275:
+    .loc 1 180 17
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $42, %rax
+    cmpq $0, %rax
+    jne .Lf1_277
+    jmp .Lf1_278
+.Lf1_277:
+    movq $71, %rax
+    jmp .Lf1_279
+.Lf1_278:
+    movq $62, %rax
+.Lf1_279:
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 181 17
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_284
+    jmp .Lf1_283
+.Lf1_284:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_283:
+    cmpq $0, %rax
+    jne .Lf1_280
+    jmp .Lf1_281
+.Lf1_280:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_282
+.Lf1_281:
+    movq $5, %rax
+    push %rax
+    movq $29, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_282:
+    movl %eax, -16(%rbp)
+    .loc 1 182 17
+    movq $75, %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_285
+    jmp .Lf1_286
+.Lf1_285:
+    movq $23, %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_287
+.Lf1_286:
+    movslq -12(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_287:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_274:
+    .loc 1 179 38
+    incl -344(%rbp)
+.Lf1_276:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_275
+.Lf1_273:
+    addq $0, %rsp
+    .loc 1 184 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_256:
+.Lf1_258:
+    .loc 1 176 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_257
+.Lf1_255:
+    addq $8, %rsp
+    .loc 1 187 5
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_290
+    jmp .Lf1_289
+.Lf1_290:
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_289:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_291
+    .loc 1 188 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $5, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $16, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_292
+    jmp .Lf1_293
+.Lf1_292:
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf1_295
+    jmp .Lf1_296
+.Lf1_295:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_297
+.Lf1_296:
+    movslq -8(%rbp), %rax
+.Lf1_297:
+    jmp .Lf1_294
+.Lf1_293:
+    movslq -32(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_294:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 189 9
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_301
+    jmp .Lf1_302
+.Lf1_301:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_303
+.Lf1_302:
+    movq $98, %rax
+.Lf1_303:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_298
+    jmp .Lf1_299
+.Lf1_298:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_308
+    jmp .Lf1_307
+.Lf1_308:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_307:
+    cmpq $0, %rax
+    jne .Lf1_304
+    jmp .Lf1_305
+.Lf1_304:
+    movslq -76(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_306
+.Lf1_305:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_306:
+    jmp .Lf1_300
+.Lf1_299:
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_310
+    jmp .Lf1_309
+.Lf1_310:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_309:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_300:
+    movl %eax, -4(%rbp)
+    .loc 1 190 9
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_311
+    jmp .Lf1_312
+.Lf1_311:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_313
+.Lf1_312:
+    movslq -16(%rbp), %rax
+.Lf1_313:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_288
+.Lf1_291:
+    .loc 1 192 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_315
+    jmp .Lf1_314
+.Lf1_315:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_314:
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_320
+    jmp .Lf1_319
+.Lf1_320:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_319:
+    cmpq $0, %rax
+    jne .Lf1_316
+    jmp .Lf1_317
+.Lf1_316:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_322
+    jmp .Lf1_321
+.Lf1_322:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_321:
+    jmp .Lf1_318
+.Lf1_317:
+    movq $43, %rax
+    subq $68, %rax
+    movslq %eax, %rax
+.Lf1_318:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 193 9
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_323
+    jmp .Lf1_324
+.Lf1_323:
+    movslq -12(%rbp), %rax
+    subq $41, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_327
+    jmp .Lf1_326
+.Lf1_327:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_326:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_325
+.Lf1_324:
+    cmpl $22, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_329
+    jmp .Lf1_328
+.Lf1_329:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_331
+    jmp .Lf1_330
+.Lf1_331:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_330:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_328:
+.Lf1_325:
+    movl %eax, -12(%rbp)
+    .loc 1 194 9
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_333
+    jmp .Lf1_332
+.Lf1_333:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_332:
+    push %rax
+    movq $93, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movq $2, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_335
+    jmp .Lf1_334
+.Lf1_335:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_334:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_288:
+    .loc 1 196 5
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
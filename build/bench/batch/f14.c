@@ -0,0 +1,293 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 29;
+    int v2 = 40;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    a1[1][15] = (((v1 * v1) >= (v3 != v2)) - ((v1 != 81) || (v2 || 58)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v3 + 85) ? (79 || 7) : (v0 * 82)) >= ((64 ? v2 : a0[13]) < (a0[8] >= v0)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((a1[2][7] && a0[7]) > 61) break;
+                    a1[0][11] = (((0 ? v2 : a0[0]) || (i0 || i0)) == ((a1[3][4] < a0[3]) ? (v2 == 46) : (18 <= i0)));
+                    v1 = (((a0[9] != a0[4]) + (a0[4] >= v2)) ? ((a1[2][12] < a0[15]) / 4) : ((i0 + 8) != (80 != v2)));
+                    v3 = (((a0[4] ? v3 : 80) != (i0 + 3)) < ((i1 > a1[1][1]) != (i0 - v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[5] = (((a0[9] >= v2) > (i0 <= 88)) < ((57 + v3) > (v2 || v2)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v3 = (((v0 ? a0[2] : v0) + (a0[6] / 1)) % 8);
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v3 = (((v0 == 32) + (i3 != a1[2][8])) * ((i3 <= 11) ? (22 - 66) : (40 < 1)));
+                    v3 = (((i3 / 3) ? (61 >= a1[3][0]) : (v0 || v3)) % 4);
+                    v3 = (((v3 ? 87 : a1[1][5]) * (i3 || i3)) >= ((i2 < v2) && (v0 + i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((v2 != a1[1][3]) < (a0[5] != v0)) >= ((6 <= v0) > (v2 || i2)));
+            i2 = i2 + 1;
+        }
+    }
+    a1[3][0] = (((v2 * v3) == (v3 > v3)) > ((a0[5] + v0) <= (70 < 57)));
+    v1 = (((a0[3] != a1[1][3]) != (v3 ? v0 : a1[0][6])) || ((v1 != a1[0][13]) != (v0 <= a1[1][15])));
+    a0[12] = (((v2 == v2) > (v2 || 44)) > ((a0[8] < v3) == (v1 * v2)));
+    if ((((57 && v2) != (34 != v1)) + ((54 && v3) ? (28 / 5) : (v2 <= 88)))) {
+        v3 = (((v1 - 98) / 4) > ((v1 || v3) / 4));
+        v2 = (((52 <= v3) && (v3 != v2)) < ((68 > v3) >= (a1[2][15] ? v3 : 46)));
+        a1[0][14] = (((a0[1] || v2) * (a0[3] ? v2 : 4)) || ((v1 || a1[0][15]) || (v3 < 84)));
+    } else {
+        v1 = (((a1[1][14] % 1) - (v3 < v1)) % 8);
+        a0[11] = (((a0[12] + v2) ? (v0 + v1) : (v3 >= 49)) || ((26 * 44) != (v2 + v3)));
+        v3 = (((v2 >= 9) >= (27 + v0)) == ((v3 <= v1) >= (81 % 8)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v0 > i4) * (i4 / 6)) - ((59 && v3) > (v3 * a0[9])));
+            v2 = (((a0[9] != 23) && (i4 + v3)) - ((v2 < a1[2][6]) == (v2 && i4)));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    v2 = (((27 >= a0[1]) || (v2 && 81)) ? ((v0 / 1) >= (18 % 2)) : ((13 <= a1[3][13]) && (a1[2][10] % 4)));
+                    a1[3][11] = (((v2 ? a0[0] : v1) / 4) || ((v3 / 5) >= (43 <= v3)));
+                    v2 = (((25 < v2) ? (a0[14] >= a1[2][8]) : (a0[0] ? a1[2][11] : a1[3][7])) <= ((46 ? 88 : i4) < (v1 == a0[9])));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    v1 = (((67 <= v3) - (73 / 8)) == ((94 >= v1) || (v2 / 4)));
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v0 = (((34 < 50) < (v3 - i6)) ? ((a1[0][4] >= v0) < (71 * v2)) : ((a1[0][3] > v0) == (v0 - a0[1])));
+        {
+            int i7 = 0;
+            do {
+                v3 = (((i6 && i6) * (30 % 9)) ? ((32 != 72) >= (a1[2][0] ? v1 : v1)) : ((v3 != i6) > (v0 < 4)));
+                v1 = (((i6 / 6) <= (v0 <= 8)) < ((i6 ? a0[13] : 17) * (a0[4] >= 5)));
+                v3 = (((i6 != a0[3]) - (19 / 1)) ? ((a0[15] <= 12) >= (92 < v0)) : ((a0[8] && v1) == (i6 ? v2 : a1[1][4])));
+                i7 = i7 + 1;
+            } while (i7 < 2);
+        }
+        v2 = (((a1[3][11] <= v1) ? (v2 + 24) : (v3 && 20)) + ((19 >= 18) && (a1[2][7] / 8)));
+    }
+    return (((a0[4] % 3) != (2 + a0[5])) && ((a0[3] - a0[3]) == (v2 * 47)));
+}
+int f1() {
+    int v0 = 6;
+    int v1 = 68;
+    int v2 = 82;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            a1[3][6] = (((a0[4] ? v3 : v0) || (8 ? v0 : v2)) >= ((99 == v3) % 1));
+            a1[3][2] = (((v3 ? a1[1][6] : i0) == (v3 > v3)) || ((a1[0][11] < v3) >= (a0[5] % 1)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a0[5] = (((86 && 16) != (v3 - 46)) >= ((v0 || a1[2][15]) != (a1[2][1] == 63)));
+                    v3 = (((v3 / 5) < (83 == v1)) - ((i1 <= a0[2]) > (v2 % 8)));
+                    v1 = (((i0 * 84) || (a1[1][4] < i0)) <= ((a0[2] % 2) + (35 + 39)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 / 5) - (v2 < 95)) ? ((a0[11] < v1) + (v3 ? v3 : v2)) : ((a0[12] != v3) == (7 / 9)))) {
+        a1[2][11] = (((a1[1][9] != v3) > (a1[3][7] * v0)) ? ((v1 >= v1) < (87 % 6)) : ((v0 > v1) == (45 ? a1[3][12] : v3)));
+        v2 = (((v0 == v3) != (v0 != 36)) && ((v2 * 24) <= (v2 > 55)));
+        a1[1][7] = (((a0[5] || a1[2][7]) ? (v0 < 95) : (13 + v2)) ? ((a0[15] >= v3) <= (18 > v0)) : ((v3 || v3) % 3));
+    } else {
+        v0 = (((75 == v2) == (v0 / 3)) % 7);
+        v3 = (((a1[0][0] + 34) && (v0 ? v1 : v2)) && ((v1 ? a1[1][12] : v1) >= (a1[2][10] == a1[3][4])));
+        v0 = (((21 <= v3) == (69 + a0[9])) - ((83 <= v1) < (54 / 6)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v1 = (((i2 % 2) ? (38 <= 29) : (i2 % 6)) / 2);
+                v1 = (((78 / 5) > (a1[0][2] != a1[3][0])) + ((i3 != v2) - (71 - 28)));
+                a0[8] = (((v2 <= v3) % 6) == ((i2 - v1) ? (v0 ? a1[2][1] : v3) : (a0[12] % 9)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[13] = (((v2 ? v0 : a1[1][11]) != (a1[2][2] <= a1[1][7])) >= ((v2 == a1[3][0]) ? (i2 % 7) : (v2 == 27)));
+        a1[1][15] = (((36 ? i2 : v3) % 6) == ((41 ? 70 : 13) ? (a0[10] - a1[2][14]) : (a1[1][0] <= 84)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a1[1][7] = (((v1 > v0) * (a1[1][13] + a0[13])) > ((i4 < 74) - (5 != a0[14])));
+                a0[8] = (((a0[15] - a0[7]) == (v1 ? v2 : 93)) - ((v0 ? v0 : v0) != (44 < v2)));
+                a0[1] = (((a0[14] ? a1[3][7] : v2) <= (i4 && v3)) % 5);
+            }
+            a1[0][15] = (((v1 > a0[14]) * (v0 < 71)) * ((v2 * v3) + (31 != i4)));
+            a1[2][8] = (((42 / 4) ? (v3 > v2) : (74 && a1[3][14])) % 3);
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    if ((((v3 == a1[3][6]) < (v3 == v3)) ? ((v2 || 24) <= (v2 + v0)) : ((a1[1][7] + 82) ? (a1[2][12] / 3) : (82 || v3)))) {
+        v3 = (((75 > v2) < (v0 > 92)) == ((83 ? 26 : v2) && (a0[2] < 90)));
+        a0[1] = (((48 + a1[3][14]) + (v2 % 4)) <= ((v3 + v2) >= (v1 - a0[7])));
+        a1[0][4] = (((17 * 59) - (v1 > 46)) >= ((28 < 37) || (25 / 6)));
+    } else {
+        a0[9] = (((73 / 2) * (v2 <= 86)) > ((v1 + a0[3]) / 6));
+        v2 = (((64 > 36) || (v1 - v0)) ? ((v2 / 3) % 5) : ((13 ? v3 : a1[1][2]) ? (a0[14] >= a0[14]) : (a1[3][0] >= v0)));
+        a0[9] = (((a1[1][6] >= v0) == (v0 != v2)) - ((v0 && v1) + (a1[3][1] / 4)));
+    }
+    a1[3][4] = (((a1[3][14] ? a0[0] : v0) > (v2 ? a1[1][11] : a0[14])) / 2);
+    a0[13] = (((v3 + 61) < (v3 >= 15)) && ((51 || 66) <= (a0[2] || v0)));
+    v2 = (((a0[10] < a1[0][10]) > (a1[0][13] / 4)) == ((a1[1][11] <= v3) && (v2 > v2)));
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((v2 ? v1 : a1[1][11]) > 86) break;
+            v3 = (((a1[1][6] * v3) >= (a1[0][7] ? a0[8] : 93)) || ((a0[12] / 4) != (v1 / 6)));
+            v0 = (((a0[8] == v1) - (v1 && v1)) ? ((a1[2][13] ? 60 : 17) <= (a1[1][12] - v1)) : ((i6 <= 64) ? (a0[0] - v2) : (a0[1] && v0)));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                a1[0][12] = (((v0 % 6) + (73 && v0)) || ((v3 >= a0[1]) >= (i6 / 8)));
+                v1 = (((a0[8] + v1) - (v0 <= v2)) != ((a0[12] > v2) - (v2 ? i7 : i7)));
+                v1 = (((a0[4] == 5) <= (v1 > v3)) % 2);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v2 = (((v2 != v0) > (26 % 3)) / 3);
+    return (((57 / 3) % 2) * ((v3 % 3) + (v3 / 2)));
+}
+int f2() {
+    int v0 = 92;
+    int v1 = 54;
+    int v2 = 60;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 ? v2 : 83) >= (v3 == a1[2][14])) && ((28 <= a0[8]) / 1))) {
+        v0 = (((a1[3][15] > v1) > (a1[1][13] > 10)) + ((v3 ? 34 : v3) / 9));
+        v2 = (((v0 || v1) || (a0[10] && v2)) != ((v3 % 2) >= (v1 ? v2 : a0[5])));
+        a1[3][6] = (((v3 <= v3) + (v2 % 1)) < ((52 && a0[10]) % 8));
+    } else {
+        v1 = (((43 * 50) >= (v1 != v1)) > ((v0 <= 98) - (a0[6] >= 98)));
+        a0[14] = (((v3 == v2) <= (99 - a0[5])) == ((v3 || a0[11]) % 3));
+        v0 = (((v3 || v0) != (v0 - 57)) != ((v2 <= 40) / 5));
+    }
+    if ((((3 > 75) * (v0 + v2)) / 1)) {
+        v3 = (((v3 * v1) / 8) * ((v2 - a1[1][0]) ? (a1[0][9] ? a0[0] : v3) : (v3 <= 72)));
+        v0 = (((v1 != v2) != (70 >= v2)) ? ((a1[1][5] % 2) > (v0 < v1)) : ((a0[5] == v2) != (v0 || 75)));
+        a1[2][12] = (((a0[13] && a0[0]) % 5) && ((73 ? v3 : v3) != (77 - v0)));
+    } else {
+        v3 = (((v2 / 7) / 7) < ((v3 > 60) / 6));
+        a1[3][7] = (((v0 || v2) < (a0[3] >= 99)) < ((97 < a1[1][2]) != (a1[1][14] % 2)));
+        a0[8] = (((v3 + v0) != (v3 ? 34 : 25)) > ((a1[0][13] > a1[1][14]) == (81 < v1)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v0 = (((v1 || v3) > (v3 <= 76)) / 8);
+        {
+            int i1 = 0;
+            do {
+                v2 = (((a1[1][6] / 9) || (48 && v2)) - ((v0 * 79) ? (47 * a0[4]) : (v0 != a1[3][6])));
+                v2 = (((v1 || a1[3][8]) - (v3 >= a0[5])) != ((25 <= v3) || (v2 == v0)));
+                v1 = (((v3 / 7) <= (v2 < a0[6])) / 9);
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        a0[9] = (((v2 - v3) > (a1[2][14] ? a0[10] : v2)) <= ((4 <= a1[2][12]) ? (v3 + v1) : (v3 && 9)));
+    }
+    a0[12] = (((44 ? 98 : 3) != (a1[3][13] + 6)) % 2);
+    if ((((v1 != v2) * (v1 == 97)) / 8)) {
+        v3 = (((v1 / 1) - (a0[0] > a0[1])) / 2);
+        v3 = (((75 ? a0[13] : a1[2][10]) + (v1 && v1)) < ((3 ? v0 : a1[1][15]) ? (v0 == 38) : (v3 != v2)));
+        v1 = (((9 % 9) && (a1[1][15] + v2)) ? ((v3 >= v3) < (3 && v1)) : ((v0 > a1[2][10]) * (v3 && v0)));
+    } else {
+        v0 = (((a1[1][1] >= v0) <= (50 / 5)) || ((v1 + v2) > (v3 < v3)));
+        v3 = (((v2 % 9) && (v2 && v2)) && ((v3 || a0[13]) != (a1[0][11] ? a1[1][12] : a1[1][12])));
+        v3 = (((v3 * v1) && (34 % 2)) / 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((5 * i2) > 97) break;
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v2 = (((v1 >= i2) >= (a1[0][4] - a1[1][8])) == ((a1[2][3] && a0[3]) < (v1 == a1[3][9])));
+                v2 = (((v2 ? a0[11] : a0[6]) / 2) / 9);
+                a1[1][7] = (((a0[13] - a0[10]) > (a1[0][9] ? 66 : v3)) || ((a0[5] % 2) > (a0[3] % 1)));
+            }
+            a0[11] = (((v2 * 72) - (a0[3] * 45)) < ((a1[0][11] >= v2) && (32 ? a1[2][12] : 71)));
+            v0 = (((48 * v1) <= (a0[15] - 31)) > ((89 * a1[1][14]) || (a1[3][5] != v1)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v1 = (((14 == v0) - (a0[5] + v3)) * ((v1 > v0) + (v1 < a0[8])));
+        {
+            int i5 = 0;
+            do {
+                if ((v3 ? i5 : 16) > 76) break;
+                v2 = (((v2 ? v0 : v2) || (49 == v3)) * ((a0[10] <= i5) - (a0[15] < a1[1][12])));
+                v3 = (((v3 > a1[2][1]) % 8) * ((v3 != i5) < (a0[10] - v1)));
+                v3 = (((a0[13] ? a0[12] : v3) && (i4 - a1[0][2])) || ((v2 + v0) <= (43 || a0[7])));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        v2 = (((v3 < a0[15]) > (a0[11] / 9)) * ((i4 > 41) + (v0 * i4)));
+    }
+    v1 = (((v1 <= v1) / 4) <= ((v1 / 4) + (v0 >= 76)));
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            a0[11] = (((v2 == v1) || (i6 < 51)) == ((v2 != v0) < (v0 % 7)));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((i7 <= v0) < (18 % 6)) ? ((v1 ? 14 : v0) / 6) : ((v2 / 2) - (a1[3][1] || v0)));
+                    a0[0] = (((37 <= i7) || (a0[4] == a1[2][11])) < ((a1[1][2] <= a1[0][13]) ? (47 % 7) : (a1[0][11] % 6)));
+                    v3 = (((v3 % 4) || (v0 || a0[10])) * ((a0[9] >= 94) / 7));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            a0[13] = (((v2 > a0[2]) ? (a0[13] ? a1[0][13] : v3) : (v2 <= v3)) <= ((75 - a0[9]) - (a1[2][14] <= v1)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        v3 = (((v3 % 3) >= (i8 >= i8)) ? ((i8 >= v0) ? (v2 - i8) : (38 ? 52 : a0[8])) : ((68 + a0[0]) > (14 ? i8 : 17)));
+        {
+            int i9 = 0;
+            do {
+                if ((a0[5] >= v1) > 68) break;
+                a0[7] = (((a0[9] > i9) / 8) ? ((v0 + a1[3][0]) || (a1[1][12] ? a1[0][12] : 39)) : ((v2 - v1) >= (99 >= a0[12])));
+                v1 = (((i8 != 38) / 5) % 2);
+                v2 = (((i8 ? 24 : a1[0][11]) + (42 >= i9)) == ((a1[1][1] && 95) - (24 == a1[3][8])));
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+        a1[3][0] = (((i8 || a1[3][6]) != (a0[8] + 72)) || ((v2 != v0) && (a1[3][8] == 52)));
+    }
+    return (((v3 > v1) != (a1[2][9] || v1)) * ((v1 > a0[11]) * (a1[2][2] || 15)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
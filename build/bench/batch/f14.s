@@ -0,0 +1,6622 @@
+    .file 1 "build/bench/batch/f14.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 287 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 288 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 289 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 290 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 291 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 292 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $32, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $29, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $40, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $73, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    cmpl $81, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_2
+    jmp .Lf0_1
+.Lf0_2:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_4
+    jmp .Lf0_3
+.Lf0_4:
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_3:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_1:
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 11 9
+    .p2align 4,,10
+.Lf0_7:
+    .loc 1 12 13
+    movslq -16(%rbp), %rax
+    addq $85, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_9
+.Lf0_8:
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_12
+    jmp .Lf0_11
+.Lf0_12:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_11:
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -4(%rbp), %rax
+    imulq $82, %rax
+    movslq %eax, %rax
+.Lf0_10:
+    push %rax
+    movq $64, %rax
+    cmpq $0, %rax
+    jne .Lf0_13
+    jmp .Lf0_14
+.Lf0_13:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_15
+.Lf0_14:
+    movslq -28(%rbp), %rax
+.Lf0_15:
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 14 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 15 17
+    jmp .Lf0_19
+    .p2align 4,,10
+.Lf0_18:
+    .loc 1 16 21
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_21
+.Lf0_22:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_21:
+    cmpq $61, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_20
+    jmp .Lf0_16
+.Lf0_20:
+    .loc 1 17 21
+    movq $0, %rax
+    cmpq $0, %rax
+    jne .Lf0_23
+    jmp .Lf0_24
+.Lf0_23:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_25
+.Lf0_24:
+    movslq -80(%rbp), %rax
+.Lf0_25:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_27
+    jmp .Lf0_26
+.Lf0_27:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_29
+    jmp .Lf0_28
+.Lf0_29:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_28:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_26:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_31
+.Lf0_30:
+    cmpl $46, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_32
+.Lf0_31:
+    movq $18, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_32:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 18 21
+    movslq -64(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_33
+    jmp .Lf0_34
+.Lf0_33:
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_35
+.Lf0_34:
+    movslq -340(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_35:
+    movl %eax, -8(%rbp)
+    .loc 1 19 21
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_36
+    jmp .Lf0_37
+.Lf0_36:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_38
+.Lf0_37:
+    movq $80, %rax
+.Lf0_38:
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $3, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 20 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_17:
+.Lf0_19:
+    .loc 1 15 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_18
+.Lf0_16:
+    addq $0, %rsp
+    .loc 1 23 13
+    movslq -44(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $88, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $57, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_40
+    jmp .Lf0_39
+.Lf0_40:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_39:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -60(%rbp)
+    .loc 1 24 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_6:
+    .loc 1 25 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_7
+.Lf0_5:
+    addq $8, %rsp
+    .loc 1 28 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 29 9
+    jmp .Lf0_44
+    .p2align 4,,10
+.Lf0_43:
+    .loc 1 30 13
+    movq $8, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_45
+    jmp .Lf0_46
+.Lf0_45:
+    movslq -72(%rbp), %rax
+    jmp .Lf0_47
+.Lf0_46:
+    movslq -4(%rbp), %rax
+.Lf0_47:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 32 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 33 17
+    jmp .Lf0_51
+    .p2align 4,,10
+.Lf0_50:
+    .loc 1 34 21
+    cmpl $11, -344(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_52
+    jmp .Lf0_53
+.Lf0_52:
+    movq $22, %rax
+    subq $66, %rax
+    movslq %eax, %rax
+    jmp .Lf0_54
+.Lf0_53:
+    movq $40, %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setl %al
+.Lf0_54:
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $32, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 35 21
+    movq $4, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_56
+.Lf0_55:
+    movq $61, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_59
+    jmp .Lf0_58
+.Lf0_59:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_58:
+.Lf0_57:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 36 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_61
+    jmp .Lf0_60
+.Lf0_61:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_60:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_63
+.Lf0_62:
+    movq $87, %rax
+    jmp .Lf0_64
+.Lf0_63:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf0_64:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_66
+    jmp .Lf0_65
+.Lf0_66:
+    movslq -4(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_65:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 37 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_49:
+.Lf0_51:
+    .loc 1 33 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_50
+.Lf0_48:
+    addq $0, %rsp
+    .loc 1 40 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_68
+    jmp .Lf0_67
+.Lf0_68:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_67:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 41 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_42:
+.Lf0_44:
+    .loc 1 29 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_43
+.Lf0_41:
+    addq $8, %rsp
+    .loc 1 44 5
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -60(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $70, %rax
+    cmpq $57, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 45 5
+    movslq -68(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_69
+    jmp .Lf0_70
+.Lf0_69:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_71
+.Lf0_70:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_71:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_73
+    jmp .Lf0_72
+.Lf0_73:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_72:
+    movl %eax, -8(%rbp)
+    .loc 1 46 5
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_75
+    jmp .Lf0_74
+.Lf0_75:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_74:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -32(%rbp)
+    .loc 1 47 5
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_81
+    jmp .Lf0_80
+.Lf0_81:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_80:
+    cmpq $0, %rax
+    jne .Lf0_77
+    jmp .Lf0_78
+.Lf0_77:
+    movq $5, %rax
+    push %rax
+    movq $28, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_79
+.Lf0_78:
+    cmpl $88, -12(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf0_79:
+    push %rax
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_82
+.Lf0_83:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_82:
+    push %rax
+    movq $34, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_84
+    .loc 1 48 9
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $98, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_86
+    jmp .Lf0_85
+.Lf0_86:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_85:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 49 9
+    movq $52, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_87
+.Lf0_88:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_87:
+    push %rax
+    movq $68, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_91
+.Lf0_90:
+    movq $46, %rax
+.Lf0_91:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 50 9
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_93
+.Lf0_92:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_94
+.Lf0_93:
+    movq $4, %rax
+.Lf0_94:
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_96
+    jmp .Lf0_95
+.Lf0_96:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_95:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_100
+    jmp .Lf0_99
+.Lf0_100:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_99:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_102
+    jmp .Lf0_101
+.Lf0_102:
+    cmpl $84, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_101:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_76
+.Lf0_84:
+    .loc 1 52 9
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 53 9
+    movslq -32(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_104
+.Lf0_103:
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_105
+.Lf0_104:
+    cmpl $49, -16(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_105:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_107
+    jmp .Lf0_106
+.Lf0_107:
+    movq $26, %rax
+    imulq $44, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_106:
+    movl %eax, -36(%rbp)
+    .loc 1 54 9
+    cmpl $9, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $27, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_76:
+    .loc 1 57 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 58 9
+    .p2align 4,,10
+.Lf0_110:
+    .loc 1 59 13
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_112
+    jmp .Lf0_111
+.Lf0_112:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_111:
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 60 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_113
+.Lf0_114:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_113:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $23, -44(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_116
+    jmp .Lf0_115
+.Lf0_116:
+    movslq -340(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_115:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 62 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 63 17
+    jmp .Lf0_120
+    .p2align 4,,10
+.Lf0_119:
+    .loc 1 64 21
+    movq $27, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_125
+    jmp .Lf0_124
+.Lf0_125:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    movq $81, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_124:
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_122
+.Lf0_121:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $18, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_123
+.Lf0_122:
+    movq $13, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+.Lf0_123:
+    movl %eax, -12(%rbp)
+    .loc 1 65 21
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_131
+.Lf0_130:
+    movslq -80(%rbp), %rax
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -8(%rbp), %rax
+.Lf0_132:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_134
+    jmp .Lf0_133
+.Lf0_134:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $43, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_133:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 66 21
+    movq $25, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_135
+    jmp .Lf0_136
+.Lf0_135:
+    movslq -24(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_140
+.Lf0_139:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_140:
+.Lf0_137:
+    push %rax
+    movq $46, %rax
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    movq $88, %rax
+    jmp .Lf0_143
+.Lf0_142:
+    movslq -340(%rbp), %rax
+.Lf0_143:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 67 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_118:
+.Lf0_120:
+    .loc 1 63 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_119
+.Lf0_117:
+    addq $0, %rsp
+    .loc 1 70 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_109:
+    .loc 1 71 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_110
+.Lf0_108:
+    addq $8, %rsp
+    .loc 1 73 5
+    movq $8, %rax
+    push %rax
+    movq $73, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $67, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $94, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 74 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_151
+    .p2align 4,,10
+.Lf0_150:
+    .loc 1 75 9
+    movq $34, %rax
+    cmpq $50, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_152
+    jmp .Lf0_153
+.Lf0_152:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $71, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_154
+.Lf0_153:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_154:
+    movl %eax, -4(%rbp)
+    .loc 1 77 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 78 13
+    .p2align 4,,10
+.Lf0_157:
+    .loc 1 79 17
+    movq $9, %rax
+    push %rax
+    movq $30, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_162
+    jmp .Lf0_161
+.Lf0_162:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_161:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_158
+    jmp .Lf0_159
+.Lf0_158:
+    movq $32, %rax
+    cmpq $72, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_164
+.Lf0_163:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_165
+.Lf0_164:
+    movslq -8(%rbp), %rax
+.Lf0_165:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_160
+.Lf0_159:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $4, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_160:
+    movl %eax, -16(%rbp)
+    .loc 1 80 17
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $8, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $5, -64(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_166
+    jmp .Lf0_167
+.Lf0_166:
+    movslq -28(%rbp), %rax
+    jmp .Lf0_168
+.Lf0_167:
+    movq $17, %rax
+.Lf0_168:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 81 17
+    movq $1, %rax
+    push %rax
+    movq $19, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_169
+    jmp .Lf0_170
+.Lf0_169:
+    cmpl $12, -20(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $92, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_171
+.Lf0_170:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_172
+.Lf0_173:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_172:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_175
+.Lf0_174:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_176
+.Lf0_175:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf0_176:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_171:
+    movl %eax, -16(%rbp)
+    .loc 1 82 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_156:
+    .loc 1 83 22
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_157
+.Lf0_155:
+    addq $0, %rsp
+    .loc 1 85 9
+    movq $19, %rax
+    cmpq $18, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -12(%rbp), %rax
+    addq $24, %rax
+    movslq %eax, %rax
+    jmp .Lf0_181
+.Lf0_180:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_183
+    jmp .Lf0_182
+.Lf0_183:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_182:
+.Lf0_181:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_149:
+    .loc 1 74 30
+    incl -340(%rbp)
+.Lf0_151:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_150
+.Lf0_148:
+    addq $8, %rsp
+    .loc 1 87 5
+    movq $3, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_184
+.Lf0_185:
+    movslq -68(%rbp), %rax
+    subl -68(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $47, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_184:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 89 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 90 5
+    subq $8, %rsp
+    movq $6, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 91 5
+    movq $68, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 92 5
+    subq $8, %rsp
+    movq $82, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 93 5
+    movq $19, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 94 5
+    subq $64, %rsp
+    .loc 1 95 5
+    subq $256, %rsp
+    .loc 1 97 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 98 9
+    jmp .Lf1_4
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 99 13
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_5
+    jmp .Lf1_6
+.Lf1_5:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_7
+.Lf1_6:
+    movslq -4(%rbp), %rax
+.Lf1_7:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_9
+    jmp .Lf1_8
+.Lf1_9:
+    movq $8, %rax
+    cmpq $0, %rax
+    jne .Lf1_10
+    jmp .Lf1_11
+.Lf1_10:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_12
+.Lf1_11:
+    movslq -12(%rbp), %rax
+.Lf1_12:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_8:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $99, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 100 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_13
+    jmp .Lf1_14
+.Lf1_13:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_15
+.Lf1_14:
+    movslq -340(%rbp), %rax
+.Lf1_15:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_17
+    jmp .Lf1_16
+.Lf1_17:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_16:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 102 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 103 17
+    jmp .Lf1_21
+    .p2align 4,,10
+.Lf1_20:
+    .loc 1 104 21
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_22
+.Lf1_23:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_22:
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $46, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_25
+    jmp .Lf1_24
+.Lf1_25:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_24:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $63, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -60(%rbp)
+    .loc 1 105 21
+    movslq -344(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $83, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 106 21
+    movslq -340(%rbp), %rax
+    imulq $84, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_27
+    jmp .Lf1_26
+.Lf1_27:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_26:
+    push %rax
+    movq $35, %rax
+    addq $39, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 107 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_19:
+.Lf1_21:
+    .loc 1 103 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_20
+.Lf1_18:
+    addq $0, %rsp
+    .loc 1 110 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+.Lf1_4:
+    .loc 1 98 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 113 5
+    cmpl $95, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_29
+    jmp .Lf1_30
+.Lf1_29:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_32
+    jmp .Lf1_33
+.Lf1_32:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_34
+.Lf1_33:
+    movslq -12(%rbp), %rax
+.Lf1_34:
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_31
+.Lf1_30:
+    movslq -32(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_31:
+    cmpq $0, %rax
+    je .Lf1_35
+    .loc 1 114 9
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_36
+    jmp .Lf1_37
+.Lf1_36:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $87, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_38
+.Lf1_37:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $45, %rax
+    cmpq $0, %rax
+    jne .Lf1_39
+    jmp .Lf1_40
+.Lf1_39:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf1_41
+.Lf1_40:
+    movslq -16(%rbp), %rax
+.Lf1_41:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_38:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 115 9
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $36, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_43
+    jmp .Lf1_42
+.Lf1_43:
+    movslq -12(%rbp), %rax
+    imulq $24, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $55, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_42:
+    movl %eax, -12(%rbp)
+    .loc 1 116 9
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_48
+.Lf1_47:
+    cmpl $95, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_49
+.Lf1_48:
+    movq $13, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_49:
+    cmpq $0, %rax
+    jne .Lf1_44
+    jmp .Lf1_45
+.Lf1_44:
+    movslq -20(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $18, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_46
+.Lf1_45:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_53
+    jmp .Lf1_52
+.Lf1_53:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_52:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_46:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_28
+.Lf1_35:
+    .loc 1 118 9
+    movq $7, %rax
+    push %rax
+    movq $75, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 119 9
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    addq $34, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_55
+    jmp .Lf1_54
+.Lf1_55:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_57
+.Lf1_56:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_58
+.Lf1_57:
+    movslq -12(%rbp), %rax
+.Lf1_58:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_54:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_60
+    jmp .Lf1_59
+.Lf1_60:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_61
+    jmp .Lf1_62
+.Lf1_61:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf1_63
+.Lf1_62:
+    movslq -8(%rbp), %rax
+.Lf1_63:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_59:
+    movl %eax, -16(%rbp)
+    .loc 1 120 9
+    movq $83, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $21, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $69, %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_28:
+    .loc 1 122 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_69
+    .p2align 4,,10
+.Lf1_68:
+    .loc 1 124 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 125 13
+    jmp .Lf1_73
+    .p2align 4,,10
+.Lf1_72:
+    .loc 1 126 17
+    movq $2, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_74
+    jmp .Lf1_75
+.Lf1_74:
+    movq $38, %rax
+    cmpq $29, %rax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_76
+.Lf1_75:
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_76:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 127 17
+    movq $71, %rax
+    subq $28, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $78, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 128 17
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_77
+    jmp .Lf1_78
+.Lf1_77:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_81
+.Lf1_80:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf1_82
+.Lf1_81:
+    movslq -16(%rbp), %rax
+.Lf1_82:
+    jmp .Lf1_79
+.Lf1_78:
+    movq $9, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_79:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -48(%rbp)
+    .loc 1 129 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_71:
+.Lf1_73:
+    .loc 1 125 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_72
+.Lf1_70:
+    addq $0, %rsp
+    .loc 1 132 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_83
+    jmp .Lf1_84
+.Lf1_83:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_85
+.Lf1_84:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_85:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_86
+    jmp .Lf1_87
+.Lf1_86:
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_88
+.Lf1_87:
+    cmpl $27, -12(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_88:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -28(%rbp)
+    .loc 1 133 9
+    movq $6, %rax
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf1_89
+    jmp .Lf1_90
+.Lf1_89:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_91
+.Lf1_90:
+    movslq -16(%rbp), %rax
+.Lf1_91:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf1_95
+    jmp .Lf1_96
+.Lf1_95:
+    movq $70, %rax
+    jmp .Lf1_97
+.Lf1_96:
+    movq $13, %rax
+.Lf1_97:
+    cmpq $0, %rax
+    jne .Lf1_92
+    jmp .Lf1_93
+.Lf1_92:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_94
+.Lf1_93:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    setle %al
+.Lf1_94:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_67:
+    .loc 1 122 30
+    incl -340(%rbp)
+.Lf1_69:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_68
+.Lf1_66:
+    addq $8, %rsp
+    .loc 1 136 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 137 9
+    .p2align 4,,10
+.Lf1_100:
+    .loc 1 138 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_106
+    .p2align 4,,10
+.Lf1_105:
+    .loc 1 139 17
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $74, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 140 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_107
+    jmp .Lf1_108
+.Lf1_107:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_109
+.Lf1_108:
+    movslq -4(%rbp), %rax
+.Lf1_109:
+    push %rax
+    movq $44, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -20(%rbp), %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_111
+.Lf1_110:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_112
+.Lf1_111:
+    movq $93, %rax
+.Lf1_112:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    .loc 1 141 17
+    movq $5, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_113
+    jmp .Lf1_114
+.Lf1_113:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf1_115
+.Lf1_114:
+    movslq -12(%rbp), %rax
+.Lf1_115:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_117
+    jmp .Lf1_116
+.Lf1_117:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_116:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    addq $0, %rsp
+.Lf1_104:
+    .loc 1 138 38
+    incl -344(%rbp)
+.Lf1_106:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_105
+.Lf1_103:
+    addq $0, %rsp
+    .loc 1 143 13
+    movq $31, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $71, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 144 13
+    movq $3, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $42, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_119
+.Lf1_118:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_120
+.Lf1_119:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_121
+.Lf1_122:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_121:
+.Lf1_120:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 145 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_99:
+    .loc 1 146 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_100
+.Lf1_98:
+    addq $8, %rsp
+    .loc 1 148 5
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_124
+    jmp .Lf1_125
+.Lf1_124:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_128
+    jmp .Lf1_127
+.Lf1_128:
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_127:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_126
+.Lf1_125:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    addq $82, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_129
+    jmp .Lf1_130
+.Lf1_129:
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_131
+.Lf1_130:
+    movq $82, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_133
+    jmp .Lf1_132
+.Lf1_133:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_132:
+.Lf1_131:
+.Lf1_126:
+    cmpq $0, %rax
+    je .Lf1_134
+    .loc 1 149 9
+    movq $75, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $92, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $83, %rax
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_136
+.Lf1_135:
+    movq $26, %rax
+    jmp .Lf1_137
+.Lf1_136:
+    movslq -12(%rbp), %rax
+.Lf1_137:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_139
+    jmp .Lf1_138
+.Lf1_139:
+    cmpl $90, -72(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_138:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 150 9
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $48, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -76(%rbp)
+    .loc 1 151 9
+    cmpl $46, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $17, %rax
+    imulq $59, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $28, %rax
+    cmpq $37, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_141
+    jmp .Lf1_140
+.Lf1_141:
+    movq $6, %rax
+    push %rax
+    movq $25, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_140:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_123
+.Lf1_134:
+    .loc 1 153 9
+    cmpl $86, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $73, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -44(%rbp)
+    .loc 1 154 9
+    movq $64, %rax
+    cmpq $36, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_146
+    jmp .Lf1_145
+.Lf1_146:
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_145:
+    cmpq $0, %rax
+    jne .Lf1_142
+    jmp .Lf1_143
+.Lf1_142:
+    movq $5, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_144
+.Lf1_143:
+    movq $13, %rax
+    cmpq $0, %rax
+    jne .Lf1_150
+    jmp .Lf1_151
+.Lf1_150:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_152
+.Lf1_151:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf1_152:
+    cmpq $0, %rax
+    jne .Lf1_147
+    jmp .Lf1_148
+.Lf1_147:
+    movslq -24(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_149
+.Lf1_148:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_149:
+.Lf1_144:
+    movl %eax, -12(%rbp)
+    .loc 1 155 9
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_154
+    jmp .Lf1_153
+.Lf1_154:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_153:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf1_123:
+    .loc 1 157 5
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_155
+    jmp .Lf1_156
+.Lf1_155:
+    movslq -80(%rbp), %rax
+    jmp .Lf1_157
+.Lf1_156:
+    movslq -4(%rbp), %rax
+.Lf1_157:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_158
+    jmp .Lf1_159
+.Lf1_158:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf1_160
+.Lf1_159:
+    movslq -24(%rbp), %rax
+.Lf1_160:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 158 5
+    movslq -16(%rbp), %rax
+    addq $61, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $15, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_161
+.Lf1_162:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_164
+    jmp .Lf1_163
+.Lf1_164:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_163:
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_161:
+    movl %eax, -28(%rbp)
+    .loc 1 159 5
+    movslq -40(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_168
+    jmp .Lf1_167
+.Lf1_168:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_167:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 161 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 162 9
+    jmp .Lf1_172
+    .p2align 4,,10
+.Lf1_171:
+    .loc 1 163 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_174
+    jmp .Lf1_175
+.Lf1_174:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_176
+.Lf1_175:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_176:
+    cmpq $86, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_173
+    jmp .Lf1_169
+.Lf1_173:
+    .loc 1 164 13
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_177
+    jmp .Lf1_178
+.Lf1_177:
+    movslq -48(%rbp), %rax
+    jmp .Lf1_179
+.Lf1_178:
+    movq $93, %rax
+.Lf1_179:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_181
+    jmp .Lf1_180
+.Lf1_181:
+    movq $4, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_180:
+    movl %eax, -16(%rbp)
+    .loc 1 165 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_185
+.Lf1_186:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_185:
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_182
+    jmp .Lf1_183
+.Lf1_182:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_187
+    jmp .Lf1_188
+.Lf1_187:
+    movq $60, %rax
+    jmp .Lf1_189
+.Lf1_188:
+    movq $17, %rax
+.Lf1_189:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_184
+.Lf1_183:
+    cmpl $64, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_190
+    jmp .Lf1_191
+.Lf1_190:
+    movslq -80(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_192
+.Lf1_191:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_194
+    jmp .Lf1_193
+.Lf1_194:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_193:
+.Lf1_192:
+.Lf1_184:
+    movl %eax, -4(%rbp)
+    .loc 1 166 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_200
+    .p2align 4,,10
+.Lf1_199:
+    .loc 1 167 17
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_205
+    jmp .Lf1_204
+.Lf1_205:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_204:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_207
+    jmp .Lf1_206
+.Lf1_207:
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_206:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 168 17
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -48(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_208
+    jmp .Lf1_209
+.Lf1_208:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_210
+.Lf1_209:
+    movslq -344(%rbp), %rax
+.Lf1_210:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 169 17
+    movq $2, %rax
+    push %rax
+    cmpl $5, -64(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_203:
+    .loc 1 166 38
+    incl -344(%rbp)
+    .loc 1 167 17
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_211
+.Lf1_212:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_211:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_214
+    jmp .Lf1_213
+.Lf1_214:
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_213:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 168 17
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -48(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_215
+    jmp .Lf1_216
+.Lf1_215:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -344(%rbp), %rax
+.Lf1_217:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 169 17
+    movq $2, %rax
+    push %rax
+    cmpl $5, -64(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_202:
+    .loc 1 166 38
+    incl -344(%rbp)
+.Lf1_200:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $7, %rax
+    jl .Lf1_199
+.Lf1_201:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_197
+    .loc 1 167 17
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_219
+    jmp .Lf1_218
+.Lf1_219:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_218:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_221
+    jmp .Lf1_220
+.Lf1_221:
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_220:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 168 17
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -48(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_222
+    jmp .Lf1_223
+.Lf1_222:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_224
+.Lf1_223:
+    movslq -344(%rbp), %rax
+.Lf1_224:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 169 17
+    movq $2, %rax
+    push %rax
+    cmpl $5, -64(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_198:
+    .loc 1 166 38
+    incl -344(%rbp)
+    jmp .Lf1_201
+.Lf1_197:
+    addq $0, %rsp
+    .loc 1 171 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_170:
+.Lf1_172:
+    .loc 1 162 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_171
+.Lf1_169:
+    addq $8, %rsp
+    .loc 1 174 5
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 175 5
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $57, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 177 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 178 5
+    subq $8, %rsp
+    movq $92, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 179 5
+    movq $54, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 180 5
+    subq $8, %rsp
+    movq $60, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 181 5
+    movq $89, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 182 5
+    subq $64, %rsp
+    .loc 1 183 5
+    subq $256, %rsp
+    .loc 1 184 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_2
+    jmp .Lf2_3
+.Lf2_2:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_4
+.Lf2_3:
+    movq $83, %rax
+.Lf2_4:
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_6
+    jmp .Lf2_5
+.Lf2_6:
+    movq $1, %rax
+    push %rax
+    movq $28, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_5:
+    cmpq $0, %rax
+    je .Lf2_7
+    .loc 1 185 9
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_8
+    jmp .Lf2_9
+.Lf2_8:
+    movq $34, %rax
+    jmp .Lf2_10
+.Lf2_9:
+    movslq -16(%rbp), %rax
+.Lf2_10:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 186 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_12
+    jmp .Lf2_11
+.Lf2_12:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_11:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_14
+    jmp .Lf2_13
+.Lf2_14:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_16
+    jmp .Lf2_15
+.Lf2_16:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_15:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_13:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_17
+    jmp .Lf2_18
+.Lf2_17:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_19
+.Lf2_18:
+    movslq -60(%rbp), %rax
+.Lf2_19:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 187 9
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_21
+    jmp .Lf2_20
+.Lf2_21:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_20:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_1
+.Lf2_7:
+    .loc 1 189 9
+    movq $43, %rax
+    imulq $50, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $98, -56(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $98, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 190 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $99, %rax
+    subl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_23
+    jmp .Lf2_22
+.Lf2_23:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_22:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -24(%rbp)
+    .loc 1 191 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_25
+    jmp .Lf2_24
+.Lf2_25:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_24:
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $57, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    cmpl $40, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_1:
+    .loc 1 193 5
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    cmpq $75, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_27
+    .loc 1 194 9
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_28
+    jmp .Lf2_29
+.Lf2_28:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_32
+.Lf2_31:
+    movslq -80(%rbp), %rax
+    jmp .Lf2_33
+.Lf2_32:
+    movslq -16(%rbp), %rax
+.Lf2_33:
+    jmp .Lf2_30
+.Lf2_29:
+    cmpl $72, -16(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf2_30:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 195 9
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $70, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_34
+    jmp .Lf2_35
+.Lf2_34:
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_36
+.Lf2_35:
+    movslq -60(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_38
+    jmp .Lf2_37
+.Lf2_38:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_37:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_36:
+    movl %eax, -4(%rbp)
+    .loc 1 196 9
+    movq $5, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_40
+    jmp .Lf2_39
+.Lf2_40:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_39:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_42
+    jmp .Lf2_41
+.Lf2_42:
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf2_43
+    jmp .Lf2_44
+.Lf2_43:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_45
+.Lf2_44:
+    movslq -16(%rbp), %rax
+.Lf2_45:
+    push %rax
+    movq $77, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_41:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_26
+.Lf2_27:
+    .loc 1 198 9
+    movq $7, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    cmpl $60, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 199 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_47
+    jmp .Lf2_46
+.Lf2_47:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_46:
+    push %rax
+    cmpl $99, -68(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $97, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 200 9
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_48
+    jmp .Lf2_49
+.Lf2_48:
+    movq $34, %rax
+    jmp .Lf2_50
+.Lf2_49:
+    movq $25, %rax
+.Lf2_50:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $81, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+.Lf2_26:
+    .loc 1 202 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_56
+    .p2align 4,,10
+.Lf2_55:
+    .loc 1 203 9
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_58
+    jmp .Lf2_57
+.Lf2_58:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_57:
+    push %rax
+    cmpl $76, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 205 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 206 13
+    .p2align 4,,10
+.Lf2_61:
+    .loc 1 207 17
+    movslq -4(%rbp), %rax
+    imulq $79, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_62
+    jmp .Lf2_63
+.Lf2_62:
+    movq $47, %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_64
+.Lf2_63:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_64:
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_66
+    jmp .Lf2_65
+.Lf2_66:
+    movq $48, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_68
+    jmp .Lf2_67
+.Lf2_68:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_67:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_65:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 208 17
+    movslq -16(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_70
+    jmp .Lf2_69
+.Lf2_70:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_69:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $25, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_72
+    jmp .Lf2_71
+.Lf2_72:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_71:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 209 17
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 210 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_60:
+    .loc 1 211 22
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_61
+.Lf2_59:
+    addq $0, %rsp
+    .loc 1 213 9
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_73
+    jmp .Lf2_74
+.Lf2_73:
+    movslq -40(%rbp), %rax
+    jmp .Lf2_75
+.Lf2_74:
+    movslq -12(%rbp), %rax
+.Lf2_75:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_76
+    jmp .Lf2_77
+.Lf2_76:
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_78
+.Lf2_77:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_80
+    jmp .Lf2_79
+.Lf2_80:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_79:
+.Lf2_78:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf2_54:
+    .loc 1 202 30
+    incl -340(%rbp)
+.Lf2_56:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_55
+.Lf2_53:
+    addq $8, %rsp
+    .loc 1 215 5
+    movq $2, %rax
+    push %rax
+    movq $44, %rax
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_82
+.Lf2_81:
+    movq $98, %rax
+    jmp .Lf2_83
+.Lf2_82:
+    movq $3, %rax
+.Lf2_83:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    addq $6, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 216 5
+    movq $8, %rax
+    push %rax
+    cmpl $97, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_85
+    .loc 1 217 9
+    movq $2, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 218 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_87
+    jmp .Lf2_86
+.Lf2_87:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_86:
+    push %rax
+    movq $75, %rax
+    cmpq $0, %rax
+    jne .Lf2_88
+    jmp .Lf2_89
+.Lf2_88:
+    movslq -28(%rbp), %rax
+    jmp .Lf2_90
+.Lf2_89:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf2_90:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    jne .Lf2_94
+    jmp .Lf2_95
+.Lf2_94:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_96
+.Lf2_95:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf2_96:
+    cmpq $0, %rax
+    jne .Lf2_91
+    jmp .Lf2_92
+.Lf2_91:
+    cmpl $38, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_93
+.Lf2_92:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 219 9
+    movq $9, %rax
+    push %rax
+    movq $9, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_101
+    jmp .Lf2_100
+.Lf2_101:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_100:
+    cmpq $0, %rax
+    jne .Lf2_97
+    jmp .Lf2_98
+.Lf2_97:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_103
+    jmp .Lf2_102
+.Lf2_103:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_102:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_99
+.Lf2_98:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_105
+    jmp .Lf2_104
+.Lf2_105:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_104:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf2_99:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_84
+.Lf2_85:
+    .loc 1 221 9
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $50, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_107
+    jmp .Lf2_106
+.Lf2_107:
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_106:
+    movl %eax, -4(%rbp)
+    .loc 1 222 9
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_109
+    jmp .Lf2_108
+.Lf2_109:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_111
+    jmp .Lf2_110
+.Lf2_111:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_110:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_108:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_113
+    jmp .Lf2_112
+.Lf2_113:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_115
+    jmp .Lf2_114
+.Lf2_115:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_114:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_116
+    jmp .Lf2_117
+.Lf2_116:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf2_118
+.Lf2_117:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf2_118:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_112:
+    movl %eax, -16(%rbp)
+    .loc 1 223 9
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_120
+    jmp .Lf2_119
+.Lf2_120:
+    movq $2, %rax
+    push %rax
+    movq $34, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_119:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_84:
+    .loc 1 226 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 227 9
+    .p2align 4,,10
+.Lf2_123:
+    .loc 1 228 13
+    movq $5, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_124
+    jmp .Lf2_121
+.Lf2_124:
+    .loc 1 229 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_130
+    .p2align 4,,10
+.Lf2_129:
+    .loc 1 230 17
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_132
+    jmp .Lf2_131
+.Lf2_132:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_131:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 231 17
+    movq $9, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_133
+    jmp .Lf2_134
+.Lf2_133:
+    movslq -36(%rbp), %rax
+    jmp .Lf2_135
+.Lf2_134:
+    movslq -56(%rbp), %rax
+.Lf2_135:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 232 17
+    movslq -28(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_136
+    jmp .Lf2_137
+.Lf2_136:
+    movq $66, %rax
+    jmp .Lf2_138
+.Lf2_137:
+    movslq -16(%rbp), %rax
+.Lf2_138:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_140
+    jmp .Lf2_139
+.Lf2_140:
+    movq $2, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_139:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_128:
+    .loc 1 229 38
+    incl -344(%rbp)
+.Lf2_130:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_129
+.Lf2_127:
+    addq $0, %rsp
+    .loc 1 234 13
+    movslq -68(%rbp), %rax
+    imulq $45, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $72, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_142
+    jmp .Lf2_141
+.Lf2_142:
+    movq $32, %rax
+    cmpq $0, %rax
+    jne .Lf2_143
+    jmp .Lf2_144
+.Lf2_143:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf2_145
+.Lf2_144:
+    movq $71, %rax
+.Lf2_145:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_141:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -36(%rbp)
+    .loc 1 235 13
+    movq $48, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    subq $31, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    imulq $89, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_147
+    jmp .Lf2_146
+.Lf2_147:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_146:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 236 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_122:
+    .loc 1 237 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_123
+.Lf2_121:
+    addq $8, %rsp
+    .loc 1 239 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_153
+    .p2align 4,,10
+.Lf2_152:
+    .loc 1 240 9
+    movslq -8(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $14, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 242 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 243 13
+    .p2align 4,,10
+.Lf2_156:
+    .loc 1 244 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_158
+    jmp .Lf2_159
+.Lf2_158:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_160
+.Lf2_159:
+    movq $16, %rax
+.Lf2_160:
+    cmpq $76, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_157
+    jmp .Lf2_154
+.Lf2_157:
+    .loc 1 245 17
+    movslq -20(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_161
+    jmp .Lf2_162
+.Lf2_161:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_163
+.Lf2_162:
+    movslq -12(%rbp), %rax
+.Lf2_163:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_165
+    jmp .Lf2_164
+.Lf2_165:
+    movq $49, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_164:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 246 17
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -40(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 247 17
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_166
+    jmp .Lf2_167
+.Lf2_166:
+    movslq -32(%rbp), %rax
+    jmp .Lf2_168
+.Lf2_167:
+    movslq -16(%rbp), %rax
+.Lf2_168:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_170
+    jmp .Lf2_169
+.Lf2_170:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_169:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_172
+    jmp .Lf2_171
+.Lf2_172:
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $43, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_174
+    jmp .Lf2_173
+.Lf2_174:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_173:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_171:
+    movl %eax, -16(%rbp)
+    .loc 1 248 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_155:
+    .loc 1 249 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_156
+.Lf2_154:
+    addq $0, %rsp
+    .loc 1 251 9
+    movslq -4(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $41, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_151:
+    .loc 1 239 30
+    incl -340(%rbp)
+.Lf2_153:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_152
+.Lf2_150:
+    addq $8, %rsp
+    .loc 1 253 5
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $76, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 255 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 256 9
+    jmp .Lf2_178
+    .p2align 4,,10
+.Lf2_177:
+    .loc 1 257 13
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_180
+    jmp .Lf2_179
+.Lf2_180:
+    cmpl $51, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_179:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -36(%rbp)
+    .loc 1 259 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 260 17
+    .p2align 4,,10
+.Lf2_183:
+    .loc 1 261 21
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $18, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_184
+    jmp .Lf2_185
+.Lf2_184:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_187
+    jmp .Lf2_188
+.Lf2_187:
+    movq $14, %rax
+    jmp .Lf2_189
+.Lf2_188:
+    movslq -4(%rbp), %rax
+.Lf2_189:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_186
+.Lf2_185:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_191
+    jmp .Lf2_190
+.Lf2_191:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_190:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf2_186:
+    movl %eax, -12(%rbp)
+    .loc 1 262 21
+    movq $37, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_193
+    jmp .Lf2_192
+.Lf2_193:
+    movslq -64(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_192:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_194
+    jmp .Lf2_195
+.Lf2_194:
+    movq $7, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_196
+.Lf2_195:
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_196:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -80(%rbp)
+    .loc 1 263 21
+    movq $7, %rax
+    push %rax
+    cmpl $94, -44(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_198
+    jmp .Lf2_197
+.Lf2_198:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_200
+    jmp .Lf2_199
+.Lf2_200:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_199:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_197:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 264 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_182:
+    .loc 1 265 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_183
+.Lf2_181:
+    addq $0, %rsp
+    .loc 1 267 13
+    movslq -12(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_201
+    jmp .Lf2_202
+.Lf2_201:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_204
+    jmp .Lf2_205
+.Lf2_204:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf2_206
+.Lf2_205:
+    movslq -16(%rbp), %rax
+.Lf2_206:
+    jmp .Lf2_203
+.Lf2_202:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_203:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $75, %rax
+    subl -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -28(%rbp)
+    .loc 1 268 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_176:
+.Lf2_178:
+    .loc 1 256 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_177
+.Lf2_175:
+    addq $8, %rsp
+    .loc 1 271 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_212
+    .p2align 4,,10
+.Lf2_211:
+    .loc 1 272 9
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_213
+    jmp .Lf2_214
+.Lf2_213:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_216
+    jmp .Lf2_217
+.Lf2_216:
+    movslq -12(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_218
+.Lf2_217:
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf2_219
+    jmp .Lf2_220
+.Lf2_219:
+    movq $52, %rax
+    jmp .Lf2_221
+.Lf2_220:
+    movslq -48(%rbp), %rax
+.Lf2_221:
+.Lf2_218:
+    jmp .Lf2_215
+.Lf2_214:
+    movq $68, %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf2_222
+    jmp .Lf2_223
+.Lf2_222:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_224
+.Lf2_223:
+    movq $17, %rax
+.Lf2_224:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_215:
+    movl %eax, -16(%rbp)
+    .loc 1 274 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 275 13
+    .p2align 4,,10
+.Lf2_227:
+    .loc 1 276 17
+    movslq -60(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $68, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_228
+    jmp .Lf2_225
+.Lf2_228:
+    .loc 1 277 17
+    movq $8, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_229
+    jmp .Lf2_230
+.Lf2_229:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_233
+    jmp .Lf2_232
+.Lf2_233:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_234
+    jmp .Lf2_235
+.Lf2_234:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf2_236
+.Lf2_235:
+    movq $39, %rax
+.Lf2_236:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_232:
+    jmp .Lf2_231
+.Lf2_230:
+    movslq -12(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $99, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_231:
+    movl %eax, -52(%rbp)
+    .loc 1 278 17
+    movq $2, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    cmpl $38, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 279 17
+    movq $42, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_237
+    jmp .Lf2_238
+.Lf2_237:
+    movq $24, %rax
+    jmp .Lf2_239
+.Lf2_238:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf2_239:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $24, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_241
+    jmp .Lf2_240
+.Lf2_241:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_240:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 280 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_226:
+    .loc 1 281 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_227
+.Lf2_225:
+    addq $0, %rsp
+    .loc 1 283 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_243
+    jmp .Lf2_242
+.Lf2_243:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_242:
+    push %rax
+    movslq -48(%rbp), %rax
+    addq $72, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_245
+    jmp .Lf2_244
+.Lf2_245:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_247
+    jmp .Lf2_246
+.Lf2_247:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $52, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_246:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_244:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_210:
+    .loc 1 271 30
+    incl -340(%rbp)
+.Lf2_212:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_211
+.Lf2_209:
+    addq $8, %rsp
+    .loc 1 285 5
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_249
+    jmp .Lf2_248
+.Lf2_249:
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_248:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_251
+    jmp .Lf2_250
+.Lf2_251:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_250:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
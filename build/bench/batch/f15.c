@@ -0,0 +1,515 @@
+int f0() {
+    int v0 = 81;
+    int v1 = 18;
+    int v2 = 65;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((42 >= 39) ? (a1[0][5] ? 30 : a1[2][2]) : (v3 ? v0 : v2)) <= ((a0[1] >= 79) == (a1[2][11] <= v2)));
+            a1[0][2] = (((a1[2][11] > i0) ? (42 != 39) : (70 == a0[4])) * ((90 <= a1[2][1]) > (v1 + 72)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((i0 * i1) / 2) <= ((a0[9] > a0[15]) + (59 || i1)));
+                    v1 = (((67 > i1) < (18 < 69)) >= ((v3 <= v1) / 5));
+                    v1 = (((i1 >= 3) <= (i0 != v3)) / 3);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v3 = (((v1 == v1) * (i2 == i2)) || ((a0[11] ? v0 : v1) * (a1[2][0] ? v2 : 41)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((i3 ? a1[3][2] : v0) <= (i3 - v1)) ? ((v2 % 4) % 2) : ((a1[0][11] + a0[8]) / 8));
+                v1 = (((v3 < i3) - (a0[15] || v0)) ? ((i3 < 8) == (a0[3] == i3)) : ((a0[8] < v2) + (a0[8] * 41)));
+                a0[4] = (((a0[13] != 25) ? (63 <= a1[3][2]) : (a0[11] + v2)) || ((a0[11] % 6) ? (v0 != a1[0][3]) : (i3 != v3)));
+            }
+            v3 = (((v1 != v2) ? (a0[15] != a0[1]) : (a0[4] ? a1[0][15] : 35)) <= ((v0 ? 54 : 67) - (v2 || a0[1])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((35 ? v1 : v3) >= (v1 / 2)) / 9);
+            v0 = (((v0 && v1) - (v3 == v2)) - ((i4 % 7) - (v3 <= v1)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((18 <= v1) < (a1[2][11] >= 21)) >= ((49 ? 61 : a1[2][11]) == (1 >= v0)));
+                    v2 = (((i5 * a0[7]) && (v3 <= i4)) || ((a1[1][4] + v0) ? (23 != 1) : (39 == i4)));
+                    v2 = (((i5 != 0) >= (i4 + 57)) * ((82 && a1[2][1]) >= (v2 && a0[12])));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((12 + v2) > 55) break;
+            v2 = (((a1[0][15] != v3) && (51 && 19)) != ((i6 <= a1[1][11]) > (v1 % 3)));
+            v0 = (((28 && v1) + (a0[6] && 87)) != ((57 ? i6 : 67) ? (v3 - v1) : (v1 ? 82 : v0)));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v2 = (((23 ? a1[1][10] : 71) / 1) != ((v1 * a1[2][13]) >= (v2 / 8)));
+                v3 = (((97 < a0[6]) < (a0[8] * 6)) % 9);
+                v0 = (((i6 != v0) ? (v3 <= 92) : (a0[9] || 16)) / 8);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    if ((((2 && a1[1][8]) >= (2 ? a1[0][15] : a0[3])) ? ((a0[4] * 9) && (v3 ? v0 : v2)) : ((25 >= 48) >= (83 <= 97)))) {
+        a1[2][14] = (((a1[1][1] - v1) <= (a1[1][7] <= v3)) ? ((v3 ? 62 : a0[5]) && (v2 < 65)) : ((v2 != 6) * (a0[3] ? 50 : v0)));
+        v3 = (((v3 / 4) - (v1 != a0[14])) != ((a1[2][11] - v1) ? (v2 ? v1 : 78) : (v1 > v1)));
+        a0[9] = (((v2 == v0) ? (4 <= 25) : (v2 != a1[1][7])) * ((v2 * v1) == (v0 == a1[1][5])));
+    } else {
+        v3 = (((88 / 4) < (v1 + 16)) < ((a0[15] && a1[0][5]) >= (64 == v3)));
+        v1 = (((v1 < v1) % 2) % 1);
+        v0 = (((v2 < a1[3][5]) <= (a0[15] * v2)) <= ((a0[15] < 7) || (v1 + a1[3][13])));
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        if ((7 != 67) > 50) break;
+        v2 = (((v0 >= i8) < (a0[14] / 7)) ? ((72 - a1[0][13]) % 2) : ((59 < a1[2][5]) - (v0 && v1)));
+        {
+            int i9 = 0;
+            do {
+                a0[9] = (((i8 ? 52 : v0) != (i9 == v0)) / 6);
+                a1[0][4] = (((v2 != a0[5]) != (i9 - v2)) ? ((59 > 63) ? (49 > v2) : (a1[0][13] == a0[15])) : ((v3 / 3) || (v0 == i9)));
+                v3 = (((a1[2][3] < a1[3][2]) ? (93 >= 90) : (v3 * i8)) == ((42 > a1[1][10]) % 9));
+                i9 = i9 + 1;
+            } while (i9 < 5);
+        }
+        a1[3][5] = (((v3 - 88) % 5) < ((61 <= v3) || (v0 / 3)));
+    }
+    v2 = (((v3 ? v0 : 71) ? (v1 ? v3 : 4) : (v2 / 6)) <= ((v0 ? 77 : 54) == (v3 || a0[0])));
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            v2 = (((a0[10] >= i10) > (a1[2][2] < v3)) ? ((a0[7] ? a0[4] : 20) == (66 - 80)) : ((a1[1][11] && a1[1][12]) != (63 / 2)));
+            {
+                int i11 = 0;
+                do {
+                    v0 = (((v2 >= a0[11]) > (a1[1][6] == v3)) >= ((a1[0][4] <= v1) * (80 <= v0)));
+                    v3 = (((i10 && v0) % 1) > ((i11 + v3) <= (i11 ? i10 : a1[2][7])));
+                    a0[5] = (((v0 && v1) / 1) > ((i11 || 99) == (v3 % 3)));
+                    i11 = i11 + 1;
+                } while (i11 < 8);
+            }
+            v1 = (((78 <= a0[0]) < (v2 && a0[3])) - ((v1 % 9) ? (v1 <= v0) : (a0[14] * v2)));
+            i10 = i10 + 1;
+        }
+    }
+    v1 = (((v0 / 4) / 4) || ((a0[0] || a0[13]) != (v2 || 25)));
+    a1[2][7] = (((a1[1][11] ? v2 : 42) * (a1[0][15] - v3)) && ((v3 == v3) % 9));
+    return (((a1[0][9] == a0[11]) - (v2 != v0)) && ((94 / 8) % 9));
+}
+int f1() {
+    int v0 = 5;
+    int v1 = 57;
+    int v2 = 70;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v0 = (((v3 < a1[0][14]) / 1) ? ((v0 > i0) || (v3 - i0)) : ((80 >= 33) / 9));
+        {
+            int i1 = 0;
+            do {
+                if ((a1[3][1] - v2) > 58) break;
+                v1 = (((v2 >= 10) || (i0 != i0)) / 3);
+                v3 = (((v0 >= v2) > (64 ? i1 : v1)) >= ((56 % 7) < (v3 ? a0[14] : a1[0][2])));
+                a1[3][8] = (((v3 < v3) > (v0 + a0[0])) >= ((i1 == 10) ? (i1 ? a1[1][15] : 10) : (v3 % 5)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        a0[5] = (((v2 < v2) && (40 ? 73 : a1[1][12])) ? ((i0 >= v3) ? (v1 ? v3 : a0[14]) : (i0 + v2)) : ((v2 != a1[1][15]) && (91 <= v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v3 = (((81 < v2) > (91 > 71)) <= ((v0 || 10) && (v0 / 4)));
+            a1[2][3] = (((v1 > a0[1]) / 7) != ((10 || v1) == (v2 > v3)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                if ((v0 < i3) > 73) break;
+                v1 = (((68 % 3) || (v3 < 95)) < ((i3 && 44) != (i2 % 3)));
+                v2 = (((v0 || 83) ? (i3 == v1) : (v3 ? a0[8] : v2)) >= ((v3 <= v2) ? (93 && v3) : (a1[0][10] % 6)));
+                a0[9] = (((55 % 4) <= (v1 >= v0)) ? ((51 + v2) + (94 > a1[2][2])) : ((a1[2][4] && v3) / 8));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            {
+                int i5 = 0;
+                do {
+                    a0[5] = (((v2 * i4) % 9) >= ((a0[0] == 5) != (98 != i5)));
+                    v3 = (((v0 || v2) >= (i4 - i5)) < ((a0[4] * v1) % 4));
+                    v0 = (((8 != a0[13]) || (v1 + v0)) < ((v2 * a1[2][4]) ? (i5 - a0[0]) : (80 ? 5 : 10)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v2 = (((a1[3][11] >= i4) > (v1 < v0)) || ((i4 + a1[2][6]) % 3));
+            v3 = (((v0 != v3) && (a1[0][2] - 12)) >= ((a1[0][12] != a1[0][3]) ? (81 && 60) : (v0 != 47)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((44 != a1[3][0]) ? (v1 > a1[3][9]) : (v1 % 9)) % 3)) {
+        v1 = (((76 != a0[7]) == (v3 ? v2 : a1[0][3])) / 7);
+        a0[9] = (((a1[2][9] % 1) * (28 > v0)) ? ((a0[0] < v0) ? (75 != a1[0][8]) : (12 ? a1[0][3] : 77)) : ((v1 / 3) && (21 - 61)));
+        v3 = (((v2 || a0[10]) <= (v3 || 62)) ? ((94 >= 4) * (v0 - v3)) : ((a0[2] != v0) - (v1 <= v1)));
+    } else {
+        v3 = (((v0 == v3) % 9) <= ((a0[13] > 90) <= (v0 * 6)));
+        v1 = (((v0 / 6) > (v1 >= a0[6])) > ((v2 - a0[15]) <= (v1 % 9)));
+        v0 = (((v3 != v2) || (29 + v1)) && ((a1[3][2] % 3) - (v2 - v2)));
+    }
+    if ((((27 >= a0[9]) - (55 ? v2 : a1[1][10])) ? ((v1 ? v2 : 51) == (v2 / 1)) : ((v3 > 90) < (96 % 8)))) {
+        a0[6] = (((15 || v1) && (a1[1][8] ? v3 : 50)) && ((0 - v3) || (a0[5] == 54)));
+        v1 = (((76 < a0[4]) % 5) == ((a1[2][14] != a1[2][3]) || (v1 != v2)));
+        a0[15] = (((v2 != v3) <= (v0 * a1[1][7])) && ((13 + a0[15]) * (v2 / 1)));
+    } else {
+        v1 = (((42 < a1[1][8]) + (v2 != v1)) ? ((v2 >= v2) != (v1 || a1[2][10])) : ((v1 * a1[2][0]) <= (a1[0][11] > v0)));
+        v1 = (((v1 || v1) / 9) >= ((92 ? v1 : a1[2][7]) % 8));
+        v0 = (((v0 <= a0[9]) <= (a0[13] / 7)) % 7);
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            a0[1] = (((48 < a1[1][5]) < (89 >= a0[13])) == ((a0[11] % 6) - (a1[3][8] ? v2 : i7)));
+            a1[2][9] = (((a1[3][9] > 49) != (i6 * i7)) || ((i7 % 3) > (a1[3][4] ? i6 : v1)));
+            v1 = (((i7 % 8) && (67 ? a1[3][14] : v1)) > ((v0 == 55) ? (61 < v0) : (a0[0] < a0[13])));
+        }
+        v0 = (((v1 ? 28 : a0[11]) == (18 == 70)) != ((v0 < v2) % 7));
+        v1 = (((v3 * v1) < (45 ? a1[2][10] : 70)) < ((i6 + 18) && (a0[5] / 4)));
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    if ((v1 == v1) > 73) break;
+                    a1[1][3] = (((a1[3][3] <= a1[2][3]) != (a1[2][5] ? 19 : v0)) == ((a1[1][4] % 6) > (i9 * v0)));
+                    a1[3][3] = (((a0[2] - i8) % 4) >= ((v2 ? v3 : a1[1][15]) / 9));
+                    a1[3][9] = (((v3 || v1) != (i8 && 5)) && ((v2 - a0[10]) >= (v0 > i9)));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            v0 = (((a1[3][7] || v2) != (a0[0] ? a0[13] : 21)) ? ((79 * v0) + (87 ? a0[12] : a1[0][11])) : ((a1[0][10] <= v1) ? (v3 < i8) : (v2 != i8)));
+            a0[0] = (((a0[12] / 6) && (63 != i8)) <= ((v0 && v3) >= (i8 ? 37 : v2)));
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    if ((((v0 + a1[0][8]) < (a0[12] == v0)) % 4)) {
+        v1 = (((v2 <= 14) > (v0 / 6)) / 6);
+        v3 = (((v1 == v0) - (v1 - 12)) % 3);
+        v3 = (((8 % 5) != (35 == v3)) && ((v2 / 6) == (v0 / 4)));
+    } else {
+        a0[14] = (((44 && v2) + (5 - v2)) > ((v1 / 1) - (a0[3] < v2)));
+        a1[2][5] = (((50 + a1[0][5]) - (24 != a0[7])) || ((v0 && v1) - (v0 && v0)));
+        a1[0][15] = (((v2 != 22) <= (v1 > v0)) && ((a0[12] >= 84) >= (v0 % 7)));
+    }
+    if ((((v3 == 52) != (80 * a1[1][10])) < ((a1[2][8] ? v0 : v3) == (v2 >= v2)))) {
+        a0[7] = (((a1[3][13] || v3) >= (a0[5] && 77)) && ((a1[3][13] >= a1[2][15]) + (65 < v2)));
+        v2 = (((32 - a1[1][8]) <= (98 && a0[13])) >= ((99 && v0) / 1));
+        a1[0][6] = (((81 < v0) ? (v1 + a1[3][7]) : (v1 > a0[0])) > ((a1[0][13] > v1) == (a0[0] / 9)));
+    } else {
+        v1 = (((v3 < v0) % 1) || ((v0 == 72) - (75 < a1[1][1])));
+        v1 = (((40 ? 98 : 78) * (a1[2][10] % 1)) <= ((v0 ? v2 : 4) && (v1 <= v2)));
+        a1[0][2] = (((61 <= 78) + (a1[2][14] || v0)) % 6);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 5) {
+            a1[2][15] = (((42 >= v2) == (75 < 86)) ? ((88 / 6) / 4) : ((a0[10] > v1) == (a0[15] + i10)));
+            {
+                int i11 = 0;
+                while (i11 < 5) {
+                    if ((a1[1][3] ? a1[0][13] : a1[0][0]) > 68) break;
+                    a0[9] = (((i10 || v1) && (v1 != 58)) >= ((53 % 1) < (i10 > v2)));
+                    v1 = (((a0[9] - a0[6]) ? (a1[0][10] % 9) : (v0 > a0[12])) && ((v0 ? 48 : v1) / 9));
+                    v1 = (((i11 * i11) ? (v1 % 7) : (v0 < 24)) % 8);
+                    i11 = i11 + 1;
+                }
+            }
+            v2 = (((a0[4] != i10) == (a1[2][8] % 6)) + ((28 <= 5) >= (i10 ? 58 : v2)));
+            i10 = i10 + 1;
+        }
+    }
+    return (((v1 > v0) / 9) / 6);
+}
+int f2() {
+    int v0 = 34;
+    int v1 = 61;
+    int v2 = 41;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a0[12] ? i0 : 92) > (i1 % 1)) - ((42 < v1) && (v1 / 1)));
+                    v2 = (((a0[9] == a0[9]) == (a1[3][8] - 49)) - ((v2 != v1) != (38 * a1[0][12])));
+                    v3 = (((v1 * v0) && (58 - i0)) < ((v3 ? 20 : a0[14]) >= (v1 && v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a1[0][5] = (((v3 != v2) - (92 >= 33)) || ((i0 % 1) - (a1[2][11] > v1)));
+            v2 = (((i0 < v3) && (72 || i0)) / 1);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((26 && 1) ? (v1 / 9) : (v3 != v2)) - ((v2 != 23) + (v1 || v3)))) {
+        v3 = (((v1 != a1[1][0]) % 3) * ((78 % 7) == (v3 >= v3)));
+        v3 = (((27 % 7) >= (a1[0][3] < v2)) <= ((62 >= a0[0]) - (20 * a0[8])));
+        v2 = (((v1 - v3) || (3 % 4)) && ((a0[5] * 29) ? (v3 && v1) : (v1 * a0[11])));
+    } else {
+        v2 = (((a0[0] >= a0[9]) / 9) / 8);
+        v0 = (((v1 * a1[3][13]) == (v3 || v0)) < ((v1 + 9) * (80 < v0)));
+        a0[10] = (((a1[0][2] ? 37 : 74) * (v0 / 9)) < ((v2 / 2) ? (v1 % 4) : (v1 > a0[4])));
+    }
+    if ((((a0[3] + a0[10]) / 1) != ((v0 == 88) ? (33 / 8) : (a1[3][1] && v0)))) {
+        v0 = (((71 < v0) * (a0[0] >= v1)) >= ((v3 > v3) == (v1 != 9)));
+        v0 = (((38 ? a1[3][13] : v2) == (a0[14] + a1[1][13])) < ((v1 || v3) > (v1 < v3)));
+        v1 = (((94 >= v1) * (a1[0][5] && 61)) % 6);
+    } else {
+        v1 = (((77 ? v0 : v1) >= (v3 ? 15 : a0[6])) ? ((20 * a1[0][1]) - (v1 ? a1[0][12] : 20)) : ((v2 != 10) ? (v0 || v2) : (32 == 27)));
+        v1 = (((v1 >= 41) % 5) >= ((62 == v2) ? (a0[9] && 76) : (88 % 7)));
+        v2 = (((67 ? v2 : v2) ? (v1 != 52) : (63 != a1[2][1])) < ((a0[11] / 5) || (86 < v0)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a1[0][13] = (((i2 / 1) <= (a0[3] ? v3 : 78)) <= ((86 - a0[11]) || (v0 ? 68 : a1[1][11])));
+        v0 = (((a0[11] - a0[9]) * (a0[6] == 36)) + ((i2 - 61) == (v3 > a0[2])));
+        {
+            int i3 = 0;
+            do {
+                a1[3][1] = (((66 ? v1 : v2) && (i2 == v0)) - ((v1 / 8) == (a0[6] ? 18 : i3)));
+                v0 = (((a0[15] % 7) > (27 > i2)) <= ((a1[1][12] && 69) > (8 && v1)));
+                v3 = (((a0[1] != a1[3][14]) > (78 == v1)) <= ((v1 - a0[14]) + (60 <= a0[1])));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+    }
+    v2 = (((v0 > 87) < (v2 ? v3 : v1)) % 7);
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a1[1][11] = (((v3 / 9) == (i5 - v3)) && ((v3 ? 0 : i4) / 9));
+                    a0[0] = (((78 >= v0) <= (12 == a0[4])) && ((v0 * 84) % 1));
+                    v0 = (((v0 >= a1[3][15]) ? (a1[1][3] % 2) : (a0[11] > v2)) ? ((v2 + i4) < (v3 || i5)) : ((i5 >= v0) >= (v2 > 40)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            a0[5] = (((a0[8] / 8) >= (v1 ? 70 : 51)) == ((a0[10] ? v1 : 86) / 6));
+            v1 = (((96 != 26) <= (a0[10] < v0)) != ((77 && v0) >= (a1[1][4] - 64)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    v2 = (((4 <= 60) && (a1[0][13] + v3)) > ((42 || a0[2]) / 3));
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v3 = (((v2 % 1) > (a1[1][6] == v1)) || ((v3 == 5) || (27 || 94)));
+                v3 = (((a0[15] == 70) % 9) <= ((a1[3][7] <= a1[3][9]) + (a0[4] % 5)));
+                v0 = (((a1[1][0] > v0) || (v0 ? i6 : v2)) + ((v2 / 8) ? (v0 || v3) : (i7 * 14)));
+                i7 = i7 + 1;
+            } while (i7 < 8);
+        }
+        v2 = (((v3 >= i6) <= (v0 != v3)) == ((v2 ? v3 : v2) != (3 / 6)));
+        v3 = (((v3 == v3) - (75 == 25)) + ((a0[0] ? a1[2][6] : i6) * (a0[0] || v3)));
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((56 && v3) > (17 && 87)) % 6);
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    v2 = (((i9 - 68) || (a1[1][8] <= v2)) ? ((v1 == i9) - (16 % 4)) : ((12 <= 19) == (92 > v1)));
+                    v1 = (((a1[1][8] + a1[3][1]) > (i8 >= v1)) == ((54 >= v3) / 9));
+                    v0 = (((v1 - v2) ? (v1 && 15) : (v0 - v1)) == ((v3 - 93) <= (v0 <= 40)));
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((v2 ? i8 : i8) * (42 % 4)) >= ((52 % 6) < (a0[2] != v3)));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        a0[11] = (((a1[0][15] == a1[3][15]) + (a0[2] > a1[2][3])) >= ((41 != v2) == (a1[2][5] - v0)));
+        v2 = (((i10 != 51) || (93 && v3)) % 7);
+        {
+            int i11 = 0;
+            do {
+                if ((v2 ? i10 : v2) > 56) break;
+                v0 = (((i11 || i10) != (a0[12] % 1)) < ((i10 * 55) == (a0[12] ? v2 : a1[1][14])));
+                a0[6] = (((7 < v1) % 2) / 6);
+                v3 = (((i11 / 4) - (v0 > v1)) || ((i10 && 5) ? (6 < i11) : (42 < v2)));
+                i11 = i11 + 1;
+            } while (i11 < 7);
+        }
+    }
+    return (((a1[3][13] <= v1) ? (v1 + a0[13]) : (v0 - v2)) ? ((37 ? v2 : 2) % 4) : ((73 == v0) - (v2 % 2)));
+}
+int f3() {
+    int v0 = 78;
+    int v1 = 81;
+    int v2 = 55;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    if ((((79 / 4) - (a0[4] <= v3)) * ((19 ? 43 : 22) <= (36 ? v0 : v1)))) {
+        v1 = (((a1[3][0] <= 23) ? (v1 < v3) : (17 <= 84)) / 9);
+        v3 = (((25 && a0[15]) > (a1[0][6] ? 44 : a1[2][14])) == ((v1 * 37) * (v0 ? v1 : v2)));
+        a0[2] = (((v3 ? a1[3][6] : a1[2][10]) / 2) == ((v3 != a1[3][8]) / 6));
+    } else {
+        a0[1] = (((v1 ? 79 : v2) - (a1[0][0] <= v0)) * ((62 < a1[3][5]) / 4));
+        v0 = (((v3 != v2) >= (21 >= a1[3][4])) ? ((93 == 73) >= (v0 != 74)) : ((v3 == v2) + (a0[0] - v2)));
+        v1 = (((v0 * v0) && (v2 && v1)) < ((v0 == v3) < (v3 != v0)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((i0 ? v2 : i0) > 95) break;
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((69 >= a0[14]) % 2) == ((36 != i1) || (a1[2][15] < 84)));
+                    v1 = (((a0[0] >= v1) ? (v1 || a0[11]) : (v2 ? i1 : i0)) <= ((v0 || 50) % 1));
+                    v2 = (((i1 ? a0[6] : 55) >= (17 - a1[1][9])) > ((i0 || 80) <= (v2 <= i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((63 >= a1[0][11]) && (20 >= 24)) < ((a0[12] + i0) >= (i0 == 71)));
+            v1 = (((53 != a0[1]) != (v0 == i0)) <= ((v3 != 5) * (10 <= v1)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                a1[0][13] = (((39 * v3) && (v3 >= 36)) < ((v0 > 70) ? (a1[3][9] >= v2) : (14 && a0[4])));
+                v2 = (((14 ? 94 : v2) && (v0 > a0[13])) > ((i2 > v0) || (i2 == a1[0][0])));
+                v2 = (((i3 ? 62 : v0) > (99 <= v1)) ? ((a0[7] * 58) % 6) : ((v1 < a0[15]) != (v2 || 14)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((8 * a0[9]) + (i2 == i2)) ? ((v2 || a1[0][13]) < (v0 != 81)) : ((83 * a0[1]) != (30 && a1[3][2])));
+        a0[6] = (((i2 < a0[7]) ? (a1[3][7] - v2) : (i2 / 9)) - ((v0 > 71) || (a0[5] % 9)));
+    }
+    a1[1][8] = (((v2 ? v3 : a0[7]) / 1) / 9);
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((a0[0] % 4) > 87) break;
+            v2 = (((v2 > i4) && (v3 >= v3)) / 3);
+            a0[13] = (((71 % 2) > (8 ? v0 : 37)) - ((v3 - a0[7]) != (36 == v0)));
+            {
+                int i5 = 0;
+                do {
+                    if ((68 % 3) > 85) break;
+                    v3 = (((i4 >= a1[0][14]) ? (v0 % 2) : (86 % 1)) || ((v1 - i5) >= (i5 == 74)));
+                    v1 = (((a0[0] + 15) == (i4 != 91)) <= ((v3 <= 97) <= (48 > a0[13])));
+                    a0[5] = (((4 - 6) - (a0[11] != i4)) || ((a0[14] * i5) ? (a0[13] && 84) : (v3 ? 90 : 58)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            v0 = (((v3 >= 0) >= (63 - i6)) < ((a1[0][6] >= 17) >= (i6 != v1)));
+            v3 = (((v1 != i6) <= (a1[1][14] + 84)) / 6);
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v2 = (((i7 * a1[2][12]) == (v3 >= v1)) != ((i6 - v1) ? (i6 <= 66) : (v0 <= v3)));
+                    v2 = (((a0[5] - v1) - (a1[2][1] * i6)) == ((a0[12] / 6) + (v3 < 25)));
+                    a0[6] = (((28 ? i6 : 36) && (v0 < 52)) && ((a1[1][4] || v2) ? (v0 >= i6) : (a1[0][6] > 16)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            v1 = (((31 < i8) >= (24 / 8)) && ((i8 != a0[1]) % 4));
+            v3 = (((v2 >= v2) % 7) - ((a1[2][12] > 26) < (0 + 89)));
+            {
+                int i9 = 0;
+                do {
+                    v0 = (((a0[12] ? v1 : i8) ? (13 < a0[14]) : (v0 > 15)) != ((v0 || a1[1][15]) ? (12 + v1) : (66 + v0)));
+                    v2 = (((a0[8] >= 75) != (v0 ? 50 : v0)) < ((v0 && 51) / 1));
+                    a0[0] = (((68 > v2) >= (62 >= v1)) % 8);
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v2 ? 47 : v2) / 9) * ((96 >= v1) > (a1[0][5] + v2)))) {
+        v0 = (((v0 - v2) > (v1 >= a0[13])) || ((98 == 27) == (v3 || v1)));
+        a0[12] = (((v0 > v1) >= (v0 / 8)) % 9);
+        v1 = (((74 ? v3 : v3) * (v1 || a0[6])) >= ((v1 ? v1 : v1) == (v0 ? v3 : v1)));
+    } else {
+        a0[1] = (((v0 >= a0[4]) ? (v0 == a1[2][11]) : (a0[9] - v0)) / 5);
+        a1[2][10] = (((v0 - a0[14]) == (82 * 82)) != ((v0 / 2) * (a1[2][8] ? a0[9] : v3)));
+        a0[1] = (((v0 || v0) || (v3 && 88)) >= ((v1 / 3) ? (v1 > 92) : (a0[5] % 6)));
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        v2 = (((v0 < v2) + (v1 * a1[0][10])) == ((29 < v2) - (i10 * v1)));
+        v3 = (((v1 + v0) + (v3 > a0[6])) * ((i10 != a0[7]) || (97 != v0)));
+        for (int i11 = 0; i11 < 5; i11 = i11 + 1) {
+            a1[0][11] = (((v0 > a0[14]) && (i11 <= v3)) + ((v1 ? a1[0][14] : a0[10]) <= (27 ? v3 : v2)));
+            a0[13] = (((93 - 90) != (i11 ? v1 : i11)) >= ((98 <= 13) >= (v3 ? 68 : v0)));
+            v0 = (((v0 || i11) < (v0 || 72)) <= ((78 <= a0[1]) && (32 / 7)));
+        }
+    }
+    {
+        int i12 = 0;
+        do {
+            v3 = (((a1[3][15] < v1) && (v3 > a1[3][4])) % 7);
+            {
+                int i13 = 0;
+                do {
+                    if ((v0 != a0[3]) > 94) break;
+                    v3 = (((55 % 6) == (v1 == a1[1][1])) + ((i12 > v0) ? (v0 ? a1[2][6] : 46) : (v1 < 79)));
+                    v1 = (((a0[6] != 27) - (a0[14] / 5)) > ((68 != i13) >= (29 ? v2 : a0[6])));
+                    a0[1] = (((i13 ? v1 : a0[3]) / 4) < ((v0 != 24) % 9));
+                    i13 = i13 + 1;
+                } while (i13 < 6);
+            }
+            v1 = (((v2 ? v0 : 27) >= (a0[10] >= 69)) < ((i12 > i12) * (26 > 46)));
+            i12 = i12 + 1;
+        } while (i12 < 3);
+    }
+    return (((v1 + v3) + (11 && v1)) < ((a0[15] >= v0) >= (v3 <= v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
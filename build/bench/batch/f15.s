@@ -0,0 +1,10657 @@
+    .file 1 "build/bench/batch/f15.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 508 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 509 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 510 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 511 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 512 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 513 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 514 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $81, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $18, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $65, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $13, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movq $42, %rax
+    cmpq $39, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_4
+    jmp .Lf0_5
+.Lf0_4:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_7
+    jmp .Lf0_8
+.Lf0_7:
+    movq $30, %rax
+    jmp .Lf0_9
+.Lf0_8:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf0_9:
+    jmp .Lf0_6
+.Lf0_5:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_10
+    jmp .Lf0_11
+.Lf0_10:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_12
+.Lf0_11:
+    movslq -12(%rbp), %rax
+.Lf0_12:
+.Lf0_6:
+    push %rax
+    cmpl $79, -76(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 12 13
+    movq $90, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $72, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_13
+    jmp .Lf0_14
+.Lf0_13:
+    movq $42, %rax
+    cmpq $39, %rax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_15
+.Lf0_14:
+    movq $70, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_15:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 14 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 15 17
+    jmp .Lf0_19
+    .p2align 4,,10
+.Lf0_18:
+    .loc 1 16 21
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_21
+    jmp .Lf0_20
+.Lf0_21:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_20:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 17 21
+    movq $67, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $18, %rax
+    cmpq $69, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 18 21
+    movq $3, %rax
+    push %rax
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 19 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_17:
+.Lf0_19:
+    .loc 1 15 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_18
+.Lf0_16:
+    addq $0, %rsp
+    .loc 1 22 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 23 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 26 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 27 9
+    jmp .Lf0_25
+    .p2align 4,,10
+.Lf0_24:
+    .loc 1 28 13
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_27
+    jmp .Lf0_26
+.Lf0_27:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_30
+.Lf0_29:
+    movq $41, %rax
+.Lf0_30:
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_31
+    jmp .Lf0_32
+.Lf0_31:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_33
+.Lf0_32:
+    movslq -8(%rbp), %rax
+.Lf0_33:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_26:
+    movl %eax, -16(%rbp)
+    .loc 1 29 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_39
+    .p2align 4,,10
+.Lf0_38:
+    .loc 1 30 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_43
+    jmp .Lf0_44
+.Lf0_43:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf0_45
+.Lf0_44:
+    movslq -4(%rbp), %rax
+.Lf0_45:
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_40
+    jmp .Lf0_41
+.Lf0_40:
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_42
+.Lf0_41:
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_42:
+    movl %eax, -8(%rbp)
+    .loc 1 31 17
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_50
+    jmp .Lf0_49
+.Lf0_50:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_49:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_46
+    jmp .Lf0_47
+.Lf0_46:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_48
+.Lf0_47:
+    movslq -48(%rbp), %rax
+    imulq $41, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_48:
+    movl %eax, -8(%rbp)
+    .loc 1 32 17
+    cmpl $25, -28(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_51
+    jmp .Lf0_52
+.Lf0_51:
+    movq $63, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_53
+.Lf0_52:
+    movslq -36(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_53:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_55
+    jmp .Lf0_54
+.Lf0_55:
+    movq $6, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_56
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_58
+.Lf0_57:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_58:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_54:
+    movl %eax, -64(%rbp)
+    addq $0, %rsp
+.Lf0_37:
+    .loc 1 29 38
+    incl -344(%rbp)
+.Lf0_39:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_38
+.Lf0_36:
+    addq $0, %rsp
+    .loc 1 34 13
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -20(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_63
+.Lf0_62:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_64
+.Lf0_63:
+    movq $35, %rax
+.Lf0_64:
+.Lf0_61:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_66
+    jmp .Lf0_65
+.Lf0_66:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_65:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_68
+.Lf0_67:
+    movq $54, %rax
+    jmp .Lf0_69
+.Lf0_68:
+    movq $67, %rax
+.Lf0_69:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 35 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_23:
+.Lf0_25:
+    .loc 1 27 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_24
+.Lf0_22:
+    addq $8, %rsp
+    .loc 1 39 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 40 9
+    .p2align 4,,10
+.Lf0_72:
+    .loc 1 41 13
+    movq $9, %rax
+    push %rax
+    movq $35, %rax
+    cmpq $0, %rax
+    jne .Lf0_73
+    jmp .Lf0_74
+.Lf0_73:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_75
+.Lf0_74:
+    movslq -16(%rbp), %rax
+.Lf0_75:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 42 13
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_77
+    jmp .Lf0_76
+.Lf0_77:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_76:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 44 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 45 17
+    .p2align 4,,10
+.Lf0_80:
+    .loc 1 46 21
+    movq $18, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $49, %rax
+    cmpq $0, %rax
+    jne .Lf0_81
+    jmp .Lf0_82
+.Lf0_81:
+    movq $61, %rax
+    jmp .Lf0_83
+.Lf0_82:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf0_83:
+    push %rax
+    movq $1, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 47 21
+    movslq -344(%rbp), %rax
+    imull -52(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_85
+    jmp .Lf0_84
+.Lf0_85:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_84:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_87
+    jmp .Lf0_86
+.Lf0_87:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_89
+.Lf0_88:
+    movq $23, %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_90
+.Lf0_89:
+    movq $39, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_90:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_86:
+    movl %eax, -12(%rbp)
+    .loc 1 48 21
+    movq $82, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_91
+.Lf0_92:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_91:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_93
+.Lf0_94:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $0, -344(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $57, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 49 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_79:
+    .loc 1 50 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_80
+.Lf0_78:
+    addq $0, %rsp
+    .loc 1 52 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_71:
+    .loc 1 53 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_72
+.Lf0_70:
+    addq $8, %rsp
+    .loc 1 56 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 57 9
+    .p2align 4,,10
+.Lf0_97:
+    .loc 1 58 13
+    movq $12, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $55, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_98
+    jmp .Lf0_95
+.Lf0_98:
+    .loc 1 59 13
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_100
+    jmp .Lf0_99
+.Lf0_100:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_102
+    jmp .Lf0_101
+.Lf0_102:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_101:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_99:
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 60 13
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_104
+    jmp .Lf0_103
+.Lf0_104:
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_103:
+    push %rax
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_105
+.Lf0_106:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_105:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $57, %rax
+    cmpq $0, %rax
+    jne .Lf0_110
+    jmp .Lf0_111
+.Lf0_110:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_112
+.Lf0_111:
+    movq $67, %rax
+.Lf0_112:
+    cmpq $0, %rax
+    jne .Lf0_107
+    jmp .Lf0_108
+.Lf0_107:
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_109
+.Lf0_108:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_114
+.Lf0_113:
+    movq $82, %rax
+    jmp .Lf0_115
+.Lf0_114:
+    movslq -4(%rbp), %rax
+.Lf0_115:
+.Lf0_109:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 61 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_121
+    .p2align 4,,10
+.Lf0_120:
+    .loc 1 62 17
+    movq $1, %rax
+    push %rax
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_125
+    jmp .Lf0_126
+.Lf0_125:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf0_127
+.Lf0_126:
+    movq $71, %rax
+.Lf0_127:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 63 17
+    movq $9, %rax
+    push %rax
+    movq $97, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -48(%rbp), %rax
+    imulq $6, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 64 17
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_128
+    jmp .Lf0_129
+.Lf0_128:
+    cmpl $92, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_130
+.Lf0_129:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_132
+    jmp .Lf0_131
+.Lf0_132:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_131:
+.Lf0_130:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_124:
+    .loc 1 61 38
+    incl -344(%rbp)
+    .loc 1 62 17
+    movq $1, %rax
+    push %rax
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf0_135
+.Lf0_134:
+    movq $71, %rax
+.Lf0_135:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 63 17
+    movq $9, %rax
+    push %rax
+    movq $97, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -48(%rbp), %rax
+    imulq $6, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 64 17
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_136
+    jmp .Lf0_137
+.Lf0_136:
+    cmpl $92, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_138
+.Lf0_137:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_140
+    jmp .Lf0_139
+.Lf0_140:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_139:
+.Lf0_138:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_123:
+    .loc 1 61 38
+    incl -344(%rbp)
+.Lf0_121:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $4, %rax
+    jl .Lf0_120
+.Lf0_122:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_118
+    .loc 1 62 17
+    movq $1, %rax
+    push %rax
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf0_143
+.Lf0_142:
+    movq $71, %rax
+.Lf0_143:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 63 17
+    movq $9, %rax
+    push %rax
+    movq $97, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -48(%rbp), %rax
+    imulq $6, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 64 17
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_144
+    jmp .Lf0_145
+.Lf0_144:
+    cmpl $92, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_146
+.Lf0_145:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_148
+    jmp .Lf0_147
+.Lf0_148:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_147:
+.Lf0_146:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_119:
+    .loc 1 61 38
+    incl -344(%rbp)
+    jmp .Lf0_122
+.Lf0_118:
+    addq $0, %rsp
+    .loc 1 66 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_96:
+    .loc 1 67 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_97
+.Lf0_95:
+    addq $8, %rsp
+    .loc 1 69 5
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_154
+    jmp .Lf0_153
+.Lf0_154:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_153:
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_156
+.Lf0_155:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -68(%rbp), %rax
+.Lf0_157:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -64(%rbp), %rax
+    imulq $9, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_159
+    jmp .Lf0_158
+.Lf0_159:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_160
+    jmp .Lf0_161
+.Lf0_160:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_162
+.Lf0_161:
+    movslq -12(%rbp), %rax
+.Lf0_162:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_158:
+    jmp .Lf0_152
+.Lf0_151:
+    movq $25, %rax
+    cmpq $48, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $83, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_152:
+    cmpq $0, %rax
+    je .Lf0_163
+    .loc 1 70 9
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_165
+.Lf0_164:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_168
+.Lf0_167:
+    movq $62, %rax
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -60(%rbp), %rax
+.Lf0_169:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_171
+    jmp .Lf0_170
+.Lf0_171:
+    cmpl $65, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_170:
+    jmp .Lf0_166
+.Lf0_165:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_172
+    jmp .Lf0_173
+.Lf0_172:
+    movq $50, %rax
+    jmp .Lf0_174
+.Lf0_173:
+    movslq -4(%rbp), %rax
+.Lf0_174:
+    push %rax
+    cmpl $6, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_166:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 71 9
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_179
+.Lf0_178:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_180
+.Lf0_179:
+    movq $78, %rax
+.Lf0_180:
+    jmp .Lf0_177
+.Lf0_176:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_177:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 72 9
+    movslq -12(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_181
+    jmp .Lf0_182
+.Lf0_181:
+    movq $4, %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_183
+.Lf0_182:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_183:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_149
+.Lf0_163:
+    .loc 1 74 9
+    movq $4, %rax
+    push %rax
+    movq $88, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $16, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_184
+.Lf0_185:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_184:
+    push %rax
+    movq $64, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 75 9
+    movq $1, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 76 9
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -20(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $7, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_187
+    jmp .Lf0_186
+.Lf0_187:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_149:
+    .loc 1 78 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_193
+    .p2align 4,,10
+.Lf0_192:
+    .loc 1 79 9
+    movq $7, %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $50, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_194
+    jmp .Lf0_190
+.Lf0_194:
+    .loc 1 80 9
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_195
+    jmp .Lf0_196
+.Lf0_195:
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    movq $72, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_197
+.Lf0_196:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    push %rax
+    movq $59, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_197:
+    movl %eax, -12(%rbp)
+    .loc 1 82 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 83 13
+    .p2align 4,,10
+.Lf0_202:
+    .loc 1 84 17
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_203
+    jmp .Lf0_204
+.Lf0_203:
+    movq $52, %rax
+    jmp .Lf0_205
+.Lf0_204:
+    movslq -4(%rbp), %rax
+.Lf0_205:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 85 17
+    movslq -12(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_207
+.Lf0_206:
+    movq $59, %rax
+    cmpq $63, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_210
+.Lf0_209:
+    movq $49, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_211
+.Lf0_210:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_211:
+    jmp .Lf0_208
+.Lf0_207:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_213
+    jmp .Lf0_212
+.Lf0_213:
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_212:
+.Lf0_208:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 86 17
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_214
+    jmp .Lf0_215
+.Lf0_214:
+    movq $93, %rax
+    cmpq $90, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_216
+.Lf0_215:
+    movslq -16(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_216:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $42, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 87 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_201:
+    .loc 1 88 22
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_202
+.Lf0_200:
+    addq $0, %rsp
+    .loc 1 90 9
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $88, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $61, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_218
+    jmp .Lf0_217
+.Lf0_218:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_217:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_191:
+    .loc 1 78 30
+    incl -340(%rbp)
+.Lf0_193:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_192
+.Lf0_190:
+    addq $8, %rsp
+    .loc 1 92 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_222
+    jmp .Lf0_223
+.Lf0_222:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_224
+.Lf0_223:
+    movq $71, %rax
+.Lf0_224:
+    cmpq $0, %rax
+    jne .Lf0_219
+    jmp .Lf0_220
+.Lf0_219:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_227
+.Lf0_226:
+    movq $4, %rax
+.Lf0_227:
+    jmp .Lf0_221
+.Lf0_220:
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_221:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_228
+    jmp .Lf0_229
+.Lf0_228:
+    movq $77, %rax
+    jmp .Lf0_230
+.Lf0_229:
+    movq $54, %rax
+.Lf0_230:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_232
+    jmp .Lf0_231
+.Lf0_232:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_231:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 94 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 95 9
+    jmp .Lf0_236
+    .p2align 4,,10
+.Lf0_235:
+    .loc 1 96 13
+    movslq -40(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_237
+    jmp .Lf0_238
+.Lf0_237:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_240
+    jmp .Lf0_241
+.Lf0_240:
+    movslq -64(%rbp), %rax
+    jmp .Lf0_242
+.Lf0_241:
+    movq $20, %rax
+.Lf0_242:
+    push %rax
+    movq $66, %rax
+    subq $80, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_239
+.Lf0_238:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_244
+    jmp .Lf0_243
+.Lf0_244:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_243:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_239:
+    movl %eax, -12(%rbp)
+    .loc 1 98 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 99 17
+    .p2align 4,,10
+.Lf0_247:
+    .loc 1 100 21
+    movslq -12(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $80, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 101 21
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_249
+    jmp .Lf0_248
+.Lf0_249:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_248:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_251
+.Lf0_250:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_252
+.Lf0_251:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_252:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 102 21
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_254
+    jmp .Lf0_253
+.Lf0_254:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_253:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_256
+    jmp .Lf0_255
+.Lf0_256:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_255:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -60(%rbp)
+    .loc 1 103 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_246:
+    .loc 1 104 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_247
+.Lf0_245:
+    addq $0, %rsp
+    .loc 1 106 13
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_257
+    jmp .Lf0_258
+.Lf0_257:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_259
+.Lf0_258:
+    movslq -24(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_259:
+    push %rax
+    movq $78, %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_261
+    jmp .Lf0_260
+.Lf0_261:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_260:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 107 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_234:
+.Lf0_236:
+    .loc 1 95 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_235
+.Lf0_233:
+    addq $8, %rsp
+    .loc 1 110 5
+    movq $4, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_263
+    jmp .Lf0_262
+.Lf0_263:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_265
+    jmp .Lf0_264
+.Lf0_265:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_264:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_267
+    jmp .Lf0_266
+.Lf0_267:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_266:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_262:
+    movl %eax, -8(%rbp)
+    .loc 1 111 5
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_268
+    jmp .Lf0_269
+.Lf0_268:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_270
+.Lf0_269:
+    movq $42, %rax
+.Lf0_270:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_272
+    jmp .Lf0_271
+.Lf0_272:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_271:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 112 5
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_274
+    jmp .Lf0_273
+.Lf0_274:
+    movq $9, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $94, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_273:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 114 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 115 5
+    subq $8, %rsp
+    movq $5, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 116 5
+    movq $57, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 117 5
+    subq $8, %rsp
+    movq $70, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 118 5
+    movq $90, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 119 5
+    subq $64, %rsp
+    .loc 1 120 5
+    subq $256, %rsp
+    .loc 1 121 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_6
+    .p2align 4,,10
+.Lf1_5:
+    .loc 1 122 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_7
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_11
+    jmp .Lf1_10
+.Lf1_11:
+    movslq -16(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_10:
+    jmp .Lf1_9
+.Lf1_8:
+    movq $9, %rax
+    push %rax
+    movq $80, %rax
+    cmpq $33, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_9:
+    movl %eax, -4(%rbp)
+    .loc 1 124 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 125 13
+    .p2align 4,,10
+.Lf1_14:
+    .loc 1 126 17
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $58, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_15
+    jmp .Lf1_12
+.Lf1_15:
+    .loc 1 127 17
+    movq $3, %rax
+    push %rax
+    cmpl $10, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_17
+    jmp .Lf1_16
+.Lf1_17:
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_16:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 128 17
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $64, %rax
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_19
+.Lf1_18:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_20
+.Lf1_19:
+    movslq -8(%rbp), %rax
+.Lf1_20:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_21
+    jmp .Lf1_22
+.Lf1_21:
+    movslq -24(%rbp), %rax
+    jmp .Lf1_23
+.Lf1_22:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf1_23:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 129 17
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $10, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_24
+    jmp .Lf1_25
+.Lf1_24:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_27
+    jmp .Lf1_28
+.Lf1_27:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf1_29
+.Lf1_28:
+    movq $10, %rax
+.Lf1_29:
+    jmp .Lf1_26
+.Lf1_25:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_26:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 130 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_13:
+    .loc 1 131 22
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_14
+.Lf1_12:
+    addq $0, %rsp
+    .loc 1 133 9
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_34
+    jmp .Lf1_33
+.Lf1_34:
+    movq $40, %rax
+    cmpq $0, %rax
+    jne .Lf1_35
+    jmp .Lf1_36
+.Lf1_35:
+    movq $73, %rax
+    jmp .Lf1_37
+.Lf1_36:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf1_37:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_33:
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_31
+.Lf1_30:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_38
+    jmp .Lf1_39
+.Lf1_38:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_41
+    jmp .Lf1_42
+.Lf1_41:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_43
+.Lf1_42:
+    movslq -24(%rbp), %rax
+.Lf1_43:
+    jmp .Lf1_40
+.Lf1_39:
+    movslq -340(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_40:
+    jmp .Lf1_32
+.Lf1_31:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_45
+    jmp .Lf1_44
+.Lf1_45:
+    movq $91, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_44:
+.Lf1_32:
+    movl %eax, -60(%rbp)
+    addq $0, %rsp
+.Lf1_4:
+    .loc 1 121 30
+    incl -340(%rbp)
+.Lf1_6:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_5
+.Lf1_3:
+    addq $8, %rsp
+    .loc 1 136 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 137 9
+    jmp .Lf1_49
+    .p2align 4,,10
+.Lf1_48:
+    .loc 1 138 13
+    movq $81, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $91, %rax
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_53
+    jmp .Lf1_52
+.Lf1_53:
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_52:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 139 13
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_55
+    jmp .Lf1_54
+.Lf1_55:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_54:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 140 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_61
+    .p2align 4,,10
+.Lf1_60:
+    .loc 1 141 17
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_62
+    jmp .Lf1_58
+.Lf1_62:
+    .loc 1 142 17
+    movq $3, %rax
+    push %rax
+    movq $68, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_64
+    jmp .Lf1_63
+.Lf1_64:
+    cmpl $95, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_65
+.Lf1_66:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_65:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 143 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_71
+    jmp .Lf1_70
+.Lf1_71:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_70:
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_69
+.Lf1_68:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_72
+    jmp .Lf1_73
+.Lf1_72:
+    movslq -48(%rbp), %rax
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -12(%rbp), %rax
+.Lf1_74:
+.Lf1_69:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_75
+    jmp .Lf1_76
+.Lf1_75:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_79
+    jmp .Lf1_78
+.Lf1_79:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_78:
+    jmp .Lf1_77
+.Lf1_76:
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_77:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 144 17
+    movq $4, %rax
+    push %rax
+    movq $55, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_81
+.Lf1_80:
+    movq $94, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $51, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_82
+.Lf1_81:
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_83
+.Lf1_84:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_83:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_82:
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf1_59:
+    .loc 1 140 38
+    incl -344(%rbp)
+.Lf1_61:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_60
+.Lf1_58:
+    addq $0, %rsp
+    .loc 1 146 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_47:
+.Lf1_49:
+    .loc 1 137 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_48
+.Lf1_46:
+    addq $8, %rsp
+    .loc 1 150 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 151 9
+    jmp .Lf1_88
+    .p2align 4,,10
+.Lf1_87:
+    .loc 1 153 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 154 17
+    .p2align 4,,10
+.Lf1_91:
+    .loc 1 155 21
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $5, -80(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $98, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -60(%rbp)
+    .loc 1 156 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_93
+    jmp .Lf1_92
+.Lf1_93:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_92:
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 157 21
+    movq $8, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_95
+    jmp .Lf1_94
+.Lf1_95:
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_94:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_96
+    jmp .Lf1_97
+.Lf1_96:
+    movslq -344(%rbp), %rax
+    subl -80(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_98
+.Lf1_97:
+    movq $80, %rax
+    cmpq $0, %rax
+    jne .Lf1_99
+    jmp .Lf1_100
+.Lf1_99:
+    movq $5, %rax
+    jmp .Lf1_101
+.Lf1_100:
+    movq $10, %rax
+.Lf1_101:
+.Lf1_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 158 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_90:
+    .loc 1 159 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_91
+.Lf1_89:
+    addq $0, %rsp
+    .loc 1 161 13
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_103
+    jmp .Lf1_102
+.Lf1_103:
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_102:
+    movl %eax, -12(%rbp)
+    .loc 1 162 13
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_105
+    jmp .Lf1_104
+.Lf1_105:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    subq $12, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_104:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_106
+    jmp .Lf1_107
+.Lf1_106:
+    movq $81, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_109
+.Lf1_110:
+    movq $60, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_109:
+    jmp .Lf1_108
+.Lf1_107:
+    cmpl $47, -4(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf1_108:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 163 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_86:
+.Lf1_88:
+    .loc 1 151 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_87
+.Lf1_85:
+    addq $8, %rsp
+    .loc 1 166 5
+    movq $3, %rax
+    push %rax
+    movq $44, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_112
+    jmp .Lf1_113
+.Lf1_112:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_114
+.Lf1_113:
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_114:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_115
+    .loc 1 167 9
+    movq $7, %rax
+    push %rax
+    movq $76, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_116
+    jmp .Lf1_117
+.Lf1_116:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_118
+.Lf1_117:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf1_118:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 168 9
+    movq $28, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_119
+    jmp .Lf1_120
+.Lf1_119:
+    movslq -80(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_123
+.Lf1_122:
+    movq $75, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_124
+.Lf1_123:
+    movq $12, %rax
+    cmpq $0, %rax
+    jne .Lf1_125
+    jmp .Lf1_126
+.Lf1_125:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf1_127
+.Lf1_126:
+    movq $77, %rax
+.Lf1_127:
+.Lf1_124:
+    jmp .Lf1_121
+.Lf1_120:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_129
+    jmp .Lf1_128
+.Lf1_129:
+    movq $21, %rax
+    subq $61, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_128:
+.Lf1_121:
+    movl %eax, -44(%rbp)
+    .loc 1 169 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_134
+    jmp .Lf1_133
+.Lf1_134:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_133:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_136
+    jmp .Lf1_135
+.Lf1_136:
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_135:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_130
+    jmp .Lf1_131
+.Lf1_130:
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $94, %rax
+    cmpq $4, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_132
+.Lf1_131:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_132:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_111
+.Lf1_115:
+    .loc 1 171 9
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $90, -28(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $6, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 172 9
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 173 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_138
+    jmp .Lf1_137
+.Lf1_138:
+    movq $29, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_137:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_139
+.Lf1_140:
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_139:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_111:
+    .loc 1 175 5
+    movq $55, %rax
+    cmpq $0, %rax
+    jne .Lf1_145
+    jmp .Lf1_146
+.Lf1_145:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_147
+.Lf1_146:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf1_147:
+    push %rax
+    movq $27, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_142
+    jmp .Lf1_143
+.Lf1_142:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_148
+    jmp .Lf1_149
+.Lf1_148:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_150
+.Lf1_149:
+    movq $51, %rax
+.Lf1_150:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_144
+.Lf1_143:
+    cmpl $90, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_144:
+    cmpq $0, %rax
+    je .Lf1_151
+    .loc 1 176 9
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_153
+    jmp .Lf1_152
+.Lf1_153:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_152:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_158
+.Lf1_157:
+    movq $50, %rax
+.Lf1_158:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_159
+.Lf1_160:
+    movq $0, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_162
+    jmp .Lf1_161
+.Lf1_162:
+    cmpl $54, -60(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_161:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_159:
+    movl %eax, -56(%rbp)
+    .loc 1 177 9
+    movq $5, %rax
+    push %rax
+    movq $76, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_164
+    jmp .Lf1_163
+.Lf1_164:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_163:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 178 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $13, %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_141
+.Lf1_151:
+    .loc 1 180 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $42, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_167
+    jmp .Lf1_168
+.Lf1_167:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_171
+    jmp .Lf1_170
+.Lf1_171:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_170:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_169
+.Lf1_168:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_169:
+    movl %eax, -8(%rbp)
+    .loc 1 181 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_173
+    jmp .Lf1_172
+.Lf1_173:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_172:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $92, %rax
+    cmpq $0, %rax
+    jne .Lf1_174
+    jmp .Lf1_175
+.Lf1_174:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_176
+.Lf1_175:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf1_176:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 182 9
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_141:
+    .loc 1 184 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_182
+    .p2align 4,,10
+.Lf1_181:
+    .loc 1 185 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_188
+    .p2align 4,,10
+.Lf1_187:
+    .loc 1 186 13
+    movq $48, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $89, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_189
+    jmp .Lf1_190
+.Lf1_189:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_191
+.Lf1_190:
+    movslq -344(%rbp), %rax
+.Lf1_191:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -76(%rbp)
+    .loc 1 187 13
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $49, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_193
+    jmp .Lf1_192
+.Lf1_193:
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_194
+    jmp .Lf1_195
+.Lf1_194:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_196
+.Lf1_195:
+    movslq -8(%rbp), %rax
+.Lf1_196:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_192:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 188 13
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_197
+.Lf1_198:
+    movq $67, %rax
+    cmpq $0, %rax
+    jne .Lf1_199
+    jmp .Lf1_200
+.Lf1_199:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf1_201
+.Lf1_200:
+    movslq -8(%rbp), %rax
+.Lf1_201:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_197:
+    push %rax
+    cmpl $55, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_202
+    jmp .Lf1_203
+.Lf1_202:
+    movq $61, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_204
+.Lf1_203:
+    movslq -80(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_204:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_186:
+    .loc 1 185 34
+    incl -344(%rbp)
+.Lf1_188:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_187
+.Lf1_185:
+    addq $0, %rsp
+    .loc 1 190 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_205
+    jmp .Lf1_206
+.Lf1_205:
+    movq $28, %rax
+    jmp .Lf1_207
+.Lf1_206:
+    movslq -36(%rbp), %rax
+.Lf1_207:
+    push %rax
+    movq $18, %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 191 9
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpq $0, %rax
+    jne .Lf1_208
+    jmp .Lf1_209
+.Lf1_208:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf1_210
+.Lf1_209:
+    movq $70, %rax
+.Lf1_210:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $18, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_211
+.Lf1_212:
+    movq $4, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_211:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_180:
+    .loc 1 184 30
+    incl -340(%rbp)
+.Lf1_182:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_181
+.Lf1_179:
+    addq $8, %rsp
+    .loc 1 194 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 195 9
+    .p2align 4,,10
+.Lf1_215:
+    .loc 1 197 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 198 17
+    .p2align 4,,10
+.Lf1_218:
+    .loc 1 199 21
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_219
+    jmp .Lf1_216
+.Lf1_219:
+    .loc 1 200 21
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_220
+    jmp .Lf1_221
+.Lf1_220:
+    movq $19, %rax
+    jmp .Lf1_222
+.Lf1_221:
+    movslq -4(%rbp), %rax
+.Lf1_222:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 201 21
+    movq $4, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_223
+    jmp .Lf1_224
+.Lf1_223:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_225
+.Lf1_224:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf1_225:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 202 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_227
+    jmp .Lf1_226
+.Lf1_227:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_226:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_229
+    jmp .Lf1_228
+.Lf1_229:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_228:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_231
+    jmp .Lf1_230
+.Lf1_231:
+    movslq -12(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_230:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 203 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_217:
+    .loc 1 204 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_218
+.Lf1_216:
+    addq $0, %rsp
+    .loc 1 206 13
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_236
+    jmp .Lf1_235
+.Lf1_236:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_235:
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_237
+    jmp .Lf1_238
+.Lf1_237:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_239
+.Lf1_238:
+    movq $21, %rax
+.Lf1_239:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_232
+    jmp .Lf1_233
+.Lf1_232:
+    movq $87, %rax
+    cmpq $0, %rax
+    jne .Lf1_240
+    jmp .Lf1_241
+.Lf1_240:
+    movslq -32(%rbp), %rax
+    jmp .Lf1_242
+.Lf1_241:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_242:
+    push %rax
+    movq $79, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_234
+.Lf1_233:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_243
+    jmp .Lf1_244
+.Lf1_243:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_245
+.Lf1_244:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_245:
+.Lf1_234:
+    movl %eax, -4(%rbp)
+    .loc 1 207 13
+    movq $6, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_247
+    jmp .Lf1_246
+.Lf1_247:
+    movq $63, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_246:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_249
+    jmp .Lf1_248
+.Lf1_249:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_248:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_250
+    jmp .Lf1_251
+.Lf1_250:
+    movq $37, %rax
+    jmp .Lf1_252
+.Lf1_251:
+    movslq -12(%rbp), %rax
+.Lf1_252:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -80(%rbp)
+    .loc 1 208 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_214:
+    .loc 1 209 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_215
+.Lf1_213:
+    addq $8, %rsp
+    .loc 1 211 5
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_254
+    .loc 1 212 9
+    movq $6, %rax
+    push %rax
+    cmpl $14, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 213 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $12, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 214 9
+    movq $5, %rax
+    push %rax
+    movq $8, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $35, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_256
+    jmp .Lf1_255
+.Lf1_256:
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_255:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_253
+.Lf1_254:
+    .loc 1 216 9
+    movq $5, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_258
+    jmp .Lf1_257
+.Lf1_258:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_257:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -24(%rbp)
+    .loc 1 217 9
+    movq $24, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    addq $50, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_260
+    jmp .Lf1_259
+.Lf1_260:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_262
+    jmp .Lf1_261
+.Lf1_262:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_261:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_264
+    jmp .Lf1_263
+.Lf1_264:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_263:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_259:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 218 9
+    cmpl $22, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_266
+    jmp .Lf1_265
+.Lf1_266:
+    cmpl $84, -32(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_265:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_253:
+    .loc 1 220 5
+    cmpl $52, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    imulq $80, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_268
+    jmp .Lf1_269
+.Lf1_268:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_270
+.Lf1_269:
+    movslq -16(%rbp), %rax
+.Lf1_270:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_271
+    .loc 1 221 9
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_273
+    jmp .Lf1_272
+.Lf1_273:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_272:
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_275
+    jmp .Lf1_274
+.Lf1_275:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_274:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_277
+    jmp .Lf1_276
+.Lf1_277:
+    movq $65, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_276:
+    movl %eax, -52(%rbp)
+    .loc 1 222 9
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    movq $32, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_279
+    jmp .Lf1_278
+.Lf1_279:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_278:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_281
+    jmp .Lf1_280
+.Lf1_281:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_280:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 223 9
+    movq $81, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_282
+    jmp .Lf1_283
+.Lf1_282:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_284
+.Lf1_283:
+    movslq -8(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_284:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_267
+.Lf1_271:
+    .loc 1 225 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_286
+    jmp .Lf1_285
+.Lf1_286:
+    movq $75, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $72, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_285:
+    movl %eax, -8(%rbp)
+    .loc 1 226 9
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $40, %rax
+    cmpq $0, %rax
+    jne .Lf1_287
+    jmp .Lf1_288
+.Lf1_287:
+    movq $98, %rax
+    jmp .Lf1_289
+.Lf1_288:
+    movq $78, %rax
+.Lf1_289:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_290
+    jmp .Lf1_291
+.Lf1_290:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_292
+.Lf1_291:
+    movq $4, %rax
+.Lf1_292:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_294
+    jmp .Lf1_293
+.Lf1_294:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_293:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 227 9
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_296
+    jmp .Lf1_295
+.Lf1_296:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_295:
+    push %rax
+    movq $61, %rax
+    cmpq $78, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_267:
+    .loc 1 230 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 231 9
+    jmp .Lf1_300
+    .p2align 4,,10
+.Lf1_299:
+    .loc 1 232 13
+    movq $42, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $75, %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_301
+    jmp .Lf1_302
+.Lf1_301:
+    movq $4, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $88, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_303
+.Lf1_302:
+    movslq -40(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -20(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_303:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 234 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 235 17
+    jmp .Lf1_307
+    .p2align 4,,10
+.Lf1_306:
+    .loc 1 236 21
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_309
+    jmp .Lf1_310
+.Lf1_309:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf1_311
+.Lf1_310:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf1_311:
+    cmpq $68, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_308
+    jmp .Lf1_304
+.Lf1_308:
+    .loc 1 237 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_313
+    jmp .Lf1_312
+.Lf1_313:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_312:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_315
+    jmp .Lf1_314
+.Lf1_315:
+    cmpl $58, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_314:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -44(%rbp)
+    .loc 1 238 21
+    movslq -44(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_316
+    jmp .Lf1_317
+.Lf1_316:
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_318
+.Lf1_317:
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_318:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_320
+    jmp .Lf1_319
+.Lf1_320:
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_321
+    jmp .Lf1_322
+.Lf1_321:
+    movq $48, %rax
+    jmp .Lf1_323
+.Lf1_322:
+    movslq -8(%rbp), %rax
+.Lf1_323:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_319:
+    movl %eax, -8(%rbp)
+    .loc 1 239 21
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_324
+    jmp .Lf1_325
+.Lf1_324:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_326
+.Lf1_325:
+    cmpl $24, -4(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf1_326:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 240 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_305:
+.Lf1_307:
+    .loc 1 235 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_306
+.Lf1_304:
+    addq $0, %rsp
+    .loc 1 243 13
+    movq $28, %rax
+    cmpq $5, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_327
+    jmp .Lf1_328
+.Lf1_327:
+    movq $58, %rax
+    jmp .Lf1_329
+.Lf1_328:
+    movslq -12(%rbp), %rax
+.Lf1_329:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 244 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_298:
+.Lf1_300:
+    .loc 1 231 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_299
+.Lf1_297:
+    addq $8, %rsp
+    .loc 1 247 5
+    movq $6, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 249 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 250 5
+    subq $8, %rsp
+    movq $34, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 251 5
+    movq $61, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 252 5
+    subq $8, %rsp
+    movq $41, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 253 5
+    movq $55, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 254 5
+    subq $64, %rsp
+    .loc 1 255 5
+    subq $256, %rsp
+    .loc 1 257 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 258 9
+    jmp .Lf2_4
+    .p2align 4,,10
+.Lf2_3:
+    .loc 1 260 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 261 17
+    .p2align 4,,10
+.Lf2_7:
+    .loc 1 262 21
+    movq $42, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_9
+    jmp .Lf2_8
+.Lf2_9:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_8:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_10
+    jmp .Lf2_11
+.Lf2_10:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_12
+.Lf2_11:
+    movq $92, %rax
+.Lf2_12:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 263 21
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    imulq $38, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    subq $49, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 264 21
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_14
+    jmp .Lf2_13
+.Lf2_14:
+    movq $58, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_13:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_15
+    jmp .Lf2_16
+.Lf2_15:
+    movq $20, %rax
+    jmp .Lf2_17
+.Lf2_16:
+    movslq -24(%rbp), %rax
+.Lf2_17:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_19
+    jmp .Lf2_18
+.Lf2_19:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_18:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 265 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_6:
+    .loc 1 266 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_7
+.Lf2_5:
+    addq $0, %rsp
+    .loc 1 268 13
+    movq $92, %rax
+    cmpq $33, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_21
+    jmp .Lf2_20
+.Lf2_21:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_20:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 269 13
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_23
+    jmp .Lf2_22
+.Lf2_23:
+    movq $72, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_25
+    jmp .Lf2_24
+.Lf2_25:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_24:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_22:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 270 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_2:
+.Lf2_4:
+    .loc 1 258 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_3
+.Lf2_1:
+    addq $8, %rsp
+    .loc 1 273 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_28
+    jmp .Lf2_27
+.Lf2_28:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_27:
+    push %rax
+    cmpl $23, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_33
+    jmp .Lf2_32
+.Lf2_33:
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_32:
+    cmpq $0, %rax
+    jne .Lf2_29
+    jmp .Lf2_30
+.Lf2_29:
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_31
+.Lf2_30:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_31:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_34
+    .loc 1 274 9
+    movq $7, %rax
+    push %rax
+    movq $78, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 275 9
+    movq $7, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $20, %rax
+    imull -48(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $62, %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 276 9
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_36
+    jmp .Lf2_35
+.Lf2_36:
+    movq $4, %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_35:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_38
+    jmp .Lf2_37
+.Lf2_38:
+    movslq -60(%rbp), %rax
+    imulq $29, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_39
+    jmp .Lf2_40
+.Lf2_39:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_43
+    jmp .Lf2_42
+.Lf2_43:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_42:
+    jmp .Lf2_41
+.Lf2_40:
+    movslq -8(%rbp), %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_41:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_37:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_26
+.Lf2_34:
+    .loc 1 278 9
+    movq $8, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 279 9
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_45
+    jmp .Lf2_44
+.Lf2_45:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_44:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $80, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $9, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 280 9
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_46
+    jmp .Lf2_47
+.Lf2_46:
+    movq $37, %rax
+    jmp .Lf2_48
+.Lf2_47:
+    movq $74, %rax
+.Lf2_48:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_49
+    jmp .Lf2_50
+.Lf2_49:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_51
+.Lf2_50:
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_51:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+.Lf2_26:
+    .loc 1 282 5
+    movq $1, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $88, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_53
+    jmp .Lf2_54
+.Lf2_53:
+    movq $8, %rax
+    push %rax
+    movq $33, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_55
+.Lf2_54:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_57
+    jmp .Lf2_56
+.Lf2_57:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_56:
+.Lf2_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_58
+    .loc 1 283 9
+    movslq -80(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $71, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $9, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 284 9
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf2_59
+    jmp .Lf2_60
+.Lf2_59:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf2_61
+.Lf2_60:
+    movslq -12(%rbp), %rax
+.Lf2_61:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    addl -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_63
+    jmp .Lf2_62
+.Lf2_63:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_62:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 285 9
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_65
+    jmp .Lf2_64
+.Lf2_65:
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_64:
+    push %rax
+    movq $94, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_52
+.Lf2_58:
+    .loc 1 287 9
+    movq $77, %rax
+    cmpq $0, %rax
+    jne .Lf2_69
+    jmp .Lf2_70
+.Lf2_69:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_71
+.Lf2_70:
+    movslq -8(%rbp), %rax
+.Lf2_71:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_72
+    jmp .Lf2_73
+.Lf2_72:
+    movq $15, %rax
+    jmp .Lf2_74
+.Lf2_73:
+    movslq -56(%rbp), %rax
+.Lf2_74:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_66
+    jmp .Lf2_67
+.Lf2_66:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_75
+    jmp .Lf2_76
+.Lf2_75:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf2_77
+.Lf2_76:
+    movq $20, %rax
+.Lf2_77:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    imulq $20, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_68
+.Lf2_67:
+    cmpl $10, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_78
+    jmp .Lf2_79
+.Lf2_78:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_82
+    jmp .Lf2_81
+.Lf2_82:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_81:
+    jmp .Lf2_80
+.Lf2_79:
+    movq $32, %rax
+    cmpq $27, %rax
+    movq $0, %rax
+    sete %al
+.Lf2_80:
+.Lf2_68:
+    movl %eax, -8(%rbp)
+    .loc 1 288 9
+    movq $5, %rax
+    push %rax
+    cmpl $41, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $62, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_83
+    jmp .Lf2_84
+.Lf2_83:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_87
+    jmp .Lf2_86
+.Lf2_87:
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_86:
+    jmp .Lf2_85
+.Lf2_84:
+    movq $7, %rax
+    push %rax
+    movq $88, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_85:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 289 9
+    movq $67, %rax
+    cmpq $0, %rax
+    jne .Lf2_91
+    jmp .Lf2_92
+.Lf2_91:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_93
+.Lf2_92:
+    movslq -12(%rbp), %rax
+.Lf2_93:
+    cmpq $0, %rax
+    jne .Lf2_88
+    jmp .Lf2_89
+.Lf2_88:
+    cmpl $52, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_90
+.Lf2_89:
+    movq $63, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_90:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_95
+    jmp .Lf2_94
+.Lf2_95:
+    movq $86, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_94:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_52:
+    .loc 1 291 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_101
+    .p2align 4,,10
+.Lf2_100:
+    .loc 1 292 9
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_102
+    jmp .Lf2_103
+.Lf2_102:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_104
+.Lf2_103:
+    movq $78, %rax
+.Lf2_104:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $86, %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_106
+    jmp .Lf2_105
+.Lf2_106:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_107
+    jmp .Lf2_108
+.Lf2_107:
+    movq $68, %rax
+    jmp .Lf2_109
+.Lf2_108:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf2_109:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_105:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 293 9
+    movslq -340(%rbp), %rax
+    subq $61, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $36, -56(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -36(%rbp), %rax
+    subl -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 295 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 296 13
+    .p2align 4,,10
+.Lf2_112:
+    .loc 1 297 17
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_113
+    jmp .Lf2_114
+.Lf2_113:
+    movq $18, %rax
+    jmp .Lf2_115
+.Lf2_114:
+    movslq -344(%rbp), %rax
+.Lf2_115:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $66, %rax
+    cmpq $0, %rax
+    jne .Lf2_116
+    jmp .Lf2_117
+.Lf2_116:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_118
+.Lf2_117:
+    movslq -12(%rbp), %rax
+.Lf2_118:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_120
+    jmp .Lf2_119
+.Lf2_120:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_119:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 298 17
+    movq $7, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $27, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_121
+.Lf2_122:
+    movq $69, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_121:
+    push %rax
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_124
+    jmp .Lf2_123
+.Lf2_124:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_123:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 299 17
+    movslq -76(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $78, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $60, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 300 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_111:
+    .loc 1 301 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_112
+.Lf2_110:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_99:
+    .loc 1 291 30
+    incl -340(%rbp)
+.Lf2_101:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_100
+.Lf2_98:
+    addq $8, %rsp
+    .loc 1 304 5
+    movq $7, %rax
+    push %rax
+    cmpl $87, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_125
+    jmp .Lf2_126
+.Lf2_125:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_127
+.Lf2_126:
+    movslq -8(%rbp), %rax
+.Lf2_127:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 306 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 307 9
+    .p2align 4,,10
+.Lf2_130:
+    .loc 1 309 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 310 17
+    .p2align 4,,10
+.Lf2_133:
+    .loc 1 311 21
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_135
+    jmp .Lf2_134
+.Lf2_135:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_136
+    jmp .Lf2_137
+.Lf2_136:
+    movq $0, %rax
+    jmp .Lf2_138
+.Lf2_137:
+    movslq -340(%rbp), %rax
+.Lf2_138:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_134:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 312 21
+    movq $78, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $12, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_140
+    jmp .Lf2_139
+.Lf2_140:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $84, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_139:
+    movl %eax, -80(%rbp)
+    .loc 1 313 21
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_144
+    jmp .Lf2_145
+.Lf2_144:
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_146
+.Lf2_145:
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_146:
+    cmpq $0, %rax
+    jne .Lf2_141
+    jmp .Lf2_142
+.Lf2_141:
+    movslq -12(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_148
+    jmp .Lf2_147
+.Lf2_148:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_147:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_143
+.Lf2_142:
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $40, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_143:
+    movl %eax, -4(%rbp)
+    .loc 1 314 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_132:
+    .loc 1 315 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_133
+.Lf2_131:
+    addq $0, %rsp
+    .loc 1 317 13
+    movq $8, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_149
+    jmp .Lf2_150
+.Lf2_149:
+    movq $70, %rax
+    jmp .Lf2_151
+.Lf2_150:
+    movq $51, %rax
+.Lf2_151:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_152
+    jmp .Lf2_153
+.Lf2_152:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_154
+.Lf2_153:
+    movq $86, %rax
+.Lf2_154:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -60(%rbp)
+    .loc 1 318 13
+    movq $96, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_156
+    jmp .Lf2_155
+.Lf2_156:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_155:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    subq $64, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 319 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_129:
+    .loc 1 320 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_130
+.Lf2_128:
+    addq $8, %rsp
+    .loc 1 322 5
+    movq $4, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_158
+    jmp .Lf2_157
+.Lf2_158:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_157:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_160
+    jmp .Lf2_159
+.Lf2_160:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_159:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 323 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_166
+    .p2align 4,,10
+.Lf2_165:
+    .loc 1 325 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 326 13
+    .p2align 4,,10
+.Lf2_169:
+    .loc 1 327 17
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_171
+    jmp .Lf2_170
+.Lf2_171:
+    cmpl $5, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_173
+    jmp .Lf2_172
+.Lf2_173:
+    movq $27, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_175
+    jmp .Lf2_174
+.Lf2_175:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_174:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_172:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_170:
+    movl %eax, -16(%rbp)
+    .loc 1 328 17
+    movq $9, %rax
+    push %rax
+    cmpl $70, -20(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 329 17
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_176
+    jmp .Lf2_177
+.Lf2_176:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_180
+    jmp .Lf2_179
+.Lf2_180:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_179:
+    jmp .Lf2_178
+.Lf2_177:
+    movslq -344(%rbp), %rax
+    imulq $14, %rax
+    movslq %eax, %rax
+.Lf2_178:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_182
+    jmp .Lf2_181
+.Lf2_182:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_183
+    jmp .Lf2_184
+.Lf2_183:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_185
+.Lf2_184:
+    movslq -12(%rbp), %rax
+.Lf2_185:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_181:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 330 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_168:
+    .loc 1 331 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_169
+.Lf2_167:
+    addq $0, %rsp
+    .loc 1 333 9
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_186
+    jmp .Lf2_187
+.Lf2_186:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_188
+.Lf2_187:
+    movslq -12(%rbp), %rax
+.Lf2_188:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 334 9
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_190
+    jmp .Lf2_189
+.Lf2_190:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_189:
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_191
+    jmp .Lf2_192
+.Lf2_191:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf2_193
+.Lf2_192:
+    movslq -340(%rbp), %rax
+.Lf2_193:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $75, %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_164:
+    .loc 1 323 30
+    incl -340(%rbp)
+.Lf2_166:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_165
+.Lf2_163:
+    addq $8, %rsp
+    .loc 1 337 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 338 9
+    .p2align 4,,10
+.Lf2_196:
+    .loc 1 339 13
+    movq $6, %rax
+    push %rax
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_198
+    jmp .Lf2_197
+.Lf2_198:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_197:
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_200
+    jmp .Lf2_199
+.Lf2_200:
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 341 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 342 17
+    jmp .Lf2_204
+    .p2align 4,,10
+.Lf2_203:
+    .loc 1 343 21
+    movslq -344(%rbp), %rax
+    subq $68, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_209
+    jmp .Lf2_208
+.Lf2_209:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_208:
+    cmpq $0, %rax
+    jne .Lf2_205
+    jmp .Lf2_206
+.Lf2_205:
+    movq $4, %rax
+    push %rax
+    movq $16, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_207
+.Lf2_206:
+    movq $12, %rax
+    cmpq $19, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $92, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_207:
+    movl %eax, -12(%rbp)
+    .loc 1 344 21
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $54, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 345 21
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_210
+    jmp .Lf2_211
+.Lf2_210:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_214
+    jmp .Lf2_213
+.Lf2_214:
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_213:
+    jmp .Lf2_212
+.Lf2_211:
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_212:
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $93, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $40, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 346 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_202:
+.Lf2_204:
+    .loc 1 342 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_203
+.Lf2_201:
+    addq $0, %rsp
+    .loc 1 349 13
+    movq $4, %rax
+    push %rax
+    movq $42, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_215
+    jmp .Lf2_216
+.Lf2_215:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_217
+.Lf2_216:
+    movslq -340(%rbp), %rax
+.Lf2_217:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $52, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 350 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_195:
+    .loc 1 351 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_196
+.Lf2_194:
+    addq $8, %rsp
+    .loc 1 353 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_223
+    .p2align 4,,10
+.Lf2_222:
+    .loc 1 354 9
+    movslq -72(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $41, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -36(%rbp)
+    .loc 1 355 9
+    movq $7, %rax
+    push %rax
+    cmpl $51, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_225
+    jmp .Lf2_224
+.Lf2_225:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_227
+    jmp .Lf2_226
+.Lf2_227:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_226:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_224:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 357 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 358 13
+    .p2align 4,,10
+.Lf2_230:
+    .loc 1 359 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_232
+    jmp .Lf2_233
+.Lf2_232:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_234
+.Lf2_233:
+    movslq -12(%rbp), %rax
+.Lf2_234:
+    cmpq $56, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_231
+    jmp .Lf2_228
+.Lf2_231:
+    .loc 1 360 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_236
+    jmp .Lf2_235
+.Lf2_236:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_235:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imulq $55, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_237
+    jmp .Lf2_238
+.Lf2_237:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_239
+.Lf2_238:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf2_239:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 361 17
+    movq $6, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $7, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 362 17
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_241
+    jmp .Lf2_240
+.Lf2_241:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_246
+    jmp .Lf2_245
+.Lf2_246:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_245:
+    cmpq $0, %rax
+    jne .Lf2_242
+    jmp .Lf2_243
+.Lf2_242:
+    movq $6, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_244
+.Lf2_243:
+    movq $42, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf2_244:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_240:
+    movl %eax, -16(%rbp)
+    .loc 1 363 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_229:
+    .loc 1 364 22
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_230
+.Lf2_228:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_221:
+    .loc 1 353 32
+    incl -340(%rbp)
+.Lf2_223:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_222
+.Lf2_220:
+    addq $8, %rsp
+    .loc 1 367 5
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_250
+    jmp .Lf2_251
+.Lf2_250:
+    movslq -8(%rbp), %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_252
+.Lf2_251:
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_252:
+    cmpq $0, %rax
+    jne .Lf2_247
+    jmp .Lf2_248
+.Lf2_247:
+    movq $4, %rax
+    push %rax
+    movq $37, %rax
+    cmpq $0, %rax
+    jne .Lf2_253
+    jmp .Lf2_254
+.Lf2_253:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_255
+.Lf2_254:
+    movq $2, %rax
+.Lf2_255:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_249
+.Lf2_248:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $73, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf2_249:
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 369 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 370 5
+    subq $8, %rsp
+    movq $78, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 371 5
+    movq $81, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 372 5
+    subq $8, %rsp
+    movq $55, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 373 5
+    movq $22, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 374 5
+    subq $64, %rsp
+    .loc 1 375 5
+    subq $256, %rsp
+    .loc 1 376 5
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf3_2
+    jmp .Lf3_3
+.Lf3_2:
+    movq $43, %rax
+    jmp .Lf3_4
+.Lf3_3:
+    movq $22, %rax
+.Lf3_4:
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf3_5
+    jmp .Lf3_6
+.Lf3_5:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_7
+.Lf3_6:
+    movslq -8(%rbp), %rax
+.Lf3_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $79, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_8
+    .loc 1 377 9
+    movq $9, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $23, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf3_9
+    jmp .Lf3_10
+.Lf3_9:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_11
+.Lf3_10:
+    movq $17, %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    setle %al
+.Lf3_11:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 378 9
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_13
+    jmp .Lf3_12
+.Lf3_13:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_12:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_14
+    jmp .Lf3_15
+.Lf3_14:
+    movq $44, %rax
+    jmp .Lf3_16
+.Lf3_15:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf3_16:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_17
+    jmp .Lf3_18
+.Lf3_17:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_19
+.Lf3_18:
+    movslq -12(%rbp), %rax
+.Lf3_19:
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $37, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 379 9
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_20
+    jmp .Lf3_21
+.Lf3_20:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf3_22
+.Lf3_21:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf3_22:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -72(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_1
+.Lf3_8:
+    .loc 1 381 9
+    movq $4, %rax
+    push %rax
+    movq $62, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_23
+    jmp .Lf3_24
+.Lf3_23:
+    movq $79, %rax
+    jmp .Lf3_25
+.Lf3_24:
+    movslq -12(%rbp), %rax
+.Lf3_25:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 382 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $21, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_26
+    jmp .Lf3_27
+.Lf3_26:
+    movq $93, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $74, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_28
+.Lf3_27:
+    movslq -80(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf3_28:
+    movl %eax, -4(%rbp)
+    .loc 1 383 9
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_30
+    jmp .Lf3_29
+.Lf3_30:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_32
+    jmp .Lf3_31
+.Lf3_32:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_31:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_29:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf3_1:
+    .loc 1 386 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 387 9
+    .p2align 4,,10
+.Lf3_35:
+    .loc 1 388 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_37
+    jmp .Lf3_38
+.Lf3_37:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_39
+.Lf3_38:
+    movslq -340(%rbp), %rax
+.Lf3_39:
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_36
+    jmp .Lf3_33
+.Lf3_36:
+    .loc 1 390 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 391 17
+    jmp .Lf3_43
+    .p2align 4,,10
+.Lf3_42:
+    .loc 1 392 21
+    movq $2, %rax
+    push %rax
+    movq $69, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $36, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_45
+    jmp .Lf3_44
+.Lf3_45:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_44:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 393 21
+    movslq -80(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_46
+    jmp .Lf3_47
+.Lf3_46:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_50
+    jmp .Lf3_49
+.Lf3_50:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_49:
+    jmp .Lf3_48
+.Lf3_47:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_51
+    jmp .Lf3_52
+.Lf3_51:
+    movslq -344(%rbp), %rax
+    jmp .Lf3_53
+.Lf3_52:
+    movslq -340(%rbp), %rax
+.Lf3_53:
+.Lf3_48:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_55
+    jmp .Lf3_54
+.Lf3_55:
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_54:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 394 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_56
+    jmp .Lf3_57
+.Lf3_56:
+    movslq -56(%rbp), %rax
+    jmp .Lf3_58
+.Lf3_57:
+    movq $55, %rax
+.Lf3_58:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movq $17, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_60
+    jmp .Lf3_59
+.Lf3_60:
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_59:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 395 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_41:
+.Lf3_43:
+    .loc 1 391 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_42
+.Lf3_40:
+    addq $0, %rsp
+    .loc 1 398 13
+    movq $63, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_62
+    jmp .Lf3_61
+.Lf3_62:
+    movq $20, %rax
+    cmpq $24, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_61:
+    push %rax
+    movslq -32(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $71, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 399 13
+    movq $53, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $10, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $5, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 400 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_34:
+    .loc 1 401 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_35
+.Lf3_33:
+    addq $8, %rsp
+    .loc 1 403 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_68
+    .p2align 4,,10
+.Lf3_67:
+    .loc 1 405 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 406 13
+    jmp .Lf3_72
+    .p2align 4,,10
+.Lf3_71:
+    .loc 1 407 17
+    movq $39, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_74
+    jmp .Lf3_73
+.Lf3_74:
+    cmpl $36, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_73:
+    push %rax
+    cmpl $70, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_75
+    jmp .Lf3_76
+.Lf3_75:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_77
+.Lf3_76:
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_79
+    jmp .Lf3_78
+.Lf3_79:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_78:
+.Lf3_77:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 408 17
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf3_80
+    jmp .Lf3_81
+.Lf3_80:
+    movq $94, %rax
+    jmp .Lf3_82
+.Lf3_81:
+    movslq -12(%rbp), %rax
+.Lf3_82:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_84
+    jmp .Lf3_83
+.Lf3_84:
+    movslq -4(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_83:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_86
+    jmp .Lf3_85
+.Lf3_86:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_85:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 409 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_90
+    jmp .Lf3_91
+.Lf3_90:
+    movq $62, %rax
+    jmp .Lf3_92
+.Lf3_91:
+    movslq -4(%rbp), %rax
+.Lf3_92:
+    push %rax
+    movq $99, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_87
+    jmp .Lf3_88
+.Lf3_87:
+    movq $6, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    imulq $58, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_89
+.Lf3_88:
+    movslq -8(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_94
+    jmp .Lf3_93
+.Lf3_94:
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf3_89:
+    movl %eax, -12(%rbp)
+    .loc 1 410 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_70:
+.Lf3_72:
+    .loc 1 406 20
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_71
+.Lf3_69:
+    addq $0, %rsp
+    .loc 1 413 9
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $8, %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_95
+    jmp .Lf3_96
+.Lf3_95:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_99
+    jmp .Lf3_98
+.Lf3_99:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_98:
+    push %rax
+    cmpl $81, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_97
+.Lf3_96:
+    movq $83, %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_101
+    jmp .Lf3_100
+.Lf3_101:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_100:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf3_97:
+    movl %eax, -12(%rbp)
+    .loc 1 414 9
+    cmpl $71, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_103
+    jmp .Lf3_102
+.Lf3_103:
+    movq $9, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_102:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_104
+    jmp .Lf3_105
+.Lf3_104:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_106
+.Lf3_105:
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_106:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    addq $0, %rsp
+.Lf3_66:
+    .loc 1 403 30
+    incl -340(%rbp)
+.Lf3_68:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_67
+.Lf3_65:
+    addq $8, %rsp
+    .loc 1 416 5
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_107
+    jmp .Lf3_108
+.Lf3_107:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_109
+.Lf3_108:
+    movslq -52(%rbp), %rax
+.Lf3_109:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 418 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 419 9
+    jmp .Lf3_113
+    .p2align 4,,10
+.Lf3_112:
+    .loc 1 420 13
+    movq $4, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_114
+    jmp .Lf3_110
+.Lf3_114:
+    .loc 1 421 13
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_116
+    jmp .Lf3_115
+.Lf3_116:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_115:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 422 13
+    movslq -16(%rbp), %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $36, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $71, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    cmpq $0, %rax
+    jne .Lf3_117
+    jmp .Lf3_118
+.Lf3_117:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_119
+.Lf3_118:
+    movq $37, %rax
+.Lf3_119:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    .loc 1 424 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 425 17
+    .p2align 4,,10
+.Lf3_122:
+    .loc 1 426 21
+    movq $3, %rax
+    push %rax
+    movq $68, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_123
+    jmp .Lf3_120
+.Lf3_123:
+    .loc 1 427 21
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_124
+    jmp .Lf3_125
+.Lf3_124:
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_126
+.Lf3_125:
+    movq $1, %rax
+    push %rax
+    movq $86, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_126:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_128
+    jmp .Lf3_127
+.Lf3_128:
+    movslq -8(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $74, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_127:
+    movl %eax, -16(%rbp)
+    .loc 1 428 21
+    movslq -80(%rbp), %rax
+    addq $15, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $91, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $97, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $48, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 429 21
+    movslq -36(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    subq $6, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_130
+    jmp .Lf3_129
+.Lf3_130:
+    movslq -24(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_131
+    jmp .Lf3_132
+.Lf3_131:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_135
+    jmp .Lf3_134
+.Lf3_135:
+    movq $84, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_134:
+    jmp .Lf3_133
+.Lf3_132:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_136
+    jmp .Lf3_137
+.Lf3_136:
+    movq $90, %rax
+    jmp .Lf3_138
+.Lf3_137:
+    movq $58, %rax
+.Lf3_138:
+.Lf3_133:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_129:
+    movl %eax, -60(%rbp)
+    .loc 1 430 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_121:
+    .loc 1 431 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_122
+.Lf3_120:
+    addq $0, %rsp
+    .loc 1 433 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_111:
+.Lf3_113:
+    .loc 1 419 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_112
+.Lf3_110:
+    addq $8, %rsp
+    .loc 1 437 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 438 9
+    jmp .Lf3_142
+    .p2align 4,,10
+.Lf3_141:
+    .loc 1 439 13
+    cmpl $0, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $63, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $17, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 440 13
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $84, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 442 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 443 17
+    jmp .Lf3_146
+    .p2align 4,,10
+.Lf3_145:
+    .loc 1 444 21
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_147
+    jmp .Lf3_148
+.Lf3_147:
+    cmpl $66, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf3_149
+.Lf3_148:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf3_149:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 445 21
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $25, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 446 21
+    movq $28, %rax
+    cmpq $0, %rax
+    jne .Lf3_150
+    jmp .Lf3_151
+.Lf3_150:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_152
+.Lf3_151:
+    movq $36, %rax
+.Lf3_152:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_154
+    jmp .Lf3_153
+.Lf3_154:
+    cmpl $52, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_153:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_156
+    jmp .Lf3_155
+.Lf3_156:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_161
+    jmp .Lf3_160
+.Lf3_161:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_160:
+    cmpq $0, %rax
+    jne .Lf3_157
+    jmp .Lf3_158
+.Lf3_157:
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_159
+.Lf3_158:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    setg %al
+.Lf3_159:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_155:
+    movl %eax, -56(%rbp)
+    .loc 1 447 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_144:
+.Lf3_146:
+    .loc 1 443 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_145
+.Lf3_143:
+    addq $0, %rsp
+    .loc 1 450 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_140:
+.Lf3_142:
+    .loc 1 438 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_141
+.Lf3_139:
+    addq $8, %rsp
+    .loc 1 454 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 455 9
+    jmp .Lf3_165
+    .p2align 4,,10
+.Lf3_164:
+    .loc 1 456 13
+    movq $31, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_167
+    jmp .Lf3_166
+.Lf3_167:
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_166:
+    movl %eax, -8(%rbp)
+    .loc 1 457 13
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $0, %rax
+    addq $89, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 459 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 460 17
+    .p2align 4,,10
+.Lf3_170:
+    .loc 1 461 21
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_174
+    jmp .Lf3_175
+.Lf3_174:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_176
+.Lf3_175:
+    movslq -340(%rbp), %rax
+.Lf3_176:
+    cmpq $0, %rax
+    jne .Lf3_171
+    jmp .Lf3_172
+.Lf3_171:
+    movq $13, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_173
+.Lf3_172:
+    cmpl $15, -4(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf3_173:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_181
+    jmp .Lf3_180
+.Lf3_181:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_180:
+    cmpq $0, %rax
+    jne .Lf3_177
+    jmp .Lf3_178
+.Lf3_177:
+    movq $12, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_179
+.Lf3_178:
+    movq $66, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_179:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 462 21
+    cmpl $75, -48(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_182
+    jmp .Lf3_183
+.Lf3_182:
+    movq $50, %rax
+    jmp .Lf3_184
+.Lf3_183:
+    movslq -4(%rbp), %rax
+.Lf3_184:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_186
+    jmp .Lf3_185
+.Lf3_186:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_185:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 463 21
+    movq $8, %rax
+    push %rax
+    movq $68, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $62, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 464 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_169:
+    .loc 1 465 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_170
+.Lf3_168:
+    addq $0, %rsp
+    .loc 1 467 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_163:
+.Lf3_165:
+    .loc 1 455 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_164
+.Lf3_162:
+    addq $8, %rsp
+    .loc 1 470 5
+    movq $96, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_188
+    jmp .Lf3_189
+.Lf3_188:
+    movq $47, %rax
+    jmp .Lf3_190
+.Lf3_189:
+    movslq -12(%rbp), %rax
+.Lf3_190:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_191
+    .loc 1 471 9
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_193
+    jmp .Lf3_192
+.Lf3_193:
+    movq $98, %rax
+    cmpq $27, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_195
+    jmp .Lf3_194
+.Lf3_195:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_194:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_192:
+    movl %eax, -4(%rbp)
+    .loc 1 472 9
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 473 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_197
+    jmp .Lf3_196
+.Lf3_197:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_196:
+    push %rax
+    movq $74, %rax
+    cmpq $0, %rax
+    jne .Lf3_198
+    jmp .Lf3_199
+.Lf3_198:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_200
+.Lf3_199:
+    movslq -16(%rbp), %rax
+.Lf3_200:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_201
+    jmp .Lf3_202
+.Lf3_201:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_203
+.Lf3_202:
+    movslq -8(%rbp), %rax
+.Lf3_203:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_204
+    jmp .Lf3_205
+.Lf3_204:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_206
+.Lf3_205:
+    movslq -8(%rbp), %rax
+.Lf3_206:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_187
+.Lf3_191:
+    .loc 1 475 9
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_207
+    jmp .Lf3_208
+.Lf3_207:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_209
+.Lf3_208:
+    movslq -44(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_209:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 476 9
+    movslq -4(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $82, %rax
+    imulq $82, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_210
+    jmp .Lf3_211
+.Lf3_210:
+    movslq -44(%rbp), %rax
+    jmp .Lf3_212
+.Lf3_211:
+    movslq -16(%rbp), %rax
+.Lf3_212:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 477 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_214
+    jmp .Lf3_213
+.Lf3_214:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_213:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_216
+    jmp .Lf3_215
+.Lf3_216:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_218
+    jmp .Lf3_217
+.Lf3_218:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_217:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_215:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_219
+    jmp .Lf3_220
+.Lf3_219:
+    cmpl $92, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_221
+.Lf3_220:
+    movq $6, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_221:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -76(%rbp)
+    addq $0, %rsp
+.Lf3_187:
+    .loc 1 479 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_227
+    .p2align 4,,10
+.Lf3_226:
+    .loc 1 480 9
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $29, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 481 9
+    movslq -340(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_229
+    jmp .Lf3_228
+.Lf3_229:
+    movq $97, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_228:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 482 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_235
+    .p2align 4,,10
+.Lf3_234:
+    .loc 1 483 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_236
+    jmp .Lf3_237
+.Lf3_236:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf3_238
+.Lf3_237:
+    movslq -40(%rbp), %rax
+.Lf3_238:
+    push %rax
+    movq $27, %rax
+    cmpq $0, %rax
+    jne .Lf3_239
+    jmp .Lf3_240
+.Lf3_239:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_241
+.Lf3_240:
+    movslq -12(%rbp), %rax
+.Lf3_241:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_243
+    jmp .Lf3_242
+.Lf3_243:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_242:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 484 13
+    movq $93, %rax
+    subq $90, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_244
+    jmp .Lf3_245
+.Lf3_244:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_246
+.Lf3_245:
+    movslq -344(%rbp), %rax
+.Lf3_246:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $98, %rax
+    cmpq $13, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_247
+    jmp .Lf3_248
+.Lf3_247:
+    movq $68, %rax
+    jmp .Lf3_249
+.Lf3_248:
+    movslq -4(%rbp), %rax
+.Lf3_249:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -28(%rbp)
+    .loc 1 485 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_251
+    jmp .Lf3_250
+.Lf3_251:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_250:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_253
+    jmp .Lf3_252
+.Lf3_253:
+    movq $72, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_252:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $78, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_255
+    jmp .Lf3_254
+.Lf3_255:
+    movq $7, %rax
+    push %rax
+    movq $32, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_254:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_233:
+    .loc 1 482 36
+    incl -344(%rbp)
+.Lf3_235:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_234
+.Lf3_232:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf3_225:
+    .loc 1 479 32
+    incl -340(%rbp)
+.Lf3_227:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_226
+.Lf3_224:
+    addq $8, %rsp
+    .loc 1 489 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 490 9
+    .p2align 4,,10
+.Lf3_258:
+    .loc 1 491 13
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_260
+    jmp .Lf3_259
+.Lf3_260:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_259:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 493 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 494 17
+    .p2align 4,,10
+.Lf3_263:
+    .loc 1 495 21
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_264
+    jmp .Lf3_261
+.Lf3_264:
+    .loc 1 496 21
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_265
+    jmp .Lf3_266
+.Lf3_265:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_268
+    jmp .Lf3_269
+.Lf3_268:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf3_270
+.Lf3_269:
+    movq $46, %rax
+.Lf3_270:
+    jmp .Lf3_267
+.Lf3_266:
+    cmpl $79, -8(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf3_267:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $55, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 497 21
+    movq $5, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $27, -56(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $68, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $29, %rax
+    cmpq $0, %rax
+    jne .Lf3_271
+    jmp .Lf3_272
+.Lf3_271:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_273
+.Lf3_272:
+    movslq -56(%rbp), %rax
+.Lf3_273:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 498 21
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_274
+    jmp .Lf3_275
+.Lf3_274:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_276
+.Lf3_275:
+    movslq -68(%rbp), %rax
+.Lf3_276:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    cmpl $24, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -76(%rbp)
+    .loc 1 499 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_262:
+    .loc 1 500 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_263
+.Lf3_261:
+    addq $0, %rsp
+    .loc 1 502 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_277
+    jmp .Lf3_278
+.Lf3_277:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_279
+.Lf3_278:
+    movq $27, %rax
+.Lf3_279:
+    push %rax
+    cmpl $69, -40(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $26, %rax
+    cmpq $46, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 503 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_257:
+    .loc 1 504 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_258
+.Lf3_256:
+    addq $8, %rsp
+    .loc 1 506 5
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_281
+    jmp .Lf3_280
+.Lf3_281:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_280:
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
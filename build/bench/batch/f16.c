@@ -0,0 +1,104 @@
+int f0() {
+    int v0 = 59;
+    int v1 = 85;
+    int v2 = 51;
+    int v3 = 42;
+    int a0[16];
+    int a1[4][16];
+    if ((((46 / 9) ? (v1 / 6) : (v3 - v0)) && ((v3 / 4) == (v1 && a0[13])))) {
+        v0 = (((70 % 5) > (v3 * a0[9])) >= ((v3 - v3) % 6));
+        v1 = (((v1 && a0[0]) + (a1[2][4] / 4)) == ((v1 - 9) >= (a1[0][9] - v2)));
+        v2 = (((a0[13] && v1) || (v2 && 51)) != ((48 ? v0 : v1) > (34 >= v3)));
+    } else {
+        a1[3][11] = (((a1[0][2] != 46) >= (77 - a1[2][6])) ? ((v1 / 3) + (85 - a1[1][9])) : ((v1 > a1[3][9]) || (v0 ? v0 : v1)));
+        v2 = (((57 ? 43 : v2) && (a1[2][12] && v0)) > ((41 + v3) && (a1[3][3] <= v2)));
+        a1[0][11] = (((a0[7] < v0) != (v0 != v1)) && ((v0 && 35) < (39 * 96)));
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((v2 > v2) - (42 == v0)) ? ((v0 * 52) % 5) : ((a0[14] + a1[2][9]) ? (i0 == a1[0][1]) : (a0[13] && v1)));
+        a0[5] = (((a1[2][8] * 0) < (v3 * i0)) ? ((v1 / 8) == (10 + 95)) : ((a0[15] == 94) ? (v2 ? 5 : i0) : (v0 > 52)));
+        {
+            int i1 = 0;
+            do {
+                a0[7] = (((v2 > 86) ? (75 ? v0 : a0[10]) : (i1 <= 50)) + ((i1 <= i1) - (23 - i0)));
+                a0[10] = (((a0[13] != 5) % 4) % 8);
+                v1 = (((81 == a0[0]) / 4) > ((a0[6] + v3) ? (v1 == v0) : (a1[3][7] % 2)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+    }
+    a1[3][12] = (((v1 * 91) == (v0 + 33)) && ((v3 ? 27 : a0[15]) >= (v3 || a1[0][9])));
+    if ((((a0[8] > 95) ? (4 <= a0[2]) : (29 && a1[1][11])) / 9)) {
+        a0[9] = (((v2 <= a1[0][0]) * (a0[0] / 5)) >= ((v1 != v0) == (v3 != v1)));
+        v0 = (((v2 ? 74 : v0) - (v3 <= a1[2][6])) && ((v1 >= a0[1]) || (v0 <= 92)));
+        a1[1][1] = (((v1 && a0[14]) || (v3 <= v3)) > ((83 == 34) > (v3 >= v2)));
+    } else {
+        v0 = (((a0[9] != a1[2][7]) % 7) || ((v1 || a0[7]) * (v3 && a0[3])));
+        v2 = (((a0[11] / 4) - (a1[0][11] ? v3 : v2)) >= ((98 % 2) < (v1 && 7)));
+        v2 = (((v2 && v1) / 4) <= ((v1 >= a0[9]) < (a0[14] * v0)));
+    }
+    a0[8] = (((v1 % 7) < (15 == v3)) < ((a1[0][7] - v3) <= (v1 % 1)));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v3 = (((v2 && i2) ? (v1 != a0[7]) : (v2 / 1)) == ((26 % 5) / 1));
+            v2 = (((i2 / 5) / 4) % 5);
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v2 = (((a0[4] <= v3) ? (a0[0] * v1) : (i3 == v1)) > ((a1[1][5] == v0) > (a0[3] > v1)));
+                v1 = (((a0[0] && v2) != (i3 - 1)) != ((a1[1][15] || 37) / 7));
+                v0 = (((v2 % 7) == (v3 || i3)) + ((a1[3][4] + a1[3][1]) < (v2 || a1[2][14])));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v1 > a1[2][11]) != (i4 == i4)) ? ((a1[1][12] % 2) ? (i4 * a1[0][6]) : (a1[0][6] == a0[11])) : ((89 ? 24 : 56) != (47 && a0[11])));
+                    v3 = (((77 < v1) + (a1[3][2] % 8)) + ((a1[2][8] / 2) / 5));
+                    v1 = (((32 > 23) * (i5 && 65)) <= ((99 + v0) % 7));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v3 = (((i4 ? a0[9] : i4) < (v2 >= v2)) ? ((v2 ? v2 : 7) * (43 && v3)) : ((v3 ? a0[7] : v1) + (97 >= 88)));
+            v2 = (((v2 <= v0) - (9 - a1[1][13])) >= ((9 >= 32) * (v1 != 87)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    v3 = (((80 ? a1[3][9] : 94) % 9) < ((77 || a1[2][3]) || (a0[13] != 2)));
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v0 = (((79 != v1) + (a1[0][0] * 35)) >= ((a1[0][1] == 94) == (v0 != i6)));
+                v0 = (((89 >= a0[5]) / 9) ? ((i7 % 6) ? (20 || 99) : (v2 >= 51)) : ((i6 && a1[1][7]) - (a0[12] > v2)));
+                a0[3] = (((v3 / 7) == (i6 ? a0[12] : i7)) == ((v2 ? 83 : a1[3][12]) || (v1 && v2)));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+        a1[1][14] = (((a1[1][9] * 64) < (a1[1][2] >= v2)) * ((a1[0][4] >= v3) > (a1[2][11] == a1[0][1])));
+        v0 = (((v2 / 3) > (v0 / 3)) * ((v0 ? v0 : a1[3][5]) * (96 - a1[3][9])));
+    }
+    {
+        int i8 = 0;
+        do {
+            v3 = (((a1[1][9] / 4) % 8) != ((v3 || v3) < (i8 || v2)));
+            v2 = (((a0[3] > a1[2][4]) / 4) - ((a0[12] % 5) % 7));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                a0[14] = (((a0[15] != a0[4]) < (i8 <= v0)) ? ((v0 != v3) ? (i8 <= a0[13]) : (a1[3][5] <= a1[0][1])) : ((95 >= 60) > (57 || i9)));
+                v3 = (((35 >= 96) > (v2 && a1[0][7])) * ((76 < 35) % 5));
+                a1[2][10] = (((v2 >= v2) >= (57 == v2)) || ((a1[3][6] * v0) == (i9 % 8)));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    return (((v3 ? v3 : v0) == (v0 < v2)) != ((59 / 1) <= (v2 <= v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
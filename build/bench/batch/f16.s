@@ -0,0 +1,2390 @@
+    .file 1 "build/bench/batch/f16.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 100 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 101 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 102 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 103 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $59, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $85, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $51, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $42, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    movq $9, %rax
+    push %rax
+    movq $46, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_2
+    jmp .Lf0_3
+.Lf0_2:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_4
+.Lf0_3:
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_4:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_6
+    jmp .Lf0_5
+.Lf0_6:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_5:
+    cmpq $0, %rax
+    je .Lf0_9
+    .loc 1 9 9
+    movq $5, %rax
+    push %rax
+    movq $70, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 10 9
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_11
+    jmp .Lf0_10
+.Lf0_11:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_10:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $9, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 11 9
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_13
+    jmp .Lf0_12
+.Lf0_13:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_12:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_15
+    jmp .Lf0_14
+.Lf0_15:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_17
+    jmp .Lf0_16
+.Lf0_17:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_16:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_14:
+    push %rax
+    movq $48, %rax
+    cmpq $0, %rax
+    jne .Lf0_18
+    jmp .Lf0_19
+.Lf0_18:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_20
+.Lf0_19:
+    movslq -8(%rbp), %rax
+.Lf0_20:
+    push %rax
+    movq $34, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_1
+.Lf0_9:
+    .loc 1 13 9
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $46, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movq $77, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_22
+.Lf0_21:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movq $85, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_23
+.Lf0_22:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_25
+    jmp .Lf0_24
+.Lf0_25:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_26
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_28
+.Lf0_27:
+    movslq -8(%rbp), %rax
+.Lf0_28:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_24:
+.Lf0_23:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 14 9
+    movq $57, %rax
+    cmpq $0, %rax
+    jne .Lf0_29
+    jmp .Lf0_30
+.Lf0_29:
+    movq $43, %rax
+    jmp .Lf0_31
+.Lf0_30:
+    movslq -12(%rbp), %rax
+.Lf0_31:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_33
+    jmp .Lf0_32
+.Lf0_33:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_35
+    jmp .Lf0_34
+.Lf0_35:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_34:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_32:
+    push %rax
+    movq $41, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_37
+    jmp .Lf0_36
+.Lf0_37:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_36:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 15 9
+    movslq -52(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_38
+.Lf0_39:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_40
+.Lf0_41:
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_40:
+    push %rax
+    movq $39, %rax
+    imulq $96, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_38:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_1:
+    .loc 1 17 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_47
+    .p2align 4,,10
+.Lf0_46:
+    .loc 1 18 9
+    movq $42, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_48
+    jmp .Lf0_49
+.Lf0_48:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $52, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_50
+.Lf0_49:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -24(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_51
+    jmp .Lf0_52
+.Lf0_51:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_53
+.Lf0_52:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_54
+.Lf0_55:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_54:
+.Lf0_53:
+.Lf0_50:
+    movl %eax, -16(%rbp)
+    .loc 1 19 9
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    imulq $0, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_56
+    jmp .Lf0_57
+.Lf0_56:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $10, %rax
+    addq $95, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_58
+.Lf0_57:
+    cmpl $94, -20(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_63
+.Lf0_62:
+    movq $5, %rax
+    jmp .Lf0_64
+.Lf0_63:
+    movslq -340(%rbp), %rax
+.Lf0_64:
+    jmp .Lf0_61
+.Lf0_60:
+    cmpl $52, -4(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_61:
+.Lf0_58:
+    movl %eax, -60(%rbp)
+    .loc 1 21 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 22 13
+    .p2align 4,,10
+.Lf0_67:
+    .loc 1 23 17
+    movq $23, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $86, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_68
+    jmp .Lf0_69
+.Lf0_68:
+    movq $75, %rax
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_72
+.Lf0_71:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -40(%rbp), %rax
+.Lf0_73:
+    jmp .Lf0_70
+.Lf0_69:
+    cmpl $50, -344(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf0_70:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 24 17
+    movq $8, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    cmpl $5, -28(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 25 17
+    movq $4, %rax
+    push %rax
+    movq $81, %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_74
+    jmp .Lf0_75
+.Lf0_74:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_76
+.Lf0_75:
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_76:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 26 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_66:
+    .loc 1 27 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_67
+.Lf0_65:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_45:
+    .loc 1 17 30
+    incl -340(%rbp)
+.Lf0_47:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_46
+.Lf0_44:
+    addq $8, %rsp
+    .loc 1 30 5
+    movslq -8(%rbp), %rax
+    imulq $91, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $33, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_77
+.Lf0_78:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_79
+    jmp .Lf0_80
+.Lf0_79:
+    movq $27, %rax
+    jmp .Lf0_81
+.Lf0_80:
+    movslq -20(%rbp), %rax
+.Lf0_81:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_83
+    jmp .Lf0_82
+.Lf0_83:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_82:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_77:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 31 5
+    movq $9, %rax
+    push %rax
+    cmpl $95, -48(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_85
+    jmp .Lf0_86
+.Lf0_85:
+    movq $4, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_87
+.Lf0_86:
+    movq $29, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_88
+.Lf0_89:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_88:
+.Lf0_87:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_90
+    .loc 1 32 9
+    movq $5, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -44(%rbp)
+    .loc 1 33 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_92
+.Lf0_91:
+    movq $74, %rax
+    jmp .Lf0_93
+.Lf0_92:
+    movslq -4(%rbp), %rax
+.Lf0_93:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_95
+    jmp .Lf0_94
+.Lf0_95:
+    movslq -8(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_97
+    jmp .Lf0_96
+.Lf0_97:
+    cmpl $92, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_96:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_94:
+    movl %eax, -4(%rbp)
+    .loc 1 34 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_98
+.Lf0_99:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_98:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_101
+    jmp .Lf0_100
+.Lf0_101:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_100:
+    push %rax
+    movq $83, %rax
+    cmpq $34, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_84
+.Lf0_90:
+    .loc 1 36 9
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_103
+    jmp .Lf0_102
+.Lf0_103:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_105
+    jmp .Lf0_104
+.Lf0_105:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_104:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_107
+    jmp .Lf0_106
+.Lf0_107:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_106:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_102:
+    movl %eax, -4(%rbp)
+    .loc 1 37 9
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_108
+    jmp .Lf0_109
+.Lf0_108:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_110
+.Lf0_109:
+    movslq -12(%rbp), %rax
+.Lf0_110:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $98, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_112
+    jmp .Lf0_111
+.Lf0_112:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_111:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 38 9
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_113
+.Lf0_114:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_113:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -24(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_84:
+    .loc 1 40 5
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $15, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -48(%rbp)
+    .loc 1 42 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 43 9
+    jmp .Lf0_118
+    .p2align 4,,10
+.Lf0_117:
+    .loc 1 44 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_122
+.Lf0_123:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_122:
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_120
+.Lf0_119:
+    movslq -8(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_121
+.Lf0_120:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_121:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 45 13
+    movq $5, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 46 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_129
+    .p2align 4,,10
+.Lf0_128:
+    .loc 1 47 17
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_131
+.Lf0_130:
+    movslq -80(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_132:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 48 17
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_134
+    jmp .Lf0_133
+.Lf0_134:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_133:
+    push %rax
+    movslq -344(%rbp), %rax
+    subq $1, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_136
+    jmp .Lf0_135
+.Lf0_136:
+    movq $37, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_135:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 49 17
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_138
+    jmp .Lf0_137
+.Lf0_138:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_137:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_140
+    jmp .Lf0_139
+.Lf0_140:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_139:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_127:
+    .loc 1 46 38
+    incl -344(%rbp)
+.Lf0_129:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_128
+.Lf0_126:
+    addq $0, %rsp
+    .loc 1 51 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_116:
+.Lf0_118:
+    .loc 1 43 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_117
+.Lf0_115:
+    addq $8, %rsp
+    .loc 1 55 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 56 9
+    .p2align 4,,10
+.Lf0_143:
+    .loc 1 58 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 59 17
+    .p2align 4,,10
+.Lf0_146:
+    .loc 1 60 21
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_147
+    jmp .Lf0_148
+.Lf0_147:
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_152
+.Lf0_151:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_152:
+    jmp .Lf0_149
+.Lf0_148:
+    movq $89, %rax
+    cmpq $0, %rax
+    jne .Lf0_153
+    jmp .Lf0_154
+.Lf0_153:
+    movq $24, %rax
+    jmp .Lf0_155
+.Lf0_154:
+    movq $56, %rax
+.Lf0_155:
+    push %rax
+    movq $47, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_157
+    jmp .Lf0_156
+.Lf0_157:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_156:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_149:
+    movl %eax, -8(%rbp)
+    .loc 1 61 21
+    movq $5, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $77, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 62 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_159
+    jmp .Lf0_158
+.Lf0_159:
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_158:
+    push %rax
+    movq $32, %rax
+    cmpq $23, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $99, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 63 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_145:
+    .loc 1 64 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_146
+.Lf0_144:
+    addq $0, %rsp
+    .loc 1 66 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_164
+.Lf0_163:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_165
+.Lf0_164:
+    movslq -340(%rbp), %rax
+.Lf0_165:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_160
+    jmp .Lf0_161
+.Lf0_160:
+    movq $43, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_166
+.Lf0_167:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_166:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_170
+.Lf0_169:
+    movq $7, %rax
+.Lf0_170:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_162
+.Lf0_161:
+    movq $97, %rax
+    cmpq $88, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_171
+    jmp .Lf0_172
+.Lf0_171:
+    movslq -52(%rbp), %rax
+    jmp .Lf0_173
+.Lf0_172:
+    movslq -8(%rbp), %rax
+.Lf0_173:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_162:
+    movl %eax, -16(%rbp)
+    .loc 1 67 13
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    movq $9, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $87, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    cmpq $32, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 68 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_142:
+    .loc 1 69 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_143
+.Lf0_141:
+    addq $8, %rsp
+    .loc 1 71 5
+    movq $9, %rax
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_175
+.Lf0_174:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf0_176
+.Lf0_175:
+    movq $94, %rax
+.Lf0_176:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_180
+    jmp .Lf0_179
+.Lf0_180:
+    cmpl $2, -28(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_179:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 72 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_186
+    .p2align 4,,10
+.Lf0_185:
+    .loc 1 74 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 75 13
+    .p2align 4,,10
+.Lf0_189:
+    .loc 1 76 17
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    imulq $35, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $94, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 77 17
+    movq $9, %rax
+    push %rax
+    movq $89, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_190
+    jmp .Lf0_191
+.Lf0_190:
+    movq $6, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_193
+    jmp .Lf0_194
+.Lf0_193:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_197
+    jmp .Lf0_196
+.Lf0_197:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_196:
+    jmp .Lf0_195
+.Lf0_194:
+    cmpl $51, -12(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_195:
+    jmp .Lf0_192
+.Lf0_191:
+    movslq -32(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_192:
+    movl %eax, -4(%rbp)
+    .loc 1 78 17
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_200
+    jmp .Lf0_201
+.Lf0_200:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_202
+.Lf0_201:
+    movslq -344(%rbp), %rax
+.Lf0_202:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_203
+    jmp .Lf0_204
+.Lf0_203:
+    movq $83, %rax
+    jmp .Lf0_205
+.Lf0_204:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf0_205:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_207
+    jmp .Lf0_206
+.Lf0_207:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_208
+.Lf0_209:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_208:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_206:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -68(%rbp)
+    .loc 1 79 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_188:
+    .loc 1 80 22
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_189
+.Lf0_187:
+    addq $0, %rsp
+    .loc 1 82 9
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    imulq $64, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 83 9
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_211
+.Lf0_210:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_212
+.Lf0_211:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf0_212:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_184:
+    .loc 1 72 30
+    incl -340(%rbp)
+.Lf0_186:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_185
+.Lf0_183:
+    addq $8, %rsp
+    .loc 1 86 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 87 9
+    .p2align 4,,10
+.Lf0_215:
+    .loc 1 88 13
+    movq $8, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_217
+    jmp .Lf0_216
+.Lf0_217:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_216:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 89 13
+    movq $7, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 90 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_225
+    .p2align 4,,10
+.Lf0_224:
+    .loc 1 91 17
+    movslq -20(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_226
+    jmp .Lf0_227
+.Lf0_226:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_229
+    jmp .Lf0_230
+.Lf0_229:
+    movslq -340(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_231
+.Lf0_230:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_231:
+    jmp .Lf0_228
+.Lf0_227:
+    movq $95, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_233
+    jmp .Lf0_232
+.Lf0_233:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_232:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_228:
+    movl %eax, -24(%rbp)
+    .loc 1 92 17
+    movq $5, %rax
+    push %rax
+    movq $76, %rax
+    cmpq $35, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $35, %rax
+    cmpq $96, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_234
+.Lf0_235:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 93 17
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $57, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_237
+    jmp .Lf0_236
+.Lf0_237:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_236:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_223:
+    .loc 1 90 38
+    incl -344(%rbp)
+.Lf0_225:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_224
+.Lf0_222:
+    addq $0, %rsp
+    .loc 1 95 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_214:
+    .loc 1 96 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_215
+.Lf0_213:
+    addq $8, %rsp
+    .loc 1 98 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_238
+    jmp .Lf0_239
+.Lf0_238:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_240
+.Lf0_239:
+    movslq -4(%rbp), %rax
+.Lf0_240:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $59, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
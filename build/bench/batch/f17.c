@@ -0,0 +1,217 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 63;
+    int v2 = 20;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 - v1) > (v2 < v0)) + ((v0 >= v1) % 2))) {
+        a1[1][9] = (((49 % 8) <= (a1[2][10] * a1[3][3])) == ((v1 + v3) + (a0[9] + 75)));
+        a1[0][5] = (((v1 != 19) || (v0 % 8)) != ((a0[3] != 61) >= (v3 == v3)));
+        v2 = (((a0[5] % 6) * (12 >= v3)) || ((v0 == 6) >= (a0[6] || v0)));
+    } else {
+        v0 = (((v3 < v3) % 3) % 2);
+        a1[2][13] = (((a0[10] && v0) ? (v2 + v0) : (v1 > 71)) ? ((v3 < v3) - (v1 || v3)) : ((v0 <= a1[1][13]) != (v3 || 27)));
+        v2 = (((a1[2][9] || 79) == (v3 <= v2)) / 1);
+    }
+    v2 = (((a0[0] >= a0[3]) + (31 && v2)) * ((54 ? a0[9] : 57) + (15 - 36)));
+    {
+        int i0 = 0;
+        do {
+            if ((a0[15] < a0[14]) > 92) break;
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v3 != 12) && (i0 >= v2)) && ((v2 > 64) % 5));
+                    v2 = (((a0[4] ? a0[8] : i1) * (76 != v2)) - ((a1[1][7] - a1[1][2]) >= (a1[1][5] / 1)));
+                    v2 = (((61 == 66) * (68 - 66)) != ((v3 % 4) + (v1 + v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v1 = (((v2 ? v1 : i0) == (v2 < 12)) == ((a1[1][1] ? a0[4] : 39) <= (a0[0] + 16)));
+            a1[0][4] = (((v2 && v2) != (v0 ? a0[9] : v3)) == ((83 ? v3 : v0) ? (v0 + i0) : (a1[0][4] == v1)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a0[8] = (((85 || i2) % 7) && ((v2 / 4) % 3));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((a0[6] >= a1[2][12]) > 65) break;
+                    v0 = (((i2 * a1[1][3]) - (v0 ? i2 : 93)) <= ((v3 == 51) % 1));
+                    v3 = (((i2 != i2) % 6) + ((53 ? v1 : v3) / 3));
+                    v2 = (((a0[15] ? a1[2][14] : 51) / 4) != ((a1[2][5] != 68) <= (a1[3][12] && 65)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((v0 >= 89) - (a1[3][9] + v2)) && ((a1[2][1] < v3) / 9));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((32 * v2) >= (1 < a0[7])) / 9)) {
+        v3 = (((v0 && 29) < (39 * v2)) / 1);
+        v1 = (((v0 >= a0[1]) || (89 ? 39 : a1[3][2])) % 1);
+        v0 = (((a0[13] ? a0[12] : v1) >= (19 && 54)) != ((a1[1][8] > 31) >= (v3 - v2)));
+    } else {
+        v0 = (((a0[2] || 70) > (3 % 1)) - ((a0[10] * v2) && (84 != a0[3])));
+        a1[1][5] = (((a1[0][0] != 1) % 8) - ((v3 < v3) ? (v3 % 3) : (v1 != v1)));
+        v2 = (((a0[12] <= 67) - (2 - a1[0][0])) != ((14 + a1[3][8]) != (a1[1][11] / 9)));
+    }
+    if ((((v3 == 91) + (v2 % 2)) / 5)) {
+        v3 = (((v2 ? v3 : v2) != (49 / 2)) >= ((a1[2][14] > v0) < (v2 <= v1)));
+        v0 = (((57 % 3) <= (86 && 32)) % 2);
+        v0 = (((v0 * a0[0]) < (a1[2][1] != a1[3][13])) - ((v0 <= v0) != (v3 % 6)));
+    } else {
+        v3 = (((a0[15] || v2) || (v1 + 54)) != ((v1 - v3) < (v0 ? v3 : v1)));
+        v0 = (((v2 > v0) <= (v2 / 9)) >= ((8 && a0[1]) ? (a0[14] ? v3 : a0[13]) : (57 == v2)));
+        v1 = (((a0[0] % 2) - (a1[2][11] + a1[1][3])) * ((v1 && 23) > (5 * v2)));
+    }
+    if ((((v2 || v3) < (v0 ? a1[1][5] : a1[3][4])) ? ((v2 || v0) == (a0[7] && 21)) : ((v2 + v1) <= (v2 <= a1[1][6])))) {
+        a1[2][7] = (((v2 > v0) ? (74 + v2) : (a0[1] * a0[13])) % 2);
+        a0[2] = (((v3 > v1) ? (v3 ? v0 : v2) : (v2 - a1[2][11])) - ((v2 * v0) && (43 > a1[3][13])));
+        v0 = (((v2 != v2) <= (v0 ? v1 : a0[0])) ? ((v3 * 40) < (v2 || v0)) : ((v0 * v1) && (v0 + 77)));
+    } else {
+        v3 = (((v0 + v2) < (v2 + v2)) * ((v1 / 3) != (a1[0][1] >= 24)));
+        a0[11] = (((v1 == v2) ? (a1[2][9] ? v1 : v2) : (a0[3] - v1)) + ((v3 < v0) + (16 + v2)));
+        v3 = (((v2 == v3) || (v3 >= 94)) < ((v0 || 24) >= (v3 ? v1 : v1)));
+    }
+    v2 = (((a1[2][13] >= v2) < (v0 ? 35 : a0[7])) == ((v1 ? a0[8] : a1[0][4]) - (a0[5] + v0)));
+    if ((((v1 == v3) ? (v0 < a0[8]) : (24 ? 55 : 17)) - ((v1 >= v0) <= (17 <= v2)))) {
+        a1[2][9] = (((34 / 3) % 1) ? ((v0 >= 97) ? (a1[3][10] < 14) : (33 - 56)) : ((v1 + v0) < (v2 || v3)));
+        v3 = (((v0 ? 16 : 69) || (v2 <= a0[7])) + ((v1 ? a1[3][2] : a1[1][4]) && (43 && 63)));
+        v3 = (((v1 == v2) % 3) * ((v3 / 8) >= (a1[2][4] > v0)));
+    } else {
+        a0[5] = (((34 < v2) - (a1[0][11] % 8)) <= ((v2 > 61) >= (48 == v3)));
+        a0[12] = (((v2 < a0[6]) / 9) >= ((a1[0][14] > v0) > (v0 < v3)));
+        v3 = (((a1[1][9] + a0[4]) * (27 < v2)) == ((v3 != 3) && (a0[8] >= v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v3 || 28) > 65) break;
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((i5 == 34) > 79) break;
+                v3 = (((v3 || i5) > (v1 != a0[6])) == ((a0[13] % 8) - (a0[6] != 81)));
+                v2 = (((v0 + v0) == (v1 * i5)) % 1);
+                v3 = (((v1 % 6) ? (2 ? 92 : i5) : (v3 != a0[14])) >= ((52 + i4) + (77 < 6)));
+            }
+            v0 = (((i4 && i4) < (a1[1][8] >= 77)) ? ((a0[15] % 2) * (i4 < v3)) : ((v0 % 6) ? (a0[15] % 9) : (v3 <= v3)));
+            a0[13] = (((v2 || v1) && (i4 > v0)) >= ((a0[11] >= 41) > (v0 && i4)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((79 < v2) && (v0 != v0)) ? ((a1[1][12] / 3) && (v1 - a1[0][11])) : ((v2 * v3) - (v1 + a0[13])));
+}
+int f1() {
+    int v0 = 61;
+    int v1 = 32;
+    int v2 = 54;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v3 && 49) * (i0 ? v3 : i0)) <= ((21 >= v3) + (37 / 5)));
+            {
+                int i1 = 0;
+                do {
+                    a0[1] = (((v0 > a0[11]) + (v0 - v3)) || ((a0[8] <= a1[3][15]) >= (v0 != a1[3][1])));
+                    a1[1][7] = (((40 / 8) != (v3 - v0)) > ((v0 + i1) ? (a0[4] - 20) : (a0[6] == i0)));
+                    v0 = (((i0 + 54) != (i0 != a0[12])) != ((v2 <= a1[2][5]) && (19 >= v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a0[3] = (((v3 > v0) % 1) <= ((a1[0][12] / 8) < (85 ? v0 : a1[0][13])));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v0 = (((v1 <= v1) <= (5 && v0)) == ((v2 && 94) % 8));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v0 = (((i2 * 8) >= (v3 ? 55 : a0[15])) >= ((v0 % 5) + (a1[2][9] >= v1)));
+            a0[9] = (((v0 == a0[12]) > (a1[1][6] != 53)) <= ((a1[3][10] == v3) == (a1[3][11] + 71)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v1 = (((i3 >= 50) <= (a1[2][0] <= v1)) - ((v2 ? a0[4] : 21) >= (v3 + 29)));
+                v1 = (((32 > a0[1]) % 8) == ((i3 == a0[15]) && (a1[2][11] <= i2)));
+                v0 = (((i3 != a0[8]) >= (v3 - v0)) % 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[1] % 7) > (v0 >= v0)) != ((v2 != v3) == (v3 >= 83)))) {
+        a1[2][11] = (((v0 > v0) * (v0 - a1[1][4])) % 5);
+        v1 = (((v1 <= v0) * (v3 - a1[3][10])) ? ((61 || v0) < (v2 > a0[9])) : ((a0[12] == 57) % 3));
+        v2 = (((a1[3][14] % 5) && (v0 ? 72 : 4)) - ((88 ? 54 : 46) != (a1[3][8] != a0[11])));
+    } else {
+        v0 = (((a1[1][10] >= v3) < (v0 * v2)) <= ((a1[2][12] ? v2 : v0) <= (a0[13] % 3)));
+        v3 = (((a1[2][8] != a1[0][11]) != (a0[1] == v1)) / 1);
+        v2 = (((37 + v0) - (v2 == v3)) ? ((v1 != v3) + (48 + 91)) : ((39 < 70) == (a0[2] > v3)));
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        a0[14] = (((v3 < a1[1][15]) % 1) && ((v0 / 1) != (v0 ? 96 : v0)));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            v3 = (((26 && 65) - (17 - i5)) ? ((v0 / 6) > (i5 ? v3 : a0[9])) : ((v1 / 6) == (a0[14] % 2)));
+            v0 = (((34 ? v3 : a1[3][10]) <= (v3 - 19)) > ((a0[0] / 9) / 4));
+            v0 = (((v1 + a1[3][4]) > (a1[1][13] || i4)) < ((38 <= i5) && (a0[4] - 40)));
+        }
+        v0 = (((a0[7] < v3) * (i4 * 37)) + ((v1 + 66) == (v2 || v1)));
+    }
+    v0 = (((v1 >= v0) ? (v1 != 79) : (v0 ? v1 : 66)) + ((v1 / 9) - (v0 % 1)));
+    {
+        int i6 = 0;
+        do {
+            a1[2][7] = (((0 * a0[11]) < (v3 <= a1[1][1])) && ((v2 * a0[4]) < (94 ? a0[2] : v1)));
+            a1[2][14] = (((a0[12] == v0) != (41 && 34)) == ((v3 + a1[0][12]) && (v1 == 26)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    if ((a1[1][9] ? i7 : a1[1][1]) > 83) break;
+                    a0[9] = (((a0[11] > v3) || (v2 || a0[3])) ? ((a1[3][6] >= v0) == (43 > 8)) : ((59 ? 9 : i7) || (47 > v1)));
+                    v1 = (((a0[1] ? v2 : a1[2][14]) ? (98 * v2) : (7 != 70)) >= ((v3 % 4) >= (v1 % 8)));
+                    v1 = (((v0 && i6) ? (v1 < 50) : (a1[3][13] || 92)) > ((i7 >= 25) != (a0[2] % 3)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        a1[0][7] = (((v3 ? v2 : 47) && (v1 < v0)) >= ((v3 < 32) + (v2 % 9)));
+        v0 = (((v0 <= i8) + (v2 - a1[0][10])) ? ((v2 ? v2 : i8) ? (67 + v1) : (v3 + a0[7])) : ((78 == v2) <= (22 ? i8 : i8)));
+        for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+            a1[1][7] = (((a1[2][2] || a0[2]) - (39 > v3)) / 3);
+            v3 = (((v2 <= a0[11]) <= (37 % 8)) >= ((v2 || a1[0][1]) % 2));
+            v0 = (((v1 <= v3) ? (v2 * a0[9]) : (v3 == a1[3][6])) ? ((v0 < a1[2][15]) + (v2 != i8)) : ((v3 + v1) ? (a1[1][2] < 16) : (v1 / 5)));
+        }
+    }
+    if ((((v1 - a1[0][6]) && (v2 - a1[3][7])) < ((a1[2][11] / 9) % 7))) {
+        v3 = (((86 ? v1 : v1) % 2) + ((v2 ? v3 : v2) * (v2 > v1)));
+        v0 = (((28 == v3) + (v0 || v3)) ? ((32 <= v0) <= (a0[12] && v1)) : ((v2 != v1) != (a0[6] <= v3)));
+        v1 = (((95 * 64) + (a0[3] - v2)) && ((99 != 75) ? (v2 ? a1[3][9] : v0) : (v0 > a0[13])));
+    } else {
+        a1[3][13] = (((53 || a1[0][14]) > (v0 >= a0[15])) <= ((81 < v3) == (v0 > 87)));
+        v1 = (((v1 * v0) <= (a0[2] > a1[0][5])) / 8);
+        v1 = (((a0[3] ? v0 : v1) * (45 >= v3)) == ((a1[0][8] % 7) % 2));
+    }
+    if ((((a1[2][0] > v1) + (a0[13] % 5)) >= ((a0[2] % 8) == (a1[2][14] == v2)))) {
+        a1[1][7] = (((a0[13] == a1[2][7]) - (v0 ? v1 : v0)) - ((51 % 8) || (45 && 19)));
+        v1 = (((v1 ? a0[5] : v3) || (76 - 13)) * ((v2 > 31) % 9));
+        a1[1][9] = (((36 * a1[3][9]) ? (v2 / 1) : (31 * 85)) && ((v3 % 5) <= (a1[3][9] == v1)));
+    } else {
+        v1 = (((v3 / 6) && (88 < a0[9])) && ((11 <= a0[11]) - (v2 - v1)));
+        v0 = (((a0[5] / 9) ? (a1[0][15] ? a1[0][12] : v3) : (v0 != v3)) != ((v1 && 31) > (v2 >= v3)));
+        v1 = (((v0 / 9) / 7) > ((v1 - v3) / 5));
+    }
+    return (((v2 + 74) ? (v1 + v2) : (v1 % 3)) % 7);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,5645 @@
+    .file 1 "build/bench/batch/f17.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 212 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 213 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 214 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 215 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 216 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $6, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $63, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $20, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $25, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_2
+    .loc 1 9 9
+    movq $8, %rax
+    push %rax
+    movq $49, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -44(%rbp), %rax
+    addq $75, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 10 9
+    cmpl $19, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_4
+    jmp .Lf0_3
+.Lf0_4:
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_3:
+    push %rax
+    cmpl $61, -68(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 11 9
+    movq $12, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_6
+    jmp .Lf0_5
+.Lf0_6:
+    cmpl $6, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_5:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_1
+.Lf0_2:
+    .loc 1 13 9
+    movq $2, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 14 9
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_16
+    jmp .Lf0_15
+.Lf0_16:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_15:
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_13
+.Lf0_12:
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_14
+.Lf0_13:
+    cmpl $71, -8(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_14:
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_18
+    jmp .Lf0_17
+.Lf0_18:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_17:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_11
+.Lf0_10:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_20
+    jmp .Lf0_19
+.Lf0_20:
+    movq $27, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_19:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_11:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 15 9
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_22
+    jmp .Lf0_21
+.Lf0_22:
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_21:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_1:
+    .loc 1 17 5
+    movq $15, %rax
+    subq $36, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $54, %rax
+    cmpq $0, %rax
+    jne .Lf0_23
+    jmp .Lf0_24
+.Lf0_23:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_25
+.Lf0_24:
+    movq $57, %rax
+.Lf0_25:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_27
+    jmp .Lf0_26
+.Lf0_27:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_26:
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 19 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 20 9
+    .p2align 4,,10
+.Lf0_30:
+    .loc 1 21 13
+    movslq -20(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $92, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_31
+    jmp .Lf0_28
+.Lf0_31:
+    .loc 1 23 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 24 17
+    .p2align 4,,10
+.Lf0_34:
+    .loc 1 25 21
+    cmpl $12, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_36
+    jmp .Lf0_35
+.Lf0_36:
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_35:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_38
+    jmp .Lf0_37
+.Lf0_38:
+    movq $5, %rax
+    push %rax
+    cmpl $64, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_37:
+    movl %eax, -12(%rbp)
+    .loc 1 26 21
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $76, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_41
+.Lf0_40:
+    movslq -344(%rbp), %rax
+.Lf0_41:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 27 21
+    movq $68, %rax
+    subq $66, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $61, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 28 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_33:
+    .loc 1 29 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_34
+.Lf0_32:
+    addq $0, %rsp
+    .loc 1 31 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_42
+    jmp .Lf0_43
+.Lf0_42:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_44
+.Lf0_43:
+    movslq -340(%rbp), %rax
+.Lf0_44:
+    push %rax
+    cmpl $12, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_45
+    jmp .Lf0_46
+.Lf0_45:
+    movslq -64(%rbp), %rax
+    jmp .Lf0_47
+.Lf0_46:
+    movq $39, %rax
+.Lf0_47:
+    push %rax
+    movslq -80(%rbp), %rax
+    addq $16, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 32 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_49
+    jmp .Lf0_48
+.Lf0_49:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_48:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_51
+.Lf0_50:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_52
+.Lf0_51:
+    movslq -16(%rbp), %rax
+.Lf0_52:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $83, %rax
+    cmpq $0, %rax
+    jne .Lf0_56
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_58
+.Lf0_57:
+    movslq -4(%rbp), %rax
+.Lf0_58:
+    cmpq $0, %rax
+    jne .Lf0_53
+    jmp .Lf0_54
+.Lf0_53:
+    movslq -4(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_55
+.Lf0_54:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 33 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_29:
+    .loc 1 34 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_30
+.Lf0_28:
+    addq $8, %rsp
+    .loc 1 37 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 38 9
+    jmp .Lf0_62
+    .p2align 4,,10
+.Lf0_61:
+    .loc 1 39 13
+    movq $7, %rax
+    push %rax
+    movq $85, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_64
+    jmp .Lf0_63
+.Lf0_64:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_63:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_66
+    jmp .Lf0_65
+.Lf0_66:
+    movq $3, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_65:
+    movl %eax, -48(%rbp)
+    .loc 1 41 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 42 17
+    jmp .Lf0_70
+    .p2align 4,,10
+.Lf0_69:
+    .loc 1 43 21
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_71
+    jmp .Lf0_67
+.Lf0_71:
+    .loc 1 44 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_72
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_74
+.Lf0_73:
+    movq $93, %rax
+.Lf0_74:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    cmpl $51, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 45 21
+    movq $3, %rax
+    push %rax
+    movq $53, %rax
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_76
+.Lf0_75:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_77
+.Lf0_76:
+    movslq -16(%rbp), %rax
+.Lf0_77:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 46 21
+    movq $4, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_79
+.Lf0_78:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf0_80
+.Lf0_79:
+    movq $51, %rax
+.Lf0_80:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $68, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_82
+    jmp .Lf0_81
+.Lf0_82:
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_81:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 47 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_68:
+.Lf0_70:
+    .loc 1 42 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_69
+.Lf0_67:
+    addq $0, %rsp
+    .loc 1 50 13
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $89, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_84
+    jmp .Lf0_83
+.Lf0_84:
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_83:
+    movl %eax, -12(%rbp)
+    .loc 1 51 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_60:
+.Lf0_62:
+    .loc 1 38 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_61
+.Lf0_59:
+    addq $8, %rsp
+    .loc 1 54 5
+    movq $9, %rax
+    push %rax
+    movq $32, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_86
+    .loc 1 55 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_87
+.Lf0_88:
+    movq $29, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_87:
+    push %rax
+    movq $39, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 56 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_90
+    jmp .Lf0_89
+.Lf0_90:
+    movq $89, %rax
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_92
+.Lf0_91:
+    movq $39, %rax
+    jmp .Lf0_93
+.Lf0_92:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf0_93:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_89:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 57 9
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_95
+.Lf0_94:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_96
+.Lf0_95:
+    movslq -8(%rbp), %rax
+.Lf0_96:
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $31, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_85
+.Lf0_86:
+    .loc 1 59 9
+    movslq -40(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_100
+    jmp .Lf0_99
+.Lf0_100:
+    movq $84, %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_99:
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_102
+    jmp .Lf0_101
+.Lf0_102:
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_101:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 60 9
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_104
+.Lf0_103:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_105
+.Lf0_104:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_105:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 61 9
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movq $2, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $67, -32(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    addq $14, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_85:
+    .loc 1 63 5
+    movq $5, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $91, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_107
+    .loc 1 64 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_108
+    jmp .Lf0_109
+.Lf0_108:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_110
+.Lf0_109:
+    movslq -12(%rbp), %rax
+.Lf0_110:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $49, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 65 9
+    movq $2, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $57, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_112
+    jmp .Lf0_111
+.Lf0_112:
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_111:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 66 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -80(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_106
+.Lf0_107:
+    .loc 1 68 9
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_114
+    jmp .Lf0_113
+.Lf0_114:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_113:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_116
+    jmp .Lf0_115
+.Lf0_116:
+    movslq -8(%rbp), %rax
+    addq $54, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_115:
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_118
+.Lf0_117:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_119
+.Lf0_118:
+    movslq -8(%rbp), %rax
+.Lf0_119:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 69 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_124
+    jmp .Lf0_123
+.Lf0_124:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_123:
+    cmpq $0, %rax
+    jne .Lf0_120
+    jmp .Lf0_121
+.Lf0_120:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_125
+    jmp .Lf0_126
+.Lf0_125:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_127
+.Lf0_126:
+    movslq -28(%rbp), %rax
+.Lf0_127:
+    jmp .Lf0_122
+.Lf0_121:
+    movq $57, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_122:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 70 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+    push %rax
+    movq $5, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_106:
+    .loc 1 72 5
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_135
+    jmp .Lf0_134
+.Lf0_135:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_134:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_136
+    jmp .Lf0_137
+.Lf0_136:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf0_138
+.Lf0_137:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf0_138:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_131
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_140
+    jmp .Lf0_139
+.Lf0_140:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_139:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_142
+    jmp .Lf0_141
+.Lf0_142:
+    movq $21, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_141:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_133
+.Lf0_132:
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_133:
+    cmpq $0, %rax
+    je .Lf0_143
+    .loc 1 73 9
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_144
+    jmp .Lf0_145
+.Lf0_144:
+    movq $74, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_146
+.Lf0_145:
+    movslq -76(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_146:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 74 9
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_147
+.Lf0_148:
+    movq $43, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_147:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_149
+    jmp .Lf0_150
+.Lf0_149:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_152
+    jmp .Lf0_153
+.Lf0_152:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_154
+.Lf0_153:
+    movslq -12(%rbp), %rax
+.Lf0_154:
+    jmp .Lf0_151
+.Lf0_150:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_151:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 75 9
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_158
+    jmp .Lf0_159
+.Lf0_158:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_160
+.Lf0_159:
+    movslq -80(%rbp), %rax
+.Lf0_160:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_156
+.Lf0_155:
+    movslq -16(%rbp), %rax
+    imulq $40, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_162
+    jmp .Lf0_161
+.Lf0_162:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_161:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_163
+.Lf0_164:
+    movslq -4(%rbp), %rax
+    addq $77, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_163:
+.Lf0_157:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_130
+.Lf0_143:
+    .loc 1 77 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $24, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 78 9
+    movq $16, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_165
+    jmp .Lf0_166
+.Lf0_165:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_170
+.Lf0_169:
+    movslq -12(%rbp), %rax
+.Lf0_170:
+    jmp .Lf0_167
+.Lf0_166:
+    movslq -68(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_167:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 79 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    cmpl $94, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_174
+    jmp .Lf0_173
+.Lf0_174:
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_173:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_177
+.Lf0_176:
+    movslq -8(%rbp), %rax
+.Lf0_177:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_130:
+    .loc 1 81 5
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_179
+.Lf0_178:
+    movq $35, %rax
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -52(%rbp), %rax
+.Lf0_180:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -60(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_181
+    jmp .Lf0_182
+.Lf0_181:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_183
+.Lf0_182:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf0_183:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 82 5
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $17, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_186
+.Lf0_185:
+    movslq -4(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_187
+.Lf0_186:
+    movq $24, %rax
+    cmpq $0, %rax
+    jne .Lf0_188
+    jmp .Lf0_189
+.Lf0_188:
+    movq $55, %rax
+    jmp .Lf0_190
+.Lf0_189:
+    movq $17, %rax
+.Lf0_190:
+.Lf0_187:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_191
+    .loc 1 83 9
+    movq $1, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $34, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_192
+    jmp .Lf0_193
+.Lf0_192:
+    cmpl $97, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_195
+    jmp .Lf0_196
+.Lf0_195:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $14, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_197
+.Lf0_196:
+    movq $33, %rax
+    subq $56, %rax
+    movslq %eax, %rax
+.Lf0_197:
+    jmp .Lf0_194
+.Lf0_193:
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_194:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 84 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_200
+    jmp .Lf0_201
+.Lf0_200:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf0_202
+.Lf0_201:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf0_202:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_204
+    jmp .Lf0_203
+.Lf0_204:
+    movq $43, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_205
+.Lf0_206:
+    movq $63, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_205:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_203:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_207
+    jmp .Lf0_208
+.Lf0_207:
+    movq $16, %rax
+    jmp .Lf0_209
+.Lf0_208:
+    movq $69, %rax
+.Lf0_209:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_211
+    jmp .Lf0_210
+.Lf0_211:
+    movslq -12(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_210:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 85 9
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_184
+.Lf0_191:
+    .loc 1 87 9
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $34, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $61, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $48, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -60(%rbp)
+    .loc 1 88 9
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -32(%rbp)
+    .loc 1 89 9
+    movq $27, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $3, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_213
+    jmp .Lf0_212
+.Lf0_213:
+    movslq -48(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_212:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_184:
+    .loc 1 92 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 93 9
+    .p2align 4,,10
+.Lf0_216:
+    .loc 1 94 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_217
+    jmp .Lf0_214
+.Lf0_217:
+    .loc 1 95 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_225
+    .p2align 4,,10
+.Lf0_224:
+    .loc 1 96 17
+    cmpl $34, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_229
+    jmp .Lf0_222
+.Lf0_229:
+    .loc 1 97 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_231
+    jmp .Lf0_230
+.Lf0_231:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_230:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $81, -56(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 98 17
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 99 17
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_233
+.Lf0_232:
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_236
+.Lf0_235:
+    movq $92, %rax
+    jmp .Lf0_237
+.Lf0_236:
+    movslq -344(%rbp), %rax
+.Lf0_237:
+    jmp .Lf0_234
+.Lf0_233:
+    movslq -16(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_234:
+    push %rax
+    movq $77, %rax
+    cmpq $6, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $52, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_228:
+    .loc 1 95 38
+    incl -344(%rbp)
+    .loc 1 96 17
+    cmpl $34, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_238
+    jmp .Lf0_222
+.Lf0_238:
+    .loc 1 97 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_240
+    jmp .Lf0_239
+.Lf0_240:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_239:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $81, -56(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 98 17
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 99 17
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_241
+    jmp .Lf0_242
+.Lf0_241:
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf0_244
+    jmp .Lf0_245
+.Lf0_244:
+    movq $92, %rax
+    jmp .Lf0_246
+.Lf0_245:
+    movslq -344(%rbp), %rax
+.Lf0_246:
+    jmp .Lf0_243
+.Lf0_242:
+    movslq -16(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_243:
+    push %rax
+    movq $77, %rax
+    cmpq $6, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $52, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_227:
+    .loc 1 95 38
+    incl -344(%rbp)
+.Lf0_225:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $7, %rax
+    jl .Lf0_224
+.Lf0_226:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_222
+    .loc 1 96 17
+    cmpl $34, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_247
+    jmp .Lf0_222
+.Lf0_247:
+    .loc 1 97 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_249
+    jmp .Lf0_248
+.Lf0_249:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_248:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $81, -56(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 98 17
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 99 17
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_251
+.Lf0_250:
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf0_253
+    jmp .Lf0_254
+.Lf0_253:
+    movq $92, %rax
+    jmp .Lf0_255
+.Lf0_254:
+    movslq -344(%rbp), %rax
+.Lf0_255:
+    jmp .Lf0_252
+.Lf0_251:
+    movslq -16(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_252:
+    push %rax
+    movq $77, %rax
+    cmpq $6, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $52, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_223:
+    .loc 1 95 38
+    incl -344(%rbp)
+    jmp .Lf0_226
+.Lf0_222:
+    addq $0, %rsp
+    .loc 1 101 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_260
+    jmp .Lf0_259
+.Lf0_260:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_259:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $77, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_256
+    jmp .Lf0_257
+.Lf0_256:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_258
+.Lf0_257:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_261
+    jmp .Lf0_262
+.Lf0_261:
+    movq $9, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_263
+.Lf0_262:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_263:
+.Lf0_258:
+    movl %eax, -4(%rbp)
+    .loc 1 102 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_265
+    jmp .Lf0_264
+.Lf0_265:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_264:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_267
+    jmp .Lf0_266
+.Lf0_267:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_266:
+    push %rax
+    cmpl $41, -36(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_269
+    jmp .Lf0_268
+.Lf0_269:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_268:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -28(%rbp)
+    .loc 1 103 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_215:
+    .loc 1 104 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_216
+.Lf0_214:
+    addq $8, %rsp
+    .loc 1 106 5
+    movq $79, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_274
+    jmp .Lf0_273
+.Lf0_274:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_273:
+    cmpq $0, %rax
+    jne .Lf0_270
+    jmp .Lf0_271
+.Lf0_270:
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_276
+    jmp .Lf0_275
+.Lf0_276:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_275:
+    jmp .Lf0_272
+.Lf0_271:
+    movslq -8(%rbp), %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_272:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 108 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 109 5
+    subq $8, %rsp
+    movq $61, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 110 5
+    movq $32, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 111 5
+    subq $8, %rsp
+    movq $54, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 112 5
+    movq $4, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 113 5
+    subq $64, %rsp
+    .loc 1 114 5
+    subq $256, %rsp
+    .loc 1 116 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 117 9
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 118 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_4
+    jmp .Lf1_5
+.Lf1_4:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_6
+.Lf1_5:
+    movslq -340(%rbp), %rax
+.Lf1_6:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_8
+    jmp .Lf1_7
+.Lf1_8:
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_7:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $37, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 120 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 121 17
+    .p2align 4,,10
+.Lf1_11:
+    .loc 1 122 21
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_13
+    jmp .Lf1_12
+.Lf1_13:
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_12:
+    movl %eax, -76(%rbp)
+    .loc 1 123 21
+    movq $8, %rax
+    push %rax
+    movq $40, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_14
+    jmp .Lf1_15
+.Lf1_14:
+    movslq -64(%rbp), %rax
+    subq $20, %rax
+    movslq %eax, %rax
+    jmp .Lf1_16
+.Lf1_15:
+    movslq -56(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_16:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 124 21
+    movslq -340(%rbp), %rax
+    addq $54, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_17
+.Lf1_18:
+    movq $19, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_17:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 125 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_10:
+    .loc 1 126 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_11
+.Lf1_9:
+    addq $0, %rsp
+    .loc 1 128 13
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $85, %rax
+    cmpq $0, %rax
+    jne .Lf1_19
+    jmp .Lf1_20
+.Lf1_19:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_21
+.Lf1_20:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_21:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -68(%rbp)
+    .loc 1 129 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+    .loc 1 130 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 132 5
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_22
+.Lf1_23:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_22:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_25
+    jmp .Lf1_24
+.Lf1_25:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_24:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 134 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 135 9
+    jmp .Lf1_29
+    .p2align 4,,10
+.Lf1_28:
+    .loc 1 136 13
+    movslq -340(%rbp), %rax
+    imulq $8, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_31
+.Lf1_30:
+    movq $55, %rax
+    jmp .Lf1_32
+.Lf1_31:
+    movslq -20(%rbp), %rax
+.Lf1_32:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 137 13
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    addq $71, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -44(%rbp)
+    .loc 1 138 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_38
+    .p2align 4,,10
+.Lf1_37:
+    .loc 1 139 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_42
+    jmp .Lf1_43
+.Lf1_42:
+    movslq -64(%rbp), %rax
+    jmp .Lf1_44
+.Lf1_43:
+    movq $21, %rax
+.Lf1_44:
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $29, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $50, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 140 17
+    movq $8, %rax
+    push %rax
+    movq $32, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_46
+    jmp .Lf1_45
+.Lf1_46:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_45:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 141 17
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_41:
+    .loc 1 138 38
+    incl -344(%rbp)
+    .loc 1 139 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_48
+.Lf1_47:
+    movslq -64(%rbp), %rax
+    jmp .Lf1_49
+.Lf1_48:
+    movq $21, %rax
+.Lf1_49:
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $29, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $50, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 140 17
+    movq $8, %rax
+    push %rax
+    movq $32, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 141 17
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_40:
+    .loc 1 138 38
+    incl -344(%rbp)
+.Lf1_38:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $4, %rax
+    jl .Lf1_37
+.Lf1_39:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_35
+    .loc 1 139 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_53
+.Lf1_52:
+    movslq -64(%rbp), %rax
+    jmp .Lf1_54
+.Lf1_53:
+    movq $21, %rax
+.Lf1_54:
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $29, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $50, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 140 17
+    movq $8, %rax
+    push %rax
+    movq $32, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_55
+.Lf1_56:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 141 17
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_36:
+    .loc 1 138 38
+    incl -344(%rbp)
+    jmp .Lf1_39
+.Lf1_35:
+    addq $0, %rsp
+    .loc 1 143 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_27:
+.Lf1_29:
+    .loc 1 135 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_28
+.Lf1_26:
+    addq $8, %rsp
+    .loc 1 146 5
+    movq $7, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $83, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_58
+    .loc 1 147 9
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 148 9
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_59
+    jmp .Lf1_60
+.Lf1_59:
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_63
+    jmp .Lf1_62
+.Lf1_63:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_62:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_61
+.Lf1_60:
+    movq $3, %rax
+    push %rax
+    cmpl $57, -32(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_61:
+    movl %eax, -8(%rbp)
+    .loc 1 149 9
+    movq $88, %rax
+    cmpq $0, %rax
+    jne .Lf1_64
+    jmp .Lf1_65
+.Lf1_64:
+    movq $54, %rax
+    jmp .Lf1_66
+.Lf1_65:
+    movq $46, %rax
+.Lf1_66:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_68
+    jmp .Lf1_67
+.Lf1_68:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_69
+    jmp .Lf1_70
+.Lf1_69:
+    movq $72, %rax
+    jmp .Lf1_71
+.Lf1_70:
+    movq $4, %rax
+.Lf1_71:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_67:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_57
+.Lf1_58:
+    .loc 1 151 9
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_72
+    jmp .Lf1_73
+.Lf1_72:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -4(%rbp), %rax
+.Lf1_74:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 152 9
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 153 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $37, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_75
+    jmp .Lf1_76
+.Lf1_75:
+    movq $48, %rax
+    addq $91, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_77
+.Lf1_76:
+    movq $39, %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_77:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_57:
+    .loc 1 155 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_83
+    .p2align 4,,10
+.Lf1_82:
+    .loc 1 156 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_85
+    jmp .Lf1_84
+.Lf1_85:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_86
+    jmp .Lf1_87
+.Lf1_86:
+    movq $96, %rax
+    jmp .Lf1_88
+.Lf1_87:
+    movslq -4(%rbp), %rax
+.Lf1_88:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_84:
+    movl %eax, -24(%rbp)
+    .loc 1 157 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_94
+    .p2align 4,,10
+.Lf1_93:
+    .loc 1 158 13
+    movq $17, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_99
+    jmp .Lf1_98
+.Lf1_99:
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_98:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_95
+    jmp .Lf1_96
+.Lf1_95:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_100
+    jmp .Lf1_101
+.Lf1_100:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_102
+.Lf1_101:
+    movslq -44(%rbp), %rax
+.Lf1_102:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_97
+.Lf1_96:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_97:
+    movl %eax, -16(%rbp)
+    .loc 1 159 13
+    movq $34, %rax
+    cmpq $0, %rax
+    jne .Lf1_103
+    jmp .Lf1_104
+.Lf1_103:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_105
+.Lf1_104:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf1_105:
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $19, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 160 13
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_107
+    jmp .Lf1_106
+.Lf1_107:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_106:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $38, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_109
+    jmp .Lf1_108
+.Lf1_109:
+    movslq -64(%rbp), %rax
+    subq $40, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_108:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_92:
+    .loc 1 157 34
+    incl -344(%rbp)
+.Lf1_94:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_93
+.Lf1_91:
+    addq $0, %rsp
+    .loc 1 162 9
+    movslq -8(%rbp), %rax
+    addq $66, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_111
+    jmp .Lf1_110
+.Lf1_111:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_110:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imulq $37, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_81:
+    .loc 1 155 30
+    incl -340(%rbp)
+.Lf1_83:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_82
+.Lf1_80:
+    addq $8, %rsp
+    .loc 1 164 5
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_112
+    jmp .Lf1_113
+.Lf1_112:
+    cmpl $79, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_114
+.Lf1_113:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_115
+    jmp .Lf1_116
+.Lf1_115:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_117
+.Lf1_116:
+    movq $66, %rax
+.Lf1_117:
+.Lf1_114:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 166 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 167 9
+    .p2align 4,,10
+.Lf1_120:
+    .loc 1 168 13
+    movq $0, %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_121
+.Lf1_122:
+    movslq -12(%rbp), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $94, %rax
+    cmpq $0, %rax
+    jne .Lf1_123
+    jmp .Lf1_124
+.Lf1_123:
+    movslq -72(%rbp), %rax
+    jmp .Lf1_125
+.Lf1_124:
+    movslq -8(%rbp), %rax
+.Lf1_125:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_121:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 169 13
+    movslq -32(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $41, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_127
+    jmp .Lf1_126
+.Lf1_127:
+    movq $34, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_126:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_129
+    jmp .Lf1_128
+.Lf1_129:
+    cmpl $26, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_128:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 171 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 172 17
+    jmp .Lf1_133
+    .p2align 4,,10
+.Lf1_132:
+    .loc 1 173 21
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_136
+.Lf1_135:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_137
+.Lf1_136:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf1_137:
+    cmpq $83, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_134
+    jmp .Lf1_130
+.Lf1_134:
+    .loc 1 174 21
+    movslq -36(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_142
+    jmp .Lf1_141
+.Lf1_142:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_144
+    jmp .Lf1_143
+.Lf1_144:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_143:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_141:
+    cmpq $0, %rax
+    jne .Lf1_138
+    jmp .Lf1_139
+.Lf1_138:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $43, %rax
+    cmpq $8, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_140
+.Lf1_139:
+    movq $59, %rax
+    cmpq $0, %rax
+    jne .Lf1_145
+    jmp .Lf1_146
+.Lf1_145:
+    movq $9, %rax
+    jmp .Lf1_147
+.Lf1_146:
+    movslq -344(%rbp), %rax
+.Lf1_147:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_149
+    jmp .Lf1_148
+.Lf1_149:
+    movq $47, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_148:
+.Lf1_140:
+    movl %eax, -44(%rbp)
+    .loc 1 175 21
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_154
+.Lf1_153:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_155
+.Lf1_154:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf1_155:
+    cmpq $0, %rax
+    jne .Lf1_150
+    jmp .Lf1_151
+.Lf1_150:
+    movq $98, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_152
+.Lf1_151:
+    movq $7, %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_152:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 176 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_159
+.Lf1_160:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_159:
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    cmpl $50, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_158
+.Lf1_157:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_162
+    jmp .Lf1_161
+.Lf1_162:
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_161:
+.Lf1_158:
+    push %rax
+    cmpl $25, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 177 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_131:
+.Lf1_133:
+    .loc 1 172 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_132
+.Lf1_130:
+    addq $0, %rsp
+    .loc 1 180 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_119:
+    .loc 1 181 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_120
+.Lf1_118:
+    addq $8, %rsp
+    .loc 1 183 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_168
+    .p2align 4,,10
+.Lf1_167:
+    .loc 1 184 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_169
+    jmp .Lf1_170
+.Lf1_169:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_171
+.Lf1_170:
+    movq $47, %rax
+.Lf1_171:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_173
+    jmp .Lf1_172
+.Lf1_173:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_172:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $32, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 185 9
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_174
+    jmp .Lf1_175
+.Lf1_174:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_180
+    jmp .Lf1_181
+.Lf1_180:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_182
+.Lf1_181:
+    movslq -340(%rbp), %rax
+.Lf1_182:
+    cmpq $0, %rax
+    jne .Lf1_177
+    jmp .Lf1_178
+.Lf1_177:
+    movq $67, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_179
+.Lf1_178:
+    movslq -16(%rbp), %rax
+    addl -52(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_179:
+    jmp .Lf1_176
+.Lf1_175:
+    movq $78, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    jne .Lf1_183
+    jmp .Lf1_184
+.Lf1_183:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_185
+.Lf1_184:
+    movslq -340(%rbp), %rax
+.Lf1_185:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_176:
+    movl %eax, -4(%rbp)
+    .loc 1 186 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_191
+    .p2align 4,,10
+.Lf1_190:
+    .loc 1 187 13
+    movq $3, %rax
+    push %rax
+    movq $39, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_193
+    jmp .Lf1_192
+.Lf1_193:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_192:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 188 13
+    movslq -12(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $37, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_195
+    jmp .Lf1_194
+.Lf1_195:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_194:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 189 13
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_199
+    jmp .Lf1_200
+.Lf1_199:
+    movslq -12(%rbp), %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_201
+.Lf1_200:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_201:
+    cmpq $0, %rax
+    jne .Lf1_196
+    jmp .Lf1_197
+.Lf1_196:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_198
+.Lf1_197:
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_202
+    jmp .Lf1_203
+.Lf1_202:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_204
+.Lf1_203:
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_204:
+.Lf1_198:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_189:
+    .loc 1 186 34
+    incl -344(%rbp)
+.Lf1_191:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_190
+.Lf1_188:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_166:
+    .loc 1 183 30
+    incl -340(%rbp)
+.Lf1_168:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_167
+.Lf1_165:
+    addq $8, %rsp
+    .loc 1 192 5
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_207
+    jmp .Lf1_206
+.Lf1_207:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_206:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_208
+    .loc 1 193 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_209
+    jmp .Lf1_210
+.Lf1_209:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_211
+.Lf1_210:
+    movslq -12(%rbp), %rax
+.Lf1_211:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $86, %rax
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_213
+.Lf1_212:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_214
+.Lf1_213:
+    movslq -8(%rbp), %rax
+.Lf1_214:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 194 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_219
+    jmp .Lf1_218
+.Lf1_219:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_218:
+    push %rax
+    movq $28, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_215
+    jmp .Lf1_216
+.Lf1_215:
+    movq $32, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_221
+    jmp .Lf1_220
+.Lf1_221:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_220:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_217:
+    movl %eax, -4(%rbp)
+    .loc 1 195 9
+    movslq -68(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $95, %rax
+    imulq $64, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_223
+    jmp .Lf1_222
+.Lf1_223:
+    movq $99, %rax
+    cmpq $75, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_224
+    jmp .Lf1_225
+.Lf1_224:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_227
+    jmp .Lf1_228
+.Lf1_227:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf1_229
+.Lf1_228:
+    movslq -4(%rbp), %rax
+.Lf1_229:
+    jmp .Lf1_226
+.Lf1_225:
+    movslq -4(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_226:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_222:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_205
+.Lf1_208:
+    .loc 1 197 9
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_231
+    jmp .Lf1_230
+.Lf1_231:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_230:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $81, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $87, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 198 9
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 199 9
+    movq $45, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_232
+    jmp .Lf1_233
+.Lf1_232:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_234
+.Lf1_233:
+    movslq -8(%rbp), %rax
+.Lf1_234:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_205:
+    .loc 1 201 5
+    movq $5, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf1_236
+    .loc 1 202 9
+    movq $8, %rax
+    push %rax
+    movq $51, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_238
+    jmp .Lf1_237
+.Lf1_238:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_240
+    jmp .Lf1_239
+.Lf1_240:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_239:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_237:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_241
+    jmp .Lf1_242
+.Lf1_241:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_243
+.Lf1_242:
+    movslq -4(%rbp), %rax
+.Lf1_243:
+    push %rax
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 203 9
+    movq $9, %rax
+    push %rax
+    cmpl $31, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_244
+    jmp .Lf1_245
+.Lf1_244:
+    movslq -60(%rbp), %rax
+    jmp .Lf1_246
+.Lf1_245:
+    movslq -16(%rbp), %rax
+.Lf1_246:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_248
+    jmp .Lf1_247
+.Lf1_248:
+    movq $76, %rax
+    subq $13, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_247:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 204 9
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    imulq $36, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_249
+    jmp .Lf1_250
+.Lf1_249:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_251
+.Lf1_250:
+    movq $31, %rax
+    imulq $85, %rax
+    movslq %eax, %rax
+.Lf1_251:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_253
+    jmp .Lf1_252
+.Lf1_253:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_252:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_235
+.Lf1_236:
+    .loc 1 206 9
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_254
+.Lf1_255:
+    movq $88, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_254:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_257
+    jmp .Lf1_256
+.Lf1_257:
+    movslq -12(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_256:
+    movl %eax, -8(%rbp)
+    .loc 1 207 9
+    movq $9, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_258
+    jmp .Lf1_259
+.Lf1_258:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_261
+    jmp .Lf1_262
+.Lf1_261:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf1_263
+.Lf1_262:
+    movslq -16(%rbp), %rax
+.Lf1_263:
+    jmp .Lf1_260
+.Lf1_259:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_260:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_265
+    jmp .Lf1_264
+.Lf1_265:
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_264:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 208 9
+    movq $7, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_235:
+    .loc 1 210 5
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $74, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_266
+    jmp .Lf1_267
+.Lf1_266:
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_268
+.Lf1_267:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_268:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
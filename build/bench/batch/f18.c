@@ -0,0 +1,327 @@
+int f0() {
+    int v0 = 45;
+    int v1 = 58;
+    int v2 = 45;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((58 ? a0[1] : 37) && (a0[3] - a0[1])) ? ((v0 * a0[5]) % 3) : ((a1[2][6] || 3) != (71 && a1[1][4])));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v2 = (((a0[11] == 30) - (i0 * 55)) * ((v2 != i1) == (v1 || 28)));
+                    v0 = (((i0 ? 11 : v1) || (v1 * v1)) != ((i0 || a0[6]) && (a1[0][12] != i1)));
+                    v3 = (((a0[12] * a1[2][9]) <= (i1 ? a1[0][9] : i0)) || ((a1[2][3] == a0[6]) - (v0 - v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v2 % 1) % 7) / 7);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((9 || a1[0][2]) + (a0[13] + v3)) && ((77 == a0[5]) <= (39 == 73)))) {
+        v3 = (((31 < a1[2][7]) && (v3 - 81)) || ((v2 >= v3) <= (80 / 5)));
+        v2 = (((a0[8] <= v2) * (98 + a0[3])) > ((33 % 5) + (v0 >= v3)));
+        a1[1][6] = (((a0[3] >= a0[15]) && (v3 || 52)) ? ((v3 != v3) / 5) : ((v0 && 68) / 4));
+    } else {
+        v3 = (((v2 == a1[2][13]) <= (v3 >= 56)) != ((62 > v0) <= (65 != v2)));
+        a1[0][3] = (((a1[1][2] ? a1[0][4] : a0[2]) < (93 + a0[15])) * ((a1[2][1] ? 34 : a0[7]) / 5));
+        a1[3][15] = (((a1[0][5] * 93) + (v2 >= a0[15])) * ((v2 % 6) >= (v0 > v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((66 + a1[3][0]) > 97) break;
+            a1[0][5] = (((a0[3] >= a0[13]) || (55 == v3)) <= ((76 / 5) > (v1 <= 94)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v0 ? 20 : a1[1][12]) + (43 < a0[11])) * ((i2 - i2) || (a1[3][13] < a0[5])));
+                    v3 = (((i3 % 7) - (a0[13] ? v0 : i2)) + ((v2 == v1) % 1));
+                    v1 = (((a1[3][9] + 2) != (a0[3] || a0[14])) % 3);
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v2 = (((i2 ? a0[0] : 63) ? (5 / 1) : (a1[3][13] > v1)) && ((21 == a1[1][5]) ? (v2 && i2) : (85 ? v3 : v2)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((9 <= a1[1][15]) || (a0[14] >= v2)) < ((a0[8] ? v3 : a1[1][10]) ? (v1 >= v0) : (a1[1][8] + 74)))) {
+        v0 = (((v2 + a0[0]) || (a0[15] <= v1)) == ((v2 != 27) + (v1 || v1)));
+        v2 = (((a0[15] * v0) / 3) ? ((29 && 27) ? (v0 / 2) : (80 || v0)) : ((v3 || v3) > (88 && v2)));
+        v3 = (((v3 + v3) == (a0[0] > a0[4])) && ((v3 > 40) - (v3 && 20)));
+    } else {
+        v0 = (((a0[15] > a0[14]) < (v2 <= v3)) % 9);
+        a0[9] = (((v1 + v3) || (32 ? 36 : v1)) >= ((v2 + v3) < (v1 > v3)));
+        a1[1][6] = (((v3 < 50) != (v1 / 1)) % 3);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((63 - v0) > 60) break;
+            a1[1][1] = (((a0[13] + v0) == (v0 - a0[1])) ? ((75 >= v1) - (v2 ? v2 : a1[3][8])) : ((v2 % 9) % 3));
+            v1 = (((16 > 94) == (63 > v0)) != ((v1 == 23) < (v0 && v2)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                if ((i4 ? v3 : 24) > 59) break;
+                a1[3][6] = (((6 <= 25) > (i4 == v1)) <= ((v2 > v0) > (v2 == v2)));
+                a0[12] = (((53 / 4) / 2) % 4);
+                v2 = (((v3 && a1[1][7]) + (v2 < v0)) < ((v0 - i4) >= (45 != 99)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v0 ? a0[8] : a0[10]) > (v1 > a0[7])) && ((37 % 2) ? (v2 && 37) : (v1 >= 4)));
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v0 = (((a0[13] ? i6 : a1[1][5]) || (i6 != v1)) % 2);
+        v3 = (((v0 ? v3 : i6) * (a1[0][2] - i6)) % 2);
+        {
+            int i7 = 0;
+            while (i7 < 8) {
+                v3 = (((a0[1] / 6) <= (97 == 13)) ? ((v3 || 72) - (v0 ? 73 : a0[0])) : ((a1[3][10] ? 97 : a0[13]) * (i6 != a0[7])));
+                v1 = (((a0[11] <= 15) == (12 ? v0 : v3)) < ((v2 < a0[0]) == (v2 - 19)));
+                v2 = (((a1[1][12] && i7) ? (v1 + a1[1][10]) : (a1[3][13] ? a0[10] : 59)) % 6);
+                i7 = i7 + 1;
+            }
+        }
+    }
+    if ((((30 != 10) - (v2 ? v2 : 15)) ? ((a0[5] <= 67) % 1) : ((v0 * v3) ? (v2 ? a0[13] : v0) : (55 <= 31)))) {
+        v0 = (((17 > v0) >= (62 * a0[3])) >= ((a1[0][6] && v3) < (a0[11] % 7)));
+        v3 = (((v3 != 87) >= (v3 >= v2)) > ((v0 > v2) / 7));
+        a0[8] = (((87 && v2) / 9) == ((v2 || 18) <= (v2 == v0)));
+    } else {
+        v3 = (((v1 <= v2) || (a1[3][7] ? a1[2][13] : v3)) / 7);
+        v0 = (((a1[1][0] || v2) ? (a1[1][6] ? v2 : a1[2][15]) : (a1[3][8] || v1)) ? ((40 ? a0[13] : v3) && (v3 >= v0)) : ((v2 ? a1[0][15] : 90) ? (v0 + 16) : (a0[10] < 72)));
+        a0[6] = (((a0[0] * v1) >= (a0[2] > v3)) && ((v2 > 39) * (v2 >= 96)));
+    }
+    {
+        int i8 = 0;
+        do {
+            for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+                if ((47 % 5) > 95) break;
+                v2 = (((v1 ? i9 : 37) <= (60 ? 31 : a1[2][8])) < ((59 < 51) ? (v0 - 4) : (v1 >= a0[4])));
+                v0 = (((v1 || 77) / 7) == ((i8 ? v2 : a1[2][10]) == (a0[11] ? a0[13] : 97)));
+                a0[2] = (((a1[3][3] != a1[0][8]) % 2) != ((a0[15] + i8) || (v3 != a1[2][4])));
+            }
+            v0 = (((v3 < a0[12]) != (v3 == a0[1])) > ((v0 || 33) ? (v0 > 54) : (v2 && i8)));
+            v1 = (((v1 - 95) || (v0 ? 50 : 25)) >= ((93 || v1) % 5));
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    for (int i10 = 0; i10 < 6; i10 = i10 + 1) {
+        v2 = (((a1[1][9] || v3) / 3) && ((i10 - a1[2][12]) / 1));
+        v3 = (((v3 != a0[13]) % 2) <= ((v3 == a0[6]) && (i10 <= i10)));
+        for (int i11 = 0; i11 < 8; i11 = i11 + 1) {
+            a1[1][8] = (((a0[10] || v1) < (v1 >= v0)) % 6);
+            a0[2] = (((v3 >= i11) || (i10 % 3)) + ((73 <= a0[8]) - (a0[8] <= 24)));
+            a1[3][7] = (((a1[0][15] % 7) > (v2 >= 38)) != ((8 - v3) || (v3 != v2)));
+        }
+    }
+    return (((a0[13] / 4) % 1) ? ((v0 > a1[3][15]) + (a1[1][4] > v3)) : ((v2 < a0[3]) ? (v1 > a1[2][6]) : (a1[2][15] == v3)));
+}
+int f1() {
+    int v0 = 11;
+    int v1 = 87;
+    int v2 = 18;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 < v1) < (v3 % 7)) && ((v2 < a1[2][15]) <= (9 - v2)))) {
+        v0 = (((16 ? v2 : 60) + (a0[2] && v2)) < ((a1[1][6] >= v3) + (v3 ? a0[6] : v0)));
+        v0 = (((46 ? v2 : a1[1][15]) && (38 ? v3 : a0[13])) >= ((47 || v1) / 2));
+        v1 = (((v2 == a0[7]) ? (v2 != 4) : (a0[4] < v3)) <= ((v1 >= v1) <= (v1 ? v3 : v1)));
+    } else {
+        a1[0][1] = (((36 / 9) % 8) - ((a1[1][12] || 42) == (70 < 65)));
+        v2 = (((a0[11] <= 33) && (v2 && v3)) ? ((a1[1][8] % 1) ? (v2 > a0[7]) : (v0 + a1[1][10])) : ((v3 / 2) != (a1[3][2] ? v2 : v3)));
+        a0[11] = (((v0 * a0[7]) == (a0[8] / 4)) == ((18 ? v3 : 90) && (93 ? a0[8] : v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((v3 ? a0[13] : 69) > (a1[3][10] >= v1)) >= ((v3 || 33) >= (a0[8] == v0)));
+            v3 = (((i0 % 1) == (i0 * v2)) - ((v3 > v0) < (a1[0][9] - v2)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[3][15] = (((a1[2][15] ? a1[0][11] : a0[0]) - (a0[4] ? i1 : a1[0][13])) < ((i1 ? 17 : 28) % 8));
+                v1 = (((a0[10] && i0) > (a0[12] * v2)) - ((v2 ? 91 : 7) / 6));
+                v1 = (((a1[3][1] || a0[12]) ? (51 || a1[1][13]) : (v1 / 2)) ? ((a1[2][0] <= 5) == (50 ? a0[14] : v3)) : ((50 && i0) <= (a0[7] / 9)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((v3 && v1) == (40 || v0)) ? ((v2 == a1[1][1]) != (v0 % 4)) : ((42 || v2) || (v1 + v1)));
+    v2 = (((v2 + 60) || (v1 && 22)) + ((a1[1][7] >= 98) == (v1 / 4)));
+    if ((((a0[0] >= v3) * (v0 + v0)) - ((v1 <= 85) < (v1 ? 24 : a1[0][15])))) {
+        a0[12] = (((24 * v3) / 6) < ((34 ? a0[4] : a1[3][8]) < (v0 ? v1 : v1)));
+        v1 = (((v0 < v1) ? (v2 % 1) : (v3 - 4)) || ((60 * a1[1][6]) % 4));
+        v2 = (((a0[0] != 0) != (31 != 81)) / 9);
+    } else {
+        a1[0][2] = (((8 || a0[5]) <= (19 == a0[6])) >= ((a0[9] % 3) == (v0 + v3)));
+        a1[3][12] = (((79 <= v0) == (v2 ? 50 : 35)) * ((11 > 21) || (v3 <= v3)));
+        v1 = (((v0 / 3) * (1 && v2)) && ((a1[2][5] % 9) != (26 / 3)));
+    }
+    if ((((45 == v3) % 6) < ((a1[1][7] * v2) - (a1[3][10] != a1[2][3])))) {
+        v1 = (((a0[3] && v0) % 9) && ((a0[3] % 3) * (50 >= v1)));
+        a1[1][6] = (((a0[4] == a0[4]) && (a1[2][5] % 1)) < ((v0 ? a0[14] : a1[0][14]) + (v1 - v3)));
+        v0 = (((a1[2][9] < a0[10]) || (v0 % 4)) * ((v2 - v3) || (v2 ? a1[0][2] : 91)));
+    } else {
+        v1 = (((a0[2] || 41) ? (v3 - a1[0][8]) : (v1 * 11)) / 9);
+        v0 = (((v2 || v3) < (a0[13] < a1[0][8])) == ((99 ? v2 : 33) ? (v0 + a1[1][7]) : (a0[5] && v0)));
+        a1[0][14] = (((a1[1][14] / 9) && (83 * v0)) - ((44 / 8) || (v2 ? v1 : 51)));
+    }
+    v0 = (((v1 >= v2) + (v0 + v1)) ? ((v3 < 74) / 2) : ((a0[3] && v0) ? (a1[1][15] <= v3) : (v2 % 8)));
+    a1[0][6] = (((78 / 1) / 8) < ((v2 > 11) * (v3 + v0)));
+    if ((((v1 >= a0[3]) <= (9 ? v1 : v1)) > ((a0[4] < v3) || (46 || v1)))) {
+        v3 = (((50 % 7) ? (63 < v3) : (a1[1][10] + v3)) < ((a1[1][15] < v3) >= (v1 == 17)));
+        v3 = (((v1 * v3) >= (v3 || v2)) >= ((32 || v1) && (v3 * v1)));
+        a1[0][4] = (((a0[0] <= v1) ? (v0 + a1[1][12]) : (v0 ? a1[2][13] : a1[0][11])) <= ((v1 <= v1) + (49 / 2)));
+    } else {
+        v2 = (((a1[0][10] == 54) ? (a0[13] && v0) : (v1 % 3)) ? ((22 ? 0 : v2) - (v3 ? v0 : v2)) : ((a1[1][7] || v3) * (v2 < v0)));
+        v1 = (((a0[1] < v0) ? (v1 % 6) : (96 != v3)) ? ((68 + v0) == (a1[1][9] ? 17 : v3)) : ((a1[0][6] >= 97) * (23 > a0[10])));
+        v2 = (((v0 - 45) || (a1[0][1] ? 59 : v1)) + ((v0 && v0) <= (a1[0][7] / 8)));
+    }
+    if ((((58 > v1) < (v3 ? v3 : a0[13])) ? ((v1 || v0) * (v3 || a1[3][4])) : ((83 + a0[13]) >= (v3 == v0)))) {
+        v2 = (((v2 * v2) - (a1[0][3] == 89)) && ((v1 - v2) + (a0[13] / 8)));
+        v2 = (((v3 / 1) && (36 / 1)) < ((v0 * v0) < (72 ? v3 : 59)));
+        v1 = (((v1 && 91) < (v0 % 5)) * ((v0 / 7) >= (76 ? 22 : a1[1][3])));
+    } else {
+        a1[3][12] = (((v3 * v1) ? (v3 % 3) : (v2 / 9)) + ((v1 - 84) <= (a1[3][7] > 12)));
+        a0[4] = (((11 == v2) || (a1[1][3] / 4)) >= ((a0[3] > a0[5]) >= (83 - v1)));
+        a0[5] = (((v1 > v1) - (v0 < v2)) ? ((a0[11] * v0) * (v1 <= v1)) : ((v2 <= 68) > (42 == a0[15])));
+    }
+    return (((a0[14] || a1[0][0]) < (a1[3][6] && a0[8])) != ((v0 && 52) >= (a0[3] < 82)));
+}
+int f2() {
+    int v0 = 44;
+    int v1 = 7;
+    int v2 = 77;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v3 ? a0[3] : v2) > 54) break;
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v2 = (((28 ? i1 : i0) || (16 ? i1 : v2)) ? ((v2 ? 42 : i1) * (v3 / 4)) : ((i0 <= v3) > (v0 ? v1 : i0)));
+                v2 = (((69 != 97) * (84 != 73)) % 9);
+                v3 = (((a1[1][14] || a1[3][1]) * (v2 * a1[2][12])) >= ((i1 && v1) != (i1 ? v1 : i0)));
+            }
+            v1 = (((v2 * v1) >= (v2 && 76)) ? ((93 ? a1[1][15] : v2) - (i0 < v0)) : ((v1 < v0) / 7));
+            v2 = (((83 >= 40) < (i0 / 6)) == ((80 && a1[0][10]) - (a0[9] - v2)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((i2 ? v2 : 46) > 93) break;
+            v3 = (((a0[15] != v1) ? (v0 <= a1[1][13]) : (v0 <= v2)) == ((31 % 7) * (a0[4] + 12)));
+            a0[4] = (((v0 > 88) % 4) - ((v1 / 9) ? (i2 ? 63 : i2) : (v3 - 31)));
+            {
+                int i3 = 0;
+                do {
+                    if ((i3 ? 83 : v1) > 83) break;
+                    v3 = (((84 != a1[1][7]) == (a1[1][8] <= i2)) + ((v0 ? 73 : 95) >= (52 || i3)));
+                    v2 = (((a1[1][12] && 64) ? (i3 % 3) : (a0[12] != a0[2])) - ((49 > 25) ? (a1[0][10] ? v0 : i3) : (v2 - a1[0][5])));
+                    v2 = (((10 == v2) || (v3 >= i2)) >= ((a0[8] - v0) || (i3 > a1[0][10])));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((i4 != 20) ? (v2 >= a0[1]) : (a1[2][8] - a1[3][2])) - ((v3 + 15) / 2));
+                    a1[1][8] = (((12 - 59) >= (a1[1][14] / 2)) ? ((59 - v0) + (v1 ? v1 : 60)) : ((i5 || a0[15]) / 8));
+                    v0 = (((v2 < i5) % 3) && ((v2 % 4) != (20 > a1[2][11])));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a0[5] = (((i4 + 65) == (v1 * a1[2][12])) + ((30 ? 70 : v2) > (v2 != v2)));
+            a1[2][8] = (((a0[0] ? i4 : 73) + (v2 || a0[5])) <= ((56 || 19) || (32 < a0[6])));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v2 = (((63 / 3) + (a1[1][11] / 9)) >= ((26 % 6) <= (83 >= 91)));
+    if ((((v1 ? a0[9] : 40) < (70 / 4)) == ((0 - 40) % 4))) {
+        a1[3][9] = (((97 * v2) / 2) < ((v0 || v3) - (0 <= a1[2][7])));
+        v3 = (((v0 ? v2 : 18) ? (a0[7] && 45) : (23 != 46)) < ((20 || v2) != (v2 == v0)));
+        v0 = (((v3 ? 22 : v0) < (v2 && a0[6])) - ((v2 > 88) == (6 >= a1[1][9])));
+    } else {
+        v0 = (((v2 < 65) > (v3 == 6)) + ((v2 * v2) ? (v3 != a1[2][3]) : (a1[3][14] - v3)));
+        a0[1] = (((a1[3][12] == a0[9]) - (a0[1] || v2)) || ((v0 <= v0) ? (v1 / 8) : (a1[1][6] - a0[12])));
+        v1 = (((49 % 7) / 6) % 3);
+    }
+    v0 = (((81 + 38) ? (v1 <= a0[1]) : (88 || 25)) < ((v0 < a0[5]) ? (a1[3][13] || 75) : (v1 ? a0[6] : v1)));
+    if ((((a1[2][14] / 5) ? (v3 == 19) : (a0[7] && a0[0])) % 2)) {
+        v0 = (((a1[3][3] || v0) ? (a0[9] <= 65) : (a1[1][4] < 64)) - ((v2 && 51) * (v1 / 3)));
+        v2 = (((a1[3][13] == v3) > (a1[3][4] && v2)) < ((v1 < v0) < (a1[1][7] / 3)));
+        a0[10] = (((v3 || 79) <= (a0[3] || 0)) % 7);
+    } else {
+        v2 = (((v3 ? a1[0][11] : v2) != (38 >= 99)) >= ((49 * v3) ? (v1 ? v1 : v0) : (v2 >= 19)));
+        v1 = (((6 > 58) / 2) % 7);
+        v2 = (((v1 >= v1) || (v2 ? 0 : v0)) + ((a1[1][12] + 97) && (v2 / 5)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((v1 || a1[2][15]) || (a0[2] * 41)) * ((v2 * a1[2][4]) ? (v1 >= v2) : (a0[3] > 86)));
+            v1 = (((a1[3][13] && a0[5]) * (v3 <= v1)) * ((v3 == i6) % 8));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v0 = (((72 < a0[11]) && (45 + v1)) % 3);
+                    v1 = (((a0[0] != v2) / 8) == ((39 ? a1[3][6] : i6) - (a1[1][7] && v1)));
+                    v1 = (((v2 == a1[3][5]) == (81 ? 93 : v3)) / 3);
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            a1[0][15] = (((68 ? 89 : a0[9]) <= (v3 / 8)) < ((i8 >= 38) != (v3 ? i8 : v1)));
+            {
+                int i9 = 0;
+                do {
+                    a0[9] = (((a1[2][13] == i8) ? (32 ? 45 : v1) : (25 + v2)) * ((v0 && v2) % 5));
+                    v1 = (((32 / 1) / 3) || ((a0[8] % 1) == (11 >= v1)));
+                    a1[1][7] = (((v0 && a1[0][14]) ? (v3 * 30) : (v0 - v2)) + ((a0[9] % 7) || (v0 == 25)));
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            v1 = (((50 ? v3 : a1[1][6]) - (v1 * 86)) - ((a1[3][9] - i8) >= (90 ? a1[3][15] : v1)));
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 8; i10 = i10 + 1) {
+        v2 = (((88 > 20) < (v2 || v1)) <= ((a0[10] ? 70 : v2) * (i10 >= v0)));
+        v3 = (((v1 * i10) - (a0[9] + 30)) ? ((72 % 7) || (71 > a1[1][2])) : ((59 == i10) <= (97 || a0[0])));
+        {
+            int i11 = 0;
+            while (i11 < 2) {
+                v2 = (((98 ? v3 : 36) / 2) <= ((a1[0][6] != 92) ? (a0[9] == a0[11]) : (9 ? v2 : 8)));
+                v2 = (((a1[3][11] == a0[7]) || (a0[9] || i10)) && ((a1[0][4] < a0[12]) + (88 >= v3)));
+                v3 = (((a1[1][14] + 18) >= (v3 * i11)) / 2);
+                i11 = i11 + 1;
+            }
+        }
+    }
+    return (((25 + v3) + (21 >= a0[5])) && ((v3 >= 26) * (v2 ? v2 : v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,8615 @@
+    .file 1 "build/bench/batch/f18.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 321 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 322 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 323 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 324 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 325 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 326 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $45, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $58, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $45, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $10, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movq $58, %rax
+    cmpq $0, %rax
+    jne .Lf0_7
+    jmp .Lf0_8
+.Lf0_7:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_9
+.Lf0_8:
+    movq $37, %rax
+.Lf0_9:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_11
+    jmp .Lf0_10
+.Lf0_11:
+    movslq -68(%rbp), %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_10:
+    cmpq $0, %rax
+    jne .Lf0_4
+    jmp .Lf0_5
+.Lf0_4:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_6
+.Lf0_5:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_13
+    jmp .Lf0_12
+.Lf0_13:
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_12:
+    push %rax
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_15
+    jmp .Lf0_14
+.Lf0_15:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_14:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_6:
+    movl %eax, -16(%rbp)
+    .loc 1 13 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 14 17
+    jmp .Lf0_19
+    .p2align 4,,10
+.Lf0_18:
+    .loc 1 15 21
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_21
+    jmp .Lf0_20
+.Lf0_21:
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_20:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imulq $55, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $30, -36(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 16 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_23
+.Lf0_22:
+    movq $11, %rax
+    jmp .Lf0_24
+.Lf0_23:
+    movslq -8(%rbp), %rax
+.Lf0_24:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_26
+    jmp .Lf0_25
+.Lf0_26:
+    movslq -8(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_25:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_28
+    jmp .Lf0_27
+.Lf0_28:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_27:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_29
+.Lf0_30:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_29:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 17 21
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_31
+    jmp .Lf0_32
+.Lf0_31:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf0_33
+.Lf0_32:
+    movslq -340(%rbp), %rax
+.Lf0_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_35
+    jmp .Lf0_34
+.Lf0_35:
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_34:
+    movl %eax, -16(%rbp)
+    .loc 1 18 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_17:
+.Lf0_19:
+    .loc 1 14 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_18
+.Lf0_16:
+    addq $0, %rsp
+    .loc 1 21 13
+    movq $7, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 22 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 23 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 25 5
+    movslq -28(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_38
+    jmp .Lf0_37
+.Lf0_38:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_37:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_40
+    jmp .Lf0_39
+.Lf0_40:
+    movq $77, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $39, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_39:
+    cmpq $0, %rax
+    je .Lf0_41
+    .loc 1 26 9
+    movq $31, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_43
+    jmp .Lf0_42
+.Lf0_43:
+    movslq -16(%rbp), %rax
+    subq $81, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_42:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_45
+    jmp .Lf0_44
+.Lf0_45:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $80, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_44:
+    movl %eax, -16(%rbp)
+    .loc 1 27 9
+    movq $98, %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $33, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 28 9
+    movslq -68(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_49
+.Lf0_50:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_52
+    jmp .Lf0_51
+.Lf0_52:
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_51:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_49:
+    cmpq $0, %rax
+    jne .Lf0_46
+    jmp .Lf0_47
+.Lf0_46:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_48
+.Lf0_47:
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_54
+    jmp .Lf0_53
+.Lf0_54:
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_53:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_48:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_36
+.Lf0_41:
+    .loc 1 30 9
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $56, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $62, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $65, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 31 9
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_56
+.Lf0_55:
+    movq $34, %rax
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -52(%rbp), %rax
+.Lf0_57:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_58
+    jmp .Lf0_59
+.Lf0_58:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -72(%rbp), %rax
+.Lf0_60:
+    push %rax
+    movq $93, %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 32 9
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    imulq $93, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_36:
+    .loc 1 35 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 36 9
+    .p2align 4,,10
+.Lf0_63:
+    .loc 1 37 13
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    addq $66, %rax
+    movslq %eax, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_64
+    jmp .Lf0_61
+.Lf0_64:
+    .loc 1 38 13
+    movslq -68(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_66
+    jmp .Lf0_65
+.Lf0_66:
+    movq $55, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_65:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $76, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $94, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 40 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 41 17
+    .p2align 4,,10
+.Lf0_69:
+    .loc 1 42 21
+    movslq -340(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_71
+    jmp .Lf0_70
+.Lf0_71:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_70:
+    push %rax
+    movq $43, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_72
+    jmp .Lf0_73
+.Lf0_72:
+    movq $20, %rax
+    jmp .Lf0_74
+.Lf0_73:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf0_74:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 43 21
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_76
+.Lf0_75:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_77
+.Lf0_76:
+    movslq -340(%rbp), %rax
+.Lf0_77:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 44 21
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    addq $2, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_79
+    jmp .Lf0_78
+.Lf0_79:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_78:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 45 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_68:
+    .loc 1 46 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_69
+.Lf0_67:
+    addq $0, %rsp
+    .loc 1 48 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_84
+.Lf0_83:
+    movslq -80(%rbp), %rax
+    jmp .Lf0_85
+.Lf0_84:
+    movq $63, %rax
+.Lf0_85:
+    cmpq $0, %rax
+    jne .Lf0_80
+    jmp .Lf0_81
+.Lf0_80:
+    movq $1, %rax
+    push %rax
+    movq $5, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_82
+.Lf0_81:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_82:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_87
+    jmp .Lf0_86
+.Lf0_87:
+    movq $21, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_89
+.Lf0_88:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_91
+.Lf0_92:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_91:
+    jmp .Lf0_90
+.Lf0_89:
+    movq $85, %rax
+    cmpq $0, %rax
+    jne .Lf0_93
+    jmp .Lf0_94
+.Lf0_93:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_95
+.Lf0_94:
+    movslq -12(%rbp), %rax
+.Lf0_95:
+.Lf0_90:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_86:
+    movl %eax, -12(%rbp)
+    .loc 1 49 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_62:
+    .loc 1 50 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_63
+.Lf0_61:
+    addq $8, %rsp
+    .loc 1 52 5
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    movslq -24(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_102
+    jmp .Lf0_103
+.Lf0_102:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_104
+.Lf0_103:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf0_104:
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_100
+.Lf0_99:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_101
+.Lf0_100:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    addq $74, %rax
+    movslq %eax, %rax
+.Lf0_101:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_105
+    .loc 1 53 9
+    movslq -12(%rbp), %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_107
+    jmp .Lf0_106
+.Lf0_107:
+    movslq -20(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_106:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_109
+    jmp .Lf0_108
+.Lf0_109:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_108:
+    push %rax
+    cmpl $27, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 54 9
+    movq $3, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_110
+    jmp .Lf0_111
+.Lf0_110:
+    movq $29, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    movq $27, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_114
+.Lf0_113:
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_115
+.Lf0_114:
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_119
+    jmp .Lf0_118
+.Lf0_119:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_118:
+.Lf0_115:
+    jmp .Lf0_112
+.Lf0_111:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_121
+    jmp .Lf0_120
+.Lf0_121:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_120:
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_122
+.Lf0_123:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_122:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_112:
+    movl %eax, -12(%rbp)
+    .loc 1 55 9
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_125
+    jmp .Lf0_124
+.Lf0_125:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    push %rax
+    cmpl $40, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_124:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_96
+.Lf0_105:
+    .loc 1 57 9
+    movq $9, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 58 9
+    movslq -8(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    movq $32, %rax
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_131
+.Lf0_130:
+    movq $36, %rax
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -8(%rbp), %rax
+.Lf0_132:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -44(%rbp)
+    .loc 1 59 9
+    movq $3, %rax
+    push %rax
+    cmpl $50, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_96:
+    .loc 1 62 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 63 9
+    jmp .Lf0_136
+    .p2align 4,,10
+.Lf0_135:
+    .loc 1 64 13
+    movq $63, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_137
+    jmp .Lf0_133
+.Lf0_137:
+    .loc 1 65 13
+    movslq -28(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_143
+.Lf0_142:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf0_143:
+    push %rax
+    movq $75, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_140
+.Lf0_139:
+    movq $3, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_140:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 66 13
+    movq $16, %rax
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $63, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $23, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 67 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 68 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_152
+    jmp .Lf0_153
+.Lf0_152:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_154
+.Lf0_153:
+    movq $24, %rax
+.Lf0_154:
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_151
+    jmp .Lf0_148
+.Lf0_151:
+    .loc 1 69 17
+    movq $6, %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 70 17
+    movq $4, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 71 17
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_156
+    jmp .Lf0_155
+.Lf0_156:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_155:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_150:
+    .loc 1 67 38
+    incl -344(%rbp)
+    .loc 1 68 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_158
+    jmp .Lf0_159
+.Lf0_158:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_160
+.Lf0_159:
+    movq $24, %rax
+.Lf0_160:
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_157
+    jmp .Lf0_148
+.Lf0_157:
+    .loc 1 69 17
+    movq $6, %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 70 17
+    movq $4, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 71 17
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_162
+    jmp .Lf0_161
+.Lf0_162:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_161:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_149:
+    .loc 1 67 38
+    incl -344(%rbp)
+.Lf0_148:
+    addq $0, %rsp
+    .loc 1 73 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_134:
+.Lf0_136:
+    .loc 1 63 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_135
+.Lf0_133:
+    addq $8, %rsp
+    .loc 1 76 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_164
+.Lf0_163:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_165
+.Lf0_164:
+    movslq -40(%rbp), %rax
+.Lf0_165:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_166
+.Lf0_167:
+    movq $2, %rax
+    push %rax
+    movq $37, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movq $37, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    jmp .Lf0_170
+.Lf0_169:
+    cmpl $4, -8(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_170:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_166:
+    movl %eax, -16(%rbp)
+    .loc 1 77 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_178
+    .p2align 4,,10
+.Lf0_177:
+    .loc 1 78 9
+    movq $2, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_181
+.Lf0_180:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf0_181:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_183
+    jmp .Lf0_182
+.Lf0_183:
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_182:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 79 9
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_184
+    jmp .Lf0_185
+.Lf0_184:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_186
+.Lf0_185:
+    movslq -340(%rbp), %rax
+.Lf0_186:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 81 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 82 13
+    jmp .Lf0_190
+    .p2align 4,,10
+.Lf0_189:
+    .loc 1 83 17
+    movq $6, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $97, %rax
+    cmpq $13, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_191
+    jmp .Lf0_192
+.Lf0_191:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_195
+.Lf0_194:
+    movq $73, %rax
+    jmp .Lf0_196
+.Lf0_195:
+    movslq -80(%rbp), %rax
+.Lf0_196:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_198
+    jmp .Lf0_197
+.Lf0_198:
+    movq $72, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_197:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_193
+.Lf0_192:
+    movslq -340(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_200
+.Lf0_199:
+    movq $97, %rax
+    jmp .Lf0_201
+.Lf0_200:
+    movslq -28(%rbp), %rax
+.Lf0_201:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_193:
+    movl %eax, -16(%rbp)
+    .loc 1 84 17
+    cmpl $15, -36(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $12, %rax
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_203
+.Lf0_202:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -16(%rbp), %rax
+.Lf0_204:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $19, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 85 17
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_208
+.Lf0_209:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_208:
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_206
+.Lf0_205:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_207
+.Lf0_206:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_211
+.Lf0_210:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_212
+.Lf0_211:
+    movq $59, %rax
+.Lf0_212:
+.Lf0_207:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 86 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_188:
+.Lf0_190:
+    .loc 1 82 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_189
+.Lf0_187:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_176:
+    .loc 1 77 30
+    incl -340(%rbp)
+.Lf0_178:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_177
+.Lf0_175:
+    addq $8, %rsp
+    .loc 1 90 5
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_217
+    jmp .Lf0_218
+.Lf0_217:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_219
+.Lf0_218:
+    movq $15, %rax
+.Lf0_219:
+    push %rax
+    movq $30, %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_214
+    jmp .Lf0_215
+.Lf0_214:
+    movq $1, %rax
+    push %rax
+    cmpl $67, -60(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_216
+.Lf0_215:
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_221
+.Lf0_220:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_223
+    jmp .Lf0_224
+.Lf0_223:
+    movslq -28(%rbp), %rax
+    jmp .Lf0_225
+.Lf0_224:
+    movslq -4(%rbp), %rax
+.Lf0_225:
+    jmp .Lf0_222
+.Lf0_221:
+    movq $55, %rax
+    cmpq $31, %rax
+    movq $0, %rax
+    setle %al
+.Lf0_222:
+.Lf0_216:
+    cmpq $0, %rax
+    je .Lf0_226
+    .loc 1 91 9
+    movq $17, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $62, %rax
+    imull -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_228
+    jmp .Lf0_227
+.Lf0_228:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_227:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 92 9
+    cmpl $87, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 93 9
+    movq $9, %rax
+    push %rax
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_230
+    jmp .Lf0_229
+.Lf0_230:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_229:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_232
+    jmp .Lf0_231
+.Lf0_232:
+    movq $18, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_231:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_213
+.Lf0_226:
+    .loc 1 95 9
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_234
+    jmp .Lf0_233
+.Lf0_234:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_236
+.Lf0_235:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf0_237
+.Lf0_236:
+    movslq -16(%rbp), %rax
+.Lf0_237:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_233:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 96 9
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_245
+    jmp .Lf0_244
+.Lf0_245:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_244:
+    cmpq $0, %rax
+    jne .Lf0_241
+    jmp .Lf0_242
+.Lf0_241:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_246
+    jmp .Lf0_247
+.Lf0_246:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_248
+.Lf0_247:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf0_248:
+    jmp .Lf0_243
+.Lf0_242:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_250
+    jmp .Lf0_249
+.Lf0_250:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_249:
+.Lf0_243:
+    cmpq $0, %rax
+    jne .Lf0_238
+    jmp .Lf0_239
+.Lf0_238:
+    movq $40, %rax
+    cmpq $0, %rax
+    jne .Lf0_251
+    jmp .Lf0_252
+.Lf0_251:
+    movslq -28(%rbp), %rax
+    jmp .Lf0_253
+.Lf0_252:
+    movslq -16(%rbp), %rax
+.Lf0_253:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_255
+    jmp .Lf0_254
+.Lf0_255:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_254:
+    jmp .Lf0_240
+.Lf0_239:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_259
+    jmp .Lf0_260
+.Lf0_259:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_261
+.Lf0_260:
+    movq $90, %rax
+.Lf0_261:
+    cmpq $0, %rax
+    jne .Lf0_256
+    jmp .Lf0_257
+.Lf0_256:
+    movslq -4(%rbp), %rax
+    addq $16, %rax
+    movslq %eax, %rax
+    jmp .Lf0_258
+.Lf0_257:
+    cmpl $72, -40(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf0_258:
+.Lf0_240:
+    movl %eax, -4(%rbp)
+    .loc 1 97 9
+    movslq -80(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_263
+    jmp .Lf0_262
+.Lf0_263:
+    cmpl $96, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $39, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_262:
+    movl %eax, -56(%rbp)
+    addq $0, %rsp
+.Lf0_213:
+    .loc 1 100 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 101 9
+    .p2align 4,,10
+.Lf0_266:
+    .loc 1 102 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_272
+    .p2align 4,,10
+.Lf0_271:
+    .loc 1 103 17
+    movq $5, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_273
+    jmp .Lf0_269
+.Lf0_273:
+    .loc 1 104 17
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_274
+    jmp .Lf0_275
+.Lf0_274:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_276
+.Lf0_275:
+    movq $37, %rax
+.Lf0_276:
+    push %rax
+    movq $60, %rax
+    cmpq $0, %rax
+    jne .Lf0_277
+    jmp .Lf0_278
+.Lf0_277:
+    movq $31, %rax
+    jmp .Lf0_279
+.Lf0_278:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf0_279:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $59, %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_280
+    jmp .Lf0_281
+.Lf0_280:
+    movslq -4(%rbp), %rax
+    subq $4, %rax
+    movslq %eax, %rax
+    jmp .Lf0_282
+.Lf0_281:
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_282:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 105 17
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_284
+    jmp .Lf0_283
+.Lf0_284:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_283:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_285
+    jmp .Lf0_286
+.Lf0_285:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_287
+.Lf0_286:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf0_287:
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_288
+    jmp .Lf0_289
+.Lf0_288:
+    movslq -28(%rbp), %rax
+    jmp .Lf0_290
+.Lf0_289:
+    movq $97, %rax
+.Lf0_290:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 106 17
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_292
+    jmp .Lf0_291
+.Lf0_292:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_291:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -72(%rbp)
+    addq $0, %rsp
+.Lf0_270:
+    .loc 1 102 38
+    incl -344(%rbp)
+.Lf0_272:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_271
+.Lf0_269:
+    addq $0, %rsp
+    .loc 1 108 13
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_297
+    jmp .Lf0_296
+.Lf0_297:
+    movq $33, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_296:
+    cmpq $0, %rax
+    jne .Lf0_293
+    jmp .Lf0_294
+.Lf0_293:
+    cmpl $54, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_295
+.Lf0_294:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_299
+    jmp .Lf0_298
+.Lf0_299:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_298:
+.Lf0_295:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 109 13
+    movslq -8(%rbp), %rax
+    subq $95, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_301
+    jmp .Lf0_300
+.Lf0_301:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_302
+    jmp .Lf0_303
+.Lf0_302:
+    movq $50, %rax
+    jmp .Lf0_304
+.Lf0_303:
+    movq $25, %rax
+.Lf0_304:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_300:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_306
+    jmp .Lf0_305
+.Lf0_306:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_305:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 110 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_265:
+    .loc 1 111 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_266
+.Lf0_264:
+    addq $8, %rsp
+    .loc 1 113 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_312
+    .p2align 4,,10
+.Lf0_311:
+    .loc 1 114 9
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_314
+    jmp .Lf0_313
+.Lf0_314:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_313:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_316
+    jmp .Lf0_315
+.Lf0_316:
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_315:
+    movl %eax, -12(%rbp)
+    .loc 1 115 9
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_318
+    jmp .Lf0_317
+.Lf0_318:
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_317:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 116 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_324
+    .p2align 4,,10
+.Lf0_323:
+    .loc 1 117 13
+    movq $6, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_329
+    jmp .Lf0_328
+.Lf0_329:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_328:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 118 13
+    cmpl $24, -48(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $73, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_331
+    jmp .Lf0_330
+.Lf0_331:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_330:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 119 13
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_333
+    jmp .Lf0_332
+.Lf0_333:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_332:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_327:
+    .loc 1 116 36
+    incl -344(%rbp)
+    .loc 1 117 13
+    movq $6, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_335
+    jmp .Lf0_334
+.Lf0_335:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_334:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 118 13
+    cmpl $24, -48(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $73, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_337
+    jmp .Lf0_336
+.Lf0_337:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_336:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 119 13
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_339
+    jmp .Lf0_338
+.Lf0_339:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_338:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_326:
+    .loc 1 116 36
+    incl -344(%rbp)
+.Lf0_324:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $8, %rax
+    jl .Lf0_323
+.Lf0_325:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_321
+    .loc 1 117 13
+    movq $6, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_341
+    jmp .Lf0_340
+.Lf0_341:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_340:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 118 13
+    cmpl $24, -48(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $73, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_343
+    jmp .Lf0_342
+.Lf0_343:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_342:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 119 13
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_345
+    jmp .Lf0_344
+.Lf0_345:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_344:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_322:
+    .loc 1 116 36
+    incl -344(%rbp)
+    jmp .Lf0_325
+.Lf0_321:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_310:
+    .loc 1 113 32
+    incl -340(%rbp)
+.Lf0_312:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_311
+.Lf0_309:
+    addq $8, %rsp
+    .loc 1 122 5
+    movq $1, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_346
+    jmp .Lf0_347
+.Lf0_346:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_348
+.Lf0_347:
+    movslq -12(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_349
+    jmp .Lf0_350
+.Lf0_349:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_351
+.Lf0_350:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_351:
+.Lf0_348:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 124 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 125 5
+    subq $8, %rsp
+    movq $11, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 126 5
+    movq $87, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 127 5
+    subq $8, %rsp
+    movq $18, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 128 5
+    movq $73, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 129 5
+    subq $64, %rsp
+    .loc 1 130 5
+    subq $256, %rsp
+    .loc 1 131 5
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_3
+    jmp .Lf1_2
+.Lf1_3:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_2:
+    cmpq $0, %rax
+    je .Lf1_4
+    .loc 1 132 9
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_6
+    jmp .Lf1_5
+.Lf1_6:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_5:
+    push %rax
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf1_7
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_9
+.Lf1_8:
+    movq $60, %rax
+.Lf1_9:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_10
+    jmp .Lf1_11
+.Lf1_10:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_12
+.Lf1_11:
+    movslq -4(%rbp), %rax
+.Lf1_12:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 133 9
+    movq $46, %rax
+    cmpq $0, %rax
+    jne .Lf1_13
+    jmp .Lf1_14
+.Lf1_13:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_15
+.Lf1_14:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf1_15:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_17
+    jmp .Lf1_16
+.Lf1_17:
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_19
+.Lf1_18:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_20
+.Lf1_19:
+    movslq -28(%rbp), %rax
+.Lf1_20:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_16:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $47, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_22
+    jmp .Lf1_21
+.Lf1_22:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_21:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 134 9
+    movslq -12(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_24
+.Lf1_23:
+    cmpl $4, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_25
+.Lf1_24:
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_25:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_26
+    jmp .Lf1_27
+.Lf1_26:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_28
+.Lf1_27:
+    movslq -8(%rbp), %rax
+.Lf1_28:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_1
+.Lf1_4:
+    .loc 1 136 9
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_30
+    jmp .Lf1_29
+.Lf1_30:
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_29:
+    push %rax
+    movq $70, %rax
+    cmpq $65, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $36, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 137 9
+    cmpl $33, -36(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_35
+    jmp .Lf1_34
+.Lf1_35:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_37
+    jmp .Lf1_36
+.Lf1_37:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_36:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_34:
+    cmpq $0, %rax
+    jne .Lf1_31
+    jmp .Lf1_32
+.Lf1_31:
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_38
+    jmp .Lf1_39
+.Lf1_38:
+    movslq -12(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_40
+.Lf1_39:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_40:
+    jmp .Lf1_33
+.Lf1_32:
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_41
+    jmp .Lf1_42
+.Lf1_41:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_43
+.Lf1_42:
+    movslq -16(%rbp), %rax
+.Lf1_43:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_33:
+    movl %eax, -12(%rbp)
+    .loc 1 138 9
+    movslq -4(%rbp), %rax
+    imull -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $18, %rax
+    cmpq $0, %rax
+    jne .Lf1_44
+    jmp .Lf1_45
+.Lf1_44:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_46
+.Lf1_45:
+    movq $90, %rax
+.Lf1_46:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_47
+.Lf1_48:
+    movq $93, %rax
+    cmpq $0, %rax
+    jne .Lf1_49
+    jmp .Lf1_50
+.Lf1_49:
+    movslq -48(%rbp), %rax
+    jmp .Lf1_51
+.Lf1_50:
+    movslq -8(%rbp), %rax
+.Lf1_51:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_47:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lf1_1:
+    .loc 1 141 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 142 9
+    jmp .Lf1_55
+    .p2align 4,,10
+.Lf1_54:
+    .loc 1 143 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_57
+.Lf1_56:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_58
+.Lf1_57:
+    movq $69, %rax
+.Lf1_58:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_60
+    jmp .Lf1_59
+.Lf1_60:
+    movq $33, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_59:
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 144 13
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 145 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_66
+    .p2align 4,,10
+.Lf1_65:
+    .loc 1 146 17
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_69
+.Lf1_68:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_69:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_70
+    jmp .Lf1_71
+.Lf1_70:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf1_72
+.Lf1_71:
+    movslq -80(%rbp), %rax
+.Lf1_72:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_74
+.Lf1_73:
+    movq $17, %rax
+    jmp .Lf1_75
+.Lf1_74:
+    movq $28, %rax
+.Lf1_75:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 147 17
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_76
+    jmp .Lf1_77
+.Lf1_76:
+    movq $91, %rax
+    jmp .Lf1_78
+.Lf1_77:
+    movq $7, %rax
+.Lf1_78:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_79
+.Lf1_80:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_79:
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 148 17
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_88
+    jmp .Lf1_87
+.Lf1_88:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_87:
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_85
+.Lf1_84:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_90
+    jmp .Lf1_89
+.Lf1_90:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_89:
+    jmp .Lf1_86
+.Lf1_85:
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_86:
+    cmpq $0, %rax
+    jne .Lf1_81
+    jmp .Lf1_82
+.Lf1_81:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $5, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $50, %rax
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_92
+.Lf1_91:
+    movslq -24(%rbp), %rax
+    jmp .Lf1_93
+.Lf1_92:
+    movslq -16(%rbp), %rax
+.Lf1_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_83
+.Lf1_82:
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_95
+    jmp .Lf1_94
+.Lf1_95:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_94:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_83:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_64:
+    .loc 1 145 38
+    incl -344(%rbp)
+.Lf1_66:
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_65
+.Lf1_63:
+    addq $0, %rsp
+    .loc 1 150 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_53:
+.Lf1_55:
+    .loc 1 142 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_54
+.Lf1_52:
+    addq $8, %rsp
+    .loc 1 153 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_100
+    jmp .Lf1_99
+.Lf1_100:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_99:
+    push %rax
+    movq $40, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_102
+    jmp .Lf1_101
+.Lf1_102:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_101:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_96
+    jmp .Lf1_97
+.Lf1_96:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_98
+.Lf1_97:
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_104
+    jmp .Lf1_103
+.Lf1_104:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_103:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_106
+    jmp .Lf1_105
+.Lf1_106:
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_105:
+.Lf1_98:
+    movl %eax, -16(%rbp)
+    .loc 1 154 5
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $98, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $60, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_108
+    jmp .Lf1_107
+.Lf1_108:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_109
+.Lf1_110:
+    movq $22, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_109:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_107:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 155 5
+    cmpl $85, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_112
+    jmp .Lf1_113
+.Lf1_112:
+    movq $24, %rax
+    jmp .Lf1_114
+.Lf1_113:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf1_114:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_115
+    .loc 1 156 9
+    movq $6, %rax
+    push %rax
+    movq $24, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $34, %rax
+    cmpq $0, %rax
+    jne .Lf1_116
+    jmp .Lf1_117
+.Lf1_116:
+    movslq -64(%rbp), %rax
+    jmp .Lf1_118
+.Lf1_117:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf1_118:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_119
+    jmp .Lf1_120
+.Lf1_119:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_121
+.Lf1_120:
+    movslq -8(%rbp), %rax
+.Lf1_121:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -32(%rbp)
+    .loc 1 157 9
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_123
+.Lf1_122:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_124
+.Lf1_123:
+    movslq -16(%rbp), %rax
+    subq $4, %rax
+    movslq %eax, %rax
+.Lf1_124:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_126
+    jmp .Lf1_125
+.Lf1_126:
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $60, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_125:
+    movl %eax, -8(%rbp)
+    .loc 1 158 9
+    movq $9, %rax
+    push %rax
+    cmpl $0, -80(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $31, %rax
+    cmpq $81, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_111
+.Lf1_115:
+    .loc 1 160 9
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_128
+    jmp .Lf1_127
+.Lf1_128:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_127:
+    push %rax
+    movq $19, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 161 9
+    movq $11, %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_130
+    jmp .Lf1_129
+.Lf1_130:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_129:
+    push %rax
+    movq $79, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_131
+    jmp .Lf1_132
+.Lf1_131:
+    movq $50, %rax
+    jmp .Lf1_133
+.Lf1_132:
+    movq $35, %rax
+.Lf1_133:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 162 9
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_134
+.Lf1_135:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_134:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_137
+    jmp .Lf1_136
+.Lf1_137:
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_136:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_111:
+    .loc 1 164 5
+    movq $6, %rax
+    push %rax
+    movq $45, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_139
+    .loc 1 165 9
+    movq $9, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_141
+    jmp .Lf1_140
+.Lf1_141:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_140:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_143
+    jmp .Lf1_142
+.Lf1_143:
+    movq $50, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_142:
+    movl %eax, -8(%rbp)
+    .loc 1 166 9
+    movslq -64(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_145
+    jmp .Lf1_144
+.Lf1_145:
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_144:
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_146
+    jmp .Lf1_147
+.Lf1_146:
+    movslq -24(%rbp), %rax
+    jmp .Lf1_148
+.Lf1_147:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf1_148:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 167 9
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_150
+    jmp .Lf1_149
+.Lf1_150:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_151
+    jmp .Lf1_152
+.Lf1_151:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf1_153
+.Lf1_152:
+    movq $91, %rax
+.Lf1_153:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_149:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_138
+.Lf1_139:
+    .loc 1 169 9
+    movq $9, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_160
+    jmp .Lf1_159
+.Lf1_160:
+    movq $41, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_159:
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_158
+.Lf1_157:
+    movslq -8(%rbp), %rax
+    imulq $11, %rax
+    movslq %eax, %rax
+.Lf1_158:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 170 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_162
+    jmp .Lf1_161
+.Lf1_162:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_161:
+    push %rax
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $99, %rax
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_167
+.Lf1_166:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_168
+.Lf1_167:
+    movq $33, %rax
+.Lf1_168:
+    cmpq $0, %rax
+    jne .Lf1_163
+    jmp .Lf1_164
+.Lf1_163:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_165
+.Lf1_164:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_170
+    jmp .Lf1_169
+.Lf1_170:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_169:
+.Lf1_165:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 171 9
+    movq $8, %rax
+    push %rax
+    movq $44, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_172
+    jmp .Lf1_171
+.Lf1_172:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_173
+    jmp .Lf1_174
+.Lf1_173:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_175
+.Lf1_174:
+    movq $51, %rax
+.Lf1_175:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_171:
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_177
+    jmp .Lf1_176
+.Lf1_177:
+    movq $83, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_176:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_138:
+    .loc 1 173 5
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_178
+    jmp .Lf1_179
+.Lf1_178:
+    movq $2, %rax
+    push %rax
+    cmpl $74, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_180
+.Lf1_179:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_185
+    jmp .Lf1_184
+.Lf1_185:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_184:
+    cmpq $0, %rax
+    jne .Lf1_181
+    jmp .Lf1_182
+.Lf1_181:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_183
+.Lf1_182:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_183:
+.Lf1_180:
+    movl %eax, -4(%rbp)
+    .loc 1 174 5
+    movq $8, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $78, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $11, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 175 5
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    cmpq $0, %rax
+    jne .Lf1_187
+    jmp .Lf1_188
+.Lf1_187:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_189
+.Lf1_188:
+    movslq -8(%rbp), %rax
+.Lf1_189:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_191
+    jmp .Lf1_190
+.Lf1_191:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_193
+    jmp .Lf1_192
+.Lf1_193:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_192:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_190:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_194
+    .loc 1 176 9
+    movq $7, %rax
+    push %rax
+    movq $50, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_195
+    jmp .Lf1_196
+.Lf1_195:
+    movq $63, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_197
+.Lf1_196:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_197:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $17, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 177 9
+    movslq -8(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_199
+    jmp .Lf1_198
+.Lf1_199:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_198:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_201
+    jmp .Lf1_200
+.Lf1_201:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_200:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_203
+    jmp .Lf1_202
+.Lf1_203:
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_202:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 178 9
+    movslq -80(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_204
+    jmp .Lf1_205
+.Lf1_204:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_206
+.Lf1_205:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_207
+    jmp .Lf1_208
+.Lf1_207:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf1_209
+.Lf1_208:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_209:
+.Lf1_206:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $49, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_186
+.Lf1_194:
+    .loc 1 180 9
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_213
+    jmp .Lf1_214
+.Lf1_213:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_217
+    jmp .Lf1_216
+.Lf1_217:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_216:
+    jmp .Lf1_215
+.Lf1_214:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_215:
+    cmpq $0, %rax
+    jne .Lf1_210
+    jmp .Lf1_211
+.Lf1_210:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_218
+    jmp .Lf1_219
+.Lf1_218:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_220
+.Lf1_219:
+    movslq -12(%rbp), %rax
+.Lf1_220:
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    jne .Lf1_221
+    jmp .Lf1_222
+.Lf1_221:
+    movq $0, %rax
+    jmp .Lf1_223
+.Lf1_222:
+    movslq -12(%rbp), %rax
+.Lf1_223:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_212
+.Lf1_211:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_225
+    jmp .Lf1_224
+.Lf1_225:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_224:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_212:
+    movl %eax, -12(%rbp)
+    .loc 1 181 9
+    movslq -76(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_229
+    jmp .Lf1_230
+.Lf1_229:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_231
+.Lf1_230:
+    movq $96, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_231:
+    cmpq $0, %rax
+    jne .Lf1_226
+    jmp .Lf1_227
+.Lf1_226:
+    movq $68, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_232
+    jmp .Lf1_233
+.Lf1_232:
+    movq $17, %rax
+    jmp .Lf1_234
+.Lf1_233:
+    movslq -16(%rbp), %rax
+.Lf1_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_228
+.Lf1_227:
+    movq $23, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_228:
+    movl %eax, -8(%rbp)
+    .loc 1 182 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_236
+    jmp .Lf1_235
+.Lf1_236:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_235:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $45, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_238
+    jmp .Lf1_237
+.Lf1_238:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_239
+    jmp .Lf1_240
+.Lf1_239:
+    movq $59, %rax
+    jmp .Lf1_241
+.Lf1_240:
+    movslq -8(%rbp), %rax
+.Lf1_241:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_237:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_186:
+    .loc 1 184 5
+    movq $58, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_246
+    jmp .Lf1_247
+.Lf1_246:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_248
+.Lf1_247:
+    movslq -28(%rbp), %rax
+.Lf1_248:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_243
+    jmp .Lf1_244
+.Lf1_243:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_250
+    jmp .Lf1_249
+.Lf1_250:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_249:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_252
+    jmp .Lf1_251
+.Lf1_252:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_251:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_245
+.Lf1_244:
+    movq $83, %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_245:
+    cmpq $0, %rax
+    je .Lf1_253
+    .loc 1 185 9
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $89, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_254
+.Lf1_255:
+    movq $8, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_254:
+    movl %eax, -12(%rbp)
+    .loc 1 186 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_257
+    jmp .Lf1_256
+.Lf1_257:
+    movq $1, %rax
+    push %rax
+    movq $36, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_256:
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $72, %rax
+    cmpq $0, %rax
+    jne .Lf1_258
+    jmp .Lf1_259
+.Lf1_258:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_260
+.Lf1_259:
+    movq $59, %rax
+.Lf1_260:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 187 9
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $76, %rax
+    cmpq $0, %rax
+    jne .Lf1_261
+    jmp .Lf1_262
+.Lf1_261:
+    movq $22, %rax
+    jmp .Lf1_263
+.Lf1_262:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf1_263:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_265
+    jmp .Lf1_264
+.Lf1_265:
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_264:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_242
+.Lf1_253:
+    .loc 1 189 9
+    movslq -8(%rbp), %rax
+    subq $84, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $12, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_266
+    jmp .Lf1_267
+.Lf1_266:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_268
+.Lf1_267:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_268:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 190 9
+    movq $11, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_270
+    jmp .Lf1_269
+.Lf1_270:
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_269:
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $83, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -64(%rbp)
+    .loc 1 191 9
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_271
+    jmp .Lf1_272
+.Lf1_271:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -36(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_273
+.Lf1_272:
+    cmpl $68, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $42, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_273:
+    movl %eax, -60(%rbp)
+    addq $0, %rsp
+.Lf1_242:
+    .loc 1 193 5
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_275
+    jmp .Lf1_274
+.Lf1_275:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_274:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_277
+    jmp .Lf1_276
+.Lf1_277:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_276:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_279
+    jmp .Lf1_278
+.Lf1_279:
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_278:
+    push %rax
+    cmpl $82, -68(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 195 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 196 5
+    subq $8, %rsp
+    movq $44, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 197 5
+    movq $7, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 198 5
+    subq $8, %rsp
+    movq $77, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 199 5
+    movq $1, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 200 5
+    subq $64, %rsp
+    .loc 1 201 5
+    subq $256, %rsp
+    .loc 1 203 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 204 9
+    .p2align 4,,10
+.Lf2_3:
+    .loc 1 205 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_5
+    jmp .Lf2_6
+.Lf2_5:
+    movslq -68(%rbp), %rax
+    jmp .Lf2_7
+.Lf2_6:
+    movslq -12(%rbp), %rax
+.Lf2_7:
+    cmpq $54, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_4
+    jmp .Lf2_1
+.Lf2_4:
+    .loc 1 206 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 207 17
+    movq $28, %rax
+    cmpq $0, %rax
+    jne .Lf2_16
+    jmp .Lf2_17
+.Lf2_16:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_18
+.Lf2_17:
+    movslq -340(%rbp), %rax
+.Lf2_18:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_20
+    jmp .Lf2_19
+.Lf2_20:
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf2_21
+    jmp .Lf2_22
+.Lf2_21:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_23
+.Lf2_22:
+    movslq -12(%rbp), %rax
+.Lf2_23:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_19:
+    cmpq $0, %rax
+    jne .Lf2_13
+    jmp .Lf2_14
+.Lf2_13:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_24
+    jmp .Lf2_25
+.Lf2_24:
+    movq $42, %rax
+    jmp .Lf2_26
+.Lf2_25:
+    movslq -344(%rbp), %rax
+.Lf2_26:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_15
+.Lf2_14:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_27
+    jmp .Lf2_28
+.Lf2_27:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_29
+.Lf2_28:
+    movslq -340(%rbp), %rax
+.Lf2_29:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_15:
+    movl %eax, -12(%rbp)
+    .loc 1 208 17
+    movq $9, %rax
+    push %rax
+    movq $84, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $69, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 209 17
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_31
+    jmp .Lf2_30
+.Lf2_31:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_30:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_33
+    jmp .Lf2_32
+.Lf2_33:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_32:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_34
+    jmp .Lf2_35
+.Lf2_34:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_36
+.Lf2_35:
+    movslq -340(%rbp), %rax
+.Lf2_36:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_12:
+    .loc 1 206 38
+    incl -344(%rbp)
+    .loc 1 207 17
+    movq $28, %rax
+    cmpq $0, %rax
+    jne .Lf2_41
+    jmp .Lf2_42
+.Lf2_41:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_43
+.Lf2_42:
+    movslq -340(%rbp), %rax
+.Lf2_43:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_45
+    jmp .Lf2_44
+.Lf2_45:
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf2_46
+    jmp .Lf2_47
+.Lf2_46:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_48
+.Lf2_47:
+    movslq -12(%rbp), %rax
+.Lf2_48:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_44:
+    cmpq $0, %rax
+    jne .Lf2_38
+    jmp .Lf2_39
+.Lf2_38:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_49
+    jmp .Lf2_50
+.Lf2_49:
+    movq $42, %rax
+    jmp .Lf2_51
+.Lf2_50:
+    movslq -344(%rbp), %rax
+.Lf2_51:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_40
+.Lf2_39:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_52
+    jmp .Lf2_53
+.Lf2_52:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_54
+.Lf2_53:
+    movslq -340(%rbp), %rax
+.Lf2_54:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_40:
+    movl %eax, -12(%rbp)
+    .loc 1 208 17
+    movq $9, %rax
+    push %rax
+    movq $84, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $69, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 209 17
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_56
+    jmp .Lf2_55
+.Lf2_56:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_55:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_58
+    jmp .Lf2_57
+.Lf2_58:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_57:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_59
+    jmp .Lf2_60
+.Lf2_59:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_61
+.Lf2_60:
+    movslq -340(%rbp), %rax
+.Lf2_61:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_37:
+    .loc 1 206 38
+    incl -344(%rbp)
+    .loc 1 207 17
+    movq $28, %rax
+    cmpq $0, %rax
+    jne .Lf2_65
+    jmp .Lf2_66
+.Lf2_65:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_67
+.Lf2_66:
+    movslq -340(%rbp), %rax
+.Lf2_67:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_69
+    jmp .Lf2_68
+.Lf2_69:
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf2_70
+    jmp .Lf2_71
+.Lf2_70:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_72
+.Lf2_71:
+    movslq -12(%rbp), %rax
+.Lf2_72:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_68:
+    cmpq $0, %rax
+    jne .Lf2_62
+    jmp .Lf2_63
+.Lf2_62:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_73
+    jmp .Lf2_74
+.Lf2_73:
+    movq $42, %rax
+    jmp .Lf2_75
+.Lf2_74:
+    movslq -344(%rbp), %rax
+.Lf2_75:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_64
+.Lf2_63:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_76
+    jmp .Lf2_77
+.Lf2_76:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_78
+.Lf2_77:
+    movslq -340(%rbp), %rax
+.Lf2_78:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_64:
+    movl %eax, -12(%rbp)
+    .loc 1 208 17
+    movq $9, %rax
+    push %rax
+    movq $84, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $69, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 209 17
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_80
+    jmp .Lf2_79
+.Lf2_80:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_79:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_82
+    jmp .Lf2_81
+.Lf2_82:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_81:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_83
+    jmp .Lf2_84
+.Lf2_83:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_85
+.Lf2_84:
+    movslq -340(%rbp), %rax
+.Lf2_85:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_11:
+    .loc 1 206 38
+    incl -344(%rbp)
+.Lf2_10:
+    addq $0, %rsp
+    .loc 1 211 13
+    movslq -12(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_90
+    jmp .Lf2_89
+.Lf2_90:
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_89:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_86
+    jmp .Lf2_87
+.Lf2_86:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $93, %rax
+    cmpq $0, %rax
+    jne .Lf2_91
+    jmp .Lf2_92
+.Lf2_91:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf2_93
+.Lf2_92:
+    movslq -12(%rbp), %rax
+.Lf2_93:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_88
+.Lf2_87:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_88:
+    movl %eax, -8(%rbp)
+    .loc 1 212 13
+    movq $83, %rax
+    cmpq $40, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -44(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_95
+    jmp .Lf2_94
+.Lf2_95:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_94:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 213 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_2:
+    .loc 1 214 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_3
+.Lf2_1:
+    addq $8, %rsp
+    .loc 1 217 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 218 9
+    jmp .Lf2_99
+    .p2align 4,,10
+.Lf2_98:
+    .loc 1 219 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_101
+    jmp .Lf2_102
+.Lf2_101:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_103
+.Lf2_102:
+    movq $46, %rax
+.Lf2_103:
+    cmpq $93, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_100
+    jmp .Lf2_96
+.Lf2_100:
+    .loc 1 220 13
+    movslq -20(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_104
+    jmp .Lf2_105
+.Lf2_104:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_106
+.Lf2_105:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_106:
+    push %rax
+    movslq -64(%rbp), %rax
+    addq $12, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $31, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 221 13
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_107
+    jmp .Lf2_108
+.Lf2_107:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_110
+    jmp .Lf2_111
+.Lf2_110:
+    movq $63, %rax
+    jmp .Lf2_112
+.Lf2_111:
+    movslq -340(%rbp), %rax
+.Lf2_112:
+    jmp .Lf2_109
+.Lf2_108:
+    movslq -16(%rbp), %rax
+    subq $31, %rax
+    movslq %eax, %rax
+.Lf2_109:
+    push %rax
+    movq $4, %rax
+    push %rax
+    cmpl $88, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 223 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 224 17
+    .p2align 4,,10
+.Lf2_115:
+    .loc 1 225 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_117
+    jmp .Lf2_118
+.Lf2_117:
+    movq $83, %rax
+    jmp .Lf2_119
+.Lf2_118:
+    movslq -8(%rbp), %rax
+.Lf2_119:
+    cmpq $83, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_116
+    jmp .Lf2_113
+.Lf2_116:
+    .loc 1 226 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_120
+    jmp .Lf2_121
+.Lf2_120:
+    movq $73, %rax
+    jmp .Lf2_122
+.Lf2_121:
+    movq $95, %rax
+.Lf2_122:
+    push %rax
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_124
+    jmp .Lf2_123
+.Lf2_124:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_123:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $84, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 227 21
+    movq $49, %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_125
+    jmp .Lf2_126
+.Lf2_125:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_129
+.Lf2_128:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_130
+.Lf2_129:
+    movslq -344(%rbp), %rax
+.Lf2_130:
+    jmp .Lf2_127
+.Lf2_126:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf2_127:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_135
+    jmp .Lf2_134
+.Lf2_135:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_134:
+    cmpq $0, %rax
+    jne .Lf2_131
+    jmp .Lf2_132
+.Lf2_131:
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_133
+.Lf2_132:
+    movslq -32(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_133:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 228 21
+    movq $10, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_137
+    jmp .Lf2_136
+.Lf2_137:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_136:
+    push %rax
+    movslq -48(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_139
+    jmp .Lf2_138
+.Lf2_139:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_138:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 229 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_114:
+    .loc 1 230 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_115
+.Lf2_113:
+    addq $0, %rsp
+    .loc 1 232 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_97:
+.Lf2_99:
+    .loc 1 218 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_98
+.Lf2_96:
+    addq $8, %rsp
+    .loc 1 236 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 237 9
+    .p2align 4,,10
+.Lf2_142:
+    .loc 1 239 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 240 17
+    .p2align 4,,10
+.Lf2_145:
+    .loc 1 241 21
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $15, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $20, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_146
+    jmp .Lf2_147
+.Lf2_146:
+    movslq -12(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_148
+.Lf2_147:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf2_148:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 242 21
+    movq $12, %rax
+    subq $59, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_149
+    jmp .Lf2_150
+.Lf2_149:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_152
+    jmp .Lf2_153
+.Lf2_152:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_154
+.Lf2_153:
+    movq $60, %rax
+.Lf2_154:
+    push %rax
+    movq $59, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_151
+.Lf2_150:
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_156
+    jmp .Lf2_155
+.Lf2_156:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_155:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_151:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 243 21
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_158
+    jmp .Lf2_157
+.Lf2_158:
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $20, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_157:
+    movl %eax, -4(%rbp)
+    .loc 1 244 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_144:
+    .loc 1 245 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_145
+.Lf2_143:
+    addq $0, %rsp
+    .loc 1 247 13
+    movq $30, %rax
+    cmpq $0, %rax
+    jne .Lf2_159
+    jmp .Lf2_160
+.Lf2_159:
+    movq $70, %rax
+    jmp .Lf2_161
+.Lf2_160:
+    movslq -12(%rbp), %rax
+.Lf2_161:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $65, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -60(%rbp)
+    .loc 1 248 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_163
+    jmp .Lf2_162
+.Lf2_163:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_162:
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_164
+    jmp .Lf2_165
+.Lf2_164:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_166
+.Lf2_165:
+    movq $73, %rax
+.Lf2_166:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_168
+    jmp .Lf2_167
+.Lf2_168:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_167:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_170
+    jmp .Lf2_169
+.Lf2_170:
+    movq $32, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_169:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 249 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_141:
+    .loc 1 250 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_142
+.Lf2_140:
+    addq $8, %rsp
+    .loc 1 252 5
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $83, %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 253 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_172
+    jmp .Lf2_173
+.Lf2_172:
+    movslq -44(%rbp), %rax
+    jmp .Lf2_174
+.Lf2_173:
+    movq $40, %rax
+.Lf2_174:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $70, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $0, %rax
+    subq $40, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lf2_175
+    .loc 1 254 9
+    movq $2, %rax
+    push %rax
+    movq $97, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $0, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_177
+    jmp .Lf2_176
+.Lf2_177:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_176:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 255 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_181
+    jmp .Lf2_182
+.Lf2_181:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_183
+.Lf2_182:
+    movq $18, %rax
+.Lf2_183:
+    cmpq $0, %rax
+    jne .Lf2_178
+    jmp .Lf2_179
+.Lf2_178:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_185
+    jmp .Lf2_184
+.Lf2_185:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_184:
+    jmp .Lf2_180
+.Lf2_179:
+    movq $23, %rax
+    cmpq $46, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_180:
+    push %rax
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_187
+    jmp .Lf2_186
+.Lf2_187:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_186:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 256 9
+    cmpl $88, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_188
+    jmp .Lf2_189
+.Lf2_188:
+    movq $22, %rax
+    jmp .Lf2_190
+.Lf2_189:
+    movslq -4(%rbp), %rax
+.Lf2_190:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_192
+    jmp .Lf2_191
+.Lf2_192:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_191:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_171
+.Lf2_175:
+    .loc 1 258 9
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_193
+    jmp .Lf2_194
+.Lf2_193:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_195
+.Lf2_194:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_195:
+    push %rax
+    cmpl $65, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $6, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 259 9
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_197
+    jmp .Lf2_196
+.Lf2_197:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_196:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_199
+    jmp .Lf2_198
+.Lf2_199:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_200
+    jmp .Lf2_201
+.Lf2_200:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_202
+.Lf2_201:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_202:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_198:
+    movl %eax, -76(%rbp)
+    .loc 1 260 9
+    movq $3, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $49, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_171:
+    .loc 1 262 5
+    movq $81, %rax
+    addq $38, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_203
+    jmp .Lf2_204
+.Lf2_203:
+    movslq -8(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_205
+.Lf2_204:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_207
+    jmp .Lf2_206
+.Lf2_207:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_206:
+.Lf2_205:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_208
+    jmp .Lf2_209
+.Lf2_208:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_212
+    jmp .Lf2_211
+.Lf2_212:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_211:
+    jmp .Lf2_210
+.Lf2_209:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_213
+    jmp .Lf2_214
+.Lf2_213:
+    movslq -56(%rbp), %rax
+    jmp .Lf2_215
+.Lf2_214:
+    movslq -8(%rbp), %rax
+.Lf2_215:
+.Lf2_210:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 263 5
+    movq $2, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_217
+    jmp .Lf2_218
+.Lf2_217:
+    cmpl $19, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_219
+.Lf2_218:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_221
+    jmp .Lf2_220
+.Lf2_221:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_220:
+.Lf2_219:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_222
+    .loc 1 264 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_224
+    jmp .Lf2_223
+.Lf2_224:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_223:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_229
+    jmp .Lf2_228
+.Lf2_229:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_228:
+    cmpq $0, %rax
+    jne .Lf2_225
+    jmp .Lf2_226
+.Lf2_225:
+    cmpl $65, -44(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_227
+.Lf2_226:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $64, %rax
+    movq $0, %rax
+    setl %al
+.Lf2_227:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 265 9
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_231
+    jmp .Lf2_230
+.Lf2_231:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_230:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 266 9
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_233
+    jmp .Lf2_232
+.Lf2_233:
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_232:
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_235
+    jmp .Lf2_234
+.Lf2_235:
+    movq $0, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_216
+.Lf2_222:
+    .loc 1 268 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_236
+    jmp .Lf2_237
+.Lf2_236:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf2_238
+.Lf2_237:
+    movslq -12(%rbp), %rax
+.Lf2_238:
+    push %rax
+    movq $38, %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $49, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_239
+    jmp .Lf2_240
+.Lf2_239:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_242
+    jmp .Lf2_243
+.Lf2_242:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_244
+.Lf2_243:
+    movslq -4(%rbp), %rax
+.Lf2_244:
+    jmp .Lf2_241
+.Lf2_240:
+    cmpl $19, -12(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf2_241:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 269 9
+    movq $7, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $6, %rax
+    cmpq $58, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 270 9
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    addq $97, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_246
+    jmp .Lf2_245
+.Lf2_246:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_245:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_248
+    jmp .Lf2_247
+.Lf2_248:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_249
+    jmp .Lf2_250
+.Lf2_249:
+    movq $0, %rax
+    jmp .Lf2_251
+.Lf2_250:
+    movslq -4(%rbp), %rax
+.Lf2_251:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_247:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_216:
+    .loc 1 273 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 274 9
+    .p2align 4,,10
+.Lf2_254:
+    .loc 1 275 13
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_255
+    jmp .Lf2_256
+.Lf2_255:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_257
+.Lf2_256:
+    cmpl $86, -68(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf2_257:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_259
+    jmp .Lf2_258
+.Lf2_259:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_258:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_261
+    jmp .Lf2_260
+.Lf2_261:
+    movslq -72(%rbp), %rax
+    imulq $41, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_260:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 276 13
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_263
+    jmp .Lf2_262
+.Lf2_263:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_262:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 278 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 279 17
+    jmp .Lf2_267
+    .p2align 4,,10
+.Lf2_266:
+    .loc 1 280 21
+    movq $3, %rax
+    push %rax
+    movq $72, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_269
+    jmp .Lf2_268
+.Lf2_269:
+    movq $45, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_268:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 281 21
+    movq $8, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_271
+    jmp .Lf2_270
+.Lf2_271:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_270:
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    jne .Lf2_272
+    jmp .Lf2_273
+.Lf2_272:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf2_274
+.Lf2_273:
+    movslq -340(%rbp), %rax
+.Lf2_274:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 282 21
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $81, %rax
+    cmpq $0, %rax
+    jne .Lf2_275
+    jmp .Lf2_276
+.Lf2_275:
+    movq $93, %rax
+    jmp .Lf2_277
+.Lf2_276:
+    movslq -16(%rbp), %rax
+.Lf2_277:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 283 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_265:
+.Lf2_267:
+    .loc 1 279 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_266
+.Lf2_264:
+    addq $0, %rsp
+    .loc 1 286 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_253:
+    .loc 1 287 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_254
+.Lf2_252:
+    addq $8, %rsp
+    .loc 1 290 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 291 9
+    jmp .Lf2_281
+    .p2align 4,,10
+.Lf2_280:
+    .loc 1 292 13
+    movq $68, %rax
+    cmpq $0, %rax
+    jne .Lf2_282
+    jmp .Lf2_283
+.Lf2_282:
+    movq $89, %rax
+    jmp .Lf2_284
+.Lf2_283:
+    movslq -44(%rbp), %rax
+.Lf2_284:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $38, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_285
+    jmp .Lf2_286
+.Lf2_285:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_287
+.Lf2_286:
+    movslq -8(%rbp), %rax
+.Lf2_287:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 294 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 295 17
+    .p2align 4,,10
+.Lf2_290:
+    .loc 1 296 21
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_292
+    jmp .Lf2_291
+.Lf2_292:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_291:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_293
+    jmp .Lf2_294
+.Lf2_293:
+    movq $32, %rax
+    cmpq $0, %rax
+    jne .Lf2_296
+    jmp .Lf2_297
+.Lf2_296:
+    movq $45, %rax
+    jmp .Lf2_298
+.Lf2_297:
+    movslq -8(%rbp), %rax
+.Lf2_298:
+    jmp .Lf2_295
+.Lf2_294:
+    movq $25, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_295:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 297 21
+    movq $3, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $32, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_300
+    jmp .Lf2_299
+.Lf2_300:
+    movq $1, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_299:
+    movl %eax, -8(%rbp)
+    .loc 1 298 21
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_302
+    jmp .Lf2_301
+.Lf2_302:
+    cmpl $25, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_301:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_307
+    jmp .Lf2_306
+.Lf2_307:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_306:
+    cmpq $0, %rax
+    jne .Lf2_303
+    jmp .Lf2_304
+.Lf2_303:
+    movslq -16(%rbp), %rax
+    imulq $30, %rax
+    movslq %eax, %rax
+    jmp .Lf2_305
+.Lf2_304:
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_305:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 299 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_289:
+    .loc 1 300 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_290
+.Lf2_288:
+    addq $0, %rsp
+    .loc 1 302 13
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $90, %rax
+    cmpq $0, %rax
+    jne .Lf2_308
+    jmp .Lf2_309
+.Lf2_308:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf2_310
+.Lf2_309:
+    movslq -8(%rbp), %rax
+.Lf2_310:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $86, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $50, %rax
+    cmpq $0, %rax
+    jne .Lf2_311
+    jmp .Lf2_312
+.Lf2_311:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_313
+.Lf2_312:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf2_313:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 303 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_279:
+.Lf2_281:
+    .loc 1 291 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_280
+.Lf2_278:
+    addq $8, %rsp
+    .loc 1 306 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_319
+    .p2align 4,,10
+.Lf2_318:
+    .loc 1 307 9
+    movq $88, %rax
+    cmpq $20, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_321
+    jmp .Lf2_320
+.Lf2_321:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_320:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_322
+    jmp .Lf2_323
+.Lf2_322:
+    movq $70, %rax
+    jmp .Lf2_324
+.Lf2_323:
+    movslq -12(%rbp), %rax
+.Lf2_324:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 308 9
+    movslq -44(%rbp), %rax
+    addq $30, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_325
+    jmp .Lf2_326
+.Lf2_325:
+    movq $7, %rax
+    push %rax
+    movq $72, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_329
+    jmp .Lf2_328
+.Lf2_329:
+    movq $71, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_328:
+    jmp .Lf2_327
+.Lf2_326:
+    movq $59, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_331
+    jmp .Lf2_330
+.Lf2_331:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_330:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf2_327:
+    movl %eax, -16(%rbp)
+    .loc 1 310 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 311 13
+    jmp .Lf2_335
+    .p2align 4,,10
+.Lf2_334:
+    .loc 1 312 17
+    movq $2, %rax
+    push %rax
+    movq $98, %rax
+    cmpq $0, %rax
+    jne .Lf2_336
+    jmp .Lf2_337
+.Lf2_336:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_338
+.Lf2_337:
+    movq $36, %rax
+.Lf2_338:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $92, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_339
+    jmp .Lf2_340
+.Lf2_339:
+    movslq -44(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_341
+.Lf2_340:
+    movq $9, %rax
+    cmpq $0, %rax
+    jne .Lf2_342
+    jmp .Lf2_343
+.Lf2_342:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_344
+.Lf2_343:
+    movq $8, %rax
+.Lf2_344:
+.Lf2_341:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 313 17
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_346
+    jmp .Lf2_345
+.Lf2_346:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_348
+    jmp .Lf2_347
+.Lf2_348:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_347:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_345:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_350
+    jmp .Lf2_349
+.Lf2_350:
+    movq $88, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_349:
+    movl %eax, -12(%rbp)
+    .loc 1 314 17
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $18, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 315 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_333:
+.Lf2_335:
+    .loc 1 311 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_334
+.Lf2_332:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_317:
+    .loc 1 306 32
+    incl -340(%rbp)
+.Lf2_319:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_318
+.Lf2_316:
+    addq $8, %rsp
+    .loc 1 319 5
+    movq $21, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $25, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_352
+    jmp .Lf2_351
+.Lf2_352:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_353
+    jmp .Lf2_354
+.Lf2_353:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_355
+.Lf2_354:
+    movslq -12(%rbp), %rax
+.Lf2_355:
+    push %rax
+    cmpl $26, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_351:
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
@@ -0,0 +1,433 @@
+int f0() {
+    int v0 = 31;
+    int v1 = 50;
+    int v2 = 87;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((i0 - v0) > 87) break;
+            v1 = (((25 && v0) != (a1[1][15] == v2)) > ((a1[2][11] <= a1[1][14]) * (i0 ? v2 : v2)));
+            v2 = (((i0 && v3) ? (v3 / 8) : (30 - i0)) % 6);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((v2 * v0) > (i0 > v0)) >= ((i1 == i0) > (v1 == 4)));
+                    v2 = (((84 ? i1 : a1[1][10]) > (20 < v0)) < ((i0 != a1[2][9]) * (32 == v1)));
+                    v2 = (((v3 - a0[9]) && (a1[0][9] + a1[1][2])) >= ((a0[8] >= 52) >= (62 != a0[11])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 * a0[1]) > 97) break;
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                a0[4] = (((5 >= v3) / 3) / 4);
+                v3 = (((19 && a1[3][15]) / 2) + ((i3 / 4) > (v3 == a1[3][7])));
+                a0[9] = (((80 && v2) * (v0 || i3)) && ((v0 > v2) != (v2 / 2)));
+            }
+            v2 = (((a0[11] / 8) && (v0 >= a0[9])) && ((95 <= v3) && (v3 == v1)));
+            a0[6] = (((v0 > v3) % 4) - ((a1[0][5] <= v2) ? (a0[15] == v0) : (v0 || i2)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    v1 = (((v1 >= v1) || (v0 > 17)) / 4);
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v1 = (((63 > i4) - (v1 > 9)) + ((50 != a1[3][0]) < (92 / 9)));
+                a1[1][13] = (((i4 >= a1[1][2]) / 2) / 6);
+                v3 = (((a0[10] >= 85) % 9) - ((a0[14] / 4) == (48 + 76)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        a0[8] = (((v3 % 5) - (v0 && a1[1][8])) >= ((v0 == v2) != (49 != a1[1][5])));
+        v0 = (((59 ? a1[2][14] : i4) && (v1 >= 57)) ? ((17 ? a0[12] : a0[5]) || (i4 ? v3 : v3)) : ((23 < 90) >= (a0[8] > 31)));
+    }
+    if ((((v2 <= v2) ? (74 ? a0[4] : v1) : (v0 && 31)) * ((a0[4] >= v2) >= (98 - 4)))) {
+        a1[3][6] = (((v3 <= 98) < (76 && a1[3][10])) ? ((a0[14] * 93) * (v0 <= a0[3])) : ((v1 ? v3 : v1) < (v0 > 57)));
+        v3 = (((v1 ? v1 : v0) ? (v1 ? 42 : 58) : (v2 < v2)) > ((34 < 14) && (v0 >= a0[7])));
+        v3 = (((97 * a0[3]) || (v0 >= a1[3][1])) / 8);
+    } else {
+        v3 = (((a1[1][3] <= a1[3][5]) == (v3 / 3)) >= ((v2 == 91) != (v1 * a0[11])));
+        v2 = (((95 && a0[1]) != (a0[9] / 6)) - ((50 != 68) - (v3 < a0[3])));
+        v2 = (((a0[10] <= a0[11]) < (v2 != v1)) > ((35 <= v3) >= (8 <= 61)));
+    }
+    v2 = (((99 % 6) < (v1 - v3)) > ((3 <= a0[8]) ? (6 >= a0[12]) : (v0 - v2)));
+    v0 = (((71 || v1) >= (v3 > v2)) != ((a0[15] >= v0) && (v0 > 7)));
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((v1 ? a0[15] : a1[3][9]) > 91) break;
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v3 = (((a1[0][11] <= a0[5]) * (v2 - v3)) != ((v3 || 87) || (a1[2][4] > a0[6])));
+                v1 = (((v3 <= a1[2][15]) / 8) || ((a1[0][11] % 1) - (a0[14] != 21)));
+                a0[11] = (((i6 % 6) % 7) < ((a0[2] && 8) && (v3 < a0[6])));
+            }
+            v2 = (((a1[1][15] > v1) / 5) % 7);
+            a0[10] = (((13 % 1) ? (i6 % 2) : (a1[0][6] % 3)) % 5);
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        if ((a0[0] == 0) > 51) break;
+        v1 = (((a0[10] != v1) == (v2 >= a0[1])) >= ((a0[3] == v3) || (a0[2] * a0[15])));
+        v2 = (((v3 >= v3) / 1) || ((v2 - v1) % 1));
+        for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+            a1[1][10] = (((a1[3][2] * a0[4]) == (v3 <= v0)) * ((i8 * a0[2]) - (a1[1][6] < i8)));
+            v3 = (((66 == v1) < (a0[3] && i8)) >= ((95 >= 18) ? (a0[10] < 5) : (79 + 20)));
+            v2 = (((a0[15] ? 35 : 34) ? (a0[5] < 75) : (74 > v0)) < ((v2 ? a1[2][14] : v2) || (a0[0] < v3)));
+        }
+    }
+    if ((((a0[6] / 3) != (37 > 82)) || ((v0 - a0[9]) < (v1 ? v1 : v2)))) {
+        v0 = (((v0 || 90) <= (a1[2][10] * a0[5])) || ((a1[1][6] >= v1) < (v1 + v1)));
+        v0 = (((31 - v1) <= (v0 && v3)) || ((a0[15] == v3) <= (v1 - 48)));
+        v0 = (((61 > 35) ? (78 > v3) : (44 <= 97)) - ((v2 - v0) + (v3 ? a0[6] : v2)));
+    } else {
+        a1[1][4] = (((a0[5] <= v2) <= (v2 && v1)) <= ((a0[4] != v2) == (v1 > v1)));
+        a1[3][15] = (((v0 < v2) - (60 == a1[2][9])) != ((v2 != a0[15]) + (72 * 11)));
+        v1 = (((v2 <= v0) / 7) + ((a0[0] ? a0[4] : a0[5]) ? (a0[14] > v0) : (v3 < a0[2])));
+    }
+    return (((11 ? a1[1][11] : 85) % 4) == ((v0 * v3) < (a0[12] == v3)));
+}
+int f1() {
+    int v0 = 80;
+    int v1 = 22;
+    int v2 = 95;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v3 > 46) > 58) break;
+            a1[2][13] = (((a0[5] + v0) ? (a1[0][13] ? 33 : 55) : (a1[0][15] * v0)) > ((v3 + 88) / 1));
+            v3 = (((v3 != a0[2]) && (a1[0][7] >= 67)) > ((96 <= 10) ? (v3 % 1) : (v1 > a1[2][0])));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((i0 || 30) / 6) != ((a0[2] == v0) / 6));
+                    v3 = (((v1 || i0) / 6) / 5);
+                    a0[8] = (((a0[13] || 60) != (i1 * 46)) - ((a0[10] ? v1 : i0) || (v2 - 61)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a1[1][7] = (((47 + v2) == (a0[6] - 40)) * ((v3 * i3) == (i3 < a1[0][5])));
+                    v2 = (((v3 > i3) || (a1[1][13] ? i2 : v3)) ? ((a0[7] ? 20 : a0[9]) ? (a0[15] <= v0) : (i3 <= 25)) : ((a1[0][5] ? a0[15] : v1) > (91 == a1[1][3])));
+                    v1 = (((v3 && a0[11]) && (v1 == v3)) && ((64 > a1[0][11]) || (a0[13] % 3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((i2 < 6) <= (v2 * v0)) == ((v0 < v3) / 2));
+            v1 = (((46 > v2) <= (a0[0] >= v2)) <= ((a0[2] || v0) % 8));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[5] = (((27 * a1[2][10]) ? (15 ? 23 : v3) : (v1 * v2)) * ((a0[6] || 6) && (a1[0][14] / 7)));
+            a1[0][11] = (((a1[3][15] || a1[0][7]) / 2) + ((a1[3][3] <= a1[2][11]) + (v0 <= i4)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v2 = (((i5 + a0[2]) / 1) || ((94 * i5) > (v1 <= 43)));
+                a0[11] = (((v0 >= a0[5]) >= (i4 < a1[0][9])) % 1);
+                v2 = (((69 * a1[3][6]) < (82 <= a1[1][14])) - ((74 > v3) >= (a0[13] ? v3 : i4)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        a0[14] = (((8 >= a0[7]) || (i6 - a1[0][5])) - ((v1 ? a1[0][6] : v1) <= (v1 > 6)));
+        v2 = (((0 >= 10) / 8) != ((a1[1][0] - a1[0][15]) > (v2 ? 48 : v1)));
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                if ((v0 * a0[14]) > 54) break;
+                a1[0][2] = (((v3 % 3) ? (a1[0][14] >= i7) : (v2 ? v3 : a0[15])) + ((4 - a1[2][4]) % 3));
+                a1[2][4] = (((v1 * 12) + (v2 + v0)) <= ((a0[1] % 7) ? (i7 ? a1[2][9] : 98) : (a1[1][2] != 34)));
+                a0[7] = (((24 > v0) - (a0[1] != i7)) && ((i6 ? 62 : v2) <= (i7 ? i7 : v1)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                v0 = (((a1[2][12] + i8) != (a1[0][4] ? a0[15] : v2)) || ((v0 && v3) ? (i8 / 6) : (v1 && i9)));
+                v3 = (((v2 + v1) ? (a0[2] + 71) : (a1[0][9] % 6)) != ((v0 >= 0) && (a1[0][9] && i9)));
+                v1 = (((i8 ? v3 : 44) + (95 / 6)) || ((i8 != 44) ? (v2 % 9) : (v1 >= a1[1][1])));
+            }
+            v0 = (((v0 / 8) <= (v0 % 5)) ? ((v2 < v2) != (i8 && 51)) : ((i8 || a0[12]) ? (a1[2][0] || a1[1][13]) : (v2 ? a1[2][13] : i8)));
+            a1[0][2] = (((v2 ? v0 : a1[3][14]) == (v2 != 14)) ? ((v2 > a0[10]) <= (v0 >= a0[1])) : ((v1 <= v0) ? (a1[2][2] - v2) : (a1[1][8] ? 40 : 9)));
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        do {
+            {
+                int i11 = 0;
+                while (i11 < 3) {
+                    if ((v0 - v2) > 53) break;
+                    v0 = (((i10 == v1) == (54 || 68)) - ((i10 - v2) ? (i10 != a0[6]) : (v1 ? a1[2][7] : a0[0])));
+                    v2 = (((i11 != v0) == (i11 >= a1[0][5])) * ((v2 >= a1[3][3]) != (v3 - v3)));
+                    v0 = (((i11 == v2) == (i10 < i11)) - ((79 % 1) == (a1[1][15] ? v1 : v2)));
+                    i11 = i11 + 1;
+                }
+            }
+            a1[1][6] = (((90 <= 59) * (a0[13] ? 68 : v3)) / 5);
+            v2 = (((95 * a0[13]) < (v2 / 5)) || ((2 < 22) + (a0[14] + 6)));
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    if ((((v3 != v0) <= (14 ? v1 : v2)) + ((30 > 33) % 7))) {
+        a0[9] = (((a0[1] || v2) / 3) && ((v1 / 3) - (77 <= v1)));
+        a0[2] = (((v1 && v1) < (90 * v3)) >= ((84 != v0) < (v0 >= 24)));
+        v1 = (((a0[4] > v3) * (87 < v2)) ? ((v3 * v3) < (v1 || a0[5])) : ((1 >= 23) != (a0[1] - 48)));
+    } else {
+        a1[1][15] = (((v3 || a0[4]) * (36 && a0[0])) > ((a0[11] == a1[1][15]) <= (v3 * 4)));
+        a1[0][7] = (((v3 * 16) / 4) + ((v1 + v2) && (13 || v3)));
+        a0[7] = (((v3 ? v3 : a1[2][12]) + (71 ? v1 : v2)) / 2);
+    }
+    if ((((v0 == 60) < (a1[0][4] < 98)) >= ((88 - 90) * (v0 < 5)))) {
+        v1 = (((v0 ? a0[11] : a0[6]) ? (v2 - 12) : (91 != v1)) && ((v0 >= 52) != (37 >= v1)));
+        a1[0][9] = (((a1[1][2] + a0[6]) <= (v2 == v1)) ? ((v0 >= v3) - (72 == v0)) : ((35 || v0) * (85 >= v3)));
+        v3 = (((v2 != a0[3]) == (12 / 5)) != ((v3 ? 7 : 62) && (53 <= v3)));
+    } else {
+        a0[13] = (((24 != v1) ? (v0 / 8) : (v3 > 5)) || ((93 && v1) <= (v1 ? 23 : v0)));
+        a1[0][10] = (((v0 % 4) / 2) < ((v3 > a1[3][11]) ? (a1[3][11] % 7) : (a0[9] + v1)));
+        v3 = (((a1[3][6] <= a0[8]) + (36 ? v1 : 77)) ? ((v2 ? a0[15] : a1[0][6]) == (v1 <= a0[3])) : ((a1[3][10] || v0) * (v2 - v3)));
+    }
+    {
+        int i12 = 0;
+        while (i12 < 2) {
+            {
+                int i13 = 0;
+                while (i13 < 5) {
+                    a1[0][5] = (((29 >= v3) + (75 && 66)) ? ((i13 ? 41 : a1[3][7]) || (i13 / 3)) : ((a1[2][0] != a1[1][4]) % 4));
+                    v3 = (((a1[2][1] < a1[1][3]) % 6) - ((v1 + 20) ? (i13 ? 35 : a1[1][12]) : (v0 < a1[3][14])));
+                    v0 = (((i13 ? 89 : a0[3]) ? (a0[7] / 4) : (a1[2][0] / 9)) % 7);
+                    i13 = i13 + 1;
+                }
+            }
+            v3 = (((i12 + a1[1][9]) != (v2 * 85)) % 5);
+            v0 = (((a1[2][11] ? v0 : a1[2][13]) && (v0 && v3)) < ((v1 ? 22 : i12) > (v3 || v2)));
+            i12 = i12 + 1;
+        }
+    }
+    {
+        int i14 = 0;
+        do {
+            if ((i14 / 2) > 97) break;
+            a0[8] = (((a1[2][13] ? v3 : v0) / 7) ? ((v0 / 7) != (a1[2][3] + a1[1][6])) : ((a0[1] < v3) != (46 || 66)));
+            {
+                int i15 = 0;
+                while (i15 < 5) {
+                    v0 = (((a0[10] ? v0 : a1[0][2]) && (a1[2][2] && a1[3][15])) % 6);
+                    a0[4] = (((v3 < v1) && (a0[9] || v0)) <= ((a1[3][8] + 60) <= (v0 / 2)));
+                    v0 = (((79 - i15) < (i15 ? a0[2] : i14)) >= ((34 > v1) >= (54 * a0[7])));
+                    i15 = i15 + 1;
+                }
+            }
+            v2 = (((42 - v2) % 6) * ((a0[2] && v3) && (a0[11] < 30)));
+            i14 = i14 + 1;
+        } while (i14 < 6);
+    }
+    return (((v1 - 33) ? (v2 > v2) : (v1 < v3)) < ((v0 + a0[0]) ? (v0 % 3) : (74 <= a1[2][3])));
+}
+int f2() {
+    int v0 = 40;
+    int v1 = 70;
+    int v2 = 70;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    a0[6] = (((a1[1][9] == v2) != (v0 <= v3)) < ((v0 == a0[14]) % 9));
+    a1[0][10] = (((26 / 1) % 4) > ((v1 || v3) == (v2 / 3)));
+    {
+        int i0 = 0;
+        do {
+            if ((v0 && 16) > 93) break;
+            v1 = (((i0 * 24) ? (a1[3][1] - i0) : (a0[11] == 39)) != ((v0 % 8) || (82 < a1[3][12])));
+            v2 = (((v0 > 59) % 4) && ((i0 && 87) + (a1[2][8] >= v2)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((2 ? v2 : a0[6]) > 95) break;
+                v0 = (((34 * a1[0][12]) <= (v1 != v0)) == ((v2 % 3) != (87 != 32)));
+                a1[0][10] = (((88 || 88) || (17 / 6)) || ((96 <= 26) == (i0 <= v3)));
+                v2 = (((39 + a1[0][0]) && (i0 != 69)) ? ((a0[1] || v2) / 6) : ((43 ? 94 : a1[2][4]) <= (13 + i0)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    v3 = (((a0[5] ? v1 : v0) % 2) * ((17 + 56) < (v2 + v0)));
+    a0[2] = (((5 % 4) <= (v3 ? v1 : a0[2])) < ((a1[1][8] < v1) / 1));
+    if ((((32 - 22) == (a1[3][0] * v3)) == ((95 <= v2) * (6 >= a1[1][0])))) {
+        a0[7] = (((v2 && v0) - (v2 || a1[1][1])) || ((v2 && v1) * (v3 < v3)));
+        v1 = (((v3 % 4) / 7) && ((v0 % 8) - (v3 >= v1)));
+        v3 = (((26 / 1) % 1) / 2);
+    } else {
+        v3 = (((v0 && v1) / 6) * ((25 || 62) - (a0[8] > v2)));
+        v1 = (((a0[9] && v2) - (v3 > a0[4])) == ((58 - a1[3][9]) != (v2 ? a1[1][1] : a0[3])));
+        a0[6] = (((v0 <= v2) == (v3 || v0)) <= ((a1[3][9] - 23) * (a1[3][13] ? 95 : 0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v2 = (((i2 && i2) >= (5 ? v3 : v3)) + ((8 == 93) ? (a1[3][8] + v3) : (a1[3][12] % 1)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v3 = (((v3 ? v2 : a0[14]) <= (36 ? v1 : a0[13])) % 3);
+                    v1 = (((v2 / 1) == (v3 >= a1[2][15])) == ((a1[3][7] <= a1[0][13]) / 5));
+                    a0[13] = (((a0[11] + 68) && (51 > i2)) + ((a0[10] < a1[1][0]) <= (a0[0] == 35)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[13] = (((a1[0][14] != i2) <= (v1 % 9)) >= ((v0 / 3) + (v2 && v2)));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((58 <= v3) <= (v3 >= v3)) ? ((v3 / 7) ? (a0[13] < a1[3][5]) : (12 != v1)) : ((v3 ? a0[6] : v0) == (v3 > v1)));
+    if ((((a0[7] % 1) && (v3 < 85)) || ((a1[3][13] % 8) / 8))) {
+        v3 = (((a1[3][7] == a0[14]) >= (a1[2][13] / 9)) > ((10 || v1) % 8));
+        v0 = (((v0 - a1[0][9]) ? (60 >= v2) : (27 * a1[1][6])) + ((v3 == a1[2][11]) ? (a1[1][5] || 89) : (41 < a0[5])));
+        v1 = (((a0[0] == 15) && (v3 - a0[4])) > ((v2 - v2) % 1));
+    } else {
+        a0[8] = (((v2 / 8) != (v0 + v2)) ? ((64 > v1) == (a1[0][14] == a1[0][9])) : ((a1[0][3] && a0[8]) && (66 == v0)));
+        a1[3][8] = (((38 && 57) < (a0[1] % 5)) <= ((a1[1][6] && v1) ? (55 < v0) : (v2 ? 63 : v1)));
+        v3 = (((a0[3] != 7) < (a1[0][0] ? v3 : v0)) <= ((v0 ? v0 : 52) > (v3 == v1)));
+    }
+    if ((((54 < 85) ? (v3 <= v0) : (a0[5] != v1)) > ((a0[7] < 57) == (55 ? a1[3][14] : v0)))) {
+        v3 = (((a1[2][8] >= v1) <= (a1[1][3] / 2)) + ((v2 <= v0) <= (a1[3][12] && a0[1])));
+        v0 = (((v0 ? v0 : 44) > (v0 ? a0[9] : v0)) ? ((v3 != a1[2][9]) <= (v0 % 2)) : ((v0 ? v2 : v2) > (v3 < a0[0])));
+        a1[1][15] = (((65 % 4) || (v3 ? 49 : a1[3][4])) + ((v0 || 27) != (80 * a1[3][8])));
+    } else {
+        v3 = (((36 < 25) + (47 == v2)) ? ((v1 < 31) == (v2 && a0[10])) : ((44 <= 65) > (93 - v2)));
+        v1 = (((v2 * v1) == (v1 == 67)) > ((v2 && v2) / 1));
+        v3 = (((23 == v2) + (94 != 50)) ? ((v0 < 47) / 7) : ((v3 % 3) ? (v2 ? v2 : v0) : (v2 != v2)));
+    }
+    return (((85 / 6) > (v3 ? v2 : a1[2][15])) < ((v0 || a1[0][4]) - (30 && v0)));
+}
+int f3() {
+    int v0 = 71;
+    int v1 = 50;
+    int v2 = 46;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a0[2] <= 89) > 80) break;
+        {
+            int i1 = 0;
+            do {
+                if ((v3 * v3) > 63) break;
+                a0[9] = (((11 - 45) / 9) / 2);
+                a0[5] = (((v2 ? a1[3][10] : i1) * (a1[3][10] > v2)) && ((a1[1][11] % 8) >= (38 <= v0)));
+                v3 = (((a1[0][6] <= i0) % 1) >= ((v3 && 25) && (v1 * a0[0])));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v0 = (((v0 / 4) > (24 != v0)) * ((85 ? 66 : 9) < (i0 || 26)));
+        a0[13] = (((16 == v3) * (v0 || 26)) <= ((v2 && v0) - (6 <= a1[2][2])));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    a1[1][4] = (((v0 > a1[0][14]) * (v3 < v3)) == ((a0[0] != v1) == (v3 - a0[3])));
+                    v0 = (((a1[3][6] || 62) + (i2 % 2)) > ((a1[0][5] + a1[1][14]) % 4));
+                    v0 = (((v1 == v1) * (87 && 83)) && ((i2 % 3) + (v0 + i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a1[2][4] = (((i2 * v1) * (a0[14] >= a0[13])) == ((v0 >= v1) && (a0[6] * v0)));
+            v0 = (((i2 + v1) >= (13 ? 30 : 68)) && ((45 * i2) > (v0 * 8)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((v2 >= v3) != (a0[7] / 6)) ? ((v2 % 9) != (v2 >= a1[3][11])) : ((v3 != v3) == (v3 * a1[1][12])))) {
+        a1[2][10] = (((5 == v1) + (a0[8] - 82)) != ((v0 || a0[12]) < (v0 % 4)));
+        a0[13] = (((a1[3][11] - a0[1]) > (v0 / 6)) ? ((v1 > v2) < (v0 == 24)) : ((v1 / 6) > (v3 != v2)));
+        v2 = (((54 >= a0[2]) < (v1 == v3)) && ((v3 - v2) - (19 ? 22 : 12)));
+    } else {
+        v1 = (((v0 == a0[0]) || (v1 ? v1 : v3)) ? ((55 == v0) % 2) : ((v2 && v1) ? (a1[0][14] + 39) : (a0[5] != v3)));
+        v0 = (((v0 ? v0 : 40) + (a0[14] || v2)) - ((v2 % 2) - (v2 ? v1 : v0)));
+        v1 = (((71 != v2) == (v1 != v2)) / 1);
+    }
+    v2 = (((v0 ? v0 : a0[8]) >= (v1 || v3)) && ((v3 == a1[0][8]) % 9));
+    v1 = (((v2 > v1) && (a0[12] != v0)) - ((a1[2][13] * 64) ? (v0 * 61) : (v2 == v0)));
+    {
+        int i4 = 0;
+        do {
+            if ((v3 / 7) > 70) break;
+            v0 = (((a0[3] <= i4) % 6) * ((i4 <= i4) || (a1[1][0] + 8)));
+            {
+                int i5 = 0;
+                do {
+                    a0[5] = (((v0 + i4) < (95 && 72)) >= ((42 < v1) <= (v2 || 15)));
+                    v3 = (((a1[0][11] % 5) % 3) >= ((50 || v3) - (a1[1][4] + a0[7])));
+                    v3 = (((i5 ? 27 : a1[2][13]) >= (40 || a1[0][10])) / 8);
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v2 = (((v3 * i4) != (v1 / 6)) > ((76 - v1) && (74 <= v2)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    if ((((v0 ? v1 : v2) || (v3 && 13)) % 9)) {
+        v2 = (((2 == v3) + (v2 >= v0)) != ((a0[12] % 3) ? (v0 ? v1 : 58) : (a0[12] || v1)));
+        v2 = (((78 <= v1) ? (a1[3][5] ? a1[1][10] : a1[0][8]) : (v1 == a1[2][7])) % 2);
+        a1[1][2] = (((56 != v3) == (v1 == a1[0][3])) - ((81 - a1[0][6]) ? (v3 >= 99) : (85 ? v3 : v1)));
+    } else {
+        v3 = (((v0 || v3) && (v2 >= v3)) && ((2 * 55) < (v3 > v3)));
+        v3 = (((v3 >= a1[2][3]) || (41 ? a1[3][13] : 62)) / 6);
+        v0 = (((v1 ? v2 : v0) ? (v2 || v0) : (v1 == v1)) + ((13 >= 35) == (a1[2][15] * 71)));
+    }
+    if ((((v2 + 59) != (69 % 7)) * ((v1 ? v0 : a0[5]) == (v2 + a1[2][8])))) {
+        v1 = (((99 != v2) ? (v1 != 59) : (v1 - a1[0][12])) >= ((56 ? a1[3][5] : a1[2][6]) <= (a0[4] <= v2)));
+        v2 = (((v3 == v2) + (v0 - a0[6])) || ((v0 != v3) < (v1 % 8)));
+        v1 = (((v3 ? 48 : 13) * (32 < v3)) < ((v3 % 8) ? (v3 == 6) : (42 - v3)));
+    } else {
+        v3 = (((80 > v3) / 5) || ((a0[9] || v0) > (a1[1][9] <= 68)));
+        a0[14] = (((a0[15] - 62) < (89 / 2)) <= ((v0 % 4) < (v3 > a1[3][6])));
+        v1 = (((a1[2][7] + v3) ? (a1[3][13] < v2) : (v0 <= a1[1][3])) / 6);
+    }
+    a1[2][11] = (((4 != v1) ? (81 > v1) : (v1 * 48)) * ((v0 != v0) == (a1[1][15] && a0[11])));
+    if ((((27 > a1[2][5]) == (a1[3][8] > 81)) < ((73 ? 66 : v3) + (v1 ? v0 : v3)))) {
+        v2 = (((v3 ? 57 : v1) + (32 - 26)) <= ((v0 ? 79 : 46) && (50 / 9)));
+        a1[1][6] = (((v0 % 5) - (a0[1] * 77)) ? ((a0[4] ? v0 : a0[9]) >= (v0 - v1)) : ((a0[15] + v3) ? (v1 != v3) : (94 * 39)));
+        v0 = (((65 <= a1[0][0]) != (a1[2][9] != v3)) < ((v2 == 16) >= (v3 < a0[12])));
+    } else {
+        a1[1][9] = (((96 ? a0[11] : a1[2][8]) > (38 != a1[3][2])) / 4);
+        v1 = (((v2 ? v3 : v1) ? (v2 % 5) : (a1[3][5] != v1)) > ((40 + 15) / 3));
+        a1[2][12] = (((v0 < v0) ? (v0 >= a0[12]) : (v0 % 3)) + ((a1[0][13] && 27) && (v1 + a1[0][11])));
+    }
+    return (((v2 - a0[14]) / 6) && ((74 || v0) ? (v1 > v2) : (63 - a1[3][9])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
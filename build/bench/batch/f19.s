@@ -0,0 +1,10199 @@
+    .file 1 "build/bench/batch/f19.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 426 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 427 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 428 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 429 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 430 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 431 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 432 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $31, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $50, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $87, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $3, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    jmp .Lf0_4
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movslq -340(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_5
+    jmp .Lf0_1
+.Lf0_5:
+    .loc 1 12 13
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_7
+    jmp .Lf0_6
+.Lf0_7:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_6:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_9
+.Lf0_8:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -12(%rbp), %rax
+.Lf0_10:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 13 13
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_15
+    jmp .Lf0_14
+.Lf0_15:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_14:
+    cmpq $0, %rax
+    jne .Lf0_11
+    jmp .Lf0_12
+.Lf0_11:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_13
+.Lf0_12:
+    movq $30, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_13:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 16 17
+    jmp .Lf0_19
+    .p2align 4,,10
+.Lf0_18:
+    .loc 1 17 21
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $4, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 18 21
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_21
+.Lf0_20:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_22
+.Lf0_21:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf0_22:
+    push %rax
+    movq $20, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $32, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 19 21
+    movslq -16(%rbp), %rax
+    subl -44(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_24
+    jmp .Lf0_23
+.Lf0_24:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_23:
+    push %rax
+    cmpl $52, -48(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $62, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 20 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_17:
+.Lf0_19:
+    .loc 1 16 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_18
+.Lf0_16:
+    addq $0, %rsp
+    .loc 1 23 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+.Lf0_4:
+    .loc 1 10 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 27 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 28 9
+    .p2align 4,,10
+.Lf0_27:
+    .loc 1 29 13
+    movslq -340(%rbp), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_28
+    jmp .Lf0_25
+.Lf0_28:
+    .loc 1 30 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_34
+    .p2align 4,,10
+.Lf0_33:
+    .loc 1 31 17
+    movq $4, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 32 17
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_38
+.Lf0_39:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_38:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 33 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_41
+    jmp .Lf0_40
+.Lf0_41:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_40:
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_43
+    jmp .Lf0_42
+.Lf0_43:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_42:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_45
+    jmp .Lf0_44
+.Lf0_45:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_44:
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf0_37:
+    .loc 1 30 38
+    incl -344(%rbp)
+    .loc 1 31 17
+    movq $4, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 32 17
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_47
+    jmp .Lf0_46
+.Lf0_47:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_46:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 33 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_49
+    jmp .Lf0_48
+.Lf0_49:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_48:
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_51
+    jmp .Lf0_50
+.Lf0_51:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_50:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_53
+    jmp .Lf0_52
+.Lf0_53:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_52:
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf0_36:
+    .loc 1 30 38
+    incl -344(%rbp)
+.Lf0_34:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $7, %rax
+    jl .Lf0_33
+.Lf0_35:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_31
+    .loc 1 31 17
+    movq $4, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 32 17
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_54
+.Lf0_55:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_54:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 33 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_57
+    jmp .Lf0_56
+.Lf0_57:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_56:
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_58
+.Lf0_59:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_58:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_60
+.Lf0_61:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_60:
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf0_32:
+    .loc 1 30 38
+    incl -344(%rbp)
+    jmp .Lf0_35
+.Lf0_31:
+    addq $0, %rsp
+    .loc 1 35 13
+    movq $8, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_63
+    jmp .Lf0_62
+.Lf0_63:
+    movslq -4(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_62:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_65
+    jmp .Lf0_64
+.Lf0_65:
+    movq $95, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_66
+.Lf0_67:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_66:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_64:
+    movl %eax, -12(%rbp)
+    .loc 1 36 13
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_68
+    jmp .Lf0_69
+.Lf0_68:
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_70
+.Lf0_69:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_72
+    jmp .Lf0_71
+.Lf0_72:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_71:
+.Lf0_70:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 37 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_26:
+    .loc 1 38 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_27
+.Lf0_25:
+    addq $8, %rsp
+    .loc 1 40 5
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_74
+    jmp .Lf0_73
+.Lf0_74:
+    cmpl $17, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_73:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 41 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_80
+    .p2align 4,,10
+.Lf0_79:
+    .loc 1 43 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 44 13
+    .p2align 4,,10
+.Lf0_83:
+    .loc 1 45 17
+    movq $50, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $92, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $9, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $63, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 46 17
+    movq $6, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 47 17
+    movq $4, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $48, %rax
+    addq $76, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    cmpl $85, -40(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 48 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_82:
+    .loc 1 49 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_83
+.Lf0_81:
+    addq $0, %rsp
+    .loc 1 51 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_85
+    jmp .Lf0_84
+.Lf0_85:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_84:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $49, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -48(%rbp)
+    .loc 1 52 9
+    movq $59, %rax
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf0_91
+.Lf0_90:
+    movslq -340(%rbp), %rax
+.Lf0_91:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_93
+    jmp .Lf0_92
+.Lf0_93:
+    cmpl $57, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_92:
+    cmpq $0, %rax
+    jne .Lf0_86
+    jmp .Lf0_87
+.Lf0_86:
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_95
+.Lf0_94:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_96
+.Lf0_95:
+    movslq -60(%rbp), %rax
+.Lf0_96:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_100
+.Lf0_99:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_101
+.Lf0_100:
+    movslq -16(%rbp), %rax
+.Lf0_101:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+    jmp .Lf0_88
+.Lf0_87:
+    movq $23, %rax
+    cmpq $90, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $31, -48(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_88:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_78:
+    .loc 1 41 30
+    incl -340(%rbp)
+.Lf0_80:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_79
+.Lf0_77:
+    addq $8, %rsp
+    .loc 1 54 5
+    movslq -64(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $98, %rax
+    subq $4, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_104
+.Lf0_103:
+    movq $74, %rax
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_107
+.Lf0_106:
+    movslq -64(%rbp), %rax
+    jmp .Lf0_108
+.Lf0_107:
+    movslq -8(%rbp), %rax
+.Lf0_108:
+    jmp .Lf0_105
+.Lf0_104:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_110
+    jmp .Lf0_109
+.Lf0_110:
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_109:
+.Lf0_105:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_111
+    .loc 1 55 9
+    cmpl $98, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_116
+    jmp .Lf0_115
+.Lf0_116:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_115:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_112
+    jmp .Lf0_113
+.Lf0_112:
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -24(%rbp), %rax
+    imulq $93, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_114
+.Lf0_113:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_118
+.Lf0_117:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_119
+.Lf0_118:
+    movslq -8(%rbp), %rax
+.Lf0_119:
+    push %rax
+    cmpl $57, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_114:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 56 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_125
+.Lf0_124:
+    movslq -4(%rbp), %rax
+.Lf0_125:
+    cmpq $0, %rax
+    jne .Lf0_120
+    jmp .Lf0_121
+.Lf0_120:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_127
+.Lf0_126:
+    movq $42, %rax
+    jmp .Lf0_128
+.Lf0_127:
+    movq $58, %rax
+.Lf0_128:
+    jmp .Lf0_122
+.Lf0_121:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf0_122:
+    push %rax
+    movq $34, %rax
+    cmpq $14, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_129
+.Lf0_130:
+    movslq -4(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_129:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 57 9
+    movq $8, %rax
+    push %rax
+    movq $97, %rax
+    imull -68(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_132
+    jmp .Lf0_131
+.Lf0_132:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_131:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_102
+.Lf0_111:
+    .loc 1 59 9
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $91, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 60 9
+    movslq -16(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $50, %rax
+    cmpq $68, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_134
+    jmp .Lf0_133
+.Lf0_134:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_133:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 61 9
+    movslq -40(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $35, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    cmpq $61, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_102:
+    .loc 1 63 5
+    movq $6, %rax
+    push %rax
+    movq $99, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_135
+    jmp .Lf0_136
+.Lf0_135:
+    movq $6, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_137:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 64 5
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_139
+    jmp .Lf0_138
+.Lf0_139:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_138:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_140
+.Lf0_141:
+    cmpl $7, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_140:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 66 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 67 9
+    jmp .Lf0_145
+    .p2align 4,,10
+.Lf0_144:
+    .loc 1 68 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_147
+    jmp .Lf0_148
+.Lf0_147:
+    movslq -20(%rbp), %rax
+    jmp .Lf0_149
+.Lf0_148:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf0_149:
+    cmpq $91, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_146
+    jmp .Lf0_142
+.Lf0_146:
+    .loc 1 69 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_155
+    .p2align 4,,10
+.Lf0_154:
+    .loc 1 70 17
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_157
+    jmp .Lf0_156
+.Lf0_157:
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_156:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_159
+    jmp .Lf0_158
+.Lf0_159:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_158:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 71 17
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_161
+    jmp .Lf0_160
+.Lf0_161:
+    cmpl $21, -24(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_160:
+    movl %eax, -8(%rbp)
+    .loc 1 72 17
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_162
+.Lf0_163:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_162:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_165
+    jmp .Lf0_164
+.Lf0_165:
+    movslq -16(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_164:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lf0_153:
+    .loc 1 69 38
+    incl -344(%rbp)
+.Lf0_155:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_154
+.Lf0_152:
+    addq $0, %rsp
+    .loc 1 74 13
+    movq $7, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 75 13
+    movq $5, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $13, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_166
+    jmp .Lf0_167
+.Lf0_166:
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_168
+.Lf0_167:
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_168:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 76 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_143:
+.Lf0_145:
+    .loc 1 67 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_144
+.Lf0_142:
+    addq $8, %rsp
+    .loc 1 79 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_174
+    .p2align 4,,10
+.Lf0_173:
+    .loc 1 80 9
+    cmpl $0, -80(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $51, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_175
+    jmp .Lf0_171
+.Lf0_175:
+    .loc 1 81 9
+    movslq -40(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_177
+    jmp .Lf0_176
+.Lf0_177:
+    movslq -72(%rbp), %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_176:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 82 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_179
+    jmp .Lf0_178
+.Lf0_179:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_178:
+    movl %eax, -12(%rbp)
+    .loc 1 83 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_185
+    .p2align 4,,10
+.Lf0_184:
+    .loc 1 84 13
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 85 13
+    movq $66, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_187
+    jmp .Lf0_186
+.Lf0_187:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $95, %rax
+    cmpq $18, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_188
+    jmp .Lf0_189
+.Lf0_188:
+    cmpl $5, -40(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_190
+.Lf0_189:
+    movq $79, %rax
+    addq $20, %rax
+    movslq %eax, %rax
+.Lf0_190:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 86 13
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_195
+.Lf0_194:
+    movq $35, %rax
+    jmp .Lf0_196
+.Lf0_195:
+    movq $34, %rax
+.Lf0_196:
+    cmpq $0, %rax
+    jne .Lf0_191
+    jmp .Lf0_192
+.Lf0_191:
+    cmpl $75, -60(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_193
+.Lf0_192:
+    movq $74, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_193:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_197
+    jmp .Lf0_198
+.Lf0_197:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf0_199
+.Lf0_198:
+    movslq -12(%rbp), %rax
+.Lf0_199:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_201
+    jmp .Lf0_200
+.Lf0_201:
+    movslq -80(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_200:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_183:
+    .loc 1 83 34
+    incl -344(%rbp)
+.Lf0_185:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_184
+.Lf0_182:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_172:
+    .loc 1 79 30
+    incl -340(%rbp)
+.Lf0_174:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_173
+.Lf0_171:
+    addq $8, %rsp
+    .loc 1 89 5
+    movq $3, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $37, %rax
+    cmpq $82, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_204
+    jmp .Lf0_203
+.Lf0_204:
+    movslq -4(%rbp), %rax
+    subl -44(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_206
+.Lf0_205:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_207
+.Lf0_206:
+    movslq -12(%rbp), %rax
+.Lf0_207:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_203:
+    cmpq $0, %rax
+    je .Lf0_208
+    .loc 1 90 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_210
+    jmp .Lf0_209
+.Lf0_210:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_209:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_212
+    jmp .Lf0_211
+.Lf0_212:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_211:
+    movl %eax, -4(%rbp)
+    .loc 1 91 9
+    movq $31, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_216
+    jmp .Lf0_215
+.Lf0_216:
+    movslq -20(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $48, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_215:
+    movl %eax, -4(%rbp)
+    .loc 1 92 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_217
+    jmp .Lf0_218
+.Lf0_217:
+    movslq -56(%rbp), %rax
+    jmp .Lf0_219
+.Lf0_218:
+    movslq -12(%rbp), %rax
+.Lf0_219:
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $61, %rax
+    cmpq $35, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_221
+.Lf0_220:
+    movq $78, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_222
+.Lf0_221:
+    movq $44, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setle %al
+.Lf0_222:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_202
+.Lf0_208:
+    .loc 1 94 9
+    movslq -60(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_224
+    jmp .Lf0_223
+.Lf0_224:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_223:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 95 9
+    movq $60, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $72, %rax
+    imulq $11, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 96 9
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_228
+    jmp .Lf0_229
+.Lf0_228:
+    movslq -64(%rbp), %rax
+    jmp .Lf0_230
+.Lf0_229:
+    movslq -60(%rbp), %rax
+.Lf0_230:
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -24(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_227
+.Lf0_226:
+    movslq -16(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf0_227:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_202:
+    .loc 1 98 5
+    movq $4, %rax
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    jne .Lf0_231
+    jmp .Lf0_232
+.Lf0_231:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_233
+.Lf0_232:
+    movq $85, %rax
+.Lf0_233:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 100 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 101 5
+    subq $8, %rsp
+    movq $80, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 102 5
+    movq $22, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 103 5
+    subq $8, %rsp
+    movq $95, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 104 5
+    movq $32, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 105 5
+    subq $64, %rsp
+    .loc 1 106 5
+    subq $256, %rsp
+    .loc 1 108 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 109 9
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 110 13
+    cmpl $46, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $58, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_4
+    jmp .Lf1_1
+.Lf1_4:
+    .loc 1 111 13
+    movslq -60(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_5
+    jmp .Lf1_6
+.Lf1_5:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_8
+    jmp .Lf1_9
+.Lf1_8:
+    movq $33, %rax
+    jmp .Lf1_10
+.Lf1_9:
+    movq $55, %rax
+.Lf1_10:
+    jmp .Lf1_7
+.Lf1_6:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_7:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $88, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 112 13
+    movslq -16(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_12
+    jmp .Lf1_11
+.Lf1_12:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_11:
+    push %rax
+    movq $96, %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_13
+    jmp .Lf1_14
+.Lf1_13:
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_15
+.Lf1_14:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_15:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 114 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 115 17
+    .p2align 4,,10
+.Lf1_18:
+    .loc 1 116 21
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_20
+    jmp .Lf1_19
+.Lf1_20:
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_19:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 117 21
+    movq $5, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_22
+    jmp .Lf1_21
+.Lf1_22:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_21:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 118 21
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_24
+.Lf1_23:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_25
+.Lf1_24:
+    movslq -340(%rbp), %rax
+.Lf1_25:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_27
+    jmp .Lf1_26
+.Lf1_27:
+    movslq -12(%rbp), %rax
+    subq $61, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_26:
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_29
+    jmp .Lf1_28
+.Lf1_29:
+    movq $60, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_28:
+    push %rax
+    movslq -344(%rbp), %rax
+    imulq $46, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    .loc 1 119 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_17:
+    .loc 1 120 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_18
+.Lf1_16:
+    addq $0, %rsp
+    .loc 1 122 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+    .loc 1 123 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 126 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 127 9
+    .p2align 4,,10
+.Lf1_32:
+    .loc 1 129 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 130 17
+    jmp .Lf1_36
+    .p2align 4,,10
+.Lf1_35:
+    .loc 1 131 21
+    movslq -16(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $47, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    subq $40, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 132 21
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_41
+    jmp .Lf1_40
+.Lf1_41:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_42
+    jmp .Lf1_43
+.Lf1_42:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_44
+.Lf1_43:
+    movslq -16(%rbp), %rax
+.Lf1_44:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_40:
+    cmpq $0, %rax
+    jne .Lf1_37
+    jmp .Lf1_38
+.Lf1_37:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_49
+.Lf1_48:
+    movq $20, %rax
+    jmp .Lf1_50
+.Lf1_49:
+    movslq -44(%rbp), %rax
+.Lf1_50:
+    cmpq $0, %rax
+    jne .Lf1_45
+    jmp .Lf1_46
+.Lf1_45:
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_47
+.Lf1_46:
+    cmpl $25, -344(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf1_47:
+    jmp .Lf1_39
+.Lf1_38:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_51
+    jmp .Lf1_52
+.Lf1_51:
+    movslq -20(%rbp), %rax
+    jmp .Lf1_53
+.Lf1_52:
+    movslq -8(%rbp), %rax
+.Lf1_53:
+    push %rax
+    movq $91, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_39:
+    movl %eax, -12(%rbp)
+    .loc 1 133 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_55
+    jmp .Lf1_54
+.Lf1_55:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_54:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_57
+    jmp .Lf1_56
+.Lf1_57:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_56:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_59
+    jmp .Lf1_58
+.Lf1_59:
+    movq $64, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_61
+    jmp .Lf1_60
+.Lf1_61:
+    movq $3, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_60:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_58:
+    movl %eax, -8(%rbp)
+    .loc 1 134 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_34:
+.Lf1_36:
+    .loc 1 130 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_35
+.Lf1_33:
+    addq $0, %rsp
+    .loc 1 137 13
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 138 13
+    movq $46, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_63
+    jmp .Lf1_62
+.Lf1_63:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_62:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 139 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_31:
+    .loc 1 140 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_32
+.Lf1_30:
+    addq $8, %rsp
+    .loc 1 143 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 144 9
+    jmp .Lf1_67
+    .p2align 4,,10
+.Lf1_66:
+    .loc 1 145 13
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_69
+    jmp .Lf1_68
+.Lf1_69:
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_68:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_71
+    jmp .Lf1_70
+.Lf1_71:
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_70:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    imulq $27, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_72
+    jmp .Lf1_73
+.Lf1_72:
+    movq $15, %rax
+    cmpq $0, %rax
+    jne .Lf1_75
+    jmp .Lf1_76
+.Lf1_75:
+    movq $23, %rax
+    jmp .Lf1_77
+.Lf1_76:
+    movslq -16(%rbp), %rax
+.Lf1_77:
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_74:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -60(%rbp)
+    .loc 1 146 13
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_79
+    jmp .Lf1_78
+.Lf1_79:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_78:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 147 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_85
+    .p2align 4,,10
+.Lf1_84:
+    .loc 1 148 17
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_90
+    jmp .Lf1_89
+.Lf1_90:
+    movq $94, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $43, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_89:
+    movl %eax, -12(%rbp)
+    .loc 1 149 17
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 150 17
+    movq $74, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_92
+.Lf1_91:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_93
+.Lf1_92:
+    movslq -340(%rbp), %rax
+.Lf1_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $69, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $82, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_88:
+    .loc 1 147 38
+    incl -344(%rbp)
+    .loc 1 148 17
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_95
+    jmp .Lf1_94
+.Lf1_95:
+    movq $94, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $43, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_94:
+    movl %eax, -12(%rbp)
+    .loc 1 149 17
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 150 17
+    movq $74, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_96
+    jmp .Lf1_97
+.Lf1_96:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_98
+.Lf1_97:
+    movslq -340(%rbp), %rax
+.Lf1_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $69, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $82, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_87:
+    .loc 1 147 38
+    incl -344(%rbp)
+.Lf1_85:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $7, %rax
+    jl .Lf1_84
+.Lf1_86:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_82
+    .loc 1 148 17
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_100
+    jmp .Lf1_99
+.Lf1_100:
+    movq $94, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $43, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_99:
+    movl %eax, -12(%rbp)
+    .loc 1 149 17
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 150 17
+    movq $74, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_101
+    jmp .Lf1_102
+.Lf1_101:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_103
+.Lf1_102:
+    movslq -340(%rbp), %rax
+.Lf1_103:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $69, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $82, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_83:
+    .loc 1 147 38
+    incl -344(%rbp)
+    jmp .Lf1_86
+.Lf1_82:
+    addq $0, %rsp
+    .loc 1 152 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_65:
+.Lf1_67:
+    .loc 1 144 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_66
+.Lf1_64:
+    addq $8, %rsp
+    .loc 1 155 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_109
+    .p2align 4,,10
+.Lf1_108:
+    .loc 1 156 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_111
+.Lf1_110:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_112
+.Lf1_111:
+    movslq -8(%rbp), %rax
+.Lf1_112:
+    push %rax
+    cmpl $6, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 157 9
+    movq $8, %rax
+    push %rax
+    movq $0, %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_115
+    jmp .Lf1_116
+.Lf1_115:
+    movq $48, %rax
+    jmp .Lf1_117
+.Lf1_116:
+    movslq -8(%rbp), %rax
+.Lf1_117:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 159 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 160 13
+    jmp .Lf1_121
+    .p2align 4,,10
+.Lf1_120:
+    .loc 1 161 17
+    movslq -4(%rbp), %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_122
+    jmp .Lf1_118
+.Lf1_122:
+    .loc 1 162 17
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movq $4, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_123
+    jmp .Lf1_124
+.Lf1_123:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_125
+.Lf1_124:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_126
+    jmp .Lf1_127
+.Lf1_126:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_128
+.Lf1_127:
+    movslq -20(%rbp), %rax
+.Lf1_128:
+.Lf1_125:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 163 17
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $12, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_129
+    jmp .Lf1_130
+.Lf1_129:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_133
+.Lf1_132:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf1_134
+.Lf1_133:
+    movq $98, %rax
+.Lf1_134:
+    jmp .Lf1_131
+.Lf1_130:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $34, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_131:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 164 17
+    movslq -76(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $24, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_136
+    jmp .Lf1_135
+.Lf1_136:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_137
+    jmp .Lf1_138
+.Lf1_137:
+    movq $62, %rax
+    jmp .Lf1_139
+.Lf1_138:
+    movslq -12(%rbp), %rax
+.Lf1_139:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_141
+.Lf1_140:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_142
+.Lf1_141:
+    movslq -8(%rbp), %rax
+.Lf1_142:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_135:
+    movl %eax, -52(%rbp)
+    .loc 1 165 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_119:
+.Lf1_121:
+    .loc 1 160 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_120
+.Lf1_118:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_107:
+    .loc 1 155 30
+    incl -340(%rbp)
+.Lf1_109:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_108
+.Lf1_106:
+    addq $8, %rsp
+    .loc 1 170 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 171 9
+    jmp .Lf1_146
+    .p2align 4,,10
+.Lf1_145:
+    .loc 1 172 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_152
+    .p2align 4,,10
+.Lf1_151:
+    .loc 1 173 17
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_154
+.Lf1_153:
+    movslq -20(%rbp), %rax
+    jmp .Lf1_155
+.Lf1_154:
+    movslq -12(%rbp), %rax
+.Lf1_155:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_157
+    jmp .Lf1_156
+.Lf1_157:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_161
+.Lf1_162:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_161:
+    cmpq $0, %rax
+    jne .Lf1_158
+    jmp .Lf1_159
+.Lf1_158:
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_160
+.Lf1_159:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_164
+    jmp .Lf1_163
+.Lf1_164:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_163:
+.Lf1_160:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_156:
+    movl %eax, -4(%rbp)
+    .loc 1 174 17
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_165
+    jmp .Lf1_166
+.Lf1_165:
+    movslq -72(%rbp), %rax
+    addq $71, %rax
+    movslq %eax, %rax
+    jmp .Lf1_167
+.Lf1_166:
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_167:
+    push %rax
+    cmpl $0, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_169
+    jmp .Lf1_168
+.Lf1_169:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_171
+    jmp .Lf1_170
+.Lf1_171:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_170:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_168:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 175 17
+    movq $6, %rax
+    push %rax
+    movq $95, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_172
+    jmp .Lf1_173
+.Lf1_172:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_174
+.Lf1_173:
+    movq $44, %rax
+.Lf1_174:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_176
+    jmp .Lf1_175
+.Lf1_176:
+    cmpl $44, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_177
+    jmp .Lf1_178
+.Lf1_177:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_179
+.Lf1_178:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_179:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_175:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_150:
+    .loc 1 172 38
+    incl -344(%rbp)
+.Lf1_152:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_151
+.Lf1_149:
+    addq $0, %rsp
+    .loc 1 177 13
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_180
+    jmp .Lf1_181
+.Lf1_180:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_184
+    jmp .Lf1_183
+.Lf1_184:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_183:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_182
+.Lf1_181:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_189
+    jmp .Lf1_188
+.Lf1_189:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_188:
+    cmpq $0, %rax
+    jne .Lf1_185
+    jmp .Lf1_186
+.Lf1_185:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_191
+    jmp .Lf1_190
+.Lf1_191:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_190:
+    jmp .Lf1_187
+.Lf1_186:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_192
+    jmp .Lf1_193
+.Lf1_192:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf1_194
+.Lf1_193:
+    movslq -340(%rbp), %rax
+.Lf1_194:
+.Lf1_187:
+.Lf1_182:
+    movl %eax, -4(%rbp)
+    .loc 1 178 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_199
+.Lf1_198:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_200
+.Lf1_199:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf1_200:
+    push %rax
+    cmpl $14, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_195
+    jmp .Lf1_196
+.Lf1_195:
+    movslq -12(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_197
+.Lf1_196:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_201
+    jmp .Lf1_202
+.Lf1_201:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_203
+.Lf1_202:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_204
+    jmp .Lf1_205
+.Lf1_204:
+    movq $40, %rax
+    jmp .Lf1_206
+.Lf1_205:
+    movq $9, %rax
+.Lf1_206:
+.Lf1_203:
+.Lf1_197:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 179 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_144:
+.Lf1_146:
+    .loc 1 171 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_145
+.Lf1_143:
+    addq $8, %rsp
+    .loc 1 183 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 184 9
+    .p2align 4,,10
+.Lf1_209:
+    .loc 1 186 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 187 17
+    jmp .Lf1_213
+    .p2align 4,,10
+.Lf1_212:
+    .loc 1 188 21
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_214
+    jmp .Lf1_210
+.Lf1_214:
+    .loc 1 189 21
+    movslq -340(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_215
+    jmp .Lf1_216
+.Lf1_215:
+    movslq -340(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_218
+    jmp .Lf1_219
+.Lf1_218:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf1_220
+.Lf1_219:
+    movslq -80(%rbp), %rax
+.Lf1_220:
+.Lf1_217:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_222
+    jmp .Lf1_221
+.Lf1_222:
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_221:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 190 21
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 191 21
+    movq $1, %rax
+    push %rax
+    movq $79, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_223
+    jmp .Lf1_224
+.Lf1_223:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_225
+.Lf1_224:
+    movslq -12(%rbp), %rax
+.Lf1_225:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 192 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_211:
+.Lf1_213:
+    .loc 1 187 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_212
+.Lf1_210:
+    addq $0, %rsp
+    .loc 1 195 13
+    movq $5, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_226
+    jmp .Lf1_227
+.Lf1_226:
+    movq $68, %rax
+    jmp .Lf1_228
+.Lf1_227:
+    movslq -16(%rbp), %rax
+.Lf1_228:
+    push %rax
+    movq $90, %rax
+    cmpq $59, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 196 13
+    movq $95, %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_230
+    jmp .Lf1_229
+.Lf1_230:
+    movslq -24(%rbp), %rax
+    addq $6, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_229:
+    movl %eax, -12(%rbp)
+    .loc 1 197 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_208:
+    .loc 1 198 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_209
+.Lf1_207:
+    addq $8, %rsp
+    .loc 1 200 5
+    movq $7, %rax
+    push %rax
+    movq $30, %rax
+    cmpq $33, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf1_232
+    jmp .Lf1_233
+.Lf1_232:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_234
+.Lf1_233:
+    movslq -12(%rbp), %rax
+.Lf1_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_235
+    .loc 1 201 9
+    movq $3, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_237
+    jmp .Lf1_236
+.Lf1_237:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_236:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_239
+    jmp .Lf1_238
+.Lf1_239:
+    movq $77, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_238:
+    movl %eax, -44(%rbp)
+    .loc 1 202 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_241
+    jmp .Lf1_240
+.Lf1_241:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_240:
+    push %rax
+    movq $90, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $84, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $24, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -72(%rbp)
+    .loc 1 203 9
+    movq $87, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_242
+    jmp .Lf1_243
+.Lf1_242:
+    movslq -16(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_246
+    jmp .Lf1_245
+.Lf1_246:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_245:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_244
+.Lf1_243:
+    movq $1, %rax
+    cmpq $23, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -76(%rbp), %rax
+    subq $48, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_244:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_231
+.Lf1_235:
+    .loc 1 205 9
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_248
+    jmp .Lf1_247
+.Lf1_248:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_247:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_250
+    jmp .Lf1_249
+.Lf1_250:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_249:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $4, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 206 9
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_252
+    jmp .Lf1_251
+.Lf1_252:
+    movq $13, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_254
+    jmp .Lf1_253
+.Lf1_254:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_253:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_251:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $16, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 207 9
+    movq $2, %rax
+    push %rax
+    movq $71, %rax
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_256
+.Lf1_255:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_257
+.Lf1_256:
+    movslq -12(%rbp), %rax
+.Lf1_257:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_258
+    jmp .Lf1_259
+.Lf1_258:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_260
+.Lf1_259:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf1_260:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    addq $0, %rsp
+.Lf1_231:
+    .loc 1 209 5
+    cmpl $60, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $98, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $5, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $88, %rax
+    subq $90, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf1_262
+    .loc 1 210 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_266
+    jmp .Lf1_267
+.Lf1_266:
+    movslq -36(%rbp), %rax
+    jmp .Lf1_268
+.Lf1_267:
+    movslq -56(%rbp), %rax
+.Lf1_268:
+    cmpq $0, %rax
+    jne .Lf1_263
+    jmp .Lf1_264
+.Lf1_263:
+    movslq -12(%rbp), %rax
+    subq $12, %rax
+    movslq %eax, %rax
+    jmp .Lf1_265
+.Lf1_264:
+    movq $91, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_265:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_270
+    jmp .Lf1_269
+.Lf1_270:
+    cmpl $52, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $37, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_269:
+    movl %eax, -8(%rbp)
+    .loc 1 211 9
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    addl -56(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_271
+    jmp .Lf1_272
+.Lf1_271:
+    movq $72, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_273
+.Lf1_272:
+    movq $85, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_275
+    jmp .Lf1_274
+.Lf1_275:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_274:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_273:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 212 9
+    movslq -12(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $12, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_276
+    jmp .Lf1_277
+.Lf1_276:
+    movq $7, %rax
+    jmp .Lf1_278
+.Lf1_277:
+    movq $62, %rax
+.Lf1_278:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_280
+    jmp .Lf1_279
+.Lf1_280:
+    movq $53, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_279:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_261
+.Lf1_262:
+    .loc 1 214 9
+    movq $24, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_281
+    jmp .Lf1_282
+.Lf1_281:
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_283
+.Lf1_282:
+    cmpl $5, -16(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf1_283:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_285
+    jmp .Lf1_284
+.Lf1_285:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_287
+    jmp .Lf1_286
+.Lf1_287:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_286:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_288
+    jmp .Lf1_289
+.Lf1_288:
+    movq $23, %rax
+    jmp .Lf1_290
+.Lf1_289:
+    movslq -4(%rbp), %rax
+.Lf1_290:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_284:
+    movl %eax, -28(%rbp)
+    .loc 1 215 9
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_291
+    jmp .Lf1_292
+.Lf1_291:
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_293
+.Lf1_292:
+    movslq -44(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_293:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 216 9
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf1_297
+    jmp .Lf1_298
+.Lf1_297:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_299
+.Lf1_298:
+    movq $77, %rax
+.Lf1_299:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_294
+    jmp .Lf1_295
+.Lf1_294:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_300
+    jmp .Lf1_301
+.Lf1_300:
+    movslq -20(%rbp), %rax
+    jmp .Lf1_302
+.Lf1_301:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf1_302:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_296
+.Lf1_295:
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_304
+    jmp .Lf1_303
+.Lf1_304:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_303:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_296:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_261:
+    .loc 1 219 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 220 9
+    jmp .Lf1_308
+    .p2align 4,,10
+.Lf1_307:
+    .loc 1 222 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 223 17
+    jmp .Lf1_312
+    .p2align 4,,10
+.Lf1_311:
+    .loc 1 224 21
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_317
+    jmp .Lf1_316
+.Lf1_317:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_316:
+    push %rax
+    movq $29, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_313
+    jmp .Lf1_314
+.Lf1_313:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_318
+    jmp .Lf1_319
+.Lf1_318:
+    movq $41, %rax
+    jmp .Lf1_320
+.Lf1_319:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf1_320:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_322
+    jmp .Lf1_321
+.Lf1_322:
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_321:
+    jmp .Lf1_315
+.Lf1_314:
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_315:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 225 21
+    movslq -8(%rbp), %rax
+    addq $20, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_323
+    jmp .Lf1_324
+.Lf1_323:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_326
+    jmp .Lf1_327
+.Lf1_326:
+    movq $35, %rax
+    jmp .Lf1_328
+.Lf1_327:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf1_328:
+    jmp .Lf1_325
+.Lf1_324:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_325:
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 226 21
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_332
+    jmp .Lf1_333
+.Lf1_332:
+    movq $89, %rax
+    jmp .Lf1_334
+.Lf1_333:
+    movslq -68(%rbp), %rax
+.Lf1_334:
+    cmpq $0, %rax
+    jne .Lf1_329
+    jmp .Lf1_330
+.Lf1_329:
+    movq $4, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_331
+.Lf1_330:
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_331:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 227 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_310:
+.Lf1_312:
+    .loc 1 223 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_311
+.Lf1_309:
+    addq $0, %rsp
+    .loc 1 230 13
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $85, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 231 13
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_335
+    jmp .Lf1_336
+.Lf1_335:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_337
+.Lf1_336:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_337:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_339
+    jmp .Lf1_338
+.Lf1_339:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_341
+    jmp .Lf1_340
+.Lf1_341:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_340:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_338:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_342
+    jmp .Lf1_343
+.Lf1_342:
+    movq $22, %rax
+    jmp .Lf1_344
+.Lf1_343:
+    movslq -340(%rbp), %rax
+.Lf1_344:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_346
+    jmp .Lf1_345
+.Lf1_346:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_345:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 232 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_306:
+.Lf1_308:
+    .loc 1 220 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_307
+.Lf1_305:
+    addq $8, %rsp
+    .loc 1 236 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 237 9
+    .p2align 4,,10
+.Lf1_349:
+    .loc 1 238 13
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_350
+    jmp .Lf1_347
+.Lf1_350:
+    .loc 1 239 13
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_354
+    jmp .Lf1_355
+.Lf1_354:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_356
+.Lf1_355:
+    movslq -4(%rbp), %rax
+.Lf1_356:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_351
+    jmp .Lf1_352
+.Lf1_351:
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_353
+.Lf1_352:
+    movslq -76(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_358
+    jmp .Lf1_357
+.Lf1_358:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_357:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_353:
+    movl %eax, -48(%rbp)
+    .loc 1 241 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 242 17
+    jmp .Lf1_362
+    .p2align 4,,10
+.Lf1_361:
+    .loc 1 243 21
+    movq $6, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_363
+    jmp .Lf1_364
+.Lf1_363:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_365
+.Lf1_364:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf1_365:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_367
+    jmp .Lf1_366
+.Lf1_367:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_369
+    jmp .Lf1_368
+.Lf1_369:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_368:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_366:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 244 21
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_371
+    jmp .Lf1_370
+.Lf1_371:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_373
+    jmp .Lf1_372
+.Lf1_373:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_372:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_370:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    addq $60, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -64(%rbp)
+    .loc 1 245 21
+    movq $79, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_374
+    jmp .Lf1_375
+.Lf1_374:
+    movslq -72(%rbp), %rax
+    jmp .Lf1_376
+.Lf1_375:
+    movslq -340(%rbp), %rax
+.Lf1_376:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $34, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $54, %rax
+    imull -52(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 246 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_360:
+.Lf1_362:
+    .loc 1 242 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_361
+.Lf1_359:
+    addq $0, %rsp
+    .loc 1 249 13
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_378
+    jmp .Lf1_377
+.Lf1_378:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_377:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_380
+    jmp .Lf1_379
+.Lf1_380:
+    cmpl $30, -36(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_379:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $42, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 250 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_348:
+    .loc 1 251 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_349
+.Lf1_347:
+    addq $8, %rsp
+    .loc 1 253 5
+    movslq -8(%rbp), %rax
+    subq $33, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_381
+    jmp .Lf1_382
+.Lf1_381:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_383
+.Lf1_382:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_383:
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_384
+    jmp .Lf1_385
+.Lf1_384:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_386
+.Lf1_385:
+    movq $74, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_386:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 255 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 256 5
+    subq $8, %rsp
+    movq $40, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 257 5
+    movq $70, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 258 5
+    subq $8, %rsp
+    movq $70, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 259 5
+    movq $10, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 260 5
+    subq $64, %rsp
+    .loc 1 261 5
+    subq $256, %rsp
+    .loc 1 262 5
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -56(%rbp)
+    .loc 1 263 5
+    movq $4, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_2
+    jmp .Lf2_1
+.Lf2_2:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_1:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 265 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 266 9
+    .p2align 4,,10
+.Lf2_5:
+    .loc 1 267 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_8
+    jmp .Lf2_7
+.Lf2_8:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_7:
+    cmpq $93, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_6
+    jmp .Lf2_3
+.Lf2_6:
+    .loc 1 268 13
+    movslq -340(%rbp), %rax
+    imulq $24, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_9
+    jmp .Lf2_10
+.Lf2_9:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_11
+.Lf2_10:
+    cmpl $39, -36(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf2_11:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_13
+    jmp .Lf2_12
+.Lf2_13:
+    movq $82, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_12:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 269 13
+    movq $4, %rax
+    push %rax
+    cmpl $59, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_15
+    jmp .Lf2_14
+.Lf2_15:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_17
+    jmp .Lf2_16
+.Lf2_17:
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_16:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_14:
+    movl %eax, -12(%rbp)
+    .loc 1 270 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_23
+    .p2align 4,,10
+.Lf2_22:
+    .loc 1 271 17
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf2_25
+    jmp .Lf2_26
+.Lf2_25:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_27
+.Lf2_26:
+    movslq -56(%rbp), %rax
+.Lf2_27:
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_24
+    jmp .Lf2_20
+.Lf2_24:
+    .loc 1 272 17
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    imulq $34, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $87, %rax
+    cmpq $32, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 273 17
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_29
+    jmp .Lf2_28
+.Lf2_29:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_28:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_31
+    jmp .Lf2_30
+.Lf2_31:
+    movq $6, %rax
+    push %rax
+    movq $17, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_30:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_33
+    jmp .Lf2_32
+.Lf2_33:
+    movq $96, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_32:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 274 17
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    addq $39, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_38
+    jmp .Lf2_37
+.Lf2_38:
+    cmpl $69, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_37:
+    cmpq $0, %rax
+    jne .Lf2_34
+    jmp .Lf2_35
+.Lf2_34:
+    movq $6, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_40
+    jmp .Lf2_39
+.Lf2_40:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_39:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_36
+.Lf2_35:
+    movq $43, %rax
+    cmpq $0, %rax
+    jne .Lf2_41
+    jmp .Lf2_42
+.Lf2_41:
+    movq $94, %rax
+    jmp .Lf2_43
+.Lf2_42:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf2_43:
+    push %rax
+    movq $13, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf2_36:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_21:
+    .loc 1 270 38
+    incl -344(%rbp)
+.Lf2_23:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_22
+.Lf2_20:
+    addq $0, %rsp
+    .loc 1 276 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_4:
+    .loc 1 277 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_5
+.Lf2_3:
+    addq $8, %rsp
+    .loc 1 279 5
+    movq $17, %rax
+    addq $56, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_44
+    jmp .Lf2_45
+.Lf2_44:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_46
+.Lf2_45:
+    movslq -4(%rbp), %rax
+.Lf2_46:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 280 5
+    movq $4, %rax
+    push %rax
+    movq $5, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_47
+    jmp .Lf2_48
+.Lf2_47:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_49
+.Lf2_48:
+    movslq -72(%rbp), %rax
+.Lf2_49:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -72(%rbp)
+    .loc 1 281 5
+    movq $32, %rax
+    subq $22, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $95, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lf2_51
+    .loc 1 282 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_53
+    jmp .Lf2_52
+.Lf2_53:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_52:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_55
+    jmp .Lf2_54
+.Lf2_55:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_54:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_57
+    jmp .Lf2_56
+.Lf2_57:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_59
+    jmp .Lf2_58
+.Lf2_59:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_58:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_56:
+    movl %eax, -52(%rbp)
+    .loc 1 283 9
+    movq $7, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_61
+    jmp .Lf2_60
+.Lf2_61:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_60:
+    movl %eax, -8(%rbp)
+    .loc 1 284 9
+    movq $2, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_50
+.Lf2_51:
+    .loc 1 286 9
+    movslq -48(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_63
+    jmp .Lf2_62
+.Lf2_63:
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_62:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_65
+    jmp .Lf2_64
+.Lf2_65:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_64:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 287 9
+    movslq -16(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_67
+    jmp .Lf2_66
+.Lf2_67:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_66:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movq $58, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_68
+    jmp .Lf2_69
+.Lf2_68:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf2_70
+.Lf2_69:
+    movslq -68(%rbp), %rax
+.Lf2_70:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 288 9
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_72
+    jmp .Lf2_71
+.Lf2_72:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_71:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_73
+    jmp .Lf2_74
+.Lf2_73:
+    movq $95, %rax
+    jmp .Lf2_75
+.Lf2_74:
+    movq $0, %rax
+.Lf2_75:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -56(%rbp)
+    addq $0, %rsp
+.Lf2_50:
+    .loc 1 291 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 292 9
+    jmp .Lf2_79
+    .p2align 4,,10
+.Lf2_78:
+    .loc 1 293 13
+    movq $8, %rax
+    cmpq $93, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_80
+    jmp .Lf2_81
+.Lf2_80:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_82
+.Lf2_81:
+    movq $1, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_82:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_84
+    jmp .Lf2_83
+.Lf2_84:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_83:
+    push %rax
+    movq $5, %rax
+    cmpq $0, %rax
+    jne .Lf2_85
+    jmp .Lf2_86
+.Lf2_85:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_87
+.Lf2_86:
+    movslq -16(%rbp), %rax
+.Lf2_87:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 295 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 296 17
+    jmp .Lf2_91
+    .p2align 4,,10
+.Lf2_90:
+    .loc 1 297 21
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_92
+    jmp .Lf2_93
+.Lf2_92:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_94
+.Lf2_93:
+    movslq -24(%rbp), %rax
+.Lf2_94:
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf2_95
+    jmp .Lf2_96
+.Lf2_95:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_97
+.Lf2_96:
+    movslq -28(%rbp), %rax
+.Lf2_97:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 298 21
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 299 21
+    movslq -40(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $35, -80(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -36(%rbp), %rax
+    addq $68, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_99
+    jmp .Lf2_98
+.Lf2_99:
+    movq $51, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_98:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    .loc 1 300 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_89:
+.Lf2_91:
+    .loc 1 296 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_90
+.Lf2_88:
+    addq $0, %rsp
+    .loc 1 303 13
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_101
+    jmp .Lf2_100
+.Lf2_101:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_100:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -28(%rbp)
+    .loc 1 304 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_77:
+.Lf2_79:
+    .loc 1 292 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_78
+.Lf2_76:
+    addq $8, %rsp
+    .loc 1 307 5
+    movq $58, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_102
+    jmp .Lf2_103
+.Lf2_102:
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_105
+    jmp .Lf2_106
+.Lf2_105:
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_107
+.Lf2_106:
+    movq $12, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_107:
+    jmp .Lf2_104
+.Lf2_103:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_108
+    jmp .Lf2_109
+.Lf2_108:
+    movslq -56(%rbp), %rax
+    jmp .Lf2_110
+.Lf2_109:
+    movslq -4(%rbp), %rax
+.Lf2_110:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_104:
+    movl %eax, -8(%rbp)
+    .loc 1 308 5
+    movq $1, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_113
+    jmp .Lf2_112
+.Lf2_113:
+    cmpl $85, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_112:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_115
+    jmp .Lf2_114
+.Lf2_115:
+    movq $8, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_114:
+    cmpq $0, %rax
+    je .Lf2_116
+    .loc 1 309 9
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_118
+    jmp .Lf2_117
+.Lf2_118:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_117:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 310 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_119
+    jmp .Lf2_120
+.Lf2_119:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_123
+    jmp .Lf2_122
+.Lf2_123:
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_122:
+    jmp .Lf2_121
+.Lf2_120:
+    movq $41, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf2_121:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_124
+    jmp .Lf2_125
+.Lf2_124:
+    movq $60, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_126
+.Lf2_125:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $27, %rax
+    movslq %eax, %rax
+.Lf2_126:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 311 9
+    cmpl $15, -80(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_127
+.Lf2_128:
+    movslq -16(%rbp), %rax
+    subl -64(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_127:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_111
+.Lf2_116:
+    .loc 1 313 9
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_129
+    jmp .Lf2_130
+.Lf2_129:
+    movq $64, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_131
+.Lf2_130:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_133
+    jmp .Lf2_132
+.Lf2_133:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_132:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_135
+    jmp .Lf2_134
+.Lf2_135:
+    movq $66, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_134:
+.Lf2_131:
+    movl %eax, -48(%rbp)
+    .loc 1 314 9
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_137
+    jmp .Lf2_136
+.Lf2_137:
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_136:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_142
+    jmp .Lf2_141
+.Lf2_142:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_141:
+    cmpq $0, %rax
+    jne .Lf2_138
+    jmp .Lf2_139
+.Lf2_138:
+    movq $55, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_140
+.Lf2_139:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_143
+    jmp .Lf2_144
+.Lf2_143:
+    movq $63, %rax
+    jmp .Lf2_145
+.Lf2_144:
+    movslq -8(%rbp), %rax
+.Lf2_145:
+.Lf2_140:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 315 9
+    cmpl $7, -68(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_146
+    jmp .Lf2_147
+.Lf2_146:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_148
+.Lf2_147:
+    movslq -4(%rbp), %rax
+.Lf2_148:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_149
+    jmp .Lf2_150
+.Lf2_149:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_151
+.Lf2_150:
+    movq $52, %rax
+.Lf2_151:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_111:
+    .loc 1 317 5
+    movq $54, %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_153
+    jmp .Lf2_154
+.Lf2_153:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_155
+.Lf2_154:
+    movslq -60(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_155:
+    push %rax
+    cmpl $57, -52(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $55, %rax
+    cmpq $0, %rax
+    jne .Lf2_156
+    jmp .Lf2_157
+.Lf2_156:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf2_158
+.Lf2_157:
+    movslq -4(%rbp), %rax
+.Lf2_158:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_159
+    .loc 1 318 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_161
+    jmp .Lf2_160
+.Lf2_161:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_160:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 319 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_165
+    jmp .Lf2_166
+.Lf2_165:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_167
+.Lf2_166:
+    movq $44, %rax
+.Lf2_167:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_168
+    jmp .Lf2_169
+.Lf2_168:
+    movslq -44(%rbp), %rax
+    jmp .Lf2_170
+.Lf2_169:
+    movslq -4(%rbp), %rax
+.Lf2_170:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_162
+    jmp .Lf2_163
+.Lf2_162:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_164
+.Lf2_163:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_171
+    jmp .Lf2_172
+.Lf2_171:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_173
+.Lf2_172:
+    movslq -12(%rbp), %rax
+.Lf2_173:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_164:
+    movl %eax, -4(%rbp)
+    .loc 1 320 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_175
+    jmp .Lf2_174
+.Lf2_175:
+    movq $27, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_174:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    imulq $80, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $65, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_177
+    jmp .Lf2_176
+.Lf2_177:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_178
+    jmp .Lf2_179
+.Lf2_178:
+    movq $49, %rax
+    jmp .Lf2_180
+.Lf2_179:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf2_180:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_176:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_152
+.Lf2_159:
+    .loc 1 322 9
+    movq $47, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $36, %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_181
+    jmp .Lf2_182
+.Lf2_181:
+    cmpl $31, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_185
+    jmp .Lf2_184
+.Lf2_185:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_184:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_183
+.Lf2_182:
+    movq $44, %rax
+    cmpq $65, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $93, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_183:
+    movl %eax, -16(%rbp)
+    .loc 1 323 9
+    movslq -12(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $67, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_187
+    jmp .Lf2_186
+.Lf2_187:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_186:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 324 9
+    movq $94, %rax
+    cmpq $50, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $23, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_188
+    jmp .Lf2_189
+.Lf2_188:
+    movq $7, %rax
+    push %rax
+    cmpl $47, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_190
+.Lf2_189:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_191
+    jmp .Lf2_192
+.Lf2_191:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_194
+    jmp .Lf2_195
+.Lf2_194:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_196
+.Lf2_195:
+    movslq -4(%rbp), %rax
+.Lf2_196:
+    jmp .Lf2_193
+.Lf2_192:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_193:
+.Lf2_190:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_152:
+    .loc 1 326 5
+    movq $6, %rax
+    push %rax
+    movq $85, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_197
+    jmp .Lf2_198
+.Lf2_197:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_199
+.Lf2_198:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf2_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_201
+    jmp .Lf2_200
+.Lf2_201:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_200:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_203
+    jmp .Lf2_202
+.Lf2_203:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_202:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 328 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 329 5
+    subq $8, %rsp
+    movq $71, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 330 5
+    movq $50, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 331 5
+    subq $8, %rsp
+    movq $46, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 332 5
+    movq $49, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 333 5
+    subq $64, %rsp
+    .loc 1 334 5
+    subq $256, %rsp
+    .loc 1 335 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_6
+    .p2align 4,,10
+.Lf3_5:
+    .loc 1 336 9
+    cmpl $89, -72(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $80, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_7
+    jmp .Lf3_3
+.Lf3_7:
+    .loc 1 338 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 339 13
+    .p2align 4,,10
+.Lf3_10:
+    .loc 1 340 17
+    movslq -16(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $63, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_11
+    jmp .Lf3_8
+.Lf3_11:
+    .loc 1 341 17
+    movq $2, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $11, %rax
+    subq $45, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 342 17
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_12
+    jmp .Lf3_13
+.Lf3_12:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf3_14
+.Lf3_13:
+    movslq -344(%rbp), %rax
+.Lf3_14:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_16
+    jmp .Lf3_15
+.Lf3_16:
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $38, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_15:
+    movl %eax, -60(%rbp)
+    .loc 1 343 17
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_18
+    jmp .Lf3_17
+.Lf3_18:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_17:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_20
+    jmp .Lf3_19
+.Lf3_20:
+    movslq -8(%rbp), %rax
+    imull -80(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_19:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 344 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_9:
+    .loc 1 345 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_10
+.Lf3_8:
+    addq $0, %rsp
+    .loc 1 347 9
+    movq $85, %rax
+    cmpq $0, %rax
+    jne .Lf3_21
+    jmp .Lf3_22
+.Lf3_21:
+    movq $66, %rax
+    jmp .Lf3_23
+.Lf3_22:
+    movq $9, %rax
+.Lf3_23:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_25
+    jmp .Lf3_24
+.Lf3_25:
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_24:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $24, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 348 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_27
+    jmp .Lf3_26
+.Lf3_27:
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_26:
+    push %rax
+    movq $16, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_29
+    jmp .Lf3_28
+.Lf3_29:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_28:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -28(%rbp)
+    addq $0, %rsp
+.Lf3_4:
+    .loc 1 335 30
+    incl -340(%rbp)
+.Lf3_6:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_5
+.Lf3_3:
+    addq $8, %rsp
+    .loc 1 351 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 352 9
+    .p2align 4,,10
+.Lf3_32:
+    .loc 1 354 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 355 17
+    .p2align 4,,10
+.Lf3_35:
+    .loc 1 356 21
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 357 21
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_37
+    jmp .Lf3_36
+.Lf3_37:
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_36:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 358 21
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_39
+    jmp .Lf3_38
+.Lf3_39:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_38:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_41
+    jmp .Lf3_40
+.Lf3_41:
+    movslq -4(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_40:
+    movl %eax, -4(%rbp)
+    .loc 1 359 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_34:
+    .loc 1 360 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_35
+.Lf3_33:
+    addq $0, %rsp
+    .loc 1 362 13
+    movslq -24(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_43
+    jmp .Lf3_42
+.Lf3_43:
+    movslq -56(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_42:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 363 13
+    movslq -340(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $13, %rax
+    cmpq $0, %rax
+    jne .Lf3_44
+    jmp .Lf3_45
+.Lf3_44:
+    movq $30, %rax
+    jmp .Lf3_46
+.Lf3_45:
+    movq $68, %rax
+.Lf3_46:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_48
+    jmp .Lf3_47
+.Lf3_48:
+    movq $45, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $8, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_47:
+    movl %eax, -4(%rbp)
+    .loc 1 364 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_31:
+    .loc 1 365 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_32
+.Lf3_30:
+    addq $8, %rsp
+    .loc 1 367 5
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_50
+    jmp .Lf3_51
+.Lf3_50:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_52
+.Lf3_51:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf3_52:
+    cmpq $0, %rax
+    je .Lf3_53
+    .loc 1 368 9
+    movslq -48(%rbp), %rax
+    subq $82, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_55
+    jmp .Lf3_54
+.Lf3_55:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_54:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 369 9
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_56
+    jmp .Lf3_57
+.Lf3_56:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $24, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_58
+.Lf3_57:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf3_58:
+    movl %eax, -28(%rbp)
+    .loc 1 370 9
+    movq $54, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_60
+    jmp .Lf3_59
+.Lf3_60:
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf3_61
+    jmp .Lf3_62
+.Lf3_61:
+    movq $22, %rax
+    jmp .Lf3_63
+.Lf3_62:
+    movq $12, %rax
+.Lf3_63:
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_59:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_49
+.Lf3_53:
+    .loc 1 372 9
+    movslq -4(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_68
+    jmp .Lf3_67
+.Lf3_68:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_69
+    jmp .Lf3_70
+.Lf3_69:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_71
+.Lf3_70:
+    movslq -16(%rbp), %rax
+.Lf3_71:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_67:
+    cmpq $0, %rax
+    jne .Lf3_64
+    jmp .Lf3_65
+.Lf3_64:
+    movq $2, %rax
+    push %rax
+    movq $55, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_66
+.Lf3_65:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_76
+    jmp .Lf3_75
+.Lf3_76:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_75:
+    cmpq $0, %rax
+    jne .Lf3_72
+    jmp .Lf3_73
+.Lf3_72:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $39, %rax
+    movslq %eax, %rax
+    jmp .Lf3_74
+.Lf3_73:
+    movslq -60(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf3_74:
+.Lf3_66:
+    movl %eax, -8(%rbp)
+    .loc 1 373 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_77
+    jmp .Lf3_78
+.Lf3_77:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_79
+.Lf3_78:
+    movslq -4(%rbp), %rax
+.Lf3_79:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_81
+    jmp .Lf3_80
+.Lf3_81:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_80:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_82
+    jmp .Lf3_83
+.Lf3_82:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_84
+.Lf3_83:
+    movq $40, %rax
+.Lf3_84:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 374 9
+    movq $1, %rax
+    push %rax
+    movq $71, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf3_49:
+    .loc 1 376 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_85
+    jmp .Lf3_86
+.Lf3_85:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_87
+.Lf3_86:
+    movslq -48(%rbp), %rax
+.Lf3_87:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_89
+    jmp .Lf3_88
+.Lf3_89:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_88:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_91
+    jmp .Lf3_90
+.Lf3_91:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_90:
+    movl %eax, -12(%rbp)
+    .loc 1 377 5
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    imulq $64, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_92
+    jmp .Lf3_93
+.Lf3_92:
+    movslq -4(%rbp), %rax
+    imulq $61, %rax
+    movslq %eax, %rax
+    jmp .Lf3_94
+.Lf3_93:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf3_94:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_96
+    jmp .Lf3_95
+.Lf3_96:
+    movslq -32(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_95:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 379 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 380 9
+    .p2align 4,,10
+.Lf3_99:
+    .loc 1 381 13
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_100
+    jmp .Lf3_97
+.Lf3_100:
+    .loc 1 382 13
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_102
+    jmp .Lf3_101
+.Lf3_102:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_101:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 384 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 385 17
+    .p2align 4,,10
+.Lf3_105:
+    .loc 1 386 21
+    movslq -4(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_107
+    jmp .Lf3_106
+.Lf3_107:
+    movq $72, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_106:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $42, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_109
+    jmp .Lf3_108
+.Lf3_109:
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_108:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -60(%rbp)
+    .loc 1 387 21
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_111
+    jmp .Lf3_110
+.Lf3_111:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_110:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 388 21
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_112
+    jmp .Lf3_113
+.Lf3_112:
+    movq $27, %rax
+    jmp .Lf3_114
+.Lf3_113:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf3_114:
+    push %rax
+    movq $40, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_116
+    jmp .Lf3_115
+.Lf3_116:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_115:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 389 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_104:
+    .loc 1 390 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_105
+.Lf3_103:
+    addq $0, %rsp
+    .loc 1 392 13
+    movslq -16(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $76, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_118
+    jmp .Lf3_117
+.Lf3_118:
+    movq $74, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_117:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 393 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_98:
+    .loc 1 394 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_99
+.Lf3_97:
+    addq $8, %rsp
+    .loc 1 396 5
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_120
+    jmp .Lf3_121
+.Lf3_120:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_122
+.Lf3_121:
+    movslq -12(%rbp), %rax
+.Lf3_122:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_124
+    jmp .Lf3_123
+.Lf3_124:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_126
+    jmp .Lf3_125
+.Lf3_126:
+    movq $13, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_125:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_123:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_127
+    .loc 1 397 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $2, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_128
+    jmp .Lf3_129
+.Lf3_128:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_131
+    jmp .Lf3_132
+.Lf3_131:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_133
+.Lf3_132:
+    movq $58, %rax
+.Lf3_133:
+    jmp .Lf3_130
+.Lf3_129:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_135
+    jmp .Lf3_134
+.Lf3_135:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_134:
+.Lf3_130:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 398 9
+    movq $2, %rax
+    push %rax
+    movq $78, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf3_136
+    jmp .Lf3_137
+.Lf3_136:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_139
+    jmp .Lf3_140
+.Lf3_139:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf3_141
+.Lf3_140:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf3_141:
+    jmp .Lf3_138
+.Lf3_137:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf3_138:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 399 9
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_142
+    jmp .Lf3_143
+.Lf3_142:
+    cmpl $99, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_144
+.Lf3_143:
+    movq $85, %rax
+    cmpq $0, %rax
+    jne .Lf3_145
+    jmp .Lf3_146
+.Lf3_145:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_147
+.Lf3_146:
+    movslq -8(%rbp), %rax
+.Lf3_147:
+.Lf3_144:
+    push %rax
+    movq $56, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf3_119
+.Lf3_127:
+    .loc 1 401 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_149
+    jmp .Lf3_148
+.Lf3_149:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_148:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_151
+    jmp .Lf3_150
+.Lf3_151:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_150:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_153
+    jmp .Lf3_152
+.Lf3_153:
+    movq $2, %rax
+    imulq $55, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_152:
+    movl %eax, -16(%rbp)
+    .loc 1 402 9
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_155
+    jmp .Lf3_154
+.Lf3_155:
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf3_156
+    jmp .Lf3_157
+.Lf3_156:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf3_158
+.Lf3_157:
+    movq $62, %rax
+.Lf3_158:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_154:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 403 9
+    movq $13, %rax
+    cmpq $35, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    imulq $71, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_162
+    jmp .Lf3_163
+.Lf3_162:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_164
+.Lf3_163:
+    movslq -4(%rbp), %rax
+.Lf3_164:
+    cmpq $0, %rax
+    jne .Lf3_159
+    jmp .Lf3_160
+.Lf3_159:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_166
+    jmp .Lf3_165
+.Lf3_166:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_165:
+    jmp .Lf3_161
+.Lf3_160:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf3_161:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_119:
+    .loc 1 405 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_168
+    jmp .Lf3_169
+.Lf3_168:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_170
+.Lf3_169:
+    movslq -60(%rbp), %rax
+.Lf3_170:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $59, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $69, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_171
+    .loc 1 406 9
+    movq $99, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_172
+    jmp .Lf3_173
+.Lf3_172:
+    cmpl $59, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_174
+.Lf3_173:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf3_174:
+    push %rax
+    movq $56, %rax
+    cmpq $0, %rax
+    jne .Lf3_175
+    jmp .Lf3_176
+.Lf3_175:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf3_177
+.Lf3_176:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf3_177:
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 407 9
+    movslq -4(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_179
+    jmp .Lf3_178
+.Lf3_179:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_178:
+    movl %eax, -12(%rbp)
+    .loc 1 408 9
+    movq $32, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_180
+    jmp .Lf3_181
+.Lf3_180:
+    movq $48, %rax
+    jmp .Lf3_182
+.Lf3_181:
+    movq $13, %rax
+.Lf3_182:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_183
+    jmp .Lf3_184
+.Lf3_183:
+    cmpl $6, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_185
+.Lf3_184:
+    movq $42, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_185:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_167
+.Lf3_171:
+    .loc 1 410 9
+    movq $5, %rax
+    push %rax
+    movq $80, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_187
+    jmp .Lf3_186
+.Lf3_187:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_189
+    jmp .Lf3_188
+.Lf3_189:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_188:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $68, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_186:
+    movl %eax, -16(%rbp)
+    .loc 1 411 9
+    movslq -20(%rbp), %rax
+    subq $62, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $89, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -24(%rbp)
+    .loc 1 412 9
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_190
+    jmp .Lf3_191
+.Lf3_190:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_192
+.Lf3_191:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf3_192:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf3_167:
+    .loc 1 414 5
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_194
+    jmp .Lf3_193
+.Lf3_194:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_193:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_195
+    jmp .Lf3_196
+.Lf3_195:
+    movq $81, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_197
+.Lf3_196:
+    movslq -8(%rbp), %rax
+    imulq $48, %rax
+    movslq %eax, %rax
+.Lf3_197:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 415 5
+    movq $27, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_199
+    jmp .Lf3_200
+.Lf3_199:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_201
+.Lf3_200:
+    movslq -16(%rbp), %rax
+.Lf3_201:
+    push %rax
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf3_202
+    jmp .Lf3_203
+.Lf3_202:
+    movq $66, %rax
+    jmp .Lf3_204
+.Lf3_203:
+    movslq -16(%rbp), %rax
+.Lf3_204:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf3_205
+    .loc 1 416 9
+    movq $32, %rax
+    subq $26, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_206
+    jmp .Lf3_207
+.Lf3_206:
+    movq $57, %rax
+    jmp .Lf3_208
+.Lf3_207:
+    movslq -8(%rbp), %rax
+.Lf3_208:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_209
+    jmp .Lf3_210
+.Lf3_209:
+    movq $79, %rax
+    jmp .Lf3_211
+.Lf3_210:
+    movq $46, %rax
+.Lf3_211:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_213
+    jmp .Lf3_212
+.Lf3_213:
+    movq $9, %rax
+    push %rax
+    movq $50, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_212:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 417 9
+    movslq -76(%rbp), %rax
+    imulq $77, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_214
+    jmp .Lf3_215
+.Lf3_214:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_217
+    jmp .Lf3_218
+.Lf3_217:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_219
+.Lf3_218:
+    movslq -44(%rbp), %rax
+.Lf3_219:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_216
+.Lf3_215:
+    movslq -20(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_220
+    jmp .Lf3_221
+.Lf3_220:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_222
+.Lf3_221:
+    movq $94, %rax
+    imulq $39, %rax
+    movslq %eax, %rax
+.Lf3_222:
+.Lf3_216:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 418 9
+    movq $65, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $16, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_198
+.Lf3_205:
+    .loc 1 420 9
+    movq $4, %rax
+    push %rax
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf3_223
+    jmp .Lf3_224
+.Lf3_223:
+    movslq -36(%rbp), %rax
+    jmp .Lf3_225
+.Lf3_224:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf3_225:
+    push %rax
+    movq $38, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 421 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_229
+    jmp .Lf3_230
+.Lf3_229:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_231
+.Lf3_230:
+    movslq -8(%rbp), %rax
+.Lf3_231:
+    cmpq $0, %rax
+    jne .Lf3_226
+    jmp .Lf3_227
+.Lf3_226:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_228
+.Lf3_227:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf3_228:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $40, %rax
+    addq $15, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 422 9
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_233
+    jmp .Lf3_232
+.Lf3_233:
+    movq $27, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_232:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_235
+    jmp .Lf3_234
+.Lf3_235:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_234:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_236
+    jmp .Lf3_237
+.Lf3_236:
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_238
+.Lf3_237:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_238:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_198:
+    .loc 1 424 5
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_240
+    jmp .Lf3_239
+.Lf3_240:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_245
+    jmp .Lf3_244
+.Lf3_245:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_244:
+    cmpq $0, %rax
+    jne .Lf3_241
+    jmp .Lf3_242
+.Lf3_241:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_243
+.Lf3_242:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf3_243:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_239:
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
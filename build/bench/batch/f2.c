@@ -0,0 +1,305 @@
+int f0() {
+    int v0 = 86;
+    int v1 = 48;
+    int v2 = 37;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v1 = (((a0[5] / 7) + (29 % 2)) != ((i0 + v1) || (v2 * 62)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            if ((i0 || a1[3][0]) > 95) break;
+            v3 = (((a1[2][4] != v0) && (16 ? v1 : a0[4])) > ((i1 && a1[1][7]) || (0 * v2)));
+            a0[1] = (((a1[1][2] ? v0 : 34) ? (44 < v3) : (i0 > 48)) ? ((a0[0] <= a1[3][12]) ? (i1 < a0[8]) : (99 && v0)) : ((v2 != 6) ? (a0[0] + a0[1]) : (v1 * 75)));
+            v0 = (((v0 <= a0[12]) >= (a1[3][0] > 48)) > ((v0 < 72) != (i0 >= v0)));
+        }
+        v0 = (((a0[1] / 9) && (31 / 1)) - ((v2 ? 76 : 18) == (52 <= v3)));
+    }
+    a0[12] = (((v1 || 11) ? (v2 && 5) : (57 + v3)) != ((a1[0][8] / 7) * (v0 == v3)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v3 = (((29 < v1) && (v1 * a0[8])) * ((a0[5] % 9) >= (v3 - i2)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v2 = (((33 > a1[0][2]) < (a0[8] && 1)) >= ((27 != a0[14]) ? (i2 ? i3 : 6) : (v2 / 5)));
+            a0[13] = (((a0[4] || i3) && (v2 == i3)) + ((v3 == v0) != (65 && v3)));
+            a1[2][14] = (((15 / 2) <= (a1[1][1] <= a0[11])) - ((v0 - v1) ? (a1[2][14] % 6) : (i3 - i3)));
+        }
+        v0 = (((v0 * v3) >= (a1[2][2] && a0[12])) ? ((v0 > a0[4]) == (a1[1][10] || v0)) : ((a0[15] < 20) + (v0 * i2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v3 = (((i4 - v1) + (v0 != v0)) / 4);
+                v3 = (((31 ? v0 : a0[15]) ? (a1[1][0] >= v0) : (v0 * v2)) == ((36 ? v0 : a0[8]) % 7));
+                a1[2][14] = (((i4 / 3) % 6) > ((i4 - v3) % 3));
+            }
+            v1 = (((v2 ? a0[8] : a1[0][12]) % 7) / 4);
+            v1 = (((10 >= v2) / 8) ? ((76 == a1[2][14]) * (v3 + 32)) : ((67 * v0) + (a1[3][13] - 42)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    v2 = (((v0 ? v0 : 18) && (76 != v0)) != ((v3 != 32) == (93 == v2)));
+    if ((((v2 + v1) ? (a1[3][13] >= 51) : (29 > a0[5])) / 5)) {
+        v1 = (((73 ? v0 : 31) + (v0 + v2)) ? ((v0 ? a0[12] : v2) ? (55 / 2) : (v0 + a1[2][4])) : ((a0[7] && a1[0][13]) - (v2 <= a1[2][15])));
+        v0 = (((v3 + 20) % 6) % 7);
+        v2 = (((54 && v2) ? (a1[0][10] != 23) : (a1[2][13] <= v3)) <= ((v3 - a1[2][0]) <= (v0 / 6)));
+    } else {
+        v1 = (((73 || 32) ? (60 >= v2) : (a0[1] - 42)) < ((a1[0][13] != v2) != (v2 <= v1)));
+        a1[1][2] = (((v3 > 39) ? (v3 - v1) : (57 != v2)) < ((a1[3][8] ? v1 : a1[1][14]) + (a0[4] * 34)));
+        v1 = (((a0[12] != v2) * (a1[1][3] ? v1 : v2)) - ((a1[2][9] / 6) <= (v0 >= v3)));
+    }
+    v0 = (((v0 == v3) - (v0 ? a0[15] : 69)) * ((a1[1][10] - v1) < (v3 || a0[5])));
+    v1 = (((v0 - v0) - (v0 * v0)) * ((40 || v3) && (78 != a0[15])));
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                a0[12] = (((a0[1] != i6) * (77 * a0[6])) % 9);
+                v3 = (((v0 || 7) / 8) != ((a1[2][11] >= a0[4]) != (v2 > i7)));
+                v2 = (((i7 / 2) * (i6 < a1[0][14])) == ((v2 * a0[2]) / 2));
+                i7 = i7 + 1;
+            }
+        }
+        a0[10] = (((i6 <= v0) ? (v3 == v1) : (a0[5] * v3)) + ((v0 * a1[2][0]) || (89 && 50)));
+        v0 = (((v0 && 65) > (a0[4] ? a0[9] : 19)) - ((20 / 9) % 9));
+    }
+    if ((((29 ? v3 : v0) / 2) != ((v1 / 5) <= (a0[9] + 81)))) {
+        a1[2][2] = (((v2 && a0[12]) * (a1[2][14] || 30)) * ((97 % 1) <= (83 == v3)));
+        v2 = (((v0 && 11) + (a1[3][2] < 15)) * ((v3 != a0[0]) * (a0[4] || a1[1][12])));
+        a1[2][0] = (((10 && 90) || (14 / 1)) ? ((v3 % 5) ? (a0[6] <= a1[2][2]) : (v1 ? a1[1][2] : v2)) : ((a0[11] >= 86) <= (59 == v3)));
+    } else {
+        v1 = (((v0 < 4) * (37 > v3)) && ((a1[3][0] * a1[0][2]) - (v0 ? 22 : v0)));
+        a1[1][4] = (((a0[7] >= v1) < (16 ? v3 : a0[6])) || ((v0 >= v1) % 6));
+        a1[3][2] = (((a1[3][6] <= 21) - (v0 ? v0 : v3)) == ((v3 != a0[12]) != (a1[2][13] >= a1[3][6])));
+    }
+    return (((a0[3] - a1[3][2]) - (94 || a1[0][7])) % 9);
+}
+int f1() {
+    int v0 = 59;
+    int v1 = 33;
+    int v2 = 91;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[0][11] = (((i0 + v1) * (i0 * a0[7])) ? ((a0[14] > v1) == (v0 - v1)) : ((i0 + v2) ? (a0[10] || a0[14]) : (93 + 12)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((i0 == a1[3][8]) <= (v0 < v1)) ? ((99 + a0[15]) + (a1[0][2] + i1)) : ((96 <= a0[8]) + (v2 * a1[1][9])));
+                    a0[10] = (((v0 < v3) ? (67 == a0[15]) : (a0[10] < v0)) / 4);
+                    v0 = (((61 >= v2) <= (v1 > a0[4])) + ((52 - v0) / 5));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v1 = (((52 % 1) + (a0[5] * a0[6])) > ((31 ? v1 : v3) % 9));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 >= v3) * (v1 ? v3 : a1[0][15])) % 3)) {
+        a1[0][10] = (((v3 * 50) + (v0 < a0[11])) ? ((a0[10] - v1) <= (v1 * v3)) : ((v3 ? 66 : v3) >= (v2 || 29)));
+        v1 = (((14 != v2) || (a1[3][2] == a1[0][7])) < ((v1 > v1) % 5));
+        v3 = (((v3 != 72) != (v3 ? v0 : 7)) && ((v0 + v3) || (v3 < 75)));
+    } else {
+        a0[3] = (((a0[9] < 11) >= (a1[0][10] % 9)) * ((v2 ? v3 : v1) || (a0[4] >= v0)));
+        v0 = (((a1[2][3] && 65) >= (v0 ? v0 : a0[11])) + ((1 / 3) - (v0 - v3)));
+        a0[2] = (((v2 || a0[13]) * (v2 > 53)) + ((41 >= v0) / 5));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[2][2] = (((v1 < v1) - (v3 ? 82 : v2)) && ((v2 < 36) >= (51 ? a1[1][9] : 39)));
+            v0 = (((a0[1] % 5) <= (v1 ? i2 : v0)) < ((a1[3][13] + 71) ? (12 ? v3 : v3) : (86 ? 65 : v0)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v1 = (((i3 != v3) <= (i3 ? v3 : 70)) >= ((i3 <= i2) && (v3 <= a1[1][10])));
+                    a0[5] = (((i3 / 3) + (i2 < i3)) != ((66 ? i3 : a1[1][13]) < (a1[3][11] < 72)));
+                    a1[0][14] = (((a1[0][15] == 37) != (14 % 2)) > ((i3 == i2) && (4 > v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            a1[3][11] = (((a1[2][3] + a1[1][14]) / 4) / 3);
+            a1[3][13] = (((60 ? a1[3][2] : 28) - (v0 * v2)) || ((v0 != 31) <= (95 == 55)));
+            v3 = (((v3 == a0[9]) < (a1[1][15] % 4)) != ((v0 != 36) ? (i4 <= v0) : (a0[9] - 32)));
+        }
+        v2 = (((v2 * 84) + (v3 / 7)) < ((a0[1] >= v2) == (31 == 64)));
+        v0 = (((i4 >= 21) / 6) >= ((v2 ? 34 : a0[7]) < (a1[3][2] % 6)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v0 = (((v0 || 14) > (a1[0][9] + 0)) ? ((a1[1][14] * v3) ? (a0[4] && v2) : (v3 || a1[1][9])) : ((v0 - v0) > (v3 <= v3)));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v2 = (((48 ? 39 : v1) < (a0[12] * i6)) != ((v0 % 2) || (v1 % 4)));
+                v1 = (((a0[5] || v2) - (i7 != a1[1][3])) <= ((a0[13] % 8) % 2));
+                v2 = (((v3 % 1) <= (v1 <= a1[2][0])) == ((a1[1][3] < v3) == (a1[2][14] <= a0[14])));
+            }
+            v1 = (((v3 > v1) <= (i6 ? v3 : a0[12])) + ((a1[0][1] * v3) ? (v2 / 7) : (a0[14] + v3)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            v1 = (((v2 + v0) * (v2 || a1[2][5])) && ((5 ? v3 : 15) == (a1[2][11] > a0[4])));
+            a0[3] = (((a0[11] && 5) && (v1 <= i8)) - ((v0 < i8) + (85 % 8)));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                if ((73 && v2) > 59) break;
+                v1 = (((i9 * v1) - (v3 * a1[0][2])) > ((21 >= v3) - (v3 + 35)));
+                v3 = (((v3 % 4) == (39 && v0)) - ((v0 <= v3) && (17 % 2)));
+                v1 = (((a0[7] || v3) || (24 ? 69 : i8)) && ((v0 >= a0[7]) + (v2 <= v3)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            if ((a1[1][12] || a0[11]) > 99) break;
+            a0[12] = (((v1 - v2) ? (a0[12] - v2) : (74 >= v1)) < ((9 ? v0 : 97) ? (v1 > i10) : (a0[8] % 8)));
+            a1[0][8] = (((35 == v2) >= (v1 - v0)) <= ((28 != 36) || (a1[0][4] / 4)));
+            {
+                int i11 = 0;
+                while (i11 < 2) {
+                    v2 = (((i10 >= i10) >= (v3 + i10)) < ((a0[10] * 33) && (14 >= v2)));
+                    v1 = (((8 == 62) < (v0 ? i10 : v1)) <= ((i10 >= a0[12]) ? (35 * v0) : (48 / 5)));
+                    a1[0][9] = (((a1[0][4] ? a1[0][14] : i10) <= (a0[15] >= v0)) - ((v3 ? a0[0] : a0[5]) != (a1[2][14] > 21)));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 5; i12 = i12 + 1) {
+        for (int i13 = 0; i13 < 3; i13 = i13 + 1) {
+            if ((v2 != v3) > 57) break;
+            v3 = (((i13 * v0) - (i13 <= a0[14])) <= ((v3 ? a0[6] : v1) * (91 - v0)));
+            v3 = (((v0 ? v3 : a0[2]) || (i12 >= 51)) - ((38 == v3) / 3));
+            v1 = (((v1 ? v0 : 43) / 8) - ((a0[11] <= i12) / 6));
+        }
+        v1 = (((v3 == v2) != (a1[0][4] && a0[9])) && ((v2 ? i12 : v1) ? (v1 % 7) : (v2 * v2)));
+        v0 = (((v0 / 9) && (a0[12] / 9)) + ((i12 < a0[13]) != (a0[12] >= a1[1][9])));
+    }
+    a0[0] = (((v0 != v2) || (a1[2][1] - a1[0][5])) % 8);
+    {
+        int i14 = 0;
+        do {
+            {
+                int i15 = 0;
+                while (i15 < 2) {
+                    a0[9] = (((v3 % 9) + (a1[1][11] / 1)) + ((v0 == 25) != (a0[8] || i14)));
+                    a0[15] = (((91 ? a1[2][1] : 46) * (i14 != a0[7])) / 5);
+                    a0[7] = (((a0[2] ? 58 : i14) == (25 && i14)) || ((a1[0][12] + a0[3]) >= (11 && i15)));
+                    i15 = i15 + 1;
+                }
+            }
+            a0[14] = (((a1[0][15] < a0[15]) && (v3 && a1[3][11])) || ((v0 > v1) > (v1 + a1[1][15])));
+            v0 = (((a0[15] && 95) / 1) ? ((v2 + v1) ? (a1[3][3] >= a1[0][10]) : (12 + 85)) : ((a1[1][5] != v0) + (7 < v1)));
+            i14 = i14 + 1;
+        } while (i14 < 4);
+    }
+    return (((a1[1][9] ? 27 : v3) <= (a1[0][11] && v1)) && ((77 && v2) / 4));
+}
+int f2() {
+    int v0 = 90;
+    int v1 = 7;
+    int v2 = 64;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((v1 == v0) > 62) break;
+            a0[0] = (((v3 ? v1 : v3) * (a1[3][4] / 5)) <= ((v2 != a1[0][4]) ? (v3 + v2) : (i0 || i0)));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v2 >= a1[1][10]) == (a0[8] - 23)) ? ((v0 < v1) * (i1 != v2)) : ((a1[2][7] < i0) + (67 != a0[9])));
+                    v0 = (((a1[3][13] || v1) < (v2 < 54)) >= ((v0 <= a1[3][6]) % 1));
+                    a0[2] = (((22 ? a1[1][9] : v2) || (v0 * i1)) >= ((i1 || a1[2][10]) < (v0 <= v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v2 = (((v3 % 8) % 5) >= ((v1 < v0) != (v3 <= 31)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 / 6) < (v2 ? a1[1][5] : a0[5])) % 7)) {
+        v0 = (((54 % 8) - (v0 || 55)) == ((78 * 3) >= (a1[0][9] - v1)));
+        a0[14] = (((a1[0][11] >= a0[13]) - (a0[2] == v3)) && ((a0[1] / 2) % 3));
+        v3 = (((a0[6] + 87) || (a1[0][2] ? v2 : 84)) - ((v1 < v0) ? (v0 ? v2 : 51) : (v0 % 6)));
+    } else {
+        v0 = (((v3 ? a0[13] : v1) < (v2 ? v1 : v3)) * ((v2 == v3) <= (21 + 90)));
+        a1[3][10] = (((a0[10] != a1[1][7]) > (v1 + a0[6])) && ((v2 > 52) >= (a1[0][6] || a0[0])));
+        v3 = (((79 - v1) - (v0 ? 56 : 22)) + ((v1 == a0[7]) < (a1[3][8] * v1)));
+    }
+    if ((((51 + a1[2][11]) ? (v3 ? v1 : v3) : (a0[7] ? a0[4] : v3)) ? ((22 == v2) ? (97 == v3) : (v2 % 8)) : ((93 && v3) ? (v2 - a1[1][11]) : (a1[2][14] ? 70 : 83)))) {
+        a0[7] = (((v1 || v3) == (a1[3][9] * 89)) % 6);
+        v1 = (((v2 / 9) * (48 <= v3)) - ((v2 == v3) % 8));
+        a0[12] = (((a0[11] == v0) % 8) <= ((56 * a1[1][6]) != (83 - v1)));
+    } else {
+        a1[1][4] = (((v3 != v0) || (3 / 2)) ? ((48 == v1) - (a0[2] > 80)) : ((88 - 30) && (v1 && v3)));
+        v0 = (((a1[2][9] >= 20) < (v3 ? 64 : 19)) > ((v3 - 17) * (v3 <= 53)));
+        v2 = (((34 < 74) + (v2 == v1)) >= ((v3 != v0) > (40 + 63)));
+    }
+    if ((((v1 / 9) != (a0[11] == v0)) < ((v3 >= 50) >= (v3 % 3)))) {
+        v3 = (((v0 || v1) * (a1[2][14] > a0[2])) < ((v1 ? v0 : 28) != (a1[2][8] > v1)));
+        a0[0] = (((a0[8] - 66) && (v0 != v3)) + ((a1[0][7] % 3) || (a0[14] / 4)));
+        v1 = (((v3 && 83) >= (v3 != a0[12])) ? ((55 != 66) % 3) : ((v1 >= a0[11]) + (v3 ? 64 : 84)));
+    } else {
+        a0[15] = (((a1[1][0] < 16) || (66 * v1)) * ((v0 > a0[9]) / 9));
+        v2 = (((v2 / 7) ? (v0 ? v2 : v2) : (a1[1][2] + 32)) == ((a1[3][14] || a1[1][1]) % 3));
+        a1[2][15] = (((a1[2][12] ? v1 : v0) <= (a1[0][8] <= 80)) >= ((61 || v2) ? (79 / 2) : (v1 ? 94 : a0[15])));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a1[0][8] = (((32 ? 6 : a1[3][5]) && (v3 > v2)) == ((i2 % 5) || (i2 ? 36 : a1[1][14])));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v1 = (((v2 + i3) > (v1 < 17)) ? ((v2 - 43) < (a1[3][9] == a1[3][5])) : ((a0[9] > a1[2][0]) % 1));
+                v2 = (((v0 || a0[3]) ? (i3 > v2) : (a1[1][8] * v3)) != ((85 < 69) ? (81 <= v1) : (a0[15] != 8)));
+                a1[3][1] = (((a1[2][9] / 3) ? (13 + a0[12]) : (i3 - 6)) <= ((91 < i2) - (v3 ? a1[3][12] : v1)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((v1 && v3) != (v2 + v2)) && ((4 <= a0[7]) && (v0 > v3)));
+    }
+    if ((((51 < v2) == (v1 / 9)) % 7)) {
+        v1 = (((v1 && v0) + (a1[0][4] < a1[0][9])) ? ((29 > a1[0][7]) && (a0[15] != v0)) : ((v1 == v3) > (v3 / 5)));
+        a1[3][4] = (((19 <= v2) <= (a1[3][2] && 23)) && ((v1 > a0[4]) != (60 ? a1[1][15] : v0)));
+        v1 = (((a0[7] && a0[1]) != (41 * v3)) % 5);
+    } else {
+        a1[1][13] = (((a1[1][5] || v0) == (14 ? v2 : a1[3][7])) / 2);
+        v0 = (((v1 / 1) / 4) / 5);
+        v0 = (((v1 > 23) - (v3 + a1[3][5])) ? ((v2 == v0) > (a1[3][6] ? v3 : v2)) : ((v0 * v3) + (v1 >= a1[0][15])));
+    }
+    if ((((v0 < a0[0]) >= (v1 / 9)) ? ((v3 >= v0) * (46 * 43)) : ((a0[7] > a0[12]) != (v3 - v2)))) {
+        a0[8] = (((v2 >= v2) ? (a1[3][13] >= 94) : (v0 * a0[15])) - ((a0[5] != a0[0]) > (a1[1][2] >= v3)));
+        a0[1] = (((a0[10] && a0[1]) * (v0 || 94)) - ((a1[0][1] > 46) <= (v1 < 90)));
+        v3 = (((40 * v1) || (33 != a1[2][14])) ? ((a1[3][3] < v2) + (a0[7] || v0)) : ((v1 == 43) < (32 >= v2)));
+    } else {
+        v2 = (((v2 == v3) > (v0 + a1[2][2])) > ((v2 + v1) && (59 * v3)));
+        v2 = (((44 != a0[14]) || (v2 ? 93 : v3)) || ((v1 > 34) > (a0[8] / 5)));
+        v0 = (((47 % 8) && (85 % 5)) ? ((98 > v1) <= (a0[0] - 55)) : ((16 % 9) + (v3 * a1[3][4])));
+    }
+    v0 = (((v2 > v0) ? (v2 || 37) : (a0[6] == a1[2][15])) < ((a1[3][11] / 6) ? (a1[0][9] < 76) : (a0[15] == v2)));
+    v3 = (((a0[2] * v2) ? (a1[3][7] < v1) : (a1[0][0] % 3)) || ((39 ? a0[8] : 60) != (v0 < v3)));
+    v2 = (((v3 ? v3 : v3) % 9) * ((v1 ? v0 : a0[5]) - (a1[2][1] + v1)));
+    return (((v2 * a0[15]) ? (v3 || v1) : (v3 % 4)) - ((v1 % 6) ? (v3 == v2) : (v1 != v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,8157 @@
+    .file 1 "build/bench/batch/f2.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 299 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 300 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 301 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 302 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 303 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 304 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $86, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $48, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $37, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $67, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_6
+    .p2align 4,,10
+.Lf0_5:
+    .loc 1 9 9
+    movq $2, %rax
+    push %rax
+    movq $29, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movslq -12(%rbp), %rax
+    imulq $62, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_14
+    .p2align 4,,10
+.Lf0_13:
+    .loc 1 11 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_17
+    jmp .Lf0_16
+.Lf0_17:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_16:
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_15
+    jmp .Lf0_11
+.Lf0_15:
+    .loc 1 12 13
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_19
+    jmp .Lf0_18
+.Lf0_19:
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_21
+.Lf0_20:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_22
+.Lf0_21:
+    movslq -64(%rbp), %rax
+.Lf0_22:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_18:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_24
+    jmp .Lf0_23
+.Lf0_24:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_23:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_26
+    jmp .Lf0_25
+.Lf0_26:
+    movq $0, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_25:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 13 13
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_33
+    jmp .Lf0_34
+.Lf0_33:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_35
+.Lf0_34:
+    movq $34, %rax
+.Lf0_35:
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_31
+.Lf0_30:
+    movq $44, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_32
+.Lf0_31:
+    cmpl $48, -340(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_32:
+    cmpq $0, %rax
+    jne .Lf0_27
+    jmp .Lf0_28
+.Lf0_27:
+    movslq -80(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_36
+    jmp .Lf0_37
+.Lf0_36:
+    movslq -344(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_38
+.Lf0_37:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_40
+    jmp .Lf0_39
+.Lf0_40:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_39:
+.Lf0_38:
+    jmp .Lf0_29
+.Lf0_28:
+    cmpl $6, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_42
+.Lf0_41:
+    movslq -80(%rbp), %rax
+    addl -76(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_43
+.Lf0_42:
+    movslq -8(%rbp), %rax
+    imulq $75, %rax
+    movslq %eax, %rax
+.Lf0_43:
+.Lf0_29:
+    movl %eax, -76(%rbp)
+    .loc 1 14 13
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $48, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $72, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_12:
+    .loc 1 10 34
+    incl -344(%rbp)
+.Lf0_14:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_13
+.Lf0_11:
+    addq $0, %rsp
+    .loc 1 16 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_44
+    jmp .Lf0_45
+.Lf0_44:
+    movq $76, %rax
+    jmp .Lf0_46
+.Lf0_45:
+    movq $18, %rax
+.Lf0_46:
+    push %rax
+    movq $52, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_48
+    jmp .Lf0_47
+.Lf0_48:
+    movq $1, %rax
+    push %rax
+    movq $31, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_47:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_4:
+    .loc 1 8 30
+    incl -340(%rbp)
+.Lf0_6:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_5
+.Lf0_3:
+    addq $8, %rsp
+    .loc 1 18 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_53
+    jmp .Lf0_52
+.Lf0_53:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_52:
+    cmpq $0, %rax
+    jne .Lf0_49
+    jmp .Lf0_50
+.Lf0_49:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_54
+.Lf0_55:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_54:
+    jmp .Lf0_51
+.Lf0_50:
+    movq $57, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_51:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -32(%rbp)
+    .loc 1 19 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_61
+    .p2align 4,,10
+.Lf0_60:
+    .loc 1 20 9
+    movq $9, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $29, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_63
+    jmp .Lf0_62
+.Lf0_63:
+    movslq -8(%rbp), %rax
+    imull -48(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_62:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 21 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_69
+    .p2align 4,,10
+.Lf0_68:
+    .loc 1 22 13
+    movq $33, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_70
+.Lf0_71:
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_70:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $27, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_72
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_76
+.Lf0_75:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_77
+.Lf0_76:
+    movq $6, %rax
+.Lf0_77:
+    jmp .Lf0_74
+.Lf0_73:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_74:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 23 13
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_79
+    jmp .Lf0_78
+.Lf0_79:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_78:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_81
+    jmp .Lf0_80
+.Lf0_81:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_80:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_82
+.Lf0_83:
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_82:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    .loc 1 24 13
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_84
+    jmp .Lf0_85
+.Lf0_84:
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_86
+.Lf0_85:
+    movslq -344(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_86:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $15, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_67:
+    .loc 1 21 34
+    incl -344(%rbp)
+.Lf0_69:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_68
+.Lf0_66:
+    addq $0, %rsp
+    .loc 1 26 9
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_90
+.Lf0_91:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_90:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_87
+    jmp .Lf0_88
+.Lf0_87:
+    movslq -4(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_93
+    jmp .Lf0_92
+.Lf0_93:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_92:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_89
+.Lf0_88:
+    movslq -4(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $20, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_89:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_59:
+    .loc 1 19 30
+    incl -340(%rbp)
+.Lf0_61:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_60
+.Lf0_58:
+    addq $8, %rsp
+    .loc 1 29 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 30 9
+    .p2align 4,,10
+.Lf0_96:
+    .loc 1 31 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_102
+    .p2align 4,,10
+.Lf0_101:
+    .loc 1 32 17
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 33 17
+    movq $31, %rax
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_110
+.Lf0_109:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_111
+.Lf0_110:
+    movslq -20(%rbp), %rax
+.Lf0_111:
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_107
+.Lf0_106:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_108
+.Lf0_107:
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_108:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf0_112
+    jmp .Lf0_113
+.Lf0_112:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_114
+.Lf0_113:
+    movslq -48(%rbp), %rax
+.Lf0_114:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 34 17
+    movq $6, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_105:
+    .loc 1 31 38
+    incl -344(%rbp)
+    .loc 1 32 17
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 33 17
+    movq $31, %rax
+    cmpq $0, %rax
+    jne .Lf0_118
+    jmp .Lf0_119
+.Lf0_118:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_120
+.Lf0_119:
+    movslq -20(%rbp), %rax
+.Lf0_120:
+    cmpq $0, %rax
+    jne .Lf0_115
+    jmp .Lf0_116
+.Lf0_115:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_117
+.Lf0_116:
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_117:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_122
+.Lf0_121:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_123
+.Lf0_122:
+    movslq -48(%rbp), %rax
+.Lf0_123:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 34 17
+    movq $6, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_104:
+    .loc 1 31 38
+    incl -344(%rbp)
+.Lf0_102:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $6, %rax
+    jl .Lf0_101
+.Lf0_103:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_99
+    .loc 1 32 17
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 33 17
+    movq $31, %rax
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_128
+.Lf0_127:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_129
+.Lf0_128:
+    movslq -20(%rbp), %rax
+.Lf0_129:
+    cmpq $0, %rax
+    jne .Lf0_124
+    jmp .Lf0_125
+.Lf0_124:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_126
+.Lf0_125:
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_126:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_131
+.Lf0_130:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -48(%rbp), %rax
+.Lf0_132:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 34 17
+    movq $6, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_100:
+    .loc 1 31 38
+    incl -344(%rbp)
+    jmp .Lf0_103
+.Lf0_99:
+    addq $0, %rsp
+    .loc 1 36 13
+    movq $4, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_135
+.Lf0_134:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf0_135:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 37 13
+    movq $8, %rax
+    push %rax
+    movq $10, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_136
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -16(%rbp), %rax
+    addq $32, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $76, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_138
+.Lf0_137:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    subq $42, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $67, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_138:
+    movl %eax, -8(%rbp)
+    .loc 1 38 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_95:
+    .loc 1 39 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_96
+.Lf0_94:
+    addq $8, %rsp
+    .loc 1 41 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_139
+    jmp .Lf0_140
+.Lf0_139:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_141
+.Lf0_140:
+    movq $18, %rax
+.Lf0_141:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_143
+    jmp .Lf0_142
+.Lf0_143:
+    movq $76, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_142:
+    push %rax
+    cmpl $32, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $93, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 42 5
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_145
+    jmp .Lf0_146
+.Lf0_145:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_147
+.Lf0_146:
+    movq $29, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_147:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_148
+    .loc 1 43 9
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf0_152
+    jmp .Lf0_153
+.Lf0_152:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_154
+.Lf0_153:
+    movq $31, %rax
+.Lf0_154:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_149
+    jmp .Lf0_150
+.Lf0_149:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_158
+    jmp .Lf0_159
+.Lf0_158:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_160
+.Lf0_159:
+    movslq -12(%rbp), %rax
+.Lf0_160:
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_156
+.Lf0_155:
+    movq $2, %rax
+    push %rax
+    movq $55, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_157
+.Lf0_156:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_157:
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_162
+    jmp .Lf0_161
+.Lf0_162:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_161:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_151:
+    movl %eax, -8(%rbp)
+    .loc 1 44 9
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $20, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 45 9
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_166
+.Lf0_167:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_166:
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_164
+.Lf0_163:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $23, %rax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_165
+.Lf0_164:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_165:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_144
+.Lf0_148:
+    .loc 1 47 9
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    movq $60, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_170
+.Lf0_169:
+    movslq -76(%rbp), %rax
+    subq $42, %rax
+    movslq %eax, %rax
+.Lf0_170:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 48 9
+    cmpl $39, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_174
+.Lf0_173:
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_175
+.Lf0_174:
+    movq $57, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_175:
+    push %rax
+    movslq -64(%rbp), %rax
+    imulq $34, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_176
+    jmp .Lf0_177
+.Lf0_176:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_178
+.Lf0_177:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf0_178:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 49 9
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_181
+.Lf0_180:
+    movslq -12(%rbp), %rax
+.Lf0_181:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_144:
+    .loc 1 51 5
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_183
+    jmp .Lf0_182
+.Lf0_183:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_182:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_184
+    jmp .Lf0_185
+.Lf0_184:
+    movslq -20(%rbp), %rax
+    jmp .Lf0_186
+.Lf0_185:
+    movq $69, %rax
+.Lf0_186:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 52 5
+    movq $40, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_188
+    jmp .Lf0_187
+.Lf0_188:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_187:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_190
+    jmp .Lf0_189
+.Lf0_190:
+    movq $78, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_189:
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 53 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_196
+    .p2align 4,,10
+.Lf0_195:
+    .loc 1 55 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 56 13
+    jmp .Lf0_200
+    .p2align 4,,10
+.Lf0_199:
+    .loc 1 57 17
+    movq $9, %rax
+    push %rax
+    movq $77, %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 58 17
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_202
+    jmp .Lf0_201
+.Lf0_202:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_201:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 59 17
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 60 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_198:
+.Lf0_200:
+    .loc 1 56 20
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_199
+.Lf0_197:
+    addq $0, %rsp
+    .loc 1 63 9
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_204
+    jmp .Lf0_203
+.Lf0_204:
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_205
+.Lf0_206:
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_205:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_203:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_207
+    jmp .Lf0_208
+.Lf0_207:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_209
+.Lf0_208:
+    movslq -60(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_209:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 64 9
+    movq $9, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $20, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_211
+    jmp .Lf0_210
+.Lf0_211:
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_210:
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_213
+.Lf0_212:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_214
+.Lf0_213:
+    movq $19, %rax
+.Lf0_214:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_194:
+    .loc 1 53 30
+    incl -340(%rbp)
+.Lf0_196:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_195
+.Lf0_193:
+    addq $8, %rsp
+    .loc 1 66 5
+    movq $2, %rax
+    push %rax
+    movq $29, %rax
+    cmpq $0, %rax
+    jne .Lf0_216
+    jmp .Lf0_217
+.Lf0_216:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_218
+.Lf0_217:
+    movslq -4(%rbp), %rax
+.Lf0_218:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    addq $81, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    .loc 1 67 9
+    movq $1, %rax
+    push %rax
+    movq $97, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $83, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_221
+    jmp .Lf0_220
+.Lf0_221:
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_220:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_223
+    jmp .Lf0_222
+.Lf0_223:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_222:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 68 9
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_225
+    jmp .Lf0_224
+.Lf0_225:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_224:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $15, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_227
+    jmp .Lf0_226
+.Lf0_227:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_226:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 69 9
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_231
+.Lf0_232:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_231:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_234
+    jmp .Lf0_233
+.Lf0_234:
+    movq $1, %rax
+    push %rax
+    movq $14, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_233:
+    cmpq $0, %rax
+    jne .Lf0_228
+    jmp .Lf0_229
+.Lf0_228:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_236
+.Lf0_235:
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_237
+.Lf0_236:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_238
+    jmp .Lf0_239
+.Lf0_238:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf0_240
+.Lf0_239:
+    movslq -12(%rbp), %rax
+.Lf0_240:
+.Lf0_237:
+    jmp .Lf0_230
+.Lf0_229:
+    cmpl $86, -36(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $59, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_230:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_215
+.Lf0_219:
+    .loc 1 71 9
+    movq $37, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $4, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_242
+    jmp .Lf0_241
+.Lf0_242:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_243
+    jmp .Lf0_244
+.Lf0_243:
+    movq $22, %rax
+    jmp .Lf0_245
+.Lf0_244:
+    movslq -4(%rbp), %rax
+.Lf0_245:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_241:
+    movl %eax, -8(%rbp)
+    .loc 1 72 9
+    movslq -52(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf0_246
+    jmp .Lf0_247
+.Lf0_246:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_248
+.Lf0_247:
+    movslq -56(%rbp), %rax
+.Lf0_248:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_250
+    jmp .Lf0_249
+.Lf0_250:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_249:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 73 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_251
+    jmp .Lf0_252
+.Lf0_251:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_253
+.Lf0_252:
+    movslq -16(%rbp), %rax
+.Lf0_253:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_215:
+    .loc 1 75 5
+    movq $9, %rax
+    push %rax
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_255
+    jmp .Lf0_254
+.Lf0_255:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_254:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 77 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 78 5
+    subq $8, %rsp
+    movq $59, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 79 5
+    movq $33, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 80 5
+    subq $8, %rsp
+    movq $91, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 81 5
+    movq $67, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 82 5
+    subq $64, %rsp
+    .loc 1 83 5
+    subq $256, %rsp
+    .loc 1 85 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 86 9
+    jmp .Lf1_4
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 87 13
+    movslq -340(%rbp), %rax
+    imull -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_5
+    jmp .Lf1_6
+.Lf1_5:
+    movslq -24(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_7
+.Lf1_6:
+    movslq -340(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_8
+    jmp .Lf1_9
+.Lf1_8:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_12
+    jmp .Lf1_11
+.Lf1_12:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_11:
+    jmp .Lf1_10
+.Lf1_9:
+    movq $93, %rax
+    addq $12, %rax
+    movslq %eax, %rax
+.Lf1_10:
+.Lf1_7:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 89 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 90 17
+    .p2align 4,,10
+.Lf1_15:
+    .loc 1 91 21
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_16
+    jmp .Lf1_17
+.Lf1_16:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $99, %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_18
+.Lf1_17:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $96, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf1_18:
+    movl %eax, -12(%rbp)
+    .loc 1 92 21
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_19
+    jmp .Lf1_20
+.Lf1_19:
+    movq $67, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_21
+.Lf1_20:
+    movslq -40(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_21:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 93 21
+    movq $5, %rax
+    push %rax
+    movq $52, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $61, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 94 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_14:
+    .loc 1 95 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_15
+.Lf1_13:
+    addq $0, %rsp
+    .loc 1 97 13
+    movslq -60(%rbp), %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $52, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $31, %rax
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_23
+.Lf1_22:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_24
+.Lf1_23:
+    movslq -16(%rbp), %rax
+.Lf1_24:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 98 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+.Lf1_4:
+    .loc 1 86 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 101 5
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_26
+    jmp .Lf1_27
+.Lf1_26:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_28
+.Lf1_27:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf1_28:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_29
+    .loc 1 102 9
+    movslq -4(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $50, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_31
+.Lf1_30:
+    movslq -40(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_32
+.Lf1_31:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_33
+    jmp .Lf1_34
+.Lf1_33:
+    movq $66, %rax
+    jmp .Lf1_35
+.Lf1_34:
+    movslq -16(%rbp), %rax
+.Lf1_35:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_37
+    jmp .Lf1_36
+.Lf1_37:
+    movq $29, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_36:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_32:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 103 9
+    movq $14, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_39
+    jmp .Lf1_38
+.Lf1_39:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_38:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 104 9
+    cmpl $72, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_40
+    jmp .Lf1_41
+.Lf1_40:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_42
+.Lf1_41:
+    movq $7, %rax
+.Lf1_42:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_44
+    jmp .Lf1_43
+.Lf1_44:
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_46
+    jmp .Lf1_45
+.Lf1_46:
+    cmpl $75, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_45:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_43:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_25
+.Lf1_29:
+    .loc 1 106 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_48
+.Lf1_47:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_49
+.Lf1_48:
+    movslq -8(%rbp), %rax
+.Lf1_49:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    movslq -64(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    push %rax
+    cmpl $11, -44(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 107 9
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $1, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_53
+    jmp .Lf1_52
+.Lf1_53:
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_52:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_54
+    jmp .Lf1_55
+.Lf1_54:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_56
+.Lf1_55:
+    movslq -36(%rbp), %rax
+.Lf1_56:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 108 9
+    movq $5, %rax
+    push %rax
+    movq $41, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $53, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_58
+    jmp .Lf1_57
+.Lf1_58:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_57:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    addq $0, %rsp
+.Lf1_25:
+    .loc 1 111 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 112 9
+    .p2align 4,,10
+.Lf1_61:
+    .loc 1 113 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_62
+    jmp .Lf1_63
+.Lf1_62:
+    movq $82, %rax
+    jmp .Lf1_64
+.Lf1_63:
+    movslq -12(%rbp), %rax
+.Lf1_64:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_65
+.Lf1_66:
+    cmpl $36, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf1_69
+.Lf1_68:
+    movq $39, %rax
+.Lf1_69:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_65:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 114 13
+    movq $5, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_70
+    jmp .Lf1_71
+.Lf1_70:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_72
+.Lf1_71:
+    movslq -4(%rbp), %rax
+.Lf1_72:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    addq $71, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_74
+.Lf1_73:
+    movq $12, %rax
+    cmpq $0, %rax
+    jne .Lf1_76
+    jmp .Lf1_77
+.Lf1_76:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_78
+.Lf1_77:
+    movslq -16(%rbp), %rax
+.Lf1_78:
+    jmp .Lf1_75
+.Lf1_74:
+    movq $86, %rax
+    cmpq $0, %rax
+    jne .Lf1_79
+    jmp .Lf1_80
+.Lf1_79:
+    movq $65, %rax
+    jmp .Lf1_81
+.Lf1_80:
+    movslq -4(%rbp), %rax
+.Lf1_81:
+.Lf1_75:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 116 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 117 17
+    jmp .Lf1_85
+    .p2align 4,,10
+.Lf1_84:
+    .loc 1 118 21
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_86
+    jmp .Lf1_87
+.Lf1_86:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_88
+.Lf1_87:
+    movq $70, %rax
+.Lf1_88:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_90
+    jmp .Lf1_89
+.Lf1_90:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_89:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 119 21
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $66, %rax
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_92
+.Lf1_91:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_93
+.Lf1_92:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_93:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $72, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -60(%rbp)
+    .loc 1 120 21
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $37, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $14, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_95
+    jmp .Lf1_94
+.Lf1_95:
+    movq $4, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_94:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 121 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_83:
+.Lf1_85:
+    .loc 1 117 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_84
+.Lf1_82:
+    addq $0, %rsp
+    .loc 1 124 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_60:
+    .loc 1 125 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_61
+.Lf1_59:
+    addq $8, %rsp
+    .loc 1 127 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_101
+    .p2align 4,,10
+.Lf1_100:
+    .loc 1 128 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_107
+    .p2align 4,,10
+.Lf1_106:
+    .loc 1 129 13
+    movq $3, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 130 13
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $60, %rax
+    cmpq $0, %rax
+    jne .Lf1_108
+    jmp .Lf1_109
+.Lf1_108:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf1_110
+.Lf1_109:
+    movq $28, %rax
+.Lf1_110:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_112
+    jmp .Lf1_111
+.Lf1_112:
+    cmpl $31, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $95, %rax
+    cmpq $55, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_111:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 131 13
+    movslq -16(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $36, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_113
+    jmp .Lf1_114
+.Lf1_113:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_115
+.Lf1_114:
+    movslq -44(%rbp), %rax
+    subq $32, %rax
+    movslq %eax, %rax
+.Lf1_115:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_105:
+    .loc 1 128 34
+    incl -344(%rbp)
+.Lf1_107:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_106
+.Lf1_104:
+    addq $0, %rsp
+    .loc 1 133 9
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $84, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $31, %rax
+    cmpq $64, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 134 9
+    movq $6, %rax
+    push %rax
+    cmpl $21, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_116
+    jmp .Lf1_117
+.Lf1_116:
+    movq $34, %rax
+    jmp .Lf1_118
+.Lf1_117:
+    movslq -52(%rbp), %rax
+.Lf1_118:
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_99:
+    .loc 1 127 30
+    incl -340(%rbp)
+.Lf1_101:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_100
+.Lf1_98:
+    addq $8, %rsp
+    .loc 1 137 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 138 9
+    jmp .Lf1_122
+    .p2align 4,,10
+.Lf1_121:
+    .loc 1 139 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_127
+    jmp .Lf1_126
+.Lf1_127:
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_126:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    addq $0, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_123
+    jmp .Lf1_124
+.Lf1_123:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_128
+    jmp .Lf1_129
+.Lf1_128:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_131
+.Lf1_132:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_131:
+    jmp .Lf1_130
+.Lf1_129:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_134
+    jmp .Lf1_133
+.Lf1_134:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_133:
+.Lf1_130:
+    jmp .Lf1_125
+.Lf1_124:
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_125:
+    movl %eax, -4(%rbp)
+    .loc 1 140 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_140
+    .p2align 4,,10
+.Lf1_139:
+    .loc 1 141 17
+    movq $48, %rax
+    cmpq $0, %rax
+    jne .Lf1_141
+    jmp .Lf1_142
+.Lf1_141:
+    movq $39, %rax
+    jmp .Lf1_143
+.Lf1_142:
+    movslq -8(%rbp), %rax
+.Lf1_143:
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_145
+    jmp .Lf1_144
+.Lf1_145:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_144:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 142 17
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_147
+    jmp .Lf1_146
+.Lf1_147:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_146:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 143 17
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_138:
+    .loc 1 140 38
+    incl -344(%rbp)
+.Lf1_140:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_139
+.Lf1_137:
+    addq $0, %rsp
+    .loc 1 145 13
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_148
+    jmp .Lf1_149
+.Lf1_148:
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_150
+.Lf1_149:
+    movslq -24(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_150:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_151
+    jmp .Lf1_152
+.Lf1_151:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_153
+.Lf1_152:
+    movslq -32(%rbp), %rax
+.Lf1_153:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 146 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_120:
+.Lf1_122:
+    .loc 1 138 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_121
+.Lf1_119:
+    addq $8, %rsp
+    .loc 1 150 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 151 9
+    jmp .Lf1_157
+    .p2align 4,,10
+.Lf1_156:
+    .loc 1 152 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_159
+    jmp .Lf1_158
+.Lf1_159:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_158:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_161
+    jmp .Lf1_160
+.Lf1_161:
+    movq $5, %rax
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_163
+.Lf1_162:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_164
+.Lf1_163:
+    movq $15, %rax
+.Lf1_164:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_160:
+    movl %eax, -8(%rbp)
+    .loc 1 153 13
+    movq $8, %rax
+    push %rax
+    movq $85, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_168
+    jmp .Lf1_167
+.Lf1_168:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_167:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 154 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_174
+    .p2align 4,,10
+.Lf1_173:
+    .loc 1 155 17
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_180
+    jmp .Lf1_179
+.Lf1_180:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_179:
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_178
+    jmp .Lf1_171
+.Lf1_178:
+    .loc 1 156 17
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $35, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 157 17
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_182
+    jmp .Lf1_181
+.Lf1_182:
+    movq $2, %rax
+    push %rax
+    movq $17, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_181:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_184
+    jmp .Lf1_183
+.Lf1_184:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_183:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 158 17
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_186
+    jmp .Lf1_185
+.Lf1_186:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_185:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_188
+    jmp .Lf1_187
+.Lf1_188:
+    movq $24, %rax
+    cmpq $0, %rax
+    jne .Lf1_189
+    jmp .Lf1_190
+.Lf1_189:
+    movq $69, %rax
+    jmp .Lf1_191
+.Lf1_190:
+    movslq -340(%rbp), %rax
+.Lf1_191:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_187:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_193
+    jmp .Lf1_192
+.Lf1_193:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_192:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_177:
+    .loc 1 154 38
+    incl -344(%rbp)
+    .loc 1 155 17
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_196
+    jmp .Lf1_195
+.Lf1_196:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_195:
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_194
+    jmp .Lf1_171
+.Lf1_194:
+    .loc 1 156 17
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $35, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 157 17
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_197
+.Lf1_198:
+    movq $2, %rax
+    push %rax
+    movq $17, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_197:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_200
+    jmp .Lf1_199
+.Lf1_200:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 158 17
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_202
+    jmp .Lf1_201
+.Lf1_202:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_201:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_204
+    jmp .Lf1_203
+.Lf1_204:
+    movq $24, %rax
+    cmpq $0, %rax
+    jne .Lf1_205
+    jmp .Lf1_206
+.Lf1_205:
+    movq $69, %rax
+    jmp .Lf1_207
+.Lf1_206:
+    movslq -340(%rbp), %rax
+.Lf1_207:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_203:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_209
+    jmp .Lf1_208
+.Lf1_209:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_208:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_176:
+    .loc 1 154 38
+    incl -344(%rbp)
+.Lf1_174:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $4, %rax
+    jl .Lf1_173
+.Lf1_175:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_171
+    .loc 1 155 17
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_211
+.Lf1_212:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_211:
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_210
+    jmp .Lf1_171
+.Lf1_210:
+    .loc 1 156 17
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $35, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 157 17
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_214
+    jmp .Lf1_213
+.Lf1_214:
+    movq $2, %rax
+    push %rax
+    movq $17, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_213:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_215
+.Lf1_216:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_215:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 158 17
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_218
+    jmp .Lf1_217
+.Lf1_218:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_217:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_220
+    jmp .Lf1_219
+.Lf1_220:
+    movq $24, %rax
+    cmpq $0, %rax
+    jne .Lf1_221
+    jmp .Lf1_222
+.Lf1_221:
+    movq $69, %rax
+    jmp .Lf1_223
+.Lf1_222:
+    movslq -340(%rbp), %rax
+.Lf1_223:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_219:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_225
+    jmp .Lf1_224
+.Lf1_225:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_224:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_172:
+    .loc 1 154 38
+    incl -344(%rbp)
+    jmp .Lf1_175
+.Lf1_171:
+    addq $0, %rsp
+    .loc 1 160 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_155:
+.Lf1_157:
+    .loc 1 151 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_156
+.Lf1_154:
+    addq $8, %rsp
+    .loc 1 164 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 165 9
+    jmp .Lf1_229
+    .p2align 4,,10
+.Lf1_228:
+    .loc 1 166 13
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_232
+    jmp .Lf1_231
+.Lf1_232:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_231:
+    cmpq $99, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_230
+    jmp .Lf1_226
+.Lf1_230:
+    .loc 1 167 13
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_233
+    jmp .Lf1_234
+.Lf1_233:
+    movslq -32(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_235
+.Lf1_234:
+    movq $74, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_235:
+    push %rax
+    movq $9, %rax
+    cmpq $0, %rax
+    jne .Lf1_239
+    jmp .Lf1_240
+.Lf1_239:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_241
+.Lf1_240:
+    movq $97, %rax
+.Lf1_241:
+    cmpq $0, %rax
+    jne .Lf1_236
+    jmp .Lf1_237
+.Lf1_236:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_238
+.Lf1_237:
+    movq $8, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_238:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -32(%rbp)
+    .loc 1 168 13
+    movq $35, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $28, %rax
+    cmpq $36, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_243
+    jmp .Lf1_242
+.Lf1_243:
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_242:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 170 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 171 17
+    jmp .Lf1_247
+    .p2align 4,,10
+.Lf1_246:
+    .loc 1 172 21
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -40(%rbp), %rax
+    imulq $33, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_249
+    jmp .Lf1_248
+.Lf1_249:
+    movq $14, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_248:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 173 21
+    movq $8, %rax
+    cmpq $62, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_250
+    jmp .Lf1_251
+.Lf1_250:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_252
+.Lf1_251:
+    movslq -8(%rbp), %rax
+.Lf1_252:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_253
+    jmp .Lf1_254
+.Lf1_253:
+    movq $35, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_255
+.Lf1_254:
+    movq $5, %rax
+    push %rax
+    movq $48, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_255:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 174 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_256
+    jmp .Lf1_257
+.Lf1_256:
+    movslq -80(%rbp), %rax
+    jmp .Lf1_258
+.Lf1_257:
+    movslq -60(%rbp), %rax
+.Lf1_258:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_259
+    jmp .Lf1_260
+.Lf1_259:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf1_261
+.Lf1_260:
+    movslq -340(%rbp), %rax
+.Lf1_261:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 175 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_245:
+.Lf1_247:
+    .loc 1 171 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_246
+.Lf1_244:
+    addq $0, %rsp
+    .loc 1 178 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_227:
+.Lf1_229:
+    .loc 1 165 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_228
+.Lf1_226:
+    addq $8, %rsp
+    .loc 1 181 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_267
+    .p2align 4,,10
+.Lf1_266:
+    .loc 1 182 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 183 13
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $57, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_273
+    jmp .Lf1_270
+.Lf1_273:
+    .loc 1 184 13
+    movslq -344(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_274
+    jmp .Lf1_275
+.Lf1_274:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_276
+.Lf1_275:
+    movslq -8(%rbp), %rax
+.Lf1_276:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 185 13
+    movq $3, %rax
+    push %rax
+    movq $38, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_277
+    jmp .Lf1_278
+.Lf1_277:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_279
+.Lf1_278:
+    movslq -72(%rbp), %rax
+.Lf1_279:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_281
+    jmp .Lf1_280
+.Lf1_281:
+    cmpl $51, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_280:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 186 13
+    movq $6, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_282
+    jmp .Lf1_283
+.Lf1_282:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_284
+.Lf1_283:
+    movq $43, %rax
+.Lf1_284:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_272:
+    .loc 1 182 36
+    incl -344(%rbp)
+    .loc 1 183 13
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $57, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_286
+    jmp .Lf1_270
+.Lf1_286:
+    .loc 1 184 13
+    movslq -344(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_287
+    jmp .Lf1_288
+.Lf1_287:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_289
+.Lf1_288:
+    movslq -8(%rbp), %rax
+.Lf1_289:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 185 13
+    movq $3, %rax
+    push %rax
+    movq $38, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_290
+    jmp .Lf1_291
+.Lf1_290:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_292
+.Lf1_291:
+    movslq -72(%rbp), %rax
+.Lf1_292:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_294
+    jmp .Lf1_293
+.Lf1_294:
+    cmpl $51, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_293:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 186 13
+    movq $6, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_295
+    jmp .Lf1_296
+.Lf1_295:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_297
+.Lf1_296:
+    movq $43, %rax
+.Lf1_297:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_285:
+    .loc 1 182 36
+    incl -344(%rbp)
+    .loc 1 183 13
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $57, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_298
+    jmp .Lf1_270
+.Lf1_298:
+    .loc 1 184 13
+    movslq -344(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_299
+    jmp .Lf1_300
+.Lf1_299:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_301
+.Lf1_300:
+    movslq -8(%rbp), %rax
+.Lf1_301:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 185 13
+    movq $3, %rax
+    push %rax
+    movq $38, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_302
+    jmp .Lf1_303
+.Lf1_302:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_304
+.Lf1_303:
+    movslq -72(%rbp), %rax
+.Lf1_304:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_306
+    jmp .Lf1_305
+.Lf1_306:
+    cmpl $51, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_305:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 186 13
+    movq $6, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_307
+    jmp .Lf1_308
+.Lf1_307:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_309
+.Lf1_308:
+    movq $43, %rax
+.Lf1_309:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_271:
+    .loc 1 182 36
+    incl -344(%rbp)
+.Lf1_270:
+    addq $0, %rsp
+    .loc 1 188 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_311
+    jmp .Lf1_310
+.Lf1_311:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_310:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_313
+    jmp .Lf1_312
+.Lf1_313:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_317
+    jmp .Lf1_318
+.Lf1_317:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_319
+.Lf1_318:
+    movslq -8(%rbp), %rax
+.Lf1_319:
+    cmpq $0, %rax
+    jne .Lf1_314
+    jmp .Lf1_315
+.Lf1_314:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_316
+.Lf1_315:
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_316:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_312:
+    movl %eax, -8(%rbp)
+    .loc 1 189 9
+    movslq -340(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -32(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_321
+    jmp .Lf1_320
+.Lf1_321:
+    movq $9, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_320:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_265:
+    .loc 1 181 32
+    incl -340(%rbp)
+.Lf1_267:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_266
+.Lf1_264:
+    addq $8, %rsp
+    .loc 1 191 5
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_323
+    jmp .Lf1_322
+.Lf1_323:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_322:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 193 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 194 9
+    .p2align 4,,10
+.Lf1_326:
+    .loc 1 196 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 197 17
+    jmp .Lf1_330
+    .p2align 4,,10
+.Lf1_329:
+    .loc 1 198 21
+    cmpl $25, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_332
+    jmp .Lf1_331
+.Lf1_332:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_331:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 199 21
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $91, %rax
+    cmpq $0, %rax
+    jne .Lf1_333
+    jmp .Lf1_334
+.Lf1_333:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf1_335
+.Lf1_334:
+    movq $46, %rax
+.Lf1_335:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 200 21
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_336
+    jmp .Lf1_337
+.Lf1_336:
+    movq $58, %rax
+    jmp .Lf1_338
+.Lf1_337:
+    movslq -340(%rbp), %rax
+.Lf1_338:
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_340
+    jmp .Lf1_339
+.Lf1_340:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_339:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_342
+    jmp .Lf1_341
+.Lf1_342:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_344
+    jmp .Lf1_343
+.Lf1_344:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_343:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_341:
+    movl %eax, -52(%rbp)
+    .loc 1 201 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_328:
+.Lf1_330:
+    .loc 1 197 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_329
+.Lf1_327:
+    addq $0, %rsp
+    .loc 1 204 13
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_346
+    jmp .Lf1_345
+.Lf1_346:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_348
+    jmp .Lf1_347
+.Lf1_348:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_347:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_345:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_350
+    jmp .Lf1_349
+.Lf1_350:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_349:
+    movl %eax, -24(%rbp)
+    .loc 1 205 13
+    movq $1, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_355
+    jmp .Lf1_354
+.Lf1_355:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_354:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_351
+    jmp .Lf1_352
+.Lf1_351:
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_356
+    jmp .Lf1_357
+.Lf1_356:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_358
+.Lf1_357:
+    movq $12, %rax
+    addq $85, %rax
+    movslq %eax, %rax
+.Lf1_358:
+    jmp .Lf1_353
+.Lf1_352:
+    movq $7, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf1_353:
+    movl %eax, -4(%rbp)
+    .loc 1 206 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_325:
+    .loc 1 207 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_326
+.Lf1_324:
+    addq $8, %rsp
+    .loc 1 209 5
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_359
+    jmp .Lf1_360
+.Lf1_359:
+    movq $27, %rax
+    jmp .Lf1_361
+.Lf1_360:
+    movslq -16(%rbp), %rax
+.Lf1_361:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_363
+    jmp .Lf1_362
+.Lf1_363:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_362:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_365
+    jmp .Lf1_364
+.Lf1_365:
+    movq $4, %rax
+    push %rax
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_367
+    jmp .Lf1_366
+.Lf1_367:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_366:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_364:
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 211 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 212 5
+    subq $8, %rsp
+    movq $90, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 213 5
+    movq $7, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 214 5
+    subq $8, %rsp
+    movq $64, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 215 5
+    movq $16, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 216 5
+    subq $64, %rsp
+    .loc 1 217 5
+    subq $256, %rsp
+    .loc 1 219 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 220 9
+    jmp .Lf2_4
+    .p2align 4,,10
+.Lf2_3:
+    .loc 1 221 13
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $62, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_5
+    jmp .Lf2_1
+.Lf2_5:
+    .loc 1 222 13
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_6
+    jmp .Lf2_7
+.Lf2_6:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_8
+.Lf2_7:
+    movslq -16(%rbp), %rax
+.Lf2_8:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_9
+    jmp .Lf2_10
+.Lf2_9:
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_11
+.Lf2_10:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_13
+    jmp .Lf2_12
+.Lf2_13:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_12:
+.Lf2_11:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -80(%rbp)
+    .loc 1 224 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 225 17
+    .p2align 4,,10
+.Lf2_16:
+    .loc 1 226 21
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -48(%rbp), %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_17
+    jmp .Lf2_18
+.Lf2_17:
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_19
+.Lf2_18:
+    movq $67, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_19:
+    movl %eax, -4(%rbp)
+    .loc 1 227 21
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_21
+    jmp .Lf2_20
+.Lf2_21:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_20:
+    push %rax
+    cmpl $54, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 228 21
+    movq $22, %rax
+    cmpq $0, %rax
+    jne .Lf2_22
+    jmp .Lf2_23
+.Lf2_22:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf2_24
+.Lf2_23:
+    movslq -12(%rbp), %rax
+.Lf2_24:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_26
+    jmp .Lf2_25
+.Lf2_26:
+    movslq -4(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_25:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_28
+    jmp .Lf2_27
+.Lf2_28:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_27:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -72(%rbp)
+    .loc 1 229 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_15:
+    .loc 1 230 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_16
+.Lf2_14:
+    addq $0, %rsp
+    .loc 1 232 13
+    movq $5, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $31, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 233 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_2:
+.Lf2_4:
+    .loc 1 220 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_3
+.Lf2_1:
+    addq $8, %rsp
+    .loc 1 236 5
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_30
+    jmp .Lf2_31
+.Lf2_30:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf2_32
+.Lf2_31:
+    movslq -60(%rbp), %rax
+.Lf2_32:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_33
+    .loc 1 237 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_35
+    jmp .Lf2_34
+.Lf2_35:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_34:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $78, %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 238 9
+    movslq -72(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_37
+    jmp .Lf2_36
+.Lf2_37:
+    movq $3, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_36:
+    movl %eax, -24(%rbp)
+    .loc 1 239 9
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_38
+    jmp .Lf2_39
+.Lf2_38:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_41
+    jmp .Lf2_42
+.Lf2_41:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_43
+.Lf2_42:
+    movq $51, %rax
+.Lf2_43:
+    jmp .Lf2_40
+.Lf2_39:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_40:
+    push %rax
+    movslq -56(%rbp), %rax
+    addq $87, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_45
+    jmp .Lf2_44
+.Lf2_45:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_46
+    jmp .Lf2_47
+.Lf2_46:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_48
+.Lf2_47:
+    movq $84, %rax
+.Lf2_48:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_44:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_29
+.Lf2_33:
+    .loc 1 241 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $21, %rax
+    addq $90, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_49
+    jmp .Lf2_50
+.Lf2_49:
+    movslq -28(%rbp), %rax
+    jmp .Lf2_51
+.Lf2_50:
+    movslq -8(%rbp), %rax
+.Lf2_51:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_52
+    jmp .Lf2_53
+.Lf2_52:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_54
+.Lf2_53:
+    movslq -16(%rbp), %rax
+.Lf2_54:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 242 9
+    movslq -40(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_56
+    jmp .Lf2_55
+.Lf2_56:
+    cmpl $52, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_58
+    jmp .Lf2_57
+.Lf2_58:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_57:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_55:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 243 9
+    movslq -8(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_59
+    jmp .Lf2_60
+.Lf2_59:
+    movq $56, %rax
+    jmp .Lf2_61
+.Lf2_60:
+    movq $22, %rax
+.Lf2_61:
+    push %rax
+    movq $79, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_29:
+    .loc 1 245 5
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    addq $51, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_66
+    jmp .Lf2_67
+.Lf2_66:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_69
+    jmp .Lf2_70
+.Lf2_69:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_71
+.Lf2_70:
+    movslq -16(%rbp), %rax
+.Lf2_71:
+    jmp .Lf2_68
+.Lf2_67:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_72
+    jmp .Lf2_73
+.Lf2_72:
+    movslq -64(%rbp), %rax
+    jmp .Lf2_74
+.Lf2_73:
+    movslq -16(%rbp), %rax
+.Lf2_74:
+.Lf2_68:
+    cmpq $0, %rax
+    jne .Lf2_63
+    jmp .Lf2_64
+.Lf2_63:
+    movq $22, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_75
+    jmp .Lf2_76
+.Lf2_75:
+    movq $97, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_77
+.Lf2_76:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_77:
+    jmp .Lf2_65
+.Lf2_64:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_82
+    jmp .Lf2_81
+.Lf2_82:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_81:
+    cmpq $0, %rax
+    jne .Lf2_78
+    jmp .Lf2_79
+.Lf2_78:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_80
+.Lf2_79:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_83
+    jmp .Lf2_84
+.Lf2_83:
+    movq $70, %rax
+    jmp .Lf2_85
+.Lf2_84:
+    movq $83, %rax
+.Lf2_85:
+.Lf2_80:
+.Lf2_65:
+    cmpq $0, %rax
+    je .Lf2_86
+    .loc 1 246 9
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_88
+    jmp .Lf2_87
+.Lf2_88:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_87:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    imulq $89, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 247 9
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $48, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 248 9
+    movq $8, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $56, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $83, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_62
+.Lf2_86:
+    .loc 1 250 9
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_93
+    jmp .Lf2_92
+.Lf2_93:
+    movq $2, %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_92:
+    cmpq $0, %rax
+    jne .Lf2_89
+    jmp .Lf2_90
+.Lf2_89:
+    cmpl $80, -72(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $48, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_91
+.Lf2_90:
+    movq $88, %rax
+    subq $30, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_95
+    jmp .Lf2_94
+.Lf2_95:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_97
+    jmp .Lf2_96
+.Lf2_97:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_96:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_94:
+.Lf2_91:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 251 9
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $20, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_98
+    jmp .Lf2_99
+.Lf2_98:
+    movq $64, %rax
+    jmp .Lf2_100
+.Lf2_99:
+    movq $19, %rax
+.Lf2_100:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $53, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $17, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 252 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $34, %rax
+    cmpq $74, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $40, %rax
+    addq $63, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_62:
+    .loc 1 254 5
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $50, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf2_102
+    .loc 1 255 9
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_104
+    jmp .Lf2_103
+.Lf2_104:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_103:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_105
+    jmp .Lf2_106
+.Lf2_105:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_107
+.Lf2_106:
+    movq $28, %rax
+.Lf2_107:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 256 9
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_109
+    jmp .Lf2_108
+.Lf2_109:
+    movq $4, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_108:
+    push %rax
+    movslq -48(%rbp), %rax
+    subq $66, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_111
+    jmp .Lf2_110
+.Lf2_111:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_110:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 257 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_116
+    jmp .Lf2_115
+.Lf2_116:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_115:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_112
+    jmp .Lf2_113
+.Lf2_112:
+    movq $3, %rax
+    push %rax
+    movq $55, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_114
+.Lf2_113:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_117
+    jmp .Lf2_118
+.Lf2_117:
+    movq $64, %rax
+    jmp .Lf2_119
+.Lf2_118:
+    movq $84, %rax
+.Lf2_119:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_114:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_101
+.Lf2_102:
+    .loc 1 259 9
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_121
+    jmp .Lf2_120
+.Lf2_121:
+    movq $66, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_120:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 260 9
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_123
+.Lf2_122:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_125
+    jmp .Lf2_126
+.Lf2_125:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_127
+.Lf2_126:
+    movslq -12(%rbp), %rax
+.Lf2_127:
+    jmp .Lf2_124
+.Lf2_123:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    addq $32, %rax
+    movslq %eax, %rax
+.Lf2_124:
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_129
+    jmp .Lf2_128
+.Lf2_129:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_128:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 261 9
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_130
+    jmp .Lf2_131
+.Lf2_130:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_132
+.Lf2_131:
+    movslq -4(%rbp), %rax
+.Lf2_132:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $80, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_137
+    jmp .Lf2_136
+.Lf2_137:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_136:
+    cmpq $0, %rax
+    jne .Lf2_133
+    jmp .Lf2_134
+.Lf2_133:
+    movq $2, %rax
+    push %rax
+    movq $79, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_135
+.Lf2_134:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_138
+    jmp .Lf2_139
+.Lf2_138:
+    movq $94, %rax
+    jmp .Lf2_140
+.Lf2_139:
+    movslq -20(%rbp), %rax
+.Lf2_140:
+.Lf2_135:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_101:
+    .loc 1 263 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_146
+    .p2align 4,,10
+.Lf2_145:
+    .loc 1 264 9
+    movq $32, %rax
+    cmpq $0, %rax
+    jne .Lf2_147
+    jmp .Lf2_148
+.Lf2_147:
+    movq $6, %rax
+    jmp .Lf2_149
+.Lf2_148:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf2_149:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_151
+    jmp .Lf2_150
+.Lf2_151:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_150:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_153
+    jmp .Lf2_152
+.Lf2_153:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_154
+    jmp .Lf2_155
+.Lf2_154:
+    movq $36, %rax
+    jmp .Lf2_156
+.Lf2_155:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf2_156:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_152:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 266 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 267 13
+    jmp .Lf2_160
+    .p2align 4,,10
+.Lf2_159:
+    .loc 1 268 17
+    movslq -12(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $17, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_161
+    jmp .Lf2_162
+.Lf2_161:
+    movslq -12(%rbp), %rax
+    subq $43, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_163
+.Lf2_162:
+    movq $1, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_163:
+    movl %eax, -8(%rbp)
+    .loc 1 269 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_168
+    jmp .Lf2_167
+.Lf2_168:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_167:
+    cmpq $0, %rax
+    jne .Lf2_164
+    jmp .Lf2_165
+.Lf2_164:
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_166
+.Lf2_165:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_166:
+    push %rax
+    movq $85, %rax
+    cmpq $69, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_169
+    jmp .Lf2_170
+.Lf2_169:
+    movq $81, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_171
+.Lf2_170:
+    cmpl $8, -20(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf2_171:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 270 17
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_172
+    jmp .Lf2_173
+.Lf2_172:
+    movq $13, %rax
+    addl -32(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_174
+.Lf2_173:
+    movslq -344(%rbp), %rax
+    subq $6, %rax
+    movslq %eax, %rax
+.Lf2_174:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_175
+    jmp .Lf2_176
+.Lf2_175:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf2_177
+.Lf2_176:
+    movslq -8(%rbp), %rax
+.Lf2_177:
+    push %rax
+    movq $91, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 271 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_158:
+.Lf2_160:
+    .loc 1 267 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_159
+.Lf2_157:
+    addq $0, %rsp
+    .loc 1 274 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_179
+    jmp .Lf2_178
+.Lf2_179:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_178:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_181
+    jmp .Lf2_180
+.Lf2_181:
+    movq $4, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_183
+    jmp .Lf2_182
+.Lf2_183:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_182:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_180:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_144:
+    .loc 1 263 30
+    incl -340(%rbp)
+.Lf2_146:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_145
+.Lf2_143:
+    addq $8, %rsp
+    .loc 1 276 5
+    movq $7, %rax
+    push %rax
+    movq $51, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_185
+    .loc 1 277 9
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_190
+    jmp .Lf2_189
+.Lf2_190:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_189:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_186
+    jmp .Lf2_187
+.Lf2_186:
+    movq $29, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_192
+    jmp .Lf2_191
+.Lf2_192:
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_191:
+    jmp .Lf2_188
+.Lf2_187:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_188:
+    movl %eax, -8(%rbp)
+    .loc 1 278 9
+    movq $19, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_194
+    jmp .Lf2_193
+.Lf2_194:
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_193:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_196
+    jmp .Lf2_195
+.Lf2_196:
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $60, %rax
+    cmpq $0, %rax
+    jne .Lf2_197
+    jmp .Lf2_198
+.Lf2_197:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf2_199
+.Lf2_198:
+    movslq -4(%rbp), %rax
+.Lf2_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_195:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 279 9
+    movq $5, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_201
+    jmp .Lf2_200
+.Lf2_201:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_200:
+    push %rax
+    movq $41, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_184
+.Lf2_185:
+    .loc 1 281 9
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_203
+    jmp .Lf2_202
+.Lf2_203:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_202:
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf2_204
+    jmp .Lf2_205
+.Lf2_204:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_206
+.Lf2_205:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf2_206:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 282 9
+    movq $5, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 283 9
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $23, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_207
+    jmp .Lf2_208
+.Lf2_207:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_210
+    jmp .Lf2_211
+.Lf2_210:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_212
+.Lf2_211:
+    movslq -12(%rbp), %rax
+.Lf2_212:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_209
+.Lf2_208:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_209:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_184:
+    .loc 1 285 5
+    movslq -4(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_214
+    jmp .Lf2_215
+.Lf2_214:
+    movq $46, %rax
+    imulq $43, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_216
+.Lf2_215:
+    movslq -52(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_216:
+    cmpq $0, %rax
+    je .Lf2_217
+    .loc 1 286 9
+    movslq -60(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_218
+    jmp .Lf2_219
+.Lf2_218:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $94, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_220
+.Lf2_219:
+    movslq -4(%rbp), %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_220:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    .loc 1 287 9
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $46, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $90, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_222
+    jmp .Lf2_221
+.Lf2_222:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_221:
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_224
+    jmp .Lf2_223
+.Lf2_224:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_223:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 288 9
+    movq $40, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_229
+    jmp .Lf2_228
+.Lf2_229:
+    movq $33, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_228:
+    cmpq $0, %rax
+    jne .Lf2_225
+    jmp .Lf2_226
+.Lf2_225:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_231
+    jmp .Lf2_230
+.Lf2_231:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_230:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_227
+.Lf2_226:
+    cmpl $43, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $32, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_227:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_213
+.Lf2_217:
+    .loc 1 290 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_233
+    jmp .Lf2_232
+.Lf2_233:
+    movq $59, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_232:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 291 9
+    movq $44, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_235
+    jmp .Lf2_234
+.Lf2_235:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_236
+    jmp .Lf2_237
+.Lf2_236:
+    movq $93, %rax
+    jmp .Lf2_238
+.Lf2_237:
+    movslq -16(%rbp), %rax
+.Lf2_238:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_234:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_240
+    jmp .Lf2_239
+.Lf2_240:
+    cmpl $34, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_239:
+    movl %eax, -12(%rbp)
+    .loc 1 292 9
+    movq $8, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_245
+    jmp .Lf2_244
+.Lf2_245:
+    movq $5, %rax
+    push %rax
+    movq $85, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_244:
+    cmpq $0, %rax
+    jne .Lf2_241
+    jmp .Lf2_242
+.Lf2_241:
+    movq $98, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -80(%rbp), %rax
+    subq $55, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_243
+.Lf2_242:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $16, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_243:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_213:
+    .loc 1 294 5
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_246
+    jmp .Lf2_247
+.Lf2_246:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_250
+    jmp .Lf2_249
+.Lf2_250:
+    movq $37, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_249:
+    jmp .Lf2_248
+.Lf2_247:
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_248:
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_251
+    jmp .Lf2_252
+.Lf2_251:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $76, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_253
+.Lf2_252:
+    movslq -20(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf2_253:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 295 5
+    movslq -72(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_254
+    jmp .Lf2_255
+.Lf2_254:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_256
+.Lf2_255:
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_256:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_258
+    jmp .Lf2_257
+.Lf2_258:
+    movq $39, %rax
+    cmpq $0, %rax
+    jne .Lf2_259
+    jmp .Lf2_260
+.Lf2_259:
+    movslq -48(%rbp), %rax
+    jmp .Lf2_261
+.Lf2_260:
+    movq $60, %rax
+.Lf2_261:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_257:
+    movl %eax, -16(%rbp)
+    .loc 1 296 5
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_262
+    jmp .Lf2_263
+.Lf2_262:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_264
+.Lf2_263:
+    movslq -60(%rbp), %rax
+.Lf2_264:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_265
+    jmp .Lf2_266
+.Lf2_265:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_267
+.Lf2_266:
+    movslq -16(%rbp), %rax
+.Lf2_267:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 297 5
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_268
+    jmp .Lf2_269
+.Lf2_268:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_270
+.Lf2_269:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_270:
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_271
+    jmp .Lf2_272
+.Lf2_271:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_275
+    jmp .Lf2_274
+.Lf2_275:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_274:
+    jmp .Lf2_273
+.Lf2_272:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_273:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
@@ -0,0 +1,115 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 43;
+    int v2 = 36;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a0[4] = (((a0[10] ? 13 : 82) * (v1 ? a0[0] : 59)) ? ((13 < i1) / 6) : ((45 + a1[2][10]) - (90 == v2)));
+                    v0 = (((v0 ? a1[1][6] : a0[5]) && (v0 < a0[10])) < ((v3 ? a1[1][14] : 91) <= (2 == i0)));
+                    v2 = (((a1[2][7] ? v3 : a0[14]) / 7) <= ((v2 / 9) != (i1 ? v1 : v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[1] = (((v3 || a0[3]) != (i0 && a1[3][13])) || ((a0[6] - a1[1][11]) == (v1 != v0)));
+            v0 = (((v3 ? a1[0][3] : v3) + (86 <= 28)) + ((v2 + v1) + (a0[3] - v3)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 && v3) > 70) break;
+            v2 = (((i2 * v3) < (v0 / 7)) != ((97 + v3) > (a0[3] - a1[3][3])));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((27 * i3) > 98) break;
+                    v2 = (((i3 > v0) - (41 % 4)) % 2);
+                    v2 = (((18 % 7) <= (a0[8] / 3)) ? ((v1 || i3) * (45 / 4)) : ((v1 == a1[1][10]) - (74 || a1[1][6])));
+                    a1[0][9] = (((i3 && 25) ? (a1[0][13] ? v3 : i3) : (a0[11] <= i2)) >= ((92 + i3) <= (2 / 6)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a1[1][1] % 7) - (i2 + a0[12])) < ((i2 * 73) >= (a0[1] && 74)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v0 = (((69 * a0[1]) != (v3 >= v2)) >= ((v3 / 3) == (37 / 4)));
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((a0[15] < i4) > 59) break;
+        v1 = (((30 <= a1[2][15]) && (v0 >= 87)) != ((73 || 63) != (94 + v1)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                a1[3][7] = (((a0[9] - v0) - (33 ? v1 : v0)) <= ((v3 ? 37 : 50) - (46 + a1[3][6])));
+                v3 = (((v3 || v2) <= (v1 <= i4)) * ((v0 ? v2 : a1[3][5]) || (96 ? 93 : 57)));
+                v0 = (((v2 - v2) == (22 % 3)) + ((v3 != v3) - (v2 - i5)));
+                i5 = i5 + 1;
+            }
+        }
+        v1 = (((i4 == a1[1][10]) % 8) <= ((i4 || v1) * (v2 ? a1[0][10] : i4)));
+    }
+    if ((((a0[10] - 2) > (73 / 4)) % 5)) {
+        v0 = (((61 + v3) ? (v3 || a0[10]) : (v3 > 82)) < ((v1 >= a0[15]) / 5));
+        a1[0][8] = (((v1 >= a1[3][9]) == (a0[9] ? 60 : a0[11])) / 3);
+        a1[0][3] = (((a1[1][9] - 17) % 1) >= ((a0[13] != 64) ? (v1 + v1) : (v2 == 61)));
+    } else {
+        a1[1][0] = (((v2 || 59) * (v0 > v3)) && ((v3 % 3) % 1));
+        v1 = (((a1[1][6] != a1[3][1]) && (a0[15] * v0)) - ((83 && v0) > (v1 ? v2 : v1)));
+        v2 = (((v0 / 9) && (v0 <= v3)) == ((97 && a1[0][10]) || (25 <= 75)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        v1 = (((a1[0][11] % 9) ? (a0[8] && i6) : (v2 > a1[1][13])) ? ((v3 != 4) <= (a0[3] < i6)) : ((i6 || 86) < (v3 <= v2)));
+        a0[8] = (((a0[3] ? a0[13] : i6) + (74 * v3)) > ((83 ? i6 : i6) > (a1[3][9] < a0[15])));
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            v3 = (((i6 - 56) && (44 / 2)) > ((a0[13] || i7) == (i6 * v2)));
+            v2 = (((a1[1][1] / 8) ? (v0 ? 89 : v0) : (v2 * 2)) + ((63 >= a1[2][4]) == (a0[12] && v0)));
+            v2 = (((2 >= 76) < (a0[3] == i6)) >= ((v3 + a1[3][8]) > (v1 ? v1 : 90)));
+        }
+    }
+    a1[3][8] = (((v3 < 46) && (v1 + a0[10])) <= ((a0[12] > v1) ? (v2 != a1[3][14]) : (19 >= 89)));
+    if ((((a1[3][4] / 5) - (39 >= v1)) != ((v2 || a1[1][13]) % 2))) {
+        v3 = (((84 >= a1[2][15]) ? (v0 != 66) : (v1 / 9)) + ((v0 > 0) / 3));
+        v2 = (((v1 ? v2 : v1) % 5) ? ((v1 == v3) + (56 > v3)) : ((v1 == v2) / 6));
+        a0[8] = (((v1 + 14) > (v3 <= v0)) * ((19 / 1) < (32 * a1[0][8])));
+    } else {
+        a1[0][0] = (((v3 || 52) - (v1 > v0)) * ((20 ? 72 : v2) && (v3 + v2)));
+        v3 = (((v0 != 7) != (a0[5] > v3)) < ((v1 % 1) ? (v3 >= 98) : (a1[0][2] > a1[2][13])));
+        a1[2][1] = (((v2 < v1) && (23 ? 89 : a1[0][9])) && ((v3 == v3) == (74 == v2)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            a1[1][9] = (((v0 >= v2) + (38 / 5)) >= ((a1[1][10] && v3) ? (a0[1] == i8) : (v1 * v2)));
+            v3 = (((v3 && a1[2][12]) && (v1 - 62)) + ((93 < a0[2]) >= (v1 >= a1[2][14])));
+            for (int i9 = 0; i9 < 3; i9 = i9 + 1) {
+                a1[2][3] = (((v1 >= a0[3]) != (v3 >= v3)) ? ((v2 || a1[3][8]) < (v0 && i9)) : ((i8 != a1[3][8]) <= (i8 != v2)));
+                a0[4] = (((21 < 7) <= (77 - v1)) <= ((52 ? i8 : a1[2][1]) == (a1[1][9] + i9)));
+                v1 = (((i9 ? 10 : 87) > (a0[10] < i8)) * ((a1[0][3] > i9) > (31 + a0[14])));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    if ((((a1[3][4] && v1) / 5) == ((a1[3][9] - 35) % 3))) {
+        v1 = (((v1 && 56) != (19 || v2)) / 3);
+        v3 = (((a0[9] * a1[0][6]) == (90 % 6)) / 3);
+        v1 = (((v3 + v2) ? (v3 > v2) : (v0 && v3)) || ((56 % 7) + (v0 != v1)));
+    } else {
+        a1[0][4] = (((v0 > a1[2][10]) <= (v1 / 2)) - ((v1 ? 84 : v3) ? (66 < v1) : (46 || 23)));
+        v0 = (((v2 < v0) - (v0 ? 2 : v1)) * ((a1[1][14] != a1[3][0]) || (v0 != a1[1][1])));
+        v2 = (((v0 / 8) % 1) * ((v2 == v0) == (47 - 29)));
+    }
+    return (((45 != v2) - (69 + a0[15])) - ((v0 < v2) * (v1 % 5)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,2651 @@
+    .file 1 "build/bench/batch/f20.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 111 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 112 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 113 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 114 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $53, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $43, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $36, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $8, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 12 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 13 17
+    jmp .Lf0_7
+    .p2align 4,,10
+.Lf0_6:
+    .loc 1 14 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_11
+    jmp .Lf0_12
+.Lf0_11:
+    movslq -80(%rbp), %rax
+    jmp .Lf0_13
+.Lf0_12:
+    movq $59, %rax
+.Lf0_13:
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_14
+    jmp .Lf0_15
+.Lf0_14:
+    movq $13, %rax
+    jmp .Lf0_16
+.Lf0_15:
+    movq $82, %rax
+.Lf0_16:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_9
+.Lf0_8:
+    movq $6, %rax
+    push %rax
+    movq $13, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_10
+.Lf0_9:
+    movq $90, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    addq $45, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_10:
+    movl %eax, -64(%rbp)
+    .loc 1 15 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_17
+    jmp .Lf0_18
+.Lf0_17:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf0_19
+.Lf0_18:
+    movslq -60(%rbp), %rax
+.Lf0_19:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_20
+.Lf0_21:
+    movslq -4(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_20:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_23
+.Lf0_22:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf0_24
+.Lf0_23:
+    movq $91, %rax
+.Lf0_24:
+    push %rax
+    movq $2, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 16 21
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_25
+    jmp .Lf0_26
+.Lf0_25:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -24(%rbp), %rax
+.Lf0_27:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_30
+.Lf0_29:
+    movslq -16(%rbp), %rax
+.Lf0_30:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 17 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_5:
+.Lf0_7:
+    .loc 1 13 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_6
+.Lf0_4:
+    addq $0, %rsp
+    .loc 1 20 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_36
+    jmp .Lf0_35
+.Lf0_36:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_35:
+    movl %eax, -76(%rbp)
+    .loc 1 21 13
+    movslq -68(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $86, %rax
+    cmpq $28, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_37
+    jmp .Lf0_38
+.Lf0_37:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf0_39
+.Lf0_38:
+    movslq -16(%rbp), %rax
+.Lf0_39:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 22 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 23 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 26 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 27 9
+    .p2align 4,,10
+.Lf0_42:
+    .loc 1 28 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_45
+    jmp .Lf0_44
+.Lf0_45:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_44:
+    cmpq $70, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_43
+    jmp .Lf0_40
+.Lf0_43:
+    .loc 1 29 13
+    movslq -340(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $97, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 31 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 32 17
+    jmp .Lf0_49
+    .p2align 4,,10
+.Lf0_48:
+    .loc 1 33 21
+    movq $27, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $98, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_50
+    jmp .Lf0_46
+.Lf0_50:
+    .loc 1 34 21
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $41, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 35 21
+    movq $7, %rax
+    push %rax
+    movq $18, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_51
+    jmp .Lf0_52
+.Lf0_51:
+    movq $4, %rax
+    push %rax
+    movq $45, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_55
+    jmp .Lf0_54
+.Lf0_55:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_54:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_53
+.Lf0_52:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_57
+    jmp .Lf0_56
+.Lf0_57:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_56:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_53:
+    movl %eax, -12(%rbp)
+    .loc 1 36 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_61
+.Lf0_62:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_61:
+    cmpq $0, %rax
+    jne .Lf0_58
+    jmp .Lf0_59
+.Lf0_58:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_63
+    jmp .Lf0_64
+.Lf0_63:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_65
+.Lf0_64:
+    movslq -344(%rbp), %rax
+.Lf0_65:
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -36(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_60:
+    push %rax
+    movq $92, %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $2, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 37 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_47:
+.Lf0_49:
+    .loc 1 32 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_48
+.Lf0_46:
+    addq $0, %rsp
+    .loc 1 40 13
+    movslq -340(%rbp), %rax
+    addl -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imulq $73, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_66
+.Lf0_67:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_66:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 41 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_41:
+    .loc 1 42 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_42
+.Lf0_40:
+    addq $8, %rsp
+    .loc 1 44 5
+    movq $69, %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $37, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 45 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_73
+    .p2align 4,,10
+.Lf0_72:
+    .loc 1 46 9
+    movslq -20(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_74
+    jmp .Lf0_70
+.Lf0_74:
+    .loc 1 47 9
+    movq $30, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_76
+    jmp .Lf0_75
+.Lf0_76:
+    cmpl $87, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_75:
+    push %rax
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_78
+    jmp .Lf0_77
+.Lf0_78:
+    movq $63, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_77:
+    push %rax
+    movq $94, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 49 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 50 13
+    jmp .Lf0_82
+    .p2align 4,,10
+.Lf0_81:
+    .loc 1 51 17
+    movq $33, %rax
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_84
+.Lf0_83:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_85
+.Lf0_84:
+    movslq -4(%rbp), %rax
+.Lf0_85:
+    push %rax
+    movslq -44(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    addq $46, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_86
+    jmp .Lf0_87
+.Lf0_86:
+    movq $37, %rax
+    jmp .Lf0_88
+.Lf0_87:
+    movq $50, %rax
+.Lf0_88:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 52 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_91
+.Lf0_90:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf0_91:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_93
+    jmp .Lf0_92
+.Lf0_93:
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_95
+.Lf0_94:
+    movq $93, %rax
+    jmp .Lf0_96
+.Lf0_95:
+    movq $57, %rax
+.Lf0_96:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_92:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 53 17
+    movslq -12(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $22, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 54 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_80:
+.Lf0_82:
+    .loc 1 50 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_81
+.Lf0_79:
+    addq $0, %rsp
+    .loc 1 57 9
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_100
+.Lf0_99:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf0_101
+.Lf0_100:
+    movslq -340(%rbp), %rax
+.Lf0_101:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_103
+    jmp .Lf0_102
+.Lf0_103:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_102:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_71:
+    .loc 1 45 30
+    incl -340(%rbp)
+.Lf0_73:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_72
+.Lf0_70:
+    addq $8, %rsp
+    .loc 1 59 5
+    movq $5, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    subq $2, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $73, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_105
+    .loc 1 60 9
+    movq $61, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_107
+.Lf0_106:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_110
+    jmp .Lf0_109
+.Lf0_110:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_109:
+    jmp .Lf0_108
+.Lf0_107:
+    cmpl $82, -16(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_108:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 61 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_111
+    jmp .Lf0_112
+.Lf0_111:
+    movq $60, %rax
+    jmp .Lf0_113
+.Lf0_112:
+    movslq -36(%rbp), %rax
+.Lf0_113:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 62 9
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    subq $17, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $64, -28(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_115
+.Lf0_114:
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_116
+.Lf0_115:
+    cmpl $61, -12(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf0_116:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_104
+.Lf0_105:
+    .loc 1 64 9
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_118
+    jmp .Lf0_117
+.Lf0_118:
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_117:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_120
+    jmp .Lf0_119
+.Lf0_120:
+    movq $1, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_119:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 65 9
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_122
+    jmp .Lf0_121
+.Lf0_122:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_121:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_125
+.Lf0_124:
+    movslq -8(%rbp), %rax
+.Lf0_125:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    movslq -20(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 66 9
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+    push %rax
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_131
+    jmp .Lf0_130
+.Lf0_131:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_130:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_133
+    jmp .Lf0_132
+.Lf0_133:
+    movq $25, %rax
+    cmpq $75, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_132:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_104:
+    .loc 1 68 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_139
+    .p2align 4,,10
+.Lf0_138:
+    .loc 1 69 9
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_143
+    jmp .Lf0_144
+.Lf0_143:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_147
+    jmp .Lf0_146
+.Lf0_147:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_146:
+    jmp .Lf0_145
+.Lf0_144:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_145:
+    cmpq $0, %rax
+    jne .Lf0_140
+    jmp .Lf0_141
+.Lf0_140:
+    cmpl $4, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_149
+    jmp .Lf0_148
+.Lf0_149:
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_148:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_142:
+    movl %eax, -8(%rbp)
+    .loc 1 70 9
+    movq $74, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -28(%rbp), %rax
+    jmp .Lf0_152
+.Lf0_151:
+    movslq -340(%rbp), %rax
+.Lf0_152:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $83, %rax
+    cmpq $0, %rax
+    jne .Lf0_153
+    jmp .Lf0_154
+.Lf0_153:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_155
+.Lf0_154:
+    movslq -340(%rbp), %rax
+.Lf0_155:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -48(%rbp)
+    .loc 1 71 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_161
+    .p2align 4,,10
+.Lf0_160:
+    .loc 1 72 13
+    movslq -340(%rbp), %rax
+    subq $56, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_162
+.Lf0_163:
+    movq $2, %rax
+    push %rax
+    movq $44, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_162:
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_165
+    jmp .Lf0_164
+.Lf0_165:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_164:
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 73 13
+    movq $63, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_166
+.Lf0_167:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_166:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_171
+    jmp .Lf0_172
+.Lf0_171:
+    movq $89, %rax
+    jmp .Lf0_173
+.Lf0_172:
+    movslq -4(%rbp), %rax
+.Lf0_173:
+    jmp .Lf0_170
+.Lf0_169:
+    movslq -12(%rbp), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+.Lf0_170:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 74 13
+    movq $2, %rax
+    cmpq $76, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_175
+.Lf0_174:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_176
+.Lf0_175:
+    movq $90, %rax
+.Lf0_176:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_159:
+    .loc 1 71 34
+    incl -344(%rbp)
+.Lf0_161:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_160
+.Lf0_158:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_137:
+    .loc 1 68 30
+    incl -340(%rbp)
+.Lf0_139:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_138
+.Lf0_136:
+    addq $8, %rsp
+    .loc 1 77 5
+    cmpl $46, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    movslq -8(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_181
+.Lf0_180:
+    movq $19, %rax
+    cmpq $89, %rax
+    movq $0, %rax
+    setge %al
+.Lf0_181:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 78 5
+    movq $39, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_184
+    jmp .Lf0_183
+.Lf0_184:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_183:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_185
+    .loc 1 79 9
+    movq $3, %rax
+    push %rax
+    cmpl $0, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $84, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_186
+    jmp .Lf0_187
+.Lf0_186:
+    cmpl $66, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_188
+.Lf0_187:
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_188:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 80 9
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_192
+    jmp .Lf0_193
+.Lf0_192:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_194
+.Lf0_193:
+    movslq -8(%rbp), %rax
+.Lf0_194:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_189
+    jmp .Lf0_190
+.Lf0_189:
+    movq $56, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_191
+.Lf0_190:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_191:
+    movl %eax, -12(%rbp)
+    .loc 1 81 9
+    movq $1, %rax
+    push %rax
+    movq $19, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imulq $32, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $14, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_182
+.Lf0_185:
+    .loc 1 83 9
+    movq $20, %rax
+    cmpq $0, %rax
+    jne .Lf0_195
+    jmp .Lf0_196
+.Lf0_195:
+    movq $72, %rax
+    jmp .Lf0_197
+.Lf0_196:
+    movslq -12(%rbp), %rax
+.Lf0_197:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_201
+    jmp .Lf0_200
+.Lf0_201:
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_200:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 84 9
+    cmpl $7, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_203
+.Lf0_202:
+    cmpl $98, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_204
+.Lf0_203:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_204:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 85 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_205
+.Lf0_206:
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_207
+    jmp .Lf0_208
+.Lf0_207:
+    movq $89, %rax
+    jmp .Lf0_209
+.Lf0_208:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf0_209:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_205:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_211
+    jmp .Lf0_210
+.Lf0_211:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $74, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_210:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_182:
+    .loc 1 88 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 89 9
+    jmp .Lf0_215
+    .p2align 4,,10
+.Lf0_214:
+    .loc 1 90 13
+    movq $5, %rax
+    push %rax
+    movq $38, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_219
+.Lf0_220:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_219:
+    cmpq $0, %rax
+    jne .Lf0_216
+    jmp .Lf0_217
+.Lf0_216:
+    movslq -76(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_218
+.Lf0_217:
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_218:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 91 13
+    movq $93, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_222
+    jmp .Lf0_221
+.Lf0_222:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_221:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_224
+    jmp .Lf0_223
+.Lf0_224:
+    movslq -8(%rbp), %rax
+    subq $62, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_223:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 92 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_230
+    .p2align 4,,10
+.Lf0_229:
+    .loc 1 93 17
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_231
+    jmp .Lf0_232
+.Lf0_231:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_235
+    jmp .Lf0_234
+.Lf0_235:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_234:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_237
+    jmp .Lf0_236
+.Lf0_237:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_236:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_233
+.Lf0_232:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_233:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 94 17
+    movq $21, %rax
+    cmpq $7, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $77, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $52, %rax
+    cmpq $0, %rax
+    jne .Lf0_238
+    jmp .Lf0_239
+.Lf0_238:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_240
+.Lf0_239:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf0_240:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -64(%rbp)
+    .loc 1 95 17
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $31, %rax
+    addl -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_241
+    jmp .Lf0_242
+.Lf0_241:
+    movq $10, %rax
+    jmp .Lf0_243
+.Lf0_242:
+    movq $87, %rax
+.Lf0_243:
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_228:
+    .loc 1 92 38
+    incl -344(%rbp)
+.Lf0_230:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_229
+.Lf0_227:
+    addq $0, %rsp
+    .loc 1 97 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_213:
+.Lf0_215:
+    .loc 1 89 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_214
+.Lf0_212:
+    addq $8, %rsp
+    .loc 1 100 5
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_246
+    jmp .Lf0_245
+.Lf0_246:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_245:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    subq $35, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lf0_247
+    .loc 1 101 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_249
+    jmp .Lf0_248
+.Lf0_249:
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_248:
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_251
+    jmp .Lf0_250
+.Lf0_251:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_250:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 102 9
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $90, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 103 9
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_252
+    jmp .Lf0_253
+.Lf0_252:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_254
+.Lf0_253:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_256
+    jmp .Lf0_255
+.Lf0_256:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_255:
+.Lf0_254:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_258
+    jmp .Lf0_257
+.Lf0_258:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_257:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_244
+.Lf0_247:
+    .loc 1 105 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_262
+    jmp .Lf0_263
+.Lf0_262:
+    movq $84, %rax
+    jmp .Lf0_264
+.Lf0_263:
+    movslq -16(%rbp), %rax
+.Lf0_264:
+    cmpq $0, %rax
+    jne .Lf0_259
+    jmp .Lf0_260
+.Lf0_259:
+    movq $66, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_261
+.Lf0_260:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_266
+    jmp .Lf0_265
+.Lf0_266:
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_265:
+.Lf0_261:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 106 9
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_268
+    jmp .Lf0_267
+.Lf0_268:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_267:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_269
+    jmp .Lf0_270
+.Lf0_269:
+    movq $2, %rax
+    jmp .Lf0_271
+.Lf0_270:
+    movslq -8(%rbp), %rax
+.Lf0_271:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 107 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $47, %rax
+    subq $29, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_244:
+    .loc 1 109 5
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $69, %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
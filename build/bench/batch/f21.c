@@ -0,0 +1,241 @@
+int f0() {
+    int v0 = 89;
+    int v1 = 36;
+    int v2 = 96;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][2] = (((i0 + a0[10]) + (i0 / 2)) - ((v1 * a0[1]) % 5));
+            a1[0][3] = (((v3 > v0) > (a0[11] % 2)) > ((a1[3][3] != a0[0]) != (a1[1][5] - a1[1][4])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((v0 ? a0[8] : v1) ? (43 - a0[5]) : (v3 && v2)) - ((a0[13] < v3) != (a0[0] && v1)));
+                a1[0][4] = (((92 ? a1[2][1] : v3) + (55 ? a1[1][4] : a0[15])) * ((a0[8] ? 77 : v0) <= (a0[10] || v3)));
+                v1 = (((i1 >= a0[14]) <= (7 && v3)) == ((i0 - 51) + (i1 <= a0[2])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v2 = (((34 ? 38 : 22) + (42 && v0)) ? ((v1 >= v0) == (i2 != v2)) : ((i2 == v3) ? (i2 && 35) : (a1[2][11] >= 67)));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v3 = (((87 >= v0) == (v3 < a1[3][2])) > ((i2 > 56) == (v3 >= i3)));
+                v0 = (((i2 >= a0[9]) * (a0[8] ? a0[11] : 10)) > ((a1[1][1] * a1[3][12]) > (i2 + a1[3][1])));
+                v3 = (((i2 > a1[0][0]) == (i3 && a0[5])) * ((a1[1][9] || v1) * (a1[2][14] ? i3 : v1)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((v1 || v1) < (v0 > a0[0])) || ((55 > a1[2][2]) / 4));
+    }
+    if ((((v0 && v3) || (34 % 9)) ? ((a1[1][9] % 9) * (v3 - 41)) : ((v3 <= v1) ? (v1 && v3) : (a1[0][8] != v1)))) {
+        v0 = (((v2 > v3) > (v0 - v0)) != ((75 ? 72 : v1) % 1));
+        v1 = (((88 * v0) + (85 <= v0)) >= ((v2 - v2) + (a0[5] % 8)));
+        v2 = (((v2 % 9) && (a1[2][9] ? a1[0][3] : v1)) > ((a1[2][2] != v0) + (v0 > v2)));
+    } else {
+        v3 = (((a1[2][10] + a0[8]) || (v0 / 7)) < ((37 + a1[0][6]) && (v2 + v0)));
+        v0 = (((66 / 4) <= (a0[12] * v0)) >= ((v2 < a1[3][14]) >= (v3 / 6)));
+        v2 = (((v0 > 40) > (a0[4] < a0[13])) != ((v0 >= v0) ? (v2 - v2) : (v2 == a0[11])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v2 = (((v0 - 61) + (v3 ? 57 : 73)) ? ((a1[1][0] % 8) * (40 >= v1)) : ((35 + v0) ? (v3 / 6) : (v2 && v0)));
+            v2 = (((v0 + 55) < (v3 ? v3 : v0)) ? ((a1[0][8] + a1[0][9]) - (62 > 5)) : ((a0[10] ? a0[3] : a1[1][10]) / 5));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((88 ? v2 : i4) > 61) break;
+                v2 = (((a0[9] + a0[15]) * (20 || 73)) ? ((v0 / 6) != (v1 >= v1)) : ((a0[8] || 60) + (v0 < v2)));
+                v0 = (((v0 - 14) > (v2 && a0[12])) == ((a0[14] % 8) || (v2 + v1)));
+                v0 = (((24 % 5) > (a0[1] + i5)) != ((3 <= a1[0][6]) <= (v3 * i5)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 - v3) ? (49 != a1[1][12]) : (34 / 9)) * ((v1 ? 46 : a0[3]) <= (v1 ? 2 : a0[10])))) {
+        v3 = (((4 != 81) % 8) > ((v1 || a1[0][9]) && (v0 % 8)));
+        v1 = (((v2 - v2) == (v2 / 6)) ? ((v0 > 25) <= (v0 <= v1)) : ((v2 < v1) != (v2 == 73)));
+        a0[6] = (((v3 - 15) <= (15 > v3)) ? ((v0 / 7) / 4) : ((85 + v2) > (v3 == a0[7])));
+    } else {
+        v1 = (((v3 == v2) + (v1 ? v3 : a1[3][3])) ? ((v0 || v3) <= (55 && 84)) : ((a0[8] == 46) % 8));
+        v1 = (((v2 + 65) != (v2 + a1[0][13])) > ((a0[4] && v0) >= (v3 > v0)));
+        v0 = (((v1 ? v2 : a1[2][3]) / 7) < ((a0[8] <= 61) == (v3 * 27)));
+    }
+    if ((((49 && v0) < (v0 <= 76)) ? ((v0 && 94) && (v3 ? v0 : v2)) : ((v2 % 2) <= (v0 > a1[3][4])))) {
+        v2 = (((a1[0][10] > a0[6]) > (v1 <= a0[3])) < ((0 - a0[15]) / 3));
+        a1[2][11] = (((a0[2] * v2) * (a1[1][7] < a1[3][15])) + ((v1 >= v2) <= (a0[1] % 8)));
+        a0[9] = (((a1[1][0] - 92) != (25 / 5)) == ((v2 || v0) % 7));
+    } else {
+        v1 = (((v1 != 77) == (v1 > a0[4])) * ((v3 > 82) % 8));
+        v0 = (((v2 && v3) <= (v3 / 9)) % 7);
+        v1 = (((a1[2][15] > a0[11]) != (17 * v3)) / 6);
+    }
+    if ((((81 * a0[9]) < (v3 || v3)) % 2)) {
+        v3 = (((a0[6] * v2) >= (8 - 62)) <= ((v3 < a0[15]) > (62 / 9)));
+        v0 = (((v3 || v3) < (94 != 90)) != ((v1 * a1[2][7]) / 2));
+        a1[3][11] = (((a1[3][1] == 0) / 3) < ((1 || a0[2]) + (19 ? v3 : v0)));
+    } else {
+        v1 = (((a1[1][1] % 6) ? (v1 ? v0 : 38) : (v1 < 22)) == ((v0 || 92) % 9));
+        a1[0][11] = (((a1[2][7] + v2) && (v2 != v2)) * ((76 > 84) + (a0[2] && v0)));
+        v0 = (((v1 + 52) >= (a1[1][9] * a0[11])) == ((v0 < v3) == (32 > v1)));
+    }
+    v3 = (((v3 >= v3) > (v3 % 6)) != ((50 <= v3) <= (1 ? v1 : v3)));
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((74 && a1[1][11]) == (i7 - v2)) && ((28 % 5) / 7));
+                    v0 = (((a0[15] == v3) < (v1 ? 97 : i7)) && ((v2 ? i7 : 42) / 1));
+                    v0 = (((a0[9] > 69) + (13 <= v0)) ? ((56 && i7) && (i6 / 3)) : ((v1 * a1[0][13]) == (v3 / 4)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            v1 = (((20 / 4) > (v3 || a0[9])) && ((v1 > a0[9]) ? (43 < v3) : (a0[14] != v0)));
+            v3 = (((11 == i6) || (v1 ? a1[1][1] : a1[2][3])) > ((v2 ? 4 : v0) % 1));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[1][1] = (((v2 % 7) < (80 > v1)) * ((v2 - a0[5]) >= (33 > 44)));
+            v2 = (((24 - v1) ? (85 < 62) : (a1[3][0] != v2)) / 1);
+            {
+                int i9 = 0;
+                while (i9 < 6) {
+                    v1 = (((a0[6] >= a0[13]) != (i8 / 2)) ? ((v3 || i9) == (11 + v3)) : ((32 < v2) * (v1 && v3)));
+                    v1 = (((v0 == v3) > (a0[3] && 24)) || ((i8 < i8) >= (a1[2][5] - v2)));
+                    a0[3] = (((a0[15] < a0[2]) != (20 / 4)) > ((a0[10] - 6) / 7));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    return (((v3 < v0) != (v1 * 98)) % 6);
+}
+int f1() {
+    int v0 = 33;
+    int v1 = 56;
+    int v2 = 78;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][1] = (((v0 / 1) ? (v0 || v1) : (30 > 43)) ? ((26 > 89) == (a1[2][14] - v0)) : ((v2 < 23) == (v2 - 61)));
+            v2 = (((a1[2][12] == a0[7]) && (31 == a0[6])) == ((3 ? v2 : v2) > (v0 ? v2 : a1[0][11])));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v1 = (((19 && v0) - (i1 ? v0 : 42)) != ((a1[2][7] <= v3) / 7));
+                    v1 = (((v2 > a1[1][7]) / 7) > ((95 > 94) == (v3 - a0[15])));
+                    v0 = (((57 < a0[4]) ? (42 < v2) : (a0[2] % 4)) >= ((63 ? i0 : v3) * (i1 && 5)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    v0 = (((v2 < 41) / 4) ? ((v2 < v0) > (a0[15] % 4)) : ((a0[4] / 1) / 6));
+    if ((((71 >= a1[3][14]) != (v3 > v1)) || ((a0[7] != 20) == (v3 <= v3)))) {
+        a1[2][7] = (((v1 || v1) < (v3 <= a0[5])) < ((52 % 9) && (v1 * 98)));
+        v2 = (((34 && v1) || (v1 < 37)) || ((v2 <= a0[5]) ? (a1[3][15] ? v1 : 13) : (v3 ? v2 : a0[12])));
+        v1 = (((10 >= a0[15]) - (a0[0] * v1)) == ((v0 + v2) || (v0 % 1)));
+    } else {
+        a0[15] = (((v1 * 55) * (v0 + v2)) == ((a1[0][6] + 60) == (v0 != v1)));
+        v2 = (((v1 && a1[1][6]) > (v0 / 2)) != ((18 && v0) ? (v3 == v2) : (v2 && v3)));
+        v1 = (((92 >= v3) % 7) <= ((61 ? a0[0] : 4) || (a1[1][2] < 39)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((v1 / 1) > 69) break;
+        a0[2] = (((i2 <= v0) || (v3 % 2)) + ((v0 < a0[2]) + (v2 > i2)));
+        v3 = (((94 / 9) + (a1[1][4] % 6)) ? ((a1[0][0] || i2) / 9) : ((i2 ? 55 : i2) != (v2 % 3)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v1 = (((51 + a0[6]) * (27 >= v2)) || ((i3 == a0[3]) ? (v1 == i2) : (68 ? 16 : 73)));
+                a0[15] = (((v3 <= v2) / 3) ? ((24 || a1[3][9]) * (v3 != a0[8])) : ((v0 > v2) && (v3 || 73)));
+                a1[0][5] = (((i2 == v0) % 9) % 2);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((10 ? v2 : 51) <= (v2 != 57)) / 6)) {
+        v2 = (((v3 > 48) == (95 ? 96 : 13)) <= ((98 || a0[0]) ? (4 % 4) : (v1 + v3)));
+        v3 = (((23 * a1[2][8]) * (a0[6] == v3)) * ((a1[3][12] >= 22) - (v0 && a0[4])));
+        v3 = (((43 - v3) != (v3 ? v0 : v1)) <= ((10 == 65) || (13 - 77)));
+    } else {
+        v0 = (((v2 - v3) != (36 + a0[0])) ? ((a1[1][6] < a0[12]) ? (a1[2][14] >= v1) : (18 == v1)) : ((v3 - a0[8]) / 2));
+        v3 = (((v3 < v1) ? (v1 >= 95) : (v3 && v1)) < ((a1[3][13] ? 5 : v1) < (v2 - 29)));
+        a0[15] = (((a0[6] - v2) % 3) + ((58 > v1) && (v0 <= 35)));
+    }
+    a1[2][15] = (((41 <= a1[2][12]) / 8) < ((26 > a1[3][4]) ? (v0 ? 43 : v2) : (v3 > a0[9])));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            if ((v1 ? 90 : v2) > 67) break;
+            v3 = (((v3 <= i4) || (2 >= v2)) < ((v0 + v3) + (i4 > v2)));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v3 = (((a0[14] ? 47 : a0[3]) / 9) <= ((96 % 8) ? (60 > i5) : (i5 >= 31)));
+                    v2 = (((v3 <= i5) != (a1[0][3] ? v0 : v2)) ? ((i4 && a1[0][13]) ? (15 * a1[2][7]) : (a1[1][12] - 24)) : ((v1 >= v2) >= (v3 / 7)));
+                    a1[3][2] = (((32 != a0[13]) || (v3 ? i5 : v1)) && ((i5 * v2) + (a0[6] > v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[15] = (((98 || v1) >= (i4 || 62)) % 3);
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v2 && a0[15]) % 6) >= ((a1[0][8] < v1) + (a0[12] % 3)));
+    {
+        int i6 = 0;
+        do {
+            v3 = (((a0[12] && v2) || (v0 == 97)) ? ((47 >= v1) && (a1[2][1] <= 38)) : ((v1 == a0[0]) && (v1 - i6)));
+            {
+                int i7 = 0;
+                do {
+                    if ((a1[3][11] / 4) > 92) break;
+                    v3 = (((v3 != 18) >= (46 >= 15)) || ((i7 >= i7) % 5));
+                    v3 = (((a0[9] / 1) < (87 && 85)) || ((v2 * v3) > (a0[3] < i6)));
+                    v3 = (((38 && 4) ? (i6 + 35) : (v0 % 7)) ? ((i6 ? 21 : a1[1][3]) >= (a0[10] ? v1 : a0[9])) : ((i6 < 45) >= (v3 * 47)));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            v0 = (((v1 * i6) != (v2 - 16)) == ((a1[0][13] - 71) / 2));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((a0[0] * v3) > 52) break;
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((i9 ? 42 : v1) / 5) - ((43 < v2) > (v0 == v0)));
+                    v2 = (((80 / 9) != (93 > a1[0][1])) > ((95 ? i8 : v1) - (a1[0][15] != a1[1][1])));
+                    v0 = (((v0 / 2) ? (v0 < a1[3][3]) : (a0[15] * 22)) % 3);
+                    i9 = i9 + 1;
+                } while (i9 < 2);
+            }
+            v2 = (((v2 < v2) < (v0 ? a1[0][9] : v2)) || ((v3 + 76) || (43 % 3)));
+            v1 = (((v2 < i8) <= (i8 < a0[10])) + ((a0[13] ? v3 : 53) + (v2 <= a1[1][1])));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    return (((a1[2][15] + v0) % 6) > ((v2 ? v1 : v3) + (v2 != a0[1])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
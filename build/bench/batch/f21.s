@@ -0,0 +1,5294 @@
+    .file 1 "build/bench/batch/f21.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 236 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 237 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 238 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 239 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 240 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $89, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $36, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $96, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $44, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 12 13
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 13 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_9
+    .p2align 4,,10
+.Lf0_8:
+    .loc 1 14 17
+    movslq -28(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_11
+    jmp .Lf0_10
+.Lf0_11:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_10:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_15
+    jmp .Lf0_16
+.Lf0_15:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_17
+.Lf0_16:
+    movslq -8(%rbp), %rax
+.Lf0_17:
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_13
+.Lf0_12:
+    movq $43, %rax
+    subl -60(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_14
+.Lf0_13:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_19
+    jmp .Lf0_18
+.Lf0_19:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_18:
+.Lf0_14:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 15 17
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_21
+.Lf0_20:
+    movq $77, %rax
+    jmp .Lf0_22
+.Lf0_21:
+    movslq -4(%rbp), %rax
+.Lf0_22:
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_24
+    jmp .Lf0_23
+.Lf0_24:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_23:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $55, %rax
+    cmpq $0, %rax
+    jne .Lf0_25
+    jmp .Lf0_26
+.Lf0_25:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -20(%rbp), %rax
+.Lf0_27:
+    push %rax
+    movq $92, %rax
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_29
+.Lf0_28:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf0_30
+.Lf0_29:
+    movslq -16(%rbp), %rax
+.Lf0_30:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 16 17
+    movslq -344(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subq $51, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_7:
+    .loc 1 13 38
+    incl -344(%rbp)
+.Lf0_9:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_8
+.Lf0_6:
+    addq $0, %rsp
+    .loc 1 18 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 19 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_38
+    .p2align 4,,10
+.Lf0_37:
+    .loc 1 22 9
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_43
+    jmp .Lf0_42
+.Lf0_43:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_42:
+    push %rax
+    movq $34, %rax
+    cmpq $0, %rax
+    jne .Lf0_44
+    jmp .Lf0_45
+.Lf0_44:
+    movq $38, %rax
+    jmp .Lf0_46
+.Lf0_45:
+    movq $22, %rax
+.Lf0_46:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_41
+.Lf0_40:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_47
+    jmp .Lf0_48
+.Lf0_47:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_51
+    jmp .Lf0_50
+.Lf0_51:
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_50:
+    jmp .Lf0_49
+.Lf0_48:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setge %al
+.Lf0_49:
+.Lf0_41:
+    movl %eax, -12(%rbp)
+    .loc 1 24 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 25 13
+    jmp .Lf0_55
+    .p2align 4,,10
+.Lf0_54:
+    .loc 1 26 17
+    movq $87, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $56, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 27 17
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_56
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -36(%rbp), %rax
+    jmp .Lf0_58
+.Lf0_57:
+    movq $10, %rax
+.Lf0_58:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 28 17
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -8(%rbp), %rax
+.Lf0_61:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_63
+    jmp .Lf0_62
+.Lf0_63:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_62:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_65
+    jmp .Lf0_64
+.Lf0_65:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_64:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 29 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_53:
+.Lf0_55:
+    .loc 1 25 20
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_54
+.Lf0_52:
+    addq $0, %rsp
+    .loc 1 32 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_67
+    jmp .Lf0_66
+.Lf0_67:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_66:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_69
+    jmp .Lf0_68
+.Lf0_69:
+    movq $4, %rax
+    push %rax
+    movq $55, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_68:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_36:
+    .loc 1 21 30
+    incl -340(%rbp)
+.Lf0_38:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_37
+.Lf0_35:
+    addq $8, %rsp
+    .loc 1 34 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_74
+.Lf0_75:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_74:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_77
+    jmp .Lf0_76
+.Lf0_77:
+    movq $9, %rax
+    push %rax
+    movq $34, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_76:
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_72
+.Lf0_71:
+    movslq -16(%rbp), %rax
+    subq $41, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_79
+.Lf0_78:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_82
+    jmp .Lf0_81
+.Lf0_82:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_81:
+    jmp .Lf0_80
+.Lf0_79:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_80:
+.Lf0_73:
+    cmpq $0, %rax
+    je .Lf0_83
+    .loc 1 35 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $75, %rax
+    cmpq $0, %rax
+    jne .Lf0_84
+    jmp .Lf0_85
+.Lf0_84:
+    movq $72, %rax
+    jmp .Lf0_86
+.Lf0_85:
+    movslq -8(%rbp), %rax
+.Lf0_86:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 36 9
+    movq $85, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $88, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 37 9
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_87
+.Lf0_88:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf0_91
+.Lf0_90:
+    movslq -8(%rbp), %rax
+.Lf0_91:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_87:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_70
+.Lf0_83:
+    .loc 1 39 9
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_93
+    jmp .Lf0_92
+.Lf0_93:
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_92:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    addq $37, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_95
+    jmp .Lf0_94
+.Lf0_95:
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_94:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 40 9
+    movq $4, %rax
+    push %rax
+    movq $66, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 41 9
+    cmpl $40, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_96
+    jmp .Lf0_97
+.Lf0_96:
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_98
+.Lf0_97:
+    movslq -12(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_70:
+    .loc 1 44 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 45 9
+    jmp .Lf0_102
+    .p2align 4,,10
+.Lf0_101:
+    .loc 1 46 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_107
+.Lf0_106:
+    movq $57, %rax
+    jmp .Lf0_108
+.Lf0_107:
+    movq $73, %rax
+.Lf0_108:
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $61, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_104
+.Lf0_103:
+    movq $40, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_105
+.Lf0_104:
+    movq $35, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_110
+.Lf0_109:
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_111
+.Lf0_110:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_112
+.Lf0_113:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_112:
+.Lf0_111:
+.Lf0_105:
+    movl %eax, -12(%rbp)
+    .loc 1 47 13
+    movslq -4(%rbp), %rax
+    addq $55, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_118
+.Lf0_117:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_119
+.Lf0_118:
+    movslq -4(%rbp), %rax
+.Lf0_119:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_115
+.Lf0_114:
+    movq $62, %rax
+    cmpq $5, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_116
+.Lf0_115:
+    movq $5, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_120
+    jmp .Lf0_121
+.Lf0_120:
+    movslq -68(%rbp), %rax
+    jmp .Lf0_122
+.Lf0_121:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf0_122:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_116:
+    movl %eax, -12(%rbp)
+    .loc 1 48 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_128
+    .p2align 4,,10
+.Lf0_127:
+    .loc 1 49 17
+    movq $88, %rax
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_131
+.Lf0_130:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -340(%rbp), %rax
+.Lf0_132:
+    cmpq $61, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_129
+    jmp .Lf0_125
+.Lf0_129:
+    .loc 1 50 17
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_137
+    jmp .Lf0_136
+.Lf0_137:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_136:
+    push %rax
+    movslq -44(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_135
+.Lf0_134:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_139
+    jmp .Lf0_138
+.Lf0_139:
+    movq $60, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_138:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_135:
+    movl %eax, -12(%rbp)
+    .loc 1 51 17
+    movslq -4(%rbp), %rax
+    subq $14, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_140
+.Lf0_141:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_140:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_143
+    jmp .Lf0_142
+.Lf0_143:
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_142:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 52 17
+    movq $5, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_126:
+    .loc 1 48 38
+    incl -344(%rbp)
+.Lf0_128:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_127
+.Lf0_125:
+    addq $0, %rsp
+    .loc 1 54 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_100:
+.Lf0_102:
+    .loc 1 45 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_101
+.Lf0_99:
+    addq $8, %rsp
+    .loc 1 57 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_145
+    jmp .Lf0_146
+.Lf0_145:
+    movq $46, %rax
+    jmp .Lf0_147
+.Lf0_146:
+    movslq -68(%rbp), %rax
+.Lf0_147:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_149
+.Lf0_148:
+    movq $2, %rax
+    jmp .Lf0_150
+.Lf0_149:
+    movslq -40(%rbp), %rax
+.Lf0_150:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_151
+    jmp .Lf0_152
+.Lf0_151:
+    movq $49, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_153
+.Lf0_152:
+    movq $9, %rax
+    push %rax
+    movq $34, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_153:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_154
+    .loc 1 58 9
+    movq $8, %rax
+    push %rax
+    movq $4, %rax
+    cmpq $81, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_156
+    jmp .Lf0_155
+.Lf0_156:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_155:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_158
+    jmp .Lf0_157
+.Lf0_158:
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_157:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 59 9
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_159
+    jmp .Lf0_160
+.Lf0_159:
+    cmpl $25, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_161
+.Lf0_160:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $73, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_161:
+    movl %eax, -8(%rbp)
+    .loc 1 60 9
+    movslq -16(%rbp), %rax
+    subq $15, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $15, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_162
+    jmp .Lf0_163
+.Lf0_162:
+    movq $4, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_164
+.Lf0_163:
+    movq $85, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_164:
+    movl %eax, -56(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_144
+.Lf0_154:
+    .loc 1 62 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_170
+.Lf0_169:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf0_170:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_165
+    jmp .Lf0_166
+.Lf0_165:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    push %rax
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_173
+.Lf0_174:
+    movq $84, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_173:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_167
+.Lf0_166:
+    movq $8, %rax
+    push %rax
+    cmpl $46, -48(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_167:
+    movl %eax, -8(%rbp)
+    .loc 1 63 9
+    movslq -12(%rbp), %rax
+    addq $65, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_176
+    jmp .Lf0_175
+.Lf0_176:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_175:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 64 9
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_177
+    jmp .Lf0_178
+.Lf0_177:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_179
+.Lf0_178:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf0_179:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $61, -48(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $27, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_144:
+    .loc 1 66 5
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_184
+.Lf0_185:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_184:
+    push %rax
+    cmpl $76, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_181
+    jmp .Lf0_182
+.Lf0_181:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_187
+    jmp .Lf0_186
+.Lf0_187:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_186:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_189
+    jmp .Lf0_188
+.Lf0_189:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_190
+    jmp .Lf0_191
+.Lf0_190:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_192
+.Lf0_191:
+    movslq -12(%rbp), %rax
+.Lf0_192:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_188:
+    jmp .Lf0_183
+.Lf0_182:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_183:
+    cmpq $0, %rax
+    je .Lf0_193
+    .loc 1 67 9
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $0, %rax
+    subl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 68 9
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -72(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 69 9
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    subq $92, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $25, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_195
+    jmp .Lf0_194
+.Lf0_195:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_194:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_180
+.Lf0_193:
+    .loc 1 71 9
+    movq $8, %rax
+    push %rax
+    cmpl $82, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $77, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 72 9
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_197
+    jmp .Lf0_196
+.Lf0_197:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_196:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 73 9
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $17, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_180:
+    .loc 1 75 5
+    movq $2, %rax
+    push %rax
+    movq $81, %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_200
+    jmp .Lf0_199
+.Lf0_200:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_201
+    .loc 1 76 9
+    movslq -56(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    subq $62, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $62, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 77 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_203
+    jmp .Lf0_202
+.Lf0_203:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_202:
+    push %rax
+    movq $94, %rax
+    cmpq $90, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 78 9
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf0_204
+    jmp .Lf0_205
+.Lf0_204:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_206
+.Lf0_205:
+    movslq -4(%rbp), %rax
+.Lf0_206:
+    push %rax
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_208
+    jmp .Lf0_207
+.Lf0_208:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_207:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_198
+.Lf0_201:
+    .loc 1 80 9
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_210
+.Lf0_209:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_213
+.Lf0_212:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_214
+.Lf0_213:
+    movq $38, %rax
+.Lf0_214:
+    jmp .Lf0_211
+.Lf0_210:
+    cmpl $22, -8(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf0_211:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_216
+    jmp .Lf0_215
+.Lf0_216:
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_215:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 81 9
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_218
+    jmp .Lf0_217
+.Lf0_218:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_217:
+    push %rax
+    movq $76, %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_219
+.Lf0_220:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_219:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 82 9
+    movslq -8(%rbp), %rax
+    addq $52, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $32, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_198:
+    .loc 1 84 5
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $50, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    cmpq $0, %rax
+    jne .Lf0_221
+    jmp .Lf0_222
+.Lf0_221:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_223
+.Lf0_222:
+    movslq -16(%rbp), %rax
+.Lf0_223:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 86 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 87 9
+    .p2align 4,,10
+.Lf0_226:
+    .loc 1 89 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 90 17
+    .p2align 4,,10
+.Lf0_229:
+    .loc 1 91 21
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_231
+    jmp .Lf0_230
+.Lf0_231:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_230:
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_233
+    jmp .Lf0_232
+.Lf0_233:
+    movq $7, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $28, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_232:
+    movl %eax, -12(%rbp)
+    .loc 1 92 21
+    movslq -20(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_234
+    jmp .Lf0_235
+.Lf0_234:
+    movq $97, %rax
+    jmp .Lf0_236
+.Lf0_235:
+    movslq -344(%rbp), %rax
+.Lf0_236:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_238
+    jmp .Lf0_237
+.Lf0_238:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_239
+    jmp .Lf0_240
+.Lf0_239:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_241
+.Lf0_240:
+    movq $42, %rax
+.Lf0_241:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_237:
+    movl %eax, -4(%rbp)
+    .loc 1 93 21
+    movq $13, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $69, -44(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_242
+    jmp .Lf0_243
+.Lf0_242:
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_246
+    jmp .Lf0_245
+.Lf0_246:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_245:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_248
+    jmp .Lf0_247
+.Lf0_248:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_247:
+    jmp .Lf0_244
+.Lf0_243:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_244:
+    movl %eax, -4(%rbp)
+    .loc 1 94 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_228:
+    .loc 1 95 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_229
+.Lf0_227:
+    addq $0, %rsp
+    .loc 1 97 13
+    movq $4, %rax
+    push %rax
+    movq $20, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_250
+    jmp .Lf0_249
+.Lf0_250:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_249:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_252
+    jmp .Lf0_251
+.Lf0_252:
+    movslq -8(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_253
+    jmp .Lf0_254
+.Lf0_253:
+    movq $43, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_255
+.Lf0_254:
+    movslq -24(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_255:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_251:
+    movl %eax, -8(%rbp)
+    .loc 1 98 13
+    movq $11, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_257
+    jmp .Lf0_256
+.Lf0_257:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_258
+    jmp .Lf0_259
+.Lf0_258:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf0_260
+.Lf0_259:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf0_260:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_256:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_261
+    jmp .Lf0_262
+.Lf0_261:
+    movq $4, %rax
+    jmp .Lf0_263
+.Lf0_262:
+    movslq -4(%rbp), %rax
+.Lf0_263:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 99 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_225:
+    .loc 1 100 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_226
+.Lf0_224:
+    addq $8, %rsp
+    .loc 1 103 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 104 9
+    .p2align 4,,10
+.Lf0_266:
+    .loc 1 105 13
+    movslq -12(%rbp), %rax
+    subl -60(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $33, %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 106 13
+    movq $1, %rax
+    push %rax
+    movq $24, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_267
+    jmp .Lf0_268
+.Lf0_267:
+    movq $85, %rax
+    cmpq $62, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_269
+.Lf0_268:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_269:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 108 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 109 17
+    jmp .Lf0_273
+    .p2align 4,,10
+.Lf0_272:
+    .loc 1 110 21
+    movslq -56(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_274
+    jmp .Lf0_275
+.Lf0_274:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_278
+    jmp .Lf0_277
+.Lf0_278:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_277:
+    push %rax
+    movq $11, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_276
+.Lf0_275:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_280
+    jmp .Lf0_279
+.Lf0_280:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_279:
+    push %rax
+    movq $32, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_276:
+    movl %eax, -8(%rbp)
+    .loc 1 111 21
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_282
+    jmp .Lf0_281
+.Lf0_282:
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_281:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_284
+    jmp .Lf0_283
+.Lf0_284:
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_283:
+    movl %eax, -8(%rbp)
+    .loc 1 112 21
+    movslq -20(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $20, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    subq $6, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -68(%rbp)
+    .loc 1 113 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_271:
+.Lf0_273:
+    .loc 1 109 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_272
+.Lf0_270:
+    addq $0, %rsp
+    .loc 1 116 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_265:
+    .loc 1 117 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_266
+.Lf0_264:
+    addq $8, %rsp
+    .loc 1 119 5
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $98, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 121 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 122 5
+    subq $8, %rsp
+    movq $33, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 123 5
+    movq $56, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 124 5
+    subq $8, %rsp
+    movq $78, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 125 5
+    movq $9, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 126 5
+    subq $64, %rsp
+    .loc 1 127 5
+    subq $256, %rsp
+    .loc 1 129 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 130 9
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 131 13
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_7
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_11
+    jmp .Lf1_10
+.Lf1_11:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_10:
+    jmp .Lf1_9
+.Lf1_8:
+    movq $30, %rax
+    cmpq $43, %rax
+    movq $0, %rax
+    setg %al
+.Lf1_9:
+    cmpq $0, %rax
+    jne .Lf1_4
+    jmp .Lf1_5
+.Lf1_4:
+    movq $26, %rax
+    cmpq $89, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_6
+.Lf1_5:
+    cmpl $23, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $61, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_6:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 132 13
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_13
+    jmp .Lf1_12
+.Lf1_13:
+    movq $31, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_12:
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    jne .Lf1_14
+    jmp .Lf1_15
+.Lf1_14:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_16
+.Lf1_15:
+    movslq -12(%rbp), %rax
+.Lf1_16:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_17
+    jmp .Lf1_18
+.Lf1_17:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_19
+.Lf1_18:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_19:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 134 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 135 17
+    jmp .Lf1_23
+    .p2align 4,,10
+.Lf1_22:
+    .loc 1 136 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_24
+    jmp .Lf1_25
+.Lf1_24:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_26
+.Lf1_25:
+    movq $42, %rax
+.Lf1_26:
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_28
+    jmp .Lf1_27
+.Lf1_28:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_27:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 137 21
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $95, %rax
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 138 21
+    movq $57, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_29
+    jmp .Lf1_30
+.Lf1_29:
+    movq $42, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_31
+.Lf1_30:
+    movq $4, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_31:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_33
+    jmp .Lf1_32
+.Lf1_33:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_32:
+    push %rax
+    movq $63, %rax
+    cmpq $0, %rax
+    jne .Lf1_34
+    jmp .Lf1_35
+.Lf1_34:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_36
+.Lf1_35:
+    movslq -16(%rbp), %rax
+.Lf1_36:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 139 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_21:
+.Lf1_23:
+    .loc 1 135 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_22
+.Lf1_20:
+    addq $0, %rsp
+    .loc 1 142 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+    .loc 1 143 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 145 5
+    movq $4, %rax
+    push %rax
+    cmpl $41, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_37
+    jmp .Lf1_38
+.Lf1_37:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_39
+.Lf1_38:
+    movq $6, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_39:
+    movl %eax, -4(%rbp)
+    .loc 1 146 5
+    movq $71, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_42
+    jmp .Lf1_41
+.Lf1_42:
+    cmpl $20, -52(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_41:
+    cmpq $0, %rax
+    je .Lf1_43
+    .loc 1 147 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_45
+    jmp .Lf1_44
+.Lf1_45:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_44:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $52, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_46
+.Lf1_47:
+    movslq -8(%rbp), %rax
+    imulq $98, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_46:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 148 9
+    movq $34, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_49
+    jmp .Lf1_48
+.Lf1_49:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_48:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    cmpl $37, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_53
+    jmp .Lf1_52
+.Lf1_53:
+    movslq -12(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_54
+    jmp .Lf1_55
+.Lf1_54:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_57
+    jmp .Lf1_58
+.Lf1_57:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_59
+.Lf1_58:
+    movq $13, %rax
+.Lf1_59:
+    jmp .Lf1_56
+.Lf1_55:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_60
+    jmp .Lf1_61
+.Lf1_60:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_62
+.Lf1_61:
+    movslq -32(%rbp), %rax
+.Lf1_62:
+.Lf1_56:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_52:
+    movl %eax, -12(%rbp)
+    .loc 1 149 9
+    movslq -80(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $10, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_64
+    jmp .Lf1_63
+.Lf1_64:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_40
+.Lf1_43:
+    .loc 1 151 9
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $55, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    addq $60, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -20(%rbp)
+    .loc 1 152 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_65
+.Lf1_66:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_65:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $18, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_71
+    jmp .Lf1_70
+.Lf1_71:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_70:
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_69
+.Lf1_68:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_72
+.Lf1_73:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_72:
+.Lf1_69:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 153 9
+    movq $7, %rax
+    push %rax
+    movq $92, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $61, %rax
+    cmpq $0, %rax
+    jne .Lf1_74
+    jmp .Lf1_75
+.Lf1_74:
+    movslq -80(%rbp), %rax
+    jmp .Lf1_76
+.Lf1_75:
+    movq $4, %rax
+.Lf1_76:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_78
+    jmp .Lf1_77
+.Lf1_78:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $39, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_77:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_40:
+    .loc 1 155 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_84
+    .p2align 4,,10
+.Lf1_83:
+    .loc 1 156 9
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $69, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_85
+    jmp .Lf1_81
+.Lf1_85:
+    .loc 1 157 9
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_87
+    jmp .Lf1_86
+.Lf1_87:
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_86:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 158 9
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $94, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_88
+    jmp .Lf1_89
+.Lf1_88:
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_92
+    jmp .Lf1_91
+.Lf1_92:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_91:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_90
+.Lf1_89:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_93
+    jmp .Lf1_94
+.Lf1_93:
+    movq $55, %rax
+    jmp .Lf1_95
+.Lf1_94:
+    movslq -340(%rbp), %rax
+.Lf1_95:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_90:
+    movl %eax, -16(%rbp)
+    .loc 1 160 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 161 13
+    jmp .Lf1_99
+    .p2align 4,,10
+.Lf1_98:
+    .loc 1 162 17
+    movq $27, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $51, %rax
+    addl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_101
+    jmp .Lf1_100
+.Lf1_101:
+    movslq -344(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_102
+    jmp .Lf1_103
+.Lf1_102:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_104
+.Lf1_103:
+    movq $68, %rax
+    cmpq $0, %rax
+    jne .Lf1_105
+    jmp .Lf1_106
+.Lf1_105:
+    movq $16, %rax
+    jmp .Lf1_107
+.Lf1_106:
+    movq $73, %rax
+.Lf1_107:
+.Lf1_104:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_100:
+    movl %eax, -8(%rbp)
+    .loc 1 163 17
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_108
+    jmp .Lf1_109
+.Lf1_108:
+    movslq -16(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_112
+    jmp .Lf1_111
+.Lf1_112:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_111:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_110
+.Lf1_109:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_116
+    jmp .Lf1_115
+.Lf1_116:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_115:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+.Lf1_110:
+    movl %eax, -20(%rbp)
+    .loc 1 164 17
+    movq $2, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 165 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_97:
+.Lf1_99:
+    .loc 1 161 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_98
+.Lf1_96:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_82:
+    .loc 1 155 30
+    incl -340(%rbp)
+.Lf1_84:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_83
+.Lf1_81:
+    addq $8, %rsp
+    .loc 1 169 5
+    movq $6, %rax
+    push %rax
+    movq $10, %rax
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_119
+.Lf1_118:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_120
+.Lf1_119:
+    movq $51, %rax
+.Lf1_120:
+    push %rax
+    cmpl $57, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_121
+    .loc 1 170 9
+    cmpl $48, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $95, %rax
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_123
+.Lf1_122:
+    movq $96, %rax
+    jmp .Lf1_124
+.Lf1_123:
+    movq $13, %rax
+.Lf1_124:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_129
+    jmp .Lf1_128
+.Lf1_129:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_128:
+    cmpq $0, %rax
+    jne .Lf1_125
+    jmp .Lf1_126
+.Lf1_125:
+    movq $4, %rax
+    push %rax
+    movq $4, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_127
+.Lf1_126:
+    movslq -8(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_127:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 171 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_131
+    jmp .Lf1_130
+.Lf1_131:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_130:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    imulq $23, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 172 9
+    movq $43, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_133
+.Lf1_132:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_134
+.Lf1_133:
+    movslq -8(%rbp), %rax
+.Lf1_134:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $10, %rax
+    cmpq $65, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_136
+    jmp .Lf1_135
+.Lf1_136:
+    movq $13, %rax
+    subq $77, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_135:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_117
+.Lf1_121:
+    .loc 1 174 9
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $36, %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_137
+    jmp .Lf1_138
+.Lf1_137:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_141
+.Lf1_140:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_142
+.Lf1_141:
+    movq $18, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_142:
+    jmp .Lf1_139
+.Lf1_138:
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -48(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_139:
+    movl %eax, -4(%rbp)
+    .loc 1 175 9
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_143
+    jmp .Lf1_144
+.Lf1_143:
+    cmpl $95, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_145
+.Lf1_144:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_147
+    jmp .Lf1_146
+.Lf1_147:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_146:
+.Lf1_145:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_148
+    jmp .Lf1_149
+.Lf1_148:
+    movq $5, %rax
+    jmp .Lf1_150
+.Lf1_149:
+    movslq -8(%rbp), %rax
+.Lf1_150:
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $29, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 176 9
+    movq $58, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_152
+    jmp .Lf1_151
+.Lf1_152:
+    cmpl $35, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_151:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+.Lf1_117:
+    .loc 1 178 5
+    movq $8, %rax
+    push %rax
+    movq $41, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $26, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_154
+.Lf1_153:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    movq $43, %rax
+    jmp .Lf1_158
+.Lf1_157:
+    movslq -12(%rbp), %rax
+.Lf1_158:
+    jmp .Lf1_155
+.Lf1_154:
+    movslq -16(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_155:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 180 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 181 9
+    jmp .Lf1_162
+    .p2align 4,,10
+.Lf1_161:
+    .loc 1 182 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_164
+    jmp .Lf1_165
+.Lf1_164:
+    movq $90, %rax
+    jmp .Lf1_166
+.Lf1_165:
+    movslq -12(%rbp), %rax
+.Lf1_166:
+    cmpq $67, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_163
+    jmp .Lf1_159
+.Lf1_163:
+    .loc 1 183 13
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_168
+    jmp .Lf1_167
+.Lf1_168:
+    movq $2, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_167:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 185 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 186 17
+    jmp .Lf1_172
+    .p2align 4,,10
+.Lf1_171:
+    .loc 1 187 21
+    movq $9, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_173
+    jmp .Lf1_174
+.Lf1_173:
+    movq $47, %rax
+    jmp .Lf1_175
+.Lf1_174:
+    movslq -68(%rbp), %rax
+.Lf1_175:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_176
+    jmp .Lf1_177
+.Lf1_176:
+    movq $60, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_178
+.Lf1_177:
+    cmpl $31, -344(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf1_178:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 188 21
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_182
+    jmp .Lf1_183
+.Lf1_182:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_184
+.Lf1_183:
+    movslq -12(%rbp), %rax
+.Lf1_184:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_179
+    jmp .Lf1_180
+.Lf1_179:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_189
+    jmp .Lf1_188
+.Lf1_189:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_188:
+    cmpq $0, %rax
+    jne .Lf1_185
+    jmp .Lf1_186
+.Lf1_185:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    imulq $15, %rax
+    movslq %eax, %rax
+    jmp .Lf1_187
+.Lf1_186:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    subq $24, %rax
+    movslq %eax, %rax
+.Lf1_187:
+    jmp .Lf1_181
+.Lf1_180:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_181:
+    movl %eax, -12(%rbp)
+    .loc 1 189 21
+    movq $32, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_191
+    jmp .Lf1_190
+.Lf1_191:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_192
+    jmp .Lf1_193
+.Lf1_192:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_194
+.Lf1_193:
+    movslq -8(%rbp), %rax
+.Lf1_194:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_190:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_196
+    jmp .Lf1_195
+.Lf1_196:
+    movslq -56(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_195:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 190 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_170:
+.Lf1_172:
+    .loc 1 186 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_171
+.Lf1_169:
+    addq $0, %rsp
+    .loc 1 193 13
+    movq $3, %rax
+    push %rax
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_198
+    jmp .Lf1_197
+.Lf1_198:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_197:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_200
+    jmp .Lf1_199
+.Lf1_200:
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 194 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_160:
+.Lf1_162:
+    .loc 1 181 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_161
+.Lf1_159:
+    addq $8, %rsp
+    .loc 1 197 5
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_202
+    jmp .Lf1_201
+.Lf1_202:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_201:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 199 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 200 9
+    .p2align 4,,10
+.Lf1_205:
+    .loc 1 201 13
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_210
+    jmp .Lf1_209
+.Lf1_210:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_209:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_212
+    jmp .Lf1_211
+.Lf1_212:
+    cmpl $97, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_211:
+    cmpq $0, %rax
+    jne .Lf1_206
+    jmp .Lf1_207
+.Lf1_206:
+    movq $47, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_214
+    jmp .Lf1_213
+.Lf1_214:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $38, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_213:
+    jmp .Lf1_208
+.Lf1_207:
+    movslq -8(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_215
+.Lf1_216:
+    movslq -8(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_215:
+.Lf1_208:
+    movl %eax, -16(%rbp)
+    .loc 1 203 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 204 17
+    .p2align 4,,10
+.Lf1_219:
+    .loc 1 205 21
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $92, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_220
+    jmp .Lf1_217
+.Lf1_220:
+    .loc 1 206 21
+    cmpl $18, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $46, %rax
+    cmpq $15, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_222
+    jmp .Lf1_221
+.Lf1_222:
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_221:
+    movl %eax, -16(%rbp)
+    .loc 1 207 21
+    movq $1, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_224
+    jmp .Lf1_223
+.Lf1_224:
+    movq $85, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_223:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_226
+    jmp .Lf1_225
+.Lf1_226:
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_225:
+    movl %eax, -16(%rbp)
+    .loc 1 208 21
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_234
+    jmp .Lf1_233
+.Lf1_234:
+    movq $4, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_233:
+    cmpq $0, %rax
+    jne .Lf1_230
+    jmp .Lf1_231
+.Lf1_230:
+    movslq -340(%rbp), %rax
+    addq $35, %rax
+    movslq %eax, %rax
+    jmp .Lf1_232
+.Lf1_231:
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_232:
+    cmpq $0, %rax
+    jne .Lf1_227
+    jmp .Lf1_228
+.Lf1_227:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_235
+    jmp .Lf1_236
+.Lf1_235:
+    movq $21, %rax
+    jmp .Lf1_237
+.Lf1_236:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf1_237:
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_238
+    jmp .Lf1_239
+.Lf1_238:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_240
+.Lf1_239:
+    movslq -44(%rbp), %rax
+.Lf1_240:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_229
+.Lf1_228:
+    cmpl $45, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $47, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_229:
+    movl %eax, -16(%rbp)
+    .loc 1 209 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_218:
+    .loc 1 210 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_219
+.Lf1_217:
+    addq $0, %rsp
+    .loc 1 212 13
+    movslq -8(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $16, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    subq $71, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 213 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_204:
+    .loc 1 214 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_205
+.Lf1_203:
+    addq $8, %rsp
+    .loc 1 217 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 218 9
+    .p2align 4,,10
+.Lf1_243:
+    .loc 1 219 13
+    movslq -80(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $52, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_244
+    jmp .Lf1_241
+.Lf1_244:
+    .loc 1 221 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 222 17
+    .p2align 4,,10
+.Lf1_247:
+    .loc 1 223 21
+    movq $43, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_248
+    jmp .Lf1_249
+.Lf1_248:
+    movq $42, %rax
+    jmp .Lf1_250
+.Lf1_249:
+    movslq -8(%rbp), %rax
+.Lf1_250:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 224 21
+    movq $9, %rax
+    push %rax
+    movq $80, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $93, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $95, %rax
+    cmpq $0, %rax
+    jne .Lf1_251
+    jmp .Lf1_252
+.Lf1_251:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_253
+.Lf1_252:
+    movslq -8(%rbp), %rax
+.Lf1_253:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 225 21
+    movq $3, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_254
+    jmp .Lf1_255
+.Lf1_254:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_256
+.Lf1_255:
+    movslq -20(%rbp), %rax
+    imulq $22, %rax
+    movslq %eax, %rax
+.Lf1_256:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 226 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_246:
+    .loc 1 227 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_247
+.Lf1_245:
+    addq $0, %rsp
+    .loc 1 229 13
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_257
+    jmp .Lf1_258
+.Lf1_257:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf1_259
+.Lf1_258:
+    movslq -12(%rbp), %rax
+.Lf1_259:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_261
+    jmp .Lf1_260
+.Lf1_261:
+    movslq -16(%rbp), %rax
+    addq $76, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_263
+    jmp .Lf1_262
+.Lf1_263:
+    movq $3, %rax
+    push %rax
+    movq $43, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_262:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_260:
+    movl %eax, -12(%rbp)
+    .loc 1 230 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_264
+    jmp .Lf1_265
+.Lf1_264:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_266
+.Lf1_265:
+    movq $53, %rax
+.Lf1_266:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 231 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_242:
+    .loc 1 232 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_243
+.Lf1_241:
+    addq $8, %rsp
+    .loc 1 234 5
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_267
+    jmp .Lf1_268
+.Lf1_267:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_269
+.Lf1_268:
+    movslq -16(%rbp), %rax
+.Lf1_269:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
@@ -0,0 +1,347 @@
+int f0() {
+    int v0 = 91;
+    int v1 = 46;
+    int v2 = 16;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[11] < v3) && (v2 >= v2)) ? ((48 == 21) == (v1 + a1[3][15])) : ((27 <= v1) > (v1 || a0[11])))) {
+        a0[3] = (((v3 ? 94 : 57) + (33 + 42)) - ((7 >= v3) ? (v1 && v2) : (v2 >= 78)));
+        v0 = (((v3 != a0[0]) < (v1 && 10)) - ((19 > v0) && (v2 != v2)));
+        v2 = (((v0 >= v1) * (v3 ? v1 : v3)) ? ((30 / 8) && (v1 <= v1)) : ((v1 <= v3) || (59 >= 91)));
+    } else {
+        v3 = (((v2 ? 67 : v2) ? (89 <= v1) : (v2 ? v2 : v1)) <= ((v2 <= 37) || (v3 != v2)));
+        v2 = (((a1[1][0] == a1[2][11]) % 4) + ((v3 - v2) >= (v0 && a1[0][1])));
+        v3 = (((v1 + v1) <= (17 + a1[0][8])) == ((v0 - a1[3][6]) * (a0[0] || a0[3])));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((i0 && 4) > 81) break;
+            v3 = (((a1[2][3] ? a0[12] : i0) == (a1[0][1] - v3)) * ((v0 == 32) && (86 >= v3)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((v3 ? 61 : i0) ? (93 + v1) : (v2 >= v0)) > ((29 > a1[0][4]) || (a0[0] > 2)));
+                v0 = (((v2 >= i1) <= (i0 != a1[2][10])) || ((a0[15] ? i1 : 12) + (i0 >= a1[1][6])));
+                a1[3][9] = (((65 < i1) ? (3 ? v3 : v2) : (v1 - v1)) ? ((8 || i1) != (i0 / 2)) : ((i1 + v2) || (a1[3][13] && a0[14])));
+            }
+            v1 = (((66 + a1[3][2]) ? (71 * a0[13]) : (a1[1][12] <= v1)) >= ((a1[1][10] || v1) >= (a1[2][7] + 81)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((20 > v1) > 98) break;
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                if ((i2 < a0[7]) > 78) break;
+                a0[6] = (((a1[2][8] - i3) < (v0 - v3)) / 1);
+                v2 = (((a0[4] / 3) < (v2 + v0)) < ((i3 - i3) && (92 && a1[2][1])));
+                v0 = (((i2 <= 39) ? (a1[1][7] % 2) : (a1[0][0] * v2)) || ((a1[2][11] <= v1) < (95 != 20)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((v2 >= v3) && (19 ? v3 : a1[0][12])) % 4);
+        v2 = (((i2 == 19) * (a0[7] >= a0[3])) ? ((i2 ? v1 : a1[1][12]) ? (76 % 8) : (v3 % 9)) : ((14 - v2) + (a0[3] + a0[8])));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((48 == v3) - (v0 == 52)) != ((a0[2] != a1[0][13]) - (53 / 8)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                a1[1][1] = (((a1[1][10] || v1) >= (v1 * v3)) && ((a0[14] && v3) * (80 > 27)));
+                v1 = (((v2 >= 56) != (72 - v0)) != ((i5 <= a0[9]) - (v2 + a0[15])));
+                v2 = (((v0 ? a1[1][0] : a0[7]) + (a1[1][13] <= 71)) != ((v2 * a1[0][4]) - (a0[7] / 8)));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((v0 <= v3) ? (73 > v2) : (a1[2][8] || v0)) >= ((19 ? a0[2] : v0) && (v1 >= 80)));
+    }
+    v1 = (((v3 < 50) == (v0 >= 24)) > ((a0[9] != v2) <= (v3 / 8)));
+    {
+        int i6 = 0;
+        do {
+            if ((a0[5] >= a0[11]) > 60) break;
+            a0[11] = (((33 % 8) * (a1[0][3] >= a1[2][15])) % 1);
+            v2 = (((39 >= v1) < (v1 > v3)) <= ((v3 <= i6) <= (v2 ? 67 : 12)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v3 = (((a1[3][0] ? 49 : i7) ? (a1[3][12] + i6) : (a0[12] != 70)) ? ((v1 && v1) && (v0 - a1[1][3])) : ((38 ? a1[1][15] : v3) || (v2 ? a0[8] : 71)));
+                    a0[3] = (((a0[5] / 5) - (v2 > v1)) == ((13 + a0[13]) <= (v1 < v1)));
+                    v3 = (((i6 && i7) && (37 * v0)) == ((a1[0][9] >= v0) ? (v3 > a0[4]) : (v0 != a1[2][12])));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    if ((((61 - a0[1]) > (v3 == v0)) / 6)) {
+        v3 = (((v2 ? a0[1] : a0[13]) ? (v1 * v0) : (v3 < a1[3][14])) >= ((71 ? 39 : v3) >= (a1[1][1] > a1[3][12])));
+        v0 = (((v2 + v2) + (a0[6] + 87)) - ((v0 && 19) == (v3 % 8)));
+        a0[7] = (((68 - v0) ? (v0 * a1[3][12]) : (66 / 4)) >= ((43 >= 60) + (v0 ? v0 : v1)));
+    } else {
+        a1[1][10] = (((v1 ? v3 : 96) / 8) < ((a1[1][8] >= v1) < (a1[0][11] * a1[2][9])));
+        a0[1] = (((a0[12] < v1) - (66 * a0[14])) == ((v2 == v2) <= (10 > v0)));
+        v0 = (((a0[9] != v0) && (v3 && v0)) - ((v2 || v2) - (74 % 1)));
+    }
+    if ((((v1 * 30) * (v0 >= v0)) % 5)) {
+        a0[0] = (((v0 || v2) != (v3 >= a0[5])) || ((a1[1][7] == v2) >= (v0 / 7)));
+        v1 = (((79 && 43) + (a1[0][11] ? v1 : v2)) % 3);
+        a0[12] = (((v3 > v1) / 9) + ((v3 == a0[6]) >= (a0[6] != a1[1][6])));
+    } else {
+        v3 = (((v2 == v2) >= (v1 >= 76)) == ((v3 ? 59 : a0[7]) + (v3 < v2)));
+        v2 = (((52 < a1[1][9]) * (a0[15] == v0)) / 8);
+        v0 = (((8 / 8) ? (a0[15] ? 7 : a0[5]) : (32 >= v1)) - ((21 >= v0) % 5));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            v0 = (((v3 % 7) && (a0[10] || v3)) - ((0 <= i8) % 3));
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    v1 = (((i8 <= v1) + (i8 != 91)) != ((v1 || i9) > (a0[14] / 9)));
+                    v2 = (((v0 / 5) % 9) ? ((26 ? a0[13] : a0[6]) - (v3 ? 86 : 70)) : ((73 % 2) - (i8 / 5)));
+                    v0 = (((6 ? 71 : a0[1]) != (v3 * 29)) && ((a0[4] && a1[1][10]) >= (a1[1][3] || a1[3][4])));
+                    i9 = i9 + 1;
+                }
+            }
+            a1[3][9] = (((v2 >= i8) >= (a1[1][12] - v0)) * ((v2 != v2) > (i8 < v3)));
+            i8 = i8 + 1;
+        }
+    }
+    v2 = (((a1[3][1] >= v0) / 8) ? ((a1[3][5] - v3) < (v0 ? a0[8] : v3)) : ((a0[11] - a0[10]) && (30 ? v1 : v3)));
+    return (((a0[0] == 19) == (v3 + v1)) == ((v3 - v3) > (v1 % 6)));
+}
+int f1() {
+    int v0 = 6;
+    int v1 = 98;
+    int v2 = 93;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][13] == 47) * (a0[15] + v2)) % 4)) {
+        v0 = (((a0[4] ? v1 : 75) < (44 >= v3)) > ((a0[6] < v0) < (53 ? a0[4] : v3)));
+        a0[10] = (((a1[3][1] > v0) >= (v3 || v3)) % 8);
+        v3 = (((v1 || 50) ? (v0 > 63) : (v1 || v3)) != ((v3 == 72) <= (70 && v1)));
+    } else {
+        v1 = (((v2 <= 24) % 4) ? ((a0[8] % 2) * (v1 % 3)) : ((26 >= v2) + (57 ? a0[10] : v2)));
+        v1 = (((a0[9] - a1[3][6]) >= (v2 && 45)) - ((41 % 4) * (v3 >= 81)));
+        v3 = (((a1[2][3] + 8) > (a1[0][12] || v1)) + ((84 / 2) / 2));
+    }
+    v2 = (((v1 ? a1[3][2] : 27) || (v2 < v0)) < ((v2 ? 71 : v3) <= (16 < 17)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v1 = (((74 && i0) || (a1[3][11] && v2)) % 7);
+            v3 = (((a0[5] ? a0[13] : a0[2]) > (69 == v2)) > ((a0[7] + v3) * (23 >= 47)));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((i1 / 1) + (26 && a0[3])) < ((a1[1][8] >= v2) >= (a0[2] * i1)));
+                    v1 = (((v0 * 10) || (a1[1][5] > a1[1][2])) ? ((i0 <= a0[2]) < (i1 <= v0)) : ((i1 * v1) + (v0 - 66)));
+                    v1 = (((i1 < i1) ? (v3 || i0) : (a1[0][0] - a0[0])) && ((a0[3] && 8) > (i1 != v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((i2 * a0[6]) == (a0[4] >= v3)) || ((i2 <= 46) <= (v1 != v1)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((79 < 21) < (v1 - a1[1][3])) / 8);
+                    v2 = (((v2 >= v0) == (v3 - a0[15])) == ((23 <= v2) - (v2 % 5)));
+                    v2 = (((v1 && v3) - (i3 ? v1 : 8)) ? ((v2 && v2) != (i3 ? a1[0][12] : v2)) : ((v2 ? 52 : 80) != (34 <= 77)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a0[3] = (((52 + a0[14]) / 2) <= ((a1[3][0] - i2) != (v1 && 67)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((a0[10] <= a1[3][3]) + (v3 || 30)) > ((v1 + 9) * (v2 && v1)))) {
+        a0[11] = (((56 < v3) >= (v3 + a0[10])) == ((v2 % 8) && (a0[3] != v1)));
+        v2 = (((v2 ? v1 : v1) / 5) != ((v3 <= a1[0][1]) != (a1[1][6] == a1[0][14])));
+        a0[5] = (((v1 / 9) && (a0[6] && 8)) != ((v0 ? v0 : 3) || (a1[2][2] / 4)));
+    } else {
+        v2 = (((a1[2][6] + 60) >= (71 - 40)) / 8);
+        v1 = (((v1 + v1) || (v3 ? 92 : v2)) >= ((v1 < a0[7]) == (v3 >= v1)));
+        v0 = (((a0[12] < 16) > (12 <= a1[0][2])) == ((a1[2][7] % 2) && (a0[10] * v3)));
+    }
+    a0[1] = (((a1[2][7] ? v2 : v0) + (6 * v2)) * ((v1 > a1[3][7]) != (36 ? v1 : v3)));
+    if ((((47 || 48) ? (86 && v2) : (v2 <= a1[2][11])) % 7)) {
+        v1 = (((v1 < v3) != (v0 - 7)) && ((v0 <= 68) ? (v2 < v3) : (a0[8] && a0[3])));
+        v0 = (((v0 / 7) - (v2 && v0)) ? ((a0[11] > v3) != (v0 < a0[9])) : ((a1[0][5] && v2) + (a1[0][1] + a1[2][6])));
+        a1[1][4] = (((75 != v3) && (a1[1][5] + a1[1][1])) ? ((v1 % 1) ? (a0[14] >= a1[2][1]) : (v2 || 27)) : ((v1 / 3) / 4));
+    } else {
+        v1 = (((44 && v0) ? (v0 + v0) : (v2 <= a1[1][12])) % 3);
+        a0[12] = (((v1 || 32) == (v0 - 65)) >= ((v3 <= 53) == (a1[3][0] == v3)));
+        v2 = (((67 && v1) && (v1 > a1[2][1])) > ((a1[1][12] <= a0[14]) >= (a0[5] >= a0[15])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            if ((v2 <= v3) > 66) break;
+            a1[2][8] = (((a1[1][12] > v2) ? (v3 <= i4) : (a0[12] % 4)) * ((i4 == v0) <= (54 > v1)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v3 = (((v0 <= 87) ? (48 > a1[2][5]) : (v0 > a0[13])) - ((40 > 64) % 4));
+                v1 = (((i5 ? 57 : a0[14]) ? (40 >= v0) : (i5 >= a0[6])) >= ((v2 && a1[2][5]) % 2));
+                a0[5] = (((v3 <= v3) > (15 ? v3 : v2)) * ((16 - 2) ? (v2 != a1[0][0]) : (78 || i5)));
+            }
+            v1 = (((5 == a0[8]) ? (i4 * a0[15]) : (v3 % 5)) ? ((v1 == a1[1][14]) - (v3 * v0)) : ((17 ? 38 : 91) / 2));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 != v1) != (v0 > v3)) - ((v1 != v0) && (v0 && v2)))) {
+        v2 = (((v2 == v2) || (92 != v2)) ? ((v1 == 0) < (v1 >= 70)) : ((v2 * v3) < (v1 + 93)));
+        v1 = (((49 < v3) != (a1[1][9] + v3)) != ((11 ? v3 : 44) < (v1 / 8)));
+        v0 = (((a1[1][10] || a1[1][0]) <= (22 && v0)) ? ((76 != v2) || (4 > v1)) : ((47 % 4) > (89 < a0[7])));
+    } else {
+        v1 = (((v0 == v0) ? (23 - v1) : (v3 != v3)) >= ((a1[3][0] <= a0[8]) != (v2 && v3)));
+        v1 = (((9 < 88) < (3 || v2)) ? ((a0[11] + a1[1][0]) - (58 - v3)) : ((a1[3][12] || v2) != (v0 <= a0[13])));
+        v0 = (((v1 != a0[3]) ? (v1 || 58) : (92 ? v0 : 60)) && ((a1[1][15] <= v2) && (24 ? v1 : v1)));
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        if ((v1 <= v2) > 67) break;
+        v3 = (((i6 || 14) && (v2 * a0[14])) + ((v3 || a1[3][8]) <= (i6 / 8)));
+        {
+            int i7 = 0;
+            do {
+                if ((53 == 80) > 92) break;
+                v0 = (((a1[1][12] >= v3) - (v1 < a1[3][4])) ? ((i6 > a0[2]) % 2) : ((a1[3][12] || 73) / 6));
+                a0[6] = (((v1 / 9) <= (a1[1][8] + i6)) * ((81 - a0[14]) == (23 ? v2 : v0)));
+                a0[10] = (((a1[1][4] % 6) == (i6 || a0[11])) == ((v3 * 63) ? (v1 <= 46) : (51 || a1[3][8])));
+                i7 = i7 + 1;
+            } while (i7 < 3);
+        }
+        v1 = (((i6 < v2) + (a0[3] % 8)) / 3);
+    }
+    return (((v1 % 5) - (v3 == v0)) || ((v2 ? a0[15] : 32) / 1));
+}
+int f2() {
+    int v0 = 74;
+    int v1 = 70;
+    int v2 = 19;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v2 = (((a1[3][2] <= v3) % 2) < ((a1[0][2] > v2) % 3));
+                v2 = (((i0 != 34) <= (v2 * a1[0][10])) ? ((1 / 9) ? (v3 >= 83) : (i1 <= v3)) : ((v2 % 6) % 7));
+                v2 = (((i1 <= 39) ? (v3 / 5) : (21 * a0[11])) + ((75 != v2) != (v2 < i0)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v1 = (((88 / 2) - (v1 == i0)) + ((v2 < 0) ? (a1[2][13] % 2) : (42 > a1[2][15])));
+        v1 = (((v0 != 67) ? (66 == v1) : (v0 >= v3)) != ((9 ? v2 : v1) > (a1[2][12] == 77)));
+    }
+    v1 = (((67 * 49) ? (42 * v2) : (v2 ? 3 : v0)) < ((87 > a1[3][3]) > (25 + 37)));
+    {
+        int i2 = 0;
+        do {
+            if ((74 > 73) > 61) break;
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v3 = (((v1 * 0) > (a0[5] ? v2 : 41)) && ((v3 && i3) <= (a0[11] == i2)));
+                    v2 = (((11 % 3) / 6) / 6);
+                    v3 = (((v0 * 82) && (a1[3][10] && a0[5])) <= ((v0 % 4) > (v0 ? v1 : a1[0][2])));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((65 == a1[1][3]) - (v0 ? a0[13] : 69)) == ((a0[0] - 18) % 5));
+            a1[2][5] = (((a0[13] ? v3 : v1) < (49 * v0)) >= ((v1 == 62) <= (v2 >= v2)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((a1[3][14] <= a0[5]) > 93) break;
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            a0[6] = (((v1 >= a1[2][2]) - (a1[2][10] <= v0)) < ((v2 && a0[13]) ? (78 < 72) : (v0 >= v3)));
+            v3 = (((i4 + v1) ? (v3 + v1) : (i4 % 2)) < ((a1[0][6] || a1[2][11]) != (v1 + a0[15])));
+            v0 = (((a0[12] ? v3 : 75) >= (v0 || 0)) + ((v2 != a1[3][10]) == (a0[11] * 34)));
+        }
+        v2 = (((i4 % 9) <= (63 ? 61 : a1[1][0])) < ((i4 / 6) <= (v1 - v3)));
+        v0 = (((9 / 3) * (v1 ? 31 : v2)) ? ((v2 ? v2 : a0[13]) == (v1 <= v0)) : ((v2 * v0) != (62 != 46)));
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        if ((v3 >= v2) > 95) break;
+        a0[2] = (((v2 / 7) ? (v2 ? a0[13] : v0) : (45 > a1[0][14])) / 8);
+        {
+            int i7 = 0;
+            while (i7 < 5) {
+                a1[2][3] = (((i6 / 6) ? (i7 == 76) : (a0[0] != 20)) % 9);
+                v2 = (((a1[0][0] > v0) - (76 == v2)) > ((v2 != a0[1]) / 2));
+                v0 = (((a0[3] * 96) || (i7 % 1)) > ((82 <= v2) > (a1[1][5] % 7)));
+                i7 = i7 + 1;
+            }
+        }
+        a0[4] = (((v0 < a0[7]) && (83 != v0)) % 8);
+    }
+    if ((((v0 - v3) + (v1 && v1)) > ((v0 / 3) < (95 <= a0[1])))) {
+        a0[3] = (((v1 % 8) > (v3 ? v0 : v0)) + ((a0[7] && v2) ? (v2 != v1) : (a0[14] - v0)));
+        v0 = (((21 / 9) == (v1 <= v1)) % 6);
+        v1 = (((a0[4] <= v2) < (v2 == v1)) != ((v0 * v3) * (v0 || v3)));
+    } else {
+        v0 = (((v1 != 27) + (v1 + v0)) || ((22 < a1[3][4]) && (v2 ? v2 : v3)));
+        a1[3][1] = (((v0 + 71) ? (v2 - a1[2][14]) : (88 ? a0[8] : v1)) == ((a0[6] && 48) > (a0[7] != 93)));
+        v3 = (((v3 == v2) || (v0 / 5)) <= ((a1[3][6] <= v0) + (a1[0][5] / 2)));
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        if ((a1[0][0] == a0[1]) > 94) break;
+        v3 = (((v2 <= v2) % 8) % 7);
+        {
+            int i9 = 0;
+            while (i9 < 2) {
+                v2 = (((v0 * v0) || (87 > i9)) != ((i8 / 5) || (a0[10] - a0[8])));
+                v0 = (((v2 % 9) / 5) == ((a1[2][7] / 7) + (v0 == 92)));
+                a0[6] = (((a1[1][8] > i8) <= (v2 && v1)) * ((i8 * a1[2][7]) % 1));
+                i9 = i9 + 1;
+            }
+        }
+        a0[0] = (((a0[1] || a0[0]) - (5 >= 15)) == ((v1 % 4) >= (12 && v3)));
+    }
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        a1[3][10] = (((27 > v1) * (v0 - 96)) % 7);
+        v1 = (((v3 ? v2 : v1) / 5) + ((a1[0][0] * v2) == (i10 != 56)));
+        {
+            int i11 = 0;
+            while (i11 < 3) {
+                a0[15] = (((a1[0][13] == v1) ? (i11 ? a0[15] : 24) : (a0[1] < a1[0][9])) - ((a1[3][1] ? 93 : a1[2][1]) * (v1 || v0)));
+                a1[3][6] = (((45 ? a0[11] : i10) - (i11 / 1)) == ((45 * v1) == (38 || v2)));
+                v0 = (((26 <= 51) % 1) < ((a1[3][10] ? v3 : i10) != (i11 && a1[2][1])));
+                i11 = i11 + 1;
+            }
+        }
+    }
+    {
+        int i12 = 0;
+        do {
+            a0[3] = (((v0 / 3) && (a1[0][3] != 84)) && ((v3 / 1) / 5));
+            a0[5] = (((v1 ? a1[3][11] : a1[1][5]) != (v3 || a1[0][7])) || ((21 > a0[14]) / 4));
+            for (int i13 = 0; i13 < 4; i13 = i13 + 1) {
+                v0 = (((v3 - a0[12]) > (v0 * a0[14])) / 8);
+                v3 = (((i12 - v3) - (a0[6] * a1[3][3])) <= ((v3 != a0[8]) <= (35 < v3)));
+                v2 = (((v1 / 5) <= (i12 != 25)) ? ((39 > v2) ? (32 * v0) : (83 == v0)) : ((42 || a0[8]) ? (v0 && 80) : (v2 >= i12)));
+            }
+            i12 = i12 + 1;
+        } while (i12 < 4);
+    }
+    v3 = (((v2 % 2) != (17 && v3)) != ((v3 + 5) + (a1[3][14] > a0[10])));
+    return (((v2 < v0) < (a1[3][1] * v2)) ? ((36 * v3) == (v2 != a0[6])) : ((v1 / 3) >= (v3 == a0[14])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
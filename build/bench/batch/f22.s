@@ -0,0 +1,7785 @@
+    .file 1 "build/bench/batch/f22.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 341 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 342 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 343 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 344 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 345 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 346 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $91, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $46, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $16, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $97, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    movslq -36(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_6
+    jmp .Lf0_5
+.Lf0_6:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_5:
+    cmpq $0, %rax
+    jne .Lf0_2
+    jmp .Lf0_3
+.Lf0_2:
+    movq $48, %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_4
+.Lf0_3:
+    movq $27, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_4:
+    cmpq $0, %rax
+    je .Lf0_9
+    .loc 1 9 9
+    movq $7, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_10
+    jmp .Lf0_11
+.Lf0_10:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_14
+    jmp .Lf0_13
+.Lf0_14:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_13:
+    jmp .Lf0_12
+.Lf0_11:
+    cmpl $78, -12(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_12:
+    push %rax
+    movq $33, %rax
+    addq $42, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_15
+    jmp .Lf0_16
+.Lf0_15:
+    movq $94, %rax
+    jmp .Lf0_17
+.Lf0_16:
+    movq $57, %rax
+.Lf0_17:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 10 9
+    movq $19, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_19
+    jmp .Lf0_18
+.Lf0_19:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_18:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_20
+.Lf0_21:
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_20:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 11 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_25
+    jmp .Lf0_26
+.Lf0_25:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -16(%rbp), %rax
+.Lf0_27:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_23
+.Lf0_22:
+    movq $8, %rax
+    push %rax
+    movq $30, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_29
+    jmp .Lf0_28
+.Lf0_29:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_28:
+    jmp .Lf0_24
+.Lf0_23:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_31
+    jmp .Lf0_30
+.Lf0_31:
+    movq $59, %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_30:
+.Lf0_24:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_1
+.Lf0_9:
+    .loc 1 13 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_35
+    jmp .Lf0_36
+.Lf0_35:
+    movq $67, %rax
+    jmp .Lf0_37
+.Lf0_36:
+    movslq -12(%rbp), %rax
+.Lf0_37:
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_33
+.Lf0_32:
+    movq $89, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_34
+.Lf0_33:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_38
+    jmp .Lf0_39
+.Lf0_38:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -8(%rbp), %rax
+.Lf0_40:
+.Lf0_34:
+    push %rax
+    cmpl $37, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_42
+    jmp .Lf0_41
+.Lf0_42:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_41:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 14 9
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_44
+    jmp .Lf0_43
+.Lf0_44:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_43:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 15 9
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    addq $17, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_46
+    jmp .Lf0_45
+.Lf0_46:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_45:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_1:
+    .loc 1 18 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 19 9
+    .p2align 4,,10
+.Lf0_49:
+    .loc 1 20 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_52
+    jmp .Lf0_51
+.Lf0_52:
+    movq $4, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_51:
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_50
+    jmp .Lf0_47
+.Lf0_50:
+    .loc 1 21 13
+    cmpl $32, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_54
+    jmp .Lf0_53
+.Lf0_54:
+    movq $86, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_53:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_56
+.Lf0_55:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -340(%rbp), %rax
+.Lf0_57:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 22 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_63
+    .p2align 4,,10
+.Lf0_62:
+    .loc 1 23 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_68
+.Lf0_67:
+    movq $61, %rax
+    jmp .Lf0_69
+.Lf0_68:
+    movslq -340(%rbp), %rax
+.Lf0_69:
+    cmpq $0, %rax
+    jne .Lf0_64
+    jmp .Lf0_65
+.Lf0_64:
+    movq $93, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_66
+.Lf0_65:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_66:
+    push %rax
+    movq $29, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_71
+    jmp .Lf0_70
+.Lf0_71:
+    cmpl $2, -80(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_70:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 24 17
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_73
+    jmp .Lf0_72
+.Lf0_73:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_74
+    jmp .Lf0_75
+.Lf0_74:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_76
+.Lf0_75:
+    movq $12, %rax
+.Lf0_76:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_72:
+    movl %eax, -4(%rbp)
+    .loc 1 25 17
+    movq $65, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_80
+    jmp .Lf0_81
+.Lf0_80:
+    movq $3, %rax
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_84
+.Lf0_83:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_85
+.Lf0_84:
+    movslq -12(%rbp), %rax
+.Lf0_85:
+    jmp .Lf0_82
+.Lf0_81:
+    movslq -8(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_82:
+    cmpq $0, %rax
+    jne .Lf0_77
+    jmp .Lf0_78
+.Lf0_77:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_87
+    jmp .Lf0_86
+.Lf0_87:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_86:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_79
+.Lf0_78:
+    movslq -344(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_89
+    jmp .Lf0_88
+.Lf0_89:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_90
+.Lf0_91:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_90:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_88:
+.Lf0_79:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_61:
+    .loc 1 22 38
+    incl -344(%rbp)
+.Lf0_63:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_62
+.Lf0_60:
+    addq $0, %rsp
+    .loc 1 27 13
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    addq $66, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_93
+.Lf0_92:
+    movq $71, %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_94
+.Lf0_93:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_94:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_96
+    jmp .Lf0_95
+.Lf0_96:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_95:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    addq $81, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 28 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_48:
+    .loc 1 29 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_49
+.Lf0_47:
+    addq $8, %rsp
+    .loc 1 31 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_102
+    .p2align 4,,10
+.Lf0_101:
+    .loc 1 32 9
+    movq $20, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $98, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_103
+    jmp .Lf0_99
+.Lf0_103:
+    .loc 1 34 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 35 13
+    jmp .Lf0_107
+    .p2align 4,,10
+.Lf0_106:
+    .loc 1 36 17
+    movslq -340(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $78, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_108
+    jmp .Lf0_104
+.Lf0_108:
+    .loc 1 37 17
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 38 17
+    movq $3, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_110
+    jmp .Lf0_109
+.Lf0_110:
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_112
+    jmp .Lf0_111
+.Lf0_112:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_111:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_109:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 39 17
+    cmpl $39, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_114
+.Lf0_113:
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_115
+.Lf0_114:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_115:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $95, %rax
+    cmpq $20, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    movl %eax, -4(%rbp)
+    .loc 1 40 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_105:
+.Lf0_107:
+    .loc 1 35 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_106
+.Lf0_104:
+    addq $0, %rsp
+    .loc 1 43 9
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_118
+.Lf0_119:
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf0_120
+    jmp .Lf0_121
+.Lf0_120:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_122
+.Lf0_121:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf0_122:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_118:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 44 9
+    movslq -52(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $19, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_130
+.Lf0_129:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_131
+.Lf0_130:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf0_131:
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_127
+.Lf0_126:
+    movq $8, %rax
+    push %rax
+    movq $76, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_128
+.Lf0_127:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_128:
+    jmp .Lf0_125
+.Lf0_124:
+    movslq -68(%rbp), %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $14, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_125:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_100:
+    .loc 1 31 30
+    incl -340(%rbp)
+.Lf0_102:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_101
+.Lf0_99:
+    addq $8, %rsp
+    .loc 1 46 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_137
+    .p2align 4,,10
+.Lf0_136:
+    .loc 1 47 9
+    cmpl $52, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $48, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 49 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 50 13
+    jmp .Lf0_141
+    .p2align 4,,10
+.Lf0_140:
+    .loc 1 51 17
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_143
+    jmp .Lf0_142
+.Lf0_143:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_142:
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    movq $80, %rax
+    cmpq $27, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_147
+    jmp .Lf0_146
+.Lf0_147:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_146:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 52 17
+    cmpl $56, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $72, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 53 17
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $71, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_149
+.Lf0_148:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf0_150
+.Lf0_149:
+    movslq -52(%rbp), %rax
+.Lf0_150:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 54 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_139:
+.Lf0_141:
+    .loc 1 50 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_140
+.Lf0_138:
+    addq $0, %rsp
+    .loc 1 57 9
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_151
+    jmp .Lf0_152
+.Lf0_151:
+    movq $73, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_153
+.Lf0_152:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_155
+    jmp .Lf0_154
+.Lf0_155:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_154:
+.Lf0_153:
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf0_156
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -72(%rbp), %rax
+    jmp .Lf0_158
+.Lf0_157:
+    movslq -4(%rbp), %rax
+.Lf0_158:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_160
+    jmp .Lf0_159
+.Lf0_160:
+    cmpl $80, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_159:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_135:
+    .loc 1 46 30
+    incl -340(%rbp)
+.Lf0_137:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_136
+.Lf0_134:
+    addq $8, %rsp
+    .loc 1 59 5
+    cmpl $50, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $24, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 61 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 62 9
+    .p2align 4,,10
+.Lf0_163:
+    .loc 1 63 13
+    movslq -60(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_164
+    jmp .Lf0_161
+.Lf0_164:
+    .loc 1 64 13
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $33, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 65 13
+    movq $39, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_165
+    jmp .Lf0_166
+.Lf0_165:
+    movq $67, %rax
+    jmp .Lf0_167
+.Lf0_166:
+    movq $12, %rax
+.Lf0_167:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 67 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 68 17
+    jmp .Lf0_171
+    .p2align 4,,10
+.Lf0_170:
+    .loc 1 69 21
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_179
+.Lf0_178:
+    movq $49, %rax
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -344(%rbp), %rax
+.Lf0_180:
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_177
+.Lf0_176:
+    cmpl $70, -32(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    cmpq $0, %rax
+    jne .Lf0_172
+    jmp .Lf0_173
+.Lf0_172:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_182
+    jmp .Lf0_181
+.Lf0_182:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_181:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_184
+    jmp .Lf0_183
+.Lf0_184:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_183:
+    jmp .Lf0_174
+.Lf0_173:
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_186
+.Lf0_185:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_187
+.Lf0_186:
+    movslq -16(%rbp), %rax
+.Lf0_187:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_189
+    jmp .Lf0_188
+.Lf0_189:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_190
+    jmp .Lf0_191
+.Lf0_190:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_192
+.Lf0_191:
+    movq $71, %rax
+.Lf0_192:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_188:
+.Lf0_174:
+    movl %eax, -16(%rbp)
+    .loc 1 70 21
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $13, %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -68(%rbp)
+    .loc 1 71 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_193
+.Lf0_194:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_193:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_196
+    jmp .Lf0_195
+.Lf0_196:
+    movq $37, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_195:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_197
+    jmp .Lf0_198
+.Lf0_197:
+    movslq -16(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_199
+.Lf0_198:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 72 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_169:
+.Lf0_171:
+    .loc 1 68 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_170
+.Lf0_168:
+    addq $0, %rsp
+    .loc 1 75 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_162:
+    .loc 1 76 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_163
+.Lf0_161:
+    addq $8, %rsp
+    .loc 1 78 5
+    movq $6, %rax
+    push %rax
+    movq $61, %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_201
+    .loc 1 79 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_206
+.Lf0_205:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_207
+.Lf0_206:
+    movslq -28(%rbp), %rax
+.Lf0_207:
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_203
+.Lf0_202:
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_204:
+    push %rax
+    movq $71, %rax
+    cmpq $0, %rax
+    jne .Lf0_208
+    jmp .Lf0_209
+.Lf0_208:
+    movq $39, %rax
+    jmp .Lf0_210
+.Lf0_209:
+    movslq -16(%rbp), %rax
+.Lf0_210:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 80 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_211
+.Lf0_212:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_211:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -56(%rbp), %rax
+    addq $87, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 81 9
+    movq $68, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_213
+    jmp .Lf0_214
+.Lf0_213:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_215
+.Lf0_214:
+    movq $4, %rax
+    push %rax
+    movq $66, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_215:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_216
+    jmp .Lf0_217
+.Lf0_216:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_218
+.Lf0_217:
+    movslq -8(%rbp), %rax
+.Lf0_218:
+    push %rax
+    movq $43, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -52(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_200
+.Lf0_201:
+    .loc 1 83 9
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_219
+    jmp .Lf0_220
+.Lf0_219:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_221
+.Lf0_220:
+    movq $96, %rax
+.Lf0_221:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 84 9
+    movq $66, %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $10, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -76(%rbp)
+    .loc 1 85 9
+    movq $1, %rax
+    push %rax
+    movq $74, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_223
+    jmp .Lf0_222
+.Lf0_223:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_222:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_224
+.Lf0_225:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_227
+    jmp .Lf0_226
+.Lf0_227:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_226:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_224:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_200:
+    .loc 1 87 5
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $30, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_229
+    .loc 1 88 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_231
+    jmp .Lf0_230
+.Lf0_231:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_230:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_233
+    jmp .Lf0_232
+.Lf0_233:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_232:
+    movl %eax, -80(%rbp)
+    .loc 1 89 9
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_234
+    jmp .Lf0_235
+.Lf0_234:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_236
+.Lf0_235:
+    movslq -12(%rbp), %rax
+.Lf0_236:
+    push %rax
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_238
+    jmp .Lf0_237
+.Lf0_238:
+    movq $43, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_237:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 90 9
+    movslq -16(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_228
+.Lf0_229:
+    .loc 1 92 9
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $76, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_239
+    jmp .Lf0_240
+.Lf0_239:
+    movq $59, %rax
+    jmp .Lf0_241
+.Lf0_240:
+    movslq -52(%rbp), %rax
+.Lf0_241:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 93 9
+    movq $8, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $52, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 94 9
+    movq $5, %rax
+    push %rax
+    movq $21, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $8, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_242
+    jmp .Lf0_243
+.Lf0_242:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_245
+    jmp .Lf0_246
+.Lf0_245:
+    movq $7, %rax
+    jmp .Lf0_247
+.Lf0_246:
+    movslq -60(%rbp), %rax
+.Lf0_247:
+    jmp .Lf0_244
+.Lf0_243:
+    movq $32, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_244:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_228:
+    .loc 1 97 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 98 9
+    jmp .Lf0_251
+    .p2align 4,,10
+.Lf0_250:
+    .loc 1 99 13
+    movq $3, %rax
+    push %rax
+    movq $0, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_253
+    jmp .Lf0_252
+.Lf0_253:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_255
+    jmp .Lf0_254
+.Lf0_255:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_254:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_252:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 101 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 102 17
+    jmp .Lf0_259
+    .p2align 4,,10
+.Lf0_258:
+    .loc 1 103 21
+    cmpl $91, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_261
+    jmp .Lf0_260
+.Lf0_261:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_260:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 104 21
+    movq $9, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_262
+    jmp .Lf0_263
+.Lf0_262:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_265
+    jmp .Lf0_266
+.Lf0_265:
+    movq $86, %rax
+    jmp .Lf0_267
+.Lf0_266:
+    movq $70, %rax
+.Lf0_267:
+    push %rax
+    movq $26, %rax
+    cmpq $0, %rax
+    jne .Lf0_268
+    jmp .Lf0_269
+.Lf0_268:
+    movslq -28(%rbp), %rax
+    jmp .Lf0_270
+.Lf0_269:
+    movslq -56(%rbp), %rax
+.Lf0_270:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_264
+.Lf0_263:
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $73, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_264:
+    movl %eax, -12(%rbp)
+    .loc 1 105 21
+    movq $6, %rax
+    cmpq $0, %rax
+    jne .Lf0_271
+    jmp .Lf0_272
+.Lf0_271:
+    movq $71, %rax
+    jmp .Lf0_273
+.Lf0_272:
+    movslq -76(%rbp), %rax
+.Lf0_273:
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $29, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_275
+    jmp .Lf0_274
+.Lf0_275:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_277
+    jmp .Lf0_276
+.Lf0_277:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_276:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_279
+    jmp .Lf0_278
+.Lf0_279:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_278:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_274:
+    movl %eax, -4(%rbp)
+    .loc 1 106 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_257:
+.Lf0_259:
+    .loc 1 102 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_258
+.Lf0_256:
+    addq $0, %rsp
+    .loc 1 109 13
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 110 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_249:
+.Lf0_251:
+    .loc 1 98 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_250
+.Lf0_248:
+    addq $8, %rsp
+    .loc 1 113 5
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_280
+    jmp .Lf0_281
+.Lf0_280:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_283
+    jmp .Lf0_284
+.Lf0_283:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_285
+.Lf0_284:
+    movslq -16(%rbp), %rax
+.Lf0_285:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_282
+.Lf0_281:
+    movslq -36(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_287
+    jmp .Lf0_286
+.Lf0_287:
+    movq $30, %rax
+    cmpq $0, %rax
+    jne .Lf0_288
+    jmp .Lf0_289
+.Lf0_288:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_290
+.Lf0_289:
+    movslq -16(%rbp), %rax
+.Lf0_290:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_286:
+.Lf0_282:
+    movl %eax, -12(%rbp)
+    .loc 1 114 5
+    cmpl $19, -80(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 116 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 117 5
+    subq $8, %rsp
+    movq $6, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 118 5
+    movq $98, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 119 5
+    subq $8, %rsp
+    movq $93, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 120 5
+    movq $64, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 121 5
+    subq $64, %rsp
+    .loc 1 122 5
+    subq $256, %rsp
+    .loc 1 123 5
+    movq $4, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $47, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_2
+    .loc 1 124 9
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_3
+    jmp .Lf1_4
+.Lf1_3:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_5
+.Lf1_4:
+    movq $75, %rax
+.Lf1_5:
+    push %rax
+    movq $44, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $53, %rax
+    cmpq $0, %rax
+    jne .Lf1_6
+    jmp .Lf1_7
+.Lf1_6:
+    movslq -64(%rbp), %rax
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -16(%rbp), %rax
+.Lf1_8:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 125 9
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_10
+    jmp .Lf1_9
+.Lf1_10:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_9:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 126 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_15
+    jmp .Lf1_14
+.Lf1_15:
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_14:
+    cmpq $0, %rax
+    jne .Lf1_11
+    jmp .Lf1_12
+.Lf1_11:
+    cmpl $63, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_13
+.Lf1_12:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_17
+    jmp .Lf1_16
+.Lf1_17:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_16:
+.Lf1_13:
+    push %rax
+    cmpl $72, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_19
+    jmp .Lf1_18
+.Lf1_19:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_18:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_1
+.Lf1_2:
+    .loc 1 128 9
+    movq $4, %rax
+    push %rax
+    cmpl $24, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_20
+    jmp .Lf1_21
+.Lf1_20:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_22
+.Lf1_21:
+    movq $57, %rax
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_24
+.Lf1_23:
+    movslq -40(%rbp), %rax
+    jmp .Lf1_25
+.Lf1_24:
+    movslq -12(%rbp), %rax
+.Lf1_25:
+    push %rax
+    movq $26, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf1_22:
+    movl %eax, -8(%rbp)
+    .loc 1 129 9
+    cmpl $81, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $41, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_27
+    jmp .Lf1_26
+.Lf1_27:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_26:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 130 9
+    movq $2, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $84, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_29
+    jmp .Lf1_28
+.Lf1_29:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_28:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_1:
+    .loc 1 132 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_31
+.Lf1_30:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf1_32
+.Lf1_31:
+    movq $27, %rax
+.Lf1_32:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_34
+    jmp .Lf1_33
+.Lf1_34:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_33:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_35
+    jmp .Lf1_36
+.Lf1_35:
+    movq $71, %rax
+    jmp .Lf1_37
+.Lf1_36:
+    movslq -16(%rbp), %rax
+.Lf1_37:
+    push %rax
+    movq $16, %rax
+    cmpq $17, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 134 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 135 9
+    jmp .Lf1_41
+    .p2align 4,,10
+.Lf1_40:
+    .loc 1 136 13
+    movq $7, %rax
+    push %rax
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_43
+    jmp .Lf1_42
+.Lf1_43:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_42:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_45
+    jmp .Lf1_44
+.Lf1_45:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_46
+.Lf1_47:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_46:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_44:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 137 13
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_49
+.Lf1_48:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_50
+.Lf1_49:
+    movslq -72(%rbp), %rax
+.Lf1_50:
+    push %rax
+    movq $69, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $23, %rax
+    cmpq $47, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -52(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 139 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 140 17
+    .p2align 4,,10
+.Lf1_53:
+    .loc 1 141 21
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_55
+    jmp .Lf1_54
+.Lf1_55:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_54:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -72(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 142 21
+    movslq -4(%rbp), %rax
+    imulq $10, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_60
+    jmp .Lf1_59
+.Lf1_60:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_59:
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_57
+.Lf1_56:
+    movslq -340(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_58
+.Lf1_57:
+    movslq -4(%rbp), %rax
+    subq $66, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf1_58:
+    movl %eax, -8(%rbp)
+    .loc 1 143 21
+    movslq -344(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_61
+    jmp .Lf1_62
+.Lf1_61:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_65
+    jmp .Lf1_64
+.Lf1_65:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_64:
+    jmp .Lf1_63
+.Lf1_62:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    subl -80(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_63:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_66
+.Lf1_67:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_69
+    jmp .Lf1_68
+.Lf1_69:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_68:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_66:
+    movl %eax, -8(%rbp)
+    .loc 1 144 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_52:
+    .loc 1 145 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_53
+.Lf1_51:
+    addq $0, %rsp
+    .loc 1 147 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_39:
+.Lf1_41:
+    .loc 1 135 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_40
+.Lf1_38:
+    addq $8, %rsp
+    .loc 1 151 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 152 9
+    .p2align 4,,10
+.Lf1_72:
+    .loc 1 153 13
+    movslq -340(%rbp), %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_74
+    jmp .Lf1_73
+.Lf1_74:
+    cmpl $46, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_73:
+    movl %eax, -12(%rbp)
+    .loc 1 155 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 156 17
+    .p2align 4,,10
+.Lf1_77:
+    .loc 1 157 21
+    movq $8, %rax
+    push %rax
+    movq $79, %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 158 21
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $23, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 159 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_81
+    jmp .Lf1_82
+.Lf1_81:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_83
+.Lf1_82:
+    movq $8, %rax
+.Lf1_83:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_85
+    jmp .Lf1_84
+.Lf1_85:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_84:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_78
+    jmp .Lf1_79
+.Lf1_78:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_87
+    jmp .Lf1_86
+.Lf1_87:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_86:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_88
+    jmp .Lf1_89
+.Lf1_88:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf1_90
+.Lf1_89:
+    movslq -12(%rbp), %rax
+.Lf1_90:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_80
+.Lf1_79:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_92
+.Lf1_91:
+    movq $52, %rax
+    jmp .Lf1_93
+.Lf1_92:
+    movq $80, %rax
+.Lf1_93:
+    push %rax
+    movq $34, %rax
+    cmpq $77, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_80:
+    movl %eax, -12(%rbp)
+    .loc 1 160 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_76:
+    .loc 1 161 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_77
+.Lf1_75:
+    addq $0, %rsp
+    .loc 1 163 13
+    movq $2, %rax
+    push %rax
+    movq $52, %rax
+    addl -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_95
+    jmp .Lf1_94
+.Lf1_95:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_94:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -68(%rbp)
+    .loc 1 164 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_71:
+    .loc 1 165 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_72
+.Lf1_70:
+    addq $8, %rsp
+    .loc 1 167 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_98
+    jmp .Lf1_97
+.Lf1_98:
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_97:
+    push %rax
+    movslq -40(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_100
+    jmp .Lf1_99
+.Lf1_100:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_99:
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $9, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_101
+    .loc 1 168 9
+    movq $56, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_103
+    jmp .Lf1_102
+.Lf1_103:
+    movslq -68(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_102:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -36(%rbp)
+    .loc 1 169 9
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_104
+    jmp .Lf1_105
+.Lf1_104:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_106
+.Lf1_105:
+    movslq -8(%rbp), %rax
+.Lf1_106:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 170 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_108
+    jmp .Lf1_107
+.Lf1_108:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_109
+.Lf1_110:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_109:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_107:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_111
+    jmp .Lf1_112
+.Lf1_111:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_113
+.Lf1_112:
+    movq $3, %rax
+.Lf1_113:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_115
+    jmp .Lf1_114
+.Lf1_115:
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_114:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -60(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_96
+.Lf1_101:
+    .loc 1 172 9
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    addq $60, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $71, %rax
+    subq $40, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 173 9
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_117
+    jmp .Lf1_116
+.Lf1_117:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_119
+.Lf1_118:
+    movq $92, %rax
+    jmp .Lf1_120
+.Lf1_119:
+    movslq -12(%rbp), %rax
+.Lf1_120:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_116:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 174 9
+    cmpl $16, -32(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $12, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_121
+.Lf1_122:
+    movslq -40(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_121:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_96:
+    .loc 1 176 5
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf1_123
+    jmp .Lf1_124
+.Lf1_123:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_125
+.Lf1_124:
+    movslq -16(%rbp), %rax
+.Lf1_125:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $6, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_126
+    jmp .Lf1_127
+.Lf1_126:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_128
+.Lf1_127:
+    movslq -4(%rbp), %rax
+.Lf1_128:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 177 5
+    movq $7, %rax
+    push %rax
+    movq $47, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_134
+    jmp .Lf1_133
+.Lf1_134:
+    movq $48, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_133:
+    cmpq $0, %rax
+    jne .Lf1_130
+    jmp .Lf1_131
+.Lf1_130:
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_136
+    jmp .Lf1_135
+.Lf1_136:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_135:
+    jmp .Lf1_132
+.Lf1_131:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_132:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_137
+    .loc 1 178 9
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $7, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_139
+    jmp .Lf1_138
+.Lf1_139:
+    cmpl $68, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_141
+.Lf1_140:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_142
+.Lf1_141:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_144
+    jmp .Lf1_143
+.Lf1_144:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_143:
+.Lf1_142:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_138:
+    movl %eax, -8(%rbp)
+    .loc 1 179 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_149
+    jmp .Lf1_148
+.Lf1_149:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_148:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_145
+    jmp .Lf1_146
+.Lf1_145:
+    movslq -36(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_147
+.Lf1_146:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_151
+    jmp .Lf1_150
+.Lf1_151:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_150:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf1_147:
+    movl %eax, -4(%rbp)
+    .loc 1 180 9
+    movq $75, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_155
+.Lf1_156:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_155:
+    cmpq $0, %rax
+    jne .Lf1_152
+    jmp .Lf1_153
+.Lf1_152:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_157
+    jmp .Lf1_158
+.Lf1_157:
+    movslq -24(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_159
+.Lf1_158:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_161
+    jmp .Lf1_160
+.Lf1_161:
+    movq $27, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_160:
+.Lf1_159:
+    jmp .Lf1_154
+.Lf1_153:
+    movq $4, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_154:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_129
+.Lf1_137:
+    .loc 1 182 9
+    movq $3, %rax
+    push %rax
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_163
+.Lf1_162:
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_164
+.Lf1_163:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_164:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 183 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_168
+    jmp .Lf1_167
+.Lf1_168:
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_167:
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $65, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $53, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -32(%rbp)
+    .loc 1 184 9
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_170
+    jmp .Lf1_169
+.Lf1_170:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_169:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_172
+    jmp .Lf1_171
+.Lf1_172:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_171:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_129:
+    .loc 1 187 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 188 9
+    jmp .Lf1_176
+    .p2align 4,,10
+.Lf1_175:
+    .loc 1 189 13
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $66, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_177
+    jmp .Lf1_173
+.Lf1_177:
+    .loc 1 190 13
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $54, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_178
+    jmp .Lf1_179
+.Lf1_178:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_180
+.Lf1_179:
+    movq $4, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_180:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 191 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_186
+    .p2align 4,,10
+.Lf1_185:
+    .loc 1 192 17
+    movq $4, %rax
+    push %rax
+    movq $40, %rax
+    cmpq $64, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $87, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_187
+    jmp .Lf1_188
+.Lf1_187:
+    movq $48, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_189
+.Lf1_188:
+    movslq -4(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_189:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 193 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_193
+    jmp .Lf1_194
+.Lf1_193:
+    movq $57, %rax
+    jmp .Lf1_195
+.Lf1_194:
+    movslq -24(%rbp), %rax
+.Lf1_195:
+    cmpq $0, %rax
+    jne .Lf1_190
+    jmp .Lf1_191
+.Lf1_190:
+    movq $40, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_192
+.Lf1_191:
+    movslq -344(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_192:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_197
+    jmp .Lf1_196
+.Lf1_197:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_196:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 194 17
+    movq $16, %rax
+    subq $2, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_199
+.Lf1_198:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_200
+.Lf1_199:
+    movq $78, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_202
+    jmp .Lf1_201
+.Lf1_202:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_201:
+.Lf1_200:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    jne .Lf1_203
+    jmp .Lf1_204
+.Lf1_203:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_205
+.Lf1_204:
+    movslq -12(%rbp), %rax
+.Lf1_205:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -60(%rbp)
+    addq $0, %rsp
+.Lf1_184:
+    .loc 1 191 38
+    incl -344(%rbp)
+.Lf1_186:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_185
+.Lf1_183:
+    addq $0, %rsp
+    .loc 1 196 13
+    movq $5, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_209
+    jmp .Lf1_210
+.Lf1_209:
+    movslq -340(%rbp), %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_211
+.Lf1_210:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_211:
+    cmpq $0, %rax
+    jne .Lf1_206
+    jmp .Lf1_207
+.Lf1_206:
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_208
+.Lf1_207:
+    movq $2, %rax
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_213
+.Lf1_212:
+    movq $38, %rax
+    jmp .Lf1_214
+.Lf1_213:
+    movq $91, %rax
+.Lf1_214:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_208:
+    movl %eax, -8(%rbp)
+    .loc 1 197 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_174:
+.Lf1_176:
+    .loc 1 188 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_175
+.Lf1_173:
+    addq $8, %rsp
+    .loc 1 200 5
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_217
+    jmp .Lf1_216
+.Lf1_217:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_219
+    jmp .Lf1_218
+.Lf1_219:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_218:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_216:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_220
+    .loc 1 201 9
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_225
+    jmp .Lf1_224
+.Lf1_225:
+    movq $92, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_224:
+    cmpq $0, %rax
+    jne .Lf1_221
+    jmp .Lf1_222
+.Lf1_221:
+    cmpl $0, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $70, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_223
+.Lf1_222:
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $93, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_223:
+    movl %eax, -12(%rbp)
+    .loc 1 202 9
+    movq $49, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    jne .Lf1_226
+    jmp .Lf1_227
+.Lf1_226:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_228
+.Lf1_227:
+    movq $44, %rax
+.Lf1_228:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 203 9
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_233
+    jmp .Lf1_232
+.Lf1_233:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_232:
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_235
+    jmp .Lf1_234
+.Lf1_235:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_229
+    jmp .Lf1_230
+.Lf1_229:
+    movq $76, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_237
+    jmp .Lf1_236
+.Lf1_237:
+    movq $4, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_236:
+    jmp .Lf1_231
+.Lf1_230:
+    movq $4, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $89, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_231:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_215
+.Lf1_220:
+    .loc 1 205 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_238
+    jmp .Lf1_239
+.Lf1_238:
+    movq $23, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_240
+.Lf1_239:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_240:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_242
+    jmp .Lf1_241
+.Lf1_242:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_241:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 206 9
+    movq $9, %rax
+    cmpq $88, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_247
+    jmp .Lf1_246
+.Lf1_247:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_246:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_243
+    jmp .Lf1_244
+.Lf1_243:
+    movq $58, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_245
+.Lf1_244:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_249
+    jmp .Lf1_248
+.Lf1_249:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_248:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_245:
+    movl %eax, -8(%rbp)
+    .loc 1 207 9
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_250
+    jmp .Lf1_251
+.Lf1_250:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_254
+    jmp .Lf1_253
+.Lf1_254:
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_253:
+    jmp .Lf1_252
+.Lf1_251:
+    movq $92, %rax
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_256
+.Lf1_255:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_257
+.Lf1_256:
+    movq $60, %rax
+.Lf1_257:
+.Lf1_252:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_259
+    jmp .Lf1_258
+.Lf1_259:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_261
+    jmp .Lf1_260
+.Lf1_261:
+    movq $24, %rax
+    cmpq $0, %rax
+    jne .Lf1_262
+    jmp .Lf1_263
+.Lf1_262:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_264
+.Lf1_263:
+    movslq -8(%rbp), %rax
+.Lf1_264:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_260:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_258:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_215:
+    .loc 1 209 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_270
+    .p2align 4,,10
+.Lf1_269:
+    .loc 1 210 9
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $67, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_271
+    jmp .Lf1_267
+.Lf1_271:
+    .loc 1 211 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_273
+    jmp .Lf1_272
+.Lf1_273:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_272:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_275
+    jmp .Lf1_274
+.Lf1_275:
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_274:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_277
+    jmp .Lf1_276
+.Lf1_277:
+    movslq -12(%rbp), %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_276:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 213 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 214 13
+    .p2align 4,,10
+.Lf1_280:
+    .loc 1 215 17
+    movq $53, %rax
+    cmpq $80, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $92, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_281
+    jmp .Lf1_278
+.Lf1_281:
+    .loc 1 216 17
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_282
+    jmp .Lf1_283
+.Lf1_282:
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_284
+.Lf1_283:
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_286
+    jmp .Lf1_285
+.Lf1_286:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_285:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_284:
+    movl %eax, -4(%rbp)
+    .loc 1 217 17
+    movq $81, %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf1_287
+    jmp .Lf1_288
+.Lf1_287:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_289
+.Lf1_288:
+    movslq -4(%rbp), %rax
+.Lf1_289:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 218 17
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_291
+    jmp .Lf1_290
+.Lf1_291:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_290:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $63, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_292
+    jmp .Lf1_293
+.Lf1_292:
+    cmpl $46, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_294
+.Lf1_293:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_296
+    jmp .Lf1_295
+.Lf1_296:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_295:
+.Lf1_294:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -40(%rbp)
+    .loc 1 219 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_279:
+    .loc 1 220 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_280
+.Lf1_278:
+    addq $0, %rsp
+    .loc 1 222 9
+    movq $3, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_268:
+    .loc 1 209 30
+    incl -340(%rbp)
+.Lf1_270:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_269
+.Lf1_267:
+    addq $8, %rsp
+    .loc 1 224 5
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_298
+    jmp .Lf1_297
+.Lf1_298:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_299
+    jmp .Lf1_300
+.Lf1_299:
+    movslq -20(%rbp), %rax
+    jmp .Lf1_301
+.Lf1_300:
+    movq $32, %rax
+.Lf1_301:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_297:
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 226 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 227 5
+    subq $8, %rsp
+    movq $74, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 228 5
+    movq $70, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 229 5
+    subq $8, %rsp
+    movq $19, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 230 5
+    movq $63, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 231 5
+    subq $64, %rsp
+    .loc 1 232 5
+    subq $256, %rsp
+    .loc 1 233 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_6
+    .p2align 4,,10
+.Lf2_5:
+    .loc 1 235 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 236 13
+    .p2align 4,,10
+.Lf2_9:
+    .loc 1 237 17
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 238 17
+    cmpl $34, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_10
+    jmp .Lf2_11
+.Lf2_10:
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_13
+    jmp .Lf2_14
+.Lf2_13:
+    cmpl $83, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_15
+.Lf2_14:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_15:
+    jmp .Lf2_12
+.Lf2_11:
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_12:
+    movl %eax, -12(%rbp)
+    .loc 1 239 17
+    movq $75, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $39, -344(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_16
+    jmp .Lf2_17
+.Lf2_16:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_18
+.Lf2_17:
+    movq $21, %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_18:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 240 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_8:
+    .loc 1 241 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_9
+.Lf2_7:
+    addq $0, %rsp
+    .loc 1 243 9
+    cmpl $0, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_19
+    jmp .Lf2_20
+.Lf2_19:
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_21
+.Lf2_20:
+    movq $42, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_21:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $88, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 244 9
+    cmpl $67, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_22
+    jmp .Lf2_23
+.Lf2_22:
+    movq $66, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_24
+.Lf2_23:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_24:
+    push %rax
+    movq $9, %rax
+    cmpq $0, %rax
+    jne .Lf2_25
+    jmp .Lf2_26
+.Lf2_25:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_27
+.Lf2_26:
+    movslq -8(%rbp), %rax
+.Lf2_27:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $77, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_4:
+    .loc 1 233 30
+    incl -340(%rbp)
+.Lf2_6:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_5
+.Lf2_3:
+    addq $8, %rsp
+    .loc 1 246 5
+    movq $67, %rax
+    imulq $49, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_28
+    jmp .Lf2_29
+.Lf2_28:
+    movq $42, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_30
+.Lf2_29:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_32
+.Lf2_31:
+    movq $3, %rax
+    jmp .Lf2_33
+.Lf2_32:
+    movslq -4(%rbp), %rax
+.Lf2_33:
+.Lf2_30:
+    push %rax
+    movq $87, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $25, %rax
+    addq $37, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 248 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 249 9
+    .p2align 4,,10
+.Lf2_36:
+    .loc 1 250 13
+    movq $74, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $61, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_37
+    jmp .Lf2_34
+.Lf2_37:
+    .loc 1 252 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 253 17
+    jmp .Lf2_41
+    .p2align 4,,10
+.Lf2_40:
+    .loc 1 254 21
+    movslq -8(%rbp), %rax
+    imulq $0, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_42
+    jmp .Lf2_43
+.Lf2_42:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_44
+.Lf2_43:
+    movq $41, %rax
+.Lf2_44:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_46
+    jmp .Lf2_45
+.Lf2_46:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_48
+    jmp .Lf2_47
+.Lf2_48:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_47:
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_45:
+    movl %eax, -16(%rbp)
+    .loc 1 255 21
+    movq $6, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $11, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 256 21
+    movslq -4(%rbp), %rax
+    imulq $82, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_50
+    jmp .Lf2_49
+.Lf2_50:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_52
+    jmp .Lf2_51
+.Lf2_52:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_51:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_49:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_53
+    jmp .Lf2_54
+.Lf2_53:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_55
+.Lf2_54:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf2_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 257 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_39:
+.Lf2_41:
+    .loc 1 253 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_40
+.Lf2_38:
+    addq $0, %rsp
+    .loc 1 260 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_56
+    jmp .Lf2_57
+.Lf2_56:
+    movslq -28(%rbp), %rax
+    jmp .Lf2_58
+.Lf2_57:
+    movq $69, %rax
+.Lf2_58:
+    push %rax
+    movq $65, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    subq $18, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 261 13
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_59
+    jmp .Lf2_60
+.Lf2_59:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_61
+.Lf2_60:
+    movslq -8(%rbp), %rax
+.Lf2_61:
+    push %rax
+    movq $49, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $62, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 262 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_35:
+    .loc 1 263 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_36
+.Lf2_34:
+    addq $8, %rsp
+    .loc 1 265 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_67
+    .p2align 4,,10
+.Lf2_66:
+    .loc 1 266 9
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $93, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_68
+    jmp .Lf2_64
+.Lf2_68:
+    .loc 1 267 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_74
+    .p2align 4,,10
+.Lf2_73:
+    .loc 1 268 13
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_79
+    jmp .Lf2_78
+.Lf2_79:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_78:
+    cmpq $0, %rax
+    jne .Lf2_75
+    jmp .Lf2_76
+.Lf2_75:
+    movq $78, %rax
+    cmpq $72, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_77
+.Lf2_76:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_77:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -56(%rbp)
+    .loc 1 269 13
+    movslq -340(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_80
+    jmp .Lf2_81
+.Lf2_80:
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_82
+.Lf2_81:
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_82:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_84
+    jmp .Lf2_83
+.Lf2_84:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_83:
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 270 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -36(%rbp), %rax
+    imulq $34, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_85
+    jmp .Lf2_86
+.Lf2_85:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_87
+.Lf2_86:
+    movq $75, %rax
+.Lf2_87:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_89
+    jmp .Lf2_88
+.Lf2_89:
+    movq $0, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_88:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_72:
+    .loc 1 267 34
+    incl -344(%rbp)
+.Lf2_74:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_73
+.Lf2_71:
+    addq $0, %rsp
+    .loc 1 272 9
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $63, %rax
+    cmpq $0, %rax
+    jne .Lf2_90
+    jmp .Lf2_91
+.Lf2_90:
+    movq $61, %rax
+    jmp .Lf2_92
+.Lf2_91:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf2_92:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 273 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_96
+    jmp .Lf2_97
+.Lf2_96:
+    movq $31, %rax
+    jmp .Lf2_98
+.Lf2_97:
+    movslq -12(%rbp), %rax
+.Lf2_98:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $9, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_93
+    jmp .Lf2_94
+.Lf2_93:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_99
+    jmp .Lf2_100
+.Lf2_99:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_101
+.Lf2_100:
+    movslq -28(%rbp), %rax
+.Lf2_101:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_95
+.Lf2_94:
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $62, %rax
+    cmpq $46, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_95:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_65:
+    .loc 1 265 30
+    incl -340(%rbp)
+.Lf2_67:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_66
+.Lf2_64:
+    addq $8, %rsp
+    .loc 1 275 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_107
+    .p2align 4,,10
+.Lf2_106:
+    .loc 1 276 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_108
+    jmp .Lf2_104
+.Lf2_108:
+    .loc 1 277 9
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_109
+    jmp .Lf2_110
+.Lf2_109:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_112
+    jmp .Lf2_113
+.Lf2_112:
+    movslq -28(%rbp), %rax
+    jmp .Lf2_114
+.Lf2_113:
+    movslq -4(%rbp), %rax
+.Lf2_114:
+    jmp .Lf2_111
+.Lf2_110:
+    movq $45, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_111:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 279 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 280 13
+    jmp .Lf2_118
+    .p2align 4,,10
+.Lf2_117:
+    .loc 1 281 17
+    movq $9, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_119
+    jmp .Lf2_120
+.Lf2_119:
+    cmpl $76, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_121
+.Lf2_120:
+    cmpl $20, -80(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf2_121:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 282 17
+    movq $76, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 283 17
+    movslq -68(%rbp), %rax
+    imulq $96, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_123
+    jmp .Lf2_122
+.Lf2_123:
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_122:
+    push %rax
+    movq $82, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 284 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_116:
+.Lf2_118:
+    .loc 1 280 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_117
+.Lf2_115:
+    addq $0, %rsp
+    .loc 1 287 9
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_125
+    jmp .Lf2_124
+.Lf2_125:
+    movq $83, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_124:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    addq $0, %rsp
+.Lf2_105:
+    .loc 1 275 30
+    incl -340(%rbp)
+.Lf2_107:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_106
+.Lf2_104:
+    addq $8, %rsp
+    .loc 1 289 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_127
+.Lf2_128:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_127:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $95, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_129
+    .loc 1 290 9
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_134
+    jmp .Lf2_133
+.Lf2_134:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_133:
+    cmpq $0, %rax
+    jne .Lf2_130
+    jmp .Lf2_131
+.Lf2_130:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_132
+.Lf2_131:
+    movslq -24(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_132:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_135
+    jmp .Lf2_136
+.Lf2_135:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_137
+.Lf2_136:
+    movslq -4(%rbp), %rax
+.Lf2_137:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 291 9
+    movq $6, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $21, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 292 9
+    movslq -64(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_139
+    jmp .Lf2_138
+.Lf2_139:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_138:
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_126
+.Lf2_129:
+    .loc 1 294 9
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $27, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_141
+    jmp .Lf2_140
+.Lf2_141:
+    movq $22, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_143
+    jmp .Lf2_142
+.Lf2_143:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_144
+    jmp .Lf2_145
+.Lf2_144:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_146
+.Lf2_145:
+    movslq -16(%rbp), %rax
+.Lf2_146:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_142:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_140:
+    movl %eax, -4(%rbp)
+    .loc 1 295 9
+    movslq -4(%rbp), %rax
+    addq $71, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_147
+    jmp .Lf2_148
+.Lf2_147:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_149
+.Lf2_148:
+    movq $88, %rax
+    cmpq $0, %rax
+    jne .Lf2_150
+    jmp .Lf2_151
+.Lf2_150:
+    movslq -48(%rbp), %rax
+    jmp .Lf2_152
+.Lf2_151:
+    movslq -8(%rbp), %rax
+.Lf2_152:
+.Lf2_149:
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_154
+    jmp .Lf2_153
+.Lf2_154:
+    movq $48, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_153:
+    push %rax
+    cmpl $93, -52(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 296 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_156
+    jmp .Lf2_155
+.Lf2_156:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_155:
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_126:
+    .loc 1 298 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_162
+    .p2align 4,,10
+.Lf2_161:
+    .loc 1 299 9
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_163
+    jmp .Lf2_159
+.Lf2_163:
+    .loc 1 300 9
+    movq $7, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 302 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 303 13
+    jmp .Lf2_167
+    .p2align 4,,10
+.Lf2_166:
+    .loc 1 304 17
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_169
+    jmp .Lf2_168
+.Lf2_169:
+    movq $87, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_168:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_171
+    jmp .Lf2_170
+.Lf2_171:
+    movslq -40(%rbp), %rax
+    subl -48(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_170:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 305 17
+    movq $5, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $92, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 306 17
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_173
+    jmp .Lf2_172
+.Lf2_173:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_172:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 307 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_165:
+.Lf2_167:
+    .loc 1 303 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_166
+.Lf2_164:
+    addq $0, %rsp
+    .loc 1 310 9
+    movq $5, %rax
+    cmpq $15, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_175
+    jmp .Lf2_174
+.Lf2_175:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_174:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $12, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_177
+    jmp .Lf2_176
+.Lf2_177:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_176:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -80(%rbp)
+    addq $0, %rsp
+.Lf2_160:
+    .loc 1 298 30
+    incl -340(%rbp)
+.Lf2_162:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_161
+.Lf2_159:
+    addq $8, %rsp
+    .loc 1 312 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_183
+    .p2align 4,,10
+.Lf2_182:
+    .loc 1 313 9
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $96, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $27, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 314 9
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $56, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_184
+    jmp .Lf2_185
+.Lf2_184:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_186
+.Lf2_185:
+    movslq -8(%rbp), %rax
+.Lf2_186:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 316 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 317 13
+    jmp .Lf2_190
+    .p2align 4,,10
+.Lf2_189:
+    .loc 1 318 17
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_192
+    jmp .Lf2_191
+.Lf2_192:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_191:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_193
+    jmp .Lf2_194
+.Lf2_193:
+    movq $93, %rax
+    jmp .Lf2_195
+.Lf2_194:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf2_195:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_196
+    jmp .Lf2_197
+.Lf2_196:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_199
+    jmp .Lf2_200
+.Lf2_199:
+    movslq -20(%rbp), %rax
+    jmp .Lf2_201
+.Lf2_200:
+    movq $24, %rax
+.Lf2_201:
+    jmp .Lf2_198
+.Lf2_197:
+    movslq -76(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_198:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 319 17
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpq $0, %rax
+    jne .Lf2_202
+    jmp .Lf2_203
+.Lf2_202:
+    movslq -36(%rbp), %rax
+    jmp .Lf2_204
+.Lf2_203:
+    movslq -340(%rbp), %rax
+.Lf2_204:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_206
+    jmp .Lf2_205
+.Lf2_206:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_205:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 320 17
+    movq $1, %rax
+    push %rax
+    movq $26, %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_207
+    jmp .Lf2_208
+.Lf2_207:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_209
+.Lf2_208:
+    movslq -340(%rbp), %rax
+.Lf2_209:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_211
+    jmp .Lf2_210
+.Lf2_211:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_210:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 321 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_188:
+.Lf2_190:
+    .loc 1 317 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_189
+.Lf2_187:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_181:
+    .loc 1 312 32
+    incl -340(%rbp)
+.Lf2_183:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_182
+.Lf2_180:
+    addq $8, %rsp
+    .loc 1 326 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 327 9
+    .p2align 4,,10
+.Lf2_214:
+    .loc 1 328 13
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_216
+    jmp .Lf2_215
+.Lf2_216:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_215:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_218
+    jmp .Lf2_217
+.Lf2_218:
+    movq $5, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_217:
+    movl %eax, -68(%rbp)
+    .loc 1 329 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_219
+    jmp .Lf2_220
+.Lf2_219:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf2_221
+.Lf2_220:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf2_221:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_223
+    jmp .Lf2_222
+.Lf2_223:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_222:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_225
+    jmp .Lf2_224
+.Lf2_225:
+    movq $4, %rax
+    push %rax
+    movq $21, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_224:
+    movl %eax, -60(%rbp)
+    .loc 1 330 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_231
+    .p2align 4,,10
+.Lf2_230:
+    .loc 1 331 17
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 332 17
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $35, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 333 17
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $25, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_232
+    jmp .Lf2_233
+.Lf2_232:
+    movq $39, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_235
+    jmp .Lf2_236
+.Lf2_235:
+    movq $32, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_237
+.Lf2_236:
+    movq $83, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf2_237:
+    jmp .Lf2_234
+.Lf2_233:
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_242
+    jmp .Lf2_241
+.Lf2_242:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_241:
+    cmpq $0, %rax
+    jne .Lf2_238
+    jmp .Lf2_239
+.Lf2_238:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_244
+    jmp .Lf2_243
+.Lf2_244:
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_243:
+    jmp .Lf2_240
+.Lf2_239:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_240:
+.Lf2_234:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_229:
+    .loc 1 330 40
+    incl -344(%rbp)
+.Lf2_231:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_230
+.Lf2_228:
+    addq $0, %rsp
+    .loc 1 335 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_213:
+    .loc 1 336 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_214
+.Lf2_212:
+    addq $8, %rsp
+    .loc 1 338 5
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_246
+    jmp .Lf2_245
+.Lf2_246:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_245:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $5, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 339 5
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_247
+    jmp .Lf2_248
+.Lf2_247:
+    movq $36, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_249
+.Lf2_248:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_249:
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
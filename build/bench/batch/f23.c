@@ -0,0 +1,474 @@
+int f0() {
+    int v0 = 14;
+    int v1 = 55;
+    int v2 = 76;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((7 != v0) > 93) break;
+            a1[0][10] = (((a0[7] + a1[1][15]) >= (a0[7] ? v3 : v3)) != ((v1 == v1) % 7));
+            v3 = (((33 % 7) - (41 ? v3 : a1[1][12])) > ((a0[11] > v2) <= (a1[0][15] ? i0 : i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[3][10] && a1[0][11]) > 95) break;
+                    v3 = (((i0 ? i0 : i0) == (i0 / 6)) > ((v2 == v2) + (i0 - v0)));
+                    a0[11] = (((i0 ? 21 : a0[9]) / 2) && ((v3 <= i0) != (50 ? a1[1][4] : a1[3][4])));
+                    v0 = (((90 * v3) || (v2 % 4)) >= ((i0 - v2) * (v2 + i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v1 = (((a0[15] + a0[5]) <= (v0 || v0)) ? ((15 || v1) / 9) : ((7 < a0[14]) * (i2 * 63)));
+                    v3 = (((v1 ? a1[2][12] : v3) * (i3 || v3)) <= ((v1 > a0[14]) || (v1 || 91)));
+                    a1[2][15] = (((32 && v0) ? (v0 / 3) : (v1 >= 56)) != ((i2 == 86) || (v3 <= a0[6])));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((98 ? 37 : 51) * (53 / 5)) % 3);
+            v3 = (((81 < v1) > (a1[3][9] < a1[1][14])) < ((v3 <= v1) <= (v1 <= a0[13])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[3] > v2) || (v2 % 5)) + ((a0[2] / 1) % 6))) {
+        a1[1][11] = (((50 < v2) + (54 * 50)) % 5);
+        v2 = (((42 + v3) != (v3 + 4)) ? ((v2 + a0[15]) ? (v3 != v2) : (v1 * v2)) : ((41 > 71) != (v3 == 36)));
+        v2 = (((80 > a1[2][0]) - (a0[11] - v2)) / 4);
+    } else {
+        a0[4] = (((95 < v2) != (v2 + v3)) ? ((v3 ? a0[12] : a1[1][11]) ? (v3 <= v1) : (47 && 56)) : ((a1[3][12] ? v0 : a0[15]) ? (v0 * v0) : (82 || 92)));
+        v3 = (((v1 * v0) - (v0 ? 37 : v3)) ? ((a0[9] == a0[2]) - (v2 <= 4)) : ((v1 + 3) % 4));
+        v0 = (((17 ? 25 : v1) - (v3 >= 34)) || ((a1[3][3] - v2) < (64 == 26)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((58 != 59) / 7) % 6);
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((a1[1][4] > 74) / 8) || ((v1 && a0[2]) <= (52 < 27)));
+                    v3 = (((35 ? 1 : 25) <= (65 ? v1 : 57)) + ((v3 ? 74 : i4) <= (a0[1] == 88)));
+                    v2 = (((i4 > a0[9]) / 9) > ((6 != 10) - (15 && v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a1[1][3] = (((v1 - v1) || (v1 ? v2 : i4)) > ((i4 - 14) % 7));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    if ((((a1[3][3] < a0[10]) > (a0[6] || v2)) <= ((v2 < 38) >= (v0 % 4)))) {
+        v0 = (((46 <= v2) * (8 != v1)) ? ((v1 == a0[6]) * (a1[0][9] > v3)) : ((v2 < v0) && (71 ? a1[0][15] : v0)));
+        v3 = (((v0 ? 3 : v3) == (v0 / 4)) % 1);
+        v0 = (((v0 <= 34) ? (v0 + a0[15]) : (v0 || v1)) % 1);
+    } else {
+        v3 = (((53 || v1) + (39 * a0[0])) <= ((v2 && v3) <= (86 < v0)));
+        v0 = (((60 <= v2) ? (v3 < v0) : (v3 ? v1 : v3)) % 5);
+        v2 = (((v3 - a0[8]) ? (34 * v2) : (48 >= v2)) && ((84 <= 47) == (a0[14] * v2)));
+    }
+    a1[3][11] = (((v2 + 75) > (a0[10] != 58)) / 8);
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    if ((i7 || 7) > 60) break;
+                    v0 = (((14 == a0[7]) - (a0[11] * v0)) < ((a0[9] - 93) < (45 ? a0[11] : a1[0][15])));
+                    v0 = (((v0 < a1[1][0]) || (a1[3][1] % 3)) ? ((86 % 2) % 4) : ((i7 / 8) < (80 - i6)));
+                    v0 = (((i7 ? v1 : v3) && (v3 <= v1)) + ((i6 % 5) + (v3 * 75)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((36 >= a0[10]) + (v3 - v1)) || ((v0 % 8) % 2));
+            v2 = (((78 - 93) * (a1[1][4] * v2)) ? ((a0[4] == a0[7]) - (v0 % 9)) : ((a1[3][6] >= i6) > (a1[2][2] ? 73 : a0[4])));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    if ((((4 > 22) > (a1[2][14] == v0)) >= ((v2 && v3) <= (v3 + v3)))) {
+        a1[1][3] = (((v0 * v3) % 1) || ((55 < v1) != (76 >= a1[1][6])));
+        a1[3][13] = (((a0[3] % 1) == (86 - 66)) ? ((v3 ? a1[0][7] : v3) == (11 <= v2)) : ((64 % 5) <= (v1 != 94)));
+        v1 = (((v2 < v0) + (a0[3] < 37)) * ((27 + v0) != (a0[13] == v0)));
+    } else {
+        v3 = (((v2 % 2) + (v0 - v2)) ? ((v3 % 8) || (v1 > 68)) : ((v3 % 1) - (30 || v1)));
+        v1 = (((v3 && a1[3][6]) * (a1[1][7] ? v0 : 82)) + ((v0 + a0[5]) <= (v2 ? v3 : a0[14])));
+        v1 = (((48 != 11) + (a0[1] ? a0[10] : a1[2][5])) ? ((11 % 7) / 3) : ((a1[2][2] ? 17 : v1) != (52 && a0[4])));
+    }
+    v3 = (((a0[1] <= 53) || (v3 / 7)) > ((v2 && v3) == (a1[1][2] ? 53 : v0)));
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            v2 = (((a1[2][7] % 4) + (a1[0][9] >= a0[8])) >= ((v3 % 1) != (19 >= 39)));
+            a0[11] = (((a0[14] && a1[1][6]) / 9) + ((v1 * v2) < (72 && v2)));
+            for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+                v3 = (((19 >= v2) || (a1[0][12] ? i8 : v2)) ? ((v3 > 31) != (a0[9] || a1[1][4])) : ((i9 / 3) - (v0 % 7)));
+                v2 = (((v0 * v3) / 4) <= ((62 ? a1[1][6] : i8) == (v3 < 32)));
+                a1[1][10] = (((a1[0][8] > v0) != (v0 > 1)) * ((72 < a1[1][13]) == (a1[2][6] || v3)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v2 < v3) ? (a0[15] || a0[3]) : (a1[2][5] % 7)) ? ((a1[3][10] % 7) < (a1[3][3] + v1)) : ((v3 && v2) == (43 >= 11)));
+}
+int f1() {
+    int v0 = 18;
+    int v1 = 94;
+    int v2 = 50;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 != v2) ? (a0[2] ? v3 : 35) : (v1 == v1)) % 1);
+    a1[2][11] = (((a0[15] > v0) ? (47 / 9) : (v2 == 67)) || ((v1 * 21) > (v1 <= v1)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v2 = (((a1[0][5] <= 96) == (v0 || 50)) - ((a1[0][15] && a1[2][6]) || (a0[13] + v3)));
+                    v3 = (((a0[6] == v3) > (a0[5] < v3)) <= ((a1[2][14] * a1[0][1]) >= (a0[10] < a0[5])));
+                    v3 = (((v0 * a1[2][6]) % 9) < ((41 > a1[0][0]) / 9));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[9] = (((v2 - 83) <= (v2 / 2)) <= ((90 < 14) - (a0[7] == v3)));
+            a1[3][9] = (((v1 == v3) || (v1 <= v0)) % 8);
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v2 = (((a1[1][9] <= v3) * (v1 ? a0[3] : i2)) < ((v1 - v0) + (v3 > v2)));
+        v0 = (((a0[2] ? v0 : a0[13]) ? (v1 * v1) : (a0[1] >= v2)) % 6);
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                a1[3][12] = (((41 % 8) > (v1 % 5)) == ((v2 == v2) || (39 > a1[0][7])));
+                v2 = (((28 || i3) <= (v3 && v2)) - ((47 != v1) >= (v0 != i3)));
+                v0 = (((2 + v2) ? (v3 - 57) : (i2 - i3)) < ((a0[1] % 7) ? (v0 != v2) : (a0[13] < v1)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((81 <= i4) > 98) break;
+        v2 = (((a1[3][4] - a1[2][13]) != (v3 % 4)) || ((i4 - v3) * (a0[0] * 21)));
+        a1[2][14] = (((v3 ? v0 : v0) <= (47 - v3)) && ((5 - 52) ? (v2 >= v3) : (i4 && v3)));
+        {
+            int i5 = 0;
+            do {
+                a1[0][14] = (((22 ? a1[2][7] : 84) == (19 - a1[0][2])) - ((i4 < 78) != (a0[3] * i5)));
+                a1[1][8] = (((93 ? 51 : v3) || (72 >= v2)) % 2);
+                v1 = (((v3 < i5) >= (v3 % 7)) * ((v2 ? a1[0][2] : 52) * (v2 - 84)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        if ((a1[2][2] % 4) > 56) break;
+        {
+            int i7 = 0;
+            while (i7 < 5) {
+                if ((a1[0][1] <= i7) > 53) break;
+                v3 = (((a0[13] < a1[3][12]) + (v0 != 14)) > ((v3 - v3) || (v3 || i7)));
+                a0[10] = (((i7 - i6) ? (a0[5] ? 92 : a0[7]) : (v1 > a1[3][0])) > ((56 == 84) || (12 > v1)));
+                a1[1][5] = (((a0[2] + 57) + (a1[1][14] > i7)) * ((v1 * v2) <= (12 == 14)));
+                i7 = i7 + 1;
+            }
+        }
+        v0 = (((a0[14] % 4) < (a1[1][8] <= 34)) && ((a1[0][9] * v0) && (i6 ? v2 : v2)));
+        v3 = (((91 == 28) ? (2 + v0) : (v3 && v2)) / 8);
+    }
+    if ((((v3 ? v3 : 55) > (a0[10] ? v0 : 37)) * ((a1[2][3] != v3) && (a1[2][0] < a0[8])))) {
+        a1[3][0] = (((a0[10] ? v3 : v0) && (a0[15] > a1[2][7])) / 9);
+        v3 = (((a1[1][11] == a1[3][14]) * (v0 * v0)) && ((v1 != 4) * (70 || a1[1][5])));
+        a0[14] = (((v3 >= a1[1][11]) ? (v2 < a0[12]) : (v0 && v1)) && ((a1[3][2] == v2) - (v3 ? v1 : v1)));
+    } else {
+        v1 = (((v2 == a1[2][0]) < (a1[2][8] && a0[9])) > ((36 && v1) >= (v3 + v3)));
+        v0 = (((v3 * v0) + (15 > v0)) - ((v0 == v2) <= (a0[15] * a0[6])));
+        a1[0][7] = (((73 != v0) >= (3 >= v3)) && ((a0[10] > v0) + (93 * v1)));
+    }
+    v1 = (((51 >= v2) / 3) || ((59 / 8) < (a1[2][3] >= a1[3][13])));
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+            a1[1][7] = (((v0 - v0) <= (a1[0][10] && i8)) < ((a0[12] / 2) >= (55 ? v2 : a0[10])));
+            a1[1][3] = (((i9 + 15) ? (i8 >= 91) : (25 || i8)) > ((a1[3][10] % 5) % 5));
+            a1[1][0] = (((a1[0][8] / 7) - (a0[14] < v1)) == ((i8 >= a1[1][7]) ? (i8 == a1[2][3]) : (v3 ? a1[2][10] : v3)));
+        }
+        a0[6] = (((v3 != a0[4]) > (a0[6] && v3)) > ((v1 > v2) + (50 ? 42 : v1)));
+        v3 = (((25 > a1[2][14]) % 8) - ((55 % 8) % 3));
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        v3 = (((v2 - 66) > (58 - a1[3][12])) - ((a1[1][2] <= a0[3]) / 3));
+        v2 = (((i10 * v3) > (a1[3][14] <= 22)) >= ((v1 * v3) * (a0[14] % 3)));
+        {
+            int i11 = 0;
+            while (i11 < 5) {
+                v2 = (((v1 + a1[1][12]) ? (v1 == v1) : (v0 * v3)) - ((v1 - v3) != (v3 + v3)));
+                v0 = (((94 % 1) != (a1[0][14] >= v2)) && ((a0[4] <= v0) >= (v3 > i11)));
+                v0 = (((a0[8] * v1) && (i10 <= v0)) * ((50 < v2) * (78 > v0)));
+                i11 = i11 + 1;
+            }
+        }
+    }
+    return (((v1 % 1) != (a1[1][2] <= v0)) + ((v0 && v3) && (51 - v3)));
+}
+int f2() {
+    int v0 = 39;
+    int v1 = 33;
+    int v2 = 19;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    if ((((25 && 68) / 5) - ((v2 && 40) ? (v3 < a0[2]) : (59 <= v3)))) {
+        v0 = (((87 % 8) == (v1 - a1[1][15])) >= ((v3 - a1[1][15]) <= (46 && a0[9])));
+        a1[0][6] = (((a1[1][9] % 5) <= (v1 % 5)) % 5);
+        v0 = (((v0 != 20) * (50 <= v1)) ? ((77 == 58) || (a0[2] == v1)) : ((v1 != v0) / 8));
+    } else {
+        a0[14] = (((v3 > 71) > (v0 != v1)) && ((v1 % 7) % 1));
+        v1 = (((a1[3][3] == v3) && (v1 <= v3)) ? ((v3 * a1[2][14]) ? (v1 ? a0[11] : v3) : (v0 / 3)) : ((v0 != v2) && (81 / 9)));
+        v1 = (((56 % 5) % 8) / 7);
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v1 = (((v1 % 2) % 2) < ((a1[2][1] == a1[1][14]) && (65 > v3)));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                a0[15] = (((i0 == v0) + (a0[3] || v0)) < ((v2 && a0[8]) % 4));
+                a0[1] = (((a1[0][2] ? v2 : 44) && (i0 - 31)) % 4);
+                v1 = (((23 + 30) || (a1[1][1] ? 80 : v0)) || ((i1 - 31) == (71 + 1)));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((a1[1][3] / 6) <= (a1[1][3] >= v3)) || ((a0[8] > v0) ? (54 ? v1 : a0[3]) : (v3 / 3)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((60 / 5) && (v3 >= v1)) <= ((v2 <= a0[1]) != (v1 / 3)));
+        {
+            int i3 = 0;
+            do {
+                if ((a1[1][9] != v2) > 76) break;
+                v1 = (((a1[2][3] < v2) > (v2 / 6)) == ((76 - i2) > (45 % 5)));
+                a0[15] = (((76 == 31) != (i3 <= 51)) * ((i3 > i2) && (a1[0][13] == 70)));
+                a0[4] = (((v0 == v0) < (a1[2][2] < 17)) * ((v0 >= 64) ? (v1 * v3) : (a0[14] % 5)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v1 = (((a1[3][4] && 84) <= (v3 || 52)) || ((v3 >= a0[12]) % 6));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v1 || 53) > 91) break;
+            v1 = (((v2 ? v3 : v1) - (v1 == i4)) <= ((v1 != v3) ? (v0 ? a0[1] : v3) : (a0[7] > i4)));
+            {
+                int i5 = 0;
+                do {
+                    if ((68 ? a0[2] : v0) > 80) break;
+                    a1[0][5] = (((86 ? i4 : v0) == (i5 <= v3)) ? ((v2 < 81) <= (a1[0][12] ? v0 : v1)) : ((a0[15] / 1) ? (i4 && v3) : (a0[10] && v0)));
+                    v0 = (((v0 != a1[0][11]) - (a0[8] <= i5)) > ((v3 < v3) != (a0[12] ? v1 : 95)));
+                    v2 = (((i4 + a1[1][7]) || (a0[14] >= i5)) >= ((v1 * a0[2]) <= (v1 % 2)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v2 = (((a0[4] || i4) <= (v3 < a0[1])) == ((i4 + a0[7]) < (a0[15] && v3)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    v2 = (((v2 >= v0) && (v2 - v0)) ? ((v3 - v1) == (v2 <= 55)) : ((v3 >= v1) / 1));
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v0 = (((v0 / 8) * (a0[14] > v2)) + ((15 != a1[0][11]) != (v2 > v3)));
+                v0 = (((a0[1] != a1[0][6]) >= (7 > v2)) ? ((a0[0] > v3) - (a0[5] * i6)) : ((32 != v2) - (i6 && v2)));
+                a1[0][3] = (((15 == v3) == (a0[9] % 2)) ? ((a0[5] * a1[0][9]) || (v0 > 57)) : ((v2 <= v3) <= (0 / 2)));
+            }
+            v0 = (((i6 % 7) ? (19 % 9) : (v3 % 8)) / 1);
+            a0[0] = (((v2 < a1[0][14]) <= (a0[14] / 8)) && ((39 == 68) <= (35 % 9)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                v1 = (((i8 > v1) > (v3 - a1[0][5])) + ((v3 || 74) + (a0[14] || i9)));
+                v2 = (((62 && i8) % 7) ? ((2 / 3) <= (43 >= a1[0][15])) : ((a0[14] ? 96 : v2) * (i9 <= v3)));
+                a0[8] = (((32 / 9) ? (i8 >= i8) : (52 > a0[4])) != ((a0[11] && 6) + (v0 <= v1)));
+                i9 = i9 + 1;
+            } while (i9 < 7);
+        }
+        v2 = (((44 - v1) ? (a1[0][9] != v2) : (v0 * v2)) > ((a0[3] >= a1[0][1]) % 2));
+        v0 = (((v3 / 7) >= (16 != i8)) == ((v1 ? v3 : i8) % 4));
+    }
+    {
+        int i10 = 0;
+        do {
+            v3 = (((a1[3][9] <= 29) ? (v3 + v3) : (v3 ? 54 : v2)) && ((61 ? 2 : v0) ? (a0[7] ? 48 : i10) : (56 % 6)));
+            for (int i11 = 0; i11 < 2; i11 = i11 + 1) {
+                if ((v3 || v3) > 51) break;
+                v0 = (((a1[0][1] >= v3) % 4) / 6);
+                v3 = (((a0[12] + a0[10]) ? (92 > 79) : (53 || 5)) * ((45 || i10) ? (v3 / 9) : (a0[10] == 69)));
+                a0[14] = (((v3 * v2) > (v3 ? v0 : v1)) + ((v2 < 38) >= (v2 + 8)));
+            }
+            v3 = (((a0[10] < v2) && (v3 >= i10)) >= ((i10 > v3) % 5));
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    if ((((a0[9] % 1) == (a1[0][6] ? v3 : a0[6])) <= ((v3 % 5) == (v1 != v2)))) {
+        v0 = (((v3 < v3) >= (v2 < v3)) != ((v2 ? v1 : v1) < (a1[3][11] + a0[4])));
+        v0 = (((69 - 16) - (v3 - a0[13])) % 1);
+        v1 = (((v3 != v1) ? (v2 != v3) : (71 || a1[1][11])) == ((v1 >= a1[2][13]) * (4 ? v0 : v2)));
+    } else {
+        a1[1][1] = (((v3 ? 77 : v1) || (v1 < v3)) != ((a0[15] && a0[2]) * (a0[11] != 80)));
+        v1 = (((v2 * v2) * (v3 ? v2 : 24)) ? ((a0[10] < a1[3][1]) || (v3 >= 65)) : ((a1[0][11] == v2) / 9));
+        a1[2][13] = (((v1 % 3) ? (v1 != 98) : (62 ? v2 : 23)) || ((v2 == 38) >= (v3 < 25)));
+    }
+    {
+        int i12 = 0;
+        while (i12 < 7) {
+            {
+                int i13 = 0;
+                while (i13 < 3) {
+                    if ((v3 < v3) > 71) break;
+                    a0[3] = (((i13 ? 23 : v1) > (0 - i13)) == ((v3 % 6) * (v2 / 8)));
+                    v3 = (((v0 / 5) && (37 == v3)) / 7);
+                    v2 = (((v0 <= 50) + (v3 / 7)) - ((10 >= i12) - (i12 == 65)));
+                    i13 = i13 + 1;
+                }
+            }
+            v1 = (((i12 * v3) ? (i12 == a0[11]) : (a0[4] + i12)) == ((v3 > i12) || (7 + 41)));
+            v3 = (((v1 && a0[12]) && (v3 - v0)) + ((v3 > a1[3][8]) ? (v0 || 29) : (78 || v0)));
+            i12 = i12 + 1;
+        }
+    }
+    return (((a1[1][1] / 6) + (64 - 72)) - ((v0 - 28) == (a0[4] ? v0 : v2)));
+}
+int f3() {
+    int v0 = 58;
+    int v1 = 67;
+    int v2 = 16;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v1 = (((i0 - v1) ? (i0 * i1) : (v3 + 44)) == ((82 && a0[12]) > (a0[2] + 88)));
+                a1[3][13] = (((a0[14] ? 71 : 52) >= (a1[0][9] / 5)) % 2);
+                v0 = (((v2 >= i0) <= (i0 <= i1)) == ((a0[6] || v0) == (a1[3][6] && a1[2][15])));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        a1[1][4] = (((v3 > v3) <= (a1[3][0] || 55)) <= ((a1[0][14] + v3) != (v2 ? 94 : a1[0][14])));
+        v0 = (((v3 <= a1[2][11]) == (v3 >= a0[0])) - ((v3 / 6) == (a1[2][6] || v0)));
+    }
+    if ((((a1[0][15] && v2) * (v2 ? 17 : a1[1][15])) % 8)) {
+        a0[0] = (((a0[5] && a1[0][1]) + (v0 % 2)) ? ((a1[0][12] != 43) != (a1[3][9] ? v0 : 25)) : ((a1[0][13] < a0[11]) % 1));
+        v2 = (((0 ? a0[9] : a1[0][6]) % 2) % 5);
+        v2 = (((a1[1][5] ? v0 : v1) || (v1 - a1[2][15])) < ((v0 && v0) != (v1 / 3)));
+    } else {
+        a0[10] = (((v3 && 87) / 8) && ((v1 + a1[3][9]) == (v2 - v0)));
+        v1 = (((16 < 67) - (v3 + 68)) == ((v0 == v1) && (41 ? v2 : a0[9])));
+        v2 = (((a1[2][7] % 4) ? (v3 % 3) : (a1[2][9] ? v2 : v2)) && ((v1 - v3) <= (v2 <= a0[4])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((91 <= a1[2][6]) > 55) break;
+            v3 = (((v1 + 5) != (v0 ? i2 : 76)) > ((v3 * 86) % 4));
+            v2 = (((31 ? 67 : i2) / 8) ? ((v3 ? i2 : 24) * (a0[0] * a0[2])) : ((v2 >= 99) / 2));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((i2 && a1[3][15]) != (i3 ? v2 : i3)) < ((v2 + 6) - (v1 >= v3)));
+                    a0[13] = (((i3 % 1) >= (27 / 3)) >= ((i2 != v0) ? (a0[15] && v3) : (v3 < v0)));
+                    v1 = (((i3 ? v1 : v2) || (v3 ? v1 : a1[1][15])) / 3);
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v2 / 9) ? (83 && a0[4]) : (a1[3][9] || v3)) < ((v3 != v0) + (v0 - a0[14])));
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        if ((58 == 0) > 78) break;
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            a1[2][4] = (((a1[3][13] <= v3) >= (v0 + 44)) / 5);
+            v1 = (((v1 != a1[0][13]) - (v0 * a1[0][2])) / 1);
+            v3 = (((v1 <= v2) <= (a0[1] > v2)) >= ((a0[13] + v1) && (76 != a1[0][2])));
+        }
+        a1[2][12] = (((i4 - v3) != (a1[1][15] ? a0[12] : v3)) / 2);
+        v0 = (((v3 / 9) >= (v3 * v0)) % 8);
+    }
+    if ((((v1 < a1[1][4]) % 8) == ((v1 != v0) <= (32 > v1)))) {
+        a0[7] = (((v2 != v0) && (v1 % 1)) > ((56 || v1) == (21 > v1)));
+        v1 = (((v0 == v3) + (54 / 6)) != ((v2 ? v2 : v0) || (v1 ? 47 : v0)));
+        a1[2][8] = (((v1 - v2) / 7) != ((v2 <= v2) ? (v2 == a0[10]) : (a1[3][9] != 15)));
+    } else {
+        v0 = (((v3 >= v2) ? (v1 ? v1 : 58) : (v1 ? v3 : v1)) == ((v3 * a0[12]) || (a0[2] + v1)));
+        v1 = (((v0 * a1[2][9]) / 7) / 4);
+        v0 = (((v1 < v2) > (a0[15] - 5)) - ((v1 || v0) <= (v1 % 2)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((v3 + a0[11]) == (v3 ? v2 : v1)) == ((v1 - a0[11]) % 9));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                a1[1][8] = (((29 < i7) + (90 || v1)) || ((a0[2] > 2) + (v1 > a1[0][0])));
+                v3 = (((v0 <= i7) >= (i6 - i6)) > ((v3 >= v3) / 6));
+                v3 = (((v2 >= v3) <= (i7 * 38)) ? ((i6 > a1[3][7]) != (v3 < a0[11])) : ((a1[3][4] <= v1) ? (v0 < a0[3]) : (v0 < 15)));
+            }
+            v0 = (((v0 == v3) >= (a0[12] * v3)) / 3);
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            if ((91 + 73) > 60) break;
+            a0[12] = (((a1[2][14] - v2) == (a0[2] ? a0[1] : a0[13])) < ((a1[2][4] % 5) * (a0[11] < a0[4])));
+            v2 = (((97 % 5) * (v1 + v3)) || ((17 - v2) - (v2 * 12)));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                v1 = (((v0 ? 6 : i9) && (i9 || i8)) * ((49 == v2) / 3));
+                v2 = (((a1[0][7] * i9) * (v2 - a0[12])) == ((v2 <= v1) * (80 * a0[10])));
+                v2 = (((36 != i9) - (27 > i8)) % 8);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    a0[10] = (((v2 * 46) >= (a0[14] >= 64)) >= ((a1[2][2] != a0[1]) || (v1 ? v2 : 43)));
+    {
+        int i10 = 0;
+        while (i10 < 8) {
+            for (int i11 = 0; i11 < 6; i11 = i11 + 1) {
+                a1[2][7] = (((v3 - a0[2]) >= (i10 - a1[1][3])) || ((62 / 3) == (a0[10] < v3)));
+                a1[0][8] = (((v1 ? 83 : 10) + (74 % 5)) >= ((a0[5] % 2) + (v1 * a1[0][4])));
+                v0 = (((73 ? v2 : 70) >= (a0[6] * i10)) <= ((v2 == i10) ? (a1[2][2] || a1[1][6]) : (v0 >= v1)));
+            }
+            a1[3][7] = (((a1[0][11] ? 57 : v0) == (a1[0][9] == a1[2][8])) < ((v0 && a0[6]) >= (a0[11] > 90)));
+            v3 = (((v3 ? 14 : 88) * (v0 / 4)) + ((a1[1][11] % 3) ? (v1 && v2) : (33 - a0[4])));
+            i10 = i10 + 1;
+        }
+    }
+    return (((a1[0][12] / 4) ? (v3 % 2) : (a0[3] / 4)) % 3);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,10587 @@
+    .file 1 "build/bench/batch/f23.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 467 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 468 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 469 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 470 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 471 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 472 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 473 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $14, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $55, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $76, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $55, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    jmp .Lf0_4
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movq $7, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $93, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_5
+    jmp .Lf0_1
+.Lf0_5:
+    .loc 1 12 13
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_6
+    jmp .Lf0_7
+.Lf0_6:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_8
+.Lf0_7:
+    movslq -16(%rbp), %rax
+.Lf0_8:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 13 13
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_11
+.Lf0_10:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf0_11:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $33, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_13
+.Lf0_12:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_14
+.Lf0_13:
+    movslq -340(%rbp), %rax
+.Lf0_14:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 16 17
+    .p2align 4,,10
+.Lf0_17:
+    .loc 1 17 21
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_19
+.Lf0_20:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_19:
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_18
+    jmp .Lf0_15
+.Lf0_18:
+    .loc 1 18 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_22
+.Lf0_21:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_23
+.Lf0_22:
+    movslq -340(%rbp), %rax
+.Lf0_23:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 19 21
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_24
+    jmp .Lf0_25
+.Lf0_24:
+    movq $21, %rax
+    jmp .Lf0_26
+.Lf0_25:
+    movslq -44(%rbp), %rax
+.Lf0_26:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_27
+.Lf0_28:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $50, %rax
+    cmpq $0, %rax
+    jne .Lf0_29
+    jmp .Lf0_30
+.Lf0_29:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf0_31
+.Lf0_30:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf0_31:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_27:
+    movl %eax, -36(%rbp)
+    .loc 1 20 21
+    movq $90, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_33
+    jmp .Lf0_32
+.Lf0_33:
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_32:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 21 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_16:
+    .loc 1 22 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_17
+.Lf0_15:
+    addq $0, %rsp
+    .loc 1 24 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+.Lf0_4:
+    .loc 1 10 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 28 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 29 9
+    jmp .Lf0_37
+    .p2align 4,,10
+.Lf0_36:
+    .loc 1 31 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 32 17
+    jmp .Lf0_41
+    .p2align 4,,10
+.Lf0_40:
+    .loc 1 33 21
+    movslq -20(%rbp), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_46
+    jmp .Lf0_45
+.Lf0_46:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_45:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_42
+    jmp .Lf0_43
+.Lf0_42:
+    movq $9, %rax
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_48
+    jmp .Lf0_47
+.Lf0_48:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_47:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_44
+.Lf0_43:
+    movslq -340(%rbp), %rax
+    imulq $63, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_44:
+    movl %eax, -8(%rbp)
+    .loc 1 34 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_50
+    jmp .Lf0_49
+.Lf0_50:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_49:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_51
+    jmp .Lf0_52
+.Lf0_51:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf0_53
+.Lf0_52:
+    movslq -16(%rbp), %rax
+.Lf0_53:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_55
+    jmp .Lf0_54
+.Lf0_55:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_57
+    jmp .Lf0_56
+.Lf0_57:
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_56:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_54:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 35 21
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_61
+.Lf0_62:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_61:
+    cmpq $0, %rax
+    jne .Lf0_58
+    jmp .Lf0_59
+.Lf0_58:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_60
+.Lf0_59:
+    cmpl $56, -8(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_60:
+    push %rax
+    cmpl $86, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_64
+    jmp .Lf0_63
+.Lf0_64:
+    movslq -16(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_63:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 36 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_39:
+.Lf0_41:
+    .loc 1 32 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_40
+.Lf0_38:
+    addq $0, %rsp
+    .loc 1 39 13
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $98, %rax
+    cmpq $0, %rax
+    jne .Lf0_65
+    jmp .Lf0_66
+.Lf0_65:
+    movq $37, %rax
+    jmp .Lf0_67
+.Lf0_66:
+    movq $51, %rax
+.Lf0_67:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 40 13
+    movq $81, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 41 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_35:
+.Lf0_37:
+    .loc 1 29 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_36
+.Lf0_34:
+    addq $8, %rsp
+    .loc 1 44 5
+    movq $6, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_70
+    jmp .Lf0_69
+.Lf0_70:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_69:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_71
+    .loc 1 45 9
+    movq $5, %rax
+    push %rax
+    movq $54, %rax
+    imulq $50, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $50, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 46 9
+    movq $42, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $4, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_72
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -12(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_76
+.Lf0_75:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_77
+.Lf0_76:
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_77:
+    jmp .Lf0_74
+.Lf0_73:
+    movq $41, %rax
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $36, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_74:
+    movl %eax, -12(%rbp)
+    .loc 1 47 9
+    movq $4, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_68
+.Lf0_71:
+    .loc 1 49 9
+    movq $95, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_79
+.Lf0_78:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_84
+    jmp .Lf0_85
+.Lf0_84:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_86
+.Lf0_85:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf0_86:
+    cmpq $0, %rax
+    jne .Lf0_81
+    jmp .Lf0_82
+.Lf0_81:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_83
+.Lf0_82:
+    movq $47, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_87
+.Lf0_88:
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_87:
+.Lf0_83:
+    jmp .Lf0_80
+.Lf0_79:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_93
+.Lf0_92:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_94
+.Lf0_93:
+    movslq -20(%rbp), %rax
+.Lf0_94:
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_91
+.Lf0_90:
+    movq $82, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_96
+    jmp .Lf0_95
+.Lf0_96:
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_95:
+.Lf0_91:
+.Lf0_80:
+    movl %eax, -64(%rbp)
+    .loc 1 50 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_100
+    jmp .Lf0_101
+.Lf0_100:
+    movq $37, %rax
+    jmp .Lf0_102
+.Lf0_101:
+    movslq -16(%rbp), %rax
+.Lf0_102:
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_97
+    jmp .Lf0_98
+.Lf0_97:
+    cmpl $4, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_99
+.Lf0_98:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $3, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_99:
+    movl %eax, -16(%rbp)
+    .loc 1 51 9
+    cmpl $34, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_104
+.Lf0_103:
+    movq $25, %rax
+    jmp .Lf0_105
+.Lf0_104:
+    movslq -8(%rbp), %rax
+.Lf0_105:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_107
+    jmp .Lf0_106
+.Lf0_107:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $64, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_106:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_68:
+    .loc 1 54 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 55 9
+    .p2align 4,,10
+.Lf0_110:
+    .loc 1 56 13
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $58, %rax
+    cmpq $59, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 58 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 59 17
+    .p2align 4,,10
+.Lf0_113:
+    .loc 1 60 21
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $74, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_115
+    jmp .Lf0_114
+.Lf0_115:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    push %rax
+    movq $52, %rax
+    cmpq $27, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_114:
+    movl %eax, -8(%rbp)
+    .loc 1 61 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_118
+    jmp .Lf0_119
+.Lf0_118:
+    movq $74, %rax
+    jmp .Lf0_120
+.Lf0_119:
+    movslq -340(%rbp), %rax
+.Lf0_120:
+    push %rax
+    cmpl $88, -76(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $35, %rax
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_122
+.Lf0_121:
+    movq $1, %rax
+    jmp .Lf0_123
+.Lf0_122:
+    movq $25, %rax
+.Lf0_123:
+    push %rax
+    movq $65, %rax
+    cmpq $0, %rax
+    jne .Lf0_124
+    jmp .Lf0_125
+.Lf0_124:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_126
+.Lf0_125:
+    movq $57, %rax
+.Lf0_126:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 62 21
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_128
+    jmp .Lf0_127
+.Lf0_128:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_127:
+    push %rax
+    movq $6, %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 63 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_112:
+    .loc 1 64 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_113
+.Lf0_111:
+    addq $0, %rsp
+    .loc 1 66 13
+    movslq -8(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_130
+    jmp .Lf0_129
+.Lf0_130:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_131
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_133
+.Lf0_132:
+    movslq -340(%rbp), %rax
+.Lf0_133:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_129:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subq $14, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 67 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_109:
+    .loc 1 68 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_110
+.Lf0_108:
+    addq $8, %rsp
+    .loc 1 70 5
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_136
+    jmp .Lf0_135
+.Lf0_136:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_135:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf0_137
+    .loc 1 71 9
+    movq $8, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $46, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_140
+.Lf0_139:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_142
+    jmp .Lf0_141
+.Lf0_142:
+    movq $71, %rax
+    cmpq $0, %rax
+    jne .Lf0_143
+    jmp .Lf0_144
+.Lf0_143:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_145
+.Lf0_144:
+    movslq -4(%rbp), %rax
+.Lf0_145:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_141:
+.Lf0_140:
+    movl %eax, -4(%rbp)
+    .loc 1 72 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_146
+    jmp .Lf0_147
+.Lf0_146:
+    movq $3, %rax
+    jmp .Lf0_148
+.Lf0_147:
+    movslq -16(%rbp), %rax
+.Lf0_148:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 73 9
+    movq $1, %rax
+    push %rax
+    cmpl $34, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_149
+    jmp .Lf0_150
+.Lf0_149:
+    movslq -4(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_153
+    jmp .Lf0_152
+.Lf0_153:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_152:
+.Lf0_151:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_134
+.Lf0_137:
+    .loc 1 75 9
+    movq $39, %rax
+    imull -80(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_155
+    jmp .Lf0_154
+.Lf0_155:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_154:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_157
+    jmp .Lf0_156
+.Lf0_157:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_156:
+    push %rax
+    movq $86, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 76 9
+    movq $5, %rax
+    push %rax
+    movq $60, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_158
+    jmp .Lf0_159
+.Lf0_158:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_160
+.Lf0_159:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_161
+    jmp .Lf0_162
+.Lf0_161:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_163
+.Lf0_162:
+    movslq -16(%rbp), %rax
+.Lf0_163:
+.Lf0_160:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 77 9
+    movslq -16(%rbp), %rax
+    subl -48(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_165
+.Lf0_164:
+    movq $34, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_166
+.Lf0_165:
+    movq $48, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_166:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_167
+.Lf0_168:
+    movq $84, %rax
+    cmpq $47, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -24(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_167:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_134:
+    .loc 1 79 5
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $75, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $58, -40(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 81 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 82 9
+    .p2align 4,,10
+.Lf0_171:
+    .loc 1 84 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 85 17
+    jmp .Lf0_175
+    .p2align 4,,10
+.Lf0_174:
+    .loc 1 86 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_176
+    jmp .Lf0_172
+.Lf0_176:
+    .loc 1 87 21
+    movslq -36(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $14, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    subq $93, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -36(%rbp), %rax
+    jmp .Lf0_181
+.Lf0_180:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf0_181:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 88 21
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_186
+    jmp .Lf0_185
+.Lf0_186:
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_185:
+    cmpq $0, %rax
+    jne .Lf0_182
+    jmp .Lf0_183
+.Lf0_182:
+    movq $4, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $86, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_184
+.Lf0_183:
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_184:
+    movl %eax, -4(%rbp)
+    .loc 1 89 21
+    movslq -16(%rbp), %rax
+    imulq $75, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_187
+    jmp .Lf0_188
+.Lf0_187:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_189
+.Lf0_188:
+    movslq -16(%rbp), %rax
+.Lf0_189:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_191
+    jmp .Lf0_190
+.Lf0_191:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_190:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 90 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_173:
+.Lf0_175:
+    .loc 1 85 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_174
+.Lf0_172:
+    addq $0, %rsp
+    .loc 1 93 13
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $36, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_193
+    jmp .Lf0_192
+.Lf0_193:
+    movq $2, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_192:
+    movl %eax, -8(%rbp)
+    .loc 1 94 13
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $78, %rax
+    subq $93, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_195
+.Lf0_194:
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_196
+.Lf0_195:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_197
+    jmp .Lf0_198
+.Lf0_197:
+    movq $73, %rax
+    jmp .Lf0_199
+.Lf0_198:
+    movslq -64(%rbp), %rax
+.Lf0_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_196:
+    movl %eax, -12(%rbp)
+    .loc 1 95 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_170:
+    .loc 1 96 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_171
+.Lf0_169:
+    addq $8, %rsp
+    .loc 1 98 5
+    movq $4, %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_201
+.Lf0_202:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_201:
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf0_203
+    .loc 1 99 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_205
+    jmp .Lf0_204
+.Lf0_205:
+    movq $55, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $76, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_204:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 100 9
+    movq $1, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $86, %rax
+    subq $66, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_207
+.Lf0_206:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_210
+.Lf0_209:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf0_211
+.Lf0_210:
+    movslq -16(%rbp), %rax
+.Lf0_211:
+    push %rax
+    movq $11, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_208
+.Lf0_207:
+    movq $5, %rax
+    push %rax
+    movq $64, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $94, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_208:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 101 9
+    movq $27, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $37, -68(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_200
+.Lf0_203:
+    .loc 1 103 9
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_213
+.Lf0_212:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_216
+    jmp .Lf0_215
+.Lf0_216:
+    cmpl $68, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_215:
+    jmp .Lf0_214
+.Lf0_213:
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_218
+    jmp .Lf0_217
+.Lf0_218:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_217:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_214:
+    movl %eax, -16(%rbp)
+    .loc 1 104 9
+    movslq -4(%rbp), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_219
+    jmp .Lf0_220
+.Lf0_219:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_221
+.Lf0_220:
+    movslq -24(%rbp), %rax
+.Lf0_221:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_222
+    jmp .Lf0_223
+.Lf0_222:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_224
+.Lf0_223:
+    movq $82, %rax
+.Lf0_224:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_226
+    jmp .Lf0_225
+.Lf0_226:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_225:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 105 9
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_230
+    jmp .Lf0_231
+.Lf0_230:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_232
+.Lf0_231:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf0_232:
+    push %rax
+    movq $48, %rax
+    cmpq $11, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_227
+    jmp .Lf0_228
+.Lf0_227:
+    movq $3, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $11, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_229
+.Lf0_228:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_233
+    jmp .Lf0_234
+.Lf0_233:
+    movq $17, %rax
+    jmp .Lf0_235
+.Lf0_234:
+    movslq -8(%rbp), %rax
+.Lf0_235:
+    push %rax
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_237
+    jmp .Lf0_236
+.Lf0_237:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_236:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_229:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_200:
+    .loc 1 107 5
+    cmpl $53, -76(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_239
+    jmp .Lf0_238
+.Lf0_239:
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_238:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_241
+    jmp .Lf0_240
+.Lf0_241:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_240:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_242
+    jmp .Lf0_243
+.Lf0_242:
+    movq $53, %rax
+    jmp .Lf0_244
+.Lf0_243:
+    movslq -4(%rbp), %rax
+.Lf0_244:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 109 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 110 9
+    jmp .Lf0_248
+    .p2align 4,,10
+.Lf0_247:
+    .loc 1 111 13
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $19, %rax
+    cmpq $39, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 112 13
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $72, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_249
+.Lf0_250:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_249:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_252
+    jmp .Lf0_251
+.Lf0_252:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_251:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 113 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 114 17
+    movq $19, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_262
+    jmp .Lf0_261
+.Lf0_262:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_263
+    jmp .Lf0_264
+.Lf0_263:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_265
+.Lf0_264:
+    movslq -12(%rbp), %rax
+.Lf0_265:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_261:
+    cmpq $0, %rax
+    jne .Lf0_258
+    jmp .Lf0_259
+.Lf0_258:
+    cmpl $31, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_267
+    jmp .Lf0_266
+.Lf0_267:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_266:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_260
+.Lf0_259:
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_260:
+    movl %eax, -16(%rbp)
+    .loc 1 115 17
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $62, %rax
+    cmpq $0, %rax
+    jne .Lf0_268
+    jmp .Lf0_269
+.Lf0_268:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf0_270
+.Lf0_269:
+    movslq -340(%rbp), %rax
+.Lf0_270:
+    push %rax
+    cmpl $32, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 116 17
+    movq $72, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_272
+    jmp .Lf0_271
+.Lf0_272:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_271:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $1, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_257:
+    .loc 1 113 38
+    incl -344(%rbp)
+    .loc 1 114 17
+    movq $19, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_277
+    jmp .Lf0_276
+.Lf0_277:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_278
+    jmp .Lf0_279
+.Lf0_278:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_280
+.Lf0_279:
+    movslq -12(%rbp), %rax
+.Lf0_280:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_276:
+    cmpq $0, %rax
+    jne .Lf0_273
+    jmp .Lf0_274
+.Lf0_273:
+    cmpl $31, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_282
+    jmp .Lf0_281
+.Lf0_282:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_281:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_275
+.Lf0_274:
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_275:
+    movl %eax, -16(%rbp)
+    .loc 1 115 17
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $62, %rax
+    cmpq $0, %rax
+    jne .Lf0_283
+    jmp .Lf0_284
+.Lf0_283:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf0_285
+.Lf0_284:
+    movslq -340(%rbp), %rax
+.Lf0_285:
+    push %rax
+    cmpl $32, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 116 17
+    movq $72, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_287
+    jmp .Lf0_286
+.Lf0_287:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_286:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $1, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_256:
+    .loc 1 113 38
+    incl -344(%rbp)
+.Lf0_255:
+    addq $0, %rsp
+    .loc 1 118 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_246:
+.Lf0_248:
+    .loc 1 110 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_247
+.Lf0_245:
+    addq $8, %rsp
+    .loc 1 121 5
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_291
+    jmp .Lf0_292
+.Lf0_291:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_295
+    jmp .Lf0_294
+.Lf0_295:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_294:
+    jmp .Lf0_293
+.Lf0_292:
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_293:
+    cmpq $0, %rax
+    jne .Lf0_288
+    jmp .Lf0_289
+.Lf0_288:
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_290
+.Lf0_289:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_297
+    jmp .Lf0_296
+.Lf0_297:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_296:
+    push %rax
+    movq $43, %rax
+    cmpq $11, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_290:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 123 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 124 5
+    subq $8, %rsp
+    movq $18, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 125 5
+    movq $94, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 126 5
+    subq $8, %rsp
+    movq $50, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 127 5
+    movq $65, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 128 5
+    subq $64, %rsp
+    .loc 1 129 5
+    subq $256, %rsp
+    .loc 1 130 5
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_1
+    jmp .Lf1_2
+.Lf1_1:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_4
+    jmp .Lf1_5
+.Lf1_4:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_6
+.Lf1_5:
+    movq $35, %rax
+.Lf1_6:
+    jmp .Lf1_3
+.Lf1_2:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_3:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 131 5
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_7
+    jmp .Lf1_8
+.Lf1_7:
+    movq $9, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_9
+.Lf1_8:
+    cmpl $67, -12(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_9:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_11
+    jmp .Lf1_10
+.Lf1_11:
+    movslq -8(%rbp), %rax
+    imulq $21, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_10:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 133 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 134 9
+    .p2align 4,,10
+.Lf1_14:
+    .loc 1 136 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 137 17
+    jmp .Lf1_18
+    .p2align 4,,10
+.Lf1_17:
+    .loc 1 138 21
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_20
+    jmp .Lf1_19
+.Lf1_20:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_19:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_22
+    jmp .Lf1_21
+.Lf1_22:
+    movslq -28(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_21:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $96, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_24
+    jmp .Lf1_23
+.Lf1_24:
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_23:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 139 21
+    movslq -56(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 140 21
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $41, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 141 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_16:
+.Lf1_18:
+    .loc 1 137 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_17
+.Lf1_15:
+    addq $0, %rsp
+    .loc 1 144 13
+    movslq -12(%rbp), %rax
+    subq $83, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $90, %rax
+    cmpq $14, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -44(%rbp)
+    .loc 1 145 13
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_26
+    jmp .Lf1_25
+.Lf1_26:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_25:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 146 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_13:
+    .loc 1 147 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_14
+.Lf1_12:
+    addq $8, %rsp
+    .loc 1 149 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_32
+    .p2align 4,,10
+.Lf1_31:
+    .loc 1 150 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_33
+    jmp .Lf1_34
+.Lf1_33:
+    movslq -68(%rbp), %rax
+    jmp .Lf1_35
+.Lf1_34:
+    movslq -340(%rbp), %rax
+.Lf1_35:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 151 9
+    movq $6, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_39
+    jmp .Lf1_40
+.Lf1_39:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_41
+.Lf1_40:
+    movslq -28(%rbp), %rax
+.Lf1_41:
+    cmpq $0, %rax
+    jne .Lf1_36
+    jmp .Lf1_37
+.Lf1_36:
+    movslq -8(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_38
+.Lf1_37:
+    movslq -76(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_38:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 153 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 154 13
+    jmp .Lf1_45
+    .p2align 4,,10
+.Lf1_44:
+    .loc 1 155 17
+    movq $8, %rax
+    push %rax
+    movq $41, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_47
+    jmp .Lf1_46
+.Lf1_47:
+    movq $39, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_46:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 156 17
+    movq $47, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_49
+    jmp .Lf1_48
+.Lf1_49:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_48:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 157 17
+    movq $2, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_53
+.Lf1_52:
+    movslq -16(%rbp), %rax
+    subq $57, %rax
+    movslq %eax, %rax
+    jmp .Lf1_54
+.Lf1_53:
+    movslq -340(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_54:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_55
+    jmp .Lf1_56
+.Lf1_55:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_57
+.Lf1_56:
+    movslq -28(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_57:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 158 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_43:
+.Lf1_45:
+    .loc 1 154 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_44
+.Lf1_42:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_30:
+    .loc 1 149 30
+    incl -340(%rbp)
+.Lf1_32:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_31
+.Lf1_29:
+    addq $8, %rsp
+    .loc 1 162 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_63
+    .p2align 4,,10
+.Lf1_62:
+    .loc 1 163 9
+    movq $81, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $98, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_64
+    jmp .Lf1_60
+.Lf1_64:
+    .loc 1 164 9
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_66
+    jmp .Lf1_65
+.Lf1_66:
+    movslq -80(%rbp), %rax
+    imulq $21, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_65:
+    movl %eax, -12(%rbp)
+    .loc 1 165 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_69
+.Lf1_68:
+    movslq -4(%rbp), %rax
+.Lf1_69:
+    push %rax
+    movq $47, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_71
+    jmp .Lf1_70
+.Lf1_71:
+    movq $5, %rax
+    subq $52, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_72
+    jmp .Lf1_73
+.Lf1_72:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_76
+    jmp .Lf1_75
+.Lf1_76:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_75:
+.Lf1_74:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_70:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 167 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 168 13
+    .p2align 4,,10
+.Lf1_79:
+    .loc 1 169 17
+    cmpl $78, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -68(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_81
+.Lf1_80:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf1_82
+.Lf1_81:
+    movq $84, %rax
+.Lf1_82:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    movq $19, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 170 17
+    movq $2, %rax
+    push %rax
+    movq $93, %rax
+    cmpq $0, %rax
+    jne .Lf1_83
+    jmp .Lf1_84
+.Lf1_83:
+    movq $51, %rax
+    jmp .Lf1_85
+.Lf1_84:
+    movslq -16(%rbp), %rax
+.Lf1_85:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_87
+    jmp .Lf1_86
+.Lf1_87:
+    movq $72, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_86:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 171 17
+    movslq -12(%rbp), %rax
+    subq $84, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_88
+    jmp .Lf1_89
+.Lf1_88:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf1_90
+.Lf1_89:
+    movq $52, %rax
+.Lf1_90:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 172 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_78:
+    .loc 1 173 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_79
+.Lf1_77:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_61:
+    .loc 1 162 30
+    incl -340(%rbp)
+.Lf1_63:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_62
+.Lf1_60:
+    addq $8, %rsp
+    .loc 1 176 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_96
+    .p2align 4,,10
+.Lf1_95:
+    .loc 1 177 9
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_97
+    jmp .Lf1_93
+.Lf1_97:
+    .loc 1 179 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 180 13
+    jmp .Lf1_101
+    .p2align 4,,10
+.Lf1_100:
+    .loc 1 181 17
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_102
+    jmp .Lf1_98
+.Lf1_102:
+    .loc 1 182 17
+    cmpl $14, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_104
+    jmp .Lf1_103
+.Lf1_104:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_106
+    jmp .Lf1_105
+.Lf1_106:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_105:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_103:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 183 17
+    movslq -344(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_107
+    jmp .Lf1_108
+.Lf1_107:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_111
+.Lf1_110:
+    movq $92, %rax
+    jmp .Lf1_112
+.Lf1_111:
+    movslq -52(%rbp), %rax
+.Lf1_112:
+    jmp .Lf1_109
+.Lf1_108:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_109:
+    push %rax
+    movq $56, %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movq $12, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -40(%rbp)
+    .loc 1 184 17
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $12, %rax
+    cmpq $14, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -72(%rbp), %rax
+    addq $57, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 185 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_99:
+.Lf1_101:
+    .loc 1 180 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_100
+.Lf1_98:
+    addq $0, %rsp
+    .loc 1 188 9
+    movq $4, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $34, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_116
+    jmp .Lf1_115
+.Lf1_116:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_117
+.Lf1_118:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_119
+    jmp .Lf1_120
+.Lf1_119:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_121
+.Lf1_120:
+    movslq -12(%rbp), %rax
+.Lf1_121:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_117:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_115:
+    movl %eax, -4(%rbp)
+    .loc 1 189 9
+    movq $8, %rax
+    push %rax
+    movq $91, %rax
+    cmpq $28, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_122
+    jmp .Lf1_123
+.Lf1_122:
+    movq $2, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_124
+.Lf1_123:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_126
+    jmp .Lf1_125
+.Lf1_126:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_125:
+.Lf1_124:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_94:
+    .loc 1 176 30
+    incl -340(%rbp)
+.Lf1_96:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_95
+.Lf1_93:
+    addq $8, %rsp
+    .loc 1 191 5
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_129
+    jmp .Lf1_128
+.Lf1_129:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_128:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_130
+    jmp .Lf1_131
+.Lf1_130:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_132
+.Lf1_131:
+    movq $55, %rax
+.Lf1_132:
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_133
+    jmp .Lf1_134
+.Lf1_133:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_135
+.Lf1_134:
+    movq $37, %rax
+.Lf1_135:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_136
+    .loc 1 192 9
+    movq $9, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_137
+    jmp .Lf1_138
+.Lf1_137:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_139
+.Lf1_138:
+    movslq -4(%rbp), %rax
+.Lf1_139:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_141
+    jmp .Lf1_140
+.Lf1_141:
+    movslq -20(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_140:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 193 9
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_143
+    jmp .Lf1_142
+.Lf1_143:
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_145
+    jmp .Lf1_144
+.Lf1_145:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_144:
+    push %rax
+    cmpl $4, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_142:
+    movl %eax, -16(%rbp)
+    .loc 1 194 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_146
+    jmp .Lf1_147
+.Lf1_146:
+    movslq -12(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_148
+.Lf1_147:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_150
+    jmp .Lf1_149
+.Lf1_150:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_149:
+.Lf1_148:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_152
+    jmp .Lf1_151
+.Lf1_152:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_154
+.Lf1_153:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_155
+.Lf1_154:
+    movslq -8(%rbp), %rax
+.Lf1_155:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_151:
+    movl %eax, -24(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_127
+.Lf1_136:
+    .loc 1 196 9
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_157
+    jmp .Lf1_156
+.Lf1_157:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_156:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_159
+    jmp .Lf1_158
+.Lf1_159:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_158:
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 197 9
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -20(%rbp), %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $15, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 198 9
+    movq $73, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $3, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_161
+    jmp .Lf1_160
+.Lf1_161:
+    movq $93, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_160:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_127:
+    .loc 1 200 5
+    movq $3, %rax
+    push %rax
+    movq $51, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_163
+    jmp .Lf1_162
+.Lf1_163:
+    movq $8, %rax
+    push %rax
+    movq $59, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_162:
+    movl %eax, -8(%rbp)
+    .loc 1 201 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_169
+    .p2align 4,,10
+.Lf1_168:
+    .loc 1 202 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_175
+    .p2align 4,,10
+.Lf1_174:
+    .loc 1 203 13
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_177
+    jmp .Lf1_176
+.Lf1_177:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_176:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $55, %rax
+    cmpq $0, %rax
+    jne .Lf1_178
+    jmp .Lf1_179
+.Lf1_178:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_180
+.Lf1_179:
+    movslq -40(%rbp), %rax
+.Lf1_180:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 204 13
+    movslq -344(%rbp), %rax
+    addq $15, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_181
+    jmp .Lf1_182
+.Lf1_181:
+    cmpl $91, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_183
+.Lf1_182:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_185
+    jmp .Lf1_184
+.Lf1_185:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_184:
+.Lf1_183:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 205 13
+    movslq -24(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_187
+.Lf1_186:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_188
+.Lf1_187:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_189
+    jmp .Lf1_190
+.Lf1_189:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf1_191
+.Lf1_190:
+    movslq -16(%rbp), %rax
+.Lf1_191:
+.Lf1_188:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_173:
+    .loc 1 202 34
+    incl -344(%rbp)
+.Lf1_175:
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_174
+.Lf1_172:
+    addq $0, %rsp
+    .loc 1 207 9
+    movslq -16(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_193
+    jmp .Lf1_192
+.Lf1_193:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_192:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $50, %rax
+    cmpq $0, %rax
+    jne .Lf1_194
+    jmp .Lf1_195
+.Lf1_194:
+    movq $42, %rax
+    jmp .Lf1_196
+.Lf1_195:
+    movslq -8(%rbp), %rax
+.Lf1_196:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -56(%rbp)
+    .loc 1 208 9
+    movq $3, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $55, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $25, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_167:
+    .loc 1 201 30
+    incl -340(%rbp)
+.Lf1_169:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_168
+.Lf1_166:
+    addq $8, %rsp
+    .loc 1 210 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_202
+    .p2align 4,,10
+.Lf1_201:
+    .loc 1 211 9
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $66, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    movq $58, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 212 9
+    movslq -340(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 214 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 215 13
+    jmp .Lf1_206
+    .p2align 4,,10
+.Lf1_205:
+    .loc 1 216 17
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_207
+    jmp .Lf1_208
+.Lf1_207:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_209
+.Lf1_208:
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_209:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 217 17
+    movq $1, %rax
+    push %rax
+    movq $94, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_211
+    jmp .Lf1_210
+.Lf1_211:
+    movslq -64(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_210:
+    movl %eax, -4(%rbp)
+    .loc 1 218 17
+    movq $78, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $50, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_213
+    jmp .Lf1_212
+.Lf1_213:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_212:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 219 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_204:
+.Lf1_206:
+    .loc 1 215 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_205
+.Lf1_203:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_200:
+    .loc 1 210 32
+    incl -340(%rbp)
+.Lf1_202:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_201
+.Lf1_199:
+    addq $8, %rsp
+    .loc 1 223 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_215
+    jmp .Lf1_214
+.Lf1_215:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_214:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_217
+    jmp .Lf1_216
+.Lf1_217:
+    movq $51, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_216:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 225 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 226 5
+    subq $8, %rsp
+    movq $39, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 227 5
+    movq $33, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 228 5
+    subq $8, %rsp
+    movq $19, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 229 5
+    movq $89, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 230 5
+    subq $64, %rsp
+    .loc 1 231 5
+    subq $256, %rsp
+    .loc 1 232 5
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_6
+    jmp .Lf2_5
+.Lf2_6:
+    movq $40, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_5:
+    cmpq $0, %rax
+    jne .Lf2_2
+    jmp .Lf2_3
+.Lf2_2:
+    movslq -16(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_4
+.Lf2_3:
+    movq $59, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_4:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_8
+    jmp .Lf2_7
+.Lf2_8:
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_7:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_9
+    .loc 1 233 9
+    movq $8, %rax
+    push %rax
+    movq $87, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_11
+    jmp .Lf2_10
+.Lf2_11:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_10:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 234 9
+    movq $5, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 235 9
+    movq $50, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $20, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_12
+    jmp .Lf2_13
+.Lf2_12:
+    movq $77, %rax
+    cmpq $58, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_16
+    jmp .Lf2_15
+.Lf2_16:
+    movslq -72(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_15:
+    jmp .Lf2_14
+.Lf2_13:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_14:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_1
+.Lf2_9:
+    .loc 1 237 9
+    cmpl $71, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_18
+    jmp .Lf2_17
+.Lf2_18:
+    movq $1, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_17:
+    movl %eax, -24(%rbp)
+    .loc 1 238 9
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_23
+    jmp .Lf2_22
+.Lf2_23:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_22:
+    cmpq $0, %rax
+    jne .Lf2_19
+    jmp .Lf2_20
+.Lf2_19:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_24
+    jmp .Lf2_25
+.Lf2_24:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_27
+    jmp .Lf2_28
+.Lf2_27:
+    movslq -36(%rbp), %rax
+    jmp .Lf2_29
+.Lf2_28:
+    movslq -16(%rbp), %rax
+.Lf2_29:
+    jmp .Lf2_26
+.Lf2_25:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_26:
+    jmp .Lf2_21
+.Lf2_20:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_30
+.Lf2_31:
+    movq $9, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_30:
+.Lf2_21:
+    movl %eax, -8(%rbp)
+    .loc 1 239 9
+    movq $7, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_1:
+    .loc 1 241 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_37
+    .p2align 4,,10
+.Lf2_36:
+    .loc 1 242 9
+    movq $2, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_39
+    jmp .Lf2_38
+.Lf2_39:
+    movq $65, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_38:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 244 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 245 13
+    jmp .Lf2_43
+    .p2align 4,,10
+.Lf2_42:
+    .loc 1 246 17
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_45
+    jmp .Lf2_44
+.Lf2_45:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_44:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_47
+    jmp .Lf2_46
+.Lf2_47:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_46:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -20(%rbp)
+    .loc 1 247 17
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_48
+    jmp .Lf2_49
+.Lf2_48:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_50
+.Lf2_49:
+    movq $44, %rax
+.Lf2_50:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_52
+    jmp .Lf2_51
+.Lf2_52:
+    movslq -340(%rbp), %rax
+    subq $31, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_51:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 248 17
+    movq $23, %rax
+    addq $30, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_54
+    jmp .Lf2_53
+.Lf2_54:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_55
+    jmp .Lf2_56
+.Lf2_55:
+    movq $80, %rax
+    jmp .Lf2_57
+.Lf2_56:
+    movslq -4(%rbp), %rax
+.Lf2_57:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_53:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_59
+    jmp .Lf2_58
+.Lf2_59:
+    movslq -344(%rbp), %rax
+    subq $31, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $71, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_58:
+    movl %eax, -8(%rbp)
+    .loc 1 249 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_41:
+.Lf2_43:
+    .loc 1 245 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_42
+.Lf2_40:
+    addq $0, %rsp
+    .loc 1 252 9
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_61
+    jmp .Lf2_60
+.Lf2_61:
+    movslq -48(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_62
+    jmp .Lf2_63
+.Lf2_62:
+    movq $54, %rax
+    cmpq $0, %rax
+    jne .Lf2_65
+    jmp .Lf2_66
+.Lf2_65:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_67
+.Lf2_66:
+    movslq -68(%rbp), %rax
+.Lf2_67:
+    jmp .Lf2_64
+.Lf2_63:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_64:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_60:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_35:
+    .loc 1 241 30
+    incl -340(%rbp)
+.Lf2_37:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_36
+.Lf2_34:
+    addq $8, %rsp
+    .loc 1 254 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_73
+    .p2align 4,,10
+.Lf2_72:
+    .loc 1 255 9
+    movq $5, %rax
+    push %rax
+    movq $60, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_75
+    jmp .Lf2_74
+.Lf2_75:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_74:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 257 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 258 13
+    .p2align 4,,10
+.Lf2_78:
+    .loc 1 259 17
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $76, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_79
+    jmp .Lf2_76
+.Lf2_79:
+    .loc 1 260 17
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $76, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $45, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 261 17
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_80
+.Lf2_81:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_80:
+    push %rax
+    movq $76, %rax
+    cmpq $31, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $51, -344(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 262 17
+    cmpl $64, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_82
+    jmp .Lf2_83
+.Lf2_82:
+    movslq -8(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_84
+.Lf2_83:
+    movq $5, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_84:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $17, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 263 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_77:
+    .loc 1 264 22
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_78
+.Lf2_76:
+    addq $0, %rsp
+    .loc 1 266 9
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_86
+    jmp .Lf2_85
+.Lf2_86:
+    movq $84, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_85:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_88
+    jmp .Lf2_87
+.Lf2_88:
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_87:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_90
+    jmp .Lf2_89
+.Lf2_90:
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_89:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_71:
+    .loc 1 254 30
+    incl -340(%rbp)
+.Lf2_73:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_72
+.Lf2_70:
+    addq $8, %rsp
+    .loc 1 269 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 270 9
+    .p2align 4,,10
+.Lf2_93:
+    .loc 1 271 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_96
+    jmp .Lf2_95
+.Lf2_96:
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_95:
+    cmpq $91, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_94
+    jmp .Lf2_91
+.Lf2_94:
+    .loc 1 272 13
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_97
+    jmp .Lf2_98
+.Lf2_97:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_99
+.Lf2_98:
+    movslq -8(%rbp), %rax
+.Lf2_99:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_100
+    jmp .Lf2_101
+.Lf2_100:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_103
+    jmp .Lf2_104
+.Lf2_103:
+    movslq -76(%rbp), %rax
+    jmp .Lf2_105
+.Lf2_104:
+    movslq -16(%rbp), %rax
+.Lf2_105:
+    jmp .Lf2_102
+.Lf2_101:
+    movslq -52(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_102:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 274 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 275 17
+    .p2align 4,,10
+.Lf2_108:
+    .loc 1 276 21
+    movq $68, %rax
+    cmpq $0, %rax
+    jne .Lf2_110
+    jmp .Lf2_111
+.Lf2_110:
+    movslq -72(%rbp), %rax
+    jmp .Lf2_112
+.Lf2_111:
+    movslq -4(%rbp), %rax
+.Lf2_112:
+    cmpq $80, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_109
+    jmp .Lf2_106
+.Lf2_109:
+    .loc 1 277 21
+    movq $86, %rax
+    cmpq $0, %rax
+    jne .Lf2_116
+    jmp .Lf2_117
+.Lf2_116:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_118
+.Lf2_117:
+    movslq -4(%rbp), %rax
+.Lf2_118:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_113
+    jmp .Lf2_114
+.Lf2_113:
+    cmpl $81, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_119
+    jmp .Lf2_120
+.Lf2_119:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_121
+.Lf2_120:
+    movslq -8(%rbp), %rax
+.Lf2_121:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_115
+.Lf2_114:
+    movq $1, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_123
+.Lf2_122:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_126
+    jmp .Lf2_125
+.Lf2_126:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_125:
+    jmp .Lf2_124
+.Lf2_123:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_127
+.Lf2_128:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_127:
+.Lf2_124:
+.Lf2_115:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 278 21
+    movslq -48(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_129
+    jmp .Lf2_130
+.Lf2_129:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_131
+.Lf2_130:
+    movq $95, %rax
+.Lf2_131:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 279 21
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_133
+    jmp .Lf2_132
+.Lf2_133:
+    movslq -24(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_132:
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 280 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_107:
+    .loc 1 281 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_108
+.Lf2_106:
+    addq $0, %rsp
+    .loc 1 283 13
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_135
+    jmp .Lf2_134
+.Lf2_135:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_134:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_137
+    jmp .Lf2_136
+.Lf2_137:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_136:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 284 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_92:
+    .loc 1 285 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_93
+.Lf2_91:
+    addq $8, %rsp
+    .loc 1 287 5
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_142
+    jmp .Lf2_141
+.Lf2_142:
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_141:
+    cmpq $0, %rax
+    jne .Lf2_138
+    jmp .Lf2_139
+.Lf2_138:
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $55, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_140
+.Lf2_139:
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_140:
+    movl %eax, -12(%rbp)
+    .loc 1 289 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 290 9
+    jmp .Lf2_146
+    .p2align 4,,10
+.Lf2_145:
+    .loc 1 291 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_152
+    .p2align 4,,10
+.Lf2_151:
+    .loc 1 292 17
+    movq $15, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 293 17
+    movslq -76(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_153
+    jmp .Lf2_154
+.Lf2_153:
+    movslq -60(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_155
+.Lf2_154:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_157
+    jmp .Lf2_156
+.Lf2_157:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_156:
+    push %rax
+    movq $32, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf2_155:
+    movl %eax, -4(%rbp)
+    .loc 1 294 17
+    movq $15, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_158
+    jmp .Lf2_159
+.Lf2_158:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_162
+    jmp .Lf2_161
+.Lf2_162:
+    cmpl $57, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_161:
+    jmp .Lf2_160
+.Lf2_159:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $0, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf2_160:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_150:
+    .loc 1 291 38
+    incl -344(%rbp)
+.Lf2_152:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_151
+.Lf2_149:
+    addq $0, %rsp
+    .loc 1 296 13
+    movq $1, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_163
+    jmp .Lf2_164
+.Lf2_163:
+    movq $9, %rax
+    push %rax
+    movq $19, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_165
+.Lf2_164:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_165:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 297 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_167
+    jmp .Lf2_166
+.Lf2_167:
+    movq $39, %rax
+    cmpq $68, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $35, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_166:
+    movl %eax, -80(%rbp)
+    .loc 1 298 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_144:
+.Lf2_146:
+    .loc 1 290 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_145
+.Lf2_143:
+    addq $8, %rsp
+    .loc 1 301 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_173
+    .p2align 4,,10
+.Lf2_172:
+    .loc 1 303 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 304 13
+    .p2align 4,,10
+.Lf2_176:
+    .loc 1 305 17
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_178
+    jmp .Lf2_177
+.Lf2_178:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_177:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_180
+    jmp .Lf2_179
+.Lf2_180:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_179:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 306 17
+    movq $7, %rax
+    push %rax
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_185
+    jmp .Lf2_184
+.Lf2_185:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_184:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_181
+    jmp .Lf2_182
+.Lf2_181:
+    movq $3, %rax
+    push %rax
+    movq $2, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $43, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_183
+.Lf2_182:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_186
+    jmp .Lf2_187
+.Lf2_186:
+    movq $96, %rax
+    jmp .Lf2_188
+.Lf2_187:
+    movslq -12(%rbp), %rax
+.Lf2_188:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf2_183:
+    movl %eax, -12(%rbp)
+    .loc 1 307 17
+    movq $9, %rax
+    push %rax
+    movq $32, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_189
+    jmp .Lf2_190
+.Lf2_189:
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_191
+.Lf2_190:
+    movq $52, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_191:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_193
+    jmp .Lf2_192
+.Lf2_193:
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_192:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -48(%rbp)
+    .loc 1 308 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_175:
+    .loc 1 309 22
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_176
+.Lf2_174:
+    addq $0, %rsp
+    .loc 1 311 9
+    movq $44, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_194
+    jmp .Lf2_195
+.Lf2_194:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_196
+.Lf2_195:
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_196:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 312 9
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $16, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_197
+    jmp .Lf2_198
+.Lf2_197:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_199
+.Lf2_198:
+    movslq -340(%rbp), %rax
+.Lf2_199:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_171:
+    .loc 1 301 30
+    incl -340(%rbp)
+.Lf2_173:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_172
+.Lf2_170:
+    addq $8, %rsp
+    .loc 1 315 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 316 9
+    .p2align 4,,10
+.Lf2_202:
+    .loc 1 317 13
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $29, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_203
+    jmp .Lf2_204
+.Lf2_203:
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_205
+.Lf2_204:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_206
+    jmp .Lf2_207
+.Lf2_206:
+    movq $54, %rax
+    jmp .Lf2_208
+.Lf2_207:
+    movslq -12(%rbp), %rax
+.Lf2_208:
+.Lf2_205:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_210
+    jmp .Lf2_209
+.Lf2_210:
+    movq $61, %rax
+    cmpq $0, %rax
+    jne .Lf2_214
+    jmp .Lf2_215
+.Lf2_214:
+    movq $2, %rax
+    jmp .Lf2_216
+.Lf2_215:
+    movslq -4(%rbp), %rax
+.Lf2_216:
+    cmpq $0, %rax
+    jne .Lf2_211
+    jmp .Lf2_212
+.Lf2_211:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_217
+    jmp .Lf2_218
+.Lf2_217:
+    movq $48, %rax
+    jmp .Lf2_219
+.Lf2_218:
+    movslq -340(%rbp), %rax
+.Lf2_219:
+    jmp .Lf2_213
+.Lf2_212:
+    movq $6, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_213:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_209:
+    movl %eax, -16(%rbp)
+    .loc 1 318 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 319 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_227
+    jmp .Lf2_226
+.Lf2_227:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_226:
+    cmpq $51, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_225
+    jmp .Lf2_222
+.Lf2_225:
+    .loc 1 320 17
+    movq $6, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 321 17
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_232
+    jmp .Lf2_231
+.Lf2_232:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_231:
+    cmpq $0, %rax
+    jne .Lf2_228
+    jmp .Lf2_229
+.Lf2_228:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_230
+.Lf2_229:
+    cmpl $69, -40(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf2_230:
+    push %rax
+    movslq -32(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_233
+    jmp .Lf2_234
+.Lf2_233:
+    movq $92, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_235
+.Lf2_234:
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_237
+    jmp .Lf2_236
+.Lf2_237:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_236:
+.Lf2_235:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 322 17
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_238
+    jmp .Lf2_239
+.Lf2_238:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_240
+.Lf2_239:
+    movslq -8(%rbp), %rax
+.Lf2_240:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    addq $0, %rsp
+.Lf2_224:
+    .loc 1 318 40
+    incl -344(%rbp)
+    .loc 1 319 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_243
+    jmp .Lf2_242
+.Lf2_243:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_242:
+    cmpq $51, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_241
+    jmp .Lf2_222
+.Lf2_241:
+    .loc 1 320 17
+    movq $6, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 321 17
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_248
+    jmp .Lf2_247
+.Lf2_248:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_247:
+    cmpq $0, %rax
+    jne .Lf2_244
+    jmp .Lf2_245
+.Lf2_244:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_246
+.Lf2_245:
+    cmpl $69, -40(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf2_246:
+    push %rax
+    movslq -32(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_249
+    jmp .Lf2_250
+.Lf2_249:
+    movq $92, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_251
+.Lf2_250:
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_253
+    jmp .Lf2_252
+.Lf2_253:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_252:
+.Lf2_251:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 322 17
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_254
+    jmp .Lf2_255
+.Lf2_254:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_256
+.Lf2_255:
+    movslq -8(%rbp), %rax
+.Lf2_256:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    addq $0, %rsp
+.Lf2_223:
+    .loc 1 318 40
+    incl -344(%rbp)
+.Lf2_222:
+    addq $0, %rsp
+    .loc 1 324 13
+    movslq -40(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_258
+    jmp .Lf2_257
+.Lf2_258:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_257:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 325 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_201:
+    .loc 1 326 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_202
+.Lf2_200:
+    addq $8, %rsp
+    .loc 1 328 5
+    movq $1, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_260
+    jmp .Lf2_261
+.Lf2_260:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_262
+.Lf2_261:
+    movslq -56(%rbp), %rax
+.Lf2_262:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf2_263
+    .loc 1 329 9
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_264
+    jmp .Lf2_265
+.Lf2_264:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_266
+.Lf2_265:
+    movslq -8(%rbp), %rax
+.Lf2_266:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    addl -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 330 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $69, %rax
+    subq $16, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 331 9
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_267
+    jmp .Lf2_268
+.Lf2_267:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_269
+.Lf2_268:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_271
+    jmp .Lf2_270
+.Lf2_271:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_270:
+.Lf2_269:
+    push %rax
+    movq $4, %rax
+    cmpq $0, %rax
+    jne .Lf2_272
+    jmp .Lf2_273
+.Lf2_272:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_274
+.Lf2_273:
+    movslq -12(%rbp), %rax
+.Lf2_274:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_259
+.Lf2_263:
+    .loc 1 333 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_275
+    jmp .Lf2_276
+.Lf2_275:
+    movq $77, %rax
+    jmp .Lf2_277
+.Lf2_276:
+    movslq -8(%rbp), %rax
+.Lf2_277:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_279
+    jmp .Lf2_278
+.Lf2_279:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_278:
+    push %rax
+    cmpl $80, -36(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_281
+    jmp .Lf2_280
+.Lf2_281:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_280:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 334 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_285
+    jmp .Lf2_286
+.Lf2_285:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_287
+.Lf2_286:
+    movq $24, %rax
+.Lf2_287:
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_282
+    jmp .Lf2_283
+.Lf2_282:
+    movslq -40(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_289
+    jmp .Lf2_288
+.Lf2_289:
+    cmpl $65, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_288:
+    jmp .Lf2_284
+.Lf2_283:
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_284:
+    movl %eax, -8(%rbp)
+    .loc 1 335 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_290
+    jmp .Lf2_291
+.Lf2_290:
+    cmpl $98, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_292
+.Lf2_291:
+    movq $62, %rax
+    cmpq $0, %rax
+    jne .Lf2_293
+    jmp .Lf2_294
+.Lf2_293:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_295
+.Lf2_294:
+    movq $23, %rax
+.Lf2_295:
+.Lf2_292:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_297
+    jmp .Lf2_296
+.Lf2_297:
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $25, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_296:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_259:
+    .loc 1 338 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 339 9
+    jmp .Lf2_301
+    .p2align 4,,10
+.Lf2_300:
+    .loc 1 341 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 342 17
+    jmp .Lf2_305
+    .p2align 4,,10
+.Lf2_304:
+    .loc 1 343 21
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_306
+    jmp .Lf2_302
+.Lf2_306:
+    .loc 1 344 21
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_307
+    jmp .Lf2_308
+.Lf2_307:
+    movq $23, %rax
+    jmp .Lf2_309
+.Lf2_308:
+    movslq -8(%rbp), %rax
+.Lf2_309:
+    push %rax
+    movq $0, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -68(%rbp)
+    .loc 1 345 21
+    movq $7, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_311
+    jmp .Lf2_310
+.Lf2_311:
+    movq $37, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_310:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 346 21
+    cmpl $65, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $10, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $50, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 347 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_303:
+.Lf2_305:
+    .loc 1 342 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_304
+.Lf2_302:
+    addq $0, %rsp
+    .loc 1 350 13
+    movslq -340(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_312
+    jmp .Lf2_313
+.Lf2_312:
+    movslq -340(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_314
+.Lf2_313:
+    movslq -64(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_314:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_316
+    jmp .Lf2_315
+.Lf2_316:
+    movq $7, %rax
+    addq $41, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_315:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 351 13
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_317
+    jmp .Lf2_318
+.Lf2_317:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_321
+    jmp .Lf2_320
+.Lf2_321:
+    movq $29, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_320:
+    jmp .Lf2_319
+.Lf2_318:
+    movq $78, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_323
+    jmp .Lf2_322
+.Lf2_323:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_322:
+.Lf2_319:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_325
+    jmp .Lf2_324
+.Lf2_325:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_324:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_327
+    jmp .Lf2_326
+.Lf2_327:
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_326:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 352 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_299:
+.Lf2_301:
+    .loc 1 339 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_300
+.Lf2_298:
+    addq $8, %rsp
+    .loc 1 355 5
+    movslq -4(%rbp), %rax
+    subq $28, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_328
+    jmp .Lf2_329
+.Lf2_328:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_330
+.Lf2_329:
+    movslq -12(%rbp), %rax
+.Lf2_330:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $64, %rax
+    subq $72, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 357 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 358 5
+    subq $8, %rsp
+    movq $58, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 359 5
+    movq $67, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 360 5
+    subq $8, %rsp
+    movq $16, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 361 5
+    movq $30, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 362 5
+    subq $64, %rsp
+    .loc 1 363 5
+    subq $256, %rsp
+    .loc 1 364 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_6
+    .p2align 4,,10
+.Lf3_5:
+    .loc 1 366 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 367 13
+    .p2align 4,,10
+.Lf3_9:
+    .loc 1 368 17
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_10
+    jmp .Lf3_11
+.Lf3_10:
+    movslq -340(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_12
+.Lf3_11:
+    movslq -16(%rbp), %rax
+    addq $44, %rax
+    movslq %eax, %rax
+.Lf3_12:
+    push %rax
+    movq $82, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_14
+    jmp .Lf3_13
+.Lf3_14:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_13:
+    push %rax
+    movslq -72(%rbp), %rax
+    addq $88, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 369 17
+    movq $2, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_15
+    jmp .Lf3_16
+.Lf3_15:
+    movq $71, %rax
+    jmp .Lf3_17
+.Lf3_16:
+    movq $52, %rax
+.Lf3_17:
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 370 17
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_19
+    jmp .Lf3_18
+.Lf3_19:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_18:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_21
+    jmp .Lf3_20
+.Lf3_21:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_20:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 371 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_8:
+    .loc 1 372 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_9
+.Lf3_7:
+    addq $0, %rsp
+    .loc 1 374 9
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_23
+    jmp .Lf3_22
+.Lf3_23:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_22:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_24
+    jmp .Lf3_25
+.Lf3_24:
+    movq $94, %rax
+    jmp .Lf3_26
+.Lf3_25:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf3_26:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 375 9
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_28
+    jmp .Lf3_27
+.Lf3_28:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_27:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_4:
+    .loc 1 364 30
+    incl -340(%rbp)
+.Lf3_6:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_5
+.Lf3_3:
+    addq $8, %rsp
+    .loc 1 377 5
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_30
+    jmp .Lf3_31
+.Lf3_30:
+    movq $17, %rax
+    jmp .Lf3_32
+.Lf3_31:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf3_32:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_34
+    jmp .Lf3_33
+.Lf3_34:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_33:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_35
+    .loc 1 378 9
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_40
+    jmp .Lf3_39
+.Lf3_40:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_39:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_36
+    jmp .Lf3_37
+.Lf3_36:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $43, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_41
+    jmp .Lf3_42
+.Lf3_41:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_43
+.Lf3_42:
+    movq $25, %rax
+.Lf3_43:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_38
+.Lf3_37:
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_38:
+    movl %eax, -80(%rbp)
+    .loc 1 379 9
+    movq $5, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $0, %rax
+    cmpq $0, %rax
+    jne .Lf3_44
+    jmp .Lf3_45
+.Lf3_44:
+    movslq -44(%rbp), %rax
+    jmp .Lf3_46
+.Lf3_45:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf3_46:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 380 9
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_47
+    jmp .Lf3_48
+.Lf3_47:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_49
+.Lf3_48:
+    movslq -8(%rbp), %rax
+.Lf3_49:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_51
+    jmp .Lf3_50
+.Lf3_51:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_50:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_53
+    jmp .Lf3_52
+.Lf3_53:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_52:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_29
+.Lf3_35:
+    .loc 1 382 9
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_55
+    jmp .Lf3_54
+.Lf3_55:
+    movq $87, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_54:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_57
+    jmp .Lf3_56
+.Lf3_57:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_56:
+    movl %eax, -40(%rbp)
+    .loc 1 383 9
+    movslq -16(%rbp), %rax
+    addq $68, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $16, %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_59
+    jmp .Lf3_58
+.Lf3_59:
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf3_60
+    jmp .Lf3_61
+.Lf3_60:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_62
+.Lf3_61:
+    movslq -44(%rbp), %rax
+.Lf3_62:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_58:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 384 9
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_63
+    jmp .Lf3_64
+.Lf3_63:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_65
+.Lf3_64:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_66
+    jmp .Lf3_67
+.Lf3_66:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_68
+.Lf3_67:
+    movslq -12(%rbp), %rax
+.Lf3_68:
+.Lf3_65:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_70
+    jmp .Lf3_69
+.Lf3_70:
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_69:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_29:
+    .loc 1 387 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 388 9
+    jmp .Lf3_74
+    .p2align 4,,10
+.Lf3_73:
+    .loc 1 389 13
+    movq $91, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $55, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_75
+    jmp .Lf3_71
+.Lf3_75:
+    .loc 1 390 13
+    movslq -8(%rbp), %rax
+    addq $5, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_76
+    jmp .Lf3_77
+.Lf3_76:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_78
+.Lf3_77:
+    movq $76, %rax
+.Lf3_78:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $86, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 391 13
+    movq $8, %rax
+    push %rax
+    movq $31, %rax
+    cmpq $0, %rax
+    jne .Lf3_82
+    jmp .Lf3_83
+.Lf3_82:
+    movq $67, %rax
+    jmp .Lf3_84
+.Lf3_83:
+    movslq -340(%rbp), %rax
+.Lf3_84:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_79
+    jmp .Lf3_80
+.Lf3_79:
+    movslq -80(%rbp), %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_85
+    jmp .Lf3_86
+.Lf3_85:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_87
+.Lf3_86:
+    movq $24, %rax
+.Lf3_87:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_81
+.Lf3_80:
+    movq $2, %rax
+    push %rax
+    cmpl $99, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_81:
+    movl %eax, -12(%rbp)
+    .loc 1 393 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 394 17
+    .p2align 4,,10
+.Lf3_90:
+    .loc 1 395 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_92
+    jmp .Lf3_91
+.Lf3_92:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_91:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_93
+    jmp .Lf3_94
+.Lf3_93:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_95
+.Lf3_94:
+    movslq -344(%rbp), %rax
+.Lf3_95:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $6, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 396 21
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_96
+    jmp .Lf3_97
+.Lf3_96:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_100
+    jmp .Lf3_99
+.Lf3_100:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_99:
+    jmp .Lf3_98
+.Lf3_97:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf3_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -28(%rbp)
+    .loc 1 397 21
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_101
+    jmp .Lf3_102
+.Lf3_101:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_103
+.Lf3_102:
+    movslq -12(%rbp), %rax
+.Lf3_103:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_105
+    jmp .Lf3_104
+.Lf3_105:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_106
+    jmp .Lf3_107
+.Lf3_106:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_108
+.Lf3_107:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf3_108:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_104:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 398 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_89:
+    .loc 1 399 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_90
+.Lf3_88:
+    addq $0, %rsp
+    .loc 1 401 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_72:
+.Lf3_74:
+    .loc 1 388 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_73
+.Lf3_71:
+    addq $8, %rsp
+    .loc 1 404 5
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_109
+    jmp .Lf3_110
+.Lf3_109:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_113
+    jmp .Lf3_112
+.Lf3_113:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_112:
+    jmp .Lf3_111
+.Lf3_110:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_115
+    jmp .Lf3_114
+.Lf3_115:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_114:
+.Lf3_111:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 405 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_121
+    .p2align 4,,10
+.Lf3_120:
+    .loc 1 406 9
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $78, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_122
+    jmp .Lf3_118
+.Lf3_122:
+    .loc 1 407 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 408 13
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $44, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 409 13
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 410 13
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -28(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_129
+    jmp .Lf3_128
+.Lf3_129:
+    movq $76, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_128:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf3_127:
+    .loc 1 407 34
+    incl -344(%rbp)
+    .loc 1 408 13
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $44, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 409 13
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 410 13
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -28(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_131
+    jmp .Lf3_130
+.Lf3_131:
+    movq $76, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_130:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf3_126:
+    .loc 1 407 34
+    incl -344(%rbp)
+.Lf3_125:
+    addq $0, %rsp
+    .loc 1 412 9
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_132
+    jmp .Lf3_133
+.Lf3_132:
+    movslq -32(%rbp), %rax
+    jmp .Lf3_134
+.Lf3_133:
+    movslq -16(%rbp), %rax
+.Lf3_134:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 413 9
+    movq $8, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_119:
+    .loc 1 405 30
+    incl -340(%rbp)
+.Lf3_121:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_120
+.Lf3_118:
+    addq $8, %rsp
+    .loc 1 415 5
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $32, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lf3_136
+    .loc 1 416 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_138
+    jmp .Lf3_137
+.Lf3_138:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_137:
+    push %rax
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_140
+    jmp .Lf3_139
+.Lf3_140:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_139:
+    push %rax
+    movq $21, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -52(%rbp)
+    .loc 1 417 9
+    movq $6, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_141
+    jmp .Lf3_142
+.Lf3_141:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_143
+.Lf3_142:
+    movslq -4(%rbp), %rax
+.Lf3_143:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_145
+    jmp .Lf3_144
+.Lf3_145:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_146
+    jmp .Lf3_147
+.Lf3_146:
+    movq $47, %rax
+    jmp .Lf3_148
+.Lf3_147:
+    movslq -4(%rbp), %rax
+.Lf3_148:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_144:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 418 9
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf3_149
+    jmp .Lf3_150
+.Lf3_149:
+    movslq -12(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_151
+.Lf3_150:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $15, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_151:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf3_135
+.Lf3_136:
+    .loc 1 420 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_152
+    jmp .Lf3_153
+.Lf3_152:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_155
+    jmp .Lf3_156
+.Lf3_155:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_157
+.Lf3_156:
+    movq $58, %rax
+.Lf3_157:
+    jmp .Lf3_154
+.Lf3_153:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_158
+    jmp .Lf3_159
+.Lf3_158:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_160
+.Lf3_159:
+    movslq -8(%rbp), %rax
+.Lf3_160:
+.Lf3_154:
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -32(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_162
+    jmp .Lf3_161
+.Lf3_162:
+    movslq -72(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_161:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 421 9
+    movq $4, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 422 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_164
+    jmp .Lf3_163
+.Lf3_164:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_163:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -20(%rbp), %rax
+    subq $5, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_135:
+    .loc 1 425 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 426 9
+    .p2align 4,,10
+.Lf3_167:
+    .loc 1 427 13
+    movslq -16(%rbp), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_168
+    jmp .Lf3_169
+.Lf3_168:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_170
+.Lf3_169:
+    movslq -8(%rbp), %rax
+.Lf3_170:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 428 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_176
+    .p2align 4,,10
+.Lf3_175:
+    .loc 1 429 17
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_178
+    jmp .Lf3_177
+.Lf3_178:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_177:
+    push %rax
+    movq $29, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_180
+    jmp .Lf3_179
+.Lf3_180:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $2, -72(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_179:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 430 17
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 431 17
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -344(%rbp), %rax
+    imulq $38, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf3_181
+    jmp .Lf3_182
+.Lf3_181:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_183
+.Lf3_182:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf3_184
+    jmp .Lf3_185
+.Lf3_184:
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_186
+.Lf3_185:
+    cmpl $15, -4(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf3_186:
+.Lf3_183:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf3_174:
+    .loc 1 428 38
+    incl -344(%rbp)
+.Lf3_176:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_175
+.Lf3_173:
+    addq $0, %rsp
+    .loc 1 433 13
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 434 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_166:
+    .loc 1 435 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_167
+.Lf3_165:
+    addq $8, %rsp
+    .loc 1 438 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 439 9
+    jmp .Lf3_190
+    .p2align 4,,10
+.Lf3_189:
+    .loc 1 440 13
+    movq $91, %rax
+    addq $73, %rax
+    movslq %eax, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_191
+    jmp .Lf3_187
+.Lf3_191:
+    .loc 1 441 13
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_192
+    jmp .Lf3_193
+.Lf3_192:
+    movslq -76(%rbp), %rax
+    jmp .Lf3_194
+.Lf3_193:
+    movslq -28(%rbp), %rax
+.Lf3_194:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -32(%rbp)
+    .loc 1 442 13
+    movslq -8(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $97, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_196
+    jmp .Lf3_195
+.Lf3_196:
+    movslq -12(%rbp), %rax
+    imulq $12, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $17, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_195:
+    movl %eax, -12(%rbp)
+    .loc 1 443 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_202
+    .p2align 4,,10
+.Lf3_201:
+    .loc 1 444 17
+    movq $3, %rax
+    push %rax
+    movq $49, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_206
+    jmp .Lf3_207
+.Lf3_206:
+    movq $6, %rax
+    jmp .Lf3_208
+.Lf3_207:
+    movslq -344(%rbp), %rax
+.Lf3_208:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_210
+    jmp .Lf3_209
+.Lf3_210:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_212
+    jmp .Lf3_211
+.Lf3_212:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_211:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_209:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 445 17
+    movslq -12(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 446 17
+    movq $8, %rax
+    push %rax
+    movq $27, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $36, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_205:
+    .loc 1 443 38
+    incl -344(%rbp)
+    .loc 1 444 17
+    movq $3, %rax
+    push %rax
+    movq $49, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_213
+    jmp .Lf3_214
+.Lf3_213:
+    movq $6, %rax
+    jmp .Lf3_215
+.Lf3_214:
+    movslq -344(%rbp), %rax
+.Lf3_215:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_217
+    jmp .Lf3_216
+.Lf3_217:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_219
+    jmp .Lf3_218
+.Lf3_219:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_218:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_216:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 445 17
+    movslq -12(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 446 17
+    movq $8, %rax
+    push %rax
+    movq $27, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $36, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_204:
+    .loc 1 443 38
+    incl -344(%rbp)
+.Lf3_202:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $4, %rax
+    jl .Lf3_201
+.Lf3_203:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf3_199
+    .loc 1 444 17
+    movq $3, %rax
+    push %rax
+    movq $49, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_220
+    jmp .Lf3_221
+.Lf3_220:
+    movq $6, %rax
+    jmp .Lf3_222
+.Lf3_221:
+    movslq -344(%rbp), %rax
+.Lf3_222:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_224
+    jmp .Lf3_223
+.Lf3_224:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_226
+    jmp .Lf3_225
+.Lf3_226:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_225:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_223:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 445 17
+    movslq -12(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 446 17
+    movq $8, %rax
+    push %rax
+    movq $27, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $36, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_200:
+    .loc 1 443 38
+    incl -344(%rbp)
+    jmp .Lf3_203
+.Lf3_199:
+    addq $0, %rsp
+    .loc 1 448 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_188:
+.Lf3_190:
+    .loc 1 439 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_189
+.Lf3_187:
+    addq $8, %rsp
+    .loc 1 451 5
+    movslq -12(%rbp), %rax
+    imulq $46, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $64, -24(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_228
+    jmp .Lf3_227
+.Lf3_228:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_229
+    jmp .Lf3_230
+.Lf3_229:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_231
+.Lf3_230:
+    movq $43, %rax
+.Lf3_231:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_227:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -40(%rbp)
+    .loc 1 453 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 454 9
+    jmp .Lf3_235
+    .p2align 4,,10
+.Lf3_234:
+    .loc 1 455 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_241
+    .p2align 4,,10
+.Lf3_240:
+    .loc 1 456 17
+    movslq -16(%rbp), %rax
+    subl -72(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_243
+    jmp .Lf3_242
+.Lf3_243:
+    movq $3, %rax
+    push %rax
+    movq $62, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_242:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 457 17
+    movq $5, %rax
+    push %rax
+    movq $74, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_244
+    jmp .Lf3_245
+.Lf3_244:
+    movq $83, %rax
+    jmp .Lf3_246
+.Lf3_245:
+    movq $10, %rax
+.Lf3_246:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 458 17
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf3_247
+    jmp .Lf3_248
+.Lf3_247:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_249
+.Lf3_248:
+    movq $70, %rax
+.Lf3_249:
+    push %rax
+    movslq -56(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf3_250
+    jmp .Lf3_251
+.Lf3_250:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_254
+    jmp .Lf3_253
+.Lf3_254:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_253:
+    jmp .Lf3_252
+.Lf3_251:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf3_252:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_239:
+    .loc 1 455 40
+    incl -344(%rbp)
+.Lf3_241:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_240
+.Lf3_238:
+    addq $0, %rsp
+    .loc 1 460 13
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_255
+    jmp .Lf3_256
+.Lf3_255:
+    movq $57, %rax
+    jmp .Lf3_257
+.Lf3_256:
+    movslq -4(%rbp), %rax
+.Lf3_257:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_259
+    jmp .Lf3_258
+.Lf3_259:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_258:
+    push %rax
+    cmpl $90, -36(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 461 13
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_260
+    jmp .Lf3_261
+.Lf3_260:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_264
+    jmp .Lf3_263
+.Lf3_264:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_263:
+    jmp .Lf3_262
+.Lf3_261:
+    movq $33, %rax
+    subl -64(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_262:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_265
+    jmp .Lf3_266
+.Lf3_265:
+    movq $14, %rax
+    jmp .Lf3_267
+.Lf3_266:
+    movq $88, %rax
+.Lf3_267:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 462 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_233:
+.Lf3_235:
+    .loc 1 454 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_234
+.Lf3_232:
+    addq $8, %rsp
+    .loc 1 465 5
+    movq $3, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_268
+    jmp .Lf3_269
+.Lf3_268:
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_270
+.Lf3_269:
+    movq $4, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_270:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
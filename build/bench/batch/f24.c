@@ -0,0 +1,160 @@
+int f0() {
+    int v0 = 92;
+    int v1 = 6;
+    int v2 = 78;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 == v2) ? (a1[3][8] < v1) : (9 > v1)) || ((1 ? v3 : 89) <= (83 - a0[11])));
+            a1[2][7] = (((v1 - i0) * (v2 < a0[0])) * ((v1 && i0) + (i0 == v2)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v3 ? a1[1][13] : v3) != (i0 - i1)) <= ((v1 <= 63) && (v1 ? v1 : 43)));
+                    a1[2][3] = (((i1 % 1) == (v2 % 2)) % 6);
+                    v0 = (((a0[2] ? 13 : v2) + (v3 ? v0 : v3)) ? ((94 ? v3 : 1) != (57 != v3)) : ((39 == i0) ? (96 % 1) : (45 ? 72 : i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v0 = (((i2 == v2) ? (a0[11] <= a0[13]) : (v3 == 2)) + ((a1[3][9] >= 56) >= (v0 == 11)));
+            v3 = (((50 || v1) >= (v3 >= v2)) ? ((a0[7] % 9) < (v2 >= v0)) : ((i2 >= v0) >= (v1 > a0[12])));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][12] = (((i3 + a1[3][1]) ? (a1[2][2] ? 25 : v0) : (v2 > 78)) >= ((v2 - i2) / 3));
+                    v0 = (((70 > 48) ? (a1[1][5] % 5) : (a0[5] > v0)) < ((v0 % 6) * (a0[6] / 6)));
+                    v1 = (((v3 < a1[3][12]) > (a0[15] / 1)) / 2);
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                if ((i4 > 85) > 52) break;
+                a0[10] = (((a0[2] != v3) == (v3 + a1[2][4])) == ((i4 >= i4) / 1));
+                a0[6] = (((a1[1][10] != i4) / 9) - ((a0[14] != v1) / 9));
+                v1 = (((44 >= 52) < (v1 % 1)) - ((v1 < i4) != (v0 < 40)));
+                i5 = i5 + 1;
+            }
+        }
+        v0 = (((52 && 0) / 5) ? ((40 - i4) > (a1[0][5] + a0[12])) : ((v2 * i4) ? (v1 ? i4 : 17) : (a1[3][4] != i4)));
+        a1[1][13] = (((97 ? a1[2][4] : a0[12]) + (23 > i4)) > ((a0[0] % 9) >= (v1 % 8)));
+    }
+    if ((((v2 + v0) || (v1 ? a1[1][10] : a1[1][7])) > ((v3 % 6) <= (v2 >= v3)))) {
+        v1 = (((56 ? 93 : v0) != (a0[5] + a1[0][1])) != ((a0[10] || a0[13]) >= (13 > 26)));
+        v2 = (((a0[7] >= 60) / 1) != ((50 == 48) - (48 >= v2)));
+        v3 = (((a1[1][13] > a1[0][13]) == (a1[2][6] ? a0[4] : 75)) + ((a0[15] ? v1 : v0) == (v2 >= 5)));
+    } else {
+        v1 = (((v0 && 54) >= (75 / 4)) > ((a1[0][1] ? a0[10] : 19) == (a1[1][12] + v2)));
+        v1 = (((v1 && v1) || (v1 - a1[1][1])) * ((v0 % 9) / 5));
+        v3 = (((v2 + 77) ? (27 - v2) : (v0 > v3)) && ((49 < v3) || (84 / 7)));
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v2 = (((a1[2][15] - 37) == (a1[2][3] > a0[5])) + ((v1 - a1[3][8]) < (54 / 8)));
+                    a0[15] = (((v2 + v3) == (v1 - a0[14])) + ((99 >= i6) <= (v1 / 8)));
+                    v0 = (((i7 >= a1[1][1]) && (v2 / 8)) ? ((93 <= v0) ? (v0 <= v3) : (17 == v3)) : ((a1[2][15] - v1) >= (v2 ? a0[0] : v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            a0[14] = (((87 * a1[3][12]) / 5) && ((v3 || i6) % 5));
+            v1 = (((v0 ? v1 : v0) * (a1[0][10] - v0)) ? ((v0 / 9) >= (v0 * a1[1][5])) : ((a1[2][8] >= i6) < (52 || 52)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[0] = (((86 > 37) * (v1 >= 7)) * ((i8 + 3) >= (91 <= v3)));
+            {
+                int i9 = 0;
+                do {
+                    if ((29 > v0) > 89) break;
+                    v3 = (((a0[0] ? 90 : i8) <= (v2 >= a1[2][8])) ? ((8 > v2) + (44 != i9)) : ((v3 < 75) - (a0[3] == v0)));
+                    v0 = (((a1[0][12] % 3) && (a0[13] / 7)) - ((i9 > a1[0][0]) || (v2 == a1[3][12])));
+                    v3 = (((v2 || 12) != (i8 - a0[9])) != ((v3 + v3) > (99 && a1[3][0])));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            v2 = (((11 || 9) && (v0 ? a0[1] : i8)) && ((77 != i8) - (a1[2][1] % 1)));
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    if ((((v3 * v2) % 5) || ((v1 && a0[1]) - (74 ? v0 : a0[8])))) {
+        v2 = (((a1[3][3] || a0[13]) ? (6 ? v3 : a1[3][6]) : (75 > 52)) - ((a0[12] < a0[10]) > (v1 ? v0 : v2)));
+        a0[13] = (((a0[2] == 38) - (15 % 6)) ? ((a1[3][15] <= v0) >= (v0 != a1[0][3])) : ((67 && v3) == (v3 ? v1 : v3)));
+        a1[0][9] = (((a1[3][14] || 44) / 8) + ((81 % 1) <= (17 > 59)));
+    } else {
+        a1[0][13] = (((a1[0][8] - v1) <= (a0[0] && 93)) / 3);
+        a1[3][2] = (((v3 % 4) ? (v3 == v1) : (83 / 1)) == ((v3 + a0[7]) + (a0[2] + 8)));
+        v3 = (((a1[1][15] - 9) % 2) <= ((56 <= v0) || (a1[3][4] > 79)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 6) {
+            v0 = (((v1 - 79) / 6) != ((v0 >= v1) ? (v0 <= a0[12]) : (a1[2][6] / 4)));
+            {
+                int i11 = 0;
+                while (i11 < 5) {
+                    v2 = (((i10 * v1) / 3) <= ((v3 != v1) ? (i10 || v2) : (i11 >= 39)));
+                    a1[3][3] = (((a0[1] - v3) - (a0[6] >= 70)) != ((a0[12] != a1[0][7]) >= (47 != i11)));
+                    a0[4] = (((2 % 5) ? (95 ? a1[0][9] : i11) : (87 <= v0)) % 1);
+                    i11 = i11 + 1;
+                }
+            }
+            a0[14] = (((43 ? a1[2][10] : v3) < (v0 >= 24)) >= ((v1 != v0) / 4));
+            i10 = i10 + 1;
+        }
+    }
+    {
+        int i12 = 0;
+        while (i12 < 4) {
+            if ((3 > v1) > 53) break;
+            a0[11] = (((57 * v1) > (49 != v3)) % 5);
+            {
+                int i13 = 0;
+                while (i13 < 4) {
+                    if ((v3 == v2) > 89) break;
+                    v3 = (((a1[1][3] < a1[3][1]) ? (83 && v0) : (i13 + a1[1][6])) != ((v2 * v2) || (i12 ? v2 : 37)));
+                    v1 = (((a0[3] / 1) >= (v1 == a1[3][10])) == ((a1[1][6] % 1) <= (v0 - 31)));
+                    a0[4] = (((i12 >= a1[2][10]) <= (a0[15] == 8)) ? ((i12 / 3) - (a0[10] == v0)) : ((v3 >= v0) > (59 <= 95)));
+                    i13 = i13 + 1;
+                }
+            }
+            v0 = (((87 ? a0[10] : i12) >= (75 >= v1)) % 8);
+            i12 = i12 + 1;
+        }
+    }
+    if ((((63 / 6) % 6) != ((v0 != a0[4]) && (v2 && v2)))) {
+        v2 = (((v3 <= v1) / 4) < ((39 >= v1) ? (91 >= v2) : (88 * v2)));
+        v1 = (((a0[14] / 7) == (a0[5] ? a1[0][8] : v2)) && ((v0 != a1[2][3]) ? (v0 * a0[10]) : (v1 > a0[12])));
+        v0 = (((v2 + a0[3]) * (11 != 97)) ? ((v1 >= 33) + (v2 ? v1 : v0)) : ((v1 % 8) ? (v1 == v0) : (a1[1][15] ? a1[1][0] : a0[0])));
+    } else {
+        a1[1][13] = (((38 ? 21 : a0[0]) == (v3 >= a0[13])) || ((v3 ? 33 : v2) / 7));
+        v2 = (((v2 / 9) >= (v0 * v2)) / 3);
+        v2 = (((v3 < v0) != (36 * 14)) >= ((a1[3][9] || v2) % 8));
+    }
+    return (((v2 && 22) + (93 >= a0[3])) ? ((a1[3][14] == a0[1]) <= (a1[3][8] ? 74 : v3)) : ((a1[2][4] != 51) + (v1 / 3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
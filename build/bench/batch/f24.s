@@ -0,0 +1,3084 @@
+    .file 1 "build/bench/batch/f24.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 156 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 157 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 158 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 159 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $92, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $6, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $78, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $15, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_4
+    jmp .Lf0_5
+.Lf0_4:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_6
+.Lf0_5:
+    movq $9, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_6:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movq $1, %rax
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_11
+.Lf0_10:
+    movq $89, %rax
+.Lf0_11:
+    push %rax
+    movq $83, %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    movl %eax, -8(%rbp)
+    .loc 1 12 13
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_13
+    jmp .Lf0_12
+.Lf0_13:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_12:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 14 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 15 17
+    .p2align 4,,10
+.Lf0_16:
+    .loc 1 16 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_17
+    jmp .Lf0_18
+.Lf0_17:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf0_19
+.Lf0_18:
+    movslq -16(%rbp), %rax
+.Lf0_19:
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $63, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_20
+.Lf0_21:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_23
+.Lf0_22:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_24
+.Lf0_23:
+    movq $43, %rax
+.Lf0_24:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_20:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 17 21
+    movq $6, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 18 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_30
+.Lf0_29:
+    movslq -16(%rbp), %rax
+.Lf0_30:
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_31
+    jmp .Lf0_32
+.Lf0_31:
+    movq $13, %rax
+    jmp .Lf0_33
+.Lf0_32:
+    movslq -12(%rbp), %rax
+.Lf0_33:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_25
+    jmp .Lf0_26
+.Lf0_25:
+    movq $94, %rax
+    cmpq $0, %rax
+    jne .Lf0_34
+    jmp .Lf0_35
+.Lf0_34:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_36
+.Lf0_35:
+    movq $1, %rax
+.Lf0_36:
+    push %rax
+    movq $57, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_27
+.Lf0_26:
+    movq $39, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_37
+    jmp .Lf0_38
+.Lf0_37:
+    movq $1, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_39
+.Lf0_38:
+    movq $45, %rax
+    cmpq $0, %rax
+    jne .Lf0_40
+    jmp .Lf0_41
+.Lf0_40:
+    movq $72, %rax
+    jmp .Lf0_42
+.Lf0_41:
+    movslq -344(%rbp), %rax
+.Lf0_42:
+.Lf0_39:
+.Lf0_27:
+    movl %eax, -4(%rbp)
+    .loc 1 19 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_15:
+    .loc 1 20 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_16
+.Lf0_14:
+    addq $0, %rsp
+    .loc 1 22 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 23 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 26 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 27 9
+    jmp .Lf0_46
+    .p2align 4,,10
+.Lf0_45:
+    .loc 1 28 13
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $11, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_47
+    jmp .Lf0_48
+.Lf0_47:
+    movslq -36(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_49
+.Lf0_48:
+    cmpl $2, -16(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf0_49:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 29 13
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_54
+    jmp .Lf0_53
+.Lf0_54:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_53:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_51
+.Lf0_50:
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_52
+.Lf0_51:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_52:
+    movl %eax, -16(%rbp)
+    .loc 1 31 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 32 17
+    .p2align 4,,10
+.Lf0_57:
+    .loc 1 33 21
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_58
+    jmp .Lf0_59
+.Lf0_58:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_62
+.Lf0_61:
+    movq $25, %rax
+    jmp .Lf0_63
+.Lf0_62:
+    movslq -4(%rbp), %rax
+.Lf0_63:
+    jmp .Lf0_60
+.Lf0_59:
+    cmpl $78, -12(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_60:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 34 21
+    movq $70, %rax
+    cmpq $48, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_64
+    jmp .Lf0_65
+.Lf0_64:
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_66
+.Lf0_65:
+    movslq -60(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_66:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 35 21
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 36 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_56:
+    .loc 1 37 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_57
+.Lf0_55:
+    addq $0, %rsp
+    .loc 1 39 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_44:
+.Lf0_46:
+    .loc 1 27 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_45
+.Lf0_43:
+    addq $8, %rsp
+    .loc 1 42 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_72
+    .p2align 4,,10
+.Lf0_71:
+    .loc 1 44 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 45 13
+    jmp .Lf0_76
+    .p2align 4,,10
+.Lf0_75:
+    .loc 1 46 17
+    cmpl $85, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $52, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_77
+    jmp .Lf0_73
+.Lf0_77:
+    .loc 1 47 17
+    movslq -72(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -40(%rbp)
+    .loc 1 48 17
+    movq $9, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 49 17
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $40, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $44, %rax
+    cmpq $52, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 50 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_74:
+.Lf0_76:
+    .loc 1 45 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_75
+.Lf0_73:
+    addq $0, %rsp
+    .loc 1 53 9
+    movq $5, %rax
+    push %rax
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_82
+    jmp .Lf0_81
+.Lf0_82:
+    movq $0, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_81:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_79
+.Lf0_78:
+    movq $40, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    addl -32(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_80
+.Lf0_79:
+    movslq -12(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_84
+.Lf0_83:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_86
+    jmp .Lf0_87
+.Lf0_86:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_88
+.Lf0_87:
+    movq $17, %rax
+.Lf0_88:
+    jmp .Lf0_85
+.Lf0_84:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_85:
+.Lf0_80:
+    movl %eax, -4(%rbp)
+    .loc 1 54 9
+    movq $23, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $97, %rax
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf0_91
+.Lf0_90:
+    movslq -32(%rbp), %rax
+.Lf0_91:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_70:
+    .loc 1 42 30
+    incl -340(%rbp)
+.Lf0_72:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_71
+.Lf0_69:
+    addq $8, %rsp
+    .loc 1 56 5
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_94
+    jmp .Lf0_93
+.Lf0_94:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_95
+    jmp .Lf0_96
+.Lf0_95:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf0_97
+.Lf0_96:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_97:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_93:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_98
+    .loc 1 57 9
+    movq $56, %rax
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_100
+.Lf0_99:
+    movq $93, %rax
+    jmp .Lf0_101
+.Lf0_100:
+    movslq -4(%rbp), %rax
+.Lf0_101:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_103
+    jmp .Lf0_102
+.Lf0_103:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_102:
+    push %rax
+    movq $13, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 58 9
+    movq $1, %rax
+    push %rax
+    cmpl $60, -52(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $48, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $50, %rax
+    cmpq $48, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 59 9
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_104
+    jmp .Lf0_105
+.Lf0_104:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_106
+.Lf0_105:
+    movslq -4(%rbp), %rax
+.Lf0_106:
+    push %rax
+    cmpl $5, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_107
+    jmp .Lf0_108
+.Lf0_107:
+    movslq -64(%rbp), %rax
+    jmp .Lf0_109
+.Lf0_108:
+    movq $75, %rax
+.Lf0_109:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_92
+.Lf0_98:
+    .loc 1 61 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_111
+    jmp .Lf0_110
+.Lf0_111:
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_110:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $75, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_112
+    jmp .Lf0_113
+.Lf0_112:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_114
+.Lf0_113:
+    movq $19, %rax
+.Lf0_114:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 62 9
+    movq $5, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_116
+    jmp .Lf0_115
+.Lf0_116:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_115:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_118
+    jmp .Lf0_117
+.Lf0_118:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_117:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 63 9
+    movslq -12(%rbp), %rax
+    addq $77, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_120
+.Lf0_119:
+    movq $27, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_121
+.Lf0_120:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_121:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_122
+.Lf0_123:
+    movq $49, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_125
+    jmp .Lf0_124
+.Lf0_125:
+    movq $7, %rax
+    push %rax
+    movq $84, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_124:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_122:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_92:
+    .loc 1 66 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 67 9
+    .p2align 4,,10
+.Lf0_128:
+    .loc 1 69 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 70 17
+    jmp .Lf0_132
+    .p2align 4,,10
+.Lf0_131:
+    .loc 1 71 21
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    subq $37, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 72 21
+    movq $99, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 73 21
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_137
+    jmp .Lf0_136
+.Lf0_137:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_136:
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movq $93, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_140
+.Lf0_139:
+    movq $17, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_140:
+    jmp .Lf0_135
+.Lf0_134:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -80(%rbp), %rax
+    jmp .Lf0_143
+.Lf0_142:
+    movslq -12(%rbp), %rax
+.Lf0_143:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_135:
+    movl %eax, -4(%rbp)
+    .loc 1 74 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_130:
+.Lf0_132:
+    .loc 1 70 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_131
+.Lf0_129:
+    addq $0, %rsp
+    .loc 1 77 13
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    imulq $87, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_147
+    jmp .Lf0_146
+.Lf0_147:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_146:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    movl %eax, -24(%rbp)
+    .loc 1 78 13
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_151
+    jmp .Lf0_152
+.Lf0_151:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_153
+.Lf0_152:
+    movslq -4(%rbp), %rax
+.Lf0_153:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_149
+.Lf0_148:
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_150
+.Lf0_149:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_155
+    jmp .Lf0_154
+.Lf0_155:
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_154:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_150:
+    movl %eax, -8(%rbp)
+    .loc 1 79 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_127:
+    .loc 1 80 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_128
+.Lf0_126:
+    addq $8, %rsp
+    .loc 1 83 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 84 9
+    .p2align 4,,10
+.Lf0_158:
+    .loc 1 85 13
+    movslq -340(%rbp), %rax
+    addq $3, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $7, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $86, %rax
+    cmpq $37, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 87 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 88 17
+    .p2align 4,,10
+.Lf0_161:
+    .loc 1 89 21
+    movq $29, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $89, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_162
+    jmp .Lf0_159
+.Lf0_162:
+    .loc 1 90 21
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_166
+    jmp .Lf0_167
+.Lf0_166:
+    movq $90, %rax
+    jmp .Lf0_168
+.Lf0_167:
+    movslq -340(%rbp), %rax
+.Lf0_168:
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_164
+.Lf0_163:
+    movq $44, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_165
+.Lf0_164:
+    movslq -68(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $75, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_165:
+    movl %eax, -16(%rbp)
+    .loc 1 91 21
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_170
+    jmp .Lf0_169
+.Lf0_170:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_169:
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movq $7, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 92 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_174
+    jmp .Lf0_173
+.Lf0_174:
+    movq $12, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_173:
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_176
+    jmp .Lf0_175
+.Lf0_176:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_175:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 93 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_160:
+    .loc 1 94 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_161
+.Lf0_159:
+    addq $0, %rsp
+    .loc 1 96 13
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_180
+    jmp .Lf0_179
+.Lf0_180:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_181
+    jmp .Lf0_182
+.Lf0_181:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_183
+.Lf0_182:
+    movslq -340(%rbp), %rax
+.Lf0_183:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_179:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_184
+.Lf0_185:
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $77, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_184:
+    movl %eax, -12(%rbp)
+    .loc 1 97 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_157:
+    .loc 1 98 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_158
+.Lf0_156:
+    addq $8, %rsp
+    .loc 1 100 5
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_188
+    jmp .Lf0_187
+.Lf0_188:
+    movq $74, %rax
+    cmpq $0, %rax
+    jne .Lf0_189
+    jmp .Lf0_190
+.Lf0_189:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_191
+.Lf0_190:
+    movslq -48(%rbp), %rax
+.Lf0_191:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_193
+    jmp .Lf0_192
+.Lf0_193:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_192:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_187:
+    cmpq $0, %rax
+    je .Lf0_194
+    .loc 1 101 9
+    movslq -32(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_195
+    jmp .Lf0_196
+.Lf0_195:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_197
+.Lf0_196:
+    movslq -12(%rbp), %rax
+.Lf0_197:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_202
+    jmp .Lf0_201
+.Lf0_202:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_201:
+    cmpq $0, %rax
+    jne .Lf0_198
+    jmp .Lf0_199
+.Lf0_198:
+    movq $6, %rax
+    cmpq $0, %rax
+    jne .Lf0_203
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_205
+.Lf0_204:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_205:
+    jmp .Lf0_200
+.Lf0_199:
+    movq $75, %rax
+    cmpq $52, %rax
+    movq $0, %rax
+    setg %al
+.Lf0_200:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 102 9
+    movq $6, %rax
+    push %rax
+    movq $15, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $38, -72(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_207
+.Lf0_206:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_208
+.Lf0_207:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_209
+.Lf0_210:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_209:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_211
+    jmp .Lf0_212
+.Lf0_211:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_213
+.Lf0_212:
+    movslq -16(%rbp), %rax
+.Lf0_213:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_208:
+    movl %eax, -28(%rbp)
+    .loc 1 103 9
+    movq $1, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $17, %rax
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_215
+    jmp .Lf0_214
+.Lf0_215:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_214:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_186
+.Lf0_194:
+    .loc 1 105 9
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_217
+    jmp .Lf0_216
+.Lf0_217:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_216:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 106 9
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_218
+    jmp .Lf0_219
+.Lf0_218:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_220
+.Lf0_219:
+    movq $1, %rax
+    push %rax
+    movq $83, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_220:
+    push %rax
+    movslq -72(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -52(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 107 9
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    subq $9, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $56, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_222
+    jmp .Lf0_221
+.Lf0_222:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_221:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_186:
+    .loc 1 110 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 111 9
+    jmp .Lf0_226
+    .p2align 4,,10
+.Lf0_225:
+    .loc 1 112 13
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $79, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_227
+    jmp .Lf0_228
+.Lf0_227:
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_229
+.Lf0_228:
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_229:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 114 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 115 17
+    jmp .Lf0_233
+    .p2align 4,,10
+.Lf0_232:
+    .loc 1 116 21
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_234
+    jmp .Lf0_235
+.Lf0_234:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_238
+    jmp .Lf0_237
+.Lf0_238:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_237:
+    jmp .Lf0_236
+.Lf0_235:
+    cmpl $39, -344(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_236:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 117 21
+    cmpl $70, -56(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -76(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $47, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 118 21
+    movq $1, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $2, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_239
+    jmp .Lf0_240
+.Lf0_239:
+    movq $95, %rax
+    cmpq $0, %rax
+    jne .Lf0_242
+    jmp .Lf0_243
+.Lf0_242:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf0_244
+.Lf0_243:
+    movslq -344(%rbp), %rax
+.Lf0_244:
+    jmp .Lf0_241
+.Lf0_240:
+    movq $87, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_241:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 119 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_231:
+.Lf0_233:
+    .loc 1 115 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_232
+.Lf0_230:
+    addq $0, %rsp
+    .loc 1 122 13
+    movq $43, %rax
+    cmpq $0, %rax
+    jne .Lf0_245
+    jmp .Lf0_246
+.Lf0_245:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf0_247
+.Lf0_246:
+    movslq -16(%rbp), %rax
+.Lf0_247:
+    push %rax
+    cmpl $24, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -24(%rbp)
+    .loc 1 123 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_224:
+.Lf0_226:
+    .loc 1 111 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_225
+.Lf0_223:
+    addq $8, %rsp
+    .loc 1 127 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 128 9
+    jmp .Lf0_251
+    .p2align 4,,10
+.Lf0_250:
+    .loc 1 129 13
+    movq $3, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_252
+    jmp .Lf0_248
+.Lf0_252:
+    .loc 1 130 13
+    movq $5, %rax
+    push %rax
+    movq $57, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $49, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 132 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 133 17
+    jmp .Lf0_256
+    .p2align 4,,10
+.Lf0_255:
+    .loc 1 134 21
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $89, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_257
+    jmp .Lf0_253
+.Lf0_257:
+    .loc 1 135 21
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_258
+    jmp .Lf0_259
+.Lf0_258:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_262
+    jmp .Lf0_261
+.Lf0_262:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_261:
+    jmp .Lf0_260
+.Lf0_259:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_260:
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_264
+    jmp .Lf0_263
+.Lf0_264:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_265
+    jmp .Lf0_266
+.Lf0_265:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_267
+.Lf0_266:
+    movq $37, %rax
+.Lf0_267:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_263:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 136 21
+    movq $1, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $31, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 137 21
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $8, -20(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_268
+    jmp .Lf0_269
+.Lf0_268:
+    movslq -40(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_270
+.Lf0_269:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $59, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_270:
+    movl %eax, -64(%rbp)
+    .loc 1 138 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_254:
+.Lf0_256:
+    .loc 1 133 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_255
+.Lf0_253:
+    addq $0, %rsp
+    .loc 1 141 13
+    movq $8, %rax
+    push %rax
+    movq $87, %rax
+    cmpq $0, %rax
+    jne .Lf0_271
+    jmp .Lf0_272
+.Lf0_271:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_273
+.Lf0_272:
+    movslq -340(%rbp), %rax
+.Lf0_273:
+    push %rax
+    movq $75, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 142 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_249:
+.Lf0_251:
+    .loc 1 128 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_250
+.Lf0_248:
+    addq $8, %rsp
+    .loc 1 145 5
+    movq $6, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_276
+    jmp .Lf0_275
+.Lf0_276:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_278
+    jmp .Lf0_277
+.Lf0_278:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_277:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_275:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_279
+    .loc 1 146 9
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $39, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_280
+    jmp .Lf0_281
+.Lf0_280:
+    movq $91, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_282
+.Lf0_281:
+    movq $88, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_282:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 147 9
+    movq $7, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_283
+    jmp .Lf0_284
+.Lf0_283:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf0_285
+.Lf0_284:
+    movslq -12(%rbp), %rax
+.Lf0_285:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_287
+    jmp .Lf0_286
+.Lf0_287:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_288
+    jmp .Lf0_289
+.Lf0_288:
+    movslq -4(%rbp), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_290
+.Lf0_289:
+    movslq -8(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_290:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_286:
+    movl %eax, -8(%rbp)
+    .loc 1 148 9
+    movq $11, %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_291
+    jmp .Lf0_292
+.Lf0_291:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_294
+    jmp .Lf0_295
+.Lf0_294:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_296
+.Lf0_295:
+    movslq -4(%rbp), %rax
+.Lf0_296:
+    push %rax
+    cmpl $33, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_293
+.Lf0_292:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_297
+    jmp .Lf0_298
+.Lf0_297:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_299
+.Lf0_298:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_300
+    jmp .Lf0_301
+.Lf0_300:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf0_302
+.Lf0_301:
+    movslq -80(%rbp), %rax
+.Lf0_302:
+.Lf0_299:
+.Lf0_293:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_274
+.Lf0_279:
+    .loc 1 150 9
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf0_303
+    jmp .Lf0_304
+.Lf0_303:
+    movq $21, %rax
+    jmp .Lf0_305
+.Lf0_304:
+    movslq -80(%rbp), %rax
+.Lf0_305:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_307
+    jmp .Lf0_306
+.Lf0_307:
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_308
+    jmp .Lf0_309
+.Lf0_308:
+    movq $33, %rax
+    jmp .Lf0_310
+.Lf0_309:
+    movslq -12(%rbp), %rax
+.Lf0_310:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_306:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 151 9
+    movq $3, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 152 9
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $36, %rax
+    imulq $14, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_312
+    jmp .Lf0_311
+.Lf0_312:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_311:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_274:
+    .loc 1 154 5
+    movq $93, %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_317
+    jmp .Lf0_316
+.Lf0_317:
+    movq $22, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_316:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_313
+    jmp .Lf0_314
+.Lf0_313:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_318
+    jmp .Lf0_319
+.Lf0_318:
+    movq $74, %rax
+    jmp .Lf0_320
+.Lf0_319:
+    movslq -16(%rbp), %rax
+.Lf0_320:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_315
+.Lf0_314:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_315:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
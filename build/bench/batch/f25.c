@@ -0,0 +1,4408 @@
+int f0() {
+    int v0 = 49;
+    int v1 = 38;
+    int v2 = 14;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[12] = (((a1[3][5] + 46) % 8) <= ((v3 <= v1) + (v2 < v3)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[3][12] || 89) > 65) break;
+                    v2 = (((36 <= 88) ? (a0[15] != i0) : (36 < 7)) && ((i0 / 1) < (a1[1][3] ? a1[0][6] : 9)));
+                    v0 = (((1 * a0[8]) ? (a1[2][14] != v2) : (67 % 4)) ? ((8 ? a1[3][3] : a0[8]) || (99 == 67)) : ((v0 + 58) < (i1 != a0[2])));
+                    v2 = (((i1 + v0) <= (58 == 11)) ? ((v1 > v0) < (a1[0][4] != v0)) : ((v1 + a0[4]) && (v1 ? i1 : v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a1[2][1] = (((a1[1][0] - a0[1]) % 8) + ((73 < 37) <= (v3 ? v2 : a0[4])));
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((v2 ? a0[15] : v2) < (v0 + a0[2])) / 4);
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((a1[2][12] ? v2 : 55) / 6) >= ((a1[0][3] != i3) <= (9 / 9)));
+                    v0 = (((44 - i2) - (v0 * i3)) - ((v1 - v0) || (35 - 40)));
+                    v2 = (((v1 != a1[0][11]) >= (a0[15] && 98)) == ((v1 >= i2) * (v0 <= v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[2][0] = (((i2 ? v1 : v3) && (v2 ? v3 : 24)) / 2);
+            a1[0][6] = (((a0[15] != a1[0][10]) == (v1 || a1[0][15])) || ((a1[1][14] >= i2) - (i2 != v0)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v3 = (((a0[12] - v0) || (v3 * 3)) - ((a0[0] * v3) || (74 + i4)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a1[3][0] = (((v2 || 64) + (v3 * i4)) ? ((v1 / 3) % 2) : ((73 && v3) * (v3 <= a1[0][14])));
+                a0[10] = (((99 ? a0[8] : v1) > (30 ? 54 : a1[1][2])) && ((i5 && v2) / 4));
+                v1 = (((82 != i5) ? (a0[5] / 2) : (i5 * v0)) * ((85 || i5) % 6));
+            }
+            v1 = (((i4 >= a0[4]) % 8) - ((90 % 2) / 6));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                a1[3][8] = (((a1[0][15] != i7) >= (v1 || i6)) * ((19 == 75) || (a0[12] && a1[0][4])));
+                a1[1][7] = (((i6 >= v3) >= (v1 <= i7)) ? ((64 + 0) ? (12 <= a1[2][10]) : (v2 ? 56 : i6)) : ((v3 < i6) + (v3 != 9)));
+                v1 = (((v1 || i6) >= (90 != v3)) ? ((v3 || a0[7]) + (a1[1][3] + 34)) : ((a0[12] * 99) - (v3 < v3)));
+            }
+            v1 = (((v2 || v0) - (33 > a1[1][12])) || ((94 <= v3) ? (v0 + 31) : (13 / 5)));
+            a0[7] = (((v2 / 9) + (42 ? a0[13] : v1)) % 6);
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            v2 = (((38 <= 0) * (a0[10] >= a0[0])) && ((v3 + 21) > (a1[3][2] > i8)));
+            v0 = (((v3 / 5) - (48 && a0[1])) && ((v0 != a1[0][5]) <= (a1[1][8] ? a1[0][11] : v3)));
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    a1[3][1] = (((v1 != v3) || (v2 ? 61 : a0[1])) - ((a0[7] >= 9) && (v2 + i8)));
+                    a1[3][15] = (((82 < v0) < (a1[3][2] % 6)) + ((v1 && v2) ? (v1 > a1[3][2]) : (3 >= 94)));
+                    v0 = (((68 == v3) < (v2 * i9)) > ((v3 != 66) > (a0[11] == a0[14])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    v2 = (((v0 < v2) * (v3 + v0)) ? ((a1[3][5] > v0) > (v1 + a0[12])) : ((a0[14] % 1) > (v3 != a1[0][6])));
+    if ((((v3 / 5) || (v2 && 29)) && ((v0 % 9) > (3 == 24)))) {
+        v0 = (((18 > v2) != (30 % 5)) + ((18 && v0) <= (50 || v1)));
+        a1[1][0] = (((v0 ? a0[8] : a1[2][8]) ? (v0 && a0[14]) : (v3 % 2)) / 5);
+        v3 = (((v0 ? v0 : 75) && (v1 ? v3 : a0[15])) ? ((a0[10] % 9) * (25 || v1)) : ((a0[6] ? v2 : v0) ? (v1 * a1[0][2]) : (9 && v3)));
+    } else {
+        v0 = (((v1 > v0) / 9) % 9);
+        a0[11] = (((v2 - v0) < (v0 < v0)) < ((v2 >= a0[5]) ? (v2 >= a1[3][12]) : (a1[2][13] ? 83 : 65)));
+        v3 = (((v1 % 8) && (a0[3] >= a1[2][10])) / 4);
+    }
+    {
+        int i10 = 0;
+        do {
+            a0[10] = (((v0 <= i10) >= (v2 <= 97)) > ((i10 - v3) < (v3 == v1)));
+            v3 = (((35 ? v2 : i10) ? (v3 ? v3 : 6) : (v3 <= a0[9])) && ((i10 != v1) == (a1[1][10] || i10)));
+            for (int i11 = 0; i11 < 2; i11 = i11 + 1) {
+                v0 = (((a0[14] + a0[4]) < (v2 != v1)) < ((v1 <= a0[0]) / 2));
+                a1[0][1] = (((a0[15] && i10) ? (73 == 5) : (97 ? i11 : 70)) ? ((79 > v2) || (v2 == v0)) : ((86 - v3) != (v3 + a1[1][2])));
+                v1 = (((45 ? v2 : a1[3][2]) < (27 != v3)) - ((i10 < 95) ? (v0 && i10) : (64 % 9)));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 5);
+    }
+    {
+        int i12 = 0;
+        do {
+            if ((87 + a1[2][0]) > 80) break;
+            a0[7] = (((45 - a1[0][9]) > (82 ? 98 : a1[1][14])) >= ((i12 >= v3) <= (v1 ? 24 : i12)));
+            v0 = (((v1 > i12) || (v2 / 4)) ? ((i12 ? 53 : a0[10]) ? (v0 < 45) : (v0 || v0)) : ((v0 % 7) ? (57 - v3) : (a0[0] / 9)));
+            {
+                int i13 = 0;
+                while (i13 < 5) {
+                    v0 = (((v2 * a0[14]) && (i13 > v3)) && ((i13 ? i13 : 35) ? (a1[0][12] ? v1 : v1) : (a0[1] % 6)));
+                    v1 = (((v3 <= 45) && (v0 % 1)) % 5);
+                    a0[12] = (((a0[7] * 40) || (v3 >= 34)) < ((v3 * a1[3][10]) == (a0[2] * v3)));
+                    i13 = i13 + 1;
+                }
+            }
+            i12 = i12 + 1;
+        } while (i12 < 7);
+    }
+    return (((v2 > a0[7]) <= (a0[1] <= a0[13])) * ((a1[3][8] < v1) < (34 != a0[4])));
+}
+int f1() {
+    int v0 = 68;
+    int v1 = 88;
+    int v2 = 10;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            a0[12] = (((v1 <= 3) == (v2 == 85)) < ((v3 && i0) % 7));
+            a0[13] = (((31 - i1) + (v3 || v1)) || ((a0[12] > a1[0][7]) && (a1[3][1] ? a1[2][2] : 89)));
+            a0[12] = (((v1 ? 41 : v0) && (a1[3][3] < i1)) ? ((66 || a1[0][12]) + (a1[1][8] + i0)) : ((v0 / 7) % 6));
+        }
+        v2 = (((a1[1][9] >= 98) - (i0 || a0[4])) % 2);
+        v3 = (((a0[1] ? 45 : v0) ? (72 || v3) : (a0[8] - a0[0])) < ((v1 + i0) / 8));
+    }
+    v2 = (((v3 ? v3 : v3) <= (43 && 41)) * ((v2 > a0[11]) < (v2 >= v2)));
+    if ((((v3 * v2) > (v3 >= v3)) && ((90 > a1[0][15]) > (39 < 1)))) {
+        v0 = (((28 + 98) != (v2 >= 64)) && ((a1[1][2] ? v2 : a1[3][12]) != (v0 % 2)));
+        v2 = (((a0[10] * v3) || (v1 <= v3)) < ((37 > a0[11]) == (a1[2][5] / 9)));
+        v3 = (((v3 < v2) ? (v0 < v1) : (v1 - v1)) + ((v0 <= 46) <= (v0 && v0)));
+    } else {
+        v3 = (((v2 <= v3) != (v2 || v0)) <= ((a1[2][6] ? v0 : v1) % 4));
+        v1 = (((42 * v0) || (v2 ? v0 : v2)) % 8);
+        v1 = (((v1 != v2) && (v0 ? a0[4] : a1[2][1])) / 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v1 / 5) > 76) break;
+            v0 = (((v0 % 3) * (a0[13] ? i2 : a1[1][14])) + ((76 <= a0[9]) || (i2 % 1)));
+            {
+                int i3 = 0;
+                do {
+                    a1[2][8] = (((a0[9] <= a1[2][6]) || (27 + v3)) % 8);
+                    v0 = (((v0 ? a0[7] : 84) ? (a1[0][3] && v0) : (97 <= a0[14])) <= ((a1[1][13] > v2) / 6));
+                    v0 = (((36 ? a1[3][14] : v2) > (23 || 88)) >= ((v3 && v1) / 3));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            a0[4] = (((a0[12] <= v0) > (v2 < v2)) && ((v0 >= v3) < (v0 ? a1[0][9] : v1)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((a1[2][8] <= 18) ? (a0[2] >= v1) : (a1[3][7] % 6)) && ((79 + v1) >= (97 ? v0 : v0)))) {
+        v0 = (((96 || 24) != (a1[1][6] && a0[5])) % 1);
+        a0[13] = (((v3 <= a1[0][0]) == (a1[3][3] && a0[2])) == ((36 && v1) == (v3 * 64)));
+        v3 = (((13 - v2) * (91 + 39)) < ((v0 < v2) <= (83 == a1[3][6])));
+    } else {
+        v1 = (((a0[0] && a1[2][15]) >= (a0[0] > 86)) - ((67 <= v2) % 4));
+        a1[0][9] = (((v0 == 22) || (v1 && v1)) <= ((v0 || v0) / 8));
+        v0 = (((v0 % 9) % 6) - ((v0 || v2) / 2));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((i4 + 48) > 93) break;
+        v2 = (((v3 * a0[14]) / 7) % 4);
+        a0[15] = (((a0[5] || a0[8]) >= (a1[0][7] ? 27 : 70)) > ((v1 % 3) || (v1 - v0)));
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            v2 = (((i5 || 72) / 9) ? ((i5 && i5) < (i4 * 24)) : ((v2 == a1[1][6]) == (v2 - i4)));
+            v2 = (((v3 - i4) ? (v2 + 65) : (81 != a0[2])) <= ((a0[4] ? i4 : 50) >= (44 * i5)));
+            a1[2][9] = (((i5 * v0) == (v1 >= i4)) + ((v0 <= 90) == (a0[14] * a0[3])));
+        }
+    }
+    if ((((v2 == v2) < (a1[0][5] - v0)) == ((v3 < a1[2][3]) > (v2 * v0)))) {
+        v0 = (((a0[0] > v1) <= (99 ? 61 : v0)) || ((64 - a0[10]) - (v1 <= 39)));
+        v2 = (((v2 > v0) != (60 != 40)) ? ((52 != a0[1]) * (v2 % 5)) : ((v0 * 98) + (91 < v2)));
+        v3 = (((v3 <= v2) + (92 == a0[3])) < ((v1 < v1) == (v1 <= v3)));
+    } else {
+        v3 = (((v0 ? v2 : 80) % 1) >= ((v2 + v3) ? (v3 % 7) : (43 / 7)));
+        v2 = (((46 && v1) && (a0[4] <= v1)) && ((98 != 18) < (v1 && a0[0])));
+        v2 = (((v0 - 29) >= (v0 || a1[0][6])) + ((v2 >= v3) < (a0[9] ? v3 : v0)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v0 = (((v2 != v2) > (25 ? v2 : a0[9])) && ((40 ? v0 : 34) != (v1 || a1[0][6])));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    v2 = (((v0 != 5) == (i6 * v1)) / 4);
+                    a1[2][11] = (((a0[8] > v0) || (52 <= v2)) > ((a1[2][1] - v1) * (i7 ? 5 : i7)));
+                    v1 = (((v0 || v1) / 7) * ((30 && v2) + (a1[0][8] >= 28)));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((25 * v3) * (v0 || i6)) || ((v2 || 39) >= (a0[9] / 9)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    if ((v0 || a0[12]) > 63) break;
+                    a1[1][5] = (((i8 / 1) == (v2 == 81)) != ((v2 / 2) == (98 * v1)));
+                    v3 = (((84 * 74) ? (i8 * i9) : (83 != i9)) - ((i9 % 5) * (i8 || v1)));
+                    v2 = (((36 > a1[3][1]) / 7) <= ((a0[5] || a1[3][7]) >= (8 <= 94)));
+                    i9 = i9 + 1;
+                }
+            }
+            v1 = (((68 <= i8) / 3) == ((i8 / 3) <= (v0 - a0[9])));
+            v2 = (((54 % 2) ? (i8 - a1[2][9]) : (i8 == 60)) / 7);
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    v1 = (((a0[7] < a1[1][1]) > (a1[2][2] && v0)) == ((67 > v1) == (91 > v1)));
+    return (((v1 - a1[1][6]) || (9 > v0)) < ((v1 > v3) / 1));
+}
+int f2() {
+    int v0 = 4;
+    int v1 = 83;
+    int v2 = 3;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    a0[11] = (((a1[2][10] / 3) == (a1[1][0] + v1)) + ((v1 <= v2) - (24 / 4)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    if ((2 ? a1[1][11] : a1[2][15]) > 99) break;
+                    v0 = (((a1[1][13] ? a1[2][8] : i1) % 9) == ((i0 < v2) || (a1[3][8] > 66)));
+                    a1[2][5] = (((v2 ? i0 : v3) - (19 == v1)) - ((a1[2][7] >= a1[0][11]) ? (i0 ? v2 : a0[13]) : (v2 % 2)));
+                    v3 = (((v3 > a1[3][12]) / 9) * ((v1 != 70) || (v1 || 56)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a0[10] ? i0 : i0) >= (v2 != 8)) && ((a1[0][5] ? 38 : 55) == (v3 % 6)));
+            a0[5] = (((a1[3][13] % 2) != (26 ? v0 : v3)) ? ((55 ? v3 : 89) - (90 > i0)) : ((16 && a1[1][3]) / 8));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v1 = (((a1[0][8] > a0[15]) - (a1[0][11] - a1[2][11])) ? ((53 ? a0[15] : v1) == (v2 - v1)) : ((a1[1][6] >= v1) < (v2 ? 73 : v2)));
+    {
+        int i2 = 0;
+        do {
+            if ((v1 > 65) > 51) break;
+            v1 = (((a0[0] - i2) != (a0[8] % 7)) - ((v0 ? 98 : 79) || (v3 < 22)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v3 = (((v3 ? v2 : v3) && (i2 % 2)) < ((a0[11] % 5) || (49 >= v2)));
+                    v3 = (((v3 >= v0) ? (i3 ? v0 : v1) : (a0[11] && i3)) || ((i2 == 93) == (a1[0][11] == a1[3][11])));
+                    a1[0][10] = (((a0[5] && v3) && (v0 % 4)) - ((v0 >= v3) >= (i2 ? v1 : v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v1 / 2) && (82 == v1)) / 9);
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    v2 = (((v3 > v3) * (v3 - v2)) && ((v1 < v2) && (15 == v3)));
+    {
+        int i4 = 0;
+        do {
+            a1[0][0] = (((72 >= i4) + (a1[3][3] ? i4 : a1[3][6])) + ((v2 != 71) && (i4 * v0)));
+            a1[3][5] = (((v0 <= 96) - (v1 == a1[3][0])) ? ((77 ? 75 : 56) != (13 ? 65 : i4)) : ((v0 || a1[2][4]) - (a0[6] ? a1[0][15] : 59)));
+            {
+                int i5 = 0;
+                do {
+                    a1[2][14] = (((a0[12] > i4) <= (56 > v1)) >= ((98 % 5) * (v0 % 1)));
+                    a0[15] = (((v3 == v0) * (v1 >= v3)) != ((v3 > a0[8]) && (v0 * a0[9])));
+                    a0[6] = (((v0 * i4) ? (v1 && 72) : (6 >= i4)) - ((a1[2][9] || v1) * (a0[0] > 57)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    v3 = (((a0[10] == v1) || (v2 || v0)) == ((a1[1][4] >= v1) ? (v2 && 62) : (75 != v0)));
+    if ((((94 * 94) || (53 / 8)) ? ((v2 && a1[2][15]) < (v2 % 9)) : ((43 ? v3 : v3) >= (96 <= v1)))) {
+        v3 = (((v2 || v0) < (v0 > 36)) ? ((79 + v1) + (v3 < 0)) : ((a0[15] > v1) >= (a1[2][6] ? v2 : v3)));
+        v1 = (((58 * v0) < (v2 != v3)) >= ((v2 == v3) ? (a0[11] % 5) : (a0[7] >= a0[6])));
+        v1 = (((v1 * v3) || (v2 * v0)) != ((a1[3][5] > 44) ? (a0[7] ? a1[2][10] : v3) : (v0 / 1)));
+    } else {
+        a0[12] = (((v3 ? a0[6] : 55) != (a0[4] > v2)) < ((2 / 3) % 2));
+        a0[0] = (((v1 - v1) * (v0 - a1[0][7])) && ((v3 * v2) >= (v3 - v0)));
+        v0 = (((56 >= a1[3][0]) - (v1 / 9)) ? ((a1[3][9] * a1[1][15]) - (23 == a0[13])) : ((69 ? a0[14] : 98) <= (v2 > a0[4])));
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[5] = (((a1[3][1] < a1[1][14]) * (v3 + 32)) == ((75 != a0[14]) || (v2 <= a1[2][8])));
+            a0[10] = (((v0 <= a1[3][15]) < (9 * 27)) >= ((v0 ? v1 : a0[0]) - (65 >= a1[0][5])));
+            {
+                int i7 = 0;
+                do {
+                    if ((i6 ? i6 : i6) > 72) break;
+                    v1 = (((a1[3][2] <= v0) > (a1[2][3] ? 92 : v1)) ? ((v3 != v1) == (i6 > v1)) : ((99 >= 46) * (a0[15] * i7)));
+                    v1 = (((a1[0][14] ? i7 : v0) <= (8 > v3)) + ((i6 % 1) < (a1[1][13] > a1[2][6])));
+                    a0[14] = (((62 / 5) / 7) >= ((v0 * v3) ? (v3 % 4) : (a1[2][8] + 56)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    v3 = (((v0 && 80) * (v1 < v0)) || ((47 == a0[2]) < (v3 * 41)));
+    return (((50 / 9) >= (v1 * v1)) > ((v2 || v0) == (v3 == 67)));
+}
+int f3() {
+    int v0 = 73;
+    int v1 = 79;
+    int v2 = 93;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][10] >= v0) != (70 ? v2 : 3)) == ((v1 - v2) != (v3 ? a0[7] : 27)))) {
+        v1 = (((4 != v0) <= (v1 < a0[8])) ? ((65 != v0) + (a1[1][1] % 1)) : ((a1[3][1] && a0[10]) % 3));
+        v3 = (((v3 == 63) / 5) < ((70 == 25) + (a0[14] ? v2 : a0[3])));
+        a1[1][3] = (((v0 && v1) * (a1[1][15] % 5)) == ((v0 % 4) < (a0[14] + v2)));
+    } else {
+        v3 = (((a0[2] / 2) && (a1[0][9] && v0)) <= ((v0 % 3) >= (a0[13] && a1[0][5])));
+        v1 = (((92 > v2) - (a1[0][14] < 76)) * ((43 % 4) - (v0 != a0[1])));
+        v2 = (((a0[3] && a1[3][9]) == (v0 ? v2 : v3)) ? ((v1 * a1[0][2]) + (a0[3] || a1[1][9])) : ((a0[11] <= v1) ? (v0 >= a0[6]) : (a0[0] || v3)));
+    }
+    if ((((v1 <= v3) > (5 % 4)) ? ((a0[0] < 86) == (4 ? 6 : v0)) : ((8 + a1[3][5]) <= (v1 + v2)))) {
+        a0[0] = (((79 != v3) * (47 >= v0)) != ((a1[1][12] / 3) != (a1[2][6] || v1)));
+        v0 = (((49 ? 34 : a0[2]) == (v1 <= v1)) == ((v0 < a1[0][10]) > (a1[1][2] > v3)));
+        v1 = (((a0[8] + v3) != (a1[1][9] <= v0)) <= ((28 != 50) >= (a1[1][11] && 2)));
+    } else {
+        v0 = (((v2 && v1) % 6) >= ((98 % 1) != (v2 ? v2 : v0)));
+        a0[10] = (((a1[1][1] != 80) / 4) && ((a1[3][4] * v2) || (92 < a1[2][14])));
+        v1 = (((45 && a1[1][1]) / 5) ? ((v2 && a1[3][4]) ? (v0 && a0[1]) : (51 > v0)) : ((v3 < v2) < (a1[0][7] && a0[1])));
+    }
+    if ((((99 && 21) + (a1[2][1] != 21)) * ((55 % 1) - (v3 > 31)))) {
+        v2 = (((v3 ? v2 : 77) < (v3 % 3)) > ((v1 > a1[0][10]) != (v3 > a0[11])));
+        v1 = (((v0 <= v1) < (v1 && v0)) < ((v0 == v0) <= (a0[6] <= a0[0])));
+        a1[2][13] = (((v0 * 68) % 7) <= ((v1 * v0) ? (96 <= v0) : (v0 == v3)));
+    } else {
+        v2 = (((57 && v2) == (v2 && v2)) < ((6 > a1[3][15]) || (a1[3][11] ? a0[15] : 16)));
+        a1[3][0] = (((a0[11] >= 99) >= (v1 - v0)) == ((v2 && a0[8]) ? (a0[6] + a0[8]) : (v3 < a0[5])));
+        v0 = (((a0[4] + a0[6]) - (v1 - 79)) - ((90 + a1[1][8]) > (v2 + a0[1])));
+    }
+    if ((((v2 + a1[0][2]) > (59 < v1)) <= ((15 || 46) ? (v3 / 9) : (v1 >= v3)))) {
+        v2 = (((v3 + a1[0][0]) % 6) ? ((60 || v3) == (v3 < 7)) : ((v0 ? 10 : v0) ? (22 * v3) : (37 < v1)));
+        a0[8] = (((a1[1][12] != v1) ? (a1[2][11] && 48) : (62 % 5)) > ((v2 < 72) >= (v2 * a0[6])));
+        a0[4] = (((65 ? 40 : 30) % 7) - ((v2 >= a0[8]) - (v2 / 6)));
+    } else {
+        v1 = (((v0 + a1[3][9]) || (90 || v3)) && ((a1[1][12] == v0) + (a0[5] + a1[3][9])));
+        v3 = (((12 / 4) * (v2 % 6)) >= ((79 != v0) ? (v2 + a0[9]) : (v1 ? a0[11] : v2)));
+        v3 = (((v3 || v0) != (70 - 10)) <= ((33 ? a0[8] : v1) - (v0 / 1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[3][5] = (((21 != a0[5]) - (v0 - a1[3][5])) || ((i0 && a1[2][5]) > (v0 ? v3 : a0[15])));
+            v1 = (((v2 <= 67) - (a0[1] - v3)) > ((a1[2][10] - v1) - (45 - a0[7])));
+            {
+                int i1 = 0;
+                do {
+                    if ((i0 ? i1 : v0) > 58) break;
+                    v0 = (((67 / 6) ? (v2 > i1) : (a1[3][5] - a1[3][14])) || ((27 / 7) > (36 ? v3 : v3)));
+                    v0 = (((73 + v1) / 3) + ((v1 != 91) != (a0[10] ? a0[7] : a1[3][10])));
+                    v0 = (((v1 == a0[4]) == (a0[8] ? 27 : i0)) ? ((i1 && v3) * (i0 - a1[2][11])) : ((v1 > v2) / 8));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v1 = (((v1 > v3) && (v1 < a1[0][12])) ? ((v2 ? v0 : a1[2][11]) && (41 <= 35)) : ((i3 > i3) == (95 && 46)));
+                    v2 = (((3 || 37) ? (a1[0][8] <= v2) : (i2 ? 44 : i2)) - ((v0 ? a0[12] : 31) != (v3 ? a1[0][1] : 54)));
+                    v0 = (((a1[3][1] <= 28) ? (a0[15] || v1) : (i3 > v1)) < ((a0[10] >= v2) / 4));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[2][5] = (((v0 + v0) <= (48 > v1)) <= ((0 < v2) - (68 - v2)));
+            v0 = (((v1 > 83) || (a0[5] >= a1[3][6])) == ((i2 == v0) - (a1[2][1] || a0[10])));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((v2 - i5) - (a1[2][1] ? v1 : a0[1])) ? ((v3 == v1) - (i4 / 9)) : ((v3 ? a1[3][9] : v2) != (a0[6] <= v3)));
+                    a0[3] = (((a0[13] >= v2) != (i5 > i4)) / 9);
+                    v2 = (((v0 ? v1 : v3) == (a1[0][9] <= a1[1][1])) || ((i5 ? i5 : v2) % 4));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v2 = (((v2 > v3) != (v0 ? 16 : i4)) ? ((41 <= i4) % 1) : ((38 % 6) == (v0 == a1[0][0])));
+            v1 = (((79 + v2) == (a1[1][0] > v1)) == ((v0 ? v1 : a1[0][8]) > (i4 != a0[11])));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    if ((((v3 >= v3) + (99 % 3)) < ((v2 + a0[0]) >= (v3 % 6)))) {
+        a0[12] = (((a0[8] ? v1 : v0) * (a1[2][8] / 6)) + ((v0 == v1) - (8 ? v0 : 3)));
+        a0[11] = (((v3 && v3) + (v3 ? a0[6] : a0[15])) && ((24 && a0[7]) != (v3 == 6)));
+        a1[0][6] = (((v1 + 29) >= (v1 ? v0 : v1)) + ((a1[3][3] ? v2 : v0) > (v0 % 3)));
+    } else {
+        v1 = (((v0 / 3) * (v2 % 8)) - ((a1[2][1] ? 30 : 33) != (a1[3][5] != 89)));
+        v1 = (((v3 + v0) + (a1[3][10] ? a1[1][10] : 16)) < ((a0[11] ? a0[5] : a0[14]) && (v1 ? a0[4] : 37)));
+        a1[1][4] = (((v3 >= a0[13]) || (71 + 66)) <= ((a1[0][13] / 8) + (v0 % 8)));
+    }
+    if ((((40 / 5) + (20 <= 88)) + ((93 % 7) ? (v3 + v1) : (v1 <= v0)))) {
+        a0[8] = (((69 >= 75) - (76 * 93)) ? ((96 <= v3) != (a1[3][10] % 8)) : ((v0 % 2) + (v1 == v0)));
+        v3 = (((95 >= a1[0][5]) == (a0[9] ? 61 : v3)) / 7);
+        a0[7] = (((a1[3][4] - a0[12]) < (v1 * v1)) ? ((v2 / 8) != (a1[1][14] ? v2 : v0)) : ((v1 * a1[2][8]) == (a1[0][6] >= a1[1][0])));
+    } else {
+        a0[2] = (((v3 % 1) && (v2 <= v2)) && ((v2 == v1) + (v2 + v2)));
+        v3 = (((58 < v0) <= (45 + 80)) || ((9 && 37) ? (63 <= v3) : (v3 && a1[3][14])));
+        a0[9] = (((a1[0][9] ? a0[4] : 56) ? (v0 + a0[11]) : (v1 != v0)) && ((v2 ? v2 : a0[3]) ? (v0 != v3) : (52 <= 88)));
+    }
+    v1 = (((74 > v0) && (v0 <= a0[15])) - ((v2 <= v0) <= (v2 && v0)));
+    return (((14 == v1) && (a0[9] == v1)) > ((15 > 94) ? (v1 >= a1[1][14]) : (57 <= 62)));
+}
+int f4() {
+    int v0 = 32;
+    int v1 = 30;
+    int v2 = 6;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][8] - a1[2][14]) + (v3 > v1)) * ((v2 ? v3 : a1[1][1]) < (v0 % 6)))) {
+        v1 = (((v2 || 9) ? (v0 ? v2 : v2) : (a0[1] <= 22)) - ((23 && a0[13]) % 4));
+        a0[6] = (((v1 ? 50 : v1) - (a0[13] < v1)) || ((v0 - v2) >= (v0 <= 86)));
+        v2 = (((v1 ? v2 : v1) / 5) * ((v2 >= v2) / 6));
+    } else {
+        a1[0][0] = (((a1[1][12] < v0) || (v3 > v3)) - ((v1 % 5) + (v2 != 34)));
+        a1[3][2] = (((60 % 6) % 7) * ((v1 && 19) / 3));
+        v0 = (((v3 == v3) - (v0 > 55)) > ((53 ? v0 : a0[14]) || (a1[1][8] + a1[0][13])));
+    }
+    if ((((v3 - v2) * (21 > a1[1][9])) || ((v2 > a1[2][11]) > (v1 > v1)))) {
+        a1[2][13] = (((v1 % 2) == (11 / 5)) < ((81 != v0) < (v0 ? v3 : a0[2])));
+        v3 = (((v1 ? a1[1][7] : v0) * (a0[9] * v1)) != ((v2 ? 29 : a0[2]) + (a1[2][1] && 72)));
+        a0[6] = (((25 == v3) <= (v2 == v0)) > ((v2 != v0) ? (v1 != a1[1][0]) : (v0 * v1)));
+    } else {
+        v2 = (((v3 > a0[8]) * (v1 - v2)) % 2);
+        v0 = (((a0[7] ? v0 : a0[8]) * (78 || 22)) != ((56 / 6) / 5));
+        v2 = (((v2 > v0) >= (v1 || a1[0][9])) * ((a0[6] != a0[2]) ? (a1[2][9] <= v2) : (v3 <= 87)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v2 = (((i0 < 89) - (a0[5] + v0)) >= ((a1[0][4] * a0[10]) / 4));
+        {
+            int i1 = 0;
+            do {
+                a0[15] = (((a1[0][0] % 1) > (a1[0][9] % 8)) == ((v2 ? a0[5] : v0) ? (v0 / 9) : (7 && i1)));
+                a1[2][10] = (((v0 + v1) < (a0[2] ? 68 : i0)) && ((v1 / 9) < (v3 || 38)));
+                v3 = (((i0 + v3) == (i0 > v3)) > ((a1[0][14] + v1) <= (i1 || 6)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v1 = (((75 > a1[0][6]) + (a1[0][11] < 51)) - ((v2 <= v0) == (v1 * 20)));
+    }
+    v2 = (((a1[3][13] > v2) || (a0[5] == 47)) > ((v2 * a0[4]) || (a1[1][10] + v1)));
+    if ((((a1[0][0] <= a0[13]) >= (v3 ? v1 : 7)) + ((48 ? v3 : v3) && (80 == 22)))) {
+        v2 = (((v0 * 65) * (v3 + v2)) != ((v1 < v3) <= (4 ? v0 : v0)));
+        v0 = (((6 % 6) > (v2 < v1)) > ((v2 % 6) != (89 % 5)));
+        v0 = (((97 > 51) == (61 / 6)) - ((v2 == a0[5]) * (4 && v2)));
+    } else {
+        a0[3] = (((1 != 25) >= (v3 + v3)) % 2);
+        v1 = (((a0[7] && v0) < (v2 > v3)) - ((30 != v2) % 8));
+        a1[0][9] = (((v3 || 9) != (v2 % 8)) || ((v1 >= a1[2][2]) % 8));
+    }
+    if ((((16 ? v1 : v3) ? (a0[15] - 84) : (v2 || 13)) ? ((v0 ? a1[0][15] : v1) - (a0[3] < a0[14])) : ((v3 / 6) + (v1 % 9)))) {
+        v3 = (((a0[10] ? a0[5] : 71) && (a1[3][11] && a1[0][15])) && ((7 ? a0[1] : a1[0][4]) * (v3 || a1[3][4])));
+        a1[1][12] = (((v2 == v1) == (83 == 4)) * ((79 + v2) / 7));
+        v1 = (((83 ? a1[2][7] : 73) * (v2 % 8)) == ((76 + v1) != (v3 * v3)));
+    } else {
+        v3 = (((v2 >= v2) < (a0[3] >= v1)) == ((a1[2][8] / 8) > (v2 ? v0 : a0[8])));
+        v1 = (((50 ? v3 : v0) || (a1[3][8] > 38)) && ((21 == v0) - (v1 == a0[9])));
+        a0[7] = (((a0[3] % 7) <= (v0 < v3)) || ((v3 > a1[1][10]) != (v2 + v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v3 - 92) ? (a0[12] || i2) : (37 ? v1 : i2)) != ((i2 * v3) / 5));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((a1[2][0] > 65) * (v3 != v1)) / 9);
+                    a1[3][5] = (((68 > v2) / 9) + ((v2 / 4) || (a1[0][9] - v0)));
+                    v1 = (((i2 == i2) ? (v0 / 3) : (a0[13] * 72)) + ((a0[5] > 35) || (a1[0][14] < 33)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v1 = (((46 % 5) ? (a0[2] < a1[3][12]) : (v2 >= 56)) - ((69 / 5) > (53 < v3)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((85 < a0[0]) ? (v3 < v3) : (v0 - v2)) % 9)) {
+        a0[10] = (((v1 == 79) * (a1[1][0] % 1)) + ((24 + 24) * (v2 + 54)));
+        v1 = (((v2 && a1[0][11]) <= (19 * 13)) * ((v1 && v3) <= (47 < v0)));
+        a0[0] = (((a1[0][9] ? v2 : a0[7]) / 9) >= ((v0 + v3) < (52 / 4)));
+    } else {
+        a0[10] = (((a0[3] >= 62) != (v2 - v2)) <= ((v2 || v1) <= (v2 && v1)));
+        a1[1][7] = (((27 > v1) / 1) ? ((a0[5] < v0) % 8) : ((a0[6] ? v2 : 95) || (v2 != 38)));
+        v0 = (((v1 > v1) == (a0[11] / 1)) ? ((15 > v3) ? (v2 ? a0[15] : a1[0][1]) : (v3 >= v1)) : ((v0 ? v2 : a0[11]) >= (v0 ? v1 : v1)));
+    }
+    if ((((a0[15] > v0) * (a1[2][0] * 75)) > ((45 >= v0) >= (a0[15] || v1)))) {
+        a0[11] = (((a1[1][11] ? v2 : 3) <= (v1 + a0[15])) - ((v0 / 6) && (88 > v1)));
+        a1[1][5] = (((v3 != 25) + (a0[13] - 32)) / 7);
+        a0[5] = (((a0[3] + v3) + (a1[2][1] >= a1[3][9])) && ((v0 ? v0 : v0) % 3));
+    } else {
+        v3 = (((10 == v0) <= (a0[4] && v3)) * ((v2 < a1[3][4]) <= (v1 * v3)));
+        v1 = (((a1[1][11] != 83) != (v3 > a1[0][1])) + ((v0 < v1) && (15 < a0[8])));
+        a0[13] = (((v1 < v2) * (v0 + v2)) * ((v0 - 66) % 9));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            v2 = (((i4 % 1) <= (v2 == v1)) % 6);
+            v2 = (((a0[2] - v3) <= (v3 && v1)) ? ((v3 / 6) - (5 > v2)) : ((v0 ? 15 : v1) || (i4 && a1[3][7])));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((15 + v1) > 58) break;
+                    v2 = (((a0[5] % 7) ? (i5 ? v1 : i5) : (a0[1] % 3)) && ((65 || v1) / 5));
+                    v0 = (((27 / 1) >= (v2 % 5)) > ((1 > 16) * (a0[15] >= v3)));
+                    v1 = (((a1[1][9] || a1[0][15]) == (a1[1][2] + a1[0][5])) > ((41 == v1) && (i4 ? a1[0][1] : 21)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[2][0] || a1[1][1]) <= (v1 - 51)) / 6);
+}
+int f5() {
+    int v0 = 77;
+    int v1 = 50;
+    int v2 = 44;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            if ((v0 % 6) > 61) break;
+            a0[3] = (((14 == v3) < (v1 * a1[3][6])) <= ((v3 * v3) ? (a0[11] >= 63) : (47 != a0[13])));
+            a0[9] = (((25 > v3) * (72 - v0)) || ((i0 + v3) + (i1 + v0)));
+            v2 = (((96 ? v0 : v3) % 9) * ((a0[8] <= v1) > (49 || 86)));
+        }
+        v3 = (((v3 >= v0) ? (a0[9] < a0[1]) : (35 >= v0)) * ((i0 != a1[0][11]) % 3));
+        a0[1] = (((a1[3][2] / 8) % 2) - ((a0[14] > v2) < (a0[12] > a1[2][13])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            {
+                int i3 = 0;
+                do {
+                    if ((i3 - a1[1][12]) > 91) break;
+                    v3 = (((i2 % 2) != (a0[12] <= v3)) ? ((a1[2][3] >= a1[2][13]) != (a1[2][1] <= a1[3][4])) : ((a0[7] % 5) + (v2 ? v2 : 92)));
+                    v0 = (((17 + a0[11]) + (v1 ? 96 : a0[8])) < ((20 * i2) >= (v2 <= v1)));
+                    v2 = (((i3 > i3) - (v1 || 37)) * ((i3 + v2) - (v3 + v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v2 = (((a1[2][8] || v2) > (61 >= a0[7])) % 4);
+            v1 = (((i2 || v2) == (57 || a1[2][8])) > ((5 >= v3) ? (a0[14] || v2) : (v2 / 3)));
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((27 < 42) > (v3 >= a0[14])) ? ((v0 ? 72 : 77) < (a1[1][4] > a0[10])) : ((43 > v3) / 4));
+    if ((((v1 / 8) || (a0[6] ? v3 : 61)) % 6)) {
+        v2 = (((v3 - v0) != (52 || v0)) != ((v2 < v1) - (a0[12] / 9)));
+        v2 = (((v1 - v2) * (75 / 2)) < ((v2 || v2) < (v3 ? v1 : v1)));
+        v0 = (((v2 % 6) * (v0 ? v0 : 70)) || ((v2 && v1) || (v0 == 14)));
+    } else {
+        v0 = (((v2 + 11) * (93 == 67)) <= ((10 ? a1[1][5] : a0[2]) != (a0[10] > v1)));
+        v0 = (((a0[10] + a1[1][15]) > (v1 == v3)) % 6);
+        v0 = (((v3 < 66) > (v3 * v0)) != ((v2 * 74) == (v3 == a1[2][14])));
+    }
+    if ((((a0[3] ? 66 : 77) % 6) * ((77 == a1[3][13]) != (20 < v2)))) {
+        a0[7] = (((v0 >= v1) || (v1 < v0)) >= ((v3 / 7) != (v1 * v1)));
+        v2 = (((a1[3][11] < a1[2][12]) * (a0[5] / 1)) < ((v3 || a0[3]) / 7));
+        v0 = (((17 > v0) < (v0 % 6)) || ((68 <= 22) * (68 == v2)));
+    } else {
+        v2 = (((a0[7] >= a0[12]) && (v3 ? v3 : 85)) * ((v3 && 88) && (v0 <= v1)));
+        v3 = (((85 % 4) * (a0[1] && 9)) < ((v3 != v3) * (v3 <= v1)));
+        v0 = (((29 + v2) && (55 + v1)) / 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a0[13] != i4) && (v3 >= v2)) >= ((v1 + v3) ? (v1 || 72) : (v1 != v1)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    a1[2][5] = (((v3 < i5) <= (a1[3][7] * a0[14])) == ((a1[1][9] / 1) / 3));
+                    v3 = (((50 == a0[8]) >= (33 + a0[9])) ? ((i4 ? v0 : a1[2][0]) ? (i4 == v3) : (a1[0][2] > i4)) : ((v0 + a1[0][10]) % 1));
+                    a1[1][14] = (((v3 >= i5) % 9) && ((i5 - a1[3][10]) ? (i4 && v3) : (v1 <= i5)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[0] = (((63 * v1) != (v3 ? v2 : a1[2][5])) > ((a1[0][8] > a0[9]) && (a0[10] == v0)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v1 = (((20 / 2) % 1) || ((a0[6] || a0[0]) != (a0[14] ? i6 : i6)));
+        a1[2][14] = (((v1 - a0[9]) == (v1 && 98)) + ((v1 == a0[1]) < (v2 ? v1 : a0[5])));
+        {
+            int i7 = 0;
+            while (i7 < 7) {
+                if ((i7 + a1[2][0]) > 86) break;
+                a1[0][13] = (((v1 < a1[1][8]) > (i6 > a0[10])) ? ((i7 ? v1 : v3) > (i7 - v0)) : ((a1[0][15] + v0) ? (i6 || v1) : (a0[6] % 2)));
+                v3 = (((90 * v1) == (i6 ? v1 : i6)) && ((i6 * a0[14]) ? (a1[2][10] > a1[0][1]) : (2 && a1[0][13])));
+                v0 = (((v0 != a1[1][13]) != (90 < v1)) < ((62 >= 47) > (v2 > v3)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    v2 = (((v1 >= a0[13]) <= (v3 <= 82)) != ((49 > v3) && (61 >= v2)));
+    {
+        int i8 = 0;
+        do {
+            v3 = (((43 < v0) == (v1 ? v3 : 8)) || ((v2 + 69) ? (v3 - v0) : (a1[0][11] / 7)));
+            v1 = (((a1[1][7] ? v0 : a0[6]) < (a0[2] / 2)) <= ((59 > v3) >= (49 - v0)));
+            for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+                v1 = (((a0[5] - 23) >= (a0[12] + a0[7])) * ((v3 - 95) > (74 ? a0[1] : v2)));
+                a1[3][11] = (((v2 / 3) * (v2 <= a0[14])) - ((i9 < v3) > (v2 ? 22 : i8)));
+                v0 = (((a0[7] <= 28) < (v2 + v3)) == ((84 == v0) % 9));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    if ((((v0 < a1[2][10]) < (v3 && a0[8])) && ((v1 > a1[0][1]) < (v2 ? v0 : a0[11])))) {
+        v0 = (((a0[10] && a0[6]) < (63 < v3)) == ((a0[6] ? a1[0][8] : a1[0][3]) % 7));
+        v3 = (((v3 ? v0 : a1[1][5]) != (76 < v0)) >= ((89 / 8) + (v3 || a0[6])));
+        a1[0][13] = (((v3 ? v0 : 96) * (50 <= v2)) <= ((a0[1] % 1) % 1));
+    } else {
+        v1 = (((a0[10] && v0) ? (57 ? a1[3][12] : 80) : (v1 == v0)) <= ((v1 || v1) <= (v1 * a1[1][9])));
+        a1[0][10] = (((v2 <= 26) + (v1 != a1[1][11])) != ((35 - v3) + (v3 * a1[2][12])));
+        v1 = (((a1[2][0] > a0[5]) + (v2 * v1)) + ((a0[15] >= v2) ? (v1 && a0[15]) : (v2 ? 92 : v0)));
+    }
+    return (((69 <= v2) < (v1 + v2)) + ((a1[1][5] ? a1[0][13] : a0[15]) || (v0 - v3)));
+}
+int f6() {
+    int v0 = 43;
+    int v1 = 55;
+    int v2 = 36;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v3 = (((90 / 6) / 3) || ((a1[0][0] > 60) == (78 == v1)));
+        {
+            int i1 = 0;
+            do {
+                v1 = (((a1[0][2] / 9) + (a1[0][9] % 4)) == ((47 > 73) / 1));
+                v0 = (((i1 + v3) && (v2 != a1[2][7])) + ((97 - v3) / 3));
+                v1 = (((v1 > 84) + (i1 < a0[2])) == ((v1 <= 80) - (48 < a0[9])));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v1 = (((95 ? v2 : v1) && (a1[1][9] && a1[2][10])) > ((24 ? a0[9] : i0) - (v2 >= v3)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a0[12] = (((v0 > 78) <= (62 + v0)) > ((i2 / 7) >= (v0 && 51)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v3 >= i2) % 4) == ((v1 != 38) <= (45 + 64)));
+                    v2 = (((27 < a0[14]) == (83 <= a1[3][13])) && ((v1 + i3) % 8));
+                    a0[13] = (((31 - a1[1][0]) / 3) / 4);
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v3 = (((v0 + v1) < (a1[1][4] - i2)) ? ((v0 + a0[4]) < (56 / 4)) : ((a0[10] + a1[0][15]) <= (a0[4] * i2)));
+            i2 = i2 + 1;
+        }
+    }
+    a1[0][8] = (((v3 ? v0 : v1) % 7) || ((36 * v2) * (v2 ? v1 : a0[14])));
+    if ((((5 - v1) % 9) ? ((80 || v1) + (50 * a1[0][2])) : ((59 == 3) / 8))) {
+        v0 = (((v3 % 2) % 7) + ((v1 + v1) == (a1[3][1] && v2)));
+        v0 = (((v0 || v1) != (87 < v3)) > ((v1 || a0[14]) / 7));
+        v3 = (((v3 && v1) >= (v0 < a1[0][12])) || ((v1 / 8) != (v1 ? v3 : 67)));
+    } else {
+        v0 = (((v0 * v3) || (a1[2][5] <= a1[2][1])) <= ((89 && v3) == (a0[11] || a0[5])));
+        v2 = (((v3 != v3) > (23 / 4)) ? ((a0[10] <= v2) + (v3 + 69)) : ((v3 + 4) != (a0[14] < v2)));
+        a0[2] = (((v0 != v1) || (v2 <= v2)) != ((v2 >= v1) || (a1[3][1] >= v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v0 = (((v3 != 31) > (61 ? v2 : v1)) % 1);
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v2 = (((i5 - v2) <= (78 + 12)) == ((75 != 77) <= (v3 <= v1)));
+                v0 = (((i5 - v0) != (v2 >= a0[2])) < ((i5 <= 3) + (16 == a0[13])));
+                a0[4] = (((9 + 61) / 2) / 9);
+            }
+            v3 = (((94 * v2) < (a0[5] % 4)) % 7);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            v2 = (((45 == a0[14]) ? (i6 <= a1[0][4]) : (a0[3] * v3)) == ((i6 >= a1[3][14]) && (v0 > 99)));
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                v2 = (((4 <= a1[0][4]) > (22 * 70)) > ((a0[2] ? v2 : v2) ? (v0 <= v0) : (v0 ? 47 : 90)));
+                v3 = (((v1 < v0) % 2) / 6);
+                v0 = (((v0 - v2) > (a0[3] >= v0)) * ((a0[3] / 4) || (52 && v2)));
+            }
+            v2 = (((a1[3][15] && 9) && (v1 || v3)) ? ((v1 / 3) - (v2 + v1)) : ((v1 == i6) / 2));
+            i6 = i6 + 1;
+        }
+    }
+    v3 = (((v0 + 28) && (v1 != a1[2][14])) / 3);
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            a0[11] = (((i8 == v0) > (v0 / 3)) / 7);
+            a0[5] = (((v2 - i8) * (v2 > v1)) / 7);
+            {
+                int i9 = 0;
+                while (i9 < 2) {
+                    v0 = (((i8 % 3) < (v1 + a0[4])) % 2);
+                    v2 = (((v0 * 48) && (4 <= 69)) * ((v0 - 63) || (a0[11] == i8)));
+                    v3 = (((7 ? v0 : a0[4]) ? (i8 || 60) : (93 + v1)) < ((i9 < i9) + (40 % 1)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        a0[3] = (((55 ? v1 : v3) < (v1 < a0[2])) < ((85 < v1) && (a0[1] != v1)));
+        a0[4] = (((v0 <= i10) < (v2 % 2)) / 5);
+        {
+            int i11 = 0;
+            do {
+                if ((v2 % 8) > 97) break;
+                a0[11] = (((a1[2][4] < v1) ? (a1[2][8] ? v2 : v2) : (90 - i11)) % 4);
+                a1[2][11] = (((v0 * i10) <= (50 * v1)) * ((a1[3][9] >= a1[3][11]) / 2));
+                v3 = (((24 == i11) == (a0[8] < 33)) == ((a1[1][2] / 6) && (37 + v1)));
+                i11 = i11 + 1;
+            } while (i11 < 2);
+        }
+    }
+    if ((((v2 ? v1 : a1[3][2]) / 2) - ((a1[0][10] ? v3 : a0[14]) != (a1[1][4] / 7)))) {
+        v1 = (((v1 / 7) ? (96 <= a1[3][7]) : (55 && v0)) / 3);
+        a0[8] = (((v3 % 1) < (v3 && v3)) >= ((v2 == a1[3][12]) > (13 != 98)));
+        v1 = (((2 <= 62) != (67 && v2)) == ((a0[12] + v1) % 2));
+    } else {
+        v0 = (((v2 < v3) ? (a1[2][5] ? v3 : 33) : (v3 ? a0[14] : v3)) && ((26 <= a1[2][10]) != (74 / 5)));
+        a1[3][3] = (((78 != a0[11]) - (a1[2][2] - v0)) <= ((46 % 4) > (v0 < v1)));
+        a1[0][4] = (((v0 != v2) || (v2 > a0[5])) >= ((v3 ? v1 : a1[3][10]) || (v0 ? v1 : v0)));
+    }
+    return (((33 ? v2 : a1[0][7]) + (51 * v1)) > ((a0[8] == a0[4]) < (v2 || v3)));
+}
+int f7() {
+    int v0 = 1;
+    int v1 = 33;
+    int v2 = 81;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v0 = (((46 ? v1 : v2) && (a1[0][12] != a0[15])) ? ((24 - a0[12]) * (96 != 14)) : ((41 ? 57 : 79) / 9));
+            a0[4] = (((4 >= i0) / 1) || ((v1 ? 12 : i0) < (a1[0][5] * i0)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((v2 ? 5 : v0) > 72) break;
+                    v0 = (((a1[1][11] < a0[2]) >= (i0 ? a1[3][9] : v2)) - ((61 == a0[13]) < (a1[3][4] <= i0)));
+                    v1 = (((31 - 96) >= (v1 * 5)) + ((v0 && v2) > (a0[0] % 9)));
+                    v1 = (((v0 ? i0 : a1[2][5]) * (a0[2] % 4)) && ((v0 ? 71 : i0) * (i0 * i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v2 = (((80 >= i2) == (70 == 69)) <= ((v1 != 88) != (i2 + v2)));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((v3 <= a1[1][0]) < (10 % 9)) <= ((i3 + a1[3][0]) && (v2 - i2)));
+                    v0 = (((v2 != v2) ? (a1[3][1] == i2) : (i2 - 41)) <= ((a1[1][6] != i2) > (a1[0][7] % 5)));
+                    a0[13] = (((11 > v3) + (v0 * 17)) > ((1 / 7) / 4));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v3 = (((a0[9] ? a1[2][3] : v3) - (a0[6] >= a1[1][15])) < ((v3 % 1) - (a0[9] >= a0[12])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((6 == a1[2][8]) > 83) break;
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    a0[11] = (((v2 >= a0[6]) % 5) || ((v2 >= v3) % 9));
+                    v0 = (((a0[7] != 58) % 3) + ((i4 * i5) + (51 != 13)));
+                    a0[0] = (((a1[3][12] - i4) > (v2 <= a1[2][4])) ? ((a0[12] == a1[0][2]) ? (99 ? 37 : a1[1][12]) : (i4 >= a0[6])) : ((43 * a1[3][4]) && (56 ? 48 : a1[1][3])));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[3][13] = (((v1 == a0[3]) > (a1[1][9] % 2)) / 2);
+            v0 = (((v2 != v0) != (a1[0][12] * 87)) || ((a1[0][9] < v1) * (a0[4] + v1)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v0 = (((a0[12] != 23) >= (v2 ? v1 : a1[3][8])) % 6);
+    {
+        int i6 = 0;
+        do {
+            if ((v1 && v0) > 63) break;
+            v3 = (((a0[14] ? a0[13] : i6) / 8) + ((v0 && 17) == (i6 > a1[0][3])));
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                v1 = (((v0 <= a1[3][6]) ? (a0[9] * i7) : (a1[3][1] * 34)) % 5);
+                a0[6] = (((v1 ? a1[3][15] : 44) * (v2 ? a0[15] : 29)) || ((a0[12] || v1) == (v2 - 32)));
+                v1 = (((v3 % 1) - (a0[13] ? i6 : 96)) >= ((v3 && i7) || (v0 != v2)));
+            }
+            a1[1][10] = (((v0 ? v2 : v3) ? (v0 == 96) : (v2 + 89)) < ((59 >= 63) * (i6 >= a0[14])));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        if ((v3 * v2) > 65) break;
+        v1 = (((92 + v3) < (a0[4] * a1[1][13])) <= ((a1[1][4] < a1[2][14]) ? (5 * 95) : (v1 && i8)));
+        {
+            int i9 = 0;
+            while (i9 < 2) {
+                a0[3] = (((44 == a0[15]) != (a0[0] < v2)) * ((v2 + v2) || (i9 == i9)));
+                v1 = (((v0 == i9) <= (48 % 7)) + ((v1 > a0[2]) <= (a1[2][6] || 86)));
+                v2 = (((v2 ? 29 : i9) + (a0[13] - i8)) <= ((v3 > v2) < (a0[0] != v2)));
+                i9 = i9 + 1;
+            }
+        }
+        v0 = (((a1[3][1] && v0) % 3) - ((32 && v3) == (a0[7] / 4)));
+    }
+    if ((((v3 > v1) + (24 != v2)) != ((a1[2][6] / 2) ? (a1[2][2] <= v1) : (v1 % 1)))) {
+        v0 = (((53 + 8) != (a1[2][11] % 6)) - ((58 <= a1[3][0]) >= (11 != 29)));
+        v1 = (((a0[7] * v0) > (a0[6] >= v3)) == ((v0 || v0) || (11 % 2)));
+        v3 = (((v2 - v0) > (a0[12] >= a1[0][8])) <= ((a0[2] ? v3 : v0) / 1));
+    } else {
+        v1 = (((98 && a1[3][1]) && (10 == a1[2][11])) + ((62 && 17) >= (v3 == v1)));
+        a1[0][10] = (((v3 < v1) >= (v3 ? v0 : v3)) && ((89 * a0[12]) + (54 == a1[0][2])));
+        v1 = (((v1 / 6) ? (90 % 5) : (35 != a1[0][13])) / 9);
+    }
+    if ((((a1[3][0] * 70) && (a0[14] > 34)) && ((v3 || v2) / 1))) {
+        v2 = (((a0[15] < v0) != (v0 || a1[1][14])) == ((v3 ? a0[9] : a1[2][11]) != (v1 == v1)));
+        v0 = (((v1 < v0) * (v1 == v1)) < ((v2 > a1[0][1]) ? (a0[6] > 38) : (v0 % 7)));
+        a1[2][0] = (((95 != a0[3]) != (70 != v0)) != ((v1 * v0) == (v0 * v2)));
+    } else {
+        a0[14] = (((v1 && a1[2][12]) ? (v1 == a0[9]) : (v3 && 86)) < ((v3 ? v2 : 46) < (69 > v3)));
+        v1 = (((v1 < 68) % 9) / 3);
+        v3 = (((3 ? v0 : a0[3]) < (v3 + a1[1][1])) ? ((a1[3][2] > 2) / 6) : ((v2 % 6) * (v2 < v2)));
+    }
+    v2 = (((68 > a1[0][8]) || (v2 || v2)) * ((a0[1] ? a1[0][2] : v3) % 9));
+    if ((((a1[0][9] % 8) + (51 <= a0[6])) * ((28 ? 44 : a0[1]) >= (v3 ? a1[2][1] : v1)))) {
+        v0 = (((v0 != a1[1][6]) != (v2 != 48)) > ((v1 - v3) != (v3 ? v1 : a1[3][12])));
+        v1 = (((v0 - v0) == (5 != a0[6])) % 3);
+        a1[0][15] = (((30 > v3) ? (a1[2][15] >= v1) : (v1 % 8)) >= ((v3 / 5) ? (v2 + 8) : (v1 + v1)));
+    } else {
+        v3 = (((a1[3][15] <= v1) ? (a0[11] && a0[5]) : (v1 && v0)) && ((v3 + 27) <= (v0 || v2)));
+        v2 = (((v0 && a1[3][12]) || (78 >= v3)) <= ((v2 && v2) ? (v3 > v3) : (a0[5] ? 69 : 74)));
+        a0[10] = (((25 || v2) >= (v1 < a1[2][11])) || ((19 != 54) % 1));
+    }
+    return (((a0[2] * v2) == (29 > v1)) >= ((v2 != v2) <= (v3 > a1[1][3])));
+}
+int f8() {
+    int v0 = 66;
+    int v1 = 91;
+    int v2 = 74;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    a1[0][7] = (((v0 != 41) <= (v0 && v3)) == ((v2 / 1) / 3));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a0[12] * 61) ? (44 / 1) : (v0 || v0)) * ((v0 != a1[0][13]) * (47 - v0)));
+                a1[3][5] = (((v0 && v2) > (v1 > v3)) <= ((v0 + i0) > (28 != v0)));
+                v2 = (((v3 ? 27 : i0) ? (v0 >= v2) : (a0[14] - 63)) != ((a0[3] <= v0) && (v2 ? a1[0][7] : 78)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v2 = (((a0[7] ? 39 : 63) && (79 + v2)) == ((69 + 12) > (28 % 9)));
+        a0[2] = (((v3 ? a1[0][15] : 78) < (a0[14] ? a0[5] : 75)) ? ((a1[1][8] == v1) - (v0 + a0[1])) : ((v1 < 68) && (61 < a0[3])));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 * i2) > 76) break;
+            v1 = (((a0[13] ? v2 : a0[3]) / 3) != ((a1[1][10] && v2) > (17 ? 90 : v3)));
+            v3 = (((a1[0][11] && v2) * (39 / 6)) != ((v2 ? a1[1][15] : a0[12]) >= (i2 <= i2)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v2 = (((v0 <= v0) + (a0[10] % 5)) != ((v0 == i3) || (a0[6] || v0)));
+                v3 = (((i3 < i2) <= (a0[3] < a0[11])) != ((67 <= 89) < (35 > i3)));
+                a1[2][3] = (((60 ? a1[1][0] : a1[0][3]) || (v0 >= i3)) < ((a0[0] - a0[13]) + (69 && i2)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((v2 - v2) > 66) break;
+            a0[15] = (((i4 && a1[2][10]) != (34 / 1)) && ((a0[15] != 75) > (a1[0][5] || v3)));
+            {
+                int i5 = 0;
+                do {
+                    if ((v0 >= v2) > 71) break;
+                    v1 = (((a0[12] * v3) > (a1[2][13] == v3)) == ((a0[10] % 2) * (42 % 7)));
+                    v0 = (((i5 == 87) >= (v3 > 13)) * ((3 - 30) && (i5 && 53)));
+                    a0[14] = (((v1 ? v3 : v0) ? (v1 != 96) : (v3 || 83)) ? ((36 == i5) / 7) : ((12 ? 8 : a0[12]) / 4));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            a1[3][8] = (((a1[0][14] / 3) * (v3 < a0[12])) % 3);
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((35 % 5) > (v1 - a1[1][0])) <= ((47 - a0[13]) > (a1[2][7] >= v0)));
+    if ((((v2 * v2) ? (v1 == v0) : (v3 ? v1 : 77)) % 9)) {
+        v3 = (((v1 > v3) >= (v1 % 8)) >= ((25 % 1) + (50 + v3)));
+        a0[8] = (((v0 - a0[15]) != (v3 == 42)) * ((a0[10] >= v1) == (99 && a0[13])));
+        a0[5] = (((v3 ? 90 : v0) >= (v2 / 4)) > ((v0 || v3) > (v2 ? v0 : v2)));
+    } else {
+        v3 = (((v3 / 3) % 2) >= ((v2 < v2) >= (a1[1][0] && v1)));
+        v1 = (((a1[1][11] ? a0[0] : v3) != (21 ? v0 : v1)) < ((v0 + a1[2][15]) * (a1[0][3] != v3)));
+        v1 = (((v0 < a0[14]) ? (v1 && v0) : (v3 < v3)) ? ((a0[6] <= v0) || (v3 / 4)) : ((7 % 3) + (v2 ? 51 : v1)));
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        v1 = (((v3 + v2) || (v2 < a0[13])) && ((v0 || i6) != (a1[1][13] / 8)));
+        {
+            int i7 = 0;
+            while (i7 < 5) {
+                if ((a1[0][1] / 3) > 72) break;
+                a0[7] = (((i6 < i7) == (v0 ? v3 : a0[14])) == ((a0[9] != v1) > (36 <= a0[6])));
+                v1 = (((i7 - i6) && (v3 + v1)) % 2);
+                v3 = (((i7 || v2) ? (88 >= v3) : (a1[3][11] > i7)) == ((i7 ? a0[14] : 33) && (a1[3][8] > v1)));
+                i7 = i7 + 1;
+            }
+        }
+        v0 = (((a1[0][1] > 67) ? (36 - a0[6]) : (a0[12] / 8)) * ((2 == v1) || (i6 != i6)));
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[2][8] = (((a0[12] >= 54) ? (a0[1] + 21) : (v3 % 5)) - ((i8 && 1) <= (a1[1][1] < 3)));
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    a1[0][10] = (((51 * i8) * (v3 || a1[0][0])) <= ((v3 > a1[3][4]) >= (6 <= 92)));
+                    v3 = (((i8 || 80) / 5) != ((80 >= v2) < (v3 * 57)));
+                    a1[0][0] = (((92 < a1[0][12]) == (i9 >= v0)) - ((a1[3][3] != 76) * (76 > i9)));
+                    i9 = i9 + 1;
+                }
+            }
+            v3 = (((v1 / 7) || (55 * a1[2][0])) < ((19 || v3) != (v1 && v0)));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    if ((((63 * a0[12]) == (a0[8] ? 52 : v1)) && ((v2 ? 95 : v2) ? (a0[13] + v1) : (a1[3][5] && a1[3][11])))) {
+        a1[2][3] = (((v0 < a0[15]) <= (86 / 6)) >= ((19 == v0) * (v0 % 2)));
+        a0[6] = (((v3 + v1) ? (a1[3][12] == 92) : (a0[1] % 6)) && ((a1[0][8] + 91) + (a0[2] <= v0)));
+        v2 = (((v1 * v1) <= (a0[9] < 14)) * ((v2 - 76) % 9));
+    } else {
+        v3 = (((v2 == v3) < (v1 != 61)) / 5);
+        a1[2][10] = (((a0[12] + 90) / 4) < ((v3 > v0) / 7));
+        v1 = (((29 || 0) && (1 > v3)) <= ((a0[12] < v0) / 7));
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        v2 = (((i10 || 49) > (a1[2][0] % 8)) != ((v2 >= a1[0][12]) - (i10 < 25)));
+        a1[3][8] = (((a1[1][15] % 8) < (8 && 35)) * ((98 + v3) / 3));
+        {
+            int i11 = 0;
+            do {
+                if ((a1[2][13] * a0[4]) > 57) break;
+                v2 = (((v0 && 10) || (23 < v1)) % 6);
+                v1 = (((2 < a0[12]) / 5) < ((37 >= v1) >= (v2 || i10)));
+                a0[10] = (((5 != a0[13]) - (a0[4] ? a0[0] : v2)) == ((a1[2][9] / 9) + (v1 - v2)));
+                i11 = i11 + 1;
+            } while (i11 < 4);
+        }
+    }
+    return (((v1 >= a0[10]) <= (a0[4] == v3)) % 9);
+}
+int f9() {
+    int v0 = 91;
+    int v1 = 91;
+    int v2 = 89;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 <= a1[2][13]) && (v2 - v0)) - ((v3 != v2) * (v1 ? v1 : v1)))) {
+        a1[2][0] = (((v3 - v3) * (v1 < v0)) >= ((82 || v2) ? (20 * 45) : (a1[0][14] >= v1)));
+        v0 = (((v1 < a0[3]) != (v3 == v2)) != ((v0 ? v2 : v0) + (v1 - 68)));
+        v1 = (((v3 && v1) && (v2 ? v0 : 74)) + ((94 ? 14 : v3) ? (v2 % 7) : (v1 && v2)));
+    } else {
+        v1 = (((a0[0] || v2) ? (65 >= v1) : (v2 && v1)) / 4);
+        v2 = (((34 - 3) || (52 - a1[1][4])) && ((49 == a1[1][6]) || (v0 >= v3)));
+        v2 = (((a1[2][15] - v1) ? (a0[2] == v0) : (v1 + a1[3][13])) < ((v3 >= 58) == (a1[1][8] == a1[0][14])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v3 = (((v0 < 83) ? (v3 + a0[8]) : (v2 >= a1[0][3])) - ((v0 / 1) || (56 && v3)));
+            v2 = (((83 / 4) == (i0 && v0)) + ((v3 <= a0[15]) + (a0[5] >= v1)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((28 % 1) > 65) break;
+                a1[0][7] = (((a0[1] ? 50 : i0) == (v1 + 41)) < ((v2 >= a1[1][1]) ? (v0 - 49) : (a0[3] == v3)));
+                a0[11] = (((17 != 50) || (i0 * i1)) + ((i0 < a0[0]) + (74 && i0)));
+                a1[2][15] = (((82 - a0[9]) % 7) == ((v1 == i1) ? (a1[2][6] % 3) : (a1[1][0] / 8)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v1 = (((15 / 2) * (v3 > a1[3][2])) / 2);
+        v3 = (((47 ? a1[1][12] : v3) % 4) / 5);
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                a1[3][14] = (((v0 && a1[0][14]) < (i2 + a0[0])) && ((a1[3][6] ? 0 : v2) ? (i3 <= 77) : (v3 || v0)));
+                v2 = (((v1 > a1[3][0]) && (a0[4] > a0[6])) || ((v3 * a0[6]) * (v2 >= a0[8])));
+                a0[5] = (((v3 != 63) != (v2 != v3)) % 5);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((a0[5] / 8) <= (v1 >= v1)) * ((v1 ? v2 : 68) - (v3 / 6)))) {
+        v0 = (((a0[9] != a1[0][12]) + (v1 || 34)) != ((v3 % 6) % 4));
+        a1[2][15] = (((v1 == v3) || (65 != a1[2][15])) >= ((a0[8] != v0) <= (13 - v3)));
+        v2 = (((a1[1][7] * a0[2]) > (a0[10] == a1[2][5])) <= ((61 < a1[0][8]) >= (a0[8] && 94)));
+    } else {
+        a1[2][12] = (((v0 ? v1 : a1[0][4]) ? (77 * a1[2][2]) : (a0[11] - v1)) < ((a0[2] < v2) * (a1[1][4] + a1[0][6])));
+        a0[13] = (((v2 * a0[3]) < (v0 / 5)) && ((45 ? v3 : a0[12]) || (a1[2][7] * v0)));
+        v2 = (((a1[3][15] ? v0 : 41) < (v0 * 23)) == ((a0[2] < v2) <= (v1 * v3)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v1 = (((v1 * v1) < (v2 / 6)) / 5);
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            a1[2][14] = (((39 / 5) && (v1 && v2)) && ((a1[0][13] ? 32 : v2) || (6 != a0[15])));
+            v2 = (((16 < v1) && (62 != 59)) + ((i4 < v3) <= (i5 ? 83 : v3)));
+            v0 = (((v1 != a0[7]) || (v1 + v1)) || ((v1 <= v1) && (v1 ? a0[10] : 42)));
+        }
+        v1 = (((v1 * a1[1][11]) <= (v0 || i4)) == ((76 || i4) < (v3 <= 73)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            {
+                int i7 = 0;
+                do {
+                    if ((i7 * 14) > 83) break;
+                    a1[1][0] = (((a0[0] * v1) * (i6 || v1)) % 5);
+                    v3 = (((a1[1][12] ? v3 : v0) * (v1 >= i7)) != ((v1 ? 90 : v3) - (10 > i7)));
+                    a1[0][12] = (((v1 == a0[6]) ? (v0 == a0[14]) : (20 / 8)) || ((80 == a0[0]) < (95 || v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            a0[2] = (((v3 <= 27) * (79 % 8)) + ((v0 ? v1 : v0) != (v0 == v2)));
+            a0[5] = (((68 ? v2 : v2) - (v1 ? i6 : a1[2][3])) / 8);
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        a1[3][5] = (((i8 && a0[8]) ? (a1[1][4] == v3) : (v3 <= v1)) < ((v2 == v2) <= (v3 * a0[3])));
+        v2 = (((v0 == 14) ? (a1[2][4] || v2) : (v0 * v2)) + ((96 ? i8 : v3) * (52 / 7)));
+        for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+            v1 = (((a0[8] / 9) - (i8 && i9)) <= ((i9 / 3) >= (v1 <= a1[2][3])));
+            a0[8] = (((a0[1] / 6) && (v3 - v2)) >= ((a1[2][12] - v1) / 3));
+            v1 = (((v1 && i9) % 4) ? ((v1 == i8) % 4) : ((a1[3][5] >= 7) ? (13 * a1[3][7]) : (v0 >= v0)));
+        }
+    }
+    for (int i10 = 0; i10 < 6; i10 = i10 + 1) {
+        if ((v3 < a0[7]) > 78) break;
+        v1 = (((v3 > v2) / 7) == ((v0 && v2) || (v0 >= v1)));
+        for (int i11 = 0; i11 < 5; i11 = i11 + 1) {
+            if ((42 / 9) > 80) break;
+            a0[11] = (((v3 + i11) || (a1[3][13] <= 38)) ? ((50 >= 80) || (a0[5] % 3)) : ((i11 != 61) && (a0[13] || v0)));
+            v3 = (((v1 - 0) >= (a1[2][14] >= v3)) ? ((15 && v2) + (59 > v0)) : ((19 != v0) != (i11 == v1)));
+            v1 = (((v0 / 1) && (v3 ? i11 : v2)) && ((i11 <= v0) < (v3 == v2)));
+        }
+        a0[14] = (((i10 > v1) + (i10 < a1[0][3])) * ((v0 >= v3) || (i10 || v3)));
+    }
+    a0[15] = (((v0 % 5) * (72 != v1)) + ((v3 + v2) == (v1 * v1)));
+    if ((((69 < 12) > (v0 == a1[3][5])) % 8)) {
+        v0 = (((a1[3][6] >= v2) % 7) < ((v3 >= 21) + (95 * a0[9])));
+        v1 = (((21 == a1[2][3]) <= (47 - v3)) != ((84 || a0[11]) < (54 != v1)));
+        v2 = (((v3 != a0[0]) == (a0[0] >= v0)) && ((v0 || v1) % 8));
+    } else {
+        v3 = (((46 == 80) != (a1[0][2] ? v2 : a0[10])) < ((v2 + v1) < (v0 ? a1[2][5] : v2)));
+        a1[3][3] = (((a0[15] / 7) != (v3 ? a1[2][14] : v1)) * ((v1 < v0) || (88 ? v1 : v2)));
+        a1[1][14] = (((v3 * 57) < (49 - 17)) || ((v1 < v3) % 8));
+    }
+    return (((28 && v2) / 2) > ((v0 / 6) != (v3 % 9)));
+}
+int f10() {
+    int v0 = 83;
+    int v1 = 35;
+    int v2 = 54;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[9] > v2) && (91 - v0)) ? ((a0[4] < a0[2]) && (a1[2][3] % 9)) : ((76 > 80) < (v3 * v1)))) {
+        v0 = (((59 - v1) >= (a1[1][13] >= v2)) - ((v2 / 2) % 1));
+        v3 = (((v1 / 2) && (41 % 7)) + ((38 && 63) / 2));
+        v3 = (((v2 * 43) > (v1 <= 4)) > ((a1[0][15] == v0) ? (95 ? v1 : v2) : (a1[2][3] != v0)));
+    } else {
+        v3 = (((52 - 13) < (42 && v2)) == ((43 - 36) * (v0 ? v0 : v2)));
+        v2 = (((a1[3][6] <= a1[0][6]) ? (v2 == v3) : (a1[3][12] * v3)) ? ((v3 > v0) + (v1 - v2)) : ((v2 + v0) != (17 <= v3)));
+        v2 = (((77 >= a0[10]) >= (47 / 1)) ? ((v0 / 1) - (a1[1][0] != v1)) : ((a0[12] > 85) && (v0 < a0[5])));
+    }
+    if ((((v1 - v2) > (v1 < a0[7])) < ((v3 / 4) && (v3 ? v1 : a1[1][1])))) {
+        v0 = (((v1 >= 84) / 9) && ((v3 == 7) && (v1 && v1)));
+        a0[9] = (((v3 % 7) * (42 / 6)) != ((v1 > 70) - (v3 / 5)));
+        v2 = (((v1 ? v3 : 76) != (95 >= 30)) && ((a1[0][9] && v3) / 2));
+    } else {
+        v1 = (((a1[0][14] / 5) < (v1 != v0)) < ((v3 && v3) / 9));
+        a1[3][7] = (((28 ? v2 : 16) + (v3 * v2)) + ((a1[3][6] * 17) - (v3 != v0)));
+        v1 = (((33 && 38) * (v0 > a1[1][10])) == ((a1[2][4] == a1[1][11]) + (v2 * 31)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v0 < i0) || (v0 ? a0[7] : v1)) <= ((13 < v2) && (v0 ? v1 : v1)));
+            v3 = (((v0 || a0[2]) / 4) - ((57 && a0[2]) / 2));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v2 = (((v1 + 13) < (25 > 22)) > ((a0[5] ? a0[3] : v0) >= (i0 / 8)));
+                a1[3][9] = (((a1[2][14] > 99) == (i0 - 19)) - ((v1 ? 30 : 51) + (59 != a1[2][10])));
+                v2 = (((i1 + v3) == (i0 >= v2)) + ((i0 + 71) * (2 / 7)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((a0[6] || v3) / 3) / 7)) {
+        v0 = (((a0[15] <= v0) > (62 % 7)) > ((a1[1][5] + v3) / 6));
+        v0 = (((v3 ? v3 : v0) ? (v0 * v2) : (4 || v3)) % 4);
+        v3 = (((99 <= 32) / 1) > ((v3 != 67) * (v3 >= v0)));
+    } else {
+        v3 = (((43 - v1) >= (46 > 81)) ? ((a1[3][7] % 1) + (a0[5] >= a0[8])) : ((v0 > a0[15]) * (v2 != 1)));
+        v1 = (((a0[9] >= v0) > (v3 - v0)) ? ((v1 + 99) > (v1 >= v0)) : ((4 >= v0) ? (75 && v2) : (87 ? v1 : a0[9])));
+        v1 = (((v2 ? v3 : a1[0][1]) || (v0 / 9)) - ((v2 ? v2 : v0) || (v3 + v2)));
+    }
+    v0 = (((v2 >= 97) < (a0[13] != v0)) || ((a1[3][10] < a1[0][2]) >= (v2 && 96)));
+    v3 = (((45 ? 5 : a1[1][6]) + (a0[12] < v3)) * ((v2 % 6) <= (v3 >= a1[0][8])));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((a0[11] % 1) > 95) break;
+            v1 = (((v2 == a1[0][15]) ? (v2 < i2) : (v1 ? v2 : 98)) && ((28 % 7) && (a0[11] > v2)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((i3 + a0[10]) > 69) break;
+                    v2 = (((i3 ? v0 : a0[12]) >= (a1[0][5] == v1)) || ((12 / 3) != (10 == a1[1][4])));
+                    a1[3][11] = (((v2 * 29) ? (v2 < 85) : (56 % 8)) != ((v1 ? a0[9] : 39) % 1));
+                    a0[2] = (((12 / 8) / 7) % 5);
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a1[1][13] && v2) - (v0 ? a1[1][15] : v1)) < ((v3 != v0) < (v2 + v3)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v0 = (((a1[0][0] < a1[1][14]) <= (92 <= a1[3][5])) > ((a1[2][15] ? v0 : v1) && (a0[4] ? 44 : a1[1][6])));
+                    v0 = (((27 / 7) || (i5 >= v3)) && ((a1[2][10] && 1) != (v3 - v2)));
+                    v2 = (((v0 - a1[2][13]) * (47 / 5)) * ((i5 + v1) ? (52 + v3) : (2 != v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[0][12] = (((33 > 40) > (v2 != 11)) ? ((v0 <= a1[1][11]) == (v3 != a1[1][10])) : ((i4 % 2) % 6));
+            a1[2][10] = (((a0[12] >= v1) && (62 || v3)) / 2);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v0 = (((a0[3] <= 36) && (a0[11] - 91)) <= ((a0[8] - a0[12]) == (i6 > v3)));
+                v1 = (((61 * a1[1][5]) ? (a1[0][0] % 2) : (20 == i6)) >= ((75 % 5) <= (93 - v0)));
+                v3 = (((v2 + a0[5]) != (9 >= v0)) + ((v3 < 24) - (19 == v0)));
+            }
+            a0[14] = (((a1[0][11] && v0) < (a1[3][13] != v2)) ? ((92 % 7) - (v1 && v3)) : ((i6 <= i6) ? (a1[2][11] == a1[1][7]) : (a1[3][12] + a0[9])));
+            a1[2][11] = (((v1 >= v1) % 2) % 8);
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[10] = (((i8 - i8) < (v0 < 31)) || ((v0 ? v0 : v0) >= (v1 == a1[3][2])));
+            v3 = (((23 / 5) != (a0[5] % 7)) ? ((v3 || 10) * (33 + a1[3][15])) : ((70 <= a0[11]) != (v1 * a0[14])));
+            {
+                int i9 = 0;
+                do {
+                    a1[0][12] = (((71 >= v1) <= (a0[13] - v1)) || ((v1 % 7) ? (a0[7] / 8) : (47 / 8)));
+                    a0[10] = (((a1[3][12] % 7) / 3) >= ((47 == i8) != (v0 + v0)));
+                    v1 = (((i8 / 8) && (i9 || a1[0][7])) == ((v2 ? v3 : i8) % 3));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    return (((46 != v3) > (v0 ? v1 : 87)) < ((a1[1][2] + a1[1][7]) ? (55 % 8) : (30 && a0[10])));
+}
+int f11() {
+    int v0 = 8;
+    int v1 = 77;
+    int v2 = 94;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[12] / 7) || (a0[14] % 4)) && ((v1 / 3) >= (v2 <= v1)))) {
+        v0 = (((v1 + v2) >= (v3 <= 16)) < ((a1[1][7] > 53) < (v0 != a0[13])));
+        a1[3][5] = (((v3 - 61) >= (a0[14] / 3)) ? ((v0 ? v0 : a0[12]) < (v2 >= a1[2][14])) : ((76 == 23) > (a0[12] > v1)));
+        a0[1] = (((a0[6] || v0) != (v3 > a1[0][10])) != ((54 ? a0[13] : v1) ? (a0[1] / 6) : (v2 + v2)));
+    } else {
+        a0[15] = (((a0[4] && v1) <= (v0 % 6)) > ((v0 ? 62 : 16) >= (v2 + 67)));
+        v3 = (((v0 % 4) ? (v3 + v1) : (48 >= v2)) == ((56 ? v0 : a0[3]) % 7));
+        v2 = (((v3 * v1) >= (v1 != v1)) * ((75 == v1) % 4));
+    }
+    a1[1][14] = (((v1 / 7) || (v3 || a1[1][15])) > ((92 > 56) / 6));
+    if ((((a0[9] + v0) == (31 + 34)) < ((v2 % 8) + (v3 * 34)))) {
+        v3 = (((v0 == v0) - (90 || v0)) * ((v0 ? v2 : v0) != (97 - v0)));
+        v3 = (((v1 + v2) ? (v1 ? 59 : 29) : (v3 <= a0[0])) == ((v3 ? v0 : a0[12]) <= (v3 % 7)));
+        v3 = (((a1[0][14] != 86) + (v1 != a1[1][14])) != ((29 % 4) % 4));
+    } else {
+        a0[6] = (((v1 == a0[11]) - (v3 * v2)) <= ((32 ? v2 : v0) * (v3 && a0[3])));
+        v3 = (((a1[2][1] ? v3 : v1) % 9) != ((a0[5] < a0[11]) >= (v1 - a0[8])));
+        v2 = (((a0[3] ? 95 : v3) ? (v0 - v1) : (v1 % 9)) || ((74 && 61) >= (v2 / 1)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a0[4] = (((v1 * v0) * (a0[4] || a1[1][4])) ? ((77 - i0) * (85 / 1)) : ((v2 == i0) - (a0[10] || v3)));
+        {
+            int i1 = 0;
+            do {
+                v1 = (((v2 * v1) || (i0 || a1[2][12])) < ((a0[4] > 47) && (v1 > v2)));
+                v2 = (((a0[11] != i1) / 8) > ((16 <= v3) != (a1[1][14] != v1)));
+                v2 = (((v1 * 75) / 4) ? ((a0[13] % 5) + (79 == v1)) : ((v1 != v0) && (i0 ? 79 : 30)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v0 = (((v2 >= a0[11]) || (50 - a1[1][15])) ? ((a0[1] && v1) % 2) : ((a1[2][8] * 61) ? (v2 >= 18) : (a1[3][3] <= 58)));
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                if ((v0 / 6) > 63) break;
+                a1[2][13] = (((v1 ? a0[6] : v1) ? (a1[3][11] || a1[2][14]) : (a0[8] ? 14 : i2)) ? ((v3 * a1[0][0]) != (v3 == v0)) : ((50 >= v0) - (a0[3] <= v2)));
+                v3 = (((v3 >= v0) || (v2 * 51)) != ((i2 && i2) == (88 <= 19)));
+                a0[2] = (((a0[9] + a0[2]) <= (v0 ? i2 : a0[1])) ? ((a1[0][2] >= a1[0][1]) * (a1[0][14] * v0)) : ((v1 > i3) / 6));
+            }
+            v1 = (((14 != i2) + (v2 % 6)) * ((v1 != 36) ? (46 && 99) : (85 + 56)));
+            v2 = (((v3 + i2) <= (67 < i2)) / 5);
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        if ((v2 || 72) > 93) break;
+        v3 = (((v2 > 26) - (a1[0][12] % 6)) % 7);
+        a1[2][12] = (((a0[13] != v2) * (a0[11] && 65)) + ((a1[0][11] ? 27 : v2) < (i4 % 7)));
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            a0[3] = (((a1[1][1] && 80) == (33 - v3)) >= ((98 == a0[6]) / 5));
+            v2 = (((a0[13] ? 93 : i5) / 4) > ((39 + 93) ? (48 == 68) : (a1[0][4] <= v3)));
+            a0[1] = (((a0[11] % 1) > (78 != v3)) - ((v2 + i4) * (i5 || 47)));
+        }
+    }
+    if ((((v3 || a1[1][0]) + (62 >= v2)) > ((a1[3][5] ? v0 : 99) && (v3 % 3)))) {
+        a0[0] = (((1 - 11) <= (v0 >= 76)) <= ((23 % 1) && (a0[5] >= 68)));
+        v1 = (((v1 && a1[3][13]) >= (v0 <= v1)) >= ((64 ? 98 : a1[1][11]) - (a0[5] ? v0 : a0[9])));
+        v1 = (((v3 == v2) > (20 + v2)) <= ((v1 / 3) ? (a0[4] == a0[10]) : (v1 % 3)));
+    } else {
+        a0[9] = (((a0[4] && v0) ? (10 && 7) : (47 ? v0 : a0[12])) % 1);
+        v1 = (((v2 && v3) * (35 == v2)) && ((a0[3] && a1[0][2]) / 4));
+        a1[1][15] = (((v3 && 76) || (v2 != v2)) / 2);
+    }
+    if ((((85 - 50) >= (v1 < a0[14])) / 8)) {
+        v1 = (((88 - 26) >= (v0 ? 82 : v3)) / 8);
+        a1[1][14] = (((v2 && v2) != (v1 - v3)) != ((v3 >= v3) * (v1 * v2)));
+        a0[4] = (((v3 * a1[2][2]) == (v2 % 2)) >= ((v3 / 5) - (14 / 1)));
+    } else {
+        v2 = (((v3 == v1) / 3) ? ((74 > v3) == (v2 <= v0)) : ((v1 ? 43 : a0[1]) > (v2 == v3)));
+        v0 = (((a0[13] * 24) / 5) > ((v3 < 7) == (1 <= a0[12])));
+        v2 = (((v3 / 6) % 6) >= ((v2 != a1[1][1]) ? (a0[2] / 1) : (36 ? 32 : v2)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            {
+                int i7 = 0;
+                do {
+                    a1[2][8] = (((91 != a1[3][11]) ? (i7 > i6) : (i7 != i7)) <= ((i6 != a1[2][12]) != (v2 / 9)));
+                    a0[6] = (((a1[0][11] < i6) >= (a1[2][3] <= a0[10])) % 6);
+                    a0[2] = (((i7 >= a1[0][9]) - (v3 < a0[2])) == ((v0 - 24) ? (v3 <= v3) : (a1[3][11] + 79)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            a1[0][4] = (((61 % 3) || (46 ? 75 : v1)) == ((v3 - a0[8]) != (v1 < i6)));
+            v0 = (((74 + v1) - (a1[3][4] >= v1)) || ((a1[0][14] < i6) * (87 ? 53 : 96)));
+            i6 = i6 + 1;
+        }
+    }
+    v1 = (((v2 <= a1[0][15]) && (43 == a0[13])) ? ((a0[15] + v0) <= (36 - v1)) : ((v3 != v1) - (v2 <= a1[3][14])));
+    return (((48 % 2) ? (50 >= v1) : (v2 ? v1 : v3)) - ((v2 || v2) && (v2 < v2)));
+}
+int f12() {
+    int v0 = 24;
+    int v1 = 29;
+    int v2 = 38;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[0][13] < a0[3]) + (a1[3][4] % 7)) == ((v2 < a0[1]) <= (23 * v1)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v2 >= i0) + (82 % 9)) < ((v0 * v0) - (a0[4] * i0)));
+            v2 = (((a0[6] ? i0 : a1[3][0]) != (v2 < v0)) / 4);
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[1][2] = (((i1 || 75) < (v2 >= v2)) > ((98 == a0[15]) == (v3 + v2)));
+                    a1[3][7] = (((v3 >= 17) * (v2 * a1[1][1])) <= ((a1[3][12] && 4) ? (v0 != a1[3][10]) : (27 ? a0[11] : 54)));
+                    a0[13] = (((v2 == 25) + (v1 ? v2 : a1[1][5])) == ((a0[12] * i0) / 1));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v3 - a1[0][3]) ? (a1[1][14] && v3) : (29 == 7)) > ((48 / 2) > (i2 <= v0)));
+            a0[1] = (((v2 * v0) / 1) == ((a1[2][3] >= a1[3][14]) == (v2 >= v0)));
+            {
+                int i3 = 0;
+                do {
+                    a1[3][8] = (((30 % 5) || (40 || a1[2][3])) * ((i2 ? a1[0][1] : v1) && (v1 > i3)));
+                    a0[11] = (((v3 == i2) - (27 ? v1 : v0)) * ((90 || 98) - (v2 < v0)));
+                    v1 = (((a1[2][10] != v3) ? (v3 || v0) : (v3 || i2)) % 3);
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v1 = (((a1[2][14] == 44) > (v0 <= v3)) != ((v1 ? v1 : v0) / 4));
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((a1[0][2] / 2) != (i4 ? 18 : v1)) <= ((a1[0][0] + v0) - (a1[2][13] && 96)));
+        a1[2][2] = (((a1[3][9] < a1[3][1]) > (v3 ? i4 : v2)) <= ((a0[15] <= 97) != (v1 ? v1 : 78)));
+        {
+            int i5 = 0;
+            do {
+                v2 = (((v0 || 1) >= (11 % 7)) && ((i5 ? v1 : 55) == (v3 ? a0[10] : v3)));
+                a1[1][6] = (((i4 || 69) && (78 + a0[8])) ? ((v2 + 89) != (a1[1][0] % 5)) : ((v0 < 93) / 6));
+                v2 = (((i4 % 4) || (68 || 69)) ? ((i4 > a1[1][14]) / 9) : ((i4 * v2) * (v0 < 70)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        if ((v2 < v1) > 83) break;
+        v2 = (((v0 <= 97) != (53 - 51)) > ((63 > a0[10]) ? (a0[14] ? v2 : i6) : (v1 % 3)));
+        a0[5] = (((v0 == v0) % 3) / 1);
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            a0[8] = (((i7 ? 90 : v0) != (v2 || a0[11])) == ((v1 / 4) / 3));
+            a0[3] = (((a0[13] != i7) <= (41 < v3)) ? ((a0[4] + a0[4]) > (a1[3][1] % 4)) : ((4 ? i7 : 51) - (v3 + i6)));
+            a1[1][3] = (((i6 >= v0) > (v2 || 56)) - ((0 / 4) - (32 == a0[1])));
+        }
+    }
+    if ((((a0[12] - v3) && (v0 ? a0[12] : v3)) || ((a0[7] ? a1[2][5] : v2) < (26 % 1)))) {
+        v1 = (((a0[15] / 5) >= (v2 * a1[1][4])) <= ((63 >= a1[2][13]) == (v1 <= v3)));
+        a1[2][2] = (((v3 <= v0) || (v3 != a1[2][9])) ? ((v1 > 85) == (v0 * a0[12])) : ((a1[0][14] != v3) != (v3 >= 77)));
+        v3 = (((v2 % 6) / 3) % 3);
+    } else {
+        v0 = (((73 + 88) || (a1[0][5] - 9)) && ((a1[2][8] % 1) == (a0[9] ? v1 : 7)));
+        v2 = (((v2 > a0[14]) - (a0[8] && 32)) == ((82 % 5) > (a1[2][15] > v0)));
+        v3 = (((95 / 1) != (v3 && v3)) || ((v1 || a0[11]) == (a0[11] > v2)));
+    }
+    a0[11] = (((v3 ? 76 : v0) <= (99 == a0[4])) < ((a1[1][14] / 8) > (v0 * 74)));
+    v2 = (((v3 != v3) == (21 < 56)) / 2);
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        if ((36 + v2) > 68) break;
+        {
+            int i9 = 0;
+            do {
+                a0[12] = (((v3 - v2) * (0 % 7)) <= ((63 && v1) || (i9 == a1[2][13])));
+                a1[3][5] = (((a0[5] != 13) >= (v0 ? v2 : v0)) && ((v3 != v3) ? (v0 == a1[3][6]) : (63 >= a0[13])));
+                a1[3][6] = (((a0[11] - 53) == (i9 > a1[3][15])) ? ((34 * 64) != (v3 && v1)) : ((i8 == a1[3][2]) != (v0 + v3)));
+                i9 = i9 + 1;
+            } while (i9 < 5);
+        }
+        v1 = (((a0[14] * v3) && (v1 / 4)) && ((28 == 3) || (77 + v0)));
+        a1[3][0] = (((14 <= 54) <= (v3 * v2)) - ((a1[2][1] ? 59 : v0) != (a0[5] - v3)));
+    }
+    return (((a1[0][12] >= v1) - (a1[1][14] * v3)) < ((v3 > v2) / 6));
+}
+int f13() {
+    int v0 = 65;
+    int v1 = 26;
+    int v2 = 70;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v1 = (((v2 > v3) - (a0[15] * i0)) != ((i0 >= 33) ? (v0 + a1[0][5]) : (a0[2] == v3)));
+        v1 = (((88 != v3) % 2) / 7);
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            if ((a0[7] - v3) > 71) break;
+            a1[3][8] = (((a1[3][4] % 8) >= (68 && v2)) >= ((a1[1][13] > 96) + (a0[3] || a0[0])));
+            v2 = (((76 <= v2) % 3) || ((v3 % 4) % 5));
+            a1[3][0] = (((a1[1][11] > 74) || (77 || 88)) || ((i1 && v1) == (6 + a0[2])));
+        }
+    }
+    v3 = (((a0[8] > v0) != (v3 ? v3 : v3)) < ((v0 < 46) > (14 * v2)));
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v0 <= 73) != (30 > 19)) % 6);
+            v1 = (((a1[3][7] < i2) % 2) < ((v0 * v0) < (80 ? 11 : a1[2][0])));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                a0[14] = (((79 <= 30) <= (i2 != v1)) > ((i2 >= i2) <= (v2 == a0[1])));
+                a1[1][13] = (((i2 > 90) < (v1 ? a1[3][12] : 57)) % 1);
+                a0[3] = (((i2 ? v2 : 0) % 9) <= ((i2 > a1[0][13]) ? (a1[0][5] >= a0[15]) : (v2 / 6)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a0[3] = (((74 * v3) ? (a1[2][4] * i4) : (a0[3] ? a1[3][12] : v0)) * ((96 + a0[14]) != (a0[8] + a1[0][0])));
+                v1 = (((i4 >= 81) / 7) ? ((65 % 5) || (59 >= v1)) : ((v3 ? 98 : i4) > (i4 % 4)));
+                v1 = (((v2 >= v3) == (a1[1][7] || v3)) + ((a1[3][3] + v0) % 1));
+            }
+            v2 = (((23 <= v0) * (a1[3][14] - v2)) > ((a0[13] != 39) - (v3 - 63)));
+            a1[1][10] = (((32 >= v0) - (49 / 8)) <= ((v1 == a0[8]) * (a0[14] >= v1)));
+            i4 = i4 + 1;
+        }
+    }
+    a1[1][1] = (((v2 || v3) > (v3 * v3)) || ((v0 % 8) % 9));
+    {
+        int i6 = 0;
+        do {
+            if ((4 <= a1[3][15]) > 89) break;
+            v0 = (((51 > a1[0][8]) == (33 - i6)) >= ((v2 ? 98 : v3) % 7));
+            a0[15] = (((v2 - 86) <= (i6 >= v2)) >= ((23 >= 65) ? (v3 != v2) : (75 / 2)));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((a1[0][4] && 22) * (v3 % 5)) / 1);
+                    v2 = (((a1[2][2] == a1[3][4]) <= (26 <= v0)) * ((v0 <= 11) * (a1[1][5] / 3)));
+                    a1[1][11] = (((v0 + i7) - (a0[7] - v2)) && ((15 && v1) ? (v0 * a0[0]) : (a1[2][1] % 9)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    a0[10] = (((v2 && v1) && (v3 % 3)) && ((91 * v1) % 6));
+    a0[4] = (((a1[3][1] > v1) != (17 * v1)) == ((v3 - a1[1][3]) - (20 ? a1[0][14] : a0[2])));
+    {
+        int i8 = 0;
+        do {
+            v1 = (((a1[0][2] <= v2) ? (a1[0][14] >= 73) : (96 + 13)) < ((v3 && a0[8]) > (v0 ? v1 : a1[0][3])));
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    v1 = (((47 ? a0[3] : 86) + (v2 / 3)) != ((v2 || a1[2][8]) - (v1 <= v2)));
+                    a1[0][9] = (((v3 * i9) <= (a1[2][2] ? v2 : a1[2][12])) - ((i9 == a1[2][4]) ? (60 == i8) : (68 + v0)));
+                    a1[0][7] = (((i8 >= i9) < (73 ? v0 : a0[12])) / 7);
+                    i9 = i9 + 1;
+                }
+            }
+            v1 = (((v1 - v2) && (v3 * 1)) > ((a0[11] == v1) ? (i8 - 95) : (v0 || a1[0][6])));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            if ((88 && v2) > 71) break;
+            a0[6] = (((v1 && a1[0][7]) > (v2 - v0)) * ((a1[3][0] * v3) % 7));
+            a1[1][3] = (((i10 && v3) + (v1 == v3)) <= ((a0[0] == a1[2][10]) ? (41 / 4) : (a1[1][1] ? 18 : 47)));
+            {
+                int i11 = 0;
+                do {
+                    v1 = (((i11 < v3) <= (i11 < 44)) <= ((26 * v2) % 2));
+                    a1[0][0] = (((37 || 93) - (39 || v0)) ? ((v2 - v3) && (a1[1][2] / 6)) : ((73 == 45) <= (v3 && a0[0])));
+                    a1[1][13] = (((44 && a0[14]) ? (v0 < i11) : (a0[12] == v3)) - ((v0 && i10) > (a0[11] || v3)));
+                    i11 = i11 + 1;
+                } while (i11 < 6);
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((v2 * 10) >= (v3 && a1[0][9])) ? ((a1[0][15] / 2) >= (47 > v3)) : ((a0[6] / 1) ? (38 || a1[2][1]) : (v2 < v1)));
+}
+int f14() {
+    int v0 = 16;
+    int v1 = 63;
+    int v2 = 51;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 ? v3 : v0) < (22 <= a1[1][3])) % 3)) {
+        v2 = (((38 == a1[1][14]) / 8) / 5);
+        a1[3][13] = (((a1[1][14] >= a0[0]) != (v2 ? v3 : 90)) - ((v2 ? v0 : v3) <= (v2 / 3)));
+        v2 = (((a1[1][13] ? 93 : 15) > (v1 + v1)) == ((97 && a1[0][11]) < (a0[9] ? v1 : 36)));
+    } else {
+        a1[0][5] = (((v0 && v3) < (v3 > v1)) - ((78 <= v1) >= (7 <= a0[12])));
+        v2 = (((v2 < 91) + (18 % 2)) && ((13 - 70) >= (v1 ? a0[10] : a0[13])));
+        v2 = (((v1 || v2) == (v1 >= 43)) + ((32 * a1[2][14]) && (v0 >= v0)));
+    }
+    if ((((83 * a1[3][11]) + (21 + 1)) + ((v2 && v0) / 3))) {
+        a0[2] = (((69 + 1) < (a0[3] ? a0[4] : v3)) * ((a0[3] * v0) <= (a1[3][6] || v0)));
+        v3 = (((43 / 7) < (a0[2] == 45)) / 9);
+        v1 = (((v0 ? v1 : a1[1][15]) <= (v1 && 31)) + ((v0 <= v1) % 5));
+    } else {
+        v2 = (((a1[0][8] > v2) < (98 / 1)) >= ((2 && v0) ? (v2 <= 42) : (v3 ? 42 : v3)));
+        v0 = (((70 ? a0[6] : 8) && (4 * a0[10])) <= ((v0 > a1[0][1]) && (v3 > v1)));
+        a1[1][1] = (((a1[1][9] ? a1[0][13] : v2) + (a0[6] ? v0 : v1)) * ((v1 ? v1 : 33) ? (a0[8] % 2) : (v2 == v3)));
+    }
+    a0[12] = (((40 + v2) - (v1 >= v0)) == ((v1 ? v0 : v0) == (a1[1][3] >= 75)));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v1 = (((i0 / 8) ? (43 || a1[2][6]) : (a1[2][8] || 80)) > ((a1[1][13] || 79) != (v3 != 25)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((33 >= v1) <= (v0 - 45)) * ((85 && i1) >= (i0 != i1)));
+                    v1 = (((v1 <= 46) < (v3 / 5)) != ((v1 <= i0) && (v2 && a0[15])));
+                    v3 = (((v3 ? i1 : 44) * (i1 || 44)) ? ((9 < a0[14]) / 1) : ((i1 == v2) - (v2 >= a1[1][2])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v0 = (((a1[0][2] < v1) || (v0 < v2)) % 2);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 % 7) + (a1[2][3] ? a0[11] : 6)) > ((a0[13] != 18) || (v0 <= v3)))) {
+        a0[14] = (((v1 ? v1 : 55) && (v0 ? v3 : v1)) * ((8 <= 60) - (v2 > a1[1][13])));
+        v0 = (((v0 / 1) || (v1 != a1[1][6])) <= ((v1 == v3) || (a1[3][10] == v3)));
+        a0[3] = (((11 ? v2 : v1) / 6) - ((v0 != a1[3][8]) < (v2 / 8)));
+    } else {
+        v0 = (((67 == v2) * (v2 ? v3 : v3)) == ((v3 || a0[11]) && (v2 && v0)));
+        v2 = (((v2 * a1[2][3]) % 1) > ((v0 % 6) - (61 ? 21 : a1[0][5])));
+        v2 = (((v2 ? v3 : 98) == (a1[3][3] + v0)) - ((v3 > 31) % 1));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v3 = (((i2 * a1[3][5]) % 3) + ((v2 ? a1[1][3] : v2) || (a1[2][3] % 7)));
+        a1[0][10] = (((a0[2] <= v1) % 4) || ((55 ? 54 : i2) + (v0 != a1[0][9])));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v1 = (((83 == a1[1][12]) && (8 < i2)) == ((i3 / 8) != (0 != v3)));
+                v3 = (((98 < v0) ? (a1[0][1] && v0) : (v3 % 1)) * ((v1 ? a1[0][4] : i2) ? (i2 || v1) : (v1 >= v3)));
+                v3 = (((17 != 74) < (15 * v3)) / 2);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v1 = (((a1[0][6] == 90) != (v1 ? v1 : v1)) <= ((v0 || v2) == (v2 % 2)));
+        {
+            int i5 = 0;
+            do {
+                a1[2][9] = (((i5 % 3) > (a0[12] / 5)) > ((a1[0][10] + v0) == (v0 > a1[1][5])));
+                v2 = (((v2 != i5) + (v1 ? a1[3][8] : v1)) > ((a1[3][12] <= v0) < (i5 / 9)));
+                v1 = (((a1[1][1] != a1[1][7]) > (v1 > a1[0][6])) <= ((a1[2][1] == 30) * (14 == v2)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+        v0 = (((v1 * i4) < (79 >= 32)) != ((a1[0][0] == a1[1][7]) >= (v2 % 4)));
+    }
+    v1 = (((v0 * v0) < (v1 == v1)) / 9);
+    if ((((a1[1][15] ? v1 : v0) * (38 && 27)) + ((v1 / 8) + (v0 == 43)))) {
+        a0[6] = (((v3 ? a1[3][9] : 49) && (a0[14] ? v1 : v2)) * ((a0[14] == 4) > (48 % 1)));
+        v1 = (((v3 ? 37 : v1) < (61 <= a1[3][14])) ? ((v2 ? a0[0] : a1[0][2]) == (v2 ? a0[2] : 68)) : ((v2 + 97) * (v2 != v3)));
+        v2 = (((81 + v0) ? (v3 + v3) : (58 < a1[1][2])) <= ((v1 < a1[3][12]) / 6));
+    } else {
+        a1[2][6] = (((v0 / 6) - (a0[3] * v3)) != ((a0[2] || v1) ? (a1[1][0] * 36) : (v3 == 40)));
+        a0[14] = (((v3 == v3) <= (87 == v0)) ? ((a1[2][7] >= v2) && (v3 <= v1)) : ((v3 >= v3) ? (a1[1][3] ? v1 : 19) : (v2 ? v1 : 78)));
+        a0[12] = (((73 / 1) / 8) % 8);
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        a1[0][12] = (((v1 * a0[15]) * (v2 < v3)) != ((a0[6] <= a0[6]) <= (v3 - a0[11])));
+        a0[14] = (((a1[0][7] % 9) % 6) != ((v0 <= 96) && (v0 <= a1[0][1])));
+        for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+            if ((86 == v2) > 52) break;
+            v1 = (((14 > i6) <= (a1[1][14] >= a0[4])) < ((v1 && v0) / 4));
+            v2 = (((v1 - a0[13]) <= (a1[1][9] != v0)) && ((v1 - v3) <= (a0[9] ? v1 : v2)));
+            v0 = (((79 <= a1[1][4]) ? (a1[1][5] < a0[0]) : (50 > i6)) ? ((v2 && i6) / 4) : ((a0[7] != i6) + (a1[3][8] != 56)));
+        }
+    }
+    return (((v2 != 89) != (a0[0] * v3)) <= ((a0[12] % 9) * (1 <= 86)));
+}
+int f15() {
+    int v0 = 19;
+    int v1 = 23;
+    int v2 = 68;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                if ((v0 * a1[2][1]) > 75) break;
+                v1 = (((a0[15] * a0[0]) - (a0[10] != 29)) == ((0 != v0) ? (v3 != a1[1][9]) : (v3 && a1[0][2])));
+                v2 = (((v2 >= a0[15]) ? (v2 ? a0[15] : a1[0][2]) : (v2 < v1)) ? ((36 <= a0[3]) - (i0 > v3)) : ((93 || v3) * (a1[1][1] * v1)));
+                v3 = (((73 != v2) - (27 == v1)) % 7);
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v1 = (((57 * v1) * (a0[14] < a0[14])) + ((v2 > v2) || (a1[0][14] || i0)));
+        v0 = (((91 ? 27 : 58) != (i0 >= v1)) % 5);
+    }
+    if ((((a0[8] ? 35 : v3) <= (v1 == 5)) == ((37 == a1[0][14]) + (v2 && a0[9])))) {
+        v2 = (((a0[2] - v1) && (56 < v3)) && ((a1[0][10] ? v2 : v0) && (74 % 5)));
+        v3 = (((v3 && a1[3][10]) == (77 * 47)) && ((16 * a0[3]) + (16 + v1)));
+        v3 = (((v2 <= a0[10]) + (v2 / 4)) ? ((a1[2][13] / 4) == (v0 || v3)) : ((v3 ? v3 : 73) ? (a0[15] % 9) : (v0 * v1)));
+    } else {
+        v1 = (((v0 && v3) ? (v3 % 1) : (21 <= a1[1][14])) > ((v0 || 71) < (88 != v3)));
+        v3 = (((a1[0][11] ? 55 : v1) < (a0[2] < v3)) ? ((v0 > v2) > (v1 / 3)) : ((v3 ? v3 : a0[11]) ? (a0[11] == a1[1][1]) : (99 >= v1)));
+        v2 = (((12 - v3) % 9) - ((v2 + a0[10]) > (v2 ? v1 : v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v0 = (((87 * i3) || (v0 ? v0 : i3)) > ((89 == a1[2][4]) - (i3 && i3)));
+                v3 = (((i3 != i2) / 9) <= ((v2 % 6) <= (55 % 1)));
+                v2 = (((a0[10] > a1[2][8]) == (v3 != 53)) != ((v3 - v2) || (v3 % 2)));
+            }
+            v2 = (((v2 >= a1[2][12]) != (v1 ? i2 : v2)) / 3);
+            a1[1][2] = (((v2 - v1) && (v1 || v2)) && ((a0[10] >= v3) + (v1 % 7)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v3 = (((a1[0][11] <= a0[6]) >= (v2 / 5)) == ((i4 < 42) % 4));
+        a0[10] = (((v0 + a0[7]) == (v1 / 3)) ? ((44 % 2) / 9) : ((64 == 98) ? (v3 && a1[1][14]) : (25 / 5)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((35 + v2) - (61 - v2)) ? ((7 >= 63) * (i5 + 85)) : ((i4 ? v3 : i5) % 2));
+                v2 = (((45 % 4) ? (a1[2][7] ? 48 : 41) : (a1[1][13] && 75)) / 4);
+                a1[3][1] = (((v0 != a1[0][9]) <= (i4 ? a1[0][5] : v1)) - ((v1 > v1) / 4));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((v3 >= a1[2][8]) || (v3 % 9)) ? ((v3 < v0) / 7) : ((v1 <= i6) + (i6 == a1[2][0])));
+            v3 = (((a0[5] && a1[0][12]) - (a0[12] < 90)) + ((a0[13] != i6) ? (v1 >= a1[0][13]) : (v3 * 24)));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v3 = (((a1[2][2] == v2) || (40 <= a1[0][6])) - ((v1 ? 82 : 88) == (41 * a1[0][14])));
+                v2 = (((v0 != a0[0]) < (a0[4] * i7)) >= ((1 < v2) + (3 + 51)));
+                v0 = (((i6 && v0) / 1) || ((39 > a0[12]) ? (a1[2][0] && v0) : (v2 - a1[3][0])));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    if ((((v3 * a0[8]) / 8) - ((16 || a1[3][8]) - (a0[8] >= v1)))) {
+        v3 = (((v1 / 9) % 9) == ((55 + 81) ? (v0 == v0) : (62 + 49)));
+        v1 = (((45 >= v2) < (a1[2][1] > 48)) < ((v2 > a0[5]) != (v3 == a0[5])));
+        v1 = (((v2 - a1[0][8]) / 2) && ((a0[6] == v3) >= (24 + a1[2][13])));
+    } else {
+        v0 = (((91 && a1[1][14]) % 3) != ((a0[0] % 9) || (v0 * v0)));
+        v2 = (((v3 % 5) > (v1 == 83)) || ((a1[1][12] || v0) ? (a1[1][5] <= a1[3][3]) : (72 - v1)));
+        v3 = (((48 * 86) + (67 <= a1[2][4])) % 6);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((a1[2][10] - 88) > 54) break;
+            v1 = (((45 / 7) * (a1[1][14] * v1)) * ((a0[10] >= 91) + (a1[0][14] <= v2)));
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    v1 = (((51 > i8) && (7 > v3)) <= ((68 - a0[6]) * (v0 == i9)));
+                    v3 = (((98 < v3) == (47 / 5)) % 2);
+                    v3 = (((v0 < i9) && (81 + i9)) != ((i8 + 31) - (i9 / 6)));
+                    i9 = i9 + 1;
+                }
+            }
+            v3 = (((a0[15] % 6) || (18 ? v0 : v3)) > ((v2 == v0) && (v2 <= a0[3])));
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    for (int i10 = 0; i10 < 4; i10 = i10 + 1) {
+        a1[1][9] = (((v3 <= v0) == (a1[2][13] ? i10 : 60)) && ((95 - a1[0][11]) == (v0 != v2)));
+        a1[0][1] = (((v2 / 6) + (v0 || v2)) || ((v1 / 3) % 3));
+        for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+            v0 = (((v3 * a1[3][7]) > (i10 / 3)) ? ((a1[2][11] ? a0[7] : v1) == (33 <= a1[0][14])) : ((a0[6] != v3) >= (v3 <= 92)));
+            v0 = (((i10 < v2) * (a1[0][6] < i10)) > ((v1 % 4) ? (a1[1][5] != v1) : (5 > v3)));
+            v1 = (((74 >= 13) + (i10 || 50)) && ((32 ? 57 : i11) != (20 ? 81 : 55)));
+        }
+    }
+    v3 = (((a1[3][8] == 79) || (v3 <= 36)) != ((v3 >= a1[2][5]) == (45 < a1[0][11])));
+    a1[0][11] = (((v3 && v3) / 8) || ((93 + v3) - (v1 * 52)));
+    return (((v3 - v0) < (v0 < a0[0])) || ((58 <= a1[1][0]) ? (v2 < a0[11]) : (a1[1][8] == a1[3][0])));
+}
+int f16() {
+    int v0 = 71;
+    int v1 = 93;
+    int v2 = 42;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a1[3][2] && a1[0][9]) != (v2 % 8)) / 8);
+    if ((((v1 / 7) >= (6 == a0[4])) - ((58 < 15) ? (21 <= v0) : (v0 != a1[2][1])))) {
+        a1[2][2] = (((1 % 7) < (v2 && v0)) >= ((v2 - v2) || (v3 < a1[0][12])));
+        v0 = (((v1 < a1[0][10]) + (v2 == 5)) != ((v1 * 74) - (v2 == v1)));
+        v2 = (((a1[2][15] && 72) ? (v1 / 4) : (v2 <= v3)) <= ((v1 * v2) < (97 % 6)));
+    } else {
+        a1[3][7] = (((v2 == 44) - (v1 + v0)) || ((v2 <= 17) || (85 % 3)));
+        a1[3][11] = (((a0[0] != a1[3][8]) + (a0[13] - a1[2][2])) ? ((81 + v2) && (v1 >= a0[12])) : ((v0 > v1) / 8));
+        v2 = (((63 / 2) * (v2 == a0[11])) <= ((25 > 89) < (a1[1][13] % 8)));
+    }
+    if ((((v0 ? v0 : v1) ? (81 != v1) : (v2 == 51)) >= ((a0[4] - a0[10]) * (33 && v3)))) {
+        a1[1][1] = (((v1 > v0) >= (a1[0][11] ? 6 : a1[3][14])) == ((v0 <= v0) != (a1[2][9] % 7)));
+        a0[10] = (((v2 - v2) - (v3 - a1[3][15])) || ((94 / 6) < (v1 > 85)));
+        a1[2][13] = (((52 == v1) == (64 || 40)) == ((59 || v1) > (94 ? v1 : 17)));
+    } else {
+        a1[1][3] = (((a0[8] * v2) % 2) && ((a0[9] != a0[12]) + (a0[4] > 31)));
+        v2 = (((v2 * v3) / 3) > ((4 <= v3) < (v3 ? v1 : a1[0][10])));
+        a1[0][6] = (((33 == v1) != (v0 + 29)) || ((v3 % 6) ? (96 || v1) : (a1[2][12] || v3)));
+    }
+    if ((((a0[15] <= v1) % 5) > ((v1 / 9) % 8))) {
+        v3 = (((v0 > a1[3][10]) != (v1 / 6)) < ((v3 || v3) * (v2 && 60)));
+        v3 = (((a1[1][11] ? 74 : v1) - (v3 != 27)) < ((v1 - a0[0]) ? (a1[0][2] && 82) : (v0 > v1)));
+        a0[0] = (((a0[11] > v2) <= (v2 / 3)) - ((v0 <= v0) ? (v0 * v2) : (a0[14] ? a0[0] : 9)));
+    } else {
+        v1 = (((a0[6] <= a1[1][8]) ? (56 + 92) : (16 >= 48)) ? ((v0 ? v3 : 72) + (v2 || v2)) : ((v1 > v2) / 2));
+        v2 = (((v1 == 38) <= (v2 != v0)) > ((v3 != v0) < (31 - v3)));
+        a1[1][6] = (((v0 ? a1[2][4] : 38) && (10 && a1[0][8])) % 8);
+    }
+    if ((((a0[3] + v3) ? (v0 * v1) : (v2 < 74)) <= ((18 >= 28) / 9))) {
+        v3 = (((10 || 48) <= (31 ? v1 : 39)) - ((a1[2][7] % 5) < (a1[0][7] / 6)));
+        v0 = (((v0 || v1) % 8) * ((v0 || a1[0][1]) <= (v0 ? v2 : 56)));
+        a0[11] = (((v1 || v0) <= (66 ? v0 : a1[2][11])) / 1);
+    } else {
+        a0[10] = (((a1[0][6] ? v2 : v3) / 6) % 4);
+        a1[3][1] = (((93 ? v0 : a0[8]) % 7) * ((v2 / 9) == (a1[0][1] - 80)));
+        v1 = (((v3 * v1) % 6) < ((a0[13] * v0) != (95 || a1[2][2])));
+    }
+    if ((((v2 ? v0 : v0) >= (a1[3][15] ? v1 : 85)) % 2)) {
+        v3 = (((54 / 8) / 6) * ((v0 ? 83 : v3) + (v1 && a1[0][15])));
+        v3 = (((a1[1][11] - a1[1][10]) && (v0 < 23)) == ((80 > 61) > (v3 == v2)));
+        v3 = (((a1[3][11] > 46) + (22 && v0)) != ((v3 < a1[0][6]) % 5));
+    } else {
+        v1 = (((v1 == v1) > (a0[9] ? 85 : a1[3][15])) == ((65 <= v2) > (a0[11] / 6)));
+        a1[0][13] = (((a0[9] && v0) == (a0[7] % 6)) >= ((a1[2][4] < v3) != (v1 / 5)));
+        v0 = (((a0[13] / 7) >= (v3 ? a1[0][9] : v2)) == ((v2 + a1[2][1]) < (91 < a1[2][4])));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[8] = (((7 + a0[9]) <= (v1 / 2)) - ((i0 * a0[13]) == (v2 && i0)));
+            v1 = (((v3 == a0[14]) >= (a0[4] * a1[1][11])) || ((a1[0][13] + v2) > (34 < a0[3])));
+            {
+                int i1 = 0;
+                do {
+                    a1[2][14] = (((8 > i0) <= (24 % 1)) ? ((v2 == v2) + (12 && v1)) : ((v2 ? a1[0][1] : v3) * (v3 + 85)));
+                    a1[1][15] = (((a0[15] == v0) ? (a1[0][5] + a0[2]) : (v3 ? a0[2] : i1)) * ((a1[1][9] <= a1[2][13]) && (v0 * v1)));
+                    v1 = (((39 ? v1 : 1) && (a1[2][13] < v1)) <= ((i1 || a0[1]) - (58 > 68)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    v1 = (((78 != a1[3][5]) < (v3 && a1[1][15])) == ((26 / 8) - (v3 >= v1)));
+    v3 = (((a1[1][13] != v0) + (a1[0][0] == 35)) * ((v3 != v2) || (a0[6] % 7)));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v1 = (((v3 || v3) || (v3 + a0[9])) != ((v3 == 19) / 9));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][2] = (((51 ? a1[0][1] : 65) <= (a1[3][4] < v2)) - ((a1[3][0] + 39) + (a1[2][12] % 2)));
+                    v0 = (((i2 - i2) != (a1[3][1] / 2)) && ((v2 <= a1[3][11]) >= (v0 % 3)));
+                    a0[14] = (((v3 ? i2 : v0) && (i2 < a0[10])) / 5);
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v3 = (((i2 % 5) <= (80 % 5)) ? ((20 + v3) ? (v1 / 3) : (a0[10] <= 12)) : ((v1 ? a0[14] : v2) < (v2 ? v0 : i2)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((a0[1] == 2) + (58 % 5)) % 1);
+}
+int f17() {
+    int v0 = 34;
+    int v1 = 14;
+    int v2 = 64;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a0[9] = (((v2 && i1) >= (v0 ? 61 : v2)) % 3);
+                v1 = (((73 * v2) <= (a0[1] ? i1 : v3)) != ((69 == a1[2][10]) != (22 || 3)));
+                a0[0] = (((v0 >= v3) > (i0 ? 51 : 65)) || ((a1[1][15] ? i1 : a1[2][9]) < (a1[0][13] != 21)));
+            }
+            a0[11] = (((v1 <= 5) ? (v3 + i0) : (v0 == 11)) || ((a1[1][4] || a0[7]) * (30 - v0)));
+            v2 = (((a0[8] + v2) && (v0 == a1[3][15])) && ((65 >= v2) <= (a0[2] - 15)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a1[3][4] = (((v1 ? v1 : v0) <= (v0 + v0)) != ((64 == v3) && (v1 ? a0[9] : i2)));
+        v2 = (((a0[5] ? 60 : v3) % 7) % 8);
+        {
+            int i3 = 0;
+            do {
+                v1 = (((v1 % 5) <= (a1[0][2] - 14)) - ((i3 + 97) ? (v1 % 4) : (v2 >= v3)));
+                v0 = (((v3 ? a1[1][11] : a0[13]) ? (a1[1][14] % 7) : (v0 ? a1[3][1] : i3)) >= ((v0 ? v0 : a1[0][14]) == (v1 && v2)));
+                a1[2][13] = (((63 >= v1) <= (v2 > i3)) ? ((v3 + v1) >= (72 + v0)) : ((80 >= v1) > (31 != 28)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            v0 = (((42 || v1) >= (v2 - 74)) / 2);
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((i4 != 56) ? (45 < v2) : (a0[8] / 3)) && ((v0 % 4) && (9 || 27)));
+                    v2 = (((a1[1][5] / 2) >= (v1 == i5)) > ((a0[13] || 13) % 3));
+                    v2 = (((i5 >= v3) * (12 >= a0[0])) || ((i5 * v0) >= (39 % 4)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v1 = (((v3 * a1[2][15]) + (v0 || i4)) / 7);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            a1[0][12] = (((39 * i6) - (v2 && a0[11])) < ((a1[0][8] && v3) - (53 || a0[3])));
+            a1[3][2] = (((v1 / 4) <= (v2 >= 29)) + ((82 * 10) < (a1[1][6] / 6)));
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((a0[13] || v3) > 90) break;
+                v3 = (((a0[13] / 1) / 8) && ((a1[0][14] * v1) ? (i6 % 3) : (v1 && v0)));
+                v1 = (((v3 + v0) ? (v1 * v0) : (a0[12] + 82)) > ((a0[14] % 4) == (a0[12] || a1[1][5])));
+                v1 = (((i6 - v3) || (v0 % 6)) != ((i7 * v1) % 4));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                v3 = (((22 > a1[3][12]) ? (v3 ? a1[1][7] : 75) : (a0[14] >= 14)) - ((a1[0][9] < v1) < (i9 ? i8 : a1[0][9])));
+                v1 = (((a0[7] <= v3) ? (v0 * v0) : (71 ? a0[9] : v0)) + ((72 >= a1[3][1]) && (v0 <= a1[3][4])));
+                a0[2] = (((v3 - 70) > (v3 % 2)) == ((62 * v2) != (v2 / 3)));
+                i9 = i9 + 1;
+            } while (i9 < 8);
+        }
+        v0 = (((29 != a0[3]) * (89 + 86)) - ((36 * a0[11]) * (50 > v1)));
+        v3 = (((v3 - a0[10]) ? (v0 >= i8) : (62 == 60)) && ((a0[11] ? a1[1][15] : a1[0][10]) == (i8 && v3)));
+    }
+    v3 = (((a1[2][2] <= v0) == (v3 || v0)) && ((v2 + 91) % 9));
+    if ((((v1 && v3) != (v1 != 74)) * ((89 != v0) == (v3 >= 76)))) {
+        a1[0][7] = (((v0 < v2) && (v0 ? 47 : v3)) && ((v1 > v3) > (a1[0][0] + 55)));
+        a1[2][3] = (((82 / 1) / 1) == ((a1[1][2] >= a0[4]) >= (a0[5] + a1[0][7])));
+        v2 = (((v2 % 9) - (a0[13] > 22)) || ((27 == v3) >= (v3 || v1)));
+    } else {
+        a0[1] = (((a0[3] >= v1) <= (0 ? 72 : v1)) / 7);
+        v1 = (((a0[5] >= v2) >= (v0 >= v2)) + ((a1[1][15] / 1) || (99 || v1)));
+        v1 = (((v0 != a0[0]) ? (v3 + v2) : (v3 ? a1[3][9] : a1[0][13])) >= ((v0 ? 97 : v1) > (v1 + 89)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 8) {
+            {
+                int i11 = 0;
+                do {
+                    a1[3][9] = (((v2 * i10) > (v2 || v3)) >= ((92 % 2) != (v1 || a1[1][13])));
+                    v0 = (((a1[3][7] || v2) != (40 + a0[8])) > ((7 + 92) > (v2 + i11)));
+                    v1 = (((v1 - v2) % 2) ? ((73 % 3) / 3) : ((a1[3][15] - v1) >= (a0[8] ? 26 : v0)));
+                    i11 = i11 + 1;
+                } while (i11 < 8);
+            }
+            a0[5] = (((v1 != 53) * (v2 * v1)) <= ((a0[13] <= v0) || (93 > a0[1])));
+            a0[13] = (((78 == 66) >= (v3 ? i10 : v3)) || ((i10 && v2) + (i10 <= v3)));
+            i10 = i10 + 1;
+        }
+    }
+    {
+        int i12 = 0;
+        while (i12 < 8) {
+            {
+                int i13 = 0;
+                while (i13 < 4) {
+                    a1[1][7] = (((i12 != i12) % 8) >= ((i12 <= i12) % 9));
+                    a1[3][4] = (((v1 + a1[0][0]) < (v2 ? 52 : 79)) - ((v0 + 85) ? (59 == i13) : (i13 % 2)));
+                    v0 = (((27 % 7) + (v0 ? 41 : v1)) == ((a1[1][3] + 63) ? (a0[3] ? 23 : a1[1][4]) : (v1 ? 87 : a1[0][3])));
+                    i13 = i13 + 1;
+                }
+            }
+            v0 = (((a0[5] != 26) != (a0[14] >= i12)) || ((a1[2][10] * 52) ? (v2 >= v3) : (a0[14] + a0[7])));
+            a1[3][14] = (((v3 != 37) + (v3 % 5)) / 6);
+            i12 = i12 + 1;
+        }
+    }
+    for (int i14 = 0; i14 < 4; i14 = i14 + 1) {
+        v3 = (((v1 ? a1[2][3] : v1) + (83 ? 46 : v2)) + ((a1[2][1] && i14) == (v3 != a1[1][8])));
+        for (int i15 = 0; i15 < 8; i15 = i15 + 1) {
+            if ((v3 ? 87 : v2) > 53) break;
+            v0 = (((v2 == v0) >= (17 == v0)) < ((i15 + i15) * (v0 ? a0[2] : 33)));
+            a0[4] = (((3 < v0) * (v2 - v2)) + ((i15 ? 77 : 14) % 7));
+            a1[2][14] = (((v2 > v0) == (v2 < 26)) >= ((v2 >= v2) / 4));
+        }
+        a0[7] = (((v2 < v3) == (a0[12] > 41)) ? ((a0[15] ? 89 : v1) ? (i14 % 2) : (i14 && a0[12])) : ((49 * 11) / 6));
+    }
+    return (((a1[1][13] % 6) != (v0 / 2)) + ((64 && v1) != (v0 <= 51)));
+}
+int f18() {
+    int v0 = 91;
+    int v1 = 24;
+    int v2 = 88;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v3 = (((81 > 63) && (a1[0][2] ? a0[15] : a0[4])) <= ((v3 && v2) + (55 >= 85)));
+        v2 = (((v0 + 93) != (a1[0][1] >= v0)) / 5);
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            if ((a1[1][12] && v0) > 82) break;
+            a1[1][7] = (((a0[10] / 6) != (v1 - 65)) > ((v3 + i1) < (v3 ? i0 : 3)));
+            v3 = (((v2 == 45) <= (a1[3][13] > a0[13])) - ((a1[1][11] <= a1[2][13]) > (a1[3][6] / 2)));
+            v2 = (((v3 == i0) * (v0 <= i1)) || ((v1 % 8) > (i1 + v3)));
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((a1[1][10] ? i2 : a1[1][13]) > 81) break;
+        v2 = (((a1[1][0] >= v2) >= (a0[14] + v0)) ? ((96 >= v0) - (i2 > v3)) : ((v2 + a1[1][3]) + (83 % 1)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v2 = (((a0[12] < a0[3]) >= (i2 - i3)) <= ((v3 % 4) / 9));
+            a0[5] = (((93 % 7) || (i3 / 6)) || ((v3 == 40) / 2));
+            v3 = (((v1 > v3) == (a1[0][4] > 38)) <= ((a1[3][14] < i2) <= (v2 ? v3 : i3)));
+        }
+        v0 = (((v3 - 8) == (93 < a0[12])) - ((a1[3][3] || a0[0]) + (95 >= 90)));
+    }
+    if ((((v2 * v0) * (v0 || a1[2][6])) <= ((60 < v2) || (v2 || 30)))) {
+        a1[3][1] = (((v2 * v0) ? (v0 != 44) : (v2 > 97)) * ((a1[2][13] - 39) >= (v1 ? v0 : a1[3][6])));
+        v1 = (((v0 != 90) * (v3 != v3)) && ((16 != v1) % 2));
+        v1 = (((a1[1][7] && 63) || (a1[2][11] ? a1[3][10] : 24)) / 8);
+    } else {
+        a0[2] = (((v1 * a0[14]) < (v0 ? v0 : v0)) && ((v1 != v3) <= (v3 ? v0 : 86)));
+        v1 = (((a1[3][2] / 8) < (a0[14] <= 58)) != ((a1[1][0] * a0[15]) - (v0 ? v3 : v1)));
+        a1[3][10] = (((67 || 94) >= (2 * v3)) * ((v3 % 6) != (0 == 51)));
+    }
+    v1 = (((34 || v0) % 2) ? ((v1 ? 67 : v1) >= (a1[0][6] + v0)) : ((a0[1] >= 89) <= (v0 / 1)));
+    {
+        int i4 = 0;
+        do {
+            a0[14] = (((i4 || v0) <= (v2 % 1)) - ((v2 >= a0[15]) != (v1 + v3)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v1 = (((74 >= a1[1][4]) ? (a1[2][8] / 3) : (a0[9] % 5)) * ((i4 ? 75 : 13) < (a1[1][13] % 8)));
+                    v2 = (((79 ? 12 : i4) || (i5 ? v2 : a0[4])) > ((19 && i5) == (v1 + a1[3][9])));
+                    v3 = (((a0[13] * i4) % 9) != ((55 ? v2 : v0) + (v0 + 99)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v3 - a0[4]) * (a1[3][10] <= 60)) + ((a0[14] % 8) - (v3 < v2)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[2] = (((v0 && a1[3][15]) >= (84 + a0[15])) ? ((v0 == 57) % 2) : ((v3 ? v3 : v3) < (v3 && 8)));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                a1[2][4] = (((v1 ? a1[1][8] : v1) > (a1[0][14] < a0[6])) <= ((a0[13] && 54) && (a1[2][7] % 5)));
+                a0[12] = (((a1[3][6] >= v3) == (v1 / 3)) != ((v3 && i6) ? (i7 > i7) : (v0 && v2)));
+                a1[1][5] = (((v2 < 42) == (i6 < a0[11])) || ((v1 - a1[3][1]) <= (v2 >= a1[0][9])));
+            }
+            a0[11] = (((v1 != v2) <= (a1[1][5] * v3)) != ((71 || 61) <= (a0[8] > v1)));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 5) {
+            {
+                int i9 = 0;
+                do {
+                    if ((v2 != v0) > 61) break;
+                    v1 = (((i9 >= a0[11]) || (a0[1] % 6)) % 2);
+                    a1[2][14] = (((v2 >= v0) != (v1 < a1[1][11])) || ((a0[10] ? v0 : 58) / 3));
+                    v3 = (((a1[0][3] <= 73) / 6) - ((i9 % 5) ? (50 < i9) : (v1 - a0[11])));
+                    i9 = i9 + 1;
+                } while (i9 < 6);
+            }
+            v2 = (((a1[0][0] != 7) ? (v0 > a0[11]) : (v0 + 64)) == ((i8 <= v2) * (a1[1][14] ? v1 : i8)));
+            v2 = (((v0 / 7) != (v1 + 77)) != ((42 > 64) > (a0[6] < v1)));
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((a0[14] == v0) > 54) break;
+            a1[3][14] = (((a0[11] == v1) / 3) / 2);
+            {
+                int i11 = 0;
+                while (i11 < 4) {
+                    a1[1][4] = (((v3 || v0) ? (33 == v2) : (a0[14] ? 15 : 25)) / 4);
+                    v2 = (((13 * v2) || (i10 / 6)) >= ((87 != 57) + (55 * 96)));
+                    v0 = (((v2 != i11) - (i10 / 4)) ? ((a1[0][7] && i11) < (v3 >= 79)) : ((i11 == a0[10]) != (v3 >= 14)));
+                    i11 = i11 + 1;
+                }
+            }
+            v2 = (((v1 < 67) ? (a1[0][1] * 0) : (a1[2][4] >= a1[0][9])) * ((a0[11] <= v0) || (v1 >= a0[5])));
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    a1[3][10] = (((v3 <= v1) - (v3 <= v2)) == ((v1 - v1) <= (48 == a1[3][10])));
+    {
+        int i12 = 0;
+        while (i12 < 2) {
+            {
+                int i13 = 0;
+                do {
+                    if ((93 && a0[1]) > 95) break;
+                    v0 = (((v2 < 59) < (v3 * a0[12])) && ((17 <= i13) ? (a1[0][7] > i13) : (69 * v1)));
+                    v2 = (((1 != 8) > (a1[3][14] == 60)) ? ((4 || 34) && (v0 * i12)) : ((47 * v2) + (v2 >= i12)));
+                    v0 = (((i13 ? v1 : v3) ? (98 == v2) : (i13 % 6)) > ((i12 ? a0[8] : 77) * (26 < v1)));
+                    i13 = i13 + 1;
+                } while (i13 < 6);
+            }
+            v3 = (((v0 <= a1[1][9]) || (v0 ? 34 : 27)) && ((v2 % 6) + (30 <= v2)));
+            a1[1][1] = (((69 == v1) && (a1[2][1] + i12)) > ((a0[13] + a0[12]) / 6));
+            i12 = i12 + 1;
+        }
+    }
+    return (((v2 == a0[5]) * (40 - a1[0][13])) == ((v2 > v0) * (v1 * v2)));
+}
+int f19() {
+    int v0 = 40;
+    int v1 = 29;
+    int v2 = 22;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 < 60) > 99) break;
+            v2 = (((v2 <= v2) * (v3 > 45)) ? ((v2 <= v0) == (v0 - a1[2][11])) : ((v3 == 45) / 2));
+            a1[1][4] = (((14 < i0) == (a1[3][11] ? v2 : v1)) && ((v2 / 5) ? (a1[2][5] * a0[7]) : (v0 && v1)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v1 = (((a0[7] < a0[4]) < (52 <= i1)) && ((a1[1][14] - v1) != (v1 <= a1[3][8])));
+                    a1[3][2] = (((39 + a0[5]) / 1) > ((a1[3][11] && 78) && (v1 ? i0 : i1)));
+                    a0[9] = (((v2 + i0) + (v2 <= v0)) + ((49 ? 23 : a0[1]) ? (a1[1][5] / 4) : (a0[1] ? a0[2] : a0[12])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((a0[3] * 87) <= (v0 || 22)) >= ((37 - 51) < (v2 ? v3 : 41)))) {
+        v3 = (((v0 + a0[3]) == (v2 * v1)) % 1);
+        v3 = (((15 - v0) < (v0 * v3)) * ((v2 * 61) % 2));
+        v1 = (((v1 == v1) <= (a1[2][11] == 98)) % 6);
+    } else {
+        v2 = (((v1 < 48) * (73 <= 5)) - ((v0 * a0[8]) && (v1 ? v0 : v1)));
+        v2 = (((v2 && 96) % 6) == ((a1[1][5] == 80) < (a0[14] == 68)));
+        a1[3][12] = (((v3 == v1) % 7) * ((a1[1][3] * a1[2][10]) < (v0 || v0)));
+    }
+    if ((((v0 ? 21 : a0[10]) >= (66 >= 85)) || ((v1 ? a1[0][2] : a0[11]) % 6))) {
+        v1 = (((a0[2] ? v3 : a1[1][4]) + (69 * v0)) || ((31 >= 67) ? (v1 / 3) : (v3 != v2)));
+        v2 = (((v1 || 96) ? (v0 <= v3) : (15 <= a1[3][6])) + ((57 * v0) * (v1 ? a1[2][4] : v3)));
+        v0 = (((v2 + 38) != (32 || v2)) + ((v3 != v1) + (v3 + 81)));
+    } else {
+        v2 = (((a1[3][10] ? a0[8] : a1[1][7]) == (v1 ? v1 : 71)) != ((v1 != a0[14]) / 9));
+        v2 = (((v2 * 72) * (v2 % 9)) + ((a1[1][15] < a0[3]) % 5));
+        v2 = (((v2 != 18) > (2 < 73)) ? ((v3 == v0) == (v1 ? v1 : 56)) : ((29 % 5) && (v0 ? 31 : 70)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a0[13] / 3) == (i2 && i2)) != ((i2 <= v0) % 3));
+                    v2 = (((a1[3][13] - i2) - (v0 > a1[2][14])) != ((37 - a0[0]) < (a0[9] <= v2)));
+                    a1[2][3] = (((32 >= v3) != (a1[1][5] ? a0[13] : 48)) >= ((v0 == i3) ? (66 != 6) : (68 * 44)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a1[2][13] = (((v1 % 5) >= (v1 && a0[15])) > ((v3 % 8) + (v1 / 6)));
+            v3 = (((i2 ? a0[7] : a1[2][2]) < (v1 + i2)) - ((36 - a0[5]) - (v3 < 76)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((a0[3] ? 55 : a1[1][3]) >= (v1 > a0[10])) > ((v0 > v0) ? (v3 == a1[1][2]) : (v3 / 9)))) {
+        a0[9] = (((a1[1][0] > 4) * (v1 < a1[0][9])) ? ((v3 <= v3) % 8) : ((79 - a0[1]) / 5));
+        v2 = (((11 - v0) && (v1 ? a0[12] : a1[2][3])) != ((v3 * v3) * (v0 == v3)));
+        v0 = (((12 ? v3 : 76) ? (v0 ? v1 : 40) : (v3 && 76)) <= ((v0 - a1[2][10]) % 9));
+    } else {
+        v0 = (((a0[14] - a1[1][5]) > (v0 != 41)) >= ((43 / 3) != (a1[1][5] != 63)));
+        v3 = (((64 == v1) != (95 <= a1[2][4])) && ((v3 != 2) < (v2 / 2)));
+        v1 = (((v3 > v3) < (v3 <= v1)) <= ((v3 == 28) / 7));
+    }
+    if ((((a0[13] != v2) / 7) && ((49 % 1) > (38 <= a1[1][7])))) {
+        a1[1][12] = (((80 == a0[6]) * (v3 * v2)) <= ((v0 || 18) ? (v0 < a1[3][6]) : (v1 && v1)));
+        a1[1][2] = (((a1[0][12] < a0[10]) / 3) >= ((a0[11] < v0) % 2));
+        v0 = (((v1 || a1[1][14]) != (v2 % 9)) % 3);
+    } else {
+        v1 = (((v1 != 27) - (v2 + v0)) % 6);
+        a0[4] = (((v0 * a1[2][12]) + (10 + a1[3][4])) != ((3 && v2) || (a0[13] || v2)));
+        v1 = (((a0[13] == 95) + (v2 < v3)) >= ((a1[1][10] >= v0) || (v3 >= a1[1][0])));
+    }
+    v2 = (((35 + 80) ? (v1 * v1) : (v0 > v1)) <= ((a1[2][4] + v2) ? (v2 || v2) : (a0[4] || v2)));
+    v2 = (((v2 / 1) - (23 + a1[1][15])) || ((a1[1][4] + v3) - (32 != a0[15])));
+    if ((((v1 == a0[13]) == (v1 == a1[3][12])) - ((a1[3][10] + v3) + (a1[3][14] + v1)))) {
+        v0 = (((v1 != v2) == (82 ? 85 : 46)) + ((v1 >= 29) == (21 / 3)));
+        v0 = (((v0 / 3) - (v1 % 9)) >= ((v0 || v0) && (v1 + 10)));
+        v3 = (((v1 < 24) <= (39 != 62)) ? ((52 >= v2) < (v3 + v3)) : ((v1 && v1) > (a1[2][13] ? a0[0] : v1)));
+    } else {
+        v2 = (((92 - a0[9]) != (a0[7] ? v1 : 55)) - ((a1[2][3] == 11) == (32 ? a0[14] : v2)));
+        v0 = (((30 || v1) + (a1[2][15] < v2)) <= ((v3 == v0) > (v1 >= 70)));
+        a0[8] = (((13 ? a1[1][7] : 98) < (a0[6] || v3)) / 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v1 = (((49 - v0) ? (i4 / 3) : (v3 - a1[3][9])) <= ((61 ? a0[10] : v2) ? (i4 && 85) : (a0[3] >= v2)));
+            v0 = (((v3 != a1[1][0]) == (v2 - 42)) ? ((a0[4] == a1[2][7]) ? (v1 - i4) : (a0[15] ? v0 : v0)) : ((a1[0][12] + v1) ? (v1 > 83) : (v1 != v2)));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v3 = (((v1 < a1[2][11]) % 8) > ((27 % 2) == (i4 ? i5 : i5)));
+                    v2 = (((v1 > a1[2][1]) ? (a0[9] < v0) : (i5 + 25)) * ((22 + a0[5]) ? (41 ? a0[4] : a0[9]) : (i5 + v2)));
+                    a0[10] = (((i5 ? i5 : v3) && (91 / 7)) && ((a0[7] < v3) % 5));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((v0 ? v1 : v3) ? (v0 ? v0 : v2) : (79 == v3)) < ((96 * a1[2][7]) > (a1[3][2] != v0)));
+}
+int f20() {
+    int v0 = 83;
+    int v1 = 27;
+    int v2 = 66;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((v3 > 21) == (v1 && v3)) / 4);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a1[1][9] = (((42 < a1[1][4]) ? (5 ? 53 : i1) : (99 || 48)) % 6);
+                    v3 = (((v1 ? i1 : a0[5]) >= (61 / 4)) >= ((84 ? 1 : a0[13]) < (95 + v3)));
+                    v3 = (((79 / 8) * (v0 % 5)) != ((i1 - i0) && (a1[0][14] ? i0 : v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[15] = (((34 >= 86) / 4) || ((v0 && a1[3][14]) ? (a1[0][2] ? a1[0][2] : 17) : (v0 / 2)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[12] = (((59 * v3) || (a0[5] == a1[2][6])) - ((i2 && i2) && (v0 || v0)));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v3 = (((a0[10] < v0) ? (v3 <= 16) : (a1[3][10] + i3)) % 2);
+                v3 = (((a0[13] != 83) * (v1 % 8)) - ((v0 >= v2) ? (v0 * 88) : (v2 >= a0[0])));
+                a1[3][2] = (((i2 <= v3) ? (58 != a1[3][0]) : (i2 == i3)) >= ((i2 * v1) ? (i2 != v0) : (10 ? 43 : 29)));
+                i3 = i3 + 1;
+            }
+        }
+        a1[0][9] = (((v1 + v0) ? (8 ? a1[0][12] : v3) : (a0[14] && a0[8])) ? ((v0 > i2) ? (v0 < v1) : (a0[10] * v3)) : ((v3 >= v3) / 4));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v2 < a0[0]) > 95) break;
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((i4 ? a0[7] : 71) == (v0 == v0)) ? ((v1 * v0) || (v0 > a0[13])) : ((a0[0] ? v2 : v0) > (1 % 7)));
+                    v3 = (((95 != v1) % 8) >= ((v0 ? 24 : v1) && (v2 ? a1[3][14] : 14)));
+                    a1[0][7] = (((a1[1][9] && i5) % 8) > ((i5 / 7) >= (v0 + a0[7])));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v3 = (((74 <= v2) != (a1[2][10] == v2)) <= ((8 && a0[13]) == (a1[1][10] ? v0 : 0)));
+            v3 = (((v3 > v1) >= (v3 ? i4 : v0)) || ((v2 ? a1[3][1] : v3) + (v2 <= v2)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    if ((((52 % 8) - (v2 - a0[10])) / 7)) {
+        a0[10] = (((v1 != 87) - (27 >= v1)) == ((v1 * a0[2]) > (54 / 6)));
+        a1[3][12] = (((v2 && v2) - (0 || v0)) * ((v0 < v1) < (73 != v2)));
+        v1 = (((v3 / 2) >= (v3 / 7)) >= ((v3 + a0[1]) - (v2 / 2)));
+    } else {
+        v1 = (((66 || v3) == (v1 == 4)) != ((v3 && v3) % 7));
+        v0 = (((a0[14] + a1[1][4]) ? (v2 + 17) : (v2 <= 33)) || ((v3 && 0) <= (v1 * 97)));
+        v3 = (((13 != v1) > (v3 != v1)) != ((v1 == v3) + (a1[0][15] ? v0 : a0[1])));
+    }
+    v3 = (((v0 || v0) || (a1[2][6] / 1)) % 3);
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        v1 = (((v2 % 1) - (i6 <= v2)) / 1);
+        {
+            int i7 = 0;
+            do {
+                a1[2][3] = (((v1 ? a1[3][9] : a0[9]) > (i6 > 34)) ? ((98 != v0) <= (a0[11] <= v3)) : ((a1[2][2] <= v1) || (a0[12] / 2)));
+                a0[12] = (((v1 == i7) > (5 == v0)) ? ((v0 * i6) ? (v0 == 31) : (a0[1] ? a1[2][4] : a1[2][14])) : ((a0[11] ? 27 : i6) > (a1[1][14] == v0)));
+                a1[0][8] = (((v1 >= a1[0][8]) != (a1[1][14] + v0)) > ((a0[10] % 8) != (v1 && a0[2])));
+                i7 = i7 + 1;
+            } while (i7 < 3);
+        }
+        a1[2][13] = (((v3 == v2) % 2) ? ((a0[6] && v1) / 6) : ((a0[4] + v3) == (a1[1][0] <= 17)));
+    }
+    if ((((a0[13] != v1) <= (v1 || v1)) >= ((v2 - a0[7]) > (v1 ? a1[2][11] : v3)))) {
+        v2 = (((v0 >= v0) - (12 ? a1[2][10] : v1)) + ((v0 != v1) + (a1[3][3] < a0[4])));
+        a1[0][8] = (((a1[0][2] != 62) >= (49 && v2)) && ((v2 == v2) / 6));
+        v1 = (((v3 == v2) * (v1 > a0[6])) % 4);
+    } else {
+        v2 = (((v2 % 8) == (9 % 7)) != ((13 || v3) && (v3 ? 90 : a1[3][12])));
+        v2 = (((43 >= v3) == (v1 - v0)) - ((5 ? v2 : a1[0][14]) || (v1 / 5)));
+        a1[1][13] = (((a1[1][10] / 1) >= (v1 - a0[3])) > ((v1 || v2) ? (v2 <= v1) : (a1[3][10] ? 65 : 7)));
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        v2 = (((v0 || 52) || (a0[13] <= a0[8])) * ((i8 ? v2 : v2) / 5));
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                a1[3][7] = (((v0 % 7) % 8) ? ((62 > v1) && (v2 + v2)) : ((44 + v2) < (a1[3][15] ? v0 : 25)));
+                v3 = (((37 ? v1 : i9) + (63 / 9)) || ((i9 + 30) != (96 - a0[15])));
+                a0[14] = (((55 >= i8) >= (v1 > v2)) == ((v2 || 36) <= (86 == a1[1][10])));
+                i9 = i9 + 1;
+            }
+        }
+        a0[6] = (((15 >= 82) % 6) + ((v1 != v3) == (v0 >= a0[5])));
+    }
+    v1 = (((a0[11] / 9) < (v2 - 2)) * ((v2 && v3) - (85 - 57)));
+    {
+        int i10 = 0;
+        while (i10 < 2) {
+            v3 = (((31 == i10) && (v1 && 41)) == ((v1 > 29) > (98 ? a0[7] : v0)));
+            a0[8] = (((i10 > a0[4]) < (a0[6] || v1)) >= ((52 - i10) ? (v1 >= a1[1][8]) : (a1[2][4] * i10)));
+            for (int i11 = 0; i11 < 5; i11 = i11 + 1) {
+                if ((a1[0][12] == a1[3][6]) > 80) break;
+                v2 = (((a1[2][9] ? 78 : a1[3][15]) <= (a0[7] - a0[0])) + ((a0[9] ? 51 : a0[13]) && (a0[9] >= v1)));
+                v0 = (((78 * 27) <= (12 / 8)) == ((v2 && a0[7]) % 5));
+                v1 = (((v2 % 3) * (v0 + a0[8])) == ((i10 >= v2) + (34 > 60)));
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((97 * a1[0][6]) > (65 < v0)) && ((v3 * v2) * (a0[8] - v2)));
+}
+int f21() {
+    int v0 = 88;
+    int v1 = 77;
+    int v2 = 90;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 ? v2 : v3) % 4) && ((a1[3][5] != v1) ? (a0[0] <= v2) : (77 != v0)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((9 ? v3 : v2) == (90 ? a0[2] : a1[2][15])) - ((a1[1][1] - a1[1][1]) * (a1[1][12] - v1)));
+                v0 = (((a0[8] - v0) == (a0[8] < i1)) < ((a0[1] % 7) ? (v3 <= v3) : (26 > v1)));
+                a1[2][9] = (((a0[3] ? 99 : 66) / 9) % 7);
+            }
+            a0[6] = (((37 || v2) < (a1[2][8] % 1)) ? ((v1 / 9) == (v3 <= 44)) : ((v1 * v3) && (49 ? v2 : a1[3][0])));
+            a1[1][3] = (((a0[12] > v0) || (v1 && 50)) ? ((v3 * 68) - (a1[0][4] / 9)) : ((v1 == a1[2][0]) && (40 + i0)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((v3 / 4) * (a1[2][3] <= 97)) && ((v2 && a0[12]) < (v2 <= 66)))) {
+        v0 = (((37 % 8) + (37 < v2)) == ((31 >= 5) >= (v1 == 81)));
+        v2 = (((v2 % 5) + (v3 && 83)) < ((v3 && v1) % 7));
+        v3 = (((v3 * v0) % 8) * ((0 <= a1[2][9]) == (a1[1][0] == v2)));
+    } else {
+        v3 = (((13 * v1) == (v0 % 1)) - ((v3 * v1) && (a1[2][6] || v1)));
+        v0 = (((v1 > v0) > (60 ? 63 : a0[4])) ? ((v1 + a1[3][3]) || (v2 % 8)) : ((v0 + a0[7]) ? (v0 > v2) : (29 + v3)));
+        v0 = (((86 - v3) && (a0[2] * a0[5])) != ((15 || v1) || (a1[2][11] > v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v2 <= v2) > 95) break;
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    if ((i2 + a1[2][4]) > 82) break;
+                    v1 = (((i3 || 37) < (i3 <= v1)) < ((57 * 78) / 9));
+                    a0[1] = (((v3 + v0) / 4) * ((a0[15] || a1[3][7]) ? (v0 + i2) : (v3 ? 14 : i3)));
+                    v3 = (((a1[2][4] <= 74) > (a1[1][2] ? v0 : v3)) ? ((54 == a0[8]) + (i2 ? v1 : i3)) : ((a1[1][14] / 7) && (a0[4] + i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((i2 <= a1[0][9]) * (a1[0][5] && 18)) == ((v2 - v1) % 6));
+            a1[3][9] = (((65 ? a1[3][1] : a0[4]) > (i2 >= a1[0][12])) == ((v2 / 9) >= (v0 <= v1)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v0 = (((v3 - 27) + (a0[12] > a1[1][1])) && ((60 - v3) <= (v2 || a0[14])));
+    v0 = (((46 || 71) >= (v2 != v3)) >= ((a1[2][5] % 8) ? (v0 + v3) : (77 < 51)));
+    v2 = (((79 > v2) * (v1 + v2)) > ((v0 > v3) == (a0[14] + 67)));
+    v2 = (((a1[2][14] <= 44) > (v1 > v3)) && ((22 ? v1 : v3) == (a0[11] == a1[1][7])));
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((11 > a1[2][2]) * (96 ? v2 : a0[7])) != ((78 || 18) % 8));
+                    a1[2][6] = (((24 >= 72) || (i5 - i5)) - ((v0 < v3) && (a1[2][14] && a1[3][7])));
+                    v0 = (((a1[3][5] == v0) && (a1[0][12] ? v1 : 82)) && ((a0[2] * a0[12]) != (i4 % 8)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][2] = (((68 + 77) - (v0 && v0)) || ((56 ? v1 : 90) * (v3 < v2)));
+            v2 = (((30 + i4) / 8) >= ((a0[6] / 2) ? (96 ? a0[2] : v0) : (29 < v1)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            v2 = (((v3 == i6) - (v2 > 85)) % 7);
+            v0 = (((v1 * v2) / 9) == ((v2 - i6) ? (a0[9] ? a1[2][1] : a0[12]) : (i6 + v0)));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                if ((55 / 8) > 91) break;
+                v2 = (((v1 - i6) / 5) / 2);
+                a0[8] = (((v3 % 7) > (i7 < 56)) && ((v3 * a0[3]) > (i6 == 41)));
+                v0 = (((a1[1][8] != v0) > (v1 == v2)) <= ((v0 || i7) ? (20 != v0) : (i7 / 8)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v0 > v1) != (a0[15] >= a1[3][14])) % 6);
+}
+int f22() {
+    int v0 = 11;
+    int v1 = 84;
+    int v2 = 84;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    a0[6] = (((93 >= 64) ? (13 || v0) : (v3 ? v2 : v0)) - ((v2 >= v1) >= (a0[3] / 1)));
+    v0 = (((a0[11] && v2) && (v3 + 83)) >= ((a1[1][1] != a0[0]) / 6));
+    if ((((v1 - v1) && (v1 < a0[3])) ? ((68 || a0[5]) ? (60 + 10) : (v0 <= 50)) : ((v1 * a1[3][13]) == (35 == v0)))) {
+        a0[7] = (((v1 != a1[3][15]) / 3) && ((v2 + v1) ? (46 / 5) : (a0[9] <= a1[0][12])));
+        v3 = (((a1[2][9] || 16) * (a1[0][9] > 2)) >= ((v0 * v1) == (89 * v3)));
+        v1 = (((v2 % 2) + (v0 - 14)) * ((v3 ? a0[3] : v3) && (v1 % 1)));
+    } else {
+        a1[3][12] = (((a1[0][1] + v3) / 7) + ((73 > 32) >= (v2 < 18)));
+        a0[11] = (((v3 == a0[15]) && (74 > v0)) > ((a0[10] && a0[10]) == (v2 < a0[7])));
+        a0[12] = (((v0 < a0[7]) / 9) || ((v3 - v2) % 5));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a1[3][5] = (((v3 * v2) ? (99 == v3) : (v3 ? 28 : 12)) <= ((i0 / 9) / 1));
+                v2 = (((88 != a0[7]) && (v2 != i1)) <= ((i1 > 72) % 8));
+                v0 = (((v0 % 5) != (v1 != i0)) ? ((i0 ? v0 : a0[1]) ? (a1[2][11] - 55) : (a0[5] >= v0)) : ((77 ? 46 : v1) / 5));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        v2 = (((92 < v1) + (v0 ? v1 : v0)) >= ((i0 > a1[2][0]) && (i0 < a0[15])));
+        v0 = (((i0 / 3) <= (77 > v0)) <= ((v3 % 4) % 2));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((85 < a1[1][4]) >= (83 < v0)) == ((v2 == v3) - (i2 % 6)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a1[2][7] = (((4 == 43) && (19 % 3)) ? ((a1[3][12] || 97) >= (99 && v2)) : ((v1 <= v1) / 6));
+            a0[14] = (((a0[5] % 9) || (v3 != i2)) || ((2 ? a0[6] : a0[10]) * (60 > a0[4])));
+            a1[1][5] = (((a1[0][14] * v3) > (i3 - 83)) * ((a1[0][7] == 35) ? (v2 == i2) : (v2 < v0)));
+        }
+        v0 = (((v1 || v2) % 5) >= ((v0 <= i2) / 7));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                a1[0][8] = (((i5 || 72) > (64 && v0)) < ((a1[3][5] >= 45) || (a1[0][4] != v2)));
+                v0 = (((i4 ? a0[2] : i4) ? (v0 / 6) : (i5 || v0)) && ((24 || i4) % 2));
+                v0 = (((a0[10] + 37) * (a1[3][12] < v2)) <= ((15 + v2) + (v3 >= a1[3][5])));
+            }
+            a1[0][4] = (((v1 != a0[7]) && (a0[1] + i4)) - ((29 >= v1) - (a0[13] <= a1[0][14])));
+            v1 = (((31 != 18) < (a0[10] <= i4)) != ((11 <= a0[4]) <= (27 ? a0[5] : 61)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            v1 = (((v0 * v2) == (a1[0][1] && 74)) ? ((v3 ? v2 : v1) || (v1 <= v2)) : ((83 * a1[3][8]) % 9));
+            v0 = (((i7 > v3) ? (a1[2][2] % 6) : (v0 && a0[9])) - ((v2 || 87) && (a0[14] > a1[0][4])));
+            v3 = (((v2 % 6) ? (5 % 6) : (v3 ? i7 : 97)) + ((i7 - 31) && (a0[2] <= a1[3][6])));
+        }
+        a1[1][15] = (((i6 * v0) + (v2 <= v2)) && ((a1[2][8] < v0) - (a1[2][13] != 85)));
+        a0[13] = (((v0 >= v1) % 5) < ((10 <= v0) * (41 % 4)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            {
+                int i9 = 0;
+                do {
+                    v0 = (((31 ? i8 : a0[2]) * (45 <= v2)) + ((v3 >= 92) >= (v3 % 2)));
+                    a0[5] = (((i9 + v1) <= (v0 * a1[3][10])) - ((i9 - 9) / 7));
+                    v1 = (((29 && v1) * (63 * 81)) <= ((2 < 64) % 4));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            v3 = (((v1 == v3) ? (a0[13] != i8) : (i8 % 1)) * ((v3 / 4) ? (a0[13] && a1[2][14]) : (v1 || i8)));
+            a0[10] = (((v2 > 76) <= (a0[9] % 9)) == ((v3 + 23) / 4));
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 4; i10 = i10 + 1) {
+        a0[0] = (((65 - a0[6]) ? (v0 && v2) : (69 || v0)) != ((13 - v1) * (a1[3][14] != 14)));
+        for (int i11 = 0; i11 < 6; i11 = i11 + 1) {
+            v0 = (((i11 || a1[0][2]) < (a0[11] && i11)) % 1);
+            a0[15] = (((v2 ? v0 : v3) == (58 % 6)) * ((15 == i11) < (v1 / 9)));
+            v3 = (((i10 + 72) != (i11 % 7)) / 3);
+        }
+        a1[0][13] = (((73 + i10) >= (0 - v1)) || ((16 <= 94) >= (a0[6] / 9)));
+    }
+    {
+        int i12 = 0;
+        do {
+            a0[3] = (((v0 > a0[4]) ? (10 == 28) : (13 ? a1[3][11] : v0)) || ((a0[1] && a1[2][9]) >= (a0[0] ? a0[9] : a1[1][10])));
+            {
+                int i13 = 0;
+                while (i13 < 5) {
+                    v3 = (((22 + i13) == (a1[3][4] - v1)) - ((22 >= a0[12]) < (v2 ? 17 : 92)));
+                    v2 = (((v3 && v1) - (v1 ? v2 : i12)) % 3);
+                    a0[9] = (((v1 != 68) && (v1 - 66)) && ((98 + a1[3][15]) - (v3 == a0[1])));
+                    i13 = i13 + 1;
+                }
+            }
+            v3 = (((v0 > 93) && (2 && v1)) <= ((a0[13] < v0) / 4));
+            i12 = i12 + 1;
+        } while (i12 < 4);
+    }
+    return (((a1[1][5] != v0) != (v1 + v3)) > ((a0[11] * v3) / 4));
+}
+int f23() {
+    int v0 = 92;
+    int v1 = 39;
+    int v2 = 2;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v0 != i0) > 77) break;
+            v2 = (((a0[2] / 7) <= (v0 - v3)) < ((v1 % 7) < (a1[1][13] % 7)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a1[1][12] = (((v2 != a1[3][0]) > (v1 > 13)) + ((v0 * 84) <= (6 * a0[9])));
+                    a0[7] = (((68 - a0[11]) % 8) < ((v2 * a1[0][4]) * (95 <= v2)));
+                    a1[0][13] = (((v2 && a0[7]) - (v1 % 9)) > ((v1 >= a0[3]) != (a1[2][15] + v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[15] = (((v0 / 7) > (a1[3][8] / 7)) || ((a0[12] - v1) || (81 % 4)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    a1[2][3] = (((v0 / 6) != (a0[8] <= a1[2][12])) - ((v3 - v3) > (a0[9] <= a1[1][9])));
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v1 = (((v1 != 48) - (v3 - 33)) % 9);
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                if ((63 / 4) > 85) break;
+                v1 = (((a0[10] / 2) >= (15 / 7)) >= ((98 <= i2) * (33 <= 37)));
+                v1 = (((v1 ? v1 : 88) || (a0[0] <= i2)) < ((37 + v2) != (25 <= a1[0][13])));
+                a0[13] = (((v3 || a1[2][12]) - (v0 ? a0[6] : a1[1][8])) != ((49 == a1[0][0]) ? (v0 == a1[3][11]) : (i3 != 90)));
+            }
+            v0 = (((v0 || v0) * (i2 == 59)) - ((a1[3][6] > v0) * (v2 - i2)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        a0[7] = (((15 - v0) && (87 ? v2 : v3)) + ((i4 && v0) || (v3 <= a1[3][3])));
+        v3 = (((37 % 8) && (26 >= v3)) <= ((7 && v0) > (v2 && v3)));
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v3 = (((a0[10] <= 85) - (16 ? 79 : v3)) + ((a0[8] == a1[1][10]) - (v3 != i4)));
+            a1[3][12] = (((v2 + 31) == (v0 - i4)) || ((a0[1] - v2) <= (i5 + 41)));
+            a1[2][4] = (((a1[3][12] * v2) == (a0[4] != 65)) != ((a1[1][12] ? v1 : a1[3][1]) != (a0[4] - v2)));
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            v2 = (((v0 / 7) - (95 + v0)) / 8);
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v2 = (((v0 != i7) && (i6 - i7)) + ((a0[9] * i6) && (i7 * i6)));
+                v3 = (((a1[0][10] > i7) || (56 != v0)) || ((i7 >= 99) / 7));
+                v1 = (((i7 ? v2 : v3) ? (v2 ? i7 : i6) : (v2 > i6)) == ((51 && 59) / 2));
+            }
+            v1 = (((v2 || 72) ? (a0[10] || a0[7]) : (74 < v0)) == ((v3 >= i6) <= (i6 ? 98 : 91)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((70 ? v2 : v0) || (v1 != v3)) ? ((v1 / 3) * (v0 + v2)) : ((a0[9] && a0[13]) < (v3 >= 4)))) {
+        a1[3][6] = (((v1 % 7) != (v0 || 51)) % 1);
+        a1[1][15] = (((49 ? a1[2][2] : a1[2][8]) * (v1 + 49)) > ((71 < v2) != (8 - v0)));
+        v2 = (((v1 ? v1 : 41) >= (v2 || v0)) < ((32 ? a0[1] : a0[5]) >= (65 == a1[0][12])));
+    } else {
+        v2 = (((56 ? v2 : a0[2]) && (v1 != v3)) - ((49 ? a1[0][6] : v3) > (94 ? a1[0][14] : v0)));
+        v0 = (((v2 ? a0[13] : v1) && (a1[3][5] == 16)) + ((v1 <= a1[3][9]) ? (v2 < 71) : (v0 + v1)));
+        a0[3] = (((2 ? v1 : a0[4]) % 1) != ((v1 || v3) != (a0[14] - v0)));
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    v2 = (((v3 <= 70) && (v1 == a1[2][14])) > ((96 != a0[9]) + (32 == i9)));
+                    a1[0][13] = (((a0[15] - 43) >= (62 > a1[3][7])) % 1);
+                    v3 = (((90 + 11) != (v0 % 1)) >= ((a0[5] >= a1[1][2]) >= (v0 - 62)));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            v0 = (((v0 / 3) == (23 < a0[2])) + ((i8 + 86) || (a0[6] >= v3)));
+            a0[7] = (((6 <= v0) ? (i8 == v0) : (a0[11] <= a0[6])) < ((v1 - i8) ? (v2 ? 78 : 6) : (a0[11] % 7)));
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((30 / 6) > 87) break;
+            {
+                int i11 = 0;
+                while (i11 < 5) {
+                    if ((v1 + v0) > 87) break;
+                    a1[2][14] = (((v2 >= a1[0][9]) <= (a1[1][2] / 7)) != ((a1[0][13] && a1[0][3]) ? (75 || 72) : (v2 ? v1 : i10)));
+                    v2 = (((a1[2][11] >= a0[2]) || (a1[3][5] / 4)) || ((i10 + a0[11]) <= (i10 - 77)));
+                    v3 = (((i11 >= i11) != (87 == i10)) ? ((v1 - 19) / 1) : ((59 == i11) ? (i11 ? 40 : 7) : (a0[10] % 7)));
+                    i11 = i11 + 1;
+                }
+            }
+            a1[0][7] = (((v0 <= v3) < (v1 > 72)) ? ((a0[6] + v1) % 3) : ((v2 ? a1[3][13] : 2) * (a0[1] < i10)));
+            a0[5] = (((16 ? 37 : 5) || (i10 >= 77)) % 1);
+            i10 = i10 + 1;
+        } while (i10 < 4);
+    }
+    a1[1][9] = (((v1 && a1[1][0]) == (a1[2][13] * a0[11])) * ((a1[3][2] != v0) % 6));
+    v2 = (((v0 == v3) ? (v0 && 5) : (v2 <= v2)) != ((v1 == v2) - (v0 != v2)));
+    return (((v3 * v2) < (a1[1][11] || v1)) >= ((v3 > v0) + (v1 + v0)));
+}
+int f24() {
+    int v0 = 78;
+    int v1 = 37;
+    int v2 = 48;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 ? 11 : v3) < (a1[0][0] < v3)) <= ((77 > v1) / 4))) {
+        v0 = (((39 - 44) * (27 ? v2 : 49)) * ((v2 < v3) ? (v2 != 14) : (v0 >= 23)));
+        a1[2][0] = (((v2 + 45) || (93 + 61)) == ((v1 * 19) <= (v1 >= v3)));
+        v2 = (((v0 || a0[12]) ? (a0[15] / 5) : (v2 + v1)) * ((55 + a0[14]) && (v1 ? v0 : v2)));
+    } else {
+        v1 = (((v3 ? v3 : v3) != (15 >= 51)) || ((5 - v0) - (a0[7] && a1[2][2])));
+        v1 = (((a0[8] - 88) / 3) ? ((v0 < v2) < (v0 * v0)) : ((17 / 1) > (89 + v1)));
+        v0 = (((7 <= v0) * (68 < v1)) * ((v1 || a0[8]) != (v2 + v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((a1[0][7] ? 3 : a0[5]) > 97) break;
+            v3 = (((v0 > 93) < (30 || 16)) == ((i0 ? 6 : 30) % 7));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((94 + i0) < (v3 - v0)) != ((a0[12] <= 90) / 7));
+                    v1 = (((9 != v2) + (i1 <= v1)) >= ((v0 ? a1[0][1] : v0) == (v2 >= v2)));
+                    v3 = (((a1[2][2] * i0) % 1) + ((a1[3][10] && v3) % 6));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v1 = (((v3 != a1[1][12]) ? (73 != v0) : (a1[2][15] * 14)) + ((v2 && v0) ? (a1[0][11] == 95) : (v3 || v1)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((i2 <= 24) > 77) break;
+        {
+            int i3 = 0;
+            do {
+                a1[2][10] = (((i2 ? i3 : a0[5]) <= (a1[2][12] || v1)) != ((a0[9] * a1[3][7]) < (v1 / 4)));
+                a0[9] = (((v0 * a1[1][8]) * (v0 <= i2)) == ((i2 / 3) && (a0[15] == v2)));
+                v2 = (((v0 - v0) || (v0 / 4)) / 6);
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        v2 = (((v2 + 1) > (a0[9] > a1[1][14])) || ((90 >= v3) <= (a0[7] % 2)));
+        v1 = (((a0[10] < a0[6]) > (9 || v0)) + ((a0[6] < v0) ? (a1[2][3] && i2) : (a0[2] - 82)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v3 > v1) > 63) break;
+            v2 = (((0 * a1[3][11]) && (a1[3][12] == a1[3][5])) - ((70 ? a1[0][7] : v1) ? (33 > v3) : (58 && v2)));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((a0[3] * i4) <= (a0[1] > v2)) ? ((35 || a0[15]) % 4) : ((a1[0][13] / 3) && (52 % 3)));
+                    v2 = (((v2 / 9) * (69 * a1[0][9])) + ((20 * a1[0][14]) <= (v1 == v3)));
+                    v3 = (((34 ? a0[12] : v2) == (56 / 3)) - ((v0 || a1[0][14]) * (15 <= i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v0 = (((v1 > a0[11]) >= (i4 / 2)) == ((a0[11] && a1[3][4]) * (v0 || a0[1])));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        if ((a0[3] + 36) > 91) break;
+        v0 = (((62 ? a0[8] : i6) || (v3 + v3)) || ((97 != a0[0]) < (24 < v1)));
+        {
+            int i7 = 0;
+            do {
+                if ((i6 && v0) > 77) break;
+                a1[0][4] = (((a0[8] == i7) % 5) || ((a0[6] <= v0) <= (a0[5] / 3)));
+                v1 = (((41 > a0[12]) || (v2 || v1)) < ((57 >= i7) && (a1[2][10] + i6)));
+                v1 = (((v2 * a1[3][3]) < (a1[1][12] == a0[11])) ? ((v0 * a0[8]) ? (v2 || i6) : (29 ? 58 : a0[6])) : ((i7 * i7) < (a1[1][12] != a1[0][8])));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+        v2 = (((a0[10] / 1) > (a1[0][4] >= v0)) == ((v3 ? v3 : v0) ? (6 ? v3 : v1) : (36 ? 59 : v0)));
+    }
+    if ((((v2 ? 92 : v0) > (v3 <= v0)) * ((v2 <= v3) || (a0[11] < a1[0][13])))) {
+        a0[2] = (((v2 > a0[15]) >= (v0 % 4)) * ((v0 || v3) ? (v1 + a1[0][12]) : (32 || 44)));
+        v3 = (((v1 ? v2 : v2) + (v2 < v2)) >= ((a1[2][10] * v1) ? (66 > a0[3]) : (v2 || 60)));
+        v2 = (((v2 % 6) * (v1 < v1)) ? ((v3 || a0[5]) == (a1[1][7] < 69)) : ((70 < v3) || (a0[4] || 83)));
+    } else {
+        v1 = (((v3 ? a0[1] : a1[1][15]) + (v1 % 7)) || ((v3 && 48) < (v3 >= a1[1][7])));
+        v2 = (((v3 / 3) <= (a0[9] >= v0)) > ((v3 >= v3) > (12 > v2)));
+        a1[2][13] = (((20 ? v2 : 56) < (60 < v2)) || ((v1 && 1) % 2));
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                if ((46 ? a1[0][2] : v2) > 90) break;
+                v2 = (((v1 && i8) ? (a0[7] < v1) : (i9 || i8)) ? ((a1[2][12] ? v2 : a1[0][11]) % 8) : ((i8 && a0[9]) != (v1 + a0[10])));
+                v1 = (((a1[2][5] / 8) && (i9 > 60)) / 9);
+                v3 = (((63 % 8) == (i9 && v1)) + ((v0 || a0[14]) ? (a1[0][11] < i8) : (a1[3][4] >= a0[12])));
+                i9 = i9 + 1;
+            } while (i9 < 2);
+        }
+        a0[15] = (((v3 > v1) && (a0[7] + a0[6])) > ((i8 == a0[14]) < (a0[0] && a1[1][12])));
+        a1[3][12] = (((a1[2][13] <= v1) + (1 <= v0)) <= ((v2 + i8) % 3));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            v2 = (((a0[3] <= i10) + (a1[3][0] == a0[6])) % 5);
+            for (int i11 = 0; i11 < 3; i11 = i11 + 1) {
+                v0 = (((33 - 31) % 9) <= ((i10 > a1[1][15]) / 7));
+                v0 = (((v2 < a0[6]) ? (v2 % 7) : (i10 != a1[2][10])) + ((i10 ? a0[15] : 71) ? (v1 == v1) : (v0 ? v0 : i10)));
+                v1 = (((i11 <= v3) / 8) != ((v0 < 57) * (v2 != a1[1][4])));
+            }
+            a0[8] = (((v2 < v3) ? (v2 > v1) : (v1 - a1[1][0])) - ((i10 <= v0) % 5));
+            i10 = i10 + 1;
+        }
+    }
+    {
+        int i12 = 0;
+        do {
+            if ((v3 - i12) > 55) break;
+            {
+                int i13 = 0;
+                do {
+                    v2 = (((i13 % 1) ? (a1[0][5] <= a1[1][11]) : (i12 ? 80 : a0[3])) < ((v1 < 12) < (30 != 15)));
+                    a0[12] = (((i13 / 9) ? (a0[8] || v0) : (i12 || v3)) / 1);
+                    v2 = (((a0[2] / 5) != (i12 * 72)) >= ((i13 ? 7 : a1[3][10]) || (v0 + 90)));
+                    i13 = i13 + 1;
+                } while (i13 < 8);
+            }
+            v1 = (((a0[11] && v0) > (v0 < a0[5])) - ((30 || a0[3]) ? (i12 * v0) : (i12 ? i12 : a1[2][15])));
+            v0 = (((v2 && v3) > (a0[15] * 40)) >= ((72 && 29) / 8));
+            i12 = i12 + 1;
+        } while (i12 < 2);
+    }
+    {
+        int i14 = 0;
+        do {
+            if ((25 * 43) > 75) break;
+            v1 = (((v1 ? a0[6] : v2) * (v3 * a1[0][0])) ? ((v3 ? v0 : 75) / 6) : ((a1[3][6] != 45) == (77 ? 85 : a0[12])));
+            v2 = (((v2 <= a1[1][14]) * (a1[0][10] > 17)) || ((v2 - v3) / 2));
+            {
+                int i15 = 0;
+                while (i15 < 4) {
+                    a1[3][10] = (((45 ? 43 : a0[11]) ? (i14 && 63) : (a1[0][10] * 17)) > ((17 * 71) % 1));
+                    v0 = (((v3 == i15) != (i15 >= a1[3][1])) ? ((a1[2][4] == 7) % 1) : ((i15 && v2) >= (a0[5] < 11)));
+                    a1[2][8] = (((v1 <= 66) >= (v0 == v0)) ? ((v3 - v1) >= (i15 ? a1[1][1] : 84)) : ((67 != v1) / 9));
+                    i15 = i15 + 1;
+                }
+            }
+            i14 = i14 + 1;
+        } while (i14 < 5);
+    }
+    return (((a1[2][0] && a1[1][12]) && (a1[3][11] + a0[15])) % 1);
+}
+int f25() {
+    int v0 = 7;
+    int v1 = 5;
+    int v2 = 88;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v1 = (((77 % 6) ? (a1[0][6] == v1) : (96 % 8)) ? ((i0 || a0[8]) ? (a1[0][13] && v2) : (a0[9] % 9)) : ((v1 > a0[0]) >= (65 || i0)));
+            v1 = (((a0[8] >= i0) || (34 == v2)) ? ((v2 > v3) - (v2 && a0[0])) : ((a1[0][1] ? 61 : 45) + (64 * i0)));
+            {
+                int i1 = 0;
+                do {
+                    a0[14] = (((67 != 86) > (v0 % 9)) ? ((i0 % 7) > (i1 * 47)) : ((30 + a1[2][7]) ? (50 < a1[1][2]) : (v1 < v3)));
+                    a0[14] = (((v0 < v0) * (7 == i0)) ? ((v0 ? 84 : a0[4]) % 4) : ((a0[9] / 5) >= (49 + a0[2])));
+                    a0[12] = (((v2 >= 58) * (a0[3] > v3)) + ((a0[11] < a0[10]) || (v1 && 21)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v0 && 74) % 6) || ((i2 % 6) < (v0 - 91)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((v1 < v1) > 74) break;
+                    a0[5] = (((50 / 8) <= (a0[14] * v3)) < ((i2 ? a0[8] : i3) * (a1[0][12] || v2)));
+                    v1 = (((v1 - v3) ? (a0[3] ? v1 : a0[4]) : (i3 || i2)) && ((v1 >= a0[1]) || (v2 == i2)));
+                    a1[1][6] = (((v0 != v0) % 7) || ((i2 && 42) * (v0 >= v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((88 + 94) * (45 < v3)) / 3);
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((a1[1][14] && v1) == (v1 + 78)) / 8)) {
+        v1 = (((a0[1] != v1) > (v0 - v2)) != ((v2 >= v3) ? (v3 <= v2) : (a1[0][1] == v3)));
+        v2 = (((v0 + 80) < (a0[15] > v0)) ? ((39 - 88) && (v2 % 3)) : ((62 > a0[1]) + (v2 != a0[14])));
+        a0[1] = (((a0[5] != v1) - (v0 + a0[9])) || ((v3 - 27) < (v1 != 8)));
+    } else {
+        v1 = (((v0 && a1[2][14]) || (v3 != v3)) != ((v3 + v1) || (v2 || a0[14])));
+        a0[0] = (((66 ? v2 : v3) && (v3 == v3)) || ((a1[3][6] ? v0 : v1) + (a1[1][3] / 1)));
+        v0 = (((18 && v1) < (v2 ? a0[2] : v3)) <= ((45 / 7) != (a1[2][5] < v1)));
+    }
+    if ((((62 < 6) && (v1 ? a1[1][0] : 61)) || ((a0[10] < v3) != (v0 != v2)))) {
+        a0[8] = (((47 != a0[8]) < (a0[2] + v2)) == ((a0[14] + a1[3][12]) ? (a1[1][11] * v0) : (a0[7] || v1)));
+        a1[3][0] = (((v2 <= 59) - (43 || a0[4])) <= ((v2 != a1[2][12]) / 7));
+        v0 = (((17 * a0[10]) - (82 && v0)) + ((v3 / 4) || (80 <= v3)));
+    } else {
+        v2 = (((v1 % 9) >= (v2 <= 82)) <= ((54 * v1) >= (21 <= v1)));
+        a0[6] = (((v0 && v1) * (a1[2][6] - 20)) > ((a0[1] + 38) != (v1 != v3)));
+        v2 = (((v1 && v2) ? (a0[8] + a0[7]) : (a1[2][0] * v3)) || ((a0[13] - v3) ? (a1[3][14] % 3) : (a0[10] <= v3)));
+    }
+    a1[0][7] = (((a0[14] ? 92 : v3) == (v3 + v0)) >= ((79 != v1) - (v1 > v0)));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((v2 && a0[4]) > 89) break;
+                    v0 = (((v1 % 4) && (i5 <= 98)) ? ((i4 / 8) - (a0[4] >= i4)) : ((v2 <= i4) >= (v1 % 7)));
+                    v1 = (((a1[3][5] > v3) != (i5 != a0[12])) - ((33 - 24) || (a0[2] > v2)));
+                    v0 = (((98 % 7) / 6) > ((29 != v0) && (i4 == a0[10])));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v0 + 93) > (67 <= v3)) || ((31 >= a1[3][11]) || (44 > a1[0][15])));
+            v0 = (((v1 + 49) || (v3 >= v1)) >= ((66 < v0) / 4));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    v2 = (((a1[1][14] - v0) == (v1 <= a1[1][11])) != ((78 && 93) - (v2 / 5)));
+    v2 = (((a0[6] <= v1) && (v1 ? v0 : a0[11])) != ((28 - v2) + (43 + v0)));
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        v2 = (((v0 == a0[10]) >= (69 || 55)) ? ((83 == i6) > (79 + i6)) : ((v3 <= a0[5]) ? (13 >= 57) : (i6 % 2)));
+        a0[5] = (((v3 < v1) ? (v3 <= v0) : (i6 >= 41)) < ((v1 >= v2) >= (a0[5] % 6)));
+        {
+            int i7 = 0;
+            while (i7 < 6) {
+                if ((1 - v0) > 76) break;
+                v2 = (((v2 != 11) || (v3 == a1[2][7])) >= ((a0[10] ? i6 : a1[0][8]) ? (a1[3][4] - i6) : (v0 % 9)));
+                v2 = (((21 % 2) * (v3 == i7)) ? ((77 / 4) > (v3 - 63)) : ((96 <= v3) && (i6 * 49)));
+                a1[2][14] = (((i7 / 1) < (i7 / 1)) == ((i6 + 52) == (v2 >= v2)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    v2 = (((66 <= v2) < (a0[9] ? a1[0][9] : v0)) - ((v2 % 5) > (v2 - v2)));
+    return (((v0 + v0) == (a1[0][12] >= 88)) ? ((v3 == v1) >= (v0 || v1)) : ((a1[1][8] - v2) && (v3 != 58)));
+}
+int f26() {
+    int v0 = 14;
+    int v1 = 37;
+    int v2 = 89;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v3 = (((22 == 36) < (v1 == v0)) >= ((v2 < 97) != (40 + 91)));
+        v3 = (((v2 - v1) / 6) ? ((i0 ? a0[13] : v1) / 3) : ((v1 && 64) < (i0 == v2)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v3 = (((v2 != i0) % 6) ? ((i0 ? 91 : v1) <= (v0 / 1)) : ((55 < 10) ? (90 <= 99) : (37 - v3)));
+            v0 = (((a0[1] || i1) / 8) ? ((i0 % 8) * (v3 > v2)) : ((v1 + i1) - (i1 == v1)));
+            v0 = (((v1 ? v0 : v0) - (a1[2][3] + a1[0][13])) - ((v0 * v2) - (v1 ? v2 : i0)));
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((v1 ? a1[1][9] : i2) > 59) break;
+        a1[1][11] = (((a0[12] >= i2) ? (v3 + i2) : (0 <= v0)) || ((a0[6] < v3) && (a1[1][8] < v1)));
+        a1[2][14] = (((a1[1][9] + a1[1][2]) / 7) - ((a1[2][5] ? v3 : v2) < (v1 / 9)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v2 = (((v3 < i3) ? (a1[2][5] == a1[2][11]) : (a1[2][0] % 6)) % 3);
+            v0 = (((17 % 7) < (29 && i3)) <= ((a1[1][0] * a1[3][8]) == (29 == v1)));
+            v2 = (((i2 ? i2 : 41) < (a1[3][10] == v1)) ? ((a0[12] - a1[3][2]) || (13 ? a0[2] : a0[5])) : ((v3 <= i2) > (v3 == v3)));
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        a0[9] = (((22 || a0[0]) + (i4 == 99)) * ((v1 * a1[1][10]) < (v3 * v2)));
+        {
+            int i5 = 0;
+            do {
+                v3 = (((a0[15] % 9) ? (v2 % 9) : (i5 * a1[2][6])) - ((v2 - v3) / 2));
+                v3 = (((v2 != v3) == (i5 > i4)) < ((a0[8] && v1) + (26 <= a0[13])));
+                a1[0][9] = (((a1[3][11] > i4) + (i4 >= v1)) > ((v2 <= i4) + (i4 != v0)));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+        a1[3][0] = (((v3 + v1) <= (i4 * 25)) && ((v2 + v1) + (a1[1][2] == 39)));
+    }
+    a0[13] = (((v0 != v3) % 2) - ((16 < v3) + (a1[3][15] ? v2 : v2)));
+    if ((((13 + a0[4]) ? (v0 + v0) : (v3 + v3)) / 9)) {
+        v0 = (((v3 - v2) + (v0 ? v1 : v1)) != ((a1[2][14] / 5) % 2));
+        v2 = (((v3 + a1[1][10]) / 9) ? ((56 + a1[2][0]) > (v0 ? a1[1][1] : v0)) : ((a1[2][13] ? 79 : v1) != (a1[1][0] <= a0[13])));
+        v0 = (((v3 > v2) + (v2 / 6)) - ((62 ? v2 : a1[2][14]) / 5));
+    } else {
+        v2 = (((v3 && 89) % 7) || ((a1[3][13] < 34) * (v2 ? v2 : v3)));
+        v1 = (((96 - v1) >= (v1 < a0[7])) <= ((a0[12] < a0[1]) >= (v2 == a0[0])));
+        a0[2] = (((v3 >= a0[11]) - (a0[13] % 6)) * ((a0[15] ? v2 : v1) ? (a1[0][8] == a1[3][9]) : (a1[1][4] == a1[2][13])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            a1[1][9] = (((v1 / 1) >= (30 % 9)) / 9);
+            {
+                int i7 = 0;
+                do {
+                    v3 = (((a1[3][14] - v2) + (v0 % 8)) + ((a0[12] && v2) ? (i7 <= i6) : (v2 == v0)));
+                    a1[0][4] = (((i6 ? 16 : i6) ? (v1 / 1) : (a0[4] > v3)) * ((a0[7] && 27) < (v3 == i6)));
+                    a0[9] = (((a1[0][9] >= 37) >= (18 * i6)) != ((v3 % 7) + (93 || 30)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            v0 = (((a0[8] * a0[5]) % 7) * ((v0 != 57) - (v1 * v3)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        if ((a0[11] >= 11) > 81) break;
+        for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+            v1 = (((v3 < v2) ? (19 >= a0[9]) : (v2 ? 94 : 89)) >= ((i9 < a0[7]) >= (v1 % 2)));
+            v3 = (((17 ? v0 : 80) <= (98 <= a1[2][13])) != ((v3 != i9) >= (v2 / 9)));
+            v2 = (((v3 ? a1[3][10] : v0) <= (a0[10] >= i9)) ? ((44 ? a0[1] : v0) >= (72 > i8)) : ((v1 ? v0 : i9) / 6));
+        }
+        v3 = (((v0 + 64) && (46 == a1[0][15])) % 3);
+        v0 = (((55 != a0[3]) == (v1 <= v3)) / 4);
+    }
+    {
+        int i10 = 0;
+        do {
+            v2 = (((45 >= 25) < (a1[0][1] == a0[1])) == ((a1[3][7] % 4) + (v0 / 2)));
+            for (int i11 = 0; i11 < 6; i11 = i11 + 1) {
+                v2 = (((a1[2][13] < v3) + (a1[0][2] || 17)) < ((a0[10] - v3) == (i11 > 81)));
+                v1 = (((v3 != i10) ? (2 + 4) : (50 && a0[2])) > ((i10 || 33) / 4));
+                a0[1] = (((68 ? i11 : a0[14]) / 3) == ((v0 || i11) ? (v0 && i11) : (i11 ? a1[2][12] : i10)));
+            }
+            v0 = (((a1[1][13] + i10) > (a1[0][8] / 9)) >= ((a1[3][3] > i10) <= (37 + a1[3][1])));
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    for (int i12 = 0; i12 < 3; i12 = i12 + 1) {
+        for (int i13 = 0; i13 < 4; i13 = i13 + 1) {
+            a1[3][1] = (((v1 - a1[3][0]) + (v3 % 8)) % 4);
+            v3 = (((a0[2] || v1) * (v1 == v3)) - ((13 + 47) + (i13 >= v2)));
+            v0 = (((37 + i12) < (0 != 52)) ? ((a1[0][15] != a1[0][2]) ? (v0 >= a1[1][3]) : (v3 == 19)) : ((v3 <= v0) <= (a0[0] - 95)));
+        }
+        v2 = (((i12 > v2) - (68 != a0[10])) != ((85 + i12) > (a1[1][14] && 2)));
+        v0 = (((89 <= v3) || (a0[15] < v3)) > ((47 - v2) ? (v0 / 8) : (37 >= a1[2][14])));
+    }
+    {
+        int i14 = 0;
+        while (i14 < 8) {
+            a1[1][1] = (((55 > 20) - (v0 >= a0[12])) >= ((a1[3][8] * i14) == (v3 % 9)));
+            a1[2][3] = (((i14 >= 89) || (a0[0] == 49)) == ((v3 < v3) ? (a1[3][12] && 66) : (v3 >= v1)));
+            for (int i15 = 0; i15 < 3; i15 = i15 + 1) {
+                a0[6] = (((49 == v0) >= (v3 == v2)) < ((11 >= 67) > (a0[14] > a1[3][0])));
+                v3 = (((44 - i14) * (i14 ? a1[3][1] : 80)) != ((v1 * i15) / 5));
+                v2 = (((a0[8] * a1[3][2]) && (64 - 69)) / 1);
+            }
+            i14 = i14 + 1;
+        }
+    }
+    return (((41 <= 50) != (72 * 76)) > ((v1 > 7) + (v1 <= 61)));
+}
+int f27() {
+    int v0 = 71;
+    int v1 = 91;
+    int v2 = 73;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 * 75) != (a1[2][2] / 5)) == ((v3 != v0) % 3));
+    v2 = (((v1 >= 88) && (a1[0][9] && 30)) != ((v0 <= a0[11]) ? (v3 * 18) : (v0 * v3)));
+    v2 = (((4 <= v3) / 5) - ((a1[3][12] > a1[0][5]) > (v0 && v0)));
+    if ((((v3 == 81) % 1) * ((v0 * v3) / 7))) {
+        v2 = (((v0 / 6) + (v0 ? a0[2] : v1)) ? ((v1 <= 34) ? (44 / 4) : (a1[3][10] * 33)) : ((v3 == 91) >= (v0 == a0[8])));
+        v0 = (((60 || v2) <= (v3 && a0[15])) && ((v0 || a0[10]) % 5));
+        v2 = (((15 + v2) >= (v0 > v3)) < ((a0[8] % 9) > (a1[0][7] > v2)));
+    } else {
+        v1 = (((82 > v1) > (v2 ? v0 : v3)) != ((47 ? 77 : 32) > (v1 || a0[14])));
+        v0 = (((v2 / 1) > (0 == v1)) <= ((a0[11] ? v2 : v1) % 1));
+        v0 = (((v2 >= v0) || (v2 > v1)) - ((44 && v1) * (v1 != v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[0] = (((i0 > v1) ? (v3 <= i0) : (v1 >= a0[12])) || ((v2 / 3) % 6));
+            a0[9] = (((a0[8] && 29) % 3) / 6);
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((a0[8] <= 7) > 81) break;
+                    a0[7] = (((v1 < 71) < (v1 % 4)) || ((a1[2][15] >= a1[3][12]) ? (i0 - v0) : (v3 <= 80)));
+                    a1[1][15] = (((i1 > a1[0][4]) % 8) > ((20 >= a1[2][2]) == (v3 || a1[2][7])));
+                    a0[5] = (((a0[2] < a1[2][8]) == (i0 <= a0[12])) || ((v1 && v0) * (i0 - v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    v0 = (((51 % 1) >= (v2 ? 57 : v3)) <= ((60 - v3) % 5));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                v0 = (((v2 + a1[0][13]) / 4) ? ((v1 && a1[3][6]) && (12 / 6)) : ((v1 % 4) * (v1 ? a0[8] : 58)));
+                v2 = (((i3 && a1[1][6]) && (a1[2][3] >= a1[3][14])) && ((v3 ? i2 : i2) != (i2 < i3)));
+                v2 = (((i3 <= i3) / 8) * ((i2 <= a0[2]) && (v1 ? v2 : v0)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v3 + a0[8]) != (83 + 11)) <= ((96 < v3) >= (v3 + 67)));
+        a0[14] = (((a1[1][1] && a1[2][0]) || (7 / 9)) > ((v1 >= v1) > (a0[13] % 8)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            v0 = (((a0[4] >= 55) && (19 || 18)) * ((19 > v1) % 8));
+            v0 = (((v3 + a0[12]) > (v3 * v1)) ? ((a1[2][7] - a1[2][6]) * (46 + 10)) : ((v2 ? a0[13] : v1) - (19 * v2)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((i5 >= i4) >= (63 || a0[7])) == ((v1 && i5) == (v3 == v0)));
+                    v3 = (((i4 % 9) % 8) % 2);
+                    a1[0][8] = (((v0 == v0) ? (v0 / 1) : (48 && 13)) >= ((a1[1][9] > 98) + (v0 <= v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((a0[8] - v2) > 95) break;
+            v3 = (((a0[7] > i6) != (i6 || 95)) < ((v1 <= v1) || (v1 != v2)));
+            v0 = (((a0[9] == 61) > (30 % 8)) == ((62 / 8) ? (57 + 98) : (v3 > a0[3])));
+            {
+                int i7 = 0;
+                do {
+                    if ((43 && a0[0]) > 80) break;
+                    v1 = (((i6 == v3) ? (v1 / 6) : (v1 ? a1[2][3] : 17)) != ((i7 % 7) <= (v1 ? v2 : v1)));
+                    v1 = (((a0[13] && 87) <= (i6 != a1[3][4])) == ((31 <= a1[2][2]) < (v1 == a1[1][9])));
+                    a1[2][15] = (((a1[2][5] ? v0 : i6) <= (35 == a0[3])) >= ((i6 ? v2 : a0[4]) / 5));
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    if ((((8 || a1[3][5]) % 9) || ((v2 == v3) == (v1 != a0[10])))) {
+        v2 = (((15 == a1[1][7]) + (v3 <= 12)) > ((v1 == v0) + (v1 && a0[7])));
+        v0 = (((v3 > a0[4]) == (a1[2][15] <= v2)) >= ((0 != 27) != (10 + 22)));
+        v1 = (((a1[2][1] % 9) * (a1[3][14] < v0)) && ((a1[2][1] ? 4 : v0) * (v0 < 38)));
+    } else {
+        v1 = (((a1[0][12] >= a1[2][15]) < (v2 != a0[1])) != ((a0[9] == v2) != (55 + 24)));
+        a1[1][6] = (((v1 != v3) != (v3 % 4)) + ((a1[0][1] % 6) > (a0[6] || 84)));
+        a1[3][13] = (((45 <= v0) + (35 || a1[2][9])) ? ((v3 + v1) <= (v1 && v2)) : ((a1[2][6] + a0[3]) != (v3 ? v0 : a0[10])));
+    }
+    return (((64 && v1) ? (v1 + v0) : (54 || v1)) < ((v1 != a1[1][9]) >= (5 >= a0[6])));
+}
+int f28() {
+    int v0 = 26;
+    int v1 = 49;
+    int v2 = 30;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 > i0) > 59) break;
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a0[2] = (((a1[0][11] > v0) || (27 + 38)) * ((a0[5] - 25) <= (v0 < 10)));
+                    a0[3] = (((14 - 74) + (i1 && v0)) || ((v0 ? a1[3][4] : i0) ? (v3 < a0[8]) : (a1[0][13] == a0[3])));
+                    v3 = (((a0[12] == i1) != (a0[7] / 6)) ? ((v3 == 4) ? (v3 >= i1) : (v0 - i0)) : ((a1[2][7] ? v3 : a1[1][2]) > (a0[13] != a1[3][6])));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a1[2][9] && 72) < (12 || 56)) == ((v2 > v2) >= (26 ? 51 : v2)));
+            v2 = (((v0 * a0[0]) != (90 > 46)) < ((v0 != v1) - (70 > v2)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((16 % 1) - (32 ? v0 : a1[0][4])) - ((5 / 2) && (v0 + 80)))) {
+        v1 = (((2 && v3) ? (a0[11] != v3) : (v2 / 5)) / 9);
+        v2 = (((v0 ? v0 : v2) >= (80 < 23)) && ((v3 != 35) != (v2 < a1[0][5])));
+        v2 = (((v3 || v0) == (v1 > a1[2][0])) && ((a1[2][6] - a1[0][8]) != (a1[3][6] / 6)));
+    } else {
+        a1[2][7] = (((a0[14] * v3) || (v3 != v3)) % 6);
+        a1[3][0] = (((v3 % 7) && (v2 ? a0[6] : v2)) < ((v0 % 2) ? (a0[9] ? v3 : 21) : (v1 - v0)));
+        a0[12] = (((v3 % 3) ? (v3 * v1) : (a1[1][1] * a0[14])) + ((41 && v0) && (a0[3] ? a1[1][13] : 64)));
+    }
+    if ((((v1 * v1) + (a1[3][11] > a0[13])) <= ((a1[1][7] ? 46 : v2) == (40 <= v0)))) {
+        a1[0][13] = (((v2 / 1) / 6) && ((a0[3] % 4) >= (v3 + v0)));
+        a1[0][2] = (((a1[3][7] - v1) != (a1[0][2] && v1)) != ((v2 <= v0) - (19 + 27)));
+        a0[13] = (((v3 % 8) != (v0 ? 64 : v0)) / 6);
+    } else {
+        a0[8] = (((a0[6] / 3) * (a1[0][11] / 2)) < ((v3 <= v1) > (a1[1][11] * a1[3][15])));
+        v0 = (((v2 < 18) + (92 ? v2 : a0[0])) != ((v3 != v3) >= (v2 ? v0 : v2)));
+        v3 = (((v2 > v3) ? (v0 ? v3 : v0) : (6 + a0[6])) == ((10 >= a0[6]) / 1));
+    }
+    a1[2][1] = (((v0 + 15) ? (v0 >= a0[13]) : (v3 == 17)) * ((46 ? a1[3][5] : 37) - (a0[14] * v3)));
+    a0[4] = (((97 != v3) * (v0 > v2)) + ((a0[6] ? 49 : v0) < (v2 / 3)));
+    if ((((a0[11] ? a1[2][1] : v2) >= (v3 ? a1[1][3] : v2)) < ((0 < v2) && (69 == a0[8])))) {
+        a1[3][2] = (((a1[1][5] - v1) + (v1 / 5)) != ((20 - a0[4]) <= (a1[3][14] < v2)));
+        v1 = (((v1 != 72) && (v1 < a1[1][7])) && ((20 <= 50) != (v2 < a0[8])));
+        v3 = (((a1[2][0] - v3) && (62 != v0)) - ((a0[3] * a1[3][3]) >= (v1 && v1)));
+    } else {
+        v3 = (((a1[1][4] < 3) <= (v3 % 4)) == ((v3 + a1[3][6]) >= (51 != 14)));
+        v0 = (((v2 == a1[2][0]) >= (a0[1] < a1[0][2])) < ((3 ? a0[11] : a1[1][11]) < (v0 > v3)));
+        v3 = (((v0 >= a0[6]) > (v0 ? v2 : a0[12])) > ((v1 < v0) ? (52 / 3) : (v3 - 71)));
+    }
+    a0[8] = (((62 > a0[9]) != (v1 - 89)) < ((v2 > v2) ? (a0[14] ? v0 : v2) : (v2 && v2)));
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a1[3][3] = (((56 == 77) + (v0 != i3)) != ((v0 != v2) * (11 - i2)));
+                a1[0][10] = (((a1[0][11] || i3) / 5) <= ((i2 != a1[0][1]) - (a1[2][15] == v3)));
+                a0[0] = (((18 != v1) - (85 > 40)) ? ((a0[8] || 73) != (v1 < 7)) : ((v3 - i3) == (a0[7] - a1[0][5])));
+            }
+            a0[7] = (((v2 != v1) <= (a0[15] ? v1 : a1[3][0])) != ((10 < 44) >= (4 + i2)));
+            v3 = (((v3 || v2) == (a0[15] ? 67 : v2)) != ((2 && v2) + (i2 % 5)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v2 ? v3 : v0) ? (64 || a0[7]) : (v0 % 6)) <= ((i4 + v1) <= (i4 < v1)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v0 = (((27 <= 95) != (a1[0][15] && v2)) >= ((a0[12] / 5) <= (34 * a1[2][6])));
+                    v3 = (((v1 <= 41) || (59 && 15)) != ((i4 - 27) && (v0 <= a1[3][11])));
+                    v3 = (((a0[7] == v2) >= (v3 <= 81)) * ((a0[1] - a1[3][9]) != (a0[10] == v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][11] = (((27 % 3) && (a1[1][6] >= v1)) >= ((50 / 2) != (v3 ? v0 : v1)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v0 = (((a1[0][14] < v2) / 6) <= ((52 <= a0[14]) * (44 ? v0 : 44)));
+            v1 = (((33 ? v3 : 11) % 5) || ((a0[7] >= i6) == (a0[1] - 13)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    if ((a0[11] * v0) > 76) break;
+                    v3 = (((i6 ? v3 : v2) ? (v1 + 78) : (51 > 70)) * ((i6 ? 90 : v1) == (i6 == v1)));
+                    v0 = (((i7 >= 20) / 7) + ((a0[5] * i6) ? (91 > v1) : (i7 > v3)));
+                    a1[0][4] = (((v0 && i6) + (i7 ? v3 : v2)) >= ((a1[1][10] % 3) != (v0 - 4)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v3 > v2) + (v3 % 2)) ? ((96 >= 56) ? (79 + v0) : (a1[0][8] ? a1[2][2] : v0)) : ((21 ? a0[4] : v0) <= (a0[7] == v3)));
+}
+int f29() {
+    int v0 = 87;
+    int v1 = 52;
+    int v2 = 49;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 ? 46 : a0[11]) < (a0[6] || v0)) ? ((a1[0][3] ? v2 : v0) * (v2 && v1)) : ((v3 / 7) == (v1 / 5)))) {
+        a1[3][4] = (((v0 != v2) % 6) ? ((a0[13] <= a0[13]) ? (v1 ? a1[1][6] : v0) : (v0 + v0)) : ((v3 - 49) > (a1[1][12] > 9)));
+        a1[1][13] = (((v3 + a0[11]) <= (v3 + a1[0][2])) ? ((v1 + 53) == (v1 < v3)) : ((v1 ? 56 : a1[3][0]) / 4));
+        a1[3][13] = (((a0[3] != 89) <= (60 ? 98 : a1[0][4])) == ((v0 == a0[9]) != (a1[0][15] * v3)));
+    } else {
+        v3 = (((v3 == v3) + (v2 >= v1)) <= ((a1[2][7] >= a1[0][8]) / 6));
+        a1[3][1] = (((a0[7] > v0) != (v0 < v3)) == ((v2 > a1[1][0]) - (a0[10] ? 92 : v1)));
+        a0[6] = (((71 % 4) ? (a1[0][14] <= a0[6]) : (46 || 56)) >= ((v2 - 60) ? (v3 == 58) : (43 < 48)));
+    }
+    v1 = (((v2 * v0) || (73 % 9)) ? ((v1 == v0) != (v3 == 53)) : ((v2 ? a0[11] : 65) ? (99 ? v1 : 50) : (a0[0] && v0)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((45 > v3) || (v0 % 5)) < ((a1[2][2] / 5) || (41 || v1)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v0 + a0[12]) < (i0 >= a1[2][10])) + ((a0[6] == v1) != (a1[2][11] && v3)));
+                    v2 = (((34 + 57) < (50 ? 38 : 44)) == ((17 % 3) - (v3 && i1)));
+                    v0 = (((a0[11] && 35) * (a1[2][8] != 12)) <= ((73 || v3) > (89 != v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v0 = (((i0 && 45) + (82 != a0[11])) ? ((v0 * a1[1][8]) > (v1 < a0[1])) : ((2 > v2) * (v2 != v1)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((v3 * a1[3][10]) > (v2 >= a0[12])) ? ((v3 >= a0[8]) ? (24 / 8) : (a1[3][1] == a1[0][12])) : ((v3 > v0) < (v2 % 7)))) {
+        a0[11] = (((v0 - a0[11]) % 4) + ((v1 ? v0 : v2) * (v1 && v2)));
+        v2 = (((v2 > v3) == (35 <= a0[7])) || ((v3 ? a0[10] : 55) ? (v1 && 38) : (v0 && v3)));
+        v3 = (((22 || v2) == (31 - v2)) && ((v2 <= v0) > (a0[4] <= 32)));
+    } else {
+        v0 = (((72 % 2) - (a0[3] - 72)) > ((v0 % 2) == (8 == a1[1][10])));
+        v3 = (((37 % 8) != (87 ? v0 : v1)) && ((97 * v2) ? (v2 && v1) : (v0 / 6)));
+        v2 = (((v1 > v1) != (v1 <= a0[10])) >= ((v3 % 6) || (v1 ? v3 : 90)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((a1[3][10] * v2) < (88 * 25)) * ((a0[7] && v1) / 9));
+        v1 = (((a0[8] * 78) || (38 ? 41 : 5)) + ((32 == i2) < (77 - 47)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                a1[0][7] = (((v1 <= i3) * (56 >= v2)) / 5);
+                v0 = (((v0 * 26) == (v3 == 26)) || ((i2 * i3) < (v0 ? v2 : 97)));
+                v3 = (((a0[11] && a0[15]) || (v1 <= 54)) + ((v1 > i3) <= (49 && a1[3][15])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    v2 = (((v2 && v2) + (55 && v1)) == ((v1 || v1) && (v2 - a1[1][12])));
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v0 = (((a1[2][15] * 32) % 6) || ((59 < a0[2]) * (v2 != a1[0][4])));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            v2 = (((i5 ? v3 : v0) == (i5 != 89)) > ((57 ? a0[3] : a0[5]) % 7));
+            v2 = (((i5 > 29) >= (i5 ? i4 : i4)) || ((a0[9] ? v1 : 57) >= (v3 ? i4 : v1)));
+            v3 = (((64 - v0) != (34 < 76)) == ((i4 + v1) != (i4 && a0[9])));
+        }
+        v2 = (((a1[3][5] ? v0 : v2) || (a0[3] ? v3 : 31)) > ((i4 - a0[12]) > (5 * v3)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((i6 < a1[0][12]) > 73) break;
+            v3 = (((65 == v1) > (48 == 96)) ? ((v3 < v3) || (v1 - a0[10])) : ((v3 % 6) * (i6 * 34)));
+            {
+                int i7 = 0;
+                do {
+                    if ((a0[6] == v2) > 88) break;
+                    v2 = (((a0[0] >= v1) % 7) >= ((v0 > v1) ? (v0 - a1[3][7]) : (i7 * a0[12])));
+                    a0[2] = (((a1[3][5] * 41) % 9) ? ((v2 ? v2 : a1[3][8]) / 9) : ((a0[1] && i7) || (8 >= 48)));
+                    a0[6] = (((95 != a0[13]) < (16 * a0[6])) / 6);
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            v0 = (((i6 - v0) >= (v0 >= a0[13])) != ((58 > a0[0]) / 5));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[2][11] = (((v3 <= v0) && (a0[13] != 54)) / 9);
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                v2 = (((56 / 6) && (v2 % 6)) ? ((i8 + 83) <= (a0[5] * a0[10])) : ((v0 / 7) / 1));
+                v0 = (((76 == a0[3]) % 8) == ((14 == a0[8]) ? (90 == a0[10]) : (v3 != 34)));
+                a1[2][5] = (((v1 > i9) * (i8 != v1)) % 4);
+            }
+            v1 = (((v1 - 9) % 2) == ((a0[10] + i8) % 8));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    if ((((86 ? a0[9] : 95) ? (72 == a0[8]) : (a1[3][4] * v2)) < ((v3 + a0[6]) / 9))) {
+        v3 = (((v0 > v2) + (a0[7] == v2)) ? ((v0 || a0[6]) <= (v2 - a1[1][9])) : ((v2 <= a0[4]) >= (v2 ? v2 : 46)));
+        v0 = (((9 > 8) > (a1[0][13] >= v3)) * ((5 ? a0[9] : v2) > (a0[5] == v3)));
+        v2 = (((v2 || 62) - (v2 || 46)) + ((a1[3][0] ? 5 : v3) && (v0 == 40)));
+    } else {
+        v2 = (((a1[3][15] != a0[8]) <= (a0[1] > 3)) != ((v1 <= v0) <= (a0[7] != 97)));
+        a1[1][15] = (((71 >= 84) < (a1[3][14] || 20)) / 5);
+        a1[0][1] = (((v1 != 85) * (a1[1][10] + 55)) > ((v2 > a0[1]) >= (60 == v1)));
+    }
+    return (((v0 / 2) != (a0[6] ? a0[13] : v1)) / 6);
+}
+int f30() {
+    int v0 = 28;
+    int v1 = 37;
+    int v2 = 24;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 ? v0 : v2) > 76) break;
+            a0[0] = (((v1 / 9) == (v2 > v2)) > ((20 % 2) % 2));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((59 == v3) == (i1 == v0)) * ((48 + 47) == (49 >= v2)));
+                    v2 = (((v0 || i1) || (63 >= a0[0])) - ((40 + v1) * (v1 % 2)));
+                    a1[3][3] = (((58 / 4) ? (20 && a0[14]) : (i0 * v2)) - ((99 - v0) >= (v0 || v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((a1[0][7] > 56) ? (a1[2][11] || i0) : (v2 == a1[2][15])) ? ((v3 >= a0[7]) * (v0 > a1[3][0])) : ((v2 && v1) || (v0 == 49)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((v3 ? a1[0][13] : v3) > 60) break;
+        v0 = (((v1 == v1) == (v2 && a1[0][5])) - ((a0[10] > a0[8]) - (v0 - 69)));
+        a0[15] = (((v0 || i2) % 2) < ((v0 || 31) + (v2 % 2)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            if ((43 == v3) > 67) break;
+            v1 = (((v1 != 29) ? (a0[4] <= v2) : (a1[3][7] * 18)) * ((51 ? i2 : a1[2][5]) / 1));
+            v0 = (((5 <= 92) > (a1[0][6] ? v1 : i3)) + ((i2 && 67) % 6));
+            a0[0] = (((v2 && 4) > (36 / 7)) != ((v3 && i2) % 1));
+        }
+    }
+    a1[3][0] = (((v3 || v0) >= (v2 == v2)) != ((a1[2][4] % 1) <= (5 / 3)));
+    if ((((v2 > v2) % 1) % 6)) {
+        v3 = (((v1 && v2) * (v3 < 88)) - ((a1[0][4] >= 72) <= (86 < 97)));
+        v1 = (((v0 && v2) % 9) || ((v2 % 6) > (v0 + a1[0][14])));
+        a0[10] = (((v3 == 26) ? (v1 % 7) : (a1[0][2] ? v0 : a0[2])) / 9);
+    } else {
+        v3 = (((55 || v3) > (26 * v1)) >= ((v3 % 4) == (v3 > v0)));
+        v0 = (((v2 || v2) ? (a0[0] >= v0) : (v3 ? v1 : v2)) ? ((v0 <= v2) > (12 / 6)) : ((v1 - 2) % 8));
+        a0[15] = (((36 < 48) && (v2 >= v2)) == ((v3 > v1) != (a0[2] && v1)));
+    }
+    if ((((a1[3][10] - a0[12]) == (v0 + v2)) == ((11 / 5) ? (v2 < 29) : (v3 * 49)))) {
+        v1 = (((v3 > v1) * (16 - v1)) < ((67 != v1) < (42 / 3)));
+        a0[11] = (((v2 % 5) + (39 || v2)) ? ((v1 > v3) + (63 != v0)) : ((v0 >= 24) + (v1 / 4)));
+        v3 = (((a0[9] ? a0[9] : v0) + (v3 / 3)) ? ((v2 < a1[2][4]) >= (v0 * 69)) : ((9 || a1[0][8]) / 9));
+    } else {
+        v0 = (((90 <= v0) != (a0[13] >= a1[2][14])) >= ((v0 ? a1[0][2] : 26) % 4));
+        v3 = (((69 / 8) > (v3 < 93)) == ((42 * a0[4]) || (v0 >= a1[1][15])));
+        v1 = (((a1[3][8] + v0) < (37 ? 70 : v3)) % 8);
+    }
+    if ((((a0[15] * v3) && (25 * a1[0][5])) <= ((1 > v3) % 8))) {
+        v1 = (((v2 <= a1[0][3]) * (a0[15] * v0)) % 4);
+        a0[11] = (((a1[0][13] ? 31 : v1) != (v2 % 6)) <= ((69 / 2) == (a0[9] < a0[15])));
+        v3 = (((14 % 1) ? (84 % 3) : (v3 || 34)) != ((v3 - v3) || (v0 || v1)));
+    } else {
+        v1 = (((a1[0][8] + v3) >= (v1 ? v2 : v1)) == ((v1 || 6) % 1));
+        a0[8] = (((v3 == v3) <= (v1 ? 37 : 14)) >= ((v0 * v0) > (39 > v3)));
+        v1 = (((v1 >= 22) && (44 >= v2)) / 7);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        if ((v1 < a0[13]) > 71) break;
+        a0[7] = (((a0[9] > a1[1][8]) <= (v2 ? 38 : a0[10])) * ((a1[3][4] ? v1 : 50) > (a0[6] * 8)));
+        a0[5] = (((v1 / 5) * (i4 + 73)) * ((i4 + a1[3][0]) <= (i4 + i4)));
+        {
+            int i5 = 0;
+            do {
+                if ((3 / 7) > 57) break;
+                v1 = (((16 / 8) || (55 > v1)) % 1);
+                v3 = (((i4 == a0[8]) * (a0[3] != v3)) && ((87 - a0[3]) && (v2 != v1)));
+                a0[8] = (((a0[1] >= 66) || (v3 == i5)) ? ((v3 && i4) % 4) : ((i4 ? v0 : 54) >= (v2 <= v1)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+    }
+    v0 = (((v1 ? v2 : a0[5]) * (55 ? v2 : a0[10])) == ((a1[2][1] * v0) || (a0[12] >= v0)));
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                a0[0] = (((i6 ? a0[7] : a0[9]) >= (15 ? v1 : i7)) <= ((a0[15] - a0[15]) >= (v3 > 48)));
+                a1[2][8] = (((a0[9] ? v1 : a1[3][2]) + (a1[2][13] - v1)) * ((v1 > 33) == (a1[2][1] - a0[13])));
+                v1 = (((a0[2] == v3) == (a0[7] / 7)) % 1);
+            }
+            a1[3][11] = (((v0 || v3) >= (v3 / 1)) > ((a1[2][8] || v1) || (i6 < a1[2][13])));
+            v2 = (((v3 > a0[1]) < (28 && v2)) / 6);
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+            a1[1][5] = (((v2 ? 17 : v3) <= (i9 || v2)) || ((56 / 2) + (a0[1] == v1)));
+            v0 = (((v0 % 2) % 1) ? ((v2 * i9) && (v2 + a0[1])) : ((95 < i9) <= (v1 - i8)));
+            v3 = (((i9 ? a0[4] : v2) || (a1[3][10] && v1)) / 5);
+        }
+        v2 = (((v3 > v3) ? (i8 ? i8 : v3) : (69 && a0[4])) % 7);
+        v1 = (((v2 > a1[3][2]) > (v0 || a0[2])) + ((a0[6] * i8) > (i8 == v1)));
+    }
+    return (((a1[2][13] >= a1[2][15]) > (25 + a1[2][7])) * ((31 || v2) * (75 % 3)));
+}
+int f31() {
+    int v0 = 18;
+    int v1 = 74;
+    int v2 = 97;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 + a1[1][1]) == (v2 < v3)) > ((v2 == 0) * (79 >= 46)))) {
+        v0 = (((v2 || v0) < (v2 && 83)) > ((v2 >= v1) && (a1[0][5] || v2)));
+        a1[2][3] = (((1 * v0) % 6) / 8);
+        v2 = (((v1 ? 39 : a1[2][1]) == (a1[0][0] != v1)) <= ((38 / 5) ? (17 ? a1[0][1] : a1[3][10]) : (a0[8] - a1[3][15])));
+    } else {
+        a0[5] = (((v1 > v0) > (a1[0][15] >= a1[2][5])) + ((v3 * a1[1][5]) == (31 >= a0[14])));
+        v3 = (((a1[1][2] ? v1 : 27) < (a1[1][6] == a0[15])) / 3);
+        v1 = (((v2 < v2) / 7) % 5);
+    }
+    if ((((78 - a0[7]) && (a1[0][13] == 62)) % 9)) {
+        v3 = (((v1 <= v2) ? (12 * v2) : (65 || v3)) == ((v3 % 1) && (v0 != 55)));
+        v1 = (((v2 >= v3) % 4) >= ((24 == v2) >= (v2 / 6)));
+        v3 = (((v2 % 9) || (a1[3][13] > v1)) >= ((a1[1][3] && v2) - (a0[11] < v0)));
+    } else {
+        v3 = (((17 < a0[3]) ? (a1[1][5] && 95) : (a1[3][4] - v2)) ? ((v3 == v2) >= (v1 == a0[8])) : ((43 + v1) * (v3 == 81)));
+        a0[6] = (((a1[1][7] != a0[7]) * (a1[3][3] ? v1 : a1[2][5])) <= ((81 != 87) ? (v0 || v2) : (v0 / 4)));
+        v1 = (((v1 != 21) <= (v3 < 0)) + ((57 * v1) / 1));
+    }
+    a1[0][8] = (((a0[3] % 5) <= (a1[0][0] < a0[13])) * ((v2 >= a0[11]) ? (v0 - v1) : (v0 > a1[0][3])));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((v2 <= v3) ? (v3 > 29) : (a0[1] ? v2 : v0)) || ((i0 - 54) >= (v3 ? v2 : a0[0])));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v0 = (((v0 - i0) != (64 == i0)) && ((v2 % 9) + (a0[10] >= a0[3])));
+                a1[3][10] = (((77 > v3) / 7) / 3);
+                v0 = (((a0[13] == v2) && (a0[1] + 1)) > ((v0 ? a1[3][5] : v2) && (64 * 76)));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((v1 != i0) > (i0 && a1[3][14])) && ((a1[3][9] != i0) / 3));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[2][15] = (((a0[5] % 7) <= (v2 ? v3 : a1[1][10])) < ((v3 != 89) / 3));
+            v3 = (((v1 || i2) % 1) == ((i2 >= a1[1][0]) >= (v3 >= v3)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v0 >= v0) || (v1 != a0[5])) == ((a1[1][0] >= 91) % 5));
+                    a1[1][4] = (((39 != a1[0][5]) ? (v1 && v1) : (24 ? v3 : v2)) && ((a1[1][7] != v1) + (21 ? v1 : v1)));
+                    a1[3][1] = (((v1 >= a1[2][8]) > (i3 / 4)) + ((a0[10] == 31) != (i3 <= 45)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((54 || 67) > 68) break;
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                v2 = (((a0[11] <= a0[15]) <= (91 != 93)) != ((a0[11] && v3) < (1 >= a1[3][9])));
+                a1[2][8] = (((v2 || 7) == (v0 * v0)) ? ((48 % 4) ? (v2 && 90) : (74 == 56)) : ((v2 * i5) == (v0 >= 18)));
+                a1[2][11] = (((v3 ? a0[1] : 86) - (v2 + v3)) != ((87 != i5) ? (v0 && a1[3][8]) : (v2 != v3)));
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((81 && a0[6]) ? (12 / 5) : (v0 >= v3)) > ((i4 <= v0) % 7));
+        a0[11] = (((i4 + a1[2][5]) || (v0 % 8)) && ((84 % 5) == (a0[13] % 4)));
+    }
+    if ((((v3 < v2) && (v3 <= v1)) ? ((v2 ? v1 : a0[2]) ? (v1 * v0) : (1 > a1[1][8])) : ((a0[5] ? v0 : 53) / 2))) {
+        v2 = (((v1 + a0[11]) >= (v2 ? v0 : v2)) <= ((a1[0][2] == 12) < (v1 + a0[8])));
+        v3 = (((v2 - 81) || (a0[11] >= a1[3][5])) * ((a1[1][6] < v2) > (v0 ? v0 : v2)));
+        v3 = (((34 != v1) + (v1 * a0[8])) < ((v2 <= a1[3][7]) + (v0 != 42)));
+    } else {
+        a0[15] = (((28 >= 11) ? (14 + v0) : (a0[8] <= v1)) / 1);
+        v1 = (((v1 <= v2) <= (a0[6] || a1[1][5])) <= ((a1[0][11] >= 96) ? (a0[6] % 3) : (v1 < v0)));
+        a0[5] = (((32 == v2) <= (87 ? 20 : 98)) != ((v2 / 4) / 9));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((a1[3][8] || a0[11]) > 96) break;
+            v2 = (((a0[8] + v1) == (a1[3][5] / 6)) / 5);
+            {
+                int i7 = 0;
+                do {
+                    if ((v0 <= 50) > 71) break;
+                    a1[1][1] = (((v1 - 24) >= (i7 > a1[0][0])) != ((v0 ? a1[3][0] : v3) <= (59 ? 35 : a1[2][12])));
+                    v2 = (((i7 <= a0[13]) <= (90 + 1)) >= ((a1[3][8] * a1[1][15]) - (i7 == i7)));
+                    a0[5] = (((93 || v1) <= (i7 >= v3)) / 3);
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            v2 = (((v2 <= v3) / 6) > ((v0 <= v2) != (i6 - v2)));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    v2 = (((v1 || v1) ? (a0[8] - 57) : (27 / 8)) > ((v0 % 2) || (a1[3][2] && a1[2][0])));
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            while (i9 < 2) {
+                a1[3][10] = (((v1 || v3) >= (a0[14] > v0)) + ((a0[0] + a0[9]) >= (v0 == v1)));
+                v1 = (((a0[6] ? i9 : 82) < (v3 != i8)) + ((a0[7] || i8) * (0 == a1[3][11])));
+                v1 = (((v3 == v2) < (i8 - 87)) * ((v2 <= i9) > (a1[3][5] && v3)));
+                i9 = i9 + 1;
+            }
+        }
+        a0[11] = (((81 - v3) > (19 ? i8 : v3)) + ((a0[4] != a1[2][8]) - (a1[0][15] / 1)));
+        v1 = (((a1[0][2] && v3) + (v0 && v2)) * ((v1 < 10) + (57 == a1[0][5])));
+    }
+    return (((v0 / 5) / 4) - ((a0[0] < v3) % 2));
+}
+int f32() {
+    int v0 = 47;
+    int v1 = 84;
+    int v2 = 91;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 > a1[0][3]) ? (a0[10] && a0[3]) : (a0[14] * v2)) < ((v3 * a1[2][12]) / 9))) {
+        v3 = (((40 || v2) - (v0 < v2)) + ((v3 / 2) && (v0 == v0)));
+        v2 = (((a0[9] > 80) > (a0[13] < a0[2])) + ((78 || v3) || (a1[1][7] < v3)));
+        v3 = (((a0[8] || a0[3]) / 1) * ((a0[13] ? a0[1] : 18) * (a1[3][0] != 69)));
+    } else {
+        v1 = (((13 && 49) < (8 + v2)) % 8);
+        v0 = (((a1[2][2] != 16) + (18 - 59)) <= ((a1[1][11] != a0[0]) >= (46 > v3)));
+        a0[7] = (((v2 + 41) ? (v2 - v2) : (v0 == v2)) % 4);
+    }
+    if ((((a1[2][4] < v0) ? (v0 % 6) : (v0 < v3)) / 5)) {
+        v2 = (((v2 ? a0[1] : 29) <= (v2 ? v0 : v2)) || ((v2 >= v2) != (v2 / 4)));
+        v2 = (((15 == a1[0][4]) ? (57 == a1[0][10]) : (v3 != 83)) || ((a1[0][6] ? a1[2][15] : v1) == (v0 ? a0[8] : 96)));
+        v3 = (((83 == a0[15]) >= (58 < v3)) <= ((v1 - v2) == (a0[0] != v1)));
+    } else {
+        v0 = (((v2 / 7) ? (v2 && 14) : (35 && a1[2][2])) * ((v0 - v3) && (a1[1][4] ? v3 : v0)));
+        v2 = (((v2 ? 10 : v1) != (v0 % 1)) <= ((v1 && a1[0][15]) <= (v1 % 4)));
+        v0 = (((v3 < v3) / 6) || ((v3 < a1[2][7]) && (4 / 8)));
+    }
+    v1 = (((a1[2][6] && a0[8]) / 9) <= ((5 || v0) - (74 && a0[12])));
+    a0[13] = (((v0 || a1[1][6]) < (a0[8] && a1[3][12])) <= ((v0 ? v2 : v2) >= (v1 + v0)));
+    {
+        int i0 = 0;
+        do {
+            v0 = (((55 != a1[0][12]) != (a1[3][13] && v1)) ? ((18 ? v1 : v3) == (a0[4] ? v0 : v1)) : ((v3 && 66) ? (70 * v0) : (v0 >= 79)));
+            a0[0] = (((10 + v1) <= (a0[11] != v1)) != ((v1 > v3) * (v0 != v2)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((95 || 22) == (i1 < i1)) + ((v1 % 8) + (a1[2][3] && 18)));
+                    a0[11] = (((v1 % 6) > (v1 || 87)) != ((57 * 12) ? (v2 % 1) : (a0[4] ? v3 : 32)));
+                    a1[3][3] = (((32 % 9) != (a1[3][9] != v3)) + ((a1[1][4] * a0[5]) / 1));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v3 = (((92 == a0[10]) && (a1[0][11] <= v1)) && ((a0[6] >= a1[1][0]) % 8));
+    if ((((a1[3][10] > 50) - (a1[3][3] != v0)) && ((a0[8] + a1[0][3]) * (a1[3][9] - a1[0][9])))) {
+        v0 = (((v0 ? 4 : v0) || (a1[2][13] / 6)) < ((v0 <= v2) == (a0[1] ? 77 : v3)));
+        a0[14] = (((68 >= v0) - (a0[8] && v0)) || ((7 ? a1[1][13] : v0) != (a1[1][3] < 2)));
+        v0 = (((v3 ? v3 : v1) ? (v3 % 4) : (v0 >= v2)) / 2);
+    } else {
+        v2 = (((v0 * 78) + (v1 < v1)) / 5);
+        v1 = (((v0 != v0) - (v1 / 2)) * ((77 + a1[3][1]) || (85 || v1)));
+        a1[2][0] = (((a1[3][5] > a1[0][8]) >= (v0 < v3)) < ((v1 != 23) || (72 < a1[3][1])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v3 = (((v0 && 20) && (a1[2][11] % 4)) > ((a1[3][13] / 3) / 5));
+            v0 = (((v2 / 7) < (a0[11] + a0[5])) ? ((a0[3] || a0[12]) > (v3 || v2)) : ((v1 ? v3 : a1[0][12]) == (a1[1][10] - a0[4])));
+            {
+                int i3 = 0;
+                do {
+                    a0[8] = (((a0[10] == v2) + (i2 - a1[1][13])) / 6);
+                    a0[13] = (((a0[9] && 38) != (93 + 22)) <= ((i3 || v0) * (a1[0][5] != v3)));
+                    a1[2][6] = (((91 - i2) && (v0 == v2)) * ((v1 * v2) * (v2 * a0[0])));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((v3 > v0) * (v1 % 2)) ? ((a1[2][5] / 7) ? (v0 == v1) : (34 / 2)) : ((60 < v2) * (v2 * v3)));
+    a1[0][13] = (((33 - a1[1][13]) - (v0 ? v1 : v3)) ? ((a0[6] + v1) * (v3 % 5)) : ((8 ? v3 : v2) ? (a1[3][3] != a0[14]) : (61 || v2)));
+    return (((86 > v0) ? (v1 && a0[9]) : (v3 ? a0[6] : 8)) < ((v2 ? v1 : v0) * (v1 ? 99 : a1[2][7])));
+}
+int f33() {
+    int v0 = 21;
+    int v1 = 32;
+    int v2 = 49;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 / 3) != (v3 * 54)) % 7)) {
+        v2 = (((35 - v1) ? (a0[1] % 4) : (v0 || 87)) < ((a1[3][12] - v0) - (v3 || a0[0])));
+        v3 = (((v3 / 9) ? (a0[14] > 63) : (v0 > a0[7])) < ((a0[12] >= a1[2][6]) <= (v2 - a0[11])));
+        a0[8] = (((v1 % 4) + (v3 <= 60)) > ((a1[2][14] % 9) % 6));
+    } else {
+        v0 = (((a1[2][3] < v0) == (v3 != a0[0])) > ((0 && v3) <= (v3 < v2)));
+        v3 = (((31 > v2) >= (v3 / 6)) - ((v3 && a1[2][12]) / 5));
+        a1[0][1] = (((v2 < v2) + (v2 || v0)) - ((35 == 98) < (v0 > v1)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v1 = (((92 / 1) && (v0 * 81)) / 2);
+                v0 = (((v2 * i1) > (a0[3] && 51)) / 8);
+                v0 = (((50 ? 17 : v2) ? (a0[8] <= v0) : (a0[3] > 94)) != ((a0[11] > i0) < (v1 / 7)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        a0[5] = (((i0 < 43) * (i0 - 98)) || ((83 >= a0[12]) ? (29 <= v1) : (a0[2] > v1)));
+        v1 = (((59 <= v2) + (v3 < a1[1][2])) % 6);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v1 = (((a0[6] || 6) ? (i2 <= a1[2][5]) : (a0[12] * i2)) != ((i2 ? v2 : v2) > (a1[2][2] ? 77 : v2)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v3 = (((a1[2][15] * i2) != (i2 % 3)) ? ((i3 + a1[2][1]) ? (61 == 89) : (a0[15] * v1)) : ((37 ? a0[15] : i2) - (i2 + v3)));
+                    a0[10] = (((a0[9] ? i3 : v3) ? (a0[7] / 6) : (i2 % 1)) % 5);
+                    v0 = (((a0[10] / 7) >= (v3 % 8)) > ((a0[14] == 38) >= (i3 ? v2 : i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[4] = (((a0[10] >= 7) / 8) * ((i2 || a0[7]) ? (v1 && 48) : (82 + v0)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 && v2) > (v2 ? v1 : v1)) ? ((a0[5] && a0[1]) / 5) : ((v0 >= 97) - (7 * v3)))) {
+        v0 = (((a0[11] ? v3 : 68) ? (v1 % 9) : (v3 <= v1)) - ((a1[1][3] * v2) < (a0[8] == 62)));
+        a1[1][4] = (((38 + v3) * (v0 != 48)) > ((a0[7] || v1) && (v2 <= v1)));
+        a1[0][2] = (((v3 > 82) * (v1 > 61)) ? ((v2 != 48) >= (32 - v1)) : ((v1 ? v0 : a0[7]) < (a1[1][10] <= 21)));
+    } else {
+        a0[3] = (((a0[6] && 88) ? (v0 || 42) : (a0[15] ? 64 : v3)) * ((a0[3] + 56) <= (v0 == a0[7])));
+        a0[14] = (((a1[0][3] || 74) <= (v1 && a1[2][12])) && ((a0[15] + v0) / 4));
+        v0 = (((v2 || a1[3][12]) / 6) <= ((v3 >= a0[14]) || (v2 % 9)));
+    }
+    if ((((a0[3] * v2) * (v1 != v1)) - ((v2 + 20) < (v3 - a1[0][10])))) {
+        a1[2][0] = (((49 <= 34) >= (v1 ? a0[14] : 88)) <= ((62 / 8) < (v3 != 48)));
+        v2 = (((a0[2] / 9) - (a1[1][5] + a1[0][8])) && ((41 / 2) && (60 - a1[1][6])));
+        v3 = (((v3 ? v3 : v1) / 7) * ((v1 < v0) && (33 >= a1[0][0])));
+    } else {
+        v3 = (((33 * v1) <= (70 || v2)) ? ((a1[1][14] && v2) >= (27 ? v3 : v2)) : ((a0[12] - v2) < (59 ? a0[13] : v2)));
+        v3 = (((a0[13] < v3) <= (30 ? 21 : v3)) ? ((v3 > a0[2]) != (a1[0][10] + v3)) : ((75 ? v2 : v2) ? (v2 > 27) : (92 ? a1[2][11] : v0)));
+        v3 = (((27 && v2) > (v2 - a0[14])) % 7);
+    }
+    if ((((a0[11] + 67) / 9) ? ((v2 + a1[1][5]) + (v2 + v2)) : ((8 >= v1) && (v0 + v2)))) {
+        v1 = (((10 == v3) != (a1[0][7] + 73)) - ((v3 != v3) <= (a0[12] % 7)));
+        v1 = (((a0[3] * a1[1][0]) && (75 + v2)) + ((v3 % 2) / 9));
+        a1[1][8] = (((a1[2][7] - v3) / 4) < ((a0[12] < v0) ? (v0 || v2) : (82 + v1)));
+    } else {
+        a0[11] = (((25 || v3) / 4) <= ((v3 == a1[3][14]) < (a0[2] <= 86)));
+        v1 = (((a0[14] - v0) / 7) && ((18 * v2) ? (a1[0][14] - v0) : (a0[15] ? v2 : 72)));
+        a0[1] = (((v0 > 0) ? (34 >= 80) : (a0[0] / 7)) ? ((a1[3][4] != v0) + (a0[6] < v3)) : ((v1 / 4) == (a1[2][7] >= 34)));
+    }
+    if ((((v1 % 9) * (v1 > v0)) % 2)) {
+        v1 = (((a0[1] ? a0[3] : v0) != (v3 / 9)) || ((v0 || 13) == (a1[2][13] <= a0[9])));
+        v3 = (((v1 != v0) && (20 <= a0[5])) * ((a0[15] == v1) <= (20 && a1[1][1])));
+        v0 = (((46 < v1) > (v1 ? 10 : 49)) || ((a0[6] < v0) ? (25 % 3) : (a1[3][13] ? v0 : v0)));
+    } else {
+        v0 = (((v1 % 1) % 8) ? ((v2 / 6) ? (43 ? a0[13] : v3) : (v1 && a0[12])) : ((v3 < a1[2][6]) && (v1 == v1)));
+        v3 = (((12 ? v0 : 44) - (67 ? 60 : 41)) * ((a0[4] ? v0 : 55) * (v1 > v0)));
+        v1 = (((a1[2][8] <= 75) || (v1 * a1[2][1])) > ((a0[11] && 67) && (v0 >= v3)));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((a0[14] * i4) - (53 || v2)) >= ((i4 >= v3) ? (a1[1][11] + v3) : (75 + a1[1][3])));
+        a0[2] = (((a0[10] && 37) < (i4 < v0)) && ((v3 == v3) || (31 == v0)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((63 != i4) / 1) * ((v1 || 90) || (v0 || i4)));
+                v0 = (((a0[4] < i4) ? (v3 + a0[5]) : (97 ? i4 : a0[5])) == ((59 < i4) - (81 < i5)));
+                v1 = (((43 != a0[12]) / 4) != ((v0 ? v3 : 19) ? (a1[0][1] <= v2) : (a0[0] - a0[4])));
+                i5 = i5 + 1;
+            } while (i5 < 2);
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            a0[4] = (((a0[8] >= v3) >= (50 - v3)) <= ((v3 % 2) ? (a1[3][8] ? a1[1][11] : v0) : (v3 + 6)));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((36 <= v0) > 70) break;
+                v1 = (((a1[3][15] <= 99) % 3) || ((76 ? a0[11] : v3) <= (i7 ? a1[3][4] : v3)));
+                v0 = (((15 ? i6 : 3) ? (43 ? a0[0] : 40) : (i6 ? v2 : 93)) % 3);
+                a0[10] = (((a1[1][6] ? v0 : 25) + (i6 <= i7)) != ((a0[13] > v0) && (a0[10] ? a1[2][7] : v0)));
+            }
+            v1 = (((9 < v2) < (v2 && v2)) - ((a1[1][4] && v2) % 7));
+            i6 = i6 + 1;
+        }
+    }
+    v1 = (((77 % 5) % 4) && ((a0[3] % 5) / 5));
+    return (((v1 == v2) / 6) != ((v1 || 60) && (v2 ? a1[1][4] : 33)));
+}
+int f34() {
+    int v0 = 6;
+    int v1 = 89;
+    int v2 = 87;
+    int v3 = 56;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((i1 == v3) % 5) < ((i1 % 3) != (v2 <= i0)));
+                    v1 = (((a1[3][4] >= v0) - (v2 % 8)) > ((62 + 23) * (89 > 18)));
+                    a1[0][13] = (((v2 == a0[4]) >= (87 ? a1[0][13] : i1)) != ((49 || v1) || (v1 ? a0[5] : v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v1 = (((v3 % 7) >= (i0 ? 12 : a0[14])) >= ((v3 <= a0[14]) != (v1 ? i0 : v1)));
+            v2 = (((i0 && v3) % 3) >= ((a0[4] * a0[14]) / 2));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    a1[2][5] = (((91 ? a0[9] : 18) >= (v0 >= v2)) < ((v0 != 97) != (32 * a0[0])));
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v0 || v0) || (a1[2][3] - a0[6])) % 3);
+            v3 = (((i2 != 47) - (66 == 89)) >= ((a0[9] || 83) <= (v0 <= a1[3][7])));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v2 = (((a0[14] != 26) && (v0 == a0[3])) || ((46 % 8) ? (a0[3] >= 14) : (v0 <= 41)));
+                v0 = (((v3 ? 69 : i3) || (80 ? v2 : v2)) >= ((a1[1][15] < i2) < (i2 ? i3 : a0[12])));
+                v2 = (((a1[3][13] / 9) >= (a1[3][6] <= i3)) <= ((36 != a1[2][9]) == (i3 + 60)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v3 = (((a1[3][11] - 6) - (89 >= 22)) != ((a1[0][0] != v0) <= (42 / 4)));
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v2 <= a0[14]) * (v0 * a0[9])) + ((v2 ? 11 : 29) || (a1[1][12] % 7)));
+            v3 = (((v3 / 5) || (43 % 1)) ? ((65 - a1[2][8]) < (v0 != v2)) : ((v1 < v1) == (a0[1] == 83)));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((i5 < i5) / 2) * ((v3 == v2) && (i4 > v1)));
+                    v0 = (((a1[0][4] ? 53 : a1[3][13]) * (i5 / 9)) + ((a1[1][10] + a0[9]) * (i4 > a1[0][11])));
+                    v0 = (((v2 >= 39) != (a1[2][6] * v0)) == ((a1[3][5] + a1[0][14]) * (95 % 8)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    v2 = (((a1[2][15] >= 18) && (a0[12] ? 0 : 6)) % 6);
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        if ((a1[1][11] > v2) > 62) break;
+        a1[2][15] = (((a1[1][8] || 8) - (48 >= a1[2][6])) > ((a0[14] ? a1[0][6] : v2) < (v1 / 3)));
+        {
+            int i7 = 0;
+            do {
+                a1[1][14] = (((v0 > v3) <= (i7 * 72)) / 6);
+                v2 = (((a1[1][10] <= 99) <= (a0[0] / 9)) >= ((i6 - v2) / 1));
+                v0 = (((v2 ? a0[4] : v3) || (i7 > a0[15])) / 8);
+                i7 = i7 + 1;
+            } while (i7 < 5);
+        }
+        v3 = (((a0[7] > v2) != (v1 * 27)) - ((a1[3][6] && 8) == (96 <= v1)));
+    }
+    v1 = (((a1[0][2] ? v3 : v3) ? (8 + v2) : (v2 % 6)) - ((a1[3][0] != v0) > (71 ? v3 : a0[9])));
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            while (i9 < 6) {
+                a0[14] = (((v3 ? a0[3] : v0) || (i8 - a0[5])) ? ((a1[1][2] <= a1[3][4]) || (v1 - i8)) : ((i9 > a1[2][0]) - (i8 % 6)));
+                a1[3][1] = (((v2 + i8) - (v2 ? v0 : v3)) == ((58 + v1) && (i8 || 86)));
+                a0[3] = (((48 >= v0) != (a0[3] ? v0 : v2)) / 1);
+                i9 = i9 + 1;
+            }
+        }
+        a0[0] = (((9 > 52) * (42 && 62)) && ((13 ? v3 : 7) == (v3 && v1)));
+        a1[1][0] = (((12 / 6) * (v3 % 1)) + ((a1[2][10] > 84) >= (a0[14] * v2)));
+    }
+    if ((((v1 >= a1[3][9]) == (a1[0][9] && v2)) <= ((v3 * v3) + (59 % 6)))) {
+        v1 = (((v0 && 60) == (5 != v3)) > ((v2 % 8) * (v1 * v3)));
+        v3 = (((v2 || v1) >= (a0[1] || v0)) % 5);
+        v2 = (((90 == v0) < (a1[0][12] % 5)) == ((a1[3][5] != v1) == (a0[4] - v0)));
+    } else {
+        a0[2] = (((v1 != a0[13]) ? (a1[0][2] >= a1[0][12]) : (83 == 26)) > ((v1 != v2) != (v0 > a0[3])));
+        v1 = (((a1[2][7] <= 17) <= (v3 - v1)) && ((v1 <= v3) <= (a1[3][11] == v0)));
+        a0[0] = (((v3 <= 39) ? (30 ? 14 : v0) : (59 + a1[1][1])) || ((74 >= v1) - (v3 > v0)));
+    }
+    return (((v3 + v1) <= (a0[4] * v0)) - ((v3 < v3) - (64 > 32)));
+}
+int f35() {
+    int v0 = 73;
+    int v1 = 92;
+    int v2 = 20;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a1[1][1] > v3) && (v1 != 36)) / 6);
+            a1[1][4] = (((a1[3][2] - 7) || (23 ? 32 : v3)) < ((v1 - v3) ? (v2 != v2) : (78 % 8)));
+            {
+                int i1 = 0;
+                do {
+                    a0[11] = (((42 || 15) ? (v2 <= i1) : (a0[13] * i0)) * ((a0[10] || v3) >= (v0 && 35)));
+                    v0 = (((v3 != v1) <= (i0 || 85)) % 3);
+                    v1 = (((v1 > v0) <= (a0[15] ? v3 : i1)) > ((a0[6] ? a0[2] : 20) ? (91 / 7) : (a0[4] > v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a1[3][3] - a1[3][11]) && (v3 && v1)) >= ((63 >= 69) ? (i2 == v1) : (v1 * 23)));
+            a0[0] = (((v0 && v3) * (a1[2][12] <= 55)) >= ((v1 < v2) > (v0 ? 39 : i2)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((v3 || 30) != (v0 >= 36)) == ((v3 > v0) ? (v2 % 4) : (52 / 4)));
+                a1[1][7] = (((99 > i3) > (v3 % 7)) / 7);
+                a1[3][1] = (((a1[1][9] ? 47 : 31) > (i3 < a1[1][11])) || ((13 > a0[12]) ? (a1[0][3] <= v2) : (15 == a0[7])));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            if ((i4 && 22) > 52) break;
+            v2 = (((v3 ? v2 : 3) || (87 % 6)) < ((a1[1][14] || v2) < (v2 == a0[1])));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v2 = (((v2 && a1[1][4]) / 2) * ((a1[1][0] == 17) <= (a0[7] ? 86 : v3)));
+                    v1 = (((i5 * 36) <= (75 + a1[1][11])) && ((i5 > a1[3][15]) / 3));
+                    v3 = (((18 <= i4) || (a0[6] ? a1[3][14] : a1[3][11])) * ((87 || v3) ? (25 > 19) : (a1[3][1] - a0[3])));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[4] = (((v0 < 40) || (a1[1][11] < v1)) / 7);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            v1 = (((v1 > 91) ? (a0[4] - v0) : (a0[6] > a1[0][5])) % 5);
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    a0[12] = (((i6 > a0[7]) || (a1[2][13] - 90)) * ((v0 == 64) || (24 * v0)));
+                    v1 = (((86 - a0[9]) && (a1[1][5] != a1[0][9])) ? ((a0[14] - a1[3][13]) / 3) : ((v3 > 16) + (80 + a0[9])));
+                    v2 = (((a0[11] < v2) || (a0[12] % 3)) % 3);
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((64 < v0) - (v0 >= v0)) < ((v1 || a0[7]) >= (v0 > 83)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[3][8] = (((v2 + v2) + (i8 ? i8 : v3)) <= ((v2 == v3) + (75 > a0[10])));
+            v2 = (((v2 >= v0) - (v3 || v1)) ? ((v3 ? v2 : v1) / 8) : ((4 + 74) - (10 + a0[15])));
+            for (int i9 = 0; i9 < 3; i9 = i9 + 1) {
+                v3 = (((20 + 12) * (a1[1][4] && a1[2][14])) == ((v2 ? v3 : 38) && (i8 ? v1 : 49)));
+                v0 = (((a1[0][1] - 61) && (59 * v0)) && ((a1[1][1] && v3) / 2));
+                v2 = (((i8 ? v3 : v0) && (v1 % 2)) != ((i9 / 6) >= (i9 * v1)));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    v0 = (((32 ? v0 : v3) < (15 - v3)) > ((v0 > a1[2][12]) ? (v0 ? a1[2][9] : a0[11]) : (v1 + 85)));
+    {
+        int i10 = 0;
+        while (i10 < 2) {
+            for (int i11 = 0; i11 < 2; i11 = i11 + 1) {
+                a0[10] = (((i10 + v3) / 9) / 4);
+                v0 = (((a1[1][15] < v2) == (v0 > a0[9])) * ((a1[3][4] > v3) == (a1[1][5] <= v3)));
+                v0 = (((a0[13] / 3) % 4) * ((59 / 7) - (3 ? v3 : a0[10])));
+            }
+            a0[4] = (((6 <= i10) * (a1[3][15] || i10)) + ((86 <= i10) - (v2 <= i10)));
+            a0[4] = (((98 % 7) < (i10 >= v0)) != ((a1[1][10] < a1[3][5]) ? (a1[3][13] != a0[4]) : (a0[9] ? i10 : v2)));
+            i10 = i10 + 1;
+        }
+    }
+    v0 = (((v2 <= 31) * (v0 <= v1)) && ((v1 - a1[1][7]) / 7));
+    v0 = (((55 > v0) - (v0 + a0[11])) && ((v2 <= 46) % 2));
+    if ((((v1 || v1) - (v0 <= v3)) <= ((80 - a1[2][3]) ? (74 + v0) : (v3 / 5)))) {
+        a0[12] = (((v1 != v0) || (v1 + v0)) - ((v1 % 5) / 6));
+        v2 = (((v2 % 6) || (v2 > v2)) * ((v0 + a1[3][4]) % 3));
+        v1 = (((v0 / 3) == (a0[11] < v3)) == ((v1 ? a1[3][2] : v0) && (v1 * v3)));
+    } else {
+        a0[7] = (((v1 < a0[2]) == (v0 / 8)) - ((49 != 99) % 2));
+        v0 = (((a0[9] % 6) < (v0 || a0[6])) > ((47 || 60) && (a1[1][8] + 63)));
+        v2 = (((v3 == 78) >= (v0 - 20)) / 3);
+    }
+    return (((v0 * v1) || (v2 < v2)) ? ((21 != a0[6]) != (v1 <= a0[4])) : ((86 >= a0[10]) >= (49 && 82)));
+}
+int f36() {
+    int v0 = 41;
+    int v1 = 68;
+    int v2 = 84;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    if ((((29 ? v3 : a0[0]) > (16 - v3)) ? ((a1[0][11] >= a0[7]) ? (a1[0][1] ? v0 : v0) : (68 <= 54)) : ((a0[7] + v1) % 4))) {
+        v3 = (((a0[2] == v1) < (a1[2][11] % 3)) < ((v3 == v0) % 1));
+        v0 = (((95 <= v3) && (a0[11] <= v3)) % 5);
+        a0[12] = (((v1 != 73) + (a0[2] ? v1 : v0)) % 1);
+    } else {
+        a0[14] = (((a0[9] > 55) / 2) == ((17 + a1[0][15]) != (v0 != v0)));
+        v0 = (((43 != v2) - (64 % 6)) <= ((v2 + a0[13]) % 5));
+        v1 = (((a1[3][14] >= a0[11]) || (v3 - v0)) ? ((v0 || v1) % 5) : ((v2 != 66) || (v0 != 69)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v2 = (((v0 || v3) + (0 != v0)) != ((66 - v1) ? (a0[0] || v0) : (15 == 36)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                v3 = (((v0 == v2) != (20 <= v0)) * ((71 == a1[2][14]) ? (98 + i0) : (i0 || a0[1])));
+                v2 = (((v1 / 4) * (v2 + i1)) || ((v0 <= v1) / 4));
+                v2 = (((v3 ? 87 : v3) ? (84 / 9) : (2 ? i1 : v2)) || ((a0[12] + 14) ? (a1[0][7] != a1[1][2]) : (a0[6] * 24)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((99 || 89) - (11 >= 57)) || ((v0 != a0[12]) + (a0[11] && a0[8])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v0 = (((i2 != v3) / 2) % 3);
+            v2 = (((i2 > 29) != (a1[1][15] > 30)) / 5);
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a0[8] = (((15 <= a0[12]) && (a1[3][10] + a0[11])) >= ((a0[11] && i3) + (a1[3][9] || v0)));
+                    v1 = (((v0 ? v2 : v3) / 1) && ((75 != a0[5]) == (v1 % 1)));
+                    v2 = (((i2 / 1) + (a0[15] - a0[0])) != ((v2 > 61) || (v2 || v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    a0[15] = (((v2 || a1[0][2]) != (67 < 25)) % 6);
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    a1[1][5] = (((75 > a0[11]) <= (86 + 17)) ? ((i5 + v0) < (v3 > v1)) : ((v3 + v1) < (17 <= a0[15])));
+                    a0[14] = (((74 || 39) ? (v1 || v2) : (v1 || i4)) != ((8 / 3) % 2));
+                    v0 = (((a1[0][6] - 54) > (40 == i4)) < ((v2 || 28) > (v1 + a0[3])));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[2] = (((a1[0][15] && v3) >= (v0 + i4)) && ((81 ? v1 : 45) % 1));
+            v1 = (((a0[11] - v1) ? (8 < v3) : (76 >= a0[7])) + ((67 ? v3 : a1[0][15]) - (a1[3][5] && a1[2][9])));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                if ((61 && 55) > 67) break;
+                a0[4] = (((i7 == 45) ? (v2 + v0) : (a0[1] < i7)) && ((a0[4] * a0[0]) && (43 ? i6 : v2)));
+                a0[8] = (((21 % 3) <= (v3 && v2)) ? ((a0[4] * v0) > (3 - 90)) : ((10 <= 29) >= (72 + a1[3][14])));
+                a1[2][12] = (((v3 / 4) <= (v2 >= a0[5])) == ((a0[11] ? 42 : a0[8]) <= (v2 / 5)));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+        v3 = (((v0 / 9) != (v1 % 6)) != ((49 >= 4) != (v1 <= 69)));
+        v2 = (((a0[10] > 48) ? (v3 - v3) : (20 <= i6)) >= ((a1[3][0] + v3) || (60 > a1[2][14])));
+    }
+    if ((((v0 <= v1) * (a0[14] % 8)) != ((a0[10] ? v1 : 42) < (a0[3] < a0[12])))) {
+        a0[9] = (((v0 * a0[7]) || (v1 <= a1[0][11])) % 8);
+        v3 = (((v3 ? 53 : v1) % 8) ? ((v0 && v1) <= (45 ? v3 : 87)) : ((v0 || a0[1]) == (14 + v1)));
+        v3 = (((v3 == a0[13]) == (a1[2][14] / 8)) - ((v0 > 43) > (a1[2][5] <= v1)));
+    } else {
+        v2 = (((14 % 2) < (a0[6] != a1[0][0])) != ((v2 - v0) ? (v2 >= v3) : (a0[7] && v3)));
+        v2 = (((a0[8] <= a0[12]) < (v3 - a0[2])) <= ((a0[1] <= a1[3][14]) <= (86 * v2)));
+        a0[2] = (((46 % 5) + (a0[14] < v3)) || ((v0 ? a1[1][13] : a1[1][12]) / 1));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+                v0 = (((a0[1] >= 15) + (v1 <= i8)) ? ((v0 - 80) <= (a0[10] * 36)) : ((a0[11] > v1) == (62 ? v1 : v2)));
+                v0 = (((v2 - 4) % 4) ? ((18 ? 48 : 94) % 6) : ((9 || a1[1][8]) / 9));
+                v3 = (((v3 && 16) != (v2 ? 90 : a0[11])) ? ((v0 + a0[14]) >= (a0[9] > v1)) : ((v3 % 1) * (2 + v2)));
+            }
+            v0 = (((83 / 8) < (v1 - v3)) / 8);
+            a0[2] = (((v2 || a1[2][14]) && (17 < v1)) - ((93 / 2) < (v0 >= 94)));
+            i8 = i8 + 1;
+        }
+    }
+    v1 = (((a0[14] != v0) <= (v0 ? 98 : v3)) * ((a0[8] >= v3) >= (v3 != v3)));
+    if ((((42 / 4) / 5) % 5)) {
+        v1 = (((v2 - a0[11]) - (a0[5] ? 13 : 6)) % 5);
+        a1[3][9] = (((v2 % 9) ? (v1 == 6) : (91 > a1[1][7])) - ((3 != v1) / 8));
+        v0 = (((76 % 8) ? (a1[2][2] + v0) : (v0 / 6)) ? ((21 <= a1[3][6]) + (v1 == a0[11])) : ((a0[8] <= 59) % 8));
+    } else {
+        v2 = (((v2 == 78) % 9) || ((v3 % 2) % 7));
+        v0 = (((v2 / 4) >= (v1 / 4)) >= ((11 % 6) && (v0 * v2)));
+        v3 = (((v1 >= v0) <= (v2 > 32)) >= ((v2 && 83) * (30 && v3)));
+    }
+    return (((v1 < v0) != (a0[8] && v1)) / 4);
+}
+int f37() {
+    int v0 = 46;
+    int v1 = 83;
+    int v2 = 64;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 / 7) - (v2 + a1[0][8])) % 5);
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[0][1] = (((a1[0][15] ? i0 : 5) && (a0[4] + 44)) >= ((35 <= 42) != (34 % 2)));
+            v3 = (((a0[10] > a0[7]) > (v3 ? a1[0][5] : v3)) >= ((a1[3][13] + v3) < (a0[14] >= a0[4])));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((a0[9] / 2) >= (a1[1][10] + a0[7])) ? ((a0[5] && v0) == (v1 == i1)) : ((33 > v1) != (a1[2][10] > a1[1][0])));
+                    a0[9] = (((28 + i1) && (89 - i1)) || ((v0 * v1) % 6));
+                    v1 = (((v2 / 2) % 1) ? ((i0 >= i0) <= (a1[1][7] / 3)) : ((a1[3][10] == i1) >= (i0 - 25)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    if ((v0 != 76) > 70) break;
+                    v1 = (((2 > 28) || (v2 && a1[2][8])) - ((a0[6] > 45) - (a0[2] ? v0 : v1)));
+                    a1[0][11] = (((v0 || 67) <= (v2 || a0[5])) / 7);
+                    v1 = (((v0 ? i3 : i2) == (61 != v1)) == ((a0[1] * v0) / 9));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v2 / 2) == (a1[3][1] % 2)) * ((v3 || v3) > (a1[0][4] < 15)));
+            v2 = (((v1 < a0[5]) ? (a1[0][9] + a0[14]) : (10 + i2)) > ((v0 % 2) == (23 < v1)));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((a1[2][3] != 7) <= (v2 != v3)) || ((a0[14] >= a1[1][3]) * (v0 + v3)));
+    v1 = (((v2 ? v1 : 81) <= (v3 < v1)) / 1);
+    if ((((a0[5] == v3) >= (a1[0][11] != a0[7])) && ((a0[11] < a0[0]) * (v3 + a1[0][13])))) {
+        v0 = (((a0[7] ? v3 : v1) > (v3 != 79)) && ((v0 || v2) == (62 + 54)));
+        v0 = (((v3 + a0[4]) >= (92 >= a1[1][1])) < ((v0 % 6) || (a1[1][5] >= a1[2][5])));
+        v0 = (((v1 < v0) <= (a0[2] + 90)) && ((v1 + v3) - (78 ? v1 : a0[5])));
+    } else {
+        v3 = (((v3 != v3) <= (v3 && 94)) || ((a0[15] && 63) != (v1 * 25)));
+        v1 = (((a1[0][6] / 7) / 2) / 8);
+        a0[3] = (((v3 * v1) < (a0[6] > a0[9])) - ((55 <= 98) >= (93 > 7)));
+    }
+    v3 = (((v3 / 6) || (a1[3][8] + 24)) != ((79 / 6) && (34 >= a0[11])));
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v1 = (((90 / 6) - (94 - 44)) ? ((97 > 86) * (i4 * a1[1][11])) : ((a1[2][14] <= 98) + (v0 - i4)));
+            v3 = (((v2 < 21) >= (v1 != v3)) == ((47 < 68) + (v1 * v3)));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    if ((79 < a1[2][13]) > 86) break;
+                    v0 = (((v2 > i4) - (v1 * 19)) == ((82 ? a0[12] : v3) ? (v3 < 33) : (v1 - i5)));
+                    v1 = (((v2 != 77) == (a1[1][6] >= a0[10])) ? ((79 * v3) % 1) : ((4 != 92) <= (39 % 3)));
+                    v2 = (((v1 - v3) ? (41 == v1) : (v2 >= v0)) * ((v3 - a0[10]) && (v3 < a0[5])));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[8] + v2) + (v2 / 7)) + ((v3 && v1) < (a1[2][14] != v2)))) {
+        v0 = (((80 - a0[6]) < (v2 < a1[1][0])) && ((v1 <= v0) ? (44 != a1[2][13]) : (a0[15] - 23)));
+        a1[3][8] = (((68 && v2) || (v1 == v3)) && ((v1 < v1) == (a1[3][4] ? a0[0] : v0)));
+        a1[3][10] = (((88 > v2) % 2) > ((v0 + v3) == (v1 != a0[14])));
+    } else {
+        v0 = (((48 <= 6) % 4) == ((a0[11] < 30) < (v0 || a0[1])));
+        v3 = (((26 <= v3) > (v2 ? v3 : a1[0][1])) != ((90 < 66) < (v1 > v3)));
+        a1[3][12] = (((v1 && v2) != (v1 >= v0)) < ((a1[1][0] && v1) == (a1[3][3] || 19)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((v3 != 12) > 89) break;
+            a1[1][10] = (((v2 > i6) <= (v1 != 28)) == ((a1[2][4] >= v0) > (v3 && i6)));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((a1[0][15] + a0[9]) || (a0[8] > 37)) / 7);
+                    a1[1][15] = (((i6 % 8) < (i7 ? a0[3] : 57)) || ((v3 <= v0) && (v2 != i7)));
+                    v1 = (((95 && a1[2][1]) == (a1[0][1] && v1)) == ((20 >= v3) > (5 < v0)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            a1[2][7] = (((45 - 57) != (a0[9] ? v1 : v2)) / 7);
+            i6 = i6 + 1;
+        }
+    }
+    return (((v1 - v3) == (8 >= a0[4])) ? ((a0[4] == 38) >= (63 % 4)) : ((v0 || a1[2][14]) + (a1[1][14] <= 89)));
+}
+int f38() {
+    int v0 = 57;
+    int v1 = 47;
+    int v2 = 91;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((v0 ? 31 : i0) > 82) break;
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                if ((i1 % 4) > 77) break;
+                v3 = (((a1[3][15] + 53) == (13 % 2)) ? ((90 == a1[1][2]) * (i1 / 2)) : ((v3 >= v0) != (i0 >= a0[7])));
+                v3 = (((a0[5] / 5) / 7) / 7);
+                v1 = (((77 * i0) && (a0[15] + 23)) ? ((71 > 94) ? (a0[7] ? 1 : v1) : (39 / 6)) : ((v1 % 1) || (i1 % 2)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((a0[2] % 7) != (a0[11] - v2)) <= ((23 + 58) > (a0[5] + a0[6])));
+        v3 = (((v2 / 3) ? (i0 || i0) : (a0[0] > v2)) > ((v3 >= v0) <= (v3 != v3)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            a1[2][7] = (((v0 ? a1[0][7] : i2) >= (75 != 53)) * ((v1 || a0[10]) % 1));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((v1 - 26) * (15 - 52)) + ((a1[0][12] - v0) || (i3 && a1[2][8])));
+                    a0[0] = (((a0[8] + i2) > (30 % 6)) ? ((a1[0][15] && v2) - (a0[0] || v2)) : ((v0 % 2) >= (v1 * i3)));
+                    v1 = (((90 == 60) != (18 || a1[0][0])) || ((96 % 6) != (a0[10] - a0[8])));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v3 = (((i2 % 4) != (v2 && v2)) + ((12 != 75) && (9 % 5)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v1 = (((a1[0][1] + 98) ? (v2 != a1[1][1]) : (v2 && a1[0][1])) / 2);
+        {
+            int i5 = 0;
+            do {
+                v3 = (((a0[6] >= v2) / 9) ? ((i4 * a0[2]) * (v3 ? v3 : i5)) : ((v1 != v3) != (i5 < v1)));
+                a0[6] = (((16 / 3) < (75 / 2)) <= ((i4 <= 67) >= (i4 * 16)));
+                v1 = (((v1 == a0[11]) < (84 ? v0 : 21)) == ((77 - a1[3][6]) > (i4 <= a1[0][4])));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        v1 = (((a1[3][5] && a0[12]) > (a1[3][3] ? a0[10] : 50)) >= ((82 == a0[1]) >= (v1 != 79)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v2 - i6) > 58) break;
+            a1[2][6] = (((a1[2][1] / 2) / 5) && ((a0[0] && a1[3][10]) == (i6 < v1)));
+            a0[12] = (((i6 * v2) != (9 - 76)) && ((a0[10] < 71) - (v2 >= i6)));
+            {
+                int i7 = 0;
+                do {
+                    if ((39 - 7) > 67) break;
+                    a0[0] = (((v2 < a1[0][4]) == (v1 ? v1 : i6)) * ((v1 * i7) || (71 ? v0 : i6)));
+                    v1 = (((16 && a0[1]) % 7) <= ((v2 * v2) >= (a1[2][9] > v1)));
+                    a1[0][14] = (((a0[0] < i6) || (a1[2][12] != v0)) * ((87 <= 39) >= (44 <= 29)));
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            if ((v1 && v3) > 92) break;
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                a1[1][1] = (((v3 || a1[0][11]) || (86 < a1[1][7])) <= ((a0[10] - v0) == (63 < i8)));
+                v0 = (((v3 / 1) && (93 / 7)) && ((a1[2][11] - 69) || (v0 != i8)));
+                v1 = (((13 || i8) != (i8 == 51)) < ((53 && 17) ? (80 / 3) : (21 ? 36 : v0)));
+            }
+            v2 = (((63 == v2) != (i8 + a1[2][5])) ? ((v1 + 46) % 6) : ((43 ? v1 : a0[5]) || (v3 * i8)));
+            a1[1][2] = (((v3 / 7) ? (a1[1][8] < v1) : (i8 + a1[3][10])) != ((a1[1][6] >= a1[3][3]) > (a0[11] ? v3 : i8)));
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        do {
+            a1[2][1] = (((16 > v3) - (a1[3][5] < v1)) % 5);
+            {
+                int i11 = 0;
+                while (i11 < 7) {
+                    if ((61 && a0[11]) > 64) break;
+                    v3 = (((v1 % 4) <= (17 && 52)) && ((i11 - v0) * (a0[10] + v3)));
+                    v1 = (((a1[2][4] - i11) % 7) >= ((80 - a1[0][15]) * (83 / 8)));
+                    v0 = (((v1 == v1) && (v2 ? v3 : i10)) <= ((a1[1][0] - v2) < (v0 * a0[3])));
+                    i11 = i11 + 1;
+                }
+            }
+            a1[0][15] = (((v0 < 43) ? (72 < a1[0][11]) : (a0[9] ? v2 : v3)) / 8);
+            i10 = i10 + 1;
+        } while (i10 < 6);
+    }
+    for (int i12 = 0; i12 < 6; i12 = i12 + 1) {
+        v0 = (((v0 >= v2) ? (26 > i12) : (v0 / 2)) && ((v1 - v3) < (80 < 89)));
+        {
+            int i13 = 0;
+            do {
+                v3 = (((i13 * 30) - (a1[2][8] || v0)) != ((v3 / 9) > (95 || v2)));
+                a1[3][12] = (((v2 != 93) || (52 + a0[2])) % 4);
+                v3 = (((v0 - a0[3]) / 5) > ((a1[0][0] == 30) > (i13 * v1)));
+                i13 = i13 + 1;
+            } while (i13 < 6);
+        }
+        v2 = (((a1[3][14] - v1) >= (v1 / 3)) ? ((a1[1][4] - i12) * (v2 >= i12)) : ((v2 >= 0) * (v0 >= 17)));
+    }
+    a0[5] = (((31 == v2) + (v1 / 6)) - ((a0[12] - v0) && (a0[1] % 7)));
+    {
+        int i14 = 0;
+        do {
+            if ((v0 + v2) > 71) break;
+            {
+                int i15 = 0;
+                while (i15 < 4) {
+                    v3 = (((i15 ? 37 : a1[3][1]) % 1) >= ((a0[15] / 2) < (v1 > 1)));
+                    v0 = (((i14 || v0) - (v2 != v0)) ? ((38 == i15) / 3) : ((i14 != a0[5]) + (i14 != i14)));
+                    v2 = (((v1 >= 54) % 4) ? ((55 <= v3) <= (v2 ? i15 : 30)) : ((v2 + i15) && (99 > 14)));
+                    i15 = i15 + 1;
+                }
+            }
+            v3 = (((v2 - v3) <= (a0[2] != v2)) && ((v1 % 2) - (i14 >= a1[0][2])));
+            a0[7] = (((i14 && v0) + (i14 % 4)) && ((v3 * 99) ? (v2 + v0) : (i14 < a0[2])));
+            i14 = i14 + 1;
+        } while (i14 < 8);
+    }
+    if ((((v0 == 37) >= (a0[7] / 5)) >= ((a0[10] < a1[3][12]) != (97 != v1)))) {
+        a1[1][14] = (((v2 < v2) <= (v1 || v2)) <= ((v0 || v1) / 7));
+        v1 = (((v2 || v3) <= (10 <= 87)) * ((a1[1][5] && v2) - (a0[7] ? 50 : v2)));
+        v1 = (((v2 || v0) == (40 || 78)) ? ((56 % 3) == (v0 ? v0 : v1)) : ((v1 + v1) >= (18 == 14)));
+    } else {
+        a1[0][1] = (((a1[2][5] - v1) <= (a0[10] + v1)) == ((22 != a0[12]) - (a0[0] < v0)));
+        a0[6] = (((a0[2] % 3) && (a1[1][15] && v3)) < ((v3 % 8) ? (a1[1][6] || a1[1][1]) : (a1[3][12] > v2)));
+        v3 = (((a1[0][9] / 9) && (39 > a1[3][0])) == ((v1 == a1[3][1]) <= (v2 >= a1[2][7])));
+    }
+    return (((v3 < v1) != (a0[7] % 8)) || ((11 && v1) ? (a0[6] < a1[1][6]) : (a1[0][7] + a0[4])));
+}
+int f39() {
+    int v0 = 22;
+    int v1 = 92;
+    int v2 = 50;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 - 60) && (a1[2][1] == 12)) * ((v3 && a1[3][7]) || (v2 != v3)));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((a1[2][2] + 68) < (57 + v2)) - ((i0 >= i0) && (32 && 87)));
+        v3 = (((a1[2][15] >= 5) != (v0 >= v1)) >= ((v3 ? a0[12] : 83) || (a0[14] > a0[11])));
+        {
+            int i1 = 0;
+            do {
+                if ((i0 + a1[1][4]) > 76) break;
+                v0 = (((27 / 8) ? (a1[3][1] == v2) : (v3 < v0)) == ((v0 <= a1[1][5]) > (38 ? i1 : v1)));
+                v1 = (((i1 > v3) / 3) == ((i0 > v0) > (41 && v3)));
+                v1 = (((a0[9] >= 39) && (v0 >= a1[3][2])) + ((a0[8] != a0[6]) % 5));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+    }
+    v2 = (((v1 + 57) || (v3 ? v3 : v3)) < ((v3 / 1) < (62 + 66)));
+    if ((((a0[9] || a0[2]) * (v1 && v3)) <= ((a1[0][9] && 69) - (a1[3][7] + v1)))) {
+        v3 = (((8 != v2) >= (52 >= a1[3][13])) * ((v2 != v2) ? (95 || v2) : (66 && v0)));
+        a0[14] = (((95 + a0[15]) - (v1 ? 30 : v0)) <= ((3 * 84) - (v2 ? a0[5] : v1)));
+        a1[3][10] = (((59 < v0) < (v1 / 3)) == ((0 - v3) ? (97 % 4) : (v3 + 1)));
+    } else {
+        v0 = (((a0[13] - a1[0][0]) % 1) != ((a0[7] % 1) > (a0[9] + 88)));
+        v1 = (((v2 * a0[2]) ? (28 * v1) : (v0 || a1[3][7])) ? ((a0[9] == a1[0][2]) > (v3 < 8)) : ((v3 >= 11) > (v3 == v0)));
+        v0 = (((v1 - 52) + (77 <= v0)) < ((91 > v3) >= (35 <= v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a0[3] = (((v3 == v2) * (a1[3][9] / 5)) != ((i2 - v2) * (a1[3][8] <= v0)));
+            v3 = (((v0 || v2) <= (a0[11] != v3)) >= ((i2 == v1) == (a0[13] ? v3 : v1)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    a1[0][0] = (((a0[2] <= i3) && (67 != v1)) && ((v2 * 18) - (9 || v2)));
+                    v3 = (((i2 <= 71) == (77 - v1)) <= ((v2 - 18) >= (i3 * a0[13])));
+                    v1 = (((v3 % 5) % 4) ? ((34 ? a0[7] : a0[11]) > (i3 == i2)) : ((30 && 91) != (a0[8] / 3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((a1[3][1] / 6) > (a1[0][11] - a1[2][9])) + ((a1[2][10] <= v3) % 8));
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            if ((a0[0] || 0) > 53) break;
+            v0 = (((v2 != 69) / 2) || ((71 < a1[0][8]) / 1));
+            v3 = (((a1[1][5] % 1) < (v1 >= a1[3][4])) == ((59 + v0) % 4));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v1 = (((a1[0][8] > a1[2][3]) != (v0 + v1)) == ((v3 % 2) / 3));
+                a0[1] = (((v2 * a1[2][5]) / 4) % 4);
+                a1[2][13] = (((21 != i5) <= (27 + i5)) + ((v3 ? v0 : v2) ? (v2 >= v1) : (v0 - 13)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((v2 == v2) || (v3 ? a1[3][4] : 84)) ? ((v1 < v1) || (36 / 2)) : ((a1[2][4] < 76) - (57 != v1)));
+    if ((((v2 != v0) != (v1 ? v0 : 12)) < ((81 < v3) * (a1[0][15] >= v1)))) {
+        a1[3][3] = (((2 <= v3) >= (a0[9] > 2)) < ((a0[6] != v2) && (59 || v1)));
+        v0 = (((v2 + v3) > (a0[10] / 1)) % 2);
+        v3 = (((v0 && a0[5]) + (v0 >= a0[15])) ? ((v0 && 57) > (v3 < v2)) : ((v1 ? v0 : v0) ? (v3 % 5) : (a0[7] && v1)));
+    } else {
+        v1 = (((v1 - v2) != (a1[3][13] != v0)) / 7);
+        a1[0][2] = (((19 / 7) != (a0[0] + 76)) / 2);
+        v1 = (((v3 ? a0[1] : v0) + (v0 ? a1[2][4] : v3)) * ((v0 ? a0[2] : v3) ? (58 > a1[1][5]) : (v3 - a0[13])));
+    }
+    v3 = (((23 || 41) && (a0[3] != a0[0])) < ((v3 >= v0) == (a1[2][1] + v3)));
+    return (((v3 - a0[7]) || (a0[0] < a0[2])) > ((a0[5] * a1[0][7]) / 5));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    s = s + f4();
+    s = s + f5();
+    s = s + f6();
+    s = s + f7();
+    s = s + f8();
+    s = s + f9();
+    s = s + f10();
+    s = s + f11();
+    s = s + f12();
+    s = s + f13();
+    s = s + f14();
+    s = s + f15();
+    s = s + f16();
+    s = s + f17();
+    s = s + f18();
+    s = s + f19();
+    s = s + f20();
+    s = s + f21();
+    s = s + f22();
+    s = s + f23();
+    s = s + f24();
+    s = s + f25();
+    s = s + f26();
+    s = s + f27();
+    s = s + f28();
+    s = s + f29();
+    s = s + f30();
+    s = s + f31();
+    s = s + f32();
+    s = s + f33();
+    s = s + f34();
+    s = s + f35();
+    s = s + f36();
+    s = s + f37();
+    s = s + f38();
+    s = s + f39();
+    return s;
+}
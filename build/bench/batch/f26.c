@@ -0,0 +1,316 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 44;
+    int v2 = 4;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a0[15] >= i0) > 97) break;
+        v0 = (((v3 + i0) / 3) == ((9 != v2) > (i0 || i0)));
+        v2 = (((i0 || v1) < (a0[7] == 57)) > ((a1[0][4] ? 0 : v2) <= (v0 < i0)));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a0[13] != v2) >= (v3 && v1)) ? ((11 < a0[4]) * (42 > a0[0])) : ((a1[0][5] > a0[3]) <= (i1 - a0[7])));
+                v1 = (((v1 > a1[2][14]) + (i0 > i1)) && ((v3 + v3) / 8));
+                v1 = (((v0 == 76) == (v3 || 51)) % 6);
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    v1 = (((v2 != a1[0][14]) / 2) ? ((v1 || 73) / 8) : ((v0 <= v0) > (a0[4] > a1[1][3])));
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 && i2) == (v3 % 5)) % 1);
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((a1[1][14] + a0[15]) > 96) break;
+                v1 = (((a0[14] ? a0[7] : 45) + (a1[3][5] == i2)) <= ((a1[2][2] - v0) >= (v2 < i2)));
+                v0 = (((v0 % 2) == (a0[8] % 9)) ? ((a0[6] < a0[4]) + (a0[7] <= a0[5])) : ((97 % 4) > (v2 <= a1[1][6])));
+                v0 = (((10 && 92) * (14 || a0[8])) - ((a0[5] <= a1[2][0]) < (v3 / 1)));
+            }
+            v0 = (((17 > i2) <= (v3 <= 85)) - ((85 > a0[12]) > (a0[6] < 51)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((v2 == v2) * (11 - v1)) < ((a1[3][10] >= a0[7]) && (v0 == a1[0][7])))) {
+        a0[8] = (((34 != 70) || (a0[7] / 9)) < ((v1 * v0) <= (a1[0][9] != v3)));
+        v3 = (((9 != v3) <= (v0 / 2)) == ((v0 != a0[5]) % 1));
+        v1 = (((v2 ? v2 : 18) <= (v0 || v1)) <= ((67 / 2) / 5));
+    } else {
+        v0 = (((v3 - 31) % 4) < ((a1[2][8] * v3) == (a1[3][13] && v1)));
+        v3 = (((70 > a1[3][4]) || (32 != v0)) * ((v0 || 67) != (v2 / 8)));
+        v1 = (((64 ? v3 : v2) >= (v1 - v0)) || ((a0[13] <= a0[9]) == (v2 < v2)));
+    }
+    if ((((v0 ? v1 : a0[0]) % 8) && ((v0 != 45) + (v3 != v2)))) {
+        v0 = (((v1 || v0) >= (a0[5] * v2)) * ((v2 < v0) / 8));
+        v0 = (((v2 < a1[1][15]) ? (v3 && a1[1][3]) : (v0 ? v1 : a0[13])) && ((v2 != v1) && (77 % 4)));
+        a0[15] = (((87 > v3) >= (a1[0][1] > a1[2][14])) == ((v0 / 1) > (v0 && a0[6])));
+    } else {
+        v3 = (((54 * v3) ? (a0[2] + 80) : (51 ? 23 : v2)) * ((v2 < v3) && (a1[0][10] == v3)));
+        v3 = (((a0[8] % 6) > (v3 * v1)) || ((57 && v1) - (26 ? v1 : v2)));
+        v2 = (((v1 >= a0[7]) + (v2 + v3)) <= ((a0[2] ? v2 : 10) >= (v3 % 6)));
+    }
+    if ((((23 ? 47 : 1) / 9) - ((74 > v1) + (a1[3][8] * v1)))) {
+        v3 = (((4 == 20) > (v1 % 8)) > ((91 <= a1[0][8]) == (v2 ? v0 : v2)));
+        a1[1][5] = (((v2 && 38) > (v0 < 89)) > ((40 - 17) > (v3 || 11)));
+        a0[14] = (((v3 == v2) || (a0[12] < v1)) ? ((v1 ? a0[8] : 61) ? (8 || 46) : (v3 < v0)) : ((v2 >= v3) % 2));
+    } else {
+        v3 = (((37 > v3) == (a1[0][6] - a1[0][11])) > ((a0[10] != v2) + (v1 != 15)));
+        v3 = (((v2 ? v0 : 88) != (v2 * 78)) * ((a1[0][2] <= 56) < (a1[1][13] + a1[2][13])));
+        v1 = (((v3 > v1) && (40 ? 95 : 43)) && ((v3 || a0[10]) == (a0[6] <= v0)));
+    }
+    a0[4] = (((v1 >= 60) * (41 && v3)) % 3);
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v1 = (((a0[7] / 5) > (28 != v3)) == ((a0[12] != v1) == (11 / 7)));
+            v3 = (((v1 > i4) * (v0 || a1[0][8])) / 8);
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v2 = (((a0[12] == v3) || (v1 || a1[2][15])) ? ((a1[3][8] >= 22) > (a0[0] != v3)) : ((a0[11] / 6) != (v0 > v2)));
+                v3 = (((51 || v2) - (91 < v3)) && ((v0 == a0[3]) == (a0[5] - 9)));
+                a0[1] = (((22 == v1) * (a1[3][3] * i5)) / 4);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 ? 80 : v2) != (a1[3][3] + v3)) && ((v0 && 6) / 1))) {
+        v2 = (((a0[8] > 55) ? (v0 - 48) : (v3 != a1[1][15])) && ((27 == v3) ? (39 / 6) : (v1 || v2)));
+        v3 = (((a0[6] < a0[3]) <= (a1[1][10] < v1)) <= ((6 * a1[3][7]) ? (52 ? v0 : v3) : (v0 * 70)));
+        v3 = (((v1 != a0[11]) == (v1 && 94)) - ((a1[1][10] != a1[3][9]) * (v0 <= v1)));
+    } else {
+        a0[4] = (((23 ? v2 : v3) + (35 < 20)) || ((v2 + 43) == (a1[1][8] > v0)));
+        a0[12] = (((a1[2][0] >= 11) <= (v1 && 37)) || ((a1[0][3] ? v2 : 48) || (90 / 6)));
+        a1[1][12] = (((a0[13] ? v1 : v2) ? (58 != a0[1]) : (a1[1][7] && v2)) ? ((a0[0] >= a0[3]) - (21 <= v1)) : ((a1[1][2] > 60) % 8));
+    }
+    v2 = (((a0[4] ? v3 : v3) != (30 > v0)) == ((v1 == 43) == (v0 && a0[12])));
+    return (((79 ? v1 : v2) - (v2 + a1[2][6])) == ((v3 != a0[7]) < (33 / 4)));
+}
+int f1() {
+    int v0 = 60;
+    int v1 = 97;
+    int v2 = 53;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 <= v1) < (v0 >= 2)) || ((a1[1][13] >= v2) - (58 ? 66 : 41)))) {
+        v0 = (((v2 != v3) == (v3 + v2)) < ((a1[0][2] / 7) < (1 == 18)));
+        v2 = (((a1[1][1] || v1) <= (v3 && a0[3])) - ((72 <= a0[6]) * (25 == 40)));
+        v3 = (((v3 * v2) * (47 >= 38)) ? ((48 == v2) % 8) : ((a0[8] || v1) + (v1 == v3)));
+    } else {
+        v0 = (((a0[6] ? v0 : v3) + (v1 + 32)) % 6);
+        v2 = (((v0 - v1) || (v0 == 82)) <= ((91 >= a0[0]) * (v2 && v2)));
+        a1[1][11] = (((23 <= 79) >= (v1 ? 6 : v3)) || ((v3 <= a1[0][15]) != (10 < v1)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((24 && 29) > 64) break;
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v0 = (((v1 ? v1 : a0[2]) < (12 <= v3)) ? ((v0 ? v0 : 3) % 6) : ((a1[1][1] || 53) * (v0 == v3)));
+            v0 = (((i1 == 19) && (v0 <= a1[0][3])) != ((v0 || v3) >= (87 / 4)));
+            v0 = (((i0 >= v2) ? (a1[0][10] ? a0[2] : v1) : (a1[2][1] && a1[3][5])) - ((i1 + 43) || (v0 ? i1 : a0[14])));
+        }
+        v2 = (((v3 < 78) || (a1[0][10] != a1[3][2])) + ((64 % 2) % 3));
+        a0[11] = (((i0 > i0) ? (v1 - v0) : (a0[9] + 76)) <= ((v1 <= 32) != (a1[3][0] > i0)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a1[1][10] = (((v3 >= v2) > (40 != i2)) >= ((v2 && 0) >= (a1[0][0] < v0)));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                a0[15] = (((v1 - v2) % 1) + ((27 / 5) || (v2 > i2)));
+                a1[0][10] = (((25 - i3) == (v2 / 8)) > ((55 - i2) >= (i2 / 1)));
+                a1[1][13] = (((37 == 24) ? (i3 == 0) : (v3 ? 53 : 79)) != ((v1 >= v1) * (v1 ? v0 : a0[14])));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((1 < v0) == (a0[11] == v2)) * ((v0 && i2) == (v0 && v3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v3 - v2) > 78) break;
+            v0 = (((15 >= v2) / 3) && ((i4 < v3) ? (a1[2][0] ? 10 : v2) : (i4 / 8)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((a1[0][6] ? a1[0][7] : a0[13]) && (i4 <= 38)) + ((v3 || a0[0]) <= (v1 > a0[1])));
+                    v0 = (((v0 ? v3 : 13) < (a1[0][5] ? v1 : i5)) / 9);
+                    v1 = (((a0[12] != a1[3][2]) && (v3 >= 27)) + ((i5 - v3) ? (v1 / 2) : (a0[2] ? v1 : v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v0 = (((a1[2][14] <= a0[4]) > (v2 >= v0)) != ((v3 <= 99) ? (a1[3][3] ? v2 : a0[2]) : (v0 ? a0[11] : i4)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    v3 = (((v0 / 7) < (v0 % 3)) - ((v0 >= 31) > (94 && v0)));
+    v3 = (((v2 - v1) ? (v3 < a1[1][10]) : (v0 % 6)) || ((a1[3][12] <= v3) == (63 == v0)));
+    if ((((54 < v2) < (v1 * a1[1][5])) > ((v2 && a1[1][11]) ? (v1 ? v0 : a0[1]) : (v1 <= v1)))) {
+        v1 = (((v1 % 4) == (v0 - v3)) <= ((a1[2][7] * a1[2][11]) - (v2 != 99)));
+        v0 = (((v3 ? 71 : v1) && (55 ? 87 : v3)) || ((75 % 9) < (a1[2][3] <= v3)));
+        v0 = (((a0[8] < v2) * (v0 >= v3)) ? ((v0 || a0[1]) - (v2 ? v0 : 47)) : ((v2 ? 31 : v0) == (a1[2][13] ? v1 : 70)));
+    } else {
+        v2 = (((a1[2][1] < a1[0][9]) != (v1 <= a1[0][7])) * ((v0 || v0) * (12 != a0[12])));
+        v1 = (((v2 + 33) < (v0 < a0[15])) ? ((a1[0][6] + v0) < (a0[3] && v3)) : ((v2 % 9) ? (64 || v1) : (68 - a1[1][7])));
+        v3 = (((a1[0][14] && 55) && (v2 && v2)) / 7);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v3 = (((v3 && 35) + (i6 < v1)) >= ((19 >= a1[2][3]) > (v1 && 45)));
+            a1[1][12] = (((93 == a0[10]) - (a0[13] <= v3)) + ((v3 == a1[3][13]) == (v2 % 7)));
+            {
+                int i7 = 0;
+                do {
+                    if ((a0[15] == v0) > 59) break;
+                    v3 = (((i6 / 6) * (i6 * 71)) % 7);
+                    v2 = (((77 != a0[1]) >= (v0 * v1)) != ((i6 * i7) >= (90 * 76)));
+                    a1[1][14] = (((84 < a0[12]) - (v3 == v1)) - ((a1[2][13] || a1[3][11]) == (97 >= 22)));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v1 = (((v3 || v3) && (v3 * v2)) + ((a1[2][5] ? 36 : a0[4]) - (a1[0][15] || 48)));
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        v3 = (((a0[3] - 92) >= (37 + 58)) <= ((a0[2] || a1[0][7]) <= (i8 ? v0 : 79)));
+        for (int i9 = 0; i9 < 3; i9 = i9 + 1) {
+            v1 = (((75 ? v1 : i8) == (a1[2][7] * v1)) || ((i8 ? a1[1][3] : v3) / 7));
+            v3 = (((v0 ? 70 : i8) < (42 * i9)) && ((89 != a0[12]) && (v1 / 6)));
+            v2 = (((46 != v2) / 4) - ((v3 * a1[0][8]) > (i9 > v1)));
+        }
+        v1 = (((a1[1][3] < a0[13]) ? (a1[2][10] != a0[11]) : (v1 >= v3)) != ((i8 % 2) || (39 >= v0)));
+    }
+    return (((a1[3][12] != a1[3][4]) < (v1 ? v2 : 12)) <= ((v1 != v3) != (v2 + v3)));
+}
+int f2() {
+    int v0 = 47;
+    int v1 = 87;
+    int v2 = 62;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v0 < v2) > 50) break;
+            a1[2][9] = (((8 == a1[0][14]) <= (i0 / 7)) ? ((a0[13] ? v1 : v2) % 1) : ((v3 ? v0 : 15) ? (51 - 32) : (a1[3][1] ? a0[1] : v1)));
+            v0 = (((80 % 2) >= (v0 >= i0)) > ((v1 && v1) || (i0 * 86)));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((i0 == a0[3]) || (v2 && v3)) == ((a0[1] == a0[4]) && (v1 ? i1 : a0[14])));
+                    v1 = (((96 == 4) > (11 < 60)) - ((i0 % 8) > (28 % 2)));
+                    a0[11] = (((76 - i1) <= (i1 + i0)) + ((i0 && 36) <= (84 && v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[3][9] != v2) + (v2 * v3)) ? ((v0 >= v3) <= (v2 > a0[7])) : ((v1 - v0) ? (a0[13] + a1[1][10]) : (v0 >= v3)))) {
+        a1[0][1] = (((v1 < 62) % 5) == ((a1[2][12] + v1) || (v1 + 46)));
+        v0 = (((v0 != 83) != (v2 >= a1[0][12])) / 3);
+        a1[3][1] = (((a0[5] == v1) > (v0 != a1[0][10])) * ((v0 * 7) + (28 ? v3 : a0[2])));
+    } else {
+        a1[0][13] = (((a1[1][11] / 1) == (a0[14] <= 62)) < ((v1 >= v0) - (a0[6] ? v3 : v3)));
+        v0 = (((92 == 10) ? (50 != a1[1][0]) : (39 <= 52)) / 6);
+        a0[14] = (((v0 != 81) > (a0[4] - v1)) / 3);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v1 = (((20 != 50) + (v0 * v3)) > ((96 + a0[10]) == (v0 < a1[0][8])));
+        v0 = (((90 >= 31) + (v2 - v2)) % 2);
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v3 = (((a1[2][7] + i2) == (v0 <= v0)) / 8);
+                v1 = (((v3 + v0) || (v2 * v3)) > ((83 && 76) <= (i2 != a0[3])));
+                v3 = (((63 || v0) * (v1 + v2)) ? ((32 == i3) % 3) : ((a0[10] <= 37) == (a0[12] || 34)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((i4 * a1[1][11]) - (29 ? a1[3][8] : i4)) / 3);
+        v0 = (((a0[5] && v2) || (94 == 11)) < ((v1 < i4) != (a1[2][15] * a1[3][12])));
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                if ((v0 / 3) > 66) break;
+                v1 = (((a1[0][2] / 1) == (v2 != v1)) / 8);
+                v2 = (((43 + v1) > (a1[0][3] <= 63)) + ((v1 / 8) * (i4 >= v2)));
+                v3 = (((i5 || 46) ? (a0[6] > v0) : (v3 - v2)) % 8);
+                i5 = i5 + 1;
+            }
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((90 >= v0) > 63) break;
+            a0[0] = (((v2 == a1[0][15]) == (v3 != v0)) ? ((10 < 56) ? (v3 <= v1) : (i6 == 94)) : ((29 % 2) < (v1 * a0[7])));
+            {
+                int i7 = 0;
+                do {
+                    a1[0][1] = (((27 > v2) / 9) + ((48 >= v3) * (i7 * v2)));
+                    v2 = (((v3 || 73) / 1) || ((v0 % 9) < (v2 ? v1 : i7)));
+                    v1 = (((v3 || 83) == (i7 <= 86)) <= ((v0 % 6) == (57 > v0)));
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            v1 = (((v3 >= 59) ? (55 * i6) : (a1[0][3] * i6)) <= ((a1[3][7] || v1) % 4));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            v1 = (((a1[2][6] > 72) % 5) != ((v0 + 61) + (47 <= v3)));
+            v1 = (((a1[1][5] ? v1 : v1) * (v3 ? 54 : i8)) <= ((v0 != v3) ? (a1[0][7] % 8) : (a1[3][2] != a1[3][2])));
+            for (int i9 = 0; i9 < 3; i9 = i9 + 1) {
+                v2 = (((a1[0][13] ? 19 : v2) || (i8 != 17)) <= ((v1 ? i8 : 37) / 1));
+                v2 = (((53 != a0[7]) || (v1 < a1[1][14])) ? ((a0[1] == 20) / 6) : ((i9 > v0) && (v2 && v2)));
+                v1 = (((36 && a0[2]) <= (i8 ? v1 : a1[2][12])) >= ((53 * a1[2][13]) && (i8 - 32)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    v1 = (((v2 || a0[13]) * (73 + a1[1][14])) >= ((86 / 3) / 7));
+    if ((((a0[12] ? a1[1][13] : v3) == (v1 ? a0[14] : 40)) % 5)) {
+        a0[15] = (((v2 / 1) && (v0 - v1)) > ((v1 < v3) || (v0 % 5)));
+        v3 = (((v1 > v3) || (a0[8] > a1[1][4])) != ((a1[1][12] ? 16 : v0) ? (v0 == v0) : (a0[11] ? a0[2] : v2)));
+        a1[3][5] = (((v0 || v1) - (a0[13] > a0[9])) ? ((v1 || 51) + (v2 < a0[8])) : ((94 == 64) % 5));
+    } else {
+        v3 = (((v0 >= a1[2][10]) * (v2 ? a1[2][9] : 34)) == ((v2 % 2) / 7));
+        v3 = (((a0[14] > v0) >= (v2 / 9)) - ((a1[1][10] || 39) <= (51 - v0)));
+        v0 = (((v3 >= v0) % 2) * ((a0[8] >= v1) && (v1 || 97)));
+    }
+    if ((((v2 - v3) + (v2 > v3)) == ((v2 ? a1[2][8] : 39) % 3))) {
+        v0 = (((a0[10] > 98) / 5) < ((v3 % 9) - (v2 / 2)));
+        v2 = (((v2 || 37) * (v1 + a0[15])) ? ((v2 > v2) != (v3 || v3)) : ((v3 > 74) == (v0 || a1[1][1])));
+        v3 = (((v1 == 24) != (v3 ? 2 : 70)) % 8);
+    } else {
+        v1 = (((61 || a0[9]) <= (v1 + v1)) % 2);
+        a0[6] = (((v2 >= 50) > (a0[0] < v3)) == ((38 || v1) == (17 || 1)));
+        a0[8] = (((a1[2][9] + a0[13]) ? (v1 / 6) : (17 % 5)) * ((72 ? a1[2][14] : v0) ? (v2 != v1) : (a1[0][5] / 3)));
+    }
+    if ((((a1[0][13] == v1) % 4) || ((8 <= 0) != (11 - v1)))) {
+        v3 = (((v3 > a1[2][12]) || (v2 && v0)) / 5);
+        v3 = (((36 + v1) && (a1[0][14] > v1)) / 6);
+        v3 = (((v1 % 3) * (v2 > 57)) * ((v0 && v0) != (a1[2][14] >= v0)));
+    } else {
+        v1 = (((v3 % 5) ? (40 || a0[14]) : (v2 >= v3)) > ((75 <= v0) ? (21 || 44) : (83 && a1[3][8])));
+        v3 = (((v0 > 31) - (a0[1] && 91)) != ((84 / 6) / 4));
+        v3 = (((83 % 1) < (44 && v2)) ? ((v2 - v1) ? (v3 < v1) : (68 > a1[0][4])) : ((a1[0][13] == 34) ? (a0[9] - 69) : (21 != v0)));
+    }
+    return (((v2 > 99) || (v2 + v1)) ? ((v2 == 92) + (v0 + 94)) : ((82 == a1[1][10]) % 6));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,7848 @@
+    .file 1 "build/bench/batch/f26.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 310 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 311 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 312 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 313 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 314 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 315 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $39, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $44, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $4, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $39, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_6
+    .p2align 4,,10
+.Lf0_5:
+    .loc 1 9 9
+    movslq -20(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $97, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_7
+    jmp .Lf0_3
+.Lf0_7:
+    .loc 1 10 9
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_9
+    jmp .Lf0_8
+.Lf0_9:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_8:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 11 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_11
+    jmp .Lf0_10
+.Lf0_11:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_10:
+    push %rax
+    cmpl $57, -52(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_13
+.Lf0_12:
+    movq $0, %rax
+    jmp .Lf0_14
+.Lf0_13:
+    movslq -12(%rbp), %rax
+.Lf0_14:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 13 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 14 13
+    .p2align 4,,10
+.Lf0_17:
+    .loc 1 15 17
+    movslq -28(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_21
+.Lf0_22:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_21:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_18
+    jmp .Lf0_19
+.Lf0_18:
+    movq $42, %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $11, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_20
+.Lf0_19:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_20:
+    movl %eax, -4(%rbp)
+    .loc 1 16 17
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_24
+    jmp .Lf0_23
+.Lf0_24:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_23:
+    movl %eax, -8(%rbp)
+    .loc 1 17 17
+    movq $6, %rax
+    push %rax
+    cmpl $76, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_26
+    jmp .Lf0_25
+.Lf0_26:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_25:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 18 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_16:
+    .loc 1 19 22
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_17
+.Lf0_15:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_4:
+    .loc 1 8 30
+    incl -340(%rbp)
+.Lf0_6:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_5
+.Lf0_3:
+    addq $8, %rsp
+    .loc 1 22 5
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_27
+    jmp .Lf0_28
+.Lf0_27:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_31
+    jmp .Lf0_30
+.Lf0_31:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_30:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -64(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_29:
+    movl %eax, -8(%rbp)
+    .loc 1 24 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 25 9
+    .p2align 4,,10
+.Lf0_34:
+    .loc 1 26 13
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_36
+    jmp .Lf0_35
+.Lf0_36:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_35:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 27 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_42
+    .p2align 4,,10
+.Lf0_41:
+    .loc 1 28 17
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $96, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_43
+    jmp .Lf0_39
+.Lf0_43:
+    .loc 1 29 17
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_44
+    jmp .Lf0_45
+.Lf0_44:
+    movslq -52(%rbp), %rax
+    jmp .Lf0_46
+.Lf0_45:
+    movq $45, %rax
+.Lf0_46:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 30 17
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_47
+    jmp .Lf0_48
+.Lf0_47:
+    movslq -52(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_49
+.Lf0_48:
+    movq $4, %rax
+    push %rax
+    movq $97, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_49:
+    movl %eax, -4(%rbp)
+    .loc 1 31 17
+    movslq -60(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_51
+    jmp .Lf0_50
+.Lf0_51:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_50:
+    push %rax
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_53
+    jmp .Lf0_52
+.Lf0_53:
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_52:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_40:
+    .loc 1 27 38
+    incl -344(%rbp)
+.Lf0_42:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_41
+.Lf0_39:
+    addq $0, %rsp
+    .loc 1 33 13
+    movq $85, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $51, -56(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $17, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $85, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 34 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_33:
+    .loc 1 35 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_34
+.Lf0_32:
+    addq $8, %rsp
+    .loc 1 37 5
+    movq $11, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_56
+    jmp .Lf0_55
+.Lf0_56:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_57
+    .loc 1 38 9
+    movq $34, %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_59
+    jmp .Lf0_58
+.Lf0_59:
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_58:
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -48(%rbp)
+    .loc 1 39 9
+    movq $9, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 40 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_60
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_62
+.Lf0_61:
+    movq $18, %rax
+.Lf0_62:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_64
+    jmp .Lf0_63
+.Lf0_64:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_63:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $67, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_54
+.Lf0_57:
+    .loc 1 42 9
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $31, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_66
+    jmp .Lf0_65
+.Lf0_66:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_65:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 43 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_68
+    jmp .Lf0_67
+.Lf0_68:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_67:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $70, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_70
+    jmp .Lf0_69
+.Lf0_70:
+    movq $32, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_69:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 44 9
+    movq $64, %rax
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_72
+.Lf0_71:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -12(%rbp), %rax
+.Lf0_73:
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_75
+    jmp .Lf0_74
+.Lf0_75:
+    movslq -28(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_74:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_54:
+    .loc 1 46 5
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_77
+    jmp .Lf0_78
+.Lf0_77:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_79
+.Lf0_78:
+    movslq -80(%rbp), %rax
+.Lf0_79:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_81
+    jmp .Lf0_80
+.Lf0_81:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $45, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_80:
+    cmpq $0, %rax
+    je .Lf0_82
+    .loc 1 47 9
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_84
+    jmp .Lf0_83
+.Lf0_84:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_83:
+    push %rax
+    movslq -60(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 48 9
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_85
+    jmp .Lf0_86
+.Lf0_85:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_88
+.Lf0_89:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_88:
+    jmp .Lf0_87
+.Lf0_86:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_90
+    jmp .Lf0_91
+.Lf0_90:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_92
+.Lf0_91:
+    movslq -28(%rbp), %rax
+.Lf0_92:
+.Lf0_87:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_93
+.Lf0_94:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_96
+    jmp .Lf0_95
+.Lf0_96:
+    movq $4, %rax
+    push %rax
+    movq $77, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_95:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_93:
+    movl %eax, -4(%rbp)
+    .loc 1 49 9
+    movq $87, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_76
+.Lf0_82:
+    .loc 1 51 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_100
+    jmp .Lf0_99
+.Lf0_100:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_99:
+    push %rax
+    movq $54, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_101
+    jmp .Lf0_102
+.Lf0_101:
+    movslq -72(%rbp), %rax
+    addq $80, %rax
+    movslq %eax, %rax
+    jmp .Lf0_103
+.Lf0_102:
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf0_104
+    jmp .Lf0_105
+.Lf0_104:
+    movq $23, %rax
+    jmp .Lf0_106
+.Lf0_105:
+    movslq -12(%rbp), %rax
+.Lf0_106:
+.Lf0_103:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 52 9
+    movq $6, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_108
+    jmp .Lf0_107
+.Lf0_108:
+    movq $26, %rax
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_110
+.Lf0_109:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_111
+.Lf0_110:
+    movslq -12(%rbp), %rax
+.Lf0_111:
+    push %rax
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_112
+.Lf0_113:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_112:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_107:
+    movl %eax, -16(%rbp)
+    .loc 1 53 9
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_115
+.Lf0_114:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_116
+.Lf0_115:
+    movq $10, %rax
+.Lf0_116:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_76:
+    .loc 1 55 5
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $74, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_118
+    jmp .Lf0_119
+.Lf0_118:
+    movq $47, %rax
+    jmp .Lf0_120
+.Lf0_119:
+    movq $1, %rax
+.Lf0_120:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_121
+    .loc 1 56 9
+    movq $4, %rax
+    cmpq $20, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $91, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_122
+    jmp .Lf0_123
+.Lf0_122:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -12(%rbp), %rax
+.Lf0_124:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 57 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_125
+.Lf0_126:
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_125:
+    push %rax
+    cmpl $89, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $40, %rax
+    subq $17, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_128
+    jmp .Lf0_127
+.Lf0_128:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_127:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 58 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_133
+    jmp .Lf0_132
+.Lf0_133:
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_132:
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_130
+.Lf0_129:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_137
+    jmp .Lf0_138
+.Lf0_137:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_139
+.Lf0_138:
+    movq $61, %rax
+.Lf0_139:
+    cmpq $0, %rax
+    jne .Lf0_134
+    jmp .Lf0_135
+.Lf0_134:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_141
+    jmp .Lf0_140
+.Lf0_141:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_140:
+    jmp .Lf0_136
+.Lf0_135:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf0_136:
+    jmp .Lf0_131
+.Lf0_130:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_131:
+    movl %eax, -24(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_117
+.Lf0_121:
+    .loc 1 60 9
+    movq $37, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $15, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 61 9
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_142
+    jmp .Lf0_143
+.Lf0_142:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_144
+.Lf0_143:
+    movq $88, %rax
+.Lf0_144:
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $78, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 62 9
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_146
+    jmp .Lf0_145
+.Lf0_146:
+    movq $40, %rax
+    cmpq $0, %rax
+    jne .Lf0_147
+    jmp .Lf0_148
+.Lf0_147:
+    movq $95, %rax
+    jmp .Lf0_149
+.Lf0_148:
+    movq $43, %rax
+.Lf0_149:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_145:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_151
+    jmp .Lf0_150
+.Lf0_151:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_153
+    jmp .Lf0_152
+.Lf0_153:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_152:
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_150:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_117:
+    .loc 1 64 5
+    movq $3, %rax
+    push %rax
+    movq $41, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_154
+.Lf0_155:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_154:
+    push %rax
+    cmpl $60, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 66 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 67 9
+    jmp .Lf0_159
+    .p2align 4,,10
+.Lf0_158:
+    .loc 1 68 13
+    movq $5, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $28, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $11, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 69 13
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_161
+    jmp .Lf0_160
+.Lf0_161:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_160:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 70 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_167
+    .p2align 4,,10
+.Lf0_166:
+    .loc 1 71 17
+    movslq -32(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_174
+    jmp .Lf0_173
+.Lf0_174:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_173:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_170
+.Lf0_169:
+    movq $6, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_170:
+    movl %eax, -12(%rbp)
+    .loc 1 72 17
+    movq $91, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_176
+    jmp .Lf0_175
+.Lf0_176:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_175:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -60(%rbp), %rax
+    subq $9, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    movl %eax, -16(%rbp)
+    .loc 1 73 17
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $22, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    addq $0, %rsp
+.Lf0_165:
+    .loc 1 70 38
+    incl -344(%rbp)
+.Lf0_167:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_166
+.Lf0_164:
+    addq $0, %rsp
+    .loc 1 75 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_157:
+.Lf0_159:
+    .loc 1 67 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_158
+.Lf0_156:
+    addq $8, %rsp
+    .loc 1 78 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_180
+    jmp .Lf0_181
+.Lf0_180:
+    movq $80, %rax
+    jmp .Lf0_182
+.Lf0_181:
+    movslq -12(%rbp), %rax
+.Lf0_182:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_184
+    jmp .Lf0_183
+.Lf0_184:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_186
+    jmp .Lf0_185
+.Lf0_186:
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_185:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_183:
+    cmpq $0, %rax
+    je .Lf0_187
+    .loc 1 79 9
+    cmpl $55, -48(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_188
+    jmp .Lf0_189
+.Lf0_188:
+    movslq -4(%rbp), %rax
+    subq $48, %rax
+    movslq %eax, %rax
+    jmp .Lf0_190
+.Lf0_189:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_190:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_192
+    jmp .Lf0_191
+.Lf0_192:
+    movq $27, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_193
+    jmp .Lf0_194
+.Lf0_193:
+    movq $6, %rax
+    push %rax
+    movq $39, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_195
+.Lf0_194:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_197
+    jmp .Lf0_196
+.Lf0_197:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_196:
+.Lf0_195:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_191:
+    movl %eax, -12(%rbp)
+    .loc 1 80 9
+    movslq -56(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    imulq $6, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_198
+    jmp .Lf0_199
+.Lf0_198:
+    movq $52, %rax
+    cmpq $0, %rax
+    jne .Lf0_201
+    jmp .Lf0_202
+.Lf0_201:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_203
+.Lf0_202:
+    movslq -16(%rbp), %rax
+.Lf0_203:
+    jmp .Lf0_200
+.Lf0_199:
+    movslq -4(%rbp), %rax
+    imulq $70, %rax
+    movslq %eax, %rax
+.Lf0_200:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 81 9
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_204
+.Lf0_205:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_204:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_179
+.Lf0_187:
+    .loc 1 83 9
+    movq $35, %rax
+    cmpq $20, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_207
+.Lf0_206:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_208
+.Lf0_207:
+    movslq -16(%rbp), %rax
+.Lf0_208:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_210
+    jmp .Lf0_209
+.Lf0_210:
+    movslq -12(%rbp), %rax
+    addq $43, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_209:
+    movl %eax, -64(%rbp)
+    .loc 1 84 9
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $11, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_211
+.Lf0_212:
+    movq $37, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_211:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_215
+    jmp .Lf0_216
+.Lf0_215:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_217
+.Lf0_216:
+    movq $48, %rax
+.Lf0_217:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movq $6, %rax
+    push %rax
+    movq $90, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+    movl %eax, -32(%rbp)
+    .loc 1 85 9
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_226
+    jmp .Lf0_227
+.Lf0_226:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_228
+.Lf0_227:
+    movslq -12(%rbp), %rax
+.Lf0_228:
+    cmpq $0, %rax
+    jne .Lf0_223
+    jmp .Lf0_224
+.Lf0_223:
+    movq $58, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_225
+.Lf0_224:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_230
+    jmp .Lf0_229
+.Lf0_230:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_229:
+.Lf0_225:
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_221
+.Lf0_220:
+    movq $21, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_222
+.Lf0_221:
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_222:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_179:
+    .loc 1 87 5
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_231
+    jmp .Lf0_232
+.Lf0_231:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_233
+.Lf0_232:
+    movslq -16(%rbp), %rax
+.Lf0_233:
+    push %rax
+    movq $30, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $43, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_234
+.Lf0_235:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 88 5
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    cmpq $0, %rax
+    jne .Lf0_236
+    jmp .Lf0_237
+.Lf0_236:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_238
+.Lf0_237:
+    movslq -12(%rbp), %rax
+.Lf0_238:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $33, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 90 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 91 5
+    subq $8, %rsp
+    movq $60, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 92 5
+    movq $97, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 93 5
+    subq $8, %rsp
+    movq $53, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 94 5
+    movq $44, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 95 5
+    subq $64, %rsp
+    .loc 1 96 5
+    subq $256, %rsp
+    .loc 1 97 5
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $2, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_3
+    jmp .Lf1_2
+.Lf1_3:
+    movq $58, %rax
+    cmpq $0, %rax
+    jne .Lf1_4
+    jmp .Lf1_5
+.Lf1_4:
+    movq $66, %rax
+    jmp .Lf1_6
+.Lf1_5:
+    movq $41, %rax
+.Lf1_6:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_2:
+    cmpq $0, %rax
+    je .Lf1_7
+    .loc 1 98 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    cmpq $18, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 99 9
+    movq $25, %rax
+    cmpq $40, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $72, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_9
+    jmp .Lf1_8
+.Lf1_9:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_8:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_11
+    jmp .Lf1_10
+.Lf1_11:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_10:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 100 9
+    movq $47, %rax
+    cmpq $38, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_12
+    jmp .Lf1_13
+.Lf1_12:
+    movq $8, %rax
+    push %rax
+    movq $48, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_14
+.Lf1_13:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_16
+    jmp .Lf1_15
+.Lf1_16:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_15:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf1_14:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_1
+.Lf1_7:
+    .loc 1 102 9
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $32, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_17
+    jmp .Lf1_18
+.Lf1_17:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_19
+.Lf1_18:
+    movslq -16(%rbp), %rax
+.Lf1_19:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 103 9
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_21
+    jmp .Lf1_20
+.Lf1_21:
+    cmpl $82, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_20:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_22
+.Lf1_23:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_22:
+    push %rax
+    movq $91, %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 104 9
+    movq $23, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_24
+    jmp .Lf1_25
+.Lf1_24:
+    movq $6, %rax
+    jmp .Lf1_26
+.Lf1_25:
+    movslq -16(%rbp), %rax
+.Lf1_26:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_28
+    jmp .Lf1_27
+.Lf1_28:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $10, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_27:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_1:
+    .loc 1 106 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_34
+    .p2align 4,,10
+.Lf1_33:
+    .loc 1 107 9
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_37
+    jmp .Lf1_36
+.Lf1_37:
+    movq $29, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_36:
+    cmpq $64, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_35
+    jmp .Lf1_31
+.Lf1_35:
+    .loc 1 108 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_43
+    .p2align 4,,10
+.Lf1_42:
+    .loc 1 109 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_48
+.Lf1_47:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_49
+.Lf1_48:
+    movslq -72(%rbp), %rax
+.Lf1_49:
+    push %rax
+    movq $12, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_44
+    jmp .Lf1_45
+.Lf1_44:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_50
+    jmp .Lf1_51
+.Lf1_50:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_52
+.Lf1_51:
+    movq $3, %rax
+.Lf1_52:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_46
+.Lf1_45:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_54
+    jmp .Lf1_53
+.Lf1_54:
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_53:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_46:
+    movl %eax, -4(%rbp)
+    .loc 1 110 13
+    cmpl $19, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_55
+.Lf1_56:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_55:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_58
+    jmp .Lf1_57
+.Lf1_58:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_57:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $87, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 111 13
+    movslq -344(%rbp), %rax
+    addq $43, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_60
+    jmp .Lf1_59
+.Lf1_60:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_61
+    jmp .Lf1_62
+.Lf1_61:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_63
+.Lf1_62:
+    movslq -24(%rbp), %rax
+.Lf1_63:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_59:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_64
+    jmp .Lf1_65
+.Lf1_64:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -72(%rbp), %rax
+    jmp .Lf1_69
+.Lf1_68:
+    movslq -8(%rbp), %rax
+.Lf1_69:
+    jmp .Lf1_66
+.Lf1_65:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_71
+    jmp .Lf1_70
+.Lf1_71:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_70:
+.Lf1_66:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_41:
+    .loc 1 108 34
+    incl -344(%rbp)
+.Lf1_43:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_42
+.Lf1_40:
+    addq $0, %rsp
+    .loc 1 113 9
+    movq $3, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $64, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $78, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_73
+    jmp .Lf1_72
+.Lf1_73:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_72:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 114 9
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_74
+    jmp .Lf1_75
+.Lf1_74:
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_76
+.Lf1_75:
+    movslq -44(%rbp), %rax
+    addq $76, %rax
+    movslq %eax, %rax
+.Lf1_76:
+    push %rax
+    cmpl $32, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lf1_32:
+    .loc 1 106 30
+    incl -340(%rbp)
+.Lf1_34:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_33
+.Lf1_31:
+    addq $8, %rsp
+    .loc 1 116 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_82
+    .p2align 4,,10
+.Lf1_81:
+    .loc 1 117 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $40, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_83
+.Lf1_84:
+    movq $0, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_83:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 119 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 120 13
+    jmp .Lf1_88
+    .p2align 4,,10
+.Lf1_87:
+    .loc 1 121 17
+    movq $5, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_90
+    jmp .Lf1_89
+.Lf1_90:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_89:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 122 17
+    movq $25, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $55, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 123 17
+    movq $37, %rax
+    cmpq $24, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_92
+.Lf1_91:
+    cmpl $0, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_93
+.Lf1_92:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_94
+    jmp .Lf1_95
+.Lf1_94:
+    movq $53, %rax
+    jmp .Lf1_96
+.Lf1_95:
+    movq $79, %rax
+.Lf1_96:
+.Lf1_93:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_97
+    jmp .Lf1_98
+.Lf1_97:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_99
+.Lf1_98:
+    movslq -24(%rbp), %rax
+.Lf1_99:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 124 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_86:
+.Lf1_88:
+    .loc 1 120 20
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_87
+.Lf1_85:
+    addq $0, %rsp
+    .loc 1 127 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_101
+    jmp .Lf1_100
+.Lf1_101:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_100:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_103
+    jmp .Lf1_102
+.Lf1_103:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_102:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_80:
+    .loc 1 116 30
+    incl -340(%rbp)
+.Lf1_82:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_81
+.Lf1_79:
+    addq $8, %rsp
+    .loc 1 130 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 131 9
+    .p2align 4,,10
+.Lf1_106:
+    .loc 1 132 13
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $78, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_107
+    jmp .Lf1_104
+.Lf1_107:
+    .loc 1 133 13
+    movq $3, %rax
+    push %rax
+    movq $15, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_109
+    jmp .Lf1_108
+.Lf1_109:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_111
+.Lf1_110:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_113
+    jmp .Lf1_114
+.Lf1_113:
+    movq $10, %rax
+    jmp .Lf1_115
+.Lf1_114:
+    movslq -12(%rbp), %rax
+.Lf1_115:
+    jmp .Lf1_112
+.Lf1_111:
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_112:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_108:
+    movl %eax, -4(%rbp)
+    .loc 1 135 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 136 17
+    .p2align 4,,10
+.Lf1_118:
+    .loc 1 137 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_120
+    jmp .Lf1_119
+.Lf1_120:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_119:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_121
+    jmp .Lf1_122
+.Lf1_121:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf1_123
+.Lf1_122:
+    movslq -28(%rbp), %rax
+.Lf1_123:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_125
+    jmp .Lf1_124
+.Lf1_125:
+    cmpl $38, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_124:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 138 21
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_126
+    jmp .Lf1_127
+.Lf1_126:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_128
+.Lf1_127:
+    movq $13, %rax
+.Lf1_128:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_129
+    jmp .Lf1_130
+.Lf1_129:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_131
+.Lf1_130:
+    movslq -344(%rbp), %rax
+.Lf1_131:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 139 21
+    movslq -344(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_133
+.Lf1_132:
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_134
+.Lf1_133:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_136
+.Lf1_135:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_137
+.Lf1_136:
+    movslq -12(%rbp), %rax
+.Lf1_137:
+.Lf1_134:
+    push %rax
+    movslq -32(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_139
+    jmp .Lf1_138
+.Lf1_139:
+    cmpl $27, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_138:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 140 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_117:
+    .loc 1 141 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_118
+.Lf1_116:
+    addq $0, %rsp
+    .loc 1 143 13
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $99, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_141
+.Lf1_140:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_143
+    jmp .Lf1_144
+.Lf1_143:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_145
+.Lf1_144:
+    movslq -72(%rbp), %rax
+.Lf1_145:
+    jmp .Lf1_142
+.Lf1_141:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_146
+    jmp .Lf1_147
+.Lf1_146:
+    movslq -36(%rbp), %rax
+    jmp .Lf1_148
+.Lf1_147:
+    movslq -340(%rbp), %rax
+.Lf1_148:
+.Lf1_142:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 144 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_105:
+    .loc 1 145 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_106
+.Lf1_104:
+    addq $8, %rsp
+    .loc 1 147 5
+    cmpl $31, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_150
+    jmp .Lf1_149
+.Lf1_150:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_149:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 148 5
+    movslq -12(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_151
+    jmp .Lf1_152
+.Lf1_151:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_153
+.Lf1_152:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_153:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $63, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    movl %eax, -16(%rbp)
+    .loc 1 149 5
+    movq $54, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_161
+    jmp .Lf1_160
+.Lf1_161:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_160:
+    cmpq $0, %rax
+    jne .Lf1_157
+    jmp .Lf1_158
+.Lf1_157:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_163
+.Lf1_162:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_164
+.Lf1_163:
+    movslq -76(%rbp), %rax
+.Lf1_164:
+    jmp .Lf1_159
+.Lf1_158:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf1_159:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_165
+    .loc 1 150 9
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $99, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 151 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_167
+.Lf1_166:
+    movq $71, %rax
+    jmp .Lf1_168
+.Lf1_167:
+    movslq -8(%rbp), %rax
+.Lf1_168:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_170
+    jmp .Lf1_169
+.Lf1_170:
+    movq $55, %rax
+    cmpq $0, %rax
+    jne .Lf1_171
+    jmp .Lf1_172
+.Lf1_171:
+    movq $87, %rax
+    jmp .Lf1_173
+.Lf1_172:
+    movslq -16(%rbp), %rax
+.Lf1_173:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_169:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_175
+    jmp .Lf1_174
+.Lf1_175:
+    movq $9, %rax
+    push %rax
+    movq $75, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_174:
+    movl %eax, -4(%rbp)
+    .loc 1 152 9
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_176
+    jmp .Lf1_177
+.Lf1_176:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_179
+    jmp .Lf1_180
+.Lf1_179:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_181
+.Lf1_180:
+    movq $47, %rax
+.Lf1_181:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_183
+    jmp .Lf1_182
+.Lf1_183:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_182:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_178
+.Lf1_177:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_184
+    jmp .Lf1_185
+.Lf1_184:
+    movq $31, %rax
+    jmp .Lf1_186
+.Lf1_185:
+    movslq -4(%rbp), %rax
+.Lf1_186:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_187
+    jmp .Lf1_188
+.Lf1_187:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_189
+.Lf1_188:
+    movq $70, %rax
+.Lf1_189:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_178:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_156
+.Lf1_165:
+    .loc 1 154 9
+    movq $12, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_191
+    jmp .Lf1_190
+.Lf1_191:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_190:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 155 9
+    movslq -12(%rbp), %rax
+    addq $33, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_192
+    jmp .Lf1_193
+.Lf1_192:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_196
+    jmp .Lf1_195
+.Lf1_196:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_195:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_194
+.Lf1_193:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_197
+    jmp .Lf1_198
+.Lf1_197:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_201
+    jmp .Lf1_200
+.Lf1_201:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_200:
+    jmp .Lf1_199
+.Lf1_198:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    movq $68, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_199:
+.Lf1_194:
+    movl %eax, -8(%rbp)
+    .loc 1 156 9
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_203
+    jmp .Lf1_202
+.Lf1_203:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_202:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_205
+    jmp .Lf1_204
+.Lf1_205:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_207
+    jmp .Lf1_206
+.Lf1_207:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_206:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_204:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_156:
+    .loc 1 159 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 160 9
+    jmp .Lf1_211
+    .p2align 4,,10
+.Lf1_210:
+    .loc 1 161 13
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_213
+    jmp .Lf1_212
+.Lf1_213:
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_212:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $19, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_215
+    jmp .Lf1_214
+.Lf1_215:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_214:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 162 13
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $93, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 164 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 165 17
+    .p2align 4,,10
+.Lf1_218:
+    .loc 1 166 21
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_219
+    jmp .Lf1_216
+.Lf1_219:
+    .loc 1 167 21
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imulq $71, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 168 21
+    movq $77, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $90, %rax
+    imulq $76, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 169 21
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_221
+    jmp .Lf1_220
+.Lf1_221:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_220:
+    push %rax
+    movq $97, %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $84, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 170 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_217:
+    .loc 1 171 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_218
+.Lf1_216:
+    addq $0, %rsp
+    .loc 1 173 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_209:
+.Lf1_211:
+    .loc 1 160 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_210
+.Lf1_208:
+    addq $8, %rsp
+    .loc 1 176 5
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_223
+    jmp .Lf1_222
+.Lf1_223:
+    movq $48, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_222:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_224
+    jmp .Lf1_225
+.Lf1_224:
+    movq $36, %rax
+    jmp .Lf1_226
+.Lf1_225:
+    movslq -64(%rbp), %rax
+.Lf1_226:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_228
+    jmp .Lf1_227
+.Lf1_228:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_227:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_230
+    jmp .Lf1_229
+.Lf1_230:
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_229:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 177 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_236
+    .p2align 4,,10
+.Lf1_235:
+    .loc 1 178 9
+    movslq -68(%rbp), %rax
+    subq $92, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $37, %rax
+    addq $58, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_238
+    jmp .Lf1_237
+.Lf1_238:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_237:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_239
+    jmp .Lf1_240
+.Lf1_239:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_241
+.Lf1_240:
+    movq $79, %rax
+.Lf1_241:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 179 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 180 13
+    movq $75, %rax
+    cmpq $0, %rax
+    jne .Lf1_247
+    jmp .Lf1_248
+.Lf1_247:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_249
+.Lf1_248:
+    movslq -340(%rbp), %rax
+.Lf1_249:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_251
+    jmp .Lf1_250
+.Lf1_251:
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_252
+    jmp .Lf1_253
+.Lf1_252:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf1_254
+.Lf1_253:
+    movslq -16(%rbp), %rax
+.Lf1_254:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_250:
+    movl %eax, -8(%rbp)
+    .loc 1 181 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_256
+.Lf1_255:
+    movq $70, %rax
+    jmp .Lf1_257
+.Lf1_256:
+    movslq -340(%rbp), %rax
+.Lf1_257:
+    push %rax
+    movq $42, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_259
+    jmp .Lf1_258
+.Lf1_259:
+    movq $89, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_261
+    jmp .Lf1_260
+.Lf1_261:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_260:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_258:
+    movl %eax, -16(%rbp)
+    .loc 1 182 13
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $46, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_246:
+    .loc 1 179 34
+    incl -344(%rbp)
+    .loc 1 180 13
+    movq $75, %rax
+    cmpq $0, %rax
+    jne .Lf1_263
+    jmp .Lf1_264
+.Lf1_263:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_265
+.Lf1_264:
+    movslq -340(%rbp), %rax
+.Lf1_265:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_267
+    jmp .Lf1_266
+.Lf1_267:
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_268
+    jmp .Lf1_269
+.Lf1_268:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf1_270
+.Lf1_269:
+    movslq -16(%rbp), %rax
+.Lf1_270:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_266:
+    movl %eax, -8(%rbp)
+    .loc 1 181 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_271
+    jmp .Lf1_272
+.Lf1_271:
+    movq $70, %rax
+    jmp .Lf1_273
+.Lf1_272:
+    movslq -340(%rbp), %rax
+.Lf1_273:
+    push %rax
+    movq $42, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_275
+    jmp .Lf1_274
+.Lf1_275:
+    movq $89, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_277
+    jmp .Lf1_276
+.Lf1_277:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_276:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_274:
+    movl %eax, -16(%rbp)
+    .loc 1 182 13
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $46, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_262:
+    .loc 1 179 34
+    incl -344(%rbp)
+    .loc 1 180 13
+    movq $75, %rax
+    cmpq $0, %rax
+    jne .Lf1_278
+    jmp .Lf1_279
+.Lf1_278:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_280
+.Lf1_279:
+    movslq -340(%rbp), %rax
+.Lf1_280:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_282
+    jmp .Lf1_281
+.Lf1_282:
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_283
+    jmp .Lf1_284
+.Lf1_283:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf1_285
+.Lf1_284:
+    movslq -16(%rbp), %rax
+.Lf1_285:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_281:
+    movl %eax, -8(%rbp)
+    .loc 1 181 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_286
+    jmp .Lf1_287
+.Lf1_286:
+    movq $70, %rax
+    jmp .Lf1_288
+.Lf1_287:
+    movslq -340(%rbp), %rax
+.Lf1_288:
+    push %rax
+    movq $42, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_290
+    jmp .Lf1_289
+.Lf1_290:
+    movq $89, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_292
+    jmp .Lf1_291
+.Lf1_292:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_291:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_289:
+    movl %eax, -16(%rbp)
+    .loc 1 182 13
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $46, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_245:
+    .loc 1 179 34
+    incl -344(%rbp)
+.Lf1_244:
+    addq $0, %rsp
+    .loc 1 184 9
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_293
+    jmp .Lf1_294
+.Lf1_293:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_295
+.Lf1_294:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_295:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_297
+    jmp .Lf1_296
+.Lf1_297:
+    movq $39, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_296:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_234:
+    .loc 1 177 30
+    incl -340(%rbp)
+.Lf1_236:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_235
+.Lf1_233:
+    addq $8, %rsp
+    .loc 1 186 5
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_298
+    jmp .Lf1_299
+.Lf1_298:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_300
+.Lf1_299:
+    movq $12, %rax
+.Lf1_300:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 188 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 189 5
+    subq $8, %rsp
+    movq $47, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 190 5
+    movq $87, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 191 5
+    subq $8, %rsp
+    movq $62, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 192 5
+    movq $89, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 193 5
+    subq $64, %rsp
+    .loc 1 194 5
+    subq $256, %rsp
+    .loc 1 196 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 197 9
+    jmp .Lf2_4
+    .p2align 4,,10
+.Lf2_3:
+    .loc 1 198 13
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $50, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_5
+    jmp .Lf2_1
+.Lf2_5:
+    .loc 1 199 13
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_6
+    jmp .Lf2_7
+.Lf2_6:
+    movq $1, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_9
+    jmp .Lf2_10
+.Lf2_9:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_11
+.Lf2_10:
+    movslq -12(%rbp), %rax
+.Lf2_11:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_8
+.Lf2_7:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_15
+    jmp .Lf2_16
+.Lf2_15:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_17
+.Lf2_16:
+    movq $15, %rax
+.Lf2_17:
+    cmpq $0, %rax
+    jne .Lf2_12
+    jmp .Lf2_13
+.Lf2_12:
+    movq $51, %rax
+    subq $32, %rax
+    movslq %eax, %rax
+    jmp .Lf2_14
+.Lf2_13:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_18
+    jmp .Lf2_19
+.Lf2_18:
+    movslq -76(%rbp), %rax
+    jmp .Lf2_20
+.Lf2_19:
+    movslq -8(%rbp), %rax
+.Lf2_20:
+.Lf2_14:
+.Lf2_8:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 200 13
+    movq $2, %rax
+    push %rax
+    movq $80, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_22
+    jmp .Lf2_21
+.Lf2_22:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_21:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_24
+    jmp .Lf2_23
+.Lf2_24:
+    movslq -340(%rbp), %rax
+    imulq $86, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_23:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 202 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 203 17
+    .p2align 4,,10
+.Lf2_27:
+    .loc 1 204 21
+    movslq -340(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_29
+    jmp .Lf2_28
+.Lf2_29:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_30
+.Lf2_31:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_30:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_28:
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_33
+    jmp .Lf2_32
+.Lf2_33:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_34
+    jmp .Lf2_35
+.Lf2_34:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_36
+.Lf2_35:
+    movslq -24(%rbp), %rax
+.Lf2_36:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_32:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 205 21
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $28, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $96, %rax
+    cmpq $4, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $11, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 206 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_38
+    jmp .Lf2_37
+.Lf2_38:
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_37:
+    push %rax
+    movq $84, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_40
+    jmp .Lf2_39
+.Lf2_40:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_39:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $76, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 207 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_26:
+    .loc 1 208 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_27
+.Lf2_25:
+    addq $0, %rsp
+    .loc 1 210 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_2:
+.Lf2_4:
+    .loc 1 197 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_3
+.Lf2_1:
+    addq $8, %rsp
+    .loc 1 213 5
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_42
+    jmp .Lf2_43
+.Lf2_42:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_44
+.Lf2_43:
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_45
+    jmp .Lf2_46
+.Lf2_45:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_47
+.Lf2_46:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_47:
+.Lf2_44:
+    cmpq $0, %rax
+    je .Lf2_48
+    .loc 1 214 9
+    movq $5, %rax
+    push %rax
+    cmpl $62, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_50
+    jmp .Lf2_49
+.Lf2_50:
+    movslq -8(%rbp), %rax
+    addq $46, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_49:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 215 9
+    movq $3, %rax
+    push %rax
+    cmpl $83, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 216 9
+    movq $28, %rax
+    cmpq $0, %rax
+    jne .Lf2_51
+    jmp .Lf2_52
+.Lf2_51:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_53
+.Lf2_52:
+    movslq -72(%rbp), %rax
+.Lf2_53:
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $7, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_41
+.Lf2_48:
+    .loc 1 218 9
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $62, -24(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_54
+    jmp .Lf2_55
+.Lf2_54:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_56
+.Lf2_55:
+    movslq -16(%rbp), %rax
+.Lf2_56:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 219 9
+    movq $6, %rax
+    push %rax
+    movq $92, %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_57
+    jmp .Lf2_58
+.Lf2_57:
+    movq $50, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_59
+.Lf2_58:
+    movq $39, %rax
+    cmpq $52, %rax
+    movq $0, %rax
+    setle %al
+.Lf2_59:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 220 9
+    movq $3, %rax
+    push %rax
+    cmpl $81, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -64(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    addq $0, %rsp
+.Lf2_41:
+    .loc 1 222 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_65
+    .p2align 4,,10
+.Lf2_64:
+    .loc 1 223 9
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $20, %rax
+    cmpq $50, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $96, %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 224 9
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $90, %rax
+    cmpq $31, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 226 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 227 13
+    jmp .Lf2_69
+    .p2align 4,,10
+.Lf2_68:
+    .loc 1 228 17
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 229 17
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_71
+    jmp .Lf2_70
+.Lf2_71:
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_70:
+    push %rax
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_73
+    jmp .Lf2_72
+.Lf2_73:
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_72:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 230 17
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $63, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_78
+    jmp .Lf2_77
+.Lf2_78:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_77:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_74
+    jmp .Lf2_75
+.Lf2_74:
+    movq $3, %rax
+    push %rax
+    movq $32, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_76
+.Lf2_75:
+    cmpl $37, -40(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_80
+    jmp .Lf2_79
+.Lf2_80:
+    movq $34, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_79:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_76:
+    movl %eax, -16(%rbp)
+    .loc 1 231 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_67:
+.Lf2_69:
+    .loc 1 227 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_68
+.Lf2_66:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_63:
+    .loc 1 222 30
+    incl -340(%rbp)
+.Lf2_65:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_64
+.Lf2_62:
+    addq $8, %rsp
+    .loc 1 235 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_86
+    .p2align 4,,10
+.Lf2_85:
+    .loc 1 236 9
+    movq $3, %rax
+    push %rax
+    movq $29, %rax
+    cmpq $0, %rax
+    jne .Lf2_87
+    jmp .Lf2_88
+.Lf2_87:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf2_89
+.Lf2_88:
+    movslq -340(%rbp), %rax
+.Lf2_89:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 237 9
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_91
+    jmp .Lf2_90
+.Lf2_91:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_90:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_93
+    jmp .Lf2_92
+.Lf2_93:
+    movq $94, %rax
+    cmpq $11, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_92:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 239 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 240 13
+    jmp .Lf2_97
+    .p2align 4,,10
+.Lf2_96:
+    .loc 1 241 17
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_98
+    jmp .Lf2_94
+.Lf2_98:
+    .loc 1 242 17
+    movq $8, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 243 17
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $43, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $63, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 244 17
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_103
+    jmp .Lf2_102
+.Lf2_103:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_102:
+    cmpq $0, %rax
+    jne .Lf2_99
+    jmp .Lf2_100
+.Lf2_99:
+    movslq -56(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_101
+.Lf2_100:
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_101:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 245 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_95:
+.Lf2_97:
+    .loc 1 240 20
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_96
+.Lf2_94:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_84:
+    .loc 1 235 30
+    incl -340(%rbp)
+.Lf2_86:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_85
+.Lf2_83:
+    addq $8, %rsp
+    .loc 1 250 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 251 9
+    .p2align 4,,10
+.Lf2_106:
+    .loc 1 252 13
+    movq $90, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $63, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_107
+    jmp .Lf2_104
+.Lf2_107:
+    .loc 1 253 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_108
+    jmp .Lf2_109
+.Lf2_108:
+    movq $10, %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_111
+    jmp .Lf2_112
+.Lf2_111:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_113
+.Lf2_112:
+    cmpl $94, -340(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf2_113:
+    jmp .Lf2_110
+.Lf2_109:
+    movq $2, %rax
+    push %rax
+    movq $29, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -52(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_110:
+    movl %eax, -80(%rbp)
+    .loc 1 255 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 256 17
+    .p2align 4,,10
+.Lf2_116:
+    .loc 1 257 21
+    movslq -344(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $48, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $27, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 258 21
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_118
+    jmp .Lf2_117
+.Lf2_118:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_117:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_120
+    jmp .Lf2_119
+.Lf2_120:
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_121
+    jmp .Lf2_122
+.Lf2_121:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_123
+.Lf2_122:
+    movslq -344(%rbp), %rax
+.Lf2_123:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_119:
+    movl %eax, -12(%rbp)
+    .loc 1 259 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_125
+    jmp .Lf2_124
+.Lf2_125:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_124:
+    push %rax
+    cmpl $86, -344(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $57, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 260 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_115:
+    .loc 1 261 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_116
+.Lf2_114:
+    addq $0, %rsp
+    .loc 1 263 13
+    cmpl $59, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_126
+    jmp .Lf2_127
+.Lf2_126:
+    movq $55, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_128
+.Lf2_127:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_128:
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_130
+    jmp .Lf2_129
+.Lf2_130:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_129:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 264 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_105:
+    .loc 1 265 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_106
+.Lf2_104:
+    addq $8, %rsp
+    .loc 1 268 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 269 9
+    jmp .Lf2_134
+    .p2align 4,,10
+.Lf2_133:
+    .loc 1 270 13
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $72, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $47, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $61, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 271 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_135
+    jmp .Lf2_136
+.Lf2_135:
+    movq $54, %rax
+    jmp .Lf2_137
+.Lf2_136:
+    movslq -340(%rbp), %rax
+.Lf2_137:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_138
+    jmp .Lf2_139
+.Lf2_138:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_140
+.Lf2_139:
+    movslq -8(%rbp), %rax
+.Lf2_140:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_141
+    jmp .Lf2_142
+.Lf2_141:
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_143
+.Lf2_142:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_143:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 272 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_149
+    .p2align 4,,10
+.Lf2_148:
+    .loc 1 273 17
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_150
+    jmp .Lf2_151
+.Lf2_150:
+    movq $19, %rax
+    jmp .Lf2_152
+.Lf2_151:
+    movslq -12(%rbp), %rax
+.Lf2_152:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_154
+    jmp .Lf2_153
+.Lf2_154:
+    cmpl $17, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_153:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_155
+    jmp .Lf2_156
+.Lf2_155:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_157
+.Lf2_156:
+    movq $37, %rax
+.Lf2_157:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 274 17
+    movq $53, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_162
+    jmp .Lf2_161
+.Lf2_162:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_161:
+    cmpq $0, %rax
+    jne .Lf2_158
+    jmp .Lf2_159
+.Lf2_158:
+    movq $6, %rax
+    push %rax
+    cmpl $20, -76(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_160
+.Lf2_159:
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_164
+    jmp .Lf2_163
+.Lf2_164:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_166
+    jmp .Lf2_165
+.Lf2_166:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_165:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_163:
+.Lf2_160:
+    movl %eax, -12(%rbp)
+    .loc 1 275 17
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_168
+    jmp .Lf2_167
+.Lf2_168:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_167:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_169
+    jmp .Lf2_170
+.Lf2_169:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_171
+.Lf2_170:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf2_171:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    imulq $53, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_173
+    jmp .Lf2_172
+.Lf2_173:
+    movslq -340(%rbp), %rax
+    subq $32, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_172:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_147:
+    .loc 1 272 38
+    incl -344(%rbp)
+.Lf2_149:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_148
+.Lf2_146:
+    addq $0, %rsp
+    .loc 1 277 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_132:
+.Lf2_134:
+    .loc 1 269 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_133
+.Lf2_131:
+    addq $8, %rsp
+    .loc 1 280 5
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $73, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_175
+    jmp .Lf2_174
+.Lf2_175:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_174:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $86, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 281 5
+    movq $5, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_177
+    jmp .Lf2_178
+.Lf2_177:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf2_179
+.Lf2_178:
+    movslq -16(%rbp), %rax
+.Lf2_179:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_180
+    jmp .Lf2_181
+.Lf2_180:
+    movslq -24(%rbp), %rax
+    jmp .Lf2_182
+.Lf2_181:
+    movq $40, %rax
+.Lf2_182:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_183
+    .loc 1 282 9
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_185
+    jmp .Lf2_184
+.Lf2_185:
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_184:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_187
+    jmp .Lf2_186
+.Lf2_187:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -20(%rbp)
+    .loc 1 283 9
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_189
+    jmp .Lf2_188
+.Lf2_189:
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_188:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_193
+    jmp .Lf2_194
+.Lf2_193:
+    movq $16, %rax
+    jmp .Lf2_195
+.Lf2_194:
+    movslq -4(%rbp), %rax
+.Lf2_195:
+    cmpq $0, %rax
+    jne .Lf2_190
+    jmp .Lf2_191
+.Lf2_190:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_192
+.Lf2_191:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_196
+    jmp .Lf2_197
+.Lf2_196:
+    movslq -72(%rbp), %rax
+    jmp .Lf2_198
+.Lf2_197:
+    movslq -12(%rbp), %rax
+.Lf2_198:
+.Lf2_192:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 284 9
+    movslq -28(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_203
+    jmp .Lf2_202
+.Lf2_203:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_202:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_199
+    jmp .Lf2_200
+.Lf2_199:
+    movslq -12(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_205
+    jmp .Lf2_204
+.Lf2_205:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_204:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_201
+.Lf2_200:
+    movq $5, %rax
+    push %rax
+    movq $94, %rax
+    cmpq $64, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_201:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_176
+.Lf2_183:
+    .loc 1 286 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_206
+    jmp .Lf2_207
+.Lf2_206:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf2_208
+.Lf2_207:
+    movq $34, %rax
+.Lf2_208:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 287 9
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_210
+    jmp .Lf2_209
+.Lf2_210:
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_209:
+    push %rax
+    movq $51, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 288 9
+    movslq -48(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_212
+    jmp .Lf2_211
+.Lf2_212:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_214
+    jmp .Lf2_213
+.Lf2_214:
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_213:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_211:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_176:
+    .loc 1 290 5
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_216
+    jmp .Lf2_217
+.Lf2_216:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf2_218
+.Lf2_217:
+    movq $39, %rax
+.Lf2_218:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lf2_219
+    .loc 1 291 9
+    movq $5, %rax
+    push %rax
+    cmpl $98, -40(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 292 9
+    movslq -8(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_224
+    jmp .Lf2_223
+.Lf2_224:
+    movq $37, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_223:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_220
+    jmp .Lf2_221
+.Lf2_220:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_226
+    jmp .Lf2_225
+.Lf2_226:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_225:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_222
+.Lf2_221:
+    cmpl $74, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_228
+    jmp .Lf2_227
+.Lf2_228:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_227:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_222:
+    movl %eax, -12(%rbp)
+    .loc 1 293 9
+    movq $8, %rax
+    push %rax
+    cmpl $24, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_229
+    jmp .Lf2_230
+.Lf2_229:
+    movq $2, %rax
+    jmp .Lf2_231
+.Lf2_230:
+    movq $70, %rax
+.Lf2_231:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_215
+.Lf2_219:
+    .loc 1 295 9
+    movq $2, %rax
+    push %rax
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_233
+    jmp .Lf2_232
+.Lf2_233:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_232:
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 296 9
+    cmpl $50, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_235
+    jmp .Lf2_234
+.Lf2_235:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_234:
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_237
+    jmp .Lf2_236
+.Lf2_237:
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_236:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -56(%rbp)
+    .loc 1 297 9
+    movq $72, %rax
+    cmpq $0, %rax
+    jne .Lf2_241
+    jmp .Lf2_242
+.Lf2_241:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf2_243
+.Lf2_242:
+    movslq -4(%rbp), %rax
+.Lf2_243:
+    cmpq $0, %rax
+    jne .Lf2_238
+    jmp .Lf2_239
+.Lf2_238:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_240
+.Lf2_239:
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_240:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_244
+    jmp .Lf2_245
+.Lf2_244:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_246
+.Lf2_245:
+    movq $5, %rax
+    push %rax
+    movq $17, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_246:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+.Lf2_215:
+    .loc 1 299 5
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_249
+    jmp .Lf2_248
+.Lf2_249:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $11, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_248:
+    cmpq $0, %rax
+    je .Lf2_250
+    .loc 1 300 9
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_252
+    jmp .Lf2_251
+.Lf2_252:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_254
+    jmp .Lf2_253
+.Lf2_254:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_253:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_251:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 301 9
+    movq $6, %rax
+    push %rax
+    movq $36, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_256
+    jmp .Lf2_255
+.Lf2_256:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_255:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 302 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_258
+    jmp .Lf2_257
+.Lf2_258:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_257:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $57, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_247
+.Lf2_250:
+    .loc 1 304 9
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_259
+    jmp .Lf2_260
+.Lf2_259:
+    movq $40, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_263
+    jmp .Lf2_262
+.Lf2_263:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_262:
+    jmp .Lf2_261
+.Lf2_260:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_261:
+    push %rax
+    movq $75, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_264
+    jmp .Lf2_265
+.Lf2_264:
+    movq $21, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_268
+    jmp .Lf2_267
+.Lf2_268:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_267:
+    jmp .Lf2_266
+.Lf2_265:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_270
+    jmp .Lf2_269
+.Lf2_270:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_269:
+.Lf2_266:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 305 9
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_272
+    jmp .Lf2_271
+.Lf2_272:
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_271:
+    push %rax
+    cmpl $31, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $84, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 306 9
+    movq $1, %rax
+    push %rax
+    movq $83, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_277
+    jmp .Lf2_276
+.Lf2_277:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_276:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_273
+    jmp .Lf2_274
+.Lf2_273:
+    movslq -12(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_278
+    jmp .Lf2_279
+.Lf2_278:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_280
+.Lf2_279:
+    movq $68, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_280:
+    jmp .Lf2_275
+.Lf2_274:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $34, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_281
+    jmp .Lf2_282
+.Lf2_281:
+    movslq -44(%rbp), %rax
+    subq $69, %rax
+    movslq %eax, %rax
+    jmp .Lf2_283
+.Lf2_282:
+    movq $21, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_283:
+.Lf2_275:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_247:
+    .loc 1 308 5
+    cmpl $99, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_288
+    jmp .Lf2_287
+.Lf2_288:
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_287:
+    cmpq $0, %rax
+    jne .Lf2_284
+    jmp .Lf2_285
+.Lf2_284:
+    movslq -4(%rbp), %rax
+    addq $94, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $92, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_286
+.Lf2_285:
+    movq $6, %rax
+    push %rax
+    movq $82, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_286:
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
@@ -0,0 +1,441 @@
+int f0() {
+    int v0 = 77;
+    int v1 = 9;
+    int v2 = 33;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[7] = (((61 < 86) * (8 < a0[14])) * ((v0 != 21) + (92 && v3)));
+            a0[9] = (((a0[3] % 4) + (v0 ? a1[2][1] : a0[10])) / 8);
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v0 = (((a1[3][12] ? i1 : 7) ? (a0[10] / 8) : (i1 + i1)) + ((61 + v3) < (a0[12] || v1)));
+                a0[5] = (((16 <= v1) == (i0 >= v2)) == ((v2 + v2) ? (v1 / 3) : (a1[2][9] && a0[11])));
+                a0[3] = (((a0[11] == v3) && (53 != a0[13])) <= ((a1[1][1] ? v1 : i0) > (37 ? i1 : v3)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v2 % 4) > (v1 == v1)) == ((10 + a0[11]) ? (a1[2][10] < v3) : (v0 != v3)))) {
+        v0 = (((13 < a0[12]) + (48 / 8)) ? ((v2 != 86) % 6) : ((63 == v0) + (6 - v0)));
+        v3 = (((v2 - 26) != (a1[3][5] % 1)) ? ((v1 ? v1 : a0[6]) % 8) : ((99 * 73) >= (a1[3][12] + 8)));
+        v0 = (((v3 == v2) >= (29 / 7)) - ((a1[3][5] == v0) >= (v3 / 4)));
+    } else {
+        v0 = (((a0[6] ? v2 : v3) == (19 == v2)) ? ((v3 + v0) ? (v3 != v3) : (47 < 7)) : ((a0[10] > 87) || (92 ? a1[1][4] : v1)));
+        v0 = (((v3 > v0) == (56 % 7)) > ((a1[0][14] ? a1[3][6] : 77) == (v1 <= 98)));
+        v1 = (((29 ? v3 : v3) != (v0 * a1[3][14])) % 1);
+    }
+    if ((((v2 <= v3) > (v3 >= v2)) ? ((a0[15] != v1) + (v0 >= 76)) : ((v0 % 8) - (v3 ? a1[3][1] : v1)))) {
+        v2 = (((v3 != v2) > (v0 > v1)) / 3);
+        v2 = (((v2 > 20) * (v0 <= v1)) >= ((a0[7] <= 5) - (47 ? 82 : 2)));
+        v3 = (((7 * v0) % 9) < ((v1 >= v1) % 1));
+    } else {
+        v3 = (((36 % 1) - (48 * v3)) && ((3 >= 41) < (36 - 80)));
+        v3 = (((a1[1][0] > v0) / 5) ? ((61 >= 1) && (a0[7] ? a0[11] : a1[2][11])) : ((89 ? 98 : v2) * (12 || v2)));
+        v0 = (((11 / 4) || (a1[2][15] / 3)) && ((v3 > v1) % 3));
+    }
+    v2 = (((v2 && 23) <= (a1[3][7] + v2)) <= ((a1[2][15] % 2) > (12 ? a1[1][2] : v1)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((v0 == a1[0][7]) && (90 ? a0[4] : 93)) != ((a1[2][0] == v0) / 9));
+        v1 = (((a1[1][7] * v0) ? (a1[0][14] == v2) : (v0 <= v3)) - ((a1[3][13] - v3) > (a0[2] - 67)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            if ((22 >= i3) > 86) break;
+            v3 = (((i2 || a1[0][3]) == (a1[0][10] - i2)) % 4);
+            a0[15] = (((a0[12] >= v3) != (v0 >= 63)) > ((43 / 5) <= (i3 || 54)));
+            v0 = (((a1[2][1] == 44) <= (a0[14] + 17)) <= ((v1 % 3) < (a0[12] - v2)));
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v3 = (((v3 ? 92 : v2) >= (80 < v2)) % 9);
+        {
+            int i5 = 0;
+            while (i5 < 8) {
+                v3 = (((a1[0][1] < a1[0][4]) >= (i4 || a0[5])) / 2);
+                a0[7] = (((57 || i4) >= (a1[3][6] < 80)) + ((v3 > a0[12]) <= (i4 * 44)));
+                v2 = (((v2 / 2) > (a1[2][7] % 6)) * ((a1[1][8] > v3) || (15 == i5)));
+                i5 = i5 + 1;
+            }
+        }
+        v1 = (((v3 % 6) / 7) || ((i4 ? 38 : v2) <= (a0[15] * a1[3][14])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v1 = (((v2 - i6) + (47 < a1[2][15])) != ((v1 ? i6 : v0) / 4));
+            {
+                int i7 = 0;
+                do {
+                    a0[8] = (((v0 && v2) > (v3 <= v3)) > ((a0[5] > a1[0][12]) <= (i6 / 2)));
+                    v2 = (((i6 / 5) != (i7 || v3)) < ((i6 || v2) ? (v1 ? v3 : i7) : (a0[11] != v0)));
+                    a0[1] = (((v3 && i6) && (i7 - 59)) != ((a0[13] ? 77 : v1) < (v2 + i7)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            v0 = (((a0[6] != a1[2][3]) + (56 ? a0[0] : 77)) > ((v2 != v3) + (i6 / 8)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            if ((v1 != 51) > 91) break;
+            {
+                int i9 = 0;
+                do {
+                    if ((89 - i9) > 59) break;
+                    v3 = (((96 + 23) > (v0 && i9)) ? ((65 - v3) * (41 ? 68 : 53)) : ((a1[0][3] >= v2) || (v2 && a1[1][2])));
+                    v0 = (((v1 + v0) == (79 >= a1[1][4])) ? ((v1 / 8) == (a1[0][5] != a1[0][3])) : ((a0[3] - a0[12]) != (v3 > 73)));
+                    v3 = (((v0 >= v0) / 9) % 7);
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            v0 = (((v0 == i8) > (v1 ? a0[5] : 11)) + ((v2 - v0) < (v3 > i8)));
+            v3 = (((v1 < 33) > (67 / 5)) == ((v2 / 8) >= (a0[14] ? v1 : i8)));
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        if ((97 % 1) > 86) break;
+        {
+            int i11 = 0;
+            do {
+                v0 = (((i10 < 72) / 7) - ((i11 || 10) <= (69 % 7)));
+                v1 = (((a0[14] || v3) ? (a1[1][5] * i10) : (v1 <= a0[12])) == ((v3 + v3) || (18 != a1[1][11])));
+                a1[1][1] = (((16 || 21) + (i11 == a1[3][9])) != ((a1[2][15] + 18) <= (v0 / 9)));
+                i11 = i11 + 1;
+            } while (i11 < 7);
+        }
+        v1 = (((42 ? a0[7] : a1[0][9]) < (a0[2] - v3)) == ((v2 + 77) >= (v1 >= a0[4])));
+        v3 = (((i10 && a1[2][3]) > (v3 == i10)) == ((a0[13] >= v0) - (a0[14] ? v0 : v2)));
+    }
+    {
+        int i12 = 0;
+        while (i12 < 3) {
+            {
+                int i13 = 0;
+                do {
+                    if ((v1 ? i12 : i12) > 53) break;
+                    v0 = (((68 ? 81 : a0[8]) / 3) - ((a1[2][3] || 73) % 7));
+                    v3 = (((a0[15] + 9) && (v3 || v2)) != ((v0 && 48) != (v3 || i12)));
+                    v0 = (((i13 - i12) <= (i13 + 24)) >= ((i13 ? v1 : a1[2][7]) / 7));
+                    i13 = i13 + 1;
+                } while (i13 < 3);
+            }
+            a0[2] = (((18 ? a0[10] : v0) || (a1[2][11] ? v3 : v2)) && ((i12 * 87) || (v3 != v3)));
+            a0[14] = (((i12 < a0[10]) % 4) * ((a0[13] || a1[3][10]) ? (31 % 2) : (v1 % 2)));
+            i12 = i12 + 1;
+        }
+    }
+    return (((v3 > v2) > (v1 || a0[3])) ? ((73 ? v1 : a0[10]) ? (v3 || v1) : (a0[8] > v0)) : ((50 - 82) == (a0[14] ? v1 : v3)));
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 66;
+    int v2 = 41;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][12] ? a1[1][0] : a0[1]) < (v0 && 8)) ? ((v3 || v2) > (40 / 9)) : ((v2 + v2) - (v2 && 76)))) {
+        a1[3][0] = (((v2 != v0) - (75 >= 2)) ? ((22 ? 21 : v2) + (34 && v2)) : ((a0[11] >= v0) ? (a0[0] > a0[11]) : (32 % 6)));
+        v1 = (((v2 - 88) == (v2 / 7)) ? ((v2 + v2) || (a0[4] != v0)) : ((v2 - v3) >= (v3 / 8)));
+        a0[7] = (((v0 + 95) + (41 + v3)) <= ((a1[1][6] ? a0[6] : a1[1][5]) != (a1[3][12] * v1)));
+    } else {
+        a1[1][12] = (((36 * 42) ? (0 && v0) : (v1 ? v3 : a1[0][3])) / 9);
+        a0[9] = (((v1 < v1) <= (40 / 4)) ? ((89 > v0) ? (v2 * v0) : (a1[3][13] % 5)) : ((99 <= a1[1][4]) > (v2 && v0)));
+        v0 = (((v1 - v3) >= (v2 > a1[0][4])) || ((96 / 8) >= (3 == v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v1 > a1[0][14]) > 88) break;
+            v1 = (((v2 <= i0) % 5) >= ((a0[5] % 7) > (i0 + v0)));
+            v3 = (((i0 / 9) || (a1[0][0] >= v1)) / 7);
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v0 - v0) % 8) >= ((a1[3][2] < a0[3]) != (93 > v2)));
+                    v2 = (((99 && a1[0][6]) || (v3 % 8)) != ((v3 / 8) - (a0[1] < 90)));
+                    a1[0][2] = (((a0[0] + 6) || (v0 ? 70 : v3)) ? ((v0 ? i0 : 28) < (v1 >= 42)) : ((v3 - a0[12]) + (v0 > i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    a0[8] = (((v0 / 6) / 3) > ((a1[2][11] >= a1[0][2]) / 8));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((76 * 28) > 56) break;
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v3 = (((a1[0][14] ? a0[1] : a0[1]) * (a1[2][13] < i2)) == ((a1[1][9] > a1[3][14]) && (24 % 1)));
+            v3 = (((i2 / 6) < (v2 % 5)) || ((i3 ? 42 : v2) < (v2 <= i2)));
+            v0 = (((v2 + i2) >= (v1 * i3)) - ((16 < 64) / 5));
+        }
+        v0 = (((a1[1][11] * a0[13]) / 2) == ((70 + a0[5]) + (v0 <= 96)));
+        a0[4] = (((v0 ? v0 : 47) > (v1 < v2)) * ((v3 / 9) ? (a0[2] / 5) : (95 - 67)));
+    }
+    v1 = (((7 == 37) * (74 == 61)) / 2);
+    v2 = (((v1 + v1) + (v0 * v3)) <= ((a0[13] * v2) + (v3 ? 65 : v2)));
+    v2 = (((v1 - 1) < (93 <= v3)) > ((a0[3] - 40) && (v2 - v0)));
+    v1 = (((a0[9] * v1) ? (a0[13] == a1[3][15]) : (v0 == a0[14])) <= ((v3 && v0) != (29 > a0[8])));
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            v1 = (((v0 > i4) - (i5 / 3)) % 5);
+            v0 = (((a1[1][6] != a1[0][7]) && (i5 == v0)) < ((92 < a0[14]) != (v1 * 41)));
+            a1[1][3] = (((27 / 2) != (i5 % 9)) != ((a0[8] == 64) <= (v0 >= v3)));
+        }
+        v1 = (((v1 + v2) && (86 - a1[1][15])) % 4);
+        v1 = (((49 ? a1[2][6] : 93) ? (a1[3][15] > a0[13]) : (13 % 9)) < ((v3 > i4) - (v3 / 7)));
+    }
+    if ((((v0 || v1) > (v0 >= a0[8])) > ((17 <= v2) && (62 && 74)))) {
+        v2 = (((a0[12] ? v2 : a1[1][4]) > (a0[9] && 37)) < ((v1 - v3) > (71 < 25)));
+        v1 = (((v3 / 6) % 4) || ((a0[7] ? a0[15] : 2) >= (39 < a0[15])));
+        v0 = (((a0[7] * v3) + (92 >= a1[2][5])) > ((62 ? v2 : a1[1][5]) && (99 != 55)));
+    } else {
+        v3 = (((v2 && v2) - (v2 >= v2)) - ((a0[5] * v0) || (v3 + v2)));
+        v1 = (((v1 + v0) - (a0[15] >= v0)) <= ((89 - v2) <= (a0[11] - v2)));
+        v0 = (((a0[6] == v0) - (v0 <= v1)) / 9);
+    }
+    return (((a1[3][6] >= 12) >= (v1 ? a0[1] : a1[2][12])) + ((v3 == v1) % 5));
+}
+int f2() {
+    int v0 = 29;
+    int v1 = 40;
+    int v2 = 95;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v0 = (((a0[3] / 6) ? (v3 != a0[2]) : (v1 == v1)) / 8);
+            {
+                int i1 = 0;
+                do {
+                    if ((76 > a0[9]) > 63) break;
+                    v2 = (((v3 || v0) ? (96 >= i1) : (41 >= v3)) * ((32 <= v1) <= (v1 - v2)));
+                    v0 = (((a1[1][14] || i1) / 6) % 4);
+                    a0[2] = (((a0[10] - a0[4]) < (59 * 91)) != ((i1 > a0[11]) < (a0[7] < i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((v1 != v1) == (45 / 3)) < ((a0[9] <= i0) >= (77 % 1)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v1 = (((v1 - a0[8]) >= (i2 - v0)) != ((i3 / 1) ? (a0[11] * v3) : (a0[9] + 61)));
+                v3 = (((v3 < i2) * (39 != 57)) ? ((i3 == a0[14]) == (a1[1][14] >= v3)) : ((v0 != 90) != (a1[1][3] > 70)));
+                v1 = (((i2 == i3) <= (16 * v3)) / 2);
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        v0 = (((a0[7] || i2) + (98 ? 91 : v1)) < ((v3 + a0[4]) >= (91 && 8)));
+        a1[3][11] = (((a0[8] ? v3 : v1) > (v0 && v2)) < ((a0[6] != v3) > (a0[7] >= a1[1][7])));
+    }
+    if ((((57 != v2) || (70 > 3)) ? ((v0 * v3) + (a1[2][9] % 9)) : ((v0 ? v1 : 75) <= (37 <= a1[3][8])))) {
+        a1[3][9] = (((v1 <= v0) <= (v0 ? 39 : a0[2])) ? ((v1 / 1) > (v0 != v0)) : ((v2 ? v2 : a0[8]) || (v0 >= a1[1][4])));
+        v3 = (((a1[3][13] <= 51) + (v2 % 9)) ? ((v0 - v2) + (44 + v1)) : ((a0[0] == 96) < (a1[3][8] / 7)));
+        a1[2][6] = (((v3 > 25) || (v0 || v0)) % 5);
+    } else {
+        v1 = (((v2 + a1[0][7]) >= (a0[2] >= 66)) < ((46 > v0) % 1));
+        a1[0][13] = (((v2 > a0[1]) < (v3 + v1)) - ((a0[6] ? v0 : a0[3]) || (a0[2] > v0)));
+        a0[6] = (((5 || 71) < (a1[0][12] > v2)) > ((v1 * 93) ? (10 ? 77 : v2) : (v3 ? v0 : a1[3][1])));
+    }
+    if ((((15 > v3) + (a0[14] != 92)) <= ((v0 > a0[0]) ? (v1 < a1[0][5]) : (a1[1][0] > v1)))) {
+        v2 = (((v1 != a0[4]) ? (a0[1] - a0[6]) : (a1[1][4] / 2)) % 5);
+        v2 = (((a0[11] && v3) != (54 % 3)) - ((v2 > 70) >= (v3 <= a1[0][1])));
+        a0[7] = (((v2 ? a1[1][7] : a0[12]) || (v1 < a1[0][10])) || ((v2 <= a1[2][3]) % 3));
+    } else {
+        v3 = (((38 ? a0[2] : a1[3][7]) / 9) > ((v2 / 4) ? (a1[1][0] + 49) : (60 + v1)));
+        a0[12] = (((a1[1][12] <= 27) - (59 > v2)) + ((90 != a1[2][14]) == (29 < a1[3][11])));
+        v2 = (((v3 / 8) < (v1 ? v0 : a1[3][5])) - ((v2 % 5) % 3));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v2 = (((v3 || 93) > (a1[3][15] == i4)) && ((i4 != 25) < (43 ? 37 : v3)));
+        a1[1][10] = (((v1 != i4) < (15 - v1)) <= ((v0 % 8) ? (i4 ? i4 : 50) : (a0[9] <= a0[6])));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v0 = (((v1 <= 36) - (49 == i4)) - ((99 > v3) + (a0[1] > 19)));
+            a1[3][6] = (((v1 + a1[2][4]) > (a0[8] >= 78)) <= ((a0[15] != v1) - (v2 <= v2)));
+            v0 = (((v1 != a0[6]) != (v0 == v1)) == ((i4 ? v3 : a0[2]) >= (31 ? 48 : v2)));
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            a1[3][5] = (((a0[10] <= 21) + (v0 + a1[1][9])) && ((17 && 9) != (i6 >= v2)));
+            a1[0][4] = (((v3 * a1[0][2]) > (v0 == 32)) < ((v0 < v3) < (v0 != v0)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    a1[1][6] = (((v0 + 27) && (i6 * a0[12])) / 5);
+                    v3 = (((82 < i7) ? (a0[2] * v0) : (a1[1][10] - a1[1][0])) ? ((v1 < 48) - (20 * 12)) : ((a1[3][10] >= v2) && (10 + a0[11])));
+                    v0 = (((a0[4] <= v2) || (11 || 78)) == ((34 < 31) ? (i6 % 4) : (12 ? v1 : a1[0][15])));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        a0[15] = (((i8 > v2) % 2) || ((57 * v3) * (v0 % 4)));
+        {
+            int i9 = 0;
+            do {
+                v1 = (((i8 % 6) ? (v1 >= 77) : (72 / 8)) != ((i9 < 86) % 5));
+                v1 = (((v3 > i9) <= (a1[1][15] / 1)) || ((v2 ? v3 : v1) % 8));
+                v3 = (((i8 % 8) <= (i8 ? a1[0][2] : v0)) ? ((v1 >= i9) || (40 % 5)) : ((v1 / 6) < (86 * 9)));
+                i9 = i9 + 1;
+            } while (i9 < 8);
+        }
+        v0 = (((i8 >= v0) ? (v2 % 2) : (a1[2][7] != a1[0][2])) - ((v1 > 16) && (a0[7] <= i8)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 5) {
+            v1 = (((a1[0][14] || v0) * (v1 > v0)) <= ((a0[15] == i10) / 3));
+            v3 = (((a0[6] - v2) ? (i10 >= v3) : (i10 / 2)) < ((v3 >= a1[0][7]) ? (v0 || v3) : (v0 * 47)));
+            {
+                int i11 = 0;
+                while (i11 < 5) {
+                    if ((10 <= 54) > 68) break;
+                    a0[7] = (((v2 != v1) != (13 > a1[0][13])) < ((v0 / 9) ? (v1 % 7) : (13 <= i11)));
+                    a0[12] = (((v1 <= 79) != (7 % 3)) > ((2 % 6) / 9));
+                    v2 = (((v3 / 3) != (a1[3][15] - v2)) ? ((a0[12] ? a1[2][14] : i11) != (17 * v1)) : ((47 / 1) + (v0 * 96)));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        }
+    }
+    {
+        int i12 = 0;
+        do {
+            v0 = (((i12 % 9) + (v3 != 72)) - ((v1 ? 26 : v2) <= (10 == a0[1])));
+            v3 = (((98 > a1[1][3]) + (a1[0][4] || i12)) != ((a0[11] < 6) ? (v0 * i12) : (v3 - v3)));
+            for (int i13 = 0; i13 < 3; i13 = i13 + 1) {
+                a0[2] = (((i12 || v1) ? (v0 ? i13 : 47) : (53 / 2)) * ((v2 != i13) >= (a1[1][4] == v1)));
+                v1 = (((v0 || i13) ? (a0[4] <= a0[11]) : (50 > 3)) % 7);
+                v3 = (((7 / 8) % 9) % 1);
+            }
+            i12 = i12 + 1;
+        } while (i12 < 2);
+    }
+    a1[3][11] = (((v3 * 87) + (a1[1][15] == v2)) || ((v0 ? a1[3][8] : v2) < (v2 >= 28)));
+    return (((29 >= v1) < (28 && v2)) / 3);
+}
+int f3() {
+    int v0 = 77;
+    int v1 = 56;
+    int v2 = 89;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a0[12] ? a0[4] : v0) > 80) break;
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((66 != a1[1][1]) > 71) break;
+                    v3 = (((89 ? 62 : i0) <= (a0[14] <= v3)) >= ((63 < a1[1][11]) != (v3 + 56)));
+                    v0 = (((v2 + 99) != (v2 || a0[9])) || ((v1 != v0) - (a1[3][9] != v0)));
+                    a1[3][2] = (((74 + a1[1][0]) || (a0[9] ? v1 : v0)) - ((a0[6] || 75) <= (a0[7] - 67)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a1[1][5] * v0) % 4) < ((i0 % 1) >= (a1[2][4] ? v3 : a0[6])));
+            v3 = (((v2 % 6) || (0 * a1[2][3])) == ((v0 <= v0) / 2));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        a1[1][5] = (((1 / 7) % 5) ? ((90 ? 78 : v1) + (v3 != v3)) : ((i2 % 3) + (a0[13] ? 57 : v3)));
+        v2 = (((74 && 94) + (88 && v3)) < ((v0 % 1) <= (v2 != 45)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v1 = (((a1[2][10] + v3) || (v2 > 6)) ? ((62 >= a0[5]) < (a0[0] ? v0 : i3)) : ((a1[1][9] % 7) / 6));
+            v1 = (((i3 * a0[11]) * (v3 - a1[1][5])) != ((v3 - 43) + (51 != a0[13])));
+            a1[3][7] = (((v3 > 45) >= (a0[12] * a0[2])) % 5);
+        }
+    }
+    v1 = (((7 / 3) % 3) + ((a0[2] / 9) || (v2 == v3)));
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v1 = (((1 * v2) / 9) / 9);
+        {
+            int i5 = 0;
+            do {
+                if ((i5 % 5) > 70) break;
+                v2 = (((32 ? v2 : 88) || (97 < v3)) ? ((i4 ? v2 : i4) == (a0[2] >= a1[0][7])) : ((55 / 1) ? (a1[0][2] && 97) : (a1[3][0] / 4)));
+                v3 = (((v0 * i4) ? (v1 < v2) : (v1 != v2)) - ((86 - 42) != (78 ? v2 : 0)));
+                v0 = (((v0 <= i5) % 3) ? ((i5 + v0) && (v2 - a1[0][0])) : ((a0[8] || 7) ? (v2 == v3) : (a1[2][4] ? v1 : v2)));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+        v3 = (((v1 && a0[6]) ? (v1 <= v1) : (v2 && 71)) % 4);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((v2 <= 66) > (54 < 39)) / 4);
+                    v0 = (((v0 - 36) != (i7 ? a1[0][15] : v0)) / 6);
+                    v2 = (((v0 - i6) % 7) != ((v0 > a0[15]) ? (81 % 2) : (v1 == v0)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            v0 = (((i6 / 1) >= (a1[1][12] + a1[0][4])) ? ((i6 < a0[15]) && (v2 / 9)) : ((a1[1][2] - 32) && (i6 / 4)));
+            v0 = (((v1 && i6) && (v1 > a0[14])) != ((i6 / 7) ? (i6 <= 39) : (a0[14] > v1)));
+            i6 = i6 + 1;
+        }
+    }
+    a1[3][4] = (((v1 != v0) ? (2 != a0[12]) : (v0 / 1)) - ((a1[1][3] * 9) <= (v3 == v3)));
+    v1 = (((v0 / 3) != (a0[8] != a0[6])) - ((v0 - a0[7]) <= (v0 == v2)));
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+                if ((v1 + v2) > 79) break;
+                a0[2] = (((51 + a1[1][9]) - (a0[11] / 2)) <= ((i8 ? v2 : a1[2][12]) / 8));
+                v0 = (((79 >= a1[0][3]) || (a1[1][5] - v2)) - ((v0 ? a1[0][1] : a1[2][5]) - (21 == a1[0][1])));
+                v2 = (((i9 && a0[11]) - (a1[1][8] < a0[5])) * ((v0 - a0[7]) ? (i9 + i9) : (7 || i8)));
+            }
+            a0[5] = (((94 >= v1) ? (a0[4] ? 3 : v2) : (1 == i8)) > ((v2 || i8) != (a0[15] || 75)));
+            a1[3][4] = (((v3 / 7) ? (i8 && 88) : (82 ? a0[11] : v1)) % 5);
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v0 ? v0 : v3) % 3) || ((v1 / 6) || (0 == a1[2][4])))) {
+        a0[3] = (((50 / 7) > (v3 < 75)) < ((v2 >= v0) / 3));
+        v2 = (((v1 != v2) * (73 || v2)) >= ((v0 > a1[3][5]) > (a1[2][14] ? v2 : 45)));
+        a0[5] = (((v0 > 29) > (v2 * 46)) <= ((v2 || v2) > (v3 < v0)));
+    } else {
+        a0[5] = (((48 % 4) / 7) && ((v3 % 4) >= (39 >= 95)));
+        a0[15] = (((a0[8] - v3) >= (v2 - a0[1])) + ((v3 * 92) < (v0 % 8)));
+        v2 = (((v2 < v1) && (v1 || v3)) || ((80 ? 40 : v1) ? (v2 && v2) : (28 / 5)));
+    }
+    if ((((v3 * a1[2][10]) <= (v0 + v3)) && ((v1 > v3) * (v0 / 3)))) {
+        v1 = (((65 >= a1[2][11]) - (50 || 33)) / 2);
+        v1 = (((v1 * v3) < (60 < a0[13])) && ((v2 + v3) + (v0 ? a1[2][2] : v0)));
+        v1 = (((v0 == v0) ? (v2 / 3) : (v1 - v2)) && ((76 + a1[0][14]) > (7 ? v0 : a0[6])));
+    } else {
+        v3 = (((v0 != v2) * (8 >= 55)) < ((v2 / 6) && (v3 - v1)));
+        v3 = (((47 - v0) / 9) && ((a1[3][8] / 7) * (v1 || 75)));
+        v2 = (((v0 > v1) % 9) >= ((a1[2][12] * a1[0][4]) / 3));
+    }
+    return (((a0[15] % 8) + (v0 / 6)) && ((v2 ? 98 : a0[13]) || (1 < 14)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
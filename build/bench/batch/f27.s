@@ -0,0 +1,9998 @@
+    .file 1 "build/bench/batch/f27.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 434 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 435 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 436 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 437 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 438 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 439 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 440 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $77, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $9, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $33, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $78, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_5
+    jmp .Lf0_4
+.Lf0_5:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_4:
+    push %rax
+    cmpl $21, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $61, %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 12 13
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_6
+    jmp .Lf0_7
+.Lf0_6:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf0_8
+.Lf0_7:
+    movslq -40(%rbp), %rax
+.Lf0_8:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 13 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 14 17
+    movq $61, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_15
+    jmp .Lf0_14
+.Lf0_15:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_14:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_19
+    jmp .Lf0_20
+.Lf0_19:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_21
+.Lf0_20:
+    movq $7, %rax
+.Lf0_21:
+    cmpq $0, %rax
+    jne .Lf0_16
+    jmp .Lf0_17
+.Lf0_16:
+    movq $8, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_18
+.Lf0_17:
+    movslq -344(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_18:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 15 17
+    movq $16, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_23
+.Lf0_22:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_24
+.Lf0_23:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_26
+    jmp .Lf0_25
+.Lf0_26:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_25:
+.Lf0_24:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -60(%rbp)
+    .loc 1 16 17
+    movslq -36(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_27
+.Lf0_28:
+    movq $53, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_27:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_29
+    jmp .Lf0_30
+.Lf0_29:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_31
+.Lf0_30:
+    movslq -340(%rbp), %rax
+.Lf0_31:
+    push %rax
+    movq $37, %rax
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_33
+.Lf0_32:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_34
+.Lf0_33:
+    movslq -16(%rbp), %rax
+.Lf0_34:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -68(%rbp)
+    addq $0, %rsp
+.Lf0_13:
+    .loc 1 13 38
+    incl -344(%rbp)
+    .loc 1 14 17
+    movq $61, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_36
+    jmp .Lf0_35
+.Lf0_36:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_35:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_40
+    jmp .Lf0_41
+.Lf0_40:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_42
+.Lf0_41:
+    movq $7, %rax
+.Lf0_42:
+    cmpq $0, %rax
+    jne .Lf0_37
+    jmp .Lf0_38
+.Lf0_37:
+    movq $8, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_39
+.Lf0_38:
+    movslq -344(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_39:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 15 17
+    movq $16, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_43
+    jmp .Lf0_44
+.Lf0_43:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_45
+.Lf0_44:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_47
+    jmp .Lf0_46
+.Lf0_47:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_46:
+.Lf0_45:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -60(%rbp)
+    .loc 1 16 17
+    movslq -36(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_49
+    jmp .Lf0_48
+.Lf0_49:
+    movq $53, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_48:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_51
+.Lf0_50:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_52
+.Lf0_51:
+    movslq -340(%rbp), %rax
+.Lf0_52:
+    push %rax
+    movq $37, %rax
+    cmpq $0, %rax
+    jne .Lf0_53
+    jmp .Lf0_54
+.Lf0_53:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_55
+.Lf0_54:
+    movslq -16(%rbp), %rax
+.Lf0_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -68(%rbp)
+    addq $0, %rsp
+.Lf0_12:
+    .loc 1 13 38
+    incl -344(%rbp)
+.Lf0_11:
+    addq $0, %rsp
+    .loc 1 18 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 19 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 21 5
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $10, %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_57
+    jmp .Lf0_58
+.Lf0_57:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_59
+.Lf0_58:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_59:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lf0_60
+    .loc 1 22 9
+    movq $8, %rax
+    push %rax
+    movq $48, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $13, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_62
+.Lf0_61:
+    movq $6, %rax
+    push %rax
+    cmpl $86, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_63
+.Lf0_62:
+    movq $6, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $63, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_63:
+    movl %eax, -4(%rbp)
+    .loc 1 23 9
+    movslq -12(%rbp), %rax
+    subq $26, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_64
+    jmp .Lf0_65
+.Lf0_64:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_68
+.Lf0_67:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_69
+.Lf0_68:
+    movslq -56(%rbp), %rax
+.Lf0_69:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_66
+.Lf0_65:
+    movq $99, %rax
+    imulq $73, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_66:
+    movl %eax, -16(%rbp)
+    .loc 1 24 9
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $29, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_56
+.Lf0_60:
+    .loc 1 26 9
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_73
+    jmp .Lf0_74
+.Lf0_73:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_75
+.Lf0_74:
+    movslq -16(%rbp), %rax
+.Lf0_75:
+    push %rax
+    movq $19, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_70
+    jmp .Lf0_71
+.Lf0_70:
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_76
+    jmp .Lf0_77
+.Lf0_76:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_78
+.Lf0_77:
+    movq $47, %rax
+    cmpq $7, %rax
+    movq $0, %rax
+    setl %al
+.Lf0_78:
+    jmp .Lf0_72
+.Lf0_71:
+    cmpl $87, -40(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_80
+    jmp .Lf0_79
+.Lf0_80:
+    movq $92, %rax
+    cmpq $0, %rax
+    jne .Lf0_81
+    jmp .Lf0_82
+.Lf0_81:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf0_83
+.Lf0_82:
+    movslq -8(%rbp), %rax
+.Lf0_83:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_79:
+.Lf0_72:
+    movl %eax, -4(%rbp)
+    .loc 1 27 9
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_84
+    jmp .Lf0_85
+.Lf0_84:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf0_86
+.Lf0_85:
+    movq $77, %rax
+.Lf0_86:
+    push %rax
+    cmpl $98, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 28 9
+    movq $1, %rax
+    push %rax
+    movq $29, %rax
+    cmpq $0, %rax
+    jne .Lf0_87
+    jmp .Lf0_88
+.Lf0_87:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_89
+.Lf0_88:
+    movslq -16(%rbp), %rax
+.Lf0_89:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_56:
+    .loc 1 30 5
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_92
+.Lf0_91:
+    cmpl $76, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_93
+.Lf0_92:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_95
+.Lf0_94:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf0_96
+.Lf0_95:
+    movslq -8(%rbp), %rax
+.Lf0_96:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf0_93:
+    cmpq $0, %rax
+    je .Lf0_97
+    .loc 1 31 9
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 32 9
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $20, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $47, %rax
+    cmpq $0, %rax
+    jne .Lf0_98
+    jmp .Lf0_99
+.Lf0_98:
+    movq $82, %rax
+    jmp .Lf0_100
+.Lf0_99:
+    movq $2, %rax
+.Lf0_100:
+    push %rax
+    cmpl $5, -52(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 33 9
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_90
+.Lf0_97:
+    .loc 1 35 9
+    movq $48, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $36, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_102
+    jmp .Lf0_101
+.Lf0_102:
+    movq $3, %rax
+    cmpq $41, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $36, %rax
+    subq $80, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_101:
+    movl %eax, -16(%rbp)
+    .loc 1 36 9
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_104
+.Lf0_103:
+    movq $61, %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_107
+    jmp .Lf0_106
+.Lf0_107:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_108
+    jmp .Lf0_109
+.Lf0_108:
+    movslq -36(%rbp), %rax
+    jmp .Lf0_110
+.Lf0_109:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf0_110:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_106:
+    jmp .Lf0_105
+.Lf0_104:
+    movq $12, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_112
+    jmp .Lf0_111
+.Lf0_112:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_111:
+    push %rax
+    movq $89, %rax
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_114
+.Lf0_113:
+    movq $98, %rax
+    jmp .Lf0_115
+.Lf0_114:
+    movslq -12(%rbp), %rax
+.Lf0_115:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_105:
+    movl %eax, -16(%rbp)
+    .loc 1 37 9
+    movq $4, %rax
+    push %rax
+    movq $11, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_118
+.Lf0_119:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_118:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_90:
+    .loc 1 39 5
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_120
+.Lf0_121:
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_120:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $12, %rax
+    cmpq $0, %rax
+    jne .Lf0_122
+    jmp .Lf0_123
+.Lf0_122:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -8(%rbp), %rax
+.Lf0_124:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 40 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_130
+    .p2align 4,,10
+.Lf0_129:
+    .loc 1 41 9
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_132
+    jmp .Lf0_131
+.Lf0_132:
+    movq $90, %rax
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movslq -64(%rbp), %rax
+    jmp .Lf0_135
+.Lf0_134:
+    movq $93, %rax
+.Lf0_135:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_131:
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 42 9
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    subq $67, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_136
+    jmp .Lf0_137
+.Lf0_136:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_138
+.Lf0_137:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_138:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 43 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_144
+    .p2align 4,,10
+.Lf0_143:
+    .loc 1 44 13
+    movq $22, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $86, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_145
+    jmp .Lf0_141
+.Lf0_145:
+    .loc 1 45 13
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_147
+    jmp .Lf0_146
+.Lf0_147:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_146:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 46 13
+    movslq -32(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $63, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $43, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_149
+    jmp .Lf0_148
+.Lf0_149:
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_148:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -20(%rbp)
+    .loc 1 47 13
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -24(%rbp), %rax
+    addq $17, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_142:
+    .loc 1 43 34
+    incl -344(%rbp)
+.Lf0_144:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_143
+.Lf0_141:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_128:
+    .loc 1 40 30
+    incl -340(%rbp)
+.Lf0_130:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_129
+.Lf0_127:
+    addq $8, %rsp
+    .loc 1 50 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_155
+    .p2align 4,,10
+.Lf0_154:
+    .loc 1 51 9
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_156
+    jmp .Lf0_157
+.Lf0_156:
+    movq $92, %rax
+    jmp .Lf0_158
+.Lf0_157:
+    movslq -12(%rbp), %rax
+.Lf0_158:
+    push %rax
+    movq $80, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 53 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 54 13
+    jmp .Lf0_162
+    .p2align 4,,10
+.Lf0_161:
+    .loc 1 55 17
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_164
+    jmp .Lf0_163
+.Lf0_164:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_163:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 56 17
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imulq $44, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_166
+    jmp .Lf0_165
+.Lf0_166:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_165:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $80, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 57 17
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_168
+    jmp .Lf0_167
+.Lf0_168:
+    movq $15, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_167:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 58 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_160:
+.Lf0_162:
+    .loc 1 54 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_161
+.Lf0_159:
+    addq $0, %rsp
+    .loc 1 61 9
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_170
+    jmp .Lf0_169
+.Lf0_170:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_171
+    jmp .Lf0_172
+.Lf0_171:
+    movq $38, %rax
+    jmp .Lf0_173
+.Lf0_172:
+    movslq -12(%rbp), %rax
+.Lf0_173:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_169:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_153:
+    .loc 1 50 30
+    incl -340(%rbp)
+.Lf0_155:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_154
+.Lf0_152:
+    addq $8, %rsp
+    .loc 1 64 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 65 9
+    jmp .Lf0_177
+    .p2align 4,,10
+.Lf0_176:
+    .loc 1 66 13
+    movq $47, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_179
+.Lf0_178:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -4(%rbp), %rax
+.Lf0_180:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 68 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 69 17
+    .p2align 4,,10
+.Lf0_183:
+    .loc 1 70 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_184
+.Lf0_185:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_184:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -60(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -48(%rbp)
+    .loc 1 71 21
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_187
+    jmp .Lf0_186
+.Lf0_187:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_192
+    jmp .Lf0_191
+.Lf0_192:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_191:
+    cmpq $0, %rax
+    jne .Lf0_188
+    jmp .Lf0_189
+.Lf0_188:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_193
+    jmp .Lf0_194
+.Lf0_193:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_195
+.Lf0_194:
+    movslq -344(%rbp), %rax
+.Lf0_195:
+    jmp .Lf0_190
+.Lf0_189:
+    movslq -36(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_190:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 72 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_197
+    jmp .Lf0_196
+.Lf0_197:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_196:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    movslq -344(%rbp), %rax
+    subq $59, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_200
+    jmp .Lf0_201
+.Lf0_200:
+    movq $77, %rax
+    jmp .Lf0_202
+.Lf0_201:
+    movslq -8(%rbp), %rax
+.Lf0_202:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -76(%rbp)
+    .loc 1 73 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_182:
+    .loc 1 74 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_183
+.Lf0_181:
+    addq $0, %rsp
+    .loc 1 76 13
+    movq $56, %rax
+    cmpq $0, %rax
+    jne .Lf0_203
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -80(%rbp), %rax
+    jmp .Lf0_205
+.Lf0_204:
+    movq $77, %rax
+.Lf0_205:
+    push %rax
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 77 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_175:
+.Lf0_177:
+    .loc 1 65 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_176
+.Lf0_174:
+    addq $8, %rsp
+    .loc 1 81 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 82 9
+    jmp .Lf0_209
+    .p2align 4,,10
+.Lf0_208:
+    .loc 1 83 13
+    cmpl $51, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $91, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_210
+    jmp .Lf0_206
+.Lf0_210:
+    .loc 1 85 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 86 17
+    .p2align 4,,10
+.Lf0_213:
+    .loc 1 87 21
+    movq $89, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_214
+    jmp .Lf0_211
+.Lf0_214:
+    .loc 1 88 21
+    movq $96, %rax
+    addq $23, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_215
+    jmp .Lf0_216
+.Lf0_215:
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_221
+.Lf0_220:
+    movq $68, %rax
+    jmp .Lf0_222
+.Lf0_221:
+    movq $53, %rax
+.Lf0_222:
+    push %rax
+    movq $65, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_217
+.Lf0_216:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_224
+    jmp .Lf0_223
+.Lf0_224:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_226
+    jmp .Lf0_225
+.Lf0_226:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_225:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_223:
+.Lf0_217:
+    movl %eax, -16(%rbp)
+    .loc 1 89 21
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_227
+    jmp .Lf0_228
+.Lf0_227:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_229
+.Lf0_228:
+    movslq -68(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $73, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_229:
+    movl %eax, -4(%rbp)
+    .loc 1 90 21
+    movq $7, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 91 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_212:
+    .loc 1 92 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_213
+.Lf0_211:
+    addq $0, %rsp
+    .loc 1 94 13
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_230
+    jmp .Lf0_231
+.Lf0_230:
+    movslq -60(%rbp), %rax
+    jmp .Lf0_232
+.Lf0_231:
+    movq $11, %rax
+.Lf0_232:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 95 13
+    cmpl $33, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $67, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_233
+    jmp .Lf0_234
+.Lf0_233:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_235
+.Lf0_234:
+    movslq -340(%rbp), %rax
+.Lf0_235:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 96 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_207:
+.Lf0_209:
+    .loc 1 82 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_208
+.Lf0_206:
+    addq $8, %rsp
+    .loc 1 99 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_241
+    .p2align 4,,10
+.Lf0_240:
+    .loc 1 100 9
+    movq $1, %rax
+    push %rax
+    movq $97, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_242
+    jmp .Lf0_238
+.Lf0_242:
+    .loc 1 102 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 103 13
+    .p2align 4,,10
+.Lf0_245:
+    .loc 1 104 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_247
+    jmp .Lf0_246
+.Lf0_247:
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_246:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $69, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    cmpl $72, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 105 17
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_252
+    jmp .Lf0_251
+.Lf0_252:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_251:
+    cmpq $0, %rax
+    jne .Lf0_248
+    jmp .Lf0_249
+.Lf0_248:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_250
+.Lf0_249:
+    movslq -8(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_250:
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_254
+    jmp .Lf0_253
+.Lf0_254:
+    movq $18, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_253:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 106 17
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_256
+    jmp .Lf0_255
+.Lf0_256:
+    movq $21, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_255:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    addq $18, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 107 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_244:
+    .loc 1 108 22
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_245
+.Lf0_243:
+    addq $0, %rsp
+    .loc 1 110 9
+    movq $42, %rax
+    cmpq $0, %rax
+    jne .Lf0_257
+    jmp .Lf0_258
+.Lf0_257:
+    movslq -52(%rbp), %rax
+    jmp .Lf0_259
+.Lf0_258:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf0_259:
+    push %rax
+    movslq -72(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $77, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 111 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_261
+    jmp .Lf0_260
+.Lf0_261:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_260:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_262
+    jmp .Lf0_263
+.Lf0_262:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_264
+.Lf0_263:
+    movslq -12(%rbp), %rax
+.Lf0_264:
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_239:
+    .loc 1 99 32
+    incl -340(%rbp)
+.Lf0_241:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_240
+.Lf0_238:
+    addq $8, %rsp
+    .loc 1 114 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 115 9
+    jmp .Lf0_268
+    .p2align 4,,10
+.Lf0_267:
+    .loc 1 117 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 118 17
+    .p2align 4,,10
+.Lf0_271:
+    .loc 1 119 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_273
+    jmp .Lf0_274
+.Lf0_273:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_275
+.Lf0_274:
+    movslq -340(%rbp), %rax
+.Lf0_275:
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_272
+    jmp .Lf0_269
+.Lf0_272:
+    .loc 1 120 21
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_277
+    jmp .Lf0_276
+.Lf0_277:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_276:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $68, %rax
+    cmpq $0, %rax
+    jne .Lf0_278
+    jmp .Lf0_279
+.Lf0_278:
+    movq $81, %rax
+    jmp .Lf0_280
+.Lf0_279:
+    movslq -48(%rbp), %rax
+.Lf0_280:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 121 21
+    movslq -20(%rbp), %rax
+    addq $9, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_282
+    jmp .Lf0_281
+.Lf0_282:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_284
+    jmp .Lf0_283
+.Lf0_284:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_283:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_281:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_286
+    jmp .Lf0_285
+.Lf0_286:
+    movq $48, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_285:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_288
+    jmp .Lf0_287
+.Lf0_288:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_287:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 122 21
+    movslq -344(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addq $24, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_289
+    jmp .Lf0_290
+.Lf0_289:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_291
+.Lf0_290:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_291:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 123 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_270:
+    .loc 1 124 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_271
+.Lf0_269:
+    addq $0, %rsp
+    .loc 1 126 13
+    movq $18, %rax
+    cmpq $0, %rax
+    jne .Lf0_292
+    jmp .Lf0_293
+.Lf0_292:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_294
+.Lf0_293:
+    movslq -4(%rbp), %rax
+.Lf0_294:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_296
+    jmp .Lf0_295
+.Lf0_296:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_297
+    jmp .Lf0_298
+.Lf0_297:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_299
+.Lf0_298:
+    movslq -12(%rbp), %rax
+.Lf0_299:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_295:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_301
+    jmp .Lf0_300
+.Lf0_301:
+    movslq -340(%rbp), %rax
+    imulq $87, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_303
+    jmp .Lf0_302
+.Lf0_303:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_302:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_300:
+    movl %eax, -72(%rbp)
+    .loc 1 127 13
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_308
+    jmp .Lf0_307
+.Lf0_308:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_307:
+    cmpq $0, %rax
+    jne .Lf0_304
+    jmp .Lf0_305
+.Lf0_304:
+    movq $2, %rax
+    push %rax
+    movq $31, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_306
+.Lf0_305:
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_306:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 128 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_266:
+.Lf0_268:
+    .loc 1 115 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_267
+.Lf0_265:
+    addq $8, %rsp
+    .loc 1 131 5
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_313
+    jmp .Lf0_312
+.Lf0_313:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_312:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_309
+    jmp .Lf0_310
+.Lf0_309:
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf0_317
+    jmp .Lf0_318
+.Lf0_317:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_319
+.Lf0_318:
+    movslq -40(%rbp), %rax
+.Lf0_319:
+    cmpq $0, %rax
+    jne .Lf0_314
+    jmp .Lf0_315
+.Lf0_314:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_321
+    jmp .Lf0_320
+.Lf0_321:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_320:
+    jmp .Lf0_316
+.Lf0_315:
+    movslq -48(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_316:
+    jmp .Lf0_311
+.Lf0_310:
+    movq $50, %rax
+    subq $82, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_322
+    jmp .Lf0_323
+.Lf0_322:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_324
+.Lf0_323:
+    movslq -16(%rbp), %rax
+.Lf0_324:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_311:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 133 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 134 5
+    subq $8, %rsp
+    movq $42, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 135 5
+    movq $66, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 136 5
+    subq $8, %rsp
+    movq $41, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 137 5
+    movq $68, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 138 5
+    subq $64, %rsp
+    .loc 1 139 5
+    subq $256, %rsp
+    .loc 1 140 5
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_5
+    jmp .Lf1_6
+.Lf1_5:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf1_7
+.Lf1_6:
+    movslq -76(%rbp), %rax
+.Lf1_7:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_9
+    jmp .Lf1_8
+.Lf1_9:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_8:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_2
+    jmp .Lf1_3
+.Lf1_2:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_11
+    jmp .Lf1_10
+.Lf1_11:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_10:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $40, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_4
+.Lf1_3:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_13
+    jmp .Lf1_12
+.Lf1_13:
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_12:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_4:
+    cmpq $0, %rax
+    je .Lf1_14
+    .loc 1 141 9
+    movq $75, %rax
+    cmpq $2, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_15
+    jmp .Lf1_16
+.Lf1_15:
+    movq $34, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_19
+    jmp .Lf1_18
+.Lf1_19:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_18:
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    jne .Lf1_20
+    jmp .Lf1_21
+.Lf1_20:
+    movq $21, %rax
+    jmp .Lf1_22
+.Lf1_21:
+    movslq -12(%rbp), %rax
+.Lf1_22:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_17
+.Lf1_16:
+    movslq -36(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_24
+.Lf1_23:
+    movslq -80(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_25
+.Lf1_24:
+    movq $6, %rax
+    push %rax
+    movq $32, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_25:
+.Lf1_17:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 142 9
+    movslq -12(%rbp), %rax
+    subq $88, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_26
+    jmp .Lf1_27
+.Lf1_26:
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_30
+    jmp .Lf1_29
+.Lf1_30:
+    movslq -64(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_29:
+    jmp .Lf1_28
+.Lf1_27:
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_28:
+    movl %eax, -8(%rbp)
+    .loc 1 143 9
+    movq $41, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $95, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_31
+    jmp .Lf1_32
+.Lf1_31:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_33
+.Lf1_32:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf1_33:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -52(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_1
+.Lf1_14:
+    .loc 1 145 9
+    movq $9, %rax
+    push %rax
+    movq $36, %rax
+    imulq $42, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_34
+    jmp .Lf1_35
+.Lf1_34:
+    movq $0, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_38
+    jmp .Lf1_37
+.Lf1_38:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_37:
+    jmp .Lf1_36
+.Lf1_35:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_39
+    jmp .Lf1_40
+.Lf1_39:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_41
+.Lf1_40:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf1_41:
+.Lf1_36:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 146 9
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $40, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_42
+    jmp .Lf1_43
+.Lf1_42:
+    movq $89, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_45
+    jmp .Lf1_46
+.Lf1_45:
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_47
+.Lf1_46:
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_47:
+    jmp .Lf1_44
+.Lf1_43:
+    movq $99, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_49
+    jmp .Lf1_48
+.Lf1_49:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_48:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_44:
+    movl %eax, -44(%rbp)
+    .loc 1 147 9
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    movq $8, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_1:
+    .loc 1 150 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 151 9
+    .p2align 4,,10
+.Lf1_54:
+    .loc 1 152 13
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $88, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_55
+    jmp .Lf1_52
+.Lf1_55:
+    .loc 1 153 13
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 154 13
+    movq $7, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_57
+    jmp .Lf1_56
+.Lf1_57:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_56:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 156 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 157 17
+    .p2align 4,,10
+.Lf1_60:
+    .loc 1 158 21
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $93, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 159 21
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_62
+    jmp .Lf1_61
+.Lf1_62:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_61:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_64
+    jmp .Lf1_63
+.Lf1_64:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    push %rax
+    cmpl $90, -76(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 160 21
+    movslq -80(%rbp), %rax
+    addq $6, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_69
+    jmp .Lf1_68
+.Lf1_69:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_70
+    jmp .Lf1_71
+.Lf1_70:
+    movq $70, %rax
+    jmp .Lf1_72
+.Lf1_71:
+    movslq -16(%rbp), %rax
+.Lf1_72:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_68:
+    cmpq $0, %rax
+    jne .Lf1_65
+    jmp .Lf1_66
+.Lf1_65:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_75
+.Lf1_74:
+    movq $28, %rax
+.Lf1_75:
+    push %rax
+    cmpl $42, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_67
+.Lf1_66:
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf1_67:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 161 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_59:
+    .loc 1 162 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_60
+.Lf1_58:
+    addq $0, %rsp
+    .loc 1 164 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_53:
+    .loc 1 165 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_54
+.Lf1_52:
+    addq $8, %rsp
+    .loc 1 167 5
+    movq $3, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -48(%rbp)
+    .loc 1 168 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_81
+    .p2align 4,,10
+.Lf1_80:
+    .loc 1 169 9
+    movq $76, %rax
+    imulq $28, %rax
+    movslq %eax, %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_82
+    jmp .Lf1_78
+.Lf1_82:
+    .loc 1 170 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_88
+    .p2align 4,,10
+.Lf1_87:
+    .loc 1 171 13
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_89
+    jmp .Lf1_90
+.Lf1_89:
+    movslq -76(%rbp), %rax
+    jmp .Lf1_91
+.Lf1_90:
+    movslq -76(%rbp), %rax
+.Lf1_91:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_93
+    jmp .Lf1_92
+.Lf1_93:
+    movq $1, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_92:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 172 13
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_95
+    jmp .Lf1_94
+.Lf1_95:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_96
+    jmp .Lf1_97
+.Lf1_96:
+    movq $42, %rax
+    jmp .Lf1_98
+.Lf1_97:
+    movslq -12(%rbp), %rax
+.Lf1_98:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_94:
+    movl %eax, -16(%rbp)
+    .loc 1 173 13
+    movq $5, %rax
+    push %rax
+    movq $16, %rax
+    cmpq $64, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_86:
+    .loc 1 170 34
+    incl -344(%rbp)
+.Lf1_88:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_87
+.Lf1_85:
+    addq $0, %rsp
+    .loc 1 175 9
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $96, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $70, %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 176 9
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_99
+    jmp .Lf1_100
+.Lf1_99:
+    movq $5, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_101
+.Lf1_100:
+    movq $95, %rax
+    subq $67, %rax
+    movslq %eax, %rax
+.Lf1_101:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_102
+    jmp .Lf1_103
+.Lf1_102:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_104
+.Lf1_103:
+    movq $47, %rax
+.Lf1_104:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    addq $0, %rsp
+.Lf1_79:
+    .loc 1 168 30
+    incl -340(%rbp)
+.Lf1_81:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_80
+.Lf1_78:
+    addq $8, %rsp
+    .loc 1 178 5
+    movq $2, %rax
+    push %rax
+    movq $74, %rax
+    cmpq $61, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    cmpq $37, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 179 5
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_105
+    jmp .Lf1_106
+.Lf1_105:
+    movq $65, %rax
+    jmp .Lf1_107
+.Lf1_106:
+    movslq -12(%rbp), %rax
+.Lf1_107:
+    push %rax
+    movslq -28(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 180 5
+    movslq -8(%rbp), %rax
+    subq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $93, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -68(%rbp), %rax
+    subq $40, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_109
+    jmp .Lf1_108
+.Lf1_109:
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_108:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 181 5
+    movslq -44(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_111
+.Lf1_110:
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_112
+.Lf1_111:
+    movslq -4(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_112:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+    push %rax
+    movq $29, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 182 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_120
+    .p2align 4,,10
+.Lf1_119:
+    .loc 1 183 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 184 13
+    movq $5, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 185 13
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_127
+    jmp .Lf1_126
+.Lf1_127:
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_126:
+    push %rax
+    movq $92, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $41, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 186 13
+    movq $2, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $64, -48(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_125:
+    .loc 1 183 34
+    incl -344(%rbp)
+    .loc 1 184 13
+    movq $5, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 185 13
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_129
+    jmp .Lf1_128
+.Lf1_129:
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_128:
+    push %rax
+    movq $92, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $41, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 186 13
+    movq $2, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $64, -48(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_124:
+    .loc 1 183 34
+    incl -344(%rbp)
+.Lf1_123:
+    addq $0, %rsp
+    .loc 1 188 9
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_131
+    jmp .Lf1_130
+.Lf1_131:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    movq $86, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_130:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 189 9
+    movq $49, %rax
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_136
+.Lf1_135:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_137
+.Lf1_136:
+    movq $93, %rax
+.Lf1_137:
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_133
+.Lf1_132:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_134
+.Lf1_133:
+    movq $9, %rax
+    push %rax
+    movq $13, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_134:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_118:
+    .loc 1 182 30
+    incl -340(%rbp)
+.Lf1_120:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_119
+.Lf1_117:
+    addq $8, %rsp
+    .loc 1 191 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_140
+    jmp .Lf1_139
+.Lf1_140:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_139:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $17, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_142
+    jmp .Lf1_141
+.Lf1_142:
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_144
+    jmp .Lf1_143
+.Lf1_144:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_143:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_141:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_145
+    .loc 1 192 9
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_146
+    jmp .Lf1_147
+.Lf1_146:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_148
+.Lf1_147:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf1_148:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_150
+    jmp .Lf1_149
+.Lf1_150:
+    movq $37, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_149:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $71, %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 193 9
+    movq $4, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_152
+    jmp .Lf1_151
+.Lf1_152:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_154
+.Lf1_153:
+    movslq -20(%rbp), %rax
+    jmp .Lf1_155
+.Lf1_154:
+    movq $2, %rax
+.Lf1_155:
+    push %rax
+    movq $39, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_151:
+    movl %eax, -8(%rbp)
+    .loc 1 194 9
+    movq $92, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -52(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $62, %rax
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_158
+.Lf1_157:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf1_158:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_159
+.Lf1_160:
+    movq $99, %rax
+    cmpq $55, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_159:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_138
+.Lf1_145:
+    .loc 1 196 9
+    movslq -60(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_162
+    jmp .Lf1_161
+.Lf1_162:
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_161:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_164
+    jmp .Lf1_163
+.Lf1_164:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_163:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 197 9
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $89, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 198 9
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_138:
+    .loc 1 200 5
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $12, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_165
+    jmp .Lf1_166
+.Lf1_165:
+    movslq -76(%rbp), %rax
+    jmp .Lf1_167
+.Lf1_166:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf1_167:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 202 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 203 5
+    subq $8, %rsp
+    movq $29, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 204 5
+    movq $40, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 205 5
+    subq $8, %rsp
+    movq $95, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 206 5
+    movq $41, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 207 5
+    subq $64, %rsp
+    .loc 1 208 5
+    subq $256, %rsp
+    .loc 1 210 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 211 9
+    jmp .Lf2_4
+    .p2align 4,,10
+.Lf2_3:
+    .loc 1 212 13
+    movq $8, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_5
+    jmp .Lf2_6
+.Lf2_5:
+    movslq -16(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_7
+.Lf2_6:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf2_7:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 214 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 215 17
+    .p2align 4,,10
+.Lf2_10:
+    .loc 1 216 21
+    movq $76, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $63, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_11
+    jmp .Lf2_8
+.Lf2_11:
+    .loc 1 217 21
+    movq $32, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_16
+    jmp .Lf2_15
+.Lf2_16:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_15:
+    cmpq $0, %rax
+    jne .Lf2_12
+    jmp .Lf2_13
+.Lf2_12:
+    movq $96, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_14
+.Lf2_13:
+    movq $41, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_14:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 218 21
+    movq $4, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_18
+    jmp .Lf2_17
+.Lf2_18:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_17:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 219 21
+    movslq -40(%rbp), %rax
+    subl -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $59, %rax
+    imulq $91, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -72(%rbp)
+    .loc 1 220 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_9:
+    .loc 1 221 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_10
+.Lf2_8:
+    addq $0, %rsp
+    .loc 1 223 13
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $45, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $77, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 224 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_2:
+.Lf2_4:
+    .loc 1 211 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_3
+.Lf2_1:
+    addq $8, %rsp
+    .loc 1 227 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_24
+    .p2align 4,,10
+.Lf2_23:
+    .loc 1 229 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 230 13
+    .p2align 4,,10
+.Lf2_27:
+    .loc 1 231 17
+    movslq -8(%rbp), %rax
+    subl -48(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_28
+    jmp .Lf2_29
+.Lf2_28:
+    movslq -36(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_30
+.Lf2_29:
+    movslq -44(%rbp), %rax
+    addq $61, %rax
+    movslq %eax, %rax
+.Lf2_30:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 232 17
+    movq $39, %rax
+    cmpq $57, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_32
+.Lf2_31:
+    movslq -344(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_33
+.Lf2_32:
+    cmpl $90, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_33:
+    movl %eax, -16(%rbp)
+    .loc 1 233 17
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $16, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 234 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_26:
+    .loc 1 235 22
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_27
+.Lf2_25:
+    addq $0, %rsp
+    .loc 1 237 9
+    movq $98, %rax
+    cmpq $0, %rax
+    jne .Lf2_34
+    jmp .Lf2_35
+.Lf2_34:
+    movq $91, %rax
+    jmp .Lf2_36
+.Lf2_35:
+    movslq -8(%rbp), %rax
+.Lf2_36:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_38
+    jmp .Lf2_37
+.Lf2_38:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_37:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_40
+    jmp .Lf2_39
+.Lf2_40:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_39:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 238 9
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_41
+    jmp .Lf2_42
+.Lf2_41:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_43
+.Lf2_42:
+    movslq -8(%rbp), %rax
+.Lf2_43:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_45
+    jmp .Lf2_44
+.Lf2_45:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_44:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -52(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_22:
+    .loc 1 227 30
+    incl -340(%rbp)
+.Lf2_24:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_23
+.Lf2_21:
+    addq $8, %rsp
+    .loc 1 240 5
+    movq $57, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_51
+    jmp .Lf2_50
+.Lf2_51:
+    movq $70, %rax
+    cmpq $3, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_50:
+    cmpq $0, %rax
+    jne .Lf2_47
+    jmp .Lf2_48
+.Lf2_47:
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_49
+.Lf2_48:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_52
+    jmp .Lf2_53
+.Lf2_52:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_54
+.Lf2_53:
+    movq $75, %rax
+.Lf2_54:
+    push %rax
+    movq $37, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf2_49:
+    cmpq $0, %rax
+    je .Lf2_55
+    .loc 1 241 9
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_59
+    jmp .Lf2_60
+.Lf2_59:
+    movq $39, %rax
+    jmp .Lf2_61
+.Lf2_60:
+    movslq -72(%rbp), %rax
+.Lf2_61:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_56
+    jmp .Lf2_57
+.Lf2_56:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_58
+.Lf2_57:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_62
+    jmp .Lf2_63
+.Lf2_62:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_64
+.Lf2_63:
+    movslq -48(%rbp), %rax
+.Lf2_64:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_66
+    jmp .Lf2_65
+.Lf2_66:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_65:
+.Lf2_58:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 242 9
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_67
+    jmp .Lf2_68
+.Lf2_67:
+    movq $44, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_69
+.Lf2_68:
+    cmpl $96, -80(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_69:
+    movl %eax, -16(%rbp)
+    .loc 1 243 9
+    movq $5, %rax
+    push %rax
+    cmpl $25, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_71
+    jmp .Lf2_70
+.Lf2_71:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_73
+    jmp .Lf2_72
+.Lf2_73:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_72:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_70:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_46
+.Lf2_55:
+    .loc 1 245 9
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $66, -72(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $46, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 246 9
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_74
+    jmp .Lf2_75
+.Lf2_74:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_76
+.Lf2_75:
+    movslq -68(%rbp), %rax
+.Lf2_76:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_78
+    jmp .Lf2_77
+.Lf2_78:
+    movslq -72(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_77:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 247 9
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_80
+    jmp .Lf2_79
+.Lf2_80:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_79:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $93, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_82
+.Lf2_81:
+    movq $10, %rax
+    cmpq $0, %rax
+    jne .Lf2_84
+    jmp .Lf2_85
+.Lf2_84:
+    movq $77, %rax
+    jmp .Lf2_86
+.Lf2_85:
+    movslq -12(%rbp), %rax
+.Lf2_86:
+    jmp .Lf2_83
+.Lf2_82:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_87
+    jmp .Lf2_88
+.Lf2_87:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_89
+.Lf2_88:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf2_89:
+.Lf2_83:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -56(%rbp)
+    addq $0, %rsp
+.Lf2_46:
+    .loc 1 249 5
+    cmpl $92, -24(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $15, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_91
+    jmp .Lf2_92
+.Lf2_91:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_93
+.Lf2_92:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf2_94
+    .loc 1 250 9
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_95
+    jmp .Lf2_96
+.Lf2_95:
+    movslq -76(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_97
+.Lf2_96:
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_97:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 251 9
+    cmpl $70, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_99
+    jmp .Lf2_98
+.Lf2_99:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_98:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 252 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_100
+    jmp .Lf2_101
+.Lf2_100:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf2_102
+.Lf2_101:
+    movslq -32(%rbp), %rax
+.Lf2_102:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_104
+    jmp .Lf2_103
+.Lf2_104:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_103:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_106
+    jmp .Lf2_105
+.Lf2_106:
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_105:
+    movl %eax, -52(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_90
+.Lf2_94:
+    .loc 1 254 9
+    movq $9, %rax
+    push %rax
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf2_107
+    jmp .Lf2_108
+.Lf2_107:
+    movslq -72(%rbp), %rax
+    jmp .Lf2_109
+.Lf2_108:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf2_109:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_110
+    jmp .Lf2_111
+.Lf2_110:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    addq $49, %rax
+    movslq %eax, %rax
+    jmp .Lf2_112
+.Lf2_111:
+    movq $60, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_112:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 255 9
+    movq $90, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $29, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $59, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $27, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 256 9
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_113
+    jmp .Lf2_114
+.Lf2_113:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_115
+.Lf2_114:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf2_115:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_90:
+    .loc 1 258 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_121
+    .p2align 4,,10
+.Lf2_120:
+    .loc 1 259 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_123
+    jmp .Lf2_122
+.Lf2_123:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_122:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_125
+    jmp .Lf2_124
+.Lf2_125:
+    cmpl $25, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $43, %rax
+    cmpq $0, %rax
+    jne .Lf2_126
+    jmp .Lf2_127
+.Lf2_126:
+    movq $37, %rax
+    jmp .Lf2_128
+.Lf2_127:
+    movslq -16(%rbp), %rax
+.Lf2_128:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_124:
+    movl %eax, -12(%rbp)
+    .loc 1 260 9
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $15, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_129
+    jmp .Lf2_130
+.Lf2_129:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_132
+    jmp .Lf2_133
+.Lf2_132:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_134
+.Lf2_133:
+    movq $50, %rax
+.Lf2_134:
+    jmp .Lf2_131
+.Lf2_130:
+    movslq -44(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_131:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 261 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_140
+    .p2align 4,,10
+.Lf2_139:
+    .loc 1 262 13
+    cmpl $19, -76(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $99, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $49, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $36, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 263 13
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $78, -48(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 264 13
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_141
+    jmp .Lf2_142
+.Lf2_141:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_143
+.Lf2_142:
+    movslq -72(%rbp), %rax
+.Lf2_143:
+    push %rax
+    movq $31, %rax
+    cmpq $0, %rax
+    jne .Lf2_144
+    jmp .Lf2_145
+.Lf2_144:
+    movq $48, %rax
+    jmp .Lf2_146
+.Lf2_145:
+    movslq -12(%rbp), %rax
+.Lf2_146:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_138:
+    .loc 1 261 34
+    incl -344(%rbp)
+.Lf2_140:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_139
+.Lf2_137:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_119:
+    .loc 1 258 30
+    incl -340(%rbp)
+.Lf2_121:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_120
+.Lf2_118:
+    addq $8, %rsp
+    .loc 1 268 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 269 9
+    jmp .Lf2_150
+    .p2align 4,,10
+.Lf2_149:
+    .loc 1 270 13
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $21, -40(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_152
+    jmp .Lf2_151
+.Lf2_152:
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_154
+    jmp .Lf2_153
+.Lf2_154:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_153:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_151:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 271 13
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $32, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 273 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 274 17
+    jmp .Lf2_158
+    .p2align 4,,10
+.Lf2_157:
+    .loc 1 275 21
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $27, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_160
+    jmp .Lf2_159
+.Lf2_160:
+    movslq -340(%rbp), %rax
+    imull -32(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_159:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 276 21
+    movq $82, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_164
+    jmp .Lf2_165
+.Lf2_164:
+    movslq -72(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_166
+.Lf2_165:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf2_166:
+    cmpq $0, %rax
+    jne .Lf2_161
+    jmp .Lf2_162
+.Lf2_161:
+    movq $20, %rax
+    imulq $12, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $48, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_163
+.Lf2_162:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_168
+    jmp .Lf2_167
+.Lf2_168:
+    movq $10, %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_167:
+.Lf2_163:
+    movl %eax, -16(%rbp)
+    .loc 1 277 21
+    movslq -64(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_170
+    jmp .Lf2_169
+.Lf2_170:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_172
+    jmp .Lf2_171
+.Lf2_172:
+    movq $78, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_171:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_169:
+    push %rax
+    movq $34, %rax
+    cmpq $31, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_173
+    jmp .Lf2_174
+.Lf2_173:
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_175
+.Lf2_174:
+    movq $12, %rax
+    cmpq $0, %rax
+    jne .Lf2_176
+    jmp .Lf2_177
+.Lf2_176:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_178
+.Lf2_177:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf2_178:
+.Lf2_175:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 278 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_156:
+.Lf2_158:
+    .loc 1 274 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_157
+.Lf2_155:
+    addq $0, %rsp
+    .loc 1 281 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_148:
+.Lf2_150:
+    .loc 1 269 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_149
+.Lf2_147:
+    addq $8, %rsp
+    .loc 1 284 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_184
+    .p2align 4,,10
+.Lf2_183:
+    .loc 1 285 9
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_186
+    jmp .Lf2_185
+.Lf2_186:
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $57, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_185:
+    movl %eax, -20(%rbp)
+    .loc 1 287 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 288 13
+    .p2align 4,,10
+.Lf2_189:
+    .loc 1 289 17
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_190
+    jmp .Lf2_191
+.Lf2_190:
+    cmpl $77, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_192
+.Lf2_191:
+    movq $8, %rax
+    push %rax
+    movq $72, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_192:
+    push %rax
+    movq $5, %rax
+    push %rax
+    cmpl $86, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 290 17
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_194
+    jmp .Lf2_193
+.Lf2_194:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_195
+    jmp .Lf2_196
+.Lf2_195:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_197
+.Lf2_196:
+    movslq -8(%rbp), %rax
+.Lf2_197:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_193:
+    movl %eax, -8(%rbp)
+    .loc 1 291 17
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_201
+    jmp .Lf2_202
+.Lf2_201:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf2_203
+.Lf2_202:
+    movslq -4(%rbp), %rax
+.Lf2_203:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_198
+    jmp .Lf2_199
+.Lf2_198:
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_205
+    jmp .Lf2_204
+.Lf2_205:
+    movq $5, %rax
+    push %rax
+    movq $40, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_204:
+    jmp .Lf2_200
+.Lf2_199:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $86, %rax
+    imulq $9, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_200:
+    movl %eax, -16(%rbp)
+    .loc 1 292 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_188:
+    .loc 1 293 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_189
+.Lf2_187:
+    addq $0, %rsp
+    .loc 1 295 9
+    cmpl $16, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_207
+    jmp .Lf2_206
+.Lf2_207:
+    movslq -52(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_206:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_208
+    jmp .Lf2_209
+.Lf2_208:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_210
+.Lf2_209:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_210:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_182:
+    .loc 1 284 30
+    incl -340(%rbp)
+.Lf2_184:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_183
+.Lf2_181:
+    addq $8, %rsp
+    .loc 1 298 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 299 9
+    jmp .Lf2_214
+    .p2align 4,,10
+.Lf2_213:
+    .loc 1 300 13
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_216
+    jmp .Lf2_215
+.Lf2_216:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_215:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 301 13
+    movslq -56(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_217
+    jmp .Lf2_218
+.Lf2_217:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_219
+.Lf2_218:
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_219:
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_220
+    jmp .Lf2_221
+.Lf2_220:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_224
+    jmp .Lf2_223
+.Lf2_224:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_223:
+    jmp .Lf2_222
+.Lf2_221:
+    movslq -4(%rbp), %rax
+    imulq $47, %rax
+    movslq %eax, %rax
+.Lf2_222:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 303 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 304 17
+    jmp .Lf2_228
+    .p2align 4,,10
+.Lf2_227:
+    .loc 1 305 21
+    movq $10, %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $68, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_229
+    jmp .Lf2_225
+.Lf2_229:
+    .loc 1 306 21
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $13, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_230
+    jmp .Lf2_231
+.Lf2_230:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_232
+.Lf2_231:
+    movq $13, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_232:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -52(%rbp)
+    .loc 1 307 21
+    cmpl $79, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $2, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -32(%rbp)
+    .loc 1 308 21
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_233
+    jmp .Lf2_234
+.Lf2_233:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_236
+    jmp .Lf2_237
+.Lf2_236:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf2_238
+.Lf2_237:
+    movslq -344(%rbp), %rax
+.Lf2_238:
+    push %rax
+    movq $17, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_235
+.Lf2_234:
+    movslq -4(%rbp), %rax
+    imulq $96, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_235:
+    movl %eax, -12(%rbp)
+    .loc 1 309 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_226:
+.Lf2_228:
+    .loc 1 304 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_227
+.Lf2_225:
+    addq $0, %rsp
+    .loc 1 312 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_212:
+.Lf2_214:
+    .loc 1 299 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_213
+.Lf2_211:
+    addq $8, %rsp
+    .loc 1 316 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 317 9
+    .p2align 4,,10
+.Lf2_241:
+    .loc 1 318 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_242
+    jmp .Lf2_243
+.Lf2_242:
+    movq $26, %rax
+    jmp .Lf2_244
+.Lf2_243:
+    movslq -12(%rbp), %rax
+.Lf2_244:
+    push %rax
+    movq $10, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $72, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 319 13
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_246
+    jmp .Lf2_245
+.Lf2_246:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_245:
+    push %rax
+    movq $98, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $6, -36(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_247
+    jmp .Lf2_248
+.Lf2_247:
+    movslq -4(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_249
+.Lf2_248:
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_249:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 320 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 321 17
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_259
+    jmp .Lf2_258
+.Lf2_259:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_258:
+    cmpq $0, %rax
+    jne .Lf2_255
+    jmp .Lf2_256
+.Lf2_255:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_260
+    jmp .Lf2_261
+.Lf2_260:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_262
+.Lf2_261:
+    movq $47, %rax
+.Lf2_262:
+    jmp .Lf2_257
+.Lf2_256:
+    movq $2, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_257:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 322 17
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_267
+    jmp .Lf2_266
+.Lf2_267:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_266:
+    cmpq $0, %rax
+    jne .Lf2_263
+    jmp .Lf2_264
+.Lf2_263:
+    movslq -64(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_265
+.Lf2_264:
+    movq $50, %rax
+    cmpq $3, %rax
+    movq $0, %rax
+    setg %al
+.Lf2_265:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 323 17
+    movq $1, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_254:
+    .loc 1 320 40
+    incl -344(%rbp)
+    .loc 1 321 17
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_273
+    jmp .Lf2_272
+.Lf2_273:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_272:
+    cmpq $0, %rax
+    jne .Lf2_269
+    jmp .Lf2_270
+.Lf2_269:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_274
+    jmp .Lf2_275
+.Lf2_274:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_276
+.Lf2_275:
+    movq $47, %rax
+.Lf2_276:
+    jmp .Lf2_271
+.Lf2_270:
+    movq $2, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_271:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 322 17
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_281
+    jmp .Lf2_280
+.Lf2_281:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_280:
+    cmpq $0, %rax
+    jne .Lf2_277
+    jmp .Lf2_278
+.Lf2_277:
+    movslq -64(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_279
+.Lf2_278:
+    movq $50, %rax
+    cmpq $3, %rax
+    movq $0, %rax
+    setg %al
+.Lf2_279:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 323 17
+    movq $1, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_268:
+    .loc 1 320 40
+    incl -344(%rbp)
+    .loc 1 321 17
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_286
+    jmp .Lf2_285
+.Lf2_286:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_285:
+    cmpq $0, %rax
+    jne .Lf2_282
+    jmp .Lf2_283
+.Lf2_282:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_287
+    jmp .Lf2_288
+.Lf2_287:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_289
+.Lf2_288:
+    movq $47, %rax
+.Lf2_289:
+    jmp .Lf2_284
+.Lf2_283:
+    movq $2, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_284:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 322 17
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_294
+    jmp .Lf2_293
+.Lf2_294:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_293:
+    cmpq $0, %rax
+    jne .Lf2_290
+    jmp .Lf2_291
+.Lf2_290:
+    movslq -64(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_292
+.Lf2_291:
+    movq $50, %rax
+    cmpq $3, %rax
+    movq $0, %rax
+    setg %al
+.Lf2_292:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 323 17
+    movq $1, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_253:
+    .loc 1 320 40
+    incl -344(%rbp)
+.Lf2_252:
+    addq $0, %rsp
+    .loc 1 325 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_240:
+    .loc 1 326 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_241
+.Lf2_239:
+    addq $8, %rsp
+    .loc 1 328 5
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $87, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_296
+    jmp .Lf2_295
+.Lf2_296:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_297
+    jmp .Lf2_298
+.Lf2_297:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf2_299
+.Lf2_298:
+    movslq -12(%rbp), %rax
+.Lf2_299:
+    push %rax
+    cmpl $28, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_295:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 329 5
+    movq $3, %rax
+    push %rax
+    movq $29, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_301
+    jmp .Lf2_300
+.Lf2_301:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_300:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 331 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 332 5
+    subq $8, %rsp
+    movq $77, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 333 5
+    movq $56, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 334 5
+    subq $8, %rsp
+    movq $89, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 335 5
+    movq $33, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 336 5
+    subq $64, %rsp
+    .loc 1 337 5
+    subq $256, %rsp
+    .loc 1 339 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 340 9
+    .p2align 4,,10
+.Lf3_3:
+    .loc 1 341 13
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_5
+    jmp .Lf3_6
+.Lf3_5:
+    movslq -64(%rbp), %rax
+    jmp .Lf3_7
+.Lf3_6:
+    movslq -4(%rbp), %rax
+.Lf3_7:
+    cmpq $80, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_4
+    jmp .Lf3_1
+.Lf3_4:
+    .loc 1 343 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 344 17
+    jmp .Lf3_11
+    .p2align 4,,10
+.Lf3_10:
+    .loc 1 345 21
+    movq $66, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_12
+    jmp .Lf3_8
+.Lf3_12:
+    .loc 1 346 21
+    movq $89, %rax
+    cmpq $0, %rax
+    jne .Lf3_13
+    jmp .Lf3_14
+.Lf3_13:
+    movq $62, %rax
+    jmp .Lf3_15
+.Lf3_14:
+    movslq -340(%rbp), %rax
+.Lf3_15:
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $63, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $56, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 347 21
+    movslq -12(%rbp), %rax
+    addq $99, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_17
+    jmp .Lf3_16
+.Lf3_17:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_16:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_19
+    jmp .Lf3_18
+.Lf3_19:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_18:
+    movl %eax, -4(%rbp)
+    .loc 1 348 21
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_21
+    jmp .Lf3_20
+.Lf3_21:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_20:
+    push %rax
+    movslq -52(%rbp), %rax
+    subq $67, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    addq $74, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_23
+    jmp .Lf3_22
+.Lf3_23:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_24
+    jmp .Lf3_25
+.Lf3_24:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_26
+.Lf3_25:
+    movslq -4(%rbp), %rax
+.Lf3_26:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_22:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 349 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_9:
+.Lf3_11:
+    .loc 1 344 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_10
+.Lf3_8:
+    addq $0, %rsp
+    .loc 1 352 13
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_27
+    jmp .Lf3_28
+.Lf3_27:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_29
+.Lf3_28:
+    movslq -56(%rbp), %rax
+.Lf3_29:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 353 13
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_31
+    jmp .Lf3_30
+.Lf3_31:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    imulq $0, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_30:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 354 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_2:
+    .loc 1 355 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_3
+.Lf3_1:
+    addq $8, %rsp
+    .loc 1 357 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_37
+    .p2align 4,,10
+.Lf3_36:
+    .loc 1 358 9
+    movq $5, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $1, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_38
+    jmp .Lf3_39
+.Lf3_38:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $90, %rax
+    cmpq $0, %rax
+    jne .Lf3_41
+    jmp .Lf3_42
+.Lf3_41:
+    movq $78, %rax
+    jmp .Lf3_43
+.Lf3_42:
+    movslq -8(%rbp), %rax
+.Lf3_43:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_40
+.Lf3_39:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_44
+    jmp .Lf3_45
+.Lf3_44:
+    movq $57, %rax
+    jmp .Lf3_46
+.Lf3_45:
+    movslq -16(%rbp), %rax
+.Lf3_46:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf3_40:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 359 9
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_48
+    jmp .Lf3_47
+.Lf3_48:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_47:
+    push %rax
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_50
+    jmp .Lf3_49
+.Lf3_50:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_49:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $45, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 360 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_56
+    .p2align 4,,10
+.Lf3_55:
+    .loc 1 361 13
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_61
+    jmp .Lf3_60
+.Lf3_61:
+    cmpl $6, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_60:
+    cmpq $0, %rax
+    jne .Lf3_57
+    jmp .Lf3_58
+.Lf3_57:
+    movq $62, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_62
+    jmp .Lf3_63
+.Lf3_62:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_64
+.Lf3_63:
+    movslq -344(%rbp), %rax
+.Lf3_64:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_59
+.Lf3_58:
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_59:
+    movl %eax, -8(%rbp)
+    .loc 1 362 13
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $51, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $43, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 363 13
+    movq $5, %rax
+    push %rax
+    cmpl $45, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_54:
+    .loc 1 360 34
+    incl -344(%rbp)
+.Lf3_56:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_55
+.Lf3_53:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf3_35:
+    .loc 1 357 30
+    incl -340(%rbp)
+.Lf3_37:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_36
+.Lf3_34:
+    addq $8, %rsp
+    .loc 1 366 5
+    movq $9, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_66
+    jmp .Lf3_65
+.Lf3_66:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_65:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 367 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_72
+    .p2align 4,,10
+.Lf3_71:
+    .loc 1 368 9
+    movq $9, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 370 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 371 13
+    .p2align 4,,10
+.Lf3_75:
+    .loc 1 372 17
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_76
+    jmp .Lf3_73
+.Lf3_76:
+    .loc 1 373 17
+    movq $32, %rax
+    cmpq $0, %rax
+    jne .Lf3_80
+    jmp .Lf3_81
+.Lf3_80:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_82
+.Lf3_81:
+    movq $88, %rax
+.Lf3_82:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_84
+    jmp .Lf3_83
+.Lf3_84:
+    movq $97, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_83:
+    cmpq $0, %rax
+    jne .Lf3_77
+    jmp .Lf3_78
+.Lf3_77:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_85
+    jmp .Lf3_86
+.Lf3_85:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_87
+.Lf3_86:
+    movslq -340(%rbp), %rax
+.Lf3_87:
+    push %rax
+    movslq -72(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_79
+.Lf3_78:
+    movq $1, %rax
+    push %rax
+    movq $55, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_88
+    jmp .Lf3_89
+.Lf3_88:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_92
+    jmp .Lf3_91
+.Lf3_92:
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_91:
+    jmp .Lf3_90
+.Lf3_89:
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_90:
+.Lf3_79:
+    movl %eax, -12(%rbp)
+    .loc 1 374 17
+    movq $86, %rax
+    subq $42, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $78, %rax
+    cmpq $0, %rax
+    jne .Lf3_93
+    jmp .Lf3_94
+.Lf3_93:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_95
+.Lf3_94:
+    movq $0, %rax
+.Lf3_95:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_96
+    jmp .Lf3_97
+.Lf3_96:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_98
+.Lf3_97:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf3_98:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 375 17
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_99
+    jmp .Lf3_100
+.Lf3_99:
+    movslq -344(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_103
+    jmp .Lf3_102
+.Lf3_103:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_102:
+    jmp .Lf3_101
+.Lf3_100:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_108
+    jmp .Lf3_107
+.Lf3_108:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_107:
+    cmpq $0, %rax
+    jne .Lf3_104
+    jmp .Lf3_105
+.Lf3_104:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_106
+.Lf3_105:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_109
+    jmp .Lf3_110
+.Lf3_109:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_111
+.Lf3_110:
+    movslq -12(%rbp), %rax
+.Lf3_111:
+.Lf3_106:
+.Lf3_101:
+    movl %eax, -4(%rbp)
+    .loc 1 376 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_74:
+    .loc 1 377 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_75
+.Lf3_73:
+    addq $0, %rsp
+    .loc 1 379 9
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_116
+    jmp .Lf3_115
+.Lf3_116:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_115:
+    cmpq $0, %rax
+    jne .Lf3_112
+    jmp .Lf3_113
+.Lf3_112:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf3_114
+.Lf3_113:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_118
+    jmp .Lf3_117
+.Lf3_118:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_117:
+.Lf3_114:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf3_70:
+    .loc 1 367 30
+    incl -340(%rbp)
+.Lf3_72:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_71
+.Lf3_69:
+    addq $8, %rsp
+    .loc 1 382 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 383 9
+    jmp .Lf3_122
+    .p2align 4,,10
+.Lf3_121:
+    .loc 1 385 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 386 17
+    .p2align 4,,10
+.Lf3_125:
+    .loc 1 387 21
+    movq $4, %rax
+    push %rax
+    cmpl $66, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $54, %rax
+    cmpq $39, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 388 21
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $36, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_126
+    jmp .Lf3_127
+.Lf3_126:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf3_128
+.Lf3_127:
+    movslq -4(%rbp), %rax
+.Lf3_128:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 389 21
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_129
+    jmp .Lf3_130
+.Lf3_129:
+    movq $2, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_131
+.Lf3_130:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf3_131:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 390 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_124:
+    .loc 1 391 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_125
+.Lf3_123:
+    addq $0, %rsp
+    .loc 1 393 13
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_132
+    jmp .Lf3_133
+.Lf3_132:
+    movslq -340(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_136
+    jmp .Lf3_135
+.Lf3_136:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_135:
+    jmp .Lf3_134
+.Lf3_133:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    subq $32, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_138
+    jmp .Lf3_137
+.Lf3_138:
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_137:
+.Lf3_134:
+    movl %eax, -4(%rbp)
+    .loc 1 394 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_140
+    jmp .Lf3_139
+.Lf3_140:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_139:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_142
+    jmp .Lf3_141
+.Lf3_142:
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_141:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_143
+    jmp .Lf3_144
+.Lf3_143:
+    cmpl $39, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf3_145
+.Lf3_144:
+    movslq -24(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf3_145:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 395 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_120:
+.Lf3_122:
+    .loc 1 383 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_121
+.Lf3_119:
+    addq $8, %rsp
+    .loc 1 398 5
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    imulq $9, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_146
+    jmp .Lf3_147
+.Lf3_146:
+    movq $2, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_148
+.Lf3_147:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_148:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 399 5
+    movslq -4(%rbp), %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 401 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 402 9
+    jmp .Lf3_152
+    .p2align 4,,10
+.Lf3_151:
+    .loc 1 403 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_158
+    .p2align 4,,10
+.Lf3_157:
+    .loc 1 404 17
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_159
+    jmp .Lf3_155
+.Lf3_159:
+    .loc 1 405 17
+    movq $2, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    addq $51, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_160
+    jmp .Lf3_161
+.Lf3_160:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_162
+.Lf3_161:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf3_162:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -72(%rbp)
+    .loc 1 406 17
+    movq $21, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_163
+    jmp .Lf3_164
+.Lf3_163:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf3_165
+.Lf3_164:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf3_165:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_167
+    jmp .Lf3_166
+.Lf3_167:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_166:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 407 17
+    movslq -4(%rbp), %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_168
+    jmp .Lf3_169
+.Lf3_168:
+    movslq -344(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_170
+.Lf3_169:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_172
+    jmp .Lf3_171
+.Lf3_172:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_171:
+.Lf3_170:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_174
+    jmp .Lf3_173
+.Lf3_174:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_173:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_156:
+    .loc 1 403 38
+    incl -344(%rbp)
+.Lf3_158:
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_157
+.Lf3_155:
+    addq $0, %rsp
+    .loc 1 409 13
+    movq $94, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_175
+    jmp .Lf3_176
+.Lf3_175:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_178
+    jmp .Lf3_179
+.Lf3_178:
+    movq $3, %rax
+    jmp .Lf3_180
+.Lf3_179:
+    movslq -12(%rbp), %rax
+.Lf3_180:
+    jmp .Lf3_177
+.Lf3_176:
+    movq $1, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf3_177:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_182
+    jmp .Lf3_181
+.Lf3_182:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_181:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_184
+    jmp .Lf3_183
+.Lf3_184:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_183:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -60(%rbp)
+    .loc 1 410 13
+    movq $5, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_185
+    jmp .Lf3_186
+.Lf3_185:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_189
+    jmp .Lf3_188
+.Lf3_189:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_188:
+    jmp .Lf3_187
+.Lf3_186:
+    movq $82, %rax
+    cmpq $0, %rax
+    jne .Lf3_190
+    jmp .Lf3_191
+.Lf3_190:
+    movslq -36(%rbp), %rax
+    jmp .Lf3_192
+.Lf3_191:
+    movslq -8(%rbp), %rax
+.Lf3_192:
+.Lf3_187:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 411 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_150:
+.Lf3_152:
+    .loc 1 402 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_151
+.Lf3_149:
+    addq $8, %rsp
+    .loc 1 414 5
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_194
+    jmp .Lf3_195
+.Lf3_194:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_196
+.Lf3_195:
+    movslq -16(%rbp), %rax
+.Lf3_196:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_198
+    jmp .Lf3_197
+.Lf3_198:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_200
+    jmp .Lf3_199
+.Lf3_200:
+    movq $0, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_199:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_197:
+    cmpq $0, %rax
+    je .Lf3_201
+    .loc 1 415 9
+    movq $7, %rax
+    push %rax
+    movq $50, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $75, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -68(%rbp)
+    .loc 1 416 9
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_203
+    jmp .Lf3_202
+.Lf3_203:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_202:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_204
+    jmp .Lf3_205
+.Lf3_204:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_206
+.Lf3_205:
+    movq $45, %rax
+.Lf3_206:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 417 9
+    cmpl $29, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $46, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_208
+    jmp .Lf3_207
+.Lf3_208:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_207:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -60(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_193
+.Lf3_201:
+    .loc 1 419 9
+    movq $7, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $48, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_210
+    jmp .Lf3_209
+.Lf3_210:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_209:
+    movl %eax, -60(%rbp)
+    .loc 1 420 9
+    movslq -16(%rbp), %rax
+    imulq $92, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -48(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 421 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_212
+    jmp .Lf3_211
+.Lf3_212:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_214
+    jmp .Lf3_213
+.Lf3_214:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_213:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_211:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_216
+    jmp .Lf3_215
+.Lf3_216:
+    movq $80, %rax
+    cmpq $0, %rax
+    jne .Lf3_220
+    jmp .Lf3_221
+.Lf3_220:
+    movq $40, %rax
+    jmp .Lf3_222
+.Lf3_221:
+    movslq -8(%rbp), %rax
+.Lf3_222:
+    cmpq $0, %rax
+    jne .Lf3_217
+    jmp .Lf3_218
+.Lf3_217:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_224
+    jmp .Lf3_223
+.Lf3_224:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_223:
+    jmp .Lf3_219
+.Lf3_218:
+    movq $5, %rax
+    push %rax
+    movq $28, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_219:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_215:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_193:
+    .loc 1 423 5
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_227
+    jmp .Lf3_226
+.Lf3_227:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_226:
+    cmpq $0, %rax
+    je .Lf3_228
+    .loc 1 424 9
+    movq $2, %rax
+    push %rax
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_230
+    jmp .Lf3_229
+.Lf3_230:
+    movq $33, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_229:
+    push %rax
+    movq $65, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 425 9
+    movslq -8(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $60, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_232
+    jmp .Lf3_231
+.Lf3_232:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_233
+    jmp .Lf3_234
+.Lf3_233:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf3_235
+.Lf3_234:
+    movslq -4(%rbp), %rax
+.Lf3_235:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_231:
+    movl %eax, -8(%rbp)
+    .loc 1 426 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf3_236
+    jmp .Lf3_237
+.Lf3_236:
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_238
+.Lf3_237:
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_238:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_240
+    jmp .Lf3_239
+.Lf3_240:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $76, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    cmpq $0, %rax
+    jne .Lf3_241
+    jmp .Lf3_242
+.Lf3_241:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_243
+.Lf3_242:
+    movslq -56(%rbp), %rax
+.Lf3_243:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_239:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_225
+.Lf3_228:
+    .loc 1 428 9
+    movq $8, %rax
+    cmpq $55, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_245
+    jmp .Lf3_244
+.Lf3_245:
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_244:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 429 9
+    movq $9, %rax
+    push %rax
+    movq $47, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_247
+    jmp .Lf3_246
+.Lf3_247:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_249
+    jmp .Lf3_248
+.Lf3_249:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_248:
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_246:
+    movl %eax, -16(%rbp)
+    .loc 1 430 9
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_225:
+    .loc 1 432 5
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_251
+    jmp .Lf3_250
+.Lf3_251:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_252
+    jmp .Lf3_253
+.Lf3_252:
+    movq $98, %rax
+    jmp .Lf3_254
+.Lf3_253:
+    movslq -28(%rbp), %rax
+.Lf3_254:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_256
+    jmp .Lf3_255
+.Lf3_256:
+    movq $1, %rax
+    cmpq $14, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_255:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_250:
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
@@ -0,0 +1,130 @@
+int f0() {
+    int v0 = 85;
+    int v1 = 83;
+    int v2 = 4;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 / 9) - (v0 + 64)) ? ((v3 * v3) - (v0 % 9)) : ((a0[14] >= 12) ? (v0 % 5) : (a0[5] / 7)))) {
+        v1 = (((98 > a0[1]) ? (v2 != 12) : (v1 && v0)) ? ((a0[14] > 62) || (71 * 98)) : ((v0 == v1) && (a1[0][6] * v0)));
+        v1 = (((v2 % 8) / 2) == ((0 && v3) == (v3 || a0[6])));
+        v1 = (((a0[12] == v1) + (a1[3][12] > a1[1][1])) < ((v0 - v1) < (a0[5] && v1)));
+    } else {
+        a0[8] = (((v3 || a1[0][6]) / 9) || ((a0[10] > a0[4]) == (41 - v3)));
+        v1 = (((v3 || v3) - (v2 % 3)) % 8);
+        v2 = (((84 % 1) || (v2 >= 5)) + ((v0 < v2) + (a1[1][2] % 2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v3 = (((v1 ? a1[1][10] : v3) > (v0 >= v2)) == ((v0 < a0[3]) < (v3 == v2)));
+            v0 = (((32 || a1[1][10]) ? (v3 / 4) : (3 ? v3 : 92)) % 2);
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[1][6] = (((a0[10] / 7) >= (a0[7] > 23)) && ((77 ? v1 : v0) + (76 / 4)));
+                v0 = (((v3 ? a1[0][8] : a0[9]) / 2) || ((a0[6] <= a0[11]) == (v3 < i1)));
+                v2 = (((i1 < v1) == (a1[2][13] / 9)) ? ((a1[0][11] < 77) != (v3 >= 6)) : ((12 || a1[2][6]) > (a1[0][8] >= v1)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a1[1][0] = (((v2 + v1) == (55 / 2)) && ((v0 && 40) != (5 >= a0[13])));
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v2 >= 6) > (v2 < 78)) + ((90 * v0) * (21 ? a0[8] : v3)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((v2 >= i2) > 61) break;
+                a0[8] = (((i2 >= a0[2]) / 4) ? ((i3 ? i2 : a0[15]) ? (50 * v0) : (a1[0][10] <= a1[1][4])) : ((i2 || a0[6]) - (a1[0][10] == i3)));
+                v3 = (((a0[11] + a0[7]) > (82 > v3)) != ((v1 != a1[3][4]) || (a1[2][0] && v2)));
+                v2 = (((92 * 98) >= (a0[8] - v2)) >= ((93 ? i2 : a0[14]) == (i3 || v1)));
+            }
+            v0 = (((v3 * a0[0]) % 5) < ((v0 + v0) > (a1[0][9] >= v2)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            v1 = (((v0 < v3) % 1) >= ((a0[7] <= v0) == (v0 && 60)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v3 = (((i5 <= a1[2][7]) <= (i4 * 11)) <= ((a0[6] != v0) >= (a0[0] % 6)));
+                    v0 = (((a1[0][4] ? a1[0][2] : v0) != (a1[3][7] > v0)) + ((a0[13] % 1) * (a1[1][14] * i5)));
+                    a0[11] = (((a0[7] * 26) ? (v0 / 9) : (57 ? v0 : v2)) >= ((v0 < v1) ? (v3 > i5) : (58 || v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((v2 && 89) != (48 ? a0[7] : 11)) >= ((v1 >= a1[0][11]) > (v0 > i4)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                v3 = (((v3 || v3) - (v0 || v3)) + ((v2 <= i6) / 7));
+                a1[2][1] = (((v1 || v0) ? (78 % 2) : (v1 % 3)) * ((a1[0][8] != 91) || (i6 == v1)));
+                v2 = (((v3 > a1[1][14]) && (a1[1][12] + a1[2][6])) % 1);
+            }
+            v3 = (((85 ? 12 : v3) - (v3 || 68)) == ((v2 % 8) != (i6 / 3)));
+            v2 = (((a1[2][0] == 68) - (21 >= a0[3])) == ((28 && v2) * (i6 ? 32 : v3)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        a1[0][13] = (((i8 > i8) ? (v2 < 64) : (a1[0][14] == v3)) ? ((v3 && v1) + (v1 ? a0[13] : a1[0][11])) : ((78 - i8) * (80 / 8)));
+        for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+            if ((a0[2] > 97) > 61) break;
+            v3 = (((39 * v0) || (v3 / 6)) ? ((a1[2][9] != a1[3][8]) <= (47 <= i8)) : ((i9 || 85) / 9));
+            v0 = (((i8 != v2) % 7) < ((v0 != 95) != (v1 - v0)));
+            a0[0] = (((99 ? v1 : v3) == (a1[0][9] ? 59 : 40)) % 8);
+        }
+        a1[3][14] = (((v0 < i8) == (84 + 77)) < ((36 || a1[3][15]) || (v3 != 47)));
+    }
+    {
+        int i10 = 0;
+        do {
+            v3 = (((v1 != a0[11]) / 8) != ((v2 || a0[15]) % 9));
+            v1 = (((a0[2] >= v2) > (v1 != 95)) || ((a1[2][4] != 33) && (v2 != 85)));
+            for (int i11 = 0; i11 < 3; i11 = i11 + 1) {
+                v0 = (((a0[14] - v0) < (v2 % 3)) != ((35 && 48) % 6));
+                v2 = (((88 < a1[0][8]) == (i10 || v3)) % 5);
+                v0 = (((a0[6] < v3) - (v3 % 1)) + ((16 + a1[1][0]) <= (i10 < a0[6])));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    {
+        int i12 = 0;
+        while (i12 < 4) {
+            v2 = (((90 - i12) == (a1[1][12] / 1)) % 6);
+            {
+                int i13 = 0;
+                do {
+                    a1[0][7] = (((v3 >= 52) ? (a0[9] && a0[4]) : (63 == 65)) < ((v2 ? v0 : 97) && (v3 * a1[0][14])));
+                    v2 = (((v2 ? a1[2][12] : v0) ? (v1 != a1[3][15]) : (a1[3][11] ? v0 : i12)) >= ((93 && v2) >= (v1 * i12)));
+                    v1 = (((a0[3] != 61) - (v0 * v1)) + ((70 + v1) - (i12 == i13)));
+                    i13 = i13 + 1;
+                } while (i13 < 2);
+            }
+            a0[14] = (((a1[1][1] >= 8) ? (a0[10] > a0[9]) : (v3 - a0[12])) % 8);
+            i12 = i12 + 1;
+        }
+    }
+    if ((((v2 / 2) || (v3 != v0)) ? ((a1[1][1] ? 82 : v1) <= (a1[0][6] ? v0 : v1)) : ((a0[3] >= 80) * (v1 + 92)))) {
+        a1[2][3] = (((v0 + v2) != (v3 % 8)) && ((a0[2] - v3) && (v1 <= a0[12])));
+        v0 = (((v1 % 1) == (a1[2][1] ? 70 : a1[2][9])) > ((a1[1][15] == 93) / 4));
+        v3 = (((a0[12] ? v3 : v1) > (86 < a1[2][15])) * ((v1 + v0) % 5));
+    } else {
+        v2 = (((v1 >= v0) % 3) % 3);
+        a1[2][9] = (((v2 / 8) % 8) != ((a1[0][13] <= 69) * (v2 || v2)));
+        a0[15] = (((a1[2][12] || v3) && (v2 == v3)) ? ((88 == 24) % 1) : ((v1 || v1) <= (a0[7] || a0[10])));
+    }
+    return (((v0 <= 70) + (31 || 17)) / 1);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
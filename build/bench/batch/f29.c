@@ -0,0 +1,249 @@
+int f0() {
+    int v0 = 97;
+    int v1 = 37;
+    int v2 = 17;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a0[11] = (((a1[3][1] <= a1[3][2]) + (2 || 14)) - ((a0[14] - v3) > (v1 * 25)));
+            v3 = (((a0[10] ? v1 : a0[0]) ? (a0[15] >= 34) : (v3 == a1[1][7])) <= ((v2 >= 12) / 8));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((i1 && 55) > 94) break;
+                a1[3][12] = (((66 <= v2) < (v1 < a1[3][6])) - ((47 <= a1[0][7]) != (81 || 71)));
+                v1 = (((v1 != i0) + (v2 / 1)) >= ((a1[2][3] == v2) < (2 && v3)));
+                a1[2][4] = (((6 / 3) >= (a1[1][5] <= v0)) || ((v1 >= v2) ? (v3 - 25) : (v1 + 20)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v2 = (((53 * a1[1][5]) % 6) + ((a1[1][9] && i3) <= (v0 % 6)));
+                a0[8] = (((v3 / 4) + (a1[0][4] != a0[15])) <= ((i3 / 3) && (v2 <= 17)));
+                v3 = (((a1[1][12] % 2) > (80 ? a0[8] : v3)) / 5);
+                i3 = i3 + 1;
+            }
+        }
+        a0[10] = (((v0 >= v0) == (12 || 69)) - ((a1[2][6] ? v2 : 63) - (i2 ? v1 : a0[12])));
+        v2 = (((86 != v3) != (a0[12] != v2)) == ((v3 - i2) ? (a1[3][13] ? v2 : 20) : (60 && v0)));
+    }
+    a1[1][0] = (((a1[0][1] || 68) % 4) > ((v0 == 98) ? (v2 >= v1) : (v1 < v0)));
+    {
+        int i4 = 0;
+        do {
+            if ((a1[2][7] + 76) > 91) break;
+            {
+                int i5 = 0;
+                do {
+                    if ((v0 ? 55 : i5) > 89) break;
+                    v3 = (((a0[1] / 8) + (a0[6] + i5)) - ((v1 >= v2) / 9));
+                    v1 = (((i4 == a0[15]) != (a0[0] ? v3 : 14)) + ((v3 + a0[0]) == (v1 || i4)));
+                    v2 = (((v3 || 2) < (a1[2][3] <= i5)) >= ((v0 + a1[0][15]) + (i5 ? v3 : v1)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v2 = (((v2 == 27) + (v2 * v3)) > ((v2 == 11) - (v1 || a0[11])));
+            v2 = (((v1 * v0) < (v3 == i4)) / 2);
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            if ((39 < v1) > 90) break;
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((a1[0][15] ? a0[7] : v3) > 67) break;
+                v0 = (((a1[2][9] || v3) < (72 / 1)) != ((55 + v2) + (v3 * 5)));
+                v1 = (((i6 - v3) ? (a0[3] < 69) : (v1 ? a0[12] : v2)) >= ((v0 && v3) - (v0 <= a1[2][10])));
+                a0[5] = (((a0[6] % 9) && (a1[0][4] ? i6 : a0[0])) ? ((v3 / 1) >= (35 || v2)) : ((v0 ? i6 : i6) + (i6 / 5)));
+            }
+            a1[0][9] = (((v0 ? a1[0][2] : v2) / 7) > ((v2 / 5) || (a1[1][15] <= v3)));
+            a0[11] = (((i6 % 8) >= (v3 && a1[2][1])) <= ((v0 ? a1[3][15] : i6) / 3));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((v2 % 6) > 80) break;
+            v3 = (((a0[9] % 5) < (54 != 54)) - ((i8 || 33) != (14 < 86)));
+            v1 = (((a1[2][5] > 18) * (i8 || i8)) % 6);
+            {
+                int i9 = 0;
+                do {
+                    a0[9] = (((i8 > a0[7]) ? (a0[10] ? v0 : i9) : (51 ? 38 : a1[1][1])) >= ((v2 > 35) / 4));
+                    v0 = (((a0[11] - v2) > (i8 < v3)) % 5);
+                    a0[15] = (((a0[12] || i8) + (93 / 8)) || ((i9 ? v2 : i8) != (25 * v2)));
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        if ((v1 * a0[11]) > 59) break;
+        v0 = (((a0[6] >= v2) % 6) != ((i10 == v1) - (v2 % 2)));
+        v1 = (((v0 > 0) <= (a1[2][1] > v1)) == ((47 ? a0[12] : a1[0][12]) ? (a0[4] == i10) : (80 * a1[0][8])));
+        {
+            int i11 = 0;
+            do {
+                if ((v1 < a0[12]) > 86) break;
+                a1[3][1] = (((i11 >= 35) ? (i10 + 84) : (v0 >= 29)) == ((v3 > v2) >= (v3 != 20)));
+                v1 = (((14 ? v0 : a1[3][6]) * (a0[10] ? v0 : i10)) == ((a1[1][14] * a0[14]) <= (i10 ? i11 : v1)));
+                v0 = (((a0[14] > v0) ? (i11 * a1[3][0]) : (v3 ? v0 : a1[3][13])) >= ((a0[15] > i10) == (a0[15] && v3)));
+                i11 = i11 + 1;
+            } while (i11 < 2);
+        }
+    }
+    if ((((57 != v3) <= (a1[0][12] > v3)) && ((v3 <= v2) - (v3 <= 23)))) {
+        v1 = (((87 + a1[3][9]) && (a0[4] != a1[3][10])) && ((36 || v1) <= (v0 <= v1)));
+        v1 = (((a1[3][12] / 5) > (v3 % 9)) != ((v2 / 7) <= (v1 < a1[0][0])));
+        v3 = (((v0 >= v2) <= (v2 ? a0[9] : a1[3][14])) % 4);
+    } else {
+        v2 = (((a0[0] && v0) >= (v0 > v0)) < ((38 <= v3) ? (a0[6] >= a0[5]) : (a0[14] && v0)));
+        a0[10] = (((v1 ? a1[0][13] : 70) && (v0 && v1)) >= ((a1[3][0] ? v1 : 6) - (v2 != v3)));
+        a1[3][15] = (((79 > v2) || (24 > a0[0])) || ((96 && v1) > (v0 - a0[14])));
+    }
+    {
+        int i12 = 0;
+        do {
+            v2 = (((26 % 9) / 9) == ((90 ? 43 : v0) / 6));
+            v3 = (((a1[2][8] ? a1[1][10] : a0[13]) <= (a0[9] + v3)) - ((v2 / 9) ? (51 >= 85) : (a0[0] / 3)));
+            {
+                int i13 = 0;
+                while (i13 < 5) {
+                    v3 = (((v1 * 79) != (i13 <= v0)) > ((24 < v1) - (11 ? 46 : v2)));
+                    a0[6] = (((0 < v3) * (a0[7] && a1[2][9])) == ((72 != a1[3][12]) != (58 > v1)));
+                    a0[12] = (((a1[0][9] / 6) - (38 ? i13 : 10)) % 4);
+                    i13 = i13 + 1;
+                }
+            }
+            i12 = i12 + 1;
+        } while (i12 < 7);
+    }
+    {
+        int i14 = 0;
+        while (i14 < 3) {
+            a1[0][7] = (((a1[0][13] != v1) > (a0[12] > 49)) != ((v2 ? a1[1][10] : i14) > (v2 <= v1)));
+            a0[14] = (((a1[1][14] * v2) < (66 <= a1[3][1])) < ((49 ? a1[1][3] : v2) < (v2 ? a1[3][12] : i14)));
+            for (int i15 = 0; i15 < 2; i15 = i15 + 1) {
+                a0[15] = (((v2 - a1[0][14]) < (i15 < a1[1][3])) + ((v0 < a0[12]) > (a0[11] != v2)));
+                v0 = (((a0[3] ? i15 : i14) / 8) && ((v0 * v1) * (10 + 91)));
+                a1[2][12] = (((i14 < a1[2][4]) > (27 + a0[5])) < ((v1 || a0[0]) + (35 * v2)));
+            }
+            i14 = i14 + 1;
+        }
+    }
+    return (((v1 != a0[4]) == (v1 / 8)) ? ((v0 > v2) % 5) : ((15 || 44) + (v2 * a1[3][0])));
+}
+int f1() {
+    int v0 = 10;
+    int v1 = 94;
+    int v2 = 47;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((a0[13] ? v2 : a0[6]) > 55) break;
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    a0[8] = (((40 < 20) + (i1 + v2)) >= ((a1[2][13] / 8) >= (70 == 65)));
+                    v1 = (((a0[2] % 2) * (59 / 5)) == ((v0 * a1[1][9]) || (v1 <= 59)));
+                    v1 = (((v0 ? v2 : 69) <= (a1[2][12] / 1)) - ((v1 + 82) < (a1[1][9] % 7)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v3 ? a0[6] : v0) != (v1 && 16)) % 9);
+            v1 = (((7 > a1[2][3]) || (20 * a0[11])) > ((v2 ? a0[13] : v1) ? (44 ? a0[11] : v3) : (v0 < 66)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 >= v2) == (a1[1][15] || 99)) / 2)) {
+        a0[6] = (((v0 ? a0[2] : a1[0][2]) % 1) || ((v2 < a1[1][8]) || (v2 / 3)));
+        v1 = (((v3 == 67) * (v2 - a0[10])) ? ((77 || v0) || (45 % 8)) : ((a0[7] >= v1) % 7));
+        v1 = (((v1 - v3) && (18 <= v2)) < ((74 + v2) == (a1[0][9] <= v0)));
+    } else {
+        v3 = (((v3 == v2) != (a1[1][8] * v1)) != ((19 >= 95) ? (66 >= v2) : (a1[3][1] * a1[1][9])));
+        a0[12] = (((v1 ? v2 : a0[14]) - (a1[1][6] && 72)) == ((v3 + 46) <= (v2 == a0[15])));
+        a0[11] = (((a1[3][4] <= v0) + (v1 == v0)) > ((a1[2][10] <= v0) % 5));
+    }
+    if ((((a0[3] && 36) * (v2 <= 91)) % 5)) {
+        a0[7] = (((v2 ? v3 : a1[1][13]) > (v2 || v2)) || ((14 != 58) >= (43 != v0)));
+        a1[0][14] = (((v0 < v2) == (v0 || v1)) ? ((v2 > v2) && (v3 + 72)) : ((83 >= v0) - (a0[7] && v0)));
+        a1[0][4] = (((21 != v3) >= (78 > v2)) - ((a0[14] / 9) + (v1 >= a0[4])));
+    } else {
+        v3 = (((76 ? v0 : 81) - (v2 >= v3)) ? ((a1[3][2] * 66) < (v3 - a1[2][13])) : ((a0[0] / 2) - (a1[1][13] ? a1[1][9] : a0[3])));
+        v2 = (((v1 < 43) * (7 < a1[0][3])) * ((27 >= a1[1][12]) / 9));
+        a1[0][3] = (((a1[3][13] == 41) > (v1 != a1[2][0])) && ((95 - 0) * (33 % 4)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            a1[2][1] = (((v0 / 1) > (i2 - a1[2][3])) + ((89 != i2) || (a0[0] || 92)));
+            v1 = (((v3 % 9) / 8) > ((a0[14] != 19) > (a1[0][3] < v0)));
+            {
+                int i3 = 0;
+                do {
+                    a0[6] = (((v1 >= v3) >= (95 % 5)) * ((a0[13] / 3) < (94 ? v3 : v2)));
+                    v3 = (((92 > a0[10]) < (v3 <= i2)) >= ((22 / 3) <= (i2 == v2)));
+                    a0[10] = (((a1[2][12] ? v2 : i3) / 2) < ((a1[1][12] > v0) || (15 * 35)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[0][0] == v2) && (a0[7] < v3)) <= ((35 != 83) <= (v1 && v3)))) {
+        v3 = (((37 + v1) - (v1 > v1)) ? ((v3 * v0) ? (24 > v0) : (v3 || 89)) : ((71 >= v2) <= (a1[3][4] ? v3 : 36)));
+        a0[6] = (((a1[2][12] + 3) || (v1 < v2)) && ((v3 >= 51) + (v2 % 1)));
+        v1 = (((v1 <= a0[10]) <= (56 > v2)) / 9);
+    } else {
+        v2 = (((74 + a1[0][7]) == (v0 - v0)) - ((87 % 5) * (35 - a0[8])));
+        v1 = (((v2 / 8) && (a1[3][11] <= 91)) + ((v3 || v0) / 7));
+        a0[8] = (((36 <= 70) >= (v0 >= v3)) * ((v0 % 7) % 8));
+    }
+    if ((((v1 / 5) == (33 != v3)) <= ((a1[1][2] * 92) <= (v1 % 1)))) {
+        v3 = (((v1 < 40) >= (v3 * v0)) < ((v1 < 31) - (a0[0] == 84)));
+        v3 = (((v0 / 7) > (46 + 19)) - ((68 == a0[13]) ? (v3 < v3) : (a1[2][8] ? a0[14] : v2)));
+        a0[13] = (((a0[15] != 60) * (a0[6] >= a0[7])) || ((v0 % 7) * (a0[6] / 5)));
+    } else {
+        v2 = (((43 ? 75 : v2) / 9) < ((v1 || v1) - (v3 == v1)));
+        v0 = (((v1 < a0[4]) == (v0 && a1[0][14])) > ((0 % 1) > (21 >= a0[6])));
+        a0[15] = (((51 + 2) ? (a1[3][14] > a0[3]) : (a0[10] < v2)) - ((a0[7] - a0[5]) && (v0 ? v0 : a0[2])));
+    }
+    a1[0][9] = (((2 && 44) ? (v2 * a1[0][8]) : (a1[0][5] < a0[15])) * ((v3 >= a1[3][3]) <= (v1 * 5)));
+    v3 = (((v3 != a0[2]) <= (a1[2][5] < a1[0][4])) != ((v2 * v1) == (90 - a0[1])));
+    if ((((v1 >= v2) / 9) > ((a1[1][7] * v2) < (v3 && a1[1][1])))) {
+        a0[3] = (((48 ? v3 : 41) && (v0 < a1[2][9])) > ((a0[2] - v1) && (25 >= a0[10])));
+        v3 = (((a1[1][5] - 42) <= (v1 < a0[11])) / 2);
+        v0 = (((v3 > a0[0]) >= (v1 == a1[0][15])) || ((a1[3][9] != v3) * (a1[3][0] > v2)));
+    } else {
+        v3 = (((22 / 2) != (v1 && v2)) % 6);
+        a0[15] = (((v1 / 5) || (a0[6] + 66)) ? ((v2 == a0[5]) - (a0[6] > v2)) : ((16 || 67) != (79 != a1[1][13])));
+        v0 = (((42 - a1[3][9]) / 4) / 3);
+    }
+    if ((((v0 == v0) >= (v0 > 74)) || ((v2 != a1[1][13]) / 8))) {
+        v1 = (((v1 > a1[1][0]) ? (37 / 5) : (v3 * 71)) <= ((33 != 55) * (93 / 3)));
+        a0[1] = (((74 || a0[13]) && (a1[2][8] <= v0)) % 3);
+        v1 = (((68 ? v0 : a1[2][9]) < (v1 * v1)) / 1);
+    } else {
+        a0[11] = (((a0[12] != 18) < (v0 + v0)) || ((v0 * v0) != (v1 < 46)));
+        v3 = (((v3 < v2) != (v2 != v1)) || ((a1[1][7] == a1[2][12]) + (v1 / 1)));
+        a1[1][2] = (((a1[0][15] <= v0) + (31 * v1)) ? ((a0[5] % 3) && (44 >= 34)) : ((a0[2] >= v2) ? (v1 && v3) : (v2 + v1)));
+    }
+    return (((v1 ? v3 : a1[2][13]) - (v3 % 1)) && ((a0[4] == 50) + (v0 * v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,5618 @@
+    .file 1 "build/bench/batch/f29.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 244 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 245 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 246 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 247 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 248 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $97, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $37, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $17, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $53, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    jmp .Lf0_4
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movslq -24(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $25, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_6
+    jmp .Lf0_5
+.Lf0_6:
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_5:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 12 13
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_10
+    jmp .Lf0_11
+.Lf0_10:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_12
+.Lf0_11:
+    movslq -80(%rbp), %rax
+.Lf0_12:
+    cmpq $0, %rax
+    jne .Lf0_7
+    jmp .Lf0_8
+.Lf0_7:
+    cmpl $34, -20(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_9
+.Lf0_8:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_9:
+    push %rax
+    movq $8, %rax
+    push %rax
+    cmpl $12, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 13 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 14 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_19
+.Lf0_20:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_19:
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_18
+    jmp .Lf0_15
+.Lf0_18:
+    .loc 1 15 17
+    movq $47, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $81, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_22
+    jmp .Lf0_21
+.Lf0_22:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_21:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $66, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 16 17
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_24
+    jmp .Lf0_23
+.Lf0_24:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_23:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 17 17
+    movq $3, %rax
+    push %rax
+    movq $6, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_26
+    jmp .Lf0_25
+.Lf0_26:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_27
+    jmp .Lf0_28
+.Lf0_27:
+    movslq -16(%rbp), %rax
+    subq $25, %rax
+    movslq %eax, %rax
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -8(%rbp), %rax
+    addq $20, %rax
+    movslq %eax, %rax
+.Lf0_29:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_25:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_17:
+    .loc 1 13 38
+    incl -344(%rbp)
+    .loc 1 14 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_30
+    jmp .Lf0_15
+.Lf0_30:
+    .loc 1 15 17
+    movq $47, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $81, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $66, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 16 17
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_36
+    jmp .Lf0_35
+.Lf0_36:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_35:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 17 17
+    movq $3, %rax
+    push %rax
+    movq $6, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_38
+    jmp .Lf0_37
+.Lf0_38:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -16(%rbp), %rax
+    subq $25, %rax
+    movslq %eax, %rax
+    jmp .Lf0_41
+.Lf0_40:
+    movslq -8(%rbp), %rax
+    addq $20, %rax
+    movslq %eax, %rax
+.Lf0_41:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_37:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_16:
+    .loc 1 13 38
+    incl -344(%rbp)
+.Lf0_15:
+    addq $0, %rsp
+    .loc 1 19 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+.Lf0_4:
+    .loc 1 10 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 22 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_47
+    .p2align 4,,10
+.Lf0_46:
+    .loc 1 24 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 25 13
+    jmp .Lf0_51
+    .p2align 4,,10
+.Lf0_50:
+    .loc 1 26 17
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_53
+    jmp .Lf0_52
+.Lf0_53:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_52:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    imulq $53, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 27 17
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_54
+.Lf0_55:
+    cmpl $17, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_54:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -48(%rbp)
+    .loc 1 28 17
+    movq $5, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    jne .Lf0_56
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_58
+.Lf0_57:
+    movslq -16(%rbp), %rax
+.Lf0_58:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 29 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_49:
+.Lf0_51:
+    .loc 1 25 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_50
+.Lf0_48:
+    addq $0, %rsp
+    .loc 1 32 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -32(%rbp), %rax
+.Lf0_61:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_63
+.Lf0_62:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_64
+.Lf0_63:
+    movq $63, %rax
+.Lf0_64:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $12, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_66
+    jmp .Lf0_65
+.Lf0_66:
+    movq $69, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_65:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 33 9
+    movq $86, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_68
+.Lf0_67:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_70
+    jmp .Lf0_71
+.Lf0_70:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_72
+.Lf0_71:
+    movq $20, %rax
+.Lf0_72:
+    jmp .Lf0_69
+.Lf0_68:
+    movq $60, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_74
+    jmp .Lf0_73
+.Lf0_74:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_73:
+.Lf0_69:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_45:
+    .loc 1 22 30
+    incl -340(%rbp)
+.Lf0_47:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_46
+.Lf0_44:
+    addq $8, %rsp
+    .loc 1 35 5
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_76
+    jmp .Lf0_75
+.Lf0_76:
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_75:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $98, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_77
+    jmp .Lf0_78
+.Lf0_77:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_79
+.Lf0_78:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf0_79:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 37 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 38 9
+    .p2align 4,,10
+.Lf0_82:
+    .loc 1 39 13
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    addq $76, %rax
+    movslq %eax, %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_83
+    jmp .Lf0_80
+.Lf0_83:
+    .loc 1 41 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 42 17
+    .p2align 4,,10
+.Lf0_86:
+    .loc 1 43 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_89
+.Lf0_88:
+    movq $55, %rax
+    jmp .Lf0_90
+.Lf0_89:
+    movslq -344(%rbp), %rax
+.Lf0_90:
+    cmpq $89, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_87
+    jmp .Lf0_84
+.Lf0_87:
+    .loc 1 44 21
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 45 21
+    movslq -16(%rbp), %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_92
+    jmp .Lf0_91
+.Lf0_92:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_91:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_93
+    jmp .Lf0_94
+.Lf0_93:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_95
+.Lf0_94:
+    movq $14, %rax
+.Lf0_95:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 46 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_97
+    jmp .Lf0_96
+.Lf0_97:
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_96:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_98
+    jmp .Lf0_99
+.Lf0_98:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_100
+.Lf0_99:
+    movslq -8(%rbp), %rax
+.Lf0_100:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 47 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_85:
+    .loc 1 48 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_86
+.Lf0_84:
+    addq $0, %rsp
+    .loc 1 50 13
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $27, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_102
+    jmp .Lf0_101
+.Lf0_102:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_101:
+    push %rax
+    cmpl $11, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 51 13
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 52 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_81:
+    .loc 1 53 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_82
+.Lf0_80:
+    addq $8, %rsp
+    .loc 1 56 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 57 9
+    jmp .Lf0_106
+    .p2align 4,,10
+.Lf0_105:
+    .loc 1 58 13
+    movq $39, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $90, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_107
+    jmp .Lf0_103
+.Lf0_107:
+    .loc 1 59 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_113
+    .p2align 4,,10
+.Lf0_112:
+    .loc 1 60 17
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_115
+    jmp .Lf0_116
+.Lf0_115:
+    movslq -52(%rbp), %rax
+    jmp .Lf0_117
+.Lf0_116:
+    movslq -16(%rbp), %rax
+.Lf0_117:
+    cmpq $67, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_114
+    jmp .Lf0_110
+.Lf0_114:
+    .loc 1 61 17
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_119
+    jmp .Lf0_118
+.Lf0_119:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_118:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $72, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $5, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $55, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 62 17
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_120
+    jmp .Lf0_121
+.Lf0_120:
+    cmpl $69, -68(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_122
+.Lf0_121:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_124
+.Lf0_123:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_125
+.Lf0_124:
+    movslq -12(%rbp), %rax
+.Lf0_125:
+.Lf0_122:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 63 17
+    movq $9, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_132
+    jmp .Lf0_131
+.Lf0_132:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_135
+.Lf0_134:
+    movslq -80(%rbp), %rax
+.Lf0_135:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_131:
+    cmpq $0, %rax
+    jne .Lf0_128
+    jmp .Lf0_129
+.Lf0_128:
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_137
+    jmp .Lf0_136
+.Lf0_137:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_136:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_130
+.Lf0_129:
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_140
+.Lf0_139:
+    movslq -340(%rbp), %rax
+.Lf0_140:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_130:
+    movl %eax, -60(%rbp)
+    addq $0, %rsp
+.Lf0_111:
+    .loc 1 59 38
+    incl -344(%rbp)
+.Lf0_113:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_112
+.Lf0_110:
+    addq $0, %rsp
+    .loc 1 65 13
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf0_143
+.Lf0_142:
+    movslq -12(%rbp), %rax
+.Lf0_143:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 66 13
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_147
+    jmp .Lf0_146
+.Lf0_147:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_146:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_149
+.Lf0_148:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_150
+.Lf0_149:
+    movslq -340(%rbp), %rax
+.Lf0_150:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -36(%rbp)
+    .loc 1 67 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_104:
+.Lf0_106:
+    .loc 1 57 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_105
+.Lf0_103:
+    addq $8, %rsp
+    .loc 1 71 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 72 9
+    .p2align 4,,10
+.Lf0_153:
+    .loc 1 73 13
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $80, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_154
+    jmp .Lf0_151
+.Lf0_154:
+    .loc 1 74 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_156
+    jmp .Lf0_155
+.Lf0_156:
+    movq $33, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_155:
+    push %rax
+    movq $14, %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $54, %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 75 13
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_158
+    jmp .Lf0_157
+.Lf0_158:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_157:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $18, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 77 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 78 17
+    .p2align 4,,10
+.Lf0_161:
+    .loc 1 79 21
+    movslq -340(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_162
+    jmp .Lf0_163
+.Lf0_162:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_165
+    jmp .Lf0_166
+.Lf0_165:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_167
+.Lf0_166:
+    movslq -344(%rbp), %rax
+.Lf0_167:
+    jmp .Lf0_164
+.Lf0_163:
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_169
+.Lf0_168:
+    movq $38, %rax
+    jmp .Lf0_170
+.Lf0_169:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf0_170:
+.Lf0_164:
+    push %rax
+    movq $4, %rax
+    push %rax
+    cmpl $35, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -44(%rbp)
+    .loc 1 80 21
+    movq $5, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 81 21
+    movq $8, %rax
+    push %rax
+    movq $93, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_174
+    jmp .Lf0_173
+.Lf0_174:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_177
+.Lf0_176:
+    movslq -340(%rbp), %rax
+.Lf0_177:
+    push %rax
+    movq $25, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_173:
+    movl %eax, -20(%rbp)
+    .loc 1 82 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_160:
+    .loc 1 83 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_161
+.Lf0_159:
+    addq $0, %rsp
+    .loc 1 85 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_152:
+    .loc 1 86 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_153
+.Lf0_151:
+    addq $8, %rsp
+    .loc 1 88 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_183
+    .p2align 4,,10
+.Lf0_182:
+    .loc 1 89 9
+    movslq -8(%rbp), %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_184
+    jmp .Lf0_180
+.Lf0_184:
+    .loc 1 90 9
+    movq $6, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 91 9
+    cmpl $0, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $47, %rax
+    cmpq $0, %rax
+    jne .Lf0_188
+    jmp .Lf0_189
+.Lf0_188:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_190
+.Lf0_189:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf0_190:
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_186
+.Lf0_185:
+    movslq -64(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_187
+.Lf0_186:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imulq $80, %rax
+    movslq %eax, %rax
+.Lf0_187:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 93 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 94 13
+    .p2align 4,,10
+.Lf0_193:
+    .loc 1 95 17
+    movslq -8(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $86, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_194
+    jmp .Lf0_191
+.Lf0_194:
+    .loc 1 96 17
+    cmpl $35, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_195
+    jmp .Lf0_196
+.Lf0_195:
+    movslq -340(%rbp), %rax
+    addq $84, %rax
+    movslq %eax, %rax
+    jmp .Lf0_197
+.Lf0_196:
+    cmpl $29, -4(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_197:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $20, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 97 17
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_198
+    jmp .Lf0_199
+.Lf0_198:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_200
+.Lf0_199:
+    movslq -340(%rbp), %rax
+.Lf0_200:
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf0_201
+    jmp .Lf0_202
+.Lf0_201:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_203
+.Lf0_202:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_203:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_204
+    jmp .Lf0_205
+.Lf0_204:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_206
+.Lf0_205:
+    movslq -8(%rbp), %rax
+.Lf0_206:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 98 17
+    movslq -24(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_207
+    jmp .Lf0_208
+.Lf0_207:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_209
+.Lf0_208:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_211
+.Lf0_210:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_212
+.Lf0_211:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf0_212:
+.Lf0_209:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 99 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_192:
+    .loc 1 100 22
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_193
+.Lf0_191:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_181:
+    .loc 1 88 32
+    incl -340(%rbp)
+.Lf0_183:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_182
+.Lf0_180:
+    addq $8, %rsp
+    .loc 1 103 5
+    movq $57, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_217
+    jmp .Lf0_216
+.Lf0_217:
+    cmpl $23, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_216:
+    cmpq $0, %rax
+    je .Lf0_218
+    .loc 1 104 9
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    addq $87, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_219
+.Lf0_220:
+    movslq -64(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_219:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_222
+    jmp .Lf0_221
+.Lf0_222:
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_224
+    jmp .Lf0_223
+.Lf0_224:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_223:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_221:
+    movl %eax, -8(%rbp)
+    .loc 1 105 9
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 106 9
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_227
+.Lf0_226:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf0_227:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_215
+.Lf0_218:
+    .loc 1 108 9
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_229
+    jmp .Lf0_228
+.Lf0_229:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_228:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $38, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_230
+    jmp .Lf0_231
+.Lf0_230:
+    movslq -56(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_232
+.Lf0_231:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_234
+    jmp .Lf0_233
+.Lf0_234:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_233:
+.Lf0_232:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 109 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_236
+.Lf0_235:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf0_237
+.Lf0_236:
+    movq $70, %rax
+.Lf0_237:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_239
+    jmp .Lf0_238
+.Lf0_239:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_241
+    jmp .Lf0_240
+.Lf0_241:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_240:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_238:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_242
+    jmp .Lf0_243
+.Lf0_242:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_244
+.Lf0_243:
+    movq $6, %rax
+.Lf0_244:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -40(%rbp)
+    .loc 1 110 9
+    movq $79, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_246
+    jmp .Lf0_245
+.Lf0_246:
+    movq $24, %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_245:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_248
+    jmp .Lf0_247
+.Lf0_248:
+    movq $96, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_249
+.Lf0_250:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_249:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_247:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_215:
+    .loc 1 113 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 114 9
+    .p2align 4,,10
+.Lf0_253:
+    .loc 1 115 13
+    movq $9, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $90, %rax
+    cmpq $0, %rax
+    jne .Lf0_254
+    jmp .Lf0_255
+.Lf0_254:
+    movq $43, %rax
+    jmp .Lf0_256
+.Lf0_255:
+    movslq -4(%rbp), %rax
+.Lf0_256:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 116 13
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_257
+    jmp .Lf0_258
+.Lf0_257:
+    movq $51, %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_259
+.Lf0_258:
+    movq $3, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_259:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_260
+    jmp .Lf0_261
+.Lf0_260:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf0_262
+.Lf0_261:
+    movslq -28(%rbp), %rax
+.Lf0_262:
+    push %rax
+    movslq -44(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 118 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 119 17
+    jmp .Lf0_266
+    .p2align 4,,10
+.Lf0_265:
+    .loc 1 120 21
+    movslq -8(%rbp), %rax
+    imulq $79, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    jne .Lf0_267
+    jmp .Lf0_268
+.Lf0_267:
+    movq $46, %rax
+    jmp .Lf0_269
+.Lf0_268:
+    movslq -12(%rbp), %rax
+.Lf0_269:
+    push %rax
+    movq $24, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 121 21
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_271
+    jmp .Lf0_270
+.Lf0_271:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_270:
+    push %rax
+    movq $0, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $72, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $58, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -56(%rbp)
+    .loc 1 122 21
+    movq $4, %rax
+    push %rax
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf0_272
+    jmp .Lf0_273
+.Lf0_272:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_274
+.Lf0_273:
+    movq $10, %rax
+.Lf0_274:
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 123 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_264:
+.Lf0_266:
+    .loc 1 119 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_265
+.Lf0_263:
+    addq $0, %rsp
+    .loc 1 126 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_252:
+    .loc 1 127 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_253
+.Lf0_251:
+    addq $8, %rsp
+    .loc 1 130 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 131 9
+    jmp .Lf0_278
+    .p2align 4,,10
+.Lf0_277:
+    .loc 1 132 13
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $49, -32(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_279
+    jmp .Lf0_280
+.Lf0_279:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf0_281
+.Lf0_280:
+    movslq -340(%rbp), %rax
+.Lf0_281:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 133 13
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $66, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $49, %rax
+    cmpq $0, %rax
+    jne .Lf0_282
+    jmp .Lf0_283
+.Lf0_282:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf0_284
+.Lf0_283:
+    movslq -12(%rbp), %rax
+.Lf0_284:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_285
+    jmp .Lf0_286
+.Lf0_285:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf0_287
+.Lf0_286:
+    movslq -340(%rbp), %rax
+.Lf0_287:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -24(%rbp)
+    .loc 1 134 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 135 17
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 136 17
+    movq $8, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_293
+    jmp .Lf0_294
+.Lf0_293:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_295
+.Lf0_294:
+    movslq -340(%rbp), %rax
+.Lf0_295:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_297
+    jmp .Lf0_296
+.Lf0_297:
+    movq $10, %rax
+    addq $91, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_296:
+    movl %eax, -4(%rbp)
+    .loc 1 137 17
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $27, %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $35, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_299
+    jmp .Lf0_298
+.Lf0_299:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_298:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_292:
+    .loc 1 134 40
+    incl -344(%rbp)
+    .loc 1 135 17
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 136 17
+    movq $8, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_300
+    jmp .Lf0_301
+.Lf0_300:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_302
+.Lf0_301:
+    movslq -340(%rbp), %rax
+.Lf0_302:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_304
+    jmp .Lf0_303
+.Lf0_304:
+    movq $10, %rax
+    addq $91, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_303:
+    movl %eax, -4(%rbp)
+    .loc 1 137 17
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $27, %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $35, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_306
+    jmp .Lf0_305
+.Lf0_306:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_305:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_291:
+    .loc 1 134 40
+    incl -344(%rbp)
+.Lf0_290:
+    addq $0, %rsp
+    .loc 1 139 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_276:
+.Lf0_278:
+    .loc 1 131 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_277
+.Lf0_275:
+    addq $8, %rsp
+    .loc 1 142 5
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_307
+    jmp .Lf0_308
+.Lf0_307:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_309
+.Lf0_308:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_311
+    jmp .Lf0_310
+.Lf0_311:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_310:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_309:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 144 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 145 5
+    subq $8, %rsp
+    movq $10, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 146 5
+    movq $94, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 147 5
+    subq $8, %rsp
+    movq $47, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 148 5
+    movq $35, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 149 5
+    subq $64, %rsp
+    .loc 1 150 5
+    subq $256, %rsp
+    .loc 1 152 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 153 9
+    jmp .Lf1_4
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 154 13
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_6
+    jmp .Lf1_7
+.Lf1_6:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -56(%rbp), %rax
+.Lf1_8:
+    cmpq $55, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_5
+    jmp .Lf1_1
+.Lf1_5:
+    .loc 1 156 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 157 17
+    jmp .Lf1_12
+    .p2align 4,,10
+.Lf1_11:
+    .loc 1 158 21
+    movslq -344(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $40, %rax
+    cmpq $20, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $70, %rax
+    cmpq $65, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -48(%rbp)
+    .loc 1 159 21
+    movq $5, %rax
+    push %rax
+    movq $59, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_14
+    jmp .Lf1_13
+.Lf1_14:
+    cmpl $59, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_13:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 160 21
+    movslq -8(%rbp), %rax
+    addq $82, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_15
+    jmp .Lf1_16
+.Lf1_15:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_17
+.Lf1_16:
+    movq $69, %rax
+.Lf1_17:
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 161 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_10:
+.Lf1_12:
+    .loc 1 157 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_11
+.Lf1_9:
+    addq $0, %rsp
+    .loc 1 164 13
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_19
+.Lf1_18:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_20
+.Lf1_19:
+    movslq -4(%rbp), %rax
+.Lf1_20:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_21
+.Lf1_22:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_21:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 165 13
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_24
+    jmp .Lf1_23
+.Lf1_24:
+    movq $20, %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_23:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_28
+    jmp .Lf1_29
+.Lf1_28:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_30
+.Lf1_29:
+    movslq -8(%rbp), %rax
+.Lf1_30:
+    cmpq $0, %rax
+    jne .Lf1_25
+    jmp .Lf1_26
+.Lf1_25:
+    movq $44, %rax
+    cmpq $0, %rax
+    jne .Lf1_31
+    jmp .Lf1_32
+.Lf1_31:
+    movslq -36(%rbp), %rax
+    jmp .Lf1_33
+.Lf1_32:
+    movslq -16(%rbp), %rax
+.Lf1_33:
+    jmp .Lf1_27
+.Lf1_26:
+    cmpl $66, -4(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf1_27:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 166 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+.Lf1_4:
+    .loc 1 153 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 169 5
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_36
+    jmp .Lf1_35
+.Lf1_36:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_35:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_37
+    .loc 1 170 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_38
+    jmp .Lf1_39
+.Lf1_38:
+    movslq -72(%rbp), %rax
+    jmp .Lf1_40
+.Lf1_39:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf1_40:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_42
+    jmp .Lf1_41
+.Lf1_42:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_44
+    jmp .Lf1_43
+.Lf1_44:
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_43:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_41:
+    movl %eax, -56(%rbp)
+    .loc 1 171 9
+    movslq -12(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $67, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_45
+    jmp .Lf1_46
+.Lf1_45:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_49
+    jmp .Lf1_48
+.Lf1_49:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_48:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    movq $8, %rax
+    push %rax
+    movq $45, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    jmp .Lf1_47
+.Lf1_46:
+    movq $7, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_47:
+    movl %eax, -8(%rbp)
+    .loc 1 172 9
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_53
+    jmp .Lf1_52
+.Lf1_53:
+    movq $18, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_52:
+    push %rax
+    movq $74, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_34
+.Lf1_37:
+    .loc 1 174 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $19, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_54
+    jmp .Lf1_55
+.Lf1_54:
+    movq $66, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_56
+.Lf1_55:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_56:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 175 9
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_58
+    jmp .Lf1_57
+.Lf1_58:
+    movq $72, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_57:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_59
+    jmp .Lf1_60
+.Lf1_59:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_61
+.Lf1_60:
+    movslq -24(%rbp), %rax
+.Lf1_61:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $46, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -32(%rbp)
+    .loc 1 176 9
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lf1_34:
+    .loc 1 178 5
+    movq $5, %rax
+    push %rax
+    cmpl $91, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_64
+    jmp .Lf1_63
+.Lf1_64:
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_65
+    .loc 1 179 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_67
+.Lf1_66:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_68
+.Lf1_67:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_68:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_70
+    jmp .Lf1_69
+.Lf1_70:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_69:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_72
+    jmp .Lf1_71
+.Lf1_72:
+    movq $14, %rax
+    cmpq $58, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $43, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_71:
+    movl %eax, -52(%rbp)
+    .loc 1 180 9
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_77
+    jmp .Lf1_76
+.Lf1_77:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_76:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_79
+    jmp .Lf1_78
+.Lf1_79:
+    movslq -16(%rbp), %rax
+    addq $72, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_78:
+    jmp .Lf1_75
+.Lf1_74:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_81
+    jmp .Lf1_80
+.Lf1_81:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_80:
+    push %rax
+    movq $83, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_75:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 181 9
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $78, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_62
+.Lf1_65:
+    .loc 1 183 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $76, %rax
+    cmpq $0, %rax
+    jne .Lf1_85
+    jmp .Lf1_86
+.Lf1_85:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_87
+.Lf1_86:
+    movq $81, %rax
+.Lf1_87:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_82
+    jmp .Lf1_83
+.Lf1_82:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    imulq $66, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_84
+.Lf1_83:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_88
+    jmp .Lf1_89
+.Lf1_88:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf1_90
+.Lf1_89:
+    movslq -68(%rbp), %rax
+.Lf1_90:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_84:
+    movl %eax, -16(%rbp)
+    .loc 1 184 9
+    movq $9, %rax
+    push %rax
+    movq $27, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $43, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 185 9
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $41, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_92
+    jmp .Lf1_91
+.Lf1_92:
+    movq $4, %rax
+    push %rax
+    movq $33, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $95, %rax
+    subq $0, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_91:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_62:
+    .loc 1 188 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 189 9
+    jmp .Lf1_96
+    .p2align 4,,10
+.Lf1_95:
+    .loc 1 190 13
+    movq $89, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_98
+    jmp .Lf1_97
+.Lf1_98:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_100
+    jmp .Lf1_99
+.Lf1_100:
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_99:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_97:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 191 13
+    movq $8, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $19, -24(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 193 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 194 17
+    .p2align 4,,10
+.Lf1_103:
+    .loc 1 195 21
+    movq $3, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $94, %rax
+    cmpq $0, %rax
+    jne .Lf1_104
+    jmp .Lf1_105
+.Lf1_104:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_106
+.Lf1_105:
+    movslq -12(%rbp), %rax
+.Lf1_106:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $95, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 196 21
+    movq $92, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $22, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 197 21
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_107
+    jmp .Lf1_108
+.Lf1_107:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_109
+.Lf1_108:
+    movslq -344(%rbp), %rax
+.Lf1_109:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_111
+    jmp .Lf1_110
+.Lf1_111:
+    movq $15, %rax
+    imulq $35, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_110:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -40(%rbp)
+    .loc 1 198 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_102:
+    .loc 1 199 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_103
+.Lf1_101:
+    addq $0, %rsp
+    .loc 1 201 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_94:
+.Lf1_96:
+    .loc 1 189 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_95
+.Lf1_93:
+    addq $8, %rsp
+    .loc 1 204 5
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movslq -52(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+    push %rax
+    movq $35, %rax
+    cmpq $83, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_116
+    jmp .Lf1_115
+.Lf1_116:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_115:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf1_117
+    .loc 1 205 9
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $37, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_119
+.Lf1_118:
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_121
+    jmp .Lf1_122
+.Lf1_121:
+    movq $24, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_123
+.Lf1_122:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_125
+    jmp .Lf1_124
+.Lf1_125:
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_124:
+.Lf1_123:
+    jmp .Lf1_120
+.Lf1_119:
+    movq $71, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_126
+    jmp .Lf1_127
+.Lf1_126:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_128
+.Lf1_127:
+    movq $36, %rax
+.Lf1_128:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_120:
+    movl %eax, -16(%rbp)
+    .loc 1 206 9
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    addq $3, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_130
+    jmp .Lf1_129
+.Lf1_130:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_129:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_131
+.Lf1_132:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $51, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_131:
+    movl %eax, -56(%rbp)
+    .loc 1 207 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $56, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_112
+.Lf1_117:
+    .loc 1 209 9
+    movq $35, %rax
+    subl -48(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $87, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addq $74, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 210 9
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_134
+    jmp .Lf1_133
+.Lf1_134:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_133:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_136
+    jmp .Lf1_135
+.Lf1_136:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_135:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 211 9
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $36, %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+.Lf1_112:
+    .loc 1 213 5
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $33, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    imulq $92, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf1_138
+    .loc 1 214 9
+    cmpl $40, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $84, -80(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $31, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 215 9
+    movq $68, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_139
+    jmp .Lf1_140
+.Lf1_139:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_141
+.Lf1_140:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_142
+    jmp .Lf1_143
+.Lf1_142:
+    movslq -24(%rbp), %rax
+    jmp .Lf1_144
+.Lf1_143:
+    movslq -12(%rbp), %rax
+.Lf1_144:
+.Lf1_141:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $46, %rax
+    addq $19, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 216 9
+    movslq -56(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $60, -20(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_146
+    jmp .Lf1_145
+.Lf1_146:
+    movq $5, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_145:
+    movl %eax, -28(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_137
+.Lf1_138:
+    .loc 1 218 9
+    movq $9, %rax
+    push %rax
+    movq $43, %rax
+    cmpq $0, %rax
+    jne .Lf1_147
+    jmp .Lf1_148
+.Lf1_147:
+    movq $75, %rax
+    jmp .Lf1_149
+.Lf1_148:
+    movslq -12(%rbp), %rax
+.Lf1_149:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_151
+    jmp .Lf1_150
+.Lf1_151:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_150:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 219 9
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_152
+.Lf1_153:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_152:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $0, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 220 9
+    movslq -52(%rbp), %rax
+    subl -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_158
+.Lf1_157:
+    movslq -72(%rbp), %rax
+.Lf1_158:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    push %rax
+    movq $51, %rax
+    addq $2, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_159
+    jmp .Lf1_160
+.Lf1_159:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_161
+.Lf1_160:
+    movslq -40(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_161:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+.Lf1_137:
+    .loc 1 222 5
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $5, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    cmpq $0, %rax
+    jne .Lf1_162
+    jmp .Lf1_163
+.Lf1_162:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_164
+.Lf1_163:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_164:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 223 5
+    movslq -16(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $90, %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 224 5
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_169
+    jmp .Lf1_168
+.Lf1_169:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_168:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_170
+    .loc 1 225 9
+    movq $48, %rax
+    cmpq $0, %rax
+    jne .Lf1_171
+    jmp .Lf1_172
+.Lf1_171:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_173
+.Lf1_172:
+    movq $41, %rax
+.Lf1_173:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_175
+    jmp .Lf1_174
+.Lf1_175:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_174:
+    push %rax
+    movslq -72(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_177
+    jmp .Lf1_176
+.Lf1_177:
+    movq $25, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_176:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -68(%rbp)
+    .loc 1 226 9
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    subq $42, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 227 9
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_179
+    jmp .Lf1_178
+.Lf1_179:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_178:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_167
+.Lf1_170:
+    .loc 1 229 9
+    movq $6, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $22, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_181
+    jmp .Lf1_180
+.Lf1_181:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_180:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 230 9
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_186
+    jmp .Lf1_185
+.Lf1_186:
+    movslq -56(%rbp), %rax
+    addq $66, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_185:
+    cmpq $0, %rax
+    jne .Lf1_182
+    jmp .Lf1_183
+.Lf1_182:
+    movslq -56(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_184
+.Lf1_183:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_188
+    jmp .Lf1_187
+.Lf1_188:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_187:
+    push %rax
+    movq $79, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_184:
+    movl %eax, -20(%rbp)
+    .loc 1 231 9
+    movq $3, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movq $42, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_167:
+    .loc 1 233 5
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $74, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_191
+    jmp .Lf1_190
+.Lf1_191:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_190:
+    cmpq $0, %rax
+    je .Lf1_192
+    .loc 1 234 9
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_193
+    jmp .Lf1_194
+.Lf1_193:
+    movq $5, %rax
+    push %rax
+    movq $37, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_195
+.Lf1_194:
+    movslq -16(%rbp), %rax
+    imulq $71, %rax
+    movslq %eax, %rax
+.Lf1_195:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $93, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $33, %rax
+    cmpq $55, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 235 9
+    movq $3, %rax
+    push %rax
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_197
+    jmp .Lf1_196
+.Lf1_197:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_196:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_199
+    jmp .Lf1_198
+.Lf1_199:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_198:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 236 9
+    movq $1, %rax
+    push %rax
+    movq $68, %rax
+    cmpq $0, %rax
+    jne .Lf1_200
+    jmp .Lf1_201
+.Lf1_200:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_202
+.Lf1_201:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf1_202:
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_189
+.Lf1_192:
+    .loc 1 238 9
+    cmpl $18, -32(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_204
+    jmp .Lf1_203
+.Lf1_204:
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $46, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_203:
+    movl %eax, -36(%rbp)
+    .loc 1 239 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_206
+    jmp .Lf1_205
+.Lf1_206:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_205:
+    movl %eax, -16(%rbp)
+    .loc 1 240 9
+    movq $31, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_207
+    jmp .Lf1_208
+.Lf1_207:
+    movq $3, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_211
+    jmp .Lf1_210
+.Lf1_211:
+    movq $44, %rax
+    cmpq $34, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_210:
+    jmp .Lf1_209
+.Lf1_208:
+    movslq -72(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_213
+.Lf1_212:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_215
+.Lf1_216:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_215:
+    jmp .Lf1_214
+.Lf1_213:
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_214:
+.Lf1_209:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_189:
+    .loc 1 242 5
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_217
+    jmp .Lf1_218
+.Lf1_217:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_219
+.Lf1_218:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_219:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_221
+    jmp .Lf1_220
+.Lf1_221:
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $50, -64(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_220:
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
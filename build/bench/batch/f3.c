@@ -0,0 +1,435 @@
+int f0() {
+    int v0 = 30;
+    int v1 = 94;
+    int v2 = 31;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 / 5) > 82) break;
+            v2 = (((v2 ? 18 : 78) % 3) && ((a1[2][13] && 86) % 4));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v3 = (((v2 + 57) ? (v1 / 9) : (a0[3] ? a1[0][14] : v2)) % 3);
+                    v3 = (((i0 % 9) == (v0 <= v1)) / 8);
+                    v2 = (((v2 < v3) == (v3 - 57)) && ((13 == a1[1][4]) ? (8 ? v3 : v2) : (v3 / 8)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][15] = (((v2 + 20) == (i0 || 46)) - ((a0[11] < i0) < (v1 ? v3 : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v1 < v2) > 94) break;
+            v3 = (((v1 % 2) + (60 <= v3)) <= ((v2 <= v0) && (v1 != 0)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v3 = (((a1[2][8] + a1[0][13]) * (39 || 89)) / 4);
+                v3 = (((50 - i2) - (i3 > a1[1][4])) || ((30 + v2) || (a0[9] && a0[15])));
+                v1 = (((20 * i3) + (v3 + i2)) >= ((v1 / 7) / 5));
+            }
+            v2 = (((v2 >= a1[3][15]) != (41 ? v3 : 33)) >= ((97 + a0[3]) <= (v0 / 7)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v3 = (((79 + 85) == (a0[3] ? v1 : v2)) + ((33 ? v1 : 43) / 3));
+            a1[2][10] = (((v0 - v0) != (4 / 8)) >= ((25 * v1) > (v3 - v2)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v0 = (((v2 > 53) != (a0[11] + i4)) ? ((v3 >= a0[1]) ? (a0[9] * a1[1][12]) : (a0[3] < a1[2][6])) : ((v3 <= v1) > (65 % 5)));
+                a1[2][6] = (((v0 >= v2) / 6) ? ((v1 >= i4) / 4) : ((a0[2] * v1) == (a1[2][5] == 38)));
+                v1 = (((52 ? v1 : 30) && (49 != a1[0][2])) && ((0 || a1[3][7]) > (84 % 5)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            v0 = (((a0[5] * 53) ? (75 % 4) : (i7 < 49)) ? ((i6 / 3) <= (i7 ? 22 : a1[1][8])) : ((a1[1][3] && a0[12]) || (i7 <= v3)));
+            v3 = (((88 && v2) - (a0[10] < i6)) / 5);
+            v1 = (((v3 <= i7) + (a0[14] == 72)) && ((i6 < i6) >= (a0[7] == 0)));
+        }
+        a0[14] = (((a1[1][9] && v3) + (a0[15] != 58)) - ((v3 % 1) != (a1[1][14] || v0)));
+        v3 = (((i6 > v1) / 1) < ((v0 || v2) / 1));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            if ((a0[12] + i8) > 84) break;
+            v2 = (((68 > v3) && (i8 + a1[3][5])) <= ((48 ? v2 : v1) / 4));
+            v2 = (((i8 && 69) ? (v0 < 47) : (3 >= v1)) || ((a1[1][14] < a0[12]) || (54 ? v2 : a1[2][9])));
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    v2 = (((i8 - a0[10]) / 6) * ((a1[3][3] * v2) || (v3 || v0)));
+                    v0 = (((43 && 63) / 4) + ((i9 && 28) + (67 ? v2 : a1[1][6])));
+                    v2 = (((a1[2][8] % 3) != (79 || 95)) <= ((v3 ? 31 : 19) > (i8 * a1[0][11])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        {
+            int i11 = 0;
+            while (i11 < 7) {
+                if ((27 * i10) > 50) break;
+                a1[1][7] = (((a0[8] > i11) != (v3 + v0)) % 6);
+                v0 = (((81 < i11) + (95 || v0)) / 7);
+                v0 = (((50 * v3) ? (a1[3][0] > 93) : (a0[10] + a1[1][8])) && ((i10 >= v2) || (v0 != v2)));
+                i11 = i11 + 1;
+            }
+        }
+        v1 = (((v3 && i10) == (i10 ? v1 : v2)) > ((54 && v0) <= (21 ? v3 : v1)));
+        v3 = (((v0 && 80) < (v1 < v0)) >= ((3 && 75) && (a1[0][1] % 8)));
+    }
+    for (int i12 = 0; i12 < 8; i12 = i12 + 1) {
+        v3 = (((a0[4] < 19) || (98 == a0[6])) / 3);
+        {
+            int i13 = 0;
+            while (i13 < 3) {
+                if ((v0 ? 80 : v1) > 92) break;
+                a1[1][4] = (((a1[0][0] <= a1[2][13]) / 6) - ((v0 / 1) && (v3 / 3)));
+                v0 = (((i12 && v1) > (i12 > v1)) < ((a1[0][13] > a1[0][13]) - (a0[5] ? a0[1] : v3)));
+                a0[3] = (((v0 <= i13) > (v3 % 4)) && ((i13 || v0) >= (v1 - v3)));
+                i13 = i13 + 1;
+            }
+        }
+        v0 = (((a1[2][13] - 19) != (v3 ? v0 : v3)) - ((a0[5] || v0) == (v1 ? v2 : v0)));
+    }
+    v3 = (((v1 == v3) != (v2 != v1)) * ((v3 >= a1[1][0]) - (v1 > a1[3][9])));
+    v2 = (((v2 + v0) ? (v3 ? a1[1][4] : v2) : (v3 > 22)) != ((a0[1] + v0) != (v0 && v3)));
+    for (int i14 = 0; i14 < 4; i14 = i14 + 1) {
+        v0 = (((i14 && v3) >= (26 < v1)) * ((30 == v0) != (v3 <= a1[3][8])));
+        v2 = (((v1 - a0[13]) / 1) && ((i14 ? i14 : v0) / 4));
+        {
+            int i15 = 0;
+            do {
+                if ((i15 % 5) > 52) break;
+                v0 = (((a0[10] * i14) == (64 && a0[6])) + ((a0[13] ? v1 : v2) != (v2 >= v1)));
+                a0[14] = (((v1 * a1[2][4]) / 6) <= ((81 % 7) - (i15 <= a1[1][7])));
+                a1[2][15] = (((v1 != a0[1]) || (72 == a0[5])) && ((56 - 45) && (v3 || v2)));
+                i15 = i15 + 1;
+            } while (i15 < 4);
+        }
+    }
+    return (((v0 * 73) ? (a0[3] ? v2 : v1) : (a0[8] + a1[3][0])) + ((a1[3][14] ? v1 : a1[0][14]) >= (27 - 50)));
+}
+int f1() {
+    int v0 = 5;
+    int v1 = 59;
+    int v2 = 49;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v0 + v2) == (v0 * a1[1][15])) >= ((v2 % 3) * (v3 != a0[0])));
+    if ((((v1 <= v0) * (v3 % 8)) >= ((a1[1][14] ? 96 : 35) % 5))) {
+        a0[14] = (((v3 > v3) > (a1[2][8] * a0[4])) - ((a1[1][9] >= v0) < (4 > a0[11])));
+        v1 = (((a1[2][11] <= a1[1][12]) <= (v2 ? v0 : a0[14])) % 7);
+        v0 = (((v2 <= a1[3][1]) % 3) != ((50 - a0[4]) > (19 / 4)));
+    } else {
+        v2 = (((13 <= v0) % 5) - ((a0[3] || v1) % 9));
+        v3 = (((v3 > a0[12]) ? (v3 * v2) : (v3 >= v3)) ? ((11 != a0[15]) * (v0 % 3)) : ((v2 <= v0) || (v3 >= v3)));
+        v2 = (((a1[2][9] ? a1[1][5] : v3) > (a0[11] / 3)) ? ((36 * 78) ? (18 ? a1[0][13] : 62) : (v3 <= v0)) : ((a0[5] && v2) / 8));
+    }
+    if ((((a1[1][9] * 60) == (a1[1][0] >= v1)) + ((a1[3][5] - 72) < (v3 < 65)))) {
+        v3 = (((46 / 2) + (v2 % 9)) && ((1 && v3) ? (a1[2][10] != v0) : (a0[8] - v0)));
+        a1[1][15] = (((v3 >= a0[3]) - (v2 / 5)) && ((v1 * a1[1][12]) ? (v2 ? v2 : a0[9]) : (55 || v0)));
+        a0[12] = (((a1[2][7] / 2) ? (21 % 8) : (a1[0][2] * a0[4])) + ((41 / 7) + (v0 >= a1[2][3])));
+    } else {
+        a1[3][8] = (((6 ? v1 : v1) < (v0 < v2)) || ((28 == v1) + (98 % 5)));
+        v0 = (((15 ? v0 : v0) ? (v2 && v1) : (v2 ? a1[1][6] : v2)) ? ((16 > 99) + (a0[7] >= v1)) : ((v0 % 2) != (a1[3][11] ? 7 : v3)));
+        a0[8] = (((v1 > v0) ? (a0[5] - a1[3][9]) : (74 ? v3 : v1)) * ((a1[1][14] <= v0) / 1));
+    }
+    if ((((a0[0] != v2) ? (a1[2][10] - 11) : (v1 / 5)) ? ((a0[11] ? v1 : v1) * (v0 + a0[5])) : ((v0 <= v3) >= (a1[2][2] || a0[13])))) {
+        a0[1] = (((v0 % 5) / 8) > ((a1[2][8] <= 55) + (a0[7] ? v1 : v0)));
+        v1 = (((v1 < 96) ? (v2 % 5) : (a1[1][12] % 8)) >= ((a1[1][8] && 46) >= (a0[8] * 87)));
+        a1[1][11] = (((37 == 5) ? (a1[3][2] < 91) : (a0[8] == a0[1])) ? ((37 - v2) + (a1[2][8] ? v1 : v3)) : ((a0[6] + v0) || (v3 - 51)));
+    } else {
+        a0[10] = (((v3 ? 66 : a0[7]) || (v0 + v3)) < ((v0 + v1) == (a1[2][9] / 8)));
+        v3 = (((v3 > v1) < (40 * v3)) % 2);
+        v3 = (((v2 - 59) ? (a0[7] == v3) : (22 == 8)) > ((v0 >= v2) >= (v0 * v2)));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            v0 = (((i0 % 3) > (v1 < v0)) >= ((v1 % 5) < (i1 == v2)));
+            v2 = (((i1 >= a1[2][13]) < (v3 % 3)) <= ((v2 && v1) * (v1 * v0)));
+            a0[10] = (((v3 / 7) + (i1 + v2)) <= ((15 || a0[10]) || (v0 ? 62 : v2)));
+        }
+        v1 = (((96 || v1) <= (v0 / 4)) <= ((i0 % 1) >= (v0 >= v2)));
+        a1[1][10] = (((v3 || a1[1][5]) || (v3 <= a1[2][9])) / 7);
+    }
+    if ((((v0 / 3) > (v1 - a1[1][9])) && ((v1 == a0[11]) > (v3 || v3)))) {
+        a0[8] = (((a0[14] - v1) < (a1[3][8] != 90)) ? ((3 ? v1 : a1[1][4]) < (a0[1] >= v1)) : ((a1[3][9] * 15) ? (v0 == v2) : (4 > a0[10])));
+        a0[9] = (((v1 % 7) != (6 >= v0)) % 9);
+        a1[2][3] = (((v0 % 7) != (a1[1][10] <= 5)) - ((v0 * 5) ? (26 ? v0 : v1) : (a0[0] % 2)));
+    } else {
+        v1 = (((50 < a0[1]) + (a0[10] % 3)) - ((14 ? v0 : v0) % 1));
+        v2 = (((a0[13] > a0[15]) <= (v3 / 6)) <= ((88 - v1) - (13 >= v3)));
+        v3 = (((v0 >= a1[0][10]) ? (v3 > 8) : (v3 == a1[0][10])) && ((66 * 94) + (v3 + v0)));
+    }
+    if ((((v0 + v0) + (58 ? v1 : v0)) < ((16 / 5) > (37 / 5)))) {
+        v2 = (((a1[3][9] + v3) && (v1 != v2)) == ((v0 - a0[6]) % 8));
+        v2 = (((v3 - a0[8]) % 2) ? ((v1 < 67) / 2) : ((v0 > a0[11]) - (66 % 9)));
+        a1[3][8] = (((v0 <= v3) ? (a0[10] || 99) : (v1 % 3)) * ((a1[3][10] && 79) % 9));
+    } else {
+        v1 = (((v1 != v1) == (57 != v0)) > ((20 <= v1) < (v1 <= 31)));
+        v2 = (((17 || v2) > (v2 && 46)) ? ((26 ? a0[6] : v1) != (v1 - a0[10])) : ((13 + v2) % 4));
+        a0[5] = (((v1 ? v0 : v1) == (v2 != 78)) % 9);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a0[12] = (((v0 - 30) != (v3 ? 19 : a0[9])) * ((a0[9] ? a0[7] : 88) == (a1[2][6] || 63)));
+                a0[13] = (((a1[1][2] == v1) > (v0 && 59)) > ((a0[11] ? v0 : i2) < (a0[11] || v3)));
+                v1 = (((v1 ? a0[4] : v0) % 1) ? ((v2 || 15) + (v2 ? i2 : 30)) : ((v3 <= v2) % 9));
+            }
+            v0 = (((a0[14] != 62) != (v3 && v1)) >= ((37 >= 1) && (v2 ? a0[12] : v2)));
+            v0 = (((66 > a1[3][4]) ? (a1[2][5] + a1[1][7]) : (v3 % 2)) * ((a1[2][10] % 7) + (a1[0][0] - a0[5])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((i4 == a1[0][4]) == (66 ? v0 : v1)) <= ((a1[1][5] >= i4) > (v2 > i4)));
+        {
+            int i5 = 0;
+            do {
+                a0[10] = (((96 >= v2) < (v2 - 84)) % 2);
+                v1 = (((17 ? 6 : a0[3]) > (i4 >= i4)) && ((v1 - v2) + (i5 == 50)));
+                a1[2][5] = (((a0[4] != v1) || (49 * i4)) % 3);
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        a0[4] = (((v2 * v1) ? (v0 + v0) : (28 < v0)) == ((76 * v2) ? (98 >= i4) : (v3 * v2)));
+    }
+    if ((((a1[2][6] == v2) - (v1 * v0)) <= ((6 - 9) >= (a0[6] * a0[13])))) {
+        v0 = (((a0[7] - a1[0][8]) < (a1[3][12] <= 88)) == ((45 >= v2) && (a1[0][8] == 61)));
+        v2 = (((v2 == v0) || (84 / 3)) == ((v1 >= v3) * (a0[14] >= v3)));
+        v0 = (((a1[3][2] / 2) > (v2 != 45)) < ((v1 || v2) != (v2 - v0)));
+    } else {
+        v0 = (((2 != v1) < (a1[0][1] || v3)) + ((56 > v2) / 1));
+        v3 = (((v1 / 3) != (a0[14] / 4)) / 6);
+        a1[0][6] = (((41 ? a1[3][12] : v1) - (a1[3][10] / 6)) * ((v2 == v0) || (v3 - 60)));
+    }
+    return (((v2 && v2) >= (38 - v1)) != ((25 >= a0[1]) - (a1[0][4] || a1[1][2])));
+}
+int f2() {
+    int v0 = 24;
+    int v1 = 12;
+    int v2 = 3;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    a1[3][15] = (((95 || v3) - (25 || v2)) == ((a0[2] + 12) ? (v2 < v1) : (a0[2] % 5)));
+    v2 = (((v2 <= v3) || (v2 == v1)) > ((v3 * v3) ? (a0[5] < v0) : (a0[6] % 1)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v2 = (((v2 == v2) && (v3 % 9)) ? ((a0[10] < v0) ? (74 >= v2) : (v0 == 33)) : ((v1 ? 0 : a0[14]) * (i0 * 96)));
+        a0[3] = (((a1[0][2] % 7) % 6) != ((a1[2][7] != 25) == (91 >= 59)));
+        {
+            int i1 = 0;
+            do {
+                v2 = (((21 < v0) < (v3 < a1[0][4])) <= ((v0 >= v1) == (i0 != i0)));
+                a0[8] = (((a0[6] ? a0[9] : v3) || (i0 * v1)) + ((a0[7] % 5) / 8));
+                v0 = (((v1 - i1) != (v2 ? a1[0][8] : a0[13])) / 5);
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((i2 + v0) + (a0[1] >= a0[2])) > ((v1 >= v0) ? (v1 / 4) : (a0[13] % 3)));
+                    v3 = (((31 <= 86) + (16 > v1)) - ((v3 * a0[12]) ? (i3 != 77) : (a0[9] > v2)));
+                    v3 = (((v2 || 57) >= (v1 <= 12)) <= ((i3 * a1[1][15]) || (v1 > a0[7])));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            v3 = (((a0[9] + v1) ? (65 < v3) : (v1 / 8)) * ((v1 % 4) > (a0[10] <= v1)));
+            v0 = (((v2 == 68) % 4) * ((a0[5] == v3) < (a1[0][1] <= i2)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v0 = (((v1 == a0[14]) + (a0[12] ? a0[10] : v0)) || ((v3 != a1[1][3]) > (v1 <= v1)));
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a0[15] = (((0 >= 57) && (v3 < i4)) == ((v1 + a1[1][6]) + (v1 >= v3)));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((a0[10] == a1[1][10]) || (a1[3][11] - i4)) < ((a0[5] % 3) ? (v0 != v1) : (v1 % 5)));
+                    v0 = (((i4 && i4) >= (v3 / 2)) >= ((a1[2][12] % 5) / 2));
+                    v2 = (((i5 != 37) <= (a0[5] != v2)) + ((i4 % 4) - (54 + 42)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a0[13] = (((v3 % 5) / 7) + ((75 % 4) ? (a0[6] / 8) : (v1 <= i4)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            {
+                int i7 = 0;
+                do {
+                    if ((95 ? a0[1] : a0[3]) > 72) break;
+                    v1 = (((36 || a1[0][6]) * (a0[1] || a0[0])) - ((i7 % 3) > (i6 > v3)));
+                    v0 = (((13 || a1[0][1]) > (v0 < v1)) / 6);
+                    v1 = (((v2 < v2) || (2 - i6)) - ((i6 <= 11) ? (v3 / 5) : (a0[14] == a0[5])));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            v0 = (((a0[3] > a1[0][4]) && (v2 ? v1 : v1)) ? ((i6 + i6) % 6) : ((v0 + a0[4]) >= (v1 ? v3 : i6)));
+            a0[3] = (((v3 ? v1 : v3) < (29 + v1)) ? ((v0 ? a0[0] : v1) > (v3 / 8)) : ((v0 >= v0) || (v0 != a0[15])));
+            i6 = i6 + 1;
+        }
+    }
+    v0 = (((a0[0] == v2) >= (a1[2][4] <= a1[1][4])) < ((49 <= a0[5]) % 6));
+    v0 = (((a1[1][6] <= a0[7]) < (74 > 92)) > ((v0 < a1[1][11]) ? (74 - v2) : (a0[10] > 68)));
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        a0[10] = (((v3 <= i8) > (i8 > v3)) > ((30 ? 3 : 1) - (90 != 24)));
+        {
+            int i9 = 0;
+            do {
+                if ((v1 % 8) > 95) break;
+                v1 = (((a1[0][1] > i8) || (a0[11] < 39)) ? ((v2 || a0[11]) == (a0[4] <= v3)) : ((87 > v2) % 9));
+                v0 = (((v2 * i9) && (a1[3][13] ? a1[0][2] : v0)) <= ((v0 || v0) || (a1[2][4] != v1)));
+                v3 = (((v1 == a0[9]) <= (v1 > v3)) || ((45 / 4) ? (v0 ? a0[5] : 82) : (a1[3][3] ? v2 : v0)));
+                i9 = i9 + 1;
+            } while (i9 < 5);
+        }
+        v2 = (((v3 >= v1) + (47 > i8)) != ((83 ? 18 : 40) != (v2 != v0)));
+    }
+    return (((a0[1] > a0[3]) / 9) && ((18 + v0) && (v1 <= v3)));
+}
+int f3() {
+    int v0 = 58;
+    int v1 = 8;
+    int v2 = 61;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v2 = (((v0 / 1) ? (v2 > i0) : (v2 <= v1)) <= ((a1[3][5] + v1) + (36 != 40)));
+        a0[6] = (((28 == v2) >= (i0 == 53)) > ((i0 >= v1) * (v3 > 55)));
+        {
+            int i1 = 0;
+            do {
+                if ((87 < a1[1][13]) > 73) break;
+                a0[14] = (((v0 == i1) - (10 != i1)) % 2);
+                v1 = (((v1 ? i0 : a1[2][3]) * (31 != 3)) - ((8 == i1) * (v1 >= i1)));
+                v3 = (((v3 == i0) > (v1 / 6)) && ((i0 || a1[1][10]) % 8));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((i2 && a0[4]) > 84) break;
+            v3 = (((v2 && a0[10]) || (a1[1][5] <= 57)) / 2);
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a1[2][8] = (((v0 ? 94 : v1) < (v2 ? v0 : 20)) * ((56 ? v3 : i3) ? (a1[3][6] - a1[0][10]) : (v3 < v3)));
+                a0[12] = (((97 / 4) ? (30 < v0) : (v2 >= v2)) == ((a1[3][8] != i3) + (i2 || 79)));
+                a1[3][6] = (((73 == v2) >= (i3 <= 37)) == ((v1 <= 0) == (v3 ? 96 : v0)));
+            }
+            v2 = (((v2 > v1) >= (v0 <= 85)) ? ((25 ? a1[1][4] : a1[3][7]) / 9) : ((v2 || 53) >= (0 / 3)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v0 = (((a0[10] > a0[3]) < (a0[0] / 7)) && ((a1[0][5] ? v3 : a1[3][0]) - (a0[2] * v3)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    if ((a1[1][0] ? a0[8] : 58) > 55) break;
+                    v0 = (((91 * i4) ? (v0 * v1) : (a0[7] ? v1 : v3)) <= ((i4 / 4) <= (a1[0][2] + v1)));
+                    v1 = (((76 ? 34 : v1) / 8) != ((a0[3] >= v0) >= (i5 / 5)));
+                    v1 = (((a0[12] + 42) <= (a1[2][6] > i5)) * ((v2 >= a1[3][3]) && (i5 > a1[2][0])));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((v3 < v2) || (v2 > 47)) >= ((69 >= v1) * (a0[7] != v2)));
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((v2 + v3) < (v0 ? v2 : v3)) + ((87 == 93) ? (v3 - 13) : (v1 > a0[11])));
+    if ((((49 <= v0) + (a1[0][8] == v0)) > ((v2 > a0[6]) + (v3 || 94)))) {
+        v3 = (((v1 ? 63 : 42) != (v2 ? v1 : 30)) + ((v0 >= v1) / 8));
+        v1 = (((81 > a0[9]) >= (v3 + v1)) ? ((v1 % 1) != (a1[1][10] <= a0[11])) : ((a1[2][2] ? 12 : 69) != (a0[14] - v3)));
+        a1[3][8] = (((v0 < 57) || (v1 == 94)) / 3);
+    } else {
+        v3 = (((77 <= v1) && (59 <= a1[0][2])) || ((a1[3][12] % 3) || (89 && a1[1][2])));
+        a0[2] = (((v2 ? 44 : 12) && (a0[1] * v2)) % 4);
+        v0 = (((v1 && v0) ? (21 < 93) : (v1 < v3)) != ((a0[13] ? 98 : 5) * (v1 % 9)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((99 ? v2 : a1[0][11]) != (v2 || v1)) && ((v1 ? v2 : 22) + (v2 && i6)));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((v2 < a0[14]) % 3) && ((27 - a0[6]) * (65 != a1[2][13])));
+                    a0[15] = (((v1 <= 69) - (a0[0] == 89)) ? ((i7 > v1) % 8) : ((v3 / 1) + (v3 && 95)));
+                    a1[0][3] = (((v1 < i6) && (v0 || i7)) + ((v0 ? i7 : v0) >= (v0 && v0)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            v3 = (((9 - v1) > (v3 % 1)) ? ((i6 ? v0 : v1) < (34 != v0)) : ((a1[0][6] - a1[0][8]) < (v3 > 50)));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        a1[1][11] = (((v3 > 64) % 5) - ((a1[0][1] || 54) <= (8 == v2)));
+        {
+            int i9 = 0;
+            while (i9 < 3) {
+                v3 = (((a0[2] != v0) + (i9 / 3)) / 1);
+                v0 = (((v2 == 83) * (a0[2] == v2)) < ((a1[2][14] >= i8) ? (84 >= v3) : (i8 >= a0[9])));
+                v3 = (((v1 / 5) + (v1 || v2)) * ((i9 + v1) || (a1[2][9] - i8)));
+                i9 = i9 + 1;
+            }
+        }
+        a1[1][9] = (((a1[1][14] || 79) % 1) - ((18 >= v1) + (a1[3][4] || v2)));
+    }
+    a0[2] = (((a0[3] + a0[11]) <= (v2 || 7)) >= ((31 == a1[1][1]) ? (a1[1][10] + a0[6]) : (29 - 59)));
+    a0[15] = (((v3 ? a0[5] : 60) ? (37 ? a1[2][7] : a1[1][15]) : (a0[4] <= a0[15])) > ((v1 || a0[3]) != (a0[8] - v2)));
+    {
+        int i10 = 0;
+        while (i10 < 8) {
+            a0[10] = (((a0[2] >= a1[2][7]) * (i10 || i10)) == ((i10 + a0[0]) && (i10 || a0[8])));
+            v2 = (((v0 != 19) > (v0 > a0[3])) / 4);
+            for (int i11 = 0; i11 < 5; i11 = i11 + 1) {
+                v2 = (((v2 >= v1) ? (v2 == 81) : (v2 % 9)) <= ((v0 || 44) < (v3 < 62)));
+                v1 = (((i10 != 20) > (i10 && 93)) || ((v3 + i10) == (i11 - a0[11])));
+                a1[2][7] = (((v3 && v3) == (a1[1][3] > 51)) / 6);
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((v2 >= 65) ? (40 + v2) : (v1 ? v0 : a1[0][11])) ? ((v2 || a1[1][6]) < (57 || 71)) : ((v2 || v2) && (v1 - v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,9904 @@
+    .file 1 "build/bench/batch/f3.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 428 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 429 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 430 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 431 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 432 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 433 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 434 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $30, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $94, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $31, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $73, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $82, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_4
+    jmp .Lf0_1
+.Lf0_4:
+    .loc 1 12 13
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_5
+    jmp .Lf0_6
+.Lf0_5:
+    movq $18, %rax
+    jmp .Lf0_7
+.Lf0_6:
+    movq $78, %rax
+.Lf0_7:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_8
+.Lf0_9:
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_11
+    jmp .Lf0_10
+.Lf0_11:
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_10:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_8:
+    movl %eax, -12(%rbp)
+    .loc 1 14 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 15 17
+    jmp .Lf0_15
+    .p2align 4,,10
+.Lf0_14:
+    .loc 1 16 21
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $57, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_16
+    jmp .Lf0_17
+.Lf0_16:
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_18
+.Lf0_17:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_19
+    jmp .Lf0_20
+.Lf0_19:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf0_21
+.Lf0_20:
+    movslq -12(%rbp), %rax
+.Lf0_21:
+.Lf0_18:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 17 21
+    movq $8, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 18 21
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $57, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_23
+    jmp .Lf0_22
+.Lf0_23:
+    movq $13, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_24
+    jmp .Lf0_25
+.Lf0_24:
+    movq $8, %rax
+    cmpq $0, %rax
+    jne .Lf0_27
+    jmp .Lf0_28
+.Lf0_27:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -12(%rbp), %rax
+.Lf0_29:
+    jmp .Lf0_26
+.Lf0_25:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_26:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_22:
+    movl %eax, -12(%rbp)
+    .loc 1 19 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_13:
+.Lf0_15:
+    .loc 1 15 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_14
+.Lf0_12:
+    addq $0, %rsp
+    .loc 1 22 13
+    movslq -36(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_31
+.Lf0_30:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_32
+.Lf0_31:
+    movslq -340(%rbp), %rax
+.Lf0_32:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $20, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 23 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 24 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 27 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 28 9
+    .p2align 4,,10
+.Lf0_37:
+    .loc 1 29 13
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_38
+    jmp .Lf0_35
+.Lf0_38:
+    .loc 1 30 13
+    movq $60, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_40
+    jmp .Lf0_39
+.Lf0_40:
+    cmpl $0, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_39:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 31 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 32 17
+    movq $4, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_47
+    jmp .Lf0_46
+.Lf0_47:
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_46:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 33 17
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $50, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_49
+    jmp .Lf0_48
+.Lf0_49:
+    movq $30, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_51
+    jmp .Lf0_50
+.Lf0_51:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_53
+    jmp .Lf0_52
+.Lf0_53:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_52:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_50:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_48:
+    movl %eax, -16(%rbp)
+    .loc 1 34 17
+    movslq -16(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $20, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_45:
+    .loc 1 31 38
+    incl -344(%rbp)
+    .loc 1 32 17
+    movq $4, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_55
+    jmp .Lf0_54
+.Lf0_55:
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_54:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 33 17
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $50, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_57
+    jmp .Lf0_56
+.Lf0_57:
+    movq $30, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_59
+    jmp .Lf0_58
+.Lf0_59:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_60
+.Lf0_61:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_60:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_58:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_56:
+    movl %eax, -16(%rbp)
+    .loc 1 34 17
+    movslq -16(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $20, %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_44:
+    .loc 1 31 38
+    incl -344(%rbp)
+.Lf0_43:
+    addq $0, %rsp
+    .loc 1 36 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_63
+.Lf0_62:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_64
+.Lf0_63:
+    movq $33, %rax
+.Lf0_64:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $97, %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 37 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_36:
+    .loc 1 38 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_37
+.Lf0_35:
+    addq $8, %rsp
+    .loc 1 41 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 42 9
+    jmp .Lf0_68
+    .p2align 4,,10
+.Lf0_67:
+    .loc 1 43 13
+    movq $3, %rax
+    push %rax
+    movq $33, %rax
+    cmpq $0, %rax
+    jne .Lf0_69
+    jmp .Lf0_70
+.Lf0_69:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_71
+.Lf0_70:
+    movq $43, %rax
+.Lf0_71:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    addq $85, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_72
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_74
+.Lf0_73:
+    movslq -12(%rbp), %rax
+.Lf0_74:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 44 13
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $4, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $25, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 45 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_80
+    .p2align 4,,10
+.Lf0_79:
+    .loc 1 46 17
+    cmpl $53, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -36(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_81
+    jmp .Lf0_82
+.Lf0_81:
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_84
+    jmp .Lf0_85
+.Lf0_84:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_86
+.Lf0_85:
+    movslq -68(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_86:
+    jmp .Lf0_83
+.Lf0_82:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $65, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_83:
+    movl %eax, -4(%rbp)
+    .loc 1 47 17
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_87
+    jmp .Lf0_88
+.Lf0_87:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_89
+.Lf0_88:
+    movslq -72(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $38, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_89:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 48 17
+    movq $52, %rax
+    cmpq $0, %rax
+    jne .Lf0_90
+    jmp .Lf0_91
+.Lf0_90:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_92
+.Lf0_91:
+    movq $30, %rax
+.Lf0_92:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_93
+.Lf0_94:
+    movq $49, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_93:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_96
+    jmp .Lf0_95
+.Lf0_96:
+    movq $0, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $84, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_95:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_78:
+    .loc 1 45 38
+    incl -344(%rbp)
+.Lf0_80:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_79
+.Lf0_77:
+    addq $0, %rsp
+    .loc 1 50 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_66:
+.Lf0_68:
+    .loc 1 42 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_67
+.Lf0_65:
+    addq $8, %rsp
+    .loc 1 53 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_104
+    .p2align 4,,10
+.Lf0_103:
+    .loc 1 54 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_110
+    .p2align 4,,10
+.Lf0_109:
+    .loc 1 55 13
+    movslq -60(%rbp), %rax
+    imulq $53, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_115
+.Lf0_114:
+    movq $4, %rax
+    push %rax
+    movq $75, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_116
+.Lf0_115:
+    cmpl $49, -344(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf0_116:
+    cmpq $0, %rax
+    jne .Lf0_111
+    jmp .Lf0_112
+.Lf0_111:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_118
+.Lf0_117:
+    movq $22, %rax
+    jmp .Lf0_119
+.Lf0_118:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf0_119:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_113
+.Lf0_112:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_120
+.Lf0_121:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_120:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_123
+    jmp .Lf0_122
+.Lf0_123:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_122:
+.Lf0_113:
+    movl %eax, -4(%rbp)
+    .loc 1 56 13
+    movq $5, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_125
+    jmp .Lf0_124
+.Lf0_125:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_124:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 57 13
+    cmpl $72, -24(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $0, -52(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_108:
+    .loc 1 54 34
+    incl -344(%rbp)
+.Lf0_110:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_109
+.Lf0_107:
+    addq $0, %rsp
+    .loc 1 59 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $58, -20(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_131
+    jmp .Lf0_130
+.Lf0_131:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_130:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 60 9
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_133
+    jmp .Lf0_132
+.Lf0_133:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_132:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_102:
+    .loc 1 53 30
+    incl -340(%rbp)
+.Lf0_104:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_103
+.Lf0_101:
+    addq $8, %rsp
+    .loc 1 63 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 64 9
+    jmp .Lf0_137
+    .p2align 4,,10
+.Lf0_136:
+    .loc 1 65 13
+    movslq -32(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_138
+    jmp .Lf0_134
+.Lf0_138:
+    .loc 1 66 13
+    movq $68, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_140
+    jmp .Lf0_139
+.Lf0_140:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_139:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $48, %rax
+    cmpq $0, %rax
+    jne .Lf0_141
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_143
+.Lf0_142:
+    movslq -8(%rbp), %rax
+.Lf0_143:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 67 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_147
+.Lf0_148:
+    movq $69, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_147:
+    cmpq $0, %rax
+    jne .Lf0_144
+    jmp .Lf0_145
+.Lf0_144:
+    cmpl $47, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_146
+.Lf0_145:
+    movq $3, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf0_146:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_150
+    jmp .Lf0_149
+.Lf0_150:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_152
+    jmp .Lf0_151
+.Lf0_152:
+    movq $54, %rax
+    cmpq $0, %rax
+    jne .Lf0_153
+    jmp .Lf0_154
+.Lf0_153:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_155
+.Lf0_154:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf0_155:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_151:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_149:
+    movl %eax, -12(%rbp)
+    .loc 1 69 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 70 17
+    jmp .Lf0_159
+    .p2align 4,,10
+.Lf0_158:
+    .loc 1 71 21
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_161
+    jmp .Lf0_160
+.Lf0_161:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_163
+    jmp .Lf0_162
+.Lf0_163:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_162:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_160:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 72 21
+    movq $67, %rax
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_165
+.Lf0_164:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_166
+.Lf0_165:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_166:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_167
+.Lf0_168:
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_167:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $43, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_170
+    jmp .Lf0_169
+.Lf0_170:
+    movq $63, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_169:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 73 21
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_174
+.Lf0_173:
+    movq $31, %rax
+    jmp .Lf0_175
+.Lf0_174:
+    movq $19, %rax
+.Lf0_175:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 74 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_157:
+.Lf0_159:
+    .loc 1 70 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_158
+.Lf0_156:
+    addq $0, %rsp
+    .loc 1 77 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_135:
+.Lf0_137:
+    .loc 1 64 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_136
+.Lf0_134:
+    addq $8, %rsp
+    .loc 1 80 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_181
+    .p2align 4,,10
+.Lf0_180:
+    .loc 1 82 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 83 13
+    jmp .Lf0_185
+    .p2align 4,,10
+.Lf0_184:
+    .loc 1 84 17
+    movq $27, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $50, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_186
+    jmp .Lf0_182
+.Lf0_186:
+    .loc 1 85 17
+    movq $6, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 86 17
+    movq $7, %rax
+    push %rax
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_188
+    jmp .Lf0_187
+.Lf0_188:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_187:
+    push %rax
+    movq $81, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 87 17
+    movq $50, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_189
+    jmp .Lf0_190
+.Lf0_189:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $93, %rax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_191
+.Lf0_190:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_191:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_193
+    jmp .Lf0_192
+.Lf0_193:
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_195
+    jmp .Lf0_194
+.Lf0_195:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_194:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_192:
+    movl %eax, -4(%rbp)
+    .loc 1 88 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_183:
+.Lf0_185:
+    .loc 1 83 20
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_184
+.Lf0_182:
+    addq $0, %rsp
+    .loc 1 91 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_197
+    jmp .Lf0_196
+.Lf0_197:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_196:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_198
+    jmp .Lf0_199
+.Lf0_198:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_200
+.Lf0_199:
+    movslq -12(%rbp), %rax
+.Lf0_200:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_201
+.Lf0_202:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_201:
+    push %rax
+    movq $21, %rax
+    cmpq $0, %rax
+    jne .Lf0_203
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_205
+.Lf0_204:
+    movslq -8(%rbp), %rax
+.Lf0_205:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 92 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_207
+    jmp .Lf0_206
+.Lf0_207:
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_206:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_208
+.Lf0_209:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_208:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_211
+    jmp .Lf0_210
+.Lf0_211:
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_210:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_179:
+    .loc 1 80 32
+    incl -340(%rbp)
+.Lf0_181:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_180
+.Lf0_178:
+    addq $8, %rsp
+    .loc 1 94 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_217
+    .p2align 4,,10
+.Lf0_216:
+    .loc 1 95 9
+    movq $3, %rax
+    push %rax
+    cmpl $19, -64(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movq $98, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 97 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 98 13
+    jmp .Lf0_223
+    .p2align 4,,10
+.Lf0_222:
+    .loc 1 99 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_226
+.Lf0_225:
+    movq $80, %rax
+    jmp .Lf0_227
+.Lf0_226:
+    movslq -8(%rbp), %rax
+.Lf0_227:
+    cmpq $92, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_224
+    jmp .Lf0_220
+.Lf0_224:
+    .loc 1 100 17
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_229
+    jmp .Lf0_228
+.Lf0_229:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_228:
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 101 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_231
+    jmp .Lf0_230
+.Lf0_231:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_230:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_233
+.Lf0_232:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_234
+.Lf0_233:
+    movslq -16(%rbp), %rax
+.Lf0_234:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 102 17
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_236
+    jmp .Lf0_235
+.Lf0_236:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_238
+    jmp .Lf0_237
+.Lf0_238:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_237:
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_235:
+    movl %eax, -68(%rbp)
+    .loc 1 103 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_221:
+.Lf0_223:
+    .loc 1 98 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_222
+.Lf0_220:
+    addq $0, %rsp
+    .loc 1 106 9
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_240
+    jmp .Lf0_239
+.Lf0_240:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_239:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_241
+    jmp .Lf0_242
+.Lf0_241:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_243
+.Lf0_242:
+    movslq -4(%rbp), %rax
+.Lf0_243:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    subq $19, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_244
+    jmp .Lf0_245
+.Lf0_244:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_246
+.Lf0_245:
+    movslq -16(%rbp), %rax
+.Lf0_246:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_215:
+    .loc 1 94 32
+    incl -340(%rbp)
+.Lf0_217:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_216
+.Lf0_214:
+    addq $8, %rsp
+    .loc 1 108 5
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 109 5
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_247
+    jmp .Lf0_248
+.Lf0_247:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_251
+.Lf0_250:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf0_252
+.Lf0_251:
+    movslq -12(%rbp), %rax
+.Lf0_252:
+    jmp .Lf0_249
+.Lf0_248:
+    cmpl $22, -16(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_249:
+    push %rax
+    movslq -76(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_254
+    jmp .Lf0_253
+.Lf0_254:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_253:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 110 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_260
+    .p2align 4,,10
+.Lf0_259:
+    .loc 1 111 9
+    movq $30, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_262
+    jmp .Lf0_261
+.Lf0_262:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_261:
+    push %rax
+    movq $26, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 112 9
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_264
+    jmp .Lf0_263
+.Lf0_264:
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_265
+    jmp .Lf0_266
+.Lf0_265:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_267
+.Lf0_266:
+    movslq -4(%rbp), %rax
+.Lf0_267:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_263:
+    movl %eax, -12(%rbp)
+    .loc 1 114 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 115 13
+    .p2align 4,,10
+.Lf0_270:
+    .loc 1 116 17
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $52, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_271
+    jmp .Lf0_268
+.Lf0_271:
+    .loc 1 117 17
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_272
+    jmp .Lf0_273
+.Lf0_272:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_274
+.Lf0_273:
+    movslq -12(%rbp), %rax
+.Lf0_274:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -40(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_276
+    jmp .Lf0_275
+.Lf0_276:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_275:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 118 17
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -24(%rbp)
+    .loc 1 119 17
+    movslq -8(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_278
+    jmp .Lf0_277
+.Lf0_278:
+    movq $72, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_277:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_280
+    jmp .Lf0_279
+.Lf0_280:
+    movq $56, %rax
+    subq $45, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_282
+    jmp .Lf0_281
+.Lf0_282:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_284
+    jmp .Lf0_283
+.Lf0_284:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_283:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_281:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_279:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 120 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_269:
+    .loc 1 121 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_270
+.Lf0_268:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_258:
+    .loc 1 110 32
+    incl -340(%rbp)
+.Lf0_260:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_259
+.Lf0_257:
+    addq $8, %rsp
+    .loc 1 124 5
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_285
+    jmp .Lf0_286
+.Lf0_285:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_287
+.Lf0_286:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf0_287:
+    push %rax
+    movq $27, %rax
+    subq $50, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $73, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_288
+    jmp .Lf0_289
+.Lf0_288:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_291
+    jmp .Lf0_292
+.Lf0_291:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_293
+.Lf0_292:
+    movslq -8(%rbp), %rax
+.Lf0_293:
+    jmp .Lf0_290
+.Lf0_289:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_290:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 126 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 127 5
+    subq $8, %rsp
+    movq $5, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 128 5
+    movq $59, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 129 5
+    subq $8, %rsp
+    movq $49, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 130 5
+    movq $33, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 131 5
+    subq $64, %rsp
+    .loc 1 132 5
+    subq $256, %rsp
+    .loc 1 133 5
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 134 5
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_2
+    jmp .Lf1_3
+.Lf1_2:
+    movq $96, %rax
+    jmp .Lf1_4
+.Lf1_3:
+    movq $35, %rax
+.Lf1_4:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf1_5
+    .loc 1 135 9
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 136 9
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_6
+    jmp .Lf1_7
+.Lf1_6:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -24(%rbp), %rax
+.Lf1_8:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 137 9
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $50, %rax
+    subl -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $19, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_1
+.Lf1_5:
+    .loc 1 139 9
+    movq $9, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_10
+    jmp .Lf1_9
+.Lf1_10:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_9:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $13, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 140 9
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_14
+    jmp .Lf1_15
+.Lf1_14:
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_16
+.Lf1_15:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_16:
+    cmpq $0, %rax
+    jne .Lf1_11
+    jmp .Lf1_12
+.Lf1_11:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_13
+.Lf1_12:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_18
+    jmp .Lf1_17
+.Lf1_18:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_17:
+.Lf1_13:
+    movl %eax, -16(%rbp)
+    .loc 1 141 9
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_23
+.Lf1_22:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf1_24
+.Lf1_23:
+    movslq -16(%rbp), %rax
+.Lf1_24:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_19
+    jmp .Lf1_20
+.Lf1_19:
+    movq $36, %rax
+    imulq $78, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_25
+    jmp .Lf1_26
+.Lf1_25:
+    movq $18, %rax
+    cmpq $0, %rax
+    jne .Lf1_28
+    jmp .Lf1_29
+.Lf1_28:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf1_30
+.Lf1_29:
+    movq $62, %rax
+.Lf1_30:
+    jmp .Lf1_27
+.Lf1_26:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf1_27:
+    jmp .Lf1_21
+.Lf1_20:
+    movq $8, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_32
+    jmp .Lf1_31
+.Lf1_32:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_31:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_21:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_1:
+    .loc 1 143 5
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    subq $72, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $65, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    imulq $60, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_34
+    .loc 1 144 9
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $46, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_36
+    jmp .Lf1_35
+.Lf1_36:
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_41
+    jmp .Lf1_40
+.Lf1_41:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_40:
+    cmpq $0, %rax
+    jne .Lf1_37
+    jmp .Lf1_38
+.Lf1_37:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_39
+.Lf1_38:
+    movslq -48(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_39:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_35:
+    movl %eax, -16(%rbp)
+    .loc 1 145 9
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_43
+    jmp .Lf1_42
+.Lf1_43:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_44
+    jmp .Lf1_45
+.Lf1_44:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_47
+    jmp .Lf1_48
+.Lf1_47:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_49
+.Lf1_48:
+    movslq -44(%rbp), %rax
+.Lf1_49:
+    jmp .Lf1_46
+.Lf1_45:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+.Lf1_46:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_42:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 146 9
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $41, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_53
+.Lf1_52:
+    movq $8, %rax
+    push %rax
+    movq $21, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_54
+.Lf1_53:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_54:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_33
+.Lf1_34:
+    .loc 1 148 9
+    movq $6, %rax
+    cmpq $0, %rax
+    jne .Lf1_55
+    jmp .Lf1_56
+.Lf1_55:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_57
+.Lf1_56:
+    movslq -8(%rbp), %rax
+.Lf1_57:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_59
+    jmp .Lf1_58
+.Lf1_59:
+    movq $5, %rax
+    push %rax
+    movq $98, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $28, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_58:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 149 9
+    movq $15, %rax
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_67
+.Lf1_66:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -4(%rbp), %rax
+.Lf1_68:
+    cmpq $0, %rax
+    jne .Lf1_63
+    jmp .Lf1_64
+.Lf1_63:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_70
+    jmp .Lf1_69
+.Lf1_70:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_69:
+    jmp .Lf1_65
+.Lf1_64:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_71
+    jmp .Lf1_72
+.Lf1_71:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_73
+.Lf1_72:
+    movslq -12(%rbp), %rax
+.Lf1_73:
+.Lf1_65:
+    cmpq $0, %rax
+    jne .Lf1_60
+    jmp .Lf1_61
+.Lf1_60:
+    movslq -52(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $16, %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_62
+.Lf1_61:
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_74
+    jmp .Lf1_75
+.Lf1_74:
+    movq $7, %rax
+    jmp .Lf1_76
+.Lf1_75:
+    movslq -16(%rbp), %rax
+.Lf1_76:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf1_62:
+    movl %eax, -4(%rbp)
+    .loc 1 150 9
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_77
+    jmp .Lf1_78
+.Lf1_77:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_79
+.Lf1_78:
+    movq $74, %rax
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_81
+.Lf1_80:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_82
+.Lf1_81:
+    movslq -8(%rbp), %rax
+.Lf1_82:
+.Lf1_79:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+.Lf1_33:
+    .loc 1 152 5
+    movslq -80(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_87
+    jmp .Lf1_88
+.Lf1_87:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    subq $11, %rax
+    movslq %eax, %rax
+    jmp .Lf1_89
+.Lf1_88:
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_89:
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_85
+.Lf1_84:
+    movslq -4(%rbp), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_90
+    jmp .Lf1_91
+.Lf1_90:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_92
+.Lf1_91:
+    movslq -8(%rbp), %rax
+.Lf1_92:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_86
+.Lf1_85:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_94
+    jmp .Lf1_93
+.Lf1_94:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_86:
+    cmpq $0, %rax
+    je .Lf1_95
+    .loc 1 153 9
+    movq $8, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_96
+    jmp .Lf1_97
+.Lf1_96:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_98
+.Lf1_97:
+    movslq -4(%rbp), %rax
+.Lf1_98:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $55, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -76(%rbp)
+    .loc 1 154 9
+    cmpl $96, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_99
+    jmp .Lf1_100
+.Lf1_99:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_101
+.Lf1_100:
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_101:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_103
+    jmp .Lf1_102
+.Lf1_103:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_102:
+    push %rax
+    movslq -48(%rbp), %rax
+    imulq $87, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 155 9
+    movq $37, %rax
+    cmpq $5, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_107
+    jmp .Lf1_108
+.Lf1_107:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_109
+.Lf1_108:
+    movslq -48(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_109:
+    cmpq $0, %rax
+    jne .Lf1_104
+    jmp .Lf1_105
+.Lf1_104:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_111
+.Lf1_110:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_112
+.Lf1_111:
+    movslq -16(%rbp), %rax
+.Lf1_112:
+    push %rax
+    movq $37, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_106
+.Lf1_105:
+    movslq -56(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movslq -16(%rbp), %rax
+    subq $51, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+.Lf1_106:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_83
+.Lf1_95:
+    .loc 1 157 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_115
+    jmp .Lf1_116
+.Lf1_115:
+    movq $66, %rax
+    jmp .Lf1_117
+.Lf1_116:
+    movslq -52(%rbp), %rax
+.Lf1_117:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_119
+    jmp .Lf1_118
+.Lf1_119:
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_118:
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -40(%rbp)
+    .loc 1 158 9
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $40, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 159 9
+    movslq -12(%rbp), %rax
+    subq $59, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_120
+    jmp .Lf1_121
+.Lf1_120:
+    movslq -52(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_122
+.Lf1_121:
+    movq $22, %rax
+    cmpq $8, %rax
+    movq $0, %rax
+    sete %al
+.Lf1_122:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_83:
+    .loc 1 161 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_128
+    .p2align 4,,10
+.Lf1_127:
+    .loc 1 162 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 163 13
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 164 13
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_134
+.Lf1_135:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_134:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 165 13
+    movslq -344(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_137
+    jmp .Lf1_136
+.Lf1_137:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_136:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_139
+    jmp .Lf1_138
+.Lf1_139:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_141
+.Lf1_140:
+    movq $62, %rax
+    jmp .Lf1_142
+.Lf1_141:
+    movslq -12(%rbp), %rax
+.Lf1_142:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_138:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+.Lf1_133:
+    .loc 1 162 34
+    incl -344(%rbp)
+    .loc 1 163 13
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 164 13
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_144
+    jmp .Lf1_143
+.Lf1_144:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_143:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 165 13
+    movslq -344(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_146
+    jmp .Lf1_145
+.Lf1_146:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_145:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_148
+    jmp .Lf1_147
+.Lf1_148:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_149
+    jmp .Lf1_150
+.Lf1_149:
+    movq $62, %rax
+    jmp .Lf1_151
+.Lf1_150:
+    movslq -12(%rbp), %rax
+.Lf1_151:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_147:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+.Lf1_132:
+    .loc 1 162 34
+    incl -344(%rbp)
+.Lf1_131:
+    addq $0, %rsp
+    .loc 1 167 9
+    movq $96, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_153
+    jmp .Lf1_152
+.Lf1_153:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_152:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 168 9
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_157
+    jmp .Lf1_156
+.Lf1_157:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_156:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_126:
+    .loc 1 161 30
+    incl -340(%rbp)
+.Lf1_128:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_127
+.Lf1_125:
+    addq $8, %rsp
+    .loc 1 170 5
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_159
+.Lf1_160:
+    movslq -8(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_162
+    jmp .Lf1_161
+.Lf1_162:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_161:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_159:
+    cmpq $0, %rax
+    je .Lf1_163
+    .loc 1 171 9
+    movslq -24(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $90, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_164
+    jmp .Lf1_165
+.Lf1_164:
+    movq $3, %rax
+    cmpq $0, %rax
+    jne .Lf1_167
+    jmp .Lf1_168
+.Lf1_167:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_169
+.Lf1_168:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf1_169:
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_166
+.Lf1_165:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    imulq $15, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_170
+    jmp .Lf1_171
+.Lf1_170:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_172
+.Lf1_171:
+    movq $4, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_172:
+.Lf1_166:
+    movl %eax, -48(%rbp)
+    .loc 1 172 9
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 173 9
+    movslq -4(%rbp), %rax
+    imulq $5, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_173
+    jmp .Lf1_174
+.Lf1_173:
+    movq $26, %rax
+    cmpq $0, %rax
+    jne .Lf1_176
+    jmp .Lf1_177
+.Lf1_176:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_178
+.Lf1_177:
+    movslq -8(%rbp), %rax
+.Lf1_178:
+    jmp .Lf1_175
+.Lf1_174:
+    movq $2, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_175:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $5, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_158
+.Lf1_163:
+    .loc 1 175 9
+    movq $1, %rax
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf1_179
+    jmp .Lf1_180
+.Lf1_179:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_181
+.Lf1_180:
+    movslq -4(%rbp), %rax
+.Lf1_181:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $50, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 176 9
+    movslq -28(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $13, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $88, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 177 9
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_182
+    jmp .Lf1_183
+.Lf1_182:
+    cmpl $8, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_184
+.Lf1_183:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_184:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_185
+.Lf1_186:
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $66, %rax
+    imulq $94, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_185:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_158:
+    .loc 1 179 5
+    movq $58, %rax
+    cmpq $0, %rax
+    jne .Lf1_188
+    jmp .Lf1_189
+.Lf1_188:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_190
+.Lf1_189:
+    movslq -4(%rbp), %rax
+.Lf1_190:
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $16, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $37, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_191
+    .loc 1 180 9
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_193
+    jmp .Lf1_192
+.Lf1_193:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_192:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 181 9
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -48(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_194
+    jmp .Lf1_195
+.Lf1_194:
+    movq $2, %rax
+    push %rax
+    cmpl $67, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_196
+.Lf1_195:
+    movq $9, %rax
+    push %rax
+    movq $66, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_196:
+    movl %eax, -12(%rbp)
+    .loc 1 182 9
+    movq $9, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_197
+.Lf1_198:
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_197:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_199
+    jmp .Lf1_200
+.Lf1_199:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_203
+    jmp .Lf1_202
+.Lf1_203:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_202:
+    jmp .Lf1_201
+.Lf1_200:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_201:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_187
+.Lf1_191:
+    .loc 1 184 9
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $57, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $20, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $31, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 185 9
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_208
+    jmp .Lf1_207
+.Lf1_208:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_207:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_210
+    jmp .Lf1_209
+.Lf1_210:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_209:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_204
+    jmp .Lf1_205
+.Lf1_204:
+    movq $26, %rax
+    cmpq $0, %rax
+    jne .Lf1_211
+    jmp .Lf1_212
+.Lf1_211:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_213
+.Lf1_212:
+    movslq -8(%rbp), %rax
+.Lf1_213:
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_206
+.Lf1_205:
+    movq $4, %rax
+    push %rax
+    movq $13, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_206:
+    movl %eax, -12(%rbp)
+    .loc 1 186 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_214
+    jmp .Lf1_215
+.Lf1_214:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_216
+.Lf1_215:
+    movslq -8(%rbp), %rax
+.Lf1_216:
+    push %rax
+    cmpl $78, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -60(%rbp)
+    addq $0, %rsp
+.Lf1_187:
+    .loc 1 189 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 190 9
+    .p2align 4,,10
+.Lf1_219:
+    .loc 1 191 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_225
+    .p2align 4,,10
+.Lf1_224:
+    .loc 1 192 17
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_226
+    jmp .Lf1_227
+.Lf1_226:
+    movslq -52(%rbp), %rax
+    jmp .Lf1_228
+.Lf1_227:
+    movq $88, %rax
+.Lf1_228:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_230
+    jmp .Lf1_229
+.Lf1_230:
+    movq $63, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_229:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $30, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_231
+    jmp .Lf1_232
+.Lf1_231:
+    movq $19, %rax
+    jmp .Lf1_233
+.Lf1_232:
+    movslq -44(%rbp), %rax
+.Lf1_233:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 193 17
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_235
+    jmp .Lf1_234
+.Lf1_235:
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_236
+    jmp .Lf1_237
+.Lf1_236:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_238
+.Lf1_237:
+    movslq -340(%rbp), %rax
+.Lf1_238:
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_240
+    jmp .Lf1_239
+.Lf1_240:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_239:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -28(%rbp)
+    .loc 1 194 17
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_244
+    jmp .Lf1_245
+.Lf1_244:
+    movslq -64(%rbp), %rax
+    jmp .Lf1_246
+.Lf1_245:
+    movslq -4(%rbp), %rax
+.Lf1_246:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_241
+    jmp .Lf1_242
+.Lf1_241:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_247
+    jmp .Lf1_248
+.Lf1_247:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_249
+.Lf1_248:
+    movq $30, %rax
+.Lf1_249:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_251
+    jmp .Lf1_250
+.Lf1_251:
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_250:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_243
+.Lf1_242:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_243:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_223:
+    .loc 1 191 38
+    incl -344(%rbp)
+.Lf1_225:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_224
+.Lf1_222:
+    addq $0, %rsp
+    .loc 1 196 13
+    cmpl $62, -24(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_253
+    jmp .Lf1_252
+.Lf1_253:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_252:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $37, %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_254
+.Lf1_255:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_256
+    jmp .Lf1_257
+.Lf1_256:
+    movslq -32(%rbp), %rax
+    jmp .Lf1_258
+.Lf1_257:
+    movslq -12(%rbp), %rax
+.Lf1_258:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_254:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 197 13
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    subl -60(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $66, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_259
+    jmp .Lf1_260
+.Lf1_259:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_261
+.Lf1_260:
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_261:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 198 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_218:
+    .loc 1 199 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_219
+.Lf1_217:
+    addq $8, %rsp
+    .loc 1 201 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_267
+    .p2align 4,,10
+.Lf1_266:
+    .loc 1 202 9
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $66, %rax
+    cmpq $0, %rax
+    jne .Lf1_268
+    jmp .Lf1_269
+.Lf1_268:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_270
+.Lf1_269:
+    movslq -8(%rbp), %rax
+.Lf1_270:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 204 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 205 13
+    .p2align 4,,10
+.Lf1_273:
+    .loc 1 206 17
+    movq $2, %rax
+    push %rax
+    movq $96, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $84, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 207 17
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf1_274
+    jmp .Lf1_275
+.Lf1_274:
+    movq $6, %rax
+    jmp .Lf1_276
+.Lf1_275:
+    movslq -68(%rbp), %rax
+.Lf1_276:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_278
+    jmp .Lf1_277
+.Lf1_278:
+    cmpl $50, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_277:
+    movl %eax, -8(%rbp)
+    .loc 1 208 17
+    movq $3, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_280
+    jmp .Lf1_279
+.Lf1_280:
+    movq $49, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_279:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 209 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_272:
+    .loc 1 210 22
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_273
+.Lf1_271:
+    addq $0, %rsp
+    .loc 1 212 9
+    movslq -12(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_281
+    jmp .Lf1_282
+.Lf1_281:
+    movslq -4(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_283
+.Lf1_282:
+    movq $28, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_283:
+    push %rax
+    movq $76, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_284
+    jmp .Lf1_285
+.Lf1_284:
+    movq $98, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_286
+.Lf1_285:
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_286:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -64(%rbp)
+    addq $0, %rsp
+.Lf1_265:
+    .loc 1 201 30
+    incl -340(%rbp)
+.Lf1_267:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_266
+.Lf1_264:
+    addq $8, %rsp
+    .loc 1 214 5
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    subq $9, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf1_288
+    .loc 1 215 9
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $88, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $45, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_290
+    jmp .Lf1_289
+.Lf1_290:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $61, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_289:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 216 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_292
+    jmp .Lf1_291
+.Lf1_292:
+    movq $3, %rax
+    push %rax
+    movq $84, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_291:
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 217 9
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $45, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_294
+    jmp .Lf1_293
+.Lf1_294:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_293:
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_287
+.Lf1_288:
+    .loc 1 219 9
+    movq $1, %rax
+    push %rax
+    movq $56, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_296
+    jmp .Lf1_295
+.Lf1_296:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_295:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 220 9
+    movq $6, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 221 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_298
+    jmp .Lf1_297
+.Lf1_298:
+    movslq -16(%rbp), %rax
+    subq $60, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_297:
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf1_299
+    jmp .Lf1_300
+.Lf1_299:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf1_301
+.Lf1_300:
+    movslq -8(%rbp), %rax
+.Lf1_301:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_287:
+    .loc 1 223 5
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_303
+    jmp .Lf1_302
+.Lf1_303:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_302:
+    push %rax
+    movq $38, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_305
+    jmp .Lf1_304
+.Lf1_305:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_304:
+    push %rax
+    movq $25, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 225 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 226 5
+    subq $8, %rsp
+    movq $24, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 227 5
+    movq $12, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 228 5
+    subq $8, %rsp
+    movq $3, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 229 5
+    movq $97, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 230 5
+    subq $64, %rsp
+    .loc 1 231 5
+    subq $256, %rsp
+    .loc 1 232 5
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_2
+    jmp .Lf2_1
+.Lf2_2:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_1:
+    push %rax
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_4
+    jmp .Lf2_3
+.Lf2_4:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_3:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    addq $12, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_5
+    jmp .Lf2_6
+.Lf2_5:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_7
+.Lf2_6:
+    movq $5, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 233 5
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_9
+    jmp .Lf2_8
+.Lf2_9:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_8:
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_10
+    jmp .Lf2_11
+.Lf2_10:
+    movslq -60(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_12
+.Lf2_11:
+    movq $1, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_12:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 234 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_18
+    .p2align 4,,10
+.Lf2_17:
+    .loc 1 235 9
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_23
+    jmp .Lf2_22
+.Lf2_23:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_22:
+    cmpq $0, %rax
+    jne .Lf2_19
+    jmp .Lf2_20
+.Lf2_19:
+    movslq -40(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_24
+    jmp .Lf2_25
+.Lf2_24:
+    movq $74, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_26
+.Lf2_25:
+    cmpl $33, -4(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf2_26:
+    jmp .Lf2_21
+.Lf2_20:
+    movslq -340(%rbp), %rax
+    imulq $96, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_27
+    jmp .Lf2_28
+.Lf2_27:
+    movq $0, %rax
+    jmp .Lf2_29
+.Lf2_28:
+    movslq -24(%rbp), %rax
+.Lf2_29:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf2_21:
+    movl %eax, -12(%rbp)
+    .loc 1 236 9
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $91, %rax
+    cmpq $59, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -68(%rbp)
+    .loc 1 238 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 239 13
+    .p2align 4,,10
+.Lf2_32:
+    .loc 1 240 17
+    movq $21, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 241 17
+    movq $8, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_33
+    jmp .Lf2_34
+.Lf2_33:
+    movslq -44(%rbp), %rax
+    jmp .Lf2_35
+.Lf2_34:
+    movslq -16(%rbp), %rax
+.Lf2_35:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_37
+    jmp .Lf2_36
+.Lf2_37:
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_36:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    .loc 1 242 17
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_38
+    jmp .Lf2_39
+.Lf2_38:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf2_40
+.Lf2_39:
+    movslq -28(%rbp), %rax
+.Lf2_40:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 243 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_31:
+    .loc 1 244 22
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_32
+.Lf2_30:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_16:
+    .loc 1 234 30
+    incl -340(%rbp)
+.Lf2_18:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_17
+.Lf2_15:
+    addq $8, %rsp
+    .loc 1 248 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 249 9
+    .p2align 4,,10
+.Lf2_43:
+    .loc 1 251 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 252 17
+    .p2align 4,,10
+.Lf2_46:
+    .loc 1 253 21
+    movslq -76(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_47
+    jmp .Lf2_48
+.Lf2_47:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_49
+.Lf2_48:
+    movq $3, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_49:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 254 21
+    movslq -16(%rbp), %rax
+    imull -32(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_50
+    jmp .Lf2_51
+.Lf2_50:
+    cmpl $77, -344(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_52
+.Lf2_51:
+    movslq -44(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_52:
+    push %rax
+    movq $16, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $31, %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 255 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_54
+    jmp .Lf2_53
+.Lf2_54:
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_53:
+    push %rax
+    cmpl $12, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_56
+    jmp .Lf2_55
+.Lf2_56:
+    movslq -8(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 256 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_45:
+    .loc 1 257 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_46
+.Lf2_44:
+    addq $0, %rsp
+    .loc 1 259 13
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -44(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_57
+    jmp .Lf2_58
+.Lf2_57:
+    movq $65, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_59
+.Lf2_58:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_59:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 260 13
+    movslq -60(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    cmpl $68, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 261 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_42:
+    .loc 1 262 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_43
+.Lf2_41:
+    addq $8, %rsp
+    .loc 1 264 5
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_60
+    jmp .Lf2_61
+.Lf2_60:
+    movslq -40(%rbp), %rax
+    jmp .Lf2_62
+.Lf2_61:
+    movslq -4(%rbp), %rax
+.Lf2_62:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_64
+    jmp .Lf2_63
+.Lf2_64:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_63:
+    movl %eax, -4(%rbp)
+    .loc 1 266 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 267 9
+    jmp .Lf2_68
+    .p2align 4,,10
+.Lf2_67:
+    .loc 1 268 13
+    movq $0, %rax
+    cmpq $57, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_70
+    jmp .Lf2_69
+.Lf2_70:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_69:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -20(%rbp)
+    .loc 1 270 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 271 17
+    .p2align 4,,10
+.Lf2_73:
+    .loc 1 272 21
+    movslq -40(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_75
+    jmp .Lf2_74
+.Lf2_75:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_74:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_76
+    jmp .Lf2_77
+.Lf2_76:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_78
+.Lf2_77:
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_78:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 273 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_80
+    jmp .Lf2_79
+.Lf2_80:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_79:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 274 21
+    movq $54, %rax
+    addq $42, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $37, -344(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 275 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_72:
+    .loc 1 276 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_73
+.Lf2_71:
+    addq $0, %rsp
+    .loc 1 278 13
+    movq $4, %rax
+    push %rax
+    movq $75, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_82
+.Lf2_81:
+    movq $8, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_83
+.Lf2_82:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_83:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    .loc 1 279 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_66:
+.Lf2_68:
+    .loc 1 267 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_67
+.Lf2_65:
+    addq $8, %rsp
+    .loc 1 283 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 284 9
+    jmp .Lf2_87
+    .p2align 4,,10
+.Lf2_86:
+    .loc 1 286 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 287 17
+    .p2align 4,,10
+.Lf2_90:
+    .loc 1 288 21
+    movq $95, %rax
+    cmpq $0, %rax
+    jne .Lf2_92
+    jmp .Lf2_93
+.Lf2_92:
+    movslq -76(%rbp), %rax
+    jmp .Lf2_94
+.Lf2_93:
+    movslq -68(%rbp), %rax
+.Lf2_94:
+    cmpq $72, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_91
+    jmp .Lf2_88
+.Lf2_91:
+    .loc 1 289 21
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_96
+    jmp .Lf2_95
+.Lf2_96:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_95:
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_98
+    jmp .Lf2_97
+.Lf2_98:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_97:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 290 21
+    movq $6, %rax
+    push %rax
+    movq $13, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_100
+    jmp .Lf2_99
+.Lf2_100:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_99:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 291 21
+    cmpl $11, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_101
+    jmp .Lf2_102
+.Lf2_101:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_103
+.Lf2_102:
+    movslq -24(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf2_103:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_105
+    jmp .Lf2_104
+.Lf2_105:
+    movq $2, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_104:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 292 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_89:
+    .loc 1 293 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_90
+.Lf2_88:
+    addq $0, %rsp
+    .loc 1 295 13
+    movslq -68(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_110
+    jmp .Lf2_109
+.Lf2_110:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_111
+    jmp .Lf2_112
+.Lf2_111:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_113
+.Lf2_112:
+    movslq -8(%rbp), %rax
+.Lf2_113:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_109:
+    cmpq $0, %rax
+    jne .Lf2_106
+    jmp .Lf2_107
+.Lf2_106:
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_108
+.Lf2_107:
+    movslq -4(%rbp), %rax
+    addl -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_114
+    jmp .Lf2_115
+.Lf2_114:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_116
+.Lf2_115:
+    movslq -340(%rbp), %rax
+.Lf2_116:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_108:
+    movl %eax, -4(%rbp)
+    .loc 1 296 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_120
+    jmp .Lf2_121
+.Lf2_120:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_122
+.Lf2_121:
+    movslq -16(%rbp), %rax
+.Lf2_122:
+    push %rax
+    movq $29, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_117
+    jmp .Lf2_118
+.Lf2_117:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_123
+    jmp .Lf2_124
+.Lf2_123:
+    movslq -80(%rbp), %rax
+    jmp .Lf2_125
+.Lf2_124:
+    movslq -8(%rbp), %rax
+.Lf2_125:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_119
+.Lf2_118:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_127
+    jmp .Lf2_126
+.Lf2_127:
+    movslq -4(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_126:
+.Lf2_119:
+    movl %eax, -68(%rbp)
+    .loc 1 297 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_85:
+.Lf2_87:
+    .loc 1 284 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_86
+.Lf2_84:
+    addq $8, %rsp
+    .loc 1 300 5
+    movslq -80(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $49, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 301 5
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $74, %rax
+    cmpq $92, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_129
+.Lf2_128:
+    movq $74, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_130
+.Lf2_129:
+    cmpl $68, -40(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf2_130:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 302 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_136
+    .p2align 4,,10
+.Lf2_135:
+    .loc 1 303 9
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $90, %rax
+    cmpq $24, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $30, %rax
+    cmpq $0, %rax
+    jne .Lf2_137
+    jmp .Lf2_138
+.Lf2_137:
+    movq $3, %rax
+    jmp .Lf2_139
+.Lf2_138:
+    movq $1, %rax
+.Lf2_139:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -40(%rbp)
+    .loc 1 305 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 306 13
+    .p2align 4,,10
+.Lf2_142:
+    .loc 1 307 17
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_143
+    jmp .Lf2_140
+.Lf2_143:
+    .loc 1 308 17
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_148
+    jmp .Lf2_147
+.Lf2_148:
+    cmpl $39, -36(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_147:
+    cmpq $0, %rax
+    jne .Lf2_144
+    jmp .Lf2_145
+.Lf2_144:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_150
+    jmp .Lf2_149
+.Lf2_150:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_149:
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_146
+.Lf2_145:
+    movq $9, %rax
+    push %rax
+    movq $87, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_146:
+    movl %eax, -8(%rbp)
+    .loc 1 309 17
+    movslq -12(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_152
+    jmp .Lf2_151
+.Lf2_152:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_153
+    jmp .Lf2_154
+.Lf2_153:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf2_155
+.Lf2_154:
+    movslq -4(%rbp), %rax
+.Lf2_155:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_151:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_157
+    jmp .Lf2_156
+.Lf2_157:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_156:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_159
+    jmp .Lf2_158
+.Lf2_159:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_158:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 310 17
+    movslq -8(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_161
+    jmp .Lf2_160
+.Lf2_161:
+    movq $4, %rax
+    push %rax
+    movq $45, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_162
+    jmp .Lf2_163
+.Lf2_162:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_165
+    jmp .Lf2_166
+.Lf2_165:
+    movslq -60(%rbp), %rax
+    jmp .Lf2_167
+.Lf2_166:
+    movq $82, %rax
+.Lf2_167:
+    jmp .Lf2_164
+.Lf2_163:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_168
+    jmp .Lf2_169
+.Lf2_168:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_170
+.Lf2_169:
+    movslq -4(%rbp), %rax
+.Lf2_170:
+.Lf2_164:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_160:
+    movl %eax, -16(%rbp)
+    .loc 1 311 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_141:
+    .loc 1 312 22
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_142
+.Lf2_140:
+    addq $0, %rsp
+    .loc 1 314 9
+    movq $47, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $83, %rax
+    cmpq $0, %rax
+    jne .Lf2_171
+    jmp .Lf2_172
+.Lf2_171:
+    movq $18, %rax
+    jmp .Lf2_173
+.Lf2_172:
+    movq $40, %rax
+.Lf2_173:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_134:
+    .loc 1 302 30
+    incl -340(%rbp)
+.Lf2_136:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_135
+.Lf2_133:
+    addq $8, %rsp
+    .loc 1 316 5
+    movq $9, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_175
+    jmp .Lf2_174
+.Lf2_175:
+    movq $18, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_177
+    jmp .Lf2_176
+.Lf2_177:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_176:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_174:
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 318 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 319 5
+    subq $8, %rsp
+    movq $58, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 320 5
+    movq $8, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 321 5
+    subq $8, %rsp
+    movq $61, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 322 5
+    movq $57, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 323 5
+    subq $64, %rsp
+    .loc 1 324 5
+    subq $256, %rsp
+    .loc 1 325 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_6
+    .p2align 4,,10
+.Lf3_5:
+    .loc 1 326 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_7
+    jmp .Lf3_8
+.Lf3_7:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_9
+.Lf3_8:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf3_9:
+    push %rax
+    movq $36, %rax
+    cmpq $40, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 327 9
+    movq $28, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $53, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $55, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -56(%rbp)
+    .loc 1 329 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 330 13
+    .p2align 4,,10
+.Lf3_12:
+    .loc 1 331 17
+    movq $87, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_13
+    jmp .Lf3_10
+.Lf3_13:
+    .loc 1 332 17
+    movq $2, %rax
+    push %rax
+    movq $10, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 333 17
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $31, %rax
+    cmpq $3, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_14
+    jmp .Lf3_15
+.Lf3_14:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_16
+.Lf3_15:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf3_16:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 334 17
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_18
+    jmp .Lf3_17
+.Lf3_18:
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_20
+    jmp .Lf3_19
+.Lf3_20:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_19:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_17:
+    movl %eax, -16(%rbp)
+    .loc 1 335 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_11:
+    .loc 1 336 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_12
+.Lf3_10:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf3_4:
+    .loc 1 325 30
+    incl -340(%rbp)
+.Lf3_6:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_5
+.Lf3_3:
+    addq $8, %rsp
+    .loc 1 340 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 341 9
+    jmp .Lf3_24
+    .p2align 4,,10
+.Lf3_23:
+    .loc 1 342 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_27
+    jmp .Lf3_26
+.Lf3_27:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_26:
+    cmpq $84, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_25
+    jmp .Lf3_21
+.Lf3_25:
+    .loc 1 343 13
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_29
+    jmp .Lf3_28
+.Lf3_29:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_28:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_31
+    jmp .Lf3_30
+.Lf3_31:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $57, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_30:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 344 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_37
+    .p2align 4,,10
+.Lf3_36:
+    .loc 1 345 17
+    movq $56, %rax
+    cmpq $0, %rax
+    jne .Lf3_41
+    jmp .Lf3_42
+.Lf3_41:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_43
+.Lf3_42:
+    movslq -344(%rbp), %rax
+.Lf3_43:
+    cmpq $0, %rax
+    jne .Lf3_38
+    jmp .Lf3_39
+.Lf3_38:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_40
+.Lf3_39:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf3_40:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_44
+    jmp .Lf3_45
+.Lf3_44:
+    movq $94, %rax
+    jmp .Lf3_46
+.Lf3_45:
+    movslq -8(%rbp), %rax
+.Lf3_46:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_47
+    jmp .Lf3_48
+.Lf3_47:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_49
+.Lf3_48:
+    movq $20, %rax
+.Lf3_49:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 346 17
+    movq $4, %rax
+    push %rax
+    movq $97, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_50
+    jmp .Lf3_51
+.Lf3_50:
+    movq $30, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_52
+.Lf3_51:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf3_52:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_54
+    jmp .Lf3_53
+.Lf3_54:
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_53:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -32(%rbp)
+    .loc 1 347 17
+    movq $73, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $37, -344(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $0, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_55
+    jmp .Lf3_56
+.Lf3_55:
+    movq $96, %rax
+    jmp .Lf3_57
+.Lf3_56:
+    movslq -4(%rbp), %rax
+.Lf3_57:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_35:
+    .loc 1 344 38
+    incl -344(%rbp)
+.Lf3_37:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_36
+.Lf3_34:
+    addq $0, %rsp
+    .loc 1 349 13
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $85, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_58
+    jmp .Lf3_59
+.Lf3_58:
+    movq $9, %rax
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    jne .Lf3_61
+    jmp .Lf3_62
+.Lf3_61:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf3_63
+.Lf3_62:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf3_63:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_60
+.Lf3_59:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_65
+    jmp .Lf3_64
+.Lf3_65:
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_64:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $0, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf3_60:
+    movl %eax, -12(%rbp)
+    .loc 1 350 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_22:
+.Lf3_24:
+    .loc 1 341 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_23
+.Lf3_21:
+    addq $8, %rsp
+    .loc 1 354 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 355 9
+    jmp .Lf3_69
+    .p2align 4,,10
+.Lf3_68:
+    .loc 1 356 13
+    movslq -40(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_71
+    jmp .Lf3_70
+.Lf3_71:
+    movslq -72(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_72
+    jmp .Lf3_73
+.Lf3_72:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_74
+.Lf3_73:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf3_74:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_70:
+    movl %eax, -4(%rbp)
+    .loc 1 358 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 359 17
+    jmp .Lf3_78
+    .p2align 4,,10
+.Lf3_77:
+    .loc 1 360 21
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_80
+    jmp .Lf3_81
+.Lf3_80:
+    movslq -48(%rbp), %rax
+    jmp .Lf3_82
+.Lf3_81:
+    movq $58, %rax
+.Lf3_82:
+    cmpq $55, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_79
+    jmp .Lf3_75
+.Lf3_79:
+    .loc 1 361 21
+    movq $91, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_83
+    jmp .Lf3_84
+.Lf3_83:
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_85
+.Lf3_84:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_86
+    jmp .Lf3_87
+.Lf3_86:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_88
+.Lf3_87:
+    movslq -16(%rbp), %rax
+.Lf3_88:
+.Lf3_85:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 362 21
+    movq $8, %rax
+    push %rax
+    movq $76, %rax
+    cmpq $0, %rax
+    jne .Lf3_89
+    jmp .Lf3_90
+.Lf3_89:
+    movq $34, %rax
+    jmp .Lf3_91
+.Lf3_90:
+    movslq -8(%rbp), %rax
+.Lf3_91:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 363 21
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_93
+    jmp .Lf3_92
+.Lf3_93:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_92:
+    push %rax
+    movslq -32(%rbp), %rax
+    addq $42, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 364 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_76:
+.Lf3_78:
+    .loc 1 359 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_77
+.Lf3_75:
+    addq $0, %rsp
+    .loc 1 367 13
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_95
+    jmp .Lf3_94
+.Lf3_95:
+    cmpl $47, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_94:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $69, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 368 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_67:
+.Lf3_69:
+    .loc 1 355 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_68
+.Lf3_66:
+    addq $8, %rsp
+    .loc 1 371 5
+    movq $87, %rax
+    cmpq $93, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf3_96
+    jmp .Lf3_97
+.Lf3_96:
+    movslq -16(%rbp), %rax
+    subq $13, %rax
+    movslq %eax, %rax
+    jmp .Lf3_98
+.Lf3_97:
+    movslq -8(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf3_98:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_99
+    jmp .Lf3_100
+.Lf3_99:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_101
+.Lf3_100:
+    movslq -16(%rbp), %rax
+.Lf3_101:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 372 5
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $49, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_104
+    jmp .Lf3_103
+.Lf3_104:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_103:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_105
+    .loc 1 373 9
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_106
+    jmp .Lf3_107
+.Lf3_106:
+    movq $63, %rax
+    jmp .Lf3_108
+.Lf3_107:
+    movq $42, %rax
+.Lf3_108:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_109
+    jmp .Lf3_110
+.Lf3_109:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_111
+.Lf3_110:
+    movq $30, %rax
+.Lf3_111:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 374 9
+    movq $81, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_112
+    jmp .Lf3_113
+.Lf3_112:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_114
+.Lf3_113:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_115
+    jmp .Lf3_116
+.Lf3_115:
+    movq $12, %rax
+    jmp .Lf3_117
+.Lf3_116:
+    movq $69, %rax
+.Lf3_117:
+    push %rax
+    movslq -24(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf3_114:
+    movl %eax, -8(%rbp)
+    .loc 1 375 9
+    movq $3, %rax
+    push %rax
+    cmpl $57, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_119
+    jmp .Lf3_118
+.Lf3_119:
+    cmpl $94, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_118:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf3_102
+.Lf3_105:
+    .loc 1 377 9
+    movq $77, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_121
+    jmp .Lf3_120
+.Lf3_121:
+    movq $59, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_120:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_123
+    jmp .Lf3_122
+.Lf3_123:
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_125
+    jmp .Lf3_124
+.Lf3_125:
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_127
+    jmp .Lf3_126
+.Lf3_127:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_126:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_124:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_122:
+    movl %eax, -16(%rbp)
+    .loc 1 378 9
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_128
+    jmp .Lf3_129
+.Lf3_128:
+    movq $44, %rax
+    jmp .Lf3_130
+.Lf3_129:
+    movq $12, %rax
+.Lf3_130:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_132
+    jmp .Lf3_131
+.Lf3_132:
+    movslq -76(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_131:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 379 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_137
+    jmp .Lf3_136
+.Lf3_137:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_136:
+    cmpq $0, %rax
+    jne .Lf3_133
+    jmp .Lf3_134
+.Lf3_133:
+    movq $21, %rax
+    cmpq $93, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_135
+.Lf3_134:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf3_135:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_138
+    jmp .Lf3_139
+.Lf3_138:
+    movq $98, %rax
+    jmp .Lf3_140
+.Lf3_139:
+    movq $5, %rax
+.Lf3_140:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_102:
+    .loc 1 382 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 383 9
+    .p2align 4,,10
+.Lf3_143:
+    .loc 1 384 13
+    movq $99, %rax
+    cmpq $0, %rax
+    jne .Lf3_144
+    jmp .Lf3_145
+.Lf3_144:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_146
+.Lf3_145:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf3_146:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_148
+    jmp .Lf3_147
+.Lf3_148:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_147:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_150
+    jmp .Lf3_149
+.Lf3_150:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_152
+    jmp .Lf3_151
+.Lf3_152:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_151:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_153
+    jmp .Lf3_154
+.Lf3_153:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_155
+.Lf3_154:
+    movq $22, %rax
+.Lf3_155:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_149:
+    movl %eax, -16(%rbp)
+    .loc 1 386 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 387 17
+    .p2align 4,,10
+.Lf3_158:
+    .loc 1 388 21
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_160
+    jmp .Lf3_159
+.Lf3_160:
+    movq $65, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $27, %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_159:
+    movl %eax, -12(%rbp)
+    .loc 1 389 21
+    cmpl $89, -80(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $69, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_161
+    jmp .Lf3_162
+.Lf3_161:
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_163
+.Lf3_162:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_165
+    jmp .Lf3_164
+.Lf3_165:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_164:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf3_163:
+    movl %eax, -20(%rbp)
+    .loc 1 390 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_166
+    jmp .Lf3_167
+.Lf3_166:
+    movslq -344(%rbp), %rax
+    jmp .Lf3_168
+.Lf3_167:
+    movslq -4(%rbp), %rax
+.Lf3_168:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_170
+    jmp .Lf3_169
+.Lf3_170:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_169:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_172
+    jmp .Lf3_171
+.Lf3_172:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_174
+    jmp .Lf3_173
+.Lf3_174:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_173:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_171:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 391 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_157:
+    .loc 1 392 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_158
+.Lf3_156:
+    addq $0, %rsp
+    .loc 1 394 13
+    movq $9, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_175
+    jmp .Lf3_176
+.Lf3_175:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_178
+    jmp .Lf3_179
+.Lf3_178:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_180
+.Lf3_179:
+    movslq -8(%rbp), %rax
+.Lf3_180:
+    push %rax
+    movq $34, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_177
+.Lf3_176:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $50, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf3_177:
+    movl %eax, -16(%rbp)
+    .loc 1 395 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_142:
+    .loc 1 396 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_143
+.Lf3_141:
+    addq $8, %rsp
+    .loc 1 398 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_186
+    .p2align 4,,10
+.Lf3_185:
+    .loc 1 399 9
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_188
+    jmp .Lf3_187
+.Lf3_188:
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_187:
+    push %rax
+    movq $8, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    cmpl $64, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 401 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 402 13
+    jmp .Lf3_192
+    .p2align 4,,10
+.Lf3_191:
+    .loc 1 403 17
+    movq $1, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 404 17
+    movslq -72(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $83, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_193
+    jmp .Lf3_194
+.Lf3_193:
+    movq $84, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_195
+.Lf3_194:
+    movslq -340(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf3_195:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 405 17
+    movslq -344(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_197
+    jmp .Lf3_196
+.Lf3_197:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_196:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_199
+    jmp .Lf3_198
+.Lf3_199:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_198:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 406 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_190:
+.Lf3_192:
+    .loc 1 402 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_191
+.Lf3_189:
+    addq $0, %rsp
+    .loc 1 409 9
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_201
+    jmp .Lf3_200
+.Lf3_201:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_200:
+    push %rax
+    movq $18, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_203
+    jmp .Lf3_202
+.Lf3_203:
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_202:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_184:
+    .loc 1 398 30
+    incl -340(%rbp)
+.Lf3_186:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_185
+.Lf3_183:
+    addq $8, %rsp
+    .loc 1 411 5
+    movslq -68(%rbp), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_205
+    jmp .Lf3_204
+.Lf3_205:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_204:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $31, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf3_206
+    jmp .Lf3_207
+.Lf3_206:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -56(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_208
+.Lf3_207:
+    movq $29, %rax
+    subq $59, %rax
+    movslq %eax, %rax
+.Lf3_208:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -72(%rbp)
+    .loc 1 412 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_212
+    jmp .Lf3_213
+.Lf3_212:
+    movslq -60(%rbp), %rax
+    jmp .Lf3_214
+.Lf3_213:
+    movq $60, %rax
+.Lf3_214:
+    cmpq $0, %rax
+    jne .Lf3_209
+    jmp .Lf3_210
+.Lf3_209:
+    movq $37, %rax
+    cmpq $0, %rax
+    jne .Lf3_215
+    jmp .Lf3_216
+.Lf3_215:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf3_217
+.Lf3_216:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf3_217:
+    jmp .Lf3_211
+.Lf3_210:
+    movslq -64(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf3_211:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_219
+    jmp .Lf3_218
+.Lf3_219:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_218:
+    push %rax
+    movslq -48(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -20(%rbp)
+    .loc 1 414 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 415 9
+    jmp .Lf3_223
+    .p2align 4,,10
+.Lf3_222:
+    .loc 1 416 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_225
+    jmp .Lf3_224
+.Lf3_225:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_224:
+    push %rax
+    movslq -72(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_227
+    jmp .Lf3_226
+.Lf3_227:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_229
+    jmp .Lf3_228
+.Lf3_229:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_228:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_226:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -40(%rbp)
+    .loc 1 417 13
+    movq $4, %rax
+    push %rax
+    cmpl $19, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 418 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_235
+    .p2align 4,,10
+.Lf3_234:
+    .loc 1 419 17
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_239
+    jmp .Lf3_240
+.Lf3_239:
+    cmpl $81, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_241
+.Lf3_240:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_241:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_243
+    jmp .Lf3_242
+.Lf3_243:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_242:
+    push %rax
+    cmpl $62, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 420 17
+    cmpl $20, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_245
+    jmp .Lf3_244
+.Lf3_245:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_244:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_247
+    jmp .Lf3_246
+.Lf3_247:
+    movslq -16(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_246:
+    movl %eax, -8(%rbp)
+    .loc 1 421 17
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_249
+    jmp .Lf3_248
+.Lf3_249:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_248:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_238:
+    .loc 1 418 40
+    incl -344(%rbp)
+    .loc 1 419 17
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_250
+    jmp .Lf3_251
+.Lf3_250:
+    cmpl $81, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_252
+.Lf3_251:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_252:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_254
+    jmp .Lf3_253
+.Lf3_254:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_253:
+    push %rax
+    cmpl $62, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 420 17
+    cmpl $20, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_256
+    jmp .Lf3_255
+.Lf3_256:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_255:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_258
+    jmp .Lf3_257
+.Lf3_258:
+    movslq -16(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_257:
+    movl %eax, -8(%rbp)
+    .loc 1 421 17
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_260
+    jmp .Lf3_259
+.Lf3_260:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_259:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_237:
+    .loc 1 418 40
+    incl -344(%rbp)
+.Lf3_235:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $5, %rax
+    jl .Lf3_234
+.Lf3_236:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf3_232
+    .loc 1 419 17
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_261
+    jmp .Lf3_262
+.Lf3_261:
+    cmpl $81, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_263
+.Lf3_262:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_263:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_265
+    jmp .Lf3_264
+.Lf3_265:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_264:
+    push %rax
+    cmpl $62, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 420 17
+    cmpl $20, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_267
+    jmp .Lf3_266
+.Lf3_267:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_266:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_269
+    jmp .Lf3_268
+.Lf3_269:
+    movslq -16(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_268:
+    movl %eax, -8(%rbp)
+    .loc 1 421 17
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_271
+    jmp .Lf3_270
+.Lf3_271:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_270:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_233:
+    .loc 1 418 40
+    incl -344(%rbp)
+    jmp .Lf3_236
+.Lf3_232:
+    addq $0, %rsp
+    .loc 1 423 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_221:
+.Lf3_223:
+    .loc 1 415 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_222
+.Lf3_220:
+    addq $8, %rsp
+    .loc 1 426 5
+    cmpl $65, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_275
+    jmp .Lf3_276
+.Lf3_275:
+    movq $40, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_277
+.Lf3_276:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_278
+    jmp .Lf3_279
+.Lf3_278:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_280
+.Lf3_279:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf3_280:
+.Lf3_277:
+    cmpq $0, %rax
+    jne .Lf3_272
+    jmp .Lf3_273
+.Lf3_272:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_282
+    jmp .Lf3_281
+.Lf3_282:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_281:
+    push %rax
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_284
+    jmp .Lf3_283
+.Lf3_284:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_283:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_274
+.Lf3_273:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_286
+    jmp .Lf3_285
+.Lf3_286:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_285:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_288
+    jmp .Lf3_287
+.Lf3_288:
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_287:
+.Lf3_274:
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
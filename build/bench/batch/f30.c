@@ -0,0 +1,336 @@
+int f0() {
+    int v0 = 26;
+    int v1 = 75;
+    int v2 = 80;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    if ((((25 + 70) < (v2 >= v1)) % 9)) {
+        v1 = (((a0[10] != v3) > (v2 + v3)) % 7);
+        a0[12] = (((v0 >= v1) || (a1[1][14] <= 6)) != ((a0[9] < v1) >= (v0 || 51)));
+        a1[2][11] = (((40 / 8) > (a0[13] >= 77)) && ((v2 > v2) * (v2 > a1[3][12])));
+    } else {
+        v2 = (((v1 % 7) * (v3 / 2)) * ((v2 == v2) == (a1[1][4] * v3)));
+        v2 = (((a0[0] % 4) / 9) == ((39 >= 79) / 7));
+        v1 = (((v3 == a1[2][11]) >= (4 >= v0)) < ((a0[15] > a1[1][8]) ? (v1 != a1[1][2]) : (v2 - a0[2])));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((a1[3][5] && a1[0][14]) > 91) break;
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v1 || a0[4]) == (a0[2] % 8)) % 4);
+                    a1[2][11] = (((i0 * v2) != (62 ? v1 : i1)) == ((v3 * 89) / 8));
+                    v3 = (((3 && 91) % 4) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((26 >= i0) >= (a1[0][14] ? 27 : a1[3][10])) % 6);
+            v0 = (((v3 && v3) < (v2 % 6)) > ((17 && 19) <= (5 ? i0 : a0[15])));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v0 - v2) > 77) break;
+            a1[2][14] = (((a1[1][12] ? i2 : a1[0][5]) <= (a1[1][6] || a0[10])) > ((80 ? v3 : a0[2]) == (v3 >= 19)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((a0[6] / 4) == (a0[11] * 86)) + ((14 == v1) <= (v1 >= v0)));
+                    v1 = (((39 >= v0) ? (v0 * a1[3][8]) : (30 <= v0)) > ((82 % 7) <= (i2 / 1)));
+                    v1 = (((i3 * a1[3][4]) >= (a1[2][14] + 10)) + ((31 == v3) <= (v2 != 72)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[13] = (((v3 >= 41) + (a1[1][0] >= a0[6])) / 4);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[0] - v0) > (v1 * a0[3])) / 4)) {
+        v1 = (((v0 > a1[3][0]) || (a0[8] - v0)) + ((51 * 20) && (a0[3] ? a0[8] : v0)));
+        a1[0][9] = (((79 ? 61 : v0) >= (v0 != a1[2][7])) <= ((a1[3][5] == v2) / 8));
+        v2 = (((v2 - 26) < (v0 < a1[1][3])) - ((v1 / 1) && (v2 && v3)));
+    } else {
+        v1 = (((58 * a1[1][5]) <= (v1 ? 93 : v2)) || ((76 - v2) * (v3 && v3)));
+        v3 = (((v2 * v2) || (v1 / 7)) >= ((44 ? v3 : v0) < (v0 * v2)));
+        v0 = (((v2 != v1) || (v1 <= v3)) * ((a1[0][9] % 3) / 5));
+    }
+    if ((((2 < a0[10]) + (v3 && a1[0][12])) && ((v0 == v1) <= (a0[9] || a1[1][15])))) {
+        a0[2] = (((a1[0][10] || a0[0]) ? (6 > 59) : (v0 <= v2)) >= ((v1 || 90) * (61 <= a1[0][14])));
+        v3 = (((v1 != a0[14]) >= (a0[11] != 66)) <= ((v0 <= a1[1][4]) && (v2 < 59)));
+        v1 = (((v0 == v3) <= (v0 <= v0)) == ((a0[3] / 4) != (a0[0] && v3)));
+    } else {
+        v0 = (((v3 - 85) && (v3 + 26)) >= ((a1[0][10] % 9) != (v0 <= v2)));
+        a0[9] = (((a1[2][13] < a0[14]) ? (a1[3][4] % 9) : (a0[4] || v3)) != ((v2 != v2) - (74 <= v1)));
+        v3 = (((a1[0][15] != 55) <= (v1 == v0)) < ((v0 >= v3) != (a1[1][9] && v1)));
+    }
+    if ((((v0 == v1) >= (95 % 2)) / 3)) {
+        v0 = (((v3 && a1[2][1]) != (v1 / 3)) <= ((27 / 9) >= (v0 && 34)));
+        v1 = (((32 ? 30 : v0) && (a0[15] != 22)) ? ((a1[0][6] ? v0 : v0) || (v3 * 18)) : ((73 || v2) && (a0[14] && a1[3][0])));
+        v3 = (((a0[8] <= 74) > (v2 % 7)) && ((v1 < a0[14]) > (a1[0][13] ? a1[1][7] : a1[3][11])));
+    } else {
+        v3 = (((v3 * a1[1][11]) - (77 ? 22 : 31)) && ((a0[7] - 46) / 1));
+        a0[4] = (((a1[2][2] != 81) <= (v3 && v0)) != ((83 - a0[15]) ? (v1 - v0) : (a1[2][10] > v1)));
+        v2 = (((v2 > a0[11]) / 1) < ((57 >= v1) % 9));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((i4 >= 51) > 57) break;
+            v3 = (((56 && a0[8]) * (i4 ? a1[2][7] : a1[2][8])) + ((30 > v2) ? (i4 >= v0) : (a0[12] <= v0)));
+            v3 = (((a0[15] >= v0) - (i4 >= v2)) >= ((v0 <= v3) ? (i4 > v2) : (70 - a0[6])));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v2 + i5) <= (a1[2][10] || v2)) ? ((27 / 7) == (v0 * v1)) : ((v1 < a1[2][4]) * (a1[3][4] ? a1[0][3] : v3)));
+                    v2 = (((77 / 7) > (a1[2][9] <= v2)) || ((v1 || 47) || (v2 == i5)));
+                    v0 = (((v1 * v0) <= (v1 + v2)) == ((77 != i4) ? (58 > a0[7]) : (v1 % 4)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        if ((6 <= v3) > 56) break;
+        a0[4] = (((a1[3][1] % 7) ? (24 - v2) : (a1[1][3] && a0[15])) && ((v1 % 1) <= (v3 % 4)));
+        {
+            int i7 = 0;
+            while (i7 < 7) {
+                v3 = (((58 == a1[0][11]) / 7) >= ((a1[2][3] + 79) && (a1[3][13] == v2)));
+                a1[2][13] = (((v3 ? v0 : v2) || (v1 || 67)) ? ((a0[15] != i6) >= (18 <= a0[13])) : ((86 <= v0) / 5));
+                v2 = (((a1[1][4] < v2) * (a0[1] != 35)) - ((78 <= a1[2][11]) != (v2 * 47)));
+                i7 = i7 + 1;
+            }
+        }
+        a1[3][0] = (((56 && 56) ? (v1 % 8) : (v3 >= 77)) - ((v1 <= v3) + (v2 < v1)));
+    }
+    a0[1] = (((a0[2] < v0) / 5) / 3);
+    {
+        int i8 = 0;
+        do {
+            for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+                v0 = (((v0 ? a1[2][11] : v0) != (v3 == i9)) && ((v3 <= a1[0][1]) % 5));
+                v2 = (((v1 % 3) != (i8 / 3)) || ((v3 == 98) % 5));
+                v1 = (((v3 ? 16 : i8) * (v3 > a1[1][13])) == ((i8 * v1) * (i8 <= v0)));
+            }
+            v0 = (((89 == a1[1][9]) ? (i8 != a0[2]) : (v0 ? v2 : i8)) >= ((74 > 68) || (v1 != 48)));
+            v1 = (((v2 + v3) && (31 >= 32)) != ((v0 + 99) != (v0 < a1[0][2])));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    return (((15 > v2) <= (v3 % 2)) + ((a1[3][15] || v2) == (a0[6] - 30)));
+}
+int f1() {
+    int v0 = 6;
+    int v1 = 69;
+    int v2 = 1;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    a0[14] = (((47 && v2) ? (a0[1] || a1[0][10]) : (71 ? a1[3][0] : 87)) == ((v2 || v2) ? (v3 == v1) : (75 ? a0[6] : v1)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v0 = (((96 != a1[0][1]) >= (i1 == v0)) / 2);
+            v1 = (((a1[0][8] == i1) + (83 == i0)) <= ((16 <= a1[3][4]) / 5));
+            v2 = (((i0 - a0[9]) * (a0[14] < i1)) ? ((v0 != v3) || (i1 == 84)) : ((v3 && a1[3][13]) ? (v3 == i0) : (v0 == v2)));
+        }
+        v2 = (((i0 ? v2 : a0[13]) * (51 > a1[3][5])) == ((a0[7] >= i0) % 1));
+        v1 = (((v1 ? a1[2][15] : v0) >= (a1[1][13] && a0[10])) / 1);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a0[5] + a1[1][7]) ? (i2 * v0) : (a1[0][5] <= 95)) / 3);
+            {
+                int i3 = 0;
+                do {
+                    a1[2][0] = (((74 != i3) % 3) == ((81 != v0) * (v0 || v3)));
+                    v1 = (((v3 ? a0[14] : 91) <= (a1[1][4] - a0[13])) <= ((v2 && a0[15]) != (a0[15] && 74)));
+                    v1 = (((85 + v0) % 5) ? ((a1[0][9] ? v1 : a0[11]) ? (a0[4] / 9) : (v1 && v2)) : ((v0 && v0) <= (0 * v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v0 = (((a1[3][9] && i2) || (i2 ? i2 : a0[1])) && ((18 / 6) / 7));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((a1[1][7] ? v3 : 88) > 79) break;
+            a1[1][2] = (((i4 < 63) < (53 / 4)) <= ((v2 == 76) * (88 ? v2 : a1[1][4])));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    a0[15] = (((v0 > a0[7]) == (a0[3] % 7)) > ((i5 * v1) % 8));
+                    v0 = (((75 != i5) <= (i4 <= i4)) && ((a0[5] || v1) % 7));
+                    v1 = (((v1 <= v2) != (a0[5] * v3)) % 5);
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((a1[1][0] == v0) || (v0 ? v0 : v3)) + ((v3 >= v2) + (v3 != a0[15])));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                if ((20 && 66) > 68) break;
+                v3 = (((a1[0][8] * 76) * (i6 >= 20)) * ((7 - v3) < (52 || a0[4])));
+                a0[7] = (((v1 * 82) && (v0 < 88)) ? ((a1[3][10] ? v3 : a0[8]) % 8) : ((v0 / 1) > (a1[3][15] && v0)));
+                v2 = (((v1 >= v3) % 6) + ((i7 && 58) == (v0 && v1)));
+                i7 = i7 + 1;
+            }
+        }
+        a1[3][5] = (((74 > a0[4]) ? (i6 + v2) : (v1 <= v0)) <= ((i6 ? v1 : a1[2][14]) ? (v3 && v2) : (84 <= v3)));
+        v1 = (((a0[5] != a0[3]) ? (i6 / 4) : (v2 > v0)) == ((a0[3] - a1[3][9]) / 7));
+    }
+    a0[0] = (((v2 || a1[0][2]) + (v2 == v0)) % 2);
+    a1[0][11] = (((59 + v3) + (v0 < v1)) + ((v2 <= v3) - (a0[6] % 2)));
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        v0 = (((v1 && v3) % 9) <= ((v3 != a1[3][4]) == (i8 ? 41 : v1)));
+        {
+            int i9 = 0;
+            while (i9 < 3) {
+                v0 = (((50 || v0) / 5) <= ((v2 <= v1) % 3));
+                a1[3][9] = (((v0 > v2) ? (v2 >= v0) : (a1[1][0] % 3)) ? ((i9 || 82) >= (v3 ? a1[0][6] : 32)) : ((v1 ? i9 : a0[5]) > (78 < 98)));
+                v3 = (((i9 > 44) ? (v0 || v1) : (v0 + v1)) ? ((v2 == 84) - (i9 > v3)) : ((v3 && i8) >= (i9 - a1[2][5])));
+                i9 = i9 + 1;
+            }
+        }
+        a0[14] = (((v2 - 22) < (i8 - 32)) < ((v1 * i8) - (a0[12] <= v1)));
+    }
+    if ((((a0[6] % 7) || (v1 <= 68)) / 9)) {
+        v3 = (((a1[3][0] <= 34) > (v2 == v2)) == ((a0[11] + v2) < (52 && v3)));
+        v3 = (((7 / 9) * (v0 <= a0[0])) * ((a1[0][9] + v1) - (51 == v1)));
+        v0 = (((v1 - 95) <= (70 != a0[15])) > ((v3 % 5) > (a1[1][14] != v0)));
+    } else {
+        a0[0] = (((v1 - a1[0][11]) <= (v2 - a1[1][4])) != ((v0 / 9) / 3));
+        v2 = (((v3 ? 32 : a1[1][4]) ? (v1 - v1) : (v1 >= v1)) > ((88 > v0) && (v1 ? a1[1][14] : v2)));
+        a1[3][2] = (((v0 ? v2 : 61) % 8) >= ((a1[1][6] >= v1) && (a1[0][13] >= v0)));
+    }
+    if ((((13 ? a0[9] : 54) + (44 > a1[1][12])) || ((v2 <= v1) % 4))) {
+        v2 = (((v3 >= a1[0][9]) >= (v1 ? v3 : v3)) && ((20 && 61) % 6));
+        v0 = (((v1 - a1[0][12]) <= (a0[5] && 42)) / 9);
+        v0 = (((80 * 66) % 3) >= ((42 && v3) > (v3 / 8)));
+    } else {
+        v3 = (((v0 || a0[4]) || (84 ? 85 : v2)) != ((v1 * 88) <= (v3 * v1)));
+        v2 = (((12 + a0[6]) % 8) - ((v1 || a0[3]) >= (v0 <= 16)));
+        v0 = (((v2 < a0[0]) >= (55 == v0)) <= ((66 - v3) <= (v2 < v3)));
+    }
+    return (((v3 >= a1[1][2]) < (a1[2][2] < a1[3][14])) > ((a1[3][12] > v1) > (a1[3][11] * v0)));
+}
+int f2() {
+    int v0 = 30;
+    int v1 = 9;
+    int v2 = 60;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v0 = (((v1 ? a0[8] : v0) / 2) + ((v0 * v3) ? (v0 != v2) : (v3 ? v2 : 16)));
+        v0 = (((53 != v1) || (v2 % 3)) ? ((a0[7] && v3) == (98 * v1)) : ((v2 < a0[9]) == (v2 >= v0)));
+        {
+            int i1 = 0;
+            do {
+                a0[10] = (((i1 * v2) == (i0 >= i1)) / 4);
+                v3 = (((v2 + i1) <= (v2 + v1)) % 2);
+                a1[3][13] = (((i1 ? i1 : 22) && (i1 < 64)) ? ((29 - i1) - (51 >= 53)) : ((94 + 21) < (a1[3][1] != 87)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+    }
+    if ((((v2 >= a1[1][13]) >= (v2 ? a1[0][12] : v0)) > ((v3 && 75) / 4))) {
+        a1[3][15] = (((v2 ? a0[2] : v0) - (v2 == 0)) == ((a0[9] ? 78 : v3) || (v2 >= a1[1][14])));
+        v3 = (((v1 + 11) <= (a1[2][7] || a1[0][2])) ? ((v1 / 1) ? (v3 ? v2 : v1) : (a0[10] < 28)) : ((v1 % 3) != (58 ? v2 : 76)));
+        a1[0][11] = (((v2 > v1) == (v0 ? v2 : v0)) - ((86 ? 79 : a1[2][5]) <= (a1[0][10] - v3)));
+    } else {
+        v3 = (((v2 % 6) && (v3 > 22)) || ((v2 ? v1 : 10) % 5));
+        v2 = (((v1 + a1[0][7]) * (a1[2][12] ? 51 : v1)) % 3);
+        v2 = (((v0 && v2) * (25 - v3)) >= ((v3 * v2) ? (a0[0] < v3) : (v3 > a1[1][7])));
+    }
+    v3 = (((78 / 3) && (v1 < 80)) >= ((54 > a1[3][2]) != (v2 % 7)));
+    if ((((v1 || 66) == (a0[5] % 8)) * ((v2 != a1[0][3]) * (a0[6] ? v0 : v2)))) {
+        v3 = (((75 && v3) % 4) ? ((v0 * a1[1][8]) - (v1 >= v2)) : ((v0 >= a0[3]) >= (v3 % 9)));
+        v1 = (((a0[6] < v3) + (a1[3][8] ? v2 : 66)) != ((v0 || v0) / 2));
+        v2 = (((v2 >= a1[1][1]) * (v3 == v0)) > ((94 % 6) + (v0 / 3)));
+    } else {
+        v3 = (((45 - v1) - (v1 ? 34 : v1)) > ((99 >= v1) || (a0[9] >= v2)));
+        v0 = (((v2 % 9) && (66 / 6)) || ((a0[8] / 8) != (v3 * v3)));
+        v1 = (((45 * 82) * (a1[3][3] % 3)) >= ((39 - v0) >= (v0 ? a0[13] : 46)));
+    }
+    if ((((v3 != v2) && (v0 == 39)) / 9)) {
+        a1[0][9] = (((v0 * v2) * (57 % 5)) ? ((v1 * 22) < (a1[2][4] * v2)) : ((a1[1][7] > a0[6]) == (87 ? v2 : v0)));
+        v1 = (((93 % 8) / 6) >= ((v0 != v1) != (71 * a1[0][13])));
+        v0 = (((a1[2][11] != v2) ? (v0 % 1) : (a0[10] > v1)) ? ((16 ? v3 : 73) * (v3 && v3)) : ((a0[8] > v3) || (a1[2][1] ? 70 : a1[1][1])));
+    } else {
+        v3 = (((47 % 3) < (v1 + v0)) ? ((55 > 8) % 4) : ((62 > 42) && (a1[1][14] <= a0[6])));
+        v2 = (((57 % 9) <= (v0 < v3)) / 5);
+        v3 = (((a0[14] == a0[14]) - (v2 * a1[2][3])) ? ((v3 - a1[1][4]) <= (a0[3] == v1)) : ((v3 == a1[2][7]) + (a1[0][0] >= v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 <= 89) > 76) break;
+            v3 = (((v2 >= v0) && (i2 > a0[8])) * ((v3 != i2) && (v1 ? v1 : v0)));
+            v3 = (((i2 != v2) ? (i2 + a1[0][4]) : (v0 ? 38 : v1)) - ((a0[7] && v2) && (70 && v3)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((i2 * 19) == (v2 != v1)) && ((v3 || v0) || (68 % 4)));
+                    a0[14] = (((i3 && v0) || (a0[10] - 79)) % 2);
+                    v1 = (((a0[13] > a1[2][3]) / 4) * ((a1[0][15] - 6) > (v2 <= i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v3 = (((87 < 66) * (88 - v1)) >= ((v0 >= a0[3]) <= (v0 || a0[6])));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                if ((i4 - 2) > 94) break;
+                v1 = (((49 ? i4 : a0[10]) != (v3 || a1[0][11])) <= ((v3 == 14) / 2));
+                v2 = (((a1[3][11] < a0[0]) ? (v1 <= 80) : (a0[11] / 3)) >= ((a1[1][9] ? a1[2][8] : 23) || (a1[3][12] + 90)));
+                v3 = (((i4 >= 62) + (a1[3][10] >= i5)) || ((v0 > a1[1][1]) == (i4 && 11)));
+            }
+            a0[14] = (((v3 % 5) < (2 - a0[9])) * ((18 <= 64) != (v3 % 7)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((7 != a1[3][2]) - (90 != a1[0][12])) >= ((v1 ? 93 : a1[0][1]) ? (22 >= 61) : (23 || 53)))) {
+        v3 = (((v0 ? 68 : a1[2][5]) + (a1[3][5] == 25)) % 2);
+        v3 = (((a1[1][4] != 29) * (a0[9] % 5)) || ((v2 % 8) % 8));
+        a1[2][8] = (((v1 + v3) > (a0[2] - 52)) || ((27 <= v1) == (24 + 53)));
+    } else {
+        a0[7] = (((a0[14] % 1) != (v1 - v2)) % 8);
+        v0 = (((a1[2][11] == a0[8]) || (a1[0][15] ? 69 : 30)) || ((a0[14] % 5) / 9));
+        v2 = (((93 < a0[10]) / 3) < ((v2 + 21) == (a1[2][7] - a0[6])));
+    }
+    if ((((v0 + v2) ? (a0[11] < v2) : (v3 * 12)) || ((a0[4] / 3) >= (v0 && a0[7])))) {
+        v1 = (((a1[2][12] != a1[0][0]) ? (v0 - 30) : (v2 * v2)) != ((v3 * 11) != (v2 == v1)));
+        v3 = (((v0 && 24) * (96 % 2)) && ((v0 >= v2) == (a1[0][0] || v2)));
+        v3 = (((v2 == v3) - (a1[3][4] * v3)) / 8);
+    } else {
+        v1 = (((a0[5] && v3) - (v1 < v1)) && ((v2 ? 5 : v1) || (v0 ? 22 : v0)));
+        v2 = (((a0[10] ? a0[5] : v0) % 8) / 1);
+        v1 = (((v0 <= a0[10]) - (50 >= 20)) % 4);
+    }
+    v2 = (((21 - v3) * (v3 / 3)) <= ((7 < 37) < (v3 % 9)));
+    return (((89 && 25) + (v0 > v0)) || ((a1[1][1] % 3) != (v2 || v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,8008 @@
+    .file 1 "build/bench/batch/f30.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 330 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 331 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 332 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 333 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 334 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 335 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $26, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $75, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $80, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $82, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    movq $9, %rax
+    push %rax
+    movq $25, %rax
+    addq $70, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_2
+    .loc 1 9 9
+    movq $7, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 10 9
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_4
+    jmp .Lf0_3
+.Lf0_4:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $6, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_3:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_6
+    jmp .Lf0_5
+.Lf0_6:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_5:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -32(%rbp)
+    .loc 1 11 9
+    movq $8, %rax
+    push %rax
+    movq $40, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $77, -28(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf0_1
+.Lf0_2:
+    .loc 1 13 9
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 14 9
+    movq $9, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 15 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -20(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_11
+.Lf0_10:
+    movslq -12(%rbp), %rax
+    subl -72(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_11:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_1:
+    .loc 1 18 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 19 9
+    .p2align 4,,10
+.Lf0_14:
+    .loc 1 20 13
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_17
+    jmp .Lf0_16
+.Lf0_17:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_16:
+    cmpq $91, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_15
+    jmp .Lf0_12
+.Lf0_15:
+    .loc 1 22 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 23 17
+    .p2align 4,,10
+.Lf0_20:
+    .loc 1 24 21
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_22
+    jmp .Lf0_21
+.Lf0_22:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_21:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 25 21
+    movslq -340(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $62, %rax
+    cmpq $0, %rax
+    jne .Lf0_23
+    jmp .Lf0_24
+.Lf0_23:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_25
+.Lf0_24:
+    movslq -344(%rbp), %rax
+.Lf0_25:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $89, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 26 21
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_27
+    jmp .Lf0_26
+.Lf0_27:
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_26:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 27 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_19:
+    .loc 1 28 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_20
+.Lf0_18:
+    addq $0, %rsp
+    .loc 1 30 13
+    movq $6, %rax
+    push %rax
+    movq $26, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_29
+.Lf0_28:
+    movq $27, %rax
+    jmp .Lf0_30
+.Lf0_29:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf0_30:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 31 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    push %rax
+    movq $5, %rax
+    cmpq $0, %rax
+    jne .Lf0_35
+    jmp .Lf0_36
+.Lf0_35:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_37
+.Lf0_36:
+    movslq -20(%rbp), %rax
+.Lf0_37:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 32 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_13:
+    .loc 1 33 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_14
+.Lf0_12:
+    addq $8, %rsp
+    .loc 1 36 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 37 9
+    jmp .Lf0_41
+    .p2align 4,,10
+.Lf0_40:
+    .loc 1 38 13
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $77, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_42
+    jmp .Lf0_38
+.Lf0_42:
+    .loc 1 39 13
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_43
+    jmp .Lf0_44
+.Lf0_43:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_45
+.Lf0_44:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf0_45:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_47
+    jmp .Lf0_46
+.Lf0_47:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_46:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    jne .Lf0_48
+    jmp .Lf0_49
+.Lf0_48:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_50
+.Lf0_49:
+    movslq -72(%rbp), %rax
+.Lf0_50:
+    push %rax
+    cmpl $19, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 41 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 42 17
+    jmp .Lf0_54
+    .p2align 4,,10
+.Lf0_53:
+    .loc 1 43 21
+    movq $14, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    imulq $86, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 44 21
+    movq $39, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_56
+.Lf0_55:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_57
+.Lf0_56:
+    movq $30, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_57:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $82, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 45 21
+    movq $31, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $72, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $10, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 46 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_52:
+.Lf0_54:
+    .loc 1 42 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_53
+.Lf0_51:
+    addq $0, %rsp
+    .loc 1 49 13
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $41, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    .loc 1 50 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_39:
+.Lf0_41:
+    .loc 1 37 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_40
+.Lf0_38:
+    addq $8, %rsp
+    .loc 1 53 5
+    movq $4, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_59
+    .loc 1 54 9
+    movq $51, %rax
+    imulq $20, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_60
+.Lf0_61:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_63
+.Lf0_62:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_64
+.Lf0_63:
+    movslq -4(%rbp), %rax
+.Lf0_64:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_60:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_66
+    jmp .Lf0_65
+.Lf0_66:
+    movslq -48(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_65:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 55 9
+    movq $79, %rax
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_68
+.Lf0_67:
+    movq $61, %rax
+    jmp .Lf0_69
+.Lf0_68:
+    movslq -4(%rbp), %rax
+.Lf0_69:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 56 9
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_70
+.Lf0_71:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_73
+    jmp .Lf0_72
+.Lf0_73:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_72:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_70:
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $26, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_58
+.Lf0_59:
+    .loc 1 58 9
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    imulq $58, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_74
+    jmp .Lf0_75
+.Lf0_74:
+    movq $93, %rax
+    jmp .Lf0_76
+.Lf0_75:
+    movslq -12(%rbp), %rax
+.Lf0_76:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_78
+    jmp .Lf0_77
+.Lf0_78:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_80
+    jmp .Lf0_79
+.Lf0_80:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_79:
+    push %rax
+    movq $76, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_77:
+    movl %eax, -8(%rbp)
+    .loc 1 59 9
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_82
+    jmp .Lf0_81
+.Lf0_82:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_81:
+    push %rax
+    movq $44, %rax
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_84
+.Lf0_83:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_85
+.Lf0_84:
+    movslq -4(%rbp), %rax
+.Lf0_85:
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 60 9
+    movq $5, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_87
+    jmp .Lf0_86
+.Lf0_87:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_86:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_58:
+    .loc 1 62 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_90
+    jmp .Lf0_89
+.Lf0_90:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_89:
+    push %rax
+    movq $2, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_91
+.Lf0_92:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_94
+    jmp .Lf0_93
+.Lf0_94:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_91:
+    cmpq $0, %rax
+    je .Lf0_95
+    .loc 1 63 9
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_100
+    jmp .Lf0_99
+.Lf0_100:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_99:
+    cmpq $0, %rax
+    jne .Lf0_96
+    jmp .Lf0_97
+.Lf0_96:
+    movq $6, %rax
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_98
+.Lf0_97:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_98:
+    push %rax
+    movq $61, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_102
+    jmp .Lf0_101
+.Lf0_102:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_101:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -72(%rbp)
+    .loc 1 64 9
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $66, -36(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_104
+    jmp .Lf0_103
+.Lf0_104:
+    cmpl $59, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_103:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 65 9
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_105
+.Lf0_106:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_105:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_88
+.Lf0_95:
+    .loc 1 67 9
+    movslq -16(%rbp), %rax
+    subq $85, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_108
+    jmp .Lf0_107
+.Lf0_108:
+    movslq -16(%rbp), %rax
+    addq $26, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_107:
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 68 9
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_110
+.Lf0_109:
+    movq $9, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_111
+.Lf0_110:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_113
+    jmp .Lf0_112
+.Lf0_113:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_112:
+.Lf0_111:
+    push %rax
+    movq $74, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -44(%rbp)
+    .loc 1 69 9
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $55, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_115
+    jmp .Lf0_114
+.Lf0_115:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_114:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_88:
+    .loc 1 71 5
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $95, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_117
+    .loc 1 72 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_118
+.Lf0_119:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_118:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_120
+.Lf0_121:
+    movq $34, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_120:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 73 9
+    movq $32, %rax
+    cmpq $0, %rax
+    jne .Lf0_125
+    jmp .Lf0_126
+.Lf0_125:
+    movq $30, %rax
+    jmp .Lf0_127
+.Lf0_126:
+    movslq -4(%rbp), %rax
+.Lf0_127:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    cmpl $22, -20(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+    cmpq $0, %rax
+    jne .Lf0_122
+    jmp .Lf0_123
+.Lf0_122:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_131
+.Lf0_130:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -4(%rbp), %rax
+.Lf0_132:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_134
+    jmp .Lf0_133
+.Lf0_134:
+    movslq -16(%rbp), %rax
+    imulq $18, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_133:
+    jmp .Lf0_124
+.Lf0_123:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_136
+    jmp .Lf0_135
+.Lf0_136:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_135:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_137
+.Lf0_138:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_140
+    jmp .Lf0_139
+.Lf0_140:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_139:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_137:
+.Lf0_124:
+    movl %eax, -8(%rbp)
+    .loc 1 74 9
+    cmpl $74, -48(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_142
+    jmp .Lf0_141
+.Lf0_142:
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_143
+    jmp .Lf0_144
+.Lf0_143:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf0_145
+.Lf0_144:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf0_145:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_141:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_116
+.Lf0_117:
+    .loc 1 76 9
+    movq $77, %rax
+    cmpq $0, %rax
+    jne .Lf0_146
+    jmp .Lf0_147
+.Lf0_146:
+    movq $22, %rax
+    jmp .Lf0_148
+.Lf0_147:
+    movq $31, %rax
+.Lf0_148:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_149
+.Lf0_150:
+    movq $1, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    subq $46, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_149:
+    movl %eax, -16(%rbp)
+    .loc 1 77 9
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $81, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_152
+    jmp .Lf0_151
+.Lf0_152:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_151:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $83, %rax
+    subl -20(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_153
+    jmp .Lf0_154
+.Lf0_153:
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_155
+.Lf0_154:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_155:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -64(%rbp)
+    .loc 1 78 9
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $57, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_116:
+    .loc 1 81 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 82 9
+    jmp .Lf0_159
+    .p2align 4,,10
+.Lf0_158:
+    .loc 1 83 13
+    cmpl $51, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $57, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_160
+    jmp .Lf0_156
+.Lf0_160:
+    .loc 1 84 13
+    movq $30, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf0_161
+    jmp .Lf0_162
+.Lf0_161:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_163
+.Lf0_162:
+    movslq -32(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_163:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_165
+.Lf0_164:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf0_166
+.Lf0_165:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf0_166:
+    push %rax
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_167
+.Lf0_168:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_167:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 85 13
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_169
+    jmp .Lf0_170
+.Lf0_169:
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_171
+.Lf0_170:
+    movq $70, %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_171:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 87 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 88 17
+    .p2align 4,,10
+.Lf0_174:
+    .loc 1 89 21
+    movslq -12(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_179
+    jmp .Lf0_178
+.Lf0_179:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_178:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    movq $7, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_177
+.Lf0_176:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_180
+    jmp .Lf0_181
+.Lf0_180:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf0_182
+.Lf0_181:
+    movslq -16(%rbp), %rax
+.Lf0_182:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_177:
+    movl %eax, -8(%rbp)
+    .loc 1 90 21
+    movq $7, %rax
+    push %rax
+    movq $77, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_184
+    jmp .Lf0_183
+.Lf0_184:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_186
+    jmp .Lf0_185
+.Lf0_186:
+    movq $47, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_185:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_188
+    jmp .Lf0_187
+.Lf0_188:
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_187:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_183:
+    movl %eax, -12(%rbp)
+    .loc 1 91 21
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $77, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_189
+    jmp .Lf0_190
+.Lf0_189:
+    movq $58, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_191
+.Lf0_190:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_191:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 92 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_173:
+    .loc 1 93 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_174
+.Lf0_172:
+    addq $0, %rsp
+    .loc 1 95 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_157:
+.Lf0_159:
+    .loc 1 82 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_158
+.Lf0_156:
+    addq $8, %rsp
+    .loc 1 98 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_197
+    .p2align 4,,10
+.Lf0_196:
+    .loc 1 99 9
+    movq $6, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $56, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_198
+    jmp .Lf0_194
+.Lf0_198:
+    .loc 1 100 9
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_200
+.Lf0_199:
+    movq $24, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_201
+.Lf0_200:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_203
+    jmp .Lf0_202
+.Lf0_203:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_202:
+.Lf0_201:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_204
+.Lf0_205:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_204:
+    movl %eax, -64(%rbp)
+    .loc 1 102 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 103 13
+    jmp .Lf0_209
+    .p2align 4,,10
+.Lf0_208:
+    .loc 1 104 17
+    movq $7, %rax
+    push %rax
+    movq $58, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    addq $79, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_211
+    jmp .Lf0_210
+.Lf0_211:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_210:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 105 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_215
+    jmp .Lf0_216
+.Lf0_215:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_217
+.Lf0_216:
+    movslq -12(%rbp), %rax
+.Lf0_217:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_221
+    jmp .Lf0_220
+.Lf0_221:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_220:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_213
+.Lf0_212:
+    movslq -20(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $18, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_214
+.Lf0_213:
+    movq $5, %rax
+    push %rax
+    movq $86, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_214:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 106 17
+    movq $78, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $47, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $35, -76(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 107 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_207:
+.Lf0_209:
+    .loc 1 103 20
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_208
+.Lf0_206:
+    addq $0, %rsp
+    .loc 1 110 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_226
+    jmp .Lf0_225
+.Lf0_226:
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_225:
+    cmpq $0, %rax
+    jne .Lf0_222
+    jmp .Lf0_223
+.Lf0_222:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_224
+.Lf0_223:
+    cmpl $77, -16(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf0_224:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_195:
+    .loc 1 98 30
+    incl -340(%rbp)
+.Lf0_197:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_196
+.Lf0_194:
+    addq $8, %rsp
+    .loc 1 112 5
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 114 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 115 9
+    .p2align 4,,10
+.Lf0_229:
+    .loc 1 116 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_235
+    .p2align 4,,10
+.Lf0_234:
+    .loc 1 117 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_239
+    jmp .Lf0_240
+.Lf0_239:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_241
+.Lf0_240:
+    movslq -4(%rbp), %rax
+.Lf0_241:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_243
+    jmp .Lf0_242
+.Lf0_243:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_242:
+    movl %eax, -4(%rbp)
+    .loc 1 118 17
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_245
+    jmp .Lf0_244
+.Lf0_245:
+    movq $5, %rax
+    push %rax
+    cmpl $98, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_244:
+    movl %eax, -12(%rbp)
+    .loc 1 119 17
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_246
+    jmp .Lf0_247
+.Lf0_246:
+    movq $16, %rax
+    jmp .Lf0_248
+.Lf0_247:
+    movslq -340(%rbp), %rax
+.Lf0_248:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_238:
+    .loc 1 116 38
+    incl -344(%rbp)
+    .loc 1 117 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_249
+    jmp .Lf0_250
+.Lf0_249:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_251
+.Lf0_250:
+    movslq -4(%rbp), %rax
+.Lf0_251:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_253
+    jmp .Lf0_252
+.Lf0_253:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_252:
+    movl %eax, -4(%rbp)
+    .loc 1 118 17
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_255
+    jmp .Lf0_254
+.Lf0_255:
+    movq $5, %rax
+    push %rax
+    cmpl $98, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_254:
+    movl %eax, -12(%rbp)
+    .loc 1 119 17
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_256
+    jmp .Lf0_257
+.Lf0_256:
+    movq $16, %rax
+    jmp .Lf0_258
+.Lf0_257:
+    movslq -340(%rbp), %rax
+.Lf0_258:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_237:
+    .loc 1 116 38
+    incl -344(%rbp)
+.Lf0_235:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $5, %rax
+    jl .Lf0_234
+.Lf0_236:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_232
+    .loc 1 117 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_259
+    jmp .Lf0_260
+.Lf0_259:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_261
+.Lf0_260:
+    movslq -4(%rbp), %rax
+.Lf0_261:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_263
+    jmp .Lf0_262
+.Lf0_263:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_262:
+    movl %eax, -4(%rbp)
+    .loc 1 118 17
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_265
+    jmp .Lf0_264
+.Lf0_265:
+    movq $5, %rax
+    push %rax
+    cmpl $98, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_264:
+    movl %eax, -12(%rbp)
+    .loc 1 119 17
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_266
+    jmp .Lf0_267
+.Lf0_266:
+    movq $16, %rax
+    jmp .Lf0_268
+.Lf0_267:
+    movslq -340(%rbp), %rax
+.Lf0_268:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_233:
+    .loc 1 116 38
+    incl -344(%rbp)
+    jmp .Lf0_236
+.Lf0_232:
+    addq $0, %rsp
+    .loc 1 121 13
+    movq $89, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_269
+    jmp .Lf0_270
+.Lf0_269:
+    movslq -340(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_271
+.Lf0_270:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_272
+    jmp .Lf0_273
+.Lf0_272:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_274
+.Lf0_273:
+    movslq -340(%rbp), %rax
+.Lf0_274:
+.Lf0_271:
+    push %rax
+    movq $74, %rax
+    cmpq $68, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_276
+    jmp .Lf0_275
+.Lf0_276:
+    cmpl $48, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_275:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 122 13
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_278
+    jmp .Lf0_277
+.Lf0_278:
+    movq $31, %rax
+    cmpq $32, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_277:
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $99, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 123 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_228:
+    .loc 1 124 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_229
+.Lf0_227:
+    addq $8, %rsp
+    .loc 1 126 5
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_280
+    jmp .Lf0_279
+.Lf0_280:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_279:
+    push %rax
+    movslq -56(%rbp), %rax
+    subq $30, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $15, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 128 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 129 5
+    subq $8, %rsp
+    movq $6, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 130 5
+    movq $69, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 131 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 132 5
+    movq $30, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 133 5
+    subq $64, %rsp
+    .loc 1 134 5
+    subq $256, %rsp
+    .loc 1 135 5
+    movq $47, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_5
+    jmp .Lf1_4
+.Lf1_5:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_4:
+    cmpq $0, %rax
+    jne .Lf1_1
+    jmp .Lf1_2
+.Lf1_1:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_7
+    jmp .Lf1_6
+.Lf1_7:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_6:
+    jmp .Lf1_3
+.Lf1_2:
+    movq $71, %rax
+    cmpq $0, %rax
+    jne .Lf1_8
+    jmp .Lf1_9
+.Lf1_8:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf1_10
+.Lf1_9:
+    movq $87, %rax
+.Lf1_10:
+.Lf1_3:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_15
+    jmp .Lf1_14
+.Lf1_15:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_14:
+    cmpq $0, %rax
+    jne .Lf1_11
+    jmp .Lf1_12
+.Lf1_11:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_13
+.Lf1_12:
+    movq $75, %rax
+    cmpq $0, %rax
+    jne .Lf1_16
+    jmp .Lf1_17
+.Lf1_16:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_18
+.Lf1_17:
+    movslq -8(%rbp), %rax
+.Lf1_18:
+.Lf1_13:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -24(%rbp)
+    .loc 1 136 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_24
+    .p2align 4,,10
+.Lf1_23:
+    .loc 1 137 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_30
+    .p2align 4,,10
+.Lf1_29:
+    .loc 1 138 13
+    movq $2, %rax
+    push %rax
+    movq $96, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 139 13
+    movq $83, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $16, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 140 13
+    movslq -24(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_31
+    jmp .Lf1_32
+.Lf1_31:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_35
+    jmp .Lf1_34
+.Lf1_35:
+    cmpl $84, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_34:
+    jmp .Lf1_33
+.Lf1_32:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_40
+    jmp .Lf1_39
+.Lf1_40:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_39:
+    cmpq $0, %rax
+    jne .Lf1_36
+    jmp .Lf1_37
+.Lf1_36:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_38
+.Lf1_37:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_38:
+.Lf1_33:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_28:
+    .loc 1 137 34
+    incl -344(%rbp)
+.Lf1_30:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_29
+.Lf1_27:
+    addq $0, %rsp
+    .loc 1 142 9
+    movq $51, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_41
+    jmp .Lf1_42
+.Lf1_41:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_43
+.Lf1_42:
+    movslq -28(%rbp), %rax
+.Lf1_43:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 143 9
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_44
+    jmp .Lf1_45
+.Lf1_44:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf1_46
+.Lf1_45:
+    movslq -4(%rbp), %rax
+.Lf1_46:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_47
+.Lf1_48:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_47:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_22:
+    .loc 1 136 30
+    incl -340(%rbp)
+.Lf1_24:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_23
+.Lf1_21:
+    addq $8, %rsp
+    .loc 1 146 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 147 9
+    .p2align 4,,10
+.Lf1_51:
+    .loc 1 148 13
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_53
+.Lf1_52:
+    movslq -340(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_54
+.Lf1_53:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setle %al
+.Lf1_54:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 150 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 151 17
+    .p2align 4,,10
+.Lf1_57:
+    .loc 1 152 21
+    movq $3, %rax
+    push %rax
+    movq $74, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_59
+    jmp .Lf1_58
+.Lf1_59:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_58:
+    push %rax
+    movq $81, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 153 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_60
+    jmp .Lf1_61
+.Lf1_60:
+    movslq -24(%rbp), %rax
+    jmp .Lf1_62
+.Lf1_61:
+    movq $91, %rax
+.Lf1_62:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    subl -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_64
+    jmp .Lf1_63
+.Lf1_64:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_65
+.Lf1_66:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_65:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 154 21
+    movq $5, %rax
+    push %rax
+    movq $85, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_75
+.Lf1_74:
+    movslq -36(%rbp), %rax
+.Lf1_75:
+    cmpq $0, %rax
+    jne .Lf1_70
+    jmp .Lf1_71
+.Lf1_70:
+    movq $9, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_72
+.Lf1_71:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_77
+    jmp .Lf1_76
+.Lf1_77:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_76:
+.Lf1_72:
+    jmp .Lf1_69
+.Lf1_68:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_79
+    jmp .Lf1_78
+.Lf1_79:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_78:
+    push %rax
+    movq $0, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_69:
+    movl %eax, -8(%rbp)
+    .loc 1 155 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_56:
+    .loc 1 156 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_57
+.Lf1_55:
+    addq $0, %rsp
+    .loc 1 158 13
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_81
+    jmp .Lf1_80
+.Lf1_81:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_80:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_83
+    jmp .Lf1_82
+.Lf1_83:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_85
+.Lf1_84:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_86
+.Lf1_85:
+    movslq -76(%rbp), %rax
+.Lf1_86:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_82:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_88
+    jmp .Lf1_87
+.Lf1_88:
+    movq $7, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $18, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_87:
+    movl %eax, -4(%rbp)
+    .loc 1 159 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_50:
+    .loc 1 160 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_51
+.Lf1_49:
+    addq $8, %rsp
+    .loc 1 163 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 164 9
+    jmp .Lf1_92
+    .p2align 4,,10
+.Lf1_91:
+    .loc 1 165 13
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_94
+    jmp .Lf1_95
+.Lf1_94:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_96
+.Lf1_95:
+    movq $88, %rax
+.Lf1_96:
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_93
+    jmp .Lf1_89
+.Lf1_93:
+    .loc 1 166 13
+    cmpl $63, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    jne .Lf1_97
+    jmp .Lf1_98
+.Lf1_97:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_99
+.Lf1_98:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf1_99:
+    push %rax
+    cmpl $76, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 168 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 169 17
+    jmp .Lf1_103
+    .p2align 4,,10
+.Lf1_102:
+    .loc 1 170 21
+    movslq -4(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -20(%rbp)
+    .loc 1 171 21
+    movq $75, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_105
+    jmp .Lf1_104
+.Lf1_105:
+    movq $7, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_107
+    jmp .Lf1_106
+.Lf1_107:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_106:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_104:
+    movl %eax, -4(%rbp)
+    .loc 1 172 21
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -60(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 173 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_101:
+.Lf1_103:
+    .loc 1 169 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_102
+.Lf1_100:
+    addq $0, %rsp
+    .loc 1 176 13
+    movslq -16(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_109
+    jmp .Lf1_108
+.Lf1_109:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_111
+.Lf1_110:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_112
+.Lf1_111:
+    movslq -16(%rbp), %rax
+.Lf1_112:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_108:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 177 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_90:
+.Lf1_92:
+    .loc 1 164 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_91
+.Lf1_89:
+    addq $8, %rsp
+    .loc 1 180 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_118
+    .p2align 4,,10
+.Lf1_117:
+    .loc 1 182 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 183 13
+    jmp .Lf1_122
+    .p2align 4,,10
+.Lf1_121:
+    .loc 1 184 17
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_125
+    jmp .Lf1_124
+.Lf1_125:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_124:
+    cmpq $68, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_123
+    jmp .Lf1_119
+.Lf1_123:
+    .loc 1 185 17
+    movq $7, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_127
+    jmp .Lf1_126
+.Lf1_127:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_126:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $20, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imulq $76, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 186 17
+    movslq -8(%rbp), %rax
+    imulq $82, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_131
+.Lf1_132:
+    cmpl $88, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_131:
+    cmpq $0, %rax
+    jne .Lf1_128
+    jmp .Lf1_129
+.Lf1_128:
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_133
+    jmp .Lf1_134
+.Lf1_133:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_135
+.Lf1_134:
+    movslq -48(%rbp), %rax
+.Lf1_135:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_130
+.Lf1_129:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_137
+    jmp .Lf1_136
+.Lf1_137:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_136:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_130:
+    movl %eax, -52(%rbp)
+    .loc 1 187 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_139
+    jmp .Lf1_138
+.Lf1_139:
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_138:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_141
+    jmp .Lf1_140
+.Lf1_141:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_140:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 188 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_120:
+.Lf1_122:
+    .loc 1 183 20
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_121
+.Lf1_119:
+    addq $0, %rsp
+    .loc 1 191 9
+    movq $74, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_142
+    jmp .Lf1_143
+.Lf1_142:
+    movslq -340(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_144
+.Lf1_143:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf1_144:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_148
+    jmp .Lf1_149
+.Lf1_148:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_150
+.Lf1_149:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf1_150:
+    cmpq $0, %rax
+    jne .Lf1_145
+    jmp .Lf1_146
+.Lf1_145:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_152
+    jmp .Lf1_151
+.Lf1_152:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_151:
+    jmp .Lf1_147
+.Lf1_146:
+    movq $84, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf1_147:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 192 9
+    movslq -60(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_154
+.Lf1_153:
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_155
+.Lf1_154:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_155:
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_116:
+    .loc 1 180 30
+    incl -340(%rbp)
+.Lf1_118:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_117
+.Lf1_115:
+    addq $8, %rsp
+    .loc 1 194 5
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_157
+    jmp .Lf1_156
+.Lf1_157:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_156:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 195 5
+    movq $2, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $59, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 196 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_163
+    .p2align 4,,10
+.Lf1_162:
+    .loc 1 197 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_165
+    jmp .Lf1_164
+.Lf1_165:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_164:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_167
+.Lf1_166:
+    movq $41, %rax
+    jmp .Lf1_168
+.Lf1_167:
+    movslq -8(%rbp), %rax
+.Lf1_168:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 199 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 200 13
+    jmp .Lf1_172
+    .p2align 4,,10
+.Lf1_171:
+    .loc 1 201 17
+    movq $5, %rax
+    push %rax
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_174
+    jmp .Lf1_173
+.Lf1_174:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_173:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 202 17
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_178
+    jmp .Lf1_179
+.Lf1_178:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_180
+.Lf1_179:
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_180:
+    cmpq $0, %rax
+    jne .Lf1_175
+    jmp .Lf1_176
+.Lf1_175:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_182
+    jmp .Lf1_181
+.Lf1_182:
+    movq $82, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_181:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_183
+    jmp .Lf1_184
+.Lf1_183:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_185
+.Lf1_184:
+    movq $32, %rax
+.Lf1_185:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_177
+.Lf1_176:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_187
+.Lf1_186:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_188
+.Lf1_187:
+    movslq -60(%rbp), %rax
+.Lf1_188:
+    push %rax
+    movq $78, %rax
+    cmpq $98, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_177:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 203 17
+    cmpl $44, -344(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_192
+    jmp .Lf1_193
+.Lf1_192:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_196
+    jmp .Lf1_195
+.Lf1_196:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_195:
+    jmp .Lf1_194
+.Lf1_193:
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_194:
+    cmpq $0, %rax
+    jne .Lf1_189
+    jmp .Lf1_190
+.Lf1_189:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $84, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_191
+.Lf1_190:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_197
+.Lf1_198:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_197:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_191:
+    movl %eax, -16(%rbp)
+    .loc 1 204 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_170:
+.Lf1_172:
+    .loc 1 200 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_171
+.Lf1_169:
+    addq $0, %rsp
+    .loc 1 207 9
+    movslq -12(%rbp), %rax
+    subq $22, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subq $32, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -24(%rbp)
+    addq $0, %rsp
+.Lf1_161:
+    .loc 1 196 30
+    incl -340(%rbp)
+.Lf1_163:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_162
+.Lf1_160:
+    addq $8, %rsp
+    .loc 1 209 5
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_201
+    jmp .Lf1_200
+.Lf1_201:
+    cmpl $68, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_200:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_202
+    .loc 1 210 9
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $34, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -36(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_204
+    jmp .Lf1_203
+.Lf1_204:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_203:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 211 9
+    movq $51, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 212 9
+    movslq -8(%rbp), %rax
+    subq $95, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $70, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_199
+.Lf1_202:
+    .loc 1 214 9
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -80(%rbp)
+    .loc 1 215 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_208
+    jmp .Lf1_209
+.Lf1_208:
+    movq $32, %rax
+    jmp .Lf1_210
+.Lf1_209:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf1_210:
+    cmpq $0, %rax
+    jne .Lf1_205
+    jmp .Lf1_206
+.Lf1_205:
+    movslq -8(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_207
+.Lf1_206:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_207:
+    push %rax
+    movq $88, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_211
+.Lf1_212:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_213
+    jmp .Lf1_214
+.Lf1_213:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf1_215
+.Lf1_214:
+    movslq -12(%rbp), %rax
+.Lf1_215:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_211:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 216 9
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_218
+.Lf1_217:
+    movq $61, %rax
+.Lf1_218:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_220
+    jmp .Lf1_219
+.Lf1_220:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_219:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_199:
+    .loc 1 218 5
+    movq $44, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $13, %rax
+    cmpq $0, %rax
+    jne .Lf1_222
+    jmp .Lf1_223
+.Lf1_222:
+    movslq -44(%rbp), %rax
+    jmp .Lf1_224
+.Lf1_223:
+    movq $54, %rax
+.Lf1_224:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_226
+    jmp .Lf1_225
+.Lf1_226:
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_225:
+    cmpq $0, %rax
+    je .Lf1_227
+    .loc 1 219 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_228
+    jmp .Lf1_229
+.Lf1_228:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_230
+.Lf1_229:
+    movslq -16(%rbp), %rax
+.Lf1_230:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_232
+    jmp .Lf1_231
+.Lf1_232:
+    movq $6, %rax
+    push %rax
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_234
+    jmp .Lf1_233
+.Lf1_234:
+    movq $61, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_233:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_231:
+    movl %eax, -12(%rbp)
+    .loc 1 220 9
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_236
+    jmp .Lf1_235
+.Lf1_236:
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_235:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 221 9
+    movq $3, %rax
+    push %rax
+    movq $80, %rax
+    imulq $66, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_238
+    jmp .Lf1_237
+.Lf1_238:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_237:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_221
+.Lf1_227:
+    .loc 1 223 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_240
+    jmp .Lf1_239
+.Lf1_240:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_239:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_242
+    jmp .Lf1_241
+.Lf1_242:
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf1_243
+    jmp .Lf1_244
+.Lf1_243:
+    movq $85, %rax
+    jmp .Lf1_245
+.Lf1_244:
+    movslq -12(%rbp), %rax
+.Lf1_245:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_241:
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $88, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 224 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_247
+    jmp .Lf1_246
+.Lf1_247:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_246:
+    push %rax
+    cmpl $16, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $12, %rax
+    addl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 225 9
+    movslq -12(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $55, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $66, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_221:
+    .loc 1 227 5
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 229 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 230 5
+    subq $8, %rsp
+    movq $30, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 231 5
+    movq $9, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 232 5
+    subq $8, %rsp
+    movq $60, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 233 5
+    movq $7, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 234 5
+    subq $64, %rsp
+    .loc 1 235 5
+    subq $256, %rsp
+    .loc 1 236 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_6
+    .p2align 4,,10
+.Lf2_5:
+    .loc 1 237 9
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_7
+    jmp .Lf2_8
+.Lf2_7:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_9
+.Lf2_8:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_10
+    jmp .Lf2_11
+.Lf2_10:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_12
+.Lf2_11:
+    movq $16, %rax
+.Lf2_12:
+.Lf2_9:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_13
+    jmp .Lf2_14
+.Lf2_13:
+    movslq -48(%rbp), %rax
+    jmp .Lf2_15
+.Lf2_14:
+    movslq -4(%rbp), %rax
+.Lf2_15:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 238 9
+    movq $53, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_20
+    jmp .Lf2_19
+.Lf2_20:
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_19:
+    cmpq $0, %rax
+    jne .Lf2_16
+    jmp .Lf2_17
+.Lf2_16:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_22
+    jmp .Lf2_21
+.Lf2_22:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_21:
+    push %rax
+    movq $98, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_18
+.Lf2_17:
+    movslq -12(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_18:
+    movl %eax, -4(%rbp)
+    .loc 1 240 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 241 13
+    .p2align 4,,10
+.Lf2_25:
+    .loc 1 242 17
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 243 17
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 244 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_29
+    jmp .Lf2_30
+.Lf2_29:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_31
+.Lf2_30:
+    movq $22, %rax
+.Lf2_31:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_33
+    jmp .Lf2_32
+.Lf2_33:
+    cmpl $64, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_32:
+    cmpq $0, %rax
+    jne .Lf2_26
+    jmp .Lf2_27
+.Lf2_26:
+    movq $51, %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $29, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_28
+.Lf2_27:
+    movq $94, %rax
+    addq $21, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_28:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 245 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_24:
+    .loc 1 246 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_25
+.Lf2_23:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_4:
+    .loc 1 236 30
+    incl -340(%rbp)
+.Lf2_6:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_5
+.Lf2_3:
+    addq $8, %rsp
+    .loc 1 249 5
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_35
+    jmp .Lf2_36
+.Lf2_35:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf2_37
+.Lf2_36:
+    movslq -4(%rbp), %rax
+.Lf2_37:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_39
+    jmp .Lf2_38
+.Lf2_39:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_38:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_40
+    .loc 1 250 9
+    cmpl $0, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_41
+    jmp .Lf2_42
+.Lf2_41:
+    movslq -72(%rbp), %rax
+    jmp .Lf2_43
+.Lf2_42:
+    movslq -4(%rbp), %rax
+.Lf2_43:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_44
+    jmp .Lf2_45
+.Lf2_44:
+    movq $78, %rax
+    jmp .Lf2_46
+.Lf2_45:
+    movslq -16(%rbp), %rax
+.Lf2_46:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_48
+    jmp .Lf2_47
+.Lf2_48:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_47:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 251 9
+    movslq -8(%rbp), %rax
+    addq $11, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_53
+    jmp .Lf2_52
+.Lf2_53:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_52:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_49
+    jmp .Lf2_50
+.Lf2_49:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_54
+    jmp .Lf2_55
+.Lf2_54:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_57
+    jmp .Lf2_58
+.Lf2_57:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_59
+.Lf2_58:
+    movslq -8(%rbp), %rax
+.Lf2_59:
+    jmp .Lf2_56
+.Lf2_55:
+    cmpl $28, -40(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf2_56:
+    jmp .Lf2_51
+.Lf2_50:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $58, %rax
+    cmpq $0, %rax
+    jne .Lf2_60
+    jmp .Lf2_61
+.Lf2_60:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_62
+.Lf2_61:
+    movq $76, %rax
+.Lf2_62:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_51:
+    movl %eax, -16(%rbp)
+    .loc 1 252 9
+    movq $86, %rax
+    cmpq $0, %rax
+    jne .Lf2_63
+    jmp .Lf2_64
+.Lf2_63:
+    movq $79, %rax
+    jmp .Lf2_65
+.Lf2_64:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf2_65:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_66
+    jmp .Lf2_67
+.Lf2_66:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_68
+.Lf2_67:
+    movslq -4(%rbp), %rax
+.Lf2_68:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_34
+.Lf2_40:
+    .loc 1 254 9
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_70
+    jmp .Lf2_69
+.Lf2_70:
+    cmpl $22, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_69:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_72
+    jmp .Lf2_71
+.Lf2_72:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_73
+    jmp .Lf2_74
+.Lf2_73:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_75
+.Lf2_74:
+    movq $10, %rax
+.Lf2_75:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_71:
+    movl %eax, -16(%rbp)
+    .loc 1 255 9
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_76
+    jmp .Lf2_77
+.Lf2_76:
+    movq $51, %rax
+    jmp .Lf2_78
+.Lf2_77:
+    movslq -8(%rbp), %rax
+.Lf2_78:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 256 9
+    movq $25, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_80
+    jmp .Lf2_79
+.Lf2_80:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_79:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_82
+.Lf2_81:
+    movslq -80(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_83
+.Lf2_82:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_83:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_34:
+    .loc 1 258 5
+    movq $3, %rax
+    push %rax
+    movq $78, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_85
+    jmp .Lf2_84
+.Lf2_85:
+    cmpl $80, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_84:
+    push %rax
+    movq $54, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 259 5
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_87
+    jmp .Lf2_88
+.Lf2_87:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_89
+.Lf2_88:
+    movslq -12(%rbp), %rax
+.Lf2_89:
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_91
+    jmp .Lf2_90
+.Lf2_91:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_90:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_92
+    .loc 1 260 9
+    movq $4, %rax
+    push %rax
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_97
+    jmp .Lf2_96
+.Lf2_97:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_96:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_93
+    jmp .Lf2_94
+.Lf2_93:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_95
+.Lf2_94:
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_95:
+    movl %eax, -16(%rbp)
+    .loc 1 261 9
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_98
+    jmp .Lf2_99
+.Lf2_98:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_100
+.Lf2_99:
+    movq $66, %rax
+.Lf2_100:
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_102
+    jmp .Lf2_101
+.Lf2_102:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_101:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 262 9
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $94, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_86
+.Lf2_92:
+    .loc 1 264 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_103
+    jmp .Lf2_104
+.Lf2_103:
+    movq $34, %rax
+    jmp .Lf2_105
+.Lf2_104:
+    movslq -8(%rbp), %rax
+.Lf2_105:
+    push %rax
+    movq $45, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $99, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_107
+    jmp .Lf2_106
+.Lf2_107:
+    movslq -44(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_106:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 265 9
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_109
+    jmp .Lf2_108
+.Lf2_109:
+    movq $6, %rax
+    push %rax
+    movq $66, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_108:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_111
+    jmp .Lf2_110
+.Lf2_111:
+    movq $8, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_110:
+    movl %eax, -4(%rbp)
+    .loc 1 266 9
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    imulq $82, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $39, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_112
+    jmp .Lf2_113
+.Lf2_112:
+    movslq -28(%rbp), %rax
+    jmp .Lf2_114
+.Lf2_113:
+    movq $46, %rax
+.Lf2_114:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_86:
+    .loc 1 268 5
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_117
+    jmp .Lf2_116
+.Lf2_117:
+    cmpl $39, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_116:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_118
+    .loc 1 269 9
+    movq $5, %rax
+    push %rax
+    movq $57, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_119
+    jmp .Lf2_120
+.Lf2_119:
+    movslq -8(%rbp), %rax
+    imulq $22, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_121
+.Lf2_120:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $87, %rax
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_123
+.Lf2_122:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_124
+.Lf2_123:
+    movslq -4(%rbp), %rax
+.Lf2_124:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_121:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 270 9
+    movq $6, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $93, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    imulq $71, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 271 9
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_129
+.Lf2_128:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_130
+.Lf2_129:
+    movslq -40(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_130:
+    cmpq $0, %rax
+    jne .Lf2_125
+    jmp .Lf2_126
+.Lf2_125:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_132
+    jmp .Lf2_131
+.Lf2_132:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_131:
+    push %rax
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf2_133
+    jmp .Lf2_134
+.Lf2_133:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_135
+.Lf2_134:
+    movq $73, %rax
+.Lf2_135:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_127
+.Lf2_126:
+    movslq -48(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_137
+    jmp .Lf2_136
+.Lf2_137:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_138
+    jmp .Lf2_139
+.Lf2_138:
+    movq $70, %rax
+    jmp .Lf2_140
+.Lf2_139:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf2_140:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_136:
+.Lf2_127:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_115
+.Lf2_118:
+    .loc 1 273 9
+    movq $3, %rax
+    push %rax
+    movq $47, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_141
+    jmp .Lf2_142
+.Lf2_141:
+    movq $4, %rax
+    push %rax
+    movq $55, %rax
+    cmpq $8, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_143
+.Lf2_142:
+    movq $62, %rax
+    cmpq $42, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_145
+    jmp .Lf2_144
+.Lf2_145:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_144:
+.Lf2_143:
+    movl %eax, -16(%rbp)
+    .loc 1 274 9
+    movq $5, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $57, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 275 9
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_146
+    jmp .Lf2_147
+.Lf2_146:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_148
+.Lf2_147:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_148:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_115:
+    .loc 1 278 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 279 9
+    .p2align 4,,10
+.Lf2_151:
+    .loc 1 280 13
+    cmpl $89, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $76, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_152
+    jmp .Lf2_149
+.Lf2_152:
+    .loc 1 281 13
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_154
+    jmp .Lf2_153
+.Lf2_154:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_155
+    jmp .Lf2_156
+.Lf2_155:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_157
+.Lf2_156:
+    movslq -4(%rbp), %rax
+.Lf2_157:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_153:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_159
+    jmp .Lf2_158
+.Lf2_159:
+    movslq -340(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_158:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 282 13
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_161
+    jmp .Lf2_160
+.Lf2_161:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_160:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_163
+    jmp .Lf2_162
+.Lf2_163:
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_165
+    jmp .Lf2_164
+.Lf2_165:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_164:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_162:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_166
+    jmp .Lf2_167
+.Lf2_166:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_168
+.Lf2_167:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_169
+    jmp .Lf2_170
+.Lf2_169:
+    movq $38, %rax
+    jmp .Lf2_171
+.Lf2_170:
+    movslq -8(%rbp), %rax
+.Lf2_171:
+.Lf2_168:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 284 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 285 17
+    .p2align 4,,10
+.Lf2_174:
+    .loc 1 286 21
+    movslq -340(%rbp), %rax
+    imulq $19, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_176
+    jmp .Lf2_175
+.Lf2_176:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_178
+    jmp .Lf2_177
+.Lf2_178:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_177:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_180
+    jmp .Lf2_179
+.Lf2_180:
+    movq $4, %rax
+    push %rax
+    movq $68, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_179:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_175:
+    movl %eax, -8(%rbp)
+    .loc 1 287 21
+    movq $2, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_182
+    jmp .Lf2_181
+.Lf2_182:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_181:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_184
+    jmp .Lf2_183
+.Lf2_184:
+    movslq -40(%rbp), %rax
+    subq $79, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_183:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 288 21
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    subq $6, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 289 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_173:
+    .loc 1 290 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_174
+.Lf2_172:
+    addq $0, %rsp
+    .loc 1 292 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_150:
+    .loc 1 293 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_151
+.Lf2_149:
+    addq $8, %rsp
+    .loc 1 296 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 297 9
+    jmp .Lf2_188
+    .p2align 4,,10
+.Lf2_187:
+    .loc 1 298 13
+    movq $88, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $87, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_190
+    jmp .Lf2_189
+.Lf2_190:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_189:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 299 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_196
+    .p2align 4,,10
+.Lf2_195:
+    .loc 1 300 17
+    movslq -340(%rbp), %rax
+    subq $2, %rax
+    movslq %eax, %rax
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_197
+    jmp .Lf2_193
+.Lf2_197:
+    .loc 1 301 17
+    movq $49, %rax
+    cmpq $0, %rax
+    jne .Lf2_198
+    jmp .Lf2_199
+.Lf2_198:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_200
+.Lf2_199:
+    movslq -40(%rbp), %rax
+.Lf2_200:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_202
+    jmp .Lf2_201
+.Lf2_202:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_201:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    cmpl $14, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 302 17
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_203
+    jmp .Lf2_204
+.Lf2_203:
+    cmpl $80, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_205
+.Lf2_204:
+    movq $3, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_205:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_206
+    jmp .Lf2_207
+.Lf2_206:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf2_208
+.Lf2_207:
+    movq $23, %rax
+.Lf2_208:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_210
+    jmp .Lf2_209
+.Lf2_210:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    addq $90, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_209:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 303 17
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $62, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_212
+    jmp .Lf2_211
+.Lf2_212:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_214
+    jmp .Lf2_213
+.Lf2_214:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_213:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_211:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_194:
+    .loc 1 299 38
+    incl -344(%rbp)
+.Lf2_196:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_195
+.Lf2_193:
+    addq $0, %rsp
+    .loc 1 305 13
+    movq $18, %rax
+    cmpq $64, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    subl -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 306 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_186:
+.Lf2_188:
+    .loc 1 297 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_187
+.Lf2_185:
+    addq $8, %rsp
+    .loc 1 309 5
+    movq $90, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_219
+    jmp .Lf2_220
+.Lf2_219:
+    movq $93, %rax
+    jmp .Lf2_221
+.Lf2_220:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf2_221:
+    cmpq $0, %rax
+    jne .Lf2_216
+    jmp .Lf2_217
+.Lf2_216:
+    movq $22, %rax
+    cmpq $61, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_218
+.Lf2_217:
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_223
+    jmp .Lf2_222
+.Lf2_223:
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_222:
+.Lf2_218:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf2_224
+    .loc 1 310 9
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $25, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_225
+    jmp .Lf2_226
+.Lf2_225:
+    movq $68, %rax
+    jmp .Lf2_227
+.Lf2_226:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf2_227:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 311 9
+    movq $5, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $29, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_229
+    jmp .Lf2_228
+.Lf2_229:
+    movq $8, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_228:
+    movl %eax, -16(%rbp)
+    .loc 1 312 9
+    movslq -8(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    subq $52, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_231
+    jmp .Lf2_230
+.Lf2_231:
+    movq $27, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $24, %rax
+    addq $53, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_230:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_215
+.Lf2_224:
+    .loc 1 314 9
+    movq $8, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 315 9
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_233
+    jmp .Lf2_232
+.Lf2_233:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_234
+    jmp .Lf2_235
+.Lf2_234:
+    movq $69, %rax
+    jmp .Lf2_236
+.Lf2_235:
+    movq $30, %rax
+.Lf2_236:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_232:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_238
+    jmp .Lf2_237
+.Lf2_238:
+    movq $9, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_237:
+    movl %eax, -4(%rbp)
+    .loc 1 316 9
+    movq $3, %rax
+    push %rax
+    movq $93, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $21, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_215:
+    .loc 1 318 5
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_240
+    jmp .Lf2_241
+.Lf2_240:
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_242
+.Lf2_241:
+    movslq -16(%rbp), %rax
+    imulq $12, %rax
+    movslq %eax, %rax
+.Lf2_242:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_244
+    jmp .Lf2_243
+.Lf2_244:
+    movq $3, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_246
+    jmp .Lf2_245
+.Lf2_246:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_245:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_243:
+    cmpq $0, %rax
+    je .Lf2_247
+    .loc 1 319 9
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_248
+    jmp .Lf2_249
+.Lf2_248:
+    movslq -4(%rbp), %rax
+    subq $30, %rax
+    movslq %eax, %rax
+    jmp .Lf2_250
+.Lf2_249:
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_250:
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $11, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 320 9
+    movq $2, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_252
+    jmp .Lf2_251
+.Lf2_252:
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_251:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_254
+    jmp .Lf2_253
+.Lf2_254:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_256
+    jmp .Lf2_255
+.Lf2_256:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_255:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_253:
+    movl %eax, -16(%rbp)
+    .loc 1 321 9
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_239
+.Lf2_247:
+    .loc 1 323 9
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_258
+    jmp .Lf2_257
+.Lf2_258:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_257:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_260
+    jmp .Lf2_259
+.Lf2_260:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_261
+    jmp .Lf2_262
+.Lf2_261:
+    movq $5, %rax
+    jmp .Lf2_263
+.Lf2_262:
+    movslq -8(%rbp), %rax
+.Lf2_263:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_265
+    jmp .Lf2_264
+.Lf2_265:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_266
+    jmp .Lf2_267
+.Lf2_266:
+    movq $22, %rax
+    jmp .Lf2_268
+.Lf2_267:
+    movslq -4(%rbp), %rax
+.Lf2_268:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_264:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_259:
+    movl %eax, -8(%rbp)
+    .loc 1 324 9
+    movq $1, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_269
+    jmp .Lf2_270
+.Lf2_269:
+    movslq -60(%rbp), %rax
+    jmp .Lf2_271
+.Lf2_270:
+    movslq -4(%rbp), %rax
+.Lf2_271:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 325 9
+    movq $4, %rax
+    push %rax
+    movq $50, %rax
+    cmpq $20, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_239:
+    .loc 1 327 5
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    cmpq $37, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 328 5
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_273
+    jmp .Lf2_272
+.Lf2_273:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_272:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_275
+    jmp .Lf2_274
+.Lf2_275:
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_277
+    jmp .Lf2_276
+.Lf2_277:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_276:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_274:
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
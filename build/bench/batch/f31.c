@@ -0,0 +1,419 @@
+int f0() {
+    int v0 = 35;
+    int v1 = 63;
+    int v2 = 13;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a0[15] = (((a0[9] >= i0) + (i0 >= i0)) <= ((16 >= a1[2][13]) >= (v3 > a0[13])));
+        v2 = (((i0 == a0[0]) >= (a0[3] * v0)) > ((v2 * v0) < (a1[1][4] && 8)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v0 = (((v3 / 9) % 4) ? ((a1[3][1] - i1) >= (v3 && v0)) : ((a0[14] - v1) != (i0 % 7)));
+            a0[2] = (((v1 >= 5) || (v3 ? 50 : v0)) % 3);
+            v0 = (((a1[2][10] ? v3 : v1) <= (65 - i0)) ? ((i0 % 1) < (a0[0] ? 35 : i1)) : ((v2 > v2) == (i0 ? v3 : v1)));
+        }
+    }
+    if ((((v1 && a0[15]) && (v1 && a0[4])) < ((21 <= 4) != (v3 / 4)))) {
+        v1 = (((71 + a1[2][1]) >= (a1[0][6] && v3)) && ((a0[2] < v3) != (a0[0] ? a1[2][5] : 6)));
+        a0[14] = (((38 || a1[2][0]) ? (48 || v0) : (v1 ? v3 : a0[11])) && ((73 * a0[15]) < (v2 ? v1 : 12)));
+        v0 = (((v2 + v2) < (23 + 21)) >= ((19 > a0[6]) || (v0 != a1[1][11])));
+    } else {
+        v2 = (((65 != 39) == (v0 * v0)) || ((a1[3][10] || a1[1][4]) != (v1 == a0[15])));
+        a0[12] = (((v2 && v1) < (v0 == v0)) * ((v1 && v3) <= (26 - a1[3][5])));
+        a1[0][11] = (((v0 && 64) % 4) == ((a0[4] >= v3) > (v1 || v0)));
+    }
+    if ((((v0 != v0) ? (v2 / 9) : (v2 == a0[7])) != ((1 >= 37) <= (v3 != a1[2][6])))) {
+        a1[1][2] = (((v3 <= a0[14]) == (62 - a1[2][5])) ? ((a0[1] * a1[0][3]) && (a1[1][4] - 11)) : ((v2 < v0) != (a0[10] / 6)));
+        a0[4] = (((a0[8] + 61) <= (87 > 63)) % 1);
+        v0 = (((14 || v3) ? (v0 * v3) : (a0[8] > 72)) / 3);
+    } else {
+        v0 = (((a0[4] / 1) > (v3 % 9)) != ((a0[11] <= v1) == (45 > 69)));
+        a0[0] = (((v2 && v2) + (v0 * a0[10])) != ((v2 % 1) && (v0 < v2)));
+        v1 = (((v0 && a1[0][3]) ? (88 * v3) : (a0[6] / 8)) < ((97 >= a0[12]) <= (80 + 29)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a1[0][9] = (((v1 + i2) % 9) && ((a0[12] > v0) <= (i2 ? 41 : a1[1][6])));
+            a1[0][14] = (((v0 ? i2 : 79) <= (30 % 4)) ? ((39 != a1[3][11]) > (v3 <= v1)) : ((28 * i2) || (a1[0][6] - 66)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v0 = (((i3 ? v0 : v0) <= (12 == i3)) * ((v0 + a0[8]) / 3));
+                    a1[3][12] = (((a0[7] != i3) || (i3 >= a1[3][0])) + ((v3 != a0[4]) <= (v3 * a0[0])));
+                    v3 = (((i2 + a1[2][8]) >= (i3 != v2)) == ((v1 + i3) && (v0 <= 25)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v0 - 98) ? (v2 != v3) : (v0 ? 4 : 58)) ? ((49 * 98) || (a1[1][13] || v3)) : ((a0[4] || 47) ? (a1[3][13] * a0[15]) : (v2 / 2)));
+    if ((((v0 * v0) != (v1 + a0[15])) || ((a1[2][1] ? a1[2][7] : v0) != (46 || v0)))) {
+        v1 = (((v3 > a0[0]) != (22 ? v0 : v3)) == ((24 % 8) >= (v0 > v3)));
+        v0 = (((v0 >= v1) <= (97 || v2)) && ((11 <= 85) % 5));
+        a0[11] = (((43 % 2) + (a1[0][11] + 2)) ? ((a1[0][10] ? v0 : a1[0][15]) ? (73 ? v1 : a0[15]) : (v3 + 27)) : ((v0 >= a1[0][3]) <= (0 != v2)));
+    } else {
+        v0 = (((v0 ? 91 : v3) % 7) / 8);
+        v1 = (((99 + v3) == (a0[10] % 4)) >= ((v0 <= 32) < (69 % 2)));
+        a1[1][8] = (((37 == 66) - (v3 >= v2)) != ((v2 ? a0[15] : v2) >= (70 ? v0 : 89)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v0 = (((a1[3][7] - 32) >= (26 ? 34 : a0[9])) < ((v2 > v3) < (v1 * 8)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                if ((v2 / 8) > 65) break;
+                a0[12] = (((a0[5] * a1[0][10]) && (v2 == i4)) ? ((i4 && 76) < (a0[8] / 3)) : ((a0[9] + 2) && (v0 / 6)));
+                v3 = (((a1[0][0] && v1) < (v1 < 41)) <= ((5 <= 40) <= (v3 <= v2)));
+                a1[0][10] = (((v2 * v2) - (28 * 43)) || ((a1[2][1] * a1[1][9]) + (i4 > i5)));
+            }
+            a1[0][1] = (((v0 ? v0 : i4) ? (i4 <= v1) : (v2 / 6)) && ((96 >= 28) == (v3 ? a0[6] : v2)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        v2 = (((a1[0][1] >= v1) ? (v0 >= v3) : (a0[2] != v3)) * ((42 ? 88 : v1) <= (v0 * a0[4])));
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            v2 = (((28 + a0[1]) ? (a1[1][8] - v2) : (56 + 40)) - ((97 >= i6) <= (a0[12] * a1[1][1])));
+            v1 = (((49 > a1[0][0]) * (v3 / 9)) && ((a1[3][1] && v1) - (v3 < i7)));
+            a0[9] = (((0 == i6) != (v3 >= i6)) && ((i7 % 7) + (a0[7] ? a0[9] : 47)));
+        }
+        a1[3][6] = (((v3 % 4) && (a1[0][5] < v3)) - ((v1 && i6) < (14 ? v0 : v0)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            if ((63 != v0) > 84) break;
+            v3 = (((v0 <= v3) / 7) > ((a1[0][8] && v3) && (v1 ? 66 : a0[11])));
+            a0[10] = (((v3 <= 61) + (76 + 31)) > ((a0[4] || i8) ? (28 > v2) : (82 > i8)));
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                a1[3][12] = (((i9 && i9) >= (35 < v3)) ? ((a1[3][0] * v0) ? (75 && i9) : (a1[3][13] < v3)) : ((i8 ? v1 : 51) >= (32 ? a1[0][8] : a1[3][3])));
+                v0 = (((v1 % 2) <= (a1[3][0] - v3)) < ((a1[0][3] % 8) ? (a1[3][2] >= 48) : (98 && 45)));
+                v1 = (((v3 < a0[13]) * (78 + 78)) ? ((88 - v0) || (a0[2] && v0)) : ((v0 <= v3) && (v1 <= i9)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    a1[2][5] = (((v2 != 17) ? (a1[1][10] < v1) : (v1 > a1[3][2])) == ((70 || a1[0][10]) > (v1 > a1[1][14])));
+    return (((v1 >= v0) / 4) == ((a1[1][7] / 2) - (a0[11] < v2)));
+}
+int f1() {
+    int v0 = 66;
+    int v1 = 93;
+    int v2 = 6;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[10] > a0[1]) && (v0 || 98)) != ((a1[2][14] && 76) / 2))) {
+        v0 = (((a0[14] == v0) < (v3 == a0[14])) < ((a0[8] < 81) % 2));
+        v0 = (((v1 % 1) * (a0[3] ? v3 : v1)) || ((v1 <= 44) != (v0 == v2)));
+        v2 = (((a1[3][3] && v1) < (v3 ? v2 : v0)) && ((42 ? v0 : a0[4]) * (v1 && 38)));
+    } else {
+        v2 = (((v2 || v2) > (76 < v2)) && ((a0[13] && 9) + (v1 < v2)));
+        a1[0][7] = (((59 + v0) >= (86 - v0)) < ((v1 == v3) / 9));
+        v2 = (((v2 && v0) % 9) * ((22 - a1[3][14]) ? (v1 < v0) : (72 > v2)));
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a0[0] = (((a0[7] || v2) || (a0[11] < a1[3][6])) ? ((a1[0][9] + v0) + (a1[0][13] < v1)) : ((v2 ? 80 : 96) - (v0 || v2)));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v1 = (((i1 * v3) >= (v0 / 8)) - ((91 * v3) ? (14 ? 23 : v2) : (63 != 57)));
+            v2 = (((v0 % 1) < (v0 - v2)) * ((a1[3][4] == i1) * (a0[12] <= 36)));
+            v2 = (((a0[10] > i0) * (83 == 1)) ? ((v3 != i0) % 4) : ((a1[1][0] > a0[9]) ? (7 <= a1[1][13]) : (69 && 66)));
+        }
+        v3 = (((a1[3][5] && v0) * (v2 && v2)) / 1);
+    }
+    if ((((v1 == v3) + (v3 != 53)) ? ((42 ? a0[10] : 61) <= (v0 - v1)) : ((63 + a0[13]) || (a0[4] && a1[3][7])))) {
+        v2 = (((v1 / 2) >= (a0[3] * v0)) != ((21 ? a1[1][13] : 35) / 9));
+        v1 = (((v1 % 8) || (a1[1][13] >= 8)) > ((v3 != 33) ? (v2 * v3) : (v2 < v2)));
+        a1[0][5] = (((v3 <= a1[3][10]) >= (a1[0][9] ? 76 : v1)) / 7);
+    } else {
+        a0[1] = (((v2 || v0) - (a1[3][13] / 1)) <= ((a1[3][8] || v3) / 2));
+        v0 = (((v2 || v3) ? (v2 % 9) : (a1[3][14] && v2)) || ((v0 || a1[2][0]) + (v3 * 72)));
+        a1[0][12] = (((v3 - a0[2]) && (35 && 86)) / 8);
+    }
+    v1 = (((a0[6] % 8) != (v1 ? 84 : 4)) ? ((v1 || a0[3]) / 4) : ((v2 != v3) < (v2 == v1)));
+    if ((((v3 && 70) - (35 <= a0[14])) >= ((v3 + v0) ? (v2 + v3) : (7 < a1[0][8])))) {
+        a0[15] = (((v0 > 90) != (v1 > a0[15])) >= ((30 ? v1 : a0[5]) - (v2 < v0)));
+        v3 = (((a0[0] || v1) < (48 - 38)) != ((a0[12] == a1[3][13]) - (v1 ? v2 : v2)));
+        v3 = (((v3 >= v1) ? (v1 && v2) : (a1[0][13] % 3)) + ((v3 <= 7) || (a0[15] ? v3 : a1[2][7])));
+    } else {
+        v2 = (((a0[9] % 6) ? (v0 || v0) : (77 == v0)) - ((v0 || a1[1][15]) != (6 != v2)));
+        v0 = (((55 > 53) != (v2 % 4)) >= ((v2 / 9) ? (v1 - a1[1][13]) : (32 <= v3)));
+        v0 = (((32 && v0) == (86 + a1[0][1])) * ((a1[0][8] - v1) ? (97 <= v3) : (a0[15] != v1)));
+    }
+    if ((((v0 + 2) + (46 * 84)) - ((a0[0] == a0[0]) <= (v1 ? v3 : v2)))) {
+        v3 = (((v0 == 1) <= (v3 == a1[1][4])) && ((v1 < a1[0][4]) / 2));
+        v3 = (((89 > v1) <= (v1 && v0)) ? ((41 == v1) / 3) : ((a0[4] + a1[3][1]) && (82 / 2)));
+        a1[1][0] = (((v0 || 99) >= (83 == v3)) >= ((v1 % 2) && (a0[2] ? v2 : 30)));
+    } else {
+        v1 = (((v1 && v2) * (v2 % 2)) > ((51 % 3) >= (v3 == v1)));
+        a1[0][1] = (((v1 ? 76 : v1) - (47 > v2)) - ((v3 >= 51) == (a1[0][7] * a1[0][12])));
+        a0[7] = (((v1 % 9) <= (v0 / 4)) == ((a1[0][4] % 7) % 6));
+    }
+    v0 = (((31 * 37) * (a0[13] > a1[2][3])) < ((a0[13] ? v1 : a0[5]) < (v0 * 79)));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((a0[4] + v0) > 67) break;
+        v1 = (((v3 <= 67) % 3) * ((3 && 88) ? (a1[0][9] != v1) : (a1[2][8] ? 34 : 69)));
+        v3 = (((a0[9] / 4) ? (a0[2] ? 88 : v3) : (a0[15] + i2)) && ((a0[10] && a1[2][15]) ? (i2 + 95) : (v1 <= i2)));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v1 = (((v3 || 90) != (v0 || 64)) < ((14 + i2) || (a0[10] != 70)));
+                v0 = (((v1 >= a1[0][0]) && (a1[3][5] - v1)) + ((v0 && v1) >= (v1 != 72)));
+                v2 = (((v2 ? a1[3][8] : 64) <= (64 < v3)) - ((a1[3][8] == a0[8]) != (v1 - 59)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v2 = (((a1[2][2] != 53) <= (v3 == v3)) / 5);
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    a1[1][0] = (((a0[8] == 68) || (86 == i5)) ? ((42 - 9) / 5) : ((v1 > v2) < (a1[3][11] || a1[1][12])));
+                    v0 = (((78 * v3) * (i4 / 3)) / 9);
+                    v3 = (((a1[0][1] ? v2 : a0[11]) == (v2 > 94)) != ((a0[14] + i4) && (v0 || 90)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((a1[2][1] / 9) < (v1 < a0[8])) - ((9 - v2) >= (a0[8] - 3)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            if ((88 > v3) > 93) break;
+            v1 = (((v3 + 64) <= (a1[0][6] / 6)) < ((v3 ? v0 : 14) % 8));
+            a1[1][0] = (((v3 ? 93 : 62) ? (i6 >= a0[4]) : (73 || v2)) || ((v0 < a1[3][15]) > (44 < 99)));
+            {
+                int i7 = 0;
+                do {
+                    v3 = (((a0[4] / 2) % 9) == ((v1 || v1) / 5));
+                    a1[2][13] = (((80 ? v2 : a1[1][7]) <= (38 ? v0 : a1[1][4])) > ((v1 > v1) && (v3 == 57)));
+                    v2 = (((a1[1][9] || v0) && (14 && a1[0][3])) / 1);
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((31 && v1) <= (v0 < 47)) - ((92 < 2) || (v0 + 44)));
+}
+int f2() {
+    int v0 = 11;
+    int v1 = 64;
+    int v2 = 76;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    a1[2][6] = (((v3 < 18) ? (v0 / 1) : (a0[5] - a1[0][11])) - ((a0[4] == v2) || (a0[11] != a0[11])));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a0[0] = (((72 / 4) * (i0 < a1[2][14])) < ((95 % 7) ? (v1 == 1) : (v1 > i0)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((a1[3][8] && i1) > 65) break;
+                a0[13] = (((a0[14] < v1) || (a1[0][2] * i1)) == ((v3 ? a0[0] : 60) / 2));
+                v3 = (((a0[14] == v1) % 1) * ((v1 - 71) == (v2 % 1)));
+                a1[0][7] = (((a0[10] - a1[0][13]) < (v2 == v2)) != ((i0 * v1) >= (i1 && a0[4])));
+            }
+            a1[0][4] = (((a1[0][9] && v2) > (a0[14] ? v1 : a1[0][13])) - ((a0[0] - v1) - (a0[7] + v0)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 != a1[2][6]) * (63 % 7)) / 8)) {
+        v2 = (((v0 % 1) / 1) || ((v0 > v3) < (v3 ? a0[3] : v3)));
+        a1[0][11] = (((58 > a1[1][15]) != (74 / 3)) <= ((v1 / 5) <= (a1[0][1] > 17)));
+        a0[1] = (((a1[1][0] ? a0[4] : 43) - (v3 < a1[0][5])) == ((a1[2][15] > 43) > (a1[1][7] ? 4 : 64)));
+    } else {
+        a1[1][2] = (((v0 >= v0) && (v1 || v2)) ? ((v2 * v1) / 2) : ((a1[0][8] > a0[9]) / 9));
+        v3 = (((v3 || 36) == (v2 ? 11 : a1[2][0])) - ((v1 * v1) % 3));
+        v2 = (((a0[0] >= v2) < (v3 ? 0 : v1)) >= ((79 != v1) ? (a1[3][10] * 59) : (v2 < 86)));
+    }
+    a1[3][2] = (((16 - v3) > (77 > 46)) || ((v2 && 63) || (v3 - a0[14])));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v3 = (((a0[5] < i2) <= (v3 >= v3)) ? ((i2 > a0[0]) ? (a0[4] <= 57) : (v2 != i3)) : ((i2 != 77) != (a0[11] == 23)));
+                v0 = (((a0[2] || a1[0][11]) % 6) ? ((a0[7] && 35) - (v1 ? i2 : i3)) : ((i2 > 96) >= (84 ? v1 : 3)));
+                v1 = (((v3 <= 46) && (96 % 2)) <= ((v3 + 32) - (70 <= a0[15])));
+            }
+            a0[15] = (((v0 ? v1 : 29) + (a0[9] < a1[2][11])) % 2);
+            v2 = (((38 / 6) ? (25 < v0) : (a0[8] ? a0[6] : i2)) <= ((v2 == 64) ? (59 / 7) : (a1[3][12] >= 44)));
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((v3 >= v0) / 2) / 8);
+    if ((((v1 + v1) + (a0[2] <= 87)) ? ((61 < a1[3][7]) + (a0[11] > v2)) : ((a0[3] || a1[0][14]) * (a0[14] / 9)))) {
+        v3 = (((12 >= v3) < (v1 >= 95)) * ((v0 && 92) && (v1 - 33)));
+        a1[2][14] = (((v1 >= a0[15]) < (v3 ? v3 : a1[3][11])) % 5);
+        a1[3][11] = (((a0[0] % 2) ? (42 ? v3 : a1[1][0]) : (49 * 66)) <= ((a1[1][5] / 8) - (a1[2][10] && 66)));
+    } else {
+        v2 = (((a0[4] == v0) + (46 || v1)) >= ((v3 || v0) * (a1[1][15] <= v1)));
+        v0 = (((v0 == v2) - (2 * a1[0][12])) + ((v1 ? v3 : v0) || (a1[1][13] || v1)));
+        v2 = (((a1[0][10] && v3) && (v0 ? v2 : a1[2][5])) == ((62 * a0[7]) || (v0 * a0[6])));
+    }
+    v3 = (((38 * v0) * (v3 ? v3 : a0[11])) ? ((88 == v1) <= (84 >= a0[6])) : ((75 > v0) == (v2 < v0)));
+    if ((((v3 * v1) / 9) + ((a1[1][8] * v3) != (v1 > v0)))) {
+        v3 = (((a1[0][15] - a1[2][11]) == (v2 - v2)) / 1);
+        v1 = (((42 && a1[3][3]) % 6) >= ((a1[0][6] % 4) == (v1 && 77)));
+        v2 = (((v2 == a1[1][10]) + (v1 + v3)) || ((a1[0][1] == v1) / 6));
+    } else {
+        v0 = (((v2 >= v0) != (v0 / 2)) || ((69 - v3) && (v2 != 91)));
+        a0[5] = (((49 >= 95) - (v0 <= v0)) * ((v0 > a1[0][5]) >= (a0[15] > a0[13])));
+        a1[1][11] = (((v3 && 7) >= (a0[7] <= v2)) > ((a1[1][7] || 85) > (65 || 89)));
+    }
+    if ((((a0[6] || v2) / 4) >= ((a0[15] && a1[0][5]) ? (45 * 59) : (a1[1][8] - 76)))) {
+        a1[1][1] = (((a1[0][10] <= 79) || (v0 - v1)) % 4);
+        v2 = (((3 && v0) - (v1 * a1[0][6])) < ((a1[1][4] || a0[3]) < (v1 >= v0)));
+        v0 = (((a1[1][12] * v0) * (18 ? v2 : v3)) * ((a0[0] / 9) || (21 > 96)));
+    } else {
+        a1[3][8] = (((v3 / 5) < (v3 < v2)) < ((v2 > a0[9]) || (a0[13] ? v0 : 63)));
+        v0 = (((v3 && 64) <= (68 && v3)) != ((a0[4] != a0[9]) * (v0 / 7)));
+        v2 = (((v0 < a1[3][6]) || (v0 >= v1)) / 6);
+    }
+    return (((v3 == 23) * (77 % 2)) - ((v3 % 2) > (a1[3][7] || v3)));
+}
+int f3() {
+    int v0 = 58;
+    int v1 = 66;
+    int v2 = 23;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((57 >= v0) < (v2 < a1[1][2])) ? ((86 ? v3 : a0[7]) || (v2 == v3)) : ((0 / 6) >= (51 ? v3 : a0[11])));
+    if ((((v3 <= 55) <= (17 * v0)) <= ((v0 ? v2 : v1) < (a1[0][2] || v3)))) {
+        v0 = (((v2 % 1) >= (v1 != 76)) >= ((94 * v2) > (93 ? v3 : 38)));
+        v3 = (((a0[5] || a0[2]) + (a1[0][4] ? v3 : 46)) ? ((a1[0][4] % 7) % 5) : ((a0[12] || v1) + (63 % 1)));
+        v2 = (((a0[13] % 2) < (26 ? 31 : 94)) ? ((a1[1][13] < v3) == (39 ? a1[1][12] : 8)) : ((82 != a1[3][9]) != (v1 || v0)));
+    } else {
+        v1 = (((v0 * v0) >= (a0[1] > v0)) - ((a0[11] * v2) > (v1 ? v2 : 60)));
+        a1[1][11] = (((a0[12] <= a0[10]) >= (87 / 1)) == ((a1[0][14] != v1) == (17 ? v0 : v0)));
+        v3 = (((10 % 4) <= (v2 == v3)) == ((a0[9] != 91) * (a0[2] - v1)));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                a1[2][9] = (((a0[1] || a1[2][2]) || (a1[3][12] >= v2)) >= ((a0[5] < i1) - (v2 - 62)));
+                v3 = (((a1[1][13] || v0) >= (a0[5] <= 75)) ? ((v0 && v0) % 8) : ((i0 ? i1 : i1) != (i0 == 67)));
+                v0 = (((55 + v3) != (a1[0][7] != 10)) % 2);
+                i1 = i1 + 1;
+            }
+        }
+        a0[9] = (((v1 / 5) ? (96 ? 98 : v1) : (v2 * v0)) * ((a0[3] + 94) < (51 ? i0 : v1)));
+        a1[2][12] = (((v0 / 2) && (a0[11] ? a0[6] : a1[1][13])) ? ((v0 && v1) + (a0[0] / 9)) : ((a0[1] % 3) < (v1 ? 0 : a1[2][10])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v3 = (((a0[9] ? 24 : v3) && (a1[0][3] + a0[2])) >= ((a1[1][1] < v2) > (i2 / 9)));
+            v0 = (((a1[0][7] == v0) - (v2 > v2)) > ((11 || v0) != (i2 / 2)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((i2 && i2) ? (i2 == v3) : (i2 == a1[1][15])) / 2);
+                    a1[2][11] = (((v1 <= v0) < (v0 > 1)) / 9);
+                    v2 = (((v3 < v2) < (a0[4] <= v3)) && ((1 + 63) + (v1 / 7)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            a1[1][9] = (((a0[2] > v0) != (a0[15] < v2)) / 7);
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v2 = (((v1 == v3) || (a0[2] - i4)) || ((v0 == 76) <= (v1 <= 75)));
+                a0[6] = (((v0 - a0[6]) && (59 ? a0[5] : v1)) != ((15 - v1) ? (v3 < v3) : (61 / 9)));
+                v1 = (((a0[7] >= a0[6]) && (a0[10] - a0[10])) % 9);
+            }
+            v0 = (((a0[5] || 2) ? (v1 >= 83) : (v2 % 1)) ? ((a0[11] && v3) - (v2 || 6)) : ((65 != a0[12]) % 3));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v3 = (((a1[3][11] >= v3) ? (v1 >= v0) : (v0 && v0)) < ((v1 == 99) || (58 == 82)));
+            v0 = (((a0[4] ? 19 : a1[3][14]) != (68 * v1)) >= ((v0 % 3) + (13 % 4)));
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    if ((v0 ? v2 : v1) > 73) break;
+                    v1 = (((v1 && v0) >= (a0[3] >= v1)) >= ((i6 ? 84 : a0[8]) ? (a1[0][2] - 10) : (v0 != a0[6])));
+                    v1 = (((43 > v1) / 5) % 1);
+                    v3 = (((a0[13] != i7) >= (v3 % 4)) != ((96 ? v3 : a1[3][0]) >= (v0 < v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a1[2][3] ? v1 : v0) ? (v0 + v2) : (a0[12] * a1[2][7])) - ((v3 || v3) ? (v1 >= v2) : (v1 >= 32)))) {
+        v3 = (((90 / 2) - (a0[8] % 8)) == ((54 || a1[2][11]) <= (91 ? v2 : 35)));
+        a0[0] = (((v3 || v0) - (v0 >= a1[1][0])) <= ((v1 + 1) < (v2 != v1)));
+        v3 = (((a1[0][3] > v1) % 5) / 9);
+    } else {
+        a0[7] = (((a0[1] - v3) > (87 >= 63)) != ((30 ? 80 : a0[3]) % 4));
+        a0[3] = (((v2 / 3) <= (83 > a0[15])) < ((v2 / 5) == (v0 == 65)));
+        v3 = (((v0 * a0[11]) && (33 < 48)) % 5);
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+            v1 = (((v1 != i9) || (i9 && 49)) >= ((i9 < 83) == (a0[7] == 89)));
+            v2 = (((v0 / 1) ? (24 % 9) : (i8 ? a1[0][2] : i8)) + ((i8 >= i9) ? (a0[0] % 5) : (v1 != 99)));
+            v2 = (((v2 ? a1[1][2] : v2) <= (i9 * a0[3])) >= ((v1 * a1[2][13]) || (30 >= a1[0][13])));
+        }
+        v1 = (((59 && 11) / 4) * ((i8 - v3) / 9));
+        v1 = (((v3 * 86) == (v0 ? v1 : 12)) > ((v1 && 76) / 3));
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        if ((v2 + 69) > 66) break;
+        v0 = (((v0 ? v0 : 48) + (a1[1][5] + v2)) % 1);
+        {
+            int i11 = 0;
+            while (i11 < 7) {
+                a0[14] = (((v1 > a1[2][5]) > (v3 % 6)) == ((i11 + a0[5]) != (41 <= i10)));
+                v1 = (((a0[3] || a0[3]) != (a1[1][5] / 9)) ? ((v2 * v0) == (i11 ? v2 : a0[6])) : ((a1[2][12] * v1) < (i11 != 68)));
+                a1[2][15] = (((a0[2] == 10) ? (v2 - v1) : (27 / 4)) <= ((v3 - v2) - (i11 == v0)));
+                i11 = i11 + 1;
+            }
+        }
+        v1 = (((a0[11] != 93) > (v0 > i10)) > ((i10 % 4) == (a0[4] <= 95)));
+    }
+    {
+        int i12 = 0;
+        while (i12 < 8) {
+            v3 = (((v0 * v3) >= (39 / 6)) + ((a1[2][4] ? 32 : 40) / 3));
+            v0 = (((v0 != i12) != (i12 > v3)) <= ((v3 ? v1 : a1[1][5]) ? (61 > v2) : (v0 + v1)));
+            {
+                int i13 = 0;
+                do {
+                    v3 = (((a0[8] > v1) > (0 || a0[11])) ? ((v2 / 2) + (88 % 6)) : ((i12 < a0[8]) <= (83 ? a0[6] : 34)));
+                    v1 = (((a0[1] <= 26) > (76 + i12)) != ((0 != a0[8]) >= (i12 ? 1 : v3)));
+                    v2 = (((94 / 2) <= (22 - 55)) * ((a1[1][0] ? v0 : i12) + (31 || v0)));
+                    i13 = i13 + 1;
+                } while (i13 < 8);
+            }
+            i12 = i12 + 1;
+        }
+    }
+    return (((v0 != v2) && (22 != v1)) || ((14 == v1) <= (a0[0] - v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
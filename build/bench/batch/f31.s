@@ -0,0 +1,10870 @@
+    .file 1 "build/bench/batch/f31.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 412 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 413 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 414 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 415 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 416 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 417 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 418 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $35, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $63, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $13, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $74, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_6
+    .p2align 4,,10
+.Lf0_5:
+    .loc 1 9 9
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $16, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -20(%rbp)
+    .loc 1 10 9
+    movslq -340(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -68(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 11 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_14
+    .p2align 4,,10
+.Lf0_13:
+    .loc 1 12 13
+    movq $4, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_15
+    jmp .Lf0_16
+.Lf0_15:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_19
+    jmp .Lf0_18
+.Lf0_19:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_18:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_17
+.Lf0_16:
+    movslq -24(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_17:
+    movl %eax, -4(%rbp)
+    .loc 1 13 13
+    movq $3, %rax
+    push %rax
+    cmpl $5, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_21
+    jmp .Lf0_20
+.Lf0_21:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_23
+.Lf0_22:
+    movq $50, %rax
+    jmp .Lf0_24
+.Lf0_23:
+    movslq -4(%rbp), %rax
+.Lf0_24:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_20:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 14 13
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_30
+.Lf0_29:
+    movslq -8(%rbp), %rax
+.Lf0_30:
+    push %rax
+    movq $65, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_25
+    jmp .Lf0_26
+.Lf0_25:
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_31
+    jmp .Lf0_32
+.Lf0_31:
+    movq $35, %rax
+    jmp .Lf0_33
+.Lf0_32:
+    movslq -344(%rbp), %rax
+.Lf0_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_34
+    jmp .Lf0_35
+.Lf0_34:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_36
+.Lf0_35:
+    movslq -8(%rbp), %rax
+.Lf0_36:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_27:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_12:
+    .loc 1 11 34
+    incl -344(%rbp)
+.Lf0_14:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_13
+.Lf0_11:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_4:
+    .loc 1 8 30
+    incl -340(%rbp)
+.Lf0_6:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_5
+.Lf0_3:
+    addq $8, %rsp
+    .loc 1 17 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_39
+    jmp .Lf0_38
+.Lf0_39:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_38:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_40
+.Lf0_41:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_43
+    jmp .Lf0_42
+.Lf0_43:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_42:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_40:
+    push %rax
+    movq $21, %rax
+    cmpq $4, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_44
+    .loc 1 18 9
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    addq $71, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_46
+    jmp .Lf0_45
+.Lf0_46:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_45:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_48
+    jmp .Lf0_47
+.Lf0_48:
+    movslq -72(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_49
+    jmp .Lf0_50
+.Lf0_49:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf0_51
+.Lf0_50:
+    movq $6, %rax
+.Lf0_51:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_47:
+    movl %eax, -8(%rbp)
+    .loc 1 19 9
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_56
+    jmp .Lf0_55
+.Lf0_56:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_55:
+    cmpq $0, %rax
+    jne .Lf0_52
+    jmp .Lf0_53
+.Lf0_52:
+    movq $48, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_58
+    jmp .Lf0_57
+.Lf0_58:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_57:
+    jmp .Lf0_54
+.Lf0_53:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_59
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -36(%rbp), %rax
+.Lf0_61:
+.Lf0_54:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_63
+    jmp .Lf0_62
+.Lf0_63:
+    movq $73, %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_64
+    jmp .Lf0_65
+.Lf0_64:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_66
+.Lf0_65:
+    movq $12, %rax
+.Lf0_66:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_62:
+    movl %eax, -24(%rbp)
+    .loc 1 20 9
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $23, %rax
+    addq $21, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $19, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_68
+    jmp .Lf0_67
+.Lf0_68:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_67:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_37
+.Lf0_44:
+    .loc 1 22 9
+    movq $65, %rax
+    cmpq $39, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_70
+    jmp .Lf0_69
+.Lf0_70:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_72
+    jmp .Lf0_71
+.Lf0_72:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_71:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_69:
+    movl %eax, -12(%rbp)
+    .loc 1 23 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_74
+    jmp .Lf0_73
+.Lf0_74:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_73:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_76
+    jmp .Lf0_75
+.Lf0_76:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_75:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    .loc 1 24 9
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_77
+.Lf0_78:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_77:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_80
+    jmp .Lf0_79
+.Lf0_80:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_79:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_37:
+    .loc 1 26 5
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_82
+    jmp .Lf0_83
+.Lf0_82:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_84
+.Lf0_83:
+    movslq -12(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_84:
+    push %rax
+    movq $1, %rax
+    cmpq $37, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_85
+    .loc 1 27 9
+    movslq -16(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movq $62, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_86
+    jmp .Lf0_87
+.Lf0_86:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_90
+    jmp .Lf0_89
+.Lf0_90:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    subq $11, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_89:
+    jmp .Lf0_88
+.Lf0_87:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_88:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 28 9
+    movq $1, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    addq $61, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $87, %rax
+    cmpq $63, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 29 9
+    movq $3, %rax
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_95
+    jmp .Lf0_94
+.Lf0_95:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_94:
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_92
+.Lf0_91:
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_93
+.Lf0_92:
+    cmpl $72, -48(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_93:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_81
+.Lf0_85:
+    .loc 1 31 9
+    movq $1, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $45, %rax
+    cmpq $69, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 32 9
+    movslq -4(%rbp), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_97
+    jmp .Lf0_96
+.Lf0_97:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_96:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_98
+.Lf0_99:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -80(%rbp)
+    .loc 1 33 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_104
+    jmp .Lf0_103
+.Lf0_104:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_103:
+    cmpq $0, %rax
+    jne .Lf0_100
+    jmp .Lf0_101
+.Lf0_100:
+    movq $88, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_102
+.Lf0_101:
+    movq $8, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_102:
+    push %rax
+    movq $97, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $80, %rax
+    addq $29, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_81:
+    .loc 1 36 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 37 9
+    jmp .Lf0_108
+    .p2align 4,,10
+.Lf0_107:
+    .loc 1 38 13
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_110
+    jmp .Lf0_109
+.Lf0_110:
+    movslq -32(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_111
+    jmp .Lf0_112
+.Lf0_111:
+    movq $41, %rax
+    jmp .Lf0_113
+.Lf0_112:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_113:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_109:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 39 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_118
+.Lf0_117:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_119
+.Lf0_118:
+    movq $79, %rax
+.Lf0_119:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $30, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_114
+    jmp .Lf0_115
+.Lf0_114:
+    movq $39, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_116
+.Lf0_115:
+    movq $28, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_121
+    jmp .Lf0_120
+.Lf0_121:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    subq $66, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_120:
+.Lf0_116:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 41 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 42 17
+    jmp .Lf0_125
+    .p2align 4,,10
+.Lf0_124:
+    .loc 1 43 21
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_127
+.Lf0_126:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_128
+.Lf0_127:
+    movslq -4(%rbp), %rax
+.Lf0_128:
+    push %rax
+    movq $12, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 44 21
+    movslq -16(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_130
+    jmp .Lf0_129
+.Lf0_130:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_129:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 45 21
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_132
+    jmp .Lf0_131
+.Lf0_132:
+    cmpl $25, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_131:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 46 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_123:
+.Lf0_125:
+    .loc 1 42 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_124
+.Lf0_122:
+    addq $0, %rsp
+    .loc 1 49 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_106:
+.Lf0_108:
+    .loc 1 37 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_107
+.Lf0_105:
+    addq $8, %rsp
+    .loc 1 52 5
+    movslq -4(%rbp), %rax
+    subq $98, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_136
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_138
+.Lf0_137:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_139
+    jmp .Lf0_140
+.Lf0_139:
+    movq $4, %rax
+    jmp .Lf0_141
+.Lf0_140:
+    movq $58, %rax
+.Lf0_141:
+.Lf0_138:
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movq $49, %rax
+    imulq $98, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_143
+    jmp .Lf0_142
+.Lf0_143:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_142:
+    jmp .Lf0_135
+.Lf0_134:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_150
+    jmp .Lf0_149
+.Lf0_150:
+    movq $47, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_149:
+    cmpq $0, %rax
+    jne .Lf0_146
+    jmp .Lf0_147
+.Lf0_146:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_148
+.Lf0_147:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_148:
+.Lf0_135:
+    movl %eax, -8(%rbp)
+    .loc 1 53 5
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_153
+    jmp .Lf0_152
+.Lf0_153:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_154
+    jmp .Lf0_155
+.Lf0_154:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf0_156
+.Lf0_155:
+    movslq -4(%rbp), %rax
+.Lf0_156:
+    push %rax
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_158
+    jmp .Lf0_157
+.Lf0_158:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_157:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_152:
+    cmpq $0, %rax
+    je .Lf0_159
+    .loc 1 54 9
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    jne .Lf0_160
+    jmp .Lf0_161
+.Lf0_160:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_162
+.Lf0_161:
+    movslq -16(%rbp), %rax
+.Lf0_162:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 55 9
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_164
+    jmp .Lf0_163
+.Lf0_164:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_163:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_166
+    jmp .Lf0_165
+.Lf0_166:
+    movq $5, %rax
+    push %rax
+    movq $11, %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_165:
+    movl %eax, -4(%rbp)
+    .loc 1 56 9
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    addq $2, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $43, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_168
+.Lf0_167:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_174
+.Lf0_173:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_175
+.Lf0_174:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf0_175:
+    cmpq $0, %rax
+    jne .Lf0_170
+    jmp .Lf0_171
+.Lf0_170:
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf0_176
+    jmp .Lf0_177
+.Lf0_176:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_178
+.Lf0_177:
+    movslq -20(%rbp), %rax
+.Lf0_178:
+    jmp .Lf0_172
+.Lf0_171:
+    movslq -16(%rbp), %rax
+    addq $27, %rax
+    movslq %eax, %rax
+.Lf0_172:
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $0, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_169:
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_151
+.Lf0_159:
+    .loc 1 58 9
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_180
+.Lf0_179:
+    movq $91, %rax
+    jmp .Lf0_181
+.Lf0_180:
+    movslq -16(%rbp), %rax
+.Lf0_181:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 59 9
+    movq $99, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $32, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $69, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 60 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $37, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_182
+    jmp .Lf0_183
+.Lf0_182:
+    movslq -20(%rbp), %rax
+    jmp .Lf0_184
+.Lf0_183:
+    movslq -12(%rbp), %rax
+.Lf0_184:
+    push %rax
+    movq $70, %rax
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_186
+.Lf0_185:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_187
+.Lf0_186:
+    movq $89, %rax
+.Lf0_187:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_151:
+    .loc 1 63 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 64 9
+    jmp .Lf0_191
+    .p2align 4,,10
+.Lf0_190:
+    .loc 1 65 13
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    subq $32, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $26, %rax
+    cmpq $0, %rax
+    jne .Lf0_192
+    jmp .Lf0_193
+.Lf0_192:
+    movq $34, %rax
+    jmp .Lf0_194
+.Lf0_193:
+    movslq -44(%rbp), %rax
+.Lf0_194:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $8, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 66 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_200
+    .p2align 4,,10
+.Lf0_199:
+    .loc 1 67 17
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_201
+    jmp .Lf0_197
+.Lf0_201:
+    .loc 1 68 17
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_205
+.Lf0_206:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_205:
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_203
+.Lf0_202:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_208
+    jmp .Lf0_207
+.Lf0_208:
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_207:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -44(%rbp), %rax
+    addq $2, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_209
+.Lf0_210:
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_209:
+.Lf0_204:
+    movl %eax, -32(%rbp)
+    .loc 1 69 17
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_211
+.Lf0_212:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_211:
+    push %rax
+    cmpl $41, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    cmpq $40, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 70 17
+    movq $28, %rax
+    imulq $43, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_198:
+    .loc 1 66 38
+    incl -344(%rbp)
+.Lf0_200:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_199
+.Lf0_197:
+    addq $0, %rsp
+    .loc 1 72 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_218
+    jmp .Lf0_219
+.Lf0_218:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_220
+.Lf0_219:
+    movslq -340(%rbp), %rax
+.Lf0_220:
+    cmpq $0, %rax
+    jne .Lf0_215
+    jmp .Lf0_216
+.Lf0_215:
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_217
+.Lf0_216:
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_217:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_222
+    jmp .Lf0_221
+.Lf0_222:
+    movq $96, %rax
+    cmpq $28, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_223
+    jmp .Lf0_224
+.Lf0_223:
+    movslq -56(%rbp), %rax
+    jmp .Lf0_225
+.Lf0_224:
+    movslq -12(%rbp), %rax
+.Lf0_225:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_221:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 73 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_189:
+.Lf0_191:
+    .loc 1 64 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_190
+.Lf0_188:
+    addq $8, %rsp
+    .loc 1 76 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_231
+    .p2align 4,,10
+.Lf0_230:
+    .loc 1 77 9
+    movq $42, %rax
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_233
+.Lf0_232:
+    movq $88, %rax
+    jmp .Lf0_234
+.Lf0_233:
+    movslq -8(%rbp), %rax
+.Lf0_234:
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_236
+.Lf0_235:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_237
+.Lf0_236:
+    movslq -72(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_237:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 78 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_243
+    .p2align 4,,10
+.Lf0_242:
+    .loc 1 79 13
+    movq $97, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -32(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $28, %rax
+    addl -76(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_244
+    jmp .Lf0_245
+.Lf0_244:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_246
+.Lf0_245:
+    movq $56, %rax
+    addq $40, %rax
+    movslq %eax, %rax
+.Lf0_246:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 80 13
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $49, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_248
+    jmp .Lf0_247
+.Lf0_248:
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_249
+.Lf0_250:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_249:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_247:
+    movl %eax, -8(%rbp)
+    .loc 1 81 13
+    movq $0, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_252
+    jmp .Lf0_251
+.Lf0_252:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_253
+    jmp .Lf0_254
+.Lf0_253:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_255
+.Lf0_254:
+    movq $47, %rax
+.Lf0_255:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_251:
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+.Lf0_241:
+    .loc 1 78 34
+    incl -344(%rbp)
+.Lf0_243:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_242
+.Lf0_240:
+    addq $0, %rsp
+    .loc 1 83 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_257
+    jmp .Lf0_256
+.Lf0_257:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_256:
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf0_258
+    jmp .Lf0_259
+.Lf0_258:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_260
+.Lf0_259:
+    movslq -4(%rbp), %rax
+.Lf0_260:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_262
+    jmp .Lf0_261
+.Lf0_262:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_261:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_229:
+    .loc 1 76 30
+    incl -340(%rbp)
+.Lf0_231:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_230
+.Lf0_228:
+    addq $8, %rsp
+    .loc 1 86 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 87 9
+    jmp .Lf0_266
+    .p2align 4,,10
+.Lf0_265:
+    .loc 1 88 13
+    movq $63, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $84, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_267
+    jmp .Lf0_263
+.Lf0_267:
+    .loc 1 89 13
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_269
+    jmp .Lf0_268
+.Lf0_269:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_268:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_271
+    jmp .Lf0_270
+.Lf0_271:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_272
+    jmp .Lf0_273
+.Lf0_272:
+    movq $66, %rax
+    jmp .Lf0_274
+.Lf0_273:
+    movslq -36(%rbp), %rax
+.Lf0_274:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_270:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 90 13
+    movq $76, %rax
+    addq $31, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $61, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_279
+    jmp .Lf0_278
+.Lf0_279:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_278:
+    cmpq $0, %rax
+    jne .Lf0_275
+    jmp .Lf0_276
+.Lf0_275:
+    movq $28, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_277
+.Lf0_276:
+    movq $82, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_277:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -40(%rbp)
+    .loc 1 91 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_285
+    .p2align 4,,10
+.Lf0_284:
+    .loc 1 92 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_290
+    jmp .Lf0_289
+.Lf0_290:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_289:
+    push %rax
+    movq $35, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_286
+    jmp .Lf0_287
+.Lf0_286:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_291
+    jmp .Lf0_292
+.Lf0_291:
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_295
+    jmp .Lf0_294
+.Lf0_295:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_294:
+    jmp .Lf0_293
+.Lf0_292:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf0_293:
+    jmp .Lf0_288
+.Lf0_287:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_296
+    jmp .Lf0_297
+.Lf0_296:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_298
+.Lf0_297:
+    movq $51, %rax
+.Lf0_298:
+    push %rax
+    movq $32, %rax
+    cmpq $0, %rax
+    jne .Lf0_299
+    jmp .Lf0_300
+.Lf0_299:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf0_301
+.Lf0_300:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf0_301:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_288:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 93 17
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_302
+    jmp .Lf0_303
+.Lf0_302:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $48, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_304
+.Lf0_303:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_306
+    jmp .Lf0_305
+.Lf0_306:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_305:
+.Lf0_304:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 94 17
+    movq $78, %rax
+    addq $78, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_307
+    jmp .Lf0_308
+.Lf0_307:
+    movq $88, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_311
+    jmp .Lf0_310
+.Lf0_311:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_313
+    jmp .Lf0_312
+.Lf0_313:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_312:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_310:
+    jmp .Lf0_309
+.Lf0_308:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_315
+    jmp .Lf0_314
+.Lf0_315:
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_314:
+.Lf0_309:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_283:
+    .loc 1 91 38
+    incl -344(%rbp)
+.Lf0_285:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_284
+.Lf0_282:
+    addq $0, %rsp
+    .loc 1 96 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_264:
+.Lf0_266:
+    .loc 1 87 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_265
+.Lf0_263:
+    addq $8, %rsp
+    .loc 1 99 5
+    cmpl $17, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_316
+    jmp .Lf0_317
+.Lf0_316:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_318
+.Lf0_317:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_318:
+    push %rax
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_320
+    jmp .Lf0_319
+.Lf0_320:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_319:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 100 5
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 102 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 103 5
+    subq $8, %rsp
+    movq $66, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 104 5
+    movq $93, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 105 5
+    subq $8, %rsp
+    movq $6, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 106 5
+    movq $89, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 107 5
+    subq $64, %rsp
+    .loc 1 108 5
+    subq $256, %rsp
+    .loc 1 109 5
+    movslq -40(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_3
+    jmp .Lf1_2
+.Lf1_3:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_5
+    jmp .Lf1_4
+.Lf1_5:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_4:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_2:
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_7
+    jmp .Lf1_6
+.Lf1_7:
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_6:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_8
+    .loc 1 110 9
+    movslq -24(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    cmpl $81, -48(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 111 9
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_9
+    jmp .Lf1_10
+.Lf1_9:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_11
+.Lf1_10:
+    movslq -8(%rbp), %rax
+.Lf1_11:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_13
+    jmp .Lf1_12
+.Lf1_13:
+    cmpl $44, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_12:
+    movl %eax, -4(%rbp)
+    .loc 1 112 9
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_15
+    jmp .Lf1_14
+.Lf1_15:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_14:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_16
+    jmp .Lf1_17
+.Lf1_16:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_18
+.Lf1_17:
+    movslq -4(%rbp), %rax
+.Lf1_18:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_20
+    jmp .Lf1_19
+.Lf1_20:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_21
+.Lf1_22:
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_21:
+    push %rax
+    movq $42, %rax
+    cmpq $0, %rax
+    jne .Lf1_23
+    jmp .Lf1_24
+.Lf1_23:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_25
+.Lf1_24:
+    movslq -64(%rbp), %rax
+.Lf1_25:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_19:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_1
+.Lf1_8:
+    .loc 1 114 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_27
+    jmp .Lf1_26
+.Lf1_27:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_26:
+    push %rax
+    movq $76, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_29
+    jmp .Lf1_28
+.Lf1_29:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_31
+    jmp .Lf1_30
+.Lf1_31:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_30:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_28:
+    movl %eax, -12(%rbp)
+    .loc 1 115 9
+    movq $59, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $86, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 116 9
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movq $22, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_32
+    jmp .Lf1_33
+.Lf1_32:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_34
+.Lf1_33:
+    movq $72, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_34:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_36
+    jmp .Lf1_35
+.Lf1_36:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_35:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_1:
+    .loc 1 118 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_42
+    .p2align 4,,10
+.Lf1_41:
+    .loc 1 119 9
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_47
+    jmp .Lf1_46
+.Lf1_47:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_46:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_49
+    jmp .Lf1_48
+.Lf1_49:
+    movslq -36(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_48:
+    cmpq $0, %rax
+    jne .Lf1_43
+    jmp .Lf1_44
+.Lf1_43:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_45
+.Lf1_44:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_51
+    jmp .Lf1_50
+.Lf1_51:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_53
+.Lf1_52:
+    movq $80, %rax
+    jmp .Lf1_54
+.Lf1_53:
+    movq $96, %rax
+.Lf1_54:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_45:
+    movl %eax, -80(%rbp)
+    .loc 1 120 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_60
+    .p2align 4,,10
+.Lf1_59:
+    .loc 1 121 13
+    movq $91, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_61
+    jmp .Lf1_62
+.Lf1_61:
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf1_64
+    jmp .Lf1_65
+.Lf1_64:
+    movq $23, %rax
+    jmp .Lf1_66
+.Lf1_65:
+    movslq -12(%rbp), %rax
+.Lf1_66:
+    jmp .Lf1_63
+.Lf1_62:
+    movq $63, %rax
+    cmpq $57, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 122 13
+    cmpl $36, -32(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 123 13
+    movq $83, %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_69
+.Lf1_68:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_70
+    jmp .Lf1_71
+.Lf1_70:
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_72
+.Lf1_71:
+    movq $69, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_74
+    jmp .Lf1_73
+.Lf1_74:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_73:
+.Lf1_72:
+.Lf1_69:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_58:
+    .loc 1 120 34
+    incl -344(%rbp)
+.Lf1_60:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_59
+.Lf1_57:
+    addq $0, %rsp
+    .loc 1 125 9
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_76
+    jmp .Lf1_75
+.Lf1_76:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_75:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_78
+    jmp .Lf1_77
+.Lf1_78:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_77:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_40:
+    .loc 1 118 30
+    incl -340(%rbp)
+.Lf1_42:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_41
+.Lf1_39:
+    addq $8, %rsp
+    .loc 1 127 5
+    cmpl $53, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_81
+.Lf1_80:
+    movq $42, %rax
+    cmpq $0, %rax
+    jne .Lf1_83
+    jmp .Lf1_84
+.Lf1_83:
+    movslq -40(%rbp), %rax
+    jmp .Lf1_85
+.Lf1_84:
+    movq $61, %rax
+.Lf1_85:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_82
+.Lf1_81:
+    movq $63, %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_87
+    jmp .Lf1_86
+.Lf1_87:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_89
+    jmp .Lf1_88
+.Lf1_89:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_88:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_86:
+.Lf1_82:
+    cmpq $0, %rax
+    je .Lf1_90
+    .loc 1 128 9
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $21, %rax
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_92
+.Lf1_91:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf1_93
+.Lf1_92:
+    movq $35, %rax
+.Lf1_93:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 129 9
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_95
+    jmp .Lf1_94
+.Lf1_95:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $8, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_94:
+    push %rax
+    cmpl $33, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_96
+    jmp .Lf1_97
+.Lf1_96:
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_98
+.Lf1_97:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 130 9
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_99
+    jmp .Lf1_100
+.Lf1_99:
+    movq $76, %rax
+    jmp .Lf1_101
+.Lf1_100:
+    movslq -8(%rbp), %rax
+.Lf1_101:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_79
+.Lf1_90:
+    .loc 1 132 9
+    movq $1, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_103
+    jmp .Lf1_102
+.Lf1_103:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_102:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_105
+    jmp .Lf1_104
+.Lf1_105:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_104:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -76(%rbp)
+    .loc 1 133 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_110
+    jmp .Lf1_109
+.Lf1_110:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_109:
+    cmpq $0, %rax
+    jne .Lf1_106
+    jmp .Lf1_107
+.Lf1_106:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_108
+.Lf1_107:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_112
+    jmp .Lf1_111
+.Lf1_112:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_111:
+.Lf1_108:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movslq -16(%rbp), %rax
+    imulq $72, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_116
+    jmp .Lf1_115
+.Lf1_116:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_115:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+    movl %eax, -4(%rbp)
+    .loc 1 134 9
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -72(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_117
+.Lf1_118:
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_120
+    jmp .Lf1_119
+.Lf1_120:
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_119:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_117:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_79:
+    .loc 1 136 5
+    movq $8, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_124
+    jmp .Lf1_125
+.Lf1_124:
+    movq $84, %rax
+    jmp .Lf1_126
+.Lf1_125:
+    movq $4, %rax
+.Lf1_126:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_121
+    jmp .Lf1_122
+.Lf1_121:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_128
+    jmp .Lf1_127
+.Lf1_128:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_127:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_123
+.Lf1_122:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_123:
+    movl %eax, -8(%rbp)
+    .loc 1 137 5
+    movq $35, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_131
+    jmp .Lf1_130
+.Lf1_131:
+    movq $70, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_130:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_133
+.Lf1_132:
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_134
+.Lf1_133:
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_134:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf1_135
+    .loc 1 138 9
+    cmpl $90, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $30, %rax
+    cmpq $0, %rax
+    jne .Lf1_136
+    jmp .Lf1_137
+.Lf1_136:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_138
+.Lf1_137:
+    movslq -60(%rbp), %rax
+.Lf1_138:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -20(%rbp)
+    .loc 1 139 9
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_140
+    jmp .Lf1_139
+.Lf1_140:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_139:
+    push %rax
+    movq $48, %rax
+    subq $38, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_141
+    jmp .Lf1_142
+.Lf1_141:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_143
+.Lf1_142:
+    movslq -12(%rbp), %rax
+.Lf1_143:
+    push %rax
+    movslq -32(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 140 9
+    cmpl $7, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_145
+    jmp .Lf1_144
+.Lf1_145:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_146
+    jmp .Lf1_147
+.Lf1_146:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_148
+.Lf1_147:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf1_148:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_144:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_149
+    jmp .Lf1_150
+.Lf1_149:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_153
+    jmp .Lf1_152
+.Lf1_153:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_152:
+    jmp .Lf1_151
+.Lf1_150:
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_151:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_129
+.Lf1_135:
+    .loc 1 142 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    push %rax
+    movq $6, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_160
+    jmp .Lf1_159
+.Lf1_160:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_159:
+    jmp .Lf1_158
+.Lf1_157:
+    movq $77, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_158:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 143 9
+    movq $55, %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_161
+    jmp .Lf1_162
+.Lf1_161:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_163
+.Lf1_162:
+    movq $32, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf1_163:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 144 9
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_164
+    jmp .Lf1_165
+.Lf1_164:
+    movq $97, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_166
+.Lf1_165:
+    movslq -20(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_166:
+    push %rax
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_168
+    jmp .Lf1_167
+.Lf1_168:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_167:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    addq $86, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_129:
+    .loc 1 146 5
+    movslq -80(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_170
+    jmp .Lf1_171
+.Lf1_170:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_172
+.Lf1_171:
+    movslq -12(%rbp), %rax
+.Lf1_172:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $46, %rax
+    imulq $84, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addq $2, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_173
+    .loc 1 147 9
+    cmpl $1, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_175
+    jmp .Lf1_174
+.Lf1_175:
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_174:
+    movl %eax, -16(%rbp)
+    .loc 1 148 9
+    movq $89, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_180
+    jmp .Lf1_179
+.Lf1_180:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_179:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_176
+    jmp .Lf1_177
+.Lf1_176:
+    movq $3, %rax
+    push %rax
+    movq $41, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_178
+.Lf1_177:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -64(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_182
+    jmp .Lf1_181
+.Lf1_182:
+    movq $2, %rax
+    push %rax
+    movq $82, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_181:
+.Lf1_178:
+    movl %eax, -16(%rbp)
+    .loc 1 149 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_184
+    jmp .Lf1_183
+.Lf1_184:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_183:
+    push %rax
+    movq $83, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_185
+.Lf1_186:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_187
+    jmp .Lf1_188
+.Lf1_187:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_189
+.Lf1_188:
+    movq $30, %rax
+.Lf1_189:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_185:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_169
+.Lf1_173:
+    .loc 1 151 9
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_191
+    jmp .Lf1_190
+.Lf1_191:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_190:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $51, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 152 9
+    cmpl $51, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $47, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_192
+    jmp .Lf1_193
+.Lf1_192:
+    movq $76, %rax
+    jmp .Lf1_194
+.Lf1_193:
+    movslq -8(%rbp), %rax
+.Lf1_194:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 153 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -52(%rbp)
+    addq $0, %rsp
+.Lf1_169:
+    .loc 1 155 5
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $31, %rax
+    imulq $37, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_195
+    jmp .Lf1_196
+.Lf1_195:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_197
+.Lf1_196:
+    movslq -60(%rbp), %rax
+.Lf1_197:
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $79, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 156 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_203
+    .p2align 4,,10
+.Lf1_202:
+    .loc 1 157 9
+    movslq -64(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_204
+    jmp .Lf1_200
+.Lf1_204:
+    .loc 1 158 9
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_209
+    jmp .Lf1_208
+.Lf1_209:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_208:
+    cmpq $0, %rax
+    jne .Lf1_205
+    jmp .Lf1_206
+.Lf1_205:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_207
+.Lf1_206:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_210
+    jmp .Lf1_211
+.Lf1_210:
+    movq $34, %rax
+    jmp .Lf1_212
+.Lf1_211:
+    movq $69, %rax
+.Lf1_212:
+.Lf1_207:
+    push %rax
+    movq $3, %rax
+    push %rax
+    cmpl $67, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 159 9
+    movq $4, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_213
+    jmp .Lf1_214
+.Lf1_213:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_217
+.Lf1_216:
+    movq $88, %rax
+    jmp .Lf1_218
+.Lf1_217:
+    movslq -16(%rbp), %rax
+.Lf1_218:
+    jmp .Lf1_215
+.Lf1_214:
+    movslq -20(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_215:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_220
+    jmp .Lf1_219
+.Lf1_220:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_225
+    jmp .Lf1_224
+.Lf1_225:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_224:
+    cmpq $0, %rax
+    jne .Lf1_221
+    jmp .Lf1_222
+.Lf1_221:
+    movslq -340(%rbp), %rax
+    addq $95, %rax
+    movslq %eax, %rax
+    jmp .Lf1_223
+.Lf1_222:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf1_223:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_219:
+    movl %eax, -16(%rbp)
+    .loc 1 161 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 162 13
+    jmp .Lf1_229
+    .p2align 4,,10
+.Lf1_228:
+    .loc 1 163 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_231
+    jmp .Lf1_230
+.Lf1_231:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_230:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_233
+    jmp .Lf1_232
+.Lf1_233:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_232:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $14, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_235
+    jmp .Lf1_234
+.Lf1_235:
+    cmpl $70, -40(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 164 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_237
+    jmp .Lf1_236
+.Lf1_237:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_236:
+    push %rax
+    cmpl $72, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_239
+    jmp .Lf1_238
+.Lf1_239:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_238:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 165 17
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $59, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_240
+    jmp .Lf1_241
+.Lf1_240:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf1_242
+.Lf1_241:
+    movq $64, %rax
+.Lf1_242:
+    push %rax
+    movq $64, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 166 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_227:
+.Lf1_229:
+    .loc 1 162 20
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_228
+.Lf1_226:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_201:
+    .loc 1 156 30
+    incl -340(%rbp)
+.Lf1_203:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_202
+.Lf1_200:
+    addq $8, %rsp
+    .loc 1 171 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 172 9
+    jmp .Lf1_246
+    .p2align 4,,10
+.Lf1_245:
+    .loc 1 173 13
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 175 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 176 17
+    jmp .Lf1_250
+    .p2align 4,,10
+.Lf1_249:
+    .loc 1 177 21
+    cmpl $68, -48(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_255
+    jmp .Lf1_254
+.Lf1_255:
+    movq $86, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_254:
+    cmpq $0, %rax
+    jne .Lf1_251
+    jmp .Lf1_252
+.Lf1_251:
+    movq $5, %rax
+    push %rax
+    movq $42, %rax
+    subq $9, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_253
+.Lf1_252:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_257
+    jmp .Lf1_256
+.Lf1_257:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_256:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_253:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 178 21
+    movq $9, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $78, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 179 21
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_258
+    jmp .Lf1_259
+.Lf1_258:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_260
+.Lf1_259:
+    movslq -36(%rbp), %rax
+.Lf1_260:
+    push %rax
+    cmpl $94, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -24(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_262
+    jmp .Lf1_261
+.Lf1_262:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_264
+    jmp .Lf1_263
+.Lf1_264:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_263:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_261:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 180 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_248:
+.Lf1_250:
+    .loc 1 176 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_249
+.Lf1_247:
+    addq $0, %rsp
+    .loc 1 183 13
+    movq $9, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    subq $3, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 184 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_244:
+.Lf1_246:
+    .loc 1 172 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_245
+.Lf1_243:
+    addq $8, %rsp
+    .loc 1 188 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 189 9
+    jmp .Lf1_268
+    .p2align 4,,10
+.Lf1_267:
+    .loc 1 190 13
+    movq $88, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $93, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_269
+    jmp .Lf1_265
+.Lf1_269:
+    .loc 1 191 13
+    movslq -16(%rbp), %rax
+    addq $64, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_270
+    jmp .Lf1_271
+.Lf1_270:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_272
+.Lf1_271:
+    movq $14, %rax
+.Lf1_272:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 192 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_276
+    jmp .Lf1_277
+.Lf1_276:
+    movq $93, %rax
+    jmp .Lf1_278
+.Lf1_277:
+    movq $62, %rax
+.Lf1_278:
+    cmpq $0, %rax
+    jne .Lf1_273
+    jmp .Lf1_274
+.Lf1_273:
+    movslq -340(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_275
+.Lf1_274:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_280
+    jmp .Lf1_279
+.Lf1_280:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_279:
+.Lf1_275:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_282
+    jmp .Lf1_281
+.Lf1_282:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $44, %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_281:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 194 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 195 17
+    .p2align 4,,10
+.Lf1_285:
+    .loc 1 196 21
+    movq $9, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_287
+    jmp .Lf1_286
+.Lf1_287:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_286:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 197 21
+    movq $80, %rax
+    cmpq $0, %rax
+    jne .Lf1_288
+    jmp .Lf1_289
+.Lf1_288:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_290
+.Lf1_289:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf1_290:
+    push %rax
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf1_291
+    jmp .Lf1_292
+.Lf1_291:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_293
+.Lf1_292:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf1_293:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_295
+    jmp .Lf1_294
+.Lf1_295:
+    cmpl $57, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_294:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 198 21
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_297
+    jmp .Lf1_296
+.Lf1_297:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_296:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_299
+    jmp .Lf1_298
+.Lf1_299:
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_301
+    jmp .Lf1_300
+.Lf1_301:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_300:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_298:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 199 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_284:
+    .loc 1 200 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_285
+.Lf1_283:
+    addq $0, %rsp
+    .loc 1 202 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_266:
+.Lf1_268:
+    .loc 1 189 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_267
+.Lf1_265:
+    addq $8, %rsp
+    .loc 1 205 5
+    movq $92, %rax
+    cmpq $2, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_303
+    jmp .Lf1_302
+.Lf1_303:
+    movslq -4(%rbp), %rax
+    addq $44, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_302:
+    push %rax
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_305
+    jmp .Lf1_304
+.Lf1_305:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_304:
+    push %rax
+    cmpl $47, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 207 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 208 5
+    subq $8, %rsp
+    movq $11, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 209 5
+    movq $64, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 210 5
+    subq $8, %rsp
+    movq $76, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 211 5
+    movq $34, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 212 5
+    subq $64, %rsp
+    .loc 1 213 5
+    subq $256, %rsp
+    .loc 1 214 5
+    movslq -64(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_2
+    jmp .Lf2_1
+.Lf2_2:
+    movslq -36(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_1:
+    push %rax
+    cmpl $18, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_3
+    jmp .Lf2_4
+.Lf2_3:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_5
+.Lf2_4:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf2_5:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 216 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 217 9
+    jmp .Lf2_9
+    .p2align 4,,10
+.Lf2_8:
+    .loc 1 218 13
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $72, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $95, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_10
+    jmp .Lf2_11
+.Lf2_10:
+    cmpl $1, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_12
+.Lf2_11:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_12:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -80(%rbp)
+    .loc 1 219 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_18
+    .p2align 4,,10
+.Lf2_17:
+    .loc 1 220 17
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_21
+    jmp .Lf2_20
+.Lf2_21:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_20:
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_19
+    jmp .Lf2_15
+.Lf2_19:
+    .loc 1 221 17
+    movslq -24(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_23
+    jmp .Lf2_22
+.Lf2_23:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_22:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_24
+    jmp .Lf2_25
+.Lf2_24:
+    movslq -80(%rbp), %rax
+    jmp .Lf2_26
+.Lf2_25:
+    movq $60, %rax
+.Lf2_26:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -28(%rbp)
+    .loc 1 222 17
+    movslq -8(%rbp), %rax
+    subq $71, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 223 17
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_28
+    jmp .Lf2_27
+.Lf2_28:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_27:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_16:
+    .loc 1 219 38
+    incl -344(%rbp)
+.Lf2_18:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_17
+.Lf2_15:
+    addq $0, %rsp
+    .loc 1 225 13
+    movslq -52(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_30
+    jmp .Lf2_29
+.Lf2_30:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_29:
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_32
+.Lf2_31:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_33
+.Lf2_32:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf2_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 226 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_7:
+.Lf2_9:
+    .loc 1 217 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_8
+.Lf2_6:
+    addq $8, %rsp
+    .loc 1 229 5
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_35
+    .loc 1 230 9
+    movq $1, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_37
+    jmp .Lf2_36
+.Lf2_37:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_38
+    jmp .Lf2_39
+.Lf2_38:
+    movslq -68(%rbp), %rax
+    jmp .Lf2_40
+.Lf2_39:
+    movslq -16(%rbp), %rax
+.Lf2_40:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_36:
+    movl %eax, -12(%rbp)
+    .loc 1 231 9
+    movq $58, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $74, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $17, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 232 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_41
+    jmp .Lf2_42
+.Lf2_41:
+    movslq -64(%rbp), %rax
+    jmp .Lf2_43
+.Lf2_42:
+    movq $43, %rax
+.Lf2_43:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $43, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_44
+    jmp .Lf2_45
+.Lf2_44:
+    movq $4, %rax
+    jmp .Lf2_46
+.Lf2_45:
+    movq $64, %rax
+.Lf2_46:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -76(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_34
+.Lf2_35:
+    .loc 1 234 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_51
+    jmp .Lf2_50
+.Lf2_51:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_53
+    jmp .Lf2_52
+.Lf2_53:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_52:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_50:
+    cmpq $0, %rax
+    jne .Lf2_47
+    jmp .Lf2_48
+.Lf2_47:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_49
+.Lf2_48:
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_49:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 235 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_55
+    jmp .Lf2_54
+.Lf2_55:
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_54:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_56
+    jmp .Lf2_57
+.Lf2_56:
+    movq $11, %rax
+    jmp .Lf2_58
+.Lf2_57:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf2_58:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 236 9
+    movslq -80(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_59
+    jmp .Lf2_60
+.Lf2_59:
+    movq $0, %rax
+    jmp .Lf2_61
+.Lf2_60:
+    movslq -8(%rbp), %rax
+.Lf2_61:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $79, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_62
+    jmp .Lf2_63
+.Lf2_62:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    imulq $59, %rax
+    movslq %eax, %rax
+    jmp .Lf2_64
+.Lf2_63:
+    cmpl $86, -12(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf2_64:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_34:
+    .loc 1 238 5
+    movq $16, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $77, %rax
+    cmpq $46, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_66
+    jmp .Lf2_65
+.Lf2_66:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_68
+    jmp .Lf2_67
+.Lf2_68:
+    movq $63, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_67:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_70
+    jmp .Lf2_69
+.Lf2_70:
+    movslq -16(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_69:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_65:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 240 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 241 9
+    jmp .Lf2_74
+    .p2align 4,,10
+.Lf2_73:
+    .loc 1 242 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 243 17
+    movslq -60(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_80
+    jmp .Lf2_81
+.Lf2_80:
+    movslq -340(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_83
+    jmp .Lf2_84
+.Lf2_83:
+    cmpl $57, -64(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_85
+.Lf2_84:
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_85:
+    jmp .Lf2_82
+.Lf2_81:
+    cmpl $77, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $23, -36(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_82:
+    movl %eax, -16(%rbp)
+    .loc 1 244 17
+    movq $6, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_90
+    jmp .Lf2_89
+.Lf2_90:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_89:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_86
+    jmp .Lf2_87
+.Lf2_86:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_91
+    jmp .Lf2_92
+.Lf2_91:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_93
+.Lf2_92:
+    movslq -344(%rbp), %rax
+.Lf2_93:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_95
+    jmp .Lf2_94
+.Lf2_95:
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_94:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_88
+.Lf2_87:
+    cmpl $96, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf2_96
+    jmp .Lf2_97
+.Lf2_96:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_98
+.Lf2_97:
+    movq $3, %rax
+.Lf2_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_88:
+    movl %eax, -4(%rbp)
+    .loc 1 245 17
+    cmpl $46, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_100
+    jmp .Lf2_99
+.Lf2_100:
+    movq $2, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_99:
+    push %rax
+    movq $70, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $32, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_79:
+    .loc 1 242 38
+    incl -344(%rbp)
+    .loc 1 243 17
+    movslq -60(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_101
+    jmp .Lf2_102
+.Lf2_101:
+    movslq -340(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_104
+    jmp .Lf2_105
+.Lf2_104:
+    cmpl $57, -64(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_106
+.Lf2_105:
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_106:
+    jmp .Lf2_103
+.Lf2_102:
+    cmpl $77, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $23, -36(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_103:
+    movl %eax, -16(%rbp)
+    .loc 1 244 17
+    movq $6, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_111
+    jmp .Lf2_110
+.Lf2_111:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_110:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_107
+    jmp .Lf2_108
+.Lf2_107:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_112
+    jmp .Lf2_113
+.Lf2_112:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_114
+.Lf2_113:
+    movslq -344(%rbp), %rax
+.Lf2_114:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_116
+    jmp .Lf2_115
+.Lf2_116:
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_115:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_109
+.Lf2_108:
+    cmpl $96, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf2_117
+    jmp .Lf2_118
+.Lf2_117:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_119
+.Lf2_118:
+    movq $3, %rax
+.Lf2_119:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_109:
+    movl %eax, -4(%rbp)
+    .loc 1 245 17
+    cmpl $46, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_121
+    jmp .Lf2_120
+.Lf2_121:
+    movq $2, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_120:
+    push %rax
+    movq $70, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $32, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_78:
+    .loc 1 242 38
+    incl -344(%rbp)
+.Lf2_77:
+    addq $0, %rsp
+    .loc 1 247 13
+    movq $2, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_123
+.Lf2_122:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_124
+.Lf2_123:
+    movq $29, %rax
+.Lf2_124:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 248 13
+    movq $6, %rax
+    push %rax
+    movq $38, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_125
+    jmp .Lf2_126
+.Lf2_125:
+    movq $25, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_127
+.Lf2_126:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_129
+.Lf2_128:
+    movslq -56(%rbp), %rax
+    jmp .Lf2_130
+.Lf2_129:
+    movslq -340(%rbp), %rax
+.Lf2_130:
+.Lf2_127:
+    push %rax
+    cmpl $64, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_131
+    jmp .Lf2_132
+.Lf2_131:
+    movq $7, %rax
+    push %rax
+    movq $59, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_133
+.Lf2_132:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    setge %al
+.Lf2_133:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 249 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_72:
+.Lf2_74:
+    .loc 1 241 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_73
+.Lf2_71:
+    addq $8, %rsp
+    .loc 1 252 5
+    movq $8, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 253 5
+    cmpl $87, -72(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_135
+    jmp .Lf2_136
+.Lf2_135:
+    movslq -36(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $61, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_137
+.Lf2_136:
+    movq $9, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_139
+    jmp .Lf2_138
+.Lf2_139:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_138:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf2_137:
+    cmpq $0, %rax
+    je .Lf2_140
+    .loc 1 254 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_142
+    jmp .Lf2_141
+.Lf2_142:
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_141:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_144
+    jmp .Lf2_143
+.Lf2_144:
+    movslq -8(%rbp), %rax
+    subq $33, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_143:
+    push %rax
+    movq $12, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $95, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 255 9
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_145
+    jmp .Lf2_146
+.Lf2_145:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_147
+.Lf2_146:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf2_147:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 256 9
+    movq $2, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_148
+    jmp .Lf2_149
+.Lf2_148:
+    movq $42, %rax
+    cmpq $0, %rax
+    jne .Lf2_151
+    jmp .Lf2_152
+.Lf2_151:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_153
+.Lf2_152:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf2_153:
+    jmp .Lf2_150
+.Lf2_149:
+    movq $49, %rax
+    imulq $66, %rax
+    movslq %eax, %rax
+.Lf2_150:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_155
+    jmp .Lf2_154
+.Lf2_155:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_154:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf2_134
+.Lf2_140:
+    .loc 1 258 9
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_157
+    jmp .Lf2_156
+.Lf2_157:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_156:
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_159
+    jmp .Lf2_158
+.Lf2_159:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_158:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 259 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_160
+    jmp .Lf2_161
+.Lf2_160:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_162
+.Lf2_161:
+    movslq -4(%rbp), %rax
+.Lf2_162:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_164
+    jmp .Lf2_163
+.Lf2_164:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_166
+    jmp .Lf2_165
+.Lf2_166:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_165:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_163:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 260 9
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_168
+    jmp .Lf2_167
+.Lf2_168:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_167:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_170
+    jmp .Lf2_169
+.Lf2_170:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_171
+    jmp .Lf2_172
+.Lf2_171:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_173
+.Lf2_172:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf2_173:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_169:
+    push %rax
+    movq $62, %rax
+    imull -52(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_175
+    jmp .Lf2_174
+.Lf2_175:
+    movslq -4(%rbp), %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_174:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_134:
+    .loc 1 262 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_179
+    jmp .Lf2_180
+.Lf2_179:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_181
+.Lf2_180:
+    movslq -36(%rbp), %rax
+.Lf2_181:
+    push %rax
+    movq $38, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_176
+    jmp .Lf2_177
+.Lf2_176:
+    movq $88, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $84, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_178
+.Lf2_177:
+    movq $75, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_178:
+    movl %eax, -16(%rbp)
+    .loc 1 263 5
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_183
+    .loc 1 264 9
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 265 9
+    movq $6, %rax
+    push %rax
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_185
+    jmp .Lf2_184
+.Lf2_185:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_184:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_187
+    jmp .Lf2_186
+.Lf2_187:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 266 9
+    movslq -8(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_189
+    jmp .Lf2_188
+.Lf2_189:
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_188:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_182
+.Lf2_183:
+    .loc 1 268 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_191
+    jmp .Lf2_190
+.Lf2_191:
+    movq $69, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_193
+    jmp .Lf2_192
+.Lf2_193:
+    cmpl $91, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_192:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_190:
+    movl %eax, -4(%rbp)
+    .loc 1 269 9
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $49, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -60(%rbp)
+    .loc 1 270 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_195
+    jmp .Lf2_194
+.Lf2_195:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_194:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_197
+    jmp .Lf2_196
+.Lf2_197:
+    movq $85, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_196:
+    push %rax
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_199
+    jmp .Lf2_198
+.Lf2_199:
+    movq $89, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_198:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_182:
+    .loc 1 272 5
+    movq $4, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_202
+    jmp .Lf2_201
+.Lf2_202:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_201:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_207
+    jmp .Lf2_206
+.Lf2_207:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_206:
+    cmpq $0, %rax
+    jne .Lf2_203
+    jmp .Lf2_204
+.Lf2_203:
+    movq $45, %rax
+    imulq $59, %rax
+    movslq %eax, %rax
+    jmp .Lf2_205
+.Lf2_204:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    subq $76, %rax
+    movslq %eax, %rax
+.Lf2_205:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf2_208
+    .loc 1 273 9
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_210
+    jmp .Lf2_209
+.Lf2_210:
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_209:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 274 9
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_212
+    jmp .Lf2_211
+.Lf2_212:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_211:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_214
+    jmp .Lf2_213
+.Lf2_214:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_213:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 275 9
+    movq $9, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_216
+    jmp .Lf2_215
+.Lf2_216:
+    movq $21, %rax
+    cmpq $96, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_215:
+    push %rax
+    movq $18, %rax
+    cmpq $0, %rax
+    jne .Lf2_217
+    jmp .Lf2_218
+.Lf2_217:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_219
+.Lf2_218:
+    movslq -16(%rbp), %rax
+.Lf2_219:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_200
+.Lf2_208:
+    .loc 1 277 9
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_221
+    jmp .Lf2_220
+.Lf2_221:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_222
+    jmp .Lf2_223
+.Lf2_222:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_224
+.Lf2_223:
+    movq $63, %rax
+.Lf2_224:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_220:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 278 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_226
+    jmp .Lf2_225
+.Lf2_226:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_225:
+    push %rax
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_228
+    jmp .Lf2_227
+.Lf2_228:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_227:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 279 9
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_230
+    jmp .Lf2_229
+.Lf2_230:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_229:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_200:
+    .loc 1 281 5
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_232
+    jmp .Lf2_231
+.Lf2_232:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_231:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $77, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $23, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 283 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 284 5
+    subq $8, %rsp
+    movq $58, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 285 5
+    movq $66, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 286 5
+    subq $8, %rsp
+    movq $23, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 287 5
+    movq $67, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 288 5
+    subq $64, %rsp
+    .loc 1 289 5
+    subq $256, %rsp
+    .loc 1 290 5
+    movq $57, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_1
+    jmp .Lf3_2
+.Lf3_1:
+    movq $86, %rax
+    cmpq $0, %rax
+    jne .Lf3_4
+    jmp .Lf3_5
+.Lf3_4:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_6
+.Lf3_5:
+    movslq -52(%rbp), %rax
+.Lf3_6:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_8
+    jmp .Lf3_7
+.Lf3_8:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_7:
+    jmp .Lf3_3
+.Lf3_2:
+    movq $6, %rax
+    push %rax
+    movq $0, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf3_9
+    jmp .Lf3_10
+.Lf3_9:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_11
+.Lf3_10:
+    movslq -36(%rbp), %rax
+.Lf3_11:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf3_3:
+    movl %eax, -4(%rbp)
+    .loc 1 291 5
+    cmpl $55, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $17, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_13
+    jmp .Lf3_14
+.Lf3_13:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_15
+.Lf3_14:
+    movslq -8(%rbp), %rax
+.Lf3_15:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_17
+    jmp .Lf3_16
+.Lf3_17:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_16:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf3_18
+    .loc 1 292 9
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $76, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $94, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $93, %rax
+    cmpq $0, %rax
+    jne .Lf3_19
+    jmp .Lf3_20
+.Lf3_19:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_21
+.Lf3_20:
+    movq $38, %rax
+.Lf3_21:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 293 9
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_25
+    jmp .Lf3_26
+.Lf3_25:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_27
+.Lf3_26:
+    movq $46, %rax
+.Lf3_27:
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_29
+    jmp .Lf3_28
+.Lf3_29:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_28:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_22
+    jmp .Lf3_23
+.Lf3_22:
+    movq $5, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_24
+.Lf3_23:
+    movq $1, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_31
+    jmp .Lf3_30
+.Lf3_31:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_30:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf3_24:
+    movl %eax, -16(%rbp)
+    .loc 1 294 9
+    movq $2, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $26, %rax
+    cmpq $0, %rax
+    jne .Lf3_35
+    jmp .Lf3_36
+.Lf3_35:
+    movq $31, %rax
+    jmp .Lf3_37
+.Lf3_36:
+    movq $94, %rax
+.Lf3_37:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_32
+    jmp .Lf3_33
+.Lf3_32:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    jne .Lf3_38
+    jmp .Lf3_39
+.Lf3_38:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf3_40
+.Lf3_39:
+    movq $8, %rax
+.Lf3_40:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_34
+.Lf3_33:
+    movq $82, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_42
+    jmp .Lf3_41
+.Lf3_42:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_41:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf3_34:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_12
+.Lf3_18:
+    .loc 1 296 9
+    movslq -36(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_43
+    jmp .Lf3_44
+.Lf3_43:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_45
+.Lf3_44:
+    movq $60, %rax
+.Lf3_45:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 297 9
+    movslq -32(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $87, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf3_46
+    jmp .Lf3_47
+.Lf3_46:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_48
+.Lf3_47:
+    movslq -4(%rbp), %rax
+.Lf3_48:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 298 9
+    movq $4, %rax
+    push %rax
+    movq $10, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -72(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $91, -44(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf3_12:
+    .loc 1 300 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_54
+    .p2align 4,,10
+.Lf3_53:
+    .loc 1 302 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 303 13
+    jmp .Lf3_58
+    .p2align 4,,10
+.Lf3_57:
+    .loc 1 304 17
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_60
+    jmp .Lf3_59
+.Lf3_60:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_59:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_62
+    jmp .Lf3_61
+.Lf3_62:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_61:
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $62, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 305 17
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_67
+    jmp .Lf3_66
+.Lf3_67:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_66:
+    push %rax
+    cmpl $75, -60(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_63
+    jmp .Lf3_64
+.Lf3_63:
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_69
+    jmp .Lf3_68
+.Lf3_69:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_68:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_65
+.Lf3_64:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_70
+    jmp .Lf3_71
+.Lf3_70:
+    movslq -344(%rbp), %rax
+    jmp .Lf3_72
+.Lf3_71:
+    movslq -344(%rbp), %rax
+.Lf3_72:
+    push %rax
+    cmpl $67, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf3_65:
+    movl %eax, -16(%rbp)
+    .loc 1 306 17
+    movq $2, %rax
+    push %rax
+    movq $55, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 307 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_56:
+.Lf3_58:
+    .loc 1 303 20
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_57
+.Lf3_55:
+    addq $0, %rsp
+    .loc 1 310 9
+    movslq -68(%rbp), %rax
+    addq $94, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf3_73
+    jmp .Lf3_74
+.Lf3_73:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_75
+.Lf3_74:
+    movslq -8(%rbp), %rax
+.Lf3_75:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_76
+    jmp .Lf3_77
+.Lf3_76:
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf3_79
+    jmp .Lf3_80
+.Lf3_79:
+    movq $98, %rax
+    jmp .Lf3_81
+.Lf3_80:
+    movslq -8(%rbp), %rax
+.Lf3_81:
+    jmp .Lf3_78
+.Lf3_77:
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_78:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 311 9
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_86
+    jmp .Lf3_85
+.Lf3_86:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_87
+    jmp .Lf3_88
+.Lf3_87:
+    movslq -56(%rbp), %rax
+    jmp .Lf3_89
+.Lf3_88:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf3_89:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_85:
+    cmpq $0, %rax
+    jne .Lf3_82
+    jmp .Lf3_83
+.Lf3_82:
+    movq $9, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_91
+    jmp .Lf3_90
+.Lf3_91:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_90:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_84
+.Lf3_83:
+    movq $3, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_92
+    jmp .Lf3_93
+.Lf3_92:
+    movq $0, %rax
+    jmp .Lf3_94
+.Lf3_93:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf3_94:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf3_84:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_52:
+    .loc 1 300 30
+    incl -340(%rbp)
+.Lf3_54:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_53
+.Lf3_51:
+    addq $8, %rsp
+    .loc 1 314 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 315 9
+    jmp .Lf3_98
+    .p2align 4,,10
+.Lf3_97:
+    .loc 1 316 13
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_99
+    jmp .Lf3_100
+.Lf3_99:
+    movq $24, %rax
+    jmp .Lf3_101
+.Lf3_100:
+    movslq -16(%rbp), %rax
+.Lf3_101:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_103
+    jmp .Lf3_102
+.Lf3_103:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -72(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_102:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 317 13
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_105
+    jmp .Lf3_104
+.Lf3_105:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_104:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 319 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 320 17
+    .p2align 4,,10
+.Lf3_108:
+    .loc 1 321 21
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_113
+    jmp .Lf3_112
+.Lf3_113:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_112:
+    cmpq $0, %rax
+    jne .Lf3_109
+    jmp .Lf3_110
+.Lf3_109:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_111
+.Lf3_110:
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf3_111:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 322 21
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $1, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 323 21
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_115
+    jmp .Lf3_114
+.Lf3_115:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    addq $63, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_114:
+    movl %eax, -12(%rbp)
+    .loc 1 324 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_107:
+    .loc 1 325 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_108
+.Lf3_106:
+    addq $0, %rsp
+    .loc 1 327 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_96:
+.Lf3_98:
+    .loc 1 315 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_97
+.Lf3_95:
+    addq $8, %rsp
+    .loc 1 331 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 332 9
+    jmp .Lf3_119
+    .p2align 4,,10
+.Lf3_118:
+    .loc 1 333 13
+    movq $7, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 334 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 335 17
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_126
+    jmp .Lf3_125
+.Lf3_126:
+    movslq -72(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_125:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_128
+    jmp .Lf3_127
+.Lf3_128:
+    cmpl $76, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $75, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_127:
+    movl %eax, -12(%rbp)
+    .loc 1 336 17
+    movslq -4(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_130
+    jmp .Lf3_129
+.Lf3_130:
+    movq $59, %rax
+    cmpq $0, %rax
+    jne .Lf3_131
+    jmp .Lf3_132
+.Lf3_131:
+    movslq -60(%rbp), %rax
+    jmp .Lf3_133
+.Lf3_132:
+    movslq -8(%rbp), %rax
+.Lf3_133:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_129:
+    push %rax
+    movq $15, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_134
+    jmp .Lf3_135
+.Lf3_134:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_136
+.Lf3_135:
+    movq $9, %rax
+    push %rax
+    movq $61, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_136:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -56(%rbp)
+    .loc 1 337 17
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_138
+    jmp .Lf3_137
+.Lf3_138:
+    movslq -40(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_137:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf3_124:
+    .loc 1 334 38
+    incl -344(%rbp)
+    .loc 1 335 17
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_141
+    jmp .Lf3_140
+.Lf3_141:
+    movslq -72(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_140:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_143
+    jmp .Lf3_142
+.Lf3_143:
+    cmpl $76, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $75, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_142:
+    movl %eax, -12(%rbp)
+    .loc 1 336 17
+    movslq -4(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_145
+    jmp .Lf3_144
+.Lf3_145:
+    movq $59, %rax
+    cmpq $0, %rax
+    jne .Lf3_146
+    jmp .Lf3_147
+.Lf3_146:
+    movslq -60(%rbp), %rax
+    jmp .Lf3_148
+.Lf3_147:
+    movslq -8(%rbp), %rax
+.Lf3_148:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_144:
+    push %rax
+    movq $15, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_149
+    jmp .Lf3_150
+.Lf3_149:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_151
+.Lf3_150:
+    movq $9, %rax
+    push %rax
+    movq $61, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_151:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -56(%rbp)
+    .loc 1 337 17
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_153
+    jmp .Lf3_152
+.Lf3_153:
+    movslq -40(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_152:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf3_139:
+    .loc 1 334 38
+    incl -344(%rbp)
+    .loc 1 335 17
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_155
+    jmp .Lf3_154
+.Lf3_155:
+    movslq -72(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_154:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_157
+    jmp .Lf3_156
+.Lf3_157:
+    cmpl $76, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $75, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_156:
+    movl %eax, -12(%rbp)
+    .loc 1 336 17
+    movslq -4(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_159
+    jmp .Lf3_158
+.Lf3_159:
+    movq $59, %rax
+    cmpq $0, %rax
+    jne .Lf3_160
+    jmp .Lf3_161
+.Lf3_160:
+    movslq -60(%rbp), %rax
+    jmp .Lf3_162
+.Lf3_161:
+    movslq -8(%rbp), %rax
+.Lf3_162:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_158:
+    push %rax
+    movq $15, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_163
+    jmp .Lf3_164
+.Lf3_163:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_165
+.Lf3_164:
+    movq $9, %rax
+    push %rax
+    movq $61, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_165:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -56(%rbp)
+    .loc 1 337 17
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_167
+    jmp .Lf3_166
+.Lf3_167:
+    movslq -40(%rbp), %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_166:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf3_123:
+    .loc 1 334 38
+    incl -344(%rbp)
+.Lf3_122:
+    addq $0, %rsp
+    .loc 1 339 13
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_175
+    jmp .Lf3_174
+.Lf3_175:
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_174:
+    cmpq $0, %rax
+    jne .Lf3_171
+    jmp .Lf3_172
+.Lf3_171:
+    cmpl $83, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_173
+.Lf3_172:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_173:
+    cmpq $0, %rax
+    jne .Lf3_168
+    jmp .Lf3_169
+.Lf3_168:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_177
+    jmp .Lf3_176
+.Lf3_177:
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_176:
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_179
+    jmp .Lf3_178
+.Lf3_179:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_178:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_170
+.Lf3_169:
+    movq $3, %rax
+    push %rax
+    movq $65, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_170:
+    movl %eax, -4(%rbp)
+    .loc 1 340 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_117:
+.Lf3_119:
+    .loc 1 332 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_118
+.Lf3_116:
+    addq $8, %rsp
+    .loc 1 344 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 345 9
+    jmp .Lf3_183
+    .p2align 4,,10
+.Lf3_182:
+    .loc 1 346 13
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_184
+    jmp .Lf3_185
+.Lf3_184:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_186
+.Lf3_185:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_188
+    jmp .Lf3_187
+.Lf3_188:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_187:
+.Lf3_186:
+    push %rax
+    cmpl $99, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_190
+    jmp .Lf3_189
+.Lf3_190:
+    movq $58, %rax
+    cmpq $82, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_189:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 347 13
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_191
+    jmp .Lf3_192
+.Lf3_191:
+    movq $19, %rax
+    jmp .Lf3_193
+.Lf3_192:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf3_193:
+    push %rax
+    movq $68, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $13, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 349 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 350 17
+    jmp .Lf3_197
+    .p2align 4,,10
+.Lf3_196:
+    .loc 1 351 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_199
+    jmp .Lf3_200
+.Lf3_199:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_201
+.Lf3_200:
+    movslq -8(%rbp), %rax
+.Lf3_201:
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_198
+    jmp .Lf3_194
+.Lf3_198:
+    .loc 1 352 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_203
+    jmp .Lf3_202
+.Lf3_203:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_202:
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_207
+    jmp .Lf3_208
+.Lf3_207:
+    movq $84, %rax
+    jmp .Lf3_209
+.Lf3_208:
+    movslq -48(%rbp), %rax
+.Lf3_209:
+    cmpq $0, %rax
+    jne .Lf3_204
+    jmp .Lf3_205
+.Lf3_204:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    subq $10, %rax
+    movslq %eax, %rax
+    jmp .Lf3_206
+.Lf3_205:
+    movslq -4(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf3_206:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 353 21
+    movq $1, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $43, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 354 21
+    movslq -28(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf3_210
+    jmp .Lf3_211
+.Lf3_210:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_212
+.Lf3_211:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf3_212:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 355 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_195:
+.Lf3_197:
+    .loc 1 350 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_196
+.Lf3_194:
+    addq $0, %rsp
+    .loc 1 358 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_181:
+.Lf3_183:
+    .loc 1 345 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_182
+.Lf3_180:
+    addq $8, %rsp
+    .loc 1 361 5
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_218
+    jmp .Lf3_217
+.Lf3_218:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_217:
+    cmpq $0, %rax
+    jne .Lf3_214
+    jmp .Lf3_215
+.Lf3_214:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_216
+.Lf3_215:
+    cmpl $32, -8(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf3_216:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_222
+    jmp .Lf3_223
+.Lf3_222:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_224
+.Lf3_223:
+    movslq -4(%rbp), %rax
+.Lf3_224:
+    cmpq $0, %rax
+    jne .Lf3_219
+    jmp .Lf3_220
+.Lf3_219:
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_221
+.Lf3_220:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -32(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_221:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_225
+    .loc 1 362 9
+    movq $8, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $90, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_227
+    jmp .Lf3_226
+.Lf3_227:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_226:
+    push %rax
+    movq $91, %rax
+    cmpq $0, %rax
+    jne .Lf3_228
+    jmp .Lf3_229
+.Lf3_228:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_230
+.Lf3_229:
+    movq $35, %rax
+.Lf3_230:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 363 9
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_232
+    jmp .Lf3_231
+.Lf3_232:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_231:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -80(%rbp)
+    .loc 1 364 9
+    movq $9, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_213
+.Lf3_225:
+    .loc 1 366 9
+    movslq -76(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $87, %rax
+    cmpq $63, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $30, %rax
+    cmpq $0, %rax
+    jne .Lf3_233
+    jmp .Lf3_234
+.Lf3_233:
+    movq $80, %rax
+    jmp .Lf3_235
+.Lf3_234:
+    movslq -68(%rbp), %rax
+.Lf3_235:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -52(%rbp)
+    .loc 1 367 9
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $83, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $65, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -68(%rbp)
+    .loc 1 368 9
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_237
+    jmp .Lf3_236
+.Lf3_237:
+    movq $33, %rax
+    cmpq $48, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_236:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf3_213:
+    .loc 1 370 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_243
+    .p2align 4,,10
+.Lf3_242:
+    .loc 1 371 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_249
+    .p2align 4,,10
+.Lf3_248:
+    .loc 1 372 13
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_251
+    jmp .Lf3_250
+.Lf3_251:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_253
+    jmp .Lf3_252
+.Lf3_253:
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_252:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_250:
+    push %rax
+    cmpl $83, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $89, -52(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 373 13
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_254
+    jmp .Lf3_255
+.Lf3_254:
+    movq $5, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_256
+.Lf3_255:
+    cmpl $99, -8(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf3_256:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_257
+    jmp .Lf3_258
+.Lf3_257:
+    movq $9, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_259
+.Lf3_258:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_260
+    jmp .Lf3_261
+.Lf3_260:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf3_262
+.Lf3_261:
+    movslq -340(%rbp), %rax
+.Lf3_262:
+.Lf3_259:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 374 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_263
+    jmp .Lf3_264
+.Lf3_263:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf3_265
+.Lf3_264:
+    movslq -12(%rbp), %rax
+.Lf3_265:
+    push %rax
+    movslq -344(%rbp), %rax
+    imull -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_267
+    jmp .Lf3_266
+.Lf3_267:
+    movq $30, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_266:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_247:
+    .loc 1 371 34
+    incl -344(%rbp)
+.Lf3_249:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_248
+.Lf3_246:
+    addq $0, %rsp
+    .loc 1 376 9
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_269
+    jmp .Lf3_268
+.Lf3_269:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_268:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 377 9
+    movslq -16(%rbp), %rax
+    imulq $86, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_270
+    jmp .Lf3_271
+.Lf3_270:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_272
+.Lf3_271:
+    movq $12, %rax
+.Lf3_272:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_274
+    jmp .Lf3_273
+.Lf3_274:
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_273:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf3_241:
+    .loc 1 370 30
+    incl -340(%rbp)
+.Lf3_243:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_242
+.Lf3_240:
+    addq $8, %rsp
+    .loc 1 379 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_280
+    .p2align 4,,10
+.Lf3_279:
+    .loc 1 380 9
+    movslq -12(%rbp), %rax
+    addq $69, %rax
+    movslq %eax, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_281
+    jmp .Lf3_277
+.Lf3_281:
+    .loc 1 381 9
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_282
+    jmp .Lf3_283
+.Lf3_282:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_284
+.Lf3_283:
+    movq $48, %rax
+.Lf3_284:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 383 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 384 13
+    jmp .Lf3_288
+    .p2align 4,,10
+.Lf3_287:
+    .loc 1 385 17
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $41, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -24(%rbp)
+    .loc 1 386 17
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_293
+    jmp .Lf3_292
+.Lf3_293:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_292:
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_289
+    jmp .Lf3_290
+.Lf3_289:
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_294
+    jmp .Lf3_295
+.Lf3_294:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_296
+.Lf3_295:
+    movslq -56(%rbp), %rax
+.Lf3_296:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_291
+.Lf3_290:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $68, -344(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf3_291:
+    movl %eax, -8(%rbp)
+    .loc 1 387 17
+    cmpl $10, -72(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf3_297
+    jmp .Lf3_298
+.Lf3_297:
+    movslq -12(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_299
+.Lf3_298:
+    movq $4, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_299:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 388 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_286:
+.Lf3_288:
+    .loc 1 384 20
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_287
+.Lf3_285:
+    addq $0, %rsp
+    .loc 1 391 9
+    cmpl $93, -36(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $95, -64(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf3_278:
+    .loc 1 379 32
+    incl -340(%rbp)
+.Lf3_280:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_279
+.Lf3_277:
+    addq $8, %rsp
+    .loc 1 394 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 395 9
+    jmp .Lf3_303
+    .p2align 4,,10
+.Lf3_302:
+    .loc 1 396 13
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_304
+    jmp .Lf3_305
+.Lf3_304:
+    movq $32, %rax
+    jmp .Lf3_306
+.Lf3_305:
+    movq $40, %rax
+.Lf3_306:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $39, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 397 13
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_310
+    jmp .Lf3_311
+.Lf3_310:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_312
+.Lf3_311:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf3_312:
+    cmpq $0, %rax
+    jne .Lf3_307
+    jmp .Lf3_308
+.Lf3_307:
+    movq $61, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_309
+.Lf3_308:
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_309:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 399 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 400 17
+    .p2align 4,,10
+.Lf3_315:
+    .loc 1 401 21
+    movslq -48(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $0, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_320
+    jmp .Lf3_319
+.Lf3_320:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_319:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_316
+    jmp .Lf3_317
+.Lf3_316:
+    movq $6, %rax
+    push %rax
+    movq $88, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_318
+.Lf3_317:
+    movslq -340(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $83, %rax
+    cmpq $0, %rax
+    jne .Lf3_321
+    jmp .Lf3_322
+.Lf3_321:
+    movslq -56(%rbp), %rax
+    jmp .Lf3_323
+.Lf3_322:
+    movq $34, %rax
+.Lf3_323:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf3_318:
+    movl %eax, -16(%rbp)
+    .loc 1 402 21
+    cmpl $26, -76(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $76, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $0, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_324
+    jmp .Lf3_325
+.Lf3_324:
+    movq $1, %rax
+    jmp .Lf3_326
+.Lf3_325:
+    movslq -16(%rbp), %rax
+.Lf3_326:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 403 21
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_328
+    jmp .Lf3_327
+.Lf3_328:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_327:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_329
+    jmp .Lf3_330
+.Lf3_329:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_331
+.Lf3_330:
+    movslq -340(%rbp), %rax
+.Lf3_331:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $94, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $22, %rax
+    subq $55, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 404 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_314:
+    .loc 1 405 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_315
+.Lf3_313:
+    addq $0, %rsp
+    .loc 1 407 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_301:
+.Lf3_303:
+    .loc 1 395 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_302
+.Lf3_300:
+    addq $8, %rsp
+    .loc 1 410 5
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_333
+    jmp .Lf3_332
+.Lf3_333:
+    movq $22, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_332:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_335
+    jmp .Lf3_334
+.Lf3_335:
+    movq $14, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -80(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_334:
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
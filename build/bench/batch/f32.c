@@ -0,0 +1,128 @@
+int f0() {
+    int v0 = 68;
+    int v1 = 3;
+    int v2 = 20;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 >= v0) < (v1 < v0)) <= ((v2 >= 74) / 7))) {
+        v1 = (((v2 >= v0) ? (v1 % 7) : (v3 ? a1[3][7] : v3)) - ((a0[2] + a0[7]) % 5));
+        v1 = (((a1[1][15] >= v2) - (v0 ? 76 : v0)) || ((4 / 7) >= (v2 <= a0[6])));
+        v1 = (((v1 - v3) % 4) && ((92 == 56) <= (v2 <= 65)));
+    } else {
+        v2 = (((93 > v3) ? (a1[3][8] % 6) : (v2 % 5)) <= ((v2 || v2) == (a0[15] >= a0[13])));
+        v1 = (((v0 && 20) - (a0[12] % 8)) && ((a0[1] < v3) * (v3 - 6)));
+        v1 = (((v0 > v2) % 1) > ((v2 && v3) ? (v2 - v2) : (a0[8] ? 40 : a0[7])));
+    }
+    v0 = (((v3 * 14) - (a0[11] ? v3 : 82)) - ((a0[0] >= 89) * (a1[2][7] + 6)));
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((v2 && 13) > 56) break;
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a0[9] = (((i1 ? v1 : i1) ? (i0 * i0) : (i1 == i0)) >= ((v0 % 4) % 9));
+                    v0 = (((29 * a0[7]) - (i1 / 2)) % 1);
+                    v2 = (((v2 / 5) * (a0[14] <= i0)) / 9);
+                    i1 = i1 + 1;
+                }
+            }
+            a0[13] = (((v1 / 5) <= (a0[9] >= v0)) * ((v1 == v3) > (99 == v3)));
+            v1 = (((32 != v1) >= (v1 ? v0 : 7)) % 6);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a1[1][15] = (((a0[15] != 45) / 1) % 7);
+            v2 = (((81 / 6) == (i2 + a0[4])) / 5);
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v3 = (((i3 == v1) != (99 < a0[11])) ? ((73 >= v0) ? (i2 ? i2 : a1[3][1]) : (v1 + a0[13])) : ((v1 * v0) - (v3 % 8)));
+                v2 = (((v2 / 2) >= (57 <= v0)) + ((i2 * a0[6]) - (i3 ? a1[1][0] : v0)));
+                a1[1][0] = (((v2 % 1) <= (i2 <= v0)) * ((58 > v3) >= (a0[3] * a0[13])));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((98 ? a1[1][7] : v0) ? (v3 * 59) : (a0[8] > v1)) + ((v1 || a1[1][6]) == (a0[14] >= 99)));
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            if ((a0[13] && a0[4]) > 73) break;
+            v2 = (((v3 / 1) != (i4 + a0[1])) <= ((v1 || v2) / 9));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v3 = (((83 ? i4 : v3) <= (i5 == 7)) && ((i4 > 15) && (a0[2] - i5)));
+                v3 = (((v2 + a1[2][10]) > (3 > i4)) > ((i5 != v1) <= (v0 - a1[2][13])));
+                v3 = (((i4 <= 44) == (v3 != v2)) < ((36 ? 91 : v2) || (a0[13] + 12)));
+            }
+            v3 = (((a1[0][14] ? v1 : 98) ? (i4 < 88) : (42 % 1)) > ((a0[14] < v3) >= (14 - a1[1][0])));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        a0[8] = (((i6 ? v2 : a0[15]) / 7) >= ((i6 <= a1[0][10]) <= (i6 >= v1)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                if ((v3 - 17) > 79) break;
+                v3 = (((v3 || v0) || (v1 || a1[3][12])) <= ((a0[9] * a1[0][2]) - (24 / 8)));
+                v2 = (((34 % 2) * (51 > i7)) || ((i6 / 3) > (a1[2][10] ? a1[3][2] : v3)));
+                v3 = (((v1 + v3) || (a0[11] < v2)) ? ((a0[6] * 74) <= (i6 != a0[1])) : ((i6 * a0[13]) - (17 && a0[1])));
+                i7 = i7 + 1;
+            }
+        }
+        v1 = (((i6 + v3) == (v3 > 90)) >= ((a1[1][5] || 70) * (2 ? v3 : a0[4])));
+    }
+    {
+        int i8 = 0;
+        do {
+            v0 = (((a0[0] + v2) && (i8 % 2)) > ((v2 == a1[2][5]) % 9));
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    a0[12] = (((84 * v3) <= (33 <= a0[8])) == ((v2 < a0[8]) ? (31 % 5) : (v1 || a1[2][6])));
+                    v2 = (((i8 > v2) <= (v3 ? 52 : a0[7])) - ((i8 * v3) / 2));
+                    a1[3][7] = (((a1[2][1] && i8) % 6) / 4);
+                    i9 = i9 + 1;
+                }
+            }
+            a0[3] = (((i8 <= v1) > (v3 == 96)) >= ((84 != a1[2][8]) == (v3 || v0)));
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            v3 = (((v2 ? a1[0][15] : a0[4]) % 6) >= ((a1[0][6] != v0) - (v2 <= a1[3][1])));
+            v3 = (((v3 % 6) + (v1 && a0[10])) < ((v3 - i10) * (44 ? a0[3] : a1[1][12])));
+            {
+                int i11 = 0;
+                while (i11 < 5) {
+                    if ((v0 % 7) > 74) break;
+                    v0 = (((9 <= 23) || (a0[5] != v1)) + ((17 ? a0[10] : a0[15]) > (a0[6] || a1[3][13])));
+                    v0 = (((a1[3][8] < v1) != (61 == 79)) ? ((v3 / 5) / 2) : ((i10 - v2) - (v0 / 4)));
+                    v2 = (((7 != 21) >= (i10 ? v3 : v0)) - ((a0[8] || i10) ? (v2 != i11) : (99 < i10)));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        }
+    }
+    if ((((a1[0][0] / 8) || (v1 > v0)) > ((87 / 6) != (v1 || 64)))) {
+        v2 = (((v0 == v3) > (v2 > v3)) <= ((a0[1] == v0) == (v3 > v0)));
+        v3 = (((v3 == v0) ? (v0 * a1[3][1]) : (80 > 82)) % 2);
+        v3 = (((v2 / 4) % 2) <= ((a1[2][3] < v0) - (v0 > 59)));
+    } else {
+        a1[3][6] = (((42 && v3) != (v3 / 5)) >= ((a1[3][4] - v0) || (0 >= v0)));
+        v1 = (((v1 % 1) + (v0 == v0)) * ((v2 == v3) >= (v1 != a0[3])));
+        a1[3][4] = (((v1 + a0[5]) != (11 || v2)) > ((v2 || a1[0][9]) * (v1 / 2)));
+    }
+    return (((v2 != v0) == (v1 ? v0 : v1)) * ((v1 != a1[1][3]) * (a1[0][10] <= v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
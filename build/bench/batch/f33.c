@@ -0,0 +1,196 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 54;
+    int v2 = 62;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][14] % 4) / 4) >= ((a0[4] > 34) <= (v3 || a1[0][8])))) {
+        v1 = (((42 != a0[2]) > (v2 <= v1)) > ((22 % 2) < (a0[15] && 68)));
+        a0[0] = (((a1[0][7] <= v1) >= (v1 + v0)) != ((4 > a0[13]) || (a0[9] % 3)));
+        v2 = (((53 || v3) >= (v1 / 3)) + ((v1 != v1) + (v1 ? v0 : a0[7])));
+    } else {
+        a1[1][4] = (((a0[15] - a1[1][6]) / 2) - ((30 <= 0) > (v2 * v3)));
+        a0[8] = (((89 <= v1) % 9) && ((26 == a1[1][7]) > (a1[0][14] * a1[0][12])));
+        a0[3] = (((v2 >= 32) + (v0 ? v0 : a1[0][7])) % 1);
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[1][9] = (((v0 ? v3 : i0) >= (v3 || 31)) >= ((v1 - a1[2][14]) && (a0[14] ? i0 : v0)));
+            a0[5] = (((v0 < 60) ? (i0 ? a0[14] : 37) : (i0 ? 17 : v3)) ? ((v2 + 83) / 7) : ((v3 / 9) + (a0[0] >= v2)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                a0[15] = (((v2 && 66) ? (75 != v1) : (v0 == v0)) <= ((i1 != 55) < (a0[9] < 36)));
+                a0[2] = (((v2 < a1[2][12]) ? (i0 * v0) : (91 ? 52 : 75)) / 5);
+                v3 = (((30 + a0[14]) ? (a1[1][5] % 6) : (v3 % 6)) <= ((v2 ? 41 : v1) / 5));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((22 > v0) > (v3 / 9)) && ((30 && v3) || (v3 && a1[1][6])))) {
+        v0 = (((36 ? 6 : v1) > (v2 % 9)) >= ((v0 * 34) || (2 == v2)));
+        a1[3][13] = (((74 ? v1 : a1[1][9]) / 6) ? ((v1 + a1[0][7]) || (v0 == v1)) : ((v1 - v0) / 6));
+        a0[13] = (((25 <= 12) != (6 % 8)) >= ((v3 ? 19 : 98) >= (v0 > v0)));
+    } else {
+        v2 = (((9 >= a0[2]) ? (10 < v2) : (26 != v0)) >= ((v0 <= v3) ? (a0[6] % 9) : (v1 == 88)));
+        a1[2][5] = (((v2 % 8) + (10 * v2)) >= ((v0 - v0) * (a1[2][6] <= v3)));
+        v2 = (((v1 ? 32 : v0) < (v3 * a0[13])) > ((23 ? v3 : 22) != (78 != a1[0][5])));
+    }
+    v1 = (((a0[10] ? a0[6] : v2) ? (v0 == v0) : (50 * 72)) == ((52 >= v0) * (v0 || a0[1])));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a0[1] <= 75) > 66) break;
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            a1[3][15] = (((i2 != a0[5]) >= (a1[3][2] >= 13)) >= ((i2 > a0[15]) <= (14 - i3)));
+            v2 = (((a0[10] > v0) == (36 ? 37 : v1)) == ((a1[0][9] || a1[0][14]) > (i2 / 7)));
+            v2 = (((20 == v2) && (65 > 69)) - ((a1[2][13] >= v2) % 9));
+        }
+        a1[1][8] = (((v1 * a1[2][4]) ? (a0[5] + 46) : (83 % 9)) <= ((a0[10] < a0[0]) || (56 % 8)));
+        v3 = (((v3 ? v0 : i2) / 3) == ((v3 || a0[12]) != (a0[15] || 23)));
+    }
+    v3 = (((v1 ? a0[9] : a0[12]) <= (v2 && v0)) - ((v3 || v1) * (a0[12] ? v2 : 93)));
+    v3 = (((v0 != 21) > (a0[13] ? a1[3][15] : v1)) > ((a1[3][8] && v1) % 3));
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((v1 >= a0[3]) > 54) break;
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v3 = (((56 == i4) && (i4 - a1[1][3])) ? ((i5 <= v1) != (0 - v2)) : ((68 ? 82 : v1) != (a0[7] + 43)));
+            a1[0][1] = (((v0 / 8) > (85 <= v3)) == ((64 || a1[0][8]) != (a0[12] - v3)));
+            v3 = (((84 ? 29 : v1) == (87 * v1)) / 6);
+        }
+        a1[0][11] = (((v2 % 3) / 1) != ((a1[2][5] <= a0[1]) >= (a0[12] + a0[7])));
+        v1 = (((i4 % 5) <= (v0 % 5)) != ((a1[3][9] != 1) || (i4 - a1[1][11])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((a1[2][0] <= v0) >= (i7 ? i7 : i6)) > ((v0 && v3) - (v0 * 37)));
+                    v2 = (((v3 <= 10) / 8) != ((a0[15] ? a0[9] : i7) ? (a1[1][12] + v1) : (a0[4] && 51)));
+                    a0[4] = (((v3 > a1[3][5]) != (v0 - a0[6])) > ((35 * v2) <= (i7 + v2)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            v0 = (((v1 % 1) <= (v3 / 5)) + ((a1[1][9] < a1[1][1]) || (v1 != a1[2][3])));
+            a1[3][7] = (((70 >= i6) || (v1 == a1[1][13])) > ((v2 < 85) >= (a1[0][12] >= v2)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v0 == a0[6]) / 6) <= ((v2 == 61) || (v0 % 9)))) {
+        a0[4] = (((v0 || 6) + (v2 >= 31)) - ((a0[8] != 59) <= (v2 - v0)));
+        v1 = (((67 || v2) == (v0 - 84)) - ((v0 > 19) != (v0 && v3)));
+        v3 = (((v3 ? 84 : v3) || (a1[2][3] + a1[0][12])) > ((a0[15] % 3) <= (v1 + v1)));
+    } else {
+        v2 = (((v0 - v3) % 1) > ((v1 && v0) == (v2 > v0)));
+        a1[0][3] = (((3 <= 71) + (a0[9] ? v1 : v0)) + ((v2 > v3) || (10 * a0[5])));
+        v1 = (((a0[6] || a1[3][12]) != (v0 <= a1[0][13])) <= ((v1 * v1) + (a1[3][4] == v2)));
+    }
+    return (((v2 && v2) && (v2 / 5)) != ((v3 && v3) ? (32 != v0) : (a0[4] == 49)));
+}
+int f1() {
+    int v0 = 96;
+    int v1 = 34;
+    int v2 = 5;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    a0[13] = (((11 < v1) / 6) == ((v3 / 6) && (15 > a1[1][14])));
+    a0[8] = (((v1 || v3) >= (a1[1][6] == v3)) < ((v1 ? a0[5] : v1) == (a1[0][15] != a1[3][3])));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a1[2][15] = (((a0[1] - 45) ? (a1[0][3] != v0) : (i0 ? 29 : a1[2][0])) + ((v1 + 97) % 3));
+            v1 = (((a0[7] ? v2 : a1[2][9]) - (v1 - 58)) * ((92 % 2) * (34 * a0[9])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((v2 / 6) * (v1 <= v2)) + ((91 / 9) >= (i1 >= a0[3])));
+                v0 = (((i1 - i0) % 1) % 2);
+                v2 = (((a0[11] || a0[15]) ? (a0[11] + v1) : (a1[0][1] + v0)) ? ((a1[2][10] >= i1) < (i1 >= 85)) : ((v2 - v2) == (v1 < 89)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a1[0][6] = (((a0[10] + v0) && (0 + 70)) == ((v2 && 38) != (v3 % 7)));
+        a0[6] = (((a0[8] > i2) + (v3 || a0[13])) - ((a1[2][1] >= v1) != (i2 / 8)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            v0 = (((v1 ? 55 : v1) == (a1[0][15] - 34)) > ((15 ? i2 : v0) * (v3 < 29)));
+            v1 = (((30 / 6) % 9) >= ((a0[14] * 69) >= (a0[6] == a0[0])));
+            v2 = (((v1 / 3) >= (v3 / 2)) == ((i2 == v1) <= (v0 > v0)));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[9] = (((a0[6] >= a1[1][2]) > (i4 * v0)) ? ((v1 < v1) * (v0 ? a0[6] : 46)) : ((v3 < a0[11]) % 5));
+            a1[3][8] = (((a1[2][14] != 93) < (a0[14] + v2)) ? ((i4 / 6) * (i4 <= 45)) : ((84 >= 67) % 9));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((v0 * i5) >= (v2 + v0)) ? ((a1[0][5] == a0[5]) <= (v3 == v3)) : ((69 / 3) <= (78 >= v2)));
+                    v1 = (((a0[3] / 9) <= (v0 > v0)) != ((v3 || v2) <= (v0 || a0[11])));
+                    v0 = (((a0[12] && v1) ? (v0 > v0) : (v1 ? i5 : 98)) / 7);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            a1[0][6] = (((7 ? v1 : v3) / 2) == ((v0 >= a1[2][15]) + (21 && a0[15])));
+            v0 = (((v1 <= i6) % 2) <= ((a0[2] * v1) < (i6 && i6)));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((37 * 7) <= (v2 == i6)) % 4);
+                    v3 = (((i6 % 7) < (v2 ? v1 : 37)) / 5);
+                    a1[1][1] = (((76 >= i7) == (v3 <= 18)) >= ((v0 * 90) - (i6 < 18)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v3 = (((v1 ? 55 : 4) ? (v2 < a1[3][5]) : (44 / 8)) * ((a1[1][3] / 3) ? (v1 / 1) : (v3 / 3)));
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        v3 = (((86 > a0[11]) == (a1[2][0] * a1[0][1])) / 8);
+        {
+            int i9 = 0;
+            while (i9 < 3) {
+                if ((25 % 9) > 83) break;
+                a1[2][15] = (((v3 < 60) < (94 == v0)) > ((74 == a0[6]) / 5));
+                a1[3][6] = (((i9 ? a0[8] : v2) && (v2 ? i8 : i9)) ? ((v2 / 7) <= (a1[1][11] - 51)) : ((a0[15] == i8) == (a0[14] > 2)));
+                v2 = (((v3 % 6) > (i8 > 53)) >= ((i8 ? 87 : a0[4]) ? (86 / 5) : (a1[0][6] - v1)));
+                i9 = i9 + 1;
+            }
+        }
+        v2 = (((v0 ? v0 : v1) ? (v1 != 12) : (v0 ? v0 : 94)) == ((a0[0] && a0[2]) == (a1[1][15] && v1)));
+    }
+    if ((((v3 + 32) ? (45 * 44) : (v0 + v3)) < ((v0 <= a1[2][4]) != (36 && v2)))) {
+        v3 = (((73 >= a0[13]) != (a0[15] + a0[7])) * ((51 / 2) ? (v0 < a0[14]) : (a1[2][3] <= 56)));
+        v3 = (((a1[3][13] ? v3 : 14) != (a0[0] >= 11)) ? ((a0[14] + a0[15]) ? (64 != a0[8]) : (91 % 9)) : ((v1 ? 33 : v1) ? (a1[1][6] >= a1[1][4]) : (v0 % 4)));
+        v3 = (((v2 >= v0) ? (v0 / 5) : (a0[14] + 24)) || ((a0[9] / 4) <= (a1[0][3] ? v0 : v1)));
+    } else {
+        a0[15] = (((v3 / 4) + (25 - 47)) <= ((v0 / 2) == (a0[7] ? a0[13] : a1[0][11])));
+        a0[9] = (((v3 / 4) ? (v3 < 94) : (89 - a1[3][0])) < ((25 < v0) ? (v1 * a0[1]) : (v2 < a0[7])));
+        v0 = (((v2 < 17) ? (v3 + v0) : (v2 % 8)) >= ((17 ? 21 : v2) - (46 <= v2)));
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+            if ((a1[3][12] / 3) > 98) break;
+            a0[12] = (((a0[6] % 3) + (v2 ? 30 : a1[0][11])) > ((88 && v3) / 3));
+            a0[12] = (((a0[9] > i11) % 5) < ((i10 + v2) ? (51 >= v2) : (v1 == a1[0][7])));
+            v3 = (((23 % 5) * (15 ? a0[13] : i11)) / 8);
+        }
+        v3 = (((i10 ? a1[2][11] : 66) || (a0[0] <= a0[3])) < ((v3 + v2) + (v1 < 46)));
+        v0 = (((a0[11] ? 64 : a0[7]) >= (v3 + 48)) * ((v2 || v1) > (i10 ? 95 : 20)));
+    }
+    return (((v1 >= a0[14]) > (88 && v2)) || ((v1 ? v0 : a0[7]) ? (v1 == v1) : (a1[2][9] ? 70 : 77)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
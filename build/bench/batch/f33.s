@@ -0,0 +1,4721 @@
+    .file 1 "build/bench/batch/f33.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 191 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 192 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 193 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 194 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 195 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $53, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $54, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $62, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $33, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    movq $4, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $34, -64(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_3
+    jmp .Lf0_2
+.Lf0_3:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_2:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf0_4
+    .loc 1 9 9
+    movq $42, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $22, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_6
+    jmp .Lf0_5
+.Lf0_6:
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_5:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 10 9
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $4, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movq $3, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -80(%rbp)
+    .loc 1 11 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_11
+.Lf0_10:
+    movslq -52(%rbp), %rax
+.Lf0_11:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_13
+    jmp .Lf0_12
+.Lf0_13:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_12:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_1
+.Lf0_4:
+    .loc 1 13 9
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 14 9
+    movq $9, %rax
+    push %rax
+    movq $89, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_15
+    jmp .Lf0_14
+.Lf0_15:
+    movq $26, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_14:
+    movl %eax, -48(%rbp)
+    .loc 1 15 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_16
+    jmp .Lf0_17
+.Lf0_16:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_18
+.Lf0_17:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_18:
+    push %rax
+    cmpl $32, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    addq $0, %rsp
+.Lf0_1:
+    .loc 1 18 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 19 9
+    .p2align 4,,10
+.Lf0_21:
+    .loc 1 20 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_22
+    jmp .Lf0_23
+.Lf0_22:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_24
+.Lf0_23:
+    movslq -340(%rbp), %rax
+.Lf0_24:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_26
+    jmp .Lf0_25
+.Lf0_26:
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_25:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_27
+.Lf0_28:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_29
+    jmp .Lf0_30
+.Lf0_29:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_31
+.Lf0_30:
+    movslq -4(%rbp), %rax
+.Lf0_31:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_27:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 21 13
+    cmpl $60, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_35
+    jmp .Lf0_36
+.Lf0_35:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_38
+    jmp .Lf0_39
+.Lf0_38:
+    movslq -24(%rbp), %rax
+    jmp .Lf0_40
+.Lf0_39:
+    movq $37, %rax
+.Lf0_40:
+    jmp .Lf0_37
+.Lf0_36:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_42
+.Lf0_41:
+    movq $17, %rax
+    jmp .Lf0_43
+.Lf0_42:
+    movslq -16(%rbp), %rax
+.Lf0_43:
+.Lf0_37:
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_33
+.Lf0_32:
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $83, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_34
+.Lf0_33:
+    movslq -80(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_34:
+    movl %eax, -60(%rbp)
+    .loc 1 22 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_49
+    .p2align 4,,10
+.Lf0_48:
+    .loc 1 23 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_54
+    jmp .Lf0_53
+.Lf0_54:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_53:
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_51
+.Lf0_50:
+    movq $75, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_52
+.Lf0_51:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_52:
+    push %rax
+    cmpl $55, -344(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $36, -44(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -20(%rbp)
+    .loc 1 24 17
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_56
+.Lf0_55:
+    movslq -340(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_57
+.Lf0_56:
+    movq $91, %rax
+    cmpq $0, %rax
+    jne .Lf0_58
+    jmp .Lf0_59
+.Lf0_58:
+    movq $52, %rax
+    jmp .Lf0_60
+.Lf0_59:
+    movq $75, %rax
+.Lf0_60:
+.Lf0_57:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    .loc 1 25 17
+    movq $30, %rax
+    addl -24(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_62
+.Lf0_61:
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_63
+.Lf0_62:
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_63:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_64
+    jmp .Lf0_65
+.Lf0_64:
+    movq $41, %rax
+    jmp .Lf0_66
+.Lf0_65:
+    movslq -8(%rbp), %rax
+.Lf0_66:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_47:
+    .loc 1 22 38
+    incl -344(%rbp)
+.Lf0_49:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_48
+.Lf0_46:
+    addq $0, %rsp
+    .loc 1 27 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_20:
+    .loc 1 28 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_21
+.Lf0_19:
+    addq $8, %rsp
+    .loc 1 30 5
+    movq $22, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_69
+    jmp .Lf0_68
+.Lf0_69:
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_70
+.Lf0_71:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_70:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_73
+    jmp .Lf0_72
+.Lf0_73:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_74
+.Lf0_75:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_74:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_72:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_68:
+    cmpq $0, %rax
+    je .Lf0_76
+    .loc 1 31 9
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf0_77
+    jmp .Lf0_78
+.Lf0_77:
+    movq $6, %rax
+    jmp .Lf0_79
+.Lf0_78:
+    movslq -8(%rbp), %rax
+.Lf0_79:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $34, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_81
+    jmp .Lf0_80
+.Lf0_81:
+    movq $2, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_80:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 32 9
+    movq $6, %rax
+    push %rax
+    movq $74, %rax
+    cmpq $0, %rax
+    jne .Lf0_85
+    jmp .Lf0_86
+.Lf0_85:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_87
+.Lf0_86:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf0_87:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_82
+    jmp .Lf0_83
+.Lf0_82:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_89
+    jmp .Lf0_88
+.Lf0_89:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_88:
+    jmp .Lf0_84
+.Lf0_83:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_84:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 33 9
+    movq $25, %rax
+    cmpq $12, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $6, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_90
+    jmp .Lf0_91
+.Lf0_90:
+    movq $19, %rax
+    jmp .Lf0_92
+.Lf0_91:
+    movq $98, %rax
+.Lf0_92:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -28(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_67
+.Lf0_76:
+    .loc 1 35 9
+    movq $9, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_93
+    jmp .Lf0_94
+.Lf0_93:
+    movq $10, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_95
+.Lf0_94:
+    movq $26, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_95:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_96
+    jmp .Lf0_97
+.Lf0_96:
+    movq $9, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_98
+.Lf0_97:
+    cmpl $88, -8(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf0_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 36 9
+    movq $10, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 37 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_100
+.Lf0_99:
+    movq $32, %rax
+    jmp .Lf0_101
+.Lf0_100:
+    movslq -4(%rbp), %rax
+.Lf0_101:
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_102
+    jmp .Lf0_103
+.Lf0_102:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_104
+.Lf0_103:
+    movq $22, %rax
+.Lf0_104:
+    push %rax
+    movq $78, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_67:
+    .loc 1 39 5
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_108
+    jmp .Lf0_109
+.Lf0_108:
+    movslq -56(%rbp), %rax
+    jmp .Lf0_110
+.Lf0_109:
+    movslq -12(%rbp), %rax
+.Lf0_110:
+    cmpq $0, %rax
+    jne .Lf0_105
+    jmp .Lf0_106
+.Lf0_105:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_107
+.Lf0_106:
+    movq $50, %rax
+    imulq $72, %rax
+    movslq %eax, %rax
+.Lf0_107:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_112
+    jmp .Lf0_111
+.Lf0_112:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_111:
+    push %rax
+    movq $52, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 40 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_118
+    .p2align 4,,10
+.Lf0_117:
+    .loc 1 41 9
+    cmpl $75, -76(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $66, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_119
+    jmp .Lf0_115
+.Lf0_119:
+    .loc 1 42 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_125
+    .p2align 4,,10
+.Lf0_124:
+    .loc 1 43 13
+    movslq -340(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $13, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $14, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 44 13
+    movslq -40(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_127
+.Lf0_126:
+    movq $37, %rax
+    jmp .Lf0_128
+.Lf0_127:
+    movslq -8(%rbp), %rax
+.Lf0_128:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_130
+    jmp .Lf0_129
+.Lf0_130:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_129:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 45 13
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $20, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_132
+    jmp .Lf0_131
+.Lf0_132:
+    movq $65, %rax
+    cmpq $69, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_131:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_123:
+    .loc 1 42 34
+    incl -344(%rbp)
+.Lf0_125:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_124
+.Lf0_122:
+    addq $0, %rsp
+    .loc 1 47 9
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movslq -60(%rbp), %rax
+    addq $46, %rax
+    movslq %eax, %rax
+    jmp .Lf0_135
+.Lf0_134:
+    movq $9, %rax
+    push %rax
+    movq $83, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_135:
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_137
+    jmp .Lf0_136
+.Lf0_137:
+    movq $8, %rax
+    push %rax
+    movq $56, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_136:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 48 9
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_140
+.Lf0_139:
+    movslq -340(%rbp), %rax
+.Lf0_140:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_142
+    jmp .Lf0_141
+.Lf0_142:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_141:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_144
+    jmp .Lf0_143
+.Lf0_144:
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_143:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_116:
+    .loc 1 40 30
+    incl -340(%rbp)
+.Lf0_118:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_117
+.Lf0_115:
+    addq $8, %rsp
+    .loc 1 50 5
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_145
+    jmp .Lf0_146
+.Lf0_145:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_147
+.Lf0_146:
+    movq $93, %rax
+.Lf0_147:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_149
+    jmp .Lf0_148
+.Lf0_149:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_148:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_152
+.Lf0_151:
+    movslq -32(%rbp), %rax
+.Lf0_152:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_154
+    jmp .Lf0_153
+.Lf0_154:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_153:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 51 5
+    cmpl $21, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_156
+.Lf0_155:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -8(%rbp), %rax
+.Lf0_157:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_159
+    jmp .Lf0_158
+.Lf0_159:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_158:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 52 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_165
+    .p2align 4,,10
+.Lf0_164:
+    .loc 1 53 9
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $54, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_166
+    jmp .Lf0_162
+.Lf0_166:
+    .loc 1 54 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_172
+    .p2align 4,,10
+.Lf0_171:
+    .loc 1 55 13
+    movq $56, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_177
+    jmp .Lf0_176
+.Lf0_177:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_176:
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_174
+.Lf0_173:
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $0, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_175
+.Lf0_174:
+    movq $68, %rax
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_179
+.Lf0_178:
+    movq $82, %rax
+    jmp .Lf0_180
+.Lf0_179:
+    movslq -8(%rbp), %rax
+.Lf0_180:
+    push %rax
+    movslq -52(%rbp), %rax
+    addq $43, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_175:
+    movl %eax, -16(%rbp)
+    .loc 1 56 13
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $85, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_182
+    jmp .Lf0_181
+.Lf0_182:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_181:
+    push %rax
+    movslq -32(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 57 13
+    movq $6, %rax
+    push %rax
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf0_183
+    jmp .Lf0_184
+.Lf0_183:
+    movq $29, %rax
+    jmp .Lf0_185
+.Lf0_184:
+    movslq -8(%rbp), %rax
+.Lf0_185:
+    push %rax
+    movq $87, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_170:
+    .loc 1 54 34
+    incl -344(%rbp)
+.Lf0_172:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_171
+.Lf0_169:
+    addq $0, %rsp
+    .loc 1 59 9
+    movq $1, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -32(%rbp), %rax
+    addl -52(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 60 9
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_187
+    jmp .Lf0_186
+.Lf0_187:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_163:
+    .loc 1 52 30
+    incl -340(%rbp)
+.Lf0_165:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_164
+.Lf0_162:
+    addq $8, %rsp
+    .loc 1 63 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 64 9
+    jmp .Lf0_191
+    .p2align 4,,10
+.Lf0_190:
+    .loc 1 66 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 67 17
+    .p2align 4,,10
+.Lf0_194:
+    .loc 1 68 21
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_195
+    jmp .Lf0_196
+.Lf0_195:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_197
+.Lf0_196:
+    movslq -340(%rbp), %rax
+.Lf0_197:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $37, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 69 21
+    movq $8, %rax
+    push %rax
+    cmpl $10, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_203
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_205
+.Lf0_204:
+    movslq -344(%rbp), %rax
+.Lf0_205:
+    cmpq $0, %rax
+    jne .Lf0_200
+    jmp .Lf0_201
+.Lf0_200:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_202
+.Lf0_201:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_207
+    jmp .Lf0_206
+.Lf0_207:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_206:
+.Lf0_202:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 70 21
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $35, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -64(%rbp)
+    .loc 1 71 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_193:
+    .loc 1 72 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_194
+.Lf0_192:
+    addq $0, %rsp
+    .loc 1 74 13
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_209
+    jmp .Lf0_208
+.Lf0_209:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_208:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 75 13
+    movq $70, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_211
+    jmp .Lf0_210
+.Lf0_211:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_210:
+    push %rax
+    cmpl $85, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 76 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_189:
+.Lf0_191:
+    .loc 1 64 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_190
+.Lf0_188:
+    addq $8, %rsp
+    .loc 1 79 5
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $61, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf0_215
+    .loc 1 80 9
+    cmpl $59, -48(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $31, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_217
+    jmp .Lf0_216
+.Lf0_217:
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_216:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    .loc 1 81 9
+    cmpl $19, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_221
+    jmp .Lf0_220
+.Lf0_221:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_220:
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $84, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 82 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_222
+    jmp .Lf0_223
+.Lf0_222:
+    movq $84, %rax
+    jmp .Lf0_224
+.Lf0_223:
+    movslq -16(%rbp), %rax
+.Lf0_224:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_226
+    jmp .Lf0_225
+.Lf0_226:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_225:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_212
+.Lf0_215:
+    .loc 1 84 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_228
+    jmp .Lf0_227
+.Lf0_228:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_227:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 85 9
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_230
+    jmp .Lf0_229
+.Lf0_230:
+    movq $10, %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_229:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_231
+    jmp .Lf0_232
+.Lf0_231:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_233
+.Lf0_232:
+    movslq -4(%rbp), %rax
+.Lf0_233:
+    push %rax
+    movq $3, %rax
+    cmpq $71, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 86 9
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_235
+    jmp .Lf0_234
+.Lf0_235:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_234:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_212:
+    .loc 1 88 5
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_237
+    jmp .Lf0_236
+.Lf0_237:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_236:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_239
+    jmp .Lf0_238
+.Lf0_239:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_238:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_244
+    jmp .Lf0_243
+.Lf0_244:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_243:
+    cmpq $0, %rax
+    jne .Lf0_240
+    jmp .Lf0_241
+.Lf0_240:
+    movq $32, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_242
+.Lf0_241:
+    cmpl $49, -64(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf0_242:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 90 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 91 5
+    subq $8, %rsp
+    movq $96, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 92 5
+    movq $34, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 93 5
+    subq $8, %rsp
+    movq $5, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 94 5
+    movq $51, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 95 5
+    subq $64, %rsp
+    .loc 1 96 5
+    subq $256, %rsp
+    .loc 1 97 5
+    movq $6, %rax
+    push %rax
+    movq $11, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_2
+    jmp .Lf1_1
+.Lf1_2:
+    movq $15, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_1:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -28(%rbp)
+    .loc 1 98 5
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_4
+    jmp .Lf1_3
+.Lf1_4:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_3:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_5
+    jmp .Lf1_6
+.Lf1_5:
+    movslq -60(%rbp), %rax
+    jmp .Lf1_7
+.Lf1_6:
+    movslq -8(%rbp), %rax
+.Lf1_7:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -48(%rbp)
+    .loc 1 100 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 101 9
+    jmp .Lf1_11
+    .p2align 4,,10
+.Lf1_10:
+    .loc 1 102 13
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $97, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    subq $45, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_12
+    jmp .Lf1_13
+.Lf1_12:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_14
+.Lf1_13:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_15
+    jmp .Lf1_16
+.Lf1_15:
+    movq $29, %rax
+    jmp .Lf1_17
+.Lf1_16:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf1_17:
+.Lf1_14:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 103 13
+    movq $34, %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $92, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $58, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_19
+.Lf1_18:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_20
+.Lf1_19:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf1_20:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 104 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_26
+    .p2align 4,,10
+.Lf1_25:
+    .loc 1 105 17
+    movq $9, %rax
+    push %rax
+    movq $91, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 106 17
+    movq $2, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 107 17
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_34
+    jmp .Lf1_33
+.Lf1_34:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_33:
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_31
+.Lf1_30:
+    movslq -36(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_32
+.Lf1_31:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_32:
+    cmpq $0, %rax
+    jne .Lf1_27
+    jmp .Lf1_28
+.Lf1_27:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $85, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_29
+.Lf1_28:
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $89, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_29:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_24:
+    .loc 1 104 38
+    incl -344(%rbp)
+.Lf1_26:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_25
+.Lf1_23:
+    addq $0, %rsp
+    .loc 1 109 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_9:
+.Lf1_11:
+    .loc 1 101 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_10
+.Lf1_8:
+    addq $8, %rsp
+    .loc 1 112 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_40
+    .p2align 4,,10
+.Lf1_39:
+    .loc 1 113 9
+    movslq -40(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_42
+    jmp .Lf1_41
+.Lf1_42:
+    movq $0, %rax
+    addq $70, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_41:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_44
+    jmp .Lf1_43
+.Lf1_44:
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_43:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 114 9
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_46
+    jmp .Lf1_45
+.Lf1_46:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_45:
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 115 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 116 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_53
+.Lf1_52:
+    movq $55, %rax
+    jmp .Lf1_54
+.Lf1_53:
+    movslq -8(%rbp), %rax
+.Lf1_54:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    subq $34, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $29, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    jne .Lf1_55
+    jmp .Lf1_56
+.Lf1_55:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_57
+.Lf1_56:
+    movslq -4(%rbp), %rax
+.Lf1_57:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 117 13
+    movq $9, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $30, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    imulq $69, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 118 13
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_51:
+    .loc 1 115 34
+    incl -344(%rbp)
+    .loc 1 116 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_58
+    jmp .Lf1_59
+.Lf1_58:
+    movq $55, %rax
+    jmp .Lf1_60
+.Lf1_59:
+    movslq -8(%rbp), %rax
+.Lf1_60:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    subq $34, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $29, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    jne .Lf1_61
+    jmp .Lf1_62
+.Lf1_61:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_63
+.Lf1_62:
+    movslq -4(%rbp), %rax
+.Lf1_63:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 117 13
+    movq $9, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $30, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    imulq $69, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 118 13
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_50:
+    .loc 1 115 34
+    incl -344(%rbp)
+.Lf1_49:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_38:
+    .loc 1 112 30
+    incl -340(%rbp)
+.Lf1_40:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_39
+.Lf1_37:
+    addq $8, %rsp
+    .loc 1 122 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 123 9
+    .p2align 4,,10
+.Lf1_66:
+    .loc 1 124 13
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_67
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_70
+    jmp .Lf1_71
+.Lf1_70:
+    movslq -56(%rbp), %rax
+    jmp .Lf1_72
+.Lf1_71:
+    movq $46, %rax
+.Lf1_72:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_69
+.Lf1_68:
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_69:
+    movl %eax, -44(%rbp)
+    .loc 1 125 13
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $93, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -24(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_74
+.Lf1_73:
+    cmpl $45, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_75
+.Lf1_74:
+    movq $9, %rax
+    push %rax
+    movq $84, %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_75:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 127 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 128 17
+    jmp .Lf1_79
+    .p2align 4,,10
+.Lf1_78:
+    .loc 1 129 21
+    movslq -4(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_81
+.Lf1_80:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_82
+.Lf1_81:
+    movq $3, %rax
+    push %rax
+    movq $69, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $78, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_82:
+    movl %eax, -16(%rbp)
+    .loc 1 130 21
+    movq $9, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_84
+    jmp .Lf1_83
+.Lf1_84:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_83:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_86
+    jmp .Lf1_85
+.Lf1_86:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_85:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 131 21
+    movq $7, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_90
+.Lf1_91:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_90:
+    cmpq $0, %rax
+    jne .Lf1_87
+    jmp .Lf1_88
+.Lf1_87:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_89
+.Lf1_88:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_92
+    jmp .Lf1_93
+.Lf1_92:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_94
+.Lf1_93:
+    movq $98, %rax
+.Lf1_94:
+.Lf1_89:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 132 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_77:
+.Lf1_79:
+    .loc 1 128 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_78
+.Lf1_76:
+    addq $0, %rsp
+    .loc 1 135 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_65:
+    .loc 1 136 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_66
+.Lf1_64:
+    addq $8, %rsp
+    .loc 1 139 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 140 9
+    jmp .Lf1_98
+    .p2align 4,,10
+.Lf1_97:
+    .loc 1 141 13
+    movq $2, %rax
+    push %rax
+    movq $7, %rax
+    cmpq $0, %rax
+    jne .Lf1_99
+    jmp .Lf1_100
+.Lf1_99:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_101
+.Lf1_100:
+    movslq -16(%rbp), %rax
+.Lf1_101:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_103
+    jmp .Lf1_102
+.Lf1_103:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_102:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 142 13
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_105
+    jmp .Lf1_104
+.Lf1_105:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_104:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 144 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 145 17
+    .p2align 4,,10
+.Lf1_108:
+    .loc 1 146 21
+    movq $4, %rax
+    push %rax
+    movq $37, %rax
+    imulq $7, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 147 21
+    movq $5, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_109
+    jmp .Lf1_110
+.Lf1_109:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_111
+.Lf1_110:
+    movq $37, %rax
+.Lf1_111:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 148 21
+    movq $76, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $18, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $18, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $90, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 149 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_107:
+    .loc 1 150 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_108
+.Lf1_106:
+    addq $0, %rsp
+    .loc 1 152 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_96:
+.Lf1_98:
+    .loc 1 140 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_97
+.Lf1_95:
+    addq $8, %rsp
+    .loc 1 155 5
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_112
+    jmp .Lf1_113
+.Lf1_112:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_114
+.Lf1_113:
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_114:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_119
+.Lf1_118:
+    movq $55, %rax
+    jmp .Lf1_120
+.Lf1_119:
+    movq $4, %rax
+.Lf1_120:
+    cmpq $0, %rax
+    jne .Lf1_115
+    jmp .Lf1_116
+.Lf1_115:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_117
+.Lf1_116:
+    movq $8, %rax
+    push %rax
+    movq $44, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_117:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 156 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_126
+    .p2align 4,,10
+.Lf1_125:
+    .loc 1 157 9
+    movq $8, %rax
+    push %rax
+    movq $86, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 159 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 160 13
+    jmp .Lf1_130
+    .p2align 4,,10
+.Lf1_129:
+    .loc 1 161 17
+    movq $9, %rax
+    push %rax
+    movq $25, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $83, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_131
+    jmp .Lf1_127
+.Lf1_131:
+    .loc 1 162 17
+    cmpl $60, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $94, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $74, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 163 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_136
+.Lf1_135:
+    movslq -48(%rbp), %rax
+    jmp .Lf1_137
+.Lf1_136:
+    movslq -12(%rbp), %rax
+.Lf1_137:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_139
+    jmp .Lf1_138
+.Lf1_139:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_141
+.Lf1_140:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_142
+.Lf1_141:
+    movslq -344(%rbp), %rax
+.Lf1_142:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_138:
+    cmpq $0, %rax
+    jne .Lf1_132
+    jmp .Lf1_133
+.Lf1_132:
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    subq $51, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_134
+.Lf1_133:
+    movslq -20(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $2, -24(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_134:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 164 17
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $53, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_146
+    jmp .Lf1_147
+.Lf1_146:
+    movq $87, %rax
+    jmp .Lf1_148
+.Lf1_147:
+    movslq -64(%rbp), %rax
+.Lf1_148:
+    cmpq $0, %rax
+    jne .Lf1_143
+    jmp .Lf1_144
+.Lf1_143:
+    movq $5, %rax
+    push %rax
+    movq $86, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_145
+.Lf1_144:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_145:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 165 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_128:
+.Lf1_130:
+    .loc 1 160 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_129
+.Lf1_127:
+    addq $0, %rsp
+    .loc 1 168 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_152
+    jmp .Lf1_153
+.Lf1_152:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_154
+.Lf1_153:
+    movslq -8(%rbp), %rax
+.Lf1_154:
+    cmpq $0, %rax
+    jne .Lf1_149
+    jmp .Lf1_150
+.Lf1_149:
+    cmpl $12, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_151
+.Lf1_150:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_155
+    jmp .Lf1_156
+.Lf1_155:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_157
+.Lf1_156:
+    movq $94, %rax
+.Lf1_157:
+.Lf1_151:
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_159
+    jmp .Lf1_158
+.Lf1_159:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_158:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_161
+    jmp .Lf1_160
+.Lf1_161:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_160:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_124:
+    .loc 1 156 30
+    incl -340(%rbp)
+.Lf1_126:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_125
+.Lf1_123:
+    addq $8, %rsp
+    .loc 1 170 5
+    movslq -16(%rbp), %rax
+    addq $32, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_163
+    jmp .Lf1_164
+.Lf1_163:
+    movq $45, %rax
+    imulq $44, %rax
+    movslq %eax, %rax
+    jmp .Lf1_165
+.Lf1_164:
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_165:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_167
+    jmp .Lf1_166
+.Lf1_167:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_166:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_168
+    .loc 1 171 9
+    movq $2, %rax
+    push %rax
+    movq $51, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_169
+    jmp .Lf1_170
+.Lf1_169:
+    movslq -4(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_171
+.Lf1_170:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setle %al
+.Lf1_171:
+    push %rax
+    movq $73, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -20(%rbp), %rax
+    addl -52(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 172 9
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_175
+    jmp .Lf1_176
+.Lf1_175:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_177
+.Lf1_176:
+    movq $14, %rax
+.Lf1_177:
+    push %rax
+    cmpl $11, -80(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_172
+    jmp .Lf1_173
+.Lf1_172:
+    movslq -24(%rbp), %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_178
+    jmp .Lf1_179
+.Lf1_178:
+    movq $64, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_180
+.Lf1_179:
+    movq $9, %rax
+    push %rax
+    movq $91, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_180:
+    jmp .Lf1_174
+.Lf1_173:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_184
+    jmp .Lf1_185
+.Lf1_184:
+    movq $33, %rax
+    jmp .Lf1_186
+.Lf1_185:
+    movslq -8(%rbp), %rax
+.Lf1_186:
+    cmpq $0, %rax
+    jne .Lf1_181
+    jmp .Lf1_182
+.Lf1_181:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_183
+.Lf1_182:
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_183:
+.Lf1_174:
+    movl %eax, -16(%rbp)
+    .loc 1 173 9
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_187
+    jmp .Lf1_188
+.Lf1_187:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_189
+.Lf1_188:
+    movslq -24(%rbp), %rax
+    addq $24, %rax
+    movslq %eax, %rax
+.Lf1_189:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_191
+    jmp .Lf1_190
+.Lf1_191:
+    movq $4, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_192
+    jmp .Lf1_193
+.Lf1_192:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_194
+.Lf1_193:
+    movslq -8(%rbp), %rax
+.Lf1_194:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_190:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_162
+.Lf1_168:
+    .loc 1 175 9
+    movq $25, %rax
+    subq $47, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_195
+    jmp .Lf1_196
+.Lf1_195:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_197
+.Lf1_196:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_197:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -20(%rbp)
+    .loc 1 176 9
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_199
+.Lf1_198:
+    cmpl $94, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_200
+.Lf1_199:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movq $89, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_200:
+    push %rax
+    movq $25, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_201
+    jmp .Lf1_202
+.Lf1_201:
+    movslq -8(%rbp), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_203
+.Lf1_202:
+    movslq -12(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_203:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -44(%rbp)
+    .loc 1 177 9
+    cmpl $17, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_204
+    jmp .Lf1_205
+.Lf1_204:
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_206
+.Lf1_205:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_206:
+    push %rax
+    movq $46, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf1_207
+    jmp .Lf1_208
+.Lf1_207:
+    movq $21, %rax
+    jmp .Lf1_209
+.Lf1_208:
+    movslq -12(%rbp), %rax
+.Lf1_209:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_162:
+    .loc 1 179 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_215
+    .p2align 4,,10
+.Lf1_214:
+    .loc 1 180 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_221
+    .p2align 4,,10
+.Lf1_220:
+    .loc 1 181 13
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $98, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_222
+    jmp .Lf1_218
+.Lf1_222:
+    .loc 1 182 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_223
+    jmp .Lf1_224
+.Lf1_223:
+    movq $30, %rax
+    jmp .Lf1_225
+.Lf1_224:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_225:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_227
+    jmp .Lf1_226
+.Lf1_227:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_226:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -32(%rbp)
+    .loc 1 183 13
+    movq $5, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_228
+    jmp .Lf1_229
+.Lf1_228:
+    movq $51, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_230
+.Lf1_229:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_230:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -32(%rbp)
+    .loc 1 184 13
+    movq $8, %rax
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    jne .Lf1_231
+    jmp .Lf1_232
+.Lf1_231:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_233
+.Lf1_232:
+    movslq -344(%rbp), %rax
+.Lf1_233:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $23, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_219:
+    .loc 1 180 36
+    incl -344(%rbp)
+.Lf1_221:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_220
+.Lf1_218:
+    addq $0, %rsp
+    .loc 1 186 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_234
+    jmp .Lf1_235
+.Lf1_234:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf1_236
+.Lf1_235:
+    movq $66, %rax
+.Lf1_236:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_238
+    jmp .Lf1_237
+.Lf1_238:
+    movslq -80(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_237:
+    push %rax
+    cmpl $46, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 187 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_240
+    jmp .Lf1_239
+.Lf1_240:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_239:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_241
+    jmp .Lf1_242
+.Lf1_241:
+    movq $95, %rax
+    jmp .Lf1_243
+.Lf1_242:
+    movq $20, %rax
+.Lf1_243:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_244
+    jmp .Lf1_245
+.Lf1_244:
+    movq $64, %rax
+    jmp .Lf1_246
+.Lf1_245:
+    movslq -52(%rbp), %rax
+.Lf1_246:
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $48, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_213:
+    .loc 1 179 32
+    incl -340(%rbp)
+.Lf1_215:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_214
+.Lf1_212:
+    addq $8, %rsp
+    .loc 1 189 5
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_248
+    jmp .Lf1_247
+.Lf1_248:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_247:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_250
+    jmp .Lf1_249
+.Lf1_250:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_254
+    jmp .Lf1_255
+.Lf1_254:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_256
+.Lf1_255:
+    movslq -52(%rbp), %rax
+.Lf1_256:
+    cmpq $0, %rax
+    jne .Lf1_251
+    jmp .Lf1_252
+.Lf1_251:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_253
+.Lf1_252:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_257
+    jmp .Lf1_258
+.Lf1_257:
+    movq $70, %rax
+    jmp .Lf1_259
+.Lf1_258:
+    movq $77, %rax
+.Lf1_259:
+.Lf1_253:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_249:
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
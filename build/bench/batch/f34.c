@@ -0,0 +1,319 @@
+int f0() {
+    int v0 = 17;
+    int v1 = 19;
+    int v2 = 68;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a1[2][12] ? 52 : v3) > 93) break;
+        v1 = (((a0[10] ? 53 : a0[12]) ? (a1[0][7] - 74) : (a1[3][3] ? v0 : a0[13])) != ((67 ? i0 : v0) == (18 / 5)));
+        a1[0][13] = (((92 || v2) > (a0[3] < 18)) % 5);
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                a1[0][13] = (((a0[7] && 53) * (71 - v1)) + ((v2 + 77) + (a0[15] + v0)));
+                v0 = (((v1 != v1) < (a1[3][4] && v0)) <= ((i0 >= v3) % 3));
+                v2 = (((v0 - v0) - (v3 + v2)) + ((i1 / 7) == (v1 || v2)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((75 > v2) > 80) break;
+        a1[0][4] = (((4 || i2) >= (a0[13] || v1)) > ((a1[0][13] / 5) != (v1 && v2)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v1 = (((77 >= a1[1][3]) == (v1 < a0[6])) == ((v2 != v1) <= (v0 ? 91 : 41)));
+                a0[12] = (((54 || i3) ? (v1 <= v3) : (i2 < 66)) || ((a1[0][6] - v0) / 6));
+                v1 = (((v1 != a1[2][14]) && (a1[2][10] <= i2)) < ((v1 || v0) >= (a1[0][14] <= v2)));
+                i3 = i3 + 1;
+            }
+        }
+        a1[1][10] = (((a0[3] <= v1) == (v0 && v0)) + ((a0[2] / 7) / 6));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((a1[3][11] ? v2 : 79) > 89) break;
+            a1[2][15] = (((v2 < v2) ? (v0 - i4) : (a0[9] || v1)) != ((84 - 31) == (78 == 42)));
+            a1[0][13] = (((v3 % 8) > (v3 || a0[5])) / 6);
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v0 = (((v0 == a0[12]) != (a0[1] == i4)) > ((i4 + v0) || (v2 / 5)));
+                    v2 = (((62 < i5) % 7) - ((v1 + a1[2][2]) ? (i4 * v1) : (27 ? i5 : i4)));
+                    v3 = (((88 ? 36 : v0) % 1) >= ((98 / 4) + (a1[1][5] <= i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v2 = (((v3 ? 75 : v0) && (a1[3][0] == v3)) <= ((i6 >= v2) * (a1[2][9] < v1)));
+            a0[13] = (((v3 >= v0) + (12 ? i6 : a1[2][9])) <= ((16 > 73) - (a0[12] < a1[0][12])));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v0 = (((v1 < v0) % 9) ? ((a1[2][11] < a1[0][15]) ? (v0 == 44) : (a1[1][3] == i7)) : ((v0 >= a0[0]) && (v3 <= v1)));
+                v0 = (((v1 + i6) != (99 == v3)) ? ((i7 ? i6 : v1) * (i6 % 8)) : ((a0[9] - v2) + (39 ? v0 : v1)));
+                a1[3][3] = (((v2 != a0[10]) ? (i6 * v1) : (v0 && i6)) ? ((i6 % 1) || (64 ? i7 : 43)) : ((71 != i7) > (73 - v2)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    a1[1][10] = (((a0[5] > v3) < (v1 || v2)) % 2);
+    v0 = (((a0[12] * 98) - (v3 || a0[2])) - ((v0 < a0[8]) >= (v2 ? v0 : 28)));
+    {
+        int i8 = 0;
+        do {
+            v3 = (((v0 - 93) && (22 + v2)) == ((39 >= a0[2]) <= (a1[2][14] || a0[9])));
+            v0 = (((i8 || i8) < (v1 && 83)) + ((v1 + v2) % 3));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                v3 = (((a0[7] <= v0) && (v0 / 8)) - ((i8 >= i9) && (v1 != a0[0])));
+                v3 = (((a1[1][5] == a1[1][10]) - (v2 && i8)) ? ((v3 == a0[3]) + (74 % 5)) : ((a1[1][15] == a0[2]) >= (v1 < 60)));
+                a0[14] = (((37 > i8) < (v0 > a0[15])) || ((v3 > v0) >= (a0[6] != a1[3][1])));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    a1[2][12] = (((v3 + a0[9]) || (v2 * 7)) > ((v3 % 9) != (v3 || v0)));
+    if ((((a1[2][7] == v0) ? (a1[3][11] / 8) : (a0[13] < a0[14])) <= ((v0 ? 14 : v3) > (a0[4] + v2)))) {
+        v0 = (((v1 + v1) != (38 || v1)) && ((v3 + v2) ? (a1[0][8] <= a0[7]) : (a0[11] + v1)));
+        a1[2][6] = (((a0[1] * a1[0][15]) == (v0 >= 83)) == ((v1 && a0[5]) && (a1[1][5] + v2)));
+        v1 = (((a0[7] / 5) > (14 >= a1[1][1])) == ((62 <= v1) < (a1[2][3] + a0[12])));
+    } else {
+        a0[11] = (((v2 + a1[0][3]) / 6) != ((96 != v1) * (v1 < v0)));
+        a1[3][4] = (((35 != v0) >= (v2 < a1[2][8])) == ((v3 * a1[2][0]) <= (a0[8] % 1)));
+        v2 = (((17 ? v2 : a1[2][0]) / 9) != ((v0 * v0) == (v0 == a0[8])));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 6) {
+            for (int i11 = 0; i11 < 6; i11 = i11 + 1) {
+                a1[2][6] = (((8 && a1[1][11]) >= (v2 < i11)) && ((v2 ? a0[10] : v0) - (i11 < a1[0][14])));
+                v2 = (((a1[2][9] >= 56) * (a1[3][15] / 6)) <= ((v1 <= i10) ? (v0 || v0) : (i11 <= a1[0][1])));
+                a1[2][5] = (((v2 > v3) >= (v3 + v0)) ? ((v0 ? v1 : a1[2][10]) <= (a0[3] >= 81)) : ((v0 - a0[5]) ? (a1[2][10] / 6) : (20 ? i11 : 13)));
+            }
+            v0 = (((31 <= 96) || (i10 * a1[2][10])) < ((94 ? 9 : v2) <= (a0[12] / 3)));
+            a1[2][9] = (((20 / 6) == (v3 / 9)) > ((v3 || a0[9]) + (i10 && 1)));
+            i10 = i10 + 1;
+        }
+    }
+    return (((v1 == 92) ? (v3 && v1) : (a1[1][14] || v0)) > ((65 <= v3) - (v3 / 6)));
+}
+int f1() {
+    int v0 = 45;
+    int v1 = 27;
+    int v2 = 77;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v3 != a1[0][14]) / 4) / 2);
+    v0 = (((a0[8] <= 4) % 3) < ((v1 || 74) == (23 < 28)));
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((a1[1][10] && a1[0][12]) > 60) break;
+        {
+            int i1 = 0;
+            do {
+                v3 = (((a1[2][14] > v1) != (a1[1][5] % 3)) == ((v3 + i0) > (86 % 6)));
+                v3 = (((v2 != a0[10]) && (77 / 6)) != ((10 >= v0) <= (v0 && i0)));
+                a1[3][1] = (((52 - v2) >= (76 >= i0)) ? ((59 + v1) != (v3 - 98)) : ((i1 <= a0[1]) / 3));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v2 = (((v3 + 35) <= (v2 ? 95 : i0)) >= ((v3 ? a1[0][13] : v2) == (83 - 98)));
+        v0 = (((v1 ? v0 : 68) % 6) - ((88 ? v1 : a1[0][9]) || (a0[1] || a0[15])));
+    }
+    if ((((v3 != v2) || (v1 * 82)) / 7)) {
+        a0[11] = (((v1 == a0[11]) > (v0 != a0[4])) ? ((27 + v2) / 6) : ((10 * v3) / 8));
+        a0[4] = (((v0 && a1[3][8]) < (v3 % 3)) ? ((v1 / 1) <= (a1[0][5] > a1[2][1])) : ((v3 % 4) % 8));
+        a0[15] = (((v1 % 8) >= (v0 ? v0 : a1[3][11])) == ((v1 && 7) || (v2 ? v0 : v3)));
+    } else {
+        a1[0][14] = (((a1[1][6] + 53) ? (v1 ? v2 : 18) : (a0[4] >= 30)) * ((v0 > v0) == (v0 <= v2)));
+        v0 = (((v0 % 3) < (54 < 75)) < ((25 ? v1 : v3) + (v0 >= 54)));
+        v2 = (((v2 - a1[3][9]) || (v0 - v3)) >= ((a1[2][3] == v0) % 7));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[3][7] = (((v0 ? a0[9] : 3) > (a0[0] > 73)) > ((i2 < a1[2][2]) % 3));
+            v3 = (((36 + v2) || (a0[12] && i2)) != ((v0 < 98) * (45 <= v0)));
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[2] != i2) > 65) break;
+                    v0 = (((a1[2][2] >= i3) - (a0[0] <= v2)) / 5);
+                    v1 = (((a1[3][13] - v0) >= (a0[3] % 5)) && ((a1[0][0] == 51) ? (v2 || 68) : (i2 < a0[0])));
+                    v0 = (((i2 * v0) % 7) == ((v2 ? 70 : v3) % 2));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v3 = (((v2 ? v1 : i5) * (v1 >= v3)) * ((47 >= i5) < (a1[0][12] || i5)));
+                v2 = (((v0 && 96) <= (a1[2][7] || 77)) * ((91 * v3) <= (i4 > 82)));
+                a1[2][4] = (((v3 / 2) != (0 + v2)) / 8);
+            }
+            v1 = (((95 / 4) && (v1 / 8)) > ((a1[0][1] % 5) ? (v1 < v1) : (v0 && a0[4])));
+            v1 = (((a1[0][8] * v0) <= (v0 - 43)) ? ((v1 + a1[3][11]) < (v1 <= v1)) : ((v1 < i4) == (a1[3][2] / 8)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((22 == a0[14]) > 67) break;
+            {
+                int i7 = 0;
+                do {
+                    v3 = (((v2 < 85) ? (v0 ? a0[15] : 47) : (96 * v1)) * ((i6 / 8) == (51 || v0)));
+                    v1 = (((v0 - a0[12]) != (v1 < 74)) != ((v1 % 6) < (v2 / 6)));
+                    a1[2][8] = (((84 * 43) <= (a0[4] - a1[2][11])) && ((6 < a1[0][0]) != (93 >= 87)));
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            v0 = (((a1[0][11] < a0[14]) / 2) <= ((a1[1][14] - a1[1][14]) || (v3 / 2)));
+            v3 = (((a0[7] - 42) && (v3 % 8)) == ((i6 < i6) < (96 % 2)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    if ((((v0 + v3) + (v2 / 9)) ? ((v0 && a0[11]) < (v1 != v0)) : ((v2 < a0[7]) % 9))) {
+        v2 = (((51 ? a0[13] : v1) < (v1 % 2)) && ((a0[11] && v2) <= (v0 < v3)));
+        v2 = (((80 ? v0 : a1[3][15]) > (a0[0] - a1[0][4])) - ((v0 >= v0) ? (a0[0] < a0[5]) : (65 == v3)));
+        v1 = (((a0[0] > 30) - (v1 / 7)) && ((a1[2][5] % 7) + (v3 >= v1)));
+    } else {
+        v1 = (((v3 == 83) < (a1[3][5] > a0[9])) == ((a0[8] <= a1[2][0]) / 6));
+        v3 = (((v0 < v3) || (v3 / 7)) ? ((29 < v1) || (10 ? 35 : 39)) : ((v1 < 88) / 7));
+        v2 = (((19 ? v2 : v1) > (a1[1][7] == v3)) % 9);
+    }
+    v1 = (((64 > v1) || (v3 || 90)) + ((34 < 45) ? (v2 <= v0) : (v3 % 2)));
+    if ((((a0[2] != v2) >= (v0 ? 16 : a0[13])) ? ((v1 / 9) <= (42 < 67)) : ((83 + a1[2][8]) / 6))) {
+        a0[0] = (((v1 / 5) > (v0 ? v1 : v2)) != ((v2 != v1) > (25 - v1)));
+        a1[0][10] = (((v2 || v3) ? (a1[3][14] / 3) : (a0[14] - v1)) < ((48 ? a0[5] : v1) > (62 + v0)));
+        v3 = (((v0 >= a1[3][10]) && (v3 < 31)) - ((a0[2] ? a0[5] : v1) / 6));
+    } else {
+        v2 = (((22 < v2) < (v1 ? a1[3][15] : a1[2][15])) * ((77 - 12) ? (60 / 9) : (v2 - v2)));
+        v1 = (((v0 && v3) > (v3 == v3)) > ((a1[1][8] <= v2) - (v1 || v1)));
+        a1[3][15] = (((39 ? v3 : a1[0][10]) % 9) ? ((7 >= v0) <= (83 == 57)) : ((a0[4] && 94) + (v0 == a1[2][7])));
+    }
+    return (((a0[0] % 8) * (v1 * a0[4])) - ((a0[10] % 1) * (39 + a1[1][0])));
+}
+int f2() {
+    int v0 = 68;
+    int v1 = 26;
+    int v2 = 90;
+    int v3 = 42;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a1[3][7] = (((8 || a1[3][11]) >= (92 != v3)) >= ((75 / 9) > (v0 % 9)));
+                v0 = (((v0 ? a0[10] : 87) >= (a1[0][10] > i0)) % 5);
+                a0[5] = (((i0 || a1[0][7]) ? (i0 * a0[4]) : (i0 == i0)) + ((a0[14] ? a1[3][0] : a1[0][4]) == (58 >= a0[8])));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v0 = (((v2 < 98) > (3 % 9)) >= ((v1 / 8) == (v1 <= v3)));
+        v0 = (((22 / 2) < (v1 <= v0)) > ((v2 ? a1[3][5] : v1) / 7));
+    }
+    a0[3] = (((v0 >= v2) ? (v2 >= a0[6]) : (a0[12] - 15)) >= ((7 || 85) <= (a0[15] ? 67 : a1[2][9])));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v1 ? v2 : a1[0][15]) > 76) break;
+        a0[5] = (((a0[7] ? v1 : i2) == (a0[12] < 16)) < ((7 - a1[3][12]) ? (i2 == v2) : (a1[3][5] % 5)));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((i3 * a0[15]) ? (70 % 6) : (49 && v2)) ? ((v3 + v3) - (v3 == a1[2][4])) : ((65 > i2) * (60 + v2)));
+                v0 = (((a1[0][0] && 84) ? (v2 <= 38) : (i2 > v1)) * ((a1[3][4] ? i2 : i2) != (v3 >= 45)));
+                v3 = (((a0[13] ? i3 : 35) >= (a1[2][12] <= 65)) / 2);
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        v2 = (((v2 + i2) <= (v1 * a1[1][15])) < ((i2 > 44) <= (v3 >= 55)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        if ((v2 + 56) > 95) break;
+        {
+            int i5 = 0;
+            do {
+                if ((28 ? v0 : 61) > 58) break;
+                v0 = (((v3 != v3) * (a1[0][7] + i5)) / 2);
+                v2 = (((20 <= a0[10]) && (v2 / 4)) == ((0 ? i5 : a1[3][8]) - (46 + v1)));
+                v3 = (((55 * 94) || (v2 <= i4)) && ((v1 ? 50 : 48) == (v3 == v0)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+        a0[15] = (((72 ? v1 : 8) > (v3 ? 2 : v0)) ? ((84 == 56) + (v2 * v3)) : ((v0 <= a0[2]) / 5));
+        v3 = (((i4 % 6) < (a1[2][12] - a0[4])) ? ((a0[2] + 62) == (a0[9] / 7)) : ((v3 / 8) && (71 > v3)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((21 != 62) > 78) break;
+            v2 = (((95 && i6) >= (a1[3][6] ? i6 : v0)) * ((v1 <= i6) >= (22 * a1[3][2])));
+            a1[3][4] = (((v1 ? v2 : 29) - (54 - v1)) - ((40 - v1) <= (20 ? v2 : v1)));
+            {
+                int i7 = 0;
+                do {
+                    if ((26 % 9) > 75) break;
+                    v2 = (((20 == a0[13]) / 7) ? ((i7 || a1[2][8]) > (v3 >= v1)) : ((89 ? 74 : a0[1]) >= (92 + v0)));
+                    a1[1][5] = (((a1[3][12] != a0[13]) % 9) == ((61 * 77) >= (a1[3][3] && 64)));
+                    v1 = (((v2 / 3) % 9) != ((v1 || 66) ? (a1[0][15] * v2) : (v0 >= v2)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v3 = (((34 % 9) ? (7 && a1[0][9]) : (v3 != v1)) ? ((63 + a0[0]) / 4) : ((a1[3][14] * 54) > (v0 > v2)));
+    {
+        int i8 = 0;
+        do {
+            v1 = (((81 >= 54) / 9) / 5);
+            v1 = (((v2 == a0[5]) - (v0 / 4)) < ((26 == a1[2][6]) / 6));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                a0[4] = (((v0 - 10) != (v2 <= v0)) > ((v3 + a1[1][4]) - (v3 != 40)));
+                v0 = (((v1 && v3) * (39 + v0)) * ((v0 / 5) / 9));
+                a0[4] = (((a1[1][8] > a1[0][8]) % 4) - ((37 + a1[1][15]) ? (v3 == 9) : (4 ? v0 : i8)));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    v0 = (((57 * a0[5]) || (a0[13] ? 14 : a1[0][9])) % 8);
+    for (int i10 = 0; i10 < 4; i10 = i10 + 1) {
+        a0[8] = (((v1 * a0[6]) != (v3 + a1[1][1])) ? ((a0[6] ? a1[0][3] : v0) * (v2 * 62)) : ((a1[2][14] > v1) + (v2 && v3)));
+        for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+            v3 = (((a1[1][7] / 8) >= (v2 || 73)) > ((i11 / 3) != (v0 / 1)));
+            a0[5] = (((v2 > 15) * (v1 || v0)) <= ((a1[2][15] ? v0 : i10) * (v0 != i11)));
+            v0 = (((v2 * 82) == (3 && v3)) ? ((v1 / 8) && (a1[0][5] ? 96 : v2)) : ((v1 && 16) % 8));
+        }
+        a0[12] = (((1 * 43) != (v1 || 60)) * ((i10 == 84) && (83 + v1)));
+    }
+    if ((((v0 ? a1[1][0] : v1) % 6) < ((73 || v0) && (11 < a1[2][3])))) {
+        v2 = (((a1[3][11] >= v2) != (16 ? v3 : v2)) && ((v1 + 70) <= (v2 / 5)));
+        v2 = (((v1 || v3) >= (a1[0][6] < 60)) && ((v1 >= a0[0]) ? (31 <= a0[10]) : (v3 / 4)));
+        v1 = (((v3 ? a0[0] : v1) - (v3 / 4)) && ((a1[2][5] >= v0) <= (v2 <= v3)));
+    } else {
+        v3 = (((v0 >= a0[3]) == (a0[14] + v2)) % 7);
+        a1[0][5] = (((a1[3][2] ? a1[0][6] : v1) % 7) % 6);
+        v2 = (((v0 == v2) || (v2 == v2)) || ((17 * 65) % 7));
+    }
+    return (((v2 * v2) > (v2 <= 73)) == ((82 + v1) < (58 && v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,7090 @@
+    .file 1 "build/bench/batch/f34.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 313 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 314 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 315 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 316 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 317 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 318 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $17, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $19, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $68, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $7, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_6
+    .p2align 4,,10
+.Lf0_5:
+    .loc 1 9 9
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_9
+.Lf0_8:
+    movq $52, %rax
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -16(%rbp), %rax
+.Lf0_10:
+    cmpq $93, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_7
+    jmp .Lf0_3
+.Lf0_7:
+    .loc 1 10 9
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_14
+    jmp .Lf0_15
+.Lf0_14:
+    movq $53, %rax
+    jmp .Lf0_16
+.Lf0_15:
+    movslq -32(%rbp), %rax
+.Lf0_16:
+    cmpq $0, %rax
+    jne .Lf0_11
+    jmp .Lf0_12
+.Lf0_11:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    subq $74, %rax
+    movslq %eax, %rax
+    jmp .Lf0_13
+.Lf0_12:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_17
+    jmp .Lf0_18
+.Lf0_17:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_19
+.Lf0_18:
+    movslq -28(%rbp), %rax
+.Lf0_19:
+.Lf0_13:
+    push %rax
+    movq $67, %rax
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_21
+.Lf0_20:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_22
+.Lf0_21:
+    movslq -4(%rbp), %rax
+.Lf0_22:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $18, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 11 9
+    movq $5, %rax
+    push %rax
+    movq $92, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_24
+    jmp .Lf0_23
+.Lf0_24:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_23:
+    push %rax
+    cmpl $18, -68(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 13 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 14 13
+    jmp .Lf0_28
+    .p2align 4,,10
+.Lf0_27:
+    .loc 1 15 17
+    movslq -20(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $77, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $71, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_29
+.Lf0_30:
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_29:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 16 17
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 17 17
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_34
+    jmp .Lf0_33
+.Lf0_34:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 18 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_26:
+.Lf0_28:
+    .loc 1 14 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_27
+.Lf0_25:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_4:
+    .loc 1 8 30
+    incl -340(%rbp)
+.Lf0_6:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_5
+.Lf0_3:
+    addq $8, %rsp
+    .loc 1 22 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_40
+    .p2align 4,,10
+.Lf0_39:
+    .loc 1 23 9
+    movq $75, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $80, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_41
+    jmp .Lf0_37
+.Lf0_41:
+    .loc 1 24 9
+    movq $4, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_43
+    jmp .Lf0_42
+.Lf0_43:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_42:
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_45
+    jmp .Lf0_44
+.Lf0_45:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_44:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_47
+    jmp .Lf0_46
+.Lf0_47:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_46:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 26 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 27 13
+    jmp .Lf0_51
+    .p2align 4,,10
+.Lf0_50:
+    .loc 1 28 17
+    movq $77, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_52
+    jmp .Lf0_53
+.Lf0_52:
+    movq $91, %rax
+    jmp .Lf0_54
+.Lf0_53:
+    movq $41, %rax
+.Lf0_54:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 29 17
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_59
+    jmp .Lf0_58
+.Lf0_59:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_58:
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_56
+.Lf0_55:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_57
+.Lf0_56:
+    cmpl $66, -340(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf0_57:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_61
+    jmp .Lf0_60
+.Lf0_61:
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_60:
+    movl %eax, -32(%rbp)
+    .loc 1 30 17
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_63
+    jmp .Lf0_62
+.Lf0_63:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_62:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_65
+    jmp .Lf0_64
+.Lf0_65:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_64:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 31 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_49:
+.Lf0_51:
+    .loc 1 27 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_50
+.Lf0_48:
+    addq $0, %rsp
+    .loc 1 34 9
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_66
+.Lf0_67:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_66:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_38:
+    .loc 1 22 30
+    incl -340(%rbp)
+.Lf0_40:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_39
+.Lf0_37:
+    addq $8, %rsp
+    .loc 1 37 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 38 9
+    jmp .Lf0_71
+    .p2align 4,,10
+.Lf0_70:
+    .loc 1 39 13
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_73
+    jmp .Lf0_74
+.Lf0_73:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_75
+.Lf0_74:
+    movq $79, %rax
+.Lf0_75:
+    cmpq $89, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_72
+    jmp .Lf0_68
+.Lf0_72:
+    .loc 1 40 13
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_76
+    jmp .Lf0_77
+.Lf0_76:
+    movslq -4(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_78
+.Lf0_77:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_80
+    jmp .Lf0_79
+.Lf0_80:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_79:
+.Lf0_78:
+    push %rax
+    movq $84, %rax
+    subq $31, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $78, %rax
+    cmpq $42, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 41 13
+    movq $6, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_82
+    jmp .Lf0_81
+.Lf0_82:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_81:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 43 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 44 17
+    jmp .Lf0_86
+    .p2align 4,,10
+.Lf0_85:
+    .loc 1 45 21
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_88
+    jmp .Lf0_87
+.Lf0_88:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_87:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 46 21
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_91
+.Lf0_90:
+    movq $27, %rax
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_93
+.Lf0_92:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_94
+.Lf0_93:
+    movslq -340(%rbp), %rax
+.Lf0_94:
+.Lf0_91:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $62, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 47 21
+    movq $1, %rax
+    push %rax
+    movq $88, %rax
+    cmpq $0, %rax
+    jne .Lf0_95
+    jmp .Lf0_96
+.Lf0_95:
+    movq $36, %rax
+    jmp .Lf0_97
+.Lf0_96:
+    movslq -4(%rbp), %rax
+.Lf0_97:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $98, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 48 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_84:
+.Lf0_86:
+    .loc 1 44 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_85
+.Lf0_83:
+    addq $0, %rsp
+    .loc 1 51 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_69:
+.Lf0_71:
+    .loc 1 38 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_70
+.Lf0_68:
+    addq $8, %rsp
+    .loc 1 55 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 56 9
+    jmp .Lf0_101
+    .p2align 4,,10
+.Lf0_100:
+    .loc 1 57 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_102
+    jmp .Lf0_103
+.Lf0_102:
+    movq $75, %rax
+    jmp .Lf0_104
+.Lf0_103:
+    movslq -4(%rbp), %rax
+.Lf0_104:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_105
+.Lf0_106:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_105:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 58 13
+    movq $12, %rax
+    cmpq $0, %rax
+    jne .Lf0_107
+    jmp .Lf0_108
+.Lf0_107:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_109
+.Lf0_108:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf0_109:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $16, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -28(%rbp)
+    .loc 1 59 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_115
+    .p2align 4,,10
+.Lf0_114:
+    .loc 1 60 17
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_116
+    jmp .Lf0_117
+.Lf0_116:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_120
+.Lf0_119:
+    cmpl $44, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_121
+.Lf0_120:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_121:
+    jmp .Lf0_118
+.Lf0_117:
+    movslq -4(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_122
+.Lf0_123:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_122:
+.Lf0_118:
+    movl %eax, -4(%rbp)
+    .loc 1 61 17
+    movslq -8(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $99, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_124
+    jmp .Lf0_125
+.Lf0_124:
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_128
+.Lf0_127:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_129
+.Lf0_128:
+    movslq -8(%rbp), %rax
+.Lf0_129:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_126
+.Lf0_125:
+    movq $39, %rax
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_131
+.Lf0_130:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -8(%rbp), %rax
+.Lf0_132:
+    push %rax
+    movslq -44(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf0_126:
+    movl %eax, -4(%rbp)
+    .loc 1 62 17
+    movslq -12(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_136
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_138
+.Lf0_137:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_140
+    jmp .Lf0_139
+.Lf0_140:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_139:
+.Lf0_138:
+    cmpq $0, %rax
+    jne .Lf0_133
+    jmp .Lf0_134
+.Lf0_133:
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_142
+    jmp .Lf0_141
+.Lf0_142:
+    movq $64, %rax
+    cmpq $0, %rax
+    jne .Lf0_143
+    jmp .Lf0_144
+.Lf0_143:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_145
+.Lf0_144:
+    movq $43, %rax
+.Lf0_145:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_141:
+    jmp .Lf0_135
+.Lf0_134:
+    movq $71, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $73, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_135:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_113:
+    .loc 1 59 38
+    incl -344(%rbp)
+.Lf0_115:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_114
+.Lf0_112:
+    addq $0, %rsp
+    .loc 1 64 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_99:
+.Lf0_101:
+    .loc 1 56 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_100
+.Lf0_98:
+    addq $8, %rsp
+    .loc 1 67 5
+    movq $2, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_147
+    jmp .Lf0_146
+.Lf0_147:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_146:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 68 5
+    movslq -4(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_149
+.Lf0_148:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_150
+.Lf0_149:
+    movq $28, %rax
+.Lf0_150:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_152
+    jmp .Lf0_151
+.Lf0_152:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_151:
+    push %rax
+    movslq -32(%rbp), %rax
+    imulq $98, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 70 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 71 9
+    .p2align 4,,10
+.Lf0_155:
+    .loc 1 72 13
+    movslq -4(%rbp), %rax
+    subq $93, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_157
+    jmp .Lf0_156
+.Lf0_157:
+    movq $22, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_156:
+    push %rax
+    movq $39, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_159
+    jmp .Lf0_158
+.Lf0_159:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_158:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 73 13
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_161
+    jmp .Lf0_160
+.Lf0_161:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_160:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_162
+.Lf0_163:
+    movq $83, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_162:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 74 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_169
+    .p2align 4,,10
+.Lf0_168:
+    .loc 1 75 17
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_171
+    jmp .Lf0_170
+.Lf0_171:
+    movslq -8(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_170:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_172
+.Lf0_173:
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_172:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 76 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_175
+.Lf0_174:
+    movq $5, %rax
+    push %rax
+    movq $74, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_176
+.Lf0_175:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $60, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_176:
+    movl %eax, -16(%rbp)
+    .loc 1 77 17
+    movq $37, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_180
+    jmp .Lf0_179
+.Lf0_180:
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_179:
+    movl %eax, -24(%rbp)
+    addq $0, %rsp
+.Lf0_167:
+    .loc 1 74 38
+    incl -344(%rbp)
+.Lf0_169:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_168
+.Lf0_166:
+    addq $0, %rsp
+    .loc 1 79 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_154:
+    .loc 1 80 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_155
+.Lf0_153:
+    addq $8, %rsp
+    .loc 1 82 5
+    movslq -16(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_182
+    jmp .Lf0_181
+.Lf0_182:
+    movslq -12(%rbp), %rax
+    imulq $7, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_181:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_184
+    jmp .Lf0_183
+.Lf0_184:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_183:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 83 5
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_186
+    jmp .Lf0_187
+.Lf0_186:
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_188
+.Lf0_187:
+    movslq -28(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf0_188:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_189
+    jmp .Lf0_190
+.Lf0_189:
+    movq $14, %rax
+    jmp .Lf0_191
+.Lf0_190:
+    movslq -16(%rbp), %rax
+.Lf0_191:
+    push %rax
+    movslq -64(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf0_192
+    .loc 1 84 9
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $38, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_194
+    jmp .Lf0_193
+.Lf0_194:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_193:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_196
+    jmp .Lf0_195
+.Lf0_196:
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_197
+    jmp .Lf0_198
+.Lf0_197:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_199
+.Lf0_198:
+    movslq -36(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_199:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_195:
+    movl %eax, -4(%rbp)
+    .loc 1 85 9
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $83, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_201
+    jmp .Lf0_200
+.Lf0_201:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_200:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_203
+    jmp .Lf0_202
+.Lf0_203:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_202:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 86 9
+    movq $5, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $14, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $62, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -32(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_185
+.Lf0_192:
+    .loc 1 88 9
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $96, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -36(%rbp)
+    .loc 1 89 9
+    movq $35, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 90 9
+    movq $9, %rax
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf0_204
+    jmp .Lf0_205
+.Lf0_204:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_206
+.Lf0_205:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf0_206:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_185:
+    .loc 1 93 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 94 9
+    jmp .Lf0_210
+    .p2align 4,,10
+.Lf0_209:
+    .loc 1 95 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_216
+    .p2align 4,,10
+.Lf0_215:
+    .loc 1 96 17
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_218
+    jmp .Lf0_217
+.Lf0_218:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_217:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_219
+.Lf0_220:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_221
+    jmp .Lf0_222
+.Lf0_221:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_223
+.Lf0_222:
+    movslq -4(%rbp), %rax
+.Lf0_223:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_219:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 97 17
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_224
+    jmp .Lf0_225
+.Lf0_224:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_228
+    jmp .Lf0_227
+.Lf0_228:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_227:
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_226:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 98 17
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_229
+    jmp .Lf0_230
+.Lf0_229:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_233
+.Lf0_232:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_234
+.Lf0_233:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf0_234:
+    push %rax
+    cmpl $81, -68(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_231
+.Lf0_230:
+    movslq -4(%rbp), %rax
+    subl -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_235
+    jmp .Lf0_236
+.Lf0_235:
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_237
+.Lf0_236:
+    movq $20, %rax
+    cmpq $0, %rax
+    jne .Lf0_238
+    jmp .Lf0_239
+.Lf0_238:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_240
+.Lf0_239:
+    movq $13, %rax
+.Lf0_240:
+.Lf0_237:
+.Lf0_231:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_214:
+    .loc 1 95 40
+    incl -344(%rbp)
+.Lf0_216:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_215
+.Lf0_213:
+    addq $0, %rsp
+    .loc 1 100 13
+    movq $31, %rax
+    cmpq $96, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_242
+    jmp .Lf0_241
+.Lf0_242:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_241:
+    push %rax
+    movq $94, %rax
+    cmpq $0, %rax
+    jne .Lf0_243
+    jmp .Lf0_244
+.Lf0_243:
+    movq $9, %rax
+    jmp .Lf0_245
+.Lf0_244:
+    movslq -12(%rbp), %rax
+.Lf0_245:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 101 13
+    movq $6, %rax
+    push %rax
+    movq $20, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_247
+    jmp .Lf0_246
+.Lf0_247:
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_246:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_249
+    jmp .Lf0_248
+.Lf0_249:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_248:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 102 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_208:
+.Lf0_210:
+    .loc 1 94 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_209
+.Lf0_207:
+    addq $8, %rsp
+    .loc 1 105 5
+    cmpl $92, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_251
+.Lf0_250:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_254
+    jmp .Lf0_253
+.Lf0_254:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_253:
+    jmp .Lf0_252
+.Lf0_251:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_256
+    jmp .Lf0_255
+.Lf0_256:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_255:
+.Lf0_252:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $65, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 107 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 108 5
+    subq $8, %rsp
+    movq $45, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 109 5
+    movq $27, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 110 5
+    subq $8, %rsp
+    movq $77, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 111 5
+    movq $50, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 112 5
+    subq $64, %rsp
+    .loc 1 113 5
+    subq $256, %rsp
+    .loc 1 114 5
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 115 5
+    movq $3, %rax
+    push %rax
+    cmpl $4, -48(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_2
+    jmp .Lf1_1
+.Lf1_2:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_1:
+    push %rax
+    movq $23, %rax
+    cmpq $28, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 116 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_8
+    .p2align 4,,10
+.Lf1_7:
+    .loc 1 117 9
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_11
+    jmp .Lf1_10
+.Lf1_11:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_10:
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_9
+    jmp .Lf1_5
+.Lf1_9:
+    .loc 1 119 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 120 13
+    .p2align 4,,10
+.Lf1_14:
+    .loc 1 121 17
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $86, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 122 17
+    movslq -12(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_16
+    jmp .Lf1_15
+.Lf1_16:
+    movq $6, %rax
+    push %rax
+    movq $77, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_15:
+    push %rax
+    movq $10, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_17
+.Lf1_18:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_17:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 123 17
+    movq $52, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $76, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_19
+    jmp .Lf1_20
+.Lf1_19:
+    movq $59, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $98, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_21
+.Lf1_20:
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_21:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 124 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_13:
+    .loc 1 125 22
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_14
+.Lf1_12:
+    addq $0, %rsp
+    .loc 1 127 9
+    movslq -16(%rbp), %rax
+    addq $35, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_23
+.Lf1_22:
+    movq $95, %rax
+    jmp .Lf1_24
+.Lf1_23:
+    movslq -340(%rbp), %rax
+.Lf1_24:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_25
+    jmp .Lf1_26
+.Lf1_25:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf1_27
+.Lf1_26:
+    movslq -12(%rbp), %rax
+.Lf1_27:
+    push %rax
+    movq $83, %rax
+    subq $98, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 128 9
+    movq $88, %rax
+    cmpq $0, %rax
+    jne .Lf1_28
+    jmp .Lf1_29
+.Lf1_28:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_30
+.Lf1_29:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf1_30:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_32
+    jmp .Lf1_31
+.Lf1_32:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_34
+    jmp .Lf1_33
+.Lf1_34:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_33:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_31:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_35
+    jmp .Lf1_36
+.Lf1_35:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_37
+.Lf1_36:
+    movq $68, %rax
+.Lf1_37:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_6:
+    .loc 1 116 30
+    incl -340(%rbp)
+.Lf1_8:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_7
+.Lf1_5:
+    addq $8, %rsp
+    .loc 1 130 5
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_40
+    jmp .Lf1_39
+.Lf1_40:
+    movslq -8(%rbp), %rax
+    imulq $82, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_39:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_41
+    .loc 1 131 9
+    movslq -8(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_42
+    jmp .Lf1_43
+.Lf1_42:
+    movq $6, %rax
+    push %rax
+    movq $27, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_44
+.Lf1_43:
+    movq $8, %rax
+    push %rax
+    movq $10, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_44:
+    movl %eax, -36(%rbp)
+    .loc 1 132 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_49
+    jmp .Lf1_48
+.Lf1_49:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_48:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_45
+    jmp .Lf1_46
+.Lf1_45:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_47
+.Lf1_46:
+    movq $8, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_47:
+    movl %eax, -64(%rbp)
+    .loc 1 133 9
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_50
+    jmp .Lf1_51
+.Lf1_50:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_52
+.Lf1_51:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_52:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_54
+    jmp .Lf1_53
+.Lf1_54:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_53:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_56
+    jmp .Lf1_55
+.Lf1_56:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_57
+    jmp .Lf1_58
+.Lf1_57:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_59
+.Lf1_58:
+    movslq -16(%rbp), %rax
+.Lf1_59:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_38
+.Lf1_41:
+    .loc 1 135 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    addq $53, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_60
+    jmp .Lf1_61
+.Lf1_60:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_63
+    jmp .Lf1_64
+.Lf1_63:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_65
+.Lf1_64:
+    movq $18, %rax
+.Lf1_65:
+    jmp .Lf1_62
+.Lf1_61:
+    cmpl $30, -64(%rbp)
+    movq $0, %rax
+    setge %al
+.Lf1_62:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 136 9
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $54, %rax
+    cmpq $75, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $54, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_67
+.Lf1_66:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_68
+.Lf1_67:
+    movslq -16(%rbp), %rax
+.Lf1_68:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 137 9
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_70
+    jmp .Lf1_69
+.Lf1_70:
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_69:
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_38:
+    .loc 1 140 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 141 9
+    .p2align 4,,10
+.Lf1_73:
+    .loc 1 142 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_74
+    jmp .Lf1_75
+.Lf1_74:
+    movslq -44(%rbp), %rax
+    jmp .Lf1_76
+.Lf1_75:
+    movq $3, %rax
+.Lf1_76:
+    push %rax
+    cmpl $73, -80(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 143 13
+    movq $36, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_78
+    jmp .Lf1_77
+.Lf1_78:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_80
+    jmp .Lf1_79
+.Lf1_80:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_79:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_77:
+    push %rax
+    movq $45, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $98, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 145 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 146 17
+    .p2align 4,,10
+.Lf1_83:
+    .loc 1 147 21
+    movslq -72(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_84
+    jmp .Lf1_81
+.Lf1_84:
+    .loc 1 148 21
+    movq $5, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 149 21
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_86
+    jmp .Lf1_85
+.Lf1_86:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_87
+    jmp .Lf1_88
+.Lf1_87:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_91
+    jmp .Lf1_90
+.Lf1_91:
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_90:
+    jmp .Lf1_89
+.Lf1_88:
+    movslq -340(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf1_89:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_85:
+    movl %eax, -8(%rbp)
+    .loc 1 150 21
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_92
+    jmp .Lf1_93
+.Lf1_92:
+    movq $70, %rax
+    jmp .Lf1_94
+.Lf1_93:
+    movslq -16(%rbp), %rax
+.Lf1_94:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 151 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_82:
+    .loc 1 152 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_83
+.Lf1_81:
+    addq $0, %rsp
+    .loc 1 154 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_72:
+    .loc 1 155 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_73
+.Lf1_71:
+    addq $8, %rsp
+    .loc 1 158 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 159 9
+    jmp .Lf1_98
+    .p2align 4,,10
+.Lf1_97:
+    .loc 1 160 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 161 17
+    movq $47, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_105
+    jmp .Lf1_104
+.Lf1_105:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_104:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_106
+    jmp .Lf1_107
+.Lf1_106:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_108
+.Lf1_107:
+    movslq -344(%rbp), %rax
+.Lf1_108:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 162 17
+    movq $91, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $82, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_110
+    jmp .Lf1_109
+.Lf1_110:
+    movq $96, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_109:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_112
+    jmp .Lf1_111
+.Lf1_112:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_111:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 163 17
+    movq $8, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $0, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_103:
+    .loc 1 160 38
+    incl -344(%rbp)
+    .loc 1 161 17
+    movq $47, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_115
+    jmp .Lf1_116
+.Lf1_115:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_117
+.Lf1_116:
+    movslq -344(%rbp), %rax
+.Lf1_117:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 162 17
+    movq $91, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $82, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_119
+    jmp .Lf1_118
+.Lf1_119:
+    movq $96, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_118:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_121
+    jmp .Lf1_120
+.Lf1_121:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_120:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 163 17
+    movq $8, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $0, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_102:
+    .loc 1 160 38
+    incl -344(%rbp)
+.Lf1_101:
+    addq $0, %rsp
+    .loc 1 165 13
+    movq $4, %rax
+    push %rax
+    movq $95, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_123
+    jmp .Lf1_122
+.Lf1_123:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_122:
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_124
+    jmp .Lf1_125
+.Lf1_124:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_126
+.Lf1_125:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_128
+    jmp .Lf1_127
+.Lf1_128:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_127:
+.Lf1_126:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 166 13
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $43, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_129
+    jmp .Lf1_130
+.Lf1_129:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_131
+.Lf1_130:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf1_131:
+    movl %eax, -8(%rbp)
+    .loc 1 167 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_96:
+.Lf1_98:
+    .loc 1 159 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_97
+.Lf1_95:
+    addq $8, %rsp
+    .loc 1 171 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 172 9
+    .p2align 4,,10
+.Lf1_134:
+    .loc 1 173 13
+    movq $22, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $67, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_135
+    jmp .Lf1_132
+.Lf1_135:
+    .loc 1 175 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 176 17
+    .p2align 4,,10
+.Lf1_138:
+    .loc 1 177 21
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_140
+    jmp .Lf1_139
+.Lf1_140:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_139:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $85, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_141
+    jmp .Lf1_142
+.Lf1_141:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_144
+    jmp .Lf1_145
+.Lf1_144:
+    movslq -20(%rbp), %rax
+    jmp .Lf1_146
+.Lf1_145:
+    movq $47, %rax
+.Lf1_146:
+    jmp .Lf1_143
+.Lf1_142:
+    movq $96, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_143:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 178 21
+    movslq -4(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $74, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 179 21
+    movq $84, %rax
+    imulq $43, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_148
+    jmp .Lf1_147
+.Lf1_148:
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $93, %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_147:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 180 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_137:
+    .loc 1 181 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_138
+.Lf1_136:
+    addq $0, %rsp
+    .loc 1 183 13
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_150
+    jmp .Lf1_149
+.Lf1_150:
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_149:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 184 13
+    movslq -52(%rbp), %rax
+    subq $42, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_152
+    jmp .Lf1_151
+.Lf1_152:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_151:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 185 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_133:
+    .loc 1 186 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_134
+.Lf1_132:
+    addq $8, %rsp
+    .loc 1 188 5
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_154
+    jmp .Lf1_155
+.Lf1_154:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_158
+    jmp .Lf1_157
+.Lf1_158:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_157:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_156
+.Lf1_155:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_156:
+    cmpq $0, %rax
+    je .Lf1_159
+    .loc 1 189 9
+    movq $51, %rax
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_161
+.Lf1_160:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_162
+.Lf1_161:
+    movslq -8(%rbp), %rax
+.Lf1_162:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_164
+    jmp .Lf1_163
+.Lf1_164:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_163:
+    movl %eax, -12(%rbp)
+    .loc 1 190 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_167
+    jmp .Lf1_168
+.Lf1_167:
+    movslq -80(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_169
+.Lf1_168:
+    movq $65, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_169:
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    jne .Lf1_170
+    jmp .Lf1_171
+.Lf1_170:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_172
+.Lf1_171:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf1_172:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 191 9
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $30, -80(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_174
+    jmp .Lf1_173
+.Lf1_174:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_173:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_153
+.Lf1_159:
+    .loc 1 193 9
+    cmpl $83, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 194 9
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_179
+    jmp .Lf1_178
+.Lf1_179:
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_178:
+    cmpq $0, %rax
+    jne .Lf1_175
+    jmp .Lf1_176
+.Lf1_175:
+    movq $29, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_181
+    jmp .Lf1_180
+.Lf1_181:
+    movq $10, %rax
+    cmpq $0, %rax
+    jne .Lf1_182
+    jmp .Lf1_183
+.Lf1_182:
+    movq $35, %rax
+    jmp .Lf1_184
+.Lf1_183:
+    movq $39, %rax
+.Lf1_184:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_180:
+    jmp .Lf1_177
+.Lf1_176:
+    movq $7, %rax
+    push %rax
+    cmpl $88, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_177:
+    movl %eax, -16(%rbp)
+    .loc 1 195 9
+    movq $9, %rax
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf1_185
+    jmp .Lf1_186
+.Lf1_185:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_187
+.Lf1_186:
+    movslq -8(%rbp), %rax
+.Lf1_187:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_153:
+    .loc 1 197 5
+    movq $34, %rax
+    cmpq $45, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_188
+    jmp .Lf1_189
+.Lf1_188:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_190
+.Lf1_189:
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_190:
+    push %rax
+    movq $64, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_192
+    jmp .Lf1_191
+.Lf1_192:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_194
+    jmp .Lf1_193
+.Lf1_194:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_193:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_191:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 198 5
+    movslq -72(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_199
+    jmp .Lf1_200
+.Lf1_199:
+    movq $16, %rax
+    jmp .Lf1_201
+.Lf1_200:
+    movslq -28(%rbp), %rax
+.Lf1_201:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_196
+    jmp .Lf1_197
+.Lf1_196:
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $42, %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_198
+.Lf1_197:
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    addq $83, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_198:
+    cmpq $0, %rax
+    je .Lf1_202
+    .loc 1 199 9
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_203
+    jmp .Lf1_204
+.Lf1_203:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_205
+.Lf1_204:
+    movslq -12(%rbp), %rax
+.Lf1_205:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $25, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -80(%rbp)
+    .loc 1 200 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_210
+    jmp .Lf1_209
+.Lf1_210:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_209:
+    cmpq $0, %rax
+    jne .Lf1_206
+    jmp .Lf1_207
+.Lf1_206:
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_208
+.Lf1_207:
+    movslq -24(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_208:
+    push %rax
+    movq $48, %rax
+    cmpq $0, %rax
+    jne .Lf1_211
+    jmp .Lf1_212
+.Lf1_211:
+    movslq -60(%rbp), %rax
+    jmp .Lf1_213
+.Lf1_212:
+    movslq -8(%rbp), %rax
+.Lf1_213:
+    push %rax
+    movq $62, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 201 9
+    movq $6, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_214
+    jmp .Lf1_215
+.Lf1_214:
+    movslq -60(%rbp), %rax
+    jmp .Lf1_216
+.Lf1_215:
+    movslq -8(%rbp), %rax
+.Lf1_216:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_218
+    jmp .Lf1_217
+.Lf1_218:
+    cmpl $31, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_217:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_195
+.Lf1_202:
+    .loc 1 203 9
+    movq $77, %rax
+    subq $12, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_219
+    jmp .Lf1_220
+.Lf1_219:
+    movq $9, %rax
+    push %rax
+    movq $60, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_221
+.Lf1_220:
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_221:
+    push %rax
+    movq $22, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_222
+    jmp .Lf1_223
+.Lf1_222:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf1_224
+.Lf1_223:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf1_224:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 204 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_226
+    jmp .Lf1_225
+.Lf1_226:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_225:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_228
+    jmp .Lf1_227
+.Lf1_228:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_227:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 205 9
+    movq $9, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    jne .Lf1_232
+    jmp .Lf1_233
+.Lf1_232:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_234
+.Lf1_233:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf1_234:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_229
+    jmp .Lf1_230
+.Lf1_229:
+    movq $7, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $83, %rax
+    cmpq $57, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_231
+.Lf1_230:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_236
+    jmp .Lf1_235
+.Lf1_236:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_235:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf1_231:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_195:
+    .loc 1 207 5
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    addq $39, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 209 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 210 5
+    subq $8, %rsp
+    movq $68, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 211 5
+    movq $26, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 212 5
+    subq $8, %rsp
+    movq $90, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 213 5
+    movq $42, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 214 5
+    subq $64, %rsp
+    .loc 1 215 5
+    subq $256, %rsp
+    .loc 1 216 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_6
+    .p2align 4,,10
+.Lf2_5:
+    .loc 1 218 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 219 13
+    .p2align 4,,10
+.Lf2_9:
+    .loc 1 220 17
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_11
+    jmp .Lf2_10
+.Lf2_11:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_10:
+    push %rax
+    movq $92, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $75, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 221 17
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_12
+    jmp .Lf2_13
+.Lf2_12:
+    movslq -40(%rbp), %rax
+    jmp .Lf2_14
+.Lf2_13:
+    movq $87, %rax
+.Lf2_14:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 222 17
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_15
+    jmp .Lf2_16
+.Lf2_15:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf2_17
+.Lf2_16:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf2_17:
+    push %rax
+    movq $58, %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_22
+    jmp .Lf2_21
+.Lf2_22:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_21:
+    cmpq $0, %rax
+    jne .Lf2_18
+    jmp .Lf2_19
+.Lf2_18:
+    movslq -340(%rbp), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_20
+.Lf2_19:
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf2_20:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -60(%rbp)
+    .loc 1 223 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_8:
+    .loc 1 224 22
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_9
+.Lf2_7:
+    addq $0, %rsp
+    .loc 1 226 9
+    cmpl $98, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 227 9
+    movq $2, %rax
+    push %rax
+    movq $22, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_23
+    jmp .Lf2_24
+.Lf2_23:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf2_25
+.Lf2_24:
+    movslq -8(%rbp), %rax
+.Lf2_25:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_4:
+    .loc 1 216 30
+    incl -340(%rbp)
+.Lf2_6:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_5
+.Lf2_3:
+    addq $8, %rsp
+    .loc 1 229 5
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_26
+    jmp .Lf2_27
+.Lf2_26:
+    movslq -12(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_28
+.Lf2_27:
+    movslq -32(%rbp), %rax
+    subq $15, %rax
+    movslq %eax, %rax
+.Lf2_28:
+    push %rax
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_30
+    jmp .Lf2_29
+.Lf2_30:
+    movq $85, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_29:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_32
+.Lf2_31:
+    movq $67, %rax
+    jmp .Lf2_33
+.Lf2_32:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf2_33:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -68(%rbp)
+    .loc 1 230 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_39
+    .p2align 4,,10
+.Lf2_38:
+    .loc 1 231 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_41
+    jmp .Lf2_42
+.Lf2_41:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_43
+.Lf2_42:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf2_43:
+    cmpq $76, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_40
+    jmp .Lf2_36
+.Lf2_40:
+    .loc 1 232 9
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_44
+    jmp .Lf2_45
+.Lf2_44:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_46
+.Lf2_45:
+    movslq -340(%rbp), %rax
+.Lf2_46:
+    push %rax
+    cmpl $16, -32(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    movq $7, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_47
+    jmp .Lf2_48
+.Lf2_47:
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_49
+.Lf2_48:
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_49:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -60(%rbp)
+    .loc 1 234 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 235 13
+    .p2align 4,,10
+.Lf2_52:
+    .loc 1 236 17
+    movslq -344(%rbp), %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_56
+    jmp .Lf2_57
+.Lf2_56:
+    movq $6, %rax
+    push %rax
+    movq $70, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_58
+.Lf2_57:
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_60
+    jmp .Lf2_59
+.Lf2_60:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_59:
+.Lf2_58:
+    cmpq $0, %rax
+    jne .Lf2_53
+    jmp .Lf2_54
+.Lf2_53:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_55
+.Lf2_54:
+    movq $60, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $65, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf2_55:
+    movl %eax, -4(%rbp)
+    .loc 1 237 17
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_61
+    jmp .Lf2_62
+.Lf2_61:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_63
+.Lf2_62:
+    movslq -340(%rbp), %rax
+.Lf2_63:
+    push %rax
+    cmpl $45, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_68
+    jmp .Lf2_67
+.Lf2_68:
+    movq $84, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_67:
+    cmpq $0, %rax
+    jne .Lf2_64
+    jmp .Lf2_65
+.Lf2_64:
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_66
+.Lf2_65:
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_66:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 238 17
+    movq $2, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_69
+    jmp .Lf2_70
+.Lf2_69:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_71
+.Lf2_70:
+    movq $35, %rax
+.Lf2_71:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $65, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 239 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_51:
+    .loc 1 240 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_52
+.Lf2_50:
+    addq $0, %rsp
+    .loc 1 242 9
+    movslq -12(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $44, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $55, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_37:
+    .loc 1 230 30
+    incl -340(%rbp)
+.Lf2_39:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_38
+.Lf2_36:
+    addq $8, %rsp
+    .loc 1 244 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_77
+    .p2align 4,,10
+.Lf2_76:
+    .loc 1 245 9
+    movslq -12(%rbp), %rax
+    addq $56, %rax
+    movslq %eax, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_78
+    jmp .Lf2_74
+.Lf2_78:
+    .loc 1 247 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 248 13
+    .p2align 4,,10
+.Lf2_81:
+    .loc 1 249 17
+    movq $28, %rax
+    cmpq $0, %rax
+    jne .Lf2_83
+    jmp .Lf2_84
+.Lf2_83:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_85
+.Lf2_84:
+    movq $61, %rax
+.Lf2_85:
+    cmpq $58, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_82
+    jmp .Lf2_79
+.Lf2_82:
+    .loc 1 250 17
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 251 17
+    movq $20, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_87
+    jmp .Lf2_86
+.Lf2_87:
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_86:
+    push %rax
+    movq $46, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $0, %rax
+    cmpq $0, %rax
+    jne .Lf2_88
+    jmp .Lf2_89
+.Lf2_88:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_90
+.Lf2_89:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf2_90:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 252 17
+    movq $55, %rax
+    imulq $94, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_92
+    jmp .Lf2_91
+.Lf2_92:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_91:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_94
+    jmp .Lf2_93
+.Lf2_94:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_95
+    jmp .Lf2_96
+.Lf2_95:
+    movq $50, %rax
+    jmp .Lf2_97
+.Lf2_96:
+    movq $48, %rax
+.Lf2_97:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_93:
+    movl %eax, -16(%rbp)
+    .loc 1 253 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_80:
+    .loc 1 254 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_81
+.Lf2_79:
+    addq $0, %rsp
+    .loc 1 256 9
+    movq $72, %rax
+    cmpq $0, %rax
+    jne .Lf2_101
+    jmp .Lf2_102
+.Lf2_101:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_103
+.Lf2_102:
+    movq $8, %rax
+.Lf2_103:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_104
+    jmp .Lf2_105
+.Lf2_104:
+    movq $2, %rax
+    jmp .Lf2_106
+.Lf2_105:
+    movslq -4(%rbp), %rax
+.Lf2_106:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_98
+    jmp .Lf2_99
+.Lf2_98:
+    movslq -12(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $84, %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_100
+.Lf2_99:
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_100:
+    movl %eax, -20(%rbp)
+    .loc 1 257 9
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    subl -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_107
+    jmp .Lf2_108
+.Lf2_107:
+    movslq -72(%rbp), %rax
+    addq $62, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_109
+.Lf2_108:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_111
+    jmp .Lf2_110
+.Lf2_111:
+    movq $71, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_110:
+.Lf2_109:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_75:
+    .loc 1 244 30
+    incl -340(%rbp)
+.Lf2_77:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_76
+.Lf2_74:
+    addq $8, %rsp
+    .loc 1 260 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 261 9
+    jmp .Lf2_115
+    .p2align 4,,10
+.Lf2_114:
+    .loc 1 262 13
+    movq $21, %rax
+    cmpq $62, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $78, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_116
+    jmp .Lf2_112
+.Lf2_116:
+    .loc 1 263 13
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    imulq $22, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_118
+    jmp .Lf2_117
+.Lf2_118:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_117:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_119
+    jmp .Lf2_120
+.Lf2_119:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_121
+.Lf2_120:
+    movslq -4(%rbp), %rax
+.Lf2_121:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 264 13
+    movq $40, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $20, %rax
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_123
+.Lf2_122:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_124
+.Lf2_123:
+    movslq -8(%rbp), %rax
+.Lf2_124:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $54, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_125
+    jmp .Lf2_126
+.Lf2_125:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_127
+.Lf2_126:
+    movq $29, %rax
+.Lf2_127:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 266 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 267 17
+    .p2align 4,,10
+.Lf2_130:
+    .loc 1 268 21
+    movq $9, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $75, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_131
+    jmp .Lf2_128
+.Lf2_131:
+    .loc 1 269 21
+    movq $7, %rax
+    push %rax
+    movq $20, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_132
+    jmp .Lf2_133
+.Lf2_132:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_136
+    jmp .Lf2_135
+.Lf2_136:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_135:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_134
+.Lf2_133:
+    movq $89, %rax
+    cmpq $0, %rax
+    jne .Lf2_137
+    jmp .Lf2_138
+.Lf2_137:
+    movq $74, %rax
+    jmp .Lf2_139
+.Lf2_138:
+    movslq -76(%rbp), %rax
+.Lf2_139:
+    push %rax
+    movq $92, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_134:
+    movl %eax, -12(%rbp)
+    .loc 1 270 21
+    movq $9, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $61, %rax
+    imulq $77, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_141
+    jmp .Lf2_140
+.Lf2_141:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_140:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 271 21
+    movq $9, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_146
+    jmp .Lf2_145
+.Lf2_146:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_145:
+    cmpq $0, %rax
+    jne .Lf2_142
+    jmp .Lf2_143
+.Lf2_142:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_144
+.Lf2_143:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_144:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 272 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_129:
+    .loc 1 273 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_130
+.Lf2_128:
+    addq $0, %rsp
+    .loc 1 275 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_113:
+.Lf2_115:
+    .loc 1 261 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_114
+.Lf2_112:
+    addq $8, %rsp
+    .loc 1 278 5
+    movq $9, %rax
+    push %rax
+    movq $34, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_150
+    jmp .Lf2_151
+.Lf2_150:
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_154
+    jmp .Lf2_153
+.Lf2_154:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_153:
+    jmp .Lf2_152
+.Lf2_151:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf2_152:
+    cmpq $0, %rax
+    jne .Lf2_147
+    jmp .Lf2_148
+.Lf2_147:
+    movq $4, %rax
+    push %rax
+    movq $63, %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf2_149
+.Lf2_148:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    imulq $54, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_149:
+    movl %eax, -16(%rbp)
+    .loc 1 280 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 281 9
+    .p2align 4,,10
+.Lf2_157:
+    .loc 1 282 13
+    movq $5, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $81, %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 283 13
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $26, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 284 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_163
+    .p2align 4,,10
+.Lf2_162:
+    .loc 1 285 17
+    movslq -4(%rbp), %rax
+    subq $10, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $40, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -64(%rbp)
+    .loc 1 286 17
+    movq $9, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $39, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_165
+    jmp .Lf2_164
+.Lf2_165:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_164:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 287 17
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    addq $37, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_166
+    jmp .Lf2_167
+.Lf2_166:
+    cmpl $9, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_168
+.Lf2_167:
+    movq $4, %rax
+    cmpq $0, %rax
+    jne .Lf2_169
+    jmp .Lf2_170
+.Lf2_169:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_171
+.Lf2_170:
+    movslq -340(%rbp), %rax
+.Lf2_171:
+.Lf2_168:
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -64(%rbp)
+    addq $0, %rsp
+.Lf2_161:
+    .loc 1 284 38
+    incl -344(%rbp)
+.Lf2_163:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_162
+.Lf2_160:
+    addq $0, %rsp
+    .loc 1 289 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_156:
+    .loc 1 290 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_157
+.Lf2_155:
+    addq $8, %rsp
+    .loc 1 292 5
+    movq $8, %rax
+    push %rax
+    movq $57, %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_173
+    jmp .Lf2_172
+.Lf2_173:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_174
+    jmp .Lf2_175
+.Lf2_174:
+    movq $14, %rax
+    jmp .Lf2_176
+.Lf2_175:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf2_176:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_172:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 293 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_182
+    .p2align 4,,10
+.Lf2_181:
+    .loc 1 294 9
+    movslq -8(%rbp), %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_183
+    jmp .Lf2_184
+.Lf2_183:
+    movslq -12(%rbp), %rax
+    imulq $62, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_186
+    jmp .Lf2_187
+.Lf2_186:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf2_188
+.Lf2_187:
+    movslq -4(%rbp), %rax
+.Lf2_188:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_185
+.Lf2_184:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_190
+    jmp .Lf2_189
+.Lf2_190:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_189:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_185:
+    movl %eax, -48(%rbp)
+    .loc 1 295 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_196
+    .p2align 4,,10
+.Lf2_195:
+    .loc 1 296 13
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_198
+    jmp .Lf2_197
+.Lf2_198:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_197:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 297 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_200
+    jmp .Lf2_199
+.Lf2_200:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_199:
+    push %rax
+    cmpl $15, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_201
+    jmp .Lf2_202
+.Lf2_201:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_203
+.Lf2_202:
+    movslq -340(%rbp), %rax
+.Lf2_203:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -60(%rbp)
+    .loc 1 298 13
+    movslq -12(%rbp), %rax
+    imulq $82, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_208
+    jmp .Lf2_207
+.Lf2_208:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_207:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_204
+    jmp .Lf2_205
+.Lf2_204:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_210
+    jmp .Lf2_209
+.Lf2_210:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_211
+    jmp .Lf2_212
+.Lf2_211:
+    movq $96, %rax
+    jmp .Lf2_213
+.Lf2_212:
+    movslq -12(%rbp), %rax
+.Lf2_213:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_209:
+    jmp .Lf2_206
+.Lf2_205:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_215
+    jmp .Lf2_214
+.Lf2_215:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_214:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_206:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_194:
+    .loc 1 295 36
+    incl -344(%rbp)
+.Lf2_196:
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_195
+.Lf2_193:
+    addq $0, %rsp
+    .loc 1 300 9
+    cmpl $84, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_217
+    jmp .Lf2_216
+.Lf2_217:
+    movq $83, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_216:
+    push %rax
+    movq $1, %rax
+    imulq $43, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_219
+    jmp .Lf2_218
+.Lf2_219:
+    movq $60, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_218:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf2_180:
+    .loc 1 293 32
+    incl -340(%rbp)
+.Lf2_182:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_181
+.Lf2_179:
+    addq $8, %rsp
+    .loc 1 302 5
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_221
+    jmp .Lf2_222
+.Lf2_221:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf2_223
+.Lf2_222:
+    movslq -8(%rbp), %rax
+.Lf2_223:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_225
+    jmp .Lf2_224
+.Lf2_225:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_224:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_227
+    jmp .Lf2_226
+.Lf2_227:
+    movq $11, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_226:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf2_228
+    .loc 1 303 9
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf2_229
+    jmp .Lf2_230
+.Lf2_229:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_231
+.Lf2_230:
+    movslq -12(%rbp), %rax
+.Lf2_231:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_233
+    jmp .Lf2_232
+.Lf2_233:
+    movslq -8(%rbp), %rax
+    addq $70, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_232:
+    movl %eax, -12(%rbp)
+    .loc 1 304 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_235
+    jmp .Lf2_234
+.Lf2_235:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_234:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_237
+    jmp .Lf2_236
+.Lf2_237:
+    movslq -8(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_238
+    jmp .Lf2_239
+.Lf2_238:
+    movq $31, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_240
+.Lf2_239:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_240:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_236:
+    movl %eax, -12(%rbp)
+    .loc 1 305 9
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_241
+    jmp .Lf2_242
+.Lf2_241:
+    movslq -80(%rbp), %rax
+    jmp .Lf2_243
+.Lf2_242:
+    movslq -8(%rbp), %rax
+.Lf2_243:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_245
+    jmp .Lf2_244
+.Lf2_245:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_244:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_220
+.Lf2_228:
+    .loc 1 307 9
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -24(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 308 9
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_246
+    jmp .Lf2_247
+.Lf2_246:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf2_248
+.Lf2_247:
+    movslq -8(%rbp), %rax
+.Lf2_248:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 309 9
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_250
+    jmp .Lf2_249
+.Lf2_250:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_249:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_252
+    jmp .Lf2_251
+.Lf2_252:
+    movq $7, %rax
+    push %rax
+    movq $17, %rax
+    imulq $65, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_251:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_220:
+    .loc 1 311 5
+    movslq -12(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $73, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $82, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_254
+    jmp .Lf2_253
+.Lf2_254:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_253:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
@@ -0,0 +1,518 @@
+int f0() {
+    int v0 = 65;
+    int v1 = 26;
+    int v2 = 74;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((v2 <= 7) > 65) break;
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((36 - i1) < (a0[13] <= a1[0][6])) >= ((75 * a1[1][0]) % 9));
+                    a0[1] = (((79 <= 82) ? (a1[2][4] && v2) : (i0 + i1)) <= ((14 != v1) ? (a0[15] - v2) : (v0 ? i0 : v3)));
+                    v1 = (((v0 ? 69 : 10) / 1) && ((25 >= 16) >= (92 > i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a0[15] = (((v0 * a0[5]) / 8) <= ((46 * 12) / 6));
+            a1[3][11] = (((a0[8] - v2) * (i0 >= v2)) % 9);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((61 == v3) > (v1 ? v2 : a1[1][13])) == ((43 > v1) - (a1[2][8] && a0[7])))) {
+        v1 = (((v3 % 2) - (a1[2][7] ? 74 : 44)) * ((v1 / 2) && (a0[12] == v2)));
+        v3 = (((0 >= a1[2][1]) ? (a0[13] ? a1[0][5] : v3) : (a1[0][0] ? a0[12] : a1[3][15])) + ((a0[9] == v2) <= (v0 < a0[12])));
+        v2 = (((a0[2] ? a1[3][11] : 49) >= (65 % 4)) > ((v0 == a1[3][12]) > (v3 != a0[5])));
+    } else {
+        a1[2][13] = (((v3 / 5) || (v1 >= a1[2][5])) - ((v1 - a1[1][8]) <= (a1[2][0] ? 51 : v3)));
+        v3 = (((v0 ? a1[2][1] : 43) * (a1[0][12] ? 98 : v0)) ? ((v0 != a1[2][5]) >= (10 * v1)) : ((a1[2][14] ? a1[3][12] : v3) && (v1 < a0[5])));
+        v3 = (((48 - v3) != (83 / 1)) && ((v2 ? a1[0][15] : a1[2][7]) != (v3 || v2)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((v0 + a1[0][7]) > 55) break;
+        a1[0][6] = (((v3 * v1) + (v2 % 7)) - ((62 + a0[3]) / 2));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v2 = (((a1[3][2] ? v0 : i3) <= (i2 ? 34 : a1[2][1])) && ((a0[0] ? v1 : a0[6]) == (a1[2][15] / 8)));
+                a1[1][14] = (((92 % 2) * (v0 == v2)) && ((v2 >= v1) / 2));
+                v2 = (((i2 < 99) ? (v2 && v3) : (30 > a0[12])) == ((a1[0][5] == v1) && (v3 / 7)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[12] = (((a1[0][12] == i2) ? (v2 == 3) : (v3 == i2)) % 4);
+    }
+    v0 = (((v3 ? v0 : a1[2][1]) / 6) < ((77 / 1) % 6));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v1 = (((v0 - a1[0][6]) && (a1[2][13] % 8)) != ((a0[3] - a0[6]) + (42 < a0[4])));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    a1[0][13] = (((i4 >= v0) || (66 && v3)) || ((42 >= 13) < (77 ? 58 : 50)));
+                    a0[14] = (((90 || i5) > (v3 || 45)) == ((68 % 4) + (30 / 4)));
+                    a0[0] = (((60 <= v2) <= (v3 % 1)) > ((i4 < i4) <= (i4 && a1[0][11])));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((i4 && v2) * (63 <= 48)) + ((6 > a1[3][2]) - (a1[1][15] * i4)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((a1[2][12] / 3) > 95) break;
+            v3 = (((62 != v3) - (v1 < v3)) / 6);
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v0 = (((38 / 3) >= (77 == 96)) >= ((75 != v2) && (i7 == v1)));
+                    v1 = (((a1[3][12] == i7) / 5) / 6);
+                    a0[6] = (((34 / 6) ? (i6 + v3) : (v1 && 44)) && ((v3 || v3) ? (a1[3][14] || v3) : (91 - v0)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((v3 <= 90) != (v0 == a0[14])) + ((76 != v1) || (i6 && v1)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a1[2][0] > a1[3][1]) && (a0[11] + v1)) / 1)) {
+        a0[10] = (((v3 - a1[1][4]) < (v0 - 55)) >= ((a1[3][11] * v0) >= (28 != 65)));
+        v3 = (((a1[1][9] <= a0[15]) != (5 != a0[14])) % 2);
+        v1 = (((25 % 5) % 3) < ((a0[4] && v3) < (v2 * a1[1][7])));
+    } else {
+        v0 = (((v3 / 2) == (v0 == v3)) * ((v2 <= v1) <= (92 / 7)));
+        a0[14] = (((87 > v3) > (a1[0][7] / 6)) - ((v2 * 12) ? (v1 <= v1) : (v0 * a0[4])));
+        v2 = (((a0[13] * 97) < (90 && a1[3][11])) / 9);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            if ((v2 != v0) > 53) break;
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                a1[3][13] = (((a0[1] % 7) >= (a0[7] / 7)) <= ((i8 / 9) || (a0[2] - a1[1][4])));
+                v1 = (((v0 + a0[11]) ? (v0 > 50) : (8 / 9)) % 5);
+                v2 = (((v0 < 71) || (i8 ? v2 : 6)) == ((51 * v1) >= (v0 % 6)));
+            }
+            v0 = (((86 ? a1[2][11] : 50) == (88 >= 6)) + ((v1 ? v2 : v1) > (a1[0][6] / 8)));
+            a1[0][0] = (((54 ? 3 : 25) * (50 * 47)) == ((i8 / 5) ? (v2 <= v1) : (a0[9] > 33)));
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 2) {
+            {
+                int i11 = 0;
+                while (i11 < 4) {
+                    v3 = (((a0[12] >= 85) > (a1[2][6] ? i10 : a1[2][8])) / 8);
+                    v1 = (((2 <= a1[3][3]) + (v0 * v0)) <= ((v0 * i11) > (i11 < a1[3][1])));
+                    v3 = (((v3 % 6) / 3) == ((v1 < 40) || (v2 / 8)));
+                    i11 = i11 + 1;
+                }
+            }
+            v1 = (((v0 || v2) <= (v0 < a1[3][8])) / 9);
+            a1[3][14] = (((v1 ? i10 : i10) % 3) && ((71 && v1) && (30 && i10)));
+            i10 = i10 + 1;
+        }
+    }
+    v1 = (((67 * v1) % 2) ? ((v0 < a1[2][15]) == (v1 == 53)) : ((v2 - 86) ? (v1 >= v0) : (a1[2][4] > a1[1][14])));
+    return (((v0 == v2) * (v0 != a0[15])) && ((66 || v3) / 4));
+}
+int f1() {
+    int v0 = 48;
+    int v1 = 64;
+    int v2 = 58;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v2 = (((v3 ? 93 : i0) > (39 * v0)) != ((9 - 59) <= (v3 != i0)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                a1[1][4] = (((v3 <= v1) * (v3 ? a1[2][10] : a1[3][13])) - ((i0 == 7) || (a1[0][4] >= a0[5])));
+                v1 = (((67 >= i0) + (4 && i1)) >= ((v2 % 8) < (a1[3][5] ? v1 : i1)));
+                v2 = (((v1 && a1[0][13]) <= (a1[1][0] ? i0 : a1[0][5])) - ((i1 ? a0[1] : v3) ? (a0[7] != v1) : (v3 >= v1)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[4] = (((v3 / 9) != (96 <= v2)) || ((a1[0][4] / 4) && (v0 - v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    if ((a1[1][12] > 94) > 71) break;
+                    v2 = (((a1[3][5] - i3) - (58 / 4)) - ((a0[6] == a0[15]) % 3));
+                    v2 = (((v1 * v2) ? (i3 >= v3) : (v3 ? v0 : v0)) > ((v1 == i2) / 3));
+                    v1 = (((i3 <= v2) >= (a1[1][13] < a0[6])) > ((a1[3][4] == 44) <= (i2 ? v1 : i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[10] = (((v3 % 2) + (v0 > a1[3][12])) || ((v2 < 59) != (a1[1][11] / 8)));
+            v2 = (((a1[1][15] % 8) * (v2 || a0[7])) >= ((v0 - a0[8]) % 9));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v3 / 2) % 8) * ((a0[0] % 9) < (v2 > v1)))) {
+        v1 = (((a0[6] - v3) * (a0[7] - a0[13])) != ((v0 * a1[2][9]) < (v0 + a0[3])));
+        a0[7] = (((v2 - v0) == (30 * v2)) || ((v2 != v0) ? (90 / 9) : (v1 ? 82 : a0[5])));
+        v3 = (((a0[12] < a1[0][7]) > (v3 != 12)) == ((v1 + v0) || (v0 + 83)));
+    } else {
+        a1[0][4] = (((v3 % 3) && (v3 - v1)) <= ((v1 - 82) || (85 >= v0)));
+        a0[3] = (((a1[0][7] <= v0) == (73 != v3)) < ((v2 <= v3) != (a0[15] <= v1)));
+        a1[1][1] = (((29 ? a0[13] : a1[3][13]) * (a1[1][3] && a0[14])) == ((a1[3][11] + 37) >= (a1[2][9] > a0[13])));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[3] = (((a0[6] > 70) || (13 % 1)) - ((v3 % 1) > (a1[1][10] ? i4 : v2)));
+            {
+                int i5 = 0;
+                do {
+                    a1[2][3] = (((32 != a1[3][5]) ? (43 == i4) : (a0[5] && a1[3][2])) * ((69 ? 45 : v0) % 5));
+                    a0[4] = (((a1[2][7] == a0[2]) && (v3 > i5)) ? ((4 ? a0[1] : 17) || (v1 / 7)) : ((a1[0][13] + v3) && (v2 || v3)));
+                    a0[0] = (((a0[12] != 26) && (75 != v1)) != ((82 / 5) != (47 || v1)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v0 = (((v0 <= 98) || (a1[0][7] == a0[1])) == ((v0 - i4) != (v0 / 1)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            v3 = (((56 ? v2 : v3) + (a0[3] ? 41 : 14)) + ((a0[11] > 54) || (95 ? v3 : a0[5])));
+            v1 = (((33 < 29) / 7) == ((v0 >= 46) > (3 + a1[2][6])));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v0 = (((v1 ? v2 : 86) >= (8 - v1)) || ((v3 > a0[1]) ? (i6 % 1) : (v2 / 6)));
+                    a1[2][11] = (((v0 ? 9 : 61) < (i6 % 5)) > ((i6 && a1[3][1]) - (i7 ? v3 : a1[1][15])));
+                    v1 = (((i6 > 13) > (57 <= a1[2][9])) > ((i6 >= a0[7]) ? (82 < a0[1]) : (27 <= 39)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((i8 < 53) >= (96 != 21)) * ((i8 - 44) <= (a1[1][2] - v0)));
+            v0 = (((v1 / 4) < (42 && v3)) == ((i8 >= a1[0][13]) <= (v2 - a1[3][5])));
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    v2 = (((v3 != v1) < (v3 ? i9 : a1[1][0])) || ((23 ? 59 : i8) % 8));
+                    v0 = (((v3 || 68) > (v3 % 8)) == ((i8 > v3) + (a1[3][7] + v0)));
+                    v3 = (((a1[0][13] * 26) && (a0[10] / 9)) != ((a0[6] >= a1[1][14]) <= (i8 - v3)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    if ((((v0 ? 81 : a1[0][14]) > (66 && v2)) % 7)) {
+        v3 = (((17 + 18) + (v3 - 62)) % 6);
+        v2 = (((a0[3] <= 73) <= (a0[6] < a1[3][11])) || ((86 || a0[6]) >= (a0[13] / 8)));
+        v1 = (((53 < v0) < (v2 < a1[2][0])) > ((71 % 5) ? (v0 - a0[14]) : (v0 <= 42)));
+    } else {
+        a0[13] = (((v0 - v2) ? (a0[3] < a1[0][13]) : (a1[0][9] != 45)) ? ((a1[3][5] <= v0) <= (v1 || a1[0][15])) : ((a1[2][0] ? v1 : a1[3][7]) * (43 > v2)));
+        v1 = (((17 != a1[1][1]) ? (37 > 86) : (v3 - v1)) || ((49 ? v3 : v3) < (v0 <= v0)));
+        v0 = (((v0 ? 58 : v0) * (v0 >= v1)) / 8);
+    }
+    a0[9] = (((a1[1][11] < a1[1][3]) ? (v1 > v2) : (a0[2] / 7)) / 4);
+    for (int i10 = 0; i10 < 4; i10 = i10 + 1) {
+        v1 = (((19 < a0[5]) ? (v0 * 9) : (v0 * 78)) * ((v3 ? a0[10] : i10) < (21 == v0)));
+        v0 = (((v1 > v3) < (2 == v1)) < ((a0[9] + v2) % 2));
+        {
+            int i11 = 0;
+            while (i11 < 6) {
+                v2 = (((a1[1][7] <= i11) % 9) ? ((i11 != 83) / 2) : ((98 || 69) && (a1[2][0] % 7)));
+                v1 = (((a1[1][8] && 13) % 2) * ((37 - i10) - (v0 == 58)));
+                v0 = (((v1 % 2) == (35 || v2)) % 8);
+                i11 = i11 + 1;
+            }
+        }
+    }
+    {
+        int i12 = 0;
+        while (i12 < 3) {
+            a0[12] = (((a1[0][1] - 57) || (0 - v2)) <= ((i12 >= a1[1][5]) ? (v2 != v3) : (a0[9] <= 20)));
+            {
+                int i13 = 0;
+                while (i13 < 3) {
+                    if ((i12 > v2) > 69) break;
+                    v0 = (((v1 ? v0 : v1) > (i12 ? 46 : 17)) <= ((v0 || v2) * (i13 - a1[3][10])));
+                    a1[2][14] = (((v0 || v2) && (a0[14] ? v1 : i12)) ? ((i12 / 3) <= (i12 ? a1[3][8] : 3)) : ((v1 != v1) >= (a0[5] < 99)));
+                    v3 = (((v1 ? v2 : v3) * (13 + v2)) < ((i12 ? 87 : 57) ? (a1[0][9] >= 49) : (i13 != i13)));
+                    i13 = i13 + 1;
+                }
+            }
+            v0 = (((14 >= a1[3][3]) ? (80 % 9) : (77 ? 28 : v0)) ? ((a0[13] ? a0[4] : a0[1]) != (v2 && 77)) : ((7 || 19) - (47 <= 9)));
+            i12 = i12 + 1;
+        }
+    }
+    return (((v1 == v3) > (94 ? v3 : v3)) == ((a0[3] == v0) % 7));
+}
+int f2() {
+    int v0 = 80;
+    int v1 = 30;
+    int v2 = 82;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 ? v2 : v1) + (v2 ? a1[2][7] : v0)) ? ((a1[0][4] / 8) ? (v0 * 54) : (a0[0] < v1)) : ((71 == 51) || (v0 + a0[5])))) {
+        v2 = (((a1[2][9] > v3) ? (v2 ? a1[3][9] : v2) : (a0[9] || a1[2][1])) ? ((a1[0][10] < v3) ? (a1[0][5] >= 89) : (83 * a0[2])) : ((v0 - v1) ? (97 - a1[2][12]) : (a0[12] + 12)));
+        v3 = (((24 / 3) <= (v1 >= 90)) >= ((22 * 52) == (58 - v3)));
+        v3 = (((43 * v1) ? (9 || v3) : (v2 > v2)) > ((v1 ? v3 : v1) * (v1 >= 80)));
+    } else {
+        v1 = (((a1[2][5] == v1) >= (91 <= v1)) / 5);
+        v3 = (((v2 && a0[14]) || (3 - a1[1][10])) < ((a0[7] < v0) != (v1 < a1[0][11])));
+        a1[2][15] = (((v0 % 4) + (a0[7] > 89)) < ((v2 ? v3 : v2) >= (v1 ? a0[13] : a1[0][8])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v3 = (((64 > v2) == (69 % 1)) <= ((v1 * a1[2][11]) != (v0 != v0)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v0 = (((i1 + v3) % 1) || ((6 && 88) - (i0 ? 60 : v3)));
+                v0 = (((48 == v2) - (a0[4] * i1)) <= ((a0[9] && v3) * (a0[5] + v0)));
+                a0[8] = (((v3 && v0) || (58 <= i1)) == ((v1 ? i1 : 13) || (a1[1][6] % 7)));
+            }
+            a1[2][2] = (((i0 >= v0) + (58 / 9)) - ((a0[8] || v3) ? (a0[2] <= 93) : (96 / 5)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((i2 + 53) / 9) + ((a1[1][11] <= a0[11]) * (a0[6] + v0)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v0 = (((i2 && v0) % 8) != ((a0[8] != v2) && (v2 && 39)));
+                v0 = (((v0 >= i3) > (i2 > a0[0])) - ((v2 >= v2) ? (v2 && i2) : (v2 ? v2 : a1[0][2])));
+                a1[1][8] = (((a1[3][3] >= i2) != (73 > v1)) - ((v3 && a1[0][8]) != (v2 / 1)));
+            }
+            v0 = (((41 + a1[2][5]) < (v2 > a1[0][9])) || ((v1 >= a1[0][1]) ? (i2 + a0[3]) : (i2 ? 8 : v1)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[13] = (((v3 + 55) + (a1[3][14] > v3)) + ((97 && i4) * (i4 != a1[1][7])));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                if ((v2 ? i5 : v0) > 81) break;
+                v1 = (((v1 != v1) % 4) || ((37 >= 66) + (v0 < v1)));
+                a1[1][15] = (((51 + v2) % 1) / 9);
+                v1 = (((i5 > i4) == (v2 * i4)) ? ((v3 != i4) && (a1[1][6] * 98)) : ((69 >= a0[15]) && (v3 - 23)));
+            }
+            v1 = (((v1 * v0) - (v0 / 6)) * ((92 >= a0[7]) < (v3 || i4)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v2 || v0) > 79) break;
+            a0[3] = (((v2 + a1[3][4]) == (v2 - v0)) != ((a0[8] ? a1[3][5] : a1[1][10]) && (18 / 1)));
+            a0[5] = (((i6 % 6) ? (94 % 1) : (v3 != a1[0][3])) * ((i6 != v0) + (v1 <= a0[9])));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                if ((63 == v0) > 96) break;
+                a0[1] = (((a0[15] || a1[3][1]) >= (a1[2][0] < i7)) + ((v0 >= 31) || (i7 || a1[2][6])));
+                v1 = (((a0[10] == i6) > (a1[1][12] && 16)) < ((v3 / 6) != (a0[4] * v1)));
+                v0 = (((43 && v0) == (57 != v0)) / 1);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        if ((v0 ? v0 : v3) > 80) break;
+        a1[3][0] = (((v0 + a0[13]) / 5) % 5);
+        v1 = (((23 - i8) <= (28 > 99)) == ((a1[0][15] - 12) > (v0 == 0)));
+        {
+            int i9 = 0;
+            do {
+                v1 = (((16 && a0[1]) / 4) >= ((9 && 50) ? (a0[0] > 95) : (i8 < v2)));
+                v0 = (((v3 == v3) * (a0[1] * a1[3][12])) / 6);
+                v0 = (((v0 % 1) == (v2 <= v3)) % 4);
+                i9 = i9 + 1;
+            } while (i9 < 8);
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 3) {
+            {
+                int i11 = 0;
+                do {
+                    if ((a1[0][10] >= a0[9]) > 80) break;
+                    a0[13] = (((a0[6] || 65) > (v0 - v3)) ? ((a0[0] - i11) && (v1 / 6)) : ((v0 % 2) * (v2 - v2)));
+                    v1 = (((i11 % 3) || (v1 + a1[3][4])) + ((32 != v0) / 5));
+                    v2 = (((46 < 15) <= (a0[2] / 3)) || ((i11 < 58) == (a0[4] || v2)));
+                    i11 = i11 + 1;
+                } while (i11 < 3);
+            }
+            v2 = (((2 != 32) != (45 % 5)) == ((22 >= v1) || (80 != v0)));
+            v1 = (((9 - a1[1][15]) > (v2 || 67)) ? ((67 * v3) ? (v3 && a0[14]) : (v3 || a1[0][8])) : ((i10 < i10) % 3));
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 8; i12 = i12 + 1) {
+        if ((v3 >= a1[1][7]) > 71) break;
+        v1 = (((v3 >= 8) < (51 >= 33)) >= ((24 || 17) <= (v1 >= i12)));
+        a1[1][1] = (((v1 && v3) || (i12 == a0[2])) % 6);
+        {
+            int i13 = 0;
+            while (i13 < 3) {
+                v2 = (((v3 ? a1[2][0] : a1[0][9]) || (i13 % 7)) <= ((v2 + v0) ? (i13 > v1) : (v3 < a1[2][4])));
+                a1[1][6] = (((a1[1][11] * v1) / 5) >= ((i13 == a1[3][14]) && (v0 < a1[2][12])));
+                v2 = (((v2 && 26) == (53 / 6)) <= ((73 + v3) - (v3 == 28)));
+                i13 = i13 + 1;
+            }
+        }
+    }
+    {
+        int i14 = 0;
+        while (i14 < 7) {
+            for (int i15 = 0; i15 < 3; i15 = i15 + 1) {
+                a1[1][15] = (((i14 - v3) * (i14 < i15)) == ((v1 <= v0) % 3));
+                a0[13] = (((v0 / 2) >= (81 % 5)) ? ((i15 || 20) || (v2 - a1[0][11])) : ((v3 != 61) + (3 && a1[1][13])));
+                v2 = (((78 <= v2) > (v1 && v0)) == ((v3 == v1) <= (a1[0][6] < 0)));
+            }
+            v3 = (((a1[2][2] || v3) - (51 > a0[12])) > ((a1[3][7] * v1) ? (94 >= v0) : (v1 ? v2 : 33)));
+            a1[0][5] = (((a1[0][1] == v0) > (80 * a1[0][3])) ? ((v1 && i14) == (v2 ? v0 : 47)) : ((a0[4] <= 51) || (v3 < v3)));
+            i14 = i14 + 1;
+        }
+    }
+    for (int i16 = 0; i16 < 2; i16 = i16 + 1) {
+        v1 = (((v1 ? 24 : i16) >= (v0 <= i16)) > ((a0[10] != i16) >= (v1 * i16)));
+        a1[2][1] = (((96 > i16) && (17 >= v2)) < ((v1 && 67) - (32 % 5)));
+        for (int i17 = 0; i17 < 6; i17 = i17 + 1) {
+            a1[0][11] = (((a1[3][6] || a0[9]) < (v3 || a0[12])) == ((v2 * 81) < (i17 ? 29 : v3)));
+            v0 = (((v1 > i17) && (v0 ? a0[2] : a1[1][14])) == ((59 - a1[2][1]) == (49 > a0[3])));
+            a1[3][5] = (((v0 ? i16 : a0[7]) ? (v0 == a0[0]) : (v1 && i16)) < ((39 && a1[1][0]) <= (a0[12] || a1[3][12])));
+        }
+    }
+    return (((v2 - v2) || (a0[9] ? a0[3] : a0[3])) - ((v1 % 1) >= (v0 != v2)));
+}
+int f3() {
+    int v0 = 88;
+    int v1 = 55;
+    int v2 = 48;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v0 = (((i0 <= 84) != (a0[3] > v2)) != ((a0[3] || a0[10]) || (v0 - v2)));
+            v0 = (((a1[0][4] >= 91) / 6) ? ((a0[10] ? 22 : v0) / 4) : ((v1 == v0) <= (v3 * 43)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((a1[2][6] ? v1 : v0) > 83) break;
+                v3 = (((6 == 5) ? (v1 ? v1 : a0[10]) : (v3 ? a1[2][3] : 5)) < ((a1[3][0] * 21) + (a1[0][2] ? a1[2][4] : v3)));
+                a0[6] = (((40 >= v3) + (i1 != v1)) == ((a1[3][4] || v3) - (93 / 6)));
+                a0[5] = (((a1[3][2] || a0[6]) != (i0 > a0[13])) > ((6 ? v2 : a0[5]) < (i1 <= 56)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v1 / 3) != (i2 % 9)) <= ((i2 % 2) != (17 ? a1[2][0] : a1[0][10])));
+            v3 = (((i2 * i2) || (a0[12] < 93)) - ((37 + i2) % 3));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((i3 <= v1) > 69) break;
+                    v1 = (((v1 != i2) < (v2 < a1[3][11])) - ((i2 / 6) ? (i3 % 4) : (i2 == v0)));
+                    a0[12] = (((i3 < a1[0][14]) && (40 + i2)) != ((v1 ? i3 : 39) / 7));
+                    v3 = (((a1[3][10] && v2) ? (i2 - v3) : (a0[4] ? a1[3][13] : a0[3])) / 5);
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((a1[2][12] > v0) % 7) / 9)) {
+        a0[2] = (((a1[2][14] <= 76) == (v3 >= v2)) >= ((v3 && a0[5]) / 9));
+        v2 = (((24 <= v2) ? (v3 == a1[2][1]) : (v1 == v0)) + ((v3 || v1) + (v0 + a0[13])));
+        v1 = (((v0 * v1) < (v0 <= v2)) / 2);
+    } else {
+        v3 = (((56 || 86) >= (v3 || 26)) == ((v2 - v2) ? (3 % 5) : (92 <= a1[1][11])));
+        v2 = (((a0[12] / 6) * (a0[3] % 9)) * ((4 % 9) + (v0 < v3)));
+        v0 = (((a1[0][1] || v2) != (v2 > a0[8])) + ((v0 >= v3) <= (v2 || v0)));
+    }
+    if ((((v0 <= v0) - (55 > v3)) >= ((v3 % 2) ? (v3 / 1) : (v0 && v0)))) {
+        a1[0][13] = (((35 / 1) % 2) && ((26 || a1[2][10]) - (a1[3][2] >= 97)));
+        v1 = (((a0[8] - v2) % 2) + ((a1[1][5] ? a0[8] : v2) ? (v0 >= 86) : (99 == v0)));
+        v1 = (((v2 > 14) * (v3 > v2)) >= ((a1[0][14] && 95) <= (73 && a0[12])));
+    } else {
+        v0 = (((16 != v3) / 9) != ((6 + 93) > (a1[0][12] > v3)));
+        v2 = (((v1 ? v1 : v1) >= (a0[8] + 65)) + ((v2 > a0[2]) != (81 <= v3)));
+        a0[8] = (((66 >= v3) % 1) ? ((a0[13] % 7) >= (a1[0][14] >= v3)) : ((a0[12] ? 85 : 65) != (v3 < v3)));
+    }
+    v1 = (((82 < 84) < (v1 >= a1[2][6])) * ((v0 >= 86) + (v3 < v2)));
+    if ((((a0[8] != 77) * (v0 && v0)) >= ((a0[5] && 74) <= (v3 ? a1[2][2] : a1[1][7])))) {
+        v1 = (((a1[3][10] ? v0 : v3) == (v3 ? a1[0][6] : 81)) * ((a0[5] * v3) > (a1[0][7] || a0[2])));
+        v3 = (((v1 * 85) - (a1[0][9] && a1[1][7])) && ((27 * v3) == (a0[3] ? v1 : v0)));
+        a0[12] = (((v2 / 2) != (v0 || 65)) == ((39 >= a0[5]) % 9));
+    } else {
+        v0 = (((77 >= v0) || (v0 < v2)) <= ((75 * 44) != (a0[6] * 25)));
+        a0[10] = (((a1[1][6] + a1[0][14]) * (v0 * 6)) / 1);
+        v2 = (((v2 / 5) * (a1[0][13] / 4)) < ((a1[3][12] == a1[1][15]) > (a1[0][2] ? a0[12] : 28)));
+    }
+    v3 = (((a0[5] - v2) == (v1 > 14)) < ((v0 || v3) && (42 == v0)));
+    if ((((v3 / 6) != (a0[14] == v2)) <= ((11 && v1) % 6))) {
+        v3 = (((v0 || a1[0][0]) / 1) == ((a0[12] || 95) - (v1 ? v1 : 40)));
+        v2 = (((v3 ? 31 : v1) ? (v3 > 30) : (v1 + v2)) - ((42 != v1) ? (a1[2][13] != v0) : (v1 > v0)));
+        a0[11] = (((v3 != v1) > (v3 < 47)) >= ((53 % 3) - (a0[8] < 51)));
+    } else {
+        v2 = (((13 * 37) != (v3 || v1)) % 6);
+        a1[1][12] = (((v3 + v0) * (v2 == 19)) ? ((v3 > 37) % 4) : ((v0 > v3) / 9));
+        v3 = (((59 != v3) <= (19 < 9)) == ((v3 || v1) != (a1[0][10] ? v3 : v0)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                a1[1][1] = (((i4 <= 11) == (v3 > 76)) < ((a0[15] / 4) % 1));
+                v1 = (((v1 < i4) + (v0 < 92)) / 2);
+                a0[0] = (((v0 && v0) / 7) - ((a1[3][13] ? v1 : 5) != (i4 % 1)));
+            }
+            a0[5] = (((v3 < v0) ? (v2 < v2) : (a1[1][4] && a0[2])) / 7);
+            v0 = (((i4 % 7) || (a1[0][3] && 82)) ? ((a1[2][3] % 2) - (v2 != 29)) : ((v2 || v1) || (a1[3][1] > a0[15])));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    if ((((1 ? v0 : 26) >= (v3 + 18)) % 9)) {
+        v2 = (((v3 == v3) < (v3 != v2)) % 2);
+        v2 = (((v0 == 74) > (98 - a0[2])) ? ((94 ? a0[3] : a0[15]) >= (58 && v2)) : ((v1 ? v1 : v2) == (6 - v3)));
+        a0[10] = (((v0 * v3) ? (v0 / 3) : (v0 < v2)) || ((a1[1][1] - v2) ? (a0[13] % 5) : (a0[10] || a0[5])));
+    } else {
+        a1[2][0] = (((v0 <= 48) - (v2 ? v1 : a1[2][10])) != ((v1 <= a0[4]) && (v2 == 53)));
+        v1 = (((v0 / 8) < (v2 != v2)) / 9);
+        a1[1][5] = (((v1 - v3) - (v2 < v1)) < ((v0 % 5) % 7));
+    }
+    return (((a0[10] <= v2) - (v3 - 88)) != ((24 / 8) + (84 ? v3 : a1[3][4])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
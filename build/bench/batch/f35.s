@@ -0,0 +1,11804 @@
+    .file 1 "build/bench/batch/f35.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 511 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 512 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 513 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 514 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 515 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 516 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 517 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $65, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $26, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $74, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $44, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    jmp .Lf0_4
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    cmpl $7, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_5
+    jmp .Lf0_1
+.Lf0_5:
+    .loc 1 13 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 14 17
+    .p2align 4,,10
+.Lf0_8:
+    .loc 1 15 21
+    movq $36, %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    imulq $75, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 16 21
+    movq $79, %rax
+    cmpq $82, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_13
+    jmp .Lf0_12
+.Lf0_13:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_12:
+    jmp .Lf0_11
+.Lf0_10:
+    movslq -340(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_11:
+    push %rax
+    movq $14, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_14
+    jmp .Lf0_15
+.Lf0_14:
+    movslq -20(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_16
+.Lf0_15:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_17
+    jmp .Lf0_18
+.Lf0_17:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_19
+.Lf0_18:
+    movslq -16(%rbp), %rax
+.Lf0_19:
+.Lf0_16:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -76(%rbp)
+    .loc 1 17 21
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_20
+    jmp .Lf0_21
+.Lf0_20:
+    movq $69, %rax
+    jmp .Lf0_22
+.Lf0_21:
+    movq $10, %rax
+.Lf0_22:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_24
+    jmp .Lf0_23
+.Lf0_24:
+    movq $25, %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $92, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_23:
+    movl %eax, -8(%rbp)
+    .loc 1 18 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_7:
+    .loc 1 19 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_8
+.Lf0_6:
+    addq $0, %rsp
+    .loc 1 21 13
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $46, %rax
+    imulq $12, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -20(%rbp)
+    .loc 1 22 13
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -48(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 23 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+.Lf0_4:
+    .loc 1 10 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 26 5
+    movq $61, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_26
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_28
+.Lf0_27:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf0_28:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_29
+.Lf0_30:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_29:
+    push %rax
+    movq $43, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lf0_31
+    .loc 1 27 9
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_33
+    jmp .Lf0_32
+.Lf0_33:
+    movslq -32(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_32:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_34
+    jmp .Lf0_35
+.Lf0_34:
+    movq $74, %rax
+    jmp .Lf0_36
+.Lf0_35:
+    movq $44, %rax
+.Lf0_36:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 28 9
+    movslq -44(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $0, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_37
+    jmp .Lf0_38
+.Lf0_37:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_40
+    jmp .Lf0_41
+.Lf0_40:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf0_42
+.Lf0_41:
+    movslq -16(%rbp), %rax
+.Lf0_42:
+    jmp .Lf0_39
+.Lf0_38:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_43
+    jmp .Lf0_44
+.Lf0_43:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_45
+.Lf0_44:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf0_45:
+.Lf0_39:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 29 9
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_46
+    jmp .Lf0_47
+.Lf0_46:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_48
+.Lf0_47:
+    movq $49, %rax
+.Lf0_48:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $65, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_25
+.Lf0_31:
+    .loc 1 31 9
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_49
+    jmp .Lf0_50
+.Lf0_49:
+    movq $51, %rax
+    jmp .Lf0_51
+.Lf0_50:
+    movslq -16(%rbp), %rax
+.Lf0_51:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_53
+    jmp .Lf0_52
+.Lf0_53:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_52:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 32 9
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_57
+    jmp .Lf0_58
+.Lf0_57:
+    movq $98, %rax
+    jmp .Lf0_59
+.Lf0_58:
+    movslq -4(%rbp), %rax
+.Lf0_59:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_60
+    jmp .Lf0_61
+.Lf0_60:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    jmp .Lf0_62
+.Lf0_61:
+    movq $43, %rax
+.Lf0_62:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_54
+    jmp .Lf0_55
+.Lf0_54:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $10, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_56
+.Lf0_55:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_63
+    jmp .Lf0_64
+.Lf0_63:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf0_65
+.Lf0_64:
+    movslq -16(%rbp), %rax
+.Lf0_65:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_66
+.Lf0_67:
+    movslq -8(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_66:
+.Lf0_56:
+    movl %eax, -16(%rbp)
+    .loc 1 33 9
+    movq $48, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $83, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_69
+    jmp .Lf0_68
+.Lf0_69:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_70
+    jmp .Lf0_71
+.Lf0_70:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf0_72
+.Lf0_71:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_72:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_74
+    jmp .Lf0_73
+.Lf0_74:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_73:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_68:
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_25:
+    .loc 1 35 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_80
+    .p2align 4,,10
+.Lf0_79:
+    .loc 1 36 9
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $55, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_81
+    jmp .Lf0_77
+.Lf0_81:
+    .loc 1 37 9
+    movq $2, %rax
+    push %rax
+    movq $62, %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 39 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 40 13
+    jmp .Lf0_85
+    .p2align 4,,10
+.Lf0_84:
+    .loc 1 41 17
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_86
+    jmp .Lf0_87
+.Lf0_86:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_88
+.Lf0_87:
+    movslq -344(%rbp), %rax
+.Lf0_88:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_89
+    jmp .Lf0_90
+.Lf0_89:
+    movq $34, %rax
+    jmp .Lf0_91
+.Lf0_90:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf0_91:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_93
+    jmp .Lf0_92
+.Lf0_93:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_94
+    jmp .Lf0_95
+.Lf0_94:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_96
+.Lf0_95:
+    movslq -56(%rbp), %rax
+.Lf0_96:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_92:
+    movl %eax, -12(%rbp)
+    .loc 1 42 17
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $92, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_98
+    jmp .Lf0_97
+.Lf0_98:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_97:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 43 17
+    cmpl $99, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_100
+.Lf0_99:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_102
+.Lf0_103:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_102:
+    jmp .Lf0_101
+.Lf0_100:
+    movq $30, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_101:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_105
+    jmp .Lf0_104
+.Lf0_105:
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_104:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 44 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_83:
+.Lf0_85:
+    .loc 1 40 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_84
+.Lf0_82:
+    addq $0, %rsp
+    .loc 1 47 9
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_107
+.Lf0_106:
+    cmpl $3, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_108
+.Lf0_107:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_108:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf0_78:
+    .loc 1 35 30
+    incl -340(%rbp)
+.Lf0_80:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_79
+.Lf0_77:
+    addq $8, %rsp
+    .loc 1 49 5
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_110
+.Lf0_109:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_111
+.Lf0_110:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf0_111:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $77, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 51 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 52 9
+    jmp .Lf0_115
+    .p2align 4,,10
+.Lf0_114:
+    .loc 1 53 13
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    push %rax
+    movq $42, %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -68(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 55 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 56 17
+    jmp .Lf0_121
+    .p2align 4,,10
+.Lf0_120:
+    .loc 1 57 21
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_123
+    jmp .Lf0_122
+.Lf0_123:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_125
+    jmp .Lf0_124
+.Lf0_125:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_124:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_122:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    movq $42, %rax
+    cmpq $13, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $77, %rax
+    cmpq $0, %rax
+    jne .Lf0_128
+    jmp .Lf0_129
+.Lf0_128:
+    movq $58, %rax
+    jmp .Lf0_130
+.Lf0_129:
+    movq $50, %rax
+.Lf0_130:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 58 21
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_132
+    jmp .Lf0_131
+.Lf0_132:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_131:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_134
+    jmp .Lf0_133
+.Lf0_134:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_133:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $30, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $68, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -24(%rbp)
+    .loc 1 59 21
+    movq $60, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_136
+    jmp .Lf0_135
+.Lf0_136:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_135:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -80(%rbp)
+    .loc 1 60 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_119:
+.Lf0_121:
+    .loc 1 56 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_120
+.Lf0_118:
+    addq $0, %rsp
+    .loc 1 63 13
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $63, %rax
+    cmpq $48, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_137
+.Lf0_138:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_137:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 64 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_113:
+.Lf0_115:
+    .loc 1 52 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_114
+.Lf0_112:
+    addq $8, %rsp
+    .loc 1 68 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 69 9
+    jmp .Lf0_142
+    .p2align 4,,10
+.Lf0_141:
+    .loc 1 70 13
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_143
+    jmp .Lf0_139
+.Lf0_143:
+    .loc 1 71 13
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $62, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 73 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 74 17
+    jmp .Lf0_147
+    .p2align 4,,10
+.Lf0_146:
+    .loc 1 75 21
+    movq $3, %rax
+    push %rax
+    movq $38, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $77, %rax
+    cmpq $96, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $75, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_149
+    jmp .Lf0_148
+.Lf0_149:
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_148:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 76 21
+    movq $6, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 77 21
+    movq $6, %rax
+    push %rax
+    movq $34, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -340(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_152
+.Lf0_151:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_154
+    jmp .Lf0_153
+.Lf0_154:
+    movq $44, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_153:
+.Lf0_152:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_156
+    jmp .Lf0_155
+.Lf0_156:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_161
+    jmp .Lf0_160
+.Lf0_161:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_160:
+    cmpq $0, %rax
+    jne .Lf0_157
+    jmp .Lf0_158
+.Lf0_157:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_163
+    jmp .Lf0_162
+.Lf0_163:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_162:
+    jmp .Lf0_159
+.Lf0_158:
+    movq $91, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_159:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_155:
+    movl %eax, -56(%rbp)
+    .loc 1 78 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_145:
+.Lf0_147:
+    .loc 1 74 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_146
+.Lf0_144:
+    addq $0, %rsp
+    .loc 1 81 13
+    movq $76, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_165
+    jmp .Lf0_164
+.Lf0_165:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_166
+.Lf0_167:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_166:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_164:
+    push %rax
+    cmpl $90, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 82 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_140:
+.Lf0_142:
+    .loc 1 69 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_141
+.Lf0_139:
+    addq $8, %rsp
+    .loc 1 85 5
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_170
+    jmp .Lf0_169
+.Lf0_170:
+    movslq -36(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_169:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_171
+    .loc 1 86 9
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $55, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $28, %rax
+    cmpq $65, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -40(%rbp)
+    .loc 1 87 9
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 88 9
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $25, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_172
+.Lf0_173:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_172:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_168
+.Lf0_171:
+    .loc 1 90 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $92, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 91 9
+    movslq -12(%rbp), %rax
+    imulq $12, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_175
+.Lf0_174:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_176
+.Lf0_175:
+    movslq -4(%rbp), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_176:
+    push %rax
+    movq $87, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 92 9
+    movq $9, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    imulq $97, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_168:
+    .loc 1 95 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 96 9
+    jmp .Lf0_182
+    .p2align 4,,10
+.Lf0_181:
+    .loc 1 97 13
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_183
+    jmp .Lf0_179
+.Lf0_183:
+    .loc 1 98 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_189
+    .p2align 4,,10
+.Lf0_188:
+    .loc 1 99 17
+    movq $7, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_194
+    jmp .Lf0_193
+.Lf0_194:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_193:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 100 17
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_195
+    jmp .Lf0_196
+.Lf0_195:
+    cmpl $50, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_197
+.Lf0_196:
+    movq $9, %rax
+    push %rax
+    movq $8, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_197:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 101 17
+    cmpl $71, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_200
+    jmp .Lf0_201
+.Lf0_200:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_202
+.Lf0_201:
+    movq $6, %rax
+.Lf0_202:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    push %rax
+    movq $51, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_192:
+    .loc 1 98 38
+    incl -344(%rbp)
+    .loc 1 99 17
+    movq $7, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_204
+    jmp .Lf0_203
+.Lf0_204:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_203:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 100 17
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_206
+.Lf0_205:
+    cmpl $50, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_207
+.Lf0_206:
+    movq $9, %rax
+    push %rax
+    movq $8, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_207:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 101 17
+    cmpl $71, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_209
+    jmp .Lf0_208
+.Lf0_209:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_211
+.Lf0_210:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_212
+.Lf0_211:
+    movq $6, %rax
+.Lf0_212:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_208:
+    push %rax
+    movq $51, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_191:
+    .loc 1 98 38
+    incl -344(%rbp)
+.Lf0_189:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $8, %rax
+    jl .Lf0_188
+.Lf0_190:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_186
+    .loc 1 99 17
+    movq $7, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 100 17
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_215
+    jmp .Lf0_216
+.Lf0_215:
+    cmpl $50, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_217
+.Lf0_216:
+    movq $9, %rax
+    push %rax
+    movq $8, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_217:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 101 17
+    cmpl $71, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_219
+    jmp .Lf0_218
+.Lf0_219:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_220
+    jmp .Lf0_221
+.Lf0_220:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_222
+.Lf0_221:
+    movq $6, %rax
+.Lf0_222:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_218:
+    push %rax
+    movq $51, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_187:
+    .loc 1 98 38
+    incl -344(%rbp)
+    jmp .Lf0_190
+.Lf0_186:
+    addq $0, %rsp
+    .loc 1 103 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_223
+    jmp .Lf0_224
+.Lf0_223:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_225
+.Lf0_224:
+    movslq -8(%rbp), %rax
+.Lf0_225:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $86, %rax
+    cmpq $0, %rax
+    jne .Lf0_226
+    jmp .Lf0_227
+.Lf0_226:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_228
+.Lf0_227:
+    movq $50, %rax
+.Lf0_228:
+    push %rax
+    movq $88, %rax
+    cmpq $6, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 104 13
+    movq $50, %rax
+    imulq $47, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $54, %rax
+    cmpq $0, %rax
+    jne .Lf0_229
+    jmp .Lf0_230
+.Lf0_229:
+    movq $3, %rax
+    jmp .Lf0_231
+.Lf0_230:
+    movq $25, %rax
+.Lf0_231:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_233
+.Lf0_232:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_234
+.Lf0_233:
+    cmpl $33, -44(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf0_234:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 105 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_180:
+.Lf0_182:
+    .loc 1 96 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_181
+.Lf0_179:
+    addq $8, %rsp
+    .loc 1 109 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 110 9
+    jmp .Lf0_238
+    .p2align 4,,10
+.Lf0_237:
+    .loc 1 112 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 113 17
+    jmp .Lf0_242
+    .p2align 4,,10
+.Lf0_241:
+    .loc 1 114 21
+    movq $8, %rax
+    push %rax
+    cmpl $85, -32(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_243
+    jmp .Lf0_244
+.Lf0_243:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_245
+.Lf0_244:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf0_245:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 115 21
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 116 21
+    movq $3, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $40, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_247
+    jmp .Lf0_246
+.Lf0_247:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_246:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 117 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_240:
+.Lf0_242:
+    .loc 1 113 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_241
+.Lf0_239:
+    addq $0, %rsp
+    .loc 1 120 13
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_249
+    jmp .Lf0_248
+.Lf0_249:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_248:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 121 13
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_251
+.Lf0_250:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_252
+.Lf0_251:
+    movslq -340(%rbp), %rax
+.Lf0_252:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_254
+    jmp .Lf0_253
+.Lf0_254:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_256
+    jmp .Lf0_255
+.Lf0_256:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_255:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_258
+    jmp .Lf0_257
+.Lf0_258:
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_260
+    jmp .Lf0_259
+.Lf0_260:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_259:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_257:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_253:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 122 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_236:
+.Lf0_238:
+    .loc 1 110 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_237
+.Lf0_235:
+    addq $8, %rsp
+    .loc 1 125 5
+    movq $2, %rax
+    push %rax
+    movq $67, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_261
+    jmp .Lf0_262
+.Lf0_261:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $53, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_263
+.Lf0_262:
+    movslq -12(%rbp), %rax
+    subq $86, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_264
+    jmp .Lf0_265
+.Lf0_264:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_266
+.Lf0_265:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_266:
+.Lf0_263:
+    movl %eax, -8(%rbp)
+    .loc 1 126 5
+    movslq -4(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_268
+    jmp .Lf0_267
+.Lf0_268:
+    movq $4, %rax
+    push %rax
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_270
+    jmp .Lf0_269
+.Lf0_270:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_269:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_267:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 128 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 129 5
+    subq $8, %rsp
+    movq $48, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 130 5
+    movq $64, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 131 5
+    subq $8, %rsp
+    movq $58, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 132 5
+    movq $53, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 133 5
+    subq $64, %rsp
+    .loc 1 134 5
+    subq $256, %rsp
+    .loc 1 135 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_6
+    .p2align 4,,10
+.Lf1_5:
+    .loc 1 136 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_7
+    jmp .Lf1_8
+.Lf1_7:
+    movq $93, %rax
+    jmp .Lf1_9
+.Lf1_8:
+    movslq -340(%rbp), %rax
+.Lf1_9:
+    push %rax
+    movq $39, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $9, %rax
+    subq $59, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 138 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 139 13
+    jmp .Lf1_13
+    .p2align 4,,10
+.Lf1_12:
+    .loc 1 140 17
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_15
+    jmp .Lf1_14
+.Lf1_15:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_14:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_16
+    jmp .Lf1_17
+.Lf1_16:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf1_18
+.Lf1_17:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_18:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 141 17
+    movq $4, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_20
+    jmp .Lf1_19
+.Lf1_20:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_19:
+    push %rax
+    movq $67, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_21
+    jmp .Lf1_22
+.Lf1_21:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_23
+.Lf1_22:
+    movslq -344(%rbp), %rax
+.Lf1_23:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 142 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_27
+    jmp .Lf1_28
+.Lf1_27:
+    movslq -76(%rbp), %rax
+    jmp .Lf1_29
+.Lf1_28:
+    movslq -16(%rbp), %rax
+.Lf1_29:
+    cmpq $0, %rax
+    jne .Lf1_24
+    jmp .Lf1_25
+.Lf1_24:
+    movslq -52(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_26
+.Lf1_25:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_26:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_31
+    jmp .Lf1_30
+.Lf1_31:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_30:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_32
+    jmp .Lf1_33
+.Lf1_32:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_34
+.Lf1_33:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf1_34:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 143 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_11:
+.Lf1_13:
+    .loc 1 139 20
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_12
+.Lf1_10:
+    addq $0, %rsp
+    .loc 1 146 9
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $96, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_36
+    jmp .Lf1_35
+.Lf1_36:
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_38
+    jmp .Lf1_37
+.Lf1_38:
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_37:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_35:
+    movl %eax, -64(%rbp)
+    addq $0, %rsp
+.Lf1_4:
+    .loc 1 135 30
+    incl -340(%rbp)
+.Lf1_6:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_5
+.Lf1_3:
+    addq $8, %rsp
+    .loc 1 149 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 150 9
+    jmp .Lf1_42
+    .p2align 4,,10
+.Lf1_41:
+    .loc 1 152 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 153 17
+    jmp .Lf1_46
+    .p2align 4,,10
+.Lf1_45:
+    .loc 1 154 21
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_47
+    jmp .Lf1_43
+.Lf1_47:
+    .loc 1 155 21
+    movq $3, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $58, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 156 21
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_49
+.Lf1_48:
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_50
+.Lf1_49:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_51
+    jmp .Lf1_52
+.Lf1_51:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_53
+.Lf1_52:
+    movslq -4(%rbp), %rax
+.Lf1_53:
+.Lf1_50:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 157 21
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $44, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_54
+    jmp .Lf1_55
+.Lf1_54:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_56
+.Lf1_55:
+    movslq -344(%rbp), %rax
+.Lf1_56:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 158 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_44:
+.Lf1_46:
+    .loc 1 153 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_45
+.Lf1_43:
+    addq $0, %rsp
+    .loc 1 161 13
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_58
+    jmp .Lf1_57
+.Lf1_58:
+    cmpl $59, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_57:
+    movl %eax, -40(%rbp)
+    .loc 1 162 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_60
+    jmp .Lf1_59
+.Lf1_60:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_59:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -48(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 163 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_40:
+.Lf1_42:
+    .loc 1 150 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_41
+.Lf1_39:
+    addq $8, %rsp
+    .loc 1 166 5
+    movq $9, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_62
+    .loc 1 167 9
+    movslq -52(%rbp), %rax
+    subl -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 168 9
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $30, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_64
+    jmp .Lf1_63
+.Lf1_64:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_65
+    jmp .Lf1_66
+.Lf1_65:
+    movq $9, %rax
+    push %rax
+    movq $90, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_67
+.Lf1_66:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_68
+    jmp .Lf1_69
+.Lf1_68:
+    movq $82, %rax
+    jmp .Lf1_70
+.Lf1_69:
+    movslq -60(%rbp), %rax
+.Lf1_70:
+.Lf1_67:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    movl %eax, -52(%rbp)
+    .loc 1 169 9
+    movslq -32(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $12, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_72
+    jmp .Lf1_71
+.Lf1_72:
+    movslq -4(%rbp), %rax
+    addq $83, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_71:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_61
+.Lf1_62:
+    .loc 1 171 9
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_74
+    jmp .Lf1_73
+.Lf1_74:
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_73:
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $82, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_76
+    jmp .Lf1_75
+.Lf1_76:
+    movq $85, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_75:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 172 9
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $73, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -68(%rbp)
+    .loc 1 173 9
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_78
+    jmp .Lf1_77
+.Lf1_78:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_77:
+    push %rax
+    movq $29, %rax
+    cmpq $0, %rax
+    jne .Lf1_79
+    jmp .Lf1_80
+.Lf1_79:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_81
+.Lf1_80:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_81:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    addq $37, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_61:
+    .loc 1 176 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 177 9
+    .p2align 4,,10
+.Lf1_84:
+    .loc 1 178 13
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_85
+    jmp .Lf1_86
+.Lf1_85:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_87
+.Lf1_86:
+    movslq -12(%rbp), %rax
+.Lf1_87:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $70, -56(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_89
+    jmp .Lf1_88
+.Lf1_89:
+    movq $1, %rax
+    push %rax
+    movq $13, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_88:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 180 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 181 17
+    .p2align 4,,10
+.Lf1_92:
+    .loc 1 182 21
+    movq $5, %rax
+    push %rax
+    movq $69, %rax
+    cmpq $0, %rax
+    jne .Lf1_93
+    jmp .Lf1_94
+.Lf1_93:
+    movq $45, %rax
+    jmp .Lf1_95
+.Lf1_94:
+    movslq -4(%rbp), %rax
+.Lf1_95:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $32, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_96
+    jmp .Lf1_97
+.Lf1_96:
+    movq $43, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_98
+.Lf1_97:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_100
+    jmp .Lf1_99
+.Lf1_100:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_99:
+.Lf1_98:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 183 21
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_105
+    jmp .Lf1_104
+.Lf1_105:
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_104:
+    cmpq $0, %rax
+    jne .Lf1_101
+    jmp .Lf1_102
+.Lf1_101:
+    movq $4, %rax
+    cmpq $0, %rax
+    jne .Lf1_106
+    jmp .Lf1_107
+.Lf1_106:
+    movslq -76(%rbp), %rax
+    jmp .Lf1_108
+.Lf1_107:
+    movq $17, %rax
+.Lf1_108:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_110
+    jmp .Lf1_109
+.Lf1_110:
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_109:
+    jmp .Lf1_103
+.Lf1_102:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_112
+    jmp .Lf1_111
+.Lf1_112:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_114
+    jmp .Lf1_113
+.Lf1_114:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_113:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_111:
+.Lf1_103:
+    movl %eax, -64(%rbp)
+    .loc 1 184 21
+    cmpl $26, -32(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_116
+    jmp .Lf1_115
+.Lf1_116:
+    movq $75, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_115:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $82, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $47, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_118
+    jmp .Lf1_117
+.Lf1_118:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_117:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -80(%rbp)
+    .loc 1 185 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_91:
+    .loc 1 186 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_92
+.Lf1_90:
+    addq $0, %rsp
+    .loc 1 188 13
+    cmpl $98, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_120
+    jmp .Lf1_119
+.Lf1_120:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_119:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 189 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_83:
+    .loc 1 190 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_84
+.Lf1_82:
+    addq $8, %rsp
+    .loc 1 193 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 194 9
+    jmp .Lf1_124
+    .p2align 4,,10
+.Lf1_123:
+    .loc 1 195 13
+    cmpl $54, -36(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_126
+    jmp .Lf1_125
+.Lf1_126:
+    movq $95, %rax
+    cmpq $0, %rax
+    jne .Lf1_127
+    jmp .Lf1_128
+.Lf1_127:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_129
+.Lf1_128:
+    movslq -60(%rbp), %rax
+.Lf1_129:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_125:
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_130
+    jmp .Lf1_131
+.Lf1_130:
+    movq $41, %rax
+    jmp .Lf1_132
+.Lf1_131:
+    movq $14, %rax
+.Lf1_132:
+    push %rax
+    movq $56, %rax
+    cmpq $0, %rax
+    jne .Lf1_133
+    jmp .Lf1_134
+.Lf1_133:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_135
+.Lf1_134:
+    movslq -16(%rbp), %rax
+.Lf1_135:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 196 13
+    movq $7, %rax
+    push %rax
+    movq $33, %rax
+    cmpq $29, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $46, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    addq $3, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 198 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 199 17
+    jmp .Lf1_139
+    .p2align 4,,10
+.Lf1_138:
+    .loc 1 200 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_141
+.Lf1_140:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_142
+.Lf1_141:
+    movq $86, %rax
+.Lf1_142:
+    push %rax
+    movq $8, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_144
+    jmp .Lf1_143
+.Lf1_144:
+    movslq -16(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_145
+    jmp .Lf1_146
+.Lf1_145:
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_147
+.Lf1_146:
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_147:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_143:
+    movl %eax, -4(%rbp)
+    .loc 1 201 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_148
+    jmp .Lf1_149
+.Lf1_148:
+    movq $9, %rax
+    jmp .Lf1_150
+.Lf1_149:
+    movq $61, %rax
+.Lf1_150:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_151
+    jmp .Lf1_152
+.Lf1_151:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_153
+.Lf1_152:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf1_153:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_155
+    jmp .Lf1_154
+.Lf1_155:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_154:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 202 21
+    cmpl $13, -340(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $57, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_156
+    jmp .Lf1_157
+.Lf1_156:
+    movq $82, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_158
+.Lf1_157:
+    movq $27, %rax
+    cmpq $39, %rax
+    movq $0, %rax
+    setle %al
+.Lf1_158:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 203 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_137:
+.Lf1_139:
+    .loc 1 199 24
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_138
+.Lf1_136:
+    addq $0, %rsp
+    .loc 1 206 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_122:
+.Lf1_124:
+    .loc 1 194 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_123
+.Lf1_121:
+    addq $8, %rsp
+    .loc 1 210 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 211 9
+    .p2align 4,,10
+.Lf1_161:
+    .loc 1 212 13
+    movslq -340(%rbp), %rax
+    subq $44, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $53, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $96, %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 213 13
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $42, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_163
+    jmp .Lf1_162
+.Lf1_163:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_162:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 215 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 216 17
+    jmp .Lf1_167
+    .p2align 4,,10
+.Lf1_166:
+    .loc 1 217 21
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_168
+    jmp .Lf1_169
+.Lf1_168:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_170
+.Lf1_169:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf1_170:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_172
+    jmp .Lf1_171
+.Lf1_172:
+    movq $8, %rax
+    push %rax
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf1_173
+    jmp .Lf1_174
+.Lf1_173:
+    movq $59, %rax
+    jmp .Lf1_175
+.Lf1_174:
+    movslq -340(%rbp), %rax
+.Lf1_175:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_171:
+    movl %eax, -12(%rbp)
+    .loc 1 218 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_177
+    jmp .Lf1_176
+.Lf1_177:
+    movq $68, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_176:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 219 21
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    imulq $26, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_179
+    jmp .Lf1_178
+.Lf1_179:
+    movq $9, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_178:
+    push %rax
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 220 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_165:
+.Lf1_167:
+    .loc 1 216 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_166
+.Lf1_164:
+    addq $0, %rsp
+    .loc 1 223 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_160:
+    .loc 1 224 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_161
+.Lf1_159:
+    addq $8, %rsp
+    .loc 1 226 5
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_181
+    jmp .Lf1_182
+.Lf1_181:
+    movq $81, %rax
+    jmp .Lf1_183
+.Lf1_182:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf1_183:
+    push %rax
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_185
+    jmp .Lf1_184
+.Lf1_185:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_184:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_186
+    .loc 1 227 9
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $62, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $17, %rax
+    addq $18, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 228 9
+    cmpl $73, -68(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_188
+    jmp .Lf1_187
+.Lf1_188:
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_190
+    jmp .Lf1_189
+.Lf1_190:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_189:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_187:
+    movl %eax, -12(%rbp)
+    .loc 1 229 9
+    movq $53, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $71, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_191
+    jmp .Lf1_192
+.Lf1_191:
+    movslq -4(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_193
+.Lf1_192:
+    cmpl $42, -4(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf1_193:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_180
+.Lf1_186:
+    .loc 1 231 9
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_197
+    jmp .Lf1_198
+.Lf1_197:
+    movslq -68(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_199
+.Lf1_198:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $45, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_199:
+    cmpq $0, %rax
+    jne .Lf1_194
+    jmp .Lf1_195
+.Lf1_194:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_201
+    jmp .Lf1_200
+.Lf1_201:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_200:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_196
+.Lf1_195:
+    movq $43, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_202
+    jmp .Lf1_203
+.Lf1_202:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_204
+.Lf1_203:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf1_204:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_196:
+    movl %eax, -28(%rbp)
+    .loc 1 232 9
+    movq $17, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_205
+    jmp .Lf1_206
+.Lf1_205:
+    movq $37, %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_207
+.Lf1_206:
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_207:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_209
+    jmp .Lf1_208
+.Lf1_209:
+    movq $49, %rax
+    cmpq $0, %rax
+    jne .Lf1_210
+    jmp .Lf1_211
+.Lf1_210:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_212
+.Lf1_211:
+    movslq -16(%rbp), %rax
+.Lf1_212:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_208:
+    movl %eax, -8(%rbp)
+    .loc 1 233 9
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_213
+    jmp .Lf1_214
+.Lf1_213:
+    movq $58, %rax
+    jmp .Lf1_215
+.Lf1_214:
+    movslq -4(%rbp), %rax
+.Lf1_215:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_180:
+    .loc 1 235 5
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_218
+.Lf1_217:
+    movq $7, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_218:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 236 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_224
+    .p2align 4,,10
+.Lf1_223:
+    .loc 1 237 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_225
+    jmp .Lf1_226
+.Lf1_225:
+    movslq -40(%rbp), %rax
+    jmp .Lf1_227
+.Lf1_226:
+    movslq -340(%rbp), %rax
+.Lf1_227:
+    push %rax
+    movq $21, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $19, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_228
+    jmp .Lf1_229
+.Lf1_228:
+    movslq -4(%rbp), %rax
+    imulq $9, %rax
+    movslq %eax, %rax
+    jmp .Lf1_230
+.Lf1_229:
+    movslq -4(%rbp), %rax
+    imulq $78, %rax
+    movslq %eax, %rax
+.Lf1_230:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 238 9
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 240 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 241 13
+    jmp .Lf1_234
+    .p2align 4,,10
+.Lf1_233:
+    .loc 1 242 17
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_235
+    jmp .Lf1_236
+.Lf1_235:
+    movq $2, %rax
+    push %rax
+    cmpl $83, -344(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_237
+.Lf1_236:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_239
+    jmp .Lf1_238
+.Lf1_239:
+    movq $69, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_238:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_241
+    jmp .Lf1_240
+.Lf1_241:
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_240:
+.Lf1_237:
+    movl %eax, -12(%rbp)
+    .loc 1 243 17
+    cmpl $58, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $37, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_243
+    jmp .Lf1_242
+.Lf1_243:
+    movq $13, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_242:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 244 17
+    movq $8, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_245
+    jmp .Lf1_244
+.Lf1_245:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_244:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 245 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_232:
+.Lf1_234:
+    .loc 1 241 20
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_233
+.Lf1_231:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_222:
+    .loc 1 236 32
+    incl -340(%rbp)
+.Lf1_224:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_223
+.Lf1_221:
+    addq $8, %rsp
+    .loc 1 250 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 251 9
+    jmp .Lf1_249
+    .p2align 4,,10
+.Lf1_248:
+    .loc 1 252 13
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    subq $57, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_251
+    jmp .Lf1_250
+.Lf1_251:
+    movq $0, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_250:
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_252
+    jmp .Lf1_253
+.Lf1_252:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_254
+.Lf1_253:
+    cmpl $20, -44(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf1_254:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -32(%rbp)
+    .loc 1 254 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 255 17
+    jmp .Lf1_258
+    .p2align 4,,10
+.Lf1_257:
+    .loc 1 256 21
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $69, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_259
+    jmp .Lf1_255
+.Lf1_259:
+    .loc 1 257 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_260
+    jmp .Lf1_261
+.Lf1_260:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_262
+.Lf1_261:
+    movslq -8(%rbp), %rax
+.Lf1_262:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_263
+    jmp .Lf1_264
+.Lf1_263:
+    movq $46, %rax
+    jmp .Lf1_265
+.Lf1_264:
+    movq $17, %rax
+.Lf1_265:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_267
+    jmp .Lf1_266
+.Lf1_267:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_266:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 258 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_272
+    jmp .Lf1_271
+.Lf1_272:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_271:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_274
+    jmp .Lf1_273
+.Lf1_274:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_275
+    jmp .Lf1_276
+.Lf1_275:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_277
+.Lf1_276:
+    movslq -340(%rbp), %rax
+.Lf1_277:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_273:
+    cmpq $0, %rax
+    jne .Lf1_268
+    jmp .Lf1_269
+.Lf1_268:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_278
+    jmp .Lf1_279
+.Lf1_278:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf1_280
+.Lf1_279:
+    movq $3, %rax
+.Lf1_280:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_270
+.Lf1_269:
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $99, -60(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_270:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 259 21
+    movq $13, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_281
+    jmp .Lf1_282
+.Lf1_281:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_283
+.Lf1_282:
+    movslq -16(%rbp), %rax
+.Lf1_283:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_287
+    jmp .Lf1_288
+.Lf1_287:
+    movq $87, %rax
+    jmp .Lf1_289
+.Lf1_288:
+    movq $57, %rax
+.Lf1_289:
+    cmpq $0, %rax
+    jne .Lf1_284
+    jmp .Lf1_285
+.Lf1_284:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $49, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_286
+.Lf1_285:
+    movslq -344(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_286:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 260 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_256:
+.Lf1_258:
+    .loc 1 255 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_257
+.Lf1_255:
+    addq $0, %rsp
+    .loc 1 263 13
+    movq $14, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_293
+    jmp .Lf1_294
+.Lf1_293:
+    movq $9, %rax
+    push %rax
+    movq $80, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_295
+.Lf1_294:
+    movq $77, %rax
+    cmpq $0, %rax
+    jne .Lf1_296
+    jmp .Lf1_297
+.Lf1_296:
+    movq $28, %rax
+    jmp .Lf1_298
+.Lf1_297:
+    movslq -4(%rbp), %rax
+.Lf1_298:
+.Lf1_295:
+    cmpq $0, %rax
+    jne .Lf1_290
+    jmp .Lf1_291
+.Lf1_290:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_299
+    jmp .Lf1_300
+.Lf1_299:
+    movslq -64(%rbp), %rax
+    jmp .Lf1_301
+.Lf1_300:
+    movslq -76(%rbp), %rax
+.Lf1_301:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_303
+    jmp .Lf1_302
+.Lf1_303:
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_302:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_292
+.Lf1_291:
+    movq $47, %rax
+    cmpq $9, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_305
+    jmp .Lf1_304
+.Lf1_305:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_304:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_292:
+    movl %eax, -4(%rbp)
+    .loc 1 264 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_247:
+.Lf1_249:
+    .loc 1 251 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_248
+.Lf1_246:
+    addq $8, %rsp
+    .loc 1 267 5
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $94, %rax
+    cmpq $0, %rax
+    jne .Lf1_306
+    jmp .Lf1_307
+.Lf1_306:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_308
+.Lf1_307:
+    movslq -16(%rbp), %rax
+.Lf1_308:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 269 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 270 5
+    subq $8, %rsp
+    movq $80, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 271 5
+    movq $30, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 272 5
+    subq $8, %rsp
+    movq $82, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 273 5
+    movq $86, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 274 5
+    subq $64, %rsp
+    .loc 1 275 5
+    subq $256, %rsp
+    .loc 1 276 5
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_5
+    jmp .Lf2_6
+.Lf2_5:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf2_7
+.Lf2_6:
+    movslq -4(%rbp), %rax
+.Lf2_7:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_8
+    jmp .Lf2_9
+.Lf2_8:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_10
+.Lf2_9:
+    movslq -8(%rbp), %rax
+.Lf2_10:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_2
+    jmp .Lf2_3
+.Lf2_2:
+    movq $8, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_11
+    jmp .Lf2_12
+.Lf2_11:
+    movslq -4(%rbp), %rax
+    imulq $54, %rax
+    movslq %eax, %rax
+    jmp .Lf2_13
+.Lf2_12:
+    movslq -80(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf2_13:
+    jmp .Lf2_4
+.Lf2_3:
+    movq $71, %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_15
+    jmp .Lf2_14
+.Lf2_15:
+    movslq -4(%rbp), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_14:
+.Lf2_4:
+    cmpq $0, %rax
+    je .Lf2_16
+    .loc 1 277 9
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_20
+    jmp .Lf2_21
+.Lf2_20:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_23
+    jmp .Lf2_24
+.Lf2_23:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf2_25
+.Lf2_24:
+    movslq -12(%rbp), %rax
+.Lf2_25:
+    jmp .Lf2_22
+.Lf2_21:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_27
+    jmp .Lf2_26
+.Lf2_27:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_26:
+.Lf2_22:
+    cmpq $0, %rax
+    jne .Lf2_17
+    jmp .Lf2_18
+.Lf2_17:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_28
+    jmp .Lf2_29
+.Lf2_28:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $89, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_30
+.Lf2_29:
+    movq $83, %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_30:
+    jmp .Lf2_19
+.Lf2_18:
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_32
+.Lf2_31:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    movq $97, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_33
+.Lf2_32:
+    movslq -32(%rbp), %rax
+    addq $12, %rax
+    movslq %eax, %rax
+.Lf2_33:
+.Lf2_19:
+    movl %eax, -12(%rbp)
+    .loc 1 278 9
+    movq $3, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $90, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $22, %rax
+    imulq $52, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $58, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 279 9
+    movq $43, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_34
+    jmp .Lf2_35
+.Lf2_34:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_38
+    jmp .Lf2_37
+.Lf2_38:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_37:
+    jmp .Lf2_36
+.Lf2_35:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_36:
+    push %rax
+    cmpl $80, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_39
+    jmp .Lf2_40
+.Lf2_39:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_41
+.Lf2_40:
+    movslq -8(%rbp), %rax
+.Lf2_41:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_1
+.Lf2_16:
+    .loc 1 281 9
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $91, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 282 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_43
+    jmp .Lf2_42
+.Lf2_43:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_42:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_45
+    jmp .Lf2_44
+.Lf2_45:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_44:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 283 9
+    cmpl $89, -52(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_46
+    jmp .Lf2_47
+.Lf2_46:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_48
+.Lf2_47:
+    movslq -12(%rbp), %rax
+.Lf2_48:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_49
+    jmp .Lf2_50
+.Lf2_49:
+    movslq -28(%rbp), %rax
+    jmp .Lf2_51
+.Lf2_50:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf2_51:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_1:
+    .loc 1 286 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 287 9
+    jmp .Lf2_55
+    .p2align 4,,10
+.Lf2_54:
+    .loc 1 288 13
+    movq $64, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $69, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 289 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 290 17
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_62
+    jmp .Lf2_61
+.Lf2_62:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_63
+    jmp .Lf2_64
+.Lf2_63:
+    movq $60, %rax
+    jmp .Lf2_65
+.Lf2_64:
+    movslq -16(%rbp), %rax
+.Lf2_65:
+    push %rax
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_67
+    jmp .Lf2_66
+.Lf2_67:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_66:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_61:
+    movl %eax, -4(%rbp)
+    .loc 1 291 17
+    movslq -64(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $48, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_69
+    jmp .Lf2_68
+.Lf2_69:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_68:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 292 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_71
+    jmp .Lf2_70
+.Lf2_71:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_70:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_73
+    jmp .Lf2_72
+.Lf2_73:
+    movq $58, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_72:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_74
+    jmp .Lf2_75
+.Lf2_74:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_76
+.Lf2_75:
+    movq $13, %rax
+.Lf2_76:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_78
+    jmp .Lf2_77
+.Lf2_78:
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_77:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+.Lf2_60:
+    .loc 1 289 38
+    incl -344(%rbp)
+    .loc 1 290 17
+    movq $1, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_80
+    jmp .Lf2_79
+.Lf2_80:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_82
+.Lf2_81:
+    movq $60, %rax
+    jmp .Lf2_83
+.Lf2_82:
+    movslq -16(%rbp), %rax
+.Lf2_83:
+    push %rax
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_85
+    jmp .Lf2_84
+.Lf2_85:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_84:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_79:
+    movl %eax, -4(%rbp)
+    .loc 1 291 17
+    movslq -64(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $48, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_87
+    jmp .Lf2_86
+.Lf2_87:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_86:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 292 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_89
+    jmp .Lf2_88
+.Lf2_89:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_88:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_91
+    jmp .Lf2_90
+.Lf2_91:
+    movq $58, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_90:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_92
+    jmp .Lf2_93
+.Lf2_92:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_94
+.Lf2_93:
+    movq $13, %rax
+.Lf2_94:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_96
+    jmp .Lf2_95
+.Lf2_96:
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_95:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+.Lf2_59:
+    .loc 1 289 38
+    incl -344(%rbp)
+.Lf2_58:
+    addq $0, %rsp
+    .loc 1 294 13
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_101
+    jmp .Lf2_100
+.Lf2_101:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_100:
+    cmpq $0, %rax
+    jne .Lf2_97
+    jmp .Lf2_98
+.Lf2_97:
+    cmpl $93, -72(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_99
+.Lf2_98:
+    movq $5, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_99:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $58, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 295 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_53:
+.Lf2_55:
+    .loc 1 287 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_54
+.Lf2_52:
+    addq $8, %rsp
+    .loc 1 299 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 300 9
+    .p2align 4,,10
+.Lf2_104:
+    .loc 1 301 13
+    movslq -56(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $53, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 302 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_110
+    .p2align 4,,10
+.Lf2_109:
+    .loc 1 303 17
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_112
+    jmp .Lf2_111
+.Lf2_112:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_111:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_114
+    jmp .Lf2_113
+.Lf2_114:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_116
+    jmp .Lf2_115
+.Lf2_116:
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_115:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_113:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 304 17
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_117
+    jmp .Lf2_118
+.Lf2_117:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_121
+    jmp .Lf2_120
+.Lf2_121:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_120:
+    jmp .Lf2_119
+.Lf2_118:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_123
+.Lf2_122:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_124
+.Lf2_123:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf2_124:
+.Lf2_119:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 305 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_126
+    jmp .Lf2_125
+.Lf2_126:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_125:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $73, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_108:
+    .loc 1 302 38
+    incl -344(%rbp)
+.Lf2_110:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_109
+.Lf2_107:
+    addq $0, %rsp
+    .loc 1 307 13
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    addq $41, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_128
+    jmp .Lf2_127
+.Lf2_128:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_129
+    jmp .Lf2_130
+.Lf2_129:
+    movslq -340(%rbp), %rax
+    addl -68(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_131
+.Lf2_130:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_132
+    jmp .Lf2_133
+.Lf2_132:
+    movq $8, %rax
+    jmp .Lf2_134
+.Lf2_133:
+    movslq -8(%rbp), %rax
+.Lf2_134:
+.Lf2_131:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_127:
+    movl %eax, -4(%rbp)
+    .loc 1 308 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_103:
+    .loc 1 309 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_104
+.Lf2_102:
+    addq $8, %rsp
+    .loc 1 312 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 313 9
+    .p2align 4,,10
+.Lf2_137:
+    .loc 1 314 13
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_139
+    jmp .Lf2_138
+.Lf2_139:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_138:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $55, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    .loc 1 315 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_145
+    .p2align 4,,10
+.Lf2_144:
+    .loc 1 316 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_150
+    jmp .Lf2_151
+.Lf2_150:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_152
+.Lf2_151:
+    movslq -4(%rbp), %rax
+.Lf2_152:
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_149
+    jmp .Lf2_142
+.Lf2_149:
+    .loc 1 317 17
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_154
+    jmp .Lf2_153
+.Lf2_154:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $37, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_153:
+    movl %eax, -8(%rbp)
+    .loc 1 318 17
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $51, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 319 17
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_155
+    jmp .Lf2_156
+.Lf2_155:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_159
+    jmp .Lf2_158
+.Lf2_159:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $98, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_158:
+    jmp .Lf2_157
+.Lf2_156:
+    movq $69, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_161
+    jmp .Lf2_160
+.Lf2_161:
+    movslq -16(%rbp), %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_160:
+.Lf2_157:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_148:
+    .loc 1 315 38
+    incl -344(%rbp)
+    .loc 1 316 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_163
+    jmp .Lf2_164
+.Lf2_163:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_165
+.Lf2_164:
+    movslq -4(%rbp), %rax
+.Lf2_165:
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_162
+    jmp .Lf2_142
+.Lf2_162:
+    .loc 1 317 17
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_167
+    jmp .Lf2_166
+.Lf2_167:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $37, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_166:
+    movl %eax, -8(%rbp)
+    .loc 1 318 17
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $51, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 319 17
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_168
+    jmp .Lf2_169
+.Lf2_168:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_172
+    jmp .Lf2_171
+.Lf2_172:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $98, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_171:
+    jmp .Lf2_170
+.Lf2_169:
+    movq $69, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_174
+    jmp .Lf2_173
+.Lf2_174:
+    movslq -16(%rbp), %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_173:
+.Lf2_170:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_147:
+    .loc 1 315 38
+    incl -344(%rbp)
+.Lf2_145:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $8, %rax
+    jl .Lf2_144
+.Lf2_146:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf2_142
+    .loc 1 316 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_176
+    jmp .Lf2_177
+.Lf2_176:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_178
+.Lf2_177:
+    movslq -4(%rbp), %rax
+.Lf2_178:
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_175
+    jmp .Lf2_142
+.Lf2_175:
+    .loc 1 317 17
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_180
+    jmp .Lf2_179
+.Lf2_180:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $37, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_179:
+    movl %eax, -8(%rbp)
+    .loc 1 318 17
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $51, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 319 17
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_181
+    jmp .Lf2_182
+.Lf2_181:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_185
+    jmp .Lf2_184
+.Lf2_185:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    imulq $98, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_184:
+    jmp .Lf2_183
+.Lf2_182:
+    movq $69, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_187
+    jmp .Lf2_186
+.Lf2_187:
+    movslq -16(%rbp), %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_186:
+.Lf2_183:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_143:
+    .loc 1 315 38
+    incl -344(%rbp)
+    jmp .Lf2_146
+.Lf2_142:
+    addq $0, %rsp
+    .loc 1 321 13
+    movq $92, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_189
+    jmp .Lf2_188
+.Lf2_189:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_188:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 322 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_136:
+    .loc 1 323 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_137
+.Lf2_135:
+    addq $8, %rsp
+    .loc 1 326 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 327 9
+    .p2align 4,,10
+.Lf2_192:
+    .loc 1 328 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_195
+    jmp .Lf2_194
+.Lf2_195:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_194:
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_193
+    jmp .Lf2_190
+.Lf2_193:
+    .loc 1 329 13
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_196
+    jmp .Lf2_197
+.Lf2_196:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf2_198
+.Lf2_197:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf2_198:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_200
+    jmp .Lf2_199
+.Lf2_200:
+    movq $1, %rax
+    push %rax
+    movq $18, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -68(%rbp)
+    .loc 1 330 13
+    movslq -8(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_201
+    jmp .Lf2_202
+.Lf2_201:
+    movq $1, %rax
+    push %rax
+    movq $94, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_203
+.Lf2_202:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf2_203:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -60(%rbp)
+    .loc 1 331 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_209
+    .p2align 4,,10
+.Lf2_208:
+    .loc 1 332 17
+    movq $63, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $96, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_210
+    jmp .Lf2_206
+.Lf2_210:
+    .loc 1 333 17
+    cmpl $31, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_212
+    jmp .Lf2_211
+.Lf2_212:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_214
+    jmp .Lf2_213
+.Lf2_214:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_213:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_211:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_216
+    jmp .Lf2_215
+.Lf2_216:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_215:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 334 17
+    movslq -40(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_218
+    jmp .Lf2_217
+.Lf2_218:
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_217:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 335 17
+    movq $1, %rax
+    push %rax
+    movq $43, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_220
+    jmp .Lf2_219
+.Lf2_220:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_219:
+    push %rax
+    movq $57, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_207:
+    .loc 1 331 38
+    incl -344(%rbp)
+.Lf2_209:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_208
+.Lf2_206:
+    addq $0, %rsp
+    .loc 1 337 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_191:
+    .loc 1 338 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_192
+.Lf2_190:
+    addq $8, %rsp
+    .loc 1 340 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_226
+    .p2align 4,,10
+.Lf2_225:
+    .loc 1 341 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_228
+    jmp .Lf2_229
+.Lf2_228:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_230
+.Lf2_229:
+    movslq -16(%rbp), %rax
+.Lf2_230:
+    cmpq $80, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_227
+    jmp .Lf2_223
+.Lf2_227:
+    .loc 1 342 9
+    movq $5, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 343 9
+    movq $23, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $28, %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    subq $12, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $0, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 345 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 346 13
+    .p2align 4,,10
+.Lf2_233:
+    .loc 1 347 17
+    movq $4, %rax
+    push %rax
+    movq $16, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_235
+    jmp .Lf2_234
+.Lf2_235:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_234:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_240
+    jmp .Lf2_239
+.Lf2_240:
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_239:
+    cmpq $0, %rax
+    jne .Lf2_236
+    jmp .Lf2_237
+.Lf2_236:
+    cmpl $95, -80(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_238
+.Lf2_237:
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf2_238:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 348 17
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 349 17
+    movq $4, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 350 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_232:
+    .loc 1 351 22
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_233
+.Lf2_231:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_224:
+    .loc 1 340 30
+    incl -340(%rbp)
+.Lf2_226:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_225
+.Lf2_223:
+    addq $8, %rsp
+    .loc 1 355 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 356 9
+    jmp .Lf2_244
+    .p2align 4,,10
+.Lf2_243:
+    .loc 1 358 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 359 17
+    .p2align 4,,10
+.Lf2_247:
+    .loc 1 360 21
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $80, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_248
+    jmp .Lf2_245
+.Lf2_248:
+    .loc 1 361 21
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_253
+    jmp .Lf2_252
+.Lf2_253:
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_252:
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_249
+    jmp .Lf2_250
+.Lf2_249:
+    movslq -80(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_255
+    jmp .Lf2_254
+.Lf2_255:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_254:
+    jmp .Lf2_251
+.Lf2_250:
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf2_251:
+    movl %eax, -28(%rbp)
+    .loc 1 362 21
+    movq $5, %rax
+    push %rax
+    movq $32, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_257
+    jmp .Lf2_256
+.Lf2_257:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_256:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 363 21
+    movq $46, %rax
+    cmpq $15, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_259
+    jmp .Lf2_258
+.Lf2_259:
+    cmpl $58, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_261
+    jmp .Lf2_260
+.Lf2_261:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_260:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_258:
+    movl %eax, -12(%rbp)
+    .loc 1 364 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_246:
+    .loc 1 365 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_247
+.Lf2_245:
+    addq $0, %rsp
+    .loc 1 367 13
+    movq $2, %rax
+    cmpq $32, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $45, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $22, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_263
+    jmp .Lf2_262
+.Lf2_263:
+    movq $80, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_262:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 368 13
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    movq $9, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_268
+    jmp .Lf2_267
+.Lf2_268:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_267:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_264
+    jmp .Lf2_265
+.Lf2_264:
+    movq $67, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_269
+    jmp .Lf2_270
+.Lf2_269:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_273
+    jmp .Lf2_272
+.Lf2_273:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_272:
+    jmp .Lf2_271
+.Lf2_270:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_275
+    jmp .Lf2_274
+.Lf2_275:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_274:
+.Lf2_271:
+    jmp .Lf2_266
+.Lf2_265:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_266:
+    movl %eax, -8(%rbp)
+    .loc 1 369 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_242:
+.Lf2_244:
+    .loc 1 356 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_243
+.Lf2_241:
+    addq $8, %rsp
+    .loc 1 372 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_281
+    .p2align 4,,10
+.Lf2_280:
+    .loc 1 373 9
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_282
+    jmp .Lf2_278
+.Lf2_282:
+    .loc 1 374 9
+    cmpl $8, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $51, %rax
+    cmpq $33, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_284
+    jmp .Lf2_283
+.Lf2_284:
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_283:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 375 9
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_286
+    jmp .Lf2_285
+.Lf2_286:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_285:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_288
+    jmp .Lf2_287
+.Lf2_288:
+    movslq -340(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_287:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 377 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 378 13
+    jmp .Lf2_292
+    .p2align 4,,10
+.Lf2_291:
+    .loc 1 379 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_293
+    jmp .Lf2_294
+.Lf2_293:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf2_295
+.Lf2_294:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf2_295:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_297
+    jmp .Lf2_296
+.Lf2_297:
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_296:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_298
+    jmp .Lf2_299
+.Lf2_298:
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_300
+.Lf2_299:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_300:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 380 17
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_302
+    jmp .Lf2_301
+.Lf2_302:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_301:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 381 17
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_304
+    jmp .Lf2_303
+.Lf2_304:
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_303:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $28, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $73, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 382 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_290:
+.Lf2_292:
+    .loc 1 378 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_291
+.Lf2_289:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_279:
+    .loc 1 372 32
+    incl -340(%rbp)
+.Lf2_281:
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_280
+.Lf2_278:
+    addq $8, %rsp
+    .loc 1 387 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 388 9
+    jmp .Lf2_308
+    .p2align 4,,10
+.Lf2_307:
+    .loc 1 389 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_314
+    .p2align 4,,10
+.Lf2_313:
+    .loc 1 390 17
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 391 17
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_315
+    jmp .Lf2_316
+.Lf2_315:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_319
+    jmp .Lf2_318
+.Lf2_319:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_318:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_321
+    jmp .Lf2_320
+.Lf2_321:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_320:
+    jmp .Lf2_317
+.Lf2_316:
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_323
+    jmp .Lf2_322
+.Lf2_323:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_322:
+    push %rax
+    cmpl $61, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_317:
+    movl %eax, -28(%rbp)
+    .loc 1 392 17
+    movq $78, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_325
+    jmp .Lf2_324
+.Lf2_325:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_324:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_312:
+    .loc 1 389 40
+    incl -344(%rbp)
+.Lf2_314:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_313
+.Lf2_311:
+    addq $0, %rsp
+    .loc 1 394 13
+    movq $51, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_327
+    jmp .Lf2_326
+.Lf2_327:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_326:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_328
+    jmp .Lf2_329
+.Lf2_328:
+    movq $94, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_330
+.Lf2_329:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_331
+    jmp .Lf2_332
+.Lf2_331:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_333
+.Lf2_332:
+    movq $33, %rax
+.Lf2_333:
+.Lf2_330:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 395 13
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    imulq $80, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_334
+    jmp .Lf2_335
+.Lf2_334:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_338
+    jmp .Lf2_337
+.Lf2_338:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_337:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_339
+    jmp .Lf2_340
+.Lf2_339:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_341
+.Lf2_340:
+    movq $47, %rax
+.Lf2_341:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_336
+.Lf2_335:
+    cmpl $51, -64(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_343
+    jmp .Lf2_342
+.Lf2_343:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_342:
+.Lf2_336:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 396 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_306:
+.Lf2_308:
+    .loc 1 388 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_307
+.Lf2_305:
+    addq $8, %rsp
+    .loc 1 399 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_349
+    .p2align 4,,10
+.Lf2_348:
+    .loc 1 400 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_350
+    jmp .Lf2_351
+.Lf2_350:
+    movq $24, %rax
+    jmp .Lf2_352
+.Lf2_351:
+    movslq -340(%rbp), %rax
+.Lf2_352:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 401 9
+    movq $96, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_354
+    jmp .Lf2_353
+.Lf2_354:
+    movq $17, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_353:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $32, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_356
+    jmp .Lf2_355
+.Lf2_356:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_355:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 402 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_362
+    .p2align 4,,10
+.Lf2_361:
+    .loc 1 403 13
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_364
+    jmp .Lf2_363
+.Lf2_364:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_363:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_366
+    jmp .Lf2_365
+.Lf2_366:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_365:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $81, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_367
+    jmp .Lf2_368
+.Lf2_367:
+    movq $29, %rax
+    jmp .Lf2_369
+.Lf2_368:
+    movslq -16(%rbp), %rax
+.Lf2_369:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 404 13
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_371
+    jmp .Lf2_370
+.Lf2_371:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_372
+    jmp .Lf2_373
+.Lf2_372:
+    movslq -72(%rbp), %rax
+    jmp .Lf2_374
+.Lf2_373:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf2_374:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_370:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    movq $59, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $49, %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 405 13
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_378
+    jmp .Lf2_379
+.Lf2_378:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_380
+.Lf2_379:
+    movslq -52(%rbp), %rax
+.Lf2_380:
+    cmpq $0, %rax
+    jne .Lf2_375
+    jmp .Lf2_376
+.Lf2_375:
+    movslq -4(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_377
+.Lf2_376:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_382
+    jmp .Lf2_381
+.Lf2_382:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_381:
+.Lf2_377:
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_384
+    jmp .Lf2_383
+.Lf2_384:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_383:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_386
+    jmp .Lf2_385
+.Lf2_386:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_385:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_360:
+    .loc 1 402 36
+    incl -344(%rbp)
+.Lf2_362:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_361
+.Lf2_359:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_347:
+    .loc 1 399 32
+    incl -340(%rbp)
+.Lf2_349:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_348
+.Lf2_346:
+    addq $8, %rsp
+    .loc 1 408 5
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_388
+    jmp .Lf2_387
+.Lf2_388:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_389
+    jmp .Lf2_390
+.Lf2_389:
+    movslq -68(%rbp), %rax
+    jmp .Lf2_391
+.Lf2_390:
+    movslq -68(%rbp), %rax
+.Lf2_391:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_387:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 410 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 411 5
+    subq $8, %rsp
+    movq $88, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 412 5
+    movq $55, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 413 5
+    subq $8, %rsp
+    movq $48, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 414 5
+    movq $88, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 415 5
+    subq $64, %rsp
+    .loc 1 416 5
+    subq $256, %rsp
+    .loc 1 418 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 419 9
+    jmp .Lf3_4
+    .p2align 4,,10
+.Lf3_3:
+    .loc 1 420 13
+    cmpl $84, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_6
+    jmp .Lf3_5
+.Lf3_6:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_5:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_8
+    jmp .Lf3_7
+.Lf3_8:
+    movslq -4(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_7:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 421 13
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_9
+    jmp .Lf3_10
+.Lf3_9:
+    movq $4, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_12
+    jmp .Lf3_13
+.Lf3_12:
+    movq $22, %rax
+    jmp .Lf3_14
+.Lf3_13:
+    movslq -4(%rbp), %rax
+.Lf3_14:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_11
+.Lf3_10:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $43, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf3_11:
+    movl %eax, -4(%rbp)
+    .loc 1 422 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_20
+    .p2align 4,,10
+.Lf3_19:
+    .loc 1 423 17
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_22
+    jmp .Lf3_23
+.Lf3_22:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_24
+.Lf3_23:
+    movslq -4(%rbp), %rax
+.Lf3_24:
+    cmpq $83, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_21
+    jmp .Lf3_17
+.Lf3_21:
+    .loc 1 424 17
+    movq $6, %rax
+    cmpq $5, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf3_25
+    jmp .Lf3_26
+.Lf3_25:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_28
+    jmp .Lf3_29
+.Lf3_28:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_30
+.Lf3_29:
+    movslq -40(%rbp), %rax
+.Lf3_30:
+    jmp .Lf3_27
+.Lf3_26:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_31
+    jmp .Lf3_32
+.Lf3_31:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf3_33
+.Lf3_32:
+    movq $5, %rax
+.Lf3_33:
+.Lf3_27:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_34
+    jmp .Lf3_35
+.Lf3_34:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf3_36
+.Lf3_35:
+    movslq -16(%rbp), %rax
+.Lf3_36:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    imulq $21, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 425 17
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $40, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $93, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_38
+    jmp .Lf3_37
+.Lf3_38:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_37:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -56(%rbp)
+    .loc 1 426 17
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_40
+    jmp .Lf3_39
+.Lf3_40:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_39:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $6, %rax
+    cmpq $0, %rax
+    jne .Lf3_41
+    jmp .Lf3_42
+.Lf3_41:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_43
+.Lf3_42:
+    movslq -60(%rbp), %rax
+.Lf3_43:
+    push %rax
+    cmpl $56, -344(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -60(%rbp)
+    addq $0, %rsp
+.Lf3_18:
+    .loc 1 422 38
+    incl -344(%rbp)
+.Lf3_20:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_19
+.Lf3_17:
+    addq $0, %rsp
+    .loc 1 428 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_2:
+.Lf3_4:
+    .loc 1 419 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_3
+.Lf3_1:
+    addq $8, %rsp
+    .loc 1 432 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 433 9
+    .p2align 4,,10
+.Lf3_46:
+    .loc 1 434 13
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf3_47
+    jmp .Lf3_48
+.Lf3_47:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf3_49
+.Lf3_48:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf3_49:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 435 13
+    movq $3, %rax
+    push %rax
+    movq $37, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_51
+    jmp .Lf3_50
+.Lf3_51:
+    cmpl $93, -32(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_50:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 437 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 438 17
+    jmp .Lf3_55
+    .p2align 4,,10
+.Lf3_54:
+    .loc 1 439 21
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $69, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_56
+    jmp .Lf3_52
+.Lf3_56:
+    .loc 1 440 21
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_57
+    jmp .Lf3_58
+.Lf3_57:
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_59
+.Lf3_58:
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf3_59:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 441 21
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_61
+    jmp .Lf3_60
+.Lf3_61:
+    movq $40, %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_60:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_62
+    jmp .Lf3_63
+.Lf3_62:
+    movslq -344(%rbp), %rax
+    jmp .Lf3_64
+.Lf3_63:
+    movq $39, %rax
+.Lf3_64:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -32(%rbp)
+    .loc 1 442 21
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_69
+    jmp .Lf3_68
+.Lf3_69:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_68:
+    cmpq $0, %rax
+    jne .Lf3_65
+    jmp .Lf3_66
+.Lf3_65:
+    movslq -340(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_67
+.Lf3_66:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_70
+    jmp .Lf3_71
+.Lf3_70:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf3_72
+.Lf3_71:
+    movslq -68(%rbp), %rax
+.Lf3_72:
+.Lf3_67:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 443 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_53:
+.Lf3_55:
+    .loc 1 438 24
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_54
+.Lf3_52:
+    addq $0, %rsp
+    .loc 1 446 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_45:
+    .loc 1 447 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_46
+.Lf3_44:
+    addq $8, %rsp
+    .loc 1 449 5
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_74
+    .loc 1 450 9
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $76, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_76
+    jmp .Lf3_75
+.Lf3_76:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_75:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -72(%rbp)
+    .loc 1 451 9
+    movslq -4(%rbp), %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_78
+    jmp .Lf3_77
+.Lf3_78:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_77:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $24, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf3_79
+    jmp .Lf3_80
+.Lf3_79:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_81
+.Lf3_80:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf3_81:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 452 9
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_73
+.Lf3_74:
+    .loc 1 454 9
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_83
+    jmp .Lf3_82
+.Lf3_83:
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_82:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_85
+    jmp .Lf3_84
+.Lf3_85:
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_84:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_86
+    jmp .Lf3_87
+.Lf3_86:
+    movq $5, %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_88
+.Lf3_87:
+    movq $92, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf3_88:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 455 9
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $4, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 456 9
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_90
+    jmp .Lf3_89
+.Lf3_90:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_89:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_92
+    jmp .Lf3_91
+.Lf3_92:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_91:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_73:
+    .loc 1 458 5
+    movq $55, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_94
+    jmp .Lf3_95
+.Lf3_94:
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_96
+.Lf3_95:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_98
+    jmp .Lf3_97
+.Lf3_98:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_97:
+.Lf3_96:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf3_99
+    .loc 1 459 9
+    movq $2, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $35, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_101
+    jmp .Lf3_100
+.Lf3_101:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_103
+    jmp .Lf3_102
+.Lf3_103:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_102:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_100:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 460 9
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_107
+    jmp .Lf3_108
+.Lf3_107:
+    movslq -48(%rbp), %rax
+    jmp .Lf3_109
+.Lf3_108:
+    movslq -12(%rbp), %rax
+.Lf3_109:
+    cmpq $0, %rax
+    jne .Lf3_104
+    jmp .Lf3_105
+.Lf3_104:
+    cmpl $86, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_106
+.Lf3_105:
+    movq $99, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf3_106:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 461 9
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $14, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_111
+    jmp .Lf3_110
+.Lf3_111:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_110:
+    push %rax
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_113
+    jmp .Lf3_112
+.Lf3_113:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_112:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_93
+.Lf3_99:
+    .loc 1 463 9
+    movq $9, %rax
+    push %rax
+    movq $16, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    addq $93, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 464 9
+    movslq -12(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $81, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_114
+    jmp .Lf3_115
+.Lf3_114:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_116
+.Lf3_115:
+    movslq -8(%rbp), %rax
+.Lf3_116:
+    push %rax
+    movslq -48(%rbp), %rax
+    addq $65, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 465 9
+    movq $1, %rax
+    push %rax
+    movq $66, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_117
+    jmp .Lf3_118
+.Lf3_117:
+    movq $7, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_119
+.Lf3_118:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_120
+    jmp .Lf3_121
+.Lf3_120:
+    movq $85, %rax
+    jmp .Lf3_122
+.Lf3_121:
+    movq $65, %rax
+.Lf3_122:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf3_119:
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+.Lf3_93:
+    .loc 1 467 5
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $86, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $82, %rax
+    cmpq $84, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 468 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_125
+    jmp .Lf3_124
+.Lf3_125:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_124:
+    push %rax
+    cmpl $77, -48(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_127
+    jmp .Lf3_126
+.Lf3_127:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_126:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_128
+    jmp .Lf3_129
+.Lf3_128:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf3_130
+.Lf3_129:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf3_130:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    je .Lf3_131
+    .loc 1 469 9
+    movslq -60(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_133
+    jmp .Lf3_132
+.Lf3_133:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_132:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_134
+    jmp .Lf3_135
+.Lf3_134:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_136
+.Lf3_135:
+    movslq -16(%rbp), %rax
+.Lf3_136:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_137
+    jmp .Lf3_138
+.Lf3_137:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf3_139
+.Lf3_138:
+    movq $81, %rax
+.Lf3_139:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 470 9
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_141
+    jmp .Lf3_140
+.Lf3_141:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_140:
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $85, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_143
+    jmp .Lf3_142
+.Lf3_143:
+    movq $27, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_144
+    jmp .Lf3_145
+.Lf3_144:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_146
+.Lf3_145:
+    movslq -4(%rbp), %rax
+.Lf3_146:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_142:
+    movl %eax, -16(%rbp)
+    .loc 1 471 9
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_148
+    jmp .Lf3_147
+.Lf3_148:
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_147:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $39, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_123
+.Lf3_131:
+    .loc 1 473 9
+    movq $77, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_150
+    jmp .Lf3_149
+.Lf3_150:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_149:
+    push %rax
+    movq $75, %rax
+    imulq $44, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    imulq $25, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 474 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $6, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 475 9
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_151
+    jmp .Lf3_152
+.Lf3_151:
+    movslq -32(%rbp), %rax
+    jmp .Lf3_153
+.Lf3_152:
+    movq $28, %rax
+.Lf3_153:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf3_123:
+    .loc 1 477 5
+    movslq -60(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $14, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_155
+    jmp .Lf3_154
+.Lf3_155:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_154:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_157
+    jmp .Lf3_156
+.Lf3_157:
+    movq $42, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_156:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 478 5
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_160
+    jmp .Lf3_159
+.Lf3_160:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_159:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf3_161
+    .loc 1 479 9
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_163
+    jmp .Lf3_162
+.Lf3_163:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_162:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_164
+    jmp .Lf3_165
+.Lf3_164:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_166
+.Lf3_165:
+    movq $40, %rax
+.Lf3_166:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_168
+    jmp .Lf3_167
+.Lf3_168:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_167:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 480 9
+    movq $42, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_169
+    jmp .Lf3_170
+.Lf3_169:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_171
+.Lf3_170:
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf3_171:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_175
+    jmp .Lf3_176
+.Lf3_175:
+    movq $31, %rax
+    jmp .Lf3_177
+.Lf3_176:
+    movslq -8(%rbp), %rax
+.Lf3_177:
+    cmpq $0, %rax
+    jne .Lf3_172
+    jmp .Lf3_173
+.Lf3_172:
+    cmpl $30, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_174
+.Lf3_173:
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_174:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 481 9
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $47, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $51, -48(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $53, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_158
+.Lf3_161:
+    .loc 1 483 9
+    movq $6, %rax
+    push %rax
+    movq $13, %rax
+    imulq $37, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_179
+    jmp .Lf3_178
+.Lf3_179:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_178:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 484 9
+    cmpl $19, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_180
+    jmp .Lf3_181
+.Lf3_180:
+    movq $4, %rax
+    push %rax
+    cmpl $37, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_182
+.Lf3_181:
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_182:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 485 9
+    movq $59, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $19, %rax
+    cmpq $9, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_184
+    jmp .Lf3_183
+.Lf3_184:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_183:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_185
+    jmp .Lf3_186
+.Lf3_185:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_187
+.Lf3_186:
+    movslq -4(%rbp), %rax
+.Lf3_187:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf3_158:
+    .loc 1 488 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 489 9
+    .p2align 4,,10
+.Lf3_190:
+    .loc 1 490 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_196
+    .p2align 4,,10
+.Lf3_195:
+    .loc 1 491 17
+    cmpl $11, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $76, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 492 17
+    movq $2, %rax
+    push %rax
+    cmpl $92, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 493 17
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_200
+    jmp .Lf3_201
+.Lf3_200:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_202
+.Lf3_201:
+    movq $5, %rax
+.Lf3_202:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_204
+    jmp .Lf3_203
+.Lf3_204:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_203:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    addq $0, %rsp
+.Lf3_199:
+    .loc 1 490 38
+    incl -344(%rbp)
+    .loc 1 491 17
+    cmpl $11, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $76, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 492 17
+    movq $2, %rax
+    push %rax
+    cmpl $92, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 493 17
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_205
+    jmp .Lf3_206
+.Lf3_205:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_207
+.Lf3_206:
+    movq $5, %rax
+.Lf3_207:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_209
+    jmp .Lf3_208
+.Lf3_209:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_208:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    addq $0, %rsp
+.Lf3_198:
+    .loc 1 490 38
+    incl -344(%rbp)
+.Lf3_196:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $7, %rax
+    jl .Lf3_195
+.Lf3_197:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf3_193
+    .loc 1 491 17
+    cmpl $11, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $76, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 492 17
+    movq $2, %rax
+    push %rax
+    cmpl $92, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 493 17
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_210
+    jmp .Lf3_211
+.Lf3_210:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_212
+.Lf3_211:
+    movq $5, %rax
+.Lf3_212:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_214
+    jmp .Lf3_213
+.Lf3_214:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_213:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    addq $0, %rsp
+.Lf3_194:
+    .loc 1 490 38
+    incl -344(%rbp)
+    jmp .Lf3_197
+.Lf3_193:
+    addq $0, %rsp
+    .loc 1 495 13
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_215
+    jmp .Lf3_216
+.Lf3_215:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_217
+.Lf3_216:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_219
+    jmp .Lf3_218
+.Lf3_219:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_218:
+.Lf3_217:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -60(%rbp)
+    .loc 1 496 13
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_224
+    jmp .Lf3_223
+.Lf3_224:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_226
+    jmp .Lf3_225
+.Lf3_226:
+    movq $82, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_225:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_223:
+    cmpq $0, %rax
+    jne .Lf3_220
+    jmp .Lf3_221
+.Lf3_220:
+    cmpl $29, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_222
+.Lf3_221:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_228
+    jmp .Lf3_227
+.Lf3_228:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_227:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_230
+    jmp .Lf3_229
+.Lf3_230:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_229:
+.Lf3_222:
+    movl %eax, -4(%rbp)
+    .loc 1 497 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_189:
+    .loc 1 498 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_190
+.Lf3_188:
+    addq $8, %rsp
+    .loc 1 500 5
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    cmpq $0, %rax
+    jne .Lf3_232
+    jmp .Lf3_233
+.Lf3_232:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_234
+.Lf3_233:
+    movq $26, %rax
+.Lf3_234:
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $18, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_235
+    .loc 1 501 9
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 502 9
+    cmpl $74, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $98, %rax
+    subl -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_236
+    jmp .Lf3_237
+.Lf3_236:
+    movq $94, %rax
+    cmpq $0, %rax
+    jne .Lf3_239
+    jmp .Lf3_240
+.Lf3_239:
+    movslq -68(%rbp), %rax
+    jmp .Lf3_241
+.Lf3_240:
+    movslq -20(%rbp), %rax
+.Lf3_241:
+    push %rax
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_243
+    jmp .Lf3_242
+.Lf3_243:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_242:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_238
+.Lf3_237:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_244
+    jmp .Lf3_245
+.Lf3_244:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_246
+.Lf3_245:
+    movslq -12(%rbp), %rax
+.Lf3_246:
+    push %rax
+    movq $6, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf3_238:
+    movl %eax, -12(%rbp)
+    .loc 1 503 9
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_247
+    jmp .Lf3_248
+.Lf3_247:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_249
+.Lf3_248:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf3_249:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_251
+    jmp .Lf3_250
+.Lf3_251:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_252
+    jmp .Lf3_253
+.Lf3_252:
+    movq $5, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_254
+.Lf3_253:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_256
+    jmp .Lf3_255
+.Lf3_256:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_255:
+.Lf3_254:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_250:
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_231
+.Lf3_235:
+    .loc 1 505 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_257
+    jmp .Lf3_258
+.Lf3_257:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_259
+.Lf3_258:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf3_259:
+    push %rax
+    cmpl $48, -4(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_261
+    jmp .Lf3_260
+.Lf3_261:
+    cmpl $53, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_260:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 506 9
+    movq $9, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 507 9
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_231:
+    .loc 1 509 5
+    movslq -16(%rbp), %rax
+    subq $88, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf3_262
+    jmp .Lf3_263
+.Lf3_262:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_264
+.Lf3_263:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf3_264:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
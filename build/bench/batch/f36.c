@@ -0,0 +1,135 @@
+int f0() {
+    int v0 = 31;
+    int v1 = 7;
+    int v2 = 76;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[2][3] = (((37 % 8) * (94 ? v1 : 39)) && ((42 < 44) / 5));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a0[4] = (((v3 < a0[6]) && (v0 >= i1)) % 9);
+                    a1[3][8] = (((a1[0][3] ? i1 : 53) + (v1 >= i0)) > ((71 == i1) == (i0 ? i1 : v0)));
+                    v3 = (((45 <= v3) % 9) + ((v1 + v0) - (v2 % 4)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a1[0][0] / 5) + (v0 || v2)) <= ((11 <= v0) && (91 - 49)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v1 = (((a1[1][6] >= v0) + (i2 == v1)) - ((i2 >= v1) ? (15 / 7) : (42 ? v2 : 24)));
+            a1[0][2] = (((95 != i2) || (v1 > a1[0][13])) <= ((a0[11] / 9) == (a0[12] / 8)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((v0 + a1[2][14]) - (v2 - v0)) >= ((i2 != i3) > (66 % 7)));
+                v1 = (((v1 < 82) / 3) <= ((i2 - v0) > (a1[1][2] % 9)));
+                a1[3][11] = (((v0 - 79) == (a1[1][13] ? v2 : 41)) >= ((1 - v0) ? (a0[6] ? i3 : v1) : (35 % 2)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v3 = (((v2 <= i5) * (i4 + a1[1][0])) <= ((91 - 12) ? (v0 >= v2) : (i5 + a1[3][13])));
+                v0 = (((21 != v1) == (24 ? 3 : a1[0][13])) - ((a0[7] < 47) + (i4 || a0[3])));
+                v2 = (((30 % 5) <= (i4 <= v2)) ? ((v2 >= v0) && (86 / 6)) : ((a1[3][5] || v0) || (v0 ? a0[4] : v1)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        a0[9] = (((a1[1][12] ? i4 : 83) > (17 % 8)) % 5);
+        a0[10] = (((a1[3][7] == i4) < (v0 && a1[3][15])) <= ((a0[1] && 1) / 6));
+    }
+    if ((((14 + a1[0][3]) <= (20 == v2)) * ((v0 > a0[7]) * (50 % 5)))) {
+        v0 = (((a1[0][5] * a1[3][10]) > (25 >= v3)) + ((v1 == a0[9]) <= (v3 * v0)));
+        v1 = (((v3 ? 54 : 39) && (a0[11] >= v2)) > ((v0 == 86) && (v0 ? 11 : v2)));
+        v2 = (((12 + v0) > (v2 - a0[6])) <= ((87 > v2) / 6));
+    } else {
+        v2 = (((a0[12] ? a1[3][15] : a1[2][5]) || (98 ? v2 : v0)) > ((v0 % 7) / 8));
+        v0 = (((76 && a1[0][5]) * (72 * 12)) || ((v1 + 59) == (26 <= v2)));
+        v2 = (((v0 <= a0[9]) * (98 < v1)) ? ((v3 ? v1 : v2) % 9) : ((72 + v1) && (a1[3][1] + v1)));
+    }
+    v3 = (((a0[5] >= v3) ? (v3 - v1) : (82 != 74)) || ((v1 ? v3 : v3) == (v3 / 6)));
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                if ((v0 != 9) > 75) break;
+                a1[3][11] = (((i7 - i6) > (i7 / 4)) * ((93 <= v3) * (51 % 6)));
+                v3 = (((a0[12] * v0) == (16 + i7)) * ((32 == v0) <= (v2 <= a1[1][6])));
+                v2 = (((a0[13] % 7) + (35 % 6)) >= ((a1[3][10] && 12) ? (a1[1][2] ? v0 : 64) : (a1[0][6] && v0)));
+            }
+            v2 = (((v2 ? 81 : v2) || (i6 - a1[3][13])) < ((55 < 19) < (v2 * v0)));
+            v3 = (((a1[1][5] < a0[7]) || (a1[0][10] < a0[2])) >= ((43 == v0) == (v1 == v3)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a1[0][12] < a0[8]) != (90 == v3)) || ((a1[1][14] >= v0) < (94 > v3)))) {
+        v1 = (((79 && a0[8]) ? (a1[2][14] == v2) : (a1[1][6] <= v3)) < ((19 % 4) % 8));
+        v1 = (((67 - 24) < (a1[1][10] <= 4)) ? ((a1[3][15] >= v0) - (v1 > v1)) : ((v0 <= 16) == (36 > a1[3][6])));
+        a0[9] = (((v3 ? v1 : v0) <= (v2 / 2)) == ((a0[9] >= v0) + (v3 && v1)));
+    } else {
+        a1[1][10] = (((a1[3][5] % 6) <= (v2 > a1[3][6])) * ((87 < v2) - (v2 / 5)));
+        a1[3][5] = (((68 * a0[0]) != (99 < v0)) - ((v0 && 15) < (v0 - v1)));
+        v0 = (((v1 - v3) + (v3 ? v3 : v3)) * ((a0[11] == a0[6]) != (v0 <= 74)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            if ((a1[3][5] && a1[1][10]) > 56) break;
+            v0 = (((a1[1][2] ? a1[2][7] : 59) * (a1[0][9] - 92)) == ((v1 != 35) != (73 > a1[0][0])));
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    a1[0][11] = (((32 < a0[14]) == (v3 ? v2 : a1[2][7])) != ((v3 || v0) <= (2 ? a0[5] : v2)));
+                    v3 = (((a0[9] - a1[0][8]) - (39 % 8)) || ((a1[1][5] && 1) >= (i8 && 46)));
+                    v0 = (((a0[0] ? v3 : a1[3][3]) / 8) ? ((a1[2][15] * i9) && (99 < v3)) : ((a0[10] ? a1[0][6] : v2) || (i9 < i9)));
+                    i9 = i9 + 1;
+                }
+            }
+            v0 = (((a1[2][2] * a1[0][8]) ? (i8 ? 31 : v2) : (v1 >= 42)) == ((v3 - v1) || (91 ? a0[6] : 19)));
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        {
+            int i11 = 0;
+            while (i11 < 8) {
+                if ((70 < a1[2][14]) > 88) break;
+                a0[3] = (((66 <= 2) != (a1[1][5] * v1)) && ((v1 <= v2) - (v1 || i11)));
+                v2 = (((73 >= 75) != (a0[4] > v0)) + ((a0[15] - a1[1][10]) >= (42 < v3)));
+                v2 = (((a1[0][15] % 6) > (v2 <= 45)) && ((a1[2][0] || a1[2][2]) ? (i10 + a0[4]) : (v0 > a1[0][15])));
+                i11 = i11 + 1;
+            }
+        }
+        a1[0][13] = (((a0[10] || a0[10]) / 3) ? ((a1[0][5] * 78) ? (i10 == v3) : (a1[2][3] / 2)) : ((41 > a0[2]) > (a1[2][13] > a1[2][10])));
+        v3 = (((a1[3][3] - 16) > (v1 - v0)) && ((62 != v1) ? (3 / 6) : (v2 * i10)));
+    }
+    for (int i12 = 0; i12 < 7; i12 = i12 + 1) {
+        a1[3][10] = (((v1 && v2) < (8 / 3)) - ((v0 % 8) * (i12 == a0[1])));
+        v1 = (((i12 >= v0) == (64 != v2)) + ((v1 * a0[12]) + (v3 == a1[0][7])));
+        {
+            int i13 = 0;
+            do {
+                v0 = (((58 ? 98 : 55) > (v0 * v3)) > ((a0[3] ? a1[1][15] : i12) > (i12 * 56)));
+                v3 = (((v2 / 1) || (i12 - a1[3][1])) <= ((v3 >= v2) + (8 == a0[5])));
+                a1[1][11] = (((v1 - 70) * (10 + a1[0][2])) + ((5 / 4) - (a1[3][3] ? v2 : a0[9])));
+                i13 = i13 + 1;
+            } while (i13 < 4);
+        }
+    }
+    return (((v3 == 97) + (v1 % 3)) + ((33 - a1[3][13]) ? (87 < v3) : (v3 % 5)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,214 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 87;
+    int v2 = 77;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[0][7] = (((v1 ? v3 : i0) ? (v3 - a1[3][1]) : (v0 != a0[3])) != ((v0 < 37) > (v2 && v1)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a0[3] != a1[3][12]) < (v3 >= 15)) <= ((v2 > v3) <= (v3 ? a0[5] : v3)));
+                    a0[13] = (((a0[12] <= a1[1][11]) / 1) / 5);
+                    v0 = (((v2 || 91) >= (v1 * a0[13])) ? ((i1 >= a0[0]) + (v3 != a0[0])) : ((15 == v3) != (i1 <= i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v1 = (((40 ? a1[2][5] : v0) || (98 && v3)) * ((v3 <= a0[9]) <= (a1[2][6] != v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v0 = (((a0[12] * a0[10]) + (v0 != a1[0][7])) == ((v1 + a1[3][2]) * (33 ? a0[8] : v1)));
+                    a1[1][4] = (((15 - v3) - (v1 ? i2 : i2)) ? ((v2 == 36) % 9) : ((v0 || 74) < (3 % 2)));
+                    a1[0][14] = (((i2 || 52) / 1) != ((a1[3][6] / 1) <= (51 > 69)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[4] = (((a1[1][14] < 99) > (i2 ? a0[12] : v1)) < ((69 ? a1[3][4] : 28) * (a0[1] < v1)));
+            v2 = (((i2 != v0) && (a1[0][6] - 30)) - ((35 ? a1[2][7] : v1) / 9));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v2 = (((a0[10] / 9) ? (v3 ? 7 : a1[1][1]) : (55 == a0[13])) * ((i4 ? a0[10] : v3) && (a1[0][10] || v2)));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            if ((a1[3][5] < 1) > 83) break;
+            v3 = (((v3 ? 55 : v1) >= (v1 > v2)) == ((18 - v2) % 2));
+            a1[1][12] = (((i5 || a0[11]) / 8) ? ((v3 <= 71) % 1) : ((a1[1][5] >= 30) ? (a1[2][4] != 69) : (v3 < 53)));
+            v1 = (((v0 / 4) ? (i5 > a0[8]) : (i5 || v1)) / 8);
+        }
+        a1[1][4] = (((i4 >= v1) == (v1 > i4)) < ((42 >= v1) != (a1[1][15] < v3)));
+    }
+    a1[0][14] = (((v0 * v2) || (v0 && v3)) ? ((v3 >= a1[3][5]) <= (v3 != v1)) : ((a1[2][2] >= 7) || (v1 - a1[2][14])));
+    v0 = (((a0[7] >= a1[3][13]) * (a0[9] - a0[6])) <= ((a1[2][5] ? v2 : v2) && (39 * v0)));
+    if ((((10 ? v0 : 44) >= (68 == v3)) ? ((26 > a1[1][7]) <= (95 + a1[3][2])) : ((v3 && a0[8]) >= (a1[2][14] + v2)))) {
+        v0 = (((a0[10] < v1) >= (v1 == v2)) + ((v3 || v1) + (v1 && 11)));
+        v0 = (((v3 ? v2 : 30) == (v1 <= a1[2][9])) == ((77 < v3) ? (a0[5] % 3) : (v0 || a0[2])));
+        v0 = (((81 / 4) / 3) > ((45 >= 57) > (v2 == v3)));
+    } else {
+        a1[3][6] = (((65 || v0) && (v3 < a0[10])) > ((v3 * 43) || (v1 && 97)));
+        v1 = (((v1 * v2) || (v0 != 96)) - ((v3 > 67) * (78 + a0[15])));
+        v0 = (((v0 != v1) == (17 ? a0[1] : v3)) <= ((v3 + a1[1][14]) != (v3 ? v2 : 22)));
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        if ((v1 >= a0[14]) > 76) break;
+        a0[5] = (((a1[2][8] == v3) || (79 % 9)) != ((v1 >= v1) / 5));
+        v3 = (((9 && 39) / 6) + ((i6 != v3) == (i6 % 5)));
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            v0 = (((a0[15] < i6) * (i7 >= 68)) <= ((i6 || a0[12]) ? (i7 < a0[7]) : (i6 < i6)));
+            v3 = (((a1[1][6] != i7) && (v3 % 8)) >= ((97 * v1) ? (v2 < i7) : (i6 % 5)));
+            a1[0][3] = (((v3 != a0[4]) == (v2 < 69)) ? ((2 ? a0[7] : 8) - (31 < 9)) : ((v2 && v0) != (a0[5] && v1)));
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v2 = (((86 + v1) / 4) || ((i8 == v2) + (v0 / 9)));
+            v3 = (((v1 < i8) == (a0[6] <= a1[0][0])) && ((83 >= a0[6]) && (a0[10] < 70)));
+            {
+                int i9 = 0;
+                do {
+                    if ((v1 <= 41) > 65) break;
+                    v3 = (((v1 ? v3 : a0[1]) ? (v0 >= i9) : (v1 != v3)) ? ((a0[1] + 74) ? (27 ? 91 : 81) : (i8 ? 7 : v1)) : ((a1[3][3] + i8) < (18 * v0)));
+                    v1 = (((a1[2][6] - v3) > (i8 || a0[6])) + ((a0[13] + 15) > (a0[0] && v2)));
+                    v2 = (((v3 - v2) >= (v3 + v3)) ? ((a1[2][8] == a1[1][4]) < (a1[0][1] ? v1 : v3)) : ((a1[1][1] >= i9) || (a1[2][0] > 0)));
+                    i9 = i9 + 1;
+                } while (i9 < 2);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    if ((((v0 || a1[2][5]) % 7) + ((v0 ? a1[2][12] : 95) == (v2 && v2)))) {
+        v1 = (((v0 < a1[0][12]) == (v3 ? v0 : a0[12])) != ((v0 <= v0) && (v1 != 67)));
+        v0 = (((v2 + v2) <= (v1 < 50)) != ((v3 * 69) >= (a0[10] / 5)));
+        a0[10] = (((93 == a0[15]) == (v3 % 2)) >= ((a1[1][2] < 9) + (2 != 40)));
+    } else {
+        v1 = (((v1 != v3) % 5) ? ((4 >= 28) == (41 && v1)) : ((a1[2][13] && v1) == (a1[0][11] ? 3 : v2)));
+        a1[3][5] = (((13 ? 61 : v2) == (v0 >= 95)) % 8);
+        v1 = (((v3 ? v3 : v0) + (v3 - a1[3][6])) == ((35 == v2) ? (18 ? 79 : a1[2][6]) : (21 != v3)));
+    }
+    if ((((v2 < v3) && (1 * 10)) % 7)) {
+        a1[2][10] = (((v1 ? a1[2][4] : 91) >= (v0 * v1)) >= ((a0[0] < 70) + (v1 >= a0[12])));
+        v1 = (((65 != v1) || (v2 * 40)) - ((v0 > v0) - (v3 * a0[14])));
+        a0[8] = (((v3 * v0) != (v2 == v2)) && ((a0[13] ? v1 : v1) < (v2 <= 24)));
+    } else {
+        v0 = (((a0[10] > a1[1][12]) + (v2 ? v0 : a1[0][5])) ? ((a1[3][14] < v3) || (21 || 67)) : ((v2 % 8) >= (v0 >= v2)));
+        a1[1][3] = (((v2 + v0) * (v2 || v1)) && ((v1 - a1[0][2]) > (67 == v3)));
+        v0 = (((29 * a0[4]) || (v3 == v1)) != ((a0[12] <= a0[15]) * (a0[11] + v1)));
+    }
+    return (((v1 != 35) != (v1 ? v3 : 93)) > ((v1 * v1) % 8));
+}
+int f1() {
+    int v0 = 39;
+    int v1 = 30;
+    int v2 = 18;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[0] >= 55) * (53 && v1)) && ((45 != v3) <= (v2 > 56)));
+    if ((((a1[2][7] > 71) * (a1[3][0] && 25)) ? ((41 > v0) / 9) : ((v3 - v1) ? (v2 && v2) : (a0[8] >= v2)))) {
+        a1[0][6] = (((v1 < 82) / 7) ? ((v2 && 19) < (32 <= v3)) : ((v2 - a1[2][9]) <= (v0 ? a0[8] : v1)));
+        a0[0] = (((v3 || 88) || (a1[1][14] || 66)) % 5);
+        v1 = (((a1[1][5] > v1) / 5) ? ((92 >= 83) ? (v0 && 64) : (a1[1][7] ? v2 : 78)) : ((27 == 95) || (v3 || a1[0][9])));
+    } else {
+        a1[2][2] = (((24 % 6) + (v1 ? a1[2][6] : v0)) && ((28 / 1) == (91 < a1[0][15])));
+        v0 = (((a1[0][10] ? v1 : 80) || (v0 <= v3)) || ((v2 / 8) * (91 && v1)));
+        a0[15] = (((52 != a0[9]) ? (88 % 3) : (a1[2][9] > a0[3])) > ((20 || v0) >= (v2 < a0[11])));
+    }
+    v0 = (((v0 > 59) % 2) - ((a1[0][5] - v0) >= (v2 % 4)));
+    {
+        int i0 = 0;
+        do {
+            v2 = (((a0[9] >= i0) * (a0[3] && v1)) || ((i0 % 7) + (v1 >= v3)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((v1 <= v3) > 58) break;
+                v2 = (((a0[15] - a0[1]) + (18 > a0[0])) || ((v2 == i0) ? (i1 ? 70 : a0[11]) : (a0[0] % 6)));
+                v1 = (((i0 <= a1[0][15]) && (61 < a0[5])) % 7);
+                v0 = (((v3 != i0) - (3 ? v3 : i0)) - ((i0 < 68) / 5));
+            }
+            v0 = (((v2 ? 48 : a0[0]) / 2) * ((v0 == 76) || (21 ? v1 : v0)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((36 - a0[2]) > 81) break;
+        v0 = (((a1[1][6] < a1[2][6]) % 3) * ((v1 % 3) <= (v3 || 54)));
+        v0 = (((v2 || 48) ? (a1[3][4] < 28) : (a1[1][1] - v3)) % 3);
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v2 = (((v3 == a1[0][5]) ? (v3 == i3) : (a0[12] * 56)) ? ((i3 ? a0[3] : 88) % 8) : ((v3 && v0) / 1));
+                v2 = (((a0[5] % 2) <= (i2 >= i2)) && ((i2 ? a1[1][15] : v3) < (v1 / 7)));
+                v0 = (((v2 <= v2) - (59 < v1)) && ((v1 >= 26) && (v3 >= v3)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((v0 % 7) >= (i4 || a0[14])) || ((v0 - a1[0][5]) != (i4 == a0[10])));
+        a1[1][6] = (((v3 >= 30) != (i4 > v2)) && ((i4 * a1[1][3]) < (v2 < v2)));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            if ((98 == a0[2]) > 59) break;
+            v3 = (((38 ? v1 : i4) ? (v3 / 7) : (v1 == i4)) / 8);
+            v3 = (((30 ? v2 : v2) * (36 % 5)) == ((a0[13] % 2) <= (a1[0][5] * v0)));
+            v2 = (((61 >= a1[3][14]) != (v1 < 3)) ? ((v3 - 53) * (a0[9] >= 64)) : ((a0[2] - 95) - (i5 <= 72)));
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((i6 == a1[1][2]) || (v0 ? v2 : a0[14])) * ((v2 - v2) <= (76 ? v3 : a0[5])));
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                v1 = (((v1 <= 72) - (v0 % 2)) ? ((v3 ? v3 : a0[2]) || (v0 ? i7 : a0[14])) : ((a1[1][1] >= a0[15]) - (i6 && v2)));
+                a1[3][12] = (((55 ? 59 : v3) < (93 > 26)) == ((v0 ? 94 : i7) <= (a1[1][2] % 4)));
+                a0[12] = (((v1 >= 85) || (48 <= a1[3][1])) > ((a1[0][11] < a1[0][13]) || (a1[2][2] ? a0[8] : 49)));
+            }
+            a0[9] = (((v1 - a1[0][1]) <= (92 <= a1[1][12])) ? ((a0[6] / 4) % 2) : ((v2 / 1) <= (v3 < 6)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[3][13] = (((a0[1] ? v1 : a1[2][5]) > (i8 != v1)) / 4);
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((98 + a0[7]) <= (i9 >= v3)) - ((v3 && 45) > (a1[2][12] % 8)));
+                    v3 = (((a1[3][4] > i8) > (a0[7] > v3)) || ((i9 ? a0[13] : v2) ? (v1 >= i9) : (i9 - v2)));
+                    a0[14] = (((v0 && a1[3][10]) != (15 && a0[15])) == ((a1[2][11] < a1[2][7]) || (95 == v0)));
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            v1 = (((v2 != a1[1][6]) >= (i8 + v2)) > ((a1[3][7] && 79) || (v3 ? 34 : v1)));
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    a1[3][3] = (((v1 != v3) && (a1[2][15] ? v3 : v0)) != ((50 ? v0 : v2) - (99 + v1)));
+    if ((((v3 - v1) - (v0 || a0[6])) ? ((v1 > v2) >= (v3 > v3)) : ((24 % 9) * (77 < v3)))) {
+        v2 = (((v3 <= 36) ? (a0[3] ? a1[0][10] : 67) : (a1[0][12] % 7)) ? ((v3 == v2) ? (v3 / 8) : (64 && a1[0][7])) : ((51 == 21) / 3));
+        v2 = (((v1 >= 91) - (a1[2][13] >= v2)) || ((v3 ? v1 : a1[3][0]) / 9));
+        a1[0][8] = (((75 < 2) / 2) + ((v2 || 99) != (20 * v0)));
+    } else {
+        v3 = (((v1 * 94) + (v2 <= v2)) + ((v1 >= a0[12]) >= (v2 > 11)));
+        a1[1][13] = (((v1 == v0) / 6) - ((61 >= v2) < (a0[1] && a1[0][6])));
+        v2 = (((v1 >= 25) ? (v1 >= v3) : (v2 != 86)) < ((v2 || a1[3][8]) <= (v1 > 52)));
+    }
+    return (((v2 != 44) && (22 - 57)) % 8);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,5187 @@
+    .file 1 "build/bench/batch/f37.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 209 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 210 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 211 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 212 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 213 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $37, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $87, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $77, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $99, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    jmp .Lf0_4
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_9
+.Lf0_8:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -340(%rbp), %rax
+.Lf0_10:
+    cmpq $0, %rax
+    jne .Lf0_5
+    jmp .Lf0_6
+.Lf0_5:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_7
+.Lf0_6:
+    movslq -4(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    push %rax
+    cmpl $37, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_11
+.Lf0_12:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_11:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 13 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 14 17
+    .p2align 4,,10
+.Lf0_15:
+    .loc 1 15 21
+    movslq -68(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $15, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_16
+    jmp .Lf0_17
+.Lf0_16:
+    movslq -60(%rbp), %rax
+    jmp .Lf0_18
+.Lf0_17:
+    movslq -16(%rbp), %rax
+.Lf0_18:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 16 21
+    movq $5, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -28(%rbp)
+    .loc 1 17 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_23
+    jmp .Lf0_22
+.Lf0_23:
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_22:
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_19
+    jmp .Lf0_20
+.Lf0_19:
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_21
+.Lf0_20:
+    movq $15, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_21:
+    movl %eax, -4(%rbp)
+    .loc 1 18 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_14:
+    .loc 1 19 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_15
+.Lf0_13:
+    addq $0, %rsp
+    .loc 1 21 13
+    movslq -16(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $40, %rax
+    cmpq $0, %rax
+    jne .Lf0_24
+    jmp .Lf0_25
+.Lf0_24:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf0_26
+.Lf0_25:
+    movslq -4(%rbp), %rax
+.Lf0_26:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_28
+    jmp .Lf0_27
+.Lf0_28:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_30
+    jmp .Lf0_29
+.Lf0_30:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_29:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_27:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 22 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+.Lf0_4:
+    .loc 1 10 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 26 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 27 9
+    .p2align 4,,10
+.Lf0_33:
+    .loc 1 29 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 30 17
+    jmp .Lf0_37
+    .p2align 4,,10
+.Lf0_36:
+    .loc 1 31 21
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $33, %rax
+    cmpq $0, %rax
+    jne .Lf0_38
+    jmp .Lf0_39
+.Lf0_38:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -8(%rbp), %rax
+.Lf0_40:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 32 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_44
+    jmp .Lf0_45
+.Lf0_44:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_46
+.Lf0_45:
+    movslq -340(%rbp), %rax
+.Lf0_46:
+    push %rax
+    movq $15, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_42
+.Lf0_41:
+    movq $9, %rax
+    push %rax
+    cmpl $36, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_43
+.Lf0_42:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_48
+    jmp .Lf0_47
+.Lf0_48:
+    movq $74, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_47:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_43:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 33 21
+    movq $1, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_50
+    jmp .Lf0_49
+.Lf0_50:
+    movq $52, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_49:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $51, %rax
+    cmpq $69, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 34 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_35:
+.Lf0_37:
+    .loc 1 30 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_36
+.Lf0_34:
+    addq $0, %rsp
+    .loc 1 37 13
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_51
+    jmp .Lf0_52
+.Lf0_51:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_53
+.Lf0_52:
+    movslq -8(%rbp), %rax
+.Lf0_53:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $69, %rax
+    cmpq $0, %rax
+    jne .Lf0_54
+    jmp .Lf0_55
+.Lf0_54:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf0_56
+.Lf0_55:
+    movq $28, %rax
+.Lf0_56:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -64(%rbp)
+    .loc 1 38 13
+    movq $9, %rax
+    push %rax
+    movq $35, %rax
+    cmpq $0, %rax
+    jne .Lf0_57
+    jmp .Lf0_58
+.Lf0_57:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf0_59
+.Lf0_58:
+    movslq -8(%rbp), %rax
+.Lf0_59:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_60
+.Lf0_61:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    subq $30, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_60:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 39 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_32:
+    .loc 1 40 18
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_33
+.Lf0_31:
+    addq $8, %rsp
+    .loc 1 42 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_67
+    .p2align 4,,10
+.Lf0_66:
+    .loc 1 43 9
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_68
+    jmp .Lf0_69
+.Lf0_68:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_70
+.Lf0_69:
+    movslq -16(%rbp), %rax
+.Lf0_70:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_72
+    jmp .Lf0_71
+.Lf0_72:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_74
+    jmp .Lf0_73
+.Lf0_74:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_73:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_71:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_76
+.Lf0_75:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_79
+.Lf0_78:
+    movq $7, %rax
+    jmp .Lf0_80
+.Lf0_79:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf0_80:
+    jmp .Lf0_77
+.Lf0_76:
+    movq $55, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_77:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 44 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_86
+    .p2align 4,,10
+.Lf0_85:
+    .loc 1 45 13
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $83, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_87
+    jmp .Lf0_83
+.Lf0_87:
+    .loc 1 46 13
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_88
+    jmp .Lf0_89
+.Lf0_88:
+    movq $55, %rax
+    jmp .Lf0_90
+.Lf0_89:
+    movslq -8(%rbp), %rax
+.Lf0_90:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $18, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 47 13
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_95
+    jmp .Lf0_94
+.Lf0_95:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_94:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_91
+    jmp .Lf0_92
+.Lf0_91:
+    movq $1, %rax
+    push %rax
+    cmpl $71, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_93
+.Lf0_92:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $30, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_96
+    jmp .Lf0_97
+.Lf0_96:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $69, %rax
+    movq $0, %rax
+    setne %al
+    jmp .Lf0_98
+.Lf0_97:
+    cmpl $53, -16(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf0_98:
+.Lf0_93:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 48 13
+    movq $8, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_99
+    jmp .Lf0_100
+.Lf0_99:
+    movslq -344(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_101
+.Lf0_100:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_103
+    jmp .Lf0_102
+.Lf0_103:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_102:
+.Lf0_101:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_84:
+    .loc 1 44 34
+    incl -344(%rbp)
+.Lf0_86:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_85
+.Lf0_83:
+    addq $0, %rsp
+    .loc 1 50 9
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $42, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_65:
+    .loc 1 42 30
+    incl -340(%rbp)
+.Lf0_67:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_66
+.Lf0_64:
+    addq $8, %rsp
+    .loc 1 52 5
+    movslq -4(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_108
+    jmp .Lf0_107
+.Lf0_108:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_110
+    jmp .Lf0_109
+.Lf0_110:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_109:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_107:
+    cmpq $0, %rax
+    jne .Lf0_104
+    jmp .Lf0_105
+.Lf0_104:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_106
+.Lf0_105:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $7, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_112
+    jmp .Lf0_111
+.Lf0_112:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_111:
+.Lf0_106:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 53 5
+    movslq -44(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_113
+    jmp .Lf0_114
+.Lf0_113:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_115
+.Lf0_114:
+    movslq -12(%rbp), %rax
+.Lf0_115:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    movq $39, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 54 5
+    movq $10, %rax
+    cmpq $0, %rax
+    jne .Lf0_122
+    jmp .Lf0_123
+.Lf0_122:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_124
+.Lf0_123:
+    movq $44, %rax
+.Lf0_124:
+    push %rax
+    movq $68, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_120
+.Lf0_119:
+    movq $26, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    addq $95, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_121
+.Lf0_120:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_125
+.Lf0_126:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_125:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_121:
+    cmpq $0, %rax
+    je .Lf0_127
+    .loc 1 55 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_131
+    jmp .Lf0_130
+.Lf0_131:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_130:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 56 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_132
+    jmp .Lf0_133
+.Lf0_132:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_134
+.Lf0_133:
+    movq $30, %rax
+.Lf0_134:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $77, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_135
+    jmp .Lf0_136
+.Lf0_135:
+    movq $3, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_139
+    jmp .Lf0_138
+.Lf0_139:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_138:
+.Lf0_137:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 57 9
+    movq $3, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpq $57, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_118
+.Lf0_127:
+    .loc 1 59 9
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_141
+    jmp .Lf0_140
+.Lf0_141:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_140:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_143
+    jmp .Lf0_142
+.Lf0_143:
+    movslq -16(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_142:
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $43, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_145
+    jmp .Lf0_144
+.Lf0_145:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_147
+    jmp .Lf0_146
+.Lf0_147:
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_146:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_144:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 60 9
+    movq $78, %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $67, -16(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_149
+    jmp .Lf0_148
+.Lf0_149:
+    cmpl $96, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_148:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 61 9
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_152
+.Lf0_151:
+    movslq -16(%rbp), %rax
+.Lf0_152:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_153
+    jmp .Lf0_154
+.Lf0_153:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_155
+.Lf0_154:
+    movq $22, %rax
+.Lf0_155:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_118:
+    .loc 1 63 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_161
+    .p2align 4,,10
+.Lf0_160:
+    .loc 1 64 9
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $76, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_162
+    jmp .Lf0_158
+.Lf0_162:
+    .loc 1 65 9
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_164
+    jmp .Lf0_163
+.Lf0_164:
+    movq $9, %rax
+    push %rax
+    movq $79, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_163:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -60(%rbp)
+    .loc 1 66 9
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_166
+    jmp .Lf0_165
+.Lf0_166:
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_165:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 67 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_172
+    .p2align 4,,10
+.Lf0_171:
+    .loc 1 68 13
+    cmpl $68, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_177
+    jmp .Lf0_176
+.Lf0_177:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_176:
+    cmpq $0, %rax
+    jne .Lf0_173
+    jmp .Lf0_174
+.Lf0_173:
+    movslq -344(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_175
+.Lf0_174:
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf0_175:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 69 13
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_179
+    jmp .Lf0_178
+.Lf0_179:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_178:
+    push %rax
+    movq $97, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_180
+    jmp .Lf0_181
+.Lf0_180:
+    movslq -12(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_182
+.Lf0_181:
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_182:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 70 13
+    movslq -16(%rbp), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $69, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_183
+    jmp .Lf0_184
+.Lf0_183:
+    movq $31, %rax
+    cmpq $9, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf0_186
+    jmp .Lf0_187
+.Lf0_186:
+    movslq -52(%rbp), %rax
+    jmp .Lf0_188
+.Lf0_187:
+    movq $8, %rax
+.Lf0_188:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_185
+.Lf0_184:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_190
+    jmp .Lf0_189
+.Lf0_190:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_189:
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_192
+    jmp .Lf0_191
+.Lf0_192:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_191:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_185:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_170:
+    .loc 1 67 34
+    incl -344(%rbp)
+.Lf0_172:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_171
+.Lf0_169:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf0_159:
+    .loc 1 63 30
+    incl -340(%rbp)
+.Lf0_161:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_160
+.Lf0_158:
+    addq $8, %rsp
+    .loc 1 74 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 75 9
+    .p2align 4,,10
+.Lf0_195:
+    .loc 1 76 13
+    movq $4, %rax
+    push %rax
+    movq $86, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_197
+    jmp .Lf0_196
+.Lf0_197:
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_196:
+    movl %eax, -12(%rbp)
+    .loc 1 77 13
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -56(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_198
+.Lf0_199:
+    movq $83, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_201
+    jmp .Lf0_200
+.Lf0_201:
+    cmpl $70, -40(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_200:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_198:
+    movl %eax, -16(%rbp)
+    .loc 1 79 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 80 17
+    .p2align 4,,10
+.Lf0_204:
+    .loc 1 81 21
+    cmpl $41, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_205
+    jmp .Lf0_202
+.Lf0_205:
+    .loc 1 82 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_213
+.Lf0_212:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_214
+.Lf0_213:
+    movslq -76(%rbp), %rax
+.Lf0_214:
+    cmpq $0, %rax
+    jne .Lf0_209
+    jmp .Lf0_210
+.Lf0_209:
+    movslq -4(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_211
+.Lf0_210:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_211:
+    cmpq $0, %rax
+    jne .Lf0_206
+    jmp .Lf0_207
+.Lf0_206:
+    movslq -76(%rbp), %rax
+    addq $74, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_215
+    jmp .Lf0_216
+.Lf0_215:
+    movq $27, %rax
+    cmpq $0, %rax
+    jne .Lf0_218
+    jmp .Lf0_219
+.Lf0_218:
+    movq $91, %rax
+    jmp .Lf0_220
+.Lf0_219:
+    movq $81, %rax
+.Lf0_220:
+    jmp .Lf0_217
+.Lf0_216:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_221
+    jmp .Lf0_222
+.Lf0_221:
+    movq $7, %rax
+    jmp .Lf0_223
+.Lf0_222:
+    movslq -8(%rbp), %rax
+.Lf0_223:
+.Lf0_217:
+    jmp .Lf0_208
+.Lf0_207:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $18, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf0_208:
+    movl %eax, -16(%rbp)
+    .loc 1 83 21
+    movslq -28(%rbp), %rax
+    addq $15, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_225
+    jmp .Lf0_224
+.Lf0_225:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_224:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_227
+    jmp .Lf0_226
+.Lf0_227:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_226:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 84 21
+    movslq -16(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_228
+    jmp .Lf0_229
+.Lf0_228:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_231
+    jmp .Lf0_232
+.Lf0_231:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_233
+.Lf0_232:
+    movslq -16(%rbp), %rax
+.Lf0_233:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_230
+.Lf0_229:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_235
+    jmp .Lf0_234
+.Lf0_235:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_234:
+.Lf0_230:
+    movl %eax, -12(%rbp)
+    .loc 1 85 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_203:
+    .loc 1 86 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_204
+.Lf0_202:
+    addq $0, %rsp
+    .loc 1 88 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_194:
+    .loc 1 89 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_195
+.Lf0_193:
+    addq $8, %rsp
+    .loc 1 91 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_237
+    jmp .Lf0_238
+.Lf0_237:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf0_239
+.Lf0_238:
+    movq $95, %rax
+.Lf0_239:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_241
+    jmp .Lf0_240
+.Lf0_241:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_240:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_243
+    jmp .Lf0_242
+.Lf0_243:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_242:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_244
+    .loc 1 92 9
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_245
+    jmp .Lf0_246
+.Lf0_245:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_247
+.Lf0_246:
+    movslq -32(%rbp), %rax
+.Lf0_247:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_249
+    jmp .Lf0_248
+.Lf0_249:
+    cmpl $67, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_248:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 93 9
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $50, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $69, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 94 9
+    movq $93, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $2, %rax
+    cmpq $40, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $9, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_236
+.Lf0_244:
+    .loc 1 96 9
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_250
+    jmp .Lf0_251
+.Lf0_250:
+    movq $4, %rax
+    cmpq $28, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $41, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_254
+    jmp .Lf0_253
+.Lf0_254:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_253:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_252
+.Lf0_251:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_256
+    jmp .Lf0_255
+.Lf0_256:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_255:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_257
+    jmp .Lf0_258
+.Lf0_257:
+    movq $3, %rax
+    jmp .Lf0_259
+.Lf0_258:
+    movslq -12(%rbp), %rax
+.Lf0_259:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_252:
+    movl %eax, -8(%rbp)
+    .loc 1 97 9
+    movq $8, %rax
+    push %rax
+    movq $13, %rax
+    cmpq $0, %rax
+    jne .Lf0_260
+    jmp .Lf0_261
+.Lf0_260:
+    movq $61, %rax
+    jmp .Lf0_262
+.Lf0_261:
+    movslq -12(%rbp), %rax
+.Lf0_262:
+    push %rax
+    cmpl $95, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 98 9
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_263
+    jmp .Lf0_264
+.Lf0_263:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_265
+.Lf0_264:
+    movslq -4(%rbp), %rax
+.Lf0_265:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $35, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_266
+    jmp .Lf0_267
+.Lf0_266:
+    movq $18, %rax
+    cmpq $0, %rax
+    jne .Lf0_269
+    jmp .Lf0_270
+.Lf0_269:
+    movq $79, %rax
+    jmp .Lf0_271
+.Lf0_270:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_271:
+    jmp .Lf0_268
+.Lf0_267:
+    movq $21, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_268:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_236:
+    .loc 1 100 5
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_274
+    jmp .Lf0_273
+.Lf0_274:
+    movq $1, %rax
+    imulq $10, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_273:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_275
+    .loc 1 101 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_276
+    jmp .Lf0_277
+.Lf0_276:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    jmp .Lf0_278
+.Lf0_277:
+    movq $91, %rax
+.Lf0_278:
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $70, -80(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 102 9
+    movslq -16(%rbp), %rax
+    imull -24(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $65, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_280
+    jmp .Lf0_279
+.Lf0_280:
+    movslq -12(%rbp), %rax
+    imulq $40, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_279:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 103 9
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_282
+    jmp .Lf0_281
+.Lf0_282:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_283
+    jmp .Lf0_284
+.Lf0_283:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_285
+.Lf0_284:
+    movslq -8(%rbp), %rax
+.Lf0_285:
+    push %rax
+    cmpl $24, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_281:
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_272
+.Lf0_275:
+    .loc 1 105 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_289
+    jmp .Lf0_290
+.Lf0_289:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_291
+.Lf0_290:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf0_291:
+    push %rax
+    movslq -40(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_286
+    jmp .Lf0_287
+.Lf0_286:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_293
+    jmp .Lf0_292
+.Lf0_293:
+    movq $21, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_295
+    jmp .Lf0_294
+.Lf0_295:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_294:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_292:
+    jmp .Lf0_288
+.Lf0_287:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf0_288:
+    movl %eax, -4(%rbp)
+    .loc 1 106 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_297
+    jmp .Lf0_296
+.Lf0_297:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_296:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_299
+    jmp .Lf0_298
+.Lf0_299:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $67, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_298:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 107 9
+    movq $29, %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_301
+    jmp .Lf0_300
+.Lf0_301:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_300:
+    push %rax
+    movslq -36(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_272:
+    .loc 1 109 5
+    cmpl $35, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_302
+    jmp .Lf0_303
+.Lf0_302:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_304
+.Lf0_303:
+    movq $93, %rax
+.Lf0_304:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 111 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 112 5
+    subq $8, %rsp
+    movq $39, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 113 5
+    movq $30, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 114 5
+    subq $8, %rsp
+    movq $18, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 115 5
+    movq $51, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 116 5
+    subq $64, %rsp
+    .loc 1 117 5
+    subq $256, %rsp
+    .loc 1 118 5
+    movq $53, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_2
+    jmp .Lf1_1
+.Lf1_2:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_1:
+    push %rax
+    cmpl $55, -80(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_4
+    jmp .Lf1_3
+.Lf1_4:
+    movq $45, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $56, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_3:
+    movl %eax, -4(%rbp)
+    .loc 1 119 5
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_10
+    jmp .Lf1_9
+.Lf1_10:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_9:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_6
+    jmp .Lf1_7
+.Lf1_6:
+    movq $9, %rax
+    push %rax
+    movq $41, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_11
+    jmp .Lf1_12
+.Lf1_11:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_15
+    jmp .Lf1_14
+.Lf1_15:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_14:
+    jmp .Lf1_13
+.Lf1_12:
+    movslq -48(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_13:
+.Lf1_8:
+    cmpq $0, %rax
+    je .Lf1_16
+    .loc 1 120 9
+    movq $7, %rax
+    push %rax
+    cmpl $82, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_17
+    jmp .Lf1_18
+.Lf1_17:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_21
+    jmp .Lf1_20
+.Lf1_21:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_20:
+    push %rax
+    movq $32, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_19
+.Lf1_18:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_23
+.Lf1_22:
+    movslq -48(%rbp), %rax
+    jmp .Lf1_24
+.Lf1_23:
+    movslq -8(%rbp), %rax
+.Lf1_24:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_19:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 121 9
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_26
+    jmp .Lf1_25
+.Lf1_26:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_25:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_28
+    jmp .Lf1_27
+.Lf1_28:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_30
+    jmp .Lf1_29
+.Lf1_30:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_29:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_27:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 122 9
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_31
+    jmp .Lf1_32
+.Lf1_31:
+    movq $92, %rax
+    cmpq $83, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_34
+    jmp .Lf1_35
+.Lf1_34:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_38
+    jmp .Lf1_37
+.Lf1_38:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_37:
+    jmp .Lf1_36
+.Lf1_35:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_39
+    jmp .Lf1_40
+.Lf1_39:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_41
+.Lf1_40:
+    movq $78, %rax
+.Lf1_41:
+.Lf1_36:
+    jmp .Lf1_33
+.Lf1_32:
+    movq $27, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_43
+    jmp .Lf1_42
+.Lf1_43:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_45
+    jmp .Lf1_44
+.Lf1_45:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_44:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_42:
+.Lf1_33:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_5
+.Lf1_16:
+    .loc 1 124 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_46
+    jmp .Lf1_47
+.Lf1_46:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_48
+.Lf1_47:
+    movslq -4(%rbp), %rax
+.Lf1_48:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_50
+    jmp .Lf1_49
+.Lf1_50:
+    movq $1, %rax
+    push %rax
+    movq $28, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_49:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 125 9
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_51
+    jmp .Lf1_52
+.Lf1_51:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_53
+.Lf1_52:
+    movq $80, %rax
+.Lf1_53:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_55
+    jmp .Lf1_54
+.Lf1_55:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_54:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_57
+    jmp .Lf1_56
+.Lf1_57:
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_59
+    jmp .Lf1_58
+.Lf1_59:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_58:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_56:
+    movl %eax, -4(%rbp)
+    .loc 1 126 9
+    movq $52, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_60
+    jmp .Lf1_61
+.Lf1_60:
+    movq $3, %rax
+    push %rax
+    movq $88, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_62
+.Lf1_61:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_62:
+    push %rax
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_64
+    jmp .Lf1_63
+.Lf1_64:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+.Lf1_5:
+    .loc 1 128 5
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    cmpl $59, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 130 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 131 9
+    .p2align 4,,10
+.Lf1_67:
+    .loc 1 132 13
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_69
+    jmp .Lf1_68
+.Lf1_69:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_68:
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_71
+    jmp .Lf1_70
+.Lf1_71:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_70:
+    movl %eax, -12(%rbp)
+    .loc 1 133 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_77
+    .p2align 4,,10
+.Lf1_76:
+    .loc 1 134 17
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $58, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_78
+    jmp .Lf1_74
+.Lf1_78:
+    .loc 1 135 17
+    movq $18, %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -20(%rbp), %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_80
+    jmp .Lf1_79
+.Lf1_80:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_81
+    jmp .Lf1_82
+.Lf1_81:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_85
+.Lf1_84:
+    movq $70, %rax
+    jmp .Lf1_86
+.Lf1_85:
+    movslq -36(%rbp), %rax
+.Lf1_86:
+    jmp .Lf1_83
+.Lf1_82:
+    movq $6, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_83:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_79:
+    movl %eax, -12(%rbp)
+    .loc 1 136 17
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_88
+    jmp .Lf1_87
+.Lf1_88:
+    movq $61, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_87:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 137 17
+    movq $5, %rax
+    push %rax
+    cmpl $68, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    jne .Lf1_89
+    jmp .Lf1_90
+.Lf1_89:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_91
+.Lf1_90:
+    movslq -340(%rbp), %rax
+.Lf1_91:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_75:
+    .loc 1 133 38
+    incl -344(%rbp)
+.Lf1_77:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_76
+.Lf1_74:
+    addq $0, %rsp
+    .loc 1 139 13
+    cmpl $76, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_93
+    jmp .Lf1_92
+.Lf1_93:
+    movq $21, %rax
+    cmpq $0, %rax
+    jne .Lf1_94
+    jmp .Lf1_95
+.Lf1_94:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_96
+.Lf1_95:
+    movslq -4(%rbp), %rax
+.Lf1_96:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_92:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_97
+    jmp .Lf1_98
+.Lf1_97:
+    movq $48, %rax
+    jmp .Lf1_99
+.Lf1_98:
+    movslq -80(%rbp), %rax
+.Lf1_99:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 140 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_66:
+    .loc 1 141 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_67
+.Lf1_65:
+    addq $8, %rsp
+    .loc 1 143 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_105
+    .p2align 4,,10
+.Lf1_104:
+    .loc 1 144 9
+    movq $36, %rax
+    subl -72(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_106
+    jmp .Lf1_102
+.Lf1_106:
+    .loc 1 145 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_108
+    jmp .Lf1_107
+.Lf1_108:
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_107:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 146 9
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_113
+    jmp .Lf1_112
+.Lf1_113:
+    movq $48, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_112:
+    cmpq $0, %rax
+    jne .Lf1_109
+    jmp .Lf1_110
+.Lf1_109:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $28, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_111
+.Lf1_110:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_111:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 148 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 149 13
+    jmp .Lf1_117
+    .p2align 4,,10
+.Lf1_116:
+    .loc 1 150 17
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_121
+    jmp .Lf1_122
+.Lf1_121:
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_123
+.Lf1_122:
+    movslq -32(%rbp), %rax
+    imulq $56, %rax
+    movslq %eax, %rax
+.Lf1_123:
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_119
+.Lf1_118:
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_124
+    jmp .Lf1_125
+.Lf1_124:
+    movslq -68(%rbp), %rax
+    jmp .Lf1_126
+.Lf1_125:
+    movq $88, %rax
+.Lf1_126:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_120
+.Lf1_119:
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_128
+    jmp .Lf1_127
+.Lf1_128:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_127:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_120:
+    movl %eax, -12(%rbp)
+    .loc 1 151 17
+    movq $2, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_130
+    jmp .Lf1_129
+.Lf1_130:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_131
+    jmp .Lf1_132
+.Lf1_131:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf1_133
+.Lf1_132:
+    movslq -16(%rbp), %rax
+.Lf1_133:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_129:
+    movl %eax, -12(%rbp)
+    .loc 1 152 17
+    movq $59, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_134
+.Lf1_135:
+    cmpl $26, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_137
+    jmp .Lf1_136
+.Lf1_137:
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_136:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_134:
+    movl %eax, -4(%rbp)
+    .loc 1 153 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_115:
+.Lf1_117:
+    .loc 1 149 20
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_116
+.Lf1_114:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_103:
+    .loc 1 143 30
+    incl -340(%rbp)
+.Lf1_105:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_104
+.Lf1_102:
+    addq $8, %rsp
+    .loc 1 157 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_143
+    .p2align 4,,10
+.Lf1_142:
+    .loc 1 158 9
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_145
+    jmp .Lf1_144
+.Lf1_145:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_144:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_147
+    jmp .Lf1_146
+.Lf1_147:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_146:
+    movl %eax, -8(%rbp)
+    .loc 1 159 9
+    cmpl $30, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_149
+    jmp .Lf1_148
+.Lf1_149:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_148:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 160 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_155
+    .p2align 4,,10
+.Lf1_154:
+    .loc 1 161 13
+    movq $98, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_156
+    jmp .Lf1_152
+.Lf1_156:
+    .loc 1 162 13
+    movq $8, %rax
+    push %rax
+    movq $38, %rax
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_161
+.Lf1_160:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_162
+.Lf1_161:
+    movslq -340(%rbp), %rax
+.Lf1_162:
+    cmpq $0, %rax
+    jne .Lf1_157
+    jmp .Lf1_158
+.Lf1_157:
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_159
+.Lf1_158:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf1_159:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 163 13
+    movq $5, %rax
+    push %rax
+    movq $36, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $30, %rax
+    cmpq $0, %rax
+    jne .Lf1_163
+    jmp .Lf1_164
+.Lf1_163:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_165
+.Lf1_164:
+    movslq -12(%rbp), %rax
+.Lf1_165:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 164 13
+    movq $61, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $3, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_166
+    jmp .Lf1_167
+.Lf1_166:
+    cmpl $64, -44(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $53, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_168
+.Lf1_167:
+    cmpl $72, -344(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -72(%rbp), %rax
+    subq $95, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_168:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_153:
+    .loc 1 160 34
+    incl -344(%rbp)
+.Lf1_155:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_154
+.Lf1_152:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_141:
+    .loc 1 157 30
+    incl -340(%rbp)
+.Lf1_143:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_142
+.Lf1_140:
+    addq $8, %rsp
+    .loc 1 168 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 169 9
+    .p2align 4,,10
+.Lf1_171:
+    .loc 1 170 13
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $76, %rax
+    cmpq $0, %rax
+    jne .Lf1_172
+    jmp .Lf1_173
+.Lf1_172:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_174
+.Lf1_173:
+    movslq -60(%rbp), %rax
+.Lf1_174:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_176
+    jmp .Lf1_175
+.Lf1_176:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_177
+    jmp .Lf1_178
+.Lf1_177:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_179
+.Lf1_178:
+    movslq -24(%rbp), %rax
+.Lf1_179:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_175:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 171 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_185
+    .p2align 4,,10
+.Lf1_184:
+    .loc 1 172 17
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $72, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_187
+.Lf1_186:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_189
+    jmp .Lf1_190
+.Lf1_189:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_191
+.Lf1_190:
+    movslq -72(%rbp), %rax
+.Lf1_191:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_193
+    jmp .Lf1_192
+.Lf1_193:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_194
+    jmp .Lf1_195
+.Lf1_194:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_196
+.Lf1_195:
+    movslq -24(%rbp), %rax
+.Lf1_196:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_192:
+    jmp .Lf1_188
+.Lf1_187:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_197
+.Lf1_198:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_197:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf1_188:
+    movl %eax, -8(%rbp)
+    .loc 1 173 17
+    movq $55, %rax
+    cmpq $0, %rax
+    jne .Lf1_199
+    jmp .Lf1_200
+.Lf1_199:
+    movq $59, %rax
+    jmp .Lf1_201
+.Lf1_200:
+    movslq -16(%rbp), %rax
+.Lf1_201:
+    push %rax
+    movq $93, %rax
+    cmpq $26, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_202
+    jmp .Lf1_203
+.Lf1_202:
+    movq $94, %rax
+    jmp .Lf1_204
+.Lf1_203:
+    movslq -344(%rbp), %rax
+.Lf1_204:
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 174 17
+    cmpl $85, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_206
+    jmp .Lf1_205
+.Lf1_206:
+    movq $48, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_205:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_208
+    jmp .Lf1_207
+.Lf1_208:
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_209
+    jmp .Lf1_210
+.Lf1_209:
+    movslq -48(%rbp), %rax
+    jmp .Lf1_211
+.Lf1_210:
+    movq $49, %rax
+.Lf1_211:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_207:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -32(%rbp)
+    addq $0, %rsp
+.Lf1_183:
+    .loc 1 171 38
+    incl -344(%rbp)
+.Lf1_185:
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_184
+.Lf1_182:
+    addq $0, %rsp
+    .loc 1 176 13
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $92, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_213
+.Lf1_212:
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_214
+.Lf1_213:
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $6, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_214:
+    movl %eax, -44(%rbp)
+    .loc 1 177 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_170:
+    .loc 1 178 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_171
+.Lf1_169:
+    addq $8, %rsp
+    .loc 1 181 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 182 9
+    .p2align 4,,10
+.Lf1_217:
+    .loc 1 183 13
+    movq $4, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_218
+    jmp .Lf1_219
+.Lf1_218:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_220
+.Lf1_219:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf1_220:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 185 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 186 17
+    .p2align 4,,10
+.Lf1_223:
+    .loc 1 187 21
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_225
+    jmp .Lf1_224
+.Lf1_225:
+    movq $45, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_224:
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $98, %rax
+    addl -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 188 21
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_227
+    jmp .Lf1_226
+.Lf1_227:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_231
+    jmp .Lf1_232
+.Lf1_231:
+    movslq -28(%rbp), %rax
+    jmp .Lf1_233
+.Lf1_232:
+    movslq -12(%rbp), %rax
+.Lf1_233:
+    cmpq $0, %rax
+    jne .Lf1_228
+    jmp .Lf1_229
+.Lf1_228:
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_230
+.Lf1_229:
+    movslq -344(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_230:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_226:
+    movl %eax, -16(%rbp)
+    .loc 1 189 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_235
+    jmp .Lf1_234
+.Lf1_235:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_234:
+    push %rax
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_237
+    jmp .Lf1_236
+.Lf1_237:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_236:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_239
+    jmp .Lf1_238
+.Lf1_239:
+    movq $95, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_238:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -24(%rbp)
+    .loc 1 190 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_222:
+    .loc 1 191 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_223
+.Lf1_221:
+    addq $0, %rsp
+    .loc 1 193 13
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_241
+    jmp .Lf1_240
+.Lf1_241:
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_240:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_243
+    jmp .Lf1_242
+.Lf1_243:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_244
+    jmp .Lf1_245
+.Lf1_244:
+    movq $34, %rax
+    jmp .Lf1_246
+.Lf1_245:
+    movslq -8(%rbp), %rax
+.Lf1_246:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_242:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 194 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_216:
+    .loc 1 195 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_217
+.Lf1_215:
+    addq $8, %rsp
+    .loc 1 197 5
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_248
+    jmp .Lf1_247
+.Lf1_248:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_249
+    jmp .Lf1_250
+.Lf1_249:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_251
+.Lf1_250:
+    movslq -4(%rbp), %rax
+.Lf1_251:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_247:
+    push %rax
+    movq $99, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $50, %rax
+    cmpq $0, %rax
+    jne .Lf1_252
+    jmp .Lf1_253
+.Lf1_252:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_254
+.Lf1_253:
+    movslq -12(%rbp), %rax
+.Lf1_254:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 198 5
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_260
+    jmp .Lf1_259
+.Lf1_260:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_259:
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_256
+    jmp .Lf1_257
+.Lf1_256:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_258
+.Lf1_257:
+    movq $77, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_258:
+    cmpq $0, %rax
+    je .Lf1_261
+    .loc 1 199 9
+    cmpl $36, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_265
+    jmp .Lf1_266
+.Lf1_265:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_268
+    jmp .Lf1_269
+.Lf1_268:
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf1_270
+.Lf1_269:
+    movq $67, %rax
+.Lf1_270:
+    jmp .Lf1_267
+.Lf1_266:
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_267:
+    cmpq $0, %rax
+    jne .Lf1_262
+    jmp .Lf1_263
+.Lf1_262:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_271
+    jmp .Lf1_272
+.Lf1_271:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_273
+.Lf1_272:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_275
+    jmp .Lf1_274
+.Lf1_275:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_274:
+.Lf1_273:
+    jmp .Lf1_264
+.Lf1_263:
+    movq $3, %rax
+    push %rax
+    movq $51, %rax
+    cmpq $21, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_264:
+    movl %eax, -12(%rbp)
+    .loc 1 200 9
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $91, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_277
+    jmp .Lf1_276
+.Lf1_277:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_278
+    jmp .Lf1_279
+.Lf1_278:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_280
+.Lf1_279:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf1_280:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_276:
+    movl %eax, -12(%rbp)
+    .loc 1 201 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_282
+    jmp .Lf1_281
+.Lf1_282:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_281:
+    push %rax
+    movq $20, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $75, %rax
+    cmpq $2, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_255
+.Lf1_261:
+    .loc 1 203 9
+    movslq -8(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $11, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $94, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 204 9
+    movq $61, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_284
+    jmp .Lf1_283
+.Lf1_284:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_283:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 205 9
+    cmpl $25, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_285
+    jmp .Lf1_286
+.Lf1_285:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_287
+.Lf1_286:
+    cmpl $86, -12(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf1_287:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_289
+    jmp .Lf1_288
+.Lf1_289:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_288:
+    push %rax
+    cmpl $52, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_255:
+    .loc 1 207 5
+    movq $8, %rax
+    push %rax
+    cmpl $44, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_291
+    jmp .Lf1_290
+.Lf1_291:
+    movq $22, %rax
+    subq $57, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_290:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
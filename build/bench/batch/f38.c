@@ -0,0 +1,375 @@
+int f0() {
+    int v0 = 49;
+    int v1 = 37;
+    int v2 = 85;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[13] && 88) / 4) > ((v1 ? 60 : v2) / 6));
+            v1 = (((a1[0][6] % 1) ? (a0[14] - v2) : (v0 ? v2 : 21)) == ((a1[2][1] + a0[5]) ? (v1 ? v2 : a1[3][7]) : (a0[15] ? 72 : 61)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[2][1] = (((i0 - v1) == (8 / 6)) == ((12 >= i1) ? (23 ? 87 : v2) : (i1 == a0[15])));
+                a0[14] = (((v3 ? v1 : i0) * (v3 % 5)) ? ((v3 != a0[15]) - (i0 == a0[1])) : ((a0[5] <= a1[1][11]) != (v1 ? v3 : 54)));
+                a0[11] = (((a1[1][5] + a1[2][2]) || (a0[9] % 1)) > ((v0 && a0[4]) ? (v1 && v2) : (i1 && 23)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v2 = (((v0 ? a0[10] : v0) ? (6 <= 91) : (13 > v0)) <= ((v1 == 19) && (v0 < v3)));
+                a0[8] = (((i2 % 3) % 1) - ((v1 || 9) ? (95 - i2) : (13 + v0)));
+                v1 = (((v0 < v0) ? (v2 == v3) : (16 ? 32 : 47)) > ((v3 <= v1) * (a1[1][10] == a1[1][9])));
+            }
+            v0 = (((58 || 35) <= (0 % 3)) - ((v0 / 8) ? (15 < 65) : (v2 <= v2)));
+            v2 = (((i2 * a0[3]) > (83 == v2)) < ((v3 < 47) != (82 <= a0[11])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v1 = (((v0 <= a0[1]) > (v1 != 97)) - ((a0[7] + a0[5]) < (93 % 2)));
+                v1 = (((v3 > v0) > (v3 % 3)) || ((a1[3][5] < a1[2][14]) && (v0 > 40)));
+                v0 = (((71 % 9) == (v3 - v3)) < ((43 >= v0) < (v3 && a0[1])));
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((v3 % 1) != (76 && i4)) ? ((v1 != 46) >= (i4 ? v3 : 99)) : ((i4 ? v0 : a1[2][15]) == (v0 >= 28)));
+        a0[15] = (((45 >= 66) + (a0[9] / 4)) * ((v0 != a0[1]) <= (v0 % 3)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((i6 || a1[1][5]) > 57) break;
+            a1[3][0] = (((v3 + a1[0][3]) && (v2 == 61)) > ((89 % 9) / 5));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v2 = (((i6 ? v1 : i7) && (i6 ? 23 : 91)) >= ((i7 + i7) <= (a0[11] ? 18 : i6)));
+                v3 = (((a0[13] / 5) ? (a0[10] - a0[14]) : (v2 - 66)) < ((v2 <= v2) < (a1[0][14] && v2)));
+                v3 = (((a0[4] ? 88 : a1[3][1]) && (i6 < v3)) >= ((v3 ? i6 : v2) || (20 == 89)));
+            }
+            v0 = (((57 || v2) < (v2 || a1[1][3])) ? ((v1 * v3) + (v0 == 91)) : ((a0[14] == a1[3][15]) ? (a0[14] == v1) : (v2 || a0[3])));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            v3 = (((a0[2] && a1[1][11]) % 7) / 2);
+            a0[10] = (((44 ? v1 : a1[2][14]) != (7 * v3)) + ((i8 ? a0[10] : i8) - (v1 - 4)));
+            {
+                int i9 = 0;
+                do {
+                    if ((89 * 40) > 86) break;
+                    a0[14] = (((v0 && a0[12]) && (i8 || a1[2][8])) + ((48 > 3) != (92 * v0)));
+                    a0[1] = (((v1 + v1) < (79 && 84)) <= ((a1[2][0] - v2) - (a0[11] && 71)));
+                    a0[3] = (((i9 / 7) || (i8 != v3)) % 9);
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            v2 = (((a1[2][2] * i10) * (a0[15] < 49)) > ((v0 - v3) >= (v0 * a0[2])));
+            for (int i11 = 0; i11 < 8; i11 = i11 + 1) {
+                a1[3][7] = (((43 <= a1[2][3]) + (v1 == a0[3])) - ((79 + v2) || (81 + v3)));
+                v2 = (((2 - 87) % 9) - ((36 > i10) % 5));
+                a0[2] = (((60 <= i10) % 9) / 4);
+            }
+            v2 = (((a0[2] || 98) != (v1 % 2)) != ((i10 != a1[1][1]) + (26 % 8)));
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 7; i12 = i12 + 1) {
+        for (int i13 = 0; i13 < 8; i13 = i13 + 1) {
+            if ((i12 - 9) > 53) break;
+            v1 = (((a0[4] % 2) >= (86 <= a1[3][6])) > ((v3 + v1) < (i13 / 3)));
+            a1[0][15] = (((27 <= a0[12]) % 7) && ((v0 / 4) ? (v0 == v0) : (i13 * i12)));
+            v3 = (((a1[3][4] ? a0[12] : i13) ? (28 * a1[2][15]) : (17 || v1)) < ((v2 || a0[13]) / 3));
+        }
+        a0[15] = (((v1 || a1[1][5]) + (25 ? v3 : a0[0])) % 4);
+        a0[13] = (((78 ? 81 : 72) % 8) || ((a1[3][4] != a0[4]) != (v2 > v2)));
+    }
+    {
+        int i14 = 0;
+        while (i14 < 5) {
+            if ((i14 ? i14 : a1[1][6]) > 50) break;
+            a1[1][0] = (((37 - v0) > (i14 * i14)) % 9);
+            {
+                int i15 = 0;
+                while (i15 < 3) {
+                    a1[1][6] = (((a1[2][13] == a1[2][15]) < (a0[6] - 0)) ? ((v0 && 56) + (52 > v0)) : ((19 ? 80 : i15) * (i14 <= 68)));
+                    v0 = (((v0 < v1) ? (24 >= 35) : (v3 ? i15 : i15)) ? ((a0[8] ? a0[11] : 98) >= (a1[3][6] <= i14)) : ((v3 && v2) <= (i15 || v1)));
+                    v0 = (((13 * a0[15]) - (61 + v2)) % 5);
+                    i15 = i15 + 1;
+                }
+            }
+            v3 = (((v3 + 90) >= (34 || v2)) / 8);
+            i14 = i14 + 1;
+        }
+    }
+    for (int i16 = 0; i16 < 6; i16 = i16 + 1) {
+        if ((82 || i16) > 72) break;
+        a1[1][0] = (((v3 % 2) ? (v0 % 1) : (a1[0][14] / 3)) ? ((a0[11] + v3) / 4) : ((a1[3][4] && 30) > (i16 - 76)));
+        {
+            int i17 = 0;
+            while (i17 < 8) {
+                a1[0][3] = (((i17 ? a0[10] : i17) != (a0[11] == i17)) <= ((61 - a1[1][10]) && (a0[0] || v3)));
+                a1[1][10] = (((a0[6] > a0[11]) != (v2 < v2)) && ((63 % 3) < (v3 + a0[4])));
+                v3 = (((66 - 7) * (a1[0][14] && a1[0][12])) % 2);
+                i17 = i17 + 1;
+            }
+        }
+        v0 = (((v1 ? a1[3][3] : v3) > (v0 ? 5 : v0)) || ((v3 ? v0 : v2) > (i16 > i16)));
+    }
+    {
+        int i18 = 0;
+        while (i18 < 4) {
+            if ((a1[1][5] >= 32) > 71) break;
+            v1 = (((65 - a0[0]) > (i18 == i18)) > ((8 ? 66 : v1) / 2));
+            v0 = (((a0[5] != v3) ? (v2 ? a1[0][8] : v0) : (67 != v0)) < ((25 ? 93 : v3) + (55 < v3)));
+            {
+                int i19 = 0;
+                do {
+                    if ((a0[7] >= i19) > 82) break;
+                    v0 = (((v3 == v3) >= (v0 ? v1 : i19)) != ((v1 / 5) + (i18 ? a0[5] : a1[3][7])));
+                    v0 = (((i19 == i19) == (a0[4] > a0[3])) % 5);
+                    v0 = (((i18 != a0[6]) && (26 ? 28 : 1)) != ((i18 <= v2) >= (i18 - i18)));
+                    i19 = i19 + 1;
+                } while (i19 < 2);
+            }
+            i18 = i18 + 1;
+        }
+    }
+    return (((81 || a0[11]) / 7) || ((a1[2][3] ? v0 : 8) ? (a1[1][8] || a1[0][1]) : (v2 == a0[12])));
+}
+int f1() {
+    int v0 = 32;
+    int v1 = 93;
+    int v2 = 12;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((i0 ? v0 : v3) > 63) break;
+            v3 = (((v2 <= v1) <= (a0[11] && v1)) / 2);
+            a0[3] = (((v2 > i0) == (i0 <= v0)) ? ((91 - v2) + (v2 * v0)) : ((59 <= v1) <= (59 <= v3)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((3 ? a0[5] : i1) > 74) break;
+                v1 = (((68 <= a0[12]) + (63 + 3)) > ((v0 / 2) > (4 != 43)));
+                a1[2][11] = (((a1[1][3] || 1) + (a0[15] == a1[1][5])) ? ((18 ? a1[2][8] : i0) && (v2 / 2)) : ((v1 ? a1[2][3] : v2) * (a1[3][0] == i0)));
+                a1[2][1] = (((a1[2][9] * a1[0][7]) > (a1[3][14] || a1[0][3])) % 3);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 != v2) - (v0 == v0)) != ((v2 % 2) || (v1 ? a1[1][10] : a0[5])))) {
+        v0 = (((77 - v2) + (42 ? v3 : v0)) % 9);
+        a0[0] = (((v2 / 1) % 9) + ((v0 - a1[2][0]) + (v1 != 8)));
+        v0 = (((v0 != 89) && (64 && v1)) - ((v3 / 6) ? (59 || 28) : (a1[3][10] + v1)));
+    } else {
+        v2 = (((v1 * 87) % 3) ? ((a1[1][4] && v2) != (v2 ? 94 : v3)) : ((a0[6] <= v2) / 4));
+        v3 = (((v2 != v2) > (a1[2][5] - 17)) > ((51 == v3) < (v2 ? 97 : a1[2][8])));
+        a0[13] = (((v0 >= v0) > (v1 <= a0[3])) ? ((v0 % 2) ? (33 <= v0) : (v3 + v3)) : ((41 != v3) ? (41 ? 38 : 25) : (a0[10] ? a1[3][6] : a1[3][11])));
+    }
+    a1[3][4] = (((a0[7] > 6) ? (v3 < v2) : (a0[12] ? v1 : v1)) > ((a1[3][6] ? v2 : 62) || (95 || a1[1][0])));
+    a1[2][6] = (((6 - 81) && (a1[2][12] / 7)) > ((v3 ? v1 : 22) <= (99 - v1)));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((v1 < i3) > 53) break;
+                v2 = (((a0[8] ? 32 : 90) || (a1[0][15] && 98)) + ((99 / 7) / 7));
+                v1 = (((a0[14] || v1) && (v2 + v3)) ? ((a1[0][5] ? 47 : i2) < (v3 * a1[2][0])) : ((28 < a1[2][8]) % 9));
+                a1[0][8] = (((a1[1][7] / 9) ? (v1 <= 15) : (a1[3][6] <= i3)) * ((62 / 3) ? (a1[1][11] + v3) : (i2 == 0)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((60 ? v3 : v1) - (a1[0][8] != i2)) * ((70 ? v2 : a1[3][14]) - (v1 < v3)));
+        v2 = (((v0 + a1[2][2]) <= (v2 <= i2)) % 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((90 ? a1[1][6] : v2) > 81) break;
+            v0 = (((38 == v0) + (v0 % 4)) != ((a0[4] >= 68) ? (53 > v0) : (72 == 10)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v3 = (((i4 == i5) == (v3 % 9)) || ((v0 / 8) != (v1 >= 93)));
+                a0[0] = (((i5 ? 94 : v3) > (i5 < a1[1][9])) < ((75 || i5) + (a1[3][0] % 1)));
+                a1[3][8] = (((i4 < v1) != (i5 || v0)) != ((v0 + a0[2]) != (a0[11] < 7)));
+            }
+            v0 = (((a1[3][14] >= v2) - (v1 - v0)) % 4);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[9] = (((v1 < v1) - (a0[8] == v3)) / 9);
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((75 == 45) > 59) break;
+                v0 = (((a1[0][9] < v1) && (a1[1][9] / 5)) ? ((a0[12] - v0) || (i6 + a1[3][15])) : ((a0[7] ? v2 : v0) < (v0 > a1[2][14])));
+                v2 = (((a1[3][5] - v2) < (a0[5] || a1[1][14])) == ((i6 != 28) != (30 * 87)));
+                v0 = (((i6 % 8) ? (i6 || i6) : (v2 || v1)) - ((i7 - i6) <= (v1 - v3)));
+            }
+            a1[1][13] = (((73 - 38) + (v0 + v3)) % 1);
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    if ((((v2 ? a0[2] : 82) - (v0 % 1)) - ((a1[1][5] > 19) % 4))) {
+        v0 = (((70 != 61) != (a1[3][9] ? 90 : v1)) % 4);
+        v0 = (((13 < v0) * (v2 ? v3 : v2)) * ((v2 + v3) == (v1 <= v2)));
+        a1[2][11] = (((v2 ? a0[12] : v1) || (62 ? v1 : a0[3])) + ((a1[2][14] <= 54) * (v1 ? 35 : v0)));
+    } else {
+        a1[3][7] = (((v3 - 19) == (96 ? 47 : v0)) >= ((a1[3][0] % 7) % 6));
+        v1 = (((51 / 9) / 3) <= ((a1[2][11] % 5) ? (a0[9] != v1) : (v0 == 84)));
+        v0 = (((a1[0][4] * a0[3]) - (45 == a0[1])) > ((92 / 9) < (a0[1] % 5)));
+    }
+    a0[11] = (((74 % 2) < (v1 > v3)) % 1);
+    if ((((a1[1][14] <= v1) < (33 <= v2)) == ((v0 == 47) != (32 != v1)))) {
+        v3 = (((77 || 14) && (a0[3] > v3)) / 6);
+        v0 = (((49 <= 56) >= (v1 != v3)) >= ((a1[2][15] % 6) > (v0 < v2)));
+        v2 = (((v0 * 11) % 5) - ((v1 / 8) < (v0 >= v3)));
+    } else {
+        v3 = (((v1 ? 28 : a1[0][2]) < (v1 ? a1[0][3] : 90)) / 3);
+        v2 = (((v1 > a0[14]) - (91 * 51)) < ((a1[2][15] + 93) * (a1[3][1] >= v3)));
+        v3 = (((a1[3][3] * 98) >= (a1[2][8] > v0)) > ((76 >= v1) ? (a1[0][2] && v2) : (a1[1][14] && a0[6])));
+    }
+    return (((v1 <= 75) * (a1[3][14] ? a0[1] : v1)) > ((v3 <= a1[2][8]) * (a1[2][14] > v2)));
+}
+int f2() {
+    int v0 = 19;
+    int v1 = 94;
+    int v2 = 53;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((91 > 4) == (v1 < v2)) - ((24 >= a0[2]) + (66 > a1[3][6])));
+    if ((((49 * 99) - (v0 <= a1[3][8])) - ((a0[12] && v2) + (a0[3] && a0[0])))) {
+        v3 = (((v0 ? v2 : a1[3][8]) > (v2 + 39)) >= ((52 < v2) - (v3 % 2)));
+        v1 = (((24 * v1) ? (v3 == 35) : (a0[10] && a1[2][7])) && ((a1[3][4] || a0[9]) == (v2 < v3)));
+        a0[9] = (((54 > a1[3][2]) ? (75 == a1[0][13]) : (52 >= v3)) / 4);
+    } else {
+        a1[1][12] = (((v1 ? a0[14] : v2) == (v3 >= v0)) ? ((v2 ? a1[1][0] : v2) < (5 - v2)) : ((a1[3][10] > 6) - (62 + a0[15])));
+        a0[12] = (((a0[15] <= v3) ? (v2 < a0[15]) : (a1[2][0] >= 67)) >= ((v0 ? 92 : a1[2][12]) && (v2 + v0)));
+        a0[1] = (((v1 || 11) - (v1 <= v1)) % 5);
+    }
+    a1[0][14] = (((v1 != a0[1]) + (v1 / 6)) <= ((v2 + v0) || (79 + a1[2][14])));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((a0[5] <= v3) > 58) break;
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v0 = (((a0[8] + a1[3][15]) ? (v0 && v0) : (v2 / 2)) ? ((v1 != i0) != (a0[12] + i0)) : ((a0[12] - v2) / 4));
+                a1[0][0] = (((a1[2][15] || v3) == (i0 == a1[2][1])) % 8);
+                v2 = (((v0 % 8) != (v0 ? v0 : v2)) < ((a0[1] - 50) || (65 % 7)));
+            }
+            a1[0][11] = (((v2 % 1) < (a0[6] / 4)) >= ((64 ? i0 : v3) > (v1 ? v3 : v3)));
+            v2 = (((v1 * v2) % 1) ? ((v0 * a0[13]) ? (54 != a0[1]) : (v2 < 14)) : ((v2 || i0) <= (a0[5] ? 45 : v0)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((8 <= v1) <= (76 <= 85)) / 1)) {
+        a0[14] = (((a1[1][9] && v1) / 4) && ((v2 <= v2) > (v3 == v1)));
+        v1 = (((15 && a0[3]) ? (97 ? v3 : v1) : (v2 < v2)) != ((v2 - a0[12]) / 4));
+        a0[15] = (((v1 || v3) + (83 == v3)) > ((a0[0] ? v2 : a1[2][0]) + (a1[3][2] > a0[12])));
+    } else {
+        v1 = (((a1[2][12] / 2) < (a1[3][8] <= a1[2][2])) == ((a0[3] - v0) - (47 + a0[13])));
+        v1 = (((a0[1] == 62) + (v3 == a0[10])) * ((v3 > a1[1][10]) + (48 / 1)));
+        v2 = (((a1[3][11] * a0[5]) / 9) <= ((a1[2][7] > 97) - (a1[2][6] ? v1 : a1[0][4])));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((46 >= i2) % 7) != ((a1[2][0] % 7) + (v1 - i2)));
+            v3 = (((v3 - a0[5]) + (65 || v3)) / 7);
+            {
+                int i3 = 0;
+                do {
+                    a1[1][3] = (((49 + 20) ? (v1 * 80) : (v3 ? a0[6] : 89)) - ((v3 <= v2) != (98 == v1)));
+                    v1 = (((a0[5] * v3) >= (71 + 1)) <= ((v1 <= a0[12]) / 5));
+                    v1 = (((46 ? v3 : 80) != (v2 <= v3)) && ((70 + v3) != (v1 == i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 6) {
+                a1[3][13] = (((80 <= v1) == (a1[0][5] > v1)) < ((v3 - 54) % 6));
+                a1[1][6] = (((v3 ? 88 : 91) / 4) != ((v3 - 52) > (79 == v3)));
+                v1 = (((a0[12] * i4) != (81 == v1)) * ((v3 && 2) && (a1[2][0] + a1[0][0])));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((30 + v1) && (v3 ? v2 : v3)) || ((43 > a1[3][0]) ? (55 || i4) : (v0 >= v2)));
+        a1[1][4] = (((46 ? a0[6] : 8) || (a1[2][8] / 6)) != ((v1 || 67) ? (v0 < a0[6]) : (v1 / 8)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        if ((a0[10] || 80) > 58) break;
+        v2 = (((a0[0] * v0) == (71 / 9)) * ((v2 || 31) != (12 ? 94 : 92)));
+        v2 = (((a1[2][11] * a0[1]) * (98 - a1[2][12])) && ((19 * a0[15]) == (v1 - i6)));
+        {
+            int i7 = 0;
+            while (i7 < 8) {
+                a1[1][9] = (((v2 % 8) / 4) > ((a0[3] && 78) < (21 % 8)));
+                v0 = (((v1 % 7) ? (i6 % 6) : (a1[2][10] % 1)) > ((30 % 9) >= (a0[9] / 5)));
+                v2 = (((i7 - v2) != (19 ? v3 : i6)) > ((v2 <= 62) != (a0[10] != i6)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((v2 || a1[1][15]) > 91) break;
+            a0[1] = (((0 / 6) < (35 ? a1[0][3] : a0[0])) == ((v3 != 52) < (i8 < a1[2][15])));
+            v3 = (((a0[15] / 5) % 1) > ((v3 == v0) && (v2 * 37)));
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                a1[3][10] = (((a1[0][10] <= a1[0][3]) > (a0[2] % 5)) || ((v0 < a1[0][10]) < (31 + a0[8])));
+                v2 = (((v3 - i9) - (i9 % 2)) && ((v1 % 1) ? (v2 || 22) : (v0 || i8)));
+                v3 = (((v3 == v0) <= (51 != v1)) - ((a0[4] || 62) % 8));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            v2 = (((a0[12] && 49) - (v2 && i10)) ? ((40 ? 65 : i10) != (32 ? v1 : 54)) : ((88 % 1) + (1 == 95)));
+            v0 = (((v3 == a1[3][2]) - (v0 != v1)) ? ((32 < a0[11]) == (32 || i10)) : ((v1 || v2) >= (a1[3][5] ? 12 : 70)));
+            {
+                int i11 = 0;
+                do {
+                    v1 = (((v1 && a1[0][5]) * (a1[0][13] == v3)) * ((i10 - v1) != (v0 || a1[2][6])));
+                    v1 = (((i11 == a0[12]) <= (31 ? 88 : i11)) >= ((i11 * a1[2][12]) && (a0[7] < 82)));
+                    v1 = (((40 < 78) <= (54 || 78)) >= ((a0[13] >= v1) && (v0 < v1)));
+                    i11 = i11 + 1;
+                } while (i11 < 5);
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((a1[0][5] - v3) / 7) % 8);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,8389 @@
+    .file 1 "build/bench/batch/f38.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 369 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 370 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 371 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 372 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 373 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 374 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $49, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $37, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $85, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $8, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 11 13
+    movq $4, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_5
+    jmp .Lf0_4
+.Lf0_5:
+    movq $88, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_4:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_6
+    jmp .Lf0_7
+.Lf0_6:
+    movq $60, %rax
+    jmp .Lf0_8
+.Lf0_7:
+    movslq -12(%rbp), %rax
+.Lf0_8:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 12 13
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -24(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_11
+.Lf0_10:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_12
+    jmp .Lf0_13
+.Lf0_12:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_14
+.Lf0_13:
+    movq $21, %rax
+.Lf0_14:
+.Lf0_11:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_15
+    jmp .Lf0_16
+.Lf0_15:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_18
+    jmp .Lf0_19
+.Lf0_18:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_20
+.Lf0_19:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_20:
+    jmp .Lf0_17
+.Lf0_16:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_21
+    jmp .Lf0_22
+.Lf0_21:
+    movq $72, %rax
+    jmp .Lf0_23
+.Lf0_22:
+    movq $61, %rax
+.Lf0_23:
+.Lf0_17:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 13 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 14 17
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $8, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $12, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_29
+    jmp .Lf0_30
+.Lf0_29:
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_33
+.Lf0_32:
+    movq $87, %rax
+    jmp .Lf0_34
+.Lf0_33:
+    movslq -12(%rbp), %rax
+.Lf0_34:
+    jmp .Lf0_31
+.Lf0_30:
+    movslq -344(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_31:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 15 17
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_38
+    jmp .Lf0_39
+.Lf0_38:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -340(%rbp), %rax
+.Lf0_40:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_35
+    jmp .Lf0_36
+.Lf0_35:
+    movslq -340(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_37
+.Lf0_36:
+    movslq -60(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_42
+.Lf0_41:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_43
+.Lf0_42:
+    movq $54, %rax
+.Lf0_43:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_37:
+    movl %eax, -24(%rbp)
+    .loc 1 16 17
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_45
+    jmp .Lf0_44
+.Lf0_45:
+    movq $1, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_44:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_49
+.Lf0_50:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_49:
+    cmpq $0, %rax
+    jne .Lf0_46
+    jmp .Lf0_47
+.Lf0_46:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_52
+    jmp .Lf0_51
+.Lf0_52:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_51:
+    jmp .Lf0_48
+.Lf0_47:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_54
+    jmp .Lf0_53
+.Lf0_54:
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_53:
+.Lf0_48:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lf0_28:
+    .loc 1 13 38
+    incl -344(%rbp)
+    .loc 1 14 17
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $8, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $12, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_55
+    jmp .Lf0_56
+.Lf0_55:
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_58
+    jmp .Lf0_59
+.Lf0_58:
+    movq $87, %rax
+    jmp .Lf0_60
+.Lf0_59:
+    movslq -12(%rbp), %rax
+.Lf0_60:
+    jmp .Lf0_57
+.Lf0_56:
+    movslq -344(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_57:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 15 17
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_64
+    jmp .Lf0_65
+.Lf0_64:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_66
+.Lf0_65:
+    movslq -340(%rbp), %rax
+.Lf0_66:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_61
+    jmp .Lf0_62
+.Lf0_61:
+    movslq -340(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_63
+.Lf0_62:
+    movslq -60(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_67
+    jmp .Lf0_68
+.Lf0_67:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_69
+.Lf0_68:
+    movq $54, %rax
+.Lf0_69:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+.Lf0_63:
+    movl %eax, -24(%rbp)
+    .loc 1 16 17
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_71
+    jmp .Lf0_70
+.Lf0_71:
+    movq $1, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_70:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_76
+    jmp .Lf0_75
+.Lf0_76:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_75:
+    cmpq $0, %rax
+    jne .Lf0_72
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_78
+    jmp .Lf0_77
+.Lf0_78:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_77:
+    jmp .Lf0_74
+.Lf0_73:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_80
+    jmp .Lf0_79
+.Lf0_80:
+    movq $23, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_79:
+.Lf0_74:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lf0_27:
+    .loc 1 13 38
+    incl -344(%rbp)
+.Lf0_26:
+    addq $0, %rsp
+    .loc 1 18 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 19 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 22 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 23 9
+    .p2align 4,,10
+.Lf0_83:
+    .loc 1 24 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_89
+    .p2align 4,,10
+.Lf0_88:
+    .loc 1 25 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_93
+    jmp .Lf0_94
+.Lf0_93:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_95
+.Lf0_94:
+    movslq -4(%rbp), %rax
+.Lf0_95:
+    cmpq $0, %rax
+    jne .Lf0_90
+    jmp .Lf0_91
+.Lf0_90:
+    movq $6, %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_92
+.Lf0_91:
+    movq $13, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf0_92:
+    push %rax
+    cmpl $19, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_97
+    jmp .Lf0_96
+.Lf0_97:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_96:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 26 17
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_102
+    jmp .Lf0_101
+.Lf0_102:
+    movq $9, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_101:
+    cmpq $0, %rax
+    jne .Lf0_98
+    jmp .Lf0_99
+.Lf0_98:
+    movq $95, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_100
+.Lf0_99:
+    movq $13, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_100:
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    .loc 1 27 17
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_103
+    jmp .Lf0_104
+.Lf0_103:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_105
+.Lf0_104:
+    movq $16, %rax
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_107
+.Lf0_106:
+    movq $32, %rax
+    jmp .Lf0_108
+.Lf0_107:
+    movq $47, %rax
+.Lf0_108:
+.Lf0_105:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_87:
+    .loc 1 24 38
+    incl -344(%rbp)
+.Lf0_89:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_88
+.Lf0_86:
+    addq $0, %rsp
+    .loc 1 29 13
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_110
+.Lf0_109:
+    movq $15, %rax
+    cmpq $65, %rax
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_111
+.Lf0_110:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf0_111:
+    push %rax
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_113
+    jmp .Lf0_112
+.Lf0_113:
+    movq $35, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_112:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $0, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 30 13
+    movslq -340(%rbp), %rax
+    imull -68(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $83, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    cmpl $47, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $82, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 31 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_82:
+    .loc 1 32 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_83
+.Lf0_81:
+    addq $8, %rsp
+    .loc 1 34 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_119
+    .p2align 4,,10
+.Lf0_118:
+    .loc 1 36 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 37 13
+    jmp .Lf0_123
+    .p2align 4,,10
+.Lf0_122:
+    .loc 1 38 17
+    movslq -52(%rbp), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $93, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    cmpl $97, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 39 17
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_125
+    jmp .Lf0_124
+.Lf0_125:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_127
+    jmp .Lf0_126
+.Lf0_127:
+    cmpl $40, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_126:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_124:
+    movl %eax, -8(%rbp)
+    .loc 1 40 17
+    movq $9, %rax
+    push %rax
+    movq $71, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $43, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_129
+    jmp .Lf0_128
+.Lf0_129:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_128:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 41 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_121:
+.Lf0_123:
+    .loc 1 37 20
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_122
+.Lf0_120:
+    addq $0, %rsp
+    .loc 1 44 9
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_134
+    jmp .Lf0_133
+.Lf0_134:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_133:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_130
+    jmp .Lf0_131
+.Lf0_130:
+    cmpl $46, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_135
+    jmp .Lf0_136
+.Lf0_135:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_137
+.Lf0_136:
+    movq $99, %rax
+.Lf0_137:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_132
+.Lf0_131:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_138
+    jmp .Lf0_139
+.Lf0_138:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_140
+.Lf0_139:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf0_140:
+    push %rax
+    cmpl $28, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_132:
+    movl %eax, -12(%rbp)
+    .loc 1 45 9
+    movslq -4(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    cmpq $66, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+.Lf0_117:
+    .loc 1 34 30
+    incl -340(%rbp)
+.Lf0_119:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_118
+.Lf0_116:
+    addq $8, %rsp
+    .loc 1 48 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 49 9
+    .p2align 4,,10
+.Lf0_143:
+    .loc 1 50 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_146
+    jmp .Lf0_145
+.Lf0_146:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_145:
+    cmpq $57, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_144
+    jmp .Lf0_141
+.Lf0_144:
+    .loc 1 51 13
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_147
+.Lf0_148:
+    cmpl $61, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_147:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $89, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 52 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_154
+    .p2align 4,,10
+.Lf0_153:
+    .loc 1 53 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_156
+.Lf0_155:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -344(%rbp), %rax
+.Lf0_157:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_159
+    jmp .Lf0_158
+.Lf0_159:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_160
+    jmp .Lf0_161
+.Lf0_160:
+    movq $23, %rax
+    jmp .Lf0_162
+.Lf0_161:
+    movq $91, %rax
+.Lf0_162:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_158:
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_163
+    jmp .Lf0_164
+.Lf0_163:
+    movq $18, %rax
+    jmp .Lf0_165
+.Lf0_164:
+    movslq -340(%rbp), %rax
+.Lf0_165:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 54 17
+    movq $5, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_166
+    jmp .Lf0_167
+.Lf0_166:
+    movslq -40(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_168
+.Lf0_167:
+    movslq -12(%rbp), %rax
+    subq $66, %rax
+    movslq %eax, %rax
+.Lf0_168:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_170
+    jmp .Lf0_169
+.Lf0_170:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_169:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 55 17
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_171
+    jmp .Lf0_172
+.Lf0_171:
+    movq $88, %rax
+    jmp .Lf0_173
+.Lf0_172:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf0_173:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_174
+.Lf0_175:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_174:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_176
+    jmp .Lf0_177
+.Lf0_176:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_178
+.Lf0_177:
+    movslq -12(%rbp), %rax
+.Lf0_178:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_180
+    jmp .Lf0_179
+.Lf0_180:
+    movq $20, %rax
+    cmpq $89, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_179:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_152:
+    .loc 1 52 38
+    incl -344(%rbp)
+.Lf0_154:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_153
+.Lf0_151:
+    addq $0, %rsp
+    .loc 1 57 13
+    movq $57, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_185
+    jmp .Lf0_184
+.Lf0_185:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_184:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_187
+    jmp .Lf0_186
+.Lf0_187:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_181
+    jmp .Lf0_182
+.Lf0_181:
+    cmpl $91, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_183
+.Lf0_182:
+    movslq -24(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_188
+    jmp .Lf0_189
+.Lf0_188:
+    movslq -24(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_190
+.Lf0_189:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_192
+    jmp .Lf0_191
+.Lf0_192:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_191:
+.Lf0_190:
+.Lf0_183:
+    movl %eax, -4(%rbp)
+    .loc 1 58 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_142:
+    .loc 1 59 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_143
+.Lf0_141:
+    addq $8, %rsp
+    .loc 1 62 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 63 9
+    jmp .Lf0_196
+    .p2align 4,,10
+.Lf0_195:
+    .loc 1 64 13
+    movq $2, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_198
+    jmp .Lf0_197
+.Lf0_198:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_197:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 65 13
+    movslq -8(%rbp), %rax
+    subq $4, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_199
+    jmp .Lf0_200
+.Lf0_199:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_201
+.Lf0_200:
+    movslq -340(%rbp), %rax
+.Lf0_201:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $44, %rax
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_203
+.Lf0_202:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_204
+.Lf0_203:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf0_204:
+    push %rax
+    movq $7, %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 67 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 68 17
+    .p2align 4,,10
+.Lf0_207:
+    .loc 1 69 21
+    movq $89, %rax
+    imulq $40, %rax
+    movslq %eax, %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_208
+    jmp .Lf0_205
+.Lf0_208:
+    .loc 1 70 21
+    movq $48, %rax
+    cmpq $3, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $92, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_209
+.Lf0_210:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_209:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_212
+    jmp .Lf0_211
+.Lf0_212:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_214
+    jmp .Lf0_213
+.Lf0_214:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_213:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_211:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 71 21
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_216
+    jmp .Lf0_215
+.Lf0_216:
+    movq $84, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_215:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_218
+    jmp .Lf0_217
+.Lf0_218:
+    movq $71, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_217:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -76(%rbp)
+    .loc 1 72 21
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_220
+    jmp .Lf0_219
+.Lf0_220:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_219:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 73 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_206:
+    .loc 1 74 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_207
+.Lf0_205:
+    addq $0, %rsp
+    .loc 1 76 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_194:
+.Lf0_196:
+    .loc 1 63 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_195
+.Lf0_193:
+    addq $8, %rsp
+    .loc 1 80 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 81 9
+    jmp .Lf0_224
+    .p2align 4,,10
+.Lf0_223:
+    .loc 1 82 13
+    cmpl $49, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 83 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_230
+    .p2align 4,,10
+.Lf0_229:
+    .loc 1 84 17
+    movq $79, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_235
+    jmp .Lf0_234
+.Lf0_235:
+    movq $81, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_234:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $43, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 85 17
+    movq $5, %rax
+    push %rax
+    movq $36, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $2, %rax
+    subq $87, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 86 17
+    movq $4, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $60, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    addq $0, %rsp
+.Lf0_233:
+    .loc 1 83 40
+    incl -344(%rbp)
+    .loc 1 84 17
+    movq $79, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_237
+    jmp .Lf0_236
+.Lf0_237:
+    movq $81, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_236:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $43, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 85 17
+    movq $5, %rax
+    push %rax
+    movq $36, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $2, %rax
+    subq $87, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 86 17
+    movq $4, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $60, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    addq $0, %rsp
+.Lf0_232:
+    .loc 1 83 40
+    incl -344(%rbp)
+.Lf0_230:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $8, %rax
+    jl .Lf0_229
+.Lf0_231:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_227
+    .loc 1 84 17
+    movq $79, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_239
+    jmp .Lf0_238
+.Lf0_239:
+    movq $81, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_238:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $43, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 85 17
+    movq $5, %rax
+    push %rax
+    movq $36, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $2, %rax
+    subq $87, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 86 17
+    movq $4, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $60, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    addq $0, %rsp
+.Lf0_228:
+    .loc 1 83 40
+    incl -344(%rbp)
+    jmp .Lf0_231
+.Lf0_227:
+    addq $0, %rsp
+    .loc 1 88 13
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_241
+    jmp .Lf0_240
+.Lf0_241:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_240:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $26, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 89 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_222:
+.Lf0_224:
+    .loc 1 81 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_223
+.Lf0_221:
+    addq $8, %rsp
+    .loc 1 92 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_247
+    .p2align 4,,10
+.Lf0_246:
+    .loc 1 93 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_253
+    .p2align 4,,10
+.Lf0_252:
+    .loc 1 94 13
+    movslq -340(%rbp), %rax
+    subq $9, %rax
+    movslq %eax, %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_254
+    jmp .Lf0_250
+.Lf0_254:
+    .loc 1 95 13
+    movq $2, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $86, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 96 13
+    movq $7, %rax
+    push %rax
+    movq $27, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_256
+    jmp .Lf0_255
+.Lf0_256:
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_257
+    jmp .Lf0_258
+.Lf0_257:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_259
+.Lf0_258:
+    movslq -344(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_259:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_255:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 97 13
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_263
+    jmp .Lf0_264
+.Lf0_263:
+    movslq -32(%rbp), %rax
+    jmp .Lf0_265
+.Lf0_264:
+    movslq -344(%rbp), %rax
+.Lf0_265:
+    cmpq $0, %rax
+    jne .Lf0_260
+    jmp .Lf0_261
+.Lf0_260:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    imulq $28, %rax
+    movslq %eax, %rax
+    jmp .Lf0_262
+.Lf0_261:
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_267
+    jmp .Lf0_266
+.Lf0_267:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_266:
+.Lf0_262:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_269
+    jmp .Lf0_268
+.Lf0_269:
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_268:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_251:
+    .loc 1 93 36
+    incl -344(%rbp)
+.Lf0_253:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_252
+.Lf0_250:
+    addq $0, %rsp
+    .loc 1 99 9
+    movq $4, %rax
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    jne .Lf0_270
+    jmp .Lf0_271
+.Lf0_270:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_272
+.Lf0_271:
+    movslq -80(%rbp), %rax
+.Lf0_272:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_274
+    jmp .Lf0_273
+.Lf0_274:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_273:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 100 9
+    movq $8, %rax
+    push %rax
+    movq $78, %rax
+    cmpq $0, %rax
+    jne .Lf0_275
+    jmp .Lf0_276
+.Lf0_275:
+    movq $81, %rax
+    jmp .Lf0_277
+.Lf0_276:
+    movq $72, %rax
+.Lf0_277:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_279
+    jmp .Lf0_278
+.Lf0_279:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_278:
+    movl %eax, -28(%rbp)
+    addq $0, %rsp
+.Lf0_245:
+    .loc 1 92 32
+    incl -340(%rbp)
+.Lf0_247:
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_246
+.Lf0_244:
+    addq $8, %rsp
+    .loc 1 103 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 104 9
+    jmp .Lf0_283
+    .p2align 4,,10
+.Lf0_282:
+    .loc 1 105 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_285
+    jmp .Lf0_286
+.Lf0_285:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_287
+.Lf0_286:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf0_287:
+    cmpq $50, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_284
+    jmp .Lf0_280
+.Lf0_284:
+    .loc 1 106 13
+    movq $9, %rax
+    push %rax
+    movq $37, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 108 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 109 17
+    jmp .Lf0_291
+    .p2align 4,,10
+.Lf0_290:
+    .loc 1 110 21
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -56(%rbp), %rax
+    subq $0, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_292
+    jmp .Lf0_293
+.Lf0_292:
+    movq $52, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_296
+    jmp .Lf0_295
+.Lf0_296:
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_295:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_294
+.Lf0_293:
+    cmpl $68, -340(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf0_297
+    jmp .Lf0_298
+.Lf0_297:
+    movq $80, %rax
+    jmp .Lf0_299
+.Lf0_298:
+    movslq -344(%rbp), %rax
+.Lf0_299:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf0_294:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 111 21
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_303
+    jmp .Lf0_304
+.Lf0_303:
+    movq $24, %rax
+    cmpq $35, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_305
+.Lf0_304:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_306
+    jmp .Lf0_307
+.Lf0_306:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_308
+.Lf0_307:
+    movslq -344(%rbp), %rax
+.Lf0_308:
+.Lf0_305:
+    cmpq $0, %rax
+    jne .Lf0_300
+    jmp .Lf0_301
+.Lf0_300:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_309
+    jmp .Lf0_310
+.Lf0_309:
+    movslq -36(%rbp), %rax
+    jmp .Lf0_311
+.Lf0_310:
+    movq $98, %rax
+.Lf0_311:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_302
+.Lf0_301:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_313
+    jmp .Lf0_312
+.Lf0_313:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_312:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_315
+    jmp .Lf0_314
+.Lf0_315:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_314:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf0_302:
+    movl %eax, -4(%rbp)
+    .loc 1 112 21
+    movq $5, %rax
+    push %rax
+    movq $61, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $13, %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 113 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_289:
+.Lf0_291:
+    .loc 1 109 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_290
+.Lf0_288:
+    addq $0, %rsp
+    .loc 1 116 13
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $90, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $34, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_317
+    jmp .Lf0_316
+.Lf0_317:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_316:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 117 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_281:
+.Lf0_283:
+    .loc 1 104 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_282
+.Lf0_280:
+    addq $8, %rsp
+    .loc 1 120 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_323
+    .p2align 4,,10
+.Lf0_322:
+    .loc 1 121 9
+    movq $82, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_326
+    jmp .Lf0_325
+.Lf0_326:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_325:
+    cmpq $72, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_324
+    jmp .Lf0_320
+.Lf0_324:
+    .loc 1 122 9
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_330
+    jmp .Lf0_331
+.Lf0_330:
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_332
+.Lf0_331:
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_332:
+    cmpq $0, %rax
+    jne .Lf0_327
+    jmp .Lf0_328
+.Lf0_327:
+    movq $4, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_329
+.Lf0_328:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_334
+    jmp .Lf0_333
+.Lf0_334:
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_333:
+    push %rax
+    movslq -340(%rbp), %rax
+    subq $76, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_329:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 124 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 125 13
+    jmp .Lf0_338
+    .p2align 4,,10
+.Lf0_337:
+    .loc 1 126 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_339
+    jmp .Lf0_340
+.Lf0_339:
+    movslq -40(%rbp), %rax
+    jmp .Lf0_341
+.Lf0_340:
+    movslq -344(%rbp), %rax
+.Lf0_341:
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    movq $61, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_343
+    jmp .Lf0_342
+.Lf0_343:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_345
+    jmp .Lf0_344
+.Lf0_345:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_344:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_342:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 127 17
+    movslq -56(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_347
+    jmp .Lf0_346
+.Lf0_347:
+    movq $3, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_346:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 128 17
+    movq $2, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_349
+    jmp .Lf0_348
+.Lf0_349:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_348:
+    push %rax
+    movq $66, %rax
+    subq $7, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 129 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_336:
+.Lf0_338:
+    .loc 1 125 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_337
+.Lf0_335:
+    addq $0, %rsp
+    .loc 1 132 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_350
+    jmp .Lf0_351
+.Lf0_350:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf0_352
+.Lf0_351:
+    movslq -16(%rbp), %rax
+.Lf0_352:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_353
+    jmp .Lf0_354
+.Lf0_353:
+    movq $5, %rax
+    jmp .Lf0_355
+.Lf0_354:
+    movslq -4(%rbp), %rax
+.Lf0_355:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_357
+    jmp .Lf0_356
+.Lf0_357:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_358
+    jmp .Lf0_359
+.Lf0_358:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_360
+.Lf0_359:
+    movslq -12(%rbp), %rax
+.Lf0_360:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_356:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_321:
+    .loc 1 120 32
+    incl -340(%rbp)
+.Lf0_323:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_322
+.Lf0_320:
+    addq $8, %rsp
+    .loc 1 135 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 136 9
+    jmp .Lf0_364
+    .p2align 4,,10
+.Lf0_363:
+    .loc 1 137 13
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $32, %rax
+    movq $0, %rax
+    setge %al
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_365
+    jmp .Lf0_361
+.Lf0_365:
+    .loc 1 138 13
+    movq $65, %rax
+    subl -80(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $8, %rax
+    cmpq $0, %rax
+    jne .Lf0_366
+    jmp .Lf0_367
+.Lf0_366:
+    movq $66, %rax
+    jmp .Lf0_368
+.Lf0_367:
+    movslq -8(%rbp), %rax
+.Lf0_368:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 139 13
+    movslq -60(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_369
+    jmp .Lf0_370
+.Lf0_369:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_372
+    jmp .Lf0_373
+.Lf0_372:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf0_374
+.Lf0_373:
+    movslq -4(%rbp), %rax
+.Lf0_374:
+    jmp .Lf0_371
+.Lf0_370:
+    movq $67, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_371:
+    push %rax
+    movq $55, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    jne .Lf0_375
+    jmp .Lf0_376
+.Lf0_375:
+    movq $93, %rax
+    jmp .Lf0_377
+.Lf0_376:
+    movslq -16(%rbp), %rax
+.Lf0_377:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 141 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 142 17
+    .p2align 4,,10
+.Lf0_380:
+    .loc 1 143 21
+    movslq -52(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $82, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_381
+    jmp .Lf0_378
+.Lf0_381:
+    .loc 1 144 21
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_382
+    jmp .Lf0_383
+.Lf0_382:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_384
+.Lf0_383:
+    movslq -344(%rbp), %rax
+.Lf0_384:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_385
+    jmp .Lf0_386
+.Lf0_385:
+    movslq -60(%rbp), %rax
+    jmp .Lf0_387
+.Lf0_386:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+.Lf0_387:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 145 21
+    movq $5, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 146 21
+    movslq -340(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_389
+    jmp .Lf0_388
+.Lf0_389:
+    movq $26, %rax
+    cmpq $0, %rax
+    jne .Lf0_390
+    jmp .Lf0_391
+.Lf0_390:
+    movq $28, %rax
+    jmp .Lf0_392
+.Lf0_391:
+    movq $1, %rax
+.Lf0_392:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_388:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 147 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_379:
+    .loc 1 148 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_380
+.Lf0_378:
+    addq $0, %rsp
+    .loc 1 150 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_362:
+.Lf0_364:
+    .loc 1 136 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_363
+.Lf0_361:
+    addq $8, %rsp
+    .loc 1 153 5
+    movq $7, %rax
+    push %rax
+    movq $81, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_394
+    jmp .Lf0_393
+.Lf0_394:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_393:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_396
+    jmp .Lf0_395
+.Lf0_396:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_400
+    jmp .Lf0_401
+.Lf0_400:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_402
+.Lf0_401:
+    movq $8, %rax
+.Lf0_402:
+    cmpq $0, %rax
+    jne .Lf0_397
+    jmp .Lf0_398
+.Lf0_397:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_404
+    jmp .Lf0_403
+.Lf0_404:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_403:
+    jmp .Lf0_399
+.Lf0_398:
+    movslq -12(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_399:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_395:
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 155 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 156 5
+    subq $8, %rsp
+    movq $32, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 157 5
+    movq $93, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 158 5
+    subq $8, %rsp
+    movq $12, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 159 5
+    movq $68, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 160 5
+    subq $64, %rsp
+    .loc 1 161 5
+    subq $256, %rsp
+    .loc 1 163 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 164 9
+    jmp .Lf1_4
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 165 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_6
+    jmp .Lf1_7
+.Lf1_6:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_8
+.Lf1_7:
+    movslq -16(%rbp), %rax
+.Lf1_8:
+    cmpq $63, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_5
+    jmp .Lf1_1
+.Lf1_5:
+    .loc 1 166 13
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_10
+    jmp .Lf1_9
+.Lf1_10:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_9:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 167 13
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf1_11
+    jmp .Lf1_12
+.Lf1_11:
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_13
+.Lf1_12:
+    movq $59, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $59, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf1_13:
+    movl %eax, -68(%rbp)
+    .loc 1 168 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_19
+    .p2align 4,,10
+.Lf1_18:
+    .loc 1 169 17
+    movq $3, %rax
+    cmpq $0, %rax
+    jne .Lf1_21
+    jmp .Lf1_22
+.Lf1_21:
+    movslq -60(%rbp), %rax
+    jmp .Lf1_23
+.Lf1_22:
+    movslq -344(%rbp), %rax
+.Lf1_23:
+    cmpq $74, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_20
+    jmp .Lf1_16
+.Lf1_20:
+    .loc 1 170 17
+    movq $63, %rax
+    addq $3, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $68, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    cmpq $43, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 171 17
+    movslq -20(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_28
+    jmp .Lf1_27
+.Lf1_28:
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_27:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_24
+    jmp .Lf1_25
+.Lf1_24:
+    movq $18, %rax
+    cmpq $0, %rax
+    jne .Lf1_29
+    jmp .Lf1_30
+.Lf1_29:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf1_31
+.Lf1_30:
+    movslq -340(%rbp), %rax
+.Lf1_31:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_33
+    jmp .Lf1_32
+.Lf1_33:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_32:
+    jmp .Lf1_26
+.Lf1_25:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_34
+    jmp .Lf1_35
+.Lf1_34:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf1_36
+.Lf1_35:
+    movslq -12(%rbp), %rax
+.Lf1_36:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_26:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 172 17
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_38
+    jmp .Lf1_37
+.Lf1_38:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_37:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_17:
+    .loc 1 168 38
+    incl -344(%rbp)
+.Lf1_19:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_18
+.Lf1_16:
+    addq $0, %rsp
+    .loc 1 174 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+.Lf1_4:
+    .loc 1 164 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 177 5
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_41
+    jmp .Lf1_40
+.Lf1_41:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_42
+    jmp .Lf1_43
+.Lf1_42:
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    jmp .Lf1_44
+.Lf1_43:
+    movslq -60(%rbp), %rax
+.Lf1_44:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_40:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_45
+    .loc 1 178 9
+    movq $9, %rax
+    push %rax
+    movq $42, %rax
+    cmpq $0, %rax
+    jne .Lf1_46
+    jmp .Lf1_47
+.Lf1_46:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_48
+.Lf1_47:
+    movslq -4(%rbp), %rax
+.Lf1_48:
+    push %rax
+    movq $77, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 179 9
+    cmpl $8, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 180 9
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_49
+    jmp .Lf1_50
+.Lf1_49:
+    movq $59, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_53
+    jmp .Lf1_52
+.Lf1_53:
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_52:
+    jmp .Lf1_51
+.Lf1_50:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_51:
+    push %rax
+    cmpl $89, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_55
+    jmp .Lf1_54
+.Lf1_55:
+    movq $64, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_57
+    jmp .Lf1_56
+.Lf1_57:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_56:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_54:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_39
+.Lf1_45:
+    .loc 1 182 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $87, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_58
+    jmp .Lf1_59
+.Lf1_58:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_62
+    jmp .Lf1_61
+.Lf1_62:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_61:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_63
+    jmp .Lf1_64
+.Lf1_63:
+    movq $94, %rax
+    jmp .Lf1_65
+.Lf1_64:
+    movslq -16(%rbp), %rax
+.Lf1_65:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_60
+.Lf1_59:
+    movq $4, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_60:
+    movl %eax, -12(%rbp)
+    .loc 1 183 9
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    subq $17, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $51, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_66
+    jmp .Lf1_67
+.Lf1_66:
+    movq $97, %rax
+    jmp .Lf1_68
+.Lf1_67:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf1_68:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 184 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_69
+    jmp .Lf1_70
+.Lf1_69:
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_72
+    jmp .Lf1_73
+.Lf1_72:
+    movq $33, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_74
+.Lf1_73:
+    movslq -16(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_74:
+    jmp .Lf1_71
+.Lf1_70:
+    movq $41, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_75
+    jmp .Lf1_76
+.Lf1_75:
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf1_78
+    jmp .Lf1_79
+.Lf1_78:
+    movq $38, %rax
+    jmp .Lf1_80
+.Lf1_79:
+    movq $25, %rax
+.Lf1_80:
+    jmp .Lf1_77
+.Lf1_76:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_81
+    jmp .Lf1_82
+.Lf1_81:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_83
+.Lf1_82:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+.Lf1_83:
+.Lf1_77:
+.Lf1_71:
+    movl %eax, -28(%rbp)
+    addq $0, %rsp
+.Lf1_39:
+    .loc 1 186 5
+    cmpl $6, -52(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_85
+.Lf1_84:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_86
+.Lf1_85:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_87
+    jmp .Lf1_88
+.Lf1_87:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_89
+.Lf1_88:
+    movslq -8(%rbp), %rax
+.Lf1_89:
+.Lf1_86:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_90
+    jmp .Lf1_91
+.Lf1_90:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_92
+.Lf1_91:
+    movq $62, %rax
+.Lf1_92:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_94
+    jmp .Lf1_93
+.Lf1_94:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_96
+    jmp .Lf1_95
+.Lf1_96:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_95:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_93:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    .loc 1 187 5
+    movq $6, %rax
+    subq $81, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_98
+    jmp .Lf1_97
+.Lf1_98:
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_97:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_99
+    jmp .Lf1_100
+.Lf1_99:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_101
+.Lf1_100:
+    movq $22, %rax
+.Lf1_101:
+    push %rax
+    movq $99, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 188 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_107
+    .p2align 4,,10
+.Lf1_106:
+    .loc 1 190 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 191 13
+    jmp .Lf1_111
+    .p2align 4,,10
+.Lf1_110:
+    .loc 1 192 17
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_112
+    jmp .Lf1_108
+.Lf1_112:
+    .loc 1 193 17
+    movq $7, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $99, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_113
+    jmp .Lf1_114
+.Lf1_113:
+    movq $32, %rax
+    jmp .Lf1_115
+.Lf1_114:
+    movq $90, %rax
+.Lf1_115:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_117
+    jmp .Lf1_116
+.Lf1_117:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_119
+    jmp .Lf1_118
+.Lf1_119:
+    movq $98, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_118:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_116:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 194 17
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_124
+    jmp .Lf1_123
+.Lf1_124:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_123:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_126
+    jmp .Lf1_125
+.Lf1_126:
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_125:
+    cmpq $0, %rax
+    jne .Lf1_120
+    jmp .Lf1_121
+.Lf1_120:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_127
+    jmp .Lf1_128
+.Lf1_127:
+    movq $47, %rax
+    jmp .Lf1_129
+.Lf1_128:
+    movslq -340(%rbp), %rax
+.Lf1_129:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_122
+.Lf1_121:
+    movq $9, %rax
+    push %rax
+    movq $28, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_122:
+    movl %eax, -8(%rbp)
+    .loc 1 195 17
+    movq $3, %rax
+    push %rax
+    movq $62, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_130
+    jmp .Lf1_131
+.Lf1_130:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_132
+.Lf1_131:
+    cmpl $0, -340(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_132:
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_133
+    jmp .Lf1_134
+.Lf1_133:
+    cmpl $15, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_135
+.Lf1_134:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf1_135:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 196 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_109:
+.Lf1_111:
+    .loc 1 191 20
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_110
+.Lf1_108:
+    addq $0, %rsp
+    .loc 1 199 9
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $70, %rax
+    cmpq $0, %rax
+    jne .Lf1_136
+    jmp .Lf1_137
+.Lf1_136:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_138
+.Lf1_137:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf1_138:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $60, %rax
+    cmpq $0, %rax
+    jne .Lf1_139
+    jmp .Lf1_140
+.Lf1_139:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_141
+.Lf1_140:
+    movslq -8(%rbp), %rax
+.Lf1_141:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 200 9
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_105:
+    .loc 1 188 30
+    incl -340(%rbp)
+.Lf1_107:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_106
+.Lf1_104:
+    addq $8, %rsp
+    .loc 1 203 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 204 9
+    jmp .Lf1_145
+    .p2align 4,,10
+.Lf1_144:
+    .loc 1 205 13
+    movq $90, %rax
+    cmpq $0, %rax
+    jne .Lf1_147
+    jmp .Lf1_148
+.Lf1_147:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf1_149
+.Lf1_148:
+    movslq -12(%rbp), %rax
+.Lf1_149:
+    cmpq $81, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_146
+    jmp .Lf1_142
+.Lf1_146:
+    .loc 1 206 13
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $38, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $68, -64(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_150
+    jmp .Lf1_151
+.Lf1_150:
+    movq $53, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_152
+.Lf1_151:
+    movq $72, %rax
+    cmpq $10, %rax
+    movq $0, %rax
+    sete %al
+.Lf1_152:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -4(%rbp)
+    .loc 1 207 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 208 17
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_159
+    jmp .Lf1_158
+.Lf1_159:
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $93, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_158:
+    movl %eax, -16(%rbp)
+    .loc 1 209 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_161
+.Lf1_160:
+    movq $94, %rax
+    jmp .Lf1_162
+.Lf1_161:
+    movslq -16(%rbp), %rax
+.Lf1_162:
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_164
+    jmp .Lf1_163
+.Lf1_164:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_163:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -80(%rbp)
+    .loc 1 210 17
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -72(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $7, -36(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_157:
+    .loc 1 207 38
+    incl -344(%rbp)
+    .loc 1 208 17
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_168
+    jmp .Lf1_167
+.Lf1_168:
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $93, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_167:
+    movl %eax, -16(%rbp)
+    .loc 1 209 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_169
+    jmp .Lf1_170
+.Lf1_169:
+    movq $94, %rax
+    jmp .Lf1_171
+.Lf1_170:
+    movslq -16(%rbp), %rax
+.Lf1_171:
+    push %rax
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $75, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_173
+    jmp .Lf1_172
+.Lf1_173:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_172:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -80(%rbp)
+    .loc 1 210 17
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_175
+    jmp .Lf1_174
+.Lf1_175:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_174:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -72(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $7, -36(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_156:
+    .loc 1 207 38
+    incl -344(%rbp)
+.Lf1_155:
+    addq $0, %rsp
+    .loc 1 212 13
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 213 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_143:
+.Lf1_145:
+    .loc 1 204 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_144
+.Lf1_142:
+    addq $8, %rsp
+    .loc 1 217 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 218 9
+    .p2align 4,,10
+.Lf1_178:
+    .loc 1 219 13
+    movq $9, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 220 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_184
+    .p2align 4,,10
+.Lf1_183:
+    .loc 1 221 17
+    movq $75, %rax
+    cmpq $45, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_185
+    jmp .Lf1_181
+.Lf1_185:
+    .loc 1 222 17
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_190
+    jmp .Lf1_189
+.Lf1_190:
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_189:
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_187
+.Lf1_186:
+    movslq -32(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_192
+    jmp .Lf1_191
+.Lf1_192:
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_191:
+    jmp .Lf1_188
+.Lf1_187:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_193
+    jmp .Lf1_194
+.Lf1_193:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_195
+.Lf1_194:
+    movslq -4(%rbp), %rax
+.Lf1_195:
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf1_188:
+    movl %eax, -4(%rbp)
+    .loc 1 223 17
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_197
+    jmp .Lf1_196
+.Lf1_197:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_196:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $28, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $30, %rax
+    imulq $87, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 224 17
+    movslq -344(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_199
+.Lf1_198:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_202
+    jmp .Lf1_201
+.Lf1_202:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_201:
+    jmp .Lf1_200
+.Lf1_199:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_204
+    jmp .Lf1_203
+.Lf1_204:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_203:
+.Lf1_200:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_182:
+    .loc 1 220 38
+    incl -344(%rbp)
+.Lf1_184:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_183
+.Lf1_181:
+    addq $0, %rsp
+    .loc 1 226 13
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $73, %rax
+    subq $38, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 227 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_177:
+    .loc 1 228 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_178
+.Lf1_176:
+    addq $8, %rsp
+    .loc 1 230 5
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $19, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_206
+    jmp .Lf1_207
+.Lf1_206:
+    movslq -72(%rbp), %rax
+    jmp .Lf1_208
+.Lf1_207:
+    movq $82, %rax
+.Lf1_208:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_209
+    .loc 1 231 9
+    movq $4, %rax
+    push %rax
+    movq $70, %rax
+    cmpq $61, %rax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_210
+    jmp .Lf1_211
+.Lf1_210:
+    movq $90, %rax
+    jmp .Lf1_212
+.Lf1_211:
+    movslq -8(%rbp), %rax
+.Lf1_212:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 232 9
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_213
+    jmp .Lf1_214
+.Lf1_213:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_215
+.Lf1_214:
+    movslq -12(%rbp), %rax
+.Lf1_215:
+    push %rax
+    movq $13, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 233 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_217
+.Lf1_216:
+    movq $35, %rax
+    jmp .Lf1_218
+.Lf1_217:
+    movslq -4(%rbp), %rax
+.Lf1_218:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_219
+    jmp .Lf1_220
+.Lf1_219:
+    movslq -32(%rbp), %rax
+    jmp .Lf1_221
+.Lf1_220:
+    movslq -8(%rbp), %rax
+.Lf1_221:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_223
+    jmp .Lf1_222
+.Lf1_223:
+    movq $62, %rax
+    cmpq $0, %rax
+    jne .Lf1_224
+    jmp .Lf1_225
+.Lf1_224:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_226
+.Lf1_225:
+    movslq -68(%rbp), %rax
+.Lf1_226:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_222:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+    jmp .Lf1_205
+.Lf1_209:
+    .loc 1 235 9
+    movslq -16(%rbp), %rax
+    subq $19, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf1_227
+    jmp .Lf1_228
+.Lf1_227:
+    movq $47, %rax
+    jmp .Lf1_229
+.Lf1_228:
+    movslq -4(%rbp), %rax
+.Lf1_229:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 28(%rax)
+    movq %rdx, %rax
+    .loc 1 236 9
+    movq $3, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $51, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_230
+    jmp .Lf1_231
+.Lf1_230:
+    movslq -44(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_232
+.Lf1_231:
+    cmpl $84, -4(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_232:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 237 9
+    movq $45, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    imull -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $92, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_205:
+    .loc 1 239 5
+    movq $1, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $74, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 240 5
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $33, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $47, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $32, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lf1_234
+    .loc 1 241 9
+    movq $6, %rax
+    push %rax
+    movq $77, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_236
+    jmp .Lf1_235
+.Lf1_236:
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_235:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_238
+    jmp .Lf1_237
+.Lf1_238:
+    movslq -68(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_237:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 242 9
+    movq $49, %rax
+    cmpq $56, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 243 9
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imulq $11, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_233
+.Lf1_234:
+    .loc 1 245 9
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_239
+    jmp .Lf1_240
+.Lf1_239:
+    movq $28, %rax
+    jmp .Lf1_241
+.Lf1_240:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf1_241:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_242
+    jmp .Lf1_243
+.Lf1_242:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf1_244
+.Lf1_243:
+    movq $90, %rax
+.Lf1_244:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 246 9
+    movq $91, %rax
+    imulq $51, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    addq $93, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 247 9
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    imulq $98, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $76, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_245
+    jmp .Lf1_246
+.Lf1_245:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_249
+    jmp .Lf1_248
+.Lf1_249:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_248:
+    jmp .Lf1_247
+.Lf1_246:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_251
+    jmp .Lf1_250
+.Lf1_251:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_250:
+.Lf1_247:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_233:
+    .loc 1 249 5
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_252
+    jmp .Lf1_253
+.Lf1_252:
+    movslq -76(%rbp), %rax
+    jmp .Lf1_254
+.Lf1_253:
+    movslq -8(%rbp), %rax
+.Lf1_254:
+    push %rax
+    cmpl $75, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 251 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 252 5
+    subq $8, %rsp
+    movq $19, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 253 5
+    movq $94, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 254 5
+    subq $8, %rsp
+    movq $53, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 255 5
+    movq $9, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 256 5
+    subq $64, %rsp
+    .loc 1 257 5
+    subq $256, %rsp
+    .loc 1 258 5
+    movq $66, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $24, %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $91, %rax
+    cmpq $4, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 259 5
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_3
+    jmp .Lf2_2
+.Lf2_3:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_2:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_5
+    jmp .Lf2_4
+.Lf2_5:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_4:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $49, %rax
+    imulq $99, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_6
+    .loc 1 260 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_7
+    jmp .Lf2_8
+.Lf2_7:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_9
+.Lf2_8:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf2_9:
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $39, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $52, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 261 9
+    movq $24, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_10
+    jmp .Lf2_11
+.Lf2_10:
+    cmpl $35, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_12
+.Lf2_11:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_14
+    jmp .Lf2_13
+.Lf2_14:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_13:
+.Lf2_12:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_16
+    jmp .Lf2_15
+.Lf2_16:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_18
+    jmp .Lf2_17
+.Lf2_18:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_17:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_15:
+    movl %eax, -8(%rbp)
+    .loc 1 262 9
+    movq $4, %rax
+    push %rax
+    movq $54, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_19
+    jmp .Lf2_20
+.Lf2_19:
+    movq $75, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_21
+.Lf2_20:
+    movq $52, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_21:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_1
+.Lf2_6:
+    .loc 1 264 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_25
+    jmp .Lf2_26
+.Lf2_25:
+    movslq -24(%rbp), %rax
+    jmp .Lf2_27
+.Lf2_26:
+    movslq -12(%rbp), %rax
+.Lf2_27:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_22
+    jmp .Lf2_23
+.Lf2_22:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_28
+    jmp .Lf2_29
+.Lf2_28:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf2_30
+.Lf2_29:
+    movslq -12(%rbp), %rax
+.Lf2_30:
+    push %rax
+    movq $5, %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_24
+.Lf2_23:
+    movq $62, %rax
+    addl -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $6, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+.Lf2_24:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 265 9
+    movslq -20(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_31
+    jmp .Lf2_32
+.Lf2_31:
+    movslq -12(%rbp), %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_33
+.Lf2_32:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $67, %rax
+    movq $0, %rax
+    setge %al
+.Lf2_33:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_34
+    jmp .Lf2_35
+.Lf2_34:
+    movq $92, %rax
+    jmp .Lf2_36
+.Lf2_35:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+.Lf2_36:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_38
+    jmp .Lf2_37
+.Lf2_38:
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_37:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -32(%rbp)
+    .loc 1 266 9
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_40
+    jmp .Lf2_39
+.Lf2_40:
+    movq $11, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_39:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    addq $0, %rsp
+.Lf2_1:
+    .loc 1 268 5
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_42
+    jmp .Lf2_41
+.Lf2_42:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    addq $79, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_41:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 270 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 271 9
+    jmp .Lf2_46
+    .p2align 4,,10
+.Lf2_45:
+    .loc 1 272 13
+    movslq -60(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $58, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_47
+    jmp .Lf2_43
+.Lf2_47:
+    .loc 1 273 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_53
+    .p2align 4,,10
+.Lf2_52:
+    .loc 1 274 17
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_57
+    jmp .Lf2_58
+.Lf2_57:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_61
+    jmp .Lf2_60
+.Lf2_61:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_60:
+    jmp .Lf2_59
+.Lf2_58:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_59:
+    cmpq $0, %rax
+    jne .Lf2_54
+    jmp .Lf2_55
+.Lf2_54:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -32(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_56
+.Lf2_55:
+    movq $4, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_56:
+    movl %eax, -4(%rbp)
+    .loc 1 275 17
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_63
+    jmp .Lf2_62
+.Lf2_63:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_62:
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 0(%rax)
+    movq %rdx, %rax
+    .loc 1 276 17
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_64
+    jmp .Lf2_65
+.Lf2_64:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_66
+.Lf2_65:
+    movslq -12(%rbp), %rax
+.Lf2_66:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -76(%rbp), %rax
+    subq $50, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_68
+    jmp .Lf2_67
+.Lf2_68:
+    movq $7, %rax
+    push %rax
+    movq $65, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_67:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_51:
+    .loc 1 273 38
+    incl -344(%rbp)
+.Lf2_53:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_52
+.Lf2_50:
+    addq $0, %rsp
+    .loc 1 278 13
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $64, %rax
+    cmpq $0, %rax
+    jne .Lf2_69
+    jmp .Lf2_70
+.Lf2_69:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_71
+.Lf2_70:
+    movslq -16(%rbp), %rax
+.Lf2_71:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_72
+    jmp .Lf2_73
+.Lf2_72:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_74
+.Lf2_73:
+    movslq -16(%rbp), %rax
+.Lf2_74:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 279 13
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_75
+    jmp .Lf2_76
+.Lf2_75:
+    movslq -4(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_78
+    jmp .Lf2_79
+.Lf2_78:
+    movq $54, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_80
+.Lf2_79:
+    cmpl $14, -12(%rbp)
+    movq $0, %rax
+    setl %al
+.Lf2_80:
+    jmp .Lf2_77
+.Lf2_76:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_82
+    jmp .Lf2_81
+.Lf2_82:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_81:
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_83
+    jmp .Lf2_84
+.Lf2_83:
+    movq $45, %rax
+    jmp .Lf2_85
+.Lf2_84:
+    movslq -4(%rbp), %rax
+.Lf2_85:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf2_77:
+    movl %eax, -12(%rbp)
+    .loc 1 280 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_44:
+.Lf2_46:
+    .loc 1 271 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_45
+.Lf2_43:
+    addq $8, %rsp
+    .loc 1 283 5
+    movq $1, %rax
+    push %rax
+    movq $8, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $76, %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_87
+    .loc 1 284 9
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_89
+    jmp .Lf2_88
+.Lf2_89:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_88:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_91
+    jmp .Lf2_90
+.Lf2_91:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_90:
+    movl %eax, -24(%rbp)
+    .loc 1 285 9
+    movq $15, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_96
+    jmp .Lf2_95
+.Lf2_96:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_95:
+    cmpq $0, %rax
+    jne .Lf2_92
+    jmp .Lf2_93
+.Lf2_92:
+    movq $97, %rax
+    cmpq $0, %rax
+    jne .Lf2_97
+    jmp .Lf2_98
+.Lf2_97:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_99
+.Lf2_98:
+    movslq -8(%rbp), %rax
+.Lf2_99:
+    jmp .Lf2_94
+.Lf2_93:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf2_94:
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -8(%rbp)
+    .loc 1 286 9
+    movq $83, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_101
+    jmp .Lf2_100
+.Lf2_101:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_100:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_102
+    jmp .Lf2_103
+.Lf2_102:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_104
+.Lf2_103:
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+.Lf2_104:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -20(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_86
+.Lf2_87:
+    .loc 1 288 9
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $47, %rax
+    addl -28(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 289 9
+    movq $1, %rax
+    push %rax
+    movq $48, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $62, -76(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 290 9
+    movq $9, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_105
+    jmp .Lf2_106
+.Lf2_105:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_107
+.Lf2_106:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+.Lf2_107:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $97, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_86:
+    .loc 1 293 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 294 9
+    .p2align 4,,10
+.Lf2_110:
+    .loc 1 295 13
+    movq $7, %rax
+    push %rax
+    movq $46, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 296 13
+    movq $7, %rax
+    push %rax
+    movq $65, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_112
+    jmp .Lf2_111
+.Lf2_112:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_111:
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 298 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 299 17
+    .p2align 4,,10
+.Lf2_115:
+    .loc 1 300 21
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $98, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $49, %rax
+    addq $20, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_116
+    jmp .Lf2_117
+.Lf2_116:
+    movslq -8(%rbp), %rax
+    imulq $80, %rax
+    movslq %eax, %rax
+    jmp .Lf2_118
+.Lf2_117:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_119
+    jmp .Lf2_120
+.Lf2_119:
+    movslq -56(%rbp), %rax
+    jmp .Lf2_121
+.Lf2_120:
+    movq $89, %rax
+.Lf2_121:
+.Lf2_118:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 301 21
+    movslq -60(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $71, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 302 21
+    movq $46, %rax
+    cmpq $0, %rax
+    jne .Lf2_122
+    jmp .Lf2_123
+.Lf2_122:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_124
+.Lf2_123:
+    movq $80, %rax
+.Lf2_124:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_126
+    jmp .Lf2_125
+.Lf2_126:
+    movq $70, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_125:
+    movl %eax, -8(%rbp)
+    .loc 1 303 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_114:
+    .loc 1 304 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_115
+.Lf2_113:
+    addq $0, %rsp
+    .loc 1 306 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_109:
+    .loc 1 307 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_110
+.Lf2_108:
+    addq $8, %rsp
+    .loc 1 309 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_132
+    .p2align 4,,10
+.Lf2_131:
+    .loc 1 311 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 312 13
+    jmp .Lf2_136
+    .p2align 4,,10
+.Lf2_135:
+    .loc 1 313 17
+    movq $80, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $54, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 314 17
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_137
+    jmp .Lf2_138
+.Lf2_137:
+    movq $88, %rax
+    jmp .Lf2_139
+.Lf2_138:
+    movq $91, %rax
+.Lf2_139:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $52, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $79, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 315 17
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_141
+    jmp .Lf2_140
+.Lf2_141:
+    movq $2, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_140:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_143
+    jmp .Lf2_142
+.Lf2_143:
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_142:
+    push %rax
+    movslq -32(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $81, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 316 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_134:
+.Lf2_136:
+    .loc 1 312 20
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_135
+.Lf2_133:
+    addq $0, %rsp
+    .loc 1 319 9
+    movq $30, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_145
+    jmp .Lf2_144
+.Lf2_145:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_146
+    jmp .Lf2_147
+.Lf2_146:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_148
+.Lf2_147:
+    movslq -16(%rbp), %rax
+.Lf2_148:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_144:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_150
+    jmp .Lf2_149
+.Lf2_150:
+    movq $43, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf2_151
+    jmp .Lf2_152
+.Lf2_151:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_155
+    jmp .Lf2_154
+.Lf2_155:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_154:
+    jmp .Lf2_153
+.Lf2_152:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_153:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_149:
+    movl %eax, -16(%rbp)
+    .loc 1 320 9
+    movq $46, %rax
+    cmpq $0, %rax
+    jne .Lf2_156
+    jmp .Lf2_157
+.Lf2_156:
+    movslq -56(%rbp), %rax
+    jmp .Lf2_158
+.Lf2_157:
+    movq $8, %rax
+.Lf2_158:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_160
+    jmp .Lf2_159
+.Lf2_160:
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_159:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_165
+    jmp .Lf2_164
+.Lf2_165:
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_164:
+    cmpq $0, %rax
+    jne .Lf2_161
+    jmp .Lf2_162
+.Lf2_161:
+    movslq -4(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_163
+.Lf2_162:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_163:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 16(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_130:
+    .loc 1 309 30
+    incl -340(%rbp)
+.Lf2_132:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_131
+.Lf2_129:
+    addq $8, %rsp
+    .loc 1 322 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_171
+    .p2align 4,,10
+.Lf2_170:
+    .loc 1 323 9
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_174
+    jmp .Lf2_173
+.Lf2_174:
+    movq $80, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_173:
+    cmpq $58, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_172
+    jmp .Lf2_168
+.Lf2_172:
+    .loc 1 324 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_176
+    jmp .Lf2_175
+.Lf2_176:
+    movq $31, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_175:
+    push %rax
+    movq $12, %rax
+    cmpq $0, %rax
+    jne .Lf2_177
+    jmp .Lf2_178
+.Lf2_177:
+    movq $94, %rax
+    jmp .Lf2_179
+.Lf2_178:
+    movq $92, %rax
+.Lf2_179:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -80(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $71, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 325 9
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    movq $98, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_181
+    jmp .Lf2_180
+.Lf2_181:
+    movq $19, %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_180:
+    movl %eax, -12(%rbp)
+    .loc 1 327 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 328 13
+    jmp .Lf2_185
+    .p2align 4,,10
+.Lf2_184:
+    .loc 1 329 17
+    movq $4, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_187
+    jmp .Lf2_186
+.Lf2_187:
+    movq $78, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_186:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $21, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 330 17
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_188
+    jmp .Lf2_189
+.Lf2_188:
+    movq $6, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_190
+.Lf2_189:
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_190:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $30, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 331 17
+    movslq -344(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf2_191
+    jmp .Lf2_192
+.Lf2_191:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_193
+.Lf2_192:
+    movslq -340(%rbp), %rax
+.Lf2_193:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $62, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 332 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_183:
+.Lf2_185:
+    .loc 1 328 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_184
+.Lf2_182:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_169:
+    .loc 1 322 30
+    incl -340(%rbp)
+.Lf2_171:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_170
+.Lf2_168:
+    addq $8, %rsp
+    .loc 1 337 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 338 9
+    .p2align 4,,10
+.Lf2_196:
+    .loc 1 339 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_199
+    jmp .Lf2_198
+.Lf2_199:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_198:
+    cmpq $91, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_197
+    jmp .Lf2_194
+.Lf2_197:
+    .loc 1 340 13
+    movq $6, %rax
+    push %rax
+    movq $0, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $35, %rax
+    cmpq $0, %rax
+    jne .Lf2_200
+    jmp .Lf2_201
+.Lf2_200:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    jmp .Lf2_202
+.Lf2_201:
+    movslq -80(%rbp), %rax
+.Lf2_202:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $52, -16(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -340(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -76(%rbp)
+    .loc 1 341 13
+    movq $1, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_204
+    jmp .Lf2_203
+.Lf2_204:
+    movslq -12(%rbp), %rax
+    imulq $37, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_203:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 342 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_210
+    .p2align 4,,10
+.Lf2_209:
+    .loc 1 343 17
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_212
+    jmp .Lf2_211
+.Lf2_212:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $31, %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_211:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 344 17
+    movq $2, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_214
+    jmp .Lf2_213
+.Lf2_214:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_215
+    jmp .Lf2_216
+.Lf2_215:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_219
+    jmp .Lf2_218
+.Lf2_219:
+    movq $22, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_218:
+    jmp .Lf2_217
+.Lf2_216:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_221
+    jmp .Lf2_220
+.Lf2_221:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_220:
+.Lf2_217:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_213:
+    movl %eax, -12(%rbp)
+    .loc 1 345 17
+    movq $8, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_223
+    jmp .Lf2_222
+.Lf2_223:
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_222:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $51, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf2_208:
+    .loc 1 342 38
+    incl -344(%rbp)
+.Lf2_210:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_209
+.Lf2_207:
+    addq $0, %rsp
+    .loc 1 347 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_195:
+    .loc 1 348 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_196
+.Lf2_194:
+    addq $8, %rsp
+    .loc 1 351 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 352 9
+    jmp .Lf2_227
+    .p2align 4,,10
+.Lf2_226:
+    .loc 1 353 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_232
+    jmp .Lf2_231
+.Lf2_232:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_231:
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_234
+    jmp .Lf2_233
+.Lf2_234:
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_233:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_228
+    jmp .Lf2_229
+.Lf2_228:
+    movq $40, %rax
+    cmpq $0, %rax
+    jne .Lf2_235
+    jmp .Lf2_236
+.Lf2_235:
+    movq $65, %rax
+    jmp .Lf2_237
+.Lf2_236:
+    movslq -340(%rbp), %rax
+.Lf2_237:
+    push %rax
+    movq $32, %rax
+    cmpq $0, %rax
+    jne .Lf2_238
+    jmp .Lf2_239
+.Lf2_238:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_240
+.Lf2_239:
+    movq $54, %rax
+.Lf2_240:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_230
+.Lf2_229:
+    movq $1, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $88, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf2_230:
+    movl %eax, -12(%rbp)
+    .loc 1 354 13
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_241
+    jmp .Lf2_242
+.Lf2_241:
+    movq $32, %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $32, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_245
+    jmp .Lf2_244
+.Lf2_245:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_244:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_243
+.Lf2_242:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_247
+    jmp .Lf2_246
+.Lf2_247:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_246:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_248
+    jmp .Lf2_249
+.Lf2_248:
+    movq $12, %rax
+    jmp .Lf2_250
+.Lf2_249:
+    movq $70, %rax
+.Lf2_250:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_243:
+    movl %eax, -4(%rbp)
+    .loc 1 356 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 357 17
+    .p2align 4,,10
+.Lf2_253:
+    .loc 1 358 21
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_255
+    jmp .Lf2_254
+.Lf2_255:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_254:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_257
+    jmp .Lf2_256
+.Lf2_257:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_256:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 359 21
+    movslq -344(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $31, %rax
+    cmpq $0, %rax
+    jne .Lf2_258
+    jmp .Lf2_259
+.Lf2_258:
+    movq $88, %rax
+    jmp .Lf2_260
+.Lf2_259:
+    movslq -344(%rbp), %rax
+.Lf2_260:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_262
+    jmp .Lf2_261
+.Lf2_262:
+    cmpl $82, -52(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_261:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 360 21
+    movq $40, %rax
+    cmpq $78, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $54, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_264
+    jmp .Lf2_263
+.Lf2_264:
+    movq $78, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_263:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_266
+    jmp .Lf2_265
+.Lf2_266:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_265:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 361 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_252:
+    .loc 1 362 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_253
+.Lf2_251:
+    addq $0, %rsp
+    .loc 1 364 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_225:
+.Lf2_227:
+    .loc 1 352 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_226
+.Lf2_224:
+    addq $8, %rsp
+    .loc 1 367 5
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
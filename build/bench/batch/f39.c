@@ -0,0 +1,483 @@
+int f0() {
+    int v0 = 38;
+    int v1 = 3;
+    int v2 = 35;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v3 * 37) % 5) == ((v2 - 20) == (v1 / 4)));
+                    v1 = (((89 == v0) >= (i0 / 9)) % 5);
+                    v2 = (((i0 / 7) / 8) * ((v1 % 7) > (a0[9] < i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((73 - 23) || (a0[14] ? a0[8] : 17)) >= ((1 != 78) + (v2 > i0)));
+            v2 = (((i0 >= v0) ? (i0 > v3) : (v1 * 7)) * ((a1[3][10] <= v1) + (a1[2][0] && a1[3][8])));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 <= v0) >= (9 > v1)) == ((i2 >= a0[13]) - (v2 % 5)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((75 ? i2 : v0) || (66 <= i3)) ? ((97 * a0[10]) >= (36 && a0[9])) : ((v1 ? 35 : i2) || (a0[9] <= v3)));
+                    a0[1] = (((v0 < 27) % 3) * ((25 % 2) / 9));
+                    v2 = (((v2 || 62) < (8 != v1)) ? ((72 == a0[13]) / 1) : ((v1 - v2) && (i3 - v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            a1[2][15] = (((v1 >= v2) - (12 == 75)) ? ((a1[0][4] >= a0[1]) ? (v1 / 6) : (a0[9] + i2)) : ((a1[3][12] != i2) / 7));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                if ((v1 / 5) > 95) break;
+                v2 = (((i4 && a1[3][7]) <= (a0[12] - a0[7])) != ((25 || 97) / 9));
+                a1[1][8] = (((1 ? 49 : v0) / 9) >= ((a0[1] * a0[4]) - (v1 >= 51)));
+                v2 = (((v1 ? i4 : v1) == (5 <= i4)) <= ((v3 || a0[14]) ? (a1[1][4] + v3) : (v2 * 96)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        a0[4] = (((v3 ? a1[0][11] : v2) > (a1[3][12] / 5)) || ((a1[3][3] / 1) && (v1 && i4)));
+        v1 = (((v1 < a0[9]) * (a1[1][13] % 7)) % 6);
+    }
+    v1 = (((v3 < v0) / 6) - ((63 >= a0[15]) > (v1 || v2)));
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v2 = (((96 % 1) || (a1[0][15] != a1[3][11])) * ((v2 != v2) * (v2 <= v3)));
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((v1 >= i6) > 59) break;
+                a1[0][12] = (((48 / 9) > (77 / 4)) / 4);
+                a1[3][13] = (((v3 == v3) && (97 < 70)) + ((53 - 62) <= (v2 != 13)));
+                a1[2][3] = (((v2 ? a1[2][9] : i7) / 6) + ((v2 <= v2) || (a0[8] > a1[2][8])));
+            }
+            a1[1][12] = (((a0[2] && v3) == (30 < v3)) > ((a1[0][0] == 29) == (a0[5] * i6)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                if ((a1[2][6] > v2) > 65) break;
+                v1 = (((v2 ? v0 : v2) % 6) < ((44 >= a1[2][8]) >= (97 != v1)));
+                v0 = (((i9 % 2) / 2) / 3);
+                a1[3][6] = (((v3 <= 40) && (v0 < v0)) || ((v0 >= v1) ? (v2 + v2) : (v0 || 55)));
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+        a1[2][12] = (((v1 % 9) < (a0[2] >= a1[0][2])) - ((97 * v1) - (v2 >= 70)));
+        v1 = (((81 / 7) != (v0 > v2)) <= ((a1[0][6] - a0[3]) - (v0 ? a1[3][6] : v2)));
+    }
+    if ((((v0 ? v1 : v2) - (v2 % 1)) > ((70 < v2) >= (a0[1] * 93)))) {
+        a1[0][5] = (((46 < v3) + (a0[10] ? 79 : 37)) != ((v1 ? a0[9] : a0[11]) >= (84 ? 60 : v2)));
+        a0[14] = (((20 >= v3) - (a1[2][7] ? v1 : 14)) >= ((v0 ? 8 : 34) == (a1[2][13] && v1)));
+        v1 = (((v0 < 30) >= (v1 > a0[9])) <= ((80 > a0[13]) / 7));
+    } else {
+        v3 = (((v1 <= a1[3][10]) != (v2 < v0)) == ((v2 + 56) >= (v0 / 5)));
+        v0 = (((v2 * 58) / 1) > ((v0 * a1[2][15]) % 3));
+        a1[1][14] = (((v0 ? a0[3] : 82) + (v3 - v0)) % 8);
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((20 == v3) > 92) break;
+            a1[3][2] = (((a1[2][13] + a0[11]) && (v2 * 11)) >= ((46 / 5) == (a1[3][0] != 28)));
+            a0[14] = (((a1[3][6] == 96) == (a0[13] || a1[2][12])) && ((v2 < 33) <= (v3 == 96)));
+            for (int i11 = 0; i11 < 7; i11 = i11 + 1) {
+                a0[1] = (((a1[2][13] ? v2 : 43) >= (i11 > v3)) <= ((v1 ? a1[1][14] : 93) != (v1 * a1[3][5])));
+                a0[11] = (((v0 ? 77 : i11) + (a0[13] == i11)) % 3);
+                v3 = (((i10 + a0[5]) ? (i11 > v0) : (29 ? v0 : a0[6])) >= ((v3 / 9) > (v2 && a1[1][0])));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 4);
+    }
+    {
+        int i12 = 0;
+        while (i12 < 7) {
+            {
+                int i13 = 0;
+                while (i13 < 7) {
+                    a0[6] = (((a1[1][8] < 77) / 8) != ((v0 % 5) + (a0[8] >= a1[1][2])));
+                    v2 = (((v1 != a0[13]) - (19 ? 75 : i13)) != ((a0[3] / 5) / 6));
+                    a1[1][10] = (((v0 >= v1) > (v0 && v1)) >= ((v3 < v2) + (a0[0] > i12)));
+                    i13 = i13 + 1;
+                }
+            }
+            v1 = (((v1 - 46) * (v3 < i12)) ? ((a0[8] == a0[5]) + (a1[2][10] % 9)) : ((6 * v0) == (i12 + 84)));
+            a1[1][9] = (((a1[1][0] <= a0[11]) + (83 + v0)) / 1);
+            i12 = i12 + 1;
+        }
+    }
+    if ((((v2 * 0) && (a1[0][8] == v2)) % 6)) {
+        v2 = (((56 && v0) > (a1[1][12] || v1)) <= ((7 == 15) ? (v0 >= a1[2][2]) : (36 || a0[8])));
+        v3 = (((v0 != v3) ? (v1 ? 9 : v3) : (v0 % 3)) / 3);
+        v0 = (((v0 ? 21 : v3) < (80 <= v2)) > ((a0[3] ? v1 : a0[4]) ? (75 <= a1[2][11]) : (v1 / 8)));
+    } else {
+        v2 = (((v0 + v3) * (v2 == a0[13])) % 7);
+        v3 = (((56 ? v0 : v2) != (v1 > a0[2])) < ((v0 != v2) ? (v2 >= v1) : (17 == a0[6])));
+        a1[0][6] = (((v3 == a0[0]) > (v2 == v0)) > ((28 != 91) && (v3 == v2)));
+    }
+    return (((v2 % 3) && (v1 && 34)) > ((v3 == v1) < (59 > v2)));
+}
+int f1() {
+    int v0 = 41;
+    int v1 = 62;
+    int v2 = 23;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 <= 26) > (v1 % 5)) % 3);
+    v2 = (((a1[1][13] ? v2 : 86) > (46 < v0)) / 6);
+    if ((((v0 || 78) * (v2 >= v2)) * ((a0[14] == v2) || (21 + v0)))) {
+        v1 = (((v0 / 9) + (v0 / 2)) + ((a0[15] != 17) ? (v0 + a0[6]) : (51 || a0[3])));
+        v2 = (((a0[4] / 6) > (a0[8] > v1)) ? ((a0[5] - v0) == (v2 / 2)) : ((17 * v2) >= (v2 > 75)));
+        v3 = (((v0 + v1) ? (a1[1][5] + 59) : (91 >= v0)) * ((v3 && a0[4]) ? (v1 || v0) : (v3 >= v2)));
+    } else {
+        a1[0][9] = (((v0 / 2) * (v0 * v1)) <= ((a1[1][4] > 94) + (a0[1] || a0[14])));
+        v1 = (((v0 - v0) < (a0[14] + v1)) + ((a0[9] ? v2 : v2) + (98 / 9)));
+        v0 = (((v0 == 48) >= (50 != v0)) && ((40 - 84) == (96 || 66)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[10] = (((v1 ? v0 : a1[1][13]) && (a0[9] <= v0)) ? ((v2 / 8) ? (v2 > v0) : (v0 <= 49)) : ((12 > v3) / 1));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a1[3][15] = (((37 * v1) - (v0 != i0)) * ((97 && 73) - (i0 ? 22 : 64)));
+                    v0 = (((v3 % 4) * (i0 != v1)) % 9);
+                    v3 = (((68 >= i1) * (i1 * v0)) <= ((a0[0] != v0) != (65 <= a1[2][11])));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v0 || 51) / 9) && ((a1[0][3] != a0[6]) >= (32 / 9)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((i3 && a1[2][7]) ? (a1[1][5] == i3) : (a1[3][10] != 16)) / 3);
+                    a0[0] = (((v2 ? v3 : a0[1]) % 5) || ((v1 ? a0[14] : 86) && (v1 < 89)));
+                    a1[2][6] = (((a1[0][15] == i2) / 9) || ((a1[2][7] <= i2) || (i3 * a1[2][12])));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v2 * i2) != (v3 - v3)) <= ((a0[1] >= v0) ? (25 || 14) : (a0[9] > 83)));
+            v0 = (((41 != v2) || (v0 * v1)) <= ((a1[1][0] && a0[15]) < (79 >= a0[3])));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            if ((v0 != 53) > 60) break;
+            v3 = (((i4 && v1) != (v1 + 7)) < ((v2 / 5) != (v1 * 73)));
+            v3 = (((v3 < a0[7]) ? (51 > v3) : (v0 != a0[6])) / 3);
+            a0[10] = (((v3 + 4) > (v1 > i4)) != ((v2 >= a1[3][10]) >= (0 < i4)));
+        }
+        v0 = (((22 / 2) == (a1[2][3] != 99)) / 2);
+        v3 = (((v2 * 79) != (v3 % 8)) - ((v0 % 7) * (95 - 93)));
+    }
+    if ((((v1 + 71) >= (73 ? v2 : 83)) ? ((v1 >= v2) || (v1 / 4)) : ((v3 + a0[9]) % 1))) {
+        v1 = (((a1[0][11] <= a0[6]) ? (v3 == a1[0][2]) : (v2 + v0)) || ((v1 % 5) < (v1 - v2)));
+        v1 = (((v3 ? 24 : v2) % 7) ? ((a1[1][14] % 4) || (53 == v1)) : ((v2 ? v1 : 42) ? (a0[7] >= v1) : (v2 * 24)));
+        a0[8] = (((98 <= 15) % 5) || ((v0 || 49) < (v0 || a0[7])));
+    } else {
+        a1[2][14] = (((24 / 2) * (a0[13] ? a1[3][0] : 77)) != ((a0[11] && v0) * (v0 || v3)));
+        v1 = (((a1[3][4] == v0) * (v3 ? v2 : v1)) && ((a0[14] < v3) || (9 ? v1 : v2)));
+        a1[3][9] = (((v0 > 54) || (v2 % 4)) + ((v0 != v0) ? (a0[7] / 9) : (a1[3][4] ? v3 : 88)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            a0[15] = (((v1 || a1[0][5]) ? (85 != a1[1][4]) : (81 ? v2 : a1[3][8])) <= ((v0 * a0[5]) - (a0[3] - v2)));
+            {
+                int i7 = 0;
+                do {
+                    if ((a1[2][3] && i7) > 61) break;
+                    a1[1][2] = (((v1 ? 80 : a1[0][13]) > (i7 == v1)) < ((v2 * a1[0][8]) > (v3 + a1[3][15])));
+                    a0[0] = (((v2 ? i7 : i7) < (v1 <= a1[3][8])) + ((v3 % 6) * (61 != v1)));
+                    a1[3][11] = (((42 == a1[3][3]) * (86 ? a0[1] : 6)) == ((v2 - a1[3][0]) == (47 - v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            v2 = (((a0[10] + v3) * (47 < a1[2][2])) >= ((v0 ? v3 : 6) >= (a1[3][10] / 4)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            v0 = (((a0[6] <= v0) / 2) > ((v0 <= i8) * (a0[0] ? i8 : i8)));
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    a0[3] = (((a1[2][0] - a1[1][0]) <= (73 / 1)) > ((a1[2][11] <= i9) != (v1 <= i8)));
+                    a0[11] = (((v2 < 10) - (v0 - 96)) - ((v1 % 9) - (v2 * 56)));
+                    a0[3] = (((97 <= v0) > (v3 > a1[1][8])) / 6);
+                    i9 = i9 + 1;
+                }
+            }
+            v1 = (((v1 == v0) == (i8 > v1)) * ((v1 ? 91 : v0) < (a0[0] <= i8)));
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            v2 = (((a1[0][7] - v0) < (a1[0][13] <= 1)) - ((9 * a0[9]) != (a0[13] || v0)));
+            {
+                int i11 = 0;
+                do {
+                    if ((a1[2][4] / 7) > 79) break;
+                    v2 = (((v0 && 49) || (v0 - v1)) + ((46 < v1) >= (v1 ? i11 : i10)));
+                    v1 = (((39 ? 10 : a0[11]) >= (v1 >= i11)) || ((a0[1] <= v2) * (a0[3] >= v1)));
+                    v0 = (((98 + v0) / 5) == ((a1[2][8] <= i11) / 9));
+                    i11 = i11 + 1;
+                } while (i11 < 8);
+            }
+            v0 = (((i10 * i10) ? (v2 > v3) : (85 || v0)) - ((77 + a1[1][6]) ? (i10 > v2) : (17 ? a0[10] : v2)));
+            i10 = i10 + 1;
+        }
+    }
+    return (((v3 * a0[13]) && (v0 < a0[13])) ? ((21 ? a1[2][15] : a0[1]) ? (v2 % 9) : (v2 || v1)) : ((v3 / 5) * (a0[0] ? 51 : 8)));
+}
+int f2() {
+    int v0 = 25;
+    int v1 = 19;
+    int v2 = 70;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[3][14] == 99) && (19 && v1)) - ((v0 <= v0) && (67 ? a1[0][12] : v2)));
+    v0 = (((v0 + 91) >= (a0[15] ? v3 : v0)) > ((v0 < 23) || (v3 != a1[3][3])));
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((a1[3][12] * a0[4]) > 87) break;
+            v3 = (((a0[4] < i0) ? (v0 + v1) : (v2 + i0)) ? ((13 ? v1 : a1[3][3]) == (v1 - v1)) : ((v2 % 6) < (v1 % 7)));
+            a1[2][6] = (((a1[1][10] + v0) ? (v2 ? a1[0][2] : v2) : (58 % 7)) || ((17 * 56) % 8));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    if ((v1 >= v3) > 53) break;
+                    v2 = (((a1[2][8] < a0[12]) ? (74 - v0) : (i0 >= a0[7])) <= ((i0 % 8) >= (v3 + 27)));
+                    v3 = (((22 - a0[11]) ? (82 ? 13 : a0[10]) : (v2 ? i0 : 30)) > ((v2 <= 27) || (v1 >= a1[3][11])));
+                    v3 = (((i0 ? i0 : 21) ? (a1[1][9] || v2) : (a0[4] ? v3 : v1)) || ((i0 - i1) != (v3 <= 74)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    a0[1] = (((12 != a1[0][7]) ? (i3 == 3) : (0 < a0[12])) / 6);
+                    a0[7] = (((i2 - v1) - (a0[13] < v2)) == ((a0[14] || i2) % 8));
+                    v1 = (((a1[1][12] % 7) <= (v1 && a0[6])) >= ((a1[2][8] >= v0) % 8));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v1 = (((a1[3][2] >= a0[14]) <= (v2 || 78)) % 2);
+            a1[0][2] = (((v3 % 2) / 7) == ((a0[1] != i2) != (a0[13] > i2)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((v3 - v1) == (v0 * a1[1][5])) + ((v2 && v2) * (v2 == a0[11])))) {
+        a1[0][6] = (((42 % 4) * (v1 == a1[0][10])) && ((a0[8] + v3) == (a0[2] != v2)));
+        v2 = (((v2 - v3) * (a1[2][5] ? 96 : a1[2][14])) > ((v1 == v2) != (a1[2][1] % 9)));
+        v1 = (((a1[2][12] <= v0) / 8) / 8);
+    } else {
+        a0[6] = (((a0[12] % 4) / 9) * ((a1[1][13] < 9) - (v1 / 9)));
+        v2 = (((v1 - a0[14]) && (v3 <= 52)) > ((v0 && a0[3]) % 6));
+        a1[1][3] = (((2 ? 68 : a0[8]) % 7) ? ((a0[15] / 5) < (56 <= v2)) : ((v2 == v3) >= (12 ? 78 : v0)));
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v2 = (((a0[8] || a1[2][14]) / 3) % 1);
+        a1[1][6] = (((a1[3][14] - a0[5]) ? (a0[2] - a0[6]) : (a1[3][6] ? a0[15] : 34)) / 8);
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v2 = (((a1[3][13] * 18) == (v1 + a0[10])) && ((v0 || i4) - (i4 ? 43 : 33)));
+            a1[3][8] = (((v2 == 8) - (94 < 92)) + ((a1[2][8] ? a1[2][13] : 79) / 1));
+            v2 = (((a1[1][14] / 3) >= (v3 ? a1[3][9] : i4)) >= ((i5 ? i5 : i4) - (a1[3][9] == v1)));
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((i6 != v3) / 5) + ((v0 > v3) - (v3 + v1)));
+            v0 = (((i6 != 55) / 6) > ((v0 / 2) % 1));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((35 == 51) > 89) break;
+                v3 = (((53 + v1) + (v0 > a1[3][4])) / 7);
+                a0[10] = (((i7 && 20) % 2) - ((58 != i6) % 7));
+                v1 = (((a0[7] - 92) == (v3 * 99)) < ((a0[7] * i6) && (7 <= 60)));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    v0 = (((v0 < a0[12]) ? (79 ? v2 : 77) : (a0[15] > a0[0])) < ((a0[0] || v3) && (v2 == v1)));
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    v0 = (((i8 * a1[0][1]) > (v3 < i8)) / 3);
+                    v3 = (((a0[5] >= i9) || (i8 >= i9)) && ((v3 + i9) ? (v3 % 4) : (a1[0][2] ? v0 : a1[0][5])));
+                    v1 = (((v2 > a1[3][0]) % 2) <= ((i9 && 73) && (i9 + v2)));
+                    i9 = i9 + 1;
+                }
+            }
+            v0 = (((57 * a1[1][3]) < (v2 && v2)) ? ((16 == v2) ? (19 > 23) : (v1 > v3)) : ((a1[1][7] < a1[0][0]) < (v3 % 7)));
+            a0[15] = (((v2 + a0[5]) - (46 ? 93 : 62)) % 2);
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    {
+        int i10 = 0;
+        do {
+            {
+                int i11 = 0;
+                while (i11 < 4) {
+                    v1 = (((11 != 99) * (a0[2] / 6)) >= ((i11 || a0[1]) <= (v1 == i10)));
+                    v3 = (((i11 - 42) ? (10 && i11) : (66 % 6)) > ((a0[6] != 84) / 3));
+                    a0[5] = (((i11 || a0[3]) + (i10 >= a0[8])) >= ((i10 != 19) <= (v1 > v3)));
+                    i11 = i11 + 1;
+                }
+            }
+            v1 = (((v3 > v3) - (a0[10] || 91)) < ((a0[15] != 88) ? (v0 || v3) : (a0[12] * v2)));
+            a1[1][8] = (((v3 > v0) * (a1[2][8] - a0[3])) <= ((a0[9] / 3) / 1));
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    return (((v3 > v0) + (a1[0][4] > a0[8])) != ((v0 || v3) < (v0 * v0)));
+}
+int f3() {
+    int v0 = 58;
+    int v1 = 23;
+    int v2 = 14;
+    int v3 = 56;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v3 = (((19 / 8) % 2) ? ((v2 > v1) % 7) : ((65 ? 29 : a1[1][2]) ? (v0 ? i0 : a0[11]) : (v1 % 2)));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((61 < v3) > (v1 * 33)) * ((a1[3][0] <= a1[3][14]) == (v0 < a0[2])));
+                v2 = (((73 ? 14 : a0[5]) <= (v3 + i1)) < ((a1[2][0] != 1) / 9));
+                v1 = (((i0 % 3) / 2) <= ((28 == i1) != (a0[5] + a1[3][1])));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        v3 = (((i0 + v3) != (a1[0][8] % 5)) - ((52 - i0) && (a0[15] && v1)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v2 = (((a0[1] >= 49) >= (a0[2] >= a0[7])) ? ((28 || a1[0][6]) ? (i2 && a1[2][15]) : (31 <= v0)) : ((2 * i2) && (v0 ? i2 : v2)));
+                a0[13] = (((v1 != v0) != (a1[2][10] + v2)) != ((i3 + v1) && (66 + i3)));
+                v2 = (((i3 < a0[2]) ? (a0[3] * v3) : (24 + a0[4])) <= ((i3 == i2) - (v1 % 6)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v3 = (((41 * v2) <= (a0[13] == a0[12])) * ((30 <= v3) == (a1[3][3] && a0[2])));
+        v0 = (((v0 / 4) * (v2 % 3)) % 7);
+    }
+    v0 = (((v1 <= v1) > (16 < 41)) > ((v0 / 5) && (a1[3][12] ? v1 : v1)));
+    v3 = (((a1[2][3] == v2) > (a1[3][5] % 4)) ? ((v3 ? v2 : a0[15]) + (v1 < a0[12])) : ((53 ? v0 : a1[0][1]) < (a1[3][1] % 3)));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v0 = (((40 < a0[7]) + (i4 + 64)) && ((v2 / 3) || (v0 <= i4)));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                if ((v1 > a1[0][9]) > 96) break;
+                v2 = (((v2 <= a0[11]) || (a1[2][1] || 56)) == ((a1[2][14] + v1) ? (v3 + a0[10]) : (i5 % 4)));
+                v0 = (((a0[11] || 26) < (i4 + a0[0])) || ((a0[13] / 8) - (v3 * 47)));
+                a1[2][8] = (((a1[3][12] + a1[1][0]) + (v3 % 8)) ? ((a0[10] * a1[0][2]) / 9) : ((89 < v2) ? (a1[1][9] ? 91 : a1[2][6]) : (i5 > a1[3][3])));
+            }
+            v0 = (((36 != v2) < (a0[7] < i4)) - ((v3 <= a1[2][0]) != (i4 % 8)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((67 % 5) < (a0[3] ? v1 : a0[2])) % 7)) {
+        v2 = (((v0 >= v0) || (a1[0][12] > 85)) ? ((a0[12] < v0) <= (v0 || v3)) : ((55 != v0) + (4 - a1[3][3])));
+        v1 = (((a0[1] ? a1[2][8] : v2) > (88 >= v1)) <= ((v2 > v2) >= (13 != v1)));
+        v0 = (((a0[10] && v2) * (98 < 83)) % 9);
+    } else {
+        a1[3][15] = (((v1 ? 42 : 27) ? (v2 > v2) : (v2 - v1)) + ((v3 < a1[2][6]) / 6));
+        v3 = (((83 - v0) || (65 ? v3 : 95)) - ((50 || 21) ? (a1[3][13] > 71) : (a0[4] || a0[1])));
+        a1[3][3] = (((v1 ? a0[7] : a1[0][14]) != (v2 < a1[1][14])) - ((51 != 57) - (11 > 27)));
+    }
+    a0[3] = (((89 < a1[0][2]) <= (v1 / 7)) || ((v0 || 30) != (a0[4] / 8)));
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        v2 = (((v3 && 48) + (v3 < 96)) <= ((a1[1][7] + v3) ? (a0[8] < a1[3][8]) : (v3 * 0)));
+        a0[12] = (((a1[1][14] <= v2) == (a1[2][6] >= v1)) || ((5 && a0[4]) ? (v1 / 3) : (44 * v2)));
+        {
+            int i7 = 0;
+            do {
+                v3 = (((a0[7] * a1[1][15]) != (i7 % 7)) / 1);
+                v0 = (((v3 <= 51) ? (v3 || a1[3][8]) : (i7 ? i6 : a1[1][3])) < ((i6 || i7) <= (v2 || 90)));
+                a1[1][13] = (((v3 - a1[0][2]) - (i7 + v1)) >= ((a1[1][12] / 8) ? (46 / 2) : (43 - 99)));
+                i7 = i7 + 1;
+            } while (i7 < 4);
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v2 = (((a0[6] * i8) == (a1[1][8] * i8)) / 4);
+            {
+                int i9 = 0;
+                do {
+                    v2 = (((v0 > a0[13]) >= (i9 && 39)) == ((v0 < 83) + (v0 < 27)));
+                    v3 = (((v3 >= a1[2][8]) > (v3 * v3)) - ((v2 - v3) >= (v1 * v0)));
+                    v1 = (((v2 + v2) + (a1[0][9] > a0[11])) ? ((a0[11] > a0[8]) && (v3 <= v2)) : ((14 >= 74) > (v2 <= 99)));
+                    i9 = i9 + 1;
+                } while (i9 < 2);
+            }
+            v2 = (((18 + v0) < (i8 != 71)) == ((a0[4] == a0[13]) >= (6 || a1[1][8])));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    if ((((78 / 5) == (v2 % 1)) > ((54 % 6) >= (77 * a0[4])))) {
+        a0[14] = (((v2 * v1) ? (a0[14] >= 97) : (v1 / 1)) < ((v3 >= 32) <= (a0[13] || v1)));
+        v3 = (((57 ? 85 : v3) ? (a0[9] != v1) : (v1 != 35)) < ((v1 ? v2 : a1[3][5]) ? (a1[2][13] ? a0[10] : v3) : (25 - a0[12])));
+        a0[2] = (((5 > v2) >= (v3 ? v3 : v1)) % 3);
+    } else {
+        v2 = (((24 == v3) < (v1 / 3)) > ((61 < a0[6]) && (v2 != v0)));
+        v3 = (((v1 ? 5 : a1[1][14]) < (25 >= v0)) * ((v1 ? 70 : a0[4]) / 2));
+        a0[10] = (((a1[3][10] / 5) + (v3 >= v1)) == ((v1 ? v3 : v3) + (v0 ? v3 : a0[1])));
+    }
+    return (((v3 - a0[0]) && (87 >= v3)) == ((v3 ? 0 : v2) && (v1 - a0[6])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,9965 @@
+    .file 1 "build/bench/batch/f39.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 476 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 477 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 478 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 479 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 480 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 481 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f3
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 482 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $38, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $3, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $35, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $37, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 9 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 10 9
+    .p2align 4,,10
+.Lf0_3:
+    .loc 1 12 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 13 17
+    .p2align 4,,10
+.Lf0_6:
+    .loc 1 14 21
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $37, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subq $20, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 15 21
+    movq $5, %rax
+    push %rax
+    movq $89, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 16 21
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 17 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_5:
+    .loc 1 18 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_6
+.Lf0_4:
+    addq $0, %rsp
+    .loc 1 20 13
+    movq $73, %rax
+    subq $23, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    movslq -48(%rbp), %rax
+    jmp .Lf0_11
+.Lf0_10:
+    movq $17, %rax
+.Lf0_11:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $1, %rax
+    cmpq $78, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    .loc 1 21 13
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_13
+    jmp .Lf0_12
+.Lf0_13:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_12:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_14
+    jmp .Lf0_15
+.Lf0_14:
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_16
+.Lf0_15:
+    movslq -8(%rbp), %rax
+    imulq $7, %rax
+    movslq %eax, %rax
+.Lf0_16:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 22 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_2:
+    .loc 1 23 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_3
+.Lf0_1:
+    addq $8, %rsp
+    .loc 1 26 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 27 9
+    .p2align 4,,10
+.Lf0_19:
+    .loc 1 28 13
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $9, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 30 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 31 17
+    .p2align 4,,10
+.Lf0_22:
+    .loc 1 32 21
+    movq $75, %rax
+    cmpq $0, %rax
+    jne .Lf0_26
+    jmp .Lf0_27
+.Lf0_26:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_28
+.Lf0_27:
+    movslq -4(%rbp), %rax
+.Lf0_28:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_30
+    jmp .Lf0_29
+.Lf0_30:
+    movq $66, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_29:
+    cmpq $0, %rax
+    jne .Lf0_23
+    jmp .Lf0_24
+.Lf0_23:
+    movq $97, %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_25
+.Lf0_24:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_33
+    jmp .Lf0_34
+.Lf0_33:
+    movq $35, %rax
+    jmp .Lf0_35
+.Lf0_34:
+    movslq -340(%rbp), %rax
+.Lf0_35:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_37
+    jmp .Lf0_36
+.Lf0_37:
+    movslq -44(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_36:
+.Lf0_25:
+    movl %eax, -12(%rbp)
+    .loc 1 33 21
+    movq $9, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $25, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    cmpl $27, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 34 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_42
+    jmp .Lf0_41
+.Lf0_42:
+    movq $62, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_41:
+    push %rax
+    movq $8, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_38
+    jmp .Lf0_39
+.Lf0_38:
+    movq $1, %rax
+    push %rax
+    movq $72, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_44
+    jmp .Lf0_43
+.Lf0_44:
+    movslq -344(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_43:
+.Lf0_40:
+    movl %eax, -12(%rbp)
+    .loc 1 35 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_21:
+    .loc 1 36 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_22
+.Lf0_20:
+    addq $0, %rsp
+    .loc 1 38 13
+    movq $12, %rax
+    cmpq $75, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_45
+    jmp .Lf0_46
+.Lf0_45:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_48
+    jmp .Lf0_49
+.Lf0_48:
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf0_50
+.Lf0_49:
+    movslq -44(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_50:
+    jmp .Lf0_47
+.Lf0_46:
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_47:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 39 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_18:
+    .loc 1 40 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_19
+.Lf0_17:
+    addq $8, %rsp
+    .loc 1 42 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_56
+    .p2align 4,,10
+.Lf0_55:
+    .loc 1 44 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 45 13
+    .p2align 4,,10
+.Lf0_59:
+    .loc 1 46 17
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_60
+    jmp .Lf0_57
+.Lf0_60:
+    .loc 1 47 17
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_62
+    jmp .Lf0_61
+.Lf0_62:
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_61:
+    push %rax
+    movslq -32(%rbp), %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_64
+    jmp .Lf0_63
+.Lf0_64:
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_63:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 48 17
+    movq $9, %rax
+    push %rax
+    movq $1, %rax
+    cmpq $0, %rax
+    jne .Lf0_65
+    jmp .Lf0_66
+.Lf0_65:
+    movq $49, %rax
+    jmp .Lf0_67
+.Lf0_66:
+    movslq -4(%rbp), %rax
+.Lf0_67:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $51, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -76(%rbp), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 49 17
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_68
+    jmp .Lf0_69
+.Lf0_68:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_70
+.Lf0_69:
+    movslq -8(%rbp), %rax
+.Lf0_70:
+    push %rax
+    movq $5, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_75
+    jmp .Lf0_74
+.Lf0_75:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_74:
+    cmpq $0, %rax
+    jne .Lf0_71
+    jmp .Lf0_72
+.Lf0_71:
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -12(%rbp), %rax
+    imulq $96, %rax
+    movslq %eax, %rax
+.Lf0_73:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 50 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_58:
+    .loc 1 51 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_59
+.Lf0_57:
+    addq $0, %rsp
+    .loc 1 53 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_76
+    jmp .Lf0_77
+.Lf0_76:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_78
+.Lf0_77:
+    movslq -12(%rbp), %rax
+.Lf0_78:
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_80
+    jmp .Lf0_79
+.Lf0_80:
+    movq $1, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_82
+    jmp .Lf0_81
+.Lf0_82:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_84
+    jmp .Lf0_83
+.Lf0_84:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_83:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_81:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_79:
+    movl %eax, -64(%rbp)
+    .loc 1 54 9
+    movq $6, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_54:
+    .loc 1 42 30
+    incl -340(%rbp)
+.Lf0_56:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_55
+.Lf0_53:
+    addq $8, %rsp
+    .loc 1 56 5
+    movq $63, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_86
+    jmp .Lf0_85
+.Lf0_86:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_85:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 58 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 59 9
+    jmp .Lf0_90
+    .p2align 4,,10
+.Lf0_89:
+    .loc 1 60 13
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $96, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_92
+    jmp .Lf0_91
+.Lf0_92:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_91:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 61 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_98
+    .p2align 4,,10
+.Lf0_97:
+    .loc 1 62 17
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $59, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_99
+    jmp .Lf0_95
+.Lf0_99:
+    .loc 1 63 17
+    movq $4, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $48, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $77, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 64 17
+    movq $53, %rax
+    subq $62, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $13, -12(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_101
+    jmp .Lf0_100
+.Lf0_101:
+    movq $97, %rax
+    cmpq $70, %rax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_100:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 65 17
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_103
+    jmp .Lf0_102
+.Lf0_103:
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_102:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_104
+    jmp .Lf0_105
+.Lf0_104:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf0_106
+.Lf0_105:
+    movslq -344(%rbp), %rax
+.Lf0_106:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_96:
+    .loc 1 61 38
+    incl -344(%rbp)
+.Lf0_98:
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_97
+.Lf0_95:
+    addq $0, %rsp
+    .loc 1 67 13
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_108
+    jmp .Lf0_107
+.Lf0_108:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_107:
+    push %rax
+    movq $30, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $29, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -60(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 68 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_88:
+.Lf0_90:
+    .loc 1 59 16
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_89
+.Lf0_87:
+    addq $8, %rsp
+    .loc 1 71 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_114
+    .p2align 4,,10
+.Lf0_113:
+    .loc 1 73 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 74 13
+    .p2align 4,,10
+.Lf0_117:
+    .loc 1 75 17
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $65, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_118
+    jmp .Lf0_115
+.Lf0_118:
+    .loc 1 76 17
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_119
+    jmp .Lf0_120
+.Lf0_119:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_121
+.Lf0_120:
+    movslq -12(%rbp), %rax
+.Lf0_121:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $44, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $97, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 77 17
+    movq $3, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 78 17
+    cmpl $40, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_123
+    jmp .Lf0_122
+.Lf0_123:
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_122:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_125
+    jmp .Lf0_124
+.Lf0_125:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_127
+.Lf0_126:
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_128
+.Lf0_127:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_130
+    jmp .Lf0_129
+.Lf0_130:
+    movq $55, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_129:
+.Lf0_128:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_124:
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 79 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_116:
+    .loc 1 80 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_117
+.Lf0_115:
+    addq $0, %rsp
+    .loc 1 82 9
+    cmpl $70, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $97, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 83 9
+    movq $7, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_131
+    jmp .Lf0_132
+.Lf0_131:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    jmp .Lf0_133
+.Lf0_132:
+    movslq -12(%rbp), %rax
+.Lf0_133:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    subl -68(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_112:
+    .loc 1 71 30
+    incl -340(%rbp)
+.Lf0_114:
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_113
+.Lf0_111:
+    addq $8, %rsp
+    .loc 1 85 5
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_135
+    jmp .Lf0_136
+.Lf0_135:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_137
+.Lf0_136:
+    movslq -12(%rbp), %rax
+.Lf0_137:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $70, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -76(%rbp), %rax
+    imulq $93, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_138
+    .loc 1 86 9
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_139
+    jmp .Lf0_140
+.Lf0_139:
+    movq $79, %rax
+    jmp .Lf0_141
+.Lf0_140:
+    movq $37, %rax
+.Lf0_141:
+    push %rax
+    movq $46, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_142
+    jmp .Lf0_143
+.Lf0_142:
+    movslq -44(%rbp), %rax
+    jmp .Lf0_144
+.Lf0_143:
+    movslq -36(%rbp), %rax
+.Lf0_144:
+    push %rax
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf0_145
+    jmp .Lf0_146
+.Lf0_145:
+    movq $60, %rax
+    jmp .Lf0_147
+.Lf0_146:
+    movslq -12(%rbp), %rax
+.Lf0_147:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 87 9
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_148
+    jmp .Lf0_149
+.Lf0_148:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_150
+.Lf0_149:
+    movq $14, %rax
+.Lf0_150:
+    push %rax
+    movq $20, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_151
+    jmp .Lf0_152
+.Lf0_151:
+    movq $8, %rax
+    jmp .Lf0_153
+.Lf0_152:
+    movq $34, %rax
+.Lf0_153:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_155
+    jmp .Lf0_154
+.Lf0_155:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_154:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -24(%rbp)
+    .loc 1 88 9
+    cmpl $30, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $80, %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_134
+.Lf0_138:
+    .loc 1 90 9
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addq $56, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -16(%rbp)
+    .loc 1 91 9
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $58, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 92 9
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_156
+    jmp .Lf0_157
+.Lf0_156:
+    movslq -68(%rbp), %rax
+    jmp .Lf0_158
+.Lf0_157:
+    movq $82, %rax
+.Lf0_158:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_134:
+    .loc 1 95 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 96 9
+    .p2align 4,,10
+.Lf0_161:
+    .loc 1 97 13
+    movq $20, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $92, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_162
+    jmp .Lf0_159
+.Lf0_162:
+    .loc 1 98 13
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    addl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_163
+.Lf0_164:
+    movslq -12(%rbp), %rax
+    imulq $11, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_163:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $46, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $28, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 99 13
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $96, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_166
+    jmp .Lf0_165
+.Lf0_166:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_165:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_168
+    jmp .Lf0_167
+.Lf0_168:
+    cmpl $33, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $96, -16(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_167:
+    movl %eax, -24(%rbp)
+    .loc 1 100 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_174
+    .p2align 4,,10
+.Lf0_173:
+    .loc 1 101 17
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf0_175
+    jmp .Lf0_176
+.Lf0_175:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_177
+.Lf0_176:
+    movq $43, %rax
+.Lf0_177:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_178
+    jmp .Lf0_179
+.Lf0_178:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf0_180
+.Lf0_179:
+    movq $93, %rax
+.Lf0_180:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -76(%rbp)
+    .loc 1 102 17
+    movq $3, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_181
+    jmp .Lf0_182
+.Lf0_181:
+    movq $77, %rax
+    jmp .Lf0_183
+.Lf0_182:
+    movslq -344(%rbp), %rax
+.Lf0_183:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 103 17
+    movslq -340(%rbp), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_184
+    jmp .Lf0_185
+.Lf0_184:
+    movslq -344(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_186
+.Lf0_185:
+    movq $29, %rax
+    cmpq $0, %rax
+    jne .Lf0_187
+    jmp .Lf0_188
+.Lf0_187:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_189
+.Lf0_188:
+    movslq -56(%rbp), %rax
+.Lf0_189:
+.Lf0_186:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_191
+    jmp .Lf0_190
+.Lf0_191:
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_190:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf0_172:
+    .loc 1 100 40
+    incl -344(%rbp)
+.Lf0_174:
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_173
+.Lf0_171:
+    addq $0, %rsp
+    .loc 1 105 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_160:
+    .loc 1 106 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_161
+.Lf0_159:
+    addq $8, %rsp
+    .loc 1 109 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 110 9
+    jmp .Lf0_195
+    .p2align 4,,10
+.Lf0_194:
+    .loc 1 112 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 113 17
+    jmp .Lf0_199
+    .p2align 4,,10
+.Lf0_198:
+    .loc 1 114 21
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $77, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -56(%rbp)
+    .loc 1 115 21
+    movq $19, %rax
+    cmpq $0, %rax
+    jne .Lf0_200
+    jmp .Lf0_201
+.Lf0_200:
+    movq $75, %rax
+    jmp .Lf0_202
+.Lf0_201:
+    movslq -344(%rbp), %rax
+.Lf0_202:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    .loc 1 116 21
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_204
+    jmp .Lf0_203
+.Lf0_204:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_203:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 40(%rax)
+    movq %rdx, %rax
+    .loc 1 117 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_197:
+.Lf0_199:
+    .loc 1 113 24
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_198
+.Lf0_196:
+    addq $0, %rsp
+    .loc 1 120 13
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $46, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_206
+.Lf0_205:
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_207
+.Lf0_206:
+    movq $6, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $84, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_207:
+    movl %eax, -8(%rbp)
+    .loc 1 121 13
+    movq $1, %rax
+    push %rax
+    movq $83, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 122 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_193:
+.Lf0_195:
+    .loc 1 110 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_194
+.Lf0_192:
+    addq $8, %rsp
+    .loc 1 125 5
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $0, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_210
+    jmp .Lf0_209
+.Lf0_210:
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_209:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_211
+    .loc 1 126 9
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_213
+    jmp .Lf0_212
+.Lf0_213:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_212:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_215
+    jmp .Lf0_214
+.Lf0_215:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_214:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $7, %rax
+    cmpq $15, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf0_216
+    jmp .Lf0_217
+.Lf0_216:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_218
+.Lf0_217:
+    movq $36, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_220
+    jmp .Lf0_219
+.Lf0_220:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_219:
+.Lf0_218:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 127 9
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_221
+    jmp .Lf0_222
+.Lf0_221:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_224
+    jmp .Lf0_225
+.Lf0_224:
+    movq $9, %rax
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -16(%rbp), %rax
+.Lf0_226:
+    jmp .Lf0_223
+.Lf0_222:
+    movq $3, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_223:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 128 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_227
+    jmp .Lf0_228
+.Lf0_227:
+    movq $21, %rax
+    jmp .Lf0_229
+.Lf0_228:
+    movslq -16(%rbp), %rax
+.Lf0_229:
+    push %rax
+    movq $80, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_233
+    jmp .Lf0_234
+.Lf0_233:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_235
+.Lf0_234:
+    movslq -64(%rbp), %rax
+.Lf0_235:
+    cmpq $0, %rax
+    jne .Lf0_230
+    jmp .Lf0_231
+.Lf0_230:
+    movq $75, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_232
+.Lf0_231:
+    movq $8, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf0_232:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_208
+.Lf0_211:
+    .loc 1 130 9
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 131 9
+    movq $56, %rax
+    cmpq $0, %rax
+    jne .Lf0_236
+    jmp .Lf0_237
+.Lf0_236:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_238
+.Lf0_237:
+    movslq -12(%rbp), %rax
+.Lf0_238:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_239
+    jmp .Lf0_240
+.Lf0_239:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_241
+.Lf0_240:
+    movq $17, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_241:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 132 9
+    movslq -16(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $28, %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_243
+    jmp .Lf0_242
+.Lf0_243:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_242:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf0_208:
+    .loc 1 134 5
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_245
+    jmp .Lf0_244
+.Lf0_245:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_247
+    jmp .Lf0_246
+.Lf0_247:
+    movq $34, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_246:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_244:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $59, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 136 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 137 5
+    subq $8, %rsp
+    movq $41, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 138 5
+    movq $62, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 139 5
+    subq $8, %rsp
+    movq $23, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 140 5
+    movq $73, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 141 5
+    subq $64, %rsp
+    .loc 1 142 5
+    subq $256, %rsp
+    .loc 1 143 5
+    movq $3, %rax
+    push %rax
+    cmpl $26, -8(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 144 5
+    movq $6, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_1
+    jmp .Lf1_2
+.Lf1_1:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_3
+.Lf1_2:
+    movq $86, %rax
+.Lf1_3:
+    push %rax
+    movq $46, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 145 5
+    movslq -24(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_6
+    jmp .Lf1_5
+.Lf1_6:
+    movq $21, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_5:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_8
+    jmp .Lf1_7
+.Lf1_8:
+    movq $78, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_7:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_9
+    .loc 1 146 9
+    cmpl $17, -20(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_10
+    jmp .Lf1_11
+.Lf1_10:
+    movslq -4(%rbp), %rax
+    addl -56(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_12
+.Lf1_11:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_14
+    jmp .Lf1_13
+.Lf1_14:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_13:
+.Lf1_12:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 147 9
+    movq $6, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf1_15
+    jmp .Lf1_16
+.Lf1_15:
+    movslq -60(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_17
+.Lf1_16:
+    movq $17, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $75, -12(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_17:
+    movl %eax, -12(%rbp)
+    .loc 1 148 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_22
+    jmp .Lf1_21
+.Lf1_22:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_21:
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_19
+.Lf1_18:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_24
+    jmp .Lf1_23
+.Lf1_24:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_23:
+    jmp .Lf1_20
+.Lf1_19:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_20:
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_25
+    jmp .Lf1_26
+.Lf1_25:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    addq $59, %rax
+    movslq %eax, %rax
+    jmp .Lf1_27
+.Lf1_26:
+    movq $91, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_27:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_4
+.Lf1_9:
+    .loc 1 150 9
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_29
+    jmp .Lf1_28
+.Lf1_29:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_28:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $94, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 151 9
+    movq $9, %rax
+    push %rax
+    movq $98, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_30
+    jmp .Lf1_31
+.Lf1_30:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_32
+.Lf1_31:
+    movslq -12(%rbp), %rax
+.Lf1_32:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 152 9
+    cmpl $48, -4(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $50, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_34
+    jmp .Lf1_33
+.Lf1_34:
+    movq $40, %rax
+    subq $84, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $96, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_36
+    jmp .Lf1_35
+.Lf1_36:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_35:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_33:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf1_4:
+    .loc 1 155 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 156 9
+    jmp .Lf1_40
+    .p2align 4,,10
+.Lf1_39:
+    .loc 1 157 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_44
+    jmp .Lf1_45
+.Lf1_44:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_46
+.Lf1_45:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_46:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_47
+.Lf1_48:
+    movslq -44(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_47:
+    cmpq $0, %rax
+    jne .Lf1_41
+    jmp .Lf1_42
+.Lf1_41:
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_49
+    jmp .Lf1_50
+.Lf1_49:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_51
+.Lf1_50:
+    cmpl $49, -4(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf1_51:
+    jmp .Lf1_43
+.Lf1_42:
+    movq $1, %rax
+    push %rax
+    movq $12, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_43:
+    movl %eax, -40(%rbp)
+    .loc 1 159 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 160 17
+    jmp .Lf1_55
+    .p2align 4,,10
+.Lf1_54:
+    .loc 1 161 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_57
+.Lf1_56:
+    movq $22, %rax
+    jmp .Lf1_58
+.Lf1_57:
+    movq $64, %rax
+.Lf1_58:
+    push %rax
+    movq $97, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_60
+    jmp .Lf1_59
+.Lf1_60:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_59:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $37, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 162 21
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 163 21
+    movslq -344(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $68, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $65, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 164 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_53:
+.Lf1_55:
+    .loc 1 160 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_54
+.Lf1_52:
+    addq $0, %rsp
+    .loc 1 167 13
+    movq $9, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_62
+    jmp .Lf1_61
+.Lf1_62:
+    movq $51, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_61:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_64
+    jmp .Lf1_63
+.Lf1_64:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $32, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_63:
+    movl %eax, -8(%rbp)
+    .loc 1 168 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_38:
+.Lf1_40:
+    .loc 1 156 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_39
+.Lf1_37:
+    addq $8, %rsp
+    .loc 1 172 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 173 9
+    jmp .Lf1_68
+    .p2align 4,,10
+.Lf1_67:
+    .loc 1 175 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 176 17
+    jmp .Lf1_72
+    .p2align 4,,10
+.Lf1_71:
+    .loc 1 177 21
+    movq $3, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_77
+    jmp .Lf1_76
+.Lf1_77:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_76:
+    cmpq $0, %rax
+    jne .Lf1_73
+    jmp .Lf1_74
+.Lf1_73:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_75
+.Lf1_74:
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_75:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 178 21
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_78
+    jmp .Lf1_79
+.Lf1_78:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_80
+.Lf1_79:
+    movslq -76(%rbp), %rax
+.Lf1_80:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_82
+    jmp .Lf1_81
+.Lf1_82:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_83
+    jmp .Lf1_84
+.Lf1_83:
+    movslq -24(%rbp), %rax
+    jmp .Lf1_85
+.Lf1_84:
+    movq $86, %rax
+.Lf1_85:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_87
+    jmp .Lf1_86
+.Lf1_87:
+    cmpl $89, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_86:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_81:
+    movl %eax, -80(%rbp)
+    .loc 1 179 21
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_89
+    jmp .Lf1_88
+.Lf1_89:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_91
+    jmp .Lf1_90
+.Lf1_91:
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_90:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_88:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 180 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_70:
+.Lf1_72:
+    .loc 1 176 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_71
+.Lf1_69:
+    addq $0, %rsp
+    .loc 1 183 13
+    movslq -12(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_92
+    jmp .Lf1_93
+.Lf1_92:
+    movq $25, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_96
+    jmp .Lf1_95
+.Lf1_96:
+    movq $14, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_95:
+    jmp .Lf1_94
+.Lf1_93:
+    cmpl $83, -44(%rbp)
+    movq $0, %rax
+    setg %al
+.Lf1_94:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 184 13
+    movq $41, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_98
+    jmp .Lf1_97
+.Lf1_98:
+    movslq -4(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_97:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_100
+    jmp .Lf1_99
+.Lf1_100:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_99:
+    push %rax
+    movq $79, %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    .loc 1 185 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_66:
+.Lf1_68:
+    .loc 1 173 16
+    cmpl $8, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_67
+.Lf1_65:
+    addq $8, %rsp
+    .loc 1 188 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_106
+    .p2align 4,,10
+.Lf1_105:
+    .loc 1 189 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf1_112
+    .p2align 4,,10
+.Lf1_111:
+    .loc 1 190 13
+    cmpl $53, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_116
+    jmp .Lf1_109
+.Lf1_116:
+    .loc 1 191 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_117
+.Lf1_118:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_117:
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $7, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $73, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 192 13
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_119
+    jmp .Lf1_120
+.Lf1_119:
+    movq $51, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_121
+.Lf1_120:
+    movslq -4(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_121:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 193 13
+    movslq -16(%rbp), %rax
+    addq $4, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $0, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+.Lf1_115:
+    .loc 1 189 34
+    incl -344(%rbp)
+    .loc 1 190 13
+    cmpl $53, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_122
+    jmp .Lf1_109
+.Lf1_122:
+    .loc 1 191 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_124
+    jmp .Lf1_123
+.Lf1_124:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_123:
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $7, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $73, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 192 13
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_125
+    jmp .Lf1_126
+.Lf1_125:
+    movq $51, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_127
+.Lf1_126:
+    movslq -4(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_127:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 193 13
+    movslq -16(%rbp), %rax
+    addq $4, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $0, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+.Lf1_114:
+    .loc 1 189 34
+    incl -344(%rbp)
+.Lf1_112:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $6, %rax
+    jl .Lf1_111
+.Lf1_113:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf1_109
+    .loc 1 190 13
+    cmpl $53, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $60, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_128
+    jmp .Lf1_109
+.Lf1_128:
+    .loc 1 191 13
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_130
+    jmp .Lf1_129
+.Lf1_130:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_129:
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $7, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $73, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 192 13
+    movq $3, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_131
+    jmp .Lf1_132
+.Lf1_131:
+    movq $51, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_133
+.Lf1_132:
+    movslq -4(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_133:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 193 13
+    movslq -16(%rbp), %rax
+    addq $4, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $0, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+.Lf1_110:
+    .loc 1 189 34
+    incl -344(%rbp)
+    jmp .Lf1_113
+.Lf1_109:
+    addq $0, %rsp
+    .loc 1 195 9
+    movq $2, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $22, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 196 9
+    movq $95, %rax
+    subq $93, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $79, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf1_104:
+    .loc 1 188 30
+    incl -340(%rbp)
+.Lf1_106:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_105
+.Lf1_103:
+    addq $8, %rsp
+    .loc 1 198 5
+    movslq -8(%rbp), %rax
+    addq $71, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf1_138
+    jmp .Lf1_139
+.Lf1_138:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_140
+.Lf1_139:
+    movq $83, %rax
+.Lf1_140:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_135
+    jmp .Lf1_136
+.Lf1_135:
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_142
+    jmp .Lf1_141
+.Lf1_142:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_141:
+    jmp .Lf1_137
+.Lf1_136:
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_137:
+    cmpq $0, %rax
+    je .Lf1_143
+    .loc 1 199 9
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_144
+    jmp .Lf1_145
+.Lf1_144:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_146
+.Lf1_145:
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_146:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_148
+    jmp .Lf1_147
+.Lf1_148:
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_147:
+    movl %eax, -8(%rbp)
+    .loc 1 200 9
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_152
+    jmp .Lf1_153
+.Lf1_152:
+    movq $24, %rax
+    jmp .Lf1_154
+.Lf1_153:
+    movslq -12(%rbp), %rax
+.Lf1_154:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_149
+    jmp .Lf1_150
+.Lf1_149:
+    movq $4, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_156
+    jmp .Lf1_155
+.Lf1_156:
+    movq $53, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_155:
+    jmp .Lf1_151
+.Lf1_150:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_161
+.Lf1_160:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_162
+.Lf1_161:
+    movq $42, %rax
+.Lf1_162:
+    cmpq $0, %rax
+    jne .Lf1_157
+    jmp .Lf1_158
+.Lf1_157:
+    movslq -52(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_159
+.Lf1_158:
+    movslq -12(%rbp), %rax
+    imulq $24, %rax
+    movslq %eax, %rax
+.Lf1_159:
+.Lf1_151:
+    movl %eax, -8(%rbp)
+    .loc 1 201 9
+    movq $5, %rax
+    push %rax
+    movq $98, %rax
+    cmpq $15, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_164
+    jmp .Lf1_163
+.Lf1_164:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_166
+    jmp .Lf1_165
+.Lf1_166:
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_165:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_168
+    jmp .Lf1_167
+.Lf1_168:
+    movslq -52(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_167:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_163:
+    movl %eax, -48(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_134
+.Lf1_143:
+    .loc 1 203 9
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_169
+    jmp .Lf1_170
+.Lf1_169:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    jmp .Lf1_171
+.Lf1_170:
+    movq $77, %rax
+.Lf1_171:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $24, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_173
+    jmp .Lf1_172
+.Lf1_173:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_172:
+    push %rax
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_175
+    jmp .Lf1_174
+.Lf1_175:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_174:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 204 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_176
+    jmp .Lf1_177
+.Lf1_176:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_178
+.Lf1_177:
+    movslq -8(%rbp), %rax
+.Lf1_178:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_180
+    jmp .Lf1_179
+.Lf1_180:
+    movslq -24(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_182
+    jmp .Lf1_181
+.Lf1_182:
+    movq $9, %rax
+    cmpq $0, %rax
+    jne .Lf1_183
+    jmp .Lf1_184
+.Lf1_183:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_185
+.Lf1_184:
+    movslq -12(%rbp), %rax
+.Lf1_185:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_181:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_179:
+    movl %eax, -8(%rbp)
+    .loc 1 205 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_186
+    jmp .Lf1_187
+.Lf1_186:
+    movq $9, %rax
+    push %rax
+    movslq -52(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_188
+.Lf1_187:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_189
+    jmp .Lf1_190
+.Lf1_189:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_191
+.Lf1_190:
+    movq $88, %rax
+.Lf1_191:
+.Lf1_188:
+    push %rax
+    cmpl $54, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_193
+    jmp .Lf1_192
+.Lf1_193:
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_192:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf1_134:
+    .loc 1 208 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 209 9
+    jmp .Lf1_197
+    .p2align 4,,10
+.Lf1_196:
+    .loc 1 210 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_202
+    jmp .Lf1_201
+.Lf1_202:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_201:
+    cmpq $0, %rax
+    jne .Lf1_198
+    jmp .Lf1_199
+.Lf1_198:
+    movq $85, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_200
+.Lf1_199:
+    movq $81, %rax
+    cmpq $0, %rax
+    jne .Lf1_203
+    jmp .Lf1_204
+.Lf1_203:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_205
+.Lf1_204:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+.Lf1_205:
+.Lf1_200:
+    push %rax
+    movslq -68(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -20(%rbp)
+    .loc 1 212 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 213 17
+    .p2align 4,,10
+.Lf1_208:
+    .loc 1 214 21
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_211
+    jmp .Lf1_210
+.Lf1_211:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_210:
+    cmpq $61, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_209
+    jmp .Lf1_206
+.Lf1_209:
+    .loc 1 215 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_212
+    jmp .Lf1_213
+.Lf1_212:
+    movq $80, %rax
+    jmp .Lf1_214
+.Lf1_213:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+.Lf1_214:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 216 21
+    movq $61, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_215
+    jmp .Lf1_216
+.Lf1_215:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -344(%rbp), %rax
+.Lf1_217:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -80(%rbp)
+    .loc 1 217 21
+    movq $86, %rax
+    cmpq $0, %rax
+    jne .Lf1_218
+    jmp .Lf1_219
+.Lf1_218:
+    movslq -76(%rbp), %rax
+    jmp .Lf1_220
+.Lf1_219:
+    movq $6, %rax
+.Lf1_220:
+    push %rax
+    movq $42, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $47, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 218 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_207:
+    .loc 1 219 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_208
+.Lf1_206:
+    addq $0, %rsp
+    .loc 1 221 13
+    movq $47, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -40(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_221
+    jmp .Lf1_222
+.Lf1_221:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_223
+.Lf1_222:
+    movq $6, %rax
+.Lf1_223:
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    .loc 1 222 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_195:
+.Lf1_197:
+    .loc 1 209 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_196
+.Lf1_194:
+    addq $8, %rsp
+    .loc 1 226 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 227 9
+    jmp .Lf1_227
+    .p2align 4,,10
+.Lf1_226:
+    .loc 1 228 13
+    movq $2, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_228
+    jmp .Lf1_229
+.Lf1_228:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_230
+.Lf1_229:
+    movslq -340(%rbp), %rax
+.Lf1_230:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 230 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 231 17
+    jmp .Lf1_234
+    .p2align 4,,10
+.Lf1_233:
+    .loc 1 232 21
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $73, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -68(%rbp)
+    .loc 1 233 21
+    movslq -12(%rbp), %rax
+    imulq $56, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $96, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $10, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 234 21
+    movq $6, %rax
+    push %rax
+    movq $97, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -68(%rbp)
+    .loc 1 235 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_232:
+.Lf1_234:
+    .loc 1 231 24
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_233
+.Lf1_231:
+    addq $0, %rsp
+    .loc 1 238 13
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_235
+    jmp .Lf1_236
+.Lf1_235:
+    movq $91, %rax
+    jmp .Lf1_237
+.Lf1_236:
+    movslq -4(%rbp), %rax
+.Lf1_237:
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 239 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_225:
+.Lf1_227:
+    .loc 1 227 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_226
+.Lf1_224:
+    addq $8, %rsp
+    .loc 1 243 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 244 9
+    jmp .Lf1_241
+    .p2align 4,,10
+.Lf1_240:
+    .loc 1 245 13
+    movq $9, %rax
+    imull -44(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_243
+    jmp .Lf1_242
+.Lf1_243:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_242:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 247 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 248 17
+    .p2align 4,,10
+.Lf1_246:
+    .loc 1 249 21
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_247
+    jmp .Lf1_244
+.Lf1_247:
+    .loc 1 250 21
+    movq $46, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_248
+    jmp .Lf1_249
+.Lf1_248:
+    movslq -344(%rbp), %rax
+    jmp .Lf1_250
+.Lf1_249:
+    movslq -340(%rbp), %rax
+.Lf1_250:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_252
+    jmp .Lf1_251
+.Lf1_252:
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_251:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_254
+    jmp .Lf1_253
+.Lf1_254:
+    movslq -4(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_253:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 251 21
+    movq $39, %rax
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_256
+.Lf1_255:
+    movq $10, %rax
+    jmp .Lf1_257
+.Lf1_256:
+    movslq -36(%rbp), %rax
+.Lf1_257:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_259
+    jmp .Lf1_258
+.Lf1_259:
+    movslq -68(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_258:
+    movl %eax, -8(%rbp)
+    .loc 1 252 21
+    movq $5, %rax
+    push %rax
+    movq $98, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 253 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_245:
+    .loc 1 254 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_246
+.Lf1_244:
+    addq $0, %rsp
+    .loc 1 256 13
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    addq $77, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_260
+    jmp .Lf1_261
+.Lf1_260:
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_262
+.Lf1_261:
+    movq $17, %rax
+    cmpq $0, %rax
+    jne .Lf1_263
+    jmp .Lf1_264
+.Lf1_263:
+    movslq -40(%rbp), %rax
+    jmp .Lf1_265
+.Lf1_264:
+    movslq -12(%rbp), %rax
+.Lf1_265:
+.Lf1_262:
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_266
+    jmp .Lf1_267
+.Lf1_266:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf1_268
+.Lf1_267:
+    movq $85, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_270
+    jmp .Lf1_269
+.Lf1_270:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_269:
+.Lf1_268:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 257 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_239:
+.Lf1_241:
+    .loc 1 244 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_240
+.Lf1_238:
+    addq $8, %rsp
+    .loc 1 260 5
+    movslq -16(%rbp), %rax
+    imull -28(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_275
+    jmp .Lf1_274
+.Lf1_275:
+    movslq -4(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_274:
+    cmpq $0, %rax
+    jne .Lf1_271
+    jmp .Lf1_272
+.Lf1_271:
+    movq $21, %rax
+    cmpq $0, %rax
+    jne .Lf1_279
+    jmp .Lf1_280
+.Lf1_279:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    jmp .Lf1_281
+.Lf1_280:
+    movslq -76(%rbp), %rax
+.Lf1_281:
+    cmpq $0, %rax
+    jne .Lf1_276
+    jmp .Lf1_277
+.Lf1_276:
+    movq $9, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_278
+.Lf1_277:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_283
+    jmp .Lf1_282
+.Lf1_283:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_282:
+.Lf1_278:
+    jmp .Lf1_273
+.Lf1_272:
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_284
+    jmp .Lf1_285
+.Lf1_284:
+    movq $51, %rax
+    jmp .Lf1_286
+.Lf1_285:
+    movq $8, %rax
+.Lf1_286:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+.Lf1_273:
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 262 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 263 5
+    subq $8, %rsp
+    movq $25, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 264 5
+    movq $19, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 265 5
+    subq $8, %rsp
+    movq $70, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 266 5
+    movq $37, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 267 5
+    subq $64, %rsp
+    .loc 1 268 5
+    subq $256, %rsp
+    .loc 1 269 5
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_2
+    jmp .Lf2_1
+.Lf2_2:
+    movq $67, %rax
+    cmpq $0, %rax
+    jne .Lf2_3
+    jmp .Lf2_4
+.Lf2_3:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    jmp .Lf2_5
+.Lf2_4:
+    movslq -12(%rbp), %rax
+.Lf2_5:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_1:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_7
+    jmp .Lf2_6
+.Lf2_7:
+    movq $19, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_9
+    jmp .Lf2_8
+.Lf2_9:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_8:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_6:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 270 5
+    movslq -4(%rbp), %rax
+    addq $91, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_10
+    jmp .Lf2_11
+.Lf2_10:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_12
+.Lf2_11:
+    movslq -4(%rbp), %rax
+.Lf2_12:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $23, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_14
+    jmp .Lf2_13
+.Lf2_14:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_13:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 272 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 273 9
+    jmp .Lf2_18
+    .p2align 4,,10
+.Lf2_17:
+    .loc 1 274 13
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_19
+    jmp .Lf2_15
+.Lf2_19:
+    .loc 1 275 13
+    movslq -64(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_23
+    jmp .Lf2_24
+.Lf2_23:
+    movslq -4(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_25
+.Lf2_24:
+    movslq -12(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_25:
+    cmpq $0, %rax
+    jne .Lf2_20
+    jmp .Lf2_21
+.Lf2_20:
+    movq $13, %rax
+    cmpq $0, %rax
+    jne .Lf2_26
+    jmp .Lf2_27
+.Lf2_26:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_28
+.Lf2_27:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf2_28:
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_22
+.Lf2_21:
+    movq $6, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_22:
+    movl %eax, -16(%rbp)
+    .loc 1 276 13
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_29
+    jmp .Lf2_30
+.Lf2_29:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_32
+    jmp .Lf2_33
+.Lf2_32:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf2_34
+.Lf2_33:
+    movslq -12(%rbp), %rax
+.Lf2_34:
+    jmp .Lf2_31
+.Lf2_30:
+    movq $7, %rax
+    push %rax
+    movq $58, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_31:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_36
+    jmp .Lf2_35
+.Lf2_36:
+    movq $8, %rax
+    push %rax
+    movq $17, %rax
+    imulq $56, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_35:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 278 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 279 17
+    jmp .Lf2_40
+    .p2align 4,,10
+.Lf2_39:
+    .loc 1 280 21
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_41
+    jmp .Lf2_37
+.Lf2_41:
+    .loc 1 281 21
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_42
+    jmp .Lf2_43
+.Lf2_42:
+    movq $74, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_44
+.Lf2_43:
+    movslq -340(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf2_44:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    addq $27, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 282 21
+    movq $22, %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_45
+    jmp .Lf2_46
+.Lf2_45:
+    movq $82, %rax
+    cmpq $0, %rax
+    jne .Lf2_48
+    jmp .Lf2_49
+.Lf2_48:
+    movq $13, %rax
+    jmp .Lf2_50
+.Lf2_49:
+    movslq -40(%rbp), %rax
+.Lf2_50:
+    jmp .Lf2_47
+.Lf2_46:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_51
+    jmp .Lf2_52
+.Lf2_51:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_53
+.Lf2_52:
+    movq $30, %rax
+.Lf2_53:
+.Lf2_47:
+    push %rax
+    cmpl $27, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_55
+    jmp .Lf2_54
+.Lf2_55:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_54:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 283 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_59
+    jmp .Lf2_60
+.Lf2_59:
+    movslq -340(%rbp), %rax
+    jmp .Lf2_61
+.Lf2_60:
+    movq $21, %rax
+.Lf2_61:
+    cmpq $0, %rax
+    jne .Lf2_56
+    jmp .Lf2_57
+.Lf2_56:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_63
+    jmp .Lf2_62
+.Lf2_63:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_62:
+    jmp .Lf2_58
+.Lf2_57:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_64
+    jmp .Lf2_65
+.Lf2_64:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_66
+.Lf2_65:
+    movslq -8(%rbp), %rax
+.Lf2_66:
+.Lf2_58:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_68
+    jmp .Lf2_67
+.Lf2_68:
+    movslq -340(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $74, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_67:
+    movl %eax, -16(%rbp)
+    .loc 1 284 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_38:
+.Lf2_40:
+    .loc 1 279 24
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_39
+.Lf2_37:
+    addq $0, %rsp
+    .loc 1 287 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_16:
+.Lf2_18:
+    .loc 1 273 16
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_17
+.Lf2_15:
+    addq $8, %rsp
+    .loc 1 291 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 292 9
+    .p2align 4,,10
+.Lf2_71:
+    .loc 1 294 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 295 17
+    .p2align 4,,10
+.Lf2_74:
+    .loc 1 296 21
+    movq $6, %rax
+    push %rax
+    movq $12, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_75
+    jmp .Lf2_76
+.Lf2_75:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    jmp .Lf2_77
+.Lf2_76:
+    movq $0, %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf2_77:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 297 21
+    movslq -28(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_79
+    jmp .Lf2_78
+.Lf2_79:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_78:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -52(%rbp)
+    .loc 1 298 21
+    movq $7, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_81
+    jmp .Lf2_80
+.Lf2_81:
+    movslq -56(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_80:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 299 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_73:
+    .loc 1 300 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_74
+.Lf2_72:
+    addq $0, %rsp
+    .loc 1 302 13
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_83
+    jmp .Lf2_82
+.Lf2_83:
+    movq $78, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_82:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 303 13
+    movq $7, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -76(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 8(%rax)
+    movq %rdx, %rax
+    .loc 1 304 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_70:
+    .loc 1 305 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_71
+.Lf2_69:
+    addq $8, %rsp
+    .loc 1 307 5
+    movslq -12(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_86
+    jmp .Lf2_85
+.Lf2_86:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_85:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf2_87
+    .loc 1 308 9
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $42, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_89
+    jmp .Lf2_88
+.Lf2_89:
+    movslq -48(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_88:
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 309 9
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_90
+    jmp .Lf2_91
+.Lf2_90:
+    movq $96, %rax
+    jmp .Lf2_92
+.Lf2_91:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf2_92:
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 310 9
+    movq $8, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_84
+.Lf2_87:
+    .loc 1 312 9
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $9, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -56(%rbp)
+    .loc 1 313 9
+    movslq -8(%rbp), %rax
+    subl -24(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_94
+    jmp .Lf2_93
+.Lf2_94:
+    cmpl $52, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_93:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_96
+    jmp .Lf2_95
+.Lf2_96:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_95:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 314 9
+    movq $7, %rax
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf2_100
+    jmp .Lf2_101
+.Lf2_100:
+    movq $68, %rax
+    jmp .Lf2_102
+.Lf2_101:
+    movslq -48(%rbp), %rax
+.Lf2_102:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_97
+    jmp .Lf2_98
+.Lf2_97:
+    movq $5, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $56, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf2_99
+.Lf2_98:
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $12, %rax
+    cmpq $0, %rax
+    jne .Lf2_103
+    jmp .Lf2_104
+.Lf2_103:
+    movq $78, %rax
+    jmp .Lf2_105
+.Lf2_104:
+    movslq -4(%rbp), %rax
+.Lf2_105:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_99:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf2_84:
+    .loc 1 316 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_111
+    .p2align 4,,10
+.Lf2_110:
+    .loc 1 317 9
+    movq $1, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_113
+    jmp .Lf2_112
+.Lf2_113:
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_112:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 318 9
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    subl -60(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_114
+    jmp .Lf2_115
+.Lf2_114:
+    movslq -72(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_116
+.Lf2_115:
+    leaq -144(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_117
+    jmp .Lf2_118
+.Lf2_117:
+    movslq -20(%rbp), %rax
+    jmp .Lf2_119
+.Lf2_118:
+    movq $34, %rax
+.Lf2_119:
+.Lf2_116:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 319 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_125
+    .p2align 4,,10
+.Lf2_124:
+    .loc 1 320 13
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    imulq $18, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_127
+    jmp .Lf2_126
+.Lf2_127:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_129
+.Lf2_128:
+    movq $43, %rax
+    jmp .Lf2_130
+.Lf2_129:
+    movq $33, %rax
+.Lf2_130:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_132
+    jmp .Lf2_131
+.Lf2_132:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_131:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_126:
+    movl %eax, -12(%rbp)
+    .loc 1 321 13
+    movq $1, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_133
+    jmp .Lf2_134
+.Lf2_133:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf2_135
+.Lf2_134:
+    movq $79, %rax
+.Lf2_135:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $94, %rax
+    cmpq $92, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $8, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 322 13
+    movq $3, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_136
+    jmp .Lf2_137
+.Lf2_136:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    jmp .Lf2_138
+.Lf2_137:
+    movslq -340(%rbp), %rax
+.Lf2_138:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_139
+    jmp .Lf2_140
+.Lf2_139:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_141
+.Lf2_140:
+    movslq -340(%rbp), %rax
+.Lf2_141:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_123:
+    .loc 1 319 34
+    incl -344(%rbp)
+.Lf2_125:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_124
+.Lf2_122:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_109:
+    .loc 1 316 30
+    incl -340(%rbp)
+.Lf2_111:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_110
+.Lf2_108:
+    addq $8, %rsp
+    .loc 1 326 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 327 9
+    .p2align 4,,10
+.Lf2_144:
+    .loc 1 328 13
+    movslq -16(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 329 13
+    movq $6, %rax
+    push %rax
+    cmpl $55, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 330 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf2_150
+    .p2align 4,,10
+.Lf2_149:
+    .loc 1 331 17
+    movq $35, %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $89, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_154
+    jmp .Lf2_147
+.Lf2_154:
+    .loc 1 332 17
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $53, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 333 17
+    movq $7, %rax
+    push %rax
+    movq $58, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_156
+    jmp .Lf2_155
+.Lf2_156:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_155:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 334 17
+    movslq -52(%rbp), %rax
+    subq $92, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $99, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -52(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_158
+    jmp .Lf2_157
+.Lf2_158:
+    movq $7, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_157:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_153:
+    .loc 1 330 38
+    incl -344(%rbp)
+    .loc 1 331 17
+    movq $35, %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $89, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_159
+    jmp .Lf2_147
+.Lf2_159:
+    .loc 1 332 17
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $53, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 333 17
+    movq $7, %rax
+    push %rax
+    movq $58, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_161
+    jmp .Lf2_160
+.Lf2_161:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_160:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 334 17
+    movslq -52(%rbp), %rax
+    subq $92, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $99, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -52(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_163
+    jmp .Lf2_162
+.Lf2_163:
+    movq $7, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_162:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_152:
+    .loc 1 330 38
+    incl -344(%rbp)
+.Lf2_150:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $6, %rax
+    jl .Lf2_149
+.Lf2_151:
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf2_147
+    .loc 1 331 17
+    movq $35, %rax
+    cmpq $51, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $89, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_164
+    jmp .Lf2_147
+.Lf2_164:
+    .loc 1 332 17
+    movq $7, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $53, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 333 17
+    movq $7, %rax
+    push %rax
+    movq $58, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_166
+    jmp .Lf2_165
+.Lf2_166:
+    movq $20, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_165:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 334 17
+    movslq -52(%rbp), %rax
+    subq $92, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    imulq $99, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -52(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_168
+    jmp .Lf2_167
+.Lf2_168:
+    movq $7, %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_167:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_148:
+    .loc 1 330 38
+    incl -344(%rbp)
+    jmp .Lf2_151
+.Lf2_147:
+    addq $0, %rsp
+    .loc 1 336 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_143:
+    .loc 1 337 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_144
+.Lf2_142:
+    addq $8, %rsp
+    .loc 1 339 5
+    movslq -4(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_169
+    jmp .Lf2_170
+.Lf2_169:
+    movq $79, %rax
+    cmpq $0, %rax
+    jne .Lf2_172
+    jmp .Lf2_173
+.Lf2_172:
+    movslq -12(%rbp), %rax
+    jmp .Lf2_174
+.Lf2_173:
+    movq $77, %rax
+.Lf2_174:
+    jmp .Lf2_171
+.Lf2_170:
+    movslq -20(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_171:
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_176
+    jmp .Lf2_175
+.Lf2_176:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_175:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_178
+    jmp .Lf2_177
+.Lf2_178:
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_177:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 341 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 342 9
+    .p2align 4,,10
+.Lf2_181:
+    .loc 1 344 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 345 17
+    jmp .Lf2_185
+    .p2align 4,,10
+.Lf2_184:
+    .loc 1 346 21
+    movq $3, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 347 21
+    movslq -60(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_187
+    jmp .Lf2_186
+.Lf2_187:
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_186:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_189
+    jmp .Lf2_188
+.Lf2_189:
+    movslq -16(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_190
+    jmp .Lf2_191
+.Lf2_190:
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_192
+.Lf2_191:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf2_193
+    jmp .Lf2_194
+.Lf2_193:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_195
+.Lf2_194:
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf2_195:
+.Lf2_192:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_188:
+    movl %eax, -16(%rbp)
+    .loc 1 348 21
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_197
+    jmp .Lf2_196
+.Lf2_197:
+    movq $73, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_196:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_199
+    jmp .Lf2_198
+.Lf2_199:
+    movslq -344(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_198:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 349 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_183:
+.Lf2_185:
+    .loc 1 345 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_184
+.Lf2_182:
+    addq $0, %rsp
+    .loc 1 352 13
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    imulq $57, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_204
+    jmp .Lf2_203
+.Lf2_204:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_203:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_200
+    jmp .Lf2_201
+.Lf2_200:
+    movq $16, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_205
+    jmp .Lf2_206
+.Lf2_205:
+    movq $19, %rax
+    cmpq $23, %rax
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_207
+.Lf2_206:
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf2_207:
+    jmp .Lf2_202
+.Lf2_201:
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf2_202:
+    movl %eax, -4(%rbp)
+    .loc 1 353 13
+    movq $2, %rax
+    push %rax
+    movq $46, %rax
+    cmpq $0, %rax
+    jne .Lf2_208
+    jmp .Lf2_209
+.Lf2_208:
+    movq $93, %rax
+    jmp .Lf2_210
+.Lf2_209:
+    movq $62, %rax
+.Lf2_210:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -20(%rbp)
+    .loc 1 354 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_180:
+    .loc 1 355 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_181
+.Lf2_179:
+    addq $8, %rsp
+    .loc 1 358 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 359 9
+    .p2align 4,,10
+.Lf2_213:
+    .loc 1 361 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 362 17
+    jmp .Lf2_217
+    .p2align 4,,10
+.Lf2_216:
+    .loc 1 363 21
+    movq $6, %rax
+    push %rax
+    movslq -72(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $11, %rax
+    cmpq $99, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_219
+    jmp .Lf2_218
+.Lf2_219:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_218:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 364 21
+    movslq -344(%rbp), %rax
+    subq $42, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_220
+    jmp .Lf2_221
+.Lf2_220:
+    movq $10, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_224
+    jmp .Lf2_223
+.Lf2_224:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_223:
+    jmp .Lf2_222
+.Lf2_221:
+    movq $6, %rax
+    push %rax
+    movq $66, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf2_222:
+    push %rax
+    movq $3, %rax
+    push %rax
+    cmpl $84, -56(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 365 21
+    movslq -340(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_226
+    jmp .Lf2_225
+.Lf2_226:
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_225:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $19, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -60(%rbp)
+    .loc 1 366 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_215:
+.Lf2_217:
+    .loc 1 362 24
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_216
+.Lf2_214:
+    addq $0, %rsp
+    .loc 1 369 13
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_228
+    jmp .Lf2_227
+.Lf2_228:
+    movq $91, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_227:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $88, -20(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_229
+    jmp .Lf2_230
+.Lf2_229:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_233
+    jmp .Lf2_232
+.Lf2_233:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_232:
+    jmp .Lf2_231
+.Lf2_230:
+    movslq -32(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_231:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 370 13
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    subl -68(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -44(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 371 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_212:
+    .loc 1 372 18
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_213
+.Lf2_211:
+    addq $8, %rsp
+    .loc 1 374 5
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_235
+    jmp .Lf2_234
+.Lf2_235:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_234:
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
+.globl f3
+.type f3, @function
+    .p2align 4
+f3:
+    .cfi_startproc
+    .loc 1 376 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 377 5
+    subq $8, %rsp
+    movq $58, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 378 5
+    movq $23, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 379 5
+    subq $8, %rsp
+    movq $14, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 380 5
+    movq $56, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 381 5
+    subq $64, %rsp
+    .loc 1 382 5
+    subq $256, %rsp
+    .loc 1 383 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_6
+    .p2align 4,,10
+.Lf3_5:
+    .loc 1 384 9
+    movq $2, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $19, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_7
+    jmp .Lf3_8
+.Lf3_7:
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_9
+.Lf3_8:
+    movq $65, %rax
+    cmpq $0, %rax
+    jne .Lf3_13
+    jmp .Lf3_14
+.Lf3_13:
+    movq $29, %rax
+    jmp .Lf3_15
+.Lf3_14:
+    leaq -272(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf3_15:
+    cmpq $0, %rax
+    jne .Lf3_10
+    jmp .Lf3_11
+.Lf3_10:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_16
+    jmp .Lf3_17
+.Lf3_16:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_18
+.Lf3_17:
+    movslq -36(%rbp), %rax
+.Lf3_18:
+    jmp .Lf3_12
+.Lf3_11:
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_12:
+.Lf3_9:
+    movl %eax, -16(%rbp)
+    .loc 1 386 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 387 13
+    .p2align 4,,10
+.Lf3_21:
+    .loc 1 388 17
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $61, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imulq $33, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 389 17
+    movq $73, %rax
+    cmpq $0, %rax
+    jne .Lf3_22
+    jmp .Lf3_23
+.Lf3_22:
+    movq $14, %rax
+    jmp .Lf3_24
+.Lf3_23:
+    movslq -60(%rbp), %rax
+.Lf3_24:
+    push %rax
+    movslq -16(%rbp), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpq $1, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    .loc 1 390 17
+    movq $2, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $28, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -60(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 391 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_20:
+    .loc 1 392 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_21
+.Lf3_19:
+    addq $0, %rsp
+    .loc 1 394 9
+    movq $52, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_26
+    jmp .Lf3_25
+.Lf3_26:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_28
+    jmp .Lf3_27
+.Lf3_28:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_27:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_25:
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lf3_4:
+    .loc 1 383 30
+    incl -340(%rbp)
+.Lf3_6:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_5
+.Lf3_3:
+    addq $8, %rsp
+    .loc 1 396 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_34
+    .p2align 4,,10
+.Lf3_33:
+    .loc 1 398 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 399 13
+    .p2align 4,,10
+.Lf3_37:
+    .loc 1 400 17
+    cmpl $49, -76(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -72(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf3_38
+    jmp .Lf3_39
+.Lf3_38:
+    movq $28, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_45
+    jmp .Lf3_44
+.Lf3_45:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_44:
+    cmpq $0, %rax
+    jne .Lf3_41
+    jmp .Lf3_42
+.Lf3_41:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_47
+    jmp .Lf3_46
+.Lf3_47:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_46:
+    jmp .Lf3_43
+.Lf3_42:
+    movq $31, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf3_43:
+    jmp .Lf3_40
+.Lf3_39:
+    movq $2, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_49
+    jmp .Lf3_48
+.Lf3_49:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_50
+    jmp .Lf3_51
+.Lf3_50:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_52
+.Lf3_51:
+    movslq -12(%rbp), %rax
+.Lf3_52:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_48:
+.Lf3_40:
+    movl %eax, -12(%rbp)
+    .loc 1 401 17
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_54
+    jmp .Lf3_53
+.Lf3_54:
+    movq $66, %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_53:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -28(%rbp)
+    .loc 1 402 17
+    movslq -344(%rbp), %rax
+    cmpl -72(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_55
+    jmp .Lf3_56
+.Lf3_55:
+    movslq -68(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_57
+.Lf3_56:
+    movq $24, %rax
+    addl -64(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_57:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 403 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_36:
+    .loc 1 404 22
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_37
+.Lf3_35:
+    addq $0, %rsp
+    .loc 1 406 9
+    movq $30, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_59
+    jmp .Lf3_58
+.Lf3_59:
+    movslq -72(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_58:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $41, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 407 9
+    movq $7, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf3_32:
+    .loc 1 396 30
+    incl -340(%rbp)
+.Lf3_34:
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_33
+.Lf3_31:
+    addq $8, %rsp
+    .loc 1 409 5
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $16, %rax
+    cmpq $41, %rax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_61
+    jmp .Lf3_60
+.Lf3_61:
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_62
+    jmp .Lf3_63
+.Lf3_62:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_64
+.Lf3_63:
+    movslq -8(%rbp), %rax
+.Lf3_64:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_60:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 410 5
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    jne .Lf3_65
+    jmp .Lf3_66
+.Lf3_65:
+    movslq -8(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_68
+    jmp .Lf3_69
+.Lf3_68:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_70
+.Lf3_69:
+    movslq -20(%rbp), %rax
+.Lf3_70:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf3_67
+.Lf3_66:
+    movq $53, %rax
+    cmpq $0, %rax
+    jne .Lf3_71
+    jmp .Lf3_72
+.Lf3_71:
+    movslq -4(%rbp), %rax
+    jmp .Lf3_73
+.Lf3_72:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+.Lf3_73:
+    push %rax
+    movq $3, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+.Lf3_67:
+    movl %eax, -16(%rbp)
+    .loc 1 412 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 413 9
+    jmp .Lf3_77
+    .p2align 4,,10
+.Lf3_76:
+    .loc 1 414 13
+    movslq -340(%rbp), %rax
+    addq $64, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $40, %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_79
+    jmp .Lf3_78
+.Lf3_79:
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_81
+    jmp .Lf3_80
+.Lf3_81:
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_80:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_78:
+    movl %eax, -4(%rbp)
+    .loc 1 415 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf3_87
+    .p2align 4,,10
+.Lf3_86:
+    .loc 1 416 17
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $96, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_88
+    jmp .Lf3_84
+.Lf3_88:
+    .loc 1 417 17
+    movslq -12(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_90
+    jmp .Lf3_89
+.Lf3_90:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_92
+    jmp .Lf3_91
+.Lf3_92:
+    movq $56, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_91:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_89:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 56(%rax), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_93
+    jmp .Lf3_94
+.Lf3_93:
+    movslq -16(%rbp), %rax
+    addl -40(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf3_95
+.Lf3_94:
+    movq $4, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf3_95:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 418 17
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_97
+    jmp .Lf3_96
+.Lf3_97:
+    movq $26, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_96:
+    push %rax
+    movslq -340(%rbp), %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_99
+    jmp .Lf3_98
+.Lf3_99:
+    movslq -16(%rbp), %rax
+    imulq $47, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_98:
+    movl %eax, -4(%rbp)
+    .loc 1 419 17
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_100
+    jmp .Lf3_101
+.Lf3_100:
+    movq $9, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_102
+.Lf3_101:
+    movq $89, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_103
+    jmp .Lf3_104
+.Lf3_103:
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_106
+    jmp .Lf3_107
+.Lf3_106:
+    movq $91, %rax
+    jmp .Lf3_108
+.Lf3_107:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+.Lf3_108:
+    jmp .Lf3_105
+.Lf3_104:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf3_105:
+.Lf3_102:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_85:
+    .loc 1 415 38
+    incl -344(%rbp)
+.Lf3_87:
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_86
+.Lf3_84:
+    addq $0, %rsp
+    .loc 1 421 13
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $36, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 422 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_75:
+.Lf3_77:
+    .loc 1 413 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_76
+.Lf3_74:
+    addq $8, %rsp
+    .loc 1 425 5
+    movq $7, %rax
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $67, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_110
+    jmp .Lf3_111
+.Lf3_110:
+    movslq -8(%rbp), %rax
+    jmp .Lf3_112
+.Lf3_111:
+    movslq -72(%rbp), %rax
+.Lf3_112:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf3_113
+    .loc 1 426 9
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_118
+    jmp .Lf3_117
+.Lf3_118:
+    leaq -336(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_117:
+    cmpq $0, %rax
+    jne .Lf3_114
+    jmp .Lf3_115
+.Lf3_114:
+    movslq -32(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_120
+    jmp .Lf3_119
+.Lf3_120:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_119:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf3_116
+.Lf3_115:
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    push %rax
+    movq $4, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $55, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+.Lf3_116:
+    movl %eax, -12(%rbp)
+    .loc 1 427 9
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_121
+    jmp .Lf3_122
+.Lf3_121:
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    jmp .Lf3_123
+.Lf3_122:
+    movslq -12(%rbp), %rax
+.Lf3_123:
+    push %rax
+    movq $88, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $13, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 428 9
+    movq $9, %rax
+    push %rax
+    movq $98, %rax
+    cmpq $83, %rax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_125
+    jmp .Lf3_124
+.Lf3_125:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_124:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_109
+.Lf3_113:
+    .loc 1 430 9
+    movq $6, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_129
+    jmp .Lf3_130
+.Lf3_129:
+    movq $42, %rax
+    jmp .Lf3_131
+.Lf3_130:
+    movq $27, %rax
+.Lf3_131:
+    cmpq $0, %rax
+    jne .Lf3_126
+    jmp .Lf3_127
+.Lf3_126:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_128
+.Lf3_127:
+    movslq -12(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_128:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 431 9
+    movq $50, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_136
+    jmp .Lf3_135
+.Lf3_136:
+    movq $21, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_135:
+    cmpq $0, %rax
+    jne .Lf3_132
+    jmp .Lf3_133
+.Lf3_132:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $71, %rax
+    movq $0, %rax
+    setg %al
+    jmp .Lf3_134
+.Lf3_133:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_138
+    jmp .Lf3_137
+.Lf3_138:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_137:
+.Lf3_134:
+    push %rax
+    movq $83, %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_140
+    jmp .Lf3_139
+.Lf3_140:
+    movq $65, %rax
+    cmpq $0, %rax
+    jne .Lf3_141
+    jmp .Lf3_142
+.Lf3_141:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_143
+.Lf3_142:
+    movq $95, %rax
+.Lf3_143:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_139:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 432 9
+    movq $11, %rax
+    cmpq $27, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $51, %rax
+    cmpq $57, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_144
+    jmp .Lf3_145
+.Lf3_144:
+    movslq -52(%rbp), %rax
+    jmp .Lf3_146
+.Lf3_145:
+    leaq -336(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf3_146:
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lf3_109:
+    .loc 1 434 5
+    movq $89, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_148
+    jmp .Lf3_147
+.Lf3_148:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_150
+    jmp .Lf3_149
+.Lf3_150:
+    movq $30, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_149:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_147:
+    movl %eax, -68(%rbp)
+    .loc 1 435 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf3_156
+    .p2align 4,,10
+.Lf3_155:
+    .loc 1 436 9
+    cmpl $96, -16(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_158
+    jmp .Lf3_157
+.Lf3_158:
+    movq $48, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_157:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_159
+    jmp .Lf3_160
+.Lf3_159:
+    movslq -48(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf3_161
+.Lf3_160:
+    movslq -16(%rbp), %rax
+    imulq $0, %rax
+    movslq %eax, %rax
+.Lf3_161:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 437 9
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_163
+    jmp .Lf3_162
+.Lf3_163:
+    movq $5, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_168
+    jmp .Lf3_167
+.Lf3_168:
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_167:
+    cmpq $0, %rax
+    jne .Lf3_164
+    jmp .Lf3_165
+.Lf3_164:
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_166
+.Lf3_165:
+    movq $44, %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_166:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_162:
+    movl %eax, -32(%rbp)
+    .loc 1 439 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 440 13
+    .p2align 4,,10
+.Lf3_171:
+    .loc 1 441 17
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    imull -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 442 17
+    cmpl $51, -16(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf3_172
+    jmp .Lf3_173
+.Lf3_172:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_176
+    jmp .Lf3_175
+.Lf3_176:
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_175:
+    jmp .Lf3_174
+.Lf3_173:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_177
+    jmp .Lf3_178
+.Lf3_177:
+    movslq -340(%rbp), %rax
+    jmp .Lf3_179
+.Lf3_178:
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+.Lf3_179:
+.Lf3_174:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_181
+    jmp .Lf3_180
+.Lf3_181:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_180:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_183
+    jmp .Lf3_182
+.Lf3_183:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_182:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -4(%rbp)
+    .loc 1 443 17
+    movslq -344(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_184
+    jmp .Lf3_185
+.Lf3_184:
+    movq $2, %rax
+    push %rax
+    movq $46, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf3_186
+.Lf3_185:
+    movq $43, %rax
+    subq $99, %rax
+    movslq %eax, %rax
+.Lf3_186:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 52(%rax)
+    movq %rdx, %rax
+    .loc 1 444 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_170:
+    .loc 1 445 22
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_171
+.Lf3_169:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf3_154:
+    .loc 1 435 30
+    incl -340(%rbp)
+.Lf3_156:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_155
+.Lf3_153:
+    addq $8, %rsp
+    .loc 1 449 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 450 9
+    .p2align 4,,10
+.Lf3_189:
+    .loc 1 451 13
+    movq $4, %rax
+    push %rax
+    movslq -56(%rbp), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 453 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 454 17
+    .p2align 4,,10
+.Lf3_192:
+    .loc 1 455 21
+    movslq -4(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_194
+    jmp .Lf3_193
+.Lf3_194:
+    movq $39, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_193:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $27, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $83, -4(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 456 21
+    movslq -12(%rbp), %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 457 21
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_195
+    jmp .Lf3_196
+.Lf3_195:
+    movslq -36(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_199
+    jmp .Lf3_198
+.Lf3_199:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_198:
+    jmp .Lf3_197
+.Lf3_196:
+    movq $14, %rax
+    cmpq $74, %rax
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $99, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf3_197:
+    movl %eax, -8(%rbp)
+    .loc 1 458 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf3_191:
+    .loc 1 459 26
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_192
+.Lf3_190:
+    addq $0, %rsp
+    .loc 1 461 13
+    movq $18, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $71, -340(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_201
+    jmp .Lf3_200
+.Lf3_201:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_200:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 462 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf3_188:
+    .loc 1 463 18
+    cmpl $4, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf3_189
+.Lf3_187:
+    addq $8, %rsp
+    .loc 1 465 5
+    movq $5, %rax
+    push %rax
+    movq $78, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $77, %rax
+    imull -64(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf3_203
+    .loc 1 466 9
+    movslq -12(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf3_204
+    jmp .Lf3_205
+.Lf3_204:
+    cmpl $97, -24(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf3_206
+.Lf3_205:
+    movq $1, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf3_206:
+    push %rax
+    cmpl $32, -16(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf3_208
+    jmp .Lf3_207
+.Lf3_208:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_207:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -24(%rbp)
+    .loc 1 467 9
+    movq $57, %rax
+    cmpq $0, %rax
+    jne .Lf3_212
+    jmp .Lf3_213
+.Lf3_212:
+    movq $85, %rax
+    jmp .Lf3_214
+.Lf3_213:
+    movslq -16(%rbp), %rax
+.Lf3_214:
+    cmpq $0, %rax
+    jne .Lf3_209
+    jmp .Lf3_210
+.Lf3_209:
+    movslq -44(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf3_211
+.Lf3_210:
+    cmpl $35, -8(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf3_211:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_218
+    jmp .Lf3_219
+.Lf3_218:
+    movslq -12(%rbp), %rax
+    jmp .Lf3_220
+.Lf3_219:
+    leaq -144(%rbp), %rax
+    movslq 20(%rax), %rax
+.Lf3_220:
+    cmpq $0, %rax
+    jne .Lf3_215
+    jmp .Lf3_216
+.Lf3_215:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf3_221
+    jmp .Lf3_222
+.Lf3_221:
+    movslq -40(%rbp), %rax
+    jmp .Lf3_223
+.Lf3_222:
+    movslq -16(%rbp), %rax
+.Lf3_223:
+    jmp .Lf3_217
+.Lf3_216:
+    movq $25, %rax
+    subl -32(%rbp), %eax
+    movslq %eax, %rax
+.Lf3_217:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 468 9
+    movq $3, %rax
+    push %rax
+    movq $5, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_224
+    jmp .Lf3_225
+.Lf3_224:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_226
+.Lf3_225:
+    movslq -8(%rbp), %rax
+.Lf3_226:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -72(%rbp)
+    addq $0, %rsp
+    jmp .Lf3_202
+.Lf3_203:
+    .loc 1 470 9
+    movq $24, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $61, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_228
+    jmp .Lf3_227
+.Lf3_228:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_227:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 471 9
+    movq $2, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_229
+    jmp .Lf3_230
+.Lf3_229:
+    movq $70, %rax
+    jmp .Lf3_231
+.Lf3_230:
+    movslq -64(%rbp), %rax
+.Lf3_231:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_232
+    jmp .Lf3_233
+.Lf3_232:
+    movq $5, %rax
+    jmp .Lf3_234
+.Lf3_233:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf3_234:
+    push %rax
+    movq $25, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 472 9
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_235
+    jmp .Lf3_236
+.Lf3_235:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_237
+.Lf3_236:
+    movslq -76(%rbp), %rax
+.Lf3_237:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_238
+    jmp .Lf3_239
+.Lf3_238:
+    movslq -16(%rbp), %rax
+    jmp .Lf3_240
+.Lf3_239:
+    movslq -16(%rbp), %rax
+.Lf3_240:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -40(%rbp)
+    addq $0, %rsp
+.Lf3_202:
+    .loc 1 474 5
+    movslq -16(%rbp), %rax
+    subl -80(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_242
+    jmp .Lf3_241
+.Lf3_242:
+    movq $87, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_241:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf3_243
+    jmp .Lf3_244
+.Lf3_243:
+    movq $0, %rax
+    jmp .Lf3_245
+.Lf3_244:
+    movslq -12(%rbp), %rax
+.Lf3_245:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf3_247
+    jmp .Lf3_246
+.Lf3_247:
+    movslq -8(%rbp), %rax
+    subl -56(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf3_246:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf3_end
+    movq $0, %rax
+.Lf3_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f3, .-f3
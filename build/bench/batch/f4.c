@@ -0,0 +1,99 @@
+int f0() {
+    int v0 = 11;
+    int v1 = 14;
+    int v2 = 67;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 + 17) ? (v1 ? v0 : v0) : (4 <= v3)) <= ((v0 || a0[14]) < (v1 != v1)))) {
+        a1[3][11] = (((v3 * a1[3][4]) ? (a1[3][15] && 14) : (a0[0] - 42)) != ((v3 % 7) % 7));
+        v0 = (((a1[3][0] - v2) && (v3 == a0[13])) != ((11 == v3) ? (49 <= v2) : (v3 && v0)));
+        v3 = (((45 > v3) * (79 == 54)) ? ((v3 ? 11 : 89) || (a1[0][0] != a0[11])) : ((v1 || v1) == (41 - 35)));
+    } else {
+        v0 = (((v2 ? v0 : v3) == (v2 >= v1)) % 5);
+        v2 = (((8 == 98) && (12 || v1)) - ((v0 * v2) == (a1[3][15] == v2)));
+        v1 = (((a1[1][12] * v2) ? (71 <= v0) : (v3 ? 44 : a1[1][9])) / 3);
+    }
+    if ((((v0 >= 89) || (v2 != v1)) == ((67 * v1) / 5))) {
+        a1[3][0] = (((v1 / 5) <= (v0 * a1[2][9])) >= ((v0 == v3) * (v2 - a0[2])));
+        a0[0] = (((a0[11] && a0[11]) % 2) <= ((v1 < v2) == (v0 <= a0[4])));
+        a1[1][14] = (((v1 * 27) + (a0[3] >= 32)) / 7);
+    } else {
+        v2 = (((v2 > v0) * (v3 > a1[3][9])) > ((99 && a1[0][0]) && (v1 <= v2)));
+        a0[3] = (((v3 ? v2 : v2) >= (a1[0][2] < 18)) >= ((89 < a1[0][6]) <= (a1[3][8] < a0[3])));
+        v3 = (((v0 ? v3 : v0) / 7) || ((v1 % 3) || (v3 >= a1[1][0])));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((34 + a1[2][7]) > 90) break;
+        v3 = (((v2 != i0) || (79 >= v3)) - ((i0 == v0) / 1));
+        {
+            int i1 = 0;
+            do {
+                v3 = (((a0[15] + 78) % 9) * ((v1 && v3) >= (a0[1] * v2)));
+                v1 = (((v1 && i0) == (v3 != a1[1][8])) - ((a0[13] == 14) >= (84 == a1[1][1])));
+                a1[2][2] = (((i1 && 3) || (a0[8] || 19)) * ((a0[11] != a0[15]) > (i1 ? a1[2][6] : v0)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        a0[5] = (((v2 < v1) && (v1 != v3)) > ((a0[0] && v3) - (a1[1][10] % 9)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((a0[12] >= v3) > 80) break;
+        a1[3][8] = (((i2 ? a1[2][5] : 53) != (v0 != v0)) != ((v1 / 7) < (v0 ? v0 : 83)));
+        v0 = (((v0 ? v1 : a0[0]) - (a1[3][7] > v3)) == ((i2 - v3) - (v3 + 68)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v3 = (((3 * v1) - (a0[8] || i2)) < ((v1 == v2) >= (v0 || i3)));
+                a1[1][2] = (((v0 || i2) % 5) / 8);
+                v1 = (((53 && v3) > (v1 ? a1[2][14] : 38)) == ((v3 >= v1) * (v2 == 14)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((a0[13] >= a0[13]) % 2) - ((v3 == v2) <= (a0[1] ? 25 : v2)))) {
+        a0[1] = (((a0[14] > 0) || (93 == a0[3])) < ((26 && 65) || (v1 % 4)));
+        a1[0][12] = (((84 - 58) ? (v3 + v0) : (67 * v1)) - ((12 - v1) - (a0[14] / 2)));
+        v1 = (((v2 ? a0[0] : 54) != (57 / 2)) ? ((a0[1] < v1) % 1) : ((38 % 6) + (99 ? v2 : v1)));
+    } else {
+        a0[13] = (((41 > v0) > (v1 < 80)) ? ((v2 <= v2) % 3) : ((11 / 1) || (72 - a0[14])));
+        a0[0] = (((v2 && a1[2][14]) >= (27 - a1[0][11])) ? ((v0 && v1) != (v2 < v1)) : ((20 * 5) && (v3 ? 51 : 66)));
+        v0 = (((a1[2][13] > 84) ? (v3 < v2) : (v1 > v1)) ? ((v0 / 5) < (v0 > v3)) : ((v3 || a1[2][7]) < (a0[11] <= 55)));
+    }
+    a1[0][5] = (((v1 + v3) + (a0[11] <= a0[4])) || ((v1 >= v2) ? (a1[0][14] / 7) : (v1 != v1)));
+    {
+        int i4 = 0;
+        do {
+            v1 = (((71 != 78) != (v0 != 92)) * ((v1 - a1[2][5]) + (i4 ? v3 : v1)));
+            a1[1][14] = (((v0 <= 28) >= (47 ? 99 : 64)) / 4);
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                if ((v3 % 4) > 60) break;
+                a0[10] = (((i5 <= a0[11]) && (a0[5] >= a1[1][6])) == ((7 == v1) && (v1 ? i4 : v0)));
+                a0[8] = (((a0[10] ? v2 : i5) > (v2 % 9)) != ((3 + 18) * (42 / 2)));
+                v3 = (((v3 <= 46) - (v2 - 21)) > ((i5 ? a0[13] : 30) == (40 != v1)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    v0 = (((v2 / 7) * (v0 + a0[13])) % 6);
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v1 = (((v1 <= 54) != (i6 > v0)) ? ((v2 * v2) + (v2 - i7)) : ((v2 == 75) % 8));
+                v0 = (((i6 - 63) % 4) + ((i6 > a1[2][2]) > (54 != a0[1])));
+                v3 = (((47 < a1[1][4]) != (45 || v1)) / 7);
+                i7 = i7 + 1;
+            } while (i7 < 5);
+        }
+        v1 = (((90 / 6) / 5) % 7);
+        v0 = (((62 <= v2) % 6) <= ((a0[15] == a1[3][10]) - (71 * a0[14])));
+    }
+    v1 = (((v0 >= 48) > (v3 >= v1)) ? ((v0 > 81) ? (a1[3][14] % 1) : (a1[0][7] - v1)) : ((a0[10] || a0[14]) || (a1[1][4] > v3)));
+    return (((43 ? a1[0][5] : a0[5]) % 9) && ((v3 == a0[3]) - (v3 >= a1[3][9])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,125 @@
+int f0() {
+    int v0 = 36;
+    int v1 = 3;
+    int v2 = 44;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((23 - i0) == (v2 / 3)) - ((a1[2][15] / 3) ? (v3 != 9) : (0 >= v0)));
+            a1[1][14] = (((v3 == a0[5]) - (66 >= v0)) * ((v0 < v1) < (v3 - a0[14])));
+            {
+                int i1 = 0;
+                do {
+                    a1[3][8] = (((v2 < 95) + (a0[13] + v2)) % 8);
+                    v1 = (((v2 - a1[2][2]) + (a0[8] >= v3)) < ((v0 ? a1[1][10] : 89) % 3));
+                    v3 = (((a1[2][14] || i0) ? (v1 || i0) : (a0[7] == i1)) / 1);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v0 = (((a1[1][4] ? v1 : v0) ? (v1 != v0) : (v2 > 75)) || ((60 > 81) / 5));
+                v1 = (((v1 == a1[1][7]) >= (i2 && v3)) > ((i3 <= a1[2][2]) * (v3 != a0[9])));
+                a1[0][7] = (((v2 <= i2) || (60 <= 79)) && ((24 == a1[2][6]) / 3));
+            }
+            a0[5] = (((27 % 7) + (a1[3][10] <= a1[0][14])) * ((40 / 4) > (v0 <= v0)));
+            a0[14] = (((v1 <= 80) - (22 >= 66)) != ((84 + 59) + (a0[3] && 34)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    a0[2] = (((3 || v3) * (69 - 96)) > ((v2 ? v3 : a0[9]) + (a1[1][15] >= 72)));
+    {
+        int i4 = 0;
+        do {
+            v0 = (((51 + a0[14]) - (v2 < a0[8])) ? ((v1 % 8) ? (v2 % 2) : (i4 ? v1 : v2)) : ((v1 && a0[13]) >= (a0[1] <= 53)));
+            v0 = (((91 ? 91 : v3) < (a1[3][10] / 6)) + ((a1[3][11] / 8) ? (v3 <= v3) : (v1 && a0[3])));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((v0 + v3) == (i4 / 4)) == ((v0 == v3) + (20 + i4)));
+                    a0[7] = (((i5 ? i5 : v3) < (93 * 57)) % 7);
+                    v2 = (((v3 <= a0[9]) || (a0[5] * i4)) * ((53 != v1) && (a0[8] % 3)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v2 = (((85 ? v3 : 26) != (v1 && a1[2][11])) == ((77 ? v1 : a1[2][13]) - (v1 && v0)));
+            v1 = (((a0[1] == 39) || (i6 % 9)) % 2);
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v2 = (((a1[2][0] / 2) > (i6 && i7)) == ((v2 + 34) && (v0 == v1)));
+                v2 = (((v2 >= 16) == (v3 * a1[2][9])) > ((i6 > v0) > (v3 ? v2 : v0)));
+                v2 = (((17 || a0[14]) >= (34 && 27)) ? ((v3 && v2) ? (i7 % 8) : (i7 / 8)) : ((a1[3][2] ? a1[1][1] : a1[1][5]) % 7));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            v0 = (((v1 * v3) * (v2 && v1)) / 4);
+            v0 = (((a0[1] >= v2) <= (v0 != 22)) && ((v1 && 1) / 2));
+            {
+                int i9 = 0;
+                do {
+                    v0 = (((v3 > a1[3][6]) && (77 <= 78)) <= ((i8 >= v3) ? (8 || a1[1][7]) : (64 * v1)));
+                    v2 = (((v0 && i8) % 5) / 1);
+                    v2 = (((85 <= a0[5]) ? (a1[2][3] * a1[3][0]) : (59 ? v3 : 58)) * ((v1 || v2) ? (v3 / 6) : (v1 == a1[2][3])));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    v2 = (((79 > 33) || (9 / 1)) * ((a1[2][7] && 53) > (v0 ? v1 : 61)));
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        v2 = (((a1[2][14] == 40) || (a1[3][11] && a1[0][10])) ? ((i10 == i10) ? (i10 - 46) : (11 >= v3)) : ((a1[1][9] / 8) <= (a0[1] + 95)));
+        v1 = (((v2 <= 13) * (91 <= a0[1])) <= ((a0[7] % 2) - (v1 > a1[1][13])));
+        {
+            int i11 = 0;
+            do {
+                if ((a1[2][1] > i10) > 76) break;
+                v0 = (((83 * v1) <= (v0 || v3)) % 7);
+                a1[2][9] = (((v1 * 13) != (v0 % 9)) && ((v1 < a1[1][11]) * (v3 % 1)));
+                v3 = (((v3 + v3) < (v3 - v2)) || ((v0 >= i11) && (i11 - a1[1][3])));
+                i11 = i11 + 1;
+            } while (i11 < 4);
+        }
+    }
+    if ((((a0[15] != v0) + (v3 ? a1[1][1] : a1[1][3])) ? ((v0 % 8) * (v3 / 1)) : ((58 - v3) - (41 != v1)))) {
+        v3 = (((v1 / 3) && (a1[2][3] || v3)) ? ((v1 > 49) && (v0 ? a0[7] : v2)) : ((v1 - v2) ? (69 == a1[1][11]) : (a1[2][1] > v3)));
+        a1[0][0] = (((39 * v1) < (v1 / 6)) && ((v2 != v0) == (a1[1][5] < 32)));
+        v2 = (((38 + v3) * (v2 >= v0)) * ((v3 ? v2 : a0[11]) != (a1[2][14] || v3)));
+    } else {
+        v0 = (((88 % 8) == (v1 ? v1 : v0)) - ((a1[0][12] == a0[6]) == (a1[1][15] % 4)));
+        a0[4] = (((a1[3][11] ? v3 : v0) ? (a0[6] / 9) : (18 + a1[0][12])) ? ((v2 - a0[1]) > (v3 || a1[1][5])) : ((a1[2][0] ? v1 : a1[1][8]) != (50 != v0)));
+        v2 = (((v2 < v2) ? (v2 >= v1) : (v3 * v1)) > ((v3 > v2) <= (v2 - v1)));
+    }
+    if ((((a1[1][5] && v2) > (a1[1][11] <= a1[1][0])) * ((a0[5] / 6) ? (v0 / 2) : (v3 - 96)))) {
+        v1 = (((v0 + 70) && (v0 == 88)) <= ((30 ? v1 : v3) != (v2 % 9)));
+        v0 = (((v2 != 34) % 2) < ((93 <= v1) != (61 % 5)));
+        v1 = (((v2 ? 23 : v2) != (11 - a1[2][10])) - ((v2 < v2) == (v2 == v3)));
+    } else {
+        v2 = (((a0[11] * a0[9]) % 4) < ((v1 * 79) != (65 != v1)));
+        v1 = (((55 + 92) == (v1 / 8)) - ((a0[13] <= 81) > (v0 <= v2)));
+        v3 = (((27 <= v2) < (v2 <= 70)) == ((a0[3] - v1) <= (58 ? 7 : 96)));
+    }
+    return (((v2 * v1) * (a0[3] + v2)) % 4);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,203 @@
+int f0() {
+    int v0 = 42;
+    int v1 = 67;
+    int v2 = 76;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 % 5) < (v0 >= v3)) <= ((a1[3][13] >= a1[3][4]) || (a1[0][11] > 10)))) {
+        v0 = (((v3 >= v1) < (a0[11] != v3)) <= ((v2 <= 70) == (11 * a1[0][9])));
+        v1 = (((v2 / 3) && (v1 / 3)) + ((a1[1][5] % 8) == (v1 > v1)));
+        a0[12] = (((v2 != a0[11]) * (v0 < 17)) || ((a0[11] - v0) / 5));
+    } else {
+        v2 = (((58 || v1) < (2 + v1)) ? ((v2 ? a0[15] : v3) ? (v1 > v2) : (v2 - v0)) : ((v2 ? v3 : v0) / 9));
+        v2 = (((v1 % 6) >= (v1 - v0)) || ((v0 * 95) + (74 % 7)));
+        v0 = (((v2 == v1) * (a0[13] >= 25)) - ((v3 - a0[15]) <= (v0 + a0[0])));
+    }
+    if ((((a1[3][14] - a1[3][7]) ? (v0 >= 12) : (4 * v1)) < ((a0[1] ? v3 : a0[9]) <= (v0 ? v0 : 92)))) {
+        a0[15] = (((v0 >= 72) * (a0[11] >= v1)) != ((v2 > v0) >= (v0 + a1[1][10])));
+        a0[8] = (((a1[0][3] >= 49) || (a1[0][4] * v2)) ? ((a1[0][10] ? v2 : 23) <= (a1[2][6] ? v2 : 61)) : ((v2 && v2) ? (v2 || v1) : (v1 * 78)));
+        a1[1][2] = (((v3 / 1) || (v3 ? v0 : v3)) / 3);
+    } else {
+        a1[1][5] = (((v3 ? a0[15] : v0) ? (a1[2][15] * 87) : (56 == v1)) != ((v0 / 6) <= (v2 <= v1)));
+        v2 = (((v2 >= a0[13]) && (v3 * 3)) == ((v2 != 99) || (v1 == a0[5])));
+        v0 = (((v1 >= v1) + (v2 * a1[0][7])) ? ((63 > v1) - (v1 % 4)) : ((12 + 38) - (15 != 64)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a1[2][13] = (((v0 ? i1 : i0) <= (v0 || i1)) - ((v0 / 5) <= (v0 && a0[8])));
+            a0[2] = (((a0[3] != a0[5]) <= (96 < 63)) == ((v1 != 3) % 3));
+            v1 = (((37 <= a1[2][0]) || (v1 < v1)) == ((a0[14] <= v2) && (a0[14] >= i1)));
+        }
+        v1 = (((i0 - v1) >= (66 > 45)) ? ((a1[2][4] / 8) + (i0 <= 81)) : ((96 / 2) > (v1 < 66)));
+        a1[1][2] = (((a0[3] % 5) <= (a0[9] * 3)) == ((v0 != i0) > (i0 < v0)));
+    }
+    v3 = (((62 ? a0[1] : v3) % 5) ? ((a0[2] - v2) != (v0 <= a1[1][1])) : ((v0 < v0) - (a0[11] <= 59)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((0 && v1) > 65) break;
+            v2 = (((62 % 9) != (v2 % 6)) == ((82 + a0[0]) == (v2 - 2)));
+            a0[6] = (((14 || 6) * (v3 > v1)) == ((58 - 99) - (v2 % 3)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a0[2] * 90) * (v1 * a1[3][0])) * ((a0[7] > 65) == (a0[12] && a0[7])));
+                    v3 = (((v2 <= 50) && (a0[14] - 12)) ? ((a1[2][6] >= v2) || (v1 > i3)) : ((62 >= 64) - (a1[2][2] - v3)));
+                    a0[8] = (((a1[0][15] || 70) <= (a0[10] != 83)) && ((45 || 16) + (v2 + a1[2][15])));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v3 <= v3) + (v1 / 8)) >= ((v1 || v0) <= (v2 > v0)))) {
+        v1 = (((v3 == a0[1]) > (46 || a0[8])) ? ((61 * v1) / 7) : ((11 >= 40) == (13 || v3)));
+        v0 = (((v0 + v0) ? (v0 ? v1 : 27) : (93 > v2)) || ((85 == v0) > (69 != v0)));
+        a0[10] = (((29 / 2) ? (a1[1][2] || a1[0][5]) : (v1 ? a1[2][7] : v3)) || ((v1 == a1[1][13]) ? (a1[2][2] / 5) : (v2 < v0)));
+    } else {
+        v0 = (((37 <= v2) < (v1 <= 4)) < ((v0 + 27) != (41 == 17)));
+        v3 = (((v2 <= 58) < (v2 == v3)) % 5);
+        v0 = (((41 * 67) ? (v1 || v3) : (26 / 9)) ? ((a0[5] > a0[4]) >= (a1[1][0] * a0[10])) : ((v2 - v1) > (v2 / 6)));
+    }
+    if ((((v2 * a1[1][11]) / 1) == ((a1[2][7] + v2) == (a0[14] >= 85)))) {
+        a0[5] = (((v3 + v0) > (v0 - v1)) <= ((52 || v0) <= (v0 + a0[3])));
+        v2 = (((87 != a0[4]) >= (a1[1][10] > v0)) != ((a0[15] ? a0[5] : 60) >= (v1 == a0[7])));
+        v1 = (((v3 / 7) + (a1[3][11] > v2)) < ((v2 ? a0[1] : a1[1][2]) || (v0 % 6)));
+    } else {
+        a1[1][3] = (((v0 % 3) || (13 - v1)) - ((v3 % 3) != (a1[1][12] ? 30 : a1[3][9])));
+        a1[3][5] = (((v1 ? v2 : 68) == (a0[0] != a1[3][1])) < ((v0 - v2) % 6));
+        v3 = (((v0 > a1[1][2]) % 3) * ((a1[1][3] <= 29) != (v3 && v1)));
+    }
+    if ((((96 ? v0 : v2) < (v1 < 71)) > ((v1 || v2) % 1))) {
+        v1 = (((v0 >= v1) > (v0 != 64)) != ((v0 || v1) + (38 - 81)));
+        v1 = (((39 < v2) && (0 < v3)) >= ((v2 * v3) != (v0 != v1)));
+        v3 = (((v2 && a0[11]) || (v1 < 36)) && ((v3 - v3) / 5));
+    } else {
+        v2 = (((75 <= a0[5]) > (a1[0][5] + v0)) != ((a1[3][5] != 52) * (v2 + v0)));
+        v2 = (((v1 >= a0[0]) ? (v0 - v1) : (v0 > a0[2])) < ((v2 || a1[0][6]) != (39 < 48)));
+        v2 = (((a0[0] >= 87) && (v0 ? a1[2][12] : v1)) < ((93 % 1) ? (v1 < a0[0]) : (17 > v2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a0[12] = (((41 - a0[14]) * (v2 ? v0 : i4)) > ((a1[3][0] != i4) % 3));
+            a0[4] = (((v2 > 77) * (v3 == a0[0])) ? ((v3 + v3) % 6) : ((v3 >= i4) ? (v0 <= i4) : (v1 == v3)));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                if ((67 % 8) > 92) break;
+                a1[0][1] = (((v1 + a0[6]) * (v0 || a1[1][8])) < ((v3 != a1[3][0]) == (v2 && v3)));
+                v1 = (((29 ? a1[3][6] : 72) - (v2 || a0[7])) ? ((65 % 1) - (a1[0][9] == 13)) : ((v0 ? 88 : v1) < (v3 % 7)));
+                v3 = (((v2 || 63) ? (i5 || a1[1][11]) : (v3 > 21)) == ((90 < i5) <= (a1[2][14] ? i4 : v2)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v0 = (((v1 <= v2) && (86 + 13)) >= ((88 ? 84 : 79) <= (a0[6] == v1)));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v0 = (((v2 > i6) && (45 % 1)) && ((a1[3][2] < v0) + (5 < a1[0][1])));
+                a1[2][2] = (((80 < v1) / 2) && ((a0[6] < a0[13]) ? (58 > v1) : (a0[5] * v3)));
+                v1 = (((1 && v2) * (57 == 2)) >= ((i7 != i7) && (49 / 7)));
+            }
+            a1[3][14] = (((v1 == v0) * (a0[6] || 37)) - ((i6 >= v1) != (99 ? 99 : 25)));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    return (((a1[2][13] / 9) ? (v3 <= v3) : (v3 + a0[12])) ? ((a1[0][8] % 7) - (v0 / 5)) : ((58 % 6) + (v1 ? 73 : a0[2])));
+}
+int f1() {
+    int v0 = 36;
+    int v1 = 38;
+    int v2 = 51;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 && v0) % 8) + ((a0[4] ? a0[7] : a0[0]) != (v0 <= v3)))) {
+        a0[15] = (((72 ? v3 : a1[1][8]) - (a1[3][14] != v2)) ? ((8 >= a0[1]) > (44 ? v3 : v2)) : ((a0[1] / 6) <= (v3 * a0[7])));
+        v3 = (((v3 == v0) && (a0[7] ? a0[2] : a1[0][15])) + ((v0 == 45) / 4));
+        a1[0][12] = (((a1[2][4] < 49) ? (36 == v2) : (v3 < 74)) >= ((v1 - v2) >= (v2 - v1)));
+    } else {
+        v3 = (((41 + 0) >= (v1 <= v3)) || ((a0[13] > a0[15]) % 5));
+        v3 = (((81 % 9) != (a1[2][15] || v1)) <= ((85 / 1) - (a1[3][14] / 4)));
+        v1 = (((v2 > v0) * (v3 - v1)) % 4);
+    }
+    {
+        int i0 = 0;
+        do {
+            v3 = (((a0[10] > 49) ? (v1 + v3) : (i0 / 7)) / 1);
+            v3 = (((58 % 3) % 9) == ((77 > a0[1]) / 8));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v1 = (((v2 != v1) * (i1 ? i0 : 0)) >= ((v0 || i0) % 7));
+                v1 = (((17 % 2) >= (v1 || 41)) != ((a0[14] ? a1[3][1] : i0) ? (v3 + i0) : (i1 > 76)));
+                v3 = (((v1 ? a0[7] : 47) <= (40 && 73)) + ((a1[3][3] != a1[3][1]) < (a0[12] ? 12 : a0[0])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v2 = (((a0[11] > v0) && (i3 >= a0[6])) <= ((a0[10] ? a1[1][3] : a1[3][7]) % 3));
+            a0[6] = (((a1[1][14] % 5) >= (a1[2][1] < v0)) + ((a1[0][7] ? a0[6] : 58) % 8));
+            a1[0][3] = (((a1[2][5] > i3) - (i3 >= i2)) > ((v2 == v3) < (90 + 63)));
+        }
+        v3 = (((v1 && 42) <= (v0 ? 5 : v0)) || ((v3 <= a0[2]) && (11 >= 69)));
+        v0 = (((5 + v0) ? (a1[1][6] || 45) : (a1[3][15] * v0)) != ((v1 <= a0[5]) < (32 + a0[4])));
+    }
+    if ((((v3 % 5) ? (v0 && 55) : (a1[3][8] || 94)) ? ((a1[3][9] <= a1[1][8]) == (v3 || v0)) : ((v3 > v2) / 9))) {
+        v2 = (((v1 <= a0[14]) * (a0[0] || v1)) % 6);
+        v0 = (((94 / 2) + (50 < v1)) ? ((v1 || v3) <= (v3 + a1[2][7])) : ((v3 % 8) ? (a0[1] / 1) : (a1[1][3] + a1[2][10])));
+        v3 = (((a1[1][1] == a1[2][7]) <= (v3 - a1[0][0])) != ((a0[15] / 5) / 4));
+    } else {
+        a0[12] = (((v0 / 1) != (72 >= 98)) >= ((a0[5] % 2) != (a1[1][12] % 2)));
+        a1[3][4] = (((v1 % 8) < (90 && a1[3][1])) ? ((v3 ? v0 : 72) % 2) : ((a0[8] % 9) >= (a0[14] >= v3)));
+        a0[5] = (((a1[3][10] && 52) ? (v2 >= v2) : (85 >= 34)) >= ((v2 >= v2) >= (v2 > v0)));
+    }
+    if ((((v3 <= v1) > (v3 < v3)) % 4)) {
+        v0 = (((v2 ? a0[13] : 43) || (a0[12] / 8)) / 2);
+        a0[9] = (((v3 - a0[5]) < (v0 % 9)) && ((a1[0][5] / 9) % 8));
+        v2 = (((a0[14] ? a0[6] : a0[3]) ? (a1[2][3] < v1) : (a1[3][15] >= a0[4])) && ((a0[6] - 5) - (v2 || v3)));
+    } else {
+        v3 = (((v3 > 91) != (10 ? v1 : v0)) ? ((v0 != v2) || (a0[3] < a1[3][6])) : ((64 != 97) >= (v0 || v1)));
+        v3 = (((36 - v0) > (a1[1][8] % 2)) ? ((a1[1][6] == a1[0][2]) == (a1[3][5] % 9)) : ((v0 + v3) - (a1[1][2] >= v0)));
+        v3 = (((v2 + a0[6]) < (v1 && v3)) != ((a1[1][7] ? 35 : 65) == (36 - v1)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            {
+                int i5 = 0;
+                do {
+                    if ((60 ? v2 : 41) > 81) break;
+                    v2 = (((v3 + a0[5]) != (v2 < v2)) - ((v2 / 2) && (v1 || a1[1][5])));
+                    v1 = (((18 - v3) / 1) == ((v1 && a0[1]) % 4));
+                    a0[13] = (((25 != a1[0][3]) < (9 - 40)) != ((a1[0][14] && 87) < (v3 % 9)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v2 = (((i4 || 54) / 2) % 2);
+            v3 = (((a1[0][1] >= v1) == (v0 % 1)) + ((v1 % 8) ? (v3 >= v2) : (28 == a1[2][6])));
+            i4 = i4 + 1;
+        }
+    }
+    a1[2][9] = (((a0[1] - 15) * (v0 * v2)) - ((v0 && a0[13]) * (a0[4] < a0[4])));
+    v3 = (((91 / 8) ? (a0[12] < v0) : (89 != 76)) % 4);
+    if ((((v1 % 5) || (v2 + 7)) - ((17 / 4) + (39 != 32)))) {
+        a1[3][0] = (((13 != a1[3][7]) / 6) < ((v2 * v0) == (v0 ? v0 : v2)));
+        v2 = (((v0 <= v0) / 5) && ((12 * 39) && (a1[2][3] || v2)));
+        v3 = (((16 * a1[3][15]) == (v3 && v0)) % 3);
+    } else {
+        v0 = (((v0 && a0[8]) == (v1 / 6)) ? ((v1 != 60) >= (v3 + v1)) : ((v1 > a1[0][3]) ? (v1 * 12) : (v1 - 47)));
+        v3 = (((v0 || v2) != (v1 ? v1 : v0)) > ((96 ? v1 : v0) || (a1[1][7] != v2)));
+        a0[0] = (((a0[8] || v0) / 3) && ((v3 + a0[14]) && (v3 || a0[4])));
+    }
+    a1[1][10] = (((v0 < v3) <= (a1[3][7] ? v3 : v0)) < ((v0 < v2) % 2));
+    return (((v0 + v2) != (v1 || a0[9])) ? ((a1[3][0] < a0[1]) < (v2 ? v2 : v2)) : ((v1 < v2) != (v1 ? 55 : v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
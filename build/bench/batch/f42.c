@@ -0,0 +1,356 @@
+int f0() {
+    int v0 = 88;
+    int v1 = 8;
+    int v2 = 95;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v1 = (((v2 + i0) > (i0 * v2)) && ((a0[4] % 1) == (72 ? 74 : 91)));
+        {
+            int i1 = 0;
+            do {
+                if ((23 ? v3 : 77) > 50) break;
+                a0[3] = (((v1 || a1[2][3]) ? (i1 * a0[10]) : (v3 && a1[0][6])) || ((22 && i1) - (41 ? a0[7] : i0)));
+                v1 = (((a1[0][11] >= a1[1][5]) ? (i0 && 58) : (v3 % 8)) >= ((i0 ? i0 : 44) ? (v1 >= 57) : (i0 ? a0[14] : v0)));
+                a0[10] = (((96 ? v0 : i0) ? (97 >= 94) : (5 > a1[0][15])) >= ((v2 < v0) + (i0 == a0[3])));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v0 = (((v1 == v3) - (i0 / 2)) >= ((a0[13] != 82) % 2));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 < v1) > 66) break;
+            v0 = (((69 * a0[0]) >= (v2 >= 79)) ? ((84 > v0) < (10 ? v0 : v0)) : ((a1[1][4] / 1) == (v2 && v1)));
+            v3 = (((v3 < v0) <= (v2 <= 38)) % 4);
+            {
+                int i3 = 0;
+                do {
+                    if ((8 + v1) > 73) break;
+                    v1 = (((a1[0][13] + a1[1][8]) ? (v3 % 9) : (v2 ? a0[1] : v2)) > ((1 >= a1[0][1]) > (v2 % 8)));
+                    v0 = (((v3 < v2) ? (49 && a1[0][1]) : (a0[15] != v0)) / 4);
+                    v1 = (((v1 != v1) ? (i3 == a1[1][0]) : (i2 != i2)) < ((i2 ? a0[13] : a0[8]) / 5));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v0 = (((v2 - 67) == (v2 ? a1[0][7] : 66)) && ((v1 - a0[7]) < (a0[6] != 22)));
+    if ((((v1 != 87) ? (a0[6] <= 96) : (a0[8] + a1[2][15])) % 2)) {
+        v3 = (((v2 / 5) - (a1[0][9] > a1[0][1])) != ((a0[4] / 1) + (3 % 3)));
+        v3 = (((a0[12] && v1) % 1) < ((v0 > 79) || (1 && 17)));
+        v3 = (((a1[3][3] * 50) % 7) + ((v0 % 8) % 3));
+    } else {
+        v2 = (((v1 / 3) < (a0[15] != v2)) / 9);
+        v3 = (((17 || v0) % 7) % 2);
+        v0 = (((14 != v0) - (v2 * 59)) <= ((21 && a1[3][1]) < (v2 ? v2 : 82)));
+    }
+    v1 = (((v1 % 9) == (a0[11] * v1)) * ((82 + 85) ? (v2 >= v2) : (v2 + v1)));
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v2 = (((v2 && a1[1][11]) ? (99 ? v1 : a0[5]) : (v3 * v0)) * ((v2 || a1[1][1]) != (i4 ? v1 : v2)));
+            a0[4] = (((61 != v3) > (82 == v0)) >= ((v3 >= a0[8]) > (a0[10] || v0)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a0[13] = (((i4 && a0[8]) + (v0 ? v2 : v2)) != ((16 <= i5) > (54 / 5)));
+                v1 = (((a0[13] < a0[0]) || (16 * i4)) * ((v3 != v2) / 8));
+                v2 = (((a1[3][4] <= a1[3][7]) != (v1 - v0)) * ((i4 % 8) <= (v1 ? v2 : v1)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((13 <= v2) && (v1 + v0)) > ((a0[0] / 5) * (4 <= v0)))) {
+        a0[8] = (((v3 - a0[1]) / 9) > ((a1[1][9] || a1[2][15]) + (v2 ? v0 : 69)));
+        v1 = (((70 - v1) * (v1 % 7)) / 9);
+        v2 = (((a1[1][3] || v3) <= (v3 - 94)) && ((v0 < v2) > (v0 * v3)));
+    } else {
+        v3 = (((69 && 93) != (v2 == v2)) % 3);
+        v2 = (((v1 ? a1[0][2] : 76) <= (a1[3][7] <= v2)) ? ((v3 <= a0[12]) ? (v0 - 72) : (v3 ? v0 : v1)) : ((v1 * v0) ? (48 % 1) : (v3 == v2)));
+        v2 = (((60 % 4) && (a1[1][6] / 9)) != ((34 ? 8 : v1) == (83 ? a1[0][11] : v3)));
+    }
+    a0[7] = (((68 - v1) || (10 == 76)) + ((v3 < a1[0][8]) == (v0 * a0[1])));
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+            v3 = (((71 != v0) * (i6 >= v1)) > ((a1[2][12] + a1[2][2]) + (34 + v1)));
+            a0[1] = (((v0 ? 93 : v2) - (a0[9] || a0[14])) == ((v1 + 58) >= (80 ? 89 : 90)));
+            v1 = (((v0 <= a0[6]) ? (v0 - i7) : (v3 == a0[5])) * ((v3 + a1[2][9]) - (a0[0] || 99)));
+        }
+        v0 = (((98 >= v3) - (35 != a1[2][1])) && ((a0[0] < 56) >= (98 / 3)));
+        a0[7] = (((76 * 7) && (a1[0][9] || v1)) + ((i6 ? i6 : a0[13]) + (v0 > v1)));
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[14] = (((a0[5] * a1[2][3]) == (17 < i8)) / 7);
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    v3 = (((v1 == v3) || (v3 ? i9 : v2)) * ((a0[11] == 65) <= (a0[12] - 15)));
+                    a0[4] = (((36 - v3) >= (60 - a0[10])) && ((a1[3][0] < i8) < (i8 <= a0[11])));
+                    v2 = (((v2 <= v2) > (a0[2] > a1[3][4])) % 3);
+                    i9 = i9 + 1;
+                }
+            }
+            a0[9] = (((a0[15] || i8) < (67 && a0[12])) - ((28 != v0) || (v0 || a0[8])));
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    return (((a0[14] - a1[0][13]) != (a0[12] || v3)) < ((v1 && v0) < (a0[7] == v1)));
+}
+int f1() {
+    int v0 = 66;
+    int v1 = 41;
+    int v2 = 62;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((i0 - 33) / 9) % 4);
+                    a0[8] = (((a0[14] ? 38 : 73) != (14 > 49)) - ((a0[4] / 1) || (v3 ? a0[4] : 74)));
+                    v3 = (((a1[0][6] <= v3) * (4 / 4)) % 3);
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v1 = (((92 >= v3) ? (v0 >= a1[0][3]) : (v0 ? v3 : 74)) > ((v3 ? v3 : a0[3]) != (v1 > 90)));
+            v2 = (((a1[3][14] ? a1[2][7] : i0) && (a1[1][1] / 5)) / 6);
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a1[1][7] > a1[1][10]) + (a1[3][13] || a0[1])) * ((v0 <= a1[2][9]) == (v0 == i2)));
+            v2 = (((i2 - i2) ? (81 + v2) : (14 + 63)) ? ((70 != a0[1]) ? (v1 % 4) : (v3 + v2)) : ((v1 + i2) >= (45 - 21)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((i2 + 5) >= (i2 * i3)) * ((v1 + v1) ? (v2 / 2) : (v3 != i3)));
+                a1[1][3] = (((7 && a0[15]) < (i2 <= v0)) || ((i2 <= i2) / 3));
+                v1 = (((i3 * a0[10]) < (v0 && 6)) || ((46 || v0) ? (v2 ? v0 : v3) : (v3 == 65)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a1[3][6] = (((87 - a1[3][12]) ? (6 >= v2) : (37 ? 1 : a0[12])) <= ((a1[0][5] >= v1) + (70 ? v1 : a0[3])));
+        {
+            int i5 = 0;
+            do {
+                a0[1] = (((i5 ? a1[1][11] : v2) ? (v2 < 50) : (i4 % 2)) - ((i5 == a1[1][0]) == (v2 >= v0)));
+                a1[0][1] = (((27 ? v2 : v3) < (i5 != 46)) % 4);
+                v1 = (((i5 < a0[6]) >= (16 == 16)) < ((84 ? v3 : a0[1]) ? (v0 != v3) : (0 == 12)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+        v1 = (((v3 && i4) + (23 * a1[2][8])) < ((a0[10] + v1) + (81 % 8)));
+    }
+    v3 = (((v0 ? v2 : v2) % 2) + ((v2 >= v1) <= (v1 == v0)));
+    {
+        int i6 = 0;
+        do {
+            if ((v0 / 6) > 82) break;
+            {
+                int i7 = 0;
+                do {
+                    a1[1][8] = (((39 ? 72 : v0) / 9) / 1);
+                    v1 = (((i6 + a1[2][1]) ? (v1 >= i6) : (80 >= a0[5])) > ((i6 != v2) ? (v2 < 10) : (a1[2][6] > i6)));
+                    v0 = (((a0[12] * 20) + (v2 ? a0[12] : v3)) || ((a1[0][9] % 5) <= (v0 ? v1 : i7)));
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            v1 = (((a0[4] ? i6 : 75) && (a0[3] - i6)) == ((63 * v1) || (v0 ? a1[0][13] : v0)));
+            v0 = (((65 != a1[0][0]) ? (32 == a0[9]) : (a1[1][12] + 57)) > ((v1 == a0[13]) != (a1[3][2] - i6)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    if ((67 / 2) > 85) break;
+                    a0[6] = (((15 == 79) < (a0[9] <= a0[13])) && ((v2 * v0) - (i8 ? v2 : a1[0][15])));
+                    v2 = (((45 > 42) != (8 == a0[10])) > ((a1[3][9] == v3) != (i8 < v3)));
+                    v2 = (((i8 ? a1[0][7] : a1[3][14]) ? (v3 ? a0[2] : i9) : (v2 <= 51)) <= ((17 && 76) < (i9 != i9)));
+                    i9 = i9 + 1;
+                } while (i9 < 6);
+            }
+            a0[0] = (((i8 < v2) > (v0 && v0)) == ((57 ? a0[15] : v3) && (v1 > 37)));
+            v3 = (((a0[9] == v1) || (a0[12] / 5)) - ((v3 > v1) < (v0 - v0)));
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    a0[10] = (((84 ? v1 : 47) ? (v2 * a0[6]) : (a1[0][2] && v3)) != ((96 == v3) > (3 || 1)));
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        v3 = (((a0[5] % 4) || (v2 / 5)) > ((22 == a0[15]) + (i10 != v0)));
+        v3 = (((v0 > v3) >= (v3 * a1[1][6])) - ((a0[9] ? a1[1][14] : v0) && (a1[2][15] || a1[3][13])));
+        {
+            int i11 = 0;
+            while (i11 < 8) {
+                a1[0][14] = (((96 ? a1[1][5] : v2) + (a1[1][9] || v1)) <= ((i10 >= a0[6]) && (i10 <= v1)));
+                v0 = (((v0 < a1[2][13]) ? (v0 ? v0 : i11) : (v1 * v0)) * ((i11 ? v0 : i11) != (i11 % 7)));
+                a0[9] = (((a1[3][11] ? 7 : v1) % 2) % 5);
+                i11 = i11 + 1;
+            }
+        }
+    }
+    if ((((v0 >= v1) ? (a0[9] ? 25 : v2) : (26 * 40)) - ((v1 < 18) != (v2 < v0)))) {
+        v1 = (((v2 && v1) && (a0[4] <= 10)) > ((v2 && v2) ? (73 <= 53) : (6 != 40)));
+        v2 = (((a1[1][12] / 1) / 2) ? ((v1 == 79) <= (91 != 54)) : ((12 % 2) / 1));
+        v0 = (((v3 < v1) <= (v0 > 89)) ? ((v0 && v0) + (v0 * 33)) : ((v3 ? a1[2][13] : v0) > (37 + v1)));
+    } else {
+        a0[10] = (((v2 > v3) <= (a1[2][10] ? a1[2][11] : a1[2][10])) % 2);
+        a0[5] = (((a0[4] - a1[1][0]) && (25 >= a1[2][13])) && ((a0[15] || v0) && (v3 - a1[1][11])));
+        v2 = (((v3 * a0[8]) || (12 == v2)) || ((v3 < a1[0][0]) <= (a1[1][5] >= 86)));
+    }
+    a1[2][5] = (((a0[13] <= v3) / 4) != ((v1 <= a0[11]) + (94 + v3)));
+    return (((a0[9] > 4) >= (v3 && 34)) + ((a1[1][11] && v1) != (a1[2][9] || a0[11])));
+}
+int f2() {
+    int v0 = 19;
+    int v1 = 85;
+    int v2 = 92;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 ? v1 : v0) - (95 >= a0[6])) && ((v3 != v1) || (v2 ? v3 : v2)))) {
+        a0[7] = (((a1[2][12] >= v3) <= (v0 > a0[8])) >= ((v1 * v2) ? (v3 <= v2) : (v1 || 90)));
+        v2 = (((14 ? v0 : v3) / 5) && ((v0 >= 87) + (v3 - 93)));
+        v0 = (((v2 && a1[3][4]) >= (a0[15] || a1[0][4])) || ((47 < a1[2][2]) > (11 > 87)));
+    } else {
+        v3 = (((3 == 80) % 5) > ((v3 && v0) >= (v3 == v1)));
+        a0[7] = (((a0[12] <= 66) <= (v3 / 9)) && ((v2 ? v3 : a1[2][9]) && (19 != 4)));
+        v1 = (((v1 || a1[3][4]) * (v1 || v3)) < ((v0 == v0) > (v0 != v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((0 != v0) > 73) break;
+            v1 = (((i0 >= v3) || (a1[0][3] <= a0[4])) <= ((89 <= 22) * (v0 >= 47)));
+            {
+                int i1 = 0;
+                do {
+                    if ((48 < i0) > 64) break;
+                    v0 = (((68 == v2) < (0 == a1[0][6])) ? ((a1[1][8] == 60) >= (v3 ? a0[0] : v1)) : ((i0 <= a0[0]) == (v1 <= i0)));
+                    v3 = (((a0[7] != 47) - (v0 / 1)) - ((a1[3][8] >= a1[2][5]) <= (7 > a1[0][13])));
+                    v3 = (((v2 || i0) && (29 > i0)) < ((v0 || a1[1][15]) - (v2 && 86)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((v3 % 4) % 4) == ((v1 || v0) - (a1[3][9] % 8)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a0[10] = (((a0[4] <= a0[14]) ? (i2 * v1) : (v1 + v2)) / 1);
+            v3 = (((v1 ? a1[1][13] : a1[3][2]) == (v1 != a1[1][14])) % 5);
+            {
+                int i3 = 0;
+                do {
+                    if ((i3 < 86) > 78) break;
+                    a0[14] = (((a1[2][2] % 2) % 2) > ((v3 || a1[2][1]) - (i3 > 84)));
+                    v3 = (((v3 < v0) * (54 > v3)) > ((i3 + a0[9]) == (v0 && 17)));
+                    v1 = (((81 < v3) <= (v1 == v0)) && ((35 ? i3 : v2) || (v0 < a1[2][5])));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            if ((v0 + a0[1]) > 91) break;
+            v1 = (((a1[0][8] / 6) ? (v2 > i4) : (48 * a0[2])) || ((a1[1][5] && v2) % 2));
+            v3 = (((v2 * 79) && (i4 - i4)) + ((v3 <= v3) || (a1[2][5] - v1)));
+            {
+                int i5 = 0;
+                do {
+                    if ((i4 < i5) > 70) break;
+                    v2 = (((v0 - 86) && (a0[14] || i5)) - ((a0[12] <= v2) != (89 - a0[11])));
+                    v2 = (((v0 || v1) ? (v0 ? v3 : v1) : (i4 != 24)) == ((v3 || 95) == (v2 + v0)));
+                    a0[14] = (((v1 || 8) ? (i4 ? 44 : i4) : (v3 < i4)) && ((a0[5] == a1[0][10]) * (v1 > a1[3][1])));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 >= v0) * (46 / 4)) <= ((v0 != 82) - (v3 % 8)))) {
+        a1[1][8] = (((v1 * a1[3][7]) - (33 && v2)) == ((37 == a1[0][2]) == (v2 - v1)));
+        v2 = (((0 / 2) + (a0[14] > 91)) + ((a0[15] != v3) >= (21 <= a0[0])));
+        a0[11] = (((a0[10] > a0[7]) / 8) > ((a1[2][13] || v1) % 6));
+    } else {
+        v0 = (((v2 != a1[1][10]) / 4) % 2);
+        v2 = (((a0[5] != v0) ? (63 * v0) : (v1 >= a1[2][11])) * ((v3 || a0[10]) != (v1 < a0[6])));
+        a0[13] = (((a0[0] ? v3 : v3) - (a0[8] * v2)) == ((v3 - v0) ? (62 >= 45) : (v2 <= v0)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        if ((v2 && i6) > 55) break;
+        v2 = (((a1[2][8] <= 45) - (v1 / 4)) == ((v1 < 3) * (v2 - v2)));
+        v0 = (((a0[11] % 1) * (2 <= v3)) || ((v2 == 33) > (v1 - 51)));
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                if ((i6 * v3) > 53) break;
+                a1[2][6] = (((a0[13] >= a0[10]) && (15 < i6)) && ((i7 > v2) < (v1 == v1)));
+                v2 = (((v1 && i6) > (63 % 3)) / 4);
+                a1[2][9] = (((v2 / 7) % 2) * ((a0[0] ? v1 : v2) <= (v2 / 8)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                a1[3][12] = (((v3 / 5) >= (a1[3][1] || v1)) < ((i9 + a1[1][9]) > (59 + a0[0])));
+                a0[4] = (((41 > v2) > (i9 - v2)) == ((2 ? i9 : i8) * (i9 ? 79 : 97)));
+                v1 = (((i9 == 31) < (i8 >= 26)) == ((v1 - i9) == (a0[13] != 27)));
+                i9 = i9 + 1;
+            } while (i9 < 7);
+        }
+        a1[2][15] = (((v1 > a1[0][8]) != (v3 || a1[3][9])) - ((v3 && v1) % 5));
+        v0 = (((v2 - v2) || (24 || a1[0][2])) == ((36 == v1) % 6));
+    }
+    if ((((v2 && a1[3][11]) * (v0 * a0[15])) ? ((15 / 4) >= (38 + 28)) : ((v2 <= a1[2][15]) ? (v1 + 54) : (38 / 9)))) {
+        v3 = (((1 + a0[9]) != (78 / 8)) != ((v3 ? a1[3][14] : v0) ? (a1[2][11] * v0) : (a1[1][6] && v2)));
+        a1[3][11] = (((v0 || a0[5]) ? (v2 ? v1 : v0) : (v3 / 1)) <= ((v2 >= v2) || (86 <= v3)));
+        v1 = (((a0[5] < a1[2][7]) || (v1 && v2)) * ((53 <= 29) == (a1[2][11] == v1)));
+    } else {
+        v0 = (((v1 && v3) / 7) >= ((59 < v1) > (a1[2][12] <= v2)));
+        v3 = (((a1[0][6] == 95) ? (a0[2] >= v1) : (a1[2][4] > a1[3][10])) <= ((50 == v3) > (18 ? 30 : v0)));
+        v2 = (((a1[1][3] > v2) - (v2 ? 71 : v1)) < ((a1[0][2] * v1) % 4));
+    }
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        a0[11] = (((v0 >= v3) - (a0[3] / 8)) ? ((v1 ? 67 : 98) <= (27 % 2)) : ((v0 < v1) > (v2 != v3)));
+        a0[2] = (((v1 != i10) != (a1[0][13] * 60)) < ((54 - i10) <= (v2 % 1)));
+        {
+            int i11 = 0;
+            do {
+                a0[2] = (((14 ? a0[6] : i10) % 4) || ((20 >= v2) - (v3 * v0)));
+                v3 = (((i11 && i11) == (i11 / 8)) + ((v3 ? i11 : v0) * (i10 >= a0[3])));
+                v3 = (((i11 >= 26) >= (v3 >= v3)) / 8);
+                i11 = i11 + 1;
+            } while (i11 < 3);
+        }
+    }
+    v2 = (((a0[3] <= v0) != (v0 < v2)) ? ((a1[0][1] <= v0) + (v0 + 13)) : ((94 || 63) <= (v0 ? v1 : a0[6])));
+    return (((v0 >= 19) ? (v0 + 16) : (v3 / 8)) >= ((a1[2][10] || 66) || (v3 ? v3 : 85)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
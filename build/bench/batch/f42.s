@@ -0,0 +1,7922 @@
+    .file 1 "build/bench/batch/f42.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 350 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 351 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 352 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f0
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 353 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f1
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 354 5
+    push %rbx
+    push %rcx
+    push %rdx
+    call f2
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    addl %eax, -4(%rbp)
+    .loc 1 355 5
+    movslq -4(%rbp), %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl f0
+.type f0, @function
+    .p2align 4
+f0:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $88, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $8, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $95, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 5
+    movq $37, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 5
+    subq $64, %rsp
+    .loc 1 7 5
+    subq $256, %rsp
+    .loc 1 8 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_6
+    .p2align 4,,10
+.Lf0_5:
+    .loc 1 9 9
+    movslq -12(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_8
+    jmp .Lf0_7
+.Lf0_8:
+    movq $1, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $72, %rax
+    cmpq $0, %rax
+    jne .Lf0_9
+    jmp .Lf0_10
+.Lf0_9:
+    movq $74, %rax
+    jmp .Lf0_11
+.Lf0_10:
+    movq $91, %rax
+.Lf0_11:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_7:
+    movl %eax, -8(%rbp)
+    .loc 1 11 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 12 13
+    .p2align 4,,10
+.Lf0_14:
+    .loc 1 13 17
+    movq $23, %rax
+    cmpq $0, %rax
+    jne .Lf0_16
+    jmp .Lf0_17
+.Lf0_16:
+    movslq -16(%rbp), %rax
+    jmp .Lf0_18
+.Lf0_17:
+    movq $77, %rax
+.Lf0_18:
+    cmpq $50, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_15
+    jmp .Lf0_12
+.Lf0_15:
+    .loc 1 14 17
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_23
+    jmp .Lf0_22
+.Lf0_23:
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_22:
+    cmpq $0, %rax
+    jne .Lf0_19
+    jmp .Lf0_20
+.Lf0_19:
+    movslq -344(%rbp), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_21
+.Lf0_20:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_25
+    jmp .Lf0_24
+.Lf0_25:
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_24:
+.Lf0_21:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_27
+    jmp .Lf0_26
+.Lf0_27:
+    movq $41, %rax
+    cmpq $0, %rax
+    jne .Lf0_28
+    jmp .Lf0_29
+.Lf0_28:
+    movslq -52(%rbp), %rax
+    jmp .Lf0_30
+.Lf0_29:
+    movslq -340(%rbp), %rax
+.Lf0_30:
+    push %rax
+    movq $22, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_32
+    jmp .Lf0_31
+.Lf0_32:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_31:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_26:
+    movl %eax, -68(%rbp)
+    .loc 1 15 17
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_33
+    jmp .Lf0_34
+.Lf0_33:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_37
+    jmp .Lf0_36
+.Lf0_37:
+    movq $58, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_36:
+    jmp .Lf0_35
+.Lf0_34:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf0_35:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_41
+    jmp .Lf0_42
+.Lf0_41:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_43
+.Lf0_42:
+    movq $44, %rax
+.Lf0_43:
+    cmpq $0, %rax
+    jne .Lf0_38
+    jmp .Lf0_39
+.Lf0_38:
+    cmpl $57, -8(%rbp)
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_40
+.Lf0_39:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_44
+    jmp .Lf0_45
+.Lf0_44:
+    movslq -24(%rbp), %rax
+    jmp .Lf0_46
+.Lf0_45:
+    movslq -4(%rbp), %rax
+.Lf0_46:
+.Lf0_40:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -8(%rbp)
+    .loc 1 16 17
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf0_50
+    jmp .Lf0_51
+.Lf0_50:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_52
+.Lf0_51:
+    movslq -340(%rbp), %rax
+.Lf0_52:
+    cmpq $0, %rax
+    jne .Lf0_47
+    jmp .Lf0_48
+.Lf0_47:
+    movq $97, %rax
+    cmpq $94, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_49
+.Lf0_48:
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf0_49:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -40(%rbp)
+    .loc 1 17 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_13:
+    .loc 1 18 22
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_14
+.Lf0_12:
+    addq $0, %rsp
+    .loc 1 20 9
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    cmpl $82, -28(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_4:
+    .loc 1 8 30
+    incl -340(%rbp)
+.Lf0_6:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_5
+.Lf0_3:
+    addq $8, %rsp
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 24 9
+    .p2align 4,,10
+.Lf0_55:
+    .loc 1 25 13
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $66, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_56
+    jmp .Lf0_53
+.Lf0_56:
+    .loc 1 26 13
+    movq $69, %rax
+    imull -80(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $79, -12(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf0_57
+    jmp .Lf0_58
+.Lf0_57:
+    movq $84, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $10, %rax
+    cmpq $0, %rax
+    jne .Lf0_60
+    jmp .Lf0_61
+.Lf0_60:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_62
+.Lf0_61:
+    movslq -4(%rbp), %rax
+.Lf0_62:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_59
+.Lf0_58:
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_64
+    jmp .Lf0_63
+.Lf0_64:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_63:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf0_59:
+    movl %eax, -4(%rbp)
+    .loc 1 27 13
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $38, -12(%rbp)
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 29 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 30 17
+    .p2align 4,,10
+.Lf0_67:
+    .loc 1 31 21
+    movq $8, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_68
+    jmp .Lf0_65
+.Lf0_68:
+    .loc 1 32 21
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_69
+    jmp .Lf0_70
+.Lf0_69:
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_71
+.Lf0_70:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_72
+    jmp .Lf0_73
+.Lf0_72:
+    movslq -76(%rbp), %rax
+    jmp .Lf0_74
+.Lf0_73:
+    movslq -12(%rbp), %rax
+.Lf0_74:
+.Lf0_71:
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 33 21
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_75
+    jmp .Lf0_76
+.Lf0_75:
+    movq $49, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_79
+    jmp .Lf0_78
+.Lf0_79:
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_78:
+    jmp .Lf0_77
+.Lf0_76:
+    movslq -20(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_77:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 34 21
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_80
+    jmp .Lf0_81
+.Lf0_80:
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    jmp .Lf0_82
+.Lf0_81:
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf0_82:
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_83
+    jmp .Lf0_84
+.Lf0_83:
+    movslq -28(%rbp), %rax
+    jmp .Lf0_85
+.Lf0_84:
+    movslq -48(%rbp), %rax
+.Lf0_85:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 35 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_66:
+    .loc 1 36 26
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_67
+.Lf0_65:
+    addq $0, %rsp
+    .loc 1 38 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_54:
+    .loc 1 39 18
+    cmpl $6, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_55
+.Lf0_53:
+    addq $8, %rsp
+    .loc 1 41 5
+    movslq -12(%rbp), %rax
+    subq $67, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_86
+    jmp .Lf0_87
+.Lf0_86:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf0_88
+.Lf0_87:
+    movq $66, %rax
+.Lf0_88:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_90
+    jmp .Lf0_89
+.Lf0_90:
+    movslq -8(%rbp), %rax
+    subl -52(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $22, -56(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_89:
+    movl %eax, -4(%rbp)
+    .loc 1 42 5
+    movq $2, %rax
+    push %rax
+    cmpl $87, -8(%rbp)
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_92
+    jmp .Lf0_93
+.Lf0_92:
+    cmpl $96, -56(%rbp)
+    movq $0, %rax
+    setle %al
+    jmp .Lf0_94
+.Lf0_93:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    addl -48(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_94:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf0_95
+    .loc 1 43 9
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $3, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 44 9
+    movq $1, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_97
+    jmp .Lf0_96
+.Lf0_97:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_96:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $79, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_99
+    jmp .Lf0_98
+.Lf0_99:
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_101
+    jmp .Lf0_100
+.Lf0_101:
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_100:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_98:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 45 9
+    movq $3, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 12(%rax), %rax
+    imulq $50, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_91
+.Lf0_95:
+    .loc 1 47 9
+    movq $9, %rax
+    push %rax
+    movq $3, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 48 9
+    movq $2, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_103
+    jmp .Lf0_102
+.Lf0_103:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_102:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 49 9
+    movslq -12(%rbp), %rax
+    imulq $59, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $14, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $21, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_105
+    jmp .Lf0_104
+.Lf0_105:
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_104:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_106
+    jmp .Lf0_107
+.Lf0_106:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_108
+.Lf0_107:
+    movq $82, %rax
+.Lf0_108:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf0_91:
+    .loc 1 51 5
+    movq $82, %rax
+    addq $85, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_109
+    jmp .Lf0_110
+.Lf0_109:
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf0_111
+.Lf0_110:
+    movslq -12(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_111:
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 53 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 54 9
+    jmp .Lf0_115
+    .p2align 4,,10
+.Lf0_114:
+    .loc 1 55 13
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_117
+    jmp .Lf0_116
+.Lf0_117:
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_116:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_118
+    jmp .Lf0_119
+.Lf0_118:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_120
+.Lf0_119:
+    movslq -12(%rbp), %rax
+.Lf0_120:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_125
+    jmp .Lf0_124
+.Lf0_125:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_124:
+    cmpq $0, %rax
+    jne .Lf0_121
+    jmp .Lf0_122
+.Lf0_121:
+    movq $99, %rax
+    cmpq $0, %rax
+    jne .Lf0_126
+    jmp .Lf0_127
+.Lf0_126:
+    movslq -8(%rbp), %rax
+    jmp .Lf0_128
+.Lf0_127:
+    movslq -60(%rbp), %rax
+.Lf0_128:
+    jmp .Lf0_123
+.Lf0_122:
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf0_123:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 56 13
+    movq $61, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $82, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_130
+    jmp .Lf0_129
+.Lf0_130:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_129:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -64(%rbp)
+    .loc 1 57 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_136
+    .p2align 4,,10
+.Lf0_135:
+    .loc 1 58 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_140
+    jmp .Lf0_141
+.Lf0_140:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_142
+.Lf0_141:
+    movslq -12(%rbp), %rax
+.Lf0_142:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_144
+    jmp .Lf0_143
+.Lf0_144:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_143:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $16, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -28(%rbp)
+    .loc 1 59 17
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_146
+    jmp .Lf0_145
+.Lf0_146:
+    movq $16, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_145:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 60 17
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_147
+    jmp .Lf0_148
+.Lf0_147:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_149
+.Lf0_148:
+    movslq -8(%rbp), %rax
+.Lf0_149:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_139:
+    .loc 1 57 38
+    incl -344(%rbp)
+    .loc 1 58 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_150
+    jmp .Lf0_151
+.Lf0_150:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_152
+.Lf0_151:
+    movslq -12(%rbp), %rax
+.Lf0_152:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_154
+    jmp .Lf0_153
+.Lf0_154:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_153:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $16, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -28(%rbp)
+    .loc 1 59 17
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_156
+    jmp .Lf0_155
+.Lf0_156:
+    movq $16, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_155:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 60 17
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_157
+    jmp .Lf0_158
+.Lf0_157:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_159
+.Lf0_158:
+    movslq -8(%rbp), %rax
+.Lf0_159:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_138:
+    .loc 1 57 38
+    incl -344(%rbp)
+.Lf0_136:
+    movslq -344(%rbp), %rax
+    addq $1, %rax
+    cmpq $8, %rax
+    jl .Lf0_135
+.Lf0_137:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lf0_133
+    .loc 1 58 17
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_160
+    jmp .Lf0_161
+.Lf0_160:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_162
+.Lf0_161:
+    movslq -12(%rbp), %rax
+.Lf0_162:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_164
+    jmp .Lf0_163
+.Lf0_164:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_163:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $16, %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movq $54, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -28(%rbp)
+    .loc 1 59 17
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_166
+    jmp .Lf0_165
+.Lf0_166:
+    movq $16, %rax
+    imull -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_165:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 60 17
+    movq $8, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_167
+    jmp .Lf0_168
+.Lf0_167:
+    movslq -12(%rbp), %rax
+    jmp .Lf0_169
+.Lf0_168:
+    movslq -8(%rbp), %rax
+.Lf0_169:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_134:
+    .loc 1 57 38
+    incl -344(%rbp)
+    jmp .Lf0_137
+.Lf0_133:
+    addq $0, %rsp
+    .loc 1 62 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_113:
+.Lf0_115:
+    .loc 1 54 16
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_114
+.Lf0_112:
+    addq $8, %rsp
+    .loc 1 65 5
+    movq $13, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_172
+    jmp .Lf0_171
+.Lf0_172:
+    movslq -8(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_171:
+    push %rax
+    movq $4, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $5, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf0_173
+    .loc 1 66 9
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_174
+    jmp .Lf0_175
+.Lf0_174:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_176
+.Lf0_175:
+    movq $69, %rax
+.Lf0_176:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_178
+    jmp .Lf0_177
+.Lf0_178:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_177:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -48(%rbp)
+    .loc 1 67 9
+    movq $9, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $70, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 68 9
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_180
+    jmp .Lf0_179
+.Lf0_180:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_179:
+    push %rax
+    movslq -16(%rbp), %rax
+    subq $94, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_182
+    jmp .Lf0_181
+.Lf0_182:
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_181:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+    jmp .Lf0_170
+.Lf0_173:
+    .loc 1 70 9
+    movq $3, %rax
+    push %rax
+    movq $69, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_184
+    jmp .Lf0_183
+.Lf0_184:
+    movq $93, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_183:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 71 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_188
+    jmp .Lf0_189
+.Lf0_188:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    jmp .Lf0_190
+.Lf0_189:
+    movq $76, %rax
+.Lf0_190:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_185
+    jmp .Lf0_186
+.Lf0_185:
+    movslq -16(%rbp), %rax
+    cmpl -32(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_191
+    jmp .Lf0_192
+.Lf0_191:
+    movslq -4(%rbp), %rax
+    subq $72, %rax
+    movslq %eax, %rax
+    jmp .Lf0_193
+.Lf0_192:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_194
+    jmp .Lf0_195
+.Lf0_194:
+    movslq -4(%rbp), %rax
+    jmp .Lf0_196
+.Lf0_195:
+    movslq -8(%rbp), %rax
+.Lf0_196:
+.Lf0_193:
+    jmp .Lf0_187
+.Lf0_186:
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf0_197
+    jmp .Lf0_198
+.Lf0_197:
+    movq $1, %rax
+    push %rax
+    movq $48, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf0_199
+.Lf0_198:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_199:
+.Lf0_187:
+    movl %eax, -12(%rbp)
+    .loc 1 72 9
+    movq $4, %rax
+    push %rax
+    movq $60, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_201
+    jmp .Lf0_200
+.Lf0_201:
+    movq $9, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_200:
+    push %rax
+    movq $34, %rax
+    cmpq $0, %rax
+    jne .Lf0_202
+    jmp .Lf0_203
+.Lf0_202:
+    movq $8, %rax
+    jmp .Lf0_204
+.Lf0_203:
+    movslq -8(%rbp), %rax
+.Lf0_204:
+    push %rax
+    movq $83, %rax
+    cmpq $0, %rax
+    jne .Lf0_205
+    jmp .Lf0_206
+.Lf0_205:
+    leaq -336(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf0_207
+.Lf0_206:
+    movslq -16(%rbp), %rax
+.Lf0_207:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf0_170:
+    .loc 1 74 5
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    imull -76(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $68, %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_209
+    jmp .Lf0_208
+.Lf0_209:
+    movq $10, %rax
+    cmpq $76, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_208:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    .loc 1 75 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf0_215
+    .p2align 4,,10
+.Lf0_214:
+    .loc 1 76 9
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    jmp .Lf0_221
+    .p2align 4,,10
+.Lf0_220:
+    .loc 1 77 13
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $71, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $34, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 78 13
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_223
+    jmp .Lf0_222
+.Lf0_223:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_222:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_224
+    jmp .Lf0_225
+.Lf0_224:
+    movq $93, %rax
+    jmp .Lf0_226
+.Lf0_225:
+    movslq -12(%rbp), %rax
+.Lf0_226:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    addq $58, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $80, %rax
+    cmpq $0, %rax
+    jne .Lf0_227
+    jmp .Lf0_228
+.Lf0_227:
+    movq $89, %rax
+    jmp .Lf0_229
+.Lf0_228:
+    movq $90, %rax
+.Lf0_229:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -76(%rbp)
+    .loc 1 79 13
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_231
+    jmp .Lf0_230
+.Lf0_231:
+    movq $99, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_230:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf0_232
+    jmp .Lf0_233
+.Lf0_232:
+    movslq -4(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf0_234
+.Lf0_233:
+    movslq -16(%rbp), %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    sete %al
+.Lf0_234:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf0_219:
+    .loc 1 76 34
+    incl -344(%rbp)
+.Lf0_221:
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_220
+.Lf0_218:
+    addq $0, %rsp
+    .loc 1 81 9
+    movq $35, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $98, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_236
+    jmp .Lf0_235
+.Lf0_236:
+    cmpl $56, -80(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $98, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_235:
+    movl %eax, -4(%rbp)
+    .loc 1 82 9
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_237
+    jmp .Lf0_238
+.Lf0_237:
+    movslq -340(%rbp), %rax
+    jmp .Lf0_239
+.Lf0_238:
+    movslq -28(%rbp), %rax
+.Lf0_239:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $76, %rax
+    imulq $7, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_241
+    jmp .Lf0_240
+.Lf0_241:
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_243
+    jmp .Lf0_242
+.Lf0_243:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_242:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_240:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -52(%rbp)
+    addq $0, %rsp
+.Lf0_213:
+    .loc 1 75 30
+    incl -340(%rbp)
+.Lf0_215:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_214
+.Lf0_212:
+    addq $8, %rsp
+    .loc 1 85 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 86 9
+    .p2align 4,,10
+.Lf0_246:
+    .loc 1 87 13
+    movq $7, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 12(%rax), %rax
+    imull -60(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $17, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 89 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 90 17
+    jmp .Lf0_250
+    .p2align 4,,10
+.Lf0_249:
+    .loc 1 91 21
+    cmpl $65, -36(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -32(%rbp), %rax
+    subq $15, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_252
+    jmp .Lf0_251
+.Lf0_252:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf0_253
+    jmp .Lf0_254
+.Lf0_253:
+    movslq -344(%rbp), %rax
+    jmp .Lf0_255
+.Lf0_254:
+    movslq -12(%rbp), %rax
+.Lf0_255:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_251:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 92 21
+    movq $36, %rax
+    subl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $60, %rax
+    subl -40(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_257
+    jmp .Lf0_256
+.Lf0_257:
+    leaq -144(%rbp), %rax
+    movslq 0(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_256:
+    movl %eax, -64(%rbp)
+    .loc 1 93 21
+    movq $3, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -72(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 94 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf0_248:
+.Lf0_250:
+    .loc 1 90 24
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_249
+.Lf0_247:
+    addq $0, %rsp
+    .loc 1 97 13
+    movq $28, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_259
+    jmp .Lf0_258
+.Lf0_259:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_261
+    jmp .Lf0_260
+.Lf0_261:
+    movslq -48(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_260:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_258:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_263
+    jmp .Lf0_262
+.Lf0_263:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_262:
+    push %rax
+    movq $67, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_265
+    jmp .Lf0_264
+.Lf0_265:
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_264:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 98 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf0_245:
+    .loc 1 99 18
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf0_246
+.Lf0_244:
+    addq $8, %rsp
+    .loc 1 101 5
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    push %rax
+    movslq -24(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf0_267
+    jmp .Lf0_266
+.Lf0_267:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_266:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf0_269
+    jmp .Lf0_268
+.Lf0_269:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf0_268:
+    push %rax
+    movslq -52(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    jmp .Lf0_end
+    movq $0, %rax
+.Lf0_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f0, .-f0
+.globl f1
+.type f1, @function
+    .p2align 4
+f1:
+    .cfi_startproc
+    .loc 1 103 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 104 5
+    subq $8, %rsp
+    movq $66, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 105 5
+    movq $41, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 106 5
+    subq $8, %rsp
+    movq $62, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 107 5
+    movq $30, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 108 5
+    subq $64, %rsp
+    .loc 1 109 5
+    subq $256, %rsp
+    .loc 1 111 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 112 9
+    .p2align 4,,10
+.Lf1_3:
+    .loc 1 114 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 115 17
+    .p2align 4,,10
+.Lf1_6:
+    .loc 1 116 21
+    movq $4, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    subq $33, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 117 21
+    movq $1, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_8
+    jmp .Lf1_7
+.Lf1_8:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_9
+    jmp .Lf1_10
+.Lf1_9:
+    movslq -64(%rbp), %rax
+    jmp .Lf1_11
+.Lf1_10:
+    movq $74, %rax
+.Lf1_11:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_7:
+    push %rax
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_12
+    jmp .Lf1_13
+.Lf1_12:
+    movq $38, %rax
+    jmp .Lf1_14
+.Lf1_13:
+    movq $73, %rax
+.Lf1_14:
+    push %rax
+    movq $14, %rax
+    cmpq $49, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -48(%rbp)
+    .loc 1 118 21
+    movq $3, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movq $4, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 119 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_5:
+    .loc 1 120 26
+    cmpl $5, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_6
+.Lf1_4:
+    addq $0, %rsp
+    .loc 1 122 13
+    movq $92, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_15
+    jmp .Lf1_16
+.Lf1_15:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_17
+.Lf1_16:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_18
+    jmp .Lf1_19
+.Lf1_18:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_20
+.Lf1_19:
+    movq $74, %rax
+.Lf1_20:
+.Lf1_17:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_21
+    jmp .Lf1_22
+.Lf1_21:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_23
+.Lf1_22:
+    movslq -68(%rbp), %rax
+.Lf1_23:
+    push %rax
+    cmpl $90, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 123 13
+    movq $6, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_24
+    jmp .Lf1_25
+.Lf1_24:
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf1_26
+.Lf1_25:
+    movslq -340(%rbp), %rax
+.Lf1_26:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_28
+    jmp .Lf1_27
+.Lf1_28:
+    movq $5, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_27:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 124 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_2:
+    .loc 1 125 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_3
+.Lf1_1:
+    addq $8, %rsp
+    .loc 1 128 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 129 9
+    .p2align 4,,10
+.Lf1_31:
+    .loc 1 130 13
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_33
+    jmp .Lf1_32
+.Lf1_33:
+    movslq -76(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_32:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 28(%rax), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 131 13
+    movslq -340(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_37
+    jmp .Lf1_38
+.Lf1_37:
+    movq $81, %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_39
+.Lf1_38:
+    movq $14, %rax
+    addq $63, %rax
+    movslq %eax, %rax
+.Lf1_39:
+    cmpq $0, %rax
+    jne .Lf1_34
+    jmp .Lf1_35
+.Lf1_34:
+    movq $70, %rax
+    cmpl -76(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_40
+    jmp .Lf1_41
+.Lf1_40:
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_42
+.Lf1_41:
+    movslq -16(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_42:
+    jmp .Lf1_36
+.Lf1_35:
+    movslq -8(%rbp), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $45, %rax
+    subq $21, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf1_36:
+    movl %eax, -12(%rbp)
+    .loc 1 132 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 133 17
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_48
+    jmp .Lf1_49
+.Lf1_48:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_50
+.Lf1_49:
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_50:
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $5, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 134 17
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_52
+    jmp .Lf1_51
+.Lf1_52:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_51:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_54
+    jmp .Lf1_53
+.Lf1_54:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_53:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 135 17
+    movslq -344(%rbp), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_56
+    jmp .Lf1_55
+.Lf1_56:
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_55:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_58
+    jmp .Lf1_57
+.Lf1_58:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_63
+    jmp .Lf1_62
+.Lf1_63:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_62:
+    cmpq $0, %rax
+    jne .Lf1_59
+    jmp .Lf1_60
+.Lf1_59:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_64
+    jmp .Lf1_65
+.Lf1_64:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_66
+.Lf1_65:
+    movslq -16(%rbp), %rax
+.Lf1_66:
+    jmp .Lf1_61
+.Lf1_60:
+    cmpl $65, -16(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_61:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_57:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_47:
+    .loc 1 132 38
+    incl -344(%rbp)
+    .loc 1 133 17
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_68
+    jmp .Lf1_69
+.Lf1_68:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_70
+.Lf1_69:
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_70:
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $5, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 134 17
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_72
+    jmp .Lf1_71
+.Lf1_72:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_71:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_74
+    jmp .Lf1_73
+.Lf1_74:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_73:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 135 17
+    movslq -344(%rbp), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_76
+    jmp .Lf1_75
+.Lf1_76:
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_75:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_78
+    jmp .Lf1_77
+.Lf1_78:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_83
+    jmp .Lf1_82
+.Lf1_83:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_82:
+    cmpq $0, %rax
+    jne .Lf1_79
+    jmp .Lf1_80
+.Lf1_79:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_84
+    jmp .Lf1_85
+.Lf1_84:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_86
+.Lf1_85:
+    movslq -16(%rbp), %rax
+.Lf1_86:
+    jmp .Lf1_81
+.Lf1_80:
+    cmpl $65, -16(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_81:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_77:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_67:
+    .loc 1 132 38
+    incl -344(%rbp)
+    .loc 1 133 17
+    movslq -8(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_87
+    jmp .Lf1_88
+.Lf1_87:
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    jmp .Lf1_89
+.Lf1_88:
+    movslq -16(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+.Lf1_89:
+    push %rax
+    movslq -340(%rbp), %rax
+    addq $5, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    imull -344(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 134 17
+    movq $7, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_91
+    jmp .Lf1_90
+.Lf1_91:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_90:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_93
+    jmp .Lf1_92
+.Lf1_93:
+    movq $3, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_92:
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 12(%rax)
+    movq %rdx, %rax
+    .loc 1 135 17
+    movslq -344(%rbp), %rax
+    imull -40(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_95
+    jmp .Lf1_94
+.Lf1_95:
+    movq $6, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_94:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_97
+    jmp .Lf1_96
+.Lf1_97:
+    movq $46, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_102
+    jmp .Lf1_101
+.Lf1_102:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_101:
+    cmpq $0, %rax
+    jne .Lf1_98
+    jmp .Lf1_99
+.Lf1_98:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_103
+    jmp .Lf1_104
+.Lf1_103:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_105
+.Lf1_104:
+    movslq -16(%rbp), %rax
+.Lf1_105:
+    jmp .Lf1_100
+.Lf1_99:
+    cmpl $65, -16(%rbp)
+    movq $0, %rax
+    sete %al
+.Lf1_100:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_96:
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_46:
+    .loc 1 132 38
+    incl -344(%rbp)
+.Lf1_45:
+    addq $0, %rsp
+    .loc 1 137 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_30:
+    .loc 1 138 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_31
+.Lf1_29:
+    addq $8, %rsp
+    .loc 1 140 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_111
+    .p2align 4,,10
+.Lf1_110:
+    .loc 1 141 9
+    leaq -144(%rbp), %rax
+    movslq 48(%rax), %rax
+    push %rax
+    movq $87, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_112
+    jmp .Lf1_113
+.Lf1_112:
+    movq $6, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_114
+.Lf1_113:
+    movq $37, %rax
+    cmpq $0, %rax
+    jne .Lf1_115
+    jmp .Lf1_116
+.Lf1_115:
+    movq $1, %rax
+    jmp .Lf1_117
+.Lf1_116:
+    movslq -32(%rbp), %rax
+.Lf1_117:
+.Lf1_114:
+    push %rax
+    movq $70, %rax
+    cmpq $0, %rax
+    jne .Lf1_118
+    jmp .Lf1_119
+.Lf1_118:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_120
+.Lf1_119:
+    movslq -68(%rbp), %rax
+.Lf1_120:
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 143 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 144 13
+    .p2align 4,,10
+.Lf1_123:
+    .loc 1 145 17
+    movslq -344(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_127
+    jmp .Lf1_128
+.Lf1_127:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf1_129
+.Lf1_128:
+    movslq -12(%rbp), %rax
+.Lf1_129:
+    cmpq $0, %rax
+    jne .Lf1_124
+    jmp .Lf1_125
+.Lf1_124:
+    cmpl $50, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_126
+.Lf1_125:
+    movq $2, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+.Lf1_126:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -76(%rbp)
+    .loc 1 146 17
+    movq $4, %rax
+    push %rax
+    movq $27, %rax
+    cmpq $0, %rax
+    jne .Lf1_130
+    jmp .Lf1_131
+.Lf1_130:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_132
+.Lf1_131:
+    movslq -16(%rbp), %rax
+.Lf1_132:
+    push %rax
+    cmpl $46, -344(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 4(%rax)
+    movq %rdx, %rax
+    .loc 1 147 17
+    movslq -344(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $16, %rax
+    cmpq $16, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf1_136
+    jmp .Lf1_137
+.Lf1_136:
+    movslq -16(%rbp), %rax
+    jmp .Lf1_138
+.Lf1_137:
+    movslq -76(%rbp), %rax
+.Lf1_138:
+    cmpq $0, %rax
+    jne .Lf1_133
+    jmp .Lf1_134
+.Lf1_133:
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    jmp .Lf1_135
+.Lf1_134:
+    movq $0, %rax
+    cmpq $12, %rax
+    movq $0, %rax
+    sete %al
+.Lf1_135:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    .loc 1 148 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_122:
+    .loc 1 149 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_123
+.Lf1_121:
+    addq $0, %rsp
+    .loc 1 151 9
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    imulq $23, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_140
+    jmp .Lf1_139
+.Lf1_140:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_139:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $81, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf1_109:
+    .loc 1 140 30
+    incl -340(%rbp)
+.Lf1_111:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_110
+.Lf1_108:
+    addq $8, %rsp
+    .loc 1 153 5
+    movslq -12(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_141
+    jmp .Lf1_142
+.Lf1_141:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_143
+.Lf1_142:
+    movslq -12(%rbp), %rax
+.Lf1_143:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 155 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 156 9
+    .p2align 4,,10
+.Lf1_146:
+    .loc 1 157 13
+    movq $6, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $82, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_147
+    jmp .Lf1_144
+.Lf1_147:
+    .loc 1 159 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 160 17
+    .p2align 4,,10
+.Lf1_150:
+    .loc 1 161 21
+    movq $1, %rax
+    push %rax
+    movq $9, %rax
+    push %rax
+    movq $39, %rax
+    cmpq $0, %rax
+    jne .Lf1_151
+    jmp .Lf1_152
+.Lf1_151:
+    movq $72, %rax
+    jmp .Lf1_153
+.Lf1_152:
+    movslq -4(%rbp), %rax
+.Lf1_153:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 162 21
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    addl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_154
+    jmp .Lf1_155
+.Lf1_154:
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf1_156
+.Lf1_155:
+    movq $80, %rax
+    cmpl -60(%rbp), %eax
+    movq $0, %rax
+    setge %al
+.Lf1_156:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_157
+    jmp .Lf1_158
+.Lf1_157:
+    cmpl $10, -12(%rbp)
+    movq $0, %rax
+    setl %al
+    jmp .Lf1_159
+.Lf1_158:
+    leaq -208(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+.Lf1_159:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 163 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_160
+    jmp .Lf1_161
+.Lf1_160:
+    movslq -32(%rbp), %rax
+    jmp .Lf1_162
+.Lf1_161:
+    movslq -16(%rbp), %rax
+.Lf1_162:
+    push %rax
+    movslq -32(%rbp), %rax
+    imulq $20, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_164
+    jmp .Lf1_163
+.Lf1_164:
+    movq $5, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_165
+    jmp .Lf1_166
+.Lf1_165:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_167
+.Lf1_166:
+    movslq -344(%rbp), %rax
+.Lf1_167:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_163:
+    movl %eax, -4(%rbp)
+    .loc 1 164 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_149:
+    .loc 1 165 26
+    cmpl $4, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_150
+.Lf1_148:
+    addq $0, %rsp
+    .loc 1 167 13
+    movslq -64(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_168
+    jmp .Lf1_169
+.Lf1_168:
+    movslq -340(%rbp), %rax
+    jmp .Lf1_170
+.Lf1_169:
+    movq $75, %rax
+.Lf1_170:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_172
+    jmp .Lf1_171
+.Lf1_172:
+    movslq -68(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_171:
+    push %rax
+    movq $63, %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_174
+    jmp .Lf1_173
+.Lf1_174:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_175
+    jmp .Lf1_176
+.Lf1_175:
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf1_177
+.Lf1_176:
+    movslq -4(%rbp), %rax
+.Lf1_177:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_173:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 168 13
+    movq $65, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_178
+    jmp .Lf1_179
+.Lf1_178:
+    movq $32, %rax
+    cmpl -44(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    jmp .Lf1_180
+.Lf1_179:
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    addq $57, %rax
+    movslq %eax, %rax
+.Lf1_180:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -4(%rbp)
+    .loc 1 169 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_145:
+    .loc 1 170 18
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_146
+.Lf1_144:
+    addq $8, %rsp
+    .loc 1 173 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 174 9
+    .p2align 4,,10
+.Lf1_183:
+    .loc 1 176 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 177 17
+    .p2align 4,,10
+.Lf1_186:
+    .loc 1 178 21
+    movq $2, %rax
+    push %rax
+    movq $67, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $85, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf1_187
+    jmp .Lf1_184
+.Lf1_187:
+    .loc 1 179 21
+    movq $15, %rax
+    cmpq $79, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -28(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_189
+    jmp .Lf1_188
+.Lf1_189:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_190
+    jmp .Lf1_191
+.Lf1_190:
+    movslq -12(%rbp), %rax
+    jmp .Lf1_192
+.Lf1_191:
+    leaq -336(%rbp), %rax
+    movslq 60(%rax), %rax
+.Lf1_192:
+    push %rax
+    movslq -12(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_188:
+    movl %eax, -56(%rbp)
+    .loc 1 180 21
+    movq $45, %rax
+    cmpq $42, %rax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $8, %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -12(%rbp)
+    .loc 1 181 21
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_196
+    jmp .Lf1_197
+.Lf1_196:
+    leaq -336(%rbp), %rax
+    movslq 28(%rax), %rax
+    jmp .Lf1_198
+.Lf1_197:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+.Lf1_198:
+    cmpq $0, %rax
+    jne .Lf1_193
+    jmp .Lf1_194
+.Lf1_193:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_199
+    jmp .Lf1_200
+.Lf1_199:
+    movslq -72(%rbp), %rax
+    jmp .Lf1_201
+.Lf1_200:
+    movslq -344(%rbp), %rax
+.Lf1_201:
+    jmp .Lf1_195
+.Lf1_194:
+    cmpl $51, -12(%rbp)
+    movq $0, %rax
+    setle %al
+.Lf1_195:
+    push %rax
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_203
+    jmp .Lf1_202
+.Lf1_203:
+    movq $76, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_202:
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -12(%rbp)
+    .loc 1 182 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_185:
+    .loc 1 183 26
+    cmpl $6, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_186
+.Lf1_184:
+    addq $0, %rsp
+    .loc 1 185 13
+    movslq -340(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_205
+    jmp .Lf1_204
+.Lf1_205:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_204:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $57, %rax
+    cmpq $0, %rax
+    jne .Lf1_206
+    jmp .Lf1_207
+.Lf1_206:
+    movslq -20(%rbp), %rax
+    jmp .Lf1_208
+.Lf1_207:
+    movslq -16(%rbp), %rax
+.Lf1_208:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_210
+    jmp .Lf1_209
+.Lf1_210:
+    cmpl $37, -8(%rbp)
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_209:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -80(%rbp)
+    .loc 1 186 13
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -44(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_212
+    jmp .Lf1_211
+.Lf1_212:
+    movq $5, %rax
+    push %rax
+    movslq -32(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_211:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 187 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf1_182:
+    .loc 1 188 18
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_183
+.Lf1_181:
+    addq $8, %rsp
+    .loc 1 190 5
+    movq $84, %rax
+    cmpq $0, %rax
+    jne .Lf1_216
+    jmp .Lf1_217
+.Lf1_216:
+    movslq -8(%rbp), %rax
+    jmp .Lf1_218
+.Lf1_217:
+    movq $47, %rax
+.Lf1_218:
+    cmpq $0, %rax
+    jne .Lf1_213
+    jmp .Lf1_214
+.Lf1_213:
+    movslq -12(%rbp), %rax
+    imull -56(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf1_215
+.Lf1_214:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_220
+    jmp .Lf1_219
+.Lf1_220:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_219:
+.Lf1_215:
+    push %rax
+    movq $96, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $3, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_222
+    jmp .Lf1_221
+.Lf1_222:
+    movq $1, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_221:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -40(%rbp)
+    .loc 1 191 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf1_228
+    .p2align 4,,10
+.Lf1_227:
+    .loc 1 192 9
+    movq $4, %rax
+    push %rax
+    movslq -60(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_230
+    jmp .Lf1_229
+.Lf1_230:
+    movq $5, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_229:
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $22, %rax
+    cmpl -20(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 193 9
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_231
+    jmp .Lf1_232
+.Lf1_231:
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf1_233
+.Lf1_232:
+    movslq -4(%rbp), %rax
+.Lf1_233:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_235
+    jmp .Lf1_234
+.Lf1_235:
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_237
+    jmp .Lf1_236
+.Lf1_237:
+    leaq -144(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_236:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_234:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 195 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 196 13
+    jmp .Lf1_241
+    .p2align 4,,10
+.Lf1_240:
+    .loc 1 197 17
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_243
+    jmp .Lf1_242
+.Lf1_243:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_242:
+    push %rax
+    movq $96, %rax
+    cmpq $0, %rax
+    jne .Lf1_244
+    jmp .Lf1_245
+.Lf1_244:
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    jmp .Lf1_246
+.Lf1_245:
+    movslq -12(%rbp), %rax
+.Lf1_246:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -340(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_248
+    jmp .Lf1_247
+.Lf1_248:
+    movslq -340(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_247:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -336(%rbp), %rax
+    pop %rdx
+    movl %edx, 56(%rax)
+    movq %rdx, %rax
+    .loc 1 198 17
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_249
+    jmp .Lf1_250
+.Lf1_249:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_251
+.Lf1_250:
+    movslq -344(%rbp), %rax
+.Lf1_251:
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_252
+    jmp .Lf1_253
+.Lf1_252:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_255
+    jmp .Lf1_256
+.Lf1_255:
+    movslq -4(%rbp), %rax
+    jmp .Lf1_257
+.Lf1_256:
+    movslq -344(%rbp), %rax
+.Lf1_257:
+    jmp .Lf1_254
+.Lf1_253:
+    movslq -8(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+.Lf1_254:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 199 17
+    movq $5, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_258
+    jmp .Lf1_259
+.Lf1_258:
+    movq $7, %rax
+    jmp .Lf1_260
+.Lf1_259:
+    movslq -8(%rbp), %rax
+.Lf1_260:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 200 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf1_239:
+.Lf1_241:
+    .loc 1 196 20
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_240
+.Lf1_238:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf1_226:
+    .loc 1 191 32
+    incl -340(%rbp)
+.Lf1_228:
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf1_227
+.Lf1_225:
+    addq $8, %rsp
+    .loc 1 204 5
+    cmpl $18, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf1_262
+    jmp .Lf1_263
+.Lf1_262:
+    movslq -44(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_265
+    jmp .Lf1_266
+.Lf1_265:
+    movq $25, %rax
+    jmp .Lf1_267
+.Lf1_266:
+    movslq -12(%rbp), %rax
+.Lf1_267:
+    jmp .Lf1_264
+.Lf1_263:
+    movq $26, %rax
+    imulq $40, %rax
+    movslq %eax, %rax
+.Lf1_264:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    je .Lf1_268
+    .loc 1 205 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_270
+    jmp .Lf1_269
+.Lf1_270:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_269:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_272
+    jmp .Lf1_271
+.Lf1_272:
+    cmpl $10, -64(%rbp)
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_271:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_277
+    jmp .Lf1_276
+.Lf1_277:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_276:
+    cmpq $0, %rax
+    jne .Lf1_273
+    jmp .Lf1_274
+.Lf1_273:
+    movq $73, %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_275
+.Lf1_274:
+    movq $6, %rax
+    cmpq $40, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_275:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -8(%rbp)
+    .loc 1 206 9
+    movq $2, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 48(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf1_278
+    jmp .Lf1_279
+.Lf1_278:
+    cmpl $79, -8(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $91, %rax
+    cmpq $54, %rax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf1_280
+.Lf1_279:
+    movq $1, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $12, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf1_280:
+    movl %eax, -12(%rbp)
+    .loc 1 207 9
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    cmpl $89, -4(%rbp)
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf1_281
+    jmp .Lf1_282
+.Lf1_281:
+    movslq -4(%rbp), %rax
+    imulq $33, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_285
+    jmp .Lf1_284
+.Lf1_285:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_284:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_283
+.Lf1_282:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf1_286
+    jmp .Lf1_287
+.Lf1_286:
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf1_288
+.Lf1_287:
+    movslq -4(%rbp), %rax
+.Lf1_288:
+    push %rax
+    movq $37, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf1_283:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf1_261
+.Lf1_268:
+    .loc 1 209 9
+    movq $2, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    jne .Lf1_289
+    jmp .Lf1_290
+.Lf1_289:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    jmp .Lf1_291
+.Lf1_290:
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+.Lf1_291:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 210 9
+    leaq -272(%rbp), %rax
+    movslq 0(%rax), %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_293
+    jmp .Lf1_292
+.Lf1_293:
+    movq $25, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_292:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_295
+    jmp .Lf1_294
+.Lf1_295:
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_297
+    jmp .Lf1_296
+.Lf1_297:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_296:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_299
+    jmp .Lf1_298
+.Lf1_299:
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_298:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_294:
+    movl %eax, -60(%rbp)
+    .loc 1 211 9
+    movslq -16(%rbp), %rax
+    imull -48(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_301
+    jmp .Lf1_300
+.Lf1_301:
+    movq $12, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_300:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_303
+    jmp .Lf1_302
+.Lf1_303:
+    movslq -16(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 0(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $86, %rax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_302:
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf1_261:
+    .loc 1 213 5
+    movq $4, %rax
+    push %rax
+    movslq -28(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $94, %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -36(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 20(%rax)
+    movq %rdx, %rax
+    .loc 1 214 5
+    leaq -272(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_305
+    jmp .Lf1_304
+.Lf1_305:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_304:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf1_307
+    jmp .Lf1_306
+.Lf1_307:
+    movslq -36(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_306:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    cmpl $4, -44(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf1_309
+    jmp .Lf1_308
+.Lf1_309:
+    movq $34, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf1_308:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf1_end
+    movq $0, %rax
+.Lf1_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f1, .-f1
+.globl f2
+.type f2, @function
+    .p2align 4
+f2:
+    .cfi_startproc
+    .loc 1 216 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 217 5
+    subq $8, %rsp
+    movq $19, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 218 5
+    movq $85, %rax
+    movl %eax, -8(%rbp)
+    .loc 1 219 5
+    subq $8, %rsp
+    movq $92, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 220 5
+    movq $84, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 221 5
+    subq $64, %rsp
+    .loc 1 222 5
+    subq $256, %rsp
+    .loc 1 223 5
+    movq $95, %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_2
+    jmp .Lf2_3
+.Lf2_2:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_4
+.Lf2_3:
+    movslq -4(%rbp), %rax
+.Lf2_4:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_6
+    jmp .Lf2_5
+.Lf2_6:
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_8
+    jmp .Lf2_7
+.Lf2_8:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_9
+    jmp .Lf2_10
+.Lf2_9:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_11
+.Lf2_10:
+    movslq -12(%rbp), %rax
+.Lf2_11:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_7:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_5:
+    cmpq $0, %rax
+    je .Lf2_12
+    .loc 1 224 9
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -48(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_13
+    jmp .Lf2_14
+.Lf2_13:
+    movslq -16(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_15
+.Lf2_14:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_17
+    jmp .Lf2_16
+.Lf2_17:
+    movq $90, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_16:
+.Lf2_15:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -52(%rbp)
+    .loc 1 225 9
+    movq $5, %rax
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf2_18
+    jmp .Lf2_19
+.Lf2_18:
+    movslq -4(%rbp), %rax
+    jmp .Lf2_20
+.Lf2_19:
+    movslq -16(%rbp), %rax
+.Lf2_20:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_22
+    jmp .Lf2_21
+.Lf2_22:
+    movslq -16(%rbp), %rax
+    subq $93, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $87, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_21:
+    movl %eax, -12(%rbp)
+    .loc 1 226 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_24
+    jmp .Lf2_23
+.Lf2_24:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_23:
+    push %rax
+    movslq -20(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_26
+    jmp .Lf2_25
+.Lf2_26:
+    leaq -336(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_25:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_28
+    jmp .Lf2_27
+.Lf2_28:
+    movq $47, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movq $11, %rax
+    cmpq $87, %rax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_27:
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_1
+.Lf2_12:
+    .loc 1 228 9
+    movq $5, %rax
+    push %rax
+    movq $3, %rax
+    cmpq $80, %rax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_30
+    jmp .Lf2_29
+.Lf2_30:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_29:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 229 9
+    cmpl $66, -32(%rbp)
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $9, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_32
+    jmp .Lf2_31
+.Lf2_32:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_33
+    jmp .Lf2_34
+.Lf2_33:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_35
+.Lf2_34:
+    leaq -208(%rbp), %rax
+    movslq 36(%rax), %rax
+.Lf2_35:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_37
+    jmp .Lf2_36
+.Lf2_37:
+    movq $19, %rax
+    cmpq $4, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_36:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_31:
+    movl %eax, -52(%rbp)
+    .loc 1 230 9
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_39
+    jmp .Lf2_38
+.Lf2_39:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_38:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_41
+    jmp .Lf2_40
+.Lf2_41:
+    leaq -144(%rbp), %rax
+    movslq 16(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_40:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+.Lf2_1:
+    .loc 1 233 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 234 9
+    jmp .Lf2_45
+    .p2align 4,,10
+.Lf2_44:
+    .loc 1 235 13
+    movq $0, %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $73, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_46
+    jmp .Lf2_42
+.Lf2_46:
+    .loc 1 236 13
+    movslq -340(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_48
+    jmp .Lf2_47
+.Lf2_48:
+    leaq -336(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -64(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_47:
+    push %rax
+    cmpl $47, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $89, %rax
+    cmpq $22, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -8(%rbp)
+    .loc 1 238 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 239 17
+    .p2align 4,,10
+.Lf2_51:
+    .loc 1 240 21
+    movq $48, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $64, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_52
+    jmp .Lf2_49
+.Lf2_52:
+    .loc 1 241 21
+    movq $68, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $0, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_53
+    jmp .Lf2_54
+.Lf2_53:
+    leaq -272(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $60, %rax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_56
+    jmp .Lf2_57
+.Lf2_56:
+    movslq -80(%rbp), %rax
+    jmp .Lf2_58
+.Lf2_57:
+    movslq -8(%rbp), %rax
+.Lf2_58:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_55
+.Lf2_54:
+    movslq -340(%rbp), %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+.Lf2_55:
+    movl %eax, -4(%rbp)
+    .loc 1 242 21
+    leaq -144(%rbp), %rax
+    movslq 32(%rax), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    movq $7, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    cmpl $47, -52(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 243 21
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_60
+    jmp .Lf2_59
+.Lf2_60:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_59:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_62
+    jmp .Lf2_61
+.Lf2_62:
+    movq $29, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_61:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_64
+    jmp .Lf2_63
+.Lf2_64:
+    movq $86, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_63:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_66
+    jmp .Lf2_65
+.Lf2_66:
+    leaq -272(%rbp), %rax
+    movslq 60(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_65:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -16(%rbp)
+    .loc 1 244 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_50:
+    .loc 1 245 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_51
+.Lf2_49:
+    addq $0, %rsp
+    .loc 1 247 13
+    movq $4, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_68
+    jmp .Lf2_67
+.Lf2_68:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_67:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    .loc 1 248 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_43:
+.Lf2_45:
+    .loc 1 234 16
+    cmpl $2, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_44
+.Lf2_42:
+    addq $8, %rsp
+    .loc 1 252 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 253 9
+    jmp .Lf2_72
+    .p2align 4,,10
+.Lf2_71:
+    .loc 1 254 13
+    movq $1, %rax
+    push %rax
+    movslq -64(%rbp), %rax
+    cmpl -24(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_73
+    jmp .Lf2_74
+.Lf2_73:
+    movslq -340(%rbp), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_75
+.Lf2_74:
+    movslq -8(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_75:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -40(%rbp)
+    .loc 1 255 13
+    movq $5, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_76
+    jmp .Lf2_77
+.Lf2_76:
+    leaq -272(%rbp), %rax
+    movslq 52(%rax), %rax
+    jmp .Lf2_78
+.Lf2_77:
+    leaq -144(%rbp), %rax
+    movslq 8(%rax), %rax
+.Lf2_78:
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 56(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 257 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 258 17
+    .p2align 4,,10
+.Lf2_81:
+    .loc 1 259 21
+    cmpl $86, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $78, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_82
+    jmp .Lf2_79
+.Lf2_82:
+    .loc 1 260 21
+    movq $2, %rax
+    push %rax
+    movq $2, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $84, -344(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_84
+    jmp .Lf2_83
+.Lf2_84:
+    leaq -208(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_83:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -24(%rbp)
+    .loc 1 261 21
+    movq $54, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_86
+    jmp .Lf2_85
+.Lf2_86:
+    movq $17, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_85:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -16(%rbp)
+    .loc 1 262 21
+    movq $81, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_88
+    jmp .Lf2_87
+.Lf2_88:
+    movq $35, %rax
+    cmpq $0, %rax
+    jne .Lf2_89
+    jmp .Lf2_90
+.Lf2_89:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_91
+.Lf2_90:
+    movslq -12(%rbp), %rax
+.Lf2_91:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_93
+    jmp .Lf2_92
+.Lf2_93:
+    movslq -4(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_92:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_87:
+    movl %eax, -8(%rbp)
+    .loc 1 263 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_80:
+    .loc 1 264 26
+    cmpl $8, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_81
+.Lf2_79:
+    addq $0, %rsp
+    .loc 1 266 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_70:
+.Lf2_72:
+    .loc 1 253 16
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_71
+.Lf2_69:
+    addq $8, %rsp
+    .loc 1 270 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    .loc 1 271 9
+    jmp .Lf2_97
+    .p2align 4,,10
+.Lf2_96:
+    .loc 1 272 13
+    movslq -4(%rbp), %rax
+    addl -76(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $91, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_98
+    jmp .Lf2_94
+.Lf2_98:
+    .loc 1 273 13
+    movq $6, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_99
+    jmp .Lf2_100
+.Lf2_99:
+    movslq -12(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    jmp .Lf2_101
+.Lf2_100:
+    movq $48, %rax
+    imull -72(%rbp), %eax
+    movslq %eax, %rax
+.Lf2_101:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_103
+    jmp .Lf2_102
+.Lf2_103:
+    movq $2, %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 20(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_105
+    jmp .Lf2_104
+.Lf2_105:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_104:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_102:
+    movl %eax, -8(%rbp)
+    .loc 1 274 13
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_107
+    jmp .Lf2_106
+.Lf2_107:
+    leaq -208(%rbp), %rax
+    movslq 20(%rax), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_106:
+    push %rax
+    movslq -12(%rbp), %rax
+    imulq $79, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_109
+    jmp .Lf2_108
+.Lf2_109:
+    movslq -340(%rbp), %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_108:
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 276 17
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 277 17
+    .p2align 4,,10
+.Lf2_112:
+    .loc 1 278 21
+    movslq -340(%rbp), %rax
+    cmpl -344(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $70, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_113
+    jmp .Lf2_110
+.Lf2_113:
+    .loc 1 279 21
+    movslq -32(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $89, %rax
+    subl -36(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -4(%rbp), %rax
+    subq $86, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_115
+    jmp .Lf2_114
+.Lf2_115:
+    movslq -24(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_117
+    jmp .Lf2_116
+.Lf2_117:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_116:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_114:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 280 21
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_122
+    jmp .Lf2_121
+.Lf2_122:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_121:
+    cmpq $0, %rax
+    jne .Lf2_118
+    jmp .Lf2_119
+.Lf2_118:
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_123
+    jmp .Lf2_124
+.Lf2_123:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_125
+.Lf2_124:
+    movslq -8(%rbp), %rax
+.Lf2_125:
+    jmp .Lf2_120
+.Lf2_119:
+    cmpl $24, -340(%rbp)
+    movq $0, %rax
+    setne %al
+.Lf2_120:
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_127
+    jmp .Lf2_126
+.Lf2_127:
+    movq $95, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_126:
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 281 21
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_132
+    jmp .Lf2_131
+.Lf2_132:
+    movq $8, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_131:
+    cmpq $0, %rax
+    jne .Lf2_128
+    jmp .Lf2_129
+.Lf2_128:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_133
+    jmp .Lf2_134
+.Lf2_133:
+    movq $44, %rax
+    jmp .Lf2_135
+.Lf2_134:
+    movslq -340(%rbp), %rax
+.Lf2_135:
+    jmp .Lf2_130
+.Lf2_129:
+    movslq -16(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+.Lf2_130:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_137
+    jmp .Lf2_136
+.Lf2_137:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -60(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_136:
+    movl %eax, -24(%rbp)
+    .loc 1 282 21
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_111:
+    .loc 1 283 26
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_112
+.Lf2_110:
+    addq $0, %rsp
+    .loc 1 285 13
+    incl -340(%rbp)
+    addq $0, %rsp
+.Lf2_95:
+.Lf2_97:
+    .loc 1 271 16
+    cmpl $7, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_96
+.Lf2_94:
+    addq $8, %rsp
+    .loc 1 288 5
+    movq $4, %rax
+    push %rax
+    movq $46, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    cmpl $82, -4(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    je .Lf2_139
+    .loc 1 289 9
+    movq $33, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_141
+    jmp .Lf2_140
+.Lf2_141:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_140:
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 28(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $37, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    leaq -272(%rbp), %rax
+    pop %rdx
+    movl %edx, 32(%rax)
+    movq %rdx, %rax
+    .loc 1 290 9
+    movslq -20(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $21, %rax
+    cmpl -80(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    cmpl $91, -24(%rbp)
+    movq $0, %rax
+    setg %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $0, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 291 9
+    movq $8, %rax
+    push %rax
+    movslq -40(%rbp), %rax
+    cmpl -52(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $6, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 52(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_143
+    jmp .Lf2_142
+.Lf2_143:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_142:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    movl %eax, -36(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_138
+.Lf2_139:
+    .loc 1 293 9
+    movq $2, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 294 9
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_145
+    jmp .Lf2_144
+.Lf2_145:
+    movslq -40(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_144:
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -56(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -60(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_146
+    jmp .Lf2_147
+.Lf2_146:
+    movq $63, %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_148
+.Lf2_147:
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+.Lf2_148:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 295 9
+    movslq -48(%rbp), %rax
+    imull -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_149
+    jmp .Lf2_150
+.Lf2_149:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_151
+.Lf2_150:
+    movslq -16(%rbp), %rax
+.Lf2_151:
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    subl -4(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_152
+    jmp .Lf2_153
+.Lf2_152:
+    movq $62, %rax
+    cmpq $45, %rax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_154
+.Lf2_153:
+    movslq -12(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+.Lf2_154:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -28(%rbp)
+    addq $0, %rsp
+.Lf2_138:
+    .loc 1 297 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_160
+    .p2align 4,,10
+.Lf2_159:
+    .loc 1 298 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_163
+    jmp .Lf2_162
+.Lf2_163:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_162:
+    cmpq $55, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_161
+    jmp .Lf2_157
+.Lf2_161:
+    .loc 1 299 9
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 32(%rax), %rax
+    cmpq $45, %rax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $3, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -12(%rbp)
+    .loc 1 300 9
+    movq $2, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_165
+    jmp .Lf2_164
+.Lf2_165:
+    cmpl $33, -12(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subq $51, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_164:
+    movl %eax, -4(%rbp)
+    .loc 1 302 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 303 13
+    jmp .Lf2_169
+    .p2align 4,,10
+.Lf2_168:
+    .loc 1 304 17
+    movslq -340(%rbp), %rax
+    imull -16(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $53, %rax
+    movq $0, %rax
+    setg %al
+    cmpq $0, %rax
+    je .Lf2_170
+    jmp .Lf2_166
+.Lf2_170:
+    .loc 1 305 17
+    movslq -28(%rbp), %rax
+    cmpl -40(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_172
+    jmp .Lf2_171
+.Lf2_172:
+    movq $15, %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_171:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_174
+    jmp .Lf2_173
+.Lf2_174:
+    movslq -344(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_173:
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 24(%rax)
+    movq %rdx, %rax
+    .loc 1 306 17
+    movq $4, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_176
+    jmp .Lf2_175
+.Lf2_176:
+    movslq -340(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_175:
+    push %rax
+    movq $3, %rax
+    push %rax
+    movq $63, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 307 17
+    movslq -80(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_177
+    jmp .Lf2_178
+.Lf2_177:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_179
+.Lf2_178:
+    movslq -12(%rbp), %rax
+.Lf2_179:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 36(%rax)
+    movq %rdx, %rax
+    .loc 1 308 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_167:
+.Lf2_169:
+    .loc 1 303 20
+    cmpl $2, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_168
+.Lf2_166:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_158:
+    .loc 1 297 30
+    incl -340(%rbp)
+.Lf2_160:
+    cmpl $3, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_159
+.Lf2_157:
+    addq $8, %rsp
+    .loc 1 312 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_185
+    .p2align 4,,10
+.Lf2_184:
+    .loc 1 314 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 315 13
+    .p2align 4,,10
+.Lf2_188:
+    .loc 1 316 17
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_190
+    jmp .Lf2_189
+.Lf2_190:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_189:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 36(%rax), %rax
+    addl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $59, %rax
+    addl -80(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 48(%rax)
+    movq %rdx, %rax
+    .loc 1 317 17
+    movq $41, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_191
+    jmp .Lf2_192
+.Lf2_191:
+    movq $79, %rax
+    jmp .Lf2_193
+.Lf2_192:
+    movq $97, %rax
+.Lf2_193:
+    push %rax
+    movq $2, %rax
+    cmpq $0, %rax
+    jne .Lf2_194
+    jmp .Lf2_195
+.Lf2_194:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_196
+.Lf2_195:
+    movslq -340(%rbp), %rax
+.Lf2_196:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -64(%rbp)
+    .loc 1 318 17
+    cmpl $31, -344(%rbp)
+    movq $0, %rax
+    sete %al
+    push %rax
+    cmpl $26, -340(%rbp)
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -8(%rbp), %rax
+    subl -344(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    cmpl $27, -28(%rbp)
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -8(%rbp)
+    .loc 1 319 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_187:
+    .loc 1 320 22
+    cmpl $7, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_188
+.Lf2_186:
+    addq $0, %rsp
+    .loc 1 322 9
+    movq $5, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_198
+    jmp .Lf2_197
+.Lf2_198:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_197:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 32(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_200
+    jmp .Lf2_199
+.Lf2_200:
+    leaq -144(%rbp), %rax
+    movslq 36(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_199:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    pop %rdx
+    movl %edx, 60(%rax)
+    movq %rdx, %rax
+    .loc 1 323 9
+    movslq -12(%rbp), %rax
+    subl -12(%rbp), %eax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_202
+    jmp .Lf2_201
+.Lf2_202:
+    movq $24, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_204
+    jmp .Lf2_203
+.Lf2_204:
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_203:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_201:
+    push %rax
+    movq $6, %rax
+    push %rax
+    movq $36, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lf2_183:
+    .loc 1 312 30
+    incl -340(%rbp)
+.Lf2_185:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_184
+.Lf2_182:
+    addq $8, %rsp
+    .loc 1 325 5
+    movslq -4(%rbp), %rax
+    imull -20(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_210
+    jmp .Lf2_209
+.Lf2_210:
+    leaq -144(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_209:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_206
+    jmp .Lf2_207
+.Lf2_206:
+    movq $4, %rax
+    push %rax
+    movq $15, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $38, %rax
+    addq $28, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_208
+.Lf2_207:
+    movslq -12(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 60(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    jne .Lf2_211
+    jmp .Lf2_212
+.Lf2_211:
+    movslq -8(%rbp), %rax
+    addq $54, %rax
+    movslq %eax, %rax
+    jmp .Lf2_213
+.Lf2_212:
+    movq $9, %rax
+    push %rax
+    movq $38, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_213:
+.Lf2_208:
+    cmpq $0, %rax
+    je .Lf2_214
+    .loc 1 326 9
+    movq $1, %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $8, %rax
+    push %rax
+    movq $78, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_218
+    jmp .Lf2_219
+.Lf2_218:
+    leaq -144(%rbp), %rax
+    movslq 56(%rax), %rax
+    jmp .Lf2_220
+.Lf2_219:
+    movslq -4(%rbp), %rax
+.Lf2_220:
+    cmpq $0, %rax
+    jne .Lf2_215
+    jmp .Lf2_216
+.Lf2_215:
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    jmp .Lf2_217
+.Lf2_216:
+    leaq -272(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_222
+    jmp .Lf2_221
+.Lf2_222:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_221:
+.Lf2_217:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    movl %eax, -16(%rbp)
+    .loc 1 327 9
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_227
+    jmp .Lf2_226
+.Lf2_227:
+    movslq -60(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_226:
+    cmpq $0, %rax
+    jne .Lf2_223
+    jmp .Lf2_224
+.Lf2_223:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_228
+    jmp .Lf2_229
+.Lf2_228:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_230
+.Lf2_229:
+    movslq -4(%rbp), %rax
+.Lf2_230:
+    jmp .Lf2_225
+.Lf2_224:
+    movq $1, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_225:
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_232
+    jmp .Lf2_231
+.Lf2_232:
+    movq $86, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_231:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -144(%rbp), %rax
+    pop %rdx
+    movl %edx, 44(%rax)
+    movq %rdx, %rax
+    .loc 1 328 9
+    movq $53, %rax
+    cmpq $29, %rax
+    movq $0, %rax
+    setle %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 44(%rax), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    push %rax
+    movslq -60(%rbp), %rax
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 28(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_234
+    jmp .Lf2_233
+.Lf2_234:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_236
+    jmp .Lf2_235
+.Lf2_236:
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_235:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_233:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -8(%rbp)
+    addq $0, %rsp
+    jmp .Lf2_205
+.Lf2_214:
+    .loc 1 330 9
+    movq $7, %rax
+    push %rax
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_238
+    jmp .Lf2_237
+.Lf2_238:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_237:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movq $59, %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 48(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    movl %eax, -4(%rbp)
+    .loc 1 331 9
+    leaq -336(%rbp), %rax
+    movslq 24(%rax), %rax
+    cmpq $95, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lf2_239
+    jmp .Lf2_240
+.Lf2_239:
+    movslq -72(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_241
+.Lf2_240:
+    leaq -208(%rbp), %rax
+    movslq 16(%rax), %rax
+    push %rax
+    leaq -144(%rbp), %rax
+    movslq 40(%rax), %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_241:
+    push %rax
+    movq $50, %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    push %rax
+    movq $18, %rax
+    cmpq $0, %rax
+    jne .Lf2_242
+    jmp .Lf2_243
+.Lf2_242:
+    movq $30, %rax
+    jmp .Lf2_244
+.Lf2_243:
+    movslq -4(%rbp), %rax
+.Lf2_244:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    movl %eax, -16(%rbp)
+    .loc 1 332 9
+    movslq -12(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_245
+    jmp .Lf2_246
+.Lf2_245:
+    movq $71, %rax
+    jmp .Lf2_247
+.Lf2_246:
+    movslq -8(%rbp), %rax
+.Lf2_247:
+    push %rax
+    leaq -272(%rbp), %rax
+    movslq 12(%rax), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setg %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movq $4, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 8(%rax), %rax
+    imull -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -12(%rbp)
+    addq $0, %rsp
+.Lf2_205:
+    .loc 1 334 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -340(%rbp)
+    jmp .Lf2_253
+    .p2align 4,,10
+.Lf2_252:
+    .loc 1 335 9
+    movq $8, %rax
+    push %rax
+    movslq -68(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    jne .Lf2_254
+    jmp .Lf2_255
+.Lf2_254:
+    movslq -8(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_257
+    jmp .Lf2_258
+.Lf2_257:
+    movq $67, %rax
+    jmp .Lf2_259
+.Lf2_258:
+    movq $98, %rax
+.Lf2_259:
+    push %rax
+    movq $2, %rax
+    push %rax
+    movq $27, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    jmp .Lf2_256
+.Lf2_255:
+    movslq -4(%rbp), %rax
+    cmpl -8(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    push %rax
+    movslq -12(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setg %al
+.Lf2_256:
+    movl %eax, -36(%rbp)
+    .loc 1 336 9
+    movslq -8(%rbp), %rax
+    cmpl -340(%rbp), %eax
+    movq $0, %rax
+    setne %al
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 52(%rax), %rax
+    imulq $60, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    push %rax
+    movq $54, %rax
+    subl -340(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $1, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setl %al
+    movl %eax, -72(%rbp)
+    .loc 1 338 13
+    movq $0, %rax
+    movl %eax, -344(%rbp)
+    .loc 1 339 13
+    .p2align 4,,10
+.Lf2_262:
+    .loc 1 340 17
+    movq $4, %rax
+    push %rax
+    movq $14, %rax
+    cmpq $0, %rax
+    jne .Lf2_263
+    jmp .Lf2_264
+.Lf2_263:
+    movslq -56(%rbp), %rax
+    jmp .Lf2_265
+.Lf2_264:
+    movslq -340(%rbp), %rax
+.Lf2_265:
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_267
+    jmp .Lf2_266
+.Lf2_267:
+    movslq -16(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movq $20, %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    sub %rbx, %rax
+    movslq %eax, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_266:
+    movl %eax, -72(%rbp)
+    .loc 1 341 17
+    movslq -340(%rbp), %rax
+    cmpl -68(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_268
+    jmp .Lf2_269
+.Lf2_268:
+    movslq -344(%rbp), %rax
+    jmp .Lf2_270
+.Lf2_269:
+    movslq -4(%rbp), %rax
+.Lf2_270:
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_272
+    jmp .Lf2_271
+.Lf2_272:
+    movslq -344(%rbp), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_271:
+    push %rax
+    movq $8, %rax
+    push %rax
+    movslq -344(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    sete %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 342 17
+    movq $8, %rax
+    push %rax
+    cmpl $26, -344(%rbp)
+    movq $0, %rax
+    setge %al
+    push %rax
+    movslq -16(%rbp), %rax
+    cmpl -16(%rbp), %eax
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 343 17
+    incl -344(%rbp)
+    addq $0, %rsp
+.Lf2_261:
+    .loc 1 344 22
+    cmpl $3, -344(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_262
+.Lf2_260:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lf2_251:
+    .loc 1 334 32
+    incl -340(%rbp)
+.Lf2_253:
+    cmpl $5, -340(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lf2_252
+.Lf2_250:
+    addq $8, %rsp
+    .loc 1 347 5
+    movslq -68(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpl -12(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    jne .Lf2_273
+    jmp .Lf2_274
+.Lf2_273:
+    movslq -4(%rbp), %rax
+    addq $13, %rax
+    movslq %eax, %rax
+    push %rax
+    leaq -336(%rbp), %rax
+    movslq 4(%rax), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setle %al
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    jmp .Lf2_275
+.Lf2_274:
+    movq $94, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_277
+    jmp .Lf2_276
+.Lf2_277:
+    movq $63, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_276:
+    push %rax
+    movslq -4(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_278
+    jmp .Lf2_279
+.Lf2_278:
+    movslq -8(%rbp), %rax
+    jmp .Lf2_280
+.Lf2_279:
+    movslq -56(%rbp), %rax
+.Lf2_280:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setle %al
+.Lf2_275:
+    movl %eax, -12(%rbp)
+    .loc 1 348 5
+    cmpl $19, -4(%rbp)
+    movq $0, %rax
+    setge %al
+    cmpq $0, %rax
+    jne .Lf2_281
+    jmp .Lf2_282
+.Lf2_281:
+    movslq -4(%rbp), %rax
+    addq $16, %rax
+    movslq %eax, %rax
+    jmp .Lf2_283
+.Lf2_282:
+    movq $8, %rax
+    push %rax
+    movslq -16(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movslq %eax, %rax
+.Lf2_283:
+    push %rax
+    leaq -208(%rbp), %rax
+    movslq 40(%rax), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_285
+    jmp .Lf2_284
+.Lf2_285:
+    movq $66, %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_284:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+    cmpq $0, %rax
+    je .Lf2_287
+    jmp .Lf2_286
+.Lf2_287:
+    movslq -16(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lf2_288
+    jmp .Lf2_289
+.Lf2_288:
+    movslq -16(%rbp), %rax
+    jmp .Lf2_290
+.Lf2_289:
+    movq $85, %rax
+.Lf2_290:
+    cmpq $0, %rax
+    movq $0, %rax
+    setne %al
+.Lf2_286:
+    pop %rbx
+    cmp %rax, %rbx
+    movq $0, %rax
+    setge %al
+    jmp .Lf2_end
+    movq $0, %rax
+.Lf2_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size f2, .-f2
@@ -0,0 +1,461 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 83;
+    int v2 = 57;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    a1[2][2] = (((1 * 86) + (v0 - 40)) ? ((1 || a0[8]) || (a1[3][0] && 33)) : ((v2 * v3) != (v3 && v2)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((a1[3][6] >= a1[1][1]) ? (22 / 8) : (57 && v0)) - ((i0 / 5) * (66 / 6)));
+                a1[1][10] = (((88 > 92) != (v3 + i0)) <= ((i1 < 58) <= (34 ? v0 : a1[0][4])));
+                v3 = (((26 <= v1) != (75 + a1[2][13])) != ((i0 > 40) >= (v1 != v1)));
+            }
+            v1 = (((51 != i0) || (v2 / 1)) % 8);
+            v3 = (((v0 / 1) && (0 * i0)) != ((i0 && v2) != (i0 ? a0[2] : v1)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((55 && v0) > 51) break;
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    a1[1][10] = (((a0[2] || a0[4]) >= (v2 ? i3 : v3)) + ((3 && a0[13]) >= (i3 == a1[1][6])));
+                    v2 = (((a0[2] && a1[1][9]) != (a0[8] != a0[3])) || ((v0 ? i2 : a0[6]) != (a0[9] % 4)));
+                    v0 = (((i3 ? 62 : 84) + (a0[9] ? v1 : 87)) || ((68 == a0[5]) ? (62 < 87) : (v1 + v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[3][0] = (((v1 ? v2 : v3) ? (v1 && a1[3][11]) : (v3 && 2)) && ((v2 && 85) && (v3 % 4)));
+            a0[15] = (((42 || 3) ? (a1[3][10] && 58) : (a1[2][1] + 10)) && ((a0[11] != i2) || (v3 / 9)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v0 % 6) && (a0[1] + v0)) <= ((a1[3][14] - 29) - (v1 / 9)))) {
+        a0[8] = (((a0[8] != 22) * (70 / 4)) ? ((a0[14] ? v1 : a0[11]) * (13 && v3)) : ((v3 && v3) * (34 <= v0)));
+        v2 = (((v2 > 40) < (a0[15] == a0[1])) * ((v1 + v3) < (a0[13] ? v3 : v2)));
+        v3 = (((a0[10] || 73) >= (v2 == a1[0][1])) >= ((16 * a0[6]) % 6));
+    } else {
+        a0[0] = (((3 <= 95) < (47 != a0[14])) <= ((v0 == v1) && (6 ? 80 : a0[3])));
+        v0 = (((v0 / 4) * (v0 == v0)) + ((82 + a0[15]) >= (v3 > a0[8])));
+        v2 = (((65 ? v1 : a1[1][9]) == (a1[0][0] && a1[3][11])) % 1);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((v1 && 16) > 71) break;
+                    v1 = (((i4 || 50) > (v0 / 5)) ? ((v3 == a0[10]) > (a0[10] * i4)) : ((i4 ? a1[0][14] : 54) < (53 - 3)));
+                    a0[15] = (((a1[3][0] - v1) != (i5 ? a0[12] : v3)) <= ((74 && 2) > (v1 ? 42 : 15)));
+                    v0 = (((v2 && a1[3][13]) ? (i4 || a0[15]) : (i5 < a1[2][1])) == ((a0[0] == 10) < (v0 != a1[2][13])));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((a1[2][6] / 7) || (i4 * v3)) % 8);
+            v2 = (((a1[3][12] * a1[3][9]) && (i4 <= v1)) >= ((v1 == v1) < (3 < 72)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 > v2) / 3) >= ((v1 == v1) / 5))) {
+        v1 = (((v3 ? v3 : v3) != (v1 + v1)) >= ((v0 < 77) < (a0[1] != v2)));
+        a1[3][8] = (((v0 % 1) && (v2 - 37)) ? ((v0 || v1) ? (v3 < v1) : (75 > 48)) : ((v1 / 5) < (27 >= v0)));
+        v2 = (((v3 > v1) - (10 - a0[5])) || ((v2 + v1) <= (a0[15] || v2)));
+    } else {
+        a0[8] = (((v1 == v2) - (a0[10] / 2)) > ((v0 == v2) < (a0[7] > a0[2])));
+        v3 = (((v1 / 6) - (a1[3][0] >= v3)) ? ((v2 != 87) * (v2 < v0)) : ((v3 > a0[4]) % 2));
+        v2 = (((a1[3][2] || v3) != (v2 == v3)) && ((v0 % 2) != (v2 / 4)));
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        v3 = (((v0 > v3) && (v1 < 60)) || ((21 + v0) < (a1[2][8] + v2)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                v0 = (((v3 ? v1 : a1[1][7]) <= (23 ? a0[12] : a1[0][14])) % 5);
+                v0 = (((73 / 7) < (a0[5] / 2)) - ((v2 + i7) < (a1[0][11] || v2)));
+                v2 = (((a1[0][14] || v2) < (i6 == v2)) * ((i6 >= 2) >= (v0 / 2)));
+                i7 = i7 + 1;
+            }
+        }
+        v2 = (((a1[0][6] && a1[3][13]) > (v3 / 7)) % 2);
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        if ((v3 % 9) > 85) break;
+        v2 = (((i8 || a1[2][8]) * (90 && i8)) - ((45 * 66) ? (24 % 5) : (v1 >= v2)));
+        for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+            if ((v3 % 8) > 96) break;
+            a0[10] = (((v2 * a0[10]) > (90 + i9)) != ((i8 < v0) / 1));
+            v1 = (((i9 != 86) == (86 ? v2 : v1)) <= ((38 >= v1) + (38 && i9)));
+            a1[2][4] = (((56 / 9) / 4) >= ((i8 || v0) <= (i9 || i9)));
+        }
+        v0 = (((i8 ? i8 : 82) > (a1[2][9] % 9)) || ((43 > a1[1][12]) == (v3 < v0)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 3) {
+            v1 = (((v0 < v0) < (v2 % 2)) == ((a0[13] + 34) ? (v2 < a1[3][14]) : (a1[0][6] >= v1)));
+            a1[3][4] = (((i10 % 5) == (v2 >= 56)) - ((81 <= v1) ? (i10 > i10) : (v3 && v2)));
+            {
+                int i11 = 0;
+                while (i11 < 2) {
+                    v0 = (((v3 || 95) ? (v2 >= i10) : (a1[1][8] == 81)) <= ((a0[3] < 78) ? (v1 * v2) : (v3 || i10)));
+                    v2 = (((i11 == v1) && (v0 && v3)) % 1);
+                    v2 = (((58 / 4) != (v0 % 2)) >= ((a1[1][9] * v0) && (a0[11] < 11)));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        }
+    }
+    if ((((v3 != 93) == (v0 ? a0[10] : v1)) && ((59 ? a0[3] : a1[2][10]) < (96 ? v3 : 61)))) {
+        v0 = (((a1[2][8] > v1) * (a0[10] ? v0 : a0[1])) / 7);
+        a1[1][10] = (((v2 * a0[15]) + (6 / 2)) <= ((v0 + v3) % 7));
+        v0 = (((82 != v3) < (a1[0][8] * v0)) % 2);
+    } else {
+        v2 = (((v1 == 40) * (46 * 3)) == ((29 ? v0 : v2) || (v0 < 63)));
+        v0 = (((46 != a0[13]) != (a1[2][7] % 5)) != ((v0 || a0[12]) + (v3 != v3)));
+        a0[12] = (((a1[1][7] && 59) + (v0 >= 85)) && ((v1 % 6) * (a1[0][2] / 6)));
+    }
+    return (((v1 + 96) ? (v1 != v1) : (v0 && v3)) % 1);
+}
+int f1() {
+    int v0 = 75;
+    int v1 = 12;
+    int v2 = 28;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 <= v0) >= (53 && v2)) - ((a0[4] <= v3) > (a0[2] ? v2 : a1[0][7])))) {
+        a1[0][6] = (((68 || 79) > (v0 == v3)) || ((v2 >= 86) % 6));
+        v0 = (((v3 ? a1[2][9] : 66) < (43 ? v2 : 26)) - ((a0[14] > a1[3][4]) % 7));
+        a1[0][4] = (((v2 * 34) >= (v3 * v1)) > ((a0[10] != v1) / 6));
+    } else {
+        v3 = (((v2 / 3) != (v2 != v1)) - ((13 || v0) >= (a0[15] ? a0[3] : a1[3][14])));
+        a1[2][7] = (((a0[9] - v0) ? (84 / 1) : (95 / 4)) < ((v3 ? a1[3][2] : a0[2]) / 3));
+        a1[2][6] = (((a0[5] / 4) ? (52 > 3) : (v3 % 8)) && ((a0[9] - a0[1]) / 9));
+    }
+    a0[12] = (((v1 != a0[9]) == (58 < v0)) >= ((v1 <= 91) ? (v3 ? v1 : v3) : (a0[13] % 1)));
+    v2 = (((v2 >= 77) > (a1[2][4] % 5)) + ((v2 % 3) <= (30 ? v3 : a1[1][6])));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((i0 ? v3 : v3) % 3) % 9);
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v3 = (((a0[8] % 7) <= (i1 != v1)) / 7);
+                v2 = (((94 >= i0) < (i0 != v0)) == ((a0[12] < i1) <= (v2 * i1)));
+                a1[3][6] = (((i1 <= a0[12]) < (v3 ? a0[0] : 48)) < ((6 >= v3) && (56 || a1[1][7])));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((75 < a1[1][9]) >= (a0[4] <= 85)) == ((67 ? v2 : v1) + (a1[0][3] < a1[2][14])));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((31 - v3) >= (22 && v2)) - ((a0[8] / 3) + (v2 ? 52 : a0[12])));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v0 = (((39 || a1[0][4]) * (a0[9] && 27)) == ((71 ? a1[2][8] : v0) == (i2 ? v0 : a1[0][0])));
+                v3 = (((8 ? v0 : v0) ? (v2 ? v2 : a1[0][1]) : (v0 < 90)) / 2);
+                v2 = (((a0[4] <= a1[3][14]) % 1) + ((27 * i3) == (a0[8] == a1[2][13])));
+            }
+            v1 = (((40 != 81) - (24 / 6)) && ((v0 || a1[1][8]) || (90 / 7)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a0[3] = (((a1[0][9] - v3) && (v3 < a1[0][14])) <= ((i4 / 2) == (4 <= a1[0][8])));
+        v0 = (((v3 <= a1[2][10]) || (89 ? i4 : 5)) <= ((v1 / 8) != (i4 > v2)));
+        {
+            int i5 = 0;
+            do {
+                if ((a1[0][5] + v2) > 92) break;
+                v3 = (((a0[3] && v0) + (a0[8] || i5)) != ((a0[2] > v3) % 6));
+                v0 = (((a1[1][5] ? v3 : 77) != (a0[7] ? 33 : v1)) == ((i4 > v0) >= (v2 < a0[5])));
+                v3 = (((a1[3][4] > 75) / 2) % 2);
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        if ((v3 ? 15 : i6) > 94) break;
+        {
+            int i7 = 0;
+            do {
+                a0[0] = (((v3 >= 85) != (v2 && v2)) >= ((53 >= a1[3][4]) ? (v1 > v0) : (44 > 51)));
+                v2 = (((i7 + a1[1][4]) > (v3 <= v0)) == ((40 > 21) >= (2 == v3)));
+                a0[12] = (((v0 / 7) + (20 - a1[3][4])) % 2);
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        a0[0] = (((v2 + v0) % 3) / 3);
+        v0 = (((v3 / 7) >= (53 || i6)) == ((v3 / 7) > (v3 >= a1[3][3])));
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((v1 % 6) > 86) break;
+            v3 = (((i8 || a0[7]) / 5) + ((a0[7] ? 26 : v3) <= (v0 || 54)));
+            {
+                int i9 = 0;
+                do {
+                    a0[8] = (((v3 ? a1[1][1] : i9) >= (i9 ? 73 : v2)) - ((i8 * a1[1][5]) < (v0 > 26)));
+                    a1[1][8] = (((a0[8] != 73) < (a0[13] - i8)) == ((v0 - v1) > (v0 * 89)));
+                    a0[1] = (((a0[3] || 65) && (i8 / 2)) + ((v3 != v0) % 6));
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            a1[3][0] = (((v3 / 2) == (5 % 2)) ? ((a0[7] / 2) ? (10 ? v1 : v3) : (v3 / 4)) : ((v3 || i8) > (v1 + v0)));
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        if ((v1 < a0[10]) > 93) break;
+        a1[2][3] = (((14 > a0[15]) && (a0[14] && a1[0][2])) + ((i10 * v2) < (a1[0][14] * a1[2][15])));
+        v0 = (((35 && 7) < (v1 ? 18 : v0)) || ((v0 ? v0 : a0[7]) ? (a1[3][12] && 62) : (v1 - v1)));
+        {
+            int i11 = 0;
+            while (i11 < 4) {
+                v0 = (((i10 < v2) % 4) % 4);
+                a0[5] = (((a1[1][3] > 63) - (a0[9] && a0[3])) * ((v2 || 64) == (a1[3][8] / 5)));
+                a0[7] = (((i11 ? 29 : a0[11]) > (40 + v1)) ? ((a1[0][4] == i10) || (v3 == v0)) : ((i11 / 4) % 3));
+                i11 = i11 + 1;
+            }
+        }
+    }
+    for (int i12 = 0; i12 < 5; i12 = i12 + 1) {
+        if ((i12 && v1) > 61) break;
+        v0 = (((a0[11] && 28) != (a0[8] ? v0 : v0)) > ((98 || 1) ? (a1[3][14] == v0) : (i12 != v2)));
+        {
+            int i13 = 0;
+            do {
+                v0 = (((v0 || v1) ? (v2 + v3) : (81 * 84)) * ((i13 >= i13) && (v3 - a0[5])));
+                v1 = (((a0[0] && i12) - (i12 >= v3)) && ((v2 / 8) ? (i13 || 91) : (86 <= 42)));
+                v0 = (((i13 > a1[2][14]) < (60 && i13)) % 8);
+                i13 = i13 + 1;
+            } while (i13 < 4);
+        }
+        a0[15] = (((v2 * v3) % 6) * ((a1[3][15] > a1[3][0]) / 1));
+    }
+    return (((v1 <= v3) / 6) || ((v1 != v3) ? (v1 < v2) : (v0 <= v1)));
+}
+int f2() {
+    int v0 = 41;
+    int v1 = 61;
+    int v2 = 13;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((a0[8] % 3) == (v0 && a1[1][8])) <= ((v0 >= v2) != (v0 >= 14)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[0][8] * v3) > 77) break;
+                    v1 = (((v2 / 7) <= (v1 && i0)) / 9);
+                    v2 = (((a1[2][1] != i0) - (a1[0][12] == 6)) ? ((a1[1][14] / 1) - (a1[0][5] || v1)) : ((a1[0][11] < 25) ? (a1[2][13] - v1) : (i0 <= i0)));
+                    a0[0] = (((a0[14] > 61) && (53 - a0[13])) % 5);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v0 = (((a1[2][7] < v0) - (v3 / 6)) ? ((i0 > 80) ? (i0 ? v0 : v1) : (50 < i0)) : ((v3 == v0) || (a1[0][1] - v3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((i2 - v0) / 6) < ((i2 ? v1 : 32) < (i2 > v0)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a1[2][7] = (((v3 > 0) != (20 * a0[9])) / 7);
+                v1 = (((a0[4] > a0[3]) < (v1 * 31)) ? ((i3 || a0[2]) - (v0 && 89)) : ((38 > i3) % 2));
+                v3 = (((a0[6] - v1) / 6) != ((a1[1][9] / 2) <= (v1 <= v3)));
+            }
+            a0[3] = (((38 && v0) / 2) / 3);
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v2 - a0[3]) > 95) break;
+            v0 = (((55 + v1) == (v2 || 54)) < ((v2 < v0) % 4));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a0[14] = (((36 || i4) && (i5 != 71)) * ((a0[4] + a1[1][0]) && (a0[0] > a0[10])));
+                v2 = (((v0 % 4) + (90 >= i4)) > ((71 - 1) % 2));
+                a0[8] = (((i5 == v3) < (73 == v1)) || ((37 ? v1 : 27) % 3));
+            }
+            a1[3][8] = (((v1 / 9) == (v2 + v1)) && ((30 / 2) >= (a0[15] ? a1[2][15] : v3)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    a0[10] = (((a0[14] / 1) || (v1 + v2)) > ((v1 * v1) != (v1 != v3)));
+    if ((((46 ? a0[10] : v2) ? (v3 != v0) : (v1 && v3)) <= ((v3 ? 42 : v2) % 3))) {
+        a1[0][14] = (((v3 || 56) <= (50 + 1)) - ((v2 < a1[1][0]) || (v2 % 6)));
+        v3 = (((27 + v0) != (v0 + v1)) * ((v0 == v2) ? (a0[0] + a0[9]) : (a0[7] == 8)));
+        v0 = (((a0[3] ? v1 : a0[5]) / 7) != ((v1 <= 2) > (a1[0][1] * a1[1][6])));
+    } else {
+        v1 = (((v2 - v1) + (v1 ? v2 : v3)) / 2);
+        a0[11] = (((a0[8] ? a1[2][3] : 70) >= (v2 - 43)) > ((a0[4] && 75) == (v3 > v2)));
+        v1 = (((v1 >= v3) - (v1 || 85)) >= ((v3 / 9) <= (a0[10] <= a1[0][11])));
+    }
+    if ((((v0 == v1) && (v3 && a0[6])) >= ((16 ? a0[3] : 16) > (v2 ? 47 : v3)))) {
+        v3 = (((26 > 53) >= (a0[9] != a1[3][7])) - ((v1 / 2) || (a0[6] && v1)));
+        v2 = (((45 <= a0[8]) * (v1 == v3)) == ((v3 ? v3 : v1) && (v3 && v3)));
+        a1[2][15] = (((30 - v3) != (v1 ? v1 : 31)) + ((v1 && v2) && (a1[0][10] == 63)));
+    } else {
+        v0 = (((a0[14] % 1) && (a0[15] ? a1[2][3] : 58)) == ((v0 - v3) > (v0 && a0[6])));
+        v0 = (((v3 >= v2) >= (40 || 71)) <= ((59 ? 27 : v3) + (v3 != a0[11])));
+        v2 = (((v0 / 8) <= (v2 != v3)) != ((a0[1] * 95) ? (v2 * 18) : (46 * a0[13])));
+    }
+    if ((((v2 >= 77) > (v0 < v1)) + ((v0 ? v0 : v1) <= (a0[8] == 10)))) {
+        v0 = (((v3 ? v1 : a1[2][3]) / 1) * ((v0 - 44) % 3));
+        v2 = (((v3 > v0) * (v3 || a1[2][0])) * ((v3 >= 15) == (a1[3][15] * a1[1][14])));
+        a1[2][2] = (((v0 - a1[3][13]) != (22 ? 53 : v0)) == ((v1 > v0) ? (v3 && v1) : (22 / 4)));
+    } else {
+        v0 = (((v0 && 30) <= (v3 ? v2 : v1)) * ((a0[11] == 20) / 5));
+        v1 = (((57 ? v0 : 5) && (v2 != v0)) || ((v3 - a0[0]) ? (v1 % 3) : (57 >= 29)));
+        a1[2][3] = (((a1[1][8] * v1) >= (v2 % 6)) / 9);
+    }
+    v3 = (((v1 / 7) / 8) != ((v2 ? v1 : v3) - (35 < 68)));
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v0 = (((v1 && v3) != (90 * 26)) + ((29 != v0) % 5));
+        {
+            int i7 = 0;
+            do {
+                a0[13] = (((i6 ? 89 : a0[14]) >= (58 <= a0[1])) ? ((v3 == a0[15]) && (a0[13] >= v0)) : ((77 - a0[10]) != (v0 >= 25)));
+                v1 = (((v2 == a0[0]) && (v2 / 8)) + ((i6 != 7) <= (v2 <= a0[3])));
+                v0 = (((v3 / 4) < (a0[13] || 28)) || ((a1[1][0] == v0) ? (84 == a1[0][3]) : (v2 || 35)));
+                i7 = i7 + 1;
+            } while (i7 < 3);
+        }
+        a1[2][11] = (((29 + a1[3][8]) - (i6 == v1)) < ((50 * a0[5]) != (38 == v3)));
+    }
+    v0 = (((v2 >= 40) / 8) || ((v3 % 6) == (47 > v0)));
+    return (((v2 + a0[8]) > (v2 ? v1 : a1[1][5])) + ((a0[13] % 1) - (v0 || a0[0])));
+}
+int f3() {
+    int v0 = 83;
+    int v1 = 19;
+    int v2 = 0;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v2 + 21) ? (a0[6] / 7) : (v3 * v2)) == ((a1[3][11] / 7) == (a0[6] * a1[0][12])));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a0[11] = (((47 % 1) <= (i0 ? a0[14] : v2)) != ((2 * v1) <= (54 ? a0[9] : v1)));
+                v2 = (((32 * a0[7]) % 6) || ((5 > v0) * (a1[0][15] && v3)));
+                v3 = (((v2 || i0) <= (78 ? 37 : 47)) * ((v2 < a0[2]) && (v0 * a1[1][6])));
+            }
+            v2 = (((i0 < v3) != (v3 > 35)) / 9);
+            v0 = (((v1 % 5) * (v2 || v3)) > ((v2 || 75) + (v0 ? v2 : 65)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((7 == v2) > 92) break;
+        v3 = (((v1 && v3) + (35 < v3)) != ((5 || 67) >= (v3 >= v3)));
+        v2 = (((a0[15] % 7) >= (v2 / 2)) + ((16 || v2) == (v2 != a0[7])));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                a0[6] = (((v1 ? v2 : 92) || (v2 ? v0 : a1[1][3])) || ((v1 % 9) != (v2 + 37)));
+                v3 = (((81 <= v2) % 3) % 2);
+                v2 = (((v0 >= v2) != (v3 % 4)) > ((89 && a0[12]) + (v0 - v0)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((v0 * v3) ? (v0 - 27) : (67 % 9)) <= ((a0[9] < v1) > (12 - v0)))) {
+        v3 = (((v2 >= v1) == (v2 / 4)) < ((a0[11] <= a1[3][7]) >= (v2 ? a1[2][0] : 85)));
+        v0 = (((v1 && v3) / 3) ? ((83 && v1) ? (66 && 67) : (v3 != 28)) : ((76 / 6) ? (56 && v1) : (61 * a1[1][12])));
+        v3 = (((96 >= v3) == (a0[0] == a1[3][5])) == ((v3 < v0) || (v0 != v1)));
+    } else {
+        a1[3][3] = (((v0 / 8) <= (v2 && a1[2][8])) ? ((v2 > v0) ? (72 == v1) : (a0[7] - 0)) : ((17 / 4) / 4));
+        a1[3][14] = (((v0 ? 88 : v1) < (68 != a1[3][3])) % 5);
+        v1 = (((v2 * v1) < (a1[0][2] < a0[15])) ? ((31 ? 27 : 11) ? (v0 == v1) : (v2 != v1)) : ((75 ? v2 : 60) <= (v1 - v3)));
+    }
+    if ((((31 != v3) - (v3 && 8)) == ((13 <= v3) - (a0[4] && 90)))) {
+        v3 = (((a1[3][12] <= v1) <= (v3 >= v2)) + ((a1[1][7] % 4) && (v0 - a0[8])));
+        v3 = (((v0 && a1[0][15]) ? (v2 ? v2 : a0[5]) : (13 < v2)) * ((v3 >= v2) == (v3 ? v1 : v2)));
+        a1[0][14] = (((v3 + v1) < (v3 - v2)) < ((v0 >= v0) < (a0[11] == v3)));
+    } else {
+        v3 = (((v1 ? v2 : v2) - (v2 >= v1)) * ((v1 < 95) ? (79 * v0) : (58 ? a0[4] : 58)));
+        v2 = (((v2 >= v0) % 1) % 9);
+        a0[5] = (((v2 <= v0) / 4) && ((v1 >= v3) != (v3 % 4)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v3 = (((a1[1][12] != v3) > (v3 + v0)) > ((v0 && v1) + (v0 - 4)));
+            a1[0][13] = (((15 + a1[1][0]) ? (89 < a0[8]) : (55 - 58)) - ((a0[11] >= 46) - (67 ? v2 : a1[0][5])));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                if ((v2 < a1[2][1]) > 58) break;
+                a1[2][13] = (((a0[6] - v3) > (v1 + 55)) == ((a0[5] ? v0 : i5) || (5 + v0)));
+                v0 = (((v2 || a1[1][10]) >= (v0 < 4)) < ((a1[0][1] ? v0 : i5) != (i5 || 34)));
+                v3 = (((v2 % 5) > (v0 ? v0 : 78)) % 5);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((a1[1][6] && 93) <= (v2 < v0)) >= ((v2 / 1) / 6));
+    if ((((a0[6] / 2) && (29 || v2)) + ((v1 ? 28 : v0) ? (a1[3][12] ? a1[0][15] : v0) : (a1[3][1] <= a0[1])))) {
+        v0 = (((50 < v2) || (v2 <= v0)) / 1);
+        v0 = (((a1[3][5] * v1) || (v3 + a0[14])) < ((47 / 3) + (v1 ? 25 : v0)));
+        v2 = (((42 <= v3) >= (v2 / 1)) ? ((5 / 7) <= (68 >= 10)) : ((v0 > a0[14]) != (92 < 7)));
+    } else {
+        v0 = (((a0[2] >= a1[0][1]) || (85 / 1)) / 3);
+        v0 = (((58 < v1) / 3) != ((v3 >= 33) * (a1[0][8] ? a0[1] : v2)));
+        v3 = (((6 && v0) > (v1 < v2)) >= ((v3 < 72) / 7));
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        a1[0][6] = (((i6 == v0) == (a1[1][14] >= v2)) >= ((i6 || a0[7]) + (a0[9] == a1[0][10])));
+        {
+            int i7 = 0;
+            do {
+                v1 = (((v2 >= 14) >= (90 <= a0[10])) < ((92 != v0) == (v2 && a0[1])));
+                a1[0][4] = (((v3 * 94) >= (v1 + 99)) > ((v0 > a1[1][6]) - (37 == v2)));
+                v0 = (((v0 <= v3) == (v2 <= v2)) - ((a1[0][4] >= v3) && (i6 ? v0 : 47)));
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        a1[0][7] = (((38 / 8) <= (a0[5] ? 3 : v3)) && ((59 != a1[0][8]) - (v2 / 9)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            a0[13] = (((a1[3][0] || a0[6]) - (a1[1][12] * 72)) == ((v1 == v2) == (a1[0][15] == a0[15])));
+            v3 = (((i8 % 2) ? (v3 - 44) : (v0 ? i8 : 13)) > ((v0 % 2) < (39 || 30)));
+            {
+                int i9 = 0;
+                do {
+                    a0[4] = (((a0[5] ? 16 : i9) % 2) ? ((i8 % 4) || (i8 % 4)) : ((i9 || 38) - (v1 >= v0)));
+                    v3 = (((i8 == v2) / 6) <= ((v2 ? i8 : i8) || (v3 && v2)));
+                    v2 = (((v0 < a0[0]) && (96 == 87)) == ((v1 * 55) <= (i9 <= i9)));
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v1 <= a0[9]) % 5) && ((v0 / 5) <= (v3 ? a1[0][1] : a1[2][15])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,109 @@
+int f0() {
+    int v0 = 7;
+    int v1 = 46;
+    int v2 = 11;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v3 = (((60 + i0) ? (18 ? 29 : v2) : (a0[5] % 4)) >= ((46 != 63) <= (a1[3][1] && 54)));
+            v3 = (((v1 < v0) ? (v2 - i0) : (v2 > 96)) ? ((v3 || v1) == (i0 < a0[6])) : ((i0 < v2) - (17 ? 27 : 41)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v0 = (((i1 == a1[1][11]) == (v2 >= v3)) / 7);
+                v3 = (((i0 * i0) || (v2 / 8)) || ((i0 % 6) + (57 + a1[2][7])));
+                v1 = (((a0[2] != v3) == (a0[12] != i1)) * ((v1 / 9) + (a1[0][0] / 7)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 - v3) < (a1[3][15] % 8)) % 3)) {
+        v1 = (((54 > v0) >= (v2 * a0[12])) + ((36 / 1) && (57 + v0)));
+        a1[2][2] = (((54 != v0) ? (v2 < v0) : (v3 || 86)) <= ((a0[4] >= 72) == (65 ? 31 : a1[1][12])));
+        a0[3] = (((v1 < a0[0]) == (v0 || 68)) * ((v2 || v1) * (v2 > 42)));
+    } else {
+        v0 = (((a1[0][5] || v0) - (v1 / 3)) ? ((a0[3] * a0[7]) != (v1 ? 9 : a1[2][12])) : ((54 % 4) != (v3 >= v1)));
+        v1 = (((v0 / 4) != (v2 + a1[3][10])) < ((a0[3] > a1[3][3]) < (9 % 9)));
+        a1[2][5] = (((a0[1] * a0[11]) && (v0 + v3)) > ((10 <= a1[2][14]) || (17 ? 36 : v1)));
+    }
+    v1 = (((0 <= 53) + (v1 < v3)) < ((94 * v3) - (v1 != v3)));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v0 = (((a1[3][14] <= v1) - (v0 ? v2 : i3)) ? ((v3 * a1[3][14]) * (v0 ? 51 : v0)) : ((i2 * 21) * (34 && a0[1])));
+            v2 = (((35 < a0[8]) > (i3 < 28)) == ((17 == i3) || (i2 > 16)));
+            v1 = (((21 > v2) ? (v1 ? v0 : a0[4]) : (85 == 79)) <= ((v3 <= i3) && (a0[11] == i3)));
+        }
+        v0 = (((a1[1][12] == i2) % 6) / 4);
+        v3 = (((v1 / 6) * (a1[3][14] * v1)) ? ((66 >= v3) ? (i2 > v2) : (v1 % 2)) : ((v1 < v0) / 6));
+    }
+    if ((((v0 % 3) >= (27 == v3)) && ((v0 <= a0[3]) >= (v0 - a1[3][6])))) {
+        v3 = (((10 - v1) < (v0 ? v2 : a1[1][10])) && ((v0 + a0[8]) ? (a1[2][11] < v1) : (v0 <= a1[2][14])));
+        v2 = (((81 <= v0) / 5) != ((a1[3][11] - v0) > (65 || v1)));
+        a0[11] = (((64 - v3) % 2) < ((63 ? a0[5] : v3) > (v2 != 17)));
+    } else {
+        a1[2][6] = (((a1[3][6] <= v0) ? (v3 || v0) : (a1[2][12] && 85)) || ((v1 - v0) != (a1[1][14] > v1)));
+        a1[1][13] = (((a0[0] < a0[8]) >= (v0 && v0)) >= ((16 + v3) * (v2 % 1)));
+        v0 = (((v2 / 1) % 3) || ((v3 || v1) == (v2 - v0)));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((6 && 32) > 73) break;
+        a1[0][1] = (((v3 || a0[8]) || (v0 <= 45)) <= ((i4 * a0[11]) - (v2 ? i4 : 56)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((i5 == a1[0][5]) || (94 > i5)) <= ((a1[3][12] >= v0) ? (i4 != 67) : (a0[8] && v1)));
+                v1 = (((i5 > a0[3]) + (v0 < 0)) / 5);
+                v1 = (((95 >= i4) <= (12 < v1)) % 3);
+                i5 = i5 + 1;
+            } while (i5 < 2);
+        }
+        v1 = (((21 != v2) % 9) / 8);
+    }
+    a1[1][10] = (((a1[3][7] == v2) != (a1[1][2] * 62)) + ((v1 != 8) > (1 <= v0)));
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        v0 = (((72 > 32) < (a1[0][5] ? a1[2][3] : v3)) / 9);
+        {
+            int i7 = 0;
+            do {
+                v0 = (((v1 / 4) % 7) * ((a1[0][9] || a0[5]) == (v2 % 2)));
+                v2 = (((a1[2][2] % 7) <= (1 == v1)) ? ((i7 / 9) * (i7 / 5)) : ((v1 < a1[1][1]) <= (a0[15] ? 76 : a1[3][2])));
+                v3 = (((1 / 4) <= (3 > v3)) ? ((i7 - i7) && (a1[3][11] + 12)) : ((i7 != 34) ? (a1[2][8] * 27) : (v3 >= 6)));
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        v3 = (((55 + v1) && (v0 && 72)) || ((a1[0][13] > 91) / 7));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            a1[0][9] = (((v2 <= v1) * (v3 < v1)) % 3);
+            v3 = (((a0[15] ? v3 : v3) >= (v1 == i8)) / 1);
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    a1[1][7] = (((a0[6] + v0) * (v3 || i9)) == ((a0[0] && i8) > (i8 + i9)));
+                    a1[1][14] = (((21 > 21) >= (66 + i9)) + ((v2 / 1) < (86 - v1)));
+                    v2 = (((i9 || a0[5]) + (v3 < a0[11])) % 9);
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    if ((((79 * v2) >= (89 ? v0 : 3)) > ((v1 + 37) ? (v1 >= v1) : (v1 / 6)))) {
+        a1[1][8] = (((34 == v3) >= (v0 ? v3 : 37)) ? ((37 && 10) + (v2 > v0)) : ((v3 * v0) <= (a0[8] % 7)));
+        v1 = (((v2 <= 66) ? (a1[1][15] ? 64 : v2) : (a1[0][2] != v0)) + ((a1[0][9] >= 83) + (v0 - v0)));
+        v1 = (((a0[0] && 88) > (a0[8] + v0)) && ((v1 || v2) != (v2 - 99)));
+    } else {
+        v3 = (((v0 || a1[1][5]) <= (v3 * v3)) < ((15 && v3) - (a0[5] / 6)));
+        v3 = (((v3 && 69) || (a0[4] == a0[13])) == ((v2 <= v2) * (95 + v0)));
+        v1 = (((a1[3][10] || v0) == (v0 > v1)) * ((v0 ? a1[1][12] : 57) != (v1 % 4)));
+    }
+    return (((a1[1][12] >= v3) && (v3 == v1)) % 1);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
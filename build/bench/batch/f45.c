@@ -0,0 +1,217 @@
+int f0() {
+    int v0 = 33;
+    int v1 = 61;
+    int v2 = 92;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[11] - v2) + (v3 ? v2 : v3)) != ((v2 && 28) || (70 || v0)))) {
+        v0 = (((a1[0][14] > v2) % 5) ? ((v0 <= 18) != (v1 > v3)) : ((1 - 0) + (a1[0][13] + a0[0])));
+        v3 = (((a1[2][3] != v2) >= (78 || a0[5])) < ((v2 - v3) - (54 + v3)));
+        v1 = (((a1[3][9] || v3) <= (a1[1][13] && v0)) + ((13 >= a0[7]) + (v0 != v3)));
+    } else {
+        v2 = (((v2 == v1) != (v3 && a1[1][3])) != ((v0 == 37) <= (a0[0] != v2)));
+        a0[13] = (((v1 - v3) <= (v3 != a1[3][8])) ? ((a1[1][2] / 4) < (a0[12] <= v1)) : ((53 == 73) % 8));
+        a1[0][13] = (((v0 <= v1) * (a0[14] % 8)) / 2);
+    }
+    v0 = (((a0[0] + a0[13]) ? (v3 <= v0) : (a0[15] % 4)) >= ((57 && v2) != (v3 || v1)));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((i0 < v3) && (a0[6] * a1[1][15])) && ((i0 ? a0[13] : 16) == (v1 % 1)));
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            a0[2] = (((v3 == 80) ? (v1 >= v0) : (50 && v3)) && ((a0[5] / 3) * (47 <= i1)));
+            a0[13] = (((v0 <= 8) % 2) != ((v2 % 5) * (i0 >= v3)));
+            v2 = (((31 * 0) - (i0 ? i1 : v0)) == ((v0 * v3) || (i1 && 55)));
+        }
+        v0 = (((i0 && v1) ? (99 || a0[2]) : (a1[2][13] % 1)) && ((i0 == i0) ? (99 ? 54 : v2) : (96 ? a0[1] : 7)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((v0 - a1[0][5]) % 8) * ((a1[1][6] <= 89) == (v2 <= a0[6])));
+        {
+            int i3 = 0;
+            do {
+                v1 = (((a0[1] == i3) / 7) % 5);
+                v2 = (((79 > v1) + (10 ? a1[2][11] : v1)) > ((7 ? v3 : v0) + (78 * v0)));
+                v1 = (((i3 == a1[1][15]) ? (v2 || 43) : (a0[2] % 8)) * ((i2 * 82) < (i2 + 26)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v1 = (((i2 < v0) * (37 > v2)) || ((51 >= a0[7]) != (v2 % 4)));
+    }
+    if ((((a0[4] - 78) - (34 * v1)) > ((a1[3][4] * 3) || (v3 + a0[1])))) {
+        v0 = (((93 <= a1[2][7]) < (18 % 2)) % 1);
+        v3 = (((a0[4] % 6) * (v3 / 8)) <= ((v0 == a0[4]) + (a0[9] || v0)));
+        a0[14] = (((v3 <= 72) - (v0 ? a0[2] : v0)) > ((22 <= v1) / 7));
+    } else {
+        v2 = (((93 != v3) != (v3 * v1)) * ((v2 + v2) == (0 && a0[15])));
+        v0 = (((v3 <= a1[3][7]) < (8 < a0[7])) <= ((v1 % 4) == (v2 - a1[1][9])));
+        a1[1][13] = (((v2 + a1[0][4]) && (a0[7] * v2)) % 1);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v0 = (((v3 % 6) ? (a0[1] ? 88 : i4) : (i5 * i5)) == ((80 || v2) && (v0 - i5)));
+                v0 = (((93 != 87) < (a0[12] != a0[7])) * ((i4 + v3) % 5));
+                a0[11] = (((i4 ? a0[4] : a0[11]) && (i5 >= 67)) <= ((a1[3][10] ? a0[8] : i4) ? (85 < v1) : (i5 <= 64)));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        a0[14] = (((v3 >= v3) < (85 > 52)) <= ((81 != v1) <= (a1[1][12] ? v3 : a1[1][7])));
+        v3 = (((v3 - a0[1]) / 8) ? ((65 > 2) + (v1 ? v3 : a0[4])) : ((a0[11] <= v0) <= (v1 % 7)));
+    }
+    v1 = (((a1[2][4] * v3) * (55 ? 91 : 37)) <= ((v2 >= a0[10]) >= (94 < v2)));
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            a1[3][8] = (((a0[6] == 26) - (a0[4] <= i7)) % 3);
+            v2 = (((v1 || v3) ? (a1[1][11] != 62) : (v3 / 4)) > ((i6 >= 55) > (a0[4] + 42)));
+            a1[0][1] = (((i6 ? v2 : 62) - (65 / 1)) % 3);
+        }
+        a0[13] = (((a0[10] <= a1[3][3]) >= (30 ? a0[12] : a1[1][15])) || ((v3 || v2) <= (v1 / 2)));
+        a1[0][2] = (((81 > a0[0]) ? (i6 / 1) : (v1 > v1)) && ((71 > a0[14]) && (a1[2][8] >= v2)));
+    }
+    if ((((v1 >= v2) % 9) >= ((v0 > v3) > (v2 && a0[11])))) {
+        v1 = (((47 ? a1[1][15] : v2) - (a0[1] || v3)) != ((22 && a0[3]) > (v2 == 38)));
+        v1 = (((a0[7] < v3) || (a1[3][2] > a1[0][5])) ? ((33 == a0[4]) != (93 || a1[1][1])) : ((a0[13] || v2) - (v1 == 18)));
+        v1 = (((a0[3] >= a1[1][13]) ? (30 < v3) : (v3 && v3)) / 7);
+    } else {
+        a1[2][9] = (((a1[3][1] < v0) * (a1[1][15] || a1[1][8])) < ((v1 < v2) >= (v2 ? v0 : v0)));
+        v0 = (((v1 <= 54) ? (v3 ? v1 : 1) : (18 / 6)) % 2);
+        a0[12] = (((v2 ? a0[0] : 55) == (v1 > v2)) + ((v0 > v0) + (54 >= v0)));
+    }
+    if ((((v0 < v0) ? (v1 ? v2 : 27) : (v1 * 74)) && ((a0[8] <= v0) > (35 / 3)))) {
+        v1 = (((81 - v1) / 1) ? ((16 - 28) ? (51 - a1[2][13]) : (v2 ? v1 : v3)) : ((a1[3][11] * v0) - (v0 < v3)));
+        v1 = (((19 / 4) != (a0[11] && v1)) || ((v1 && a0[2]) ? (v3 ? v3 : a1[0][1]) : (a1[0][12] / 7)));
+        v2 = (((57 ? v2 : a1[1][14]) ? (97 < 35) : (a0[6] ? v0 : a1[2][11])) <= ((v3 < v3) - (v0 == a1[3][6])));
+    } else {
+        v2 = (((95 ? a0[9] : 40) == (a0[12] >= v2)) <= ((a1[3][7] % 4) == (a1[2][4] ? v0 : a1[1][8])));
+        v0 = (((84 && 62) % 2) < ((v2 >= v0) < (4 >= a0[1])));
+        v2 = (((a1[0][13] / 9) ? (a0[15] % 2) : (85 > 47)) + ((v2 > v2) ? (93 || v2) : (a0[0] >= a1[1][0])));
+    }
+    return (((44 - v2) || (v0 > 80)) < ((a1[2][8] > v1) != (10 % 4)));
+}
+int f1() {
+    int v0 = 19;
+    int v1 = 6;
+    int v2 = 67;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 ? v3 : v0) * (v3 % 3)) || ((v3 || a1[2][7]) <= (a1[3][7] ? v2 : v1)))) {
+        a0[4] = (((v1 / 6) / 1) ? ((a1[3][15] % 2) ? (68 < v2) : (78 != a1[1][13])) : ((v0 * v0) * (a0[11] % 2)));
+        a0[8] = (((a1[2][13] && a0[12]) - (a1[0][9] >= a1[1][4])) >= ((v0 % 4) / 8));
+        a0[7] = (((9 ? v1 : 18) * (v2 * 2)) == ((v0 > 63) <= (v2 > 17)));
+    } else {
+        v1 = (((a1[3][4] >= v3) ? (a1[3][5] || v3) : (a1[2][4] % 4)) != ((87 || a0[7]) > (v1 <= v0)));
+        v3 = (((v0 ? v1 : 86) - (a0[2] % 8)) >= ((v0 - v1) % 8));
+        v3 = (((11 % 5) != (v2 * 29)) % 1);
+    }
+    v1 = (((a0[13] / 9) < (a1[0][15] ? a0[13] : 53)) == ((v3 * a0[13]) && (34 * v1)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((i0 > v1) + (a1[2][3] ? 60 : a1[3][2])) - ((a1[0][13] != v1) / 7));
+                    v2 = (((70 > a0[6]) + (a1[0][2] != v1)) < ((a1[0][13] || a1[3][1]) > (v1 * a0[11])));
+                    v2 = (((93 < a1[1][12]) ? (v0 ? a1[0][5] : 49) : (i1 - v1)) - ((a1[0][1] ? a0[13] : a0[7]) && (v0 || v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v1 = (((30 != a1[3][3]) < (1 || v2)) >= ((v1 || v3) > (i0 / 7)));
+            v0 = (((a0[10] ? v3 : v3) ? (34 / 7) : (a0[14] + v3)) < ((a0[5] >= a0[11]) + (35 * a1[2][14])));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    v1 = (((v0 + v2) <= (v1 / 9)) && ((v0 * a0[10]) < (v1 == v1)));
+    if ((((v1 + a1[0][4]) < (a0[11] >= a1[2][10])) < ((v0 % 2) <= (v2 && a0[8])))) {
+        v1 = (((v1 + 11) * (49 > v0)) != ((a0[12] ? v2 : 39) - (78 / 3)));
+        a1[1][3] = (((a1[2][3] <= v0) % 5) == ((v1 == 56) - (a1[0][8] ? v1 : 88)));
+        v1 = (((v2 % 3) <= (a1[3][5] ? 21 : v3)) != ((v1 - a1[0][3]) ? (36 <= a0[8]) : (v2 <= a1[3][15])));
+    } else {
+        v3 = (((a0[6] && v0) < (v2 >= v2)) == ((v0 <= v1) != (a0[8] / 2)));
+        a1[1][12] = (((a0[4] <= v2) != (a0[2] * 22)) + ((61 >= v1) && (54 <= 88)));
+        v3 = (((v1 * v0) != (a1[3][6] <= 97)) / 7);
+    }
+    if ((((v0 == a0[11]) ? (a0[7] && v1) : (a0[0] || v0)) % 1)) {
+        v3 = (((65 * v0) ? (a1[2][14] >= v2) : (v2 % 8)) ? ((v2 % 9) - (a0[2] <= v3)) : ((v2 + 19) < (30 || v2)));
+        v3 = (((a1[1][8] < a0[12]) - (v1 < a1[2][5])) % 1);
+        v2 = (((v3 < v3) <= (98 + a1[0][3])) || ((v3 % 4) / 3));
+    } else {
+        v0 = (((65 == v1) ? (v3 > v2) : (v0 / 1)) >= ((v3 * v0) + (v1 != a1[1][2])));
+        a0[7] = (((v0 % 4) <= (79 == v0)) != ((44 == v0) + (v2 + v0)));
+        v0 = (((a0[13] && 0) % 3) % 6);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v1 = (((i2 < i2) + (v1 || v0)) > ((v2 >= 44) > (v2 == a1[0][4])));
+        v2 = (((v3 * 70) >= (76 / 8)) / 3);
+        {
+            int i3 = 0;
+            do {
+                v0 = (((i3 < v3) >= (i2 <= 69)) && ((a0[11] && 25) / 2));
+                v0 = (((96 < i3) * (82 ? v3 : a0[12])) / 6);
+                a1[2][8] = (((v3 * a0[8]) || (v3 - i2)) % 1);
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v1 = (((i4 && v1) || (i5 % 7)) && ((77 && a1[2][1]) && (v2 == a1[3][10])));
+                    v1 = (((a1[3][14] * i4) ? (i4 != v0) : (a1[1][11] || v2)) * ((a0[14] <= i5) - (i4 + i4)));
+                    v0 = (((v2 % 5) || (i4 % 6)) * ((v1 != v1) ? (i5 >= v2) : (38 >= i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][2] = (((v2 + 4) && (v2 ? a1[1][0] : 15)) || ((30 * a0[3]) && (48 / 1)));
+            v2 = (((v3 ? v2 : a0[13]) >= (v3 - v0)) <= ((a1[0][5] && a0[4]) * (a1[3][2] <= a0[13])));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((v0 < v1) + (v2 ? v1 : v3)) >= ((v0 + a0[2]) + (v2 ? i6 : 29)));
+                    v3 = (((v3 && i7) <= (a0[0] % 6)) * ((38 < a0[1]) * (a0[4] != v3)));
+                    v1 = (((v0 || i6) && (a0[6] != 2)) / 8);
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            v2 = (((a0[4] ? v1 : a1[1][4]) <= (86 < a0[10])) % 2);
+            a1[2][9] = (((v2 != 99) ? (i6 ? v3 : v3) : (45 == v2)) ? ((22 < v1) <= (44 * 89)) : ((a0[10] % 3) ? (v2 + 60) : (v0 == v1)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((v3 + a1[3][9]) > 99) break;
+            v3 = (((i8 && v2) && (v3 / 5)) || ((a1[1][0] <= a0[9]) ? (i8 ? v2 : v1) : (i8 * 40)));
+            {
+                int i9 = 0;
+                do {
+                    a1[1][8] = (((28 % 3) / 9) >= ((i9 * a0[14]) % 7));
+                    a0[10] = (((26 * 71) < (a1[2][11] == 79)) - ((v0 >= v1) < (i8 >= a0[6])));
+                    v0 = (((a1[0][9] + v0) && (v1 ? i9 : i9)) % 9);
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            a1[2][0] = (((v1 < 17) ? (v3 <= i8) : (v0 % 5)) % 6);
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    return (((v3 ? 2 : v0) >= (a0[4] == v2)) * ((v3 % 6) != (63 == 65)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,368 @@
+int f0() {
+    int v0 = 55;
+    int v1 = 98;
+    int v2 = 99;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a1[1][11] = (((a1[2][10] > v1) <= (92 - i0)) * ((i0 ? 90 : a0[2]) != (v2 >= a1[2][6])));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v1 = (((3 >= a0[3]) < (84 < v1)) <= ((4 == v2) + (i1 > v0)));
+            v0 = (((v0 ? a0[12] : v2) / 1) != ((i1 * 36) * (a0[0] < a0[12])));
+            a1[3][6] = (((72 <= a1[0][11]) && (73 != i1)) % 4);
+        }
+        a0[14] = (((a0[14] >= v2) % 9) >= ((v1 && v1) ? (v3 != v0) : (v1 + 81)));
+    }
+    if ((((v3 > v2) > (v0 < v2)) >= ((v2 < a1[2][14]) > (v0 - v0)))) {
+        v2 = (((v2 % 2) ? (v1 && v3) : (4 != 1)) ? ((v3 >= v0) - (v2 % 3)) : ((9 / 4) && (v2 * a0[5])));
+        a1[1][13] = (((7 ? v1 : v1) == (a1[3][15] || 93)) >= ((v2 + v2) > (a0[15] && 82)));
+        a0[12] = (((a0[12] * 2) && (v3 >= v2)) <= ((v2 % 1) == (v0 && v1)));
+    } else {
+        a0[3] = (((v2 * a0[2]) && (a1[2][15] / 5)) % 3);
+        v3 = (((20 * v2) <= (a1[3][1] ? a1[1][0] : a1[3][0])) + ((v1 && a1[2][2]) < (v1 != v1)));
+        v0 = (((a0[2] - a0[9]) == (19 % 1)) >= ((95 / 9) ? (58 && v3) : (v2 <= v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    a1[0][12] = (((3 % 7) + (a0[2] / 4)) <= ((v3 * 74) <= (9 ? i2 : v2)));
+                    a0[3] = (((a1[3][9] * 95) ? (i2 * v1) : (v1 != v2)) > ((v3 < 75) * (v2 * i2)));
+                    v2 = (((17 >= 43) * (a0[2] > v1)) || ((a1[1][1] || i2) - (17 / 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v2 = (((v0 <= a1[1][13]) / 1) >= ((a0[10] ? 37 : 88) ? (40 ? 96 : v0) : (v2 && v3)));
+            v1 = (((58 || v2) != (a0[11] < 96)) > ((a0[10] < i2) || (v2 <= a1[3][12])));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v0 = (((v1 ? 22 : a0[10]) <= (a1[0][14] ? v1 : a1[2][13])) > ((v3 && a0[3]) / 4));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((v1 || i5) > 98) break;
+                    a1[0][9] = (((8 || i4) != (a1[3][6] <= v1)) == ((i5 && v2) - (8 == v3)));
+                    v2 = (((v2 ? a0[12] : 5) >= (v2 > v1)) ? ((a0[1] - 28) - (94 % 1)) : ((18 * 56) == (a0[9] < 53)));
+                    v2 = (((v3 && v2) <= (i4 > i5)) % 2);
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((a1[0][10] ? 28 : v2) >= (a1[0][5] || a1[1][6])) % 3);
+            a1[1][1] = (((31 % 7) - (v1 || v3)) + ((a0[9] < v1) >= (18 || v2)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[0][2] = (((67 >= i6) + (v2 <= v1)) >= ((90 == v3) && (a0[9] + a1[2][9])));
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    a0[2] = (((a1[2][8] % 9) / 4) ? ((v0 - i6) >= (a1[0][10] + v0)) : ((v1 == v3) / 9));
+                    v1 = (((i6 ? v1 : 13) || (21 / 4)) ? ((62 || a0[14]) > (a0[2] || 81)) : ((v2 != v3) != (a0[2] + v0)));
+                    a0[9] = (((a0[8] < 89) >= (a0[6] < v1)) && ((a1[1][9] || v0) || (v3 != a1[3][9])));
+                    i7 = i7 + 1;
+                }
+            }
+            a1[2][2] = (((v3 * i6) + (a0[12] != a0[13])) != ((a1[2][3] > 15) >= (v3 >= v2)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            if ((22 ? v3 : a0[0]) > 65) break;
+            a0[8] = (((64 == a0[2]) && (v1 == a0[15])) - ((i8 < 9) >= (76 + v2)));
+            v3 = (((i8 > i8) != (20 != i8)) + ((69 == a0[15]) && (99 * v3)));
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                if ((i9 ? 4 : v3) > 56) break;
+                v3 = (((12 && v3) + (a0[0] % 8)) / 3);
+                a1[0][5] = (((v1 ? v0 : v1) * (37 >= 99)) || ((a1[3][15] != a1[1][6]) < (a0[5] ? v1 : 38)));
+                v3 = (((v0 != 7) ? (v1 == v0) : (v2 > 52)) == ((v2 <= v0) ? (53 != i8) : (a0[8] < i9)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            if ((v3 % 4) > 63) break;
+            {
+                int i11 = 0;
+                do {
+                    v0 = (((v0 % 8) <= (7 < a1[2][2])) != ((v0 % 7) * (10 + v3)));
+                    a0[8] = (((79 && 85) + (53 + 2)) > ((v2 > v2) ? (v3 || v2) : (v0 + a0[4])));
+                    v3 = (((v3 <= 13) || (79 % 6)) ? ((a1[2][2] ? a1[1][2] : 4) && (a1[0][10] == 46)) : ((39 < 26) % 6));
+                    i11 = i11 + 1;
+                } while (i11 < 6);
+            }
+            v3 = (((a0[3] != v2) % 8) < ((i10 < v0) <= (i10 / 5)));
+            a0[13] = (((i10 || v0) / 1) < ((v3 / 4) + (v1 + a0[1])));
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 5; i12 = i12 + 1) {
+        for (int i13 = 0; i13 < 5; i13 = i13 + 1) {
+            if ((a1[2][4] > i13) > 55) break;
+            a1[1][4] = (((v1 && 37) <= (a1[1][1] != a0[9])) > ((a0[10] + i13) <= (a1[1][6] == a0[4])));
+            a1[2][7] = (((v0 && a1[1][0]) ? (a1[1][15] % 3) : (v1 ? v3 : i13)) != ((v1 < i13) * (v1 == a0[5])));
+            v1 = (((v0 ? v0 : v1) != (i13 || i13)) + ((3 <= 76) < (93 >= i13)));
+        }
+        v1 = (((v1 - a1[0][14]) && (67 ? a1[1][6] : a0[10])) / 3);
+        v3 = (((v3 ? v0 : i12) * (41 && v2)) <= ((v2 <= a0[3]) ? (a1[3][3] == v0) : (v2 ? 45 : v2)));
+    }
+    v0 = (((v0 == a0[0]) ? (v0 + v2) : (v1 + v2)) % 5);
+    return (((v1 > a1[0][9]) >= (v1 == v1)) && ((49 % 8) - (v1 % 4)));
+}
+int f1() {
+    int v0 = 19;
+    int v1 = 78;
+    int v2 = 50;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((v2 != 41) > 70) break;
+            v3 = (((65 || v2) == (7 != a1[2][3])) && ((9 ? a0[6] : v3) + (97 - v1)));
+            v3 = (((42 - 70) < (v2 ? i0 : i0)) == ((a1[2][13] < 62) <= (72 && i0)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((a0[0] - v1) || (v3 * 59)) != ((v3 / 6) < (37 == v2)));
+                    v0 = (((20 + v2) < (v1 && a1[0][15])) == ((v3 != v2) >= (a1[2][11] - i1)));
+                    v0 = (((30 || a0[10]) || (v0 <= a1[1][1])) && ((a1[0][6] && a1[2][13]) > (99 || v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v1 = (((a1[2][13] + a0[4]) && (94 ? v3 : i2)) / 9);
+        v2 = (((a0[7] < v2) % 5) <= ((v0 + 63) + (v2 * v3)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                a0[15] = (((30 ? v3 : v1) > (a1[2][4] || v1)) ? ((i3 * v0) > (99 % 2)) : ((v0 + a0[0]) / 5));
+                a0[7] = (((a0[11] >= v0) < (i2 % 8)) != ((v0 != i3) ? (v0 <= v3) : (v3 % 8)));
+                a1[2][6] = (((31 ? i2 : i2) < (62 + v1)) <= ((a1[1][6] - i3) ? (57 * a0[4]) : (v3 > v0)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    a1[0][6] = (((88 || v0) == (v2 ? 27 : v1)) - ((a0[7] * a1[1][2]) ? (v0 - 25) : (v3 != v0)));
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v0 = (((a1[1][0] / 4) - (i4 == a0[3])) ? ((v2 > v0) < (v2 / 1)) : ((v3 > a0[9]) || (v3 == v1)));
+                    a0[3] = (((29 < a1[3][5]) <= (v3 * v0)) < ((v0 ? v1 : a0[12]) / 4));
+                    a0[12] = (((a1[1][2] % 1) != (v2 && v0)) / 7);
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((4 < a1[0][7]) / 3) || ((v1 ? v3 : 35) < (v0 <= a1[0][4])));
+            a1[2][15] = (((i4 != i4) <= (a0[7] || v2)) / 3);
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        v3 = (((72 && i6) && (v1 / 3)) < ((83 != v3) == (i6 - a1[0][2])));
+        v2 = (((v0 ? 49 : a0[2]) / 1) != ((5 ? a1[0][12] : v0) && (v1 ? 80 : v0)));
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            v3 = (((a0[10] > 74) ? (a1[2][14] <= 20) : (74 * i7)) > ((v3 > v1) ? (v2 && i6) : (v3 ? v3 : i7)));
+            v2 = (((v0 - i6) < (a0[3] + a1[1][15])) && ((37 == 61) % 5));
+            a0[5] = (((i6 <= i6) / 5) - ((i7 < v2) != (v3 / 7)));
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[0][7] = (((a0[6] || v0) % 9) && ((99 + v0) >= (v3 ? i8 : a0[11])));
+            v1 = (((50 % 9) <= (v3 ? v2 : i8)) != ((a0[15] || a0[15]) * (v1 <= a1[3][5])));
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    v0 = (((v2 <= 70) && (34 + v0)) || ((v0 != v1) || (52 + 0)));
+                    v1 = (((71 ? v2 : i8) != (i8 + i9)) ? ((a0[1] <= 46) ? (a0[3] || 4) : (a1[2][2] % 6)) : ((v1 + v2) > (a1[2][3] > v2)));
+                    a1[3][6] = (((a0[13] * 81) ? (i9 - v1) : (a0[2] && i8)) % 3);
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        a1[1][5] = (((45 >= v1) >= (v3 ? 76 : i10)) ? ((a1[3][7] != a1[0][15]) / 4) : ((a1[0][4] && 47) && (v1 > 75)));
+        v0 = (((77 % 7) && (34 - 30)) ? ((a1[3][14] == v3) - (i10 * v1)) : ((v0 % 4) ? (v2 + v1) : (v0 >= a1[3][13])));
+        {
+            int i11 = 0;
+            do {
+                a1[3][3] = (((15 / 4) || (3 + 90)) ? ((i10 ? i10 : a1[0][1]) ? (a1[3][14] == a1[0][0]) : (i11 ? 7 : 7)) : ((v2 || v3) > (v2 && i11)));
+                a0[5] = (((v2 == v2) % 5) != ((a0[3] - 79) - (15 ? v0 : 61)));
+                a1[1][10] = (((v3 == v2) >= (31 - i10)) != ((i10 * i11) - (a1[0][13] * v1)));
+                i11 = i11 + 1;
+            } while (i11 < 4);
+        }
+    }
+    for (int i12 = 0; i12 < 8; i12 = i12 + 1) {
+        a0[1] = (((v2 - v2) - (v1 > v2)) - ((17 < 35) - (v2 % 6)));
+        for (int i13 = 0; i13 < 2; i13 = i13 + 1) {
+            v1 = (((v2 - 3) * (55 == i13)) * ((a1[3][12] > i12) % 4));
+            v2 = (((a0[14] / 5) ? (v0 > 51) : (i13 <= v1)) && ((v2 ? i12 : a0[0]) >= (i13 - a0[11])));
+            v0 = (((10 + 77) / 1) % 1);
+        }
+        v0 = (((22 || v0) - (v2 ? v3 : v1)) ? ((v3 + i12) < (i12 ? a0[13] : a1[0][8])) : ((83 + 90) + (v2 < a1[0][6])));
+    }
+    {
+        int i14 = 0;
+        while (i14 < 8) {
+            {
+                int i15 = 0;
+                while (i15 < 2) {
+                    a1[2][8] = (((v1 > v2) + (a0[6] < i14)) != ((v2 <= v2) && (43 <= i15)));
+                    v0 = (((v2 + 15) > (v3 != 90)) < ((v2 - a0[13]) < (v3 != v0)));
+                    a0[15] = (((a1[2][10] % 6) - (i14 ? v2 : 3)) ? ((v1 != v2) ? (v0 - i14) : (i14 != v0)) : ((i15 && 54) * (i15 % 9)));
+                    i15 = i15 + 1;
+                }
+            }
+            v1 = (((a0[3] >= 97) - (v3 ? v2 : a1[0][13])) <= ((a0[15] % 1) > (22 || 1)));
+            a0[14] = (((a0[11] / 9) ? (v1 == 89) : (24 * 45)) - ((55 - 13) && (a0[6] ? v0 : 88)));
+            i14 = i14 + 1;
+        }
+    }
+    {
+        int i16 = 0;
+        while (i16 < 6) {
+            v3 = (((v3 != i16) > (a0[4] && v0)) * ((21 % 4) || (v3 == v2)));
+            a1[3][13] = (((v3 > 34) > (a0[3] * a0[14])) == ((v2 ? 83 : v0) * (a1[1][11] / 1)));
+            {
+                int i17 = 0;
+                do {
+                    v1 = (((8 % 4) > (93 ? a0[1] : i16)) && ((v0 && a1[3][5]) != (31 || i16)));
+                    a0[11] = (((a1[2][0] <= i16) > (6 != a1[3][11])) && ((v2 > v0) / 4));
+                    a1[3][12] = (((0 ? v1 : v1) ? (v0 < v3) : (a1[2][1] / 8)) >= ((v2 + a1[1][5]) == (a1[2][7] / 1)));
+                    i17 = i17 + 1;
+                } while (i17 < 6);
+            }
+            i16 = i16 + 1;
+        }
+    }
+    return (((v0 > v3) / 3) % 3);
+}
+int f2() {
+    int v0 = 96;
+    int v1 = 11;
+    int v2 = 20;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[14] == 77) % 4) / 2)) {
+        a1[0][13] = (((v3 < 93) + (81 - 81)) <= ((v0 == a0[0]) * (66 == 47)));
+        v2 = (((v2 <= a0[1]) ? (67 - a1[0][7]) : (v3 <= v1)) ? ((a0[1] <= a1[0][9]) > (0 / 3)) : ((v1 % 4) < (4 - v1)));
+        v2 = (((v0 && v0) == (a1[2][12] <= 6)) <= ((a1[2][7] + 8) % 6));
+    } else {
+        v0 = (((71 / 5) - (v3 + a1[2][0])) ? ((v3 == v1) && (v3 < v0)) : ((v1 < 24) / 2));
+        v3 = (((a0[15] * a1[2][1]) ? (v1 && a1[1][1]) : (v2 % 9)) && ((a0[4] ? 66 : 72) ? (1 ? v3 : a1[3][9]) : (v0 < v3)));
+        v2 = (((a0[7] >= 16) / 6) * ((25 >= v0) <= (80 || v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v3 = (((a0[6] ? a0[12] : 17) >= (40 < v0)) / 2);
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((i0 + v3) != (v2 || a0[3])) > ((36 < v0) == (v0 > i0)));
+                v2 = (((62 - v3) < (55 * v2)) && ((v1 - v1) ? (i0 % 6) : (v0 ? v1 : 49)));
+                v1 = (((i1 % 7) >= (a0[10] - i1)) <= ((v3 != i1) - (i0 % 2)));
+            }
+            v1 = (((a1[3][6] && v1) ? (i0 + a1[0][14]) : (v3 / 8)) ? ((35 - v3) ? (i0 % 9) : (93 <= 0)) : ((v3 % 8) == (a0[2] % 2)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 >= v0) - (a0[1] / 9)) > ((8 || v1) ? (v3 / 2) : (v0 || v1)))) {
+        v2 = (((v3 + v1) >= (56 != v0)) ? ((69 != v3) / 3) : ((29 || v2) <= (61 / 6)));
+        v0 = (((v1 - v0) - (29 < v2)) == ((v0 == v1) + (v1 + v0)));
+        a1[3][2] = (((a1[1][12] == a0[9]) > (v0 - v2)) && ((a1[1][10] < v1) <= (a0[2] >= v2)));
+    } else {
+        v2 = (((a1[2][13] ? a1[0][2] : v1) + (v3 != v1)) && ((a1[1][8] * v3) ? (5 != v2) : (v2 ? v0 : 64)));
+        v3 = (((v3 ? 76 : 96) != (v1 * 38)) == ((v2 && v3) * (v1 * v1)));
+        v3 = (((v1 && v0) != (a0[1] * v1)) && ((44 != v1) - (v1 - v3)));
+    }
+    if ((((v0 ? v1 : 42) / 6) <= ((90 ? 8 : v3) ? (v3 || a0[3]) : (v3 - v0)))) {
+        v0 = (((a0[4] / 4) + (v1 < v0)) > ((5 - v0) * (v1 != 83)));
+        v3 = (((22 + a1[0][10]) - (v0 >= 49)) >= ((v0 < 8) ? (a1[3][0] - v0) : (8 == v1)));
+        a0[2] = (((83 % 8) ? (a1[1][15] ? 91 : a1[2][11]) : (v1 + 71)) + ((v2 || a0[13]) >= (v1 ? v0 : v2)));
+    } else {
+        v2 = (((12 || v3) != (v0 % 3)) % 4);
+        v2 = (((17 > a1[3][8]) <= (35 < v0)) < ((v0 || v3) - (v1 > v3)));
+        a1[1][5] = (((v0 < 17) > (v0 && a1[0][0])) >= ((a1[3][13] + a1[1][9]) >= (v1 < 21)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((a1[2][10] < v2) > 87) break;
+        v1 = (((v1 * v0) || (v2 <= a0[7])) < ((58 < 35) * (19 ? v1 : a0[7])));
+        a0[8] = (((a0[14] || 41) <= (a0[5] % 4)) != ((i2 <= a0[3]) && (v2 <= a1[0][5])));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            if ((v2 > a0[6]) > 62) break;
+            a1[0][9] = (((v3 - 73) != (3 ? v0 : v1)) == ((v3 / 1) >= (58 ? a1[3][2] : i3)));
+            a1[1][1] = (((a1[1][13] == 58) >= (v3 > a0[14])) <= ((a1[3][9] % 9) == (a0[7] / 9)));
+            a1[2][12] = (((v1 * i2) && (23 > v2)) * ((v1 - i2) * (83 - v1)));
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((v1 * v0) % 9) + ((v1 * 55) - (v0 && v1)));
+                    v3 = (((a1[2][3] - 26) >= (v2 * v0)) <= ((a0[7] < v2) > (i5 % 1)));
+                    v0 = (((a0[9] ? v2 : a1[0][5]) ? (21 ? 69 : a1[3][1]) : (v3 || v2)) == ((v2 + a1[3][1]) + (31 >= a1[2][3])));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v3 = (((v0 && v2) / 1) ? ((46 > i4) <= (a1[2][10] / 9)) : ((a1[1][2] ? 57 : a0[0]) / 2));
+            a0[10] = (((v3 != v3) != (92 / 4)) ? ((v3 <= v3) || (v2 > a1[0][3])) : ((23 - v0) != (a0[7] >= 41)));
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((v2 == 48) ? (a1[1][4] == a0[0]) : (v0 > v3)) == ((v0 / 9) >= (11 && 52)));
+    if ((((a0[12] < 55) != (v2 ? 60 : 28)) / 7)) {
+        v1 = (((a0[6] ? a1[1][2] : v1) / 4) < ((31 > v1) == (a1[2][12] == 41)));
+        v3 = (((v3 > v3) >= (84 + v0)) * ((v0 && 46) + (v1 && 61)));
+        a0[3] = (((52 < v2) == (v2 ? a1[2][5] : v1)) && ((54 * v0) >= (a0[9] + v3)));
+    } else {
+        a0[1] = (((v0 ? v3 : a1[0][13]) % 2) - ((94 < 25) ? (a1[0][11] && a0[2]) : (a1[1][12] - a0[13])));
+        v2 = (((v2 % 2) >= (v3 / 2)) > ((v2 > v0) != (a1[0][10] ? v2 : a1[3][4])));
+        a0[7] = (((v0 / 3) != (a1[0][10] && v3)) % 5);
+    }
+    v3 = (((v1 + v2) || (49 + 91)) == ((39 || 98) > (82 > v2)));
+    if ((((v1 >= a0[6]) * (v0 != 37)) < ((v0 > a1[0][10]) != (v3 * v0)))) {
+        a1[3][12] = (((v3 || v2) != (v0 == a1[1][0])) > ((v3 * 33) > (v1 ? v3 : v2)));
+        v2 = (((a0[7] * a0[3]) <= (v1 ? 2 : a1[3][1])) - ((v2 ? v0 : v2) < (v2 * a1[2][6])));
+        a0[5] = (((a0[5] <= 41) - (v1 && v2)) ? ((v3 ? a0[4] : a1[1][5]) * (a0[0] + v3)) : ((a1[2][9] || a0[15]) < (98 == v2)));
+    } else {
+        v0 = (((v3 > 62) <= (98 + v0)) || ((v1 || v2) + (16 == v3)));
+        v1 = (((v1 != v2) <= (a0[8] > v2)) <= ((43 == v3) == (a0[2] ? a0[15] : a1[2][14])));
+        a1[0][15] = (((a0[2] <= 80) <= (v2 == a1[2][6])) + ((v1 + v1) * (v2 + a1[3][9])));
+    }
+    return (((38 < 63) * (v1 > a1[3][9])) && ((33 - v2) - (24 ? v0 : v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
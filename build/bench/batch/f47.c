@@ -0,0 +1,464 @@
+int f0() {
+    int v0 = 28;
+    int v1 = 11;
+    int v2 = 33;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((58 - v2) > (a0[15] % 2)) ? ((v0 < v2) != (v2 * a0[2])) : ((v0 < 41) == (v2 / 5)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v1 = (((v1 != 25) || (v1 % 1)) + ((v1 < v3) || (v0 >= a1[1][12])));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v1 = (((v0 <= 90) - (83 >= v0)) * ((a1[3][14] == i0) + (68 % 8)));
+                a1[3][5] = (((v1 ? a0[11] : i1) / 6) + ((53 ? 62 : 11) || (v2 || 96)));
+                a1[0][11] = (((a0[7] != 35) % 6) > ((v2 <= a0[9]) ? (48 * 75) : (38 ? a1[3][12] : v3)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[2][10] = (((v1 ? v3 : v1) <= (v2 <= v2)) + ((v0 == 69) ? (a0[11] == 53) : (i0 - v3)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a1[2][12] = (((a1[0][7] - v2) ? (a1[1][3] % 9) : (v3 == a0[6])) ? ((a0[4] <= 70) + (41 > a1[3][11])) : ((v3 / 3) > (v2 + v2)));
+        v1 = (((11 == a0[5]) * (a1[2][2] <= v0)) <= ((9 < v3) < (v1 < 50)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a1[2][9] = (((a1[0][13] <= a1[1][11]) == (v0 ? i3 : v2)) <= ((v1 || 71) > (v2 ? v1 : a0[15])));
+            a1[1][5] = (((v0 ? i3 : 9) >= (84 <= v3)) ? ((68 < i2) - (33 != 94)) : ((19 % 2) + (a1[0][14] / 3)));
+            v1 = (((a1[2][5] ? i3 : i2) + (v2 <= a1[3][7])) || ((v0 >= a1[2][12]) <= (v1 % 9)));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a1[0][13] - a0[9]) ? (v3 <= a1[3][15]) : (v2 <= 58)) < ((v0 / 9) + (a0[9] ? v0 : v3)));
+            {
+                int i5 = 0;
+                do {
+                    a1[1][12] = (((i4 % 2) / 2) || ((38 != v3) > (8 / 6)));
+                    v1 = (((2 % 1) > (v1 * v2)) ? ((v1 / 5) + (v3 <= v3)) : ((66 <= a1[3][14]) % 2));
+                    v0 = (((a0[13] && 1) <= (58 / 5)) < ((v0 <= i5) ? (i5 || 33) : (i5 / 6)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v3 = (((v1 <= v2) <= (v0 > a1[0][6])) && ((78 >= v1) / 6));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v3 = (((a1[1][15] > 71) % 9) > ((a1[3][0] * v2) ? (v2 + v2) : (v0 == a0[9])));
+    {
+        int i6 = 0;
+        do {
+            if ((v0 > v0) > 70) break;
+            v0 = (((i6 - 36) > (v3 * v2)) + ((v2 <= a1[3][9]) - (v1 && v0)));
+            v3 = (((v1 % 6) / 6) <= ((a1[0][7] ? a0[6] : 73) * (18 > v0)));
+            {
+                int i7 = 0;
+                do {
+                    if ((61 != i6) > 92) break;
+                    v2 = (((v0 % 5) || (63 ? v0 : a1[0][12])) - ((v1 || a0[0]) ? (97 && v0) : (a0[5] < 0)));
+                    v1 = (((98 < 32) / 9) < ((91 ? v1 : 46) >= (65 == i7)));
+                    v1 = (((i7 || v2) == (v1 <= v0)) ? ((a1[0][12] == v1) % 7) : ((v1 ? a1[1][7] : i7) >= (46 == i7)));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    if ((((v3 + a0[4]) / 7) != ((5 ? v3 : v2) && (97 && v1)))) {
+        v0 = (((48 || v2) + (a0[8] >= v2)) / 7);
+        v0 = (((v2 == v2) && (v1 + 32)) - ((v2 - v3) % 8));
+        v1 = (((v2 / 7) > (v0 <= v1)) * ((54 + 26) <= (87 < a1[3][7])));
+    } else {
+        v2 = (((89 - a0[3]) ? (v3 - a0[11]) : (28 <= v3)) - ((a1[1][15] == a1[2][0]) >= (52 == 4)));
+        v0 = (((a1[1][8] || a1[2][0]) != (v3 >= a1[1][7])) / 9);
+        v1 = (((a1[3][5] ? a0[11] : v0) + (v1 ? 57 : 1)) * ((v3 || 42) ? (a0[0] || 41) : (a0[3] / 4)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 5) {
+            a1[2][8] = (((85 + v1) * (v1 * 54)) && ((v1 <= v1) / 5));
+            a1[2][11] = (((i8 < v2) && (21 + v3)) == ((a0[12] >= v3) + (a1[3][15] == 31)));
+            {
+                int i9 = 0;
+                do {
+                    a1[3][5] = (((v2 % 1) <= (a0[0] == v0)) ? ((v1 > v0) <= (5 >= a0[14])) : ((6 % 3) != (a1[0][11] && 92)));
+                    a1[2][13] = (((v2 || a1[1][9]) / 7) <= ((i8 * i8) < (i8 <= 77)));
+                    a1[0][6] = (((v2 >= v2) != (v1 == a0[9])) != ((a1[0][11] + v0) || (v1 * a1[3][13])));
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    v2 = (((a1[0][10] / 9) || (v3 % 1)) > ((a0[8] && 1) || (a1[1][12] + 55)));
+    {
+        int i10 = 0;
+        do {
+            v3 = (((i10 == v1) == (v2 != i10)) != ((v1 / 3) >= (v2 >= 96)));
+            v1 = (((a0[12] ? 69 : v2) * (a0[2] && 55)) != ((a0[5] ? v2 : v0) >= (v1 * a0[11])));
+            {
+                int i11 = 0;
+                while (i11 < 2) {
+                    if ((v2 * a0[15]) > 93) break;
+                    v2 = (((i11 == v0) >= (a0[7] % 8)) * ((i10 <= 6) ? (v2 != a0[6]) : (a0[6] + a1[1][9])));
+                    v2 = (((a0[13] + v0) >= (v1 ? a1[2][12] : v3)) != ((a1[0][1] < v2) - (i10 - a1[0][1])));
+                    v1 = (((v2 <= v0) % 6) ? ((i10 * i11) >= (v3 && v0)) : ((87 <= v2) + (v3 * v2)));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        } while (i10 < 8);
+    }
+    return (((74 && 18) * (v0 + v0)) / 3);
+}
+int f1() {
+    int v0 = 74;
+    int v1 = 15;
+    int v2 = 38;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v2 = (((a1[2][5] - v0) ? (v3 == a1[1][13]) : (v2 ? a1[2][11] : a1[0][14])) > ((29 % 9) >= (v1 / 3)));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a1[3][14] + v0) * (i1 >= 61)) != ((v2 ? v0 : v1) ? (v1 < 18) : (v2 == v0)));
+                v0 = (((a0[9] * 59) > (a0[15] ? 1 : v3)) && ((15 >= v1) >= (a0[14] <= i0)));
+                v1 = (((v2 >= i1) > (66 != i1)) >= ((89 - v3) != (6 > v1)));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v2 = (((i0 == i0) - (49 + v3)) >= ((v0 / 9) + (v3 == a0[8])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((v3 ? 28 : 78) > 99) break;
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((i3 - v2) - (76 + v1)) * ((v3 == 46) < (a1[1][2] % 2)));
+                    a1[0][2] = (((a0[11] + 52) + (v0 >= a0[11])) + ((a0[10] != i2) - (a1[2][5] != 18)));
+                    a0[9] = (((v1 / 5) * (v3 - i2)) && ((v1 ? a1[0][10] : v2) ? (v0 && v2) : (14 ? a0[7] : 72)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a1[0][9] = (((76 >= v2) + (67 ? v3 : a0[11])) ? ((71 > v3) / 8) : ((v2 != v1) <= (31 % 5)));
+            v3 = (((a1[2][9] || v0) ? (9 ? 86 : 97) : (a0[5] % 2)) / 8);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v3 = (((79 && a0[14]) < (63 / 4)) * ((97 / 3) - (a1[0][8] * v2)));
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                v0 = (((62 ? v1 : 41) == (v3 && v1)) >= ((a0[5] || a0[13]) == (a1[0][5] ? a0[12] : v1)));
+                v2 = (((a0[9] + v0) % 3) <= ((9 ? 26 : v2) > (a0[15] ? v1 : i5)));
+                v2 = (((a1[2][15] >= a0[4]) >= (88 + a1[3][7])) != ((i4 % 4) % 3));
+                i5 = i5 + 1;
+            }
+        }
+        v0 = (((v2 - v1) + (v2 + i4)) || ((i4 != a1[0][11]) % 1));
+    }
+    if ((((a1[3][15] * a0[5]) <= (v2 || v2)) > ((a1[3][1] ? a1[3][10] : 48) != (14 / 5)))) {
+        v1 = (((v1 / 7) ? (58 ? 15 : 20) : (v3 >= 60)) < ((a1[2][0] > a0[11]) > (v3 || a0[8])));
+        a0[12] = (((a0[5] >= a1[2][6]) * (v2 - v1)) <= ((v0 % 7) <= (v3 && 55)));
+        v3 = (((v2 ? 77 : a1[3][2]) ? (a0[9] <= v3) : (a1[2][6] <= v2)) <= ((a0[7] - a0[15]) >= (v1 < a1[1][11])));
+    } else {
+        a1[2][1] = (((v3 && a0[8]) / 8) || ((v3 == 8) || (24 && v3)));
+        a1[0][9] = (((a1[2][4] < v2) ? (v1 ? v3 : v3) : (38 <= a1[2][12])) && ((v2 ? v0 : v3) * (v3 % 8)));
+        v2 = (((41 <= v2) + (21 <= v1)) == ((v2 ? 85 : v3) ? (v2 % 6) : (83 >= v1)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        if ((a1[2][9] < 11) > 68) break;
+        v1 = (((v2 > i6) + (v0 < i6)) * ((i6 % 4) % 9));
+        v3 = (((42 != v3) ? (a0[3] != i6) : (a1[3][9] == 11)) + ((v3 != a1[1][0]) + (54 > 33)));
+        {
+            int i7 = 0;
+            do {
+                v0 = (((v0 != a1[3][8]) == (i7 < v2)) <= ((88 / 3) == (a1[3][2] ? a0[7] : 86)));
+                a0[3] = (((v3 + v1) && (41 > v1)) >= ((a0[2] && a0[3]) ? (v2 + 4) : (v2 != v0)));
+                a0[7] = (((13 == i7) > (22 * a1[2][12])) * ((i7 * v0) ? (76 && 32) : (50 * a1[3][6])));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            if ((67 > v2) > 58) break;
+            a1[3][7] = (((a0[12] % 1) < (a1[3][0] ? v0 : a1[2][1])) ? ((a1[2][2] ? v0 : i8) ? (a1[3][10] * v1) : (v0 <= a0[3])) : ((v3 && 78) >= (v2 * v0)));
+            v1 = (((85 > v2) && (v2 < 74)) < ((i8 || i8) > (a1[3][7] != 86)));
+            for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+                if ((v2 != v1) > 91) break;
+                v0 = (((76 == 15) && (v1 < v2)) == ((a0[3] < v0) > (v0 ? 33 : 91)));
+                v2 = (((i9 <= 94) * (a0[0] <= a1[0][10])) < ((i9 && v1) || (i8 || v3)));
+                v2 = (((v0 + a1[1][2]) != (a1[1][10] - v1)) + ((a1[1][5] > v1) ? (v0 < v0) : (v3 < 40)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        do {
+            {
+                int i11 = 0;
+                while (i11 < 6) {
+                    if ((41 ? v3 : a0[13]) > 78) break;
+                    a0[13] = (((a0[14] ? a0[1] : a0[2]) <= (v1 <= i10)) != ((v2 >= a0[8]) >= (v0 <= i10)));
+                    v1 = (((v2 > v0) && (a0[5] == a1[3][12])) == ((76 + a1[3][7]) + (i10 ? a1[0][7] : v2)));
+                    v2 = (((v1 >= v0) && (i10 > i10)) - ((i11 && v0) || (a0[10] <= a1[1][5])));
+                    i11 = i11 + 1;
+                }
+            }
+            v1 = (((v3 + a0[9]) < (a0[3] > a0[11])) ? ((i10 >= a1[0][3]) <= (v3 - v3)) : ((20 >= v2) + (i10 >= 25)));
+            v3 = (((19 > v1) ? (a0[8] || 85) : (i10 != 34)) ? ((i10 / 4) / 8) : ((v3 == i10) < (80 ? 91 : 33)));
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    if ((((12 / 7) % 9) != ((a1[1][9] >= v0) % 1))) {
+        a1[3][15] = (((v0 - 81) ? (v2 >= a1[1][2]) : (a1[3][11] <= a0[12])) % 4);
+        a1[3][15] = (((v1 == v2) * (v3 - v2)) && ((a1[3][0] + v1) ? (a0[4] >= v3) : (a1[2][4] + v2)));
+        a1[2][14] = (((a0[4] ? v0 : v0) == (v3 * 95)) >= ((v1 < v2) > (96 ? v2 : a0[4])));
+    } else {
+        a1[3][2] = (((a0[7] == a1[3][7]) >= (v1 < v2)) > ((v1 - v1) || (v0 || v0)));
+        v1 = (((v1 >= v0) <= (a1[1][3] - v3)) ? ((a0[6] ? a0[1] : a1[1][12]) - (v3 > 76)) : ((27 >= a0[5]) <= (v2 != v0)));
+        v0 = (((v0 && v3) && (64 > a0[12])) == ((a1[3][3] < 58) == (a1[3][12] / 3)));
+    }
+    if ((((77 - a1[1][2]) || (v3 >= a1[3][12])) > ((a1[0][11] - v0) != (v1 - v1)))) {
+        v2 = (((v3 % 9) ? (19 ? v0 : v0) : (a1[3][14] + v1)) > ((a0[3] != v3) >= (a0[12] && v2)));
+        v0 = (((v2 / 7) != (51 == v3)) >= ((a0[8] ? a0[11] : a1[0][14]) || (47 && a0[2])));
+        a0[15] = (((v1 <= 42) % 2) ? ((v0 % 9) > (v2 - 26)) : ((58 != v1) <= (a0[10] == 70)));
+    } else {
+        v2 = (((a1[1][9] > v3) - (a0[4] + v1)) >= ((73 >= v3) && (v2 > v0)));
+        v1 = (((v2 - v0) == (88 >= v3)) > ((v2 < a0[15]) != (a0[2] % 3)));
+        v0 = (((42 + a1[3][10]) % 2) || ((a1[3][0] < v1) >= (a1[2][4] % 8)));
+    }
+    if ((((v3 % 7) >= (v1 ? a1[1][2] : v2)) != ((v0 != 5) ? (83 ? a0[0] : v0) : (v2 + a1[1][1])))) {
+        v0 = (((a1[1][9] >= 27) % 6) > ((v3 || v3) * (v1 == a0[12])));
+        v1 = (((v3 - v2) ? (v3 > v0) : (v2 || v3)) != ((v1 / 1) == (v1 <= 65)));
+        v3 = (((a0[11] + v2) ? (v3 < v1) : (v0 > 84)) <= ((v2 * v1) / 5));
+    } else {
+        v1 = (((v1 ? a1[3][9] : 74) >= (v1 ? 31 : v3)) ? ((v2 * v3) ? (43 != v1) : (v1 != a1[2][4])) : ((v2 > v2) ? (v1 || a1[3][0]) : (v0 && a1[0][8])));
+        a1[3][13] = (((v0 % 1) ? (a0[3] - 71) : (v2 != v0)) < ((v0 - v2) != (61 <= a0[12])));
+        a1[0][8] = (((v0 - v1) >= (59 < a1[2][10])) + ((28 * a1[1][0]) * (v2 != 6)));
+    }
+    return (((v3 > a1[1][5]) || (v3 <= v2)) / 7);
+}
+int f2() {
+    int v0 = 7;
+    int v1 = 30;
+    int v2 = 92;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 > v3) ? (a0[15] + a1[3][7]) : (a1[2][3] ? v3 : v1)) || ((a0[15] || v3) ? (a1[2][13] == a1[2][1]) : (81 != 25)));
+    if ((((v1 > v1) >= (v0 / 5)) || ((v1 % 2) % 2))) {
+        a0[10] = (((a1[2][12] - v1) == (v0 && 88)) || ((a0[14] != v0) <= (v2 || 13)));
+        a1[1][13] = (((a1[1][0] / 7) / 4) / 1);
+        v0 = (((v2 < v0) - (v3 - v2)) / 6);
+    } else {
+        v0 = (((v3 * v2) + (a0[1] == 80)) * ((a0[5] < a1[2][2]) - (v3 > 56)));
+        v2 = (((v0 ? v1 : a0[11]) > (v3 * v3)) ? ((a1[0][5] / 6) || (v3 == v3)) : ((97 || v1) != (52 - v2)));
+        a0[0] = (((v0 && v3) > (v3 / 1)) == ((a1[0][9] != v3) / 9));
+    }
+    if ((((v1 || 30) ? (a1[0][5] ? 49 : v0) : (a1[2][2] == v1)) >= ((93 - v3) >= (a1[2][11] < v0)))) {
+        v0 = (((v1 >= a1[1][12]) == (v0 >= 74)) || ((v1 != v3) ? (v1 || a0[15]) : (v1 < v2)));
+        v2 = (((15 / 5) / 4) - ((61 * a0[8]) == (v1 % 2)));
+        v1 = (((v1 / 9) > (a0[5] || a0[10])) == ((a0[13] != a1[0][14]) && (a1[0][8] ? v1 : a0[0])));
+    } else {
+        a0[11] = (((a1[0][5] <= a1[2][8]) <= (v2 * v1)) < ((v0 && v2) - (v1 < 88)));
+        v1 = (((a0[4] <= v2) ? (a1[1][8] > a0[11]) : (78 <= v2)) + ((a0[2] ? v3 : 98) + (v0 + v0)));
+        a1[0][10] = (((75 == a0[15]) != (v1 / 8)) ? ((v1 * a0[11]) < (v2 >= v0)) : ((v0 == 28) < (a0[0] >= v1)));
+    }
+    v3 = (((a0[15] || 7) && (a0[4] * v0)) > ((a0[1] && v0) < (12 % 4)));
+    if ((((v3 || a1[0][13]) ? (a0[7] >= 27) : (a1[2][13] || a0[2])) <= ((50 == v2) + (v2 || a1[1][9])))) {
+        v1 = (((a0[5] ? v1 : a1[1][5]) && (v3 >= v3)) >= ((v2 < v2) <= (v0 ? 38 : v3)));
+        v1 = (((v0 == v2) <= (12 - a0[7])) <= ((v2 == 21) ? (45 ? 72 : v2) : (69 > v3)));
+        a1[2][2] = (((v1 * v2) || (v2 != a0[14])) < ((45 >= v2) && (v2 ? v3 : 11)));
+    } else {
+        v0 = (((v2 - 53) - (v1 * a0[6])) % 4);
+        a0[4] = (((v0 + a0[9]) == (v3 > a1[3][0])) + ((v0 > v2) > (v0 == 26)));
+        v1 = (((98 || 42) / 7) > ((v1 != v3) / 4));
+    }
+    if ((((v3 == 72) + (v2 - 45)) == ((v1 < v3) || (v1 ? v1 : a0[12])))) {
+        v2 = (((v2 ? v1 : 41) + (v0 % 2)) > ((9 != v0) * (v0 > v1)));
+        v0 = (((v1 > v1) || (v1 != 11)) < ((v1 * v3) && (38 != v2)));
+        v0 = (((a1[1][8] > 50) || (a1[2][5] && v1)) && ((a1[1][9] != a0[5]) ? (v1 > a1[0][3]) : (a1[2][4] == v2)));
+    } else {
+        a1[1][11] = (((a1[3][12] * v0) && (v0 > v0)) ? ((v3 / 9) ? (v0 <= v0) : (a1[2][3] <= a0[5])) : ((v2 * 21) == (v3 ? v1 : v2)));
+        a1[3][5] = (((v3 + a0[6]) > (v3 - v0)) != ((v0 || v3) / 6));
+        a0[9] = (((v2 == v3) - (v1 > v0)) != ((v2 || 64) && (a1[2][11] ? v2 : v0)));
+    }
+    if ((((51 * 55) < (v2 + v3)) <= ((a1[1][15] > 14) > (v3 < v1)))) {
+        v2 = (((a1[3][5] ? v0 : v0) || (a0[8] / 1)) == ((v0 && 31) ? (72 == v3) : (a1[0][11] > a0[8])));
+        a1[0][5] = (((a0[13] > 56) ? (a1[3][5] <= v1) : (v3 - 37)) - ((89 != v1) % 9));
+        v3 = (((v3 % 3) || (a1[3][8] != v1)) || ((31 >= v2) / 6));
+    } else {
+        a0[15] = (((65 - v2) != (v3 - 52)) * ((v3 >= v3) ? (v3 == a1[1][5]) : (v0 >= a1[2][5])));
+        v3 = (((a1[3][7] < 27) != (74 + v0)) == ((v3 >= 60) >= (a1[3][4] * a0[14])));
+        v1 = (((15 % 6) == (39 ? a1[3][12] : v1)) - ((v2 - v2) != (69 * 83)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v0 <= 80) >= (v3 > a0[15])) || ((54 - 68) || (a0[3] != 43)));
+            a1[1][8] = (((v3 - a0[6]) <= (v0 - v2)) < ((a1[2][2] - 89) ? (40 + a0[14]) : (v1 - a1[3][10])));
+            {
+                int i1 = 0;
+                do {
+                    if ((i0 / 4) > 81) break;
+                    v3 = (((v1 != a0[1]) * (v3 ? 56 : v3)) <= ((a1[2][5] + v2) + (i1 % 6)));
+                    a1[1][13] = (((8 - v0) > (v2 + a1[3][2])) % 2);
+                    v3 = (((46 - v3) != (v0 < v2)) == ((a1[1][5] && a1[3][13]) ? (a1[0][8] == a1[0][7]) : (a0[9] || v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[1][13] + v2) > 50) break;
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((v0 && 71) > 60) break;
+                    v2 = (((a1[1][15] > a0[6]) >= (32 + v2)) < ((v0 && 45) / 1));
+                    v1 = (((v1 || a1[1][6]) * (a0[1] > 72)) - ((v1 && v1) % 4));
+                    v2 = (((i3 >= 21) && (v1 || v0)) * ((v3 - a0[1]) == (v2 <= v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((i2 ? i2 : 6) || (a0[10] ? v2 : v2)) / 1);
+            a1[2][9] = (((a0[4] - v2) || (46 - v1)) ? ((a0[4] && v3) / 9) : ((73 >= v1) < (v0 / 6)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((i4 || 82) > 98) break;
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v1 = (((v3 < 14) % 3) - ((i4 + a1[2][7]) >= (v2 || a0[7])));
+            v3 = (((v0 <= 81) + (i4 - a0[2])) ? ((v1 ? 81 : 56) - (i5 / 6)) : ((v3 || 46) >= (a0[2] + i5)));
+            v2 = (((v3 % 8) * (a0[5] / 6)) ? ((v0 != v1) % 5) : ((i5 - v0) / 2));
+        }
+        a0[0] = (((v3 || a1[2][8]) ? (v0 ? a0[7] : 70) : (i4 + i4)) ? ((a1[0][2] <= 58) - (v2 || 2)) : ((a1[1][9] < v0) * (v0 / 9)));
+        v3 = (((i4 == i4) / 8) ? ((49 >= 28) ? (v2 == a1[3][10]) : (v1 != 63)) : ((i4 % 7) == (v0 % 8)));
+    }
+    return (((74 % 5) % 5) ? ((42 >= 99) * (99 < a0[15])) : ((v2 || v3) && (10 < v0)));
+}
+int f3() {
+    int v0 = 19;
+    int v1 = 42;
+    int v2 = 68;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 % 6) && (v3 * a1[3][3])) - ((v1 * 93) <= (a1[2][8] / 7)));
+    {
+        int i0 = 0;
+        do {
+            v2 = (((9 > v0) == (a0[0] * a0[12])) >= ((v0 - v3) ? (v0 > v0) : (i0 >= a0[9])));
+            v1 = (((a1[3][2] ? 12 : a1[3][6]) ? (v2 % 8) : (v2 <= v0)) * ((v3 / 8) == (v3 > 3)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v1 = (((a1[0][6] >= i1) ? (a0[2] ? v0 : v2) : (a0[8] || i1)) || ((v0 && v0) - (a1[0][11] ? 74 : a1[0][12])));
+                v3 = (((a0[15] != 10) <= (a1[2][3] || a1[3][10])) >= ((v0 && 24) + (94 || v1)));
+                v3 = (((a0[7] >= a0[0]) * (86 != v1)) > ((26 > 33) != (v3 < v0)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((a0[6] <= 12) >= (a1[2][0] + a0[13])) != ((a0[7] - v3) < (v2 == 83)))) {
+        a1[2][0] = (((a1[3][7] && v3) / 8) != ((a0[1] == a1[2][2]) || (a1[3][1] + a1[2][12])));
+        v0 = (((a0[7] > v3) - (v2 * a0[10])) / 2);
+        v2 = (((11 < v2) == (61 || v3)) || ((v2 || a0[13]) + (v1 ? 29 : a1[0][2])));
+    } else {
+        v1 = (((a1[2][15] / 1) ? (8 <= a1[1][1]) : (v3 ? 53 : v2)) % 6);
+        a0[2] = (((v2 <= 15) >= (v2 - v1)) != ((a1[0][15] || v0) % 6));
+        v1 = (((a0[7] > 26) && (v3 % 3)) > ((v2 ? a0[3] : a1[2][13]) * (24 ? a0[2] : v1)));
+    }
+    if ((((65 < a0[7]) && (v2 == v0)) * ((a1[1][14] ? 90 : v1) ? (a0[7] != v3) : (v3 * v2)))) {
+        v1 = (((22 != 52) < (v2 / 2)) / 5);
+        a1[2][5] = (((a1[1][9] || 5) * (a0[5] == v2)) * ((v2 ? v2 : v0) != (95 && a1[3][13])));
+        v3 = (((v2 <= v1) == (v2 / 7)) == ((v0 || v0) != (16 <= 81)));
+    } else {
+        v3 = (((a0[9] > 19) ? (37 && a1[3][14]) : (v1 - 91)) > ((a0[5] * 91) ? (a1[2][3] > v3) : (31 * 33)));
+        a0[5] = (((v3 >= v0) ? (a1[3][1] ? v0 : 1) : (a1[2][4] ? 42 : v2)) || ((94 >= a0[13]) <= (v1 >= 37)));
+        v0 = (((57 * 30) && (v2 && a1[1][10])) == ((a0[4] * 15) == (v1 > 77)));
+    }
+    if ((((60 < v0) == (72 && v0)) == ((a0[8] < v1) || (v3 >= v1)))) {
+        v1 = (((a1[2][3] && a0[5]) < (93 - v0)) / 1);
+        v1 = (((14 - v3) || (v2 && 74)) <= ((a1[3][5] < 69) || (v3 - v1)));
+        a0[6] = (((v3 / 8) * (v0 != v1)) || ((v1 < v0) + (65 + 30)));
+    } else {
+        v3 = (((a0[5] + a0[13]) || (v3 || v1)) ? ((93 > v1) >= (13 / 4)) : ((v2 < v1) * (61 - v2)));
+        v2 = (((93 <= a0[10]) || (v2 == a1[0][15])) < ((v2 - v3) < (v0 / 2)));
+        a1[1][5] = (((a1[1][15] && 42) - (v0 == v2)) && ((v1 || 15) != (a1[1][5] >= v2)));
+    }
+    if ((((74 * a1[3][8]) && (39 <= v1)) ? ((v3 && 20) >= (35 % 2)) : ((v1 - a0[0]) ? (v2 < 45) : (v0 <= v3)))) {
+        a0[0] = (((v2 <= v1) == (v2 ? v1 : a1[3][9])) - ((82 % 4) / 4));
+        v0 = (((37 + v0) / 5) != ((74 == v1) + (a0[13] / 2)));
+        v1 = (((8 < a1[1][14]) ? (a0[7] != 69) : (v2 - a1[0][14])) < ((v0 > a1[1][12]) ? (a0[14] ? v1 : v3) : (v2 - 62)));
+    } else {
+        v1 = (((a0[10] > 19) * (v3 > a0[10])) + ((v1 - 25) / 8));
+        v3 = (((v3 <= v2) % 5) == ((v2 != a1[3][4]) && (v0 - a1[1][0])));
+        v1 = (((44 <= v0) % 2) ? ((v2 / 3) ? (v2 || 65) : (v0 || 42)) : ((v3 % 7) == (v2 ? v0 : v2)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a1[0][6] = (((v0 || a1[0][9]) / 4) * ((v0 - 90) ? (85 * v3) : (a0[1] * v0)));
+                v1 = (((a1[3][11] ? a1[2][1] : a1[2][1]) >= (a0[9] < a1[0][0])) > ((87 * i2) <= (a1[3][8] ? a1[2][6] : i3)));
+                v1 = (((a0[13] >= i3) ? (v0 >= i2) : (63 / 8)) ? ((v0 == v0) * (68 <= 51)) : ((a0[6] * v3) >= (i3 > v1)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v1 = (((a0[9] * a1[1][7]) ? (a1[0][12] * i2) : (v3 / 4)) * ((i2 ? v3 : v0) || (v3 && 69)));
+        v1 = (((v1 / 8) < (a0[7] == a1[2][6])) >= ((38 * v1) % 7));
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v3 = (((i5 && 20) != (v1 < a1[1][8])) * ((30 ? 38 : i5) + (58 * a0[13])));
+                v2 = (((a0[7] / 4) + (a1[0][3] && 44)) ? ((a1[1][3] >= a0[6]) > (a1[3][2] > a0[12])) : ((v2 ? 63 : a1[2][7]) / 3));
+                v0 = (((i5 / 4) - (v0 - a1[1][13])) || ((v2 < 89) == (a0[9] && v3)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        a1[2][14] = (((i4 < v3) - (18 % 2)) > ((v1 * i4) < (a0[6] <= v3)));
+        v1 = (((i4 - 1) / 8) && ((v3 * a1[0][10]) % 1));
+    }
+    if ((((v2 || 6) ? (v0 * v3) : (v3 / 2)) % 3)) {
+        a1[0][14] = (((v3 - v1) && (a1[1][14] + a0[5])) != ((a1[1][6] % 8) / 7));
+        v3 = (((v0 >= v1) * (v2 - a0[11])) + ((a0[2] / 5) <= (v1 * v2)));
+        v2 = (((v2 != v0) <= (10 ? v1 : v2)) + ((v3 >= a0[11]) + (v0 ? v0 : 73)));
+    } else {
+        v1 = (((89 <= v1) - (v2 + 22)) - ((v3 <= v2) + (a0[0] ? a0[15] : v2)));
+        v3 = (((a0[13] / 1) == (72 % 9)) + ((a0[12] + 50) != (a0[7] < v1)));
+        v0 = (((a1[0][9] / 8) >= (a0[9] * v3)) ? ((v2 ? v2 : v3) <= (v2 ? v0 : 60)) : ((v1 || v1) * (v0 >= v0)));
+    }
+    if ((((a1[3][8] % 4) || (57 / 3)) != ((a0[5] < 59) % 5))) {
+        v1 = (((a1[0][12] < v2) % 2) % 7);
+        v3 = (((a0[8] * v3) != (a0[12] <= v2)) > ((13 ? v2 : 83) + (v2 && a0[5])));
+        v2 = (((v2 + a0[11]) > (1 ? v0 : v1)) == ((78 / 8) <= (v0 >= v0)));
+    } else {
+        a1[0][7] = (((v2 < 86) != (v1 >= a1[3][8])) && ((v0 || 21) < (v1 <= v0)));
+        v1 = (((v2 || 71) == (74 ? v2 : 67)) || ((a0[13] - 36) && (v1 >= 2)));
+        v2 = (((a0[6] / 7) < (a1[1][7] <= a1[1][1])) * ((6 <= a0[6]) || (v3 * v0)));
+    }
+    return (((75 ? 17 : v1) >= (a0[14] >= v2)) / 7);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
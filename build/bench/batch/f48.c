@@ -0,0 +1,144 @@
+int f0() {
+    int v0 = 90;
+    int v1 = 13;
+    int v2 = 72;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][12] <= v0) % 8) > ((v3 > v0) > (v0 != 65)))) {
+        a1[1][0] = (((36 >= v3) >= (9 != a0[11])) > ((v0 % 1) / 9));
+        a1[3][9] = (((v3 * v3) == (a1[1][9] > 44)) ? ((v3 % 7) > (a1[2][10] <= v2)) : ((v3 < 37) == (v3 && v2)));
+        v3 = (((v0 ? a0[1] : v1) <= (v1 == 52)) * ((v3 == v2) % 7));
+    } else {
+        v2 = (((v1 ? a0[10] : a1[1][2]) == (v0 ? v3 : v3)) % 4);
+        v3 = (((v2 > 65) >= (v0 <= v3)) - ((a0[0] || v0) > (v0 ? a0[7] : 38)));
+        a0[11] = (((v0 ? a1[0][14] : v0) % 6) / 5);
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((98 == v3) > 94) break;
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((70 ? 51 : a0[2]) ? (v2 ? v3 : v2) : (a0[13] >= a1[0][0])) && ((13 != v1) > (i1 <= a0[15])));
+                    a0[5] = (((v2 - a0[12]) % 4) - ((v1 * 26) ? (v0 ? i0 : 22) : (v1 > v0)));
+                    v3 = (((a0[10] == v2) % 3) / 6);
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v0 = (((v0 <= a0[7]) != (a0[4] ? v3 : 76)) % 1);
+            v1 = (((v3 / 3) + (83 && 22)) * ((v2 / 9) > (v3 % 1)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((a1[3][12] <= 53) / 6) && ((a0[11] == v1) / 3));
+                    v2 = (((v0 == i2) + (v2 && i3)) % 2);
+                    v3 = (((v1 % 5) ? (v3 > 5) : (a1[1][4] * 85)) != ((a0[2] != v2) - (v2 < v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a0[6] = (((v1 / 9) / 6) < ((a0[12] - 6) % 1));
+            v0 = (((v2 * 72) > (33 != v3)) * ((46 - 62) - (v3 % 2)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            if ((a0[4] / 7) > 59) break;
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v1 / 5) || (29 || v1)) >= ((v3 && 95) ? (v0 > v2) : (a1[2][0] != v1)));
+                    v2 = (((i4 + a1[2][12]) ? (i5 > 26) : (83 / 2)) / 1);
+                    v0 = (((a0[10] > a0[15]) + (i5 * v1)) >= ((a0[8] - a1[3][6]) / 4));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            a0[10] = (((v3 + a0[6]) == (a0[1] / 8)) >= ((53 - v0) ? (a1[0][5] || v1) : (i4 != v1)));
+            v0 = (((v2 && 83) == (v1 <= i4)) / 7);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((37 - v0) == (v2 || a1[1][13])) > ((v2 <= a0[1]) >= (v3 >= v2)))) {
+        v3 = (((a1[0][2] != v0) == (v2 || v0)) <= ((v0 / 4) > (v0 > a0[6])));
+        v2 = (((v2 < 62) / 8) - ((v2 != a0[11]) - (v3 % 6)));
+        v3 = (((v3 == v2) >= (v3 && a1[1][10])) < ((a0[6] - v2) == (v3 > v2)));
+    } else {
+        v1 = (((a0[3] > a1[1][7]) <= (a1[1][13] == a1[1][6])) ? ((v0 + v3) ? (a0[2] * v3) : (v1 * 96)) : ((a1[2][4] > v0) <= (v0 && v0)));
+        v3 = (((a0[0] < a1[2][2]) > (66 % 4)) < ((20 != v2) % 7));
+        a0[2] = (((a0[13] ? v3 : v2) + (v2 * a0[15])) != ((a1[3][9] <= 98) <= (77 ? a1[0][14] : 71)));
+    }
+    v3 = (((78 > v1) >= (v3 < 88)) ? ((v0 ? v2 : 61) && (v2 * 26)) : ((a0[3] * a1[2][7]) >= (a1[0][14] >= v2)));
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                if ((i7 / 3) > 68) break;
+                v3 = (((a1[0][6] && 34) % 3) ? ((i6 > a1[0][2]) >= (a1[0][2] >= v1)) : ((67 < i6) - (a1[0][3] == v2)));
+                v1 = (((58 || a1[0][14]) == (a0[11] * 93)) + ((87 < 29) % 9));
+                a1[2][14] = (((i7 - v2) > (v2 / 6)) == ((i7 < i6) + (v2 % 9)));
+                i7 = i7 + 1;
+            } while (i7 < 2);
+        }
+        v0 = (((a0[15] && 72) + (v0 % 6)) == ((v3 ? 21 : a0[13]) ? (a1[1][8] ? a0[14] : v0) : (61 + v2)));
+        v2 = (((i6 != v2) + (86 < 59)) <= ((a0[3] || v3) && (i6 + v0)));
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        v2 = (((v0 ? v0 : v0) == (v2 ? 73 : i8)) > ((8 == a1[1][11]) * (a1[0][7] <= i8)));
+        v1 = (((v1 || a1[2][14]) % 4) - ((a1[2][15] == a0[12]) % 2));
+        {
+            int i9 = 0;
+            do {
+                if ((a0[7] == 44) > 61) break;
+                v0 = (((i9 || 75) + (i9 > v2)) / 4);
+                a1[1][12] = (((8 / 9) + (a0[5] / 9)) < ((24 != i9) / 8));
+                a0[4] = (((v1 * a0[7]) <= (i9 * 11)) <= ((v1 >= a0[3]) <= (7 != a0[2])));
+                i9 = i9 + 1;
+            } while (i9 < 3);
+        }
+    }
+    {
+        int i10 = 0;
+        do {
+            v0 = (((a0[2] && i10) > (40 > v2)) < ((v1 < v3) - (v0 && a0[11])));
+            v2 = (((14 && v3) <= (22 - 97)) != ((v0 * v2) % 9));
+            for (int i11 = 0; i11 < 6; i11 = i11 + 1) {
+                v3 = (((i11 - a0[5]) - (63 / 3)) * ((a0[1] / 6) && (a1[3][10] - 53)));
+                v1 = (((a1[0][5] * i11) + (v3 == v2)) && ((92 > v3) ? (a1[2][3] <= i10) : (93 % 4)));
+                v1 = (((v0 + 70) <= (48 * v1)) < ((a1[1][11] % 2) && (a1[3][15] || v1)));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    {
+        int i12 = 0;
+        do {
+            a0[0] = (((v1 * v0) > (a1[2][7] + a1[2][13])) <= ((v1 > v3) && (v2 < v1)));
+            {
+                int i13 = 0;
+                do {
+                    v2 = (((v2 && 86) && (v3 >= v2)) * ((a1[1][9] + i12) && (v2 ? a0[2] : v3)));
+                    v2 = (((23 > a1[0][14]) > (v2 / 3)) || ((i13 != 62) ? (v2 != 88) : (v2 == a0[4])));
+                    a1[3][14] = (((i13 > a1[3][2]) + (v2 - 40)) ? ((i13 * a0[7]) ? (v2 || v3) : (54 ? v0 : a1[2][7])) : ((a1[0][1] >= v1) <= (a1[1][2] >= a1[0][8])));
+                    i13 = i13 + 1;
+                } while (i13 < 4);
+            }
+            v3 = (((0 % 7) >= (i12 < a0[13])) > ((i12 - a1[1][12]) ? (v3 >= 11) : (a1[0][11] == i12)));
+            i12 = i12 + 1;
+        } while (i12 < 7);
+    }
+    return (((v1 != a0[0]) - (v0 <= v2)) ? ((v2 <= 81) >= (a1[2][1] >= v0)) : ((v3 / 7) ? (a1[2][15] > a1[3][13]) : (42 % 7)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
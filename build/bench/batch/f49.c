@@ -0,0 +1,193 @@
+int f0() {
+    int v0 = 4;
+    int v1 = 8;
+    int v2 = 83;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v0 = (((v3 != v3) < (v0 * 19)) + ((i1 && v3) == (v3 * a1[3][10])));
+                    a1[3][10] = (((v3 ? v2 : i0) && (a0[0] > v2)) == ((63 && i1) && (68 != v0)));
+                    v3 = (((a1[0][11] / 3) == (i1 % 5)) || ((52 * a0[4]) % 5));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v1 ? v3 : v1) ? (v1 || 15) : (v2 != v1)) % 3);
+            v0 = (((a0[8] && i0) && (v2 || a0[3])) * ((v2 && v3) / 7));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[1][14] <= v2) != (v0 != v1)) < ((v1 >= 34) || (v0 ? a0[4] : v3)))) {
+        v1 = (((v3 != 66) * (v0 >= v0)) >= ((17 >= 1) != (47 % 3)));
+        v0 = (((v0 && v0) - (a0[7] * a1[1][12])) >= ((a0[13] >= v2) != (v0 != v2)));
+        v0 = (((13 < 13) ? (14 / 2) : (v0 ? 10 : v1)) + ((v3 > 68) + (v2 && v1)));
+    } else {
+        a1[1][5] = (((50 <= v3) && (42 || 97)) % 1);
+        v2 = (((37 + v3) - (v0 != v3)) * ((v3 < v3) < (v1 - a1[2][2])));
+        a1[0][2] = (((v0 + v1) < (v1 - 4)) * ((v3 % 9) >= (79 ? 79 : v3)));
+    }
+    if ((((a0[13] && v0) == (a0[5] <= v1)) / 7)) {
+        v2 = (((a1[1][10] == v2) > (v3 > a1[2][5])) ? ((1 != a0[9]) == (v0 - a1[0][10])) : ((v3 ? v0 : v2) * (v1 > v2)));
+        v1 = (((v1 >= a1[3][4]) <= (v3 * a0[7])) / 8);
+        a1[3][14] = (((a0[14] && a1[1][12]) ? (78 * v3) : (v0 != v3)) % 3);
+    } else {
+        v2 = (((37 >= 19) >= (v3 - v3)) > ((a1[0][3] ? 86 : 89) + (v1 ? v0 : a0[5])));
+        v2 = (((53 - a1[3][0]) + (a1[0][12] != 14)) - ((59 && v0) / 2));
+        v2 = (((a0[3] - v1) || (a0[4] - a1[3][6])) == ((a0[3] + v2) - (v0 - v3)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((v0 ? v1 : v3) > 61) break;
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a0[12] = (((i2 ? v3 : 82) + (53 - 50)) * ((v3 <= 20) + (44 + 33)));
+            v1 = (((v3 ? v3 : a0[0]) <= (v1 * i2)) ? ((a1[1][1] >= 90) > (66 || i2)) : ((75 + i2) != (a1[1][2] <= 57)));
+            a0[10] = (((v3 >= 64) - (v0 != v0)) ? ((i3 ? a1[3][11] : a0[7]) < (0 < a1[2][12])) : ((v1 + v1) * (v3 ? v2 : i3)));
+        }
+        a0[8] = (((36 || a1[3][10]) + (v0 == 28)) - ((v3 != 24) == (v1 >= v3)));
+        v1 = (((a1[0][15] / 8) + (77 > v2)) >= ((a0[12] || v3) == (a1[2][7] > a1[3][8])));
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v3 = (((v1 > i4) < (v3 != a1[3][8])) * ((v3 + v2) + (a1[1][5] / 7)));
+        v0 = (((v2 == a0[14]) - (v1 + 68)) == ((a1[1][6] < i4) + (65 <= v3)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            if ((5 == v3) > 75) break;
+            v2 = (((v0 != v3) % 7) ? ((a0[1] ? 65 : v3) + (v3 + v3)) : ((v1 < 6) && (96 > v0)));
+            v1 = (((a0[15] - a1[3][4]) ? (i5 + a1[0][4]) : (v2 + v2)) >= ((v1 > v3) < (i5 || 3)));
+            v0 = (((i4 + v3) < (i4 && i5)) && ((a1[0][5] / 1) > (v2 * v2)));
+        }
+    }
+    v3 = (((v1 ? 14 : a0[1]) < (a0[9] || v3)) != ((70 % 1) || (a0[0] || a1[1][7])));
+    v2 = (((v2 != v3) - (v3 && a1[3][9])) / 3);
+    a1[1][13] = (((v0 <= 26) != (a0[6] ? v3 : v3)) && ((59 || a1[0][7]) + (68 > v1)));
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                if ((i7 * v3) > 97) break;
+                v2 = (((15 >= a1[2][5]) % 6) / 6);
+                v0 = (((a1[0][0] % 8) * (a0[4] ? 3 : a1[0][14])) / 7);
+                v0 = (((a0[10] <= 6) - (v2 / 9)) == ((80 > v0) - (v1 <= v3)));
+            }
+            v1 = (((v2 / 9) - (25 + 17)) - ((a0[15] ? 16 : v3) / 3));
+            v1 = (((a0[4] * v0) * (i6 ? v0 : v1)) < ((v0 && v3) + (v2 < v2)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    if ((((74 ? v0 : a1[1][0]) * (a1[1][10] < v0)) ? ((v3 * a0[7]) - (84 * v3)) : ((v0 ? v2 : 21) * (v2 + 88)))) {
+        v1 = (((v0 >= v2) <= (v1 < v0)) % 4);
+        v2 = (((v0 && a1[3][8]) <= (v2 * a0[13])) / 1);
+        v1 = (((v2 - v3) - (v1 && v3)) < ((a1[1][14] <= v2) * (v0 >= 79)));
+    } else {
+        a1[3][2] = (((a0[15] - 24) || (a1[1][3] && a1[1][6])) > ((v0 <= v0) * (v3 == a0[8])));
+        a1[1][10] = (((a1[0][2] < v2) + (83 < v1)) || ((v0 / 9) - (77 != 53)));
+        v1 = (((v3 && a1[0][5]) + (v1 == v1)) || ((97 > v3) && (71 >= v1)));
+    }
+    return (((93 ? 31 : v1) != (v3 ? v1 : v0)) - ((90 % 1) > (v0 + 31)));
+}
+int f1() {
+    int v0 = 82;
+    int v1 = 65;
+    int v2 = 89;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v0 = (((90 ? 34 : v0) == (v0 / 6)) + ((v0 == v2) && (a1[0][5] < v3)));
+        v0 = (((a0[4] != a1[3][15]) - (28 * v0)) || ((v2 % 2) > (70 % 6)));
+        {
+            int i1 = 0;
+            do {
+                if ((i0 != 14) > 96) break;
+                a0[15] = (((v1 || 60) && (96 + 53)) + ((91 ? i1 : v2) && (i0 >= 78)));
+                v0 = (((34 + 80) != (v1 ? a0[4] : v3)) >= ((a0[4] / 2) > (v3 && 40)));
+                v3 = (((a0[2] || i1) ? (i0 >= a1[0][14]) : (77 > v3)) / 2);
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+    }
+    v2 = (((a0[7] <= 51) * (v3 > v3)) > ((v3 ? a0[6] : 82) != (v0 % 9)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((29 >= v0) ? (v2 > 82) : (39 % 3)) ? ((v3 > v2) ? (a0[14] ? v0 : a0[4]) : (v1 <= v0)) : ((6 < a1[0][0]) / 3));
+        a1[1][2] = (((96 % 6) % 3) != ((a0[11] + i2) - (v0 ? v0 : a0[9])));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a1[1][15] = (((i2 != a1[3][15]) - (i3 / 7)) >= ((v3 % 5) == (i3 - v2)));
+            a1[2][0] = (((a1[0][15] || 99) == (a1[0][14] != i2)) && ((10 <= 32) < (i2 >= v0)));
+            a1[2][6] = (((a1[2][7] != 21) != (v1 ? 77 : i3)) / 7);
+        }
+    }
+    v0 = (((a0[12] < v0) ? (a0[8] || 33) : (38 < v3)) > ((v1 * a0[6]) <= (52 * 25)));
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v2 = (((i4 || 75) < (82 / 7)) <= ((i4 < i4) + (v2 < v3)));
+            v0 = (((77 + i4) || (v3 != i4)) || ((v2 - 43) < (a1[2][6] && 50)));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v0 = (((a0[11] + a0[13]) || (v2 > 55)) - ((69 ? 96 : i5) - (v2 && 67)));
+                v1 = (((v2 != i5) && (a0[10] > 82)) ? ((a1[1][0] * 47) != (i4 || i4)) : ((a0[1] != a1[3][1]) / 6));
+                a0[10] = (((v3 && v0) - (32 && a1[1][1])) >= ((v3 != i4) <= (v1 != v2)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v1 = (((v1 >= i6) >= (73 - a1[1][7])) ? ((i7 && a0[4]) * (a0[12] <= a1[1][14])) : ((a0[0] ? a0[14] : 70) < (v3 % 2)));
+                v0 = (((a1[3][1] ? v1 : i6) <= (83 < i6)) * ((a1[3][3] + 43) > (a0[3] * a1[0][9])));
+                v1 = (((i7 * v2) / 5) ? ((a0[6] || v3) == (i7 - 5)) : ((83 % 5) - (v3 != v1)));
+                i7 = i7 + 1;
+            } while (i7 < 2);
+        }
+        a1[3][4] = (((a0[12] ? a0[8] : v0) * (v2 + a1[1][3])) + ((10 > v1) < (56 != v1)));
+        v1 = (((v1 <= v0) ? (v2 < v0) : (a1[1][4] || v2)) * ((a0[0] && a1[3][9]) > (19 >= a0[1])));
+    }
+    if ((((10 / 7) != (v3 / 8)) < ((v0 % 4) && (93 < v3)))) {
+        v1 = (((a1[2][4] ? v1 : v2) % 9) && ((a0[8] - v3) ? (a0[11] > a0[9]) : (71 && 76)));
+        v0 = (((a0[11] >= v2) < (v0 ? 91 : v3)) / 6);
+        v3 = (((v0 ? v0 : a0[14]) == (a0[5] / 6)) + ((v1 || 39) < (a1[3][2] >= a0[7])));
+    } else {
+        a1[3][12] = (((v0 || v2) - (68 <= v3)) <= ((5 + v2) / 5));
+        v2 = (((v2 / 5) == (v0 <= v0)) >= ((v0 ? 63 : v2) % 9));
+        v3 = (((a0[3] ? 89 : v2) != (a0[8] > v0)) > ((v2 > v1) / 3));
+    }
+    v0 = (((v3 && v2) - (v0 % 8)) * ((a0[10] ? a0[4] : v1) - (a1[1][8] % 4)));
+    {
+        int i8 = 0;
+        do {
+            v2 = (((a0[12] + i8) ? (a1[2][13] == a1[0][14]) : (v3 >= v2)) >= ((a0[9] >= i8) ? (v0 ? 56 : 47) : (v0 >= 57)));
+            a1[0][4] = (((55 < a0[11]) <= (v0 <= 24)) + ((94 > 79) * (a0[3] / 4)));
+            {
+                int i9 = 0;
+                do {
+                    if ((v0 != v1) > 61) break;
+                    v1 = (((a0[5] - v0) < (v2 == v3)) > ((i9 - a1[0][9]) + (9 == a0[6])));
+                    a0[5] = (((i8 % 8) / 3) + ((60 == v0) == (v1 == 63)));
+                    a0[13] = (((a1[3][1] || 69) && (24 && 36)) || ((93 || v1) == (i9 + i9)));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    if ((((a1[0][13] != v1) - (77 % 3)) - ((v1 >= v0) / 2))) {
+        v3 = (((v2 + a0[4]) > (v0 == a0[2])) ? ((v2 ? 24 : a0[2]) >= (18 != v0)) : ((v3 <= v0) == (90 * v0)));
+        v1 = (((a1[0][2] < 90) ? (v1 ? 38 : a1[0][1]) : (62 % 1)) ? ((a1[0][10] != 91) - (v0 <= v3)) : ((55 && v3) / 9));
+        v1 = (((a1[1][0] && 52) && (v1 ? v3 : v1)) % 3);
+    } else {
+        a0[7] = (((64 / 5) || (54 > v2)) / 9);
+        v1 = (((a0[11] ? 12 : 9) % 5) / 5);
+        v1 = (((a1[2][3] + 74) <= (v0 + v3)) ? ((v2 >= a0[3]) + (a0[13] == a1[0][4])) : ((a0[15] && v3) <= (88 <= v0)));
+    }
+    return (((v3 || a0[6]) + (v3 ? a1[0][4] : v0)) ? ((v3 * v3) && (v2 ? a1[1][4] : a1[3][8])) : ((v2 / 2) > (v0 ? a1[2][13] : 10)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
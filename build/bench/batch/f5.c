@@ -0,0 +1,257 @@
+int f0() {
+    int v0 = 30;
+    int v1 = 61;
+    int v2 = 3;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    if ((((58 - a1[1][9]) >= (a0[14] != a0[2])) && ((v2 || a0[15]) != (v3 <= a1[0][5])))) {
+        v1 = (((a1[1][5] < v1) ? (98 / 7) : (v3 > v0)) ? ((v2 && v3) || (a0[3] || a1[1][8])) : ((v3 * a0[12]) <= (a0[10] != v0)));
+        a1[2][11] = (((v2 + a0[12]) % 5) ? ((a0[9] || 38) / 1) : ((13 * a1[2][2]) > (74 + a1[2][11])));
+        v0 = (((v0 / 5) / 7) < ((a1[3][5] % 6) / 2));
+    } else {
+        a1[3][10] = (((7 + a1[2][1]) ? (a0[12] * v3) : (v1 ? a0[8] : v0)) % 6);
+        a0[12] = (((v3 * v0) % 8) < ((a1[0][0] == 83) - (51 && v1)));
+        v1 = (((a1[0][8] < v3) * (v0 <= a0[7])) / 4);
+    }
+    {
+        int i0 = 0;
+        do {
+            v3 = (((65 != a0[9]) != (v1 - v1)) + ((v2 % 9) + (6 * a0[0])));
+            a0[15] = (((27 * v0) > (29 <= a0[4])) || ((58 <= 86) - (a0[4] || i0)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((a0[10] || a1[1][12]) * (v2 == 46)) / 5);
+                v1 = (((i0 * a0[8]) != (a1[3][0] != 98)) >= ((v0 || a0[14]) == (54 ? i0 : a0[8])));
+                v3 = (((v3 / 9) <= (v3 == a0[13])) || ((a0[10] ? 11 : a0[3]) || (a0[3] * v1)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((44 <= i2) > 54) break;
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((81 % 9) || (i3 && v1)) - ((a0[5] || a0[7]) < (a0[10] / 8)));
+                v1 = (((v0 != a0[9]) % 7) >= ((v0 * 66) ? (a1[2][11] / 1) : (88 != 63)));
+                v1 = (((a1[0][14] * v3) == (v1 + i3)) % 9);
+            }
+            a0[4] = (((v0 % 6) * (v3 ? v1 : a0[2])) <= ((83 ? a0[8] : v2) >= (i2 < v2)));
+            v3 = (((a0[5] <= 4) ? (59 <= a1[2][5]) : (a0[0] % 5)) < ((a1[2][14] + a1[0][13]) || (a0[13] == v3)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((2 ? v3 : v1) && (a1[0][0] * v2)) >= ((a1[2][5] != a0[1]) == (v1 && v0)))) {
+        a0[14] = (((v2 < v3) / 6) == ((78 % 8) == (v1 == v1)));
+        a1[3][7] = (((v1 % 8) && (a0[3] <= a1[0][12])) == ((99 == v2) >= (v1 && v3)));
+        v2 = (((a0[14] ? a1[3][12] : a1[1][7]) > (v1 == a1[3][10])) / 4);
+    } else {
+        v1 = (((v1 / 6) + (a0[4] / 8)) == ((v0 <= v1) > (52 >= v0)));
+        v2 = (((v3 / 7) / 2) || ((10 > v1) + (2 || v2)));
+        v3 = (((8 >= v3) - (a0[0] * v0)) < ((13 < 93) >= (96 < v0)));
+    }
+    if ((((v2 + a0[13]) == (a1[2][3] >= v2)) && ((a1[0][7] ? a0[3] : v0) * (a0[15] != v1)))) {
+        v1 = (((v1 / 6) / 5) <= ((v3 / 8) >= (v3 ? a1[1][8] : a1[0][8])));
+        a1[2][15] = (((a1[2][7] / 9) - (a1[1][2] == a0[8])) != ((a0[5] == v1) && (a1[3][15] - a0[1])));
+        v3 = (((78 > a1[0][6]) || (a1[2][4] - v2)) ? ((v0 * a0[15]) <= (91 ? 90 : v1)) : ((9 % 1) / 5));
+    } else {
+        v3 = (((23 >= v3) * (73 || v1)) >= ((80 - v0) % 5));
+        a0[10] = (((v3 / 1) / 7) && ((v1 ? v1 : v3) && (v1 <= v2)));
+        v1 = (((v1 == 99) || (v0 > a0[9])) / 8);
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v0 >= v2) && (v3 > v0)) && ((84 % 3) + (63 * a0[13])));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((v0 != a0[3]) <= (v1 % 2)) != ((a0[10] + i4) >= (a1[3][13] && v1)));
+                    v1 = (((a0[8] ? 79 : a1[3][14]) && (44 % 6)) == ((69 || i5) ? (18 + a1[2][11]) : (v0 ? a1[0][5] : i4)));
+                    v0 = (((a0[9] || v2) || (a1[1][11] % 9)) == ((i5 / 6) ? (50 - i4) : (v1 && 87)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v0 = (((a1[3][15] ? a0[5] : 35) > (v2 <= a1[0][5])) % 2);
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    if ((((a0[13] ? v0 : 11) / 8) / 3)) {
+        v1 = (((v1 != a1[3][12]) < (7 <= 23)) != ((51 < v0) <= (44 || 81)));
+        a1[1][6] = (((v0 || v2) - (v2 - v2)) / 7);
+        a1[2][2] = (((21 * v3) % 8) > ((55 + v2) <= (v2 < v1)));
+    } else {
+        v1 = (((v2 <= 87) * (v3 <= v2)) != ((v1 - a1[3][13]) ? (17 / 5) : (v3 ? 96 : a1[3][13])));
+        v2 = (((v0 % 9) && (25 * 3)) || ((v3 != 32) < (v1 % 3)));
+        a1[2][12] = (((v1 - v2) / 3) / 2);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v2 = (((54 < i6) - (i6 || 47)) < ((31 ? a1[1][14] : a0[8]) / 9));
+            a0[1] = (((v2 ? a1[3][15] : 47) ? (v3 > a1[3][11]) : (v2 <= a0[4])) > ((i6 / 7) ? (a0[9] >= 14) : (v0 && a1[0][13])));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    if ((22 - a1[0][8]) > 92) break;
+                    v0 = (((a0[8] + v2) > (v2 % 2)) + ((a0[9] > 96) && (v3 != a1[2][12])));
+                    a0[10] = (((80 || a1[2][11]) < (i6 / 2)) * ((v0 ? v1 : 23) < (a1[0][14] <= 42)));
+                    v2 = (((v2 > a1[1][3]) > (26 > a1[2][2])) > ((71 > v1) + (15 + 28)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a0[10] + a1[2][10]) ? (v2 || 65) : (v0 || 82)) / 1)) {
+        v0 = (((77 == 38) < (v2 % 1)) <= ((v0 % 8) >= (v0 - v3)));
+        a1[3][3] = (((v3 >= v2) % 7) ? ((86 + v2) / 4) : ((v0 && a1[1][15]) ? (a1[2][12] / 3) : (v1 != a1[2][1])));
+        v1 = (((28 >= 4) >= (v1 < a1[1][10])) % 5);
+    } else {
+        v0 = (((a1[0][8] >= 26) < (v3 <= a0[4])) && ((v1 && a0[14]) < (8 > a1[2][4])));
+        v2 = (((84 != a0[14]) - (19 + v1)) != ((v3 == v0) + (a0[4] < v3)));
+        v3 = (((a0[2] + v1) > (v1 + 67)) ? ((v3 % 3) * (a0[13] % 3)) : ((a0[7] ? 39 : 36) ? (v0 >= v0) : (v0 % 9)));
+    }
+    {
+        int i8 = 0;
+        do {
+            v0 = (((v2 >= a1[2][14]) - (a1[1][10] ? v2 : v3)) + ((a1[3][11] % 6) / 2));
+            v3 = (((17 <= i8) > (i8 / 7)) > ((v3 ? v1 : v1) / 8));
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                v0 = (((a1[2][4] + v0) == (a0[9] <= 66)) - ((20 >= a0[14]) * (v2 == a1[3][6])));
+                v3 = (((29 < i9) - (v2 <= v0)) <= ((i8 ? a0[14] : 10) * (v2 - 96)));
+                v1 = (((a1[3][10] / 2) - (i8 && a0[3])) || ((v0 != v2) / 3));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    return (((a0[12] ? 97 : v0) || (a1[2][7] - a1[3][10])) / 4);
+}
+int f1() {
+    int v0 = 1;
+    int v1 = 46;
+    int v2 = 11;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((27 >= a1[3][8]) % 7) < ((22 * 97) / 2));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v1 = (((a1[0][1] ? 57 : a1[3][14]) ? (v3 || a1[2][10]) : (v2 >= a1[3][4])) > ((78 && a0[1]) >= (v3 && v1)));
+            {
+                int i1 = 0;
+                do {
+                    a1[1][12] = (((94 > v1) - (a0[6] ? 6 : a1[1][14])) / 8);
+                    v0 = (((v0 / 2) * (65 ? 9 : v2)) == ((a0[6] && a1[0][7]) || (17 < v3)));
+                    a0[9] = (((v1 || v0) + (i1 ? i0 : 76)) > ((a1[1][3] && i1) < (94 % 7)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a1[3][5] = (((23 && v0) < (a1[1][9] < v1)) * ((v1 && a0[2]) < (a1[1][3] <= i0)));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v2 || v1) == (a1[2][8] != v2)) ? ((v0 == 9) || (a1[1][6] ? v1 : v2)) : ((24 > v3) >= (v1 != a1[0][1])));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((v2 ? a0[5] : a1[0][7]) > 55) break;
+        a0[7] = (((13 && v1) + (37 >= v2)) * ((i2 - v1) >= (a0[2] > v3)));
+        a0[10] = (((v3 * a1[1][13]) - (87 > v3)) + ((a1[0][1] ? v1 : v2) && (i2 <= v1)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            a0[13] = (((a0[8] % 3) != (v1 * i3)) ? ((v3 != 59) != (v2 <= a0[10])) : ((i2 != i2) - (a0[1] <= a1[2][8])));
+            v3 = (((v3 - 20) != (a1[3][4] <= a1[3][4])) <= ((30 && 94) > (v3 != a1[0][11])));
+            a0[8] = (((a0[5] < 29) > (49 ? v0 : a0[7])) >= ((v0 * i3) != (i3 + 14)));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                a0[8] = (((98 % 8) < (a0[1] % 1)) * ((a0[11] >= a0[4]) > (i5 != a1[3][2])));
+                v1 = (((a1[3][7] <= v2) >= (91 || a0[15])) && ((a1[2][8] ? v0 : 88) ? (44 && v3) : (i4 % 7)));
+                a0[6] = (((v0 - v1) ? (a0[8] && 38) : (62 ? 29 : v2)) * ((a0[14] <= 55) != (v0 != 11)));
+            }
+            a0[7] = (((13 - 16) && (i4 ? v1 : 8)) ? ((i4 / 1) - (70 <= 47)) : ((v0 - v3) / 3));
+            v1 = (((v0 * v1) + (a0[13] - a0[14])) >= ((v1 % 3) ? (v1 - a0[1]) : (i4 * a1[3][8])));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            a0[3] = (((72 ? v1 : a1[1][11]) ? (v1 < a1[1][8]) : (v0 && i6)) || ((v2 / 7) != (a0[11] != a0[10])));
+            {
+                int i7 = 0;
+                do {
+                    a1[2][5] = (((a0[11] <= i7) <= (v2 / 7)) - ((72 || 86) - (i7 ? v1 : 67)));
+                    a0[6] = (((20 ? i7 : 65) <= (2 % 4)) ? ((v3 > 88) < (86 ? 22 : v2)) : ((v1 == a0[6]) == (24 - i7)));
+                    v0 = (((30 * v2) ? (i7 == a0[8]) : (44 % 2)) / 4);
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            v2 = (((0 && a0[4]) == (32 || v0)) ? ((i6 <= v1) < (72 ? i6 : a0[5])) : ((a1[0][13] < v3) != (63 % 1)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        v0 = (((v2 < v2) ? (a0[8] && v3) : (a1[3][13] >= 62)) / 7);
+        v1 = (((58 >= 11) < (a1[3][0] != a0[9])) % 2);
+        {
+            int i9 = 0;
+            while (i9 < 6) {
+                if ((a0[2] && a1[2][12]) > 71) break;
+                a0[9] = (((v1 ? a1[2][5] : i8) == (v2 >= i9)) > ((v0 == a0[13]) == (19 && a0[7])));
+                a0[15] = (((25 > v0) > (i8 && v1)) <= ((a0[12] != a0[2]) + (57 || 66)));
+                v2 = (((i9 >= v3) < (14 + i8)) <= ((v1 / 5) % 4));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        a0[15] = (((v0 < i10) ? (v0 ? a0[10] : a0[2]) : (v0 != i10)) < ((73 != 7) ? (v2 * a1[0][15]) : (v0 != a0[10])));
+        {
+            int i11 = 0;
+            do {
+                v3 = (((v2 * v1) && (v2 == v1)) ? ((82 * 52) == (v3 && a1[2][8])) : ((a0[11] % 9) - (60 == a1[3][5])));
+                v3 = (((v3 - 29) * (92 * 47)) > ((v3 ? 29 : a0[10]) >= (a1[0][12] >= 76)));
+                a1[3][13] = (((v1 * 45) * (v3 ? 76 : 87)) < ((a0[1] - v2) || (v3 * v3)));
+                i11 = i11 + 1;
+            } while (i11 < 6);
+        }
+        a0[11] = (((i10 < v2) == (94 > 75)) ? ((38 / 1) % 4) : ((i10 / 3) || (26 ? 16 : 39)));
+    }
+    {
+        int i12 = 0;
+        do {
+            v0 = (((a1[3][13] + 48) == (99 % 5)) ? ((v3 ? v2 : a1[1][15]) != (a0[15] / 8)) : ((v1 || v2) <= (a0[6] / 7)));
+            {
+                int i13 = 0;
+                do {
+                    if ((89 == v1) > 69) break;
+                    a0[2] = (((a1[1][4] ? i12 : a1[2][6]) > (v1 / 3)) == ((i12 == 80) + (v0 < v0)));
+                    a0[6] = (((92 && a0[15]) ? (37 == v1) : (73 <= v3)) || ((v0 + v1) - (71 - v2)));
+                    a1[2][3] = (((80 - i12) + (a0[12] % 7)) * ((61 ? 74 : a0[10]) % 1));
+                    i13 = i13 + 1;
+                } while (i13 < 2);
+            }
+            a1[3][1] = (((v2 - v0) && (a0[15] <= 59)) <= ((v2 <= v3) > (v2 <= v3)));
+            i12 = i12 + 1;
+        } while (i12 < 8);
+    }
+    if ((((v2 >= a0[8]) % 7) <= ((55 >= v3) ? (48 <= v2) : (v0 <= 68)))) {
+        v1 = (((v3 >= 28) * (28 > a1[0][10])) ? ((27 > v3) + (v1 / 4)) : ((15 != a0[5]) || (83 < 90)));
+        v2 = (((a1[2][0] != v0) > (a1[1][2] * 42)) && ((v1 == v0) >= (v0 || v1)));
+        a0[3] = (((89 > v3) >= (v2 / 4)) == ((v3 || 4) || (91 != v3)));
+    } else {
+        a1[1][6] = (((89 < 61) ? (v1 * v3) : (v2 >= 75)) ? ((a1[1][1] || a0[3]) >= (v1 < v1)) : ((a0[13] || 5) <= (v3 % 2)));
+        v3 = (((a0[3] % 8) < (46 != 96)) > ((v2 - 9) || (v0 ? 13 : a0[7])));
+        a0[0] = (((97 >= a1[2][3]) >= (v2 * v1)) * ((v2 == 57) >= (v2 - v0)));
+    }
+    return (((v0 < a1[0][3]) <= (a1[3][4] == 67)) > ((20 != a0[8]) < (a1[3][4] > v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,4209 @@
+int f0() {
+    int v0 = 50;
+    int v1 = 5;
+    int v2 = 49;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    a1[3][12] = (((v0 / 2) != (v0 % 8)) + ((a1[0][7] || 76) - (28 != a0[15])));
+                    v1 = (((v1 <= 58) && (v1 % 1)) >= ((v2 + a0[9]) ? (17 == i0) : (i1 >= v3)));
+                    a1[0][8] = (((v1 != a0[4]) + (49 % 9)) || ((v0 % 6) ? (17 == v2) : (i1 - v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v3 = (((69 > a0[1]) ? (a1[0][6] == v0) : (a0[14] != a0[8])) <= ((64 < v1) >= (v0 % 5)));
+            v2 = (((8 * v3) > (a1[0][12] <= 55)) ? ((28 ? i0 : i0) * (v1 * i0)) : ((a0[6] != v2) ? (v0 || 98) : (a1[1][9] ? a1[2][10] : v1)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v3 = (((v0 - 13) ? (v0 ? v2 : 30) : (41 + v0)) >= ((v3 % 1) ? (v2 < 41) : (v0 * v0)));
+    a1[0][3] = (((v2 ? v0 : 53) + (v2 ? 43 : a0[4])) != ((a0[3] != 39) >= (a1[0][12] >= 24)));
+    if ((((a1[0][15] != a0[14]) != (a0[15] < v2)) && ((v2 + 13) ? (v3 + v2) : (a1[3][8] && 74)))) {
+        v1 = (((v1 || v2) ? (a0[2] - 40) : (98 != v3)) % 4);
+        v2 = (((v3 / 9) - (a0[5] == v2)) != ((v0 < a0[0]) / 7));
+        v0 = (((v0 >= a1[3][10]) % 4) % 4);
+    } else {
+        v0 = (((17 / 1) <= (48 * 76)) * ((96 / 5) < (v0 ? v1 : a1[0][15])));
+        v1 = (((v0 || v3) <= (v1 != 36)) && ((a1[1][11] >= v3) != (a0[10] < 98)));
+        v2 = (((v1 + 91) == (v3 == v3)) * ((v2 - a0[13]) == (v3 != a1[1][8])));
+    }
+    a0[10] = (((75 < 98) >= (v0 ? 75 : 75)) || ((v0 - 5) % 5));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a1[2][3] = (((a0[13] && 27) % 3) > ((v2 <= 38) >= (93 * v1)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a0[6] = (((a1[1][13] && i3) && (20 % 6)) ? ((i3 && v2) > (70 < a1[3][14])) : ((i2 - i3) <= (a0[9] != 38)));
+            a0[4] = (((v0 / 6) <= (a0[13] > 98)) ? ((v3 ? i3 : v2) && (i3 < a0[11])) : ((v3 % 3) >= (v1 ? v1 : i3)));
+            v0 = (((a1[2][12] <= 18) || (i2 < a0[4])) + ((i3 / 1) || (34 % 6)));
+        }
+        v1 = (((v3 >= 26) % 3) != ((89 == a0[2]) / 1));
+    }
+    v0 = (((a0[13] * v3) <= (v3 % 1)) % 7);
+    v3 = (((v2 + a1[1][4]) % 1) * ((a1[3][15] + v0) + (a1[3][9] ? v0 : a1[0][13])));
+    v2 = (((a0[14] != a0[10]) && (a1[2][2] == v3)) && ((v3 && v1) % 2));
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v2 = (((a1[2][2] == 33) * (v2 && v0)) != ((v2 >= a1[2][15]) > (i4 ? v3 : v0)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v0 = (((v3 - 76) + (a1[1][4] || v2)) == ((a0[8] == 62) % 4));
+                v0 = (((a1[2][1] && v3) == (20 >= a1[3][12])) % 4);
+                a0[5] = (((a0[11] % 6) + (a0[12] * a1[2][3])) ? ((v2 / 9) > (i4 ? v0 : 46)) : ((v1 <= 80) > (v1 < a0[6])));
+            }
+            v0 = (((i4 > a0[0]) / 8) == ((v3 + v2) * (v3 ? a0[11] : a0[15])));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v2 ? v0 : a1[2][3]) == (a1[2][2] && a0[7])) ? ((48 ? 76 : v1) > (v3 > v0)) : ((v3 ? v3 : v0) / 5));
+}
+int f1() {
+    int v0 = 20;
+    int v1 = 84;
+    int v2 = 11;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 && v0) ? (v0 ? v3 : v0) : (74 == v1)) != ((67 % 4) + (v3 || a0[8])))) {
+        v1 = (((v1 - a0[14]) ? (v3 % 1) : (v3 / 2)) % 5);
+        v0 = (((v1 % 3) ? (84 ? v3 : v2) : (v3 ? a1[3][14] : a0[15])) + ((a1[1][2] < v0) ? (a0[5] > v3) : (a1[1][8] <= v0)));
+        v1 = (((v2 * 65) ? (v1 % 4) : (a0[10] % 6)) ? ((a1[2][2] + v0) >= (a0[7] % 6)) : ((a0[4] * 86) && (a0[10] < a0[7])));
+    } else {
+        v3 = (((v2 <= a1[2][0]) && (a1[3][6] > a0[10])) || ((a0[2] && a0[0]) ? (93 % 5) : (a1[2][8] > v0)));
+        v3 = (((v3 <= v3) ? (v0 != a1[1][9]) : (v0 ? a1[2][2] : a1[3][9])) <= ((v3 / 5) - (v1 && 15)));
+        v3 = (((v0 ? a1[3][14] : a0[15]) % 7) != ((v2 || 84) / 3));
+    }
+    v3 = (((v3 >= 8) >= (v0 % 3)) - ((v2 / 8) && (v0 % 7)));
+    if ((((a1[0][1] == v0) ? (a0[12] + v1) : (a1[0][8] < v2)) && ((v0 != v2) <= (v1 ? a0[11] : v3)))) {
+        a0[4] = (((v0 && v1) * (14 == v1)) * ((v0 == v1) - (v3 * v0)));
+        v3 = (((v1 > 43) * (v3 <= v0)) ? ((v3 <= 54) || (v1 / 8)) : ((v0 <= a0[4]) <= (v2 / 4)));
+        v1 = (((1 % 9) && (35 <= v1)) * ((a0[8] * v1) >= (v3 * a1[0][5])));
+    } else {
+        a0[1] = (((v1 != a1[1][14]) != (23 * v1)) != ((v1 > 85) || (a0[8] / 6)));
+        v2 = (((v2 + v3) == (66 < v0)) * ((v3 == a0[11]) % 6));
+        a0[4] = (((v0 - v2) - (v0 % 3)) ? ((a1[3][3] * 87) && (v1 || v1)) : ((a0[14] < v1) % 5));
+    }
+    if ((((a1[0][5] == v3) * (v2 != v1)) < ((a0[4] <= a0[14]) % 1))) {
+        v3 = (((v1 >= 83) <= (a0[5] - 21)) || ((v2 && a1[1][4]) > (v0 ? v0 : v0)));
+        v0 = (((38 > a1[2][11]) * (4 ? a1[3][7] : 75)) - ((a0[8] != v1) + (16 > v0)));
+        v0 = (((a1[0][8] <= v3) - (v3 && v3)) != ((97 - v3) == (89 / 6)));
+    } else {
+        a0[3] = (((v2 == v1) + (v0 != v2)) || ((a0[15] - a0[1]) > (v1 / 5)));
+        v1 = (((v0 <= v3) == (v1 >= 28)) / 8);
+        v1 = (((v2 % 9) - (v1 || v0)) == ((v0 % 4) / 5));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((v3 <= a0[2]) - (i0 * v3)) != ((i0 < a0[1]) / 6));
+            a0[6] = (((v1 > v2) == (a1[2][10] < i0)) / 6);
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((81 != v2) > 67) break;
+                a1[3][7] = (((89 >= a0[4]) || (i1 ? 62 : i0)) < ((v1 > i1) * (88 != 79)));
+                v2 = (((v0 || a1[1][11]) && (v1 - 57)) != ((a0[0] && a0[2]) == (i1 && v2)));
+                a1[0][2] = (((41 > 85) <= (v1 + v1)) ? ((64 == 25) - (24 ? v2 : v0)) : ((v2 / 3) == (35 / 4)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v2 = (((a0[4] + v0) * (v1 > v0)) ? ((31 - v2) + (46 >= a1[3][3])) : ((1 == 13) && (a1[0][10] / 9)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v2 = (((a1[3][10] * v3) <= (38 + a1[2][10])) == ((a0[5] / 4) - (v1 != 61)));
+                    v0 = (((v1 + v1) <= (v2 ? a1[1][10] : 93)) < ((i3 ? i2 : 2) >= (v3 ? 45 : a1[2][9])));
+                    v1 = (((a1[0][1] && 9) ? (0 ? a1[0][12] : v2) : (97 - a1[1][11])) && ((v3 <= 28) == (14 < v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a0[1] <= a0[1]) != (a1[1][14] < 24)) - ((a0[3] || v1) >= (5 / 7)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[2][10] <= v1) > (a1[3][7] != v2)) ? ((v0 + v2) - (a0[0] <= v3)) : ((53 - v2) || (v1 < 71)))) {
+        v3 = (((54 > v1) - (a1[2][0] ? a1[3][5] : v1)) >= ((a0[2] != a1[2][14]) * (v1 ? v3 : v2)));
+        a0[4] = (((v0 || a0[8]) <= (a0[4] > v3)) != ((v1 > v3) != (39 <= v1)));
+        v2 = (((28 > v2) / 3) ? ((92 / 7) >= (51 < v0)) : ((v1 <= v1) - (v0 > v0)));
+    } else {
+        v1 = (((a0[12] ? v3 : v3) ? (a1[1][13] ? a0[2] : v3) : (v0 > a0[3])) ? ((v1 > a1[1][6]) % 5) : ((v3 / 5) || (v1 <= v1)));
+        a1[1][14] = (((a1[1][4] ? a0[4] : a0[9]) == (v1 % 6)) && ((v2 > 93) >= (v0 == v2)));
+        a1[0][9] = (((v3 != v0) <= (28 > 57)) != ((v3 == 45) == (a1[0][10] <= v2)));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v2 = (((59 && a1[0][4]) && (v0 > 83)) ? ((a0[14] ? v1 : v1) - (75 && 43)) : ((v3 >= v0) && (90 - v0)));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            v1 = (((v0 ? v3 : v0) >= (a1[2][4] ? v1 : v0)) ? ((v3 >= v3) != (a1[3][6] ? i4 : i4)) : ((64 >= 73) || (v2 ? a0[14] : i4)));
+            v0 = (((v0 >= v3) > (v2 + a1[1][6])) < ((a1[1][0] * i5) < (i4 * v2)));
+            v2 = (((v0 ? a0[9] : v3) + (32 < v0)) > ((i4 + 65) > (i4 - 85)));
+        }
+        a0[10] = (((v1 && v0) % 1) && ((i4 <= a0[13]) + (i4 != a1[2][4])));
+    }
+    v0 = (((a1[2][12] ? a0[13] : 81) ? (a0[9] ? a0[7] : a1[2][7]) : (a1[2][8] ? v3 : a0[0])) >= ((a1[2][0] * v1) >= (v3 % 2)));
+    if ((((54 ? 72 : v3) != (a0[6] - 90)) + ((v2 + v0) <= (16 == v0)))) {
+        v0 = (((v3 == v0) <= (33 * v1)) || ((v0 ? v1 : v2) <= (v3 ? 37 : v1)));
+        v3 = (((v3 <= v1) * (v1 + a1[1][10])) * ((a0[14] >= a1[0][11]) != (v3 / 1)));
+        v3 = (((26 - v2) < (85 + v0)) > ((34 < v0) / 5));
+    } else {
+        v0 = (((v0 ? v0 : v3) * (v1 >= a0[0])) <= ((a0[3] && v3) ? (a0[0] - a0[5]) : (v3 - a0[7])));
+        v1 = (((v3 <= v1) >= (v3 % 8)) >= ((a0[9] && a0[3]) > (a0[9] && v1)));
+        a1[2][10] = (((v2 - v2) ? (v3 >= 78) : (v0 != a0[2])) || ((v3 > v1) && (a0[15] ? 70 : v3)));
+    }
+    return (((67 == v3) * (a1[0][13] >= v3)) / 5);
+}
+int f2() {
+    int v0 = 13;
+    int v1 = 97;
+    int v2 = 66;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    a0[1] = (((81 ? 56 : v3) - (v3 != v0)) < ((v2 / 1) ? (v1 % 5) : (a0[7] - v0)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((a1[1][3] && 37) > 62) break;
+            a0[5] = (((v2 ? a1[1][11] : v2) / 6) <= ((v3 ? a0[4] : 42) == (v3 <= a0[10])));
+            a1[0][0] = (((v2 <= i0) / 6) && ((v3 + v1) / 4));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((v2 / 2) >= (v1 && i1)) != ((38 >= 91) < (i0 == v2)));
+                a0[12] = (((i0 == a1[1][10]) == (a0[12] >= v0)) % 8);
+                v2 = (((a0[1] && v2) / 4) ? ((v0 || 7) >= (43 ? 31 : v2)) : ((v0 * i0) ? (a0[15] * 15) : (v3 <= 72)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v2 >= 75) == (24 ? 97 : 66)) % 9);
+    a0[8] = (((v2 >= v2) || (v3 / 7)) % 8);
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v0 >= a0[5]) % 5) || ((v1 != a0[2]) / 5));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                a0[14] = (((a0[12] / 1) <= (50 % 5)) - ((v3 % 8) * (88 % 4)));
+                v2 = (((v1 - a0[11]) / 2) ? ((62 || 17) != (i3 >= 81)) : ((a0[4] <= v1) > (i2 / 7)));
+                a0[4] = (((59 != i3) > (a0[4] || v1)) / 7);
+            }
+            v2 = (((v3 == v1) <= (v3 && v1)) ? ((a1[1][8] - v2) % 1) : ((v1 - v2) - (v0 <= v0)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    if ((33 <= v2) > 87) break;
+                    v0 = (((48 > a0[6]) - (v1 && 81)) == ((9 / 3) > (v0 < 1)));
+                    a1[1][9] = (((a0[3] ? i4 : a1[2][7]) > (v0 == v3)) < ((33 / 9) / 8));
+                    v3 = (((51 >= v0) ? (v3 > v1) : (v3 > 95)) % 3);
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v3 = (((12 || v0) ? (v0 % 8) : (v1 / 6)) || ((v1 / 8) ? (a0[9] > 6) : (a1[2][11] - v3)));
+            v3 = (((1 ? i4 : a0[12]) < (a0[6] != a0[6])) <= ((v0 ? v2 : a0[13]) ? (v3 ? 63 : v1) : (v1 > a0[5])));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    if ((((v0 % 3) && (a1[0][13] * a1[2][1])) > ((v2 + 42) + (v1 ? v1 : a1[1][14])))) {
+        v1 = (((a1[1][7] / 6) > (a0[10] == v1)) - ((a0[11] || 3) != (a1[2][11] ? 22 : 10)));
+        a0[0] = (((v1 >= v3) < (a0[3] <= a1[0][4])) && ((a0[13] <= v2) == (a0[4] || v0)));
+        a0[1] = (((v1 || 98) <= (a1[1][13] && v3)) != ((a1[3][2] && 55) && (v2 == v3)));
+    } else {
+        v1 = (((v0 > v1) || (v3 % 8)) + ((10 || v0) - (99 != a1[0][1])));
+        a1[0][10] = (((v0 * v2) + (a1[3][4] <= a1[0][1])) / 2);
+        v0 = (((v3 == v3) * (66 * v0)) <= ((0 > 53) % 3));
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                a1[2][2] = (((v1 >= a0[8]) % 2) % 8);
+                v1 = (((v2 <= v0) >= (67 - a0[4])) ? ((16 && 8) + (a1[2][13] - 14)) : ((21 <= 78) ? (a0[9] != a1[3][4]) : (v0 % 8)));
+                a1[3][13] = (((v3 > i6) == (v0 < i6)) - ((a0[11] > 4) == (v1 % 9)));
+            }
+            v1 = (((81 > v0) <= (v1 || v1)) <= ((v0 >= i6) == (a1[1][10] >= 48)));
+            v3 = (((v3 / 1) / 9) <= ((a1[3][9] != 60) && (a0[12] - v0)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 5) {
+            v2 = (((i8 >= v2) != (v0 != v2)) || ((v0 <= 32) ? (v3 || v2) : (v1 != v0)));
+            v1 = (((v1 > v2) <= (a0[2] <= v2)) > ((99 + a1[3][13]) % 1));
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                v2 = (((a0[0] - v1) != (v3 || i8)) <= ((v3 >= i8) % 7));
+                v0 = (((v2 * v2) && (v0 ? 1 : v2)) <= ((a0[5] / 1) < (v3 * 42)));
+                v0 = (((v1 > i8) == (a0[11] && 4)) == ((10 > a1[0][7]) % 1));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        a0[10] = (((v3 % 8) < (a1[2][4] ? a0[2] : i10)) || ((i10 + a0[8]) && (a1[3][13] % 9)));
+        for (int i11 = 0; i11 < 5; i11 = i11 + 1) {
+            v0 = (((48 ? i11 : 43) ? (i11 && v2) : (85 + v0)) + ((20 >= a1[1][12]) < (v0 && v0)));
+            a0[11] = (((v2 - 79) / 9) || ((v1 == i11) >= (i11 || v3)));
+            a0[0] = (((i10 + v2) >= (v0 - v2)) % 9);
+        }
+        v1 = (((v1 || a1[0][15]) - (88 < 69)) || ((a0[15] && v1) && (28 % 1)));
+    }
+    return (((8 < v3) / 3) - ((a0[13] ? v2 : 24) - (v0 % 4)));
+}
+int f3() {
+    int v0 = 8;
+    int v1 = 96;
+    int v2 = 54;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                do {
+                    if ((i0 / 3) > 68) break;
+                    a0[0] = (((v3 + v0) > (7 >= v3)) != ((v0 % 6) ? (a0[9] ? v0 : v2) : (v3 - 26)));
+                    a0[11] = (((i0 * 4) != (i0 < a0[7])) || ((v1 <= a1[1][4]) <= (i0 > v3)));
+                    v3 = (((i0 >= v0) ? (v2 || v3) : (i1 + 82)) || ((a1[3][5] != a0[10]) / 9));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v1 = (((52 || a0[12]) * (7 ? i0 : 29)) - ((51 ? v0 : a0[4]) >= (i0 % 1)));
+            v2 = (((a1[0][11] * v1) || (v3 < v2)) <= ((a1[1][2] % 9) <= (80 / 7)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 > a1[0][8]) >= (a1[1][13] > v1)) <= ((56 / 4) <= (2 + v1)))) {
+        v3 = (((v2 < a0[8]) && (60 / 1)) >= ((21 != v2) >= (v3 - v0)));
+        v1 = (((53 && v3) - (3 * 2)) == ((v1 < 2) == (v2 * v1)));
+        v3 = (((v1 / 2) && (a1[0][7] < 39)) > ((a1[2][3] - v1) == (v3 ? v2 : v0)));
+    } else {
+        a1[3][7] = (((a1[0][10] + v3) / 6) ? ((a1[1][1] % 9) / 8) : ((a1[0][1] == v0) ? (a0[3] ? v3 : 40) : (v2 == a0[1])));
+        v3 = (((66 / 7) < (v3 || v3)) > ((a0[15] != 89) >= (v1 == v0)));
+        v2 = (((v3 && 85) % 1) * ((v3 % 9) && (v3 || v2)));
+    }
+    v3 = (((13 < a0[6]) ? (v3 / 7) : (v1 < v0)) || ((84 || a0[12]) || (59 > 29)));
+    v2 = (((v3 && v3) - (0 / 7)) > ((a1[3][3] + 6) * (v2 == a0[7])));
+    v1 = (((v2 != 36) + (v1 < v3)) * ((v3 || 5) <= (v1 <= v0)));
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a1[3][0] = (((v2 < 90) % 9) != ((a1[2][13] ? v1 : a0[0]) || (i2 ? v0 : a1[0][13])));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((92 > v3) * (i2 * v3)) && ((49 >= 81) ? (v0 % 4) : (v1 > 66)));
+                    v0 = (((21 ? 28 : i3) == (v1 * v2)) == ((13 % 1) && (v3 % 2)));
+                    v3 = (((i3 * i3) ? (v1 > v3) : (i3 && v2)) != ((a1[2][14] >= a0[14]) % 7));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v2 = (((v3 ? 42 : i2) <= (a0[13] == a0[14])) % 8);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v3 = (((a1[0][10] && a0[15]) < (33 < 56)) <= ((68 == i5) - (i4 + a1[3][6])));
+                v3 = (((v1 != v0) ? (a0[5] / 5) : (a1[2][1] <= v3)) > ((i4 % 1) < (v2 - a1[1][13])));
+                v2 = (((42 < v0) / 4) ? ((i5 ? 66 : v1) * (74 + a1[3][14])) : ((v0 - v1) < (a0[6] < i5)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        a1[2][12] = (((v3 == 18) > (a0[5] != a1[2][14])) || ((a0[11] + v2) / 7));
+        v0 = (((v0 == a1[3][3]) != (v1 >= 24)) ? ((a0[9] > a0[12]) < (60 <= v1)) : ((v0 != v2) % 3));
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        v2 = (((v2 + a0[13]) > (46 < 80)) < ((28 + 48) <= (85 >= v3)));
+        v1 = (((v1 == a0[7]) * (i6 * v3)) == ((a1[0][0] + 79) ? (v0 + v3) : (v3 + a1[3][15])));
+        {
+            int i7 = 0;
+            do {
+                if ((98 && 23) > 81) break;
+                v3 = (((a1[1][3] * a1[2][12]) || (v1 ? i7 : v0)) ? ((a1[2][13] % 8) != (11 ? v0 : a1[0][14])) : ((v3 > v0) < (i6 >= a1[0][6])));
+                v2 = (((18 == a0[8]) >= (30 <= a1[0][14])) % 5);
+                a0[4] = (((a1[2][4] * i6) > (a0[7] - i6)) || ((32 <= 19) < (v0 >= i6)));
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                v0 = (((a0[1] * 10) * (a0[12] || v2)) || ((v1 ? v0 : a0[6]) && (a1[2][11] >= i8)));
+                a0[2] = (((v1 < 40) - (a1[0][0] <= 55)) / 3);
+                v2 = (((45 + i8) <= (a0[12] * 14)) >= ((v1 + i9) > (99 ? a0[2] : v0)));
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+        v2 = (((v0 * 49) < (72 < v1)) > ((a1[1][5] - v2) / 4));
+        a1[3][10] = (((18 / 4) == (a1[2][14] != 57)) - ((a1[2][6] > a0[5]) != (i8 % 1)));
+    }
+    if ((((v1 == 83) * (v2 != v3)) && ((94 % 3) == (v3 == v0)))) {
+        v3 = (((a0[10] * v1) <= (v3 >= a1[3][4])) < ((55 == v0) < (v3 != v0)));
+        a0[7] = (((v0 - a0[14]) && (v3 >= a0[6])) * ((58 ? a0[12] : 77) != (v0 || a1[1][10])));
+        v2 = (((99 || a1[0][13]) * (v1 * v1)) < ((v3 / 8) == (8 - v2)));
+    } else {
+        a0[3] = (((95 ? 19 : v1) <= (a1[2][13] / 5)) > ((v1 ? a1[3][1] : 19) / 9));
+        v0 = (((v3 && a0[0]) || (2 ? a0[0] : 45)) == ((v2 ? 26 : a0[14]) && (19 / 2)));
+        v3 = (((76 > a1[0][3]) <= (v2 ? a1[2][5] : v1)) * ((v3 + 87) && (a1[0][3] ? v1 : 53)));
+    }
+    return (((v2 < 72) > (67 >= v1)) - ((a0[5] == v1) >= (a0[3] + v3)));
+}
+int f4() {
+    int v0 = 89;
+    int v1 = 21;
+    int v2 = 71;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 != v3) > 65) break;
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    a1[1][2] = (((i0 >= v3) != (a0[9] % 3)) || ((36 / 9) - (23 ? v3 : a1[0][10])));
+                    a0[3] = (((v2 ? a1[2][9] : a0[4]) % 2) + ((v2 / 2) != (72 == v1)));
+                    v1 = (((v1 < 54) || (i1 ? a1[0][5] : a0[12])) >= ((a1[1][8] / 6) || (32 / 7)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v0 || v2) ? (24 != v3) : (a0[10] > 28)) ? ((a1[2][14] == i0) + (97 * 5)) : ((a1[1][0] ? v3 : a1[1][5]) < (a1[1][0] && v0)));
+            a0[15] = (((a0[14] != 17) > (2 < 51)) >= ((a0[15] || v3) ? (v3 / 5) : (v1 || 57)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v1 = (((a0[3] || a1[1][7]) / 4) ? ((94 <= a1[3][6]) / 8) : ((a1[1][14] != v1) == (v1 < 93)));
+    if ((((52 - 98) / 9) + ((83 != v3) <= (v0 % 8)))) {
+        v1 = (((a1[1][3] > v1) ? (14 == v2) : (38 + a0[4])) * ((v1 || v0) * (a0[12] >= a0[5])));
+        v0 = (((a0[14] || v3) ? (a0[9] < 14) : (v1 % 1)) ? ((v2 > v1) >= (v0 - a0[1])) : ((v3 <= 48) >= (a1[0][4] % 7)));
+        v2 = (((91 || 71) == (a1[1][8] >= v2)) % 4);
+    } else {
+        v0 = (((47 != v1) >= (v1 >= v1)) / 7);
+        v1 = (((25 + 7) <= (22 || v3)) != ((a1[1][14] - 64) + (a0[1] > 82)));
+        v2 = (((v2 * a0[15]) ? (v2 && v3) : (a1[3][8] ? a0[1] : 45)) != ((a0[0] / 4) ? (v2 >= v1) : (73 >= v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[1][6] = (((a0[9] + a0[8]) + (a1[2][3] <= v3)) == ((10 != a0[4]) ? (a1[0][11] * 24) : (82 ? a1[1][7] : v3)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((i3 == 46) ? (v3 * 31) : (v1 > 60)) + ((v3 <= v2) >= (v2 < 19)));
+                v2 = (((a1[1][7] - a1[3][11]) % 6) > ((a1[0][10] * v1) == (v2 % 2)));
+                v1 = (((i3 >= 48) / 2) ? ((v1 * v1) != (25 || a0[14])) : ((a1[1][9] < v0) >= (a1[0][12] % 6)));
+            }
+            v3 = (((v3 ? i2 : a0[15]) / 7) < ((a1[3][6] > 66) - (a1[0][7] >= a1[1][15])));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    v3 = (((a0[5] % 6) ? (v1 % 3) : (a0[3] / 2)) - ((a1[0][14] * v2) != (v2 ? 3 : 53)));
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                if ((i4 + 3) > 78) break;
+                v2 = (((a0[15] || a1[1][0]) > (a1[3][4] / 1)) == ((98 % 9) || (v3 * v1)));
+                a0[6] = (((v3 != i4) * (v1 || v1)) || ((13 >= 69) ? (v1 ? v2 : a0[1]) : (80 * a1[1][12])));
+                v2 = (((v2 == i5) != (a1[0][6] + a0[5])) || ((a0[12] <= v2) >= (v2 == v1)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        v1 = (((i4 - a0[1]) == (a0[4] > a0[12])) - ((a0[2] > v1) || (v2 > 1)));
+        a1[2][11] = (((a1[1][15] ? v2 : 26) <= (v3 * 35)) ? ((a1[2][15] / 1) ? (v2 < 71) : (a1[3][0] && a1[2][8])) : ((a1[3][4] && v3) - (v3 ? a1[3][13] : 85)));
+    }
+    v0 = (((a0[12] / 4) * (30 * a1[2][2])) + ((a0[6] > v1) * (14 >= v2)));
+    {
+        int i6 = 0;
+        do {
+            v3 = (((a0[12] ? v2 : v2) >= (a1[2][5] != v2)) <= ((v0 != a1[2][15]) != (v0 >= v2)));
+            {
+                int i7 = 0;
+                do {
+                    a0[3] = (((a0[11] <= 16) || (86 + a1[2][8])) / 1);
+                    a1[1][10] = (((17 || v2) * (68 && 21)) == ((i7 > a0[1]) ? (a0[4] != v3) : (a1[2][4] * v2)));
+                    a0[12] = (((a1[2][1] > a1[0][4]) < (i6 <= v1)) ? ((v0 - 89) == (a0[2] * v1)) : ((a1[1][12] && v2) > (a1[1][5] < 97)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            v3 = (((v2 % 6) - (v3 ? 44 : 10)) == ((v1 * i6) * (i6 / 1)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        v3 = (((41 && 0) > (v2 * a1[2][11])) ? ((a0[3] ? a0[7] : v0) < (76 && a0[3])) : ((49 && i8) || (i8 >= 88)));
+        {
+            int i9 = 0;
+            do {
+                v0 = (((i8 * i9) / 2) <= ((i8 || v3) % 9));
+                v2 = (((v0 || 35) == (a0[7] >= i9)) >= ((82 ? v3 : 29) <= (70 || i9)));
+                v3 = (((v0 - a1[2][9]) == (a1[3][1] < 18)) - ((93 > 99) != (84 ? v0 : v2)));
+                i9 = i9 + 1;
+            } while (i9 < 5);
+        }
+        v1 = (((8 % 7) % 2) ? ((a1[1][4] >= a0[15]) >= (i8 < v2)) : ((i8 * a1[3][2]) != (a0[6] >= 50)));
+    }
+    v3 = (((v3 / 2) ? (v3 || v3) : (a0[6] <= v3)) ? ((a0[9] / 3) && (a0[14] - a1[3][7])) : ((47 > 2) / 3));
+    return (((a0[3] > v1) ? (v3 < a0[1]) : (a0[8] >= 20)) - ((7 >= v0) <= (4 ? v0 : v0)));
+}
+int f5() {
+    int v0 = 63;
+    int v1 = 32;
+    int v2 = 30;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 <= v1) > 58) break;
+            v0 = (((57 && v0) && (v0 % 8)) - ((v3 + v2) < (a0[15] + v2)));
+            v3 = (((v3 + v0) > (i0 / 1)) ? ((a1[3][10] * v1) || (92 > v3)) : ((73 || 43) != (v0 - v0)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v2 = (((a1[2][10] < 15) * (i1 ? v3 : 59)) < ((21 + v1) == (a0[15] + v3)));
+                    a0[12] = (((a1[2][13] < v0) <= (21 <= a0[9])) / 8);
+                    a1[3][0] = (((a0[0] - a1[2][8]) * (v0 % 3)) > ((v3 - a0[10]) % 2));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v2 = (((31 < 21) / 1) - ((18 && v2) <= (a0[12] / 2)));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((v1 != v0) > 79) break;
+        v1 = (((a0[8] == v3) ? (v1 || v0) : (a1[0][14] != v2)) && ((47 >= v3) > (v0 * v1)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            a0[9] = (((43 + v0) && (a1[0][3] ? v3 : v0)) >= ((i3 - v3) % 2));
+            a0[6] = (((30 == v1) - (48 / 3)) + ((v0 <= v2) - (a1[3][7] > 25)));
+            a1[1][3] = (((i2 - v0) - (a1[1][13] ? i3 : 45)) != ((a0[0] || v1) * (i2 ? v1 : a1[2][11])));
+        }
+        a0[11] = (((a0[0] != v1) <= (11 + i2)) && ((v1 + v0) && (v3 || 83)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[1][3] = (((v3 / 9) ? (v3 ? 11 : i4) : (v2 == 86)) < ((a0[12] - i4) <= (v2 == 4)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((46 ? 95 : a1[1][10]) * (a0[8] / 8)) >= ((a1[1][14] % 5) == (i4 ? v1 : v2)));
+                    v0 = (((a0[15] >= a0[4]) - (48 > i4)) + ((v2 < 81) < (a1[2][14] <= i5)));
+                    a1[2][14] = (((a0[6] - v2) + (24 >= a1[0][10])) % 7);
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v1 = (((a0[2] - a1[2][2]) != (31 * 93)) + ((v2 / 5) == (v1 ? 65 : i4)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v1 ? 62 : a1[1][13]) > 50) break;
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((v3 >= 85) ? (a1[0][15] <= i7) : (i7 - i6)) % 7);
+                    v2 = (((61 - 19) > (a1[1][2] && a1[3][1])) * ((1 >= 36) < (50 == 98)));
+                    v3 = (((v3 + v0) % 7) >= ((v1 <= a0[0]) < (a1[3][9] ? v0 : a0[13])));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            a0[15] = (((a1[3][10] ? v3 : i6) || (v1 != 34)) < ((a0[7] <= v2) || (v0 == v3)));
+            v1 = (((v3 && i6) != (v3 % 7)) % 8);
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    if ((((86 && v3) * (a0[8] || a1[0][13])) >= ((43 * v1) * (21 <= a1[3][8])))) {
+        a0[3] = (((a1[0][5] ? 13 : a0[11]) - (v3 - v3)) * ((2 > v2) + (a1[2][7] / 8)));
+        a0[8] = (((21 < a0[6]) < (29 % 8)) >= ((60 && v3) > (37 ? a1[0][8] : a1[0][7])));
+        a1[3][1] = (((60 && v2) == (68 >= v2)) ? ((v1 ? v0 : 55) / 6) : ((79 > 25) ? (v2 ? a1[2][10] : v2) : (a0[13] || 30)));
+    } else {
+        a1[0][13] = (((a1[1][12] && a0[10]) || (a1[3][9] || v0)) ? ((v2 <= v2) > (a1[1][7] * 52)) : ((a0[4] != 65) || (a1[3][8] == v1)));
+        a1[3][2] = (((v1 * v2) % 5) ? ((v0 ? v0 : a1[3][1]) && (v3 % 5)) : ((a0[2] == v0) != (v2 && v0)));
+        a0[1] = (((a0[1] - v0) * (0 || a1[1][15])) >= ((v1 >= v3) >= (a1[0][6] >= 59)));
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        a0[1] = (((3 < v3) && (v3 / 6)) == ((13 != a1[1][4]) < (v1 + 5)));
+        {
+            int i9 = 0;
+            do {
+                a0[3] = (((i8 ? a0[10] : v3) > (a1[3][10] != a1[1][12])) || ((a1[2][0] - a1[2][14]) <= (21 != v3)));
+                v1 = (((v3 > a0[10]) % 3) - ((v1 - v0) * (a0[6] || 15)));
+                v3 = (((3 == v0) >= (v1 < v0)) == ((i8 / 2) ? (v2 ? i8 : i8) : (v0 + i9)));
+                i9 = i9 + 1;
+            } while (i9 < 2);
+        }
+        v1 = (((a0[5] % 9) > (v0 && a0[9])) != ((v2 ? 2 : v2) % 8));
+    }
+    if ((((a1[0][9] != v1) ? (v1 > 12) : (a1[1][2] && v3)) % 3)) {
+        v1 = (((a0[15] >= v1) - (4 ? v0 : v3)) >= ((a1[3][9] ? v2 : 49) <= (a1[0][5] <= a0[5])));
+        v0 = (((v2 + a0[14]) + (76 >= a1[1][11])) && ((a1[1][0] >= 82) <= (v1 < v3)));
+        v3 = (((v1 >= v0) > (v2 ? v3 : v2)) == ((v1 >= v0) < (v3 % 7)));
+    } else {
+        v0 = (((v1 == v0) % 4) != ((v3 && a1[2][4]) <= (76 ? 83 : 87)));
+        a0[7] = (((v3 % 3) ? (a1[2][6] != v0) : (a1[0][10] && v0)) > ((v1 <= v0) ? (v0 ? 13 : a1[1][12]) : (95 || v0)));
+        v0 = (((a1[1][11] || v1) % 3) < ((v1 >= 64) - (2 >= v0)));
+    }
+    v2 = (((a0[7] + v3) && (v1 + a0[8])) - ((v1 > a1[0][10]) * (9 >= a1[2][4])));
+    if ((((84 ? 24 : a0[6]) - (v3 && 3)) && ((v2 ? v1 : v3) != (v0 || a1[0][12])))) {
+        v1 = (((v1 != v2) < (90 + v0)) < ((v3 && 72) / 8));
+        v0 = (((v0 && a0[4]) / 2) ? ((a0[9] ? 64 : v2) || (v2 && 23)) : ((91 * 24) && (v3 && v2)));
+        v0 = (((97 < v0) || (a0[11] / 9)) - ((v2 <= a1[2][1]) || (a0[1] > v1)));
+    } else {
+        v3 = (((v0 && 86) <= (a1[0][2] > 13)) || ((48 ? v2 : a1[2][8]) <= (v3 * 51)));
+        v0 = (((v2 / 3) % 4) >= ((58 > 21) % 2));
+        v0 = (((93 % 5) % 2) > ((a0[2] ? 6 : a0[5]) > (36 / 4)));
+    }
+    return (((v0 * a1[2][12]) && (v3 || a1[2][1])) != ((69 && v1) < (v3 != v0)));
+}
+int f6() {
+    int v0 = 95;
+    int v1 = 51;
+    int v2 = 10;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a1[3][13] = (((v2 ? 87 : v3) == (i0 % 4)) != ((17 >= v2) > (v2 / 7)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a1[0][9] = (((v1 != 92) ? (6 ? i0 : v3) : (v1 / 1)) == ((i1 <= v2) ? (v0 / 3) : (57 - a0[13])));
+                    v0 = (((88 + 95) / 3) == ((v1 != a1[2][15]) != (2 % 8)));
+                    v3 = (((i0 != v0) * (v3 > 79)) ? ((62 || i0) != (a0[7] % 1)) : ((v2 > v3) % 6));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a1[1][0] >= i0) ? (v3 ? 7 : v0) : (a0[11] <= v1)) % 1);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 != 63) ? (v2 > v0) : (v3 ? v2 : 41)) / 3)) {
+        v0 = (((v1 ? v2 : a0[2]) ? (v0 || v0) : (a1[1][4] < v2)) < ((v3 + 37) <= (28 - a1[2][6])));
+        a1[0][11] = (((v0 < a0[15]) || (78 && 42)) * ((v1 <= a0[14]) != (8 % 9)));
+        v0 = (((v1 / 9) == (v0 / 1)) < ((v0 < v3) ? (74 != 48) : (v2 || v2)));
+    } else {
+        v1 = (((v1 / 1) - (v2 != v3)) * ((v3 || 95) <= (v3 && v2)));
+        v3 = (((a0[0] < v2) < (v3 && a0[1])) > ((v3 % 8) >= (v1 - a0[10])));
+        v3 = (((a1[1][0] || 37) <= (v1 + 98)) ? ((v1 || v2) >= (a0[2] > v3)) : ((v2 || a1[2][7]) / 1));
+    }
+    a1[1][14] = (((v1 / 7) && (v0 ? 23 : a1[0][15])) < ((v1 <= v1) == (34 ? v0 : v1)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v2 + v2) > 59) break;
+        v1 = (((59 / 4) < (73 != v0)) / 7);
+        v2 = (((v3 + v2) != (71 < i2)) + ((a1[1][5] % 7) * (40 / 7)));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                if ((i3 + a0[5]) > 57) break;
+                v1 = (((a0[14] && 24) * (a0[15] <= i3)) <= ((i3 * v1) <= (v2 ? v1 : 29)));
+                v1 = (((49 == v2) <= (v1 || a1[0][10])) <= ((77 < 75) == (v2 != i3)));
+                v1 = (((i3 <= v1) <= (a1[3][15] ? v0 : v2)) % 5);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                a0[3] = (((v3 >= 6) > (v1 > 48)) + ((a1[1][7] <= 23) + (a1[3][12] / 3)));
+                v0 = (((i5 < 35) * (v1 / 4)) % 4);
+                v2 = (((v3 ? 27 : 55) ? (i4 <= 11) : (i5 % 8)) > ((6 % 4) ? (i5 * i4) : (a0[6] >= v3)));
+            }
+            v1 = (((a1[0][10] && v3) < (v0 >= v1)) / 6);
+            v1 = (((v1 > 15) > (v1 > v1)) / 6);
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((a0[12] == v1) && (v2 && v1)) ? ((v0 >= a1[3][6]) > (a1[2][5] > 36)) : ((v0 != 82) % 5));
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        if ((v0 * a1[1][5]) > 96) break;
+        a1[3][11] = (((v3 > 61) / 1) != ((v1 % 6) * (i6 ? v2 : v3)));
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                a1[0][0] = (((66 / 8) == (v3 ? i6 : 69)) * ((a0[13] % 8) / 6));
+                a1[2][3] = (((43 || a1[2][6]) / 5) % 3);
+                a1[3][5] = (((v1 * a1[0][1]) ? (a0[0] == v1) : (i7 + a0[1])) && ((69 + a1[0][2]) > (i6 - v1)));
+                i7 = i7 + 1;
+            }
+        }
+        a0[15] = (((v2 < i6) > (v3 ? v3 : a1[0][13])) != ((59 + 6) && (a1[3][10] ? v1 : i6)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            a1[0][2] = (((v3 && a0[10]) == (a1[3][3] > v2)) - ((v0 && i8) * (v1 ? a0[3] : a1[2][15])));
+            v2 = (((a1[1][5] / 6) % 4) > ((v2 * v0) != (v2 == i8)));
+            {
+                int i9 = 0;
+                do {
+                    a0[3] = (((19 <= i9) % 5) >= ((a0[10] % 3) ? (41 / 2) : (66 % 5)));
+                    v2 = (((v3 ? 98 : v1) && (a0[10] * v3)) == ((a0[9] ? a0[5] : 34) / 5));
+                    v0 = (((i9 + 45) + (a0[7] >= a1[3][4])) >= ((44 ? a0[5] : a0[1]) <= (v0 < 46)));
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    v0 = (((91 < 91) / 3) ? ((67 <= 79) || (v2 != 91)) : ((v2 && a0[2]) % 2));
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        v1 = (((v1 != 63) - (87 && v3)) >= ((48 > 32) + (v1 + i10)));
+        {
+            int i11 = 0;
+            while (i11 < 3) {
+                v2 = (((a0[0] != v3) > (a0[5] == 2)) - ((27 ? v0 : a1[2][11]) % 6));
+                a1[0][10] = (((i10 >= 40) - (35 / 8)) > ((v0 && i11) * (v2 == a0[7])));
+                v0 = (((a0[3] ? a0[12] : v2) ? (i10 ? a0[12] : v1) : (12 ? i10 : i11)) || ((v1 <= i11) ? (a1[1][3] / 6) : (i10 * a0[3])));
+                i11 = i11 + 1;
+            }
+        }
+        v3 = (((16 == a0[4]) + (i10 - v1)) / 9);
+    }
+    return (((a0[3] / 1) < (v1 - v1)) / 7);
+}
+int f7() {
+    int v0 = 17;
+    int v1 = 72;
+    int v2 = 37;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        a1[2][2] = (((a1[3][7] % 1) != (a0[0] != 23)) < ((a1[2][12] || v2) || (i0 - v3)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                v3 = (((v3 % 6) ? (6 < 89) : (15 < i1)) * ((v3 <= v0) < (61 > v3)));
+                v0 = (((v0 || 83) != (a0[4] % 3)) && ((v1 != v3) && (v2 + a0[13])));
+                v3 = (((v2 * a1[3][3]) - (a1[0][3] <= i1)) % 8);
+                i1 = i1 + 1;
+            }
+        }
+        a1[3][13] = (((20 == a1[2][7]) >= (39 > v1)) * ((84 == v3) ? (v0 ? a1[2][0] : v3) : (77 >= 90)));
+    }
+    v1 = (((a1[0][0] && a0[4]) > (75 > a0[11])) * ((50 != v1) / 9));
+    a0[15] = (((v3 != v1) < (7 == v1)) - ((v3 / 9) * (3 - v3)));
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v0 = (((a1[1][4] && v0) != (9 == a1[1][0])) % 1);
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((v3 + v3) > 67) break;
+                a1[0][7] = (((68 ? 23 : a0[6]) ? (a0[1] || a0[2]) : (5 ? 64 : v0)) * ((v2 < a1[0][15]) + (47 == v2)));
+                v2 = (((i3 / 2) < (a0[7] + 47)) < ((v2 + a1[1][0]) < (v2 != 77)));
+                v3 = (((2 == i2) > (i3 || v3)) && ((v2 < 78) + (v3 < a0[14])));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((a0[2] * v1) - (a1[1][1] * v2)) > ((v2 == v2) && (v3 && v0)));
+    }
+    if ((((26 ? 57 : 23) ? (v1 * v2) : (a1[0][10] + a1[2][4])) * ((65 && 35) - (v1 && v2)))) {
+        v0 = (((a0[0] / 6) <= (a1[2][9] && v2)) / 6);
+        v1 = (((v1 || v1) && (12 && 8)) == ((v2 > a0[15]) * (a1[3][2] > 58)));
+        a0[13] = (((56 || v1) ? (a1[0][12] + a1[2][15]) : (a0[1] == a1[0][6])) < ((49 < v1) / 6));
+    } else {
+        v1 = (((v1 ? a0[4] : 68) ? (v3 == v0) : (v3 != 65)) > ((40 <= v2) < (v1 == 68)));
+        a0[14] = (((v1 > v2) == (v1 >= v2)) >= ((v2 && v2) != (57 < 18)));
+        v2 = (((18 > v3) && (v0 != v3)) < ((85 < v2) != (v1 + 58)));
+    }
+    a1[1][2] = (((62 >= a0[10]) <= (v0 + v0)) != ((v2 != v1) <= (38 + v2)));
+    v0 = (((v1 * v3) <= (a0[2] >= a0[2])) > ((92 ? 6 : v3) == (a1[2][11] ? a1[1][3] : v2)));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a0[6] = (((a0[7] < a0[4]) != (a0[10] && a0[5])) && ((v0 <= 31) ? (12 ? 36 : 68) : (43 < i5)));
+                    v1 = (((i5 >= a0[8]) * (v1 >= 65)) / 9);
+                    v2 = (((a1[2][6] / 7) > (v3 != a0[7])) + ((84 * a0[2]) <= (a0[5] && a1[3][1])));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a1[0][11] = (((20 > v3) - (v3 - a0[12])) >= ((87 || v3) ? (a1[0][5] != v1) : (v0 != 20)));
+            v1 = (((v1 > a0[15]) * (v0 ? 91 : v1)) ? ((a0[5] < v3) != (v3 >= 55)) : ((a0[7] || v1) + (v2 / 7)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v2 = (((a1[2][15] != a0[1]) || (67 <= 86)) > ((74 * 15) % 1));
+            v2 = (((91 + v3) <= (v3 != 66)) <= ((29 < i6) > (v1 + v2)));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((v2 % 4) > 85) break;
+                a1[2][5] = (((i6 || 23) == (v0 >= a0[13])) >= ((v3 > v1) ? (v1 < 56) : (a0[7] / 9)));
+                v1 = (((4 < v2) - (a0[15] ? 7 : i7)) % 9);
+                v1 = (((v1 / 1) - (i7 || 26)) ? ((i6 <= 59) ? (i7 <= v3) : (v1 && a0[9])) : ((a0[11] + v3) - (6 <= 18)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            for (int i9 = 0; i9 < 3; i9 = i9 + 1) {
+                v2 = (((i9 && i8) != (v3 < i9)) || ((a0[13] - 2) || (v0 ? 97 : i9)));
+                v3 = (((v1 + i8) - (v0 != a1[2][5])) == ((i9 / 2) == (v2 <= v1)));
+                a0[1] = (((a0[8] / 7) <= (v0 + v2)) || ((75 <= v3) / 3));
+            }
+            v3 = (((v2 == v2) && (32 - 49)) < ((a0[8] > a1[1][11]) / 6));
+            v0 = (((65 ? v3 : 56) ? (a0[7] < v0) : (a0[11] % 2)) % 9);
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    return (((a1[1][11] || a1[2][9]) * (12 >= 46)) < ((v1 != 6) > (95 * v3)));
+}
+int f8() {
+    int v0 = 25;
+    int v1 = 72;
+    int v2 = 23;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a1[3][12] = (((i0 != v1) >= (a1[2][5] <= 30)) % 1);
+                    a1[1][5] = (((a1[1][0] && v0) + (30 / 4)) < ((23 / 9) && (a1[3][0] || a0[10])));
+                    v2 = (((43 / 5) || (62 && a0[15])) != ((v0 <= a1[1][8]) || (i0 * i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[9] = (((a1[3][12] != 25) + (a1[1][13] % 8)) / 7);
+            a0[13] = (((a1[1][3] - v0) ? (v3 * 52) : (i0 >= v3)) < ((v1 || a0[0]) == (v0 ? 76 : 40)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v1 = (((a0[15] <= a1[0][9]) == (a1[2][2] % 3)) || ((v2 >= 23) ? (v1 - v2) : (19 || v1)));
+        v3 = (((a0[0] == v2) ? (a1[2][0] || v2) : (6 != a1[1][1])) <= ((a1[3][4] && a0[6]) && (v3 * a1[1][15])));
+        {
+            int i3 = 0;
+            do {
+                v1 = (((34 / 4) * (a0[7] ? i3 : a0[0])) ? ((a1[3][9] > v1) + (v3 < i2)) : ((v0 - i2) * (v1 + 7)));
+                a1[3][1] = (((66 / 1) != (v1 + 73)) < ((i2 / 4) > (81 + 57)));
+                v3 = (((a1[2][5] == a1[3][9]) ? (a0[5] ? i2 : i2) : (a0[9] >= a1[2][1])) ? ((v0 ? 81 : v3) + (91 >= i2)) : ((v1 ? v0 : a1[1][14]) > (i2 ? v1 : i2)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+    }
+    if ((((5 ? v3 : 63) == (58 == v1)) ? ((v3 || v2) ? (27 >= v1) : (v2 / 1)) : ((57 <= 22) < (a0[4] == a1[3][11])))) {
+        v1 = (((15 != 90) - (a0[14] % 8)) == ((9 != a1[3][14]) % 4));
+        v3 = (((a0[2] ? v3 : 38) < (32 < 93)) == ((a1[3][3] % 5) > (v3 ? a0[11] : v1)));
+        v2 = (((a1[2][9] ? v1 : 14) + (v1 * 62)) - ((v2 <= v0) != (v1 > v1)));
+    } else {
+        v0 = (((a1[3][15] + v3) > (a1[3][3] && a0[7])) - ((20 * v0) >= (10 % 2)));
+        a0[15] = (((a1[2][4] ? v2 : v2) / 8) || ((a0[8] - 79) / 8));
+        a0[14] = (((v1 ? v1 : v0) ? (49 <= v0) : (v3 == a0[12])) < ((v0 % 2) || (v2 != v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[3] = (((v1 || v2) && (v2 - i4)) <= ((v3 ? v1 : a1[1][15]) / 1));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((v0 / 9) > 72) break;
+                v1 = (((v0 <= a1[0][9]) != (0 && 69)) % 8);
+                v1 = (((9 / 3) <= (26 * v1)) < ((83 || v3) <= (i5 + 87)));
+                a1[3][13] = (((i4 < a1[2][12]) > (v2 == 78)) != ((40 > v1) >= (32 <= a1[3][0])));
+            }
+            v1 = (((v3 ? a0[11] : a0[9]) != (71 || v2)) != ((v1 > a0[15]) != (33 / 2)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    if ((((63 != 64) != (a0[10] > a1[3][13])) > ((a0[4] < a1[3][3]) >= (v0 ? v2 : 63)))) {
+        a1[0][1] = (((v0 || 44) ? (v3 != 11) : (v0 < v1)) / 4);
+        v1 = (((98 && v1) - (v3 ? 94 : a1[3][2])) ? ((92 ? 71 : v1) == (62 || v3)) : ((v0 < v0) >= (v2 <= 0)));
+        a1[1][14] = (((a0[5] < v3) + (v1 <= v1)) * ((a1[3][9] ? 20 : v2) + (v2 + v2)));
+    } else {
+        a0[13] = (((v2 || v3) / 4) % 2);
+        v0 = (((v0 < 81) % 5) >= ((a1[3][0] != 30) > (v1 != v0)));
+        a0[15] = (((0 == 63) != (v1 * a0[1])) && ((v3 * a0[9]) && (2 + a0[14])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((0 * v0) > 78) break;
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((i6 - 72) > 99) break;
+                v0 = (((12 + i7) > (a0[5] == v2)) + ((v2 < i7) || (28 > v0)));
+                v2 = (((v2 * v1) != (v1 * a1[1][15])) % 9);
+                v1 = (((v0 >= v0) > (i7 / 5)) < ((a0[1] || i6) ? (45 < 72) : (v1 && v2)));
+            }
+            v3 = (((a1[3][5] == a1[0][10]) == (48 * 88)) >= ((17 >= 39) != (v3 > 23)));
+            v1 = (((v1 >= a0[6]) % 2) ? ((a0[12] != v1) + (a0[6] <= a0[10])) : ((v1 == a0[11]) ? (10 >= v2) : (a1[0][9] / 2)));
+            i6 = i6 + 1;
+        }
+    }
+    a0[7] = (((v3 % 8) == (60 < 30)) >= ((v2 / 3) >= (a0[14] / 3)));
+    {
+        int i8 = 0;
+        do {
+            a0[15] = (((a1[3][11] != 65) % 1) == ((v2 > a1[0][7]) / 8));
+            v1 = (((63 % 2) - (a1[1][4] - v0)) * ((v3 >= v2) % 1));
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((v1 % 4) && (v0 % 7)) == ((a0[3] / 7) > (v0 <= v3)));
+                    v0 = (((i9 && i8) == (a1[1][4] + 38)) && ((a0[12] >= a0[13]) > (a1[3][11] / 9)));
+                    a0[5] = (((a0[5] - v2) < (i9 ? a0[14] : v3)) != ((v0 == 62) <= (55 != 16)));
+                    i9 = i9 + 1;
+                } while (i9 < 6);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    if ((((a0[4] == 42) || (v3 != v3)) > ((v2 + v2) == (93 >= 61)))) {
+        v3 = (((0 == v2) != (11 && v1)) ? ((75 != v1) % 1) : ((v0 ? a1[1][12] : a0[6]) < (a0[4] * v2)));
+        a1[3][0] = (((v1 ? v3 : v1) < (v2 || v0)) >= ((a1[1][7] == 31) - (v1 * v1)));
+        v0 = (((v1 && a0[15]) ? (89 || a1[1][8]) : (v1 && a1[3][9])) && ((v3 + 58) && (a0[6] + a0[14])));
+    } else {
+        v3 = (((v0 * v0) - (v3 <= 93)) >= ((a1[0][7] ? v2 : v3) != (37 <= v3)));
+        v0 = (((36 + 0) - (v1 % 5)) < ((v0 < v0) < (a1[3][11] > a0[2])));
+        v1 = (((v3 - v2) + (a0[9] > a1[2][11])) * ((a1[1][3] - a0[3]) <= (v1 / 7)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            if ((40 || i10) > 80) break;
+            v1 = (((v1 ? 98 : a1[3][14]) > (a0[0] * a0[2])) % 2);
+            {
+                int i11 = 0;
+                while (i11 < 6) {
+                    v2 = (((20 % 1) || (v3 + a1[2][12])) + ((v3 - a1[3][4]) == (v0 >= v2)));
+                    a0[11] = (((a1[2][10] * 39) != (i10 ? a1[0][7] : v2)) == ((a0[15] != 27) == (a0[3] >= i10)));
+                    a0[14] = (((v1 != a1[2][0]) ? (i10 ? a0[8] : i11) : (a0[11] * 77)) || ((v0 <= a0[7]) * (v2 && a0[9])));
+                    i11 = i11 + 1;
+                }
+            }
+            a0[11] = (((i10 <= a1[1][10]) ? (i10 ? a1[3][2] : v0) : (a1[3][4] + v2)) == ((v3 == v3) < (a0[11] >= v1)));
+            i10 = i10 + 1;
+        }
+    }
+    return (((v2 ? v0 : v0) == (v0 * v0)) && ((a1[1][15] * 84) > (v2 + a0[5])));
+}
+int f9() {
+    int v0 = 68;
+    int v1 = 25;
+    int v2 = 65;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 < v0) == (v3 != v0)) >= ((a0[3] == a0[14]) / 5));
+    v1 = (((a0[13] % 2) || (25 + v1)) && ((v2 >= a0[1]) != (v3 >= v3)));
+    a0[14] = (((v3 != a1[1][4]) == (v1 > v0)) > ((v3 || v3) != (v2 >= v3)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((36 * a1[3][12]) > 67) break;
+        {
+            int i1 = 0;
+            do {
+                a1[3][2] = (((81 >= a1[2][8]) < (i0 >= a0[12])) || ((65 - v1) ? (a0[0] >= 74) : (v3 ? i1 : i1)));
+                a1[3][11] = (((58 <= v2) && (52 % 8)) ? ((i1 > 66) && (v1 || v0)) : ((v0 + i0) >= (v1 / 9)));
+                v2 = (((a1[0][5] > 9) || (a1[2][7] - a1[1][3])) * ((i1 * v2) ? (84 < a0[3]) : (v0 ? v1 : a0[1])));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v3 = (((v2 % 7) * (94 / 1)) - ((v1 <= 78) < (62 < v0)));
+        a0[7] = (((a0[0] % 5) != (v3 / 5)) == ((v2 + 67) + (a0[2] + a0[1])));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a0[12] = (((a0[1] <= i3) < (v2 > 0)) >= ((a0[4] % 9) > (v1 != a1[2][14])));
+                v0 = (((63 <= v3) + (v3 + v1)) < ((68 <= v1) ? (v0 * v2) : (14 ? a0[15] : i2)));
+                a1[3][7] = (((33 - v2) && (i2 ? a1[1][3] : i2)) - ((i2 < v0) ? (v1 * v1) : (i2 % 9)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        v0 = (((65 % 3) < (a0[15] / 9)) % 1);
+        v1 = (((a1[1][13] < i2) != (v0 ? i2 : v3)) / 2);
+    }
+    v2 = (((a1[3][12] != v2) == (v2 ? v0 : v0)) >= ((v0 != v0) ? (v1 == v0) : (v2 - 84)));
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((v0 + 63) <= (a1[0][8] <= i4)) || ((27 % 3) >= (v1 != 80)));
+        a0[15] = (((i4 < a1[1][1]) / 4) != ((v2 || a0[7]) < (14 != i4)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((v3 * 1) + (a0[13] ? v0 : i5)) + ((75 > i5) <= (42 ? i5 : 61)));
+                v3 = (((i5 != a1[2][11]) * (15 * 55)) - ((i5 <= i4) <= (a1[0][15] % 4)));
+                v0 = (((v2 % 7) > (a1[2][9] % 3)) < ((46 && a1[3][7]) > (a1[0][5] ? v0 : i4)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+    }
+    if ((((v3 >= a1[0][13]) ? (71 + v3) : (v1 ? 24 : v3)) - ((a0[1] != a0[1]) ? (73 ? a0[4] : 89) : (41 ? 87 : a1[0][3])))) {
+        a1[0][6] = (((62 == a0[2]) % 7) && ((v3 ? 17 : a0[6]) != (a1[1][10] / 6)));
+        v0 = (((87 ? a1[3][5] : v0) > (32 || v2)) && ((a0[3] / 4) + (a1[3][14] ? a0[2] : v1)));
+        v2 = (((v0 ? 28 : a1[2][13]) ? (v3 < 39) : (v2 != v1)) <= ((a0[13] >= v3) - (v0 * 99)));
+    } else {
+        a0[13] = (((v3 * v0) ? (v0 ? v1 : a0[1]) : (v1 == a1[1][5])) ? ((a1[2][9] > v2) >= (a1[3][4] || a1[2][5])) : ((88 == 88) ? (a0[6] <= v1) : (v2 - v3)));
+        a1[1][0] = (((81 * a0[6]) * (a1[3][2] || 55)) <= ((v1 || v2) ? (a1[1][0] + a1[3][0]) : (v3 / 1)));
+        v2 = (((v3 - 26) > (v2 <= a1[1][5])) <= ((81 % 5) && (3 == v0)));
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v0 = (((68 * v2) == (i6 * 38)) % 1);
+                a1[0][6] = (((v1 > a1[3][0]) - (a0[5] + v3)) < ((v1 <= v1) == (a1[1][15] || a0[12])));
+                a0[15] = (((79 <= a1[2][14]) ? (a1[0][11] >= a1[1][8]) : (v0 * v0)) || ((v3 <= v1) >= (v3 && a0[2])));
+            }
+            v3 = (((a1[3][3] / 1) ? (37 && a1[0][4]) : (v3 != v1)) || ((a1[1][12] || v0) != (v1 + v1)));
+            v0 = (((v2 - v2) % 5) == ((v0 != v0) ? (a1[2][8] && a1[0][12]) : (v1 || v2)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    if ((((v3 + a1[2][8]) / 5) == ((a1[3][2] + 61) && (a1[0][8] == v1)))) {
+        a1[1][10] = (((v2 ? 86 : v2) * (36 + a1[3][9])) - ((51 >= a0[13]) - (a1[3][7] ? a1[1][7] : a1[0][2])));
+        v1 = (((v0 * v3) > (v0 ? v3 : a1[2][11])) - ((v1 ? a0[13] : v0) * (v2 * a0[13])));
+        a1[2][1] = (((63 - 53) <= (v1 + a1[3][9])) + ((v1 ? 20 : v0) * (v1 >= 90)));
+    } else {
+        a0[15] = (((7 || a0[4]) && (a1[0][3] || a1[2][9])) < ((v2 != v3) ? (40 && a0[5]) : (v0 * v2)));
+        a1[3][9] = (((58 != v1) == (v1 - 99)) - ((v1 > a1[1][11]) - (v0 * v0)));
+        v3 = (((a1[2][7] ? v0 : a0[4]) != (v3 - v2)) ? ((a0[8] < 9) + (v1 < v1)) : ((84 + v2) == (v1 - 29)));
+    }
+    return (((a1[0][1] != v0) ? (a0[11] ? v1 : v0) : (44 + v3)) < ((a0[14] <= a1[0][5]) ? (75 - 79) : (36 < 33)));
+}
+int f10() {
+    int v0 = 6;
+    int v1 = 46;
+    int v2 = 22;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 && v3) < (a1[0][0] && v3)) != ((50 >= v1) % 7))) {
+        v2 = (((a0[14] >= v3) ? (94 || v1) : (v1 ? a1[2][6] : a0[12])) - ((v2 % 3) / 5));
+        v1 = (((47 + a1[2][7]) / 9) <= ((v3 < v2) <= (v2 < a1[1][3])));
+        v2 = (((v0 > v3) ? (v1 % 9) : (28 >= v2)) != ((a1[3][5] || a0[1]) <= (41 == a0[13])));
+    } else {
+        a0[1] = (((v1 || v3) != (v0 || v3)) ? ((v1 + 16) * (a1[2][6] != v3)) : ((48 == 43) <= (14 < 57)));
+        a1[3][1] = (((v2 < 64) == (v2 > a1[3][9])) != ((9 % 3) * (v3 < v1)));
+        v1 = (((a0[6] % 3) != (50 * v1)) + ((v0 / 6) * (v2 - 83)));
+    }
+    v1 = (((76 && 14) > (v1 >= a0[7])) - ((v3 == v3) - (99 < v2)));
+    a0[5] = (((v3 / 8) >= (v0 || v2)) < ((v1 * a0[2]) && (a0[13] / 8)));
+    if ((((a1[3][12] % 7) != (27 % 3)) <= ((a1[1][1] > 85) && (23 < 15)))) {
+        v3 = (((v1 % 9) <= (80 > a0[10])) || ((v0 / 8) ? (76 % 4) : (v1 && v3)));
+        v0 = (((a0[12] == v3) ? (v3 - 7) : (v3 - a1[2][7])) == ((35 && v3) % 8));
+        v0 = (((v3 < 59) && (3 >= a1[2][5])) % 7);
+    } else {
+        a1[3][0] = (((a0[6] / 3) ? (34 && a0[12]) : (v1 ? v1 : v1)) > ((v2 - 21) * (a1[3][9] * v3)));
+        a0[15] = (((a0[11] || a1[3][4]) + (a0[15] != a0[14])) % 5);
+        a0[12] = (((v1 - 52) * (v2 + v2)) % 1);
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a0[7] = (((a0[15] ? 70 : a1[0][9]) < (v3 == 82)) - ((v3 == v2) * (i1 && i0)));
+            a0[12] = (((v0 || v1) || (90 < v0)) ? ((i1 % 3) > (32 ? v3 : v0)) : ((40 && i0) < (i1 < v3)));
+            v1 = (((81 < a0[14]) && (v3 && 20)) != ((i0 / 2) < (47 > v1)));
+        }
+        v1 = (((a0[0] * v1) <= (v3 != v1)) || ((a0[3] - a1[1][8]) - (a1[3][11] != a0[11])));
+        v3 = (((v2 > a0[3]) ? (a0[2] != 79) : (32 && v0)) ? ((86 ? v0 : 66) + (a0[0] % 9)) : ((i0 || i0) || (v0 + v3)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((a1[2][6] >= i2) ? (75 ? a1[0][11] : a0[4]) : (a0[1] / 3)) == ((a0[8] != v1) <= (a0[10] > v0)));
+        v2 = (((v1 && v1) != (a1[3][4] > v2)) % 2);
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v2 = (((a0[5] <= a1[2][2]) || (25 - 41)) ? ((v0 < 99) || (72 > a1[3][9])) : ((i3 ? v1 : v1) == (v2 % 9)));
+                v2 = (((v0 ? a0[1] : a1[2][14]) ? (a0[10] ? v2 : a1[3][14]) : (20 ? a1[3][15] : 61)) || ((i3 != v0) % 3));
+                a1[3][9] = (((v0 + i2) * (a0[6] >= v0)) / 5);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[2][10] = (((95 != i4) && (v2 * 91)) && ((v1 + v3) < (v2 > 65)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    if ((v2 + 59) > 66) break;
+                    v3 = (((v0 ? v3 : 30) > (i4 && i4)) || ((a0[14] == 82) * (67 <= v2)));
+                    v0 = (((96 == a0[15]) ? (81 % 1) : (v0 + v1)) <= ((a1[3][7] ? v0 : a0[9]) >= (v0 <= v2)));
+                    v0 = (((v3 ? 21 : a1[1][5]) >= (v3 * v2)) / 3);
+                    i5 = i5 + 1;
+                }
+            }
+            a1[0][11] = (((v1 % 8) <= (a0[6] * a0[14])) || ((a1[1][6] >= v0) * (v1 ? 1 : 99)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            a0[5] = (((i6 ? a0[3] : a0[11]) || (v1 ? a1[0][8] : 65)) % 3);
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                a0[1] = (((v2 ? i7 : a1[3][12]) - (v2 - 74)) < ((a1[2][15] <= 55) / 3));
+                v1 = (((a1[2][0] * a1[0][12]) * (v0 ? v0 : v0)) - ((80 ? v0 : a1[0][1]) / 7));
+                a1[0][6] = (((i6 && a1[1][10]) <= (v0 ? v0 : v0)) && ((a1[3][1] * a0[9]) == (v0 >= a0[14])));
+            }
+            a0[3] = (((12 != 21) || (a0[9] ? a1[1][8] : 52)) <= ((v0 >= i6) > (v1 || v1)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            a0[6] = (((a0[6] + v3) <= (a0[1] > 7)) >= ((92 >= v3) / 2));
+            for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+                v3 = (((v1 != v2) > (i8 < i8)) <= ((v3 ? 77 : i9) ? (11 % 1) : (6 >= a0[4])));
+                a0[0] = (((v3 < v1) % 9) / 5);
+                v0 = (((a0[3] && a0[5]) > (a0[3] < 95)) ? ((1 > i9) % 1) : ((46 >= v2) || (i9 >= a0[9])));
+            }
+            v0 = (((28 ? v0 : v3) != (24 >= a1[3][1])) < ((v2 * a1[2][1]) || (97 > a1[3][5])));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v0 >= v3) != (a1[1][1] <= a0[4])) < ((v1 <= 5) - (v0 && a0[4])))) {
+        v3 = (((86 || v2) < (v0 == v3)) % 1);
+        a0[2] = (((v1 / 9) >= (v0 != 48)) ? ((a0[0] < v3) >= (69 <= 26)) : ((v3 * 45) ? (a1[1][15] <= v2) : (v2 > v2)));
+        v2 = (((v2 ? v0 : a0[4]) ? (v1 % 1) : (v1 * v1)) / 8);
+    } else {
+        v0 = (((v3 != a1[2][15]) / 8) * ((a0[10] / 3) <= (v0 % 5)));
+        a1[2][3] = (((v1 || v1) || (87 > 17)) + ((a0[3] ? 12 : v3) - (44 ? a0[7] : 97)));
+        a1[0][8] = (((v3 ? 6 : 15) % 9) - ((v2 - 66) + (v2 != v0)));
+    }
+    return (((a1[1][4] - 87) && (v2 + v0)) && ((v1 * a0[8]) >= (21 < 40)));
+}
+int f11() {
+    int v0 = 54;
+    int v1 = 63;
+    int v2 = 18;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[5] != v0) + (v2 + 73)) - ((79 / 6) ? (v2 == v2) : (0 % 4)))) {
+        v1 = (((v0 == a1[3][7]) >= (a1[1][12] != v3)) / 7);
+        v2 = (((a0[7] != a1[0][13]) == (37 / 2)) >= ((v1 - 42) / 8));
+        v3 = (((v1 * v3) ? (v2 ? v2 : v2) : (v1 ? a0[2] : a1[2][3])) ? ((38 + v1) < (v3 <= 93)) : ((v1 > v0) && (v2 - a1[1][7])));
+    } else {
+        v3 = (((56 && 93) > (a1[3][11] < v2)) - ((v0 - v3) || (v2 == v2)));
+        v3 = (((36 / 7) && (82 ? 88 : a1[0][9])) - ((55 - v1) != (a1[1][0] ? v2 : v1)));
+        v1 = (((40 ? a1[1][10] : a1[1][0]) - (v0 % 9)) ? ((0 >= v3) || (v1 >= 52)) : ((v0 < v2) && (v3 && v0)));
+    }
+    if ((((a1[2][9] / 7) * (18 + v2)) < ((17 == 20) && (v3 > 4)))) {
+        a0[4] = (((a1[3][10] - 77) >= (67 / 9)) - ((v0 != v1) < (10 || a1[1][4])));
+        v0 = (((v0 / 5) >= (v1 % 5)) / 1);
+        v2 = (((v2 % 9) >= (v3 + v0)) && ((a0[15] <= a0[12]) || (a0[10] / 7)));
+    } else {
+        v3 = (((v2 > 62) < (a1[2][2] ? 43 : 18)) < ((v1 >= v3) % 1));
+        v2 = (((v3 + v0) ? (54 + v1) : (84 != 25)) ? ((v0 == v3) || (92 <= a0[6])) : ((0 > a0[15]) - (v0 / 3)));
+        v0 = (((v1 + v0) || (a1[3][3] + a1[2][2])) != ((a0[2] > v3) == (90 <= a0[8])));
+    }
+    if ((((v1 % 2) >= (45 ? v2 : v0)) / 6)) {
+        v1 = (((a1[3][5] >= a1[1][13]) ? (v1 * v2) : (a1[1][15] != a1[2][4])) > ((a0[2] - a1[0][12]) % 7));
+        v3 = (((84 || 73) % 3) || ((v0 + v3) == (v0 >= 98)));
+        v3 = (((a1[3][11] * v3) - (v2 > a0[4])) / 3);
+    } else {
+        v1 = (((25 * v2) + (44 == a1[2][15])) < ((50 > v3) || (67 % 9)));
+        v2 = (((68 + v2) && (v0 / 7)) && ((v2 == v1) >= (v3 <= v1)));
+        v3 = (((25 * a1[1][14]) && (v1 - v2)) != ((v3 == v3) > (13 < a0[7])));
+    }
+    v0 = (((v1 || v2) * (v2 + a0[6])) * ((v1 ? v0 : 10) > (52 && v0)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a0[12] = (((38 != i0) / 6) + ((v3 + 56) > (74 > 31)));
+                a1[1][1] = (((31 > a1[3][5]) + (a1[1][4] * 19)) ? ((v2 && 93) != (i0 <= v2)) : ((i1 >= v2) <= (v3 || 64)));
+                v0 = (((v1 - i1) < (i1 != v2)) * ((v0 == v2) != (34 ? v0 : 41)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        a1[2][12] = (((a1[2][1] * v0) ? (v2 ? 11 : i0) : (a0[6] && v0)) + ((23 - v0) < (v2 >= a1[1][1])));
+        a0[1] = (((v3 - v3) != (i0 / 3)) && ((38 ? 99 : 87) ? (a1[0][6] != 83) : (v1 * v0)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v3 = (((a1[2][1] != 64) + (19 != 1)) ? ((a0[6] / 6) < (v2 + a0[11])) : ((i2 + a1[1][2]) && (v1 / 6)));
+        v3 = (((a0[8] + i2) > (39 <= v1)) < ((a0[1] >= v0) - (a1[2][15] ? a0[15] : a1[0][9])));
+        {
+            int i3 = 0;
+            do {
+                a1[1][2] = (((a1[3][1] % 4) - (16 ? v3 : a1[3][15])) / 2);
+                v2 = (((a0[4] + 8) ? (i3 >= v1) : (i3 < 38)) ? ((v2 || v3) && (a0[1] && i3)) : ((a0[5] != 52) > (v3 && a0[1])));
+                a0[3] = (((92 <= 61) ? (v0 < 59) : (6 + 86)) % 8);
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a1[2][2] = (((23 || a1[1][11]) != (a1[2][0] ? 39 : 64)) / 2);
+        a0[15] = (((53 < v3) + (a0[4] % 5)) * ((v2 < a1[0][15]) > (73 || a0[10])));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v2 = (((i4 || v2) - (a0[8] >= v3)) < ((v0 == 16) != (v0 > a0[3])));
+            v1 = (((a0[4] == a0[11]) + (v2 >= 31)) + ((72 ? 15 : v3) <= (a0[8] * v2)));
+            a1[2][1] = (((59 <= v1) || (i4 && v0)) > ((v2 / 4) >= (22 >= a0[9])));
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((a1[2][7] / 9) != (11 > v1)) + ((17 ? 34 : a0[8]) < (a1[3][0] == v2)));
+            {
+                int i7 = 0;
+                do {
+                    a0[2] = (((80 == v3) ? (a0[5] ? 57 : v2) : (i7 && i6)) != ((a1[0][1] == a1[1][2]) < (a1[0][5] + a0[1])));
+                    a0[11] = (((v0 == i6) * (v1 % 5)) > ((a0[14] * a1[3][8]) + (v3 ? a1[3][4] : i6)));
+                    v0 = (((v0 >= v3) % 1) != ((a1[0][3] % 7) + (i7 ? v0 : v2)));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            v2 = (((44 <= v0) * (v1 || v0)) >= ((v2 > 30) <= (a0[7] && v3)));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((v0 ? a1[2][13] : v2) > 77) break;
+            for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+                v1 = (((v1 + v2) && (a1[1][8] ? 77 : v3)) / 9);
+                v3 = (((58 - v1) != (v2 || 6)) <= ((i9 ? a0[7] : i8) == (v1 % 4)));
+                v3 = (((i9 <= i8) > (v3 % 7)) * ((i9 ? a0[0] : v2) ? (38 + v1) : (v2 != i8)));
+            }
+            v3 = (((a0[15] < a0[14]) && (v1 <= i8)) || ((26 >= v0) + (a1[2][8] - v2)));
+            v2 = (((65 % 8) || (a0[6] > i8)) == ((67 % 5) <= (v0 ? a1[3][15] : v0)));
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((9 + 63) > 66) break;
+            v0 = (((72 * 99) <= (v2 || a1[0][7])) / 1);
+            v2 = (((i10 + i10) || (87 < v0)) * ((a0[10] % 7) > (a1[3][11] / 7)));
+            for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+                a0[15] = (((a1[0][8] - 67) < (v0 % 6)) < ((v1 <= a1[3][11]) && (v3 >= a0[11])));
+                v2 = (((a1[0][8] && a1[1][6]) != (70 > a1[2][15])) <= ((i10 ? 11 : a1[0][6]) % 6));
+                v3 = (((v0 && a0[2]) ? (35 == i11) : (a1[2][2] % 5)) == ((v2 <= a1[2][2]) <= (v3 ? i11 : a1[2][3])));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 5);
+    }
+    return (((31 || v1) ? (4 && 10) : (34 - v0)) > ((v1 + a1[3][3]) > (v1 > v3)));
+}
+int f12() {
+    int v0 = 71;
+    int v1 = 37;
+    int v2 = 89;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                a1[2][10] = (((a1[3][13] <= 76) * (60 / 7)) % 6);
+                v0 = (((a0[13] - 56) <= (v1 / 9)) >= ((27 >= v0) >= (a1[3][12] ? i1 : 98)));
+                v2 = (((v0 >= v1) + (1 >= v0)) ? ((v1 * v3) < (a0[14] >= a0[4])) : ((v3 / 9) == (a0[15] != a1[0][12])));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((24 >= 41) < (v0 > a0[10])) / 7);
+        v2 = (((v3 >= v1) < (v3 % 6)) == ((a1[0][11] < 49) || (v2 != 93)));
+    }
+    if ((((a0[4] + v3) * (v2 - v1)) <= ((27 ? v1 : 47) == (v0 != 5)))) {
+        a0[1] = (((66 == v2) <= (v3 && v0)) && ((24 / 3) < (v3 + a0[4])));
+        a1[1][9] = (((v1 % 1) % 3) / 4);
+        a1[0][1] = (((9 || 83) ? (a1[2][6] || v2) : (60 == 8)) + ((v2 + v1) % 5));
+    } else {
+        a0[15] = (((5 <= v1) == (v3 >= a1[0][7])) ? ((v1 > v2) >= (v0 != v1)) : ((a1[3][6] != a1[2][13]) ? (a0[1] - v3) : (a0[15] < a0[13])));
+        a0[1] = (((v0 == v1) != (v1 == v1)) / 6);
+        a0[6] = (((29 < v1) && (a0[14] + a0[1])) > ((a1[2][3] > 36) > (v0 % 7)));
+    }
+    v3 = (((a1[0][0] <= 49) - (v2 >= v3)) && ((29 + v2) ? (v1 + v1) : (v1 + v3)));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    a0[7] = (((i2 > a0[13]) % 4) >= ((36 < v3) && (41 < 1)));
+                    a0[13] = (((a0[14] >= 20) > (a0[1] ? v0 : a0[3])) / 9);
+                    a0[15] = (((a0[11] < 15) ? (73 >= i2) : (i2 < 85)) / 8);
+                    i3 = i3 + 1;
+                }
+            }
+            a0[13] = (((78 != v2) != (a1[3][11] <= v0)) || ((a1[3][4] != a1[2][14]) != (v0 < 76)));
+            a0[11] = (((i2 * 93) + (a1[3][4] == a0[9])) <= ((i2 ? 68 : v3) <= (i2 - 0)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((a0[2] * v3) < (v1 && 39)) || ((a0[2] > 43) * (a1[3][4] - 99)))) {
+        v0 = (((17 && v0) <= (v1 ? v2 : 93)) % 4);
+        v2 = (((v3 > 84) != (v3 / 5)) / 7);
+        a0[5] = (((5 - v3) % 7) != ((v2 % 8) > (v1 && v3)));
+    } else {
+        v1 = (((v3 / 2) ? (v0 * v2) : (a1[0][8] == v0)) != ((62 * a1[3][0]) ? (v2 <= 89) : (v3 - 47)));
+        v1 = (((a0[15] ? a0[9] : v0) + (v2 || v3)) / 7);
+        v0 = (((v1 != a1[2][9]) ? (v3 / 2) : (v3 || v0)) == ((a0[1] ? v1 : v0) + (39 - v3)));
+    }
+    if ((((v3 / 7) && (a0[11] >= v0)) - ((a1[3][15] * v3) != (v2 < 34)))) {
+        v1 = (((v2 != v0) - (a1[2][6] == v3)) / 8);
+        v3 = (((v3 ? v1 : v1) && (v2 + a0[0])) / 2);
+        v0 = (((v1 * 39) <= (a0[4] ? v1 : v3)) * ((v3 == a0[2]) / 1));
+    } else {
+        v3 = (((51 < v1) || (v1 % 3)) % 9);
+        v3 = (((a1[3][12] && v0) <= (v0 * v0)) ? ((v2 > v1) ? (v3 * a0[15]) : (93 ? 99 : 96)) : ((30 - 42) ? (v1 - v3) : (a0[12] > v0)));
+        v0 = (((a0[1] && v2) % 8) < ((96 / 7) + (a0[0] % 8)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((39 ? v3 : 9) > 50) break;
+        a1[1][12] = (((v3 == i4) - (a1[2][3] / 8)) + ((v1 && v0) * (v1 != a0[7])));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((68 > i4) <= (i4 && 60)) != ((97 < 48) == (a0[1] / 6)));
+                v1 = (((35 + 46) > (v0 >= v2)) > ((83 && a0[8]) && (v0 % 1)));
+                v2 = (((v2 || i4) || (i5 ? v2 : a0[3])) <= ((a0[0] && 66) != (57 != v2)));
+                i5 = i5 + 1;
+            } while (i5 < 2);
+        }
+        v0 = (((i4 / 4) <= (a1[0][11] == i4)) || ((a1[2][8] % 8) - (97 ? v3 : 1)));
+    }
+    if ((((18 == v2) || (24 / 9)) >= ((a1[3][4] || v0) != (71 ? a0[12] : a0[2])))) {
+        a1[3][8] = (((v2 < v1) > (v1 > a0[1])) >= ((91 * 38) ? (v2 ? v3 : v3) : (v3 != a0[4])));
+        a0[11] = (((a1[3][12] + v2) > (v0 ? v3 : a1[2][1])) && ((61 < a0[13]) == (a0[6] >= v1)));
+        a0[15] = (((97 <= v1) == (v0 <= 1)) > ((v2 && v1) * (v0 + 96)));
+    } else {
+        v3 = (((a1[3][6] <= v3) - (v1 * a1[1][14])) != ((v0 <= v2) && (32 % 3)));
+        v0 = (((98 - 44) && (a0[10] * v0)) * ((84 == v3) >= (v1 >= v2)));
+        v1 = (((v2 != v2) == (v3 != v0)) && ((v1 + a0[2]) <= (v0 == v0)));
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                v0 = (((45 ? a0[2] : 98) - (68 < v0)) == ((v3 ? v2 : v3) ? (39 * a0[3]) : (v3 || a1[1][15])));
+                v1 = (((96 || a0[12]) && (97 % 3)) ? ((1 < v2) ? (v2 <= a0[12]) : (a1[1][10] != a1[3][4])) : ((92 == 99) * (a0[10] - a1[3][0])));
+                v1 = (((a0[15] - i7) ? (6 * v0) : (i6 < v3)) <= ((i6 >= 85) == (87 || a1[0][10])));
+            }
+            a1[3][6] = (((v0 - 62) || (a1[3][1] >= v3)) == ((80 - a1[1][11]) && (v2 ? a0[0] : v3)));
+            v1 = (((a0[14] + v0) ? (v1 % 1) : (v1 || i6)) || ((v3 >= a0[11]) >= (i6 == v0)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[1][5] = (((i8 == 43) != (43 < v0)) < ((a1[2][13] == v3) > (9 / 4)));
+            v1 = (((v1 <= 76) % 5) >= ((a0[14] * v0) * (32 && v0)));
+            {
+                int i9 = 0;
+                do {
+                    a0[7] = (((9 != v1) + (29 + i8)) && ((1 || 47) * (v0 ? a1[1][15] : 98)));
+                    a1[1][12] = (((a0[9] != 17) > (i8 + a0[7])) ? ((i9 >= 83) * (24 + v1)) : ((a0[2] != a1[3][5]) + (23 < i9)));
+                    v3 = (((v2 && v2) < (i9 == a0[15])) % 1);
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    return (((99 * v1) < (v0 == v2)) + ((v3 - a1[0][2]) == (a1[2][3] / 6)));
+}
+int f13() {
+    int v0 = 94;
+    int v1 = 8;
+    int v2 = 77;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a1[2][9] = (((v2 % 6) - (v1 != a1[2][10])) || ((v3 > v2) && (70 != v3)));
+            v0 = (((a1[1][8] % 9) ? (a0[1] - v1) : (42 % 5)) / 8);
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v0 >= 56) != (a0[6] == v0)) != ((v2 && i0) / 5));
+                    v2 = (((v0 + 56) % 6) ? ((a0[10] < v3) % 2) : ((a1[0][15] - v1) ? (v2 * a0[13]) : (63 > 90)));
+                    v0 = (((a0[14] && 67) >= (v0 && v1)) ? ((75 ? v1 : v0) * (v1 / 8)) : ((a1[1][7] ? i1 : 5) ? (38 / 7) : (i1 < a1[3][5])));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v0 = (((90 + v1) * (a0[2] <= 73)) <= ((a1[3][12] + v1) >= (i2 > v1)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v3 = (((v0 ? v3 : i3) ? (a1[3][3] == 32) : (v2 != a0[12])) && ((v1 == 16) != (a1[3][13] ? 70 : 46)));
+            v0 = (((1 % 7) == (v2 > 50)) >= ((i2 ? a1[0][11] : a1[3][5]) / 8));
+            v3 = (((44 && i3) != (v0 ? i3 : i3)) || ((v2 >= v2) + (a1[2][11] ? v2 : v0)));
+        }
+        a1[2][9] = (((17 - a1[0][12]) != (98 / 4)) <= ((i2 && v2) <= (a0[2] == v2)));
+    }
+    v2 = (((v0 >= 38) / 7) && ((v0 == 84) / 8));
+    v2 = (((v1 <= 73) >= (v3 % 5)) < ((v3 != a0[1]) <= (30 >= a0[9])));
+    if ((((a0[1] && a1[3][5]) <= (v2 ? v3 : 95)) >= ((1 - v2) % 3))) {
+        a0[15] = (((a0[12] > 1) == (v0 || a1[0][5])) + ((v3 ? v1 : v0) ? (v1 > a0[1]) : (v1 < v2)));
+        v3 = (((v1 || v1) / 3) <= ((v0 >= v2) / 8));
+        v1 = (((v3 + v0) <= (a1[2][13] && v1)) || ((v1 / 9) >= (a0[2] - v0)));
+    } else {
+        v2 = (((a1[0][0] || v3) * (a0[3] >= 98)) ? ((v1 / 5) - (v2 ? 20 : v3)) : ((5 >= v2) + (v1 > 12)));
+        a1[0][9] = (((a1[0][9] % 8) <= (a1[1][0] / 2)) || ((53 / 2) == (a1[1][9] * v2)));
+        a0[0] = (((14 < 49) || (26 / 9)) + ((v2 + v0) / 8));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        a0[2] = (((v0 != v0) < (v0 / 1)) == ((v2 ? v0 : a0[3]) * (54 < a0[13])));
+        {
+            int i5 = 0;
+            do {
+                if ((51 % 9) > 83) break;
+                v2 = (((a1[1][9] - v3) ? (i5 == v2) : (1 ? a1[3][15] : i4)) + ((a0[9] * 99) - (a1[1][2] < a0[0])));
+                a0[2] = (((a0[9] >= a0[3]) <= (59 < i5)) > ((v1 <= v2) != (73 + a0[14])));
+                v2 = (((v2 / 3) / 6) <= ((i5 == v3) != (v1 + i4)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        v0 = (((v0 <= a1[2][5]) % 5) ? ((a0[13] * v2) == (24 > a0[9])) : ((93 + 90) <= (8 >= a1[3][2])));
+    }
+    v2 = (((v3 % 5) + (v1 + a1[2][10])) + ((a1[0][15] > v0) <= (v1 < v1)));
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((a0[14] ? v0 : 81) > 81) break;
+            v3 = (((v2 < v0) < (v0 ? v0 : a1[2][9])) - ((51 / 5) ? (v2 >= a1[1][3]) : (a1[2][4] > v1)));
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((i6 == a0[11]) != (i7 || a0[10])) || ((a1[1][10] < v3) == (i7 / 9)));
+                    v3 = (((v2 - i7) || (i7 <= 92)) ? ((v1 % 9) / 8) : ((31 && a1[3][8]) == (v0 % 2)));
+                    v2 = (((a0[11] != a1[1][2]) + (57 && a0[14])) != ((i6 / 9) * (i7 >= v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            a0[8] = (((a1[3][8] != 91) % 5) * ((77 < i6) != (53 ? v0 : v0)));
+            i6 = i6 + 1;
+        }
+    }
+    a1[1][0] = (((v0 >= 38) < (v2 >= v2)) - ((v0 ? v3 : v1) > (v2 == v1)));
+    if ((((v1 <= 49) % 1) + ((a0[15] / 1) <= (a0[2] && 61)))) {
+        v0 = (((v3 < 92) ? (v0 ? v1 : 59) : (a0[4] % 5)) >= ((v2 <= v1) <= (v2 || a0[8])));
+        v3 = (((v3 != v2) * (56 - v1)) / 6);
+        v0 = (((v0 - 44) / 8) >= ((5 >= a1[3][3]) ? (v0 + 60) : (96 >= v1)));
+    } else {
+        a1[3][15] = (((v3 >= v1) < (v2 ? v3 : v0)) && ((v3 ? v1 : a0[6]) > (a0[11] < v1)));
+        v2 = (((a0[1] % 4) <= (v0 > a1[2][7])) != ((v0 ? 25 : v3) == (v0 || 68)));
+        v0 = (((v0 > a0[14]) > (a1[1][13] != v3)) ? ((70 < 51) || (a1[0][10] - v0)) : ((a1[0][12] <= v0) + (a0[3] ? a1[2][9] : 96)));
+    }
+    return (((26 - v2) * (v0 ? v2 : v3)) && ((a1[2][7] - v0) == (v1 != a0[0])));
+}
+int f14() {
+    int v0 = 62;
+    int v1 = 20;
+    int v2 = 62;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    a0[13] = (((6 || v3) ? (v1 > 6) : (a0[8] <= v1)) + ((v1 || v0) > (a1[3][2] < 43)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 % 5) != (a0[4] == v1)) ? ((21 ? v1 : 48) + (v2 ? v3 : a1[1][13])) : ((17 - a1[1][4]) + (v2 > a0[13])));
+            v0 = (((a0[15] ? v3 : v2) ? (v2 || v0) : (a0[13] < 77)) ? ((v0 % 7) * (v2 % 4)) : ((72 ? 14 : a1[0][10]) <= (v1 / 8)));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v0 ? 85 : i0) && (a1[0][2] < i1)) * ((58 >= v1) != (25 != v2)));
+                    v0 = (((i1 > a0[4]) ? (v0 > 73) : (82 && 95)) < ((a1[1][8] < a1[2][5]) * (v1 <= 93)));
+                    v3 = (((v1 > i1) + (v2 + v3)) ? ((a0[4] && v2) - (v0 / 8)) : ((v2 / 8) <= (a1[1][10] != v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a0[4] = (((86 <= a1[0][0]) || (v0 - v1)) < ((a0[1] + i2) > (v3 && a1[1][8])));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v1 = (((i2 ? i3 : v0) < (v3 * v0)) - ((v0 < v0) + (i2 >= v3)));
+                    v1 = (((a1[0][5] != v2) || (v2 != i3)) || ((54 != 90) >= (v1 + v1)));
+                    a0[10] = (((i2 + i3) + (v0 >= 73)) >= ((65 < 94) <= (59 == i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v0 % 6) > (a1[2][0] < a1[3][4])) % 4);
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((57 + 55) * (a1[1][7] - a1[1][2])) / 7);
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v3 = (((a0[3] && v1) ? (2 != v0) : (i5 || 6)) > ((58 % 6) ? (a1[0][2] != v2) : (a0[0] <= v2)));
+                a0[0] = (((v2 * a0[0]) < (a1[0][12] != 15)) - ((v0 ? v2 : v1) == (a1[2][3] || 35)));
+                v1 = (((72 < a1[3][10]) == (15 ? 0 : 65)) * ((i4 == a0[3]) != (39 % 9)));
+            }
+            v1 = (((v1 + v0) - (75 / 6)) && ((a1[1][3] + v2) != (a1[0][0] + v3)));
+            v3 = (((i4 == a1[0][13]) % 6) > ((a1[0][6] ? a0[14] : v3) / 9));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    if ((((v2 > v2) - (a1[1][13] > v1)) + ((v3 > v3) == (v3 < a0[1])))) {
+        a0[10] = (((92 || a0[5]) / 3) ? ((v2 != v3) + (a1[0][3] * a0[12])) : ((62 <= v1) <= (v1 >= a1[1][11])));
+        v3 = (((v1 >= v0) == (74 > 55)) ? ((56 && v0) - (v2 ? a1[3][3] : a1[0][15])) : ((v2 == v0) / 5));
+        a1[1][8] = (((v1 >= v1) ? (v2 > 46) : (v1 <= 56)) ? ((v0 != a1[2][14]) % 5) : ((63 < v2) < (a0[4] % 3)));
+    } else {
+        v3 = (((v3 && a1[0][3]) || (30 <= 0)) - ((v0 > v0) < (v3 + 21)));
+        v1 = (((v3 * v0) + (a0[12] % 1)) * ((v2 / 8) == (89 ? a0[5] : v0)));
+        v2 = (((9 <= a0[11]) < (v1 + 35)) >= ((a1[1][7] - 64) > (a0[5] >= v0)));
+    }
+    if ((((a1[1][0] || v3) ? (a1[3][9] >= v2) : (11 % 3)) > ((a1[0][15] ? v3 : v3) + (v2 < v2)))) {
+        v0 = (((56 ? 46 : 60) ? (93 == 5) : (v3 >= v0)) / 1);
+        v1 = (((28 ? v2 : v3) < (42 > a0[6])) / 8);
+        v1 = (((a1[3][0] * a1[3][12]) ? (34 ? v3 : a1[2][6]) : (v3 ? v3 : 11)) <= ((95 - v1) > (v1 == v1)));
+    } else {
+        v3 = (((v0 < v2) > (a1[0][8] < v0)) != ((67 >= v3) >= (4 - 39)));
+        v2 = (((v2 % 2) + (v0 - v2)) + ((59 && a0[1]) + (v2 >= v3)));
+        v3 = (((v3 + 6) > (89 > a1[1][3])) > ((a1[2][3] && a0[14]) >= (a1[1][4] < v3)));
+    }
+    v0 = (((a0[1] < v0) > (v0 < v1)) != ((v3 > v2) % 4));
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((v0 ? 24 : v3) > 89) break;
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((a1[0][12] <= i6) && (a1[0][0] ? i7 : v3)) <= ((a0[9] % 8) == (v3 + 45)));
+                    v0 = (((v1 - v1) ? (v2 > i6) : (24 % 4)) < ((v1 || 77) - (v2 != a0[5])));
+                    v1 = (((v1 / 9) && (75 > v0)) < ((v0 + v0) / 1));
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            v0 = (((i6 < v3) == (a1[3][5] || v3)) >= ((22 != a1[3][8]) ? (79 / 6) : (a1[1][2] < 18)));
+            v1 = (((11 + v3) <= (a1[1][9] ? a0[14] : a0[11])) ? ((a0[15] >= v1) < (86 % 5)) : ((v0 > v2) && (i6 != v0)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v1 + v0) || (a0[7] % 7)) || ((62 / 5) != (v1 + 62)))) {
+        v2 = (((60 > 92) == (v0 + v3)) == ((v1 || a0[4]) && (81 > v3)));
+        v2 = (((a1[0][14] - v1) % 1) >= ((v0 - a0[14]) > (v0 * v0)));
+        a0[11] = (((a1[3][3] ? v2 : v0) > (v1 && a1[1][6])) % 6);
+    } else {
+        v2 = (((v1 > v1) + (v2 % 4)) >= ((v0 != a0[15]) || (v2 || v3)));
+        a0[6] = (((20 < v1) && (v3 && v3)) == ((v3 != v1) - (v1 % 1)));
+        v0 = (((v2 - a0[0]) ? (40 + v1) : (a0[4] ? a1[0][6] : v2)) != ((59 && v1) < (73 - 41)));
+    }
+    return (((v2 >= a0[15]) ? (v1 / 8) : (a1[2][8] - v1)) < ((0 <= v2) % 1));
+}
+int f15() {
+    int v0 = 17;
+    int v1 = 76;
+    int v2 = 16;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 + a0[3]) > 57) break;
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v3 <= a1[1][13]) > (v1 ? i0 : a1[0][0])) ? ((i0 <= a1[3][10]) ? (a0[4] / 1) : (i0 || a1[0][1])) : ((a1[3][11] / 2) ? (v0 > a1[2][8]) : (a1[3][1] == a0[7])));
+                    v2 = (((i1 ? 90 : a1[0][4]) % 2) * ((24 < v3) != (i1 + v2)));
+                    v1 = (((v1 > v3) * (a0[14] && i1)) ? ((i0 < 53) ? (v3 && 57) : (v2 - 59)) : ((a1[2][11] ? i1 : a1[0][5]) * (i0 - v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v1 = (((v2 - a0[10]) ? (a1[2][12] - v2) : (v2 / 1)) % 3);
+            v1 = (((a0[14] / 9) == (a1[3][6] == v0)) % 8);
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            a0[13] = (((v2 / 2) >= (a1[1][1] == v1)) / 3);
+            {
+                int i3 = 0;
+                do {
+                    a0[7] = (((v2 <= a0[2]) + (a0[0] <= a0[5])) || ((a0[1] < a1[0][8]) + (i3 ? a1[2][11] : 25)));
+                    v2 = (((v3 <= a1[2][4]) != (v1 == v0)) * ((a1[1][12] > 69) != (v3 < i3)));
+                    v1 = (((v0 ? i3 : 67) == (24 / 7)) - ((i3 / 6) >= (i2 * 14)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            a0[4] = (((a1[3][6] < v1) && (i2 && a1[0][8])) > ((a1[1][12] * a1[2][4]) > (v2 && v3)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((42 > v0) != (a1[3][6] == v0)) ? ((v3 / 5) ? (56 * 53) : (a1[1][5] % 9)) : ((v2 != v1) % 7));
+                    a1[2][9] = (((42 * a1[1][12]) == (a0[13] == a1[3][4])) ? ((v1 * v0) ? (a0[4] < i4) : (v1 >= v3)) : ((v2 != v3) % 2));
+                    v0 = (((i5 + 35) >= (a1[3][6] && v1)) % 5);
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v1 = (((v0 < v1) >= (a1[1][13] * i4)) || ((v0 >= a0[12]) + (a0[4] * i4)));
+            v0 = (((73 <= a1[0][6]) / 2) % 8);
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v1 = (((v2 < i6) || (4 ? a1[0][7] : v2)) < ((a0[7] == v0) > (v3 && 84)));
+                v2 = (((a1[3][14] && 64) <= (v1 * 45)) > ((v3 <= i6) > (v3 > 78)));
+                v3 = (((v1 ? i7 : v0) >= (34 + a1[3][12])) < ((24 == v0) * (a0[2] >= v3)));
+            }
+            a1[2][5] = (((v1 + 47) - (59 * 45)) >= ((41 != v1) + (i6 % 4)));
+            v0 = (((a0[5] != 98) || (54 > 2)) != ((7 ? i6 : v0) - (v0 / 5)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((36 < v3) >= (77 || v0)) > ((v0 % 4) > (v2 && 2)))) {
+        v0 = (((v3 && v0) && (v2 % 7)) ? ((a1[3][9] * v3) && (v0 || 46)) : ((58 && 15) ? (v0 % 1) : (v3 > 84)));
+        v2 = (((a0[4] ? v0 : 21) > (37 / 5)) + ((v0 * 51) * (v3 - v0)));
+        v2 = (((a0[10] && v3) < (a1[2][7] * v0)) < ((13 > 38) && (v2 > v0)));
+    } else {
+        a0[12] = (((v2 || a0[6]) % 7) ? ((a0[4] != 0) || (v0 ? a0[9] : v3)) : ((v2 >= a1[3][8]) < (a1[1][10] != v3)));
+        a1[0][5] = (((v0 == v3) * (16 || v0)) >= ((38 || a0[3]) + (59 == a0[7])));
+        v1 = (((v0 ? v0 : v0) && (a0[12] - 8)) || ((51 ? 72 : a1[1][13]) && (a0[6] >= a1[3][7])));
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            while (i9 < 3) {
+                a0[6] = (((v0 / 6) <= (v2 >= v3)) || ((v3 + v3) <= (8 % 2)));
+                v3 = (((v2 / 9) && (24 ? a1[2][12] : a0[13])) || ((v0 || v3) * (v3 || v2)));
+                v0 = (((17 || v3) % 2) || ((v3 || i8) ? (a1[1][6] > v3) : (a0[10] < v3)));
+                i9 = i9 + 1;
+            }
+        }
+        a0[9] = (((21 % 3) || (a1[3][10] * a0[13])) ? ((80 > 10) != (i8 > v1)) : ((84 + i8) && (a1[3][12] - a1[3][8])));
+        v1 = (((i8 != a1[1][3]) <= (6 + v3)) % 9);
+    }
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        v1 = (((v3 >= v0) == (20 > a1[1][10])) <= ((70 == 80) && (a1[2][15] / 1)));
+        v1 = (((v1 - 64) + (v3 ? v3 : i10)) > ((v0 > v0) / 1));
+        {
+            int i11 = 0;
+            do {
+                v0 = (((63 == a0[14]) ? (a1[0][0] / 2) : (97 ? 99 : a1[0][0])) < ((1 <= v3) <= (v0 * v3)));
+                v0 = (((72 == v3) % 1) >= ((i10 % 1) <= (i10 <= i11)));
+                a1[3][5] = (((54 - v1) ? (i11 || 8) : (v0 != a1[0][9])) >= ((98 ? a1[1][1] : i10) != (v3 ? v1 : a1[1][11])));
+                i11 = i11 + 1;
+            } while (i11 < 7);
+        }
+    }
+    for (int i12 = 0; i12 < 7; i12 = i12 + 1) {
+        a0[15] = (((i12 <= v1) - (v0 || v3)) + ((31 || 93) || (a1[2][2] / 2)));
+        a0[15] = (((a1[2][7] >= a1[0][8]) % 2) ? ((v2 % 3) ? (30 != v2) : (a0[13] < 70)) : ((v3 > a1[2][7]) ? (a1[2][13] ? v3 : a0[10]) : (v1 * v0)));
+        {
+            int i13 = 0;
+            do {
+                if ((a1[3][1] ? a0[3] : 14) > 67) break;
+                v2 = (((v0 ? v2 : v1) ? (i12 && i12) : (v3 * v3)) < ((v2 / 5) / 6));
+                a0[13] = (((v0 <= 58) == (a1[3][4] >= v1)) / 9);
+                v1 = (((v1 * v0) ? (v1 ? 47 : v2) : (v2 != a0[7])) % 2);
+                i13 = i13 + 1;
+            } while (i13 < 7);
+        }
+    }
+    v1 = (((65 != v2) + (v0 < a1[3][9])) / 9);
+    a1[0][15] = (((a1[1][7] != a1[1][0]) ? (a0[13] ? a1[0][12] : v3) : (v0 + 27)) > ((22 - v1) <= (85 ? 97 : v3)));
+    return (((5 == 46) % 6) - ((70 % 6) ? (v1 != v0) : (v2 && a1[1][1])));
+}
+int f16() {
+    int v0 = 77;
+    int v1 = 85;
+    int v2 = 16;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    if ((((40 > a0[6]) ? (v1 * a1[2][9]) : (86 != v1)) <= ((1 >= v1) / 6))) {
+        v2 = (((v0 < v2) + (a1[2][5] + a0[14])) - ((v3 || v2) || (v3 * v0)));
+        a0[14] = (((a0[6] == v1) > (a1[3][11] > v0)) == ((v3 && v1) + (a0[3] == v3)));
+        a1[1][5] = (((v3 >= v0) > (v3 < 55)) + ((v0 && v0) + (v0 / 4)));
+    } else {
+        a0[4] = (((v0 >= v0) < (a0[13] < 20)) / 2);
+        v2 = (((v1 / 1) / 7) ? ((a1[1][4] && 19) && (v3 - a1[1][8])) : ((a1[1][6] * v3) >= (a0[4] && a1[1][11])));
+        v2 = (((v2 ? v1 : a1[3][13]) >= (v2 && v0)) && ((v3 - v3) >= (v0 > 88)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a1[3][14] = (((v0 > v0) != (i0 % 7)) % 5);
+                v0 = (((i0 || v3) == (60 - v1)) <= ((v0 >= a1[0][2]) <= (i0 <= a0[2])));
+                v1 = (((a1[1][15] - a0[11]) <= (v3 != a0[2])) ? ((i1 * a0[7]) + (i0 + 15)) : ((i1 * v1) <= (14 >= v3)));
+            }
+            v2 = (((a1[1][14] == v1) + (a0[6] + v1)) == ((a1[1][10] % 7) - (a1[2][2] == a1[2][5])));
+            v3 = (((v0 ? v1 : v1) ? (23 ? v3 : 27) : (i0 <= 70)) + ((85 != v0) < (i0 < v2)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v3 || a0[4]) > 68) break;
+        {
+            int i3 = 0;
+            do {
+                a1[2][13] = (((64 * v3) < (v2 * i3)) % 7);
+                v1 = (((a1[2][4] <= v2) || (v0 ? v3 : 14)) || ((v0 || 39) ? (96 != a1[1][15]) : (v1 ? v0 : a1[3][8])));
+                v3 = (((a1[1][10] / 7) >= (a0[10] > v3)) <= ((i3 <= v1) > (i2 % 6)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        a0[7] = (((a0[10] < v0) != (v1 < a0[0])) + ((16 ? 61 : 87) ? (v1 + i2) : (v1 == a0[3])));
+        v0 = (((a0[15] * 7) % 3) / 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((45 + 2) % 7) < ((66 - i5) <= (i5 * 78)));
+                    a1[3][15] = (((a1[2][0] > a0[15]) == (v2 && a1[3][1])) ? ((i5 ? v0 : a1[0][6]) % 4) : ((i5 && a0[2]) > (a1[3][13] != v2)));
+                    v2 = (((v3 && 8) && (v3 % 7)) >= ((i5 >= i5) + (a1[1][15] / 9)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v1 = (((v2 > 68) || (a1[0][1] ? v2 : 47)) + ((65 != a1[1][10]) + (v2 ? a1[2][7] : 12)));
+            v2 = (((a1[0][11] ? v2 : v0) <= (a0[8] > 58)) + ((57 * a0[8]) + (a1[1][14] % 8)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v1 = (((v0 == i6) != (a0[15] < a0[11])) == ((i6 / 4) <= (i6 && v2)));
+        v2 = (((i6 - 39) ? (v1 ? v1 : v2) : (v2 ? a1[1][0] : v3)) / 2);
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            if ((i7 % 8) > 70) break;
+            v0 = (((v0 && 98) != (a0[12] ? i7 : v1)) ? ((v3 % 5) ? (v3 > v1) : (i6 || 10)) : ((v1 > a0[6]) && (i6 || a1[2][0])));
+            v0 = (((a1[1][6] + 0) / 7) == ((v1 * v0) ? (21 != i6) : (42 == v2)));
+            v1 = (((a0[1] != v1) - (a1[2][2] > a1[0][5])) == ((a1[1][10] && a1[3][5]) == (a1[1][8] - v1)));
+        }
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        a1[3][7] = (((a0[3] <= 99) < (0 % 1)) / 5);
+        a1[1][14] = (((a1[1][15] + a1[1][2]) == (44 % 3)) / 3);
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                v1 = (((v2 ? v2 : i8) / 5) - ((i8 && i9) >= (a0[5] || 90)));
+                a1[2][2] = (((93 ? 65 : v2) * (a0[7] % 8)) * ((12 != a0[5]) ? (47 + a0[13]) : (v2 ? v1 : v2)));
+                a1[0][6] = (((a0[12] && v2) >= (56 != 86)) < ((v3 && i8) < (89 != v0)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    v1 = (((a0[13] != v1) % 3) - ((1 > v1) < (a0[6] > v0)));
+    {
+        int i10 = 0;
+        do {
+            if ((a0[13] == v3) > 78) break;
+            v3 = (((46 + 80) % 5) / 9);
+            {
+                int i11 = 0;
+                while (i11 < 8) {
+                    v3 = (((95 % 8) * (v3 % 7)) / 1);
+                    v3 = (((v0 / 8) <= (i10 ? v2 : a0[0])) == ((i10 % 2) != (15 < 19)));
+                    v3 = (((a1[1][5] + v0) <= (i10 > v0)) || ((a0[5] ? 92 : i10) == (i10 % 8)));
+                    i11 = i11 + 1;
+                }
+            }
+            a1[1][9] = (((i10 * a0[10]) % 4) < ((a1[2][7] - v0) <= (a0[12] > i10)));
+            i10 = i10 + 1;
+        } while (i10 < 8);
+    }
+    if ((((v0 * a1[1][12]) < (12 > a0[12])) + ((68 || 46) + (v2 / 4)))) {
+        a1[1][7] = (((38 % 7) || (25 + 74)) < ((58 ? v1 : 18) || (v1 ? v1 : 78)));
+        v0 = (((v1 <= v1) / 1) ? ((v3 >= v2) / 5) : ((v2 < v2) ? (a0[8] + a0[14]) : (v3 + v1)));
+        a1[2][8] = (((76 ? 88 : v3) && (80 % 3)) / 1);
+    } else {
+        v1 = (((a1[1][7] || v0) && (81 > v2)) ? ((a0[3] != v0) % 9) : ((21 / 7) == (v0 * 72)));
+        v3 = (((83 / 8) * (v3 != a1[1][5])) > ((a1[2][10] > 31) >= (v0 && v1)));
+        v1 = (((56 + 67) - (v3 <= a0[6])) && ((a0[1] != a0[10]) < (v0 ? v3 : v3)));
+    }
+    for (int i12 = 0; i12 < 5; i12 = i12 + 1) {
+        for (int i13 = 0; i13 < 6; i13 = i13 + 1) {
+            v3 = (((v1 <= i12) + (i13 - 16)) + ((98 + a1[3][8]) > (i12 > 49)));
+            v2 = (((a0[0] % 1) == (45 - 64)) == ((49 * v3) <= (i13 - 75)));
+            a1[0][11] = (((61 == a1[0][1]) % 2) ? ((59 >= a1[3][13]) <= (a1[1][13] && v0)) : ((a1[3][2] * 94) && (v2 ? v2 : 29)));
+        }
+        v0 = (((v3 % 8) || (a1[3][2] ? v1 : a0[7])) && ((v3 < v0) - (v3 || v2)));
+        v0 = (((a1[2][7] && v0) && (v1 / 9)) == ((v1 % 6) >= (v1 < a0[5])));
+    }
+    return (((9 / 5) != (v2 && v3)) >= ((a0[14] > a1[1][8]) || (a0[10] * v2)));
+}
+int f17() {
+    int v0 = 55;
+    int v1 = 19;
+    int v2 = 19;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 == 48) <= (v1 ? a0[12] : v1)) ? ((v3 + 72) == (a0[2] == a0[11])) : ((a0[6] - v0) != (79 + v2)));
+    a0[14] = (((55 < v0) != (v3 % 8)) ? ((a0[3] != a1[3][15]) * (v0 - v2)) : ((v3 ? v0 : v3) == (a0[12] + v3)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v2 = (((9 / 8) * (v2 && a0[13])) * ((v1 ? 85 : a1[2][15]) == (i0 <= v3)));
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            v0 = (((v0 ? a1[2][11] : v3) && (v0 - v3)) ? ((v1 <= i1) * (43 - v1)) : ((v0 * i1) > (i0 % 4)));
+            v1 = (((i0 >= 15) && (v2 != i1)) == ((a0[10] - 63) - (a1[1][11] ? a0[12] : v2)));
+            v0 = (((i1 == v0) * (90 || v1)) / 9);
+        }
+        a0[7] = (((18 * v0) ? (v3 <= 48) : (6 > a0[15])) < ((v2 > a0[3]) % 1));
+    }
+    if ((((63 / 7) - (v2 < 3)) < ((a0[4] + v2) == (v2 % 6)))) {
+        a1[2][11] = (((a1[0][0] ? 55 : 18) && (v1 / 4)) && ((v0 == 78) / 8));
+        a1[2][1] = (((v1 != v2) ? (11 && v3) : (a0[7] >= v0)) ? ((a0[8] % 3) != (v1 >= 15)) : ((a0[2] && a1[1][3]) + (98 - v1)));
+        a0[11] = (((5 && v1) ? (v3 ? 65 : 50) : (71 > a0[9])) + ((v0 > 63) ? (v2 + v1) : (v0 || a0[4])));
+    } else {
+        a0[6] = (((v2 || 5) >= (a0[14] > v2)) < ((v0 ? a0[9] : v2) % 8));
+        v1 = (((v3 || v1) <= (v3 || v0)) >= ((v1 * a0[13]) < (v0 - 70)));
+        a0[0] = (((v2 >= v3) * (v3 ? a1[2][13] : 26)) >= ((v1 <= v3) + (39 > 76)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((v3 / 9) > 84) break;
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                a0[13] = (((a1[3][12] && v1) <= (v1 > i3)) == ((a1[2][11] >= v2) && (a1[2][15] >= 42)));
+                v1 = (((a1[1][6] == v0) > (a0[15] != 21)) ? ((58 || a0[9]) / 7) : ((v2 != i3) * (i2 * a1[0][8])));
+                v0 = (((v1 / 7) <= (v2 > a0[14])) ? ((v2 - 16) / 2) : ((v0 != a0[14]) == (34 == v0)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[7] = (((i2 != i2) / 4) == ((36 != v3) != (v3 >= v0)));
+        v3 = (((60 == 48) || (a1[2][15] < v3)) * ((v0 + a0[13]) == (26 % 7)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((i4 != a1[2][2]) == (v2 && a1[2][13])) / 2);
+                    a1[0][10] = (((i4 ? a1[1][0] : a1[1][5]) <= (a0[10] && v0)) - ((a1[3][15] / 9) * (66 < 34)));
+                    v3 = (((a0[2] != v1) || (i4 + i4)) % 3);
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            a0[3] = (((a0[13] ? a1[0][2] : 76) >= (a1[2][15] || 78)) != ((v3 - 54) && (v0 % 8)));
+            a1[2][9] = (((68 != v1) > (v3 % 1)) < ((v3 % 5) > (a1[0][4] - v3)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v1 && a0[15]) <= (51 + 9)) < ((a0[3] + v3) ? (46 - a1[0][6]) : (v0 && v2)))) {
+        v2 = (((v2 - 88) && (59 != a0[13])) || ((a0[13] == v1) != (v2 * a1[1][1])));
+        v1 = (((v2 ? a1[2][6] : v0) < (17 % 9)) + ((v0 * v3) + (27 ? 35 : a0[7])));
+        v2 = (((79 * v0) > (v2 && v2)) * ((v2 == a1[3][10]) ? (0 != a0[1]) : (65 == v2)));
+    } else {
+        a0[6] = (((54 && a0[5]) > (v1 / 6)) || ((a1[3][5] <= 12) - (v1 == a1[0][13])));
+        v1 = (((38 ? 24 : a0[14]) - (a0[7] <= v0)) >= ((a0[0] ? v1 : v0) - (v1 >= v1)));
+        v3 = (((v2 ? 46 : 5) > (a1[2][9] * v1)) && ((v3 != v2) || (a1[3][3] <= a0[5])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v0 = (((v1 <= v3) + (a1[0][9] - a0[8])) * ((v3 ? a1[1][7] : v0) != (v3 ? 90 : 63)));
+            {
+                int i7 = 0;
+                do {
+                    v3 = (((i6 <= a0[10]) ? (i7 > v2) : (v2 < 36)) ? ((v1 + v0) + (33 == 13)) : ((49 == a1[2][9]) == (v3 && 3)));
+                    a1[0][10] = (((v3 ? a0[0] : a0[0]) <= (a0[12] + a0[15])) && ((59 == 25) * (v3 < 71)));
+                    v2 = (((a0[15] ? v3 : a0[10]) ? (i6 ? v0 : a0[1]) : (95 ? i7 : i7)) + ((v1 - v1) / 6));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            v3 = (((70 || v2) <= (v2 + v0)) / 7);
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a0[6] / 8) == (67 - a1[0][12])) < ((12 != v1) % 4))) {
+        a1[3][1] = (((46 <= a0[3]) || (72 < v1)) / 1);
+        a0[4] = (((v2 + a0[5]) != (14 >= v1)) - ((v3 || v3) ? (v1 / 5) : (87 < v0)));
+        v1 = (((v2 > 33) - (v2 + 42)) && ((v3 == a1[1][2]) + (v3 * v1)));
+    } else {
+        a0[4] = (((v2 != a0[8]) % 4) || ((32 && a0[10]) - (v3 <= 15)));
+        a1[1][7] = (((v2 + v2) ? (v0 >= a1[1][3]) : (v0 != v0)) >= ((v2 && v2) - (60 ? a1[0][15] : v2)));
+        v1 = (((70 || 80) + (94 * v0)) < ((v1 + v1) != (v3 < a0[6])));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            v0 = (((i8 + a0[6]) + (51 || a1[3][3])) * ((92 ? a0[5] : a1[3][15]) / 7));
+            v3 = (((a1[3][15] * v3) || (63 > 31)) != ((a1[0][2] / 8) ? (v3 >= i8) : (i8 + v0)));
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((74 != a0[15]) - (i8 ? a0[5] : v3)) ? ((v2 || 69) && (41 / 6)) : ((v1 && 44) && (a0[7] ? 66 : 86)));
+                    a0[5] = (((a1[0][8] < v2) % 6) % 9);
+                    v3 = (((25 > v3) < (1 == v0)) / 1);
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((49 ? 50 : a1[0][1]) != (v0 != 52)) <= ((42 + 2) || (v1 >= v2)));
+}
+int f18() {
+    int v0 = 31;
+    int v1 = 88;
+    int v2 = 56;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 * v0) <= (a1[3][6] || a1[0][1])) % 9)) {
+        a1[2][4] = (((v3 && v0) * (89 <= 75)) && ((a1[3][9] / 7) - (v1 || v3)));
+        a0[14] = (((53 % 7) <= (v0 < a1[2][11])) ? ((v0 < v2) >= (v0 <= a1[1][3])) : ((a0[6] || v0) * (66 * v0)));
+        v1 = (((v2 < v3) % 9) || ((36 < 27) ? (a0[14] >= v3) : (50 == v2)));
+    } else {
+        v3 = (((v3 <= 33) != (v3 == v1)) > ((v2 ? v3 : v3) + (49 != 76)));
+        a1[3][5] = (((v1 ? 80 : v2) <= (v3 || 41)) != ((a1[2][9] || a1[0][10]) >= (v2 - v3)));
+        v3 = (((v2 % 3) ? (v2 % 9) : (v1 ? v1 : v0)) != ((7 <= v2) > (99 % 2)));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a1[0][9] = (((a1[3][11] == v3) == (a1[3][10] || 69)) != ((v3 % 8) / 4));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                if ((a0[15] <= i0) > 73) break;
+                v3 = (((v2 <= i1) > (81 && i1)) / 7);
+                v1 = (((a1[3][5] ? v2 : a1[0][10]) >= (v2 >= a0[6])) * ((i0 > 73) / 7));
+                a0[5] = (((v2 <= 42) / 6) || ((v0 / 2) - (v3 ? i0 : v1)));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((11 >= i0) - (v2 > 38)) + ((v0 || v1) >= (v2 / 1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            a1[3][10] = (((40 + 62) <= (a1[0][6] > v2)) && ((95 <= v1) <= (v2 * 62)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v3 = (((v2 == a0[12]) % 1) <= ((14 * v2) < (v2 ? a0[15] : v1)));
+                    v2 = (((a1[2][8] && 22) ? (v0 ? 69 : 13) : (a0[1] != a0[15])) >= ((a1[1][12] != v3) >= (74 >= a1[2][13])));
+                    v3 = (((38 >= v3) - (v1 % 9)) % 8);
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((v1 % 6) <= (v3 >= v2)) != ((7 > 56) % 5));
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((v3 || a1[2][2]) && (v1 == v1)) * ((v0 != a1[3][7]) ? (v2 / 4) : (92 || a0[13])));
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((i4 > 94) > (v1 * v1)) % 3);
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                a1[3][3] = (((a1[2][3] > 12) ? (a1[2][4] ? 15 : v1) : (v1 ? v2 : a1[2][12])) && ((v0 <= v1) <= (i4 - a0[15])));
+                v2 = (((v1 * v1) / 7) - ((v1 ? a1[0][11] : a1[1][5]) != (v3 || a0[1])));
+                v1 = (((88 ? 60 : i5) && (v1 / 8)) ? ((i4 * 90) / 9) : ((v1 < a1[2][1]) >= (29 - v1)));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((a1[3][2] ? i4 : 94) - (i4 != v0)) == ((v3 < v2) + (v0 || 9)));
+    }
+    v3 = (((25 == 90) + (v3 - a1[1][6])) || ((29 + a1[1][12]) * (v3 >= 38)));
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            while (i7 < 8) {
+                a0[14] = (((a0[8] <= v3) / 1) <= ((v3 < 36) ? (a1[1][13] + v2) : (a1[1][6] < v2)));
+                v0 = (((a1[1][5] ? 51 : a1[1][13]) ? (v3 % 9) : (v0 >= v2)) < ((98 > i6) % 2));
+                v2 = (((v2 < 64) - (i7 / 5)) - ((v1 ? i6 : 85) ? (28 / 1) : (v3 || a1[2][7])));
+                i7 = i7 + 1;
+            }
+        }
+        v2 = (((v2 <= v3) / 9) - ((v0 >= v2) != (v3 / 1)));
+        v0 = (((39 % 5) <= (v1 <= v2)) || ((68 + v1) == (v3 > v3)));
+    }
+    v1 = (((v2 - a1[1][8]) <= (v0 > a1[0][11])) && ((v1 / 8) - (27 + 97)));
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    v0 = (((79 != 62) + (a1[2][8] ? v3 : i8)) >= ((v2 < 29) ? (v3 == a1[1][15]) : (v0 ? v1 : 91)));
+                    a1[2][8] = (((a1[1][1] ? a1[0][7] : a1[3][9]) + (a1[2][6] || i9)) % 5);
+                    a1[2][2] = (((v0 <= v1) && (80 < a0[13])) * ((29 % 9) + (v0 == v3)));
+                    i9 = i9 + 1;
+                }
+            }
+            v0 = (((a0[14] != a0[8]) - (58 <= v1)) % 9);
+            v3 = (((a1[2][10] != v3) ? (v2 && a0[0]) : (34 && 14)) <= ((v2 && a1[0][5]) ? (1 ? v3 : v3) : (v2 - 54)));
+            i8 = i8 + 1;
+        }
+    }
+    v0 = (((v2 || a1[3][1]) * (v0 ? v0 : 1)) >= ((v1 ? a0[3] : v2) && (v2 * 44)));
+    return (((a1[1][4] - v1) ? (88 * 36) : (90 + v1)) <= ((v0 % 6) || (v2 * v2)));
+}
+int f19() {
+    int v0 = 59;
+    int v1 = 0;
+    int v2 = 22;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][15] ? 96 : a0[6]) * (v3 ? a0[11] : a0[0])) != ((64 != v0) > (v3 * 82)))) {
+        a0[12] = (((v3 / 2) ? (v3 && 33) : (v0 + 6)) + ((v3 && v1) >= (v2 <= 58)));
+        v2 = (((v0 >= 2) || (54 ? v2 : 1)) && ((v3 * 70) <= (89 ? v0 : v2)));
+        v1 = (((v1 >= v1) + (a0[8] + a1[2][5])) / 9);
+    } else {
+        v1 = (((a1[3][12] * 61) > (v2 ? v1 : v2)) && ((v3 || a0[9]) >= (v0 || a1[3][11])));
+        a0[1] = (((v2 ? a1[3][0] : 53) + (a1[1][1] || v1)) <= ((v3 != v1) ? (v3 ? v1 : v1) : (v0 < v3)));
+        a1[2][5] = (((v0 >= a0[9]) >= (v3 ? v1 : v3)) <= ((a0[13] * 28) * (v0 % 2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a0[11] = (((20 > a0[7]) >= (v3 + i1)) / 2);
+                    a0[7] = (((7 <= a1[2][4]) % 2) ? ((91 == 97) >= (a1[2][11] * v2)) : ((87 == 1) ? (v3 - v3) : (a1[2][4] ? i1 : v2)));
+                    a0[7] = (((98 != 95) ? (9 - v1) : (v1 == 61)) || ((a0[13] <= i0) > (72 / 3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][8] = (((a1[0][13] ? v1 : v1) ? (v0 / 3) : (v2 == v1)) - ((v0 < 25) && (v2 >= v1)));
+            v0 = (((v0 % 6) ? (v2 ? 31 : v1) : (v3 / 4)) / 7);
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((a0[12] ? v3 : v1) <= (a0[5] || a1[0][0])) <= ((v3 == v1) != (a0[3] * v0)))) {
+        v3 = (((v1 * v0) / 5) == ((v3 + v0) <= (a0[3] || v1)));
+        v2 = (((v2 % 1) / 9) > ((56 && a1[1][15]) + (44 / 1)));
+        v3 = (((v3 == v2) + (4 ? a0[13] : a1[3][3])) % 3);
+    } else {
+        v2 = (((v2 - v2) * (v0 == v0)) * ((v0 ? a1[3][13] : v2) && (a0[1] ? 33 : 50)));
+        v2 = (((v3 <= v2) + (a0[7] >= 70)) > ((a1[0][3] >= a1[2][5]) && (34 - 4)));
+        v3 = (((v3 || a0[2]) == (a0[13] - a0[11])) && ((59 % 4) < (v1 && 1)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((v1 < a0[0]) > 64) break;
+        v3 = (((v0 ? a1[3][4] : a0[15]) > (v3 ? v3 : a0[10])) - ((a1[0][11] && a0[12]) == (55 < a1[1][1])));
+        v3 = (((a1[0][9] / 3) - (v2 != 29)) + ((v1 <= v0) || (v0 ? v0 : v2)));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                a1[0][4] = (((84 >= i2) <= (a1[2][7] && v2)) / 9);
+                v1 = (((v2 ? 7 : 84) == (a0[2] > v0)) <= ((a0[14] ? 94 : v2) || (v1 / 6)));
+                v2 = (((v1 || a0[9]) <= (a1[0][2] % 2)) >= ((v2 <= v3) % 4));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                a1[2][7] = (((v1 <= v3) > (51 > 93)) != ((v0 + 14) < (94 > v2)));
+                v3 = (((a0[3] ? i5 : a1[3][0]) < (96 < i4)) || ((34 >= v1) > (v3 || a0[12])));
+                v1 = (((a0[15] ? i5 : a0[14]) >= (66 / 8)) + ((a1[0][9] / 4) >= (v0 / 5)));
+                i5 = i5 + 1;
+            }
+        }
+        v1 = (((i4 ? 96 : v1) && (i4 ? v3 : a0[0])) + ((v3 && 97) || (a0[10] ? v2 : a1[1][1])));
+        v3 = (((60 + v1) ? (v3 == 77) : (v3 && 61)) != ((v2 / 5) % 3));
+    }
+    v3 = (((70 * v0) * (v0 * a1[0][3])) + ((a0[15] ? v1 : v2) || (71 != a1[3][8])));
+    if ((((a1[3][7] >= a0[7]) > (v0 == v0)) < ((v1 == v3) < (v1 == 29)))) {
+        v0 = (((a1[1][0] > a0[8]) || (v2 > v3)) == ((v2 + v0) == (v3 ? a0[6] : a1[3][14])));
+        v2 = (((v0 <= 17) != (a0[3] ? 11 : 61)) - ((a0[9] == 83) * (80 && a1[3][0])));
+        v2 = (((v1 % 9) + (a1[1][15] * v2)) * ((78 == v3) != (68 ? 65 : 9)));
+    } else {
+        v0 = (((59 ? v1 : 67) != (v3 != a1[3][2])) - ((a0[6] + 91) + (v1 != v3)));
+        v2 = (((96 / 1) % 1) || ((v1 >= 87) / 8));
+        a1[1][4] = (((v1 >= v2) != (71 <= a1[0][15])) + ((v1 != 16) >= (v2 > a1[2][6])));
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        v0 = (((v0 / 6) - (a0[9] % 7)) - ((v2 > a1[0][13]) ? (v1 * v0) : (a1[1][7] - v2)));
+        v0 = (((v1 * a0[8]) < (v0 ? a0[14] : v0)) ? ((a0[5] && a0[2]) >= (6 ? v0 : a0[3])) : ((i6 - v2) - (i6 * v0)));
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            a0[14] = (((11 <= a0[4]) && (15 < 22)) <= ((v2 != i7) == (50 % 2)));
+            v1 = (((23 || v2) / 7) + ((61 && 77) * (a0[9] ? a1[3][11] : i6)));
+            v3 = (((a0[15] % 3) == (99 ? a1[3][11] : a1[0][2])) + ((v0 > 70) % 9));
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((v3 * v1) ? (a0[6] && v1) : (i8 && v1)) % 7);
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                if ((v1 - a0[1]) > 78) break;
+                v0 = (((v3 || v1) ? (a0[0] * v2) : (a1[0][0] > v1)) + ((v3 && 36) < (v2 < v0)));
+                a0[6] = (((a0[12] - a1[2][6]) && (83 - 38)) - ((v2 > v0) <= (a1[3][5] < v0)));
+                v3 = (((a1[3][13] - 60) - (48 - 13)) * ((a0[1] >= 43) + (v1 % 6)));
+            }
+            v2 = (((v1 ? a0[0] : a1[3][10]) - (i8 * a0[3])) == ((v3 + 97) ? (i8 >= i8) : (v0 % 8)));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 8) {
+            v2 = (((v1 <= i10) ? (v2 ? a1[3][9] : v2) : (a1[2][3] > v1)) || ((v3 / 7) || (v2 <= v2)));
+            a1[3][11] = (((v1 / 2) <= (72 != 66)) != ((v3 && v3) ? (v2 ? v3 : 3) : (v3 / 2)));
+            {
+                int i11 = 0;
+                while (i11 < 5) {
+                    v0 = (((a1[1][13] % 6) && (v0 % 7)) ? ((v3 ? 50 : v2) > (v1 == v2)) : ((v1 && 11) - (11 && a0[11])));
+                    a1[3][0] = (((a0[4] - v0) != (v0 || v0)) == ((9 >= v3) ? (v0 >= a1[1][2]) : (a0[15] || v2)));
+                    v1 = (((77 * 89) < (6 && 58)) && ((v3 ? i11 : v1) / 2));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((v0 % 5) * (a0[0] < a1[3][6])) * ((5 <= 12) - (a1[3][14] > v3)));
+}
+int f20() {
+    int v0 = 16;
+    int v1 = 51;
+    int v2 = 16;
+    int v3 = 98;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v1 + a1[1][13]) && (a1[2][5] / 4)) ? ((16 ? 95 : 63) && (a0[15] ? v3 : v0)) : ((v0 ? v1 : a0[10]) - (v1 % 2)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((78 != 16) > (27 <= v1)) * ((v3 < v3) + (v1 * i0)));
+                v1 = (((v3 == v2) != (a1[2][11] == i0)) / 7);
+                v0 = (((a0[5] ? a1[2][15] : 45) == (i1 || i0)) ? ((82 > v3) != (a0[4] % 3)) : ((v3 - v2) || (65 * a1[3][1])));
+            }
+            v1 = (((89 != 5) > (v3 == v1)) / 4);
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((a1[2][5] < 86) < (v3 - v1)) >= ((v2 < a0[11]) + (a0[1] != a0[2])))) {
+        a1[1][15] = (((a0[13] * v3) > (4 > a0[13])) ? ((a0[4] + v3) < (a1[0][0] != v1)) : ((v2 <= v3) - (v2 / 3)));
+        v3 = (((55 >= 84) > (a0[4] == v1)) != ((v2 * 59) && (57 != a1[3][3])));
+        a0[8] = (((v2 > 89) ? (v0 ? a1[3][0] : v2) : (v3 || v3)) == ((v0 + a1[0][10]) % 5));
+    } else {
+        v3 = (((v0 && v1) == (v2 < 46)) == ((v0 % 8) != (a0[3] > v0)));
+        v1 = (((a0[3] >= v0) == (v1 != v0)) * ((37 % 1) && (94 <= v0)));
+        a0[12] = (((a0[9] < 2) + (a0[6] % 4)) >= ((v3 != v2) * (11 > a1[2][2])));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((a0[9] < 42) > 63) break;
+        v3 = (((v3 > 31) + (v3 != v1)) * ((v1 && i2) < (57 ? 55 : a1[0][1])));
+        a0[4] = (((v3 * 65) == (v2 >= v1)) + ((v2 || v0) > (v1 || 83)));
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            v1 = (((80 > 10) <= (85 < a1[2][5])) == ((v2 > a1[0][4]) != (v0 % 6)));
+            v0 = (((i2 / 8) && (v1 ? a0[8] : v0)) - ((v0 + 56) / 9));
+            v2 = (((v2 ? a1[0][15] : 33) >= (a0[12] || a0[8])) <= ((i2 || i3) > (v1 <= i2)));
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((v0 * a0[1]) > 96) break;
+            v3 = (((v3 >= a0[7]) ? (v0 / 2) : (v1 != a0[3])) ? ((82 / 1) % 9) : ((a1[3][9] ? a0[3] : 39) + (v1 * i4)));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                a0[8] = (((v1 + v3) % 6) % 5);
+                v1 = (((v0 || i5) == (a1[2][9] && i4)) * ((44 * 59) * (i4 || a0[6])));
+                v2 = (((a1[2][3] >= 28) + (v0 / 5)) && ((v1 || v1) <= (16 == i5)));
+            }
+            v2 = (((v2 == v2) == (v3 - i4)) / 3);
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        a0[8] = (((v3 < a0[5]) / 5) ? ((v3 == a0[3]) <= (a1[1][14] == a0[15])) : ((v2 + 74) != (65 ? 60 : v2)));
+        v1 = (((73 <= 33) ? (v1 || 47) : (v0 < v3)) * ((91 > 15) % 2));
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            v1 = (((i6 - a0[7]) ? (65 < i6) : (78 % 8)) >= ((i6 && 43) ? (v1 > v1) : (v2 <= 23)));
+            v3 = (((32 / 1) > (v1 * a1[3][6])) != ((a1[0][8] ? a1[0][4] : v2) == (a1[1][13] == i6)));
+            a0[1] = (((52 * 99) != (v2 != a1[3][11])) - ((i7 < 94) + (a0[9] != a0[0])));
+        }
+    }
+    a1[3][11] = (((v3 - v2) != (v3 <= v3)) >= ((v3 <= a0[1]) >= (v2 ? v3 : v0)));
+    v2 = (((v2 < v3) <= (v1 <= 58)) / 8);
+    if ((((v2 / 6) && (a0[0] || v3)) ? ((v0 >= v3) && (v3 / 1)) : ((a1[2][13] * v2) != (v2 ? 14 : a0[15])))) {
+        v0 = (((v2 - 6) % 4) >= ((v0 > v3) / 7));
+        v2 = (((v3 && a1[2][0]) && (a0[1] >= v1)) * ((45 != a0[2]) != (v0 ? 68 : a0[8])));
+        v3 = (((97 % 7) > (v3 % 7)) && ((v1 + v2) > (a1[2][8] >= 58)));
+    } else {
+        a1[0][2] = (((63 / 1) < (1 < 69)) >= ((a1[0][0] > v0) ? (v3 || v2) : (v2 / 9)));
+        v2 = (((a1[1][11] / 7) < (a0[7] - a0[2])) <= ((a0[5] == v2) >= (v1 > v3)));
+        v0 = (((v2 < v0) ? (a0[1] && a1[1][4]) : (a0[7] != v0)) ? ((56 * a1[0][13]) || (66 || v1)) : ((a0[2] - v1) % 9));
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        v0 = (((a1[0][8] == v0) % 9) - ((66 ? 60 : a0[2]) || (a1[3][1] ? 45 : 52)));
+        for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+            a0[3] = (((a1[2][5] >= a0[11]) / 6) ? ((v3 % 2) && (v0 != i8)) : ((48 / 2) <= (96 == 69)));
+            a1[0][11] = (((54 + v0) >= (v2 ? i9 : a0[7])) / 1);
+            v1 = (((v3 && i9) / 5) != ((a1[1][12] || v0) != (v2 == v2)));
+        }
+        v1 = (((24 > v2) + (a0[5] % 8)) ? ((9 * a1[2][1]) >= (a0[3] < 17)) : ((v0 < v1) != (a1[0][14] / 2)));
+    }
+    v1 = (((a0[15] % 9) && (v3 != 3)) || ((11 >= v3) ? (v1 * a0[2]) : (v1 != a1[2][14])));
+    return (((v2 != a0[4]) <= (v2 ? v3 : a1[3][9])) >= ((v0 == v1) % 8));
+}
+int f21() {
+    int v0 = 6;
+    int v1 = 11;
+    int v2 = 74;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[1][0] = (((v0 % 2) ? (v0 % 9) : (a0[8] < i0)) / 1);
+                    v1 = (((55 ? 39 : v1) * (71 ? v3 : v1)) == ((i1 - v1) ? (35 % 8) : (v1 > v3)));
+                    a0[0] = (((a0[6] >= a0[4]) ? (a1[0][2] ? 32 : a1[0][3]) : (v3 < v0)) != ((v1 <= 24) ? (27 > 69) : (a1[0][4] < 59)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((61 && v2) * (a0[10] >= 54)) + ((v1 < v2) > (26 && a1[0][1])));
+            a0[12] = (((v0 != a0[10]) ? (v2 * v3) : (v0 + a1[3][0])) < ((v1 || v2) <= (i0 - i0)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    v0 = (((28 && v0) || (96 ? a1[0][6] : 32)) / 6);
+    v2 = (((76 / 8) ? (a0[0] / 1) : (v1 ? v2 : a0[1])) || ((v1 < v1) + (22 / 6)));
+    v0 = (((v3 * 18) == (v0 * v0)) >= ((v1 != v2) && (a0[9] ? 3 : 47)));
+    {
+        int i2 = 0;
+        do {
+            a0[1] = (((i2 || v2) != (42 >= 17)) / 2);
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((v0 - 2) || (v1 / 5)) > ((i3 < a0[9]) >= (v3 <= i3)));
+                v3 = (((i2 * v1) % 6) < ((a1[1][9] ? a1[2][14] : i3) && (v3 % 1)));
+                a1[0][15] = (((v2 == v2) % 7) >= ((v2 != 97) < (83 ? v3 : i3)));
+            }
+            v2 = (((52 * a0[12]) + (86 >= 46)) <= ((91 == v2) % 1));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v1 = (((v2 <= v2) || (30 + a0[4])) * ((v1 < v3) / 4));
+    v2 = (((21 <= v0) <= (7 >= v0)) % 2);
+    {
+        int i4 = 0;
+        do {
+            a1[0][9] = (((v3 == a0[13]) * (v1 == 6)) ? ((a0[3] % 5) - (a1[2][14] % 1)) : ((v3 == a0[14]) % 7));
+            a0[8] = (((65 - v1) > (a0[14] / 9)) || ((i4 + 51) / 7));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((89 <= a0[4]) % 7) / 5);
+                    v2 = (((a0[0] != v0) % 4) < ((78 / 5) && (20 % 9)));
+                    v2 = (((i5 || v0) < (v1 - a0[6])) ? ((v0 ? a0[8] : a0[2]) ? (40 + v1) : (a1[0][0] || 56)) : ((56 / 7) - (a0[3] < a0[0])));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            a0[15] = (((i6 * a1[3][12]) * (a0[3] <= v0)) == ((a0[0] / 1) >= (v3 ? 5 : i6)));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    v1 = (((92 == i6) && (v0 % 5)) / 6);
+                    v0 = (((a1[2][12] && v0) ? (v0 >= v2) : (a1[2][14] ? a0[12] : a1[2][15])) >= ((v3 * v3) < (50 < v3)));
+                    a1[3][4] = (((a0[6] % 1) ? (i6 ? a0[14] : v1) : (v0 || 1)) % 7);
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((a0[3] ? v2 : 40) != (v2 + i6)) <= ((v1 < v3) % 1));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v2 / 4) / 3) == ((70 / 8) ? (a1[2][8] && 10) : (v0 > v3)))) {
+        a0[8] = (((a1[2][15] == 49) <= (v2 % 1)) && ((21 - a1[0][9]) % 1));
+        v3 = (((v3 >= a1[1][10]) / 5) - ((82 == v0) && (v3 < v3)));
+        a1[0][0] = (((83 > v0) || (v0 ? 86 : 25)) ? ((a0[7] && v0) % 1) : ((v2 ? v0 : v3) || (v1 || v1)));
+    } else {
+        a0[6] = (((28 + v2) >= (v1 * a1[2][6])) >= ((95 <= 49) * (v0 % 4)));
+        v2 = (((a0[10] + v2) < (61 <= v1)) / 6);
+        a0[7] = (((a0[3] <= v3) != (v2 < a1[2][12])) > ((11 >= 53) >= (a0[4] / 2)));
+    }
+    return (((a1[0][6] == v3) + (a0[2] / 3)) < ((v3 ? v0 : a0[2]) - (90 <= 40)));
+}
+int f22() {
+    int v0 = 78;
+    int v1 = 99;
+    int v2 = 29;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a0[12] = (((v1 + i0) || (v0 * i0)) == ((a1[2][10] % 4) - (v1 || 34)));
+                    a0[10] = (((i0 == v1) + (i0 % 9)) <= ((52 <= v2) - (i1 + i1)));
+                    v0 = (((a0[10] >= v2) >= (v1 ? v2 : 21)) && ((a0[12] % 8) / 9));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[0] = (((v1 || 82) <= (i0 < v2)) || ((a0[9] / 6) != (a1[1][6] + i0)));
+            a0[0] = (((71 == a1[1][13]) / 5) && ((v3 > 7) > (v1 <= 91)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    v1 = (((6 && v1) ? (45 ? v2 : a0[15]) : (v3 / 5)) == ((99 && 76) > (42 * 34)));
+    if ((((a1[2][10] - 82) > (a0[9] == a0[6])) % 6)) {
+        v0 = (((v2 != a1[0][5]) == (97 > 16)) < ((85 && v1) ? (a1[2][15] && 48) : (a0[1] || a0[8])));
+        v1 = (((a0[14] ? v0 : a0[11]) % 7) / 9);
+        a0[8] = (((v1 + v2) * (v1 / 1)) || ((v3 < 66) ? (a1[3][12] != a1[1][6]) : (6 + 76)));
+    } else {
+        v1 = (((a0[13] % 2) + (a1[1][11] <= 89)) / 2);
+        v3 = (((v3 * a1[2][5]) ? (53 < a1[3][10]) : (28 != v2)) <= ((41 && v2) || (v1 >= v2)));
+        a1[1][3] = (((v2 ? v1 : v3) <= (v2 > v3)) ? ((a0[7] != v2) == (v0 || v1)) : ((v0 > v0) != (a1[0][8] != a1[2][14])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a0[6] = (((i2 < a1[3][3]) <= (v1 < a0[12])) + ((52 == 59) + (a1[2][1] / 5)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((v0 > i2) > 80) break;
+                    a0[11] = (((a0[1] % 6) && (67 == v0)) % 4);
+                    a0[3] = (((v1 < 70) + (i2 >= v0)) || ((v1 || v0) / 5));
+                    v3 = (((81 <= i2) * (i2 <= v1)) || ((v2 > v0) % 2));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[3][7] = (((a0[14] == v2) > (a1[0][13] > 46)) % 3);
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((v2 - v1) > 86) break;
+            a0[14] = (((v2 * v3) ? (v0 - i4) : (v3 ? i4 : v2)) >= ((81 - v2) <= (v3 != i4)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((68 + v0) >= (v2 % 2)) / 1);
+                    v3 = (((v3 ? 12 : a1[3][7]) - (a1[3][7] + a0[7])) != ((v2 && i4) * (a1[0][7] != 63)));
+                    a0[7] = (((a1[1][6] % 8) == (v1 || 39)) <= ((27 && v1) != (83 ? v2 : 6)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v2 = (((v2 ? 10 : 83) + (i4 <= v1)) < ((a1[2][4] > v1) == (i4 / 5)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v1 = (((i7 / 1) % 6) == ((i6 == 11) ? (a1[2][3] % 8) : (a1[0][5] == i6)));
+                    a0[6] = (((a0[3] + a0[9]) % 2) == ((i6 < v2) != (i7 + v0)));
+                    a0[9] = (((i7 / 5) % 4) / 1);
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((v0 ? v3 : v3) + (v0 + 57)) < ((a1[3][5] || 77) >= (v1 <= v1)));
+            v0 = (((a0[2] <= v3) ? (i6 || 29) : (a0[1] - a0[4])) > ((v1 ? a0[7] : i6) % 5));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    v0 = (((v0 && v1) < (v0 >= v1)) > ((v2 < v0) ? (a0[6] / 9) : (92 == a1[3][6])));
+    if ((((v0 < v3) + (v0 * v3)) > ((v3 ? v3 : a1[1][13]) > (v0 == v3)))) {
+        v2 = (((a1[3][11] != a0[15]) == (v1 || 27)) || ((v2 == 10) != (28 * 89)));
+        v1 = (((a1[1][15] && 56) == (a0[5] < v0)) ? ((a0[14] != a1[1][12]) && (a0[8] && 79)) : ((v3 < a0[12]) % 6));
+        a0[12] = (((v3 < 54) % 2) / 4);
+    } else {
+        v2 = (((v1 - a1[0][9]) >= (2 % 4)) % 3);
+        v3 = (((v0 / 1) ? (v1 <= 53) : (a1[3][5] ? v1 : a1[1][5])) - ((a0[14] / 9) < (a0[13] + a0[0])));
+        v3 = (((v3 / 3) || (a1[0][0] > v3)) % 4);
+    }
+    a1[2][12] = (((v2 + 81) % 1) < ((40 ? v1 : v0) && (v2 == v3)));
+    {
+        int i8 = 0;
+        do {
+            v0 = (((15 ? 21 : v3) != (a0[9] ? v3 : v1)) % 8);
+            v2 = (((56 % 9) - (30 / 1)) + ((a1[2][13] != 12) != (63 || i8)));
+            {
+                int i9 = 0;
+                while (i9 < 6) {
+                    a1[2][2] = (((a0[2] == 25) == (a1[0][5] ? 60 : a1[1][13])) ? ((51 + v3) < (v0 / 5)) : ((a0[3] - 88) / 6));
+                    a1[3][4] = (((v3 * i9) ? (33 != a0[3]) : (i8 > i9)) <= ((64 != v1) > (i9 > v3)));
+                    a1[2][13] = (((32 ? i9 : v0) - (i9 + 71)) ? ((a1[3][14] > 11) >= (a1[0][5] * v2)) : ((41 < i9) && (a1[2][6] ? i9 : a1[3][3])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    return (((a0[14] > v2) % 4) / 9);
+}
+int f23() {
+    int v0 = 25;
+    int v1 = 75;
+    int v2 = 54;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    a1[2][8] = (((a1[0][15] ? v0 : v2) != (v2 + v0)) >= ((v3 != v0) + (34 ? 22 : a0[5])));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((42 / 2) > (a0[5] != v1)) / 7);
+            v1 = (((10 || v1) / 5) % 5);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v1 = (((59 + 51) >= (v3 - i0)) - ((v0 - v0) <= (i0 / 8)));
+                    v1 = (((56 || v0) ? (i0 && v3) : (v3 * 10)) - ((v3 - v2) >= (v1 < v0)));
+                    a1[2][8] = (((v0 && v1) + (a1[2][9] * i1)) <= ((14 <= 49) >= (a0[9] - v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    v3 = (((68 > v2) > (90 == v0)) % 6);
+    v1 = (((a0[14] ? 69 : a1[1][6]) && (50 / 2)) % 6);
+    if ((((v3 || v1) < (v0 * v2)) * ((v3 >= v2) ? (v2 != 19) : (51 - a1[2][12])))) {
+        a0[4] = (((v2 ? v3 : a0[8]) / 4) <= ((69 < a1[1][10]) - (v3 + 4)));
+        a0[1] = (((v2 == 49) == (v2 > a0[0])) ? ((v3 * v0) >= (79 ? v1 : 27)) : ((v2 ? v0 : 85) * (97 % 7)));
+        v1 = (((v2 < v2) % 4) + ((18 >= v3) <= (v3 != a1[0][11])));
+    } else {
+        a1[2][4] = (((v3 ? v3 : 41) && (v0 % 8)) % 1);
+        v2 = (((90 ? v2 : a1[0][1]) - (v3 < v2)) == ((v0 <= v3) != (48 / 6)));
+        v0 = (((v0 == v0) <= (a0[2] && v0)) ? ((25 / 5) / 5) : ((56 - 53) != (a1[1][8] * a0[11])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v0 = (((v1 >= a0[1]) ? (v1 - a0[5]) : (a1[0][5] == v3)) ? ((i2 >= v0) + (v2 * 14)) : ((25 || i2) <= (v2 <= v0)));
+            v2 = (((a1[1][1] || a1[1][10]) <= (v1 - a0[6])) / 4);
+            {
+                int i3 = 0;
+                do {
+                    if ((v0 < v3) > 59) break;
+                    v1 = (((92 >= i2) - (a0[11] <= v1)) < ((8 >= a1[0][1]) >= (a1[0][2] + a1[0][8])));
+                    v2 = (((v3 <= v3) / 4) == ((11 <= 44) / 6));
+                    v3 = (((i2 > a1[3][6]) <= (72 % 3)) >= ((v3 - a1[0][4]) && (i3 - v2)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[0][4] * a0[13]) % 9) / 9)) {
+        v0 = (((a0[15] != v1) || (v0 * v1)) > ((v2 - 45) >= (v0 <= v1)));
+        a0[12] = (((91 <= 57) - (v3 != v3)) != ((v1 + v2) && (v3 < a0[5])));
+        a0[5] = (((99 + a0[9]) % 1) - ((v3 != 25) != (v1 <= v3)));
+    } else {
+        a1[3][2] = (((v0 ? v0 : a0[9]) || (v1 != 40)) + ((27 || a1[3][13]) && (a0[3] < v1)));
+        v0 = (((a1[3][0] < 54) || (53 >= v3)) < ((83 / 9) ? (93 > v0) : (a1[2][8] % 4)));
+        v3 = (((55 && a1[0][2]) > (v3 / 3)) <= ((v3 == 27) ? (v0 < v2) : (a1[0][7] - 80)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((v0 ? 61 : v0) % 4) % 5);
+            v3 = (((91 || 17) != (43 ? v3 : a1[3][5])) ? ((53 || v1) - (a0[5] ? i4 : 97)) : ((v2 ? 8 : i4) != (a1[2][1] != 17)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v1 = (((v1 * v2) / 2) + ((9 <= a1[3][9]) && (93 + v1)));
+                v2 = (((i4 >= a1[3][13]) - (v2 == a0[3])) && ((a1[0][9] != v0) ? (v0 / 4) : (74 >= i4)));
+                a1[1][1] = (((i4 * v0) / 7) ? ((17 == v2) && (a1[1][8] % 8)) : ((v3 % 6) > (77 != v3)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                a1[3][7] = (((a0[14] || 10) * (a1[0][14] != v3)) <= ((a1[1][8] ? i6 : a0[5]) || (i7 * a0[3])));
+                v0 = (((v2 || v3) - (v2 >= 30)) + ((v0 ? i7 : v1) ? (22 * i7) : (v2 * 35)));
+                v0 = (((i7 + a0[0]) % 7) - ((75 % 7) ? (v0 * i7) : (97 <= v0)));
+            }
+            v2 = (((99 <= 65) < (i6 < i6)) >= ((15 == v1) >= (v1 && v1)));
+            v0 = (((16 >= a1[2][10]) != (a0[15] <= v0)) != ((54 && v3) && (a0[1] + a1[3][0])));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            while (i9 < 3) {
+                a1[1][15] = (((v3 ? 3 : a0[1]) > (59 >= v0)) * ((a0[9] < a1[0][11]) >= (76 / 9)));
+                v0 = (((15 || i8) > (v1 && v3)) != ((i9 != v1) ? (v2 == 12) : (a1[2][11] ? a1[3][2] : i8)));
+                v0 = (((a0[9] + a0[0]) * (a0[15] * v3)) && ((i9 && v0) != (a1[2][10] + a1[1][8])));
+                i9 = i9 + 1;
+            }
+        }
+        v2 = (((v1 ? a1[1][11] : v3) > (v0 <= 42)) == ((a0[5] > 43) ? (v3 + a0[7]) : (16 < 27)));
+        a1[1][2] = (((v3 || v2) % 4) && ((v1 && v2) - (13 > v0)));
+    }
+    return (((a1[2][13] - 86) == (a1[2][9] < v3)) >= ((a0[13] || 80) ? (v1 ? a0[5] : v0) : (v1 ? v3 : v3)));
+}
+int f24() {
+    int v0 = 70;
+    int v1 = 34;
+    int v2 = 12;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a1[1][8] = (((16 + 35) != (v2 ? v0 : v2)) <= ((a0[13] >= 62) / 5));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            a0[10] = (((25 / 4) ? (2 ? v1 : v2) : (v3 <= v3)) && ((v0 - 81) >= (i0 < v0)));
+            v2 = (((v3 - i0) - (67 ? v0 : a0[9])) < ((a1[1][4] * 40) != (37 <= i1)));
+            a1[2][15] = (((v0 * v3) % 1) || ((17 > i1) ? (a1[3][13] < 98) : (72 != 80)));
+        }
+        v3 = (((a1[3][15] > v2) - (7 && v3)) <= ((a0[4] >= 60) % 9));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v0 = (((4 >= 32) != (v0 * 77)) ? ((a1[1][3] * a1[2][2]) ? (v3 && v3) : (i2 == i2)) : ((a1[3][10] * v0) + (v0 != i2)));
+            v2 = (((59 * a0[6]) < (v1 || v3)) ? ((v2 < i2) ? (a0[2] ? i2 : v2) : (47 / 5)) : ((v0 == 86) || (i2 > a0[4])));
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[0][6] ? i3 : i3) > 82) break;
+                    a0[9] = (((v2 < a0[15]) <= (a0[1] <= 54)) && ((v0 ? 83 : 94) > (v1 ? v3 : v3)));
+                    a1[0][15] = (((66 % 5) && (v0 / 6)) <= ((a0[11] > a1[3][5]) == (v3 != i3)));
+                    v1 = (((v1 >= v1) <= (a0[12] / 1)) || ((v2 + i3) - (v0 + a1[3][13])));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v2 != v2) && (a1[1][12] + 14)) / 1);
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v1 = (((v3 != v3) % 1) == ((v0 + a1[2][4]) > (v0 / 3)));
+            v3 = (((v2 ? i4 : v2) + (48 + 14)) / 3);
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v2 = (((v2 <= 41) + (90 % 2)) || ((34 / 1) < (a0[11] != i4)));
+                a0[14] = (((34 + a0[6]) >= (a1[2][8] < a1[1][3])) / 5);
+                v2 = (((i4 >= a1[1][2]) > (i4 && a1[2][7])) ? ((a0[14] != v3) ? (a1[3][13] >= v3) : (v1 < i4)) : ((v2 * 58) || (63 * a0[2])));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((81 <= v0) || (v3 - a0[10])) != ((v3 == a1[0][2]) == (33 == v1)))) {
+        v0 = (((v0 && v1) + (v0 % 3)) != ((86 || a0[4]) + (v1 || a0[5])));
+        v0 = (((v1 > a1[1][10]) + (v1 > a1[1][2])) % 6);
+        v3 = (((13 < a0[6]) == (a1[3][13] * v0)) - ((31 * a1[3][5]) || (34 / 9)));
+    } else {
+        v2 = (((v2 * a1[1][14]) != (v1 + 30)) + ((v0 * v1) / 6));
+        a1[0][10] = (((91 * v2) || (a0[13] <= v2)) > ((a1[3][3] == v0) - (v1 % 9)));
+        v1 = (((v3 && v2) >= (18 % 5)) < ((50 / 7) * (v0 >= v0)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v3 = (((a1[3][3] == v0) >= (v0 / 6)) ? ((a1[1][8] != v3) == (27 > v3)) : ((v0 < 4) ? (v3 < v2) : (i6 > i6)));
+            a0[1] = (((a0[1] > i6) / 8) >= ((v3 != a1[3][8]) && (v0 <= 45)));
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((68 / 2) > 75) break;
+                v2 = (((i6 * a1[0][6]) == (v1 / 6)) - ((89 <= 23) || (a0[7] && v3)));
+                v3 = (((a1[3][15] + v1) + (16 ? v0 : 58)) == ((75 % 4) || (v0 && a1[0][14])));
+                v0 = (((v0 % 5) >= (80 % 2)) - ((73 < v3) && (73 >= v3)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v1 = (((v1 > v3) != (a1[1][5] >= v0)) < ((v0 / 5) == (7 >= v0)));
+    v1 = (((a1[0][1] && a1[2][2]) != (v0 != v3)) > ((69 - 87) ? (v1 == 25) : (v1 <= v0)));
+    {
+        int i8 = 0;
+        do {
+            if ((11 <= i8) > 83) break;
+            a0[4] = (((i8 * v2) != (30 && v1)) / 2);
+            for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+                v0 = (((a0[7] + 62) / 1) % 5);
+                v1 = (((56 != i8) - (74 ? v2 : a0[13])) * ((v0 < v0) || (1 <= i9)));
+                v2 = (((v0 > v1) <= (v1 && 11)) == ((v3 < a1[3][15]) != (v3 > 41)));
+            }
+            v2 = (((a1[2][15] - a1[2][11]) / 2) < ((v3 >= 59) < (a1[0][11] * a1[0][12])));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    a0[6] = (((v3 >= 5) ? (v0 == a1[3][0]) : (v2 > a0[0])) % 2);
+    return (((38 - 18) >= (2 || v2)) >= ((v3 == v1) - (a1[1][15] == a0[14])));
+}
+int f25() {
+    int v0 = 61;
+    int v1 = 15;
+    int v2 = 46;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v3 = (((a0[13] ? a1[2][13] : a1[1][9]) / 7) != ((i0 != v2) == (a0[3] >= a0[10])));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v0 = (((v3 && 64) * (a0[1] <= 81)) < ((v2 / 7) && (a0[12] > 86)));
+                v1 = (((6 && v1) % 7) ? ((i1 < a0[10]) * (a1[1][7] - 61)) : ((v0 > v0) % 7));
+                v1 = (((i0 + a0[5]) > (35 >= a0[13])) + ((v1 % 1) - (v1 - v2)));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((84 * 12) / 7) * ((v1 ? v0 : v1) ? (a1[0][4] - a1[3][13]) : (a0[8] ? 73 : v1)));
+    }
+    if ((((67 < v1) < (v3 < v3)) == ((a0[14] >= v1) > (98 < 25)))) {
+        v0 = (((a0[11] + a1[2][11]) != (a0[9] / 4)) != ((v2 >= v1) % 7));
+        v3 = (((v2 + v0) == (a1[2][11] >= 76)) == ((v1 * a0[13]) < (98 ? v3 : 71)));
+        v0 = (((v1 >= v1) && (v0 + a0[0])) >= ((24 * 10) - (a0[8] ? 64 : 38)));
+    } else {
+        a1[0][11] = (((a0[13] != a1[2][2]) < (a1[3][0] != a0[7])) >= ((v3 ? a1[0][12] : v3) > (82 ? a0[1] : v0)));
+        v1 = (((v3 > v1) % 4) % 2);
+        v2 = (((a0[2] == v0) != (a1[1][4] || 64)) ? ((a1[3][9] % 7) >= (v0 || a1[3][10])) : ((v0 - 80) > (a1[3][10] != 7)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v3 = (((a1[1][10] && i2) == (v0 / 1)) || ((i2 + 33) || (99 == a0[2])));
+            a0[6] = (((i2 <= v0) || (70 || 44)) && ((a0[15] && 87) + (a1[1][8] != a1[1][14])));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v0 = (((45 != v1) > (65 / 1)) ? ((v0 || 94) - (a1[3][2] >= a0[15])) : ((a0[15] % 9) % 1));
+                a0[11] = (((i2 * 27) > (v2 - 27)) < ((a0[0] && a0[8]) - (a1[0][3] || v3)));
+                v3 = (((i3 || a1[2][7]) % 1) ? ((v3 == a0[4]) <= (a0[2] / 7)) : ((69 ? i3 : v1) == (v3 >= i3)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v3 != 0) > (v3 ? v3 : v2)) / 9)) {
+        v2 = (((v3 > a1[2][7]) - (v3 ? v0 : a1[1][11])) + ((a1[0][11] * 99) % 3));
+        v2 = (((28 - v2) || (42 <= a1[3][0])) != ((v3 < 64) < (v0 == 1)));
+        a1[1][5] = (((v0 + 93) != (a0[1] + v1)) || ((v2 ? v1 : v3) + (a0[1] >= 86)));
+    } else {
+        a0[1] = (((a0[14] % 7) > (47 != 73)) >= ((v2 - v2) <= (v3 ? a0[11] : v2)));
+        v0 = (((a0[14] && v3) == (v0 != a1[0][7])) >= ((48 == v3) && (a1[1][7] ? v1 : a1[2][5])));
+        v1 = (((a0[9] <= v3) == (v1 ? a1[0][2] : a0[9])) != ((42 ? v3 : v0) == (a1[0][8] ? v3 : v2)));
+    }
+    a0[0] = (((v3 ? a0[14] : v2) < (49 <= v0)) % 4);
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[12] = (((a0[9] - v2) <= (86 > a1[3][5])) % 1);
+            v3 = (((v0 * i4) && (v1 + v3)) % 7);
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v0 = (((v2 / 8) ? (a1[1][3] <= a1[1][4]) : (a1[1][4] && v0)) > ((a0[3] ? a0[11] : i5) ? (40 % 8) : (a1[2][12] > 7)));
+                v3 = (((a1[3][6] > a1[0][13]) - (v0 && a1[2][8])) ? ((v2 - v2) != (i5 * i5)) : ((i4 <= i4) && (v1 > v1)));
+                a0[9] = (((i4 >= i4) == (i4 != a1[3][0])) == ((v1 > i5) - (v2 / 4)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            a0[8] = (((a0[5] <= a0[5]) > (30 <= a1[0][11])) || ((a0[15] < v0) + (a0[15] != v0)));
+            v3 = (((v2 != v2) * (v1 < i6)) <= ((59 <= v0) + (v1 > v3)));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((i6 - a1[2][5]) > 99) break;
+                a0[12] = (((4 * v0) == (v1 <= i6)) < ((v2 < 7) >= (a0[3] < i6)));
+                a0[14] = (((v0 != 72) <= (17 >= v3)) == ((a1[2][12] / 3) == (i6 - a1[3][13])));
+                v1 = (((v1 <= v1) / 4) >= ((i6 * 37) ? (27 != 88) : (i6 >= 45)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        a0[4] = (((76 - v3) == (v2 != a1[3][8])) * ((a1[3][1] / 3) % 8));
+        v2 = (((v0 ? a1[2][15] : 74) ? (96 != v0) : (v1 == v1)) > ((v2 / 5) - (9 < 68)));
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                v2 = (((a1[3][15] < v3) * (a1[0][4] < 81)) * ((48 ? i9 : v1) <= (i8 < 59)));
+                a1[2][13] = (((a0[13] >= v1) + (a0[12] / 8)) / 8);
+                v2 = (((i9 < 72) >= (34 != a0[15])) >= ((i9 <= a0[15]) || (4 <= i9)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    if ((((a1[2][3] / 7) > (76 < a0[10])) * ((v0 ? v1 : 51) / 7))) {
+        v2 = (((v0 ? v0 : 23) < (v1 - a1[0][13])) % 7);
+        a1[1][12] = (((70 != v0) ? (14 > v1) : (v2 * v2)) <= ((v2 == 41) == (45 % 5)));
+        v1 = (((v0 > v1) != (v1 <= 65)) ? ((v1 <= 80) >= (a0[7] < 92)) : ((v0 >= v0) ? (92 < 13) : (a1[0][9] % 4)));
+    } else {
+        a0[11] = (((5 < v3) && (97 > v3)) < ((a0[4] > v0) > (78 && v2)));
+        a0[13] = (((72 || 88) / 2) % 2);
+        v2 = (((v2 != 38) ? (v0 != a1[3][6]) : (v2 + a0[9])) > ((a1[2][2] && v1) >= (46 >= 64)));
+    }
+    if ((((v0 ? v2 : a1[0][13]) == (v2 == v2)) >= ((v2 ? v0 : a1[2][7]) < (v0 / 8)))) {
+        v0 = (((v2 % 6) % 4) % 3);
+        v2 = (((v2 * v2) > (a0[3] * v2)) || ((6 || a0[5]) - (0 + 84)));
+        v1 = (((v3 ? a0[10] : a0[2]) * (14 ? a0[10] : 6)) > ((v2 <= 36) || (a1[3][8] + 28)));
+    } else {
+        v3 = (((v0 > 79) / 2) % 7);
+        v2 = (((v1 ? a1[3][4] : a1[0][5]) < (v3 < v2)) ? ((28 > v0) > (v2 % 1)) : ((a1[2][14] ? a0[2] : v2) % 4));
+        v2 = (((v3 <= 57) != (v2 > v2)) || ((a0[9] / 4) % 1));
+    }
+    return (((58 > v1) <= (a1[1][7] - 29)) != ((v0 + v3) > (a1[3][0] * v1)));
+}
+int f26() {
+    int v0 = 54;
+    int v1 = 85;
+    int v2 = 73;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((56 < 91) > 61) break;
+            v2 = (((v2 || i0) * (a0[11] != a1[2][5])) * ((v3 <= i0) ? (72 <= 87) : (v0 + 55)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v3 = (((a1[3][7] + a1[3][11]) / 7) != ((v0 == v3) != (65 > 41)));
+                v3 = (((i0 > a0[12]) * (v2 == v0)) != ((a1[2][1] * 88) != (v1 > 79)));
+                v2 = (((1 / 5) && (18 != a1[0][5])) < ((v2 < v1) != (v2 + v0)));
+            }
+            a0[6] = (((a0[10] >= 97) <= (i0 ? v3 : i0)) <= ((v1 < i0) / 4));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 * 95) <= (v3 < a0[4])) ? ((v3 <= 75) % 4) : ((v2 % 7) ? (74 == v0) : (a1[3][4] && v1)))) {
+        v3 = (((v0 / 9) == (v0 * 62)) <= ((v1 * v2) * (v1 ? v0 : a0[13])));
+        v2 = (((a1[2][6] && 88) < (a0[5] == 90)) != ((69 || v0) > (20 % 1)));
+        v1 = (((v0 % 6) < (v3 == 50)) == ((v0 || v3) && (v2 >= a1[2][10])));
+    } else {
+        v3 = (((v2 > a1[3][5]) * (v0 && v0)) * ((v0 >= 64) ? (a0[3] / 6) : (v1 == 53)));
+        a0[7] = (((64 / 6) % 5) && ((v3 ? v2 : v2) % 5));
+        v3 = (((a0[1] <= v0) != (v1 == a0[3])) / 5);
+    }
+    if ((((11 == v3) % 1) >= ((v2 + a0[13]) == (v0 > a1[0][13])))) {
+        a0[7] = (((60 - a0[9]) >= (v1 - a0[15])) != ((v3 >= v2) < (v2 / 7)));
+        v1 = (((v0 - 39) ? (66 ? v1 : a1[0][8]) : (v3 <= v2)) < ((a1[2][15] || 59) == (v0 > a0[12])));
+        v0 = (((v2 - v0) && (v2 / 6)) + ((a0[8] - v3) || (v1 == v3)));
+    } else {
+        v3 = (((v2 > 57) / 5) + ((v0 == v0) + (27 ? v2 : v1)));
+        v0 = (((a1[1][12] > v2) && (74 < v3)) - ((a0[11] * v0) / 8));
+        v1 = (((a1[3][9] + a0[10]) && (9 != 56)) ? ((a1[1][5] >= 56) == (v3 % 7)) : ((95 * v0) ? (v0 - v0) : (v1 - v2)));
+    }
+    if ((((v1 || 92) ? (v2 || v1) : (61 + v2)) != ((a0[13] + a1[1][11]) == (v2 == a1[0][14])))) {
+        v0 = (((92 && v1) < (58 > v0)) < ((v3 != v1) == (v2 < v1)));
+        v1 = (((v0 - a1[3][4]) || (96 && v0)) != ((41 > a0[8]) + (v2 % 2)));
+        a0[14] = (((v2 && 92) * (v0 ? a1[2][10] : v1)) == ((v1 - 54) ? (30 && a1[3][11]) : (a1[1][1] ? v3 : v0)));
+    } else {
+        v1 = (((61 * 63) >= (v1 / 3)) ? ((v1 % 7) <= (v0 / 2)) : ((v2 < v1) > (86 ? 64 : v3)));
+        v1 = (((v3 / 6) % 7) / 4);
+        v3 = (((v1 == v0) == (v2 >= a1[0][9])) * ((79 || 53) > (a0[11] >= 31)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((v2 && v3) > 60) break;
+        a0[2] = (((v3 <= v2) + (v0 && v0)) && ((20 % 3) - (13 / 8)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v3 = (((30 % 2) % 9) * ((v2 == 92) ? (v3 != v0) : (v0 == 91)));
+            v0 = (((99 ? a0[10] : v1) < (a0[3] - v1)) != ((a0[6] < a1[0][9]) * (a0[3] != v3)));
+            v1 = (((a1[1][3] && a0[9]) > (a0[4] && v1)) - ((v1 != 63) * (16 && 61)));
+        }
+        a1[1][9] = (((50 != v1) / 2) + ((a0[4] != v1) ? (a0[8] / 4) : (v0 < a1[3][4])));
+    }
+    v3 = (((a1[3][0] / 3) > (a0[9] % 5)) ? ((v1 == v2) / 2) : ((63 > 39) * (19 ? 89 : 41)));
+    {
+        int i4 = 0;
+        do {
+            a1[1][0] = (((a0[14] || v1) >= (53 / 7)) ? ((i4 > 16) > (v1 ? v1 : v0)) : ((v2 ? v2 : i4) <= (v0 <= 43)));
+            a1[2][6] = (((a1[2][15] + v2) != (v1 == v2)) * ((33 ? a0[0] : a1[0][3]) > (a0[6] > a0[15])));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((2 ? v0 : i4) / 3) - ((v2 * a0[9]) * (v1 < a1[2][8])));
+                    v3 = (((i4 <= v2) && (a0[15] && v3)) != ((v0 >= v0) * (v3 * v1)));
+                    a1[3][0] = (((i5 - v1) * (a1[0][9] || i4)) + ((a1[3][15] + 29) % 5));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    v1 = (((v2 % 3) % 2) ? ((a0[2] > v3) / 3) : ((a1[3][0] == v2) / 4));
+    if ((((v0 < v3) - (a0[4] * a0[14])) > ((v1 && v0) >= (v0 * v3)))) {
+        a0[11] = (((46 && v2) ? (a1[2][2] == a1[0][9]) : (v1 ? a1[0][1] : a0[9])) + ((v2 == 13) ? (v3 * 1) : (v2 < v0)));
+        a1[2][3] = (((v0 <= v2) % 3) + ((v3 ? 87 : v0) > (a1[0][10] < v1)));
+        v0 = (((v0 >= 2) <= (a1[0][8] < v0)) && ((v3 + v3) - (a0[14] || 34)));
+    } else {
+        a0[11] = (((v2 == 88) ? (19 >= v3) : (v2 + 96)) < ((29 != a1[1][0]) > (v0 == v2)));
+        v1 = (((a1[3][13] ? 86 : 44) != (a0[14] != a0[7])) - ((v3 ? a1[2][8] : v3) <= (65 <= v2)));
+        a1[1][7] = (((v2 != a1[0][12]) * (v1 < a0[6])) && ((87 - a1[2][13]) <= (v3 - v2)));
+    }
+    a0[1] = (((v1 * a0[6]) + (a0[12] % 1)) ? ((v1 - v1) % 4) : ((a1[2][3] + v1) || (a1[2][10] * v1)));
+    return (((a0[1] || 68) != (20 / 5)) == ((a0[5] ? v2 : 96) % 4));
+}
+int f27() {
+    int v0 = 70;
+    int v1 = 12;
+    int v2 = 24;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v1 = (((i0 >= 96) ? (a0[6] != v2) : (a1[2][1] < v0)) / 7);
+            {
+                int i1 = 0;
+                do {
+                    if ((v3 > 35) > 60) break;
+                    a0[11] = (((a0[7] % 7) ? (v2 && i1) : (15 && a0[2])) >= ((36 == a1[2][4]) != (54 == i1)));
+                    a0[2] = (((a0[3] <= v3) ? (72 < v1) : (i1 != v1)) / 7);
+                    v2 = (((28 && 53) - (i1 + 41)) % 3);
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v0 = (((44 != a1[1][6]) != (v0 < a1[3][14])) / 1);
+            i0 = i0 + 1;
+        }
+    }
+    a0[3] = (((v1 && 31) || (v2 ? v3 : a1[3][3])) >= ((v2 != a0[7]) ? (59 ? v2 : v1) : (a0[7] / 1)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((a1[3][9] != a1[2][13]) && (15 / 4)) + ((a1[3][2] >= 19) - (v1 > v0)));
+                    v2 = (((a1[1][6] <= v2) ? (v1 ? 6 : v2) : (v1 || v2)) <= ((v2 == v3) + (73 == v1)));
+                    v2 = (((i2 / 4) * (a1[1][6] > i3)) == ((a1[2][0] >= v0) - (96 > a1[3][12])));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[0][0] = (((v0 % 6) != (v0 / 5)) * ((v1 % 3) - (v0 ? a0[2] : a0[8])));
+            v1 = (((i2 ? a0[3] : v0) == (v3 >= v0)) % 9);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((98 / 8) > (26 <= 98)) >= ((v2 / 7) > (v3 - v0)))) {
+        a0[7] = (((53 ? v1 : 95) && (v3 - a0[14])) ? ((v2 && v1) >= (v0 && v3)) : ((v2 <= 59) != (v2 ? 21 : v1)));
+        v1 = (((v3 % 6) && (v1 - a0[2])) * ((81 ? v2 : 62) != (v0 == v0)));
+        v0 = (((a1[1][8] ? v1 : v0) == (a1[3][14] > a1[3][14])) / 4);
+    } else {
+        v0 = (((a0[3] || 42) || (a0[9] >= v3)) - ((a0[6] ? 13 : 30) || (v0 <= 49)));
+        v0 = (((v0 / 1) <= (19 && v0)) - ((v2 != a0[12]) <= (68 + v0)));
+        a0[5] = (((72 / 3) * (v3 == v1)) + ((v3 * a1[0][2]) + (a1[0][9] * a1[0][11])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            a1[3][4] = (((v3 > 93) * (v1 % 7)) != ((v1 != a0[9]) || (a1[3][15] - a0[5])));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v0 = (((27 % 6) >= (34 / 6)) ? ((52 || v3) ? (v1 - i4) : (a0[7] % 7)) : ((v1 != 81) ? (a1[3][6] || v1) : (a0[8] * 89)));
+                    v3 = (((v3 ? 89 : a0[3]) - (v0 - v1)) >= ((v3 ? 22 : 35) * (a1[3][8] + v1)));
+                    a0[5] = (((v0 ? a0[7] : i4) * (68 == 33)) && ((43 % 7) <= (85 / 2)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((a0[15] / 9) - (v1 <= a0[12])) ? ((a1[2][7] * a0[11]) ? (a1[3][8] / 9) : (86 / 9)) : ((v3 ? v1 : v3) > (94 == v1)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            v3 = (((37 || v3) / 4) && ((v0 == v1) > (a1[0][0] && 50)));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                a0[12] = (((a1[2][12] >= v1) || (99 / 3)) ? ((13 - a0[13]) > (i6 >= a0[4])) : ((v3 ? i6 : a1[1][11]) != (i7 == v0)));
+                v0 = (((i7 == 60) ? (a1[0][11] > a1[3][3]) : (v0 || v2)) ? ((a1[3][2] > a0[3]) <= (i6 < a1[1][11])) : ((a0[5] - 11) != (v1 ? a1[3][15] : a1[2][9])));
+                a1[1][9] = (((i6 % 3) ? (i7 <= i6) : (v3 < v3)) && ((v0 < 29) - (i7 * 89)));
+            }
+            a0[12] = (((v2 != 2) <= (v2 == v1)) && ((75 >= v1) <= (v2 % 3)));
+            i6 = i6 + 1;
+        }
+    }
+    v3 = (((v1 < a1[3][12]) ? (70 > v3) : (a1[0][12] > v3)) >= ((v3 >= v0) && (v0 >= v2)));
+    a0[4] = (((v0 > v2) ? (a0[5] >= 62) : (v2 >= 39)) + ((a0[9] / 8) + (v1 >= v0)));
+    v2 = (((v3 > v2) * (v3 == a0[13])) ? ((a0[1] <= v2) <= (v3 > v0)) : ((33 * 93) == (81 != v2)));
+    if ((((v1 == 68) <= (v2 - v0)) - ((v2 <= 90) / 6))) {
+        a1[1][7] = (((a0[4] > a1[2][2]) <= (2 ? v0 : v0)) <= ((v3 * a1[0][0]) + (23 || a1[1][11])));
+        v0 = (((a1[2][6] ? v2 : v0) > (54 % 2)) == ((v2 < v0) < (v1 + v2)));
+        v2 = (((88 && v2) < (a1[3][5] || 90)) > ((v1 / 2) || (a1[3][14] + v0)));
+    } else {
+        v2 = (((1 * v2) < (v0 / 5)) != ((a1[3][6] % 8) <= (8 != 94)));
+        v0 = (((v1 == a1[2][9]) % 3) + ((v0 + 66) ? (v3 - v2) : (v0 + v0)));
+        a1[0][11] = (((v1 + a1[3][1]) != (98 ? v3 : a0[3])) && ((v0 - v1) / 3));
+    }
+    return (((v3 - v2) > (a1[2][1] ? v2 : a0[11])) <= ((v0 != 67) / 7));
+}
+int f28() {
+    int v0 = 85;
+    int v1 = 34;
+    int v2 = 49;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a1[1][0] = (((v2 * 87) / 4) >= ((v3 > 90) ? (a1[0][6] - a0[2]) : (v2 <= i0)));
+            v3 = (((v0 * 65) - (v0 ? i0 : 37)) % 4);
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[2][6] < a1[1][13]) > 64) break;
+                    a1[0][8] = (((a1[1][4] != i0) ? (i0 >= v0) : (v0 && i1)) != ((a1[3][1] ? i1 : 78) < (i1 >= i0)));
+                    v2 = (((a0[10] - 39) % 5) && ((16 * v3) == (i0 + v0)));
+                    v0 = (((v3 > 84) % 8) ? ((a0[15] % 2) % 1) : ((a1[3][3] == i1) * (v1 <= v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[0][8] = (((v2 ? 44 : i2) < (v0 >= v2)) ? ((v1 / 7) != (v3 == v0)) : ((72 * v3) || (v1 + a0[4])));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v0 = (((71 || 37) + (a1[3][4] > i3)) < ((a0[10] >= 73) ? (i3 * i2) : (v2 * v0)));
+                    v3 = (((31 * v2) / 8) % 1);
+                    v3 = (((v1 + i3) && (a0[1] > i3)) >= ((a0[11] < v2) != (i2 ? a0[14] : v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((v0 / 6) ? (v1 > v0) : (92 < i2)) % 6);
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((v2 <= v1) % 3) ? ((a1[0][11] / 3) <= (29 <= a1[0][9])) : ((v3 ? a1[2][4] : a1[0][13]) < (87 == a1[0][6])))) {
+        a0[5] = (((v3 % 4) && (a1[2][10] * 18)) ? ((v1 ? v0 : 26) || (9 && a0[7])) : ((v0 % 8) >= (a1[2][14] == v0)));
+        v2 = (((v0 % 9) || (v2 || v1)) > ((a0[12] >= 24) < (a0[9] <= v1)));
+        v3 = (((48 <= v2) <= (v1 % 8)) <= ((v3 / 3) == (v0 != v0)));
+    } else {
+        v1 = (((a0[2] && v2) == (v3 >= 80)) ? ((a0[10] == a1[3][7]) >= (92 && v1)) : ((v3 ? v3 : v0) == (v2 < a0[12])));
+        v2 = (((v2 - a0[3]) >= (68 ? v3 : 58)) > ((v1 >= v1) < (a0[7] / 7)));
+        v2 = (((a0[3] > a0[14]) + (87 >= v3)) < ((v0 || v1) && (a0[9] && v3)));
+    }
+    if ((((v1 / 6) < (v2 * 34)) + ((v3 * a0[5]) != (v2 * v1)))) {
+        a1[0][5] = (((a1[3][13] ? v2 : a0[0]) + (a1[3][15] - v0)) > ((v1 > v2) < (60 <= a0[10])));
+        a0[15] = (((v1 > a0[1]) ? (a0[14] != a1[2][15]) : (v1 == v2)) || ((17 - v2) ? (95 || v1) : (v3 / 3)));
+        v1 = (((v0 <= 46) && (52 == v2)) ? ((a0[5] == v3) >= (v0 / 9)) : ((a0[8] % 1) + (a0[15] + 40)));
+    } else {
+        v3 = (((v3 && 90) != (v2 || 88)) > ((v2 <= v0) - (v0 ? v3 : v0)));
+        v0 = (((v1 != 79) ? (a1[2][7] / 1) : (7 && a1[2][0])) <= ((58 > v1) != (a1[3][15] % 7)));
+        v3 = (((a0[11] == v0) <= (a1[3][2] != v1)) && ((v3 || v0) ? (v2 ? v0 : 99) : (a0[10] >= v0)));
+    }
+    v0 = (((v1 > v2) >= (75 - v2)) % 9);
+    if ((((v3 < 87) && (v2 >= 80)) != ((v3 + a1[3][8]) ? (78 * 18) : (v3 / 2)))) {
+        v2 = (((74 && v0) + (v0 < 95)) > ((a1[3][5] ? v1 : a1[2][8]) < (v3 != 13)));
+        v3 = (((57 >= v1) - (v1 - a0[7])) ? ((v2 != 19) % 6) : ((v0 ? a1[0][9] : a1[1][9]) <= (34 == 95)));
+        v3 = (((v0 / 2) + (a0[6] ? 41 : v3)) != ((a0[15] == v1) ? (a0[2] % 9) : (v2 % 1)));
+    } else {
+        a1[3][5] = (((v2 ? v1 : v3) == (a0[10] % 4)) == ((57 % 9) == (27 % 2)));
+        v2 = (((a0[9] * v3) ? (16 && a0[12]) : (a1[3][10] ? a1[0][15] : v0)) || ((v1 % 9) / 8));
+        v3 = (((a0[12] % 8) ? (v1 > v3) : (70 % 6)) ? ((21 || a1[2][0]) < (41 && v0)) : ((10 == v3) ? (v2 * v0) : (a1[3][10] - 15)));
+    }
+    a0[15] = (((v2 < 33) && (a0[2] <= v3)) <= ((a0[7] >= v1) <= (13 >= v2)));
+    v0 = (((v3 != v0) && (a1[0][13] * v2)) % 5);
+    if ((((v2 - v2) && (82 + a1[1][10])) != ((v3 >= v3) ? (a0[3] > 41) : (v1 ? v1 : v2)))) {
+        a0[3] = (((a0[14] % 5) <= (v1 / 4)) * ((v3 * v0) / 7));
+        v2 = (((a1[3][10] ? v0 : 18) < (v3 >= a0[14])) == ((a1[0][8] != v3) > (v2 > a1[2][13])));
+        v3 = (((v3 || v1) != (v3 >= 34)) * ((74 <= v2) - (a1[3][5] * v3)));
+    } else {
+        v2 = (((a0[15] > a1[3][9]) || (a1[0][15] && a1[3][15])) + ((v0 ? a1[2][8] : a0[10]) + (v3 && v0)));
+        a0[15] = (((39 - a0[15]) ? (v0 <= v2) : (v2 != 77)) ? ((v3 * v1) % 2) : ((v2 >= a0[8]) >= (29 != 82)));
+        v2 = (((v1 - 44) % 2) % 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                a0[8] = (((77 >= 55) ? (17 ? 8 : v1) : (v0 * v0)) && ((a0[2] + a0[11]) > (a0[9] > a1[0][4])));
+                v0 = (((44 / 4) >= (a0[6] > a1[0][9])) * ((i4 ? i5 : v2) >= (a1[2][4] ? i4 : 85)));
+                a1[2][2] = (((v3 == v0) <= (a1[2][3] < a1[3][9])) - ((24 / 1) == (85 != i5)));
+            }
+            a0[3] = (((v2 * i4) && (85 < i4)) != ((a0[3] < v3) <= (v1 ? v1 : v0)));
+            v0 = (((v2 / 6) ? (80 || v0) : (v2 >= v2)) == ((a0[0] % 2) - (15 < 81)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v2 % 3) && (v3 ? 5 : v3)) || ((99 / 1) && (v2 * 35)));
+}
+int f29() {
+    int v0 = 59;
+    int v1 = 86;
+    int v2 = 75;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[15] % 6) == (a1[2][11] % 9)) != ((a1[3][7] + v1) < (v3 && 17)));
+    v1 = (((35 <= v2) / 2) % 8);
+    a1[3][10] = (((a1[1][3] >= v1) + (a1[2][1] == v3)) < ((v0 && a0[13]) - (v0 ? v0 : v3)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((v3 == 43) > 82) break;
+                v2 = (((a1[1][7] && a0[4]) == (v1 * 28)) && ((a0[11] == i0) != (2 && i1)));
+                v0 = (((64 < v0) + (v1 == v1)) != ((30 && v3) % 4));
+                v2 = (((i1 == i1) * (44 / 5)) && ((i0 != a0[10]) < (i1 <= i1)));
+            }
+            v2 = (((v1 != a1[2][13]) * (9 ? v2 : a1[1][12])) || ((i0 ? a0[7] : 22) > (v0 % 9)));
+            v3 = (((a0[14] ? v3 : v3) != (v2 <= a0[6])) != ((v3 ? v1 : a1[0][9]) % 8));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((v1 % 2) % 2) < ((v1 != v3) == (a0[3] != a1[1][4])))) {
+        v2 = (((93 ? a0[2] : v2) ? (9 > v3) : (v3 + v0)) ? ((v3 + 82) >= (a0[6] + v3)) : ((v3 ? a1[1][9] : 57) / 6));
+        v2 = (((v3 < a0[1]) < (31 == a1[0][9])) < ((v2 % 1) || (54 >= 42)));
+        v2 = (((a0[12] <= v2) * (69 - a1[0][7])) > ((v1 && 55) >= (54 >= 28)));
+    } else {
+        a1[1][5] = (((v2 == 57) && (a0[15] < 33)) > ((v2 % 9) - (91 / 7)));
+        a1[3][15] = (((a1[1][1] || a1[0][7]) - (83 <= v1)) ? ((62 && v2) > (v0 ? v3 : v2)) : ((a0[11] ? a0[8] : 45) >= (v0 % 4)));
+        v3 = (((v3 == a0[4]) && (66 * v1)) || ((a1[1][11] % 1) <= (a0[12] + v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((75 == v3) < (71 >= v2)) < ((a0[8] > a1[2][15]) ? (v2 % 7) : (a0[1] + a1[0][5])));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v1 = (((52 % 7) + (86 ? i3 : v0)) || ((i3 % 3) < (v1 > v0)));
+                    v2 = (((13 && i3) ? (v0 && 48) : (15 < 85)) / 7);
+                    v3 = (((i3 && v3) != (33 ? v3 : 2)) || ((v1 == v0) ? (i2 % 9) : (47 == v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((30 ? v1 : v2) + (v2 <= v2)) / 4);
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v1 = (((v0 ? v0 : v1) == (46 && v0)) == ((a1[1][12] / 8) * (v1 ? v1 : v3)));
+    if ((((v1 > v0) - (a1[0][3] + v3)) ? ((98 >= 44) ? (v3 >= v0) : (a0[8] != v3)) : ((v1 > a0[1]) + (v2 < v3)))) {
+        a0[11] = (((v3 <= v0) == (a0[15] + a1[2][3])) / 6);
+        v1 = (((v3 + v3) > (v0 * v0)) / 9);
+        v3 = (((v2 * v1) < (a1[0][10] / 9)) + ((v0 ? a0[10] : v1) && (71 > v2)));
+    } else {
+        a0[10] = (((15 && 11) - (v1 != v3)) == ((v2 >= 0) ? (18 / 7) : (v0 != v3)));
+        v3 = (((55 + 4) % 4) / 2);
+        v1 = (((a0[5] != v3) / 4) && ((a1[2][7] <= v3) ? (a1[3][5] / 3) : (v2 > v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v3 = (((16 % 7) - (v2 || a1[3][12])) >= ((v0 || v3) <= (v1 * v3)));
+            {
+                int i5 = 0;
+                do {
+                    a1[2][5] = (((8 ? a1[3][4] : i4) % 7) ? ((a1[1][2] <= i5) > (i5 + 35)) : ((v0 ? a0[13] : 82) <= (14 - v3)));
+                    v2 = (((a1[2][6] >= 11) ? (v1 ? v3 : a1[0][1]) : (i4 ? i5 : i4)) == ((i5 * 41) * (a1[3][11] <= v0)));
+                    v1 = (((a1[3][1] % 2) && (75 * 72)) <= ((a0[15] <= v2) * (v2 && a0[8])));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a1[0][6] = (((v3 <= a0[11]) >= (v0 && v3)) == ((78 || v1) + (16 >= v0)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        a1[0][14] = (((2 + v3) && (v0 * 77)) ? ((v0 != a1[3][2]) * (v0 % 8)) : ((51 || a0[4]) > (a1[3][3] == v0)));
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            v2 = (((60 - v1) > (v1 != a0[3])) && ((a0[15] != v1) && (v2 / 9)));
+            a0[12] = (((63 ? i6 : a0[15]) >= (16 && v3)) == ((v1 == v1) + (v0 % 7)));
+            v2 = (((45 && 20) % 1) >= ((i6 / 3) < (a1[0][7] >= i6)));
+        }
+        a1[3][8] = (((5 || a0[3]) > (v1 - v1)) + ((a1[1][3] ? v0 : 20) / 2));
+    }
+    return (((v1 - v2) > (a1[3][4] / 2)) < ((v2 + v0) * (v2 > 70)));
+}
+int f30() {
+    int v0 = 68;
+    int v1 = 2;
+    int v2 = 76;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 == 54) > (v1 * v3)) % 6)) {
+        a0[12] = (((v0 >= v2) % 4) ? ((v2 ? v0 : a1[0][11]) ? (v1 && 37) : (a0[6] || a1[3][0])) : ((37 != v2) && (53 < a1[2][10])));
+        v2 = (((v3 || v3) <= (v2 >= v3)) < ((a1[1][14] || v2) == (v1 && 3)));
+        a1[1][15] = (((v3 < v3) >= (80 < v0)) > ((80 + 32) - (v2 == a0[6])));
+    } else {
+        v0 = (((v3 < v1) < (a1[0][5] - v0)) > ((v2 + v0) + (v0 < v0)));
+        v0 = (((v2 % 8) == (v1 || v1)) < ((51 + v1) ? (a0[8] / 2) : (a0[5] > v3)));
+        v2 = (((a1[0][14] / 7) % 1) - ((47 % 4) < (v0 / 4)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((i0 <= a0[7]) > 83) break;
+        v1 = (((93 - a0[14]) <= (10 + v2)) <= ((v0 && v1) > (5 >= v0)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            if ((56 - v2) > 82) break;
+            v3 = (((i1 < i1) != (v1 || a0[12])) / 2);
+            v3 = (((i1 ? a0[10] : i1) / 4) >= ((91 == v3) * (79 < v3)));
+            a1[0][6] = (((a0[4] % 1) ? (a0[5] / 9) : (15 <= v1)) != ((54 + i0) && (38 + v2)));
+        }
+        v3 = (((a1[2][14] - i0) || (10 - a0[11])) ? ((i0 / 8) ? (22 % 1) : (a1[0][4] || v2)) : ((a1[3][3] * a0[1]) <= (a0[12] * a1[3][10])));
+    }
+    if ((((v2 > v3) * (38 > 83)) >= ((15 > v3) + (a1[2][12] >= v0)))) {
+        a1[3][9] = (((v3 && 3) % 8) > ((v0 ? a0[2] : v2) / 1));
+        v0 = (((a0[11] > v1) * (a0[1] <= v1)) >= ((v0 - v1) && (a1[0][7] <= v0)));
+        v3 = (((v1 > 6) < (a0[7] <= v3)) != ((97 - a1[1][1]) >= (67 - 25)));
+    } else {
+        v0 = (((97 != v1) ? (v1 <= v2) : (74 + a1[2][6])) * ((a1[3][10] == 98) - (v3 >= 45)));
+        a1[0][12] = (((62 + a0[11]) <= (v3 || v2)) && ((v3 || a1[0][12]) != (v2 <= a1[0][0])));
+        v0 = (((26 == v3) + (v0 ? a0[9] : 45)) * ((a0[14] + v1) % 9));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a0[2] = (((v1 / 3) + (v3 / 6)) || ((54 % 3) || (v0 || v0)));
+            {
+                int i3 = 0;
+                do {
+                    a0[5] = (((i2 > v2) - (v2 && v0)) - ((5 != v2) > (12 == i3)));
+                    a0[11] = (((87 * 44) <= (v3 != v1)) == ((a0[12] + a1[0][13]) - (a0[12] && v3)));
+                    a1[1][7] = (((a1[3][13] != v2) % 6) <= ((i3 - v1) <= (a0[14] == 18)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            a0[5] = (((v0 * v3) || (v1 + i2)) / 8);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((24 - v2) - (v0 + 53)) * ((a0[2] <= v1) == (a0[15] ? v1 : v3)))) {
+        a0[0] = (((a1[2][6] < a1[2][10]) * (77 % 9)) && ((v3 > v2) - (a0[2] <= 92)));
+        a0[10] = (((a0[4] % 6) > (v1 == 79)) == ((v0 > v1) >= (v3 / 1)));
+        v0 = (((12 % 9) ? (49 / 7) : (v0 * a0[14])) ? ((v0 * a1[2][12]) - (v1 && a1[2][8])) : ((v2 * a0[14]) + (a1[0][8] <= a1[2][12])));
+    } else {
+        v0 = (((0 ? v1 : a0[9]) == (12 + 36)) >= ((v0 + v3) / 8));
+        v1 = (((81 < 14) - (v1 ? v0 : v0)) ? ((v3 >= a0[6]) * (v1 ? 17 : v0)) : ((v2 > 4) - (31 + v0)));
+        a0[8] = (((42 == v2) && (64 && v2)) || ((a1[2][12] > v1) * (a1[0][4] % 3)));
+    }
+    v1 = (((v3 / 6) >= (v1 ? 31 : 20)) - ((v1 % 7) - (76 / 4)));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            {
+                int i5 = 0;
+                do {
+                    if ((v1 * v2) > 53) break;
+                    v0 = (((a1[0][11] / 4) > (73 % 4)) < ((7 / 1) ? (v1 && v2) : (41 >= v0)));
+                    v3 = (((v2 > i5) * (a0[6] == 45)) ? ((i4 * a1[3][9]) != (v0 < 33)) : ((v3 ? i4 : v3) > (0 + a0[11])));
+                    v3 = (((v2 * i4) >= (a1[2][5] % 4)) || ((i4 + v3) - (52 < 36)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v2 = (((v0 >= a0[6]) > (57 >= 54)) - ((a1[2][13] > v0) == (v3 - i4)));
+            v1 = (((27 && v2) > (a1[3][6] ? a0[5] : a0[15])) ? ((v0 != v2) / 8) : ((i4 - a1[0][3]) / 6));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    if ((79 >= a1[3][3]) > 71) break;
+                    a1[1][3] = (((65 / 7) < (a0[15] > 79)) * ((a0[0] * v0) <= (24 + v3)));
+                    v3 = (((94 && 96) - (i6 ? 63 : i6)) / 4);
+                    v3 = (((v0 || v2) % 6) && ((a0[9] >= 90) * (v2 && 85)));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            v2 = (((v0 - a0[7]) + (v1 + i6)) / 8);
+            a1[0][3] = (((15 + a0[3]) ? (i6 % 3) : (v2 + v2)) ? ((v0 >= a1[1][4]) * (i6 >= v3)) : ((v3 || a1[1][8]) / 7));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        a1[2][15] = (((v2 < a1[2][2]) % 1) + ((v2 || 45) + (v2 == 80)));
+        v2 = (((a1[1][11] * a1[2][15]) + (v3 > a0[6])) ? ((a0[5] < 81) > (a1[2][13] && i8)) : ((v2 > a0[4]) != (15 && v0)));
+        for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+            v2 = (((0 % 3) * (i9 < v2)) || ((a1[3][1] < 61) - (v1 || a1[2][12])));
+            v2 = (((v1 * v1) + (v0 < v2)) + ((38 > v0) ? (v0 < 5) : (a1[2][10] + v1)));
+            v1 = (((23 ? i8 : v1) > (a1[3][10] < v3)) - ((v3 || a0[0]) > (v3 < 45)));
+        }
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        v0 = (((i10 || v1) ? (a0[12] + a1[1][10]) : (a1[0][10] <= v2)) > ((a0[1] * a1[3][13]) >= (v1 + 13)));
+        a0[7] = (((a0[7] ? 60 : a0[15]) == (16 - a1[0][3])) && ((v3 <= v3) == (v2 + v1)));
+        for (int i11 = 0; i11 < 6; i11 = i11 + 1) {
+            if ((v2 * a1[1][12]) > 86) break;
+            v3 = (((i11 + 48) == (a1[3][4] ? 70 : 42)) == ((1 + a0[5]) - (a0[10] <= a1[2][9])));
+            v2 = (((a0[10] ? v0 : a1[3][14]) % 2) != ((a0[15] ? 13 : 88) && (v1 ? v2 : i10)));
+            a0[2] = (((a0[15] || v0) * (a1[1][11] % 4)) % 2);
+        }
+    }
+    return (((41 * v3) && (v1 - v3)) <= ((v0 || v3) % 5));
+}
+int f31() {
+    int v0 = 46;
+    int v1 = 55;
+    int v2 = 99;
+    int v3 = 21;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (((v3 / 4) == (16 && 26)) && ((a1[0][9] <= a0[13]) >= (38 > a1[3][12])));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                v2 = (((a1[3][10] * v0) ? (a0[15] == 67) : (v0 ? 88 : a1[0][5])) <= ((v1 <= v0) > (v3 >= 58)));
+                v2 = (((a0[6] + 80) + (v1 ? a1[0][6] : 77)) * ((92 || 59) > (v0 / 9)));
+                a1[0][15] = (((i1 > a0[5]) == (i1 + v3)) % 8);
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((a1[2][12] / 3) ? (34 || a1[0][2]) : (50 >= 33)) && ((50 + v2) != (v1 && v2)));
+    }
+    a1[0][15] = (((v0 ? a1[2][2] : v1) % 9) && ((v2 + 51) ? (v2 > v0) : (18 + v3)));
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v0 ? a0[8] : a0[5]) >= (v0 % 7)) && ((67 || v3) && (v3 != a0[4])));
+            a0[15] = (((v1 <= v1) == (a1[2][13] - a0[11])) + ((54 || a0[1]) >= (v1 > a1[0][13])));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((v3 || v3) == (a1[3][2] && a0[7])) ? ((a0[7] == i2) || (81 > 99)) : ((79 && 40) <= (a1[1][7] >= i3)));
+                    v2 = (((i3 - v0) > (v0 >= 14)) / 5);
+                    a0[7] = (((a1[0][5] % 8) + (v1 && v3)) + ((77 + 40) * (6 == v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((52 * a0[13]) ? (v3 ? v3 : v3) : (93 * v3)) * ((v0 > v2) > (v3 / 7)))) {
+        v2 = (((a0[5] || v2) % 9) && ((a1[1][15] ? 15 : v2) - (a1[1][12] * v1)));
+        a1[1][3] = (((v1 || a1[0][7]) && (v0 % 8)) / 9);
+        a0[15] = (((v0 % 6) || (9 + v1)) ? ((50 % 9) == (v2 * a0[12])) : ((v3 >= v2) || (88 ? v2 : v0)));
+    } else {
+        a0[7] = (((48 % 2) * (53 ? 78 : 41)) && ((70 || v2) == (76 != v0)));
+        a1[2][9] = (((a0[6] / 1) / 4) < ((73 < v3) && (v2 > a1[1][3])));
+        v1 = (((v2 ? 14 : v2) - (96 + a1[3][7])) == ((v2 != v0) < (a1[0][9] + a1[3][4])));
+    }
+    if ((((v0 >= v0) < (29 < a1[3][13])) > ((v1 == v0) != (v3 * v1)))) {
+        v0 = (((v0 < a1[1][15]) / 2) >= ((v3 || v0) + (a1[0][2] >= v1)));
+        v2 = (((a1[1][2] && a1[1][11]) && (v1 + a0[0])) - ((17 / 8) == (v2 < 20)));
+        v2 = (((92 * 97) > (v2 % 8)) >= ((45 || v1) || (55 == v3)));
+    } else {
+        v1 = (((v3 / 4) % 7) >= ((v0 ? v0 : a0[0]) || (11 ? 63 : 88)));
+        v2 = (((v3 < v3) != (22 == 86)) == ((v1 != a1[2][5]) ? (37 * 69) : (v0 || a0[9])));
+        v1 = (((27 - a1[1][8]) % 2) >= ((84 ? v1 : 4) % 3));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((a1[2][6] / 6) > 81) break;
+            {
+                int i5 = 0;
+                do {
+                    a0[13] = (((v1 || 30) / 4) <= ((36 == a0[5]) + (v1 > a0[8])));
+                    v1 = (((v0 / 2) ? (v3 - v3) : (27 || i5)) <= ((i4 >= v3) * (77 != 28)));
+                    a0[7] = (((v2 ? i5 : v3) ? (a0[2] || a1[0][2]) : (a1[0][9] && a0[5])) != ((40 > a0[7]) < (i5 + v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v2 = (((67 / 7) && (v2 - v3)) > ((v1 == v0) >= (a0[4] <= a1[3][14])));
+            v2 = (((76 + v3) ? (a0[1] >= a0[1]) : (a1[2][13] * a1[2][15])) == ((v1 - 62) >= (a1[1][12] ? a1[1][5] : i4)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v2 = (((a1[1][5] >= 48) - (a1[3][9] < v0)) < ((v3 * v0) > (v0 > 12)));
+            a0[8] = (((a0[6] <= 94) % 3) % 3);
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                a0[14] = (((a0[7] >= i7) % 8) % 1);
+                v3 = (((v3 < a0[6]) * (86 ? v3 : 93)) < ((v0 && 20) ? (a1[3][6] ? v3 : i6) : (v3 ? v1 : v1)));
+                a1[1][3] = (((v0 + a1[0][14]) ? (29 * 96) : (a0[6] && a0[12])) == ((a0[7] == a1[3][0]) - (v3 == 70)));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        v0 = (((7 || i8) ? (73 ? 71 : a1[2][10]) : (v3 && i8)) < ((a0[9] / 1) ? (v1 % 6) : (31 > 83)));
+        {
+            int i9 = 0;
+            do {
+                if ((a1[3][6] != 77) > 62) break;
+                v3 = (((v2 > 49) % 7) >= ((a0[15] >= i9) * (a1[3][13] * a1[2][12])));
+                a0[5] = (((81 ? a0[12] : v0) * (a0[12] ? a1[2][14] : a1[2][2])) >= ((v0 >= i9) > (a1[1][14] && a1[2][1])));
+                v3 = (((v0 / 5) + (a0[12] == a0[10])) != ((50 % 6) + (a1[3][4] && i9)));
+                i9 = i9 + 1;
+            } while (i9 < 8);
+        }
+        v3 = (((a1[0][13] > 78) % 3) - ((a0[14] + a0[3]) < (v0 || v3)));
+    }
+    if ((((23 - 74) || (v3 || v1)) ? ((65 < 5) == (v3 > a1[0][15])) : ((a0[9] > v3) ? (77 / 3) : (a1[3][13] <= a1[0][14])))) {
+        v2 = (((a1[3][0] <= 6) % 8) > ((8 != 72) ? (v1 < a0[5]) : (v1 >= a1[2][0])));
+        a1[0][7] = (((26 / 8) > (33 && v2)) <= ((v3 <= v2) / 1));
+        v0 = (((v1 ? 53 : v1) >= (71 % 6)) ? ((v2 > v2) / 2) : ((v2 % 7) < (v3 >= v0)));
+    } else {
+        v3 = (((v3 - v2) % 1) ? ((18 - v0) + (70 * v1)) : ((a0[12] * v3) || (79 - v3)));
+        a0[12] = (((v3 ? a1[1][12] : v1) > (49 % 6)) + ((v2 + a1[1][3]) < (v1 * v0)));
+        v0 = (((v1 == v2) % 4) == ((a1[1][9] == v2) * (a1[0][4] != a1[3][3])));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            v1 = (((a1[1][5] ? v3 : 17) == (a0[14] || v3)) <= ((58 + 21) && (i10 <= i10)));
+            a0[8] = (((63 + i10) == (a0[11] ? v0 : i10)) * ((a0[7] - a1[0][7]) * (v2 && v1)));
+            {
+                int i11 = 0;
+                do {
+                    v1 = (((98 >= v0) == (i10 <= i10)) * ((i10 > a0[9]) % 7));
+                    v1 = (((v2 % 6) != (v0 <= v0)) * ((a1[3][1] / 1) + (i10 / 6)));
+                    v3 = (((a1[1][11] <= a0[3]) || (v1 == i11)) || ((v1 < a1[0][4]) % 6));
+                    i11 = i11 + 1;
+                } while (i11 < 6);
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((v3 + v3) || (v2 > a0[14])) != ((a0[8] && a1[3][8]) % 3));
+}
+int f32() {
+    int v0 = 5;
+    int v1 = 51;
+    int v2 = 67;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((v1 || 99) > 89) break;
+        a0[2] = (((75 + 76) == (a1[1][1] / 7)) < ((95 && v3) == (67 % 3)));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            a1[3][5] = (((i1 + i1) % 7) * ((i1 * 31) / 9));
+            v0 = (((v3 ? v2 : a1[0][2]) <= (68 % 5)) <= ((i0 || v3) * (v0 ? i1 : v3)));
+            v0 = (((i1 ? v3 : v0) == (a0[7] && v2)) && ((v3 != v2) ? (v3 >= v0) : (0 < 34)));
+        }
+        a0[11] = (((a1[1][13] >= v2) < (a1[0][8] / 7)) ? ((v3 + i0) > (i0 ? v3 : a0[12])) : ((47 && v0) < (85 + a1[0][7])));
+    }
+    if ((((v3 && v0) < (v0 > v3)) % 1)) {
+        a0[7] = (((v0 <= v1) > (v1 - a1[2][7])) || ((v0 * a0[4]) || (a0[15] <= v3)));
+        a1[1][13] = (((36 / 3) + (a0[4] == v2)) || ((19 % 7) != (a0[12] <= a1[2][12])));
+        v3 = (((v2 + v3) ? (65 + v1) : (v0 ? 28 : v2)) == ((v1 % 9) * (v2 * v3)));
+    } else {
+        a1[2][3] = (((29 <= 54) == (v3 % 4)) + ((22 ? a0[8] : v0) == (a1[2][0] * v0)));
+        v1 = (((a1[0][4] == v0) + (v3 < 41)) * ((20 || a1[1][15]) && (a1[0][3] || v2)));
+        v1 = (((v2 < 35) / 4) < ((v0 > v2) / 3));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v2 ? v3 : v2) > 94) break;
+            a0[5] = (((a0[7] <= v2) >= (60 || 26)) * ((v0 >= 34) >= (v1 || a0[10])));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((i3 ? 95 : v3) > 72) break;
+                    a0[3] = (((i3 < a1[1][12]) - (a0[6] ? v1 : v2)) || ((97 % 9) ? (i2 >= i3) : (a0[13] > v0)));
+                    v3 = (((i3 == i2) <= (i3 >= a0[12])) <= ((i2 <= v1) ? (a0[9] / 4) : (a1[0][13] == 25)));
+                    v3 = (((15 ? v2 : a0[13]) > (a1[3][8] != a1[1][14])) >= ((v3 > a0[10]) == (a1[0][9] ? v1 : a1[1][1])));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a1[3][8] > v2) || (a0[8] % 8)) >= ((v2 - i2) != (v3 >= v1)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a1[0][13] || 91) > 52) break;
+            v0 = (((a0[13] % 2) >= (v0 + 59)) - ((a1[3][5] >= v2) && (a0[2] <= v0)));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                if ((59 * v3) > 97) break;
+                v3 = (((75 + a1[0][1]) || (v2 % 5)) / 4);
+                v0 = (((i4 == a1[2][5]) / 2) > ((v1 && v2) || (v2 / 3)));
+                v2 = (((i4 / 1) - (a1[1][2] > v2)) < ((v0 >= v2) && (17 > v3)));
+            }
+            v0 = (((v3 || v3) && (v0 > v3)) != ((a1[2][1] < 73) || (v2 > v1)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((47 && i6) < (55 >= a0[6])) || ((v3 < a1[0][11]) % 4));
+            v2 = (((75 * v2) - (v0 <= 89)) + ((a0[5] % 2) - (a0[3] != v1)));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    v3 = (((15 ? v0 : v0) == (56 < a1[2][0])) * ((v2 > v3) * (i7 + v0)));
+                    a0[4] = (((42 >= i6) >= (a0[13] || v2)) >= ((v3 ? v0 : a1[3][5]) * (i7 ? v1 : 52)));
+                    v0 = (((0 && v2) / 3) ? ((v2 >= 95) && (i6 == v1)) : ((a1[3][0] * i6) / 7));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            {
+                int i9 = 0;
+                do {
+                    if ((72 <= v0) > 87) break;
+                    v3 = (((81 != a1[3][10]) < (v0 % 7)) <= ((76 < v0) > (41 ? 51 : 35)));
+                    a0[9] = (((i9 <= i9) && (v1 ? i8 : v2)) > ((74 + 21) % 8));
+                    a0[12] = (((i8 <= 36) - (a1[0][7] >= i8)) > ((v2 % 7) ? (i8 % 5) : (v0 * i8)));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            a1[0][7] = (((v1 % 2) + (a1[3][4] ? v0 : a1[0][5])) && ((v1 || v3) - (i8 / 6)));
+            a0[0] = (((a1[2][12] >= a0[4]) || (a1[2][5] + 37)) >= ((v2 != v1) > (v1 == a0[15])));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v2 / 7) == (v1 || v2)) ? ((v0 ? a1[1][2] : v1) ? (v1 * v3) : (v3 || a0[8])) : ((v3 * v3) + (a0[13] <= v1)))) {
+        v0 = (((60 == 50) + (v1 % 9)) + ((a0[11] ? v3 : v3) + (a0[9] + 1)));
+        v2 = (((v3 % 3) % 5) % 5);
+        v0 = (((11 ? a0[14] : a1[0][12]) == (30 * 61)) == ((v3 * 6) ? (v1 && a0[2]) : (a1[0][3] || v3)));
+    } else {
+        a0[8] = (((v0 && v3) <= (a1[2][8] ? v2 : v1)) <= ((82 - v0) * (v1 == v2)));
+        a1[1][4] = (((v3 > 3) == (a1[2][3] != v1)) > ((42 ? a1[2][2] : v2) % 5));
+        v2 = (((v2 && a0[10]) - (v3 + v2)) ? ((v1 % 8) ? (a0[9] != v0) : (72 ? v0 : 89)) : ((a1[0][8] + v0) * (v3 ? v0 : a1[2][9])));
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((2 + v3) > 63) break;
+            {
+                int i11 = 0;
+                do {
+                    if ((a0[6] < v2) > 78) break;
+                    v1 = (((66 * v2) >= (63 == a0[12])) == ((18 % 3) / 7));
+                    v0 = (((97 ? v1 : v1) && (a1[1][1] == a0[10])) <= ((i11 <= 45) / 9));
+                    v3 = (((v0 || v1) >= (a1[3][10] - a1[1][15])) <= ((v3 - v1) / 6));
+                    i11 = i11 + 1;
+                } while (i11 < 6);
+            }
+            a1[2][13] = (((74 / 3) * (v1 * v0)) ? ((v2 ? a0[10] : a1[1][0]) % 8) : ((i10 + a1[3][7]) ? (a1[1][2] && v2) : (15 - a1[3][14])));
+            a0[5] = (((v2 ? 44 : v0) - (35 + a1[2][10])) ? ((v1 || v0) > (i10 ? v2 : v2)) : ((v2 <= 15) / 6));
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    for (int i12 = 0; i12 < 2; i12 = i12 + 1) {
+        for (int i13 = 0; i13 < 7; i13 = i13 + 1) {
+            v1 = (((v1 ? v0 : a0[0]) >= (i12 ? 65 : a0[10])) * ((a1[0][1] <= v1) < (v1 <= v2)));
+            v2 = (((67 != 14) && (a1[2][2] ? 30 : 76)) <= ((36 || 51) - (88 % 8)));
+            a1[3][6] = (((v1 != v0) && (48 / 3)) < ((a0[6] - a0[3]) && (a0[10] ? 21 : i13)));
+        }
+        v3 = (((i12 != 15) || (54 > v1)) * ((64 < 26) == (a1[0][6] != 54)));
+        v3 = (((v1 && v2) > (v2 % 5)) < ((v0 / 2) == (v1 && v3)));
+    }
+    {
+        int i14 = 0;
+        do {
+            if ((52 == v0) > 89) break;
+            {
+                int i15 = 0;
+                while (i15 < 4) {
+                    v1 = (((i15 - a1[2][1]) != (v3 > a1[3][5])) * ((v2 * v2) >= (a0[13] < i15)));
+                    v0 = (((v2 || a1[3][12]) * (i14 >= 61)) - ((a1[3][11] <= a0[10]) < (v1 || v0)));
+                    v0 = (((14 == a0[12]) >= (i14 ? i15 : a0[11])) + ((26 * 18) * (i15 || 61)));
+                    i15 = i15 + 1;
+                }
+            }
+            a1[3][8] = (((43 > i14) / 9) && ((0 != v0) + (15 > v3)));
+            v3 = (((v0 || a0[9]) <= (39 <= v2)) ? ((v2 ? v3 : v0) / 8) : ((v1 ? i14 : v1) + (v0 == 75)));
+            i14 = i14 + 1;
+        } while (i14 < 2);
+    }
+    return (((a1[1][13] || v0) && (v1 >= v2)) < ((25 >= 70) <= (96 && a1[2][8])));
+}
+int f33() {
+    int v0 = 91;
+    int v1 = 94;
+    int v2 = 60;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((90 || 39) != (v0 < a1[2][5])) <= ((a1[3][6] % 4) > (v1 >= 73)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((i0 == v2) + (a0[2] < v2)) ? ((31 < i0) || (a0[6] ? v3 : v3)) : ((40 / 5) ? (v1 / 1) : (99 >= v1)));
+            a0[10] = (((a1[0][3] > 15) >= (v3 - v0)) > ((a0[5] + v2) ? (v3 || a1[3][4]) : (v3 > v3)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((a1[1][7] - v3) == (v1 == 31)) + ((i1 < v1) == (v0 || 10)));
+                v2 = (((v0 && i1) <= (6 <= 74)) > ((69 == 58) == (v2 + 95)));
+                v1 = (((a1[0][5] && v1) % 2) ? ((a1[1][8] % 4) - (a1[2][10] > a1[3][3])) : ((a1[1][4] && v3) ? (v3 == a0[11]) : (a1[3][5] != 92)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((53 == i2) / 4) == ((a1[2][6] + v3) / 7));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((i3 > i3) > 62) break;
+                v1 = (((a0[0] || a1[3][9]) > (45 - 95)) != ((v3 * 73) || (v1 * v1)));
+                v2 = (((69 == 60) || (v1 > 29)) % 1);
+                v2 = (((v3 < 54) || (v3 % 4)) + ((a0[12] && v0) && (i2 >= a1[1][9])));
+            }
+            a0[14] = (((50 >= v0) ? (a0[10] && 80) : (a0[3] ? 12 : a0[8])) - ((v0 <= v1) && (a0[7] % 5)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                if ((96 >= 94) > 96) break;
+                a0[11] = (((a0[3] - v1) < (6 < v1)) && ((14 || i5) <= (i5 == 89)));
+                a0[9] = (((74 && 54) ? (a1[0][13] + a0[3]) : (a1[3][7] - 29)) % 6);
+                a0[14] = (((v0 < i4) || (a0[15] + a0[6])) ? ((94 == v3) - (v2 || a0[0])) : ((a1[2][15] > v0) >= (a1[0][8] ? v0 : 3)));
+            }
+            v3 = (((a0[11] < a0[13]) || (a1[2][13] * a0[2])) && ((v3 > v2) < (i4 == a0[4])));
+            v0 = (((v0 - v2) * (v0 >= v1)) > ((v1 + v3) || (a1[3][3] >= a0[12])));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    a1[2][11] = (((v2 >= a1[3][7]) - (19 < v2)) < ((v0 > v0) ? (a0[12] && v0) : (a0[12] ? v2 : 33)));
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    a1[1][10] = (((v2 % 2) + (v3 ? 98 : 82)) + ((i7 < v2) >= (a0[2] && a0[11])));
+                    v3 = (((i6 % 1) <= (38 && v3)) >= ((60 * 1) / 3));
+                    v1 = (((a0[5] >= v0) != (a0[2] ? i6 : v2)) > ((a0[2] ? 92 : i7) == (i6 / 6)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((v3 / 9) < (v1 != 81)) >= ((v0 > 53) || (v1 < v3)));
+            v2 = (((a0[8] > a0[7]) % 2) && ((a1[1][7] < a0[5]) - (52 / 4)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    v0 = (((a0[13] - 29) && (v1 > v3)) ? ((v2 ? a1[1][12] : v3) != (18 <= 22)) : ((a1[1][6] + a0[10]) == (v1 > 25)));
+    {
+        int i8 = 0;
+        do {
+            if ((v2 > a0[2]) > 96) break;
+            v3 = (((a0[6] - i8) <= (1 < a1[2][0])) != ((v0 != v2) >= (v0 ? a0[6] : v1)));
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((i9 + 16) > (a0[8] || i9)) - ((a0[7] ? 27 : i9) == (a1[2][2] - v2)));
+                    v2 = (((94 == a1[3][2]) < (v3 ? v2 : v1)) && ((83 ? a0[4] : v3) || (50 * a0[0])));
+                    v2 = (((a1[3][10] == v2) + (a1[0][7] == a1[2][7])) / 9);
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            v1 = (((79 >= i8) == (a1[3][5] <= v2)) != ((v2 < v0) && (v0 % 1)));
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 8) {
+            if ((92 != 25) > 97) break;
+            v3 = (((v0 ? v2 : a1[3][8]) == (a0[6] || a1[0][9])) > ((i10 + 61) && (i10 != v3)));
+            v2 = (((v2 >= a1[1][13]) % 3) >= ((v1 ? v2 : v0) && (39 < v2)));
+            for (int i11 = 0; i11 < 3; i11 = i11 + 1) {
+                a1[0][6] = (((37 != a1[1][3]) <= (v1 + a0[0])) >= ((v3 == 29) ? (44 / 8) : (24 - v0)));
+                v2 = (((a1[0][2] > a1[2][14]) == (88 || i11)) - ((a1[1][0] ? a1[1][5] : i11) % 5));
+                a0[0] = (((i10 || a0[7]) <= (a0[2] <= i11)) || ((v3 ? v2 : a1[3][3]) != (39 / 1)));
+            }
+            i10 = i10 + 1;
+        }
+    }
+    if ((((71 % 8) != (72 && v2)) + ((64 && 71) ? (a1[2][4] >= a0[14]) : (85 || v2)))) {
+        v3 = (((18 >= v0) != (a0[3] - 74)) - ((a1[3][7] + a1[2][12]) - (v3 >= v3)));
+        v3 = (((v3 * v1) > (v1 <= a1[2][3])) < ((v2 == v2) >= (a1[3][13] == v2)));
+        v3 = (((a1[0][5] != v2) * (a1[2][8] != a0[5])) % 5);
+    } else {
+        v0 = (((88 / 2) <= (a1[2][2] == v1)) / 8);
+        v0 = (((25 - 49) <= (v3 && 62)) >= ((a0[3] && v1) / 4));
+        v1 = (((a0[10] != v3) >= (a1[1][14] > v2)) * ((97 - 4) ? (21 || a0[10]) : (38 > v3)));
+    }
+    return (((a0[15] - v1) / 9) + ((v1 >= 16) <= (a1[2][6] * v3)));
+}
+int f34() {
+    int v0 = 31;
+    int v1 = 44;
+    int v2 = 3;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    a1[2][10] = (((a0[7] / 1) < (14 - 36)) || ((24 || v3) - (31 <= 50)));
+    a0[3] = (((77 >= a1[1][11]) / 3) >= ((v0 != 92) >= (v0 == v0)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[9] = (((i0 % 8) >= (v3 != v0)) == ((a1[0][13] ? a0[8] : a1[2][14]) != (a0[4] || v2)));
+            v3 = (((v0 <= 27) ? (a1[1][6] > 72) : (i0 + i0)) <= ((a1[0][15] % 9) ? (v3 - 91) : (a0[9] < v3)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a0[7] = (((i1 - i0) ? (a0[6] - a0[9]) : (33 + v2)) ? ((v0 != 96) ? (8 % 9) : (a0[1] - a1[1][0])) : ((1 == 37) % 3));
+                v1 = (((a1[2][6] <= a0[9]) > (v3 || a1[0][2])) + ((i0 && a0[10]) == (v1 >= i0)));
+                v1 = (((v0 ? i1 : a0[9]) > (39 ? 6 : 98)) != ((v1 - i1) / 4));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v1 ? v2 : v0) >= (v1 - 59)) % 4);
+    if ((((v1 ? v1 : 5) ? (v0 > a1[2][10]) : (a1[0][0] <= v1)) != ((v2 <= 17) < (v2 ? 50 : v3)))) {
+        v1 = (((a0[4] != 9) ? (44 || 76) : (a0[4] >= v3)) * ((v0 == 81) >= (a0[12] >= 24)));
+        v3 = (((v3 < 55) < (a1[2][5] * v2)) || ((v1 % 7) <= (a0[8] >= 76)));
+        v3 = (((a1[3][12] != v3) ? (96 && v1) : (a0[2] && v1)) % 6);
+    } else {
+        v1 = (((50 >= a0[4]) != (58 < v0)) < ((v1 <= v3) == (59 / 4)));
+        v0 = (((v1 + 61) - (v3 ? a1[0][7] : v0)) >= ((a1[2][6] ? v2 : a1[0][12]) || (v2 - a1[0][12])));
+        a1[1][3] = (((a1[2][6] / 2) && (a0[2] >= v2)) / 7);
+    }
+    if ((((23 % 6) < (v0 == v3)) <= ((67 >= 52) ? (v1 != v1) : (v1 != v1)))) {
+        v1 = (((a0[1] != 77) + (6 + v2)) && ((v2 * v2) >= (v2 >= a0[1])));
+        a0[1] = (((57 && 6) / 1) - ((21 && 7) < (77 || 37)));
+        a1[0][1] = (((v1 ? v2 : v3) < (77 / 8)) != ((v2 / 1) * (v1 * 61)));
+    } else {
+        v2 = (((v1 + a0[3]) < (v2 + a1[2][0])) % 7);
+        v1 = (((a0[9] ? a1[0][7] : v0) * (v0 == v0)) == ((v0 && v1) - (v2 > 52)));
+        a0[7] = (((a1[1][15] < 94) || (39 == 15)) + ((v1 / 7) % 4));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a1[0][11] = (((v1 < v3) != (19 ? a1[1][3] : 44)) * ((v2 / 1) >= (v3 ? a1[1][0] : 29)));
+        v3 = (((i2 != a1[3][4]) > (a1[0][6] > a1[1][14])) > ((a1[0][2] < v3) / 8));
+        {
+            int i3 = 0;
+            do {
+                a1[3][15] = (((a1[2][7] < 14) <= (59 * v1)) <= ((a1[3][9] ? 58 : a1[0][10]) / 7));
+                v0 = (((v1 + 1) != (v2 == 4)) >= ((a0[12] && v0) > (v0 != v0)));
+                a1[3][14] = (((0 * i2) ? (78 > v1) : (a1[3][6] && v3)) ? ((v0 < 43) * (v0 < v2)) : ((v2 || v0) ? (26 != v1) : (v0 <= a0[9])));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        if ((a1[2][13] || v1) > 76) break;
+        v3 = (((a1[0][9] + v0) - (v0 / 5)) % 5);
+        v0 = (((v2 <= v1) + (61 != 2)) > ((v0 + a0[0]) <= (v2 > i4)));
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                v3 = (((v2 + 33) ? (10 - v1) : (v0 - i4)) - ((v2 && v2) ? (i4 >= i4) : (v1 > v1)));
+                a0[0] = (((a1[1][0] || 44) % 9) <= ((v0 - i5) - (v2 || i4)));
+                v3 = (((29 < 24) < (v3 && i4)) <= ((46 <= v3) == (a0[12] <= v3)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v0 = (((v1 && a0[13]) < (a0[11] > i6)) * ((v2 != 16) >= (86 ? 18 : i7)));
+                    a1[1][2] = (((v2 && 8) > (v2 - 28)) || ((41 == a1[3][1]) != (i6 * 9)));
+                    a1[0][5] = (((81 >= i7) * (a0[11] * v3)) < ((i6 / 1) * (a1[3][12] ? v0 : a1[3][12])));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((1 ? 33 : v1) / 9) || ((v1 >= i6) * (v1 / 3)));
+            v2 = (((a0[2] + 82) + (a0[9] + v2)) <= ((a0[12] || 56) <= (50 ? a1[0][12] : a1[2][14])));
+            i6 = i6 + 1;
+        }
+    }
+    a0[14] = (((3 * v0) ? (v0 <= 78) : (v0 <= v1)) ? ((v0 <= a1[0][15]) < (v3 - v1)) : ((a0[11] <= 10) < (v1 - 23)));
+    return (((v3 == 17) < (a1[1][1] < 28)) - ((11 < 8) != (61 > v1)));
+}
+int f35() {
+    int v0 = 32;
+    int v1 = 43;
+    int v2 = 14;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a0[15] / 9) * (a0[14] % 9)) == ((34 * v3) == (v0 % 4)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((93 ? a0[2] : i0) > 66) break;
+        {
+            int i1 = 0;
+            do {
+                a1[1][10] = (((v1 - 25) != (i1 ? v3 : 55)) && ((v0 % 8) == (38 % 4)));
+                a1[2][8] = (((35 / 3) / 5) > ((v3 - 9) ? (i1 ? 41 : v1) : (v0 + a1[0][10])));
+                v2 = (((v0 != v1) != (v2 - i1)) >= ((v2 || i0) >= (v3 <= i0)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        a0[0] = (((a0[3] / 7) <= (v2 || v2)) - ((i0 <= 12) * (i0 ? a0[13] : a1[3][2])));
+        v0 = (((v1 ? v1 : 38) != (v0 % 4)) % 9);
+    }
+    if ((((v1 ? 0 : v0) <= (v1 / 2)) < ((47 % 8) % 8))) {
+        a0[13] = (((a1[3][6] ? v1 : v2) ? (a0[8] ? a0[12] : a0[0]) : (6 + v0)) > ((a1[2][14] + v2) > (41 + a0[1])));
+        v2 = (((a0[15] % 7) ? (32 && v3) : (a1[0][5] ? 69 : v1)) >= ((a0[13] <= v1) >= (v1 || v1)));
+        v0 = (((v1 % 4) < (50 / 9)) >= ((85 * v1) % 2));
+    } else {
+        v1 = (((a0[13] ? a1[0][0] : 65) * (a1[2][11] || 37)) <= ((a0[9] >= a0[13]) % 7));
+        v3 = (((v0 && v2) % 5) * ((a0[12] - v2) / 5));
+        v3 = (((74 == v3) <= (33 * a1[2][2])) >= ((53 < 51) * (a0[5] <= v2)));
+    }
+    if ((((v0 == v2) && (a1[0][12] + 64)) <= ((a0[11] <= 99) % 1))) {
+        v3 = (((68 ? 5 : a1[1][8]) - (10 ? a1[1][1] : a1[1][0])) * ((v1 <= 29) % 1));
+        v2 = (((a1[3][2] + v0) && (58 + a0[7])) < ((v1 - v0) > (68 / 8)));
+        v1 = (((v3 ? v1 : v3) ? (1 % 8) : (54 && a0[12])) <= ((v3 / 7) < (53 && a0[2])));
+    } else {
+        v3 = (((v3 % 8) && (v0 - v1)) && ((v0 * 79) % 9));
+        v2 = (((v1 && a0[11]) < (a0[4] != v0)) ? ((a1[2][12] <= a1[0][1]) * (v1 >= v1)) : ((74 && 60) - (19 != a1[1][15])));
+        v2 = (((13 + 46) + (v0 * a0[1])) > ((v3 || v3) == (85 <= v1)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a1[3][5] - v1) > 81) break;
+        v1 = (((a0[11] < i2) ? (v0 >= a0[9]) : (i2 || 67)) == ((a1[3][3] == v0) - (a1[2][0] || i2)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v1 = (((v1 < a1[3][1]) * (v1 / 8)) / 8);
+            v3 = (((v2 % 4) < (a0[3] < v3)) * ((a0[3] * i2) * (a1[3][2] != i2)));
+            v0 = (((i3 / 2) == (a0[3] / 5)) % 3);
+        }
+        a1[3][15] = (((v3 == 28) - (v3 * i2)) < ((v1 / 3) < (a1[0][12] / 9)));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v0 = (((v1 % 6) && (v0 + a1[3][11])) >= ((a1[3][4] > v2) * (v3 == a0[9])));
+        v0 = (((14 > 65) && (i4 != a0[3])) < ((50 == 86) || (a0[10] || v0)));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            if ((v0 < 15) > 72) break;
+            v1 = (((26 || 19) < (50 <= 29)) || ((a0[11] == v3) != (v3 % 2)));
+            a0[8] = (((a1[1][11] < i5) <= (i4 && v2)) - ((v1 / 3) ? (v0 || i5) : (93 != i4)));
+            a1[2][8] = (((i4 < a0[7]) / 5) || ((a0[6] <= v2) != (i4 % 2)));
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((v2 * a0[0]) > 50) break;
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                a1[0][1] = (((4 >= a1[0][13]) * (a1[2][3] <= v1)) != ((a1[1][8] ? v2 : i6) != (41 <= i7)));
+                v2 = (((i7 % 5) - (v0 + v0)) || ((v3 >= a0[13]) ? (a0[15] != 73) : (v1 < a1[0][5])));
+                v2 = (((v1 ? a1[3][1] : v1) ? (v1 == a1[0][11]) : (45 < i7)) != ((v2 ? v0 : v2) * (83 == v0)));
+                i7 = i7 + 1;
+            }
+        }
+        v0 = (((v3 <= 39) != (v1 >= a1[3][4])) <= ((82 > a0[12]) && (58 * 2)));
+        v3 = (((v0 > v0) && (i6 ? v2 : a0[6])) && ((8 % 2) >= (49 && v0)));
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((44 - v1) > 98) break;
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    a0[3] = (((87 - v2) >= (41 >= a1[0][15])) > ((v0 == a0[0]) ? (v3 == a1[1][1]) : (i8 != v1)));
+                    a1[0][4] = (((18 > 89) || (i9 + i8)) < ((13 >= v3) >= (i9 < 61)));
+                    v1 = (((10 == i8) == (v0 ? a0[8] : v2)) || ((v1 && a1[1][2]) + (v0 && a1[1][15])));
+                    i9 = i9 + 1;
+                }
+            }
+            a0[9] = (((v2 * v0) >= (a1[0][9] * v0)) >= ((v2 % 7) || (v1 > i8)));
+            a0[14] = (((v3 >= v1) > (2 / 9)) != ((a0[3] * a0[9]) ? (v3 - 38) : (86 ? a0[9] : 8)));
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            v3 = (((v1 * v3) <= (49 ? v3 : a0[15])) ? ((59 < v2) != (v1 - v1)) : ((v2 == a1[3][10]) && (v3 > v2)));
+            v0 = (((v1 + a1[0][10]) ? (v3 < v0) : (v3 + v0)) >= ((v3 > a0[9]) + (v1 != v2)));
+            for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+                v0 = (((a0[0] != v2) * (a0[2] * 62)) ? ((v3 * i11) * (a0[4] * v2)) : ((v0 < i11) <= (v2 > v1)));
+                v3 = (((39 - v2) > (a0[11] - v1)) ? ((v2 ? a0[10] : v0) <= (v3 <= a1[3][10])) : ((i11 ? 44 : v0) > (46 ? 97 : i11)));
+                v0 = (((a0[4] && 34) - (i10 < v1)) ? ((i11 <= a0[0]) - (v1 && v2)) : ((v1 + v0) * (v2 > a1[3][4])));
+            }
+            i10 = i10 + 1;
+        }
+    }
+    v2 = (((v2 - v1) != (50 ? 4 : v1)) ? ((v3 && v0) == (v0 && v0)) : ((v0 + 12) ? (v1 / 8) : (a0[4] || v0)));
+    return (((74 / 8) / 7) > ((v2 == v2) / 9));
+}
+int f36() {
+    int v0 = 8;
+    int v1 = 88;
+    int v2 = 87;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v3 ? v3 : v1) ? (a0[8] >= v0) : (v2 ? a0[12] : v2)) || ((48 && v2) ? (v1 || a1[0][0]) : (65 || a1[0][9])));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((i0 >= v0) > 61) break;
+            v1 = (((i0 > i0) != (v2 % 3)) / 7);
+            v1 = (((20 == v2) < (v1 + a1[2][14])) || ((v0 == a1[3][11]) != (v3 && v3)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v0 / 7) >= (i0 - v1)) >= ((v0 ? a0[9] : v0) <= (v3 * 18)));
+                    a1[1][15] = (((a0[12] == v2) < (35 <= a0[0])) > ((38 % 6) != (v2 ? 65 : v3)));
+                    v2 = (((a1[3][13] % 3) || (36 ? a1[1][11] : a0[0])) == ((a1[0][1] / 9) * (a1[1][10] + 58)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((14 % 7) > 88) break;
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((i2 % 7) - (43 == v3)) || ((68 / 3) == (97 == 32)));
+                v2 = (((a1[2][14] >= a0[15]) < (v1 >= v2)) ? ((a1[1][8] || v0) ? (80 <= v2) : (i2 && a1[0][12])) : ((a0[4] >= a1[3][10]) + (i2 || 49)));
+                a0[3] = (((a0[12] || a0[7]) - (87 * i3)) || ((10 || a0[2]) != (a1[3][6] <= v2)));
+            }
+            a0[7] = (((a0[11] == a0[12]) ? (74 == v2) : (v0 != 8)) > ((a1[1][0] % 8) == (v1 <= v1)));
+            v3 = (((v1 / 1) % 7) && ((v2 < v1) - (a0[5] >= 72)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v2 = (((v3 * v2) - (v2 > a0[7])) / 6);
+    if ((((70 - 48) ? (v2 < v1) : (v3 != 85)) > ((v2 ? a1[3][15] : v0) < (a0[4] <= 91)))) {
+        a0[6] = (((v3 % 5) < (a0[15] ? a1[2][5] : v2)) ? ((v1 / 8) != (v0 - v3)) : ((v3 * a0[14]) <= (a0[9] != a1[1][8])));
+        a0[0] = (((a1[3][13] / 4) == (v0 < v0)) == ((3 > v3) < (v3 / 2)));
+        v1 = (((59 * a0[11]) / 7) ? ((v0 || 51) || (v3 + a1[0][10])) : ((44 >= 98) / 8));
+    } else {
+        a0[2] = (((26 || a1[3][9]) * (a1[3][12] * 82)) >= ((a1[1][6] && v2) - (a0[3] > v1)));
+        a0[8] = (((v3 > a0[9]) == (29 && v1)) ? ((v1 ? v3 : v0) - (v0 + 82)) : ((a1[0][2] && v2) - (a1[1][1] && v0)));
+        v1 = (((v2 && v2) || (v0 <= v2)) ? ((a1[3][1] + v3) >= (v0 > 78)) : ((74 > a0[6]) / 2));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            if ((a1[3][1] == 70) > 55) break;
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v2 = (((v0 / 9) > (i5 || a0[6])) ? ((a0[5] && v1) - (52 % 3)) : ((i4 > i4) ? (v3 ? 3 : 68) : (a1[1][14] < 36)));
+                v2 = (((a1[2][15] - 3) == (v1 - v1)) ? ((v2 / 9) != (58 != 49)) : ((a0[3] + 62) * (a1[0][15] < 36)));
+                v3 = (((i5 ? v1 : 64) ? (i4 / 5) : (a1[0][11] == v1)) >= ((i5 != 1) / 4));
+            }
+            a0[10] = (((a0[11] / 8) && (3 <= 96)) != ((v1 != 88) ? (v0 >= v0) : (v2 * v3)));
+            v0 = (((a1[0][14] ? a1[0][2] : v1) - (v1 != i4)) > ((v2 + v3) >= (a1[2][11] - a0[1])));
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((90 - 71) + (a0[4] <= 11)) >= ((68 >= a0[4]) % 7));
+    a1[0][7] = (((15 == a0[8]) - (a1[1][3] && 54)) / 6);
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        v0 = (((i6 % 2) + (i6 / 4)) < ((96 + v1) - (v2 >= v0)));
+        a0[3] = (((v3 - a1[0][7]) && (a0[9] != v2)) - ((57 / 2) % 5));
+        for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+            v3 = (((a1[1][6] ? i6 : a1[2][10]) < (a1[2][11] == v1)) > ((a0[9] + a1[0][9]) == (i6 > 13)));
+            a1[1][14] = (((v1 == a0[3]) >= (a0[1] || v0)) * ((a1[2][3] + a0[13]) < (v3 != 94)));
+            v2 = (((v2 <= 29) && (79 * 14)) == ((a0[4] && a0[14]) || (v1 * 52)));
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[1][5] = (((a0[13] != 58) < (i8 >= a1[1][2])) && ((87 * 38) - (0 + v0)));
+            v0 = (((i8 > 0) <= (36 != v1)) >= ((a0[10] < a1[0][4]) >= (47 <= a1[2][3])));
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    a1[3][10] = (((v3 / 6) ? (a0[12] || v1) : (86 || v3)) >= ((15 + v3) * (i9 < i9)));
+                    a0[9] = (((a1[1][0] * v1) % 3) == ((v1 >= v1) * (22 >= 55)));
+                    v2 = (((v2 - 56) - (v3 > a0[5])) || ((i9 * 12) && (v0 < 93)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    return (((v0 * a1[2][2]) > (v1 ? v3 : v1)) ? ((v0 > v3) < (v3 >= 19)) : ((32 != 5) ? (15 * 47) : (a0[3] ? v3 : v2)));
+}
+int f37() {
+    int v0 = 31;
+    int v1 = 35;
+    int v2 = 79;
+    int v3 = 5;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v3 = (((a1[3][14] <= a1[1][12]) == (61 % 5)) ? ((16 - a0[10]) < (38 / 4)) : ((18 ? a0[14] : 34) + (v2 && a0[12])));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v3 = (((v2 != v0) ? (16 > 3) : (v0 - v0)) * ((i0 ? i1 : a0[13]) || (v0 + a1[3][12])));
+                    v3 = (((a0[2] > 44) + (53 > i0)) ? ((a0[11] != v2) <= (v3 == a1[3][14])) : ((v1 / 2) / 8));
+                    v3 = (((v3 - i0) - (20 != 77)) < ((39 > i0) && (1 > 81)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[12] = (((93 ? i0 : 30) % 7) < ((a0[2] ? v2 : a0[5]) - (a0[13] > 79)));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v2 + v1) + (v3 ? a1[2][8] : 88)) >= ((9 != a1[2][15]) || (19 * v3)));
+    a0[14] = (((a0[13] - a1[0][0]) / 8) % 4);
+    if ((((v2 >= 98) * (v3 < v1)) && ((a1[2][14] > 69) - (a0[7] && v3)))) {
+        v1 = (((v0 > v0) < (v3 <= 39)) >= ((v3 % 6) == (a0[9] > 76)));
+        a0[10] = (((a0[14] && a1[2][14]) / 3) != ((v3 && 82) == (61 ? v2 : v3)));
+        v0 = (((v1 - v2) ? (v0 > a0[13]) : (90 || v0)) <= ((v2 > v2) || (a1[2][8] * v3)));
+    } else {
+        v1 = (((a1[0][7] / 3) >= (v2 - a1[0][3])) * ((a1[1][4] <= v0) > (a0[12] >= v0)));
+        v1 = (((v2 - 71) <= (v2 && a1[3][0])) % 8);
+        a0[7] = (((a1[2][3] / 9) % 3) < ((a1[3][11] != 60) >= (v2 != 89)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v2 = (((i3 || a0[14]) % 3) + ((v3 > i3) - (50 - v3)));
+                a0[9] = (((v3 || a0[6]) > (v0 + a0[7])) > ((v1 || 50) - (v2 < 94)));
+                v3 = (((i3 + i2) && (a1[0][14] % 5)) + ((v0 % 4) == (a0[11] < i3)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((v3 > a1[1][13]) * (v1 + v3)) || ((v0 - v1) > (a0[6] != v0)));
+        v0 = (((a0[10] - v3) * (99 || 75)) > ((v2 >= v2) + (49 ? a1[0][1] : 99)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v3 = (((v2 - v2) ? (v1 ? a1[1][9] : v2) : (v1 != 15)) == ((v3 < v3) ? (86 && 13) : (a0[8] || v0)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v0 = (((15 == a1[1][9]) ? (i5 ? v3 : v3) : (v2 - v3)) < ((52 + a0[2]) < (v1 * a0[6])));
+                v2 = (((v3 >= a0[0]) < (v1 != v1)) + ((a0[7] != i5) < (i4 * i5)));
+                v3 = (((v3 ? a0[4] : a1[1][9]) && (i4 >= i4)) + ((i5 + 74) * (v2 <= a0[0])));
+            }
+            v3 = (((v3 / 1) && (v1 && 39)) && ((v0 || 82) * (v0 < 2)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        a0[1] = (((90 <= a0[5]) < (a0[8] <= v2)) == ((v3 >= 89) <= (56 * v1)));
+        {
+            int i7 = 0;
+            do {
+                if ((v3 ? i7 : i6) > 59) break;
+                v0 = (((v3 >= i6) < (i6 / 1)) == ((v0 + v1) < (v3 / 6)));
+                a0[0] = (((73 ? 83 : 26) + (a1[1][7] != i7)) || ((i6 ? 83 : i6) - (v0 || 45)));
+                a1[3][14] = (((81 ? a1[3][0] : 64) == (i6 || v3)) / 7);
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        v0 = (((v0 || 43) <= (44 <= i6)) ? ((v1 * v2) || (v3 * v1)) : ((67 <= v0) >= (v2 / 4)));
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[15] = (((i8 - 32) > (v2 ? 79 : v3)) <= ((i8 - i8) != (i8 % 7)));
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((v0 / 8) - (a1[2][15] != a0[2])) <= ((25 - i8) % 3));
+                    v3 = (((3 + 3) - (v1 != a0[11])) + ((v1 < v0) * (a0[11] == v1)));
+                    v3 = (((48 <= v3) ? (v1 - 3) : (a0[0] + a0[3])) / 2);
+                    i9 = i9 + 1;
+                } while (i9 < 6);
+            }
+            a0[10] = (((i8 == v1) - (i8 ? a0[0] : a0[7])) ? ((13 >= 74) * (i8 + a0[3])) : ((a1[3][5] ? 58 : i8) - (59 + v0)));
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    v2 = (((a1[0][8] && v0) - (72 >= a1[2][9])) * ((v1 && a0[14]) % 9));
+    v2 = (((55 != v3) && (50 % 4)) ? ((89 / 9) == (v1 || a0[14])) : ((41 <= v3) / 7));
+    return (((v3 < v1) <= (79 >= 1)) > ((a1[0][5] == v1) % 1));
+}
+int f38() {
+    int v0 = 41;
+    int v1 = 98;
+    int v2 = 27;
+    int v3 = 94;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((i0 == i0) > 84) break;
+        a1[3][6] = (((a1[1][15] % 1) && (v1 % 4)) == ((i0 < a0[4]) > (v1 > a1[1][8])));
+        {
+            int i1 = 0;
+            do {
+                a0[0] = (((v1 ? 48 : 68) != (a0[11] == v1)) == ((i0 > a0[10]) - (a0[0] > i1)));
+                v2 = (((42 - i0) >= (v1 <= a0[13])) <= ((i0 && a0[12]) <= (72 >= 75)));
+                v2 = (((i1 ? a0[3] : i0) != (v3 < 61)) != ((v2 && v1) != (v3 + a0[4])));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v0 = (((v0 <= i0) ? (a1[0][2] == a0[8]) : (a0[8] - a1[3][13])) >= ((v2 - 49) != (a1[0][4] > v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((86 && i2) > 95) break;
+            a1[1][13] = (((v3 != a1[0][2]) != (46 % 1)) % 6);
+            {
+                int i3 = 0;
+                do {
+                    if ((16 + a1[2][9]) > 84) break;
+                    v1 = (((76 != i3) % 9) >= ((v3 % 4) && (v3 * 9)));
+                    a1[1][2] = (((a1[3][13] ? v1 : a1[1][7]) ? (v3 % 3) : (a0[15] - v2)) || ((a0[10] - a1[3][5]) ? (50 - v3) : (v1 % 4)));
+                    v1 = (((a1[2][0] % 7) < (i3 % 5)) && ((i2 * v1) <= (8 || a0[15])));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v3 = (((18 <= v0) > (34 + v3)) % 6);
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v0 = (((a1[1][8] % 8) && (v3 || v0)) > ((v1 * 47) > (v2 ? a1[0][5] : v2)));
+    if ((((v0 != v2) != (v0 > v2)) || ((v0 == v0) ? (a1[0][10] || v0) : (56 >= a0[2])))) {
+        v0 = (((a1[0][3] ? 50 : a1[2][15]) || (v2 || 41)) ? ((v2 < v2) ? (81 <= v2) : (62 / 9)) : ((64 ? 81 : v2) ? (v1 < v0) : (v2 > v3)));
+        v1 = (((v3 > v1) < (98 != 65)) <= ((a0[0] <= 99) / 4));
+        v1 = (((v1 % 2) || (v1 * v1)) <= ((a1[3][0] % 4) ? (v2 / 4) : (a0[1] && v3)));
+    } else {
+        v2 = (((58 - a1[1][3]) - (44 >= v2)) >= ((v0 == v2) - (v3 <= a1[0][4])));
+        v3 = (((51 - v2) ? (a1[1][8] != a0[5]) : (v3 <= v0)) < ((16 + a0[3]) + (v1 || v0)));
+        a1[1][13] = (((v1 - 73) ? (94 * v2) : (80 || v2)) || ((v2 / 1) == (v1 <= v2)));
+    }
+    a1[2][6] = (((14 * 85) == (a1[1][14] == v2)) > ((v3 - a0[4]) / 7));
+    if ((((v3 >= 52) ? (77 <= a1[0][10]) : (v1 <= v0)) || ((87 >= v2) - (v3 || 22)))) {
+        a1[3][3] = (((a0[14] ? v1 : v2) < (v0 - 35)) + ((a0[11] / 8) % 9));
+        v1 = (((a0[6] - v3) * (17 % 2)) == ((74 < 62) <= (v0 ? v1 : v2)));
+        v3 = (((v0 + v1) ? (25 - v2) : (v3 * v1)) - ((v3 + v3) || (v2 ? v1 : v2)));
+    } else {
+        v1 = (((31 != v2) < (25 && a1[3][10])) ? ((v3 >= 5) < (v3 <= v1)) : ((v2 > v2) / 9));
+        a0[6] = (((32 ? v1 : 79) + (a0[3] ? v1 : a0[4])) ? ((v0 < v3) < (a0[1] != v0)) : ((v1 ? v0 : v0) > (28 ? a0[14] : v2)));
+        v0 = (((v0 != 85) < (v1 * a0[2])) ? ((a1[3][13] && 98) ? (v1 ? v1 : v0) : (a1[2][15] % 2)) : ((a0[12] > v0) && (v2 / 9)));
+    }
+    if ((((a0[1] % 8) + (v3 - 23)) > ((v2 ? a1[2][15] : a1[2][4]) ? (v1 > 18) : (a0[11] <= v1)))) {
+        v1 = (((v2 - v1) >= (20 <= v3)) && ((v2 % 8) > (v0 != v0)));
+        a1[1][1] = (((v0 == v3) != (v0 && 13)) != ((v2 ? v2 : a0[7]) <= (71 % 7)));
+        v3 = (((41 + 87) % 5) < ((v1 ? a1[0][15] : a0[5]) <= (v3 * 91)));
+    } else {
+        v1 = (((a1[2][15] * v1) > (v3 < a1[1][6])) < ((16 % 5) * (98 > 70)));
+        v2 = (((70 % 3) / 4) < ((v3 >= v2) + (v2 || a1[3][2])));
+        a1[3][13] = (((a0[13] + 72) == (v0 ? v1 : v3)) || ((76 > a0[1]) == (94 < a1[3][2])));
+    }
+    v2 = (((24 >= a0[12]) ? (v1 <= 93) : (v3 ? v1 : a0[4])) == ((a1[3][10] / 3) <= (78 == v3)));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    if ((a1[2][14] && v2) > 55) break;
+                    v0 = (((v2 == i5) && (56 * a1[2][11])) / 5);
+                    v2 = (((a0[12] ? i4 : a1[1][3]) == (a1[3][11] && i4)) && ((v2 && a1[0][10]) ? (v0 != a1[0][9]) : (v0 || v1)));
+                    a1[2][2] = (((61 + a1[2][7]) % 4) >= ((v2 - i4) >= (v3 || v2)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((a1[3][8] <= a1[3][9]) >= (i4 != v2)) + ((83 ? 2 : v1) >= (a0[14] ? a1[3][10] : v3)));
+            v1 = (((57 < a1[1][2]) < (85 != v1)) == ((v2 < v0) ? (34 && a0[14]) : (v2 > 17)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    a1[0][3] = (((v1 * v2) / 4) * ((52 && v3) / 1));
+    return (((a1[3][3] != v0) || (47 ? a0[3] : a0[0])) ? ((a0[2] < 19) ? (v2 / 1) : (13 % 9)) : ((v0 / 7) != (58 == 22)));
+}
+int f39() {
+    int v0 = 51;
+    int v1 = 48;
+    int v2 = 10;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a1[3][11] = (((v1 && v1) + (39 && a0[5])) ? ((a1[0][10] && a1[3][12]) - (v1 ? a0[7] : i0)) : ((v0 / 5) >= (55 >= 80)));
+                    v0 = (((a1[1][0] < a1[1][11]) <= (31 <= v1)) >= ((43 == a0[1]) != (10 % 3)));
+                    v1 = (((73 == v0) == (v3 % 5)) - ((i1 % 5) + (a1[0][14] || v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v3 && a1[2][5]) / 5) ? ((v3 == 50) / 5) : ((32 ? a0[14] : 32) ? (v3 ? a1[1][7] : v2) : (v0 != v3)));
+            a0[12] = (((a0[11] * 68) / 8) / 6);
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((45 % 3) < (v1 % 6)) <= ((62 != v3) * (v1 >= v1)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((23 > 45) > 67) break;
+            v0 = (((v3 <= v1) <= (v1 / 6)) && ((a1[1][3] * v2) ? (a0[1] && v1) : (a1[1][7] >= 69)));
+            {
+                int i3 = 0;
+                do {
+                    a1[3][0] = (((44 != a0[5]) / 7) || ((v0 != v3) && (v1 - a0[0])));
+                    v1 = (((v0 == a0[15]) > (90 < i2)) ? ((i3 == 19) != (v1 % 3)) : ((i2 * a0[5]) + (70 - i3)));
+                    a0[1] = (((v2 == v3) < (a1[1][7] - 88)) <= ((a1[1][8] / 1) && (v0 / 1)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v3 = (((v2 ? a0[11] : 10) >= (v1 <= 58)) != ((v0 % 5) < (a1[3][2] == v1)));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((v1 <= v1) % 6) - ((v1 / 5) <= (a1[1][5] / 6)));
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        if ((a0[10] ? v2 : a0[5]) > 97) break;
+        {
+            int i5 = 0;
+            while (i5 < 6) {
+                if ((9 / 8) > 93) break;
+                v2 = (((47 == a0[3]) != (v1 ? v3 : i5)) && ((a1[3][3] + i5) % 3));
+                v3 = (((a0[15] || a0[13]) <= (i4 - v0)) > ((i4 && a0[14]) ? (a0[13] >= v2) : (i5 % 4)));
+                v2 = (((v3 ? 41 : a1[0][1]) >= (16 ? i5 : 1)) / 2);
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((i4 != 1) ? (a1[2][0] == v0) : (72 - a0[1])) / 8);
+        v1 = (((v2 && a1[3][10]) % 3) > ((6 < v1) > (a1[3][3] ? v3 : v0)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((a0[8] < v2) > 62) break;
+            v0 = (((v3 * v1) < (v3 >= v0)) || ((i6 - a0[0]) > (41 && 59)));
+            v1 = (((a1[1][10] && v0) < (16 + v1)) == ((v2 % 5) + (a0[13] <= 59)));
+            {
+                int i7 = 0;
+                do {
+                    a1[2][7] = (((i6 && i7) ? (66 ? 76 : 72) : (92 >= v0)) == ((a1[3][5] % 9) <= (i6 / 8)));
+                    v3 = (((v3 && i7) % 6) || ((a1[0][8] ? a1[0][2] : 6) % 8));
+                    v1 = (((v3 == 52) % 5) && ((v0 <= i6) - (a1[3][1] == 20)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    if ((v3 || a0[0]) > 83) break;
+                    v3 = (((44 <= v3) > (a1[1][6] > v3)) == ((v3 ? v1 : i8) >= (50 ? i9 : v1)));
+                    v0 = (((i8 ? v3 : 65) && (i8 >= 30)) != ((v2 - i8) ? (81 % 2) : (v3 - 50)));
+                    v3 = (((90 < v1) == (a1[2][14] <= a0[1])) != ((41 ? a1[1][2] : v2) % 6));
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            v3 = (((i8 == 38) <= (v2 <= 75)) >= ((37 && a1[2][6]) <= (11 || a1[2][4])));
+            v0 = (((5 || v1) - (v2 - i8)) % 8);
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    v0 = (((v1 <= v2) != (v3 * a0[11])) || ((v3 ? a0[1] : 51) >= (a0[12] == v0)));
+    if ((((17 - v0) % 9) + ((14 == v1) <= (v2 || v1)))) {
+        v3 = (((v3 >= a1[0][8]) && (13 / 1)) ? ((77 && 67) / 7) : ((v2 + v2) + (a0[13] <= 86)));
+        v3 = (((94 && 67) / 4) - ((v2 < v2) != (13 < 14)));
+        v2 = (((a0[8] * v0) != (v2 ? v2 : 92)) != ((v0 % 7) + (a0[11] || a1[3][7])));
+    } else {
+        v3 = (((v3 ? v0 : v1) >= (a1[3][4] <= a1[2][3])) * ((v3 + 37) != (v3 < v0)));
+        v3 = (((44 || a1[2][15]) - (v2 <= v0)) + ((v0 && 28) < (a1[3][8] || v2)));
+        a1[1][3] = (((v3 ? v1 : v2) < (v1 >= v2)) >= ((a1[3][13] && 53) < (a1[0][5] == v3)));
+    }
+    v3 = (((v0 > v0) && (v2 || v2)) / 4);
+    return (((v0 || v3) >= (v1 >= 31)) % 1);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    s = s + f4();
+    s = s + f5();
+    s = s + f6();
+    s = s + f7();
+    s = s + f8();
+    s = s + f9();
+    s = s + f10();
+    s = s + f11();
+    s = s + f12();
+    s = s + f13();
+    s = s + f14();
+    s = s + f15();
+    s = s + f16();
+    s = s + f17();
+    s = s + f18();
+    s = s + f19();
+    s = s + f20();
+    s = s + f21();
+    s = s + f22();
+    s = s + f23();
+    s = s + f24();
+    s = s + f25();
+    s = s + f26();
+    s = s + f27();
+    s = s + f28();
+    s = s + f29();
+    s = s + f30();
+    s = s + f31();
+    s = s + f32();
+    s = s + f33();
+    s = s + f34();
+    s = s + f35();
+    s = s + f36();
+    s = s + f37();
+    s = s + f38();
+    s = s + f39();
+    return s;
+}
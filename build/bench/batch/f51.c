@@ -0,0 +1,432 @@
+int f0() {
+    int v0 = 89;
+    int v1 = 12;
+    int v2 = 83;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    a0[2] = (((v3 ? v2 : a0[11]) * (a1[1][0] + 74)) + ((a1[2][12] / 9) == (v3 * v3)));
+    {
+        int i0 = 0;
+        do {
+            if ((v0 ? a0[5] : v2) > 80) break;
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v2 = (((a1[3][10] >= a1[2][11]) ? (a1[3][1] == i1) : (66 / 9)) != ((i0 == 90) >= (55 < 55)));
+                v3 = (((i1 ? v3 : a1[1][1]) <= (a1[3][4] - 89)) > ((i0 || a1[0][11]) >= (a0[10] ? v1 : a0[15])));
+                v1 = (((v0 <= a0[1]) < (i0 ? 58 : v2)) * ((v0 / 5) > (v2 ? 23 : a0[0])));
+            }
+            v2 = (((v1 >= v0) && (v3 < a0[13])) > ((24 < v0) > (v0 < v3)));
+            a1[0][1] = (((a1[2][9] % 1) - (a0[13] <= a1[1][4])) ? ((9 + a1[3][0]) < (v0 && a0[0])) : ((52 < a0[6]) || (v1 < 90)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((12 / 8) / 2) ? ((66 == 0) >= (v1 != 61)) : ((a1[3][1] == v2) || (v3 && v3)))) {
+        a1[0][12] = (((42 == v0) - (v3 > 3)) * ((a1[1][14] ? 72 : 64) < (96 - a0[15])));
+        v1 = (((a1[1][8] + v2) ? (88 - v1) : (v1 <= 75)) ? ((v0 == v2) == (83 ? v2 : a0[1])) : ((v0 < v2) % 7));
+        v1 = (((63 ? v0 : v3) % 4) % 9);
+    } else {
+        v2 = (((v0 != v3) < (v3 / 9)) * ((v1 - v1) <= (52 < 97)));
+        v0 = (((v1 + v2) < (v2 != v1)) >= ((88 > a1[0][3]) + (a0[12] >= 67)));
+        v0 = (((v1 <= 47) >= (40 >= 2)) * ((a0[10] == a1[0][9]) ? (31 / 7) : (17 <= v3)));
+    }
+    if ((((41 * a0[9]) < (v1 ? v0 : 7)) != ((v2 ? 70 : v3) && (26 * a1[3][6])))) {
+        v3 = (((v2 && v3) < (a0[12] != v3)) + ((v1 / 4) >= (v3 && v3)));
+        v2 = (((a1[2][8] == v1) % 5) ? ((v0 == a1[0][15]) * (v1 ? v0 : a1[0][7])) : ((a1[3][3] + 18) > (v1 + v2)));
+        v3 = (((v3 % 6) >= (a0[11] < 71)) <= ((v1 < v3) && (v2 * 8)));
+    } else {
+        v3 = (((4 - v3) * (90 <= 88)) + ((a1[2][6] == v0) % 5));
+        v0 = (((96 && v3) ? (a0[2] ? v0 : v1) : (a0[8] && v3)) - ((a1[2][6] || a1[1][15]) + (v2 ? a0[10] : v1)));
+        v0 = (((a1[0][0] - 83) && (12 + v0)) * ((a0[12] >= a0[0]) / 5));
+    }
+    v1 = (((v3 < v1) / 7) <= ((a1[2][0] >= a1[0][14]) >= (v2 == v1)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((v2 >= a1[0][12]) > 92) break;
+                v3 = (((a1[0][15] || 88) <= (a1[1][3] < v1)) >= ((a1[0][13] * v2) > (v3 != v1)));
+                a0[9] = (((59 / 1) == (a1[1][3] < 12)) == ((a1[2][10] ? a1[0][11] : 88) ? (v1 == 20) : (a0[11] != 32)));
+                v0 = (((61 != a0[9]) > (58 % 8)) || ((v2 || v3) % 2));
+            }
+            v1 = (((i2 || a1[0][0]) + (v2 / 3)) + ((v3 <= v0) % 1));
+            v1 = (((a0[15] && a1[0][1]) ? (a1[0][8] ? 58 : 1) : (a0[14] + v0)) && ((v3 == i2) <= (v2 ? v0 : a0[12])));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((a1[0][4] ? a0[13] : a1[3][12]) / 9) || ((a0[14] < v0) * (v1 <= v2)));
+    if ((((a0[11] < v0) ? (a1[2][5] ? 58 : v0) : (a1[1][8] >= v3)) != ((a0[4] == v0) ? (a1[1][1] - v3) : (a1[2][9] > a1[0][2])))) {
+        v0 = (((v2 != a1[0][10]) * (v3 <= 73)) ? ((a0[5] == a1[1][12]) / 6) : ((76 % 1) >= (v2 <= a0[10])));
+        v1 = (((a0[6] ? 50 : v1) != (a0[0] * a0[1])) <= ((v1 <= v2) >= (a1[2][3] + v3)));
+        v1 = (((61 - a0[12]) > (a1[2][10] <= v3)) + ((99 != v3) || (v0 / 1)));
+    } else {
+        v3 = (((v0 > a0[7]) / 8) > ((v3 != v0) != (v2 >= v1)));
+        v1 = (((v0 == 71) == (a1[0][6] * v3)) < ((v0 && 73) ? (v2 ? v2 : a0[14]) : (v2 + a1[2][7])));
+        v1 = (((49 - v0) <= (26 || 68)) ? ((v1 != a1[2][2]) < (81 < a1[0][4])) : ((v2 >= v0) - (a1[2][5] + v1)));
+    }
+    if ((((4 ? v1 : a1[3][4]) > (94 < v2)) + ((v0 != v1) ? (v2 ? v2 : a1[2][0]) : (41 - a0[14])))) {
+        v0 = (((41 > a1[0][14]) == (a1[3][13] / 1)) && ((v2 >= 23) && (46 + 48)));
+        a1[3][11] = (((a1[0][10] || a1[0][11]) ? (v1 ? 67 : v2) : (v1 * v0)) && ((v2 == a0[13]) * (a0[11] == a0[1])));
+        v0 = (((v2 + a1[2][3]) != (v3 % 2)) != ((v1 + a1[0][2]) >= (v3 + 52)));
+    } else {
+        v3 = (((v1 ? a1[0][11] : v1) == (v1 ? a1[1][4] : 82)) >= ((v0 > v0) * (v1 >= v3)));
+        v0 = (((v1 != a0[13]) >= (a1[1][6] > a1[1][5])) ? ((a0[12] > v0) / 4) : ((v2 / 4) + (90 + 80)));
+        a0[8] = (((43 > a1[0][6]) >= (a0[13] && v1)) == ((v3 ? a1[0][8] : v1) ? (69 / 5) : (a1[1][12] <= a1[3][10])));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                v2 = (((i4 - v2) ? (v3 != 37) : (27 + v1)) ? ((i4 - 50) / 9) : ((a1[2][4] && a1[2][5]) != (64 == v0)));
+                v0 = (((32 || a1[0][5]) ? (25 + v1) : (v1 < i5)) / 4);
+                v1 = (((v0 || v2) >= (v2 ? a0[3] : i5)) * ((v0 * v2) + (a0[6] - a0[1])));
+            }
+            v2 = (((49 % 1) ? (v2 == a1[0][4]) : (v1 && v3)) <= ((a1[2][14] < a1[2][8]) != (v3 || 76)));
+            v3 = (((48 < v3) && (v3 + v3)) <= ((v2 - a0[13]) + (19 * i4)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v3 * 7) ? (v1 || v2) : (18 == 92)) > ((4 % 3) != (v1 ? v1 : 40)));
+}
+int f1() {
+    int v0 = 48;
+    int v1 = 2;
+    int v2 = 13;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    if ((((4 <= v2) * (v3 >= 80)) * ((v1 > 39) % 2))) {
+        v1 = (((v2 / 7) + (12 != v3)) - ((a1[1][7] <= v2) % 7));
+        v1 = (((v2 && v0) < (a0[4] >= a1[1][3])) * ((v2 != v3) != (v2 + 5)));
+        a0[7] = (((v3 - 95) != (v0 ? v3 : v0)) <= ((v0 * v3) >= (a1[2][11] * 44)));
+    } else {
+        v3 = (((v2 + v1) || (v1 <= 57)) < ((v1 % 3) % 7));
+        v0 = (((v1 + a1[2][7]) && (v3 + v1)) ? ((v3 - v3) + (a0[6] - v0)) : ((v2 ? a0[4] : a0[2]) % 2));
+        a0[9] = (((90 || v2) / 7) ? ((v2 / 2) == (a0[0] > a0[8])) : ((88 <= 31) > (a0[1] < v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v0 = (((v1 != 72) % 6) == ((a0[10] < v0) * (24 ? a1[0][12] : 2)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v3 = (((55 >= i1) * (i1 == v2)) * ((18 ? a0[6] : i1) ? (a1[1][11] < v2) : (i1 ? v0 : v3)));
+                    v2 = (((v1 != v2) + (i1 ? 4 : a0[2])) && ((a0[1] > v0) % 1));
+                    v3 = (((v0 >= a0[15]) != (v0 % 5)) || ((v1 > v0) % 8));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((60 && 28) == (a1[3][12] - a0[10])) % 8);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 - v1) != (a0[13] != v1)) ? ((89 >= a0[5]) * (v2 ? v1 : a1[0][5])) : ((v1 - 33) <= (a1[0][9] - 42)))) {
+        v3 = (((55 > v1) && (33 > v0)) / 9);
+        v0 = (((v0 / 5) < (v3 || a1[1][11])) / 3);
+        v3 = (((v1 / 1) ? (77 < 79) : (38 ? v3 : a0[8])) <= ((v2 > 19) > (v2 != 54)));
+    } else {
+        a1[2][9] = (((9 || v2) * (a0[2] && v1)) && ((a0[8] || v2) > (42 == a0[2])));
+        v2 = (((v0 != a1[1][1]) + (a1[2][1] != v0)) - ((v2 >= a1[3][6]) != (v3 != 80)));
+        v1 = (((53 != a1[1][0]) ? (a0[14] != 80) : (62 % 5)) ? ((81 == 87) * (a1[0][6] > a0[14])) : ((v3 > v3) ? (v1 <= a1[3][15]) : (v0 ? v0 : v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a1[0][5] = (((i2 != i2) <= (v2 < v3)) ? ((v1 ? a1[0][11] : v1) * (v0 > 18)) : ((v0 < v0) || (v0 == v0)));
+                v3 = (((v1 ? v1 : 83) / 8) == ((i2 * 75) - (a0[2] + 86)));
+                v1 = (((58 * a0[7]) == (v0 ? a0[13] : i2)) ? ((a0[13] * a0[4]) == (v1 * a1[3][0])) : ((i2 + a0[9]) != (i2 + i2)));
+            }
+            v3 = (((a0[3] / 3) < (v3 ? a1[3][10] : 89)) % 7);
+            v1 = (((51 != 8) >= (a1[0][5] ? a0[15] : v0)) <= ((v0 > v0) * (a0[2] <= v3)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    a1[2][14] = (((v2 < v2) ? (v0 / 1) : (13 > 53)) ? ((v3 / 3) <= (a1[3][1] || a0[5])) : ((v0 > 22) + (45 - a0[12])));
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        if ((74 > a1[2][12]) > 61) break;
+        {
+            int i5 = 0;
+            do {
+                v2 = (((a0[8] && a0[14]) != (v3 >= 61)) % 7);
+                v3 = (((v2 + 43) >= (v2 * a1[2][7])) < ((v1 + i4) >= (89 * i5)));
+                a0[12] = (((v3 != a0[0]) / 7) > ((v3 ? v1 : v0) >= (82 <= a0[9])));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        a1[2][8] = (((v3 && a0[2]) / 1) || ((v1 && a1[2][2]) < (a1[2][4] > v1)));
+        a0[10] = (((v1 ? a1[1][3] : 10) / 4) + ((v3 <= 15) != (v3 ? v0 : v0)));
+    }
+    v2 = (((a1[2][6] - 35) >= (a1[2][8] * v0)) < ((38 <= v3) > (v2 > v1)));
+    if ((((v0 < v0) <= (v1 == a0[15])) * ((v3 - 84) - (v2 ? v2 : v0)))) {
+        v3 = (((55 >= v1) % 3) ? ((81 < v1) + (v2 == 6)) : ((v3 == 92) ? (v3 && a0[1]) : (a0[5] != v2)));
+        v1 = (((75 != a0[8]) ? (97 && a1[3][7]) : (a1[2][6] / 3)) > ((a0[15] ? v3 : v3) != (28 > 99)));
+        a1[3][3] = (((a0[2] || v3) && (v3 < v0)) <= ((a0[9] >= a0[13]) + (v1 * a0[13])));
+    } else {
+        v3 = (((v0 * a0[3]) == (v0 && v2)) > ((a0[7] <= 66) <= (81 ? v0 : v3)));
+        a0[1] = (((61 && v2) > (a1[2][0] ? 13 : 90)) * ((v0 % 2) ? (1 % 5) : (a1[1][14] < a1[1][2])));
+        a0[12] = (((a0[12] >= v1) * (52 ? 1 : 71)) % 2);
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    v0 = (((83 % 9) * (v3 == a1[3][12])) * ((65 > v2) >= (i6 - v2)));
+                    v1 = (((30 && v1) / 5) % 2);
+                    v3 = (((a1[2][12] ? 24 : v3) ? (a1[0][12] > 3) : (v1 ? v2 : a0[10])) || ((v1 || a1[1][3]) < (v1 ? a0[8] : 36)));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((v0 < a0[6]) || (a1[0][0] - v2)) < ((a1[3][15] / 1) || (28 >= v3)));
+            v3 = (((v3 - v2) % 5) - ((v1 % 8) < (15 ? v1 : a1[3][11])));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    if ((((a1[1][5] && v2) == (7 != 47)) > ((3 > v0) == (v1 / 3)))) {
+        v3 = (((83 >= 5) > (v0 <= a0[1])) <= ((v0 != v3) / 6));
+        v3 = (((91 ? v2 : 1) ? (v1 != v3) : (62 * 24)) != ((a0[5] ? a0[15] : v2) > (v0 >= 46)));
+        a1[2][7] = (((5 && v2) ? (94 * v1) : (v2 || v1)) * ((a0[1] < v3) != (28 % 1)));
+    } else {
+        a0[7] = (((v2 + 3) < (v1 / 4)) + ((a1[3][11] != v3) ? (a1[3][15] / 3) : (a1[1][8] - v0)));
+        v3 = (((v2 * v1) <= (a1[2][9] ? a1[0][2] : v1)) ? ((v1 + a1[0][8]) <= (61 && a1[1][14])) : ((84 <= 59) * (83 / 7)));
+        v2 = (((61 / 9) - (v2 + a1[0][1])) % 9);
+    }
+    return (((v2 % 4) * (v1 || v3)) && ((a0[12] < a1[2][3]) <= (v2 < a1[0][5])));
+}
+int f2() {
+    int v0 = 45;
+    int v1 = 79;
+    int v2 = 50;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v2 = (((10 && v0) * (v0 - i0)) - ((87 || v0) + (v1 - a1[2][10])));
+            {
+                int i1 = 0;
+                do {
+                    a0[3] = (((i1 + 82) <= (v3 + 81)) > ((i0 > a0[0]) ? (82 ? v1 : a1[3][0]) : (36 / 5)));
+                    v0 = (((v3 ? a1[0][7] : 70) < (a0[6] ? a1[3][0] : 82)) ? ((v0 + v2) ? (69 - a1[3][1]) : (a0[6] == i0)) : ((i1 % 2) == (a0[9] <= 51)));
+                    a1[2][3] = (((89 >= 43) == (v2 > a1[0][10])) < ((a1[2][5] == v0) % 1));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v2 = (((v0 <= v1) && (a0[4] < i0)) == ((a1[3][7] + v1) >= (a0[14] == 14)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        a1[2][2] = (((v3 && v1) - (v2 + i2)) ? ((4 ? v0 : 80) + (v1 ? 35 : v3)) : ((a0[1] >= a1[3][13]) != (v3 < v0)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            v3 = (((a1[3][12] > 88) * (a1[1][10] ? 53 : 8)) ? ((6 || v3) >= (a1[3][8] ? a1[1][8] : 18)) : ((a1[1][11] <= a0[9]) < (v0 || v1)));
+            v3 = (((v2 ? a0[3] : 98) < (28 || 2)) > ((12 - 44) == (a1[1][6] || i3)));
+            v1 = (((i2 || 7) <= (67 + 0)) != ((66 % 3) + (a0[3] >= v3)));
+        }
+        v2 = (((a1[1][2] / 3) * (14 == v1)) < ((v1 - 18) % 8));
+    }
+    if ((((40 != v0) && (18 - 63)) + ((v3 ? v0 : v3) >= (v1 > a1[1][2])))) {
+        a1[3][4] = (((32 <= v1) || (v3 ? v2 : a1[2][3])) % 1);
+        v0 = (((59 + v0) - (19 >= v0)) - ((a0[1] && v0) ? (v0 != v2) : (a0[2] || 74)));
+        v2 = (((76 || v2) % 3) || ((50 || v3) >= (v1 == v2)));
+    } else {
+        v1 = (((a1[3][10] > v2) / 7) * ((v1 >= a0[0]) - (v2 != a1[1][14])));
+        a0[9] = (((53 >= v3) == (a1[2][9] % 5)) / 4);
+        v0 = (((40 && v0) == (a0[13] > 6)) >= ((a1[3][13] || a1[0][2]) + (v1 < v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v1 = (((1 && v0) != (v0 - a0[0])) < ((a0[15] ? v0 : 96) == (a1[3][2] + v1)));
+            v2 = (((v3 > v0) * (a1[0][4] ? 35 : v0)) >= ((v0 != v3) < (a1[3][10] / 8)));
+            {
+                int i5 = 0;
+                do {
+                    if ((a1[3][12] > 28) > 63) break;
+                    v0 = (((v0 != a0[3]) > (a0[1] + 33)) ? ((18 ? 83 : i5) % 5) : ((4 * 25) ? (v0 && a0[7]) : (i5 > 13)));
+                    v2 = (((85 || 13) * (v0 == v3)) + ((a1[3][8] * i5) >= (i5 || v1)));
+                    v3 = (((81 >= v2) + (9 + a0[10])) % 1);
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            if ((71 % 5) > 69) break;
+            v1 = (((v3 + a1[0][1]) * (a0[0] ? a0[1] : 77)) ? ((a1[3][11] <= 16) + (a1[0][7] > i6)) : ((v2 >= v3) + (v0 * v1)));
+            v0 = (((a0[4] / 9) || (i6 / 6)) * ((v2 + a0[11]) % 6));
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    a1[1][7] = (((v2 || 7) / 7) >= ((v3 ? a1[0][8] : a1[0][1]) >= (31 + i7)));
+                    v1 = (((i7 != 24) == (78 <= v3)) % 4);
+                    v0 = (((v2 != v3) ? (i7 - a1[3][3]) : (4 <= 83)) ? ((31 || a0[2]) != (i7 % 6)) : ((i6 + v0) > (17 >= 18)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v3 = (((v1 >= 79) < (v3 >= 44)) % 8);
+    v1 = (((a1[0][11] > 28) && (v1 + v1)) + ((a0[10] < a1[1][3]) > (a1[3][0] - a1[2][11])));
+    if ((((v0 || v2) ? (v1 ? v1 : v1) : (v3 / 1)) ? ((v2 ? 89 : v0) >= (v0 + v3)) : ((a1[2][2] > a0[0]) <= (v0 >= v2)))) {
+        a0[15] = (((v1 || v3) || (a1[2][3] < a0[3])) >= ((v3 * v3) != (v3 > 12)));
+        a0[2] = (((v0 && v0) >= (a1[3][1] >= 68)) % 8);
+        a0[7] = (((v3 || v1) && (77 % 7)) + ((a1[3][14] * v2) || (36 > v2)));
+    } else {
+        v3 = (((v0 && 46) - (v2 && v0)) ? ((62 % 6) - (v3 * v3)) : ((79 || v2) % 2));
+        v2 = (((a1[1][12] < a0[13]) ? (v3 != 6) : (v1 || a1[2][3])) >= ((a1[2][7] == v0) < (a0[3] == v1)));
+        v1 = (((v1 == v0) >= (a0[5] + v1)) / 7);
+    }
+    if ((((a1[0][11] == a1[0][1]) ? (4 ? v3 : v0) : (v3 == v2)) / 9)) {
+        v2 = (((v3 ? a1[1][3] : v2) && (0 ? 81 : v3)) == ((a0[15] ? a1[3][1] : 24) - (a1[3][0] > v1)));
+        v0 = (((14 || v0) && (v1 * v2)) * ((a0[10] <= 30) * (87 || a1[0][8])));
+        a1[3][10] = (((v3 * v3) + (38 * v0)) ? ((a1[2][2] + 58) % 8) : ((v0 < v3) == (57 <= a1[3][4])));
+    } else {
+        v3 = (((v3 == 30) == (v0 * v2)) / 4);
+        v3 = (((65 ? a1[1][12] : v2) / 6) == ((v0 < v3) <= (v2 > 8)));
+        a0[6] = (((v3 * 71) < (41 / 1)) % 4);
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        v2 = (((v0 != 81) < (v1 != v3)) >= ((v1 - 10) > (i8 / 6)));
+        {
+            int i9 = 0;
+            while (i9 < 3) {
+                a1[2][12] = (((66 % 4) - (a0[6] == a0[9])) > ((v2 - v2) / 7));
+                v2 = (((a1[3][0] == 91) != (i8 ? 68 : a0[10])) <= ((45 != a1[2][2]) ? (i9 % 6) : (51 || 58)));
+                a1[1][11] = (((v2 * a1[0][4]) && (a1[0][1] / 1)) || ((i9 || a1[1][3]) < (a1[3][3] - 26)));
+                i9 = i9 + 1;
+            }
+        }
+        a1[2][6] = (((29 && v1) - (82 || a0[12])) == ((v2 > 17) < (v2 && v1)));
+    }
+    return (((v1 && 98) - (v0 + v2)) + ((v0 + a1[3][0]) % 4));
+}
+int f3() {
+    int v0 = 43;
+    int v1 = 51;
+    int v2 = 26;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((v0 + v1) % 6) < ((a0[7] == 17) % 6));
+            a0[5] = (((v1 != 2) ? (i0 != 58) : (v1 ? a1[1][5] : a1[2][3])) / 5);
+            {
+                int i1 = 0;
+                do {
+                    a0[14] = (((55 / 5) == (a1[1][3] < i1)) > ((a0[2] && 56) >= (i1 ? a1[2][12] : a0[0])));
+                    a0[0] = (((a0[10] != v1) < (v3 || 12)) + ((84 <= 99) + (96 > 58)));
+                    v3 = (((a1[3][11] - i1) && (v2 || a0[3])) - ((i0 / 2) == (i1 >= v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[2][9] ? v2 : v2) || (v3 > v3)) / 2)) {
+        v2 = (((a0[12] == v1) != (v3 && a0[6])) && ((65 == a0[12]) * (a0[0] < v0)));
+        a1[3][10] = (((v3 == a1[3][7]) - (v0 && 19)) < ((v1 < v0) != (a0[7] < a0[15])));
+        v2 = (((v0 < a1[1][0]) || (a0[15] > v3)) || ((a1[3][9] && 67) * (v1 != v2)));
+    } else {
+        a1[2][4] = (((v3 && 98) > (65 ? v2 : 59)) && ((v1 % 4) - (v1 || v2)));
+        v1 = (((a0[11] / 9) || (v3 % 9)) - ((a1[1][5] == v2) > (v2 && v2)));
+        v1 = (((v0 && 21) > (v0 >= v1)) - ((13 ? 77 : a1[0][8]) < (v0 == v2)));
+    }
+    v0 = (((90 % 4) % 2) > ((v3 < a1[3][3]) * (v0 < a0[2])));
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((a1[3][6] > 75) > 72) break;
+        a0[14] = (((42 != i2) >= (43 >= 89)) > ((a1[1][14] && 2) == (92 - 51)));
+        v3 = (((v0 % 7) ? (v3 / 7) : (43 <= 81)) ? ((36 - 22) == (94 < v0)) : ((v2 * a1[2][6]) % 2));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                v3 = (((i3 && a0[13]) - (i3 * v0)) * ((a1[3][7] ? a1[1][12] : 80) + (47 * 97)));
+                v1 = (((v0 > a1[2][10]) % 6) && ((a0[6] != a0[14]) <= (a0[12] > v3)));
+                v3 = (((i2 * 98) <= (a1[2][11] - a1[2][6])) ? ((9 != 38) % 7) : ((21 / 2) <= (a1[1][3] >= v0)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v2 = (((50 - v2) != (a1[1][11] > 20)) / 3);
+            a1[0][10] = (((a0[5] <= 28) >= (a1[1][10] / 2)) ? ((v1 ? a0[6] : v1) - (v3 * a0[10])) : ((a0[4] <= a0[15]) || (v1 ? v3 : a1[3][6])));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a0[15] = (((a0[11] + 98) || (i5 > 74)) % 7);
+                a0[10] = (((55 - i4) != (v3 / 1)) >= ((v0 > i4) * (v1 || v0)));
+                v0 = (((47 || v2) + (v3 < v3)) ? ((40 <= v3) != (a0[4] ? a0[5] : v2)) : ((39 ? 39 : v3) / 7));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v1 = (((a0[14] ? v0 : 70) != (v1 ? v1 : 10)) % 7);
+    {
+        int i6 = 0;
+        do {
+            if ((v2 && 82) > 99) break;
+            v0 = (((v2 > a1[3][13]) < (a1[3][2] <= v2)) < ((v3 ? v0 : 58) - (92 != a0[15])));
+            v2 = (((v2 % 9) || (a1[2][5] <= v3)) == ((79 == v0) / 2));
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    a0[2] = (((56 ? v1 : v1) && (v0 || v2)) >= ((v0 ? i7 : 6) ? (a0[13] ? v0 : 47) : (v1 <= v2)));
+                    a0[13] = (((a1[0][8] && v0) ? (83 ? i7 : v2) : (v2 + 63)) >= ((78 && v1) < (9 && a1[0][13])));
+                    v1 = (((v2 < 9) < (17 <= a0[10])) != ((a1[3][15] - i6) < (47 * a1[1][2])));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    v0 = (((v2 - 92) / 9) / 6);
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            v0 = (((51 != a0[8]) / 8) >= ((a1[3][3] + v1) || (v2 % 7)));
+            v1 = (((v2 * v2) && (62 < 23)) <= ((a1[2][14] * v2) >= (v1 < v0)));
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    if ((v3 >= a1[3][9]) > 98) break;
+                    a1[1][3] = (((v3 >= 83) / 4) < ((a1[2][13] || v2) > (57 * i8)));
+                    v1 = (((a0[4] >= v2) < (v1 - i8)) == ((v0 > 28) ? (a1[1][5] ? a1[3][5] : 65) : (16 <= v2)));
+                    v2 = (((v0 != a0[2]) > (a0[5] + v2)) < ((a1[3][3] * 37) == (a1[1][5] != 19)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        do {
+            v0 = (((v3 * v3) * (a0[7] <= v1)) - ((v3 * a1[1][7]) == (v1 * a0[4])));
+            v3 = (((v3 + a1[2][3]) + (64 != v1)) % 6);
+            for (int i11 = 0; i11 < 3; i11 = i11 + 1) {
+                v0 = (((13 && v2) / 6) >= ((a0[14] * v2) < (82 && v0)));
+                v0 = (((a0[5] >= i11) > (i10 < v1)) <= ((v0 ? 53 : 15) + (v0 + a1[3][4])));
+                v2 = (((a0[13] <= a0[10]) ? (a1[1][1] >= i10) : (i11 == v3)) <= ((a0[13] + v2) - (13 + v1)));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 4);
+    }
+    return (((v0 == v0) ? (27 || 94) : (a1[0][11] + 19)) ? ((v1 > v0) ? (a0[14] >= a0[5]) : (a1[2][7] == 32)) : ((33 + a1[2][15]) % 1));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
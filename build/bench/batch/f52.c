@@ -0,0 +1,139 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 93;
+    int v2 = 37;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v0 || v0) >= (a0[10] - v0)) < ((v1 % 2) || (v2 - v2)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 / 6) ? (v0 >= i0) : (i0 != a1[1][7])) ? ((v3 * a1[3][12]) == (30 % 9)) : ((a1[3][12] || a0[5]) <= (78 ? i0 : i0)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a1[3][8] <= a1[0][15]) % 3) % 3);
+                    a0[13] = (((v1 ? a1[0][7] : 39) != (v2 / 8)) / 2);
+                    v1 = (((v0 * 83) * (23 + a1[1][13])) + ((v0 - v0) % 2));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v3 = (((v2 * a1[2][3]) / 4) && ((a0[7] ? 77 : a0[12]) < (a0[13] ? a0[15] : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v3 - 39) * (79 <= v2)) ? ((v2 / 5) > (a1[0][14] / 2)) : ((58 != v3) + (v2 >= v0)))) {
+        v0 = (((14 || a0[13]) / 6) + ((v2 || 96) != (v2 != 41)));
+        v0 = (((v2 / 6) != (a0[10] / 5)) < ((v0 <= 19) || (a1[0][15] / 3)));
+        v0 = (((v3 && a0[9]) == (v2 <= v1)) - ((v0 / 3) >= (v0 ? v1 : v0)));
+    } else {
+        v1 = (((29 ? v0 : a0[6]) ? (a1[0][12] / 9) : (77 ? v2 : 20)) > ((a0[6] && a1[0][2]) == (v1 / 6)));
+        v1 = (((a0[7] > a1[1][1]) * (a0[8] + a1[1][14])) || ((v3 < 16) - (84 || 66)));
+        a0[12] = (((v2 > v3) * (a0[2] > v1)) ? ((36 * v2) || (a0[10] % 7)) : ((7 / 5) * (a0[10] / 7)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a1[0][12] * v1) / 3) || ((36 - v0) - (53 ? 43 : a0[8])));
+            v2 = (((83 && a0[4]) <= (v1 && v1)) < ((v1 > 17) - (67 / 3)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((i2 != a1[3][9]) < (a1[2][6] == 62)) || ((22 != i2) % 2));
+                    v0 = (((a0[12] + v2) + (11 > 9)) ? ((a0[12] != v2) / 9) : ((a1[2][1] ? i3 : i3) % 7));
+                    v2 = (((a0[5] * 90) * (a1[0][7] && v2)) ? ((a1[3][6] < a0[15]) >= (a1[0][7] * v2)) : ((a1[3][12] ? v3 : a0[2]) > (a1[3][13] <= v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[7] = (((a1[3][13] == v2) > (v1 == a0[3])) / 5);
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                if ((43 >= i4) > 64) break;
+                v3 = (((43 % 7) == (v2 - i4)) || ((13 - v0) + (85 + v0)));
+                v2 = (((v2 + a1[3][1]) ? (a1[2][14] && v2) : (a0[11] <= 20)) % 8);
+                v2 = (((a0[14] + v2) - (v3 < i5)) || ((13 * a1[2][0]) % 4));
+            }
+            v1 = (((v1 % 9) - (v2 ? a0[12] : v0)) <= ((56 || v2) - (v2 && 95)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v0 = (((65 < 69) < (v2 ? v3 : v2)) < ((v3 < 39) % 8));
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    if ((v0 + a0[12]) > 52) break;
+                    v0 = (((62 || 18) != (62 % 9)) != ((20 > 49) * (a1[1][15] >= 62)));
+                    v2 = (((49 == v1) <= (93 >= 62)) ? ((51 || v3) ? (v0 > 74) : (a0[2] % 4)) : ((a1[2][0] ? v2 : v1) && (91 && a1[0][10])));
+                    v2 = (((v0 % 3) < (a1[0][3] != a1[0][14])) / 5);
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((a0[13] || v2) >= (48 / 2)) * ((v2 % 3) / 2));
+            a1[2][9] = (((a1[3][14] / 8) % 3) < ((v3 && a1[3][2]) + (92 ? 33 : v0)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[0] = (((a1[2][9] == v2) != (v2 == 4)) / 5);
+            v1 = (((v0 + i8) >= (a1[2][3] || a1[0][4])) + ((a0[2] ? a1[2][4] : 59) < (v2 ? a0[9] : v3)));
+            {
+                int i9 = 0;
+                do {
+                    if ((v2 % 1) > 96) break;
+                    v3 = (((a0[1] % 9) / 5) && ((80 > i9) && (a0[6] ? i9 : a0[4])));
+                    v2 = (((i8 ? v3 : v0) ? (v0 != a0[0]) : (v1 || a1[1][3])) * ((v0 || i8) != (a0[12] * v2)));
+                    a1[2][14] = (((29 + v0) ? (98 >= a1[0][6]) : (v1 > 17)) != ((a0[9] < v2) + (i9 - a0[5])));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        v1 = (((v0 + i10) != (a0[14] || a0[4])) * ((v0 <= 51) * (a1[2][15] % 8)));
+        {
+            int i11 = 0;
+            while (i11 < 8) {
+                a0[15] = (((a1[2][2] && v0) >= (a0[10] != v0)) != ((v0 || v0) <= (v3 > 72)));
+                a1[2][11] = (((v0 < 82) > (v2 >= v3)) ? ((a1[0][0] * a0[0]) + (v1 < a0[2])) : ((a0[9] % 8) ? (v0 - a0[9]) : (v3 != v3)));
+                v1 = (((a0[8] <= a1[0][15]) + (93 > v2)) == ((a1[3][2] + 28) - (i11 || 84)));
+                i11 = i11 + 1;
+            }
+        }
+        v0 = (((a1[0][14] + a0[10]) != (63 > a1[1][11])) < ((v2 - v1) >= (v2 ? i10 : a0[11])));
+    }
+    {
+        int i12 = 0;
+        do {
+            v2 = (((v2 < v1) * (i12 ? 57 : i12)) * ((a1[3][8] % 3) || (v3 % 8)));
+            v3 = (((7 >= 57) % 7) + ((a0[12] <= v3) != (v0 || 91)));
+            {
+                int i13 = 0;
+                do {
+                    v3 = (((v2 == i12) % 1) * ((v0 == i13) ? (a0[14] <= i13) : (v3 * v3)));
+                    v2 = (((i12 * v1) == (v2 ? v1 : v2)) && ((v0 ? a1[2][3] : a1[0][4]) && (a1[1][10] <= i13)));
+                    v3 = (((27 - 68) > (a0[12] || a1[1][1])) * ((49 && v3) * (v2 + 19)));
+                    i13 = i13 + 1;
+                } while (i13 < 8);
+            }
+            i12 = i12 + 1;
+        } while (i12 < 8);
+    }
+    return (((v2 != v0) % 6) >= ((76 && a1[0][7]) && (v3 ? 29 : 26)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
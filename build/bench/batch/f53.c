@@ -0,0 +1,205 @@
+int f0() {
+    int v0 = 11;
+    int v1 = 85;
+    int v2 = 62;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((86 || v0) - (v1 <= 67)) ? ((v0 || v2) % 8) : ((49 <= v2) ? (a0[6] - v0) : (a1[2][9] >= 52)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v3 = (((i0 && 42) * (a0[9] % 2)) < ((30 - v0) <= (74 >= 40)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((v2 <= v2) > 53) break;
+                    v2 = (((v1 < a0[0]) / 2) + ((v0 || i1) + (74 != i0)));
+                    v2 = (((a1[2][4] != v2) ? (v1 + 28) : (1 / 1)) - ((3 + i0) != (5 % 6)));
+                    a1[1][15] = (((v0 - 23) + (a0[13] ? a0[0] : a1[1][3])) <= ((a1[2][3] * v2) + (8 > a0[2])));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a0[9] * v3) * (i0 + 14)) / 8);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v2 = (((v0 * a1[0][0]) != (v1 % 2)) || ((v2 || i2) <= (v2 <= v0)));
+        v1 = (((81 && 49) ? (a1[3][13] >= a1[3][15]) : (v3 <= v1)) < ((v2 / 9) + (83 ? a0[1] : v0)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                a0[7] = (((i3 >= 56) + (a0[1] <= v0)) >= ((a1[1][12] > i3) ? (a1[3][10] + v2) : (a1[1][11] % 2)));
+                v3 = (((v2 + a1[3][7]) < (14 != a0[9])) != ((v3 && 72) % 1));
+                v3 = (((v1 ? a1[2][14] : 32) && (a0[0] || 50)) || ((i2 && v0) || (v3 * a1[1][2])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        if ((v0 % 4) > 52) break;
+        v2 = (((a0[1] || v1) > (v0 * 32)) < ((a1[1][5] + 24) ? (a0[14] && a1[0][6]) : (v3 < v2)));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            if ((a1[3][1] % 3) > 91) break;
+            v3 = (((i5 + v2) + (82 != 47)) == ((a0[15] % 6) >= (22 && a0[15])));
+            v0 = (((a0[10] ? v2 : i5) && (a0[12] == a1[1][15])) <= ((a1[0][2] && a1[0][9]) < (a1[3][4] || v3)));
+            v0 = (((i5 != a0[8]) != (v0 + 20)) < ((a0[3] || v3) >= (i4 % 9)));
+        }
+        a0[3] = (((v0 <= 55) || (a0[15] + v2)) == ((v3 / 2) > (a0[9] - a1[3][14])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((v3 == v2) > 88) break;
+            a1[1][3] = (((a0[2] + 83) == (5 * a0[5])) ? ((a1[0][12] <= a0[8]) - (i6 != 97)) : ((29 || v1) && (40 ? 92 : a0[3])));
+            v2 = (((v0 * i6) < (a0[11] + v1)) <= ((80 && a1[2][0]) && (61 == i6)));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                a1[0][9] = (((i6 != v1) != (49 ? v3 : a0[13])) - ((v2 == 30) / 8));
+                a0[13] = (((a0[2] > a1[3][4]) != (a1[0][1] <= a1[1][12])) >= ((i6 / 6) ? (45 == v0) : (i7 >= v0)));
+                a0[11] = (((i7 || a0[7]) != (v2 / 3)) != ((12 && 68) == (a0[15] - a0[6])));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+                a1[1][0] = (((a0[13] * v0) + (a0[14] != 97)) >= ((i8 != a0[7]) * (i9 != v0)));
+                v0 = (((v3 - i9) || (48 <= 49)) - ((a1[1][1] ? a0[10] : v2) != (i8 + a1[1][6])));
+                v1 = (((i9 % 6) + (v3 <= v2)) != ((17 > a1[0][8]) % 2));
+            }
+            v0 = (((a1[3][2] - v2) && (v2 < 24)) - ((v0 != 78) && (86 ? v1 : v2)));
+            v0 = (((v3 <= 47) ? (19 >= 73) : (81 >= i8)) >= ((v1 != v0) % 3));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v2 <= v1) + (3 - a1[0][6])) * ((a0[7] || v2) % 5))) {
+        v0 = (((a1[3][3] ? a1[1][5] : v3) && (v1 < a0[15])) < ((26 * a1[3][3]) < (v2 < v3)));
+        v1 = (((6 * v1) == (v1 / 8)) > ((v3 >= v3) * (a0[2] % 5)));
+        a0[5] = (((a1[3][1] != 77) - (a1[2][15] > v2)) >= ((27 < v3) && (v3 && v0)));
+    } else {
+        v3 = (((v2 == v0) > (a1[1][14] ? a0[14] : v1)) <= ((v2 < a1[3][5]) % 1));
+        v0 = (((a0[8] / 3) * (v1 / 4)) != ((a0[12] <= v1) != (a0[5] == a0[8])));
+        v2 = (((v0 + 2) == (a0[11] % 5)) == ((v3 > 91) && (82 < v3)));
+    }
+    v0 = (((a0[12] > v2) >= (v3 <= v3)) >= ((v0 || v3) ? (v2 / 9) : (v0 <= v2)));
+    v1 = (((v3 > 48) > (v1 <= a0[10])) && ((v3 * a0[14]) != (v3 < a1[2][2])));
+    {
+        int i10 = 0;
+        while (i10 < 8) {
+            v0 = (((51 >= a1[3][3]) * (a1[2][3] - v1)) == ((v0 + v3) ? (a0[0] % 4) : (v3 ? a1[3][11] : a1[3][15])));
+            a1[2][9] = (((22 + a1[2][15]) == (v1 && v2)) < ((6 < v1) >= (a0[9] + v3)));
+            {
+                int i11 = 0;
+                while (i11 < 7) {
+                    a0[14] = (((a0[9] > a1[2][11]) > (v0 > i11)) + ((39 == v1) == (a0[3] - a0[7])));
+                    v0 = (((65 ? a1[3][6] : v2) + (i11 != 97)) + ((39 && a0[7]) % 7));
+                    a1[3][11] = (((v3 == v3) > (v1 % 6)) ? ((a0[1] % 6) ? (i10 == 75) : (a1[0][7] >= v0)) : ((v0 >= v3) % 1));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        }
+    }
+    return (((42 && a0[1]) > (v3 != v3)) || ((v0 && v2) >= (v3 == a1[3][13])));
+}
+int f1() {
+    int v0 = 59;
+    int v1 = 80;
+    int v2 = 89;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a1[1][15] = (((v1 == 48) < (v1 || v1)) / 1);
+        v0 = (((94 || a0[7]) >= (i0 < 27)) < ((i0 != v1) <= (v3 ? v1 : 55)));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v2 = (((i0 > v0) * (a0[12] + a0[15])) && ((v2 ? v2 : a0[12]) >= (39 % 9)));
+                v2 = (((a0[2] * i0) >= (v3 % 3)) >= ((6 == 77) <= (v0 && v2)));
+                v2 = (((i0 == 10) || (62 < a0[9])) ? ((v1 <= 71) <= (8 < i0)) : ((a0[0] == a0[2]) == (a1[2][5] % 2)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    if ((((78 % 9) % 3) % 1)) {
+        v1 = (((46 < v2) == (a1[2][8] % 6)) != ((a0[6] + 75) && (v0 / 9)));
+        v0 = (((v3 ? v1 : v2) > (v2 ? a0[1] : 19)) - ((a0[9] < 1) < (v1 + v1)));
+        v1 = (((v2 || 93) - (v1 + v2)) / 3);
+    } else {
+        v0 = (((62 == a1[3][15]) != (v0 >= a0[0])) / 2);
+        a1[3][13] = (((55 / 5) || (v0 + v3)) + ((v3 / 8) <= (a0[15] && 69)));
+        v3 = (((v0 - a0[6]) < (v0 % 8)) ? ((17 <= v2) <= (v2 > v2)) : ((a1[1][12] || v2) != (90 >= v1)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a1[0][13] = (((i2 > v2) - (99 <= i2)) && ((v2 + a1[2][7]) ? (v0 || v1) : (a0[0] || v3)));
+        a0[3] = (((i2 % 8) / 1) < ((7 >= v1) && (v1 == v2)));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                v0 = (((10 < v0) - (32 - a1[2][8])) > ((v1 ? v1 : a1[0][10]) - (v3 * 80)));
+                v3 = (((v0 + a1[0][15]) / 4) != ((a0[2] > i2) >= (v0 * v3)));
+                v2 = (((v0 == 43) / 6) * ((78 != i3) == (a1[3][3] >= v2)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    a1[0][10] = (((a0[15] / 1) / 5) * ((v0 || a1[0][12]) && (a0[13] - v2)));
+    v2 = (((v3 != 29) <= (v3 / 5)) * ((v0 ? v3 : 30) > (31 <= 30)));
+    a1[2][3] = (((v1 + v1) % 9) % 2);
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a0[13] = (((a0[3] ? v1 : a0[6]) + (74 <= 52)) < ((v1 - v0) < (v0 + i4)));
+        v2 = (((a1[2][9] / 5) % 4) % 4);
+        {
+            int i5 = 0;
+            do {
+                v1 = (((i4 - a0[9]) * (v1 + v1)) / 4);
+                v2 = (((a1[1][5] <= v1) < (v2 <= i5)) / 5);
+                v1 = (((57 == i5) || (v0 && 92)) < ((a1[1][3] == a0[9]) && (i5 ? v3 : v1)));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+    }
+    a1[3][2] = (((a0[9] % 6) < (a0[10] <= 73)) || ((v2 - a0[0]) - (v3 % 6)));
+    {
+        int i6 = 0;
+        do {
+            if ((a1[2][8] || a1[1][2]) > 62) break;
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v1 = (((v3 % 4) - (v2 || a0[10])) - ((a1[0][7] >= 99) != (v2 || a0[13])));
+                    a0[13] = (((v1 % 6) == (a1[2][15] && v2)) <= ((i6 < v3) > (a0[6] * v3)));
+                    v1 = (((66 + a0[10]) + (a0[1] / 5)) || ((a0[3] ? v3 : v0) || (a1[1][13] / 6)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((59 == i6) && (a0[11] && 8)) > ((a1[2][0] ? 29 : v1) <= (a1[0][5] / 4)));
+            v0 = (((72 || 98) != (v1 < v2)) > ((a0[14] % 6) + (v3 ? a0[3] : i6)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 5) {
+            v0 = (((3 && i8) < (a0[10] ? a0[5] : 62)) + ((63 + i8) + (v2 <= v1)));
+            a0[7] = (((19 % 2) + (2 ? a1[0][14] : i8)) ? ((v0 || a1[0][6]) * (96 ? v0 : v0)) : ((96 != v1) && (v1 && 91)));
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                v2 = (((71 ? 52 : v0) < (v3 ? i9 : a1[1][9])) % 2);
+                v3 = (((a0[13] - v2) - (i8 ? 73 : 98)) / 5);
+                v1 = (((i9 == i8) % 7) < ((i9 % 5) != (v0 <= v3)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((51 < 6) > (40 != v3)) * ((v2 ? v0 : a0[15]) < (v1 > a1[1][11])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
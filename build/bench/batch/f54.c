@@ -0,0 +1,361 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 34;
+    int v2 = 75;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v1 = (((13 ? i1 : v2) >= (a0[4] ? 29 : 77)) ? ((i1 < 63) <= (a1[2][1] % 3)) : ((i1 && v2) || (v3 >= a1[0][3])));
+                v2 = (((30 >= a1[3][14]) >= (53 > 41)) + ((i1 / 9) + (a1[1][12] - v1)));
+                v0 = (((v2 > v0) ? (v0 ? 99 : v3) : (v2 ? v1 : a1[3][2])) / 9);
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((v0 * v1) * (v0 >= a1[1][7])) - ((v0 < v1) + (a1[0][9] ? a1[2][14] : a0[14])));
+        v1 = (((i0 >= v0) && (4 >= v1)) == ((56 != v3) <= (v3 % 9)));
+    }
+    if ((((a0[6] ? a1[0][0] : 84) != (v1 / 6)) <= ((v0 < 96) || (v1 <= a1[0][9])))) {
+        v3 = (((43 * a1[0][0]) - (v3 == 22)) != ((v1 % 3) ? (v0 <= 32) : (v1 - 93)));
+        v3 = (((a1[0][11] <= v2) == (37 / 7)) >= ((a0[8] - a0[1]) > (a1[3][2] && 86)));
+        v0 = (((42 % 8) > (v0 >= v0)) && ((a0[0] < 33) || (v0 / 6)));
+    } else {
+        v3 = (((v3 < v2) % 2) < ((v2 < v2) ? (4 < a0[10]) : (63 && 20)));
+        a0[13] = (((v2 && v0) ? (95 / 2) : (v0 * v2)) > ((a0[10] / 6) * (30 != v1)));
+        v0 = (((v0 + v1) || (v3 == a0[3])) != ((v0 > a1[2][0]) || (v2 > v1)));
+    }
+    a0[11] = (((v2 * 31) % 2) != ((v2 && v1) > (v3 == v3)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v0 = (((7 != v3) - (a1[2][4] != v1)) < ((v0 * i2) ? (a1[1][5] < 45) : (i2 > v2)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v0 = (((59 / 3) % 2) ? ((v2 * 15) == (i3 * i2)) : ((v2 * 93) % 8));
+            v0 = (((a1[3][6] ? 47 : a1[3][0]) + (v3 <= v3)) / 8);
+            v3 = (((a1[1][13] || v3) / 9) ? ((46 != v2) >= (a0[7] && a1[2][0])) : ((a0[3] - v3) ? (a0[0] && a1[3][11]) : (52 / 4)));
+        }
+        a0[3] = (((a1[0][3] * 14) > (73 <= v1)) ? ((31 > v1) == (a1[1][13] < 15)) : ((i2 || 25) ? (i2 == 30) : (v0 ? i2 : a0[15])));
+    }
+    v3 = (((v3 ? a0[7] : a0[10]) % 8) * ((v1 <= v3) % 6));
+    if ((((a1[2][4] ? a0[1] : a1[2][7]) * (v1 >= v1)) * ((v1 <= v0) > (a0[10] ? a0[11] : v1)))) {
+        v2 = (((93 - v3) == (v1 + v3)) >= ((v1 < v0) != (v1 || 36)));
+        a0[4] = (((v2 >= a0[12]) <= (v2 || 22)) < ((a0[4] ? v3 : v0) >= (a1[3][3] + 53)));
+        v0 = (((48 < v3) / 6) > ((v3 && v0) * (v3 / 5)));
+    } else {
+        v2 = (((v3 || v0) < (49 + v2)) && ((v1 == v1) + (v3 && v1)));
+        a0[14] = (((v2 != a0[10]) && (v0 && v0)) == ((v2 % 4) % 2));
+        a0[12] = (((21 <= a0[8]) ? (v3 || a0[1]) : (v2 / 4)) % 2);
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v3 / 3) % 3) && ((v2 ? 5 : v0) && (55 + v0)));
+            v1 = (((85 / 1) * (i4 ? i4 : v3)) - ((v0 == v2) - (35 ? a0[3] : 91)));
+            {
+                int i5 = 0;
+                do {
+                    a1[0][12] = (((v2 % 1) % 4) > ((v2 ? 92 : a1[2][3]) - (a1[0][3] && v2)));
+                    v1 = (((v0 - i5) != (a0[1] ? 78 : 7)) % 9);
+                    v0 = (((v1 == i5) + (a1[1][14] * v3)) || ((v0 == v3) == (i5 / 7)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    if ((((v1 >= v3) % 7) % 9)) {
+        v0 = (((v3 || v0) >= (v0 ? v1 : 73)) >= ((v2 + v3) + (v1 - a0[11])));
+        a0[13] = (((51 == a1[3][1]) * (a0[12] || v2)) < ((13 == v1) + (a0[14] > 68)));
+        v2 = (((a0[2] + 91) + (v1 > v2)) * ((v0 > 34) % 3));
+    } else {
+        v0 = (((v1 / 9) < (v1 - v2)) < ((42 * a1[2][4]) / 9));
+        v3 = (((v3 > a0[5]) - (v3 > v1)) ? ((a1[2][6] * v1) + (v1 <= v1)) : ((a0[1] || a0[8]) % 7));
+        v3 = (((76 % 1) ? (4 < 45) : (v2 / 6)) / 6);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            if ((a0[12] % 2) > 59) break;
+            v1 = (((a0[12] ? a1[2][9] : v2) != (v0 / 1)) % 8);
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v2 = (((29 != 77) < (a0[13] / 7)) && ((v3 <= a1[0][9]) * (v2 ? v2 : 46)));
+                    v0 = (((a0[1] + v2) - (a0[13] && 30)) < ((v3 ? v1 : a0[5]) || (51 * v1)));
+                    v0 = (((v0 + 26) ? (v1 >= 77) : (a0[0] < a1[0][15])) / 7);
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((44 || v1) <= (v0 != v1)) <= ((v2 % 1) % 2));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((i8 * a0[10]) && (62 * 78)) <= ((a1[1][11] * 57) / 4));
+            for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+                v3 = (((32 > i9) != (v2 * v3)) ? ((96 - 28) || (15 == v2)) : ((v0 >= i9) >= (v2 / 4)));
+                v0 = (((v0 < i8) - (v2 && 67)) <= ((a1[1][10] != 81) ? (i8 <= a1[0][5]) : (39 - a1[3][6])));
+                a1[2][7] = (((v1 >= v2) / 2) % 8);
+            }
+            v2 = (((80 < a1[1][12]) > (a1[0][6] > v3)) ? ((i8 ? v0 : v0) == (v0 < 72)) : ((20 ? a1[0][6] : v2) != (v1 ? i8 : a0[2])));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    return (((v1 >= 95) - (a0[2] < v1)) ? ((69 / 3) > (18 / 9)) : ((v1 != a1[2][9]) * (a1[1][13] / 6)));
+}
+int f1() {
+    int v0 = 83;
+    int v1 = 57;
+    int v2 = 68;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[1][6] = (((v1 % 6) / 6) >= ((a0[8] < a0[14]) && (a0[5] > v2)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((a0[13] <= i1) && (12 % 7)) / 4);
+                v2 = (((v2 >= 66) && (86 != 55)) + ((49 <= v0) - (32 ? a1[0][7] : a0[11])));
+                v1 = (((65 * v1) - (15 && a0[13])) >= ((v3 > v1) != (v3 * i0)));
+            }
+            v1 = (((90 == 9) && (59 >= 77)) < ((33 ? a0[13] : i0) == (v2 >= v2)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            a1[1][7] = (((i2 && i2) ? (v2 > a1[0][15]) : (96 % 5)) == ((30 <= v3) - (a0[0] - a1[1][11])));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((81 > a1[0][12]) / 3) % 1);
+                    a1[2][0] = (((a1[1][14] <= a1[2][9]) >= (a1[3][2] || i2)) >= ((a1[0][15] && v3) <= (50 * a1[0][4])));
+                    a1[1][15] = (((v2 ? a0[8] : v0) > (96 > v1)) ? ((4 || v1) || (a1[1][4] < a1[0][8])) : ((v0 > 73) >= (i3 == v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v0 = (((v3 * v1) <= (v3 - 92)) + ((6 || v1) || (v2 <= i2)));
+            i2 = i2 + 1;
+        }
+    }
+    a0[12] = (((24 / 2) > (v0 ? a0[6] : v0)) >= ((v2 - v0) >= (65 ? v0 : v2)));
+    if ((((v0 == v1) ? (v3 ? v3 : a1[0][13]) : (64 / 1)) + ((v2 ? v3 : v0) < (v1 % 2)))) {
+        v3 = (((9 || v0) * (a0[12] < v3)) != ((v1 - 42) <= (v1 >= 23)));
+        a0[10] = (((v3 > v1) % 1) != ((a1[0][10] == a1[2][11]) * (28 == v1)));
+        a0[4] = (((a1[3][15] <= 10) < (v3 < v1)) == ((v0 && v1) + (v2 >= v1)));
+    } else {
+        v1 = (((66 >= a0[9]) == (28 - v0)) >= ((v1 ? a1[1][13] : a1[0][7]) % 7));
+        v0 = (((v2 / 8) + (a1[0][1] == 67)) <= ((v1 / 1) * (a1[1][11] && v0)));
+        a1[3][4] = (((30 < a1[3][2]) && (27 * a1[0][10])) != ((26 <= v3) * (27 / 4)));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v2 = (((a1[2][5] < a0[6]) != (a0[10] * v2)) % 5);
+        v1 = (((v1 * v0) <= (72 < v1)) % 2);
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v0 = (((v1 < v0) * (v2 && a1[1][11])) ? ((a1[3][3] >= v3) > (61 <= v1)) : ((i4 == a0[2]) >= (35 != v2)));
+                v3 = (((i4 <= v3) != (a1[2][8] > a0[0])) * ((v3 < v1) >= (a1[1][12] <= a1[0][0])));
+                v0 = (((v0 % 7) >= (v2 > v3)) && ((i4 / 2) * (a1[0][14] ? a1[0][1] : i5)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    v1 = (((v1 ? v1 : a1[2][7]) != (v1 - v2)) <= ((v2 > v2) != (a1[2][4] && v1)));
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v3 = (((v0 % 1) + (v1 > a0[7])) == ((a1[0][11] < v3) == (97 / 3)));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                a0[12] = (((20 % 2) ? (v0 && v1) : (74 > 84)) < ((v2 && 23) * (v1 + v2)));
+                v3 = (((92 || a0[1]) >= (i6 || a0[13])) * ((91 <= 76) >= (v0 > v2)));
+                a0[14] = (((9 == v3) >= (92 && i6)) && ((21 - v0) && (a0[7] ? i7 : 83)));
+            }
+            v2 = (((60 ? 84 : i6) || (a0[3] < a0[3])) % 8);
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v3 = (((6 < 0) && (v1 || v1)) >= ((a0[3] == a0[14]) % 4));
+            a1[1][3] = (((27 + 90) <= (v0 <= a0[0])) % 8);
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    v1 = (((83 != 33) - (v1 - 12)) == ((v1 + v3) != (v0 <= v2)));
+                    v1 = (((v2 % 1) - (v0 < i8)) <= ((88 == i9) >= (41 != v2)));
+                    a0[3] = (((v1 * 29) <= (78 == a1[2][3])) > ((i8 != 44) < (57 == 11)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    a0[11] = (((a1[3][1] != v2) && (v2 || 95)) - ((v2 ? v1 : v1) ? (v3 ? v1 : a1[2][11]) : (v1 > v1)));
+    {
+        int i10 = 0;
+        do {
+            v1 = (((v0 % 9) == (33 == v3)) && ((35 % 8) > (v1 + v2)));
+            a1[3][4] = (((28 && 86) >= (v3 + v0)) == ((v0 * v0) || (20 ? v1 : a0[11])));
+            {
+                int i11 = 0;
+                while (i11 < 6) {
+                    v3 = (((19 ? v1 : v2) < (i10 <= i10)) == ((v0 - v1) >= (96 / 3)));
+                    v2 = (((v2 < a1[0][13]) ? (v3 >= v0) : (27 + i11)) ? ((v0 > i10) ? (v3 - i10) : (82 % 3)) : ((19 || 45) <= (v0 + v2)));
+                    v3 = (((i10 == a0[13]) + (79 * i11)) <= ((v0 != v3) + (v2 == a0[7])));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    return (((56 % 8) || (a0[5] * v0)) % 1);
+}
+int f2() {
+    int v0 = 47;
+    int v1 = 1;
+    int v2 = 73;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v3 = (((v3 ? i0 : 21) || (a1[0][5] > 18)) && ((i1 <= v2) * (51 < v2)));
+                v2 = (((74 + 9) <= (77 == i0)) <= ((38 % 4) != (6 < v2)));
+                v2 = (((a1[3][8] >= v2) ? (i0 / 9) : (i1 || a1[2][5])) + ((a1[2][7] + 70) / 6));
+            }
+            a1[0][0] = (((v0 <= 53) < (40 ? v0 : 74)) && ((8 != 82) <= (a1[0][10] != v2)));
+            a0[12] = (((v0 / 7) >= (38 - a1[0][14])) + ((v3 < a1[0][13]) ? (v2 > 82) : (66 >= a1[1][8])));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((a1[2][7] % 1) && (v1 % 7)) ? ((a0[10] < v1) * (94 ? 36 : i2)) : ((22 ? i2 : v0) > (v0 ? 0 : a0[15])));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v0 = (((i2 / 9) / 5) >= ((v2 + a1[3][12]) / 6));
+            v1 = (((i3 - a1[2][11]) == (v2 / 3)) / 9);
+            v3 = (((v3 % 3) || (52 - a0[15])) < ((i2 - v3) <= (i2 != i2)));
+        }
+        v3 = (((v2 + 47) / 9) || ((85 > a0[15]) < (v1 / 6)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((85 + v1) + (i4 > v3)) > ((a1[3][7] >= 63) || (47 < a0[1])));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((a1[3][14] || a0[4]) - (i4 * v2)) == ((v1 <= 29) ? (33 * a1[0][14]) : (v0 != a0[10])));
+                    v2 = (((a1[3][8] > v0) == (v3 < a1[1][1])) + ((6 == 16) ? (v3 <= a0[15]) : (v0 > 46)));
+                    v1 = (((i5 / 6) + (a0[12] % 2)) + ((i5 * 24) && (a0[11] < v1)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a1[0][10] = (((v1 < a1[1][11]) - (v2 < v3)) > ((v3 >= v2) ? (a0[12] ? v1 : a0[3]) : (v3 - 88)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    a0[15] = (((v2 != 52) && (a1[3][13] ? 70 : v0)) >= ((a0[1] > 91) ? (i7 && a0[11]) : (27 > v3)));
+                    v2 = (((a0[14] && v0) >= (v2 > a1[0][6])) < ((a1[0][12] && v1) + (i6 > 17)));
+                    a0[2] = (((39 && v3) == (a0[8] == v1)) && ((60 == v1) != (a0[14] * v0)));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((a1[0][14] * 34) ? (v2 * 48) : (62 != v1)) ? ((v1 || v3) < (v0 % 3)) : ((a0[0] != i6) == (a0[15] + a1[3][5])));
+            v1 = (((v2 * 85) < (a1[1][8] < v0)) ? ((v3 + 86) * (31 / 3)) : ((a0[2] / 2) || (v0 <= 7)));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        if ((v0 < 69) > 52) break;
+        v0 = (((i8 != v0) % 3) + ((v0 || a1[1][15]) || (v3 / 2)));
+        v2 = (((a1[3][1] <= 92) && (98 - 54)) - ((a1[3][6] - v2) && (v2 > a0[0])));
+        {
+            int i9 = 0;
+            do {
+                if ((v0 ? i8 : 97) > 79) break;
+                v3 = (((90 ? i9 : v2) * (0 ? v3 : v1)) - ((v1 == 69) != (v2 <= a0[8])));
+                v2 = (((43 || 48) ? (a1[1][14] || v1) : (a1[3][9] || a0[3])) + ((a0[5] <= v3) < (v0 != a0[11])));
+                a1[3][2] = (((i8 / 9) ? (a1[0][1] / 5) : (v3 < i8)) / 2);
+                i9 = i9 + 1;
+            } while (i9 < 7);
+        }
+    }
+    if ((((a1[1][0] || v3) != (v2 + v0)) != ((a0[0] < v1) + (v1 != 79)))) {
+        v2 = (((v1 - a1[0][3]) > (a0[15] ? a1[2][12] : a1[3][6])) * ((v0 >= v0) + (a1[3][4] != 5)));
+        v2 = (((a0[1] == a1[1][4]) != (v3 <= v3)) >= ((a1[0][9] + v0) - (v1 && a1[2][2])));
+        v3 = (((v0 > v2) != (v3 - v0)) >= ((v1 / 7) <= (v3 ? v1 : a1[1][5])));
+    } else {
+        a0[14] = (((86 || v3) == (72 + 11)) || ((48 * a0[3]) ? (v2 + v1) : (a0[13] - a0[8])));
+        v2 = (((a0[1] / 7) < (v0 ? a0[0] : v3)) && ((v3 >= v2) ? (v3 <= v3) : (v0 < v0)));
+        v1 = (((v2 != a0[4]) * (v2 ? v2 : a1[1][13])) > ((v0 / 6) - (v3 || a0[7])));
+    }
+    v3 = (((v3 > v0) < (a0[9] ? v1 : a0[15])) != ((v3 / 2) && (24 - 73)));
+    {
+        int i10 = 0;
+        do {
+            a0[13] = (((74 ? i10 : a0[0]) >= (a1[2][1] >= v0)) >= ((i10 || a1[0][6]) - (i10 <= a1[3][13])));
+            v2 = (((a1[2][4] > 18) != (v1 >= a1[0][7])) || ((52 == a1[1][12]) >= (i10 || v0)));
+            for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+                if ((a0[2] - v0) > 67) break;
+                a1[0][2] = (((v0 >= v3) / 3) == ((a0[13] > a1[2][8]) - (i10 != v2)));
+                v1 = (((v2 || a0[6]) > (v3 && 97)) + ((a1[3][9] - 93) <= (v2 > v3)));
+                v1 = (((a0[10] <= a0[15]) > (v2 - 95)) > ((a0[7] + 34) ? (a1[3][2] * a0[13]) : (a1[0][7] || 15)));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 8);
+    }
+    {
+        int i12 = 0;
+        while (i12 < 7) {
+            v3 = (((66 >= a0[8]) <= (v3 * v3)) / 2);
+            v3 = (((v2 >= 95) - (a1[3][9] <= i12)) || ((i12 * v1) / 9));
+            {
+                int i13 = 0;
+                do {
+                    a0[14] = (((v1 >= v2) && (v0 || a1[3][7])) < ((v1 ? a0[0] : 78) < (v0 % 2)));
+                    a0[12] = (((a1[2][12] && v2) >= (i12 < a1[3][4])) < ((98 && v0) <= (v2 ? a0[12] : i12)));
+                    v0 = (((v2 - v3) + (v1 % 9)) >= ((68 == v1) < (v1 || a0[9])));
+                    i13 = i13 + 1;
+                } while (i13 < 4);
+            }
+            i12 = i12 + 1;
+        }
+    }
+    {
+        int i14 = 0;
+        while (i14 < 2) {
+            a0[8] = (((v3 / 9) % 1) ? ((v1 < v0) && (46 ? v2 : v2)) : ((a1[1][5] <= v3) % 9));
+            for (int i15 = 0; i15 < 7; i15 = i15 + 1) {
+                if ((a0[4] != 17) > 92) break;
+                a1[3][6] = (((i15 + 51) ? (v0 && 3) : (v1 + v3)) ? ((90 > i14) != (v2 ? 47 : v0)) : ((v1 <= i15) == (8 <= i14)));
+                a0[11] = (((v2 + a0[5]) && (95 / 3)) ? ((a1[1][9] >= v0) - (92 ? 8 : i15)) : ((i14 > i15) - (v0 * a1[0][7])));
+                a1[2][7] = (((v2 >= a1[2][9]) + (a1[3][3] <= v2)) / 8);
+            }
+            v1 = (((v1 >= v0) % 4) != ((v3 && 91) >= (v1 / 6)));
+            i14 = i14 + 1;
+        }
+    }
+    return (((15 && a0[3]) / 4) && ((a1[1][1] != a0[10]) + (a1[2][6] < v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,473 @@
+int f0() {
+    int v0 = 29;
+    int v1 = 32;
+    int v2 = 67;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][6] && a0[7]) <= (92 >= v3)) || ((33 ? a0[15] : a0[1]) == (v0 > v1)))) {
+        a1[2][0] = (((73 - v2) > (50 ? a0[14] : v0)) != ((v3 != 20) ? (a0[13] / 3) : (a1[1][13] - v2)));
+        a1[0][6] = (((v1 * v2) / 2) ? ((v2 && v0) / 1) : ((v1 ? v0 : 48) / 8));
+        v3 = (((v0 ? v0 : v0) && (v0 < 90)) == ((a0[6] - v0) % 6));
+    } else {
+        v1 = (((v2 - v1) > (v0 ? a1[3][8] : v0)) >= ((v3 * v1) + (v3 - a1[1][15])));
+        a0[14] = (((v1 != v3) != (76 > 37)) * ((a1[2][7] * a0[6]) - (v1 != v1)));
+        a1[1][15] = (((v2 < a0[8]) ? (v3 ? v0 : a0[13]) : (v3 != 44)) == ((52 || v1) || (v2 >= a1[0][2])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v2 = (((a0[3] ? v2 : 95) || (94 ? v3 : 85)) <= ((51 <= a1[1][12]) || (v1 <= 64)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    if ((a1[1][6] == a0[14]) > 95) break;
+                    v0 = (((i1 ? a1[1][10] : a0[12]) < (v1 > i1)) || ((i1 == 11) > (a0[5] >= v2)));
+                    v1 = (((v1 != v0) >= (i0 + i1)) % 3);
+                    a1[1][15] = (((a0[10] <= v0) ? (28 * v0) : (a0[0] != v1)) == ((v2 != v0) && (44 < v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][3] = (((70 + i0) <= (v1 && v1)) % 1);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v2 = (((i2 && a1[1][8]) / 9) || ((v2 > 47) / 6));
+        v0 = (((81 + v3) == (a0[9] / 8)) ? ((10 < a1[1][3]) ? (67 ? a1[0][7] : v1) : (v0 % 1)) : ((a1[0][5] != a1[0][10]) != (v1 ? a0[7] : 6)));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                a1[1][4] = (((a1[1][7] ? 54 : i3) <= (v1 < i3)) ? ((v3 / 3) || (v0 > a1[2][8])) : ((i2 <= v1) - (v2 && i2)));
+                v3 = (((a0[2] <= 80) == (i3 > a0[2])) / 9);
+                a0[1] = (((v1 >= a1[0][7]) || (v2 == 50)) > ((a1[2][0] / 9) / 9));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((v1 <= 25) || (v1 < 77)) ? ((v0 ? a1[2][14] : v0) / 2) : ((v2 && v2) / 9))) {
+        a0[0] = (((47 != v2) || (17 ? a0[5] : v3)) > ((v0 * 10) % 8));
+        a1[3][8] = (((a0[2] || v0) >= (59 + v0)) ? ((43 || v2) % 7) : ((v2 || v1) * (a0[10] - 47)));
+        v3 = (((94 || a0[1]) && (v3 >= 19)) ? ((52 + a0[4]) - (53 ? v2 : 44)) : ((v2 >= v3) != (v1 * a0[8])));
+    } else {
+        v3 = (((v0 == 5) < (44 % 1)) && ((v1 - 58) % 6));
+        v3 = (((a0[3] || 18) <= (v3 + a1[2][12])) == ((6 > 37) || (v1 != v3)));
+        v2 = (((v3 ? v3 : 92) % 6) || ((v0 / 2) && (a1[2][8] / 3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[6] = (((i4 ? v2 : 17) * (a0[1] + 52)) && ((v1 >= v1) % 8));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                if ((i5 == 82) > 63) break;
+                a1[3][2] = (((v2 || 50) % 8) * ((a1[0][9] != v2) > (21 == v3)));
+                v2 = (((a1[3][6] && i4) < (a0[7] - i4)) == ((96 && a1[3][10]) < (v3 == 10)));
+                v0 = (((v1 > a0[10]) <= (a1[1][15] < 4)) > ((a0[14] % 3) ? (v1 == a1[2][12]) : (i4 && 94)));
+            }
+            v1 = (((83 % 8) && (v2 - 95)) == ((a0[7] < a1[2][2]) < (v2 && v1)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            while (i7 < 8) {
+                a0[15] = (((73 - 52) || (v3 == 50)) <= ((v3 + v1) % 3));
+                v0 = (((i7 * i6) ? (a0[7] != 42) : (13 <= i7)) && ((v1 != a1[0][5]) > (a0[13] < a1[0][15])));
+                a0[9] = (((42 >= v0) < (22 + i7)) && ((v2 + v3) ? (36 + v2) : (v1 ? a1[1][10] : v3)));
+                i7 = i7 + 1;
+            }
+        }
+        v2 = (((v2 % 8) - (v3 || v1)) != ((98 % 7) / 2));
+        v1 = (((v0 / 8) + (v3 >= i6)) ? ((v3 >= a1[3][10]) / 8) : ((v3 ? v0 : v3) > (v1 ? 14 : a1[1][1])));
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        v1 = (((v1 != 29) > (11 < a0[3])) ? ((v3 > 66) && (v2 % 5)) : ((a0[9] != 65) ? (a1[0][4] ? 11 : a0[2]) : (v2 != v0)));
+        a1[2][9] = (((a1[3][8] == v3) ? (v2 ? v0 : a0[15]) : (a1[1][10] == v0)) / 4);
+        for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+            a1[2][6] = (((67 ? v1 : 86) || (i8 ? i8 : i8)) / 4);
+            v0 = (((92 <= a0[0]) != (56 % 9)) / 8);
+            a0[10] = (((v2 % 7) + (v1 >= 41)) > ((v0 + v0) > (2 + a1[2][0])));
+        }
+    }
+    a0[14] = (((v2 * a1[0][0]) * (55 >= a0[15])) || ((a1[2][8] ? 33 : a0[7]) ? (77 * v3) : (a0[1] % 7)));
+    a1[0][7] = (((v0 - 92) > (v1 + 50)) <= ((v2 > a0[7]) + (v2 * a1[2][12])));
+    for (int i10 = 0; i10 < 8; i10 = i10 + 1) {
+        for (int i11 = 0; i11 < 5; i11 = i11 + 1) {
+            a1[3][8] = (((i10 <= v0) - (50 >= 35)) - ((v3 - a0[10]) - (a1[0][8] || i11)));
+            v1 = (((54 == 29) - (v1 - 56)) < ((81 <= 75) < (61 > v3)));
+            a0[9] = (((a1[0][10] / 6) == (v0 || v1)) / 8);
+        }
+        a0[9] = (((a0[7] - a0[8]) == (v3 < v3)) && ((31 ? i10 : i10) >= (75 == a1[1][14])));
+        v1 = (((i10 <= a0[6]) / 6) > ((v0 / 9) + (a0[1] || v0)));
+    }
+    return (((v2 >= v1) / 3) + ((52 <= a1[3][0]) > (a0[14] * v3)));
+}
+int f1() {
+    int v0 = 8;
+    int v1 = 18;
+    int v2 = 63;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v2 = (((67 && a1[2][8]) / 5) ? ((v2 || a1[3][7]) >= (34 == a0[4])) : ((a0[13] + v3) >= (v3 * v0)));
+                v0 = (((a0[7] / 7) ? (a0[6] + v0) : (5 == a1[3][14])) ? ((a0[3] ? i0 : a0[0]) <= (25 + 48)) : ((v2 || a0[11]) / 3));
+                v3 = (((a1[1][0] % 4) == (a1[0][1] * 54)) / 6);
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((51 >= i0) == (57 && a1[1][4])) || ((a0[0] != a1[0][0]) && (a1[1][14] + a1[1][1])));
+        v3 = (((v0 <= v2) % 8) == ((i0 != a1[0][6]) - (v0 == a1[2][8])));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((i2 ? v1 : 98) && (v2 % 9)) && ((a1[3][0] + v1) < (v1 || v2)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                a0[6] = (((v2 != v0) / 8) * ((a1[2][0] * 46) * (a0[6] > a0[11])));
+                v1 = (((v3 * v3) || (a0[13] ? 75 : a0[1])) == ((i3 + 33) && (69 == 25)));
+                a0[5] = (((a0[4] == i2) == (v2 || 95)) + ((69 ? a1[0][14] : v2) * (a0[3] + i2)));
+            }
+            v3 = (((a0[10] - a0[13]) + (6 / 1)) >= ((12 != a0[6]) - (6 <= v3)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((83 ? v2 : 30) > 65) break;
+            a1[3][0] = (((3 ? 42 : a1[0][13]) / 2) > ((v2 > v0) ? (v2 || v1) : (a0[7] >= v1)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    a0[15] = (((v0 * v1) ? (v3 % 8) : (v1 < a1[2][3])) - ((42 == v1) % 1));
+                    v1 = (((a1[2][7] ? a1[1][3] : i5) % 5) % 8);
+                    a1[1][3] = (((i5 ? 53 : 20) < (i5 % 3)) < ((v1 ? 23 : a0[8]) == (87 - 21)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((a1[1][1] && v2) * (26 >= 54)) > ((v0 || i4) % 2));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            a1[2][1] = (((a0[10] + 19) ? (a0[11] < v0) : (v0 <= 91)) + ((v3 || 42) < (i6 + v3)));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v2 = (((v3 - v2) < (v2 / 8)) + ((6 + 35) % 8));
+                v0 = (((v2 < v2) - (i6 && a0[15])) && ((i6 ? v3 : i7) + (i7 || a1[3][9])));
+                v0 = (((i6 / 7) - (a1[1][1] && v2)) != ((v2 + i6) * (71 * a0[5])));
+            }
+            v0 = (((a1[2][14] > 45) != (v0 / 6)) == ((a1[3][6] ? i6 : v0) != (a0[15] % 2)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        if ((89 == a0[9]) > 56) break;
+        a0[8] = (((v3 * v2) / 2) < ((1 / 1) <= (66 + v2)));
+        v2 = (((v0 == v1) - (v3 + a0[1])) ? ((a1[1][15] && a1[3][3]) / 4) : ((v1 <= v1) % 2));
+        for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+            v3 = (((i8 - a0[14]) < (a0[14] == v2)) + ((a0[0] >= v0) > (i8 > i9)));
+            a0[1] = (((65 && v2) <= (i8 < v3)) ? ((95 || v3) > (v2 + 18)) : ((a0[11] / 8) <= (v1 ? a1[2][8] : 92)));
+            a0[6] = (((v0 * 7) - (98 < v0)) != ((v1 > v1) <= (v3 / 6)));
+        }
+    }
+    v3 = (((a1[0][10] <= 63) / 6) < ((v3 ? 56 : v3) >= (10 * v1)));
+    {
+        int i10 = 0;
+        do {
+            v0 = (((79 == 85) <= (a0[15] - a1[0][5])) * ((a1[3][11] && 8) <= (a1[0][14] == a1[0][10])));
+            a1[2][8] = (((a1[0][10] - v3) % 3) + ((a0[1] / 9) / 4));
+            {
+                int i11 = 0;
+                while (i11 < 3) {
+                    if ((a0[9] / 3) > 64) break;
+                    v2 = (((v0 > i10) <= (i11 - v0)) / 2);
+                    a0[15] = (((v2 + i10) && (a1[3][3] == a1[3][2])) + ((v2 - 53) ? (a1[1][14] ? a0[4] : i10) : (66 >= v2)));
+                    v3 = (((v3 <= v2) + (v3 * a0[6])) < ((v2 && v1) && (0 == i11)));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    {
+        int i12 = 0;
+        while (i12 < 8) {
+            v3 = (((i12 ? 83 : a1[0][10]) % 9) != ((67 < v3) || (v3 && 76)));
+            v2 = (((a1[2][13] - v2) ? (a0[10] % 4) : (a0[0] < v3)) == ((94 != v0) > (i12 ? a1[0][11] : v3)));
+            {
+                int i13 = 0;
+                do {
+                    a0[5] = (((v3 + v0) - (v1 < 41)) / 9);
+                    v3 = (((a1[1][4] * v0) ? (i12 >= v0) : (i13 * 23)) * ((a1[3][13] != v1) + (26 != a1[1][3])));
+                    v2 = (((54 < a0[2]) % 8) || ((a1[2][13] > a1[2][12]) && (v0 - i12)));
+                    i13 = i13 + 1;
+                } while (i13 < 6);
+            }
+            i12 = i12 + 1;
+        }
+    }
+    for (int i14 = 0; i14 < 6; i14 = i14 + 1) {
+        v3 = (((58 % 8) ? (v1 != v2) : (90 && 28)) % 4);
+        v1 = (((a1[3][11] * 72) ? (a0[10] - v0) : (v3 && v0)) <= ((a1[0][7] || v3) - (70 >= a1[2][14])));
+        {
+            int i15 = 0;
+            while (i15 < 6) {
+                v1 = (((i15 <= a0[4]) >= (i15 >= a1[3][10])) == ((i14 * i14) || (i14 <= a1[1][5])));
+                v0 = (((a0[10] < a1[1][2]) - (67 == v0)) != ((i14 * i15) ? (v1 % 4) : (v1 < v3)));
+                v1 = (((v0 ? a0[12] : i15) <= (a0[6] / 8)) ? ((v0 > v0) % 7) : ((80 && 3) * (a0[9] || 3)));
+                i15 = i15 + 1;
+            }
+        }
+    }
+    for (int i16 = 0; i16 < 5; i16 = i16 + 1) {
+        v1 = (((v3 > v3) || (v0 % 3)) ? ((a0[7] % 6) <= (v1 != v1)) : ((i16 ? 96 : 97) % 2));
+        v0 = (((44 && a1[3][14]) && (24 ? a0[3] : a0[4])) - ((a0[13] < a0[7]) - (v3 / 4)));
+        {
+            int i17 = 0;
+            do {
+                v2 = (((i17 ? i16 : 88) < (i16 >= a1[0][15])) >= ((i17 ? v2 : i17) >= (84 - 57)));
+                v1 = (((a0[10] * i16) > (18 && i16)) - ((i16 >= a1[2][13]) != (v3 ? v3 : v2)));
+                v3 = (((i16 ? i16 : 38) >= (a1[2][15] != a0[2])) % 3);
+                i17 = i17 + 1;
+            } while (i17 < 4);
+        }
+    }
+    return (((v2 >= v1) == (v1 == v2)) ? ((a0[7] - a1[0][7]) < (v0 + a1[0][9])) : ((a1[0][8] * 74) ? (53 % 1) : (v2 ? 61 : 20)));
+}
+int f2() {
+    int v0 = 95;
+    int v1 = 33;
+    int v2 = 42;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v2 / 3) <= (v1 < v2)) ? ((v3 == v0) <= (a1[2][4] > 70)) : ((v1 > v0) && (a0[11] || v2)));
+    {
+        int i0 = 0;
+        do {
+            if ((a1[1][5] + 77) > 56) break;
+            v2 = (((v2 == v3) + (97 == 35)) < ((v3 <= 74) / 8));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v0 >= v2) / 6) != ((v3 ? 92 : 72) ? (17 && v1) : (v1 < a1[2][9])));
+                    a1[2][13] = (((19 < i0) <= (a0[4] ? 16 : a0[10])) < ((98 == 98) || (v0 % 2)));
+                    v2 = (((a0[11] <= v1) == (i1 > 63)) ? ((2 && 20) ? (v2 < 5) : (95 >= i0)) : ((i1 > 61) + (v3 != v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v1 = (((a0[9] ? 98 : 53) / 8) || ((11 < 88) ? (v2 * v3) : (v2 - 12)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((i2 * 31) > 91) break;
+        {
+            int i3 = 0;
+            do {
+                if ((i2 ? 17 : a0[13]) > 68) break;
+                a0[0] = (((v0 != a1[3][5]) * (a1[0][5] != i3)) + ((v0 < v0) < (i3 % 3)));
+                a0[15] = (((v0 % 3) <= (i3 + i3)) * ((v0 >= 66) && (a1[2][1] <= v0)));
+                v1 = (((i2 * i2) || (66 || i3)) * ((i3 && a1[3][13]) ? (68 < a0[8]) : (v0 % 7)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        v2 = (((30 ? v1 : a0[2]) == (a1[3][15] ? a0[9] : v2)) + ((89 + v1) != (i2 < v2)));
+        v3 = (((v2 == 67) ? (i2 - i2) : (v0 ? v3 : v3)) > ((19 <= i2) * (v0 != 65)));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((v3 ? v3 : i4) > 56) break;
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                if ((v1 < v0) > 78) break;
+                v3 = (((a1[0][7] > a0[7]) > (v2 ? a0[3] : 25)) < ((v2 < a0[3]) ? (a0[5] ? v0 : v1) : (i4 == i5)));
+                v0 = (((40 ? v3 : a0[15]) / 6) == ((i5 || v3) != (v0 - v1)));
+                a1[1][3] = (((6 == i5) > (a1[1][7] / 8)) + ((v3 ? v0 : a1[1][3]) || (a0[8] - 85)));
+                i5 = i5 + 1;
+            }
+        }
+        v0 = (((93 >= v1) * (v3 ? 46 : a0[8])) * ((i4 > v1) < (15 && 71)));
+        a1[0][7] = (((v2 - v0) > (25 % 3)) || ((36 / 9) / 3));
+    }
+    if ((((a1[1][11] >= v2) < (v3 < 22)) > ((39 && 4) ? (53 < v3) : (v1 * a0[7])))) {
+        a0[1] = (((v0 >= 91) ? (v2 ? v1 : a0[15]) : (v3 - v1)) / 8);
+        a0[4] = (((v2 - v0) > (3 ? 22 : a0[6])) || ((v1 >= 97) ? (a1[2][12] / 7) : (v0 || v0)));
+        a0[15] = (((v0 < v0) >= (v3 && a1[3][7])) <= ((a1[2][10] < a0[9]) == (v0 == 95)));
+    } else {
+        v2 = (((a0[14] * v1) % 4) % 1);
+        v3 = (((90 >= a1[0][1]) < (v2 ? 23 : a0[13])) <= ((v0 != v2) >= (v2 != 33)));
+        v3 = (((v3 + a1[3][0]) + (v2 % 7)) ? ((1 >= v3) == (15 / 2)) : ((a1[3][2] == 41) > (v3 <= v2)));
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((i6 != v3) && (57 <= i6)) || ((a1[0][8] > v2) - (v1 != v2)));
+                    v2 = (((a0[14] ? v1 : v3) + (95 > a1[0][9])) <= ((v3 && i7) > (43 ? i6 : 21)));
+                    v0 = (((45 / 6) != (33 % 1)) > ((i6 - i7) / 5));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            v2 = (((v3 < 33) <= (a1[0][6] > v0)) <= ((a1[3][4] && a0[5]) ? (v0 < v2) : (v1 || a1[1][5])));
+            a1[3][7] = (((v1 >= 38) * (55 == 52)) + ((v1 + v0) > (v1 % 8)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            if ((v1 - a1[3][8]) > 81) break;
+            v2 = (((3 >= a1[0][5]) < (a1[3][14] + a0[1])) > ((v2 != 97) - (4 % 3)));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                a0[12] = (((45 % 5) ? (42 > v1) : (v2 / 4)) > ((v1 / 2) >= (15 < a0[9])));
+                a1[0][5] = (((i8 <= v2) - (a1[0][4] ? a0[5] : i9)) ? ((v3 && i9) != (v1 && v0)) : ((v2 || a0[4]) >= (55 != v3)));
+                a1[2][2] = (((v2 && 9) ? (66 >= i9) : (a0[10] + v0)) >= ((95 == i9) % 8));
+            }
+            v0 = (((65 && v3) >= (v3 || 24)) - ((11 ? v2 : 22) ? (v2 <= v3) : (v2 - i8)));
+            i8 = i8 + 1;
+        }
+    }
+    v0 = (((a1[1][15] % 8) * (v3 ? v2 : v3)) && ((a1[2][5] <= a1[2][6]) ? (v2 % 1) : (v2 < v3)));
+    if ((((v3 || v0) / 2) || ((v2 == v0) * (v1 == 43)))) {
+        v1 = (((v1 || a1[0][15]) != (42 + 22)) >= ((v1 ? 56 : v2) >= (a0[4] && v1)));
+        v0 = (((a0[15] ? 6 : a0[2]) - (a1[1][9] ? v2 : 46)) + ((v3 < v0) == (v2 - a1[0][15])));
+        v2 = (((a0[0] ? v2 : 66) >= (a0[7] * v1)) / 9);
+    } else {
+        v3 = (((v2 || v2) || (63 + 23)) <= ((v2 && 6) <= (1 <= 4)));
+        v1 = (((v2 && v1) && (v3 < v2)) % 8);
+        v2 = (((87 >= v2) && (v1 > v0)) != ((a0[0] % 9) >= (v3 + a0[15])));
+    }
+    v0 = (((v1 ? v0 : 20) * (58 ? a0[4] : 28)) > ((v1 != v3) / 6));
+    return (((v0 || v3) ? (v2 == v3) : (v3 % 9)) / 6);
+}
+int f3() {
+    int v0 = 21;
+    int v1 = 64;
+    int v2 = 61;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((35 * a0[1]) ? (v2 <= a0[3]) : (99 || 51)) ? ((v2 <= v1) || (a0[8] ? 11 : v3)) : ((a1[0][9] || 10) <= (14 > a1[0][8])));
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((v3 && 65) / 9) == ((v3 == 37) * (v3 >= v3)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v2 = (((v2 || a0[13]) + (a0[1] <= v2)) % 9);
+                    a1[2][10] = (((a0[1] != v3) ? (v3 ? v1 : v3) : (v1 * 84)) ? ((81 != i0) * (v0 ? 31 : a1[3][3])) : ((v2 != a0[3]) / 7));
+                    a0[8] = (((a1[3][12] % 8) % 5) ? ((v2 + v2) || (v1 * v3)) : ((v1 || a1[1][14]) * (49 != 47)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a1[3][7] != v0) >= (a1[0][13] < 1)) ? ((v3 - a1[0][6]) >= (i0 && v2)) : ((i0 > v0) > (60 < v3)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((i2 > 16) > 51) break;
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v2 = (((40 * v3) < (v3 / 1)) || ((v1 + a1[3][10]) * (99 >= i3)));
+            a0[11] = (((a0[11] > i3) ? (65 != a1[0][6]) : (v0 == v2)) < ((a1[3][9] < i2) * (v2 + a1[3][15])));
+            v3 = (((i2 != a1[0][13]) * (a0[7] == 6)) + ((41 % 8) * (v3 < i3)));
+        }
+        v1 = (((a0[2] <= 17) ? (v3 - v2) : (39 % 8)) + ((i2 == 14) > (5 / 7)));
+        a0[12] = (((v1 >= i2) ? (i2 == a1[0][0]) : (a0[6] + 93)) && ((a1[1][0] < 60) < (v2 ? 59 : a0[0])));
+    }
+    v2 = (((10 > a0[14]) ? (a1[1][12] >= a0[0]) : (a1[3][13] * v1)) - ((v2 / 5) + (39 % 6)));
+    if ((((v2 == v1) >= (v2 ? a0[6] : 8)) * ((v2 % 2) == (v1 <= 15)))) {
+        v0 = (((4 + v1) == (37 ? 48 : v1)) % 8);
+        v0 = (((v1 == a1[2][3]) + (v0 && 19)) + ((v0 < a1[1][11]) == (a0[15] != 54)));
+        a0[7] = (((v2 < v3) > (v2 < 35)) / 6);
+    } else {
+        a1[2][10] = (((59 >= a1[2][11]) + (v3 && a1[2][13])) < ((v3 / 4) + (v1 == a1[1][2])));
+        a1[0][8] = (((v2 == 36) ? (v3 ? 70 : a1[1][1]) : (v1 / 4)) < ((v1 <= 40) > (a1[3][13] || a1[3][7])));
+        v0 = (((v1 % 3) || (v3 - 49)) % 8);
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        a1[0][8] = (((v0 < 30) || (a0[15] < v0)) * ((v2 == v3) >= (a0[13] - a0[1])));
+        v0 = (((v3 - 21) / 3) != ((v3 >= v2) ? (76 - a0[13]) : (i4 ? v0 : v0)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((v0 && i4) - (i4 - v2)) != ((v3 != a0[4]) / 7));
+                a0[15] = (((a0[2] + a0[3]) < (i4 % 4)) > ((a1[1][9] >= 30) ? (a0[0] * 11) : (13 ? i5 : a1[2][3])));
+                v2 = (((a1[3][8] * v0) ? (v0 < 49) : (a1[1][6] == v0)) % 2);
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v1 = (((a1[3][9] + i6) <= (11 % 5)) ? ((i6 || a1[1][13]) / 7) : ((v1 % 4) < (a0[8] <= v3)));
+                    a0[9] = (((37 - 92) <= (v0 ? a1[3][4] : v0)) || ((i7 && v3) + (v3 % 5)));
+                    v1 = (((i6 >= a0[15]) + (49 + 40)) || ((i6 / 4) / 6));
+                    i7 = i7 + 1;
+                }
+            }
+            a0[6] = (((v3 > a0[12]) == (v1 - i6)) + ((39 < 14) * (v1 < 67)));
+            a1[1][3] = (((a1[3][6] ? v0 : v2) ? (83 ? a1[3][4] : 53) : (v1 % 7)) * ((a1[0][3] == 70) / 2));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    if ((((a0[7] ? v3 : v1) || (v0 / 1)) + ((v2 - 1) / 4))) {
+        v2 = (((v2 * v1) >= (v1 < v1)) || ((a1[0][1] || v3) % 9));
+        v0 = (((37 >= v1) % 5) != ((89 == 39) % 4));
+        a0[6] = (((a0[6] % 4) + (v2 ? a1[1][9] : v2)) < ((a1[3][13] - a1[3][12]) > (v2 && v2)));
+    } else {
+        v3 = (((v2 ? v0 : v1) != (3 / 8)) > ((v3 + a1[1][7]) + (v3 < v2)));
+        v0 = (((v0 / 7) + (a1[0][0] < v2)) >= ((v2 ? a0[15] : v0) ? (v2 && a0[9]) : (v0 / 8)));
+        a1[1][11] = (((a1[1][7] % 8) && (v1 && 32)) < ((84 > 72) % 1));
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        v1 = (((v0 != 76) >= (v0 || a0[10])) <= ((v1 || v0) % 8));
+        {
+            int i9 = 0;
+            do {
+                a0[0] = (((36 - v3) >= (v0 < v0)) || ((89 > a0[2]) % 3));
+                v1 = (((v3 * 13) % 9) ? ((i8 || 98) ? (20 > a1[3][3]) : (80 + a0[1])) : ((33 > 19) > (11 % 9)));
+                v0 = (((v0 < v3) > (a0[3] % 5)) > ((a0[13] % 8) / 8));
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+        v0 = (((v3 > v0) || (22 * i8)) != ((v3 ? 11 : a0[9]) + (a1[3][4] % 2)));
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((a0[1] != a1[1][4]) > 86) break;
+            for (int i11 = 0; i11 < 2; i11 = i11 + 1) {
+                a1[0][9] = (((i11 / 5) - (a0[15] && v2)) <= ((a0[11] == 3) != (v1 / 6)));
+                v0 = (((62 < 57) - (38 <= v2)) % 8);
+                v3 = (((a0[3] && a1[0][9]) + (a1[2][4] - v2)) % 7);
+            }
+            a1[1][4] = (((v3 == v2) % 2) && ((v2 == v3) == (a0[7] >= 2)));
+            a0[6] = (((i10 - v3) + (v0 <= i10)) ? ((v3 <= 13) <= (19 - 40)) : ((v1 && 41) > (v0 + v0)));
+            i10 = i10 + 1;
+        } while (i10 < 5);
+    }
+    return (((94 % 4) > (v3 - v2)) > ((a0[0] / 2) > (a0[14] == v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
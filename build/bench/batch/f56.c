@@ -0,0 +1,110 @@
+int f0() {
+    int v0 = 55;
+    int v1 = 34;
+    int v2 = 89;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a1[2][2] && v0) ? (a1[2][0] / 6) : (5 ? 55 : a1[1][5])) + ((v0 < 5) <= (v2 && v1)));
+    a1[0][15] = (((v0 ? 57 : 46) <= (v0 / 3)) * ((a0[7] > v1) || (v1 / 2)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v0 = (((v3 && i1) == (a0[9] ? a1[0][8] : a1[1][12])) != ((v3 != v3) ? (a0[4] || a1[2][15]) : (v2 * v3)));
+                v0 = (((i1 + v1) * (v2 ? v2 : a1[0][2])) - ((6 > a1[0][12]) >= (a1[0][12] - v0)));
+                v1 = (((a0[8] % 4) == (a1[0][12] == a1[2][2])) / 7);
+            }
+            a0[6] = (((v0 && v1) + (v0 > i0)) * ((v1 != 48) && (a1[1][6] + v0)));
+            v2 = (((86 + 1) && (87 == a1[3][11])) && ((a1[1][12] / 4) % 9));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[0][14] = (((a1[0][4] < a0[4]) / 5) ? ((45 ? a1[1][7] : a1[3][4]) / 5) : ((a1[0][6] / 4) < (48 < a1[0][2])));
+            a0[1] = (((v0 * 76) ? (10 && a1[0][10]) : (i2 >= v1)) ? ((a0[15] != v3) != (a0[0] || v3)) : ((76 >= v1) && (46 + a0[0])));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((a0[5] % 3) > 51) break;
+                v3 = (((v1 >= v3) % 3) + ((v1 > v0) >= (v1 ? v1 : 86)));
+                v3 = (((v0 / 2) + (v2 / 7)) / 8);
+                v1 = (((a0[14] == a1[0][0]) && (a1[1][8] * 58)) >= ((i2 ? i3 : v2) < (a0[13] / 8)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v1 = (((i4 && i4) <= (82 % 2)) || ((54 != a1[1][13]) * (a0[15] - a1[2][2])));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                v2 = (((v0 && 23) != (v0 > a1[0][12])) / 8);
+                v1 = (((49 + a0[9]) <= (a0[10] < 5)) > ((i4 / 6) || (i5 && v3)));
+                v1 = (((a1[3][11] <= v2) <= (17 - 72)) * ((a1[0][11] >= a1[2][5]) != (a1[2][0] < a1[1][5])));
+            }
+            a0[9] = (((v0 > i4) <= (v0 + v1)) % 8);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((52 == 7) / 4) ? ((v1 >= v2) + (v1 ? v2 : v1)) : ((a1[1][10] ? v0 : v1) * (a0[14] && v1)))) {
+        a0[7] = (((v1 > v0) ? (a0[6] + v1) : (6 < 68)) != ((v0 ? v3 : a1[3][7]) || (v0 % 1)));
+        v0 = (((a0[0] <= a1[1][6]) >= (a1[0][15] || a1[2][2])) - ((a1[3][6] == 25) - (a0[7] ? v2 : v0)));
+        v0 = (((v0 && v0) * (a1[0][7] * 98)) + ((52 == v2) <= (15 / 8)));
+    } else {
+        a1[1][0] = (((v0 || a1[0][9]) > (v0 == v0)) - ((a0[9] || 55) || (84 ? 18 : v3)));
+        v3 = (((v3 != 30) % 2) % 9);
+        v0 = (((29 || v0) > (v3 % 3)) && ((88 || v0) >= (v0 - v0)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((77 / 3) != (v0 / 8)) % 1);
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    a0[4] = (((v0 && v1) ? (v3 || 94) : (49 + 16)) * ((v0 ? 3 : a0[8]) <= (v0 / 7)));
+                    a1[0][14] = (((a0[2] ? v3 : a1[0][3]) + (i6 + i7)) + ((a1[3][9] - 34) > (a0[12] - v3)));
+                    v2 = (((v2 != 61) != (i7 ? i6 : v2)) ? ((a0[5] != v1) || (54 % 4)) : ((v2 ? a1[3][15] : a1[0][8]) == (i6 ? a0[1] : a0[8])));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((a1[0][15] && v3) + (v3 > i6)) == ((a1[3][6] != v1) && (52 - v2)));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    v1 = (((v3 >= a1[3][6]) != (v3 * a1[2][13])) > ((a0[6] % 9) && (9 != 30)));
+    if ((((v0 == v2) && (a0[0] - v1)) / 8)) {
+        a1[0][6] = (((28 ? v0 : a0[12]) < (a1[3][8] == v2)) || ((51 <= v3) <= (29 || v3)));
+        v2 = (((v3 * a0[1]) > (v0 + v2)) * ((v1 >= v1) && (v2 > a1[2][14])));
+        v0 = (((a1[0][8] - a1[2][5]) != (v2 > a1[1][9])) ? ((a1[0][4] ? v1 : v2) != (a1[3][5] > v2)) : ((a1[3][7] < v3) * (45 != 13)));
+    } else {
+        a0[15] = (((78 == v0) || (v2 % 5)) == ((75 >= 50) % 8));
+        v3 = (((a1[0][8] + v3) == (v2 - v3)) <= ((73 != v3) == (v1 != 18)));
+        v2 = (((v2 > v1) ? (v2 - v1) : (47 * v3)) && ((13 / 6) ? (v3 < 52) : (v0 >= 81)));
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 6) {
+                    if ((a1[0][14] > v3) > 90) break;
+                    a0[13] = (((i8 <= v1) / 3) % 5);
+                    v2 = (((v0 >= a1[0][7]) == (v3 + a1[1][3])) >= ((v2 * 35) < (80 && a0[10])));
+                    v3 = (((v1 && v3) <= (v1 && a1[3][1])) - ((i9 || v1) <= (72 ? 36 : v3)));
+                    i9 = i9 + 1;
+                }
+            }
+            a0[5] = (((53 * 95) >= (95 + v1)) * ((v3 * v0) - (v1 % 2)));
+            a1[0][0] = (((v3 ? 96 : i8) / 8) > ((v0 == a0[9]) != (v0 < 18)));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    return (((v2 || a1[3][2]) - (v2 / 1)) - ((44 - v3) > (a1[3][5] + v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,215 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 72;
+    int v2 = 47;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][5] < v0) / 2) % 7)) {
+        v3 = (((v3 ? v2 : a1[3][3]) || (v1 == v1)) ? ((63 || 2) - (v2 <= v3)) : ((v0 >= 37) / 1));
+        v3 = (((a1[1][2] != v3) ? (a1[3][8] != 80) : (74 / 3)) - ((v3 && a0[12]) * (5 < v3)));
+        a1[3][11] = (((v3 - a1[2][0]) != (a0[3] || a0[8])) == ((v1 * 89) != (6 < a1[0][2])));
+    } else {
+        a0[1] = (((v3 || v1) ? (v2 && v3) : (v0 > v1)) / 9);
+        v3 = (((a1[2][0] - a0[12]) - (a1[2][7] < 13)) != ((v0 + v2) > (v2 % 4)));
+        v0 = (((83 && 84) + (a0[10] ? 7 : a1[1][2])) && ((v2 >= v3) <= (82 && a0[3])));
+    }
+    a0[12] = (((a1[0][12] - 39) ? (v1 ? a1[0][8] : v0) : (27 || 69)) % 1);
+    if ((((v2 / 7) && (v0 != 26)) / 7)) {
+        v1 = (((v0 < 58) && (v2 <= 89)) ? ((v0 > a0[8]) ? (v0 ? v1 : 30) : (v3 <= v3)) : ((v1 && v2) == (0 <= v1)));
+        a0[10] = (((v3 - v0) > (81 >= v1)) * ((v0 <= 37) >= (v1 < a1[0][6])));
+        v3 = (((v0 >= a1[1][10]) % 7) >= ((a0[8] ? v1 : 90) - (v3 <= 75)));
+    } else {
+        v0 = (((v3 < v2) + (v3 || v2)) % 8);
+        v2 = (((v2 % 9) < (v3 ? a1[2][4] : v2)) / 8);
+        v0 = (((a1[3][6] > a1[3][8]) > (v1 + v0)) * ((v1 / 5) <= (a0[5] >= v2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((v2 != 79) ? (a0[0] && a0[8]) : (a0[15] == 84)) / 8);
+                    v1 = (((63 * v3) && (a1[1][7] >= v3)) ? ((a1[3][0] + v0) ? (i0 && 29) : (88 == a1[2][3])) : ((83 && v1) > (a1[1][13] >= 15)));
+                    v2 = (((93 ? v2 : v1) + (a1[0][0] < 26)) / 6);
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((a1[0][15] && v3) * (v0 ? v2 : 56)) > ((a0[10] / 5) || (v1 && a0[9])));
+            v3 = (((v2 >= 74) > (19 * 11)) ? ((a0[1] ? v2 : v0) + (i0 || v3)) : ((40 || v2) + (v0 < a0[5])));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((3 >= v1) <= (34 <= i2)) - ((37 > a0[1]) >= (69 < i3)));
+                    v1 = (((i2 >= v3) - (i3 <= v1)) == ((a1[1][0] < a0[1]) || (a0[9] <= v3)));
+                    v2 = (((95 < a1[2][2]) / 8) > ((v1 || v0) - (i2 * v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a1[1][0] = (((a1[1][10] - v2) % 3) < ((a1[3][7] || i2) == (v1 < a0[0])));
+            a1[3][0] = (((a0[0] || 66) * (v0 == i2)) / 8);
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((v3 > 73) > (a0[5] < v0)) + ((38 ? 10 : v0) % 3))) {
+        v2 = (((v1 && 93) - (a1[3][12] >= 36)) % 9);
+        a1[3][13] = (((v1 ? v3 : 99) > (a0[9] >= v0)) * ((v1 && a1[1][4]) >= (a0[4] ? v0 : a0[13])));
+        a0[5] = (((38 + v2) ? (v0 >= 35) : (v1 - v1)) * ((v1 < 42) && (v1 > v2)));
+    } else {
+        a0[6] = (((v1 / 1) || (12 % 9)) && ((55 < v3) + (v2 > 9)));
+        v1 = (((v1 < v0) / 5) * ((v0 % 2) ? (v3 && v1) : (20 < 33)));
+        v0 = (((a1[3][8] ? v2 : v1) + (86 != v1)) >= ((86 * 53) + (a0[1] || v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((a0[10] ? 16 : i5) > 82) break;
+                v3 = (((13 <= a1[1][15]) * (v1 / 1)) < ((v3 == i5) % 1));
+                a0[10] = (((27 <= v2) == (75 % 9)) < ((v0 > a1[3][1]) > (a1[0][7] ? 64 : i4)));
+                a0[10] = (((a0[10] < v0) + (a0[6] != i4)) * ((i4 - v1) + (a0[0] ? 56 : v2)));
+            }
+            v3 = (((84 % 6) ? (a1[0][4] + v0) : (4 / 2)) - ((60 == 83) && (27 > a0[4])));
+            a1[2][13] = (((i4 == i4) * (v1 + i4)) > ((83 - a0[6]) && (v0 == 46)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    a0[11] = (((v3 > a0[9]) % 1) + ((a1[1][0] > a0[1]) * (v1 / 1)));
+                    v1 = (((v2 >= v2) - (v2 != a1[0][0])) == ((v3 < 39) != (a0[7] > a0[5])));
+                    v1 = (((v3 - 83) ? (a0[3] <= 41) : (a0[12] <= 17)) ? ((i7 >= a1[3][1]) > (a1[3][0] >= a1[2][6])) : ((v1 ? 60 : v0) % 3));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((v2 == a0[10]) / 1) >= ((31 || v1) == (10 == v2)));
+            v2 = (((a1[2][11] - 32) <= (v0 <= 33)) >= ((14 % 4) - (i6 / 1)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                if ((a1[3][3] != a0[6]) > 61) break;
+                a0[14] = (((v0 <= v2) < (v0 / 5)) > ((v0 >= 16) % 1));
+                a1[1][4] = (((i8 && 63) % 5) % 8);
+                v2 = (((3 >= i8) != (92 ? a1[1][9] : v3)) || ((a1[3][13] && a0[9]) ? (a0[13] && v1) : (92 < i9)));
+                i9 = i9 + 1;
+            } while (i9 < 5);
+        }
+        v2 = (((v0 && a1[2][10]) + (57 ? 77 : a1[2][9])) ? ((a0[13] + a1[0][13]) >= (a0[15] ? v0 : 7)) : ((i8 && 57) - (v1 * v3)));
+        a0[6] = (((i8 != a0[11]) == (i8 * 11)) / 7);
+    }
+    if ((((a1[1][11] >= v2) <= (a0[3] % 1)) >= ((83 ? v0 : 32) == (v2 <= v3)))) {
+        a1[0][10] = (((89 < 46) - (v1 / 7)) < ((a1[3][5] >= v1) && (4 ? a0[0] : 59)));
+        v2 = (((77 ? 18 : 83) + (a1[3][2] < v0)) - ((a1[0][3] == a1[0][7]) && (v0 <= 61)));
+        v2 = (((v0 > a1[0][7]) / 5) == ((v0 < v3) && (v2 || v3)));
+    } else {
+        v2 = (((a1[0][15] ? v1 : 47) != (v2 > v2)) - ((a1[2][7] == 24) < (58 * v3)));
+        a0[12] = (((v0 ? v1 : 6) + (v1 ? a0[8] : a1[3][7])) || ((a1[0][1] >= a0[14]) <= (v3 / 2)));
+        v1 = (((v1 * a0[15]) ? (v0 - v0) : (48 + v1)) == ((v3 * a1[2][3]) && (v1 == v2)));
+    }
+    return (((v3 * 17) || (a1[1][13] * 47)) - ((v3 > a1[2][4]) % 7));
+}
+int f1() {
+    int v0 = 13;
+    int v1 = 62;
+    int v2 = 99;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v3 = (((a1[2][1] ? i0 : v3) ? (a1[3][13] > a0[14]) : (a1[2][0] != i0)) % 3);
+        a1[3][4] = (((a1[2][13] - a1[3][7]) * (a1[0][13] / 1)) && ((v0 > v2) % 3));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((v0 > v3) ? (17 < v0) : (2 ? v0 : v1)) <= ((v1 != i0) == (a1[2][8] >= a0[8])));
+                a1[0][11] = (((v2 >= v3) ? (i1 > 36) : (i1 * i0)) != ((93 % 4) / 9));
+                a0[8] = (((79 < a0[1]) * (v2 != i1)) > ((a0[13] % 7) <= (42 <= i1)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    v1 = (((23 ? v0 : a0[2]) / 9) <= ((47 - v3) / 6));
+    a0[4] = (((v2 % 5) * (v3 == 58)) || ((v2 > v3) || (v2 + a0[7])));
+    if ((((a1[2][1] ? 29 : 56) <= (15 ? a1[0][14] : 72)) != ((v0 % 4) == (a1[1][5] * v0)))) {
+        v3 = (((v1 || a0[11]) % 8) == ((a0[2] == v2) < (98 != v2)));
+        a1[0][13] = (((v1 ? v2 : v2) % 9) * ((v2 % 1) <= (v1 % 9)));
+        v0 = (((v1 && v0) < (a1[0][10] && 61)) >= ((a0[4] + v1) || (1 > v3)));
+    } else {
+        a1[1][0] = (((74 / 5) || (v3 % 1)) + ((v1 % 4) && (80 > v2)));
+        v0 = (((v3 / 3) >= (v0 ? v2 : 50)) ? ((a1[0][1] <= a1[1][0]) * (23 ? v1 : a0[10])) : ((v0 == v2) <= (v1 * 36)));
+        a0[6] = (((a1[1][0] && 34) > (v1 != a0[6])) != ((v3 < a0[3]) + (56 == v0)));
+    }
+    if ((((83 > v2) >= (a0[11] || v1)) == ((43 > v1) > (a1[3][5] - 84)))) {
+        v1 = (((v0 <= 5) % 4) < ((a1[2][9] && a1[0][11]) == (v1 >= v2)));
+        a1[1][10] = (((a0[14] - 92) + (18 / 3)) ? ((v0 == v0) ? (a1[2][10] ? v2 : v1) : (v1 > a0[2])) : ((28 <= a0[0]) <= (46 > v1)));
+        a0[15] = (((v3 && a0[6]) / 3) && ((v2 ? 42 : v0) % 4));
+    } else {
+        a0[7] = (((86 - 96) + (41 / 8)) ? ((v1 + a0[15]) != (v1 > v2)) : ((a1[0][1] + v1) && (a1[1][1] * v2)));
+        v2 = (((65 && a0[2]) != (v1 ? v0 : 69)) ? ((v3 < a1[3][3]) ? (a1[2][5] != v3) : (23 / 9)) : ((v1 == a1[1][9]) + (v1 - a0[7])));
+        v1 = (((a1[3][12] + 13) * (a1[3][7] <= a0[3])) * ((v3 >= 58) + (v3 / 4)));
+    }
+    if ((((v1 ? 29 : v0) ? (30 - v2) : (v1 / 8)) ? ((37 != v2) + (81 >= a1[2][0])) : ((v3 > a0[8]) - (v0 > v0)))) {
+        v2 = (((42 <= v0) >= (v3 - v0)) != ((v1 < v1) * (v2 ? 81 : a1[3][10])));
+        v0 = (((v3 ? a1[1][1] : 56) - (24 != v0)) >= ((v3 < v3) != (v1 || 10)));
+        v0 = (((v0 / 9) != (a1[1][9] >= v0)) ? ((v0 ? a0[10] : 6) <= (a1[0][0] && a1[1][11])) : ((a0[7] ? 66 : a0[12]) && (a0[0] * v2)));
+    } else {
+        v0 = (((v1 && 73) < (v3 * a1[0][2])) ? ((v0 - 60) ? (a0[13] == 63) : (a1[3][9] < 82)) : ((v2 < v1) - (a1[2][0] / 9)));
+        v0 = (((90 || 85) != (v3 >= 2)) / 9);
+        v1 = (((90 >= v1) <= (v1 * v2)) - ((41 > v1) != (a0[13] * v3)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((a0[1] + a1[2][4]) > 75) break;
+        v3 = (((v0 != 5) > (v1 + 79)) >= ((v3 < 38) - (99 || 0)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a1[3][1] = (((i3 / 7) ? (22 % 3) : (v1 != 36)) <= ((68 + 7) + (i3 ? v2 : a0[2])));
+            v1 = (((94 != a0[9]) < (47 == v3)) ? ((v0 / 8) / 3) : ((12 / 3) * (v3 <= v3)));
+            v1 = (((a0[7] * i3) + (a0[3] < i3)) && ((72 < 75) - (i3 / 2)));
+        }
+        a0[5] = (((v0 - v1) >= (i2 ? v0 : a0[7])) < ((a0[14] == a1[2][8]) % 3));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v1 = (((i4 ? i4 : v2) + (v0 >= v3)) * ((v2 + a0[1]) < (8 || 27)));
+        {
+            int i5 = 0;
+            do {
+                a0[8] = (((59 % 1) != (v2 == 95)) - ((v3 < 59) % 7));
+                v1 = (((i4 == 94) ? (32 > i4) : (v0 >= v3)) && ((i4 < 2) || (v2 / 6)));
+                a0[5] = (((a1[1][7] == v3) != (v3 > a1[1][10])) % 2);
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v1 = (((31 >= 96) != (12 != 55)) >= ((a1[3][12] < i4) - (v3 - a0[3])));
+    }
+    if ((((v1 == v1) / 2) / 3)) {
+        v1 = (((a0[2] % 3) >= (v2 * v3)) >= ((39 <= v2) != (v1 * v2)));
+        v3 = (((a1[0][3] ? 78 : a0[4]) == (a0[5] && a1[0][1])) < ((a1[1][9] ? 93 : a0[10]) || (v3 || v2)));
+        v3 = (((a1[2][11] != v1) > (43 <= v2)) >= ((77 ? v1 : v3) / 2));
+    } else {
+        a0[2] = (((59 <= 11) >= (v0 <= v1)) == ((a1[0][12] % 8) != (81 ? v0 : 52)));
+        a0[6] = (((a1[3][13] - a1[3][10]) != (a1[2][8] >= a0[3])) ? ((45 || v2) < (v3 != v0)) : ((v0 - v3) / 5));
+        a1[2][13] = (((33 <= v3) ? (v1 ? 74 : v1) : (v3 / 4)) || ((a1[2][14] * v2) || (v2 >= v0)));
+    }
+    v0 = (((v3 ? a0[11] : 61) + (v0 <= 37)) ? ((a0[2] % 9) / 3) : ((v2 != a0[2]) || (63 / 6)));
+    return (((a1[3][13] || 43) <= (v1 > v1)) || ((v2 + 84) <= (a1[1][4] || a1[2][6])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
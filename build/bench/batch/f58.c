@@ -0,0 +1,283 @@
+int f0() {
+    int v0 = 93;
+    int v1 = 96;
+    int v2 = 73;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 ? 27 : v3) < (29 || a0[6])) >= ((v2 != 57) % 2));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((a1[3][9] >= v0) > 86) break;
+            v0 = (((v0 / 3) >= (a1[3][12] || v2)) / 4);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    if ((a0[4] != v3) > 53) break;
+                    v3 = (((22 <= 7) / 8) && ((v1 != a0[6]) - (i1 != v2)));
+                    v3 = (((a1[3][13] + 25) / 7) && ((i0 ? v2 : 52) ? (a0[15] == v3) : (v0 - v0)));
+                    v0 = (((v3 || i1) + (v0 >= a1[1][13])) >= ((a0[14] && v3) * (24 >= a0[15])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][1] = (((v2 || a0[11]) < (v1 || a1[1][7])) + ((a1[3][9] ? v1 : a0[2]) ? (v3 == i0) : (v0 ? i0 : v1)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[12] * a1[0][6]) <= (v3 > v0)) % 4)) {
+        v1 = (((v1 ? v2 : v3) > (0 && v3)) % 3);
+        v2 = (((97 >= v2) < (0 > v2)) == ((v0 / 9) - (v0 == 70)));
+        a1[3][7] = (((v3 != v0) || (a1[1][10] < 65)) >= ((22 / 5) < (v0 ? v0 : a1[2][6])));
+    } else {
+        a1[2][6] = (((v1 / 4) ? (a1[1][13] > v1) : (64 / 7)) / 9);
+        v1 = (((a0[3] % 1) ? (v1 < v1) : (v2 <= v2)) && ((a1[0][14] * v3) <= (a0[14] % 4)));
+        v0 = (((v2 ? v0 : a1[3][4]) && (95 + 88)) && ((a0[8] != v3) != (v3 >= 73)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((34 || a0[2]) > 90) break;
+            v1 = (((v3 + i2) ? (a1[1][7] <= 96) : (i2 || v3)) > ((v0 * 48) < (a0[7] * v1)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a1[0][3] = (((a0[3] < v3) || (a0[15] > a1[1][11])) <= ((i3 / 3) + (59 % 8)));
+                v3 = (((v0 - v1) < (74 != i2)) < ((v0 % 8) && (62 >= v2)));
+                a1[3][3] = (((v2 == 4) / 6) == ((a0[14] ? 14 : 87) <= (a1[3][7] ? 39 : a1[1][4])));
+            }
+            a0[0] = (((85 - v1) ? (i2 < v0) : (v0 ? v2 : 18)) < ((v1 == v3) * (88 < a0[14])));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v3 = (((v1 ? a1[3][10] : v1) && (v1 % 5)) && ((v1 && a0[14]) != (31 != v1)));
+            a1[0][9] = (((a1[1][10] > a0[8]) <= (93 != v1)) >= ((a1[0][10] ? 27 : v3) + (v3 / 7)));
+            a0[1] = (((41 >= v0) * (v3 + a0[9])) > ((58 - i5) == (18 / 9)));
+        }
+        a0[15] = (((80 >= 20) || (a1[1][6] == v0)) ? ((a1[0][12] - v0) ? (v0 ? v3 : 0) : (v1 == a1[0][7])) : ((i4 == a0[13]) - (a1[3][2] <= 2)));
+        v1 = (((a1[2][6] / 5) / 8) <= ((v2 < v3) - (a0[9] ? 27 : v1)));
+    }
+    if ((((97 < 92) == (a0[14] == 94)) % 1)) {
+        v1 = (((v1 != 91) >= (v2 <= v2)) >= ((v1 && v0) == (71 < a0[0])));
+        a1[3][13] = (((v1 != v2) == (v0 * v0)) ? ((v0 <= v1) ? (52 % 1) : (v2 && a0[8])) : ((v1 != a1[0][5]) <= (v1 % 9)));
+        v3 = (((92 ? 56 : 52) ? (53 / 3) : (v0 % 7)) > ((v3 - v2) || (a1[0][1] >= a0[9])));
+    } else {
+        v1 = (((a1[0][9] + 35) == (v1 ? v3 : v0)) + ((36 >= 79) - (a0[12] % 9)));
+        v0 = (((a0[0] ? v0 : 80) / 3) ? ((v2 ? v3 : a1[1][13]) > (v0 == a0[15])) : ((a0[1] == v3) % 6));
+        a1[1][2] = (((80 ? 17 : v1) >= (v2 - a1[2][6])) != ((v3 * v0) && (a1[3][14] != v0)));
+    }
+    v2 = (((52 ? 37 : v3) % 7) > ((12 == v2) == (v0 - v0)));
+    if ((((v1 ? v3 : 16) < (68 * v1)) / 2)) {
+        v3 = (((29 - v1) - (64 - v2)) % 2);
+        v0 = (((77 && v0) * (v3 + a1[2][3])) != ((64 + v3) && (v1 ? v1 : a1[1][8])));
+        v3 = (((a0[3] * v1) < (a1[1][2] > 58)) * ((v0 + 78) - (a0[2] && v1)));
+    } else {
+        v2 = (((v0 && v1) && (v1 + 0)) % 2);
+        a1[2][7] = (((84 ? a0[0] : v0) < (v3 > 29)) % 1);
+        v3 = (((v0 ? 24 : v0) && (v0 < v0)) >= ((a0[0] >= 14) != (a0[15] + v2)));
+    }
+    if ((((16 && v2) != (68 - v0)) % 1)) {
+        a0[2] = (((a0[3] || v1) || (a0[13] ? 5 : a0[11])) - ((v0 % 8) * (v2 ? 0 : v1)));
+        a0[14] = (((v2 && a1[1][7]) == (v1 > a1[0][3])) > ((v3 % 8) / 6));
+        v3 = (((v2 + v0) * (24 >= a0[12])) % 1);
+    } else {
+        v2 = (((v3 >= v2) <= (51 ? v1 : v2)) % 9);
+        a1[3][3] = (((75 + v2) / 1) != ((a0[5] % 3) != (a0[11] ? 75 : v0)));
+        v0 = (((v3 > a0[14]) / 8) == ((64 * a1[3][9]) >= (17 ? a1[0][1] : a0[15])));
+    }
+    v1 = (((53 - v3) == (v2 ? a1[0][12] : v2)) - ((72 + 53) + (v1 || a1[0][15])));
+    return (((v1 || v3) > (v2 == v2)) / 3);
+}
+int f1() {
+    int v0 = 66;
+    int v1 = 16;
+    int v2 = 98;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[0][6] = (((a1[0][4] == a0[2]) - (v3 < v3)) >= ((i1 ? i0 : a1[1][8]) || (53 ? v3 : 26)));
+                a1[3][8] = (((i1 < v3) && (a0[3] * v1)) || ((v1 <= 38) && (a0[0] / 6)));
+                v0 = (((v2 % 1) != (64 < v1)) / 8);
+            }
+            a0[2] = (((28 - v2) >= (a0[15] / 6)) ? ((v0 == 30) < (i0 >= a0[11])) : ((v2 > a0[9]) - (v2 + a0[10])));
+            a1[2][13] = (((v3 - i0) / 4) < ((i0 ? 62 : 87) && (15 % 1)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        a1[3][11] = (((99 <= v3) && (11 && v2)) || ((i2 >= 10) < (i2 < v1)));
+        v1 = (((a0[2] < 74) == (a1[0][2] ? a1[0][2] : a0[2])) == ((v1 + a0[5]) == (v1 < a1[0][0])));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((v0 <= 25) != (v3 == 59)) || ((97 > 91) % 8));
+                v2 = (((v2 >= i2) < (i2 + 51)) % 8);
+                a1[0][13] = (((v2 <= v3) != (21 ? 9 : v2)) != ((v0 < 91) * (v3 <= a0[10])));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v0 = (((a1[0][4] + v3) > (v1 <= v1)) == ((83 > a1[2][9]) * (i5 * 14)));
+                v3 = (((81 - v0) % 3) > ((68 ? a0[14] : i4) && (v3 > 27)));
+                v3 = (((a0[3] + v0) > (i4 ? i5 : i4)) == ((a0[15] * v1) % 2));
+            }
+            a1[3][11] = (((97 >= a0[15]) > (v2 + v0)) <= ((v2 % 9) > (v1 != a1[2][8])));
+            v2 = (((v3 * i4) == (92 >= a0[4])) ? ((a0[8] <= v1) - (v0 < 5)) : ((a1[2][8] >= 95) % 7));
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((92 / 1) <= (v1 ? v0 : v0)) || ((a1[0][13] * 24) != (v1 <= 24)));
+    v2 = (((85 || 18) == (v1 - 13)) ? ((86 % 8) ? (v1 * 96) : (v3 - 60)) : ((73 * a1[3][4]) * (v2 <= v1)));
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            v2 = (((v0 ? v0 : 58) > (a1[0][3] / 3)) > ((a0[0] <= 83) + (v1 || v1)));
+            v2 = (((a0[7] + v2) - (a0[10] < v3)) > ((v2 < 66) % 4));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    if ((a1[0][1] > i7) > 93) break;
+                    v2 = (((a1[1][13] && v2) != (v2 / 8)) != ((i6 + i6) >= (v1 == i6)));
+                    v2 = (((i6 % 7) ? (a0[3] * i7) : (a1[0][12] / 3)) >= ((v3 - v1) != (i7 > i6)));
+                    v3 = (((a0[6] ? 33 : v2) && (i7 || v2)) - ((54 * i6) * (73 - v3)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((72 / 4) + (v1 == a0[3])) || ((v1 / 8) <= (v0 - a0[6])))) {
+        v0 = (((5 < v1) && (v2 + v1)) + ((a1[0][14] ? 45 : a0[5]) || (v2 || 1)));
+        v2 = (((v1 == v3) ? (v3 != v2) : (55 > v2)) + ((a1[3][6] == v3) ? (v0 / 6) : (73 && v0)));
+        v2 = (((a1[3][7] >= v1) != (a1[1][7] + a0[12])) - ((a0[6] || 48) ? (a0[8] % 7) : (v2 % 9)));
+    } else {
+        v3 = (((v3 % 6) / 9) != ((v2 == 83) ? (v1 >= 58) : (v0 > a0[6])));
+        v2 = (((a0[8] >= 69) && (v3 % 1)) && ((v0 < v2) != (a0[0] || v0)));
+        a0[8] = (((47 != 94) == (a0[7] + a0[14])) <= ((v1 + a1[0][11]) * (v1 + v2)));
+    }
+    v2 = (((61 ? v2 : 51) / 1) < ((a0[0] % 7) == (91 || a0[10])));
+    a1[0][5] = (((38 / 6) + (v2 * v0)) && ((v2 >= 91) ? (v2 > a0[14]) : (v2 || v3)));
+    if ((((a1[3][1] || v2) <= (a0[5] == 85)) + ((v2 <= a1[0][0]) <= (a0[5] <= v2)))) {
+        v2 = (((61 > v3) % 3) + ((v1 * a1[0][13]) ? (v2 < 11) : (a1[3][4] ? v0 : v3)));
+        a0[1] = (((v0 || v0) / 3) ? ((v1 != v1) && (a1[2][13] < a0[9])) : ((1 / 5) ? (a0[3] ? 61 : a1[2][4]) : (v1 < v2)));
+        v3 = (((v2 || a0[12]) == (48 != v0)) <= ((40 > 1) != (v3 && v1)));
+    } else {
+        a1[0][1] = (((a1[3][9] <= v1) && (a0[0] % 1)) % 4);
+        a1[2][15] = (((v1 ? v1 : a1[1][12]) != (v3 < 95)) && ((v1 == a1[2][6]) <= (96 + 74)));
+        v1 = (((v3 < 49) / 2) % 9);
+    }
+    return (((a1[2][10] > a1[0][1]) >= (29 * v1)) || ((v1 + 73) ? (v2 * a0[13]) : (v1 / 9)));
+}
+int f2() {
+    int v0 = 41;
+    int v1 = 27;
+    int v2 = 23;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[9] - v2) != (v2 ? 30 : v1)) ? ((v2 >= v3) <= (v3 ? 14 : 64)) : ((v2 ? a1[3][0] : v3) < (v3 > v2)))) {
+        v3 = (((a1[2][9] != 27) < (v1 && a1[2][7])) >= ((68 >= 66) == (v1 - 78)));
+        v3 = (((16 + a1[0][10]) >= (v1 || 62)) ? ((v3 > v1) == (v2 || 0)) : ((v2 <= v0) - (v2 ? 73 : v1)));
+        v1 = (((v3 < v1) < (v3 != 13)) * ((v1 ? v3 : 24) == (v2 * v0)));
+    } else {
+        a1[1][11] = (((26 ? v3 : 94) < (a0[10] * a0[2])) / 6);
+        v1 = (((v2 >= v3) > (a1[2][2] + 90)) || ((v1 ? a0[15] : a1[2][0]) ? (v0 && 39) : (v2 < v0)));
+        v3 = (((v2 % 3) - (2 <= v3)) % 5);
+    }
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v2 % 4) ? (v3 < 79) : (v0 / 8)) * ((a1[0][4] ? 46 : v1) != (v2 * a0[1])));
+            {
+                int i1 = 0;
+                do {
+                    if ((v0 ? i1 : 71) > 85) break;
+                    v3 = (((v1 + v2) % 9) && ((a0[12] / 5) % 5));
+                    v3 = (((i0 < 49) != (55 != v1)) + ((v0 == v3) < (a0[6] - 56)));
+                    v3 = (((a1[1][12] == a1[0][10]) == (a1[1][15] || i1)) > ((i0 || v2) < (i1 != a0[3])));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v1 = (((a1[2][12] <= v2) <= (0 + v3)) == ((a0[10] % 2) && (a0[1] > v3)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v1 = (((a0[0] ? v3 : a0[6]) > (a1[1][10] >= 39)) / 2);
+            v2 = (((v3 + 30) == (a1[1][1] + a1[0][13])) - ((v1 <= 59) && (96 != 96)));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][11] = (((v0 / 8) ? (v3 ? a1[0][15] : a0[9]) : (60 < a0[7])) - ((a1[3][13] || 60) || (v0 - v3)));
+                    v2 = (((74 == a1[0][11]) >= (i2 == a1[2][5])) % 7);
+                    v3 = (((a0[7] == a1[2][8]) <= (97 || a1[3][0])) - ((i2 >= v3) && (i2 != v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((a1[2][11] <= v0) < (v3 ? v1 : 65)) + ((v3 >= v2) && (v0 || 87)));
+    a0[4] = (((v3 == v1) <= (v0 ? a0[7] : v1)) % 8);
+    if ((((v0 * a1[2][2]) / 3) != ((a1[3][15] % 3) / 9))) {
+        v1 = (((v0 <= 21) * (v3 || v1)) / 7);
+        a0[1] = (((a1[3][3] * v3) != (37 && v1)) ? ((v0 / 3) != (v0 || 4)) : ((70 <= v3) + (a0[8] < 81)));
+        a1[2][2] = (((a0[3] && a0[10]) * (a0[3] <= v2)) && ((v1 ? v2 : a1[1][6]) == (43 % 5)));
+    } else {
+        v3 = (((58 > a0[4]) - (a0[7] != 16)) / 3);
+        v3 = (((v3 % 7) ? (94 == v1) : (a1[1][6] * a0[5])) * ((a0[14] / 6) <= (51 ? 96 : v3)));
+        a1[0][1] = (((v3 <= v3) >= (v0 ? a0[13] : 26)) / 4);
+    }
+    v2 = (((86 <= v2) - (v2 || a1[0][12])) + ((v2 < v2) + (v3 / 1)));
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v1 = (((v3 > v3) + (i4 < a0[4])) / 8);
+        a1[2][6] = (((v1 + v0) ? (i4 * v2) : (46 + a1[3][12])) <= ((v2 ? i4 : v3) % 7));
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v1 = (((a0[1] && v3) != (v3 >= 86)) < ((a0[3] == 97) * (i4 - a1[2][13])));
+            v3 = (((i4 ? v1 : a1[2][1]) == (a1[2][0] ? a0[11] : i5)) ? ((a0[8] != a0[1]) % 2) : ((v0 < a0[15]) <= (a0[11] * 23)));
+            v1 = (((v1 ? v0 : v0) == (27 <= a1[3][14])) ? ((a1[1][8] >= i4) >= (i5 <= i4)) : ((19 && v1) || (v2 - i5)));
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v0 = (((v2 ? v2 : a1[1][2]) ? (i6 || 67) : (47 != 17)) % 8);
+        v2 = (((v0 > a1[0][8]) == (39 >= 7)) / 1);
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            if ((v3 / 3) > 95) break;
+            v1 = (((a0[5] != v2) < (42 ? a0[0] : a1[1][0])) >= ((45 - i6) % 8));
+            a0[11] = (((87 % 3) + (i6 % 7)) || ((a1[0][1] <= 91) != (a0[0] ? 42 : v2)));
+            v0 = (((v3 ? 6 : 85) / 3) * ((49 == a1[3][14]) && (v0 - i7)));
+        }
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            do {
+                if ((31 <= 13) > 79) break;
+                v1 = (((86 != i8) >= (a1[3][15] <= i8)) && ((v2 <= 30) + (a0[1] != v0)));
+                v3 = (((a0[7] % 3) % 9) >= ((10 % 4) + (88 == v3)));
+                v2 = (((a1[3][0] <= v0) > (a1[3][6] - v1)) > ((a1[0][13] ? i8 : 7) > (9 >= 29)));
+                i9 = i9 + 1;
+            } while (i9 < 2);
+        }
+        a0[13] = (((a1[0][8] == 9) <= (a1[0][4] && v0)) == ((5 ? v2 : 96) == (v3 && v0)));
+        a1[2][15] = (((a1[1][5] > v1) >= (i8 <= 88)) == ((v0 <= a1[3][14]) != (a1[1][9] < 59)));
+    }
+    return (((20 && v1) != (a0[3] >= 6)) > ((v2 + a0[15]) && (v0 || 20)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
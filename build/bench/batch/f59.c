@@ -0,0 +1,421 @@
+int f0() {
+    int v0 = 1;
+    int v1 = 17;
+    int v2 = 50;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    a0[7] = (((v1 || v1) != (7 > v1)) ? ((76 && v3) != (7 != v2)) : ((v1 >= v1) || (a0[8] + v0)));
+    v3 = (((v2 ? v3 : v0) > (v0 - a0[8])) % 6);
+    if ((((v3 + a1[1][15]) < (v2 + v3)) && ((62 ? v3 : v1) * (v2 > v0)))) {
+        v1 = (((76 % 8) && (9 > 44)) - ((v3 <= a0[2]) + (99 >= 94)));
+        a0[14] = (((a0[9] <= a0[10]) ? (19 <= 68) : (v3 * a0[9])) <= ((v2 % 3) / 3));
+        a0[5] = (((v1 && v2) >= (a0[0] - v0)) * ((a1[3][11] > v0) == (29 + a0[12])));
+    } else {
+        v3 = (((v3 - v0) && (v1 ? 86 : 14)) && ((v2 < v2) - (v2 + v2)));
+        a0[5] = (((a1[0][11] || v2) * (v3 % 8)) != ((v0 + v3) != (20 % 1)));
+        a1[3][14] = (((a0[13] < 90) != (a1[2][11] > a1[1][15])) != ((v0 ? v0 : v0) * (a0[6] < v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                a1[2][0] = (((a1[1][3] == i1) % 4) ? ((v3 > v3) || (v0 <= 29)) : ((a1[3][8] / 8) || (i0 * 35)));
+                v0 = (((v0 * a0[9]) / 7) ? ((i1 >= 13) == (v0 ? v1 : 16)) : ((89 <= v1) ? (a1[2][4] % 7) : (a1[0][10] / 8)));
+                v3 = (((v2 != 20) && (i0 % 4)) < ((v1 != 25) * (a1[0][9] / 6)));
+            }
+            v0 = (((26 && 83) || (a0[10] - v3)) % 1);
+            a1[2][0] = (((31 < v1) <= (85 / 2)) % 1);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v1 < v2) % 1) == ((a0[5] != 54) && (i2 < 60)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                a1[3][1] = (((4 >= i2) > (a0[10] / 9)) < ((a0[12] + a1[3][6]) * (v1 + a1[0][14])));
+                v2 = (((v1 >= 39) >= (v2 || a0[14])) && ((i2 + 74) % 5));
+                v3 = (((a1[1][3] && v0) <= (v0 <= a1[2][7])) == ((v2 % 6) / 4));
+            }
+            v1 = (((38 * v1) ? (a1[3][8] || v0) : (a1[1][11] >= v0)) > ((a0[12] + v0) >= (v3 != 27)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a1[3][4] = (((v3 * v3) ? (81 || 23) : (a0[2] ? a0[7] : a0[0])) / 1);
+        v2 = (((v0 ? i4 : 88) + (v1 <= v2)) >= ((v1 || v2) * (v2 + i4)));
+        {
+            int i5 = 0;
+            while (i5 < 8) {
+                if ((v0 + 99) > 83) break;
+                v1 = (((v2 % 1) / 5) > ((i4 || i4) % 6));
+                v2 = (((v1 < 37) ? (v1 || v1) : (a1[3][12] == 30)) <= ((v3 > a1[1][3]) && (v2 ? 58 : 87)));
+                v3 = (((v0 / 1) || (49 >= a0[6])) > ((a0[9] <= i5) <= (i5 + v0)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v0 = (((v0 <= i6) == (v2 + 98)) ? ((a0[15] + 40) > (v1 % 1)) : ((16 - v0) < (a1[1][4] % 8)));
+            v0 = (((a0[4] == 64) == (v2 != 95)) ? ((a0[4] / 6) != (a0[8] ? a1[3][3] : 72)) : ((i6 || v2) != (i6 ? v2 : v1)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v2 = (((84 == v0) ? (v3 >= 91) : (v2 && a0[6])) < ((20 + 63) != (a0[8] && v1)));
+                    v0 = (((i7 <= i7) != (86 || 87)) || ((27 || a1[2][4]) && (v3 ? i7 : v1)));
+                    a0[14] = (((v1 / 3) != (i7 * i7)) ? ((v3 / 8) || (18 != a1[1][15])) : ((58 > 77) % 9));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[1][12] = (((a0[5] != a1[1][11]) < (v3 && v2)) >= ((v1 * v0) + (v0 || 89)));
+            v2 = (((45 != 9) == (v1 - a1[2][7])) || ((82 * a0[0]) + (33 && a1[1][8])));
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    if ((v3 >= a0[10]) > 78) break;
+                    a0[13] = (((71 == v1) || (v2 ? i9 : v1)) * ((v0 >= a0[1]) >= (i9 <= a0[9])));
+                    a0[13] = (((v3 + v0) && (i9 < v3)) < ((v2 == i9) ? (v1 + a0[7]) : (i8 ? 51 : a0[0])));
+                    v0 = (((i9 ? v1 : v3) > (i9 >= 15)) - ((a0[4] ? v1 : v2) == (v2 - v2)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        if ((a1[0][5] / 7) > 64) break;
+        a0[15] = (((v0 ? a0[7] : a1[1][8]) <= (45 % 6)) != ((a0[12] ? v3 : v1) ? (41 / 7) : (v0 - i10)));
+        v1 = (((v3 <= a1[1][13]) || (i10 || 16)) ? ((20 ? v1 : v1) * (53 / 4)) : ((v2 != v3) - (v1 - 38)));
+        for (int i11 = 0; i11 < 3; i11 = i11 + 1) {
+            if ((v1 && 70) > 98) break;
+            v1 = (((25 % 4) == (v0 * i10)) % 8);
+            v1 = (((a0[6] / 3) == (v2 ? 71 : v2)) % 8);
+            v2 = (((v0 % 3) >= (v3 < i10)) + ((66 / 3) || (v3 == 35)));
+        }
+    }
+    if ((((v0 * v3) < (v0 ? a1[1][14] : 40)) ? ((v0 % 2) % 2) : ((5 % 1) + (v3 || v0)))) {
+        v2 = (((v2 + a1[0][6]) == (v0 != 90)) == ((v1 > v1) / 1));
+        v2 = (((a0[2] % 3) % 6) && ((v1 && 13) ? (27 - a1[1][4]) : (11 ? a1[2][2] : a0[13])));
+        v3 = (((v3 - v3) % 2) <= ((92 && v0) >= (53 || v0)));
+    } else {
+        v1 = (((v0 != a1[3][4]) ? (v3 < 91) : (v2 * a0[14])) - ((a1[1][6] / 2) >= (a0[5] <= 39)));
+        v0 = (((a0[15] - a1[2][1]) < (v3 >= v3)) ? ((v3 <= 1) != (v3 - a0[0])) : ((45 > v1) + (9 ? a0[10] : 37)));
+        a0[14] = (((a1[3][10] >= v0) ? (v3 && v1) : (48 > v3)) != ((v0 - v3) <= (a0[14] / 7)));
+    }
+    return (((v3 ? a0[6] : a0[10]) == (a0[0] ? v3 : a1[0][3])) > ((9 != v3) > (a1[0][12] > 50)));
+}
+int f1() {
+    int v0 = 3;
+    int v1 = 33;
+    int v2 = 95;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((41 >= 80) * (v3 / 5)) - ((40 == 20) && (a0[9] * 79)));
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v2 == v3) || (96 >= v0)) - ((v2 / 7) - (44 / 3)));
+            a0[7] = (((12 <= v1) == (v1 - 56)) - ((i0 ? a1[0][2] : v0) != (54 ? v2 : a1[3][12])));
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[2][13] / 1) > 64) break;
+                    v3 = (((v0 && a0[9]) <= (57 != v0)) == ((i0 / 2) || (a1[0][1] >= a1[2][14])));
+                    v3 = (((a0[15] - a1[3][15]) % 6) != ((a0[4] - i1) == (i1 % 3)));
+                    v1 = (((79 == v1) ? (57 == 81) : (a0[14] ? a1[0][8] : v2)) < ((i1 * v3) % 6));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v2 = (((v1 || 83) ? (74 % 9) : (v0 / 6)) ? ((a1[3][4] - v2) || (i2 ? v0 : v2)) : ((40 % 7) + (v2 == v0)));
+        v3 = (((i2 * i2) == (76 - a1[0][13])) < ((v3 || v0) - (52 >= v1)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v1 = (((i3 * v1) ? (v2 <= a0[11]) : (49 * v2)) % 4);
+                v0 = (((49 / 5) < (a0[7] != a1[0][4])) || ((a1[2][4] > 71) * (43 < a0[4])));
+                v3 = (((i2 % 2) && (v2 >= v1)) + ((v0 - a1[2][7]) > (i2 * v1)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v0 = (((v1 + i4) - (v3 % 6)) <= ((v0 <= 9) * (i4 == v3)));
+        {
+            int i5 = 0;
+            do {
+                a1[3][14] = (((a1[3][2] / 6) * (v0 ? i5 : i4)) + ((5 > i5) || (v0 < 81)));
+                v2 = (((i4 >= a1[0][3]) && (0 - a1[0][12])) != ((a0[13] <= v1) <= (v1 && v1)));
+                v2 = (((i4 <= a1[2][15]) <= (a0[11] ? v3 : v3)) + ((v1 + i4) > (v1 && v2)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+        v0 = (((v0 != 32) > (29 * i4)) * ((74 / 9) ? (23 >= a0[3]) : (a0[12] < 44)));
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v2 = (((a1[0][10] % 2) ? (a1[2][2] && 37) : (62 < v2)) != ((v3 ? i6 : v2) / 2));
+        v3 = (((14 || a1[3][8]) <= (a1[0][5] && a0[2])) >= ((55 / 4) || (v1 == 10)));
+        {
+            int i7 = 0;
+            do {
+                a1[0][9] = (((18 * v0) != (i6 + a1[0][8])) * ((a0[9] > 6) % 6));
+                a1[1][11] = (((a0[4] % 8) || (v3 != v2)) - ((v3 && a1[1][9]) % 9));
+                v2 = (((a1[2][11] / 2) + (v0 / 5)) % 9);
+                i7 = i7 + 1;
+            } while (i7 < 8);
+        }
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        if ((a0[12] > a0[3]) > 95) break;
+        v3 = (((a1[0][13] != v3) > (v3 >= v3)) || ((a0[10] ? v0 : v0) != (20 * i8)));
+        v2 = (((v2 > v2) ? (i8 <= a0[14]) : (a0[2] < 30)) == ((a0[13] || v0) * (31 == v2)));
+        {
+            int i9 = 0;
+            do {
+                v3 = (((v2 - v3) < (14 && i8)) < ((i9 / 3) % 8));
+                v3 = (((a1[1][12] == a0[5]) - (a1[1][2] ? a1[2][11] : 61)) <= ((a0[5] > v1) == (v0 * a0[8])));
+                v3 = (((64 - i9) * (v3 / 1)) * ((a1[3][5] > v0) % 3));
+                i9 = i9 + 1;
+            } while (i9 < 2);
+        }
+    }
+    a0[14] = (((v1 > a1[1][10]) || (40 <= a0[14])) * ((47 + 68) == (a0[3] > v1)));
+    if ((((a0[4] != v3) == (v1 / 2)) == ((89 > 65) <= (21 < v0)))) {
+        v2 = (((v3 ? v0 : v2) + (v1 % 5)) || ((40 ? v0 : 74) + (v3 == v2)));
+        v1 = (((v0 <= 7) + (v0 ? v2 : v1)) ? ((6 >= a1[0][4]) - (v2 ? a0[5] : 83)) : ((a1[3][6] - v3) < (9 != v2)));
+        v1 = (((v3 + a1[2][8]) <= (v3 && a0[3])) || ((a1[2][14] < v0) + (v3 >= 71)));
+    } else {
+        v3 = (((v0 > 43) || (a1[0][15] * 40)) % 8);
+        v1 = (((v3 && 26) || (a0[1] || v0)) ? ((a1[2][4] ? 37 : 9) == (v0 - 77)) : ((v3 ? 16 : v3) > (a0[10] == v0)));
+        a1[0][15] = (((v0 + a1[3][15]) || (v2 / 9)) == ((a0[10] - 56) ? (82 / 2) : (60 % 2)));
+    }
+    v3 = (((61 >= 28) || (93 % 6)) * ((a0[13] * 60) <= (v1 || 26)));
+    a0[6] = (((64 <= 95) / 3) % 9);
+    return (((v0 > 52) != (v3 < 8)) > ((75 + a1[2][0]) + (v2 * a0[8])));
+}
+int f2() {
+    int v0 = 4;
+    int v1 = 45;
+    int v2 = 98;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a0[1] % 4) > (a0[13] <= v2)) && ((v2 % 3) / 5));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            v1 = (((a1[1][14] == 44) || (73 + 75)) == ((i0 < v3) >= (i1 != 64)));
+            a1[2][2] = (((v0 > a0[1]) >= (v0 * v3)) || ((v2 + i1) / 7));
+            v3 = (((69 >= i0) < (v2 / 2)) * ((v0 / 4) * (a0[13] != a1[3][5])));
+        }
+        v3 = (((3 - i0) + (40 < v3)) ? ((2 < 24) % 5) : ((a0[9] == v1) && (84 || a1[0][13])));
+        a0[4] = (((a1[1][3] % 9) + (a0[15] <= a1[1][15])) <= ((13 % 2) < (80 - a0[14])));
+    }
+    if ((((v2 + a0[9]) < (a1[3][2] ? v1 : 89)) * ((a0[11] + a0[6]) && (v1 ? 57 : v1)))) {
+        v1 = (((a1[0][10] || a0[10]) * (44 == 43)) ? ((v2 != 67) % 6) : ((84 || v1) + (79 ? 49 : v1)));
+        v3 = (((v1 == v1) <= (v2 > v2)) == ((v3 < v2) == (a0[15] && v3)));
+        a0[15] = (((a0[6] + v1) <= (a1[3][12] ? a1[0][2] : a0[6])) > ((a0[10] ? v3 : v2) / 6));
+    } else {
+        v1 = (((v0 % 9) <= (a1[1][7] < v3)) - ((v0 || v0) <= (v2 || v0)));
+        a0[9] = (((v3 + v0) ? (v0 != v0) : (v3 < v0)) / 1);
+        a1[2][14] = (((4 ? 9 : 64) ? (65 >= a0[11]) : (v3 == a0[10])) / 1);
+    }
+    if ((((v1 ? v3 : v2) ? (v2 || 70) : (v3 % 8)) < ((48 ? a0[14] : v0) + (41 ? a0[2] : 53)))) {
+        v2 = (((v0 <= a0[14]) % 2) && ((v1 / 3) % 9));
+        v3 = (((9 && a0[9]) % 4) > ((a0[7] || v3) >= (61 % 6)));
+        a0[3] = (((a0[14] >= a1[0][13]) && (60 ? a0[8] : v0)) == ((a1[2][15] + a0[3]) && (45 > v0)));
+    } else {
+        a0[3] = (((v2 >= v0) / 7) >= ((a0[1] + v3) / 9));
+        a0[12] = (((a1[3][8] > 38) * (v3 ? 21 : v1)) + ((37 ? 63 : a0[14]) || (v0 && v2)));
+        v1 = (((v0 || v1) * (v2 >= 29)) ? ((v1 != v3) != (86 % 2)) : ((a0[0] + a1[3][10]) - (v0 + v1)));
+    }
+    v1 = (((88 / 9) < (v1 - a1[0][14])) % 2);
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v3 = (((v2 <= 96) / 2) && ((i2 >= 18) == (a0[1] * 49)));
+        v0 = (((i2 < a1[1][1]) < (97 == 71)) >= ((a1[0][8] * 58) + (v1 + a0[4])));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            if ((v2 && i3) > 89) break;
+            a1[3][5] = (((34 / 1) / 5) ? ((91 <= v1) <= (7 != v2)) : ((a1[2][5] < 37) >= (v0 <= v1)));
+            v2 = (((20 < a1[0][11]) >= (34 < v3)) == ((v2 / 6) % 6));
+            a0[3] = (((a1[2][6] == 0) && (a0[12] ? v1 : 45)) + ((v3 >= i3) == (a1[2][3] < v3)));
+        }
+    }
+    if ((((a0[12] == v1) <= (v0 - 18)) < ((a1[3][7] != 87) <= (a0[3] - 72)))) {
+        v3 = (((v2 + a0[14]) * (v1 && v2)) <= ((a0[14] * v2) >= (20 != v1)));
+        v2 = (((v0 != a1[0][8]) < (v3 >= 29)) % 2);
+        v0 = (((76 % 9) != (v1 % 7)) < ((v1 % 3) || (a1[1][3] > v3)));
+    } else {
+        a1[3][6] = (((v0 % 9) <= (v3 / 6)) ? ((v1 == 3) <= (5 / 9)) : ((76 >= v3) && (v0 ? v0 : 28)));
+        v3 = (((a1[3][4] || a0[13]) - (84 > 77)) == ((a0[4] < 17) > (v1 <= v3)));
+        v3 = (((v2 == a1[0][14]) <= (56 / 9)) - ((a1[0][13] || v3) % 8));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[13] = (((i4 % 7) * (i4 > v0)) * ((v2 % 5) - (92 / 3)));
+            a0[6] = (((v2 % 4) ? (a0[15] != 91) : (v2 != a0[15])) < ((v1 < a0[8]) - (a0[13] + i4)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((21 || a1[0][6]) > 51) break;
+                    a0[1] = (((16 == a1[3][8]) / 9) ? ((40 <= a0[11]) ? (v2 && 66) : (v1 / 4)) : ((33 ? v1 : 34) || (a0[0] < v1)));
+                    a1[3][12] = (((64 + i5) / 2) > ((22 >= v0) ? (i5 == i4) : (v0 != v3)));
+                    v3 = (((a0[15] <= a1[3][12]) == (a1[3][4] < 50)) <= ((v1 % 6) / 5));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    a0[11] = (((a0[8] > v3) - (26 - v1)) && ((a0[2] / 7) * (v2 != a0[13])));
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        if ((i6 - i6) > 93) break;
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            if ((a0[1] == i6) > 55) break;
+            v2 = (((v0 ? v0 : a0[8]) || (i6 ? 84 : a1[3][11])) ? ((36 != i6) * (v0 && v1)) : ((81 <= v1) > (v2 / 5)));
+            v2 = (((v2 * i7) ? (v2 - v2) : (i6 ? a1[1][5] : v2)) * ((v1 + i6) ? (82 ? 85 : 96) : (80 >= v0)));
+            a0[4] = (((v2 ? v2 : i6) != (v1 || v1)) < ((a0[11] ? v3 : 97) > (i7 >= a0[0])));
+        }
+        v3 = (((89 < v2) + (v3 == v2)) || ((71 ? 37 : v2) || (30 / 9)));
+        v2 = (((v0 - a1[2][14]) == (v3 || a0[12])) < ((v3 > 86) ? (23 ? a0[6] : i6) : (i6 >= v3)));
+    }
+    return (((97 / 3) / 3) - ((v0 ? a0[6] : v1) % 1));
+}
+int f3() {
+    int v0 = 82;
+    int v1 = 27;
+    int v2 = 2;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[15] != v1) ? (v0 >= v0) : (97 < a1[3][2])) > ((v1 / 9) || (10 <= a0[5])))) {
+        v0 = (((13 ? 36 : v2) % 7) ? ((17 % 4) != (a1[2][10] / 4)) : ((v3 && v0) <= (a1[3][8] * 58)));
+        v1 = (((a0[2] - v2) + (v0 / 1)) <= ((v0 == v2) ? (21 ? a1[2][0] : 19) : (v3 % 3)));
+        v3 = (((85 && 18) && (v2 ? v2 : 9)) ? ((v0 + a0[14]) * (v1 ? v0 : a1[3][10])) : ((a1[2][4] < 61) - (v1 == v0)));
+    } else {
+        v0 = (((v2 ? a1[3][1] : v0) + (v0 ? 41 : v1)) + ((a0[5] < v1) == (a0[11] < v0)));
+        v1 = (((v3 == a0[11]) > (v1 < 10)) || ((a1[2][1] >= v1) || (a0[14] ? v2 : v1)));
+        a1[0][8] = (((21 + 19) + (56 || a1[1][12])) * ((11 <= a1[0][10]) / 2));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v0 = (((v2 != v2) - (49 + v0)) <= ((v1 != 11) ? (54 < a0[3]) : (v2 * v2)));
+        v2 = (((a0[12] - 89) / 8) * ((v0 ? v0 : a0[8]) > (a0[13] != 23)));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                v0 = (((v0 * 5) * (82 * 34)) < ((v3 == v2) || (a1[3][7] * i0)));
+                v3 = (((i1 + 46) == (v2 ? a1[3][2] : v2)) / 9);
+                v0 = (((v0 * i1) || (a1[3][14] % 1)) > ((a1[3][12] && a0[14]) >= (i0 % 1)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((a0[11] % 1) > 79) break;
+            a1[1][10] = (((v0 && 34) >= (i2 ? i2 : i2)) + ((a1[1][2] == a1[2][14]) ? (60 > v0) : (v3 <= v2)));
+            v1 = (((v3 != i2) == (v3 / 6)) > ((v2 < v0) == (60 ? 11 : a0[11])));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v0 = (((a1[1][10] ? 54 : a0[12]) ? (v2 || 16) : (v2 - v0)) == ((v3 > a0[5]) && (v3 || a0[12])));
+                    v1 = (((73 / 9) ? (a1[3][5] == i3) : (v2 ? v1 : v3)) || ((v0 + 12) ? (v0 % 4) : (a0[12] + a1[2][3])));
+                    v3 = (((v0 != v2) == (i3 - a0[4])) ? ((v2 < a1[0][1]) != (i2 == v1)) : ((a0[8] / 1) % 3));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((33 == a0[11]) && (v0 * v3)) / 2)) {
+        v1 = (((v2 - v1) % 1) + ((v1 && v2) || (v3 && 27)));
+        v3 = (((50 + a1[0][4]) || (v3 < a0[0])) % 8);
+        a1[1][12] = (((95 ? 39 : v0) != (v2 != a1[3][11])) % 9);
+    } else {
+        v3 = (((v0 == a0[0]) ? (v3 / 2) : (v2 ? a0[4] : v1)) ? ((51 % 4) == (a1[3][7] < a1[3][8])) : ((80 / 6) - (v1 == 96)));
+        v3 = (((a0[1] * v0) >= (14 != a0[13])) >= ((v0 ? a1[0][10] : v3) == (v1 != a1[2][12])));
+        a0[8] = (((a0[6] && a1[1][1]) % 5) - ((a0[3] * v2) * (v0 || a0[0])));
+    }
+    a0[14] = (((v3 % 3) * (v1 + v0)) > ((a0[12] && v0) != (19 < v2)));
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        if ((a1[2][8] == 50) > 87) break;
+        a0[9] = (((v1 || 51) % 5) % 8);
+        a0[0] = (((a1[3][13] || 91) % 3) / 3);
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                v3 = (((a0[14] ? a1[0][3] : v0) != (v1 && 60)) / 3);
+                v2 = (((i5 - a1[0][0]) < (87 > i4)) ? ((56 && i4) ? (v0 * i5) : (28 + 71)) : ((v2 / 8) / 8));
+                v3 = (((a1[1][3] / 6) ? (i4 || v1) : (i5 == i5)) <= ((64 ? v1 : 92) && (18 * a1[3][12])));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    if ((((v0 % 7) % 1) && ((83 - 97) + (v0 != 80)))) {
+        a1[2][7] = (((22 - 71) % 2) <= ((a1[1][5] >= v3) && (v2 >= v2)));
+        v1 = (((80 >= v1) ? (v2 > 7) : (v2 < 38)) > ((v0 != v0) == (v1 ? v1 : v2)));
+        v0 = (((a1[0][10] % 4) / 2) ? ((18 / 3) > (v1 - v3)) : ((94 * v0) + (77 != 95)));
+    } else {
+        v3 = (((a0[13] >= a1[1][2]) / 5) <= ((76 + v0) != (v2 < 94)));
+        v3 = (((a1[0][7] > 81) % 6) >= ((a1[2][10] != 19) <= (v0 - a0[7])));
+        v3 = (((a1[1][3] - 27) ? (10 == v1) : (a1[1][15] && v0)) || ((v2 + v0) % 9));
+    }
+    if ((((74 == v0) <= (79 / 3)) > ((8 < a0[8]) / 9))) {
+        v2 = (((35 || v2) && (v2 < a0[6])) - ((a1[1][13] - 77) + (a1[2][1] * a0[0])));
+        a0[13] = (((v2 > a0[0]) != (v0 >= a1[3][3])) ? ((v1 ? v0 : 27) ? (a1[2][1] * a0[11]) : (v0 ? 74 : v0)) : ((v2 ? v1 : v2) && (86 + a0[2])));
+        a1[3][15] = (((v0 != 91) > (v1 % 1)) ? ((v1 != v0) / 6) : ((a1[1][15] / 7) || (17 && a0[4])));
+    } else {
+        a1[3][9] = (((17 ? v0 : a1[1][6]) > (v2 == a1[0][6])) && ((85 - v2) != (9 - a1[0][6])));
+        a1[2][8] = (((a1[1][13] != v3) * (a0[4] * v0)) && ((v3 == 19) / 1));
+        v1 = (((v1 - v3) + (a1[1][7] + v1)) <= ((a0[2] <= a1[3][11]) / 2));
+    }
+    if ((((a0[15] <= 7) - (v1 * v0)) + ((v3 <= a1[1][2]) % 6))) {
+        a0[2] = (((62 ? a1[0][15] : a1[2][3]) ? (17 == 88) : (a1[1][6] && a1[1][4])) > ((94 % 6) || (v1 ? 99 : v2)));
+        a1[1][1] = (((a0[2] ? v1 : v2) == (v2 <= 55)) ? ((v0 || a0[13]) % 6) : ((a1[1][15] <= v1) == (30 % 8)));
+        v2 = (((a0[11] / 4) || (27 / 6)) % 4);
+    } else {
+        v1 = (((v0 - v0) / 8) == ((v2 - v1) % 3));
+        a0[7] = (((v2 / 4) < (a1[2][10] / 4)) != ((24 * v1) ? (85 >= a0[13]) : (83 ? v0 : a0[3])));
+        a1[1][14] = (((88 == 47) / 7) > ((v1 + a1[1][6]) / 3));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((55 < v2) > 72) break;
+            a0[1] = (((17 || a1[3][6]) > (v0 ? 51 : v0)) || ((v3 - 5) || (i6 < v1)));
+            v1 = (((a0[3] + 12) && (v0 % 8)) || ((v3 < a1[3][13]) / 7));
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    a1[2][11] = (((68 ? a1[2][14] : 35) >= (v2 >= a0[5])) % 2);
+                    v1 = (((30 < a1[1][1]) >= (i7 <= v1)) && ((34 && v3) + (92 == a1[1][7])));
+                    v1 = (((46 - i6) * (a0[9] * a0[2])) ? ((65 ? a0[11] : 85) / 7) : ((i7 ? a0[13] : 8) % 2));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((86 + 65) % 1) ? ((v1 || v2) < (a1[2][2] != v1)) : ((v0 < 38) * (21 <= v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,243 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 92;
+    int v2 = 21;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((a0[7] < a0[10]) && (v3 ? 40 : v2)) < ((79 <= 2) ? (v1 - 27) : (v2 >= v0)));
+    if ((((a1[3][3] >= v0) != (60 ? v1 : 50)) * ((v1 <= 1) && (95 < a0[3])))) {
+        v3 = (((a1[3][4] != a1[2][9]) % 8) / 3);
+        v3 = (((v1 <= v3) == (80 == v1)) != ((v2 == 61) && (v3 / 7)));
+        a0[5] = (((v3 > a0[7]) - (52 + a0[6])) % 5);
+    } else {
+        v0 = (((v3 && 92) <= (a0[0] / 1)) <= ((v0 > v2) > (a1[2][10] >= a1[1][6])));
+        v0 = (((v3 > 41) % 2) ? ((v1 == a0[15]) ? (v1 && 81) : (a1[2][11] != 75)) : ((v1 % 1) <= (v0 != v2)));
+        a1[3][1] = (((a0[4] != v1) % 4) || ((55 * v1) % 9));
+    }
+    a0[2] = (((8 / 9) % 8) ? ((73 && v3) || (7 != v0)) : ((74 <= 96) ? (25 % 8) : (a0[1] && v3)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v1 = (((20 + a0[11]) < (a0[10] && 47)) < ((v0 + v3) != (a1[1][13] >= v3)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v0 = (((v1 == a1[2][14]) && (4 * v0)) == ((a0[4] % 9) && (37 < 24)));
+                v2 = (((i0 || v3) < (a1[3][5] >= i1)) / 7);
+                v0 = (((i1 < 54) * (i1 >= 42)) >= ((i0 ? v2 : a1[0][7]) * (v1 <= a1[3][4])));
+            }
+            a1[2][2] = (((64 > a0[11]) / 2) + ((v3 < 36) ? (v1 % 9) : (i0 == a1[1][14])));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((0 + 36) - (v0 * v1)) <= ((a0[0] || v3) + (2 || 2)));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            if ((55 ? a0[6] : v1) > 94) break;
+            {
+                int i3 = 0;
+                do {
+                    a0[10] = (((a1[0][8] / 2) == (a1[3][3] > v0)) != ((v0 >= a1[2][7]) < (a1[2][15] ? a0[0] : i2)));
+                    v0 = (((v1 ? i2 : v2) == (13 * 8)) + ((21 > i2) >= (58 ? v0 : v0)));
+                    v2 = (((84 - v1) != (a1[1][6] == 12)) == ((i3 + v1) + (30 <= v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v2 = (((12 != v3) ? (23 ? v3 : a0[14]) : (v2 == v2)) - ((i2 % 8) % 6));
+            v2 = (((a0[1] == v0) % 2) > ((56 != v1) ? (v3 == a1[1][6]) : (a0[4] != i2)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        a1[2][3] = (((v3 ? v1 : a0[9]) * (28 / 9)) - ((17 <= v3) + (v2 >= a0[8])));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v3 = (((a1[3][9] || v2) % 7) % 4);
+            v3 = (((a1[3][5] < v0) ? (v3 + 1) : (54 * v2)) >= ((a0[7] == 26) - (a0[4] ? a0[12] : v0)));
+            a1[2][8] = (((a0[13] + v0) >= (78 && v1)) ? ((22 % 1) ? (v1 != v1) : (i4 || a0[3])) : ((v3 || i4) * (v1 != 47)));
+        }
+        v1 = (((a0[4] > v0) / 6) / 3);
+    }
+    if ((((a0[6] < a1[3][4]) >= (v3 ? v0 : v3)) != ((64 ? v1 : 46) % 3))) {
+        a1[3][2] = (((a1[0][0] * v3) % 8) >= ((a0[11] - 46) == (a0[7] ? a0[13] : a1[1][3])));
+        v1 = (((98 && 1) - (v0 != v0)) == ((42 && a0[12]) <= (v0 >= v0)));
+        v3 = (((a0[5] >= 82) * (21 ? v3 : a1[3][15])) >= ((v1 - v1) < (v3 + a1[3][6])));
+    } else {
+        a0[7] = (((a1[0][4] ? 17 : a0[0]) / 3) == ((a1[3][0] - a0[10]) % 6));
+        a0[5] = (((v0 >= a0[9]) * (a0[14] <= 14)) + ((39 < v1) < (a0[8] >= v0)));
+        a0[2] = (((v1 > v2) / 2) % 9);
+    }
+    a0[0] = (((v0 ? 96 : 93) != (v1 && v0)) * ((a1[3][11] && a0[8]) >= (90 + v0)));
+    {
+        int i6 = 0;
+        do {
+            v3 = (((87 / 9) == (v3 && 80)) ? ((a1[3][10] || v3) % 6) : ((v2 < v1) >= (a0[6] && a1[3][10])));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    v1 = (((44 ? v3 : a1[1][7]) ? (a1[2][2] != v0) : (a1[2][12] < a0[15])) >= ((a1[1][8] % 9) > (63 > v2)));
+                    a0[1] = (((a0[0] % 6) % 2) && ((v3 ? v0 : a1[3][1]) / 3));
+                    v1 = (((v3 / 8) == (a0[10] * 60)) - ((a1[3][8] - v0) ? (v1 + 95) : (a1[3][10] ? 54 : a1[1][10])));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((2 <= a1[2][12]) == (i6 % 3)) || ((a0[0] * 59) <= (a1[3][8] != 22)));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    return (((v1 - v1) == (v1 + a1[2][4])) < ((v1 % 1) ? (83 / 5) : (v3 % 9)));
+}
+int f1() {
+    int v0 = 38;
+    int v1 = 93;
+    int v2 = 85;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    if ((((25 != v3) || (a0[15] / 9)) <= ((v0 || v2) != (v0 > v0)))) {
+        v0 = (((a0[14] * 69) / 8) != ((v2 < v0) > (v1 <= 18)));
+        v1 = (((v0 && v2) == (v0 ? v3 : v3)) % 5);
+        a1[1][5] = (((v0 == a0[5]) ? (88 / 4) : (82 * v1)) - ((v1 != v2) / 5));
+    } else {
+        a1[3][11] = (((v2 % 3) - (v2 * a1[2][7])) > ((v3 + v3) || (8 > 38)));
+        v1 = (((v0 < v1) ? (v2 + a1[0][3]) : (64 == v3)) < ((v2 >= 67) % 7));
+        a0[8] = (((20 != 86) && (16 % 4)) <= ((v1 || a1[3][8]) != (a1[0][9] ? 14 : v3)));
+    }
+    a0[12] = (((65 != 41) != (v3 && v1)) * ((v1 != v2) % 5));
+    if ((((v1 ? v1 : 93) || (v3 >= v2)) - ((v0 >= v1) <= (a1[1][9] + v1)))) {
+        v2 = (((a0[1] == v0) ? (v0 * v2) : (94 ? v0 : 70)) ? ((v2 < a0[15]) - (a0[13] || v0)) : ((92 ? v0 : 97) == (a1[3][4] % 4)));
+        a1[0][0] = (((v1 * v3) < (v1 + a0[11])) == ((v3 % 3) && (84 || a1[0][5])));
+        v3 = (((a0[14] / 5) / 6) != ((97 ? 54 : a0[1]) == (v1 ? 90 : a0[6])));
+    } else {
+        v1 = (((a1[3][5] || v0) + (v2 || 71)) >= ((a1[1][14] != v3) / 6));
+        a1[3][7] = (((v0 < v0) != (v1 % 6)) ? ((18 + v2) >= (5 < 0)) : ((v0 >= 30) || (a1[3][6] <= v0)));
+        v0 = (((v1 > 39) - (a0[7] == 41)) ? ((v0 == a1[1][3]) > (v1 || v3)) : ((81 && 74) <= (v3 != v0)));
+    }
+    v2 = (((v0 / 5) * (a1[2][10] ? v1 : 69)) - ((74 > 26) != (v3 ? 8 : 14)));
+    if ((((a1[3][6] && a1[1][14]) % 9) + ((72 <= 25) && (v1 * a0[10])))) {
+        v2 = (((5 * 3) < (v0 ? v1 : a1[1][10])) != ((72 || v1) == (67 != v2)));
+        v3 = (((71 != a0[0]) != (a0[1] / 1)) >= ((74 != 91) >= (v3 && v1)));
+        v2 = (((a0[10] % 9) >= (v0 < v0)) || ((v0 != v2) % 2));
+    } else {
+        a0[7] = (((v2 ? a1[1][5] : v0) <= (v1 || 38)) < ((a1[1][4] == v2) && (a0[11] + 37)));
+        v2 = (((35 * 47) == (v2 ? a1[1][9] : a0[4])) ? ((v3 + a0[15]) >= (37 ? v2 : 49)) : ((46 || v1) % 3));
+        a1[2][12] = (((63 < a1[1][8]) > (v1 + 16)) < ((58 <= 57) - (v0 * a1[1][0])));
+    }
+    v2 = (((a0[9] > 41) == (a0[11] < a1[2][7])) != ((v0 == v3) >= (39 % 1)));
+    {
+        int i0 = 0;
+        do {
+            a1[0][14] = (((22 <= 35) == (i0 + a0[2])) && ((a1[1][13] < v2) == (v1 == v2)));
+            v2 = (((37 < a0[1]) && (a0[9] % 8)) < ((10 <= v3) - (v3 > 8)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((a0[14] <= v1) > 64) break;
+                    v2 = (((7 % 4) <= (v1 * i1)) || ((v0 * 4) < (v0 <= i1)));
+                    v2 = (((a0[5] > a1[0][2]) - (a1[1][0] % 2)) > ((v3 != a1[0][8]) % 3));
+                    a1[1][3] = (((45 || v1) - (11 % 6)) != ((v1 != 69) > (a0[14] * i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v3 = (((73 < v2) % 7) * ((13 * a0[4]) != (79 < a1[2][11])));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a0[6] = (((v2 ? i2 : v0) % 6) && ((v0 % 7) != (83 <= i2)));
+                v1 = (((v1 < 40) / 5) <= ((v1 && v1) % 8));
+                v1 = (((v0 + v3) > (i3 / 9)) - ((12 >= i2) <= (i3 ? a0[8] : a0[15])));
+            }
+            a1[1][10] = (((a1[2][4] && v3) ? (33 <= a1[2][2]) : (a0[12] != v1)) ? ((45 / 1) - (i2 * 86)) : ((v3 ? a0[7] : i2) ? (v1 != i2) : (v2 != v2)));
+            i2 = i2 + 1;
+        }
+    }
+    a0[15] = (((78 <= v2) <= (47 == a0[3])) > ((v1 > 0) <= (v3 == v0)));
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                a1[1][14] = (((v3 == v2) || (i4 == v0)) + ((v2 == i5) % 1));
+                v0 = (((i4 <= 91) / 1) * ((20 + a0[6]) < (9 ? v3 : a0[11])));
+                a0[0] = (((v3 < v1) != (a1[3][11] + 88)) - ((v1 == v0) > (a0[7] ? 31 : i5)));
+            }
+            v1 = (((v3 != v0) + (i4 + a1[1][2])) / 1);
+            a1[3][5] = (((58 % 3) == (96 || v0)) >= ((a0[0] > a0[2]) + (v3 % 7)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    return (((41 < v3) && (a1[3][1] && v2)) * ((11 != a1[1][0]) * (v2 - 74)));
+}
+int f2() {
+    int v0 = 79;
+    int v1 = 73;
+    int v2 = 26;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    if ((((91 <= a0[9]) % 9) || ((a0[8] < v0) < (v2 - 95)))) {
+        v3 = (((v2 % 2) || (v3 && a0[2])) * ((v2 % 3) / 6));
+        a1[0][3] = (((v1 != v2) == (82 || v2)) || ((v2 && 73) + (73 ? 71 : v3)));
+        v1 = (((95 % 7) % 6) || ((v0 + v3) < (6 != v1)));
+    } else {
+        a1[2][10] = (((v3 * a0[11]) - (a1[0][12] % 5)) % 9);
+        v2 = (((v0 != a1[2][12]) == (91 < a0[4])) && ((v2 * v0) + (v2 <= a1[1][4])));
+        v2 = (((a1[1][12] ? a1[2][4] : v3) != (78 * a1[0][12])) > ((a0[3] == 27) <= (93 && 89)));
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v0 = (((a0[3] >= a0[13]) ? (i0 + v2) : (a1[2][1] >= v1)) <= ((v0 * v1) ? (v1 > i0) : (97 < 65)));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v0 = (((v2 - 86) ? (99 != v0) : (i0 + a1[3][13])) / 5);
+                a1[0][1] = (((i1 && a1[3][3]) ? (a0[0] - 41) : (v3 * 8)) < ((28 + v2) || (v3 / 1)));
+                a1[1][10] = (((a1[3][10] ? v1 : v0) > (38 >= v1)) - ((49 >= v2) ? (i1 * a0[3]) : (v0 % 6)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[1][13] = (((97 != v1) < (11 || 58)) ? ((a1[0][0] * a0[3]) == (42 && a0[12])) : ((a0[1] != v1) == (v3 + 39)));
+    }
+    a1[3][9] = (((v2 ? 69 : a0[13]) || (a1[2][1] <= a1[1][1])) == ((a1[1][0] - a1[0][14]) && (a0[9] < v2)));
+    a1[1][1] = (((a1[0][12] != a1[0][8]) >= (v0 ? a0[14] : v0)) ? ((55 <= v3) / 2) : ((v1 && 44) ? (62 ? a0[1] : v1) : (a1[0][12] >= a0[7])));
+    a0[6] = (((75 > v0) + (58 ? v2 : a0[10])) < ((a0[13] * 83) > (41 && 50)));
+    if ((((55 >= v3) % 2) ? ((v0 < a1[0][8]) > (v0 * 74)) : ((a0[3] < v0) != (a0[6] != v2)))) {
+        v1 = (((v2 - v3) && (a1[1][5] < 28)) <= ((v3 == v0) || (v2 > 18)));
+        v0 = (((v0 != v2) > (v0 != v0)) != ((a1[2][2] % 2) - (93 ? a1[3][3] : v2)));
+        a1[2][3] = (((9 * 87) == (v0 > v2)) <= ((v2 < a1[1][3]) <= (v2 <= v2)));
+    } else {
+        v3 = (((a1[0][3] ? a0[9] : a1[2][7]) != (v2 % 1)) - ((75 / 8) <= (45 != v0)));
+        v0 = (((a1[0][13] * a1[2][0]) ? (24 + a1[0][9]) : (72 * v1)) >= ((v2 < v2) > (a0[0] && v1)));
+        v3 = (((v2 - a0[15]) >= (v1 * v1)) + ((46 && a0[1]) <= (v3 ? a0[5] : v3)));
+    }
+    v2 = (((72 % 1) * (a0[7] <= a1[0][1])) == ((v2 == 91) && (a1[3][7] % 6)));
+    if ((((v0 >= v1) ? (v2 > a0[12]) : (11 + v0)) ? ((v1 || v0) >= (70 ? a0[6] : v1)) : ((v1 + v0) && (11 && v1)))) {
+        v1 = (((a0[5] && v2) > (v1 == v2)) % 3);
+        a0[13] = (((a1[2][13] / 6) ? (a0[7] / 2) : (76 * v0)) / 7);
+        a1[2][7] = (((a1[3][3] % 1) != (10 && v1)) >= ((a0[9] > v0) % 5));
+    } else {
+        v0 = (((a0[1] != v2) + (35 ? v2 : a1[3][1])) / 9);
+        v3 = (((v0 < 69) || (v2 ? 14 : v3)) < ((v1 * a0[5]) >= (a0[1] >= 16)));
+        v3 = (((21 < v3) < (v1 < v1)) >= ((v1 ? a0[6] : v1) != (a1[2][13] || a1[1][8])));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((a0[2] || 87) > 90) break;
+        v0 = (((v0 * v2) || (a0[15] ? i2 : i2)) + ((v1 + v0) / 2));
+        v1 = (((6 * 17) + (i2 - a1[3][5])) ? ((v3 || a0[7]) == (v3 >= v2)) : ((a0[7] / 6) % 1));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v2 = (((v2 == i2) <= (25 < i2)) <= ((a0[13] <= v1) != (a1[1][5] > a1[0][6])));
+            a0[10] = (((v0 < 13) <= (a0[13] <= a1[2][4])) % 2);
+            v3 = (((a1[2][7] <= a0[13]) % 5) * ((39 * v3) + (50 > a1[2][11])));
+        }
+    }
+    v3 = (((v3 + 72) != (v1 / 7)) ? ((41 ? 72 : v3) == (a0[11] ? v0 : a1[0][12])) : ((a0[14] == 35) && (9 ? a1[3][15] : v2)));
+    return (((47 ? a0[13] : v2) && (33 == v1)) && ((80 == v2) != (92 % 5)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
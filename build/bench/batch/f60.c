@@ -0,0 +1,113 @@
+int f0() {
+    int v0 = 11;
+    int v1 = 6;
+    int v2 = 70;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[1][13] >= 35) != (v1 ? v0 : a0[3])) == ((a0[8] <= a0[3]) % 2));
+    if ((((a0[5] && 74) * (v1 / 4)) == ((a0[4] % 3) && (v2 % 4)))) {
+        v3 = (((v3 ? a1[3][14] : 0) / 4) * ((a1[2][10] > v0) >= (90 == v3)));
+        v2 = (((47 ? a0[13] : v0) ? (96 + v2) : (a0[6] <= a0[13])) <= ((v3 * v3) != (v3 && a0[9])));
+        v2 = (((v0 == a1[1][4]) || (69 - a0[15])) < ((v0 * 62) + (v0 ? v0 : 10)));
+    } else {
+        a0[2] = (((86 / 5) - (44 == v0)) || ((v0 >= v3) ? (v0 != 28) : (33 < v2)));
+        v1 = (((77 + a0[8]) + (65 && v2)) * ((v2 <= v3) ? (v2 ? 75 : v1) : (81 + v3)));
+        a1[0][2] = (((53 + v3) == (v0 || v3)) < ((v2 ? v1 : a0[12]) || (97 - 21)));
+    }
+    a1[3][6] = (((88 + v3) * (a0[6] - 74)) - ((a1[0][1] > v0) ? (98 != v3) : (v3 ? v1 : 38)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((3 == 25) || (36 / 5)) && ((v0 != v3) != (a1[0][0] < a0[15])));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v1 = (((v3 < v0) ? (v3 == i1) : (a1[1][0] * v3)) <= ((a0[14] % 1) - (a1[2][15] || v3)));
+                    v2 = (((i0 < a1[0][9]) < (47 > a1[0][5])) == ((a0[6] ? a1[0][11] : i0) && (53 < a0[13])));
+                    v0 = (((v2 && i0) % 8) - ((v0 <= a0[1]) % 6));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v2 / 7) - (12 % 4)) || ((24 % 1) ? (a1[3][4] / 5) : (a1[2][5] || a1[1][13])));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((v3 * 32) == (v0 % 7)) > ((v0 <= v0) == (63 - v0)))) {
+        a0[4] = (((a0[7] % 7) <= (v3 - 63)) > ((v3 < v2) * (v3 % 3)));
+        a1[3][6] = (((a0[2] || a1[1][3]) <= (v0 < 50)) / 8);
+        a0[9] = (((52 == v0) < (v0 / 1)) >= ((v2 == v0) * (v0 > v1)));
+    } else {
+        v3 = (((v3 <= a1[3][6]) - (a0[5] < a0[14])) % 2);
+        v2 = (((v2 <= a0[9]) ? (4 < 3) : (v0 != v0)) ? ((v3 && a1[0][0]) ? (63 / 3) : (v1 < v2)) : ((37 != v1) % 3));
+        v0 = (((v3 < v0) != (v1 && a1[1][6])) * ((v0 || v3) > (a1[3][15] * 31)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v3 ? v1 : 38) > 97) break;
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            a1[3][9] = (((v2 % 6) || (a0[4] != v3)) < ((a0[1] >= a0[10]) && (i2 % 5)));
+            v1 = (((64 || v3) && (v3 > i2)) - ((v0 && v3) <= (v2 < v1)));
+            v1 = (((i3 ? v2 : a0[9]) % 6) || ((a0[10] - i3) % 9));
+        }
+        a1[3][2] = (((65 - v0) - (79 <= v2)) * ((25 / 8) % 1));
+        a0[0] = (((59 ? a1[3][8] : a0[0]) || (v3 != v1)) % 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[0][2] = (((v1 == 45) + (v1 <= 11)) ? ((93 && a0[12]) <= (a1[0][6] >= a1[2][13])) : ((v2 / 1) > (v3 == v0)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v2 = (((a1[0][15] / 8) >= (43 && i4)) >= ((v0 <= i4) / 2));
+                    v0 = (((44 / 2) <= (a1[1][15] <= 65)) <= ((v0 + i4) % 3));
+                    v2 = (((i4 ? v1 : i5) < (a0[14] <= v0)) > ((v3 && a0[13]) > (78 - 88)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[3][5] = (((66 + a0[11]) ? (56 <= v2) : (36 < a0[13])) <= ((v0 + v2) != (74 * a0[12])));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        do {
+            v2 = (((a0[9] > v2) > (a1[0][3] - 51)) % 1);
+            v1 = (((a1[3][15] * 82) % 3) && ((45 + 18) % 1));
+            {
+                int i7 = 0;
+                do {
+                    a0[0] = (((42 == i7) > (a0[7] >= a0[4])) % 8);
+                    a0[10] = (((i7 + v3) != (i6 && a1[3][11])) < ((v1 == i7) ? (v1 || 83) : (v2 * a1[2][9])));
+                    a0[3] = (((v3 / 4) > (v3 + a0[14])) == ((a1[2][6] % 4) ? (37 != a1[1][14]) : (v3 * 89)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    if ((((a0[14] <= 92) == (a0[1] > v2)) > ((54 ? v1 : v3) * (a0[8] <= 28)))) {
+        a1[0][4] = (((42 % 8) * (a0[10] - v0)) + ((v1 ? a0[15] : a1[0][12]) <= (a1[0][6] + v3)));
+        v1 = (((14 > 32) != (v3 >= v1)) >= ((84 || 75) ? (42 >= v3) : (v3 <= v3)));
+        v2 = (((89 <= v2) || (v2 > v1)) && ((a0[5] / 2) < (v1 != v3)));
+    } else {
+        v3 = (((a0[11] % 6) <= (v2 <= 58)) >= ((v3 == v3) && (v3 < 18)));
+        a0[4] = (((27 <= v1) ? (v2 - 31) : (a1[0][5] <= v0)) > ((v3 <= v2) ? (v1 * a0[7]) : (v1 && v3)));
+        v3 = (((91 / 8) - (v1 <= v3)) ? ((v0 < 86) / 7) : ((v1 >= a0[1]) == (48 + a0[3])));
+    }
+    if ((((a0[2] && v0) * (v2 ? v1 : v0)) - ((v2 || a1[2][11]) < (1 + v3)))) {
+        a1[1][12] = (((a1[2][4] % 7) ? (v1 && v2) : (1 || v0)) == ((69 || v3) >= (95 % 4)));
+        v2 = (((v1 < a1[3][1]) ? (12 % 9) : (35 + v2)) == ((v3 != v3) < (24 * v0)));
+        v0 = (((a0[0] == a0[14]) != (79 != 93)) == ((v3 >= 21) != (v0 || v3)));
+    } else {
+        v1 = (((v0 > a0[12]) == (v3 ? v2 : 76)) > ((v1 > v0) / 3));
+        a1[1][10] = (((v1 > v0) - (v1 % 9)) * ((v3 > 8) ? (a1[1][9] <= v0) : (50 * 65)));
+        v3 = (((v0 < v0) ? (v0 > v1) : (a1[2][2] != v3)) != ((65 != v0) && (v2 % 3)));
+    }
+    return (((69 % 8) <= (v2 >= 17)) && ((v3 == v1) == (a0[2] >= v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,172 @@
+int f0() {
+    int v0 = 78;
+    int v1 = 24;
+    int v2 = 53;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    a1[2][5] = (((10 / 4) && (a0[3] % 1)) % 6);
+    if ((((24 / 3) <= (87 >= 47)) ? ((a1[1][6] * v1) - (75 ? a1[3][5] : a1[3][3])) : ((a1[0][7] ? v1 : a1[0][1]) >= (23 && 48)))) {
+        a1[1][14] = (((a1[2][7] * a1[0][5]) <= (v0 % 2)) ? ((v2 > v2) <= (a1[2][10] < v1)) : ((v0 == v0) != (v0 != v0)));
+        v2 = (((v1 % 5) <= (a1[3][7] * v0)) ? ((50 < a1[1][4]) < (a1[0][12] == 90)) : ((v2 >= a1[2][2]) && (v2 && a1[3][1])));
+        a1[3][5] = (((v3 * 19) % 6) - ((v0 / 9) <= (v0 && v0)));
+    } else {
+        v1 = (((79 < v3) && (v3 % 4)) - ((v3 == a0[1]) % 8));
+        a0[1] = (((v1 == v0) == (a0[7] >= a1[2][6])) ? ((a0[12] ? a0[4] : a0[1]) + (a0[11] >= a0[7])) : ((v2 == v2) ? (v2 <= v2) : (v3 || 28)));
+        v1 = (((a0[5] / 6) < (v1 >= 65)) == ((v0 < v0) || (v0 || 56)));
+    }
+    if ((((63 <= 53) % 9) < ((a0[8] >= 9) <= (a1[3][2] - a0[12])))) {
+        v3 = (((a1[2][12] ? a1[2][5] : a1[2][1]) > (95 - v0)) != ((v2 || a0[8]) >= (v2 && a1[1][1])));
+        v2 = (((v0 / 3) <= (79 && v1)) ? ((40 > v3) ? (a1[2][8] + v2) : (49 == a0[15])) : ((v0 || 38) < (96 + v0)));
+        v3 = (((a1[1][12] >= v0) || (v0 % 9)) - ((70 >= a0[2]) + (a1[3][11] + v1)));
+    } else {
+        v2 = (((v1 || 9) * (v0 == v0)) ? ((a0[2] % 3) % 3) : ((v2 - v3) != (a0[15] == a0[9])));
+        v0 = (((v2 ? v3 : a0[6]) ? (25 || 59) : (v1 >= 8)) != ((v1 > v2) > (v0 < 80)));
+        a1[1][9] = (((74 >= v3) != (v0 * v0)) % 6);
+    }
+    a0[2] = (((v1 > v3) < (v0 % 6)) - ((a1[1][2] * v2) - (v0 <= v1)));
+    if ((((v0 || 22) > (71 > a0[0])) > ((82 && a0[14]) && (v2 && a0[1])))) {
+        a0[10] = (((v3 >= v1) != (12 <= 16)) >= ((v2 % 7) * (a0[6] == v0)));
+        a0[3] = (((v3 <= v3) != (v1 - a0[7])) - ((12 < v3) > (v3 >= v2)));
+        v2 = (((v3 * 90) - (v2 + v0)) || ((a0[11] >= v3) ? (a0[9] + 15) : (a1[1][8] <= 19)));
+    } else {
+        v0 = (((a0[7] >= v0) ? (40 <= 49) : (v2 - v3)) || ((a0[7] * v1) % 6));
+        a0[14] = (((a1[3][9] || v0) ? (v1 ? a0[12] : 96) : (v0 * a1[1][9])) || ((a0[5] - v1) || (v0 / 8)));
+        a0[8] = (((v1 - 91) && (62 < 0)) * ((a1[2][9] == v2) > (v2 || v3)));
+    }
+    v0 = (((10 != v3) != (v1 && 3)) < ((89 && a1[3][13]) <= (84 || v3)));
+    if ((((v1 - v3) % 5) ? ((v1 / 2) ? (v3 > v2) : (37 ? 63 : v0)) : ((a1[1][15] && v3) == (91 * v3)))) {
+        v0 = (((a1[3][9] < v1) <= (v3 + a0[6])) - ((v1 && 25) % 3));
+        v0 = (((v0 || a1[0][11]) % 9) && ((v2 == v0) / 6));
+        v3 = (((v0 <= v3) * (51 < a1[1][3])) >= ((10 > v1) % 5));
+    } else {
+        v3 = (((v1 / 6) ? (v3 ? v0 : 1) : (v2 && v1)) % 8);
+        a1[1][6] = (((v2 == a0[1]) < (63 % 2)) - ((56 ? v0 : a0[12]) >= (a0[0] != a1[3][8])));
+        v1 = (((29 >= 24) < (63 == v0)) < ((v2 ? v3 : a1[2][7]) <= (v0 < v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v0 = (((5 != v2) < (3 + v3)) * ((v2 <= v3) / 4));
+            v2 = (((v0 - 84) - (a0[7] > a1[3][6])) / 4);
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                a1[2][11] = (((91 / 6) < (i1 % 7)) * ((a1[1][10] % 8) ? (v0 && a0[3]) : (i0 < v2)));
+                a0[12] = (((6 == a0[4]) || (a1[1][6] % 3)) > ((a1[0][3] ? i0 : v3) >= (a0[13] ? i0 : v2)));
+                v3 = (((a1[0][0] / 6) <= (a1[2][2] == i0)) ? ((45 || v0) <= (v2 > i0)) : ((96 * i1) + (70 < 55)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v1 = (((v3 - v0) < (v0 <= a1[0][14])) % 3);
+                v3 = (((64 % 6) ? (a1[2][4] + 10) : (a1[2][7] && v2)) - ((v3 >= 78) ? (70 > a0[7]) : (v3 % 5)));
+                v0 = (((a0[13] == 72) - (a1[2][5] / 9)) ? ((i3 % 2) ? (v3 > a0[12]) : (a0[6] && i3)) : ((i3 ? v2 : a1[3][13]) ? (v0 >= i3) : (v3 || 45)));
+            }
+            v2 = (((a0[2] >= 80) && (52 && a1[0][4])) - ((a1[1][11] ? v0 : a0[15]) * (v0 - v2)));
+            v1 = (((v0 ? a1[1][10] : 74) % 1) / 8);
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((a1[3][13] == v2) ? (v1 < v3) : (v2 > a0[2])) == ((2 - a0[11]) < (v1 ? a1[1][7] : v0)))) {
+        v0 = (((v0 == 0) < (a0[14] * v1)) + ((v2 % 3) < (a1[1][5] - v2)));
+        v1 = (((v0 / 7) + (a0[2] * 48)) / 8);
+        a1[3][5] = (((v1 && v0) != (a1[3][5] == v3)) - ((v2 < v1) * (a0[11] / 5)));
+    } else {
+        a1[1][8] = (((v2 || a0[10]) + (0 % 5)) >= ((v2 || v1) > (14 - v0)));
+        a0[12] = (((a0[8] % 2) || (a0[3] - a1[2][2])) == ((a0[10] && v3) || (v3 + 43)));
+        a0[8] = (((v2 || v2) == (a1[1][6] < a1[1][0])) % 3);
+    }
+    return (((a1[0][5] && a0[12]) && (a1[1][3] || 27)) && ((a1[2][6] - v1) != (a0[11] + a1[3][9])));
+}
+int f1() {
+    int v0 = 66;
+    int v1 = 10;
+    int v2 = 84;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][7] == v0) || (v0 * v1)) < ((6 ? 27 : v3) != (a1[0][7] > v3)))) {
+        v1 = (((v1 > a0[1]) <= (v2 + v0)) == ((v3 >= v3) / 2));
+        v0 = (((v2 < 75) > (93 ? a1[1][6] : v1)) >= ((v1 || 78) ? (v2 - v3) : (a1[1][5] && v3)));
+        v0 = (((v0 || v3) == (19 > a0[0])) ? ((a0[1] && v2) * (32 ? v3 : a1[0][9])) : ((v1 ? 32 : v3) % 1));
+    } else {
+        v1 = (((9 ? v0 : v0) % 4) / 8);
+        v3 = (((v0 >= v0) - (v3 == 10)) * ((58 > a1[3][10]) / 2));
+        a0[10] = (((23 > v2) < (v3 % 1)) / 4);
+    }
+    if ((((v3 && v2) > (v2 || v2)) <= ((v2 ? a1[2][2] : v1) ? (58 || a1[0][8]) : (a1[1][14] || v3)))) {
+        v1 = (((v3 + v3) || (19 % 2)) && ((v2 != v1) > (41 >= v2)));
+        v3 = (((a0[9] > 9) >= (2 && a0[0])) > ((49 < v2) / 5));
+        a0[12] = (((v3 != 76) || (a0[14] * a0[13])) ? ((a1[1][5] * v3) - (v1 >= a0[15])) : ((v0 || a1[0][0]) != (a1[1][12] % 8)));
+    } else {
+        v1 = (((13 >= a1[0][6]) / 5) || ((14 - 78) - (v1 ? a0[5] : a0[12])));
+        a0[6] = (((v2 > a1[3][13]) ? (92 == v3) : (a0[0] > 32)) && ((37 != v0) % 6));
+        v3 = (((v2 <= v3) >= (v0 + v1)) ? ((v0 - a0[6]) / 1) : ((v0 != v1) > (v1 < v0)));
+    }
+    v2 = (((v0 <= v3) && (v2 && v0)) >= ((17 <= v2) != (a1[3][11] && 62)));
+    if ((((74 < 97) <= (a0[10] % 1)) == ((v0 && a0[13]) && (a0[14] != a0[13])))) {
+        v3 = (((v2 <= a1[0][14]) && (v1 || v1)) + ((v1 % 3) || (v3 % 3)));
+        v1 = (((91 || v0) / 7) + ((a1[3][1] * v2) <= (a0[12] % 4)));
+        v0 = (((v0 ? a1[2][3] : a1[3][4]) + (25 / 8)) || ((a0[7] - a1[1][6]) > (25 || v2)));
+    } else {
+        v0 = (((79 ? a0[9] : v3) ? (v3 <= 51) : (a0[9] || v0)) != ((95 * 53) && (a1[0][2] || v2)));
+        v1 = (((94 != v0) && (v1 ? a0[15] : a1[3][4])) * ((v0 <= v3) + (v0 == a1[3][11])));
+        a0[3] = (((v2 == 15) != (74 || v2)) + ((v2 + 59) != (v3 % 6)));
+    }
+    v1 = (((95 ? 56 : v1) <= (v2 || v0)) % 3);
+    a0[0] = (((a0[12] ? v2 : 13) <= (33 ? v3 : v2)) >= ((v3 > v3) % 7));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v1 ? v0 : v1) % 6) + ((a0[5] * i1) <= (a1[1][1] / 1)));
+                    v3 = (((v1 && 63) < (a0[4] < v3)) != ((12 / 4) < (a1[2][9] && v3)));
+                    v2 = (((v2 >= 33) && (48 == 57)) + ((56 && v1) > (v2 / 6)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a0[1] = (((8 <= 59) > (97 || 35)) ? ((23 + v2) >= (a0[8] + v1)) : ((v1 && v1) / 1));
+            v1 = (((v3 == a1[3][13]) % 8) / 2);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 > v1) < (20 || 25)) == ((70 / 9) <= (51 || v1)))) {
+        v1 = (((51 < v3) + (v3 % 5)) < ((v2 || v0) ? (v0 || v3) : (a1[0][3] / 7)));
+        v0 = (((v3 + 81) + (a1[0][2] + v3)) != ((a0[10] <= a1[1][4]) * (v3 > v0)));
+        v1 = (((v1 * 29) <= (73 ? v3 : v2)) <= ((v2 != v0) && (v3 || v3)));
+    } else {
+        v3 = (((67 - a1[1][15]) <= (40 + v0)) <= ((v2 ? a1[3][5] : 94) || (v1 != v3)));
+        v1 = (((a0[14] / 3) < (28 != v1)) * ((v3 > a1[3][0]) && (v2 % 6)));
+        v3 = (((32 - a0[6]) && (v1 % 5)) == ((v0 ? 64 : a1[0][12]) < (79 == v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            {
+                int i3 = 0;
+                do {
+                    a1[1][4] = (((v1 * v0) * (23 / 7)) >= ((a0[11] + a1[1][3]) <= (i3 * a0[2])));
+                    a1[3][10] = (((v2 * a1[3][4]) == (a1[3][2] ? a0[2] : a0[12])) <= ((77 != a0[13]) != (v2 || 61)));
+                    v0 = (((i3 + v3) ? (v0 * a0[5]) : (i3 == a0[8])) != ((i3 % 4) >= (v2 != 72)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a1[2][6] = (((89 ? i2 : a1[1][14]) || (v0 ? v1 : 96)) % 1);
+            a1[1][9] = (((a0[11] && v0) && (v0 >= v1)) < ((v2 / 9) == (v1 < v1)));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((35 - v0) > (29 || 89)) < ((4 || a0[1]) + (15 && v3)));
+    return (((62 / 3) > (a1[2][2] <= v1)) <= ((v3 / 6) && (v1 * 91)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,337 @@
+int f0() {
+    int v0 = 72;
+    int v1 = 52;
+    int v2 = 55;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 == v0) % 2) ? ((a0[14] - v2) ? (a1[2][12] > 54) : (21 * v1)) : ((a0[12] ? v2 : v3) * (a0[8] && 69)))) {
+        v0 = (((v1 / 3) < (6 <= v1)) % 1);
+        v0 = (((21 / 8) ? (v1 > v1) : (6 <= 85)) || ((16 > 57) - (v3 - v0)));
+        v0 = (((a1[2][13] + 8) <= (62 + a1[0][9])) * ((a1[2][11] % 7) > (87 + v2)));
+    } else {
+        a1[3][12] = (((75 || v3) % 3) == ((v0 != v1) - (a0[4] + a1[2][11])));
+        a1[1][15] = (((v2 + v3) - (v3 * a1[3][2])) || ((91 % 3) && (46 * a1[2][4])));
+        v1 = (((9 < v2) && (v2 && a0[4])) >= ((a0[7] + v3) != (v0 != a0[0])));
+    }
+    a0[14] = (((21 >= v1) && (v1 + v1)) == ((v3 || a0[7]) / 1));
+    if ((((a1[1][4] != a1[3][2]) != (v2 ? v2 : v3)) && ((v1 >= v1) ? (43 > v3) : (38 * 86)))) {
+        v2 = (((74 != 3) + (v2 / 6)) + ((v3 < v0) % 4));
+        a0[15] = (((v1 > 64) && (v1 >= a1[1][2])) <= ((20 < v2) < (a1[2][3] >= v3)));
+        a1[3][6] = (((a0[4] && a1[0][6]) * (1 ? v3 : v1)) > ((37 && a1[1][0]) % 7));
+    } else {
+        v0 = (((a0[0] == v3) / 4) * ((a1[0][0] % 7) ? (18 * v2) : (v0 >= v3)));
+        v3 = (((v1 <= a0[13]) ? (2 && v1) : (85 >= a1[1][15])) ? ((v2 && a0[9]) == (72 * a0[11])) : ((v2 <= 55) ? (91 + a1[2][5]) : (14 ? v2 : v1)));
+        a0[5] = (((a1[2][6] || a1[3][11]) >= (v3 || v0)) + ((a1[3][4] * 59) ? (v3 == v3) : (4 != v0)));
+    }
+    if ((((76 ? v2 : a0[6]) > (a0[4] / 8)) ? ((v1 ? a1[3][5] : v2) < (v2 ? 46 : 70)) : ((v0 || 79) - (a1[0][13] / 3)))) {
+        v3 = (((v2 < v3) <= (v3 || v1)) % 3);
+        v0 = (((v0 <= a0[3]) ? (29 - 21) : (v2 == 59)) && ((38 * a1[0][1]) + (a1[0][2] != a1[3][6])));
+        v1 = (((v3 && 14) > (v2 * v0)) == ((a1[1][14] * a0[6]) >= (7 >= 72)));
+    } else {
+        v0 = (((v3 - v0) >= (v2 <= a1[2][13])) / 9);
+        a0[9] = (((v0 <= v2) <= (v2 < v2)) < ((43 != a1[0][1]) == (v2 % 5)));
+        v1 = (((a0[15] * 87) ? (77 ? v2 : a1[1][14]) : (a0[8] && v1)) > ((44 != v0) <= (v2 < v3)));
+    }
+    if ((((93 / 5) && (v2 * 63)) * ((v3 > v1) == (v1 ? 26 : v2)))) {
+        v0 = (((a0[7] > v1) ? (60 ? v1 : v1) : (a0[2] < 54)) < ((36 == v1) ? (v1 + 4) : (v1 == a0[8])));
+        a0[15] = (((93 <= a0[15]) > (a0[9] >= 23)) % 5);
+        v3 = (((a0[12] - v3) || (a1[1][9] * v0)) || ((v1 ? 78 : 15) ? (v0 < v0) : (84 == a1[2][6])));
+    } else {
+        a1[1][14] = (((51 < v2) / 5) && ((84 % 7) * (a1[2][12] / 9)));
+        v0 = (((v3 % 6) > (v1 < a0[1])) >= ((v0 + v1) < (v1 + v2)));
+        v0 = (((v2 && v0) < (v2 - v0)) ? ((v1 || v3) * (v1 < v1)) : ((a0[13] / 6) > (v1 == v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v2 = (((i0 - v0) || (8 > v1)) / 4);
+            v0 = (((23 >= v0) == (a0[4] - a1[3][13])) != ((a1[3][7] / 8) < (v0 + 20)));
+            {
+                int i1 = 0;
+                do {
+                    a0[10] = (((a0[11] == a0[1]) - (v2 - v1)) + ((i0 % 8) * (v3 > a0[11])));
+                    v2 = (((a1[2][1] > 20) - (v2 + v1)) * ((10 == 54) <= (37 < a0[2])));
+                    v1 = (((i0 > v2) - (v1 / 5)) <= ((a0[14] + v3) <= (i0 > 47)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v2 ? v0 : v0) > 89) break;
+            v3 = (((v1 || 20) - (v1 == 71)) > ((a1[2][15] ? 62 : a0[8]) ? (v0 * 4) : (i2 || 83)));
+            v0 = (((v0 || v1) / 8) > ((a0[13] - v0) && (v0 >= v2)));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][13] = (((v2 / 8) / 5) % 8);
+                    v3 = (((v1 / 6) <= (97 - i3)) == ((a1[2][4] <= v0) + (i2 < 73)));
+                    a1[2][10] = (((i3 <= i3) && (24 >= a0[5])) != ((v3 - i2) >= (24 < v2)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v0 <= 61) != (a0[7] ? v2 : 5)) || ((v0 % 8) != (22 == v0)));
+                    v0 = (((58 * v3) ? (v1 + a1[2][3]) : (v2 > 80)) >= ((a1[1][6] ? 98 : 27) == (a0[7] != v0)));
+                    v2 = (((v0 ? 21 : a0[6]) * (v2 <= a0[5])) % 9);
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v3 = (((v1 / 5) > (v3 <= v3)) && ((v2 || 43) + (v1 || 33)));
+            v2 = (((v3 / 8) <= (a0[15] / 9)) && ((96 ? 99 : 32) && (v1 ? v0 : v2)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        if ((a1[0][4] == i6) > 60) break;
+        v2 = (((a0[2] <= a0[11]) - (a1[2][0] ? 16 : v0)) < ((50 > v0) <= (a0[0] == a0[8])));
+        {
+            int i7 = 0;
+            do {
+                if ((v3 % 4) > 62) break;
+                v2 = (((v3 == v1) ? (76 == v0) : (v1 ? 61 : a1[3][4])) / 5);
+                a1[2][10] = (((a1[2][5] * v3) != (53 - a1[0][1])) * ((a0[9] % 1) > (69 != 98)));
+                v3 = (((v1 && 33) * (a1[0][7] || v3)) / 2);
+                i7 = i7 + 1;
+            } while (i7 < 5);
+        }
+        v2 = (((v2 % 2) ? (v0 != 6) : (v3 <= v1)) ? ((a1[3][14] && a1[1][12]) + (v1 >= v1)) : ((62 + 54) ? (a0[13] ? i6 : a0[4]) : (a0[9] == v0)));
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        if ((a1[3][2] % 8) > 71) break;
+        v2 = (((v3 > v1) || (74 - a0[1])) && ((v1 < i8) * (58 ? a0[1] : 68)));
+        v0 = (((22 < 12) > (v0 % 8)) || ((97 % 6) >= (22 == v3)));
+        for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+            a0[5] = (((a1[2][13] ? v3 : a1[3][1]) && (v3 != i8)) < ((45 / 6) <= (v2 > v0)));
+            a0[4] = (((v2 > i9) < (64 ? a0[10] : v0)) || ((v0 == v0) || (v0 % 4)));
+            v0 = (((v2 - a0[12]) % 3) < ((a1[1][9] + v2) ? (v2 && i9) : (v3 * v1)));
+        }
+    }
+    return (((a1[1][7] > v1) ? (16 <= v1) : (23 && v3)) >= ((60 * a0[14]) ? (v1 % 9) : (a0[15] - v2)));
+}
+int f1() {
+    int v0 = 72;
+    int v1 = 95;
+    int v2 = 22;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((41 * v3) > 96) break;
+                v1 = (((v0 * v1) && (v2 > a0[14])) < ((a1[2][4] + i0) > (a0[5] / 6)));
+                v0 = (((39 >= i0) == (88 ? 70 : a1[0][7])) || ((57 == v3) - (58 >= a0[5])));
+                a1[0][0] = (((i0 % 9) - (v2 ? v1 : v2)) ? ((a1[3][7] > v0) + (v3 < 16)) : ((26 <= 75) || (v0 - v2)));
+            }
+            v2 = (((a0[3] != 21) >= (a0[10] > i0)) / 2);
+            a0[0] = (((v0 >= v3) % 4) < ((v1 || v1) % 9));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v0 = (((17 > a1[0][3]) <= (v2 <= v2)) != ((18 * 96) && (v0 + v0)));
+                v1 = (((a0[4] ? a0[11] : v0) >= (i2 * v1)) % 4);
+                a0[4] = (((7 || v3) * (a1[2][8] != 91)) < ((i3 / 1) < (v0 == v0)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v1 = (((14 % 6) <= (v0 && 90)) > ((5 ? 13 : v3) > (a1[0][15] * i2)));
+        v0 = (((55 > v2) * (59 % 7)) / 7);
+    }
+    if ((((63 * v3) % 9) % 8)) {
+        v2 = (((v2 || v1) || (v0 + v1)) * ((a1[2][0] == v1) ? (76 == 91) : (46 + v3)));
+        a0[3] = (((v1 && a1[1][1]) < (v1 == v1)) ? ((v0 + 39) != (50 ? v0 : v1)) : ((v3 % 8) == (a1[1][5] + v1)));
+        v0 = (((a1[0][4] * a1[2][14]) || (v3 ? a0[3] : 7)) ? ((a1[0][14] / 7) % 1) : ((14 * v0) ? (v2 - v2) : (71 < v1)));
+    } else {
+        a0[0] = (((79 ? v1 : v3) && (v1 <= a1[1][13])) < ((v2 >= a0[15]) ? (v0 + v0) : (99 == 24)));
+        v3 = (((a1[3][13] % 3) % 7) > ((3 > a0[7]) < (85 >= a1[1][15])));
+        a0[9] = (((v0 ? 30 : 47) || (v1 >= 99)) - ((59 < a0[3]) != (a1[0][4] ? 47 : 83)));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            v1 = (((i5 % 4) || (a0[13] != i4)) / 9);
+            v1 = (((v0 == 11) - (v0 / 6)) == ((v3 && v1) != (94 ? i4 : a0[5])));
+            v0 = (((28 / 1) >= (v1 - a0[10])) + ((v1 && 41) ? (i5 != i5) : (a0[3] < a1[0][11])));
+        }
+        v2 = (((v3 >= v2) >= (v0 ? 26 : a0[13])) || ((i4 != i4) < (a1[2][12] != i4)));
+        a1[1][15] = (((i4 + v3) != (v1 ? v0 : a0[11])) < ((67 / 5) <= (84 / 8)));
+    }
+    if ((((90 <= 24) ? (v0 ? v1 : v0) : (a0[0] * v2)) ? ((v0 != 35) < (v0 * v3)) : ((60 * v1) + (92 <= v1)))) {
+        v2 = (((79 != v2) || (a1[3][9] ? v1 : 57)) ? ((46 * v0) > (a0[4] ? v2 : v0)) : ((v3 <= a0[10]) % 8));
+        v0 = (((61 != v2) && (v3 - 76)) - ((53 % 8) - (a0[4] != a0[1])));
+        a0[0] = (((v2 - 68) / 4) == ((v3 - 25) <= (a0[1] ? v3 : 79)));
+    } else {
+        a1[0][12] = (((a0[15] - a0[8]) * (42 / 3)) || ((95 ? a1[2][9] : a1[1][2]) != (a0[5] / 6)));
+        v2 = (((5 && a1[3][1]) - (v0 + v2)) / 2);
+        v0 = (((v0 <= 3) < (v0 >= v0)) || ((81 ? v3 : a1[1][12]) - (v3 != a0[2])));
+    }
+    v0 = (((v0 <= a1[2][3]) * (27 ? 93 : a1[0][4])) != ((v3 > v2) < (a1[3][9] || v3)));
+    v1 = (((10 ? a0[1] : 9) <= (17 + 94)) > ((86 && a0[7]) / 6));
+    if ((((66 || a0[1]) ? (71 + v1) : (a1[3][2] || v1)) || ((a0[11] ? 16 : a1[0][12]) % 4))) {
+        v0 = (((85 * a0[10]) - (a0[11] % 9)) < ((v3 && v2) < (v1 < v2)));
+        v3 = (((v0 != v0) != (v0 >= v1)) >= ((a0[9] * v2) - (v1 && v0)));
+        v0 = (((v3 + 5) <= (83 && a1[2][11])) ? ((a1[0][1] && v3) == (71 + a0[12])) : ((v1 - v3) * (11 >= a0[0])));
+    } else {
+        v3 = (((a1[1][8] ? v0 : v0) || (a0[4] + 85)) % 8);
+        v3 = (((a1[3][1] * a1[3][12]) + (v2 + v0)) * ((a1[0][12] <= v0) != (v2 >= a0[5])));
+        v3 = (((a1[1][2] ? a0[11] : a1[3][3]) ? (a1[1][14] % 4) : (v2 || a0[12])) != ((v0 <= 9) || (93 % 6)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            a0[2] = (((76 == v0) >= (25 && v2)) < ((v1 <= a1[3][11]) + (a0[14] != v3)));
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    v1 = (((v3 ? v3 : a0[2]) ? (v3 - i7) : (a0[0] % 7)) ? ((v2 > i6) >= (i7 % 2)) : ((a1[3][10] >= 71) / 5));
+                    v0 = (((v2 <= a0[15]) >= (v0 > i6)) ? ((i6 >= 40) && (45 + a1[3][5])) : ((v3 >= 34) != (a0[15] < v1)));
+                    v3 = (((13 ? v1 : i7) || (v0 != v0)) < ((a0[14] < 23) % 5));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((a1[1][0] <= a0[10]) * (48 - 7)) ? ((v1 ? a1[1][6] : 66) <= (49 || v0)) : ((i6 || v1) && (a1[3][7] % 3)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 5) {
+            if ((a0[2] > v1) > 80) break;
+            {
+                int i9 = 0;
+                do {
+                    if ((a1[0][15] % 5) > 89) break;
+                    v1 = (((v3 % 6) - (v0 >= v3)) - ((i8 + v1) % 4));
+                    a0[15] = (((30 >= a0[6]) - (a1[0][11] == v1)) + ((i9 <= 21) && (a1[3][7] ? v0 : 58)));
+                    a1[2][4] = (((64 <= v1) * (a1[0][7] - a1[0][7])) - ((i9 * 64) * (a0[12] || a1[2][8])));
+                    i9 = i9 + 1;
+                } while (i9 < 6);
+            }
+            v1 = (((a1[0][14] ? a0[12] : 30) && (v1 / 4)) != ((v1 < 77) - (v3 && v0)));
+            v3 = (((v1 < i8) ? (11 % 1) : (v3 - v2)) * ((a1[3][4] % 2) == (v3 > a1[3][2])));
+            i8 = i8 + 1;
+        }
+    }
+    return (((a0[8] ? 0 : a0[11]) == (56 > 93)) - ((v1 || v2) == (v1 < 36)));
+}
+int f2() {
+    int v0 = 96;
+    int v1 = 3;
+    int v2 = 61;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((22 * i0) % 2) > ((a1[0][10] == v2) || (v3 % 7)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((v2 || 80) > 96) break;
+                v0 = (((i0 != i0) ? (a0[5] != v2) : (a1[2][8] != i0)) + ((v1 > v3) && (v0 + 29)));
+                v1 = (((v2 * 28) >= (95 ? 51 : a1[1][10])) >= ((a1[2][15] <= a1[0][1]) / 1));
+                a1[0][10] = (((a1[1][15] > a0[5]) + (v3 % 3)) && ((a1[0][15] || 7) + (a1[3][6] ? i0 : i0)));
+            }
+            a1[0][5] = (((21 ? v2 : 64) >= (v3 - a1[0][10])) < ((v0 ? v1 : v3) == (v0 >= 80)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a0[7] = (((a0[0] == v3) + (v3 || v1)) == ((v1 % 2) > (80 ? 16 : v2)));
+            a0[4] = (((a0[7] || a0[7]) ? (a1[1][13] / 9) : (v3 >= a1[2][11])) != ((a1[0][10] + a0[13]) && (a0[12] < i2)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                a1[3][10] = (((58 % 5) / 1) % 3);
+                v2 = (((a0[15] == 80) ? (v0 >= 99) : (v2 / 4)) < ((i2 && a0[11]) >= (v0 < a0[10])));
+                v3 = (((4 ? v2 : 93) % 4) % 1);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v3 ? v1 : a0[8]) + (a0[11] + a0[3])) || ((v1 ? a1[3][5] : v3) > (a0[9] > v2)));
+    if ((((v0 - a1[2][12]) == (v3 >= v0)) ? ((83 != a0[3]) % 7) : ((a1[0][4] * a0[9]) > (v1 && 78)))) {
+        a0[13] = (((14 + a0[13]) ? (12 - 96) : (6 || a0[11])) || ((a1[1][7] ? 82 : a0[7]) || (v2 * v0)));
+        a1[2][15] = (((v0 + a0[15]) / 4) == ((a0[5] ? v3 : a0[3]) < (a1[2][10] / 2)));
+        v1 = (((v2 % 8) < (42 < v3)) && ((v1 - v3) >= (v2 % 1)));
+    } else {
+        v3 = (((v2 < a0[2]) + (a1[3][13] > 39)) % 6);
+        v2 = (((a0[3] + 99) * (v1 * a0[0])) < ((v3 || v3) != (34 != v0)));
+        v2 = (((15 / 3) - (a1[0][2] < a1[1][3])) * ((94 > 74) <= (v3 <= 85)));
+    }
+    if ((((v3 || a1[3][13]) != (10 > v1)) >= ((v0 - v1) * (v3 != 88)))) {
+        v1 = (((v1 ? v3 : v2) == (61 % 7)) % 6);
+        v0 = (((93 > v0) || (v1 / 4)) >= ((78 < v1) != (a1[2][0] / 7)));
+        v0 = (((v1 * 42) - (v1 * v0)) % 6);
+    } else {
+        v3 = (((v3 != 72) / 7) ? ((v0 == v0) ? (v3 || 77) : (19 * a1[0][14])) : ((99 >= v2) - (v1 != v0)));
+        v3 = (((v0 % 4) && (48 <= 83)) ? ((a0[11] - 94) && (v1 + v3)) : ((v0 ? v2 : v2) < (v2 != v3)));
+        a1[3][12] = (((a1[0][9] || 81) && (a0[8] % 1)) % 4);
+    }
+    v3 = (((a1[0][12] * v1) > (a1[0][3] ? v2 : 15)) < ((v2 <= v3) <= (v0 - v0)));
+    if ((((47 >= v2) == (a0[9] + v2)) == ((v2 && v2) < (42 * 34)))) {
+        v2 = (((a1[0][15] ? v3 : v3) == (a1[2][6] ? v3 : a1[3][12])) >= ((a1[1][14] % 7) == (11 >= 27)));
+        v2 = (((v0 * v2) || (56 - v3)) ? ((v1 <= a1[2][10]) + (v0 ? v1 : v0)) : ((v0 <= 6) == (v3 || 62)));
+        a1[0][4] = (((v3 < v0) && (40 != 78)) - ((v0 >= v3) % 8));
+    } else {
+        v0 = (((a1[3][5] >= a0[15]) == (v3 > 45)) % 6);
+        v1 = (((62 ? v1 : v2) == (a1[0][5] ? a1[0][10] : v3)) == ((v0 * a0[12]) != (85 <= 1)));
+        a0[12] = (((v0 && 90) > (v2 * a1[2][8])) % 4);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v1 = (((v2 < v1) || (v1 != a0[4])) && ((v1 || a1[0][4]) != (v1 * 22)));
+            a1[3][13] = (((a0[13] - v3) - (52 && v3)) < ((96 || 71) ? (v1 + v1) : (4 >= v1)));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v0 = (((v1 + 22) != (89 > v3)) + ((86 || v3) <= (90 < a1[1][13])));
+                a0[7] = (((i5 + a1[1][10]) / 9) >= ((v1 || 63) % 5));
+                a0[13] = (((v1 > a1[3][1]) != (97 < 77)) >= ((i4 + v3) < (i5 >= 3)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            if ((a0[14] / 5) > 50) break;
+            a1[0][9] = (((a1[1][12] == a1[0][6]) / 7) % 9);
+            a0[15] = (((i7 > a1[2][15]) - (21 != v1)) != ((a0[5] + 29) + (18 % 9)));
+            v3 = (((a1[0][7] != i7) * (a0[3] * v2)) * ((75 < a1[3][10]) * (v3 == 67)));
+        }
+        v0 = (((v2 < v0) ? (a0[4] == 39) : (v2 <= v2)) % 1);
+        v1 = (((v0 > a0[9]) - (a0[15] % 2)) ? ((55 - i6) != (97 > 93)) : ((a1[1][10] <= a0[3]) % 6));
+    }
+    if ((((29 != a1[3][12]) + (a1[1][12] - a1[2][4])) < ((v1 / 8) + (31 - v3)))) {
+        v0 = (((v3 ? a0[9] : a0[9]) || (a1[2][0] < v1)) - ((v1 || v1) > (v0 != v3)));
+        v2 = (((v2 * 4) % 9) && ((v0 + 71) < (v1 % 9)));
+        v3 = (((v0 + 70) ? (a1[2][9] != v3) : (a0[9] == v2)) && ((v0 - a0[6]) > (v3 - v2)));
+    } else {
+        v2 = (((a0[4] / 5) == (33 / 9)) >= ((49 <= a1[2][10]) == (v2 > a1[0][1])));
+        a1[2][13] = (((27 >= a0[6]) * (a1[2][11] <= a0[6])) > ((72 && a1[3][6]) - (v0 == v0)));
+        v2 = (((a0[0] < a1[1][9]) ? (v2 ? 75 : v1) : (78 < 88)) >= ((v2 > v0) + (91 + v2)));
+    }
+    return (((5 < 84) || (a1[1][0] - a0[9])) + ((95 ? v3 : 85) ? (v1 != a1[1][4]) : (a0[15] != v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
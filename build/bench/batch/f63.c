@@ -0,0 +1,441 @@
+int f0() {
+    int v0 = 48;
+    int v1 = 38;
+    int v2 = 87;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[15] <= v2) != (v2 ? a0[4] : v0)) + ((a1[0][14] != v1) / 7))) {
+        a0[9] = (((78 >= v1) || (v2 > v2)) > ((v3 + 31) < (a0[2] ? v3 : 99)));
+        v3 = (((a0[7] > v3) - (a0[4] || v2)) - ((1 < 64) <= (v0 ? 23 : 22)));
+        v1 = (((a0[6] ? v1 : v0) + (86 <= 96)) ? ((a0[4] <= a1[0][0]) ? (58 / 9) : (68 - v3)) : ((v3 - 8) ? (v2 == a1[1][14]) : (a0[5] % 7)));
+    } else {
+        v1 = (((v3 <= 8) < (28 > a0[15])) + ((99 + v0) ? (v3 != a1[1][11]) : (46 / 5)));
+        v0 = (((v1 * v1) < (v2 >= 52)) == ((a1[3][11] != 28) >= (v1 - 15)));
+        v3 = (((v0 && v2) ? (v1 <= a0[15]) : (a1[3][2] > 48)) / 2);
+    }
+    if ((((76 < a0[2]) == (v3 ? v0 : a1[0][1])) || ((v1 ? a1[3][13] : 9) >= (a1[2][3] % 9)))) {
+        v2 = (((66 ? 23 : 61) - (v0 + a1[0][1])) && ((88 ? v0 : v3) + (v2 > v0)));
+        v1 = (((v3 % 7) + (81 >= v1)) ? ((v0 - a0[0]) ? (a0[1] && a1[3][6]) : (a0[11] >= v0)) : ((a0[10] <= 35) != (a1[1][12] < a0[13])));
+        v2 = (((7 && v1) < (a1[1][13] + 92)) * ((a1[2][2] / 1) == (v3 == a0[8])));
+    } else {
+        v3 = (((v3 % 7) && (a0[14] || v2)) - ((a1[2][9] && a0[8]) <= (44 ? 98 : v2)));
+        v1 = (((35 - a0[1]) <= (v0 && v2)) - ((a1[2][14] ? v3 : a1[3][5]) || (v1 / 7)));
+        v3 = (((74 > v2) || (v3 && 58)) ? ((v2 != v1) / 2) : ((93 * 42) ? (a1[2][13] >= v1) : (a1[3][3] % 9)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((v2 / 3) > 80) break;
+        v0 = (((a1[3][1] - v3) && (32 != a0[7])) * ((85 * v3) / 8));
+        v3 = (((27 != 30) ? (v1 * i0) : (43 / 2)) != ((6 - 8) - (37 != v3)));
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v2 = (((a0[15] * a0[14]) + (v2 + v2)) != ((v3 && v3) <= (52 ? v2 : v3)));
+            v0 = (((v2 || a1[0][8]) ? (a1[0][4] != v3) : (v0 - a1[1][6])) * ((a1[1][6] / 3) < (a0[0] - a0[13])));
+            a0[5] = (((i1 * v3) || (v0 != v2)) ? ((a0[6] <= v2) == (11 == a1[2][7])) : ((i1 >= a0[6]) ? (8 == 46) : (a0[14] && v3)));
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v1 = (((i2 ? i2 : 88) - (a1[0][11] + 10)) != ((v0 ? 99 : a1[0][13]) - (a1[3][7] > 23)));
+            v3 = (((44 <= v2) != (v0 ? a0[6] : v2)) < ((a1[3][15] * 71) % 4));
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[10] >= v0) > 97) break;
+                    v1 = (((i2 % 2) < (v1 == v2)) && ((49 == 57) || (2 != i3)));
+                    a1[2][5] = (((15 ? v0 : 63) > (v2 == v1)) && ((11 ? 44 : v0) > (52 % 1)));
+                    v0 = (((a0[5] == v1) + (i3 >= v0)) >= ((v0 >= 5) ? (a1[1][14] >= v1) : (i3 <= 60)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    a0[2] = (((a1[3][0] * v3) ? (16 <= v3) : (v1 % 5)) || ((v0 && v3) > (a0[3] < a1[2][5])));
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((v1 ? 89 : a0[6]) > 73) break;
+            a0[6] = (((32 && 18) % 8) - ((v1 != a0[9]) % 6));
+            v0 = (((82 <= i4) < (v0 ? v2 : a0[10])) ? ((v2 <= v0) < (27 / 3)) : ((65 <= v3) || (v3 && v3)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v2 = (((v0 / 4) / 9) ? ((20 / 7) / 7) : ((36 >= v2) && (a0[13] > a1[2][0])));
+                    v3 = (((v3 || v2) && (i4 ? 71 : i5)) || ((v0 % 1) >= (66 % 1)));
+                    a1[2][13] = (((v0 < v1) || (a1[1][2] == i5)) ? ((v2 < v0) == (i5 < a1[1][9])) : ((i5 >= a1[1][9]) * (i5 <= v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 == 65) > (7 || a1[0][12])) > ((v1 ? a1[0][10] : v3) >= (v3 != a0[5])))) {
+        a0[7] = (((v3 > a1[0][15]) % 6) % 3);
+        v3 = (((v3 != a1[0][13]) % 3) + ((v0 + a1[1][15]) ? (v2 || v0) : (a1[0][8] - v3)));
+        a0[14] = (((v0 || 28) < (43 != a1[3][15])) - ((44 >= a1[2][1]) != (51 / 1)));
+    } else {
+        v1 = (((v0 / 2) || (a1[2][6] - a0[14])) - ((v0 + 82) > (v0 / 8)));
+        v0 = (((v3 || v0) - (18 % 7)) % 8);
+        v0 = (((26 ? v1 : v0) == (v3 + v2)) + ((v1 ? 39 : 70) >= (v2 / 7)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v2 = (((a0[2] != v1) == (a1[2][8] < i7)) % 1);
+                a0[6] = (((a0[14] % 9) + (v3 && a1[3][15])) < ((v1 ? v3 : 17) - (a0[10] >= v0)));
+                v2 = (((v1 ? i6 : v0) < (86 < 42)) <= ((27 && v2) == (v2 == a1[0][5])));
+            }
+            v2 = (((v2 / 2) ? (i6 % 5) : (70 > a0[0])) == ((v2 ? 1 : 75) != (92 / 3)));
+            a0[12] = (((v2 + 59) * (v2 != v2)) ? ((81 * a0[0]) == (85 <= a1[1][3])) : ((22 ? v2 : v2) - (71 ? v1 : a1[0][4])));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a0[14] > 60) - (v1 ? a1[1][12] : a0[6])) < ((v0 - v3) + (v0 == v2)))) {
+        a0[8] = (((95 ? v3 : 9) == (v1 && v3)) < ((a0[1] && v3) / 4));
+        a1[3][7] = (((v3 >= a0[5]) || (v3 ? v3 : v0)) != ((v0 <= a0[2]) % 4));
+        a0[10] = (((v0 < a0[14]) < (v2 / 8)) || ((90 < v2) % 5));
+    } else {
+        v1 = (((v0 + 37) <= (93 != 27)) ? ((v1 >= v0) || (v1 * v3)) : ((27 < v1) == (32 / 1)));
+        v2 = (((a0[15] - v3) || (v0 > v2)) == ((a0[6] / 5) >= (v2 != a1[2][2])));
+        a1[1][5] = (((25 - a0[7]) <= (v0 + v2)) < ((a0[6] <= v0) <= (v2 <= a1[2][7])));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            if ((a1[1][7] % 9) > 99) break;
+            v2 = (((v1 && a1[0][10]) <= (54 == 70)) ? ((a0[7] * 54) >= (71 ? a0[1] : 43)) : ((v1 < v2) >= (a1[0][12] ? 64 : i8)));
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    v0 = (((a0[15] ? v2 : a0[10]) ? (i8 && 45) : (21 < a1[3][15])) * ((i9 % 2) <= (61 <= a0[6])));
+                    v2 = (((i9 ? v2 : a0[13]) - (v1 + v3)) > ((v2 || a1[3][1]) ? (i9 == v1) : (v0 > v2)));
+                    a0[9] = (((a0[2] != v3) != (a0[3] ? v0 : i8)) >= ((11 && i8) == (a0[11] >= 71)));
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((v0 == 22) ? (v0 > v0) : (v1 ? 26 : a1[0][14])) * ((v0 % 4) ? (i8 % 6) : (a1[2][9] + 39)));
+            i8 = i8 + 1;
+        }
+    }
+    return (((v1 ? 76 : 45) <= (v0 <= v0)) * ((64 ? a1[3][15] : v1) || (45 + a0[4])));
+}
+int f1() {
+    int v0 = 39;
+    int v1 = 10;
+    int v2 = 61;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 <= v0) > 58) break;
+            v1 = (((v3 && 9) + (v3 == v1)) ? ((75 >= a1[3][13]) * (63 - i0)) : ((v3 != a0[14]) * (36 / 6)));
+            {
+                int i1 = 0;
+                do {
+                    a1[3][14] = (((a0[5] && i0) <= (63 - a1[3][10])) - ((v2 && i0) ? (v3 == a0[1]) : (v2 % 4)));
+                    v2 = (((83 % 9) / 9) == ((v3 + a1[0][0]) < (v0 <= i0)));
+                    v1 = (((4 > 53) && (v0 <= v1)) / 8);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v3 = (((v3 ? v1 : a0[1]) % 5) == ((v1 <= a1[1][2]) && (13 < 4)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v0 >= v1) > 92) break;
+            a1[1][10] = (((82 > v2) - (50 == 21)) % 7);
+            v1 = (((a1[0][9] - 8) != (8 % 9)) / 1);
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a1[2][9] = (((50 && a1[2][11]) + (53 + v3)) + ((v3 / 7) == (a0[9] && i3)));
+                a0[4] = (((v3 + a1[1][3]) % 2) > ((v2 % 2) ? (i3 + a0[3]) : (v3 > a0[6])));
+                v1 = (((v3 < v2) / 1) <= ((90 * v3) ? (a1[1][13] < v2) : (9 < v2)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((i4 > v0) > 56) break;
+        v1 = (((v2 > v1) / 9) / 1);
+        v1 = (((v2 < 47) ? (84 >= a0[7]) : (i4 ? 26 : 30)) / 1);
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v1 = (((a0[6] - v2) - (0 > v1)) ? ((88 > a1[1][6]) > (a0[15] && v0)) : ((i4 ? v1 : v2) == (v2 == 72)));
+                v2 = (((v2 ? v1 : i5) == (73 ? v3 : a1[0][0])) != ((a1[1][8] * i4) / 7));
+                a1[0][6] = (((v2 * a0[15]) * (75 ? i4 : 84)) || ((91 != 95) ? (i4 != a0[1]) : (v3 == 49)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    if ((((v0 % 1) ? (a0[9] / 6) : (a0[11] / 6)) ? ((31 == v3) ? (v3 <= a1[2][8]) : (50 + v1)) : ((v0 || a1[0][12]) < (a1[3][14] != a0[5])))) {
+        a1[2][6] = (((a0[5] != a0[11]) / 2) < ((a0[8] ? v1 : a0[4]) + (v1 && 97)));
+        v0 = (((a0[4] ? v1 : v3) - (v3 - v0)) != ((v2 > 99) == (v0 && v0)));
+        v3 = (((33 * a0[5]) / 5) || ((v2 <= 94) / 1));
+    } else {
+        v1 = (((56 >= v0) + (60 + v3)) + ((v3 + a1[0][6]) <= (a1[1][7] || 83)));
+        v1 = (((v2 && 51) || (v3 + v2)) >= ((75 != v2) % 1));
+        v0 = (((v3 && v3) / 4) >= ((v2 <= a0[11]) % 8));
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((97 == a0[8]) - (a1[2][14] > v1)) * ((a1[0][4] / 9) <= (v1 * i6)));
+            {
+                int i7 = 0;
+                do {
+                    a1[2][1] = (((a0[4] < a0[15]) > (v2 == v2)) * ((a0[9] != a1[1][13]) && (i7 > 46)));
+                    v0 = (((a0[4] % 8) ? (v2 ? v2 : a1[0][4]) : (a0[13] - 16)) >= ((i7 >= 92) + (i6 <= a1[3][1])));
+                    v1 = (((a1[2][3] > 25) - (a1[2][2] || v0)) == ((24 + i7) % 3));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            a0[6] = (((30 >= v1) != (69 * v1)) >= ((a1[1][9] - a1[0][9]) - (49 ? 25 : a1[2][14])));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        a1[1][6] = (((a1[0][8] == v3) != (74 != v1)) >= ((v0 ? i8 : v3) * (i8 <= a0[10])));
+        for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+            a0[2] = (((52 == v1) - (21 || v2)) <= ((68 || 2) <= (v3 && v0)));
+            v0 = (((v3 >= i8) ? (29 + 78) : (v2 > v1)) && ((v3 * 20) >= (40 < i8)));
+            v0 = (((i8 || v2) >= (62 % 1)) / 7);
+        }
+        a0[14] = (((a1[1][3] > 57) < (34 ? a0[9] : v3)) && ((v0 + v3) || (a0[15] ? v0 : 65)));
+    }
+    {
+        int i10 = 0;
+        do {
+            v2 = (((a1[3][12] == 69) > (v2 || v0)) ? ((a0[15] >= 58) == (v3 % 1)) : ((6 % 9) <= (55 <= i10)));
+            {
+                int i11 = 0;
+                while (i11 < 3) {
+                    v0 = (((a0[8] + 61) != (31 * 76)) / 8);
+                    v0 = (((v3 || a0[12]) ? (32 > v1) : (v0 / 2)) % 6);
+                    v3 = (((41 ? i11 : 17) * (a0[7] - v2)) ? ((v3 + i11) || (v1 % 6)) : ((33 == v2) >= (v1 <= 58)));
+                    i11 = i11 + 1;
+                }
+            }
+            v0 = (((a0[11] - v2) >= (v0 ? v3 : a1[0][10])) + ((i10 || a0[15]) != (v3 > i10)));
+            i10 = i10 + 1;
+        } while (i10 < 6);
+    }
+    if ((((a1[1][4] < a0[13]) % 6) != ((v1 >= a0[12]) / 8))) {
+        v0 = (((96 ? a1[1][5] : v2) == (v0 >= a0[13])) <= ((70 - v2) % 6));
+        v2 = (((v3 * v3) != (v1 ? a0[2] : a1[1][1])) - ((v2 ? v3 : a1[1][12]) % 6));
+        a0[13] = (((v0 >= a0[14]) && (v2 <= v1)) || ((43 ? a0[13] : a1[1][8]) + (v3 || a1[0][1])));
+    } else {
+        v1 = (((v3 <= v0) == (v3 == v3)) / 8);
+        v1 = (((v2 ? a1[3][4] : a0[3]) != (30 && 73)) == ((6 + v2) && (30 && v3)));
+        v1 = (((v3 || a0[6]) / 6) > ((a0[6] * 88) || (49 < v3)));
+    }
+    for (int i12 = 0; i12 < 2; i12 = i12 + 1) {
+        if ((47 * a0[11]) > 70) break;
+        v2 = (((46 == 59) <= (v2 == 21)) || ((i12 - 22) || (v2 >= 19)));
+        {
+            int i13 = 0;
+            while (i13 < 5) {
+                v3 = (((a1[2][10] + a0[0]) / 8) > ((v1 <= 99) <= (i13 < i13)));
+                a0[5] = (((v2 ? 98 : 5) && (v3 && 61)) == ((64 < a0[0]) >= (a0[12] <= a0[13])));
+                v2 = (((i12 > 15) % 8) * ((v1 ? 20 : a0[6]) > (v3 ? a1[2][8] : v2)));
+                i13 = i13 + 1;
+            }
+        }
+        v2 = (((44 && i12) || (39 - a1[3][2])) > ((41 >= a0[5]) && (v1 ? a0[1] : 83)));
+    }
+    if ((((a0[12] - v1) == (v1 > a1[2][14])) < ((v0 + 33) > (v0 < v0)))) {
+        v1 = (((v2 < v3) ? (a0[4] >= 15) : (a1[3][14] > v3)) / 5);
+        v0 = (((v1 ? v3 : a0[15]) > (a1[0][14] || 24)) || ((11 && v1) - (v3 - a0[15])));
+        v0 = (((v2 <= v1) == (v2 ? v1 : v2)) >= ((86 ? v3 : 44) % 4));
+    } else {
+        v1 = (((a1[0][14] ? v1 : v3) > (v2 - a0[7])) && ((v1 < v3) && (v3 / 9)));
+        v0 = (((v2 - 11) * (63 < a1[3][3])) ? ((v0 < a0[6]) + (91 || 53)) : ((v2 % 7) > (v1 < v3)));
+        a0[6] = (((61 != 45) ? (v3 - a0[12]) : (v2 || 50)) - ((a1[3][6] > 69) || (a0[14] / 7)));
+    }
+    return (((v1 ? v2 : v2) ? (v1 % 1) : (v2 && a0[8])) < ((v3 - 31) != (v0 * v2)));
+}
+int f2() {
+    int v0 = 57;
+    int v1 = 56;
+    int v2 = 96;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a1[2][14] - a0[4]) ? (v0 % 6) : (a0[1] * a1[1][3])) <= ((v2 || a0[9]) <= (v1 + 11)));
+    if ((((v2 < a0[10]) + (v0 + a1[1][10])) != ((v3 / 8) + (v2 == v2)))) {
+        a1[1][9] = (((v3 || v1) < (v3 <= v2)) >= ((87 - a1[0][15]) >= (a0[5] < 87)));
+        v2 = (((12 % 7) - (78 ? v0 : a1[0][4])) <= ((73 >= v2) && (1 && a1[0][4])));
+        v3 = (((v1 * a0[11]) ? (v2 - v3) : (96 + v1)) <= ((v3 && 19) + (80 == a1[2][0])));
+    } else {
+        a0[15] = (((v2 >= v1) ? (62 ? v2 : 87) : (a0[9] / 5)) % 2);
+        v3 = (((2 != a0[1]) < (v0 != v0)) + ((v0 ? v0 : 42) >= (v2 != a0[14])));
+        v3 = (((v0 >= a0[12]) >= (a1[1][0] / 5)) >= ((v0 + v1) * (24 > 71)));
+    }
+    a1[0][14] = (((v1 || v0) % 1) == ((v1 > 36) != (64 * v3)));
+    if ((((v3 % 1) > (v2 - v3)) == ((v2 && 67) % 5))) {
+        v1 = (((a0[9] ? v0 : 59) - (18 * 21)) + ((v3 + a1[1][10]) != (v2 ? v1 : v1)));
+        a0[9] = (((v0 <= 76) > (v1 > v0)) / 5);
+        v1 = (((a0[5] % 4) > (a0[0] ? a1[2][13] : 33)) && ((a1[0][13] / 3) != (v2 && a0[13])));
+    } else {
+        v3 = (((v1 * v2) < (v3 - 70)) + ((60 >= 33) * (29 && a1[0][0])));
+        a1[2][12] = (((v1 >= v2) < (v2 ? a0[2] : a1[2][8])) && ((4 ? 32 : a1[2][1]) >= (v3 ? v3 : 72)));
+        a0[3] = (((57 == v3) < (v0 == v1)) + ((v2 ? a1[2][14] : v0) / 6));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((v0 && 25) > 66) break;
+        v0 = (((i0 - v2) || (67 ? i0 : 88)) ? ((a1[0][12] / 9) && (a1[3][12] + a0[9])) : ((a0[11] && a1[3][13]) != (66 > a0[3])));
+        v1 = (((v0 <= 12) ? (a0[12] - a1[2][8]) : (v0 ? a0[8] : a0[2])) * ((v1 - v3) == (v3 != v1)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                if ((v2 == i1) > 60) break;
+                v1 = (((85 / 7) == (v2 ? i1 : a1[2][13])) / 2);
+                v1 = (((v2 >= a0[4]) == (58 || 3)) && ((88 % 3) && (v1 * v3)));
+                v1 = (((v3 == 16) >= (v2 / 3)) / 4);
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v1 ? v3 : 81) > 59) break;
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((65 / 4) > 91) break;
+                a1[1][13] = (((a1[1][0] != v0) != (a0[12] - i2)) > ((i2 < 44) < (a0[9] ? 35 : v1)));
+                a0[5] = (((a1[1][7] / 5) == (v2 % 2)) * ((v2 - v3) < (a0[8] == v1)));
+                a0[3] = (((v3 <= a0[10]) && (74 > v1)) == ((a1[3][12] > a1[3][0]) <= (v2 <= a0[11])));
+            }
+            v1 = (((a0[13] - v1) <= (v3 && 34)) / 1);
+            v1 = (((v1 <= a0[3]) <= (v2 || v3)) == ((v1 + v1) <= (v2 > v1)));
+            i2 = i2 + 1;
+        }
+    }
+    a0[8] = (((v2 == v0) < (v2 + 57)) != ((v1 > a0[14]) % 6));
+    v0 = (((a0[2] >= v3) || (4 >= 3)) == ((v0 == 78) % 5));
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a0[0] = (((i4 ? v2 : v0) <= (a1[1][12] ? 24 : i4)) ? ((99 == a0[6]) - (v2 % 3)) : ((i4 <= a1[2][10]) > (v1 ? v2 : v3)));
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            a1[1][5] = (((a1[0][6] ? a0[11] : 78) - (a1[2][5] / 1)) && ((i4 - a0[1]) != (a0[3] != v3)));
+            v1 = (((a1[3][1] + v2) <= (v0 != i5)) == ((v1 - v3) * (i5 + a0[9])));
+            a0[10] = (((a1[1][4] && v0) < (a0[9] % 9)) + ((83 >= 61) / 2));
+        }
+        v3 = (((57 ? v1 : v2) != (v0 * i4)) && ((a1[2][15] / 6) / 1));
+    }
+    v1 = (((v0 - v3) % 6) % 6);
+    return (((v2 - 15) > (a1[0][12] && 28)) == ((v2 ? a0[9] : 31) && (a0[11] ? v0 : v0)));
+}
+int f3() {
+    int v0 = 2;
+    int v1 = 85;
+    int v2 = 97;
+    int v3 = 60;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 + 33) % 6) + ((v0 == v2) / 4))) {
+        v3 = (((a1[3][4] ? v3 : v2) == (v1 <= v0)) != ((v2 > v2) > (79 <= 83)));
+        v3 = (((a0[10] % 2) < (v3 <= v1)) <= ((40 == v1) + (76 <= 41)));
+        v0 = (((a0[1] - v3) / 8) % 3);
+    } else {
+        a0[6] = (((a1[3][5] <= v3) ? (v0 == a1[0][0]) : (v1 < v2)) - ((a0[3] + 53) && (32 || v0)));
+        a1[0][3] = (((v0 % 2) / 9) / 9);
+        v3 = (((40 || v2) < (v3 || 49)) - ((v2 < a0[13]) != (v1 || v3)));
+    }
+    v1 = (((a0[2] < 2) ? (a0[14] >= a1[0][11]) : (91 == 0)) ? ((v3 < v2) > (37 * 22)) : ((25 % 5) < (98 > 0)));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            a1[2][6] = (((a0[4] + v2) || (v1 || i1)) && ((a1[0][8] ? v2 : a1[0][11]) * (i1 != i1)));
+            a1[0][12] = (((a1[3][9] <= 78) ? (19 <= 26) : (v2 % 6)) % 5);
+            a0[13] = (((a1[3][4] <= 79) == (v2 / 4)) == ((v1 / 1) % 9));
+        }
+        v3 = (((23 <= v3) >= (v2 <= a1[3][10])) * ((83 + v0) > (v0 % 5)));
+        a1[2][0] = (((v0 == a1[0][7]) <= (a1[3][15] / 5)) > ((95 == v1) != (a0[9] + a0[5])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v1 - a0[10]) > 69) break;
+            v2 = (((57 == a1[2][6]) % 2) < ((v2 - v0) <= (a0[12] < a1[3][5])));
+            v2 = (((v3 / 3) * (v2 / 5)) || ((60 > a0[0]) > (v1 - 45)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((64 <= a1[0][1]) % 6) ? ((v2 && v1) / 6) : ((v1 && v0) != (v1 / 3)));
+                a1[3][11] = (((57 * a0[14]) >= (v3 % 5)) == ((26 % 9) >= (v1 && i3)));
+                v1 = (((a1[0][15] * a1[1][14]) < (a1[2][2] * v1)) != ((a1[0][2] + 7) >= (v0 != v1)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        a0[4] = (((v2 % 9) ? (a0[11] - v3) : (81 / 1)) <= ((98 - a0[8]) > (a0[11] * a1[3][15])));
+        {
+            int i5 = 0;
+            do {
+                v3 = (((v1 == i4) < (v3 + i5)) && ((a0[2] + a1[2][6]) * (a0[14] != v2)));
+                v2 = (((18 < a0[12]) - (78 / 7)) % 2);
+                a0[0] = (((a1[2][8] != v2) && (v3 > i5)) >= ((2 == 77) ? (v1 < 43) : (25 && a1[2][9])));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+        v3 = (((v3 >= v2) == (v3 != v2)) / 8);
+    }
+    v3 = (((v0 ? a0[13] : a0[7]) == (v3 ? a1[2][10] : v1)) > ((41 + 56) < (v1 && v3)));
+    a1[3][7] = (((v3 > v1) == (24 + v2)) ? ((v2 >= v3) * (a1[1][15] > a1[3][15])) : ((32 % 7) / 3));
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v3 = (((v1 != v0) != (70 <= a1[2][6])) ? ((i6 < v2) ? (v2 > v2) : (65 * 90)) : ((a0[4] < a0[4]) >= (a1[3][4] > a1[0][14])));
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    v0 = (((v0 == 43) && (v2 <= v2)) * ((76 ? a0[8] : v2) >= (a1[1][3] >= v2)));
+                    v2 = (((a1[0][0] >= v3) <= (i7 + v2)) != ((a0[2] * 73) != (a1[3][2] * v1)));
+                    v1 = (((v3 * v2) != (2 || v1)) > ((v3 - v1) <= (a1[3][10] <= i6)));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((v1 || a1[3][1]) * (70 || a0[11])) >= ((v0 ? v3 : v0) - (60 * 49)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            {
+                int i9 = 0;
+                while (i9 < 2) {
+                    v2 = (((71 && v0) ? (a1[2][15] ? v0 : 28) : (32 + a0[11])) >= ((7 > a0[7]) + (v3 && v2)));
+                    v2 = (((29 == v3) / 3) && ((50 + v3) * (v3 * v2)));
+                    a0[0] = (((90 * v3) + (51 >= 85)) >= ((54 < 83) > (i8 <= v2)));
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((44 && a0[4]) >= (48 ? a1[3][0] : a1[3][11])) >= ((39 || 70) || (a0[15] * a1[2][13])));
+            a1[2][8] = (((v2 >= a0[6]) == (i8 - a0[3])) > ((v1 > 25) ? (97 && v3) : (v0 / 8)));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((a1[0][5] - v0) > (v1 != v1)) && ((v1 != a1[0][1]) > (52 ? v1 : v1)))) {
+        a0[2] = (((16 ? a1[2][1] : v0) >= (v0 || 15)) > ((v0 == v0) * (v0 && a1[3][10])));
+        v3 = (((v1 ? v1 : v0) >= (v1 - v1)) == ((a1[3][3] + 6) > (v3 % 8)));
+        v2 = (((0 <= a1[1][10]) + (v3 % 8)) >= ((74 > a1[3][0]) * (a0[6] > 99)));
+    } else {
+        v1 = (((v1 <= v3) - (v0 % 4)) / 4);
+        v0 = (((v1 || v3) % 1) - ((a0[6] % 8) ? (v3 && v1) : (58 || 4)));
+        v1 = (((v1 >= v0) < (v3 >= a1[2][10])) / 6);
+    }
+    return (((69 && v1) / 1) != ((51 * v0) ? (57 != v1) : (v3 + v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
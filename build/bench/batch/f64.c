@@ -0,0 +1,151 @@
+int f0() {
+    int v0 = 26;
+    int v1 = 61;
+    int v2 = 63;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v2 = (((i0 >= v0) ? (i0 < v1) : (a1[0][9] % 5)) < ((v2 ? v0 : v2) - (a0[0] <= v3)));
+        v1 = (((v0 + v0) >= (87 / 7)) * ((78 + 13) ? (i0 + 8) : (v0 - 60)));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                if ((a1[0][5] == a0[13]) > 59) break;
+                v3 = (((2 < a0[5]) - (a0[9] > i0)) ? ((i1 + a1[2][9]) && (71 != v2)) : ((52 - 5) ? (a0[6] != v1) : (v2 >= v0)));
+                v0 = (((v2 + 33) != (a1[0][7] && v3)) && ((a0[4] < v2) - (63 == 65)));
+                a1[2][2] = (((v1 || v1) < (i1 ? a0[15] : 34)) * ((i0 ? a0[15] : a0[12]) > (56 >= i0)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v2 = (((v3 || v0) >= (v3 == v3)) >= ((v1 > a0[6]) <= (i2 - v0)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a0[0] = (((v2 + i3) < (a1[1][8] >= a0[7])) <= ((i2 || v3) && (v3 - a0[0])));
+                v3 = (((a0[3] >= a1[1][2]) - (i3 + v3)) / 2);
+                v3 = (((v0 % 5) <= (i3 && 22)) < ((a1[2][15] - v2) == (i3 + a0[9])));
+            }
+            a0[15] = (((v1 || 6) % 6) % 7);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((a1[3][13] ? v2 : a0[12]) > 80) break;
+        v2 = (((a0[15] > 37) != (v0 == v0)) || ((v3 + v2) * (a1[1][15] ? 57 : a0[10])));
+        {
+            int i5 = 0;
+            do {
+                a1[2][6] = (((a1[3][12] > 37) && (a0[14] != v2)) && ((a1[3][12] % 4) * (i4 - a1[1][10])));
+                v1 = (((i5 / 9) ? (v0 >= a0[2]) : (57 ? v1 : i4)) || ((v2 < a1[2][13]) - (a0[10] >= i5)));
+                v0 = (((96 ? a1[0][12] : i5) == (70 <= a0[15])) == ((v1 < 74) && (i4 >= v3)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v3 = (((a0[5] / 3) / 8) == ((a1[3][11] ? i4 : v3) ? (78 - v3) : (92 / 7)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v1 = (((a1[2][10] > i6) <= (58 * a1[0][14])) <= ((v0 == v2) % 3));
+            v3 = (((v3 < v1) < (a0[14] || 52)) >= ((v0 ? v3 : 93) + (v3 == i6)));
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((74 % 6) || (78 || v3)) < ((54 < i6) - (a1[2][14] < 9)));
+                    v0 = (((81 == i6) || (39 / 6)) != ((a0[2] || i7) ? (v3 != i7) : (v1 ? v2 : i6)));
+                    a1[0][10] = (((v3 > v0) - (a1[0][2] != v2)) >= ((v2 + i6) >= (a1[3][10] != v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((v3 * 42) > 62) break;
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((a1[2][4] ? 53 : v1) + (i9 <= v3)) * ((6 + a1[3][1]) - (a1[2][9] - v0)));
+                    v3 = (((74 ? 41 : v0) % 4) <= ((v3 * v3) * (i9 <= a0[13])));
+                    v1 = (((v2 ? 14 : 75) % 9) / 4);
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            v3 = (((60 * 76) * (v1 != 33)) || ((v1 ? a0[9] : 37) != (a0[12] ? v0 : v2)));
+            a0[2] = (((81 == a1[3][2]) != (3 > v2)) && ((18 / 1) && (i8 / 4)));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            if ((v1 + 81) > 52) break;
+            {
+                int i11 = 0;
+                while (i11 < 5) {
+                    a1[0][11] = (((72 ? i11 : v2) ? (v0 > 76) : (v0 % 6)) % 6);
+                    v1 = (((73 < v3) != (v3 % 7)) - ((80 && v1) > (v3 == 71)));
+                    v2 = (((v1 * a1[3][5]) % 8) < ((i10 ? a0[0] : a0[15]) / 8));
+                    i11 = i11 + 1;
+                }
+            }
+            v3 = (((16 || 27) != (91 <= v0)) / 2);
+            a0[0] = (((95 ? 35 : a0[2]) ? (90 - a1[2][3]) : (v1 <= v2)) || ((i10 - v3) <= (a0[0] * 91)));
+            i10 = i10 + 1;
+        }
+    }
+    v1 = (((v2 <= a0[10]) * (v1 % 9)) * ((v0 >= a1[3][3]) / 3));
+    {
+        int i12 = 0;
+        while (i12 < 3) {
+            for (int i13 = 0; i13 < 6; i13 = i13 + 1) {
+                v2 = (((v0 || a1[0][6]) ? (i12 ? a0[14] : v1) : (v0 > a1[1][1])) + ((v3 || 86) || (a0[15] == 79)));
+                v1 = (((a0[15] && 55) && (a0[0] >= a1[0][14])) && ((29 / 2) + (66 <= v0)));
+                a0[1] = (((i13 - a1[3][14]) % 3) ? ((i12 % 3) == (v0 && 15)) : ((v3 * a0[0]) > (60 / 4)));
+            }
+            v0 = (((a0[12] / 3) || (i12 * v1)) - ((i12 + v1) + (v1 > v3)));
+            v1 = (((a1[1][0] && 97) ? (v0 >= 26) : (v1 ? i12 : v1)) + ((a0[12] <= a0[12]) != (78 > v0)));
+            i12 = i12 + 1;
+        }
+    }
+    for (int i14 = 0; i14 < 5; i14 = i14 + 1) {
+        if ((i14 % 6) > 61) break;
+        v1 = (((24 % 8) + (0 <= v1)) * ((v3 >= a1[3][2]) && (v3 % 2)));
+        {
+            int i15 = 0;
+            do {
+                if ((i15 ? 23 : 69) > 75) break;
+                v2 = (((a0[2] < i15) * (v1 != 98)) || ((16 >= v0) <= (v1 > i15)));
+                v2 = (((v2 && 25) <= (i14 - a1[0][15])) * ((a1[1][15] + v2) < (a1[2][3] == v2)));
+                v3 = (((v2 / 6) != (a0[8] && v3)) || ((v0 == a1[1][11]) ? (i15 && a0[13]) : (v1 > 42)));
+                i15 = i15 + 1;
+            } while (i15 < 3);
+        }
+        v1 = (((51 >= a0[1]) ? (a0[3] >= v3) : (v2 >= v2)) && ((v0 + i14) && (a0[11] < 23)));
+    }
+    for (int i16 = 0; i16 < 3; i16 = i16 + 1) {
+        a0[0] = (((49 + v2) == (i16 || a0[15])) || ((59 == 87) - (v2 >= a0[6])));
+        v1 = (((v1 == v0) ? (a1[2][6] / 5) : (v1 || i16)) % 9);
+        {
+            int i17 = 0;
+            while (i17 < 6) {
+                if ((a1[3][5] % 2) > 84) break;
+                a0[5] = (((v3 >= v1) % 7) - ((v0 || a0[1]) % 7));
+                v0 = (((8 >= a1[1][1]) % 8) <= ((v1 + v1) % 3));
+                a0[6] = (((8 <= a0[13]) <= (v3 <= a1[3][6])) != ((i17 >= v0) || (i17 >= a0[1])));
+                i17 = i17 + 1;
+            }
+        }
+    }
+    return (((v1 - v1) / 2) % 2);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,302 @@
+int f0() {
+    int v0 = 19;
+    int v1 = 21;
+    int v2 = 34;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 * v3) < (v2 % 7)) && ((a1[2][10] == v3) && (v2 == a1[3][2])));
+    a0[11] = (((v0 % 1) % 9) > ((v0 != v3) && (v3 ? a1[1][12] : v3)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((a1[1][6] % 1) > 93) break;
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            if ((v3 ? a0[9] : v2) > 83) break;
+            v2 = (((6 * 30) % 2) && ((i1 - a1[0][8]) < (v3 != a0[0])));
+            v3 = (((i1 != 32) && (v2 * a1[2][13])) == ((v0 * a1[2][1]) < (v2 + i0)));
+            a1[2][0] = (((51 % 9) >= (91 >= a1[3][5])) == ((29 + 63) - (0 && 50)));
+        }
+        v3 = (((v2 ? a0[9] : v2) > (v2 / 7)) > ((39 - a0[1]) >= (v3 > 41)));
+        v3 = (((a1[0][0] == v3) % 5) ? ((a0[13] - a0[8]) > (v2 <= a0[0])) : ((a0[9] ? v0 : a1[2][3]) != (v1 - v0)));
+    }
+    if ((((a0[9] - 66) > (v3 * 58)) != ((a1[2][3] || a1[2][11]) == (v0 / 7)))) {
+        v1 = (((v1 ? v2 : v0) * (v1 % 9)) >= ((v0 / 3) > (85 || v1)));
+        v2 = (((a1[3][11] ? v3 : v2) > (v2 ? v1 : v1)) * ((v3 < v0) < (v1 && 65)));
+        v3 = (((6 != a0[14]) || (a0[10] < 21)) && ((92 * a0[15]) != (a1[0][9] / 8)));
+    } else {
+        a1[1][1] = (((v0 < 44) < (a0[11] || a1[2][13])) % 9);
+        v2 = (((22 > 64) * (v1 > v0)) <= ((93 - v0) > (v2 + a0[8])));
+        a0[4] = (((v2 ? 0 : v2) > (a1[3][4] * v2)) < ((v1 < v1) != (v3 && a0[0])));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v2 = (((v1 < v2) && (v1 + v0)) <= ((11 <= 19) + (a1[3][5] * v0)));
+        {
+            int i3 = 0;
+            do {
+                a0[3] = (((8 && 81) - (v2 == v3)) + ((v0 ? 29 : i2) > (v2 >= v1)));
+                a0[8] = (((a0[15] / 7) ? (a0[11] >= 27) : (a0[5] / 3)) / 3);
+                a1[1][3] = (((4 < v2) <= (91 || a0[5])) * ((v0 % 6) % 8));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        a0[12] = (((a0[8] ? v1 : a1[2][2]) || (v3 > 59)) * ((32 ? i2 : v3) != (v2 == a1[1][5])));
+    }
+    if ((((a1[3][0] % 2) / 6) >= ((v1 >= v2) / 9))) {
+        v0 = (((v1 ? 70 : a0[4]) || (a1[1][12] + v1)) >= ((a1[2][0] < 19) % 2));
+        a0[11] = (((74 ? v1 : a0[15]) < (v3 ? 59 : v1)) / 4);
+        a1[2][10] = (((a0[5] * v0) <= (72 % 3)) || ((v3 <= v0) + (a0[9] + v3)));
+    } else {
+        v3 = (((a1[0][10] ? v2 : v2) >= (v3 >= 60)) - ((66 || 56) % 5));
+        v0 = (((v2 ? v2 : v3) ? (v2 ? 48 : a0[9]) : (v2 % 6)) * ((v2 > v3) >= (2 && 82)));
+        v2 = (((a1[3][12] > 20) > (v2 && v1)) || ((v0 / 3) + (v2 + v3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a0[3] > 25) != (a1[2][1] > v2)) == ((a0[9] > 44) >= (a0[4] < v1)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    if ((v3 ? v2 : i4) > 57) break;
+                    v1 = (((v1 + v1) < (a0[1] + 42)) >= ((59 && v2) + (i4 && v3)));
+                    v1 = (((a1[0][1] / 3) < (v0 > 99)) && ((i4 == 96) / 1));
+                    v1 = (((i4 - i5) + (v2 ? i4 : 12)) ? ((75 >= v0) ? (v1 <= 26) : (5 > v2)) : ((19 == v0) ? (a1[0][15] == v3) : (a1[3][4] % 1)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((10 / 4) ? (v2 * v3) : (i4 > v2)) >= ((a1[3][14] - i4) - (a1[0][8] - 93)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    a0[7] = (((v3 <= v0) <= (v1 == 75)) == ((90 >= 95) || (a0[4] && v3)));
+    v1 = (((v3 % 1) + (v3 + 47)) > ((v0 ? 71 : v0) != (v3 != v0)));
+    a1[3][13] = (((v3 / 4) ? (v1 < v0) : (v3 < v3)) < ((15 ? v0 : v2) != (a0[1] - v3)));
+    return (((v3 == a1[1][6]) != (v2 >= v1)) && ((v0 < a1[3][2]) && (v2 * v1)));
+}
+int f1() {
+    int v0 = 90;
+    int v1 = 62;
+    int v2 = 13;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((v3 <= v2) > 99) break;
+                v3 = (((v0 * a1[3][4]) % 2) != ((39 - 83) && (81 <= i1)));
+                v2 = (((i0 != v1) >= (v1 % 6)) / 6);
+                v3 = (((v3 && a0[3]) - (a1[0][6] >= i0)) < ((v1 * a1[3][5]) ? (62 && 19) : (v3 >= a1[0][3])));
+            }
+            v1 = (((71 != i0) % 8) + ((v1 * 75) ? (v3 >= 27) : (i0 && v3)));
+            a1[3][3] = (((a0[13] * v0) >= (a0[4] != 8)) ? ((a0[9] != v3) % 3) : ((a0[1] + 54) <= (v3 || v2)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((76 && 30) > 80) break;
+            a0[6] = (((a1[3][14] <= v0) != (i2 <= 3)) - ((v1 ? i2 : 56) > (v1 || v1)));
+            v1 = (((i2 - a0[12]) ? (v2 && 87) : (a1[2][14] ? a0[2] : v0)) % 7);
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a1[1][3] / 6) >= (v0 / 4)) || ((i3 + v0) + (a0[8] <= a0[0])));
+                    a1[2][6] = (((a0[1] + 15) ? (v2 && a0[7]) : (i3 != a0[4])) % 8);
+                    a0[12] = (((86 != a0[7]) / 7) || ((a0[1] && 17) || (a1[2][7] / 9)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            if ((i4 == v1) > 91) break;
+            v3 = (((72 <= v1) || (14 > 2)) ? ((v0 + i4) <= (46 % 9)) : ((v3 && i4) ? (36 > 63) : (a1[2][0] == v1)));
+            {
+                int i5 = 0;
+                do {
+                    a0[12] = (((67 + 49) < (v1 / 6)) - ((i4 - 7) / 3));
+                    a0[5] = (((i5 || v0) + (v0 < a1[1][8])) > ((v3 >= a0[1]) < (11 || v1)));
+                    v3 = (((a1[1][2] % 5) % 5) != ((89 + 86) / 7));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a1[3][1] = (((v1 >= 80) - (v1 + 92)) / 6);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 && 70) || (a1[0][2] + v1)) || ((a1[3][9] < v0) ? (v2 / 9) : (a0[3] && 79)))) {
+        v0 = (((a0[0] <= a1[3][1]) || (a0[14] - v1)) < ((a1[1][5] <= 15) >= (a0[0] + v1)));
+        v1 = (((48 && a1[0][12]) / 5) * ((v2 + v3) && (v0 + a0[9])));
+        v0 = (((a0[4] >= v2) ? (v2 >= a0[9]) : (a0[4] == v1)) - ((92 != a0[6]) % 5));
+    } else {
+        a0[6] = (((v1 / 8) % 1) > ((v1 % 5) - (a0[7] == v3)));
+        v2 = (((99 ? a0[10] : v2) != (5 < v0)) * ((v2 - 73) + (v1 % 1)));
+        a1[2][13] = (((88 ? 82 : a0[5]) && (v2 && a0[1])) != ((a1[1][6] + v3) || (v2 == a0[15])));
+    }
+    if ((((39 % 8) * (a0[4] ? v0 : a0[6])) || ((v2 && v0) < (98 != a0[11])))) {
+        a1[1][7] = (((v0 ? v2 : 57) % 8) ? ((2 % 5) == (a0[10] - a1[0][15])) : ((a1[3][12] + v0) ? (a0[3] % 1) : (88 % 7)));
+        v0 = (((a0[7] < v0) && (v1 * a0[5])) / 7);
+        a0[5] = (((12 * v2) / 3) / 2);
+    } else {
+        v3 = (((v3 == 62) != (a0[9] ? 24 : v2)) > ((v0 % 5) % 8));
+        a1[0][5] = (((v1 ? v1 : v1) && (85 >= a0[13])) ? ((v3 % 6) / 1) : ((20 + 10) <= (v0 % 3)));
+        v3 = (((93 > v2) || (v1 > a1[3][1])) + ((v0 && v3) - (v3 >= 66)));
+    }
+    v1 = (((v3 / 1) == (28 + 74)) > ((v0 && 0) || (9 || 78)));
+    if ((((48 >= a1[3][7]) > (v1 / 2)) && ((62 != 64) == (v2 > 36)))) {
+        v1 = (((a1[1][9] == v3) % 2) ? ((38 > 93) / 6) : ((v0 * 84) != (58 != 24)));
+        v0 = (((v1 == a0[7]) < (86 * a1[2][6])) == ((53 * v3) || (a0[6] + a1[3][7])));
+        v0 = (((v2 * a1[3][0]) || (v3 <= 71)) <= ((79 + 56) && (v2 * 71)));
+    } else {
+        v3 = (((a1[2][9] < 37) % 2) + ((v3 && v1) > (v0 < v0)));
+        v3 = (((64 && v0) != (v1 ? a1[3][13] : a1[2][10])) > ((v3 >= 8) + (v0 || v2)));
+        a0[0] = (((43 > v0) && (v0 ? v2 : v0)) || ((a1[1][6] <= 92) % 5));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            if ((v0 % 7) > 96) break;
+            v1 = (((50 / 6) % 9) * ((42 / 9) >= (93 ? 15 : v2)));
+            v0 = (((i6 != v3) + (8 - v0)) && ((a0[5] != v3) - (a0[13] * a1[0][11])));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                a1[3][4] = (((a1[1][10] <= i6) >= (42 && v0)) != ((v1 ? v3 : v1) || (a0[6] < v1)));
+                v3 = (((a1[3][2] > i6) % 3) ? ((a1[0][1] <= i7) % 1) : ((59 + a1[0][9]) && (v2 > v1)));
+                a1[1][9] = (((34 < a0[14]) * (v3 != v0)) / 2);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v3 = (((v1 - 17) % 6) - ((v1 * a0[9]) + (84 + a0[7])));
+            {
+                int i9 = 0;
+                do {
+                    v0 = (((v1 + v1) > (v0 != v3)) / 8);
+                    v3 = (((v3 || 24) != (a1[1][15] == a1[2][9])) / 8);
+                    v1 = (((31 ? v2 : 60) <= (a1[1][5] >= i8)) < ((v2 ? 36 : v2) != (v2 ? v1 : 50)));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            a1[1][8] = (((v3 > 75) && (a1[3][10] + v2)) % 7);
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    if ((((75 > 10) < (v1 < v3)) == ((a1[2][0] || v2) >= (v1 != 58)))) {
+        v2 = (((v2 ? v2 : v3) >= (a0[3] <= a1[1][8])) - ((15 - 7) / 5));
+        a0[13] = (((17 ? v3 : v0) == (a1[3][11] || a0[2])) ? ((v0 || 26) % 5) : ((v1 != a0[14]) - (v1 && a0[8])));
+        a1[1][4] = (((v0 ? a1[1][13] : a0[0]) || (v3 / 9)) ? ((v0 != v3) > (v0 < v2)) : ((22 - v1) % 8));
+    } else {
+        v3 = (((19 <= v0) * (56 != a1[1][13])) % 3);
+        v2 = (((93 * 32) >= (35 - 80)) <= ((a1[0][9] > v1) + (a1[0][4] >= v0)));
+        v3 = (((v3 == a0[12]) % 8) - ((v2 > 91) > (v1 != a1[1][5])));
+    }
+    return (((a0[12] % 2) ? (v1 + v1) : (v0 / 1)) >= ((84 < a1[1][5]) - (v0 < v3)));
+}
+int f2() {
+    int v0 = 50;
+    int v1 = 76;
+    int v2 = 24;
+    int v3 = 58;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v3 = (((28 > v3) % 9) < ((v0 > i0) % 3));
+            v2 = (((v0 <= i0) ? (8 || i0) : (v3 - a1[3][15])) <= ((a0[13] <= i0) <= (v0 - a0[4])));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a0[11] = (((25 - 31) > (a1[3][4] != v3)) || ((v0 && a0[13]) ? (12 - a1[3][3]) : (v0 > v3)));
+                v0 = (((v1 ? i1 : i1) / 5) ? ((v3 < v3) ? (9 && a1[2][12]) : (73 || i0)) : ((54 <= 98) > (78 ? i1 : v1)));
+                a0[8] = (((v0 > v0) || (a0[6] - v3)) > ((10 > a0[9]) >= (v1 != a1[3][4])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((13 ? 98 : v0) || (a0[15] <= a0[2])) + ((v3 / 9) != (v0 * v2)));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((5 && 87) > 87) break;
+        v3 = (((a1[0][2] ? 76 : 80) == (73 || v2)) != ((a1[0][7] != v0) % 1));
+        {
+            int i3 = 0;
+            do {
+                if ((24 > v3) > 55) break;
+                a0[8] = (((85 != v0) * (i3 != 70)) && ((i2 >= a0[7]) && (i3 < v1)));
+                a1[3][14] = (((37 && 16) == (47 || i2)) == ((a1[0][10] <= 6) <= (80 - a1[2][8])));
+                a1[3][4] = (((v2 > v1) > (i2 - v3)) || ((a1[2][9] && v0) > (67 == i2)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v1 = (((v3 <= 34) * (16 != i2)) >= ((i2 != v2) == (31 / 6)));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a0[3] = (((v0 < v0) / 8) * ((86 > 46) - (v2 % 9)));
+        v2 = (((77 + 84) - (a1[2][13] / 1)) / 1);
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v2 = (((a1[1][7] % 5) % 2) <= ((29 > v3) > (66 % 3)));
+            v1 = (((2 != 73) < (a0[10] >= a1[3][0])) == ((i4 ? 0 : v2) >= (v3 + i5)));
+            v0 = (((i4 ? 44 : a1[2][7]) <= (a0[0] - v1)) + ((a1[3][12] || v0) * (v2 * 4)));
+        }
+    }
+    if ((((a1[0][6] <= 19) || (v1 ? v0 : 64)) % 5)) {
+        a0[15] = (((a0[11] % 3) / 4) + ((a0[12] % 4) > (52 - 44)));
+        v0 = (((v3 || v0) + (v3 <= v0)) ? ((a1[2][9] || 83) != (a0[4] + v3)) : ((97 && v3) ? (a0[14] % 9) : (a1[0][13] <= 50)));
+        v1 = (((v0 < a1[1][6]) - (81 + v1)) != ((a1[2][7] ? v1 : a0[9]) > (v0 % 6)));
+    } else {
+        a0[5] = (((98 && a0[1]) > (1 * v3)) ? ((67 <= v3) % 9) : ((v1 != a1[3][14]) && (15 % 3)));
+        v1 = (((v1 <= v0) / 5) / 4);
+        v1 = (((5 != a1[3][12]) != (v0 || a0[7])) + ((a0[7] + a0[12]) || (a0[10] != 79)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v1 = (((a1[0][3] >= v0) != (16 < i6)) < ((v3 ? i6 : v2) <= (a1[1][8] + a0[6])));
+            a0[4] = (((v3 || 97) > (89 >= i6)) > ((85 != v3) - (v3 + a1[1][4])));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    if ((9 >= 96) > 52) break;
+                    a0[11] = (((v0 && v3) ? (a1[1][8] ? 64 : 84) : (76 - v1)) * ((85 && a1[3][5]) < (19 ? v3 : v2)));
+                    v1 = (((a0[7] && i6) - (v2 <= a0[9])) / 6);
+                    a1[3][7] = (((a0[2] > a1[0][6]) * (a1[1][11] != a1[0][8])) || ((v1 && 23) / 2));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    a0[10] = (((83 < 54) || (a1[2][12] ? v0 : v1)) <= ((a0[4] * 13) >= (v0 > 45)));
+    if ((((v3 || v0) + (a0[12] ? v3 : 13)) >= ((38 >= 44) - (v3 ? v1 : v3)))) {
+        v3 = (((96 + a1[0][15]) < (a1[1][1] || a1[3][9])) && ((v3 * v3) + (84 || 69)));
+        v2 = (((v3 < a1[2][7]) >= (69 != 58)) ? ((v0 ? a0[2] : 62) >= (v3 >= 69)) : ((v1 == 88) - (a0[6] % 2)));
+        v1 = (((87 + a0[9]) != (24 >= 89)) ? ((v3 + v2) - (v0 ? v0 : v1)) : ((a0[5] || 98) ? (97 < v3) : (v2 ? 84 : 90)));
+    } else {
+        v2 = (((16 == a0[3]) < (90 + v0)) + ((a1[3][3] > 3) || (17 - v0)));
+        v1 = (((v2 / 5) ? (v2 > v3) : (a1[1][13] - v1)) <= ((a1[2][14] == v1) ? (61 < a1[0][13]) : (a1[3][6] > 38)));
+        v3 = (((a1[1][15] ? v0 : a1[3][5]) - (74 * a1[0][12])) < ((v0 + 93) != (62 <= a1[0][3])));
+    }
+    a1[0][4] = (((v1 + a1[1][3]) < (a0[1] > v2)) ? ((v3 - v3) ? (14 ? a0[10] : 0) : (v0 / 3)) : ((a1[0][2] >= v1) + (v1 / 9)));
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+            v0 = (((v2 - a1[1][3]) * (v3 <= a1[3][4])) != ((17 < 32) - (i9 % 7)));
+            v2 = (((v2 / 3) - (72 / 5)) < ((i8 <= i9) / 3));
+            v3 = (((a1[1][3] < i9) / 9) * ((i9 <= 68) && (i9 <= 70)));
+        }
+        v3 = (((v1 && a0[6]) > (26 + v3)) * ((a0[14] ? v2 : v1) % 9));
+        a1[3][10] = (((a1[3][2] / 1) && (v2 && v3)) != ((a1[2][4] ? i8 : i8) != (66 < 28)));
+    }
+    return (((v0 / 6) <= (a0[14] || v2)) < ((86 - a1[3][7]) != (a0[2] ? a1[0][5] : a1[0][11])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
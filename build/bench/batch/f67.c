@@ -0,0 +1,407 @@
+int f0() {
+    int v0 = 99;
+    int v1 = 26;
+    int v2 = 79;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    if ((((59 + a1[1][8]) ? (11 % 1) : (87 >= v2)) + ((7 * 42) == (v0 >= a0[12])))) {
+        a1[3][13] = (((a0[9] <= v2) > (a1[0][11] < v3)) <= ((v3 > a0[14]) > (v2 <= v3)));
+        a1[0][4] = (((a0[14] == a0[11]) ? (43 == v3) : (a1[2][1] <= 22)) / 1);
+        a1[2][7] = (((a1[2][9] ? v1 : a0[13]) == (a0[8] * v2)) / 4);
+    } else {
+        v3 = (((v1 - v2) - (85 ? v3 : v0)) || ((v1 != a1[0][15]) / 6));
+        v0 = (((a1[1][8] && v0) / 4) && ((79 ? v1 : v0) - (a1[0][14] ? v3 : v2)));
+        v3 = (((v2 <= a1[3][13]) == (a1[1][12] ? 6 : v3)) >= ((v3 % 8) || (a0[2] % 2)));
+    }
+    if ((((v2 >= 48) && (v2 == a1[3][11])) / 3)) {
+        v3 = (((v1 ? a0[3] : a0[3]) < (a0[2] != v3)) % 8);
+        v1 = (((v0 / 6) && (v2 == v3)) < ((v2 % 1) > (v0 < v0)));
+        v0 = (((11 >= v2) / 3) ? ((v3 > a1[2][9]) != (v0 ? v2 : v1)) : ((12 * a1[0][10]) == (v1 < 9)));
+    } else {
+        a0[11] = (((v2 != 40) < (v0 < v0)) % 7);
+        v0 = (((v3 % 6) + (a0[15] % 2)) && ((a1[1][9] - a1[3][3]) % 3));
+        a0[9] = (((v1 && v0) >= (a1[3][15] - v2)) / 4);
+    }
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v0 == 12) ? (v3 + v1) : (a1[0][12] + v1)) - ((v1 != a1[0][7]) - (v0 >= i0)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((a1[1][13] < i0) > 63) break;
+                v3 = (((v2 && a0[5]) + (89 + v3)) >= ((v2 % 6) * (72 == v1)));
+                v1 = (((12 ? a0[1] : i0) ? (88 ? i0 : v1) : (v1 > 5)) == ((v3 && v2) - (v0 ? a0[0] : v1)));
+                v0 = (((v1 * v0) / 3) - ((a0[0] + v2) % 9));
+            }
+            v1 = (((13 && 42) || (v0 ? a0[13] : v1)) <= ((v1 >= 49) <= (37 && v2)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v0 + 49) - (v0 ? a1[0][5] : v2)) ? ((93 || 82) < (v1 ? v2 : v0)) : ((a1[0][8] >= 77) ? (v1 ? v0 : 77) : (v1 - 20)));
+            a0[11] = (((v2 <= 64) / 9) ? ((23 % 7) * (v1 && a1[0][12])) : ((v3 < v1) < (v3 % 1)));
+            {
+                int i3 = 0;
+                do {
+                    a0[1] = (((i2 || a1[2][9]) <= (v0 ? 25 : a1[1][14])) || ((93 && 72) != (v3 ? 5 : a1[1][0])));
+                    v0 = (((i2 * a0[8]) + (v3 + v3)) > ((v1 < i2) && (v0 >= v0)));
+                    a1[1][11] = (((79 != i2) ? (a0[7] <= 23) : (a1[3][0] < v3)) || ((v2 != a0[13]) && (v0 / 2)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v2 > v0) == (57 % 2)) * ((v3 > v0) + (v2 - a1[1][1])))) {
+        v1 = (((v2 + a1[3][3]) <= (v1 / 4)) > ((a1[1][7] || 93) && (v2 ? v1 : a0[5])));
+        v1 = (((85 != v3) + (a0[5] != v1)) <= ((v1 * v0) > (v2 > v3)));
+        v0 = (((v3 % 9) + (v0 / 7)) ? ((a1[1][4] != a1[2][15]) / 6) : ((v1 % 5) - (a1[2][10] + 64)));
+    } else {
+        a1[2][0] = (((a1[1][8] <= a1[1][3]) + (a0[3] && 30)) >= ((v0 / 9) <= (a1[0][6] && a0[12])));
+        a1[0][1] = (((v3 * 92) > (v1 + 97)) != ((v0 + v1) && (a0[6] <= v2)));
+        v2 = (((61 + a0[5]) + (v0 * v0)) - ((32 % 1) % 5));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            if ((v0 || 81) > 59) break;
+            a1[2][6] = (((26 && i4) != (v0 > a1[2][1])) > ((v2 ? a0[12] : v2) && (38 + 36)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a1[1][5] = (((27 - a0[14]) / 1) ? ((v0 % 8) / 1) : ((v0 != 23) < (42 / 4)));
+                a1[1][8] = (((a0[10] - i5) && (v0 - 38)) && ((v0 - a1[2][10]) == (v2 % 3)));
+                v2 = (((v3 * 20) || (24 + v3)) != ((92 <= a0[1]) && (a1[1][10] != 50)));
+            }
+            v0 = (((i4 < i4) && (v0 ? v0 : 23)) % 7);
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((a0[13] % 3) < (a1[3][10] * a1[0][8])) || ((v3 >= a1[3][12]) != (a0[6] != 27)));
+    v2 = (((v2 ? v1 : v0) != (90 <= a1[1][6])) ? ((v2 != v3) * (a1[0][4] < v0)) : ((40 - v0) ? (35 || a0[6]) : (a0[0] >= v2)));
+    {
+        int i6 = 0;
+        do {
+            v3 = (((77 >= v2) < (a1[0][2] && v2)) + ((v1 && v3) - (a1[0][4] * v0)));
+            v1 = (((v2 == 99) >= (28 != 65)) < ((a1[0][4] - v1) < (v1 && 69)));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((v2 ? 0 : 28) ? (v0 >= a1[1][11]) : (v1 != v1)) <= ((a0[9] - v0) % 6));
+                    a1[3][9] = (((v1 + v0) - (77 || a0[5])) + ((v3 % 3) > (37 ? i7 : v1)));
+                    a0[14] = (((i6 || a0[2]) != (v1 + 11)) / 9);
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    {
+        int i8 = 0;
+        do {
+            v3 = (((11 || a1[3][13]) || (21 * 44)) > ((v2 + a0[0]) <= (v2 || a1[2][15])));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                if ((a1[2][4] == 41) > 55) break;
+                a0[12] = (((v1 >= 97) <= (v0 >= v2)) > ((a0[7] ? 48 : v1) || (a1[3][10] ? a1[1][11] : v2)));
+                v0 = (((52 >= a0[9]) % 2) != ((a1[2][0] <= v2) * (v0 > i9)));
+                a1[0][9] = (((i8 + v2) + (57 + 17)) > ((i9 / 1) - (i8 != v1)));
+            }
+            v1 = (((v2 || v0) == (96 ? 54 : 78)) ? ((68 >= v3) + (90 - 76)) : ((i8 - i8) ? (a1[3][10] % 8) : (v1 || v2)));
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    return (((a1[2][13] >= v2) + (v3 == v1)) * ((v1 < v3) != (38 <= v3)));
+}
+int f1() {
+    int v0 = 63;
+    int v1 = 32;
+    int v2 = 83;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((34 >= a1[0][6]) > 72) break;
+        {
+            int i1 = 0;
+            do {
+                a1[3][10] = (((i1 == v0) != (a0[9] >= 58)) < ((v2 >= a0[15]) >= (a1[3][13] ? 37 : v0)));
+                v0 = (((a1[0][15] > 80) / 7) / 8);
+                v0 = (((i1 - a0[7]) >= (i0 + a0[11])) >= ((v0 || v2) < (a0[6] + 37)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        a1[0][6] = (((v0 * v3) != (a1[2][6] <= i0)) ? ((v1 || 14) - (v3 == i0)) : ((i0 * 33) >= (i0 == v3)));
+        v1 = (((v1 > a1[1][11]) && (i0 == v1)) ? ((a0[11] % 1) / 2) : ((7 <= v3) >= (a1[3][7] + i0)));
+    }
+    if ((((v0 ? 43 : a1[0][9]) - (a0[2] < v2)) > ((v3 > 60) < (a0[4] <= a0[7])))) {
+        a0[5] = (((27 && v3) || (a1[3][13] ? v1 : 27)) && ((10 + 62) % 3));
+        a0[6] = (((v0 && 90) && (v3 < v2)) * ((v0 > v1) != (a0[6] <= v3)));
+        v1 = (((v3 == v1) == (21 > a0[12])) < ((v0 + v3) + (v2 <= a0[12])));
+    } else {
+        v2 = (((v0 < v1) ? (v2 >= v3) : (v3 != v1)) * ((v0 >= v0) % 4));
+        a0[7] = (((87 > v1) * (v3 - 2)) || ((71 > a0[8]) >= (v3 && 19)));
+        v1 = (((a0[9] < a0[4]) * (a1[2][5] ? 43 : 77)) || ((v0 > v1) * (a1[1][11] && v2)));
+    }
+    v2 = (((v2 >= a1[2][14]) / 8) > ((12 ? a0[8] : a1[1][11]) <= (v2 - v3)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a1[3][5] = (((v1 && v2) + (v1 / 8)) >= ((29 <= 4) / 8));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v3 = (((12 || v3) > (62 && 9)) ? ((5 == a1[2][10]) != (a1[1][8] ? 9 : v0)) : ((v3 && i3) && (a0[0] <= v1)));
+                v0 = (((77 != 3) && (47 == v1)) ? ((a1[2][2] > i3) < (a0[11] > v3)) : ((v3 / 9) * (v0 <= v1)));
+                a1[0][0] = (((72 != v2) || (43 == i3)) && ((a0[1] && i2) ? (i3 >= a0[15]) : (a0[1] / 8)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((a0[14] < a1[2][6]) / 6) != ((v3 < i2) % 1));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v3 = (((a0[9] - 91) <= (i4 % 2)) / 6);
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v2 = (((i4 && 32) && (v3 / 9)) / 8);
+            a1[2][6] = (((v3 > v2) * (a1[1][15] || 96)) ? ((v0 % 8) ? (i5 >= a1[0][12]) : (i4 % 6)) : ((55 ? a0[10] : i4) && (a0[9] * a1[3][4])));
+            v2 = (((v3 - v3) < (v2 > v3)) <= ((i4 / 7) % 9));
+        }
+        v0 = (((35 < a1[3][3]) + (63 % 3)) + ((v3 > a1[1][1]) / 4));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v0 = (((45 >= 41) * (v0 / 9)) * ((v2 == a1[2][8]) < (7 && 28)));
+            v0 = (((v2 - 69) % 5) >= ((v1 / 2) * (44 ? a1[2][12] : a1[1][12])));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v3 = (((a0[6] || a1[1][7]) ? (58 < 53) : (i6 || 61)) && ((i6 + 88) > (a0[3] + v1)));
+                    a0[12] = (((i7 * a0[1]) ? (a1[2][9] || i7) : (v1 ? v1 : v3)) % 7);
+                    v2 = (((a0[15] && a0[12]) * (2 < a0[2])) * ((i7 && a0[6]) > (a1[2][0] <= 76)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v2 == v0) > (a0[6] || v3)) / 7)) {
+        v2 = (((a1[3][3] < v3) >= (a0[6] ? v0 : v2)) != ((a1[2][6] ? v3 : v2) * (86 <= v3)));
+        v3 = (((22 > a1[0][7]) * (4 + v2)) || ((85 ? 1 : 9) - (a1[0][15] || v3)));
+        v3 = (((v0 <= v2) != (v0 < v3)) != ((62 / 7) * (59 != 65)));
+    } else {
+        v0 = (((v1 || v2) <= (a1[0][5] / 4)) == ((v0 * a0[7]) != (21 <= 80)));
+        a0[13] = (((v0 || v3) / 1) <= ((18 > v3) ? (v0 && a1[3][2]) : (81 > a1[1][3])));
+        v0 = (((62 + a0[2]) != (53 / 4)) % 9);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            a0[12] = (((29 != 5) / 8) && ((v1 > v0) == (79 <= 25)));
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                if ((98 ? 40 : 90) > 61) break;
+                v3 = (((62 + 58) != (v1 / 3)) < ((i9 ? a1[1][7] : a0[5]) > (9 ? a0[0] : v0)));
+                a0[1] = (((i8 < i8) > (i8 + 42)) / 2);
+                v2 = (((85 > a0[2]) == (33 && i8)) + ((85 && a0[13]) < (a0[1] > v3)));
+            }
+            v0 = (((v2 ? v3 : v3) != (v2 - 52)) >= ((0 >= a1[0][8]) || (v0 <= a1[0][5])));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v2 ? a1[3][12] : 50) * (a0[13] ? v2 : 14)) == ((a0[0] ? v3 : 38) - (v2 <= 84)))) {
+        v2 = (((a0[12] * v3) == (8 < 4)) > ((v0 < v1) - (v2 ? v1 : v3)));
+        v2 = (((a0[8] % 2) / 3) % 2);
+        a0[10] = (((1 * v0) + (49 ? a0[12] : a1[1][4])) * ((v2 && v0) % 2));
+    } else {
+        v1 = (((a1[1][1] - v0) >= (a1[2][0] != 95)) && ((69 ? v0 : a1[1][7]) + (4 < v0)));
+        v1 = (((a0[7] ? v2 : a1[0][9]) + (a1[1][15] / 8)) ? ((v1 != v2) == (a0[5] || 97)) : ((v3 * v1) < (v3 <= a1[1][14])));
+        v3 = (((v0 != v1) ? (a1[0][7] % 5) : (v1 / 4)) + ((a0[13] >= a0[6]) % 8));
+    }
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        v3 = (((v3 + v2) <= (43 <= a0[4])) || ((93 == v2) > (a0[1] && 47)));
+        v1 = (((v0 == a0[10]) - (v0 || 83)) < ((13 != 7) % 8));
+        for (int i11 = 0; i11 < 7; i11 = i11 + 1) {
+            v1 = (((82 * i11) ? (v0 && 59) : (5 != v0)) + ((11 < a1[2][9]) || (i11 * i10)));
+            v3 = (((i10 / 5) != (50 > a1[0][11])) ? ((v1 ? 60 : a1[1][8]) > (v3 == a0[8])) : ((v2 && 77) >= (v2 == v2)));
+            v1 = (((94 != v0) >= (47 * 36)) + ((75 || i11) / 2));
+        }
+    }
+    return (((57 + a1[0][8]) != (a0[15] == a1[1][7])) >= ((v3 || v2) == (v2 % 2)));
+}
+int f2() {
+    int v0 = 86;
+    int v1 = 76;
+    int v2 = 82;
+    int v3 = 98;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[13] < a1[0][7]) && (v0 - v2)) % 2);
+    a1[3][15] = (((v0 + 68) > (a1[0][8] > a0[12])) != ((v0 == v0) - (v0 + a1[1][1])));
+    if ((((v3 ? a1[3][14] : v3) + (v2 != 52)) == ((a0[14] && v0) && (a1[1][3] < v0)))) {
+        v2 = (((v0 % 7) > (v2 + v1)) + ((v2 && 23) - (13 / 6)));
+        v2 = (((a1[2][0] >= v1) == (v2 != 8)) >= ((9 ? v1 : v1) != (a1[1][8] < v3)));
+        v2 = (((v3 || v3) < (v1 > v3)) > ((a1[2][8] > v1) <= (v1 % 7)));
+    } else {
+        a1[3][14] = (((a1[2][3] != v3) == (v1 || a0[10])) >= ((v2 * v1) && (a0[10] || a1[2][10])));
+        v1 = (((a0[1] * a0[7]) * (a0[6] != a0[12])) || ((v2 < v2) ? (a0[14] == 93) : (v0 - 32)));
+        v0 = (((v2 / 5) * (v3 * 98)) - ((99 - 96) ? (65 + v2) : (v1 && v0)));
+    }
+    v1 = (((v2 == 45) ? (v0 <= 9) : (a1[3][2] - v0)) == ((v3 + v0) - (v3 <= v2)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v2 = (((a0[1] * a1[3][5]) ? (v1 || 80) : (v1 + v1)) || ((i0 == a0[4]) != (v3 && v1)));
+            {
+                int i1 = 0;
+                do {
+                    a0[2] = (((42 >= a1[0][4]) - (i1 * a1[1][8])) / 5);
+                    v3 = (((a0[1] ? v2 : v0) - (a1[1][9] ? 22 : v1)) % 1);
+                    v0 = (((a1[0][8] * v2) < (a1[0][0] || v3)) % 3);
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v0 = (((i0 && 74) - (5 / 6)) ? ((30 + i0) ? (a1[3][6] * v0) : (81 < v0)) : ((a1[3][5] / 1) ? (v0 == 90) : (a0[14] > v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v1 = (((v2 != v0) != (v1 % 5)) != ((a0[8] / 2) * (a1[2][15] >= 85)));
+            a0[5] = (((i2 ? a1[2][2] : a0[5]) && (v1 - a0[5])) == ((v2 + v0) && (v0 - 43)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                if ((v1 * 91) > 89) break;
+                a1[3][4] = (((v1 <= a0[7]) != (a1[3][7] > a0[4])) <= ((a0[0] < 72) < (96 % 9)));
+                a1[3][12] = (((i2 * a1[2][3]) - (33 / 9)) % 8);
+                v3 = (((v0 >= 87) || (43 && v0)) + ((39 / 6) || (a1[0][11] * v3)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((a1[2][8] * v0) + (v3 > a1[0][1])) == ((a1[2][12] && v1) ? (v3 % 5) : (26 < 43)));
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v0 >= a0[5]) + (a1[3][11] * 23)) ? ((a1[3][13] - 18) <= (v0 - v0)) : ((44 || i4) ? (98 ? i4 : i4) : (5 ? a0[5] : a0[10])));
+            v1 = (((i4 ? 96 : 27) / 1) <= ((a0[1] + v3) && (a0[14] ? 36 : 4)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    if ((i4 && i5) > 70) break;
+                    v1 = (((i5 > 73) || (v2 + 92)) && ((v2 % 2) / 3));
+                    v2 = (((68 % 3) < (a1[0][8] > v3)) > ((v0 + v0) >= (v2 ? v3 : v0)));
+                    v1 = (((a1[1][0] <= 61) >= (9 >= a1[3][6])) != ((i5 != v3) < (a0[14] % 4)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    v0 = (((a0[4] != v2) != (a0[14] * v2)) + ((a0[7] != v2) * (61 <= v0)));
+    if ((((a1[1][15] == v3) >= (a1[1][8] ? v0 : 77)) == ((56 * a1[2][8]) + (v2 - v1)))) {
+        v3 = (((v3 < v3) * (a0[7] < a1[3][10])) ? ((a1[3][4] ? a1[0][12] : v2) / 5) : ((a1[1][15] * v2) % 6));
+        v3 = (((a1[3][11] || v1) != (v3 / 3)) * ((a0[0] ? v3 : v0) || (v3 - a1[3][15])));
+        a0[6] = (((v3 && v2) < (a0[7] && 3)) == ((v3 && v1) ? (v0 >= v3) : (v1 % 6)));
+    } else {
+        v1 = (((88 && 2) && (83 + v1)) >= ((78 / 3) ? (v0 || a1[3][5]) : (v3 < 93)));
+        v1 = (((85 - v3) >= (54 <= a0[6])) != ((a0[12] > 88) == (22 ? v2 : v3)));
+        a0[6] = (((v0 % 9) <= (v0 * 95)) ? ((v3 - v2) + (v0 / 9)) : ((a0[3] >= v3) * (v2 < v2)));
+    }
+    return (((a0[5] + v0) + (a0[6] >= 8)) > ((44 && a1[2][12]) > (21 < v1)));
+}
+int f3() {
+    int v0 = 82;
+    int v1 = 37;
+    int v2 = 25;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                if ((i0 + 72) > 93) break;
+                v3 = (((v1 != v2) >= (79 < a1[1][2])) > ((a0[9] ? i0 : i0) ? (v0 || a0[3]) : (i1 && 62)));
+                v0 = (((a0[10] + i0) >= (i0 <= v1)) && ((64 * i0) == (i0 * v3)));
+                v1 = (((76 && 20) == (a1[1][10] - 80)) * ((a0[2] == v2) ? (v2 * a0[14]) : (a1[3][1] - i1)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v3 = (((65 ? a1[3][12] : v1) - (0 < v2)) == ((94 / 6) < (66 - v0)));
+        v1 = (((v2 / 8) % 2) == ((v0 <= a1[1][11]) >= (v3 - v0)));
+    }
+    v0 = (((80 && 69) - (v0 + a0[12])) - ((v1 ? 71 : 69) ? (11 ? v0 : v0) : (v3 < v2)));
+    v1 = (((v0 + a0[7]) && (v2 + a1[1][2])) % 6);
+    v3 = (((v3 <= v0) && (v2 < 42)) ? ((v0 % 7) && (v3 || v2)) : ((v1 && v1) >= (v1 != a0[8])));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((a1[1][4] ? a0[14] : 56) == (v3 <= 76)) != ((10 * 55) % 7));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                if ((a0[4] * v3) > 73) break;
+                a1[2][9] = (((53 > i3) ? (a1[0][3] || 53) : (36 + 76)) - ((35 > 18) != (98 % 5)));
+                a0[2] = (((a0[7] ? i2 : v1) + (i2 < i3)) != ((i2 && a1[2][3]) - (a0[4] - i2)));
+                a1[1][2] = (((a0[10] <= a1[0][6]) * (v3 != 19)) - ((a1[3][6] > v3) ? (i3 > v1) : (98 <= v0)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((78 || i2) * (81 ? a1[2][14] : v1)) ? ((20 > a0[6]) > (50 >= a1[3][1])) : ((v0 % 2) / 3));
+    }
+    if ((((a0[9] || a0[10]) <= (v3 >= v1)) < ((77 ? v1 : a1[2][0]) - (v0 && 66)))) {
+        v0 = (((v2 ? 77 : v1) % 9) != ((v0 ? v1 : a0[4]) * (v0 != v0)));
+        v2 = (((v3 == v2) % 7) >= ((v2 ? a0[15] : 89) != (v0 < 67)));
+        a1[3][14] = (((48 <= v1) / 7) - ((v3 / 5) / 5));
+    } else {
+        v0 = (((v3 != 67) % 6) <= ((a1[2][15] - a1[3][0]) ? (v3 % 2) : (a1[2][0] >= a0[0])));
+        v2 = (((v2 && v0) && (v0 * v3)) % 3);
+        v2 = (((v0 ? a1[1][2] : v0) - (36 > v0)) * ((10 - v3) && (v1 || 60)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    if ((a0[1] > a1[3][8]) > 86) break;
+                    v1 = (((v2 || a0[12]) > (v3 ? a1[1][5] : v0)) % 3);
+                    v0 = (((v1 % 3) < (55 && a0[0])) - ((v3 - i4) == (a0[11] < 51)));
+                    v0 = (((1 && 43) || (a1[2][11] == 89)) < ((v2 && v3) >= (a1[0][12] > v2)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((40 % 9) && (v3 < v3)) + ((v3 > v1) ? (a1[1][15] % 6) : (v1 / 7)));
+            a1[1][11] = (((60 && v1) * (a1[1][5] || 4)) && ((52 && i4) && (13 % 3)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((a0[12] * 69) > 87) break;
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                v2 = (((i6 > a0[8]) - (i6 % 2)) < ((9 ? 36 : 14) >= (v3 && v2)));
+                a1[2][14] = (((a1[1][8] > v2) && (v3 > 48)) - ((59 && 71) <= (a1[0][10] % 4)));
+                v2 = (((v0 / 8) - (i7 != v1)) ? ((i6 * v2) * (v3 != i6)) : ((12 > a0[8]) > (a1[0][6] != a1[1][11])));
+            }
+            a1[2][7] = (((83 ? v2 : 97) < (v0 * a1[3][3])) && ((i6 < v1) <= (94 ? 23 : v3)));
+            v3 = (((v2 * 88) < (v1 >= v1)) != ((a0[5] && v3) && (v2 / 2)));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    if ((((v1 >= v1) && (a1[1][3] < v3)) <= ((v0 >= v3) && (7 == v2)))) {
+        a0[15] = (((v2 % 8) / 2) < ((v1 && 42) == (v3 % 9)));
+        a1[3][1] = (((v0 % 3) - (v3 || v0)) % 1);
+        v0 = (((v0 > v2) || (41 != 56)) && ((a0[12] <= v3) > (v1 || v2)));
+    } else {
+        a0[0] = (((a1[2][7] == v0) ? (v0 > v2) : (v2 >= v2)) <= ((a0[7] % 7) != (v0 && v1)));
+        v3 = (((v1 != v3) < (a1[0][11] && v1)) % 9);
+        v2 = (((v2 || 19) ? (57 * v3) : (1 / 5)) - ((v2 && v3) == (v0 / 2)));
+    }
+    v1 = (((a1[0][1] / 1) ? (a1[0][8] ? a1[1][9] : 18) : (v0 * v1)) && ((a1[0][13] >= a0[2]) == (v2 || v0)));
+    return (((v0 > 96) - (a1[2][3] != v2)) / 5);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
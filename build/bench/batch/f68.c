@@ -0,0 +1,133 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 35;
+    int v2 = 69;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 % 7) * (v1 ? a0[4] : 76)) || ((v2 >= a1[2][5]) ? (79 ? v3 : v1) : (18 > v0)))) {
+        a0[9] = (((v3 % 6) * (9 - v2)) == ((v2 <= v1) * (74 > 97)));
+        a1[1][5] = (((v3 >= 12) && (a0[9] ? v3 : 5)) - ((v1 * a1[3][4]) && (a0[15] == v3)));
+        v0 = (((0 && 57) < (28 && v2)) <= ((91 % 2) % 8));
+    } else {
+        a1[0][14] = (((a0[11] + 43) ? (v1 % 4) : (v2 * v2)) > ((v2 == a1[1][10]) <= (v1 < v3)));
+        v2 = (((v1 && v1) >= (a1[2][9] / 9)) ? ((60 ? a0[6] : a0[12]) + (v2 + 68)) : ((v1 / 4) ? (75 != a1[0][9]) : (44 < v1)));
+        a1[0][15] = (((a0[5] / 9) - (v1 == a1[0][14])) + ((24 && v2) + (93 - v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((v3 + v3) > 87) break;
+                    a1[1][13] = (((27 > 58) != (a1[0][9] > a0[11])) >= ((70 ? i1 : i1) - (67 || v2)));
+                    v1 = (((v1 * v2) == (v3 ? v2 : v0)) >= ((a0[5] < 21) ? (a0[8] || i1) : (i0 % 3)));
+                    a1[0][9] = (((67 || a0[13]) < (a1[0][0] % 8)) % 9);
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((i0 > v3) <= (85 >= v1)) != ((v0 * i0) ? (v0 >= v0) : (v2 == 20)));
+            v0 = (((i0 % 2) % 6) - ((a1[0][5] < 77) != (i0 >= 88)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                if ((15 || i3) > 65) break;
+                a0[5] = (((a0[13] >= a0[15]) < (a0[1] ? v1 : v2)) * ((i2 + v1) > (a1[2][6] > v0)));
+                v0 = (((a1[1][7] >= v0) % 3) && ((v1 >= a0[5]) % 8));
+                a0[4] = (((i2 % 1) ? (i2 != i2) : (a1[2][5] % 9)) * ((a0[13] + a0[2]) >= (a0[9] != i2)));
+            }
+            a0[11] = (((v1 > 99) >= (a0[4] == a0[0])) == ((a0[1] || 34) <= (70 * v1)));
+            v3 = (((i2 || a1[1][8]) > (v0 < a1[1][6])) != ((v0 != i2) != (v1 >= v2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((a0[12] == v2) > 92) break;
+            a1[2][12] = (((i4 % 7) > (a1[0][1] * a0[2])) ? ((a1[0][10] < v2) || (a1[3][11] != v3)) : ((i4 % 5) * (a0[15] != v0)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((a1[1][9] >= v2) > 93) break;
+                    v0 = (((a1[1][11] ? 99 : v3) && (a0[13] * 21)) + ((v1 / 4) >= (v0 - 85)));
+                    v2 = (((v1 ? i5 : i5) || (a1[3][15] <= v3)) >= ((66 ? v1 : a0[5]) + (v1 * v2)));
+                    a1[2][7] = (((57 < i5) % 5) ? ((v2 % 6) >= (v1 || i4)) : ((v2 != a1[1][14]) ? (v2 && v2) : (88 == 9)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((46 == 85) % 6) ? ((v3 + 8) % 2) : ((0 / 3) || (a1[2][0] ? 40 : v0)));
+            i4 = i4 + 1;
+        }
+    }
+    a1[2][11] = (((v3 + v3) / 1) % 6);
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v0 = (((a0[2] - v3) < (a0[10] ? a1[1][3] : v1)) >= ((99 != 76) / 5));
+        a0[10] = (((i6 < v0) != (38 ? 34 : a1[0][6])) ? ((v0 ? v1 : a1[2][14]) / 2) : ((v2 * v1) + (i6 % 3)));
+        {
+            int i7 = 0;
+            do {
+                a1[3][0] = (((i7 ? v1 : i7) > (v1 < 14)) < ((90 > 79) < (a1[0][1] != 37)));
+                a1[1][11] = (((a0[14] * 78) < (v2 * v2)) % 2);
+                v1 = (((88 / 7) < (v1 ? v1 : v3)) ? ((i6 > v0) != (a0[14] >= v3)) : ((a1[0][0] - v0) * (v3 * 51)));
+                i7 = i7 + 1;
+            } while (i7 < 3);
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((v0 - a1[1][8]) < (v1 ? a1[1][6] : 4)) / 7);
+                    v2 = (((a0[6] - a0[12]) ? (7 >= a0[5]) : (v2 ? 53 : 43)) * ((v3 ? v0 : v0) >= (30 / 3)));
+                    v1 = (((1 == 90) - (v3 * 13)) - ((a0[10] >= v2) || (a1[0][12] - a0[9])));
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            a1[0][5] = (((i8 / 3) && (i8 ? a0[1] : 93)) || ((v3 >= 79) <= (a1[3][0] <= 48)));
+            v0 = (((v3 <= v0) + (a1[1][1] % 9)) != ((32 && 24) - (v0 != 33)));
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    if ((((64 >= 66) / 9) + ((v0 > v3) ? (v2 + 98) : (a0[7] || v3)))) {
+        v1 = (((v3 - v1) ? (a1[1][8] - a1[1][10]) : (v1 ? a1[0][6] : v2)) - ((a0[14] * a1[2][0]) <= (a1[2][7] > v1)));
+        v0 = (((v3 <= v0) % 5) || ((v0 || v1) * (v2 ? a1[0][2] : 21)));
+        a0[8] = (((v3 != a1[3][9]) == (v3 < v0)) != ((57 ? v0 : v0) != (a1[0][0] || a1[2][5])));
+    } else {
+        v0 = (((18 == v3) + (v0 == a0[13])) ? ((a1[0][11] ? v1 : v1) != (65 / 7)) : ((a1[2][12] / 7) % 1));
+        a1[2][15] = (((a0[6] || a0[11]) <= (v1 >= a1[0][3])) + ((v2 > a1[3][3]) == (v1 || v1)));
+        a0[3] = (((38 != 38) ? (16 > a1[1][12]) : (a1[3][9] == v1)) < ((v0 / 8) || (a0[8] >= 39)));
+    }
+    v0 = (((a0[7] > v0) && (34 ? v2 : 9)) % 8);
+    {
+        int i10 = 0;
+        while (i10 < 8) {
+            if ((a0[9] % 6) > 70) break;
+            {
+                int i11 = 0;
+                while (i11 < 3) {
+                    a0[10] = (((v2 != v2) - (v3 / 5)) % 4);
+                    v3 = (((v3 >= 65) / 3) - ((a0[15] - a0[3]) - (v2 == a1[0][9])));
+                    v1 = (((30 % 6) < (v3 && v3)) / 2);
+                    i11 = i11 + 1;
+                }
+            }
+            v2 = (((22 < a1[0][9]) > (10 != v3)) > ((a1[1][5] > 83) || (v1 > i10)));
+            v2 = (((a1[1][3] || a1[3][8]) && (a0[2] && v0)) < ((v1 * a1[3][8]) != (a0[5] < a0[0])));
+            i10 = i10 + 1;
+        }
+    }
+    return (((v0 || v2) || (v1 + 84)) * ((v2 - v3) % 3));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,199 @@
+int f0() {
+    int v0 = 74;
+    int v1 = 18;
+    int v2 = 18;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((v0 * i0) > 75) break;
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v0 = (((15 != a1[2][8]) * (38 % 7)) || ((a1[2][7] == 5) && (i1 % 4)));
+            v0 = (((a0[7] * i1) != (v3 > a1[3][12])) > ((a1[2][7] ? a0[6] : a1[1][0]) ? (56 * 0) : (a0[15] <= v3)));
+            v2 = (((v0 * 84) ? (i0 + a1[2][3]) : (v1 * a0[9])) / 7);
+        }
+        v2 = (((v2 && v3) || (i0 <= v3)) > ((34 && a1[3][8]) ? (v3 % 9) : (v1 <= v3)));
+        v3 = (((i0 <= v3) - (v2 ? a0[11] : 14)) || ((42 + v3) != (a1[1][6] <= 86)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v2 = (((v3 * a0[12]) ? (54 + a1[3][14]) : (a0[11] + v2)) ? ((a0[2] >= 19) / 8) : ((62 > v2) ? (i2 ? v3 : i3) : (v3 == v1)));
+            a0[15] = (((v1 ? v2 : 51) <= (v3 && v3)) >= ((i3 || i3) < (v3 < i3)));
+            v2 = (((v1 < v1) * (18 ? 57 : a0[2])) - ((i2 % 3) && (i3 - v3)));
+        }
+        a0[8] = (((a1[2][4] <= a0[14]) == (v1 != i2)) % 9);
+        a0[3] = (((a0[13] ? 73 : v3) != (v1 + 42)) / 7);
+    }
+    if ((((v3 == a1[0][7]) != (v1 <= a0[12])) - ((a1[1][8] ? v3 : v1) * (95 ? a1[0][2] : v2)))) {
+        a0[14] = (((v0 + 42) % 9) != ((v0 < v0) / 5));
+        a0[6] = (((a0[12] || v0) <= (v1 && a0[13])) * ((a0[8] < v0) ? (v3 * a1[1][12]) : (19 != a1[1][10])));
+        v3 = (((v0 / 6) < (a1[3][12] != v0)) ? ((v2 ? a0[6] : a0[2]) < (a0[6] - a0[9])) : ((v0 / 8) != (v1 == a1[3][12])));
+    } else {
+        v1 = (((v2 ? a1[0][13] : v1) > (v0 && v1)) >= ((v2 < a0[14]) < (a0[3] != v3)));
+        v1 = (((a0[3] < v1) / 3) / 1);
+        a0[1] = (((a1[0][5] / 6) || (v3 / 5)) != ((v1 + v2) * (1 == v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((i4 == v3) || (v3 == 67)) ? ((v2 > v1) % 8) : ((18 * v2) < (a0[1] != v0)));
+            a1[2][11] = (((a1[1][11] || 73) ? (v1 > i4) : (38 / 3)) == ((62 || 90) >= (a0[10] + i4)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((54 ? v0 : a1[3][15]) / 7) % 4);
+                    v2 = (((i4 == v0) / 5) - ((a1[2][15] + v2) && (i4 * v0)));
+                    v3 = (((i5 == a0[15]) % 7) % 6);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v3 = (((i6 >= v2) == (78 || v3)) <= ((v0 <= a0[4]) >= (v0 + v1)));
+        v1 = (((v1 != a1[3][3]) || (v0 + v0)) || ((a1[0][2] * i6) + (38 / 7)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                v2 = (((i7 ? i7 : a0[8]) ? (99 == v0) : (i7 ? v2 : a0[6])) != ((v2 * a0[12]) / 2));
+                v0 = (((i6 == v3) >= (i6 % 2)) * ((v2 % 4) || (92 + 67)));
+                v2 = (((v3 != v3) / 7) / 4);
+                i7 = i7 + 1;
+            }
+        }
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        v3 = (((a1[3][9] % 4) * (v2 / 3)) - ((a1[1][2] <= 85) || (v3 <= i8)));
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                v1 = (((86 <= 72) <= (85 >= v1)) / 3);
+                v3 = (((a0[7] - v1) ? (v0 == i8) : (a0[2] * v3)) != ((i9 <= a1[0][4]) != (83 == v3)));
+                a1[0][8] = (((96 <= v1) * (i9 > i8)) ? ((a0[7] > a0[15]) < (a1[2][14] * v3)) : ((a1[0][13] % 5) - (i8 ? v1 : v2)));
+                i9 = i9 + 1;
+            }
+        }
+        v1 = (((42 > 77) - (a1[3][8] && v3)) < ((v1 * v3) || (53 > v3)));
+    }
+    v3 = (((v2 < 32) < (62 * 69)) && ((v1 / 5) > (v1 < 65)));
+    {
+        int i10 = 0;
+        do {
+            {
+                int i11 = 0;
+                do {
+                    v0 = (((a1[2][1] ? v3 : v1) == (a0[10] * v3)) > ((v3 / 2) ? (v3 < 33) : (56 != v2)));
+                    a0[4] = (((a0[0] % 9) / 3) ? ((v1 || 15) <= (i11 * 53)) : ((v3 / 7) < (a1[2][3] * 81)));
+                    v0 = (((v3 * v3) * (0 * i10)) != ((a1[1][0] % 9) % 5));
+                    i11 = i11 + 1;
+                } while (i11 < 5);
+            }
+            a1[2][7] = (((v1 && a0[15]) + (v2 && v3)) / 4);
+            a1[2][9] = (((a1[2][5] && a1[2][1]) / 5) * ((v3 ? 29 : a1[1][4]) != (v1 || a0[8])));
+            i10 = i10 + 1;
+        } while (i10 < 8);
+    }
+    {
+        int i12 = 0;
+        while (i12 < 8) {
+            a1[1][7] = (((31 <= a1[1][8]) || (v3 / 8)) % 7);
+            v0 = (((91 / 1) - (53 != a0[9])) || ((63 < 48) <= (9 != a1[2][11])));
+            for (int i13 = 0; i13 < 7; i13 = i13 + 1) {
+                v1 = (((v0 * a1[0][11]) % 1) % 1);
+                v0 = (((i12 + i13) + (a1[3][9] ? v0 : v2)) > ((a0[14] >= a0[13]) / 8));
+                v1 = (((v0 <= 68) > (a1[0][11] || i12)) + ((a0[8] ? v3 : i12) || (78 || 77)));
+            }
+            i12 = i12 + 1;
+        }
+    }
+    a0[13] = (((a0[5] - a1[1][5]) / 3) / 6);
+    return (((v0 && a1[0][4]) || (v0 % 4)) * ((37 == a0[4]) - (v2 != a0[13])));
+}
+int f1() {
+    int v0 = 40;
+    int v1 = 41;
+    int v2 = 84;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][4] = (((13 && a1[1][5]) != (a1[3][10] > v2)) ? ((v3 < a1[1][10]) - (58 >= a0[3])) : ((i0 < 72) > (a1[3][7] / 7)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v2 = (((v1 < v0) || (v3 == v3)) - ((v3 ? v0 : v0) >= (i1 % 1)));
+                v2 = (((v1 * 52) && (a1[1][11] - a1[3][11])) <= ((76 || 25) ? (i0 >= v2) : (v1 - v3)));
+                a0[15] = (((v1 + a1[3][10]) ? (a1[2][2] + v3) : (i0 % 1)) > ((a1[1][1] - a1[2][12]) < (v3 ? 81 : v0)));
+            }
+            v3 = (((v1 % 3) * (96 * v3)) - ((v0 != a0[5]) == (v3 >= 17)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[3][8] = (((a0[10] % 3) || (i2 != v0)) ? ((v3 >= v1) ? (a1[1][11] == v3) : (i2 != i2)) : ((65 - a0[6]) ? (94 / 6) : (5 ? a0[8] : a0[5])));
+            a1[2][4] = (((v2 <= v3) + (v1 >= 70)) % 8);
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((98 ? v1 : 44) != (a0[13] <= 0)) % 9);
+                    v3 = (((64 / 8) + (v1 || 14)) / 4);
+                    v0 = (((67 != v1) != (60 < a0[5])) + ((41 > v2) != (v2 == i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    v3 = (((v3 ? v3 : v1) - (a1[3][6] / 1)) || ((a0[10] == a0[10]) <= (a0[8] == v1)));
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((81 && i4) > 89) break;
+        a1[2][2] = (((i4 < i4) < (i4 < 78)) >= ((i4 ? v0 : i4) || (v3 <= v3)));
+        v0 = (((a0[5] - v2) % 9) / 3);
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            if ((89 == 90) > 90) break;
+            a1[1][9] = (((a1[3][8] || v1) * (i4 || v3)) ? ((a1[2][15] ? i4 : a0[6]) < (a0[15] != a0[9])) : ((v0 - a1[1][10]) * (a1[2][14] / 1)));
+            a1[3][1] = (((a0[1] / 5) + (a0[9] || 53)) <= ((13 ? a0[15] : v1) && (68 || v2)));
+            a0[13] = (((v0 + v3) ? (97 / 8) : (a1[1][4] % 6)) ? ((i5 ? a1[0][2] : a1[1][6]) != (i5 ? v2 : a1[1][6])) : ((33 <= a1[1][11]) && (v0 && v0)));
+        }
+    }
+    if ((((a0[11] <= v1) == (a1[1][7] - 95)) != ((a0[8] > 8) < (88 < a1[0][14])))) {
+        a1[0][9] = (((v2 ? v2 : v3) ? (81 % 4) : (v0 * a0[3])) < ((v3 == 37) - (v0 > v0)));
+        v2 = (((a1[0][13] - v2) / 8) ? ((v1 || 4) - (a0[6] * a0[13])) : ((a1[1][1] % 7) / 7));
+        v1 = (((2 < 73) < (v3 ? a1[2][0] : 19)) > ((v0 + 16) == (84 + v0)));
+    } else {
+        v1 = (((v0 ? 26 : v3) <= (v0 || v3)) ? ((v3 % 8) != (a1[1][1] == a1[0][7])) : ((52 > v0) < (a1[2][13] || v3)));
+        v0 = (((v2 > v2) % 2) * ((v1 * v2) / 2));
+        v0 = (((76 == a0[12]) <= (a0[11] * v0)) >= ((v2 && a0[0]) < (a0[13] > v3)));
+    }
+    v3 = (((v1 ? 42 : 5) - (v1 || 47)) - ((v1 >= a1[1][1]) ? (30 && a0[8]) : (v1 + v0)));
+    v0 = (((a1[2][13] * 77) * (a0[1] - v1)) != ((v2 - 44) - (v1 < a0[1])));
+    a1[0][9] = (((v1 ? v2 : 63) / 7) < ((42 && a0[4]) <= (v0 < a0[3])));
+    if ((((v0 || v3) * (v2 == v1)) == ((69 * v2) || (v3 <= a0[15])))) {
+        v1 = (((a0[5] || v2) + (v2 <= a1[3][2])) == ((v0 > v2) ? (a1[3][1] || v1) : (a1[1][9] ? 99 : 76)));
+        v1 = (((v3 <= a0[15]) * (v0 % 3)) && ((v2 ? a0[13] : 57) || (a0[4] ? v3 : v1)));
+        a0[11] = (((v1 >= v0) && (v3 != a1[2][13])) - ((1 ? v3 : a0[0]) < (v2 ? v0 : v3)));
+    } else {
+        v0 = (((v2 && v1) ? (21 <= v2) : (14 <= a0[4])) ? ((14 - v0) == (v1 <= v1)) : ((a1[0][10] - a0[13]) != (v0 && 23)));
+        v3 = (((77 > v1) % 8) + ((a1[3][13] > 96) ? (a1[3][14] && 7) : (v2 == a1[2][13])));
+        v2 = (((v1 + v0) - (0 ? 17 : v3)) >= ((38 && v2) ? (a0[11] < 6) : (v3 == v1)));
+    }
+    if ((((32 != v2) != (5 >= a0[10])) + ((a0[4] != v0) >= (52 >= v0)))) {
+        v2 = (((v1 % 9) <= (24 * 6)) / 6);
+        a1[2][10] = (((v3 && v1) ? (3 > a0[6]) : (v0 - 18)) != ((v2 != v3) % 4));
+        v2 = (((v1 <= v0) != (a1[3][7] / 9)) <= ((68 >= v1) - (v1 / 7)));
+    } else {
+        v3 = (((v2 > a1[3][9]) < (v0 * 29)) && ((33 && 88) + (v2 && v1)));
+        v0 = (((v0 ? v3 : v2) + (v1 + 46)) != ((v0 ? 33 : v1) * (v3 != v1)));
+        a0[5] = (((v1 * v3) >= (a0[1] == v3)) <= ((v3 + a1[1][7]) < (v2 <= v3)));
+    }
+    return (((30 <= v1) >= (a1[2][12] != 81)) || ((v0 >= a0[2]) / 4));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,487 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 48;
+    int v2 = 81;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((a1[2][1] != v3) * (i0 == 73)) ? ((a0[9] + 5) != (v2 && v3)) : ((37 + v3) >= (a1[3][13] - v0)));
+            v2 = (((v2 - v0) > (v2 != v3)) && ((v3 % 4) < (v3 > v3)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a1[2][3] = (((v1 >= v0) - (29 % 7)) - ((i0 + a0[8]) - (i0 <= v2)));
+                    v3 = (((80 / 5) > (i1 == 36)) && ((v1 || v0) + (v3 ? a1[2][6] : i0)));
+                    v2 = (((v2 <= a1[3][13]) < (56 + 2)) || ((v2 + v1) ? (82 * a0[2]) : (80 <= a0[13])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((v0 * a0[3]) > 67) break;
+            v3 = (((3 <= v0) > (v3 - v1)) == ((a0[3] != a0[10]) * (a0[12] == 22)));
+            a0[1] = (((v0 <= v1) != (a0[12] > v1)) <= ((a0[8] && 12) - (12 != v0)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v2 = (((41 < i2) >= (v2 * i3)) / 5);
+                v2 = (((51 + a0[15]) * (v2 ? 81 : a1[3][1])) ? ((v3 || 74) - (a1[2][5] && v1)) : ((46 - a1[0][1]) && (i2 || v3)));
+                v0 = (((86 + a0[8]) > (i2 < a1[0][1])) - ((v3 < i2) <= (a0[2] * a0[3])));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[0][13] >= 19) + (a1[3][9] ? v2 : a1[3][5])) / 2)) {
+        a0[2] = (((v1 > v0) ? (a0[13] > 82) : (3 != v1)) < ((25 != v2) ? (a0[6] % 5) : (v2 - a0[6])));
+        a1[1][15] = (((a0[15] != 59) / 1) != ((v2 || a1[2][7]) <= (32 != a1[1][3])));
+        v2 = (((a1[0][7] ? v2 : a1[2][3]) / 3) ? ((v0 != v2) + (v0 < v1)) : ((v0 <= a1[2][2]) + (a0[7] ? a1[0][2] : v1)));
+    } else {
+        a1[2][3] = (((a0[11] * v1) < (8 < v0)) + ((a0[8] && v0) - (76 && v2)));
+        v3 = (((18 - v0) != (v1 > 69)) || ((83 / 2) * (v1 + v1)));
+        v0 = (((a0[6] && v3) || (a1[0][7] - a0[8])) / 8);
+    }
+    if ((((v2 < v2) >= (v2 || v1)) * ((v2 != 78) != (v3 - v3)))) {
+        a1[2][10] = (((51 <= v2) * (43 > v1)) > ((a0[1] + a1[3][5]) && (73 > 97)));
+        v2 = (((30 ? v2 : v3) > (v0 && a1[2][6])) < ((v1 != a0[11]) ? (v2 && v1) : (v1 + 72)));
+        v1 = (((a1[2][10] >= 41) <= (v0 ? 87 : v3)) % 8);
+    } else {
+        a1[0][4] = (((25 == v3) || (v3 < v0)) ? ((84 != a1[2][11]) ? (v3 / 3) : (a1[0][1] % 8)) : ((47 + 70) ? (v2 - v3) : (v1 != 49)));
+        a0[15] = (((a1[0][6] * 27) > (a1[3][6] ? 16 : a0[3])) ? ((v3 + 44) != (v3 <= a1[3][14])) : ((v0 / 5) < (80 ? v1 : 76)));
+        a0[10] = (((v3 ? 30 : a1[3][5]) != (v3 <= a1[1][5])) * ((v1 > v2) ? (v3 ? v3 : v1) : (v0 > v0)));
+    }
+    if ((((81 >= v1) * (a1[3][10] < v1)) + ((31 >= 74) + (49 > v3)))) {
+        v1 = (((v1 || a0[10]) % 4) == ((v1 < a1[2][0]) * (v2 >= a1[3][13])));
+        a1[2][5] = (((v0 <= v2) ? (a0[7] == 39) : (v3 * v2)) - ((98 <= v0) >= (45 == 90)));
+        v0 = (((a1[3][6] - v3) ? (v3 && v0) : (76 / 4)) / 7);
+    } else {
+        v1 = (((v1 * a1[0][7]) && (45 && v0)) < ((85 % 2) && (23 != a1[3][8])));
+        v0 = (((6 <= v1) <= (59 != v2)) < ((v2 / 8) == (a1[1][6] - a1[3][13])));
+        v1 = (((a1[0][13] == v1) != (64 * v2)) >= ((a1[1][12] ? v1 : v3) * (82 == v3)));
+    }
+    if ((((v1 == v2) >= (a0[0] % 8)) <= ((v1 >= 58) ? (v3 / 1) : (v2 ? 59 : 51)))) {
+        v0 = (((v3 / 2) < (v1 < 49)) || ((a0[6] % 6) * (v0 && a1[0][8])));
+        v2 = (((v1 ? 46 : v2) + (52 <= a1[2][2])) == ((v1 != 25) != (v1 != a1[3][4])));
+        v0 = (((84 && v1) ? (10 < v0) : (v1 > v0)) / 1);
+    } else {
+        v3 = (((v3 >= 67) || (v0 || a1[0][12])) ? ((a0[11] == 6) / 7) : ((v3 % 4) >= (v2 % 6)));
+        a1[2][0] = (((v3 != v2) || (v2 ? v0 : a0[6])) == ((5 + v0) ? (68 >= v1) : (1 > v3)));
+        v0 = (((v0 + 3) / 9) + ((a0[6] % 9) != (a1[1][15] != v1)));
+    }
+    if ((((v1 == v0) > (v0 > 88)) == ((v2 && v3) >= (a1[3][11] && v3)))) {
+        v3 = (((v2 == v1) + (a1[2][11] > 27)) && ((36 ? 26 : v0) && (a0[9] * 18)));
+        v0 = (((61 - v3) == (79 ? a1[0][9] : v0)) && ((a0[3] || v1) + (77 > 50)));
+        v3 = (((93 + 81) == (v3 / 6)) == ((18 != a1[3][0]) && (v0 % 7)));
+    } else {
+        v3 = (((a1[3][12] && a1[3][15]) ? (v1 / 1) : (3 && 70)) != ((v0 / 6) ? (v0 < v1) : (v2 && a0[7])));
+        v3 = (((21 != 53) || (a1[1][0] > v2)) % 2);
+        v1 = (((25 <= v1) != (v1 ? v0 : v0)) == ((v3 <= 38) ? (v0 ? v1 : a1[3][7]) : (v1 != 28)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((72 != a0[10]) > 81) break;
+                    a0[12] = (((a1[2][8] % 2) && (36 ? v2 : i5)) ? ((v0 && 88) != (a0[4] < i4)) : ((27 + v1) && (a1[1][14] && a1[1][6])));
+                    a1[1][8] = (((a1[0][13] / 7) + (i5 * i4)) ? ((97 < v3) == (91 ? v1 : v3)) : ((v3 != a1[1][0]) != (51 >= i5)));
+                    v1 = (((v2 < a0[7]) / 2) < ((v3 / 8) + (64 || v2)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v2 ? 8 : 49) / 2) - ((v0 < a1[0][6]) || (i4 / 8)));
+            v3 = (((i4 != v0) + (i4 * i4)) ? ((75 || v2) + (v3 == v1)) : ((i4 > v2) % 2));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((61 == 44) > 67) break;
+            v0 = (((v3 && 69) - (i6 / 1)) * ((a1[0][5] ? a0[11] : a0[6]) + (a0[10] || i6)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    a1[2][0] = (((68 * i7) > (v0 % 1)) % 4);
+                    v2 = (((v0 / 1) < (38 > i6)) / 9);
+                    v1 = (((a1[2][8] <= a1[1][5]) / 2) == ((v0 >= 63) ? (42 ? a0[11] : a0[0]) : (27 < i7)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((a0[12] > v3) + (i6 > v1)) != ((v3 - v3) != (v0 || v3)));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    if ((((a0[4] ? a0[0] : 69) % 6) - ((v1 <= v2) * (a0[10] && a1[3][7])))) {
+        v1 = (((v3 != a0[14]) % 2) * ((31 ? v3 : 67) > (v0 - 36)));
+        a1[1][7] = (((a1[1][9] ? 10 : v1) * (8 >= 44)) && ((a1[0][8] < v3) - (v1 + v3)));
+        v1 = (((v0 - v3) || (a0[5] % 4)) <= ((44 != v3) ? (v2 * v1) : (v2 - a1[0][9])));
+    } else {
+        v1 = (((v1 ? v1 : 52) && (v1 >= 16)) * ((a0[0] - a1[3][11]) > (v2 != v0)));
+        v3 = (((v2 / 4) > (a0[1] >= v2)) == ((a0[13] % 9) || (0 * v3)));
+        v2 = (((v2 - a1[1][3]) % 8) != ((v2 + 86) % 9));
+    }
+    return (((0 > v3) * (v0 >= 41)) >= ((89 ? 45 : 20) < (a0[4] ? a1[0][7] : v2)));
+}
+int f1() {
+    int v0 = 59;
+    int v1 = 72;
+    int v2 = 38;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 || 93) * (a1[2][13] - a0[1])) && ((v3 + 5) < (v0 || v3)))) {
+        v2 = (((a1[2][10] <= v2) - (a0[5] == v1)) == ((14 / 5) != (a1[0][3] != a0[5])));
+        v3 = (((35 == a1[1][4]) >= (14 / 5)) * ((v2 % 7) + (54 * a1[3][13])));
+        a1[2][7] = (((a0[9] || v3) + (v3 + a0[6])) ? ((v1 != a0[15]) && (62 * v3)) : ((v1 + a1[2][5]) * (a1[1][10] + v1)));
+    } else {
+        v2 = (((a0[9] + v0) == (99 * 6)) > ((a0[5] % 2) > (v0 && v2)));
+        v0 = (((97 - v0) ? (v3 > v3) : (v2 / 6)) < ((v2 ? a0[5] : v1) ? (a0[15] == v1) : (1 && 37)));
+        v0 = (((15 > 9) != (70 <= a0[14])) * ((84 % 9) != (16 != a0[5])));
+    }
+    a1[0][13] = (((v1 && v3) > (v2 ? v3 : v2)) < ((v1 + v0) >= (62 ? a1[3][0] : v0)));
+    if ((((91 > a0[15]) ? (v1 != 51) : (v2 % 2)) && ((v3 ? a1[0][8] : v1) > (a1[2][2] / 5)))) {
+        v2 = (((v2 >= 91) == (v0 + a1[1][12])) || ((v0 == v3) || (v0 - a1[2][11])));
+        v2 = (((a1[1][8] % 1) >= (v1 >= 20)) ? ((17 % 4) && (v2 >= v3)) : ((v3 - v3) != (a0[15] % 9)));
+        a0[15] = (((v2 || v0) && (v1 != v0)) >= ((v2 || 63) && (v3 * a1[1][1])));
+    } else {
+        v3 = (((v0 ? 75 : v3) ? (v0 <= 84) : (a0[1] ? v3 : v2)) ? ((82 && a0[14]) % 3) : ((v3 <= v0) / 4));
+        v0 = (((55 || v0) <= (v3 * a0[10])) != ((32 && a1[0][7]) == (v0 ? v3 : v2)));
+        a0[14] = (((v3 != a1[3][2]) != (v1 == 43)) != ((a1[3][11] - a0[9]) && (v3 % 8)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((a1[1][14] * 75) > 60) break;
+        v2 = (((v0 < v2) ? (v2 % 9) : (v0 != i0)) && ((v1 || a0[5]) < (a0[14] * v1)));
+        v1 = (((a0[8] < v1) != (a1[2][4] ? v2 : 61)) ? ((v2 > 42) == (a0[6] == 33)) : ((76 ? a1[3][5] : a0[3]) - (v2 / 2)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                v1 = (((v2 || a1[3][6]) % 8) <= ((v2 > v1) * (i0 ? a1[3][14] : 34)));
+                v2 = (((a0[7] || v2) - (81 + v3)) - ((v1 / 2) ? (v1 <= v3) : (a1[3][1] < 62)));
+                v2 = (((80 && 3) ? (i0 % 6) : (v3 / 3)) >= ((97 == v3) && (68 < v2)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v0 = (((v2 % 5) || (70 * 63)) != ((v3 <= v1) == (a0[3] || 53)));
+        v0 = (((a1[3][3] / 1) < (v1 > a1[3][4])) / 8);
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v3 = (((i3 || 13) > (a0[4] * a1[2][14])) > ((v2 != v3) && (a0[15] - 67)));
+            v1 = (((5 ? i3 : v1) ? (v3 && v2) : (v2 / 1)) <= ((26 != v2) || (a0[14] < 11)));
+            v0 = (((i2 != a1[2][10]) % 9) % 6);
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((a1[2][1] >= a1[2][14]) > 91) break;
+            a0[14] = (((v3 <= a1[3][13]) > (v3 == a1[2][11])) + ((v1 % 2) + (68 == a1[0][2])));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v0 = (((32 ? a0[2] : v1) ? (v0 - i4) : (11 % 7)) % 7);
+                a1[3][11] = (((i4 >= v3) == (80 && a1[3][12])) + ((a0[8] > 67) - (a0[0] == 20)));
+                a0[3] = (((i4 && v1) < (i5 && v1)) < ((v3 ? v1 : i5) ? (82 && i5) : (50 >= v2)));
+            }
+            a0[9] = (((i4 % 1) != (64 * i4)) <= ((a1[1][15] || v1) * (i4 + v3)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v2 = (((86 >= 38) <= (2 % 7)) ? ((a0[3] != i6) / 5) : ((67 && i6) == (v1 ? 22 : v0)));
+            {
+                int i7 = 0;
+                do {
+                    if ((v2 >= v3) > 84) break;
+                    v2 = (((v0 / 3) + (v2 >= v2)) ? ((v2 && v3) == (i6 < a0[9])) : ((54 / 7) / 4));
+                    v3 = (((a1[1][10] || v2) ? (a1[3][15] > v2) : (57 > 2)) < ((v1 ? 57 : a0[1]) * (i6 ? a1[3][2] : v0)));
+                    v3 = (((v2 <= v0) >= (v0 && 50)) + ((i7 || v1) <= (86 <= v2)));
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            v0 = (((a0[12] > 71) >= (v0 * v3)) / 8);
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    v1 = (((94 ? v3 : v1) + (v3 - a1[1][10])) ? ((v3 == v3) && (a1[0][2] || 80)) : ((v0 ? 51 : v1) ? (v1 / 4) : (2 || v3)));
+    if ((((v0 * v2) - (66 < a1[3][15])) != ((a1[0][11] != v1) > (v3 + v0)))) {
+        v3 = (((a1[3][9] > a1[2][10]) == (v1 > 0)) > ((v0 && 37) >= (v2 < 63)));
+        v1 = (((a1[0][9] + v1) && (v1 + 35)) == ((v0 || v1) || (32 < v2)));
+        v3 = (((v1 ? v3 : v0) - (v2 ? v3 : 1)) + ((84 / 7) && (v2 % 9)));
+    } else {
+        v0 = (((v0 ? v3 : a0[0]) ? (7 >= v2) : (a1[1][9] - v3)) > ((a1[2][12] * v2) < (a0[1] <= a1[0][13])));
+        v3 = (((a0[9] >= 45) ? (12 ? a1[0][15] : v1) : (a0[11] % 8)) < ((12 * v0) && (v2 >= 17)));
+        v1 = (((89 > v3) == (v2 != 73)) > ((a0[5] || a1[0][4]) != (18 || a0[8])));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            a0[12] = (((a0[0] && a0[15]) != (68 == 87)) >= ((v2 ? 79 : 21) == (2 > a0[15])));
+            v3 = (((a0[11] - v3) / 1) / 4);
+            {
+                int i9 = 0;
+                do {
+                    v2 = (((a1[3][1] % 7) + (a1[1][2] >= v2)) && ((67 - v0) >= (91 - a1[1][14])));
+                    v1 = (((v0 ? a1[3][9] : v2) - (77 != v3)) / 5);
+                    a0[11] = (((i9 == 88) < (i8 == a1[2][11])) != ((v2 && a1[1][5]) % 5));
+                    i9 = i9 + 1;
+                } while (i9 < 2);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v1 + 62) ? (48 - a1[3][8]) : (a1[1][10] < 38)) + ((v1 < a1[0][13]) >= (a0[4] - a1[0][4])));
+}
+int f2() {
+    int v0 = 65;
+    int v1 = 60;
+    int v2 = 60;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                do {
+                    if ((i1 * 38) > 63) break;
+                    v2 = (((96 == a1[3][1]) * (i0 <= v0)) * ((i0 * i1) > (i1 || v3)));
+                    a1[2][13] = (((a1[3][6] >= v1) >= (v1 != i1)) <= ((16 == a1[1][15]) < (35 && 77)));
+                    v2 = (((v1 - v1) == (v3 - v3)) < ((v2 / 8) == (i1 % 2)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a0[1] = (((a0[7] && 74) % 4) % 2);
+            v1 = (((a1[3][15] == i0) && (v0 * a0[14])) || ((a0[0] ? v2 : a1[2][9]) + (v0 && v2)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 >= a1[2][15]) + (v0 >= 77)) % 9)) {
+        v2 = (((v1 && 12) % 6) <= ((v3 ? a1[2][5] : a1[2][14]) == (v3 + v1)));
+        v0 = (((v1 - 77) < (v3 && a0[0])) > ((v0 > 6) || (27 != 72)));
+        v2 = (((v1 / 2) || (71 / 4)) == ((v2 && v0) - (a1[0][5] / 2)));
+    } else {
+        v2 = (((v0 <= a1[0][0]) ? (v2 / 5) : (59 ? v0 : v1)) != ((v2 % 2) * (a1[3][9] + v2)));
+        v3 = (((7 && a1[3][6]) - (68 + 73)) >= ((v1 / 5) / 2));
+        v3 = (((71 < v1) / 3) != ((a0[12] ? a0[9] : a0[6]) * (v0 % 8)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v1 = (((a0[2] + a0[0]) / 8) > ((a0[10] < v0) * (v1 * 55)));
+        v1 = (((v0 ? a0[13] : a1[1][0]) / 7) < ((v2 && a0[15]) * (v1 * a0[11])));
+        {
+            int i3 = 0;
+            do {
+                a0[11] = (((i3 % 4) * (78 && a1[2][12])) >= ((v1 != a0[4]) >= (9 && 44)));
+                v0 = (((i2 - 16) != (v1 <= v2)) % 3);
+                v3 = (((a0[8] || i2) + (v0 < 46)) + ((v3 > v3) ? (i3 + i3) : (v3 || v2)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v1 = (((89 >= v2) ? (a0[13] < v1) : (v2 ? v0 : v1)) - ((a1[0][7] ? a1[1][3] : v1) < (88 * v0)));
+        v1 = (((58 % 3) % 2) * ((86 <= i4) < (v2 > 63)));
+        {
+            int i5 = 0;
+            do {
+                v2 = (((v3 ? i4 : a0[10]) % 5) || ((48 * v0) > (v0 - a0[4])));
+                v0 = (((a1[2][0] || 16) ? (a1[1][1] - i4) : (a1[3][15] % 2)) / 4);
+                a1[3][10] = (((1 <= 14) / 4) != ((v1 != a1[3][13]) <= (v0 == a1[2][14])));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                a0[10] = (((v2 > 85) - (a0[12] % 9)) - ((v1 || 94) * (v2 - i6)));
+                a0[5] = (((a0[15] ? v1 : a0[11]) % 5) % 6);
+                v3 = (((v0 < 52) % 1) >= ((90 > i6) * (a1[2][2] <= a1[1][3])));
+                i7 = i7 + 1;
+            } while (i7 < 2);
+        }
+        a1[0][6] = (((a1[2][0] % 7) < (58 ? 56 : i6)) == ((30 % 8) * (v2 < 65)));
+        v1 = (((8 >= 21) + (v1 || i6)) % 8);
+    }
+    if ((((26 + a0[10]) > (a0[2] + v3)) || ((29 <= 25) ? (v0 % 3) : (a1[3][3] || v1)))) {
+        v0 = (((97 || v3) != (a1[3][13] + v3)) % 5);
+        v1 = (((a0[2] < v1) % 7) != ((v2 - 8) == (v0 / 1)));
+        a0[8] = (((v2 % 6) > (v2 * 21)) / 2);
+    } else {
+        a1[0][0] = (((v1 * v2) < (a0[7] % 9)) || ((v1 ? v2 : a1[1][2]) ? (16 + a1[0][14]) : (59 == a1[3][15])));
+        v2 = (((v2 + v1) ? (v1 ? v1 : v1) : (a1[3][2] % 5)) ? ((89 ? v2 : 37) + (a1[1][3] % 8)) : ((v2 <= v1) - (v0 >= v2)));
+        v0 = (((a1[2][4] != a0[15]) != (v1 != 88)) * ((13 != v2) % 4));
+    }
+    v3 = (((v3 != 14) != (a1[0][5] == a0[6])) != ((v3 * 31) ? (v0 + 72) : (a0[4] + a1[3][14])));
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            a1[1][7] = (((5 - a1[3][11]) <= (v1 <= 49)) >= ((a1[1][6] > i8) ? (i8 >= a1[2][15]) : (v2 - v1)));
+            for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+                v3 = (((44 % 5) != (a1[0][1] - 95)) != ((78 || i8) / 5));
+                v1 = (((v0 % 7) ? (i9 / 3) : (v1 || a1[3][1])) && ((v2 && v2) || (v0 > v1)));
+                v2 = (((a0[12] - 55) - (13 / 6)) >= ((i8 >= 75) != (i9 * v3)));
+            }
+            a0[8] = (((5 / 5) || (a1[3][4] <= v1)) <= ((62 * 46) >= (57 + a1[1][3])));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((19 > v1) < (a1[1][9] > 65)) ? ((74 < a0[13]) && (v2 * v3)) : ((v0 || v2) / 8))) {
+        v0 = (((98 ? v3 : a0[10]) - (v2 != v3)) != ((v3 % 4) + (v1 == 80)));
+        v0 = (((26 < v3) && (v2 < v0)) || ((49 <= v1) ? (v3 - 60) : (50 * v1)));
+        v2 = (((a1[3][0] * v3) < (15 != a0[0])) <= ((v3 ? v2 : v3) * (46 ? 79 : v3)));
+    } else {
+        a1[3][3] = (((a0[8] <= v3) % 9) + ((v1 ? 96 : v2) + (55 >= 43)));
+        v0 = (((v3 <= 45) * (v3 ? v3 : v3)) - ((v3 % 1) % 7));
+        v0 = (((92 % 5) && (a0[8] || 55)) ? ((76 % 3) - (a0[12] < v0)) : ((22 == v3) % 4));
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((v2 > a1[2][8]) > 87) break;
+            {
+                int i11 = 0;
+                do {
+                    if ((85 - v0) > 50) break;
+                    a1[0][7] = (((88 * 12) / 8) || ((v1 && v2) + (v3 / 6)));
+                    v3 = (((v1 <= a1[2][4]) * (v2 && 79)) || ((v1 ? v2 : i11) ? (v2 == v0) : (i11 / 2)));
+                    v1 = (((v0 != 47) >= (97 || i11)) != ((a1[0][6] || 90) - (23 / 3)));
+                    i11 = i11 + 1;
+                } while (i11 < 2);
+            }
+            v3 = (((v1 + i10) + (v0 || v2)) <= ((v0 ? a1[2][4] : a0[4]) ? (i10 >= a0[5]) : (a1[2][8] / 3)));
+            v1 = (((97 - v3) < (i10 - v3)) + ((56 / 4) != (i10 != i10)));
+            i10 = i10 + 1;
+        } while (i10 < 5);
+    }
+    return (((v0 / 9) + (a1[0][9] / 9)) % 8);
+}
+int f3() {
+    int v0 = 70;
+    int v1 = 1;
+    int v2 = 72;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 + a0[3]) + (20 ? v0 : v2)) && ((a0[3] && v1) < (v0 < a0[4])));
+    if ((((86 || 28) != (a0[14] - v3)) && ((v0 != 83) > (24 <= 22)))) {
+        v1 = (((v3 > v1) % 5) - ((v0 % 4) + (a1[3][14] ? v2 : v0)));
+        v3 = (((0 >= v3) >= (a0[15] ? v1 : v2)) || ((a0[9] * a1[1][11]) * (18 >= v1)));
+        a1[3][5] = (((42 % 2) > (v0 == 28)) <= ((v2 < v3) / 3));
+    } else {
+        v2 = (((v3 <= v1) < (11 % 6)) || ((a0[5] >= v0) >= (a0[1] ? a1[1][14] : v1)));
+        v1 = (((v1 % 8) ? (v2 - a0[1]) : (32 && v2)) % 2);
+        v3 = (((70 >= v1) ? (v3 != v1) : (v2 ? 68 : v2)) + ((v1 < v3) > (8 && v2)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v3 = (((v2 || i1) || (63 && 93)) < ((v0 * v0) > (99 / 4)));
+                a1[0][0] = (((80 >= 89) / 2) % 4);
+                v3 = (((v1 != v2) - (a1[0][8] ? a0[1] : 2)) != ((a1[3][2] != i1) == (a1[0][7] == v3)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v3 = (((i0 == a0[8]) + (29 || v2)) != ((12 + i0) < (56 > a0[4])));
+        a1[1][8] = (((a0[2] <= a0[8]) ? (v1 < v3) : (v2 % 7)) - ((v3 ? v2 : 10) ? (a0[1] ? 99 : a1[2][2]) : (v3 - 95)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[0][1] - 38) > 55) break;
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    a0[2] = (((a1[2][11] / 8) - (a0[10] != i3)) % 9);
+                    v3 = (((i2 - 77) == (v2 ? 87 : v3)) ? ((i2 != i3) / 4) : ((66 > 75) % 6));
+                    v3 = (((v3 <= v1) ? (23 || a1[0][8]) : (v3 * v1)) == ((v2 <= v2) && (a0[12] >= v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[14] = (((74 * 17) != (v1 <= a0[7])) && ((i2 && v3) / 9));
+            a1[2][0] = (((v2 ? a1[2][9] : 10) / 4) % 7);
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v1 = (((37 - 10) < (a0[7] % 9)) != ((v0 + a0[8]) + (v0 ? 0 : v3)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v2 = (((55 ? v2 : 7) % 6) ? ((v1 / 8) % 6) : ((76 + a0[15]) < (63 > a1[2][12])));
+                a1[2][5] = (((a0[8] != v0) || (i5 * i4)) + ((v3 + a1[3][6]) / 8));
+                v1 = (((53 * v0) && (a0[2] == v0)) - ((49 != 42) || (30 < v0)));
+            }
+            v2 = (((27 > 62) <= (v2 >= 31)) >= ((v1 >= a0[4]) + (v2 ? i4 : v0)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        v3 = (((v0 >= a0[14]) * (a1[0][8] <= v0)) > ((v1 * 13) <= (a1[3][9] > 59)));
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                v1 = (((a0[13] ? a1[0][12] : v0) - (a1[0][3] % 3)) < ((i7 % 4) || (a0[4] ? 2 : v2)));
+                v1 = (((i6 != 70) / 6) < ((v3 <= 96) % 6));
+                v2 = (((15 && 7) % 6) >= ((i7 || v3) - (a0[14] < a1[3][1])));
+                i7 = i7 + 1;
+            }
+        }
+        v2 = (((v3 < a1[3][13]) * (v2 && a0[13])) ? ((i6 && a1[2][0]) < (v0 ? v2 : 58)) : ((a1[0][14] && v3) >= (v0 - v3)));
+    }
+    if ((((v0 ? 37 : a0[9]) - (a0[8] >= 83)) >= ((a1[0][8] != v0) >= (v1 != a0[2])))) {
+        v1 = (((47 % 8) <= (a0[14] / 4)) - ((83 - v1) == (22 > 9)));
+        v0 = (((a1[0][11] ? v0 : v1) >= (63 < a1[2][11])) % 5);
+        v3 = (((3 && a0[1]) > (23 - 71)) < ((v2 <= v3) + (v0 <= a0[8])));
+    } else {
+        a1[3][0] = (((a1[0][12] / 2) > (v3 / 1)) < ((a0[3] + 23) > (a0[3] >= v3)));
+        a1[0][12] = (((v3 >= v1) || (v0 >= v0)) != ((a1[0][7] == 59) && (a0[6] > 12)));
+        v0 = (((v3 < 82) % 8) - ((v0 * a0[2]) == (43 < a0[13])));
+    }
+    if ((((94 != a0[11]) / 6) * ((76 <= v1) < (v0 * a1[0][10])))) {
+        a0[14] = (((a1[0][11] < 80) * (a1[1][6] == v3)) + ((v0 == 35) + (v1 * v2)));
+        v3 = (((a1[1][9] >= v2) + (a1[1][7] % 1)) <= ((v0 >= v3) <= (v0 > a0[10])));
+        v3 = (((v0 == 27) * (a0[6] && a1[3][12])) / 7);
+    } else {
+        v0 = (((77 != v3) && (33 + v1)) != ((v1 == 45) != (v3 > v3)));
+        v3 = (((v0 ? 38 : a0[8]) / 3) * ((v2 || v1) < (a1[2][3] ? v3 : 93)));
+        v3 = (((36 - a1[3][2]) >= (71 == v1)) + ((a0[3] && 43) < (a0[10] ? v2 : v1)));
+    }
+    v2 = (((v0 <= 72) != (a0[3] != v0)) && ((44 - v1) - (v2 <= 12)));
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            v1 = (((i8 || v3) ? (99 ? a1[3][7] : v2) : (a0[5] % 4)) >= ((v2 <= a0[15]) && (v3 < v3)));
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    if ((v0 < a1[2][14]) > 97) break;
+                    v2 = (((v1 % 3) >= (a1[1][4] >= 1)) * ((a1[3][10] != v0) || (85 > v2)));
+                    v0 = (((a0[14] / 8) <= (v3 != i8)) + ((a1[1][15] <= v3) == (v0 == v2)));
+                    a0[11] = (((i9 && v2) < (v1 && 85)) ? ((a0[3] / 7) / 3) : ((i9 - 3) * (v1 > i8)));
+                    i9 = i9 + 1;
+                }
+            }
+            v1 = (((a1[0][7] || a1[1][7]) >= (v1 <= v1)) ? ((39 && 12) - (60 ? a0[5] : a0[1])) : ((i8 < a0[12]) && (a1[0][6] != a0[7])));
+            i8 = i8 + 1;
+        }
+    }
+    return (((81 < v1) <= (v1 < v0)) % 6);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
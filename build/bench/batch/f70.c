@@ -0,0 +1,323 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 37;
+    int v2 = 71;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v2 % 6) < (51 < 20)) * ((v3 ? v2 : 65) >= (v0 == v3)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v2 && v0) > 67) break;
+                    v0 = (((v3 ? v2 : v1) ? (80 / 5) : (v0 + v2)) > ((34 / 2) / 7));
+                    v0 = (((6 == v0) <= (v1 != v3)) ? ((i1 != 12) < (i0 - a0[5])) : ((v0 >= v3) / 7));
+                    a1[0][8] = (((23 <= 95) - (v2 ? a0[15] : i0)) / 2);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v3 = (((v0 != v2) == (v1 - 3)) - ((v2 || 8) != (v2 ? 87 : v3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v0 || a1[2][2]) > 96) break;
+            v3 = (((a1[3][6] ? v0 : i2) % 9) != ((68 || v2) <= (v0 * v2)));
+            {
+                int i3 = 0;
+                do {
+                    a0[4] = (((v1 % 2) ? (a1[2][7] && v1) : (a1[3][4] > a1[2][15])) || ((v1 * v2) || (i3 > a1[3][15])));
+                    v3 = (((37 ? v3 : v2) != (16 > a1[2][5])) != ((v0 % 2) ? (a1[3][1] % 5) : (i3 * v2)));
+                    v3 = (((v1 != v1) % 9) <= ((i3 ? a0[1] : v3) + (v0 >= v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            v3 = (((53 && v2) != (i2 - i2)) >= ((23 >= a1[3][8]) ? (95 || i2) : (a1[1][11] < v3)));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v1 < 39) < (v3 / 7)) + ((49 || 21) > (55 <= a1[0][12])));
+    if ((((v2 <= a0[11]) || (v1 * v2)) != ((a1[1][6] || v1) == (v1 % 2)))) {
+        a0[8] = (((52 / 8) < (v2 <= a1[0][11])) + ((16 && 88) != (v0 ? 67 : 38)));
+        v2 = (((a1[2][14] || 33) - (v0 || v0)) % 4);
+        v0 = (((a0[3] > 11) <= (v2 + a1[2][15])) ? ((a0[6] * a0[14]) < (a1[1][9] - v0)) : ((v3 ? v3 : a0[15]) && (v0 + a0[3])));
+    } else {
+        v1 = (((v3 % 4) / 2) != ((14 || v1) ? (v3 ? v2 : a1[0][8]) : (a1[2][13] ? v3 : a1[1][14])));
+        v3 = (((v0 && a0[5]) ? (a1[1][4] != v3) : (a1[3][6] != v2)) && ((v1 != v1) % 9));
+        v0 = (((v2 / 1) ? (v3 || v0) : (v3 && 94)) == ((v2 && v2) ? (a1[2][2] == 53) : (61 > 7)));
+    }
+    if ((((9 == a1[1][5]) <= (v1 && 70)) * ((v1 <= v2) < (v3 != a0[4])))) {
+        a0[13] = (((a0[2] == a0[11]) ? (v2 == a0[12]) : (v1 && a1[1][12])) > ((a0[1] - v0) % 5));
+        v1 = (((v3 && v3) ? (v1 > v3) : (v1 ? a1[3][15] : a1[2][3])) * ((v1 <= v0) != (v3 <= v3)));
+        v2 = (((v3 <= a1[1][10]) && (v3 != a0[5])) ? ((a0[12] > a1[3][1]) ? (v0 >= v3) : (73 < v1)) : ((v2 >= a0[8]) % 1));
+    } else {
+        v2 = (((a0[0] ? v3 : 44) > (v1 || 95)) < ((v3 || v0) < (v1 == v2)));
+        a1[3][1] = (((v2 ? a0[4] : v3) && (v3 <= 8)) == ((2 >= v0) / 8));
+        a0[13] = (((v2 == v3) != (v2 / 8)) % 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v2 >= 96) && (v1 != a0[5])) <= ((37 || a0[13]) + (75 % 7)));
+            {
+                int i5 = 0;
+                do {
+                    if ((a1[2][9] + v0) > 54) break;
+                    a0[2] = (((a0[0] * v2) / 4) / 7);
+                    v1 = (((v0 * v2) >= (a0[1] >= i4)) + ((91 - a0[15]) && (a0[7] * a1[1][1])));
+                    v2 = (((v1 && i5) + (a0[1] != i5)) > ((a0[5] * 83) || (a1[1][8] + a0[15])));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            a0[13] = (((21 == a1[0][2]) + (i4 % 1)) + ((v2 != v0) != (98 == a1[3][7])));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((82 * v3) != (78 / 3)) ? ((64 ? a1[2][8] : v1) * (v2 <= v2)) : ((36 + i6) && (v1 * 16)));
+            v0 = (((a0[8] < i6) <= (a0[12] % 4)) ? ((v2 > 27) ? (43 * v1) : (a0[1] > 93)) : ((a1[1][12] <= v1) > (v0 % 3)));
+            {
+                int i7 = 0;
+                do {
+                    if ((27 != 1) > 58) break;
+                    a1[2][12] = (((68 <= 52) >= (v3 * 95)) * ((a1[1][10] || v3) == (v2 + a0[15])));
+                    a0[15] = (((a0[8] <= a1[3][8]) >= (i7 / 2)) >= ((a1[2][14] <= a1[1][0]) > (v1 ? a0[13] : 43)));
+                    a1[2][2] = (((v2 == v2) % 5) > ((a1[3][9] <= a1[0][2]) && (1 < v3)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            a1[3][14] = (((v0 + v2) > (a1[3][6] % 4)) <= ((v1 * a1[2][6]) ? (v3 < v2) : (55 - v2)));
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                v0 = (((v0 ? v1 : a1[2][5]) == (v0 <= a0[6])) && ((i9 < v0) || (v3 > v1)));
+                v1 = (((v0 >= a1[0][2]) ? (44 / 9) : (98 < v3)) || ((a1[2][2] > a1[2][2]) + (a0[10] < v0)));
+                a1[1][3] = (((77 == v2) * (50 <= 76)) / 9);
+            }
+            a0[8] = (((a1[2][2] + a0[4]) ? (89 || a0[1]) : (i8 >= v0)) && ((v2 < a1[2][1]) != (43 * 53)));
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        do {
+            a0[6] = (((v2 ? 48 : v1) && (a0[6] ? v2 : v1)) < ((i10 > v3) * (56 + a1[0][9])));
+            a1[3][10] = (((0 && a0[8]) > (a1[1][4] >= 70)) <= ((v2 + 34) < (v2 > v1)));
+            {
+                int i11 = 0;
+                while (i11 < 6) {
+                    v2 = (((i10 * i11) || (v2 != v3)) / 4);
+                    v3 = (((v2 ? a0[11] : 26) <= (51 > a0[10])) == ((89 - a0[0]) - (81 < v2)));
+                    v0 = (((a0[1] == a0[8]) >= (21 * v3)) > ((v3 == a0[10]) >= (a1[2][1] <= v3)));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    a1[3][6] = (((a1[1][6] >= a1[2][6]) * (a1[2][14] <= a1[3][2])) * ((a1[0][3] == a0[8]) && (v0 >= v2)));
+    return (((v0 && v0) || (v1 || v0)) - ((v1 - v3) <= (38 >= a1[0][9])));
+}
+int f1() {
+    int v0 = 95;
+    int v1 = 51;
+    int v2 = 36;
+    int v3 = 66;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((91 <= v1) < (a1[1][10] * v2)) <= ((86 % 5) * (v1 || v2)));
+            {
+                int i1 = 0;
+                do {
+                    a0[3] = (((42 != i0) ? (95 - a1[2][7]) : (53 > 66)) > ((v1 > a1[1][14]) >= (v0 <= 97)));
+                    v3 = (((75 <= i1) >= (1 * v3)) ? ((i1 <= i0) && (a0[1] * 60)) : ((v3 <= i1) ? (41 ? 7 : a0[8]) : (a0[13] ? i1 : v0)));
+                    a0[1] = (((79 <= 89) + (i1 % 3)) && ((v2 % 9) * (i1 - 20)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v1 = (((a0[10] < a1[3][8]) && (v0 < 41)) ? ((v3 ? a1[2][12] : v2) <= (v2 || a0[9])) : ((47 % 8) <= (a0[6] < v2)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v2 = (((i2 <= v1) / 9) ? ((v3 >= v2) / 9) : ((v0 || i3) * (i3 ? i2 : a1[3][8])));
+                    a1[1][15] = (((v0 == v3) % 5) < ((i3 || 65) > (v0 && 57)));
+                    a1[0][3] = (((a0[4] + a1[3][10]) == (v0 == i3)) / 4);
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a1[2][9] ? a0[0] : 60) - (v0 && i2)) * ((v2 != v1) - (i2 != 18)));
+            v3 = (((a0[4] ? v1 : 79) / 2) - ((v3 ? a1[2][14] : i2) > (34 <= v3)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v1 = (((a1[3][2] > v1) > (3 < 50)) % 8);
+    {
+        int i4 = 0;
+        do {
+            v3 = (((32 % 3) * (v1 * a0[2])) / 7);
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((i4 + 3) || (a0[10] >= v3)) && ((v2 >= v2) >= (a1[3][9] >= a1[2][9])));
+                    v0 = (((70 ? 6 : a0[5]) ? (v0 == a1[3][14]) : (i5 * a0[15])) && ((a0[13] < a0[7]) * (5 > 60)));
+                    v1 = (((v3 < 1) / 5) == ((v1 == 17) && (v3 && a0[10])));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v3 = (((i4 - v2) == (15 && a0[6])) <= ((59 <= v3) <= (a1[3][13] || 74)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    v2 = (((v1 - v2) > (v1 * 20)) <= ((10 + a1[0][10]) <= (v3 * v0)));
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v0 = (((v2 ? 72 : i7) % 8) + ((56 > v2) ? (i7 + v3) : (v3 ? a1[3][6] : v2)));
+                a1[0][14] = (((a0[2] ? a0[10] : a0[8]) + (v1 <= a1[0][4])) ? ((v0 - i7) < (i7 && i7)) : ((v0 != v0) != (a0[7] >= v3)));
+                a0[9] = (((v3 - a0[0]) + (a0[14] && a0[8])) >= ((i7 ? 65 : a1[3][8]) + (a0[9] == a1[2][13])));
+            }
+            v3 = (((17 ? v3 : a0[13]) != (59 ? 55 : v3)) / 6);
+            a1[1][5] = (((54 * a1[1][6]) || (v2 * v0)) || ((v3 - v1) != (69 && i6)));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    if ((((a0[6] - a1[0][15]) % 5) && ((v3 ? v2 : v1) - (93 / 9)))) {
+        v3 = (((v1 / 1) ? (v1 ? v0 : a1[3][11]) : (v0 * v0)) - ((45 || 79) + (a1[3][13] || 34)));
+        a1[3][5] = (((96 ? v0 : v3) % 2) == ((v0 >= v2) || (a1[3][3] / 8)));
+        v1 = (((a1[1][4] != a0[7]) < (a1[0][15] ? 14 : 38)) ? ((1 / 3) - (39 / 8)) : ((v0 < v3) < (4 % 9)));
+    } else {
+        a1[3][13] = (((95 * v1) + (95 || a0[13])) / 9);
+        v3 = (((a1[3][10] >= v0) == (v1 && 24)) > ((a1[2][2] - v0) <= (v3 + a0[14])));
+        a0[0] = (((89 ? v0 : v3) != (v2 > a1[1][3])) != ((a0[3] > v0) || (a1[2][10] || v3)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    a0[8] = (((v3 != v3) - (a0[10] == 8)) || ((42 - 35) % 6));
+                    v1 = (((v3 ? v0 : v3) || (v3 % 1)) == ((37 > i9) == (a0[9] || i8)));
+                    v2 = (((a0[9] != 88) && (i8 * 14)) - ((v0 && v0) / 3));
+                    i9 = i9 + 1;
+                }
+            }
+            a0[10] = (((a0[10] % 1) || (i8 != i8)) <= ((40 * v0) / 3));
+            v0 = (((v2 * a1[2][6]) > (i8 || a1[2][2])) * ((25 && v0) && (v2 > v1)));
+            i8 = i8 + 1;
+        }
+    }
+    v1 = (((v2 >= 19) + (a1[3][6] + 58)) && ((v2 == v2) == (38 - v1)));
+    a0[4] = (((a0[7] + v0) / 8) >= ((a1[1][0] - v2) - (55 > v1)));
+    return (((61 * 66) * (v0 != v3)) - ((v3 >= v2) + (a1[2][15] ? v0 : a1[0][3])));
+}
+int f2() {
+    int v0 = 79;
+    int v1 = 79;
+    int v2 = 3;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[0][3] < v3) / 7) > ((a0[1] < a0[15]) ? (v0 < a0[12]) : (35 == 20)));
+    a0[13] = (((a0[1] < v0) ? (v0 <= v2) : (v0 != v2)) > ((16 > a0[4]) * (95 > a1[1][6])));
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v1 < v3) * (v1 ? a1[2][0] : i0)) && ((85 || 25) + (i0 <= a1[0][3])));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v1 = (((v3 * i0) % 1) / 6);
+                v0 = (((i0 ? v1 : 52) - (a1[1][7] / 8)) % 6);
+                v3 = (((i0 < 84) / 1) + ((i0 <= v3) > (a0[6] + a1[3][9])));
+            }
+            v0 = (((a1[2][2] / 9) - (v0 || v0)) >= ((a1[3][14] * v1) >= (45 != v2)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 > 4) > 80) break;
+            v2 = (((v2 || v1) ? (a1[2][3] == v0) : (82 / 9)) != ((v1 ? v1 : a1[3][11]) <= (v3 == v0)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v0 = (((i2 && 91) - (i3 * v1)) && ((i2 && v3) > (v0 >= v0)));
+                v1 = (((a0[6] / 1) || (a0[8] + a1[2][2])) + ((i3 ? v0 : v2) <= (90 < i2)));
+                v1 = (((32 && i3) % 9) && ((i3 != v0) / 1));
+            }
+            v3 = (((v0 / 3) && (a1[1][10] + 95)) - ((i2 > i2) <= (i2 <= a0[1])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v2 <= v3) || (17 && v0)) != ((30 == v3) / 1))) {
+        v2 = (((v1 < 64) + (v1 ? a0[10] : v2)) % 8);
+        v3 = (((97 ? v1 : v2) <= (a1[1][13] < v0)) <= ((83 * 17) < (a1[2][0] ? a1[2][1] : a0[8])));
+        v0 = (((v0 >= 23) && (16 % 1)) / 3);
+    } else {
+        a0[6] = (((v0 <= v0) / 2) <= ((a1[2][15] + v1) != (v1 % 5)));
+        v2 = (((a0[0] == v1) && (v2 > v2)) % 3);
+        a0[7] = (((99 * a1[1][3]) || (v3 && v1)) - ((27 && 91) > (v1 - v0)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v2 = (((v2 < 7) ? (66 + 84) : (i5 && v0)) >= ((a0[8] <= a0[9]) ? (a0[3] == v1) : (v2 < v1)));
+                v1 = (((a0[3] > a1[2][7]) % 9) >= ((19 - 91) + (i4 >= v2)));
+                v1 = (((46 - 94) == (v1 ? v1 : a1[1][1])) != ((v1 >= a0[11]) < (61 * 57)));
+            }
+            v2 = (((a1[0][1] || 87) ? (v0 != 93) : (v1 < a1[3][6])) > ((i4 ? v1 : a0[10]) % 3));
+            a0[7] = (((95 / 2) >= (a0[9] <= i4)) < ((61 && 1) / 6));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    v3 = (((v0 + v3) ? (99 / 3) : (a1[0][15] + v0)) >= ((16 ? v0 : v1) >= (v1 ? a1[0][8] : v0)));
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        if ((41 == a0[14]) > 80) break;
+        for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+            if ((a0[9] < i7) > 68) break;
+            v3 = (((i6 + 74) || (i7 + v2)) % 9);
+            v3 = (((v1 - a1[1][3]) / 8) > ((87 % 1) != (i6 <= 58)));
+            a0[0] = (((a1[2][7] ? v0 : a0[0]) != (84 * a0[11])) % 9);
+        }
+        v3 = (((14 > v3) * (0 % 5)) < ((v0 && v3) <= (67 < a0[11])));
+        v0 = (((v1 * 90) ? (a0[2] > v1) : (16 ? 46 : a1[1][13])) * ((a0[9] != v1) % 6));
+    }
+    v0 = (((v3 <= v3) + (89 == v3)) / 4);
+    if ((((a0[8] + a1[2][0]) * (a1[1][11] || a1[1][3])) - ((83 + v3) * (v0 || 6)))) {
+        a0[15] = (((73 ? v3 : v2) * (v1 == a1[2][13])) ? ((v1 % 2) < (v0 % 2)) : ((v2 >= v3) % 9));
+        v2 = (((v3 == v3) - (v1 / 6)) / 8);
+        a1[2][13] = (((v3 ? a1[1][10] : v2) && (v2 != v1)) > ((v1 * 37) > (a0[10] ? 9 : 81)));
+    } else {
+        a1[2][9] = (((v1 - 58) ? (v3 / 7) : (v3 <= 28)) ? ((v2 * a0[13]) > (v2 - v0)) : ((v2 != 38) > (32 * a1[0][10])));
+        v2 = (((v3 >= a0[2]) % 4) < ((v2 > 90) != (8 >= v1)));
+        v1 = (((a1[0][1] == v2) ? (v2 - 25) : (a1[1][8] % 9)) > ((v2 % 7) / 2));
+    }
+    return (((a0[10] % 1) || (30 <= 34)) * ((v1 + v0) % 4));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
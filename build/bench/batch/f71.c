@@ -0,0 +1,397 @@
+int f0() {
+    int v0 = 80;
+    int v1 = 43;
+    int v2 = 30;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a0[12] ? 33 : 28) != (20 >= 57)) || ((v1 > v1) >= (a1[2][7] * 87)));
+                    v2 = (((v3 < v3) >= (i1 ? 30 : a1[2][5])) ? ((i0 || a1[0][3]) + (i0 <= a1[1][15])) : ((v0 || a0[3]) != (a0[1] - 72)));
+                    v3 = (((a0[0] - a1[1][12]) == (a1[2][12] / 3)) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((i0 > 5) ? (v3 * v0) : (v3 != a0[12])) % 9);
+            v1 = (((a1[3][7] ? v2 : a1[0][2]) != (a0[8] != 22)) != ((i0 ? a1[2][2] : a1[3][12]) ? (v0 + 19) : (a1[3][2] > v0)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((33 - a0[11]) && (24 + v0)) == ((a0[3] ? a0[9] : v0) + (v1 ? 65 : v3)))) {
+        v2 = (((33 ? 95 : v3) ? (v0 * a1[3][1]) : (v3 <= 6)) >= ((v0 ? v3 : a1[1][10]) ? (v2 <= v2) : (v0 || v3)));
+        v1 = (((v2 <= 21) < (a1[3][0] + v1)) && ((v0 && 73) == (48 >= v0)));
+        v3 = (((a0[10] ? 49 : 74) == (a1[2][9] < v0)) - ((58 != v0) >= (v2 + a1[3][5])));
+    } else {
+        a0[14] = (((87 && v3) ? (v0 % 9) : (a1[3][8] - v1)) ? ((4 > v2) % 5) : ((a1[0][11] + v3) < (v2 && 97)));
+        v2 = (((a0[0] * v1) > (v2 % 8)) < ((v2 && a0[1]) != (91 == v3)));
+        v0 = (((v3 - v1) <= (v1 - v3)) % 5);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a1[2][12] = (((35 > v0) || (a1[1][14] ? a1[2][3] : v2)) <= ((i3 < v3) > (40 / 8)));
+            v0 = (((v0 ? 90 : i2) - (i2 == 0)) <= ((48 == v3) - (59 ? v1 : 27)));
+            v3 = (((v2 && v3) > (v3 + v1)) * ((v0 / 4) < (a1[0][0] >= 45)));
+        }
+        v1 = (((v2 < a1[0][4]) < (53 >= v0)) > ((10 || v0) != (v0 >= i2)));
+        v2 = (((a0[9] ? v3 : v3) != (a1[3][9] == v3)) - ((v1 % 7) * (90 ? v2 : a1[2][2])));
+    }
+    v1 = (((v1 % 2) < (64 <= a1[0][4])) - ((23 ? v1 : v3) < (v0 && v3)));
+    v0 = (((v1 == v1) * (64 && v3)) <= ((a1[3][6] / 6) >= (v1 || v3)));
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v2 ? 24 : v2) && (a0[15] > v2)) - ((v2 >= v0) || (i4 >= a0[4])));
+            v3 = (((v1 ? v1 : 59) == (v2 / 5)) ? ((42 % 1) || (i4 * v1)) : ((v0 || a1[0][0]) ? (v1 || v0) : (a1[0][15] ? v1 : v2)));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v2 = (((v0 != 84) && (66 ? a1[2][15] : a1[1][12])) >= ((a1[2][11] / 4) > (a0[3] / 4)));
+                    v1 = (((v2 <= a0[1]) || (a1[2][6] % 9)) + ((33 > 26) != (v2 ? i4 : a1[2][2])));
+                    v1 = (((a1[3][10] || v2) / 8) || ((i4 ? v3 : a0[7]) < (v1 + v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((a1[3][6] < 36) > 59) break;
+                v1 = (((v0 < a1[1][2]) == (39 > 67)) / 3);
+                a1[2][2] = (((79 <= a1[0][7]) && (54 && v2)) > ((a1[3][14] + v2) != (v3 ? i6 : 28)));
+                v1 = (((a1[1][15] != v0) >= (i6 ? a0[8] : 25)) >= ((a0[1] == i7) / 3));
+            }
+            v1 = (((v2 % 9) / 4) >= ((90 && 64) - (a0[15] >= a1[1][9])));
+            a0[15] = (((v2 + a1[3][11]) + (a0[15] > 3)) != ((i6 == v1) * (a1[1][3] != v0)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v1 < v0) >= (a1[3][2] / 7)) % 3)) {
+        a0[14] = (((90 * v0) ? (11 * v3) : (97 != a0[7])) < ((v1 == 35) >= (v2 % 1)));
+        v2 = (((a0[3] && 59) < (a1[3][3] ? a1[0][14] : a1[0][5])) * ((49 <= v0) && (v0 != 43)));
+        v0 = (((a1[3][2] % 4) + (v2 > a1[3][1])) * ((a1[2][8] && 4) || (v2 > v1)));
+    } else {
+        a0[15] = (((80 <= v0) > (a0[15] != v0)) < ((v0 + a0[1]) / 1));
+        a0[15] = (((a1[1][15] - v0) && (v2 > 59)) && ((v1 ? v0 : a1[1][3]) ? (v3 == v1) : (62 == v1)));
+        a0[5] = (((87 ? 92 : v0) != (v1 || a0[8])) ? ((a1[0][5] == v1) - (a1[0][14] <= v0)) : ((v0 - 1) != (v3 % 9)));
+    }
+    v3 = (((a0[9] / 3) + (v0 == a0[0])) && ((74 - 13) + (a1[2][11] - v0)));
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((v2 >= 97) ? (a0[8] / 2) : (v0 * 78)) - ((i9 ? 52 : v1) < (i8 == 61)));
+                    v0 = (((a0[2] + 57) * (i9 + 85)) || ((v3 / 3) && (42 || v2)));
+                    v0 = (((i9 && v1) + (67 ? i8 : a1[0][10])) ? ((v3 + v1) != (v1 * a0[0])) : ((5 > i8) < (a0[10] % 1)));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            a1[1][3] = (((86 > a0[7]) ? (a1[0][9] == v3) : (a0[12] != v2)) ? ((67 > a0[2]) <= (a1[2][5] + a1[0][10])) : ((v1 ? 83 : v2) <= (a0[3] >= v3)));
+            v1 = (((5 > v0) ? (v2 / 2) : (16 >= i8)) - ((50 - a1[0][10]) % 9));
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    return (((v2 || a1[1][3]) / 7) < ((64 == 34) && (a1[3][7] == v3)));
+}
+int f1() {
+    int v0 = 79;
+    int v1 = 30;
+    int v2 = 66;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    a0[10] = (((31 * 10) < (v0 <= v0)) ? ((v2 ? v1 : v0) - (a1[3][6] * v3)) : ((83 > 52) >= (a1[3][10] || v0)));
+    v0 = (((28 / 2) + (0 && v2)) / 9);
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((i0 != 74) > 57) break;
+        v3 = (((v3 && i0) || (v1 + a1[1][13])) * ((18 != 74) + (v1 || a1[1][9])));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            if ((i0 / 4) > 78) break;
+            v0 = (((a0[9] < i1) < (v0 ? a1[0][14] : 5)) < ((v1 < v0) < (i0 != 3)));
+            a1[0][6] = (((v1 % 5) + (37 ? v0 : 10)) % 1);
+            v1 = (((v2 / 6) > (v2 <= 59)) || ((a1[3][9] || i1) >= (65 <= a0[5])));
+        }
+        v1 = (((a0[8] >= i0) > (v3 * v0)) + ((i0 * 25) <= (27 + i0)));
+    }
+    if ((((27 <= v3) - (a1[3][4] % 1)) ? ((v2 > v1) != (v0 > a1[2][9])) : ((33 - 40) > (v1 ? a1[0][9] : v2)))) {
+        v1 = (((v0 < a0[7]) != (v0 % 8)) > ((21 >= v3) - (a0[1] > a0[15])));
+        a0[10] = (((a1[2][1] + a1[1][14]) / 9) / 8);
+        a0[6] = (((v0 && 20) < (a1[3][9] < a0[3])) == ((8 - v0) > (74 && v3)));
+    } else {
+        v1 = (((v2 % 1) >= (v2 != v1)) * ((v2 * v3) ? (v0 / 8) : (v2 > v1)));
+        a1[2][4] = (((v0 >= 30) && (v1 * v3)) || ((a0[6] * v3) + (v2 + v3)));
+        a0[13] = (((40 < v2) % 3) - ((v0 <= v1) > (v0 <= 1)));
+    }
+    if ((((v3 / 2) || (28 != 56)) * ((v0 * v3) % 1))) {
+        v1 = (((a0[11] && 44) * (87 > a0[10])) == ((13 == v0) > (0 > v2)));
+        v1 = (((a1[1][8] == 83) && (a0[3] + v2)) * ((v1 && v3) <= (a1[0][5] >= 76)));
+        v3 = (((a1[3][10] || 12) % 5) / 6);
+    } else {
+        v3 = (((v1 + a0[4]) * (v3 ? v0 : v0)) % 2);
+        v3 = (((a0[6] % 7) < (a0[11] * v3)) * ((27 ? a1[2][14] : v1) + (a1[2][4] != 78)));
+        v1 = (((v2 / 8) != (v0 + a0[8])) < ((v0 * 7) ? (v3 + v0) : (v0 + 96)));
+    }
+    if ((((67 ? v3 : 42) < (v1 && a0[8])) * ((a0[4] < a1[2][2]) * (a1[2][6] < 93)))) {
+        a1[0][7] = (((65 < v2) >= (75 / 3)) != ((v0 ? v1 : a1[2][9]) && (v3 && 85)));
+        v0 = (((a0[0] ? a1[0][7] : v0) >= (a0[4] != a1[0][2])) % 8);
+        a0[14] = (((v0 - a1[1][15]) - (v0 < v2)) >= ((v1 && v2) - (46 - a0[11])));
+    } else {
+        v2 = (((15 - v2) / 9) ? ((v3 <= 1) != (4 && v1)) : ((a0[2] && 38) * (28 / 3)));
+        a0[8] = (((88 && 12) || (v1 - a1[1][6])) != ((37 || a0[4]) && (5 >= v3)));
+        v0 = (((a0[1] < v1) || (a0[9] % 7)) % 9);
+    }
+    if ((((a1[2][3] - v0) >= (51 ? v1 : a1[3][12])) ? ((v3 ? v0 : v2) >= (v2 / 9)) : ((18 && 84) >= (v0 % 1)))) {
+        v0 = (((a1[0][14] - v2) == (58 + v1)) ? ((86 == v1) >= (41 && 56)) : ((a0[14] || a0[14]) <= (a0[15] % 2)));
+        v3 = (((v2 >= v0) != (a1[1][1] <= v1)) <= ((v3 || v2) ? (a1[3][2] != 9) : (a0[12] / 2)));
+        v1 = (((87 == v0) <= (v2 >= 67)) == ((v1 || a1[0][13]) ? (v1 == 52) : (25 - v0)));
+    } else {
+        a1[2][0] = (((v1 <= 68) != (a0[3] % 8)) / 5);
+        v0 = (((v1 <= v3) - (27 + v1)) % 8);
+        v1 = (((v0 || v2) >= (a1[2][8] >= 84)) != ((v1 / 5) >= (v1 * v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    a0[0] = (((43 / 1) ? (76 * a0[3]) : (a0[6] == a1[0][4])) * ((14 < 72) + (i2 >= i3)));
+                    v0 = (((87 < 61) / 4) - ((v2 != a0[8]) < (v0 && v2)));
+                    v2 = (((71 > v0) ? (i3 + v3) : (58 ? a1[2][10] : 42)) || ((v3 == a1[1][1]) * (50 || v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((76 + 78) > (v3 >= v2)) && ((a1[0][13] >= i2) && (a0[2] || v1)));
+            v1 = (((v3 % 6) - (a1[2][2] / 3)) + ((46 < v2) <= (v0 == 31)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    a0[8] = (((v0 == 88) < (v3 && 48)) ? ((a1[0][9] != 94) % 2) : ((v1 - v3) * (87 != v2)));
+    {
+        int i4 = 0;
+        do {
+            a0[5] = (((v0 / 9) * (v1 % 9)) > ((v2 >= 18) / 9));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((0 > 64) <= (v2 - 12)) == ((55 || a0[13]) / 3));
+                    a1[1][2] = (((i5 == v1) ? (a1[1][6] % 4) : (i4 == a0[9])) == ((a1[0][5] != a1[3][3]) + (55 ? 76 : v0)));
+                    v2 = (((a1[1][7] != v2) % 8) + ((i4 * a1[0][9]) / 5));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a1[0][5] = (((89 >= i4) >= (v1 + v3)) == ((26 == 6) <= (v2 <= 63)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((71 == a0[6]) == (78 || a1[2][14])) == ((v2 == v2) >= (v2 >= a1[2][8])));
+}
+int f2() {
+    int v0 = 75;
+    int v1 = 99;
+    int v2 = 19;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 / 9) + (v3 / 5)) ? ((v3 <= a0[1]) > (16 - v0)) : ((v0 / 3) * (v0 + v2)))) {
+        v2 = (((v2 && v3) == (v1 != v3)) ? ((v2 % 5) + (a1[3][5] >= a1[3][11])) : ((12 - a1[0][1]) && (v0 <= v3)));
+        a0[2] = (((a1[2][9] > 36) != (v2 < v3)) - ((a0[8] == v1) > (v0 ? v1 : v1)));
+        v1 = (((a1[0][7] || v0) + (v1 ? v3 : v1)) || ((a0[9] + v0) > (v3 <= v3)));
+    } else {
+        v2 = (((v0 == v3) ? (v0 != 42) : (1 - a0[9])) || ((v2 - a0[3]) != (72 + v0)));
+        v1 = (((a0[4] >= v3) ? (v1 > 94) : (a1[1][11] < v3)) ? ((4 * a1[1][4]) >= (91 + 2)) : ((v2 != v0) / 3));
+        v1 = (((v1 - v3) % 9) != ((67 || v1) < (77 == v1)));
+    }
+    if ((((32 ? a0[3] : 63) == (v1 >= 26)) % 1)) {
+        v0 = (((62 <= a0[3]) >= (87 ? 4 : v1)) ? ((50 ? v0 : a1[3][12]) < (a0[6] || a0[14])) : ((v1 % 2) >= (a1[3][7] && v2)));
+        v2 = (((v1 == v3) && (91 + a1[0][6])) >= ((2 || 58) * (92 <= v2)));
+        a0[6] = (((0 ? v0 : v3) ? (v2 ? 64 : 6) : (v0 || v1)) ? ((10 < v1) || (75 + v3)) : ((16 || 2) % 4));
+    } else {
+        a1[2][15] = (((a1[0][14] - a1[2][15]) && (v3 < 51)) % 5);
+        v2 = (((a1[2][13] == 5) || (v3 / 5)) >= ((a0[4] && v3) >= (85 % 6)));
+        v3 = (((98 || 98) ? (a0[9] || 21) : (a0[6] != a0[3])) > ((a0[7] / 2) <= (v0 >= 91)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((a0[15] <= v2) > 58) break;
+            {
+                int i1 = 0;
+                do {
+                    if ((v2 ? v3 : 31) > 89) break;
+                    v1 = (((a1[2][12] + a0[1]) > (45 - a0[5])) * ((a1[2][1] - 43) <= (v1 && v1)));
+                    v2 = (((52 + 99) % 8) <= ((i0 ? 89 : 60) != (v3 || v2)));
+                    v3 = (((a1[3][3] * i1) > (v0 - v3)) >= ((v1 || 65) * (i0 || i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((a1[2][9] == v3) < (v2 < 83)) == ((v2 == a0[6]) < (59 * 27)));
+            v1 = (((v3 > v0) > (a1[1][8] >= v1)) > ((v3 ? v1 : 15) - (v0 % 1)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((v0 % 3) ? (a1[1][1] % 8) : (a1[3][13] ? 38 : 51)) + ((v3 || a1[0][9]) ? (v2 % 8) : (92 != a1[0][12])))) {
+        a0[3] = (((v2 >= 24) != (a1[1][7] > v0)) && ((v2 ? a1[1][2] : v3) < (v1 + v2)));
+        a1[1][0] = (((55 >= v1) ? (v1 == a0[15]) : (v3 % 7)) == ((a1[2][12] || v2) / 8));
+        v0 = (((v0 != a1[2][11]) - (47 || v2)) ? ((v0 / 1) <= (v0 < v2)) : ((3 == v1) - (v2 >= a1[1][3])));
+    } else {
+        v0 = (((v3 % 9) && (a0[4] + v2)) ? ((a1[1][4] - v3) == (v1 + v0)) : ((v0 > v0) - (v3 + v0)));
+        v2 = (((v0 != 30) % 1) + ((v1 || a0[11]) * (a1[2][6] - 70)));
+        v2 = (((68 != 48) / 4) ? ((68 * a1[2][11]) % 7) : ((v3 != a0[14]) ? (v1 != 56) : (6 / 8)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 || v2) > 67) break;
+            v2 = (((v1 ? a1[2][1] : v3) / 4) <= ((73 % 1) % 3));
+            v0 = (((a1[0][13] ? v2 : v3) == (v2 - v2)) ? ((12 * v0) >= (v3 + 79)) : ((v0 != 34) / 6));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((43 != i2) > 66) break;
+                v1 = (((52 / 5) / 6) < ((i2 % 8) % 7));
+                v3 = (((v0 == 42) > (a0[0] == i3)) ? ((a1[2][3] ? v3 : a0[13]) != (58 <= v0)) : ((i2 + v3) && (a1[3][11] >= a0[3])));
+                v2 = (((a1[3][10] && v3) ? (i3 < i3) : (v1 > 75)) - ((i3 - 28) || (v2 / 7)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    v1 = (((5 >= 8) ? (v0 || a0[1]) : (v2 / 7)) ? ((a0[15] == 54) * (a0[3] - a1[1][3])) : ((5 && v2) || (38 / 7)));
+    v0 = (((75 <= 73) >= (v3 / 3)) > ((v1 != a0[2]) >= (68 + a1[2][10])));
+    v2 = (((a0[13] % 3) % 7) + ((a0[6] * 78) > (v3 || v3)));
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v2 = (((a0[13] == v3) % 1) ? ((i4 <= 16) >= (v0 - a0[7])) : ((v3 < a0[3]) ? (i4 * a1[0][3]) : (70 > 32)));
+        a1[3][6] = (((v1 / 7) || (i4 > a1[1][1])) % 3);
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            a1[3][13] = (((v3 - a0[9]) - (a1[1][1] + v3)) < ((a0[1] >= 14) ? (22 * 42) : (24 % 7)));
+            a0[4] = (((i4 != a1[3][11]) + (91 + 68)) / 9);
+            a0[13] = (((45 - i5) ? (a1[3][8] != 62) : (v1 % 5)) || ((a0[15] > v2) <= (v3 ? v3 : a1[3][2])));
+        }
+    }
+    v2 = (((70 != v0) - (v2 % 6)) % 7);
+    return (((v3 == 70) % 2) > ((v3 < v3) && (99 == a1[1][0])));
+}
+int f3() {
+    int v0 = 51;
+    int v1 = 97;
+    int v2 = 69;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 / 2) + (v0 * v0)) * ((v0 >= v3) < (48 - 69)))) {
+        v1 = (((v0 >= 66) ? (v3 - 78) : (14 ? v2 : v3)) || ((v3 < v3) - (4 != v2)));
+        v3 = (((v3 >= 46) - (v1 >= v2)) + ((v3 >= v0) * (47 % 3)));
+        v2 = (((89 / 4) % 7) / 7);
+    } else {
+        v3 = (((a1[0][10] > v1) != (v3 || a1[0][14])) >= ((v3 * v2) <= (84 != 71)));
+        v3 = (((v2 - a0[7]) >= (v1 * v1)) <= ((76 - 48) > (v3 ? v0 : a1[1][13])));
+        v0 = (((68 + v3) ? (v1 > a1[2][2]) : (v2 || v3)) || ((v2 <= 31) <= (28 >= a0[13])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v3 < v3) <= (v1 + 7)) / 8);
+            {
+                int i1 = 0;
+                do {
+                    a0[8] = (((94 <= v1) * (40 || v0)) * ((a0[10] % 2) != (v3 != 83)));
+                    v1 = (((a1[2][5] * v0) != (a1[2][8] < v1)) || ((a0[10] % 5) ? (73 >= v2) : (89 > v3)));
+                    v3 = (((20 ? v2 : a0[3]) || (a1[0][13] || a0[5])) ? ((a1[1][1] != v0) - (a1[3][14] || v1)) : ((v1 ? v0 : 38) % 2));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v0 = (((85 / 3) / 3) % 2);
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[1] - v1) > 69) break;
+            v3 = (((a0[4] && 49) % 6) && ((v2 != 42) < (v2 >= i2)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v2 = (((94 == 26) <= (55 / 4)) + ((36 <= i2) == (96 || i2)));
+                v1 = (((36 + a0[1]) || (17 / 7)) / 6);
+                a1[0][1] = (((v0 / 9) >= (v0 >= 58)) == ((i3 % 1) < (66 % 2)));
+            }
+            v1 = (((4 * v0) == (v2 > 2)) ? ((v3 == a0[14]) > (a1[2][5] - a0[2])) : ((v1 < a1[2][6]) <= (a0[0] - v1)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v2 + v1) / 4) != ((a0[5] <= a1[1][14]) && (v2 % 6)));
+            v1 = (((a1[1][8] + a1[0][7]) == (21 + a0[12])) + ((i4 < v2) % 8));
+            {
+                int i5 = 0;
+                do {
+                    if ((30 % 2) > 87) break;
+                    v0 = (((2 + a1[0][4]) <= (v2 / 8)) == ((v3 <= 51) > (64 < v3)));
+                    v0 = (((v2 - a1[3][15]) > (v0 - 44)) - ((66 ? i5 : v0) ? (96 + i5) : (i4 ? a1[3][8] : 2)));
+                    v1 = (((v2 != v3) / 3) / 7);
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[2][10] = (((a0[7] < a1[2][8]) - (a1[2][3] - v1)) ? ((51 < i6) || (v0 ? v3 : a0[10])) : ((v0 == v2) < (v0 / 4)));
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((v1 + 46) - (v3 / 6)) % 7);
+                    v0 = (((i7 ? v2 : a1[1][12]) || (74 < 8)) % 7);
+                    v0 = (((v2 ? i6 : 50) > (a1[1][4] > 42)) > ((a1[1][13] != 11) / 9));
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            v2 = (((95 < v2) >= (v2 * 5)) >= ((i6 / 2) || (a1[2][8] % 2)));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    v2 = (((v0 || a1[3][5]) >= (v1 <= a0[0])) % 1);
+    if ((((v3 <= v1) / 9) || ((v1 <= v3) <= (46 <= v3)))) {
+        a0[11] = (((49 > 69) && (v1 / 7)) ? ((v0 == 28) - (56 > a1[0][5])) : ((v0 % 9) ? (a0[15] || v2) : (v1 < v3)));
+        a1[2][5] = (((a1[2][2] ? 98 : v3) / 3) || ((1 || 70) * (a1[3][1] <= v2)));
+        v1 = (((a1[1][2] + v1) % 6) != ((v3 > 47) == (v0 == a0[13])));
+    } else {
+        a1[2][5] = (((v1 == v0) / 2) * ((a1[3][7] ? v2 : v3) ? (v3 / 4) : (v0 % 7)));
+        v2 = (((a0[8] && 7) != (v2 - a0[11])) < ((v2 ? v1 : v3) != (v2 == 63)));
+        a1[1][2] = (((v2 && a0[9]) ? (50 - v2) : (a1[3][11] + 4)) <= ((v0 == v3) <= (82 || v3)));
+    }
+    v2 = (((v0 ? v0 : v2) == (a1[1][3] * v0)) ? ((a0[0] > a1[0][1]) % 1) : ((1 <= v0) % 6));
+    v1 = (((v2 - v2) - (v2 && v2)) / 2);
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        v2 = (((a0[6] ? i8 : v1) || (99 % 6)) <= ((v1 != v3) || (v2 < v2)));
+        v1 = (((v3 <= v2) <= (a0[8] % 1)) || ((v0 ? a1[0][15] : a0[14]) > (a0[2] == a1[2][6])));
+        {
+            int i9 = 0;
+            do {
+                v0 = (((71 % 1) / 2) / 8);
+                a0[12] = (((i8 >= 77) >= (a0[7] ? 5 : a0[13])) < ((v0 + i9) && (7 >= v1)));
+                a0[15] = (((v3 - a1[2][14]) == (v0 == 90)) * ((v3 && v1) % 5));
+                i9 = i9 + 1;
+            } while (i9 < 8);
+        }
+    }
+    return (((v1 <= v1) <= (v1 % 6)) == ((a0[4] != v0) < (43 == v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,126 @@
+int f0() {
+    int v0 = 82;
+    int v1 = 46;
+    int v2 = 78;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        a0[12] = (((a0[7] || 75) * (v0 >= v2)) <= ((a1[3][15] <= v0) / 9));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v3 = (((v1 == i1) || (a1[0][7] && i1)) < ((76 == a0[8]) < (57 || v0)));
+            v0 = (((a0[7] >= i0) != (v2 || a1[1][1])) == ((v0 && a0[11]) - (78 > a1[2][11])));
+            v0 = (((91 % 5) > (v2 >= v3)) + ((i1 % 9) > (v3 - a0[11])));
+        }
+        v1 = (((65 ? v2 : v1) <= (a0[12] % 6)) ? ((51 || v3) - (29 == v1)) : ((i0 == i0) + (7 - v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v2 = (((16 > v2) == (i2 != 56)) / 9);
+            v3 = (((96 || v3) - (v2 / 7)) - ((49 != i2) == (v0 && a1[3][12])));
+            {
+                int i3 = 0;
+                do {
+                    if ((v1 <= v3) > 76) break;
+                    a0[2] = (((64 - i3) - (23 != a1[3][6])) != ((v2 >= a0[5]) + (v2 == v1)));
+                    v3 = (((a1[3][7] >= a1[1][8]) ? (v2 ? v3 : i2) : (16 % 9)) ? ((48 <= 44) - (a1[0][14] ? a1[1][5] : v3)) : ((a0[5] ? a1[3][6] : v2) != (57 - v1)));
+                    v3 = (((i2 ? 51 : a1[3][0]) > (a0[2] <= a0[13])) <= ((v1 + 11) ? (v0 ? i2 : 87) : (a0[14] + 48)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v0 = (((99 * a1[1][2]) || (v3 * v0)) <= ((a0[1] >= a1[1][3]) % 2));
+            a1[2][11] = (((a0[3] || 36) / 4) < ((89 <= a1[2][10]) % 1));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                a0[15] = (((58 || i4) > (v0 + a1[3][5])) ? ((a0[14] / 9) <= (v1 >= 59)) : ((v2 == v2) % 4));
+                v0 = (((v3 >= 41) < (v2 * a0[10])) <= ((5 < i4) ? (3 ? v2 : 12) : (v3 && 69)));
+                v3 = (((46 == i4) < (a1[2][3] || 77)) && ((a1[2][9] == v3) != (a0[12] || a0[9])));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 != 55) * (v0 * v1)) > ((v2 <= 7) || (22 < a1[3][14])))) {
+        a0[13] = (((v2 == v1) || (93 <= v1)) % 2);
+        v0 = (((a1[1][9] || v0) >= (a0[4] * v1)) ? ((v2 || a0[0]) % 7) : ((v3 > 90) % 1));
+        v0 = (((v3 < a0[3]) ? (a1[0][9] && 81) : (v2 > v1)) >= ((65 || v2) >= (v2 > v3)));
+    } else {
+        v2 = (((v3 < 33) + (a0[14] > 45)) > ((v1 + v1) != (85 > 98)));
+        a0[9] = (((v3 <= 35) + (v1 ? v2 : v3)) + ((v2 || v1) > (v2 != v3)));
+        v1 = (((v2 < v1) + (v0 - a1[0][10])) || ((v3 >= 1) / 2));
+    }
+    if ((((v0 % 2) / 2) - ((a0[15] < a1[0][13]) ? (v3 > 8) : (89 * v2)))) {
+        a1[2][15] = (((v0 * 99) != (a0[14] == v3)) < ((a0[7] / 1) <= (a1[3][2] + a0[13])));
+        v3 = (((v2 > v3) % 7) && ((v2 != 33) * (68 < v3)));
+        v2 = (((49 > v2) < (a1[0][7] <= v3)) % 5);
+    } else {
+        v2 = (((v0 < 44) != (a0[5] && a1[0][8])) != ((a1[0][9] != v2) % 1));
+        a0[9] = (((37 < a1[1][3]) - (68 < v3)) % 6);
+        v1 = (((a0[4] || v2) && (v1 ? 34 : 73)) != ((v0 >= a1[2][1]) <= (v3 % 9)));
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v1 = (((a0[9] ? 53 : 19) == (50 > v3)) * ((a1[3][12] - v2) / 5));
+                    v3 = (((i6 ? v3 : a0[6]) + (42 >= a1[2][15])) && ((1 ? 76 : a0[6]) >= (a1[0][6] >= i6)));
+                    v0 = (((62 % 4) > (97 != 26)) || ((a1[2][0] || 43) + (v0 && a1[2][7])));
+                    i7 = i7 + 1;
+                }
+            }
+            a0[5] = (((i6 % 7) + (i6 >= a0[9])) ? ((69 || a1[3][3]) < (a0[10] * 76)) : ((i6 >= i6) < (73 != v3)));
+            v1 = (((57 >= a1[1][12]) >= (v0 + v1)) - ((3 == v2) > (i6 * v3)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    a0[3] = (((2 > v2) <= (a1[3][4] || v1)) / 3);
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+            if ((52 / 8) > 60) break;
+            v3 = (((a0[13] + i8) * (a1[3][13] / 7)) == ((v3 || i8) < (v0 != a0[8])));
+            a1[0][12] = (((a1[1][11] && i9) >= (a1[3][7] + 9)) > ((a1[1][13] - v1) && (70 > v3)));
+            v2 = (((i8 * 46) ? (a0[11] == v2) : (a1[0][4] == i9)) != ((92 % 9) == (a0[0] ? a1[0][13] : v3)));
+        }
+        v0 = (((v3 <= v2) >= (73 != 6)) - ((30 && v1) == (8 >= a0[7])));
+        a0[9] = (((99 > v2) == (71 < 66)) % 6);
+    }
+    for (int i10 = 0; i10 < 4; i10 = i10 + 1) {
+        {
+            int i11 = 0;
+            do {
+                v2 = (((a1[3][5] / 8) / 4) * ((v1 - 3) % 4));
+                v3 = (((v1 * v2) % 5) == ((a0[7] && v0) + (v1 < i11)));
+                a1[0][11] = (((a1[1][14] / 2) + (a0[9] ? v1 : i10)) % 5);
+                i11 = i11 + 1;
+            } while (i11 < 4);
+        }
+        v2 = (((v2 > a0[3]) - (a0[5] != 5)) > ((8 % 7) != (a0[12] / 3)));
+        v1 = (((a0[3] - v1) ? (47 % 2) : (i10 <= v2)) - ((a1[2][14] <= a1[1][8]) == (v0 == 82)));
+    }
+    for (int i12 = 0; i12 < 4; i12 = i12 + 1) {
+        {
+            int i13 = 0;
+            while (i13 < 8) {
+                v2 = (((v2 ? i12 : 78) + (v1 ? 64 : v3)) - ((86 && v2) + (a1[2][0] + 32)));
+                v3 = (((90 || i13) % 7) == ((i12 < 58) % 4));
+                v0 = (((v3 ? i12 : v3) && (i13 == v2)) + ((a0[10] >= 95) % 3));
+                i13 = i13 + 1;
+            }
+        }
+        a0[6] = (((83 == i12) % 6) * ((v3 && v3) + (v3 || v2)));
+        v3 = (((a1[1][15] >= 60) > (v3 <= 16)) == ((i12 || v0) ? (a0[7] * 79) : (v2 ? v0 : v1)));
+    }
+    return (((v2 || a1[2][6]) && (v1 - v1)) * ((v1 - a0[14]) + (v1 * v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
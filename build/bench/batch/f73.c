@@ -0,0 +1,199 @@
+int f0() {
+    int v0 = 54;
+    int v1 = 51;
+    int v2 = 81;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 && v1) - (14 != v3)) != ((v3 < v3) || (a0[1] < v0)))) {
+        v3 = (((v3 > v2) == (v1 >= v2)) + ((a0[5] > v3) == (v1 % 4)));
+        v1 = (((a1[1][5] ? v0 : v1) ? (a0[3] && 25) : (a1[1][3] - v0)) + ((v1 + v2) + (a1[3][10] > v3)));
+        a0[8] = (((63 + 92) < (88 ? v3 : a1[3][8])) < ((v1 ? v0 : 68) % 9));
+    } else {
+        v2 = (((26 ? a0[13] : v2) && (v2 * a0[4])) || ((68 >= v2) / 9));
+        v1 = (((47 != v2) || (a1[1][7] >= v3)) ? ((82 + 44) != (32 == a0[14])) : ((v0 + v0) != (88 / 9)));
+        a1[2][15] = (((24 / 9) % 9) == ((v1 <= v3) && (86 != 4)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v3 = (((v2 && 68) == (v3 ? v1 : a1[3][15])) != ((i0 || i0) ? (32 != i0) : (50 % 5)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[14] * v3) > 90) break;
+                    a0[5] = (((59 > a0[12]) % 7) < ((v0 && i1) ? (v3 <= i0) : (v0 % 3)));
+                    a0[7] = (((93 || v2) ? (26 != v2) : (21 == 20)) || ((v0 || a1[0][7]) || (a1[2][15] == 5)));
+                    v3 = (((57 ? i1 : 17) || (i0 ? v0 : i0)) + ((53 || 95) && (v1 - v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v1 = (((a0[9] < a1[1][14]) <= (v0 == 80)) <= ((v2 ? i0 : a1[3][13]) ? (v2 / 8) : (v0 >= a0[1])));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((v3 > a0[11]) && (v2 == v0)) % 1);
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    a0[0] = (((v2 != v3) ? (a1[3][4] - i2) : (v3 == 29)) && ((28 <= v0) && (44 <= v1)));
+                    v2 = (((v2 <= i2) != (a1[2][12] % 4)) && ((v1 < a1[3][12]) != (i3 || v3)));
+                    v2 = (((i2 <= v3) <= (a1[3][4] <= 26)) + ((v2 <= 14) / 5));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v1 = (((44 % 5) || (i2 ? a1[1][2] : a1[0][13])) < ((36 == a1[2][1]) < (v1 != 16)));
+            v3 = (((95 + 62) > (27 > v0)) - ((v2 + 50) == (v2 * v0)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((15 ? 34 : a1[2][6]) ? (v1 ? 48 : v3) : (73 * a1[0][4])) + ((a1[0][9] + 11) + (85 && a0[1])))) {
+        a0[14] = (((v2 >= 0) % 7) && ((a0[10] + 90) < (6 * a0[3])));
+        a1[0][2] = (((v0 % 9) == (v3 || v2)) / 3);
+        a1[1][1] = (((v2 > v2) - (v2 + 76)) ? ((14 < a0[12]) != (v2 ? a0[11] : v3)) : ((a1[0][8] ? 63 : v3) == (a0[11] + v0)));
+    } else {
+        v1 = (((a0[7] == 0) ? (96 % 4) : (a1[0][7] - v2)) == ((a1[3][8] * 76) < (a0[4] / 4)));
+        a1[1][3] = (((a1[1][15] + 94) > (a1[2][8] * v1)) || ((v2 * 37) > (v1 ? v2 : 64)));
+        a0[6] = (((v3 < v1) != (v1 ? v0 : 79)) && ((v3 * v2) >= (a0[13] ? v3 : a1[0][14])));
+    }
+    if ((((83 && v0) - (23 > v2)) < ((v1 < a0[2]) < (a1[3][15] < a1[2][7])))) {
+        v0 = (((a0[11] + 56) % 6) % 3);
+        a1[0][5] = (((a1[0][13] != v1) == (29 + v0)) ? ((a1[3][3] ? 37 : a1[0][4]) >= (a1[3][8] ? v0 : 39)) : ((v0 / 5) ? (a1[1][14] / 8) : (22 || 20)));
+        v1 = (((a1[2][5] * a0[11]) >= (a1[0][15] < a0[2])) - ((v3 != v1) > (v0 >= 60)));
+    } else {
+        v0 = (((v2 / 6) && (a1[0][8] * v3)) <= ((v0 ? v1 : v3) ? (a0[7] && v3) : (78 == a1[1][7])));
+        a1[2][13] = (((v0 == v2) >= (20 <= 80)) * ((a1[2][12] % 2) && (v1 || a0[7])));
+        a0[2] = (((95 ? v2 : 33) <= (a1[2][0] ? 60 : a0[3])) - ((77 * a0[2]) > (v1 ? v3 : v3)));
+    }
+    v3 = (((v0 % 5) + (v2 < v0)) && ((v1 ? a0[10] : v0) * (v3 + v1)));
+    v0 = (((v3 || a1[2][1]) > (a1[2][9] ? v0 : 57)) < ((v0 ? 56 : v1) * (v1 || v0)));
+    a1[1][9] = (((89 && v0) >= (70 ? v1 : v2)) * ((a0[1] > 51) / 5));
+    if ((((v0 / 1) / 4) < ((v3 == a0[7]) != (v0 <= v3)))) {
+        v0 = (((v2 % 3) / 3) && ((v1 ? v3 : 38) != (a1[1][7] >= v2)));
+        v1 = (((v0 * v3) == (v2 - a0[12])) * ((v3 + 11) ? (v2 ? v3 : a0[3]) : (v0 ? v3 : 12)));
+        v2 = (((v3 ? v0 : v2) < (v2 == a0[6])) * ((v1 * v2) >= (a1[2][6] <= 14)));
+    } else {
+        v0 = (((v2 + 65) >= (80 + v1)) % 9);
+        a1[2][13] = (((a1[1][14] > 78) + (70 - 46)) < ((55 <= v2) - (v3 - 52)));
+        v3 = (((v3 < 75) / 6) == ((v0 * a0[13]) ? (69 / 5) : (96 ? a0[6] : v1)));
+    }
+    return (((v1 * a0[7]) + (a0[5] + 81)) ? ((a0[14] % 1) || (a0[0] + v1)) : ((v3 - v1) >= (v3 > v3)));
+}
+int f1() {
+    int v0 = 70;
+    int v1 = 66;
+    int v2 = 40;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((a1[2][12] && v2) <= (44 + v3)) + ((66 > a1[3][9]) != (i0 / 3)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v3 = (((v3 ? v1 : a1[3][7]) > (a0[5] > 67)) ? ((88 >= v0) || (i0 - 7)) : ((36 < 33) ? (i0 <= v3) : (v2 >= i0)));
+                    a0[3] = (((a0[9] < 76) / 2) && ((v0 % 1) <= (a0[11] * 34)));
+                    v2 = (((13 >= a0[2]) <= (a1[1][8] >= a0[1])) != ((v3 ? a0[6] : i0) && (i1 % 2)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[11] = (((a1[0][11] + 71) ? (45 - a0[9]) : (47 <= v1)) || ((v0 == 35) >= (29 && a1[0][5])));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((v3 / 9) > (58 && v1)) ? ((v0 >= a1[1][6]) > (v0 && a1[2][15])) : ((v2 < v2) != (72 / 1)))) {
+        a1[0][11] = (((v1 <= v1) + (v2 >= v1)) / 9);
+        v1 = (((v3 + v3) != (v2 / 1)) * ((75 / 6) + (v0 ? v3 : 86)));
+        v0 = (((68 ? v2 : 90) ? (9 + a1[3][13]) : (a1[2][1] <= v1)) / 4);
+    } else {
+        v3 = (((v1 / 2) && (v1 || 84)) <= ((64 * v3) - (60 == v3)));
+        v2 = (((a1[1][14] / 4) <= (v0 ? a1[1][13] : a1[1][3])) ? ((v1 <= v2) || (v3 > v3)) : ((67 <= a1[0][0]) % 6));
+        v2 = (((v0 / 9) && (33 + v0)) != ((v0 * v3) != (a1[2][8] % 4)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a1[0][11] = (((i2 || v0) * (a1[3][2] && v2)) != ((a0[14] <= i2) == (56 && 18)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((v3 ? 63 : 50) > 52) break;
+                    v3 = (((a1[1][13] != 5) == (a0[10] ? i3 : v0)) - ((30 * 66) >= (i3 && v2)));
+                    v3 = (((i2 == a0[2]) > (v3 == a0[11])) % 2);
+                    v2 = (((v1 != v1) > (7 > v3)) == ((v2 % 4) >= (56 != v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[7] = (((43 / 7) / 6) >= ((a1[3][1] >= v3) && (32 && a1[1][0])));
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((a0[7] != a0[9]) < (v1 && a0[1])) > ((v1 ? 71 : v3) / 5));
+    v0 = (((v1 ? a1[0][9] : 24) - (v0 == v1)) != ((v1 <= a0[8]) == (a0[4] ? 19 : v0)));
+    if ((((a1[2][4] ? a1[3][7] : a0[2]) <= (a0[0] < a1[2][6])) <= ((v2 / 1) == (v3 - a1[1][12])))) {
+        a0[9] = (((v0 > 55) <= (v0 == v1)) >= ((v2 && v3) != (a0[3] ? a0[10] : 36)));
+        a0[1] = (((12 / 3) % 4) && ((v2 % 2) == (a1[3][9] % 5)));
+        v1 = (((73 * 18) > (v0 || a0[5])) + ((91 % 6) <= (24 / 8)));
+    } else {
+        v2 = (((v1 < v2) - (a1[1][13] >= a0[9])) % 5);
+        v3 = (((45 || 14) || (v0 % 3)) != ((v2 ? 36 : v2) != (49 >= 82)));
+        v0 = (((v0 ? v2 : v2) && (v1 + v1)) + ((a1[1][1] / 8) != (v0 != v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((v3 - 92) > 82) break;
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((a0[5] != 38) <= (78 > v3)) < ((v2 > a0[3]) - (i4 % 2)));
+                    v1 = (((v2 ? i4 : a0[15]) == (a1[2][3] > a1[1][15])) >= ((i4 == a0[0]) > (i5 || v2)));
+                    v2 = (((v3 % 1) / 2) / 9);
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((35 < 63) && (v1 * 99)) ? ((v3 ? 88 : 21) && (51 - v0)) : ((v1 != i4) * (a0[3] / 3)));
+            v0 = (((v0 + v1) <= (a1[3][5] ? a1[3][3] : v3)) % 8);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 >= v1) % 5) && ((v2 || v3) + (v1 && v1)))) {
+        a0[8] = (((a1[0][13] <= 35) ? (v0 * v0) : (v3 && a1[1][15])) ? ((a1[2][5] == 27) ? (v3 % 2) : (v2 || a0[12])) : ((82 - a1[2][10]) + (a0[3] < v2)));
+        v2 = (((v1 >= v2) <= (a1[3][7] / 5)) / 4);
+        v0 = (((91 <= a0[11]) / 3) || ((v2 || v2) == (v3 + v0)));
+    } else {
+        v0 = (((v2 <= v2) ? (70 * 99) : (v1 > a0[0])) || ((v2 && v0) ? (99 * a0[0]) : (65 > v3)));
+        a0[12] = (((v3 * a1[1][5]) && (v1 + v2)) != ((v1 <= v0) / 5));
+        v0 = (((v0 ? v1 : a0[4]) * (v2 + v3)) != ((a1[2][4] % 9) || (a0[13] <= v2)));
+    }
+    v2 = (((v1 >= a0[6]) >= (v0 && a0[12])) ? ((83 < v3) || (a0[10] + a0[12])) : ((a1[0][13] - a0[9]) - (5 - v0)));
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v0 = (((76 % 1) >= (49 <= a1[3][15])) != ((i6 / 4) / 5));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v2 = (((a0[0] <= 41) * (1 >= 49)) * ((i6 - a1[3][11]) ? (v2 ? 38 : 5) : (55 == a0[5])));
+                    v0 = (((v0 ? a1[3][10] : a1[3][8]) / 6) && ((a0[14] ? v2 : i7) < (v3 - v1)));
+                    v2 = (((i6 * i6) < (24 + 8)) >= ((a1[3][12] - a1[1][3]) / 5));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((a0[4] && a1[0][10]) || (v3 != 41)) + ((74 / 1) >= (i6 && 18)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((a0[3] * v3) == (v2 / 1)) != ((v0 ? a0[9] : v2) % 9));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,315 @@
+int f0() {
+    int v0 = 40;
+    int v1 = 80;
+    int v2 = 95;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a1[2][0] = (((v3 != a0[11]) ? (v0 - i0) : (36 - 66)) ? ((v0 == 4) / 2) : ((v2 / 5) % 9));
+        a1[2][4] = (((i0 != 51) || (v0 == v2)) * ((a1[2][0] || 78) < (v0 - a0[14])));
+        {
+            int i1 = 0;
+            do {
+                v1 = (((26 == 20) >= (59 != v3)) + ((31 - i1) + (68 || a1[1][11])));
+                a1[3][10] = (((85 * 97) != (3 == a0[15])) || ((v3 * 2) >= (v1 || i0)));
+                v0 = (((v1 || v0) - (a1[1][11] + v0)) < ((v1 + a0[9]) ? (a0[8] / 2) : (49 ? 25 : a0[0])));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+    }
+    a1[3][0] = (((v3 && v2) && (v3 - v1)) - ((v3 && a0[1]) < (86 != 34)));
+    v0 = (((v1 ? v1 : v3) >= (a1[0][3] != v1)) < ((a0[6] <= v3) ? (a0[8] / 6) : (a1[3][2] - a1[2][11])));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v2 < a1[2][15]) || (i3 <= v1)) != ((83 * 16) % 9));
+                    v3 = (((v0 - v1) - (50 < v0)) ? ((a0[13] && a0[13]) == (i3 || a0[0])) : ((a1[2][5] <= i3) != (87 >= a0[11])));
+                    v2 = (((v3 == 67) - (i3 == v1)) || ((v2 >= a1[1][12]) ? (a1[3][9] >= a1[0][0]) : (i2 == i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v3 = (((v1 ? v2 : v1) ? (a1[3][13] || a1[0][14]) : (i2 || 46)) ? ((v0 + v0) > (21 * 20)) : ((i2 + a0[7]) * (21 < v2)));
+            v2 = (((v3 < v2) ? (a1[2][9] || a0[2]) : (82 >= v2)) / 2);
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a1[0][12] = (((v2 ? 37 : v0) - (i5 ? v3 : 71)) || ((v2 * a0[6]) != (v3 && v2)));
+                    a0[2] = (((a1[3][9] - i5) > (75 / 4)) < ((41 * v1) >= (33 ? i4 : v2)));
+                    v2 = (((15 && i4) % 4) && ((a1[3][13] && a0[15]) - (52 ? a0[5] : a1[0][13])));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a1[2][0] = (((a1[1][15] >= v1) + (92 < 12)) == ((v1 == 48) + (v2 < i4)));
+            v0 = (((i4 || v0) - (v3 * v2)) && ((56 <= v3) != (v3 - v0)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    a1[3][9] = (((87 || a0[1]) ? (29 ? v1 : v3) : (46 && a0[10])) ? ((a1[0][15] - 94) && (v1 / 3)) : ((a0[3] <= v0) > (v2 > v1)));
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    a1[1][6] = (((v1 * a0[13]) % 9) && ((i6 <= i7) ? (43 % 6) : (38 > v3)));
+                    v2 = (((v2 != a0[4]) || (22 ? i7 : a0[12])) * ((i6 <= v3) != (98 || a1[0][3])));
+                    v3 = (((3 || 31) % 4) >= ((v2 <= i6) * (22 && i7)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((a0[3] ? 3 : 5) - (77 < v0)) || ((v0 / 4) != (v3 == v3)));
+            v0 = (((v3 % 4) || (a1[3][12] > v2)) + ((i6 - v2) < (v1 - v0)));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        v3 = (((v3 / 6) - (a0[8] < 75)) ? ((v0 || v0) == (63 ? a0[14] : v1)) : ((a1[3][1] <= a1[2][10]) || (v3 ? a0[1] : 40)));
+        v2 = (((i8 == a0[9]) <= (v2 / 2)) > ((a0[15] == 35) > (37 + v0)));
+        for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+            v1 = (((53 % 2) < (i9 ? v2 : 24)) % 4);
+            v1 = (((45 + v3) ? (v0 >= v0) : (v3 == a1[1][12])) > ((v3 || v2) ? (25 && v2) : (80 != v1)));
+            a0[9] = (((a1[1][15] <= 84) <= (a1[3][5] < i8)) || ((31 - v1) + (a1[0][9] / 3)));
+        }
+    }
+    v1 = (((57 < v1) == (a0[0] ? v1 : v3)) <= ((4 ? v1 : v1) * (a1[1][5] / 9)));
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        v3 = (((a1[2][10] > v1) > (42 || v0)) % 1);
+        {
+            int i11 = 0;
+            while (i11 < 3) {
+                v2 = (((a1[0][13] <= 73) - (i10 * 25)) && ((i10 && 93) + (i11 - v0)));
+                v1 = (((a1[1][1] < a0[14]) - (v3 || 49)) ? ((v0 <= a1[3][13]) < (v0 <= 1)) : ((49 < v0) % 3));
+                v2 = (((a1[0][10] != v0) + (v0 <= v3)) / 5);
+                i11 = i11 + 1;
+            }
+        }
+        a0[2] = (((39 >= a0[10]) % 6) >= ((v2 >= a1[0][6]) * (i10 || v1)));
+    }
+    return (((v0 != v0) / 8) != ((v3 == v3) * (31 % 3)));
+}
+int f1() {
+    int v0 = 48;
+    int v1 = 50;
+    int v2 = 87;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 + 73) && (v1 ? 56 : 73)) > ((a0[11] < v2) >= (v3 + a0[2])))) {
+        v3 = (((v3 > 35) < (36 < v3)) == ((v1 < a1[3][7]) ? (a0[1] - v3) : (a0[9] <= a0[15])));
+        v1 = (((a1[3][3] <= v3) / 7) % 2);
+        v0 = (((v0 ? 48 : v1) ? (96 * v0) : (v2 != 19)) < ((v0 + v3) && (v3 == a0[2])));
+    } else {
+        v0 = (((v1 && v1) * (a1[2][3] > 49)) >= ((v3 ? a0[5] : a1[3][15]) ? (v0 < v0) : (v2 && a1[2][3])));
+        v3 = (((v0 / 4) && (v0 * 84)) - ((75 ? v3 : a1[0][11]) - (a1[3][8] || v1)));
+        v0 = (((47 && v2) || (v3 * v0)) && ((v1 != a1[2][14]) != (v2 && 30)));
+    }
+    v2 = (((v3 / 4) > (v1 >= v3)) == ((v0 * a0[3]) - (v1 && v1)));
+    v1 = (((a0[5] + v3) ? (a0[0] >= a0[7]) : (a0[5] >= 95)) * ((23 <= v3) - (a0[9] >= 0)));
+    if ((((a1[1][0] / 3) + (v1 ? v2 : v0)) % 5)) {
+        v0 = (((v2 > v3) == (64 % 2)) > ((a1[3][9] != 94) + (v0 <= 65)));
+        v3 = (((a1[3][12] ? v2 : v2) * (24 || v3)) - ((v2 * v2) / 4));
+        a1[2][13] = (((82 == v3) - (v1 >= v0)) <= ((v1 ? 83 : a1[2][4]) / 7));
+    } else {
+        v3 = (((81 ? v2 : v3) && (28 > a1[1][9])) >= ((v3 / 9) > (63 < v1)));
+        a1[1][9] = (((v0 < a1[0][4]) ? (50 / 9) : (31 && v0)) <= ((42 ? 33 : 43) > (v3 % 4)));
+        v0 = (((a1[3][14] * 15) == (v3 == v1)) + ((v0 / 7) ? (v2 * 61) : (81 < 94)));
+    }
+    if ((((a1[2][3] ? v0 : a1[1][5]) || (46 && v1)) * ((v3 >= v0) ? (a1[1][10] / 6) : (a1[1][14] ? v2 : a1[0][9])))) {
+        a0[12] = (((v2 * v1) ? (a0[12] % 5) : (v2 ? v1 : 93)) >= ((42 == v0) / 4));
+        v3 = (((a0[1] % 8) - (v1 * 13)) + ((20 - v1) ? (v3 % 9) : (v3 != a1[2][10])));
+        v3 = (((v1 && a1[0][7]) == (13 + v3)) != ((a1[1][12] >= v2) > (v1 > a1[3][6])));
+    } else {
+        a0[9] = (((v0 != 54) || (a1[0][9] >= v0)) || ((31 != v3) > (52 > v2)));
+        v0 = (((v1 == 76) != (73 > 28)) >= ((v1 >= a0[9]) < (v0 / 4)));
+        a0[10] = (((63 ? a0[0] : a0[1]) + (v2 == v3)) - ((v0 * v3) % 5));
+    }
+    if ((((a1[1][9] <= v1) < (a1[1][5] / 9)) || ((2 + v1) - (a0[10] < v3)))) {
+        v2 = (((50 > a0[3]) && (v1 * v2)) && ((17 != 53) != (10 || v1)));
+        v0 = (((a1[3][11] ? a1[1][7] : v2) != (v0 || v0)) % 3);
+        v1 = (((77 ? a1[1][7] : v1) * (a1[1][8] / 5)) - ((v1 && v2) * (a1[1][10] && 60)));
+    } else {
+        v2 = (((a0[5] - v1) * (a1[2][14] % 6)) - ((v3 && v0) / 7));
+        a1[1][0] = (((v0 + a0[13]) != (a0[12] != a1[2][3])) + ((70 && 17) && (v0 >= v0)));
+        v1 = (((v1 <= a0[11]) ? (v3 <= v1) : (36 > v1)) < ((v2 != a1[2][10]) - (v1 != v2)));
+    }
+    v1 = (((a0[15] >= 62) ? (v3 >= a1[0][7]) : (v1 != 94)) - ((a1[3][0] <= v0) > (v3 && a1[0][4])));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v3 / 3) + (34 <= v0)) || ((v3 - v1) % 5));
+            a0[4] = (((v2 + v1) * (v1 != v3)) ? ((v0 - v0) ? (57 <= v2) : (a0[9] || v2)) : ((v3 * 72) || (88 / 9)));
+            {
+                int i1 = 0;
+                do {
+                    a0[11] = (((a1[2][0] < v3) && (v0 > a1[1][15])) - ((a0[4] ? a1[0][10] : 18) >= (i1 - a1[3][14])));
+                    a0[14] = (((v1 && v0) - (v0 ? 55 : a1[1][1])) || ((89 < v0) ? (i0 / 9) : (v2 * a1[3][14])));
+                    v1 = (((v1 == i0) - (v1 - i1)) ? ((v3 >= 38) >= (a0[6] < a0[0])) : ((i1 ? 23 : i1) == (77 <= 3)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v2 <= v1) / 6) - ((a0[15] / 8) + (i2 == 34)));
+                    v3 = (((v2 ? v3 : a0[13]) > (74 && a0[3])) >= ((62 * 3) * (a0[0] + 16)));
+                    v3 = (((23 / 7) == (a0[0] ? a1[2][14] : a1[1][12])) && ((a0[0] != i3) == (77 > 4)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v3 = (((v3 > v1) * (v1 % 3)) - ((0 * 2) != (a1[1][2] * v3)));
+            v2 = (((v0 < a0[14]) ? (a0[7] != 45) : (a1[0][8] ? v1 : v3)) / 4);
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[2][6] = (((60 ? i4 : 92) * (49 > 91)) || ((v1 || i4) + (a1[3][10] == a0[3])));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((a1[1][1] / 1) > 69) break;
+                    a1[3][9] = (((v2 < i4) % 3) > ((v2 % 6) ? (i5 <= a1[1][14]) : (a0[13] / 3)));
+                    a1[2][14] = (((v0 / 3) ? (i5 || a0[4]) : (i4 / 4)) * ((i5 > v3) * (60 || 77)));
+                    a1[1][2] = (((a1[1][3] % 9) ? (v3 * v2) : (a0[0] + i5)) - ((v3 >= a0[10]) / 7));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[14] = (((42 * v3) != (a1[2][6] != a0[0])) || ((v0 == 36) > (a1[3][14] || a0[6])));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((v0 <= v2) + (a0[0] <= 63)) <= ((v0 >= v2) ? (v3 / 8) : (v0 * v2)));
+}
+int f2() {
+    int v0 = 51;
+    int v1 = 77;
+    int v2 = 26;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[10] > v3) <= (v1 >= a1[0][1])) || ((88 < v3) < (a0[12] / 3)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 < v2) >= (v1 ? 73 : v3)) < ((v3 >= v2) && (a0[8] % 8)));
+            v3 = (((v3 ? i0 : 23) != (14 >= a0[10])) <= ((a0[4] % 8) / 3));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v3 = (((v3 - v2) - (17 >= a1[2][11])) ? ((a1[2][10] < 66) > (53 <= a0[5])) : ((21 <= 71) < (i0 > i1)));
+                    v2 = (((v3 - i1) + (i0 > 12)) ? ((a0[12] % 5) && (a0[5] < v1)) : ((79 < a0[14]) / 8));
+                    v0 = (((75 ? v2 : v3) >= (v2 % 1)) != ((v3 ? v1 : a1[3][0]) + (v2 && a0[7])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    v1 = (((80 == 46) != (10 * v2)) ? ((v2 > 32) == (v0 < v2)) : ((68 > 95) >= (a0[7] - 77)));
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                if ((a1[2][9] ? v0 : 88) > 93) break;
+                a1[1][6] = (((a1[2][4] || v0) ? (a0[9] <= 40) : (v1 / 6)) != ((v3 || v0) == (i2 >= v3)));
+                v0 = (((i2 <= i3) && (a0[15] % 2)) < ((a0[3] ? v2 : i3) + (i2 >= v1)));
+                a0[6] = (((v2 * v0) != (80 ? 72 : a0[9])) + ((i2 ? v1 : a1[0][7]) == (v2 < 62)));
+            }
+            v0 = (((19 + 17) < (36 ? v0 : a1[0][9])) != ((33 <= v0) / 4));
+            v3 = (((a0[13] * i2) == (41 ? 43 : v3)) < ((17 + 59) * (v2 % 3)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a1[1][15] = (((v0 || v1) != (24 ? a1[2][12] : 36)) == ((14 == a0[12]) / 4));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((a1[3][8] != v1) + (a1[2][5] ? a0[14] : i4)) || ((v3 * a0[9]) - (a0[5] == a0[8])));
+                    v0 = (((v3 > v1) % 6) / 8);
+                    a1[3][4] = (((a0[4] != a1[3][12]) ? (i5 / 4) : (52 / 5)) * ((58 - v3) >= (24 - i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a0[1] = (((a1[3][6] <= a1[2][2]) / 9) != ((v0 && a0[14]) ? (v0 == 87) : (v2 % 4)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((10 ? v0 : v3) > 62) break;
+            v3 = (((a1[1][14] ? 8 : 89) ? (57 * 26) : (76 || a1[1][1])) != ((a0[8] > a1[3][13]) / 8));
+            {
+                int i7 = 0;
+                do {
+                    v3 = (((a1[1][13] ? a1[1][13] : 6) - (v3 != a1[3][10])) || ((57 + i6) > (a0[9] && 70)));
+                    v2 = (((v1 < i7) % 9) % 9);
+                    v3 = (((67 > 5) ? (v2 - a1[1][15]) : (v0 - a1[3][2])) ? ((a1[2][14] || a0[13]) > (67 && v1)) : ((v0 || a0[1]) > (i6 ? v2 : a0[6])));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            v3 = (((i6 && 21) ? (43 < a1[1][7]) : (v1 * a0[15])) * ((96 >= v0) / 8));
+            i6 = i6 + 1;
+        }
+    }
+    v1 = (((75 * v2) % 1) != ((a0[5] != v3) / 1));
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        a0[9] = (((v0 && a1[3][7]) <= (i8 || i8)) % 8);
+        for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+            v2 = (((v2 ? i8 : 41) < (a0[14] * 41)) + ((a0[5] - v3) > (a1[2][13] - i9)));
+            a0[7] = (((i8 ? 44 : 95) - (v1 > 93)) / 2);
+            a0[15] = (((48 + i8) && (24 - a1[0][5])) - ((v2 >= i8) ? (v0 ? a1[0][3] : 53) : (i8 && v2)));
+        }
+        v3 = (((v2 >= v2) && (32 / 8)) ? ((v2 <= 4) % 2) : ((a0[15] < v3) || (v0 <= 58)));
+    }
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        v2 = (((v0 >= a0[11]) != (v3 * 43)) == ((v2 - 72) <= (a0[2] == a0[14])));
+        v1 = (((i10 % 8) && (i10 * v0)) || ((v2 % 7) < (v2 > v1)));
+        {
+            int i11 = 0;
+            do {
+                v3 = (((v1 / 9) ? (v3 <= v1) : (v1 > i11)) || ((83 == 20) && (a1[3][4] || 14)));
+                a1[0][6] = (((i10 + v1) - (v1 != 86)) <= ((i10 <= 63) && (43 && a0[14])));
+                v0 = (((a0[6] ? 88 : v2) / 9) || ((v3 ? v3 : 8) != (a1[0][13] ? v1 : i11)));
+                i11 = i11 + 1;
+            } while (i11 < 3);
+        }
+    }
+    if ((((v0 * a1[1][11]) <= (24 || 3)) || ((v1 < 33) > (a0[11] ? a0[12] : v3)))) {
+        v3 = (((99 - 26) != (a0[1] * v3)) * ((a0[4] ? v0 : a1[1][10]) % 3));
+        v1 = (((78 < v1) && (v0 != v0)) - ((v2 % 1) ? (v2 != v0) : (a1[1][3] >= v2)));
+        v1 = (((v2 > v0) <= (a0[10] && v3)) <= ((a1[1][2] * v0) / 8));
+    } else {
+        v3 = (((v1 + 11) ? (a1[1][10] ? v2 : a0[8]) : (v2 != a1[3][6])) + ((67 * v1) / 5));
+        a1[1][1] = (((a1[0][1] + v3) ? (43 / 4) : (v1 / 2)) / 2);
+        v3 = (((v3 / 3) && (v1 ? a1[1][12] : v1)) == ((11 >= a1[1][14]) > (18 > v3)));
+    }
+    return (((v3 ? a1[3][15] : a0[4]) >= (v3 || v1)) != ((76 + 56) == (a0[4] - a1[1][4])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,4467 @@
+int f0() {
+    int v0 = 9;
+    int v1 = 71;
+    int v2 = 35;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 <= 39) % 4) > ((a1[3][2] <= v0) ? (v1 - v2) : (13 > v1)))) {
+        v3 = (((v0 ? 60 : 18) <= (v2 && v3)) + ((a1[2][13] < v1) ? (v1 % 9) : (v3 - 8)));
+        a0[4] = (((a1[0][4] == 2) == (61 * v1)) ? ((2 > v1) % 6) : ((v1 - 59) || (v3 / 2)));
+        a1[2][8] = (((87 || 85) * (65 >= 99)) * ((v2 ? a1[2][3] : 33) - (v0 - v2)));
+    } else {
+        a1[3][12] = (((v0 * v3) || (v2 - v2)) && ((a1[3][1] + v1) * (v1 / 9)));
+        a0[9] = (((v1 * a1[3][2]) / 3) < ((v1 - v1) > (92 <= v2)));
+        v0 = (((70 * v1) % 3) && ((v1 % 9) / 7));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[7] = (((94 > a1[3][8]) - (89 + v1)) * ((a1[0][14] > a0[2]) > (94 != v1)));
+            v0 = (((25 * v2) || (65 - 83)) <= ((v2 && 53) <= (v2 != i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((96 / 8) > 78) break;
+                    v0 = (((i1 <= a0[5]) > (56 >= a1[3][15])) * ((i1 % 3) - (v0 < v3)));
+                    a0[3] = (((v2 && i0) % 1) >= ((a0[5] >= 68) == (26 < a0[0])));
+                    v1 = (((v2 * 48) >= (24 / 7)) ? ((i0 <= i1) ? (20 - 30) : (v0 > 76)) : ((40 < i1) >= (a1[0][6] - a1[2][11])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[15] = (((v0 + 58) && (30 < i2)) >= ((i2 - a0[8]) ? (v2 ? 61 : v2) : (17 == a1[0][5])));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((12 / 6) && (v2 > v2)) > ((50 ? 58 : v2) != (67 ? i3 : 36)));
+                    v3 = (((i2 ? i2 : 56) ? (87 + i3) : (v3 % 4)) > ((v1 / 6) >= (96 / 7)));
+                    a0[9] = (((i2 || 27) < (v1 == 21)) == ((4 <= a1[0][10]) > (31 == 2)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a1[3][2] = (((v0 % 3) + (a1[0][8] + v2)) && ((v3 ? v2 : a0[1]) || (a0[3] - a0[6])));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((v1 < a0[4]) || (v2 > 94)) == ((a0[5] ? v0 : a0[15]) ? (a0[8] <= a0[0]) : (84 <= v2)))) {
+        a0[9] = (((a0[1] || v0) + (a0[8] && a0[5])) >= ((v2 < v1) % 3));
+        v3 = (((94 <= 57) + (a1[0][12] || v1)) / 6);
+        v3 = (((v1 > 95) >= (v1 + 44)) <= ((v2 == v0) || (a1[0][11] >= a1[1][9])));
+    } else {
+        v0 = (((v1 != v2) >= (a1[3][6] ? v2 : a0[0])) == ((a1[3][13] - v2) % 2));
+        a1[2][11] = (((v1 > v1) >= (v2 >= 38)) <= ((v0 % 3) % 9));
+        v1 = (((a1[1][8] - a0[13]) >= (a0[14] - v1)) == ((v3 != a1[1][12]) ? (v2 ? a1[3][10] : v2) : (v1 < 15)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v2 < a0[10]) ? (45 != v3) : (45 == a1[0][14])) == ((v3 % 5) == (i4 - v1)));
+            a0[4] = (((v0 == a1[3][1]) % 1) < ((v0 * a0[10]) * (59 - v3)));
+            {
+                int i5 = 0;
+                do {
+                    a0[4] = (((v2 > v3) != (41 / 4)) < ((i5 % 4) / 7));
+                    v1 = (((61 / 7) ? (v2 == v1) : (v1 ? i4 : a0[9])) <= ((a1[2][6] > a0[5]) - (a1[1][10] || v1)));
+                    v0 = (((19 * v0) <= (v0 || 9)) < ((i5 / 3) ? (a0[11] % 3) : (i4 >= v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    a0[6] = (((v0 ? v3 : v0) == (30 * v1)) > ((11 >= 83) && (v2 != v1)));
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v2 = (((v2 * v2) || (i6 != i7)) != ((a0[11] <= i6) ? (v2 + 50) : (v2 / 1)));
+                v2 = (((a1[2][6] % 8) + (v3 && a0[6])) < ((v1 * v3) || (78 / 2)));
+                v1 = (((a0[4] - a0[13]) * (v3 - a0[2])) || ((v0 + 46) >= (v0 < 33)));
+            }
+            v2 = (((v0 ? 16 : 80) * (v3 >= 31)) || ((90 ? v1 : i6) != (a1[2][11] >= 3)));
+            a1[0][3] = (((i6 != v0) * (v0 && v1)) ? ((i6 < i6) % 5) : ((v1 - 84) >= (a1[1][8] ? 55 : a1[0][8])));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    v3 = (((a0[14] ? v1 : 72) || (42 >= a1[2][5])) == ((v2 + v0) || (a1[0][6] - a0[8])));
+    if ((((v3 ? 30 : 74) / 7) && ((v3 ? v0 : v3) < (v1 || 94)))) {
+        a0[5] = (((v2 * a0[7]) == (99 ? v0 : a0[12])) ? ((16 + a1[0][5]) && (v2 - a0[7])) : ((v3 > v1) == (v2 <= v1)));
+        v1 = (((86 * 72) % 1) ? ((13 ? v1 : v0) >= (a1[0][9] / 4)) : ((a0[10] + v0) / 1));
+        a0[0] = (((v0 > a1[3][11]) / 2) < ((61 > v3) == (55 || a0[14])));
+    } else {
+        a0[8] = (((v0 <= a0[13]) && (24 * v1)) + ((v2 || v3) < (v2 * a0[5])));
+        v3 = (((v2 <= v3) != (v1 <= a1[1][15])) * ((v3 + v2) * (v2 ? v0 : v3)));
+        v3 = (((v3 + v1) == (v1 >= 50)) ? ((v3 % 6) && (9 && v0)) : ((v1 > a1[0][5]) <= (80 && v2)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            if ((a0[13] != i8) > 61) break;
+            a0[3] = (((64 * v3) % 2) && ((48 ? a1[1][1] : a1[0][13]) || (i8 && v3)));
+            a0[2] = (((2 >= 87) == (44 % 3)) <= ((v0 <= v2) < (a1[1][5] && i8)));
+            {
+                int i9 = 0;
+                do {
+                    v0 = (((v0 && v3) > (45 == 83)) - ((a1[3][14] % 6) + (21 && v1)));
+                    v1 = (((58 ? a1[1][9] : v3) <= (a1[0][11] > v2)) > ((a0[10] == v2) - (v2 ? 87 : 8)));
+                    v0 = (((82 > a0[12]) - (v0 % 7)) / 8);
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v3 > v2) <= (v0 >= a0[0])) || ((a1[2][15] != v3) >= (44 >= 76)));
+}
+int f1() {
+    int v0 = 30;
+    int v1 = 43;
+    int v2 = 49;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[7] != i0) > (v2 % 7)) < ((v1 - v1) != (v1 <= v1)));
+            a0[14] = (((v1 < 80) ? (57 ? i0 : i0) : (v1 / 8)) < ((i0 <= 99) <= (i0 % 1)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((2 % 8) > 77) break;
+                    v1 = (((v2 <= i0) < (a1[0][11] >= 32)) && ((a1[1][5] ? v3 : v2) >= (v0 ? 95 : a1[2][6])));
+                    v0 = (((33 < i1) != (v0 != 80)) + ((78 == 44) != (v3 <= 50)));
+                    v0 = (((v0 * v2) || (v3 < a0[3])) <= ((a0[12] >= a0[0]) / 4));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a0[14] = (((94 && a0[3]) && (20 && i2)) < ((a1[3][8] != v2) + (79 ? a1[0][10] : a0[15])));
+                v2 = (((18 <= i2) <= (58 >= i2)) < ((6 && 25) && (i3 && i3)));
+                v2 = (((97 < i3) || (v0 <= 99)) - ((a1[0][14] ? v0 : v2) ? (v3 != v2) : (i2 == 81)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v3 = (((i2 ? v1 : v0) + (44 != 14)) / 5);
+        v0 = (((a0[10] || 68) && (a0[12] >= 46)) != ((v2 % 8) == (v2 > a0[6])));
+    }
+    a0[9] = (((4 || v2) + (18 < a0[1])) ? ((63 && v1) || (a1[2][6] + v0)) : ((v3 && 40) * (v3 < v2)));
+    if ((((v1 != 53) * (v0 + a0[11])) % 9)) {
+        v1 = (((47 ? a0[7] : 5) >= (82 % 1)) * ((v0 == v3) / 3));
+        v3 = (((87 / 5) >= (v0 > v3)) + ((v0 - 39) - (v3 % 5)));
+        v2 = (((1 && a0[6]) <= (6 != 91)) <= ((62 <= a1[3][13]) % 2));
+    } else {
+        v2 = (((48 == 2) * (v2 ? v1 : a1[1][7])) != ((v2 && v0) <= (v3 / 8)));
+        v1 = (((v1 > v3) <= (a1[2][12] && a0[0])) && ((v1 / 7) || (22 - v3)));
+        v1 = (((v0 ? a1[0][0] : 38) % 2) || ((v0 / 5) > (v0 && v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a0[0] = (((v0 >= v3) != (i5 ? v0 : a1[0][5])) + ((94 && v2) == (v1 != 75)));
+                    v1 = (((v3 % 9) == (44 ? 95 : 86)) <= ((a1[3][7] + v1) ? (a0[13] > i4) : (v3 % 5)));
+                    v2 = (((i5 ? 98 : v1) ? (v3 ? v1 : i4) : (a1[1][11] % 2)) < ((i5 || v1) != (a1[3][0] > v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v1 = (((v1 || v3) + (v0 > a0[15])) >= ((v3 || a1[3][8]) == (v0 ? v3 : a1[1][1])));
+            v2 = (((20 != a1[1][8]) - (a0[2] < v1)) == ((v0 ? i4 : v0) || (a0[15] + a0[11])));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            a0[1] = (((8 / 6) && (i6 / 4)) > ((a0[0] <= 79) ? (v3 % 5) : (i7 ? 44 : v1)));
+            a0[1] = (((v0 - v3) && (v0 || v3)) != ((v0 || a1[0][3]) ? (10 || v3) : (a0[8] >= v2)));
+            v3 = (((22 / 3) % 9) > ((a1[0][2] / 4) || (33 <= i7)));
+        }
+        v2 = (((v0 == a0[13]) || (v1 - 85)) % 9);
+        a0[3] = (((a1[2][2] >= a1[0][6]) >= (v0 > a1[3][8])) > ((v2 % 7) >= (v1 % 7)));
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        v0 = (((a0[4] / 2) && (a1[3][5] % 1)) + ((34 - a0[5]) || (v0 + v2)));
+        v0 = (((a1[2][7] || 69) / 1) != ((90 || a1[2][8]) ? (i8 % 6) : (v2 > 83)));
+        {
+            int i9 = 0;
+            while (i9 < 4) {
+                v1 = (((32 % 4) + (i8 >= a0[4])) != ((i9 - 24) != (a1[1][4] + v3)));
+                v1 = (((a0[13] > 23) ? (i9 - a1[0][15]) : (a0[4] == v2)) && ((a0[12] != i9) % 5));
+                a0[10] = (((v0 != 89) * (5 + v2)) ? ((v1 * a1[2][3]) || (v0 - v2)) : ((45 == i8) || (a1[0][4] % 8)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    v1 = (((a0[8] + v1) <= (v1 ? v1 : v1)) >= ((v0 % 1) >= (v1 == v0)));
+    v3 = (((a1[2][13] ? v3 : a0[1]) < (v3 < a0[13])) < ((v1 > v2) - (v2 <= v3)));
+    a0[10] = (((v1 ? v2 : a1[1][7]) ? (a0[6] < a1[0][5]) : (v1 <= a0[11])) == ((a1[3][4] + 82) <= (30 > v1)));
+    return (((a1[0][4] || 26) && (v3 > 21)) == ((v2 ? a1[1][2] : v3) / 4));
+}
+int f2() {
+    int v0 = 13;
+    int v1 = 83;
+    int v2 = 52;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a1[3][5] = (((a0[3] - a0[12]) ? (a1[0][3] - 89) : (a0[0] < v0)) != ((v3 && v1) * (v2 == a0[0])));
+            v1 = (((a0[9] > 19) < (a1[2][1] < 25)) < ((v2 % 4) % 9));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a1[3][4] = (((86 && a1[0][8]) * (i0 % 7)) || ((i1 || v1) ? (a0[8] || a1[1][3]) : (i1 && 40)));
+                a1[2][5] = (((a1[2][9] < a1[1][15]) >= (19 != 81)) < ((33 * v1) / 9));
+                v1 = (((12 ? v2 : 88) ? (18 >= v0) : (9 > v2)) / 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 || a0[15]) ? (a1[0][9] ? v3 : v0) : (59 % 5)) != ((16 && a1[0][7]) && (a0[5] - v1)))) {
+        a0[2] = (((26 >= v0) % 3) == ((a1[1][3] == v1) || (a0[5] < a1[3][5])));
+        a1[0][3] = (((a1[3][3] != v0) > (79 != a0[6])) / 6);
+        v1 = (((a1[0][5] || v0) && (a0[1] + a1[0][0])) - ((v2 >= v1) < (v3 - 10)));
+    } else {
+        v2 = (((v3 && a1[3][0]) ? (v0 != 86) : (a1[0][15] != 96)) / 5);
+        v2 = (((v2 * v0) > (v0 * a0[14])) / 4);
+        v0 = (((v1 ? v3 : v1) < (96 || v1)) ? ((v0 != v3) ? (v1 == a0[0]) : (a0[7] + v3)) : ((v3 - v3) + (a1[2][12] >= v3)));
+    }
+    if ((((83 || 2) || (78 * a0[10])) ? ((24 % 8) || (v2 % 3)) : ((a0[14] != a1[1][13]) != (v1 * 11)))) {
+        v1 = (((73 ? v0 : v3) != (66 % 3)) || ((v2 % 6) > (a0[12] * v2)));
+        a1[3][1] = (((a0[9] + 5) <= (17 >= a1[1][11])) >= ((a0[11] <= a1[3][2]) >= (a1[0][9] >= v0)));
+        v0 = (((v2 < v1) >= (17 - a0[13])) >= ((v2 / 1) == (v1 != v1)));
+    } else {
+        v1 = (((v0 > v1) && (a1[3][6] == v0)) ? ((v3 == v3) > (a0[4] || v1)) : ((65 == v3) > (a1[0][1] % 5)));
+        v0 = (((v2 - v3) < (v0 > v1)) <= ((57 <= v2) * (v1 * v0)));
+        v2 = (((v3 % 7) < (45 > v3)) + ((v0 / 5) > (16 == a1[1][5])));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((32 ? v1 : 40) > 50) break;
+        a0[4] = (((i2 <= v2) + (v3 + v3)) - ((v2 ? a0[14] : v2) != (a0[0] > v2)));
+        v1 = (((a0[4] > a0[8]) <= (v0 % 6)) >= ((v3 || v0) <= (v2 && 20)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v3 = (((v3 % 2) ? (v2 + 13) : (49 && v0)) / 1);
+                v0 = (((83 > 41) <= (a0[7] - v1)) > ((v3 - v2) - (v1 ? 68 : a1[3][3])));
+                v0 = (((v0 <= v0) - (a0[8] && 41)) * ((v2 == 92) <= (a1[2][3] * a1[1][7])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        a0[0] = (((i4 > 16) == (v0 * a1[2][0])) || ((50 == v1) <= (v3 ? 18 : 44)));
+        a1[3][3] = (((a1[2][9] / 9) >= (97 % 8)) ? ((v1 % 3) * (v3 < a0[4])) : ((v2 - a1[0][1]) != (a1[1][1] == 91)));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            a0[10] = (((a0[7] <= 89) ? (a0[10] ? v3 : v3) : (v2 >= i5)) <= ((i5 ? a0[9] : a0[13]) > (v2 >= a0[4])));
+            v2 = (((a0[1] + 33) % 7) >= ((a1[3][7] * 79) == (a1[3][3] % 4)));
+            v0 = (((91 < v0) ? (v1 > 1) : (7 < a1[2][15])) % 3);
+        }
+    }
+    v3 = (((v2 - a0[2]) > (40 - a0[10])) > ((v3 == 68) <= (31 ? v2 : v0)));
+    if ((((a0[5] == 23) ? (96 + a0[6]) : (v0 - 74)) && ((a1[1][8] + 10) == (v3 / 2)))) {
+        a1[2][3] = (((v2 < 61) % 1) / 6);
+        v1 = (((52 ? v0 : 7) * (v2 != v2)) || ((v2 == v2) * (a1[2][9] < 71)));
+        a0[15] = (((a0[7] + v2) > (v0 && 38)) == ((88 > 44) * (68 ? v3 : v3)));
+    } else {
+        a0[5] = (((a1[2][4] && 39) && (a0[14] > v1)) / 6);
+        v0 = (((a1[3][13] >= v3) ? (a1[1][8] > a1[2][9]) : (a1[0][0] == v0)) % 6);
+        v2 = (((v1 % 7) * (v3 >= a0[13])) / 7);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            a0[14] = (((a0[10] >= 41) + (22 < i6)) + ((v2 / 7) == (a1[2][15] ? a1[2][9] : i6)));
+            v3 = (((v3 * v0) / 9) / 7);
+            {
+                int i7 = 0;
+                do {
+                    a1[2][3] = (((v3 + v0) && (1 == a1[3][12])) - ((63 != v0) != (i6 * v2)));
+                    a1[2][9] = (((i6 ? a0[12] : a0[5]) == (a1[1][8] * v2)) > ((v2 / 5) - (80 >= i6)));
+                    a0[10] = (((86 >= a0[8]) >= (v1 != v3)) * ((6 <= v2) - (a0[4] <= 63)));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a1[3][13] % 8) >= (v3 || 16)) < ((a0[6] == v1) % 5))) {
+        v3 = (((v2 < 33) % 7) - ((34 / 2) % 7));
+        v1 = (((v2 / 7) || (v0 / 1)) % 9);
+        a1[1][3] = (((v0 < 61) >= (a1[0][7] > a0[15])) * ((v0 < 46) && (24 ? v3 : v1)));
+    } else {
+        v0 = (((a1[1][14] <= v0) > (a1[3][8] % 1)) - ((v3 - a0[7]) ? (52 == v3) : (v0 < 79)));
+        a0[9] = (((v3 % 1) && (22 == 94)) / 1);
+        v2 = (((33 > v3) == (a0[3] > v2)) > ((v2 >= 1) ? (v0 - v2) : (a1[0][7] * v0)));
+    }
+    {
+        int i8 = 0;
+        do {
+            for (int i9 = 0; i9 < 3; i9 = i9 + 1) {
+                v2 = (((a0[5] * v1) ? (a1[1][12] >= v3) : (v1 * 53)) ? ((95 == a1[0][8]) / 9) : ((a1[3][5] % 2) ? (84 / 6) : (i8 < a1[0][5])));
+                a0[8] = (((a0[12] - 33) / 4) || ((56 + a0[2]) != (93 && v1)));
+                v3 = (((v1 ? v1 : a1[2][8]) < (43 >= 26)) / 6);
+            }
+            a0[2] = (((7 % 8) < (a0[15] - a1[1][11])) ? ((v0 || v1) < (9 / 4)) : ((a1[0][12] <= a1[3][11]) * (32 > a1[3][13])));
+            v2 = (((45 < v2) >= (v1 % 7)) != ((64 >= v2) % 6));
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    return (((v1 >= a0[0]) == (50 % 5)) ? ((v2 < 25) || (v3 % 7)) : ((v0 + 98) != (a0[6] * v0)));
+}
+int f3() {
+    int v0 = 46;
+    int v1 = 41;
+    int v2 = 27;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 % 5) && (75 + v3)) <= ((a0[15] != v0) < (v3 ? v0 : 97)))) {
+        v2 = (((63 > a1[1][10]) == (v1 ? 54 : 50)) != ((17 / 4) * (96 ? a1[3][4] : v2)));
+        v2 = (((a0[6] + v2) <= (v3 ? a1[2][14] : 5)) % 9);
+        v1 = (((70 - v2) != (v1 ? v3 : 9)) && ((a0[8] * a0[8]) == (a0[4] > v1)));
+    } else {
+        v0 = (((a0[14] / 4) <= (v2 && a0[12])) + ((a1[1][6] % 5) && (v0 > a0[10])));
+        v0 = (((78 % 9) / 2) < ((23 != v3) < (v0 && a0[12])));
+        a1[2][6] = (((v0 > a0[14]) != (v0 > v2)) < ((v0 / 4) - (a0[8] * v0)));
+    }
+    a0[11] = (((v2 ? v2 : v0) > (a1[3][14] >= v0)) - ((a0[2] - v0) < (v3 ? v1 : 70)));
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v3 = (((a0[13] - v0) == (i0 - v2)) < ((1 - a0[14]) == (v3 > v0)));
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            if ((22 ? a1[1][13] : v1) > 54) break;
+            v3 = (((i1 ? a0[11] : a1[1][7]) + (v2 - 47)) < ((8 != a0[13]) / 7));
+            a0[15] = (((66 ? v1 : v0) + (i0 < a0[11])) % 1);
+            v0 = (((v2 && v1) == (v3 + i1)) || ((i1 * 81) >= (i0 - v1)));
+        }
+        a0[10] = (((a1[3][0] <= v2) && (v2 - a0[10])) - ((53 * v0) + (v3 && v2)));
+    }
+    if ((((v0 % 3) == (8 / 5)) / 5)) {
+        v3 = (((v0 / 8) > (v3 + v0)) ? ((24 ? v1 : v2) / 7) : ((v1 ? v3 : v3) * (v2 || a1[1][1])));
+        v1 = (((a0[6] >= v3) ? (v0 ? a1[2][11] : v0) : (v1 <= v2)) - ((v0 >= a1[1][5]) - (v3 == a1[1][11])));
+        a0[12] = (((a0[5] != a1[1][1]) * (v2 == 49)) >= ((13 <= 36) < (98 ? v2 : 46)));
+    } else {
+        v1 = (((34 < a0[10]) != (v1 && 77)) ? ((v1 >= v1) > (55 % 7)) : ((21 != v3) * (v0 - v0)));
+        v3 = (((45 >= v1) ? (v1 != 91) : (v3 + v0)) != ((v2 && a0[3]) % 7));
+        v2 = (((32 ? 60 : v0) >= (v0 && a1[3][8])) >= ((2 ? 37 : 87) == (62 ? 51 : v3)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a1[3][2] = (((v2 + 50) ? (72 == a1[3][9]) : (9 ? v2 : v1)) < ((8 != 59) != (v1 > v2)));
+            v3 = (((79 ? v0 : a0[10]) > (v1 + 85)) && ((v1 ? 72 : v2) % 6));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a0[15] >= a1[3][14]) || (v3 < 20)) + ((i3 + 46) ? (47 ? 14 : v2) : (v2 + v1)));
+                    a0[6] = (((83 + i3) * (a1[2][8] == 92)) + ((a0[15] - i2) - (i3 / 2)));
+                    v0 = (((i3 || v2) - (2 || v3)) && ((v2 <= i3) != (v2 - v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            if ((54 % 6) > 77) break;
+            a0[0] = (((9 < v0) != (a0[8] > 28)) && ((96 && v0) - (v0 - v1)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v1 = (((i5 - v1) || (63 < a0[13])) ? ((i5 >= i4) || (v0 - 78)) : ((v0 == a0[15]) + (i5 || v0)));
+                v3 = (((v2 < 75) < (78 / 3)) >= ((13 / 3) == (a1[1][0] >= 26)));
+                a0[8] = (((v0 % 5) - (64 && v2)) || ((a0[11] && v2) < (v0 % 5)));
+            }
+            v1 = (((37 <= v2) <= (v1 && 38)) * ((v0 || v0) >= (a1[2][5] / 7)));
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((84 % 1) - (v2 ? 55 : v2)) < ((v3 <= v0) < (a1[2][0] == a1[2][2])));
+    if ((((v2 % 3) >= (v1 ? v2 : v1)) > ((13 ? v0 : v3) && (76 < v3)))) {
+        v0 = (((89 >= a0[2]) ? (a0[14] < 90) : (v1 ? a0[5] : v3)) % 8);
+        a0[2] = (((v3 <= a1[0][14]) > (44 > v1)) + ((12 / 5) > (v1 == v0)));
+        a1[1][12] = (((a0[15] || 50) ? (v2 % 2) : (a1[1][8] - a0[13])) && ((64 ? v1 : v0) <= (72 == 19)));
+    } else {
+        v2 = (((v1 % 7) + (v0 > v3)) + ((v0 <= v1) ? (v1 == v1) : (v2 != 59)));
+        v3 = (((v0 * a1[3][3]) <= (v2 / 7)) || ((a0[2] != v1) + (71 != v0)));
+        a0[7] = (((v0 != v2) >= (v0 || 52)) != ((v2 % 8) && (78 ? v1 : v2)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[3] = (((v0 || i6) < (59 ? v1 : 78)) ? ((a1[1][14] <= 17) * (99 / 8)) : ((45 || a0[9]) / 2));
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                v3 = (((a0[3] % 5) && (v1 || i7)) * ((84 ? a1[2][10] : a1[2][11]) || (v2 % 5)));
+                a1[1][9] = (((a1[2][7] <= v3) < (53 && a0[3])) || ((a0[12] || i7) == (v0 / 7)));
+                v2 = (((a1[2][10] || v3) <= (12 > i7)) > ((v0 != a1[1][9]) ? (a0[6] > v3) : (v0 != 75)));
+            }
+            v1 = (((v2 != v1) || (i6 % 3)) < ((v0 != v3) >= (v0 && a1[1][13])));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[2] = (((v0 <= v2) > (v3 <= i8)) - ((v1 % 6) > (v0 * i8)));
+            v3 = (((a0[10] && v1) < (v3 / 1)) > ((i8 + 6) < (v0 * v1)));
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((i8 - i9) > (v3 > 18)) % 4);
+                    v3 = (((v1 <= i8) > (i9 * a1[0][15])) < ((a1[2][3] <= v3) > (v2 * a0[4])));
+                    v3 = (((i8 / 6) / 3) > ((i8 <= v1) + (i9 || i9)));
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    return (((36 / 6) && (v3 % 2)) && ((v3 && v2) == (a0[11] <= a1[1][15])));
+}
+int f4() {
+    int v0 = 49;
+    int v1 = 25;
+    int v2 = 50;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 < a0[15]) + (85 * v1)) > ((a0[14] != a0[10]) || (v2 == v0)))) {
+        v3 = (((70 ? v2 : 38) - (v3 % 4)) ? ((v0 || a0[3]) < (v2 < v1)) : ((a1[3][13] > v3) <= (a0[13] + 92)));
+        v0 = (((a1[1][11] + 1) ? (v3 <= v1) : (a1[1][3] || a1[2][6])) + ((a0[2] - v3) - (81 || v0)));
+        a1[2][15] = (((v2 && 2) - (v1 <= v3)) % 7);
+    } else {
+        a1[1][7] = (((v0 + a0[3]) < (v1 / 7)) ? ((38 + v1) > (v0 * 16)) : ((a0[5] > a1[0][8]) % 9));
+        v1 = (((v2 ? 59 : a0[5]) / 6) > ((78 == 63) && (v0 != 43)));
+        v1 = (((a1[3][11] >= a1[0][6]) - (v2 - 5)) < ((52 <= 51) ? (35 || a1[3][7]) : (v1 >= v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v0 / 3) > 84) break;
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v2 = (((v3 + v3) != (v0 ? v1 : a0[11])) == ((v1 != a1[0][12]) ? (v1 > a0[3]) : (i1 && 31)));
+                v3 = (((a0[9] + v0) == (i0 ? i1 : a1[3][11])) == ((a0[1] <= a0[5]) == (i1 >= v1)));
+                a0[5] = (((v0 / 8) ? (a0[13] > 95) : (a0[9] - a0[1])) != ((v3 + v2) - (v2 / 1)));
+            }
+            a1[2][4] = (((a1[2][3] > v3) % 6) % 3);
+            a1[0][2] = (((a0[1] <= v3) / 8) >= ((v3 || i0) * (v3 >= a1[2][4])));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    v1 = (((62 / 1) % 3) <= ((a0[0] - 12) && (a0[5] - 67)));
+    {
+        int i2 = 0;
+        do {
+            if ((v2 ? v3 : v0) > 63) break;
+            v1 = (((v2 + 69) <= (i2 * 90)) + ((v0 ? v2 : 30) % 7));
+            v1 = (((v2 * i2) <= (87 * i2)) >= ((50 * a1[1][13]) || (83 <= i2)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    a0[1] = (((a1[0][6] < 41) == (a0[12] ? a1[2][4] : i2)) && ((4 || 84) % 9));
+                    v0 = (((v3 / 7) > (a0[11] % 5)) >= ((v1 * 34) * (a0[11] < v0)));
+                    v3 = (((v1 == a0[14]) <= (69 + v3)) != ((a0[13] > a0[7]) != (i3 && v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v1 = (((a0[4] * v3) > (v3 ? a1[3][7] : v2)) * ((a1[2][0] != v1) + (v3 <= a0[4])));
+    if ((((83 ? 30 : a1[3][1]) > (a1[1][11] || a1[1][7])) || ((a1[1][15] ? v1 : v0) >= (45 % 9)))) {
+        a0[2] = (((47 < v0) ? (v3 > 88) : (a0[5] >= a1[1][8])) % 4);
+        v0 = (((a0[9] + a1[1][15]) != (v2 && v0)) - ((a1[0][4] / 1) ? (v1 - v1) : (v2 <= a1[3][3])));
+        v0 = (((v3 ? v1 : a1[3][1]) < (v0 > a1[1][4])) ? ((a1[0][3] + 75) > (v2 / 2)) : ((v3 * v2) && (v3 <= 58)));
+    } else {
+        a1[0][7] = (((a0[9] - v3) + (98 ? a0[10] : v2)) < ((v0 < 17) || (80 * 49)));
+        v0 = (((a0[15] / 2) && (v0 <= v1)) >= ((v3 || v1) <= (v1 < v0)));
+        v1 = (((v3 != v3) ? (a0[12] > a0[14]) : (v0 <= v2)) == ((v0 >= a0[12]) * (52 / 6)));
+    }
+    v1 = (((v0 ? a1[2][1] : 55) ? (v1 != v3) : (55 ? v0 : v3)) + ((v0 % 5) - (v2 % 1)));
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((a0[11] >= a1[0][10]) * (v3 * v2)) - ((v1 < i4) + (48 > 75)));
+                    a0[6] = (((v1 < i5) > (38 <= v0)) != ((26 >= v3) > (26 ? i5 : 8)));
+                    v1 = (((i4 < 35) ? (v3 < 97) : (a0[14] % 5)) / 2);
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v0 = (((a0[2] >= a1[0][4]) && (a0[5] || v1)) < ((v0 * 4) < (a1[3][4] >= v1)));
+            a1[2][4] = (((a0[12] ? v2 : a1[0][11]) / 2) < ((40 != i4) * (v2 ? v2 : v2)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v1 = (((v3 ? a0[10] : a1[0][1]) + (v2 ? i6 : v0)) >= ((i6 + 48) * (a1[1][9] + a0[13])));
+        v0 = (((v0 - 96) && (v0 > a0[14])) ? ((1 / 9) && (v2 > v0)) : ((i6 * 26) ? (a0[10] < v1) : (v0 + 83)));
+        for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+            if ((v0 - 70) > 73) break;
+            v1 = (((a1[1][9] >= v0) ? (v1 * 29) : (v3 + v1)) && ((48 >= a0[10]) + (v2 ? v3 : i7)));
+            v2 = (((a1[1][7] % 5) % 5) ? ((54 + v2) ? (v3 == 45) : (i7 || 40)) : ((i7 >= 34) < (v1 ? a0[12] : a0[9])));
+            v0 = (((a0[6] > i6) % 2) > ((a1[0][0] != 25) > (32 >= i6)));
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            if ((v1 / 1) > 55) break;
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    a1[3][10] = (((65 - v0) != (46 * i9)) / 1);
+                    v1 = (((54 ? a1[3][7] : v3) && (v3 > a0[9])) / 2);
+                    v1 = (((a0[13] <= i8) && (a0[8] && v2)) <= ((v2 || 14) % 2));
+                    i9 = i9 + 1;
+                }
+            }
+            a0[14] = (((v1 % 9) > (v1 / 4)) <= ((v1 ? 91 : v3) <= (a0[1] - v1)));
+            v0 = (((26 ? a0[13] : v0) || (i8 * 12)) != ((a1[0][6] <= v1) ? (20 || a1[1][0]) : (88 >= 56)));
+            i8 = i8 + 1;
+        }
+    }
+    return (((v0 >= v3) >= (85 + a1[0][5])) - ((v2 && v1) || (v2 != a0[2])));
+}
+int f5() {
+    int v0 = 73;
+    int v1 = 93;
+    int v2 = 73;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((v1 + i0) > 70) break;
+        a0[4] = (((23 && a1[3][3]) / 2) != ((29 >= a0[11]) > (i0 != v1)));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v2 = (((v1 * v1) > (i0 && v1)) ? ((v2 <= v3) || (i1 ? a1[2][8] : a0[13])) : ((i0 ? 51 : 61) + (v2 >= 67)));
+            a1[2][4] = (((68 != v0) ? (19 + v0) : (20 != a0[3])) ? ((a0[1] != 11) || (v3 / 5)) : ((v0 * a0[0]) / 1));
+            v1 = (((20 && 51) ? (a0[9] % 4) : (i1 ? v1 : v2)) > ((a0[12] <= 32) != (49 <= 15)));
+        }
+        v1 = (((92 % 4) ? (a1[3][13] > a1[0][6]) : (i0 - v0)) > ((91 > a1[3][7]) / 9));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v3 = (((2 / 3) <= (a0[15] <= i2)) ? ((v0 ? v0 : i2) && (40 ? a1[0][13] : 74)) : ((v3 != a1[3][12]) % 5));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((43 >= a0[9]) % 8) % 5);
+                    a1[3][11] = (((v3 % 6) || (a0[3] == v1)) || ((v3 == i2) && (v3 && v1)));
+                    a1[1][1] = (((a0[4] != v3) && (a1[2][13] || v1)) && ((a0[0] - a1[0][3]) && (v2 > i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v1 = (((a0[15] - 82) <= (v2 == v1)) ? ((46 ? v3 : 48) || (v0 ? v3 : v3)) : ((v3 + v2) == (a0[5] ? v3 : a1[0][1])));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v2 = (((8 != v1) >= (v0 == v0)) != ((v0 - a1[1][0]) || (i4 ? 28 : 88)));
+        {
+            int i5 = 0;
+            do {
+                if ((i4 != v2) > 85) break;
+                v2 = (((29 && 72) < (v1 == i4)) != ((a0[15] <= 31) * (v2 / 5)));
+                a1[0][3] = (((v1 == 92) + (62 == i5)) ? ((43 && i5) ? (v1 > v3) : (a0[6] - a0[7])) : ((v2 && v3) == (v1 < a1[1][4])));
+                a1[1][0] = (((v0 + a1[3][11]) != (i5 >= a1[1][0])) || ((a1[0][6] >= a1[2][9]) / 8));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        v0 = (((v0 <= 11) * (v2 && 63)) * ((v1 != 87) > (a0[5] + v3)));
+    }
+    v1 = (((v0 && 94) > (v1 % 9)) != ((v2 < a0[13]) <= (a1[1][3] >= 60)));
+    {
+        int i6 = 0;
+        do {
+            if ((a1[2][0] == v2) > 83) break;
+            v3 = (((v2 && v3) <= (v2 || a1[2][14])) < ((a0[5] >= v3) && (v3 < 78)));
+            {
+                int i7 = 0;
+                do {
+                    a1[2][2] = (((i7 == a0[13]) - (a0[7] * i6)) && ((v2 || 1) > (a0[3] || v1)));
+                    v1 = (((v2 > a1[1][6]) >= (v1 ? v2 : 59)) && ((i7 / 4) * (35 + a1[2][6])));
+                    v0 = (((a1[2][4] && v2) && (25 - 92)) - ((v2 + v1) + (v0 != 6)));
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            a1[0][4] = (((v2 % 4) == (v0 && 86)) ? ((i6 - v2) ? (a1[0][7] == v1) : (i6 + 0)) : ((v3 == 47) > (v3 > a0[8])));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    v0 = (((a0[4] < v0) <= (v1 && 19)) < ((a0[0] * v1) * (65 || v1)));
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        v3 = (((v3 + 26) ? (a1[2][1] < v1) : (i8 && 68)) > ((a1[0][10] ? v3 : a1[0][3]) != (27 && 20)));
+        {
+            int i9 = 0;
+            do {
+                v2 = (((i8 <= i8) || (i8 <= 32)) != ((16 % 1) && (a0[2] < i8)));
+                a1[3][4] = (((99 ? a0[11] : 26) % 5) % 2);
+                v0 = (((3 - a1[3][1]) && (15 != v3)) != ((a1[1][2] != a1[0][11]) ? (72 != 72) : (37 <= a1[2][3])));
+                i9 = i9 + 1;
+            } while (i9 < 6);
+        }
+        a1[3][7] = (((v1 + v1) > (a1[3][11] / 1)) % 8);
+    }
+    for (int i10 = 0; i10 < 6; i10 = i10 + 1) {
+        if ((v1 % 6) > 58) break;
+        v1 = (((v3 <= 4) > (a1[2][15] - v0)) >= ((a1[0][2] == 94) / 7));
+        v0 = (((v3 > v2) == (v0 <= i10)) >= ((i10 == v1) != (i10 ? a1[3][9] : i10)));
+        {
+            int i11 = 0;
+            while (i11 < 2) {
+                if ((v1 && i11) > 73) break;
+                a1[3][9] = (((94 + 77) > (v1 || v2)) * ((v1 % 7) > (i10 || 30)));
+                v0 = (((i10 % 6) - (a1[2][6] ? 25 : a0[11])) ? ((96 != v3) && (68 / 4)) : ((i11 < v2) && (92 != a0[14])));
+                a0[2] = (((a0[1] ? v3 : i10) + (19 / 6)) - ((v0 ? a0[14] : 71) / 6));
+                i11 = i11 + 1;
+            }
+        }
+    }
+    for (int i12 = 0; i12 < 6; i12 = i12 + 1) {
+        {
+            int i13 = 0;
+            while (i13 < 4) {
+                v0 = (((v1 ? i12 : a0[13]) / 3) || ((v3 > v3) == (v3 + i13)));
+                v1 = (((77 > v0) >= (v1 / 5)) != ((a1[1][4] || v2) >= (i12 && 77)));
+                v0 = (((a0[14] || v3) * (v0 / 2)) % 9);
+                i13 = i13 + 1;
+            }
+        }
+        v2 = (((51 / 4) - (41 ? 15 : 19)) && ((v1 && v1) * (v3 ? v3 : a0[2])));
+        v0 = (((v1 / 2) / 7) ? ((i12 * 51) <= (v0 / 1)) : ((a1[3][4] < v2) % 1));
+    }
+    if ((((a0[6] / 7) + (v0 + v2)) % 9)) {
+        a0[0] = (((v3 >= v3) < (a0[0] < v2)) && ((v2 || v0) <= (a1[0][4] + 42)));
+        v0 = (((v2 % 7) - (39 < v2)) * ((a0[13] || 22) <= (23 > v3)));
+        v0 = (((v0 * v1) % 1) < ((v3 < a0[7]) < (48 > 83)));
+    } else {
+        a1[1][4] = (((52 > v3) / 6) == ((14 == v3) != (v2 && a1[0][14])));
+        v0 = (((71 >= 77) != (a1[1][12] + v3)) == ((a1[2][8] < a0[13]) * (v3 || v3)));
+        v1 = (((a1[1][4] <= 34) >= (v1 % 2)) == ((a0[11] >= v0) % 3));
+    }
+    return (((v3 + v0) || (a1[2][3] / 3)) >= ((v2 == v0) / 5));
+}
+int f6() {
+    int v0 = 40;
+    int v1 = 25;
+    int v2 = 94;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((v0 || v2) > 91) break;
+        v0 = (((85 * a0[0]) ? (75 < v1) : (a0[7] > a1[1][10])) * ((a0[14] != v2) || (64 - a1[3][10])));
+        v0 = (((8 + i0) ? (v2 ? v0 : a1[3][9]) : (v1 || v3)) + ((v3 * i0) >= (i0 + 26)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a0[11] = (((a0[3] > 13) + (v1 == 1)) ? ((v0 > i0) && (69 < a0[8])) : ((i0 ? 20 : v3) <= (i0 / 5)));
+                a0[8] = (((i1 <= 78) + (a1[3][3] != 37)) / 5);
+                v0 = (((66 % 2) % 6) != ((v0 >= 37) / 2));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    v2 = (((69 > 34) * (94 || v2)) < ((a1[3][6] <= 8) ? (a0[9] + 12) : (v3 <= 0)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((16 ? 99 : v2) > 54) break;
+        v0 = (((a0[1] + v0) <= (38 != i2)) + ((v1 == v2) || (v1 != 70)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            if ((a1[2][3] && a0[1]) > 77) break;
+            a1[1][14] = (((64 - a0[10]) ? (a0[1] * 29) : (14 * v3)) && ((v3 + a1[3][1]) - (i3 ? a0[13] : a1[3][11])));
+            v1 = (((v2 <= a1[2][5]) % 4) ? ((v0 + v3) || (v3 * v0)) : ((a1[1][4] ? a1[0][9] : v1) || (3 != a1[0][0])));
+            v3 = (((79 ? 78 : i3) <= (55 && a0[13])) > ((i2 != a1[2][2]) * (a1[2][11] && i3)));
+        }
+        a1[1][11] = (((35 < 75) / 4) > ((v1 % 4) + (v1 != a1[3][8])));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((v1 ? 8 : v2) > 70) break;
+        {
+            int i5 = 0;
+            while (i5 < 6) {
+                if ((11 ? 27 : v1) > 65) break;
+                v1 = (((a0[3] % 6) && (i5 * 43)) ? ((v3 ? v1 : i5) == (v0 > v3)) : ((v1 > 81) / 7));
+                v1 = (((i4 || a0[2]) > (a0[8] / 8)) > ((v1 - v1) != (v1 == i4)));
+                v0 = (((v0 < a1[1][6]) + (a1[2][4] >= v0)) > ((i4 > v1) / 7));
+                i5 = i5 + 1;
+            }
+        }
+        v0 = (((v0 / 1) || (v1 != v2)) != ((a0[6] ? v1 : a1[3][3]) ? (i4 / 7) : (v3 % 2)));
+        v0 = (((v1 % 2) > (v0 / 7)) >= ((v2 >= a0[15]) * (v1 || i4)));
+    }
+    v3 = (((v3 ? a0[13] : v0) > (v1 == a0[0])) % 6);
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            v2 = (((a1[1][2] == v0) + (1 * v1)) + ((93 > v2) || (a1[3][14] ? i6 : 24)));
+            v0 = (((i6 && v0) > (v2 > a1[3][14])) * ((a1[1][4] - a1[1][5]) / 8));
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((a1[0][10] > a0[3]) > 77) break;
+                v1 = (((v0 <= a1[2][13]) == (v0 != a1[2][5])) <= ((a1[3][6] && i7) == (v3 <= 99)));
+                a0[8] = (((v2 > 54) * (a0[12] < 0)) || ((v0 / 2) != (a0[4] / 6)));
+                a1[0][8] = (((96 != v2) >= (v2 == a1[2][4])) ? ((v3 / 2) || (v0 < a0[2])) : ((v0 && v2) > (v1 / 6)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    a0[4] = (((91 != i9) < (a0[13] <= i8)) == ((i9 != v0) > (25 > a1[0][4])));
+                    v0 = (((v2 * i9) ? (v3 < v2) : (a0[14] % 2)) + ((53 * v2) != (a0[8] * v0)));
+                    v0 = (((31 ? i9 : a1[3][9]) && (v3 <= v0)) > ((i8 + a1[2][2]) * (62 && a0[10])));
+                    i9 = i9 + 1;
+                }
+            }
+            a0[10] = (((20 - 20) == (a1[2][6] != a1[2][5])) < ((90 ? a0[6] : 76) * (5 ? v0 : 21)));
+            a1[3][13] = (((52 <= a0[13]) ? (v2 - 84) : (v0 + v0)) % 3);
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    v0 = (((a0[15] * v2) || (v3 ? a1[3][0] : 66)) >= ((1 == v0) == (v1 - v3)));
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        if ((78 <= v2) > 79) break;
+        for (int i11 = 0; i11 < 8; i11 = i11 + 1) {
+            if ((i11 % 2) > 96) break;
+            v2 = (((47 >= a1[2][5]) / 3) + ((i10 / 9) % 1));
+            a0[4] = (((v1 - 49) <= (v0 > 14)) != ((v3 % 9) != (v2 >= 48)));
+            v2 = (((i10 / 9) == (a1[2][14] % 6)) < ((v1 >= v1) <= (v1 || i10)));
+        }
+        v0 = (((a0[4] || 10) / 1) || ((v0 && a0[11]) >= (17 <= v3)));
+        a1[3][15] = (((99 >= v0) % 8) == ((55 ? v1 : a1[3][13]) * (a1[0][6] || v0)));
+    }
+    {
+        int i12 = 0;
+        do {
+            v1 = (((47 ? a1[3][5] : v0) * (v2 || 23)) == ((a1[2][11] / 5) > (v3 ? a1[2][1] : 98)));
+            {
+                int i13 = 0;
+                do {
+                    if ((a0[10] + v2) > 52) break;
+                    v3 = (((v0 ? 21 : 10) || (a1[1][10] <= 21)) > ((v1 || v2) < (v2 + 43)));
+                    a0[13] = (((i13 == i12) < (79 && a0[10])) > ((a1[3][15] ? 30 : v1) < (a1[0][7] - a0[14])));
+                    a1[0][9] = (((v1 ? v1 : 92) / 4) * ((a1[0][13] + a1[3][14]) <= (v2 && v2)));
+                    i13 = i13 + 1;
+                } while (i13 < 4);
+            }
+            a1[1][4] = (((i12 * v0) / 6) && ((v0 && 20) <= (a1[0][9] || i12)));
+            i12 = i12 + 1;
+        } while (i12 < 6);
+    }
+    return (((18 != v1) && (v1 ? v3 : v0)) ? ((a1[3][13] * v2) % 5) : ((v3 + 29) && (v0 - v2)));
+}
+int f7() {
+    int v0 = 73;
+    int v1 = 22;
+    int v2 = 39;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 % 4) - (a0[13] && v3)) == ((36 > 18) + (v3 ? v2 : v2)))) {
+        v3 = (((v3 || v0) * (64 < v3)) && ((65 - 15) >= (v3 || v0)));
+        v0 = (((v1 >= a0[10]) && (88 < a1[1][2])) == ((v2 / 9) * (v1 ? v0 : a1[0][9])));
+        a1[0][9] = (((v2 * a1[1][6]) / 9) - ((v1 >= v0) > (v3 || v1)));
+    } else {
+        a1[3][5] = (((v1 % 9) || (v0 + v3)) <= ((v0 / 6) > (a0[6] * 28)));
+        a0[13] = (((a0[3] % 8) != (v1 && 42)) * ((a0[14] || v2) < (v0 / 4)));
+        a0[3] = (((a0[13] < 81) > (v1 + a0[11])) <= ((a0[2] + a0[10]) > (v3 || v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[1][0] = (((18 == a1[0][6]) >= (22 < a1[2][4])) > ((v2 - v1) != (87 <= 98)));
+            v2 = (((a1[1][1] + 41) == (v2 || v1)) != ((36 ? 43 : v2) - (98 ? 87 : i0)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a1[3][3] = (((50 >= i0) || (i0 ? i0 : 43)) && ((a0[5] > v2) + (i1 + v3)));
+                    a0[8] = (((a1[2][6] * i1) / 7) * ((7 ? a1[0][6] : v2) > (v1 - a0[5])));
+                    v3 = (((i1 || v1) && (6 && a0[9])) > ((a1[0][14] <= 91) || (81 != 31)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v0 = (((v3 > a0[1]) < (v3 <= v2)) % 1);
+    a1[3][9] = (((88 % 1) ? (22 - v1) : (59 < v2)) ? ((v0 == v3) >= (69 - v1)) : ((v1 / 5) < (a1[2][3] ? v1 : v1)));
+    a0[3] = (((55 && a1[0][15]) || (v0 * a0[0])) < ((v0 || a0[1]) * (v2 - a1[0][3])));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a1[2][12] = (((v1 && v2) || (i2 * v1)) + ((a1[2][7] < a0[10]) % 5));
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            v1 = (((v0 ? a0[5] : 67) ? (92 ? 85 : a1[2][1]) : (27 != v1)) != ((15 % 2) > (v3 != 54)));
+            v0 = (((v2 || v1) + (i3 && 1)) || ((61 * i2) ? (80 ? v3 : 56) : (46 <= a1[2][15])));
+            v2 = (((v2 / 7) > (a0[14] > a1[1][2])) < ((v0 > 18) <= (v0 < v2)));
+        }
+        a1[1][8] = (((a0[7] / 5) - (a0[4] < v2)) - ((83 || 58) != (v3 / 3)));
+    }
+    if ((((v0 / 7) / 9) > ((v1 + v2) < (68 * 66)))) {
+        v1 = (((a1[1][10] / 2) >= (v2 + v2)) + ((a1[1][13] ? a1[2][14] : a0[3]) > (v3 || v3)));
+        v2 = (((v1 < 81) <= (67 ? v0 : a1[2][9])) + ((2 == a1[0][13]) - (v3 - v1)));
+        v3 = (((v1 / 5) > (v0 < v1)) - ((a1[1][3] - v2) != (95 * a0[0])));
+    } else {
+        a0[2] = (((a1[0][10] % 4) ? (67 % 2) : (v0 <= a0[6])) <= ((v1 - a0[2]) >= (v2 % 4)));
+        a1[1][7] = (((v1 || 35) ? (a1[0][9] / 2) : (a0[2] < 16)) == ((93 && 76) + (30 + 1)));
+        a0[11] = (((65 <= a0[8]) >= (a1[0][5] / 7)) <= ((v0 % 2) / 1));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v1 = (((a0[10] <= v0) <= (99 - a1[3][11])) != ((a0[2] >= v1) ? (v1 * a0[9]) : (v2 * a1[1][15])));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v2 = (((a0[4] % 7) ? (v3 <= 65) : (15 + i5)) ? ((55 || v3) % 3) : ((5 * v0) % 1));
+                    v1 = (((v0 ? v1 : 54) - (v3 < v1)) * ((70 / 3) < (98 < 53)));
+                    v2 = (((v2 >= v1) <= (v3 > v0)) && ((a1[1][12] != i4) && (v3 != v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((i4 || 78) + (9 != a0[15])) / 2);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v1 ? 1 : 54) <= (v2 != a1[2][15])) && ((v0 ? 53 : v3) * (a1[2][13] <= 88)))) {
+        v2 = (((v1 || a0[11]) < (v1 <= 26)) != ((v3 - v0) != (a0[11] * v2)));
+        a1[0][6] = (((a0[4] ? v2 : a1[1][7]) > (a0[9] <= v0)) != ((v1 + 87) ? (a0[12] != v2) : (v0 ? a1[1][8] : 18)));
+        a0[0] = (((a1[0][7] ? a1[3][5] : a0[9]) > (v3 && a0[13])) - ((v0 + 46) - (73 == v3)));
+    } else {
+        a0[5] = (((v2 >= 1) != (v1 != a0[5])) == ((v2 + 65) % 4));
+        a0[7] = (((71 * v1) >= (21 || v2)) * ((v3 == v1) >= (v2 && a1[3][7])));
+        v3 = (((21 || a1[0][6]) / 3) * ((a0[15] < v3) <= (v0 == 58)));
+    }
+    if ((((v3 < 53) % 6) <= ((v2 / 6) == (a0[0] % 7)))) {
+        v2 = (((v1 - 56) ? (v3 && v2) : (v1 || v0)) || ((v0 >= v2) - (v2 != v2)));
+        a1[2][14] = (((a0[6] <= v3) ? (v2 < 28) : (a0[7] && v0)) < ((v1 ? a1[0][14] : v3) ? (12 > 15) : (v0 * v1)));
+        v2 = (((v0 != 64) + (v3 % 5)) * ((a0[2] <= v2) ? (a0[8] * v0) : (v3 <= v1)));
+    } else {
+        v2 = (((a1[1][8] - v2) - (v0 < 94)) ? ((a0[1] > v2) + (v2 <= a0[6])) : ((v0 != a1[0][15]) < (a0[3] && a1[1][4])));
+        a1[1][2] = (((a1[1][4] == v1) * (a0[8] % 2)) + ((a0[6] && 21) % 9));
+        v3 = (((v0 != v3) <= (45 - 15)) >= ((61 % 9) || (53 || 60)));
+    }
+    return (((a0[2] + a0[7]) >= (v1 / 1)) + ((v1 > 75) ? (v2 < v2) : (a1[0][0] == 85)));
+}
+int f8() {
+    int v0 = 0;
+    int v1 = 66;
+    int v2 = 67;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    a0[10] = (((v0 % 9) == (a1[3][4] || v2)) >= ((v2 != 22) * (v3 != v1)));
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((a1[1][2] * i0) > 84) break;
+        {
+            int i1 = 0;
+            do {
+                a0[9] = (((v2 >= i1) <= (a1[2][12] && v3)) || ((v2 - v1) != (i1 * 13)));
+                v1 = (((1 + 16) == (a1[3][8] / 4)) + ((v3 > a1[3][4]) <= (60 && a0[13])));
+                a0[5] = (((v1 < a0[0]) ? (i0 / 7) : (97 >= v1)) / 3);
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v1 = (((v1 && 64) || (v2 && a1[3][6])) && ((a0[15] ? v0 : 85) != (i0 && v3)));
+        v2 = (((v1 == a0[14]) > (33 < v1)) ? ((v0 ? v1 : i0) == (v3 || a0[9])) : ((a1[1][6] != a0[2]) >= (a0[1] == v2)));
+    }
+    if ((((a0[0] / 2) ? (59 - a1[3][10]) : (68 < v2)) ? ((a1[0][0] == 79) ? (v3 + a0[15]) : (v1 || v1)) : ((v3 == a1[2][5]) != (76 == v2)))) {
+        v0 = (((v0 ? 24 : v1) <= (v2 && v1)) != ((v1 / 6) >= (3 && v2)));
+        v0 = (((16 + v0) == (a1[2][12] - v2)) / 3);
+        v0 = (((v2 * v2) % 2) < ((v0 ? a0[7] : 15) > (v1 / 9)));
+    } else {
+        a0[10] = (((v0 / 1) > (a1[1][4] == v2)) + ((a1[3][14] != a1[1][13]) > (v2 ? a0[6] : v1)));
+        v1 = (((v3 && a0[4]) != (v3 == 54)) || ((96 > v2) ? (v3 > v2) : (32 >= a0[15])));
+        v3 = (((a0[6] / 6) == (49 && 99)) % 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v3 = (((36 && 30) > (41 != v2)) ? ((v0 || v2) != (99 <= a0[6])) : ((v3 * 18) >= (25 + 30)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v1 = (((v3 && a0[12]) + (i2 * v1)) ? ((i3 <= a1[2][1]) - (v2 || v2)) : ((74 > i2) && (a1[3][4] - a0[14])));
+                    v3 = (((a1[3][5] * 73) + (6 >= a1[0][4])) ? ((v0 >= i2) + (i3 + 57)) : ((i2 % 8) > (66 <= v0)));
+                    v3 = (((v2 % 7) >= (a0[1] <= 78)) || ((i3 <= v0) > (i3 && a1[1][10])));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[3][14] = (((28 ? v0 : v1) && (a1[1][13] / 4)) * ((a0[9] / 1) / 4));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((76 ? a0[4] : v2) < (62 > v3)) % 8);
+            a1[2][14] = (((35 >= v0) - (43 >= 93)) && ((5 < v0) - (v0 ? a0[12] : v3)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v2 < v3) < (a0[10] < v1)) || ((16 - a0[12]) ? (a0[5] - a0[4]) : (v0 || v1)));
+                    v0 = (((v2 % 3) >= (v1 * 18)) > ((v2 != v3) + (v0 % 8)));
+                    a0[8] = (((a1[1][2] < i4) || (39 + a0[7])) >= ((v0 + v2) ? (v3 - a0[11]) : (i5 && i4)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    if ((((v2 >= 24) % 3) % 1)) {
+        a0[2] = (((v1 && 97) ? (13 >= v2) : (v3 > v1)) ? ((55 - 58) / 7) : ((v1 > v1) <= (91 ? v1 : 99)));
+        a0[2] = (((a1[0][0] % 9) > (a1[3][12] * v0)) * ((63 < a1[0][8]) * (70 + v2)));
+        v1 = (((9 % 7) % 6) * ((v0 || a1[3][9]) <= (v1 >= 39)));
+    } else {
+        v3 = (((a0[5] && v2) % 8) + ((a1[1][9] - 69) / 7));
+        v3 = (((v0 % 3) ? (48 != a1[2][3]) : (a0[10] ? v2 : v1)) <= ((v0 || 87) % 1));
+        v0 = (((v1 - a0[7]) == (a1[0][12] >= 99)) - ((v2 / 9) < (a0[1] <= v2)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[3][12] = (((a0[14] >= v2) <= (v2 % 6)) > ((29 + 75) != (v2 != 94)));
+            v0 = (((a0[1] - 42) ? (v0 || v0) : (v2 / 5)) % 9);
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v3 = (((i6 ? 89 : a0[8]) != (a1[1][13] >= 72)) ? ((10 <= i7) || (a1[1][4] - a1[1][5])) : ((v2 ? a1[1][2] : i6) ? (i7 % 9) : (v2 - a1[0][0])));
+                    v0 = (((a0[3] != i6) * (3 + v0)) > ((4 >= 69) / 6));
+                    v2 = (((a0[8] == a1[1][0]) || (i6 * 27)) - ((v3 || i6) >= (a1[0][12] >= i6)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((48 >= 22) > 71) break;
+            {
+                int i9 = 0;
+                do {
+                    a1[1][4] = (((v2 / 6) || (77 % 3)) == ((v0 > i8) != (a0[7] > v0)));
+                    v0 = (((i8 + i9) || (61 / 7)) && ((17 != v3) ? (v2 % 2) : (a1[0][1] ? a0[12] : 76)));
+                    a0[7] = (((v1 || a1[1][6]) * (v3 >= a1[2][12])) * ((v2 < v3) || (a0[7] / 7)));
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            a0[12] = (((a1[1][14] + 72) / 5) * ((v3 > 15) / 5));
+            a1[0][9] = (((7 == v0) ? (a0[7] * i8) : (i8 < a1[2][11])) || ((v2 % 6) || (i8 % 3)));
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    v0 = (((v3 * v2) < (v0 > 18)) - ((a1[1][3] % 9) + (a0[5] - v3)));
+    {
+        int i10 = 0;
+        do {
+            if ((a1[2][0] && a0[4]) > 87) break;
+            a0[9] = (((a0[5] || a1[3][5]) - (v1 ? v2 : 89)) % 9);
+            for (int i11 = 0; i11 < 6; i11 = i11 + 1) {
+                v3 = (((i10 ? 18 : i11) + (23 < v0)) || ((v3 < v2) + (52 >= v1)));
+                a0[6] = (((51 != 89) != (a0[5] ? i11 : i10)) > ((v1 / 3) / 8));
+                v0 = (((v2 >= i10) + (84 && v0)) + ((i11 <= a0[14]) && (22 + v2)));
+            }
+            v3 = (((v0 / 1) ? (v2 < a1[1][3]) : (v0 != a0[6])) || ((a1[3][7] / 1) && (v3 >= 86)));
+            i10 = i10 + 1;
+        } while (i10 < 4);
+    }
+    return (((a1[2][5] >= v1) - (v0 <= v0)) || ((a0[8] > v3) * (v3 <= v2)));
+}
+int f9() {
+    int v0 = 76;
+    int v1 = 93;
+    int v2 = 28;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((a1[3][3] || v3) > 69) break;
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            if ((30 || v0) > 62) break;
+            v3 = (((i0 * 5) < (25 / 3)) ? ((v2 ? v2 : a0[14]) ? (a0[4] <= v2) : (1 != 46)) : ((i0 && a1[1][8]) >= (i0 / 1)));
+            a0[12] = (((a0[14] <= a1[2][9]) * (56 < v2)) + ((v1 / 1) / 1));
+            v3 = (((47 > 9) > (58 || a0[3])) < ((v1 ? 15 : v0) == (79 >= 44)));
+        }
+        a1[2][6] = (((i0 && 34) % 7) <= ((v2 - 9) ? (a1[3][6] != 76) : (a1[3][14] != v2)));
+        v2 = (((v0 || 46) ? (v3 != 82) : (v1 || 36)) && ((v3 + 76) || (7 && 73)));
+    }
+    if ((((v1 != 52) < (29 ? a0[1] : v0)) < ((v3 + v2) <= (v0 * 32)))) {
+        a0[10] = (((a1[2][11] - 33) < (a0[4] && v1)) >= ((v1 ? a0[15] : 77) <= (v2 >= v3)));
+        v0 = (((v1 > v3) ? (v0 >= a0[15]) : (a0[7] * v2)) * ((v0 <= v2) != (v1 / 5)));
+        v3 = (((96 >= v3) % 3) && ((32 != a0[15]) ? (v0 || 68) : (a1[3][0] && v3)));
+    } else {
+        v1 = (((77 ? 60 : 98) < (v2 - a0[0])) + ((21 == v2) >= (a1[3][12] <= v3)));
+        a0[14] = (((3 || a1[2][14]) + (v2 + v2)) <= ((33 ? a1[0][10] : v3) && (a0[3] && 99)));
+        v1 = (((v3 && v3) && (v3 && a0[10])) ? ((v2 && a1[3][5]) == (27 % 9)) : ((34 ? v1 : v3) + (v2 - 72)));
+    }
+    if ((((v3 / 6) + (a1[0][0] - 40)) > ((77 + 28) != (v3 || 36)))) {
+        a1[3][9] = (((v2 * v3) <= (a0[4] - a0[13])) ? ((a0[9] == a0[6]) / 2) : ((v1 - a0[15]) <= (a1[3][6] > v3)));
+        a1[0][14] = (((v2 * a0[13]) + (v0 != v1)) % 8);
+        a1[3][7] = (((75 - 24) >= (v2 / 6)) ? ((v1 % 4) * (a0[12] + a1[1][11])) : ((92 >= v3) ? (v0 != v1) : (32 ? a1[1][4] : v0)));
+    } else {
+        v1 = (((a0[12] < v1) ? (v2 > a1[1][10]) : (v3 || v0)) ? ((65 && v2) >= (v1 - v0)) : ((v2 ? v2 : v2) + (v3 <= a1[3][11])));
+        v1 = (((v1 / 5) > (v3 > a0[8])) == ((92 > a1[2][7]) <= (a1[1][8] > v3)));
+        a1[2][15] = (((a0[8] + 13) % 4) % 9);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v3 = (((a0[14] && v0) != (i2 / 2)) ? ((86 ? i2 : a0[2]) && (27 == 40)) : ((v0 && 56) + (a1[0][4] * i2)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            if ((v3 <= v1) > 96) break;
+            v3 = (((a1[3][15] ? v2 : 0) / 9) % 3);
+            a0[7] = (((a0[1] == 66) - (62 >= a0[9])) > ((a0[3] ? 16 : v1) * (i2 > v1)));
+            v1 = (((i3 - i3) >= (24 > v0)) - ((v1 + a1[3][2]) == (a0[1] >= i2)));
+        }
+        v3 = (((4 != 70) % 2) < ((a1[2][13] && v3) < (a0[3] < a1[0][13])));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((v3 ? i4 : v3) > 73) break;
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            if ((64 ? v2 : 20) > 66) break;
+            v3 = (((v0 % 5) > (i5 - v2)) ? ((9 % 3) * (a0[13] < v2)) : ((i5 % 2) == (a1[0][9] + v0)));
+            a1[3][8] = (((i4 && a0[2]) < (v3 != v3)) <= ((a1[2][5] >= 34) ? (i4 && 20) : (6 >= a1[1][10])));
+            v0 = (((4 == v3) % 9) + ((i5 < a0[4]) && (a1[1][2] >= v3)));
+        }
+        v0 = (((37 * 6) ? (a1[0][12] > 51) : (a0[11] == v2)) == ((v3 ? i4 : 10) >= (v3 < v0)));
+        v0 = (((70 * a0[4]) >= (v1 == 75)) <= ((11 ? 36 : 31) >= (v2 || v1)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v2 = (((v3 * a1[2][14]) ? (a0[6] < 52) : (a1[2][4] ? i6 : 55)) > ((a1[1][4] - 98) && (i6 && v1)));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v0 = (((a0[8] >= 27) || (a0[15] <= v3)) ? ((v1 == a0[0]) ? (v2 + v1) : (v0 == i6)) : ((a1[0][11] + v3) + (i7 && i6)));
+                a1[3][14] = (((v2 >= 83) ? (v2 ? a0[14] : a0[7]) : (i6 ? a0[1] : 54)) != ((i6 + v2) % 7));
+                a1[1][12] = (((v0 < v2) <= (a0[12] ? v3 : i7)) <= ((i6 <= v2) == (v2 == a0[3])));
+            }
+            a0[15] = (((i6 < i6) > (v0 || 57)) != ((v3 * 65) ? (v1 == a1[0][13]) : (a0[3] ? v2 : v2)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((40 % 8) > 50) break;
+            v3 = (((v0 ? a0[8] : i8) >= (v2 + v3)) == ((v3 == 64) <= (15 + v2)));
+            v1 = (((v3 ? v2 : a1[0][7]) * (42 % 6)) >= ((i8 == i8) || (a1[0][4] >= a0[0])));
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                a0[6] = (((v1 < v1) % 5) * ((v0 < a1[0][9]) > (v3 / 1)));
+                a1[2][9] = (((v3 || a1[0][1]) > (v3 == v3)) > ((v2 ? v3 : i8) == (i9 % 5)));
+                v0 = (((v1 + a1[1][12]) < (19 || a0[14])) + ((v2 || i9) == (i9 % 1)));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 2) {
+            v3 = (((i10 && 73) > (i10 % 8)) - ((a1[0][7] < 81) - (v3 * v2)));
+            {
+                int i11 = 0;
+                while (i11 < 7) {
+                    v2 = (((a0[7] * 79) == (a0[5] ? v2 : 25)) > ((v1 <= 3) * (41 % 5)));
+                    v3 = (((i11 + v3) % 4) + ((a1[0][11] && i10) - (10 && 62)));
+                    v1 = (((a1[0][5] - v2) ? (i11 ? i11 : 5) : (v3 / 2)) > ((i11 <= v1) % 1));
+                    i11 = i11 + 1;
+                }
+            }
+            v2 = (((56 < v0) != (86 > v1)) >= ((99 > 45) * (55 == 5)));
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 2; i12 = i12 + 1) {
+        a0[11] = (((95 <= 33) <= (a0[4] + v3)) == ((v1 - 41) || (v0 - i12)));
+        a0[9] = (((v3 && a0[15]) - (v3 ? v3 : 79)) <= ((v3 * 1) ? (i12 == a1[2][14]) : (v3 ? a0[10] : 19)));
+        for (int i13 = 0; i13 < 2; i13 = i13 + 1) {
+            v0 = (((a0[14] + v1) != (30 != i13)) >= ((a1[2][6] / 3) <= (v1 * v0)));
+            v0 = (((v1 ? 36 : a1[3][10]) % 7) ? ((v2 / 5) - (v1 || v3)) : ((i13 || i12) > (v2 - v0)));
+            v0 = (((i13 >= v1) >= (a0[9] == 21)) == ((36 == a1[1][3]) % 1));
+        }
+    }
+    v2 = (((26 > v0) ? (41 <= v1) : (14 * a1[2][14])) || ((v1 && v1) ? (v0 - a0[6]) : (88 - v3)));
+    return (((v0 && v2) < (a1[0][13] >= v2)) == ((v1 != 4) >= (v1 % 9)));
+}
+int f10() {
+    int v0 = 64;
+    int v1 = 25;
+    int v2 = 17;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((20 + a1[1][9]) > 72) break;
+        a1[2][10] = (((v0 + a1[2][10]) ? (v1 / 3) : (68 % 6)) == ((v0 && 32) * (v3 ? v3 : 58)));
+        v1 = (((i0 > a1[0][6]) == (v3 || a1[0][11])) % 1);
+        {
+            int i1 = 0;
+            do {
+                if ((98 > v3) > 69) break;
+                a1[2][0] = (((v0 || 31) > (i1 < v3)) > ((v1 / 3) / 2));
+                v2 = (((v1 ? v1 : i1) || (i0 / 7)) || ((a1[2][0] * 8) ? (i0 - 29) : (v0 + 34)));
+                v1 = (((7 ? v0 : a0[12]) + (i0 || a0[5])) || ((i1 == v0) % 6));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((a0[11] < v3) > 79) break;
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                if ((v3 % 9) > 90) break;
+                v3 = (((v2 + a1[3][0]) || (a1[2][13] ? v1 : i3)) / 9);
+                v2 = (((19 / 6) % 7) == ((v1 > 32) >= (a0[9] + 17)));
+                a1[3][3] = (((v3 == 12) > (v1 <= 36)) <= ((a1[1][0] ? i2 : i2) != (v3 / 1)));
+                i3 = i3 + 1;
+            }
+        }
+        a1[0][12] = (((v3 ? v3 : v1) ? (a1[3][9] * i2) : (15 * v1)) == ((6 >= v0) - (v0 % 2)));
+        a1[1][10] = (((v1 && v1) && (v3 < a1[1][10])) >= ((v2 <= a0[11]) == (96 == v0)));
+    }
+    v2 = (((v2 * 20) || (66 <= 68)) - ((v1 < 99) || (78 + a1[3][14])));
+    if ((((99 || v3) >= (a0[7] > v2)) >= ((a1[1][10] == 78) < (v3 ? v0 : 99)))) {
+        a1[0][3] = (((v1 <= v1) * (v0 == v0)) % 1);
+        v2 = (((v3 % 7) ? (v2 ? a1[1][15] : 87) : (a1[3][8] % 2)) || ((v1 != 69) > (85 * 88)));
+        v3 = (((v0 <= 41) > (v3 < v2)) + ((v1 / 2) == (85 < v3)));
+    } else {
+        v0 = (((v1 % 7) / 3) != ((v3 % 7) ? (v3 || 87) : (40 + v3)));
+        v0 = (((a0[0] > a1[3][3]) >= (43 && a1[0][3])) ? ((a1[3][8] >= 16) <= (v2 <= v1)) : ((v1 * 34) % 2));
+        v2 = (((59 <= a0[6]) >= (v1 * v2)) < ((95 != 28) >= (v0 - 94)));
+    }
+    if ((((a0[13] % 8) && (v2 ? v0 : a1[0][8])) + ((v3 ? v0 : a1[1][1]) - (a1[1][1] != 20)))) {
+        v3 = (((v2 / 1) ? (v0 >= v0) : (v0 + v2)) != ((v1 >= v1) || (v2 ? v3 : a0[12])));
+        v1 = (((36 ? v3 : 35) && (v3 % 9)) >= ((a0[15] && v3) <= (a1[3][0] <= v0)));
+        v2 = (((24 ? a0[6] : v3) < (v3 || v0)) % 5);
+    } else {
+        v3 = (((a1[0][11] || 37) / 4) % 5);
+        v3 = (((v1 ? a0[2] : a1[0][10]) && (v2 != v0)) < ((a0[2] + v2) && (v1 >= v0)));
+        a1[3][0] = (((v2 < v3) != (a1[3][11] <= v3)) * ((43 - a1[0][0]) && (v0 == v0)));
+    }
+    v1 = (((v0 >= v1) ? (v3 - 37) : (a1[0][0] - a1[1][7])) > ((a1[3][3] == 63) * (35 ? 88 : a0[14])));
+    if ((((a0[9] - 12) / 5) % 7)) {
+        v0 = (((v3 % 2) || (52 ? v1 : v3)) - ((a0[3] == 45) ? (a0[0] && v1) : (v1 == 80)));
+        a1[0][13] = (((a0[11] != 27) + (27 != a1[0][12])) == ((v0 * a1[1][6]) + (v1 == a1[3][8])));
+        v3 = (((a0[12] >= v3) || (v3 > 43)) / 3);
+    } else {
+        a0[9] = (((v3 / 3) == (v3 == v3)) || ((v1 != v0) || (v2 <= 54)));
+        v1 = (((27 != a0[14]) + (90 * a1[3][11])) / 9);
+        v0 = (((v2 > a0[3]) <= (98 ? v0 : v1)) == ((v3 && 18) || (v1 ? a0[8] : a1[1][14])));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((44 < a0[15]) > 51) break;
+            v1 = (((v2 * v3) != (a0[0] + 8)) > ((v2 <= a1[3][10]) || (v3 ? a1[0][4] : v1)));
+            a1[2][8] = (((a1[0][5] || a0[14]) - (v1 && i4)) > ((v1 == a1[0][9]) == (a1[3][14] < v2)));
+            {
+                int i5 = 0;
+                do {
+                    if ((a1[3][4] > 79) > 76) break;
+                    a1[1][4] = (((i4 == a0[7]) < (a0[1] < v2)) - ((64 >= 56) < (v2 <= 43)));
+                    a1[0][8] = (((v3 || a1[3][11]) ? (27 % 3) : (33 >= v3)) - ((v2 + v3) ? (94 != 54) : (47 / 5)));
+                    a1[2][5] = (((i5 <= v2) - (69 + v3)) == ((i5 ? a0[7] : v2) > (a0[5] ? a1[1][3] : i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    v1 = (((73 <= a0[0]) <= (v0 != a0[3])) == ((v2 <= v2) >= (v3 < 77)));
+    if ((((v3 - v0) + (v0 ? a1[1][12] : v2)) <= ((49 % 5) < (a0[7] % 1)))) {
+        a0[1] = (((81 <= a0[9]) % 1) * ((56 || v1) > (v1 <= a1[1][7])));
+        v1 = (((v1 / 4) == (53 < v1)) % 9);
+        v1 = (((v3 || a0[3]) ? (v0 * a1[0][11]) : (94 + v2)) && ((a0[9] - v0) >= (79 <= v1)));
+    } else {
+        a0[10] = (((a1[3][15] || 51) || (81 >= v1)) >= ((46 ? v2 : a1[1][15]) ? (v1 < a1[2][8]) : (a0[6] < 9)));
+        v3 = (((a1[1][10] + 10) + (v0 < v1)) || ((v2 < 21) != (a0[3] == v3)));
+        v2 = (((v1 || v0) + (a0[11] || a0[6])) ? ((v2 + 99) || (v0 <= 42)) : ((v1 + v3) == (v1 ? a0[14] : a0[2])));
+    }
+    return (((v2 ? v2 : v0) < (v1 ? v0 : 61)) ? ((11 || a0[13]) > (a0[10] % 9)) : ((v1 - v1) * (a1[3][6] % 2)));
+}
+int f11() {
+    int v0 = 63;
+    int v1 = 32;
+    int v2 = 74;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v2 - i0) > (v0 ? a0[11] : v2)) || ((v1 + v3) < (v0 == v3)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((i1 >= 63) ? (v0 < v2) : (v1 < 93)) < ((i1 - v3) / 2));
+                    a1[2][14] = (((v1 < 32) % 7) && ((v0 <= a1[1][12]) ? (i0 >= i1) : (v3 >= v1)));
+                    a1[3][15] = (((v3 * a1[3][13]) > (v3 == 61)) < ((v1 <= v1) / 7));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a0[8] <= v3) ? (v3 >= 2) : (a0[6] ? i0 : 71)) <= ((a1[0][7] <= v1) != (i0 == v3)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a1[1][5] != 1) * (a1[2][0] && i2)) * ((1 / 6) - (v1 <= i2)));
+            v1 = (((v3 / 8) < (v2 * a0[11])) / 3);
+            {
+                int i3 = 0;
+                do {
+                    if ((72 * i3) > 89) break;
+                    v0 = (((65 == a1[2][6]) * (i2 + v1)) / 4);
+                    v1 = (((a1[1][9] && v0) % 9) < ((v0 - v1) ? (14 <= 52) : (v0 ? v2 : v1)));
+                    v0 = (((v0 * v0) % 3) <= ((a1[1][11] % 7) + (36 && a1[0][11])));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v0 % 5) >= (22 || v2)) < ((a0[8] % 4) * (v0 * v1)))) {
+        v2 = (((a0[8] < v0) * (v3 <= v2)) >= ((v0 * 35) / 6));
+        v2 = (((v0 / 7) + (v2 != 28)) < ((v3 - 42) * (a1[2][15] ? 74 : v2)));
+        a1[2][8] = (((a0[2] < 75) * (a1[3][8] / 2)) >= ((v3 ? a0[5] : a1[3][2]) >= (a0[0] + a1[0][13])));
+    } else {
+        a0[8] = (((a1[1][6] ? v1 : a0[1]) == (v2 <= a1[1][1])) >= ((v1 || a1[0][3]) == (a0[12] && a0[4])));
+        v0 = (((44 * 85) * (53 != a1[0][9])) < ((v1 ? v1 : v1) <= (v3 || v1)));
+        v1 = (((4 == a1[1][14]) || (a0[1] >= 52)) < ((v0 || v3) + (v1 < 17)));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            a0[7] = (((62 == v2) != (i4 > 54)) >= ((v3 - v1) - (a1[3][8] * i4)));
+            v0 = (((72 * 76) && (v3 - i4)) > ((1 * a0[6]) == (21 < a1[1][13])));
+            a0[14] = (((v2 / 7) ? (85 * v2) : (a0[2] % 3)) ? ((a0[14] || a1[2][13]) - (36 ? i5 : v1)) : ((32 ? a1[2][8] : i5) >= (a1[0][5] != a0[8])));
+        }
+        a0[5] = (((83 != v2) + (v1 < a0[14])) * ((18 <= v1) && (v3 <= a1[3][2])));
+        v3 = (((a0[14] % 1) < (9 >= 50)) * ((v0 ? a1[0][3] : v0) <= (v1 >= 3)));
+    }
+    if ((((v3 < v0) % 3) ? ((a0[3] != a1[1][4]) > (v0 ? a0[6] : v0)) : ((v2 || 78) > (v3 % 5)))) {
+        v1 = (((v2 == v0) != (61 / 2)) && ((v2 && a0[3]) < (v0 > 84)));
+        v3 = (((a0[4] >= v1) % 7) ? ((a1[3][9] - v1) < (37 || a1[2][5])) : ((39 <= 12) % 9));
+        v0 = (((9 * 30) > (v1 == v3)) != ((45 % 1) && (a0[11] + 78)));
+    } else {
+        v0 = (((v3 * a1[1][12]) || (v0 < v0)) == ((a1[1][7] / 2) < (12 + v0)));
+        v0 = (((v0 < v0) <= (79 % 7)) || ((26 > 62) % 3));
+        v3 = (((v2 < a0[15]) * (v3 - a0[9])) / 9);
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v2 = (((10 > v0) >= (v1 < 61)) > ((27 ? v1 : 92) % 2));
+        {
+            int i7 = 0;
+            while (i7 < 7) {
+                v0 = (((v3 && i6) || (i7 / 4)) % 7);
+                v0 = (((3 * 57) && (v2 > v0)) && ((v3 >= v1) && (i7 / 7)));
+                a1[1][6] = (((i6 != v1) && (12 % 7)) % 5);
+                i7 = i7 + 1;
+            }
+        }
+        v3 = (((v1 ? a0[8] : a0[11]) > (v1 ? a0[3] : a1[1][9])) + ((v2 * a0[0]) >= (12 - a1[2][0])));
+    }
+    if ((((v3 <= v3) || (64 ? a0[3] : a0[14])) + ((v1 > v0) ? (v2 / 9) : (a0[15] - v2)))) {
+        a0[13] = (((v3 || 97) + (v2 > v0)) && ((v3 % 6) != (a0[13] % 5)));
+        a0[8] = (((v1 ? a0[4] : 21) > (v3 >= v0)) && ((v1 == v2) <= (a1[3][5] > v1)));
+        a0[0] = (((a0[2] ? v1 : v3) ? (v0 / 5) : (v3 && 25)) != ((v2 + a1[2][11]) ? (58 != 19) : (a0[4] > v1)));
+    } else {
+        a1[3][12] = (((16 < v2) <= (v2 <= 68)) ? ((30 && a0[3]) <= (19 >= v3)) : ((v2 / 5) <= (98 ? a0[7] : v1)));
+        v2 = (((a1[0][9] == v3) < (v2 && v3)) != ((94 ? a0[13] : a1[3][2]) ? (a0[14] == 11) : (23 % 3)));
+        a0[12] = (((v2 == 80) < (v1 <= a1[3][7])) != ((v1 ? v3 : a0[8]) != (v3 && 5)));
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+            v3 = (((v2 <= v2) < (2 > i9)) ? ((95 <= 5) == (v3 * 21)) : ((1 || v1) * (v3 < 17)));
+            v1 = (((8 * 36) > (v0 >= a0[9])) + ((a0[5] <= 77) != (i8 == v3)));
+            a1[0][13] = (((v1 / 2) == (a1[3][10] % 6)) + ((v2 <= v3) % 6));
+        }
+        v3 = (((8 && v3) >= (a0[8] == 64)) ? ((a0[10] * 37) ? (v0 >= 60) : (35 * v0)) : ((a1[1][13] < 2) - (v1 ? v3 : a0[13])));
+        a1[0][15] = (((v1 * v3) % 8) ? ((v3 >= a0[3]) % 9) : ((84 <= a0[7]) ? (a1[0][5] / 4) : (v3 >= i8)));
+    }
+    a0[12] = (((42 == a0[3]) && (85 > v3)) && ((v1 / 7) * (v2 > a0[14])));
+    a1[1][11] = (((84 == v0) - (v0 * v2)) - ((59 % 9) > (v3 >= a0[4])));
+    return (((v2 || 72) == (v1 ? 46 : v3)) ? ((v0 || a1[1][6]) > (v2 == v0)) : ((v0 ? a0[2] : v2) > (v3 <= v0)));
+}
+int f12() {
+    int v0 = 62;
+    int v1 = 1;
+    int v2 = 28;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((27 != v3) != (v3 < 5)) + ((v2 ? v1 : v1) * (v2 - a0[10])));
+    if ((((75 > a1[3][15]) >= (v0 > 52)) && ((v1 / 7) == (v1 > v0)))) {
+        v1 = (((v2 > v3) == (v1 * a0[11])) * ((v3 && a0[10]) - (v3 % 9)));
+        a0[13] = (((v1 ? 28 : v3) - (4 != a1[0][3])) - ((v1 > a0[11]) || (a0[6] && v0)));
+        v2 = (((69 > v1) * (v1 + v3)) * ((a1[1][2] + 9) < (v1 <= v1)));
+    } else {
+        v0 = (((v0 + a0[9]) ? (v3 / 3) : (v0 ? 44 : v3)) ? ((v1 % 8) < (76 * a1[3][14])) : ((a0[15] ? v2 : v0) && (v0 - 16)));
+        v3 = (((v0 == v1) < (a1[2][7] / 5)) < ((a0[3] >= a1[3][7]) > (v2 <= v2)));
+        a1[1][7] = (((v0 + 5) == (v3 || a1[1][0])) < ((91 || v2) >= (v1 * v3)));
+    }
+    if ((((a1[2][7] + 44) + (57 - v0)) + ((a1[3][4] ? v0 : 45) < (v0 >= v3)))) {
+        v1 = (((v3 == v1) + (a1[1][9] * v2)) < ((a1[3][15] || a0[5]) + (v3 < v1)));
+        v1 = (((v0 * a1[2][8]) != (v2 != v3)) == ((v0 ? v0 : 6) >= (28 + a0[1])));
+        v1 = (((v1 <= v3) && (v0 ? a1[3][8] : 52)) && ((a0[9] && 6) + (38 + v0)));
+    } else {
+        a0[2] = (((v2 && v3) <= (v0 || 71)) - ((v1 || v3) * (v2 ? v2 : a0[5])));
+        v1 = (((v0 + a0[5]) / 6) ? ((v3 ? 23 : 70) % 5) : ((a0[3] ? v1 : v1) && (95 + v0)));
+        v1 = (((v1 < 65) >= (63 > a1[1][3])) - ((v3 ? v0 : v1) >= (a1[1][15] * 82)));
+    }
+    v2 = (((v3 ? v0 : v0) ? (v0 == v1) : (a1[1][10] ? v3 : v1)) ? ((a1[3][5] >= v1) <= (v3 ? 86 : a1[2][2])) : ((v3 % 4) < (v2 / 8)));
+    {
+        int i0 = 0;
+        do {
+            a0[4] = (((39 == v2) >= (a0[2] || v2)) > ((a0[4] || a1[2][0]) && (i0 ? a1[3][1] : a0[12])));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((a1[0][14] || v2) <= (14 >= 75)) <= ((v0 % 4) == (v3 + v0)));
+                    v3 = (((i0 < a0[15]) == (a0[7] && 23)) ? ((45 - v1) || (v1 != 99)) : ((v2 ? a1[1][4] : 39) == (v2 + 69)));
+                    v0 = (((63 < 94) == (v2 / 2)) < ((v1 != 65) * (45 ? a1[3][0] : 95)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v2 != a0[9]) > (46 <= v0)) ? ((a0[10] ? v2 : 68) - (v0 && a1[2][11])) : ((v0 || a0[6]) < (48 != a0[3])));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a1[1][2] ? a1[3][8] : i2) ? (i2 < 22) : (a1[1][9] != v0)) / 3);
+            {
+                int i3 = 0;
+                do {
+                    a1[1][0] = (((i3 % 1) <= (a0[4] <= i2)) && ((i2 + v3) != (v3 <= i3)));
+                    a1[3][4] = (((42 <= 56) ? (v1 - v1) : (59 != 20)) == ((i2 != v1) ? (v3 ? v1 : v2) : (25 % 9)));
+                    v1 = (((i2 >= a1[2][14]) * (v3 != v0)) - ((a0[2] > v1) == (85 / 2)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v2 = (((40 / 2) % 7) % 8);
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v0 = (((27 * v2) ? (a0[3] + v3) : (8 ? v3 : v2)) <= ((a0[15] >= a1[2][12]) <= (a1[0][9] == v1)));
+            {
+                int i5 = 0;
+                do {
+                    if ((v2 % 6) > 95) break;
+                    v3 = (((i4 - a1[0][2]) && (5 % 3)) * ((v1 + i4) < (i5 == v0)));
+                    v3 = (((i5 / 9) ? (i5 == a0[12]) : (i4 == v0)) > ((v2 % 6) > (v3 % 3)));
+                    a0[11] = (((12 == 69) || (v0 < v0)) ? ((i5 * v1) * (i5 ? v0 : 32)) : ((a1[1][5] < a0[7]) ? (v0 >= a0[8]) : (i5 ? v0 : i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v2 = (((v0 && v1) >= (a1[2][13] - v0)) ? ((56 * v1) + (65 ? a0[10] : 14)) : ((2 - v2) || (i4 / 6)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((a1[1][2] >= a0[0]) >= (v3 != a0[3])) % 5);
+            a1[1][12] = (((a1[2][10] <= i6) < (v3 % 8)) * ((a1[1][11] ? 46 : 94) ? (a1[3][10] && v1) : (v0 != v2)));
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    if ((a0[0] || v0) > 89) break;
+                    a1[2][3] = (((a1[0][7] >= a1[2][13]) < (a0[10] != 21)) ? ((i7 ? v3 : 61) % 6) : ((i7 > i7) ? (v2 - 11) : (a0[9] % 3)));
+                    a1[1][7] = (((a1[0][10] + a1[0][10]) == (a1[1][8] % 3)) - ((78 - v0) < (1 <= i6)));
+                    v0 = (((v2 <= i7) < (v1 > i7)) / 1);
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[10] = (((a0[12] < a0[10]) < (92 == a1[2][13])) + ((i8 != 71) - (v1 * i8)));
+            v0 = (((18 - v2) <= (a1[3][3] * 99)) || ((v1 / 1) || (v2 ? v2 : 13)));
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    v2 = (((i9 - 50) <= (22 ? 56 : 4)) / 5);
+                    a0[0] = (((v2 != i9) == (v1 != v1)) ? ((a0[7] <= a0[9]) - (a1[2][4] != v1)) : ((i9 / 2) / 1));
+                    v1 = (((62 * a1[2][10]) ? (39 - i8) : (v3 ? v3 : i8)) * ((a1[0][6] / 6) ? (11 % 4) : (v0 <= v2)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    v2 = (((83 / 6) % 6) / 6);
+    return (((v3 + v2) - (4 > v3)) ? ((a1[2][4] <= v1) ? (v0 ? v2 : 6) : (v3 - v0)) : ((v2 >= v0) + (v1 ? v1 : a0[15])));
+}
+int f13() {
+    int v0 = 31;
+    int v1 = 24;
+    int v2 = 21;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 < a0[6]) * (52 && v0)) <= ((80 <= v1) || (41 / 5)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((i0 + a0[3]) / 5) ? ((v2 / 6) * (a1[0][6] * v1)) : ((v2 || 2) < (v1 < v0)));
+                    v1 = (((v3 == 6) >= (a0[8] <= 58)) ? ((94 % 4) > (93 ? i1 : i0)) : ((v0 && v2) == (a0[14] > i0)));
+                    v0 = (((v3 != v3) / 8) <= ((v0 == 62) / 1));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((64 != v3) <= (a0[8] % 8)) || ((v0 && i0) != (v2 + v1)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v0 = (((v1 + v1) == (97 % 4)) >= ((v2 / 7) * (v3 > 27)));
+            a0[5] = (((a1[0][6] == a0[6]) ? (66 % 4) : (82 || v2)) != ((9 ? i2 : i2) || (i2 - v2)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((a1[2][10] && a0[8]) > 95) break;
+                a0[13] = (((a0[4] ? v2 : 57) % 5) ? ((2 + 49) != (v1 <= v3)) : ((i2 >= a1[2][15]) + (i3 >= i3)));
+                a0[12] = (((v2 == v3) % 6) ? ((a1[0][15] / 9) + (7 == 80)) : ((31 && a1[0][10]) % 7));
+                a0[3] = (((56 <= a1[2][5]) / 4) % 2);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                if ((v2 > a1[3][9]) > 86) break;
+                a0[12] = (((a0[10] + v3) * (v0 / 4)) ? ((25 - a1[0][4]) ? (i5 ? v1 : v1) : (a0[13] > 91)) : ((a1[2][7] >= 25) >= (i5 + v1)));
+                a1[1][15] = (((i4 <= 44) + (v1 < i5)) > ((a0[0] ? a0[0] : v1) % 6));
+                v3 = (((92 ? v2 : v1) > (65 * a0[11])) || ((85 != a0[6]) ? (v1 > v0) : (a0[9] > 34)));
+            }
+            v2 = (((23 || a1[0][4]) ? (a1[2][7] ? v1 : 13) : (51 < v1)) >= ((v2 == v2) * (v1 + 59)));
+            v2 = (((a0[6] - i4) * (v3 && v1)) / 7);
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((v0 == 6) % 2) < ((20 && a0[2]) * (v0 ? v0 : v1)));
+    {
+        int i6 = 0;
+        do {
+            if ((v3 ? a0[1] : 82) > 93) break;
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((a1[3][6] && a0[12]) > 80) break;
+                v2 = (((v1 >= v3) ? (i6 >= 2) : (a0[2] || v1)) == ((a0[14] && a0[11]) != (a1[1][2] - v2)));
+                a1[0][4] = (((a0[7] + v0) % 6) <= ((a0[15] || i6) * (v2 < v0)));
+                v1 = (((a1[3][6] != i6) % 2) != ((v2 - i6) / 7));
+            }
+            a0[1] = (((v1 != v3) * (v0 == v3)) || ((v2 + v3) / 2));
+            v3 = (((v0 ? v0 : v0) <= (a0[4] % 4)) == ((i6 < v1) + (v3 + v0)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[1][13] = (((67 - i8) / 1) || ((a0[1] != a0[3]) ? (12 == a0[9]) : (a1[0][15] ? v2 : v1)));
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    a0[14] = (((v2 / 2) * (10 * v1)) - ((10 - a1[0][10]) / 5));
+                    v3 = (((a0[4] >= v1) == (v1 != v3)) * ((a1[0][6] != a0[14]) / 8));
+                    v0 = (((v2 - 0) < (a0[15] + 19)) == ((v0 ? 17 : a0[15]) != (a1[0][13] ? i9 : 7)));
+                    i9 = i9 + 1;
+                }
+            }
+            a1[1][1] = (((i8 / 9) > (v2 >= v0)) / 9);
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    v1 = (((a1[1][6] - v1) || (v3 != 92)) + ((v1 && v2) - (v2 / 8)));
+    {
+        int i10 = 0;
+        do {
+            if ((a0[4] % 1) > 88) break;
+            v2 = (((a0[10] < v0) > (i10 == a0[14])) / 5);
+            {
+                int i11 = 0;
+                do {
+                    v3 = (((86 < v1) < (v1 % 4)) && ((3 == a1[0][9]) >= (v0 <= v0)));
+                    v2 = (((a0[13] > i10) >= (v3 >= v2)) && ((a0[11] + a1[2][12]) ? (i10 + v2) : (95 < a0[7])));
+                    v1 = (((5 < v0) % 9) + ((a0[7] - 12) > (a0[0] > v1)));
+                    i11 = i11 + 1;
+                } while (i11 < 4);
+            }
+            v1 = (((v2 + 53) + (v0 >= v3)) < ((v3 >= v0) * (v0 ? a1[0][8] : v1)));
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    for (int i12 = 0; i12 < 3; i12 = i12 + 1) {
+        if ((v2 && v2) > 51) break;
+        for (int i13 = 0; i13 < 6; i13 = i13 + 1) {
+            v3 = (((a0[10] ? 57 : i12) % 5) ? ((8 >= i13) - (v3 >= 7)) : ((a0[12] && v0) * (i12 < v0)));
+            v3 = (((v2 / 4) < (2 + v3)) * ((v3 ? i13 : a1[3][9]) + (v1 >= v3)));
+            v3 = (((a1[1][2] + i13) - (70 != i12)) < ((a1[0][5] % 6) >= (53 % 9)));
+        }
+        v3 = (((v3 + 39) < (i12 * v0)) <= ((v0 / 1) + (37 - a1[0][5])));
+        v1 = (((v3 / 5) ? (a0[13] > v0) : (v3 ? 44 : v2)) ? ((93 + 98) || (v2 % 8)) : ((93 > v0) ? (94 > v3) : (i12 <= 92)));
+    }
+    for (int i14 = 0; i14 < 8; i14 = i14 + 1) {
+        v0 = (((a1[3][4] + v2) == (57 || v2)) > ((81 == 50) != (v3 == v1)));
+        {
+            int i15 = 0;
+            do {
+                v3 = (((i14 % 4) * (a0[0] < a0[11])) ? ((a0[11] - v2) && (i14 > 63)) : ((i15 && 66) >= (i14 <= 67)));
+                v1 = (((67 < i14) && (a0[12] ? a0[4] : a1[3][2])) + ((a0[1] - v2) && (i14 < v0)));
+                v3 = (((i14 == v2) / 1) / 9);
+                i15 = i15 + 1;
+            } while (i15 < 4);
+        }
+        v3 = (((a0[6] ? a1[1][5] : 73) && (86 && 31)) != ((i14 ? v2 : 13) - (a1[0][14] ? i14 : a1[3][13])));
+    }
+    return (((95 < v2) + (80 == 76)) >= ((v2 <= v0) - (a1[2][3] <= 84)));
+}
+int f14() {
+    int v0 = 61;
+    int v1 = 23;
+    int v2 = 93;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    a1[2][8] = (((67 % 2) == (v2 && a1[1][12])) * ((v2 != 80) <= (v1 * a0[14])));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a1[1][9] >= i0) > 99) break;
+        a0[1] = (((v0 >= i0) <= (a0[11] - a0[13])) - ((a0[15] <= a1[0][15]) / 6));
+        v2 = (((v2 > a0[5]) - (i0 ? v0 : a1[2][0])) / 3);
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v0 = (((v1 / 1) > (31 == v3)) / 1);
+            v3 = (((a1[3][5] * 10) != (v3 >= v2)) ? ((2 * 99) ? (21 + 80) : (v0 ? a1[3][4] : v1)) : ((v3 - i0) != (a1[3][1] || 51)));
+            a1[1][7] = (((i1 >= 9) > (a0[5] / 7)) >= ((v2 || 9) >= (v2 && a1[0][2])));
+        }
+    }
+    v3 = (((22 > v3) <= (v3 ? 19 : v3)) % 7);
+    v2 = (((v0 ? v1 : 7) != (v1 > a1[3][4])) + ((33 / 9) * (a0[10] ? a1[0][1] : v1)));
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v1 = (((v2 - a0[12]) / 6) % 2);
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v0 < a1[0][10]) > (v1 - 68)) ? ((i3 ? i2 : 31) + (a1[2][10] > v1)) : ((75 <= v1) > (v2 <= i2)));
+                    v3 = (((8 / 2) + (v3 > v1)) > ((v2 * 60) == (63 / 5)));
+                    a1[3][6] = (((v3 * 30) && (a1[1][14] == 73)) % 3);
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a1[2][15] = (((v1 <= 5) ? (a0[14] != v1) : (90 > i2)) == ((v0 - v3) ? (v1 > 48) : (98 != v1)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v1 ? i4 : i4) > 71) break;
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v1 = (((v0 - v1) ? (51 * a1[1][12]) : (i5 != a1[3][8])) > ((a1[1][11] % 6) != (21 + 81)));
+                    v0 = (((i5 ? 47 : a1[1][7]) != (v1 < 42)) * ((i5 * 48) < (64 ? 61 : v1)));
+                    v1 = (((v1 - v0) * (i4 * v1)) == ((i5 <= a0[3]) != (61 % 7)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[3][5] = (((v1 < v0) || (v3 - a1[1][0])) + ((i4 || i4) != (v3 != 86)));
+            v0 = (((a1[3][0] ? 58 : a0[7]) <= (a0[15] || a0[9])) ? ((49 != v1) != (a0[15] <= i4)) : ((v3 >= i4) / 8));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    v3 = (((v3 + 29) % 2) != ((v2 / 8) ? (v0 * a1[0][11]) : (40 % 6)));
+    if ((((a1[2][13] <= 93) <= (v1 / 3)) % 9)) {
+        a0[2] = (((v0 > a1[2][6]) % 1) >= ((70 ? v1 : v2) && (v0 * v3)));
+        v1 = (((16 * 40) / 7) <= ((v1 ? 91 : v2) - (a1[3][7] >= v1)));
+        v2 = (((69 != a0[4]) / 9) > ((a0[15] >= 1) <= (v1 != v2)));
+    } else {
+        v0 = (((a0[3] % 5) == (v1 || v1)) % 7);
+        v3 = (((v3 * a0[7]) / 2) || ((a0[13] + a1[3][3]) < (a0[13] <= v1)));
+        a1[0][5] = (((v3 >= v1) || (v1 < v1)) < ((v2 + 6) ? (v2 % 1) : (72 <= a0[3])));
+    }
+    if ((((v2 - v0) < (a0[4] > v0)) * ((a1[3][5] <= a0[9]) != (38 + 20)))) {
+        v0 = (((a0[7] + a1[0][6]) > (a1[0][2] == a0[2])) ? ((31 >= 31) >= (a1[2][1] + v1)) : ((a1[0][11] * a0[1]) <= (v2 ? v2 : 63)));
+        v3 = (((v1 < a0[9]) != (v1 == v0)) >= ((3 || 53) + (v2 != v3)));
+        a0[7] = (((a0[4] || v3) / 8) % 3);
+    } else {
+        a1[0][12] = (((a1[2][11] + 79) ? (40 > v0) : (86 - 15)) + ((95 >= a0[6]) / 2));
+        v1 = (((v0 ? a1[0][13] : 1) ? (a1[0][13] / 1) : (92 * v3)) * ((56 <= v2) >= (v2 > v1)));
+        v3 = (((a1[2][6] + a1[1][5]) && (a1[2][0] >= v1)) < ((a1[1][8] ? v2 : v1) * (36 > 15)));
+    }
+    v1 = (((v0 / 1) != (v3 || v2)) != ((a0[4] / 4) == (v1 + v0)));
+    return (((48 ? v1 : v1) + (v2 * a1[2][13])) > ((v0 + v1) > (v2 * a1[2][12])));
+}
+int f15() {
+    int v0 = 51;
+    int v1 = 7;
+    int v2 = 78;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v3 = (((a1[3][8] + i0) % 1) * ((i0 - v1) != (v0 ? a0[0] : a1[3][8])));
+        v0 = (((v1 ? v0 : v2) / 2) ? ((v3 != 88) ? (v2 + a1[3][5]) : (13 && v2)) : ((v1 / 7) && (22 * v0)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                if ((a0[0] % 9) > 81) break;
+                v0 = (((21 || a0[5]) % 5) / 5);
+                a0[14] = (((i0 + 27) * (v3 < v3)) != ((v1 * a0[6]) + (4 > a1[2][15])));
+                a1[2][9] = (((a1[0][6] > i0) * (i1 / 7)) >= ((v2 / 5) ? (55 || a1[3][10]) : (v1 - v3)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    if ((64 == a1[3][14]) > 95) break;
+                    v1 = (((40 ? 49 : a1[2][13]) ? (a0[4] < 45) : (i3 == v1)) * ((v0 / 3) == (v3 == a0[6])));
+                    a1[2][1] = (((v0 * v1) ? (v0 / 6) : (a0[7] != i3)) + ((48 && v1) && (v2 >= v0)));
+                    a1[0][2] = (((94 ? i3 : 98) < (v1 && 40)) - ((37 % 4) <= (i2 ? 14 : 81)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v3 = (((i2 != v0) == (a1[0][13] < a0[4])) && ((v0 >= i2) > (a0[15] > 84)));
+            a1[0][9] = (((i2 < i2) / 5) * ((a1[1][14] ? v1 : i2) * (1 > a0[1])));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((v1 > a1[1][7]) < (82 != v3)) || ((v3 / 7) || (v3 >= 58)))) {
+        v0 = (((v3 > a0[10]) == (v3 ? 40 : 11)) == ((v0 > v0) >= (a1[3][6] != v3)));
+        v2 = (((v0 >= v2) <= (65 >= v2)) != ((44 == 7) + (98 >= v3)));
+        v3 = (((v0 * v3) - (1 - v2)) == ((v2 > v1) >= (v0 % 2)));
+    } else {
+        v3 = (((a1[0][9] ? a0[11] : v2) >= (v2 ? 58 : v3)) / 3);
+        a0[8] = (((v0 - v2) ? (v1 == v1) : (a0[10] >= a1[3][14])) - ((v0 <= a1[2][3]) != (a0[15] >= v0)));
+        v3 = (((79 && 55) % 7) ? ((40 * 13) * (v0 * v2)) : ((v2 < a0[2]) + (42 && 40)));
+    }
+    a1[1][3] = (((21 >= 20) % 2) % 7);
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        a1[3][13] = (((a0[12] && 86) && (v3 < i4)) % 8);
+        v2 = (((v3 ? v2 : v0) >= (a0[7] < v1)) - ((v0 / 7) / 3));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v3 = (((30 ? 6 : 65) + (2 ? 78 : i4)) * ((a1[2][9] && 28) == (42 == a0[1])));
+                a1[0][10] = (((49 >= i4) ? (v2 >= i5) : (v3 <= 53)) > ((71 < 42) ? (20 / 4) : (v0 - i4)));
+                v1 = (((v2 + a0[13]) * (v0 == 32)) == ((51 / 1) / 1));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v1 = (((v1 != 44) % 5) / 5);
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v3 = (((v0 - 28) < (a0[8] || 63)) - ((a0[5] ? a0[0] : a0[0]) == (a1[2][8] % 2)));
+                    v3 = (((v0 % 5) / 5) < ((v2 ? 88 : v2) != (19 < v2)));
+                    v3 = (((a0[9] || 56) > (i7 != v0)) > ((i7 == a1[3][14]) / 9));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((v0 ? v0 : 65) > (78 > v0)) + ((v2 > v2) < (9 / 7)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v3 = (((1 == a0[5]) / 4) > ((77 < 81) < (v3 <= 32)));
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    a1[1][0] = (((v1 > a1[1][13]) > (v1 != 43)) >= ((v1 / 8) == (67 - v0)));
+                    v3 = (((v2 * v0) && (a1[0][5] / 2)) % 1);
+                    a1[2][9] = (((i9 == 26) <= (93 ? v3 : v3)) >= ((v0 - i9) / 5));
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((v1 ? 17 : i8) || (i8 < a1[1][7])) % 3);
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    v3 = (((a0[9] && a1[3][0]) / 8) >= ((v0 != 33) ? (v0 || a0[1]) : (a0[0] == v0)));
+    {
+        int i10 = 0;
+        while (i10 < 3) {
+            v0 = (((i10 || a0[4]) / 4) * ((i10 ? i10 : a1[1][5]) ? (a0[8] < i10) : (a0[2] == a1[3][3])));
+            a1[2][12] = (((i10 / 4) || (v2 - a0[7])) || ((a1[0][9] == v1) > (v0 + v0)));
+            for (int i11 = 0; i11 < 2; i11 = i11 + 1) {
+                a1[1][11] = (((42 - 17) || (a1[0][12] && a1[0][9])) * ((25 * v2) && (62 >= a1[1][8])));
+                a1[2][14] = (((v3 % 2) - (v3 < 0)) * ((75 ? 97 : a0[10]) > (a0[8] - v2)));
+                a0[4] = (((v2 < a0[10]) / 1) > ((v3 ? a1[2][0] : v0) - (a1[1][8] ? v2 : 66)));
+            }
+            i10 = i10 + 1;
+        }
+    }
+    {
+        int i12 = 0;
+        while (i12 < 2) {
+            {
+                int i13 = 0;
+                while (i13 < 7) {
+                    a0[15] = (((v2 == a0[7]) <= (v1 - v3)) * ((v0 ? i13 : v2) * (v1 < v0)));
+                    v3 = (((v2 / 4) < (i13 ? a0[14] : 91)) ? ((i12 >= v3) + (a1[1][15] - v0)) : ((55 * a0[3]) / 7));
+                    a0[4] = (((i12 != v3) <= (46 == a1[0][8])) != ((a0[6] - a0[6]) > (a1[1][4] + v1)));
+                    i13 = i13 + 1;
+                }
+            }
+            v1 = (((v0 / 4) && (88 % 6)) > ((a0[11] || 53) || (i12 || 4)));
+            v2 = (((v2 <= v2) - (31 > i12)) ? ((v0 * 97) / 9) : ((i12 - a1[2][5]) * (a1[1][14] <= a0[15])));
+            i12 = i12 + 1;
+        }
+    }
+    return (((v0 - v3) / 3) && ((v2 != v2) ? (a0[7] ? a0[7] : 44) : (v0 % 5)));
+}
+int f16() {
+    int v0 = 12;
+    int v1 = 80;
+    int v2 = 24;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        a1[0][8] = (((a0[4] > 89) < (a1[2][10] / 4)) >= ((a1[3][7] - v0) / 1));
+        {
+            int i1 = 0;
+            do {
+                v3 = (((v3 && 3) - (a1[1][15] >= 67)) > ((i1 != 38) && (81 + 1)));
+                a0[15] = (((89 && a0[10]) && (51 > a0[2])) && ((v2 <= i0) / 1));
+                v1 = (((60 >= 97) > (v0 <= 86)) == ((77 != 77) / 2));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v3 = (((v0 < a0[15]) || (v0 && 54)) * ((a0[7] < a0[1]) >= (90 == v2)));
+    }
+    v1 = (((81 ? a0[5] : a0[14]) || (21 || v3)) < ((61 * 77) / 6));
+    v1 = (((v3 ? a1[0][2] : a1[0][4]) ? (a1[1][4] / 9) : (a0[8] * a1[2][12])) ? ((a0[5] <= v2) <= (58 && a0[1])) : ((v0 / 7) < (a0[11] / 8)));
+    if ((((v1 % 2) - (v3 % 4)) != ((v0 + v2) / 5))) {
+        a1[3][14] = (((v2 <= 17) > (55 > a0[4])) || ((a1[3][8] / 6) % 4));
+        v2 = (((v0 != v0) ? (69 < v1) : (91 / 7)) == ((a0[7] > v3) ? (v0 + v1) : (3 + 9)));
+        v2 = (((98 > v0) + (a1[0][2] <= v2)) != ((68 && a0[6]) + (a1[2][11] == v1)));
+    } else {
+        v0 = (((v2 ? v2 : v0) == (a0[6] != v1)) != ((12 ? v2 : 70) && (v1 * a1[3][5])));
+        v2 = (((v0 ? 58 : v1) == (a0[10] * a0[7])) >= ((v1 + 5) + (a0[7] > v2)));
+        v0 = (((v2 >= a0[7]) && (v2 >= v2)) * ((v0 <= v0) != (47 * a1[0][9])));
+    }
+    if ((((v1 >= 85) < (51 ? a0[0] : 55)) >= ((v0 && v2) == (v1 == a0[4])))) {
+        v0 = (((v2 > v1) + (v2 ? a1[3][15] : 69)) + ((96 ? v0 : 49) ? (v1 != 62) : (v0 ? a1[3][2] : 61)));
+        v0 = (((v2 != v2) ? (a1[1][6] % 8) : (a1[3][10] <= 18)) ? ((82 < v1) + (a0[2] ? 0 : v1)) : ((25 && v3) && (v2 ? v3 : v0)));
+        v1 = (((v1 % 7) * (a1[1][3] ? a0[7] : a0[8])) * ((v2 + 71) ? (a0[4] && v3) : (3 <= a1[2][14])));
+    } else {
+        v0 = (((a0[4] <= v1) < (v0 <= a1[1][6])) / 3);
+        v0 = (((v2 ? a1[0][7] : 2) % 8) || ((a0[14] + 25) < (v0 * v2)));
+        v1 = (((26 - a0[9]) == (30 > 63)) - ((a1[0][7] / 4) / 9));
+    }
+    if ((((a1[2][4] < v3) ? (v0 <= v1) : (18 / 6)) < ((a1[0][0] <= v2) - (a1[1][6] >= v1)))) {
+        v2 = (((5 >= v3) && (v3 <= v2)) || ((v3 + 92) < (v0 == 68)));
+        v0 = (((v1 - v2) >= (a0[9] ? v0 : v2)) && ((84 && v2) >= (31 || v1)));
+        a1[2][14] = (((a0[12] + 77) - (v2 <= 46)) - ((v2 && 73) && (v1 > 41)));
+    } else {
+        a1[3][12] = (((v1 ? a0[2] : 58) + (a0[1] + v1)) / 9);
+        v2 = (((2 * 72) != (a1[3][4] >= 53)) + ((v0 || 19) / 8));
+        a1[3][6] = (((v1 ? a1[1][9] : v1) % 7) ? ((12 ? a1[2][7] : v3) < (v3 < a1[2][8])) : ((v2 != a1[2][6]) ? (15 > 59) : (10 && v2)));
+    }
+    v1 = (((v0 * v3) % 8) != ((v1 <= 86) < (21 && 95)));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a0[11] < a1[3][2]) > 93) break;
+        a1[1][13] = (((a1[0][6] % 2) > (a0[15] >= a0[10])) * ((i2 <= v1) <= (a1[0][6] + v0)));
+        a0[11] = (((i2 && i2) && (a1[2][2] > 24)) <= ((v2 != v1) || (v0 % 7)));
+        {
+            int i3 = 0;
+            do {
+                if ((v2 - v0) > 66) break;
+                v1 = (((43 ? 82 : a1[0][11]) <= (i3 + 55)) || ((i3 && v3) > (v3 || i3)));
+                v3 = (((23 > i2) || (v0 ? 0 : v3)) ? ((i2 * v2) ? (v1 <= 1) : (i2 * v2)) : ((83 + i3) - (a1[3][7] % 6)));
+                a1[0][2] = (((35 + 53) % 2) > ((v3 < a1[2][5]) % 6));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v3 == i4) ? (i4 > v3) : (i4 >= 41)) != ((61 && v3) / 3));
+                    v0 = (((91 - 8) % 5) * ((v1 > v0) == (98 / 5)));
+                    v2 = (((46 % 4) ? (v2 <= v0) : (v2 / 8)) ? ((i5 - v0) && (v3 >= a0[13])) : ((i5 ? v2 : v3) == (v0 >= 78)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v2 = (((48 > a0[13]) - (a1[3][15] <= a0[11])) * ((i4 * a1[2][13]) > (69 - a0[13])));
+            v1 = (((a0[6] ? a1[2][7] : 46) > (71 && v0)) + ((a0[3] <= v2) || (a1[0][13] * a0[8])));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    if ((((v1 / 8) <= (v2 - a0[11])) >= ((v2 / 4) || (75 * v1)))) {
+        v0 = (((25 && a1[3][0]) <= (v2 < v0)) ? ((a0[12] > v1) != (75 / 1)) : ((v3 / 2) <= (v1 <= v3)));
+        a0[3] = (((a0[2] != v3) || (58 < 81)) + ((v1 < a0[5]) || (v3 == v1)));
+        v2 = (((v0 + v3) ? (v3 > 19) : (a1[1][5] > v3)) && ((v1 * v0) <= (v2 <= v2)));
+    } else {
+        v0 = (((89 > v1) || (a0[3] - v1)) ? ((24 == v2) != (a1[2][5] > v1)) : ((53 < v1) * (v3 - v0)));
+        v3 = (((11 ? 55 : 90) != (v1 < a1[3][5])) % 3);
+        a1[2][11] = (((v2 - v0) || (v3 + v3)) <= ((a1[1][14] / 6) ? (v1 % 9) : (v0 <= a0[5])));
+    }
+    return (((16 ? v1 : 58) < (59 % 5)) ? ((v1 && a1[1][9]) / 5) : ((67 ? a0[9] : v0) > (v0 / 7)));
+}
+int f17() {
+    int v0 = 35;
+    int v1 = 54;
+    int v2 = 13;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        if ((a0[10] ? a1[0][6] : v2) > 80) break;
+        a1[2][12] = (((22 + 48) - (64 % 2)) && ((v0 < 25) * (a1[3][4] ? v1 : v0)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a0[0] = (((a0[2] == a1[0][2]) <= (v1 != v0)) ? ((a0[5] + a0[7]) + (v2 == a0[10])) : ((v2 || 2) == (33 + a1[0][15])));
+            v3 = (((a0[8] >= 31) >= (50 - v0)) / 6);
+            v2 = (((v2 % 9) || (a0[12] < v1)) - ((i1 && 33) - (27 == a0[14])));
+        }
+        v2 = (((91 * v2) <= (i0 - 31)) / 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[7] == v0) > 87) break;
+            v2 = (((a0[11] <= v2) != (a0[5] <= i2)) + ((v3 >= a1[3][2]) + (28 > v0)));
+            v2 = (((65 > a1[1][11]) - (i2 - 37)) / 5);
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v2 = (((67 % 8) && (v3 <= 46)) == ((a1[1][12] / 2) <= (a1[2][8] / 7)));
+                    v0 = (((v2 || v3) > (62 * v0)) + ((14 ? v3 : 62) / 5));
+                    a1[3][2] = (((v0 < i3) > (a0[2] == v2)) * ((23 || 94) ? (a1[0][1] && 34) : (12 - a0[0])));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((v0 == 49) < (v0 == a1[1][4])) <= ((54 <= 96) || (a0[2] >= 14)))) {
+        v0 = (((v1 / 7) <= (v3 % 5)) ? ((v1 / 5) == (v3 % 8)) : ((a1[1][6] % 8) || (v2 / 8)));
+        v3 = (((v2 - 75) && (v2 ? a0[0] : a1[3][6])) == ((v3 || a1[3][5]) <= (41 % 8)));
+        v3 = (((v2 + a1[0][11]) && (25 * 4)) / 6);
+    } else {
+        a1[0][13] = (((v1 + a1[3][5]) || (70 ? a0[0] : a0[14])) && ((v3 < a1[0][13]) && (a1[1][1] + a0[11])));
+        a1[3][13] = (((v2 - v3) <= (39 * v0)) / 9);
+        v3 = (((v2 * a0[1]) != (v3 == a1[2][3])) + ((a1[1][7] - 66) ? (v1 ? v2 : v0) : (v1 % 4)));
+    }
+    if ((((a0[14] >= v0) / 8) == ((a1[1][11] / 9) != (v1 && 23)))) {
+        v2 = (((v0 % 8) > (a1[1][11] ? 2 : v2)) || ((a0[12] % 7) != (v1 - a1[1][14])));
+        v3 = (((v0 - v3) / 1) || ((v1 > v0) ? (v1 > v3) : (v2 % 6)));
+        a1[2][7] = (((v1 == 78) > (v1 ? v3 : 20)) % 7);
+    } else {
+        v0 = (((2 * v2) <= (v1 % 9)) < ((v2 * v0) ? (v2 < v3) : (46 < a1[2][9])));
+        v2 = (((v0 % 9) && (a1[0][0] % 3)) || ((v2 % 7) % 4));
+        a0[4] = (((v1 - a1[1][5]) < (v1 || 23)) || ((a0[13] == 77) % 4));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a1[1][11] = (((a0[4] + v2) <= (25 - v0)) < ((a1[2][1] + v0) == (a0[5] > v3)));
+                    a1[1][4] = (((i5 <= a1[3][13]) > (v2 && 2)) / 9);
+                    a1[2][3] = (((v0 == v3) ? (a1[2][0] % 2) : (63 || v2)) * ((72 * a0[1]) == (v3 || i4)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a0[4] = (((v2 || v0) < (a1[0][11] * a0[11])) ? ((a0[10] + a0[1]) && (i4 < v1)) : ((a1[3][4] / 2) >= (8 > a1[2][14])));
+            a1[2][10] = (((v0 + a1[2][2]) != (v1 != 74)) != ((2 ? v0 : 8) ? (v1 < 36) : (v3 * v2)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            if ((a1[1][0] == a1[0][4]) > 67) break;
+            {
+                int i7 = 0;
+                do {
+                    if ((i7 + 36) > 56) break;
+                    a0[6] = (((v3 < v3) || (v2 <= 35)) + ((v2 <= i6) > (i7 <= v1)));
+                    v2 = (((v2 ? v1 : i6) >= (v0 * a0[15])) || ((a1[0][11] <= i6) && (67 != v1)));
+                    v0 = (((20 / 2) * (a1[2][7] % 1)) < ((a1[0][6] % 8) / 1));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            a0[1] = (((28 % 6) != (88 && v2)) + ((v3 * v0) + (12 >= v1)));
+            v0 = (((66 ? 5 : v0) == (v1 ? v3 : v0)) < ((i6 >= 48) - (v2 ? 47 : a0[3])));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            v0 = (((i8 && 11) ? (v0 == v1) : (a0[9] < v3)) != ((v3 != v1) * (v2 != v3)));
+            a0[2] = (((v3 / 1) < (i8 ? i8 : i8)) >= ((v1 ? v0 : v2) != (86 == 57)));
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                if ((v3 || v1) > 58) break;
+                a0[3] = (((a1[1][1] >= v1) / 8) || ((12 > i9) ? (v2 % 4) : (v2 % 1)));
+                v3 = (((a0[11] && 3) > (4 ? a0[10] : v2)) / 2);
+                a1[1][11] = (((v3 * 72) != (v1 != v3)) < ((v3 * a1[1][13]) || (24 != i8)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v0 >= v0) || (a1[2][1] % 8)) + ((v2 * a0[13]) / 1))) {
+        v3 = (((v2 > 53) / 3) ? ((v0 / 8) && (1 ? v1 : v0)) : ((38 != a1[0][2]) >= (v3 % 8)));
+        a0[5] = (((v1 - a1[2][13]) + (v2 <= v2)) % 7);
+        v0 = (((v3 || 46) < (a0[2] > v3)) || ((v0 != v0) ? (a0[3] > a1[2][13]) : (v2 / 9)));
+    } else {
+        a0[7] = (((v0 < a0[13]) > (a1[1][10] == v3)) && ((v1 >= 92) == (67 % 7)));
+        a1[3][3] = (((53 && v1) >= (v0 >= v0)) ? ((v3 != 24) % 8) : ((v3 / 6) + (7 != 15)));
+        v2 = (((v2 == v0) || (19 * v2)) + ((v3 < a0[15]) / 5));
+    }
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        for (int i11 = 0; i11 < 8; i11 = i11 + 1) {
+            if ((29 % 8) > 67) break;
+            v1 = (((80 >= 0) % 2) != ((i11 / 3) && (a1[0][0] % 5)));
+            v1 = (((v0 < v1) > (a1[2][7] > v3)) + ((v1 * v0) && (a1[3][13] >= 1)));
+            v2 = (((v1 > v2) || (v1 - v0)) < ((53 / 1) >= (a1[2][1] ? a1[1][3] : 42)));
+        }
+        v3 = (((v2 % 5) ? (a1[3][0] - 38) : (69 < a1[3][14])) && ((91 * 38) / 8));
+        v2 = (((a1[2][7] <= i10) * (11 == v3)) >= ((v2 <= a1[0][4]) <= (v0 * 80)));
+    }
+    {
+        int i12 = 0;
+        do {
+            v1 = (((28 <= i12) ? (a1[2][13] == a0[5]) : (a0[6] - 78)) && ((v2 + v1) == (91 != v3)));
+            v2 = (((a1[3][9] ? v1 : v0) == (v3 - a0[2])) || ((i12 + a1[0][12]) ? (v1 % 6) : (v0 / 2)));
+            {
+                int i13 = 0;
+                do {
+                    if ((v3 || 85) > 87) break;
+                    v1 = (((5 && a1[2][0]) - (7 || a1[3][14])) < ((45 && 16) <= (v1 != v2)));
+                    v3 = (((i13 <= i13) ? (97 <= 37) : (i12 ? a0[12] : i12)) + ((a1[1][12] ? 11 : a0[13]) <= (v1 / 4)));
+                    a1[1][13] = (((v2 && a0[1]) || (i12 ? i13 : v0)) ? ((v0 >= v1) / 8) : ((a1[2][7] && 36) < (2 <= 69)));
+                    i13 = i13 + 1;
+                } while (i13 < 2);
+            }
+            i12 = i12 + 1;
+        } while (i12 < 7);
+    }
+    return (((v3 <= 49) / 9) && ((a0[10] - v3) < (v2 + 47)));
+}
+int f18() {
+    int v0 = 26;
+    int v1 = 34;
+    int v2 = 92;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((2 || 17) - (68 * a0[9])) + ((40 && 5) && (a1[1][5] != 39)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v1 = (((a0[11] == 48) == (6 != v3)) < ((v0 ? 89 : 4) % 7));
+                    v3 = (((v2 ? 54 : 26) % 6) != ((a1[0][0] / 1) % 1));
+                    v0 = (((v2 == v1) + (v2 + v3)) >= ((a0[1] ? v0 : i1) / 6));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((a0[14] / 7) >= (v0 - v0)) ? ((87 ? v3 : 91) > (a1[3][5] || v1)) : ((68 ? 6 : v0) ? (v2 ? 14 : 35) : (84 * i0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            a0[13] = (((v0 % 5) >= (v1 > a1[3][14])) < ((v0 ? 47 : 37) && (v0 || v3)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v2 = (((i2 >= a0[15]) != (v2 && v1)) != ((a0[0] - i2) && (96 != i2)));
+                    a1[3][8] = (((15 > v3) ? (v1 ? a0[10] : 77) : (v2 && a0[6])) % 7);
+                    v1 = (((42 ? a0[10] : v0) < (6 >= 4)) <= ((a1[1][5] ? v1 : i3) ? (i3 ? a1[2][7] : v1) : (v2 > v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v2 < v3) == (38 > 96)) >= ((v1 / 3) <= (v0 ? v0 : i2)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v0 <= v0) < (a1[1][1] - a0[5])) < ((a1[2][4] >= v3) / 5))) {
+        v1 = (((v3 == v1) < (67 / 7)) <= ((a0[4] * v0) || (a0[2] == a0[3])));
+        a0[11] = (((3 ? v0 : 81) % 5) - ((v3 * v0) - (v2 != v1)));
+        v2 = (((v0 || v0) * (45 ? v0 : 10)) || ((v1 * a0[4]) >= (v3 > a0[1])));
+    } else {
+        a1[2][0] = (((a1[2][7] * a0[15]) == (a1[1][15] && a1[0][5])) % 6);
+        a1[0][0] = (((a0[15] >= 93) ? (v1 && 80) : (a1[1][8] >= v0)) % 3);
+        v1 = (((14 >= 62) + (14 < 28)) % 5);
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((i4 <= v3) || (23 != v1)) - ((i4 && a0[12]) > (47 != v1)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                if ((i4 ? a0[13] : v0) > 59) break;
+                a1[3][7] = (((a1[1][6] > v0) && (62 >= v0)) * ((v0 > v0) / 7));
+                v3 = (((28 >= a0[14]) >= (84 < v3)) / 3);
+                v2 = (((a0[1] % 5) ? (v0 + i5) : (v0 <= a0[4])) >= ((v3 || 23) % 9));
+            }
+            v2 = (((29 != a0[4]) ? (i4 + a1[3][0]) : (v0 >= 12)) - ((i4 ? i4 : a1[1][10]) < (9 != 97)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[0][11] = (((a0[13] ? v3 : v1) <= (v3 > i6)) || ((i6 / 6) / 7));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((a0[2] || v0) + (a0[11] == v2)) > ((a0[2] % 7) - (v1 * v1)));
+                    v0 = (((v2 / 9) - (v3 + 58)) / 2);
+                    v3 = (((v2 + a1[3][5]) - (70 ? 71 : i7)) && ((v0 == v0) == (59 != v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            a1[1][2] = (((v2 ? i6 : 61) % 2) >= ((17 * 7) % 2));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        v3 = (((24 ? v0 : a1[3][6]) < (v3 % 9)) < ((v1 - v3) && (a0[7] >= v3)));
+        v3 = (((a0[12] * v1) < (v0 * v0)) || ((a1[0][4] || a1[0][10]) >= (v0 * 4)));
+        {
+            int i9 = 0;
+            while (i9 < 2) {
+                v3 = (((i8 != v3) == (v3 * i8)) && ((v1 <= 32) ? (a1[1][14] == a0[12]) : (23 != 69)));
+                a1[1][3] = (((a1[2][8] <= v0) >= (a0[0] < v0)) <= ((v3 % 1) >= (45 ? 0 : a0[4])));
+                v0 = (((a0[14] * 54) + (v1 * a0[10])) * ((v0 >= v0) * (a0[11] + a1[1][11])));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    if ((((a0[15] + v2) - (v2 || a0[4])) && ((98 < a1[1][9]) < (a1[2][4] || v3)))) {
+        a0[4] = (((v2 <= v3) == (a0[6] * 52)) + ((a1[1][2] >= v2) <= (85 ? 21 : v1)));
+        a1[3][13] = (((a0[15] <= 50) >= (v0 * v3)) / 5);
+        v1 = (((v2 || v2) > (v2 - a1[0][4])) ? ((v0 > a1[1][3]) / 5) : ((v0 <= 36) / 1));
+    } else {
+        a1[0][11] = (((v2 % 1) + (v3 >= v2)) % 1);
+        v1 = (((62 * v0) < (v3 * a1[0][0])) != ((a1[1][3] > v1) < (v1 != 64)));
+        a0[0] = (((a0[8] ? a1[2][14] : v3) && (v3 && v3)) % 8);
+    }
+    a0[14] = (((77 < 69) != (a0[2] != v3)) ? ((v0 != a1[0][0]) * (64 == v1)) : ((v0 != a0[10]) + (v0 * v1)));
+    v3 = (((v1 != a0[1]) != (a0[13] % 4)) ? ((a1[2][12] % 3) / 9) : ((a1[2][14] && v0) < (v3 <= v0)));
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            {
+                int i11 = 0;
+                do {
+                    if ((a0[4] < a1[1][6]) > 76) break;
+                    v0 = (((v1 ? a1[1][12] : 31) ? (v3 == v3) : (39 < a0[0])) != ((v1 % 4) < (v0 && a1[3][7])));
+                    a0[10] = (((79 >= v0) * (i10 ? 92 : 96)) * ((90 && i11) + (a1[1][11] > a0[13])));
+                    a0[11] = (((i10 ? a1[1][15] : i11) - (90 / 8)) - ((i11 - v3) || (a0[11] - v3)));
+                    i11 = i11 + 1;
+                } while (i11 < 5);
+            }
+            v2 = (((i10 == v3) % 3) + ((v3 || 49) % 1));
+            a1[2][9] = (((a0[11] < i10) == (a0[8] < v0)) > ((a0[3] >= 24) + (37 < 56)));
+            i10 = i10 + 1;
+        }
+    }
+    return (((v2 > 93) <= (v1 || a0[13])) * ((v2 == v2) <= (4 <= 16)));
+}
+int f19() {
+    int v0 = 94;
+    int v1 = 84;
+    int v2 = 37;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v2 == a0[3]) ? (v0 < 37) : (95 ? a0[4] : 8)) + ((96 <= a1[2][8]) ? (a1[3][9] * v2) : (a1[2][6] == v3)));
+    v1 = (((v2 <= v2) * (4 && a0[10])) || ((v2 ? 86 : v1) != (94 || a1[2][1])));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((24 != 0) % 9) / 4);
+            a1[2][9] = (((53 > v3) / 4) || ((v3 || 91) <= (v2 != v2)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v3 = (((a0[13] && a1[1][4]) * (a1[1][1] != v1)) == ((v0 * 48) - (v2 >= v2)));
+                    v1 = (((v2 || a1[0][2]) ? (a0[11] + i1) : (v2 % 4)) % 9);
+                    v3 = (((v0 && a1[1][10]) && (i1 ? 14 : 96)) || ((68 >= 44) < (60 >= 11)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((99 - v2) / 6) % 5)) {
+        v2 = (((v2 >= v2) < (81 > 80)) - ((v1 || v3) - (a1[1][10] * v3)));
+        a0[13] = (((a0[2] && v2) + (v0 / 9)) / 8);
+        a0[4] = (((v1 < v3) > (a1[2][13] || v3)) != ((v0 || a1[0][10]) <= (v0 > v2)));
+    } else {
+        a1[2][14] = (((a1[2][6] - v3) >= (46 % 3)) > ((a1[0][2] + v3) == (v0 > a1[3][0])));
+        v0 = (((a0[11] == v1) <= (a0[15] == 29)) && ((v1 && a1[1][0]) + (a0[8] ? 25 : v0)));
+        a1[2][11] = (((a0[10] == v1) ? (6 - a0[7]) : (63 ? a1[3][6] : a1[2][8])) > ((v3 + v2) != (24 / 6)));
+    }
+    if ((((70 ? v1 : v3) ? (v1 != v1) : (v0 >= v1)) >= ((v0 % 8) > (v0 < v0)))) {
+        a1[2][10] = (((v3 == a0[1]) - (v1 >= v3)) && ((v1 != v3) > (a1[2][4] >= v2)));
+        v0 = (((80 + v1) != (v0 / 4)) % 1);
+        v0 = (((v3 > 91) && (v1 ? 19 : v3)) > ((a1[3][5] < v3) ? (56 == 69) : (v2 - 75)));
+    } else {
+        v2 = (((v0 == v0) * (a0[11] / 5)) / 1);
+        v0 = (((v0 + v1) <= (27 > v2)) || ((48 != a1[2][14]) != (v2 && a0[7])));
+        v2 = (((v3 ? v2 : v3) + (a0[2] < v3)) > ((87 ? a1[0][13] : v3) > (v0 > a0[0])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            {
+                int i3 = 0;
+                do {
+                    a0[7] = (((v0 != a0[7]) || (a1[1][7] ? a0[3] : a0[5])) * ((i3 < v2) || (i3 * v0)));
+                    v2 = (((v2 * a1[1][15]) == (v0 < v1)) - ((i2 <= v0) >= (a0[13] - 90)));
+                    v3 = (((v2 && v3) ? (76 == v2) : (4 || 88)) % 7);
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v3 = (((v2 < v0) > (a1[2][2] ? 29 : 71)) / 3);
+            a1[2][0] = (((59 ? a1[3][13] : v2) == (a0[12] > v1)) ? ((a1[0][6] % 3) ? (v0 < v1) : (a0[1] >= v0)) : ((v1 % 6) + (44 <= i2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                v2 = (((i4 || a1[1][14]) != (a1[1][14] ? i5 : a0[2])) * ((i5 - i5) > (35 - a1[3][5])));
+                v2 = (((i5 < i4) ? (a0[2] % 4) : (a0[10] - a0[14])) && ((i4 >= v0) < (v2 == a1[1][7])));
+                a0[2] = (((a1[0][8] % 7) ? (12 - 30) : (v0 && a0[9])) < ((5 >= a1[3][10]) == (v2 % 6)));
+            }
+            a1[1][12] = (((v0 > v2) % 1) / 9);
+            v3 = (((a0[13] % 5) ? (68 || v2) : (a1[3][2] - a0[2])) * ((a1[3][8] >= 97) >= (v1 ? a0[6] : v3)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((a0[0] < i6) < (a1[3][1] >= v3)) - ((v2 || 41) - (a1[0][0] ? a0[14] : v2)));
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    if ((a1[0][10] / 3) > 63) break;
+                    a0[13] = (((a1[3][13] <= i6) / 7) != ((v0 > 61) || (a0[4] == v1)));
+                    v1 = (((i7 < 88) && (48 == a0[11])) <= ((34 - a1[1][11]) - (v2 ? 68 : 8)));
+                    v2 = (((v3 < v2) <= (a0[6] > a1[3][10])) + ((i6 ? v3 : v2) > (a1[2][6] && v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((57 + 59) % 5) > ((68 || v1) / 3));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            {
+                int i9 = 0;
+                do {
+                    a0[5] = (((v3 && 59) % 7) || ((v3 ? 3 : i8) ? (24 % 3) : (i8 / 8)));
+                    a0[6] = (((i9 && a1[3][3]) > (66 / 9)) - ((42 || a0[9]) && (a0[3] >= 92)));
+                    a0[3] = (((6 <= v2) != (v1 > v0)) != ((i8 >= v2) == (i9 + 47)));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            v2 = (((v2 != 22) == (v2 > a1[3][14])) <= ((v0 != a1[2][4]) < (i8 + i8)));
+            a0[11] = (((v0 + v2) - (v1 == 68)) / 7);
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            v0 = (((v0 % 3) - (a0[5] ? v2 : a1[1][0])) > ((a0[15] * 73) >= (a0[9] % 8)));
+            for (int i11 = 0; i11 < 7; i11 = i11 + 1) {
+                a1[3][0] = (((v3 || a0[2]) && (a1[3][10] ? v3 : 56)) < ((v2 % 6) && (10 < v0)));
+                v3 = (((v0 < v1) == (v0 != i11)) + ((v0 <= v1) % 2));
+                v3 = (((23 < v2) < (v3 <= 43)) || ((a0[5] - 14) >= (v3 > i11)));
+            }
+            v1 = (((81 && v2) + (v0 < a0[1])) - ((v3 < v0) < (v0 * 56)));
+            i10 = i10 + 1;
+        }
+    }
+    return (((v2 >= a0[8]) - (4 != 29)) ? ((43 + a1[3][12]) == (v1 > v1)) : ((v1 == a1[3][9]) < (a0[15] == a1[0][9])));
+}
+int f20() {
+    int v0 = 22;
+    int v1 = 77;
+    int v2 = 90;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 ? 3 : v0) / 5) < ((a1[1][10] <= v3) * (v0 ? v2 : a1[2][3])));
+    if ((((76 == a0[1]) > (a1[1][10] % 5)) % 5)) {
+        v3 = (((43 * a1[0][7]) - (v2 != v3)) >= ((v2 && a0[11]) != (a1[1][3] == v3)));
+        v1 = (((a1[1][11] * a1[2][12]) && (v2 > v0)) || ((v1 == 44) > (a1[1][0] == a1[3][11])));
+        a0[15] = (((40 - 61) * (v1 != v1)) == ((65 < v3) + (63 || a0[12])));
+    } else {
+        a0[8] = (((v1 || 80) / 9) <= ((v2 % 7) * (74 >= a1[0][6])));
+        v1 = (((39 - 48) || (v0 ? 95 : a1[1][3])) == ((v2 % 1) && (v1 + v2)));
+        a1[2][3] = (((v2 ? a1[3][4] : 44) < (v1 * v3)) < ((v2 != v1) + (a1[0][6] ? 84 : v2)));
+    }
+    v0 = (((a0[10] ? 70 : 54) || (v1 % 1)) >= ((v1 <= a0[13]) > (v0 != 8)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v1 = (((a1[1][5] && v0) * (i0 * 52)) <= ((73 / 1) ? (a1[2][13] <= a0[9]) : (v1 / 6)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v3 = (((a0[2] != v0) != (i1 >= v3)) + ((i1 ? 79 : a0[10]) == (11 > i0)));
+            v1 = (((v2 == 15) ? (v1 - 89) : (65 / 6)) ? ((v1 <= i0) < (i1 || v1)) : ((14 > 76) * (70 ? v2 : a0[12])));
+            v0 = (((v2 >= 70) == (a0[5] && v0)) <= ((v0 % 7) <= (a1[3][12] ? v2 : a0[14])));
+        }
+        v0 = (((50 / 2) > (v0 != 51)) >= ((3 ? v2 : a1[1][2]) && (v0 <= i0)));
+    }
+    a1[3][8] = (((v1 || v2) != (v0 * v1)) % 7);
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v3 ? 70 : 73) > 81) break;
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v1 = (((a0[15] % 8) % 4) / 2);
+                    v2 = (((i2 > 54) || (v2 ? a1[3][2] : 1)) == ((a0[12] / 4) + (v0 && v0)));
+                    v3 = (((i2 < a0[4]) / 3) ? ((a1[3][10] || i2) || (v0 ? v2 : a0[5])) : ((v2 && 24) != (a0[15] > 4)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((61 && a0[14]) ? (a1[1][13] || a1[1][13]) : (v2 != a1[1][7])) && ((a1[1][10] >= v3) > (84 != a1[3][9])));
+            a1[0][8] = (((v2 > 35) % 5) && ((v3 ? 67 : 73) % 8));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            a1[3][6] = (((v3 == a1[0][9]) <= (a1[0][15] <= 90)) - ((97 || v2) * (52 / 5)));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                a1[2][8] = (((v3 == v1) <= (i4 > a1[0][9])) >= ((a1[1][3] ? v3 : i5) != (a1[3][6] % 9)));
+                v0 = (((23 + a1[3][11]) / 2) * ((11 >= a0[14]) - (82 > 42)));
+                v1 = (((i5 % 3) < (90 > 1)) != ((a1[0][13] > i4) && (v1 > a0[7])));
+            }
+            a1[3][10] = (((a1[2][10] ? 20 : a0[8]) == (69 != 79)) + ((v1 / 1) * (v0 - 73)));
+            i4 = i4 + 1;
+        }
+    }
+    a1[0][10] = (((52 && v1) < (a0[7] == 89)) * ((68 < a0[7]) % 7));
+    v3 = (((v2 || v2) * (v3 >= a0[3])) > ((v2 <= v0) >= (v1 > v0)));
+    {
+        int i6 = 0;
+        do {
+            if ((a1[2][4] + a1[0][5]) > 63) break;
+            a1[0][2] = (((50 ? i6 : i6) + (i6 < v0)) <= ((v2 + v2) >= (29 < i6)));
+            {
+                int i7 = 0;
+                do {
+                    if ((a1[0][9] && i7) > 79) break;
+                    v3 = (((65 != i7) < (a1[0][15] < i7)) % 8);
+                    v2 = (((a1[0][15] != 67) == (a1[3][2] * a1[1][5])) > ((a1[0][15] - 69) - (a0[0] && a0[15])));
+                    v2 = (((v0 != 42) + (a1[0][12] % 5)) ? ((v0 - v3) && (a0[3] < a0[11])) : ((84 ? v2 : v3) / 4));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            v2 = (((v0 - 52) != (71 == v3)) <= ((i6 / 9) == (13 ? a0[7] : i6)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    return (((v0 * v2) <= (v2 - a0[3])) > ((v2 != v0) >= (v1 > v3)));
+}
+int f21() {
+    int v0 = 55;
+    int v1 = 47;
+    int v2 = 8;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 < 88) >= (77 < 51)) / 9)) {
+        a0[2] = (((v0 >= v1) - (a1[1][7] != 8)) <= ((a0[10] >= 38) * (56 || 16)));
+        v3 = (((a0[5] ? v2 : v1) && (a1[3][9] / 3)) ? ((a1[3][0] - 18) >= (v2 == 54)) : ((v2 == a1[1][4]) / 4));
+        v0 = (((82 >= 19) > (v1 == a0[12])) ? ((v3 > v3) % 4) : ((28 % 7) && (v3 - v3)));
+    } else {
+        v2 = (((v2 * 51) ? (a1[3][15] - a1[2][15]) : (v1 >= 21)) != ((v3 * a1[1][1]) ? (a1[3][8] == a0[13]) : (97 >= v0)));
+        v0 = (((v3 - a1[2][2]) != (v0 > v0)) <= ((v2 * v3) || (79 < v3)));
+        a1[3][0] = (((v1 / 1) < (14 > 34)) != ((v1 * v0) >= (v1 <= a1[0][0])));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((95 / 6) > 85) break;
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a1[1][13] = (((i0 != v0) - (85 ? v2 : a1[0][4])) == ((v0 % 2) * (v2 ? 13 : i0)));
+                v1 = (((i1 ? i0 : v0) && (i1 / 6)) == ((a0[1] > i0) == (v2 * a0[6])));
+                v3 = (((28 && 34) + (58 != 51)) / 6);
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((82 / 4) || (v0 && 58)) ? ((v3 ? 49 : v3) || (a1[0][13] >= v2)) : ((a0[9] <= v3) * (v1 != a0[0])));
+        v2 = (((v2 != a0[3]) + (v3 * 45)) >= ((a0[10] == v3) <= (v0 * 61)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((i2 - v2) % 5) / 1);
+            v3 = (((v1 / 5) != (a0[5] < a1[2][11])) - ((v1 - 0) % 1));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((93 / 7) < (i2 + i2)) == ((31 >= a1[3][0]) / 5));
+                    v1 = (((1 / 3) <= (i3 >= i2)) / 5);
+                    v0 = (((v3 || a1[2][1]) >= (v3 ? v1 : a1[2][5])) ? ((v3 - v3) <= (v0 < v3)) : ((v0 ? a0[1] : 16) < (59 ? v2 : i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a0[3] = (((v2 - a0[3]) < (a0[8] - a0[15])) < ((47 != 35) * (v2 ? a1[3][15] : 27)));
+        {
+            int i5 = 0;
+            do {
+                a0[9] = (((i5 - v2) + (v0 + 27)) <= ((a1[0][8] % 4) >= (v3 + v1)));
+                v2 = (((i5 == a1[3][13]) < (v3 - a0[8])) - ((15 / 3) >= (a1[0][15] && v0)));
+                a1[2][1] = (((v3 % 7) + (a0[9] > v2)) + ((47 * 83) < (v2 <= v2)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        v0 = (((54 != a1[3][15]) ? (a1[3][3] && a0[5]) : (v2 >= a1[3][13])) > ((a1[2][11] * a1[3][12]) / 4));
+    }
+    if ((((v0 == v2) / 6) > ((v3 <= a1[1][2]) ? (v3 < a0[2]) : (a0[2] != v0)))) {
+        v0 = (((v1 - v2) % 5) / 3);
+        v1 = (((a0[11] / 6) == (a1[2][13] > v2)) < ((a0[11] % 1) / 6));
+        v0 = (((a0[14] ? 74 : a1[2][4]) <= (v2 && v2)) ? ((a1[3][6] % 8) / 4) : ((a1[1][12] < 71) > (v0 < a0[0])));
+    } else {
+        v2 = (((v3 % 6) - (v2 % 6)) < ((a1[2][2] >= v3) ? (81 ? v3 : 21) : (50 < v0)));
+        a0[15] = (((52 * v2) || (a0[3] >= a0[4])) * ((v2 ? v1 : v2) ? (a1[3][13] % 7) : (a0[6] <= 7)));
+        v0 = (((a1[3][14] / 5) % 6) / 2);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        a1[2][2] = (((v0 * a0[4]) ? (v2 + a1[3][9]) : (95 + 58)) <= ((v1 / 1) || (a1[1][6] <= 7)));
+        a0[9] = (((94 || v2) - (v1 ? v0 : v0)) - ((41 <= 5) * (v1 == v3)));
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            if ((i6 ? v2 : 68) > 79) break;
+            v2 = (((62 ? 45 : v3) - (i7 || v3)) != ((3 >= v2) <= (v3 || a1[2][5])));
+            v3 = (((v3 != v3) ? (28 > v2) : (i7 > 92)) * ((49 || v1) && (v0 <= a0[13])));
+            v0 = (((0 && 12) <= (a0[10] && v0)) + ((92 >= v2) > (i7 == v0)));
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            {
+                int i9 = 0;
+                do {
+                    a0[4] = (((i9 >= i9) ? (56 / 7) : (a1[3][7] < a1[1][15])) * ((v0 / 6) && (v1 != 42)));
+                    v2 = (((a1[0][6] <= i8) % 6) ? ((a1[0][3] >= a1[3][5]) && (a0[3] > v1)) : ((87 && 73) >= (v2 ? a0[8] : 1)));
+                    v2 = (((v3 > v3) * (i9 * v3)) + ((61 * 78) <= (52 / 2)));
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            v3 = (((a1[3][2] / 8) - (i8 * v3)) && ((i8 && 71) ? (a0[9] != a0[1]) : (24 ? i8 : a0[10])));
+            a0[7] = (((v0 && v3) != (v0 <= 98)) - ((v0 <= 59) < (7 <= v1)));
+            i8 = i8 + 1;
+        }
+    }
+    v3 = (((60 >= 30) || (v3 != 37)) > ((2 - v3) * (v1 ? v2 : a1[3][12])));
+    v1 = (((a0[3] == v1) == (v2 - v3)) != ((63 != a0[8]) >= (v1 > v0)));
+    {
+        int i10 = 0;
+        do {
+            {
+                int i11 = 0;
+                do {
+                    a0[15] = (((v0 + v2) != (i10 <= a0[15])) < ((v3 > a1[2][12]) <= (17 || i11)));
+                    v3 = (((13 + i11) / 1) < ((a0[12] ? 82 : a1[0][14]) ? (98 ? v2 : a1[3][8]) : (v3 > i11)));
+                    a0[9] = (((54 < i10) / 4) <= ((32 > 19) && (a1[0][9] <= 64)));
+                    i11 = i11 + 1;
+                } while (i11 < 4);
+            }
+            v2 = (((71 * v1) <= (37 + 85)) <= ((v1 <= v1) % 9));
+            v0 = (((v3 > v0) && (61 - v1)) / 2);
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    return (((a1[0][3] / 7) != (a1[0][3] + 2)) <= ((a0[1] < a1[3][8]) / 1));
+}
+int f22() {
+    int v0 = 34;
+    int v1 = 78;
+    int v2 = 57;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((84 <= 81) > 78) break;
+        v1 = (((v1 * v0) ? (v2 == v3) : (75 < 6)) || ((v3 <= a1[0][2]) > (v1 < 59)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                a0[6] = (((77 % 1) * (a1[0][9] - 68)) + ((v2 > a0[6]) ? (51 * a1[1][2]) : (v0 >= 58)));
+                v3 = (((v3 > 99) || (v2 >= v0)) % 2);
+                v3 = (((v1 || v0) - (v0 || v2)) ? ((a0[14] * 24) > (a1[0][14] * a1[3][7])) : ((14 ? i1 : i0) * (44 <= a1[3][13])));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((i0 + a0[4]) == (v3 ? a0[14] : 32)) && ((v0 + v0) >= (v1 * 35)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v1 = (((a1[0][0] * v3) == (v3 % 1)) + ((a0[1] ? 17 : 86) + (v1 ? 77 : v1)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((v0 == i2) ? (i2 == v0) : (v0 > a1[0][7])) - ((32 * a0[7]) - (i2 % 2)));
+                a0[4] = (((i2 >= a0[8]) * (v3 == v2)) ? ((i2 / 7) && (36 < v3)) : ((35 - i3) ? (a0[15] && a0[14]) : (43 && 64)));
+                v3 = (((a0[0] ? a1[1][7] : v0) == (13 < v2)) * ((a0[14] % 7) + (73 * a1[1][3])));
+            }
+            a0[6] = (((v3 <= 72) <= (v0 / 1)) ? ((v1 <= a0[5]) == (i2 ? a1[0][13] : v2)) : ((v1 > a1[3][9]) == (v2 == a1[3][10])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 <= v3) == (a0[14] >= v0)) > ((v2 / 5) / 2))) {
+        a0[9] = (((a0[12] > v0) || (v1 < v0)) < ((v2 && v3) % 9));
+        v3 = (((93 * v0) ? (24 - 1) : (v1 <= 70)) / 4);
+        v3 = (((v2 * v3) / 6) < ((v2 >= v1) == (v0 ? v0 : 5)));
+    } else {
+        v0 = (((26 > 4) / 8) <= ((15 % 8) || (v1 <= v0)));
+        v2 = (((a1[1][12] || v1) != (v1 % 1)) != ((32 < a0[0]) == (v3 ? v3 : v0)));
+        v3 = (((10 * v1) * (13 >= v3)) ? ((v0 < a0[5]) || (v2 * a1[3][6])) : ((v2 * a0[0]) == (a1[2][12] < v2)));
+    }
+    a0[0] = (((v2 + v0) <= (v2 - 8)) && ((v3 > 75) || (v2 / 1)));
+    v3 = (((v2 > a0[3]) <= (v3 / 7)) < ((a1[2][7] / 7) || (v1 >= a0[8])));
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((v0 ? a0[4] : 34) > 57) break;
+        {
+            int i5 = 0;
+            while (i5 < 2) {
+                a0[8] = (((46 / 6) && (i5 - v0)) && ((76 ? a1[2][14] : i4) + (i4 > v0)));
+                v2 = (((a1[2][13] - 47) * (61 < i5)) < ((v3 < v0) && (21 - i5)));
+                v3 = (((11 % 5) < (v1 ? 55 : i5)) % 1);
+                i5 = i5 + 1;
+            }
+        }
+        a1[2][7] = (((i4 != v1) > (v2 ? a1[2][8] : v1)) % 8);
+        v1 = (((v0 == a0[5]) - (a1[1][5] == 10)) + ((v2 / 8) != (26 * v0)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        v0 = (((i6 + v3) + (v1 ? 85 : 53)) != ((i6 != v2) + (i6 > v2)));
+        v2 = (((v2 * a0[12]) * (v2 < 91)) > ((a0[0] > a0[11]) + (80 - v1)));
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                a0[9] = (((a1[0][6] - v3) % 5) >= ((a0[3] ? v0 : v1) >= (v2 * 69)));
+                v2 = (((40 >= a1[1][7]) ? (24 >= a1[2][4]) : (v0 + a1[3][14])) && ((i6 || v0) / 9));
+                a1[1][11] = (((a1[3][3] != a1[1][2]) <= (v1 != v0)) ? ((v2 % 2) <= (a0[13] + 41)) : ((52 && a0[6]) < (a0[9] % 8)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            v3 = (((v1 < a0[8]) != (v3 * v1)) <= ((a1[0][14] / 3) * (a0[8] == 9)));
+            a1[1][6] = (((i8 < 70) || (15 ? a0[8] : v0)) == ((i8 && a0[3]) ? (a1[2][4] % 6) : (92 ? v0 : 62)));
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((v0 + v1) <= (i8 < a0[14])) <= ((v3 * i9) - (a1[0][6] || 64)));
+                    v2 = (((i9 > a1[2][7]) < (v2 == v0)) + ((v3 * a0[5]) ? (10 - a0[9]) : (v1 && v3)));
+                    v3 = (((v3 - v1) > (v3 || v0)) ? ((v2 ? a0[2] : v0) && (v3 - v3)) : ((a0[2] && 85) ? (a0[11] > a0[7]) : (i9 / 4)));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    if ((((a1[2][0] >= v0) * (v1 >= v0)) % 9)) {
+        v0 = (((a1[0][5] != v0) + (a1[3][1] * 26)) || ((v3 / 1) > (42 - 58)));
+        a0[11] = (((a1[3][3] ? v3 : v2) == (v0 > v0)) != ((v0 + 94) <= (66 * v0)));
+        v2 = (((v2 <= 75) < (a0[8] ? v3 : 51)) % 9);
+    } else {
+        v0 = (((a1[1][1] ? a0[2] : 59) * (a1[1][0] < 33)) * ((v0 % 6) % 2));
+        v1 = (((v3 ? v0 : a1[3][10]) > (a0[15] % 9)) / 1);
+        v3 = (((v1 >= 48) <= (v3 >= a0[12])) * ((v1 ? v2 : 27) && (v2 ? 44 : v0)));
+    }
+    {
+        int i10 = 0;
+        do {
+            {
+                int i11 = 0;
+                while (i11 < 7) {
+                    if ((83 && a0[5]) > 58) break;
+                    v3 = (((v1 - 31) || (i11 && v1)) >= ((i11 / 7) || (i10 * v1)));
+                    v1 = (((43 || i10) - (51 && i11)) % 2);
+                    v0 = (((v2 - 57) <= (v2 + a1[0][2])) / 4);
+                    i11 = i11 + 1;
+                }
+            }
+            a1[3][9] = (((v3 > 44) * (46 + a0[5])) ? ((v0 ? v0 : 75) >= (19 <= a0[5])) : ((v2 > a0[7]) && (a1[2][8] != v2)));
+            v3 = (((40 < a1[3][12]) ? (a1[1][10] ? 92 : v3) : (30 != i10)) < ((v2 % 7) && (v2 > v1)));
+            i10 = i10 + 1;
+        } while (i10 < 8);
+    }
+    return (((v2 >= v0) != (a1[0][9] >= v0)) / 4);
+}
+int f23() {
+    int v0 = 74;
+    int v1 = 29;
+    int v2 = 27;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    a1[2][10] = (((v0 / 5) ? (73 && v3) : (v2 + v0)) < ((26 * v2) == (v2 < a1[2][14])));
+    {
+        int i0 = 0;
+        do {
+            a1[2][8] = (((v3 < i0) != (44 > v1)) > ((v0 > v0) > (v0 || 11)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v2 = (((v2 > i1) == (i0 > 21)) < ((v3 + a1[3][13]) + (a1[2][9] * a1[3][7])));
+                v2 = (((92 > 9) >= (8 >= v0)) || ((42 * v2) >= (i1 - v1)));
+                v3 = (((6 ? a0[2] : 81) <= (21 || 6)) && ((v3 == i0) != (v1 < i1)));
+            }
+            a0[14] = (((a1[0][1] + a1[1][7]) == (4 % 6)) * ((v1 % 1) / 8));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((v2 <= v0) + (31 > 61)) == ((41 > v1) > (v1 < v0)))) {
+        v3 = (((v0 > a1[1][4]) >= (38 ? v2 : v0)) >= ((80 < v2) && (12 >= 26)));
+        v2 = (((33 != v2) * (a0[14] * v2)) && ((v3 + v0) < (v3 || 73)));
+        v2 = (((v2 ? v1 : v0) + (85 + v3)) && ((a1[3][3] - 83) % 7));
+    } else {
+        v1 = (((v0 / 8) + (v0 + v0)) % 4);
+        v3 = (((75 < 93) != (v0 > a0[11])) && ((a0[3] && v1) / 4));
+        v3 = (((a1[3][11] > v1) * (v2 % 2)) == ((35 >= 69) - (v1 - v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((a0[0] % 6) > 57) break;
+            v2 = (((20 <= 0) ? (v2 / 8) : (a0[11] || i2)) <= ((v3 == 36) <= (v1 / 9)));
+            v3 = (((v1 * v2) % 8) > ((v1 - 0) == (v1 && 62)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v0 = (((43 / 3) / 7) % 5);
+                a1[2][2] = (((i2 + a1[2][8]) < (54 + v2)) == ((a0[8] || a1[3][14]) ? (31 + 91) : (v0 * v1)));
+                a1[1][15] = (((v1 + 13) ? (a0[5] < v0) : (39 ? v3 : i3)) > ((v3 + v1) == (a0[0] ? v1 : i3)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a1[1][10] = (((a1[1][0] || v1) < (v3 % 1)) * ((i4 < v0) && (v3 >= 76)));
+        v1 = (((19 != a1[0][13]) + (i4 > a0[9])) * ((a1[1][12] - a0[7]) <= (v0 ? a1[0][4] : v2)));
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                if ((85 && a0[13]) > 83) break;
+                a1[0][1] = (((50 ? a0[9] : v2) ? (v2 % 7) : (i4 > 60)) >= ((70 - v1) + (v0 == v1)));
+                a0[11] = (((a0[12] < a1[3][3]) * (v3 % 3)) + ((a0[1] % 1) <= (i5 == 50)));
+                v3 = (((v2 <= 57) && (a1[3][0] % 5)) / 9);
+                i5 = i5 + 1;
+            }
+        }
+    }
+    if ((((v3 == a0[14]) == (a1[2][8] >= v1)) > ((46 - v2) || (87 <= 42)))) {
+        v0 = (((a1[3][7] < a1[1][13]) == (v0 ? a0[8] : v1)) >= ((v3 ? a0[0] : v1) > (v1 >= a1[3][2])));
+        v2 = (((8 && a1[3][8]) * (v1 > v2)) > ((v3 % 4) * (v3 && v0)));
+        a0[10] = (((5 + 73) * (v2 > 1)) != ((v3 != v0) * (72 / 2)));
+    } else {
+        v0 = (((62 >= a1[3][4]) == (a1[3][7] == v2)) / 6);
+        v0 = (((23 || a0[0]) && (96 > v1)) / 4);
+        a0[13] = (((68 - a1[0][5]) > (v0 < a0[4])) && ((v3 > 6) > (a0[7] > v3)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[0][11] = (((v0 / 3) * (29 ? 1 : v3)) || ((v0 >= v1) + (v0 ? a1[2][13] : a0[2])));
+            {
+                int i7 = 0;
+                do {
+                    if ((v3 > a1[0][7]) > 83) break;
+                    v1 = (((74 <= 52) == (i6 - v1)) >= ((a0[3] != v2) || (i6 - i7)));
+                    v0 = (((76 - 0) + (v0 && i7)) != ((51 * a0[5]) && (a1[1][5] > a1[3][5])));
+                    a1[1][6] = (((i6 <= a0[3]) ? (29 / 1) : (v2 * a0[13])) || ((v3 && v1) || (a0[4] - v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            v2 = (((v1 <= 73) <= (a1[0][10] + 58)) == ((v1 * v2) / 3));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    v0 = (((a0[15] + v1) && (a1[1][14] ? v3 : v1)) / 9);
+    if ((((v2 + 73) && (2 && a1[0][14])) != ((9 - v1) != (v0 % 9)))) {
+        a1[0][13] = (((a1[1][11] != v1) ? (69 ? 66 : v0) : (v1 / 2)) != ((v3 > v2) ? (80 - v0) : (v2 / 3)));
+        a0[7] = (((29 + v2) > (v1 == a1[3][14])) < ((v2 ? 11 : v3) + (v2 || 34)));
+        a1[1][4] = (((v0 ? v2 : a1[2][14]) || (v1 % 1)) >= ((v1 ? 91 : a0[4]) <= (a1[1][1] ? v3 : 45)));
+    } else {
+        v1 = (((v2 >= 32) - (93 < a1[2][1])) || ((v3 % 2) ? (v1 * a1[0][4]) : (34 / 8)));
+        v0 = (((v2 && v1) >= (a1[2][11] && v1)) == ((a1[0][12] != 37) != (v1 / 7)));
+        v2 = (((2 / 8) - (v2 == v3)) <= ((v2 ? v2 : v1) ? (a0[9] * a0[6]) : (v0 % 2)));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            if ((i8 - 75) > 75) break;
+            a1[0][10] = (((v3 * 27) ? (v1 || v1) : (i8 >= i8)) != ((50 <= 51) >= (v0 / 7)));
+            v0 = (((v0 != v3) - (a0[5] == a0[6])) > ((i8 - v0) > (a0[4] + a1[0][8])));
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                v3 = (((v3 ? v0 : i8) <= (a0[2] == i9)) + ((v2 / 2) || (v3 >= v3)));
+                a0[11] = (((v2 / 8) != (i8 >= 99)) <= ((v3 - a1[3][10]) < (80 >= v0)));
+                a0[9] = (((v0 >= a1[1][9]) ? (a0[0] / 8) : (v2 - 7)) >= ((v2 * 19) && (v0 / 1)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v1 <= v0) > (v2 != v2)) < ((v2 == 98) <= (v0 < v0)));
+}
+int f24() {
+    int v0 = 61;
+    int v1 = 54;
+    int v2 = 14;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 > 13) < (v2 - 8)) < ((v0 * v0) == (v3 == a1[2][6])))) {
+        a1[3][14] = (((30 / 5) % 4) >= ((v0 - v3) < (52 % 5)));
+        v3 = (((47 ? v3 : a1[1][5]) >= (v0 ? a0[9] : 84)) * ((v3 * v3) ? (v1 > v2) : (a1[0][4] * 32)));
+        v0 = (((14 || a0[10]) == (v2 % 3)) == ((v0 * v2) <= (v3 || 18)));
+    } else {
+        v3 = (((86 ? 33 : v3) * (a1[3][4] ? v2 : a1[2][14])) > ((a0[2] / 7) && (a0[2] || a1[1][1])));
+        v1 = (((v2 <= a1[1][1]) > (v2 - v0)) && ((66 == v3) == (v0 + v1)));
+        v2 = (((a0[2] == v3) % 7) ? ((33 - 27) ? (a0[5] > 49) : (16 != v2)) : ((25 / 3) < (a0[14] > v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v1 = (((v1 - v3) > (i0 - a1[3][11])) ? ((a0[13] <= v0) ? (a1[1][7] || v1) : (v0 > v0)) : ((a1[3][3] ? 39 : 44) % 2));
+            v2 = (((v0 == v0) * (56 || v2)) - ((45 == 2) >= (v1 ? a1[1][0] : v3)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((81 - 82) > 81) break;
+                v1 = (((v0 <= i0) * (v1 / 6)) < ((a1[0][1] > v3) || (17 - a1[1][4])));
+                a0[3] = (((i0 / 5) != (i1 % 6)) == ((91 < v3) * (v3 || i0)));
+                v0 = (((0 || v3) / 5) % 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v1 - 7) > 93) break;
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v0 = (((v2 + v3) ? (a1[1][4] < v2) : (i2 == a1[1][11])) > ((a0[7] > 86) * (a1[3][3] ? v2 : a0[13])));
+            a0[0] = (((v0 < i3) || (v0 >= i2)) != ((i2 * i2) || (a1[2][2] * a0[1])));
+            a1[0][7] = (((36 / 8) >= (a1[1][15] > a0[9])) || ((93 / 6) >= (a1[1][4] >= a1[0][14])));
+        }
+        a0[5] = (((v3 <= a0[4]) % 1) * ((a0[15] == a1[2][0]) <= (i2 < v1)));
+        v3 = (((10 < a0[7]) ? (a0[11] && a0[5]) : (a1[0][10] == a1[0][14])) / 3);
+    }
+    if ((((v1 && a1[3][10]) <= (v3 + v0)) >= ((v0 <= v2) == (v3 ? v3 : v0)))) {
+        v3 = (((v1 ? v1 : a1[0][4]) >= (v1 >= a0[14])) > ((v2 == v1) > (94 != a1[0][1])));
+        v0 = (((30 == a1[3][2]) % 8) && ((v3 != 70) * (v0 % 1)));
+        a0[13] = (((v0 + v0) > (34 - v2)) - ((9 ? v1 : v1) >= (v2 * v1)));
+    } else {
+        v3 = (((32 / 4) ? (67 == v3) : (v1 && a1[2][0])) * ((v0 % 8) - (a0[12] == v2)));
+        a0[1] = (((a0[15] - v3) - (a1[0][6] * v0)) % 3);
+        v0 = (((v2 <= 38) || (v2 % 5)) == ((v2 + v0) - (v2 ? v3 : a0[8])));
+    }
+    if ((((a1[3][3] != 51) ? (v1 / 2) : (63 < v1)) ? ((62 <= v2) || (a1[2][5] * v3)) : ((a1[1][4] % 4) ? (a1[2][13] <= v1) : (a0[8] <= a0[3])))) {
+        v1 = (((a1[3][8] ? a0[1] : v2) == (v0 % 6)) <= ((46 + 47) * (v3 - a0[4])));
+        v1 = (((v2 == a1[0][3]) > (v0 ? v3 : 81)) ? ((v1 == a1[0][5]) / 9) : ((a0[5] < v3) + (v3 ? 55 : v0)));
+        v0 = (((v0 / 7) <= (a1[1][7] != 83)) ? ((a0[11] <= 15) * (36 <= v3)) : ((a1[2][14] - a0[3]) <= (85 / 9)));
+    } else {
+        v0 = (((99 ? a1[1][8] : v0) == (a1[2][8] <= a0[0])) * ((v3 == 9) && (v0 + v0)));
+        v2 = (((30 <= a0[14]) > (v2 || a0[4])) == ((7 - v1) * (14 ? v0 : v2)));
+        v1 = (((a1[0][10] / 9) ? (25 >= v2) : (v1 % 3)) % 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            a0[11] = (((a0[1] && a0[2]) % 7) == ((6 > v3) || (v2 + v3)));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                a1[2][10] = (((79 || v2) + (96 != a1[0][10])) == ((24 / 6) || (i4 ? i4 : i4)));
+                a1[0][3] = (((v0 >= v3) / 9) <= ((i5 || v0) < (i4 < i4)));
+                v1 = (((89 > a1[1][11]) || (v1 <= v0)) <= ((a1[0][4] >= 84) * (v3 <= a1[0][2])));
+            }
+            v3 = (((a1[2][12] / 3) ? (v1 >= a0[7]) : (a0[4] ? 27 : v2)) ? ((i4 >= i4) ? (v3 >= v3) : (a1[2][7] > i4)) : ((i4 == i4) % 9));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 || v2) != (a1[3][6] || 1)) ? ((v3 / 6) <= (a1[0][5] == v1)) : ((v1 % 2) % 7))) {
+        a1[1][1] = (((a0[7] >= a0[13]) == (a0[14] >= v3)) % 4);
+        a0[15] = (((v3 || a0[14]) || (a1[1][5] % 9)) ? ((v3 <= a1[3][8]) <= (46 <= a0[1])) : ((v1 ? v1 : v3) > (82 && v2)));
+        a1[0][4] = (((v2 + 85) <= (v3 ? a1[0][11] : 54)) - ((v3 != a1[2][8]) ? (86 > v0) : (v0 - v1)));
+    } else {
+        a1[0][4] = (((71 < v2) > (a0[1] < 84)) % 4);
+        v2 = (((72 && v1) <= (v1 % 9)) % 4);
+        v2 = (((a1[0][9] ? v2 : v0) ? (80 || v0) : (a0[15] < a0[8])) ? ((a1[0][1] || a1[3][13]) + (28 < 76)) : ((v1 * a1[2][9]) != (v0 + v2)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v2 = (((a0[1] >= a1[3][4]) != (9 == v3)) % 4);
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    a0[14] = (((i7 && a0[11]) + (v1 ? a1[2][14] : 80)) - ((i7 == a0[6]) != (v3 != i7)));
+                    a0[0] = (((a1[1][2] + a0[10]) % 5) != ((v3 / 9) && (v0 % 8)));
+                    a1[1][0] = (((i6 <= i7) != (v2 % 3)) - ((v0 + 82) ? (11 ? a1[0][7] : 10) : (a1[0][9] >= v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((52 ? v0 : v2) >= (v3 / 6)) - ((v3 >= a0[1]) && (85 >= 68)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    if ((((v0 ? v1 : v1) > (v3 ? 82 : v0)) / 8)) {
+        v0 = (((63 >= v0) ? (v0 <= v2) : (v3 * v1)) == ((a0[8] || 39) / 6));
+        v0 = (((48 / 5) <= (v3 + v0)) > ((v3 % 7) || (v2 > v3)));
+        v3 = (((a0[3] + a0[5]) < (65 + 81)) + ((a0[4] || a1[1][13]) - (v2 || v3)));
+    } else {
+        a0[9] = (((a1[3][5] <= v2) || (v3 < a1[1][7])) * ((28 + 6) + (a0[14] > v3)));
+        a0[3] = (((a0[1] + a1[3][0]) && (v3 != v3)) < ((47 % 4) && (a0[12] - 15)));
+        a0[1] = (((v3 || v1) + (v0 + a0[10])) == ((66 && v3) < (v3 - v2)));
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((v0 ? a0[9] : a1[1][14]) <= (v2 >= 70)) - ((a1[1][12] || v1) > (v1 % 1)));
+                    a0[5] = (((v2 > v3) == (99 > a0[3])) <= ((i9 / 8) != (i9 + 33)));
+                    v0 = (((v2 + a1[2][1]) == (v0 * i8)) > ((v0 - 99) != (a1[2][4] <= i9)));
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            a0[1] = (((v2 != v0) / 2) ? ((v3 % 7) * (i8 % 4)) : ((v3 >= i8) >= (v0 != a0[6])));
+            v3 = (((36 ? i8 : 16) - (83 % 8)) || ((63 > 37) && (v3 + 38)));
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    return (((v1 == 99) || (v0 < a1[2][4])) == ((v2 ? 75 : a0[0]) + (44 / 1)));
+}
+int f25() {
+    int v0 = 90;
+    int v1 = 77;
+    int v2 = 91;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    a0[14] = (((v0 != v1) + (a1[2][0] == v2)) / 2);
+    if ((((v1 && 96) + (a0[3] != a0[10])) || ((v1 != v3) + (v1 ? 87 : v1)))) {
+        v2 = (((a1[0][0] > v1) == (47 + v1)) == ((95 && v1) || (94 % 3)));
+        v2 = (((53 - a1[2][7]) % 4) != ((66 ? v3 : a1[0][15]) <= (v1 * v2)));
+        a1[2][0] = (((95 > v3) != (a0[7] == v1)) + ((v2 % 6) % 9));
+    } else {
+        v3 = (((v1 && 45) + (a0[14] > v3)) / 2);
+        v3 = (((a1[0][3] / 4) || (a1[0][13] || v3)) <= ((89 * a1[0][12]) < (v0 - a0[10])));
+        a1[0][12] = (((v3 != 49) * (v0 ? v2 : v3)) + ((v1 + v3) > (92 < v2)));
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v1 = (((13 > v1) < (v2 > v2)) < ((75 / 5) && (i0 / 3)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                v2 = (((i1 ? a1[3][15] : v1) ? (46 * a1[3][13]) : (i0 + v0)) ? ((49 <= a1[3][9]) && (a1[3][4] < a0[8])) : ((v3 > i1) >= (37 == a1[1][8])));
+                v2 = (((a0[2] + a1[3][10]) + (a1[2][8] % 6)) <= ((a0[11] <= i0) || (v0 / 4)));
+                v0 = (((70 <= i0) && (v3 * a0[4])) * ((a1[1][3] + 41) - (v1 < a0[13])));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((v0 ? v0 : v1) % 5) ? ((v3 ? 25 : v1) >= (v2 && v0)) : ((v2 * a1[2][13]) - (i0 > 28)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v3 = (((14 < 94) || (8 ? a1[2][5] : v2)) == ((v1 >= v0) >= (87 ? a0[8] : 10)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            if ((a0[13] || v1) > 60) break;
+            v1 = (((a1[3][13] - a1[2][1]) / 8) ? ((a1[1][7] != v0) > (v1 + v3)) : ((a1[1][15] - i2) % 4));
+            v0 = (((v0 <= a0[0]) ? (23 != v3) : (a1[2][15] != v1)) ? ((v2 % 3) / 2) : ((i2 || v0) % 5));
+            v3 = (((i3 < i3) == (31 * v0)) > ((v0 >= a1[3][2]) != (v0 >= a0[0])));
+        }
+        v3 = (((i2 / 8) || (i2 == 8)) == ((v1 + 80) ? (v1 && 35) : (v1 % 6)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v2 = (((v0 % 6) > (75 + a0[14])) > ((a1[1][15] == 55) && (58 || 61)));
+            v0 = (((v0 * i5) >= (15 / 3)) * ((a1[0][8] - a0[2]) ? (a1[3][5] || i4) : (a0[13] != 50)));
+            v0 = (((99 || v2) * (a0[9] + v1)) && ((i4 + 65) || (v3 * 71)));
+        }
+        v1 = (((v0 ? a0[14] : 57) == (22 ? v2 : v2)) != ((a0[11] ? v2 : v2) - (a0[15] + v3)));
+        a1[1][9] = (((a1[3][10] <= i4) < (a0[1] < v1)) / 7);
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        a0[2] = (((27 < a1[0][11]) > (v1 % 2)) * ((a1[1][10] && v0) ? (v2 < v3) : (96 / 2)));
+        v2 = (((10 || v3) && (v1 != v2)) ? ((v0 ? v2 : i6) <= (21 && v0)) : ((57 == 17) * (i6 >= v0)));
+        {
+            int i7 = 0;
+            do {
+                a0[14] = (((12 / 2) == (v1 >= v3)) < ((v0 && a0[1]) || (v2 >= 87)));
+                a1[2][12] = (((39 >= a0[3]) < (a0[0] < v2)) % 7);
+                v0 = (((10 == i6) && (37 * v3)) >= ((a0[1] < v0) * (90 > 2)));
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+    }
+    v2 = (((v0 == v0) / 8) > ((a0[4] < 53) - (v0 != 81)));
+    a0[4] = (((a1[0][7] / 3) || (v2 <= a0[9])) + ((a0[10] >= 54) - (v3 >= a1[1][3])));
+    {
+        int i8 = 0;
+        do {
+            v1 = (((a1[2][10] - v1) - (a0[3] ? v2 : 24)) || ((v2 - 90) && (v0 ? 81 : i8)));
+            v2 = (((v0 ? v3 : 88) == (v1 || v3)) != ((48 ? v3 : v0) ? (45 > 43) : (v2 >= v3)));
+            for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+                v0 = (((v3 % 5) / 6) == ((i9 + a1[0][1]) == (a1[0][11] >= v0)));
+                v0 = (((a1[1][1] ? i8 : a0[0]) != (a0[2] * v2)) + ((28 ? v1 : 11) <= (97 <= i8)));
+                v0 = (((v1 < v2) * (i8 < 43)) == ((v3 ? a1[0][8] : v3) == (v2 < v2)));
+            }
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    {
+        int i10 = 0;
+        do {
+            a1[2][0] = (((v1 > v2) % 8) < ((a0[2] * i10) < (a1[2][4] != v1)));
+            for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+                if ((99 % 7) > 50) break;
+                v0 = (((v1 || v2) / 1) / 6);
+                v2 = (((i10 - a1[2][13]) / 5) || ((a0[14] > i11) <= (i11 <= a1[1][8])));
+                v3 = (((50 && a0[0]) >= (v1 ? v0 : 90)) ? ((v2 >= a1[3][0]) || (a0[12] > a0[5])) : ((a1[1][10] / 4) < (i10 && 26)));
+            }
+            a0[2] = (((48 <= v3) + (12 + v2)) || ((a0[14] * v3) == (a0[1] > a1[2][0])));
+            i10 = i10 + 1;
+        } while (i10 < 7);
+    }
+    return (((a0[1] % 2) || (v3 ? 45 : 10)) >= ((v1 <= 36) + (44 == 42)));
+}
+int f26() {
+    int v0 = 99;
+    int v1 = 2;
+    int v2 = 83;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    a0[15] = (((a0[13] / 7) || (a0[9] > v2)) >= ((v0 <= a0[14]) / 9));
+    v2 = (((v1 ? 91 : 15) || (v0 % 4)) ? ((v0 + 57) != (v2 && v0)) : ((v0 ? v0 : v3) > (a1[0][13] != v1)));
+    if ((((85 ? v2 : a0[1]) <= (v0 && a0[15])) ? ((13 < a1[3][12]) > (v1 == a1[3][8])) : ((v2 && 49) ? (v2 >= a0[12]) : (v1 ? v1 : v2)))) {
+        v0 = (((v2 ? v2 : v1) && (v0 || a0[13])) == ((v2 - a1[3][0]) ? (v3 - v2) : (14 % 2)));
+        a0[8] = (((a1[3][14] > a0[0]) == (3 || v2)) - ((0 % 6) >= (a1[2][4] - v3)));
+        a0[0] = (((v1 % 3) == (v2 && a0[2])) ? ((v2 >= v3) >= (a0[10] ? v0 : a1[3][1])) : ((94 || a0[15]) ? (11 || 96) : (87 * 41)));
+    } else {
+        a0[0] = (((90 ? a1[2][0] : a1[3][10]) > (36 ? 39 : 53)) * ((v1 >= v3) < (72 % 5)));
+        v0 = (((a1[1][15] % 9) >= (14 >= a0[13])) > ((66 < a0[8]) || (v3 - a0[11])));
+        a1[2][9] = (((v0 / 8) / 6) + ((20 ? a1[0][13] : 34) >= (v3 ? v2 : v1)));
+    }
+    v0 = (((v0 > v0) || (a0[4] <= v0)) || ((v1 ? a0[8] : 99) > (97 ? 80 : a0[2])));
+    if ((((v3 % 5) && (76 != a0[5])) ? ((v0 <= a1[0][7]) - (a0[12] - v1)) : ((a0[5] == v2) <= (v0 % 7)))) {
+        v0 = (((v1 % 7) - (25 && v1)) + ((55 ? v3 : 52) - (v2 != v3)));
+        v1 = (((a0[11] * v1) >= (v1 <= a1[0][11])) != ((v2 != a0[3]) != (v0 ? 73 : v1)));
+        v1 = (((a1[3][5] / 1) ? (a0[5] % 4) : (a1[2][9] * v1)) ? ((17 ? v1 : 76) >= (v3 - v3)) : ((v0 < v2) < (25 - a0[8])));
+    } else {
+        v0 = (((v2 <= a1[3][15]) ? (v0 - v0) : (55 >= v0)) / 6);
+        v1 = (((v3 != v3) > (v2 > v2)) > ((68 > 91) != (a1[1][4] == a0[8])));
+        a0[5] = (((v0 <= v0) - (v2 / 8)) || ((v2 > 48) != (a0[5] != v0)));
+    }
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[11] = (((a0[2] && v0) == (v1 < a0[2])) < ((a1[3][12] >= 17) != (i0 == v3)));
+                a0[15] = (((95 && 22) && (47 >= a0[14])) <= ((41 > 35) != (v3 && a1[3][5])));
+                v3 = (((i0 < v2) % 8) % 5);
+            }
+            v0 = (((v3 - a0[5]) < (v1 ? i0 : 47)) % 3);
+            a1[0][8] = (((v2 >= a0[13]) < (a1[0][13] == i0)) % 9);
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((30 ? v3 : 1) ? (v0 - a1[1][8]) : (a0[4] ? v0 : a0[8])) + ((v3 ? a0[1] : a0[4]) + (4 <= v3)))) {
+        v2 = (((v3 * v2) - (v1 + 10)) - ((a1[0][6] <= a1[1][13]) > (v0 * 99)));
+        v1 = (((30 != v0) ? (a0[3] + v3) : (v0 ? v1 : v3)) == ((86 % 6) || (v0 < v2)));
+        v0 = (((v1 < v3) * (v3 == 10)) && ((54 >= v0) ? (a1[3][10] <= v0) : (v1 == v1)));
+    } else {
+        v3 = (((v1 >= v1) > (v2 - v0)) <= ((27 >= a1[2][12]) >= (51 ? v3 : a1[0][5])));
+        a1[2][1] = (((24 || v1) % 5) == ((a1[1][13] < v2) >= (v3 % 2)));
+        v1 = (((v3 < v0) != (v1 + v3)) <= ((v3 != a0[12]) >= (1 >= a0[0])));
+    }
+    if ((((v1 < v2) - (a0[11] || a1[1][6])) && ((v1 && v3) ? (55 * v1) : (v3 * a0[0])))) {
+        v0 = (((a0[10] * v2) == (51 - 70)) * ((v0 || 71) / 6));
+        a1[2][8] = (((v1 ? 63 : v3) != (v2 == v3)) >= ((7 + a0[2]) < (a0[15] * v3)));
+        v3 = (((45 && a0[5]) == (a0[1] < a0[14])) + ((v3 < 90) * (a1[0][5] == v2)));
+    } else {
+        v3 = (((v1 || v0) - (v2 || v1)) == ((v3 >= 48) ? (a1[3][11] ? 38 : v1) : (v2 || v3)));
+        v3 = (((62 * 12) == (72 ? v2 : v3)) * ((6 ? v3 : v3) + (60 - v2)));
+        a1[0][3] = (((a1[3][14] / 1) >= (19 && 49)) < ((v0 != a0[1]) - (v1 + 70)));
+    }
+    if ((((v2 % 9) || (v3 ? a0[11] : v3)) % 7)) {
+        v2 = (((a0[2] + v0) != (v3 * 58)) || ((a0[11] || v2) > (v0 * 57)));
+        a1[1][10] = (((v3 ? 59 : a1[0][8]) > (v1 || v1)) < ((77 + v1) || (v1 % 4)));
+        v3 = (((74 % 1) / 2) && ((a0[6] < a1[1][5]) <= (v0 - a1[1][5])));
+    } else {
+        v0 = (((v2 ? v2 : a0[9]) ? (v2 >= v1) : (86 >= v2)) <= ((53 && v3) != (a0[8] <= v2)));
+        v2 = (((v3 - v2) + (v0 / 7)) - ((a1[1][14] ? 72 : 41) / 4));
+        a0[4] = (((8 - v3) / 2) < ((81 ? a1[3][15] : a0[13]) * (v0 + v0)));
+    }
+    if ((((v3 < a0[5]) && (v1 / 4)) < ((58 && v1) + (v0 == 4)))) {
+        a0[2] = (((v3 >= v3) > (a0[4] % 9)) == ((a1[3][3] / 4) ? (32 - v1) : (a1[3][12] == a1[1][1])));
+        v3 = (((72 <= 40) ? (v2 + a1[3][7]) : (61 > a1[2][15])) ? ((a1[1][6] + v3) >= (31 + 23)) : ((v3 + a0[3]) < (18 - a1[0][5])));
+        a1[0][8] = (((44 >= a1[1][1]) ? (a0[1] ? 36 : v2) : (21 != v2)) >= ((v0 ? v0 : v0) == (v2 == v3)));
+    } else {
+        v2 = (((v2 < 13) == (a0[13] && a0[3])) + ((a0[9] * v2) > (a0[6] - a1[1][7])));
+        v1 = (((v3 < v1) <= (a0[1] % 5)) >= ((v1 ? v1 : v2) / 7));
+        a0[9] = (((v0 != v0) && (v3 ? a1[3][3] : 40)) + ((99 + v2) * (v3 - 13)));
+    }
+    return (((v2 % 3) == (39 < a0[7])) / 2);
+}
+int f27() {
+    int v0 = 70;
+    int v1 = 46;
+    int v2 = 35;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v3 / 4) != (v1 || a0[5])) && ((v3 % 5) * (a0[8] * v1)));
+    {
+        int i0 = 0;
+        do {
+            v2 = (((a1[1][7] != a0[6]) <= (i0 <= a0[1])) <= ((i0 / 2) || (v2 ? 3 : v3)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v0 = (((v1 - 9) != (v0 - i1)) / 9);
+                    a0[15] = (((a0[15] < a0[9]) == (a1[0][14] < 6)) != ((a1[0][13] ? v0 : 65) - (a0[15] + v3)));
+                    a1[0][2] = (((i0 - a0[10]) <= (a1[3][0] && v0)) < ((i1 ? v0 : a0[5]) < (a0[11] * v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v3 == a1[2][8]) + (i0 <= 83)) || ((94 / 8) % 3));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a1[1][8] = (((a1[1][8] ? v3 : i2) * (a1[1][1] - 60)) && ((v2 ? i2 : v3) / 4));
+        v3 = (((a1[0][14] ? v0 : i2) != (63 || v0)) >= ((v3 * 59) && (v3 || a0[11])));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            v0 = (((i2 >= a0[0]) + (i2 + v1)) - ((v0 ? 1 : i3) + (v1 >= v3)));
+            a0[13] = (((v2 >= v1) == (a0[0] * v0)) ? ((i2 + 30) > (i2 == 89)) : ((v2 ? a1[0][5] : i3) > (a0[10] * i2)));
+            v3 = (((v1 - v1) != (v3 + a0[8])) ? ((86 + v2) <= (5 + v2)) : ((a0[14] >= v3) % 9));
+        }
+    }
+    v3 = (((69 == v0) % 6) <= ((40 <= 24) == (83 || v3)));
+    if ((((88 * 87) <= (v1 == v0)) <= ((a1[3][15] ? 27 : a1[1][1]) - (71 ? v2 : a0[1])))) {
+        v3 = (((v0 ? a1[0][2] : v2) <= (a1[2][11] ? v0 : 83)) / 5);
+        a1[1][5] = (((v1 / 6) > (99 && a1[0][2])) - ((63 > 2) - (a0[4] >= v1)));
+        v1 = (((86 >= 84) + (v2 >= a0[10])) % 9);
+    } else {
+        v0 = (((v2 ? a0[13] : v0) || (v3 && 40)) ? ((a1[2][9] < v0) - (a1[0][13] == v1)) : ((v2 != v2) + (v1 != v1)));
+        v2 = (((v3 ? v1 : a0[15]) > (v2 < v3)) / 6);
+        v3 = (((0 || v3) == (a1[3][7] ? v2 : v1)) && ((v1 || v2) * (v2 % 7)));
+    }
+    if ((((a0[3] < a0[3]) <= (a1[3][8] && a0[6])) >= ((v0 <= v0) || (v1 && a1[3][0])))) {
+        v0 = (((v3 + v1) + (a1[1][10] > a0[13])) <= ((a0[1] || v3) > (v2 >= 95)));
+        v3 = (((a1[2][1] ? a0[14] : a0[3]) == (80 || v3)) > ((a0[5] != v3) || (v0 == a1[0][12])));
+        v2 = (((62 && 98) <= (v3 >= a0[10])) % 6);
+    } else {
+        v1 = (((v2 >= v1) % 8) || ((v3 && a1[0][13]) == (a0[8] > a0[2])));
+        v0 = (((a0[11] + v3) != (v2 && v3)) + ((a1[0][3] + a0[1]) % 1));
+        v0 = (((a1[1][10] <= v3) != (a0[1] && v3)) <= ((v0 <= 27) >= (a1[0][5] == v3)));
+    }
+    if ((((v0 || 43) / 4) ? ((2 > 19) < (33 || 61)) : ((v0 + a0[2]) / 8))) {
+        a0[1] = (((72 ? v2 : v2) * (v0 && v2)) / 3);
+        v1 = (((v0 * 65) == (91 - 11)) != ((v0 > 17) == (v2 >= v2)));
+        a1[1][1] = (((v3 < 24) ? (v0 * 23) : (a0[7] ? v2 : a0[5])) <= ((v3 >= v1) == (v3 != a0[2])));
+    } else {
+        a0[4] = (((v3 == a1[2][15]) || (a0[15] == a1[0][4])) == ((v1 * v1) / 6));
+        a1[2][2] = (((a1[3][0] != v2) + (v2 && 36)) <= ((v0 < 27) > (v3 != a1[0][6])));
+        a0[13] = (((33 / 6) > (a1[1][10] != 58)) % 5);
+    }
+    if ((((v1 && 52) >= (89 != a0[9])) >= ((v3 == 37) == (v1 - v0)))) {
+        v1 = (((v1 >= v3) * (v1 <= a1[0][4])) || ((a1[0][7] != v3) == (a1[3][5] % 3)));
+        v0 = (((a0[10] / 9) < (a1[2][7] - 42)) >= ((v2 <= 98) <= (57 >= v2)));
+        v3 = (((47 != a1[3][4]) && (v1 || v3)) - ((v1 / 2) % 8));
+    } else {
+        a1[1][12] = (((v3 < v1) < (7 * v2)) + ((v3 >= 59) + (a0[15] ? v0 : a0[3])));
+        v0 = (((v3 + 55) + (a1[3][0] ? v3 : a1[3][6])) ? ((18 >= 22) > (77 >= 3)) : ((v0 || 56) / 9));
+        v0 = (((v1 * v1) <= (a1[3][10] < a1[2][4])) ? ((49 % 2) && (a0[15] * a1[0][14])) : ((v3 && 68) / 7));
+    }
+    if ((((13 && 13) < (a0[7] + v0)) ? ((v2 * a0[5]) != (65 - v3)) : ((v0 * a0[4]) || (70 != v1)))) {
+        v1 = (((v1 == 80) >= (v3 + a0[1])) - ((v1 >= 9) * (v3 ? a0[6] : a1[0][3])));
+        v0 = (((73 ? v3 : v2) / 9) + ((45 && v2) ? (35 % 3) : (v1 < v0)));
+        v3 = (((v2 - 45) <= (a0[3] - v2)) + ((v2 < v0) ? (a1[2][9] != 25) : (a1[3][15] / 4)));
+    } else {
+        v1 = (((v2 || 25) > (a1[0][10] || v2)) - ((v1 ? a1[2][11] : a0[8]) || (a1[2][4] / 7)));
+        v3 = (((v2 == a0[0]) || (v2 > v1)) / 5);
+        v2 = (((v0 || 26) && (a0[0] >= v3)) && ((a0[4] != v0) || (v1 ? v2 : v1)));
+    }
+    v1 = (((29 - v2) < (v0 && a0[10])) < ((a1[1][1] < a0[15]) || (a1[0][4] || a0[8])));
+    return (((v3 || v1) - (a0[11] > 93)) - ((a0[6] < 21) <= (v0 % 2)));
+}
+int f28() {
+    int v0 = 96;
+    int v1 = 85;
+    int v2 = 44;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a1[1][3] != a1[3][1]) > 91) break;
+            v0 = (((i0 ? 17 : a0[0]) != (v1 <= a1[0][3])) ? ((a1[1][11] ? 30 : a0[4]) ? (v3 + v2) : (40 >= a1[2][1])) : ((95 / 2) + (a0[13] || v3)));
+            v2 = (((a0[2] != v3) < (v3 / 5)) != ((v0 <= v2) ? (v0 * v1) : (69 <= 36)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[13] >= 49) > 76) break;
+                    v2 = (((a0[11] ? a0[6] : 0) == (i0 + 65)) * ((v2 ? i0 : v3) % 1));
+                    v1 = (((a0[12] >= 0) + (61 == 35)) % 6);
+                    v0 = (((i0 * v0) != (92 != a0[10])) + ((v0 > a0[7]) <= (63 % 4)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    a0[12] = (((a0[11] % 1) % 7) || ((v2 <= v3) - (25 < v0)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v1 = (((17 + v2) < (v0 % 3)) || ((v3 && 3) + (25 == 15)));
+            {
+                int i3 = 0;
+                do {
+                    if ((v0 % 1) > 65) break;
+                    v0 = (((v0 != v3) && (v2 / 6)) >= ((a0[14] % 8) % 7));
+                    v3 = (((97 ? 13 : 11) < (i3 ? 92 : v0)) ? ((a0[6] || v2) <= (53 >= v0)) : ((54 + a1[0][4]) >= (v1 * 44)));
+                    v1 = (((v2 || i2) % 1) * ((i2 == v0) <= (a1[2][0] || v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v3 = (((i2 || 78) != (63 < 2)) * ((v3 > v0) == (v2 ? 73 : v1)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            a0[4] = (((6 != 76) && (35 < a1[1][14])) > ((v2 < v1) != (a1[0][3] < i4)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v0 != i5) + (73 < a0[13])) <= ((28 < 92) <= (v1 > i5)));
+                    v1 = (((i5 || 29) % 8) ? ((64 > v1) < (v3 % 7)) : ((v2 >= 58) == (i5 >= v1)));
+                    v1 = (((2 % 7) - (a1[3][13] ? 26 : 62)) || ((22 * a1[3][4]) ? (37 - v3) : (v2 * 4)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v0 = (((5 / 3) ? (v2 * 84) : (a0[5] == a0[6])) < ((a0[14] && i4) ? (v1 != v3) : (v2 > v3)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        v0 = (((v1 * 70) || (v0 && v0)) && ((v1 ? a1[1][2] : a1[0][11]) ? (a0[1] || 69) : (i6 + v1)));
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            v1 = (((v0 > i7) * (i6 && i7)) <= ((59 && 14) > (v1 == a0[0])));
+            a1[2][12] = (((v0 ? v2 : v1) ? (a0[9] || 97) : (26 / 6)) == ((a1[0][0] > v2) * (v0 ? 87 : a1[1][2])));
+            a1[1][0] = (((v3 ? a0[8] : 60) != (v0 <= a0[5])) || ((v3 >= v2) > (v0 == 59)));
+        }
+        v2 = (((v0 < a1[1][3]) / 6) + ((v1 && 6) + (30 ? v0 : 10)));
+    }
+    if ((((1 != a0[6]) <= (v3 * v0)) || ((v0 && 82) >= (91 % 3)))) {
+        a1[2][11] = (((38 && v3) / 3) % 5);
+        v0 = (((67 - v3) <= (67 - a0[1])) && ((v3 > 37) % 7));
+        v0 = (((13 / 8) != (26 - v3)) + ((v1 + v1) < (v1 < v1)));
+    } else {
+        a1[1][6] = (((a1[2][7] <= v1) ? (a1[1][0] >= a0[11]) : (68 > v0)) % 5);
+        v1 = (((54 ? v1 : a0[4]) || (v0 ? 92 : v2)) + ((v0 > 50) - (a1[0][12] && a1[0][5])));
+        a1[0][15] = (((a0[15] <= 35) <= (44 ? 94 : a0[15])) <= ((v1 || v3) && (v1 != a0[3])));
+    }
+    if ((((a1[0][1] > v2) > (v0 / 4)) >= ((v0 ? v2 : v1) > (v0 == a0[9])))) {
+        v2 = (((a0[9] / 6) ? (a0[5] / 6) : (49 < v2)) / 6);
+        v2 = (((v2 ? a0[13] : v3) && (46 > a0[11])) ? ((v1 == v3) || (v2 ? v3 : v2)) : ((4 ? a1[2][13] : 39) / 2));
+        v3 = (((v3 || 10) && (v0 ? a1[1][7] : v1)) < ((v0 >= v2) >= (a0[3] == 70)));
+    } else {
+        v1 = (((v3 && v0) / 5) * ((88 / 1) < (v1 >= v1)));
+        v3 = (((v2 > v2) * (v3 > 42)) <= ((v3 * a1[3][0]) != (v0 + 93)));
+        a1[0][5] = (((v2 ? a0[5] : a0[4]) <= (27 + v1)) || ((v3 != 27) + (a0[3] * 67)));
+    }
+    if ((((v3 * v2) >= (a1[2][4] * 1)) < ((v3 * 90) - (v1 + a0[1])))) {
+        v3 = (((2 <= v3) <= (a0[11] != a0[2])) + ((v2 * v3) >= (v3 || v2)));
+        a1[0][1] = (((v0 >= v2) && (v0 <= 70)) - ((a0[12] % 5) == (v0 ? v2 : v3)));
+        a0[6] = (((86 >= 84) && (v0 < 87)) % 8);
+    } else {
+        v3 = (((16 == 72) >= (v3 * a0[7])) % 1);
+        v3 = (((97 > a1[2][1]) - (97 ? v1 : a0[4])) >= ((a0[4] != a1[2][0]) || (v3 > v3)));
+        v2 = (((v1 ? v0 : v1) <= (85 == a1[2][9])) % 2);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 3) {
+            v0 = (((v1 ? v3 : v2) ? (v3 >= a0[14]) : (v3 > v0)) ? ((v0 - a1[2][3]) || (v2 - v1)) : ((v1 % 4) && (a1[1][11] - i8)));
+            a1[2][2] = (((i8 - 34) < (v2 / 7)) ? ((i8 || v2) ? (1 ? v1 : v0) : (12 <= a0[14])) : ((v1 == 83) * (v3 < a0[12])));
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                v0 = (((i9 <= v2) <= (49 ? 96 : 86)) * ((a1[3][0] ? i9 : v1) - (77 ? v0 : i9)));
+                v3 = (((87 >= v1) != (a0[0] != v1)) < ((43 ? 21 : v1) && (a0[9] > a0[10])));
+                a1[0][10] = (((96 && 88) ? (a0[7] >= 14) : (v0 - a1[1][7])) >= ((v1 - a0[5]) >= (v2 || i9)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    a0[7] = (((28 * v2) == (v3 >= v0)) && ((33 >= 95) - (a1[3][2] && a0[9])));
+    return (((a1[2][7] - 17) / 3) != ((a0[11] || v2) != (a0[14] <= v1)));
+}
+int f29() {
+    int v0 = 89;
+    int v1 = 13;
+    int v2 = 65;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v0 * v3) && (a1[0][8] || v2)) <= ((40 != v1) != (v0 && v3)));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a0[10] ? v0 : v1) > 97) break;
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                a1[1][3] = (((i1 && v0) < (i0 != a0[15])) && ((a0[0] - 64) * (89 < i1)));
+                v0 = (((a1[3][8] * 49) - (v2 && v3)) == ((91 + v0) - (v1 >= v0)));
+                a0[4] = (((a1[1][4] || 57) / 1) || ((i1 < a1[0][10]) % 6));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((v0 || a0[12]) <= (v1 || 92)) * ((v1 - i0) && (a0[7] == 79)));
+        v1 = (((26 <= v0) != (a0[14] - i0)) <= ((v2 != v3) + (a1[2][5] && 87)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((72 != a0[6]) || (a0[8] / 6)) < ((94 - 64) || (a1[1][14] / 7)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v2 = (((v1 % 3) ? (v2 >= v3) : (v1 % 1)) == ((a1[0][10] <= i3) / 3));
+                    v3 = (((v2 >= v2) - (63 == v1)) + ((v0 == i3) * (v2 ? v1 : v1)));
+                    v2 = (((a1[1][2] ? v2 : 88) ? (v0 * i2) : (a0[2] + 53)) - ((v2 >= v1) >= (a1[2][12] || v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[3] = (((v2 % 7) ? (v1 > 54) : (62 >= 21)) + ((55 ? v1 : v2) > (v2 % 5)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v2 = (((a1[3][4] != v0) < (84 % 3)) ? ((v1 - 9) * (a0[2] <= 70)) : ((59 == v0) != (v2 ? 0 : v2)));
+            v2 = (((60 > a0[1]) ? (a1[1][10] || a1[2][8]) : (v1 / 2)) >= ((a1[0][13] % 6) ? (v1 >= 10) : (i4 >= v2)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((a1[3][2] ? v0 : a0[11]) > 63) break;
+                    v3 = (((a1[0][3] == a1[1][8]) == (i5 > v2)) < ((v0 + 72) == (41 >= v2)));
+                    v0 = (((a0[1] * i4) + (i4 + v3)) + ((a0[1] + a1[2][9]) - (88 >= 98)));
+                    a0[8] = (((79 <= v1) + (i5 > v2)) / 3);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v1 = (((v1 != 72) >= (3 != v2)) ? ((a1[0][11] == v2) * (a1[0][2] <= 91)) : ((80 != a1[3][6]) < (a1[3][12] >= a1[1][14])));
+            v3 = (((a0[12] || a0[8]) || (61 + v0)) || ((a1[1][13] - v3) * (40 + 37)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v1 = (((84 / 3) - (a0[0] >= v2)) % 6);
+                    a1[0][7] = (((v1 - a1[2][5]) / 8) >= ((a1[0][5] + v3) / 8));
+                    v0 = (((v0 + a1[2][10]) % 7) || ((a0[11] - a0[15]) ? (v3 ? v3 : a0[4]) : (v3 <= 74)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        v3 = (((v0 ? a0[14] : i8) > (a1[1][0] - a0[0])) * ((a0[6] % 5) / 8));
+        a0[9] = (((v3 + v3) <= (7 ? a0[3] : 96)) ? ((v3 || a1[1][5]) ? (69 * i8) : (a0[8] % 8)) : ((v3 % 3) != (v2 < v1)));
+        {
+            int i9 = 0;
+            while (i9 < 3) {
+                if ((v0 + 52) > 96) break;
+                a0[13] = (((a1[3][10] / 4) && (a1[0][13] && i8)) > ((90 <= 29) + (37 || 28)));
+                v2 = (((v0 * v1) < (a1[3][7] && a0[4])) % 1);
+                a0[0] = (((42 || i9) / 2) / 9);
+                i9 = i9 + 1;
+            }
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 3) {
+            a1[0][12] = (((v1 != 10) % 3) - ((v0 ? a0[15] : v3) == (v3 <= 18)));
+            {
+                int i11 = 0;
+                do {
+                    if ((30 ? a0[3] : v3) > 76) break;
+                    a1[1][0] = (((v1 <= 42) ? (a1[0][7] && i10) : (i10 == v3)) / 7);
+                    a1[2][14] = (((v3 || v2) + (v0 < 7)) == ((a1[2][1] ? 51 : a1[2][0]) && (v1 / 5)));
+                    v3 = (((v1 > 55) / 3) ? ((a1[0][0] >= a1[2][13]) < (96 == i10)) : ((i11 && 43) - (i11 <= a1[2][6])));
+                    i11 = i11 + 1;
+                } while (i11 < 2);
+            }
+            v3 = (((v3 - i10) * (a1[0][2] == a1[2][14])) < ((75 < 93) || (v2 >= i10)));
+            i10 = i10 + 1;
+        }
+    }
+    {
+        int i12 = 0;
+        while (i12 < 7) {
+            {
+                int i13 = 0;
+                do {
+                    if ((i12 - v1) > 62) break;
+                    v3 = (((60 >= v2) <= (a0[0] > i13)) >= ((a0[0] + a1[0][11]) && (v0 || 36)));
+                    v1 = (((47 < v2) && (i13 * 92)) > ((a1[3][3] < v1) != (v1 && v0)));
+                    v1 = (((a1[3][1] > i13) + (i12 <= a0[12])) + ((10 || v3) / 7));
+                    i13 = i13 + 1;
+                } while (i13 < 8);
+            }
+            v1 = (((i12 > v1) == (i12 ? 73 : a1[1][14])) ? ((a1[3][6] - v2) ? (a1[0][6] == 21) : (a0[10] + v1)) : ((a0[12] ? a1[2][11] : v3) || (a1[0][4] < 0)));
+            v1 = (((v3 ? 36 : v2) || (i12 > v3)) / 9);
+            i12 = i12 + 1;
+        }
+    }
+    for (int i14 = 0; i14 < 2; i14 = i14 + 1) {
+        {
+            int i15 = 0;
+            do {
+                v0 = (((v0 > v3) ? (v2 && v3) : (a0[4] / 9)) && ((85 == v3) + (i14 != v1)));
+                v3 = (((i14 - a1[3][8]) || (26 ? a0[8] : v3)) * ((v0 == a1[2][10]) <= (76 * a0[0])));
+                a0[11] = (((i15 ? a1[2][15] : v1) - (i15 <= v2)) * ((i14 && v2) ? (v2 * i14) : (7 / 8)));
+                i15 = i15 + 1;
+            } while (i15 < 7);
+        }
+        v1 = (((i14 != v2) || (i14 != i14)) >= ((a0[11] / 9) ? (i14 || 93) : (v3 + v0)));
+        v2 = (((v3 + i14) >= (i14 <= a0[8])) - ((49 && v2) / 2));
+    }
+    if ((((v2 > v0) >= (v2 && a1[3][8])) <= ((a0[8] / 6) % 4))) {
+        v2 = (((a1[3][4] / 5) ? (v0 >= 2) : (v0 <= v1)) <= ((22 - a1[2][15]) >= (v2 * a1[3][6])));
+        a0[6] = (((v1 % 7) || (a1[2][1] > v3)) > ((v2 / 9) ? (a0[7] < v0) : (a1[3][12] < v2)));
+        a1[3][0] = (((v3 ? v3 : 76) ? (v2 != v3) : (v2 > v0)) * ((v0 % 4) || (v2 >= v0)));
+    } else {
+        a0[6] = (((v2 < a1[0][11]) || (v3 <= v0)) > ((39 ? v0 : v0) > (a0[8] > 76)));
+        a0[8] = (((a0[8] != v3) || (a0[5] % 6)) ? ((79 / 3) - (v2 ? v0 : a0[7])) : ((97 + 83) || (a0[3] + a0[15])));
+        a0[3] = (((11 == v2) % 1) >= ((v2 != v0) / 2));
+    }
+    return (((a0[11] > a0[9]) / 7) + ((v3 >= v3) + (a1[2][8] != a1[2][0])));
+}
+int f30() {
+    int v0 = 91;
+    int v1 = 26;
+    int v2 = 58;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v3 = (((i0 == i0) || (27 ? 88 : i0)) % 7);
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v1 = (((a1[3][13] < 94) >= (a1[1][5] + i1)) || ((v1 - a0[4]) == (i1 % 5)));
+                a0[3] = (((v2 % 1) != (94 % 6)) % 1);
+                v2 = (((94 != a0[9]) > (i0 >= a1[3][14])) % 2);
+            }
+            v3 = (((90 && v3) ? (v3 ? a1[3][15] : 91) : (a0[1] - v1)) % 7);
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((60 || a1[3][11]) > (42 * a1[1][11])) ? ((v3 + v1) == (7 % 8)) : ((v1 + v0) ? (88 ? v0 : a0[10]) : (v3 < a1[2][0])));
+    v0 = (((v0 % 3) <= (v0 > v2)) <= ((a1[1][9] || a1[0][15]) <= (v0 == v0)));
+    if ((((a0[11] == a0[6]) ? (v2 - 53) : (a1[1][13] != v3)) <= ((v2 || v1) % 6))) {
+        v0 = (((50 == v3) % 7) < ((v1 == 95) ? (v2 + 33) : (97 - v2)));
+        a1[1][13] = (((73 ? 13 : v0) != (v0 == v2)) > ((v2 >= a1[0][2]) + (33 / 3)));
+        a1[0][1] = (((v0 - v2) ? (v3 - 87) : (a1[2][3] ? v2 : 63)) >= ((73 * 36) <= (v0 / 4)));
+    } else {
+        a1[1][15] = (((a0[4] - a0[4]) / 9) % 5);
+        v1 = (((v1 && v3) * (59 != v0)) + ((a1[0][2] < 77) % 4));
+        v1 = (((v0 - 66) <= (0 < v2)) != ((98 < a1[1][11]) < (v3 && a0[8])));
+    }
+    if ((((v1 != 53) && (v1 ? v0 : 10)) != ((48 == a0[11]) * (v3 ? v2 : v2)))) {
+        a0[14] = (((v3 >= 96) == (v0 == 21)) / 9);
+        v2 = (((34 >= 76) && (5 > v1)) || ((v3 < v2) + (10 ? v1 : v2)));
+        v0 = (((v2 != v3) ? (v0 - a1[1][0]) : (69 != v2)) <= ((a1[0][1] || 24) - (v0 <= v2)));
+    } else {
+        v1 = (((64 != a1[0][8]) || (v0 < v2)) * ((v2 || v2) + (a1[1][1] - v2)));
+        v2 = (((v1 < v0) && (a0[0] * v1)) == ((v3 / 6) * (v2 + a0[0])));
+        a0[5] = (((a0[0] + a1[2][3]) > (v1 / 1)) ? ((87 + a0[3]) < (v2 && a0[5])) : ((v0 && v2) == (v2 * a0[2])));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v2 = (((v3 >= a0[9]) <= (a0[7] + v2)) % 2);
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            a0[8] = (((a1[0][12] < v3) ? (i2 && v1) : (38 % 6)) || ((v3 > v3) ? (84 != 77) : (i3 || 26)));
+            v2 = (((v1 < i3) ? (v1 / 1) : (a1[1][11] && i3)) && ((a1[1][6] <= a1[2][11]) < (v2 ? 92 : 75)));
+            a1[1][5] = (((v2 * 21) + (21 <= i2)) != ((v2 >= i3) > (43 == v1)));
+        }
+        v0 = (((66 * v2) % 4) <= ((a1[3][12] && 79) > (i2 * 80)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((37 * 45) + (v2 && v1)) == ((a0[6] <= v1) + (v2 ? a1[1][7] : v2)));
+                    a1[2][15] = (((a1[0][0] < 77) != (v0 > i5)) > ((v0 % 6) ? (i5 >= i4) : (a0[6] * v1)));
+                    v0 = (((v3 < 93) && (45 != i5)) == ((17 ? i5 : v0) && (90 - 83)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[11] = (((i4 >= v2) ? (v0 / 8) : (v2 > v1)) < ((22 ? a1[1][9] : v2) ? (82 != 84) : (23 - a0[11])));
+            v1 = (((a1[3][11] == a1[2][11]) + (v1 - v1)) - ((v2 ? v0 : v2) ? (v2 ? 17 : a0[7]) : (v0 >= 19)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v0 = (((v3 / 4) * (47 ? a1[2][3] : v1)) == ((i6 || v2) + (v3 == 75)));
+        a1[1][0] = (((v0 && 85) ? (v3 % 3) : (a1[0][10] >= a1[1][12])) ? ((a0[13] == a1[2][4]) >= (a1[0][11] * i6)) : ((v0 / 4) ? (v1 - a1[2][14]) : (2 - v1)));
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            if ((v1 > a1[0][4]) > 89) break;
+            v0 = (((v3 < v1) || (v1 - 73)) + ((i7 > a0[13]) && (a0[5] + v1)));
+            v0 = (((v3 - i7) == (v1 * 80)) / 7);
+            v3 = (((i7 / 3) != (37 ? v0 : a1[0][14])) / 2);
+        }
+    }
+    v3 = (((v0 > v2) && (54 ? 53 : v0)) >= ((a1[1][4] && v1) / 1));
+    if ((((15 - v3) && (v1 % 8)) <= ((14 >= v3) + (v0 >= v0)))) {
+        a0[13] = (((84 ? a1[1][2] : v0) / 3) * ((v2 ? v3 : a1[0][15]) || (v1 >= 83)));
+        v0 = (((31 + v0) < (v1 == v3)) * ((79 - v1) - (v2 * a0[1])));
+        v3 = (((v2 / 4) - (v0 <= v3)) * ((v1 * 60) <= (4 ? v3 : a0[8])));
+    } else {
+        v0 = (((68 >= v1) >= (v3 == 26)) * ((v0 ? v3 : v3) + (76 ? v3 : v0)));
+        v3 = (((v3 / 1) == (v0 ? v2 : a0[1])) * ((38 * 72) / 1));
+        v3 = (((a1[2][14] && a0[6]) ? (79 == a0[8]) : (73 / 8)) ? ((36 ? 71 : a0[10]) >= (a0[2] ? v3 : 36)) : ((v0 - a1[2][6]) && (0 - 33)));
+    }
+    return (((97 < 32) ? (v2 < v1) : (v0 - a0[9])) >= ((a0[1] ? v3 : v1) || (a1[0][4] / 5)));
+}
+int f31() {
+    int v0 = 6;
+    int v1 = 97;
+    int v2 = 71;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a0[7] || v1) > 54) break;
+            v2 = (((a1[2][4] >= a0[8]) != (57 > v1)) >= ((17 * 49) % 6));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v3 = (((a0[13] < a1[3][5]) && (i0 / 6)) - ((v1 + i1) > (v0 - 76)));
+                    v3 = (((a1[2][11] <= 21) && (i1 ? i0 : 47)) / 3);
+                    v0 = (((v1 + 22) * (v3 * 58)) - ((v2 % 9) * (v0 ? 11 : v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][5] = (((76 - v1) >= (18 + a1[0][13])) / 5);
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((70 / 3) >= (v1 >= a1[1][12])) < ((25 < 6) / 6))) {
+        a1[2][10] = (((a1[0][1] % 9) * (a0[6] / 1)) >= ((53 >= a1[1][4]) - (15 * v2)));
+        v1 = (((v3 ? a1[3][5] : v1) >= (a0[7] ? a0[0] : v2)) != ((32 ? v3 : 52) == (34 - 3)));
+        v3 = (((v3 > 53) / 3) + ((v0 * v1) <= (a0[1] - v3)));
+    } else {
+        v2 = (((v2 + v2) > (v0 && a1[2][5])) - ((a0[14] >= v3) / 8));
+        v2 = (((a0[7] != v3) == (v2 > 21)) >= ((72 >= v0) % 7));
+        v2 = (((53 != v3) - (v3 ? a0[11] : v1)) != ((2 + v0) >= (v2 || v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            a1[0][6] = (((26 * v0) && (v1 - a0[12])) + ((v3 % 6) != (v0 >= v1)));
+            v3 = (((v1 + v1) == (a0[1] == 7)) != ((v2 < v1) ? (v3 < a0[13]) : (a1[3][11] == v2)));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((i2 - i3) <= (35 + 17)) ? ((v3 - 77) % 3) : ((a0[1] && i3) - (v2 > i2)));
+                    a1[0][9] = (((i3 <= 56) ? (v0 > 80) : (v2 / 1)) > ((a0[1] + a0[9]) || (v2 + a1[1][3])));
+                    v1 = (((77 / 2) - (a0[5] != 35)) + ((a0[11] / 7) && (i3 >= v2)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v0 = (((i5 <= a1[3][2]) + (i4 / 3)) != ((i4 != a1[2][11]) < (v2 == 64)));
+                    a1[1][5] = (((a1[2][5] - a1[2][5]) == (i4 % 2)) ? ((v0 || a1[0][2]) < (63 + a1[2][3])) : ((v0 / 6) <= (v3 != a1[1][8])));
+                    v2 = (((v2 ? a1[1][6] : a0[1]) - (v1 ? i4 : a1[0][2])) * ((v0 >= 9) - (20 >= a1[2][0])));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((7 <= 5) <= (34 > 89)) <= ((a0[15] - a0[0]) % 6));
+            v0 = (((a0[3] && v2) + (92 / 4)) < ((a0[7] >= 47) * (76 != v3)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 % 9) % 9) > ((29 % 9) || (v1 <= v0)))) {
+        v0 = (((v1 < a1[3][14]) + (v3 >= v0)) != ((v2 ? v2 : a1[0][4]) + (v3 / 2)));
+        v1 = (((v1 % 4) == (v0 - a0[9])) && ((v1 / 5) * (v1 ? v0 : a1[0][8])));
+        v3 = (((a1[3][10] <= v3) >= (15 > v2)) && ((16 - v3) == (a1[3][12] - 66)));
+    } else {
+        v0 = (((a1[3][1] <= 31) <= (v1 != 3)) <= ((v0 / 7) != (93 <= a0[11])));
+        v2 = (((a1[0][13] || a0[9]) % 9) + ((v0 > 89) ? (39 && v0) : (a1[1][4] / 5)));
+        v3 = (((36 % 5) / 9) / 3);
+    }
+    v3 = (((v2 > v3) >= (v2 - v1)) == ((79 == v2) || (a1[2][15] != 95)));
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((i6 >= a1[3][6]) > 98) break;
+        v2 = (((a1[2][10] < a0[12]) / 4) != ((v1 >= v0) - (i6 || v1)));
+        v3 = (((a0[11] ? a1[1][13] : v3) == (20 || 12)) || ((a1[2][13] ? a1[1][15] : v2) && (5 <= v3)));
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            a1[1][5] = (((v1 || a0[9]) || (v1 - i7)) % 9);
+            a1[0][1] = (((v2 / 3) ? (a1[1][4] || v0) : (v3 != v1)) == ((a0[12] && a1[0][11]) - (i7 * a0[4])));
+            a0[2] = (((i6 / 6) > (v3 < a1[3][8])) < ((a0[15] > a0[5]) || (a1[3][15] > 84)));
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v0 = (((a0[8] * a1[2][0]) ? (v3 + 78) : (a1[3][10] ? a0[3] : i8)) - ((v1 || 21) < (96 == v1)));
+            {
+                int i9 = 0;
+                while (i9 < 6) {
+                    a0[11] = (((v3 == i8) || (v3 || v1)) == ((v2 != 5) != (v3 && i8)));
+                    v2 = (((i9 != a1[1][0]) * (i8 || v3)) / 5);
+                    a0[0] = (((86 - v3) + (16 || v3)) - ((a1[1][12] > a0[8]) - (a0[10] <= a1[1][1])));
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((a0[4] + 60) - (v0 <= 67)) + ((a0[5] < 14) % 1));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    {
+        int i10 = 0;
+        do {
+            v3 = (((a1[3][0] < a0[1]) - (v2 + 52)) ? ((v3 % 9) - (86 - 19)) : ((v3 ? 70 : a0[14]) < (v3 || 13)));
+            a1[1][11] = (((v2 * 12) == (a0[4] <= v1)) - ((v3 - i10) && (i10 != v2)));
+            {
+                int i11 = 0;
+                while (i11 < 8) {
+                    v1 = (((v2 == 23) % 9) <= ((a0[1] ? i10 : a1[0][3]) * (a1[0][3] >= 0)));
+                    v3 = (((v3 == v2) && (v2 / 1)) >= ((18 / 4) % 2));
+                    a1[0][1] = (((v1 - v2) % 1) >= ((v1 / 7) ? (a1[2][9] <= v2) : (a1[2][8] != i10)));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        } while (i10 < 4);
+    }
+    {
+        int i12 = 0;
+        do {
+            for (int i13 = 0; i13 < 8; i13 = i13 + 1) {
+                a0[12] = (((v2 % 3) == (i12 != i13)) + ((a1[3][9] / 9) >= (12 <= v3)));
+                a0[4] = (((i13 <= 70) > (a0[6] ? v3 : i13)) * ((v0 ? a0[13] : v1) && (76 + a1[1][11])));
+                a1[1][15] = (((v3 / 5) ? (i12 - a1[3][3]) : (87 > v3)) == ((66 == i13) ? (a0[11] > 12) : (i13 % 2)));
+            }
+            a1[3][1] = (((30 + v3) ? (a0[4] - a1[3][0]) : (v1 % 4)) && ((84 / 3) * (i12 != v3)));
+            v1 = (((a0[11] != v2) >= (v3 == v1)) || ((v0 == v2) * (a0[5] >= v1)));
+            i12 = i12 + 1;
+        } while (i12 < 6);
+    }
+    return (((v3 ? v0 : a1[1][14]) ? (12 && a1[2][15]) : (a0[6] + v3)) % 1);
+}
+int f32() {
+    int v0 = 9;
+    int v1 = 31;
+    int v2 = 75;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][9] = (((a0[11] % 7) ? (a1[2][5] ? v2 : 71) : (a0[2] / 4)) || ((v1 * 8) - (28 + i0)));
+            a1[2][0] = (((37 % 8) || (v0 % 2)) * ((v3 - a1[2][12]) > (a1[1][0] != 47)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((85 ? i0 : v1) && (v2 < 74)) && ((i1 && 96) * (v2 == v3)));
+                    v2 = (((v1 - a1[0][7]) || (v3 % 7)) + ((i0 > a1[1][4]) < (i1 ? v2 : 86)));
+                    v1 = (((v3 < 40) / 3) || ((i1 > i0) <= (a1[0][8] || 32)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            a0[2] = (((v1 ? i2 : a0[5]) < (v0 > 31)) + ((v1 == i2) >= (v2 >= v1)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v2 = (((v0 ? v0 : i3) * (72 && 88)) * ((83 != a1[0][12]) ? (a1[0][14] + 46) : (i3 % 8)));
+                    v2 = (((v1 % 4) <= (v2 > v2)) || ((i3 != 1) < (v1 ? 59 : a0[15])));
+                    v2 = (((i2 != v2) >= (v1 > i3)) ? ((a1[3][1] && i3) <= (v2 && v2)) : ((v2 >= v0) ? (a0[11] <= a1[0][0]) : (54 % 9)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((a1[3][11] > i2) + (a0[9] + a1[2][6])) == ((42 ? v0 : 60) <= (a1[3][7] == v3)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v1 = (((a0[14] != a0[11]) % 4) / 9);
+            {
+                int i5 = 0;
+                do {
+                    a0[6] = (((v1 % 4) == (v1 % 9)) && ((27 || 43) / 3));
+                    v2 = (((i5 * a1[2][12]) - (a1[3][5] == a0[12])) != ((v0 > a1[3][10]) ? (v1 ? 16 : v0) : (a1[3][5] * i5)));
+                    a1[0][1] = (((v2 + a1[0][6]) ? (a1[2][4] || v3) : (12 * v1)) && ((12 - a0[5]) - (a1[0][0] / 9)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a0[13] = (((v1 * v1) * (v3 != v0)) < ((41 * 51) % 5));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            a0[0] = (((v3 && i6) < (v1 > v0)) || ((v0 && a0[7]) - (86 || 39)));
+            a0[11] = (((v3 ? v2 : i6) + (v3 < v3)) + ((i6 > a0[2]) + (74 <= 85)));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    v2 = (((18 <= i7) == (a1[2][0] * i6)) && ((v3 > i6) || (i7 - v1)));
+                    v0 = (((i7 % 1) % 8) + ((79 + 26) < (80 ? v1 : a0[12])));
+                    v2 = (((v3 - a0[5]) % 9) <= ((v1 + 75) ? (a1[1][7] > a0[7]) : (a0[8] <= v1)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v3 = (((85 / 5) <= (5 != v2)) && ((v3 >= v3) ? (v0 && v1) : (86 < a1[2][13])));
+    v1 = (((v3 % 5) ? (v3 + v2) : (v0 > 55)) ? ((93 > v0) + (57 < 88)) : ((v1 * 10) >= (v3 > a1[2][5])));
+    if ((((9 == v3) ? (v2 ? v2 : v3) : (a1[1][2] <= a1[1][7])) ? ((a1[0][2] + v0) != (v0 > 58)) : ((v0 + 51) ? (v3 + v3) : (v1 / 2)))) {
+        v3 = (((a0[12] < v2) > (57 % 9)) - ((63 * a0[2]) > (v0 / 5)));
+        v0 = (((v3 / 6) && (13 <= v1)) > ((v1 || a1[2][10]) - (v2 || 96)));
+        a0[3] = (((v1 >= a1[3][3]) + (v0 + v2)) - ((a0[9] ? 72 : v1) % 2));
+    } else {
+        v0 = (((a1[3][4] != 87) >= (a1[2][9] ? a1[3][14] : a0[14])) >= ((v3 - v1) % 6));
+        v2 = (((a0[3] / 1) / 9) + ((a1[3][8] % 4) > (v0 ? 25 : 18)));
+        a1[1][14] = (((v3 - v3) % 4) && ((v0 || 28) || (v1 != 5)));
+    }
+    v0 = (((a1[0][13] == v1) || (v1 > a1[1][9])) >= ((v3 != v3) - (v0 / 7)));
+    if ((((a1[1][11] && v0) && (a0[13] ? a1[0][15] : 19)) && ((a0[9] ? v1 : 66) || (v3 % 9)))) {
+        v0 = (((v2 ? v2 : v1) / 7) <= ((v2 % 3) <= (a1[3][1] ? v1 : v0)));
+        a1[3][5] = (((v2 != a0[9]) < (v1 <= a0[1])) ? ((v0 < a0[4]) == (v3 >= v1)) : ((v2 * v3) - (35 > v1)));
+        v3 = (((a0[4] ? a1[0][0] : 94) != (v2 ? 81 : 29)) * ((92 + v0) + (82 < v3)));
+    } else {
+        a0[14] = (((25 > v3) > (a1[3][0] >= 21)) - ((4 / 5) / 7));
+        a1[3][6] = (((v0 == v0) / 9) * ((v2 || v2) >= (a1[0][5] ? 67 : v2)));
+        v0 = (((85 != v3) * (a1[3][3] * v2)) <= ((v1 - v3) && (v3 - 79)));
+    }
+    if ((((v0 && v3) - (27 < 36)) ? ((v3 <= a0[11]) % 4) : ((a0[15] * a0[12]) % 7))) {
+        a1[0][1] = (((38 ? v0 : v2) + (23 || v0)) > ((v3 >= v3) - (v3 < a1[1][6])));
+        v0 = (((54 + v2) % 1) % 9);
+        v0 = (((v1 + v1) && (a1[0][1] != a1[0][7])) != ((v1 ? 53 : a1[3][8]) ? (35 - v2) : (a1[3][8] > a0[3])));
+    } else {
+        v2 = (((28 >= v0) - (a0[1] ? a1[0][5] : 91)) / 4);
+        v3 = (((v3 <= v0) <= (50 / 1)) - ((a0[3] > v2) >= (v3 || 85)));
+        v0 = (((v3 == a1[3][6]) + (v2 >= v0)) >= ((v3 / 6) % 3));
+    }
+    return (((a0[2] ? a1[1][1] : v3) ? (v2 && v1) : (85 - v2)) - ((87 == v3) / 2));
+}
+int f33() {
+    int v0 = 28;
+    int v1 = 68;
+    int v2 = 54;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 + v1) - (v1 * v1)) != ((v1 <= v1) != (v0 || a0[15])))) {
+        a0[13] = (((v0 - v1) >= (66 > v2)) != ((72 - 91) > (24 + 76)));
+        v0 = (((v2 <= 75) == (16 <= 92)) || ((a0[1] || v1) - (v2 == a1[3][0])));
+        v0 = (((58 == a0[0]) + (v0 > 56)) * ((a1[3][0] % 5) % 6));
+    } else {
+        v1 = (((v1 == v0) + (a1[2][4] == v1)) >= ((53 && v1) < (v0 % 8)));
+        v1 = (((v0 || a1[0][3]) > (a0[9] < v0)) < ((a1[2][2] >= a0[0]) / 6));
+        a1[1][6] = (((v0 != a0[12]) || (a0[3] && a1[2][8])) ? ((v0 || v1) % 6) : ((a1[3][4] ? 31 : v0) ? (a1[2][10] || v0) : (v3 != 0)));
+    }
+    if ((((v2 || v1) >= (v1 >= a0[9])) > ((51 != v3) == (a1[0][2] <= a0[10])))) {
+        v2 = (((v0 || 3) % 8) == ((a1[0][1] != 51) <= (10 > 93)));
+        a0[2] = (((v0 <= v1) - (v2 > v1)) ? ((a1[1][9] * a0[5]) + (v2 || v1)) : ((v0 * v2) - (v2 ? 81 : 76)));
+        a0[14] = (((92 - a1[2][8]) > (v3 == v2)) * ((v2 <= 23) ? (v0 > a1[2][3]) : (a0[15] / 5)));
+    } else {
+        v3 = (((v2 % 3) > (a0[7] >= a0[2])) <= ((v2 && 92) > (v3 || 83)));
+        v1 = (((v3 / 4) && (a1[2][12] ? a0[14] : a0[12])) ? ((v1 ? a0[3] : v2) > (v1 != 26)) : ((55 + v0) <= (a0[12] + a0[2])));
+        a1[2][11] = (((v2 != v2) + (v3 > a1[2][5])) || ((v2 - v1) ? (v1 + 53) : (a0[13] - a0[13])));
+    }
+    v2 = (((v0 / 9) - (a1[0][8] && 74)) || ((v2 - a0[11]) > (v0 * v1)));
+    v3 = (((v3 * a1[1][3]) * (v1 ? v2 : v1)) >= ((v0 * v3) ? (a1[1][8] / 6) : (4 * 86)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v1 = (((56 % 1) < (v0 / 4)) * ((27 < v0) % 8));
+            v2 = (((a1[3][7] >= 8) * (37 == a0[10])) != ((i0 + v3) != (i0 / 1)));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((35 * v1) / 7) != ((a0[1] && v0) > (a0[10] <= a0[15])));
+                    a0[15] = (((i1 ? 47 : a0[14]) / 6) >= ((a1[1][1] > 40) % 9));
+                    v3 = (((a0[9] ? v1 : v3) % 5) / 2);
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v0 > a1[3][14]) != (i2 >= v3)) * ((v0 != 64) >= (v3 == v1)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a0[5] = (((64 != 6) * (v2 > a1[3][12])) * ((72 * v1) ? (i3 % 1) : (42 != 88)));
+                a1[1][6] = (((a0[7] / 2) == (i2 || v0)) != ((i2 + i3) != (i2 * i3)));
+                v2 = (((v0 ? v2 : v0) > (v0 * a1[1][9])) != ((a0[13] && i3) >= (i2 || 62)));
+            }
+            a0[7] = (((a1[2][12] - v1) * (29 / 1)) && ((v0 > v2) < (v1 ? 53 : a1[3][8])));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v0 = (((v2 && a0[12]) ? (v0 + v0) : (30 / 9)) != ((v1 || a0[9]) < (v0 > 70)));
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v2 = (((v1 ? v1 : a1[1][11]) - (i4 <= v1)) && ((59 == 57) / 4));
+                v0 = (((a0[1] ? a0[6] : v2) ? (i5 ? i5 : v1) : (a0[14] - v1)) < ((i5 != a1[3][14]) && (a1[0][2] && a1[0][15])));
+                v2 = (((v3 >= v2) == (v0 <= i4)) / 1);
+            }
+            v0 = (((v1 || a0[0]) % 5) || ((4 <= 22) * (v1 == i4)));
+            v0 = (((a1[0][0] % 5) < (v2 / 4)) >= ((v2 || a1[1][4]) <= (75 + v0)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 >= a0[4]) != (v3 == a1[2][4])) ? ((v2 != a1[0][9]) + (v3 == 80)) : ((a0[7] < v0) % 3))) {
+        v2 = (((23 && a1[0][9]) % 5) ? ((v2 ? 59 : a0[3]) && (v3 ? 37 : a1[3][8])) : ((83 || v0) + (85 >= v0)));
+        a1[2][12] = (((a1[1][15] ? v0 : 96) != (a0[7] <= 25)) - ((v1 < v2) || (v3 / 7)));
+        v1 = (((85 * v3) % 5) * ((v0 || v1) != (43 - a1[1][5])));
+    } else {
+        a1[1][13] = (((v0 > v2) - (v0 > 70)) ? ((v0 + 87) && (v2 || a1[1][9])) : ((v2 && a0[8]) ? (v1 * v1) : (v0 - a0[6])));
+        v2 = (((v2 < a0[9]) - (v3 != v3)) || ((v3 * v2) ? (a0[7] >= 73) : (v3 >= v2)));
+        v1 = (((v3 + a0[0]) > (32 ? a1[1][6] : v2)) != ((a0[11] > 64) % 2));
+    }
+    a0[6] = (((a1[0][10] % 7) ? (v0 ? a1[3][15] : 12) : (a0[3] > a0[10])) != ((v3 - v1) >= (v1 ? a1[2][0] : v2)));
+    return (((56 ? v0 : v3) < (v3 + a0[14])) >= ((a0[8] == a0[15]) < (v2 >= v3)));
+}
+int f34() {
+    int v0 = 44;
+    int v1 = 54;
+    int v2 = 28;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a1[0][6] = (((i0 < a0[13]) <= (v1 && 91)) ? ((3 ? 83 : a1[1][15]) - (i0 * a1[0][3])) : ((7 - v3) != (3 == a0[14])));
+                    v1 = (((42 * 93) == (i0 < v1)) && ((v3 || 22) != (v1 + v0)));
+                    a0[6] = (((v2 == i0) ? (i1 / 1) : (a0[5] > v1)) ? ((v3 ? i0 : v2) > (v2 ? i1 : i0)) : ((v3 >= v3) * (v3 <= v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[14] = (((v1 % 4) < (20 % 7)) == ((v3 && a1[2][2]) > (a1[3][15] < i0)));
+            v3 = (((v0 + a1[1][2]) + (v2 / 2)) ? ((a0[5] - 41) < (76 / 4)) : ((a1[2][6] != v1) >= (v2 * v0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((v3 <= a0[14]) > 64) break;
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v2 = (((v3 == i3) != (i2 || v2)) < ((a1[3][12] + a1[2][8]) <= (i3 * v1)));
+                    v0 = (((a1[3][9] ? 87 : 81) > (a1[1][1] == v0)) + ((i3 != a0[13]) + (a1[0][11] && v3)));
+                    a0[1] = (((a1[0][4] ? v1 : 77) || (i2 != 16)) ? ((1 % 1) - (a1[2][4] < i2)) : ((i3 > v1) || (a0[7] >= 2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((i2 * v3) > (v2 * a0[10])) || ((71 ? v2 : v3) && (v2 % 5)));
+            v2 = (((a0[4] ? a1[1][9] : 92) / 8) || ((v1 && a1[0][13]) > (v1 < v2)));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((a0[8] - v3) <= (v2 != a0[2])) && ((a1[3][5] || 89) % 4));
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((v1 % 5) > 56) break;
+            v2 = (((i4 * v3) && (i4 && v0)) - ((v1 - 45) > (a1[3][7] > v0)));
+            a0[4] = (((87 == v2) > (7 * i4)) * ((a1[2][3] || 6) != (v3 == a1[0][13])));
+            {
+                int i5 = 0;
+                do {
+                    if ((a0[13] - a0[5]) > 59) break;
+                    a1[2][2] = (((a1[3][1] > 52) + (29 || 4)) <= ((v0 + v3) >= (a0[1] / 4)));
+                    v0 = (((56 < v0) - (i4 ? 73 : a1[3][11])) ? ((58 < v0) != (v2 || a1[0][0])) : ((a1[2][3] + i4) == (25 / 2)));
+                    a0[14] = (((v1 / 2) > (i5 * v0)) >= ((15 <= v3) || (i4 && 71)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            if ((i6 % 1) > 54) break;
+            a1[1][4] = (((20 == v2) + (17 % 3)) < ((v0 > 69) * (i6 / 1)));
+            v2 = (((v2 && a0[10]) == (a1[0][4] ? v2 : v3)) - ((a1[2][4] >= a1[3][11]) >= (v3 / 6)));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                if ((1 ? a1[0][15] : 42) > 98) break;
+                v0 = (((i6 * v2) * (i7 - i7)) ? ((10 >= i6) < (v2 > a1[0][9])) : ((6 != a0[15]) > (v1 - v0)));
+                a0[2] = (((v1 / 1) % 8) - ((v2 > 11) && (v0 ? i7 : v2)));
+                a0[15] = (((a0[8] == a0[5]) % 1) >= ((v1 * i6) % 6));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    v3 = (((7 >= 44) < (a1[2][14] / 5)) * ((83 % 7) < (a1[1][7] < i9)));
+                    v3 = (((a1[0][3] != 10) ? (10 % 8) : (v3 && 24)) / 3);
+                    v1 = (((v1 ? 86 : a0[6]) / 4) / 5);
+                    i9 = i9 + 1;
+                }
+            }
+            a0[12] = (((35 % 2) <= (v3 && v2)) ? ((20 / 4) <= (50 <= v1)) : ((i8 >= i8) / 8));
+            v1 = (((25 - v0) * (a0[10] > v2)) && ((46 + v0) || (v0 % 5)));
+            i8 = i8 + 1;
+        } while (i8 < 7);
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((v3 * v0) > 74) break;
+            v0 = (((a0[0] || 84) % 1) * ((i10 ? v2 : v0) * (i10 ? i10 : v0)));
+            v3 = (((v3 == v0) ? (v2 * a0[2]) : (79 ? 2 : v2)) == ((a0[4] > 88) ? (a1[1][4] - a1[0][5]) : (v1 + v3)));
+            for (int i11 = 0; i11 < 3; i11 = i11 + 1) {
+                if ((a1[2][5] && v1) > 58) break;
+                v2 = (((i11 || i11) ? (v1 ? 88 : a1[1][10]) : (v0 * v2)) >= ((a1[0][4] / 1) + (47 % 4)));
+                v3 = (((i11 == a0[7]) * (v1 || v3)) <= ((a0[0] > v3) || (a1[0][13] + 38)));
+                a0[13] = (((49 % 8) * (v0 ? v3 : v0)) ? ((v0 - v3) || (i11 + v1)) : ((i10 < i11) / 7));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 2);
+    }
+    {
+        int i12 = 0;
+        do {
+            {
+                int i13 = 0;
+                do {
+                    a1[2][5] = (((74 % 5) % 7) || ((a0[7] >= 70) <= (27 >= v1)));
+                    v2 = (((v3 - a0[11]) ? (v2 >= a0[2]) : (i12 % 6)) + ((v2 ? 91 : 74) == (a0[11] / 5)));
+                    v0 = (((a1[3][8] ? i12 : a0[1]) && (94 <= v1)) || ((a1[0][1] && 94) ? (44 != 9) : (a1[1][13] > a0[4])));
+                    i13 = i13 + 1;
+                } while (i13 < 2);
+            }
+            v0 = (((v2 - a0[2]) % 5) && ((a1[1][10] > v2) ? (v1 - a1[0][11]) : (v0 <= v3)));
+            v0 = (((v3 / 7) > (a1[1][10] ? v0 : v2)) <= ((a0[8] > v1) - (23 >= v2)));
+            i12 = i12 + 1;
+        } while (i12 < 6);
+    }
+    for (int i14 = 0; i14 < 8; i14 = i14 + 1) {
+        {
+            int i15 = 0;
+            while (i15 < 5) {
+                a1[1][10] = (((i15 - v1) || (60 % 7)) != ((76 % 5) ? (v0 - v0) : (i15 || v0)));
+                v2 = (((a1[1][5] && v3) - (a0[4] <= v2)) ? ((v1 * i15) <= (a0[8] + a0[11])) : ((i15 + v1) - (93 > v0)));
+                v3 = (((98 != 97) + (i15 + a0[6])) <= ((v1 / 9) < (45 && i14)));
+                i15 = i15 + 1;
+            }
+        }
+        v2 = (((a0[6] != 37) >= (a1[3][8] / 2)) >= ((35 == v3) > (a0[12] || 85)));
+        a0[12] = (((v0 != v3) / 8) ? ((v0 || 60) == (a0[12] <= a0[8])) : ((92 || v1) ? (v3 != v3) : (71 <= v0)));
+    }
+    {
+        int i16 = 0;
+        do {
+            if ((v2 ? v3 : 48) > 69) break;
+            {
+                int i17 = 0;
+                do {
+                    a0[13] = (((a0[1] - v2) && (28 < v1)) < ((a0[7] != a1[3][9]) - (a1[2][4] % 6)));
+                    a0[5] = (((a1[3][7] - 88) >= (i16 - a0[6])) / 8);
+                    v2 = (((17 + 60) % 9) % 9);
+                    i17 = i17 + 1;
+                } while (i17 < 3);
+            }
+            v3 = (((a0[10] > v1) % 4) >= ((v2 / 5) % 5));
+            v0 = (((a0[15] > v1) - (51 && v0)) ? ((1 != 93) % 9) : ((v2 && a0[13]) % 1));
+            i16 = i16 + 1;
+        } while (i16 < 7);
+    }
+    return (((v3 ? v2 : v3) > (v1 + v2)) && ((v1 != v0) * (a0[1] + v1)));
+}
+int f35() {
+    int v0 = 81;
+    int v1 = 49;
+    int v2 = 40;
+    int v3 = 60;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a1[0][14] <= 15) > 96) break;
+        {
+            int i1 = 0;
+            do {
+                v2 = (((i0 * 2) <= (a1[1][2] <= v3)) + ((a0[9] ? i0 : v2) || (a1[0][15] != 53)));
+                v2 = (((v1 >= 30) - (a1[1][2] >= v3)) / 5);
+                a1[3][3] = (((a1[2][7] - 30) == (v3 / 7)) && ((61 ? v3 : 30) % 5));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        a1[1][7] = (((a0[0] * v1) != (a1[2][0] % 1)) < ((i0 / 2) < (v1 >= 33)));
+        v0 = (((v0 ? a0[8] : 57) >= (80 * a1[3][4])) > ((v3 + a1[3][5]) == (i0 >= v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v2 != a1[3][4]) || (v1 > i2)) > ((i2 == v3) - (v1 - a1[3][14])));
+            v2 = (((88 > a0[8]) || (v0 >= v3)) - ((a1[0][10] >= v3) / 8));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                if ((i2 - i3) > 60) break;
+                a1[1][3] = (((v1 < i2) >= (i2 ? v0 : 0)) >= ((i3 + i3) ? (64 * a1[2][4]) : (a1[2][3] > a1[1][6])));
+                v1 = (((i3 && a1[2][0]) == (a0[4] == v3)) < ((4 >= i2) == (i3 <= 6)));
+                v2 = (((v1 == a0[13]) / 6) < ((i2 || v1) < (v1 == a1[1][15])));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v1 = (((v1 >= v0) * (v0 < v1)) < ((a0[7] * v0) == (48 == v3)));
+    {
+        int i4 = 0;
+        do {
+            if ((54 * i4) > 73) break;
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v1 = (((a0[12] == 9) == (i5 >= v1)) ? ((i5 != i5) && (33 <= v3)) : ((v2 > 89) != (a0[2] ? a0[14] : v1)));
+                    v1 = (((i5 || a1[1][9]) || (i4 >= v3)) % 3);
+                    v3 = (((96 - i4) <= (i4 < a0[3])) >= ((v2 % 5) > (i5 == i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[2][3] = (((a0[14] && 88) > (88 < 35)) ? ((a0[11] >= 77) <= (i4 ? 4 : 63)) : ((v3 + 63) <= (v2 < 19)));
+            a0[0] = (((v0 && v3) > (a1[0][6] > a0[12])) == ((v3 + i4) / 4));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((7 * a1[0][1]) > 69) break;
+            {
+                int i7 = 0;
+                do {
+                    if ((i6 <= a0[9]) > 90) break;
+                    v3 = (((92 < i6) > (v0 + 16)) * ((72 + i6) <= (71 ? 29 : v0)));
+                    v2 = (((21 > a1[3][1]) == (v1 <= a1[2][5])) && ((a0[2] >= 79) ? (v2 * v1) : (i7 > i6)));
+                    a1[1][11] = (((v1 - a0[7]) || (93 != 4)) ? ((30 * v0) == (a0[7] + a1[1][14])) : ((i7 / 1) > (0 * v2)));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            v2 = (((43 * a1[3][3]) / 4) / 9);
+            a0[6] = (((v0 && 19) >= (i6 >= a0[1])) * ((a0[8] && 54) * (75 ? v2 : v2)));
+            i6 = i6 + 1;
+        }
+    }
+    a0[3] = (((v2 < 76) < (30 <= v2)) >= ((v2 + v0) == (a1[0][3] != v0)));
+    v0 = (((v1 > v1) - (v1 > 97)) - ((53 * a1[2][9]) < (v0 > a1[3][11])));
+    if ((((v1 == v2) <= (v3 % 1)) >= ((53 ? v0 : 47) <= (v3 / 8)))) {
+        v0 = (((v1 < 97) * (7 % 1)) >= ((v3 ? v2 : v2) <= (v1 * v1)));
+        v0 = (((v1 ? 86 : v2) - (62 * 78)) >= ((a0[5] >= v3) / 9));
+        v1 = (((84 % 1) - (v0 % 5)) >= ((58 < v2) || (v0 || v0)));
+    } else {
+        v2 = (((v2 < v2) <= (v0 + 15)) != ((v3 && 98) || (a0[1] != a1[3][8])));
+        v1 = (((73 == a1[3][14]) != (51 == 73)) <= ((v3 + a1[2][1]) <= (v3 / 8)));
+        v1 = (((v0 == v3) && (57 % 6)) + ((v2 < v0) % 5));
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        v1 = (((29 && a0[2]) / 2) > ((v3 || 74) ? (v2 >= v2) : (v1 - v2)));
+        a0[11] = (((i8 <= i8) < (33 >= 85)) >= ((v3 == v1) <= (23 < a0[9])));
+        {
+            int i9 = 0;
+            do {
+                v0 = (((v3 >= v0) != (a1[3][6] && 54)) == ((v0 * v0) < (i8 > a1[1][1])));
+                a0[0] = (((a0[0] >= i9) ? (v1 && 82) : (38 < v3)) >= ((50 * v1) ? (21 <= i9) : (a1[1][5] < v2)));
+                a0[10] = (((i9 - a0[12]) % 8) % 9);
+                i9 = i9 + 1;
+            } while (i9 < 5);
+        }
+    }
+    if ((((v0 == 79) >= (v2 % 3)) != ((v3 - v3) && (42 != v1)))) {
+        a0[7] = (((v0 != v0) < (49 - 65)) ? ((a0[15] / 6) < (v0 == 98)) : ((27 ? v1 : v2) > (v1 && v1)));
+        v2 = (((a1[3][9] == v1) > (v1 * v0)) - ((a1[3][5] / 4) % 3));
+        v3 = (((v3 > 39) / 6) == ((a0[10] >= v0) % 5));
+    } else {
+        a1[3][1] = (((a1[2][4] ? 73 : v2) <= (a0[13] != a0[10])) && ((96 && v1) < (v0 != v0)));
+        v3 = (((v1 ? v2 : 33) <= (a1[1][13] <= a1[2][5])) != ((v0 == v1) + (35 == v0)));
+        v3 = (((79 > a0[6]) ? (v1 == v0) : (a0[9] / 9)) == ((57 * a1[0][8]) > (v0 < a1[3][7])));
+    }
+    return (((19 <= a0[1]) * (a1[2][1] && 83)) && ((62 <= a0[12]) * (v3 != v3)));
+}
+int f36() {
+    int v0 = 57;
+    int v1 = 90;
+    int v2 = 57;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 ? a1[2][0] : a1[0][14]) ? (62 || a1[1][10]) : (v3 || v0)) <= ((v3 <= v0) < (a0[11] || a1[1][6])))) {
+        v1 = (((v0 <= a0[2]) && (v2 == 68)) >= ((a0[11] * v0) % 1));
+        a0[4] = (((a1[0][7] % 9) - (39 == 90)) != ((v1 != v3) < (v3 >= v2)));
+        v2 = (((v3 > 29) ? (40 > v1) : (a0[11] <= a0[12])) || ((a0[5] >= 73) / 1));
+    } else {
+        a1[2][7] = (((v3 || 97) == (a0[15] > a0[1])) ? ((v3 && a0[11]) + (79 < v1)) : ((v1 == a0[15]) / 3));
+        a0[2] = (((v1 < 81) == (a0[6] % 4)) * ((v3 % 2) ? (v1 * a0[0]) : (a0[9] ? a0[0] : v1)));
+        v3 = (((64 <= a1[3][12]) > (v3 ? v3 : 8)) % 8);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v1 = (((v2 >= i0) * (v1 != v3)) + ((v2 / 5) + (a0[7] - v3)));
+            v2 = (((a0[10] <= a0[6]) || (v0 <= 19)) || ((58 + 43) ? (i0 ? 57 : 73) : (8 <= a0[9])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                a0[4] = (((v1 % 1) < (i0 == i1)) && ((25 <= 31) > (a0[5] * i0)));
+                v2 = (((v2 && v1) - (61 ? v3 : i1)) && ((14 && i0) - (15 > v0)));
+                v3 = (((v0 ? a1[1][9] : v2) && (v0 * v2)) > ((v0 && v2) ? (i0 > i1) : (v1 ? i1 : i0)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((v3 >= 79) > 50) break;
+                    v2 = (((a1[1][7] + 93) + (a0[7] % 7)) % 6);
+                    v0 = (((79 * 12) * (a1[2][1] / 8)) && ((15 - a1[2][12]) == (v3 - a0[7])));
+                    a0[0] = (((v1 > i2) && (a0[11] + i3)) % 2);
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((72 - v0) > (a0[12] + 6)) - ((v2 / 5) ? (a1[1][11] / 1) : (a0[15] >= v1)));
+            v1 = (((53 && i2) - (37 % 2)) != ((v1 || 10) || (4 < v1)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        a0[6] = (((v3 + a0[15]) + (83 % 1)) && ((30 != a0[11]) ? (64 % 2) : (92 >= v0)));
+        v1 = (((v3 - v0) % 7) > ((v0 * v1) || (v3 / 1)));
+        {
+            int i5 = 0;
+            while (i5 < 6) {
+                v1 = (((v1 < v1) * (20 < 23)) / 7);
+                v0 = (((34 / 3) / 7) - ((i4 || v0) * (87 % 9)));
+                v3 = (((92 - v2) < (a1[2][1] == a1[1][8])) % 9);
+                i5 = i5 + 1;
+            }
+        }
+    }
+    a0[15] = (((v1 || v3) ? (96 ? a0[11] : a1[3][14]) : (37 || v3)) == ((a0[10] + v2) ? (a1[2][10] + v2) : (v0 < a1[3][6])));
+    v1 = (((4 != 5) ? (v0 && v0) : (v1 < a1[2][14])) || ((v2 / 8) + (a1[0][10] && v1)));
+    a1[1][7] = (((v1 - 52) && (v1 != 30)) == ((v0 + 57) - (v1 ? 78 : 26)));
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            if ((a0[7] && a1[0][8]) > 96) break;
+            a1[3][5] = (((v0 || a1[1][2]) == (a1[3][13] || i6)) != ((32 <= a0[3]) - (a1[0][10] == v3)));
+            {
+                int i7 = 0;
+                do {
+                    a1[3][11] = (((a0[12] ? v2 : i6) && (i6 <= a1[3][5])) < ((19 % 8) + (v1 / 8)));
+                    v1 = (((v2 ? 92 : a1[3][6]) + (a0[13] / 6)) ? ((i6 > v2) >= (a0[1] ? a1[0][13] : v1)) : ((36 < 73) * (99 || v3)));
+                    v1 = (((a0[7] > 97) ? (26 == 52) : (71 / 6)) % 1);
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            v1 = (((v1 % 7) >= (i6 > v3)) + ((a1[0][7] ? 84 : 18) + (a1[1][10] < v3)));
+            i6 = i6 + 1;
+        }
+    }
+    v2 = (((6 % 1) % 5) >= ((v0 - v3) || (a0[11] > v1)));
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            {
+                int i9 = 0;
+                do {
+                    v2 = (((63 - 47) - (v3 == i8)) * ((v2 != a0[13]) && (v1 - i8)));
+                    v2 = (((v3 - a0[5]) != (67 < 61)) < ((3 != a0[2]) < (v0 + i8)));
+                    a1[3][1] = (((a1[1][7] == v0) - (i8 != 56)) >= ((v3 >= a0[3]) || (a0[1] > i9)));
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            a0[8] = (((v0 != v2) && (v3 == a1[0][6])) < ((a0[13] && a0[8]) ? (a0[15] < 14) : (88 || 4)));
+            v2 = (((v1 && 3) * (v3 != a0[10])) == ((v1 > v2) || (i8 - v3)));
+            i8 = i8 + 1;
+        }
+    }
+    return (((v2 + v2) != (v3 != v3)) ? ((v0 ? a0[0] : 21) * (a0[1] < v2)) : ((a1[0][9] * v3) % 2));
+}
+int f37() {
+    int v0 = 28;
+    int v1 = 16;
+    int v2 = 56;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v2 || 46) || (v1 + v0)) >= ((v3 * 17) && (75 ? v2 : a1[0][2])));
+            v0 = (((a1[3][15] >= v3) / 1) || ((i0 <= v0) ? (a1[3][2] + v0) : (v0 != 92)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v1 = (((a0[1] ? v0 : 54) == (89 * 20)) || ((a1[0][12] >= v2) < (v1 <= a0[9])));
+                v3 = (((i1 % 7) + (v3 ? 78 : 62)) - ((a1[1][6] == v0) <= (i0 ? a1[3][3] : a1[1][3])));
+                a0[14] = (((32 != v2) ? (92 != a1[1][2]) : (i0 / 3)) && ((v0 ? v2 : v2) ? (33 || 53) : (v2 > 66)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[8] ? v1 : v1) > 94) break;
+            v3 = (((v2 || v2) + (17 / 9)) == ((72 / 2) || (v3 - 35)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((a1[0][13] != v3) || (v0 + v1)) && ((v3 ? v1 : v0) ? (83 >= a0[0]) : (v1 != a0[7])));
+                    v0 = (((v0 > a1[1][3]) ? (89 ? 63 : i3) : (v3 * a1[1][13])) == ((i3 ? 77 : 6) < (93 < a1[3][4])));
+                    v0 = (((v2 * v3) ? (v3 <= 40) : (v0 % 2)) == ((v3 != i2) || (4 / 1)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v3 = (((v2 < i2) && (46 ? 67 : v3)) >= ((v2 && 66) == (88 >= i2)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v1 && v3) || (v2 != v0)) <= ((v0 == a1[3][11]) == (v1 % 3)))) {
+        a1[3][14] = (((4 / 6) && (a1[2][2] / 2)) <= ((a1[3][0] + v1) / 3));
+        v1 = (((v2 + v3) && (a1[0][12] % 1)) ? ((v1 ? v0 : v1) <= (v3 / 9)) : ((v3 / 2) > (v3 <= 15)));
+        a1[0][0] = (((a1[3][6] - v1) + (16 + v1)) / 9);
+    } else {
+        a0[15] = (((v1 == v1) + (a1[1][0] ? 82 : a1[1][11])) > ((66 == 63) != (v0 || 96)));
+        v3 = (((v2 > a0[15]) * (v0 == a0[0])) % 7);
+        v3 = (((29 ? v3 : v3) ? (a1[0][7] - a1[1][5]) : (93 >= 22)) > ((a1[1][4] <= a0[2]) > (v0 - v0)));
+    }
+    v3 = (((a1[2][12] && 65) / 1) >= ((83 ? v1 : v2) || (24 <= a0[14])));
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            a1[0][6] = (((a1[0][5] + a0[1]) <= (a0[5] != v0)) < ((81 % 8) - (a0[0] ? i4 : a1[3][11])));
+            a0[7] = (((v1 >= 6) < (v0 - v1)) && ((a1[3][12] ? 49 : i4) % 8));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v2 = (((a0[10] % 7) > (a0[6] && v3)) > ((90 == a0[14]) != (v1 / 3)));
+                    v2 = (((v2 == i4) ? (v2 && a1[3][7]) : (a0[6] == i4)) - ((v0 != v0) * (v2 * i5)));
+                    v0 = (((i4 <= 31) * (a0[12] + a1[0][13])) - ((a0[11] / 3) && (v0 > v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 / 3) / 5) == ((v2 > a0[6]) - (v2 && 87)))) {
+        v0 = (((86 && v0) >= (86 * a0[14])) % 6);
+        a0[3] = (((v1 != a0[5]) * (31 >= a1[2][12])) / 3);
+        a0[4] = (((v1 % 2) || (v1 > a0[2])) > ((v0 - v0) - (v0 < a0[5])));
+    } else {
+        a1[2][14] = (((5 ? 76 : v2) + (v1 ? 53 : 87)) + ((a0[14] < v2) * (a1[0][10] != a1[2][8])));
+        v3 = (((a0[9] <= 73) ? (v2 >= v1) : (a1[1][12] || v2)) > ((95 ? a0[14] : a1[2][1]) == (a1[3][12] <= a0[2])));
+        v3 = (((a1[2][8] > v0) >= (v0 <= 17)) ? ((a0[13] == 13) * (44 || v2)) : ((v2 || 0) && (10 < v0)));
+    }
+    if ((((v3 != v3) || (v1 || 34)) * ((11 + a1[1][3]) * (41 < v2)))) {
+        a1[3][5] = (((v2 < 25) && (47 || v2)) - ((v1 < v0) != (22 > 39)));
+        v2 = (((37 != 1) % 7) != ((v0 + 95) % 2));
+        v3 = (((a0[0] ? a1[1][7] : 8) >= (v2 != a0[6])) ? ((v3 <= a1[2][13]) && (v1 <= a1[3][9])) : ((v1 <= a1[3][0]) > (47 && 8)));
+    } else {
+        v2 = (((v1 / 2) ? (v0 == v2) : (v2 >= v0)) % 9);
+        a1[2][9] = (((v2 ? 55 : v2) - (a1[2][0] - v1)) >= ((v3 / 9) * (v0 ? v0 : v3)));
+        v1 = (((63 / 7) - (v1 == a0[7])) ? ((7 - a0[1]) ? (v2 > v2) : (v1 - a1[0][0])) : ((v1 >= a0[13]) ? (a1[1][13] && a0[15]) : (v0 && v3)));
+    }
+    a1[1][6] = (((v0 > 0) ? (v1 % 1) : (v1 ? 25 : v0)) / 4);
+    if ((((38 + v1) <= (a0[15] <= v3)) < ((a0[11] - v0) + (a0[2] ? 69 : a1[0][0])))) {
+        a1[2][13] = (((v2 >= a1[2][14]) / 3) != ((84 <= v3) / 7));
+        a0[13] = (((v2 == v1) ? (v2 < 45) : (v0 * v0)) ? ((92 < 24) == (a1[3][3] + 9)) : ((a1[0][2] <= 29) / 6));
+        v0 = (((a1[3][2] ? v3 : 58) % 1) && ((v1 ? 97 : 9) != (v0 + 4)));
+    } else {
+        v2 = (((v1 % 3) && (v1 ? v2 : v1)) / 5);
+        a1[1][0] = (((v0 * 54) - (v2 != v3)) ? ((v1 * v3) / 7) : ((v1 % 4) ? (a0[7] < v2) : (75 == a1[2][5])));
+        v3 = (((a1[1][13] && a0[1]) == (75 <= v1)) != ((v2 ? v0 : v1) == (v3 > v2)));
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    a0[13] = (((58 && a1[1][0]) < (v2 && v0)) && ((63 ? v0 : 20) % 4));
+                    v2 = (((v2 - a0[3]) == (77 - v3)) == ((v0 || v2) + (92 + v1)));
+                    v0 = (((v0 * v1) >= (39 || v2)) && ((80 == a0[9]) >= (v2 != i6)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            v1 = (((v0 / 9) ? (a0[4] / 8) : (v3 - v3)) - ((v1 ? v3 : v1) + (a0[3] + 79)));
+            a0[12] = (((29 >= v3) < (v3 > a1[1][11])) * ((a0[12] && i6) != (v0 > a1[3][12])));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((v1 ? v2 : a1[1][11]) < (1 == v0)) >= ((28 != a0[8]) && (v2 > v3)));
+}
+int f38() {
+    int v0 = 49;
+    int v1 = 34;
+    int v2 = 0;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v0 = (((v0 >= i0) == (44 ? 51 : v2)) <= ((i0 + v0) < (i0 ? a0[12] : 19)));
+        v0 = (((a0[3] ? a1[0][3] : v2) ? (v2 != 7) : (v0 && i0)) - ((v2 <= a0[5]) || (a1[2][10] ? v3 : 58)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            if ((a0[7] + v1) > 92) break;
+            v1 = (((v3 >= a1[3][15]) <= (v2 * v1)) ? ((i0 >= v1) >= (a1[3][5] * v1)) : ((a0[7] ? 23 : v2) || (v2 % 2)));
+            v0 = (((76 <= v1) >= (a0[0] <= i0)) + ((i0 * a1[2][3]) - (v1 || v1)));
+            v2 = (((52 > 20) / 2) <= ((v3 < a1[2][8]) <= (v2 / 6)));
+        }
+    }
+    if ((((v2 - v1) <= (v1 + v3)) * ((v0 >= v2) && (76 ? 12 : v1)))) {
+        v1 = (((a0[7] || a0[13]) && (a1[3][0] || v0)) / 7);
+        v2 = (((49 >= v3) && (v3 > v2)) != ((32 >= v1) && (v0 != v2)));
+        a0[11] = (((v1 % 1) * (v3 + 1)) > ((v2 ? v2 : v0) % 4));
+    } else {
+        v0 = (((v0 - a1[3][1]) == (v3 - a1[2][13])) / 4);
+        v1 = (((v2 > v3) ? (v2 - a0[15]) : (47 < v3)) <= ((v3 && v3) + (v0 + a0[3])));
+        v0 = (((v2 + 32) + (87 / 3)) ? ((64 < a1[0][7]) >= (59 ? a1[3][12] : v1)) : ((v0 * v3) / 6));
+    }
+    a1[1][0] = (((v1 / 1) >= (v3 == a0[2])) < ((v0 > v1) || (v1 || v0)));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((v1 / 3) == (36 < a1[2][15])) ? ((v0 >= a1[2][6]) != (79 || a0[11])) : ((v0 != i2) ? (i3 ? v0 : a1[3][3]) : (a1[0][8] / 8)));
+                    a0[8] = (((17 % 3) != (62 / 7)) ? ((i2 + i3) || (92 >= a1[3][9])) : ((a1[3][10] < 60) != (v1 < 84)));
+                    v2 = (((v2 == v1) == (i3 - 23)) && ((v1 && v2) / 6));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((v0 ? i2 : v1) + (v3 % 1)) - ((i2 % 3) >= (v2 == v2)));
+            v3 = (((v2 > a1[1][9]) < (v2 + v3)) && ((v0 == v2) <= (v3 < 82)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            if ((76 < i4) > 69) break;
+            v0 = (((v2 * a1[0][3]) >= (a0[11] == i4)) ? ((18 % 6) * (a1[3][6] >= v3)) : ((v1 && a1[1][6]) % 9));
+            v2 = (((v0 + v3) % 7) == ((a0[2] != i4) % 9));
+            v0 = (((84 || v2) % 5) - ((v0 + a0[0]) % 2));
+        }
+        a0[3] = (((v3 % 6) > (v0 + 20)) <= ((a0[0] && i4) ? (i4 <= 88) : (a0[13] == a0[4])));
+        a1[3][1] = (((v3 || v0) || (i4 ? a1[2][2] : a0[8])) * ((v3 + a1[3][8]) % 9));
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            a0[1] = (((45 > a1[0][12]) < (v2 / 9)) >= ((v1 ? 59 : a0[4]) * (v0 >= v0)));
+            v0 = (((i7 - a0[6]) * (56 ? v2 : i7)) * ((v0 <= 16) - (v3 > a1[2][10])));
+            a0[15] = (((v1 <= v3) > (a1[1][7] >= 1)) * ((i7 > v2) < (i6 / 1)));
+        }
+        v2 = (((v1 ? a1[2][9] : v2) <= (v1 >= v1)) || ((a1[2][6] && v0) % 2));
+        v0 = (((v1 ? v1 : 18) % 2) ? ((12 && v0) <= (v3 == v0)) : ((v2 < 77) ? (v2 || v1) : (v2 && v0)));
+    }
+    {
+        int i8 = 0;
+        do {
+            a1[0][0] = (((a0[3] && v1) + (v1 - a0[11])) / 3);
+            v3 = (((v3 / 5) ? (a0[8] || a1[0][1]) : (v1 ? 55 : a1[0][9])) > ((a1[0][1] || v1) >= (v1 - a1[1][10])));
+            {
+                int i9 = 0;
+                do {
+                    if ((v2 < a1[2][6]) > 74) break;
+                    a1[1][8] = (((i8 + a0[7]) >= (29 >= i9)) && ((a0[4] < 36) ? (v0 == v0) : (73 * v3)));
+                    a1[1][9] = (((2 < 52) >= (v0 >= 39)) % 7);
+                    a0[15] = (((a1[3][15] % 5) <= (v0 && v2)) * ((4 == v1) + (a1[3][3] + 33)));
+                    i9 = i9 + 1;
+                } while (i9 < 4);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    v3 = (((v2 / 5) + (v3 == 33)) ? ((v1 <= v0) / 6) : ((25 <= a0[5]) / 3));
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            for (int i11 = 0; i11 < 2; i11 = i11 + 1) {
+                v2 = (((19 / 5) > (i11 + a0[13])) * ((v1 * v0) - (a1[0][6] || v1)));
+                v1 = (((v1 == a1[1][15]) * (a1[2][3] % 7)) > ((a0[5] + v1) * (v1 <= v0)));
+                v2 = (((95 >= 25) / 9) / 9);
+            }
+            a1[0][7] = (((43 ? 2 : a1[1][12]) && (a0[12] >= a0[5])) * ((v0 <= v1) * (v0 && a0[4])));
+            v0 = (((64 ? v3 : v2) && (v3 >= 44)) * ((a1[3][3] ? v1 : v3) / 2));
+            i10 = i10 + 1;
+        }
+    }
+    if ((((v2 + a1[2][5]) != (v1 + v0)) % 8)) {
+        v2 = (((a0[7] > a1[1][15]) % 2) * ((v0 + 5) * (v2 % 6)));
+        v1 = (((8 ? a1[2][14] : v1) > (a1[3][2] < v3)) ? ((v2 / 6) || (v2 ? v2 : 20)) : ((37 ? v2 : v1) < (v1 && v2)));
+        a1[3][12] = (((a0[4] * a1[1][8]) % 6) ? ((v2 ? v1 : v3) && (v1 && a0[2])) : ((v3 ? 89 : v1) != (43 - v0)));
+    } else {
+        a0[3] = (((40 - a0[7]) ? (v0 * v2) : (a0[1] < a1[1][1])) < ((v0 != a1[2][7]) > (a0[2] < a1[0][5])));
+        v1 = (((v1 + v1) / 1) == ((a1[2][9] < v0) + (v2 >= 58)));
+        v0 = (((93 != v1) + (v0 ? v3 : v0)) % 1);
+    }
+    return (((a0[0] != 56) || (a0[2] <= v0)) <= ((39 <= v1) + (a0[5] ? v3 : v0)));
+}
+int f39() {
+    int v0 = 15;
+    int v1 = 51;
+    int v2 = 2;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 >= v3) * (22 != a0[1])) % 2);
+            {
+                int i1 = 0;
+                do {
+                    a0[11] = (((a1[1][15] ? i0 : a1[3][4]) || (v0 || a0[6])) / 2);
+                    a0[9] = (((i0 * a1[2][8]) / 6) <= ((i1 == v2) / 7));
+                    v1 = (((0 + a0[12]) * (65 <= v3)) || ((v0 > a1[1][1]) - (34 < v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v2 = (((v1 >= a1[3][1]) <= (14 <= 2)) <= ((69 - a1[0][15]) || (v3 == i0)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((v1 >= a1[2][9]) <= (79 % 2)) + ((v2 ? 9 : a0[7]) != (v2 ? v3 : 38)))) {
+        v3 = (((43 <= 23) ? (a1[1][11] ? 3 : v2) : (a0[3] ? v3 : a0[7])) != ((a0[14] != v3) != (93 * v2)));
+        v2 = (((51 && 67) >= (a0[2] - v1)) % 1);
+        v1 = (((v0 + 25) < (a1[1][6] - v1)) != ((13 % 6) + (v0 ? 25 : a0[14])));
+    } else {
+        v1 = (((v1 - v3) / 6) - ((v2 <= v2) >= (v2 ? a0[10] : v0)));
+        v3 = (((v1 && a0[5]) >= (5 < 24)) / 2);
+        v3 = (((48 >= v1) ? (v1 >= a0[14]) : (v1 * v2)) ? ((76 < v3) % 7) : ((a0[10] - v3) < (a1[0][4] == v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v3 = (((a0[13] + v0) / 4) != ((v3 > i2) == (v0 - v2)));
+            v3 = (((v0 < v0) != (v3 ? 52 : 36)) <= ((a1[0][4] - v2) ? (v0 && 38) : (a1[2][3] % 5)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((v0 < a0[4]) && (v2 && a1[0][1])) / 7);
+                v2 = (((i2 >= 11) - (v3 != a1[1][9])) + ((a1[3][9] && 40) >= (i3 + v0)));
+                a0[15] = (((v3 < v3) || (i2 / 5)) * ((i3 - a0[12]) * (v0 || 91)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v2 > 28) <= (30 || v0)) + ((v2 + a1[0][12]) > (17 ? a1[3][5] : v0)))) {
+        v3 = (((v0 && v2) <= (v3 != v2)) / 4);
+        v2 = (((97 || a1[3][6]) == (v3 > v3)) * ((v3 == 93) < (a0[1] * 62)));
+        a1[3][4] = (((v0 % 6) <= (v3 > v2)) < ((a0[8] < a0[5]) >= (v2 >= v2)));
+    } else {
+        v0 = (((v0 * 31) || (v1 + a0[11])) ? ((56 > a0[14]) > (1 <= a1[3][5])) : ((v2 || a1[3][10]) != (v2 % 2)));
+        v1 = (((v3 + 61) < (a0[15] >= v0)) + ((v2 && v3) || (41 || v3)));
+        a0[5] = (((v2 > v3) % 1) || ((a1[2][8] * 51) != (v1 || v0)));
+    }
+    v2 = (((v2 || 45) != (v3 == a1[2][1])) * ((v0 >= v2) % 4));
+    a1[0][10] = (((v2 < v3) >= (v0 == a0[5])) <= ((a1[3][7] == a0[1]) - (v1 || a0[11])));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((v2 < i5) % 9) >= ((v3 == a1[2][12]) && (82 + i5)));
+                    a1[3][9] = (((i5 && a1[3][6]) ? (i4 / 7) : (i4 + a0[7])) - ((v3 > a1[2][8]) >= (29 < v1)));
+                    a1[1][14] = (((v2 < i5) ? (v2 > i4) : (a0[3] != a0[5])) == ((i4 <= a0[8]) + (v2 >= v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a0[11] = (((v0 && v3) || (v0 * i4)) < ((30 > a0[3]) / 1));
+            v2 = (((v3 >= v2) + (a0[15] && v3)) > ((a0[12] > 21) && (v3 > v1)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v0 = (((a0[15] < v0) != (v1 <= a1[1][5])) > ((v0 || 41) ? (v0 < a1[1][5]) : (v2 > a1[3][5])));
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    a0[6] = (((v1 / 3) * (i6 * 43)) < ((v1 % 9) <= (28 * a1[0][14])));
+                    v0 = (((95 * a0[5]) || (24 < 1)) > ((24 / 5) / 5));
+                    a0[14] = (((v2 == 76) / 9) + ((v2 ? i7 : a0[0]) >= (v1 && v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            a1[3][4] = (((38 ? v3 : v3) <= (v2 && v2)) || ((v3 != i6) ? (a0[4] - v3) : (i6 ? i6 : a0[3])));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            v1 = (((44 ? v3 : a0[12]) == (a1[3][4] + 38)) == ((a1[3][4] == 46) <= (v0 == v3)));
+            {
+                int i9 = 0;
+                while (i9 < 6) {
+                    if ((37 > v3) > 77) break;
+                    v1 = (((a0[15] || v0) - (a1[1][6] + 84)) && ((v1 && i8) ? (86 / 1) : (a1[0][10] - a0[7])));
+                    a1[0][8] = (((a1[3][12] <= i8) / 1) != ((a1[1][9] == v0) > (62 || v1)));
+                    v0 = (((v1 != a0[12]) && (a1[0][15] / 3)) / 9);
+                    i9 = i9 + 1;
+                }
+            }
+            v0 = (((i8 >= a0[15]) > (41 || v1)) > ((a1[1][1] ? 75 : v3) * (41 || i8)));
+            i8 = i8 + 1;
+        }
+    }
+    a1[1][14] = (((a1[0][1] == v0) / 5) + ((v0 ? a1[2][11] : a1[2][9]) == (v3 * v0)));
+    return (((v3 <= 59) >= (v2 <= a1[0][6])) == ((v3 % 6) || (a0[14] * v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    s = s + f4();
+    s = s + f5();
+    s = s + f6();
+    s = s + f7();
+    s = s + f8();
+    s = s + f9();
+    s = s + f10();
+    s = s + f11();
+    s = s + f12();
+    s = s + f13();
+    s = s + f14();
+    s = s + f15();
+    s = s + f16();
+    s = s + f17();
+    s = s + f18();
+    s = s + f19();
+    s = s + f20();
+    s = s + f21();
+    s = s + f22();
+    s = s + f23();
+    s = s + f24();
+    s = s + f25();
+    s = s + f26();
+    s = s + f27();
+    s = s + f28();
+    s = s + f29();
+    s = s + f30();
+    s = s + f31();
+    s = s + f32();
+    s = s + f33();
+    s = s + f34();
+    s = s + f35();
+    s = s + f36();
+    s = s + f37();
+    s = s + f38();
+    s = s + f39();
+    return s;
+}
@@ -0,0 +1,121 @@
+int f0() {
+    int v0 = 55;
+    int v1 = 55;
+    int v2 = 8;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a1[3][9] ? v0 : a0[6]) == (v2 ? a1[3][12] : 16)) ? ((v3 + v2) != (v0 == 28)) : ((v2 ? v0 : a1[1][12]) && (1 + v3)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v0 = (((v1 / 9) == (v2 % 9)) % 2);
+            v0 = (((v0 == v1) + (v1 >= a1[2][11])) == ((i0 / 1) == (v3 ? i0 : a1[2][15])));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v1 = (((a0[13] && 86) ? (49 * i0) : (i0 <= v1)) ? ((76 - 39) + (87 || v0)) : ((i1 + 88) && (i0 <= v0)));
+                    v2 = (((v0 ? v3 : v1) / 5) == ((v3 != a1[1][12]) * (i0 || 35)));
+                    v2 = (((58 / 7) - (v3 < 50)) - ((a0[5] ? v3 : v0) - (v2 ? i1 : 6)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a1[0][14] = (((a0[2] && a0[12]) / 4) <= ((a0[7] % 3) / 6));
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v1 = (((46 <= i2) * (a0[11] == v0)) >= ((a0[9] - v3) ? (v2 - a0[2]) : (98 && a0[3])));
+            v2 = (((a1[1][10] ? 92 : i2) == (a1[0][1] / 6)) < ((v1 == 70) ? (v2 < v3) : (a0[6] < v0)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((73 != 33) || (32 < i3)) - ((v1 * i3) % 1));
+                    a1[0][13] = (((60 ? v0 : i3) * (i3 / 2)) * ((v2 && 97) * (v2 < 50)));
+                    v1 = (((i3 >= v0) <= (v2 - a1[0][0])) > ((a1[1][11] / 3) ? (v1 != v1) : (v1 && 80)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((a0[0] && v3) ? (a1[2][2] * a1[2][8]) : (33 > a1[1][2])) != ((a0[9] - v1) || (a1[3][12] || v3)));
+                    a1[1][7] = (((i5 - i4) < (a0[2] <= 82)) == ((i4 % 1) - (70 + v3)));
+                    v2 = (((i4 > 26) || (61 || v3)) * ((i5 > a1[3][13]) - (i4 * v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v3 = (((a0[3] ? 85 : v2) != (a1[1][12] >= a1[0][14])) > ((v2 >= v1) >= (59 <= 44)));
+            v1 = (((v3 != a0[9]) || (a0[11] < a0[6])) == ((v2 ? v0 : v1) != (a0[15] >= a1[2][2])));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    v0 = (((v2 - 46) || (v3 > v3)) ? ((5 == v3) != (v2 < v3)) : ((v2 && v2) - (82 % 8)));
+    {
+        int i6 = 0;
+        do {
+            v0 = (((a1[2][5] >= i6) + (v3 ? a1[3][3] : a0[15])) && ((42 > v1) - (31 >= 82)));
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v0 = (((v2 && a0[9]) || (96 < a1[3][5])) % 8);
+                    v1 = (((37 % 2) - (i7 <= i6)) > ((v3 / 9) + (v1 + v2)));
+                    v0 = (((v2 && i7) != (a0[0] || v2)) < ((86 <= v3) % 8));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((v2 <= 1) != (14 + 22)) <= ((80 / 2) <= (39 - a0[10])));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    if ((((59 % 3) / 8) == ((8 % 7) ? (v1 / 5) : (a1[0][3] > a0[6])))) {
+        v2 = (((a0[9] / 2) != (v0 % 1)) <= ((51 ? a1[1][13] : 40) || (v2 >= 26)));
+        v0 = (((v1 >= 86) ? (v3 != v2) : (v1 ? v2 : v0)) <= ((27 ? v1 : v1) - (v3 + a1[1][11])));
+        a0[6] = (((62 % 2) ? (v1 ? v1 : v2) : (62 % 4)) % 5);
+    } else {
+        v1 = (((a0[11] % 9) % 6) ? ((a0[4] <= 62) <= (a1[0][8] == a0[12])) : ((v1 && a0[6]) + (76 && v1)));
+        v2 = (((68 % 1) < (61 > v1)) >= ((v1 % 9) || (a1[3][15] < 64)));
+        v2 = (((v0 >= 54) > (v3 != 31)) < ((a0[12] == 30) || (13 <= 33)));
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((v1 > 63) > 80) break;
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((v2 >= v3) && (v0 < a1[1][1])) + ((i9 > i8) / 4));
+                    v1 = (((0 > 82) < (a1[1][1] - i9)) * ((v2 / 3) ? (a0[4] > a1[1][8]) : (a1[1][4] <= i8)));
+                    v2 = (((a0[8] ? 6 : 91) % 7) >= ((v1 % 1) ? (v2 > i8) : (v0 / 2)));
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            a1[1][4] = (((89 != 63) != (a0[9] % 3)) / 6);
+            a1[2][11] = (((i8 == i8) || (i8 > v0)) / 1);
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    if ((((29 % 1) / 2) >= ((74 <= a1[3][4]) / 4))) {
+        a1[0][10] = (((v1 + 82) % 8) / 5);
+        a0[0] = (((v2 != v1) % 2) != ((a1[1][6] % 3) > (v1 * v3)));
+        a1[3][7] = (((v1 + a0[8]) < (v2 % 6)) > ((31 < a1[1][15]) < (76 >= a1[1][7])));
+    } else {
+        v1 = (((v2 % 7) > (v3 - a1[0][5])) - ((82 + v3) != (a0[2] != 37)));
+        v3 = (((a1[3][1] / 2) != (v0 != v1)) ? ((v1 < 99) >= (26 != a1[0][0])) : ((v3 ? v1 : v1) / 5));
+        v3 = (((v0 / 2) % 7) || ((a0[5] < 70) % 6));
+    }
+    return (((v0 == a1[3][12]) + (20 < a1[3][0])) < ((v0 != a0[10]) % 7));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,162 @@
+int f0() {
+    int v0 = 73;
+    int v1 = 26;
+    int v2 = 79;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v1 = (((a1[2][3] / 2) ? (v2 > a1[2][2]) : (72 <= v2)) / 6);
+                v0 = (((a0[0] - i0) % 6) % 4);
+                v1 = (((i0 ? v0 : a1[2][6]) || (a0[6] ? a0[13] : a1[2][10])) > ((60 + v2) && (16 % 6)));
+            }
+            v3 = (((v3 - 34) ? (v3 > v1) : (v2 || v0)) + ((v1 <= i0) % 3));
+            v3 = (((v0 % 7) + (v2 * i0)) + ((a1[0][8] == v3) / 7));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((25 % 9) - (v2 == 21)) != ((a1[1][5] + 79) / 5))) {
+        v2 = (((67 == 24) % 7) > ((a1[0][3] / 2) ? (a1[1][7] && v0) : (a1[2][12] - v2)));
+        a0[7] = (((v0 >= v1) ? (a1[1][1] % 2) : (83 > 23)) >= ((a1[1][6] % 8) != (a1[1][15] * a0[2])));
+        v0 = (((v2 || 14) % 9) && ((v0 / 3) <= (v0 / 3)));
+    } else {
+        a0[2] = (((24 / 9) >= (11 == a1[2][14])) < ((v0 / 4) * (75 * v3)));
+        v2 = (((v3 >= 27) ? (45 > 69) : (v1 == v0)) == ((56 < 62) && (66 > a0[13])));
+        a1[1][11] = (((v0 && 73) || (79 < v3)) + ((v3 || v1) - (27 != a0[4])));
+    }
+    v2 = (((a0[9] / 7) % 4) == ((v1 * v0) < (v2 >= v0)));
+    v2 = (((14 <= v3) <= (64 + a1[0][11])) > ((24 % 2) < (a0[11] + v0)));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v3 = (((v2 / 9) < (v0 >= a1[2][14])) - ((v2 % 4) && (v2 + 38)));
+            v0 = (((a1[3][15] >= v0) > (v0 - v0)) / 4);
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a0[2] = (((70 ? v2 : a0[12]) <= (a1[2][3] <= a1[0][2])) + ((i2 <= 30) != (i2 * v0)));
+                a0[6] = (((a1[2][11] < v2) == (a1[3][15] % 4)) <= ((i2 - v0) == (a1[2][5] == v1)));
+                v1 = (((25 > 85) != (26 + 9)) < ((v2 > a1[0][12]) * (a1[1][8] <= 86)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        a0[2] = (((a1[1][8] && a0[12]) % 7) <= ((i4 + v3) - (81 == v2)));
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v2 = (((13 <= i4) ? (4 < a0[7]) : (a1[2][6] < a0[8])) % 7);
+            a0[6] = (((v1 ? 67 : v2) + (i5 * v1)) - ((a0[7] % 6) * (i4 ? 20 : v2)));
+            a0[4] = (((a1[3][1] * 94) != (15 >= v1)) != ((31 != 81) ? (a0[12] ? v3 : a0[2]) : (a1[0][8] ? a1[1][4] : 95)));
+        }
+        v3 = (((a0[3] <= 91) / 7) == ((59 < v3) == (a0[9] * a0[6])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v0 = (((i6 && a1[1][7]) > (66 >= v0)) != ((v2 < 21) % 2));
+                v3 = (((i7 ? v1 : 10) && (18 < v3)) > ((v2 / 2) || (v2 ? v1 : a0[14])));
+                v0 = (((83 >= v0) != (10 || v2)) / 8);
+            }
+            v2 = (((v0 / 3) % 8) * ((v2 && v2) % 1));
+            v2 = (((v1 * v1) && (a0[15] <= 16)) + ((82 ? 98 : i6) % 7));
+            i6 = i6 + 1;
+        }
+    }
+    a0[9] = (((48 != v0) / 5) != ((61 <= a0[3]) == (v0 ? 82 : v3)));
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        a1[3][2] = (((a1[1][0] * i8) / 2) ? ((v3 && a0[0]) > (74 != v2)) : ((a1[3][1] != a1[2][10]) + (81 ? v3 : a1[0][10])));
+        v0 = (((v1 - a0[8]) <= (v0 - a1[3][3])) * ((v3 && i8) == (v3 > v3)));
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                v0 = (((a0[2] > v3) * (a1[1][5] % 1)) + ((v0 < a0[7]) / 9));
+                a1[2][11] = (((v0 == i9) != (v1 && v1)) ? ((i9 % 4) * (v0 / 4)) : ((v3 + v0) <= (v3 / 3)));
+                v2 = (((i8 <= v0) > (a0[9] || a1[0][13])) * ((a1[1][15] && i8) ? (v2 ? 96 : a0[2]) : (a1[1][3] ? a1[0][4] : i9)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    v2 = (((a1[1][9] < a1[0][14]) > (v2 - v0)) % 1);
+    return (((81 >= v0) % 3) && ((a0[0] / 6) + (v1 != a0[12])));
+}
+int f1() {
+    int v0 = 70;
+    int v1 = 41;
+    int v2 = 64;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    a0[3] = (((v3 - v3) == (42 ? v0 : a1[2][5])) && ((v0 - 69) ? (v3 <= v2) : (92 + v3)));
+    v3 = (((v0 && 34) ? (15 ? 51 : v3) : (a0[15] != 34)) < ((60 + a0[9]) % 4));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        a1[1][8] = (((79 != v1) < (v2 ? v3 : v0)) + ((v1 || a0[3]) % 5));
+        v2 = (((a0[4] > v1) || (v0 < 13)) < ((90 ? 76 : 89) ? (49 < v1) : (v0 * v3)));
+        {
+            int i1 = 0;
+            do {
+                a1[3][1] = (((v2 ? a0[8] : i1) && (75 >= a0[8])) > ((i0 * 40) * (a0[3] - a1[1][11])));
+                v2 = (((10 ? v3 : v0) || (i1 > a1[2][2])) - ((i1 - i0) != (46 / 2)));
+                a0[4] = (((a0[4] + v1) > (8 + v3)) * ((a1[3][8] - 32) * (79 * 98)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((i2 - v3) > 92) break;
+        v3 = (((v3 < 96) && (a1[0][6] > v1)) + ((a1[3][11] <= a1[3][13]) * (a0[5] < 26)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((a0[7] != i3) > 62) break;
+                v0 = (((v0 != 41) * (a0[5] >= v2)) <= ((a0[11] ? 43 : v1) ? (i3 != a0[8]) : (i3 + a0[7])));
+                v0 = (((v2 ? i2 : v1) % 4) != ((a1[1][15] >= v1) >= (3 - i2)));
+                v1 = (((a0[3] >= v2) == (a0[3] <= 67)) * ((i2 + a1[0][6]) ? (v3 % 4) : (i2 == a1[3][12])));
+                i3 = i3 + 1;
+            }
+        }
+        a0[10] = (((v2 == v0) < (i2 % 5)) * ((v1 > a1[2][5]) % 1));
+    }
+    v1 = (((2 > a1[3][13]) ? (v3 && v3) : (v2 - a1[0][2])) > ((69 ? v0 : v0) - (a1[3][5] != v1)));
+    if ((((37 < 11) * (v2 && v0)) && ((v0 < a1[0][9]) ? (v3 ? v0 : v0) : (v3 <= 63)))) {
+        a0[10] = (((a1[1][5] * 56) == (a1[1][15] / 5)) / 6);
+        v3 = (((83 <= v3) - (v1 != a1[2][1])) + ((77 ? v2 : a0[6]) >= (v1 && v2)));
+        a0[7] = (((52 - v2) - (v0 >= v0)) != ((a0[1] * a0[9]) * (36 && 11)));
+    } else {
+        v1 = (((v2 <= v3) && (a1[0][6] * v3)) ? ((v1 > v1) == (18 || v1)) : ((v3 + 0) ? (a1[1][9] + v3) : (67 || v3)));
+        a1[0][15] = (((v2 % 2) || (a0[15] == v2)) ? ((v3 ? 52 : a1[2][6]) || (61 != 87)) : ((v0 || 92) > (v3 >= 98)));
+        a1[1][0] = (((15 && 42) ? (v1 - v2) : (v3 / 9)) != ((v3 && a0[10]) >= (v0 % 2)));
+    }
+    a0[11] = (((a1[2][11] < a1[2][5]) % 1) ? ((v1 != v0) % 8) : ((94 ? v3 : a1[1][11]) + (v0 ? v2 : v2)));
+    if ((((a1[0][11] != v3) % 3) >= ((v0 / 4) + (v1 - 43)))) {
+        v2 = (((v0 >= 47) + (v3 != 92)) / 9);
+        v0 = (((v3 != a1[2][5]) < (v2 && a1[0][12])) * ((18 - v0) >= (79 || 44)));
+        a0[0] = (((45 * a1[2][0]) >= (v2 < a1[1][6])) <= ((v0 / 5) <= (44 ? v1 : v2)));
+    } else {
+        v0 = (((v3 / 6) >= (v3 < 99)) != ((v2 && a1[0][2]) == (53 * a0[4])));
+        a0[2] = (((v2 ? 21 : v0) + (v2 - v0)) + ((v2 >= a0[5]) != (a0[13] >= v1)));
+        v0 = (((a1[0][2] + v1) && (v3 >= v2)) * ((96 > 64) - (a0[2] <= v1)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                a0[0] = (((89 || v2) / 6) <= ((i5 != v3) >= (i5 < a1[1][3])));
+                v3 = (((82 ? v3 : 76) < (8 <= a0[8])) ? ((i5 ? i5 : 67) * (92 == a1[1][15])) : ((a1[3][8] ? a1[1][11] : v2) * (a0[3] == 76)));
+                v3 = (((v1 && a0[9]) / 1) && ((v2 ? i4 : a1[1][0]) <= (56 != 7)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        a1[3][0] = (((v2 <= 64) ? (v3 % 3) : (69 - a0[2])) + ((v0 >= a0[7]) == (v2 / 4)));
+        v3 = (((v2 && 34) / 2) >= ((a0[1] - v2) - (v3 || 99)));
+    }
+    v1 = (((a0[11] < v2) == (7 != v3)) >= ((37 / 7) == (v1 != 45)));
+    return (((a1[2][8] > v3) == (v2 ? v2 : 84)) && ((v3 != v2) || (44 % 9)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,403 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 13;
+    int v2 = 82;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((a1[2][11] * i0) > 81) break;
+        v3 = (((11 % 8) * (55 - a1[2][4])) != ((33 * v3) || (26 > i0)));
+        v0 = (((a1[2][3] || a1[0][11]) ? (53 != v0) : (a0[4] <= v3)) / 1);
+        {
+            int i1 = 0;
+            do {
+                a1[2][0] = (((v1 + v0) != (v2 ? v1 : a1[1][10])) > ((23 <= v1) <= (80 * v0)));
+                v1 = (((v2 <= 53) >= (42 == a0[6])) * ((v2 >= a1[1][2]) && (i1 % 3)));
+                a0[1] = (((v0 && v2) ? (v2 ? a0[15] : a1[2][12]) : (36 > i0)) != ((86 ? a0[15] : a1[1][8]) && (i0 ? a0[3] : 88)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+    }
+    v1 = (((v2 % 6) <= (v3 * 55)) != ((v2 >= v1) / 3));
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v1 = (((v3 > v1) < (31 + i2)) != ((a0[11] ? 74 : a0[7]) > (v2 ? a1[1][3] : a0[8])));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v0 = (((v0 ? v0 : a0[15]) == (58 >= v0)) ? ((61 > v0) <= (a0[1] - v3)) : ((61 ? a0[14] : v0) / 9));
+                v1 = (((i3 > 47) || (50 * v1)) + ((v1 && 84) ? (83 >= a0[1]) : (a0[3] % 8)));
+                v2 = (((95 + v2) ? (v3 != a0[12]) : (7 - 95)) - ((57 <= v3) < (a0[5] % 9)));
+            }
+            v0 = (((v0 * v3) * (26 * v3)) + ((76 + v0) && (i2 || a1[0][5])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[7] + a0[5]) >= (a1[0][12] >= v2)) >= ((a0[14] > v3) + (a1[1][12] == v1)))) {
+        a1[3][11] = (((v1 != v3) ? (99 + 24) : (a1[1][10] / 7)) < ((73 != v2) && (51 > v1)));
+        v2 = (((v3 + a1[0][7]) % 6) % 1);
+        a0[12] = (((v0 >= v3) <= (v0 * v1)) ? ((53 > 65) != (a1[3][10] >= a0[10])) : ((v3 || 23) ? (a1[2][5] <= v0) : (a1[0][0] <= a0[7])));
+    } else {
+        v3 = (((v3 != v2) ? (v1 >= v3) : (a0[15] % 4)) > ((a1[3][0] % 5) * (v0 || v2)));
+        a0[1] = (((v2 ? v3 : v0) ? (v1 ? v1 : v1) : (v2 <= v3)) ? ((a0[10] ? v2 : 66) % 1) : ((a1[3][7] >= v1) > (87 ? v0 : v0)));
+        v2 = (((v1 == v3) || (a0[8] < v0)) != ((v3 == v1) || (v2 + v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v2 = (((i4 && a1[0][11]) && (a0[14] / 2)) * ((a1[2][1] >= v0) == (v3 < v0)));
+            a1[3][1] = (((v3 + 85) && (i4 < 56)) / 9);
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((51 / 4) != (i5 % 9)) > ((19 % 9) ? (11 != a1[2][9]) : (69 + v2)));
+                    v0 = (((v0 / 7) ? (61 - a0[15]) : (v3 - 5)) - ((a0[15] > a1[0][2]) + (a0[10] == 19)));
+                    v3 = (((a0[4] ? i4 : a0[5]) != (v1 < a1[1][7])) <= ((23 ? v2 : v1) * (a0[6] || 94)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((v3 / 2) ? (33 % 7) : (v2 > v3)) >= ((v3 != i6) - (v1 * a1[2][1])));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v3 = (((v3 ? a0[6] : 23) <= (a1[0][13] <= a0[6])) - ((99 <= v0) || (51 > v3)));
+                v3 = (((95 != 22) ? (i6 != a1[2][0]) : (v0 - a1[1][15])) != ((v3 < a1[3][6]) % 8));
+                a0[15] = (((a1[2][3] * 77) == (v3 >= 60)) * ((v2 + 53) ? (v3 == a1[0][11]) : (a0[7] ? a1[3][6] : a1[3][0])));
+            }
+            v2 = (((52 && 26) == (94 % 7)) / 7);
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    a0[3] = (((v2 != a0[0]) <= (32 / 1)) % 9);
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    a0[4] = (((35 || v3) < (i9 >= v1)) > ((a0[10] == v1) ? (35 > 70) : (86 >= a1[2][6])));
+                    v2 = (((i8 >= 73) == (11 - a1[0][2])) / 7);
+                    a0[3] = (((v0 || 90) <= (v2 ? 42 : 26)) * ((v2 ? v3 : a0[9]) != (v2 + 58)));
+                    i9 = i9 + 1;
+                }
+            }
+            a1[2][10] = (((i8 || v2) == (v3 <= v0)) / 3);
+            a0[7] = (((v0 >= 98) && (a0[0] && 66)) < ((i8 > i8) != (v2 && 84)));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 7) {
+            if ((v3 * a0[6]) > 98) break;
+            a0[14] = (((i10 == a0[12]) && (27 > a1[2][10])) && ((a0[6] * i10) > (a1[2][6] >= 61)));
+            a1[3][14] = (((50 <= v3) - (i10 - v0)) || ((v1 || a1[3][9]) != (v2 && a1[1][1])));
+            {
+                int i11 = 0;
+                do {
+                    if ((v3 != 37) > 88) break;
+                    a1[1][9] = (((i10 == a0[14]) == (v3 <= v0)) / 9);
+                    v3 = (((v1 ? 80 : v1) || (7 + i10)) || ((a0[9] == 25) > (78 ? v0 : 90)));
+                    v3 = (((v3 > i11) != (17 <= v2)) != ((a0[2] - i11) == (87 >= 68)));
+                    i11 = i11 + 1;
+                } while (i11 < 4);
+            }
+            i10 = i10 + 1;
+        }
+    }
+    if ((((a0[12] || a0[6]) && (a1[0][5] < v0)) < ((v0 > v2) - (v3 < a1[3][12])))) {
+        v3 = (((v2 > a0[1]) && (v0 - v0)) >= ((v3 <= 31) && (36 ? v3 : a0[8])));
+        v3 = (((12 < a1[0][4]) == (v0 != a0[15])) > ((v0 != 80) || (a0[3] >= 97)));
+        v3 = (((2 / 5) ? (a1[1][6] * v0) : (v2 && v0)) == ((v1 ? v0 : 95) == (83 + v2)));
+    } else {
+        v0 = (((v1 && a0[13]) ? (a0[5] * v2) : (a1[0][13] + v2)) <= ((v3 || v0) != (v1 / 2)));
+        a1[0][10] = (((a1[0][14] != a0[12]) >= (v3 + v3)) - ((a0[4] % 4) * (65 <= v2)));
+        v3 = (((34 % 1) != (v1 != a1[0][10])) + ((v3 ? 71 : v3) / 8));
+    }
+    return (((v0 % 4) || (v1 + a0[1])) ? ((a0[4] - v0) + (a0[8] >= a0[13])) : ((v0 <= a0[5]) >= (a0[10] ? v3 : v2)));
+}
+int f1() {
+    int v0 = 36;
+    int v1 = 22;
+    int v2 = 77;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a0[8] = (((40 == 93) / 7) % 8);
+                    a1[1][7] = (((v2 * i1) % 2) ? ((a1[3][2] - a1[2][9]) - (18 <= i0)) : ((a1[1][6] * 20) * (a1[1][4] - a1[0][8])));
+                    v2 = (((v0 <= 16) == (a1[3][0] ? v1 : v0)) * ((a1[2][13] <= 56) && (44 != v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v0 / 9) < (v2 && a1[0][13])) - ((v2 > a1[1][10]) < (v0 ? v3 : 63)));
+            a0[11] = (((a1[0][9] > v2) * (i0 <= v1)) && ((i0 && v3) && (99 || 57)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v3 = (((v0 < v2) <= (v1 <= 45)) * ((v2 ? v2 : a1[0][14]) ? (v3 || v1) : (v2 != v1)));
+        v1 = (((a0[12] * v2) && (i2 && a0[4])) % 5);
+        {
+            int i3 = 0;
+            do {
+                v0 = (((a0[0] != a1[0][6]) || (v1 || 4)) > ((a0[11] + a1[3][4]) <= (a1[2][15] == v2)));
+                v0 = (((a0[11] || 34) ? (i2 + v2) : (a1[0][8] + a0[0])) != ((69 / 1) + (a0[8] && 9)));
+                v0 = (((a0[8] > v1) ? (i2 / 5) : (i3 == 48)) ? ((a0[2] < i2) > (v2 && 48)) : ((i2 || 91) == (a1[3][6] ? i2 : i2)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v0 = (((34 || 56) <= (i5 % 5)) * ((19 * v0) < (82 <= v3)));
+                a1[3][3] = (((v2 || i4) ? (v3 - 76) : (57 != v2)) * ((38 % 2) / 5));
+                v3 = (((56 && a0[3]) - (11 + v2)) / 7);
+                i5 = i5 + 1;
+            } while (i5 < 2);
+        }
+        v3 = (((6 || a1[2][12]) <= (6 < v1)) <= ((91 % 6) - (a1[0][3] / 2)));
+        v2 = (((28 && v0) - (v3 >= 99)) || ((v3 / 3) - (a0[5] + 38)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[2] = (((i6 ? 38 : v0) ? (i6 < v1) : (v2 / 8)) > ((i6 ? v2 : i6) > (v3 % 2)));
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((v0 == a1[0][3]) ? (2 >= 70) : (i6 != i6)) >= ((i6 / 8) == (i7 / 4)));
+                    v3 = (((i6 == v2) == (v1 - v1)) ? ((i6 / 4) / 1) : ((i7 % 5) + (89 > 45)));
+                    v3 = (((91 >= v0) > (40 * a1[1][14])) * ((v2 % 3) <= (a0[9] ? a1[3][6] : v2)));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            v1 = (((1 && 35) || (57 ? 48 : 44)) == ((a1[1][2] ? a0[5] : 39) && (33 || a1[2][11])));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        if ((7 ? v3 : i8) > 72) break;
+        {
+            int i9 = 0;
+            do {
+                a1[2][2] = (((a1[1][7] % 9) != (v1 / 5)) / 9);
+                v2 = (((a0[2] <= a1[2][3]) != (a1[0][11] * 56)) <= ((v3 / 2) > (v0 || v1)));
+                v3 = (((a0[13] % 6) < (i8 ? i9 : 5)) % 9);
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+        a1[3][4] = (((a1[0][10] != 65) < (a1[1][8] < v2)) % 4);
+        v2 = (((59 == v3) == (a0[10] % 4)) ? ((a0[0] > i8) - (v0 % 6)) : ((a1[0][7] ? v1 : 4) - (v3 != 3)));
+    }
+    for (int i10 = 0; i10 < 6; i10 = i10 + 1) {
+        v1 = (((a1[1][10] == 9) && (49 % 6)) == ((27 * v2) != (v2 > a1[1][14])));
+        v3 = (((67 || 1) <= (a0[7] / 4)) / 6);
+        {
+            int i11 = 0;
+            while (i11 < 6) {
+                v1 = (((v3 && i11) - (v1 >= v2)) && ((i10 && 93) <= (45 <= v2)));
+                a0[4] = (((65 >= i11) * (v0 + i10)) || ((v2 != 70) / 6));
+                a0[12] = (((6 / 6) - (i11 % 7)) || ((a1[0][11] <= v2) + (v2 / 5)));
+                i11 = i11 + 1;
+            }
+        }
+    }
+    {
+        int i12 = 0;
+        while (i12 < 3) {
+            for (int i13 = 0; i13 < 4; i13 = i13 + 1) {
+                a0[14] = (((93 * v0) * (a0[2] >= a1[0][0])) / 7);
+                v0 = (((67 == a0[10]) || (67 < 66)) <= ((26 && i13) != (59 + a1[3][6])));
+                v2 = (((i12 % 6) * (a1[2][5] <= v2)) == ((a1[0][7] ? i13 : i13) ? (v0 * i12) : (a0[4] >= a1[1][1])));
+            }
+            a0[4] = (((65 + 99) ? (v2 % 1) : (v3 / 7)) < ((35 - a0[3]) == (v3 % 1)));
+            v1 = (((a1[3][3] <= v3) % 4) * ((v3 || a1[2][13]) == (42 > 39)));
+            i12 = i12 + 1;
+        }
+    }
+    if ((((a1[3][3] <= 13) % 4) % 3)) {
+        v2 = (((v2 <= 92) * (85 * a1[3][6])) || ((66 + v3) >= (v0 >= 78)));
+        a0[14] = (((v1 - v2) * (v3 ? a1[2][11] : a0[11])) == ((v2 ? 9 : v0) > (52 / 3)));
+        v0 = (((v1 && 61) < (v3 < a1[3][5])) <= ((73 ? a1[1][12] : 23) >= (v0 && 68)));
+    } else {
+        v1 = (((v0 || v2) ? (34 * v3) : (50 == 38)) + ((v2 % 6) != (v1 / 2)));
+        v2 = (((1 == v3) >= (35 == v1)) + ((v2 && v1) && (a0[3] % 7)));
+        v1 = (((52 ? 35 : v1) && (32 == v3)) + ((a1[3][5] ? a1[1][6] : v0) / 8));
+    }
+    if ((((a0[3] == 20) && (a0[3] != v2)) % 2)) {
+        a1[0][2] = (((a0[2] && v2) ? (8 + 66) : (v3 == a1[1][2])) == ((a0[6] < a0[13]) != (v3 ? v1 : v1)));
+        v1 = (((a0[8] < a0[15]) || (42 > v2)) > ((2 ? v1 : 80) % 1));
+        a0[2] = (((a1[1][4] * 9) || (v3 * 86)) + ((v0 * 18) ? (60 ? a0[6] : 43) : (58 + v1)));
+    } else {
+        v2 = (((v3 - v1) == (v1 * v3)) <= ((a1[0][3] <= 53) % 9));
+        v0 = (((v0 <= a1[0][10]) >= (v1 - v3)) > ((v1 % 6) - (v1 && a0[7])));
+        v3 = (((v0 && a0[0]) % 5) || ((v2 > 20) / 4));
+    }
+    {
+        int i14 = 0;
+        do {
+            a0[13] = (((i14 > 70) || (i14 == v3)) != ((v1 / 8) / 5));
+            {
+                int i15 = 0;
+                while (i15 < 5) {
+                    v2 = (((a0[15] - a0[9]) != (i15 != 54)) ? ((i14 ? v3 : 45) * (a1[0][9] >= 73)) : ((v3 % 9) + (v1 && v2)));
+                    v0 = (((i15 / 1) || (65 && 62)) ? ((v0 % 9) == (25 - v1)) : ((a1[0][5] ? 71 : i15) < (a0[12] * 36)));
+                    v1 = (((a0[11] != v3) && (a1[2][8] / 7)) >= ((18 + v2) <= (a1[3][8] < v2)));
+                    i15 = i15 + 1;
+                }
+            }
+            v1 = (((26 > a1[3][13]) != (a1[3][9] || v2)) + ((v2 == a1[3][11]) > (91 % 9)));
+            i14 = i14 + 1;
+        } while (i14 < 5);
+    }
+    return (((38 + v1) < (39 - v0)) <= ((v0 / 1) ? (a1[1][3] >= v1) : (a1[0][5] != v1)));
+}
+int f2() {
+    int v0 = 22;
+    int v1 = 74;
+    int v2 = 1;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v3 = (((a0[7] <= a0[9]) == (v0 != v1)) != ((i1 != a0[15]) + (i0 <= v2)));
+                    a1[1][4] = (((v2 - 58) / 2) / 5);
+                    v2 = (((a0[0] >= 1) ? (v2 % 5) : (88 ? 52 : 28)) != ((v1 < 69) ? (v3 && a1[3][5]) : (i1 > v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[15] = (((a0[0] ? v2 : i0) ? (12 % 4) : (77 * v1)) % 4);
+            v0 = (((v2 - v0) || (a0[3] <= 16)) ? ((92 > i0) % 6) : ((40 >= a1[0][10]) - (v2 >= v3)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((v2 < 78) ? (93 - v2) : (v2 + 9)) - ((v2 < 82) - (v1 || v0)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v2 = (((a0[14] * v0) ? (a0[0] ? 31 : a1[3][12]) : (v0 && 29)) >= ((v1 <= a1[0][12]) ? (86 || 45) : (41 || v1)));
+            v2 = (((a1[1][1] / 2) * (v1 + a1[2][12])) ? ((v3 == 6) && (a0[10] && a1[0][4])) : ((v2 < a0[8]) / 9));
+            a1[3][6] = (((i2 * a0[2]) - (v3 % 2)) && ((v3 || v3) > (v1 + i2)));
+        }
+        a1[1][8] = (((21 != v1) > (v3 != v3)) / 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((96 == v1) > 77) break;
+            a1[0][2] = (((v2 <= 45) <= (a0[12] / 9)) != ((a0[11] < 32) / 3));
+            v0 = (((a1[0][6] - 21) * (v1 > 52)) - ((i4 || v1) % 9));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                a0[11] = (((a0[4] < i4) || (i5 < v3)) / 7);
+                a1[3][10] = (((a1[1][0] > v2) ? (97 == a1[3][4]) : (a1[2][2] ? v2 : 80)) + ((44 <= a1[3][2]) != (a1[2][9] && 3)));
+                v2 = (((a1[0][9] * 61) || (i4 ? a0[8] : a0[9])) >= ((i4 ? i5 : v3) / 9));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    a0[3] = (((20 != 26) - (a0[3] <= 55)) ? ((a0[6] / 2) ? (v2 * a1[1][14]) : (i7 + v3)) : ((v3 == v2) <= (a1[2][6] == a0[7])));
+                    a1[3][9] = (((v0 == i7) < (a0[10] * a0[6])) + ((i7 == v2) ? (i7 / 3) : (25 + v1)));
+                    v3 = (((i6 ? 23 : v1) || (a0[9] ? a0[10] : a1[0][2])) + ((a0[12] != v1) >= (i7 % 2)));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            a1[1][7] = (((v3 / 3) < (94 + v1)) > ((i6 - v3) - (v1 > v0)));
+            a1[0][2] = (((38 - a1[1][14]) + (66 - v2)) <= ((14 ? a0[6] : v3) != (69 * a0[15])));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    v3 = (((v2 % 6) ? (v3 > 85) : (v0 * v0)) * ((v1 ? a0[9] : v1) || (a1[3][1] % 5)));
+    if ((((a1[1][8] == v2) % 5) == ((v0 - 59) || (a0[7] ? v2 : a0[6])))) {
+        v1 = (((99 != v1) && (10 != 18)) / 6);
+        v3 = (((a1[2][10] == v0) ? (v3 + v0) : (v0 || a1[1][9])) - ((a0[3] % 1) > (v2 + v0)));
+        a1[1][2] = (((v2 * 13) + (76 <= a0[15])) == ((33 - a0[3]) >= (v3 ? 7 : 95)));
+    } else {
+        v1 = (((v2 || v2) + (v1 >= v1)) < ((v2 || v2) * (v3 - a0[13])));
+        a0[4] = (((v0 != v0) == (a1[2][2] ? v3 : 91)) >= ((v2 && v0) && (a1[1][6] % 1)));
+        v0 = (((v1 < a1[3][15]) || (v0 % 4)) + ((v1 || v2) || (v3 > a0[2])));
+    }
+    if ((((v3 && v3) != (a0[2] - v2)) ? ((v3 <= 71) && (v2 && 82)) : ((a0[0] + a1[2][7]) || (v2 > a1[3][7])))) {
+        v1 = (((v3 * 53) || (v0 >= a0[6])) >= ((12 != v1) ? (82 != v3) : (v2 <= v0)));
+        a0[5] = (((53 <= v3) == (v1 * v1)) && ((v1 < v0) - (55 > v1)));
+        v3 = (((v2 != a1[2][6]) >= (a1[3][7] + 56)) - ((a1[2][8] && 61) < (v1 % 3)));
+    } else {
+        v1 = (((v3 - v3) / 4) * ((v2 - v1) > (v3 && a1[1][4])));
+        a0[15] = (((v1 - 94) <= (v0 >= a0[1])) < ((v2 - v2) && (8 != v0)));
+        v1 = (((v1 + v0) != (v1 < v3)) ? ((v3 / 4) * (v1 % 1)) : ((a0[9] + v0) && (v2 ? a1[1][14] : v0)));
+    }
+    if ((((a1[0][13] > v2) < (v1 || a0[7])) <= ((v2 + 11) == (a0[14] + v0)))) {
+        a1[3][9] = (((v2 < v1) == (a1[3][11] < a1[2][15])) < ((6 / 9) % 3));
+        v2 = (((v1 / 2) ? (v2 == a1[0][14]) : (v1 >= v0)) + ((v0 != v0) || (v0 != 97)));
+        v2 = (((v0 - v1) > (a1[3][7] == a1[3][6])) < ((31 + a0[4]) / 2));
+    } else {
+        v2 = (((v3 != v0) && (15 <= v2)) * ((v1 && v1) || (v0 / 4)));
+        v0 = (((77 != a1[3][8]) || (23 && 75)) - ((v1 ? a1[3][1] : 1) != (v0 + v2)));
+        a1[1][10] = (((82 / 1) * (45 ? v1 : v0)) % 4);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((v0 - 66) > 82) break;
+            v2 = (((a0[10] > 42) > (v0 == v3)) <= ((a1[1][5] && v0) + (v0 + i8)));
+            {
+                int i9 = 0;
+                do {
+                    a0[13] = (((a0[1] && a1[0][12]) > (71 != v3)) % 8);
+                    v0 = (((8 != 62) > (i8 != a1[3][1])) ? ((a0[7] < i9) ? (a1[2][13] < a0[2]) : (0 <= v0)) : ((v0 && 40) || (a1[3][14] != 27)));
+                    v0 = (((v2 ? v0 : i8) != (i9 * v0)) > ((a0[9] - i9) >= (95 - a1[2][14])));
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            a0[8] = (((75 ? a1[0][4] : i8) ? (v0 != 83) : (a1[0][1] ? v2 : v2)) && ((v3 || 47) <= (a0[2] >= a1[3][2])));
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((i10 == v2) > 56) break;
+            {
+                int i11 = 0;
+                while (i11 < 2) {
+                    a1[2][13] = (((v2 * 74) && (a0[4] || i10)) * ((i10 % 5) == (a1[2][0] && 98)));
+                    v0 = (((a1[2][14] < v1) * (93 != 97)) || ((v2 < a1[2][1]) * (v1 && a0[10])));
+                    v2 = (((i10 || 38) > (a0[14] / 1)) <= ((i10 ? 86 : v0) % 7));
+                    i11 = i11 + 1;
+                }
+            }
+            v3 = (((93 && v2) && (a1[2][8] % 8)) || ((i10 != v1) || (i10 < v3)));
+            a1[0][9] = (((v1 / 7) < (a1[2][8] != 5)) != ((19 > v3) < (v0 + a1[1][0])));
+            i10 = i10 + 1;
+        } while (i10 < 6);
+    }
+    return (((a0[13] < v0) + (a0[2] ? v3 : v0)) > ((v3 != 6) * (a1[2][14] || 34)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,403 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 8;
+    int v2 = 62;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 == v1) < (76 / 3)) < ((59 && a0[12]) || (v1 || v3)))) {
+        a0[3] = (((98 ? v3 : v3) != (v3 < v0)) ? ((55 != v2) ? (93 != v0) : (a0[13] && v3)) : ((a0[6] >= 53) ? (27 && v2) : (v2 < v2)));
+        v1 = (((73 ? 12 : 30) != (v0 % 6)) >= ((v3 ? 95 : a1[1][2]) <= (v1 + v3)));
+        v3 = (((v3 ? v2 : a1[0][0]) > (82 != a1[0][8])) * ((v1 + 95) + (v0 < v1)));
+    } else {
+        a1[3][6] = (((v0 != a0[7]) && (v0 % 4)) < ((v3 >= v2) > (v3 % 3)));
+        a1[2][12] = (((a1[2][3] + v3) / 4) != ((a1[2][9] - 33) + (54 > v2)));
+        a1[1][2] = (((56 + v2) && (a1[0][2] && v2)) ? ((v0 + 43) || (33 < 26)) : ((85 < v0) - (v1 < v2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((a1[2][13] > v1) / 2) / 5);
+                    v0 = (((i0 / 3) ? (a1[2][6] || v1) : (i0 > 44)) == ((74 ? a0[3] : v1) != (i1 ? 81 : 57)));
+                    a0[8] = (((v3 && i0) == (v3 ? a1[0][15] : a0[6])) / 2);
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][7] = (((i0 ? v1 : v1) == (59 || a0[2])) != ((8 / 4) ? (v3 <= i0) : (a0[2] * 33)));
+            v3 = (((v3 - 9) * (95 > a1[1][12])) || ((a1[1][11] * a0[9]) + (v3 == v1)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v0 * 35) > 85) break;
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            if ((v1 == a1[3][12]) > 83) break;
+            a0[13] = (((v3 + 16) + (a0[5] != 69)) > ((i2 && i3) != (v3 + 0)));
+            a0[7] = (((v3 < v1) && (v1 && v1)) + ((i3 - i2) < (81 && v3)));
+            v3 = (((v1 && i2) && (i2 + a0[12])) || ((89 < v1) ? (v3 < v1) : (99 % 6)));
+        }
+        a0[3] = (((v3 <= a1[3][3]) * (v0 > v2)) * ((v2 - 74) - (v1 != v3)));
+        v3 = (((31 && v2) % 9) + ((a0[11] || v3) || (v3 % 4)));
+    }
+    a0[2] = (((v0 % 1) ? (a0[6] ? v1 : v2) : (v2 / 8)) && ((63 / 5) == (83 * 41)));
+    a0[14] = (((a1[0][11] < v0) / 4) == ((v0 % 4) <= (27 >= 44)));
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((a1[2][3] + 62) > 52) break;
+        v1 = (((a1[3][10] == a0[11]) % 8) <= ((33 && 6) + (a1[2][2] < v1)));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v3 = (((i5 < v1) - (82 && 22)) >= ((i5 + i5) == (41 - 51)));
+            v2 = (((40 % 9) || (a1[2][14] + v0)) / 5);
+            v0 = (((a0[3] > a1[2][10]) && (23 || v0)) < ((v1 * i4) - (a1[3][9] - i5)));
+        }
+        a1[2][10] = (((10 % 7) >= (v1 / 1)) / 4);
+    }
+    if ((((41 - a1[0][0]) + (a0[2] % 4)) != ((v1 + 56) % 3))) {
+        a0[0] = (((v2 > v3) && (a0[11] * a0[14])) % 5);
+        v0 = (((v2 - v2) != (v2 < a0[2])) + ((v2 + 81) / 7));
+        v0 = (((82 || v3) - (a1[3][14] / 8)) || ((25 || v3) ? (v0 % 3) : (v1 / 1)));
+    } else {
+        a1[2][2] = (((69 <= v0) == (v1 > v2)) ? ((v3 - a0[1]) ? (v3 ? a1[2][15] : v0) : (a0[5] || v1)) : ((12 <= 15) % 7));
+        v1 = (((84 ? v1 : v0) ? (v2 < 52) : (0 % 9)) - ((82 <= v0) >= (v3 == 22)));
+        v1 = (((a1[2][2] != v1) ? (v1 * a0[2]) : (82 * v1)) >= ((v0 - 97) && (a0[12] ? 78 : v2)));
+    }
+    v2 = (((66 || v3) != (a0[9] || 67)) != ((v1 >= a0[14]) - (a0[15] % 6)));
+    if ((((v2 > v3) != (a0[7] < v2)) % 2)) {
+        a0[2] = (((a0[13] / 6) >= (86 + v3)) <= ((a1[1][12] / 4) || (v1 - v1)));
+        v1 = (((23 <= a1[0][5]) > (v3 && v3)) > ((a1[2][2] % 2) / 1));
+        a0[14] = (((v1 && v2) % 7) && ((v1 / 4) ? (a1[1][12] + v0) : (79 || v0)));
+    } else {
+        v2 = (((v2 / 4) == (95 * a0[7])) ? ((v2 ? v1 : a1[3][5]) < (v2 ? v1 : 80)) : ((3 != 36) ? (24 - v0) : (v2 > a1[2][11])));
+        a0[11] = (((v0 < a0[1]) && (a1[3][13] + v2)) * ((v2 + a1[1][1]) != (69 * v2)));
+        a1[3][14] = (((6 / 9) <= (a0[8] + v1)) % 4);
+    }
+    v3 = (((v1 > a0[5]) >= (v2 < a1[1][8])) + ((a1[0][11] % 8) && (64 / 1)));
+    return (((v1 != v3) || (v1 / 1)) || ((67 - v1) - (34 || a1[1][6])));
+}
+int f1() {
+    int v0 = 91;
+    int v1 = 87;
+    int v2 = 58;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((v3 % 2) % 4) / 2);
+    if ((((73 ? v3 : v2) != (v3 != 55)) * ((a1[2][4] == 72) ? (v2 < 35) : (v1 * 28)))) {
+        v0 = (((63 - 81) || (a0[12] ? v1 : v3)) > ((v1 - v3) ? (v1 <= a1[3][8]) : (65 < 98)));
+        v2 = (((a1[3][7] ? v2 : v0) <= (91 > 20)) != ((a1[2][12] >= 93) && (14 && v3)));
+        v0 = (((86 != 58) ? (85 / 2) : (28 <= a0[8])) + ((v2 > 55) >= (v0 * a1[2][11])));
+    } else {
+        a0[6] = (((v3 < v2) >= (16 - v2)) ? ((v0 != 81) != (15 >= v0)) : ((v2 <= v2) + (v3 ? 14 : v2)));
+        a1[2][2] = (((31 != v2) || (v3 ? v0 : 48)) / 6);
+        v2 = (((a0[3] != a1[2][14]) && (v2 > a0[15])) > ((a0[10] + v2) * (a0[15] ? a1[2][14] : v1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[1][6] = (((29 * a0[2]) ? (v1 - a1[3][9]) : (i0 == v3)) % 8);
+            v3 = (((v2 * v2) / 6) % 7);
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a0[2] = (((a0[12] % 3) || (i0 > a0[13])) % 8);
+                v2 = (((v1 > v1) % 6) == ((70 * 95) < (v3 <= 89)));
+                a0[9] = (((62 ? v0 : i0) % 9) - ((i1 == v0) % 6));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    a0[8] = (((99 ? v1 : a1[1][1]) < (v1 || 45)) ? ((a0[14] + a0[8]) * (a0[14] * v0)) : ((a1[1][2] && v0) * (v2 + a0[14])));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v0 = (((v2 || i2) + (v2 != a0[3])) > ((v2 == v3) && (a1[3][2] > a1[0][13])));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((a1[0][9] != v1) + (29 / 4)) + ((v0 || i2) ? (v0 != v0) : (46 + v1)));
+                    v1 = (((i3 % 3) || (68 + 9)) || ((34 && v2) % 9));
+                    v1 = (((i3 && 53) || (v2 != a0[12])) + ((v2 / 2) || (v3 != v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v0 = (((94 - a1[2][9]) * (21 ? a1[1][9] : 95)) != ((v0 || v3) * (v1 == v0)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((58 >= v2) < (a1[1][10] % 2)) >= ((v3 != v0) == (v2 ? 5 : v1)))) {
+        v0 = (((20 > 15) ? (v3 % 3) : (73 && v2)) && ((v1 * v1) <= (v3 ? v3 : 15)));
+        v2 = (((v1 || v1) == (v3 == v1)) > ((a1[3][4] * a0[14]) >= (v1 >= v0)));
+        a0[14] = (((60 % 6) % 2) > ((v1 >= 87) * (42 ? v1 : v2)));
+    } else {
+        v2 = (((17 ? v1 : v2) <= (3 > v0)) != ((v2 >= v1) % 1));
+        v3 = (((v1 ? v1 : a1[3][4]) > (a1[2][0] >= a0[2])) - ((94 % 8) >= (v2 < a0[3])));
+        v2 = (((v1 * v2) % 7) > ((a0[10] <= v1) + (v1 ? a1[3][1] : a0[9])));
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((44 * v1) != (a1[1][8] <= a0[12])) % 8);
+            a0[13] = (((v0 == a1[2][6]) - (i4 == v0)) == ((v3 * a0[5]) ? (55 >= v3) : (a1[0][5] != i4)));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                if ((4 < i5) > 64) break;
+                a1[1][12] = (((v3 || 99) - (v1 * v2)) % 9);
+                a1[3][4] = (((v1 / 1) + (v2 / 4)) != ((69 > 2) - (v1 || i4)));
+                a0[13] = (((v0 > 80) / 6) == ((a0[9] > i5) < (i4 < i4)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    v1 = (((40 || v3) >= (a0[1] / 7)) % 4);
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    if ((v0 ? i6 : v1) > 62) break;
+                    v3 = (((v1 <= a0[10]) * (v3 / 2)) * ((a1[2][3] / 4) != (v2 ? 61 : v2)));
+                    a0[10] = (((a1[0][3] != i6) / 7) ? ((99 - 90) != (v1 / 9)) : ((a1[1][6] >= a0[0]) % 1));
+                    v0 = (((v1 > v0) && (a0[7] && a0[10])) != ((v1 && 57) < (66 % 4)));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((a1[2][14] + i6) % 5) * ((v3 - v0) >= (v1 >= a0[2])));
+            v3 = (((v1 / 2) ? (v1 && 59) : (a1[1][14] % 9)) / 9);
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            a1[0][8] = (((a1[0][3] < 13) || (61 > v1)) - ((i8 <= 36) * (13 == a0[2])));
+            v0 = (((24 / 8) / 4) / 8);
+            {
+                int i9 = 0;
+                do {
+                    v2 = (((30 / 7) * (v1 % 1)) > ((i9 >= a1[3][2]) * (v3 > i8)));
+                    v1 = (((53 <= i8) - (a1[3][6] && 0)) || ((53 ? v2 : v0) % 2));
+                    a0[11] = (((i9 && a0[11]) >= (a1[0][12] * a0[12])) < ((64 >= v2) && (a0[0] / 1)));
+                    i9 = i9 + 1;
+                } while (i9 < 3);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((92 % 8) < (a0[4] * v2)) % 8);
+}
+int f2() {
+    int v0 = 3;
+    int v1 = 74;
+    int v2 = 4;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((i0 / 6) > 89) break;
+            v3 = (((v1 && a1[0][1]) ? (v3 >= v0) : (v3 >= 43)) % 5);
+            v3 = (((v1 == a1[3][11]) <= (95 - v2)) ? ((35 / 5) && (a0[4] ? i0 : v2)) : ((v3 || a1[2][10]) != (v1 == v0)));
+            {
+                int i1 = 0;
+                do {
+                    a1[3][14] = (((a1[0][3] < v1) > (i1 && v0)) / 1);
+                    v1 = (((88 <= v0) - (a1[2][0] % 5)) * ((v0 + v0) - (v1 != a0[0])));
+                    a0[9] = (((26 >= v1) && (i0 < i0)) % 7);
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                a1[3][2] = (((v1 > 92) != (i3 + 52)) || ((a1[2][4] + a1[3][8]) > (75 - i2)));
+                a0[15] = (((a1[3][14] ? i2 : 26) && (i3 > a1[1][4])) >= ((88 * a1[0][1]) + (74 == 29)));
+                a1[3][12] = (((v3 ? v3 : a1[2][1]) ? (v3 + v3) : (v1 < 77)) == ((i3 >= a1[2][10]) <= (v3 == a0[1])));
+                i3 = i3 + 1;
+            }
+        }
+        a0[1] = (((v2 * v2) <= (i2 % 5)) || ((v2 ? 5 : v1) > (v2 * a1[2][5])));
+        a1[3][3] = (((v3 >= v3) ? (92 ? v1 : v3) : (22 && a0[15])) >= ((i2 < v1) / 3));
+    }
+    if ((((v3 && v1) - (13 ? v1 : 32)) / 8)) {
+        v1 = (((v3 >= a1[2][1]) / 3) / 4);
+        v2 = (((a0[7] ? v3 : v2) - (v1 - a0[8])) % 4);
+        v1 = (((v1 % 8) * (22 < a0[12])) == ((v0 * v1) && (v3 || v2)));
+    } else {
+        v1 = (((73 + v3) < (v2 != v3)) || ((a1[2][10] + a0[6]) % 6));
+        v3 = (((9 + a1[3][9]) < (v1 ? a1[2][13] : v1)) ? ((58 - 79) != (0 || 15)) : ((a0[5] || a0[3]) > (97 * v2)));
+        v3 = (((v1 % 8) == (76 / 4)) <= ((a1[2][1] ? v0 : a0[10]) && (v1 % 3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((84 > v1) <= (81 >= v0)) * ((a0[6] % 6) - (13 <= v2)));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                v1 = (((61 != v2) != (68 / 5)) ? ((v0 * 3) != (7 && 49)) : ((v2 ? 86 : a0[13]) <= (55 ? i4 : v1)));
+                v1 = (((v1 == v3) <= (v3 > 62)) ? ((a0[11] < v2) + (a0[3] < 29)) : ((v3 == v2) && (28 == v3)));
+                v1 = (((79 - 49) > (14 ? 83 : v2)) / 8);
+            }
+            v3 = (((i4 != a0[2]) && (v2 && v0)) / 4);
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    a1[1][13] = (((v3 > v0) % 9) > ((v3 % 3) != (v2 != v0)));
+    if ((((v3 && v2) <= (21 <= v2)) && ((a1[2][5] || 13) / 1))) {
+        v1 = (((a0[9] + 49) + (v3 ? a1[3][2] : v1)) ? ((90 * v0) ? (a1[3][1] ? v2 : 51) : (a1[0][9] == v0)) : ((v2 ? 70 : v3) ? (v1 - 53) : (a1[3][4] + 80)));
+        v3 = (((v1 - a1[0][13]) || (a0[7] ? a0[15] : v2)) > ((a1[0][1] * a1[3][14]) + (v1 < v1)));
+        v3 = (((a0[15] == v2) ? (58 * v1) : (a1[1][12] < v1)) || ((51 + v2) - (a0[6] <= v2)));
+    } else {
+        v3 = (((v1 != v1) != (28 && v3)) <= ((a0[3] == a1[0][9]) && (78 + 7)));
+        v3 = (((a1[0][0] - 78) != (a0[12] - v1)) ? ((v0 == v2) * (28 * v1)) : ((a1[3][1] ? a1[1][10] : v0) != (77 ? v0 : a1[1][7])));
+        a1[0][8] = (((31 <= v0) && (90 != a0[5])) && ((86 && a0[14]) - (v1 < v3)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v2 >= v0) > 50) break;
+            v3 = (((v0 > v0) - (v1 - v1)) <= ((v0 && 5) && (v1 ? v1 : v1)));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                if ((a0[10] ? a0[14] : v3) > 63) break;
+                v1 = (((51 ? v0 : i6) != (v0 ? a1[1][13] : 2)) - ((60 - 97) >= (i6 / 3)));
+                v3 = (((v2 ? 24 : a1[2][8]) ? (a0[10] - a0[10]) : (i6 > a0[10])) || ((v0 > 81) && (a1[0][9] - i6)));
+                v3 = (((a0[7] != v2) || (a1[1][11] * v3)) / 2);
+            }
+            v0 = (((v3 != v1) >= (53 % 6)) && ((62 != v2) * (v2 ? 58 : a0[7])));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    {
+        int i8 = 0;
+        do {
+            v2 = (((a0[3] > a1[3][8]) - (v2 || v1)) * ((a1[1][6] >= 16) == (v2 <= 96)));
+            v3 = (((v2 + v3) / 3) && ((i8 ? 40 : 32) % 8));
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    v1 = (((a1[0][1] <= v1) >= (a0[12] > 39)) + ((43 && a0[8]) && (a1[2][0] ? v3 : a1[2][7])));
+                    v2 = (((v3 < a0[3]) == (v3 * v3)) == ((v2 ? v0 : a1[0][15]) || (a0[0] != 74)));
+                    a0[7] = (((24 || a1[1][7]) > (11 <= v1)) || ((a1[3][7] || 39) % 5));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    v0 = (((v2 * v0) * (a1[3][7] * v2)) || ((v0 && v0) != (60 < v1)));
+    {
+        int i10 = 0;
+        while (i10 < 4) {
+            v3 = (((38 ? i10 : 77) > (a1[0][1] * 71)) % 4);
+            {
+                int i11 = 0;
+                while (i11 < 8) {
+                    v2 = (((a0[3] - v3) + (v3 == i11)) + ((85 > 46) ? (v1 < a1[2][4]) : (i11 == v3)));
+                    a1[2][3] = (((79 || v1) < (98 || v1)) % 5);
+                    a0[3] = (((a1[0][6] * 75) < (v2 ? a0[1] : i11)) != ((v1 >= v2) != (a1[2][2] <= 7)));
+                    i11 = i11 + 1;
+                }
+            }
+            v2 = (((i10 > v0) > (40 - a1[2][2])) == ((a0[1] % 1) < (49 - v0)));
+            i10 = i10 + 1;
+        }
+    }
+    return (((15 <= v3) || (10 * v2)) <= ((v3 > 23) / 5));
+}
+int f3() {
+    int v0 = 37;
+    int v1 = 36;
+    int v2 = 94;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        a0[6] = (((53 * i0) == (a1[2][0] ? i0 : 98)) >= ((i0 + v2) == (a0[13] * a1[2][1])));
+        a0[9] = (((v0 <= i0) - (60 ? a0[5] : a1[2][13])) < ((72 + v3) ? (99 ? v2 : 35) : (v0 == 46)));
+        {
+            int i1 = 0;
+            do {
+                v2 = (((5 >= 22) - (56 - v2)) != ((29 <= 42) == (22 + v2)));
+                v1 = (((a1[2][2] * 55) != (12 - v0)) ? ((a0[7] * 91) || (i0 > v2)) : ((v0 || v0) ? (v0 == a0[3]) : (v2 % 1)));
+                a0[10] = (((i1 < i1) >= (i0 && a0[10])) > ((99 ? 14 : a1[2][10]) <= (i1 == i1)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    v3 = (((v1 ? a0[0] : v3) ? (43 < a1[3][9]) : (v1 / 6)) + ((v2 || a1[2][0]) ? (v1 == 73) : (v0 % 1)));
+    if ((((a0[1] > v3) - (a0[11] != v2)) <= ((95 && v2) > (a0[11] ? a0[9] : 52)))) {
+        a1[1][9] = (((99 && 49) % 4) + ((a1[0][0] && 73) == (v2 || v3)));
+        v2 = (((v0 <= v3) <= (99 - v0)) + ((v1 != a0[10]) ? (v3 != v2) : (v0 ? v2 : 85)));
+        a0[10] = (((a0[15] ? v1 : v1) < (v0 != v3)) + ((37 < v0) ? (62 && 40) : (v1 && v2)));
+    } else {
+        v0 = (((v2 + a0[11]) % 6) - ((v1 + a1[0][9]) + (v3 - v1)));
+        v0 = (((v1 || v2) > (v1 > v2)) <= ((49 ? a0[14] : v2) >= (v3 >= a1[1][14])));
+        v1 = (((a1[1][11] < 31) ? (a0[15] == 60) : (8 * 85)) == ((37 <= 56) > (v1 * a0[8])));
+    }
+    v0 = (((v1 / 2) || (v3 * v0)) ? ((v0 ? a1[3][13] : v0) || (v0 ? a1[0][6] : v1)) : ((a1[1][7] <= v1) <= (a0[12] > a0[9])));
+    if ((((49 && v3) < (91 == v1)) > ((v2 / 3) || (v3 >= 9)))) {
+        v0 = (((v2 || 78) == (a0[6] / 9)) - ((a0[1] == a0[12]) / 2));
+        a1[1][5] = (((8 * v3) * (v1 < v1)) && ((12 / 3) == (v2 + a0[5])));
+        v2 = (((a0[5] / 7) ? (v0 && v0) : (v3 < 30)) - ((a0[11] ? a0[12] : a1[1][12]) - (v3 > a0[1])));
+    } else {
+        v0 = (((51 < a0[12]) + (a1[1][3] > 13)) >= ((v2 == v3) <= (a0[5] >= v3)));
+        v3 = (((v1 < v1) * (v2 != 14)) || ((a1[3][9] && v1) / 9));
+        a1[3][10] = (((v2 + v1) * (v0 || v1)) + ((v3 + v1) && (81 % 1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((v2 + a0[13]) > 53) break;
+            v2 = (((a1[0][15] || 45) * (v1 < v2)) != ((v0 + a0[4]) == (v1 < 32)));
+            {
+                int i3 = 0;
+                do {
+                    a0[0] = (((a0[4] == v3) == (a1[1][1] == v3)) - ((a0[11] + v2) ? (v2 * a1[0][14]) : (31 - i2)));
+                    v2 = (((a1[0][14] || v2) * (64 == i3)) || ((75 || v2) / 5));
+                    a0[11] = (((i3 >= v1) / 3) == ((v3 / 2) + (a1[0][13] ? i3 : i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v3 = (((20 + i2) * (v3 == a1[3][14])) == ((59 > v0) / 5));
+            i2 = i2 + 1;
+        }
+    }
+    a0[15] = (((a0[10] > 53) ? (46 != a0[8]) : (v3 / 2)) != ((v1 == a1[2][10]) % 7));
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            if ((96 - 58) > 73) break;
+            v0 = (((a1[1][13] != 84) && (a1[1][3] ? v2 : a1[2][15])) ? ((a0[11] == v3) > (v3 / 7)) : ((96 * a0[1]) ? (a1[2][14] > v0) : (2 ? a0[1] : 6)));
+            a0[11] = (((i4 - v2) >= (v2 - i5)) <= ((v2 != v0) - (v1 >= a0[11])));
+            v2 = (((10 < 92) + (i5 > v2)) ? ((v0 < 24) ? (a0[10] < v2) : (31 || v1)) : ((a0[7] > a0[1]) >= (a1[3][13] >= v0)));
+        }
+        a0[11] = (((i4 / 9) * (a1[2][14] >= v0)) > ((a1[2][3] % 5) >= (v0 < 16)));
+        v1 = (((a0[8] % 8) && (v2 % 2)) - ((a1[3][15] / 6) && (v3 && 62)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((77 > a0[11]) > 81) break;
+                v0 = (((v3 ? v1 : i6) + (a1[1][2] || 3)) * ((i6 - i6) && (v0 && v1)));
+                v0 = (((a1[3][9] > 16) ? (a0[11] * i6) : (v1 != a1[3][11])) + ((i6 + v3) % 5));
+                a1[1][1] = (((50 != v3) + (v0 > v2)) % 6);
+            }
+            a0[10] = (((87 <= v0) <= (a0[5] ? 63 : v0)) ? ((v2 * 8) < (23 && v2)) : ((v3 >= v0) * (i6 * 9)));
+            v1 = (((85 * v1) * (v3 * i6)) + ((96 != a1[3][1]) <= (v0 == v3)));
+            i6 = i6 + 1;
+        }
+    }
+    v0 = (((a0[7] && v3) - (v0 ? v0 : v0)) >= ((v1 == v3) ? (v0 >= 18) : (v2 ? a1[2][9] : v3)));
+    return (((0 && v0) == (v3 >= a1[3][0])) || ((v0 >= 15) > (v2 - v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,106 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 88;
+    int v2 = 74;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 * a0[8]) > (21 >= v1)) ? ((28 ? a0[10] : v0) > (v0 + 87)) : ((a1[2][4] * 26) > (6 ? 28 : a1[1][13])))) {
+        a1[1][7] = (((v3 == v0) >= (v0 == 34)) < ((v1 % 2) ? (32 - 20) : (v1 < 71)));
+        v1 = (((a0[2] ? v2 : 86) - (v1 > v1)) / 6);
+        v1 = (((v0 != v0) ? (v3 % 2) : (v0 != v3)) / 1);
+    } else {
+        a0[3] = (((a0[0] >= a1[3][13]) * (86 * v2)) == ((65 == a0[5]) / 2));
+        v2 = (((a0[1] > 38) < (v2 % 8)) % 4);
+        v2 = (((47 ? 22 : v1) == (v0 != v0)) && ((a1[3][5] && a0[2]) > (a0[10] + a1[3][4])));
+    }
+    a1[1][3] = (((v2 == v3) < (v1 && a0[12])) * ((v3 % 6) > (v3 > 41)));
+    if ((((1 || v2) <= (a0[12] > a0[8])) && ((v1 ? 74 : a0[7]) * (v3 && 78)))) {
+        v1 = (((a0[0] - v0) <= (v3 == 9)) < ((58 ? v2 : v3) ? (83 / 6) : (v0 >= v1)));
+        v3 = (((a0[6] % 4) + (a0[6] % 5)) - ((a0[8] != v0) * (v2 % 6)));
+        v2 = (((12 > v2) % 5) ? ((v2 > v0) ? (v0 <= a1[1][0]) : (v3 == v3)) : ((v2 < 1) && (65 - a1[2][4])));
+    } else {
+        v3 = (((v3 && 29) ? (a0[6] + a0[11]) : (v0 ? 54 : a0[2])) ? ((v3 ? a0[11] : v1) ? (v2 - v0) : (81 % 3)) : ((v2 >= v3) * (v3 - 84)));
+        v1 = (((v1 <= v2) && (a1[1][12] == v2)) - ((96 >= v2) + (v2 >= 52)));
+        v3 = (((a0[5] == 36) / 8) * ((43 >= 68) >= (65 / 6)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((v0 || a1[3][9]) > 65) break;
+            v1 = (((v3 - v2) || (a0[5] * v2)) ? ((a1[3][9] == a1[1][5]) % 2) : ((39 % 2) / 8));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[15] = (((40 && a1[2][7]) || (i0 + 1)) >= ((i0 + i1) >= (i1 ? a0[11] : 75)));
+                a1[1][12] = (((v2 * v3) || (55 && v0)) * ((i1 * 49) - (a1[0][3] < v1)));
+                v3 = (((5 < v1) == (v0 || i1)) + ((i1 >= 19) < (85 && v2)));
+            }
+            v2 = (((v0 - 24) % 1) - ((i0 + v2) < (a1[2][15] >= i0)));
+            i0 = i0 + 1;
+        }
+    }
+    a0[11] = (((v0 || v0) || (15 - v1)) * ((v1 == v3) && (a1[2][0] >= 31)));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v1 = (((85 < v2) <= (v2 < v2)) - ((v1 != i2) * (a0[12] != v3)));
+            {
+                int i3 = 0;
+                do {
+                    if ((i2 <= v2) > 81) break;
+                    v0 = (((66 % 1) ? (a1[3][10] % 1) : (i3 >= i3)) == ((i2 * a1[3][3]) || (i3 * v2)));
+                    a1[3][7] = (((a1[2][14] == 41) >= (v0 && v2)) - ((i2 / 5) < (v3 == 52)));
+                    v1 = (((57 || 77) < (70 * i3)) + ((2 < v3) % 3));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v2 = (((i2 > a0[4]) / 2) % 1);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((51 >= v0) <= (v1 * v3)) && ((v3 / 1) && (2 >= 51)))) {
+        a0[12] = (((v0 / 1) % 3) || ((a0[8] % 9) * (v2 - 72)));
+        v1 = (((v0 && v0) > (a1[1][6] ? v2 : v0)) % 4);
+        a1[0][3] = (((a1[2][8] <= v2) < (42 <= v3)) >= ((a0[4] > v1) + (a1[3][7] == v3)));
+    } else {
+        v2 = (((67 == 67) || (v1 <= 75)) / 7);
+        v1 = (((v1 ? v3 : v1) >= (v1 - v0)) > ((9 && v1) >= (v3 > v0)));
+        a1[0][11] = (((a0[9] ? v2 : v2) <= (v3 ? v2 : v2)) < ((v0 % 4) * (v2 % 1)));
+    }
+    if ((((v3 + a1[2][1]) || (v1 && a1[1][6])) != ((v0 == v0) != (v3 <= v2)))) {
+        v3 = (((a1[3][1] + v1) ? (v2 < 42) : (v1 + a1[2][6])) - ((v1 + a1[2][7]) / 4));
+        v2 = (((a1[3][11] != 46) != (v0 ? v2 : v2)) <= ((a0[13] < v3) ? (v1 + v2) : (v3 ? a0[0] : v3)));
+        v1 = (((a1[2][9] % 6) % 9) && ((v2 < 74) - (38 != v2)));
+    } else {
+        v3 = (((a1[3][11] ? v0 : a1[1][8]) > (a1[0][13] >= a0[12])) + ((v1 * a0[11]) <= (a0[0] / 9)));
+        v3 = (((v3 > v2) % 5) % 9);
+        v0 = (((v2 <= v1) == (v0 <= 72)) < ((v0 ? a0[12] : v0) < (a1[1][11] < 91)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v0 > 89) * (a0[14] > v2)) + ((31 - v2) || (i4 % 7)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v2 = (((i5 % 7) == (v2 != v3)) == ((v2 - v3) ? (51 + v2) : (v3 - a0[0])));
+                v2 = (((i5 * i4) % 4) >= ((v1 - v1) ? (a1[0][8] != v3) : (v3 && 59)));
+                v2 = (((a0[0] > i4) - (v2 ? 48 : 98)) > ((v3 / 4) + (a0[13] ? a0[8] : a1[0][8])));
+            }
+            v1 = (((v1 || a0[1]) ? (34 ? a1[1][4] : a1[3][13]) : (95 <= v3)) + ((v2 / 5) + (a1[0][14] ? v0 : v2)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    if ((((a1[0][10] / 3) && (1 % 4)) < ((55 ? 41 : 75) > (a0[12] / 5)))) {
+        v2 = (((v0 || v0) < (a0[8] != a1[1][15])) == ((v3 || v1) * (a0[7] ? a0[7] : v1)));
+        a1[1][1] = (((21 - a0[7]) % 4) <= ((86 * a1[3][3]) - (v0 > v3)));
+        v2 = (((a1[0][2] * 20) < (a0[14] + v2)) <= ((v3 / 1) ? (v3 * v3) : (v2 <= v1)));
+    } else {
+        v0 = (((v0 ? 30 : 61) != (v0 > a0[15])) ? ((37 > v1) ? (v3 ? v2 : 16) : (v3 % 6)) : ((a1[1][1] <= v3) == (21 > 53)));
+        a1[3][2] = (((v3 || v3) - (v1 ? v1 : a0[12])) % 3);
+        a0[2] = (((v1 > 25) >= (91 ? v2 : 31)) ? ((a0[14] && 17) % 9) : ((v2 || v1) - (v3 <= v0)));
+    }
+    return (((48 >= a0[10]) ? (22 ? v3 : 60) : (a0[15] < 20)) / 4);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,116 @@
+int f0() {
+    int v0 = 75;
+    int v1 = 13;
+    int v2 = 76;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    a1[3][11] = (((a0[1] < a0[3]) < (v0 - a0[5])) - ((v1 > a0[2]) >= (v1 < 63)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((i0 * v0) > 52) break;
+        {
+            int i1 = 0;
+            do {
+                a0[0] = (((v1 / 5) <= (i1 ? 73 : v2)) - ((a1[2][9] < 64) <= (i1 && a1[2][15])));
+                v2 = (((v0 <= 58) <= (a1[3][15] || v1)) || ((22 >= a0[1]) ? (a1[1][15] != a1[0][0]) : (v3 < v1)));
+                v3 = (((0 != v3) ? (a1[3][12] > v1) : (i0 >= i1)) ? ((v1 >= a1[2][0]) ? (95 % 2) : (87 ? 84 : 21)) : ((v0 >= 89) && (42 || a1[2][2])));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v2 = (((v1 > 16) && (55 || 63)) ? ((v2 >= v2) == (86 || 86)) : ((i0 % 3) || (26 ? a0[6] : a1[1][9])));
+        v0 = (((v1 || v0) * (v2 < 10)) <= ((a1[3][13] / 9) / 9));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((a1[1][3] * 65) > 61) break;
+        v2 = (((98 == 12) >= (v3 <= a1[0][4])) == ((87 ? v0 : a1[1][4]) + (v0 / 7)));
+        v3 = (((v0 + a1[2][11]) ? (a1[0][3] && i2) : (v2 > 73)) && ((v2 ? 14 : v0) / 7));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((v2 || v1) + (i3 < a0[13])) + ((v1 ? 9 : a0[11]) == (a1[3][4] / 4)));
+                v2 = (((v0 ? v2 : a0[0]) <= (v3 || v1)) * ((v3 - 4) + (i3 ? a1[1][2] : a0[14])));
+                v2 = (((v0 < 53) && (65 % 9)) == ((3 || i2) == (4 < 33)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    a1[3][11] = (((a1[1][4] > 14) ? (90 <= v1) : (v0 != a0[0])) % 9);
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a0[13] = (((v1 - v1) + (v2 < v3)) <= ((a1[3][2] - v2) > (36 && a1[2][2])));
+        v3 = (((80 - a1[0][10]) > (v1 ? v3 : a1[0][1])) || ((10 >= 92) ? (v3 ? i4 : v1) : (v0 ? a1[2][2] : v3)));
+        {
+            int i5 = 0;
+            do {
+                if ((v2 / 6) > 51) break;
+                v2 = (((i5 != v1) <= (19 != 85)) && ((v2 ? a1[0][2] : 1) < (76 >= v1)));
+                a0[13] = (((i5 >= v1) && (30 / 8)) || ((66 || v2) >= (10 % 5)));
+                v0 = (((a1[2][5] < v0) && (v0 + a0[13])) && ((i5 % 9) != (a0[11] < i5)));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                a1[3][2] = (((i7 || v3) == (71 > a0[1])) - ((22 + i6) ? (v2 ? a0[9] : 19) : (45 || v1)));
+                v0 = (((a1[2][1] + v0) ? (v2 - i7) : (38 > 22)) <= ((v3 % 6) ? (i7 || v1) : (7 == 24)));
+                v1 = (((v1 + i7) >= (a0[9] ? v2 : 78)) || ((v3 / 4) && (v3 == v3)));
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        v1 = (((v0 && v2) ? (a1[1][0] <= i6) : (90 == 9)) / 7);
+        v3 = (((v2 / 9) && (34 ? v2 : 41)) ? ((a0[8] != 93) || (i6 || i6)) : ((v1 > i6) && (v1 ? 38 : a0[0])));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            if ((v1 > v1) > 57) break;
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    a0[10] = (((a0[1] == i9) != (63 + v1)) ? ((v2 % 4) >= (v2 > 91)) : ((41 + v1) || (v0 / 2)));
+                    v2 = (((16 % 1) > (a0[6] && v0)) < ((v2 % 7) || (v3 == v1)));
+                    v0 = (((a0[14] >= v0) - (v3 * i8)) <= ((v2 >= a1[1][14]) == (a0[0] < v0)));
+                    i9 = i9 + 1;
+                }
+            }
+            v3 = (((5 / 8) && (v2 % 4)) * ((v0 / 4) / 7));
+            v1 = (((v1 != 82) == (v2 % 4)) < ((a1[2][2] * v0) ? (26 > v3) : (a0[15] == 26)));
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 6) {
+            v0 = (((i10 == a0[3]) * (v3 - 88)) || ((v1 == v3) == (v1 <= a0[8])));
+            v0 = (((77 ? 28 : v2) < (v2 % 8)) % 1);
+            {
+                int i11 = 0;
+                do {
+                    a1[0][7] = (((v1 != a1[3][13]) || (99 % 6)) - ((v3 == 85) != (v1 * v0)));
+                    a1[1][2] = (((v1 && 36) - (i11 > v1)) ? ((29 <= v2) >= (a1[0][11] - i11)) : ((i10 ? v3 : 50) != (11 ? 21 : 58)));
+                    v3 = (((a1[3][14] - a1[1][13]) - (11 ? a1[1][10] : i10)) && ((a1[2][11] != i10) - (64 == 25)));
+                    i11 = i11 + 1;
+                } while (i11 < 2);
+            }
+            i10 = i10 + 1;
+        }
+    }
+    if ((((a0[7] ? v1 : v0) == (a1[3][9] > v0)) || ((v2 ? v1 : a0[14]) / 2))) {
+        v2 = (((v3 - v3) != (v1 || v2)) && ((a0[3] <= v2) == (v0 / 8)));
+        a1[1][13] = (((v3 || v3) <= (v1 <= 94)) <= ((v0 / 8) < (a0[6] == a1[0][2])));
+        v0 = (((8 - a0[11]) > (v3 + 67)) == ((53 > v0) / 3));
+    } else {
+        a1[0][8] = (((v0 && v2) && (v3 / 2)) || ((v2 ? a0[3] : v3) >= (v3 ? a0[10] : a0[10])));
+        a1[2][15] = (((v2 % 5) == (37 >= v2)) * ((a1[0][11] <= 5) || (v1 / 8)));
+        v0 = (((v2 >= v1) != (v0 != v2)) || ((a1[0][9] ? v2 : a0[15]) && (a1[2][3] || 41)));
+    }
+    v1 = (((v1 >= v1) ? (v1 >= a1[1][11]) : (v2 ? v1 : 97)) / 6);
+    return (((v3 ? v1 : v2) * (v1 ? 3 : a0[3])) >= ((v3 == v2) < (v3 ? a1[1][6] : v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,228 @@
+int f0() {
+    int v0 = 51;
+    int v1 = 94;
+    int v2 = 3;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v1 = (((i0 >= v3) && (v0 <= v2)) ? ((v1 == 40) - (a1[0][0] / 3)) : ((a1[0][1] >= v3) + (v1 % 7)));
+        a0[5] = (((a1[0][12] - 13) == (a0[10] ? a1[1][5] : v2)) != ((80 ? 57 : v2) / 8));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v2 = (((a1[1][8] && v0) && (a0[13] - a1[1][14])) <= ((v1 >= 35) / 9));
+                v1 = (((v1 ? 54 : 90) * (v3 / 5)) / 8);
+                v0 = (((v0 ? a0[8] : i1) == (i0 == v0)) >= ((a0[0] + 53) && (v3 && a0[4])));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                a0[5] = (((a0[9] != a1[1][7]) && (i3 >= i2)) - ((83 ? a0[9] : i2) * (v3 - i3)));
+                v3 = (((54 <= 54) >= (v0 > a0[3])) || ((43 && 51) == (76 * 60)));
+                v0 = (((i2 < 88) || (0 <= i2)) != ((v1 * v3) || (v1 - i3)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((a1[2][1] && v2) == (a1[3][6] / 3)) || ((a0[5] < i2) ? (v1 ? a1[1][2] : v0) : (v0 / 2)));
+        v3 = (((v2 + v1) <= (93 == 25)) == ((71 / 8) / 1));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a1[3][4] * v0) > 66) break;
+            v2 = (((i4 <= v1) == (v0 > v2)) ? ((i4 > a0[4]) == (v0 ? 37 : i4)) : ((v0 - a1[1][2]) != (48 != 73)));
+            v1 = (((15 != v1) > (a0[4] - a1[2][8])) != ((v3 && a0[4]) / 8));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v1 = (((90 ? i4 : a1[1][11]) && (v2 % 1)) + ((i4 > 71) % 8));
+                v0 = (((64 < v2) + (i4 - v1)) >= ((a1[3][5] || 84) && (v1 >= 15)));
+                v3 = (((v0 != a0[9]) && (i5 < 7)) + ((v3 > 71) == (v3 - 76)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v3 = (((94 == v3) + (v2 * 77)) - ((78 || 96) >= (v2 < v1)));
+    {
+        int i6 = 0;
+        do {
+            a0[0] = (((a1[0][2] <= a0[2]) > (v2 && i6)) * ((83 >= v1) >= (v1 - i6)));
+            v2 = (((68 <= a1[3][13]) - (i6 == a0[14])) == ((v2 * v2) % 8));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v0 = (((v2 == 67) + (v3 - a0[11])) < ((a1[2][15] ? v2 : v2) <= (a1[3][14] == a1[0][12])));
+                v0 = (((67 <= v2) ? (a1[0][4] ? v3 : v1) : (a0[11] * i6)) != ((v1 != 38) > (i6 - i7)));
+                v2 = (((v0 / 1) ? (28 - v1) : (i7 - a0[10])) + ((v1 >= v1) || (i7 || a1[3][1])));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            v1 = (((a0[9] ? v0 : 47) <= (77 ? v1 : a0[13])) == ((v3 < i8) ? (v1 * 27) : (84 * a1[0][7])));
+            v0 = (((52 == 38) <= (50 || a0[10])) / 8);
+            for (int i9 = 0; i9 < 4; i9 = i9 + 1) {
+                a1[1][0] = (((a0[7] ? v1 : 15) || (16 ? v2 : i8)) && ((a0[14] || v1) && (49 - v0)));
+                a0[9] = (((i8 || 71) - (v1 % 1)) && ((24 <= v0) / 2));
+                v1 = (((69 == a0[15]) && (v1 ? a1[3][9] : i8)) - ((i9 ? v2 : 56) && (52 && 94)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    if ((((v3 == v3) == (95 == v0)) <= ((v1 % 8) ? (v3 || 87) : (99 ? 56 : a0[13])))) {
+        a0[7] = (((a1[3][10] + v3) < (81 ? 50 : v0)) ? ((41 - v2) || (v0 ? a1[0][11] : v2)) : ((a1[3][6] == a1[3][15]) <= (v0 && a0[13])));
+        a0[0] = (((v0 != 24) < (v1 <= a0[5])) % 5);
+        a1[3][9] = (((42 || 35) % 9) % 9);
+    } else {
+        v3 = (((v3 == a0[8]) % 1) % 8);
+        v3 = (((a1[1][12] / 4) ? (v1 ? 18 : a1[1][10]) : (v1 >= a0[12])) % 2);
+        v3 = (((v1 % 1) / 3) > ((v3 ? a0[1] : a0[3]) <= (v1 != a1[1][10])));
+    }
+    v2 = (((v0 == v2) && (v2 >= a1[1][9])) ? ((v0 % 5) ? (v0 + v1) : (a0[2] % 7)) : ((a1[2][13] > v0) / 5));
+    for (int i10 = 0; i10 < 5; i10 = i10 + 1) {
+        if ((v3 * v1) > 92) break;
+        {
+            int i11 = 0;
+            while (i11 < 6) {
+                if ((a0[2] == v2) > 99) break;
+                v2 = (((a1[2][1] * 14) - (v3 - 23)) - ((26 % 3) <= (i10 < i11)));
+                v1 = (((i11 != i10) && (v1 ? a1[1][12] : i11)) * ((v0 ? a0[3] : a0[10]) ? (a1[0][2] < i11) : (1 - 5)));
+                v1 = (((83 < i10) > (a1[3][9] >= 52)) || ((64 / 2) < (v1 + i11)));
+                i11 = i11 + 1;
+            }
+        }
+        a1[1][9] = (((a0[3] / 4) ? (v0 * 11) : (v2 < 43)) || ((36 * 88) ? (62 * v3) : (a0[6] % 9)));
+        v2 = (((a1[3][2] * 41) - (v1 != i10)) ? ((v0 > a0[9]) ? (v0 <= a0[2]) : (v1 != i10)) : ((v1 + a1[3][9]) && (61 ? 99 : v2)));
+    }
+    if ((((72 ? v3 : v1) ? (v0 != 63) : (a1[2][9] || 40)) <= ((v1 || 68) ? (a0[0] < a1[0][9]) : (v2 * 17)))) {
+        v2 = (((54 ? v3 : a1[2][7]) != (a1[3][1] < v0)) + ((v2 || a1[0][8]) ? (a1[3][3] % 4) : (v1 != 80)));
+        v3 = (((a1[3][6] < v3) > (a1[2][9] + 37)) % 8);
+        v2 = (((v3 >= a1[3][6]) <= (7 <= v3)) == ((24 || v0) > (v2 != v2)));
+    } else {
+        v3 = (((v1 - a0[4]) == (87 >= v2)) ? ((v2 ? 58 : v1) - (44 ? v2 : v1)) : ((60 && v2) % 3));
+        a0[11] = (((70 - 65) || (v2 - a0[6])) / 2);
+        a1[3][4] = (((v1 ? v1 : v1) ? (12 ? v3 : v0) : (a1[1][9] != v1)) < ((v2 >= v3) % 5));
+    }
+    return (((v0 <= a1[3][11]) || (58 < a0[0])) == ((a0[14] != a1[2][5]) - (v1 ? v3 : a0[11])));
+}
+int f1() {
+    int v0 = 69;
+    int v1 = 63;
+    int v2 = 64;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (((91 == a0[0]) / 9) - ((a0[9] && a1[3][15]) == (v1 * 39)));
+        {
+            int i1 = 0;
+            do {
+                a0[4] = (((a1[1][5] + v1) - (13 > a1[3][9])) % 4);
+                v0 = (((i0 == i1) + (v2 < i1)) >= ((13 + a1[2][10]) < (i1 ? 80 : v2)));
+                v3 = (((a0[1] ? 56 : a0[1]) > (v0 && i1)) == ((a1[2][11] > a0[0]) > (v1 % 6)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        a0[5] = (((a1[0][4] || v0) % 3) + ((a1[2][8] - a0[2]) ? (i0 * i0) : (v1 < a0[12])));
+    }
+    v2 = (((99 > a0[5]) <= (a1[2][13] / 9)) ? ((51 <= 52) / 4) : ((a0[9] / 8) - (a1[2][4] % 4)));
+    v0 = (((0 + 5) % 8) < ((v1 != a1[2][15]) + (34 <= 13)));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((a0[2] ? v3 : i2) > (94 > a0[14])) + ((v2 < 52) * (v3 - v2)));
+                    a0[15] = (((v1 - a0[7]) > (a1[1][8] <= 67)) && ((a0[15] - a0[6]) / 8));
+                    a1[2][7] = (((v3 && v3) >= (97 ? a0[15] : v3)) ? ((a0[13] * a0[11]) || (v2 || v2)) : ((i2 && 48) <= (51 && a0[15])));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a1[1][14] = (((v3 < v3) != (21 ? 4 : a0[2])) <= ((2 % 3) - (a1[0][7] % 1)));
+            v1 = (((v2 ? v2 : i2) * (a0[4] <= v0)) % 4);
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        a0[1] = (((v1 ? a1[1][7] : v1) != (v0 != v2)) <= ((15 < v0) <= (95 <= 53)));
+        v0 = (((v1 / 3) % 6) / 9);
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v1 = (((a1[1][11] - a0[2]) < (v2 + v0)) && ((49 ? 80 : a0[15]) != (v2 <= a1[3][12])));
+            v2 = (((v0 > i5) - (v1 >= 56)) % 2);
+            v1 = (((95 < v0) - (a1[3][2] >= 2)) / 7);
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((v0 && 98) ? (83 * a0[6]) : (v2 ? v0 : 91)) / 1);
+            v2 = (((v3 == v1) >= (a1[0][14] ? v0 : i6)) != ((a1[1][10] + v2) <= (25 && 65)));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((81 < a1[0][3]) % 8) * ((a0[4] || 60) != (a0[4] ? 33 : 41)));
+                    v3 = (((70 ? a0[12] : 52) != (30 || i6)) ? ((v3 >= a0[15]) < (v1 >= v1)) : ((v1 || i7) > (v0 ? i6 : a0[9])));
+                    v1 = (((v3 || v1) < (31 <= a1[3][9])) / 2);
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    if ((((23 - 65) ? (65 || v3) : (a0[10] ? 3 : a1[0][13])) >= ((a1[2][5] && v1) / 2))) {
+        v0 = (((a1[2][14] + v0) + (a0[4] - v1)) < ((7 >= 30) % 9));
+        v3 = (((a1[1][5] + 96) * (a1[0][15] % 3)) && ((v3 || a0[8]) != (v0 <= 51)));
+        v0 = (((v2 >= 86) || (v0 != v0)) * ((v0 < 12) ? (v3 ? a1[0][7] : v0) : (v3 / 1)));
+    } else {
+        v3 = (((11 + a0[13]) ? (a0[4] || v0) : (37 == 9)) * ((a1[2][7] != v2) != (v2 != a1[1][10])));
+        a0[9] = (((31 == 33) <= (a1[1][12] || a0[11])) < ((83 > v0) * (52 == v1)));
+        v3 = (((a1[3][10] < v0) ? (v3 ? v0 : v1) : (v0 + v1)) % 7);
+    }
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                do {
+                    if ((a1[0][9] > a1[1][7]) > 54) break;
+                    v1 = (((v3 == 43) ? (v1 == 70) : (43 - 71)) * ((a0[15] < v2) == (21 <= v3)));
+                    a0[12] = (((v0 + a0[7]) != (a1[1][15] != a1[0][14])) ? ((24 != i9) || (a1[0][3] && v1)) : ((a0[8] >= a1[3][6]) ? (a0[8] < 18) : (i8 < 69)));
+                    v3 = (((46 != a0[2]) / 4) / 3);
+                    i9 = i9 + 1;
+                } while (i9 < 8);
+            }
+            v3 = (((v0 * a0[8]) != (a0[6] > 98)) / 6);
+            a0[11] = (((23 >= a1[3][9]) <= (v3 / 6)) / 8);
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    if ((((v2 ? a1[0][10] : a0[2]) + (v2 >= v2)) * ((7 ? a0[12] : 14) > (v1 * 45)))) {
+        v2 = (((a0[5] - v2) / 8) >= ((v1 - a1[2][7]) > (91 - a1[2][9])));
+        a0[11] = (((23 ? 99 : 32) ? (17 * a1[3][13]) : (a1[3][9] < a0[6])) % 2);
+        v2 = (((v3 + 61) <= (75 + a0[12])) < ((v2 != v0) == (44 * v2)));
+    } else {
+        v3 = (((a0[5] + 63) >= (v3 ? a0[2] : a1[0][7])) + ((a0[8] <= v3) && (v1 % 3)));
+        a0[1] = (((a0[14] * v3) % 7) >= ((a1[2][14] * 98) || (a1[0][7] >= v2)));
+        v3 = (((v0 >= a1[2][12]) && (70 && 92)) != ((a0[2] >= v1) || (67 <= a1[1][10])));
+    }
+    for (int i10 = 0; i10 < 6; i10 = i10 + 1) {
+        a1[2][7] = (((i10 <= v0) <= (99 >= 26)) ? ((a1[1][6] && a0[1]) == (v3 % 7)) : ((v1 + a0[1]) + (v2 ? 44 : a0[1])));
+        for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+            v0 = (((v3 - v0) - (v3 / 5)) ? ((64 != v2) * (v2 > v2)) : ((v2 * a1[1][4]) || (v0 * a1[1][0])));
+            v3 = (((i10 > a1[2][4]) ? (67 != v3) : (v2 == v2)) == ((27 * 5) + (a0[14] > a1[0][11])));
+            v3 = (((v1 && a1[1][6]) || (76 + v0)) - ((5 <= v0) == (i10 <= 17)));
+        }
+        a0[5] = (((i10 || 55) / 2) ? ((a0[1] < 61) < (98 * 69)) : ((v2 < a1[3][14]) == (v2 % 9)));
+    }
+    return (((41 * 22) / 1) <= ((35 || v2) + (v0 || v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,339 @@
+int f0() {
+    int v0 = 18;
+    int v1 = 71;
+    int v2 = 88;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    if ((81 >= i0) > 60) break;
+                    v1 = (((a1[2][0] && a1[1][9]) < (i0 + i0)) + ((a1[0][9] != a1[1][14]) ? (24 - v1) : (v3 ? v3 : i0)));
+                    a1[1][9] = (((a1[2][9] * 97) / 6) && ((v3 > 54) ? (v2 + a0[7]) : (v2 >= v1)));
+                    a1[0][5] = (((a0[15] >= v3) ? (a1[3][7] % 4) : (83 == a1[0][8])) + ((v3 || 54) + (i1 && i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a1[3][0] && v1) / 5) > ((a0[15] <= 8) || (v2 * 75)));
+            a1[0][14] = (((a0[13] || v1) < (a1[2][1] * 76)) != ((59 >= a1[0][11]) * (25 || v1)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((33 <= v2) || (30 + a0[2])) != ((a0[8] <= v0) ? (v2 ? 92 : v2) : (v0 - v2)))) {
+        v0 = (((65 + 84) || (a1[0][8] || 9)) != ((v3 != v3) || (v3 && 71)));
+        v0 = (((a1[3][12] == 47) >= (36 - v3)) < ((v3 / 9) / 3));
+        v3 = (((v2 <= 72) * (a0[7] && v0)) - ((a1[0][11] - a0[9]) || (a1[1][10] && v2)));
+    } else {
+        a1[0][5] = (((59 || v3) * (43 && v1)) && ((v3 ? v3 : 32) != (v0 != 19)));
+        v2 = (((52 < v3) + (v3 != v1)) / 2);
+        a1[0][9] = (((32 * 91) == (a1[3][5] <= 83)) < ((v3 - a1[2][6]) == (v2 ? v2 : v3)));
+    }
+    if ((((18 != v1) > (1 == a1[0][11])) <= ((a1[1][8] >= v0) ? (v1 * v1) : (v2 / 4)))) {
+        v1 = (((a1[0][4] - v1) + (a0[10] ? v2 : v2)) || ((v1 > v3) < (a0[1] <= 90)));
+        v1 = (((71 > a1[0][4]) || (v1 * v2)) && ((v2 >= 36) == (85 / 2)));
+        a1[1][1] = (((a1[2][0] / 2) >= (a1[3][4] ? v3 : a0[3])) <= ((a0[14] * v1) && (22 % 2)));
+    } else {
+        v1 = (((a1[1][1] ? v3 : a1[3][2]) % 3) ? ((50 < v2) ? (v0 + 62) : (v0 ? a0[11] : v2)) : ((39 / 1) >= (v3 || v0)));
+        a0[6] = (((v1 < 55) == (29 > v0)) || ((73 > v0) * (v1 / 6)));
+        a1[2][6] = (((38 >= v1) % 9) * ((v0 ? a0[2] : v1) ? (v1 <= v0) : (82 && v2)));
+    }
+    v2 = (((95 && v0) >= (v3 + v2)) || ((v1 > 39) - (v0 == a1[3][3])));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v2 = (((v2 || v3) <= (27 && v1)) || ((a1[1][5] > v3) / 1));
+            a0[4] = (((v3 >= v3) && (v3 * 14)) % 4);
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a0[2] = (((i2 >= v1) > (96 % 2)) < ((i2 / 2) <= (i3 ? a1[2][14] : v1)));
+                a1[1][8] = (((a0[1] / 3) == (a0[1] < a0[7])) ? ((v2 ? v1 : v1) - (5 > v3)) : ((a1[3][4] % 8) / 3));
+                v1 = (((v1 / 6) >= (i3 || a1[2][1])) % 2);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((v0 && v2) == (15 && v0)) ? ((a0[6] - 21) * (v0 > v3)) : ((v0 <= a0[7]) > (a1[3][3] && 50)));
+            a1[3][14] = (((v2 / 7) ? (a0[13] > v0) : (v2 >= a0[8])) && ((i4 == v1) - (v1 <= a1[1][3])));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v2 = (((a0[6] > v1) + (a0[7] ? 53 : a0[12])) + ((v3 && v0) + (v2 <= a0[4])));
+                    a0[13] = (((i5 ? a0[2] : 16) >= (a1[0][3] + 51)) % 3);
+                    a1[2][3] = (((67 ? v2 : v0) <= (v0 >= a0[14])) > ((v1 || a1[1][4]) + (v0 != v2)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    if ((((a1[0][3] >= v1) + (a1[3][12] != 25)) * ((a0[6] <= 5) % 4))) {
+        v2 = (((v0 >= a0[0]) + (1 ? v0 : v1)) + ((v1 / 9) >= (a0[5] ? 77 : a1[1][11])));
+        v2 = (((v1 * a0[11]) || (v0 * 7)) != ((a0[9] <= v1) == (61 == 30)));
+        v3 = (((v0 <= 7) % 9) + ((75 < v1) || (a1[1][11] * 43)));
+    } else {
+        v2 = (((31 == 93) / 5) - ((v2 * v2) + (66 ? v0 : 85)));
+        v2 = (((57 < 0) < (18 && v3)) < ((v1 >= a0[12]) - (v1 > v2)));
+        v0 = (((v0 && v3) || (v0 != v1)) + ((v1 / 8) - (72 / 4)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            if ((87 != a1[0][7]) > 56) break;
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    v1 = (((44 / 6) - (i7 < 64)) >= ((v3 == v2) % 4));
+                    v2 = (((v0 / 7) * (4 || 15)) >= ((v3 || v3) / 1));
+                    v1 = (((a1[1][9] ? v0 : v1) > (21 + 16)) <= ((v1 % 2) + (i6 || i6)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((v0 % 3) ? (i6 + i6) : (v2 > v3)) && ((93 > a0[1]) && (81 <= a1[0][7])));
+            a0[1] = (((a0[6] != v2) ? (i6 / 1) : (v0 < v2)) < ((a0[10] > i6) > (v3 ? a0[14] : 19)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((31 <= 71) * (v2 && v3)) != ((v2 * v0) < (v3 ? 38 : a0[8])))) {
+        v2 = (((48 <= v2) ? (24 && 0) : (v0 ? a1[1][13] : a1[1][5])) <= ((v2 && a1[3][15]) || (v0 + v3)));
+        a1[3][0] = (((v2 * 38) ? (v1 - v1) : (v1 || 20)) * ((a1[0][7] / 3) || (v2 % 9)));
+        v0 = (((v0 - v0) == (v3 > 71)) % 6);
+    } else {
+        v3 = (((v1 / 3) > (v1 != v0)) - ((68 % 8) - (v3 + a1[3][12])));
+        a1[0][5] = (((v1 > a1[0][15]) == (v3 % 2)) <= ((29 > 68) != (60 % 1)));
+        v2 = (((a0[12] || v0) + (v3 && 4)) - ((v1 ? v0 : v2) ? (a1[2][15] <= v1) : (a1[0][4] < v2)));
+    }
+    v1 = (((a1[0][10] > a1[0][7]) >= (a1[1][2] % 8)) != ((v0 || v3) || (a1[3][3] * a0[4])));
+    return (((58 % 5) == (v1 || v2)) / 6);
+}
+int f1() {
+    int v0 = 88;
+    int v1 = 42;
+    int v2 = 41;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v3 = (((88 <= i1) + (a0[13] != i0)) != ((v1 != i0) <= (v2 ? v1 : 44)));
+                v3 = (((v1 != a0[8]) || (96 % 4)) == ((74 + v1) / 8));
+                v0 = (((v2 + 27) < (a0[13] + v1)) > ((a1[2][6] - v2) ? (a1[3][15] * a0[11]) : (a1[0][6] == 4)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        v2 = (((a0[9] ? 5 : 32) * (56 == 30)) != ((a1[2][5] <= a0[10]) == (0 || a1[3][0])));
+        v1 = (((v3 > 30) * (v0 <= 39)) + ((v0 == a0[13]) ? (v1 > a1[2][3]) : (i0 * a0[2])));
+    }
+    a0[1] = (((v1 ? v3 : a0[11]) < (v3 + v1)) - ((76 != a0[2]) ? (v2 - a1[0][5]) : (58 % 1)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((a0[11] && v0) > 93) break;
+            v0 = (((i2 || v2) < (a0[4] ? a0[1] : v2)) > ((a0[13] <= a1[0][3]) ? (a0[10] && v3) : (i2 ? 22 : v2)));
+            a1[3][1] = (((88 - v3) >= (i2 + a0[7])) % 5);
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a1[0][7] && v2) && (i2 == 67)) || ((15 || 23) - (1 / 2)));
+                    a1[0][10] = (((a0[15] ? i2 : a1[3][13]) && (50 > v2)) / 1);
+                    v1 = (((i2 % 7) ? (a0[2] < a1[0][5]) : (a1[0][7] < 64)) % 4);
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v1 = (((i4 / 6) ? (v2 % 2) : (a1[0][3] * 62)) && ((a0[0] ? a0[7] : a1[3][13]) > (v0 * 47)));
+            v1 = (((i4 / 6) == (7 >= a1[2][3])) * ((51 - a0[1]) > (v1 != v1)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                if ((a1[3][5] && v1) > 95) break;
+                v1 = (((i5 > 62) && (v0 ? i4 : 5)) == ((a0[8] || 89) == (a1[0][14] - 1)));
+                v2 = (((v2 || a1[2][9]) <= (v3 / 8)) / 7);
+                v3 = (((a1[0][14] || a0[10]) - (0 != 78)) == ((a0[9] || i5) % 9));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v1 = (((v1 * a0[13]) ? (a1[3][4] || v2) : (a1[1][11] >= 61)) ? ((v2 >= 75) != (a1[0][7] || a1[0][7])) : ((a0[14] == a0[9]) * (v0 == v0)));
+        {
+            int i7 = 0;
+            while (i7 < 3) {
+                v0 = (((a0[7] == i7) || (v0 == v1)) * ((i6 * i7) >= (a1[0][12] || i7)));
+                v0 = (((i7 > a0[9]) > (v1 > i6)) / 3);
+                v3 = (((91 - 48) <= (6 != a1[0][9])) - ((69 || i6) == (v1 == 13)));
+                i7 = i7 + 1;
+            }
+        }
+        v1 = (((a0[7] > v2) >= (93 || i6)) >= ((i6 / 5) != (58 > 54)));
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        v3 = (((v1 >= a0[7]) > (i8 >= a1[2][10])) ? ((7 == i8) && (11 % 8)) : ((a0[14] / 1) > (v2 - v1)));
+        for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+            a0[8] = (((a0[5] / 4) != (a1[2][8] / 8)) * ((v3 >= a1[3][12]) ? (15 + 17) : (77 == a0[12])));
+            v3 = (((v1 < v1) ? (a0[1] ? 89 : i9) : (v1 != v0)) ? ((a0[14] - a1[2][5]) && (i8 > i8)) : ((a1[1][2] == a0[3]) <= (a0[15] / 2)));
+            v1 = (((v0 ? 76 : 69) + (v2 > 4)) >= ((v3 != i8) * (a1[0][7] <= a0[11])));
+        }
+        a1[1][8] = (((58 - a1[3][1]) / 8) == ((10 ? a1[1][2] : v2) < (a0[3] > v0)));
+    }
+    if ((((v0 - v2) * (v2 > v0)) ? ((70 % 3) ? (94 >= v2) : (a1[0][13] - v0)) : ((3 * v1) * (93 % 3)))) {
+        v3 = (((42 > v3) - (2 || a1[2][0])) * ((2 > v2) / 8));
+        v0 = (((v0 > 47) < (82 || 31)) || ((v2 >= a1[2][7]) <= (a1[3][11] && v1)));
+        v2 = (((2 >= v2) / 5) - ((v2 && v1) < (37 - 91)));
+    } else {
+        v0 = (((v1 == v3) - (v3 ? a0[4] : v1)) || ((0 ? v0 : v3) || (34 != v0)));
+        v1 = (((v0 < a1[2][8]) + (v0 % 2)) != ((v1 != 77) <= (v2 != 65)));
+        v3 = (((v3 > 0) > (6 == v0)) * ((v2 > v2) == (a1[3][1] * a0[1])));
+    }
+    {
+        int i10 = 0;
+        do {
+            if ((a0[11] > v1) > 93) break;
+            a0[0] = (((v2 - v3) * (96 && v1)) != ((v2 ? a1[1][10] : i10) >= (v2 / 4)));
+            v3 = (((a1[3][8] != v1) < (v2 / 4)) && ((v1 < v1) / 2));
+            {
+                int i11 = 0;
+                do {
+                    v0 = (((i10 / 6) >= (a0[13] + 96)) < ((v1 && v1) && (v1 ? a0[8] : a0[11])));
+                    v1 = (((v2 == v2) / 5) - ((5 - 1) == (a1[0][8] % 2)));
+                    v0 = (((i10 ? v1 : i11) * (22 < a0[11])) == ((v0 != 67) / 4));
+                    i11 = i11 + 1;
+                } while (i11 < 5);
+            }
+            i10 = i10 + 1;
+        } while (i10 < 4);
+    }
+    {
+        int i12 = 0;
+        do {
+            {
+                int i13 = 0;
+                while (i13 < 3) {
+                    a1[0][0] = (((52 / 6) / 7) + ((a0[4] == v2) + (a0[5] + v1)));
+                    v3 = (((v2 % 9) <= (a1[2][2] % 6)) ? ((23 >= v2) ? (a1[0][11] > a0[2]) : (v3 - 45)) : ((a0[5] || v2) != (v2 ? a0[14] : 30)));
+                    v1 = (((i12 % 4) * (i12 || 94)) == ((a0[12] >= v2) < (i12 < 45)));
+                    i13 = i13 + 1;
+                }
+            }
+            v0 = (((95 % 9) <= (78 - 71)) < ((v0 && v2) >= (88 % 8)));
+            v2 = (((v0 + 36) + (v0 % 6)) > ((v1 >= v0) != (89 < 22)));
+            i12 = i12 + 1;
+        } while (i12 < 6);
+    }
+    if ((((v0 < v1) && (a0[10] % 4)) / 3)) {
+        a1[2][4] = (((v3 * v0) - (v1 && v0)) ? ((2 / 8) < (v1 + v3)) : ((v0 % 5) >= (6 * v3)));
+        a0[6] = (((97 && 93) <= (v3 - v1)) && ((a1[0][11] || 92) % 6));
+        v0 = (((v0 && v3) - (a0[4] < v0)) <= ((v2 || a1[0][9]) < (v1 / 5)));
+    } else {
+        v2 = (((a0[4] ? 11 : v0) - (a0[2] ? v1 : v3)) / 9);
+        a0[8] = (((v1 && a0[9]) >= (a1[0][1] - v2)) % 9);
+        v1 = (((40 <= a0[2]) == (v0 < a1[3][5])) == ((a0[0] / 6) * (44 - v1)));
+    }
+    return (((a0[9] * v0) && (20 / 2)) == ((a1[3][12] % 3) <= (82 <= a0[0])));
+}
+int f2() {
+    int v0 = 62;
+    int v1 = 49;
+    int v2 = 63;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 ? v0 : v1) < (52 == 50)) + ((v3 < a0[14]) * (86 / 3)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a1[3][7] = (((97 / 8) % 1) != ((17 && v3) <= (22 - a1[0][12])));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v1 = (((v1 ? i1 : v2) < (85 || 61)) >= ((15 == v0) > (i0 * 15)));
+            v1 = (((v1 / 7) != (v2 + a1[0][12])) ? ((5 ? v0 : a1[1][9]) == (v3 == 10)) : ((v0 ? 99 : 68) >= (i0 >= i0)));
+            v3 = (((i0 >= v0) < (a0[6] && a0[12])) + ((a1[2][6] < i1) ? (a1[0][6] + a1[0][7]) : (v3 + v1)));
+        }
+        v2 = (((v2 - a1[2][1]) ? (v0 && a1[2][12]) : (27 / 9)) == ((a1[3][2] != v0) || (v1 != a0[10])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v0 = (((v0 ? v2 : v3) != (58 - v0)) <= ((v3 / 4) - (v0 <= 43)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((v0 != v1) > 85) break;
+                    v1 = (((55 >= i2) >= (a0[15] - a0[10])) + ((a0[4] ? v3 : i3) / 9));
+                    a1[1][7] = (((i2 && v3) - (i2 ? v2 : v2)) != ((a1[2][5] > v3) ? (v2 < i3) : (77 * 25)));
+                    a1[1][3] = (((39 < v0) ? (i3 < v0) : (50 >= a0[7])) || ((a0[2] - v3) ? (a0[1] >= i2) : (a1[2][7] ? 62 : v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a1[0][7] % 6) ? (v1 <= v2) : (v3 == v3)) || ((v0 % 1) >= (a0[1] + v0)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        if ((35 && a0[1]) > 68) break;
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            v3 = (((v0 < a0[12]) != (i5 && a0[1])) / 7);
+            v1 = (((27 || a1[1][4]) % 2) * ((v3 || i5) <= (82 > v0)));
+            v3 = (((v0 || i4) >= (77 == v1)) != ((a0[0] + a0[13]) % 6));
+        }
+        a0[2] = (((62 < 0) ? (38 >= a1[0][5]) : (v2 < v3)) >= ((v1 ? v3 : 20) || (v0 || v2)));
+        a0[5] = (((i4 > v0) != (61 ? v0 : v0)) == ((v3 - i4) / 3));
+    }
+    v3 = (((35 <= v2) / 3) % 7);
+    v0 = (((89 < 91) == (a1[3][3] * v0)) + ((v3 % 2) <= (v1 && a1[1][3])));
+    v3 = (((7 < v2) ? (31 * 51) : (v1 == v2)) - ((44 || a0[6]) > (v2 <= a1[1][13])));
+    if ((((v3 - v0) ? (a1[2][0] && a0[14]) : (v3 && v1)) / 3)) {
+        v0 = (((v0 % 8) && (9 && 33)) + ((46 ? v0 : v0) && (a0[10] ? a0[8] : a1[0][9])));
+        a1[3][0] = (((v3 < a1[3][14]) < (93 < v1)) % 1);
+        a0[0] = (((a0[9] != a1[0][7]) != (v3 % 4)) != ((60 == a1[3][10]) && (v1 == a1[1][2])));
+    } else {
+        v2 = (((a1[3][6] * a1[0][10]) * (a0[0] / 5)) ? ((v2 ? 65 : a0[12]) / 8) : ((v1 > a1[3][1]) >= (v3 <= v3)));
+        v3 = (((v1 || a0[7]) && (63 != 35)) ? ((7 == 68) + (a0[5] / 1)) : ((44 != v1) >= (a1[1][3] <= v1)));
+        v3 = (((v1 == v0) % 2) == ((v1 < a0[4]) == (70 < a0[12])));
+    }
+    {
+        int i6 = 0;
+        do {
+            v2 = (((v2 + a1[0][15]) - (v2 * 76)) / 6);
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((v1 && a1[2][3]) == (a1[1][8] && a0[1])) <= ((i6 == 33) + (64 ? a0[11] : 73)));
+                    a1[2][7] = (((v0 == 53) + (v0 / 4)) && ((a0[1] / 4) + (a1[3][2] == a1[1][14])));
+                    v1 = (((45 * a0[7]) < (v1 <= v3)) > ((v3 / 2) >= (44 > v3)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            v3 = (((i6 != v1) - (v2 != v0)) ? ((52 + a1[0][10]) % 7) : ((2 || 90) ? (v2 ? a0[3] : a1[2][4]) : (i6 / 8)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            while (i9 < 2) {
+                a0[2] = (((46 || v0) && (45 * a1[1][3])) ? ((a0[14] * a1[2][6]) ? (v3 * v2) : (v3 * 39)) : ((a1[0][10] < a1[0][0]) != (v2 * 11)));
+                v1 = (((i9 - v0) && (v2 || v1)) > ((a0[5] == i9) + (10 == v2)));
+                a0[11] = (((i8 <= 4) == (a1[1][15] < v1)) <= ((a0[7] - i8) % 4));
+                i9 = i9 + 1;
+            }
+        }
+        v0 = (((v2 / 6) + (v2 >= v3)) - ((i8 && a0[14]) != (v0 < v1)));
+        v0 = (((v2 / 4) == (a0[4] + v0)) / 5);
+    }
+    return (((v1 * a1[2][3]) != (v3 && v2)) <= ((a1[3][0] && v2) ? (47 || v3) : (a1[3][12] >= 85)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
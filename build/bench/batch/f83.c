@@ -0,0 +1,369 @@
+int f0() {
+    int v0 = 54;
+    int v1 = 81;
+    int v2 = 49;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a0[4] = (((a0[13] <= 63) <= (41 && 13)) / 7);
+                v0 = (((83 % 9) >= (v1 / 8)) * ((v3 < v3) % 2));
+                v2 = (((i0 <= a1[0][11]) > (48 >= a1[2][2])) % 2);
+            }
+            v2 = (((a1[2][1] > a0[1]) % 5) * ((v0 ? v3 : v3) * (v2 + v0)));
+            v1 = (((47 > v2) || (a1[2][11] - v1)) % 9);
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v0 ? 35 : v2) / 9) != ((v1 < 78) / 1));
+    v1 = (((46 <= a0[1]) >= (v3 ? v2 : v1)) * ((14 > v1) + (a1[1][10] + v2)));
+    if ((((v2 / 7) % 5) != ((a1[0][8] + 53) * (a1[0][7] < v3)))) {
+        v0 = (((v0 || 88) >= (68 >= 90)) == ((a0[8] % 8) ? (v2 || a0[3]) : (59 || 61)));
+        v1 = (((v3 != a0[15]) < (v3 ? 86 : v1)) % 3);
+        v0 = (((v2 <= v2) == (80 < v1)) <= ((a1[2][2] == 44) > (v1 + 89)));
+    } else {
+        v2 = (((97 ? v0 : v1) > (54 && v2)) >= ((56 < v1) ? (a1[0][0] ? v1 : v1) : (87 * 31)));
+        v2 = (((v1 * v1) + (a1[1][6] > v0)) < ((v1 || v3) < (v1 - v3)));
+        v0 = (((v2 || a1[1][9]) == (v0 % 6)) * ((v2 < 31) <= (a0[15] != a1[1][2])));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[4] = (((v0 % 7) ? (a0[1] ? v1 : v2) : (v0 ? v2 : 70)) ? ((95 * v0) * (35 > v0)) : ((8 >= a0[15]) <= (v3 ? a1[0][0] : a0[10])));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v1 = (((v1 == v2) / 6) && ((v1 ? v3 : v0) == (v3 == v2)));
+            v3 = (((1 % 3) + (17 > v1)) * ((v2 ? a0[6] : a0[4]) <= (a1[3][11] >= a0[11])));
+            v1 = (((a0[2] == 63) + (18 / 6)) == ((v1 >= v0) + (v3 <= v1)));
+        }
+        v0 = (((a0[4] >= a1[2][2]) % 9) <= ((i2 % 2) <= (v3 == a0[2])));
+    }
+    v2 = (((a1[0][13] / 9) * (a1[1][7] || v3)) == ((80 + v3) - (a0[8] <= a0[14])));
+    a1[0][15] = (((v1 / 9) || (v3 || v0)) || ((26 || 29) % 8));
+    v3 = (((a1[1][14] > v3) >= (a0[6] <= 22)) && ((v1 * v3) || (v3 != 60)));
+    if ((((a0[11] * a0[8]) > (v1 <= v2)) >= ((v2 == v2) >= (a0[6] >= v2)))) {
+        v1 = (((a0[4] + 42) > (a0[2] % 2)) == ((67 || 61) * (69 == v3)));
+        a1[3][2] = (((v1 - a1[3][9]) || (v1 - v1)) - ((v1 < v2) && (v3 * v2)));
+        v0 = (((a0[8] * 32) > (v3 == v1)) >= ((v1 > 60) % 8));
+    } else {
+        a1[0][8] = (((a0[2] <= 98) / 1) % 2);
+        a1[3][14] = (((v3 - v3) >= (v1 > 29)) % 2);
+        v3 = (((49 + v0) == (v0 + a0[0])) != ((v1 || v2) == (v2 >= v1)));
+    }
+    if ((((v0 / 2) - (v1 && v0)) > ((18 && v1) || (v3 == v2)))) {
+        a0[8] = (((v0 + v1) - (v0 <= a0[12])) >= ((v0 * v2) % 3));
+        v1 = (((67 % 1) <= (v3 ? a1[1][0] : a0[1])) + ((83 > a0[8]) <= (v0 < 20)));
+        v0 = (((a0[8] >= a1[3][7]) != (v3 ? a1[1][1] : a0[0])) % 6);
+    } else {
+        v1 = (((v1 >= a0[5]) ? (2 % 4) : (a0[12] == v2)) || ((v0 > v0) % 8));
+        v3 = (((96 % 5) != (v0 != 32)) / 8);
+        v3 = (((v3 || v0) <= (v1 != a1[0][9])) || ((v1 > v0) - (v3 ? v2 : 42)));
+    }
+    return (((v1 + 20) * (v0 < v0)) != ((v1 ? v2 : a1[0][8]) >= (v0 == v3)));
+}
+int f1() {
+    int v0 = 66;
+    int v1 = 53;
+    int v2 = 48;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 / 1) ? (78 / 5) : (32 || 66)) ? ((v2 != v0) ? (v0 <= v1) : (a1[3][2] / 3)) : ((12 + v0) > (v0 ? v3 : v2)))) {
+        v1 = (((v3 / 1) <= (v1 >= a1[2][10])) < ((v3 - v0) == (v3 / 8)));
+        v0 = (((v2 * v2) % 2) < ((a0[5] >= v1) / 8));
+        a0[1] = (((v2 > v0) % 5) && ((34 / 1) + (v2 - 43)));
+    } else {
+        v3 = (((93 == v2) - (a0[6] != v2)) % 3);
+        v3 = (((v1 >= a0[15]) >= (v0 * a1[2][7])) - ((v2 ? 8 : v0) != (v2 == 70)));
+        v2 = (((v1 > 42) / 3) * ((v3 > v1) * (5 * a1[2][0])));
+    }
+    v0 = (((a1[3][2] + v3) % 6) + ((a1[3][12] >= v2) % 4));
+    a1[3][14] = (((14 * 61) ? (v1 && a1[1][0]) : (63 || 45)) != ((77 >= v0) == (v0 ? v3 : 94)));
+    if ((((v0 * 60) != (v2 > v1)) / 9)) {
+        a1[3][8] = (((24 != v3) || (26 > v0)) || ((93 % 9) >= (v1 != a1[0][15])));
+        a1[0][2] = (((a1[1][2] / 6) <= (83 < a1[1][4])) == ((61 <= v2) / 6));
+        a1[2][8] = (((69 ? v3 : 18) - (v0 - v0)) ? ((a1[0][0] > 4) >= (20 / 1)) : ((a1[2][9] * a0[0]) * (71 - v0)));
+    } else {
+        a0[9] = (((v1 != a1[2][7]) % 4) - ((a1[2][9] <= 22) ? (v0 > v3) : (50 % 5)));
+        a1[1][6] = (((v1 || v2) % 3) % 1);
+        a1[3][0] = (((18 || v3) < (v2 ? 25 : a1[2][6])) || ((v3 ? v0 : 75) ? (76 != v0) : (88 / 9)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((37 >= a0[6]) ? (a1[0][10] ? 92 : v2) : (a0[1] ? v0 : v1)) / 2);
+            v2 = (((v1 >= a0[1]) / 4) / 4);
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v2 / 4) * (v2 > i1)) - ((a0[1] ? v1 : 95) + (v3 >= 18)));
+                    a0[11] = (((64 ? v1 : 40) % 2) < ((i0 > 80) ? (i1 != v0) : (a0[0] <= v3)));
+                    v1 = (((v1 * 68) > (18 + 12)) != ((v0 || 31) >= (a0[6] >= i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((37 ? v1 : v1) ? (v2 * v1) : (19 % 4)) ? ((a0[0] < 58) && (v3 - v0)) : ((a0[2] == v3) < (50 > v1)))) {
+        v2 = (((v1 != v3) ? (v1 == v0) : (81 >= a1[2][0])) * ((11 == a1[3][10]) * (53 % 2)));
+        a1[1][5] = (((v1 >= 69) ? (v3 || v2) : (a0[12] >= v2)) / 9);
+        v3 = (((5 ? v0 : 69) && (v0 >= v2)) || ((v0 > 10) / 1));
+    } else {
+        v1 = (((10 < v2) ? (77 < v2) : (v2 ? a0[14] : v1)) != ((a0[15] * 40) / 6));
+        v0 = (((v0 * v1) ? (v0 != v1) : (5 > 66)) - ((v2 % 7) < (50 - 77)));
+        v1 = (((80 == 41) && (17 > 21)) < ((39 <= v0) ? (v2 || v0) : (a0[4] / 8)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v3 = (((72 || a0[14]) == (v1 < 95)) != ((i2 >= a1[1][2]) > (i2 <= 70)));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][8] = (((a1[0][2] % 8) != (v3 * v1)) != ((a0[10] >= v0) >= (15 == v3)));
+                    v2 = (((a1[2][8] + 23) > (v3 >= 37)) > ((24 - v1) > (i2 < i2)));
+                    v2 = (((v0 >= i2) + (v0 <= v3)) / 6);
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            a1[2][10] = (((33 == v3) ? (86 <= 90) : (v3 % 4)) > ((i2 && v3) != (a0[10] || i2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            if ((10 || 6) > 50) break;
+            a1[1][3] = (((45 > i4) > (v3 >= a1[0][1])) <= ((v0 <= a1[2][1]) % 1));
+            v1 = (((v1 * 5) > (v0 > v1)) + ((a1[0][5] == a0[11]) < (63 * v2)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v3 = (((v3 <= 52) / 4) / 4);
+                v0 = (((32 == v2) * (v3 + v3)) / 7);
+                v1 = (((a0[0] == 4) ? (i4 >= i5) : (95 && 30)) > ((a0[14] + a1[2][11]) == (v2 * 19)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        a0[15] = (((i6 ? i6 : v0) ? (a0[0] % 7) : (v2 / 3)) - ((a0[15] - v0) % 9));
+        {
+            int i7 = 0;
+            do {
+                a0[15] = (((44 % 2) + (a1[3][10] + v1)) ? ((77 >= v0) - (v0 < v2)) : ((v3 ? i7 : 88) + (73 >= a0[1])));
+                v2 = (((6 == i7) && (i7 > i6)) + ((i7 <= i6) % 2));
+                v3 = (((v0 >= v2) ? (i6 % 5) : (a1[2][4] / 3)) ? ((a1[2][2] || a0[1]) == (57 == i7)) : ((i7 ? i7 : a1[2][3]) || (a0[2] > v1)));
+                i7 = i7 + 1;
+            } while (i7 < 4);
+        }
+        v0 = (((v0 ? 76 : a1[0][6]) && (i6 ? a0[7] : i6)) || ((v2 % 4) + (v0 - i6)));
+    }
+    v2 = (((a1[1][8] * a0[5]) - (v2 >= 9)) ? ((a0[1] - v1) ? (85 ? v0 : v0) : (4 != a0[14])) : ((12 / 4) >= (v1 + 10)));
+    return (((v0 + v0) / 9) != ((a1[2][15] && v0) ? (a0[6] >= 43) : (28 * a0[1])));
+}
+int f2() {
+    int v0 = 32;
+    int v1 = 45;
+    int v2 = 66;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        a1[0][8] = (((a1[2][10] >= 75) > (54 ? v2 : v3)) > ((v1 ? v1 : a1[1][12]) ? (82 % 1) : (v2 ? 2 : a1[1][11])));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                v0 = (((i0 || 97) - (51 / 4)) % 5);
+                a0[7] = (((a0[15] == 45) ? (v2 ? a1[3][3] : v1) : (v1 * v3)) * ((i0 < a1[0][2]) ? (v3 != v0) : (a0[15] ? v3 : a1[2][4])));
+                v3 = (((v2 ? i0 : a0[8]) * (v0 <= i1)) || ((v0 + v0) ? (a0[8] || v1) : (84 > 71)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[2][2] = (((i0 || v3) || (26 + i0)) > ((v2 > v3) + (99 / 8)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((a1[1][7] % 8) > 71) break;
+            v0 = (((a1[2][7] ? a0[8] : 29) <= (92 ? a0[9] : v1)) || ((v1 <= 43) <= (i2 > 90)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v1 = (((a0[10] || v2) && (36 > i2)) != ((35 || a0[13]) / 2));
+                a0[4] = (((a0[6] < v2) >= (76 + a1[3][11])) > ((i2 <= i3) ? (55 * i3) : (a0[1] + 21)));
+                a0[2] = (((a1[1][10] / 3) ? (83 ? v0 : 82) : (a1[3][11] % 7)) <= ((a0[3] > v1) + (i2 && a0[9])));
+            }
+            v3 = (((63 * v2) && (v2 != v3)) ? ((v0 - a1[1][8]) % 6) : ((v2 || a0[5]) / 1));
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v1 - a1[3][11]) == (v2 / 7)) * ((v1 < v2) != (a1[0][4] != a0[0])));
+    if ((((a1[2][13] + v0) / 8) != ((v3 && 47) ? (30 * a0[5]) : (a0[6] + a0[10])))) {
+        v0 = (((50 == a0[13]) || (v0 || a1[0][6])) >= ((a1[2][3] <= v3) % 5));
+        v2 = (((a0[2] % 5) || (a1[0][7] * 10)) / 9);
+        a1[0][1] = (((38 || 92) <= (v1 ? 18 : v2)) >= ((v0 < 91) >= (v2 != a0[13])));
+    } else {
+        v2 = (((a1[1][0] == a1[1][2]) ? (54 == a1[3][0]) : (a0[7] && a1[1][14])) && ((v1 < 82) - (v0 * v0)));
+        v0 = (((a1[0][8] * 76) * (95 == a1[3][14])) ? ((v3 != v0) != (v2 < a1[2][9])) : ((47 <= 56) != (a1[0][2] && a1[0][9])));
+        a0[15] = (((v1 % 4) % 5) + ((a1[1][4] / 4) < (v0 + v1)));
+    }
+    if ((((a0[3] + v3) / 9) >= ((v2 - 20) / 9))) {
+        v0 = (((a1[1][0] <= v1) - (a0[12] < v2)) / 8);
+        v2 = (((v2 != a1[0][11]) * (96 <= v0)) || ((v1 ? v3 : 9) && (v3 == 82)));
+        a1[2][13] = (((v1 * a1[1][0]) > (v2 + 55)) * ((a1[1][10] <= a1[3][4]) > (66 == v2)));
+    } else {
+        a1[0][5] = (((v3 <= v0) < (v1 + v2)) != ((v0 * 50) == (a1[3][9] ? a0[7] : 64)));
+        v1 = (((a1[2][11] == v1) / 3) - ((a0[5] % 2) || (a1[3][0] * 46)));
+        v2 = (((20 > v1) != (53 ? 85 : 58)) < ((v2 * a0[11]) > (v2 && v1)));
+    }
+    a1[0][1] = (((v1 || a1[2][10]) % 7) && ((v2 * v1) != (75 > v0)));
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((a0[1] + i5) > 61) break;
+                    v0 = (((v2 + v3) * (15 ? v1 : 7)) >= ((2 >= v0) <= (v2 && v2)));
+                    v0 = (((i4 / 3) % 4) + ((a1[2][3] - i4) && (a1[1][3] == v2)));
+                    v2 = (((a0[1] * 40) / 2) ? ((28 + v1) * (i4 ? v1 : v3)) : ((26 / 9) && (v1 + v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((89 / 3) >= (v2 % 3)) < ((53 == v3) + (a0[11] != a1[0][4])));
+            v2 = (((v1 >= v3) > (v0 >= a1[0][14])) >= ((19 % 8) == (a1[0][0] >= 95)));
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v3 + v3) * (v0 > v3)) != ((30 ? v1 : v0) * (a0[15] + v1)));
+    {
+        int i6 = 0;
+        do {
+            if ((v2 <= v1) > 60) break;
+            a1[3][11] = (((v3 == v1) && (v1 < v3)) - ((v1 * v3) == (v0 < a0[1])));
+            v3 = (((i6 > a1[0][10]) % 1) || ((a1[2][12] + a0[1]) && (v1 ? i6 : a1[2][0])));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v3 = (((v1 ? v1 : i6) ? (v0 <= a1[2][0]) : (i6 || a1[0][0])) <= ((v2 - a0[14]) >= (v3 / 9)));
+                    v0 = (((a1[3][7] * v2) % 6) < ((v1 ? a1[1][2] : a1[0][7]) % 9));
+                    v1 = (((a0[0] ? a1[1][8] : 60) / 2) >= ((a1[1][5] < 10) < (i6 >= 37)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    a0[13] = (((a1[0][11] * a0[12]) && (v3 + v0)) < ((a1[1][3] >= a0[1]) * (v2 + a0[14])));
+    return (((v0 ? a1[3][13] : 42) % 5) * ((v3 % 6) <= (a1[1][13] ? v2 : 90)));
+}
+int f3() {
+    int v0 = 15;
+    int v1 = 16;
+    int v2 = 63;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][11] != 45) && (31 || 76)) + ((v3 >= a0[10]) < (a1[3][9] / 6)))) {
+        a1[2][9] = (((77 + 13) < (a0[13] / 2)) * ((v2 <= 49) >= (v0 > a1[3][6])));
+        v2 = (((a0[14] && v0) <= (6 ? v1 : v0)) >= ((v1 % 8) && (v0 > a0[15])));
+        a1[1][0] = (((v1 == v0) ? (v0 >= a1[0][10]) : (36 <= a0[4])) ? ((v0 <= 20) == (a1[1][3] != v2)) : ((a1[0][14] == v1) && (v0 <= v3)));
+    } else {
+        v0 = (((69 - a0[9]) <= (51 >= v2)) % 7);
+        a1[2][6] = (((v2 ? v3 : 88) <= (a0[14] < v1)) <= ((v3 ? v0 : v1) > (v3 * v1)));
+        v3 = (((a0[15] && a1[3][4]) + (a1[0][6] < v1)) ? ((v3 % 7) != (a0[12] > v3)) : ((v0 <= v1) / 4));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v0 = (((a1[1][11] / 5) + (91 - v0)) ? ((i0 == i0) ? (i0 / 6) : (v2 != 52)) : ((v3 + a0[4]) == (v3 * i0)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((a1[3][15] != 86) > 73) break;
+                v3 = (((42 < i0) ? (v2 >= a1[3][1]) : (a0[7] + i1)) - ((a1[0][8] || v2) >= (v2 != a1[2][8])));
+                v1 = (((i1 || v1) % 3) != ((i0 % 5) ? (i0 < 3) : (i0 - v1)));
+                v0 = (((v1 < 47) + (a0[15] < 11)) + ((i1 == i1) < (13 <= 47)));
+            }
+            v2 = (((v3 == a0[4]) || (v0 || i0)) == ((a1[1][0] - 41) <= (a1[2][5] > a0[10])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 - v3) < (v0 < a1[0][13])) * ((a0[6] - 92) == (99 % 7)))) {
+        v2 = (((v0 ? a1[2][0] : v1) ? (42 / 6) : (a1[1][5] ? v2 : v1)) ? ((a1[1][10] && a0[3]) * (5 >= v1)) : ((v0 - v3) / 2));
+        a0[12] = (((a0[14] + a0[13]) / 5) % 1);
+        v0 = (((v1 / 1) % 1) < ((3 + v2) / 2));
+    } else {
+        a1[0][8] = (((v3 && a0[2]) >= (a0[11] == a1[0][2])) + ((59 <= v1) / 2));
+        v0 = (((v0 != v3) ? (a1[0][3] % 4) : (v3 == v3)) % 1);
+        v0 = (((v3 - 68) > (a0[6] / 2)) ? ((v3 < a0[8]) - (v2 ? v3 : 35)) : ((v2 ? v3 : v0) <= (v1 > v2)));
+    }
+    v0 = (((91 == a0[10]) != (88 != a1[0][12])) + ((13 ? a1[3][15] : 77) ? (a1[3][10] || a0[0]) : (a1[2][13] - v2)));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    a1[2][1] = (((a1[2][2] % 9) % 6) > ((a1[1][9] || v3) + (20 / 7)));
+                    a0[11] = (((86 - v3) % 1) % 3);
+                    a0[7] = (((10 || i3) ? (a1[2][15] + v3) : (a1[3][4] ? i3 : a0[14])) + ((i3 * a1[2][5]) == (a0[4] + v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v0 > 51) - (a1[0][2] && v2)) ? ((v1 || v1) % 1) : ((v1 > v1) ? (a0[8] != i2) : (a0[2] > a0[5])));
+            v2 = (((v0 / 2) <= (a1[1][4] || a0[8])) || ((i2 != v1) ? (a1[1][4] / 1) : (73 - i2)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v1 == v0) * (29 % 1)) > ((i5 || a1[3][15]) ? (41 >= i5) : (a0[11] || v2)));
+                    a1[3][3] = (((a0[4] * a0[4]) < (v3 > 24)) < ((v3 < 91) ? (97 ? i5 : 21) : (51 - 47)));
+                    v1 = (((73 == a1[0][2]) * (i5 - i5)) * ((97 == 31) == (i5 - a1[2][0])));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v1 = (((i4 && v3) / 4) > ((1 % 7) % 2));
+            a1[3][5] = (((v3 ? i4 : v1) ? (46 <= a0[2]) : (76 > i4)) - ((a0[4] / 2) - (v0 - 51)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    v0 = (((a1[1][12] <= 42) > (49 % 2)) && ((v0 || v0) ? (v0 % 9) : (6 || v0)));
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v0 = (((v0 != 90) + (74 - v0)) / 7);
+            v0 = (((v1 > a0[7]) <= (i6 < v0)) * ((a0[14] == 42) <= (21 + 67)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    a1[1][8] = (((i7 < a1[1][11]) < (v1 ? 5 : i7)) < ((56 - v2) * (v3 - 68)));
+                    a1[2][5] = (((v0 ? a1[1][1] : i6) < (a1[0][0] == a0[10])) / 6);
+                    v2 = (((62 <= v1) + (i7 > v2)) ? ((i7 / 3) <= (v1 < 34)) : ((v3 / 6) != (i6 - a0[12])));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v0 = (((v3 * a1[3][15]) + (v2 - a0[5])) >= ((a1[3][2] * v0) > (89 && 19)));
+    if ((((1 <= a0[0]) * (v3 < a0[7])) ? ((v1 == v2) - (a1[2][12] / 4)) : ((8 || 42) + (v2 < a0[13])))) {
+        a0[13] = (((a0[14] + 68) + (v1 * a0[9])) % 3);
+        v0 = (((a0[15] != v2) || (v0 ? v3 : a0[7])) % 3);
+        v0 = (((v1 + 7) % 9) && ((a1[2][7] >= 40) + (a1[3][5] || 60)));
+    } else {
+        v3 = (((v3 >= v1) < (a0[13] == 27)) != ((29 / 1) % 3));
+        v1 = (((a0[0] >= v3) * (a0[11] != v2)) + ((v0 <= 20) > (74 + 25)));
+        a0[10] = (((v2 <= v3) % 4) / 3);
+    }
+    return (((42 ? 1 : v3) || (a0[11] && a1[0][4])) == ((a1[1][5] <= 41) || (48 % 5)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,111 @@
+int f0() {
+    int v0 = 26;
+    int v1 = 80;
+    int v2 = 81;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    a0[3] = (((v2 != 29) - (v2 % 1)) * ((15 / 5) > (a1[1][6] / 9)));
+    if ((((v2 <= a1[0][11]) > (v1 == v3)) / 6)) {
+        v2 = (((a0[3] && a0[13]) + (a0[5] - v3)) ? ((a0[2] >= v1) ? (a0[5] + v1) : (v0 >= a1[2][0])) : ((a1[1][12] && 99) < (v3 ? v2 : a1[0][15])));
+        v0 = (((v3 / 2) == (v0 - v3)) % 6);
+        v1 = (((a0[4] > 9) != (a0[4] == a0[8])) && ((v3 && v2) * (32 * v1)));
+    } else {
+        v0 = (((85 % 7) > (a0[2] ? a0[1] : a0[13])) ? ((24 - v0) + (a0[15] || v3)) : ((92 < a1[0][13]) <= (a1[3][6] == a1[1][12])));
+        v0 = (((v3 >= 53) - (v0 ? v3 : v1)) <= ((a1[0][3] >= v3) ? (35 == v0) : (v2 != v0)));
+        a1[0][3] = (((v0 != 23) ? (v3 + 26) : (a1[1][8] < a1[1][10])) < ((63 <= v0) > (v3 - 89)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v1 = (((v3 / 4) + (v1 + v1)) % 4);
+        v3 = (((i0 ? v1 : 49) <= (v0 + v2)) < ((a1[1][7] + v1) + (a0[1] * a1[0][14])));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                a0[10] = (((v1 > 4) < (v1 + i0)) >= ((a1[2][9] >= a0[2]) ? (v0 || v0) : (95 && a0[7])));
+                v3 = (((a1[3][15] - i0) ? (v1 <= a0[12]) : (82 + i1)) ? ((i0 && v0) != (v2 ? a0[8] : v0)) : ((v3 < v2) ? (v2 || i0) : (45 < a1[2][11])));
+                a0[7] = (((59 + 73) > (a0[3] > a0[5])) % 5);
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v1 % 3) ? (v2 || v1) : (2 / 8)) <= ((v0 >= a0[5]) - (i2 < v0)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((v3 / 3) == (a1[0][2] + i3)) / 3);
+                v1 = (((41 || 1) / 8) || ((i3 == i3) ? (a0[0] <= v3) : (71 > i3)));
+                a1[3][6] = (((71 <= v0) + (v3 < v2)) % 5);
+            }
+            v2 = (((v3 ? v3 : v1) >= (a1[0][14] && v3)) ? ((i2 <= a0[11]) % 3) : ((a1[1][3] || 74) ? (a0[13] % 6) : (67 > v2)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    a0[5] = (((v1 + a1[2][5]) <= (48 >= v3)) < ((v2 * 85) % 8));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v0 = (((a0[11] / 3) != (v2 < 81)) <= ((21 * v1) || (68 * a1[2][4])));
+                a0[10] = (((a1[2][4] || 68) - (v2 / 2)) < ((v2 % 8) * (v3 == a1[2][13])));
+                v2 = (((v1 == a1[1][13]) == (96 ? 51 : i5)) != ((i5 <= v1) / 1));
+            }
+            a1[3][3] = (((79 - 10) % 9) * ((a1[1][6] ? v1 : a1[1][7]) != (56 + a1[1][5])));
+            v1 = (((44 == 39) != (v0 - v3)) != ((65 / 3) > (v0 != a0[6])));
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v1 / 8) - (v0 ? 55 : v2)) || ((a0[3] % 7) <= (v1 - 42)));
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        if ((a0[13] != 48) > 50) break;
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            v2 = (((a1[1][10] - v3) ? (89 <= v2) : (a0[0] > 97)) / 5);
+            v1 = (((v2 % 6) ? (a0[10] + 63) : (31 != 5)) * ((a0[11] ? a0[15] : a1[0][2]) > (71 != v0)));
+            v3 = (((i6 ? 41 : a1[2][12]) - (6 ? v2 : v3)) >= ((i6 < a0[14]) > (a0[8] < v2)));
+        }
+        v3 = (((a0[8] % 2) ? (v3 > v1) : (15 ? i6 : 47)) / 6);
+        v3 = (((2 < a1[2][11]) / 7) ? ((a1[0][5] * 24) ? (v0 < 40) : (v0 - v1)) : ((a1[0][4] + a0[8]) > (a0[15] == i6)));
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((16 && v1) > 95) break;
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    v3 = (((a1[2][8] > 55) != (73 || a1[1][14])) ? ((a0[2] / 5) / 3) : ((v2 < 37) == (v1 != i8)));
+                    v1 = (((i8 == 34) < (86 + i9)) <= ((v3 ? v1 : v0) * (v2 >= i8)));
+                    v0 = (((v3 - a0[12]) == (v3 + i8)) % 7);
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((v1 + v2) || (63 > v0)) == ((a0[3] / 8) / 3));
+            v2 = (((a1[2][2] <= v1) || (v0 || a1[0][8])) == ((a1[1][5] > 67) + (v0 != v1)));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    {
+        int i10 = 0;
+        do {
+            v1 = (((a0[9] <= 60) ? (17 % 6) : (3 ? v3 : a0[12])) > ((97 >= a0[14]) < (82 != v3)));
+            {
+                int i11 = 0;
+                do {
+                    if ((i11 == a1[2][10]) > 91) break;
+                    v0 = (((a0[3] != v1) ? (a1[2][13] - 44) : (a0[6] % 6)) / 1);
+                    v1 = (((v2 / 2) < (v0 >= v3)) ? ((78 - v2) != (v1 ? v1 : a1[0][14])) : ((i11 ? 94 : i10) >= (v2 || 89)));
+                    v3 = (((10 != v2) % 7) || ((v3 < v1) % 5));
+                    i11 = i11 + 1;
+                } while (i11 < 3);
+            }
+            a0[4] = (((v2 % 7) * (v3 * v3)) * ((v3 / 2) || (v2 && a1[3][0])));
+            i10 = i10 + 1;
+        } while (i10 < 5);
+    }
+    return (((a1[1][3] && v1) ? (32 - v2) : (v1 > v1)) * ((v1 * v1) >= (89 <= v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
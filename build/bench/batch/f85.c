@@ -0,0 +1,194 @@
+int f0() {
+    int v0 = 28;
+    int v1 = 48;
+    int v2 = 92;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    a1[0][10] = (((34 * a1[2][13]) <= (v2 ? a0[4] : a0[12])) || ((a0[0] ? 63 : v1) >= (v2 + v3)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[13] = (((a0[6] / 1) > (v2 / 3)) == ((v0 % 8) + (v1 || i0)));
+            v0 = (((a1[2][9] != v3) ? (v0 > 52) : (a1[2][7] - 12)) / 5);
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((i1 * a0[0]) > (v3 < 11)) % 1);
+                    a0[3] = (((v2 == v3) / 8) != ((v1 != a0[13]) || (34 >= v3)));
+                    a0[7] = (((v2 >= 40) || (i1 ? i1 : 51)) != ((i0 / 2) ? (i1 + 79) : (v0 < i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((a0[6] * a1[1][12]) % 4) == ((87 == v3) / 8));
+    if ((((a0[11] + a1[2][9]) ? (a0[0] >= a1[3][3]) : (v3 < a0[7])) >= ((22 || a1[2][0]) >= (v2 != v2)))) {
+        a1[2][0] = (((v3 ? v3 : 17) % 7) <= ((v0 % 3) >= (v3 ? 1 : 75)));
+        a1[2][4] = (((25 == v1) % 7) <= ((v3 <= v3) || (v2 - v2)));
+        v1 = (((v2 >= v2) == (a1[1][14] || a1[0][15])) == ((37 == v1) ? (41 % 8) : (v2 ? v3 : a0[14])));
+    } else {
+        v1 = (((a0[3] + v2) > (v3 ? v3 : v2)) % 8);
+        v0 = (((96 != a0[5]) != (a0[6] < a1[3][0])) ? ((a0[2] != v3) < (v0 == v3)) : ((v1 && 2) || (v3 % 1)));
+        a0[0] = (((a0[4] ? v2 : 68) ? (83 || v0) : (v2 <= 97)) && ((v1 ? v3 : v2) + (39 % 4)));
+    }
+    v1 = (((v1 || v3) || (44 == 87)) ? ((v3 * v1) - (76 == a0[11])) : ((v3 != 83) > (v0 && a1[2][13])));
+    a1[1][14] = (((63 || 40) ? (a1[3][1] - v1) : (v1 > a1[2][14])) ? ((v2 || 69) * (28 || 27)) : ((27 ? v2 : v2) && (a0[4] > a1[0][10])));
+    if ((((a0[6] < v0) % 9) > ((v2 + a1[2][10]) - (v0 + v0)))) {
+        v2 = (((56 < v0) ? (v3 - v0) : (v2 ? v1 : a0[11])) || ((a1[0][7] > a0[10]) && (v3 % 2)));
+        v1 = (((v0 ? v1 : v1) < (22 < v2)) <= ((15 != v1) >= (v0 ? v1 : a0[9])));
+        v2 = (((a1[2][5] ? v2 : v0) ? (a0[12] != 70) : (v1 / 3)) % 6);
+    } else {
+        v0 = (((a0[3] + 9) % 2) % 1);
+        a0[10] = (((a1[1][13] * a0[3]) - (v0 == 47)) == ((36 * a0[3]) ? (v3 > v0) : (v0 != v2)));
+        a0[11] = (((v3 > v2) / 9) && ((25 >= v3) == (v2 / 3)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            a0[5] = (((v1 ? v1 : v0) / 7) ? ((89 <= 43) || (v1 - v1)) : ((66 + v3) >= (a0[12] >= 67)));
+            v2 = (((a1[0][1] >= i3) * (i2 <= i2)) < ((a0[8] - 52) >= (v0 * v2)));
+            v3 = (((v0 <= a0[11]) >= (a1[1][15] <= i3)) % 3);
+        }
+        v0 = (((54 >= v0) ? (v0 > 98) : (57 != a1[1][7])) <= ((v2 == v3) % 2));
+        a1[2][12] = (((72 && 83) <= (v1 || v0)) % 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((a0[0] * i4) >= (v0 + a0[13])) != ((v1 + a1[0][3]) * (a1[0][3] * i4)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((94 == i5) && (a0[3] > v1)) + ((v3 ? v1 : i4) * (65 / 7)));
+                    a1[3][9] = (((a0[5] + v1) - (a0[2] < a0[8])) + ((v2 || a1[3][9]) % 4));
+                    v3 = (((31 >= v0) % 5) + ((v0 > i5) != (v0 % 1)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v0 = (((v1 || v3) - (43 < 47)) <= ((v3 == v2) > (91 != v2)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    v1 = (((64 == 35) || (v0 && v1)) <= ((92 && 73) < (v2 - 80)));
+    return (((9 < v0) && (v3 < a1[1][4])) * ((84 != v1) ? (v3 <= v2) : (a0[11] > v3)));
+}
+int f1() {
+    int v0 = 21;
+    int v1 = 56;
+    int v2 = 84;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((67 <= v2) * (a1[2][3] == a1[0][4])) < ((12 != v2) * (v3 + v3)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                a1[1][8] = (((v3 || i0) <= (33 != 5)) || ((27 / 4) <= (a0[6] % 5)));
+                v2 = (((a0[7] == 82) > (a0[3] && v1)) == ((v1 || v0) && (a1[3][7] / 9)));
+                v0 = (((v2 > a0[7]) >= (a1[0][14] - i1)) ? ((a1[1][13] % 2) / 9) : ((v0 % 7) * (a1[2][13] / 7)));
+            }
+            a0[0] = (((a1[0][9] % 8) + (v2 * a0[10])) ? ((v1 ? 97 : 26) > (54 ? a1[0][2] : a1[2][6])) : ((a1[0][10] ? 62 : 57) ? (a1[3][4] < v2) : (58 < i0)));
+            v0 = (((45 ? 41 : a0[3]) || (v0 < v2)) > ((24 && 63) * (36 >= 7)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((26 ? v2 : a0[5]) >= (v2 / 1)) || ((a1[2][4] >= v0) ? (v2 || 26) : (57 ? 70 : v2)))) {
+        a1[2][4] = (((v2 * v2) == (97 <= v0)) <= ((48 > v1) - (v2 < v0)));
+        v2 = (((v3 ? v1 : v3) ? (a0[2] >= a1[1][7]) : (38 >= a0[15])) - ((v1 ? a1[3][1] : a1[1][4]) / 6));
+        v0 = (((93 || a1[1][11]) + (a1[2][13] ? 14 : a1[2][7])) && ((35 == a0[10]) <= (a1[3][15] > 12)));
+    } else {
+        a0[2] = (((v0 - a1[3][10]) ? (38 * v0) : (v0 ? 11 : 85)) < ((v1 > a0[11]) * (v1 % 4)));
+        v1 = (((v3 != 31) <= (30 || 89)) && ((a1[3][2] || v2) && (v3 >= v3)));
+        a1[3][10] = (((v2 - v3) >= (69 || v0)) <= ((28 > a1[1][4]) % 2));
+    }
+    if ((((28 || 19) >= (v3 - v3)) || ((a1[2][7] < v0) != (v3 && 3)))) {
+        v3 = (((v1 % 4) <= (a0[5] != v3)) * ((a0[9] / 9) > (56 >= v3)));
+        v2 = (((v3 / 8) * (a0[9] - v1)) && ((v1 <= a0[14]) > (22 >= 66)));
+        a1[1][13] = (((85 * v3) + (52 || 3)) && ((a1[2][15] / 8) > (v0 || v2)));
+    } else {
+        v3 = (((v0 > v1) <= (v0 % 5)) % 5);
+        v2 = (((88 >= v1) <= (a0[6] && v1)) * ((a0[2] % 3) < (v0 + v2)));
+        v1 = (((v0 - a1[3][5]) && (v2 != a0[4])) < ((v0 != v2) - (v3 < v1)));
+    }
+    v3 = (((16 ? v3 : v2) > (a0[1] == v3)) + ((v2 && v1) > (v3 ? v1 : a0[6])));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    if ((64 < 50) > 88) break;
+                    a0[9] = (((a0[0] >= 74) == (a0[10] - v1)) == ((a0[3] + 59) + (a1[1][12] > a0[7])));
+                    a0[5] = (((v3 - a1[2][15]) != (i2 == 40)) == ((a1[3][12] && a0[15]) || (v0 >= 98)));
+                    v2 = (((v2 ? 65 : v3) != (v1 / 4)) <= ((i2 != 42) || (v0 - 26)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v2 = (((v3 > v1) * (i2 - 65)) >= ((v1 * a0[5]) ? (72 / 4) : (48 / 1)));
+            v0 = (((49 == i2) % 3) ? ((45 <= 10) ? (v0 ? a0[1] : v3) : (30 + v3)) : ((v1 - a1[1][2]) % 8));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[2] = (((23 - 97) ? (a0[12] > 21) : (v0 || v3)) <= ((v0 && 48) ? (91 ? v1 : a1[2][10]) : (i4 ? v3 : a0[1])));
+            {
+                int i5 = 0;
+                do {
+                    a1[1][10] = (((v2 / 3) - (a0[11] + i4)) > ((v1 <= v3) / 1));
+                    v1 = (((45 * i4) ? (v3 != a0[15]) : (v3 != v1)) ? ((i5 ? a1[3][14] : v1) && (v1 ? 85 : v3)) : ((i5 * v0) || (a0[8] > 76)));
+                    v0 = (((i5 * a0[10]) == (v3 % 8)) <= ((40 < v3) > (v1 + 99)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v3 = (((v2 < 27) > (v0 ? a0[2] : v1)) && ((51 <= v0) && (a1[2][0] && v3)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    if ((((v1 * v2) > (a1[1][0] > v0)) >= ((a0[6] <= v1) ? (a1[2][4] >= 42) : (79 && v3)))) {
+        a0[6] = (((a0[3] && 71) % 5) % 4);
+        a1[0][7] = (((v2 || 33) ? (v1 < v2) : (v2 ? a0[4] : 59)) - ((41 <= v1) >= (27 || a1[1][7])));
+        v0 = (((a0[5] != 40) < (9 > v2)) - ((53 / 3) - (64 && v2)));
+    } else {
+        v2 = (((95 > a0[3]) != (41 % 8)) <= ((v2 < a1[1][1]) + (90 * v2)));
+        v0 = (((41 <= a0[7]) >= (a1[0][6] == v0)) || ((v1 >= v2) ? (a0[0] / 2) : (v3 && a1[3][9])));
+        a1[3][6] = (((v2 && 14) != (v3 >= a1[1][14])) && ((a0[3] + a1[3][6]) <= (v2 % 3)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[3] = (((v0 / 8) ? (v2 != v2) : (17 <= 42)) < ((a0[3] < a0[7]) && (a0[9] * 95)));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    if ((v3 ? i6 : v0) > 51) break;
+                    v0 = (((a0[6] > 30) ? (74 == i7) : (a0[3] < v3)) == ((52 % 1) && (v0 + v0)));
+                    v0 = (((a0[15] < a0[11]) == (i6 ? i6 : i7)) - ((50 / 5) % 5));
+                    v3 = (((v0 > a1[2][9]) <= (15 % 1)) ? ((a0[14] / 6) && (i7 * a1[0][14])) : ((v2 / 5) / 8));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((a0[5] / 5) && (v0 > 67)) ? ((a1[0][9] < v1) % 3) : ((a1[2][9] > 12) / 1));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    if ((((v0 / 9) || (v0 < v0)) * ((89 <= v3) != (v0 < v3)))) {
+        v2 = (((v3 / 5) - (75 <= 22)) * ((a1[0][8] * a1[2][5]) ? (64 == v2) : (17 > a0[12])));
+        v2 = (((15 ? v0 : a1[2][6]) > (v3 || v2)) < ((v1 + v2) <= (v1 < v2)));
+        v3 = (((a1[0][2] || v0) + (v1 % 4)) > ((a1[2][3] - a1[2][14]) != (v3 != a0[12])));
+    } else {
+        a1[2][6] = (((82 > a1[3][4]) / 8) ? ((a0[8] - v0) || (v1 - a1[2][2])) : ((a0[11] + 88) && (v1 / 9)));
+        a1[2][8] = (((a1[0][10] || v0) % 7) && ((v0 >= a1[1][14]) == (v0 != a0[3])));
+        a0[13] = (((a1[0][9] * a0[5]) ? (37 > v2) : (v0 && 6)) + ((v0 == 7) < (v2 - 63)));
+    }
+    return (((v1 > v3) == (v1 >= v3)) != ((v2 ? v1 : a1[0][4]) || (a0[2] - a1[1][4])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,290 @@
+int f0() {
+    int v0 = 90;
+    int v1 = 13;
+    int v2 = 3;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((39 ? a0[10] : a0[0]) >= (v2 ? v1 : v0)) != ((v1 != 96) < (v1 / 2)));
+    a0[6] = (((a1[2][14] && 30) / 1) < ((v1 < a1[1][15]) <= (v1 || v2)));
+    if ((((a1[0][7] + v3) ? (v3 < 36) : (75 <= v0)) && ((46 - 11) == (a1[0][2] - v1)))) {
+        a0[11] = (((v2 % 8) > (a1[2][13] <= v1)) ? ((7 * 80) != (v3 * 92)) : ((75 + 36) * (v2 * v1)));
+        v2 = (((v1 / 5) - (v3 >= v3)) / 5);
+        a1[2][8] = (((v3 % 1) * (48 < 26)) && ((a1[2][12] * v3) < (53 <= v2)));
+    } else {
+        v2 = (((39 - a1[3][3]) / 2) && ((v3 != a1[2][12]) == (26 == a1[0][7])));
+        a0[7] = (((v0 && a0[0]) < (a0[1] / 1)) != ((v3 && v3) == (v2 ? 79 : a1[3][11])));
+        a0[10] = (((v1 % 7) != (a0[15] <= v0)) == ((63 % 1) + (93 > a0[8])));
+    }
+    if ((((a0[11] + v1) >= (v1 ? 93 : v1)) + ((a1[1][3] % 7) / 3))) {
+        a0[7] = (((a0[10] == a0[13]) ? (v2 + v2) : (75 + v2)) < ((a1[2][14] >= v1) != (89 == v2)));
+        a0[10] = (((v2 == a0[6]) >= (v1 && a1[3][6])) <= ((a1[3][2] >= v0) != (v2 % 7)));
+        v0 = (((v0 >= v2) <= (v0 + a1[3][10])) / 3);
+    } else {
+        v0 = (((a0[4] && 16) % 9) - ((v1 != v0) == (a0[15] || a0[1])));
+        v1 = (((87 || v1) ? (7 >= a0[1]) : (86 ? a0[0] : v3)) + ((a0[8] <= v3) * (a1[2][14] >= a0[8])));
+        v1 = (((v3 >= v1) == (a1[0][8] == v1)) > ((v2 && 67) >= (v2 == v3)));
+    }
+    v3 = (((v0 && v1) % 5) ? ((65 == a1[0][14]) ? (v3 ? 86 : v3) : (a1[1][9] ? 80 : a1[0][0])) : ((95 || v2) || (v0 ? 41 : v0)));
+    if ((((98 * v3) > (v0 || 39)) * ((a1[0][9] / 3) && (v2 != 89)))) {
+        a1[0][15] = (((68 <= v3) || (a0[0] != v0)) + ((a0[1] - 17) * (v1 ? 3 : 52)));
+        a0[1] = (((v3 % 4) > (a1[3][7] != 79)) >= ((v3 - 83) % 2));
+        v3 = (((a1[1][1] > 64) && (v3 * a0[3])) > ((v1 != v0) - (v2 < v0)));
+    } else {
+        a0[9] = (((v0 % 5) <= (a1[2][10] + a0[9])) ? ((89 >= 40) * (v3 != 82)) : ((a1[0][1] >= a0[6]) != (v1 && v1)));
+        v3 = (((v2 >= 82) ? (v3 % 3) : (v0 || 17)) >= ((88 * v1) / 7));
+        a0[5] = (((a1[3][8] - v2) % 9) <= ((36 || a0[0]) == (v2 - 21)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a0[10] || 99) % 1) ? ((i0 % 1) || (a0[6] || 32)) : ((49 <= 38) / 4));
+                    v0 = (((a1[1][14] == a0[9]) != (0 % 6)) || ((a1[2][3] > v0) * (50 ? a0[9] : a1[2][14])));
+                    a1[2][2] = (((v0 <= a1[2][6]) || (14 < a0[5])) != ((v2 % 5) / 2));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a1[3][2] = (((a0[0] != v1) || (52 == 24)) ? ((v0 - 18) <= (71 - 31)) : ((v3 ? a0[3] : a1[1][3]) != (v0 >= v3)));
+            v3 = (((v1 + v3) + (a1[3][15] ? v3 : a0[10])) - ((v0 <= 5) ? (v3 == i0) : (96 != v3)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            a1[3][14] = (((a0[11] != 66) == (v3 < i3)) ? ((v1 < 60) * (v1 == 71)) : ((i2 && a0[9]) == (a1[0][5] - i3)));
+            v0 = (((v1 == v3) < (a0[1] < 46)) > ((a0[7] != v2) - (a0[13] - a1[3][3])));
+            v3 = (((v3 / 9) / 2) || ((v2 ? 59 : 34) + (i2 || v1)));
+        }
+        v0 = (((73 > v3) * (a1[0][3] ? 60 : a1[1][5])) / 4);
+        a0[15] = (((a1[2][0] == 7) == (a0[7] - 29)) > ((v0 == v1) ? (a0[4] || i2) : (85 <= v1)));
+    }
+    v2 = (((a0[15] != 52) * (v0 != v0)) % 6);
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((v3 != a1[0][7]) > 80) break;
+        v3 = (((v1 || v1) == (a0[5] <= 25)) || ((v2 ? v3 : a0[9]) > (v2 ? v1 : v0)));
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                if ((a0[5] - a1[2][13]) > 52) break;
+                a0[12] = (((i4 < i4) % 3) <= ((v0 || v2) * (i5 && i5)));
+                v0 = (((i5 || v0) > (12 ? v1 : v3)) % 4);
+                a1[2][11] = (((v1 && 31) > (a0[11] ? v2 : 54)) == ((6 || i4) >= (a0[5] == a0[8])));
+                i5 = i5 + 1;
+            }
+        }
+        a1[2][7] = (((a1[0][0] == v2) + (46 / 8)) || ((v2 >= a1[1][12]) <= (v2 ? v3 : a1[1][12])));
+    }
+    return (((v0 % 2) >= (a0[13] < a0[0])) / 7);
+}
+int f1() {
+    int v0 = 28;
+    int v1 = 3;
+    int v2 = 58;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    a1[2][12] = (((a1[2][12] % 8) - (a1[1][6] >= a0[10])) && ((v0 + 83) < (v0 || 35)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v2 = (((i1 == 31) ? (v3 - v3) : (i0 > i0)) * ((v2 ? v0 : a1[2][8]) + (a0[9] && a1[1][13])));
+                v0 = (((v2 * v1) - (a0[6] >= 62)) >= ((a0[10] == 5) - (41 ? a0[15] : 20)));
+                v1 = (((v2 / 6) ? (55 <= v2) : (a1[2][6] ? v0 : a1[2][12])) && ((a1[2][8] % 7) < (v1 ? a0[8] : a1[2][14])));
+            }
+            v2 = (((22 > v3) < (35 <= v3)) != ((v0 >= 17) % 8));
+            a1[3][15] = (((a1[3][3] - 61) / 2) > ((a1[2][3] - a0[5]) >= (v1 != 35)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v3 ? a0[8] : a0[9]) - (v0 != v1)) < ((v1 == 98) - (v0 * i2)));
+            v3 = (((a1[1][7] != v1) / 9) || ((i2 ? v2 : 98) * (68 <= 52)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v0 = (((a0[14] % 8) >= (75 != a1[1][8])) >= ((52 ? 14 : a1[2][6]) <= (v2 >= v0)));
+                a1[3][7] = (((v3 < a1[3][1]) * (a1[2][11] / 8)) < ((v0 % 2) + (v2 ? v0 : a1[3][13])));
+                v0 = (((v1 - i3) < (28 ? 32 : 25)) ? ((v3 || i3) ? (46 != 46) : (v0 > v0)) : ((33 != i2) - (v2 % 7)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((a0[5] % 2) / 5) <= ((v2 + v2) >= (v2 ? v2 : a1[3][9])))) {
+        v2 = (((a1[0][3] < v3) <= (a0[14] / 9)) - ((v2 >= v0) == (v1 && 24)));
+        v0 = (((a1[3][0] ? v0 : 13) ? (a0[4] ? a0[1] : v3) : (a1[3][7] * v1)) ? ((v0 || 50) * (a0[8] - v0)) : ((v2 - a1[3][8]) && (18 <= v3)));
+        v0 = (((v1 == 10) != (v2 < v2)) != ((v3 * 89) / 8));
+    } else {
+        v3 = (((a1[1][6] == v3) / 1) + ((a0[6] ? 71 : v1) - (a0[3] ? v2 : v2)));
+        v2 = (((v0 ? 88 : 34) + (41 ? v1 : 25)) != ((2 < 30) <= (v0 * v3)));
+        v1 = (((a1[0][12] > 18) >= (a1[1][15] + a0[3])) > ((54 % 7) == (54 || v2)));
+    }
+    a0[7] = (((65 ? a0[10] : 27) == (a0[11] <= v2)) && ((v3 ? a0[8] : a1[0][6]) < (74 || v3)));
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v3 = (((v2 || v3) ? (v3 == v2) : (v0 - a1[0][0])) || ((v0 % 7) >= (v0 || v1)));
+            v3 = (((v1 + a1[2][8]) % 6) || ((a1[3][11] || i4) / 5));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v0 = (((v3 || 61) != (41 >= v1)) % 8);
+                v3 = (((v1 > a0[10]) ? (a0[0] ? i4 : v0) : (v0 * v0)) != ((i4 >= a0[8]) ? (i4 % 7) : (89 / 1)));
+                v2 = (((98 == i5) - (i5 - v2)) / 5);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((a0[7] && v3) > 87) break;
+            a1[2][15] = (((v0 >= a0[13]) && (a1[2][14] % 5)) >= ((75 && v0) || (28 < v1)));
+            v2 = (((a0[11] != v0) < (61 * 91)) - ((v1 ? i6 : 7) / 1));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    if ((a1[3][1] != v3) > 89) break;
+                    v0 = (((v2 + a0[3]) + (30 - 45)) != ((i7 > a0[8]) != (v1 % 9)));
+                    v2 = (((29 == i7) ? (a0[4] - 62) : (v2 && a1[3][7])) * ((a1[0][11] * 97) % 1));
+                    v2 = (((86 || a1[1][0]) + (v2 == a1[2][2])) + ((v1 > v0) == (85 ? a1[2][11] : 7)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    v3 = (((a1[0][8] < v3) ? (v1 * 32) : (48 == v0)) <= ((v0 == v0) <= (a0[1] == v0)));
+    {
+        int i8 = 0;
+        do {
+            v0 = (((a1[1][14] != v1) <= (80 > v2)) / 1);
+            for (int i9 = 0; i9 < 3; i9 = i9 + 1) {
+                a1[1][3] = (((a0[1] * i9) == (i8 % 1)) < ((v2 >= a0[10]) % 2));
+                v2 = (((v1 / 9) >= (i8 >= 58)) >= ((i8 && v2) + (v1 / 3)));
+                v3 = (((32 != i8) >= (33 > a0[0])) % 4);
+            }
+            a0[0] = (((83 != a1[2][10]) / 1) < ((a1[1][12] / 1) / 8));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        v3 = (((a1[1][13] == v3) / 8) > ((a0[7] && v2) || (i10 && 68)));
+        a1[2][6] = (((v2 < v3) == (v3 * 21)) || ((a1[3][4] != v1) > (68 > v0)));
+        for (int i11 = 0; i11 < 4; i11 = i11 + 1) {
+            v2 = (((60 ? 56 : v2) == (30 / 1)) < ((a1[1][2] <= a0[2]) + (a0[6] ? i10 : a1[1][9])));
+            v2 = (((v2 < v3) ? (50 == 59) : (v3 == a0[8])) > ((v1 || a1[0][14]) / 4));
+            v2 = (((a1[1][2] > v1) == (v2 && a1[3][5])) && ((v2 != v3) < (v3 >= 52)));
+        }
+    }
+    return (((v1 && a1[2][12]) > (v0 % 4)) ? ((72 * 64) ? (v2 * v2) : (a1[3][13] % 7)) : ((a0[5] == 12) >= (v0 != v1)));
+}
+int f2() {
+    int v0 = 4;
+    int v1 = 31;
+    int v2 = 57;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v0 + 26) >= (0 / 2)) / 5);
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                v3 = (((a1[3][14] == a0[9]) % 5) * ((37 + v0) / 6));
+                v1 = (((v2 / 6) ? (v2 % 7) : (5 && a0[4])) == ((v2 <= a1[2][9]) > (36 - 7)));
+                a1[2][12] = (((a1[2][4] / 4) >= (a1[2][0] && 65)) < ((52 < i0) - (v1 - a0[3])));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((i0 || i0) + (v3 < v0)) + ((a1[0][7] && v1) - (a1[0][4] ? v0 : v2)));
+        a0[10] = (((62 || 38) == (i0 > v1)) ? ((a0[4] < v2) <= (v3 >= v2)) : ((v0 < v3) <= (a1[0][4] / 4)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v1 = (((i2 ? a1[3][12] : v0) > (23 - v2)) + ((v0 <= a1[0][5]) ? (16 != a1[0][15]) : (i2 || 7)));
+        v3 = (((v1 / 5) ? (a1[2][3] - a1[1][14]) : (i2 <= v3)) || ((i2 || v0) < (v2 == v2)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v0 = (((a1[0][1] + a0[5]) > (a0[5] && a0[9])) - ((v3 - i3) % 3));
+                v0 = (((a1[1][13] && 49) ? (i2 && 86) : (i3 < i2)) ? ((a0[13] != v3) - (v1 == i3)) : ((77 <= a1[2][11]) ? (i3 - v2) : (a0[15] / 4)));
+                a0[0] = (((68 || a0[8]) + (v3 * a1[0][7])) + ((v2 % 3) - (74 + v2)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    a0[14] = (((a1[2][7] >= v0) ? (v0 - v1) : (v0 * 42)) != ((65 || a1[1][13]) ? (87 == v0) : (61 * 66)));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v3 = (((75 || v3) <= (a0[8] && 56)) + ((v1 >= i4) / 2));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v1 = (((31 + 60) <= (a0[2] - a0[6])) == ((v2 - a1[1][13]) / 6));
+                v3 = (((a1[0][0] ? 41 : 60) >= (a0[8] / 3)) % 2);
+                v3 = (((21 && 34) || (v2 != v1)) <= ((72 < i4) != (v1 ? v2 : v2)));
+            }
+            v2 = (((v3 > v2) - (i4 >= v3)) / 9);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 ? v0 : v2) ? (a1[2][0] <= v0) : (v3 <= v1)) != ((93 >= v0) < (v2 > v2)))) {
+        v1 = (((v2 * 9) % 6) % 8);
+        a0[9] = (((a1[3][8] >= a0[4]) - (11 ? 42 : a0[9])) == ((v1 + a1[3][8]) % 2));
+        a1[2][6] = (((v0 * v2) > (v2 && 78)) <= ((v1 % 3) || (a0[9] - v3)));
+    } else {
+        v0 = (((v2 && v2) > (78 == a1[1][5])) / 1);
+        v0 = (((v2 < a1[3][1]) || (a0[2] || v0)) ? ((a0[13] <= v2) && (v3 * a1[1][11])) : ((69 == 9) != (a0[3] <= v1)));
+        a0[10] = (((a0[1] ? v1 : v0) != (a0[2] != a1[0][15])) || ((v1 < 74) / 7));
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        if ((18 % 9) > 67) break;
+        {
+            int i7 = 0;
+            do {
+                a0[10] = (((v1 == i7) ? (v1 >= a0[3]) : (v0 != a0[10])) < ((53 - i7) > (i7 / 5)));
+                a1[2][11] = (((v1 < a1[1][3]) && (64 ? v2 : a0[13])) < ((v3 > i6) * (v2 + i7)));
+                a0[5] = (((88 * v2) == (23 / 7)) != ((i6 || a1[3][4]) > (i7 - a1[3][12])));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+        v2 = (((i6 ? a0[5] : i6) ? (a1[0][8] != v0) : (i6 > v2)) + ((a0[1] < v3) ? (a0[5] >= v1) : (v1 != i6)));
+        v0 = (((a1[1][11] >= a0[1]) >= (v0 ? 76 : a0[0])) + ((a1[2][10] <= 47) < (i6 - v2)));
+    }
+    if ((((v1 - v1) != (v2 == a0[8])) != ((12 && 63) - (v3 - v2)))) {
+        v1 = (((a0[14] == v3) <= (a1[1][15] < a0[15])) || ((v2 % 6) < (a1[3][11] && 49)));
+        v2 = (((v0 % 4) || (a0[7] <= v1)) || ((14 || 97) || (v2 || 75)));
+        v3 = (((v2 / 6) && (v2 >= a0[13])) <= ((v1 <= v3) + (v3 >= a0[14])));
+    } else {
+        a0[11] = (((a0[12] < v3) || (a1[2][14] >= 33)) + ((v3 + a0[5]) * (a0[10] < v0)));
+        v1 = (((a0[4] ? v1 : a0[9]) * (a1[2][14] - 76)) - ((v0 > v3) % 2));
+        v2 = (((v3 ? v0 : a1[0][11]) * (v3 && v2)) != ((v3 + a0[15]) >= (17 == v2)));
+    }
+    v0 = (((a0[10] == a0[5]) + (v3 + v3)) > ((v2 > v3) < (v2 && a0[14])));
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            if ((91 <= v1) > 71) break;
+            a1[2][14] = (((77 && v2) > (80 || 64)) + ((i8 >= i8) == (a0[8] + v1)));
+            {
+                int i9 = 0;
+                do {
+                    a1[3][12] = (((85 ? v1 : 31) < (i9 && 29)) <= ((v3 * 80) && (i9 % 3)));
+                    v0 = (((i9 / 3) - (v1 >= i8)) / 8);
+                    v1 = (((58 > v2) != (v0 >= i9)) != ((a0[8] ? a0[5] : a1[0][9]) != (38 + v0)));
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            v3 = (((79 ? 70 : a1[3][6]) && (a1[2][6] >= v3)) * ((v1 ? 76 : a0[11]) != (v2 / 3)));
+            i8 = i8 + 1;
+        }
+    }
+    return (((v3 / 8) / 1) - ((98 < 65) ? (a1[0][3] == v0) : (68 < 49)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
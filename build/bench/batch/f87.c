@@ -0,0 +1,416 @@
+int f0() {
+    int v0 = 84;
+    int v1 = 52;
+    int v2 = 11;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[5] > v0) > (v0 * v1)) % 8)) {
+        v2 = (((a1[1][1] % 8) <= (46 >= v0)) && ((a1[1][14] && a0[5]) / 5));
+        v1 = (((a0[3] > v0) > (10 ? v0 : a0[0])) <= ((a1[2][9] >= v1) >= (v1 >= 66)));
+        v2 = (((v1 != 67) <= (v1 > v0)) % 2);
+    } else {
+        v1 = (((0 % 2) != (a0[4] >= 33)) ? ((a0[14] ? v3 : v0) == (v3 && a1[1][10])) : ((25 >= v3) < (v0 == v3)));
+        v0 = (((a1[3][7] % 4) + (a1[1][0] - 18)) + ((v0 * v0) <= (a1[0][2] ? v2 : 2)));
+        a1[0][14] = (((a1[3][11] <= v0) != (a0[10] ? a0[5] : a1[3][13])) && ((v1 || v3) > (v0 <= 75)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[3][9] = (((v1 * v1) / 6) / 3);
+            {
+                int i1 = 0;
+                do {
+                    a1[3][11] = (((16 <= i0) == (v2 / 1)) < ((v1 > a1[1][8]) ? (2 <= a0[11]) : (44 == 35)));
+                    v3 = (((i0 > 77) * (80 ? v1 : a1[0][2])) ? ((a0[5] && a1[2][13]) || (v2 && 1)) : ((i0 != v3) <= (87 && v0)));
+                    v3 = (((i1 || v1) && (a1[0][14] % 9)) * ((i0 ? 59 : a0[7]) && (a1[3][0] || a1[1][9])));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v0 = (((v1 == 93) == (24 && 16)) / 2);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        a0[1] = (((v0 <= 35) / 5) - ((71 % 1) % 4));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v1 = (((v0 != a1[0][0]) != (v2 - i2)) <= ((15 != i2) > (i3 ? a1[3][6] : 93)));
+            a1[1][3] = (((a0[5] >= v1) && (41 + 80)) && ((v1 / 2) ? (a0[3] <= v0) : (v3 != v3)));
+            v0 = (((i2 <= 62) || (36 <= v2)) ? ((30 == i3) == (v2 <= a0[13])) : ((i3 % 4) + (v3 < 43)));
+        }
+        v3 = (((v2 == v2) <= (a0[14] % 9)) != ((52 != a1[2][12]) < (a1[2][10] == v3)));
+    }
+    v1 = (((v1 - 48) != (a1[3][15] == 48)) > ((v1 != v0) + (v0 < v3)));
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v0 = (((v3 >= v1) * (4 - 50)) ? ((v1 == v0) || (v0 == 3)) : ((a0[6] == a0[9]) + (37 != v2)));
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                v0 = (((78 == i4) >= (i4 / 1)) + ((v0 < 65) <= (a1[2][0] * a1[2][6])));
+                v2 = (((v0 * i5) / 7) >= ((a1[2][6] + i5) >= (81 - a1[0][0])));
+                v0 = (((v0 / 2) % 5) ? ((v2 != 27) || (a0[13] - a1[2][14])) : ((46 <= 20) / 5));
+                i5 = i5 + 1;
+            }
+        }
+        v1 = (((v0 >= 64) ? (25 > a1[0][0]) : (v0 <= 23)) <= ((36 || a1[3][12]) ? (a0[11] >= 67) : (v2 > a1[3][9])));
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        a1[0][5] = (((48 ? a1[0][12] : v0) / 7) >= ((0 ? v0 : i6) + (18 + 86)));
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            if ((v2 / 1) > 62) break;
+            v0 = (((a0[8] <= a1[0][1]) != (72 >= 59)) ? ((v0 >= v3) || (a0[0] / 9)) : ((i6 == v2) > (v3 == i6)));
+            a1[3][10] = (((a1[3][9] || v3) / 4) - ((v0 * a1[3][2]) - (v3 / 1)));
+            a0[0] = (((v2 + i7) < (67 % 5)) / 5);
+        }
+        a1[2][1] = (((a0[14] != v2) * (51 * a1[2][12])) == ((v2 < i6) * (v0 && v1)));
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((v1 - v1) + (a1[0][13] < v3)) + ((63 && v1) ? (v0 ? a1[0][15] : a0[7]) : (a1[2][1] ? i8 : 66)));
+            a0[15] = (((7 || a0[8]) != (a0[4] ? 99 : v0)) != ((95 <= v1) / 7));
+            {
+                int i9 = 0;
+                do {
+                    v1 = (((16 >= 19) * (82 > v0)) % 5);
+                    v1 = (((56 <= v2) - (v0 == a1[0][7])) % 3);
+                    v2 = (((v0 >= a1[1][3]) % 2) * ((v0 % 6) % 7));
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    {
+        int i10 = 0;
+        while (i10 < 2) {
+            if ((32 == i10) > 65) break;
+            for (int i11 = 0; i11 < 7; i11 = i11 + 1) {
+                v0 = (((v2 && a1[0][2]) / 8) == ((v1 * 1) == (a0[12] < 4)));
+                v2 = (((i10 >= v0) ? (a0[0] == a0[4]) : (v2 || i11)) > ((a1[2][6] <= i11) / 9));
+                v3 = (((v0 <= a0[11]) * (27 != a0[0])) != ((v2 || 6) && (36 <= v1)));
+            }
+            v3 = (((v2 > i10) >= (i10 + v0)) + ((v1 / 5) > (96 == v0)));
+            v2 = (((v0 || a1[3][11]) < (v0 ? v1 : i10)) <= ((23 ? i10 : i10) != (2 <= a1[2][3])));
+            i10 = i10 + 1;
+        }
+    }
+    v1 = (((a0[0] >= v1) + (a1[0][1] - a1[3][9])) || ((33 / 5) * (v1 && v0)));
+    for (int i12 = 0; i12 < 3; i12 = i12 + 1) {
+        {
+            int i13 = 0;
+            while (i13 < 3) {
+                a1[2][10] = (((a0[9] / 8) >= (v2 + i13)) ? ((i13 / 8) >= (5 ? a0[11] : 10)) : ((a1[0][2] != 16) * (a1[3][3] ? i13 : a1[3][0])));
+                a0[14] = (((v2 >= v0) + (a0[9] && a1[2][5])) + ((v3 && v2) ? (i13 ? a0[10] : i12) : (v2 <= a1[2][7])));
+                v0 = (((i12 > i12) ? (0 == 39) : (i12 >= i13)) / 7);
+                i13 = i13 + 1;
+            }
+        }
+        v2 = (((i12 - v1) || (94 ? a1[2][2] : v3)) == ((v3 && v0) && (v1 > a1[2][8])));
+        a1[1][13] = (((v2 != v3) >= (v1 > v3)) % 9);
+    }
+    return (((a1[1][2] - a1[3][4]) ? (a0[14] == a0[3]) : (v0 <= a1[3][5])) - ((a1[2][1] / 3) ? (v3 < 91) : (a0[2] - 82)));
+}
+int f1() {
+    int v0 = 27;
+    int v1 = 12;
+    int v2 = 20;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a1[1][9] - v1) >= (37 <= a1[0][6])) && ((66 % 4) <= (a1[3][15] ? 38 : 1)));
+    v0 = (((62 ? v1 : v3) > (v2 || v2)) > ((v2 - v1) > (4 ? 86 : v3)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v3 = (((v3 * v3) * (v1 ? 44 : a1[3][15])) < ((42 ? v3 : i0) > (6 % 5)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v0 = (((76 / 5) % 4) <= ((v2 < a1[0][4]) + (i0 && v2)));
+            v3 = (((v3 * v0) >= (v3 <= 50)) / 6);
+            v1 = (((v1 ? 39 : v0) == (40 % 8)) < ((79 != v0) || (v1 > 15)));
+        }
+        a1[3][12] = (((v2 % 7) - (i0 <= a1[0][8])) + ((a0[0] ? i0 : v1) <= (a0[13] ? a0[15] : v0)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((v2 < a1[1][12]) > 80) break;
+        v1 = (((v3 - v3) <= (72 ? 83 : a0[8])) != ((v0 / 4) && (81 * a1[0][3])));
+        {
+            int i3 = 0;
+            do {
+                a0[7] = (((86 * 3) % 9) >= ((v1 != v3) * (v0 * 31)));
+                v2 = (((a0[2] - v1) && (a0[11] == v3)) >= ((20 + 72) + (v3 ? v3 : v2)));
+                v3 = (((a0[7] - a1[0][3]) > (0 / 4)) ? ((i3 != 66) + (i2 / 9)) : ((v2 != a1[3][6]) + (v2 - i2)));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        v0 = (((a1[3][7] <= a0[14]) && (16 || v1)) != ((v3 * 0) >= (84 || v3)));
+    }
+    if ((((v2 ? v1 : a0[13]) ? (v3 ? a1[2][7] : a0[13]) : (a1[3][0] <= a0[12])) - ((v2 * v1) ? (a1[1][9] % 3) : (v3 <= 69)))) {
+        v2 = (((44 <= 46) && (47 || v1)) / 1);
+        v2 = (((v3 == a0[1]) && (18 != a1[0][7])) % 8);
+        v1 = (((v1 >= a0[10]) != (v1 != v1)) || ((v3 ? v0 : 28) / 3));
+    } else {
+        v1 = (((v0 ? v0 : v1) <= (v0 != v0)) || ((a1[0][1] && v0) ? (a1[3][12] * v0) : (v1 == 89)));
+        v3 = (((a0[4] / 1) != (v3 < v1)) <= ((v3 * a0[2]) > (81 >= v1)));
+        v2 = (((v0 >= 48) != (v1 <= v0)) > ((v0 - v0) + (a1[2][2] < 25)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            a0[9] = (((v1 <= 49) == (14 ? a1[3][8] : 98)) / 9);
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v2 = (((i4 / 1) - (v0 ? v2 : a1[2][3])) * ((a1[3][0] ? 23 : a1[1][8]) == (a1[3][1] % 5)));
+                    v2 = (((i4 / 4) >= (i5 >= a0[13])) + ((a1[3][14] && 61) ? (i5 / 6) : (i5 + i5)));
+                    a1[3][0] = (((i4 % 5) <= (v1 <= a0[1])) - ((a0[3] == i4) ? (v0 || 52) : (a1[2][12] != i5)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][15] = (((a0[6] / 1) * (i4 && v2)) + ((v2 != a1[1][0]) ? (v3 >= a0[3]) : (v3 == v0)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                if ((i6 == v0) > 76) break;
+                a1[2][11] = (((i7 ? v3 : v2) || (a0[3] / 9)) ? ((57 / 9) <= (53 > v3)) : ((i7 ? v0 : 19) || (v3 == i7)));
+                v1 = (((i7 + a0[12]) <= (v3 + a0[14])) < ((v0 % 4) * (v0 && v1)));
+                a1[0][0] = (((i7 && 91) && (v3 ? 10 : v2)) != ((v0 < v0) * (28 + v1)));
+            }
+            v0 = (((v0 ? i6 : 38) && (73 % 9)) < ((a1[2][14] == a0[11]) ? (v2 <= v3) : (a1[1][7] % 9)));
+            v2 = (((i6 && v0) + (v1 / 8)) < ((a0[5] == i6) && (8 < v2)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((20 <= v3) >= (v2 == v1)) ? ((41 - v1) == (a0[13] || 46)) : ((a1[3][6] > v2) / 8))) {
+        a0[2] = (((v1 <= v1) / 3) == ((v0 && v3) % 7));
+        a0[6] = (((v1 && 57) % 1) <= ((a0[8] + v2) + (8 && v0)));
+        v0 = (((v3 != 71) == (v2 ? a1[2][0] : v0)) ? ((92 - v1) != (a0[9] % 9)) : ((28 < v1) && (a0[2] < 41)));
+    } else {
+        a1[3][0] = (((v1 % 6) ? (v0 * a1[2][14]) : (v1 >= a0[14])) >= ((v3 ? a0[2] : a1[2][12]) + (v2 + 99)));
+        v1 = (((a0[10] + a0[0]) >= (v3 > 58)) > ((1 * a0[1]) != (v3 == v1)));
+        v1 = (((a0[2] > v3) - (v1 <= a1[3][6])) ? ((88 == v1) > (a1[2][1] < v0)) : ((a0[12] == v3) == (70 == v1)));
+    }
+    if ((((63 > v3) % 1) != ((17 <= a0[0]) < (74 < v2)))) {
+        a1[1][13] = (((v2 % 9) + (a0[14] * v0)) || ((a0[12] ? v2 : v1) + (12 % 5)));
+        v1 = (((46 != v1) + (a0[8] % 2)) * ((v1 / 6) != (v2 <= a1[1][11])));
+        v0 = (((v1 >= 23) + (v3 || a0[3])) <= ((v2 ? v3 : a1[0][8]) < (a0[1] % 2)));
+    } else {
+        a0[5] = (((v2 / 6) == (1 >= a0[2])) && ((v0 ? v3 : a0[4]) - (65 - 15)));
+        v0 = (((a1[3][14] - 16) && (v0 - v1)) || ((v0 * 48) > (5 >= v3)));
+        v3 = (((85 < 3) ? (v0 && 6) : (v1 % 5)) == ((v1 > v2) ? (v2 > a1[0][12]) : (v0 % 2)));
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        {
+            int i9 = 0;
+            while (i9 < 2) {
+                v1 = (((v0 != a1[1][1]) >= (a1[3][11] * 46)) || ((92 / 3) / 8));
+                a1[1][7] = (((v2 / 2) == (99 <= i9)) ? ((42 + 11) > (a0[11] + i8)) : ((v1 || 29) || (v2 + 62)));
+                v2 = (((v0 ? v1 : v1) >= (a0[5] + v0)) * ((v0 * 6) ? (v1 < i8) : (59 / 5)));
+                i9 = i9 + 1;
+            }
+        }
+        v3 = (((a0[9] && a1[3][7]) + (v3 == a0[8])) * ((v1 ? v2 : 91) / 5));
+        v1 = (((56 ? 96 : 61) >= (v2 * i8)) % 9);
+    }
+    return (((44 / 8) / 3) + ((a0[4] == v1) == (v2 ? a1[0][15] : a0[7])));
+}
+int f2() {
+    int v0 = 25;
+    int v1 = 92;
+    int v2 = 44;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v1 >= v3) < (v2 == v0)) * ((20 ? v3 : 98) && (v0 % 2)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a0[6] = (((i0 != i0) / 7) + ((v2 || v3) || (a0[6] ? 94 : i0)));
+            v1 = (((10 >= v3) + (v2 <= a0[9])) / 3);
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a0[15] = (((76 + i0) <= (v2 == a0[7])) > ((i0 / 7) && (a0[6] && 82)));
+                a0[9] = (((81 || i1) || (39 < v2)) + ((i0 ? v0 : v1) % 8));
+                v2 = (((v1 < a0[11]) || (a1[1][15] + i1)) % 6);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v2 = (((v1 ? 76 : 52) ? (a0[9] >= v2) : (54 * i2)) != ((i2 % 6) * (66 % 8)));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v0 = (((i2 ? v1 : a1[2][12]) - (76 > v2)) % 8);
+                a0[0] = (((a0[15] + i2) + (98 + v1)) * ((v3 - 94) * (v0 < a1[0][13])));
+                v3 = (((a1[3][1] * 52) ? (17 / 4) : (28 ? v2 : i2)) % 6);
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((v2 - v2) && (74 * v0)) && ((i2 >= 29) || (i2 ? a0[6] : v2)));
+    }
+    v2 = (((v1 == a1[1][6]) <= (v2 <= v0)) * ((a1[1][7] * 65) && (94 && v0)));
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v1 = (((42 >= a1[3][10]) / 8) ? ((v1 && i4) >= (a0[6] / 2)) : ((v0 < 58) / 5));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((i5 ? v3 : 12) || (a0[13] || a1[2][14])) <= ((72 <= a0[4]) / 9));
+                v0 = (((a0[15] ? i4 : 73) || (v1 == i4)) > ((5 % 5) >= (i5 / 7)));
+                v2 = (((43 != i5) % 4) <= ((12 ? 91 : 79) + (a1[3][15] + v2)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v3 = (((a0[7] + v1) - (v2 >= v0)) ? ((v0 ? v2 : 56) * (v2 <= v3)) : ((v2 - v0) ? (v3 ? v1 : v1) : (a0[12] ? i4 : i4)));
+    }
+    v3 = (((a1[3][2] >= a0[9]) % 9) - ((v2 <= v3) < (43 != v3)));
+    if ((((a0[5] == 2) == (a1[3][7] != a0[11])) % 4)) {
+        v0 = (((64 % 9) / 1) >= ((v0 / 5) > (v1 / 6)));
+        v3 = (((a1[0][4] > 33) > (77 < v1)) == ((v2 <= 12) < (v0 && v3)));
+        a1[3][11] = (((v1 <= a1[2][8]) / 3) || ((v0 < v0) + (a1[2][6] - a1[2][15])));
+    } else {
+        a1[2][14] = (((v2 == v1) > (v1 >= v1)) <= ((v0 / 6) % 5));
+        v0 = (((a1[0][6] ? a0[2] : a0[0]) != (v2 <= v0)) < ((v1 + v0) == (a0[4] || v2)));
+        v0 = (((v1 * v0) - (a0[3] ? v2 : v1)) >= ((v1 + a1[0][8]) >= (v3 >= 69)));
+    }
+    a0[10] = (((v1 % 6) - (a1[2][10] - 99)) + ((25 % 5) * (a0[5] || v0)));
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((v3 != a1[0][6]) > (a0[14] / 8)) + ((v3 - a1[1][12]) * (a0[10] > v0)));
+                    v3 = (((i7 <= v2) > (v1 ? i7 : v2)) + ((13 != i7) >= (v2 == 65)));
+                    v0 = (((a0[8] != v0) - (a0[11] <= a0[13])) && ((v0 != 48) || (v2 % 6)));
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            v0 = (((v1 >= v1) / 2) * ((v1 * v2) == (v0 && v1)));
+            a1[2][2] = (((a0[2] || v2) % 3) > ((v2 / 2) * (71 ? v3 : 38)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    v1 = (((48 >= a1[2][6]) % 9) <= ((a1[0][0] + 70) < (v2 ? v0 : v3)));
+    return (((69 || 15) / 6) % 8);
+}
+int f3() {
+    int v0 = 13;
+    int v1 = 20;
+    int v2 = 72;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 / 3) ? (v0 == 27) : (a1[1][14] != 63)) ? ((72 == a0[14]) || (90 && a1[2][8])) : ((v3 % 7) != (a1[2][10] >= a0[4])))) {
+        v1 = (((91 != 6) == (v1 - v3)) != ((59 % 7) % 8));
+        v3 = (((v1 - v3) % 3) || ((v1 / 5) || (a0[11] == 21)));
+        a1[1][5] = (((v2 == 69) - (v3 || v3)) / 1);
+    } else {
+        v0 = (((v1 * v3) < (v2 - a0[13])) ? ((52 > v3) / 7) : ((a1[2][14] % 6) <= (a1[3][0] + a0[13])));
+        a0[14] = (((a0[2] <= 4) / 3) + ((a1[3][6] * v1) % 2));
+        v0 = (((a0[12] - 93) && (a1[1][8] < v0)) ? ((90 ? 42 : a1[0][14]) == (a1[3][1] != v0)) : ((a0[6] ? v2 : 12) == (a0[1] / 6)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[2][12] = (((v0 ? i0 : v2) + (a0[1] * v1)) && ((62 == i0) <= (a0[11] < v3)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v2 = (((64 < a0[8]) > (40 ? 34 : v3)) && ((i0 > a1[1][6]) - (57 || i0)));
+                    v0 = (((a1[3][12] / 9) ? (a1[1][7] >= a1[2][6]) : (a0[3] >= v1)) || ((v3 != i0) ? (i0 / 6) : (a1[1][15] >= 45)));
+                    v0 = (((95 || 72) >= (a1[1][6] && v3)) != ((i0 || 23) < (v3 == v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[0] = (((34 == v2) <= (v0 < i0)) + ((v1 >= v1) - (82 <= v1)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v2 = (((50 % 5) ? (81 * v3) : (a1[3][11] - v0)) ? ((66 / 3) / 8) : ((57 >= v1) - (a0[0] ? v2 : v1)));
+        {
+            int i3 = 0;
+            do {
+                a0[1] = (((i3 >= i3) + (v2 <= v2)) + ((a0[9] != v1) >= (71 > a1[1][2])));
+                a0[7] = (((a0[10] && i3) || (a0[1] >= v0)) || ((v0 && a1[3][6]) != (12 % 4)));
+                v3 = (((57 ? 33 : v2) && (31 && v1)) < ((a0[4] - a1[2][2]) != (v1 || 61)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        v3 = (((a1[2][3] && a0[11]) + (v3 || v3)) ? ((v3 - 2) + (i2 && 10)) : ((32 >= a1[0][8]) == (v1 >= 25)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((a1[3][0] * v0) < (i4 + v2)) != ((v2 + 53) || (v3 == i4)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                a0[9] = (((i5 && 28) % 3) * ((a1[0][15] * 66) / 1));
+                v0 = (((i4 || a0[7]) || (v1 <= 39)) > ((71 / 1) >= (a0[15] || a1[1][4])));
+                v1 = (((v1 + 8) + (v0 - i5)) >= ((v3 + v2) < (v2 && a0[1])));
+            }
+            v0 = (((v0 * 72) / 1) / 8);
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    v3 = (((v0 ? 92 : 20) < (v1 || 2)) / 7);
+    if ((((38 ? v3 : 93) <= (v2 && a0[15])) || ((v2 % 8) + (a0[3] >= v0)))) {
+        v2 = (((v0 != v1) * (v2 % 8)) / 2);
+        v1 = (((1 % 4) || (40 * v0)) > ((72 && v0) + (a1[0][12] % 8)));
+        a1[1][15] = (((v0 > v3) % 8) ? ((47 < v1) == (v1 < a0[3])) : ((v0 && v1) ? (v3 && a0[0]) : (a1[0][13] + 15)));
+    } else {
+        v2 = (((v3 < a1[0][0]) >= (83 == 90)) > ((a1[3][11] / 7) != (82 <= 96)));
+        a1[3][10] = (((a0[14] != v0) || (99 && a0[2])) % 9);
+        a1[2][8] = (((v3 * a1[1][5]) < (a0[15] * 94)) % 2);
+    }
+    if ((((a1[3][5] - v0) <= (v3 != a0[1])) + ((a1[2][7] && a1[0][13]) < (83 == v0)))) {
+        v1 = (((v1 + v2) + (69 / 4)) == ((v2 % 2) == (24 ? v2 : v3)));
+        a1[3][12] = (((v0 && a0[4]) * (v0 % 4)) && ((v1 + a0[14]) < (v3 >= a0[15])));
+        a1[0][8] = (((a1[2][2] >= v2) + (29 <= v3)) <= ((44 % 6) ? (73 / 4) : (v2 && a0[15])));
+    } else {
+        a0[4] = (((36 > a1[2][12]) == (v0 + v0)) <= ((8 != a1[1][0]) == (a0[0] < v2)));
+        a0[10] = (((a1[3][6] + a1[2][11]) ? (v0 > v0) : (a1[3][14] % 2)) || ((v3 + 79) ? (v2 / 6) : (v0 ? v2 : a0[12])));
+        a1[2][4] = (((19 % 5) < (52 >= a1[1][8])) == ((v1 / 5) / 4));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            while (i7 < 5) {
+                v3 = (((a0[8] % 9) ? (v1 <= v0) : (v1 >= 74)) >= ((i6 && v3) >= (30 && v3)));
+                a1[1][5] = (((i7 != v0) == (v2 % 6)) || ((v0 * a0[1]) + (i6 / 3)));
+                a0[1] = (((v3 <= v0) * (a1[3][14] % 6)) || ((v1 / 6) != (v0 || a1[0][7])));
+                i7 = i7 + 1;
+            }
+        }
+        v0 = (((v0 && v2) ? (22 < 7) : (97 / 1)) + ((v1 ? v3 : v1) == (14 % 6)));
+        v2 = (((a1[1][9] >= v0) > (89 - i6)) || ((34 / 6) + (v3 < i6)));
+    }
+    v2 = (((v0 == v2) || (v0 * v1)) / 1);
+    {
+        int i8 = 0;
+        do {
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    v1 = (((v2 && i9) != (v2 + i8)) - ((a1[0][1] - v1) > (v2 < a0[2])));
+                    a0[14] = (((a0[9] - v3) ? (i9 ? a0[12] : 21) : (i8 % 5)) > ((v1 % 6) / 4));
+                    v0 = (((a0[10] - i9) * (38 && v3)) ? ((19 ? 75 : i8) - (v3 > 94)) : ((a0[15] ? i8 : v1) > (i9 <= v2)));
+                    i9 = i9 + 1;
+                }
+            }
+            a0[10] = (((v0 ? i8 : v1) != (34 || v1)) ? ((a1[1][8] || a0[14]) > (i8 * i8)) : ((a0[7] * a1[2][2]) - (89 != a0[10])));
+            v1 = (((a1[1][8] == 92) >= (v3 != v2)) * ((v1 != v3) <= (a1[3][11] ? a1[2][1] : v0)));
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    return (((20 == 11) + (71 && v0)) / 5);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,171 @@
+int f0() {
+    int v0 = 79;
+    int v1 = 25;
+    int v2 = 70;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 != v3) - (16 ? v1 : v1)) || ((v1 ? 84 : 75) == (v0 * v1)));
+    v3 = (((v2 ? v0 : a1[2][12]) % 4) >= ((v0 >= a0[3]) ? (v1 || a1[1][12]) : (v2 / 7)));
+    if ((((v2 > 95) % 4) / 5)) {
+        a0[6] = (((v3 - 63) ? (v3 <= a0[5]) : (a0[14] - v0)) - ((a1[1][1] / 2) / 4));
+        v0 = (((v1 < a1[1][8]) < (v3 ? a1[3][8] : 22)) - ((a0[2] == 7) != (v0 <= 61)));
+        v1 = (((v0 / 5) && (a1[0][10] ? v0 : a1[1][7])) < ((a0[11] ? a1[0][11] : a0[8]) > (v2 < a0[0])));
+    } else {
+        a1[3][7] = (((v3 > v1) >= (a1[2][2] ? v3 : a1[3][7])) > ((84 / 5) % 8));
+        a0[9] = (((v3 >= v2) + (v1 ? a0[2] : 9)) * ((26 < a1[0][11]) >= (59 / 8)));
+        v1 = (((v3 || 56) < (v1 == v2)) % 2);
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((79 ? i0 : v1) && (i1 / 2)) % 3);
+                    v1 = (((a0[5] ? v2 : 14) > (i0 / 8)) - ((i1 / 8) || (i0 % 9)));
+                    a0[15] = (((v2 % 1) >= (65 - v1)) > ((a0[5] % 5) % 3));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][11] = (((11 + v1) % 1) ? ((85 || v3) == (a0[11] && 49)) : ((i0 >= v2) <= (v2 != a0[10])));
+            v1 = (((v2 / 8) >= (a1[2][10] == 9)) || ((a0[8] && v3) == (29 && 35)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v0 = (((v1 + 11) ? (v0 ? v3 : a0[0]) : (v1 == v1)) >= ((v1 + a1[3][4]) > (v1 > v1)));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((i3 == i2) > 83) break;
+                    v0 = (((v0 - i2) == (a0[2] % 7)) % 3);
+                    v3 = (((v3 + a0[14]) || (i3 < i3)) <= ((0 / 6) == (v3 - i3)));
+                    v2 = (((v3 >= i3) * (a1[3][2] ? v3 : i2)) / 2);
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a1[3][11] * a1[1][11]) >= (38 % 6)) - ((v2 ? a1[1][9] : v1) ? (12 + v0) : (a1[1][0] ? i2 : v2)));
+            v2 = (((v2 && a1[1][12]) < (v2 - v3)) + ((v1 % 8) ? (a1[1][4] > 23) : (a1[2][10] && a1[3][13])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[1] = (((v2 ? v3 : v0) <= (a0[12] - 28)) - ((a1[2][12] ? 29 : v3) * (81 / 2)));
+            a0[9] = (((50 != v1) <= (a1[0][2] != 97)) - ((77 == i4) - (v2 % 6)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v3 = (((i5 ? a1[3][6] : i5) >= (66 > i5)) / 7);
+                v3 = (((2 >= 46) && (89 + i4)) <= ((v3 >= v0) >= (v1 ? i4 : a1[1][8])));
+                a1[3][7] = (((v3 && i5) >= (a1[0][1] / 3)) ? ((v1 >= 30) <= (v2 || 25)) : ((i4 != 62) <= (v0 && 34)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    a1[0][13] = (((v0 / 8) ? (a1[2][12] * v1) : (v1 <= v2)) < ((v2 % 7) == (v2 / 2)));
+    {
+        int i6 = 0;
+        do {
+            v3 = (((v3 / 4) ? (76 < v1) : (v3 ? 89 : 54)) ? ((a1[2][1] + 20) * (v2 == 71)) : ((v3 || 4) <= (30 >= a0[5])));
+            {
+                int i7 = 0;
+                do {
+                    if ((i6 + i7) > 97) break;
+                    v1 = (((a0[10] > v2) > (92 - a1[0][1])) == ((v1 % 7) == (i6 != a0[9])));
+                    a0[9] = (((v0 || i6) != (v1 + v2)) != ((a1[0][7] % 8) || (a0[0] > v2)));
+                    v3 = (((8 % 7) + (i7 + v3)) + ((82 && 78) || (v3 > v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            a1[1][0] = (((v0 ? v0 : a1[3][0]) >= (a1[2][5] - a1[2][12])) == ((v3 <= 92) > (a1[3][9] > 19)));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        v1 = (((v2 % 5) >= (a1[1][15] ? v1 : v1)) || ((v3 ? 40 : 78) % 2));
+        a1[3][4] = (((v0 ? v0 : 8) || (a0[2] - i8)) < ((86 - 87) != (95 && v1)));
+        for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+            v1 = (((v3 + a0[13]) <= (i9 <= v1)) / 6);
+            v1 = (((a0[15] || 36) >= (53 ? 73 : 29)) && ((v1 % 8) / 3));
+            v1 = (((i9 - i8) < (i8 == v3)) != ((41 + i9) >= (v1 / 8)));
+        }
+    }
+    return (((a1[3][3] * a0[13]) ? (v3 >= a0[9]) : (v1 == v3)) / 1);
+}
+int f1() {
+    int v0 = 24;
+    int v1 = 97;
+    int v2 = 77;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v0 ? v0 : v2) >= (16 == 88)) != ((v0 + 28) - (v1 * a0[3])));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v2 = (((i0 / 4) && (a0[2] == a0[1])) % 5);
+                v3 = (((v2 < i0) || (a0[2] != i0)) < ((v3 > 39) - (v2 ? v0 : v0)));
+                v3 = (((58 ? i1 : a1[0][1]) == (22 && v3)) != ((a0[3] > i0) != (v0 * a1[1][0])));
+            }
+            a0[6] = (((85 == v1) < (a1[0][9] - v0)) == ((a1[3][3] < i0) * (a0[13] / 4)));
+            a1[0][15] = (((v3 ? i0 : a1[1][5]) < (v0 >= a1[2][0])) ? ((89 > 19) || (30 ? i0 : v1)) : ((v3 > v2) == (a0[11] / 3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v1 = (((v1 * v0) * (v3 - v1)) == ((23 / 1) - (a1[2][5] || v1)));
+    v1 = (((94 < v3) > (v2 % 4)) ? ((v3 && v1) > (v2 == 72)) : ((v0 * v3) + (36 > v2)));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v0 = (((a0[12] || 81) != (54 || v1)) >= ((i2 / 2) ? (v0 >= v1) : (v1 + 2)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a1[2][9] = (((79 + a1[0][9]) / 1) / 9);
+            a1[1][3] = (((v1 * 54) >= (v2 >= a0[8])) ? ((a1[2][9] < v3) - (a0[12] > i2)) : ((i3 >= v3) + (a1[3][5] > a1[0][7])));
+            v2 = (((86 / 2) == (v1 ? i2 : 46)) < ((v2 <= v2) * (v1 >= i2)));
+        }
+        v1 = (((6 + v0) % 1) ? ((i2 < v3) || (i2 * v3)) : ((v1 > v0) + (73 && a0[5])));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((v3 ? v3 : 69) > 70) break;
+        v1 = (((v1 <= 57) - (3 ? a1[0][3] : v0)) && ((a1[1][1] <= v3) / 8));
+        v1 = (((77 % 1) > (v0 <= 38)) != ((36 == v2) && (3 >= v1)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v0 = (((13 - v1) ? (i5 < i5) : (v1 ? v0 : a0[12])) * ((a1[2][4] / 6) && (i5 - v3)));
+            v0 = (((a1[3][12] >= v2) == (i5 - 63)) * ((v2 % 1) != (34 == a0[15])));
+            v1 = (((29 / 4) < (21 != a1[3][11])) / 5);
+        }
+    }
+    if ((((v2 % 9) / 1) + ((a0[8] == v3) != (v1 && a0[9])))) {
+        v0 = (((v2 ? v3 : v3) > (87 <= a1[1][12])) / 2);
+        a0[6] = (((50 >= v0) * (a0[10] == v2)) ? ((v3 < 16) < (92 && v0)) : ((a0[1] || a1[3][12]) + (v0 % 1)));
+        v0 = (((v3 / 9) - (83 / 2)) != ((v0 < 95) > (v0 < a0[8])));
+    } else {
+        v0 = (((v3 ? v1 : 72) ? (v2 ? a0[15] : 93) : (42 != v0)) * ((a0[4] > v1) % 9));
+        a0[10] = (((22 != v2) <= (35 < a1[2][14])) > ((v2 >= v3) * (a1[2][8] && a1[1][15])));
+        v3 = (((v0 > a0[8]) - (12 != v2)) && ((v2 >= v3) * (v2 || a0[10])));
+    }
+    v3 = (((v3 * v2) != (v2 * v2)) >= ((a0[13] + v0) ? (v0 && a1[1][3]) : (v0 && v3)));
+    a0[1] = (((v1 != a1[0][4]) - (v1 / 5)) % 4);
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            v2 = (((79 && v0) != (i6 != a1[3][0])) >= ((v2 ? i6 : i6) || (99 != a1[2][6])));
+            v0 = (((i6 <= 66) <= (a1[1][6] == v0)) || ((a0[14] ? v1 : v3) - (v1 / 5)));
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                a1[0][9] = (((i7 == 45) - (34 <= 67)) || ((i7 < i7) && (v2 >= a1[3][5])));
+                v3 = (((v3 % 1) / 9) != ((i7 <= 94) / 6));
+                v3 = (((i7 && 32) <= (99 || 35)) || ((i7 / 8) / 1));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((a1[3][15] ? v0 : 70) <= (v1 != 72)) + ((v3 ? v1 : 1) + (a0[5] ? 2 : a1[1][12])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,255 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 5;
+    int v2 = 32;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((73 == v1) > 71) break;
+            v2 = (((60 > a1[2][13]) ? (i0 || i0) : (79 != 79)) <= ((a0[13] == v2) * (9 * a0[11])));
+            v0 = (((i0 > 34) && (v3 % 3)) * ((v1 / 1) ? (i0 && 5) : (a0[7] >= 9)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((67 % 9) > 89) break;
+                    a0[14] = (((i0 > 64) || (a1[3][12] * v1)) < ((i1 - a1[1][0]) <= (i1 && 26)));
+                    v2 = (((v1 + v0) + (45 / 2)) * ((i0 * a0[0]) * (a1[0][4] || v2)));
+                    a1[0][5] = (((v1 / 8) + (a0[11] == a1[1][11])) >= ((a1[1][1] && v0) && (a0[5] + i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[1] = (((a1[2][13] || a0[7]) == (v0 && a1[2][0])) != ((36 || i2) < (v1 * v3)));
+            a1[3][5] = (((v0 == a1[0][0]) <= (v1 > 7)) == ((a0[13] && v2) < (v1 / 2)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v2 = (((a0[0] - 2) * (66 <= a0[0])) && ((i2 + 80) <= (i3 * a1[1][11])));
+                a1[0][11] = (((60 || a0[3]) - (v1 - a0[3])) * ((34 < 44) <= (90 + a1[3][8])));
+                v0 = (((a1[1][10] < 3) && (a0[10] % 4)) - ((i2 % 5) > (a1[3][7] > i3)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v2 = (((v3 * i4) >= (31 <= 51)) / 6);
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v0 = (((74 != 41) - (53 <= i5)) || ((v1 < 56) >= (v0 >= v1)));
+                a0[1] = (((10 == 69) * (a1[0][8] != 3)) || ((97 != 13) > (i4 * v0)));
+                v0 = (((i4 != i4) <= (a1[0][1] != a0[7])) > ((i5 ? 74 : v3) || (v0 >= a0[13])));
+            }
+            v2 = (((v3 > 57) <= (v0 % 2)) || ((i4 && 23) % 7));
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((54 != v2) % 1) >= ((a0[10] || v1) == (v3 + a1[2][9])));
+    v3 = (((v3 && 15) >= (v1 >= a0[7])) + ((v0 || v3) && (19 || v0)));
+    if ((((26 >= a0[2]) < (24 && v1)) < ((a1[0][6] + v1) ? (a1[2][8] <= v1) : (14 ? 34 : 86)))) {
+        v2 = (((a1[3][9] != a0[2]) <= (85 % 3)) % 6);
+        a0[4] = (((v3 * v0) ? (a1[1][13] > v1) : (14 - v2)) ? ((a1[0][7] % 5) * (75 + v1)) : ((v0 || v3) % 4));
+        a0[3] = (((55 ? a1[0][4] : 78) < (a0[11] < 25)) >= ((v2 == v1) == (v2 ? v0 : v3)));
+    } else {
+        a0[7] = (((74 && a1[0][6]) ? (a1[3][1] <= v3) : (6 ? v1 : v1)) && ((v0 % 4) % 1));
+        v3 = (((53 < v0) ? (v2 - v2) : (74 + 73)) ? ((a0[9] > v1) <= (v0 ? v1 : a1[3][14])) : ((v2 ? v3 : v1) % 6));
+        a0[10] = (((v2 ? 32 : 30) && (v1 % 5)) && ((a1[1][7] + v2) == (v2 == a0[6])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            if ((66 && v2) > 70) break;
+            v1 = (((a1[1][8] > v3) <= (i6 / 3)) != ((a0[15] < v1) <= (a0[0] + i6)));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    if ((i6 > v0) > 98) break;
+                    v2 = (((80 <= a1[0][13]) * (i7 <= v2)) == ((v2 ? a1[3][5] : v3) / 9));
+                    a0[10] = (((v3 <= a0[9]) - (i7 < a1[1][9])) && ((v3 % 4) >= (87 != 35)));
+                    v1 = (((54 != v2) <= (i7 == v0)) == ((v3 ? 42 : v1) ? (32 - a1[3][9]) : (40 * v3)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((12 || v0) <= (a0[7] >= a0[8])) - ((v2 < 10) < (45 % 7)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((a1[1][13] * a1[0][8]) > 57) break;
+            v3 = (((v2 < a1[1][5]) < (v2 < 1)) || ((i8 && 19) ? (v2 * 4) : (98 && v1)));
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    a1[0][15] = (((a1[1][9] - 54) ? (i9 <= v3) : (22 && v1)) + ((v1 * i8) == (a0[15] / 5)));
+                    v0 = (((v2 != 63) > (a1[0][6] == v1)) * ((a1[2][9] / 3) * (i8 <= v0)));
+                    v0 = (((v0 && v1) / 6) * ((27 ? i8 : v1) * (i9 % 5)));
+                    i9 = i9 + 1;
+                }
+            }
+            a1[0][1] = (((a1[3][11] / 7) || (v2 >= a0[15])) ? ((v1 <= v2) + (v0 > a1[3][9])) : ((65 / 2) <= (a0[13] >= v3)));
+            i8 = i8 + 1;
+        } while (i8 < 8);
+    }
+    {
+        int i10 = 0;
+        do {
+            v3 = (((i10 == v0) && (i10 != a1[1][6])) == ((i10 / 4) != (v0 - a1[1][0])));
+            v2 = (((11 / 2) - (55 < a0[8])) % 8);
+            for (int i11 = 0; i11 < 6; i11 = i11 + 1) {
+                if ((75 - a0[3]) > 75) break;
+                a0[3] = (((v2 % 4) >= (v2 - a0[4])) <= ((v2 ? v1 : v1) ? (v2 == a1[0][13]) : (52 >= a0[2])));
+                a1[0][7] = (((52 != 8) || (68 ? v1 : i11)) <= ((31 ? i11 : 79) - (v2 < 69)));
+                v1 = (((71 * a1[3][11]) + (a1[0][7] % 8)) + ((50 <= 39) % 8));
+            }
+            i10 = i10 + 1;
+        } while (i10 < 3);
+    }
+    {
+        int i12 = 0;
+        do {
+            v0 = (((v1 && 39) % 8) / 4);
+            v2 = (((a1[0][2] < 76) / 5) > ((a1[2][8] / 1) != (81 ? a0[8] : 89)));
+            {
+                int i13 = 0;
+                while (i13 < 3) {
+                    a1[0][14] = (((i13 && v2) && (26 + 78)) && ((a1[0][1] % 3) * (a1[3][4] >= 42)));
+                    v3 = (((78 || a1[0][6]) > (a0[11] % 7)) * ((v0 * v2) && (72 + v2)));
+                    a0[5] = (((55 ? 29 : a1[0][15]) ? (v1 || a1[3][9]) : (v0 || 76)) >= ((a1[0][14] || i12) != (i13 % 3)));
+                    i13 = i13 + 1;
+                }
+            }
+            i12 = i12 + 1;
+        } while (i12 < 4);
+    }
+    return (((a1[2][4] != a0[12]) != (v1 <= a1[2][10])) == ((v0 - 85) < (v0 == v0)));
+}
+int f1() {
+    int v0 = 49;
+    int v1 = 58;
+    int v2 = 57;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 <= v2) / 2) * ((v2 > 43) ? (v2 >= 91) : (v0 * a1[3][8])))) {
+        v1 = (((v1 % 7) <= (v1 != v3)) * ((v2 < 79) <= (a1[1][15] % 4)));
+        v3 = (((a0[9] || v1) || (15 && v3)) - ((a1[1][13] ? v3 : a1[0][1]) % 7));
+        a0[0] = (((23 > a1[2][1]) != (53 + 30)) ? ((71 && v1) <= (74 >= v3)) : ((a0[11] >= a0[13]) && (v3 * v0)));
+    } else {
+        a1[0][1] = (((27 ? 76 : a1[0][2]) || (v3 + v1)) - ((59 % 9) >= (50 / 5)));
+        a1[0][9] = (((v0 - 67) || (v0 == v2)) != ((a0[15] * a1[0][9]) == (v1 > a0[3])));
+        v0 = (((a1[2][4] && a1[2][7]) == (v0 / 3)) - ((a1[0][14] + a1[1][0]) % 2));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v2 = (((17 ? 50 : a1[2][4]) || (v0 ? v3 : 85)) || ((v2 || v3) > (a0[10] ? v0 : a0[11])));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v1 = (((v3 + v0) - (60 >= 83)) != ((a0[7] * v0) >= (14 || v1)));
+            v1 = (((i1 * a0[15]) < (a0[15] * v2)) / 4);
+            a1[0][11] = (((v1 && i0) >= (v3 && i0)) > ((v1 != a0[10]) - (a0[15] % 5)));
+        }
+        v0 = (((i0 % 3) <= (20 == i0)) ? ((a0[15] || v2) < (v1 + 70)) : ((a1[0][15] && i0) == (v3 >= v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((v2 / 5) > 83) break;
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((25 || i3) - (a1[3][2] / 8)) <= ((i3 ? v3 : 69) != (a0[0] != 98)));
+                    v3 = (((a1[2][0] || 49) && (v3 || v3)) || ((87 ? a0[13] : v3) * (v2 ? v2 : v1)));
+                    v0 = (((v3 * i3) * (a1[2][9] != 64)) <= ((a1[2][9] + v0) > (56 != v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((40 * 25) ? (i2 != a1[1][8]) : (v3 / 3)) || ((a1[0][1] == 11) && (a0[10] * 10)));
+            v2 = (((i2 % 3) >= (36 != a0[13])) < ((v2 >= v0) <= (v1 + v0)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[9] = (((v0 > a0[8]) == (v1 <= v1)) < ((a0[15] ? v2 : 87) || (81 || v3)));
+            {
+                int i5 = 0;
+                do {
+                    a0[6] = (((0 ? 8 : v3) > (i4 * 22)) && ((44 ? a0[14] : a0[8]) < (44 || v0)));
+                    a1[0][7] = (((82 % 4) || (v2 >= i5)) > ((54 + v3) <= (v0 % 5)));
+                    v0 = (((a0[9] / 3) ? (a1[3][7] ? v3 : v0) : (a0[10] || v0)) && ((v2 <= 46) > (48 % 8)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            a0[6] = (((v0 < a0[3]) > (v0 ? v1 : v3)) / 5);
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    if ((((4 > v1) <= (v1 >= v0)) % 5)) {
+        v1 = (((v0 < a1[0][10]) < (v0 >= a0[2])) ? ((v1 - v2) || (v3 && v2)) : ((45 + v0) / 1));
+        v3 = (((v3 ? a1[2][3] : 44) > (v2 - v1)) / 3);
+        v1 = (((v2 ? v1 : a1[2][15]) < (v3 * v2)) * ((v3 < a1[1][2]) >= (a1[3][10] ? v2 : v3)));
+    } else {
+        a0[10] = (((v3 * v0) != (58 && 96)) >= ((39 + 58) >= (90 - a0[1])));
+        a1[1][12] = (((a1[2][3] != v1) >= (49 ? v3 : v1)) >= ((a0[6] < v3) ? (a1[1][14] && v3) : (v3 >= a0[5])));
+        v2 = (((94 > v1) + (v2 % 9)) && ((v2 / 8) * (v3 < v3)));
+    }
+    if ((((v2 / 7) - (v2 * v2)) ? ((v0 / 1) >= (v3 / 1)) : ((v0 <= v0) + (v3 || v3)))) {
+        v1 = (((56 >= v0) / 9) ? ((a0[10] < v1) != (v1 != v2)) : ((a1[2][7] || a1[0][6]) || (79 ? v3 : a1[2][10])));
+        a1[1][2] = (((v3 && v1) % 6) || ((v0 + 70) == (v1 - 70)));
+        a0[7] = (((v3 > v1) != (v2 && 48)) != ((v1 <= a0[5]) % 7));
+    } else {
+        a1[3][8] = (((v2 + v3) ? (82 ? a0[7] : a0[13]) : (a1[3][12] * v2)) % 4);
+        v3 = (((v1 > 16) != (v1 <= v0)) != ((v0 % 6) == (v2 == a1[2][8])));
+        v0 = (((v2 >= 75) == (22 > v0)) - ((v2 % 6) / 5));
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        v3 = (((59 - v3) == (23 % 6)) - ((53 <= 40) <= (v0 ? 27 : 65)));
+        v2 = (((v1 + 20) ? (v1 > v3) : (v2 * a1[1][5])) != ((9 >= 36) != (v1 > 99)));
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            v3 = (((v3 ? 52 : v2) || (v2 % 3)) < ((51 != 76) > (v3 / 7)));
+            v0 = (((v0 / 2) - (v2 + 8)) ? ((34 == 57) - (v1 != a1[3][3])) : ((v2 + 23) > (v1 || a1[1][11])));
+            v1 = (((31 < v1) + (a0[13] * v3)) * ((v2 * v3) * (v0 >= a0[11])));
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            v1 = (((v2 - a0[1]) / 2) > ((a0[8] && v0) + (i8 + i8)));
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    v2 = (((4 > 26) && (v0 ? 74 : a0[14])) + ((i9 < 74) ? (i9 / 7) : (v1 || i9)));
+                    v2 = (((v3 || a1[1][11]) ? (a0[7] != v1) : (12 <= i8)) + ((87 + 77) * (i9 <= v3)));
+                    v0 = (((a1[0][9] / 2) != (a1[1][8] >= a1[2][12])) ? ((a0[2] > v1) >= (v3 >= i8)) : ((a1[3][0] - i9) != (20 / 7)));
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((v0 * i8) % 3) == ((a0[14] + v3) && (a0[5] % 5)));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((a1[2][11] < 29) + (v3 ? v0 : v2)) * ((28 ? v3 : a0[13]) == (v1 == v3)))) {
+        v3 = (((v3 && v0) == (v1 % 1)) && ((a1[3][12] - 28) < (v1 % 4)));
+        v1 = (((a1[3][1] && 37) / 6) < ((a1[0][7] - 10) < (v1 != 67)));
+        v1 = (((v2 % 4) != (76 > a1[2][8])) % 9);
+    } else {
+        v0 = (((v3 * 45) >= (a1[1][4] != v2)) > ((79 || v0) <= (a1[2][12] <= a1[2][1])));
+        v0 = (((v3 / 2) <= (v2 || a0[15])) ? ((v3 ? a1[1][5] : v0) * (63 != 79)) : ((a0[12] - v3) == (a1[0][4] + v0)));
+        a0[7] = (((v0 >= 96) * (v0 / 4)) && ((98 < a1[3][1]) <= (v3 % 9)));
+    }
+    v3 = (((v2 ? 67 : a0[9]) >= (v3 == 57)) < ((a0[12] <= v2) / 5));
+    return (((81 / 4) % 8) / 2);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
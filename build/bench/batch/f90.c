@@ -0,0 +1,352 @@
+int f0() {
+    int v0 = 58;
+    int v1 = 62;
+    int v2 = 38;
+    int v3 = 94;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a1[3][14] = (((a0[12] >= a0[10]) < (16 + a1[2][4])) && ((i0 + v1) / 4));
+            v3 = (((83 ? v0 : v0) > (v0 / 9)) / 4);
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v1 + i0) ? (54 && v2) : (v1 < a0[10])) > ((i0 == v3) && (v3 ? 55 : v0)));
+                    v2 = (((v1 <= a0[7]) || (99 < a0[13])) && ((a1[2][1] * a0[8]) == (27 + v3)));
+                    v2 = (((a0[5] >= v2) ? (a0[5] >= a1[1][3]) : (v3 == 90)) < ((i1 <= 74) * (99 && a0[6])));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a0[12] = (((18 <= v1) + (a0[3] <= v2)) + ((17 == v3) == (a0[10] * a0[2])));
+    if ((((42 / 2) + (v0 ? v2 : a1[1][12])) && ((27 * v2) < (v3 < v3)))) {
+        v2 = (((8 > a1[2][4]) % 3) >= ((48 + 51) < (v1 + 84)));
+        a1[3][8] = (((a1[3][0] || v1) / 6) ? ((v1 * a1[1][6]) >= (94 < v0)) : ((98 != 91) ? (64 < 42) : (v0 - v2)));
+        v1 = (((v0 * v2) != (v0 ? a1[2][6] : 95)) >= ((v2 && a1[1][7]) ? (89 != 31) : (v2 != 48)));
+    } else {
+        v3 = (((v2 % 4) && (a1[2][3] < a0[2])) % 2);
+        v2 = (((v0 % 6) != (v0 / 8)) ? ((v0 ? a1[2][5] : v0) && (v3 % 7)) : ((v0 < v3) + (13 + v2)));
+        v1 = (((v2 != a0[4]) - (a1[0][12] + v0)) ? ((56 < v2) ? (v1 % 7) : (v0 % 3)) : ((v3 ? v0 : 38) < (v2 ? a0[4] : 41)));
+    }
+    if ((((99 != v2) - (v0 + 5)) < ((v0 - 45) <= (v3 ? v2 : 28)))) {
+        v3 = (((v3 / 3) >= (v1 - a0[1])) - ((39 || a1[0][0]) <= (a0[11] || v1)));
+        v3 = (((v1 || v2) ? (v0 + v2) : (v1 && 39)) && ((a1[1][8] + v2) > (a0[7] > v2)));
+        v3 = (((a0[1] <= a0[2]) && (a1[2][13] - v2)) && ((v1 + v3) <= (v2 == a1[2][13])));
+    } else {
+        a0[3] = (((a0[6] == v2) / 2) ? ((39 >= a0[12]) ? (a1[2][13] == v3) : (a1[1][1] ? v1 : 13)) : ((a1[1][15] || 94) == (60 < v0)));
+        v3 = (((v3 * v3) + (v0 % 1)) == ((10 != v0) / 6));
+        a1[2][4] = (((a1[2][11] < v0) + (a0[7] == v0)) * ((v2 * 49) * (64 - v0)));
+    }
+    if ((((a1[3][14] <= v0) < (27 == a0[2])) % 4)) {
+        v0 = (((v2 || v3) < (v1 / 5)) != ((v1 + a0[2]) != (a1[2][12] < a0[2])));
+        v0 = (((v3 || 66) / 9) < ((97 != v1) + (v2 > 1)));
+        a1[3][6] = (((a0[12] < v1) ? (57 && v3) : (v1 && v1)) + ((v3 < 61) / 4));
+    } else {
+        a1[0][3] = (((v3 % 7) ? (0 ? v0 : 21) : (a1[1][11] && v3)) != ((v3 > v2) > (v3 - a0[8])));
+        v0 = (((a1[3][5] >= v2) > (34 + a0[13])) + ((88 == a1[3][2]) >= (v0 ? v3 : a0[11])));
+        a1[1][5] = (((v2 ? a1[0][1] : 41) * (v2 + v0)) > ((a1[1][14] * v0) ? (95 ? a0[0] : 57) : (v1 >= v0)));
+    }
+    if ((((a1[0][12] && a1[3][5]) != (90 + a1[1][2])) % 4)) {
+        a0[15] = (((v1 % 1) && (v3 * a0[4])) - ((v0 < v0) <= (a0[11] != a1[2][10])));
+        v1 = (((v3 && v3) % 8) != ((a1[0][4] ? a1[3][2] : v0) && (v3 * v3)));
+        v3 = (((84 % 5) || (a1[3][2] || v0)) > ((v2 >= a0[13]) * (a1[2][1] != v0)));
+    } else {
+        v2 = (((34 ? v2 : v1) < (v0 && v1)) >= ((v3 + v2) < (a1[1][5] >= v2)));
+        v0 = (((v0 < 35) ? (v2 + v0) : (8 + v1)) - ((v2 / 2) * (57 + a1[3][1])));
+        a1[0][6] = (((97 - a0[8]) || (a0[15] == v1)) < ((v3 == 1) - (v0 ? a0[12] : v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v1 = (((v0 / 8) ? (91 >= a0[4]) : (i2 * v2)) && ((42 <= i3) ? (a0[11] < v1) : (i2 % 4)));
+                v0 = (((v2 != v2) - (63 || v1)) <= ((91 >= v3) <= (v2 || a0[2])));
+                v3 = (((v1 || v0) == (a0[15] >= i2)) != ((31 > v1) * (48 != 19)));
+            }
+            v0 = (((a0[15] != v3) == (a1[1][8] * v3)) != ((v2 == v2) ? (v2 <= v1) : (v2 == v0)));
+            v3 = (((v1 || v0) ? (v2 - 73) : (v3 <= v2)) > ((v3 % 6) ? (0 * a0[3]) : (79 * a1[0][12])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v2 != 5) != (v2 + 65)) + ((v1 ? 13 : v2) <= (a1[0][5] * v1)));
+            v0 = (((11 == 25) - (a1[3][5] % 9)) ? ((v0 > v0) > (60 + a0[3])) : ((v0 / 4) / 5));
+            {
+                int i5 = 0;
+                do {
+                    a0[12] = (((v1 - v0) >= (v2 - a1[3][8])) >= ((a0[10] * 32) && (62 / 4)));
+                    a1[1][0] = (((a1[3][9] != i4) ? (79 >= i5) : (a1[1][14] / 1)) > ((i4 * i4) * (a1[3][0] - v1)));
+                    v0 = (((33 <= v3) > (v2 == v1)) < ((97 / 9) == (a0[3] || v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                if ((i6 < v2) > 52) break;
+                v1 = (((v3 && v2) ? (a1[2][5] ? v2 : 65) : (a0[4] == i6)) - ((a0[5] && 6) || (v0 / 9)));
+                a1[0][7] = (((v2 % 2) == (v3 != v1)) != ((a0[9] % 3) % 9));
+                v0 = (((v2 % 4) <= (v0 ? i6 : v2)) >= ((a0[14] % 5) ? (v3 * 61) : (i6 != v1)));
+            }
+            v0 = (((i6 > i6) - (v1 - 83)) >= ((95 || 19) - (v3 ? i6 : v1)));
+            v3 = (((i6 || i6) ? (v1 >= v3) : (44 || a1[2][7])) || ((i6 - 84) ? (v3 / 9) : (v1 + a1[2][6])));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    v3 = (((33 > v1) * (a1[0][1] ? a1[2][9] : v0)) / 3);
+    return (((v0 < v0) ? (a0[5] ? v2 : a0[6]) : (29 && 1)) ? ((a1[2][15] <= v2) <= (v1 % 9)) : ((v1 || v1) ? (5 ? 56 : v3) : (v2 != v1)));
+}
+int f1() {
+    int v0 = 44;
+    int v1 = 23;
+    int v2 = 72;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[0][14] = (((a0[6] && 81) ? (v0 > v3) : (24 * v3)) <= ((v3 * 51) > (a1[2][13] != v3)));
+            v2 = (((80 ? 72 : 56) <= (v3 < 64)) ? ((v3 < v3) <= (i0 != v1)) : ((v0 >= a0[2]) > (i0 * a0[4])));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((80 < 33) >= (a1[1][12] ? v3 : v1)) != ((v0 < a0[0]) < (i0 == 82)));
+                    a1[1][2] = (((18 - a0[12]) < (v1 || a0[13])) <= ((a1[0][6] != 99) - (a1[1][11] % 7)));
+                    v0 = (((a0[4] < 78) % 2) - ((v2 == v0) ? (v2 >= a0[10]) : (i0 <= 90)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a0[2] < a0[3]) > 97) break;
+        v3 = (((12 ? 33 : a1[0][13]) || (22 < a1[3][1])) ? ((a1[1][0] != v0) == (v1 < a0[5])) : ((i2 < v0) % 8));
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                v2 = (((i3 <= a0[12]) * (v1 <= v1)) && ((21 ? v3 : v2) || (v2 || a0[10])));
+                v0 = (((a1[2][13] * 61) % 6) % 6);
+                v3 = (((v0 + i3) / 9) / 7);
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((v3 < 72) != (86 == v0)) < ((i2 < a1[0][1]) * (a0[14] == v2)));
+    }
+    a1[2][2] = (((a1[2][5] / 8) > (v2 >= v0)) <= ((39 * v1) + (v3 >= 94)));
+    v2 = (((a0[13] != v1) * (98 <= v0)) ? ((91 - 51) || (v0 % 5)) : ((v0 && 33) || (v1 <= v2)));
+    {
+        int i4 = 0;
+        do {
+            if ((v0 + 77) > 93) break;
+            a0[10] = (((15 % 2) <= (55 >= a0[11])) * ((a1[1][12] || 61) % 3));
+            a1[2][10] = (((i4 ? v2 : 22) == (56 * 15)) ? ((43 / 5) <= (v2 % 4)) : ((v0 > v0) - (v1 * a1[0][11])));
+            {
+                int i5 = 0;
+                do {
+                    a0[13] = (((a1[0][13] <= 57) || (a0[4] / 8)) < ((v0 ? i5 : i5) < (v3 % 6)));
+                    v2 = (((v2 <= v3) - (i5 + a0[6])) % 4);
+                    a1[1][3] = (((97 < a1[3][1]) - (72 * v3)) ? ((a1[3][5] == 19) || (22 && 72)) : ((v3 <= v1) * (v0 % 3)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((v1 >= v0) > 83) break;
+        v1 = (((v0 && a1[1][12]) % 8) < ((v2 % 8) % 4));
+        v2 = (((v3 ? 10 : 72) - (v0 || v0)) && ((a1[3][8] + 20) ? (86 ? 53 : v0) : (v0 > a0[13])));
+        {
+            int i7 = 0;
+            do {
+                v0 = (((93 / 9) % 8) == ((69 / 9) ? (a1[3][14] ? 37 : v1) : (i6 == v3)));
+                v1 = (((v1 >= v0) ? (v0 < v2) : (a0[2] != a1[1][0])) * ((v0 * 73) == (i6 / 9)));
+                v1 = (((v3 < a1[1][13]) && (v3 >= v2)) - ((29 - v3) / 1));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        v3 = (((v0 % 7) != (v1 % 3)) < ((v1 && v1) + (38 >= v0)));
+        v2 = (((32 != 68) % 7) <= ((a0[0] <= a1[1][9]) >= (a1[3][3] + 19)));
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                v2 = (((i8 >= v1) % 5) || ((v3 >= 73) ? (v1 * 18) : (a1[3][8] * a1[2][14])));
+                v2 = (((42 ? v3 : v0) / 9) || ((1 == v2) < (59 - v2)));
+                a1[1][8] = (((i9 % 2) * (i8 < i9)) % 4);
+                i9 = i9 + 1;
+            }
+        }
+    }
+    for (int i10 = 0; i10 < 2; i10 = i10 + 1) {
+        if ((v3 ? 46 : v0) > 68) break;
+        for (int i11 = 0; i11 < 7; i11 = i11 + 1) {
+            a0[8] = (((51 && v3) * (v2 % 4)) - ((v0 && 38) / 1));
+            v0 = (((a1[0][2] ? v2 : 55) >= (i10 / 3)) || ((6 * v1) <= (36 + v2)));
+            a0[12] = (((i10 > 47) / 9) / 2);
+        }
+        v2 = (((v0 * 45) && (a1[3][3] > i10)) % 9);
+        v2 = (((a0[14] ? i10 : v0) - (v0 - 38)) + ((40 && a1[2][8]) || (v0 / 4)));
+    }
+    if ((((a0[2] % 5) * (a1[1][8] >= 78)) / 4)) {
+        a1[1][14] = (((a0[7] == a1[1][0]) * (v3 == v0)) < ((a0[3] - a1[0][13]) ? (v1 ? a1[3][11] : v0) : (a0[11] ? 91 : a1[3][0])));
+        a0[5] = (((a1[2][9] == 16) < (76 && a1[2][8])) >= ((v1 && v2) * (v1 == a0[6])));
+        v0 = (((a0[5] % 1) == (v2 <= 48)) < ((v0 != v1) ? (7 != a1[0][15]) : (66 ? 62 : v2)));
+    } else {
+        v1 = (((a1[3][9] / 8) * (v3 <= 91)) >= ((v1 != 29) + (2 || v1)));
+        v2 = (((v1 && v3) >= (a0[1] <= v2)) + ((v3 ? v1 : v0) && (a1[2][2] < 97)));
+        v3 = (((a0[0] < v3) ? (a1[0][13] + v1) : (v1 >= v2)) < ((a0[2] * v3) && (v2 == v1)));
+    }
+    if ((((v0 != v0) >= (v0 <= v1)) && ((v0 <= a1[0][9]) != (41 ? 49 : a1[3][5])))) {
+        a0[11] = (((a1[0][6] % 8) > (v2 == v0)) % 3);
+        v2 = (((v0 && a1[0][12]) != (v3 ? 72 : v0)) || ((v2 ? v3 : 21) - (87 && v2)));
+        v0 = (((31 && 89) / 8) >= ((91 == v1) * (v3 >= a0[9])));
+    } else {
+        v0 = (((a1[3][4] ? v1 : v3) / 8) % 3);
+        a1[2][1] = (((v2 || v3) != (a1[1][7] % 7)) && ((13 >= v0) || (v2 + v3)));
+        a0[13] = (((a1[2][12] % 6) + (v1 - 16)) % 9);
+    }
+    return (((77 ? a0[1] : v1) <= (v3 != v1)) != ((98 > v2) || (55 + v2)));
+}
+int f2() {
+    int v0 = 57;
+    int v1 = 96;
+    int v2 = 90;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 - 55) && (49 + a0[10])) != ((v1 < v1) < (13 <= v0)))) {
+        a0[9] = (((v3 / 6) / 7) || ((84 == 85) + (v2 || v1)));
+        v1 = (((61 <= 3) + (v1 - v0)) == ((43 < v1) * (78 != a1[3][15])));
+        v2 = (((v0 || v3) <= (v2 ? v1 : v3)) * ((a1[3][15] > a0[8]) + (a1[3][11] * 50)));
+    } else {
+        v3 = (((v3 < 95) ? (a0[14] <= v1) : (a1[3][2] <= a1[1][3])) && ((a1[3][3] - 28) % 6));
+        v3 = (((v2 < a0[1]) / 7) % 8);
+        v2 = (((93 + v2) / 4) && ((v0 % 9) < (v3 + 50)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v1 = (((91 + a1[2][0]) / 5) - ((a1[1][4] % 6) || (88 > v3)));
+        a0[6] = (((a0[1] < a1[2][7]) / 6) ? ((85 % 2) ? (v3 > v1) : (a1[3][3] ? v0 : 26)) : ((4 != i0) / 9));
+        {
+            int i1 = 0;
+            do {
+                v2 = (((12 + i1) < (a0[3] <= v3)) * ((a0[13] == a0[4]) ? (v2 % 1) : (i0 ? v1 : a0[2])));
+                a1[0][15] = (((i1 * v3) >= (v1 - 42)) || ((v2 ? a0[9] : 66) <= (a1[3][8] || v1)));
+                a0[4] = (((86 || v0) ? (a1[0][3] >= v0) : (v3 || a1[0][6])) && ((6 != i0) > (i1 && i0)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    a1[0][0] = (((v2 - v2) + (36 ? a1[2][7] : a0[11])) && ((v3 == v2) != (v0 % 4)));
+    if ((((25 >= 45) + (v3 * v1)) % 6)) {
+        v0 = (((69 <= v2) - (v2 ? a1[0][14] : a1[3][14])) ? ((a0[15] > v0) ? (v3 && 10) : (v2 + 41)) : ((a1[1][8] || v3) ? (v0 < v3) : (72 + a1[2][12])));
+        v2 = (((v3 && 99) + (v1 <= a0[12])) >= ((v2 - a1[3][0]) <= (a1[3][5] - v2)));
+        v3 = (((v2 ? v0 : 36) && (v0 - v2)) < ((v1 || v2) + (a0[0] % 7)));
+    } else {
+        a1[2][13] = (((v2 > a0[5]) == (a1[1][12] <= 77)) <= ((v3 != v3) != (v1 && a0[2])));
+        v3 = (((v2 == v0) || (v1 && a1[0][11])) - ((v2 / 9) % 8));
+        v2 = (((v1 || 42) * (91 < v0)) > ((a1[3][3] - v1) > (92 && v0)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        a1[0][14] = (((a0[9] * v1) != (62 ? v2 : 93)) || ((a1[1][13] / 9) == (90 - v2)));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v2 = (((v2 <= 83) > (74 - 5)) || ((a0[11] != a1[1][7]) >= (v1 ? a1[0][1] : v3)));
+                v0 = (((69 % 4) == (88 + a1[1][0])) % 1);
+                a1[3][4] = (((v3 < a0[11]) == (v3 > v1)) || ((a1[1][15] >= 11) + (v1 + a0[5])));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((a0[6] % 2) ? (i2 && v2) : (v3 <= a1[2][6])) % 4);
+    }
+    if ((((a1[2][0] ? a1[2][6] : v3) > (v3 % 7)) / 1)) {
+        v2 = (((89 % 3) || (15 && a1[1][6])) > ((a0[3] || v2) ? (v3 || v2) : (v0 / 2)));
+        a1[3][14] = (((13 ? 95 : v2) <= (v3 ? 75 : a0[3])) != ((64 + 70) < (48 > a1[3][7])));
+        a0[15] = (((76 >= a0[0]) || (v1 * v1)) && ((v3 || v2) != (87 <= v2)));
+    } else {
+        v3 = (((v2 != v0) % 8) || ((v0 <= a1[0][13]) || (v0 && a1[1][8])));
+        v2 = (((87 ? v0 : 78) - (v1 - v0)) && ((v1 ? v3 : v3) / 4));
+        v2 = (((v0 * 67) / 6) || ((66 / 8) ? (v3 * 79) : (a1[0][10] * a0[6])));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v1 - 62) > 70) break;
+            a0[5] = (((v3 < 58) && (v2 ? v1 : 8)) % 6);
+            v1 = (((i4 ? a0[14] : 6) * (i4 >= a1[2][0])) ? ((a1[3][10] * a1[1][12]) >= (v1 % 7)) : ((a1[2][5] / 6) == (v2 / 8)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    a0[1] = (((36 != i5) <= (v1 != 50)) % 3);
+                    a1[2][2] = (((a0[10] > v0) - (44 - a1[0][8])) % 4);
+                    a0[8] = (((6 == v3) - (a0[2] >= v3)) != ((v3 % 9) - (v3 ? v0 : 19)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        v1 = (((a0[14] > i6) / 4) ? ((a1[3][6] < a0[2]) >= (i6 == a0[5])) : ((v2 / 1) + (a0[8] / 4)));
+        v2 = (((a1[0][7] >= 31) <= (i6 ? a1[0][15] : a1[1][14])) / 5);
+        {
+            int i7 = 0;
+            while (i7 < 5) {
+                if ((v2 % 4) > 81) break;
+                a1[0][15] = (((a0[12] % 6) * (i7 * a0[11])) != ((i7 % 8) == (31 > a0[4])));
+                v2 = (((v2 && i6) + (v1 || v3)) <= ((i7 ? v2 : 43) > (v1 && i7)));
+                v2 = (((v3 * a1[3][15]) >= (87 == a0[11])) + ((v3 != v3) - (i6 >= a0[10])));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    if ((((v0 ? v1 : v0) >= (33 + v1)) > ((v2 != v2) < (v0 != 5)))) {
+        v3 = (((v2 % 7) == (v0 / 6)) <= ((v0 % 9) > (v0 * 25)));
+        v1 = (((v2 % 9) ? (v1 || a1[0][7]) : (2 <= a0[4])) == ((v2 ? a1[2][1] : a0[3]) <= (83 || v0)));
+        v1 = (((v2 < a1[1][10]) - (a1[3][12] - 31)) && ((a0[4] / 7) < (v3 > v1)));
+    } else {
+        a0[2] = (((v3 ? v2 : a0[9]) >= (v2 % 6)) + ((v3 == a0[8]) <= (31 < 55)));
+        v1 = (((v0 && v3) && (a1[3][10] ? 75 : a1[1][12])) >= ((37 >= v3) >= (a1[2][15] > v0)));
+        v2 = (((63 + v0) == (80 != v1)) ? ((43 % 1) || (v3 == v1)) : ((21 * v2) == (35 * v1)));
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[9] = (((a1[3][1] > 85) ? (a0[9] < v0) : (a1[3][2] != 35)) % 8);
+            a1[3][12] = (((v1 ? v3 : v3) >= (v3 ? a1[0][5] : v3)) * ((v1 > i8) * (v3 > 69)));
+            {
+                int i9 = 0;
+                while (i9 < 6) {
+                    if ((a1[2][9] / 7) > 81) break;
+                    a0[12] = (((v0 && v1) || (34 % 4)) + ((v2 ? v1 : v2) >= (19 * 14)));
+                    v0 = (((v1 ? 43 : i8) && (46 / 3)) + ((a0[2] - v1) % 1));
+                    a0[3] = (((i9 > a1[2][0]) ? (a0[15] <= i8) : (a1[0][2] ? v0 : v2)) == ((v1 != a0[7]) < (a1[2][11] / 8)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    return (((v2 - v3) > (34 > a0[4])) >= ((a1[2][4] % 5) <= (v3 != v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,474 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 50;
+    int v2 = 35;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[2][14] % 6) * (63 || v0)) != ((v1 > v1) != (95 && 60)));
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((85 / 6) > 92) break;
+            v1 = (((v2 % 1) || (4 < 78)) + ((v0 >= 48) % 2));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((v3 == a1[2][11]) + (19 ? 60 : 54)) <= ((v3 || i0) ? (v3 != a1[1][0]) : (v1 * v2)));
+                    a0[10] = (((v0 && v1) > (v0 > v1)) == ((i0 != i1) > (v3 - 28)));
+                    a0[6] = (((89 * v1) + (v3 || 38)) == ((i0 ? 75 : 55) * (v3 + v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v3 || v2) || (v1 < 16)) ? ((v0 < v0) || (a1[3][11] % 3)) : ((a1[1][9] <= v1) % 8));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((v2 && a1[1][7]) > 80) break;
+            v0 = (((v3 ? 83 : i2) * (i2 < a0[1])) < ((v1 || a1[3][8]) <= (v0 + 42)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((11 % 8) > 80) break;
+                    a1[2][5] = (((v2 >= i2) <= (v3 * v3)) < ((a1[2][13] + 24) - (v0 <= v2)));
+                    v3 = (((v2 >= 80) / 4) && ((v2 + i3) != (a0[6] ? i2 : i2)));
+                    v2 = (((a0[11] < 43) * (19 > 72)) || ((a1[2][1] < v3) && (v2 <= 59)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((a0[8] < v0) ? (v1 < a1[2][15]) : (68 || 81)) - ((v1 >= 66) * (v3 || a0[8])));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((v0 ? 98 : i4) > 52) break;
+        {
+            int i5 = 0;
+            do {
+                v0 = (((i5 > a1[0][10]) && (i4 + 6)) == ((67 * 69) <= (v1 == v0)));
+                v1 = (((99 || a0[5]) + (55 ? v1 : v0)) + ((v2 > a1[1][0]) && (v2 * 72)));
+                v2 = (((6 * i5) + (a0[8] && v3)) < ((a1[1][7] >= v1) % 8));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        v3 = (((i4 <= a0[2]) ? (a1[2][1] == v3) : (v3 % 3)) < ((v2 / 1) / 9));
+        a0[13] = (((a0[2] ? a1[2][5] : i4) < (i4 != 5)) < ((86 != a1[1][6]) * (57 % 8)));
+    }
+    if ((((v1 || v1) * (a0[0] == 55)) == ((v2 != v0) - (v3 / 1)))) {
+        a0[2] = (((a0[7] >= v1) > (25 <= v3)) / 9);
+        v3 = (((v2 && v1) ? (a0[12] != v1) : (v1 - 47)) ? ((v3 + 0) - (a1[3][0] / 1)) : ((v2 / 9) * (44 + 70)));
+        v1 = (((v1 || 86) % 4) ? ((v0 ? a0[15] : v0) * (v3 >= a0[1])) : ((92 < 37) != (a1[1][8] / 9)));
+    } else {
+        v3 = (((a0[15] != v3) ? (v0 ? a1[0][3] : a0[4]) : (v1 <= 8)) < ((a1[1][0] - v1) + (v1 + a1[1][15])));
+        v0 = (((v0 != v0) * (a0[15] < a1[2][1])) <= ((a1[2][6] + v0) + (v0 >= 96)));
+        a0[4] = (((a1[1][7] - v0) % 9) + ((v1 > v3) * (3 && 30)));
+    }
+    a1[0][2] = (((v3 % 6) == (v1 != v3)) <= ((a0[10] && v1) * (v0 >= a1[3][5])));
+    {
+        int i6 = 0;
+        do {
+            if ((v2 * v3) > 55) break;
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v1 = (((i6 ? a1[1][10] : a1[0][0]) >= (25 > v3)) > ((i7 * v3) ? (v2 * 56) : (v1 && i7)));
+                v1 = (((i6 - 99) == (i6 ? v2 : 68)) + ((a1[1][3] * 44) || (i6 ? 36 : v2)));
+                v3 = (((i6 != v0) + (48 - v0)) * ((v2 ? 12 : i6) > (82 == 54)));
+            }
+            a1[3][1] = (((36 / 5) == (v3 / 2)) + ((v3 >= 91) > (a1[0][5] % 7)));
+            a1[2][1] = (((84 > v1) * (v3 == a1[1][8])) + ((v1 > 91) / 7));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    if ((((a1[2][14] - v1) >= (v0 / 9)) || ((a0[7] ? v1 : v2) != (v3 || v3)))) {
+        v2 = (((80 ? v0 : v2) != (v2 > 98)) && ((a0[2] > a1[0][4]) ? (v2 + 97) : (a0[8] ? 21 : a0[15])));
+        v0 = (((80 ? a1[2][15] : 88) != (a0[14] + v2)) <= ((a1[1][10] ? v1 : 22) - (v3 == v3)));
+        v3 = (((v3 ? 76 : 69) <= (v2 == 71)) % 8);
+    } else {
+        a1[0][12] = (((v0 + v0) ? (a1[1][15] ? 71 : a1[0][6]) : (a0[12] < v1)) == ((a0[9] * v3) == (v3 % 7)));
+        v3 = (((5 < a0[14]) ? (78 < 34) : (31 + a0[14])) ? ((56 != v2) && (a0[0] || v2)) : ((v3 < v3) || (v2 != a0[5])));
+        a0[4] = (((v3 > 56) != (v3 % 1)) / 6);
+    }
+    v1 = (((51 > v1) - (v1 * v1)) - ((88 == 0) && (a0[4] * a1[1][11])));
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            a0[14] = (((v3 ? 83 : a1[2][15]) ? (v0 % 9) : (65 / 9)) != ((v1 <= v0) <= (a0[7] ? a0[2] : 83)));
+            a0[0] = (((2 - 1) % 3) < ((v3 >= v0) != (v3 == 98)));
+            {
+                int i9 = 0;
+                do {
+                    v0 = (((a0[15] == v3) ? (19 != v0) : (a1[3][6] + 26)) != ((i8 * v2) < (a1[1][10] > a1[1][7])));
+                    v0 = (((72 >= a0[13]) ? (v1 && v2) : (69 ? 78 : 91)) - ((v1 + 15) <= (a0[1] / 2)));
+                    v0 = (((40 <= v3) == (a1[0][3] && v0)) != ((i9 + i9) + (v0 - 44)));
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v1 > v2) > (v3 * v2)) >= ((v2 || v1) < (51 - 7)));
+}
+int f1() {
+    int v0 = 78;
+    int v1 = 65;
+    int v2 = 44;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a1[1][2] == v1) < (v0 >= 26)) % 3);
+    if ((((v2 ? v1 : v1) * (v2 ? a0[6] : v3)) <= ((28 % 6) > (10 % 8)))) {
+        v0 = (((a0[13] >= 55) < (v3 > v2)) + ((v2 < a0[0]) * (32 || a1[0][4])));
+        v0 = (((a0[9] != v2) / 9) ? ((65 % 6) <= (32 >= a1[0][15])) : ((v3 > a0[13]) ? (v1 + a0[13]) : (v3 || a1[2][4])));
+        a0[15] = (((73 || v0) == (a0[8] > v0)) == ((63 - a1[2][8]) != (71 <= v3)));
+    } else {
+        a0[8] = (((v0 > a1[1][2]) != (v0 / 1)) != ((v1 || a1[0][12]) * (a0[13] >= v3)));
+        v2 = (((v2 != a0[2]) != (a1[0][14] * 51)) ? ((45 == v1) < (a1[2][2] % 9)) : ((a0[7] <= v2) / 7));
+        v0 = (((v2 / 8) > (65 && a1[1][15])) == ((a1[0][0] % 5) * (v2 >= a0[4])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v0 = (((i0 != v3) >= (v1 / 7)) ? ((35 ? i0 : v1) ? (a1[0][10] < v2) : (v2 >= a0[2])) : ((v3 == v3) + (21 != 65)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((a1[1][2] * 56) % 3) / 4);
+                v1 = (((i1 != 22) / 3) / 6);
+                a0[6] = (((44 == a1[2][9]) < (v1 / 5)) >= ((i1 / 1) * (a0[8] ? 85 : a1[3][14])));
+            }
+            v0 = (((a0[12] + v2) % 8) <= ((a1[2][7] <= 67) > (v0 || 41)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v0 = (((51 && v1) <= (v1 + 15)) < ((v3 && 86) - (a0[13] % 7)));
+        v0 = (((a0[3] / 3) && (i2 != v0)) <= ((a1[3][12] < v2) + (v2 > v3)));
+        {
+            int i3 = 0;
+            do {
+                a1[1][7] = (((i2 >= 38) && (i3 && v3)) > ((a1[2][6] / 7) && (99 || a1[1][13])));
+                a0[0] = (((v1 / 7) && (a1[3][7] ? 38 : v2)) / 5);
+                a0[8] = (((a1[2][2] ? v0 : v1) + (v0 || a0[2])) > ((v2 >= 34) ? (46 || v1) : (a1[0][7] >= v1)));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v2 = (((42 - v2) != (a1[1][0] < 85)) > ((v2 <= a0[4]) != (v3 ? a1[2][1] : v1)));
+        {
+            int i5 = 0;
+            do {
+                v0 = (((i5 && v0) >= (33 != i5)) % 7);
+                v3 = (((a0[12] <= v1) - (v1 == v3)) != ((v1 <= 49) - (v2 ? a0[8] : i4)));
+                a0[7] = (((v1 && a0[1]) <= (32 * i5)) || ((17 * v0) * (v0 && a1[3][14])));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v0 = (((v2 == 36) ? (v1 + i4) : (a1[3][6] + i4)) >= ((v3 * v3) > (22 && a1[0][6])));
+    }
+    if ((((v0 ? v2 : v3) <= (v1 == 12)) && ((a1[1][11] ? a1[1][11] : a0[12]) != (v0 < v3)))) {
+        v3 = (((v0 % 5) ? (23 != v1) : (6 / 9)) || ((56 >= v0) / 8));
+        v1 = (((v2 % 9) / 9) == ((v1 * a1[2][7]) + (64 <= v3)));
+        a1[3][2] = (((97 + 5) ? (v0 || v3) : (v0 > a0[2])) + ((v3 <= v1) % 8));
+    } else {
+        a1[2][11] = (((a0[11] > a0[4]) < (a1[3][13] * 32)) <= ((v1 == v1) * (25 >= a0[11])));
+        a0[4] = (((v3 * v1) / 6) < ((v3 - v2) != (87 || 30)));
+        a0[1] = (((78 - 34) < (v0 + v1)) != ((v3 != v3) == (82 / 6)));
+    }
+    if ((((v1 % 8) >= (v1 == v0)) && ((16 ? v3 : 78) != (v3 == v0)))) {
+        v3 = (((v3 ? a1[2][8] : a1[0][14]) && (a1[1][6] ? 51 : v0)) % 8);
+        v0 = (((v3 ? v3 : v2) && (v2 < v3)) ? ((v3 == v2) == (a0[13] - v0)) : ((a0[3] ? v2 : a1[3][3]) != (20 > a0[6])));
+        v0 = (((11 || v3) * (a0[12] / 5)) && ((v3 % 4) + (v2 - a0[4])));
+    } else {
+        a1[3][13] = (((v1 ? 87 : v0) ? (v0 != 91) : (19 % 9)) < ((82 != 47) ? (v1 % 9) : (v1 ? v3 : v3)));
+        v1 = (((v1 != 60) + (v3 >= v1)) && ((v1 == 8) * (v3 >= v1)));
+        v2 = (((a0[9] || v2) ? (69 != v1) : (v0 && a0[1])) * ((v3 && 34) >= (v3 + v3)));
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        if ((a1[2][11] == v2) > 59) break;
+        v1 = (((v0 * a0[11]) * (v1 > v3)) || ((26 % 8) % 2));
+        v3 = (((i6 <= 31) ? (54 < v1) : (v1 >= a0[8])) + ((i6 >= v2) != (v3 % 6)));
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                v3 = (((v3 ? v0 : v3) != (a0[7] != i7)) ? ((v2 * 88) == (35 || v0)) : ((a1[1][6] - v0) / 7));
+                a0[10] = (((44 ? v3 : i6) ? (v1 + 65) : (89 != 63)) + ((v0 != a1[3][5]) - (v2 || 38)));
+                a0[5] = (((v2 > 97) % 4) != ((i6 / 7) < (v2 * i6)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        a0[13] = (((a1[2][12] && a1[1][13]) && (v3 - a1[3][3])) == ((22 ? 73 : 30) == (v3 < v1)));
+        a0[10] = (((a0[10] && a0[10]) / 9) >= ((v0 == i8) > (v2 - v3)));
+        for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+            a0[2] = (((a0[10] == 23) ? (v2 * v0) : (a1[1][3] && v2)) >= ((26 >= 5) % 8));
+            v3 = (((76 != a0[14]) == (a0[12] ? v0 : 55)) < ((45 && i8) * (a0[7] || 67)));
+            v1 = (((a0[0] + i9) == (v0 + i8)) == ((i9 || 35) >= (a0[10] && a1[1][11])));
+        }
+    }
+    v0 = (((v0 % 4) ? (82 <= v3) : (v2 ? a0[5] : a0[8])) % 6);
+    return (((v1 == v2) - (v2 <= 6)) != ((a0[3] == v1) && (56 != v0)));
+}
+int f2() {
+    int v0 = 21;
+    int v1 = 76;
+    int v2 = 35;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 > v3) < (a1[0][13] ? 34 : v1)) ? ((v1 || v2) / 1) : ((v1 / 2) == (v3 ? v1 : a1[0][3])))) {
+        v3 = (((v2 != v0) < (16 <= v3)) ? ((a1[3][12] - a1[0][10]) - (a0[10] / 5)) : ((a0[15] ? v2 : 1) <= (v0 - 98)));
+        v0 = (((v3 || a0[1]) - (14 ? 3 : a0[8])) && ((2 && 95) && (v0 && v3)));
+        v3 = (((a1[2][3] < a0[14]) / 4) == ((94 == v0) < (v2 - a0[3])));
+    } else {
+        a0[15] = (((a0[10] - a0[3]) - (v2 == v3)) != ((v1 + v1) != (59 > a0[2])));
+        v3 = (((v1 ? v3 : v2) ? (v3 != v0) : (v2 || 87)) % 3);
+        v1 = (((14 >= 76) || (v3 == 93)) + ((67 < 12) < (v1 && 68)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((v1 < v0) > 81) break;
+            v3 = (((88 <= v0) * (a1[2][7] % 6)) ? ((a1[3][13] < v1) && (54 * a0[12])) : ((26 * a1[2][12]) < (v0 && i0)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v3 = (((25 % 6) / 9) >= ((v3 > v1) + (a1[2][9] != 14)));
+                    v0 = (((v2 != 15) > (40 * 27)) == ((a0[9] >= v3) - (56 > a1[2][5])));
+                    v1 = (((69 == 21) ? (v0 == v0) : (2 || v0)) ? ((1 * a0[12]) <= (0 % 9)) : ((v2 < v0) / 4));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v1 == 53) + (a0[13] - 70)) > ((a1[3][7] + v1) && (a0[14] == 66)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                a0[8] = (((v0 % 9) <= (45 * v1)) / 4);
+                a0[13] = (((i3 * v1) >= (94 >= i3)) || ((v2 ? v2 : v0) != (a0[0] > v2)));
+                v1 = (((a0[9] < v1) > (v2 == v0)) ? ((v3 + i3) / 6) : ((16 % 5) < (i2 + i2)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((a0[2] >= v0) > (3 >= i2)) / 5);
+        v3 = (((v0 != i2) ? (a0[10] + i2) : (41 ? 53 : i2)) - ((v3 ? 69 : a0[9]) == (3 ? v3 : a0[1])));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    if ((v2 && 92) > 53) break;
+                    v2 = (((i5 ? v3 : a0[5]) ? (17 * 61) : (a1[2][7] <= a0[4])) && ((4 < a0[12]) > (v0 >= a0[11])));
+                    a1[2][5] = (((a0[14] % 5) || (v3 || a0[4])) || ((i4 ? v3 : i5) >= (v3 || 13)));
+                    a1[0][6] = (((a0[13] > v1) < (v0 <= i4)) >= ((v0 > v1) < (76 < a0[3])));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v2 = (((v0 >= v2) + (v1 ? v0 : 20)) || ((i4 / 4) <= (a0[1] / 3)));
+            v0 = (((a1[3][4] > i4) > (v0 * v2)) - ((8 <= 67) > (v1 || a1[0][8])));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((a0[15] > a1[2][3]) >= (v0 * v2)) <= ((v3 ? 84 : 43) <= (v0 ? v2 : 18)));
+            a0[4] = (((a0[12] * v3) - (v3 / 8)) + ((21 ? 77 : a0[3]) && (v2 ? a1[2][5] : 16)));
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v3 = (((v3 || v2) * (37 == i6)) / 3);
+                    v3 = (((v0 && a0[14]) * (a0[0] <= v2)) || ((87 <= i6) && (46 ? v1 : v0)));
+                    v2 = (((v3 + 69) / 9) < ((91 % 5) == (v2 > a0[4])));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    {
+        int i8 = 0;
+        do {
+            if ((3 && 41) > 65) break;
+            a0[1] = (((a0[1] >= a0[5]) + (v0 == a1[1][15])) * ((a1[0][12] / 9) - (a1[2][8] > 46)));
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((a0[14] * 31) != (a1[0][9] != v0)) % 7);
+                    v2 = (((v2 / 6) != (a0[9] < a1[3][7])) >= ((i9 >= a0[3]) >= (76 + a1[3][5])));
+                    a0[14] = (((a0[4] ? 41 : a1[0][7]) != (v0 ? i8 : v3)) / 2);
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            a0[13] = (((v2 / 9) ? (v2 % 5) : (a0[11] && i8)) * ((i8 - v2) * (84 < v1)));
+            i8 = i8 + 1;
+        } while (i8 < 4);
+    }
+    for (int i10 = 0; i10 < 6; i10 = i10 + 1) {
+        if ((v3 <= v2) > 60) break;
+        v3 = (((i10 ? v1 : 57) > (99 / 4)) > ((v3 || v2) > (v1 * a0[1])));
+        {
+            int i11 = 0;
+            do {
+                a1[3][12] = (((a1[2][5] ? 69 : a0[0]) + (i10 * v2)) >= ((a1[3][2] < a1[3][12]) <= (v2 / 4)));
+                v2 = (((v0 >= v1) ? (v2 >= a1[3][6]) : (81 || v1)) - ((i11 ? a1[3][14] : 81) > (a0[7] == v3)));
+                v1 = (((a1[3][13] && a0[12]) * (a0[14] * i11)) ? ((i10 - a0[6]) + (37 > a0[6])) : ((i10 * 21) == (v2 % 9)));
+                i11 = i11 + 1;
+            } while (i11 < 6);
+        }
+        v1 = (((11 != i10) / 6) / 8);
+    }
+    {
+        int i12 = 0;
+        do {
+            {
+                int i13 = 0;
+                do {
+                    v0 = (((35 <= 82) != (v3 ? v2 : i13)) == ((a0[3] ? 98 : v3) == (v2 >= v3)));
+                    v1 = (((v2 ? 59 : a0[11]) % 5) / 2);
+                    a1[0][12] = (((v2 != a1[3][8]) >= (i12 && i12)) || ((i13 > v0) == (v3 && v1)));
+                    i13 = i13 + 1;
+                } while (i13 < 7);
+            }
+            v2 = (((0 ? v2 : a0[12]) == (a1[2][7] <= 88)) ? ((a1[3][2] * i12) <= (96 % 8)) : ((v1 * 75) >= (v0 + v1)));
+            v2 = (((v0 % 8) < (34 ? 35 : v3)) || ((v0 || 34) + (v1 ? a1[0][10] : v3)));
+            i12 = i12 + 1;
+        } while (i12 < 8);
+    }
+    if ((((v1 >= a1[2][14]) * (94 > v1)) == ((70 && v1) || (v2 != v2)))) {
+        v1 = (((71 <= v1) >= (v0 || 4)) ? ((v0 * v0) || (a1[0][5] + 5)) : ((v1 - a0[4]) != (68 > 11)));
+        v1 = (((30 >= a1[1][5]) - (34 - v3)) >= ((v3 != v3) ? (v1 && 89) : (a1[3][7] < a0[12])));
+        v1 = (((v0 / 2) >= (18 >= a0[8])) ? ((v3 > v3) && (v3 || v3)) : ((v3 / 8) || (v2 < v3)));
+    } else {
+        v0 = (((v2 / 2) / 8) || ((49 && 32) + (a0[15] ? a0[10] : a0[2])));
+        a1[1][0] = (((95 ? 50 : 71) * (v2 % 7)) > ((v1 && v2) >= (a0[6] * v2)));
+        v0 = (((v2 || v3) > (55 == v0)) % 9);
+    }
+    for (int i14 = 0; i14 < 8; i14 = i14 + 1) {
+        v3 = (((v2 - v0) ? (v3 >= v0) : (a0[4] <= 92)) - ((28 / 3) == (49 <= a0[3])));
+        v2 = (((v0 ? i14 : v0) != (a0[6] != a0[15])) <= ((a1[3][0] == i14) % 1));
+        {
+            int i15 = 0;
+            do {
+                v3 = (((i15 ? i14 : v1) && (a0[0] % 6)) * ((77 / 2) - (45 ? a1[0][14] : v3)));
+                v2 = (((v0 * i14) - (a0[3] + v3)) == ((78 <= v1) ? (75 || v3) : (88 ? a1[1][10] : a1[3][13])));
+                v0 = (((v3 * v2) < (i15 <= 70)) + ((v1 != 8) + (i14 - i15)));
+                i15 = i15 + 1;
+            } while (i15 < 3);
+        }
+    }
+    return (((v1 + 10) / 7) == ((v2 == 0) % 2));
+}
+int f3() {
+    int v0 = 24;
+    int v1 = 54;
+    int v2 = 3;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((57 != v1) > 82) break;
+            v3 = (((a1[1][4] && v1) * (v3 ? 3 : v1)) ? ((v1 || 22) % 1) : ((v2 + 5) ? (v1 >= 5) : (a1[0][9] * v2)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v0 = (((v3 ? i0 : v2) <= (14 ? 59 : v3)) == ((v3 / 4) ? (16 > 9) : (a0[13] % 4)));
+                v2 = (((v3 <= i1) % 2) < ((v1 < v1) + (45 / 5)));
+                a0[11] = (((a1[1][11] ? a1[0][12] : i0) < (57 % 4)) - ((v2 != a0[3]) + (89 % 1)));
+            }
+            v2 = (((v1 + 0) == (v2 % 8)) ? ((v3 ? v2 : v3) || (a0[8] < v2)) : ((v3 == a1[0][14]) < (a0[1] != i0)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v1 = (((v0 ? v3 : a0[3]) >= (v0 ? 79 : 74)) + ((v3 >= 64) <= (a0[6] < a1[3][15])));
+    v2 = (((v3 * a1[0][0]) + (98 % 1)) && ((v3 || v2) / 8));
+    v0 = (((v0 > v3) > (47 + v1)) - ((v3 >= a1[0][11]) <= (v1 > a1[0][6])));
+    {
+        int i2 = 0;
+        do {
+            if ((a0[6] != a0[12]) > 54) break;
+            a0[13] = (((v1 - 85) % 5) < ((95 <= 53) ? (v0 <= a0[4]) : (v3 >= a1[3][11])));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v3 = (((v2 - v0) ? (24 <= i3) : (a0[0] || v2)) && ((v3 - i2) < (v1 - a0[2])));
+                    v1 = (((i3 * v1) < (v1 ? 80 : i3)) && ((v3 >= 6) - (v2 != 93)));
+                    v1 = (((v1 > v3) ? (v1 && v1) : (v0 || v0)) * ((a0[14] - a1[0][2]) >= (10 % 3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((a0[8] >= 3) / 6) || ((i2 >= v0) > (v1 || 37)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        if ((v1 * a0[14]) > 65) break;
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            if ((a0[3] && i4) > 92) break;
+            v0 = (((a0[9] || v1) % 8) || ((v2 != a1[3][15]) <= (a0[2] - v0)));
+            v3 = (((v3 && v0) == (65 / 1)) || ((i4 > v0) != (v1 + i4)));
+            a1[0][6] = (((a1[2][3] * v1) % 3) <= ((v1 < v0) < (9 < i4)));
+        }
+        a0[12] = (((v3 - v2) * (v3 / 3)) && ((v0 % 5) % 2));
+        a0[8] = (((v3 ? v0 : 12) >= (v1 <= v1)) % 1);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            v3 = (((a0[12] && i6) == (v1 != v1)) || ((72 && v2) / 1));
+            v3 = (((v3 - i6) + (38 - v3)) == ((i6 ? a1[1][7] : 61) ? (a0[3] != 7) : (v3 < v1)));
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    a1[2][15] = (((3 * i6) >= (v2 >= v1)) >= ((v2 / 7) * (v1 + i7)));
+                    a0[0] = (((v0 < 18) ? (v3 >= a0[6]) : (a0[8] >= a0[8])) <= ((a1[2][12] || 30) + (69 / 4)));
+                    v2 = (((v1 >= i6) ? (91 && v1) : (v3 <= i6)) ? ((v2 <= v0) != (i7 == 52)) : ((v1 || v1) >= (a0[0] <= v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v2 > v2) - (a1[2][6] < 14)) <= ((v2 ? 54 : v1) * (v3 ? v1 : v3)))) {
+        a0[2] = (((a0[10] / 8) < (v1 - v3)) < ((a0[2] ? v2 : v0) ? (70 < v1) : (v0 != v1)));
+        v3 = (((v2 % 6) * (12 ? v3 : v2)) < ((a0[4] ? v1 : v1) ? (v3 == 95) : (21 == 54)));
+        v1 = (((91 - 40) ? (a0[13] != a0[4]) : (a1[1][13] * a0[7])) != ((10 > 97) ? (83 + 11) : (v0 + a1[1][10])));
+    } else {
+        a1[0][2] = (((v2 - v2) * (v2 || 22)) + ((v2 <= v1) >= (v0 < 96)));
+        a1[2][10] = (((v3 * v0) || (55 == a1[2][10])) || ((v1 ? v3 : a1[0][4]) > (v2 == a0[8])));
+        v2 = (((77 ? v0 : a1[1][1]) <= (v2 > v1)) < ((88 + v3) && (1 >= v3)));
+    }
+    if ((((43 != v0) ? (v0 && 59) : (a0[13] != v0)) ? ((v2 > v1) >= (46 + 84)) : ((36 ? a0[10] : a0[3]) ? (18 || 56) : (a0[6] && a0[1])))) {
+        v0 = (((a1[2][1] + v2) || (v3 || v1)) && ((v1 < 19) ? (61 ? v3 : v0) : (93 == v1)));
+        a0[0] = (((v0 / 9) - (v2 && a1[0][4])) / 3);
+        v3 = (((a1[0][15] % 9) || (34 / 5)) || ((v3 / 8) && (v3 % 4)));
+    } else {
+        v3 = (((v1 || v0) < (v2 && a1[1][11])) > ((v0 < 17) ? (a0[2] ? 21 : v1) : (a0[7] * 21)));
+        a1[1][11] = (((a1[1][11] * v3) / 9) < ((a1[1][8] && v3) ? (v0 ? a0[13] : 40) : (10 && v1)));
+        v3 = (((v1 ? v1 : a1[2][15]) - (v2 > 98)) < ((v2 ? v1 : a1[0][13]) / 8));
+    }
+    if ((((v2 + v1) + (v2 && 21)) == ((a0[13] == a0[7]) ? (53 % 6) : (v3 % 4)))) {
+        a0[6] = (((68 && v0) == (86 + v1)) ? ((v2 == a1[1][8]) > (a0[12] ? 66 : a1[3][1])) : ((v3 >= v3) % 8));
+        v0 = (((v0 || v0) == (a1[3][3] ? v1 : v1)) ? ((a0[11] < v1) ? (v1 <= a1[2][8]) : (v0 * a1[0][14])) : ((v0 < a0[2]) != (v0 - v1)));
+        v2 = (((a1[0][11] && a0[10]) > (v2 && 42)) % 6);
+    } else {
+        a1[2][13] = (((a0[9] <= a0[2]) || (41 && v2)) >= ((a1[0][11] != v2) % 8));
+        v1 = (((45 == v0) > (7 < 80)) % 4);
+        v0 = (((30 != 5) >= (v0 != v2)) / 5);
+    }
+    return (((a1[1][12] ? v2 : v1) == (v2 * 70)) != ((91 == v3) ? (v0 || a0[0]) : (a0[13] >= 60)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,99 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 99;
+    int v2 = 60;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 ? v2 : 21) ? (v1 / 1) : (a0[4] >= v1)) <= ((a1[2][14] % 8) < (a0[3] * v2)));
+    a0[7] = (((v1 < 53) || (a0[7] == v1)) > ((27 ? v2 : v3) < (v0 == v1)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v0 = (((v3 % 9) == (v1 != a0[10])) / 6);
+                    a1[0][5] = (((1 != v3) ? (i1 && v0) : (a0[15] && a0[6])) + ((v3 ? a1[3][8] : v2) ? (a0[13] / 8) : (v2 >= 30)));
+                    a0[15] = (((79 ? i0 : v1) % 6) < ((76 - a0[11]) * (52 ? i1 : i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v0 - a1[2][15]) * (49 ? 63 : v3)) - ((a1[3][5] > a0[11]) > (a0[15] / 4)));
+            v2 = (((v2 <= 55) ? (i0 <= v1) : (41 >= v0)) && ((v2 >= v1) + (i0 ? a1[1][10] : v2)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v1 = (((a1[0][7] || v1) ? (v3 ? 38 : 49) : (a1[3][13] + a0[15])) <= ((v3 < v2) % 6));
+    if ((((75 * 18) > (v0 + v1)) % 2)) {
+        a1[2][7] = (((v2 - 74) ? (v3 == a0[12]) : (7 + 3)) ? ((v0 + v1) < (v3 % 9)) : ((v1 * v0) % 2));
+        v0 = (((v0 > v1) / 5) - ((v3 % 9) * (a0[13] >= 42)));
+        a0[11] = (((v2 < 98) != (v0 + v1)) - ((a1[1][4] >= v2) ? (5 ? a1[3][6] : 52) : (v0 / 5)));
+    } else {
+        v3 = (((v3 ? 77 : a0[13]) ? (v0 * 39) : (v1 || 75)) % 9);
+        v0 = (((a1[2][5] < v1) - (a0[5] == 24)) <= ((93 || v0) || (57 ? v1 : 37)));
+        v3 = (((a0[8] / 2) && (78 / 9)) % 1);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v2 < v0) > 52) break;
+        {
+            int i3 = 0;
+            do {
+                a0[15] = (((v1 / 6) || (v2 * v2)) > ((i3 / 1) || (v2 && 48)));
+                v2 = (((a1[3][6] >= i2) < (i3 * v1)) != ((a1[3][11] / 7) >= (a1[2][3] < a1[2][4])));
+                v1 = (((92 && i3) || (68 || 51)) * ((38 * 74) / 8));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        v3 = (((81 / 7) <= (a1[2][14] >= a1[0][9])) <= ((a0[8] * v2) - (v1 && v1)));
+        v2 = (((v1 * i2) ? (i2 + v1) : (v0 ? i2 : 72)) < ((v2 + v0) % 3));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            if ((a0[9] != a1[1][11]) > 76) break;
+            v0 = (((i4 * 6) && (a0[0] % 1)) + ((59 >= 87) == (v2 || i4)));
+            v3 = (((v1 || 15) % 7) >= ((66 < a1[1][13]) ? (8 * v0) : (v2 - 66)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v0 - 27) || (i4 != v3)) - ((68 > a0[9]) * (20 >= v0)));
+                    v1 = (((61 && a0[9]) && (i4 / 3)) ? ((49 % 5) <= (v2 || 31)) : ((a1[3][1] != a0[6]) == (a0[12] - a0[8])));
+                    a0[7] = (((i4 * 36) > (v0 && 4)) > ((a0[5] % 4) % 4));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((v0 % 9) <= (v1 - a1[0][10])) ? ((0 - a0[7]) != (a0[15] % 1)) : ((v2 >= 31) > (v0 < 17)));
+    if ((((61 == 21) < (a0[0] / 9)) && ((a1[2][13] == a0[0]) / 2))) {
+        v1 = (((a1[1][4] + v3) / 3) / 1);
+        v1 = (((10 >= 65) % 3) == ((v1 <= v2) ? (v2 % 7) : (v3 - v3)));
+        v3 = (((67 - v1) * (a0[6] <= a0[14])) || ((v1 ? a1[3][10] : v3) < (v1 + a0[7])));
+    } else {
+        v0 = (((v0 != v3) == (a0[13] == a1[2][15])) ? ((v0 <= v3) && (21 - 51)) : ((v3 % 2) - (v2 + a0[14])));
+        v3 = (((a1[2][14] / 4) > (v2 || v0)) >= ((v0 == 92) || (v1 * v0)));
+        a0[0] = (((68 <= v0) >= (v3 % 3)) || ((v1 - v3) <= (a1[3][2] >= v2)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((89 * v1) * (v2 ? i6 : v2)) > ((i6 == a0[9]) && (i6 ? v1 : v1)));
+            v1 = (((v2 + 75) - (18 / 5)) ? ((v3 + 94) < (61 || v2)) : ((v3 * i6) % 9));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                if ((43 < i6) > 76) break;
+                v0 = (((v2 ? 55 : v3) != (a1[1][5] <= 24)) != ((27 || v0) != (v1 ? 34 : v3)));
+                v0 = (((72 > v3) <= (a0[15] % 6)) % 7);
+                v0 = (((v3 % 1) < (i7 / 3)) ? ((v0 ? 37 : 56) + (a0[5] < v0)) : ((58 <= a1[1][2]) ? (20 > a0[12]) : (i7 + a1[3][15])));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    return (((a0[13] > a1[2][12]) - (a1[1][12] != 62)) <= ((v1 * a0[5]) / 7));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,227 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 98;
+    int v2 = 72;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((91 - 96) >= (v0 ? v1 : v2)) > ((0 ? 27 : v3) * (v1 > v2)));
+    if ((((v1 || v0) / 9) == ((18 ? a0[11] : a1[3][13]) > (a0[15] * v3)))) {
+        a1[0][7] = (((v0 && v2) / 5) ? ((v3 == v3) == (a1[1][8] && a1[0][7])) : ((v2 * v2) == (75 || a1[0][4])));
+        v1 = (((v1 - v2) >= (a0[13] >= 40)) ? ((v3 * v3) % 4) : ((v0 && v3) == (v3 + 95)));
+        a1[1][3] = (((98 + v3) && (v2 % 9)) * ((94 == v0) <= (7 + v1)));
+    } else {
+        v1 = (((19 * 32) > (v2 / 5)) - ((a0[8] > v0) / 1));
+        a0[2] = (((a1[0][3] * v3) != (42 == v2)) - ((v0 && v3) / 3));
+        v3 = (((a1[1][1] ? 87 : v0) / 1) - ((v3 == v1) > (v2 > 9)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                do {
+                    a1[0][10] = (((v0 || v2) && (i0 || i1)) + ((a0[0] / 9) / 6));
+                    v2 = (((i0 && i1) < (a0[15] % 9)) / 7);
+                    a0[1] = (((7 % 6) <= (v3 + 12)) % 9);
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v3 = (((16 % 7) - (i0 * 82)) - ((46 ? v0 : 43) != (a0[10] / 3)));
+            a1[0][6] = (((v0 > a1[1][11]) - (81 ? v1 : i0)) + ((v1 != 17) && (18 == v1)));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((v0 / 4) < (64 >= v1)) * ((v0 * v1) * (v1 < a1[1][2])));
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v3 && 70) >= (a0[5] <= v1)) / 5);
+            v2 = (((88 < v3) <= (93 || v2)) > ((v1 == i2) % 2));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    if ((55 == i2) > 84) break;
+                    v3 = (((v2 ? i2 : 59) != (v2 % 9)) * ((v0 > v0) ? (v0 || v2) : (5 < v2)));
+                    a0[10] = (((i2 * a1[2][8]) == (i2 % 1)) > ((a1[3][11] ? a1[2][5] : v1) < (v1 == 94)));
+                    v3 = (((4 && a1[2][12]) % 3) < ((a1[0][11] >= 33) * (51 <= i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a0[3] || a0[1]) > 50) break;
+            v2 = (((75 != 14) <= (26 > v2)) + ((i4 > v1) + (v2 % 4)));
+            v1 = (((v1 > v3) ? (i4 <= i4) : (5 - a0[14])) + ((v1 ? a1[2][15] : v3) >= (7 / 5)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                a0[14] = (((a0[8] - 23) ? (v1 != i5) : (66 || 6)) - ((a1[3][1] || 80) ? (95 ? v3 : 73) : (v2 + i5)));
+                v0 = (((87 ? a1[2][0] : a0[3]) - (53 ? a0[7] : 66)) / 4);
+                a0[1] = (((i5 >= v3) == (25 >= v0)) <= ((60 / 8) / 9));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    v3 = (((75 != v2) || (a0[2] < v2)) / 6);
+    v0 = (((a0[0] > v1) % 1) && ((a0[12] != 39) < (a0[2] >= v3)));
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        v3 = (((a0[1] / 7) % 9) == ((a1[3][10] - 89) >= (a1[3][14] <= 50)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                v0 = (((i7 % 1) > (v0 ? 70 : 4)) != ((a0[2] != v1) <= (i7 && v3)));
+                v3 = (((v2 < a0[5]) % 3) == ((a0[10] <= v0) % 9));
+                v1 = (((a0[2] != a0[4]) || (a0[10] * 66)) ? ((v3 == a1[3][0]) <= (23 != 53)) : ((v1 + a1[2][2]) ? (a0[1] - a0[8]) : (i6 || v1)));
+                i7 = i7 + 1;
+            }
+        }
+        a0[10] = (((33 / 9) / 7) > ((v1 % 3) / 6));
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        v2 = (((v0 % 1) > (41 > i8)) ? ((v0 > v2) + (v3 ? v0 : v3)) : ((v0 && v2) / 2));
+        v3 = (((a1[0][3] >= v3) + (v2 ? v2 : a0[5])) == ((v2 ? i8 : a1[0][4]) != (34 > a1[1][6])));
+        {
+            int i9 = 0;
+            do {
+                if ((i8 / 6) > 58) break;
+                v0 = (((v0 >= i8) + (i8 + v0)) - ((70 + v1) % 4));
+                a1[0][12] = (((i8 + v2) == (i9 > v0)) / 4);
+                v2 = (((a0[14] < v0) ? (i9 != v3) : (a1[0][8] == 57)) < ((v3 / 3) < (v0 <= 61)));
+                i9 = i9 + 1;
+            } while (i9 < 8);
+        }
+    }
+    return (((v1 / 4) + (v2 > 64)) >= ((19 * 66) > (v0 < v0)));
+}
+int f1() {
+    int v0 = 80;
+    int v1 = 28;
+    int v2 = 60;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[5] >= 63) + (i0 ? a0[1] : v0)) ? ((19 * v0) || (v3 <= v3)) : ((v2 >= a0[8]) * (v1 > a0[9])));
+            a1[3][13] = (((v3 % 3) != (a0[5] != v1)) || ((a1[1][6] ? a1[2][2] : v0) / 1));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((v0 || i0) % 1) < ((30 + v2) - (21 == 72)));
+                    v3 = (((i0 && a0[3]) <= (a1[1][14] > v1)) && ((v0 >= v0) || (8 % 7)));
+                    v3 = (((a0[14] ? i1 : 77) == (a1[1][10] - v2)) * ((a1[0][13] < a0[14]) ? (v2 <= i0) : (v1 > 20)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            v2 = (((v3 % 1) ? (a0[12] * v0) : (i2 || v0)) < ((v1 / 7) != (v3 == i3)));
+            v3 = (((43 >= v3) > (94 ? 93 : a0[8])) && ((a1[3][9] >= a0[11]) % 7));
+            a1[2][15] = (((v2 || v3) * (v2 <= i3)) ? ((i3 || v1) + (i2 && i2)) : ((v2 * v0) >= (v1 >= 78)));
+        }
+        a1[0][0] = (((v3 * 25) + (1 ? 93 : 35)) >= ((i2 * i2) >= (a0[1] >= v1)));
+        a1[3][1] = (((a0[1] || a0[0]) / 7) || ((v3 > a1[0][12]) > (a1[3][8] * 22)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((i4 % 5) > 89) break;
+            v0 = (((a0[2] - 82) * (50 - v1)) ? ((v1 != v2) == (43 >= v3)) : ((v2 && a1[2][5]) >= (49 <= v1)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                if ((v1 == a0[5]) > 77) break;
+                v0 = (((27 ? v0 : v3) % 5) % 7);
+                v1 = (((i4 / 1) ? (95 == 59) : (48 % 8)) && ((78 + 46) > (72 <= v0)));
+                a1[2][14] = (((42 == a1[3][15]) == (v3 < v0)) && ((a0[13] != 67) <= (76 ? i5 : 90)));
+            }
+            v3 = (((v1 > 17) + (v2 % 4)) > ((v2 % 7) >= (v2 / 6)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    if ((((a1[3][13] ? v3 : a1[3][12]) - (a1[2][14] && v2)) % 4)) {
+        a0[1] = (((v1 && 51) * (97 || v0)) >= ((v3 <= v3) >= (v1 == 91)));
+        v3 = (((a0[9] >= a1[2][5]) != (v3 ? v0 : v3)) > ((34 == 32) <= (v2 - 80)));
+        a1[1][1] = (((a1[1][9] < v3) - (v3 || 68)) * ((a0[9] <= v1) / 5));
+    } else {
+        a1[2][5] = (((84 || v3) >= (v1 == v3)) && ((a1[1][15] + v0) % 4));
+        v0 = (((20 * v2) ? (69 <= a1[2][5]) : (a0[8] ? a1[0][14] : a0[11])) == ((66 || 56) / 4));
+        v0 = (((a1[3][15] && 77) > (a1[2][4] * a1[2][10])) ? ((70 / 7) + (v2 - v2)) : ((55 ? a0[10] : a0[10]) >= (60 >= 32)));
+    }
+    if ((((55 ? v1 : a0[6]) ? (a0[12] * 81) : (a0[5] != a1[1][9])) == ((5 >= a1[1][4]) + (a1[0][8] || a0[1])))) {
+        a0[2] = (((v1 == v3) < (v0 <= 16)) >= ((a0[7] != v2) && (a0[14] + a0[3])));
+        v3 = (((v1 || v1) < (v1 / 3)) >= ((49 > a0[10]) % 5));
+        v0 = (((97 / 7) ? (v3 >= v1) : (v0 <= v1)) - ((v0 * v2) >= (v3 + a0[15])));
+    } else {
+        a1[1][15] = (((v1 * v2) * (15 * a0[7])) ? ((v3 ? v2 : v1) ? (v1 ? v2 : 24) : (v1 * 21)) : ((v0 >= 94) * (a0[8] && a0[1])));
+        v1 = (((a1[1][11] - v2) != (v0 >= a1[3][8])) % 1);
+        v2 = (((a0[6] * a0[2]) >= (a0[15] + a0[1])) ? ((a0[1] && a0[15]) != (55 - v0)) : ((a1[0][12] == a0[12]) != (36 < a0[2])));
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((46 % 7) + (a0[7] == i6)) != ((a0[8] && a1[3][2]) > (37 <= v3)));
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    v0 = (((i6 % 4) >= (v2 ? 83 : 13)) * ((a1[2][6] && i7) == (79 < a1[1][6])));
+                    v3 = (((v3 == 56) ? (v2 + a0[11]) : (v3 >= a1[3][15])) ? ((68 > 45) / 2) : ((v1 > v1) != (14 % 5)));
+                    v0 = (((a0[13] - a0[3]) != (v2 && v1)) - ((a1[1][12] == a1[1][10]) == (i6 - a1[0][14])));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((87 + i6) == (13 || a0[9])) && ((i6 * 20) && (v2 != i6)));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        if ((a0[9] % 5) > 53) break;
+        a0[14] = (((v0 ? 36 : 76) || (v1 ? a1[0][14] : i8)) != ((a1[3][6] ? a1[2][11] : v1) || (v0 / 5)));
+        v1 = (((a0[7] < 22) > (v1 % 1)) + ((86 * 75) > (v0 <= v0)));
+        {
+            int i9 = 0;
+            while (i9 < 6) {
+                a0[10] = (((a1[0][15] < 58) ? (v1 <= 2) : (44 != v2)) < ((6 ? i9 : i8) >= (i8 > i9)));
+                v0 = (((11 ? a0[12] : 31) % 8) < ((47 > a0[12]) <= (i8 / 6)));
+                v2 = (((v2 * a1[3][1]) != (a1[1][5] + v0)) > ((a1[2][13] - a0[2]) ? (a0[5] + v1) : (v2 || i9)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    a1[0][14] = (((v0 && 30) && (v1 == 1)) >= ((60 <= a0[5]) || (86 && a0[4])));
+    if ((((69 && 92) >= (85 % 7)) <= ((60 - v3) <= (v2 != v3)))) {
+        v2 = (((86 ? v0 : 15) == (13 < v1)) != ((47 % 6) >= (a0[7] + 51)));
+        v3 = (((v3 > v0) <= (v1 - a0[2])) > ((v1 == v1) + (v1 * v0)));
+        v2 = (((v0 || 80) < (v1 || 26)) <= ((61 || v1) ? (v3 ? v0 : v1) : (v2 % 9)));
+    } else {
+        v3 = (((v2 >= v0) % 3) && ((v3 == v3) + (a1[2][15] % 6)));
+        v2 = (((v0 <= v2) % 1) < ((a0[12] != v1) * (v2 % 8)));
+        v3 = (((74 % 5) < (11 || v0)) && ((44 * v1) ? (28 * a1[1][0]) : (v3 < v3)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 5) {
+            v0 = (((a1[0][3] == a1[1][11]) > (v3 % 9)) != ((i10 == v2) / 7));
+            for (int i11 = 0; i11 < 8; i11 = i11 + 1) {
+                if ((v0 && v1) > 75) break;
+                v1 = (((i10 * v1) + (v1 || v2)) <= ((i10 != 32) ? (50 != i10) : (i10 + a1[3][7])));
+                v2 = (((i10 < a1[2][14]) <= (i11 <= i10)) >= ((i11 == a1[3][15]) * (v3 % 2)));
+                v1 = (((v1 * v1) - (a0[8] + 21)) == ((a0[14] <= v1) || (5 ? i11 : v1)));
+            }
+            v2 = (((v3 + a1[1][11]) > (v2 <= v2)) > ((a1[1][4] == a0[15]) / 3));
+            i10 = i10 + 1;
+        }
+    }
+    return (((a0[0] > v1) * (a1[0][5] > a0[0])) - ((v3 * a0[2]) >= (v2 * v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
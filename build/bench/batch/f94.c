@@ -0,0 +1,292 @@
+int f0() {
+    int v0 = 10;
+    int v1 = 17;
+    int v2 = 3;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 == 35) <= (v0 - 75)) && ((v2 * v3) < (81 / 6)))) {
+        v3 = (((v0 || v2) / 1) && ((35 + v3) > (v2 / 5)));
+        v1 = (((a1[3][13] && 8) != (v3 || a1[1][4])) && ((a1[0][1] ? v0 : v2) ? (v1 && v0) : (48 >= 87)));
+        a1[1][6] = (((a0[3] - a0[9]) * (v1 != v0)) ? ((v2 * 39) - (v2 || 49)) : ((v0 + a0[15]) <= (v0 > v1)));
+    } else {
+        v3 = (((v3 || v0) == (v3 > 20)) != ((50 > 84) >= (20 + a1[1][14])));
+        v3 = (((v2 / 7) == (v2 || a1[1][14])) >= ((38 / 1) < (v0 ? v0 : v2)));
+        v1 = (((90 == v3) >= (v0 / 9)) / 5);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((v1 / 6) > 78) break;
+                    a1[1][15] = (((i0 * 73) || (v0 < i0)) != ((82 != v0) == (v2 == 9)));
+                    v3 = (((i1 && a1[2][1]) % 1) != ((50 != v3) >= (v0 >= i1)));
+                    v1 = (((a1[3][14] >= 33) >= (0 != a1[2][15])) / 3);
+                    i1 = i1 + 1;
+                }
+            }
+            a0[2] = (((a0[8] >= v1) ? (a1[1][8] == v1) : (i0 && v3)) <= ((v2 * v2) >= (i0 == 1)));
+            v1 = (((v2 + i0) == (11 - i0)) == ((v2 >= v0) && (i0 || a1[1][11])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 == a0[15]) ? (v3 ? v2 : a0[11]) : (v3 - v0)) + ((69 * a1[0][2]) ? (v1 <= 3) : (66 && 87)))) {
+        v2 = (((a0[3] < v0) != (v2 + 46)) + ((v3 % 5) || (21 <= 52)));
+        a1[2][5] = (((a0[0] ? v1 : v3) && (v3 % 6)) < ((79 >= a1[0][10]) > (v1 && 92)));
+        a1[2][3] = (((v3 <= v1) || (v0 > 71)) % 6);
+    } else {
+        v3 = (((a0[14] ? v0 : 1) ? (v3 * v1) : (v0 + a1[0][9])) >= ((v2 && 83) ? (v2 ? a1[0][5] : a1[1][12]) : (79 * 85)));
+        v0 = (((v0 - v2) == (v1 ? v1 : a1[0][7])) / 7);
+        a1[0][14] = (((v1 % 6) % 5) <= ((a1[2][3] && a0[14]) < (v1 ? v1 : a1[2][2])));
+    }
+    if ((((v0 <= v0) < (0 ? a1[1][2] : v0)) == ((78 + v2) / 4))) {
+        v2 = (((v3 || a0[12]) - (38 == 19)) || ((v3 - v2) == (a1[2][2] * v3)));
+        v1 = (((v2 == a1[0][1]) / 4) >= ((v3 / 2) + (14 == a0[5])));
+        v3 = (((v1 >= a1[1][9]) ? (v3 * 93) : (v1 ? v1 : v1)) || ((v3 % 4) % 6));
+    } else {
+        a1[2][3] = (((v3 != v0) * (v1 != 44)) == ((60 >= v1) < (a0[14] >= v2)));
+        v2 = (((v1 ? v2 : v3) ? (a1[0][0] >= a1[1][6]) : (v3 < a0[8])) < ((70 && 68) * (40 ? 83 : v3)));
+        a0[14] = (((58 <= v1) < (20 && a0[3])) < ((v3 ? v3 : a0[8]) % 9));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v3 = (((62 <= v2) || (v1 > i2)) % 2);
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v3 = (((a1[2][14] && a1[2][1]) || (v2 == 15)) >= ((i2 && a1[2][11]) * (i3 <= i2)));
+            v3 = (((v2 > i3) + (74 <= i2)) ? ((28 > a0[3]) ? (a0[6] * a0[12]) : (v2 == a1[1][12])) : ((39 + 83) == (v3 * i2)));
+            v2 = (((69 ? v0 : v2) < (a1[1][2] <= i2)) <= ((57 && v3) - (63 > a1[3][6])));
+        }
+        v1 = (((i2 && 23) || (v2 ? 33 : a0[7])) < ((v2 == 3) ? (v3 != a1[1][9]) : (11 ? a1[2][0] : a1[1][3])));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            a1[1][9] = (((50 ? i5 : i5) || (49 <= v1)) <= ((a0[11] * v0) != (a1[0][7] / 4)));
+            a1[3][13] = (((v2 != i4) - (v0 || a0[15])) - ((a0[4] >= v1) + (v0 ? a1[0][6] : i5)));
+            v2 = (((v3 > v0) + (v3 <= 1)) - ((i5 < a1[0][13]) + (i5 && v0)));
+        }
+        v2 = (((v2 ? a0[11] : v2) + (76 == 6)) * ((38 != a1[3][11]) == (a1[1][14] >= a0[0])));
+        v0 = (((i4 - v2) ? (v2 ? a1[1][14] : v2) : (a0[0] * v3)) >= ((a0[11] >= v2) >= (a1[1][9] && v3)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            if ((17 ? v3 : v3) > 72) break;
+            v3 = (((v3 ? 18 : a0[4]) || (93 != i6)) || ((i6 ? v1 : v0) > (v0 ? a1[1][1] : a0[3])));
+            v2 = (((i6 / 6) || (v3 && 77)) - ((60 / 7) * (v1 != a1[1][6])));
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((78 / 7) == (v2 >= 51)) + ((v1 > a1[3][13]) - (18 > a1[2][0])));
+                    a1[3][7] = (((i7 != v3) != (v2 || a1[0][12])) || ((a0[4] % 1) || (a1[3][8] + a0[11])));
+                    v3 = (((i6 ? v0 : a1[2][12]) ? (35 ? i7 : v1) : (a1[1][6] < v2)) || ((v2 + 0) != (i7 % 1)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v3 = (((v1 * v3) ? (a0[14] * v1) : (v0 % 6)) < ((v2 != v0) ? (35 / 2) : (v0 % 8)));
+    v3 = (((58 <= v3) > (14 != a0[5])) != ((12 / 1) ? (a1[1][2] + 16) : (a1[3][9] > v0)));
+    if ((((1 ? a0[1] : v2) && (a0[0] ? 54 : v0)) - ((a0[13] / 2) > (20 * a0[2])))) {
+        v0 = (((21 == 6) > (v3 >= a1[2][0])) + ((14 != v2) > (v2 * a0[6])));
+        v2 = (((v3 >= 23) > (v0 || v2)) >= ((v3 ? v3 : v1) % 6));
+        v0 = (((55 || a0[14]) >= (a1[1][14] ? v0 : v1)) ? ((v0 > v3) == (v0 != 0)) : ((v2 || 59) ? (v0 / 7) : (a0[6] < a1[3][11])));
+    } else {
+        a1[0][3] = (((v0 + 92) >= (v0 * v2)) % 4);
+        a1[0][0] = (((a0[1] && v2) || (v2 ? v2 : 5)) ? ((v0 > v0) % 7) : ((v0 || v0) == (4 % 2)));
+        v1 = (((22 <= a1[2][10]) || (v2 ? a0[12] : v2)) != ((v0 - a0[1]) * (a0[5] - v0)));
+    }
+    return (((a0[3] ? 12 : 54) * (66 ? v2 : a0[8])) % 3);
+}
+int f1() {
+    int v0 = 30;
+    int v1 = 72;
+    int v2 = 70;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v3 = (((a0[9] < a0[12]) < (v1 < i0)) || ((11 || v1) == (v2 <= v3)));
+            v1 = (((25 != v0) <= (a1[0][11] ? a1[0][10] : v3)) % 1);
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v0 || 92) == (i0 % 2)) ? ((i1 ? v1 : a0[4]) || (a0[7] < v1)) : ((i1 > i0) - (18 - 14)));
+                    v2 = (((i1 >= a1[2][7]) < (14 || a0[6])) + ((v3 > a1[0][6]) + (i1 < 82)));
+                    v2 = (((v1 ? 2 : a0[9]) && (a1[3][0] < 79)) <= ((a0[12] / 8) * (a0[12] && 27)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((93 > v0) && (a1[3][15] <= 50)) > ((1 > a0[12]) - (v1 - v2)));
+    if ((((97 * 67) > (38 || v1)) / 6)) {
+        v0 = (((v2 / 5) == (82 > a0[15])) % 4);
+        v3 = (((54 * 92) && (v0 * v0)) == ((v3 || a0[5]) <= (v3 != v1)));
+        v0 = (((v1 < v1) || (94 >= a0[9])) <= ((a1[3][2] ? a1[2][7] : v3) || (v1 - v2)));
+    } else {
+        v2 = (((v0 + 81) / 9) * ((v1 ? 59 : 79) % 3));
+        v1 = (((a0[4] - a1[3][15]) % 4) < ((v3 ? v3 : a1[2][8]) && (1 || v3)));
+        v3 = (((v3 || v1) || (v1 + 65)) >= ((a0[9] / 7) % 3));
+    }
+    if ((((v0 * v2) ? (v0 ? 99 : v1) : (29 == v3)) > ((55 && v1) < (a1[2][11] <= a1[2][10])))) {
+        v1 = (((v1 ? v0 : v0) * (82 == 0)) != ((v3 % 6) ? (79 / 4) : (v3 + 67)));
+        v0 = (((v0 && v0) + (82 != 7)) && ((v2 == a0[15]) > (v2 && 76)));
+        v2 = (((a1[1][3] < v3) > (v1 >= v1)) % 8);
+    } else {
+        v3 = (((v2 != a1[3][14]) == (74 * v0)) ? ((v2 <= v1) >= (v3 < v2)) : ((v2 * v0) == (v2 < v2)));
+        v0 = (((v0 == v3) > (v2 && v1)) / 1);
+        v3 = (((a1[3][5] ? v0 : v0) ? (a1[3][15] % 3) : (v1 * v3)) ? ((v3 != 72) * (v1 * 77)) : ((89 >= v1) <= (v3 <= v1)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            if ((i2 >= v2) > 59) break;
+            v0 = (((i2 / 8) && (i3 % 6)) == ((a0[4] == 11) / 7));
+            a1[0][5] = (((a0[13] == 89) <= (a1[3][13] && a1[1][3])) % 9);
+            v2 = (((v0 < v3) >= (2 ? a0[2] : 50)) > ((v3 % 4) >= (v0 && v0)));
+        }
+        v2 = (((i2 * v2) >= (a0[9] < i2)) ? ((a1[0][12] > a0[4]) || (a0[3] - v2)) : ((v1 != i2) == (i2 && i2)));
+        v1 = (((a0[9] * v0) <= (69 <= v0)) != ((i2 < a0[9]) && (i2 && 13)));
+    }
+    v3 = (((a0[7] - v2) > (v2 % 9)) == ((a0[5] == v0) - (a1[0][2] == v0)));
+    v0 = (((a0[3] * v0) >= (98 > a0[5])) + ((a1[1][0] == a1[3][5]) < (v3 % 2)));
+    if ((((6 >= 7) ? (v0 % 7) : (v2 < v3)) > ((87 * 29) - (94 - v3)))) {
+        v2 = (((v1 < 8) == (v1 && v3)) - ((62 >= v1) * (a0[7] ? v3 : v1)));
+        a1[2][0] = (((49 ? a1[1][2] : a0[9]) >= (v2 * v0)) == ((a1[3][2] || a0[13]) % 7));
+        v1 = (((v1 / 7) >= (a0[2] || v3)) * ((13 >= a0[4]) + (a0[4] <= v0)));
+    } else {
+        a1[2][11] = (((a0[7] * 5) ? (77 == v3) : (46 && v2)) > ((v0 || a0[0]) / 3));
+        v0 = (((37 <= v2) / 5) ? ((1 == 92) % 4) : ((v0 ? v2 : 30) / 1));
+        v3 = (((a1[0][0] != v2) ? (a0[3] > v3) : (v1 - 93)) ? ((a1[1][13] > 56) && (a1[3][13] + a0[0])) : ((30 != a1[3][9]) >= (v2 <= v2)));
+    }
+    v2 = (((v1 > a0[14]) < (v0 ? v0 : 79)) / 3);
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v2 / 2) * (39 + a0[4])) != ((v2 != i5) * (v2 && 98)));
+                    v0 = (((i5 && a0[1]) * (v2 > v3)) || ((v1 && a1[0][15]) >= (v2 / 1)));
+                    v1 = (((i5 || 57) == (v3 % 8)) - ((a0[3] == v1) != (v3 > i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            a0[9] = (((37 <= a1[2][13]) >= (v2 && a1[2][0])) < ((v1 % 2) - (v3 % 9)));
+            v1 = (((v1 - 5) / 9) / 5);
+            i4 = i4 + 1;
+        }
+    }
+    return (((47 >= a1[3][15]) + (v0 < 2)) ? ((39 ? v1 : v2) && (54 % 2)) : ((49 ? 82 : v0) % 6));
+}
+int f2() {
+    int v0 = 67;
+    int v1 = 0;
+    int v2 = 91;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v2 = (((82 + 94) ? (i0 % 4) : (v3 < 83)) < ((v2 || v0) || (i0 ? a1[0][15] : i0)));
+            v0 = (((a1[2][4] != 35) != (v0 * v2)) ? ((v1 && 22) <= (v1 || i0)) : ((a1[0][2] || i0) <= (v3 / 6)));
+            {
+                int i1 = 0;
+                do {
+                    a1[0][14] = (((11 * v1) > (46 - a1[0][4])) <= ((v2 && v2) > (v0 >= 9)));
+                    v3 = (((v2 ? v2 : 32) * (i1 ? 46 : 43)) || ((a0[8] + v3) && (a1[2][13] - i0)));
+                    v0 = (((72 || a1[0][13]) == (a1[3][10] + 34)) - ((i1 <= v1) != (i0 && v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 - a0[9]) ? (50 > a0[15]) : (a0[11] != v0)) == ((v3 < v3) ? (v2 == v0) : (v3 * v0)))) {
+        a0[3] = (((v3 != v0) < (v2 / 1)) == ((61 || v3) ? (v2 - v0) : (v0 - a1[0][11])));
+        v2 = (((a1[0][11] > 37) <= (16 && v2)) && ((v2 == 22) >= (v1 ? a1[1][0] : v0)));
+        v2 = (((a1[0][6] && v1) % 9) == ((v0 <= v0) > (a0[3] == v2)));
+    } else {
+        v1 = (((v1 % 8) + (a1[3][1] ? v0 : 76)) % 5);
+        a0[0] = (((a0[8] * v0) / 9) + ((v0 ? v0 : a1[3][13]) >= (v1 > 70)));
+        v3 = (((a1[2][14] != v0) <= (a0[2] ? 91 : a0[4])) < ((v0 == 34) != (a1[0][11] - 29)));
+    }
+    if ((((v2 || 44) % 9) && ((v3 ? v2 : 81) == (v1 == a1[0][2])))) {
+        v2 = (((v0 != 75) < (v2 - v0)) != ((a0[11] != a1[2][10]) && (v1 ? v2 : v1)));
+        v1 = (((v3 + v3) || (a1[0][5] && 18)) * ((a0[10] && a1[0][0]) - (23 ? 65 : 62)));
+        a1[1][1] = (((v1 != 30) ? (86 * a1[3][3]) : (a1[0][11] || a1[0][13])) + ((v2 > a1[0][6]) * (v2 + v2)));
+    } else {
+        v3 = (((a1[1][7] != v2) && (36 ? a0[10] : v1)) != ((v3 + 4) ? (v2 ? v2 : a0[7]) : (a1[3][2] - 64)));
+        a1[3][12] = (((v3 && a0[8]) ? (a0[13] || 95) : (a1[2][14] != v1)) * ((v1 || 82) ? (v2 || v2) : (14 && v3)));
+        v3 = (((v1 / 1) >= (v2 - v2)) * ((38 >= v3) != (v0 && v2)));
+    }
+    if ((((v0 - 37) > (v2 ? v2 : a0[12])) / 5)) {
+        a1[1][3] = (((a1[0][4] % 6) && (a1[1][1] > v0)) || ((v0 - v3) ? (v3 % 3) : (v1 ? v1 : v2)));
+        a1[1][7] = (((v3 == 1) || (a0[9] ? 77 : v1)) >= ((a1[0][4] >= v1) % 2));
+        v2 = (((57 && v3) * (15 > 17)) < ((v2 ? v2 : v2) + (v1 % 5)));
+    } else {
+        v3 = (((a1[1][2] % 1) < (v3 < v0)) / 4);
+        a0[0] = (((88 <= 66) < (a1[3][1] && v3)) > ((v3 % 3) || (v2 >= a1[3][4])));
+        a1[3][3] = (((v1 ? 91 : v0) == (v2 == a1[3][2])) * ((v1 ? v3 : a0[3]) ? (a1[3][10] + v0) : (78 / 6)));
+    }
+    if ((((v0 % 4) / 7) < ((63 + 97) - (v1 && 64)))) {
+        a1[1][8] = (((v0 && 88) <= (v0 * v2)) >= ((v2 - a0[9]) >= (v3 ? a1[3][10] : v1)));
+        a1[2][5] = (((v0 != 6) ? (v2 ? v3 : a1[0][14]) : (a0[2] ? v2 : v2)) != ((v3 % 6) * (v1 > a1[0][6])));
+        v1 = (((v0 <= v0) || (a1[2][9] - a1[3][15])) * ((a0[10] != a0[5]) >= (v2 <= 20)));
+    } else {
+        a0[6] = (((v3 < v2) < (a0[12] + v1)) / 9);
+        v2 = (((a1[2][6] / 3) + (1 == v0)) ? ((v3 + v1) - (v1 < 50)) : ((v3 || v0) % 7));
+        v0 = (((v3 ? a0[1] : v3) + (55 + v1)) / 7);
+    }
+    v3 = (((64 == v1) != (v3 % 9)) * ((a0[13] ? 38 : v0) > (v3 == a0[11])));
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v3 ? a1[2][0] : v0) + (v3 / 2)) + ((v1 / 6) - (v1 + i2)));
+            {
+                int i3 = 0;
+                do {
+                    if ((v2 && a1[2][6]) > 97) break;
+                    v3 = (((a1[3][11] ? 43 : v3) < (v0 < 81)) != ((66 + v0) <= (v0 || a1[3][0])));
+                    v2 = (((v2 && a0[15]) <= (55 - a0[0])) ? ((i3 > v2) != (53 % 7)) : ((a1[0][6] + i3) <= (i2 - 7)));
+                    v1 = (((a1[0][6] ? i3 : a0[14]) <= (i3 <= v2)) - ((31 < 55) ? (i3 >= v1) : (i3 != 41)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a0[7] = (((a1[2][5] ? a1[0][0] : v1) == (82 < i2)) >= ((v3 != i2) / 8));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v1 = (((v3 >= v1) / 9) < ((v3 <= v1) || (91 < v2)));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((i5 || 89) <= (9 - i5)) >= ((53 ? a1[1][12] : i4) ? (a1[3][10] != i5) : (i5 > 88)));
+                    a1[1][14] = (((a1[1][12] != a0[14]) <= (i5 < i4)) > ((v1 + a1[3][0]) > (i5 > a0[12])));
+                    v0 = (((a0[8] == 50) < (20 && v0)) + ((a1[3][11] < a1[1][9]) && (i5 * a0[0])));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            a1[1][11] = (((v0 == a0[6]) / 6) + ((v1 * a1[2][3]) && (i4 - 17)));
+            v1 = (((v2 == v0) % 6) - ((a1[2][8] ? v3 : 16) - (v3 != v0)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    v0 = (((a0[14] ? 51 : v1) <= (v3 < 39)) ? ((v0 + v3) ? (a0[7] < v0) : (a0[10] > v1)) : ((65 / 1) || (82 < v2)));
+    return (((v3 && v1) ? (v0 * a0[14]) : (a1[3][9] + v1)) == ((v2 ? v3 : a1[3][3]) >= (a0[9] * a0[7])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,377 @@
+int f0() {
+    int v0 = 72;
+    int v1 = 42;
+    int v2 = 18;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a0[2] <= 8) || (a0[3] - a1[3][1])) % 7);
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((4 && 13) > 51) break;
+                v3 = (((i0 || v0) <= (a0[4] == v1)) + ((i0 + v1) && (19 + v3)));
+                a0[11] = (((a0[7] >= v3) ? (a1[1][8] ? a0[15] : v3) : (49 - v3)) >= ((a1[1][4] / 8) % 8));
+                v0 = (((59 > 17) + (59 >= 53)) / 3);
+            }
+            v1 = (((v3 / 8) ? (1 / 7) : (a0[6] && 23)) - ((v3 > a1[1][5]) * (i0 ? v0 : 8)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v0 = (((v3 != a0[9]) < (a0[0] != 51)) % 2);
+    v0 = (((v1 + a0[14]) - (a1[2][5] - 51)) * ((24 ? 37 : v0) ? (v2 < 25) : (29 || a0[8])));
+    a0[14] = (((v2 - 27) ? (a0[13] % 4) : (v2 == a0[7])) != ((11 ? a1[2][13] : a0[8]) != (a1[0][4] && a1[0][9])));
+    v0 = (((v0 <= a1[1][0]) - (v1 > v0)) && ((v0 > v2) ? (v3 != a0[8]) : (88 - 49)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((74 * v0) > 89) break;
+        v1 = (((v1 <= v3) >= (a1[3][11] / 9)) - ((a1[1][5] % 6) <= (v2 && v2)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((59 && v3) <= (v0 == v2)) * ((i2 - a0[10]) > (i3 + a1[2][11])));
+                a0[3] = (((34 < 48) / 1) / 1);
+                a1[2][14] = (((77 >= 37) == (a1[0][6] % 6)) * ((58 <= i3) / 6));
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+        a1[3][15] = (((v1 || v1) == (v2 ? a0[4] : 44)) * ((i2 == i2) || (v2 ? a1[0][9] : a0[15])));
+    }
+    v2 = (((v2 + v2) <= (v0 && a0[0])) > ((a1[1][3] ? a1[1][6] : a0[5]) - (30 ? v1 : 87)));
+    v0 = (((v3 % 4) % 2) && ((v0 ? a1[2][5] : a0[9]) * (a0[7] || v1)));
+    if ((((v2 % 1) + (39 ? a1[2][9] : 57)) == ((v2 ? a1[1][6] : v3) > (v3 < v1)))) {
+        v3 = (((a1[2][6] == v0) != (65 < a1[3][13])) == ((39 * v0) % 9));
+        a0[0] = (((v2 / 1) % 3) && ((25 <= v1) >= (54 > a1[3][11])));
+        a0[4] = (((a0[8] || a0[7]) || (v0 * 15)) % 8);
+    } else {
+        v1 = (((v3 ? v1 : a1[3][3]) && (a0[1] || v2)) * ((26 - a1[0][2]) ? (v1 || a0[12]) : (a0[4] < 39)));
+        v2 = (((v2 ? a1[3][9] : 16) && (v0 == 74)) != ((a0[9] < v0) < (a0[4] || a0[9])));
+        v1 = (((v0 != 54) > (v1 == v1)) || ((a1[3][10] > v2) ? (v1 < a1[3][0]) : (v0 == 99)));
+    }
+    v1 = (((a0[14] < 58) + (10 <= v2)) || ((v0 - v0) * (a0[1] || v0)));
+    return (((v2 < v0) > (a0[11] * 43)) == ((a0[4] || v3) != (v1 < a0[14])));
+}
+int f1() {
+    int v0 = 96;
+    int v1 = 12;
+    int v2 = 1;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 == v0) < (v3 > 46)) % 4)) {
+        v2 = (((8 < v2) - (94 >= a0[5])) && ((a0[12] % 2) ? (v2 + 31) : (71 != v1)));
+        v0 = (((v3 % 9) + (3 && 28)) && ((v1 > v0) + (v0 >= a1[1][1])));
+        v0 = (((a0[13] ? v3 : a0[9]) == (v3 ? v2 : v1)) / 3);
+    } else {
+        v1 = (((a1[2][11] == 92) % 8) == ((v1 >= v3) < (16 + v3)));
+        a1[0][1] = (((95 + v2) ? (50 < v2) : (29 ? v3 : a0[12])) ? ((42 && a0[9]) >= (a1[2][3] % 6)) : ((v3 <= a1[3][13]) <= (v1 == a1[1][9])));
+        v1 = (((v0 < v2) == (v1 <= v0)) % 7);
+    }
+    a1[0][3] = (((a1[1][14] > v0) * (a0[4] + v2)) > ((a0[2] || a0[15]) ? (v2 * v3) : (a0[7] && v1)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        a1[3][0] = (((a1[3][1] % 9) / 2) < ((a0[15] || v1) ? (a0[10] ? v1 : 32) : (i0 - a1[2][8])));
+        a1[0][11] = (((v1 == a1[0][11]) && (i0 - v0)) >= ((i0 != i0) || (v2 && v2)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v0 = (((v2 || i1) + (v2 == 48)) > ((v2 >= v0) + (a1[2][10] ? i0 : v0)));
+            a1[0][14] = (((v3 >= i1) != (i1 ? i1 : i1)) < ((12 || 93) && (v3 ? a1[0][4] : a0[4])));
+            v3 = (((a0[10] * 34) == (a1[3][0] % 4)) || ((v2 >= v3) != (53 >= 67)));
+        }
+    }
+    if ((((a0[10] % 6) > (v2 < a0[5])) > ((v3 == a0[1]) >= (a0[11] || v3)))) {
+        a1[1][15] = (((a1[0][10] / 2) < (a1[0][5] <= 51)) > ((a0[6] < 66) - (v2 ? 77 : v0)));
+        a0[3] = (((a0[6] % 1) + (a0[12] < v0)) < ((11 % 3) ? (a1[3][5] < 11) : (21 != v2)));
+        v2 = (((a0[1] - 54) != (v3 ? a0[13] : a0[14])) ? ((a0[9] ? v2 : 63) < (69 <= v2)) : ((a0[1] || a1[1][6]) > (v0 % 4)));
+    } else {
+        a1[1][4] = (((39 * a1[1][13]) && (a0[1] ? 86 : v2)) / 9);
+        a1[0][13] = (((v2 - v2) - (v2 >= 18)) > ((v0 * a1[2][11]) > (v2 ? a0[4] : v2)));
+        v0 = (((37 < 48) - (0 ? v1 : v1)) != ((a0[10] ? v3 : a0[5]) || (v1 * v2)));
+    }
+    v0 = (((v2 / 8) && (v3 % 4)) <= ((a1[2][13] == 91) / 9));
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((i2 * a1[1][14]) > 82) break;
+            a0[9] = (((97 - v3) ? (v3 <= a0[15]) : (v2 > i2)) > ((v3 == 37) < (v1 <= 96)));
+            v1 = (((v3 + v0) || (v0 ? i2 : v1)) ? ((0 && 73) + (66 != a1[2][9])) : ((v0 && a0[15]) - (v3 ? i2 : v3)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a0[13] >= a0[9]) * (a1[1][13] <= 26)) % 7);
+                    v2 = (((i2 < v1) > (i3 > a0[13])) + ((v0 + i2) < (v2 > v1)));
+                    v3 = (((29 < a0[14]) * (v2 < v1)) ? ((a1[2][7] || a0[5]) > (i3 - i2)) : ((57 - v1) % 6));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[13] <= 12) || (a1[3][14] ? v1 : 79)) + ((a1[3][8] * 56) != (a1[3][4] <= a0[9])))) {
+        a1[3][15] = (((a1[2][10] != v0) > (v3 + a1[2][9])) > ((v1 > v0) < (a1[2][6] < v1)));
+        v0 = (((89 - 55) || (v0 <= a1[1][12])) == ((v2 || a1[3][5]) / 9));
+        a0[5] = (((v2 != v1) % 1) == ((v3 && a1[3][8]) == (a0[14] * a1[2][11])));
+    } else {
+        a1[0][9] = (((a0[11] < v1) ? (66 == v0) : (a0[0] % 6)) - ((v2 && 90) >= (v2 > v3)));
+        v3 = (((98 < v0) + (55 > a1[3][4])) - ((v1 || 35) <= (v3 % 9)));
+        v3 = (((v0 || 29) + (v2 - 28)) < ((79 >= a0[15]) > (a1[1][5] ? a0[8] : v1)));
+    }
+    v2 = (((v2 && 73) % 2) - ((a1[2][11] - a1[3][13]) || (78 + a1[0][5])));
+    if ((((v3 + v2) / 7) * ((64 || a0[11]) >= (6 && a0[7])))) {
+        a0[5] = (((v1 == 21) ? (a1[2][3] <= v0) : (97 / 3)) ? ((v0 > 76) <= (a0[11] + v2)) : ((a0[2] < 71) >= (a1[0][3] * v3)));
+        v2 = (((v1 ? a0[6] : v0) <= (66 + a0[10])) > ((v3 * v2) - (19 % 5)));
+        v3 = (((v0 < v1) % 7) + ((v2 < a1[0][8]) || (68 ? a1[3][12] : a0[0])));
+    } else {
+        a0[5] = (((v1 != v2) + (a1[3][9] < v2)) % 1);
+        v1 = (((48 % 5) || (46 - a1[2][1])) < ((v3 % 2) - (a0[8] >= a1[0][1])));
+        a0[10] = (((v2 < 0) != (a0[13] ? 7 : v2)) == ((v1 > v0) / 6));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((v2 == v1) > 99) break;
+            a0[12] = (((v2 != v2) || (23 >= a1[2][15])) > ((72 % 7) * (91 != v2)));
+            {
+                int i5 = 0;
+                do {
+                    if ((38 / 5) > 50) break;
+                    a1[2][12] = (((a0[1] == v0) - (69 ? v3 : 37)) == ((i4 != a1[1][6]) / 7));
+                    v2 = (((v2 || v1) + (a0[3] * 58)) < ((i5 + v0) == (v2 / 1)));
+                    v1 = (((i5 <= 42) <= (v1 <= 65)) == ((67 || 1) / 1));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v3 = (((i4 >= v0) ? (98 > v1) : (v1 % 4)) / 4);
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[7] / 4) / 7) < ((a0[12] >= 49) && (a0[6] / 1)));
+}
+int f2() {
+    int v0 = 3;
+    int v1 = 98;
+    int v2 = 94;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a1[0][3] <= v1) * (86 || i1)) ? ((v0 % 1) ? (v0 ? 12 : v0) : (i0 * a0[15])) : ((v3 >= i0) - (a0[4] != 90)));
+                    v3 = (((a1[3][14] == v2) + (a1[3][13] - a0[8])) <= ((a1[0][10] * v1) <= (v2 - 18)));
+                    a0[15] = (((a1[0][7] % 5) ? (a1[3][4] / 9) : (87 % 7)) - ((v3 % 7) < (i0 % 6)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v1 = (((a1[0][2] + 94) / 1) / 8);
+            v2 = (((v0 || v0) == (26 == 55)) + ((i0 + v1) * (71 - a1[2][7])));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((a0[8] % 1) >= (v0 <= a0[10])) > ((v3 || 60) && (18 / 7)));
+    v0 = (((41 == a1[2][7]) || (v2 || a1[2][8])) % 3);
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    if ((i3 || 25) > 77) break;
+                    v3 = (((a0[14] ? v1 : v0) > (a1[2][7] != i2)) / 2);
+                    v2 = (((v1 / 9) < (23 * 2)) - ((v0 / 1) >= (v3 <= 6)));
+                    a1[2][3] = (((a1[1][13] + a0[4]) < (a1[3][2] - v1)) / 2);
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((59 > a0[9]) != (v0 == v2)) / 1);
+            v0 = (((v1 > v2) <= (60 > v0)) != ((a1[0][3] / 3) % 2));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((v3 / 6) && (91 - a0[2])) != ((65 < 94) % 1));
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            if ((a0[5] == v0) > 56) break;
+            a1[1][9] = (((v3 && v3) && (v0 >= a1[1][6])) >= ((v1 == v3) + (a1[2][1] + 89)));
+            v0 = (((i4 ? v0 : 61) && (v0 * 67)) % 4);
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                a0[15] = (((v2 + 99) ? (i4 == 93) : (94 && a1[3][0])) < ((58 / 1) ? (v0 / 9) : (v2 - v3)));
+                v0 = (((v3 != 2) < (a0[4] - v3)) || ((v0 < a1[3][6]) ? (i5 == v2) : (v2 / 7)));
+                a1[3][8] = (((91 < a0[13]) / 4) + ((v0 >= a0[11]) / 5));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((69 && a1[3][9]) > (65 != v2)) ? ((a1[2][12] <= 12) || (83 <= v0)) : ((v0 || v2) % 3));
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            a1[1][6] = (((v1 * 82) + (v0 >= a0[7])) % 7);
+            a1[1][3] = (((v1 < v2) == (v2 < i6)) == ((i6 == v2) ? (v0 != v1) : (v0 % 2)));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v2 = (((i6 % 5) <= (47 % 1)) * ((a1[3][9] || v1) != (v0 + 14)));
+                v3 = (((v3 > v2) != (i6 - 51)) / 2);
+                v1 = (((a0[13] * a1[2][8]) == (83 * a0[14])) % 3);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((60 % 9) % 1) < ((a1[1][15] > v3) && (5 < v1)))) {
+        v2 = (((a1[2][7] != v1) != (v1 && 40)) == ((v2 != v2) % 2));
+        v3 = (((v1 - v3) == (v0 > 14)) ? ((v0 + v2) <= (39 >= 52)) : ((v1 <= 50) || (80 || 97)));
+        v3 = (((97 % 6) >= (73 + v0)) == ((v1 * v0) <= (v1 <= a0[2])));
+    } else {
+        v0 = (((v0 != 65) <= (18 <= v2)) != ((a0[11] ? v2 : v2) + (11 >= v3)));
+        v0 = (((80 <= 53) >= (v0 && 23)) >= ((v3 * v2) || (a1[1][5] >= 57)));
+        v2 = (((v3 >= a0[5]) && (45 ? a1[3][2] : 24)) < ((v3 < 46) >= (v1 ? v2 : 14)));
+    }
+    if ((((v2 * v1) == (a1[3][8] - v3)) % 9)) {
+        v0 = (((a0[12] != v2) / 7) < ((a0[2] - v0) % 4));
+        v3 = (((v1 * v2) ? (v3 * a1[2][2]) : (v0 % 4)) % 3);
+        a1[0][13] = (((v2 || v1) + (v1 <= a0[4])) % 9);
+    } else {
+        a0[14] = (((v1 == 70) * (87 * v2)) % 2);
+        a0[4] = (((v2 + v1) < (v3 % 1)) ? ((a0[7] == 17) + (3 < a1[1][1])) : ((a0[8] || 42) / 4));
+        a1[3][0] = (((v2 > v1) < (a0[11] < a0[4])) / 4);
+    }
+    return (((a1[2][6] + a1[1][10]) ? (a0[0] % 9) : (v1 < a1[0][3])) != ((a1[2][6] + 37) - (a0[2] ? a0[5] : a1[2][4])));
+}
+int f3() {
+    int v0 = 65;
+    int v1 = 16;
+    int v2 = 97;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v1 = (((v2 + i0) > (89 && a0[6])) < ((v1 - 48) % 5));
+            v0 = (((v2 < i1) ? (v0 + 92) : (v0 || 72)) == ((a0[7] - i1) != (a0[12] && 16)));
+            v0 = (((i1 ? i1 : a1[1][3]) - (60 || a0[4])) % 6);
+        }
+        a1[3][7] = (((v1 >= v1) != (v0 - v2)) > ((i0 - i0) - (a0[11] - a0[15])));
+        v0 = (((a1[2][8] > v0) + (v2 / 5)) == ((a1[1][9] ? v0 : v0) ? (v1 >= i0) : (10 || v3)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v1 = (((a0[11] - v2) % 8) / 1);
+        v0 = (((v0 * 40) % 3) == ((a0[0] > a1[2][4]) > (v0 != a0[4])));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((a0[9] != v3) < (i3 < a1[3][1])) - ((88 && 12) && (35 / 7)));
+                a1[1][5] = (((a1[0][14] + i2) || (v1 - i3)) % 9);
+                a1[0][0] = (((a1[2][1] % 7) == (v0 % 3)) ? ((25 - a1[1][3]) >= (i2 / 6)) : ((v0 <= a0[10]) && (v3 < a0[1])));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    if ((((57 - a0[12]) % 9) < ((a1[2][1] * 82) * (v1 != a0[13])))) {
+        v2 = (((36 && v1) % 9) >= ((48 + 71) != (52 && v2)));
+        v3 = (((v1 != 22) && (v1 < v3)) * ((a0[0] == a1[3][11]) - (29 >= v1)));
+        v3 = (((a1[0][9] <= v0) > (v1 * 99)) * ((v1 < v2) > (v3 >= v0)));
+    } else {
+        a0[7] = (((v3 != a1[1][4]) % 8) < ((v0 && v2) ? (79 || 93) : (v2 % 9)));
+        a0[7] = (((v3 ? v0 : v0) - (76 ? v1 : a0[13])) * ((70 * v2) / 9));
+        a1[1][4] = (((v1 - v1) <= (v2 == a0[8])) && ((v1 % 3) == (v3 % 4)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[5] = (((84 == v3) != (v2 + v0)) >= ((v0 + a0[15]) <= (a0[9] % 6)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((a1[0][5] / 2) == (v3 > v0)) < ((a1[3][6] < v0) < (v1 || a0[11])));
+                    a0[10] = (((a0[10] == 31) && (a0[3] > 66)) + ((18 + 37) ? (v3 - 5) : (57 && v0)));
+                    v3 = (((v2 != v1) + (a0[6] + a0[5])) > ((a0[2] && v3) * (v0 || 16)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((a0[8] * v2) <= (v3 - a0[10])) <= ((v2 > a1[2][5]) ? (v2 - a1[2][4]) : (95 * a1[2][11])));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            a1[3][11] = (((v2 * v2) > (v2 + 43)) && ((a1[1][15] ? a0[1] : v1) != (v2 == v2)));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v1 = (((v2 > i6) >= (v0 < v1)) - ((v0 % 7) > (i6 || a1[2][5])));
+                a1[3][7] = (((a0[3] != a1[3][11]) && (v2 ? a0[2] : i6)) * ((v0 && v1) * (i7 - i7)));
+                v3 = (((v2 * i6) && (i6 + a0[9])) / 9);
+            }
+            a0[2] = (((a1[2][14] * a1[3][14]) % 3) < ((i6 ? v0 : a1[2][12]) > (v0 + 77)));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                v3 = (((60 != i9) > (i9 + v3)) - ((i9 % 2) != (v0 + v0)));
+                v0 = (((v1 <= v0) / 5) >= ((i8 != a1[0][8]) + (v0 == v3)));
+                v3 = (((v0 / 9) >= (v1 % 1)) && ((i8 && i9) > (a1[3][6] % 8)));
+            }
+            v3 = (((i8 % 8) / 5) * ((i8 / 1) * (v1 > 63)));
+            a0[3] = (((a1[2][15] ? v3 : a0[4]) > (i8 < a0[5])) >= ((a0[1] <= v0) == (v3 > 3)));
+            i8 = i8 + 1;
+        }
+    }
+    if ((((a0[7] >= a0[2]) || (v0 && v3)) || ((a1[0][10] < 29) && (v2 % 5)))) {
+        v2 = (((a1[1][6] <= v2) >= (v2 + a0[6])) && ((v3 ? v1 : a0[14]) ? (a1[0][8] ? a1[1][1] : 25) : (97 > a0[7])));
+        v3 = (((99 <= v2) > (v2 <= a1[3][4])) * ((v3 % 2) * (v0 < 23)));
+        v3 = (((v2 < a0[1]) / 1) || ((v1 >= v2) * (v3 * 61)));
+    } else {
+        v3 = (((79 - 73) - (54 > 41)) ? ((v2 < v0) <= (v3 * v0)) : ((v3 > a0[9]) == (v1 + a1[0][15])));
+        v2 = (((v0 ? v1 : v2) && (35 < 21)) % 1);
+        a1[2][3] = (((v3 + a1[1][0]) == (v1 ? a1[2][4] : a0[1])) == ((76 + 13) == (a0[0] < v0)));
+    }
+    if ((((v2 != v3) + (21 && 72)) - ((v3 ? v2 : v1) <= (a1[2][7] / 1)))) {
+        v0 = (((2 - v1) % 5) / 2);
+        v0 = (((v3 * v3) < (59 >= a1[2][2])) - ((24 * a0[13]) + (a0[5] && a1[1][14])));
+        v1 = (((v2 + v3) <= (a0[1] + v3)) % 1);
+    } else {
+        a0[10] = (((v3 < v3) == (v2 < 66)) * ((v1 / 2) && (22 + v0)));
+        v3 = (((v2 || 75) >= (v3 - v0)) < ((v3 && v1) * (a0[15] ? a0[0] : v2)));
+        v1 = (((v1 ? 52 : 38) <= (a1[2][5] * 67)) != ((a1[3][2] && 19) < (a1[3][12] - v3)));
+    }
+    {
+        int i10 = 0;
+        while (i10 < 8) {
+            a0[13] = (((69 % 8) >= (i10 * v1)) >= ((15 + i10) ? (v2 * v0) : (a0[14] || 23)));
+            for (int i11 = 0; i11 < 7; i11 = i11 + 1) {
+                v1 = (((a0[2] && a0[2]) > (i10 == 73)) < ((35 < i11) == (61 ? i11 : i10)));
+                v0 = (((v2 || v3) != (v0 >= a0[2])) > ((v3 % 1) % 6));
+                a0[0] = (((7 + v0) <= (a0[6] > a1[0][2])) >= ((v0 >= a1[3][9]) != (a1[2][5] <= 69)));
+            }
+            a1[1][13] = (((v3 >= a1[1][6]) == (v3 || v3)) * ((v1 ? 98 : v2) % 1));
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 3; i12 = i12 + 1) {
+        if ((a1[0][3] != v1) > 97) break;
+        a0[5] = (((i12 + v2) - (v3 % 7)) ? ((v3 ? v1 : 84) > (i12 + 69)) : ((40 > v3) >= (a0[6] != a1[3][12])));
+        a1[2][2] = (((v3 % 1) + (14 >= a1[0][11])) - ((a1[0][7] - v2) <= (v0 == v3)));
+        {
+            int i13 = 0;
+            do {
+                if ((a1[2][13] - 82) > 89) break;
+                v0 = (((i12 == v1) >= (i12 ? a1[1][14] : 92)) % 6);
+                a1[3][15] = (((v2 * v1) > (i12 || a0[14])) == ((a1[0][7] % 1) && (a0[4] && a1[0][12])));
+                a1[2][11] = (((v0 == v2) ? (a1[1][14] <= i12) : (v3 ? v1 : v3)) ? ((a1[1][10] == 15) >= (a0[6] - v1)) : ((a0[6] - i12) / 3));
+                i13 = i13 + 1;
+            } while (i13 < 6);
+        }
+    }
+    return (((36 && v3) != (v0 >= 76)) - ((96 == a1[2][0]) * (v2 % 7)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
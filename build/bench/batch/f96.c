@@ -0,0 +1,119 @@
+int f0() {
+    int v0 = 42;
+    int v1 = 67;
+    int v2 = 41;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v3 || v1) ? (46 ? i0 : v3) : (i0 + v1)) ? ((a1[0][12] % 2) == (47 + v0)) : ((a1[0][13] % 8) % 1));
+            a0[0] = (((a1[3][12] < 51) / 7) / 3);
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v0 = (((i1 >= v3) / 2) ? ((a0[13] + v2) && (i0 || v2)) : ((37 == a0[5]) ? (i0 >= 50) : (i0 / 7)));
+                v0 = (((31 * a0[6]) > (95 % 7)) || ((v0 + i0) > (v1 + v0)));
+                v3 = (((61 != 69) - (13 != a1[2][14])) != ((i1 % 7) + (a0[1] ? a0[14] : 56)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((52 + 43) >= (a1[0][5] < 38)) == ((a0[1] <= 15) == (i3 - v2)));
+                a0[3] = (((87 >= 70) + (18 + v3)) % 9);
+                v0 = (((87 - v2) % 3) > ((v1 * 81) || (i2 + v1)));
+            }
+            a1[2][14] = (((i2 ? a1[0][7] : a1[0][14]) / 4) >= ((59 ? v1 : v1) ? (v1 + v3) : (34 + v3)));
+            a1[0][7] = (((a1[3][7] < v1) == (4 % 5)) % 5);
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a0[3] = (((v1 ? v2 : v1) && (a0[11] == v1)) * ((a0[4] - v3) ? (v3 >= 15) : (v1 != a0[6])));
+            {
+                int i5 = 0;
+                do {
+                    a1[0][15] = (((v0 + a0[7]) % 7) * ((v3 - v2) != (v2 - a0[12])));
+                    v1 = (((14 * v1) * (v2 != v0)) ? ((24 > a0[13]) % 2) : ((a0[12] <= v1) + (v3 && a1[3][6])));
+                    a0[3] = (((a1[2][14] >= 76) != (i4 * a0[0])) ? ((a1[3][10] || v2) % 6) : ((62 || a1[3][12]) != (77 && i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v1 = (((12 == 19) > (v0 < i4)) < ((76 >= v3) / 8));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        if ((a1[2][8] ? 23 : v1) > 93) break;
+        a0[5] = (((v1 - v3) % 9) <= ((i6 - i6) <= (41 < 97)));
+        v2 = (((v2 >= 4) > (90 >= v3)) != ((v2 * a0[10]) - (i6 != v3)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                if ((a1[1][3] * a1[3][11]) > 84) break;
+                v2 = (((64 - 10) * (v3 - a0[8])) ? ((v3 * v0) / 4) : ((90 <= v1) == (a0[11] == v0)));
+                v2 = (((v1 ? a1[3][15] : 78) % 8) + ((i6 + 21) ? (v3 + a1[3][15]) : (v3 <= v2)));
+                v0 = (((v1 > a0[1]) == (v3 ? 12 : i6)) ? ((a0[4] >= a0[8]) > (28 && i6)) : ((81 || a1[2][10]) <= (19 && a1[0][11])));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            if ((a0[2] / 8) > 66) break;
+            v0 = (((59 > 30) && (v2 - 31)) > ((28 <= v3) != (v2 && 10)));
+            v0 = (((26 == i8) ? (v1 > 90) : (a0[9] && v0)) == ((a1[0][11] / 6) != (v1 == 16)));
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    v0 = (((60 - i9) != (i8 < v0)) ? ((a1[1][14] == v3) || (a0[4] > i9)) : ((v3 && 59) < (a0[3] + v1)));
+                    a1[2][6] = (((a0[12] ? 41 : i8) && (a1[0][12] == 49)) - ((i9 ? v2 : 91) ? (v0 > 50) : (a0[11] % 7)));
+                    v1 = (((i9 <= v0) || (88 - 51)) < ((a0[5] * v3) && (a0[13] <= a1[2][3])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    if ((((99 - a1[2][7]) ? (88 <= v1) : (v0 + v2)) <= ((v3 ? 4 : v1) <= (77 >= v3)))) {
+        a1[2][4] = (((v0 && v1) >= (v2 ? a1[3][10] : a1[1][13])) && ((a0[14] == v3) + (a1[1][1] >= v0)));
+        v1 = (((71 >= v0) + (v3 ? a0[10] : v3)) ? ((25 - v2) % 7) : ((19 - v1) >= (v2 == 54)));
+        v3 = (((8 && a0[7]) < (a1[3][6] < 10)) ? ((95 || a0[14]) ? (v3 || v2) : (a0[7] + 14)) : ((v3 || v2) % 6));
+    } else {
+        v3 = (((v0 < v1) - (v1 || v2)) || ((v3 + v0) ? (v2 ? v3 : v0) : (9 != v2)));
+        v0 = (((35 ? v2 : 95) > (v3 * 80)) > ((38 < 30) != (v1 / 2)));
+        v0 = (((v2 <= v1) == (v0 || v3)) && ((a1[0][11] <= v1) != (16 != v2)));
+    }
+    v3 = (((v0 / 3) > (v3 - 71)) * ((v0 > v1) * (v0 >= 22)));
+    if ((((v0 * v1) * (48 % 9)) - ((a0[14] * v3) > (52 || a1[2][5])))) {
+        a0[14] = (((v3 || 20) && (a0[0] / 5)) == ((v1 != 79) != (v2 <= v0)));
+        v2 = (((a0[9] - v1) > (v3 * a1[1][2])) > ((a0[1] != 2) + (v0 == 95)));
+        v3 = (((v1 ? 20 : v3) < (a0[15] == v1)) ? ((v1 == v3) != (96 % 1)) : ((v1 ? a1[0][8] : v2) == (v0 % 8)));
+    } else {
+        v2 = (((v3 + 39) == (60 == 89)) > ((a1[1][5] || v1) || (a0[2] % 5)));
+        a0[13] = (((v0 <= v3) ? (v2 && v2) : (v0 ? 34 : a0[0])) >= ((v0 != a1[3][3]) != (a1[0][10] == v0)));
+        a1[1][8] = (((41 ? a0[3] : a1[0][1]) != (v3 / 4)) >= ((97 + v3) * (a0[6] >= v3)));
+    }
+    a0[4] = (((62 % 6) + (v1 < v1)) < ((v0 / 1) && (v1 ? 87 : a0[2])));
+    if ((((90 != v0) % 3) - ((v1 == v2) > (a1[1][14] != 42)))) {
+        a1[0][0] = (((v2 == 67) != (a1[0][8] - 14)) % 5);
+        v3 = (((12 == a1[1][13]) ? (a1[2][10] - 64) : (v2 % 2)) > ((a0[14] < v1) != (a1[2][4] > v1)));
+        v2 = (((7 / 1) <= (a1[2][5] * v0)) / 1);
+    } else {
+        a1[3][8] = (((a0[14] + v2) == (63 <= 7)) || ((69 || v1) ? (a0[14] == a0[5]) : (v3 > a1[1][5])));
+        v0 = (((v1 != v3) < (a1[2][0] * v2)) || ((v0 != a1[0][11]) <= (a1[3][8] ? a1[1][9] : v3)));
+        v2 = (((v3 * v2) < (70 && v1)) != ((v0 > v1) != (v1 && 51)));
+    }
+    return (((a0[4] * 0) || (v1 ? v1 : v1)) % 2);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
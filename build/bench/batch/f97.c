@@ -0,0 +1,209 @@
+int f0() {
+    int v0 = 98;
+    int v1 = 26;
+    int v2 = 92;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 != v2) == (a0[10] <= v3)) >= ((v0 <= v2) <= (a0[10] <= 26)));
+    a1[2][15] = (((23 ? v3 : a0[13]) != (v3 * v3)) - ((3 + v0) <= (57 ? v1 : v1)));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v3 = (((a0[12] && 7) != (a1[3][3] > a1[2][8])) % 4);
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                if ((v1 ? i1 : v3) > 62) break;
+                v0 = (((a0[13] && i0) == (23 == a0[0])) > ((a0[13] == a1[0][12]) < (v0 != a1[3][15])));
+                v3 = (((v1 >= a0[11]) == (3 + a1[1][13])) % 7);
+                a1[3][15] = (((i1 < v1) < (v2 <= a1[3][5])) ? ((i1 >= a0[14]) < (a1[3][10] % 8)) : ((46 % 4) + (v0 < v1)));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((v3 + a1[1][11]) || (a0[14] ? a0[2] : 74)) - ((v1 >= 65) ? (v3 || v0) : (a0[13] ? a1[1][4] : v3)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((40 ? v0 : a1[0][0]) >= (a0[2] < a1[0][9])) ? ((v3 + v0) < (v2 < a0[9])) : ((a1[3][5] > 56) >= (a1[0][4] && i2)));
+        v2 = (((i2 <= a1[1][15]) ? (a1[1][1] - v2) : (22 < a0[2])) <= ((v3 * v0) != (v3 < 53)));
+        {
+            int i3 = 0;
+            do {
+                a0[2] = (((95 && 17) + (36 && 97)) <= ((i3 == a1[3][10]) - (i3 % 7)));
+                v3 = (((a1[0][4] % 7) && (a0[9] / 2)) || ((79 == v2) ? (a0[15] * v2) : (i3 || a0[2])));
+                a1[1][13] = (((v2 > 32) + (a1[3][9] - a1[3][2])) <= ((v1 * 57) == (a1[2][5] ? v3 : 85)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v3 < 75) <= (v1 - v1)) - ((v1 != a1[2][10]) < (v2 + v0)));
+            v3 = (((58 % 8) && (2 - v0)) && ((a1[0][10] == a0[4]) * (v1 % 2)));
+            {
+                int i5 = 0;
+                do {
+                    a1[1][13] = (((v0 - v3) % 8) > ((a1[1][10] / 6) || (v2 != v2)));
+                    v3 = (((v3 > i5) > (v0 ? 1 : v3)) ? ((v2 % 9) || (95 / 4)) : ((i5 / 6) * (34 - a0[7])));
+                    v2 = (((82 || 3) + (v0 ? v3 : v1)) / 9);
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            v1 = (((79 < 28) ? (33 != v0) : (60 ? a0[7] : v0)) == ((v1 > a0[5]) || (v0 * 30)));
+            v2 = (((v1 - v1) * (i6 && 16)) <= ((v1 <= a0[1]) && (a1[3][3] >= i6)));
+            a1[3][11] = (((i7 && 47) == (i7 < 57)) == ((v3 || i6) >= (28 >= 43)));
+        }
+        a0[1] = (((v1 + v2) + (v3 + v2)) ? ((a1[2][7] - v1) && (v3 < a0[15])) : ((i6 != v2) != (17 && v3)));
+        v1 = (((v3 <= a0[4]) - (a0[0] > v0)) - ((v3 >= a0[12]) * (v1 >= 51)));
+    }
+    v3 = (((v2 < a0[3]) ? (49 <= 64) : (a0[15] || v1)) < ((a1[2][7] > v3) || (a1[2][13] ? 2 : v1)));
+    v1 = (((v3 != v1) / 9) > ((v1 != a1[2][9]) - (v3 || a1[1][4])));
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        v0 = (((i8 < v0) < (i8 - a1[3][5])) * ((a1[0][1] + a0[14]) ? (v3 > v3) : (i8 < v0)));
+        v3 = (((v0 < 52) || (v1 / 4)) >= ((v1 && v1) * (v2 > v0)));
+        {
+            int i9 = 0;
+            while (i9 < 6) {
+                v2 = (((v1 <= i9) ? (v3 && a0[0]) : (v2 / 7)) == ((25 >= v3) && (13 / 9)));
+                v2 = (((a1[1][7] < v2) == (a0[11] ? v3 : v1)) < ((v3 >= 80) * (i8 == 57)));
+                a1[0][1] = (((a0[12] - 66) / 6) == ((54 && v0) % 6));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    if ((((v0 && 10) ? (v3 <= v2) : (v3 + a1[3][3])) + ((v1 <= v3) < (v0 - v0)))) {
+        a0[7] = (((v2 + v2) == (88 > v1)) - ((a0[13] == v1) ? (a1[0][11] <= v2) : (a0[9] * v2)));
+        v1 = (((a0[6] + 52) % 2) != ((58 != v1) ? (60 / 4) : (a0[3] != v3)));
+        v3 = (((v3 ? v1 : 76) >= (v1 * v2)) ? ((v0 ? a1[3][14] : v0) * (v0 <= v3)) : ((v3 != 50) - (92 ? a0[6] : v1)));
+    } else {
+        a1[3][15] = (((33 == a0[8]) % 2) != ((a1[1][6] ? a0[6] : v3) != (a0[2] - a0[7])));
+        a1[1][9] = (((a0[8] + v2) % 2) > ((a1[3][9] == v0) || (16 != 19)));
+        v2 = (((a1[2][5] <= a0[0]) != (25 < v1)) >= ((a1[1][11] ? 75 : 2) - (v1 - 10)));
+    }
+    return (((v3 * a1[1][1]) <= (v0 - v1)) <= ((v0 / 4) || (a0[10] / 4)));
+}
+int f1() {
+    int v0 = 43;
+    int v1 = 69;
+    int v2 = 93;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((a0[1] || v2) > 89) break;
+        v3 = (((i0 - a1[1][12]) < (v2 && v1)) ? ((i0 < a1[3][8]) <= (a1[0][15] < a0[8])) : ((a0[7] < v1) - (a1[0][2] - a0[11])));
+        a1[0][15] = (((a0[8] <= v0) || (99 <= a0[15])) + ((i0 >= a1[2][15]) ? (v2 - v0) : (a0[13] % 7)));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                v0 = (((v3 != 24) / 6) * ((a0[10] ? i0 : v0) % 5));
+                a1[2][3] = (((89 != 49) == (a1[1][0] / 7)) - ((a0[10] <= a1[3][13]) >= (67 > a1[1][10])));
+                a1[3][15] = (((a1[1][6] ? i1 : v3) * (98 / 4)) + ((48 == a0[11]) <= (35 == v0)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    if ((((a0[8] >= v2) - (v0 <= 99)) >= ((39 >= 46) + (v2 ? v3 : v2)))) {
+        v3 = (((v0 + a1[1][0]) || (52 == 67)) / 1);
+        v2 = (((a1[2][15] + v2) ? (54 <= v2) : (a0[10] * v3)) * ((86 + v1) / 8));
+        v3 = (((v3 ? a0[0] : a1[1][10]) / 9) ? ((v3 < v2) <= (a0[12] + a0[5])) : ((65 + 42) % 7));
+    } else {
+        v2 = (((v0 || v0) / 9) * ((v1 < v3) <= (a0[10] || a1[0][2])));
+        v2 = (((v2 - v0) - (v2 > v2)) ? ((v2 ? v1 : a1[1][1]) != (a0[15] % 3)) : ((v0 <= a0[8]) > (v2 || 61)));
+        a1[3][0] = (((54 >= 22) && (v1 < a0[1])) - ((a1[0][10] == v2) < (v3 - v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[1] % 7) > 74) break;
+                    v0 = (((a1[2][13] / 9) ? (76 < v3) : (4 + 16)) != ((v1 <= a1[2][4]) <= (i2 == i3)));
+                    a1[2][8] = (((21 || v0) ? (a1[1][10] + 47) : (7 ? a0[10] : v2)) % 4);
+                    v2 = (((92 >= a0[5]) == (v1 > a1[2][13])) / 3);
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a0[9] = (((i2 <= v0) || (v2 != v3)) != ((85 < v1) > (v1 ? v1 : v1)));
+            v2 = (((v2 == i2) <= (0 >= v0)) && ((v3 != v1) % 9));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v2 && 23) % 3) || ((a0[12] && v1) + (v3 >= v3)))) {
+        a0[14] = (((36 != v0) != (44 / 1)) - ((v1 / 5) != (a0[2] != a1[1][9])));
+        a0[14] = (((45 >= a1[2][0]) % 6) && ((v1 <= 31) || (11 <= 68)));
+        v2 = (((93 % 1) < (98 != v1)) ? ((v0 / 5) || (a0[15] > v1)) : ((a0[6] < v0) * (35 && a1[3][12])));
+    } else {
+        a1[2][14] = (((v0 + 86) || (a0[8] > 50)) + ((51 * v0) || (a1[1][8] > a0[9])));
+        v1 = (((a0[7] > v1) < (v3 * v1)) ? ((v1 != v1) > (v0 % 2)) : ((a0[1] && 21) ? (a0[13] - a1[1][2]) : (v2 - 68)));
+        v1 = (((81 % 8) >= (v1 % 9)) - ((a1[1][7] % 3) > (a1[0][1] > 99)));
+    }
+    if ((((v0 % 1) % 8) == ((a1[1][15] < v2) >= (v0 >= 40)))) {
+        v0 = (((v2 || 41) && (v1 && 82)) >= ((v0 <= 52) == (v2 - 99)));
+        v1 = (((43 < a0[4]) != (v2 * v3)) > ((v2 + v0) && (v3 ? v2 : v0)));
+        a0[1] = (((v0 - v3) + (a0[9] / 2)) + ((v2 || a1[2][0]) > (85 && a1[3][5])));
+    } else {
+        v2 = (((85 == a0[11]) && (v3 * v2)) ? ((a1[0][4] / 3) != (a1[1][15] / 8)) : ((46 > v3) * (13 == v3)));
+        v0 = (((a0[4] <= 99) != (24 >= 73)) + ((a1[2][15] > a0[6]) && (a1[3][3] ? v0 : a0[1])));
+        a1[2][14] = (((a0[2] + v1) > (a0[2] || v2)) != ((v0 % 1) + (v3 > v3)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((i4 >= v3) > 65) break;
+        v2 = (((a0[14] + v0) >= (v0 && a1[2][15])) <= ((65 % 5) ? (6 != v1) : (v2 ? 93 : v0)));
+        v3 = (((v1 || a0[1]) && (v0 - v3)) * ((v2 % 1) * (a1[3][14] == a0[6])));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            a1[1][13] = (((v2 - v0) <= (35 != a1[2][14])) / 4);
+            v0 = (((a0[11] == i5) * (v3 - 21)) >= ((70 ? i4 : a0[13]) % 7));
+            v1 = (((v1 && 49) + (i5 % 5)) ? ((v0 / 3) >= (a0[15] <= 86)) : ((i4 >= a0[2]) % 6));
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((a1[3][7] && v2) > 59) break;
+            v2 = (((a0[12] && a0[11]) >= (a1[3][13] != v0)) || ((i6 ? i6 : 60) - (v3 + i6)));
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    a0[14] = (((33 ? i6 : v1) * (a0[6] && v0)) && ((v1 <= v3) % 2));
+                    v1 = (((v3 + i6) == (v1 > 71)) ? ((i6 || i7) ? (29 ? 9 : v1) : (v3 < v3)) : ((i6 != v0) + (a1[3][14] % 9)));
+                    v0 = (((33 ? 11 : 21) > (i6 - v2)) < ((63 != a1[1][13]) ? (a1[1][11] != 78) : (i6 >= v0)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((v0 < a0[8]) < (97 > v3)) % 2);
+            i6 = i6 + 1;
+        }
+    }
+    a1[3][8] = (((66 > 70) == (v3 && a0[2])) == ((v1 > v2) && (v3 <= a1[2][15])));
+    v3 = (((a1[1][2] || v1) / 1) == ((16 <= v0) && (v1 - v3)));
+    {
+        int i8 = 0;
+        do {
+            v1 = (((a0[9] ? 88 : v3) * (v2 ? a1[3][14] : 20)) + ((v3 < 11) == (i8 != i8)));
+            v2 = (((v2 >= v0) < (v3 % 4)) < ((v1 ? 59 : v3) * (29 <= a1[1][8])));
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    v3 = (((v2 * 28) % 3) == ((v1 ? v0 : v0) <= (i9 != i8)));
+                    a1[1][14] = (((a1[3][11] ? 85 : v2) / 8) == ((a0[13] || v0) != (i9 % 1)));
+                    v2 = (((i9 > i8) <= (i8 <= a1[0][7])) * ((i8 == a0[9]) || (v3 && v0)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    return (((34 || 24) == (v1 % 7)) * ((v2 || v2) && (a0[8] % 8)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
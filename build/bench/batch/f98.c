@@ -0,0 +1,323 @@
+int f0() {
+    int v0 = 1;
+    int v1 = 59;
+    int v2 = 61;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a1[2][3] == a1[0][13]) > 65) break;
+            a1[1][12] = (((v3 || 52) >= (i0 < i0)) == ((v2 < a0[1]) * (v0 ? v3 : a1[1][3])));
+            v2 = (((a0[11] >= i0) >= (a1[1][12] / 8)) * ((42 > v0) ? (v1 != 62) : (27 ? 35 : a0[9])));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[3][12] = (((a1[1][12] < a1[1][15]) + (i0 != 92)) + ((v3 == a1[2][11]) / 6));
+                    a1[2][7] = (((a1[3][8] % 7) * (v2 > 27)) > ((v2 * 7) - (3 || v2)));
+                    v3 = (((22 >= 38) / 1) + ((i0 - i1) != (v2 == v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((v3 + v2) < (v0 / 3)) != ((v1 / 8) || (a0[2] + 44)))) {
+        v1 = (((a1[3][0] ? 26 : v3) / 2) < ((v1 < 18) + (v2 != v1)));
+        v1 = (((v1 <= v1) != (v1 >= 94)) ? ((a0[2] ? v3 : 31) >= (70 - v2)) : ((90 != v1) ? (65 && v0) : (v0 * v0)));
+        a1[3][1] = (((44 && v2) ? (a0[7] <= v3) : (a1[1][10] ? v3 : v0)) == ((v3 ? a1[0][1] : v0) < (18 / 9)));
+    } else {
+        v0 = (((v0 == a1[2][7]) % 2) ? ((v3 && v1) ? (27 + a0[15]) : (v2 >= v0)) : ((v3 ? v0 : v1) ? (25 / 8) : (v0 && v2)));
+        v0 = (((a0[5] <= 31) >= (98 >= 66)) ? ((69 / 8) * (v3 * v1)) : ((v3 < v1) % 5));
+        a1[1][4] = (((v2 == v0) / 7) <= ((v3 == v3) == (95 < v0)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            a0[10] = (((a0[13] ? 81 : v3) ? (i2 != v1) : (0 <= v2)) % 2);
+            v2 = (((v0 < v1) * (95 - 39)) ? ((i2 - a0[8]) ? (6 != i2) : (9 == v1)) : ((a1[3][14] > a1[2][4]) || (v3 ? a0[10] : v3)));
+            v3 = (((a0[2] < 95) % 6) < ((a1[0][15] % 5) >= (75 < v3)));
+        }
+        v3 = (((v3 * v0) == (a1[2][7] ? v0 : v1)) * ((v1 != a1[2][14]) ? (95 || a0[5]) : (33 / 4)));
+        v1 = (((v3 / 6) / 2) > ((v0 != 56) || (a1[3][6] ? 14 : 70)));
+    }
+    v2 = (((v0 - a0[2]) % 5) * ((0 * v3) * (v3 * a1[2][3])));
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v0 = (((v3 ? a0[13] : a0[5]) >= (a0[8] > v0)) ? ((v3 <= i4) ? (v3 + v0) : (45 / 9)) : ((v0 || v1) + (v1 || v1)));
+        a1[2][15] = (((v0 / 9) ? (a0[2] > a1[3][14]) : (7 * 79)) || ((v1 + v0) ? (30 >= v2) : (a0[1] * 89)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v3 = (((a1[1][9] > v1) < (i5 || a0[15])) >= ((39 < a1[1][13]) || (i4 > v3)));
+            v0 = (((43 % 9) + (v3 * a1[3][13])) / 5);
+            v2 = (((v0 < i4) != (a0[13] % 5)) + ((v1 * a0[15]) ? (i4 * i4) : (v0 < i5)));
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[2] = (((a1[0][2] >= v0) >= (a0[12] * i6)) == ((a1[2][13] % 6) + (i6 - v0)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v1 = (((v0 * 1) * (v2 % 1)) / 8);
+                    v2 = (((v2 >= 69) % 9) == ((a1[2][7] + a0[1]) < (v0 * a1[0][14])));
+                    a0[5] = (((a1[1][11] == i6) > (i6 < a1[0][3])) == ((a0[9] >= a1[3][2]) ? (59 <= 81) : (a1[1][5] != a1[0][15])));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((v0 ? 3 : v0) % 4) * ((a0[5] ? a0[11] : a0[13]) == (2 <= v0)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 8) {
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    a1[1][13] = (((v1 && i8) >= (v1 <= a1[1][7])) == ((v1 && 29) / 2));
+                    a1[1][5] = (((v3 != 91) % 7) < ((i8 <= 4) && (47 - a1[1][10])));
+                    v2 = (((a1[2][12] - v0) < (78 != a0[7])) < ((i8 == a0[9]) % 7));
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((a0[7] >= 43) != (v1 ? v1 : i8)) >= ((v2 <= 8) < (3 < a0[14])));
+            v3 = (((v2 != i8) >= (67 + 85)) ? ((26 ? v2 : 7) > (52 == v3)) : ((v3 < v1) ? (i8 + v0) : (a0[1] ? 7 : v1)));
+            i8 = i8 + 1;
+        }
+    }
+    for (int i10 = 0; i10 < 3; i10 = i10 + 1) {
+        a1[3][5] = (((v3 == 73) - (v1 == i10)) > ((v0 <= 75) ? (v3 || 56) : (v0 - 37)));
+        v3 = (((a0[14] > 98) && (v2 && v1)) / 7);
+        for (int i11 = 0; i11 < 8; i11 = i11 + 1) {
+            if ((v1 + v1) > 55) break;
+            a0[11] = (((87 != i11) / 8) <= ((i11 && i10) ? (i11 - v3) : (24 || i10)));
+            a0[6] = (((i11 != a1[0][12]) ? (28 < a0[12]) : (29 || v1)) >= ((i11 + 34) ? (i10 * i10) : (37 != v2)));
+            v1 = (((49 == v3) || (v0 == 11)) * ((v0 != a1[3][11]) - (i10 > i10)));
+        }
+    }
+    a1[0][1] = (((v1 / 1) < (a1[3][15] != a1[2][4])) ? ((v3 || v0) / 9) : ((v0 == v1) - (83 / 9)));
+    if ((((v1 >= 13) || (a0[5] ? 45 : v0)) * ((a1[1][5] - v2) > (v2 ? 27 : 63)))) {
+        a0[15] = (((v2 ? 19 : v2) < (v3 <= 12)) != ((a1[1][4] != v3) ? (62 > v0) : (v1 >= v2)));
+        v1 = (((a1[0][1] ? 73 : v0) > (v1 >= a0[12])) / 8);
+        v1 = (((v0 % 9) - (v1 / 6)) > ((37 + v2) / 4));
+    } else {
+        a1[2][11] = (((v3 * 44) != (a1[2][7] - a1[3][1])) * ((a0[12] ? v3 : 3) && (a1[0][10] * v2)));
+        v0 = (((v2 + v0) && (v1 > v0)) <= ((v2 ? a1[1][3] : 29) || (56 != 81)));
+        a0[14] = (((v0 + a0[1]) <= (v2 <= v3)) >= ((a1[1][2] % 2) < (v3 == a0[1])));
+    }
+    return (((a0[8] - 45) ? (v0 > v2) : (v3 != 87)) + ((v0 / 8) * (a1[3][8] == a0[3])));
+}
+int f1() {
+    int v0 = 32;
+    int v1 = 33;
+    int v2 = 49;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v2 = (((v0 <= i1) * (i1 ? i1 : i0)) || ((v3 <= 85) * (83 != v3)));
+            a0[13] = (((65 % 8) / 4) >= ((v1 % 6) / 6));
+            a0[12] = (((i1 % 4) - (v0 >= 34)) > ((v2 == v0) + (65 < a0[3])));
+        }
+        a0[15] = (((v3 ? 20 : v2) ? (27 != v1) : (v0 >= v3)) ? ((v3 % 2) ? (a0[12] == a0[4]) : (94 ? i0 : a0[4])) : ((23 || v0) <= (78 - a1[3][4])));
+        v3 = (((v1 <= a1[2][4]) + (8 <= v0)) * ((i0 + 58) && (30 + v1)));
+    }
+    a1[1][11] = (((11 ? a1[0][13] : 90) >= (v2 >= v0)) ? ((v2 == 82) % 2) : ((v2 != v3) + (v1 + v1)));
+    if ((((50 < v3) && (40 && a1[0][9])) < ((a0[6] ? v3 : v3) ? (a1[2][2] - v2) : (a0[10] + v2)))) {
+        a1[0][9] = (((v1 + 17) != (v2 != 55)) <= ((v2 <= v2) <= (v1 == a1[0][3])));
+        v1 = (((v1 ? v0 : v0) <= (a1[1][0] != 21)) + ((v0 < v3) <= (a0[12] * a1[0][5])));
+        a1[0][2] = (((50 > v3) > (a1[0][8] && v1)) * ((a1[2][15] * 55) == (a1[3][2] || v2)));
+    } else {
+        v0 = (((a1[1][2] && a0[10]) < (a1[1][12] ? v2 : v1)) / 1);
+        v2 = (((a1[2][12] < v1) || (a0[6] <= a0[13])) * ((a1[2][14] || 27) * (v0 < v3)));
+        v2 = (((v3 || v0) - (v0 && 82)) * ((62 && v1) < (15 * 87)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((v0 ? v1 : a1[0][11]) >= (a1[0][13] * i3)) * ((i3 && v2) >= (v2 == i2)));
+                    v1 = (((67 % 8) <= (25 + 60)) && ((90 % 7) > (v1 > i2)));
+                    v3 = (((v0 ? i3 : a0[12]) > (a1[2][9] - a1[1][9])) < ((i3 || v2) <= (i2 ? i2 : 33)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v2 != v1) ? (i2 + a0[7]) : (a0[11] < 64)) < ((v1 - 22) - (v0 ? v0 : v0)));
+            v3 = (((74 && v3) / 5) != ((v2 < i2) && (v0 % 1)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v2 = (((v0 < 33) <= (a1[2][8] - a1[3][13])) ? ((29 > v2) <= (v2 ? a0[1] : v1)) : ((v3 / 8) + (v2 - 79)));
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 2) {
+                if ((a1[0][6] ? 25 : v2) > 87) break;
+                a1[2][3] = (((a1[3][5] - a0[1]) ? (i5 && a1[2][0]) : (a1[1][9] + 15)) - ((v2 * i4) || (i4 < a0[2])));
+                v0 = (((v0 < a0[11]) - (v1 > i4)) <= ((90 < 22) <= (v0 ? v1 : 42)));
+                a1[1][0] = (((22 + 21) == (a1[3][9] / 7)) * ((a1[3][11] + 27) + (a0[10] ? v0 : a1[3][7])));
+                i5 = i5 + 1;
+            }
+        }
+        a0[6] = (((a0[12] < 4) ? (80 || 5) : (a0[6] == v1)) % 6);
+        v3 = (((v2 * 10) / 2) != ((v0 ? 7 : a1[0][0]) != (47 && v1)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        if ((v0 >= a1[2][13]) > 90) break;
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            if ((a0[4] || a0[9]) > 53) break;
+            v1 = (((v1 ? a0[0] : v2) + (v0 > v2)) * ((a0[11] && v1) ? (v3 >= i7) : (i7 ? a1[3][14] : i7)));
+            a0[11] = (((v1 ? a0[13] : i6) % 9) > ((v0 == a0[0]) + (v0 == 94)));
+            a1[1][3] = (((a0[6] == v1) && (v3 ? a1[2][9] : a0[9])) <= ((v3 || 58) + (i6 && v0)));
+        }
+        a1[0][14] = (((38 % 7) == (v3 >= i6)) ? ((v2 < i6) ? (i6 > a1[1][2]) : (93 == a0[8])) : ((v2 <= a0[5]) - (41 != a0[5])));
+        a1[1][11] = (((48 == a0[14]) <= (a0[13] - v3)) && ((v2 + v1) >= (38 / 4)));
+    }
+    if ((((2 - a0[6]) > (v0 && v2)) && ((a1[1][13] % 4) % 4))) {
+        v3 = (((a0[0] <= v0) ? (a1[1][4] + 99) : (v3 && 16)) - ((v1 > 49) > (v3 || a0[10])));
+        v2 = (((a1[3][2] + v3) && (v2 - v2)) && ((v2 % 4) >= (v1 * v2)));
+        a0[2] = (((v2 >= a1[1][11]) ? (a1[0][13] / 4) : (a1[0][11] > a1[1][11])) % 2);
+    } else {
+        v1 = (((v1 && v0) + (v3 % 5)) + ((2 - v3) || (99 <= 35)));
+        v1 = (((v0 < a1[2][11]) ? (4 < a1[3][2]) : (v2 + 94)) % 7);
+        v1 = (((v1 >= a1[0][7]) * (v3 < v2)) == ((0 ? v1 : 71) - (v0 && v2)));
+    }
+    v0 = (((a0[3] && 15) <= (a1[3][7] ? a1[3][1] : v0)) ? ((v1 <= v0) * (v3 - v3)) : ((38 ? v3 : v2) <= (a1[1][12] != v1)));
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        if ((v2 ? i8 : v3) > 95) break;
+        a0[14] = (((v3 < a1[2][4]) == (v1 - v0)) - ((i8 <= 57) ? (a1[1][13] / 4) : (v0 ? v0 : 99)));
+        a0[2] = (((61 < a0[10]) * (72 % 4)) ? ((v3 - 17) && (83 && v3)) : ((53 / 5) + (v0 - a1[3][9])));
+        {
+            int i9 = 0;
+            do {
+                a0[14] = (((64 / 3) == (a1[3][1] < v1)) / 9);
+                a1[0][1] = (((55 == 25) || (i8 >= v1)) == ((i8 + 79) ? (7 == v3) : (a0[7] < v0)));
+                v0 = (((a0[1] == v1) - (a0[2] < v1)) - ((57 <= v3) > (a1[1][10] + a0[10])));
+                i9 = i9 + 1;
+            } while (i9 < 6);
+        }
+    }
+    return (((a0[0] * v3) <= (v2 == v0)) >= ((94 + a1[0][13]) < (v1 >= v1)));
+}
+int f2() {
+    int v0 = 58;
+    int v1 = 66;
+    int v2 = 2;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((i0 >= i0) > 52) break;
+        v2 = (((i0 > a1[3][9]) < (v0 * v1)) / 3);
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                a1[1][4] = (((86 % 6) ? (i1 || a1[2][0]) : (27 == v1)) / 2);
+                v2 = (((i1 <= a1[1][0]) ? (66 >= v1) : (v2 == 71)) > ((v3 + i1) / 4));
+                v2 = (((a0[15] || 53) * (i0 || v1)) || ((v1 == v1) || (a1[3][1] <= 45)));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((a1[1][4] && a0[11]) ? (a0[9] + a1[2][15]) : (0 <= v1)) || ((35 % 5) - (v2 <= i0)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a0[5] = (((a1[2][2] ? a0[12] : 18) / 2) ? ((v0 || i2) && (10 < 22)) : ((27 * 75) / 5));
+            v0 = (((a0[15] <= v3) <= (a0[14] ? v3 : v3)) || ((v2 * v2) * (66 - 10)));
+            v2 = (((a1[1][0] >= a1[0][15]) >= (a1[0][10] - i3)) / 7);
+        }
+        v0 = (((a0[4] != 80) + (i2 >= v0)) >= ((a1[2][4] > v3) - (a1[3][7] > v2)));
+        v1 = (((v0 % 5) % 9) >= ((89 || v0) / 9));
+    }
+    if ((((v2 < v3) < (v0 + a1[0][9])) || ((a0[5] || v3) ? (v3 * v1) : (a1[3][15] && 73)))) {
+        v0 = (((7 - v0) != (v1 < v3)) < ((v1 ? v0 : a1[2][0]) != (v1 >= v0)));
+        v1 = (((35 != 10) * (v1 * v2)) / 9);
+        a0[14] = (((6 ? a0[10] : v2) / 4) - ((v3 + a1[2][8]) >= (a0[1] / 3)));
+    } else {
+        v0 = (((a1[3][8] > v1) >= (a1[1][15] * v0)) || ((a1[3][12] && v3) <= (v2 < 98)));
+        a0[12] = (((v1 >= v3) && (a0[8] > v2)) <= ((30 - a0[10]) / 4));
+        v1 = (((v1 < a0[9]) - (v0 != v2)) || ((v3 - a1[3][3]) >= (v3 > v3)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a1[1][3] = (((v3 <= a1[1][5]) > (v3 % 1)) % 2);
+            v1 = (((68 ? a1[3][4] : 77) <= (38 && 69)) * ((v0 >= 60) != (a0[12] * a1[1][4])));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((v2 < v2) <= (a1[1][12] % 1)) <= ((v3 > a1[2][4]) * (a1[2][12] && 29)));
+                    a1[2][13] = (((i4 ? a0[11] : a1[2][6]) / 8) ? ((v2 && a1[3][15]) >= (i4 <= i4)) : ((v0 != i5) % 1));
+                    a1[0][0] = (((v3 * a1[2][6]) || (v0 + v0)) && ((a1[2][13] - v3) * (67 % 5)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 >= a0[4]) - (v3 ? 25 : v1)) >= ((a0[0] <= v3) * (a0[12] < v3)))) {
+        v3 = (((a1[1][5] ? v0 : 5) != (a1[0][9] && a1[1][7])) >= ((1 && v0) != (v2 * v1)));
+        v0 = (((a1[0][6] <= a1[0][13]) < (v0 - 43)) * ((a1[2][15] != 27) / 6));
+        v0 = (((60 ? a1[2][14] : 4) % 6) ? ((84 < v0) ? (42 || 85) : (58 / 1)) : ((66 == v3) + (v1 ? v3 : v1)));
+    } else {
+        a0[1] = (((23 / 3) / 1) == ((v0 || v3) != (43 <= a1[0][4])));
+        a0[3] = (((a0[8] <= 21) / 5) ? ((v0 && v2) + (v2 + v1)) : ((v2 * 76) && (a0[6] < a0[3])));
+        v2 = (((v0 >= 91) / 7) % 3);
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                v3 = (((a1[3][11] ? a1[2][7] : a0[7]) < (v2 + a1[3][13])) / 8);
+                v2 = (((v1 + v1) >= (v3 && a1[1][6])) >= ((74 % 5) < (v2 ? 39 : a0[1])));
+                a0[15] = (((i6 <= i6) * (a0[1] ? a0[2] : i6)) * ((v0 - v3) < (i7 == a1[3][6])));
+            }
+            v2 = (((v0 * v3) ? (v0 == a0[8]) : (v3 <= v0)) > ((v2 || 87) || (70 - 72)));
+            a1[2][11] = (((i6 == 27) ? (v0 <= v2) : (v1 >= v1)) >= ((v3 == 22) * (v2 && a1[1][6])));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        v0 = (((v2 || v2) <= (a1[3][13] > v2)) < ((v2 == 52) ? (v2 > v3) : (a0[2] == v2)));
+        a0[13] = (((65 <= 22) * (a0[2] % 1)) <= ((v3 || i8) % 4));
+        {
+            int i9 = 0;
+            do {
+                v1 = (((v2 || 45) - (v1 < a1[0][1])) + ((v1 / 6) ? (v3 ? v2 : v2) : (a0[15] <= 72)));
+                a0[14] = (((a0[4] || v0) != (73 == a0[13])) && ((26 == i8) - (a1[0][15] < v3)));
+                v2 = (((a0[10] * 37) ? (v2 ? a0[12] : v0) : (a0[9] - i8)) / 3);
+                i9 = i9 + 1;
+            } while (i9 < 7);
+        }
+    }
+    a0[3] = (((50 != a1[0][13]) ? (v1 ? v3 : v1) : (v2 ? v1 : 85)) * ((10 - 78) % 2));
+    for (int i10 = 0; i10 < 7; i10 = i10 + 1) {
+        a1[2][7] = (((i10 * v0) - (a1[3][14] * v0)) % 2);
+        for (int i11 = 0; i11 < 7; i11 = i11 + 1) {
+            a1[1][14] = (((i11 > 99) * (a1[2][2] || 4)) / 7);
+            a1[2][3] = (((59 - v2) + (a0[5] / 5)) + ((i10 + i10) < (a0[14] >= v0)));
+            v3 = (((v3 && v1) <= (a0[6] - v2)) && ((i11 <= v3) <= (i11 < 11)));
+        }
+        v0 = (((v3 + v1) || (v0 - v0)) != ((v2 && i10) ? (58 || v3) : (a0[0] >= a0[15])));
+    }
+    if ((((v0 ? a1[1][15] : a0[0]) + (v3 ? v1 : v3)) >= ((a0[13] == v3) != (21 % 3)))) {
+        v0 = (((52 == v2) - (90 >= a0[12])) ? ((v2 >= v1) || (v2 <= v1)) : ((v0 || a1[0][2]) != (v3 < v0)));
+        a0[8] = (((a0[4] - v1) <= (26 + 8)) || ((27 * v0) && (v1 - v1)));
+        v3 = (((v2 || 40) && (43 / 3)) || ((a1[0][6] && 50) != (3 && v3)));
+    } else {
+        v2 = (((91 < a0[10]) ? (a0[10] != v2) : (a0[6] <= v0)) <= ((v2 % 1) != (83 && 99)));
+        a0[5] = (((v1 * 19) >= (v0 > a1[2][1])) * ((a0[1] <= 43) > (v0 ? 37 : v0)));
+        v2 = (((a1[0][8] / 3) ? (v1 - v3) : (39 <= 83)) - ((10 <= a1[2][10]) < (v3 != v3)));
+    }
+    return (((20 / 9) ? (a0[7] ? v2 : v1) : (v2 >= v3)) + ((v3 != a1[2][8]) % 1));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,411 @@
+int f0() {
+    int v0 = 40;
+    int v1 = 12;
+    int v2 = 95;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[3][4] || v3) / 4) ? ((66 ? 47 : 83) * (a1[2][2] > 80)) : ((94 <= v2) / 2));
+    v0 = (((v3 || v1) < (v2 + a1[0][14])) % 1);
+    v3 = (((v0 >= v1) || (65 || v1)) > ((7 != v1) * (v0 ? v2 : a1[0][10])));
+    if ((((23 - 92) - (a1[2][6] || v2)) <= ((a1[0][1] + v2) * (a0[14] ? v3 : v3)))) {
+        a1[1][3] = (((a1[0][0] != a0[6]) % 8) + ((v3 < v2) > (v0 || a1[3][5])));
+        v3 = (((a0[3] * v0) / 5) && ((73 * v2) ? (a1[0][9] >= v0) : (69 * a1[0][12])));
+        a1[2][3] = (((97 % 2) != (0 * v0)) + ((v2 == a0[7]) - (v2 - 54)));
+    } else {
+        a0[6] = (((a0[13] % 9) - (v0 == v1)) / 2);
+        v1 = (((78 + v1) < (v1 != v0)) > ((v2 && v1) % 5));
+        v3 = (((v2 < 88) != (a0[12] || v0)) ? ((v2 + v3) / 6) : ((v2 > v1) == (a0[0] < 85)));
+    }
+    v1 = (((87 != a0[2]) && (29 && a0[6])) - ((32 != 77) <= (v0 <= a0[7])));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 && v0) * (v3 * v2)) <= ((36 == a1[1][8]) * (v1 * 61)));
+            v0 = (((i0 ? i0 : v3) - (a1[1][5] % 6)) > ((v1 >= 96) > (a1[0][10] / 8)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v2 > 9) <= (53 == 82)) < ((v0 ? v3 : a0[9]) != (i1 <= 1)));
+                    v3 = (((v2 ? v3 : i1) > (i1 >= v3)) ? ((a0[3] ? 2 : a1[0][7]) || (61 <= a0[3])) : ((a0[13] * v3) != (23 / 1)));
+                    v3 = (((i0 + v3) == (33 || 67)) <= ((a0[2] > v3) < (v1 / 7)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((a0[11] || i2) > 94) break;
+        v0 = (((v0 >= 54) != (a1[1][14] / 6)) / 2);
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v1 = (((a1[2][11] == 7) + (a1[2][14] > v3)) && ((v0 ? v1 : a1[3][9]) / 8));
+            v0 = (((v2 != a0[2]) % 2) + ((63 ? v2 : v3) % 4));
+            v2 = (((a0[5] <= 48) == (i3 >= v0)) / 4);
+        }
+        v0 = (((31 ? 99 : v0) ? (v1 % 9) : (v0 / 9)) > ((i2 || a1[0][13]) * (v1 % 5)));
+    }
+    v2 = (((v0 < 31) - (v1 >= v2)) > ((v3 / 9) && (a1[1][5] ? v3 : a0[7])));
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a0[4] = (((a1[3][5] % 9) != (v3 || v2)) && ((52 >= a1[1][4]) / 1));
+                v3 = (((i5 % 9) ? (70 + v2) : (v3 + v1)) ? ((3 - i5) != (i4 ? i4 : i5)) : ((i4 && i4) / 6));
+                v2 = (((v2 >= v2) >= (v1 >= i5)) + ((43 ? v1 : i5) ? (21 ? v1 : v2) : (v0 * i5)));
+            }
+            v0 = (((v1 || v1) - (45 || v2)) - ((i4 * i4) >= (v3 ? 83 : v1)));
+            a0[14] = (((i4 >= 64) - (a1[1][10] ? v0 : i4)) == ((5 ? v1 : 34) >= (a0[4] > v0)));
+            i4 = i4 + 1;
+        }
+    }
+    v1 = (((v3 % 7) * (v2 <= 75)) >= ((a1[3][12] % 1) / 4));
+    return (((a1[2][12] > v0) || (v2 == a0[6])) * ((a1[1][11] / 1) ? (v1 <= 4) : (v2 ? v2 : v0)));
+}
+int f1() {
+    int v0 = 67;
+    int v1 = 80;
+    int v2 = 59;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[12] = (((v0 >= a1[1][11]) - (i0 >= v1)) / 4);
+            v0 = (((v1 && v3) == (16 % 6)) > ((i0 < v0) >= (v1 >= a0[0])));
+            {
+                int i1 = 0;
+                do {
+                    a1[2][15] = (((a1[2][4] > v2) / 3) != ((v3 / 6) || (75 % 2)));
+                    v3 = (((18 && 58) && (a1[0][10] ? 72 : 10)) + ((v2 != 66) || (53 >= i0)));
+                    v0 = (((i0 * i1) * (93 > 12)) / 6);
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a1[1][3] = (((a1[0][10] || v1) != (51 >= a1[0][7])) * ((v3 >= v3) - (v0 != v1)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v1 = (((v3 <= a0[11]) == (v0 != v0)) * ((a0[11] / 4) <= (a1[3][10] != v2)));
+            v1 = (((i3 / 2) * (v3 != a0[10])) - ((28 * v1) % 7));
+            v0 = (((a0[1] >= i2) && (22 % 5)) - ((a0[4] || 92) <= (11 == 26)));
+        }
+        a0[8] = (((34 || v0) ? (88 != v0) : (15 < v1)) <= ((i2 * a1[2][4]) - (a0[2] && v2)));
+        v3 = (((18 != v2) || (a0[7] % 6)) < ((v1 < v0) ? (a0[13] / 2) : (a1[2][0] + 98)));
+    }
+    v3 = (((21 % 1) % 3) ? ((53 / 1) && (v2 - 45)) : ((v0 ? v1 : v1) - (a1[3][14] ? 37 : 79)));
+    {
+        int i4 = 0;
+        do {
+            if ((v3 && v2) > 59) break;
+            v2 = (((82 + v0) < (80 && 81)) != ((v3 && v0) + (77 < a1[0][3])));
+            {
+                int i5 = 0;
+                do {
+                    if ((21 ? v3 : a0[8]) > 51) break;
+                    a0[0] = (((97 >= v3) <= (v2 - 75)) != ((i5 > v0) >= (i5 - i5)));
+                    a0[9] = (((v3 % 4) || (i4 == v3)) - ((v0 / 7) % 7));
+                    v0 = (((v3 ? 50 : 61) % 3) <= ((v3 ? i5 : v0) <= (v3 * v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v3 = (((a1[1][0] <= 86) ? (64 < i4) : (68 != 65)) == ((i4 - v3) && (v1 < v2)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    if ((((v0 >= 5) * (a1[2][7] % 8)) % 4)) {
+        v2 = (((v1 % 3) * (14 > a0[0])) >= ((v0 ? 83 : 27) <= (v0 < v1)));
+        v3 = (((a1[0][7] == v0) + (v2 * a1[3][6])) >= ((40 >= 17) % 5));
+        v3 = (((80 < v2) - (v1 * 38)) || ((52 <= a0[14]) % 8));
+    } else {
+        a1[2][2] = (((v1 == a1[0][7]) || (92 && v0)) + ((v1 && a1[1][11]) || (v1 < 23)));
+        v3 = (((v2 >= v1) <= (v3 || a1[0][14])) >= ((39 <= a0[1]) % 8));
+        v3 = (((v3 ? v3 : 17) && (a1[2][12] >= 84)) < ((v3 * v0) <= (v3 > v1)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v0 ? 86 : i6) > 50) break;
+            {
+                int i7 = 0;
+                do {
+                    if ((a1[0][6] == v0) > 51) break;
+                    a0[3] = (((i6 > a0[15]) * (v2 ? i6 : a1[3][8])) || ((v3 + 33) + (98 % 7)));
+                    v0 = (((v0 - 14) % 2) / 3);
+                    v3 = (((v3 + v2) ? (v0 >= a0[1]) : (a0[11] >= i6)) * ((v2 ? v0 : v2) * (v1 >= a0[4])));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            v3 = (((a1[1][7] ? a1[0][15] : v0) - (a0[9] == 74)) || ((v1 > 9) > (17 ? 52 : i6)));
+            v3 = (((v3 || a0[6]) / 1) ? ((v0 ? 88 : a0[0]) >= (v0 == v0)) : ((v2 || v3) - (a0[14] == v3)));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        v0 = (((v1 ? 27 : v0) >= (v2 < i8)) >= ((86 < 35) + (v0 + a0[13])));
+        for (int i9 = 0; i9 < 3; i9 = i9 + 1) {
+            a1[2][3] = (((a1[1][12] >= v2) >= (v0 && a0[10])) + ((a1[2][6] <= 48) >= (i9 * v0)));
+            v3 = (((v3 ? a0[4] : i9) + (i9 - 55)) ? ((85 * v0) + (52 > a0[6])) : ((v0 >= 52) * (a1[1][14] > a0[15])));
+            a0[12] = (((74 + v1) != (31 || a0[1])) == ((v0 + 51) / 1));
+        }
+        v1 = (((41 * v3) && (v3 ? 17 : 73)) ? ((a0[12] ? 23 : a0[4]) && (i8 ? 86 : 59)) : ((a1[0][14] ? v2 : a0[10]) <= (a0[9] >= v0)));
+    }
+    if ((((v1 != v3) % 4) % 1)) {
+        v1 = (((v1 > a1[1][5]) == (37 > 29)) * ((a1[2][10] / 9) - (54 < 48)));
+        v0 = (((65 / 6) < (a0[13] / 4)) == ((a0[8] >= v1) ? (v1 ? 54 : a0[14]) : (v1 + a1[0][10])));
+        v3 = (((v1 >= v2) != (v1 - 3)) == ((3 <= v2) || (v1 <= 52)));
+    } else {
+        v2 = (((v0 ? v3 : v2) != (a0[9] / 7)) || ((a1[3][12] < a0[12]) / 1));
+        v1 = (((47 == v0) ? (v1 == a1[3][4]) : (v1 > 60)) && ((v0 % 3) < (a0[9] < 12)));
+        v0 = (((a0[11] == v0) <= (0 ? a0[10] : v1)) <= ((v0 <= a0[12]) ? (v2 <= 42) : (v2 <= v0)));
+    }
+    if ((((v2 != v1) * (v2 + v1)) > ((a0[2] && a1[1][9]) >= (v2 != v1)))) {
+        a1[3][10] = (((v2 >= a1[2][11]) ? (v2 / 5) : (a0[0] * v2)) ? ((79 >= a1[2][8]) > (17 + v2)) : ((v3 == 62) < (v0 % 4)));
+        v2 = (((v0 == a1[0][12]) || (74 ? a1[3][9] : 71)) > ((v0 || v1) / 6));
+        v3 = (((v0 != a1[2][2]) % 4) ? ((a0[15] >= v1) >= (a1[0][14] / 1)) : ((v1 <= v1) / 1));
+    } else {
+        v3 = (((v1 >= 75) > (v2 + a0[10])) != ((a0[1] > 78) < (97 / 6)));
+        v3 = (((v1 != v3) >= (a0[11] <= a0[13])) - ((v0 ? v2 : 5) + (v2 >= v2)));
+        v0 = (((v0 <= v2) / 6) < ((v2 == 6) % 2));
+    }
+    return (((v1 * v1) + (v2 || 57)) ? ((v0 > a0[14]) ? (20 || a0[12]) : (v0 - a0[8])) : ((a0[11] <= a0[12]) * (a1[2][3] <= v0)));
+}
+int f2() {
+    int v0 = 0;
+    int v1 = 14;
+    int v2 = 33;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a0[5] <= v0) > 71) break;
+            v2 = (((58 * v3) / 6) > ((a0[10] && v3) ? (42 + i0) : (v3 > 9)));
+            {
+                int i1 = 0;
+                do {
+                    a0[6] = (((i1 ? v3 : v3) / 2) ? ((a0[13] ? v0 : v3) ? (6 >= 83) : (a0[3] != v0)) : ((v3 && i0) && (i0 * a1[0][2])));
+                    v2 = (((a0[10] > a0[6]) % 3) + ((a1[0][13] ? 2 : a0[5]) ? (v0 <= a1[3][9]) : (v0 - i0)));
+                    v0 = (((v2 / 2) < (i1 != a0[3])) % 5);
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v2 = (((v2 < v1) ? (v1 == v2) : (50 ? v1 : v2)) * ((a0[0] - a0[0]) <= (v2 + a1[0][13])));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v1 = (((v1 != 47) - (a1[2][7] % 9)) >= ((i2 ? a1[2][15] : v2) > (v3 + 84)));
+        a0[14] = (((v3 >= 26) || (v2 + i2)) != ((24 > a1[1][1]) - (39 - v0)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v0 = (((48 >= v0) / 8) % 9);
+                v1 = (((v0 ? 36 : 88) / 8) + ((v0 <= a0[3]) && (3 % 8)));
+                a0[12] = (((a0[8] ? v1 : 85) || (64 < v2)) != ((i2 * 11) ? (v0 <= i2) : (17 / 2)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v3 = (((a1[2][12] / 3) + (34 ? v3 : 92)) >= ((74 <= v2) >= (v2 * 91)));
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            v1 = (((i4 < a1[1][7]) < (a1[2][15] <= i5)) < ((v0 && v1) < (a1[0][14] + v3)));
+            a1[1][4] = (((a1[2][5] + 56) != (v3 >= 25)) ? ((v1 + i5) < (a1[2][4] < v2)) : ((a0[2] > v2) ? (a1[2][9] || 99) : (a1[2][10] <= v0)));
+            v1 = (((55 - 26) && (v2 * v2)) * ((v1 * a0[8]) && (7 ? a1[1][11] : i4)));
+        }
+        v1 = (((a1[2][15] >= i4) ? (a1[3][12] >= v2) : (i4 / 2)) < ((i4 < i4) * (v2 || a1[1][7])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            a1[2][14] = (((v3 && 56) && (v2 ? 85 : v1)) - ((a0[7] >= 28) ? (92 || v2) : (a0[4] ? 59 : a1[2][7])));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((a1[2][8] ? 52 : 27) >= (a0[9] || 56)) > ((a0[0] ? v3 : 51) >= (a0[12] < 6)));
+                    a1[2][5] = (((a1[3][5] - a1[1][3]) % 6) && ((71 * i6) + (i6 ? a0[14] : v0)));
+                    v2 = (((v0 > 20) * (v0 * v2)) + ((a1[0][13] != v2) || (a1[3][2] && 32)));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            v3 = (((v3 * a1[1][8]) && (i6 == i6)) + ((i6 || v1) >= (a1[2][3] >= 78)));
+            i6 = i6 + 1;
+        }
+    }
+    v2 = (((a1[0][14] < v2) > (v0 != v2)) / 9);
+    if ((((v1 == v1) * (v3 && a0[7])) ? ((v0 + a0[6]) * (v0 <= v2)) : ((a0[7] ? v0 : 87) - (v3 % 3)))) {
+        v0 = (((v1 / 3) && (v3 == v0)) == ((v3 / 6) % 8));
+        v0 = (((a1[1][11] <= a1[3][3]) && (v0 ? v2 : a0[11])) <= ((a0[14] * a1[3][7]) || (v3 ? a1[0][8] : 20)));
+        v1 = (((v0 != 16) && (62 - a1[0][13])) <= ((a1[3][14] / 4) < (a1[2][9] + v2)));
+    } else {
+        v3 = (((a1[2][8] < a1[2][10]) ? (a1[2][7] < v3) : (v0 > 56)) + ((a0[3] / 6) != (a0[15] || a0[13])));
+        v3 = (((v3 ? v0 : a0[3]) && (80 + v2)) * ((v1 ? v2 : v0) > (v3 != v3)));
+        a1[2][14] = (((v3 >= v0) != (v1 != a1[0][7])) % 2);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            v2 = (((a0[0] - v0) && (97 / 7)) * ((46 <= a0[9]) < (i8 * 87)));
+            v0 = (((a1[2][10] - 43) / 9) && ((a0[3] == v2) > (43 * v3)));
+            for (int i9 = 0; i9 < 7; i9 = i9 + 1) {
+                v0 = (((13 < 21) && (i8 / 8)) / 2);
+                v3 = (((v2 <= 5) && (v2 && v1)) ? ((v1 / 6) / 5) : ((i8 + 43) < (40 - 76)));
+                v3 = (((30 + 22) > (a1[0][7] + v0)) >= ((43 || i9) <= (a0[9] || v2)));
+            }
+            i8 = i8 + 1;
+        }
+    }
+    {
+        int i10 = 0;
+        while (i10 < 6) {
+            v3 = (((v2 <= a1[1][9]) && (a0[8] / 8)) || ((a0[8] <= v2) || (v3 <= v3)));
+            v1 = (((v3 <= i10) != (57 || 79)) ? ((a1[1][8] / 2) * (v0 + v3)) : ((v0 ? v2 : 39) != (v3 != i10)));
+            {
+                int i11 = 0;
+                while (i11 < 4) {
+                    v3 = (((v0 <= i11) && (83 == v3)) == ((i10 != v3) - (i10 / 2)));
+                    v1 = (((44 > v3) / 6) != ((a1[3][1] < a0[14]) || (33 >= 24)));
+                    v0 = (((v1 ? v2 : i11) / 3) || ((i11 != 80) <= (i10 || a1[2][2])));
+                    i11 = i11 + 1;
+                }
+            }
+            i10 = i10 + 1;
+        }
+    }
+    for (int i12 = 0; i12 < 2; i12 = i12 + 1) {
+        if ((7 >= 27) > 57) break;
+        v3 = (((v2 * 25) == (v1 == v0)) % 5);
+        for (int i13 = 0; i13 < 7; i13 = i13 + 1) {
+            v2 = (((a1[2][11] ? a1[0][15] : v2) % 8) * ((i12 || 36) / 7));
+            a1[0][5] = (((a0[6] || v2) - (a0[5] - v3)) == ((94 == v0) ? (v1 + i12) : (v2 * 40)));
+            v1 = (((a1[2][2] % 2) && (i12 / 5)) - ((42 * a0[3]) > (54 >= i12)));
+        }
+        v0 = (((3 != v3) <= (a0[1] <= a0[13])) / 4);
+    }
+    for (int i14 = 0; i14 < 8; i14 = i14 + 1) {
+        v0 = (((a1[1][8] || 12) ? (v2 + a0[4]) : (i14 / 8)) % 5);
+        v0 = (((v2 || v3) + (19 / 2)) ? ((a1[2][5] * a0[11]) * (v2 - v0)) : ((v2 && a1[1][0]) ? (a0[0] ? v2 : 27) : (a0[2] == 3)));
+        {
+            int i15 = 0;
+            while (i15 < 3) {
+                v3 = (((v1 ? v1 : v2) || (i14 % 4)) ? ((95 * v0) ? (82 % 5) : (i15 ? v2 : v3)) : ((v1 == 39) == (a0[8] || i14)));
+                a1[2][7] = (((21 <= v1) * (a0[5] && a0[7])) > ((a1[1][9] && a1[1][12]) % 9));
+                v2 = (((v2 % 3) && (v2 ? v2 : v1)) * ((64 > a0[3]) * (i14 <= a0[8])));
+                i15 = i15 + 1;
+            }
+        }
+    }
+    return (((v1 != a0[1]) > (v2 % 9)) >= ((v2 != v0) || (93 % 2)));
+}
+int f3() {
+    int v0 = 97;
+    int v1 = 48;
+    int v2 = 53;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[5] || v0) - (v2 || v2)) <= ((v1 != v3) ? (a1[2][9] + v0) : (v3 >= v3)))) {
+        v2 = (((45 ? 11 : 23) + (a1[1][10] ? a1[0][14] : 9)) % 5);
+        v3 = (((78 != v3) * (a0[1] * a0[15])) ? ((v1 % 6) && (v2 <= 17)) : ((v3 < 38) + (v3 <= 12)));
+        v3 = (((70 != v2) || (a1[3][4] > v1)) ? ((a0[11] == a1[2][0]) ? (57 > a0[5]) : (v2 != a0[4])) : ((v3 / 6) ? (a0[3] == a1[3][7]) : (55 != a1[2][0])));
+    } else {
+        a0[13] = (((a0[13] % 7) == (a1[2][1] != v2)) + ((31 + v3) < (v3 || v3)));
+        a0[5] = (((a0[3] != 8) == (v0 != a1[1][6])) % 7);
+        v1 = (((v3 + 32) ? (v1 / 4) : (v0 - 10)) * ((v1 || a0[12]) - (v1 && 35)));
+    }
+    v3 = (((v0 ? v2 : a1[0][11]) - (v2 - a0[13])) || ((v0 < v1) && (a0[0] == v1)));
+    if ((((a1[3][10] == v2) != (v3 ? v2 : v3)) % 7)) {
+        a1[2][15] = (((v1 != v3) && (v1 / 5)) < ((a1[2][8] == v3) % 8));
+        a1[3][5] = (((4 != 19) != (v0 == v0)) % 8);
+        v0 = (((4 - v0) == (a1[2][13] ? a1[1][4] : v0)) ? ((a0[10] != v1) == (47 % 3)) : ((a1[1][3] ? v2 : v2) == (16 >= 0)));
+    } else {
+        v2 = (((75 >= 51) ? (v1 && v0) : (a0[2] == v1)) && ((a0[6] * a1[2][9]) ? (v0 && v2) : (v0 <= a0[11])));
+        v3 = (((a0[4] ? v3 : a0[12]) > (a1[1][0] % 8)) || ((a0[2] - v2) / 3));
+        v2 = (((v2 || v0) >= (a1[3][8] == 63)) != ((v1 < v2) && (v1 % 4)));
+    }
+    v1 = (((a1[3][0] > v1) == (v2 - a1[2][6])) + ((v1 * v2) - (a0[12] % 3)));
+    if ((((v0 % 5) / 2) && ((30 + v1) - (a1[1][7] == 20)))) {
+        v0 = (((93 > v1) ? (v3 - 66) : (a1[2][1] ? v1 : v0)) + ((v2 >= v0) > (89 >= v0)));
+        v2 = (((39 % 6) * (v1 * v0)) - ((v2 <= v0) + (v1 + v3)));
+        v1 = (((a0[6] >= v0) * (a0[11] || v0)) - ((v3 || v3) / 9));
+    } else {
+        a0[5] = (((a0[6] ? 89 : a1[1][4]) / 8) ? ((a0[3] / 6) - (4 * v2)) : ((58 || v3) % 7));
+        a1[2][10] = (((97 < 15) && (v3 % 4)) > ((v0 != v2) + (v0 + 50)));
+        v2 = (((v2 - v2) >= (a0[4] * a0[10])) ? ((v1 / 9) * (81 <= v3)) : ((91 != a1[2][9]) > (v3 != a0[6])));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[12] = (((v0 < v2) - (a0[4] + v3)) || ((i0 <= a0[8]) != (v3 != 78)));
+            v3 = (((a0[1] <= 9) || (v3 ? i0 : 73)) > ((a1[2][1] == v3) * (i0 / 1)));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((39 * 67) < (v3 + i1)) == ((v2 % 5) >= (v3 + v1)));
+                    a1[0][3] = (((a1[0][10] != i1) || (i0 <= 4)) && ((a0[4] < i1) <= (13 ? 18 : v2)));
+                    v2 = (((v2 > v2) == (a1[0][6] / 7)) > ((i1 != a0[0]) + (44 >= a1[2][0])));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v2 = (((65 || 54) <= (a0[13] >= v1)) - ((10 > a0[14]) && (90 ? 42 : a1[2][2])));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v0 = (((53 / 1) == (21 >= v3)) >= ((8 % 5) + (v0 || 75)));
+                    v2 = (((a1[1][10] ? 11 : i3) * (a1[2][8] ? a1[0][5] : 88)) == ((v3 && 25) > (a0[2] == v2)));
+                    v3 = (((74 == v3) && (i3 * i2)) ? ((i3 && a0[10]) % 7) : ((a1[2][8] ? a1[3][9] : 14) * (i3 != a1[1][7])));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v1 > i2) - (27 >= i2)) % 6);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v3 >= 17) / 7) + ((a0[2] ? 98 : v1) != (9 && a0[2])))) {
+        v0 = (((a1[3][8] ? v3 : v2) - (v1 >= v3)) - ((v0 < v3) / 3));
+        v1 = (((v3 && a0[13]) * (v3 != 34)) / 9);
+        a1[0][15] = (((a1[1][4] > a0[14]) - (v3 ? v0 : v3)) == ((a0[8] / 2) != (v2 < 52)));
+    } else {
+        a1[2][15] = (((v3 < 1) ? (48 && v2) : (v3 < 35)) && ((20 && v3) + (28 + 27)));
+        v2 = (((46 || v1) % 4) && ((v3 >= v0) - (a1[3][9] >= v2)));
+        v3 = (((a0[5] * v1) + (98 * a0[14])) ? ((v1 && 25) != (v1 || a0[5])) : ((a0[5] || 65) != (v1 == 47)));
+    }
+    if ((((v1 < 62) && (a0[12] || a1[3][3])) * ((a0[4] ? v0 : v2) < (v3 >= v1)))) {
+        v2 = (((a0[0] ? v2 : v0) ? (21 + 56) : (a0[6] > v1)) * ((a1[0][10] || v0) + (a1[2][12] >= v3)));
+        v3 = (((85 - v0) / 6) ? ((60 != a1[1][15]) > (v1 * v0)) : ((a0[4] ? v3 : v1) / 7));
+        v1 = (((a1[0][10] ? 4 : a0[4]) != (21 + 8)) * ((31 || a0[1]) == (v1 == v2)));
+    } else {
+        v0 = (((28 % 7) <= (v1 - v1)) || ((a1[0][5] > 23) - (a1[0][4] >= v3)));
+        a1[0][4] = (((v1 <= v3) || (v1 && v2)) != ((a1[1][3] <= v0) - (62 && v1)));
+        a1[2][14] = (((v0 == 52) < (v1 > v1)) / 9);
+    }
+    if ((((v0 || v2) - (45 <= v2)) * ((27 != 83) > (70 == 71)))) {
+        v3 = (((a1[1][13] || 14) == (v2 <= 74)) / 9);
+        v0 = (((a0[7] / 9) >= (a0[12] > 29)) < ((v0 > v1) == (v1 / 2)));
+        v0 = (((a1[2][8] >= v3) >= (v2 * v1)) == ((v3 + a1[3][10]) && (v3 / 5)));
+    } else {
+        a1[0][2] = (((v3 > 46) < (v2 >= 44)) + ((32 < a0[6]) / 2));
+        v2 = (((a0[13] + 44) || (v3 || a1[3][11])) - ((39 <= 5) >= (v3 - v2)));
+        v1 = (((a0[2] + a0[11]) - (79 != v1)) != ((a0[1] || 55) == (v2 * a1[3][8])));
+    }
+    return (((a1[3][3] < 39) ? (8 != v3) : (54 == v0)) / 3);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    s = s + f3();
+    return s;
+}
@@ -0,0 +1,527 @@
+    .file 1 "bench/kernels/array_sum.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $40000, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -40004(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 4 9
+    movq $7, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -40004(%rbp), %rcx
+    movl %eax, -40000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 3 32
+    incl -40004(%rbp)
+    .loc 1 4 9
+    movq $7, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -40004(%rbp), %rcx
+    movl %eax, -40000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_10:
+    .loc 1 3 32
+    incl -40004(%rbp)
+    .loc 1 4 9
+    movq $7, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -40004(%rbp), %rcx
+    movl %eax, -40000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_11:
+    .loc 1 3 32
+    incl -40004(%rbp)
+    .loc 1 4 9
+    movq $7, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -40004(%rbp), %rcx
+    movl %eax, -40000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 3 32
+    incl -40004(%rbp)
+.Lmain_6:
+    movslq -40004(%rbp), %rax
+    addq $3, %rax
+    cmpq $10000, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $10000, -40004(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 4 9
+    movq $7, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -40004(%rbp), %rcx
+    movl %eax, -40000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 3 32
+    incl -40004(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -40004(%rbp)
+    .loc 1 7 5
+    movq $0, %rax
+    movl %eax, -40008(%rbp)
+    jmp .Lmain_17
+    .p2align 4,,10
+.Lmain_16:
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -40012(%rbp)
+    jmp .Lmain_26
+    .p2align 4,,10
+.Lmain_25:
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_28:
+    .loc 1 8 36
+    incl -40012(%rbp)
+.Lmain_26:
+    movslq -40012(%rbp), %rax
+    addq $3, %rax
+    cmpq $10000, %rax
+    jl .Lmain_25
+.Lmain_27:
+    cmpl $10000, -40012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_23
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    jmp .Lmain_27
+.Lmain_23:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 7 30
+    incl -40008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -40012(%rbp)
+    jmp .Lmain_38
+    .p2align 4,,10
+.Lmain_37:
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 8 36
+    incl -40012(%rbp)
+.Lmain_38:
+    movslq -40012(%rbp), %rax
+    addq $3, %rax
+    cmpq $10000, %rax
+    jl .Lmain_37
+.Lmain_39:
+    cmpl $10000, -40012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_35
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    jmp .Lmain_39
+.Lmain_35:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 7 30
+    incl -40008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -40012(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 8 36
+    incl -40012(%rbp)
+.Lmain_50:
+    movslq -40012(%rbp), %rax
+    addq $3, %rax
+    cmpq $10000, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $10000, -40012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 7 30
+    incl -40008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -40012(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 8 36
+    incl -40012(%rbp)
+.Lmain_61:
+    movslq -40012(%rbp), %rax
+    addq $3, %rax
+    cmpq $10000, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $10000, -40012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 7 30
+    incl -40008(%rbp)
+.Lmain_17:
+    movslq -40008(%rbp), %rax
+    addq $3, %rax
+    cmpq $500, %rax
+    jl .Lmain_16
+.Lmain_18:
+    cmpl $500, -40008(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_14
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -40012(%rbp)
+    jmp .Lmain_72
+    .p2align 4,,10
+.Lmain_71:
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_75:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_76:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_77:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_74:
+    .loc 1 8 36
+    incl -40012(%rbp)
+.Lmain_72:
+    movslq -40012(%rbp), %rax
+    addq $3, %rax
+    cmpq $10000, %rax
+    jl .Lmain_71
+.Lmain_73:
+    cmpl $10000, -40012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 9 13
+    movslq -40012(%rbp), %rcx
+    movslq -40000(%rbp,%rcx,4), %rax
+    addl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 8 36
+    incl -40012(%rbp)
+    jmp .Lmain_73
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -40004(%rbp)
+    addq $0, %rsp
+.Lmain_15:
+    .loc 1 7 30
+    incl -40008(%rbp)
+    jmp .Lmain_18
+.Lmain_14:
+    addq $0, %rsp
+    .loc 1 13 5
+    movq $256, %rax
+    push %rax
+    movslq -40004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,335 @@
+    .file 1 "bench/kernels/bw_char.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $16000000, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16000004(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 4 9
+    movq $101, %rax
+    push %rax
+    movslq -16000004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movsbq %al, %rax
+    movslq -16000004(%rbp), %rcx
+    movb %al, -16000000(%rbp,%rcx,1)
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 3 35
+    incl -16000004(%rbp)
+    .loc 1 4 9
+    movq $101, %rax
+    push %rax
+    movslq -16000004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movsbq %al, %rax
+    movslq -16000004(%rbp), %rcx
+    movb %al, -16000000(%rbp,%rcx,1)
+    addq $0, %rsp
+.Lmain_10:
+    .loc 1 3 35
+    incl -16000004(%rbp)
+    .loc 1 4 9
+    movq $101, %rax
+    push %rax
+    movslq -16000004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movsbq %al, %rax
+    movslq -16000004(%rbp), %rcx
+    movb %al, -16000000(%rbp,%rcx,1)
+    addq $0, %rsp
+.Lmain_11:
+    .loc 1 3 35
+    incl -16000004(%rbp)
+    .loc 1 4 9
+    movq $101, %rax
+    push %rax
+    movslq -16000004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movsbq %al, %rax
+    movslq -16000004(%rbp), %rcx
+    movb %al, -16000000(%rbp,%rcx,1)
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 3 35
+    incl -16000004(%rbp)
+.Lmain_6:
+    movslq -16000004(%rbp), %rax
+    addq $3, %rax
+    cmpq $16000000, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $16000000, -16000004(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 4 9
+    movq $101, %rax
+    push %rax
+    movslq -16000004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movsbq %al, %rax
+    movslq -16000004(%rbp), %rcx
+    movb %al, -16000000(%rbp,%rcx,1)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 3 35
+    incl -16000004(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $0, %rax
+    movq %rax, -16000008(%rbp)
+    .loc 1 7 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16000012(%rbp)
+    .loc 1 8 9
+    movq $0, %rax
+    movl %eax, -16000016(%rbp)
+    jmp .Lmain_22
+    .p2align 4,,10
+.Lmain_21:
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_26:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_27:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+.Lmain_22:
+    movslq -16000016(%rbp), %rax
+    addq $3, %rax
+    cmpq $16000000, %rax
+    jl .Lmain_21
+.Lmain_23:
+    cmpl $16000000, -16000016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_19
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    jmp .Lmain_23
+.Lmain_19:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_16:
+    .loc 1 7 28
+    incl -16000012(%rbp)
+    .loc 1 8 9
+    movq $0, %rax
+    movl %eax, -16000016(%rbp)
+    jmp .Lmain_34
+    .p2align 4,,10
+.Lmain_33:
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_38:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_39:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+.Lmain_34:
+    movslq -16000016(%rbp), %rax
+    addq $3, %rax
+    cmpq $16000000, %rax
+    jl .Lmain_33
+.Lmain_35:
+    cmpl $16000000, -16000016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_31
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    jmp .Lmain_35
+.Lmain_31:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_28:
+    .loc 1 7 28
+    incl -16000012(%rbp)
+    .loc 1 8 9
+    movq $0, %rax
+    movl %eax, -16000016(%rbp)
+    jmp .Lmain_45
+    .p2align 4,,10
+.Lmain_44:
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_49:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_50:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+.Lmain_45:
+    movslq -16000016(%rbp), %rax
+    addq $3, %rax
+    cmpq $16000000, %rax
+    jl .Lmain_44
+.Lmain_46:
+    cmpl $16000000, -16000016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_42
+    .loc 1 9 13
+    movslq -16000016(%rbp), %rcx
+    movsbq -16000000(%rbp,%rcx,1), %rax
+    addq %rax, -16000008(%rbp)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 8 39
+    incl -16000016(%rbp)
+    jmp .Lmain_46
+.Lmain_42:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_15:
+    .loc 1 7 28
+    incl -16000012(%rbp)
+.Lmain_14:
+    addq $8, %rsp
+    .loc 1 12 5
+    movq $256, %rax
+    push %rax
+    movq -16000008(%rbp), %rax
+    pop %rbx
+    cqo
+    idivq %rbx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
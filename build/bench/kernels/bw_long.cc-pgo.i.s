@@ -0,0 +1,179 @@
+    .file 1 "bench/kernels/bw_long.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    incq .Lcounts.main+0(%rip)
+    .loc 1 2 5
+    subq $128000000, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -128000004(%rbp)
+.Lmain_1:
+    cmpl $16000000, -128000004(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_2
+    incq .Lcounts.main+16(%rip)
+    jmp .Lmain_3
+.Lmain_2:
+    incq .Lcounts.main+8(%rip)
+    .loc 1 4 9
+    movq $101, %rax
+    push %rax
+    movslq -128000004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -128000004(%rbp), %rcx
+    movq %rax, -128000000(%rbp,%rcx,8)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 3 35
+    incl -128000004(%rbp)
+    jmp .Lmain_1
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $0, %rax
+    movq %rax, -128000008(%rbp)
+    .loc 1 7 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -128000012(%rbp)
+.Lmain_5:
+    cmpl $3, -128000012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_6
+    incq .Lcounts.main+32(%rip)
+    jmp .Lmain_7
+.Lmain_6:
+    incq .Lcounts.main+24(%rip)
+    .loc 1 8 9
+    movq $0, %rax
+    movl %eax, -128000016(%rbp)
+.Lmain_9:
+    cmpl $16000000, -128000016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_10
+    incq .Lcounts.main+48(%rip)
+    jmp .Lmain_11
+.Lmain_10:
+    incq .Lcounts.main+40(%rip)
+    .loc 1 9 13
+    movslq -128000016(%rbp), %rcx
+    movq -128000000(%rbp,%rcx,8), %rax
+    addq %rax, -128000008(%rbp)
+    addq $0, %rsp
+.Lmain_12:
+    .loc 1 8 39
+    incl -128000016(%rbp)
+    jmp .Lmain_9
+.Lmain_11:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 7 28
+    incl -128000012(%rbp)
+    jmp .Lmain_5
+.Lmain_7:
+    addq $8, %rsp
+    .loc 1 12 5
+    movq $256, %rax
+    push %rax
+    movq -128000008(%rbp), %rax
+    pop %rbx
+    cqo
+    idivq %rbx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+    .bss
+    .align 8
+.Lcounts.main:
+    .zero 56
+    .section .rodata
+.Lname.main:
+    .ascii "main"
+    .section pgo_records,"aw"
+    .align 8
+    .quad .Lcounts.main, 7, .Lname.main, 4
+    .text
+    .text
+.Lpgo.dump:
+    push %rbx
+    push %r12
+    movq $2, %rax
+    leaq .Lpgo.path(%rip), %rdi
+    movq $577, %rsi
+    movq $420, %rdx
+    syscall
+    testq %rax, %rax
+    js .Lpgo.done
+    movq %rax, %r12
+    leaq __start_pgo_records(%rip), %rbx
+.Lpgo.next:
+    leaq __stop_pgo_records(%rip), %rax
+    cmpq %rax, %rbx
+    jae .Lpgo.close
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 24(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq 16(%rbx), %rsi
+    movq 24(%rbx), %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 8(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq (%rbx), %rsi
+    movq 8(%rbx), %rdx
+    shlq $3, %rdx
+    syscall
+    addq $32, %rbx
+    jmp .Lpgo.next
+.Lpgo.close:
+    movq $3, %rax
+    movq %r12, %rdi
+    syscall
+.Lpgo.done:
+    pop %r12
+    pop %rbx
+    ret
+    .section .fini_array, "aw"
+    .align 8
+    .quad .Lpgo.dump
+    .section .rodata
+.Lpgo.path:
+    .asciz "build/bench/kernels/bw_long.cc-pgo.prof"
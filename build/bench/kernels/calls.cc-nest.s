@@ -0,0 +1,184 @@
+    .file 1 "bench/kernels/calls.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 10 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 11 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 12 5
+    movq $0, %rax
+    movl %eax, -8(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 13 9
+    push %rbx
+    push %rcx
+    push %rdx
+    call step
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    push %rax
+    movq $1, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 12 34
+    incl -8(%rbp)
+    .loc 1 13 9
+    push %rbx
+    push %rcx
+    push %rdx
+    call step
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    push %rax
+    movq $1, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lmain_10:
+    .loc 1 12 34
+    incl -8(%rbp)
+    .loc 1 13 9
+    push %rbx
+    push %rcx
+    push %rdx
+    call step
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    push %rax
+    movq $1, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lmain_11:
+    .loc 1 12 34
+    incl -8(%rbp)
+    .loc 1 13 9
+    push %rbx
+    push %rcx
+    push %rdx
+    call step
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    push %rax
+    movq $1, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 12 34
+    incl -8(%rbp)
+.Lmain_6:
+    movslq -8(%rbp), %rax
+    addq $3, %rax
+    cmpq $3000000, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $3000000, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 13 9
+    push %rbx
+    push %rcx
+    push %rdx
+    call step
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    push %rax
+    movq $1, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 12 34
+    incl -8(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $0, %rsp
+    .loc 1 15 5
+    movq $256, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+.globl step
+.type step, @function
+    .p2align 4
+step:
+    .cfi_startproc
+    .loc 1 5 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $3, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 7 5
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    subq $8, %rax
+    movslq %eax, %rax
+    jmp .Lstep_end
+    movq $0, %rax
+.Lstep_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size step, .-step
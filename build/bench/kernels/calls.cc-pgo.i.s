@@ -0,0 +1,180 @@
+    .file 1 "bench/kernels/calls.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 10 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    incq .Lcounts.main+0(%rip)
+    .loc 1 11 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 12 5
+    movq $0, %rax
+    movl %eax, -8(%rbp)
+.Lmain_1:
+    cmpl $3000000, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_2
+    incq .Lcounts.main+16(%rip)
+    jmp .Lmain_3
+.Lmain_2:
+    incq .Lcounts.main+8(%rip)
+    .loc 1 13 9
+    incq .Lcounts.main+32(%rip)
+    push %rbx
+    push %rcx
+    push %rdx
+    call step
+    pop %rdx
+    pop %rcx
+    pop %rbx
+    push %rax
+    incq .Lcounts.main+24(%rip)
+    movq $1, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 12 34
+    incl -8(%rbp)
+    jmp .Lmain_1
+.Lmain_3:
+    addq $0, %rsp
+    .loc 1 15 5
+    movq $256, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+    .bss
+    .align 8
+.Lcounts.main:
+    .zero 40
+    .section .rodata
+.Lname.main:
+    .ascii "main"
+    .section pgo_records,"aw"
+    .align 8
+    .quad .Lcounts.main, 5, .Lname.main, 4
+    .text
+.globl step
+.type step, @function
+    .p2align 4
+step:
+    .cfi_startproc
+    .loc 1 5 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    incq .Lcounts.step+0(%rip)
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $3, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 7 5
+    movslq -4(%rbp), %rax
+    imull -4(%rbp), %eax
+    movslq %eax, %rax
+    subq $8, %rax
+    movslq %eax, %rax
+    jmp .Lstep_end
+    movq $0, %rax
+.Lstep_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size step, .-step
+    .bss
+    .align 8
+.Lcounts.step:
+    .zero 8
+    .section .rodata
+.Lname.step:
+    .ascii "step"
+    .section pgo_records,"aw"
+    .align 8
+    .quad .Lcounts.step, 1, .Lname.step, 4
+    .text
+    .text
+.Lpgo.dump:
+    push %rbx
+    push %r12
+    movq $2, %rax
+    leaq .Lpgo.path(%rip), %rdi
+    movq $577, %rsi
+    movq $420, %rdx
+    syscall
+    testq %rax, %rax
+    js .Lpgo.done
+    movq %rax, %r12
+    leaq __start_pgo_records(%rip), %rbx
+.Lpgo.next:
+    leaq __stop_pgo_records(%rip), %rax
+    cmpq %rax, %rbx
+    jae .Lpgo.close
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 24(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq 16(%rbx), %rsi
+    movq 24(%rbx), %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 8(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq (%rbx), %rsi
+    movq 8(%rbx), %rdx
+    shlq $3, %rdx
+    syscall
+    addq $32, %rbx
+    jmp .Lpgo.next
+.Lpgo.close:
+    movq $3, %rax
+    movq %r12, %rdi
+    syscall
+.Lpgo.done:
+    pop %r12
+    pop %rbx
+    ret
+    .section .fini_array, "aw"
+    .align 8
+    .quad .Lpgo.dump
+    .section .rodata
+.Lpgo.path:
+    .asciz "build/bench/kernels/calls.cc-pgo.prof"
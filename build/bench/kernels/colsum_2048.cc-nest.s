@@ -0,0 +1,4104 @@
+    .file 1 "bench/kernels/colsum_2048.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $16777216, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777220(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_15:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_27:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_39
+    .p2align 4,,10
+.Lmain_38:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_39:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_50:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+.Lmain_6:
+    movslq -16777220(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $2048, -16777220(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_61:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 8 5
+    subq $8, %rsp
+    movq $0, %rax
+    movq %rax, -16777224(%rbp)
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777228(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    jmp .Lmain_77
+    .p2align 4,,10
+.Lmain_76:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_86
+    .p2align 4,,10
+.Lmain_85:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_89:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_90:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_91:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_88:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_86:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_85
+.Lmain_87:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_83
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_84:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_87
+.Lmain_83:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_80:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_98
+    .p2align 4,,10
+.Lmain_97:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_101:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_102:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_103:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_100:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_98:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_97
+.Lmain_99:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_95
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_96:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_99
+.Lmain_95:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_92:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_110
+    .p2align 4,,10
+.Lmain_109:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_113:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_114:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_112:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_110:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_109
+.Lmain_111:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_107
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_108:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_111
+.Lmain_107:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_104:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_121
+    .p2align 4,,10
+.Lmain_120:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_124:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_125:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_126:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_123:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_121:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_120
+.Lmain_122:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_118
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_119:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_122
+.Lmain_118:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_79:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+.Lmain_77:
+    movslq -16777232(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_76
+.Lmain_78:
+    cmpl $2048, -16777232(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_74
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_132
+    .p2align 4,,10
+.Lmain_131:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_135:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_136:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_137:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_134:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_132:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_131
+.Lmain_133:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_129
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_130:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_133
+.Lmain_129:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_75:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    jmp .Lmain_78
+.Lmain_74:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_71:
+    .loc 1 9 28
+    incl -16777228(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    jmp .Lmain_144
+    .p2align 4,,10
+.Lmain_143:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_153
+    .p2align 4,,10
+.Lmain_152:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_156:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_157:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_155:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_153:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_152
+.Lmain_154:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_150
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_151:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_154
+.Lmain_150:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_147:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_165
+    .p2align 4,,10
+.Lmain_164:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_168:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_169:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_170:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_167:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_165:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_164
+.Lmain_166:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_162
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_163:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_166
+.Lmain_162:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_159:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_177
+    .p2align 4,,10
+.Lmain_176:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_181:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_182:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_179:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_177:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_176
+.Lmain_178:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_174
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_175:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_178
+.Lmain_174:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_171:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_188
+    .p2align 4,,10
+.Lmain_187:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_191:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_192:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_193:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_190:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_188:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_187
+.Lmain_189:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_185
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_186:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_189
+.Lmain_185:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_146:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+.Lmain_144:
+    movslq -16777232(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_143
+.Lmain_145:
+    cmpl $2048, -16777232(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_141
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_199
+    .p2align 4,,10
+.Lmain_198:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_202:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_203:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_204:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_201:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_199:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_198
+.Lmain_200:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_196
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_197:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_200
+.Lmain_196:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_142:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    jmp .Lmain_145
+.Lmain_141:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_138:
+    .loc 1 9 28
+    incl -16777228(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    jmp .Lmain_211
+    .p2align 4,,10
+.Lmain_210:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_220
+    .p2align 4,,10
+.Lmain_219:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_223:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_224:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_225:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_222:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_220:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_219
+.Lmain_221:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_217
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_218:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_221
+.Lmain_217:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_214:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_232
+    .p2align 4,,10
+.Lmain_231:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_235:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_236:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_237:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_232:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_231
+.Lmain_233:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_229
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_230:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_233
+.Lmain_229:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_226:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_244
+    .p2align 4,,10
+.Lmain_243:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_247:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_248:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_249:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_246:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_244:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_243
+.Lmain_245:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_241
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_242:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_245
+.Lmain_241:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_238:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_255
+    .p2align 4,,10
+.Lmain_254:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_258:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_259:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_260:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_257:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_255:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_254
+.Lmain_256:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_252
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_253:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_256
+.Lmain_252:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_213:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+.Lmain_211:
+    movslq -16777232(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_210
+.Lmain_212:
+    cmpl $2048, -16777232(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_208
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_266
+    .p2align 4,,10
+.Lmain_265:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_269:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_270:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_271:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_266:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_265
+.Lmain_267:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_263
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_264:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_267
+.Lmain_263:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_209:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    jmp .Lmain_212
+.Lmain_208:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_205:
+    .loc 1 9 28
+    incl -16777228(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    jmp .Lmain_277
+    .p2align 4,,10
+.Lmain_276:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_286
+    .p2align 4,,10
+.Lmain_285:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_289:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_290:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_291:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_288:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_286:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_285
+.Lmain_287:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_283
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_284:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_287
+.Lmain_283:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_280:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_298
+    .p2align 4,,10
+.Lmain_297:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_301:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_302:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_303:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_300:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_298:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_297
+.Lmain_299:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_295
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_296:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_299
+.Lmain_295:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_292:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_310
+    .p2align 4,,10
+.Lmain_309:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_313:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_314:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_315:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_312:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_310:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_309
+.Lmain_311:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_307
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_308:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_311
+.Lmain_307:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_304:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_321
+    .p2align 4,,10
+.Lmain_320:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_324:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_325:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_326:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_323:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_321:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_320
+.Lmain_322:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_318
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_319:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_322
+.Lmain_318:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_279:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+.Lmain_277:
+    movslq -16777232(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_276
+.Lmain_278:
+    cmpl $2048, -16777232(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_274
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_332
+    .p2align 4,,10
+.Lmain_331:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_335:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_336:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_337:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_334:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+.Lmain_332:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_331
+.Lmain_333:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_329
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777232(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777232(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_330:
+    .loc 1 11 39
+    incl -16777236(%rbp)
+    jmp .Lmain_333
+.Lmain_329:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_275:
+    .loc 1 10 35
+    incl -16777232(%rbp)
+    jmp .Lmain_278
+.Lmain_274:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 9 28
+    incl -16777228(%rbp)
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 16 5
+    movq $251, %rax
+    push %rax
+    movq -16777224(%rbp), %rax
+    pop %rbx
+    cqo
+    idivq %rbx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
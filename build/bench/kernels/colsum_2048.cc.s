@@ -0,0 +1,3839 @@
+    .file 1 "bench/kernels/colsum_2048.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $16777216, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777220(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_15:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_27:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_39
+    .p2align 4,,10
+.Lmain_38:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_39:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_50:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+.Lmain_6:
+    movslq -16777220(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $2048, -16777220(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 4 9
+    movq $0, %rax
+    movl %eax, -16777224(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+.Lmain_61:
+    movslq -16777224(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $2048, -16777224(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 5 13
+    movslq -16777220(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -16777224(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777220(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777224(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 4 35
+    incl -16777224(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 3 31
+    incl -16777220(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 8 5
+    subq $8, %rsp
+    movq $0, %rax
+    movq %rax, -16777224(%rbp)
+    .loc 1 9 5
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777228(%rbp)
+    jmp .Lmain_72
+    .p2align 4,,10
+.Lmain_71:
+    .loc 1 9 5
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_86
+    .p2align 4,,10
+.Lmain_85:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_89:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_90:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_91:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_88:
+    incl -16777236(%rbp)
+.Lmain_86:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_85
+.Lmain_87:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_83
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_84:
+    incl -16777236(%rbp)
+    jmp .Lmain_87
+.Lmain_83:
+    addq $8, %rsp
+.Lmain_80:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_98
+    .p2align 4,,10
+.Lmain_97:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_101:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_102:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_103:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_100:
+    incl -16777236(%rbp)
+.Lmain_98:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_97
+.Lmain_99:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_95
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_96:
+    incl -16777236(%rbp)
+    jmp .Lmain_99
+.Lmain_95:
+    addq $8, %rsp
+.Lmain_92:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_110
+    .p2align 4,,10
+.Lmain_109:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_113:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_114:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_115:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_112:
+    incl -16777236(%rbp)
+.Lmain_110:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_109
+.Lmain_111:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_107
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_108:
+    incl -16777236(%rbp)
+    jmp .Lmain_111
+.Lmain_107:
+    addq $8, %rsp
+.Lmain_104:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_121
+    .p2align 4,,10
+.Lmain_120:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_124:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_125:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_126:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_123:
+    incl -16777236(%rbp)
+.Lmain_121:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_120
+.Lmain_122:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_118
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_119:
+    incl -16777236(%rbp)
+    jmp .Lmain_122
+.Lmain_118:
+    addq $8, %rsp
+.Lmain_79:
+    incl -16777232(%rbp)
+.Lmain_78:
+    addq $0, %rsp
+.Lmain_75:
+    incl -16777228(%rbp)
+    .loc 1 9 5
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_138
+    .p2align 4,,10
+.Lmain_137:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_141:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_142:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_143:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_140:
+    incl -16777236(%rbp)
+.Lmain_138:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_137
+.Lmain_139:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_135
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_136:
+    incl -16777236(%rbp)
+    jmp .Lmain_139
+.Lmain_135:
+    addq $8, %rsp
+.Lmain_132:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_150
+    .p2align 4,,10
+.Lmain_149:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_153:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_154:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_155:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_152:
+    incl -16777236(%rbp)
+.Lmain_150:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_149
+.Lmain_151:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_147
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_148:
+    incl -16777236(%rbp)
+    jmp .Lmain_151
+.Lmain_147:
+    addq $8, %rsp
+.Lmain_144:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_162
+    .p2align 4,,10
+.Lmain_161:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_165:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_166:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_167:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_164:
+    incl -16777236(%rbp)
+.Lmain_162:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_161
+.Lmain_163:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_159
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_160:
+    incl -16777236(%rbp)
+    jmp .Lmain_163
+.Lmain_159:
+    addq $8, %rsp
+.Lmain_156:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_173
+    .p2align 4,,10
+.Lmain_172:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_176:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_177:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_178:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_175:
+    incl -16777236(%rbp)
+.Lmain_173:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_172
+.Lmain_174:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_170
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_171:
+    incl -16777236(%rbp)
+    jmp .Lmain_174
+.Lmain_170:
+    addq $8, %rsp
+.Lmain_131:
+    incl -16777232(%rbp)
+.Lmain_130:
+    addq $0, %rsp
+.Lmain_127:
+    incl -16777228(%rbp)
+    .loc 1 9 5
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_190
+    .p2align 4,,10
+.Lmain_189:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_193:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_194:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_195:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_192:
+    incl -16777236(%rbp)
+.Lmain_190:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_189
+.Lmain_191:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_187
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_188:
+    incl -16777236(%rbp)
+    jmp .Lmain_191
+.Lmain_187:
+    addq $8, %rsp
+.Lmain_184:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_202
+    .p2align 4,,10
+.Lmain_201:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_205:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_206:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_207:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_204:
+    incl -16777236(%rbp)
+.Lmain_202:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_201
+.Lmain_203:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_199
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_200:
+    incl -16777236(%rbp)
+    jmp .Lmain_203
+.Lmain_199:
+    addq $8, %rsp
+.Lmain_196:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_214
+    .p2align 4,,10
+.Lmain_213:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_217:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_218:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_219:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_216:
+    incl -16777236(%rbp)
+.Lmain_214:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_213
+.Lmain_215:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_211
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_212:
+    incl -16777236(%rbp)
+    jmp .Lmain_215
+.Lmain_211:
+    addq $8, %rsp
+.Lmain_208:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_225
+    .p2align 4,,10
+.Lmain_224:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_228:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_229:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_230:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_227:
+    incl -16777236(%rbp)
+.Lmain_225:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_224
+.Lmain_226:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_222
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_223:
+    incl -16777236(%rbp)
+    jmp .Lmain_226
+.Lmain_222:
+    addq $8, %rsp
+.Lmain_183:
+    incl -16777232(%rbp)
+.Lmain_182:
+    addq $0, %rsp
+.Lmain_179:
+    incl -16777228(%rbp)
+    .loc 1 9 5
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_241
+    .p2align 4,,10
+.Lmain_240:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_244:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_245:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_246:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_243:
+    incl -16777236(%rbp)
+.Lmain_241:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_240
+.Lmain_242:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_238
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_239:
+    incl -16777236(%rbp)
+    jmp .Lmain_242
+.Lmain_238:
+    addq $8, %rsp
+.Lmain_235:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_253
+    .p2align 4,,10
+.Lmain_252:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_256:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_257:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_258:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_255:
+    incl -16777236(%rbp)
+.Lmain_253:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_252
+.Lmain_254:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_250
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_251:
+    incl -16777236(%rbp)
+    jmp .Lmain_254
+.Lmain_250:
+    addq $8, %rsp
+.Lmain_247:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_265
+    .p2align 4,,10
+.Lmain_264:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_268:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_269:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_270:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_267:
+    incl -16777236(%rbp)
+.Lmain_265:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_264
+.Lmain_266:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_262
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_263:
+    incl -16777236(%rbp)
+    jmp .Lmain_266
+.Lmain_262:
+    addq $8, %rsp
+.Lmain_259:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_276
+    .p2align 4,,10
+.Lmain_275:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_279:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_280:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_281:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_278:
+    incl -16777236(%rbp)
+.Lmain_276:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_275
+.Lmain_277:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_273
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_274:
+    incl -16777236(%rbp)
+    jmp .Lmain_277
+.Lmain_273:
+    addq $8, %rsp
+.Lmain_234:
+    incl -16777232(%rbp)
+.Lmain_233:
+    addq $0, %rsp
+.Lmain_74:
+    incl -16777228(%rbp)
+.Lmain_72:
+    movslq -16777228(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_71
+.Lmain_73:
+    cmpl $2048, -16777228(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 9 5
+    movq $0, %rax
+    movl %eax, -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_292
+    .p2align 4,,10
+.Lmain_291:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_295:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_296:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_297:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_294:
+    incl -16777236(%rbp)
+.Lmain_292:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_291
+.Lmain_293:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_289
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_290:
+    incl -16777236(%rbp)
+    jmp .Lmain_293
+.Lmain_289:
+    addq $8, %rsp
+.Lmain_286:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_304
+    .p2align 4,,10
+.Lmain_303:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_307:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_308:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_309:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_306:
+    incl -16777236(%rbp)
+.Lmain_304:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_303
+.Lmain_305:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_301
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_302:
+    incl -16777236(%rbp)
+    jmp .Lmain_305
+.Lmain_301:
+    addq $8, %rsp
+.Lmain_298:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_316
+    .p2align 4,,10
+.Lmain_315:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_319:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_320:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_321:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_318:
+    incl -16777236(%rbp)
+.Lmain_316:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_315
+.Lmain_317:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_313
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_314:
+    incl -16777236(%rbp)
+    jmp .Lmain_317
+.Lmain_313:
+    addq $8, %rsp
+.Lmain_310:
+    incl -16777232(%rbp)
+    .loc 1 10 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -16777236(%rbp)
+    jmp .Lmain_327
+    .p2align 4,,10
+.Lmain_326:
+    .loc 1 12 17
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_330:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_331:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_332:
+    incl -16777236(%rbp)
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_329:
+    incl -16777236(%rbp)
+.Lmain_327:
+    movslq -16777236(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_326
+.Lmain_328:
+    cmpl $2048, -16777236(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_324
+    movq $5, %rax
+    push %rax
+    movslq -16777236(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -16777228(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -16777236(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addq %rax, -16777224(%rbp)
+    addq $0, %rsp
+.Lmain_325:
+    incl -16777236(%rbp)
+    jmp .Lmain_328
+.Lmain_324:
+    addq $8, %rsp
+.Lmain_285:
+    incl -16777232(%rbp)
+.Lmain_284:
+    addq $0, %rsp
+.Lmain_70:
+    incl -16777228(%rbp)
+    jmp .Lmain_73
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 16 5
+    movq $251, %rax
+    push %rax
+    movq -16777224(%rbp), %rax
+    pop %rbx
+    cqo
+    idivq %rbx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,191 @@
+    .file 1 "bench/kernels/dispatch.c"
+.globl main
+.type main, @function
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $64, %rsp
+    .loc 1 3 5
+    subq $64, %rsp
+    .loc 1 4 5
+    movl $1, -64(%rbp)
+    movl $3, -128(%rbp)
+    .loc 1 5 5
+    movl $2, -60(%rbp)
+    movl $0, -124(%rbp)
+    .loc 1 6 5
+    movl $7, -56(%rbp)
+    movl $0, -120(%rbp)
+    .loc 1 7 5
+    movl $8, -52(%rbp)
+    movl $7, -116(%rbp)
+    .loc 1 8 5
+    movl $3, -48(%rbp)
+    movl $1000003, -112(%rbp)
+    .loc 1 9 5
+    movl $9, -44(%rbp)
+    movl $0, -108(%rbp)
+    .loc 1 10 5
+    movl $4, -40(%rbp)
+    movl $1, -104(%rbp)
+    .loc 1 11 5
+    movl $5, -36(%rbp)
+    movl $0, -100(%rbp)
+    .loc 1 12 5
+    movl $0, -32(%rbp)
+    movl $0, -96(%rbp)
+    .loc 1 13 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -132(%rbp)
+    .loc 1 14 5
+    movq $0, %rax
+    movl %eax, -136(%rbp)
+    .loc 1 15 5
+    subq $8, %rsp
+    movq $3000000, %rax
+    movl %eax, -140(%rbp)
+    .loc 1 16 5
+    movq $0, %rax
+    movl %eax, -144(%rbp)
+    .loc 1 17 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -148(%rbp)
+    .loc 1 18 5
+.Lmain_3:
+    movslq -148(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lmain_4
+    jmp .Lmain_1
+.Lmain_4:
+    .loc 1 19 9
+    movslq -144(%rbp), %rcx
+    movslq -64(%rbp,%rcx,4), %rax
+    movl %eax, -152(%rbp)
+    .loc 1 20 9
+    subq $8, %rsp
+    movslq -144(%rbp), %rcx
+    movslq -128(%rbp,%rcx,4), %rax
+    movl %eax, -156(%rbp)
+    .loc 1 21 9
+    incl -144(%rbp)
+    .loc 1 22 9
+    movslq -152(%rbp), %rax
+    cmpq $9, %rax
+    ja .Lmain_15
+    leaq .Lmain_16(%rip), %rbx
+    movslq (%rbx,%rax,4), %rax
+    addq %rbx, %rax
+    jmp *%rax
+    .section .rodata
+    .align 4
+.Lmain_16:
+    .long .Lmain_14-.Lmain_16
+    .long .Lmain_13-.Lmain_16
+    .long .Lmain_12-.Lmain_16
+    .long .Lmain_11-.Lmain_16
+    .long .Lmain_10-.Lmain_16
+    .long .Lmain_9-.Lmain_16
+    .long .Lmain_8-.Lmain_16
+    .long .Lmain_7-.Lmain_16
+    .long .Lmain_6-.Lmain_16
+    .long .Lmain_5-.Lmain_16
+    .text
+    .loc 1 23 9
+.Lmain_14:
+    movl $0, -148(%rbp)
+    jmp .Lmain_15
+    .loc 1 24 9
+.Lmain_13:
+    movslq -132(%rbp), %rax
+    imull -156(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    jmp .Lmain_15
+    .loc 1 25 9
+.Lmain_12:
+    movslq -136(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_15
+    .loc 1 26 9
+.Lmain_11:
+    movslq -156(%rbp), %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    jmp .Lmain_15
+    .loc 1 27 9
+.Lmain_10:
+    movslq -156(%rbp), %rax
+    addl %eax, -136(%rbp)
+    jmp .Lmain_15
+    .loc 1 28 9
+.Lmain_9:
+    movslq -136(%rbp), %rax
+    cmpl -140(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_17
+    jmp .Lmain_18
+.Lmain_17:
+    movslq -156(%rbp), %rax
+    movl %eax, -144(%rbp)
+    jmp .Lmain_19
+.Lmain_18:
+.Lmain_19:
+    jmp .Lmain_15
+    .loc 1 29 9
+.Lmain_8:
+    movslq -156(%rbp), %rax
+    subl %eax, -132(%rbp)
+    jmp .Lmain_15
+    .loc 1 30 9
+.Lmain_7:
+    movslq -132(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_15
+    .loc 1 31 9
+.Lmain_6:
+    movslq -156(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_15
+    .loc 1 32 9
+.Lmain_5:
+    jmp .Lmain_15
+    addq $0, %rsp
+.Lmain_15:
+    addq $8, %rsp
+.Lmain_2:
+    jmp .Lmain_3
+.Lmain_1:
+    .loc 1 35 5
+    movq $256, %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,357 @@
+    .file 1 "bench/kernels/dispatch_if.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    incq .Lcounts.main+0(%rip)
+    .loc 1 2 5
+    subq $64, %rsp
+    .loc 1 3 5
+    subq $64, %rsp
+    .loc 1 4 5
+    movl $1, -64(%rbp)
+    movl $3, -128(%rbp)
+    .loc 1 5 5
+    movl $2, -60(%rbp)
+    movl $0, -124(%rbp)
+    .loc 1 6 5
+    movl $7, -56(%rbp)
+    movl $0, -120(%rbp)
+    .loc 1 7 5
+    movl $8, -52(%rbp)
+    movl $7, -116(%rbp)
+    .loc 1 8 5
+    movl $3, -48(%rbp)
+    movl $1000003, -112(%rbp)
+    .loc 1 9 5
+    movl $9, -44(%rbp)
+    movl $0, -108(%rbp)
+    .loc 1 10 5
+    movl $4, -40(%rbp)
+    movl $1, -104(%rbp)
+    .loc 1 11 5
+    movl $5, -36(%rbp)
+    movl $0, -100(%rbp)
+    .loc 1 12 5
+    movl $0, -32(%rbp)
+    movl $0, -96(%rbp)
+    .loc 1 13 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -132(%rbp)
+    .loc 1 14 5
+    movq $0, %rax
+    movl %eax, -136(%rbp)
+    .loc 1 15 5
+    subq $8, %rsp
+    movq $3000000, %rax
+    movl %eax, -140(%rbp)
+    .loc 1 16 5
+    movq $0, %rax
+    movl %eax, -144(%rbp)
+    .loc 1 17 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -148(%rbp)
+    .loc 1 18 5
+.Lmain_3:
+    movslq -148(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lmain_4
+    incq .Lcounts.main+16(%rip)
+    jmp .Lmain_1
+.Lmain_4:
+    incq .Lcounts.main+8(%rip)
+    .loc 1 19 9
+    movslq -144(%rbp), %rcx
+    movslq -64(%rbp,%rcx,4), %rax
+    movl %eax, -152(%rbp)
+    .loc 1 20 9
+    subq $8, %rsp
+    movslq -144(%rbp), %rcx
+    movslq -128(%rbp,%rcx,4), %rax
+    movl %eax, -156(%rbp)
+    .loc 1 21 9
+    incl -144(%rbp)
+    .loc 1 22 9
+    cmpl $0, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_5
+    jmp .Lmain_6
+.Lmain_5:
+    incq .Lcounts.main+24(%rip)
+    .loc 1 23 13
+    movl $0, -148(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_7
+.Lmain_6:
+    incq .Lcounts.main+32(%rip)
+    .loc 1 24 16
+    cmpl $1, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_8
+    jmp .Lmain_9
+.Lmain_8:
+    incq .Lcounts.main+40(%rip)
+    .loc 1 25 13
+    movslq -132(%rbp), %rax
+    imull -156(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_10
+.Lmain_9:
+    incq .Lcounts.main+48(%rip)
+    .loc 1 26 16
+    cmpl $2, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_11
+    jmp .Lmain_12
+.Lmain_11:
+    incq .Lcounts.main+56(%rip)
+    .loc 1 27 13
+    movslq -136(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_13
+.Lmain_12:
+    incq .Lcounts.main+64(%rip)
+    .loc 1 28 16
+    cmpl $3, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_14
+    jmp .Lmain_15
+.Lmain_14:
+    incq .Lcounts.main+72(%rip)
+    .loc 1 29 13
+    movslq -156(%rbp), %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_16
+.Lmain_15:
+    incq .Lcounts.main+80(%rip)
+    .loc 1 30 16
+    cmpl $4, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_17
+    jmp .Lmain_18
+.Lmain_17:
+    incq .Lcounts.main+88(%rip)
+    .loc 1 31 13
+    movslq -156(%rbp), %rax
+    addl %eax, -136(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_19
+.Lmain_18:
+    incq .Lcounts.main+96(%rip)
+    .loc 1 32 16
+    cmpl $5, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_20
+    jmp .Lmain_21
+.Lmain_20:
+    incq .Lcounts.main+104(%rip)
+    .loc 1 33 13
+    movslq -136(%rbp), %rax
+    cmpl -140(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_23
+    jmp .Lmain_24
+.Lmain_23:
+    incq .Lcounts.main+120(%rip)
+    movslq -156(%rbp), %rax
+    movl %eax, -144(%rbp)
+    jmp .Lmain_25
+.Lmain_24:
+    incq .Lcounts.main+128(%rip)
+.Lmain_25:
+    addq $0, %rsp
+    jmp .Lmain_22
+.Lmain_21:
+    incq .Lcounts.main+112(%rip)
+    .loc 1 34 16
+    cmpl $6, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_26
+    jmp .Lmain_27
+.Lmain_26:
+    incq .Lcounts.main+136(%rip)
+    .loc 1 35 13
+    movslq -156(%rbp), %rax
+    subl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_28
+.Lmain_27:
+    incq .Lcounts.main+144(%rip)
+    .loc 1 36 16
+    cmpl $7, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_29
+    jmp .Lmain_30
+.Lmain_29:
+    incq .Lcounts.main+152(%rip)
+    .loc 1 37 13
+    movslq -132(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_31
+.Lmain_30:
+    incq .Lcounts.main+160(%rip)
+    .loc 1 38 16
+    cmpl $8, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_32
+    jmp .Lmain_33
+.Lmain_32:
+    incq .Lcounts.main+168(%rip)
+    .loc 1 39 13
+    movslq -156(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_34
+.Lmain_33:
+    incq .Lcounts.main+176(%rip)
+    .loc 1 40 16
+    cmpl $9, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_35
+    jmp .Lmain_36
+.Lmain_35:
+    incq .Lcounts.main+184(%rip)
+    addq $0, %rsp
+    jmp .Lmain_37
+.Lmain_36:
+    incq .Lcounts.main+192(%rip)
+.Lmain_37:
+.Lmain_34:
+.Lmain_31:
+.Lmain_28:
+.Lmain_22:
+.Lmain_19:
+.Lmain_16:
+.Lmain_13:
+.Lmain_10:
+.Lmain_7:
+    addq $8, %rsp
+.Lmain_2:
+    jmp .Lmain_3
+.Lmain_1:
+    .loc 1 43 5
+    movq $256, %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+    .bss
+    .align 8
+.Lcounts.main:
+    .zero 200
+    .section .rodata
+.Lname.main:
+    .ascii "main"
+    .section pgo_records,"aw"
+    .align 8
+    .quad .Lcounts.main, 25, .Lname.main, 4
+    .text
+    .text
+.Lpgo.dump:
+    push %rbx
+    push %r12
+    movq $2, %rax
+    leaq .Lpgo.path(%rip), %rdi
+    movq $577, %rsi
+    movq $420, %rdx
+    syscall
+    testq %rax, %rax
+    js .Lpgo.done
+    movq %rax, %r12
+    leaq __start_pgo_records(%rip), %rbx
+.Lpgo.next:
+    leaq __stop_pgo_records(%rip), %rax
+    cmpq %rax, %rbx
+    jae .Lpgo.close
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 24(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq 16(%rbx), %rsi
+    movq 24(%rbx), %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 8(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq (%rbx), %rsi
+    movq 8(%rbx), %rdx
+    shlq $3, %rdx
+    syscall
+    addq $32, %rbx
+    jmp .Lpgo.next
+.Lpgo.close:
+    movq $3, %rax
+    movq %r12, %rdi
+    syscall
+.Lpgo.done:
+    pop %r12
+    pop %rbx
+    ret
+    .section .fini_array, "aw"
+    .align 8
+    .quad .Lpgo.dump
+    .section .rodata
+.Lpgo.path:
+    .asciz "build/bench/kernels/dispatch_if.cc-pgo.prof"
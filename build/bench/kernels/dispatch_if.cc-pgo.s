@@ -0,0 +1,412 @@
+    .file 1 "bench/kernels/dispatch_if.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $64, %rsp
+    .loc 1 3 5
+    subq $64, %rsp
+    .loc 1 4 5
+    movl $1, -64(%rbp)
+    movl $3, -128(%rbp)
+    .loc 1 5 5
+    movl $2, -60(%rbp)
+    movl $0, -124(%rbp)
+    .loc 1 6 5
+    movl $7, -56(%rbp)
+    movl $0, -120(%rbp)
+    .loc 1 7 5
+    movl $8, -52(%rbp)
+    movl $7, -116(%rbp)
+    .loc 1 8 5
+    movl $3, -48(%rbp)
+    movl $1000003, -112(%rbp)
+    .loc 1 9 5
+    movl $9, -44(%rbp)
+    movl $0, -108(%rbp)
+    .loc 1 10 5
+    movl $4, -40(%rbp)
+    movl $1, -104(%rbp)
+    .loc 1 11 5
+    movl $5, -36(%rbp)
+    movl $0, -100(%rbp)
+    .loc 1 12 5
+    movl $0, -32(%rbp)
+    movl $0, -96(%rbp)
+    .loc 1 13 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -132(%rbp)
+    .loc 1 14 5
+    movq $0, %rax
+    movl %eax, -136(%rbp)
+    .loc 1 15 5
+    subq $8, %rsp
+    movq $3000000, %rax
+    movl %eax, -140(%rbp)
+    .loc 1 16 5
+    movq $0, %rax
+    movl %eax, -144(%rbp)
+    .loc 1 17 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -148(%rbp)
+    .loc 1 18 5
+    jmp .Lmain_4
+    .p2align 4,,10
+.Lmain_3:
+    .loc 1 19 9
+    movslq -144(%rbp), %rcx
+    movslq -64(%rbp,%rcx,4), %rax
+    movl %eax, -152(%rbp)
+    .loc 1 20 9
+    subq $8, %rsp
+    movslq -144(%rbp), %rcx
+    movslq -128(%rbp,%rcx,4), %rax
+    movl %eax, -156(%rbp)
+    .loc 1 21 9
+    incl -144(%rbp)
+    .loc 1 22 9
+    cmpl $0, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_7
+    .loc 1 24 16
+    cmpl $1, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_9
+    .loc 1 26 16
+    cmpl $2, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_11
+    .loc 1 28 16
+    cmpl $3, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_13
+    .loc 1 30 16
+    cmpl $4, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_15
+    .loc 1 32 16
+    cmpl $5, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_17
+    .loc 1 34 16
+    cmpl $6, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_19
+    .loc 1 36 16
+    cmpl $7, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_21
+    .loc 1 38 16
+    cmpl $8, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_23
+    .loc 1 39 13
+    movslq -156(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_22
+.Lmain_23:
+    .loc 1 40 16
+    cmpl $9, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_24
+    addq $0, %rsp
+.Lmain_24:
+.Lmain_22:
+    jmp .Lmain_20
+.Lmain_21:
+    .loc 1 37 13
+    movslq -132(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+.Lmain_20:
+.Lmain_18:
+    jmp .Lmain_16
+.Lmain_17:
+    .loc 1 33 13
+    movslq -136(%rbp), %rax
+    cmpl -140(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_25
+    movslq -156(%rbp), %rax
+    movl %eax, -144(%rbp)
+.Lmain_25:
+    addq $0, %rsp
+.Lmain_16:
+    jmp .Lmain_14
+.Lmain_15:
+    .loc 1 31 13
+    movslq -156(%rbp), %rax
+    addl %eax, -136(%rbp)
+    addq $0, %rsp
+.Lmain_14:
+    jmp .Lmain_12
+.Lmain_13:
+    .loc 1 29 13
+    movslq -156(%rbp), %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    addq $0, %rsp
+.Lmain_12:
+    jmp .Lmain_10
+.Lmain_11:
+    .loc 1 27 13
+    movslq -136(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+.Lmain_10:
+    jmp .Lmain_8
+.Lmain_9:
+    .loc 1 25 13
+    movslq -132(%rbp), %rax
+    imull -156(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    addq $0, %rsp
+.Lmain_8:
+.Lmain_6:
+    addq $8, %rsp
+.Lmain_5:
+    .loc 1 18 12
+    movslq -148(%rbp), %rax
+    cmpq $0, %rax
+    je .Lmain_1
+    .loc 1 19 9
+    movslq -144(%rbp), %rcx
+    movslq -64(%rbp,%rcx,4), %rax
+    movl %eax, -152(%rbp)
+    .loc 1 20 9
+    subq $8, %rsp
+    movslq -144(%rbp), %rcx
+    movslq -128(%rbp,%rcx,4), %rax
+    movl %eax, -156(%rbp)
+    .loc 1 21 9
+    incl -144(%rbp)
+    .loc 1 22 9
+    cmpl $0, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_27
+    .loc 1 24 16
+    cmpl $1, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_29
+    .loc 1 26 16
+    cmpl $2, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_31
+    .loc 1 28 16
+    cmpl $3, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_33
+    .loc 1 30 16
+    cmpl $4, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_35
+    .loc 1 32 16
+    cmpl $5, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_37
+    .loc 1 34 16
+    cmpl $6, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_39
+    .loc 1 36 16
+    cmpl $7, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_41
+    .loc 1 38 16
+    cmpl $8, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_43
+    .loc 1 39 13
+    movslq -156(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_42
+.Lmain_43:
+    .loc 1 40 16
+    cmpl $9, -152(%rbp)
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_44
+    addq $0, %rsp
+.Lmain_44:
+.Lmain_42:
+    jmp .Lmain_40
+.Lmain_41:
+    .loc 1 37 13
+    movslq -132(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+.Lmain_40:
+.Lmain_38:
+    jmp .Lmain_36
+.Lmain_37:
+    .loc 1 33 13
+    movslq -136(%rbp), %rax
+    cmpl -140(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_45
+    movslq -156(%rbp), %rax
+    movl %eax, -144(%rbp)
+.Lmain_45:
+    addq $0, %rsp
+.Lmain_36:
+    jmp .Lmain_34
+.Lmain_35:
+    .loc 1 31 13
+    movslq -156(%rbp), %rax
+    addl %eax, -136(%rbp)
+    addq $0, %rsp
+.Lmain_34:
+    jmp .Lmain_32
+.Lmain_33:
+    .loc 1 29 13
+    movslq -156(%rbp), %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    addq $0, %rsp
+.Lmain_32:
+    jmp .Lmain_30
+.Lmain_31:
+    .loc 1 27 13
+    movslq -136(%rbp), %rax
+    addl %eax, -132(%rbp)
+    addq $0, %rsp
+.Lmain_30:
+    jmp .Lmain_28
+.Lmain_29:
+    .loc 1 25 13
+    movslq -132(%rbp), %rax
+    imull -156(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    addq $0, %rsp
+.Lmain_28:
+.Lmain_26:
+    addq $8, %rsp
+.Lmain_2:
+.Lmain_4:
+    .loc 1 18 12
+    movslq -148(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lmain_3
+.Lmain_1:
+    .loc 1 43 5
+    movq $256, %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+    .section .text.unlikely,"ax",@progbits
+.type main.cold, @function
+main.cold:
+    .cfi_startproc
+    .cfi_def_cfa %rbp, 16
+    .cfi_offset %rbp, -16
+    .loc 1 37 13
+.Lmain_19:
+    .loc 1 35 13
+    movslq -156(%rbp), %rax
+    subl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_18
+    .loc 1 25 13
+.Lmain_7:
+    .loc 1 23 13
+    movl $0, -148(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_6
+    .loc 1 37 13
+.Lmain_39:
+    .loc 1 35 13
+    movslq -156(%rbp), %rax
+    subl %eax, -132(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_38
+    .loc 1 25 13
+.Lmain_27:
+    .loc 1 23 13
+    movl $0, -148(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_26
+    .cfi_endproc
+.size main.cold, .-main.cold
+    .text
@@ -0,0 +1,307 @@
+    .file 1 "bench/kernels/dispatch_sp.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $64, %rsp
+    .loc 1 3 5
+    subq $64, %rsp
+    .loc 1 4 5
+    movl $17, -64(%rbp)
+    movl $3, -128(%rbp)
+    .loc 1 5 5
+    movl $101, -60(%rbp)
+    movl $0, -124(%rbp)
+    .loc 1 6 5
+    movl $77777, -56(%rbp)
+    movl $0, -120(%rbp)
+    .loc 1 7 5
+    movl $123456, -52(%rbp)
+    movl $7, -116(%rbp)
+    .loc 1 8 5
+    movl $256, -48(%rbp)
+    movl $1000003, -112(%rbp)
+    .loc 1 9 5
+    movl $1000000, -44(%rbp)
+    movl $0, -108(%rbp)
+    .loc 1 10 5
+    movl $999, -40(%rbp)
+    movl $1, -104(%rbp)
+    .loc 1 11 5
+    movl $4096, -36(%rbp)
+    movl $0, -100(%rbp)
+    .loc 1 12 5
+    movl $3, -32(%rbp)
+    movl $0, -96(%rbp)
+    .loc 1 13 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -132(%rbp)
+    .loc 1 14 5
+    movq $0, %rax
+    movl %eax, -136(%rbp)
+    .loc 1 15 5
+    subq $8, %rsp
+    movq $3000000, %rax
+    movl %eax, -140(%rbp)
+    .loc 1 16 5
+    movq $0, %rax
+    movl %eax, -144(%rbp)
+    .loc 1 17 5
+    subq $8, %rsp
+    movq $1, %rax
+    movl %eax, -148(%rbp)
+    .loc 1 18 5
+    jmp .Lmain_4
+    .p2align 4,,10
+.Lmain_3:
+    .loc 1 19 9
+    movslq -144(%rbp), %rcx
+    movslq -64(%rbp,%rcx,4), %rax
+    movl %eax, -152(%rbp)
+    .loc 1 20 9
+    subq $8, %rsp
+    movslq -144(%rbp), %rcx
+    movslq -128(%rbp,%rcx,4), %rax
+    movl %eax, -156(%rbp)
+    .loc 1 21 9
+    incl -144(%rbp)
+    .loc 1 22 9
+    movslq -152(%rbp), %rax
+    cmpq $4096, %rax
+    je .Lmain_10
+    jg .Lmain_17
+    cmpq $101, %rax
+    je .Lmain_13
+    jg .Lmain_18
+    cmpq $3, %rax
+    je .Lmain_15
+    cmpq $17, %rax
+    je .Lmain_14
+    jmp .Lmain_16
+.Lmain_18:
+    cmpq $256, %rax
+    je .Lmain_12
+    cmpq $999, %rax
+    je .Lmain_11
+    jmp .Lmain_16
+.Lmain_17:
+    cmpq $5000, %rax
+    je .Lmain_9
+    cmpq $77777, %rax
+    je .Lmain_8
+    cmpq $123456, %rax
+    je .Lmain_7
+    cmpq $1000000, %rax
+    je .Lmain_6
+    jmp .Lmain_16
+    .loc 1 23 9
+.Lmain_15:
+    movl $0, -148(%rbp)
+    jmp .Lmain_16
+    .loc 1 24 9
+.Lmain_14:
+    movslq -132(%rbp), %rax
+    imull -156(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    jmp .Lmain_16
+    .loc 1 25 9
+.Lmain_13:
+    movslq -136(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_16
+    .loc 1 26 9
+.Lmain_12:
+    movslq -156(%rbp), %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    jmp .Lmain_16
+    .loc 1 27 9
+.Lmain_11:
+    movslq -156(%rbp), %rax
+    addl %eax, -136(%rbp)
+    jmp .Lmain_16
+    .loc 1 28 9
+.Lmain_10:
+    movslq -136(%rbp), %rax
+    cmpl -140(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_19
+    movslq -156(%rbp), %rax
+    movl %eax, -144(%rbp)
+.Lmain_19:
+    jmp .Lmain_16
+    .loc 1 29 9
+.Lmain_9:
+    movslq -156(%rbp), %rax
+    subl %eax, -132(%rbp)
+    jmp .Lmain_16
+    .loc 1 30 9
+.Lmain_8:
+    movslq -132(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_16
+    .loc 1 31 9
+.Lmain_7:
+    movslq -156(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_16
+    .loc 1 32 9
+.Lmain_6:
+    jmp .Lmain_16
+    addq $0, %rsp
+.Lmain_16:
+    addq $8, %rsp
+.Lmain_5:
+    .loc 1 18 12
+    movslq -148(%rbp), %rax
+    cmpq $0, %rax
+    je .Lmain_1
+    .loc 1 19 9
+    movslq -144(%rbp), %rcx
+    movslq -64(%rbp,%rcx,4), %rax
+    movl %eax, -152(%rbp)
+    .loc 1 20 9
+    subq $8, %rsp
+    movslq -144(%rbp), %rcx
+    movslq -128(%rbp,%rcx,4), %rax
+    movl %eax, -156(%rbp)
+    .loc 1 21 9
+    incl -144(%rbp)
+    .loc 1 22 9
+    movslq -152(%rbp), %rax
+    cmpq $4096, %rax
+    je .Lmain_24
+    jg .Lmain_31
+    cmpq $101, %rax
+    je .Lmain_27
+    jg .Lmain_32
+    cmpq $3, %rax
+    je .Lmain_29
+    cmpq $17, %rax
+    je .Lmain_28
+    jmp .Lmain_30
+.Lmain_32:
+    cmpq $256, %rax
+    je .Lmain_26
+    cmpq $999, %rax
+    je .Lmain_25
+    jmp .Lmain_30
+.Lmain_31:
+    cmpq $5000, %rax
+    je .Lmain_23
+    cmpq $77777, %rax
+    je .Lmain_22
+    cmpq $123456, %rax
+    je .Lmain_21
+    cmpq $1000000, %rax
+    je .Lmain_20
+    jmp .Lmain_30
+    .loc 1 23 9
+.Lmain_29:
+    movl $0, -148(%rbp)
+    jmp .Lmain_30
+    .loc 1 24 9
+.Lmain_28:
+    movslq -132(%rbp), %rax
+    imull -156(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    jmp .Lmain_30
+    .loc 1 25 9
+.Lmain_27:
+    movslq -136(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_30
+    .loc 1 26 9
+.Lmain_26:
+    movslq -156(%rbp), %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -132(%rbp)
+    jmp .Lmain_30
+    .loc 1 27 9
+.Lmain_25:
+    movslq -156(%rbp), %rax
+    addl %eax, -136(%rbp)
+    jmp .Lmain_30
+    .loc 1 28 9
+.Lmain_24:
+    movslq -136(%rbp), %rax
+    cmpl -140(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_33
+    movslq -156(%rbp), %rax
+    movl %eax, -144(%rbp)
+.Lmain_33:
+    jmp .Lmain_30
+    .loc 1 29 9
+.Lmain_23:
+    movslq -156(%rbp), %rax
+    subl %eax, -132(%rbp)
+    jmp .Lmain_30
+    .loc 1 30 9
+.Lmain_22:
+    movslq -132(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_30
+    .loc 1 31 9
+.Lmain_21:
+    movslq -156(%rbp), %rax
+    addl %eax, -132(%rbp)
+    jmp .Lmain_30
+    .loc 1 32 9
+.Lmain_20:
+    jmp .Lmain_30
+    addq $0, %rsp
+.Lmain_30:
+    addq $8, %rsp
+.Lmain_2:
+.Lmain_4:
+    .loc 1 18 12
+    movslq -148(%rbp), %rax
+    cmpq $0, %rax
+    jne .Lmain_3
+.Lmain_1:
+    .loc 1 35 5
+    movq $256, %rax
+    push %rax
+    movslq -132(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,834 @@
+    .file 1 "bench/kernels/fib.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 3 5
+    movq $0, %rax
+    movl %eax, -8(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 4 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 9
+    movq $1, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -20(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 6 34
+    incl -20(%rbp)
+.Lmain_15:
+    movslq -20(%rbp), %rax
+    addq $3, %rax
+    cmpq $300, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $300, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 6 34
+    incl -20(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $8, %rsp
+.Lmain_9:
+    .loc 1 3 32
+    incl -8(%rbp)
+    .loc 1 4 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 9
+    movq $1, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -20(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 6 34
+    incl -20(%rbp)
+.Lmain_27:
+    movslq -20(%rbp), %rax
+    addq $3, %rax
+    cmpq $300, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $300, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 6 34
+    incl -20(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $8, %rsp
+.Lmain_21:
+    .loc 1 3 32
+    incl -8(%rbp)
+    .loc 1 4 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 9
+    movq $1, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -20(%rbp)
+    jmp .Lmain_39
+    .p2align 4,,10
+.Lmain_38:
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 6 34
+    incl -20(%rbp)
+.Lmain_39:
+    movslq -20(%rbp), %rax
+    addq $3, %rax
+    cmpq $300, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $300, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 6 34
+    incl -20(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $8, %rsp
+.Lmain_33:
+    .loc 1 3 32
+    incl -8(%rbp)
+    .loc 1 4 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 9
+    movq $1, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -20(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 6 34
+    incl -20(%rbp)
+.Lmain_50:
+    movslq -20(%rbp), %rax
+    addq $3, %rax
+    cmpq $300, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $300, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 6 34
+    incl -20(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $8, %rsp
+.Lmain_8:
+    .loc 1 3 32
+    incl -8(%rbp)
+.Lmain_6:
+    movslq -8(%rbp), %rax
+    addq $3, %rax
+    cmpq $20000, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $20000, -8(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 4 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -12(%rbp)
+    .loc 1 5 9
+    movq $1, %rax
+    movl %eax, -16(%rbp)
+    .loc 1 6 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -20(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 6 34
+    incl -20(%rbp)
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 6 34
+    incl -20(%rbp)
+.Lmain_61:
+    movslq -20(%rbp), %rax
+    addq $3, %rax
+    cmpq $300, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $300, -20(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 7 13
+    movq $1000003, %rax
+    push %rax
+    movslq -12(%rbp), %rax
+    addl -16(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -24(%rbp)
+    .loc 1 8 13
+    movslq -16(%rbp), %rax
+    movl %eax, -12(%rbp)
+    .loc 1 9 13
+    movslq -24(%rbp), %rax
+    movl %eax, -16(%rbp)
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 6 34
+    incl -20(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $8, %rsp
+    .loc 1 11 9
+    movq $1000003, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    addl -12(%rbp), %eax
+    movslq %eax, %rax
+    addl -8(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -4(%rbp)
+    addq $8, %rsp
+.Lmain_4:
+    .loc 1 3 32
+    incl -8(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $0, %rsp
+    .loc 1 13 5
+    movq $256, %rax
+    push %rax
+    movslq -4(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
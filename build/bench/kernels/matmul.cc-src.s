@@ -0,0 +1,4134 @@
+    .file 1 "bench/kernels/matmul.c"
+.globl main
+.type main, @function
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $36864, %rsp
+    .loc 1 3 5
+    subq $36864, %rsp
+    .loc 1 4 5
+    subq $36864, %rsp
+    .loc 1 5 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110596(%rbp)
+    jmp .Lmain_6
+.Lmain_5:
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -110600(%rbp)
+    jmp .Lmain_15
+.Lmain_14:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 6 33
+    incl -110600(%rbp)
+.Lmain_15:
+    movslq -110600(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $96, -110600(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 5 29
+    incl -110596(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -110600(%rbp)
+    jmp .Lmain_27
+.Lmain_26:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 6 33
+    incl -110600(%rbp)
+.Lmain_27:
+    movslq -110600(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $96, -110600(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 5 29
+    incl -110596(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -110600(%rbp)
+    jmp .Lmain_38
+.Lmain_37:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 6 33
+    incl -110600(%rbp)
+.Lmain_38:
+    movslq -110600(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_37
+.Lmain_39:
+    cmpl $96, -110600(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_35
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    jmp .Lmain_39
+.Lmain_35:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 5 29
+    incl -110596(%rbp)
+.Lmain_6:
+    movslq -110596(%rbp), %rax
+    addq $2, %rax
+    cmpq $96, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $96, -110596(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -110600(%rbp)
+    jmp .Lmain_49
+.Lmain_48:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 6 33
+    incl -110600(%rbp)
+.Lmain_49:
+    movslq -110600(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_48
+.Lmain_50:
+    cmpl $96, -110600(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    addl -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    imull -110600(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 6 33
+    incl -110600(%rbp)
+    jmp .Lmain_50
+.Lmain_46:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 5 29
+    incl -110596(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 12 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110596(%rbp)
+    jmp .Lmain_60
+.Lmain_59:
+    .loc 1 13 9
+    movq $0, %rax
+    movl %eax, -110600(%rbp)
+    jmp .Lmain_69
+.Lmain_68:
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_78
+.Lmain_77:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_82:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_83:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_80:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_78:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_77
+.Lmain_79:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_75
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_76:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_79
+.Lmain_75:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_72:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_90
+.Lmain_89:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_93:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_94:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_95:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_92:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_90:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_89
+.Lmain_91:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_87
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_88:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_91
+.Lmain_87:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_84:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_101
+.Lmain_100:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_104:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_105:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_106:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_103:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_101:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_100
+.Lmain_102:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_98
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_99:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_102
+.Lmain_98:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_71:
+    .loc 1 13 33
+    incl -110600(%rbp)
+.Lmain_69:
+    movslq -110600(%rbp), %rax
+    addq $2, %rax
+    cmpq $96, %rax
+    jl .Lmain_68
+.Lmain_70:
+    cmpl $96, -110600(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_66
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_112
+.Lmain_111:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_116:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_117:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_114:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_112:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_111
+.Lmain_113:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_109
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_110:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_113
+.Lmain_109:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_67:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    jmp .Lmain_70
+.Lmain_66:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 12 29
+    incl -110596(%rbp)
+    .loc 1 13 9
+    movq $0, %rax
+    movl %eax, -110600(%rbp)
+    jmp .Lmain_123
+.Lmain_122:
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_132
+.Lmain_131:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_135:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_136:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_137:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_134:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_132:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_131
+.Lmain_133:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_129
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_130:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_133
+.Lmain_129:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_126:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_144
+.Lmain_143:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_147:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_148:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_149:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_146:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_144:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_143
+.Lmain_145:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_141
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_142:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_145
+.Lmain_141:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_138:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_155
+.Lmain_154:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_159:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_160:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_157:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_155:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_154
+.Lmain_156:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_152
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_153:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_156
+.Lmain_152:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_125:
+    .loc 1 13 33
+    incl -110600(%rbp)
+.Lmain_123:
+    movslq -110600(%rbp), %rax
+    addq $2, %rax
+    cmpq $96, %rax
+    jl .Lmain_122
+.Lmain_124:
+    cmpl $96, -110600(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_120
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_166
+.Lmain_165:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_169:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_170:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_171:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_168:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_166:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_165
+.Lmain_167:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_163
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_164:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_167
+.Lmain_163:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_121:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    jmp .Lmain_124
+.Lmain_120:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_62:
+    .loc 1 12 29
+    incl -110596(%rbp)
+.Lmain_60:
+    movslq -110596(%rbp), %rax
+    addq $1, %rax
+    cmpq $96, %rax
+    jl .Lmain_59
+.Lmain_61:
+    cmpl $96, -110596(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_57
+    .loc 1 13 9
+    movq $0, %rax
+    movl %eax, -110600(%rbp)
+    jmp .Lmain_177
+.Lmain_176:
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_186
+.Lmain_185:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_189:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_190:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_191:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_188:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_186:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_185
+.Lmain_187:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_183
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_184:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_187
+.Lmain_183:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_180:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_198
+.Lmain_197:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_201:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_202:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_203:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_200:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_198:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_197
+.Lmain_199:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_195
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_196:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_199
+.Lmain_195:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_192:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_209
+.Lmain_208:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_212:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_213:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_214:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_211:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_209:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_208
+.Lmain_210:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_206
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_207:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_210
+.Lmain_206:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_179:
+    .loc 1 13 33
+    incl -110600(%rbp)
+.Lmain_177:
+    movslq -110600(%rbp), %rax
+    addq $2, %rax
+    cmpq $96, %rax
+    jl .Lmain_176
+.Lmain_178:
+    cmpl $96, -110600(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_174
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    .loc 1 15 13
+    movq $0, %rax
+    movl %eax, -110608(%rbp)
+    jmp .Lmain_220
+.Lmain_219:
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_223:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_224:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_225:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_222:
+    .loc 1 15 37
+    incl -110608(%rbp)
+.Lmain_220:
+    movslq -110608(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_219
+.Lmain_221:
+    cmpl $96, -110608(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_217
+    .loc 1 16 17
+    movslq -110608(%rbp), %rax
+    push %rax
+    leaq -73728(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -36864(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110608(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl %eax, -110604(%rbp)
+    addq $0, %rsp
+.Lmain_218:
+    .loc 1 15 37
+    incl -110608(%rbp)
+    jmp .Lmain_221
+.Lmain_217:
+    addq $0, %rsp
+    .loc 1 18 13
+    movslq -110604(%rbp), %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110600(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $8, %rsp
+.Lmain_175:
+    .loc 1 13 33
+    incl -110600(%rbp)
+    jmp .Lmain_178
+.Lmain_174:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_58:
+    .loc 1 12 29
+    incl -110596(%rbp)
+    jmp .Lmain_61
+.Lmain_57:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110596(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -110600(%rbp)
+    jmp .Lmain_231
+.Lmain_230:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    jmp .Lmain_240
+.Lmain_239:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_243:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_244:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_245:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_242:
+    .loc 1 23 33
+    incl -110604(%rbp)
+.Lmain_240:
+    movslq -110604(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_239
+.Lmain_241:
+    cmpl $96, -110604(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_237
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_238:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    jmp .Lmain_241
+.Lmain_237:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 22 29
+    incl -110600(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    jmp .Lmain_252
+.Lmain_251:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_255:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_256:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_257:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_254:
+    .loc 1 23 33
+    incl -110604(%rbp)
+.Lmain_252:
+    movslq -110604(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_251
+.Lmain_253:
+    cmpl $96, -110604(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_249
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_250:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    jmp .Lmain_253
+.Lmain_249:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_246:
+    .loc 1 22 29
+    incl -110600(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    jmp .Lmain_264
+.Lmain_263:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_267:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_269:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_266:
+    .loc 1 23 33
+    incl -110604(%rbp)
+.Lmain_264:
+    movslq -110604(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_263
+.Lmain_265:
+    cmpl $96, -110604(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_261
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_262:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    jmp .Lmain_265
+.Lmain_261:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_258:
+    .loc 1 22 29
+    incl -110600(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    jmp .Lmain_275
+.Lmain_274:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_278:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_279:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_280:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_277:
+    .loc 1 23 33
+    incl -110604(%rbp)
+.Lmain_275:
+    movslq -110604(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_274
+.Lmain_276:
+    cmpl $96, -110604(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_272
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_273:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    jmp .Lmain_276
+.Lmain_272:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_233:
+    .loc 1 22 29
+    incl -110600(%rbp)
+.Lmain_231:
+    movslq -110600(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_230
+.Lmain_232:
+    cmpl $96, -110600(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_228
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -110604(%rbp)
+    jmp .Lmain_286
+.Lmain_285:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_289:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_290:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_291:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_288:
+    .loc 1 23 33
+    incl -110604(%rbp)
+.Lmain_286:
+    movslq -110604(%rbp), %rax
+    addq $3, %rax
+    cmpq $96, %rax
+    jl .Lmain_285
+.Lmain_287:
+    cmpl $96, -110604(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_283
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -110600(%rbp), %rax
+    push %rax
+    leaq -110592(%rbp), %rax
+    pop %rbx
+    imulq $384, %rbx
+    add %rbx, %rax
+    movslq -110604(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -110596(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -110596(%rbp)
+    addq $0, %rsp
+.Lmain_284:
+    .loc 1 23 33
+    incl -110604(%rbp)
+    jmp .Lmain_287
+.Lmain_283:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_229:
+    .loc 1 22 29
+    incl -110600(%rbp)
+    jmp .Lmain_232
+.Lmain_228:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -110596(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,8732 @@
+    .file 1 "bench/kernels/matmul_128.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $65536, %rsp
+    .loc 1 3 5
+    subq $65536, %rsp
+    .loc 1 4 5
+    subq $65536, %rsp
+    .loc 1 5 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196612(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 6 34
+    incl -196616(%rbp)
+.Lmain_15:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 5 30
+    incl -196612(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 6 34
+    incl -196616(%rbp)
+.Lmain_27:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 5 30
+    incl -196612(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_38
+    .p2align 4,,10
+.Lmain_37:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 6 34
+    incl -196616(%rbp)
+.Lmain_38:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_37
+.Lmain_39:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_35
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    jmp .Lmain_39
+.Lmain_35:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 5 30
+    incl -196612(%rbp)
+.Lmain_6:
+    movslq -196612(%rbp), %rax
+    addq $2, %rax
+    cmpq $128, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $128, -196612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_49
+    .p2align 4,,10
+.Lmain_48:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 6 34
+    incl -196616(%rbp)
+.Lmain_49:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_48
+.Lmain_50:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    jmp .Lmain_50
+.Lmain_46:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 5 30
+    incl -196612(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 12 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196612(%rbp)
+    .loc 1 13 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_65
+    .p2align 4,,10
+.Lmain_64:
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_74
+    .p2align 4,,10
+.Lmain_73:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_83
+    .p2align 4,,10
+.Lmain_82:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_86:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_87:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_88:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_85:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_83:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_82
+.Lmain_84:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_80
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_84
+.Lmain_80:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_77:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_95
+    .p2align 4,,10
+.Lmain_94:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_98:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_99:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_100:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_97:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_95:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_94
+.Lmain_96:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_92
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_93:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_96
+.Lmain_92:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_89:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_106
+    .p2align 4,,10
+.Lmain_105:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_109:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_110:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_111:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_108:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_106:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_105
+.Lmain_107:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_103
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_104:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_107
+.Lmain_103:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_76:
+    .loc 1 14 38
+    incl -196620(%rbp)
+.Lmain_74:
+    movslq -196620(%rbp), %rax
+    addq $2, %rax
+    cmpq $128, %rax
+    jl .Lmain_73
+.Lmain_75:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_71
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_117
+    .p2align 4,,10
+.Lmain_116:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_120:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_121:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_122:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_119:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_117:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_116
+.Lmain_118:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_114
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_118
+.Lmain_114:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_72:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    jmp .Lmain_75
+.Lmain_71:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_68:
+    .loc 1 13 34
+    incl -196616(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_128
+    .p2align 4,,10
+.Lmain_127:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_137
+    .p2align 4,,10
+.Lmain_136:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_140:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_141:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_142:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_139:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_137:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_136
+.Lmain_138:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_134
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_135:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_138
+.Lmain_134:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_131:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_149
+    .p2align 4,,10
+.Lmain_148:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_152:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_153:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_154:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_151:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_149:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_148
+.Lmain_150:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_146
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_147:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_150
+.Lmain_146:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_143:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_160
+    .p2align 4,,10
+.Lmain_159:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_163:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_164:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_165:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_162:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_160:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_159
+.Lmain_161:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_157
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_161
+.Lmain_157:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_130:
+    .loc 1 14 38
+    incl -196620(%rbp)
+.Lmain_128:
+    movslq -196620(%rbp), %rax
+    addq $2, %rax
+    cmpq $128, %rax
+    jl .Lmain_127
+.Lmain_129:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_125
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_171
+    .p2align 4,,10
+.Lmain_170:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_174:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_175:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_176:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_173:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_171:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_170
+.Lmain_172:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_168
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_169:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_172
+.Lmain_168:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_126:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    jmp .Lmain_129
+.Lmain_125:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_67:
+    .loc 1 13 34
+    incl -196616(%rbp)
+.Lmain_65:
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    cmpq $128, %rax
+    jl .Lmain_64
+.Lmain_66:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_62
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_182
+    .p2align 4,,10
+.Lmain_181:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_191
+    .p2align 4,,10
+.Lmain_190:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_194:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_195:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_196:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_193:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_191:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_190
+.Lmain_192:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_188
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_189:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_192
+.Lmain_188:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_185:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_203
+    .p2align 4,,10
+.Lmain_202:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_206:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_207:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_208:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_205:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_203:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_202
+.Lmain_204:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_200
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_201:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_204
+.Lmain_200:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_197:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_214
+    .p2align 4,,10
+.Lmain_213:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_217:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_218:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_219:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_216:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_214:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_213
+.Lmain_215:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_211
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_212:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_215
+.Lmain_211:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_184:
+    .loc 1 14 38
+    incl -196620(%rbp)
+.Lmain_182:
+    movslq -196620(%rbp), %rax
+    addq $2, %rax
+    cmpq $128, %rax
+    jl .Lmain_181
+.Lmain_183:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_179
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_225
+    .p2align 4,,10
+.Lmain_224:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_228:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_229:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_230:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_227:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_225:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_224
+.Lmain_226:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_222
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_223:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_226
+.Lmain_222:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    jmp .Lmain_183
+.Lmain_179:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 13 34
+    incl -196616(%rbp)
+    jmp .Lmain_66
+.Lmain_62:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 12 28
+    incl -196612(%rbp)
+    .loc 1 13 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_236
+    .p2align 4,,10
+.Lmain_235:
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_245
+    .p2align 4,,10
+.Lmain_244:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_254
+    .p2align 4,,10
+.Lmain_253:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_257:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_258:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_259:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_256:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_254:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_253
+.Lmain_255:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_251
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_252:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_255
+.Lmain_251:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_248:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_266
+    .p2align 4,,10
+.Lmain_265:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_269:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_270:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_271:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_266:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_265
+.Lmain_267:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_263
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_264:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_267
+.Lmain_263:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_260:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_277
+    .p2align 4,,10
+.Lmain_276:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_280:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_281:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_282:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_279:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_277:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_276
+.Lmain_278:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_274
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_275:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_278
+.Lmain_274:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_247:
+    .loc 1 14 38
+    incl -196620(%rbp)
+.Lmain_245:
+    movslq -196620(%rbp), %rax
+    addq $2, %rax
+    cmpq $128, %rax
+    jl .Lmain_244
+.Lmain_246:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_242
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_288
+    .p2align 4,,10
+.Lmain_287:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_291:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_292:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_293:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_290:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_288:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_287
+.Lmain_289:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_285
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_286:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_289
+.Lmain_285:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_243:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    jmp .Lmain_246
+.Lmain_242:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_239:
+    .loc 1 13 34
+    incl -196616(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_299
+    .p2align 4,,10
+.Lmain_298:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_308
+    .p2align 4,,10
+.Lmain_307:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_311:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_312:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_313:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_310:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_308:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_307
+.Lmain_309:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_305
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_306:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_309
+.Lmain_305:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_302:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_320
+    .p2align 4,,10
+.Lmain_319:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_323:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_324:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_325:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_322:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_320:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_319
+.Lmain_321:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_317
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_318:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_321
+.Lmain_317:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_314:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_331
+    .p2align 4,,10
+.Lmain_330:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_334:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_335:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_336:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_333:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_331:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_330
+.Lmain_332:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_328
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_329:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_332
+.Lmain_328:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_301:
+    .loc 1 14 38
+    incl -196620(%rbp)
+.Lmain_299:
+    movslq -196620(%rbp), %rax
+    addq $2, %rax
+    cmpq $128, %rax
+    jl .Lmain_298
+.Lmain_300:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_296
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_342
+    .p2align 4,,10
+.Lmain_341:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_345:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_346:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_347:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_344:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_342:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_341
+.Lmain_343:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_339
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_340:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_343
+.Lmain_339:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_297:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    jmp .Lmain_300
+.Lmain_296:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_238:
+    .loc 1 13 34
+    incl -196616(%rbp)
+.Lmain_236:
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    cmpq $128, %rax
+    jl .Lmain_235
+.Lmain_237:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_233
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_353
+    .p2align 4,,10
+.Lmain_352:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_362
+    .p2align 4,,10
+.Lmain_361:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_365:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_366:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_367:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_364:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_362:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_361
+.Lmain_363:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_359
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_360:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_363
+.Lmain_359:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_356:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_374
+    .p2align 4,,10
+.Lmain_373:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_377:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_378:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_379:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_376:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_374:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_373
+.Lmain_375:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_371
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_372:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_375
+.Lmain_371:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_368:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_385
+    .p2align 4,,10
+.Lmain_384:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_388:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_389:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_390:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_387:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_385:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_384
+.Lmain_386:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_382
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_383:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_386
+.Lmain_382:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_355:
+    .loc 1 14 38
+    incl -196620(%rbp)
+.Lmain_353:
+    movslq -196620(%rbp), %rax
+    addq $2, %rax
+    cmpq $128, %rax
+    jl .Lmain_352
+.Lmain_354:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_350
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_396
+    .p2align 4,,10
+.Lmain_395:
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_399:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_400:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_401:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_398:
+    .loc 1 15 42
+    incl -196624(%rbp)
+.Lmain_396:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_395
+.Lmain_397:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_393
+    .loc 1 16 21
+    movslq -196624(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_394:
+    .loc 1 15 42
+    incl -196624(%rbp)
+    jmp .Lmain_397
+.Lmain_393:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_351:
+    .loc 1 14 38
+    incl -196620(%rbp)
+    jmp .Lmain_354
+.Lmain_350:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 13 34
+    incl -196616(%rbp)
+    jmp .Lmain_237
+.Lmain_233:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_58:
+    .loc 1 12 28
+    incl -196612(%rbp)
+.Lmain_57:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196612(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_407
+    .p2align 4,,10
+.Lmain_406:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_416
+    .p2align 4,,10
+.Lmain_415:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_419:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_420:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_421:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_418:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_416:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_415
+.Lmain_417:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_413
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_414:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_417
+.Lmain_413:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_410:
+    .loc 1 22 30
+    incl -196616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_428
+    .p2align 4,,10
+.Lmain_427:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_431:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_432:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_433:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_430:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_428:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_427
+.Lmain_429:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_425
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_426:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_429
+.Lmain_425:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_422:
+    .loc 1 22 30
+    incl -196616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_440
+    .p2align 4,,10
+.Lmain_439:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_443:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_444:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_445:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_442:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_440:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_439
+.Lmain_441:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_437
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_438:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_441
+.Lmain_437:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_434:
+    .loc 1 22 30
+    incl -196616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_451
+    .p2align 4,,10
+.Lmain_450:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_454:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_455:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_456:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_453:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_451:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_450
+.Lmain_452:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_448
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_449:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_452
+.Lmain_448:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_409:
+    .loc 1 22 30
+    incl -196616(%rbp)
+.Lmain_407:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_406
+.Lmain_408:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_404
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_462
+    .p2align 4,,10
+.Lmain_461:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_465:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_466:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_467:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_464:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_462:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_461
+.Lmain_463:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_459
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_460:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_463
+.Lmain_459:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_405:
+    .loc 1 22 30
+    incl -196616(%rbp)
+    jmp .Lmain_408
+.Lmain_404:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,9914 @@
+    .file 1 "bench/kernels/matmul_128.c"
+.globl main
+.type main, @function
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $65536, %rsp
+    .loc 1 3 5
+    subq $65536, %rsp
+    .loc 1 4 5
+    subq $65536, %rsp
+    .loc 1 5 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196612(%rbp)
+    jmp .Lmain_6
+.Lmain_5:
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_15
+.Lmain_14:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 6 34
+    incl -196616(%rbp)
+.Lmain_15:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 5 30
+    incl -196612(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_27
+.Lmain_26:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 6 34
+    incl -196616(%rbp)
+.Lmain_27:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 5 30
+    incl -196612(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_38
+.Lmain_37:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 6 34
+    incl -196616(%rbp)
+.Lmain_38:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_37
+.Lmain_39:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_35
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    jmp .Lmain_39
+.Lmain_35:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 5 30
+    incl -196612(%rbp)
+.Lmain_6:
+    movslq -196612(%rbp), %rax
+    addq $2, %rax
+    cmpq $128, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $128, -196612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_49
+.Lmain_48:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 6 34
+    incl -196616(%rbp)
+.Lmain_49:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_48
+.Lmain_50:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    addl -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    imull -196616(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196616(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 6 34
+    incl -196616(%rbp)
+    jmp .Lmain_50
+.Lmain_46:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 5 30
+    incl -196612(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 12 5
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196612(%rbp)
+    jmp .Lmain_60
+.Lmain_59:
+    .loc 1 12 5
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_74
+.Lmain_73:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_83
+.Lmain_82:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_86:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_87:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_88:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_85:
+    incl -196624(%rbp)
+.Lmain_83:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_82
+.Lmain_84:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_80
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_81:
+    incl -196624(%rbp)
+    jmp .Lmain_84
+.Lmain_80:
+    addq $0, %rsp
+.Lmain_77:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_95
+.Lmain_94:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_98:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_99:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_100:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_97:
+    incl -196624(%rbp)
+.Lmain_95:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_94
+.Lmain_96:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_92
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_93:
+    incl -196624(%rbp)
+    jmp .Lmain_96
+.Lmain_92:
+    addq $0, %rsp
+.Lmain_89:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_107
+.Lmain_106:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_110:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_111:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_112:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_109:
+    incl -196624(%rbp)
+.Lmain_107:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_106
+.Lmain_108:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_104
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_105:
+    incl -196624(%rbp)
+    jmp .Lmain_108
+.Lmain_104:
+    addq $0, %rsp
+.Lmain_101:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_118
+.Lmain_117:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_121:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_122:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_123:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_120:
+    incl -196624(%rbp)
+.Lmain_118:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_117
+.Lmain_119:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_115
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_116:
+    incl -196624(%rbp)
+    jmp .Lmain_119
+.Lmain_115:
+    addq $0, %rsp
+.Lmain_76:
+    incl -196620(%rbp)
+.Lmain_74:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_73
+.Lmain_75:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_71
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_129
+.Lmain_128:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_132:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_133:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_134:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_131:
+    incl -196624(%rbp)
+.Lmain_129:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_128
+.Lmain_130:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_126
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_127:
+    incl -196624(%rbp)
+    jmp .Lmain_130
+.Lmain_126:
+    addq $0, %rsp
+.Lmain_72:
+    incl -196620(%rbp)
+    jmp .Lmain_75
+.Lmain_71:
+    addq $8, %rsp
+.Lmain_68:
+    incl -196616(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_140
+.Lmain_139:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_149
+.Lmain_148:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_152:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_153:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_154:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_151:
+    incl -196624(%rbp)
+.Lmain_149:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_148
+.Lmain_150:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_146
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_147:
+    incl -196624(%rbp)
+    jmp .Lmain_150
+.Lmain_146:
+    addq $0, %rsp
+.Lmain_143:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_161
+.Lmain_160:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_164:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_165:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_166:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_163:
+    incl -196624(%rbp)
+.Lmain_161:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_160
+.Lmain_162:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_158
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_159:
+    incl -196624(%rbp)
+    jmp .Lmain_162
+.Lmain_158:
+    addq $0, %rsp
+.Lmain_155:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_173
+.Lmain_172:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_176:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_177:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_178:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_175:
+    incl -196624(%rbp)
+.Lmain_173:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_172
+.Lmain_174:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_170
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_171:
+    incl -196624(%rbp)
+    jmp .Lmain_174
+.Lmain_170:
+    addq $0, %rsp
+.Lmain_167:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_184
+.Lmain_183:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_187:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_188:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_189:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_186:
+    incl -196624(%rbp)
+.Lmain_184:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_183
+.Lmain_185:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_181
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_182:
+    incl -196624(%rbp)
+    jmp .Lmain_185
+.Lmain_181:
+    addq $0, %rsp
+.Lmain_142:
+    incl -196620(%rbp)
+.Lmain_140:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_139
+.Lmain_141:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_137
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_195
+.Lmain_194:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_198:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_199:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_200:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_197:
+    incl -196624(%rbp)
+.Lmain_195:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_194
+.Lmain_196:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_192
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_193:
+    incl -196624(%rbp)
+    jmp .Lmain_196
+.Lmain_192:
+    addq $0, %rsp
+.Lmain_138:
+    incl -196620(%rbp)
+    jmp .Lmain_141
+.Lmain_137:
+    addq $8, %rsp
+.Lmain_67:
+    incl -196616(%rbp)
+.Lmain_66:
+    addq $0, %rsp
+.Lmain_63:
+    incl -196612(%rbp)
+    .loc 1 12 5
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_211
+.Lmain_210:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_220
+.Lmain_219:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_223:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_224:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_225:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_222:
+    incl -196624(%rbp)
+.Lmain_220:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_219
+.Lmain_221:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_217
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_218:
+    incl -196624(%rbp)
+    jmp .Lmain_221
+.Lmain_217:
+    addq $0, %rsp
+.Lmain_214:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_232
+.Lmain_231:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_235:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_236:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_237:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_234:
+    incl -196624(%rbp)
+.Lmain_232:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_231
+.Lmain_233:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_229
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_230:
+    incl -196624(%rbp)
+    jmp .Lmain_233
+.Lmain_229:
+    addq $0, %rsp
+.Lmain_226:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_244
+.Lmain_243:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_247:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_248:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_249:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_246:
+    incl -196624(%rbp)
+.Lmain_244:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_243
+.Lmain_245:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_241
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_242:
+    incl -196624(%rbp)
+    jmp .Lmain_245
+.Lmain_241:
+    addq $0, %rsp
+.Lmain_238:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_255
+.Lmain_254:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_258:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_259:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_260:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_257:
+    incl -196624(%rbp)
+.Lmain_255:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_254
+.Lmain_256:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_252
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_253:
+    incl -196624(%rbp)
+    jmp .Lmain_256
+.Lmain_252:
+    addq $0, %rsp
+.Lmain_213:
+    incl -196620(%rbp)
+.Lmain_211:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_210
+.Lmain_212:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_208
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_266
+.Lmain_265:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_269:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_270:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_271:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_268:
+    incl -196624(%rbp)
+.Lmain_266:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_265
+.Lmain_267:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_263
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_264:
+    incl -196624(%rbp)
+    jmp .Lmain_267
+.Lmain_263:
+    addq $0, %rsp
+.Lmain_209:
+    incl -196620(%rbp)
+    jmp .Lmain_212
+.Lmain_208:
+    addq $8, %rsp
+.Lmain_205:
+    incl -196616(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_277
+.Lmain_276:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_286
+.Lmain_285:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_289:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_290:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_291:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_288:
+    incl -196624(%rbp)
+.Lmain_286:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_285
+.Lmain_287:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_283
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_284:
+    incl -196624(%rbp)
+    jmp .Lmain_287
+.Lmain_283:
+    addq $0, %rsp
+.Lmain_280:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_298
+.Lmain_297:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_301:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_302:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_303:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_300:
+    incl -196624(%rbp)
+.Lmain_298:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_297
+.Lmain_299:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_295
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_296:
+    incl -196624(%rbp)
+    jmp .Lmain_299
+.Lmain_295:
+    addq $0, %rsp
+.Lmain_292:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_310
+.Lmain_309:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_313:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_314:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_315:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_312:
+    incl -196624(%rbp)
+.Lmain_310:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_309
+.Lmain_311:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_307
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_308:
+    incl -196624(%rbp)
+    jmp .Lmain_311
+.Lmain_307:
+    addq $0, %rsp
+.Lmain_304:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_321
+.Lmain_320:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_324:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_325:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_326:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_323:
+    incl -196624(%rbp)
+.Lmain_321:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_320
+.Lmain_322:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_318
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_319:
+    incl -196624(%rbp)
+    jmp .Lmain_322
+.Lmain_318:
+    addq $0, %rsp
+.Lmain_279:
+    incl -196620(%rbp)
+.Lmain_277:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_276
+.Lmain_278:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_274
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_332
+.Lmain_331:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_335:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_336:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_337:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_334:
+    incl -196624(%rbp)
+.Lmain_332:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_331
+.Lmain_333:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_329
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_330:
+    incl -196624(%rbp)
+    jmp .Lmain_333
+.Lmain_329:
+    addq $0, %rsp
+.Lmain_275:
+    incl -196620(%rbp)
+    jmp .Lmain_278
+.Lmain_274:
+    addq $8, %rsp
+.Lmain_204:
+    incl -196616(%rbp)
+.Lmain_203:
+    addq $0, %rsp
+.Lmain_62:
+    incl -196612(%rbp)
+.Lmain_60:
+    movslq -196612(%rbp), %rax
+    addq $1, %rax
+    cmpq $128, %rax
+    jl .Lmain_59
+.Lmain_61:
+    cmpl $128, -196612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_57
+    .loc 1 12 5
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_348
+.Lmain_347:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_357
+.Lmain_356:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_360:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_361:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_362:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_359:
+    incl -196624(%rbp)
+.Lmain_357:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_356
+.Lmain_358:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_354
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_355:
+    incl -196624(%rbp)
+    jmp .Lmain_358
+.Lmain_354:
+    addq $0, %rsp
+.Lmain_351:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_369
+.Lmain_368:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_372:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_373:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_374:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_371:
+    incl -196624(%rbp)
+.Lmain_369:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_368
+.Lmain_370:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_366
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_367:
+    incl -196624(%rbp)
+    jmp .Lmain_370
+.Lmain_366:
+    addq $0, %rsp
+.Lmain_363:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_381
+.Lmain_380:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_384:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_385:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_386:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_383:
+    incl -196624(%rbp)
+.Lmain_381:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_380
+.Lmain_382:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_378
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_379:
+    incl -196624(%rbp)
+    jmp .Lmain_382
+.Lmain_378:
+    addq $0, %rsp
+.Lmain_375:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_392
+.Lmain_391:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_395:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_396:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_397:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_394:
+    incl -196624(%rbp)
+.Lmain_392:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_391
+.Lmain_393:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_389
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_390:
+    incl -196624(%rbp)
+    jmp .Lmain_393
+.Lmain_389:
+    addq $0, %rsp
+.Lmain_350:
+    incl -196620(%rbp)
+.Lmain_348:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_347
+.Lmain_349:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_345
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_403
+.Lmain_402:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_406:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_407:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_408:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_405:
+    incl -196624(%rbp)
+.Lmain_403:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_402
+.Lmain_404:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_400
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_401:
+    incl -196624(%rbp)
+    jmp .Lmain_404
+.Lmain_400:
+    addq $0, %rsp
+.Lmain_346:
+    incl -196620(%rbp)
+    jmp .Lmain_349
+.Lmain_345:
+    addq $8, %rsp
+.Lmain_342:
+    incl -196616(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_414
+.Lmain_413:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_423
+.Lmain_422:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_426:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_427:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_428:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_425:
+    incl -196624(%rbp)
+.Lmain_423:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_422
+.Lmain_424:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_420
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_421:
+    incl -196624(%rbp)
+    jmp .Lmain_424
+.Lmain_420:
+    addq $0, %rsp
+.Lmain_417:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_435
+.Lmain_434:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_438:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_439:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_440:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_437:
+    incl -196624(%rbp)
+.Lmain_435:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_434
+.Lmain_436:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_432
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_433:
+    incl -196624(%rbp)
+    jmp .Lmain_436
+.Lmain_432:
+    addq $0, %rsp
+.Lmain_429:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_447
+.Lmain_446:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_450:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_451:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_452:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_449:
+    incl -196624(%rbp)
+.Lmain_447:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_446
+.Lmain_448:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_444
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_445:
+    incl -196624(%rbp)
+    jmp .Lmain_448
+.Lmain_444:
+    addq $0, %rsp
+.Lmain_441:
+    incl -196620(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_458
+.Lmain_457:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_461:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_462:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_463:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_460:
+    incl -196624(%rbp)
+.Lmain_458:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_457
+.Lmain_459:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_455
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_456:
+    incl -196624(%rbp)
+    jmp .Lmain_459
+.Lmain_455:
+    addq $0, %rsp
+.Lmain_416:
+    incl -196620(%rbp)
+.Lmain_414:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_413
+.Lmain_415:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_411
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -196624(%rbp)
+    jmp .Lmain_469
+.Lmain_468:
+    .loc 1 16 21
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_472:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_473:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_474:
+    incl -196624(%rbp)
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_471:
+    incl -196624(%rbp)
+.Lmain_469:
+    movslq -196624(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_468
+.Lmain_470:
+    cmpl $128, -196624(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_466
+    movslq -196620(%rbp), %rax
+    push %rax
+    leaq -131072(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -65536(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196624(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_467:
+    incl -196624(%rbp)
+    jmp .Lmain_470
+.Lmain_466:
+    addq $0, %rsp
+.Lmain_412:
+    incl -196620(%rbp)
+    jmp .Lmain_415
+.Lmain_411:
+    addq $8, %rsp
+.Lmain_341:
+    incl -196616(%rbp)
+.Lmain_340:
+    addq $0, %rsp
+.Lmain_58:
+    incl -196612(%rbp)
+    jmp .Lmain_61
+.Lmain_57:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196612(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -196616(%rbp)
+    jmp .Lmain_480
+.Lmain_479:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_489
+.Lmain_488:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_492:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_493:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_494:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_491:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_489:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_488
+.Lmain_490:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_486
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_487:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_490
+.Lmain_486:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_483:
+    .loc 1 22 30
+    incl -196616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_501
+.Lmain_500:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_504:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_505:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_506:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_503:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_501:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_500
+.Lmain_502:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_498
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_499:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_502
+.Lmain_498:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_495:
+    .loc 1 22 30
+    incl -196616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_513
+.Lmain_512:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_516:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_517:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_518:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_515:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_513:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_512
+.Lmain_514:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_510
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_511:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_514
+.Lmain_510:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_507:
+    .loc 1 22 30
+    incl -196616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_524
+.Lmain_523:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_527:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_528:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_529:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_526:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_524:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_523
+.Lmain_525:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_521
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_522:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_525
+.Lmain_521:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_482:
+    .loc 1 22 30
+    incl -196616(%rbp)
+.Lmain_480:
+    movslq -196616(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_479
+.Lmain_481:
+    cmpl $128, -196616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_477
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -196620(%rbp)
+    jmp .Lmain_535
+.Lmain_534:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_538:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_539:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_540:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_537:
+    .loc 1 23 34
+    incl -196620(%rbp)
+.Lmain_535:
+    movslq -196620(%rbp), %rax
+    addq $3, %rax
+    cmpq $128, %rax
+    jl .Lmain_534
+.Lmain_536:
+    cmpl $128, -196620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_532
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -196616(%rbp), %rax
+    push %rax
+    leaq -196608(%rbp), %rax
+    pop %rbx
+    shlq $9, %rbx
+    add %rbx, %rax
+    movslq -196620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -196612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -196612(%rbp)
+    addq $0, %rsp
+.Lmain_533:
+    .loc 1 23 34
+    incl -196620(%rbp)
+    jmp .Lmain_536
+.Lmain_532:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_478:
+    .loc 1 22 30
+    incl -196616(%rbp)
+    jmp .Lmain_481
+.Lmain_477:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -196612(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
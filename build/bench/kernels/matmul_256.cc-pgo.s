@@ -0,0 +1,7381 @@
+    .file 1 "bench/kernels/matmul_256.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $262144, %rsp
+    .loc 1 3 5
+    subq $262144, %rsp
+    .loc 1 4 5
+    subq $262144, %rsp
+    .loc 1 5 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786436(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 6 34
+    incl -786440(%rbp)
+.Lmain_15:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 5 30
+    incl -786436(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 6 34
+    incl -786440(%rbp)
+.Lmain_27:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 5 30
+    incl -786436(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_38
+    .p2align 4,,10
+.Lmain_37:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 6 34
+    incl -786440(%rbp)
+.Lmain_38:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_37
+.Lmain_39:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_35
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    jmp .Lmain_39
+.Lmain_35:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 5 30
+    incl -786436(%rbp)
+.Lmain_6:
+    movslq -786436(%rbp), %rax
+    addq $2, %rax
+    cmpq $256, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $256, -786436(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_49
+    .p2align 4,,10
+.Lmain_48:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 6 34
+    incl -786440(%rbp)
+.Lmain_49:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_48
+.Lmain_50:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    addl -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    imull -786440(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 6 34
+    incl -786440(%rbp)
+    jmp .Lmain_50
+.Lmain_46:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 5 30
+    incl -786436(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 12 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786436(%rbp)
+    jmp .Lmain_60
+    .p2align 4,,10
+.Lmain_59:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_69
+    .p2align 4,,10
+.Lmain_68:
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_78
+    .p2align 4,,10
+.Lmain_77:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_81:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_82:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_83:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_80:
+    incl -786444(%rbp)
+.Lmain_78:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_77
+.Lmain_79:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_75
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_76:
+    incl -786444(%rbp)
+    jmp .Lmain_79
+.Lmain_75:
+    addq $8, %rsp
+.Lmain_72:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_90
+    .p2align 4,,10
+.Lmain_89:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_93:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_94:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_95:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_92:
+    incl -786444(%rbp)
+.Lmain_90:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_89
+.Lmain_91:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_87
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_88:
+    incl -786444(%rbp)
+    jmp .Lmain_91
+.Lmain_87:
+    addq $8, %rsp
+.Lmain_84:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_102
+    .p2align 4,,10
+.Lmain_101:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_105:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_106:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_107:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_104:
+    incl -786444(%rbp)
+.Lmain_102:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_101
+.Lmain_103:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_99
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_100:
+    incl -786444(%rbp)
+    jmp .Lmain_103
+.Lmain_99:
+    addq $8, %rsp
+.Lmain_96:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_113
+    .p2align 4,,10
+.Lmain_112:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_116:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_117:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_118:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_115:
+    incl -786444(%rbp)
+.Lmain_113:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_112
+.Lmain_114:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_110
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_111:
+    incl -786444(%rbp)
+    jmp .Lmain_114
+.Lmain_110:
+    addq $8, %rsp
+.Lmain_71:
+    incl -786440(%rbp)
+.Lmain_69:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_68
+.Lmain_70:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_66
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_124
+    .p2align 4,,10
+.Lmain_123:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_127:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_128:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_129:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_126:
+    incl -786444(%rbp)
+.Lmain_124:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_123
+.Lmain_125:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_121
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_122:
+    incl -786444(%rbp)
+    jmp .Lmain_125
+.Lmain_121:
+    addq $8, %rsp
+.Lmain_67:
+    incl -786440(%rbp)
+    jmp .Lmain_70
+.Lmain_66:
+    addq $0, %rsp
+.Lmain_63:
+    incl -786436(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_136
+    .p2align 4,,10
+.Lmain_135:
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_145
+    .p2align 4,,10
+.Lmain_144:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_148:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_149:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_150:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_147:
+    incl -786444(%rbp)
+.Lmain_145:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_144
+.Lmain_146:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_142
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_143:
+    incl -786444(%rbp)
+    jmp .Lmain_146
+.Lmain_142:
+    addq $8, %rsp
+.Lmain_139:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_157
+    .p2align 4,,10
+.Lmain_156:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_160:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_161:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_162:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_159:
+    incl -786444(%rbp)
+.Lmain_157:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_156
+.Lmain_158:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_154
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_155:
+    incl -786444(%rbp)
+    jmp .Lmain_158
+.Lmain_154:
+    addq $8, %rsp
+.Lmain_151:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_169
+    .p2align 4,,10
+.Lmain_168:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_172:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_173:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_174:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_171:
+    incl -786444(%rbp)
+.Lmain_169:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_168
+.Lmain_170:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_166
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_167:
+    incl -786444(%rbp)
+    jmp .Lmain_170
+.Lmain_166:
+    addq $8, %rsp
+.Lmain_163:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_180
+    .p2align 4,,10
+.Lmain_179:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_183:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_184:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_185:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_182:
+    incl -786444(%rbp)
+.Lmain_180:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_179
+.Lmain_181:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_177
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_178:
+    incl -786444(%rbp)
+    jmp .Lmain_181
+.Lmain_177:
+    addq $8, %rsp
+.Lmain_138:
+    incl -786440(%rbp)
+.Lmain_136:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_135
+.Lmain_137:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_133
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_191
+    .p2align 4,,10
+.Lmain_190:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_194:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_195:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_196:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_193:
+    incl -786444(%rbp)
+.Lmain_191:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_190
+.Lmain_192:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_188
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_189:
+    incl -786444(%rbp)
+    jmp .Lmain_192
+.Lmain_188:
+    addq $8, %rsp
+.Lmain_134:
+    incl -786440(%rbp)
+    jmp .Lmain_137
+.Lmain_133:
+    addq $0, %rsp
+.Lmain_130:
+    incl -786436(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_202
+    .p2align 4,,10
+.Lmain_201:
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_211
+    .p2align 4,,10
+.Lmain_210:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_214:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_215:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_216:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_213:
+    incl -786444(%rbp)
+.Lmain_211:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_210
+.Lmain_212:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_208
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_209:
+    incl -786444(%rbp)
+    jmp .Lmain_212
+.Lmain_208:
+    addq $8, %rsp
+.Lmain_205:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_223
+    .p2align 4,,10
+.Lmain_222:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_226:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_227:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_228:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_225:
+    incl -786444(%rbp)
+.Lmain_223:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_222
+.Lmain_224:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_220
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_221:
+    incl -786444(%rbp)
+    jmp .Lmain_224
+.Lmain_220:
+    addq $8, %rsp
+.Lmain_217:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_235
+    .p2align 4,,10
+.Lmain_234:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_238:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_239:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_240:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_237:
+    incl -786444(%rbp)
+.Lmain_235:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_234
+.Lmain_236:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_232
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_233:
+    incl -786444(%rbp)
+    jmp .Lmain_236
+.Lmain_232:
+    addq $8, %rsp
+.Lmain_229:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_246
+    .p2align 4,,10
+.Lmain_245:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_249:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_250:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_251:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_248:
+    incl -786444(%rbp)
+.Lmain_246:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_245
+.Lmain_247:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_243
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_244:
+    incl -786444(%rbp)
+    jmp .Lmain_247
+.Lmain_243:
+    addq $8, %rsp
+.Lmain_204:
+    incl -786440(%rbp)
+.Lmain_202:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_201
+.Lmain_203:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_199
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_257
+    .p2align 4,,10
+.Lmain_256:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_260:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_261:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_262:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_259:
+    incl -786444(%rbp)
+.Lmain_257:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_256
+.Lmain_258:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_254
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_255:
+    incl -786444(%rbp)
+    jmp .Lmain_258
+.Lmain_254:
+    addq $8, %rsp
+.Lmain_200:
+    incl -786440(%rbp)
+    jmp .Lmain_203
+.Lmain_199:
+    addq $0, %rsp
+.Lmain_62:
+    incl -786436(%rbp)
+.Lmain_60:
+    movslq -786436(%rbp), %rax
+    addq $2, %rax
+    cmpq $256, %rax
+    jl .Lmain_59
+.Lmain_61:
+    cmpl $256, -786436(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_57
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_268
+    .p2align 4,,10
+.Lmain_267:
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_277
+    .p2align 4,,10
+.Lmain_276:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_280:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_281:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_282:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_279:
+    incl -786444(%rbp)
+.Lmain_277:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_276
+.Lmain_278:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_274
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_275:
+    incl -786444(%rbp)
+    jmp .Lmain_278
+.Lmain_274:
+    addq $8, %rsp
+.Lmain_271:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_289
+    .p2align 4,,10
+.Lmain_288:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_292:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_293:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_294:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_291:
+    incl -786444(%rbp)
+.Lmain_289:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_288
+.Lmain_290:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_286
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_287:
+    incl -786444(%rbp)
+    jmp .Lmain_290
+.Lmain_286:
+    addq $8, %rsp
+.Lmain_283:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_301
+    .p2align 4,,10
+.Lmain_300:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_304:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_305:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_306:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_303:
+    incl -786444(%rbp)
+.Lmain_301:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_300
+.Lmain_302:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_298
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_299:
+    incl -786444(%rbp)
+    jmp .Lmain_302
+.Lmain_298:
+    addq $8, %rsp
+.Lmain_295:
+    incl -786440(%rbp)
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_312
+    .p2align 4,,10
+.Lmain_311:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_315:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_316:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_317:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_314:
+    incl -786444(%rbp)
+.Lmain_312:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_311
+.Lmain_313:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_309
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_310:
+    incl -786444(%rbp)
+    jmp .Lmain_313
+.Lmain_309:
+    addq $8, %rsp
+.Lmain_270:
+    incl -786440(%rbp)
+.Lmain_268:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_267
+.Lmain_269:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_265
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_323
+    .p2align 4,,10
+.Lmain_322:
+    .loc 1 15 17
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_326:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_327:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_328:
+    incl -786444(%rbp)
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_325:
+    incl -786444(%rbp)
+.Lmain_323:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_322
+.Lmain_324:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_320
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786440(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_321:
+    incl -786444(%rbp)
+    jmp .Lmain_324
+.Lmain_320:
+    addq $8, %rsp
+.Lmain_266:
+    incl -786440(%rbp)
+    jmp .Lmain_269
+.Lmain_265:
+    addq $0, %rsp
+.Lmain_58:
+    incl -786436(%rbp)
+    jmp .Lmain_61
+.Lmain_57:
+    addq $8, %rsp
+    .loc 1 19 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786436(%rbp)
+    .loc 1 20 5
+    movq $0, %rax
+    movl %eax, -786440(%rbp)
+    jmp .Lmain_334
+    .p2align 4,,10
+.Lmain_333:
+    .loc 1 21 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_343
+    .p2align 4,,10
+.Lmain_342:
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_346:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_347:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_348:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_345:
+    .loc 1 21 34
+    incl -786444(%rbp)
+.Lmain_343:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_342
+.Lmain_344:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_340
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_341:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    jmp .Lmain_344
+.Lmain_340:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_337:
+    .loc 1 20 30
+    incl -786440(%rbp)
+    .loc 1 21 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_355
+    .p2align 4,,10
+.Lmain_354:
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_358:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_359:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_360:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_357:
+    .loc 1 21 34
+    incl -786444(%rbp)
+.Lmain_355:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_354
+.Lmain_356:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_352
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_353:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    jmp .Lmain_356
+.Lmain_352:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_349:
+    .loc 1 20 30
+    incl -786440(%rbp)
+    .loc 1 21 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_367
+    .p2align 4,,10
+.Lmain_366:
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_370:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_371:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_372:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_369:
+    .loc 1 21 34
+    incl -786444(%rbp)
+.Lmain_367:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_366
+.Lmain_368:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_364
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_365:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    jmp .Lmain_368
+.Lmain_364:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_361:
+    .loc 1 20 30
+    incl -786440(%rbp)
+    .loc 1 21 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_378
+    .p2align 4,,10
+.Lmain_377:
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_381:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_382:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_383:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_380:
+    .loc 1 21 34
+    incl -786444(%rbp)
+.Lmain_378:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_377
+.Lmain_379:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_375
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_376:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    jmp .Lmain_379
+.Lmain_375:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_336:
+    .loc 1 20 30
+    incl -786440(%rbp)
+.Lmain_334:
+    movslq -786440(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_333
+.Lmain_335:
+    cmpl $256, -786440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_331
+    .loc 1 21 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -786444(%rbp)
+    jmp .Lmain_389
+    .p2align 4,,10
+.Lmain_388:
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_392:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_393:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_394:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_391:
+    .loc 1 21 34
+    incl -786444(%rbp)
+.Lmain_389:
+    movslq -786444(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_388
+.Lmain_390:
+    cmpl $256, -786444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_386
+    .loc 1 22 13
+    movq $1000003, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -786440(%rbp), %rax
+    push %rax
+    leaq -786432(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -786444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -786436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -786436(%rbp)
+    addq $0, %rsp
+.Lmain_387:
+    .loc 1 21 34
+    incl -786444(%rbp)
+    jmp .Lmain_390
+.Lmain_386:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_332:
+    .loc 1 20 30
+    incl -786440(%rbp)
+    jmp .Lmain_335
+.Lmain_331:
+    addq $0, %rsp
+    .loc 1 25 5
+    movq $256, %rax
+    push %rax
+    movslq -786436(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,12014 @@
+    .file 1 "bench/kernels/matmul_64.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $16384, %rsp
+    .loc 1 3 5
+    subq $16384, %rsp
+    .loc 1 4 5
+    subq $16384, %rsp
+    .loc 1 5 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49156(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 6 33
+    incl -49160(%rbp)
+.Lmain_15:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 5 29
+    incl -49156(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 6 33
+    incl -49160(%rbp)
+.Lmain_27:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 5 29
+    incl -49156(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_38
+    .p2align 4,,10
+.Lmain_37:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 6 33
+    incl -49160(%rbp)
+.Lmain_38:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_37
+.Lmain_39:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_35
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    jmp .Lmain_39
+.Lmain_35:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 5 29
+    incl -49156(%rbp)
+.Lmain_6:
+    movslq -49156(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $64, -49156(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_49
+    .p2align 4,,10
+.Lmain_48:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 6 33
+    incl -49160(%rbp)
+.Lmain_49:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_48
+.Lmain_50:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    jmp .Lmain_50
+.Lmain_46:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 5 29
+    incl -49156(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 12 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49156(%rbp)
+    jmp .Lmain_60
+    .p2align 4,,10
+.Lmain_59:
+    .loc 1 13 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_69
+    .p2align 4,,10
+.Lmain_68:
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_78
+    .p2align 4,,10
+.Lmain_77:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_87
+    .p2align 4,,10
+.Lmain_86:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_90:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_91:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_92:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_89:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_87:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_86
+.Lmain_88:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_84
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_85:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_88
+.Lmain_84:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_99
+    .p2align 4,,10
+.Lmain_98:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_102:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_103:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_104:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_101:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_99:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_98
+.Lmain_100:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_96
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_97:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_100
+.Lmain_96:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_93:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_110
+    .p2align 4,,10
+.Lmain_109:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_113:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_114:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_112:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_110:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_109
+.Lmain_111:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_107
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_108:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_111
+.Lmain_107:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_80:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_78:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_77
+.Lmain_79:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_75
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_121
+    .p2align 4,,10
+.Lmain_120:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_124:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_125:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_126:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_123:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_121:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_120
+.Lmain_122:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_118
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_119:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_122
+.Lmain_118:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_76:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_79
+.Lmain_75:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_72:
+    .loc 1 13 33
+    incl -49160(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_132
+    .p2align 4,,10
+.Lmain_131:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_141
+    .p2align 4,,10
+.Lmain_140:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_144:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_145:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_146:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_143:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_141:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_140
+.Lmain_142:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_138
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_139:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_142
+.Lmain_138:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_135:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_153
+    .p2align 4,,10
+.Lmain_152:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_156:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_157:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_155:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_153:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_152
+.Lmain_154:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_150
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_151:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_154
+.Lmain_150:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_147:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_164
+    .p2align 4,,10
+.Lmain_163:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_167:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_168:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_169:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_166:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_164:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_163
+.Lmain_165:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_161
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_162:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_165
+.Lmain_161:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_134:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_132:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_131
+.Lmain_133:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_129
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_175
+    .p2align 4,,10
+.Lmain_174:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_178:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_179:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_177:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_175:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_174
+.Lmain_176:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_172
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_173:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_176
+.Lmain_172:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_130:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_133
+.Lmain_129:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_71:
+    .loc 1 13 33
+    incl -49160(%rbp)
+.Lmain_69:
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    cmpq $64, %rax
+    jl .Lmain_68
+.Lmain_70:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_66
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_186
+    .p2align 4,,10
+.Lmain_185:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_195
+    .p2align 4,,10
+.Lmain_194:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_198:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_199:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_200:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_197:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_195:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_194
+.Lmain_196:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_192
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_193:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_196
+.Lmain_192:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_189:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_207
+    .p2align 4,,10
+.Lmain_206:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_210:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_211:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_212:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_209:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_207:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_206
+.Lmain_208:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_204
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_205:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_208
+.Lmain_204:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_201:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_218
+    .p2align 4,,10
+.Lmain_217:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_221:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_222:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_223:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_220:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_218:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_217
+.Lmain_219:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_215
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_216:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_219
+.Lmain_215:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_188:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_186:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_185
+.Lmain_187:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_183
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_229
+    .p2align 4,,10
+.Lmain_228:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_232:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_233:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_231:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_229:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_228
+.Lmain_230:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_226
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_227:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_230
+.Lmain_226:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_184:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_187
+.Lmain_183:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_67:
+    .loc 1 13 33
+    incl -49160(%rbp)
+    jmp .Lmain_70
+.Lmain_66:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 12 29
+    incl -49156(%rbp)
+    .loc 1 13 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_240
+    .p2align 4,,10
+.Lmain_239:
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_249
+    .p2align 4,,10
+.Lmain_248:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_258
+    .p2align 4,,10
+.Lmain_257:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_261:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_262:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_263:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_260:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_258:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_257
+.Lmain_259:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_255
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_256:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_259
+.Lmain_255:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_252:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_270
+    .p2align 4,,10
+.Lmain_269:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_273:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_274:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_275:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_272:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_270:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_269
+.Lmain_271:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_267
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_271
+.Lmain_267:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_264:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_281
+    .p2align 4,,10
+.Lmain_280:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_284:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_285:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_286:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_283:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_281:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_280
+.Lmain_282:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_278
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_279:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_282
+.Lmain_278:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_251:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_249:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_248
+.Lmain_250:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_246
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_292
+    .p2align 4,,10
+.Lmain_291:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_295:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_296:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_297:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_294:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_292:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_291
+.Lmain_293:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_289
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_290:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_293
+.Lmain_289:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_247:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_250
+.Lmain_246:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_243:
+    .loc 1 13 33
+    incl -49160(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_303
+    .p2align 4,,10
+.Lmain_302:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_312
+    .p2align 4,,10
+.Lmain_311:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_315:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_316:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_317:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_314:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_312:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_311
+.Lmain_313:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_309
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_310:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_313
+.Lmain_309:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_306:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_324
+    .p2align 4,,10
+.Lmain_323:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_327:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_328:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_329:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_326:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_324:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_323
+.Lmain_325:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_321
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_322:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_325
+.Lmain_321:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_318:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_335
+    .p2align 4,,10
+.Lmain_334:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_338:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_339:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_340:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_337:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_335:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_334
+.Lmain_336:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_332
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_333:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_336
+.Lmain_332:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_305:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_303:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_302
+.Lmain_304:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_300
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_346
+    .p2align 4,,10
+.Lmain_345:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_349:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_350:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_351:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_348:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_346:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_345
+.Lmain_347:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_343
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_344:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_347
+.Lmain_343:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_301:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_304
+.Lmain_300:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_242:
+    .loc 1 13 33
+    incl -49160(%rbp)
+.Lmain_240:
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    cmpq $64, %rax
+    jl .Lmain_239
+.Lmain_241:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_237
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_357
+    .p2align 4,,10
+.Lmain_356:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_366
+    .p2align 4,,10
+.Lmain_365:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_369:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_370:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_371:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_368:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_366:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_365
+.Lmain_367:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_363
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_364:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_367
+.Lmain_363:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_360:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_378
+    .p2align 4,,10
+.Lmain_377:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_381:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_382:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_383:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_380:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_378:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_377
+.Lmain_379:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_375
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_376:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_379
+.Lmain_375:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_372:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_389
+    .p2align 4,,10
+.Lmain_388:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_392:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_393:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_394:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_391:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_389:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_388
+.Lmain_390:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_386
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_387:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_390
+.Lmain_386:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_359:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_357:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_356
+.Lmain_358:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_354
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_400
+    .p2align 4,,10
+.Lmain_399:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_403:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_404:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_405:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_402:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_400:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_399
+.Lmain_401:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_397
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_398:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_401
+.Lmain_397:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_355:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_358
+.Lmain_354:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_238:
+    .loc 1 13 33
+    incl -49160(%rbp)
+    jmp .Lmain_241
+.Lmain_237:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_62:
+    .loc 1 12 29
+    incl -49156(%rbp)
+.Lmain_60:
+    movslq -49156(%rbp), %rax
+    addq $1, %rax
+    cmpq $16, %rax
+    jl .Lmain_59
+.Lmain_61:
+    cmpl $16, -49156(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_57
+    .loc 1 13 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_411
+    .p2align 4,,10
+.Lmain_410:
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_420
+    .p2align 4,,10
+.Lmain_419:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_429
+    .p2align 4,,10
+.Lmain_428:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_432:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_433:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_434:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_431:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_429:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_428
+.Lmain_430:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_426
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_427:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_430
+.Lmain_426:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_423:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_441
+    .p2align 4,,10
+.Lmain_440:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_444:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_445:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_446:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_443:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_441:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_440
+.Lmain_442:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_438
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_439:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_442
+.Lmain_438:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_435:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_452
+    .p2align 4,,10
+.Lmain_451:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_455:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_456:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_457:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_454:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_452:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_451
+.Lmain_453:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_449
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_450:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_453
+.Lmain_449:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_422:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_420:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_419
+.Lmain_421:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_417
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_463
+    .p2align 4,,10
+.Lmain_462:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_466:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_467:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_468:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_465:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_463:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_462
+.Lmain_464:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_460
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_461:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_464
+.Lmain_460:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_418:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_421
+.Lmain_417:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_414:
+    .loc 1 13 33
+    incl -49160(%rbp)
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_474
+    .p2align 4,,10
+.Lmain_473:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_483
+    .p2align 4,,10
+.Lmain_482:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_486:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_487:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_488:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_485:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_483:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_482
+.Lmain_484:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_480
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_481:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_484
+.Lmain_480:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_477:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_495
+    .p2align 4,,10
+.Lmain_494:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_498:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_499:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_500:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_497:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_495:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_494
+.Lmain_496:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_492
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_493:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_496
+.Lmain_492:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_489:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_506
+    .p2align 4,,10
+.Lmain_505:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_509:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_510:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_511:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_508:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_506:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_505
+.Lmain_507:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_503
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_504:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_507
+.Lmain_503:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_476:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_474:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_473
+.Lmain_475:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_471
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_517
+    .p2align 4,,10
+.Lmain_516:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_520:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_521:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_522:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_519:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_517:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_516
+.Lmain_518:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_514
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_515:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_518
+.Lmain_514:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_472:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_475
+.Lmain_471:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_413:
+    .loc 1 13 33
+    incl -49160(%rbp)
+.Lmain_411:
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    cmpq $64, %rax
+    jl .Lmain_410
+.Lmain_412:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_408
+    .loc 1 14 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_528
+    .p2align 4,,10
+.Lmain_527:
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_537
+    .p2align 4,,10
+.Lmain_536:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_540:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_541:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_542:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_539:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_537:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_536
+.Lmain_538:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_534
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_535:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_538
+.Lmain_534:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_531:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_549
+    .p2align 4,,10
+.Lmain_548:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_552:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_553:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_554:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_551:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_549:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_548
+.Lmain_550:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_546
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_547:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_550
+.Lmain_546:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_543:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_560
+    .p2align 4,,10
+.Lmain_559:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_563:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_564:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_565:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_562:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_560:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_559
+.Lmain_561:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_557
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_558:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_561
+.Lmain_557:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_530:
+    .loc 1 14 37
+    incl -49164(%rbp)
+.Lmain_528:
+    movslq -49164(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_527
+.Lmain_529:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_525
+    .loc 1 15 17
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_571
+    .p2align 4,,10
+.Lmain_570:
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_574:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_575:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_576:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_573:
+    .loc 1 15 41
+    incl -49168(%rbp)
+.Lmain_571:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_570
+.Lmain_572:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_568
+    .loc 1 16 21
+    movslq -49168(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_569:
+    .loc 1 15 41
+    incl -49168(%rbp)
+    jmp .Lmain_572
+.Lmain_568:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_526:
+    .loc 1 14 37
+    incl -49164(%rbp)
+    jmp .Lmain_529
+.Lmain_525:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_409:
+    .loc 1 13 33
+    incl -49160(%rbp)
+    jmp .Lmain_412
+.Lmain_408:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_58:
+    .loc 1 12 29
+    incl -49156(%rbp)
+    jmp .Lmain_61
+.Lmain_57:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49156(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_582
+    .p2align 4,,10
+.Lmain_581:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_591
+    .p2align 4,,10
+.Lmain_590:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_594:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_595:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_596:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_593:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_591:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_590
+.Lmain_592:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_588
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_589:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_592
+.Lmain_588:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_585:
+    .loc 1 22 29
+    incl -49160(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_603
+    .p2align 4,,10
+.Lmain_602:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_606:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_607:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_608:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_605:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_603:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_602
+.Lmain_604:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_600
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_601:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_604
+.Lmain_600:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_597:
+    .loc 1 22 29
+    incl -49160(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_615
+    .p2align 4,,10
+.Lmain_614:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_618:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_619:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_620:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_617:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_615:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_614
+.Lmain_616:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_612
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_613:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_616
+.Lmain_612:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_609:
+    .loc 1 22 29
+    incl -49160(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_626
+    .p2align 4,,10
+.Lmain_625:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_629:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_630:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_631:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_628:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_626:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_625
+.Lmain_627:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_623
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_624:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_627
+.Lmain_623:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_584:
+    .loc 1 22 29
+    incl -49160(%rbp)
+.Lmain_582:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_581
+.Lmain_583:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_579
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_637
+    .p2align 4,,10
+.Lmain_636:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_640:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_641:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_642:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_639:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_637:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_636
+.Lmain_638:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_634
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_635:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_638
+.Lmain_634:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_580:
+    .loc 1 22 29
+    incl -49160(%rbp)
+    jmp .Lmain_583
+.Lmain_579:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,17648 @@
+    .file 1 "bench/kernels/matmul_64.c"
+.globl main
+.type main, @function
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $16384, %rsp
+    .loc 1 3 5
+    subq $16384, %rsp
+    .loc 1 4 5
+    subq $16384, %rsp
+    .loc 1 5 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49156(%rbp)
+    jmp .Lmain_6
+.Lmain_5:
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_15
+.Lmain_14:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 6 33
+    incl -49160(%rbp)
+.Lmain_15:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 5 29
+    incl -49156(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_27
+.Lmain_26:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 6 33
+    incl -49160(%rbp)
+.Lmain_27:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 5 29
+    incl -49156(%rbp)
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_38
+.Lmain_37:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 6 33
+    incl -49160(%rbp)
+.Lmain_38:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_37
+.Lmain_39:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_35
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    jmp .Lmain_39
+.Lmain_35:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 5 29
+    incl -49156(%rbp)
+.Lmain_6:
+    movslq -49156(%rbp), %rax
+    addq $2, %rax
+    cmpq $64, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $64, -49156(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 6 9
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_49
+.Lmain_48:
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 6 33
+    incl -49160(%rbp)
+.Lmain_49:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_48
+.Lmain_50:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 7 13
+    movq $10, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    addl -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 8 13
+    movq $7, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    imull -49160(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    .loc 1 9 13
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49160(%rbp), %rcx
+    movl $0, (%rax,%rcx,4)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 6 33
+    incl -49160(%rbp)
+    jmp .Lmain_50
+.Lmain_46:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 5 29
+    incl -49156(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 12 5
+    .loc 1 13 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49156(%rbp)
+    jmp .Lmain_60
+.Lmain_59:
+    .loc 1 12 5
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_69
+.Lmain_68:
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_78
+.Lmain_77:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_87
+.Lmain_86:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_90:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_91:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_92:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_89:
+    incl -49168(%rbp)
+.Lmain_87:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_86
+.Lmain_88:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_84
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_85:
+    incl -49168(%rbp)
+    jmp .Lmain_88
+.Lmain_84:
+    addq $0, %rsp
+.Lmain_81:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_99
+.Lmain_98:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_102:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_103:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_104:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_101:
+    incl -49168(%rbp)
+.Lmain_99:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_98
+.Lmain_100:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_96
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_97:
+    incl -49168(%rbp)
+    jmp .Lmain_100
+.Lmain_96:
+    addq $0, %rsp
+.Lmain_93:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_111
+.Lmain_110:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_114:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_115:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_116:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_113:
+    incl -49168(%rbp)
+.Lmain_111:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_110
+.Lmain_112:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_108
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_109:
+    incl -49168(%rbp)
+    jmp .Lmain_112
+.Lmain_108:
+    addq $0, %rsp
+.Lmain_105:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_122
+.Lmain_121:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_125:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_126:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_127:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_124:
+    incl -49168(%rbp)
+.Lmain_122:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_121
+.Lmain_123:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_119
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_120:
+    incl -49168(%rbp)
+    jmp .Lmain_123
+.Lmain_119:
+    addq $0, %rsp
+.Lmain_80:
+    incl -49164(%rbp)
+.Lmain_78:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_77
+.Lmain_79:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_75
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_133
+.Lmain_132:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_136:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_137:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_138:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_135:
+    incl -49168(%rbp)
+.Lmain_133:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_132
+.Lmain_134:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_130
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_131:
+    incl -49168(%rbp)
+    jmp .Lmain_134
+.Lmain_130:
+    addq $0, %rsp
+.Lmain_76:
+    incl -49164(%rbp)
+    jmp .Lmain_79
+.Lmain_75:
+    addq $8, %rsp
+.Lmain_72:
+    incl -49160(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_145
+.Lmain_144:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_154
+.Lmain_153:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_157:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_158:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_159:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_156:
+    incl -49168(%rbp)
+.Lmain_154:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_153
+.Lmain_155:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_151
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_152:
+    incl -49168(%rbp)
+    jmp .Lmain_155
+.Lmain_151:
+    addq $0, %rsp
+.Lmain_148:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_166
+.Lmain_165:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_169:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_170:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_171:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_168:
+    incl -49168(%rbp)
+.Lmain_166:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_165
+.Lmain_167:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_163
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_164:
+    incl -49168(%rbp)
+    jmp .Lmain_167
+.Lmain_163:
+    addq $0, %rsp
+.Lmain_160:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_178
+.Lmain_177:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_181:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_182:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_183:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_180:
+    incl -49168(%rbp)
+.Lmain_178:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_177
+.Lmain_179:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_175
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_176:
+    incl -49168(%rbp)
+    jmp .Lmain_179
+.Lmain_175:
+    addq $0, %rsp
+.Lmain_172:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_189
+.Lmain_188:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_192:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_193:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_194:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_191:
+    incl -49168(%rbp)
+.Lmain_189:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_188
+.Lmain_190:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_186
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_187:
+    incl -49168(%rbp)
+    jmp .Lmain_190
+.Lmain_186:
+    addq $0, %rsp
+.Lmain_147:
+    incl -49164(%rbp)
+.Lmain_145:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_144
+.Lmain_146:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_142
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_200
+.Lmain_199:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_203:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_204:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_205:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_202:
+    incl -49168(%rbp)
+.Lmain_200:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_199
+.Lmain_201:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_197
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_198:
+    incl -49168(%rbp)
+    jmp .Lmain_201
+.Lmain_197:
+    addq $0, %rsp
+.Lmain_143:
+    incl -49164(%rbp)
+    jmp .Lmain_146
+.Lmain_142:
+    addq $8, %rsp
+.Lmain_139:
+    incl -49160(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_211
+.Lmain_210:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_220
+.Lmain_219:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_223:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_224:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_225:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_222:
+    incl -49168(%rbp)
+.Lmain_220:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_219
+.Lmain_221:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_217
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_218:
+    incl -49168(%rbp)
+    jmp .Lmain_221
+.Lmain_217:
+    addq $0, %rsp
+.Lmain_214:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_232
+.Lmain_231:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_235:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_236:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_237:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_234:
+    incl -49168(%rbp)
+.Lmain_232:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_231
+.Lmain_233:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_229
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_230:
+    incl -49168(%rbp)
+    jmp .Lmain_233
+.Lmain_229:
+    addq $0, %rsp
+.Lmain_226:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_244
+.Lmain_243:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_247:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_248:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_249:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_246:
+    incl -49168(%rbp)
+.Lmain_244:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_243
+.Lmain_245:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_241
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_242:
+    incl -49168(%rbp)
+    jmp .Lmain_245
+.Lmain_241:
+    addq $0, %rsp
+.Lmain_238:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_255
+.Lmain_254:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_258:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_259:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_260:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_257:
+    incl -49168(%rbp)
+.Lmain_255:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_254
+.Lmain_256:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_252
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_253:
+    incl -49168(%rbp)
+    jmp .Lmain_256
+.Lmain_252:
+    addq $0, %rsp
+.Lmain_213:
+    incl -49164(%rbp)
+.Lmain_211:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_210
+.Lmain_212:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_208
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_266
+.Lmain_265:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_269:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_270:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_271:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_268:
+    incl -49168(%rbp)
+.Lmain_266:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_265
+.Lmain_267:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_263
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_264:
+    incl -49168(%rbp)
+    jmp .Lmain_267
+.Lmain_263:
+    addq $0, %rsp
+.Lmain_209:
+    incl -49164(%rbp)
+    jmp .Lmain_212
+.Lmain_208:
+    addq $8, %rsp
+.Lmain_71:
+    incl -49160(%rbp)
+.Lmain_69:
+    movslq -49160(%rbp), %rax
+    addq $2, %rax
+    cmpq $16, %rax
+    jl .Lmain_68
+.Lmain_70:
+    cmpl $16, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_66
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_277
+.Lmain_276:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_286
+.Lmain_285:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_289:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_290:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_291:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_288:
+    incl -49168(%rbp)
+.Lmain_286:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_285
+.Lmain_287:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_283
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_284:
+    incl -49168(%rbp)
+    jmp .Lmain_287
+.Lmain_283:
+    addq $0, %rsp
+.Lmain_280:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_298
+.Lmain_297:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_301:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_302:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_303:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_300:
+    incl -49168(%rbp)
+.Lmain_298:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_297
+.Lmain_299:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_295
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_296:
+    incl -49168(%rbp)
+    jmp .Lmain_299
+.Lmain_295:
+    addq $0, %rsp
+.Lmain_292:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_310
+.Lmain_309:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_313:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_314:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_315:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_312:
+    incl -49168(%rbp)
+.Lmain_310:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_309
+.Lmain_311:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_307
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_308:
+    incl -49168(%rbp)
+    jmp .Lmain_311
+.Lmain_307:
+    addq $0, %rsp
+.Lmain_304:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_321
+.Lmain_320:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_324:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_325:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_326:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_323:
+    incl -49168(%rbp)
+.Lmain_321:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_320
+.Lmain_322:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_318
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_319:
+    incl -49168(%rbp)
+    jmp .Lmain_322
+.Lmain_318:
+    addq $0, %rsp
+.Lmain_279:
+    incl -49164(%rbp)
+.Lmain_277:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_276
+.Lmain_278:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_274
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_332
+.Lmain_331:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_335:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_336:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_337:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_334:
+    incl -49168(%rbp)
+.Lmain_332:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_331
+.Lmain_333:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_329
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_330:
+    incl -49168(%rbp)
+    jmp .Lmain_333
+.Lmain_329:
+    addq $0, %rsp
+.Lmain_275:
+    incl -49164(%rbp)
+    jmp .Lmain_278
+.Lmain_274:
+    addq $8, %rsp
+.Lmain_67:
+    incl -49160(%rbp)
+    jmp .Lmain_70
+.Lmain_66:
+    addq $0, %rsp
+.Lmain_63:
+    incl -49156(%rbp)
+    .loc 1 12 5
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_343
+.Lmain_342:
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_352
+.Lmain_351:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_361
+.Lmain_360:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_364:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_365:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_366:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_363:
+    incl -49168(%rbp)
+.Lmain_361:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_360
+.Lmain_362:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_358
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_359:
+    incl -49168(%rbp)
+    jmp .Lmain_362
+.Lmain_358:
+    addq $0, %rsp
+.Lmain_355:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_373
+.Lmain_372:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_376:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_377:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_378:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_375:
+    incl -49168(%rbp)
+.Lmain_373:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_372
+.Lmain_374:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_370
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_371:
+    incl -49168(%rbp)
+    jmp .Lmain_374
+.Lmain_370:
+    addq $0, %rsp
+.Lmain_367:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_385
+.Lmain_384:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_388:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_389:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_390:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_387:
+    incl -49168(%rbp)
+.Lmain_385:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_384
+.Lmain_386:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_382
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_383:
+    incl -49168(%rbp)
+    jmp .Lmain_386
+.Lmain_382:
+    addq $0, %rsp
+.Lmain_379:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_396
+.Lmain_395:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_399:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_400:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_401:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_398:
+    incl -49168(%rbp)
+.Lmain_396:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_395
+.Lmain_397:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_393
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_394:
+    incl -49168(%rbp)
+    jmp .Lmain_397
+.Lmain_393:
+    addq $0, %rsp
+.Lmain_354:
+    incl -49164(%rbp)
+.Lmain_352:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_351
+.Lmain_353:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_349
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_407
+.Lmain_406:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_410:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_411:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_412:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_409:
+    incl -49168(%rbp)
+.Lmain_407:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_406
+.Lmain_408:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_404
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_405:
+    incl -49168(%rbp)
+    jmp .Lmain_408
+.Lmain_404:
+    addq $0, %rsp
+.Lmain_350:
+    incl -49164(%rbp)
+    jmp .Lmain_353
+.Lmain_349:
+    addq $8, %rsp
+.Lmain_346:
+    incl -49160(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_419
+.Lmain_418:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_428
+.Lmain_427:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_431:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_432:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_433:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_430:
+    incl -49168(%rbp)
+.Lmain_428:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_427
+.Lmain_429:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_425
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_426:
+    incl -49168(%rbp)
+    jmp .Lmain_429
+.Lmain_425:
+    addq $0, %rsp
+.Lmain_422:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_440
+.Lmain_439:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_443:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_444:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_445:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_442:
+    incl -49168(%rbp)
+.Lmain_440:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_439
+.Lmain_441:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_437
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_438:
+    incl -49168(%rbp)
+    jmp .Lmain_441
+.Lmain_437:
+    addq $0, %rsp
+.Lmain_434:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_452
+.Lmain_451:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_455:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_456:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_457:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_454:
+    incl -49168(%rbp)
+.Lmain_452:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_451
+.Lmain_453:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_449
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_450:
+    incl -49168(%rbp)
+    jmp .Lmain_453
+.Lmain_449:
+    addq $0, %rsp
+.Lmain_446:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_463
+.Lmain_462:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_466:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_467:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_468:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_465:
+    incl -49168(%rbp)
+.Lmain_463:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_462
+.Lmain_464:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_460
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_461:
+    incl -49168(%rbp)
+    jmp .Lmain_464
+.Lmain_460:
+    addq $0, %rsp
+.Lmain_421:
+    incl -49164(%rbp)
+.Lmain_419:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_418
+.Lmain_420:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_416
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_474
+.Lmain_473:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_477:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_478:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_479:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_476:
+    incl -49168(%rbp)
+.Lmain_474:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_473
+.Lmain_475:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_471
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_472:
+    incl -49168(%rbp)
+    jmp .Lmain_475
+.Lmain_471:
+    addq $0, %rsp
+.Lmain_417:
+    incl -49164(%rbp)
+    jmp .Lmain_420
+.Lmain_416:
+    addq $8, %rsp
+.Lmain_413:
+    incl -49160(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_485
+.Lmain_484:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_494
+.Lmain_493:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_497:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_498:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_499:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_496:
+    incl -49168(%rbp)
+.Lmain_494:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_493
+.Lmain_495:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_491
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_492:
+    incl -49168(%rbp)
+    jmp .Lmain_495
+.Lmain_491:
+    addq $0, %rsp
+.Lmain_488:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_506
+.Lmain_505:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_509:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_510:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_511:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_508:
+    incl -49168(%rbp)
+.Lmain_506:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_505
+.Lmain_507:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_503
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_504:
+    incl -49168(%rbp)
+    jmp .Lmain_507
+.Lmain_503:
+    addq $0, %rsp
+.Lmain_500:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_518
+.Lmain_517:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_521:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_522:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_523:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_520:
+    incl -49168(%rbp)
+.Lmain_518:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_517
+.Lmain_519:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_515
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_516:
+    incl -49168(%rbp)
+    jmp .Lmain_519
+.Lmain_515:
+    addq $0, %rsp
+.Lmain_512:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_529
+.Lmain_528:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_532:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_533:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_534:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_531:
+    incl -49168(%rbp)
+.Lmain_529:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_528
+.Lmain_530:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_526
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_527:
+    incl -49168(%rbp)
+    jmp .Lmain_530
+.Lmain_526:
+    addq $0, %rsp
+.Lmain_487:
+    incl -49164(%rbp)
+.Lmain_485:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_484
+.Lmain_486:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_482
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_540
+.Lmain_539:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_543:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_544:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_545:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_542:
+    incl -49168(%rbp)
+.Lmain_540:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_539
+.Lmain_541:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_537
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_538:
+    incl -49168(%rbp)
+    jmp .Lmain_541
+.Lmain_537:
+    addq $0, %rsp
+.Lmain_483:
+    incl -49164(%rbp)
+    jmp .Lmain_486
+.Lmain_482:
+    addq $8, %rsp
+.Lmain_345:
+    incl -49160(%rbp)
+.Lmain_343:
+    movslq -49160(%rbp), %rax
+    addq $2, %rax
+    cmpq $16, %rax
+    jl .Lmain_342
+.Lmain_344:
+    cmpl $16, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_340
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_551
+.Lmain_550:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_560
+.Lmain_559:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_563:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_564:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_565:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_562:
+    incl -49168(%rbp)
+.Lmain_560:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_559
+.Lmain_561:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_557
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_558:
+    incl -49168(%rbp)
+    jmp .Lmain_561
+.Lmain_557:
+    addq $0, %rsp
+.Lmain_554:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_572
+.Lmain_571:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_575:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_576:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_577:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_574:
+    incl -49168(%rbp)
+.Lmain_572:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_571
+.Lmain_573:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_569
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_570:
+    incl -49168(%rbp)
+    jmp .Lmain_573
+.Lmain_569:
+    addq $0, %rsp
+.Lmain_566:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_584
+.Lmain_583:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_587:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_588:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_589:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_586:
+    incl -49168(%rbp)
+.Lmain_584:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_583
+.Lmain_585:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_581
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_582:
+    incl -49168(%rbp)
+    jmp .Lmain_585
+.Lmain_581:
+    addq $0, %rsp
+.Lmain_578:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_595
+.Lmain_594:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_598:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_599:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_600:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_597:
+    incl -49168(%rbp)
+.Lmain_595:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_594
+.Lmain_596:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_592
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_593:
+    incl -49168(%rbp)
+    jmp .Lmain_596
+.Lmain_592:
+    addq $0, %rsp
+.Lmain_553:
+    incl -49164(%rbp)
+.Lmain_551:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_550
+.Lmain_552:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_548
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_606
+.Lmain_605:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_609:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_610:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_611:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_608:
+    incl -49168(%rbp)
+.Lmain_606:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_605
+.Lmain_607:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_603
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_604:
+    incl -49168(%rbp)
+    jmp .Lmain_607
+.Lmain_603:
+    addq $0, %rsp
+.Lmain_549:
+    incl -49164(%rbp)
+    jmp .Lmain_552
+.Lmain_548:
+    addq $8, %rsp
+.Lmain_341:
+    incl -49160(%rbp)
+    jmp .Lmain_344
+.Lmain_340:
+    addq $0, %rsp
+.Lmain_62:
+    incl -49156(%rbp)
+.Lmain_60:
+    movslq -49156(%rbp), %rax
+    addq $1, %rax
+    cmpq $64, %rax
+    jl .Lmain_59
+.Lmain_61:
+    cmpl $64, -49156(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_57
+    .loc 1 12 5
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_617
+.Lmain_616:
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_626
+.Lmain_625:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_635
+.Lmain_634:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_638:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_639:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_640:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_637:
+    incl -49168(%rbp)
+.Lmain_635:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_634
+.Lmain_636:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_632
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_633:
+    incl -49168(%rbp)
+    jmp .Lmain_636
+.Lmain_632:
+    addq $0, %rsp
+.Lmain_629:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_647
+.Lmain_646:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_650:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_651:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_652:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_649:
+    incl -49168(%rbp)
+.Lmain_647:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_646
+.Lmain_648:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_644
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_645:
+    incl -49168(%rbp)
+    jmp .Lmain_648
+.Lmain_644:
+    addq $0, %rsp
+.Lmain_641:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_659
+.Lmain_658:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_662:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_663:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_664:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_661:
+    incl -49168(%rbp)
+.Lmain_659:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_658
+.Lmain_660:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_656
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_657:
+    incl -49168(%rbp)
+    jmp .Lmain_660
+.Lmain_656:
+    addq $0, %rsp
+.Lmain_653:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_670
+.Lmain_669:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_673:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_674:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_675:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_672:
+    incl -49168(%rbp)
+.Lmain_670:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_669
+.Lmain_671:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_667
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_668:
+    incl -49168(%rbp)
+    jmp .Lmain_671
+.Lmain_667:
+    addq $0, %rsp
+.Lmain_628:
+    incl -49164(%rbp)
+.Lmain_626:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_625
+.Lmain_627:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_623
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_681
+.Lmain_680:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_684:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_685:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_686:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_683:
+    incl -49168(%rbp)
+.Lmain_681:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_680
+.Lmain_682:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_678
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_679:
+    incl -49168(%rbp)
+    jmp .Lmain_682
+.Lmain_678:
+    addq $0, %rsp
+.Lmain_624:
+    incl -49164(%rbp)
+    jmp .Lmain_627
+.Lmain_623:
+    addq $8, %rsp
+.Lmain_620:
+    incl -49160(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_693
+.Lmain_692:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_702
+.Lmain_701:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_705:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_706:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_707:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_704:
+    incl -49168(%rbp)
+.Lmain_702:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_701
+.Lmain_703:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_699
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_700:
+    incl -49168(%rbp)
+    jmp .Lmain_703
+.Lmain_699:
+    addq $0, %rsp
+.Lmain_696:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_714
+.Lmain_713:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_717:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_718:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_719:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_716:
+    incl -49168(%rbp)
+.Lmain_714:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_713
+.Lmain_715:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_711
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_712:
+    incl -49168(%rbp)
+    jmp .Lmain_715
+.Lmain_711:
+    addq $0, %rsp
+.Lmain_708:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_726
+.Lmain_725:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_729:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_730:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_731:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_728:
+    incl -49168(%rbp)
+.Lmain_726:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_725
+.Lmain_727:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_723
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_724:
+    incl -49168(%rbp)
+    jmp .Lmain_727
+.Lmain_723:
+    addq $0, %rsp
+.Lmain_720:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_737
+.Lmain_736:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_740:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_741:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_742:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_739:
+    incl -49168(%rbp)
+.Lmain_737:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_736
+.Lmain_738:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_734
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_735:
+    incl -49168(%rbp)
+    jmp .Lmain_738
+.Lmain_734:
+    addq $0, %rsp
+.Lmain_695:
+    incl -49164(%rbp)
+.Lmain_693:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_692
+.Lmain_694:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_690
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_748
+.Lmain_747:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_751:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_752:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_753:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_750:
+    incl -49168(%rbp)
+.Lmain_748:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_747
+.Lmain_749:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_745
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_746:
+    incl -49168(%rbp)
+    jmp .Lmain_749
+.Lmain_745:
+    addq $0, %rsp
+.Lmain_691:
+    incl -49164(%rbp)
+    jmp .Lmain_694
+.Lmain_690:
+    addq $8, %rsp
+.Lmain_687:
+    incl -49160(%rbp)
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_759
+.Lmain_758:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_768
+.Lmain_767:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_771:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_772:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_773:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_770:
+    incl -49168(%rbp)
+.Lmain_768:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_767
+.Lmain_769:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_765
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_766:
+    incl -49168(%rbp)
+    jmp .Lmain_769
+.Lmain_765:
+    addq $0, %rsp
+.Lmain_762:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_780
+.Lmain_779:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_783:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_784:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_785:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_782:
+    incl -49168(%rbp)
+.Lmain_780:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_779
+.Lmain_781:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_777
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_778:
+    incl -49168(%rbp)
+    jmp .Lmain_781
+.Lmain_777:
+    addq $0, %rsp
+.Lmain_774:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_792
+.Lmain_791:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_795:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_796:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_797:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_794:
+    incl -49168(%rbp)
+.Lmain_792:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_791
+.Lmain_793:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_789
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_790:
+    incl -49168(%rbp)
+    jmp .Lmain_793
+.Lmain_789:
+    addq $0, %rsp
+.Lmain_786:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_803
+.Lmain_802:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_806:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_807:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_808:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_805:
+    incl -49168(%rbp)
+.Lmain_803:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_802
+.Lmain_804:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_800
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_801:
+    incl -49168(%rbp)
+    jmp .Lmain_804
+.Lmain_800:
+    addq $0, %rsp
+.Lmain_761:
+    incl -49164(%rbp)
+.Lmain_759:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_758
+.Lmain_760:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_756
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_814
+.Lmain_813:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_817:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_818:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_819:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_816:
+    incl -49168(%rbp)
+.Lmain_814:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_813
+.Lmain_815:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_811
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_812:
+    incl -49168(%rbp)
+    jmp .Lmain_815
+.Lmain_811:
+    addq $0, %rsp
+.Lmain_757:
+    incl -49164(%rbp)
+    jmp .Lmain_760
+.Lmain_756:
+    addq $8, %rsp
+.Lmain_619:
+    incl -49160(%rbp)
+.Lmain_617:
+    movslq -49160(%rbp), %rax
+    addq $2, %rax
+    cmpq $16, %rax
+    jl .Lmain_616
+.Lmain_618:
+    cmpl $16, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_614
+    .loc 1 15 17
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_825
+.Lmain_824:
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_834
+.Lmain_833:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_837:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_838:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_839:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_836:
+    incl -49168(%rbp)
+.Lmain_834:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_833
+.Lmain_835:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_831
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_832:
+    incl -49168(%rbp)
+    jmp .Lmain_835
+.Lmain_831:
+    addq $0, %rsp
+.Lmain_828:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_846
+.Lmain_845:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_849:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_850:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_851:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_848:
+    incl -49168(%rbp)
+.Lmain_846:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_845
+.Lmain_847:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_843
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_844:
+    incl -49168(%rbp)
+    jmp .Lmain_847
+.Lmain_843:
+    addq $0, %rsp
+.Lmain_840:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_858
+.Lmain_857:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_861:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_862:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_863:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_860:
+    incl -49168(%rbp)
+.Lmain_858:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_857
+.Lmain_859:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_855
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_856:
+    incl -49168(%rbp)
+    jmp .Lmain_859
+.Lmain_855:
+    addq $0, %rsp
+.Lmain_852:
+    incl -49164(%rbp)
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_869
+.Lmain_868:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_872:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_873:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_874:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_871:
+    incl -49168(%rbp)
+.Lmain_869:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_868
+.Lmain_870:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_866
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_867:
+    incl -49168(%rbp)
+    jmp .Lmain_870
+.Lmain_866:
+    addq $0, %rsp
+.Lmain_827:
+    incl -49164(%rbp)
+.Lmain_825:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_824
+.Lmain_826:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_822
+    .loc 1 14 13
+    movq $0, %rax
+    movl %eax, -49168(%rbp)
+    jmp .Lmain_880
+.Lmain_879:
+    .loc 1 16 21
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_883:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_884:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_885:
+    incl -49168(%rbp)
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_882:
+    incl -49168(%rbp)
+.Lmain_880:
+    movslq -49168(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_879
+.Lmain_881:
+    cmpl $64, -49168(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_877
+    movslq -49164(%rbp), %rax
+    push %rax
+    leaq -32768(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -16384(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    add %rbx, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49168(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_878:
+    incl -49168(%rbp)
+    jmp .Lmain_881
+.Lmain_877:
+    addq $0, %rsp
+.Lmain_823:
+    incl -49164(%rbp)
+    jmp .Lmain_826
+.Lmain_822:
+    addq $8, %rsp
+.Lmain_615:
+    incl -49160(%rbp)
+    jmp .Lmain_618
+.Lmain_614:
+    addq $0, %rsp
+.Lmain_58:
+    incl -49156(%rbp)
+    jmp .Lmain_61
+.Lmain_57:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49156(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -49160(%rbp)
+    jmp .Lmain_891
+.Lmain_890:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_900
+.Lmain_899:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_903:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_904:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_905:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_902:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_900:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_899
+.Lmain_901:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_897
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_898:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_901
+.Lmain_897:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_894:
+    .loc 1 22 29
+    incl -49160(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_912
+.Lmain_911:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_915:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_916:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_917:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_914:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_912:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_911
+.Lmain_913:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_909
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_910:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_913
+.Lmain_909:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_906:
+    .loc 1 22 29
+    incl -49160(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_924
+.Lmain_923:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_927:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_928:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_929:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_926:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_924:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_923
+.Lmain_925:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_921
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_922:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_925
+.Lmain_921:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_918:
+    .loc 1 22 29
+    incl -49160(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_935
+.Lmain_934:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_938:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_939:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_940:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_937:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_935:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_934
+.Lmain_936:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_932
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_933:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_936
+.Lmain_932:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_893:
+    .loc 1 22 29
+    incl -49160(%rbp)
+.Lmain_891:
+    movslq -49160(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_890
+.Lmain_892:
+    cmpl $64, -49160(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_888
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -49164(%rbp)
+    jmp .Lmain_946
+.Lmain_945:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_949:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_950:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_951:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_948:
+    .loc 1 23 33
+    incl -49164(%rbp)
+.Lmain_946:
+    movslq -49164(%rbp), %rax
+    addq $3, %rax
+    cmpq $64, %rax
+    jl .Lmain_945
+.Lmain_947:
+    cmpl $64, -49164(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_943
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -49160(%rbp), %rax
+    push %rax
+    leaq -49152(%rbp), %rax
+    pop %rbx
+    shlq $8, %rbx
+    add %rbx, %rax
+    movslq -49164(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -49156(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -49156(%rbp)
+    addq $0, %rsp
+.Lmain_944:
+    .loc 1 23 33
+    incl -49164(%rbp)
+    jmp .Lmain_947
+.Lmain_943:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_889:
+    .loc 1 22 29
+    incl -49160(%rbp)
+    jmp .Lmain_892
+.Lmain_888:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -49156(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
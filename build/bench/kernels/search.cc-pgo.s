@@ -0,0 +1,2976 @@
+    .file 1 "bench/kernels/search.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $6000, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6004(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_10:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_11:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 3 31
+    incl -6004(%rbp)
+.Lmain_6:
+    movslq -6004(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $1500, -6004(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6004(%rbp)
+    .loc 1 7 5
+    movq $1000, %rax
+    movl %eax, -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_22
+    .p2align 4,,10
+.Lmain_21:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_31
+    .p2align 4,,10
+.Lmain_30:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_36
+.Lmain_35:
+    addq $0, %rsp
+.Lmain_34:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_39
+.Lmain_38:
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_42
+.Lmain_41:
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_44
+.Lmain_43:
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_31:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_30
+.Lmain_32:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_28
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_46
+.Lmain_45:
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_32
+.Lmain_28:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_53
+    .p2align 4,,10
+.Lmain_52:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_58
+.Lmain_57:
+    addq $0, %rsp
+.Lmain_56:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_61
+.Lmain_60:
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_64
+.Lmain_63:
+    addq $0, %rsp
+.Lmain_62:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_66
+.Lmain_65:
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_53:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_52
+.Lmain_54:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_50
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_68
+.Lmain_67:
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_54
+.Lmain_50:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_75
+    .p2align 4,,10
+.Lmain_74:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_80
+.Lmain_79:
+    addq $0, %rsp
+.Lmain_78:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_83
+.Lmain_82:
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_86
+.Lmain_85:
+    addq $0, %rsp
+.Lmain_84:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_88
+.Lmain_87:
+    addq $0, %rsp
+.Lmain_77:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_75:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_74
+.Lmain_76:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_72
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_90
+.Lmain_89:
+    addq $0, %rsp
+.Lmain_73:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_76
+.Lmain_72:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_69:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_96
+    .p2align 4,,10
+.Lmain_95:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_101
+.Lmain_100:
+    addq $0, %rsp
+.Lmain_99:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_104
+.Lmain_103:
+    addq $0, %rsp
+.Lmain_102:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_107
+.Lmain_106:
+    addq $0, %rsp
+.Lmain_105:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_109
+.Lmain_108:
+    addq $0, %rsp
+.Lmain_98:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_96:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_95
+.Lmain_97:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_93
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_111
+.Lmain_110:
+    addq $0, %rsp
+.Lmain_94:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_97
+.Lmain_93:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_22:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_21
+.Lmain_23:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_19
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_117
+    .p2align 4,,10
+.Lmain_116:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_122
+.Lmain_121:
+    addq $0, %rsp
+.Lmain_120:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_125
+.Lmain_124:
+    addq $0, %rsp
+.Lmain_123:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_128
+.Lmain_127:
+    addq $0, %rsp
+.Lmain_126:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_130
+.Lmain_129:
+    addq $0, %rsp
+.Lmain_119:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_117:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_116
+.Lmain_118:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_114
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_132
+.Lmain_131:
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_118
+.Lmain_114:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_23
+.Lmain_19:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_16:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_139
+    .p2align 4,,10
+.Lmain_138:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_148
+    .p2align 4,,10
+.Lmain_147:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_153
+.Lmain_152:
+    addq $0, %rsp
+.Lmain_151:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_156
+.Lmain_155:
+    addq $0, %rsp
+.Lmain_154:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_159
+.Lmain_158:
+    addq $0, %rsp
+.Lmain_157:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_161
+.Lmain_160:
+    addq $0, %rsp
+.Lmain_150:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_148:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_147
+.Lmain_149:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_145
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_163
+.Lmain_162:
+    addq $0, %rsp
+.Lmain_146:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_149
+.Lmain_145:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_142:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_170
+    .p2align 4,,10
+.Lmain_169:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_175
+.Lmain_174:
+    addq $0, %rsp
+.Lmain_173:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_178
+.Lmain_177:
+    addq $0, %rsp
+.Lmain_176:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_181
+.Lmain_180:
+    addq $0, %rsp
+.Lmain_179:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_183
+.Lmain_182:
+    addq $0, %rsp
+.Lmain_172:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_170:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_169
+.Lmain_171:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_167
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_185
+.Lmain_184:
+    addq $0, %rsp
+.Lmain_168:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_171
+.Lmain_167:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_164:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_192
+    .p2align 4,,10
+.Lmain_191:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_197
+.Lmain_196:
+    addq $0, %rsp
+.Lmain_195:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_200
+.Lmain_199:
+    addq $0, %rsp
+.Lmain_198:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_203
+.Lmain_202:
+    addq $0, %rsp
+.Lmain_201:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_205
+.Lmain_204:
+    addq $0, %rsp
+.Lmain_194:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_192:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_191
+.Lmain_193:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_189
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_207
+.Lmain_206:
+    addq $0, %rsp
+.Lmain_190:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_193
+.Lmain_189:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_186:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_213
+    .p2align 4,,10
+.Lmain_212:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_218
+.Lmain_217:
+    addq $0, %rsp
+.Lmain_216:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_221
+.Lmain_220:
+    addq $0, %rsp
+.Lmain_219:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_224
+.Lmain_223:
+    addq $0, %rsp
+.Lmain_222:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_226
+.Lmain_225:
+    addq $0, %rsp
+.Lmain_215:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_213:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_212
+.Lmain_214:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_210
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_228
+.Lmain_227:
+    addq $0, %rsp
+.Lmain_211:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_214
+.Lmain_210:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_141:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_139:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_138
+.Lmain_140:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_136
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_234
+    .p2align 4,,10
+.Lmain_233:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_239
+.Lmain_238:
+    addq $0, %rsp
+.Lmain_237:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_242
+.Lmain_241:
+    addq $0, %rsp
+.Lmain_240:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_245
+.Lmain_244:
+    addq $0, %rsp
+.Lmain_243:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_247
+.Lmain_246:
+    addq $0, %rsp
+.Lmain_236:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_234:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_233
+.Lmain_235:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_231
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_249
+.Lmain_248:
+    addq $0, %rsp
+.Lmain_232:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_235
+.Lmain_231:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_137:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_140
+.Lmain_136:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_133:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_256
+    .p2align 4,,10
+.Lmain_255:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_265
+    .p2align 4,,10
+.Lmain_264:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_270
+.Lmain_269:
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_273
+.Lmain_272:
+    addq $0, %rsp
+.Lmain_271:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_276
+.Lmain_275:
+    addq $0, %rsp
+.Lmain_274:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_278
+.Lmain_277:
+    addq $0, %rsp
+.Lmain_267:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_265:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_264
+.Lmain_266:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_262
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_280
+.Lmain_279:
+    addq $0, %rsp
+.Lmain_263:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_266
+.Lmain_262:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_259:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_287
+    .p2align 4,,10
+.Lmain_286:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_292
+.Lmain_291:
+    addq $0, %rsp
+.Lmain_290:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_295
+.Lmain_294:
+    addq $0, %rsp
+.Lmain_293:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_298
+.Lmain_297:
+    addq $0, %rsp
+.Lmain_296:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_300
+.Lmain_299:
+    addq $0, %rsp
+.Lmain_289:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_287:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_286
+.Lmain_288:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_284
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_302
+.Lmain_301:
+    addq $0, %rsp
+.Lmain_285:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_288
+.Lmain_284:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_281:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_309
+    .p2align 4,,10
+.Lmain_308:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_314
+.Lmain_313:
+    addq $0, %rsp
+.Lmain_312:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_317
+.Lmain_316:
+    addq $0, %rsp
+.Lmain_315:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_320
+.Lmain_319:
+    addq $0, %rsp
+.Lmain_318:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_322
+.Lmain_321:
+    addq $0, %rsp
+.Lmain_311:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_309:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_308
+.Lmain_310:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_306
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_324
+.Lmain_323:
+    addq $0, %rsp
+.Lmain_307:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_310
+.Lmain_306:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_303:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_330
+    .p2align 4,,10
+.Lmain_329:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_335
+.Lmain_334:
+    addq $0, %rsp
+.Lmain_333:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_338
+.Lmain_337:
+    addq $0, %rsp
+.Lmain_336:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_341
+.Lmain_340:
+    addq $0, %rsp
+.Lmain_339:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_343
+.Lmain_342:
+    addq $0, %rsp
+.Lmain_332:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_330:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_329
+.Lmain_331:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_327
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_345
+.Lmain_344:
+    addq $0, %rsp
+.Lmain_328:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_331
+.Lmain_327:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_258:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_256:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_255
+.Lmain_257:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_253
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_351
+    .p2align 4,,10
+.Lmain_350:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_356
+.Lmain_355:
+    addq $0, %rsp
+.Lmain_354:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_359
+.Lmain_358:
+    addq $0, %rsp
+.Lmain_357:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_362
+.Lmain_361:
+    addq $0, %rsp
+.Lmain_360:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_364
+.Lmain_363:
+    addq $0, %rsp
+.Lmain_353:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_351:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_350
+.Lmain_352:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_348
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_366
+.Lmain_365:
+    addq $0, %rsp
+.Lmain_349:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_352
+.Lmain_348:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_254:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_257
+.Lmain_253:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_250:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_372
+    .p2align 4,,10
+.Lmain_371:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_381
+    .p2align 4,,10
+.Lmain_380:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_386
+.Lmain_385:
+    addq $0, %rsp
+.Lmain_384:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_389
+.Lmain_388:
+    addq $0, %rsp
+.Lmain_387:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_392
+.Lmain_391:
+    addq $0, %rsp
+.Lmain_390:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_394
+.Lmain_393:
+    addq $0, %rsp
+.Lmain_383:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_381:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_380
+.Lmain_382:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_378
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_396
+.Lmain_395:
+    addq $0, %rsp
+.Lmain_379:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_382
+.Lmain_378:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_375:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_403
+    .p2align 4,,10
+.Lmain_402:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_408
+.Lmain_407:
+    addq $0, %rsp
+.Lmain_406:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_411
+.Lmain_410:
+    addq $0, %rsp
+.Lmain_409:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_414
+.Lmain_413:
+    addq $0, %rsp
+.Lmain_412:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_416
+.Lmain_415:
+    addq $0, %rsp
+.Lmain_405:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_403:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_402
+.Lmain_404:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_400
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_418
+.Lmain_417:
+    addq $0, %rsp
+.Lmain_401:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_404
+.Lmain_400:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_397:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_425
+    .p2align 4,,10
+.Lmain_424:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_430
+.Lmain_429:
+    addq $0, %rsp
+.Lmain_428:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_433
+.Lmain_432:
+    addq $0, %rsp
+.Lmain_431:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_436
+.Lmain_435:
+    addq $0, %rsp
+.Lmain_434:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_438
+.Lmain_437:
+    addq $0, %rsp
+.Lmain_427:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_425:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_424
+.Lmain_426:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_422
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_440
+.Lmain_439:
+    addq $0, %rsp
+.Lmain_423:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_426
+.Lmain_422:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_419:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_446
+    .p2align 4,,10
+.Lmain_445:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_451
+.Lmain_450:
+    addq $0, %rsp
+.Lmain_449:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_454
+.Lmain_453:
+    addq $0, %rsp
+.Lmain_452:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_457
+.Lmain_456:
+    addq $0, %rsp
+.Lmain_455:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_459
+.Lmain_458:
+    addq $0, %rsp
+.Lmain_448:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_446:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_445
+.Lmain_447:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_443
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_461
+.Lmain_460:
+    addq $0, %rsp
+.Lmain_444:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_447
+.Lmain_443:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_374:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_372:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_371
+.Lmain_373:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_369
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_467
+    .p2align 4,,10
+.Lmain_466:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_472
+.Lmain_471:
+    addq $0, %rsp
+.Lmain_470:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_475
+.Lmain_474:
+    addq $0, %rsp
+.Lmain_473:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_478
+.Lmain_477:
+    addq $0, %rsp
+.Lmain_476:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_480
+.Lmain_479:
+    addq $0, %rsp
+.Lmain_469:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_467:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_466
+.Lmain_468:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_464
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_482
+.Lmain_481:
+    addq $0, %rsp
+.Lmain_465:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_468
+.Lmain_464:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_370:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_373
+.Lmain_369:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_15:
+    .loc 1 7 34
+    incl -6008(%rbp)
+.Lmain_14:
+    addq $0, %rsp
+    .loc 1 16 5
+    movq $256, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+    .section .text.unlikely,"ax",@progbits
+.type main.cold, @function
+main.cold:
+    .cfi_startproc
+    .cfi_def_cfa %rbp, 16
+    .cfi_offset %rbp, -16
+    .loc 1 10 17
+.Lmain_36:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_35
+    .loc 1 10 17
+.Lmain_39:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_38
+    .loc 1 10 17
+.Lmain_42:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_41
+    .loc 1 10 17
+.Lmain_44:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_43
+    .loc 1 10 17
+.Lmain_46:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_45
+    .loc 1 10 17
+.Lmain_58:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_57
+    .loc 1 10 17
+.Lmain_61:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_60
+    .loc 1 10 17
+.Lmain_64:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_63
+    .loc 1 10 17
+.Lmain_66:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_65
+    .loc 1 10 17
+.Lmain_68:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_67
+    .loc 1 10 17
+.Lmain_80:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_79
+    .loc 1 10 17
+.Lmain_83:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_82
+    .loc 1 10 17
+.Lmain_86:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_85
+    .loc 1 10 17
+.Lmain_88:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_87
+    .loc 1 10 17
+.Lmain_90:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_89
+    .loc 1 10 17
+.Lmain_101:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_100
+    .loc 1 10 17
+.Lmain_104:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_103
+    .loc 1 10 17
+.Lmain_107:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_106
+    .loc 1 10 17
+.Lmain_109:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_108
+    .loc 1 10 17
+.Lmain_111:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_110
+    .loc 1 10 17
+.Lmain_122:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_121
+    .loc 1 10 17
+.Lmain_125:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_124
+    .loc 1 10 17
+.Lmain_128:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_127
+    .loc 1 10 17
+.Lmain_130:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_129
+    .loc 1 10 17
+.Lmain_132:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_131
+    .loc 1 10 17
+.Lmain_153:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_152
+    .loc 1 10 17
+.Lmain_156:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_155
+    .loc 1 10 17
+.Lmain_159:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_158
+    .loc 1 10 17
+.Lmain_161:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_160
+    .loc 1 10 17
+.Lmain_163:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_162
+    .loc 1 10 17
+.Lmain_175:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_174
+    .loc 1 10 17
+.Lmain_178:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_177
+    .loc 1 10 17
+.Lmain_181:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_180
+    .loc 1 10 17
+.Lmain_183:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_182
+    .loc 1 10 17
+.Lmain_185:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_184
+    .loc 1 10 17
+.Lmain_197:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_196
+    .loc 1 10 17
+.Lmain_200:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_199
+    .loc 1 10 17
+.Lmain_203:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_202
+    .loc 1 10 17
+.Lmain_205:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_204
+    .loc 1 10 17
+.Lmain_207:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_206
+    .loc 1 10 17
+.Lmain_218:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_217
+    .loc 1 10 17
+.Lmain_221:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_220
+    .loc 1 10 17
+.Lmain_224:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_223
+    .loc 1 10 17
+.Lmain_226:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_225
+    .loc 1 10 17
+.Lmain_228:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_227
+    .loc 1 10 17
+.Lmain_239:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_238
+    .loc 1 10 17
+.Lmain_242:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_241
+    .loc 1 10 17
+.Lmain_245:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_244
+    .loc 1 10 17
+.Lmain_247:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_246
+    .loc 1 10 17
+.Lmain_249:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_248
+    .loc 1 10 17
+.Lmain_270:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_269
+    .loc 1 10 17
+.Lmain_273:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_272
+    .loc 1 10 17
+.Lmain_276:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_275
+    .loc 1 10 17
+.Lmain_278:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_277
+    .loc 1 10 17
+.Lmain_280:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_279
+    .loc 1 10 17
+.Lmain_292:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_291
+    .loc 1 10 17
+.Lmain_295:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_294
+    .loc 1 10 17
+.Lmain_298:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_297
+    .loc 1 10 17
+.Lmain_300:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_299
+    .loc 1 10 17
+.Lmain_302:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_301
+    .loc 1 10 17
+.Lmain_314:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_313
+    .loc 1 10 17
+.Lmain_317:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_316
+    .loc 1 10 17
+.Lmain_320:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_319
+    .loc 1 10 17
+.Lmain_322:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_321
+    .loc 1 10 17
+.Lmain_324:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_323
+    .loc 1 10 17
+.Lmain_335:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_334
+    .loc 1 10 17
+.Lmain_338:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_337
+    .loc 1 10 17
+.Lmain_341:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_340
+    .loc 1 10 17
+.Lmain_343:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_342
+    .loc 1 10 17
+.Lmain_345:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_344
+    .loc 1 10 17
+.Lmain_356:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_355
+    .loc 1 10 17
+.Lmain_359:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_358
+    .loc 1 10 17
+.Lmain_362:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_361
+    .loc 1 10 17
+.Lmain_364:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_363
+    .loc 1 10 17
+.Lmain_366:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_365
+    .loc 1 10 17
+.Lmain_386:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_385
+    .loc 1 10 17
+.Lmain_389:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_388
+    .loc 1 10 17
+.Lmain_392:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_391
+    .loc 1 10 17
+.Lmain_394:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_393
+    .loc 1 10 17
+.Lmain_396:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_395
+    .loc 1 10 17
+.Lmain_408:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_407
+    .loc 1 10 17
+.Lmain_411:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_410
+    .loc 1 10 17
+.Lmain_414:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_413
+    .loc 1 10 17
+.Lmain_416:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_415
+    .loc 1 10 17
+.Lmain_418:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_417
+    .loc 1 10 17
+.Lmain_430:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_429
+    .loc 1 10 17
+.Lmain_433:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_432
+    .loc 1 10 17
+.Lmain_436:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_435
+    .loc 1 10 17
+.Lmain_438:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_437
+    .loc 1 10 17
+.Lmain_440:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_439
+    .loc 1 10 17
+.Lmain_451:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_450
+    .loc 1 10 17
+.Lmain_454:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_453
+    .loc 1 10 17
+.Lmain_457:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_456
+    .loc 1 10 17
+.Lmain_459:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_458
+    .loc 1 10 17
+.Lmain_461:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_460
+    .loc 1 10 17
+.Lmain_472:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_471
+    .loc 1 10 17
+.Lmain_475:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_474
+    .loc 1 10 17
+.Lmain_478:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_477
+    .loc 1 10 17
+.Lmain_480:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_479
+    .loc 1 10 17
+.Lmain_482:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_481
+    .cfi_endproc
+.size main.cold, .-main.cold
+    .text
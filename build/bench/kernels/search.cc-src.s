@@ -0,0 +1,3041 @@
+    .file 1 "bench/kernels/search.c"
+.globl main
+.type main, @function
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $6000, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6004(%rbp)
+    jmp .Lmain_6
+.Lmain_5:
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_10:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_11:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 3 31
+    incl -6004(%rbp)
+.Lmain_6:
+    movslq -6004(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $1500, -6004(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6004(%rbp)
+    .loc 1 7 5
+    movq $1000, %rax
+    movl %eax, -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_22
+.Lmain_21:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_31
+.Lmain_30:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_35
+    jmp .Lmain_36
+.Lmain_35:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_37
+.Lmain_36:
+.Lmain_37:
+    addq $0, %rsp
+.Lmain_34:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_39
+    jmp .Lmain_40
+.Lmain_39:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_41
+.Lmain_40:
+.Lmain_41:
+    addq $0, %rsp
+.Lmain_38:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_43
+    jmp .Lmain_44
+.Lmain_43:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_45
+.Lmain_44:
+.Lmain_45:
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_46
+    jmp .Lmain_47
+.Lmain_46:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_48
+.Lmain_47:
+.Lmain_48:
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_31:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_30
+.Lmain_32:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_28
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_49
+    jmp .Lmain_50
+.Lmain_49:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_51
+.Lmain_50:
+.Lmain_51:
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_32
+.Lmain_28:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_58
+.Lmain_57:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_62
+    jmp .Lmain_63
+.Lmain_62:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_64
+.Lmain_63:
+.Lmain_64:
+    addq $0, %rsp
+.Lmain_61:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_66
+    jmp .Lmain_67
+.Lmain_66:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_68
+.Lmain_67:
+.Lmain_68:
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_70
+    jmp .Lmain_71
+.Lmain_70:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_72
+.Lmain_71:
+.Lmain_72:
+    addq $0, %rsp
+.Lmain_69:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_73
+    jmp .Lmain_74
+.Lmain_73:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_75
+.Lmain_74:
+.Lmain_75:
+    addq $0, %rsp
+.Lmain_60:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_58:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_57
+.Lmain_59:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_55
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_76
+    jmp .Lmain_77
+.Lmain_76:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_78
+.Lmain_77:
+.Lmain_78:
+    addq $0, %rsp
+.Lmain_56:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_59
+.Lmain_55:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_85
+.Lmain_84:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_89
+    jmp .Lmain_90
+.Lmain_89:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_91
+.Lmain_90:
+.Lmain_91:
+    addq $0, %rsp
+.Lmain_88:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_93
+    jmp .Lmain_94
+.Lmain_93:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_95
+.Lmain_94:
+.Lmain_95:
+    addq $0, %rsp
+.Lmain_92:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_97
+    jmp .Lmain_98
+.Lmain_97:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_99
+.Lmain_98:
+.Lmain_99:
+    addq $0, %rsp
+.Lmain_96:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_100
+    jmp .Lmain_101
+.Lmain_100:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_102
+.Lmain_101:
+.Lmain_102:
+    addq $0, %rsp
+.Lmain_87:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_85:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_84
+.Lmain_86:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_82
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_103
+    jmp .Lmain_104
+.Lmain_103:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_105
+.Lmain_104:
+.Lmain_105:
+    addq $0, %rsp
+.Lmain_83:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_86
+.Lmain_82:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_79:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_111
+.Lmain_110:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_115
+    jmp .Lmain_116
+.Lmain_115:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_117
+.Lmain_116:
+.Lmain_117:
+    addq $0, %rsp
+.Lmain_114:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_119
+    jmp .Lmain_120
+.Lmain_119:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_121
+.Lmain_120:
+.Lmain_121:
+    addq $0, %rsp
+.Lmain_118:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_123
+    jmp .Lmain_124
+.Lmain_123:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_125
+.Lmain_124:
+.Lmain_125:
+    addq $0, %rsp
+.Lmain_122:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_126
+    jmp .Lmain_127
+.Lmain_126:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_128
+.Lmain_127:
+.Lmain_128:
+    addq $0, %rsp
+.Lmain_113:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_111:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_110
+.Lmain_112:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_108
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_129
+    jmp .Lmain_130
+.Lmain_129:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_131
+.Lmain_130:
+.Lmain_131:
+    addq $0, %rsp
+.Lmain_109:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_112
+.Lmain_108:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_22:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_21
+.Lmain_23:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_19
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_137
+.Lmain_136:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_141
+    jmp .Lmain_142
+.Lmain_141:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_143
+.Lmain_142:
+.Lmain_143:
+    addq $0, %rsp
+.Lmain_140:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_145
+    jmp .Lmain_146
+.Lmain_145:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_147
+.Lmain_146:
+.Lmain_147:
+    addq $0, %rsp
+.Lmain_144:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_149
+    jmp .Lmain_150
+.Lmain_149:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_151
+.Lmain_150:
+.Lmain_151:
+    addq $0, %rsp
+.Lmain_148:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_152
+    jmp .Lmain_153
+.Lmain_152:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_154
+.Lmain_153:
+.Lmain_154:
+    addq $0, %rsp
+.Lmain_139:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_137:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_136
+.Lmain_138:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_134
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_155
+    jmp .Lmain_156
+.Lmain_155:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_157
+.Lmain_156:
+.Lmain_157:
+    addq $0, %rsp
+.Lmain_135:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_138
+.Lmain_134:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_23
+.Lmain_19:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_16:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_164
+.Lmain_163:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_173
+.Lmain_172:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_177
+    jmp .Lmain_178
+.Lmain_177:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_179
+.Lmain_178:
+.Lmain_179:
+    addq $0, %rsp
+.Lmain_176:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_181
+    jmp .Lmain_182
+.Lmain_181:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_183
+.Lmain_182:
+.Lmain_183:
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_185
+    jmp .Lmain_186
+.Lmain_185:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_187
+.Lmain_186:
+.Lmain_187:
+    addq $0, %rsp
+.Lmain_184:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_188
+    jmp .Lmain_189
+.Lmain_188:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_190
+.Lmain_189:
+.Lmain_190:
+    addq $0, %rsp
+.Lmain_175:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_173:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_172
+.Lmain_174:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_170
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_191
+    jmp .Lmain_192
+.Lmain_191:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_193
+.Lmain_192:
+.Lmain_193:
+    addq $0, %rsp
+.Lmain_171:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_174
+.Lmain_170:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_167:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_200
+.Lmain_199:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_204
+    jmp .Lmain_205
+.Lmain_204:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_206
+.Lmain_205:
+.Lmain_206:
+    addq $0, %rsp
+.Lmain_203:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_208
+    jmp .Lmain_209
+.Lmain_208:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_210
+.Lmain_209:
+.Lmain_210:
+    addq $0, %rsp
+.Lmain_207:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_212
+    jmp .Lmain_213
+.Lmain_212:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_214
+.Lmain_213:
+.Lmain_214:
+    addq $0, %rsp
+.Lmain_211:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_215
+    jmp .Lmain_216
+.Lmain_215:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_217
+.Lmain_216:
+.Lmain_217:
+    addq $0, %rsp
+.Lmain_202:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_200:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_199
+.Lmain_201:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_197
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_218
+    jmp .Lmain_219
+.Lmain_218:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_220
+.Lmain_219:
+.Lmain_220:
+    addq $0, %rsp
+.Lmain_198:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_201
+.Lmain_197:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_194:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_227
+.Lmain_226:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_231
+    jmp .Lmain_232
+.Lmain_231:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_233
+.Lmain_232:
+.Lmain_233:
+    addq $0, %rsp
+.Lmain_230:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_235
+    jmp .Lmain_236
+.Lmain_235:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_237
+.Lmain_236:
+.Lmain_237:
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_239
+    jmp .Lmain_240
+.Lmain_239:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_241
+.Lmain_240:
+.Lmain_241:
+    addq $0, %rsp
+.Lmain_238:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_242
+    jmp .Lmain_243
+.Lmain_242:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_244
+.Lmain_243:
+.Lmain_244:
+    addq $0, %rsp
+.Lmain_229:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_227:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_226
+.Lmain_228:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_224
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_245
+    jmp .Lmain_246
+.Lmain_245:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_247
+.Lmain_246:
+.Lmain_247:
+    addq $0, %rsp
+.Lmain_225:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_228
+.Lmain_224:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_221:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_253
+.Lmain_252:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_257
+    jmp .Lmain_258
+.Lmain_257:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_259
+.Lmain_258:
+.Lmain_259:
+    addq $0, %rsp
+.Lmain_256:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_261
+    jmp .Lmain_262
+.Lmain_261:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_263
+.Lmain_262:
+.Lmain_263:
+    addq $0, %rsp
+.Lmain_260:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_265
+    jmp .Lmain_266
+.Lmain_265:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_267
+.Lmain_266:
+.Lmain_267:
+    addq $0, %rsp
+.Lmain_264:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_268
+    jmp .Lmain_269
+.Lmain_268:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_270
+.Lmain_269:
+.Lmain_270:
+    addq $0, %rsp
+.Lmain_255:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_253:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_252
+.Lmain_254:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_250
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_271
+    jmp .Lmain_272
+.Lmain_271:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_273
+.Lmain_272:
+.Lmain_273:
+    addq $0, %rsp
+.Lmain_251:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_254
+.Lmain_250:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_166:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_164:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_163
+.Lmain_165:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_161
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_279
+.Lmain_278:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_283
+    jmp .Lmain_284
+.Lmain_283:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_285
+.Lmain_284:
+.Lmain_285:
+    addq $0, %rsp
+.Lmain_282:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_287
+    jmp .Lmain_288
+.Lmain_287:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_289
+.Lmain_288:
+.Lmain_289:
+    addq $0, %rsp
+.Lmain_286:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_291
+    jmp .Lmain_292
+.Lmain_291:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_293
+.Lmain_292:
+.Lmain_293:
+    addq $0, %rsp
+.Lmain_290:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_294
+    jmp .Lmain_295
+.Lmain_294:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_296
+.Lmain_295:
+.Lmain_296:
+    addq $0, %rsp
+.Lmain_281:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_279:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_278
+.Lmain_280:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_276
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_297
+    jmp .Lmain_298
+.Lmain_297:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_299
+.Lmain_298:
+.Lmain_299:
+    addq $0, %rsp
+.Lmain_277:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_280
+.Lmain_276:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_162:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_165
+.Lmain_161:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_306
+.Lmain_305:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_315
+.Lmain_314:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_319
+    jmp .Lmain_320
+.Lmain_319:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_321
+.Lmain_320:
+.Lmain_321:
+    addq $0, %rsp
+.Lmain_318:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_323
+    jmp .Lmain_324
+.Lmain_323:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_325
+.Lmain_324:
+.Lmain_325:
+    addq $0, %rsp
+.Lmain_322:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_327
+    jmp .Lmain_328
+.Lmain_327:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_329
+.Lmain_328:
+.Lmain_329:
+    addq $0, %rsp
+.Lmain_326:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_330
+    jmp .Lmain_331
+.Lmain_330:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_332
+.Lmain_331:
+.Lmain_332:
+    addq $0, %rsp
+.Lmain_317:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_315:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_314
+.Lmain_316:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_312
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_333
+    jmp .Lmain_334
+.Lmain_333:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_335
+.Lmain_334:
+.Lmain_335:
+    addq $0, %rsp
+.Lmain_313:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_316
+.Lmain_312:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_309:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_342
+.Lmain_341:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_346
+    jmp .Lmain_347
+.Lmain_346:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_348
+.Lmain_347:
+.Lmain_348:
+    addq $0, %rsp
+.Lmain_345:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_350
+    jmp .Lmain_351
+.Lmain_350:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_352
+.Lmain_351:
+.Lmain_352:
+    addq $0, %rsp
+.Lmain_349:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_354
+    jmp .Lmain_355
+.Lmain_354:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_356
+.Lmain_355:
+.Lmain_356:
+    addq $0, %rsp
+.Lmain_353:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_357
+    jmp .Lmain_358
+.Lmain_357:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_359
+.Lmain_358:
+.Lmain_359:
+    addq $0, %rsp
+.Lmain_344:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_342:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_341
+.Lmain_343:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_339
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_360
+    jmp .Lmain_361
+.Lmain_360:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_362
+.Lmain_361:
+.Lmain_362:
+    addq $0, %rsp
+.Lmain_340:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_343
+.Lmain_339:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_336:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_369
+.Lmain_368:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_373
+    jmp .Lmain_374
+.Lmain_373:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_375
+.Lmain_374:
+.Lmain_375:
+    addq $0, %rsp
+.Lmain_372:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_377
+    jmp .Lmain_378
+.Lmain_377:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_379
+.Lmain_378:
+.Lmain_379:
+    addq $0, %rsp
+.Lmain_376:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_381
+    jmp .Lmain_382
+.Lmain_381:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_383
+.Lmain_382:
+.Lmain_383:
+    addq $0, %rsp
+.Lmain_380:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_384
+    jmp .Lmain_385
+.Lmain_384:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_386
+.Lmain_385:
+.Lmain_386:
+    addq $0, %rsp
+.Lmain_371:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_369:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_368
+.Lmain_370:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_366
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_387
+    jmp .Lmain_388
+.Lmain_387:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_389
+.Lmain_388:
+.Lmain_389:
+    addq $0, %rsp
+.Lmain_367:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_370
+.Lmain_366:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_363:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_395
+.Lmain_394:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_399
+    jmp .Lmain_400
+.Lmain_399:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_401
+.Lmain_400:
+.Lmain_401:
+    addq $0, %rsp
+.Lmain_398:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_403
+    jmp .Lmain_404
+.Lmain_403:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_405
+.Lmain_404:
+.Lmain_405:
+    addq $0, %rsp
+.Lmain_402:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_407
+    jmp .Lmain_408
+.Lmain_407:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_409
+.Lmain_408:
+.Lmain_409:
+    addq $0, %rsp
+.Lmain_406:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_410
+    jmp .Lmain_411
+.Lmain_410:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_412
+.Lmain_411:
+.Lmain_412:
+    addq $0, %rsp
+.Lmain_397:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_395:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_394
+.Lmain_396:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_392
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_413
+    jmp .Lmain_414
+.Lmain_413:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_415
+.Lmain_414:
+.Lmain_415:
+    addq $0, %rsp
+.Lmain_393:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_396
+.Lmain_392:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_308:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_306:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_305
+.Lmain_307:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_303
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_421
+.Lmain_420:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_425
+    jmp .Lmain_426
+.Lmain_425:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_427
+.Lmain_426:
+.Lmain_427:
+    addq $0, %rsp
+.Lmain_424:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_429
+    jmp .Lmain_430
+.Lmain_429:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_431
+.Lmain_430:
+.Lmain_431:
+    addq $0, %rsp
+.Lmain_428:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_433
+    jmp .Lmain_434
+.Lmain_433:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_435
+.Lmain_434:
+.Lmain_435:
+    addq $0, %rsp
+.Lmain_432:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_436
+    jmp .Lmain_437
+.Lmain_436:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_438
+.Lmain_437:
+.Lmain_438:
+    addq $0, %rsp
+.Lmain_423:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_421:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_420
+.Lmain_422:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_418
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_439
+    jmp .Lmain_440
+.Lmain_439:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_441
+.Lmain_440:
+.Lmain_441:
+    addq $0, %rsp
+.Lmain_419:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_422
+.Lmain_418:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_304:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_307
+.Lmain_303:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_300:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_447
+.Lmain_446:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_456
+.Lmain_455:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_460
+    jmp .Lmain_461
+.Lmain_460:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_462
+.Lmain_461:
+.Lmain_462:
+    addq $0, %rsp
+.Lmain_459:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_464
+    jmp .Lmain_465
+.Lmain_464:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_466
+.Lmain_465:
+.Lmain_466:
+    addq $0, %rsp
+.Lmain_463:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_468
+    jmp .Lmain_469
+.Lmain_468:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_470
+.Lmain_469:
+.Lmain_470:
+    addq $0, %rsp
+.Lmain_467:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_471
+    jmp .Lmain_472
+.Lmain_471:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_473
+.Lmain_472:
+.Lmain_473:
+    addq $0, %rsp
+.Lmain_458:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_456:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_455
+.Lmain_457:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_453
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_474
+    jmp .Lmain_475
+.Lmain_474:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_476
+.Lmain_475:
+.Lmain_476:
+    addq $0, %rsp
+.Lmain_454:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_457
+.Lmain_453:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_450:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_483
+.Lmain_482:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_487
+    jmp .Lmain_488
+.Lmain_487:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_489
+.Lmain_488:
+.Lmain_489:
+    addq $0, %rsp
+.Lmain_486:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_491
+    jmp .Lmain_492
+.Lmain_491:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_493
+.Lmain_492:
+.Lmain_493:
+    addq $0, %rsp
+.Lmain_490:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_495
+    jmp .Lmain_496
+.Lmain_495:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_497
+.Lmain_496:
+.Lmain_497:
+    addq $0, %rsp
+.Lmain_494:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_498
+    jmp .Lmain_499
+.Lmain_498:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_500
+.Lmain_499:
+.Lmain_500:
+    addq $0, %rsp
+.Lmain_485:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_483:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_482
+.Lmain_484:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_480
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_501
+    jmp .Lmain_502
+.Lmain_501:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_503
+.Lmain_502:
+.Lmain_503:
+    addq $0, %rsp
+.Lmain_481:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_484
+.Lmain_480:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_477:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_510
+.Lmain_509:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_514
+    jmp .Lmain_515
+.Lmain_514:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_516
+.Lmain_515:
+.Lmain_516:
+    addq $0, %rsp
+.Lmain_513:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_518
+    jmp .Lmain_519
+.Lmain_518:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_520
+.Lmain_519:
+.Lmain_520:
+    addq $0, %rsp
+.Lmain_517:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_522
+    jmp .Lmain_523
+.Lmain_522:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_524
+.Lmain_523:
+.Lmain_524:
+    addq $0, %rsp
+.Lmain_521:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_525
+    jmp .Lmain_526
+.Lmain_525:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_527
+.Lmain_526:
+.Lmain_527:
+    addq $0, %rsp
+.Lmain_512:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_510:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_509
+.Lmain_511:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_507
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_528
+    jmp .Lmain_529
+.Lmain_528:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_530
+.Lmain_529:
+.Lmain_530:
+    addq $0, %rsp
+.Lmain_508:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_511
+.Lmain_507:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_504:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_536
+.Lmain_535:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_540
+    jmp .Lmain_541
+.Lmain_540:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_542
+.Lmain_541:
+.Lmain_542:
+    addq $0, %rsp
+.Lmain_539:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_544
+    jmp .Lmain_545
+.Lmain_544:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_546
+.Lmain_545:
+.Lmain_546:
+    addq $0, %rsp
+.Lmain_543:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_548
+    jmp .Lmain_549
+.Lmain_548:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_550
+.Lmain_549:
+.Lmain_550:
+    addq $0, %rsp
+.Lmain_547:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_551
+    jmp .Lmain_552
+.Lmain_551:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_553
+.Lmain_552:
+.Lmain_553:
+    addq $0, %rsp
+.Lmain_538:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_536:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_535
+.Lmain_537:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_533
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_554
+    jmp .Lmain_555
+.Lmain_554:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_556
+.Lmain_555:
+.Lmain_556:
+    addq $0, %rsp
+.Lmain_534:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_537
+.Lmain_533:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_449:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_447:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_446
+.Lmain_448:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_444
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_562
+.Lmain_561:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_566
+    jmp .Lmain_567
+.Lmain_566:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_568
+.Lmain_567:
+.Lmain_568:
+    addq $0, %rsp
+.Lmain_565:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_570
+    jmp .Lmain_571
+.Lmain_570:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_572
+.Lmain_571:
+.Lmain_572:
+    addq $0, %rsp
+.Lmain_569:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_574
+    jmp .Lmain_575
+.Lmain_574:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_576
+.Lmain_575:
+.Lmain_576:
+    addq $0, %rsp
+.Lmain_573:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_577
+    jmp .Lmain_578
+.Lmain_577:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_579
+.Lmain_578:
+.Lmain_579:
+    addq $0, %rsp
+.Lmain_564:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_562:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_561
+.Lmain_563:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_559
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_580
+    jmp .Lmain_581
+.Lmain_580:
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+    jmp .Lmain_582
+.Lmain_581:
+.Lmain_582:
+    addq $0, %rsp
+.Lmain_560:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_563
+.Lmain_559:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_445:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_448
+.Lmain_444:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_15:
+    .loc 1 7 34
+    incl -6008(%rbp)
+.Lmain_14:
+    addq $0, %rsp
+    .loc 1 16 5
+    movq $256, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
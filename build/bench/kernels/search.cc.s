@@ -0,0 +1,2667 @@
+    .file 1 "bench/kernels/search.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $6000, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6004(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_10:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_11:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 3 31
+    incl -6004(%rbp)
+.Lmain_6:
+    movslq -6004(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $1500, -6004(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 4 9
+    movq $2003, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    imulq $7919, %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -6004(%rbp), %rcx
+    movl %eax, -6000(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 3 31
+    incl -6004(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6004(%rbp)
+    .loc 1 7 5
+    movq $1000, %rax
+    movl %eax, -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_22
+    .p2align 4,,10
+.Lmain_21:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_31
+    .p2align 4,,10
+.Lmain_30:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_35
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_35:
+    addq $0, %rsp
+.Lmain_34:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_37
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_37:
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_39
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_39:
+    addq $0, %rsp
+.Lmain_38:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_40
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_40:
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_31:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_30
+.Lmain_32:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_28
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_41
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_41:
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_32
+.Lmain_28:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_48
+    .p2align 4,,10
+.Lmain_47:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_52
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_52:
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_54
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_54:
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_56
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_56:
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_57
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_57:
+    addq $0, %rsp
+.Lmain_50:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_48:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_47
+.Lmain_49:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_45
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_58:
+    addq $0, %rsp
+.Lmain_46:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_49
+.Lmain_45:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_65
+    .p2align 4,,10
+.Lmain_64:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_69:
+    addq $0, %rsp
+.Lmain_68:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_71
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_71:
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_73
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_73:
+    addq $0, %rsp
+.Lmain_72:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_74
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_74:
+    addq $0, %rsp
+.Lmain_67:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_65:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_64
+.Lmain_66:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_62
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_75
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_75:
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_66
+.Lmain_62:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_81
+    .p2align 4,,10
+.Lmain_80:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_85
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_85:
+    addq $0, %rsp
+.Lmain_84:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_87
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_87:
+    addq $0, %rsp
+.Lmain_86:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_89
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_89:
+    addq $0, %rsp
+.Lmain_88:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_90
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_90:
+    addq $0, %rsp
+.Lmain_83:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_81:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_80
+.Lmain_82:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_78
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_91
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_91:
+    addq $0, %rsp
+.Lmain_79:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_82
+.Lmain_78:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_22:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_21
+.Lmain_23:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_19
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_97
+    .p2align 4,,10
+.Lmain_96:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_101
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_101:
+    addq $0, %rsp
+.Lmain_100:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_103
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_103:
+    addq $0, %rsp
+.Lmain_102:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_105
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_105:
+    addq $0, %rsp
+.Lmain_104:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_106
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_106:
+    addq $0, %rsp
+.Lmain_99:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_97:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_96
+.Lmain_98:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_94
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_107
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_107:
+    addq $0, %rsp
+.Lmain_95:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_98
+.Lmain_94:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_23
+.Lmain_19:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_16:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_114
+    .p2align 4,,10
+.Lmain_113:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_123
+    .p2align 4,,10
+.Lmain_122:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_127
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_127:
+    addq $0, %rsp
+.Lmain_126:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_129
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_129:
+    addq $0, %rsp
+.Lmain_128:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_131
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_131:
+    addq $0, %rsp
+.Lmain_130:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_132
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_132:
+    addq $0, %rsp
+.Lmain_125:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_123:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_122
+.Lmain_124:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_120
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_133
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_133:
+    addq $0, %rsp
+.Lmain_121:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_124
+.Lmain_120:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_117:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_140
+    .p2align 4,,10
+.Lmain_139:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_144
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_144:
+    addq $0, %rsp
+.Lmain_143:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_146
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_146:
+    addq $0, %rsp
+.Lmain_145:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_148
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_148:
+    addq $0, %rsp
+.Lmain_147:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_149
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_149:
+    addq $0, %rsp
+.Lmain_142:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_140:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_139
+.Lmain_141:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_137
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_150
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_150:
+    addq $0, %rsp
+.Lmain_138:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_141
+.Lmain_137:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_134:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_157
+    .p2align 4,,10
+.Lmain_156:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_161
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_161:
+    addq $0, %rsp
+.Lmain_160:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_163
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_163:
+    addq $0, %rsp
+.Lmain_162:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_165
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_165:
+    addq $0, %rsp
+.Lmain_164:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_166
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_166:
+    addq $0, %rsp
+.Lmain_159:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_157:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_156
+.Lmain_158:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_154
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_167
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_167:
+    addq $0, %rsp
+.Lmain_155:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_158
+.Lmain_154:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_151:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_173
+    .p2align 4,,10
+.Lmain_172:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_177
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_177:
+    addq $0, %rsp
+.Lmain_176:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_179
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_179:
+    addq $0, %rsp
+.Lmain_178:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_181
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_181:
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_182
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_182:
+    addq $0, %rsp
+.Lmain_175:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_173:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_172
+.Lmain_174:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_170
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_183
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_183:
+    addq $0, %rsp
+.Lmain_171:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_174
+.Lmain_170:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_116:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_114:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_113
+.Lmain_115:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_111
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_189
+    .p2align 4,,10
+.Lmain_188:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_193
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_193:
+    addq $0, %rsp
+.Lmain_192:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_195
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_195:
+    addq $0, %rsp
+.Lmain_194:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_197
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_197:
+    addq $0, %rsp
+.Lmain_196:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_198
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_198:
+    addq $0, %rsp
+.Lmain_191:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_189:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_188
+.Lmain_190:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_186
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_199
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_199:
+    addq $0, %rsp
+.Lmain_187:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_190
+.Lmain_186:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_112:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_115
+.Lmain_111:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_108:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_206
+    .p2align 4,,10
+.Lmain_205:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_215
+    .p2align 4,,10
+.Lmain_214:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_219
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_219:
+    addq $0, %rsp
+.Lmain_218:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_221
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_221:
+    addq $0, %rsp
+.Lmain_220:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_223
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_223:
+    addq $0, %rsp
+.Lmain_222:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_224
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_224:
+    addq $0, %rsp
+.Lmain_217:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_215:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_214
+.Lmain_216:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_212
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_225
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_225:
+    addq $0, %rsp
+.Lmain_213:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_216
+.Lmain_212:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_209:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_232
+    .p2align 4,,10
+.Lmain_231:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_236
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_236:
+    addq $0, %rsp
+.Lmain_235:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_238
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_238:
+    addq $0, %rsp
+.Lmain_237:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_240
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_240:
+    addq $0, %rsp
+.Lmain_239:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_241
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_241:
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_232:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_231
+.Lmain_233:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_229
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_242
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_242:
+    addq $0, %rsp
+.Lmain_230:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_233
+.Lmain_229:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_226:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_249
+    .p2align 4,,10
+.Lmain_248:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_253
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_253:
+    addq $0, %rsp
+.Lmain_252:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_255
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_255:
+    addq $0, %rsp
+.Lmain_254:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_257
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_257:
+    addq $0, %rsp
+.Lmain_256:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_258
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_258:
+    addq $0, %rsp
+.Lmain_251:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_249:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_248
+.Lmain_250:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_246
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_259
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_259:
+    addq $0, %rsp
+.Lmain_247:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_250
+.Lmain_246:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_243:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_265
+    .p2align 4,,10
+.Lmain_264:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_269
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_269:
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_271
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_271:
+    addq $0, %rsp
+.Lmain_270:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_273
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_273:
+    addq $0, %rsp
+.Lmain_272:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_274
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_274:
+    addq $0, %rsp
+.Lmain_267:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_265:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_264
+.Lmain_266:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_262
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_275
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_275:
+    addq $0, %rsp
+.Lmain_263:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_266
+.Lmain_262:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_208:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_206:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_205
+.Lmain_207:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_203
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_281
+    .p2align 4,,10
+.Lmain_280:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_285
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_285:
+    addq $0, %rsp
+.Lmain_284:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_287
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_287:
+    addq $0, %rsp
+.Lmain_286:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_289
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_289:
+    addq $0, %rsp
+.Lmain_288:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_290
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_290:
+    addq $0, %rsp
+.Lmain_283:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_281:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_280
+.Lmain_282:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_278
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_291
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_291:
+    addq $0, %rsp
+.Lmain_279:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_282
+.Lmain_278:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_204:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_207
+.Lmain_203:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_200:
+    .loc 1 7 34
+    incl -6008(%rbp)
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -6012(%rbp)
+    jmp .Lmain_297
+    .p2align 4,,10
+.Lmain_296:
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_306
+    .p2align 4,,10
+.Lmain_305:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_310
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_310:
+    addq $0, %rsp
+.Lmain_309:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_312
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_312:
+    addq $0, %rsp
+.Lmain_311:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_314
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_314:
+    addq $0, %rsp
+.Lmain_313:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_315
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_315:
+    addq $0, %rsp
+.Lmain_308:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_306:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_305
+.Lmain_307:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_303
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_316
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_316:
+    addq $0, %rsp
+.Lmain_304:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_307
+.Lmain_303:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_300:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_323
+    .p2align 4,,10
+.Lmain_322:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_327
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_327:
+    addq $0, %rsp
+.Lmain_326:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_329
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_329:
+    addq $0, %rsp
+.Lmain_328:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_331
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_331:
+    addq $0, %rsp
+.Lmain_330:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_332
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_332:
+    addq $0, %rsp
+.Lmain_325:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_323:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_322
+.Lmain_324:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_320
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_333
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_333:
+    addq $0, %rsp
+.Lmain_321:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_324
+.Lmain_320:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_317:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_340
+    .p2align 4,,10
+.Lmain_339:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_344
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_344:
+    addq $0, %rsp
+.Lmain_343:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_346
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_346:
+    addq $0, %rsp
+.Lmain_345:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_348
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_348:
+    addq $0, %rsp
+.Lmain_347:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_349
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_349:
+    addq $0, %rsp
+.Lmain_342:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_340:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_339
+.Lmain_341:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_337
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_350
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_350:
+    addq $0, %rsp
+.Lmain_338:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_341
+.Lmain_337:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_334:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_356
+    .p2align 4,,10
+.Lmain_355:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_360
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_360:
+    addq $0, %rsp
+.Lmain_359:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_362
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_362:
+    addq $0, %rsp
+.Lmain_361:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_364
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_364:
+    addq $0, %rsp
+.Lmain_363:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_365
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_365:
+    addq $0, %rsp
+.Lmain_358:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_356:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_355
+.Lmain_357:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_353
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_366
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_366:
+    addq $0, %rsp
+.Lmain_354:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_357
+.Lmain_353:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_299:
+    .loc 1 8 35
+    incl -6012(%rbp)
+.Lmain_297:
+    movslq -6012(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_296
+.Lmain_298:
+    cmpl $1500, -6012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_294
+    .loc 1 9 13
+    movslq -6012(%rbp), %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    movl %eax, -6016(%rbp)
+    jmp .Lmain_372
+    .p2align 4,,10
+.Lmain_371:
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_376
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_376:
+    addq $0, %rsp
+.Lmain_375:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_378
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_378:
+    addq $0, %rsp
+.Lmain_377:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_380
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_380:
+    addq $0, %rsp
+.Lmain_379:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_381
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_381:
+    addq $0, %rsp
+.Lmain_374:
+    .loc 1 9 43
+    incl -6016(%rbp)
+.Lmain_372:
+    movslq -6016(%rbp), %rax
+    addq $3, %rax
+    cmpq $1500, %rax
+    jl .Lmain_371
+.Lmain_373:
+    cmpl $1500, -6016(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_369
+    .loc 1 10 17
+    movslq -6012(%rbp), %rcx
+    movslq -6000(%rbp,%rcx,4), %rax
+    movslq -6016(%rbp), %rcx
+    addl -6000(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    cmpl -6008(%rbp), %eax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    je .Lmain_382
+    .loc 1 11 21
+    incl -6004(%rbp)
+    addq $0, %rsp
+.Lmain_382:
+    addq $0, %rsp
+.Lmain_370:
+    .loc 1 9 43
+    incl -6016(%rbp)
+    jmp .Lmain_373
+.Lmain_369:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_295:
+    .loc 1 8 35
+    incl -6012(%rbp)
+    jmp .Lmain_298
+.Lmain_294:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_15:
+    .loc 1 7 34
+    incl -6008(%rbp)
+.Lmain_14:
+    addq $0, %rsp
+    .loc 1 16 5
+    movq $256, %rax
+    push %rax
+    movslq -6004(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,918 @@
+    .file 1 "bench/kernels/short_loops.c"
+.globl main
+.type main, @function
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $32, %rsp
+    .loc 1 3 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -36(%rbp)
+    .loc 1 4 5
+    movq $0, %rax
+    movl %eax, -40(%rbp)
+    jmp .Lmain_6
+.Lmain_5:
+    .loc 1 5 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_14:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_15:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_16:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 5 32
+    incl -44(%rbp)
+.Lmain_12:
+    addq $8, %rsp
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_26:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_27:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_28:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 8 32
+    incl -44(%rbp)
+.Lmain_23:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 4 34
+    incl -40(%rbp)
+    .loc 1 5 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_38:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_39:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 5 32
+    incl -44(%rbp)
+.Lmain_35:
+    addq $8, %rsp
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_49:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_50:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 8 32
+    incl -44(%rbp)
+.Lmain_46:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 4 34
+    incl -40(%rbp)
+    .loc 1 5 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_60:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_61:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_62:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_58:
+    .loc 1 5 32
+    incl -44(%rbp)
+.Lmain_57:
+    addq $8, %rsp
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_71:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_72:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_73:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_74:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_75:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_76:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_69:
+    .loc 1 8 32
+    incl -44(%rbp)
+.Lmain_68:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 4 34
+    incl -40(%rbp)
+.Lmain_6:
+    movslq -40(%rbp), %rax
+    addq $2, %rax
+    cmpq $2000000, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $2000000, -40(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 5 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_82:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_83:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_84:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_85:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_86:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_87:
+    .loc 1 5 32
+    incl -44(%rbp)
+    .loc 1 6 13
+    movslq -40(%rbp), %rax
+    addl -44(%rbp), %eax
+    movslq %eax, %rax
+    movslq -44(%rbp), %rcx
+    movl %eax, -32(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_80:
+    .loc 1 5 32
+    incl -44(%rbp)
+.Lmain_79:
+    addq $8, %rsp
+    .loc 1 8 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_92:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_93:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_94:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_95:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_96:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_97:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_98:
+    .loc 1 8 32
+    incl -44(%rbp)
+    .loc 1 9 13
+    movq $7, %rax
+    push %rax
+    movslq -44(%rbp), %rcx
+    movslq -32(%rbp,%rcx,4), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addl %eax, -36(%rbp)
+    addq $0, %rsp
+.Lmain_91:
+    .loc 1 8 32
+    incl -44(%rbp)
+.Lmain_90:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 34
+    incl -40(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $0, %rsp
+    .loc 1 12 5
+    movq $256, %rax
+    push %rax
+    movslq -36(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
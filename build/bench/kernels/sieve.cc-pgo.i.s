@@ -0,0 +1,220 @@
+    .file 1 "bench/kernels/sieve.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 5 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    incq .Lcounts.main+0(%rip)
+    .loc 1 6 5
+    subq $8, %rsp
+    incq .Lcounts.main+8(%rip)
+    movq $100000, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 7 5
+    subq $400000, %rsp
+    .loc 1 8 5
+    movq $0, %rax
+    movl %eax, -400008(%rbp)
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -400012(%rbp)
+.Lmain_1:
+    cmpl $20, -400012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_2
+    incq .Lcounts.main+24(%rip)
+    jmp .Lmain_3
+.Lmain_2:
+    incq .Lcounts.main+16(%rip)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+.Lmain_5:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_6
+    incq .Lcounts.main+40(%rip)
+    jmp .Lmain_7
+.Lmain_6:
+    incq .Lcounts.main+32(%rip)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_5
+.Lmain_7:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+.Lmain_9:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_10
+    incq .Lcounts.main+56(%rip)
+    jmp .Lmain_11
+.Lmain_10:
+    incq .Lcounts.main+48(%rip)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_13
+    jmp .Lmain_14
+.Lmain_13:
+    incq .Lcounts.main+64(%rip)
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_16:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_17
+    incq .Lcounts.main+88(%rip)
+    jmp .Lmain_18
+.Lmain_17:
+    incq .Lcounts.main+80(%rip)
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_16
+.Lmain_18:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_15
+.Lmain_14:
+    incq .Lcounts.main+72(%rip)
+.Lmain_15:
+    addq $0, %rsp
+.Lmain_12:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_9
+.Lmain_11:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 9 29
+    incl -400012(%rbp)
+    jmp .Lmain_1
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 23 5
+    movq $256, %rax
+    push %rax
+    movslq -400008(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+    .bss
+    .align 8
+.Lcounts.main:
+    .zero 96
+    .section .rodata
+.Lname.main:
+    .ascii "main"
+    .section pgo_records,"aw"
+    .align 8
+    .quad .Lcounts.main, 12, .Lname.main, 4
+    .text
+    .text
+.Lpgo.dump:
+    push %rbx
+    push %r12
+    movq $2, %rax
+    leaq .Lpgo.path(%rip), %rdi
+    movq $577, %rsi
+    movq $420, %rdx
+    syscall
+    testq %rax, %rax
+    js .Lpgo.done
+    movq %rax, %r12
+    leaq __start_pgo_records(%rip), %rbx
+.Lpgo.next:
+    leaq __stop_pgo_records(%rip), %rax
+    cmpq %rax, %rbx
+    jae .Lpgo.close
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 24(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq 16(%rbx), %rsi
+    movq 24(%rbx), %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 8(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq (%rbx), %rsi
+    movq 8(%rbx), %rdx
+    shlq $3, %rdx
+    syscall
+    addq $32, %rbx
+    jmp .Lpgo.next
+.Lpgo.close:
+    movq $3, %rax
+    movq %r12, %rdi
+    syscall
+.Lpgo.done:
+    pop %r12
+    pop %rbx
+    ret
+    .section .fini_array, "aw"
+    .align 8
+    .quad .Lpgo.dump
+    .section .rodata
+.Lpgo.path:
+    .asciz "build/bench/kernels/sieve.cc-pgo.prof"
@@ -0,0 +1,1629 @@
+    .file 1 "bench/kernels/sieve.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 5 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $100000, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 7 5
+    subq $400000, %rsp
+    .loc 1 8 5
+    movq $0, %rax
+    movl %eax, -400008(%rbp)
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -400012(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_15:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_14
+.Lmain_16:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_26
+    .p2align 4,,10
+.Lmain_25:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_31
+.Lmain_30:
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_43
+.Lmain_42:
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_55
+.Lmain_54:
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_66
+.Lmain_65:
+    addq $0, %rsp
+.Lmain_28:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_26:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_25
+.Lmain_27:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_23
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_77
+.Lmain_76:
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_27
+.Lmain_23:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 9 29
+    incl -400012(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_92
+    .p2align 4,,10
+.Lmain_91:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_95:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_96:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_97:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_94:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_92:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_91
+.Lmain_93:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_89
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_90:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_93
+.Lmain_89:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_103
+    .p2align 4,,10
+.Lmain_102:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_108
+.Lmain_107:
+    addq $0, %rsp
+.Lmain_106:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_120
+.Lmain_119:
+    addq $0, %rsp
+.Lmain_118:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_132
+.Lmain_131:
+    addq $0, %rsp
+.Lmain_130:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_143
+.Lmain_142:
+    addq $0, %rsp
+.Lmain_105:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_103:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_102
+.Lmain_104:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_100
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_154
+.Lmain_153:
+    addq $0, %rsp
+.Lmain_101:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_104
+.Lmain_100:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 9 29
+    incl -400012(%rbp)
+.Lmain_6:
+    movslq -400012(%rbp), %rax
+    addq $1, %rax
+    cmpq $20, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $20, -400012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_169
+    .p2align 4,,10
+.Lmain_168:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_172:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_173:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_174:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_171:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_169:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_168
+.Lmain_170:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_166
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_167:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_170
+.Lmain_166:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_180
+    .p2align 4,,10
+.Lmain_179:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_185
+.Lmain_184:
+    addq $0, %rsp
+.Lmain_183:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_197
+.Lmain_196:
+    addq $0, %rsp
+.Lmain_195:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_209
+.Lmain_208:
+    addq $0, %rsp
+.Lmain_207:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_220
+.Lmain_219:
+    addq $0, %rsp
+.Lmain_182:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_180:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_179
+.Lmain_181:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_177
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_231
+.Lmain_230:
+    addq $0, %rsp
+.Lmain_178:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_181
+.Lmain_177:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 9 29
+    incl -400012(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 23 5
+    movq $256, %rax
+    push %rax
+    movslq -400008(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+    .section .text.unlikely,"ax",@progbits
+.type main.cold, @function
+main.cold:
+    .cfi_startproc
+    .cfi_def_cfa %rbp, 16
+    .cfi_offset %rbp, -16
+    .loc 1 15 13
+.Lmain_31:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_37
+    .p2align 4,,10
+.Lmain_36:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_38:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_34
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_39:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_34
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_34
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_35:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_37:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_36
+.Lmain_34:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_30
+    .loc 1 15 13
+.Lmain_43:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_49
+    .p2align 4,,10
+.Lmain_48:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_50:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_46
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_49:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_48
+.Lmain_46:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_42
+    .loc 1 15 13
+.Lmain_55:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_62:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_61:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_60
+.Lmain_58:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_54
+    .loc 1 15 13
+.Lmain_66:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_72
+    .p2align 4,,10
+.Lmain_71:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_73:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_74:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_75:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_72:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_71
+.Lmain_69:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_65
+    .loc 1 15 13
+.Lmain_77:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_83
+    .p2align 4,,10
+.Lmain_82:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_84:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_80
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_85:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_80
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_86:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_80
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_83:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_82
+.Lmain_80:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_76
+    .loc 1 15 13
+.Lmain_108:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_114
+    .p2align 4,,10
+.Lmain_113:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_111
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_116:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_111
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_117:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_111
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_112:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_114:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_113
+.Lmain_111:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_107
+    .loc 1 15 13
+.Lmain_120:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_126
+    .p2align 4,,10
+.Lmain_125:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_127:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_123
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_128:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_123
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_129:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_123
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_124:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_126:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_125
+.Lmain_123:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_119
+    .loc 1 15 13
+.Lmain_132:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_138
+    .p2align 4,,10
+.Lmain_137:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_139:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_135
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_140:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_135
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_141:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_135
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_136:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_138:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_137
+.Lmain_135:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_131
+    .loc 1 15 13
+.Lmain_143:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_149
+    .p2align 4,,10
+.Lmain_148:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_150:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_146
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_151:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_146
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_152:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_146
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_147:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_149:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_148
+.Lmain_146:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_142
+    .loc 1 15 13
+.Lmain_154:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_160
+    .p2align 4,,10
+.Lmain_159:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_161:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_157
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_162:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_157
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_163:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_157
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_160:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_159
+.Lmain_157:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_153
+    .loc 1 15 13
+.Lmain_185:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_191
+    .p2align 4,,10
+.Lmain_190:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_192:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_188
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_193:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_188
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_194:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_188
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_189:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_191:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_190
+.Lmain_188:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_184
+    .loc 1 15 13
+.Lmain_197:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_203
+    .p2align 4,,10
+.Lmain_202:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_204:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_200
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_205:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_200
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_206:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_200
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_201:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_203:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_202
+.Lmain_200:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_196
+    .loc 1 15 13
+.Lmain_209:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_215
+    .p2align 4,,10
+.Lmain_214:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_216:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_212
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_217:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_212
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_218:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_212
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_213:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_215:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_214
+.Lmain_212:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_208
+    .loc 1 15 13
+.Lmain_220:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_226
+    .p2align 4,,10
+.Lmain_225:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_227:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_223
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_228:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_223
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_229:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_223
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_224:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_226:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_225
+.Lmain_223:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_219
+    .loc 1 15 13
+.Lmain_231:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_237
+    .p2align 4,,10
+.Lmain_236:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_238:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_234
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_239:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_234
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_240:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_234
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_235:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_237:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_236
+.Lmain_234:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_230
+    .cfi_endproc
+.size main.cold, .-main.cold
+    .text
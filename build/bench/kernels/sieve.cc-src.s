@@ -0,0 +1,997 @@
+    .file 1 "bench/kernels/sieve.c"
+.globl main
+.type main, @function
+main:
+    .cfi_startproc
+    .loc 1 5 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $100000, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 7 5
+    subq $400000, %rsp
+    .loc 1 8 5
+    movq $0, %rax
+    movl %eax, -400008(%rbp)
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -400012(%rbp)
+    jmp .Lmain_6
+.Lmain_5:
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_15
+.Lmain_14:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_15:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_14
+.Lmain_16:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_26
+.Lmain_25:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_30
+    jmp .Lmain_31
+.Lmain_30:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_33:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_34
+    jmp .Lmain_35
+.Lmain_34:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_33
+.Lmain_35:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_32
+.Lmain_31:
+.Lmain_32:
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_38
+    jmp .Lmain_39
+.Lmain_38:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_41:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_42
+    jmp .Lmain_43
+.Lmain_42:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_41
+.Lmain_43:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_40
+.Lmain_39:
+.Lmain_40:
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_46
+    jmp .Lmain_47
+.Lmain_46:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_49:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_50
+    jmp .Lmain_51
+.Lmain_50:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_49
+.Lmain_51:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_48
+.Lmain_47:
+.Lmain_48:
+    addq $0, %rsp
+.Lmain_45:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_53
+    jmp .Lmain_54
+.Lmain_53:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_56:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_57
+    jmp .Lmain_58
+.Lmain_57:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_56
+.Lmain_58:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_55
+.Lmain_54:
+.Lmain_55:
+    addq $0, %rsp
+.Lmain_28:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_26:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_25
+.Lmain_27:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_23
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_60
+    jmp .Lmain_61
+.Lmain_60:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_63:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_64
+    jmp .Lmain_65
+.Lmain_64:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_63
+.Lmain_65:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_62
+.Lmain_61:
+.Lmain_62:
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_27
+.Lmain_23:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 9 29
+    incl -400012(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_72
+.Lmain_71:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_75:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_76:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_77:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_74:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_72:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_71
+.Lmain_73:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_73
+.Lmain_69:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_83
+.Lmain_82:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_87
+    jmp .Lmain_88
+.Lmain_87:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_90:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_91
+    jmp .Lmain_92
+.Lmain_91:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_93:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_90
+.Lmain_92:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_89
+.Lmain_88:
+.Lmain_89:
+    addq $0, %rsp
+.Lmain_86:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_95
+    jmp .Lmain_96
+.Lmain_95:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_98:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_99
+    jmp .Lmain_100
+.Lmain_99:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_101:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_98
+.Lmain_100:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_97
+.Lmain_96:
+.Lmain_97:
+    addq $0, %rsp
+.Lmain_94:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_103
+    jmp .Lmain_104
+.Lmain_103:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_106:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_107
+    jmp .Lmain_108
+.Lmain_107:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_109:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_106
+.Lmain_108:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_105
+.Lmain_104:
+.Lmain_105:
+    addq $0, %rsp
+.Lmain_102:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_110
+    jmp .Lmain_111
+.Lmain_110:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_113:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_114
+    jmp .Lmain_115
+.Lmain_114:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_116:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_113
+.Lmain_115:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_112
+.Lmain_111:
+.Lmain_112:
+    addq $0, %rsp
+.Lmain_85:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_83:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_82
+.Lmain_84:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_80
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_117
+    jmp .Lmain_118
+.Lmain_117:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_120:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_121
+    jmp .Lmain_122
+.Lmain_121:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_123:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_120
+.Lmain_122:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_119
+.Lmain_118:
+.Lmain_119:
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_84
+.Lmain_80:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 9 29
+    incl -400012(%rbp)
+.Lmain_6:
+    movslq -400012(%rbp), %rax
+    addq $1, %rax
+    cmpq $20, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $20, -400012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_129
+.Lmain_128:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_132:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_133:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_134:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_131:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_129:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_128
+.Lmain_130:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_126
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_127:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_130
+.Lmain_126:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_140
+.Lmain_139:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_144
+    jmp .Lmain_145
+.Lmain_144:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_147:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_148
+    jmp .Lmain_149
+.Lmain_148:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_150:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_147
+.Lmain_149:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_146
+.Lmain_145:
+.Lmain_146:
+    addq $0, %rsp
+.Lmain_143:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_152
+    jmp .Lmain_153
+.Lmain_152:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_155:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_156
+    jmp .Lmain_157
+.Lmain_156:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_155
+.Lmain_157:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_154
+.Lmain_153:
+.Lmain_154:
+    addq $0, %rsp
+.Lmain_151:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_160
+    jmp .Lmain_161
+.Lmain_160:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_163:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_164
+    jmp .Lmain_165
+.Lmain_164:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_166:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_163
+.Lmain_165:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_162
+.Lmain_161:
+.Lmain_162:
+    addq $0, %rsp
+.Lmain_159:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_167
+    jmp .Lmain_168
+.Lmain_167:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_170:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_171
+    jmp .Lmain_172
+.Lmain_171:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_173:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_170
+.Lmain_172:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_169
+.Lmain_168:
+.Lmain_169:
+    addq $0, %rsp
+.Lmain_142:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_140:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_139
+.Lmain_141:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_137
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_174
+    jmp .Lmain_175
+.Lmain_174:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+.Lmain_177:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_178
+    jmp .Lmain_179
+.Lmain_178:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+    jmp .Lmain_177
+.Lmain_179:
+    addq $8, %rsp
+    addq $0, %rsp
+    jmp .Lmain_176
+.Lmain_175:
+.Lmain_176:
+    addq $0, %rsp
+.Lmain_138:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_141
+.Lmain_137:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 9 29
+    incl -400012(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 23 5
+    movq $256, %rax
+    push %rax
+    movslq -400008(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
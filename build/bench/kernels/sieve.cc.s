@@ -0,0 +1,975 @@
+    .file 1 "bench/kernels/sieve.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 5 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 6 5
+    subq $8, %rsp
+    movq $100000, %rax
+    movl %eax, -4(%rbp)
+    .loc 1 7 5
+    subq $400000, %rsp
+    .loc 1 8 5
+    movq $0, %rax
+    movl %eax, -400008(%rbp)
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -400012(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_15:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_14
+.Lmain_16:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_26
+    .p2align 4,,10
+.Lmain_25:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_31
+    jmp .Lmain_30
+.Lmain_31:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_37
+    .p2align 4,,10
+.Lmain_36:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_35:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_37:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_36
+.Lmain_34:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_30:
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_40
+    jmp .Lmain_39
+.Lmain_40:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_46
+    .p2align 4,,10
+.Lmain_45:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_46:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_45
+.Lmain_43:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_39:
+    addq $0, %rsp
+.Lmain_38:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_49
+    jmp .Lmain_48
+.Lmain_49:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_55
+    .p2align 4,,10
+.Lmain_54:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_55:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_54
+.Lmain_52:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_48:
+    addq $0, %rsp
+.Lmain_47:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_57
+    jmp .Lmain_56
+.Lmain_57:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_63
+    .p2align 4,,10
+.Lmain_62:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_61:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_63:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_62
+.Lmain_60:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_56:
+    addq $0, %rsp
+.Lmain_28:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_26:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_25
+.Lmain_27:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_23
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_65
+    jmp .Lmain_64
+.Lmain_65:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_71
+    .p2align 4,,10
+.Lmain_70:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_69:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_71:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_70
+.Lmain_68:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_64:
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_27
+.Lmain_23:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 9 29
+    incl -400012(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_77
+    .p2align 4,,10
+.Lmain_76:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_80:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_82:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_79:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_77:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_76
+.Lmain_78:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_74
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_75:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_78
+.Lmain_74:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_88
+    .p2align 4,,10
+.Lmain_87:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_93
+    jmp .Lmain_92
+.Lmain_93:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_99
+    .p2align 4,,10
+.Lmain_98:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_97:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_99:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_98
+.Lmain_96:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_92:
+    addq $0, %rsp
+.Lmain_91:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_102
+    jmp .Lmain_101
+.Lmain_102:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_108
+    .p2align 4,,10
+.Lmain_107:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_106:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_108:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_107
+.Lmain_105:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_101:
+    addq $0, %rsp
+.Lmain_100:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_111
+    jmp .Lmain_110
+.Lmain_111:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_117
+    .p2align 4,,10
+.Lmain_116:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_117:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_116
+.Lmain_114:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_110:
+    addq $0, %rsp
+.Lmain_109:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_119
+    jmp .Lmain_118
+.Lmain_119:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_125
+    .p2align 4,,10
+.Lmain_124:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_123:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_125:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_124
+.Lmain_122:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_118:
+    addq $0, %rsp
+.Lmain_90:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_88:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_87
+.Lmain_89:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_85
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_127
+    jmp .Lmain_126
+.Lmain_127:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_133
+    .p2align 4,,10
+.Lmain_132:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_131:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_133:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_132
+.Lmain_130:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_126:
+    addq $0, %rsp
+.Lmain_86:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_89
+.Lmain_85:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 9 29
+    incl -400012(%rbp)
+.Lmain_6:
+    movslq -400012(%rbp), %rax
+    addq $1, %rax
+    cmpq $20, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $20, -400012(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_139
+    .p2align 4,,10
+.Lmain_138:
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_142:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_143:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_144:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_141:
+    .loc 1 10 32
+    incl -400016(%rbp)
+.Lmain_139:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_138
+.Lmain_140:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_136
+    .loc 1 11 13
+    movslq -400016(%rbp), %rcx
+    movl $0, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_137:
+    .loc 1 10 32
+    incl -400016(%rbp)
+    jmp .Lmain_140
+.Lmain_136:
+    addq $0, %rsp
+    .loc 1 13 9
+    movl $0, -400008(%rbp)
+    .loc 1 14 9
+    movq $2, %rax
+    movl %eax, -400016(%rbp)
+    jmp .Lmain_150
+    .p2align 4,,10
+.Lmain_149:
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_155
+    jmp .Lmain_154
+.Lmain_155:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_161
+    .p2align 4,,10
+.Lmain_160:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_159:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_161:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_160
+.Lmain_158:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_154:
+    addq $0, %rsp
+.Lmain_153:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_164
+    jmp .Lmain_163
+.Lmain_164:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_170
+    .p2align 4,,10
+.Lmain_169:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_168:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_170:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_169
+.Lmain_167:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_163:
+    addq $0, %rsp
+.Lmain_162:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_173
+    jmp .Lmain_172
+.Lmain_173:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_179
+    .p2align 4,,10
+.Lmain_178:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_177:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_179:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_178
+.Lmain_176:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_172:
+    addq $0, %rsp
+.Lmain_171:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_181
+    jmp .Lmain_180
+.Lmain_181:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_187
+    .p2align 4,,10
+.Lmain_186:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_185:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_187:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_186
+.Lmain_184:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_180:
+    addq $0, %rsp
+.Lmain_152:
+    .loc 1 14 32
+    incl -400016(%rbp)
+.Lmain_150:
+    movslq -400016(%rbp), %rax
+    addq $3, %rax
+    movslq -4(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_149
+.Lmain_151:
+    movslq -400016(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_147
+    .loc 1 15 13
+    movslq -400016(%rbp), %rcx
+    movslq -400004(%rbp,%rcx,4), %rax
+    cmpq $0, %rax
+    movq $0, %rax
+    sete %al
+    cmpq $0, %rax
+    jne .Lmain_189
+    jmp .Lmain_188
+.Lmain_189:
+    .loc 1 16 17
+    incl -400008(%rbp)
+    .loc 1 17 17
+    subq $8, %rsp
+    movslq -400016(%rbp), %rax
+    addl -400016(%rbp), %eax
+    movslq %eax, %rax
+    movl %eax, -400020(%rbp)
+    jmp .Lmain_195
+    .p2align 4,,10
+.Lmain_194:
+    .loc 1 18 21
+    movslq -400020(%rbp), %rcx
+    movl $1, -400004(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_193:
+    .loc 1 17 44
+    movslq -400016(%rbp), %rax
+    addl %eax, -400020(%rbp)
+.Lmain_195:
+    movslq -400020(%rbp), %rax
+    cmpl -4(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_194
+.Lmain_192:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_188:
+    addq $0, %rsp
+.Lmain_148:
+    .loc 1 14 32
+    incl -400016(%rbp)
+    jmp .Lmain_151
+.Lmain_147:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 9 29
+    incl -400012(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 23 5
+    movq $256, %rax
+    push %rax
+    movslq -400008(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
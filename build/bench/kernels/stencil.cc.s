@@ -0,0 +1,917 @@
+    .file 1 "bench/kernels/stencil.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $4096, %rsp
+    .loc 1 3 5
+    subq $4096, %rsp
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8196(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 5 9
+    movq $17, %rax
+    push %rax
+    movslq -8196(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8196(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 4 31
+    incl -8196(%rbp)
+    .loc 1 5 9
+    movq $17, %rax
+    push %rax
+    movslq -8196(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8196(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_10:
+    .loc 1 4 31
+    incl -8196(%rbp)
+    .loc 1 5 9
+    movq $17, %rax
+    push %rax
+    movslq -8196(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8196(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_11:
+    .loc 1 4 31
+    incl -8196(%rbp)
+    .loc 1 5 9
+    movq $17, %rax
+    push %rax
+    movslq -8196(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8196(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 4 31
+    incl -8196(%rbp)
+.Lmain_6:
+    movslq -8196(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $1024, -8196(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 5 9
+    movq $17, %rax
+    push %rax
+    movslq -8196(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8196(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 31
+    incl -8196(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 7 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8196(%rbp)
+    jmp .Lmain_17
+    .p2align 4,,10
+.Lmain_16:
+    .loc 1 8 9
+    movq $1, %rax
+    movl %eax, -8200(%rbp)
+    jmp .Lmain_26
+    .p2align 4,,10
+.Lmain_25:
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_28:
+    .loc 1 8 35
+    incl -8200(%rbp)
+.Lmain_26:
+    movslq -8200(%rbp), %rax
+    addq $3, %rax
+    cmpq $1023, %rax
+    jl .Lmain_25
+.Lmain_27:
+    cmpl $1023, -8200(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_23
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    jmp .Lmain_27
+.Lmain_23:
+    addq $0, %rsp
+    .loc 1 11 9
+    movq $1, %rax
+    movl %eax, -8200(%rbp)
+    jmp .Lmain_37
+    .p2align 4,,10
+.Lmain_36:
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_40:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_39:
+    .loc 1 11 35
+    incl -8200(%rbp)
+.Lmain_37:
+    movslq -8200(%rbp), %rax
+    addq $3, %rax
+    cmpq $1023, %rax
+    jl .Lmain_36
+.Lmain_38:
+    cmpl $1023, -8200(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_34
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_35:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    jmp .Lmain_38
+.Lmain_34:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 7 31
+    incl -8196(%rbp)
+    .loc 1 8 9
+    movq $1, %rax
+    movl %eax, -8200(%rbp)
+    jmp .Lmain_48
+    .p2align 4,,10
+.Lmain_47:
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_51:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_50:
+    .loc 1 8 35
+    incl -8200(%rbp)
+.Lmain_48:
+    movslq -8200(%rbp), %rax
+    addq $3, %rax
+    cmpq $1023, %rax
+    jl .Lmain_47
+.Lmain_49:
+    cmpl $1023, -8200(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_45
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_46:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    jmp .Lmain_49
+.Lmain_45:
+    addq $0, %rsp
+    .loc 1 11 9
+    movq $1, %rax
+    movl %eax, -8200(%rbp)
+    jmp .Lmain_59
+    .p2align 4,,10
+.Lmain_58:
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_62:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_61:
+    .loc 1 11 35
+    incl -8200(%rbp)
+.Lmain_59:
+    movslq -8200(%rbp), %rax
+    addq $3, %rax
+    cmpq $1023, %rax
+    jl .Lmain_58
+.Lmain_60:
+    cmpl $1023, -8200(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_56
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_57:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    jmp .Lmain_60
+.Lmain_56:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 7 31
+    incl -8196(%rbp)
+.Lmain_17:
+    movslq -8196(%rbp), %rax
+    addq $1, %rax
+    cmpq $4000, %rax
+    jl .Lmain_16
+.Lmain_18:
+    cmpl $4000, -8196(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_14
+    .loc 1 8 9
+    movq $1, %rax
+    movl %eax, -8200(%rbp)
+    jmp .Lmain_70
+    .p2align 4,,10
+.Lmain_69:
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_73:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_74:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_75:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_72:
+    .loc 1 8 35
+    incl -8200(%rbp)
+.Lmain_70:
+    movslq -8200(%rbp), %rax
+    addq $3, %rax
+    cmpq $1023, %rax
+    jl .Lmain_69
+.Lmain_71:
+    cmpl $1023, -8200(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_67
+    .loc 1 9 13
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    imulq $2, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4100(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    addl -4092(%rbp,%rcx,4), %eax
+    movslq %eax, %rax
+    addl -8196(%rbp), %eax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -8192(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_68:
+    .loc 1 8 35
+    incl -8200(%rbp)
+    jmp .Lmain_71
+.Lmain_67:
+    addq $0, %rsp
+    .loc 1 11 9
+    movq $1, %rax
+    movl %eax, -8200(%rbp)
+    jmp .Lmain_81
+    .p2align 4,,10
+.Lmain_80:
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_84:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_85:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_86:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_83:
+    .loc 1 11 35
+    incl -8200(%rbp)
+.Lmain_81:
+    movslq -8200(%rbp), %rax
+    addq $3, %rax
+    cmpq $1023, %rax
+    jl .Lmain_80
+.Lmain_82:
+    cmpl $1023, -8200(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_78
+    .loc 1 12 13
+    movq $1000, %rax
+    push %rax
+    movslq -8200(%rbp), %rcx
+    movslq -8192(%rbp,%rcx,4), %rax
+    movslq -8200(%rbp), %rcx
+    leaq 3(%rax,%rcx,8), %rax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movslq -8200(%rbp), %rcx
+    movl %eax, -4096(%rbp,%rcx,4)
+    addq $0, %rsp
+.Lmain_79:
+    .loc 1 11 35
+    incl -8200(%rbp)
+    jmp .Lmain_82
+.Lmain_78:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_15:
+    .loc 1 7 31
+    incl -8196(%rbp)
+    jmp .Lmain_18
+.Lmain_14:
+    addq $8, %rsp
+    .loc 1 15 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8196(%rbp)
+    .loc 1 16 5
+    movq $0, %rax
+    movl %eax, -8200(%rbp)
+    jmp .Lmain_92
+    .p2align 4,,10
+.Lmain_91:
+    .loc 1 17 9
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    addl %eax, -8196(%rbp)
+    addq $0, %rsp
+.Lmain_95:
+    .loc 1 16 31
+    incl -8200(%rbp)
+    .loc 1 17 9
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    addl %eax, -8196(%rbp)
+    addq $0, %rsp
+.Lmain_96:
+    .loc 1 16 31
+    incl -8200(%rbp)
+    .loc 1 17 9
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    addl %eax, -8196(%rbp)
+    addq $0, %rsp
+.Lmain_97:
+    .loc 1 16 31
+    incl -8200(%rbp)
+    .loc 1 17 9
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    addl %eax, -8196(%rbp)
+    addq $0, %rsp
+.Lmain_94:
+    .loc 1 16 31
+    incl -8200(%rbp)
+.Lmain_92:
+    movslq -8200(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_91
+.Lmain_93:
+    cmpl $1024, -8200(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_89
+    .loc 1 17 9
+    movslq -8200(%rbp), %rcx
+    movslq -4096(%rbp,%rcx,4), %rax
+    addl %eax, -8196(%rbp)
+    addq $0, %rsp
+.Lmain_90:
+    .loc 1 16 31
+    incl -8200(%rbp)
+    jmp .Lmain_93
+.Lmain_89:
+    addq $0, %rsp
+    .loc 1 19 5
+    movq $256, %rax
+    push %rax
+    movslq -8196(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,383 @@
+    .file 1 "bench/kernels/trans_1024.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    incq .Lcounts.main+0(%rip)
+    .loc 1 2 5
+    subq $4194304, %rsp
+    .loc 1 3 5
+    subq $4194304, %rsp
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+.Lmain_1:
+    cmpl $1024, -8388612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_2
+    incq .Lcounts.main+16(%rip)
+    jmp .Lmain_3
+.Lmain_2:
+    incq .Lcounts.main+8(%rip)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+.Lmain_5:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_6
+    incq .Lcounts.main+32(%rip)
+    jmp .Lmain_7
+.Lmain_6:
+    incq .Lcounts.main+24(%rip)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_5
+.Lmain_7:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    jmp .Lmain_1
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+.Lmain_9:
+    cmpl $4, -8388612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_10
+    incq .Lcounts.main+48(%rip)
+    jmp .Lmain_11
+.Lmain_10:
+    incq .Lcounts.main+40(%rip)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+.Lmain_13:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_14
+    incq .Lcounts.main+64(%rip)
+    jmp .Lmain_15
+.Lmain_14:
+    incq .Lcounts.main+56(%rip)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+.Lmain_17:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_18
+    incq .Lcounts.main+80(%rip)
+    jmp .Lmain_19
+.Lmain_18:
+    incq .Lcounts.main+72(%rip)
+    .loc 1 12 17
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 11 39
+    incl -8388620(%rbp)
+    jmp .Lmain_17
+.Lmain_19:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_16:
+    .loc 1 10 35
+    incl -8388616(%rbp)
+    jmp .Lmain_13
+.Lmain_15:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+.Lmain_21:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_22
+    incq .Lcounts.main+96(%rip)
+    jmp .Lmain_23
+.Lmain_22:
+    incq .Lcounts.main+88(%rip)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+.Lmain_25:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_26
+    incq .Lcounts.main+112(%rip)
+    jmp .Lmain_27
+.Lmain_26:
+    incq .Lcounts.main+104(%rip)
+    .loc 1 17 17
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_28:
+    .loc 1 16 39
+    incl -8388620(%rbp)
+    jmp .Lmain_25
+.Lmain_27:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_24:
+    .loc 1 15 35
+    incl -8388616(%rbp)
+    jmp .Lmain_21
+.Lmain_23:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_12:
+    .loc 1 9 28
+    incl -8388612(%rbp)
+    jmp .Lmain_9
+.Lmain_11:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+.Lmain_29:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_30
+    incq .Lcounts.main+128(%rip)
+    jmp .Lmain_31
+.Lmain_30:
+    incq .Lcounts.main+120(%rip)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+.Lmain_33:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_34
+    incq .Lcounts.main+144(%rip)
+    jmp .Lmain_35
+.Lmain_34:
+    incq .Lcounts.main+136(%rip)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_36:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_33
+.Lmain_35:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    jmp .Lmain_29
+.Lmain_31:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
+    .bss
+    .align 8
+.Lcounts.main:
+    .zero 152
+    .section .rodata
+.Lname.main:
+    .ascii "main"
+    .section pgo_records,"aw"
+    .align 8
+    .quad .Lcounts.main, 19, .Lname.main, 4
+    .text
+    .text
+.Lpgo.dump:
+    push %rbx
+    push %r12
+    movq $2, %rax
+    leaq .Lpgo.path(%rip), %rdi
+    movq $577, %rsi
+    movq $420, %rdx
+    syscall
+    testq %rax, %rax
+    js .Lpgo.done
+    movq %rax, %r12
+    leaq __start_pgo_records(%rip), %rbx
+.Lpgo.next:
+    leaq __stop_pgo_records(%rip), %rax
+    cmpq %rax, %rbx
+    jae .Lpgo.close
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 24(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq 16(%rbx), %rsi
+    movq 24(%rbx), %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    leaq 8(%rbx), %rsi
+    movq $8, %rdx
+    syscall
+    movq $1, %rax
+    movq %r12, %rdi
+    movq (%rbx), %rsi
+    movq 8(%rbx), %rdx
+    shlq $3, %rdx
+    syscall
+    addq $32, %rbx
+    jmp .Lpgo.next
+.Lpgo.close:
+    movq $3, %rax
+    movq %r12, %rdi
+    syscall
+.Lpgo.done:
+    pop %r12
+    pop %rbx
+    ret
+    .section .fini_array, "aw"
+    .align 8
+    .quad .Lpgo.dump
+    .section .rodata
+.Lpgo.path:
+    .asciz "build/bench/kernels/trans_1024.cc-pgo.prof"
@@ -0,0 +1,38926 @@
+    .file 1 "bench/kernels/trans_1024.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $4194304, %rsp
+    .loc 1 3 5
+    subq $4194304, %rsp
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_15:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_27:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_39
+    .p2align 4,,10
+.Lmain_38:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_39:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_50:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+.Lmain_6:
+    movslq -8388612(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $1024, -8388612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_61:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+    jmp .Lmain_72
+    .p2align 4,,10
+.Lmain_71:
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_79
+    .p2align 4,,10
+.Lmain_78:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_88
+    .p2align 4,,10
+.Lmain_87:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_97
+    .p2align 4,,10
+.Lmain_96:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_106
+    .p2align 4,,10
+.Lmain_105:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_109:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_110:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_111:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_108:
+    incl -8388636(%rbp)
+.Lmain_106:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_105
+.Lmain_107:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_103
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_104:
+    incl -8388636(%rbp)
+    jmp .Lmain_107
+.Lmain_103:
+    addq $8, %rsp
+.Lmain_100:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_118
+    .p2align 4,,10
+.Lmain_117:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_121:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_122:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_123:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_120:
+    incl -8388636(%rbp)
+.Lmain_118:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_117
+.Lmain_119:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_115
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_116:
+    incl -8388636(%rbp)
+    jmp .Lmain_119
+.Lmain_115:
+    addq $8, %rsp
+.Lmain_112:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_130
+    .p2align 4,,10
+.Lmain_129:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_133:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_134:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_135:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_132:
+    incl -8388636(%rbp)
+.Lmain_130:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_129
+.Lmain_131:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_127
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_128:
+    incl -8388636(%rbp)
+    jmp .Lmain_131
+.Lmain_127:
+    addq $8, %rsp
+.Lmain_124:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_141
+    .p2align 4,,10
+.Lmain_140:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_144:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_145:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_146:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_143:
+    incl -8388636(%rbp)
+.Lmain_141:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_140
+.Lmain_142:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_138
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_139:
+    incl -8388636(%rbp)
+    jmp .Lmain_142
+.Lmain_138:
+    addq $8, %rsp
+.Lmain_99:
+    incl -8388632(%rbp)
+.Lmain_97:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_96
+.Lmain_98:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_94
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_152
+    .p2align 4,,10
+.Lmain_151:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_155:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_156:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_157:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_154:
+    incl -8388636(%rbp)
+.Lmain_152:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_151
+.Lmain_153:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_149
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_150:
+    incl -8388636(%rbp)
+    jmp .Lmain_153
+.Lmain_149:
+    addq $8, %rsp
+.Lmain_95:
+    incl -8388632(%rbp)
+    jmp .Lmain_98
+.Lmain_94:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_91:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_164
+    .p2align 4,,10
+.Lmain_163:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_173
+    .p2align 4,,10
+.Lmain_172:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_176:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_177:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_178:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_175:
+    incl -8388636(%rbp)
+.Lmain_173:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_172
+.Lmain_174:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_170
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_171:
+    incl -8388636(%rbp)
+    jmp .Lmain_174
+.Lmain_170:
+    addq $8, %rsp
+.Lmain_167:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_185
+    .p2align 4,,10
+.Lmain_184:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_188:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_189:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_190:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_187:
+    incl -8388636(%rbp)
+.Lmain_185:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_184
+.Lmain_186:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_182
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_183:
+    incl -8388636(%rbp)
+    jmp .Lmain_186
+.Lmain_182:
+    addq $8, %rsp
+.Lmain_179:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_197
+    .p2align 4,,10
+.Lmain_196:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_200:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_201:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_202:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_199:
+    incl -8388636(%rbp)
+.Lmain_197:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_196
+.Lmain_198:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_194
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_195:
+    incl -8388636(%rbp)
+    jmp .Lmain_198
+.Lmain_194:
+    addq $8, %rsp
+.Lmain_191:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_208
+    .p2align 4,,10
+.Lmain_207:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_211:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_212:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_213:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_210:
+    incl -8388636(%rbp)
+.Lmain_208:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_207
+.Lmain_209:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_205
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_206:
+    incl -8388636(%rbp)
+    jmp .Lmain_209
+.Lmain_205:
+    addq $8, %rsp
+.Lmain_166:
+    incl -8388632(%rbp)
+.Lmain_164:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_163
+.Lmain_165:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_161
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_219
+    .p2align 4,,10
+.Lmain_218:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_222:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_223:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_224:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_221:
+    incl -8388636(%rbp)
+.Lmain_219:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_218
+.Lmain_220:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_216
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_217:
+    incl -8388636(%rbp)
+    jmp .Lmain_220
+.Lmain_216:
+    addq $8, %rsp
+.Lmain_162:
+    incl -8388632(%rbp)
+    jmp .Lmain_165
+.Lmain_161:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_158:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_230
+    .p2align 4,,10
+.Lmain_229:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_239
+    .p2align 4,,10
+.Lmain_238:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_242:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_243:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_244:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_241:
+    incl -8388636(%rbp)
+.Lmain_239:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_238
+.Lmain_240:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_236
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_237:
+    incl -8388636(%rbp)
+    jmp .Lmain_240
+.Lmain_236:
+    addq $8, %rsp
+.Lmain_233:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_251
+    .p2align 4,,10
+.Lmain_250:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_254:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_255:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_256:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_253:
+    incl -8388636(%rbp)
+.Lmain_251:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_250
+.Lmain_252:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_248
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_249:
+    incl -8388636(%rbp)
+    jmp .Lmain_252
+.Lmain_248:
+    addq $8, %rsp
+.Lmain_245:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_263
+    .p2align 4,,10
+.Lmain_262:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_266:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_267:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_268:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_265:
+    incl -8388636(%rbp)
+.Lmain_263:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_262
+.Lmain_264:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_260
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_261:
+    incl -8388636(%rbp)
+    jmp .Lmain_264
+.Lmain_260:
+    addq $8, %rsp
+.Lmain_257:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_274
+    .p2align 4,,10
+.Lmain_273:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_277:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_278:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_279:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_276:
+    incl -8388636(%rbp)
+.Lmain_274:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_273
+.Lmain_275:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_271
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_272:
+    incl -8388636(%rbp)
+    jmp .Lmain_275
+.Lmain_271:
+    addq $8, %rsp
+.Lmain_232:
+    incl -8388632(%rbp)
+.Lmain_230:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_229
+.Lmain_231:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_227
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_285
+    .p2align 4,,10
+.Lmain_284:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_288:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_289:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_290:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_287:
+    incl -8388636(%rbp)
+.Lmain_285:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_284
+.Lmain_286:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_282
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_283:
+    incl -8388636(%rbp)
+    jmp .Lmain_286
+.Lmain_282:
+    addq $8, %rsp
+.Lmain_228:
+    incl -8388632(%rbp)
+    jmp .Lmain_231
+.Lmain_227:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_90:
+    addl $8, -8388620(%rbp)
+.Lmain_88:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_87
+.Lmain_89:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_85
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_296
+    .p2align 4,,10
+.Lmain_295:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_305
+    .p2align 4,,10
+.Lmain_304:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_308:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_309:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_310:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_307:
+    incl -8388636(%rbp)
+.Lmain_305:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_304
+.Lmain_306:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_302
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_303:
+    incl -8388636(%rbp)
+    jmp .Lmain_306
+.Lmain_302:
+    addq $8, %rsp
+.Lmain_299:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_317
+    .p2align 4,,10
+.Lmain_316:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_320:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_321:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_322:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_319:
+    incl -8388636(%rbp)
+.Lmain_317:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_316
+.Lmain_318:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_314
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_315:
+    incl -8388636(%rbp)
+    jmp .Lmain_318
+.Lmain_314:
+    addq $8, %rsp
+.Lmain_311:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_329
+    .p2align 4,,10
+.Lmain_328:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_332:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_333:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_334:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_331:
+    incl -8388636(%rbp)
+.Lmain_329:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_328
+.Lmain_330:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_326
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_327:
+    incl -8388636(%rbp)
+    jmp .Lmain_330
+.Lmain_326:
+    addq $8, %rsp
+.Lmain_323:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_340
+    .p2align 4,,10
+.Lmain_339:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_343:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_344:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_345:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_342:
+    incl -8388636(%rbp)
+.Lmain_340:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_339
+.Lmain_341:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_337
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_338:
+    incl -8388636(%rbp)
+    jmp .Lmain_341
+.Lmain_337:
+    addq $8, %rsp
+.Lmain_298:
+    incl -8388632(%rbp)
+.Lmain_296:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_295
+.Lmain_297:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_293
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_351
+    .p2align 4,,10
+.Lmain_350:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_354:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_355:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_356:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_353:
+    incl -8388636(%rbp)
+.Lmain_351:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_350
+.Lmain_352:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_348
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_349:
+    incl -8388636(%rbp)
+    jmp .Lmain_352
+.Lmain_348:
+    addq $8, %rsp
+.Lmain_294:
+    incl -8388632(%rbp)
+    jmp .Lmain_297
+.Lmain_293:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_86:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_89
+.Lmain_85:
+    addq $8, %rsp
+.Lmain_82:
+    addl $8, -8388616(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_362
+    .p2align 4,,10
+.Lmain_361:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_371
+    .p2align 4,,10
+.Lmain_370:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_380
+    .p2align 4,,10
+.Lmain_379:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_383:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_384:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_385:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_382:
+    incl -8388636(%rbp)
+.Lmain_380:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_379
+.Lmain_381:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_377
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_378:
+    incl -8388636(%rbp)
+    jmp .Lmain_381
+.Lmain_377:
+    addq $8, %rsp
+.Lmain_374:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_392
+    .p2align 4,,10
+.Lmain_391:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_395:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_396:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_397:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_394:
+    incl -8388636(%rbp)
+.Lmain_392:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_391
+.Lmain_393:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_389
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_390:
+    incl -8388636(%rbp)
+    jmp .Lmain_393
+.Lmain_389:
+    addq $8, %rsp
+.Lmain_386:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_404
+    .p2align 4,,10
+.Lmain_403:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_407:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_408:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_409:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_406:
+    incl -8388636(%rbp)
+.Lmain_404:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_403
+.Lmain_405:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_401
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_402:
+    incl -8388636(%rbp)
+    jmp .Lmain_405
+.Lmain_401:
+    addq $8, %rsp
+.Lmain_398:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_415
+    .p2align 4,,10
+.Lmain_414:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_418:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_419:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_420:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_417:
+    incl -8388636(%rbp)
+.Lmain_415:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_414
+.Lmain_416:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_412
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_413:
+    incl -8388636(%rbp)
+    jmp .Lmain_416
+.Lmain_412:
+    addq $8, %rsp
+.Lmain_373:
+    incl -8388632(%rbp)
+.Lmain_371:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_370
+.Lmain_372:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_368
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_426
+    .p2align 4,,10
+.Lmain_425:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_429:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_430:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_431:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_428:
+    incl -8388636(%rbp)
+.Lmain_426:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_425
+.Lmain_427:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_423
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_424:
+    incl -8388636(%rbp)
+    jmp .Lmain_427
+.Lmain_423:
+    addq $8, %rsp
+.Lmain_369:
+    incl -8388632(%rbp)
+    jmp .Lmain_372
+.Lmain_368:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_365:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_438
+    .p2align 4,,10
+.Lmain_437:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_447
+    .p2align 4,,10
+.Lmain_446:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_450:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_451:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_452:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_449:
+    incl -8388636(%rbp)
+.Lmain_447:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_446
+.Lmain_448:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_444
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_445:
+    incl -8388636(%rbp)
+    jmp .Lmain_448
+.Lmain_444:
+    addq $8, %rsp
+.Lmain_441:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_459
+    .p2align 4,,10
+.Lmain_458:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_462:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_463:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_464:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_461:
+    incl -8388636(%rbp)
+.Lmain_459:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_458
+.Lmain_460:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_456
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_457:
+    incl -8388636(%rbp)
+    jmp .Lmain_460
+.Lmain_456:
+    addq $8, %rsp
+.Lmain_453:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_471
+    .p2align 4,,10
+.Lmain_470:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_474:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_475:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_476:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_473:
+    incl -8388636(%rbp)
+.Lmain_471:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_470
+.Lmain_472:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_468
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_469:
+    incl -8388636(%rbp)
+    jmp .Lmain_472
+.Lmain_468:
+    addq $8, %rsp
+.Lmain_465:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_482
+    .p2align 4,,10
+.Lmain_481:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_485:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_486:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_487:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_484:
+    incl -8388636(%rbp)
+.Lmain_482:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_481
+.Lmain_483:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_479
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_480:
+    incl -8388636(%rbp)
+    jmp .Lmain_483
+.Lmain_479:
+    addq $8, %rsp
+.Lmain_440:
+    incl -8388632(%rbp)
+.Lmain_438:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_437
+.Lmain_439:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_435
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_493
+    .p2align 4,,10
+.Lmain_492:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_496:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_497:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_498:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_495:
+    incl -8388636(%rbp)
+.Lmain_493:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_492
+.Lmain_494:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_490
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_491:
+    incl -8388636(%rbp)
+    jmp .Lmain_494
+.Lmain_490:
+    addq $8, %rsp
+.Lmain_436:
+    incl -8388632(%rbp)
+    jmp .Lmain_439
+.Lmain_435:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_432:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_504
+    .p2align 4,,10
+.Lmain_503:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_513
+    .p2align 4,,10
+.Lmain_512:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_516:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_517:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_518:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_515:
+    incl -8388636(%rbp)
+.Lmain_513:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_512
+.Lmain_514:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_510
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_511:
+    incl -8388636(%rbp)
+    jmp .Lmain_514
+.Lmain_510:
+    addq $8, %rsp
+.Lmain_507:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_525
+    .p2align 4,,10
+.Lmain_524:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_528:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_529:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_530:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_527:
+    incl -8388636(%rbp)
+.Lmain_525:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_524
+.Lmain_526:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_522
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_523:
+    incl -8388636(%rbp)
+    jmp .Lmain_526
+.Lmain_522:
+    addq $8, %rsp
+.Lmain_519:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_537
+    .p2align 4,,10
+.Lmain_536:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_540:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_541:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_542:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_539:
+    incl -8388636(%rbp)
+.Lmain_537:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_536
+.Lmain_538:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_534
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_535:
+    incl -8388636(%rbp)
+    jmp .Lmain_538
+.Lmain_534:
+    addq $8, %rsp
+.Lmain_531:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_548
+    .p2align 4,,10
+.Lmain_547:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_551:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_552:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_553:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_550:
+    incl -8388636(%rbp)
+.Lmain_548:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_547
+.Lmain_549:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_545
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_546:
+    incl -8388636(%rbp)
+    jmp .Lmain_549
+.Lmain_545:
+    addq $8, %rsp
+.Lmain_506:
+    incl -8388632(%rbp)
+.Lmain_504:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_503
+.Lmain_505:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_501
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_559
+    .p2align 4,,10
+.Lmain_558:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_562:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_563:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_564:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_561:
+    incl -8388636(%rbp)
+.Lmain_559:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_558
+.Lmain_560:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_556
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_557:
+    incl -8388636(%rbp)
+    jmp .Lmain_560
+.Lmain_556:
+    addq $8, %rsp
+.Lmain_502:
+    incl -8388632(%rbp)
+    jmp .Lmain_505
+.Lmain_501:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_364:
+    addl $8, -8388620(%rbp)
+.Lmain_362:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_361
+.Lmain_363:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_359
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_570
+    .p2align 4,,10
+.Lmain_569:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_579
+    .p2align 4,,10
+.Lmain_578:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_582:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_583:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_584:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_581:
+    incl -8388636(%rbp)
+.Lmain_579:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_578
+.Lmain_580:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_576
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_577:
+    incl -8388636(%rbp)
+    jmp .Lmain_580
+.Lmain_576:
+    addq $8, %rsp
+.Lmain_573:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_591
+    .p2align 4,,10
+.Lmain_590:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_594:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_595:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_596:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_593:
+    incl -8388636(%rbp)
+.Lmain_591:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_590
+.Lmain_592:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_588
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_589:
+    incl -8388636(%rbp)
+    jmp .Lmain_592
+.Lmain_588:
+    addq $8, %rsp
+.Lmain_585:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_603
+    .p2align 4,,10
+.Lmain_602:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_606:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_607:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_608:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_605:
+    incl -8388636(%rbp)
+.Lmain_603:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_602
+.Lmain_604:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_600
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_601:
+    incl -8388636(%rbp)
+    jmp .Lmain_604
+.Lmain_600:
+    addq $8, %rsp
+.Lmain_597:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_614
+    .p2align 4,,10
+.Lmain_613:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_617:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_618:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_619:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_616:
+    incl -8388636(%rbp)
+.Lmain_614:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_613
+.Lmain_615:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_611
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_612:
+    incl -8388636(%rbp)
+    jmp .Lmain_615
+.Lmain_611:
+    addq $8, %rsp
+.Lmain_572:
+    incl -8388632(%rbp)
+.Lmain_570:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_569
+.Lmain_571:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_567
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_625
+    .p2align 4,,10
+.Lmain_624:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_628:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_629:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_630:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_627:
+    incl -8388636(%rbp)
+.Lmain_625:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_624
+.Lmain_626:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_622
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_623:
+    incl -8388636(%rbp)
+    jmp .Lmain_626
+.Lmain_622:
+    addq $8, %rsp
+.Lmain_568:
+    incl -8388632(%rbp)
+    jmp .Lmain_571
+.Lmain_567:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_360:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_363
+.Lmain_359:
+    addq $8, %rsp
+.Lmain_81:
+    addl $8, -8388616(%rbp)
+.Lmain_79:
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    cmpq $1024, %rax
+    jl .Lmain_78
+.Lmain_80:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_76
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_636
+    .p2align 4,,10
+.Lmain_635:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_645
+    .p2align 4,,10
+.Lmain_644:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_654
+    .p2align 4,,10
+.Lmain_653:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_657:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_658:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_659:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_656:
+    incl -8388636(%rbp)
+.Lmain_654:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_653
+.Lmain_655:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_651
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_652:
+    incl -8388636(%rbp)
+    jmp .Lmain_655
+.Lmain_651:
+    addq $8, %rsp
+.Lmain_648:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_666
+    .p2align 4,,10
+.Lmain_665:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_669:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_670:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_671:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_668:
+    incl -8388636(%rbp)
+.Lmain_666:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_665
+.Lmain_667:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_663
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_664:
+    incl -8388636(%rbp)
+    jmp .Lmain_667
+.Lmain_663:
+    addq $8, %rsp
+.Lmain_660:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_678
+    .p2align 4,,10
+.Lmain_677:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_681:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_682:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_683:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_680:
+    incl -8388636(%rbp)
+.Lmain_678:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_677
+.Lmain_679:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_675
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_676:
+    incl -8388636(%rbp)
+    jmp .Lmain_679
+.Lmain_675:
+    addq $8, %rsp
+.Lmain_672:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_689
+    .p2align 4,,10
+.Lmain_688:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_692:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_693:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_694:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_691:
+    incl -8388636(%rbp)
+.Lmain_689:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_688
+.Lmain_690:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_686
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_687:
+    incl -8388636(%rbp)
+    jmp .Lmain_690
+.Lmain_686:
+    addq $8, %rsp
+.Lmain_647:
+    incl -8388632(%rbp)
+.Lmain_645:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_644
+.Lmain_646:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_642
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_700
+    .p2align 4,,10
+.Lmain_699:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_703:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_704:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_705:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_702:
+    incl -8388636(%rbp)
+.Lmain_700:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_699
+.Lmain_701:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_697
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_698:
+    incl -8388636(%rbp)
+    jmp .Lmain_701
+.Lmain_697:
+    addq $8, %rsp
+.Lmain_643:
+    incl -8388632(%rbp)
+    jmp .Lmain_646
+.Lmain_642:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_639:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_712
+    .p2align 4,,10
+.Lmain_711:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_721
+    .p2align 4,,10
+.Lmain_720:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_724:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_725:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_726:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_723:
+    incl -8388636(%rbp)
+.Lmain_721:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_720
+.Lmain_722:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_718
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_719:
+    incl -8388636(%rbp)
+    jmp .Lmain_722
+.Lmain_718:
+    addq $8, %rsp
+.Lmain_715:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_733
+    .p2align 4,,10
+.Lmain_732:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_736:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_737:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_738:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_735:
+    incl -8388636(%rbp)
+.Lmain_733:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_732
+.Lmain_734:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_730
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_731:
+    incl -8388636(%rbp)
+    jmp .Lmain_734
+.Lmain_730:
+    addq $8, %rsp
+.Lmain_727:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_745
+    .p2align 4,,10
+.Lmain_744:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_748:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_749:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_750:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_747:
+    incl -8388636(%rbp)
+.Lmain_745:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_744
+.Lmain_746:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_742
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_743:
+    incl -8388636(%rbp)
+    jmp .Lmain_746
+.Lmain_742:
+    addq $8, %rsp
+.Lmain_739:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_756
+    .p2align 4,,10
+.Lmain_755:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_759:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_760:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_761:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_758:
+    incl -8388636(%rbp)
+.Lmain_756:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_755
+.Lmain_757:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_753
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_754:
+    incl -8388636(%rbp)
+    jmp .Lmain_757
+.Lmain_753:
+    addq $8, %rsp
+.Lmain_714:
+    incl -8388632(%rbp)
+.Lmain_712:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_711
+.Lmain_713:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_709
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_767
+    .p2align 4,,10
+.Lmain_766:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_770:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_771:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_772:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_769:
+    incl -8388636(%rbp)
+.Lmain_767:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_766
+.Lmain_768:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_764
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_765:
+    incl -8388636(%rbp)
+    jmp .Lmain_768
+.Lmain_764:
+    addq $8, %rsp
+.Lmain_710:
+    incl -8388632(%rbp)
+    jmp .Lmain_713
+.Lmain_709:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_706:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_778
+    .p2align 4,,10
+.Lmain_777:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_787
+    .p2align 4,,10
+.Lmain_786:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_790:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_791:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_792:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_789:
+    incl -8388636(%rbp)
+.Lmain_787:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_786
+.Lmain_788:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_784
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_785:
+    incl -8388636(%rbp)
+    jmp .Lmain_788
+.Lmain_784:
+    addq $8, %rsp
+.Lmain_781:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_799
+    .p2align 4,,10
+.Lmain_798:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_802:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_803:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_804:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_801:
+    incl -8388636(%rbp)
+.Lmain_799:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_798
+.Lmain_800:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_796
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_797:
+    incl -8388636(%rbp)
+    jmp .Lmain_800
+.Lmain_796:
+    addq $8, %rsp
+.Lmain_793:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_811
+    .p2align 4,,10
+.Lmain_810:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_814:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_815:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_816:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_813:
+    incl -8388636(%rbp)
+.Lmain_811:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_810
+.Lmain_812:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_808
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_809:
+    incl -8388636(%rbp)
+    jmp .Lmain_812
+.Lmain_808:
+    addq $8, %rsp
+.Lmain_805:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_822
+    .p2align 4,,10
+.Lmain_821:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_825:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_826:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_827:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_824:
+    incl -8388636(%rbp)
+.Lmain_822:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_821
+.Lmain_823:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_819
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_820:
+    incl -8388636(%rbp)
+    jmp .Lmain_823
+.Lmain_819:
+    addq $8, %rsp
+.Lmain_780:
+    incl -8388632(%rbp)
+.Lmain_778:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_777
+.Lmain_779:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_775
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_833
+    .p2align 4,,10
+.Lmain_832:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_836:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_837:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_838:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_835:
+    incl -8388636(%rbp)
+.Lmain_833:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_832
+.Lmain_834:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_830
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_831:
+    incl -8388636(%rbp)
+    jmp .Lmain_834
+.Lmain_830:
+    addq $8, %rsp
+.Lmain_776:
+    incl -8388632(%rbp)
+    jmp .Lmain_779
+.Lmain_775:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_638:
+    addl $8, -8388620(%rbp)
+.Lmain_636:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_635
+.Lmain_637:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_633
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_844
+    .p2align 4,,10
+.Lmain_843:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_853
+    .p2align 4,,10
+.Lmain_852:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_856:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_857:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_858:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_855:
+    incl -8388636(%rbp)
+.Lmain_853:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_852
+.Lmain_854:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_850
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_851:
+    incl -8388636(%rbp)
+    jmp .Lmain_854
+.Lmain_850:
+    addq $8, %rsp
+.Lmain_847:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_865
+    .p2align 4,,10
+.Lmain_864:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_868:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_869:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_870:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_867:
+    incl -8388636(%rbp)
+.Lmain_865:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_864
+.Lmain_866:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_862
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_863:
+    incl -8388636(%rbp)
+    jmp .Lmain_866
+.Lmain_862:
+    addq $8, %rsp
+.Lmain_859:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_877
+    .p2align 4,,10
+.Lmain_876:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_880:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_881:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_882:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_879:
+    incl -8388636(%rbp)
+.Lmain_877:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_876
+.Lmain_878:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_874
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_875:
+    incl -8388636(%rbp)
+    jmp .Lmain_878
+.Lmain_874:
+    addq $8, %rsp
+.Lmain_871:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_888
+    .p2align 4,,10
+.Lmain_887:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_891:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_892:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_893:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_890:
+    incl -8388636(%rbp)
+.Lmain_888:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_887
+.Lmain_889:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_885
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_886:
+    incl -8388636(%rbp)
+    jmp .Lmain_889
+.Lmain_885:
+    addq $8, %rsp
+.Lmain_846:
+    incl -8388632(%rbp)
+.Lmain_844:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_843
+.Lmain_845:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_841
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_899
+    .p2align 4,,10
+.Lmain_898:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_902:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_903:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_904:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_901:
+    incl -8388636(%rbp)
+.Lmain_899:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_898
+.Lmain_900:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_896
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_897:
+    incl -8388636(%rbp)
+    jmp .Lmain_900
+.Lmain_896:
+    addq $8, %rsp
+.Lmain_842:
+    incl -8388632(%rbp)
+    jmp .Lmain_845
+.Lmain_841:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_634:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_637
+.Lmain_633:
+    addq $8, %rsp
+.Lmain_77:
+    addl $8, -8388616(%rbp)
+    jmp .Lmain_80
+.Lmain_76:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_910
+    .p2align 4,,10
+.Lmain_909:
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_919
+    .p2align 4,,10
+.Lmain_918:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_928
+    .p2align 4,,10
+.Lmain_927:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_937
+    .p2align 4,,10
+.Lmain_936:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_940:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_941:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_942:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_939:
+    incl -8388636(%rbp)
+.Lmain_937:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_936
+.Lmain_938:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_934
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_935:
+    incl -8388636(%rbp)
+    jmp .Lmain_938
+.Lmain_934:
+    addq $8, %rsp
+.Lmain_931:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_949
+    .p2align 4,,10
+.Lmain_948:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_952:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_953:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_954:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_951:
+    incl -8388636(%rbp)
+.Lmain_949:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_948
+.Lmain_950:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_946
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_947:
+    incl -8388636(%rbp)
+    jmp .Lmain_950
+.Lmain_946:
+    addq $8, %rsp
+.Lmain_943:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_961
+    .p2align 4,,10
+.Lmain_960:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_964:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_965:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_966:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_963:
+    incl -8388636(%rbp)
+.Lmain_961:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_960
+.Lmain_962:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_958
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_959:
+    incl -8388636(%rbp)
+    jmp .Lmain_962
+.Lmain_958:
+    addq $8, %rsp
+.Lmain_955:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_972
+    .p2align 4,,10
+.Lmain_971:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_975:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_976:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_977:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_974:
+    incl -8388636(%rbp)
+.Lmain_972:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_971
+.Lmain_973:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_969
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_970:
+    incl -8388636(%rbp)
+    jmp .Lmain_973
+.Lmain_969:
+    addq $8, %rsp
+.Lmain_930:
+    incl -8388632(%rbp)
+.Lmain_928:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_927
+.Lmain_929:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_925
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_983
+    .p2align 4,,10
+.Lmain_982:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_986:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_987:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_988:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_985:
+    incl -8388636(%rbp)
+.Lmain_983:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_982
+.Lmain_984:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_980
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_981:
+    incl -8388636(%rbp)
+    jmp .Lmain_984
+.Lmain_980:
+    addq $8, %rsp
+.Lmain_926:
+    incl -8388632(%rbp)
+    jmp .Lmain_929
+.Lmain_925:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_922:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_995
+    .p2align 4,,10
+.Lmain_994:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1004
+    .p2align 4,,10
+.Lmain_1003:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1007:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1008:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1009:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1006:
+    incl -8388636(%rbp)
+.Lmain_1004:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1003
+.Lmain_1005:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1001
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1002:
+    incl -8388636(%rbp)
+    jmp .Lmain_1005
+.Lmain_1001:
+    addq $8, %rsp
+.Lmain_998:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1016
+    .p2align 4,,10
+.Lmain_1015:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1019:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1020:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1021:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1018:
+    incl -8388636(%rbp)
+.Lmain_1016:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1015
+.Lmain_1017:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1013
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1014:
+    incl -8388636(%rbp)
+    jmp .Lmain_1017
+.Lmain_1013:
+    addq $8, %rsp
+.Lmain_1010:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1028
+    .p2align 4,,10
+.Lmain_1027:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1031:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1032:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1033:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1030:
+    incl -8388636(%rbp)
+.Lmain_1028:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1027
+.Lmain_1029:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1025
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1026:
+    incl -8388636(%rbp)
+    jmp .Lmain_1029
+.Lmain_1025:
+    addq $8, %rsp
+.Lmain_1022:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1039
+    .p2align 4,,10
+.Lmain_1038:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1042:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1043:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1044:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1041:
+    incl -8388636(%rbp)
+.Lmain_1039:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1038
+.Lmain_1040:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1036
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1037:
+    incl -8388636(%rbp)
+    jmp .Lmain_1040
+.Lmain_1036:
+    addq $8, %rsp
+.Lmain_997:
+    incl -8388632(%rbp)
+.Lmain_995:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_994
+.Lmain_996:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_992
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1050
+    .p2align 4,,10
+.Lmain_1049:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1053:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1054:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1055:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1052:
+    incl -8388636(%rbp)
+.Lmain_1050:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1049
+.Lmain_1051:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1047
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1048:
+    incl -8388636(%rbp)
+    jmp .Lmain_1051
+.Lmain_1047:
+    addq $8, %rsp
+.Lmain_993:
+    incl -8388632(%rbp)
+    jmp .Lmain_996
+.Lmain_992:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_989:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1061
+    .p2align 4,,10
+.Lmain_1060:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1070
+    .p2align 4,,10
+.Lmain_1069:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1073:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1074:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1075:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1072:
+    incl -8388636(%rbp)
+.Lmain_1070:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1069
+.Lmain_1071:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1067
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1068:
+    incl -8388636(%rbp)
+    jmp .Lmain_1071
+.Lmain_1067:
+    addq $8, %rsp
+.Lmain_1064:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1082
+    .p2align 4,,10
+.Lmain_1081:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1085:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1086:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1087:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1084:
+    incl -8388636(%rbp)
+.Lmain_1082:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1081
+.Lmain_1083:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1079
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1080:
+    incl -8388636(%rbp)
+    jmp .Lmain_1083
+.Lmain_1079:
+    addq $8, %rsp
+.Lmain_1076:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1094
+    .p2align 4,,10
+.Lmain_1093:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1097:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1098:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1099:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1096:
+    incl -8388636(%rbp)
+.Lmain_1094:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1093
+.Lmain_1095:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1091
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1092:
+    incl -8388636(%rbp)
+    jmp .Lmain_1095
+.Lmain_1091:
+    addq $8, %rsp
+.Lmain_1088:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1105
+    .p2align 4,,10
+.Lmain_1104:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1108:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1109:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1110:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1107:
+    incl -8388636(%rbp)
+.Lmain_1105:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1104
+.Lmain_1106:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1102
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1103:
+    incl -8388636(%rbp)
+    jmp .Lmain_1106
+.Lmain_1102:
+    addq $8, %rsp
+.Lmain_1063:
+    incl -8388632(%rbp)
+.Lmain_1061:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1060
+.Lmain_1062:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1058
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1116
+    .p2align 4,,10
+.Lmain_1115:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1119:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1120:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1121:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1118:
+    incl -8388636(%rbp)
+.Lmain_1116:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1115
+.Lmain_1117:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1113
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1114:
+    incl -8388636(%rbp)
+    jmp .Lmain_1117
+.Lmain_1113:
+    addq $8, %rsp
+.Lmain_1059:
+    incl -8388632(%rbp)
+    jmp .Lmain_1062
+.Lmain_1058:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_921:
+    addl $8, -8388620(%rbp)
+.Lmain_919:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_918
+.Lmain_920:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_916
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1127
+    .p2align 4,,10
+.Lmain_1126:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1136
+    .p2align 4,,10
+.Lmain_1135:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1139:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1140:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1141:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1138:
+    incl -8388636(%rbp)
+.Lmain_1136:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1135
+.Lmain_1137:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1133
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1134:
+    incl -8388636(%rbp)
+    jmp .Lmain_1137
+.Lmain_1133:
+    addq $8, %rsp
+.Lmain_1130:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1148
+    .p2align 4,,10
+.Lmain_1147:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1151:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1152:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1153:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1150:
+    incl -8388636(%rbp)
+.Lmain_1148:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1147
+.Lmain_1149:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1145
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1146:
+    incl -8388636(%rbp)
+    jmp .Lmain_1149
+.Lmain_1145:
+    addq $8, %rsp
+.Lmain_1142:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1160
+    .p2align 4,,10
+.Lmain_1159:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1163:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1164:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1165:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1162:
+    incl -8388636(%rbp)
+.Lmain_1160:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1159
+.Lmain_1161:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1157
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1158:
+    incl -8388636(%rbp)
+    jmp .Lmain_1161
+.Lmain_1157:
+    addq $8, %rsp
+.Lmain_1154:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1171
+    .p2align 4,,10
+.Lmain_1170:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1174:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1175:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1176:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1173:
+    incl -8388636(%rbp)
+.Lmain_1171:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1170
+.Lmain_1172:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1168
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1169:
+    incl -8388636(%rbp)
+    jmp .Lmain_1172
+.Lmain_1168:
+    addq $8, %rsp
+.Lmain_1129:
+    incl -8388632(%rbp)
+.Lmain_1127:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1126
+.Lmain_1128:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1124
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1182
+    .p2align 4,,10
+.Lmain_1181:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1185:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1186:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1187:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1184:
+    incl -8388636(%rbp)
+.Lmain_1182:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1181
+.Lmain_1183:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1179
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1180:
+    incl -8388636(%rbp)
+    jmp .Lmain_1183
+.Lmain_1179:
+    addq $8, %rsp
+.Lmain_1125:
+    incl -8388632(%rbp)
+    jmp .Lmain_1128
+.Lmain_1124:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_917:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_920
+.Lmain_916:
+    addq $8, %rsp
+.Lmain_913:
+    addl $8, -8388616(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1193
+    .p2align 4,,10
+.Lmain_1192:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1202
+    .p2align 4,,10
+.Lmain_1201:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1211
+    .p2align 4,,10
+.Lmain_1210:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1214:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1215:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1216:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1213:
+    incl -8388636(%rbp)
+.Lmain_1211:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1210
+.Lmain_1212:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1208
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1209:
+    incl -8388636(%rbp)
+    jmp .Lmain_1212
+.Lmain_1208:
+    addq $8, %rsp
+.Lmain_1205:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1223
+    .p2align 4,,10
+.Lmain_1222:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1226:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1227:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1228:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1225:
+    incl -8388636(%rbp)
+.Lmain_1223:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1222
+.Lmain_1224:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1220
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1221:
+    incl -8388636(%rbp)
+    jmp .Lmain_1224
+.Lmain_1220:
+    addq $8, %rsp
+.Lmain_1217:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1235
+    .p2align 4,,10
+.Lmain_1234:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1238:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1239:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1240:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1237:
+    incl -8388636(%rbp)
+.Lmain_1235:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1234
+.Lmain_1236:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1232
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1233:
+    incl -8388636(%rbp)
+    jmp .Lmain_1236
+.Lmain_1232:
+    addq $8, %rsp
+.Lmain_1229:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1246
+    .p2align 4,,10
+.Lmain_1245:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1249:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1250:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1251:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1248:
+    incl -8388636(%rbp)
+.Lmain_1246:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1245
+.Lmain_1247:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1243
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1244:
+    incl -8388636(%rbp)
+    jmp .Lmain_1247
+.Lmain_1243:
+    addq $8, %rsp
+.Lmain_1204:
+    incl -8388632(%rbp)
+.Lmain_1202:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1201
+.Lmain_1203:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1199
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1257
+    .p2align 4,,10
+.Lmain_1256:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1260:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1261:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1262:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1259:
+    incl -8388636(%rbp)
+.Lmain_1257:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1256
+.Lmain_1258:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1254
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1255:
+    incl -8388636(%rbp)
+    jmp .Lmain_1258
+.Lmain_1254:
+    addq $8, %rsp
+.Lmain_1200:
+    incl -8388632(%rbp)
+    jmp .Lmain_1203
+.Lmain_1199:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1196:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1269
+    .p2align 4,,10
+.Lmain_1268:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1278
+    .p2align 4,,10
+.Lmain_1277:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1281:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1282:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1283:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1280:
+    incl -8388636(%rbp)
+.Lmain_1278:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1277
+.Lmain_1279:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1275
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1276:
+    incl -8388636(%rbp)
+    jmp .Lmain_1279
+.Lmain_1275:
+    addq $8, %rsp
+.Lmain_1272:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1290
+    .p2align 4,,10
+.Lmain_1289:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1293:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1294:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1295:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1292:
+    incl -8388636(%rbp)
+.Lmain_1290:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1289
+.Lmain_1291:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1287
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1288:
+    incl -8388636(%rbp)
+    jmp .Lmain_1291
+.Lmain_1287:
+    addq $8, %rsp
+.Lmain_1284:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1302
+    .p2align 4,,10
+.Lmain_1301:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1305:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1306:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1307:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1304:
+    incl -8388636(%rbp)
+.Lmain_1302:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1301
+.Lmain_1303:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1299
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1300:
+    incl -8388636(%rbp)
+    jmp .Lmain_1303
+.Lmain_1299:
+    addq $8, %rsp
+.Lmain_1296:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1313
+    .p2align 4,,10
+.Lmain_1312:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1316:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1317:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1318:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1315:
+    incl -8388636(%rbp)
+.Lmain_1313:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1312
+.Lmain_1314:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1310
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1311:
+    incl -8388636(%rbp)
+    jmp .Lmain_1314
+.Lmain_1310:
+    addq $8, %rsp
+.Lmain_1271:
+    incl -8388632(%rbp)
+.Lmain_1269:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1268
+.Lmain_1270:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1266
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1324
+    .p2align 4,,10
+.Lmain_1323:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1327:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1328:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1329:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1326:
+    incl -8388636(%rbp)
+.Lmain_1324:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1323
+.Lmain_1325:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1321
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1322:
+    incl -8388636(%rbp)
+    jmp .Lmain_1325
+.Lmain_1321:
+    addq $8, %rsp
+.Lmain_1267:
+    incl -8388632(%rbp)
+    jmp .Lmain_1270
+.Lmain_1266:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1263:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1335
+    .p2align 4,,10
+.Lmain_1334:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1344
+    .p2align 4,,10
+.Lmain_1343:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1347:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1348:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1349:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1346:
+    incl -8388636(%rbp)
+.Lmain_1344:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1343
+.Lmain_1345:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1341
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1342:
+    incl -8388636(%rbp)
+    jmp .Lmain_1345
+.Lmain_1341:
+    addq $8, %rsp
+.Lmain_1338:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1356
+    .p2align 4,,10
+.Lmain_1355:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1359:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1360:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1361:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1358:
+    incl -8388636(%rbp)
+.Lmain_1356:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1355
+.Lmain_1357:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1353
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1354:
+    incl -8388636(%rbp)
+    jmp .Lmain_1357
+.Lmain_1353:
+    addq $8, %rsp
+.Lmain_1350:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1368
+    .p2align 4,,10
+.Lmain_1367:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1371:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1372:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1373:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1370:
+    incl -8388636(%rbp)
+.Lmain_1368:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1367
+.Lmain_1369:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1365
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1366:
+    incl -8388636(%rbp)
+    jmp .Lmain_1369
+.Lmain_1365:
+    addq $8, %rsp
+.Lmain_1362:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1379
+    .p2align 4,,10
+.Lmain_1378:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1382:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1383:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1384:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1381:
+    incl -8388636(%rbp)
+.Lmain_1379:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1378
+.Lmain_1380:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1376
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1377:
+    incl -8388636(%rbp)
+    jmp .Lmain_1380
+.Lmain_1376:
+    addq $8, %rsp
+.Lmain_1337:
+    incl -8388632(%rbp)
+.Lmain_1335:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1334
+.Lmain_1336:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1332
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1390
+    .p2align 4,,10
+.Lmain_1389:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1393:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1394:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1395:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1392:
+    incl -8388636(%rbp)
+.Lmain_1390:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1389
+.Lmain_1391:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1387
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1388:
+    incl -8388636(%rbp)
+    jmp .Lmain_1391
+.Lmain_1387:
+    addq $8, %rsp
+.Lmain_1333:
+    incl -8388632(%rbp)
+    jmp .Lmain_1336
+.Lmain_1332:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1195:
+    addl $8, -8388620(%rbp)
+.Lmain_1193:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1192
+.Lmain_1194:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1190
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1401
+    .p2align 4,,10
+.Lmain_1400:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1410
+    .p2align 4,,10
+.Lmain_1409:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1413:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1414:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1415:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1412:
+    incl -8388636(%rbp)
+.Lmain_1410:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1409
+.Lmain_1411:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1407
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1408:
+    incl -8388636(%rbp)
+    jmp .Lmain_1411
+.Lmain_1407:
+    addq $8, %rsp
+.Lmain_1404:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1422
+    .p2align 4,,10
+.Lmain_1421:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1425:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1426:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1427:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1424:
+    incl -8388636(%rbp)
+.Lmain_1422:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1421
+.Lmain_1423:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1419
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1420:
+    incl -8388636(%rbp)
+    jmp .Lmain_1423
+.Lmain_1419:
+    addq $8, %rsp
+.Lmain_1416:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1434
+    .p2align 4,,10
+.Lmain_1433:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1437:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1438:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1439:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1436:
+    incl -8388636(%rbp)
+.Lmain_1434:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1433
+.Lmain_1435:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1431
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1432:
+    incl -8388636(%rbp)
+    jmp .Lmain_1435
+.Lmain_1431:
+    addq $8, %rsp
+.Lmain_1428:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1445
+    .p2align 4,,10
+.Lmain_1444:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1448:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1449:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1450:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1447:
+    incl -8388636(%rbp)
+.Lmain_1445:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1444
+.Lmain_1446:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1442
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1443:
+    incl -8388636(%rbp)
+    jmp .Lmain_1446
+.Lmain_1442:
+    addq $8, %rsp
+.Lmain_1403:
+    incl -8388632(%rbp)
+.Lmain_1401:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1400
+.Lmain_1402:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1398
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1456
+    .p2align 4,,10
+.Lmain_1455:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1459:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1460:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1461:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1458:
+    incl -8388636(%rbp)
+.Lmain_1456:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1455
+.Lmain_1457:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1453
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1454:
+    incl -8388636(%rbp)
+    jmp .Lmain_1457
+.Lmain_1453:
+    addq $8, %rsp
+.Lmain_1399:
+    incl -8388632(%rbp)
+    jmp .Lmain_1402
+.Lmain_1398:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1191:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_1194
+.Lmain_1190:
+    addq $8, %rsp
+.Lmain_912:
+    addl $8, -8388616(%rbp)
+.Lmain_910:
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    cmpq $1024, %rax
+    jl .Lmain_909
+.Lmain_911:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_907
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1467
+    .p2align 4,,10
+.Lmain_1466:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1476
+    .p2align 4,,10
+.Lmain_1475:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1485
+    .p2align 4,,10
+.Lmain_1484:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1488:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1489:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1490:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1487:
+    incl -8388636(%rbp)
+.Lmain_1485:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1484
+.Lmain_1486:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1482
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1483:
+    incl -8388636(%rbp)
+    jmp .Lmain_1486
+.Lmain_1482:
+    addq $8, %rsp
+.Lmain_1479:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1497
+    .p2align 4,,10
+.Lmain_1496:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1500:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1501:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1502:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1499:
+    incl -8388636(%rbp)
+.Lmain_1497:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1496
+.Lmain_1498:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1494
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1495:
+    incl -8388636(%rbp)
+    jmp .Lmain_1498
+.Lmain_1494:
+    addq $8, %rsp
+.Lmain_1491:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1509
+    .p2align 4,,10
+.Lmain_1508:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1512:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1513:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1514:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1511:
+    incl -8388636(%rbp)
+.Lmain_1509:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1508
+.Lmain_1510:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1506
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1507:
+    incl -8388636(%rbp)
+    jmp .Lmain_1510
+.Lmain_1506:
+    addq $8, %rsp
+.Lmain_1503:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1520
+    .p2align 4,,10
+.Lmain_1519:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1523:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1524:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1525:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1522:
+    incl -8388636(%rbp)
+.Lmain_1520:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1519
+.Lmain_1521:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1517
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1518:
+    incl -8388636(%rbp)
+    jmp .Lmain_1521
+.Lmain_1517:
+    addq $8, %rsp
+.Lmain_1478:
+    incl -8388632(%rbp)
+.Lmain_1476:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1475
+.Lmain_1477:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1473
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1531
+    .p2align 4,,10
+.Lmain_1530:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1534:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1535:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1536:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1533:
+    incl -8388636(%rbp)
+.Lmain_1531:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1530
+.Lmain_1532:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1528
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1529:
+    incl -8388636(%rbp)
+    jmp .Lmain_1532
+.Lmain_1528:
+    addq $8, %rsp
+.Lmain_1474:
+    incl -8388632(%rbp)
+    jmp .Lmain_1477
+.Lmain_1473:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1470:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1543
+    .p2align 4,,10
+.Lmain_1542:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1552
+    .p2align 4,,10
+.Lmain_1551:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1555:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1556:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1557:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1554:
+    incl -8388636(%rbp)
+.Lmain_1552:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1551
+.Lmain_1553:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1549
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1550:
+    incl -8388636(%rbp)
+    jmp .Lmain_1553
+.Lmain_1549:
+    addq $8, %rsp
+.Lmain_1546:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1564
+    .p2align 4,,10
+.Lmain_1563:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1567:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1568:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1569:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1566:
+    incl -8388636(%rbp)
+.Lmain_1564:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1563
+.Lmain_1565:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1561
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1562:
+    incl -8388636(%rbp)
+    jmp .Lmain_1565
+.Lmain_1561:
+    addq $8, %rsp
+.Lmain_1558:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1576
+    .p2align 4,,10
+.Lmain_1575:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1579:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1580:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1581:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1578:
+    incl -8388636(%rbp)
+.Lmain_1576:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1575
+.Lmain_1577:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1573
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1574:
+    incl -8388636(%rbp)
+    jmp .Lmain_1577
+.Lmain_1573:
+    addq $8, %rsp
+.Lmain_1570:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1587
+    .p2align 4,,10
+.Lmain_1586:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1590:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1591:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1592:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1589:
+    incl -8388636(%rbp)
+.Lmain_1587:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1586
+.Lmain_1588:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1584
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1585:
+    incl -8388636(%rbp)
+    jmp .Lmain_1588
+.Lmain_1584:
+    addq $8, %rsp
+.Lmain_1545:
+    incl -8388632(%rbp)
+.Lmain_1543:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1542
+.Lmain_1544:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1540
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1598
+    .p2align 4,,10
+.Lmain_1597:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1601:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1602:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1603:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1600:
+    incl -8388636(%rbp)
+.Lmain_1598:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1597
+.Lmain_1599:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1595
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1596:
+    incl -8388636(%rbp)
+    jmp .Lmain_1599
+.Lmain_1595:
+    addq $8, %rsp
+.Lmain_1541:
+    incl -8388632(%rbp)
+    jmp .Lmain_1544
+.Lmain_1540:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1537:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1609
+    .p2align 4,,10
+.Lmain_1608:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1618
+    .p2align 4,,10
+.Lmain_1617:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1621:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1622:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1623:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1620:
+    incl -8388636(%rbp)
+.Lmain_1618:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1617
+.Lmain_1619:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1615
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1616:
+    incl -8388636(%rbp)
+    jmp .Lmain_1619
+.Lmain_1615:
+    addq $8, %rsp
+.Lmain_1612:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1630
+    .p2align 4,,10
+.Lmain_1629:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1633:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1634:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1635:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1632:
+    incl -8388636(%rbp)
+.Lmain_1630:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1629
+.Lmain_1631:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1627
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1628:
+    incl -8388636(%rbp)
+    jmp .Lmain_1631
+.Lmain_1627:
+    addq $8, %rsp
+.Lmain_1624:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1642
+    .p2align 4,,10
+.Lmain_1641:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1645:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1646:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1647:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1644:
+    incl -8388636(%rbp)
+.Lmain_1642:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1641
+.Lmain_1643:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1639
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1640:
+    incl -8388636(%rbp)
+    jmp .Lmain_1643
+.Lmain_1639:
+    addq $8, %rsp
+.Lmain_1636:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1653
+    .p2align 4,,10
+.Lmain_1652:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1656:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1657:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1658:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1655:
+    incl -8388636(%rbp)
+.Lmain_1653:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1652
+.Lmain_1654:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1650
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1651:
+    incl -8388636(%rbp)
+    jmp .Lmain_1654
+.Lmain_1650:
+    addq $8, %rsp
+.Lmain_1611:
+    incl -8388632(%rbp)
+.Lmain_1609:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1608
+.Lmain_1610:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1606
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1664
+    .p2align 4,,10
+.Lmain_1663:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1667:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1668:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1669:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1666:
+    incl -8388636(%rbp)
+.Lmain_1664:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1663
+.Lmain_1665:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1661
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1662:
+    incl -8388636(%rbp)
+    jmp .Lmain_1665
+.Lmain_1661:
+    addq $8, %rsp
+.Lmain_1607:
+    incl -8388632(%rbp)
+    jmp .Lmain_1610
+.Lmain_1606:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1469:
+    addl $8, -8388620(%rbp)
+.Lmain_1467:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1466
+.Lmain_1468:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1464
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1675
+    .p2align 4,,10
+.Lmain_1674:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1684
+    .p2align 4,,10
+.Lmain_1683:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1687:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1688:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1689:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1686:
+    incl -8388636(%rbp)
+.Lmain_1684:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1683
+.Lmain_1685:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1681
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1682:
+    incl -8388636(%rbp)
+    jmp .Lmain_1685
+.Lmain_1681:
+    addq $8, %rsp
+.Lmain_1678:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1696
+    .p2align 4,,10
+.Lmain_1695:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1699:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1700:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1701:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1698:
+    incl -8388636(%rbp)
+.Lmain_1696:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1695
+.Lmain_1697:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1693
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1694:
+    incl -8388636(%rbp)
+    jmp .Lmain_1697
+.Lmain_1693:
+    addq $8, %rsp
+.Lmain_1690:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1708
+    .p2align 4,,10
+.Lmain_1707:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1711:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1712:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1713:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1710:
+    incl -8388636(%rbp)
+.Lmain_1708:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1707
+.Lmain_1709:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1705
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1706:
+    incl -8388636(%rbp)
+    jmp .Lmain_1709
+.Lmain_1705:
+    addq $8, %rsp
+.Lmain_1702:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1719
+    .p2align 4,,10
+.Lmain_1718:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1722:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1723:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1724:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1721:
+    incl -8388636(%rbp)
+.Lmain_1719:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1718
+.Lmain_1720:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1716
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1717:
+    incl -8388636(%rbp)
+    jmp .Lmain_1720
+.Lmain_1716:
+    addq $8, %rsp
+.Lmain_1677:
+    incl -8388632(%rbp)
+.Lmain_1675:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1674
+.Lmain_1676:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1672
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1730
+    .p2align 4,,10
+.Lmain_1729:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1733:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1734:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1735:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1732:
+    incl -8388636(%rbp)
+.Lmain_1730:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1729
+.Lmain_1731:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1727
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1728:
+    incl -8388636(%rbp)
+    jmp .Lmain_1731
+.Lmain_1727:
+    addq $8, %rsp
+.Lmain_1673:
+    incl -8388632(%rbp)
+    jmp .Lmain_1676
+.Lmain_1672:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1465:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_1468
+.Lmain_1464:
+    addq $8, %rsp
+.Lmain_908:
+    addl $8, -8388616(%rbp)
+    jmp .Lmain_911
+.Lmain_907:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_73:
+    .loc 1 9 28
+    incl -8388612(%rbp)
+    cmpl $4, -8388612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_1741
+    .p2align 4,,10
+.Lmain_1740:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1750
+    .p2align 4,,10
+.Lmain_1749:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1759
+    .p2align 4,,10
+.Lmain_1758:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1768
+    .p2align 4,,10
+.Lmain_1767:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1771:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1772:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1773:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1770:
+    incl -8388636(%rbp)
+.Lmain_1768:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1767
+.Lmain_1769:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1765
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1766:
+    incl -8388636(%rbp)
+    jmp .Lmain_1769
+.Lmain_1765:
+    addq $8, %rsp
+.Lmain_1762:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1780
+    .p2align 4,,10
+.Lmain_1779:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1783:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1784:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1785:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1782:
+    incl -8388636(%rbp)
+.Lmain_1780:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1779
+.Lmain_1781:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1777
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1778:
+    incl -8388636(%rbp)
+    jmp .Lmain_1781
+.Lmain_1777:
+    addq $8, %rsp
+.Lmain_1774:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1792
+    .p2align 4,,10
+.Lmain_1791:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1795:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1796:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1797:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1794:
+    incl -8388636(%rbp)
+.Lmain_1792:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1791
+.Lmain_1793:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1789
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1790:
+    incl -8388636(%rbp)
+    jmp .Lmain_1793
+.Lmain_1789:
+    addq $8, %rsp
+.Lmain_1786:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1803
+    .p2align 4,,10
+.Lmain_1802:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1806:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1807:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1808:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1805:
+    incl -8388636(%rbp)
+.Lmain_1803:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1802
+.Lmain_1804:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1800
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1801:
+    incl -8388636(%rbp)
+    jmp .Lmain_1804
+.Lmain_1800:
+    addq $8, %rsp
+.Lmain_1761:
+    incl -8388632(%rbp)
+.Lmain_1759:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1758
+.Lmain_1760:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1756
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1814
+    .p2align 4,,10
+.Lmain_1813:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1817:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1818:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1819:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1816:
+    incl -8388636(%rbp)
+.Lmain_1814:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1813
+.Lmain_1815:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1811
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1812:
+    incl -8388636(%rbp)
+    jmp .Lmain_1815
+.Lmain_1811:
+    addq $8, %rsp
+.Lmain_1757:
+    incl -8388632(%rbp)
+    jmp .Lmain_1760
+.Lmain_1756:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1753:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1826
+    .p2align 4,,10
+.Lmain_1825:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1835
+    .p2align 4,,10
+.Lmain_1834:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1838:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1839:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1840:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1837:
+    incl -8388636(%rbp)
+.Lmain_1835:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1834
+.Lmain_1836:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1832
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1833:
+    incl -8388636(%rbp)
+    jmp .Lmain_1836
+.Lmain_1832:
+    addq $8, %rsp
+.Lmain_1829:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1847
+    .p2align 4,,10
+.Lmain_1846:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1850:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1851:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1852:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1849:
+    incl -8388636(%rbp)
+.Lmain_1847:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1846
+.Lmain_1848:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1844
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1845:
+    incl -8388636(%rbp)
+    jmp .Lmain_1848
+.Lmain_1844:
+    addq $8, %rsp
+.Lmain_1841:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1859
+    .p2align 4,,10
+.Lmain_1858:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1862:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1863:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1864:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1861:
+    incl -8388636(%rbp)
+.Lmain_1859:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1858
+.Lmain_1860:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1856
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1857:
+    incl -8388636(%rbp)
+    jmp .Lmain_1860
+.Lmain_1856:
+    addq $8, %rsp
+.Lmain_1853:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1870
+    .p2align 4,,10
+.Lmain_1869:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1873:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1874:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1875:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1872:
+    incl -8388636(%rbp)
+.Lmain_1870:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1869
+.Lmain_1871:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1867
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1868:
+    incl -8388636(%rbp)
+    jmp .Lmain_1871
+.Lmain_1867:
+    addq $8, %rsp
+.Lmain_1828:
+    incl -8388632(%rbp)
+.Lmain_1826:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1825
+.Lmain_1827:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1823
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1881
+    .p2align 4,,10
+.Lmain_1880:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1884:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1885:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1886:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1883:
+    incl -8388636(%rbp)
+.Lmain_1881:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1880
+.Lmain_1882:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1878
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1879:
+    incl -8388636(%rbp)
+    jmp .Lmain_1882
+.Lmain_1878:
+    addq $8, %rsp
+.Lmain_1824:
+    incl -8388632(%rbp)
+    jmp .Lmain_1827
+.Lmain_1823:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1820:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1892
+    .p2align 4,,10
+.Lmain_1891:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1901
+    .p2align 4,,10
+.Lmain_1900:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1904:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1905:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1906:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1903:
+    incl -8388636(%rbp)
+.Lmain_1901:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1900
+.Lmain_1902:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1898
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1899:
+    incl -8388636(%rbp)
+    jmp .Lmain_1902
+.Lmain_1898:
+    addq $8, %rsp
+.Lmain_1895:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1913
+    .p2align 4,,10
+.Lmain_1912:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1916:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1917:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1918:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1915:
+    incl -8388636(%rbp)
+.Lmain_1913:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1912
+.Lmain_1914:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1910
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1911:
+    incl -8388636(%rbp)
+    jmp .Lmain_1914
+.Lmain_1910:
+    addq $8, %rsp
+.Lmain_1907:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1925
+    .p2align 4,,10
+.Lmain_1924:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1928:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1929:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1930:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1927:
+    incl -8388636(%rbp)
+.Lmain_1925:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1924
+.Lmain_1926:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1922
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1923:
+    incl -8388636(%rbp)
+    jmp .Lmain_1926
+.Lmain_1922:
+    addq $8, %rsp
+.Lmain_1919:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1936
+    .p2align 4,,10
+.Lmain_1935:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1939:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1940:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1941:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1938:
+    incl -8388636(%rbp)
+.Lmain_1936:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1935
+.Lmain_1937:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1933
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1934:
+    incl -8388636(%rbp)
+    jmp .Lmain_1937
+.Lmain_1933:
+    addq $8, %rsp
+.Lmain_1894:
+    incl -8388632(%rbp)
+.Lmain_1892:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1891
+.Lmain_1893:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1889
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1947
+    .p2align 4,,10
+.Lmain_1946:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1950:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1951:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1952:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1949:
+    incl -8388636(%rbp)
+.Lmain_1947:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1946
+.Lmain_1948:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1944
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1945:
+    incl -8388636(%rbp)
+    jmp .Lmain_1948
+.Lmain_1944:
+    addq $8, %rsp
+.Lmain_1890:
+    incl -8388632(%rbp)
+    jmp .Lmain_1893
+.Lmain_1889:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1752:
+    addl $8, -8388620(%rbp)
+.Lmain_1750:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1749
+.Lmain_1751:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1747
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1958
+    .p2align 4,,10
+.Lmain_1957:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1967
+    .p2align 4,,10
+.Lmain_1966:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1970:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1971:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1972:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1969:
+    incl -8388636(%rbp)
+.Lmain_1967:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1966
+.Lmain_1968:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1964
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1965:
+    incl -8388636(%rbp)
+    jmp .Lmain_1968
+.Lmain_1964:
+    addq $8, %rsp
+.Lmain_1961:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1979
+    .p2align 4,,10
+.Lmain_1978:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1982:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1983:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1984:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1981:
+    incl -8388636(%rbp)
+.Lmain_1979:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1978
+.Lmain_1980:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1976
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1977:
+    incl -8388636(%rbp)
+    jmp .Lmain_1980
+.Lmain_1976:
+    addq $8, %rsp
+.Lmain_1973:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1991
+    .p2align 4,,10
+.Lmain_1990:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1994:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1995:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1996:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1993:
+    incl -8388636(%rbp)
+.Lmain_1991:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1990
+.Lmain_1992:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1988
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1989:
+    incl -8388636(%rbp)
+    jmp .Lmain_1992
+.Lmain_1988:
+    addq $8, %rsp
+.Lmain_1985:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2002
+    .p2align 4,,10
+.Lmain_2001:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2005:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2006:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2007:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2004:
+    incl -8388636(%rbp)
+.Lmain_2002:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2001
+.Lmain_2003:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1999
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2000:
+    incl -8388636(%rbp)
+    jmp .Lmain_2003
+.Lmain_1999:
+    addq $8, %rsp
+.Lmain_1960:
+    incl -8388632(%rbp)
+.Lmain_1958:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1957
+.Lmain_1959:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1955
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2013
+    .p2align 4,,10
+.Lmain_2012:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2016:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2017:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2018:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2015:
+    incl -8388636(%rbp)
+.Lmain_2013:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2012
+.Lmain_2014:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2010
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2011:
+    incl -8388636(%rbp)
+    jmp .Lmain_2014
+.Lmain_2010:
+    addq $8, %rsp
+.Lmain_1956:
+    incl -8388632(%rbp)
+    jmp .Lmain_1959
+.Lmain_1955:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1748:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_1751
+.Lmain_1747:
+    addq $8, %rsp
+.Lmain_1744:
+    addl $8, -8388616(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_2024
+    .p2align 4,,10
+.Lmain_2023:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2033
+    .p2align 4,,10
+.Lmain_2032:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2042
+    .p2align 4,,10
+.Lmain_2041:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2045:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2046:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2047:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2044:
+    incl -8388636(%rbp)
+.Lmain_2042:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2041
+.Lmain_2043:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2039
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2040:
+    incl -8388636(%rbp)
+    jmp .Lmain_2043
+.Lmain_2039:
+    addq $8, %rsp
+.Lmain_2036:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2054
+    .p2align 4,,10
+.Lmain_2053:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2057:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2058:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2059:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2056:
+    incl -8388636(%rbp)
+.Lmain_2054:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2053
+.Lmain_2055:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2051
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2052:
+    incl -8388636(%rbp)
+    jmp .Lmain_2055
+.Lmain_2051:
+    addq $8, %rsp
+.Lmain_2048:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2066
+    .p2align 4,,10
+.Lmain_2065:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2069:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2070:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2071:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2068:
+    incl -8388636(%rbp)
+.Lmain_2066:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2065
+.Lmain_2067:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2063
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2064:
+    incl -8388636(%rbp)
+    jmp .Lmain_2067
+.Lmain_2063:
+    addq $8, %rsp
+.Lmain_2060:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2077
+    .p2align 4,,10
+.Lmain_2076:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2080:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2081:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2082:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2079:
+    incl -8388636(%rbp)
+.Lmain_2077:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2076
+.Lmain_2078:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2074
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2075:
+    incl -8388636(%rbp)
+    jmp .Lmain_2078
+.Lmain_2074:
+    addq $8, %rsp
+.Lmain_2035:
+    incl -8388632(%rbp)
+.Lmain_2033:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2032
+.Lmain_2034:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2030
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2088
+    .p2align 4,,10
+.Lmain_2087:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2091:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2092:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2093:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2090:
+    incl -8388636(%rbp)
+.Lmain_2088:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2087
+.Lmain_2089:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2085
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2086:
+    incl -8388636(%rbp)
+    jmp .Lmain_2089
+.Lmain_2085:
+    addq $8, %rsp
+.Lmain_2031:
+    incl -8388632(%rbp)
+    jmp .Lmain_2034
+.Lmain_2030:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2027:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2100
+    .p2align 4,,10
+.Lmain_2099:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2109
+    .p2align 4,,10
+.Lmain_2108:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2112:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2113:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2114:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2111:
+    incl -8388636(%rbp)
+.Lmain_2109:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2108
+.Lmain_2110:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2106
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2107:
+    incl -8388636(%rbp)
+    jmp .Lmain_2110
+.Lmain_2106:
+    addq $8, %rsp
+.Lmain_2103:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2121
+    .p2align 4,,10
+.Lmain_2120:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2124:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2125:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2126:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2123:
+    incl -8388636(%rbp)
+.Lmain_2121:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2120
+.Lmain_2122:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2118
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2119:
+    incl -8388636(%rbp)
+    jmp .Lmain_2122
+.Lmain_2118:
+    addq $8, %rsp
+.Lmain_2115:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2133
+    .p2align 4,,10
+.Lmain_2132:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2136:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2137:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2138:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2135:
+    incl -8388636(%rbp)
+.Lmain_2133:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2132
+.Lmain_2134:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2130
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2131:
+    incl -8388636(%rbp)
+    jmp .Lmain_2134
+.Lmain_2130:
+    addq $8, %rsp
+.Lmain_2127:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2144
+    .p2align 4,,10
+.Lmain_2143:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2147:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2148:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2149:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2146:
+    incl -8388636(%rbp)
+.Lmain_2144:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2143
+.Lmain_2145:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2141
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2142:
+    incl -8388636(%rbp)
+    jmp .Lmain_2145
+.Lmain_2141:
+    addq $8, %rsp
+.Lmain_2102:
+    incl -8388632(%rbp)
+.Lmain_2100:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2099
+.Lmain_2101:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2097
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2155
+    .p2align 4,,10
+.Lmain_2154:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2158:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2159:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2160:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2157:
+    incl -8388636(%rbp)
+.Lmain_2155:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2154
+.Lmain_2156:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2152
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2153:
+    incl -8388636(%rbp)
+    jmp .Lmain_2156
+.Lmain_2152:
+    addq $8, %rsp
+.Lmain_2098:
+    incl -8388632(%rbp)
+    jmp .Lmain_2101
+.Lmain_2097:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2094:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2166
+    .p2align 4,,10
+.Lmain_2165:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2175
+    .p2align 4,,10
+.Lmain_2174:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2178:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2179:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2180:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2177:
+    incl -8388636(%rbp)
+.Lmain_2175:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2174
+.Lmain_2176:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2172
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2173:
+    incl -8388636(%rbp)
+    jmp .Lmain_2176
+.Lmain_2172:
+    addq $8, %rsp
+.Lmain_2169:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2187
+    .p2align 4,,10
+.Lmain_2186:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2190:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2191:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2192:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2189:
+    incl -8388636(%rbp)
+.Lmain_2187:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2186
+.Lmain_2188:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2184
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2185:
+    incl -8388636(%rbp)
+    jmp .Lmain_2188
+.Lmain_2184:
+    addq $8, %rsp
+.Lmain_2181:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2199
+    .p2align 4,,10
+.Lmain_2198:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2202:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2203:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2204:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2201:
+    incl -8388636(%rbp)
+.Lmain_2199:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2198
+.Lmain_2200:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2196
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2197:
+    incl -8388636(%rbp)
+    jmp .Lmain_2200
+.Lmain_2196:
+    addq $8, %rsp
+.Lmain_2193:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2210
+    .p2align 4,,10
+.Lmain_2209:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2213:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2214:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2215:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2212:
+    incl -8388636(%rbp)
+.Lmain_2210:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2209
+.Lmain_2211:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2207
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2208:
+    incl -8388636(%rbp)
+    jmp .Lmain_2211
+.Lmain_2207:
+    addq $8, %rsp
+.Lmain_2168:
+    incl -8388632(%rbp)
+.Lmain_2166:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2165
+.Lmain_2167:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2163
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2221
+    .p2align 4,,10
+.Lmain_2220:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2224:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2225:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2226:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2223:
+    incl -8388636(%rbp)
+.Lmain_2221:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2220
+.Lmain_2222:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2218
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2219:
+    incl -8388636(%rbp)
+    jmp .Lmain_2222
+.Lmain_2218:
+    addq $8, %rsp
+.Lmain_2164:
+    incl -8388632(%rbp)
+    jmp .Lmain_2167
+.Lmain_2163:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2026:
+    addl $8, -8388620(%rbp)
+.Lmain_2024:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_2023
+.Lmain_2025:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2021
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2232
+    .p2align 4,,10
+.Lmain_2231:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2241
+    .p2align 4,,10
+.Lmain_2240:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2244:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2245:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2246:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2243:
+    incl -8388636(%rbp)
+.Lmain_2241:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2240
+.Lmain_2242:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2238
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2239:
+    incl -8388636(%rbp)
+    jmp .Lmain_2242
+.Lmain_2238:
+    addq $8, %rsp
+.Lmain_2235:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2253
+    .p2align 4,,10
+.Lmain_2252:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2256:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2257:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2258:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2255:
+    incl -8388636(%rbp)
+.Lmain_2253:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2252
+.Lmain_2254:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2250
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2251:
+    incl -8388636(%rbp)
+    jmp .Lmain_2254
+.Lmain_2250:
+    addq $8, %rsp
+.Lmain_2247:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2265
+    .p2align 4,,10
+.Lmain_2264:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2268:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2269:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2270:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2267:
+    incl -8388636(%rbp)
+.Lmain_2265:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2264
+.Lmain_2266:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2262
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2263:
+    incl -8388636(%rbp)
+    jmp .Lmain_2266
+.Lmain_2262:
+    addq $8, %rsp
+.Lmain_2259:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2276
+    .p2align 4,,10
+.Lmain_2275:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2279:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2280:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2281:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2278:
+    incl -8388636(%rbp)
+.Lmain_2276:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2275
+.Lmain_2277:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2273
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2274:
+    incl -8388636(%rbp)
+    jmp .Lmain_2277
+.Lmain_2273:
+    addq $8, %rsp
+.Lmain_2234:
+    incl -8388632(%rbp)
+.Lmain_2232:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2231
+.Lmain_2233:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2229
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2287
+    .p2align 4,,10
+.Lmain_2286:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2290:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2291:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2292:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2289:
+    incl -8388636(%rbp)
+.Lmain_2287:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2286
+.Lmain_2288:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2284
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2285:
+    incl -8388636(%rbp)
+    jmp .Lmain_2288
+.Lmain_2284:
+    addq $8, %rsp
+.Lmain_2230:
+    incl -8388632(%rbp)
+    jmp .Lmain_2233
+.Lmain_2229:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2022:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_2025
+.Lmain_2021:
+    addq $8, %rsp
+.Lmain_1743:
+    addl $8, -8388616(%rbp)
+.Lmain_1741:
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1740
+.Lmain_1742:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1738
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_2298
+    .p2align 4,,10
+.Lmain_2297:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2307
+    .p2align 4,,10
+.Lmain_2306:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2316
+    .p2align 4,,10
+.Lmain_2315:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2319:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2320:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2321:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2318:
+    incl -8388636(%rbp)
+.Lmain_2316:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2315
+.Lmain_2317:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2313
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2314:
+    incl -8388636(%rbp)
+    jmp .Lmain_2317
+.Lmain_2313:
+    addq $8, %rsp
+.Lmain_2310:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2328
+    .p2align 4,,10
+.Lmain_2327:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2331:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2332:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2333:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2330:
+    incl -8388636(%rbp)
+.Lmain_2328:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2327
+.Lmain_2329:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2325
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2326:
+    incl -8388636(%rbp)
+    jmp .Lmain_2329
+.Lmain_2325:
+    addq $8, %rsp
+.Lmain_2322:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2340
+    .p2align 4,,10
+.Lmain_2339:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2343:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2344:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2345:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2342:
+    incl -8388636(%rbp)
+.Lmain_2340:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2339
+.Lmain_2341:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2337
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2338:
+    incl -8388636(%rbp)
+    jmp .Lmain_2341
+.Lmain_2337:
+    addq $8, %rsp
+.Lmain_2334:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2351
+    .p2align 4,,10
+.Lmain_2350:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2354:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2355:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2356:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2353:
+    incl -8388636(%rbp)
+.Lmain_2351:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2350
+.Lmain_2352:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2348
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2349:
+    incl -8388636(%rbp)
+    jmp .Lmain_2352
+.Lmain_2348:
+    addq $8, %rsp
+.Lmain_2309:
+    incl -8388632(%rbp)
+.Lmain_2307:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2306
+.Lmain_2308:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2304
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2362
+    .p2align 4,,10
+.Lmain_2361:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2365:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2366:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2367:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2364:
+    incl -8388636(%rbp)
+.Lmain_2362:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2361
+.Lmain_2363:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2359
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2360:
+    incl -8388636(%rbp)
+    jmp .Lmain_2363
+.Lmain_2359:
+    addq $8, %rsp
+.Lmain_2305:
+    incl -8388632(%rbp)
+    jmp .Lmain_2308
+.Lmain_2304:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2301:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2374
+    .p2align 4,,10
+.Lmain_2373:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2383
+    .p2align 4,,10
+.Lmain_2382:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2386:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2387:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2388:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2385:
+    incl -8388636(%rbp)
+.Lmain_2383:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2382
+.Lmain_2384:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2380
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2381:
+    incl -8388636(%rbp)
+    jmp .Lmain_2384
+.Lmain_2380:
+    addq $8, %rsp
+.Lmain_2377:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2395
+    .p2align 4,,10
+.Lmain_2394:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2398:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2399:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2400:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2397:
+    incl -8388636(%rbp)
+.Lmain_2395:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2394
+.Lmain_2396:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2392
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2393:
+    incl -8388636(%rbp)
+    jmp .Lmain_2396
+.Lmain_2392:
+    addq $8, %rsp
+.Lmain_2389:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2407
+    .p2align 4,,10
+.Lmain_2406:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2410:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2411:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2412:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2409:
+    incl -8388636(%rbp)
+.Lmain_2407:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2406
+.Lmain_2408:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2404
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2405:
+    incl -8388636(%rbp)
+    jmp .Lmain_2408
+.Lmain_2404:
+    addq $8, %rsp
+.Lmain_2401:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2418
+    .p2align 4,,10
+.Lmain_2417:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2421:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2422:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2423:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2420:
+    incl -8388636(%rbp)
+.Lmain_2418:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2417
+.Lmain_2419:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2415
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2416:
+    incl -8388636(%rbp)
+    jmp .Lmain_2419
+.Lmain_2415:
+    addq $8, %rsp
+.Lmain_2376:
+    incl -8388632(%rbp)
+.Lmain_2374:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2373
+.Lmain_2375:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2371
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2429
+    .p2align 4,,10
+.Lmain_2428:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2432:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2433:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2434:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2431:
+    incl -8388636(%rbp)
+.Lmain_2429:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2428
+.Lmain_2430:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2426
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2427:
+    incl -8388636(%rbp)
+    jmp .Lmain_2430
+.Lmain_2426:
+    addq $8, %rsp
+.Lmain_2372:
+    incl -8388632(%rbp)
+    jmp .Lmain_2375
+.Lmain_2371:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2368:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2440
+    .p2align 4,,10
+.Lmain_2439:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2449
+    .p2align 4,,10
+.Lmain_2448:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2452:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2453:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2454:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2451:
+    incl -8388636(%rbp)
+.Lmain_2449:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2448
+.Lmain_2450:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2446
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2447:
+    incl -8388636(%rbp)
+    jmp .Lmain_2450
+.Lmain_2446:
+    addq $8, %rsp
+.Lmain_2443:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2461
+    .p2align 4,,10
+.Lmain_2460:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2464:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2465:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2466:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2463:
+    incl -8388636(%rbp)
+.Lmain_2461:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2460
+.Lmain_2462:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2458
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2459:
+    incl -8388636(%rbp)
+    jmp .Lmain_2462
+.Lmain_2458:
+    addq $8, %rsp
+.Lmain_2455:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2473
+    .p2align 4,,10
+.Lmain_2472:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2476:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2477:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2478:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2475:
+    incl -8388636(%rbp)
+.Lmain_2473:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2472
+.Lmain_2474:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2470
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2471:
+    incl -8388636(%rbp)
+    jmp .Lmain_2474
+.Lmain_2470:
+    addq $8, %rsp
+.Lmain_2467:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2484
+    .p2align 4,,10
+.Lmain_2483:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2487:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2488:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2489:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2486:
+    incl -8388636(%rbp)
+.Lmain_2484:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2483
+.Lmain_2485:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2481
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2482:
+    incl -8388636(%rbp)
+    jmp .Lmain_2485
+.Lmain_2481:
+    addq $8, %rsp
+.Lmain_2442:
+    incl -8388632(%rbp)
+.Lmain_2440:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2439
+.Lmain_2441:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2437
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2495
+    .p2align 4,,10
+.Lmain_2494:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2498:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2499:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2500:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2497:
+    incl -8388636(%rbp)
+.Lmain_2495:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2494
+.Lmain_2496:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2492
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2493:
+    incl -8388636(%rbp)
+    jmp .Lmain_2496
+.Lmain_2492:
+    addq $8, %rsp
+.Lmain_2438:
+    incl -8388632(%rbp)
+    jmp .Lmain_2441
+.Lmain_2437:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2300:
+    addl $8, -8388620(%rbp)
+.Lmain_2298:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_2297
+.Lmain_2299:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2295
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2506
+    .p2align 4,,10
+.Lmain_2505:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2515
+    .p2align 4,,10
+.Lmain_2514:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2518:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2519:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2520:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2517:
+    incl -8388636(%rbp)
+.Lmain_2515:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2514
+.Lmain_2516:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2512
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2513:
+    incl -8388636(%rbp)
+    jmp .Lmain_2516
+.Lmain_2512:
+    addq $8, %rsp
+.Lmain_2509:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2527
+    .p2align 4,,10
+.Lmain_2526:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2530:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2531:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2532:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2529:
+    incl -8388636(%rbp)
+.Lmain_2527:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2526
+.Lmain_2528:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2524
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2525:
+    incl -8388636(%rbp)
+    jmp .Lmain_2528
+.Lmain_2524:
+    addq $8, %rsp
+.Lmain_2521:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2539
+    .p2align 4,,10
+.Lmain_2538:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2542:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2543:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2544:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2541:
+    incl -8388636(%rbp)
+.Lmain_2539:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2538
+.Lmain_2540:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2536
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2537:
+    incl -8388636(%rbp)
+    jmp .Lmain_2540
+.Lmain_2536:
+    addq $8, %rsp
+.Lmain_2533:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2550
+    .p2align 4,,10
+.Lmain_2549:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2553:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2554:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2555:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2552:
+    incl -8388636(%rbp)
+.Lmain_2550:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2549
+.Lmain_2551:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2547
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2548:
+    incl -8388636(%rbp)
+    jmp .Lmain_2551
+.Lmain_2547:
+    addq $8, %rsp
+.Lmain_2508:
+    incl -8388632(%rbp)
+.Lmain_2506:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2505
+.Lmain_2507:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2503
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2561
+    .p2align 4,,10
+.Lmain_2560:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2564:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2565:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2566:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2563:
+    incl -8388636(%rbp)
+.Lmain_2561:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2560
+.Lmain_2562:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2558
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2559:
+    incl -8388636(%rbp)
+    jmp .Lmain_2562
+.Lmain_2558:
+    addq $8, %rsp
+.Lmain_2504:
+    incl -8388632(%rbp)
+    jmp .Lmain_2507
+.Lmain_2503:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2296:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_2299
+.Lmain_2295:
+    addq $8, %rsp
+.Lmain_1739:
+    addl $8, -8388616(%rbp)
+    jmp .Lmain_1742
+.Lmain_1738:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_2572
+    .p2align 4,,10
+.Lmain_2571:
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_2581
+    .p2align 4,,10
+.Lmain_2580:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2590
+    .p2align 4,,10
+.Lmain_2589:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2599
+    .p2align 4,,10
+.Lmain_2598:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2602:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2603:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2604:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2601:
+    incl -8388636(%rbp)
+.Lmain_2599:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2598
+.Lmain_2600:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2596
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2597:
+    incl -8388636(%rbp)
+    jmp .Lmain_2600
+.Lmain_2596:
+    addq $8, %rsp
+.Lmain_2593:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2611
+    .p2align 4,,10
+.Lmain_2610:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2614:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2615:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2616:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2613:
+    incl -8388636(%rbp)
+.Lmain_2611:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2610
+.Lmain_2612:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2608
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2609:
+    incl -8388636(%rbp)
+    jmp .Lmain_2612
+.Lmain_2608:
+    addq $8, %rsp
+.Lmain_2605:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2623
+    .p2align 4,,10
+.Lmain_2622:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2626:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2627:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2628:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2625:
+    incl -8388636(%rbp)
+.Lmain_2623:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2622
+.Lmain_2624:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2620
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2621:
+    incl -8388636(%rbp)
+    jmp .Lmain_2624
+.Lmain_2620:
+    addq $8, %rsp
+.Lmain_2617:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2634
+    .p2align 4,,10
+.Lmain_2633:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2637:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2638:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2639:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2636:
+    incl -8388636(%rbp)
+.Lmain_2634:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2633
+.Lmain_2635:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2631
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2632:
+    incl -8388636(%rbp)
+    jmp .Lmain_2635
+.Lmain_2631:
+    addq $8, %rsp
+.Lmain_2592:
+    incl -8388632(%rbp)
+.Lmain_2590:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2589
+.Lmain_2591:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2587
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2645
+    .p2align 4,,10
+.Lmain_2644:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2648:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2649:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2650:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2647:
+    incl -8388636(%rbp)
+.Lmain_2645:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2644
+.Lmain_2646:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2642
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2643:
+    incl -8388636(%rbp)
+    jmp .Lmain_2646
+.Lmain_2642:
+    addq $8, %rsp
+.Lmain_2588:
+    incl -8388632(%rbp)
+    jmp .Lmain_2591
+.Lmain_2587:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2584:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2657
+    .p2align 4,,10
+.Lmain_2656:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2666
+    .p2align 4,,10
+.Lmain_2665:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2669:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2670:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2671:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2668:
+    incl -8388636(%rbp)
+.Lmain_2666:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2665
+.Lmain_2667:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2663
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2664:
+    incl -8388636(%rbp)
+    jmp .Lmain_2667
+.Lmain_2663:
+    addq $8, %rsp
+.Lmain_2660:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2678
+    .p2align 4,,10
+.Lmain_2677:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2681:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2682:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2683:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2680:
+    incl -8388636(%rbp)
+.Lmain_2678:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2677
+.Lmain_2679:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2675
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2676:
+    incl -8388636(%rbp)
+    jmp .Lmain_2679
+.Lmain_2675:
+    addq $8, %rsp
+.Lmain_2672:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2690
+    .p2align 4,,10
+.Lmain_2689:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2693:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2694:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2695:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2692:
+    incl -8388636(%rbp)
+.Lmain_2690:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2689
+.Lmain_2691:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2687
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2688:
+    incl -8388636(%rbp)
+    jmp .Lmain_2691
+.Lmain_2687:
+    addq $8, %rsp
+.Lmain_2684:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2701
+    .p2align 4,,10
+.Lmain_2700:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2704:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2705:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2706:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2703:
+    incl -8388636(%rbp)
+.Lmain_2701:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2700
+.Lmain_2702:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2698
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2699:
+    incl -8388636(%rbp)
+    jmp .Lmain_2702
+.Lmain_2698:
+    addq $8, %rsp
+.Lmain_2659:
+    incl -8388632(%rbp)
+.Lmain_2657:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2656
+.Lmain_2658:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2654
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2712
+    .p2align 4,,10
+.Lmain_2711:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2715:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2716:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2717:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2714:
+    incl -8388636(%rbp)
+.Lmain_2712:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2711
+.Lmain_2713:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2709
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2710:
+    incl -8388636(%rbp)
+    jmp .Lmain_2713
+.Lmain_2709:
+    addq $8, %rsp
+.Lmain_2655:
+    incl -8388632(%rbp)
+    jmp .Lmain_2658
+.Lmain_2654:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2651:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2723
+    .p2align 4,,10
+.Lmain_2722:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2732
+    .p2align 4,,10
+.Lmain_2731:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2735:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2736:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2737:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2734:
+    incl -8388636(%rbp)
+.Lmain_2732:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2731
+.Lmain_2733:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2729
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2730:
+    incl -8388636(%rbp)
+    jmp .Lmain_2733
+.Lmain_2729:
+    addq $8, %rsp
+.Lmain_2726:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2744
+    .p2align 4,,10
+.Lmain_2743:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2747:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2748:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2749:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2746:
+    incl -8388636(%rbp)
+.Lmain_2744:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2743
+.Lmain_2745:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2741
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2742:
+    incl -8388636(%rbp)
+    jmp .Lmain_2745
+.Lmain_2741:
+    addq $8, %rsp
+.Lmain_2738:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2756
+    .p2align 4,,10
+.Lmain_2755:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2759:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2760:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2761:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2758:
+    incl -8388636(%rbp)
+.Lmain_2756:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2755
+.Lmain_2757:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2753
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2754:
+    incl -8388636(%rbp)
+    jmp .Lmain_2757
+.Lmain_2753:
+    addq $8, %rsp
+.Lmain_2750:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2767
+    .p2align 4,,10
+.Lmain_2766:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2770:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2771:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2772:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2769:
+    incl -8388636(%rbp)
+.Lmain_2767:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2766
+.Lmain_2768:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2764
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2765:
+    incl -8388636(%rbp)
+    jmp .Lmain_2768
+.Lmain_2764:
+    addq $8, %rsp
+.Lmain_2725:
+    incl -8388632(%rbp)
+.Lmain_2723:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2722
+.Lmain_2724:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2720
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2778
+    .p2align 4,,10
+.Lmain_2777:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2781:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2782:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2783:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2780:
+    incl -8388636(%rbp)
+.Lmain_2778:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2777
+.Lmain_2779:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2775
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2776:
+    incl -8388636(%rbp)
+    jmp .Lmain_2779
+.Lmain_2775:
+    addq $8, %rsp
+.Lmain_2721:
+    incl -8388632(%rbp)
+    jmp .Lmain_2724
+.Lmain_2720:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2583:
+    addl $8, -8388620(%rbp)
+.Lmain_2581:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_2580
+.Lmain_2582:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2578
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2789
+    .p2align 4,,10
+.Lmain_2788:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2798
+    .p2align 4,,10
+.Lmain_2797:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2801:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2802:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2803:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2800:
+    incl -8388636(%rbp)
+.Lmain_2798:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2797
+.Lmain_2799:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2795
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2796:
+    incl -8388636(%rbp)
+    jmp .Lmain_2799
+.Lmain_2795:
+    addq $8, %rsp
+.Lmain_2792:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2810
+    .p2align 4,,10
+.Lmain_2809:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2813:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2814:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2815:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2812:
+    incl -8388636(%rbp)
+.Lmain_2810:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2809
+.Lmain_2811:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2807
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2808:
+    incl -8388636(%rbp)
+    jmp .Lmain_2811
+.Lmain_2807:
+    addq $8, %rsp
+.Lmain_2804:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2822
+    .p2align 4,,10
+.Lmain_2821:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2825:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2826:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2827:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2824:
+    incl -8388636(%rbp)
+.Lmain_2822:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2821
+.Lmain_2823:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2819
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2820:
+    incl -8388636(%rbp)
+    jmp .Lmain_2823
+.Lmain_2819:
+    addq $8, %rsp
+.Lmain_2816:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2833
+    .p2align 4,,10
+.Lmain_2832:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2836:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2837:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2838:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2835:
+    incl -8388636(%rbp)
+.Lmain_2833:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2832
+.Lmain_2834:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2830
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2831:
+    incl -8388636(%rbp)
+    jmp .Lmain_2834
+.Lmain_2830:
+    addq $8, %rsp
+.Lmain_2791:
+    incl -8388632(%rbp)
+.Lmain_2789:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2788
+.Lmain_2790:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2786
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2844
+    .p2align 4,,10
+.Lmain_2843:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2847:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2848:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2849:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2846:
+    incl -8388636(%rbp)
+.Lmain_2844:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2843
+.Lmain_2845:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2841
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2842:
+    incl -8388636(%rbp)
+    jmp .Lmain_2845
+.Lmain_2841:
+    addq $8, %rsp
+.Lmain_2787:
+    incl -8388632(%rbp)
+    jmp .Lmain_2790
+.Lmain_2786:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2579:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_2582
+.Lmain_2578:
+    addq $8, %rsp
+.Lmain_2575:
+    addl $8, -8388616(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_2855
+    .p2align 4,,10
+.Lmain_2854:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2864
+    .p2align 4,,10
+.Lmain_2863:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2873
+    .p2align 4,,10
+.Lmain_2872:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2876:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2877:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2878:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2875:
+    incl -8388636(%rbp)
+.Lmain_2873:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2872
+.Lmain_2874:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2870
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2871:
+    incl -8388636(%rbp)
+    jmp .Lmain_2874
+.Lmain_2870:
+    addq $8, %rsp
+.Lmain_2867:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2885
+    .p2align 4,,10
+.Lmain_2884:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2888:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2889:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2890:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2887:
+    incl -8388636(%rbp)
+.Lmain_2885:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2884
+.Lmain_2886:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2882
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2883:
+    incl -8388636(%rbp)
+    jmp .Lmain_2886
+.Lmain_2882:
+    addq $8, %rsp
+.Lmain_2879:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2897
+    .p2align 4,,10
+.Lmain_2896:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2900:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2901:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2902:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2899:
+    incl -8388636(%rbp)
+.Lmain_2897:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2896
+.Lmain_2898:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2894
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2895:
+    incl -8388636(%rbp)
+    jmp .Lmain_2898
+.Lmain_2894:
+    addq $8, %rsp
+.Lmain_2891:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2908
+    .p2align 4,,10
+.Lmain_2907:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2911:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2912:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2913:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2910:
+    incl -8388636(%rbp)
+.Lmain_2908:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2907
+.Lmain_2909:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2905
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2906:
+    incl -8388636(%rbp)
+    jmp .Lmain_2909
+.Lmain_2905:
+    addq $8, %rsp
+.Lmain_2866:
+    incl -8388632(%rbp)
+.Lmain_2864:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2863
+.Lmain_2865:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2861
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2919
+    .p2align 4,,10
+.Lmain_2918:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2922:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2923:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2924:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2921:
+    incl -8388636(%rbp)
+.Lmain_2919:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2918
+.Lmain_2920:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2916
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2917:
+    incl -8388636(%rbp)
+    jmp .Lmain_2920
+.Lmain_2916:
+    addq $8, %rsp
+.Lmain_2862:
+    incl -8388632(%rbp)
+    jmp .Lmain_2865
+.Lmain_2861:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2858:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2931
+    .p2align 4,,10
+.Lmain_2930:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2940
+    .p2align 4,,10
+.Lmain_2939:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2943:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2944:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2945:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2942:
+    incl -8388636(%rbp)
+.Lmain_2940:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2939
+.Lmain_2941:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2937
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2938:
+    incl -8388636(%rbp)
+    jmp .Lmain_2941
+.Lmain_2937:
+    addq $8, %rsp
+.Lmain_2934:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2952
+    .p2align 4,,10
+.Lmain_2951:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2955:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2956:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2957:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2954:
+    incl -8388636(%rbp)
+.Lmain_2952:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2951
+.Lmain_2953:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2949
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2950:
+    incl -8388636(%rbp)
+    jmp .Lmain_2953
+.Lmain_2949:
+    addq $8, %rsp
+.Lmain_2946:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2964
+    .p2align 4,,10
+.Lmain_2963:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2967:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2968:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2969:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2966:
+    incl -8388636(%rbp)
+.Lmain_2964:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2963
+.Lmain_2965:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2961
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2962:
+    incl -8388636(%rbp)
+    jmp .Lmain_2965
+.Lmain_2961:
+    addq $8, %rsp
+.Lmain_2958:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2975
+    .p2align 4,,10
+.Lmain_2974:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2978:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2979:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2980:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2977:
+    incl -8388636(%rbp)
+.Lmain_2975:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2974
+.Lmain_2976:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2972
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2973:
+    incl -8388636(%rbp)
+    jmp .Lmain_2976
+.Lmain_2972:
+    addq $8, %rsp
+.Lmain_2933:
+    incl -8388632(%rbp)
+.Lmain_2931:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2930
+.Lmain_2932:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2928
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_2986
+    .p2align 4,,10
+.Lmain_2985:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2989:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2990:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2991:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2988:
+    incl -8388636(%rbp)
+.Lmain_2986:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2985
+.Lmain_2987:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2983
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_2984:
+    incl -8388636(%rbp)
+    jmp .Lmain_2987
+.Lmain_2983:
+    addq $8, %rsp
+.Lmain_2929:
+    incl -8388632(%rbp)
+    jmp .Lmain_2932
+.Lmain_2928:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2925:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_2997
+    .p2align 4,,10
+.Lmain_2996:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3006
+    .p2align 4,,10
+.Lmain_3005:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3009:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3010:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3011:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3008:
+    incl -8388636(%rbp)
+.Lmain_3006:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3005
+.Lmain_3007:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3003
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3004:
+    incl -8388636(%rbp)
+    jmp .Lmain_3007
+.Lmain_3003:
+    addq $8, %rsp
+.Lmain_3000:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3018
+    .p2align 4,,10
+.Lmain_3017:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3021:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3022:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3023:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3020:
+    incl -8388636(%rbp)
+.Lmain_3018:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3017
+.Lmain_3019:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3015
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3016:
+    incl -8388636(%rbp)
+    jmp .Lmain_3019
+.Lmain_3015:
+    addq $8, %rsp
+.Lmain_3012:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3030
+    .p2align 4,,10
+.Lmain_3029:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3033:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3034:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3035:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3032:
+    incl -8388636(%rbp)
+.Lmain_3030:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3029
+.Lmain_3031:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3027
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3028:
+    incl -8388636(%rbp)
+    jmp .Lmain_3031
+.Lmain_3027:
+    addq $8, %rsp
+.Lmain_3024:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3041
+    .p2align 4,,10
+.Lmain_3040:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3044:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3045:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3046:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3043:
+    incl -8388636(%rbp)
+.Lmain_3041:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3040
+.Lmain_3042:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3038
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3039:
+    incl -8388636(%rbp)
+    jmp .Lmain_3042
+.Lmain_3038:
+    addq $8, %rsp
+.Lmain_2999:
+    incl -8388632(%rbp)
+.Lmain_2997:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_2996
+.Lmain_2998:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2994
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3052
+    .p2align 4,,10
+.Lmain_3051:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3055:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3056:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3057:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3054:
+    incl -8388636(%rbp)
+.Lmain_3052:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3051
+.Lmain_3053:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3049
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3050:
+    incl -8388636(%rbp)
+    jmp .Lmain_3053
+.Lmain_3049:
+    addq $8, %rsp
+.Lmain_2995:
+    incl -8388632(%rbp)
+    jmp .Lmain_2998
+.Lmain_2994:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2857:
+    addl $8, -8388620(%rbp)
+.Lmain_2855:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_2854
+.Lmain_2856:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2852
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_3063
+    .p2align 4,,10
+.Lmain_3062:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3072
+    .p2align 4,,10
+.Lmain_3071:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3075:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3076:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3077:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3074:
+    incl -8388636(%rbp)
+.Lmain_3072:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3071
+.Lmain_3073:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3069
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3070:
+    incl -8388636(%rbp)
+    jmp .Lmain_3073
+.Lmain_3069:
+    addq $8, %rsp
+.Lmain_3066:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3084
+    .p2align 4,,10
+.Lmain_3083:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3087:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3088:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3089:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3086:
+    incl -8388636(%rbp)
+.Lmain_3084:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3083
+.Lmain_3085:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3081
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3082:
+    incl -8388636(%rbp)
+    jmp .Lmain_3085
+.Lmain_3081:
+    addq $8, %rsp
+.Lmain_3078:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3096
+    .p2align 4,,10
+.Lmain_3095:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3099:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3100:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3101:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3098:
+    incl -8388636(%rbp)
+.Lmain_3096:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3095
+.Lmain_3097:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3093
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3094:
+    incl -8388636(%rbp)
+    jmp .Lmain_3097
+.Lmain_3093:
+    addq $8, %rsp
+.Lmain_3090:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3107
+    .p2align 4,,10
+.Lmain_3106:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3110:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3111:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3112:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3109:
+    incl -8388636(%rbp)
+.Lmain_3107:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3106
+.Lmain_3108:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3104
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3105:
+    incl -8388636(%rbp)
+    jmp .Lmain_3108
+.Lmain_3104:
+    addq $8, %rsp
+.Lmain_3065:
+    incl -8388632(%rbp)
+.Lmain_3063:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3062
+.Lmain_3064:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3060
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3118
+    .p2align 4,,10
+.Lmain_3117:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3121:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3122:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3123:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3120:
+    incl -8388636(%rbp)
+.Lmain_3118:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3117
+.Lmain_3119:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3115
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3116:
+    incl -8388636(%rbp)
+    jmp .Lmain_3119
+.Lmain_3115:
+    addq $8, %rsp
+.Lmain_3061:
+    incl -8388632(%rbp)
+    jmp .Lmain_3064
+.Lmain_3060:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_2853:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_2856
+.Lmain_2852:
+    addq $8, %rsp
+.Lmain_2574:
+    addl $8, -8388616(%rbp)
+.Lmain_2572:
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    cmpq $1024, %rax
+    jl .Lmain_2571
+.Lmain_2573:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_2569
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_3129
+    .p2align 4,,10
+.Lmain_3128:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_3138
+    .p2align 4,,10
+.Lmain_3137:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3147
+    .p2align 4,,10
+.Lmain_3146:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3150:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3151:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3152:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3149:
+    incl -8388636(%rbp)
+.Lmain_3147:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3146
+.Lmain_3148:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3144
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3145:
+    incl -8388636(%rbp)
+    jmp .Lmain_3148
+.Lmain_3144:
+    addq $8, %rsp
+.Lmain_3141:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3159
+    .p2align 4,,10
+.Lmain_3158:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3162:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3163:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3164:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3161:
+    incl -8388636(%rbp)
+.Lmain_3159:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3158
+.Lmain_3160:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3156
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3157:
+    incl -8388636(%rbp)
+    jmp .Lmain_3160
+.Lmain_3156:
+    addq $8, %rsp
+.Lmain_3153:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3171
+    .p2align 4,,10
+.Lmain_3170:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3174:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3175:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3176:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3173:
+    incl -8388636(%rbp)
+.Lmain_3171:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3170
+.Lmain_3172:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3168
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3169:
+    incl -8388636(%rbp)
+    jmp .Lmain_3172
+.Lmain_3168:
+    addq $8, %rsp
+.Lmain_3165:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3182
+    .p2align 4,,10
+.Lmain_3181:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3185:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3186:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3187:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3184:
+    incl -8388636(%rbp)
+.Lmain_3182:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3181
+.Lmain_3183:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3179
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3180:
+    incl -8388636(%rbp)
+    jmp .Lmain_3183
+.Lmain_3179:
+    addq $8, %rsp
+.Lmain_3140:
+    incl -8388632(%rbp)
+.Lmain_3138:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3137
+.Lmain_3139:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3135
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3193
+    .p2align 4,,10
+.Lmain_3192:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3196:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3197:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3198:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3195:
+    incl -8388636(%rbp)
+.Lmain_3193:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3192
+.Lmain_3194:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3190
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3191:
+    incl -8388636(%rbp)
+    jmp .Lmain_3194
+.Lmain_3190:
+    addq $8, %rsp
+.Lmain_3136:
+    incl -8388632(%rbp)
+    jmp .Lmain_3139
+.Lmain_3135:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_3132:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_3205
+    .p2align 4,,10
+.Lmain_3204:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3214
+    .p2align 4,,10
+.Lmain_3213:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3217:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3218:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3219:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3216:
+    incl -8388636(%rbp)
+.Lmain_3214:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3213
+.Lmain_3215:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3211
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3212:
+    incl -8388636(%rbp)
+    jmp .Lmain_3215
+.Lmain_3211:
+    addq $8, %rsp
+.Lmain_3208:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3226
+    .p2align 4,,10
+.Lmain_3225:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3229:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3230:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3231:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3228:
+    incl -8388636(%rbp)
+.Lmain_3226:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3225
+.Lmain_3227:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3223
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3224:
+    incl -8388636(%rbp)
+    jmp .Lmain_3227
+.Lmain_3223:
+    addq $8, %rsp
+.Lmain_3220:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3238
+    .p2align 4,,10
+.Lmain_3237:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3241:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3242:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3243:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3240:
+    incl -8388636(%rbp)
+.Lmain_3238:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3237
+.Lmain_3239:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3235
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3236:
+    incl -8388636(%rbp)
+    jmp .Lmain_3239
+.Lmain_3235:
+    addq $8, %rsp
+.Lmain_3232:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3249
+    .p2align 4,,10
+.Lmain_3248:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3252:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3253:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3254:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3251:
+    incl -8388636(%rbp)
+.Lmain_3249:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3248
+.Lmain_3250:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3246
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3247:
+    incl -8388636(%rbp)
+    jmp .Lmain_3250
+.Lmain_3246:
+    addq $8, %rsp
+.Lmain_3207:
+    incl -8388632(%rbp)
+.Lmain_3205:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3204
+.Lmain_3206:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3202
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3260
+    .p2align 4,,10
+.Lmain_3259:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3263:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3264:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3265:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3262:
+    incl -8388636(%rbp)
+.Lmain_3260:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3259
+.Lmain_3261:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3257
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3258:
+    incl -8388636(%rbp)
+    jmp .Lmain_3261
+.Lmain_3257:
+    addq $8, %rsp
+.Lmain_3203:
+    incl -8388632(%rbp)
+    jmp .Lmain_3206
+.Lmain_3202:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_3199:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_3271
+    .p2align 4,,10
+.Lmain_3270:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3280
+    .p2align 4,,10
+.Lmain_3279:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3283:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3284:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3285:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3282:
+    incl -8388636(%rbp)
+.Lmain_3280:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3279
+.Lmain_3281:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3277
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3278:
+    incl -8388636(%rbp)
+    jmp .Lmain_3281
+.Lmain_3277:
+    addq $8, %rsp
+.Lmain_3274:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3292
+    .p2align 4,,10
+.Lmain_3291:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3295:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3296:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3297:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3294:
+    incl -8388636(%rbp)
+.Lmain_3292:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3291
+.Lmain_3293:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3289
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3290:
+    incl -8388636(%rbp)
+    jmp .Lmain_3293
+.Lmain_3289:
+    addq $8, %rsp
+.Lmain_3286:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3304
+    .p2align 4,,10
+.Lmain_3303:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3307:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3308:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3309:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3306:
+    incl -8388636(%rbp)
+.Lmain_3304:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3303
+.Lmain_3305:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3301
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3302:
+    incl -8388636(%rbp)
+    jmp .Lmain_3305
+.Lmain_3301:
+    addq $8, %rsp
+.Lmain_3298:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3315
+    .p2align 4,,10
+.Lmain_3314:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3318:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3319:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3320:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3317:
+    incl -8388636(%rbp)
+.Lmain_3315:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3314
+.Lmain_3316:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3312
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3313:
+    incl -8388636(%rbp)
+    jmp .Lmain_3316
+.Lmain_3312:
+    addq $8, %rsp
+.Lmain_3273:
+    incl -8388632(%rbp)
+.Lmain_3271:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3270
+.Lmain_3272:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3268
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3326
+    .p2align 4,,10
+.Lmain_3325:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3329:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3330:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3331:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3328:
+    incl -8388636(%rbp)
+.Lmain_3326:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3325
+.Lmain_3327:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3323
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3324:
+    incl -8388636(%rbp)
+    jmp .Lmain_3327
+.Lmain_3323:
+    addq $8, %rsp
+.Lmain_3269:
+    incl -8388632(%rbp)
+    jmp .Lmain_3272
+.Lmain_3268:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_3131:
+    addl $8, -8388620(%rbp)
+.Lmain_3129:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_3128
+.Lmain_3130:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3126
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_3337
+    .p2align 4,,10
+.Lmain_3336:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3346
+    .p2align 4,,10
+.Lmain_3345:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3349:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3350:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3351:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3348:
+    incl -8388636(%rbp)
+.Lmain_3346:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3345
+.Lmain_3347:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3343
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3344:
+    incl -8388636(%rbp)
+    jmp .Lmain_3347
+.Lmain_3343:
+    addq $8, %rsp
+.Lmain_3340:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3358
+    .p2align 4,,10
+.Lmain_3357:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3361:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3362:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3363:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3360:
+    incl -8388636(%rbp)
+.Lmain_3358:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3357
+.Lmain_3359:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3355
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3356:
+    incl -8388636(%rbp)
+    jmp .Lmain_3359
+.Lmain_3355:
+    addq $8, %rsp
+.Lmain_3352:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3370
+    .p2align 4,,10
+.Lmain_3369:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3373:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3374:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3375:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3372:
+    incl -8388636(%rbp)
+.Lmain_3370:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3369
+.Lmain_3371:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3367
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3368:
+    incl -8388636(%rbp)
+    jmp .Lmain_3371
+.Lmain_3367:
+    addq $8, %rsp
+.Lmain_3364:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3381
+    .p2align 4,,10
+.Lmain_3380:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3384:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3385:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3386:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3383:
+    incl -8388636(%rbp)
+.Lmain_3381:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3380
+.Lmain_3382:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3378
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3379:
+    incl -8388636(%rbp)
+    jmp .Lmain_3382
+.Lmain_3378:
+    addq $8, %rsp
+.Lmain_3339:
+    incl -8388632(%rbp)
+.Lmain_3337:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3336
+.Lmain_3338:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3334
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_3392
+    .p2align 4,,10
+.Lmain_3391:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3395:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3396:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3397:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3394:
+    incl -8388636(%rbp)
+.Lmain_3392:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_3391
+.Lmain_3393:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3389
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_3390:
+    incl -8388636(%rbp)
+    jmp .Lmain_3393
+.Lmain_3389:
+    addq $8, %rsp
+.Lmain_3335:
+    incl -8388632(%rbp)
+    jmp .Lmain_3338
+.Lmain_3334:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_3127:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_3130
+.Lmain_3126:
+    addq $8, %rsp
+.Lmain_2570:
+    addl $8, -8388616(%rbp)
+    jmp .Lmain_2573
+.Lmain_2569:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 9 28
+    incl -8388612(%rbp)
+.Lmain_72:
+    cmpl $4, -8388612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_71
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_3403
+    .p2align 4,,10
+.Lmain_3402:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_3412
+    .p2align 4,,10
+.Lmain_3411:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3415:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3416:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3417:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3414:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_3412:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_3411
+.Lmain_3413:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3409
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3410:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_3413
+.Lmain_3409:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_3406:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_3424
+    .p2align 4,,10
+.Lmain_3423:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3427:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3428:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3429:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3426:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_3424:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_3423
+.Lmain_3425:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3421
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3422:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_3425
+.Lmain_3421:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_3418:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_3436
+    .p2align 4,,10
+.Lmain_3435:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3439:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3440:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3441:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3438:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_3436:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_3435
+.Lmain_3437:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3433
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3434:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_3437
+.Lmain_3433:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_3430:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_3447
+    .p2align 4,,10
+.Lmain_3446:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3450:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3451:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3452:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3449:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_3447:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_3446
+.Lmain_3448:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3444
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3445:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_3448
+.Lmain_3444:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_3405:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+.Lmain_3403:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_3402
+.Lmain_3404:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3400
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_3458
+    .p2align 4,,10
+.Lmain_3457:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3461:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3462:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3463:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3460:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_3458:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_3457
+.Lmain_3459:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3455
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_3456:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_3459
+.Lmain_3455:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_3401:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    jmp .Lmain_3404
+.Lmain_3400:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,20355 @@
+    .file 1 "bench/kernels/trans_1024.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $4194304, %rsp
+    .loc 1 3 5
+    subq $4194304, %rsp
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_15:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_27:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_39
+    .p2align 4,,10
+.Lmain_38:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_39:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_50:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+.Lmain_6:
+    movslq -8388612(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $1024, -8388612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+.Lmain_61:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 6 13
+    movslq -8388612(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -8388616(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388616(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 5 35
+    incl -8388616(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 31
+    incl -8388612(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+    jmp .Lmain_72
+    .p2align 4,,10
+.Lmain_71:
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_78
+    .p2align 4,,10
+.Lmain_77:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_87
+    .p2align 4,,10
+.Lmain_86:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_96
+    .p2align 4,,10
+.Lmain_95:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_105
+    .p2align 4,,10
+.Lmain_104:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_108:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_109:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_110:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_107:
+    incl -8388636(%rbp)
+.Lmain_105:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_104
+.Lmain_106:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_102
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_103:
+    incl -8388636(%rbp)
+    jmp .Lmain_106
+.Lmain_102:
+    addq $8, %rsp
+.Lmain_99:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_117
+    .p2align 4,,10
+.Lmain_116:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_120:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_121:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_122:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_119:
+    incl -8388636(%rbp)
+.Lmain_117:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_116
+.Lmain_118:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_114
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_115:
+    incl -8388636(%rbp)
+    jmp .Lmain_118
+.Lmain_114:
+    addq $8, %rsp
+.Lmain_111:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_129
+    .p2align 4,,10
+.Lmain_128:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_132:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_133:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_134:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_131:
+    incl -8388636(%rbp)
+.Lmain_129:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_128
+.Lmain_130:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_126
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_127:
+    incl -8388636(%rbp)
+    jmp .Lmain_130
+.Lmain_126:
+    addq $8, %rsp
+.Lmain_123:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_140
+    .p2align 4,,10
+.Lmain_139:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_143:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_144:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_145:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_142:
+    incl -8388636(%rbp)
+.Lmain_140:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_139
+.Lmain_141:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_137
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_138:
+    incl -8388636(%rbp)
+    jmp .Lmain_141
+.Lmain_137:
+    addq $8, %rsp
+.Lmain_98:
+    incl -8388632(%rbp)
+.Lmain_96:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_95
+.Lmain_97:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_93
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_151
+    .p2align 4,,10
+.Lmain_150:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_154:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_155:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_156:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_153:
+    incl -8388636(%rbp)
+.Lmain_151:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_150
+.Lmain_152:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_148
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_149:
+    incl -8388636(%rbp)
+    jmp .Lmain_152
+.Lmain_148:
+    addq $8, %rsp
+.Lmain_94:
+    incl -8388632(%rbp)
+    jmp .Lmain_97
+.Lmain_93:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_90:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_163
+    .p2align 4,,10
+.Lmain_162:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_172
+    .p2align 4,,10
+.Lmain_171:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_175:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_176:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_177:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_174:
+    incl -8388636(%rbp)
+.Lmain_172:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_171
+.Lmain_173:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_169
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_170:
+    incl -8388636(%rbp)
+    jmp .Lmain_173
+.Lmain_169:
+    addq $8, %rsp
+.Lmain_166:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_184
+    .p2align 4,,10
+.Lmain_183:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_187:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_188:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_189:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_186:
+    incl -8388636(%rbp)
+.Lmain_184:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_183
+.Lmain_185:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_181
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_182:
+    incl -8388636(%rbp)
+    jmp .Lmain_185
+.Lmain_181:
+    addq $8, %rsp
+.Lmain_178:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_196
+    .p2align 4,,10
+.Lmain_195:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_199:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_200:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_201:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_198:
+    incl -8388636(%rbp)
+.Lmain_196:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_195
+.Lmain_197:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_193
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_194:
+    incl -8388636(%rbp)
+    jmp .Lmain_197
+.Lmain_193:
+    addq $8, %rsp
+.Lmain_190:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_207
+    .p2align 4,,10
+.Lmain_206:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_210:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_211:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_212:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_209:
+    incl -8388636(%rbp)
+.Lmain_207:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_206
+.Lmain_208:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_204
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_205:
+    incl -8388636(%rbp)
+    jmp .Lmain_208
+.Lmain_204:
+    addq $8, %rsp
+.Lmain_165:
+    incl -8388632(%rbp)
+.Lmain_163:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_162
+.Lmain_164:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_160
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_218
+    .p2align 4,,10
+.Lmain_217:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_221:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_222:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_223:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_220:
+    incl -8388636(%rbp)
+.Lmain_218:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_217
+.Lmain_219:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_215
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_216:
+    incl -8388636(%rbp)
+    jmp .Lmain_219
+.Lmain_215:
+    addq $8, %rsp
+.Lmain_161:
+    incl -8388632(%rbp)
+    jmp .Lmain_164
+.Lmain_160:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_157:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_229
+    .p2align 4,,10
+.Lmain_228:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_238
+    .p2align 4,,10
+.Lmain_237:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_241:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_242:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_243:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_240:
+    incl -8388636(%rbp)
+.Lmain_238:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_237
+.Lmain_239:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_235
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_236:
+    incl -8388636(%rbp)
+    jmp .Lmain_239
+.Lmain_235:
+    addq $8, %rsp
+.Lmain_232:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_250
+    .p2align 4,,10
+.Lmain_249:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_253:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_254:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_255:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_252:
+    incl -8388636(%rbp)
+.Lmain_250:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_249
+.Lmain_251:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_247
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_248:
+    incl -8388636(%rbp)
+    jmp .Lmain_251
+.Lmain_247:
+    addq $8, %rsp
+.Lmain_244:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_262
+    .p2align 4,,10
+.Lmain_261:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_265:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_266:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_267:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_264:
+    incl -8388636(%rbp)
+.Lmain_262:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_261
+.Lmain_263:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_259
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_260:
+    incl -8388636(%rbp)
+    jmp .Lmain_263
+.Lmain_259:
+    addq $8, %rsp
+.Lmain_256:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_273
+    .p2align 4,,10
+.Lmain_272:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_276:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_277:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_278:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_275:
+    incl -8388636(%rbp)
+.Lmain_273:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_272
+.Lmain_274:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_270
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_271:
+    incl -8388636(%rbp)
+    jmp .Lmain_274
+.Lmain_270:
+    addq $8, %rsp
+.Lmain_231:
+    incl -8388632(%rbp)
+.Lmain_229:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_228
+.Lmain_230:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_226
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_284
+    .p2align 4,,10
+.Lmain_283:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_287:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_288:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_289:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_286:
+    incl -8388636(%rbp)
+.Lmain_284:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_283
+.Lmain_285:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_281
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_282:
+    incl -8388636(%rbp)
+    jmp .Lmain_285
+.Lmain_281:
+    addq $8, %rsp
+.Lmain_227:
+    incl -8388632(%rbp)
+    jmp .Lmain_230
+.Lmain_226:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_89:
+    addl $8, -8388620(%rbp)
+.Lmain_87:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_86
+.Lmain_88:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_84
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_295
+    .p2align 4,,10
+.Lmain_294:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_304
+    .p2align 4,,10
+.Lmain_303:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_307:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_308:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_309:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_306:
+    incl -8388636(%rbp)
+.Lmain_304:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_303
+.Lmain_305:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_301
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_302:
+    incl -8388636(%rbp)
+    jmp .Lmain_305
+.Lmain_301:
+    addq $8, %rsp
+.Lmain_298:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_316
+    .p2align 4,,10
+.Lmain_315:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_319:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_320:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_321:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_318:
+    incl -8388636(%rbp)
+.Lmain_316:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_315
+.Lmain_317:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_313
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_314:
+    incl -8388636(%rbp)
+    jmp .Lmain_317
+.Lmain_313:
+    addq $8, %rsp
+.Lmain_310:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_328
+    .p2align 4,,10
+.Lmain_327:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_331:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_332:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_333:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_330:
+    incl -8388636(%rbp)
+.Lmain_328:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_327
+.Lmain_329:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_325
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_326:
+    incl -8388636(%rbp)
+    jmp .Lmain_329
+.Lmain_325:
+    addq $8, %rsp
+.Lmain_322:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_339
+    .p2align 4,,10
+.Lmain_338:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_342:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_343:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_344:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_341:
+    incl -8388636(%rbp)
+.Lmain_339:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_338
+.Lmain_340:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_336
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_337:
+    incl -8388636(%rbp)
+    jmp .Lmain_340
+.Lmain_336:
+    addq $8, %rsp
+.Lmain_297:
+    incl -8388632(%rbp)
+.Lmain_295:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_294
+.Lmain_296:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_292
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_350
+    .p2align 4,,10
+.Lmain_349:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_353:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_354:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_355:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_352:
+    incl -8388636(%rbp)
+.Lmain_350:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_349
+.Lmain_351:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_347
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_348:
+    incl -8388636(%rbp)
+    jmp .Lmain_351
+.Lmain_347:
+    addq $8, %rsp
+.Lmain_293:
+    incl -8388632(%rbp)
+    jmp .Lmain_296
+.Lmain_292:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_85:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_88
+.Lmain_84:
+    addq $8, %rsp
+.Lmain_81:
+    addl $8, -8388616(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_361
+    .p2align 4,,10
+.Lmain_360:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_370
+    .p2align 4,,10
+.Lmain_369:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_379
+    .p2align 4,,10
+.Lmain_378:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_382:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_383:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_384:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_381:
+    incl -8388636(%rbp)
+.Lmain_379:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_378
+.Lmain_380:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_376
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_377:
+    incl -8388636(%rbp)
+    jmp .Lmain_380
+.Lmain_376:
+    addq $8, %rsp
+.Lmain_373:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_391
+    .p2align 4,,10
+.Lmain_390:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_394:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_395:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_396:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_393:
+    incl -8388636(%rbp)
+.Lmain_391:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_390
+.Lmain_392:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_388
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_389:
+    incl -8388636(%rbp)
+    jmp .Lmain_392
+.Lmain_388:
+    addq $8, %rsp
+.Lmain_385:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_403
+    .p2align 4,,10
+.Lmain_402:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_406:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_407:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_408:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_405:
+    incl -8388636(%rbp)
+.Lmain_403:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_402
+.Lmain_404:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_400
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_401:
+    incl -8388636(%rbp)
+    jmp .Lmain_404
+.Lmain_400:
+    addq $8, %rsp
+.Lmain_397:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_414
+    .p2align 4,,10
+.Lmain_413:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_417:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_418:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_419:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_416:
+    incl -8388636(%rbp)
+.Lmain_414:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_413
+.Lmain_415:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_411
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_412:
+    incl -8388636(%rbp)
+    jmp .Lmain_415
+.Lmain_411:
+    addq $8, %rsp
+.Lmain_372:
+    incl -8388632(%rbp)
+.Lmain_370:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_369
+.Lmain_371:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_367
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_425
+    .p2align 4,,10
+.Lmain_424:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_428:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_429:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_430:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_427:
+    incl -8388636(%rbp)
+.Lmain_425:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_424
+.Lmain_426:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_422
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_423:
+    incl -8388636(%rbp)
+    jmp .Lmain_426
+.Lmain_422:
+    addq $8, %rsp
+.Lmain_368:
+    incl -8388632(%rbp)
+    jmp .Lmain_371
+.Lmain_367:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_364:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_437
+    .p2align 4,,10
+.Lmain_436:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_446
+    .p2align 4,,10
+.Lmain_445:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_449:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_450:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_451:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_448:
+    incl -8388636(%rbp)
+.Lmain_446:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_445
+.Lmain_447:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_443
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_444:
+    incl -8388636(%rbp)
+    jmp .Lmain_447
+.Lmain_443:
+    addq $8, %rsp
+.Lmain_440:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_458
+    .p2align 4,,10
+.Lmain_457:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_461:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_462:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_463:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_460:
+    incl -8388636(%rbp)
+.Lmain_458:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_457
+.Lmain_459:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_455
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_456:
+    incl -8388636(%rbp)
+    jmp .Lmain_459
+.Lmain_455:
+    addq $8, %rsp
+.Lmain_452:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_470
+    .p2align 4,,10
+.Lmain_469:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_473:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_474:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_475:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_472:
+    incl -8388636(%rbp)
+.Lmain_470:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_469
+.Lmain_471:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_467
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_468:
+    incl -8388636(%rbp)
+    jmp .Lmain_471
+.Lmain_467:
+    addq $8, %rsp
+.Lmain_464:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_481
+    .p2align 4,,10
+.Lmain_480:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_484:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_485:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_486:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_483:
+    incl -8388636(%rbp)
+.Lmain_481:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_480
+.Lmain_482:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_478
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_479:
+    incl -8388636(%rbp)
+    jmp .Lmain_482
+.Lmain_478:
+    addq $8, %rsp
+.Lmain_439:
+    incl -8388632(%rbp)
+.Lmain_437:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_436
+.Lmain_438:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_434
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_492
+    .p2align 4,,10
+.Lmain_491:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_495:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_496:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_497:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_494:
+    incl -8388636(%rbp)
+.Lmain_492:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_491
+.Lmain_493:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_489
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_490:
+    incl -8388636(%rbp)
+    jmp .Lmain_493
+.Lmain_489:
+    addq $8, %rsp
+.Lmain_435:
+    incl -8388632(%rbp)
+    jmp .Lmain_438
+.Lmain_434:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_431:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_503
+    .p2align 4,,10
+.Lmain_502:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_512
+    .p2align 4,,10
+.Lmain_511:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_515:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_516:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_517:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_514:
+    incl -8388636(%rbp)
+.Lmain_512:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_511
+.Lmain_513:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_509
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_510:
+    incl -8388636(%rbp)
+    jmp .Lmain_513
+.Lmain_509:
+    addq $8, %rsp
+.Lmain_506:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_524
+    .p2align 4,,10
+.Lmain_523:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_527:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_528:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_529:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_526:
+    incl -8388636(%rbp)
+.Lmain_524:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_523
+.Lmain_525:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_521
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_522:
+    incl -8388636(%rbp)
+    jmp .Lmain_525
+.Lmain_521:
+    addq $8, %rsp
+.Lmain_518:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_536
+    .p2align 4,,10
+.Lmain_535:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_539:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_540:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_541:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_538:
+    incl -8388636(%rbp)
+.Lmain_536:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_535
+.Lmain_537:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_533
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_534:
+    incl -8388636(%rbp)
+    jmp .Lmain_537
+.Lmain_533:
+    addq $8, %rsp
+.Lmain_530:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_547
+    .p2align 4,,10
+.Lmain_546:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_550:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_551:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_552:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_549:
+    incl -8388636(%rbp)
+.Lmain_547:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_546
+.Lmain_548:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_544
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_545:
+    incl -8388636(%rbp)
+    jmp .Lmain_548
+.Lmain_544:
+    addq $8, %rsp
+.Lmain_505:
+    incl -8388632(%rbp)
+.Lmain_503:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_502
+.Lmain_504:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_500
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_558
+    .p2align 4,,10
+.Lmain_557:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_561:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_562:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_563:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_560:
+    incl -8388636(%rbp)
+.Lmain_558:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_557
+.Lmain_559:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_555
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_556:
+    incl -8388636(%rbp)
+    jmp .Lmain_559
+.Lmain_555:
+    addq $8, %rsp
+.Lmain_501:
+    incl -8388632(%rbp)
+    jmp .Lmain_504
+.Lmain_500:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_363:
+    addl $8, -8388620(%rbp)
+.Lmain_361:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_360
+.Lmain_362:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_358
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_569
+    .p2align 4,,10
+.Lmain_568:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_578
+    .p2align 4,,10
+.Lmain_577:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_581:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_582:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_583:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_580:
+    incl -8388636(%rbp)
+.Lmain_578:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_577
+.Lmain_579:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_575
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_576:
+    incl -8388636(%rbp)
+    jmp .Lmain_579
+.Lmain_575:
+    addq $8, %rsp
+.Lmain_572:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_590
+    .p2align 4,,10
+.Lmain_589:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_593:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_594:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_595:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_592:
+    incl -8388636(%rbp)
+.Lmain_590:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_589
+.Lmain_591:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_587
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_588:
+    incl -8388636(%rbp)
+    jmp .Lmain_591
+.Lmain_587:
+    addq $8, %rsp
+.Lmain_584:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_602
+    .p2align 4,,10
+.Lmain_601:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_605:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_606:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_607:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_604:
+    incl -8388636(%rbp)
+.Lmain_602:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_601
+.Lmain_603:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_599
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_600:
+    incl -8388636(%rbp)
+    jmp .Lmain_603
+.Lmain_599:
+    addq $8, %rsp
+.Lmain_596:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_613
+    .p2align 4,,10
+.Lmain_612:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_616:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_617:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_618:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_615:
+    incl -8388636(%rbp)
+.Lmain_613:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_612
+.Lmain_614:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_610
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_611:
+    incl -8388636(%rbp)
+    jmp .Lmain_614
+.Lmain_610:
+    addq $8, %rsp
+.Lmain_571:
+    incl -8388632(%rbp)
+.Lmain_569:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_568
+.Lmain_570:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_566
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_624
+    .p2align 4,,10
+.Lmain_623:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_627:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_628:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_629:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_626:
+    incl -8388636(%rbp)
+.Lmain_624:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_623
+.Lmain_625:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_621
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_622:
+    incl -8388636(%rbp)
+    jmp .Lmain_625
+.Lmain_621:
+    addq $8, %rsp
+.Lmain_567:
+    incl -8388632(%rbp)
+    jmp .Lmain_570
+.Lmain_566:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_359:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_362
+.Lmain_358:
+    addq $8, %rsp
+.Lmain_80:
+    addl $8, -8388616(%rbp)
+.Lmain_78:
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    cmpq $1024, %rax
+    jl .Lmain_77
+.Lmain_79:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_75
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_635
+    .p2align 4,,10
+.Lmain_634:
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_644
+    .p2align 4,,10
+.Lmain_643:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_653
+    .p2align 4,,10
+.Lmain_652:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_656:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_657:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_658:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_655:
+    incl -8388636(%rbp)
+.Lmain_653:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_652
+.Lmain_654:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_650
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_651:
+    incl -8388636(%rbp)
+    jmp .Lmain_654
+.Lmain_650:
+    addq $8, %rsp
+.Lmain_647:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_665
+    .p2align 4,,10
+.Lmain_664:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_668:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_669:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_670:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_667:
+    incl -8388636(%rbp)
+.Lmain_665:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_664
+.Lmain_666:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_662
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_663:
+    incl -8388636(%rbp)
+    jmp .Lmain_666
+.Lmain_662:
+    addq $8, %rsp
+.Lmain_659:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_677
+    .p2align 4,,10
+.Lmain_676:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_680:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_681:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_682:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_679:
+    incl -8388636(%rbp)
+.Lmain_677:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_676
+.Lmain_678:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_674
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_675:
+    incl -8388636(%rbp)
+    jmp .Lmain_678
+.Lmain_674:
+    addq $8, %rsp
+.Lmain_671:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_688
+    .p2align 4,,10
+.Lmain_687:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_691:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_692:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_693:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_690:
+    incl -8388636(%rbp)
+.Lmain_688:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_687
+.Lmain_689:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_685
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_686:
+    incl -8388636(%rbp)
+    jmp .Lmain_689
+.Lmain_685:
+    addq $8, %rsp
+.Lmain_646:
+    incl -8388632(%rbp)
+.Lmain_644:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_643
+.Lmain_645:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_641
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_699
+    .p2align 4,,10
+.Lmain_698:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_702:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_703:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_704:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_701:
+    incl -8388636(%rbp)
+.Lmain_699:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_698
+.Lmain_700:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_696
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_697:
+    incl -8388636(%rbp)
+    jmp .Lmain_700
+.Lmain_696:
+    addq $8, %rsp
+.Lmain_642:
+    incl -8388632(%rbp)
+    jmp .Lmain_645
+.Lmain_641:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_638:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_711
+    .p2align 4,,10
+.Lmain_710:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_720
+    .p2align 4,,10
+.Lmain_719:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_723:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_724:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_725:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_722:
+    incl -8388636(%rbp)
+.Lmain_720:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_719
+.Lmain_721:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_717
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_718:
+    incl -8388636(%rbp)
+    jmp .Lmain_721
+.Lmain_717:
+    addq $8, %rsp
+.Lmain_714:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_732
+    .p2align 4,,10
+.Lmain_731:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_735:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_736:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_737:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_734:
+    incl -8388636(%rbp)
+.Lmain_732:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_731
+.Lmain_733:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_729
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_730:
+    incl -8388636(%rbp)
+    jmp .Lmain_733
+.Lmain_729:
+    addq $8, %rsp
+.Lmain_726:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_744
+    .p2align 4,,10
+.Lmain_743:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_747:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_748:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_749:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_746:
+    incl -8388636(%rbp)
+.Lmain_744:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_743
+.Lmain_745:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_741
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_742:
+    incl -8388636(%rbp)
+    jmp .Lmain_745
+.Lmain_741:
+    addq $8, %rsp
+.Lmain_738:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_755
+    .p2align 4,,10
+.Lmain_754:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_758:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_759:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_760:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_757:
+    incl -8388636(%rbp)
+.Lmain_755:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_754
+.Lmain_756:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_752
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_753:
+    incl -8388636(%rbp)
+    jmp .Lmain_756
+.Lmain_752:
+    addq $8, %rsp
+.Lmain_713:
+    incl -8388632(%rbp)
+.Lmain_711:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_710
+.Lmain_712:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_708
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_766
+    .p2align 4,,10
+.Lmain_765:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_769:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_770:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_771:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_768:
+    incl -8388636(%rbp)
+.Lmain_766:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_765
+.Lmain_767:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_763
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_764:
+    incl -8388636(%rbp)
+    jmp .Lmain_767
+.Lmain_763:
+    addq $8, %rsp
+.Lmain_709:
+    incl -8388632(%rbp)
+    jmp .Lmain_712
+.Lmain_708:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_705:
+    addl $8, -8388620(%rbp)
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_777
+    .p2align 4,,10
+.Lmain_776:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_786
+    .p2align 4,,10
+.Lmain_785:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_789:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_790:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_791:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_788:
+    incl -8388636(%rbp)
+.Lmain_786:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_785
+.Lmain_787:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_783
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_784:
+    incl -8388636(%rbp)
+    jmp .Lmain_787
+.Lmain_783:
+    addq $8, %rsp
+.Lmain_780:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_798
+    .p2align 4,,10
+.Lmain_797:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_801:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_802:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_803:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_800:
+    incl -8388636(%rbp)
+.Lmain_798:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_797
+.Lmain_799:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_795
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_796:
+    incl -8388636(%rbp)
+    jmp .Lmain_799
+.Lmain_795:
+    addq $8, %rsp
+.Lmain_792:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_810
+    .p2align 4,,10
+.Lmain_809:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_813:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_814:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_815:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_812:
+    incl -8388636(%rbp)
+.Lmain_810:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_809
+.Lmain_811:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_807
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_808:
+    incl -8388636(%rbp)
+    jmp .Lmain_811
+.Lmain_807:
+    addq $8, %rsp
+.Lmain_804:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_821
+    .p2align 4,,10
+.Lmain_820:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_824:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_825:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_826:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_823:
+    incl -8388636(%rbp)
+.Lmain_821:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_820
+.Lmain_822:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_818
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_819:
+    incl -8388636(%rbp)
+    jmp .Lmain_822
+.Lmain_818:
+    addq $8, %rsp
+.Lmain_779:
+    incl -8388632(%rbp)
+.Lmain_777:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_776
+.Lmain_778:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_774
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_832
+    .p2align 4,,10
+.Lmain_831:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_835:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_836:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_837:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_834:
+    incl -8388636(%rbp)
+.Lmain_832:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_831
+.Lmain_833:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_829
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_830:
+    incl -8388636(%rbp)
+    jmp .Lmain_833
+.Lmain_829:
+    addq $8, %rsp
+.Lmain_775:
+    incl -8388632(%rbp)
+    jmp .Lmain_778
+.Lmain_774:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_637:
+    addl $8, -8388620(%rbp)
+.Lmain_635:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_634
+.Lmain_636:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_632
+    .loc 1 10 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 10 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_843
+    .p2align 4,,10
+.Lmain_842:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_852
+    .p2align 4,,10
+.Lmain_851:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_855:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_856:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_857:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_854:
+    incl -8388636(%rbp)
+.Lmain_852:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_851
+.Lmain_853:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_849
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_850:
+    incl -8388636(%rbp)
+    jmp .Lmain_853
+.Lmain_849:
+    addq $8, %rsp
+.Lmain_846:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_864
+    .p2align 4,,10
+.Lmain_863:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_867:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_868:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_869:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_866:
+    incl -8388636(%rbp)
+.Lmain_864:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_863
+.Lmain_865:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_861
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_862:
+    incl -8388636(%rbp)
+    jmp .Lmain_865
+.Lmain_861:
+    addq $8, %rsp
+.Lmain_858:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_876
+    .p2align 4,,10
+.Lmain_875:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_879:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_880:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_881:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_878:
+    incl -8388636(%rbp)
+.Lmain_876:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_875
+.Lmain_877:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_873
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_874:
+    incl -8388636(%rbp)
+    jmp .Lmain_877
+.Lmain_873:
+    addq $8, %rsp
+.Lmain_870:
+    incl -8388632(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_887
+    .p2align 4,,10
+.Lmain_886:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_890:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_891:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_892:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_889:
+    incl -8388636(%rbp)
+.Lmain_887:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_886
+.Lmain_888:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_884
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_885:
+    incl -8388636(%rbp)
+    jmp .Lmain_888
+.Lmain_884:
+    addq $8, %rsp
+.Lmain_845:
+    incl -8388632(%rbp)
+.Lmain_843:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_842
+.Lmain_844:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_840
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_898
+    .p2align 4,,10
+.Lmain_897:
+    .loc 1 12 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_901:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_902:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_903:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_900:
+    incl -8388636(%rbp)
+.Lmain_898:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_897
+.Lmain_899:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_895
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_896:
+    incl -8388636(%rbp)
+    jmp .Lmain_899
+.Lmain_895:
+    addq $8, %rsp
+.Lmain_841:
+    incl -8388632(%rbp)
+    jmp .Lmain_844
+.Lmain_840:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_633:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_636
+.Lmain_632:
+    addq $8, %rsp
+.Lmain_76:
+    addl $8, -8388616(%rbp)
+    jmp .Lmain_79
+.Lmain_75:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_909
+    .p2align 4,,10
+.Lmain_908:
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_918
+    .p2align 4,,10
+.Lmain_917:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_927
+    .p2align 4,,10
+.Lmain_926:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_936
+    .p2align 4,,10
+.Lmain_935:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_939:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_940:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_941:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_938:
+    incl -8388636(%rbp)
+.Lmain_936:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_935
+.Lmain_937:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_933
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_934:
+    incl -8388636(%rbp)
+    jmp .Lmain_937
+.Lmain_933:
+    addq $8, %rsp
+.Lmain_930:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_948
+    .p2align 4,,10
+.Lmain_947:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_951:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_952:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_953:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_950:
+    incl -8388636(%rbp)
+.Lmain_948:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_947
+.Lmain_949:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_945
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_946:
+    incl -8388636(%rbp)
+    jmp .Lmain_949
+.Lmain_945:
+    addq $8, %rsp
+.Lmain_942:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_960
+    .p2align 4,,10
+.Lmain_959:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_963:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_964:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_965:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_962:
+    incl -8388636(%rbp)
+.Lmain_960:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_959
+.Lmain_961:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_957
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_958:
+    incl -8388636(%rbp)
+    jmp .Lmain_961
+.Lmain_957:
+    addq $8, %rsp
+.Lmain_954:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_971
+    .p2align 4,,10
+.Lmain_970:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_974:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_975:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_976:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_973:
+    incl -8388636(%rbp)
+.Lmain_971:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_970
+.Lmain_972:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_968
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_969:
+    incl -8388636(%rbp)
+    jmp .Lmain_972
+.Lmain_968:
+    addq $8, %rsp
+.Lmain_929:
+    incl -8388632(%rbp)
+.Lmain_927:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_926
+.Lmain_928:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_924
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_982
+    .p2align 4,,10
+.Lmain_981:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_985:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_986:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_987:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_984:
+    incl -8388636(%rbp)
+.Lmain_982:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_981
+.Lmain_983:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_979
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_980:
+    incl -8388636(%rbp)
+    jmp .Lmain_983
+.Lmain_979:
+    addq $8, %rsp
+.Lmain_925:
+    incl -8388632(%rbp)
+    jmp .Lmain_928
+.Lmain_924:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_921:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_994
+    .p2align 4,,10
+.Lmain_993:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1003
+    .p2align 4,,10
+.Lmain_1002:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1006:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1007:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1008:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1005:
+    incl -8388636(%rbp)
+.Lmain_1003:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1002
+.Lmain_1004:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1000
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1001:
+    incl -8388636(%rbp)
+    jmp .Lmain_1004
+.Lmain_1000:
+    addq $8, %rsp
+.Lmain_997:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1015
+    .p2align 4,,10
+.Lmain_1014:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1018:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1019:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1020:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1017:
+    incl -8388636(%rbp)
+.Lmain_1015:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1014
+.Lmain_1016:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1012
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1013:
+    incl -8388636(%rbp)
+    jmp .Lmain_1016
+.Lmain_1012:
+    addq $8, %rsp
+.Lmain_1009:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1027
+    .p2align 4,,10
+.Lmain_1026:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1030:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1031:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1032:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1029:
+    incl -8388636(%rbp)
+.Lmain_1027:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1026
+.Lmain_1028:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1024
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1025:
+    incl -8388636(%rbp)
+    jmp .Lmain_1028
+.Lmain_1024:
+    addq $8, %rsp
+.Lmain_1021:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1038
+    .p2align 4,,10
+.Lmain_1037:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1041:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1042:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1043:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1040:
+    incl -8388636(%rbp)
+.Lmain_1038:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1037
+.Lmain_1039:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1035
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1036:
+    incl -8388636(%rbp)
+    jmp .Lmain_1039
+.Lmain_1035:
+    addq $8, %rsp
+.Lmain_996:
+    incl -8388632(%rbp)
+.Lmain_994:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_993
+.Lmain_995:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_991
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1049
+    .p2align 4,,10
+.Lmain_1048:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1052:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1053:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1054:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1051:
+    incl -8388636(%rbp)
+.Lmain_1049:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1048
+.Lmain_1050:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1046
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1047:
+    incl -8388636(%rbp)
+    jmp .Lmain_1050
+.Lmain_1046:
+    addq $8, %rsp
+.Lmain_992:
+    incl -8388632(%rbp)
+    jmp .Lmain_995
+.Lmain_991:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_988:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1060
+    .p2align 4,,10
+.Lmain_1059:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1069
+    .p2align 4,,10
+.Lmain_1068:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1072:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1073:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1074:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1071:
+    incl -8388636(%rbp)
+.Lmain_1069:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1068
+.Lmain_1070:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1066
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1067:
+    incl -8388636(%rbp)
+    jmp .Lmain_1070
+.Lmain_1066:
+    addq $8, %rsp
+.Lmain_1063:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1081
+    .p2align 4,,10
+.Lmain_1080:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1084:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1085:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1086:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1083:
+    incl -8388636(%rbp)
+.Lmain_1081:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1080
+.Lmain_1082:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1078
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1079:
+    incl -8388636(%rbp)
+    jmp .Lmain_1082
+.Lmain_1078:
+    addq $8, %rsp
+.Lmain_1075:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1093
+    .p2align 4,,10
+.Lmain_1092:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1096:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1097:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1098:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1095:
+    incl -8388636(%rbp)
+.Lmain_1093:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1092
+.Lmain_1094:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1090
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1091:
+    incl -8388636(%rbp)
+    jmp .Lmain_1094
+.Lmain_1090:
+    addq $8, %rsp
+.Lmain_1087:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1104
+    .p2align 4,,10
+.Lmain_1103:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1107:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1108:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1109:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1106:
+    incl -8388636(%rbp)
+.Lmain_1104:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1103
+.Lmain_1105:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1101
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1102:
+    incl -8388636(%rbp)
+    jmp .Lmain_1105
+.Lmain_1101:
+    addq $8, %rsp
+.Lmain_1062:
+    incl -8388632(%rbp)
+.Lmain_1060:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1059
+.Lmain_1061:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1057
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1115
+    .p2align 4,,10
+.Lmain_1114:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1118:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1119:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1120:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1117:
+    incl -8388636(%rbp)
+.Lmain_1115:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1114
+.Lmain_1116:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1112
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1113:
+    incl -8388636(%rbp)
+    jmp .Lmain_1116
+.Lmain_1112:
+    addq $8, %rsp
+.Lmain_1058:
+    incl -8388632(%rbp)
+    jmp .Lmain_1061
+.Lmain_1057:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_920:
+    addl $8, -8388620(%rbp)
+.Lmain_918:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_917
+.Lmain_919:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_915
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1126
+    .p2align 4,,10
+.Lmain_1125:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1135
+    .p2align 4,,10
+.Lmain_1134:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1138:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1139:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1140:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1137:
+    incl -8388636(%rbp)
+.Lmain_1135:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1134
+.Lmain_1136:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1132
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1133:
+    incl -8388636(%rbp)
+    jmp .Lmain_1136
+.Lmain_1132:
+    addq $8, %rsp
+.Lmain_1129:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1147
+    .p2align 4,,10
+.Lmain_1146:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1150:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1151:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1152:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1149:
+    incl -8388636(%rbp)
+.Lmain_1147:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1146
+.Lmain_1148:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1144
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1145:
+    incl -8388636(%rbp)
+    jmp .Lmain_1148
+.Lmain_1144:
+    addq $8, %rsp
+.Lmain_1141:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1159
+    .p2align 4,,10
+.Lmain_1158:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1162:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1163:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1164:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1161:
+    incl -8388636(%rbp)
+.Lmain_1159:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1158
+.Lmain_1160:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1156
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1157:
+    incl -8388636(%rbp)
+    jmp .Lmain_1160
+.Lmain_1156:
+    addq $8, %rsp
+.Lmain_1153:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1170
+    .p2align 4,,10
+.Lmain_1169:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1173:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1174:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1175:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1172:
+    incl -8388636(%rbp)
+.Lmain_1170:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1169
+.Lmain_1171:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1167
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1168:
+    incl -8388636(%rbp)
+    jmp .Lmain_1171
+.Lmain_1167:
+    addq $8, %rsp
+.Lmain_1128:
+    incl -8388632(%rbp)
+.Lmain_1126:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1125
+.Lmain_1127:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1123
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1181
+    .p2align 4,,10
+.Lmain_1180:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1184:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1185:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1186:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1183:
+    incl -8388636(%rbp)
+.Lmain_1181:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1180
+.Lmain_1182:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1178
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1179:
+    incl -8388636(%rbp)
+    jmp .Lmain_1182
+.Lmain_1178:
+    addq $8, %rsp
+.Lmain_1124:
+    incl -8388632(%rbp)
+    jmp .Lmain_1127
+.Lmain_1123:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_916:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_919
+.Lmain_915:
+    addq $8, %rsp
+.Lmain_912:
+    addl $8, -8388616(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1192
+    .p2align 4,,10
+.Lmain_1191:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1201
+    .p2align 4,,10
+.Lmain_1200:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1210
+    .p2align 4,,10
+.Lmain_1209:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1213:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1214:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1215:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1212:
+    incl -8388636(%rbp)
+.Lmain_1210:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1209
+.Lmain_1211:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1207
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1208:
+    incl -8388636(%rbp)
+    jmp .Lmain_1211
+.Lmain_1207:
+    addq $8, %rsp
+.Lmain_1204:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1222
+    .p2align 4,,10
+.Lmain_1221:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1225:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1226:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1227:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1224:
+    incl -8388636(%rbp)
+.Lmain_1222:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1221
+.Lmain_1223:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1219
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1220:
+    incl -8388636(%rbp)
+    jmp .Lmain_1223
+.Lmain_1219:
+    addq $8, %rsp
+.Lmain_1216:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1234
+    .p2align 4,,10
+.Lmain_1233:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1237:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1238:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1239:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1236:
+    incl -8388636(%rbp)
+.Lmain_1234:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1233
+.Lmain_1235:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1231
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1232:
+    incl -8388636(%rbp)
+    jmp .Lmain_1235
+.Lmain_1231:
+    addq $8, %rsp
+.Lmain_1228:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1245
+    .p2align 4,,10
+.Lmain_1244:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1248:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1249:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1250:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1247:
+    incl -8388636(%rbp)
+.Lmain_1245:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1244
+.Lmain_1246:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1242
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1243:
+    incl -8388636(%rbp)
+    jmp .Lmain_1246
+.Lmain_1242:
+    addq $8, %rsp
+.Lmain_1203:
+    incl -8388632(%rbp)
+.Lmain_1201:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1200
+.Lmain_1202:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1198
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1256
+    .p2align 4,,10
+.Lmain_1255:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1259:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1260:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1261:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1258:
+    incl -8388636(%rbp)
+.Lmain_1256:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1255
+.Lmain_1257:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1253
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1254:
+    incl -8388636(%rbp)
+    jmp .Lmain_1257
+.Lmain_1253:
+    addq $8, %rsp
+.Lmain_1199:
+    incl -8388632(%rbp)
+    jmp .Lmain_1202
+.Lmain_1198:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1195:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1268
+    .p2align 4,,10
+.Lmain_1267:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1277
+    .p2align 4,,10
+.Lmain_1276:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1280:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1281:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1282:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1279:
+    incl -8388636(%rbp)
+.Lmain_1277:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1276
+.Lmain_1278:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1274
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1275:
+    incl -8388636(%rbp)
+    jmp .Lmain_1278
+.Lmain_1274:
+    addq $8, %rsp
+.Lmain_1271:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1289
+    .p2align 4,,10
+.Lmain_1288:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1292:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1293:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1294:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1291:
+    incl -8388636(%rbp)
+.Lmain_1289:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1288
+.Lmain_1290:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1286
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1287:
+    incl -8388636(%rbp)
+    jmp .Lmain_1290
+.Lmain_1286:
+    addq $8, %rsp
+.Lmain_1283:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1301
+    .p2align 4,,10
+.Lmain_1300:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1304:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1305:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1306:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1303:
+    incl -8388636(%rbp)
+.Lmain_1301:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1300
+.Lmain_1302:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1298
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1299:
+    incl -8388636(%rbp)
+    jmp .Lmain_1302
+.Lmain_1298:
+    addq $8, %rsp
+.Lmain_1295:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1312
+    .p2align 4,,10
+.Lmain_1311:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1315:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1316:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1317:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1314:
+    incl -8388636(%rbp)
+.Lmain_1312:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1311
+.Lmain_1313:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1309
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1310:
+    incl -8388636(%rbp)
+    jmp .Lmain_1313
+.Lmain_1309:
+    addq $8, %rsp
+.Lmain_1270:
+    incl -8388632(%rbp)
+.Lmain_1268:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1267
+.Lmain_1269:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1265
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1323
+    .p2align 4,,10
+.Lmain_1322:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1326:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1327:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1328:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1325:
+    incl -8388636(%rbp)
+.Lmain_1323:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1322
+.Lmain_1324:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1320
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1321:
+    incl -8388636(%rbp)
+    jmp .Lmain_1324
+.Lmain_1320:
+    addq $8, %rsp
+.Lmain_1266:
+    incl -8388632(%rbp)
+    jmp .Lmain_1269
+.Lmain_1265:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1262:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1334
+    .p2align 4,,10
+.Lmain_1333:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1343
+    .p2align 4,,10
+.Lmain_1342:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1346:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1347:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1348:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1345:
+    incl -8388636(%rbp)
+.Lmain_1343:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1342
+.Lmain_1344:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1340
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1341:
+    incl -8388636(%rbp)
+    jmp .Lmain_1344
+.Lmain_1340:
+    addq $8, %rsp
+.Lmain_1337:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1355
+    .p2align 4,,10
+.Lmain_1354:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1358:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1359:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1360:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1357:
+    incl -8388636(%rbp)
+.Lmain_1355:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1354
+.Lmain_1356:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1352
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1353:
+    incl -8388636(%rbp)
+    jmp .Lmain_1356
+.Lmain_1352:
+    addq $8, %rsp
+.Lmain_1349:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1367
+    .p2align 4,,10
+.Lmain_1366:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1370:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1371:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1372:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1369:
+    incl -8388636(%rbp)
+.Lmain_1367:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1366
+.Lmain_1368:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1364
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1365:
+    incl -8388636(%rbp)
+    jmp .Lmain_1368
+.Lmain_1364:
+    addq $8, %rsp
+.Lmain_1361:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1378
+    .p2align 4,,10
+.Lmain_1377:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1381:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1382:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1383:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1380:
+    incl -8388636(%rbp)
+.Lmain_1378:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1377
+.Lmain_1379:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1375
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1376:
+    incl -8388636(%rbp)
+    jmp .Lmain_1379
+.Lmain_1375:
+    addq $8, %rsp
+.Lmain_1336:
+    incl -8388632(%rbp)
+.Lmain_1334:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1333
+.Lmain_1335:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1331
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1389
+    .p2align 4,,10
+.Lmain_1388:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1392:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1393:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1394:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1391:
+    incl -8388636(%rbp)
+.Lmain_1389:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1388
+.Lmain_1390:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1386
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1387:
+    incl -8388636(%rbp)
+    jmp .Lmain_1390
+.Lmain_1386:
+    addq $8, %rsp
+.Lmain_1332:
+    incl -8388632(%rbp)
+    jmp .Lmain_1335
+.Lmain_1331:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1194:
+    addl $8, -8388620(%rbp)
+.Lmain_1192:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1191
+.Lmain_1193:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1189
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1400
+    .p2align 4,,10
+.Lmain_1399:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1409
+    .p2align 4,,10
+.Lmain_1408:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1412:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1413:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1414:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1411:
+    incl -8388636(%rbp)
+.Lmain_1409:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1408
+.Lmain_1410:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1406
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1407:
+    incl -8388636(%rbp)
+    jmp .Lmain_1410
+.Lmain_1406:
+    addq $8, %rsp
+.Lmain_1403:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1421
+    .p2align 4,,10
+.Lmain_1420:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1424:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1425:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1426:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1423:
+    incl -8388636(%rbp)
+.Lmain_1421:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1420
+.Lmain_1422:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1418
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1419:
+    incl -8388636(%rbp)
+    jmp .Lmain_1422
+.Lmain_1418:
+    addq $8, %rsp
+.Lmain_1415:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1433
+    .p2align 4,,10
+.Lmain_1432:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1436:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1437:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1438:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1435:
+    incl -8388636(%rbp)
+.Lmain_1433:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1432
+.Lmain_1434:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1430
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1431:
+    incl -8388636(%rbp)
+    jmp .Lmain_1434
+.Lmain_1430:
+    addq $8, %rsp
+.Lmain_1427:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1444
+    .p2align 4,,10
+.Lmain_1443:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1447:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1448:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1449:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1446:
+    incl -8388636(%rbp)
+.Lmain_1444:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1443
+.Lmain_1445:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1441
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1442:
+    incl -8388636(%rbp)
+    jmp .Lmain_1445
+.Lmain_1441:
+    addq $8, %rsp
+.Lmain_1402:
+    incl -8388632(%rbp)
+.Lmain_1400:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1399
+.Lmain_1401:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1397
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1455
+    .p2align 4,,10
+.Lmain_1454:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1458:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1459:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1460:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1457:
+    incl -8388636(%rbp)
+.Lmain_1455:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1454
+.Lmain_1456:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1452
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1453:
+    incl -8388636(%rbp)
+    jmp .Lmain_1456
+.Lmain_1452:
+    addq $8, %rsp
+.Lmain_1398:
+    incl -8388632(%rbp)
+    jmp .Lmain_1401
+.Lmain_1397:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1190:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_1193
+.Lmain_1189:
+    addq $8, %rsp
+.Lmain_911:
+    addl $8, -8388616(%rbp)
+.Lmain_909:
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    cmpq $1024, %rax
+    jl .Lmain_908
+.Lmain_910:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_906
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1466
+    .p2align 4,,10
+.Lmain_1465:
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1475
+    .p2align 4,,10
+.Lmain_1474:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1484
+    .p2align 4,,10
+.Lmain_1483:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1487:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1488:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1489:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1486:
+    incl -8388636(%rbp)
+.Lmain_1484:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1483
+.Lmain_1485:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1481
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1482:
+    incl -8388636(%rbp)
+    jmp .Lmain_1485
+.Lmain_1481:
+    addq $8, %rsp
+.Lmain_1478:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1496
+    .p2align 4,,10
+.Lmain_1495:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1499:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1500:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1501:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1498:
+    incl -8388636(%rbp)
+.Lmain_1496:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1495
+.Lmain_1497:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1493
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1494:
+    incl -8388636(%rbp)
+    jmp .Lmain_1497
+.Lmain_1493:
+    addq $8, %rsp
+.Lmain_1490:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1508
+    .p2align 4,,10
+.Lmain_1507:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1511:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1512:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1513:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1510:
+    incl -8388636(%rbp)
+.Lmain_1508:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1507
+.Lmain_1509:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1505
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1506:
+    incl -8388636(%rbp)
+    jmp .Lmain_1509
+.Lmain_1505:
+    addq $8, %rsp
+.Lmain_1502:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1519
+    .p2align 4,,10
+.Lmain_1518:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1522:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1523:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1524:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1521:
+    incl -8388636(%rbp)
+.Lmain_1519:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1518
+.Lmain_1520:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1516
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1517:
+    incl -8388636(%rbp)
+    jmp .Lmain_1520
+.Lmain_1516:
+    addq $8, %rsp
+.Lmain_1477:
+    incl -8388632(%rbp)
+.Lmain_1475:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1474
+.Lmain_1476:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1472
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1530
+    .p2align 4,,10
+.Lmain_1529:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1533:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1534:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1535:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1532:
+    incl -8388636(%rbp)
+.Lmain_1530:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1529
+.Lmain_1531:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1527
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1528:
+    incl -8388636(%rbp)
+    jmp .Lmain_1531
+.Lmain_1527:
+    addq $8, %rsp
+.Lmain_1473:
+    incl -8388632(%rbp)
+    jmp .Lmain_1476
+.Lmain_1472:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1469:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1542
+    .p2align 4,,10
+.Lmain_1541:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1551
+    .p2align 4,,10
+.Lmain_1550:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1554:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1555:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1556:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1553:
+    incl -8388636(%rbp)
+.Lmain_1551:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1550
+.Lmain_1552:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1548
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1549:
+    incl -8388636(%rbp)
+    jmp .Lmain_1552
+.Lmain_1548:
+    addq $8, %rsp
+.Lmain_1545:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1563
+    .p2align 4,,10
+.Lmain_1562:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1566:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1567:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1568:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1565:
+    incl -8388636(%rbp)
+.Lmain_1563:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1562
+.Lmain_1564:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1560
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1561:
+    incl -8388636(%rbp)
+    jmp .Lmain_1564
+.Lmain_1560:
+    addq $8, %rsp
+.Lmain_1557:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1575
+    .p2align 4,,10
+.Lmain_1574:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1578:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1579:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1580:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1577:
+    incl -8388636(%rbp)
+.Lmain_1575:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1574
+.Lmain_1576:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1572
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1573:
+    incl -8388636(%rbp)
+    jmp .Lmain_1576
+.Lmain_1572:
+    addq $8, %rsp
+.Lmain_1569:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1586
+    .p2align 4,,10
+.Lmain_1585:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1589:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1590:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1591:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1588:
+    incl -8388636(%rbp)
+.Lmain_1586:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1585
+.Lmain_1587:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1583
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1584:
+    incl -8388636(%rbp)
+    jmp .Lmain_1587
+.Lmain_1583:
+    addq $8, %rsp
+.Lmain_1544:
+    incl -8388632(%rbp)
+.Lmain_1542:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1541
+.Lmain_1543:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1539
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1597
+    .p2align 4,,10
+.Lmain_1596:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1600:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1601:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1602:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1599:
+    incl -8388636(%rbp)
+.Lmain_1597:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1596
+.Lmain_1598:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1594
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1595:
+    incl -8388636(%rbp)
+    jmp .Lmain_1598
+.Lmain_1594:
+    addq $8, %rsp
+.Lmain_1540:
+    incl -8388632(%rbp)
+    jmp .Lmain_1543
+.Lmain_1539:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1536:
+    addl $8, -8388620(%rbp)
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1608
+    .p2align 4,,10
+.Lmain_1607:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1617
+    .p2align 4,,10
+.Lmain_1616:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1620:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1621:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1622:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1619:
+    incl -8388636(%rbp)
+.Lmain_1617:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1616
+.Lmain_1618:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1614
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1615:
+    incl -8388636(%rbp)
+    jmp .Lmain_1618
+.Lmain_1614:
+    addq $8, %rsp
+.Lmain_1611:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1629
+    .p2align 4,,10
+.Lmain_1628:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1632:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1633:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1634:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1631:
+    incl -8388636(%rbp)
+.Lmain_1629:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1628
+.Lmain_1630:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1626
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1627:
+    incl -8388636(%rbp)
+    jmp .Lmain_1630
+.Lmain_1626:
+    addq $8, %rsp
+.Lmain_1623:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1641
+    .p2align 4,,10
+.Lmain_1640:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1644:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1645:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1646:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1643:
+    incl -8388636(%rbp)
+.Lmain_1641:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1640
+.Lmain_1642:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1638
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1639:
+    incl -8388636(%rbp)
+    jmp .Lmain_1642
+.Lmain_1638:
+    addq $8, %rsp
+.Lmain_1635:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1652
+    .p2align 4,,10
+.Lmain_1651:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1655:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1656:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1657:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1654:
+    incl -8388636(%rbp)
+.Lmain_1652:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1651
+.Lmain_1653:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1649
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1650:
+    incl -8388636(%rbp)
+    jmp .Lmain_1653
+.Lmain_1649:
+    addq $8, %rsp
+.Lmain_1610:
+    incl -8388632(%rbp)
+.Lmain_1608:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1607
+.Lmain_1609:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1605
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1663
+    .p2align 4,,10
+.Lmain_1662:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1666:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1667:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1668:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1665:
+    incl -8388636(%rbp)
+.Lmain_1663:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1662
+.Lmain_1664:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1660
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1661:
+    incl -8388636(%rbp)
+    jmp .Lmain_1664
+.Lmain_1660:
+    addq $8, %rsp
+.Lmain_1606:
+    incl -8388632(%rbp)
+    jmp .Lmain_1609
+.Lmain_1605:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1468:
+    addl $8, -8388620(%rbp)
+.Lmain_1466:
+    movslq -8388620(%rbp), %rax
+    addq $16, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1465
+.Lmain_1467:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1463
+    .loc 1 15 14
+    movslq -8388616(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388624(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -8388628(%rbp)
+    .loc 1 15 9
+    movslq -8388616(%rbp), %rax
+    movl %eax, -8388632(%rbp)
+    jmp .Lmain_1674
+    .p2align 4,,10
+.Lmain_1673:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1683
+    .p2align 4,,10
+.Lmain_1682:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1686:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1687:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1688:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1685:
+    incl -8388636(%rbp)
+.Lmain_1683:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1682
+.Lmain_1684:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1680
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1681:
+    incl -8388636(%rbp)
+    jmp .Lmain_1684
+.Lmain_1680:
+    addq $8, %rsp
+.Lmain_1677:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1695
+    .p2align 4,,10
+.Lmain_1694:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1698:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1699:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1700:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1697:
+    incl -8388636(%rbp)
+.Lmain_1695:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1694
+.Lmain_1696:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1692
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1693:
+    incl -8388636(%rbp)
+    jmp .Lmain_1696
+.Lmain_1692:
+    addq $8, %rsp
+.Lmain_1689:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1707
+    .p2align 4,,10
+.Lmain_1706:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1710:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1711:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1712:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1709:
+    incl -8388636(%rbp)
+.Lmain_1707:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1706
+.Lmain_1708:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1704
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1705:
+    incl -8388636(%rbp)
+    jmp .Lmain_1708
+.Lmain_1704:
+    addq $8, %rsp
+.Lmain_1701:
+    incl -8388632(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1718
+    .p2align 4,,10
+.Lmain_1717:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1721:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1722:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1723:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1720:
+    incl -8388636(%rbp)
+.Lmain_1718:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1717
+.Lmain_1719:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1715
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1716:
+    incl -8388636(%rbp)
+    jmp .Lmain_1719
+.Lmain_1715:
+    addq $8, %rsp
+.Lmain_1676:
+    incl -8388632(%rbp)
+.Lmain_1674:
+    movslq -8388632(%rbp), %rax
+    addq $3, %rax
+    movslq -8388624(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1673
+.Lmain_1675:
+    movslq -8388632(%rbp), %rax
+    cmpl -8388624(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1671
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -8388620(%rbp), %rax
+    movl %eax, -8388636(%rbp)
+    jmp .Lmain_1729
+    .p2align 4,,10
+.Lmain_1728:
+    .loc 1 17 17
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1732:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1733:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1734:
+    incl -8388636(%rbp)
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1731:
+    incl -8388636(%rbp)
+.Lmain_1729:
+    movslq -8388636(%rbp), %rax
+    addq $3, %rax
+    movslq -8388628(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1728
+.Lmain_1730:
+    movslq -8388636(%rbp), %rax
+    cmpl -8388628(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1726
+    movslq -8388632(%rbp), %rax
+    push %rax
+    leaq -8388608(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388636(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388636(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388632(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1727:
+    incl -8388636(%rbp)
+    jmp .Lmain_1730
+.Lmain_1726:
+    addq $8, %rsp
+.Lmain_1672:
+    incl -8388632(%rbp)
+    jmp .Lmain_1675
+.Lmain_1671:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1464:
+    addl $8, -8388620(%rbp)
+    jmp .Lmain_1467
+.Lmain_1463:
+    addq $8, %rsp
+.Lmain_907:
+    addl $8, -8388616(%rbp)
+    jmp .Lmain_910
+.Lmain_906:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 9 28
+    incl -8388612(%rbp)
+.Lmain_72:
+    cmpl $4, -8388612(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_71
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388612(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -8388616(%rbp)
+    jmp .Lmain_1740
+    .p2align 4,,10
+.Lmain_1739:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1749
+    .p2align 4,,10
+.Lmain_1748:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1752:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1753:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1754:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1751:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_1749:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1748
+.Lmain_1750:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1746
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1747:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_1750
+.Lmain_1746:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1743:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1761
+    .p2align 4,,10
+.Lmain_1760:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1764:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1765:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1766:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1763:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_1761:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1760
+.Lmain_1762:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1758
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1759:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_1762
+.Lmain_1758:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1755:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1773
+    .p2align 4,,10
+.Lmain_1772:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1776:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1777:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1778:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1775:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_1773:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1772
+.Lmain_1774:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1770
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1771:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_1774
+.Lmain_1770:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1767:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1784
+    .p2align 4,,10
+.Lmain_1783:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1787:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1788:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1789:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1786:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_1784:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1783
+.Lmain_1785:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1781
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1782:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_1785
+.Lmain_1781:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1742:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+.Lmain_1740:
+    movslq -8388616(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1739
+.Lmain_1741:
+    cmpl $1024, -8388616(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1737
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -8388620(%rbp)
+    jmp .Lmain_1795
+    .p2align 4,,10
+.Lmain_1794:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1798:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1799:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1800:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1797:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+.Lmain_1795:
+    movslq -8388620(%rbp), %rax
+    addq $3, %rax
+    cmpq $1024, %rax
+    jl .Lmain_1794
+.Lmain_1796:
+    cmpl $1024, -8388620(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1792
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -8388620(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -8388616(%rbp), %rax
+    push %rax
+    leaq -4194304(%rbp), %rax
+    pop %rbx
+    shlq $12, %rbx
+    add %rbx, %rax
+    movslq -8388620(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -8388612(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -8388612(%rbp)
+    addq $0, %rsp
+.Lmain_1793:
+    .loc 1 23 35
+    incl -8388620(%rbp)
+    jmp .Lmain_1796
+.Lmain_1792:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1738:
+    .loc 1 22 31
+    incl -8388616(%rbp)
+    jmp .Lmain_1741
+.Lmain_1737:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -8388612(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,3374 @@
+    .file 1 "bench/kernels/trans_2048.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $16777216, %rsp
+    .loc 1 3 5
+    subq $16777216, %rsp
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554436(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_15:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_27:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_39
+    .p2align 4,,10
+.Lmain_38:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_39:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_50:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+.Lmain_6:
+    movslq -33554436(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $2048, -33554436(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_61:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554436(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_76
+    .p2align 4,,10
+.Lmain_75:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_85
+    .p2align 4,,10
+.Lmain_84:
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_88:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_89:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_90:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_87:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+.Lmain_85:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_84
+.Lmain_86:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_82
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_83:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    jmp .Lmain_86
+.Lmain_82:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_79:
+    .loc 1 10 35
+    incl -33554440(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_97
+    .p2align 4,,10
+.Lmain_96:
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_100:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_101:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_102:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_99:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+.Lmain_97:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_96
+.Lmain_98:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_94
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_95:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    jmp .Lmain_98
+.Lmain_94:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_91:
+    .loc 1 10 35
+    incl -33554440(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_109
+    .p2align 4,,10
+.Lmain_108:
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_112:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_113:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_114:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_111:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+.Lmain_109:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_108
+.Lmain_110:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_106
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_107:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    jmp .Lmain_110
+.Lmain_106:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_103:
+    .loc 1 10 35
+    incl -33554440(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_120
+    .p2align 4,,10
+.Lmain_119:
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_123:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_124:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_125:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_122:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+.Lmain_120:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_119
+.Lmain_121:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_117
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_118:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    jmp .Lmain_121
+.Lmain_117:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_78:
+    .loc 1 10 35
+    incl -33554440(%rbp)
+.Lmain_76:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_75
+.Lmain_77:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_73
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_131
+    .p2align 4,,10
+.Lmain_130:
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_134:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_135:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_136:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_133:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+.Lmain_131:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_130
+.Lmain_132:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_128
+    .loc 1 12 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_129:
+    .loc 1 11 39
+    incl -33554444(%rbp)
+    jmp .Lmain_132
+.Lmain_128:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_74:
+    .loc 1 10 35
+    incl -33554440(%rbp)
+    jmp .Lmain_77
+.Lmain_73:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_142
+    .p2align 4,,10
+.Lmain_141:
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_151
+    .p2align 4,,10
+.Lmain_150:
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_154:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_155:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_156:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_153:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+.Lmain_151:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_150
+.Lmain_152:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_148
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_149:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    jmp .Lmain_152
+.Lmain_148:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_145:
+    .loc 1 15 35
+    incl -33554440(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_163
+    .p2align 4,,10
+.Lmain_162:
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_166:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_167:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_168:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_165:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+.Lmain_163:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_162
+.Lmain_164:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_160
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_161:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    jmp .Lmain_164
+.Lmain_160:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_157:
+    .loc 1 15 35
+    incl -33554440(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_175
+    .p2align 4,,10
+.Lmain_174:
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_178:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_179:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_177:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+.Lmain_175:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_174
+.Lmain_176:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_172
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_173:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    jmp .Lmain_176
+.Lmain_172:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_169:
+    .loc 1 15 35
+    incl -33554440(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_186
+    .p2align 4,,10
+.Lmain_185:
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_189:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_190:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_191:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_188:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+.Lmain_186:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_185
+.Lmain_187:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_183
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_184:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    jmp .Lmain_187
+.Lmain_183:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_144:
+    .loc 1 15 35
+    incl -33554440(%rbp)
+.Lmain_142:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_141
+.Lmain_143:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_139
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_197
+    .p2align 4,,10
+.Lmain_196:
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_200:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_201:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_202:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_199:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+.Lmain_197:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_196
+.Lmain_198:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_194
+    .loc 1 17 17
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_195:
+    .loc 1 16 39
+    incl -33554444(%rbp)
+    jmp .Lmain_198
+.Lmain_194:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_140:
+    .loc 1 15 35
+    incl -33554440(%rbp)
+    jmp .Lmain_143
+.Lmain_139:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 9 28
+    incl -33554436(%rbp)
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554436(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_208
+    .p2align 4,,10
+.Lmain_207:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_217
+    .p2align 4,,10
+.Lmain_216:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_220:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_221:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_222:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_219:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_217:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_216
+.Lmain_218:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_214
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_215:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_218
+.Lmain_214:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_211:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_229
+    .p2align 4,,10
+.Lmain_228:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_232:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_233:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_231:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_229:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_228
+.Lmain_230:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_226
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_227:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_230
+.Lmain_226:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_223:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_241
+    .p2align 4,,10
+.Lmain_240:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_244:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_245:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_246:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_243:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_241:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_240
+.Lmain_242:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_238
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_239:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_242
+.Lmain_238:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_235:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_252
+    .p2align 4,,10
+.Lmain_251:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_255:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_256:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_257:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_254:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_252:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_251
+.Lmain_253:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_249
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_250:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_253
+.Lmain_249:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_210:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+.Lmain_208:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_207
+.Lmain_209:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_205
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_263
+    .p2align 4,,10
+.Lmain_262:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_266:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_267:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_265:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_263:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_262
+.Lmain_264:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_260
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_261:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_264
+.Lmain_260:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_206:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+    jmp .Lmain_209
+.Lmain_205:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
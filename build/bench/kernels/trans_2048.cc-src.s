@@ -0,0 +1,20181 @@
+    .file 1 "bench/kernels/trans_2048.c"
+.globl main
+.type main, @function
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $16777216, %rsp
+    .loc 1 3 5
+    subq $16777216, %rsp
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554436(%rbp)
+    jmp .Lmain_6
+.Lmain_5:
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_15
+.Lmain_14:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_15:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_27
+.Lmain_26:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_27:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_39
+.Lmain_38:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_39:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_50
+.Lmain_49:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_50:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+.Lmain_6:
+    movslq -33554436(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $2048, -33554436(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_61
+.Lmain_60:
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+.Lmain_61:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 6 13
+    movslq -33554436(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -33554440(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554440(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 5 35
+    incl -33554440(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 31
+    incl -33554436(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554436(%rbp)
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_76
+.Lmain_75:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_85
+.Lmain_84:
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_94
+.Lmain_93:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_103
+.Lmain_102:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_106:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_107:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_108:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_105:
+    incl -33554460(%rbp)
+.Lmain_103:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_102
+.Lmain_104:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_100
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_101:
+    incl -33554460(%rbp)
+    jmp .Lmain_104
+.Lmain_100:
+    addq $8, %rsp
+.Lmain_97:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_115
+.Lmain_114:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_118:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_119:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_120:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_117:
+    incl -33554460(%rbp)
+.Lmain_115:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_114
+.Lmain_116:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_112
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_113:
+    incl -33554460(%rbp)
+    jmp .Lmain_116
+.Lmain_112:
+    addq $8, %rsp
+.Lmain_109:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_127
+.Lmain_126:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_130:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_131:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_132:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_129:
+    incl -33554460(%rbp)
+.Lmain_127:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_126
+.Lmain_128:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_124
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_125:
+    incl -33554460(%rbp)
+    jmp .Lmain_128
+.Lmain_124:
+    addq $8, %rsp
+.Lmain_121:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_138
+.Lmain_137:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_141:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_142:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_143:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_140:
+    incl -33554460(%rbp)
+.Lmain_138:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_137
+.Lmain_139:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_135
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_136:
+    incl -33554460(%rbp)
+    jmp .Lmain_139
+.Lmain_135:
+    addq $8, %rsp
+.Lmain_96:
+    incl -33554456(%rbp)
+.Lmain_94:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_93
+.Lmain_95:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_91
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_149
+.Lmain_148:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_152:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_153:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_154:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_151:
+    incl -33554460(%rbp)
+.Lmain_149:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_148
+.Lmain_150:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_146
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_147:
+    incl -33554460(%rbp)
+    jmp .Lmain_150
+.Lmain_146:
+    addq $8, %rsp
+.Lmain_92:
+    incl -33554456(%rbp)
+    jmp .Lmain_95
+.Lmain_91:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_88:
+    addl $8, -33554444(%rbp)
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_161
+.Lmain_160:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_170
+.Lmain_169:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_173:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_174:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_175:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_172:
+    incl -33554460(%rbp)
+.Lmain_170:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_169
+.Lmain_171:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_167
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_168:
+    incl -33554460(%rbp)
+    jmp .Lmain_171
+.Lmain_167:
+    addq $8, %rsp
+.Lmain_164:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_182
+.Lmain_181:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_185:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_186:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_187:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_184:
+    incl -33554460(%rbp)
+.Lmain_182:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_181
+.Lmain_183:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_179
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_180:
+    incl -33554460(%rbp)
+    jmp .Lmain_183
+.Lmain_179:
+    addq $8, %rsp
+.Lmain_176:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_194
+.Lmain_193:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_197:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_198:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_199:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_196:
+    incl -33554460(%rbp)
+.Lmain_194:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_193
+.Lmain_195:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_191
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_192:
+    incl -33554460(%rbp)
+    jmp .Lmain_195
+.Lmain_191:
+    addq $8, %rsp
+.Lmain_188:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_205
+.Lmain_204:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_208:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_209:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_210:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_207:
+    incl -33554460(%rbp)
+.Lmain_205:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_204
+.Lmain_206:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_202
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_203:
+    incl -33554460(%rbp)
+    jmp .Lmain_206
+.Lmain_202:
+    addq $8, %rsp
+.Lmain_163:
+    incl -33554456(%rbp)
+.Lmain_161:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_160
+.Lmain_162:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_158
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_216
+.Lmain_215:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_219:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_220:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_221:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_218:
+    incl -33554460(%rbp)
+.Lmain_216:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_215
+.Lmain_217:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_213
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_214:
+    incl -33554460(%rbp)
+    jmp .Lmain_217
+.Lmain_213:
+    addq $8, %rsp
+.Lmain_159:
+    incl -33554456(%rbp)
+    jmp .Lmain_162
+.Lmain_158:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_155:
+    addl $8, -33554444(%rbp)
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_227
+.Lmain_226:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_236
+.Lmain_235:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_239:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_240:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_241:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_238:
+    incl -33554460(%rbp)
+.Lmain_236:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_235
+.Lmain_237:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_233
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_234:
+    incl -33554460(%rbp)
+    jmp .Lmain_237
+.Lmain_233:
+    addq $8, %rsp
+.Lmain_230:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_248
+.Lmain_247:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_251:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_252:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_253:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_250:
+    incl -33554460(%rbp)
+.Lmain_248:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_247
+.Lmain_249:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_245
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_246:
+    incl -33554460(%rbp)
+    jmp .Lmain_249
+.Lmain_245:
+    addq $8, %rsp
+.Lmain_242:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_260
+.Lmain_259:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_263:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_264:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_265:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_262:
+    incl -33554460(%rbp)
+.Lmain_260:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_259
+.Lmain_261:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_257
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_258:
+    incl -33554460(%rbp)
+    jmp .Lmain_261
+.Lmain_257:
+    addq $8, %rsp
+.Lmain_254:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_271
+.Lmain_270:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_274:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_275:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_276:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_273:
+    incl -33554460(%rbp)
+.Lmain_271:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_270
+.Lmain_272:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_268
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_269:
+    incl -33554460(%rbp)
+    jmp .Lmain_272
+.Lmain_268:
+    addq $8, %rsp
+.Lmain_229:
+    incl -33554456(%rbp)
+.Lmain_227:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_226
+.Lmain_228:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_224
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_282
+.Lmain_281:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_285:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_286:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_287:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_284:
+    incl -33554460(%rbp)
+.Lmain_282:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_281
+.Lmain_283:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_279
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_280:
+    incl -33554460(%rbp)
+    jmp .Lmain_283
+.Lmain_279:
+    addq $8, %rsp
+.Lmain_225:
+    incl -33554456(%rbp)
+    jmp .Lmain_228
+.Lmain_224:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_87:
+    addl $8, -33554444(%rbp)
+.Lmain_85:
+    movslq -33554444(%rbp), %rax
+    addq $16, %rax
+    cmpq $2048, %rax
+    jl .Lmain_84
+.Lmain_86:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_82
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_293
+.Lmain_292:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_302
+.Lmain_301:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_305:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_306:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_307:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_304:
+    incl -33554460(%rbp)
+.Lmain_302:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_301
+.Lmain_303:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_299
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_300:
+    incl -33554460(%rbp)
+    jmp .Lmain_303
+.Lmain_299:
+    addq $8, %rsp
+.Lmain_296:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_314
+.Lmain_313:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_317:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_318:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_319:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_316:
+    incl -33554460(%rbp)
+.Lmain_314:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_313
+.Lmain_315:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_311
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_312:
+    incl -33554460(%rbp)
+    jmp .Lmain_315
+.Lmain_311:
+    addq $8, %rsp
+.Lmain_308:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_326
+.Lmain_325:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_329:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_330:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_331:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_328:
+    incl -33554460(%rbp)
+.Lmain_326:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_325
+.Lmain_327:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_323
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_324:
+    incl -33554460(%rbp)
+    jmp .Lmain_327
+.Lmain_323:
+    addq $8, %rsp
+.Lmain_320:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_337
+.Lmain_336:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_340:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_341:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_342:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_339:
+    incl -33554460(%rbp)
+.Lmain_337:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_336
+.Lmain_338:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_334
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_335:
+    incl -33554460(%rbp)
+    jmp .Lmain_338
+.Lmain_334:
+    addq $8, %rsp
+.Lmain_295:
+    incl -33554456(%rbp)
+.Lmain_293:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_292
+.Lmain_294:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_290
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_348
+.Lmain_347:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_351:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_352:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_353:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_350:
+    incl -33554460(%rbp)
+.Lmain_348:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_347
+.Lmain_349:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_345
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_346:
+    incl -33554460(%rbp)
+    jmp .Lmain_349
+.Lmain_345:
+    addq $8, %rsp
+.Lmain_291:
+    incl -33554456(%rbp)
+    jmp .Lmain_294
+.Lmain_290:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_83:
+    addl $8, -33554444(%rbp)
+    jmp .Lmain_86
+.Lmain_82:
+    addq $8, %rsp
+.Lmain_79:
+    addl $8, -33554440(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_359
+.Lmain_358:
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_368
+.Lmain_367:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_377
+.Lmain_376:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_380:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_381:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_382:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_379:
+    incl -33554460(%rbp)
+.Lmain_377:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_376
+.Lmain_378:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_374
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_375:
+    incl -33554460(%rbp)
+    jmp .Lmain_378
+.Lmain_374:
+    addq $8, %rsp
+.Lmain_371:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_389
+.Lmain_388:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_392:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_393:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_394:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_391:
+    incl -33554460(%rbp)
+.Lmain_389:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_388
+.Lmain_390:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_386
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_387:
+    incl -33554460(%rbp)
+    jmp .Lmain_390
+.Lmain_386:
+    addq $8, %rsp
+.Lmain_383:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_401
+.Lmain_400:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_404:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_405:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_406:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_403:
+    incl -33554460(%rbp)
+.Lmain_401:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_400
+.Lmain_402:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_398
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_399:
+    incl -33554460(%rbp)
+    jmp .Lmain_402
+.Lmain_398:
+    addq $8, %rsp
+.Lmain_395:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_412
+.Lmain_411:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_415:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_416:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_417:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_414:
+    incl -33554460(%rbp)
+.Lmain_412:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_411
+.Lmain_413:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_409
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_410:
+    incl -33554460(%rbp)
+    jmp .Lmain_413
+.Lmain_409:
+    addq $8, %rsp
+.Lmain_370:
+    incl -33554456(%rbp)
+.Lmain_368:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_367
+.Lmain_369:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_365
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_423
+.Lmain_422:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_426:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_427:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_428:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_425:
+    incl -33554460(%rbp)
+.Lmain_423:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_422
+.Lmain_424:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_420
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_421:
+    incl -33554460(%rbp)
+    jmp .Lmain_424
+.Lmain_420:
+    addq $8, %rsp
+.Lmain_366:
+    incl -33554456(%rbp)
+    jmp .Lmain_369
+.Lmain_365:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_362:
+    addl $8, -33554444(%rbp)
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_435
+.Lmain_434:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_444
+.Lmain_443:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_447:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_448:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_449:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_446:
+    incl -33554460(%rbp)
+.Lmain_444:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_443
+.Lmain_445:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_441
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_442:
+    incl -33554460(%rbp)
+    jmp .Lmain_445
+.Lmain_441:
+    addq $8, %rsp
+.Lmain_438:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_456
+.Lmain_455:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_459:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_460:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_461:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_458:
+    incl -33554460(%rbp)
+.Lmain_456:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_455
+.Lmain_457:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_453
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_454:
+    incl -33554460(%rbp)
+    jmp .Lmain_457
+.Lmain_453:
+    addq $8, %rsp
+.Lmain_450:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_468
+.Lmain_467:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_471:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_472:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_473:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_470:
+    incl -33554460(%rbp)
+.Lmain_468:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_467
+.Lmain_469:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_465
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_466:
+    incl -33554460(%rbp)
+    jmp .Lmain_469
+.Lmain_465:
+    addq $8, %rsp
+.Lmain_462:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_479
+.Lmain_478:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_482:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_483:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_484:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_481:
+    incl -33554460(%rbp)
+.Lmain_479:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_478
+.Lmain_480:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_476
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_477:
+    incl -33554460(%rbp)
+    jmp .Lmain_480
+.Lmain_476:
+    addq $8, %rsp
+.Lmain_437:
+    incl -33554456(%rbp)
+.Lmain_435:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_434
+.Lmain_436:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_432
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_490
+.Lmain_489:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_493:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_494:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_495:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_492:
+    incl -33554460(%rbp)
+.Lmain_490:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_489
+.Lmain_491:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_487
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_488:
+    incl -33554460(%rbp)
+    jmp .Lmain_491
+.Lmain_487:
+    addq $8, %rsp
+.Lmain_433:
+    incl -33554456(%rbp)
+    jmp .Lmain_436
+.Lmain_432:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_429:
+    addl $8, -33554444(%rbp)
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_501
+.Lmain_500:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_510
+.Lmain_509:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_513:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_514:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_515:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_512:
+    incl -33554460(%rbp)
+.Lmain_510:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_509
+.Lmain_511:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_507
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_508:
+    incl -33554460(%rbp)
+    jmp .Lmain_511
+.Lmain_507:
+    addq $8, %rsp
+.Lmain_504:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_522
+.Lmain_521:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_525:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_526:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_527:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_524:
+    incl -33554460(%rbp)
+.Lmain_522:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_521
+.Lmain_523:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_519
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_520:
+    incl -33554460(%rbp)
+    jmp .Lmain_523
+.Lmain_519:
+    addq $8, %rsp
+.Lmain_516:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_534
+.Lmain_533:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_537:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_538:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_539:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_536:
+    incl -33554460(%rbp)
+.Lmain_534:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_533
+.Lmain_535:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_531
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_532:
+    incl -33554460(%rbp)
+    jmp .Lmain_535
+.Lmain_531:
+    addq $8, %rsp
+.Lmain_528:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_545
+.Lmain_544:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_548:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_549:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_550:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_547:
+    incl -33554460(%rbp)
+.Lmain_545:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_544
+.Lmain_546:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_542
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_543:
+    incl -33554460(%rbp)
+    jmp .Lmain_546
+.Lmain_542:
+    addq $8, %rsp
+.Lmain_503:
+    incl -33554456(%rbp)
+.Lmain_501:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_500
+.Lmain_502:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_498
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_556
+.Lmain_555:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_559:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_560:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_561:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_558:
+    incl -33554460(%rbp)
+.Lmain_556:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_555
+.Lmain_557:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_553
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_554:
+    incl -33554460(%rbp)
+    jmp .Lmain_557
+.Lmain_553:
+    addq $8, %rsp
+.Lmain_499:
+    incl -33554456(%rbp)
+    jmp .Lmain_502
+.Lmain_498:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_361:
+    addl $8, -33554444(%rbp)
+.Lmain_359:
+    movslq -33554444(%rbp), %rax
+    addq $16, %rax
+    cmpq $2048, %rax
+    jl .Lmain_358
+.Lmain_360:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_356
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_567
+.Lmain_566:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_576
+.Lmain_575:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_579:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_580:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_581:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_578:
+    incl -33554460(%rbp)
+.Lmain_576:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_575
+.Lmain_577:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_573
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_574:
+    incl -33554460(%rbp)
+    jmp .Lmain_577
+.Lmain_573:
+    addq $8, %rsp
+.Lmain_570:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_588
+.Lmain_587:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_591:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_592:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_593:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_590:
+    incl -33554460(%rbp)
+.Lmain_588:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_587
+.Lmain_589:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_585
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_586:
+    incl -33554460(%rbp)
+    jmp .Lmain_589
+.Lmain_585:
+    addq $8, %rsp
+.Lmain_582:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_600
+.Lmain_599:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_603:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_604:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_605:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_602:
+    incl -33554460(%rbp)
+.Lmain_600:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_599
+.Lmain_601:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_597
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_598:
+    incl -33554460(%rbp)
+    jmp .Lmain_601
+.Lmain_597:
+    addq $8, %rsp
+.Lmain_594:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_611
+.Lmain_610:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_614:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_615:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_616:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_613:
+    incl -33554460(%rbp)
+.Lmain_611:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_610
+.Lmain_612:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_608
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_609:
+    incl -33554460(%rbp)
+    jmp .Lmain_612
+.Lmain_608:
+    addq $8, %rsp
+.Lmain_569:
+    incl -33554456(%rbp)
+.Lmain_567:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_566
+.Lmain_568:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_564
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_622
+.Lmain_621:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_625:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_626:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_627:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_624:
+    incl -33554460(%rbp)
+.Lmain_622:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_621
+.Lmain_623:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_619
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_620:
+    incl -33554460(%rbp)
+    jmp .Lmain_623
+.Lmain_619:
+    addq $8, %rsp
+.Lmain_565:
+    incl -33554456(%rbp)
+    jmp .Lmain_568
+.Lmain_564:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_357:
+    addl $8, -33554444(%rbp)
+    jmp .Lmain_360
+.Lmain_356:
+    addq $8, %rsp
+.Lmain_78:
+    addl $8, -33554440(%rbp)
+.Lmain_76:
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    cmpq $2048, %rax
+    jl .Lmain_75
+.Lmain_77:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_73
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_633
+.Lmain_632:
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_642
+.Lmain_641:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_651
+.Lmain_650:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_654:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_655:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_656:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_653:
+    incl -33554460(%rbp)
+.Lmain_651:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_650
+.Lmain_652:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_648
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_649:
+    incl -33554460(%rbp)
+    jmp .Lmain_652
+.Lmain_648:
+    addq $8, %rsp
+.Lmain_645:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_663
+.Lmain_662:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_666:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_667:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_668:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_665:
+    incl -33554460(%rbp)
+.Lmain_663:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_662
+.Lmain_664:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_660
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_661:
+    incl -33554460(%rbp)
+    jmp .Lmain_664
+.Lmain_660:
+    addq $8, %rsp
+.Lmain_657:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_675
+.Lmain_674:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_678:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_679:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_680:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_677:
+    incl -33554460(%rbp)
+.Lmain_675:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_674
+.Lmain_676:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_672
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_673:
+    incl -33554460(%rbp)
+    jmp .Lmain_676
+.Lmain_672:
+    addq $8, %rsp
+.Lmain_669:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_686
+.Lmain_685:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_689:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_690:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_691:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_688:
+    incl -33554460(%rbp)
+.Lmain_686:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_685
+.Lmain_687:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_683
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_684:
+    incl -33554460(%rbp)
+    jmp .Lmain_687
+.Lmain_683:
+    addq $8, %rsp
+.Lmain_644:
+    incl -33554456(%rbp)
+.Lmain_642:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_641
+.Lmain_643:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_639
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_697
+.Lmain_696:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_700:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_701:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_702:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_699:
+    incl -33554460(%rbp)
+.Lmain_697:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_696
+.Lmain_698:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_694
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_695:
+    incl -33554460(%rbp)
+    jmp .Lmain_698
+.Lmain_694:
+    addq $8, %rsp
+.Lmain_640:
+    incl -33554456(%rbp)
+    jmp .Lmain_643
+.Lmain_639:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_636:
+    addl $8, -33554444(%rbp)
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_709
+.Lmain_708:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_718
+.Lmain_717:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_721:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_722:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_723:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_720:
+    incl -33554460(%rbp)
+.Lmain_718:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_717
+.Lmain_719:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_715
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_716:
+    incl -33554460(%rbp)
+    jmp .Lmain_719
+.Lmain_715:
+    addq $8, %rsp
+.Lmain_712:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_730
+.Lmain_729:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_733:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_734:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_735:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_732:
+    incl -33554460(%rbp)
+.Lmain_730:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_729
+.Lmain_731:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_727
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_728:
+    incl -33554460(%rbp)
+    jmp .Lmain_731
+.Lmain_727:
+    addq $8, %rsp
+.Lmain_724:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_742
+.Lmain_741:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_745:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_746:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_747:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_744:
+    incl -33554460(%rbp)
+.Lmain_742:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_741
+.Lmain_743:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_739
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_740:
+    incl -33554460(%rbp)
+    jmp .Lmain_743
+.Lmain_739:
+    addq $8, %rsp
+.Lmain_736:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_753
+.Lmain_752:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_756:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_757:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_758:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_755:
+    incl -33554460(%rbp)
+.Lmain_753:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_752
+.Lmain_754:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_750
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_751:
+    incl -33554460(%rbp)
+    jmp .Lmain_754
+.Lmain_750:
+    addq $8, %rsp
+.Lmain_711:
+    incl -33554456(%rbp)
+.Lmain_709:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_708
+.Lmain_710:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_706
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_764
+.Lmain_763:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_767:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_768:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_769:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_766:
+    incl -33554460(%rbp)
+.Lmain_764:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_763
+.Lmain_765:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_761
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_762:
+    incl -33554460(%rbp)
+    jmp .Lmain_765
+.Lmain_761:
+    addq $8, %rsp
+.Lmain_707:
+    incl -33554456(%rbp)
+    jmp .Lmain_710
+.Lmain_706:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_703:
+    addl $8, -33554444(%rbp)
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_775
+.Lmain_774:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_784
+.Lmain_783:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_787:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_788:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_789:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_786:
+    incl -33554460(%rbp)
+.Lmain_784:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_783
+.Lmain_785:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_781
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_782:
+    incl -33554460(%rbp)
+    jmp .Lmain_785
+.Lmain_781:
+    addq $8, %rsp
+.Lmain_778:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_796
+.Lmain_795:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_799:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_800:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_801:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_798:
+    incl -33554460(%rbp)
+.Lmain_796:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_795
+.Lmain_797:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_793
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_794:
+    incl -33554460(%rbp)
+    jmp .Lmain_797
+.Lmain_793:
+    addq $8, %rsp
+.Lmain_790:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_808
+.Lmain_807:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_811:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_812:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_813:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_810:
+    incl -33554460(%rbp)
+.Lmain_808:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_807
+.Lmain_809:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_805
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_806:
+    incl -33554460(%rbp)
+    jmp .Lmain_809
+.Lmain_805:
+    addq $8, %rsp
+.Lmain_802:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_819
+.Lmain_818:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_822:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_823:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_824:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_821:
+    incl -33554460(%rbp)
+.Lmain_819:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_818
+.Lmain_820:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_816
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_817:
+    incl -33554460(%rbp)
+    jmp .Lmain_820
+.Lmain_816:
+    addq $8, %rsp
+.Lmain_777:
+    incl -33554456(%rbp)
+.Lmain_775:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_774
+.Lmain_776:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_772
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_830
+.Lmain_829:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_833:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_834:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_835:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_832:
+    incl -33554460(%rbp)
+.Lmain_830:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_829
+.Lmain_831:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_827
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_828:
+    incl -33554460(%rbp)
+    jmp .Lmain_831
+.Lmain_827:
+    addq $8, %rsp
+.Lmain_773:
+    incl -33554456(%rbp)
+    jmp .Lmain_776
+.Lmain_772:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_635:
+    addl $8, -33554444(%rbp)
+.Lmain_633:
+    movslq -33554444(%rbp), %rax
+    addq $16, %rax
+    cmpq $2048, %rax
+    jl .Lmain_632
+.Lmain_634:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_630
+    .loc 1 10 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 11 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 10 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_841
+.Lmain_840:
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_850
+.Lmain_849:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_853:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_854:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_855:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_852:
+    incl -33554460(%rbp)
+.Lmain_850:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_849
+.Lmain_851:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_847
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_848:
+    incl -33554460(%rbp)
+    jmp .Lmain_851
+.Lmain_847:
+    addq $8, %rsp
+.Lmain_844:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_862
+.Lmain_861:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_865:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_866:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_867:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_864:
+    incl -33554460(%rbp)
+.Lmain_862:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_861
+.Lmain_863:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_859
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_860:
+    incl -33554460(%rbp)
+    jmp .Lmain_863
+.Lmain_859:
+    addq $8, %rsp
+.Lmain_856:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_874
+.Lmain_873:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_877:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_878:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_879:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_876:
+    incl -33554460(%rbp)
+.Lmain_874:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_873
+.Lmain_875:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_871
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_872:
+    incl -33554460(%rbp)
+    jmp .Lmain_875
+.Lmain_871:
+    addq $8, %rsp
+.Lmain_868:
+    incl -33554456(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_885
+.Lmain_884:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_888:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_889:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_890:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_887:
+    incl -33554460(%rbp)
+.Lmain_885:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_884
+.Lmain_886:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_882
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_883:
+    incl -33554460(%rbp)
+    jmp .Lmain_886
+.Lmain_882:
+    addq $8, %rsp
+.Lmain_843:
+    incl -33554456(%rbp)
+.Lmain_841:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_840
+.Lmain_842:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_838
+    .loc 1 11 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_896
+.Lmain_895:
+    .loc 1 12 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_899:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_900:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_901:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_898:
+    incl -33554460(%rbp)
+.Lmain_896:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_895
+.Lmain_897:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_893
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_894:
+    incl -33554460(%rbp)
+    jmp .Lmain_897
+.Lmain_893:
+    addq $8, %rsp
+.Lmain_839:
+    incl -33554456(%rbp)
+    jmp .Lmain_842
+.Lmain_838:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_631:
+    addl $8, -33554444(%rbp)
+    jmp .Lmain_634
+.Lmain_630:
+    addq $8, %rsp
+.Lmain_74:
+    addl $8, -33554440(%rbp)
+    jmp .Lmain_77
+.Lmain_73:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_907
+.Lmain_906:
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_916
+.Lmain_915:
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_925
+.Lmain_924:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_934
+.Lmain_933:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_937:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_938:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_939:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_936:
+    incl -33554460(%rbp)
+.Lmain_934:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_933
+.Lmain_935:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_931
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_932:
+    incl -33554460(%rbp)
+    jmp .Lmain_935
+.Lmain_931:
+    addq $8, %rsp
+.Lmain_928:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_946
+.Lmain_945:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_949:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_950:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_951:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_948:
+    incl -33554460(%rbp)
+.Lmain_946:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_945
+.Lmain_947:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_943
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_944:
+    incl -33554460(%rbp)
+    jmp .Lmain_947
+.Lmain_943:
+    addq $8, %rsp
+.Lmain_940:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_958
+.Lmain_957:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_961:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_962:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_963:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_960:
+    incl -33554460(%rbp)
+.Lmain_958:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_957
+.Lmain_959:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_955
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_956:
+    incl -33554460(%rbp)
+    jmp .Lmain_959
+.Lmain_955:
+    addq $8, %rsp
+.Lmain_952:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_969
+.Lmain_968:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_972:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_973:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_974:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_971:
+    incl -33554460(%rbp)
+.Lmain_969:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_968
+.Lmain_970:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_966
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_967:
+    incl -33554460(%rbp)
+    jmp .Lmain_970
+.Lmain_966:
+    addq $8, %rsp
+.Lmain_927:
+    incl -33554456(%rbp)
+.Lmain_925:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_924
+.Lmain_926:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_922
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_980
+.Lmain_979:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_983:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_984:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_985:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_982:
+    incl -33554460(%rbp)
+.Lmain_980:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_979
+.Lmain_981:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_977
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_978:
+    incl -33554460(%rbp)
+    jmp .Lmain_981
+.Lmain_977:
+    addq $8, %rsp
+.Lmain_923:
+    incl -33554456(%rbp)
+    jmp .Lmain_926
+.Lmain_922:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_919:
+    addl $8, -33554444(%rbp)
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_992
+.Lmain_991:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1001
+.Lmain_1000:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1004:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1005:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1006:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1003:
+    incl -33554460(%rbp)
+.Lmain_1001:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1000
+.Lmain_1002:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_998
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_999:
+    incl -33554460(%rbp)
+    jmp .Lmain_1002
+.Lmain_998:
+    addq $8, %rsp
+.Lmain_995:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1013
+.Lmain_1012:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1016:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1017:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1018:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1015:
+    incl -33554460(%rbp)
+.Lmain_1013:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1012
+.Lmain_1014:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1010
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1011:
+    incl -33554460(%rbp)
+    jmp .Lmain_1014
+.Lmain_1010:
+    addq $8, %rsp
+.Lmain_1007:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1025
+.Lmain_1024:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1028:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1029:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1030:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1027:
+    incl -33554460(%rbp)
+.Lmain_1025:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1024
+.Lmain_1026:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1022
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1023:
+    incl -33554460(%rbp)
+    jmp .Lmain_1026
+.Lmain_1022:
+    addq $8, %rsp
+.Lmain_1019:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1036
+.Lmain_1035:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1039:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1040:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1041:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1038:
+    incl -33554460(%rbp)
+.Lmain_1036:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1035
+.Lmain_1037:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1033
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1034:
+    incl -33554460(%rbp)
+    jmp .Lmain_1037
+.Lmain_1033:
+    addq $8, %rsp
+.Lmain_994:
+    incl -33554456(%rbp)
+.Lmain_992:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_991
+.Lmain_993:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_989
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1047
+.Lmain_1046:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1050:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1051:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1052:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1049:
+    incl -33554460(%rbp)
+.Lmain_1047:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1046
+.Lmain_1048:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1044
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1045:
+    incl -33554460(%rbp)
+    jmp .Lmain_1048
+.Lmain_1044:
+    addq $8, %rsp
+.Lmain_990:
+    incl -33554456(%rbp)
+    jmp .Lmain_993
+.Lmain_989:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_986:
+    addl $8, -33554444(%rbp)
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1058
+.Lmain_1057:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1067
+.Lmain_1066:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1070:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1071:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1072:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1069:
+    incl -33554460(%rbp)
+.Lmain_1067:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1066
+.Lmain_1068:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1064
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1065:
+    incl -33554460(%rbp)
+    jmp .Lmain_1068
+.Lmain_1064:
+    addq $8, %rsp
+.Lmain_1061:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1079
+.Lmain_1078:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1082:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1083:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1084:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1081:
+    incl -33554460(%rbp)
+.Lmain_1079:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1078
+.Lmain_1080:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1076
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1077:
+    incl -33554460(%rbp)
+    jmp .Lmain_1080
+.Lmain_1076:
+    addq $8, %rsp
+.Lmain_1073:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1091
+.Lmain_1090:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1094:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1095:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1096:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1093:
+    incl -33554460(%rbp)
+.Lmain_1091:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1090
+.Lmain_1092:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1088
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1089:
+    incl -33554460(%rbp)
+    jmp .Lmain_1092
+.Lmain_1088:
+    addq $8, %rsp
+.Lmain_1085:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1102
+.Lmain_1101:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1105:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1106:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1107:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1104:
+    incl -33554460(%rbp)
+.Lmain_1102:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1101
+.Lmain_1103:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1099
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1100:
+    incl -33554460(%rbp)
+    jmp .Lmain_1103
+.Lmain_1099:
+    addq $8, %rsp
+.Lmain_1060:
+    incl -33554456(%rbp)
+.Lmain_1058:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1057
+.Lmain_1059:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1055
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1113
+.Lmain_1112:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1116:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1117:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1118:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1115:
+    incl -33554460(%rbp)
+.Lmain_1113:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1112
+.Lmain_1114:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1110
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1111:
+    incl -33554460(%rbp)
+    jmp .Lmain_1114
+.Lmain_1110:
+    addq $8, %rsp
+.Lmain_1056:
+    incl -33554456(%rbp)
+    jmp .Lmain_1059
+.Lmain_1055:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_918:
+    addl $8, -33554444(%rbp)
+.Lmain_916:
+    movslq -33554444(%rbp), %rax
+    addq $16, %rax
+    cmpq $2048, %rax
+    jl .Lmain_915
+.Lmain_917:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_913
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1124
+.Lmain_1123:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1133
+.Lmain_1132:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1136:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1137:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1138:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1135:
+    incl -33554460(%rbp)
+.Lmain_1133:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1132
+.Lmain_1134:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1130
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1131:
+    incl -33554460(%rbp)
+    jmp .Lmain_1134
+.Lmain_1130:
+    addq $8, %rsp
+.Lmain_1127:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1145
+.Lmain_1144:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1148:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1149:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1150:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1147:
+    incl -33554460(%rbp)
+.Lmain_1145:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1144
+.Lmain_1146:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1142
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1143:
+    incl -33554460(%rbp)
+    jmp .Lmain_1146
+.Lmain_1142:
+    addq $8, %rsp
+.Lmain_1139:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1157
+.Lmain_1156:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1160:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1161:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1162:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1159:
+    incl -33554460(%rbp)
+.Lmain_1157:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1156
+.Lmain_1158:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1154
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1155:
+    incl -33554460(%rbp)
+    jmp .Lmain_1158
+.Lmain_1154:
+    addq $8, %rsp
+.Lmain_1151:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1168
+.Lmain_1167:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1171:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1172:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1173:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1170:
+    incl -33554460(%rbp)
+.Lmain_1168:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1167
+.Lmain_1169:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1165
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1166:
+    incl -33554460(%rbp)
+    jmp .Lmain_1169
+.Lmain_1165:
+    addq $8, %rsp
+.Lmain_1126:
+    incl -33554456(%rbp)
+.Lmain_1124:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1123
+.Lmain_1125:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1121
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1179
+.Lmain_1178:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1182:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1183:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1184:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1181:
+    incl -33554460(%rbp)
+.Lmain_1179:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1178
+.Lmain_1180:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1176
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1177:
+    incl -33554460(%rbp)
+    jmp .Lmain_1180
+.Lmain_1176:
+    addq $8, %rsp
+.Lmain_1122:
+    incl -33554456(%rbp)
+    jmp .Lmain_1125
+.Lmain_1121:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_914:
+    addl $8, -33554444(%rbp)
+    jmp .Lmain_917
+.Lmain_913:
+    addq $8, %rsp
+.Lmain_910:
+    addl $8, -33554440(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_1190
+.Lmain_1189:
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1199
+.Lmain_1198:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1208
+.Lmain_1207:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1211:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1212:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1213:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1210:
+    incl -33554460(%rbp)
+.Lmain_1208:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1207
+.Lmain_1209:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1205
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1206:
+    incl -33554460(%rbp)
+    jmp .Lmain_1209
+.Lmain_1205:
+    addq $8, %rsp
+.Lmain_1202:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1220
+.Lmain_1219:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1223:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1224:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1225:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1222:
+    incl -33554460(%rbp)
+.Lmain_1220:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1219
+.Lmain_1221:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1217
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1218:
+    incl -33554460(%rbp)
+    jmp .Lmain_1221
+.Lmain_1217:
+    addq $8, %rsp
+.Lmain_1214:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1232
+.Lmain_1231:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1235:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1236:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1237:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1234:
+    incl -33554460(%rbp)
+.Lmain_1232:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1231
+.Lmain_1233:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1229
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1230:
+    incl -33554460(%rbp)
+    jmp .Lmain_1233
+.Lmain_1229:
+    addq $8, %rsp
+.Lmain_1226:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1243
+.Lmain_1242:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1246:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1247:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1248:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1245:
+    incl -33554460(%rbp)
+.Lmain_1243:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1242
+.Lmain_1244:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1240
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1241:
+    incl -33554460(%rbp)
+    jmp .Lmain_1244
+.Lmain_1240:
+    addq $8, %rsp
+.Lmain_1201:
+    incl -33554456(%rbp)
+.Lmain_1199:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1198
+.Lmain_1200:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1196
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1254
+.Lmain_1253:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1257:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1258:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1259:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1256:
+    incl -33554460(%rbp)
+.Lmain_1254:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1253
+.Lmain_1255:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1251
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1252:
+    incl -33554460(%rbp)
+    jmp .Lmain_1255
+.Lmain_1251:
+    addq $8, %rsp
+.Lmain_1197:
+    incl -33554456(%rbp)
+    jmp .Lmain_1200
+.Lmain_1196:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1193:
+    addl $8, -33554444(%rbp)
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1266
+.Lmain_1265:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1275
+.Lmain_1274:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1278:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1279:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1280:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1277:
+    incl -33554460(%rbp)
+.Lmain_1275:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1274
+.Lmain_1276:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1272
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1273:
+    incl -33554460(%rbp)
+    jmp .Lmain_1276
+.Lmain_1272:
+    addq $8, %rsp
+.Lmain_1269:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1287
+.Lmain_1286:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1290:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1291:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1292:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1289:
+    incl -33554460(%rbp)
+.Lmain_1287:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1286
+.Lmain_1288:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1284
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1285:
+    incl -33554460(%rbp)
+    jmp .Lmain_1288
+.Lmain_1284:
+    addq $8, %rsp
+.Lmain_1281:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1299
+.Lmain_1298:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1302:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1303:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1304:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1301:
+    incl -33554460(%rbp)
+.Lmain_1299:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1298
+.Lmain_1300:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1296
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1297:
+    incl -33554460(%rbp)
+    jmp .Lmain_1300
+.Lmain_1296:
+    addq $8, %rsp
+.Lmain_1293:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1310
+.Lmain_1309:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1313:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1314:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1315:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1312:
+    incl -33554460(%rbp)
+.Lmain_1310:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1309
+.Lmain_1311:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1307
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1308:
+    incl -33554460(%rbp)
+    jmp .Lmain_1311
+.Lmain_1307:
+    addq $8, %rsp
+.Lmain_1268:
+    incl -33554456(%rbp)
+.Lmain_1266:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1265
+.Lmain_1267:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1263
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1321
+.Lmain_1320:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1324:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1325:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1326:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1323:
+    incl -33554460(%rbp)
+.Lmain_1321:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1320
+.Lmain_1322:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1318
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1319:
+    incl -33554460(%rbp)
+    jmp .Lmain_1322
+.Lmain_1318:
+    addq $8, %rsp
+.Lmain_1264:
+    incl -33554456(%rbp)
+    jmp .Lmain_1267
+.Lmain_1263:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1260:
+    addl $8, -33554444(%rbp)
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1332
+.Lmain_1331:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1341
+.Lmain_1340:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1344:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1345:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1346:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1343:
+    incl -33554460(%rbp)
+.Lmain_1341:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1340
+.Lmain_1342:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1338
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1339:
+    incl -33554460(%rbp)
+    jmp .Lmain_1342
+.Lmain_1338:
+    addq $8, %rsp
+.Lmain_1335:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1353
+.Lmain_1352:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1356:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1357:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1358:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1355:
+    incl -33554460(%rbp)
+.Lmain_1353:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1352
+.Lmain_1354:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1350
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1351:
+    incl -33554460(%rbp)
+    jmp .Lmain_1354
+.Lmain_1350:
+    addq $8, %rsp
+.Lmain_1347:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1365
+.Lmain_1364:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1368:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1369:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1370:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1367:
+    incl -33554460(%rbp)
+.Lmain_1365:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1364
+.Lmain_1366:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1362
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1363:
+    incl -33554460(%rbp)
+    jmp .Lmain_1366
+.Lmain_1362:
+    addq $8, %rsp
+.Lmain_1359:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1376
+.Lmain_1375:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1379:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1380:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1381:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1378:
+    incl -33554460(%rbp)
+.Lmain_1376:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1375
+.Lmain_1377:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1373
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1374:
+    incl -33554460(%rbp)
+    jmp .Lmain_1377
+.Lmain_1373:
+    addq $8, %rsp
+.Lmain_1334:
+    incl -33554456(%rbp)
+.Lmain_1332:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1331
+.Lmain_1333:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1329
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1387
+.Lmain_1386:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1390:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1391:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1392:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1389:
+    incl -33554460(%rbp)
+.Lmain_1387:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1386
+.Lmain_1388:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1384
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1385:
+    incl -33554460(%rbp)
+    jmp .Lmain_1388
+.Lmain_1384:
+    addq $8, %rsp
+.Lmain_1330:
+    incl -33554456(%rbp)
+    jmp .Lmain_1333
+.Lmain_1329:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1192:
+    addl $8, -33554444(%rbp)
+.Lmain_1190:
+    movslq -33554444(%rbp), %rax
+    addq $16, %rax
+    cmpq $2048, %rax
+    jl .Lmain_1189
+.Lmain_1191:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1187
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1398
+.Lmain_1397:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1407
+.Lmain_1406:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1410:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1411:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1412:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1409:
+    incl -33554460(%rbp)
+.Lmain_1407:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1406
+.Lmain_1408:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1404
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1405:
+    incl -33554460(%rbp)
+    jmp .Lmain_1408
+.Lmain_1404:
+    addq $8, %rsp
+.Lmain_1401:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1419
+.Lmain_1418:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1422:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1423:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1424:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1421:
+    incl -33554460(%rbp)
+.Lmain_1419:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1418
+.Lmain_1420:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1416
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1417:
+    incl -33554460(%rbp)
+    jmp .Lmain_1420
+.Lmain_1416:
+    addq $8, %rsp
+.Lmain_1413:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1431
+.Lmain_1430:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1434:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1435:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1436:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1433:
+    incl -33554460(%rbp)
+.Lmain_1431:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1430
+.Lmain_1432:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1428
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1429:
+    incl -33554460(%rbp)
+    jmp .Lmain_1432
+.Lmain_1428:
+    addq $8, %rsp
+.Lmain_1425:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1442
+.Lmain_1441:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1445:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1446:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1447:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1444:
+    incl -33554460(%rbp)
+.Lmain_1442:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1441
+.Lmain_1443:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1439
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1440:
+    incl -33554460(%rbp)
+    jmp .Lmain_1443
+.Lmain_1439:
+    addq $8, %rsp
+.Lmain_1400:
+    incl -33554456(%rbp)
+.Lmain_1398:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1397
+.Lmain_1399:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1395
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1453
+.Lmain_1452:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1456:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1457:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1458:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1455:
+    incl -33554460(%rbp)
+.Lmain_1453:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1452
+.Lmain_1454:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1450
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1451:
+    incl -33554460(%rbp)
+    jmp .Lmain_1454
+.Lmain_1450:
+    addq $8, %rsp
+.Lmain_1396:
+    incl -33554456(%rbp)
+    jmp .Lmain_1399
+.Lmain_1395:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1188:
+    addl $8, -33554444(%rbp)
+    jmp .Lmain_1191
+.Lmain_1187:
+    addq $8, %rsp
+.Lmain_909:
+    addl $8, -33554440(%rbp)
+.Lmain_907:
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    cmpq $2048, %rax
+    jl .Lmain_906
+.Lmain_908:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_904
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_1464
+.Lmain_1463:
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1473
+.Lmain_1472:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1482
+.Lmain_1481:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1485:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1486:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1487:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1484:
+    incl -33554460(%rbp)
+.Lmain_1482:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1481
+.Lmain_1483:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1479
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1480:
+    incl -33554460(%rbp)
+    jmp .Lmain_1483
+.Lmain_1479:
+    addq $8, %rsp
+.Lmain_1476:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1494
+.Lmain_1493:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1497:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1498:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1499:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1496:
+    incl -33554460(%rbp)
+.Lmain_1494:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1493
+.Lmain_1495:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1491
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1492:
+    incl -33554460(%rbp)
+    jmp .Lmain_1495
+.Lmain_1491:
+    addq $8, %rsp
+.Lmain_1488:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1506
+.Lmain_1505:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1509:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1510:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1511:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1508:
+    incl -33554460(%rbp)
+.Lmain_1506:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1505
+.Lmain_1507:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1503
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1504:
+    incl -33554460(%rbp)
+    jmp .Lmain_1507
+.Lmain_1503:
+    addq $8, %rsp
+.Lmain_1500:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1517
+.Lmain_1516:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1520:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1521:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1522:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1519:
+    incl -33554460(%rbp)
+.Lmain_1517:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1516
+.Lmain_1518:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1514
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1515:
+    incl -33554460(%rbp)
+    jmp .Lmain_1518
+.Lmain_1514:
+    addq $8, %rsp
+.Lmain_1475:
+    incl -33554456(%rbp)
+.Lmain_1473:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1472
+.Lmain_1474:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1470
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1528
+.Lmain_1527:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1531:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1532:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1533:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1530:
+    incl -33554460(%rbp)
+.Lmain_1528:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1527
+.Lmain_1529:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1525
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1526:
+    incl -33554460(%rbp)
+    jmp .Lmain_1529
+.Lmain_1525:
+    addq $8, %rsp
+.Lmain_1471:
+    incl -33554456(%rbp)
+    jmp .Lmain_1474
+.Lmain_1470:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1467:
+    addl $8, -33554444(%rbp)
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1540
+.Lmain_1539:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1549
+.Lmain_1548:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1552:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1553:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1554:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1551:
+    incl -33554460(%rbp)
+.Lmain_1549:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1548
+.Lmain_1550:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1546
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1547:
+    incl -33554460(%rbp)
+    jmp .Lmain_1550
+.Lmain_1546:
+    addq $8, %rsp
+.Lmain_1543:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1561
+.Lmain_1560:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1564:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1565:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1566:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1563:
+    incl -33554460(%rbp)
+.Lmain_1561:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1560
+.Lmain_1562:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1558
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1559:
+    incl -33554460(%rbp)
+    jmp .Lmain_1562
+.Lmain_1558:
+    addq $8, %rsp
+.Lmain_1555:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1573
+.Lmain_1572:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1576:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1577:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1578:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1575:
+    incl -33554460(%rbp)
+.Lmain_1573:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1572
+.Lmain_1574:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1570
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1571:
+    incl -33554460(%rbp)
+    jmp .Lmain_1574
+.Lmain_1570:
+    addq $8, %rsp
+.Lmain_1567:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1584
+.Lmain_1583:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1587:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1588:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1589:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1586:
+    incl -33554460(%rbp)
+.Lmain_1584:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1583
+.Lmain_1585:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1581
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1582:
+    incl -33554460(%rbp)
+    jmp .Lmain_1585
+.Lmain_1581:
+    addq $8, %rsp
+.Lmain_1542:
+    incl -33554456(%rbp)
+.Lmain_1540:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1539
+.Lmain_1541:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1537
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1595
+.Lmain_1594:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1598:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1599:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1600:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1597:
+    incl -33554460(%rbp)
+.Lmain_1595:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1594
+.Lmain_1596:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1592
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1593:
+    incl -33554460(%rbp)
+    jmp .Lmain_1596
+.Lmain_1592:
+    addq $8, %rsp
+.Lmain_1538:
+    incl -33554456(%rbp)
+    jmp .Lmain_1541
+.Lmain_1537:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1534:
+    addl $8, -33554444(%rbp)
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1606
+.Lmain_1605:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1615
+.Lmain_1614:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1618:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1619:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1620:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1617:
+    incl -33554460(%rbp)
+.Lmain_1615:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1614
+.Lmain_1616:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1612
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1613:
+    incl -33554460(%rbp)
+    jmp .Lmain_1616
+.Lmain_1612:
+    addq $8, %rsp
+.Lmain_1609:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1627
+.Lmain_1626:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1630:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1631:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1632:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1629:
+    incl -33554460(%rbp)
+.Lmain_1627:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1626
+.Lmain_1628:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1624
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1625:
+    incl -33554460(%rbp)
+    jmp .Lmain_1628
+.Lmain_1624:
+    addq $8, %rsp
+.Lmain_1621:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1639
+.Lmain_1638:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1642:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1643:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1644:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1641:
+    incl -33554460(%rbp)
+.Lmain_1639:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1638
+.Lmain_1640:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1636
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1637:
+    incl -33554460(%rbp)
+    jmp .Lmain_1640
+.Lmain_1636:
+    addq $8, %rsp
+.Lmain_1633:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1650
+.Lmain_1649:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1653:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1654:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1655:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1652:
+    incl -33554460(%rbp)
+.Lmain_1650:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1649
+.Lmain_1651:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1647
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1648:
+    incl -33554460(%rbp)
+    jmp .Lmain_1651
+.Lmain_1647:
+    addq $8, %rsp
+.Lmain_1608:
+    incl -33554456(%rbp)
+.Lmain_1606:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1605
+.Lmain_1607:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1603
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1661
+.Lmain_1660:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1664:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1665:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1666:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1663:
+    incl -33554460(%rbp)
+.Lmain_1661:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1660
+.Lmain_1662:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1658
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1659:
+    incl -33554460(%rbp)
+    jmp .Lmain_1662
+.Lmain_1658:
+    addq $8, %rsp
+.Lmain_1604:
+    incl -33554456(%rbp)
+    jmp .Lmain_1607
+.Lmain_1603:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1466:
+    addl $8, -33554444(%rbp)
+.Lmain_1464:
+    movslq -33554444(%rbp), %rax
+    addq $16, %rax
+    cmpq $2048, %rax
+    jl .Lmain_1463
+.Lmain_1465:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1461
+    .loc 1 15 14
+    movslq -33554440(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554448(%rbp)
+    .loc 1 16 18
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    addq $8, %rax
+    movslq %eax, %rax
+    movl %eax, -33554452(%rbp)
+    .loc 1 15 9
+    movslq -33554440(%rbp), %rax
+    movl %eax, -33554456(%rbp)
+    jmp .Lmain_1672
+.Lmain_1671:
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1681
+.Lmain_1680:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1684:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1685:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1686:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1683:
+    incl -33554460(%rbp)
+.Lmain_1681:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1680
+.Lmain_1682:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1678
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1679:
+    incl -33554460(%rbp)
+    jmp .Lmain_1682
+.Lmain_1678:
+    addq $8, %rsp
+.Lmain_1675:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1693
+.Lmain_1692:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1696:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1697:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1698:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1695:
+    incl -33554460(%rbp)
+.Lmain_1693:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1692
+.Lmain_1694:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1690
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1691:
+    incl -33554460(%rbp)
+    jmp .Lmain_1694
+.Lmain_1690:
+    addq $8, %rsp
+.Lmain_1687:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1705
+.Lmain_1704:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1708:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1709:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1710:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1707:
+    incl -33554460(%rbp)
+.Lmain_1705:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1704
+.Lmain_1706:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1702
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1703:
+    incl -33554460(%rbp)
+    jmp .Lmain_1706
+.Lmain_1702:
+    addq $8, %rsp
+.Lmain_1699:
+    incl -33554456(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1716
+.Lmain_1715:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1719:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1720:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1721:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1718:
+    incl -33554460(%rbp)
+.Lmain_1716:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1715
+.Lmain_1717:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1713
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1714:
+    incl -33554460(%rbp)
+    jmp .Lmain_1717
+.Lmain_1713:
+    addq $8, %rsp
+.Lmain_1674:
+    incl -33554456(%rbp)
+.Lmain_1672:
+    movslq -33554456(%rbp), %rax
+    addq $3, %rax
+    movslq -33554448(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1671
+.Lmain_1673:
+    movslq -33554456(%rbp), %rax
+    cmpl -33554448(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1669
+    .loc 1 16 13
+    subq $8, %rsp
+    movslq -33554444(%rbp), %rax
+    movl %eax, -33554460(%rbp)
+    jmp .Lmain_1727
+.Lmain_1726:
+    .loc 1 17 17
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1730:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1731:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1732:
+    incl -33554460(%rbp)
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1729:
+    incl -33554460(%rbp)
+.Lmain_1727:
+    movslq -33554460(%rbp), %rax
+    addq $3, %rax
+    movslq -33554452(%rbp), %rbx
+    cmpq %rbx, %rax
+    jl .Lmain_1726
+.Lmain_1728:
+    movslq -33554460(%rbp), %rax
+    cmpl -33554452(%rbp), %eax
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1724
+    movslq -33554456(%rbp), %rax
+    push %rax
+    leaq -33554432(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554460(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554460(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554456(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_1725:
+    incl -33554460(%rbp)
+    jmp .Lmain_1728
+.Lmain_1724:
+    addq $8, %rsp
+.Lmain_1670:
+    incl -33554456(%rbp)
+    jmp .Lmain_1673
+.Lmain_1669:
+    addq $0, %rsp
+    addq $8, %rsp
+.Lmain_1462:
+    addl $8, -33554444(%rbp)
+    jmp .Lmain_1465
+.Lmain_1461:
+    addq $8, %rsp
+.Lmain_905:
+    addl $8, -33554440(%rbp)
+    jmp .Lmain_908
+.Lmain_904:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 9 28
+    incl -33554436(%rbp)
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554436(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -33554440(%rbp)
+    jmp .Lmain_1738
+.Lmain_1737:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_1747
+.Lmain_1746:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1750:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1751:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1752:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1749:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_1747:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_1746
+.Lmain_1748:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1744
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1745:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_1748
+.Lmain_1744:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1741:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_1759
+.Lmain_1758:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1762:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1763:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1764:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1761:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_1759:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_1758
+.Lmain_1760:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1756
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1757:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_1760
+.Lmain_1756:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1753:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_1771
+.Lmain_1770:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1774:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1775:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1776:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1773:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_1771:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_1770
+.Lmain_1772:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1768
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1769:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_1772
+.Lmain_1768:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1765:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_1782
+.Lmain_1781:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1785:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1786:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1787:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1784:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_1782:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_1781
+.Lmain_1783:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1779
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1780:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_1783
+.Lmain_1779:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1740:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+.Lmain_1738:
+    movslq -33554440(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_1737
+.Lmain_1739:
+    cmpl $2048, -33554440(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1735
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -33554444(%rbp)
+    jmp .Lmain_1793
+.Lmain_1792:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1796:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1797:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1798:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1795:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+.Lmain_1793:
+    movslq -33554444(%rbp), %rax
+    addq $3, %rax
+    cmpq $2048, %rax
+    jl .Lmain_1792
+.Lmain_1794:
+    cmpl $2048, -33554444(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_1790
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -33554444(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -33554440(%rbp), %rax
+    push %rax
+    leaq -16777216(%rbp), %rax
+    pop %rbx
+    shlq $13, %rbx
+    add %rbx, %rax
+    movslq -33554444(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -33554436(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -33554436(%rbp)
+    addq $0, %rsp
+.Lmain_1791:
+    .loc 1 23 35
+    incl -33554444(%rbp)
+    jmp .Lmain_1794
+.Lmain_1790:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_1736:
+    .loc 1 22 31
+    incl -33554440(%rbp)
+    jmp .Lmain_1739
+.Lmain_1735:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -33554436(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,3383 @@
+    .file 1 "bench/kernels/trans_256.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $262144, %rsp
+    .loc 1 3 5
+    subq $262144, %rsp
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524292(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_15:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 4 30
+    incl -524292(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_27:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 4 30
+    incl -524292(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_39
+    .p2align 4,,10
+.Lmain_38:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_39:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 4 30
+    incl -524292(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_50:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 4 30
+    incl -524292(%rbp)
+.Lmain_6:
+    movslq -524292(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $256, -524292(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_61:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 30
+    incl -524292(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524292(%rbp)
+    jmp .Lmain_72
+    .p2align 4,,10
+.Lmain_71:
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_78
+    .p2align 4,,10
+.Lmain_77:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_87
+    .p2align 4,,10
+.Lmain_86:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_90:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_91:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_92:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_89:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_87:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_86
+.Lmain_88:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_84
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_85:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_88
+.Lmain_84:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_99
+    .p2align 4,,10
+.Lmain_98:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_102:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_103:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_104:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_101:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_99:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_98
+.Lmain_100:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_96
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_97:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_100
+.Lmain_96:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_93:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_111
+    .p2align 4,,10
+.Lmain_110:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_114:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_116:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_113:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_111:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_110
+.Lmain_112:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_108
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_109:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_112
+.Lmain_108:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_105:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_122
+    .p2align 4,,10
+.Lmain_121:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_125:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_126:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_127:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_124:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_122:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_121
+.Lmain_123:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_119
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_120:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_123
+.Lmain_119:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_80:
+    .loc 1 10 34
+    incl -524296(%rbp)
+.Lmain_78:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_77
+.Lmain_79:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_75
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_133
+    .p2align 4,,10
+.Lmain_132:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_136:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_137:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_138:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_135:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_133:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_132
+.Lmain_134:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_130
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_131:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_134
+.Lmain_130:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_76:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    jmp .Lmain_79
+.Lmain_75:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_144
+    .p2align 4,,10
+.Lmain_143:
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_153
+    .p2align 4,,10
+.Lmain_152:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_156:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_157:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_155:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_153:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_152
+.Lmain_154:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_150
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_151:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_154
+.Lmain_150:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_147:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_165
+    .p2align 4,,10
+.Lmain_164:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_168:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_169:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_170:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_167:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_165:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_164
+.Lmain_166:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_162
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_163:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_166
+.Lmain_162:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_159:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_177
+    .p2align 4,,10
+.Lmain_176:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_181:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_182:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_179:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_177:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_176
+.Lmain_178:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_174
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_175:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_178
+.Lmain_174:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_171:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_188
+    .p2align 4,,10
+.Lmain_187:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_191:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_192:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_193:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_190:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_188:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_187
+.Lmain_189:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_185
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_186:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_189
+.Lmain_185:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_146:
+    .loc 1 15 34
+    incl -524296(%rbp)
+.Lmain_144:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_143
+.Lmain_145:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_141
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_199
+    .p2align 4,,10
+.Lmain_198:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_202:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_203:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_204:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_201:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_199:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_198
+.Lmain_200:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_196
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_197:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_200
+.Lmain_196:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_142:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    jmp .Lmain_145
+.Lmain_141:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 9 29
+    incl -524292(%rbp)
+.Lmain_72:
+    cmpl $64, -524292(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_71
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524292(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_210
+    .p2align 4,,10
+.Lmain_209:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_219
+    .p2align 4,,10
+.Lmain_218:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_222:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_223:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_224:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_221:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_219:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_218
+.Lmain_220:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_216
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_217:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_220
+.Lmain_216:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_213:
+    .loc 1 22 30
+    incl -524296(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_231
+    .p2align 4,,10
+.Lmain_230:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_235:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_236:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_233:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_231:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_230
+.Lmain_232:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_228
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_229:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_232
+.Lmain_228:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_225:
+    .loc 1 22 30
+    incl -524296(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_243
+    .p2align 4,,10
+.Lmain_242:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_246:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_247:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_248:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_245:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_243:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_242
+.Lmain_244:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_240
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_241:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_244
+.Lmain_240:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_237:
+    .loc 1 22 30
+    incl -524296(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_254
+    .p2align 4,,10
+.Lmain_253:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_257:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_258:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_259:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_256:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_254:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_253
+.Lmain_255:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_251
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_252:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_255
+.Lmain_251:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_212:
+    .loc 1 22 30
+    incl -524296(%rbp)
+.Lmain_210:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_209
+.Lmain_211:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_207
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_265
+    .p2align 4,,10
+.Lmain_264:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_269:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_270:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_267:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_265:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_264
+.Lmain_266:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_262
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_263:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_266
+.Lmain_262:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_208:
+    .loc 1 22 30
+    incl -524296(%rbp)
+    jmp .Lmain_211
+.Lmain_207:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
@@ -0,0 +1,4982 @@
+    .file 1 "bench/kernels/trans_256.c"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $262144, %rsp
+    .loc 1 3 5
+    subq $262144, %rsp
+    .loc 1 4 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524292(%rbp)
+    jmp .Lmain_6
+    .p2align 4,,10
+.Lmain_5:
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_15
+    .p2align 4,,10
+.Lmain_14:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_18:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_19:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_20:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_17:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_15:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_14
+.Lmain_16:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_12
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_13:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_16
+.Lmain_12:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_9:
+    .loc 1 4 30
+    incl -524292(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_27
+    .p2align 4,,10
+.Lmain_26:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_30:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_31:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_32:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_29:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_27:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_26
+.Lmain_28:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_24
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_25:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_28
+.Lmain_24:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_21:
+    .loc 1 4 30
+    incl -524292(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_39
+    .p2align 4,,10
+.Lmain_38:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_42:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_43:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_44:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_41:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_39:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_38
+.Lmain_40:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_36
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_37:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_40
+.Lmain_36:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_33:
+    .loc 1 4 30
+    incl -524292(%rbp)
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_50
+    .p2align 4,,10
+.Lmain_49:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_53:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_54:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_55:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_52:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_50:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_49
+.Lmain_51:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_47
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_48:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_51
+.Lmain_47:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_8:
+    .loc 1 4 30
+    incl -524292(%rbp)
+.Lmain_6:
+    movslq -524292(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_5
+.Lmain_7:
+    cmpl $256, -524292(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_3
+    .loc 1 5 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_61
+    .p2align 4,,10
+.Lmain_60:
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_64:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_65:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_66:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_63:
+    .loc 1 5 34
+    incl -524296(%rbp)
+.Lmain_61:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_60
+.Lmain_62:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_58
+    .loc 1 6 13
+    movslq -524292(%rbp), %rax
+    imulq $3, %rax
+    movslq %eax, %rax
+    addl -524296(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_59:
+    .loc 1 5 34
+    incl -524296(%rbp)
+    jmp .Lmain_62
+.Lmain_58:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_4:
+    .loc 1 4 30
+    incl -524292(%rbp)
+    jmp .Lmain_7
+.Lmain_3:
+    addq $8, %rsp
+    .loc 1 9 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524292(%rbp)
+    jmp .Lmain_72
+    .p2align 4,,10
+.Lmain_71:
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_79
+    .p2align 4,,10
+.Lmain_78:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_88
+    .p2align 4,,10
+.Lmain_87:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_91:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_92:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_93:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_90:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_88:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_87
+.Lmain_89:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_85
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_86:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_89
+.Lmain_85:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_82:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_100
+    .p2align 4,,10
+.Lmain_99:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_103:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_104:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_105:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_102:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_100:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_99
+.Lmain_101:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_97
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_98:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_101
+.Lmain_97:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_94:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_112
+    .p2align 4,,10
+.Lmain_111:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_115:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_116:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_117:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_114:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_112:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_111
+.Lmain_113:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_109
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_110:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_113
+.Lmain_109:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_106:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_123
+    .p2align 4,,10
+.Lmain_122:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_126:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_127:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_128:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_125:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_123:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_122
+.Lmain_124:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_120
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_121:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_124
+.Lmain_120:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_81:
+    .loc 1 10 34
+    incl -524296(%rbp)
+.Lmain_79:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_78
+.Lmain_80:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_76
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_134
+    .p2align 4,,10
+.Lmain_133:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_137:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_138:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_139:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_136:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_134:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_133
+.Lmain_135:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_131
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_132:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_135
+.Lmain_131:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_77:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    jmp .Lmain_80
+.Lmain_76:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_145
+    .p2align 4,,10
+.Lmain_144:
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_154
+    .p2align 4,,10
+.Lmain_153:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_157:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_158:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_159:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_156:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_154:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_153
+.Lmain_155:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_151
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_152:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_155
+.Lmain_151:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_148:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_166
+    .p2align 4,,10
+.Lmain_165:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_169:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_170:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_171:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_168:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_166:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_165
+.Lmain_167:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_163
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_164:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_167
+.Lmain_163:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_160:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_178
+    .p2align 4,,10
+.Lmain_177:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_181:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_182:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_183:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_180:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_178:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_177
+.Lmain_179:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_175
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_176:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_179
+.Lmain_175:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_172:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_189
+    .p2align 4,,10
+.Lmain_188:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_192:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_193:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_194:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_191:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_189:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_188
+.Lmain_190:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_186
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_187:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_190
+.Lmain_186:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_147:
+    .loc 1 15 34
+    incl -524296(%rbp)
+.Lmain_145:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_144
+.Lmain_146:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_142
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_200
+    .p2align 4,,10
+.Lmain_199:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_203:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_204:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_205:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_202:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_200:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_199
+.Lmain_201:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_197
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_198:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_201
+.Lmain_197:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_143:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    jmp .Lmain_146
+.Lmain_142:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_73:
+    .loc 1 9 29
+    incl -524292(%rbp)
+    cmpl $64, -524292(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_69
+    .loc 1 10 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_211
+    .p2align 4,,10
+.Lmain_210:
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_220
+    .p2align 4,,10
+.Lmain_219:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_223:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_224:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_225:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_222:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_220:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_219
+.Lmain_221:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_217
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_218:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_221
+.Lmain_217:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_214:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_232
+    .p2align 4,,10
+.Lmain_231:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_235:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_236:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_237:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_234:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_232:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_231
+.Lmain_233:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_229
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_230:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_233
+.Lmain_229:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_226:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_244
+    .p2align 4,,10
+.Lmain_243:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_247:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_248:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_249:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_246:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_244:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_243
+.Lmain_245:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_241
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_242:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_245
+.Lmain_241:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_238:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_255
+    .p2align 4,,10
+.Lmain_254:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_258:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_259:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_260:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_257:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_255:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_254
+.Lmain_256:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_252
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_253:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_256
+.Lmain_252:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_213:
+    .loc 1 10 34
+    incl -524296(%rbp)
+.Lmain_211:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_210
+.Lmain_212:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_208
+    .loc 1 11 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_266
+    .p2align 4,,10
+.Lmain_265:
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_269:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_270:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_271:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_268:
+    .loc 1 11 38
+    incl -524300(%rbp)
+.Lmain_266:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_265
+.Lmain_267:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_263
+    .loc 1 12 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_264:
+    .loc 1 11 38
+    incl -524300(%rbp)
+    jmp .Lmain_267
+.Lmain_263:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_209:
+    .loc 1 10 34
+    incl -524296(%rbp)
+    jmp .Lmain_212
+.Lmain_208:
+    addq $0, %rsp
+    .loc 1 15 9
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_277
+    .p2align 4,,10
+.Lmain_276:
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_286
+    .p2align 4,,10
+.Lmain_285:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_289:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_290:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_291:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_288:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_286:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_285
+.Lmain_287:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_283
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_284:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_287
+.Lmain_283:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_280:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_298
+    .p2align 4,,10
+.Lmain_297:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_301:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_302:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_303:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_300:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_298:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_297
+.Lmain_299:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_295
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_296:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_299
+.Lmain_295:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_292:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_310
+    .p2align 4,,10
+.Lmain_309:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_313:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_314:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_315:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_312:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_310:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_309
+.Lmain_311:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_307
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_308:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_311
+.Lmain_307:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_304:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_321
+    .p2align 4,,10
+.Lmain_320:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_324:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_325:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_326:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_323:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_321:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_320
+.Lmain_322:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_318
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_319:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_322
+.Lmain_318:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_279:
+    .loc 1 15 34
+    incl -524296(%rbp)
+.Lmain_277:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_276
+.Lmain_278:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_274
+    .loc 1 16 13
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_332
+    .p2align 4,,10
+.Lmain_331:
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_335:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_336:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_337:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_334:
+    .loc 1 16 38
+    incl -524300(%rbp)
+.Lmain_332:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_331
+.Lmain_333:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_329
+    .loc 1 17 17
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -524288(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    subl -524292(%rbp), %eax
+    movslq %eax, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524296(%rbp), %rcx
+    pop %rdx
+    movl %edx, (%rax,%rcx,4)
+    movq %rdx, %rax
+    addq $0, %rsp
+.Lmain_330:
+    .loc 1 16 38
+    incl -524300(%rbp)
+    jmp .Lmain_333
+.Lmain_329:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_275:
+    .loc 1 15 34
+    incl -524296(%rbp)
+    jmp .Lmain_278
+.Lmain_274:
+    addq $0, %rsp
+    addq $0, %rsp
+.Lmain_70:
+    .loc 1 9 29
+    incl -524292(%rbp)
+.Lmain_72:
+    cmpl $64, -524292(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    jne .Lmain_71
+.Lmain_69:
+    addq $8, %rsp
+    .loc 1 21 5
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524292(%rbp)
+    .loc 1 22 5
+    movq $0, %rax
+    movl %eax, -524296(%rbp)
+    jmp .Lmain_343
+    .p2align 4,,10
+.Lmain_342:
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_352
+    .p2align 4,,10
+.Lmain_351:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_355:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_356:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_357:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_354:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_352:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_351
+.Lmain_353:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_349
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_350:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_353
+.Lmain_349:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_346:
+    .loc 1 22 30
+    incl -524296(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_364
+    .p2align 4,,10
+.Lmain_363:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_367:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_368:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_369:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_366:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_364:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_363
+.Lmain_365:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_361
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_362:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_365
+.Lmain_361:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_358:
+    .loc 1 22 30
+    incl -524296(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_376
+    .p2align 4,,10
+.Lmain_375:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_379:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_380:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_381:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_378:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_376:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_375
+.Lmain_377:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_373
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_374:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_377
+.Lmain_373:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_370:
+    .loc 1 22 30
+    incl -524296(%rbp)
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_387
+    .p2align 4,,10
+.Lmain_386:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_390:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_391:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_392:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_389:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_387:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_386
+.Lmain_388:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_384
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_385:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_388
+.Lmain_384:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_345:
+    .loc 1 22 30
+    incl -524296(%rbp)
+.Lmain_343:
+    movslq -524296(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_342
+.Lmain_344:
+    cmpl $256, -524296(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_340
+    .loc 1 23 9
+    subq $8, %rsp
+    movq $0, %rax
+    movl %eax, -524300(%rbp)
+    jmp .Lmain_398
+    .p2align 4,,10
+.Lmain_397:
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_401:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_402:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_403:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_400:
+    .loc 1 23 34
+    incl -524300(%rbp)
+.Lmain_398:
+    movslq -524300(%rbp), %rax
+    addq $3, %rax
+    cmpq $256, %rax
+    jl .Lmain_397
+.Lmain_399:
+    cmpl $256, -524300(%rbp)
+    movq $0, %rax
+    setl %al
+    cmpq $0, %rax
+    je .Lmain_395
+    .loc 1 24 13
+    movq $1000003, %rax
+    push %rax
+    movq $7, %rax
+    push %rax
+    movslq -524300(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    addq $1, %rax
+    movslq %eax, %rax
+    push %rax
+    movslq -524296(%rbp), %rax
+    push %rax
+    leaq -262144(%rbp), %rax
+    pop %rbx
+    shlq $10, %rbx
+    add %rbx, %rax
+    movslq -524300(%rbp), %rcx
+    movslq (%rax,%rcx,4), %rax
+    pop %rbx
+    imul %rbx, %rax
+    movslq %eax, %rax
+    addl -524292(%rbp), %eax
+    movslq %eax, %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    movl %eax, -524292(%rbp)
+    addq $0, %rsp
+.Lmain_396:
+    .loc 1 23 34
+    incl -524300(%rbp)
+    jmp .Lmain_399
+.Lmain_395:
+    addq $8, %rsp
+    addq $0, %rsp
+.Lmain_341:
+    .loc 1 22 30
+    incl -524296(%rbp)
+    jmp .Lmain_344
+.Lmain_340:
+    addq $0, %rsp
+    .loc 1 27 5
+    movq $256, %rax
+    push %rax
+    movslq -524292(%rbp), %rax
+    pop %rbx
+    cltd
+    idivl %ebx
+    movq %rdx, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main
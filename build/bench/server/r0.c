@@ -0,0 +1,52 @@
+int f0() {
+    int v0 = 45;
+    int v1 = 39;
+    int v2 = 24;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((48 + 43) || (v1 / 8)) < ((23 * v0) <= (v0 <= v1)));
+    a0[4] = (((a1[0][8] >= v0) * (65 * a0[15])) ? ((20 >= v3) && (46 == v2)) : ((a1[3][15] > v1) / 5));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v1 = (((v3 / 9) ? (a1[2][8] < v0) : (a1[3][14] - a0[11])) == ((v0 != 32) * (a1[1][3] - 1)));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v0 = (((a1[3][13] || v0) <= (v0 * i1)) == ((v1 ? 13 : 26) > (i1 % 7)));
+            v1 = (((46 >= a1[2][1]) ? (94 || a1[2][4]) : (v0 + v3)) ? ((44 % 4) / 1) : ((v2 % 5) / 1));
+            v0 = (((87 || a0[11]) ? (v3 * v3) : (a0[9] && v0)) >= ((a0[14] > i0) ? (a0[5] * a1[1][1]) : (a0[7] % 6)));
+        }
+        a0[15] = (((i0 + 1) != (v0 != a0[4])) || ((24 / 2) ? (74 * 45) : (77 > v3)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a1[3][5] = (((v2 && v0) > (v3 && v1)) != ((75 >= 8) <= (v2 == a0[6])));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            a0[3] = (((a0[0] ? i2 : 50) != (23 / 2)) ? ((v1 || i3) >= (i3 < a0[9])) : ((v0 <= v3) / 1));
+            a1[3][9] = (((v0 <= a0[12]) * (v3 ? v0 : 92)) / 6);
+            a1[2][8] = (((a0[14] < 41) && (v0 <= 91)) >= ((v1 < i2) < (v2 == a0[1])));
+        }
+        a0[12] = (((v3 > v3) < (98 ? v3 : v1)) - ((v3 <= v1) + (i2 ? 3 : a0[13])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v0 = (((v3 / 3) ? (i4 <= 48) : (v0 != 6)) && ((i4 % 1) % 4));
+            {
+                int i5 = 0;
+                do {
+                    if ((a1[1][4] >= 78) > 50) break;
+                    v2 = (((v2 > v0) % 8) == ((v1 <= i4) % 3));
+                    v3 = (((v0 * v2) * (3 - v1)) ? ((42 ? a0[10] : i5) * (74 <= 69)) : ((a1[0][10] / 8) > (v3 ? i5 : i4)));
+                    a1[2][6] = (((a0[12] < i5) ? (72 > 29) : (36 <= v1)) / 3);
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v2 = (((v0 == v0) ? (50 ? a0[4] : a1[0][9]) : (v1 + a0[8])) >= ((i4 ? v2 : 41) / 6));
+            i4 = i4 + 1;
+        }
+    }
+    return (((67 ? 83 : v0) <= (68 >= v1)) < ((83 > v2) == (v2 != v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
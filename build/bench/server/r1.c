@@ -0,0 +1,112 @@
+int f0() {
+    int v0 = 48;
+    int v1 = 87;
+    int v2 = 1;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    if ((((11 > a1[3][5]) > (v2 + 12)) && ((v0 + v3) + (v1 - 19)))) {
+        a0[10] = (((18 < v1) ? (v0 < v0) : (v2 * v1)) == ((62 / 1) + (a0[7] / 2)));
+        v3 = (((v0 && v3) % 1) - ((8 < v0) <= (a0[5] + v2)));
+        v1 = (((81 <= v1) || (a0[4] + v2)) % 5);
+    } else {
+        v2 = (((v3 != 42) > (a0[4] >= v2)) ? ((v2 < v3) || (v0 <= v3)) : ((v0 != a1[3][5]) && (80 < v1)));
+        v2 = (((v1 && v2) <= (a0[12] < v1)) <= ((v3 >= v0) % 4));
+        v0 = (((v3 == 99) + (v1 ? 31 : v2)) >= ((v3 < a0[15]) >= (a1[3][2] >= v0)));
+    }
+    if ((((a0[5] - a0[2]) < (92 ? v2 : v3)) + ((a1[3][11] ? v1 : 64) / 7))) {
+        a1[1][6] = (((v1 * 60) >= (93 != a0[8])) == ((v1 + a0[15]) >= (v1 < 69)));
+        v1 = (((v3 != v0) != (a1[3][13] >= v0)) ? ((a1[1][4] / 7) > (58 / 6)) : ((a1[1][12] / 3) > (v0 - v3)));
+        v0 = (((v2 % 4) * (a1[2][11] + v0)) - ((v3 + v2) == (a0[7] <= v3)));
+    } else {
+        a1[2][6] = (((v1 - v3) || (a1[1][9] + v0)) || ((v1 <= v1) ? (v1 ? v3 : v3) : (69 / 7)));
+        v1 = (((a0[12] > v1) < (34 != v2)) < ((v2 * v3) % 4));
+        a1[3][12] = (((v2 && a0[1]) - (v2 % 5)) * ((v2 % 6) < (v1 ? v3 : v0)));
+    }
+    v3 = (((57 == a0[9]) ? (v2 >= v1) : (v2 > 70)) == ((68 - v3) || (v0 != v3)));
+    v2 = (((v0 + v0) ? (a0[0] || 15) : (a0[14] + v2)) > ((a0[14] == a1[2][3]) ? (v3 || v0) : (a1[1][7] + a1[3][0])));
+    {
+        int i0 = 0;
+        do {
+            if ((v2 || a1[0][14]) > 63) break;
+            a1[1][5] = (((73 ? v3 : v1) && (12 == 16)) ? ((37 - i0) - (38 != v3)) : ((a0[9] < v3) + (v2 == a1[1][8])));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v0 = (((38 ? i0 : v1) < (71 != 39)) <= ((a1[3][6] + i0) / 2));
+                    v0 = (((a0[6] > v2) ? (i0 == a1[1][12]) : (i1 >= v1)) - ((65 - i1) > (a1[3][9] <= v0)));
+                    v1 = (((a0[6] + 17) / 5) != ((a0[7] < 71) + (i0 == v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((14 >= v3) < (a0[5] > a0[13])) || ((i0 && i0) - (a1[3][12] == a0[3])));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    return (((a1[3][9] ? v0 : v1) == (1 - a1[0][2])) >= ((a0[6] != v0) * (v2 <= v2)));
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 71;
+    int v2 = 51;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v3 > a1[1][2]) <= (82 ? a1[1][1] : v0)) && ((v1 ? a0[4] : a1[2][12]) > (v1 != v3)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((28 >= 65) > 52) break;
+        v3 = (((80 != 32) + (3 == 13)) && ((v2 || a0[8]) + (v3 - v2)));
+        v1 = (((v1 == 86) + (5 == v0)) < ((a1[1][10] ? i0 : i0) + (63 != 25)));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v0 = (((a0[15] > 90) ? (a1[0][2] <= 42) : (73 % 5)) - ((v0 + 37) <= (i0 ? 47 : v2)));
+                v1 = (((i1 < v3) && (v2 != v1)) != ((38 == 83) / 3));
+                v1 = (((a1[1][8] == a0[10]) || (i0 - 98)) || ((v0 >= a0[1]) > (20 >= v0)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    a0[0] = (((v1 >= 68) - (v2 == v2)) || ((v0 <= v2) % 5));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a1[2][12] - 16) <= (v3 <= a1[1][5])) < ((77 > i3) * (i3 != v1)));
+                    a0[14] = (((97 == a1[0][11]) == (v1 ? v0 : 98)) ? ((a0[11] && i3) + (v3 - i3)) : ((79 ? a0[8] : 66) < (48 * i3)));
+                    a1[1][9] = (((a0[4] <= v2) + (v2 ? v1 : v3)) > ((14 < v0) ? (11 && v3) : (70 / 2)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            a1[0][8] = (((v1 % 6) <= (a1[1][1] >= i2)) * ((v2 % 1) >= (v0 % 5)));
+            v3 = (((v0 ? 77 : v3) && (a0[6] && i2)) / 2);
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v1 == v2) && (a0[11] == i4)) <= ((a0[15] != 22) && (97 == 43)));
+                    a1[0][6] = (((v1 == i5) && (v3 > a1[1][8])) / 3);
+                    a1[1][6] = (((v1 <= i4) + (v1 / 6)) ? ((v0 >= a0[10]) < (a0[2] % 1)) : ((v1 >= v0) && (57 || v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v3 = (((a1[0][3] <= v1) ? (a0[8] * a0[3]) : (a0[5] % 7)) + ((v3 / 4) - (v0 % 7)));
+            v2 = (((a0[3] < a1[1][9]) <= (a0[0] == a0[15])) ? ((a1[3][15] % 7) > (66 || 51)) : ((62 * i4) >= (v2 ? v1 : v1)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 - 99) / 8) + ((v0 || v3) ? (68 != v1) : (a1[3][1] ? 14 : a1[1][15])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
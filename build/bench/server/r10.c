@@ -0,0 +1,140 @@
+int f0() {
+    int v0 = 41;
+    int v1 = 79;
+    int v2 = 20;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v0 * 4) > 87) break;
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((v2 != v1) > 81) break;
+                v0 = (((i0 <= a1[2][11]) != (9 < 7)) > ((v2 / 1) < (v3 <= i0)));
+                v0 = (((78 - a1[2][6]) ? (96 ? i1 : i0) : (a1[3][2] <= v1)) < ((i1 != v1) < (a1[3][9] ? 64 : 20)));
+                v3 = (((v2 + 8) ? (86 == v1) : (0 * v1)) * ((a0[10] % 2) != (a1[1][14] <= v0)));
+            }
+            a1[3][10] = (((a0[12] * a0[1]) / 8) || ((v1 / 5) % 6));
+            a0[8] = (((v3 < a0[1]) ? (v0 * 30) : (v1 % 4)) >= ((i0 + v3) && (i0 < v0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    a1[0][6] = (((v1 || 75) || (v2 < a0[10])) < ((a0[6] * a1[2][1]) % 8));
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a0[6] = (((v2 <= 93) ? (a1[3][4] * i2) : (v1 || v1)) <= ((76 ? i2 : a1[2][0]) >= (a0[2] > v3)));
+            v3 = (((v3 * 81) < (i2 ? v1 : 73)) + ((v1 ? v2 : a1[1][6]) != (91 ? a0[1] : a1[2][3])));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((v0 ? i3 : i2) > 62) break;
+                    a0[12] = (((75 % 6) != (63 / 8)) % 9);
+                    v2 = (((v1 != a0[0]) && (i3 + a1[3][11])) / 3);
+                    v0 = (((i3 <= i2) % 9) < ((a1[1][3] % 6) == (a0[2] / 9)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[0][4] = (((v3 > v1) >= (a1[3][4] <= a1[2][2])) <= ((91 % 1) <= (v0 / 4)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((9 >= a1[3][10]) * (90 - 18)) > ((22 ? 77 : 55) || (76 ? 7 : i4)));
+                    a0[11] = (((a1[3][2] / 6) - (25 && a0[6])) != ((57 || a1[1][3]) * (a0[7] && v1)));
+                    v0 = (((v0 || v0) / 7) < ((87 < v3) ? (v0 >= v0) : (a0[15] ? v0 : v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((a1[0][7] == 54) && (a1[3][6] * a1[0][13])) + ((46 || i4) < (v1 ? a1[1][13] : a0[14])));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v1 + v2) > 71) break;
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((i6 ? 48 : a0[0]) > 52) break;
+                v0 = (((i6 && v0) / 2) <= ((68 != v0) - (a0[7] || i6)));
+                v2 = (((a0[3] && v0) % 4) > ((a1[2][3] / 6) || (88 <= a1[2][11])));
+                v1 = (((68 && i6) * (i7 % 9)) ? ((7 ? a0[12] : i7) % 8) : ((13 >= v0) % 6));
+            }
+            a0[3] = (((v1 > a1[1][14]) % 5) != ((94 >= i6) <= (v3 ? v3 : v3)));
+            v3 = (((a0[13] == i6) ? (i6 && 7) : (v3 >= v1)) >= ((a1[1][15] || 15) ? (v2 - v0) : (v0 >= v1)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((v0 && v0) != (25 ? 85 : v1)) && ((v0 % 7) != (v2 * 71)));
+}
+int f1() {
+    int v0 = 11;
+    int v1 = 44;
+    int v2 = 6;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((63 >= a1[1][14]) || (a0[9] >= v1)) && ((2 && v0) % 5));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                a1[1][15] = (((i0 ? v2 : 7) <= (a1[2][15] % 6)) > ((a1[0][10] / 1) > (a1[0][6] && v1)));
+                a0[14] = (((a0[13] == a1[2][14]) ? (v1 * v1) : (v0 > 79)) > ((v0 && 20) >= (v3 % 2)));
+                a1[1][11] = (((a0[10] || i0) || (v3 ? v1 : 66)) >= ((v1 * 60) ? (a1[2][1] % 8) : (v0 && 87)));
+            }
+            a1[1][1] = (((i0 ? 26 : i0) - (68 * v0)) ? ((a0[7] + 92) - (i0 > 97)) : ((v1 * v3) * (a1[1][0] < 80)));
+            v3 = (((64 % 7) % 5) / 8);
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((4 * 73) <= (a1[1][15] == v2)) < ((v1 <= v2) + (v3 >= v2)))) {
+        v0 = (((v0 % 3) > (a1[0][2] == v2)) > ((a0[8] > a1[0][8]) ? (50 >= v2) : (v1 >= a0[0])));
+        v1 = (((30 % 1) > (v3 - v1)) >= ((a0[3] && 79) != (a1[2][3] == v1)));
+        v2 = (((89 && v1) == (v3 % 3)) > ((v1 - v0) % 3));
+    } else {
+        a0[8] = (((53 && a1[0][11]) % 7) != ((7 % 2) != (v0 <= 87)));
+        a1[0][15] = (((v3 - 65) / 8) ? ((v3 - v3) >= (v3 == a1[0][5])) : ((a0[8] ? a0[4] : a1[3][5]) != (a1[3][14] / 5)));
+        v1 = (((v0 / 9) != (v0 / 5)) > ((v3 < v1) == (a1[2][11] - 42)));
+    }
+    if ((((v0 || v0) - (v3 + v2)) > ((45 ? a0[14] : v3) == (v0 * v3)))) {
+        v1 = (((v0 || 6) == (37 > v2)) + ((a1[3][8] % 1) > (v3 <= a0[5])));
+        v2 = (((v1 < v0) && (a0[11] < v0)) == ((69 != v2) == (v3 + v1)));
+        v0 = (((v2 ? 15 : a1[0][13]) ? (v2 < v0) : (v1 / 5)) + ((a0[14] <= 53) >= (v0 % 6)));
+    } else {
+        a1[1][13] = (((v1 % 4) <= (62 + 79)) >= ((v1 <= v1) < (a0[12] % 5)));
+        v0 = (((v3 * v1) * (v2 ? a0[7] : a0[14])) < ((v2 / 8) >= (73 > a0[12])));
+        a1[2][11] = (((45 || 59) || (25 * v3)) <= ((v0 ? v3 : v0) ? (v1 / 5) : (67 * 9)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((65 - a1[2][12]) > 53) break;
+            v2 = (((55 >= a1[2][3]) >= (i2 * v2)) > ((i2 >= v3) ? (4 >= 84) : (v0 && i2)));
+            v3 = (((v1 <= 41) <= (i2 != v2)) + ((i2 * v3) <= (76 + 12)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v3 = (((a1[2][7] < 22) == (v2 ? a1[1][3] : a0[4])) > ((a0[14] ? a0[1] : v3) / 3));
+                    v0 = (((65 < i2) && (i3 && a1[0][12])) + ((i3 && a1[0][4]) - (v3 + a1[2][6])));
+                    v1 = (((a0[12] && v0) != (a0[10] * v0)) % 7);
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((a0[1] + a0[3]) - (98 + v1)) != ((75 ? a0[15] : a1[3][5]) < (v0 < 29)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,137 @@
+int f0() {
+    int v0 = 31;
+    int v1 = 27;
+    int v2 = 9;
+    int v3 = 66;
+    int a0[16];
+    int a1[4][16];
+    a1[0][13] = (((a1[0][4] + 57) % 4) % 5);
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v1 > 57) - (v3 - v3)) * ((a1[0][14] % 7) || (v0 > 92)));
+            a0[3] = (((v1 / 1) <= (12 == 9)) < ((i0 || 8) <= (v3 % 3)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((v2 ? i1 : i0) > 61) break;
+                v3 = (((a1[1][2] != i1) < (v0 - v3)) && ((87 > i1) + (a0[3] <= 95)));
+                v3 = (((20 % 5) != (i0 == a0[3])) || ((v3 / 3) < (a1[3][14] <= v0)));
+                a1[1][8] = (((a0[9] >= v3) <= (83 < v3)) != ((a1[1][8] >= 32) <= (v3 < a1[0][11])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v1 = (((v0 || 81) > (i2 % 9)) - ((v0 ? 66 : v3) == (i2 || v2)));
+            a1[3][8] = (((22 / 5) >= (a1[2][0] >= i2)) < ((v3 && v3) || (i2 ? i2 : 73)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((19 * v1) > 88) break;
+                    v0 = (((a1[3][8] % 4) <= (v2 && v1)) && ((v0 / 8) > (v2 || a0[2])));
+                    v3 = (((v1 != a0[3]) + (14 || v3)) != ((53 - 23) && (v0 == i2)));
+                    a1[1][11] = (((a1[1][11] > i3) <= (33 / 8)) % 3);
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v2 = (((v0 < a0[2]) ? (a1[1][6] * v1) : (v0 == a0[14])) - ((a0[14] ? 2 : v0) >= (a0[9] && 20)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((v2 && v0) / 7) + ((a1[0][14] / 2) ? (i5 == i5) : (v2 <= v2)));
+                    a1[0][0] = (((41 == i4) < (a1[2][9] ? a0[14] : v1)) % 8);
+                    a0[2] = (((v0 == v3) == (22 && 97)) / 9);
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((v3 + i4) * (a1[0][0] / 8)) / 6);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 ? a1[0][3] : a1[1][5]) || (a0[7] <= a1[0][11])) && ((v3 + a1[0][8]) <= (a0[5] - 13)))) {
+        v2 = (((a1[3][6] || a0[15]) - (25 + v0)) == ((57 * a0[15]) > (v0 ? a0[14] : a0[2])));
+        a1[0][0] = (((v0 * v2) * (43 - a1[2][5])) < ((a0[13] ? a1[1][14] : 37) != (a0[9] != v1)));
+        v1 = (((v2 >= v3) != (a1[3][0] >= 10)) <= ((63 < v0) && (v3 < 47)));
+    } else {
+        v1 = (((35 == v1) >= (v1 ? v1 : a1[1][14])) > ((v1 < v2) == (a1[0][6] == 60)));
+        a0[4] = (((v3 && 82) / 5) == ((v1 ? v2 : v3) > (v2 != v2)));
+        v2 = (((v0 - a0[5]) * (v0 < a0[9])) * ((v0 ? 74 : a0[15]) && (v1 > 91)));
+    }
+    return (((v2 * v1) < (v3 && a1[2][7])) % 1);
+}
+int f1() {
+    int v0 = 60;
+    int v1 = 88;
+    int v2 = 10;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    if ((((39 ? v1 : v0) - (90 && v3)) == ((v0 != v0) || (90 ? a0[8] : a0[7])))) {
+        v2 = (((v1 >= 41) == (v1 % 3)) < ((v2 == 98) * (v2 && v0)));
+        a1[1][2] = (((a1[0][0] < a1[1][12]) + (v3 < v1)) && ((v0 * 67) % 8));
+        a1[0][1] = (((v1 == v0) >= (v3 / 3)) >= ((v0 >= 20) ? (v0 - v2) : (v1 == 68)));
+    } else {
+        v3 = (((a0[4] && 13) != (a0[4] < a0[5])) - ((v0 <= a1[0][6]) / 7));
+        v0 = (((v1 >= v1) - (v3 * v2)) > ((v2 < v3) % 3));
+        v0 = (((91 || v2) - (a0[5] == a1[0][6])) * ((v1 / 5) / 2));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[6] = (((a0[3] == v2) % 9) + ((v1 && v1) ? (v1 != i0) : (a0[6] <= v2)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a1[1][11] = (((v3 + 66) || (71 <= i1)) ? ((v2 < v0) / 4) : ((i0 % 2) / 6));
+                    v0 = (((i1 % 5) && (i0 * i1)) == ((v1 ? v2 : a1[3][11]) != (a1[2][9] || 57)));
+                    v1 = (((v2 == a1[1][14]) < (v3 / 4)) == ((40 + 56) * (v3 && a0[14])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][10] = (((v3 <= a1[0][14]) || (a1[2][10] && 61)) ? ((20 - 78) - (v0 >= v1)) : ((v2 || v3) >= (79 ? 10 : 36)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a1[3][11] = (((v2 || i2) - (v2 / 8)) - ((v0 >= v0) + (62 + v3)));
+            v3 = (((v1 >= v0) == (i2 >= v1)) != ((v3 <= v1) <= (57 <= v3)));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((a0[5] != v1) != (v1 && v2)) > ((a0[6] <= a1[0][12]) == (70 - v0)));
+                    v3 = (((v2 + i3) ? (v0 ? v2 : v1) : (a1[1][6] * v2)) > ((51 - a0[8]) ? (v1 || v2) : (a0[2] > i2)));
+                    v1 = (((v2 ? 23 : v1) % 2) <= ((38 == v0) == (27 && a0[13])));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a1[0][15] = (((i4 > v3) < (v1 >= v2)) / 5);
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v1 = (((51 || a1[3][12]) && (i4 * v0)) <= ((94 && v3) > (a1[2][0] + v0)));
+                a1[2][6] = (((a1[1][9] / 5) % 6) * ((60 == i4) / 8));
+                a1[3][6] = (((v1 <= 91) == (v0 != a1[2][1])) * ((a0[13] < a1[3][8]) && (v3 % 1)));
+            }
+            a1[1][14] = (((a0[15] < v2) ? (v1 || 13) : (v0 - v3)) + ((39 || 81) != (a1[1][7] == v3)));
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((v0 != a0[1]) != (a0[11] >= v2)) || ((v0 >= a1[1][11]) == (a0[7] >= v3)));
+    return (((v3 % 9) / 4) < ((78 > v0) == (1 && v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,207 @@
+int f0() {
+    int v0 = 48;
+    int v1 = 79;
+    int v2 = 46;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[13] != a1[3][4]) != (16 ? v3 : v2)) || ((a0[11] && v2) * (v1 <= v3)))) {
+        v1 = (((27 > 70) && (v1 || a0[11])) >= ((v1 != v0) == (v3 < v0)));
+        a1[2][3] = (((95 ? 63 : a0[13]) ? (v1 / 4) : (v3 < v2)) >= ((5 % 7) ? (7 <= a0[14]) : (v3 <= v0)));
+        v0 = (((15 % 9) ? (a1[2][0] > v0) : (a1[0][12] % 2)) - ((v3 / 5) > (v0 - v3)));
+    } else {
+        v0 = (((v0 >= v0) ? (22 ? 22 : v1) : (v3 - a1[1][1])) == ((v3 == a1[0][6]) || (61 < v3)));
+        v3 = (((a0[1] + v3) * (v2 ? v2 : v0)) && ((28 || 82) || (v1 * a1[3][1])));
+        v1 = (((59 && v3) - (v0 + v1)) * ((77 < v0) / 8));
+    }
+    v3 = (((v2 / 4) > (v0 ? 41 : a1[2][15])) - ((69 || a0[6]) / 1));
+    if ((((42 < v2) - (17 ? v2 : a1[0][11])) > ((a1[3][1] ? v2 : a0[2]) || (25 < a1[0][6])))) {
+        a1[2][15] = (((40 + 42) >= (v0 ? 95 : v3)) == ((a0[15] != 18) <= (10 % 8)));
+        v3 = (((v2 - v2) == (a0[10] % 4)) <= ((v2 / 4) != (v2 ? v3 : v3)));
+        v3 = (((v1 / 8) >= (v1 >= v0)) && ((v2 - a0[1]) * (v2 < v0)));
+    } else {
+        v3 = (((75 % 3) ? (v2 ? v3 : v1) : (93 >= v3)) % 1);
+        v0 = (((58 || a1[3][11]) < (v0 <= a1[3][14])) >= ((a1[1][9] <= v1) <= (a1[1][5] >= 32)));
+        a0[12] = (((v2 ? a1[2][5] : v2) || (v3 >= a0[2])) / 6);
+    }
+    if ((((v0 == v3) + (v0 % 2)) / 2)) {
+        a0[15] = (((a1[0][2] ? v2 : 19) <= (v1 > v2)) <= ((57 <= a0[8]) < (84 >= 71)));
+        v3 = (((a1[2][2] != 7) && (v0 ? v1 : a0[0])) ? ((v3 != v1) ? (v1 + v0) : (53 ? 43 : a1[2][2])) : ((a0[3] + v3) + (v2 ? 76 : v3)));
+        v3 = (((v3 <= v1) - (v3 <= v0)) < ((v1 + a0[14]) % 6));
+    } else {
+        v1 = (((v3 % 4) || (v1 != a0[7])) - ((v1 % 9) % 7));
+        a0[11] = (((v1 ? a1[1][0] : v0) >= (v1 <= 85)) ? ((v3 - v3) - (a0[15] != v0)) : ((v3 + v2) && (50 + v2)));
+        v3 = (((a0[0] ? 99 : 65) + (v1 || a0[7])) >= ((v0 * a0[9]) / 2));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v3 = (((v1 < i0) || (v3 / 9)) ? ((v3 - i1) + (41 > v1)) : ((v1 * a1[1][9]) / 5));
+                v3 = (((v0 <= a1[2][7]) * (a1[2][7] < a0[8])) || ((i1 != v1) < (a1[3][10] >= 75)));
+                v0 = (((11 < 8) == (81 * a1[2][8])) > ((i1 > 40) <= (i1 / 2)));
+            }
+            a1[2][8] = (((v1 > 79) - (v0 != v2)) ? ((a1[3][1] - i0) - (v1 != a1[2][14])) : ((a0[0] - a1[0][2]) < (v2 % 9)));
+            v2 = (((v1 >= 31) - (17 < a0[15])) * ((a1[3][12] == v3) % 2));
+            i0 = i0 + 1;
+        }
+    }
+    return (((16 == 27) ? (90 > v1) : (v1 / 1)) && ((a1[0][2] ? v3 : v1) >= (a1[2][5] <= 8)));
+}
+int f1() {
+    int v0 = 77;
+    int v1 = 40;
+    int v2 = 20;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            if ((i1 / 1) > 98) break;
+            a1[2][9] = (((v0 - a1[0][3]) == (v0 / 4)) >= ((a1[2][14] >= i1) ? (a0[8] - a0[7]) : (v1 != v3)));
+            v1 = (((a0[11] * i1) + (i0 || 77)) - ((i1 - i0) <= (v3 ? v1 : i1)));
+            v1 = (((v1 != v0) == (27 / 7)) > ((v1 && i1) != (a0[8] ? 67 : 53)));
+        }
+        a1[2][2] = (((v0 && v0) <= (a1[1][15] || i0)) > ((14 ? 5 : v1) > (83 <= i0)));
+        v1 = (((v1 ? 65 : v3) == (v2 >= v3)) || ((v2 > v3) < (v1 == 93)));
+    }
+    if ((((a1[1][10] + v0) >= (v1 && v2)) != ((57 - 85) ? (v1 || v3) : (a1[0][5] != v0)))) {
+        a1[3][11] = (((v2 < v1) / 1) ? ((v2 < v0) && (a1[0][3] >= a0[0])) : ((64 < v2) || (v1 == a0[8])));
+        a1[2][11] = (((74 < v3) || (v0 <= v0)) > ((v1 < v3) / 6));
+        v3 = (((a0[12] >= 13) > (v1 ? 72 : v3)) % 4);
+    } else {
+        v2 = (((a1[1][0] > 51) - (64 < v0)) != ((89 || a1[0][8]) * (v2 && v2)));
+        v3 = (((v1 / 5) > (v0 / 7)) / 5);
+        v3 = (((v3 || a1[1][9]) / 3) ? ((v2 || v3) != (a0[5] / 5)) : ((v3 % 2) ? (72 >= v1) : (v0 % 2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((i2 < 51) < (i2 ? 83 : v0)) == ((v3 / 2) > (16 * v3)));
+            {
+                int i3 = 0;
+                do {
+                    if ((71 < 57) > 98) break;
+                    v2 = (((84 * a0[12]) <= (i2 ? i2 : v2)) > ((v0 ? 70 : v2) != (v3 > v3)));
+                    v1 = (((a1[2][14] < v0) / 1) || ((a1[1][0] * 48) * (i2 > v0)));
+                    v2 = (((v1 || a1[1][4]) != (v2 + 48)) == ((v2 != a0[9]) && (34 % 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            a0[15] = (((v2 >= v3) ? (8 ? v0 : v1) : (v1 / 9)) ? ((v2 / 7) <= (v2 != 33)) : ((90 * i2) == (v2 && v0)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v1 = (((a1[2][15] <= v1) != (a1[0][10] + a0[4])) > ((v1 % 8) / 7));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v2 = (((v0 % 1) / 9) - ((a0[13] * v1) >= (v3 >= 57)));
+            v3 = (((a0[13] > 65) && (v2 && v0)) > ((i5 == a1[1][11]) % 5));
+            v3 = (((i4 ? 8 : 83) > (v2 * a1[2][5])) == ((i5 != i4) || (45 - v2)));
+        }
+        v2 = (((v2 <= a1[1][15]) ? (v0 || a0[8]) : (v0 <= v0)) > ((1 > v3) + (v0 >= a0[7])));
+    }
+    if ((((a0[8] + v2) ? (v1 > v1) : (v1 ? a1[2][3] : 18)) > ((v1 + v3) != (77 ? 68 : a1[0][14])))) {
+        v3 = (((a1[1][7] > v1) || (a0[3] >= 96)) ? ((v0 < a0[15]) <= (v0 < v3)) : ((32 == 34) || (v0 == v3)));
+        a1[3][15] = (((0 != 17) == (a0[5] ? v0 : v1)) - ((69 == v0) / 8));
+        a0[12] = (((a0[6] > v0) != (v1 < 10)) < ((a0[12] % 1) == (a0[13] / 1)));
+    } else {
+        v3 = (((33 / 6) >= (v2 > v0)) ? ((v3 <= v3) && (48 ? v3 : 65)) : ((v0 - 16) ? (v0 ? v2 : 69) : (v3 * v2)));
+        v3 = (((v0 == v3) != (v1 >= 42)) >= ((v3 / 3) > (a1[0][8] < v0)));
+        v0 = (((v2 && v3) != (v2 - a0[1])) >= ((v2 <= v3) == (v3 <= v1)));
+    }
+    return (((a1[2][15] < a1[1][13]) >= (a1[2][13] >= 27)) < ((v1 > v3) ? (a0[5] != v0) : (a0[1] % 8)));
+}
+int f2() {
+    int v0 = 28;
+    int v1 = 87;
+    int v2 = 38;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((73 ? 79 : v0) / 3) || ((81 == v3) < (a1[2][11] ? i0 : 70)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v1 > v3) ? (v3 < i1) : (v0 > 68)) - ((v1 % 9) ? (a0[13] - v2) : (95 && v2)));
+                    v0 = (((v3 / 5) * (26 - v3)) + ((v2 < i1) + (i1 < a0[0])));
+                    a1[1][3] = (((v2 <= 23) < (10 > 38)) ? ((a1[3][15] == i1) > (79 != a0[3])) : ((6 * v0) < (v1 ? a1[0][13] : v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((v1 >= v0) / 9) < ((a1[1][10] / 1) / 2));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v0 = (((v2 % 9) * (8 / 3)) == ((77 <= a0[7]) == (16 || i2)));
+            {
+                int i3 = 0;
+                do {
+                    a0[11] = (((a1[0][4] != v2) % 7) < ((a0[8] > v0) < (v1 * v3)));
+                    v1 = (((v0 >= v1) ? (v2 < v3) : (i3 > a1[2][3])) == ((a0[9] < v0) + (a1[2][0] - a1[2][3])));
+                    v2 = (((a0[2] && i3) % 3) == ((v2 >= v1) <= (v1 / 6)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v2 = (((v0 - v0) == (76 * v2)) <= ((v1 > v2) % 4));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v3 = (((a1[0][13] % 7) || (v3 - 4)) <= ((49 - v2) || (a1[2][15] * i4)));
+                    a1[1][15] = (((v2 ? v2 : i5) ? (a1[2][0] % 8) : (v0 > a1[2][0])) == ((v0 + a0[1]) * (a1[3][1] ? a1[1][8] : i5)));
+                    a0[3] = (((a1[0][15] || a0[1]) >= (a0[2] && v0)) && ((v1 && i4) > (v0 / 5)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v2 ? v1 : a0[3]) % 3) ? ((86 * v3) || (v2 >= 66)) : ((91 > 42) * (v3 * 7)));
+            v3 = (((v1 >= v2) < (a0[13] == v3)) + ((v2 + v1) != (74 != a1[2][14])));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v1 = (((v2 >= i6) + (a1[0][7] != v0)) != ((24 * i7) >= (18 < i7)));
+                a0[6] = (((i7 * a1[0][6]) > (13 > v2)) || ((a1[2][0] != i7) - (a1[1][15] <= 71)));
+                v3 = (((29 ? a0[4] : 28) ? (v0 <= 31) : (83 > v0)) - ((77 && v2) * (a0[12] ? 26 : v0)));
+            }
+            a1[1][1] = (((v1 && v0) || (i6 < v0)) == ((v3 && 46) && (v0 && i6)));
+            v0 = (((51 >= v3) >= (v2 - v2)) ? ((v1 % 7) + (1 * v3)) : ((i6 == a0[11]) < (v3 <= a1[0][11])));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            v2 = (((i8 % 4) - (70 % 2)) ? ((v0 - 78) || (25 && 8)) : ((39 < a1[1][14]) != (v3 - 1)));
+            v3 = (((v2 || a0[2]) ? (v1 * v0) : (v1 + 3)) % 9);
+            {
+                int i9 = 0;
+                do {
+                    v3 = (((v2 || a1[0][13]) < (v2 || a1[2][2])) + ((a1[2][8] + a0[1]) ? (34 / 8) : (23 - v2)));
+                    v0 = (((a1[3][11] && v2) || (i8 % 9)) ? ((a1[1][4] >= i9) - (a1[2][9] ? 94 : 82)) : ((v0 && 24) > (a1[0][11] ? a0[11] : v2)));
+                    v1 = (((i9 ? a1[1][14] : 38) % 2) >= ((a0[7] != v0) ? (a0[12] <= i9) : (9 * 43)));
+                    i9 = i9 + 1;
+                } while (i9 < 5);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((a1[0][10] < v3) ? (v1 ? 22 : v3) : (a0[15] != a0[14])) >= ((v0 - v0) <= (v0 >= 58)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,58 @@
+int f0() {
+    int v0 = 95;
+    int v1 = 29;
+    int v2 = 51;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((i0 >= v2) > 65) break;
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a1[1][11] = (((76 < a1[0][10]) || (i1 ? i1 : a0[0])) % 6);
+            v1 = (((a1[2][7] < v1) == (a0[0] + a1[3][4])) % 4);
+            v0 = (((65 * a0[14]) * (v3 < a0[11])) >= ((i1 > v2) * (12 && a1[2][7])));
+        }
+        a1[2][10] = (((v0 <= v2) ? (v3 - v3) : (i0 > 84)) > ((v0 && v2) * (v1 || 59)));
+        v2 = (((a0[15] || a0[0]) > (i0 ? v0 : 49)) <= ((i0 % 8) != (84 / 2)));
+    }
+    v3 = (((70 - v3) > (a1[3][0] ? v2 : 44)) || ((v3 < 49) ? (a1[0][3] > v2) : (v3 <= v1)));
+    if ((((57 >= v1) && (v1 % 5)) <= ((a1[3][8] * v3) ? (v2 > a0[10]) : (v3 <= a1[1][7])))) {
+        v2 = (((v3 != 49) < (v3 + v3)) + ((v3 % 3) * (v3 == 9)));
+        v0 = (((11 + 16) / 7) > ((14 >= a1[3][1]) < (a0[10] - v2)));
+        v3 = (((a0[6] < a0[10]) * (v3 != a0[2])) < ((v1 * 26) > (a1[2][3] * v0)));
+    } else {
+        v3 = (((v3 <= 6) <= (a1[0][6] + 66)) * ((49 > v1) > (v1 != v0)));
+        v3 = (((v1 > v2) + (a1[3][5] % 3)) <= ((a1[0][8] / 1) <= (47 ? v3 : v1)));
+        v2 = (((v2 % 5) + (v0 ? 91 : a0[11])) || ((a1[1][14] % 9) - (v0 && v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v2 = (((i2 == v1) >= (a0[7] * 23)) && ((v1 && a0[3]) ? (v3 ? 28 : v2) : (v0 ? 31 : a1[0][12])));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v2 = (((v2 * v0) ? (46 - a0[11]) : (a1[3][5] + a1[2][2])) ? ((v3 >= a1[1][15]) ? (v1 / 1) : (15 * 4)) : ((33 - a0[15]) > (37 ? 44 : 19)));
+                    v1 = (((v3 ? a1[2][8] : v2) ? (v2 >= a1[2][0]) : (v2 > v2)) - ((v2 * 97) % 1));
+                    v0 = (((a0[0] < 96) * (81 ? a0[1] : 72)) * ((64 || v2) != (14 ? a1[0][7] : v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((i2 ? a1[1][3] : a0[4]) && (v0 <= i2)) ? ((v0 ? 37 : 14) % 7) : ((a1[1][0] + a1[2][7]) ? (a0[4] + a1[0][9]) : (v3 ? i2 : v3)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 > v2) != (v0 + a1[0][2])) && ((v3 ? a0[0] : 66) >= (v3 + v1)))) {
+        a1[1][12] = (((46 ? v2 : v3) > (75 * v1)) <= ((73 - v1) ? (a0[7] % 9) : (a0[15] || a1[2][11])));
+        v0 = (((40 <= v0) * (14 != v1)) + ((21 < 33) ? (v0 % 8) : (a1[2][11] || v2)));
+        a1[3][7] = (((a0[8] * v3) * (v2 == v2)) < ((a1[1][11] ? v0 : v0) && (v0 / 3)));
+    } else {
+        v0 = (((v1 >= 41) <= (v2 >= a0[13])) || ((v3 && 29) ? (v1 - v2) : (a0[14] >= v0)));
+        a0[13] = (((a0[12] % 9) ? (46 + v0) : (v3 + v1)) <= ((v3 <= v0) % 4));
+        v1 = (((v1 < v2) + (85 && 87)) != ((a0[6] - v0) - (55 * a0[11])));
+    }
+    return (((a0[9] >= v0) * (88 <= v2)) % 7);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,123 @@
+int f0() {
+    int v0 = 45;
+    int v1 = 5;
+    int v2 = 77;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 ? 91 : 72) < (v0 <= v3)) / 8)) {
+        v2 = (((86 == v3) == (64 % 4)) ? ((a0[2] == v0) <= (v3 * a1[2][0])) : ((a0[9] % 1) != (86 != v3)));
+        a0[8] = (((v2 != a1[1][5]) > (a1[1][12] % 7)) <= ((v1 > v0) < (77 == v1)));
+        v0 = (((v3 > 98) < (a1[0][4] <= v0)) >= ((v1 && v0) - (a1[0][14] % 4)));
+    } else {
+        v0 = (((92 <= 2) % 2) - ((48 > 39) == (v3 > 18)));
+        v3 = (((73 >= 0) >= (v3 != a0[12])) >= ((v3 * v1) < (v1 ? v2 : v1)));
+        a1[1][1] = (((a1[1][11] ? a0[4] : a1[3][11]) < (46 == v2)) ? ((v1 == v3) - (v1 ? v3 : v1)) : ((v1 <= 43) && (a1[2][0] && a1[3][7])));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            a0[11] = (((v1 ? 87 : v1) == (79 ? v0 : v3)) * ((i0 - v1) <= (v1 % 2)));
+            v1 = (((v3 <= 34) <= (v0 >= v0)) ? ((i1 > v3) > (a0[0] && v0)) : ((44 && a1[1][5]) > (v3 - a0[0])));
+            a0[9] = (((v3 + v3) || (4 % 1)) <= ((a0[10] < a1[2][13]) * (16 ? a0[15] : v0)));
+        }
+        a0[9] = (((28 < a0[2]) && (v3 + a1[0][13])) >= ((20 ? v3 : i0) && (23 == a1[0][11])));
+        a0[1] = (((a0[12] - 75) || (3 && i0)) >= ((i0 <= 32) % 6));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[1][3] = (((i2 / 6) >= (v0 * 14)) > ((42 ? v0 : 7) || (7 >= v2)));
+            v3 = (((a1[3][8] / 7) >= (49 || v0)) < ((v0 > v3) <= (a0[3] % 5)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a0[15] = (((v1 > a0[2]) < (a0[14] >= a0[4])) >= ((i3 >= i3) == (i2 == a0[3])));
+                    v0 = (((a1[1][7] < 0) % 8) || ((36 >= a0[10]) != (v2 / 6)));
+                    v2 = (((a0[7] + 34) && (v0 >= 80)) >= ((a0[9] + 69) < (i2 % 6)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((a0[12] != 6) || (v1 != v0)) >= ((v0 ? v3 : v1) <= (v0 ? v3 : 76)))) {
+        v2 = (((v3 <= 68) || (a0[3] % 2)) * ((72 >= 28) % 6));
+        v1 = (((v0 * v2) && (v0 / 4)) / 9);
+        a0[10] = (((a1[1][12] - a1[0][10]) ? (a0[14] ? v2 : v0) : (v2 * 50)) && ((v3 < v1) >= (45 != a0[6])));
+    } else {
+        v1 = (((v1 * 60) >= (v0 >= 8)) % 5);
+        a0[4] = (((28 > v3) <= (a0[3] + v0)) >= ((a1[2][2] > 13) > (a0[2] - v2)));
+        a1[1][4] = (((a1[0][11] < 52) >= (79 ? v1 : 23)) + ((54 ? v3 : v2) == (v1 <= 46)));
+    }
+    if ((((12 - 54) * (a0[8] <= v3)) + ((v1 && v1) <= (39 > 46)))) {
+        a1[1][8] = (((v2 > 80) != (v0 - 86)) % 4);
+        v1 = (((v0 >= v0) ? (a0[7] - 19) : (v0 != a1[0][6])) <= ((v0 || a0[8]) + (a0[12] >= v3)));
+        v2 = (((25 + 71) ? (v0 <= v1) : (74 > a0[0])) != ((v1 > v1) < (v2 > v2)));
+    } else {
+        v0 = (((v2 >= 49) + (v2 - v1)) >= ((a0[3] - 56) <= (94 / 8)));
+        v0 = (((a0[14] / 5) ? (v1 != v3) : (a0[3] || 73)) - ((v3 < v3) && (v0 ? v2 : 11)));
+        a0[2] = (((v1 && 22) <= (a1[1][3] || 70)) * ((a1[0][0] == v2) && (a1[3][5] > a1[1][3])));
+    }
+    return (((a0[14] * v2) % 1) || ((a1[0][14] >= a0[5]) + (a1[3][0] <= v0)));
+}
+int f1() {
+    int v0 = 60;
+    int v1 = 59;
+    int v2 = 72;
+    int v3 = 60;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 - a1[2][13]) < (v0 > 98)) >= ((v0 * 9) ? (28 > a1[2][8]) : (43 && a1[0][9])));
+    {
+        int i0 = 0;
+        do {
+            a1[1][2] = (((i0 <= a0[6]) != (v3 - v1)) > ((a0[13] && v3) * (82 == v0)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v0 = (((v3 >= 73) > (v2 || a0[11])) ? ((v1 || 39) || (i1 - 69)) : ((a0[6] + i1) != (a1[0][13] * v2)));
+                    v2 = (((i1 % 6) + (33 || v0)) ? ((a1[2][7] + 76) <= (i1 == i1)) : ((v1 <= v0) && (v3 <= 12)));
+                    v2 = (((v1 == 80) ? (i0 / 9) : (7 * v3)) <= ((24 ? a0[7] : 48) && (a1[3][7] != i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[4] = (((i0 - 3) ? (v1 ? a0[3] : i0) : (v2 - i0)) ? ((64 / 6) >= (v0 > v2)) : ((v3 + v2) <= (v3 < v2)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    a1[3][1] = (((v0 < a1[0][8]) ? (v2 ? v2 : 42) : (a1[0][12] * a1[0][4])) && ((a0[9] % 9) - (v0 <= v2)));
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v1 = (((a0[13] < v0) % 9) < ((v2 + i2) <= (v0 * v0)));
+                a0[15] = (((i3 * v2) + (a0[11] ? a0[2] : 80)) > ((44 >= v1) + (v2 % 6)));
+                v2 = (((94 != a0[15]) == (a1[0][4] || i2)) != ((v3 + v1) ? (v3 ? v1 : v0) : (v0 > 53)));
+            }
+            v0 = (((88 < a0[13]) - (v2 && i2)) % 2);
+            v3 = (((v3 == 76) != (a0[4] % 2)) || ((a0[1] / 2) - (38 - a1[2][14])));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((i5 != v3) == (i4 ? 71 : a1[1][0])) == ((65 >= i5) || (a0[2] && 19)));
+                    a0[3] = (((a1[2][0] + v3) || (v0 ? 18 : a0[4])) + ((a1[2][12] / 4) - (a0[3] < v1)));
+                    v0 = (((v3 > i4) == (i4 < i4)) / 7);
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((52 < 35) || (65 <= a1[2][13])) && ((v2 == 39) > (61 > a1[0][15])));
+            v2 = (((v0 < a0[5]) != (v2 * v0)) + ((v0 <= 53) || (i4 ? i4 : v2)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((v0 - v0) || (59 ? v0 : v0)) == ((69 % 8) <= (v0 * v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,186 @@
+int f0() {
+    int v0 = 24;
+    int v1 = 85;
+    int v2 = 14;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((a1[2][15] % 6) > 64) break;
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v2 / 5) < (i1 || i0)) != ((85 + 15) && (i1 ? v1 : a0[12])));
+                    v2 = (((i0 % 8) == (92 / 9)) == ((v2 <= v0) ? (a1[3][0] ? v1 : v0) : (a1[1][4] != a0[1])));
+                    v1 = (((v3 ? a1[1][8] : v3) >= (i1 % 4)) % 8);
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a0[3] = (((26 == a1[1][2]) / 6) ? ((v0 || v2) <= (36 < v3)) : ((35 - v1) < (a1[1][6] + v1)));
+            v3 = (((7 < v2) * (v2 && v3)) > ((i0 + i0) != (v3 / 5)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[5] != v3) ? (v0 < a0[12]) : (72 - v1)) == ((v1 - 95) % 6))) {
+        v1 = (((a0[14] < v1) != (v3 <= a0[6])) ? ((45 && 5) ? (a0[6] >= a0[14]) : (45 && 61)) : ((30 / 9) > (89 >= v1)));
+        v2 = (((a0[15] > 77) % 6) != ((v2 == 54) != (43 ? a0[5] : a0[4])));
+        v2 = (((v1 + v0) <= (35 != v3)) && ((v1 <= v2) * (a0[12] > v3)));
+    } else {
+        v3 = (((v0 - v0) / 9) % 4);
+        v1 = (((a1[2][1] % 1) && (v1 < a0[9])) == ((a0[14] >= v2) - (a1[2][4] ? 19 : v3)));
+        a1[2][8] = (((35 > 41) / 8) && ((v2 % 8) % 9));
+    }
+    a0[11] = (((v1 ? v0 : v0) >= (75 && 47)) && ((a1[1][15] != v0) ? (v2 < 19) : (59 * v0)));
+    {
+        int i2 = 0;
+        do {
+            if ((4 % 5) > 77) break;
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v0 = (((v3 >= v2) ? (v1 - i2) : (v2 > i2)) / 2);
+                v2 = (((v3 % 6) ? (a0[7] || 89) : (a0[0] / 7)) >= ((87 != a1[3][0]) ? (i3 / 2) : (26 % 5)));
+                v3 = (((v2 == i3) == (v0 % 4)) > ((i2 && 75) && (i3 + i3)));
+            }
+            a1[3][10] = (((v1 / 7) >= (35 / 6)) || ((a0[4] / 2) > (i2 * v3)));
+            v2 = (((7 - i2) ? (a1[1][7] != i2) : (27 / 4)) < ((a1[2][13] != v2) % 5));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v1 = (((v3 * 29) != (91 <= v0)) ? ((70 / 9) >= (79 % 4)) : ((a1[2][15] >= a1[1][0]) != (a1[2][12] < v2)));
+    return (((v3 ? 83 : 49) ? (v0 - v2) : (51 != v0)) || ((a1[2][8] < v0) / 2));
+}
+int f1() {
+    int v0 = 25;
+    int v1 = 93;
+    int v2 = 23;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((30 == v2) || (a0[8] * 44)) * ((v1 <= v2) ? (i0 >= v0) : (i0 % 9)));
+            v2 = (((v0 || v2) == (v1 % 5)) <= ((31 <= 61) == (56 == a1[3][0])));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a0[14] != v2) == (14 < a1[3][9])) && ((a0[9] >= a0[2]) ? (v3 > i1) : (a0[7] * v2)));
+                    v0 = (((a1[0][11] >= v1) != (v0 < 22)) == ((71 >= v3) ? (v0 / 6) : (i0 / 8)));
+                    a1[3][11] = (((i0 ? 70 : i0) % 8) >= ((i1 > 66) % 7));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 ? v3 : v2) && (a0[3] < v1)) < ((v2 > v0) >= (v0 && 18)))) {
+        a1[1][3] = (((20 && v3) > (a1[1][11] >= a1[1][2])) > ((24 * v2) + (58 || v1)));
+        v0 = (((v0 ? v2 : v2) == (a0[15] < a1[3][15])) + ((v3 != v2) <= (a1[3][13] ? a0[0] : a0[13])));
+        a1[3][3] = (((46 ? 49 : v3) + (v2 <= a0[14])) >= ((a0[1] / 5) * (20 && a1[3][10])));
+    } else {
+        a1[3][2] = (((a0[7] % 1) ? (a1[0][6] > v3) : (a0[12] >= a1[3][0])) && ((9 % 7) || (v1 < v1)));
+        a1[1][14] = (((6 > a0[4]) ? (a1[2][15] + v1) : (a0[8] / 2)) || ((83 || 43) > (a1[1][5] != 99)));
+        v0 = (((35 || 58) <= (17 == v1)) >= ((25 * v3) ? (91 - a1[3][15]) : (v0 > 75)));
+    }
+    if ((((a1[1][3] >= v2) || (v3 > v3)) >= ((6 > 20) != (v3 <= a0[4])))) {
+        a1[1][14] = (((a1[3][11] >= a0[12]) >= (a0[3] <= v0)) - ((v2 > v3) * (a1[3][0] < 82)));
+        v3 = (((v2 % 1) == (v1 / 9)) ? ((v2 == 65) > (v2 <= v0)) : ((33 - v2) + (v2 || v3)));
+        a1[2][1] = (((a1[1][0] % 5) == (a0[8] || a1[0][4])) / 4);
+    } else {
+        a0[2] = (((85 ? 93 : a0[0]) != (v0 && v2)) - ((71 ? v3 : v1) <= (v0 == v0)));
+        a0[15] = (((v2 ? a1[1][8] : v3) >= (v2 % 5)) >= ((10 != v2) == (a1[0][3] - a0[0])));
+        a1[0][5] = (((a0[3] / 7) * (v3 ? 23 : a1[2][6])) ? ((75 != v3) >= (v3 ? 80 : 25)) : ((a0[2] / 3) ? (39 || v0) : (v1 / 8)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((v2 >= a0[7]) > 83) break;
+        v1 = (((a0[3] + 15) < (a1[1][12] ? v1 : 54)) && ((53 ? a0[2] : a1[2][0]) ? (a1[0][2] + 90) : (v1 < a0[7])));
+        v2 = (((v1 && v0) ? (a1[1][1] * v0) : (v2 * i2)) >= ((a1[2][0] - 5) % 8));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v3 = (((v2 * v0) <= (v3 || 66)) + ((a1[1][5] * v1) + (i3 ? i2 : v1)));
+            a0[0] = (((a1[3][15] ? v2 : v1) == (v3 > 79)) ? ((i2 ? a1[0][15] : 63) / 4) : ((i3 || 78) < (v0 - 42)));
+            v3 = (((a0[11] && a0[9]) + (v2 == 90)) % 8);
+        }
+    }
+    if ((((v0 == 37) > (58 * v3)) || ((v0 <= v2) / 2))) {
+        v2 = (((96 - 97) ? (v3 - a0[15]) : (v0 < v0)) * ((64 ? v2 : v0) ? (v2 < 86) : (86 >= v2)));
+        v2 = (((a1[3][2] / 3) + (v2 < v0)) / 5);
+        v2 = (((v2 <= v1) && (v3 - a1[1][9])) == ((69 != a0[5]) < (v1 <= a0[7])));
+    } else {
+        a1[0][8] = (((41 <= v0) || (18 ? 96 : v1)) - ((80 % 3) != (v3 >= v2)));
+        v2 = (((v1 != 50) == (14 != v2)) != ((v0 >= v3) > (v3 ? a0[6] : v1)));
+        a0[0] = (((a0[4] < v1) * (a0[9] + 78)) != ((v2 < 78) / 9));
+    }
+    return (((85 < v1) / 1) - ((57 - v2) + (a1[3][2] + v0)));
+}
+int f2() {
+    int v0 = 80;
+    int v1 = 16;
+    int v2 = 98;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    if ((((63 == v1) > (v2 ? v2 : a0[11])) / 1)) {
+        a1[0][15] = (((37 % 7) == (v2 && v1)) + ((25 % 8) * (v1 + v2)));
+        a1[0][14] = (((v3 >= v3) <= (v0 % 4)) < ((v3 - 79) < (v0 >= v0)));
+        v3 = (((35 || a0[0]) == (89 - v3)) * ((98 % 5) - (43 + v2)));
+    } else {
+        v0 = (((v0 + 46) == (a1[2][4] >= a0[7])) < ((v0 - v0) * (30 <= v3)));
+        v0 = (((v2 <= v3) < (a1[0][4] + v2)) >= ((12 * a0[13]) - (6 != a0[15])));
+        a1[3][14] = (((v3 ? v1 : v3) % 4) >= ((a0[13] == a1[0][0]) / 2));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v3 = (((v3 - v2) ? (i0 < a1[2][7]) : (v2 * 47)) == ((v3 || v0) * (a1[1][2] < v3)));
+        v3 = (((91 || a0[6]) != (11 == a0[0])) != ((86 ? 57 : a1[2][9]) < (v1 / 8)));
+        {
+            int i1 = 0;
+            do {
+                v1 = (((v1 >= a1[2][1]) ? (v2 % 9) : (v1 + v3)) - ((i0 - i0) <= (83 * v3)));
+                v0 = (((v1 ? 42 : a0[6]) < (a0[11] >= a1[2][15])) ? ((v3 < 65) / 3) : ((v0 == a1[0][12]) || (v3 - 65)));
+                v2 = (((v1 % 9) * (v3 >= 53)) * ((i1 >= 23) < (v2 <= v1)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        a1[0][14] = (((v3 <= 79) >= (a0[15] * v2)) ? ((35 + v3) != (v2 == i2)) : ((v1 ? v3 : v2) ? (74 < v0) : (v2 >= v3)));
+        v1 = (((37 || v0) * (78 && v1)) <= ((v2 != v2) + (v2 * a1[0][9])));
+        {
+            int i3 = 0;
+            do {
+                if ((79 == v0) > 58) break;
+                v2 = (((v3 / 1) * (22 && v0)) * ((v0 && v0) < (a1[3][3] != v0)));
+                a1[0][14] = (((v0 ? i3 : 2) > (38 || i2)) || ((v0 > v3) * (v0 ? v0 : a0[8])));
+                v2 = (((i3 / 5) - (v1 * a1[0][0])) - ((v2 >= 82) != (51 <= v0)));
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            a0[4] = (((v0 >= v3) != (v1 <= i4)) >= ((41 >= a0[5]) > (v0 != a1[1][0])));
+            v3 = (((i5 + v0) > (v2 * i4)) <= ((v3 ? v3 : 52) <= (a0[6] != a1[2][2])));
+            v1 = (((v1 || a0[7]) / 4) ? ((50 >= i5) < (a1[2][7] <= v1)) : ((i5 || 6) < (v1 / 5)));
+        }
+        v1 = (((36 ? v0 : a0[2]) % 8) || ((v1 < a1[3][9]) != (v3 < 70)));
+        a0[3] = (((72 + v0) && (a1[1][15] == v2)) || ((v2 && a0[12]) <= (a1[2][12] < v2)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[6] = (((a1[2][13] * v1) * (v0 != 82)) * ((v0 + 39) * (a0[10] <= v2)));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                if ((i6 < v2) > 61) break;
+                v0 = (((63 && v1) <= (v2 == 53)) > ((a1[2][11] && v1) >= (v0 >= v1)));
+                a1[2][12] = (((v2 <= i6) < (a1[3][10] <= a1[0][13])) % 8);
+                a0[7] = (((v0 != i7) > (a0[8] != v1)) * ((i6 / 4) * (v1 == i6)));
+            }
+            a0[15] = (((v0 || v1) && (15 / 6)) >= ((v2 % 3) + (i6 + v2)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((v2 * 8) % 9) % 1);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,63 @@
+int f0() {
+    int v0 = 18;
+    int v1 = 62;
+    int v2 = 43;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    a1[0][14] = (((v1 - v1) > (v1 ? a1[2][14] : 31)) + ((a1[0][2] != a1[3][12]) || (a1[2][6] / 1)));
+    {
+        int i0 = 0;
+        do {
+            if ((46 <= 5) > 63) break;
+            v3 = (((v0 + v1) - (a1[1][6] != i0)) < ((v2 * v0) / 7));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a1[2][2] = (((14 > a0[9]) ? (v1 - a1[1][12]) : (46 - i0)) / 8);
+                    v2 = (((i0 * v2) == (i0 != 97)) > ((a1[2][6] - v1) != (i0 % 9)));
+                    a0[14] = (((v3 * a1[1][7]) != (60 || a0[9])) ? ((i0 <= a0[11]) && (v2 >= i0)) : ((v1 - i1) ? (a1[0][1] * a0[8]) : (66 + a1[2][10])));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v3 || 72) >= (v2 * v2)) + ((v3 != a0[15]) % 8));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((69 == 51) > 94) break;
+            a1[1][3] = (((v1 >= i2) != (v2 - v3)) <= ((76 + a0[5]) + (a0[14] != v0)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v1 = (((a1[1][15] != v2) ? (a1[2][15] || i2) : (v0 ? a1[2][14] : v3)) > ((a0[13] && 0) != (v2 / 8)));
+                v3 = (((i3 || 62) - (v0 / 2)) < ((v1 % 5) > (v3 - v3)));
+                v0 = (((a1[0][11] <= i2) == (79 * v2)) < ((i2 > v0) ? (i3 && 86) : (i2 || 59)));
+            }
+            v3 = (((v3 < v3) >= (a1[2][2] % 1)) ? ((i2 > a1[3][12]) && (a1[0][10] && a0[3])) : ((4 ? v2 : 73) % 8));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v3 ? a0[10] : 56) * (v2 % 7)) && ((v3 - v1) % 8))) {
+        v0 = (((v1 ? a0[10] : a1[3][2]) ? (75 + v1) : (v1 - 80)) + ((65 || a1[0][11]) % 3));
+        v2 = (((v3 * 78) ? (89 ? v3 : v1) : (a0[9] || 23)) + ((a1[1][15] + v2) <= (a1[0][14] == a1[3][1])));
+        v0 = (((34 > v1) || (v1 + v2)) / 8);
+    } else {
+        v2 = (((v0 || v1) && (v0 ? v2 : v3)) ? ((a1[3][0] * v3) >= (v2 - a1[0][12])) : ((v0 % 9) * (v2 / 8)));
+        v3 = (((v3 / 1) && (v1 <= 21)) != ((v1 + a0[15]) != (v0 + v0)));
+        v3 = (((a1[1][11] != 15) || (v0 && v0)) <= ((v1 > v2) < (v0 ? a1[0][3] : v1)));
+    }
+    if ((((v2 && v3) || (v2 == a0[2])) ? ((v1 + 7) + (16 % 3)) : ((6 * a1[1][11]) - (40 <= 87)))) {
+        a1[2][15] = (((89 - v3) - (95 - v0)) * ((v1 >= 69) != (v0 ? a1[3][14] : a1[2][2])));
+        v3 = (((v0 >= v3) - (64 * v1)) >= ((37 / 6) ? (v0 <= v1) : (a0[3] != 83)));
+        v2 = (((v1 <= v3) % 8) == ((v3 >= v3) ? (v1 || 97) : (v2 <= v0)));
+    } else {
+        v2 = (((v0 / 5) ? (v3 <= 95) : (84 && v3)) > ((v3 - a1[3][7]) % 7));
+        a0[2] = (((v1 ? 51 : v2) >= (79 ? 67 : v1)) + ((a1[3][11] ? 62 : v2) ? (v1 <= 21) : (v2 && v3)));
+        a0[10] = (((a1[3][13] < 38) > (v2 * a0[4])) - ((v2 + 26) ? (97 / 1) : (86 != v2)));
+    }
+    return (((14 != v1) / 3) > ((v1 <= v2) / 1));
+}
+int main() {
+    return 0;
+}
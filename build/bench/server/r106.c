@@ -0,0 +1,128 @@
+int f0() {
+    int v0 = 78;
+    int v1 = 52;
+    int v2 = 93;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 && 78) || (89 != 16)) != ((v3 != a0[11]) ? (v1 + v3) : (v0 && a1[3][15])))) {
+        a1[3][4] = (((v1 % 8) + (a0[4] || v1)) != ((99 - v0) != (v1 ? a1[3][1] : a1[3][14])));
+        v2 = (((48 < v2) ? (v2 % 4) : (a1[3][4] ? 76 : v2)) > ((36 && a1[2][8]) + (v3 / 8)));
+        a0[5] = (((v0 < v3) != (v1 >= 82)) < ((v1 ? a1[1][11] : 99) * (v2 >= v0)));
+    } else {
+        a1[3][0] = (((v2 <= a1[0][12]) >= (a1[3][2] + a0[10])) || ((v0 || v2) * (v2 * a0[4])));
+        v0 = (((v1 >= 91) ? (v3 < a1[3][9]) : (a0[11] % 8)) != ((v1 - v2) ? (49 + v0) : (72 <= a0[14])));
+        v3 = (((v0 ? 49 : a0[7]) == (a1[2][6] && 17)) && ((v0 || v3) == (a1[1][11] - 27)));
+    }
+    if ((((53 / 5) >= (51 && v2)) < ((59 <= 99) ? (v2 / 1) : (17 > a0[9])))) {
+        v0 = (((v0 + a0[15]) && (v1 <= 54)) + ((a0[8] != v1) + (v1 || v2)));
+        v1 = (((26 > v2) % 4) - ((17 ? a0[4] : v0) ? (95 % 8) : (50 / 6)));
+        a0[4] = (((76 > v0) != (80 + 49)) % 3);
+    } else {
+        a0[9] = (((v0 + v2) + (31 ? 51 : a1[0][0])) < ((37 <= a1[0][12]) || (a0[10] ? v1 : v1)));
+        a0[2] = (((v2 % 5) ? (v2 && 99) : (18 && v3)) && ((a0[11] <= v2) > (98 && v1)));
+        a0[7] = (((97 < v1) < (v1 != v2)) || ((a0[13] / 1) + (v0 || 53)));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a0[5] = (((i0 == v0) == (a1[2][4] + 46)) || ((92 || a1[3][11]) || (i1 <= 69)));
+            v3 = (((v0 && 41) + (v3 - 66)) + ((14 == v3) ? (58 <= i0) : (a0[5] > v1)));
+            v3 = (((v0 == 41) / 8) < ((26 != i0) || (a0[6] - a1[2][0])));
+        }
+        a1[2][3] = (((i0 * v3) > (a1[3][12] % 4)) != ((a0[9] >= a1[0][2]) * (78 - 97)));
+        v3 = (((i0 && 44) <= (v3 ? 35 : 60)) - ((45 / 4) >= (62 ? v3 : v1)));
+    }
+    if ((((v3 || a1[3][2]) - (a1[2][5] ? v1 : v0)) && ((v0 - 43) + (v1 || v1)))) {
+        a1[2][10] = (((v0 ? a1[2][8] : 16) ? (v1 / 7) : (a1[0][2] / 8)) < ((13 >= 71) ? (a0[12] / 3) : (36 / 4)));
+        v1 = (((v2 % 1) == (a0[8] ? 64 : 17)) < ((31 && a0[1]) != (v2 * v1)));
+        v2 = (((a1[1][13] == a0[6]) >= (v3 / 3)) > ((a1[3][7] != v1) || (a1[1][6] > v3)));
+    } else {
+        v1 = (((97 <= 34) > (v1 > v0)) ? ((v1 && a0[0]) == (68 < a1[1][10])) : ((v2 % 2) < (a0[0] && a1[3][14])));
+        v0 = (((v1 && 9) != (61 / 6)) ? ((a1[0][12] >= 25) / 9) : ((v3 && v3) / 5));
+        v2 = (((v0 && v1) || (a1[3][7] > a1[1][0])) ? ((v2 * v1) && (v0 >= 30)) : ((v3 || 52) >= (v1 - v2)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a1[2][11] = (((5 ? 25 : a0[8]) / 9) ? ((v3 < v3) * (v0 ? v1 : i2)) : ((80 - v3) - (v3 < v0)));
+        a0[0] = (((v2 || a0[3]) * (32 ? v3 : 56)) > ((a0[6] != 67) == (5 + v2)));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                a1[2][3] = (((a0[0] / 8) || (56 ? a0[2] : a1[0][6])) != ((i3 && 62) == (v0 && v2)));
+                v2 = (((80 % 9) != (i2 != a1[0][2])) || ((10 <= v0) == (66 < 69)));
+                v3 = (((47 + v2) >= (v2 * i3)) ? ((v1 || 92) && (v3 && i3)) : ((a0[5] > v0) / 8));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    return (((v3 == v2) < (v0 <= 54)) >= ((a0[5] % 8) - (v3 ? a0[15] : a1[2][8])));
+}
+int f1() {
+    int v0 = 58;
+    int v1 = 47;
+    int v2 = 88;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 - a1[0][5]) && (v2 && v2)) % 8)) {
+        v1 = (((a0[15] * a0[1]) + (70 - v2)) != ((a0[5] + v0) ? (v0 % 6) : (v2 || v3)));
+        a0[0] = (((v2 && v1) + (v3 / 8)) && ((a0[2] ? a1[2][7] : v1) <= (a0[0] && 99)));
+        v2 = (((a1[3][6] == 74) / 2) + ((v2 || v3) - (v3 * 69)));
+    } else {
+        v1 = (((v2 >= a1[1][0]) > (v1 <= v2)) / 1);
+        v1 = (((v2 != 6) > (67 != v0)) || ((a1[3][3] != 64) % 5));
+        v3 = (((16 > v1) ? (17 < v2) : (v2 * v3)) >= ((v0 == v0) ? (v1 < v1) : (a0[13] - a0[14])));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v3 == v3) > 81) break;
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v3 % 4) >= (v3 * i1)) < ((a0[10] ? i1 : 33) / 3));
+                    v3 = (((a1[1][15] / 4) <= (a1[2][3] != a0[7])) % 1);
+                    v1 = (((v0 ? 90 : 41) ? (v0 == 41) : (v1 % 6)) != ((a1[3][13] * v1) == (a0[4] <= v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v2 = (((v0 - v1) < (v2 + v3)) - ((a0[6] > v1) < (a0[2] * v0)));
+            a0[0] = (((i0 * v3) - (v3 * a0[15])) % 1);
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v0 = (((67 || a1[1][3]) == (i2 != i2)) == ((a0[13] && a1[0][6]) * (a1[3][0] >= a1[2][11])));
+        v1 = (((a0[6] != v3) == (v0 || a1[3][11])) % 5);
+        {
+            int i3 = 0;
+            do {
+                v0 = (((v2 + v0) / 7) && ((59 && i2) - (v3 == v2)));
+                a1[1][10] = (((57 != a1[2][12]) * (v1 < v0)) ? ((i3 - 64) + (v0 * v3)) : ((i2 || 92) * (i2 && v2)));
+                v1 = (((i3 / 3) == (v3 && a0[7])) != ((i2 && a0[14]) - (v0 < a0[12])));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v0 || a0[1]) >= (a0[8] / 9)) + ((36 <= v0) + (60 >= 6)));
+                    v2 = (((a0[8] > 84) <= (i5 <= 7)) + ((a1[0][4] % 6) <= (a1[2][2] ? i5 : v3)));
+                    v2 = (((v1 ? v3 : v2) ? (44 / 4) : (a0[14] && a0[14])) <= ((26 ? 89 : 76) && (15 * 60)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v3 = (((a0[5] || a1[2][11]) >= (v2 == v1)) / 9);
+            v0 = (((v3 + a0[14]) / 9) == ((v0 != v3) == (9 == a0[13])));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    a1[2][0] = (((v1 * v3) <= (v0 + 48)) > ((93 ? 87 : v2) ? (43 <= v2) : (98 ? v1 : v0)));
+    return (((a1[2][15] < v3) % 2) || ((v0 - a1[0][6]) / 4));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,190 @@
+int f0() {
+    int v0 = 63;
+    int v1 = 91;
+    int v2 = 13;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 <= v2) / 9) > ((46 > v0) - (v0 == v3)))) {
+        v0 = (((v3 <= v3) * (v0 / 5)) || ((25 + a1[3][15]) || (a1[3][9] && 57)));
+        v2 = (((v2 ? v1 : v3) + (24 || v3)) == ((v0 != v2) % 2));
+        v2 = (((a1[3][7] && a1[1][1]) * (a1[3][6] % 3)) >= ((v2 / 3) % 5));
+    } else {
+        v1 = (((v0 - v0) * (v2 || a1[0][8])) * ((v2 != v2) == (a0[7] || v0)));
+        v0 = (((56 && v0) != (v3 / 6)) >= ((66 / 3) >= (50 * a0[2])));
+        v1 = (((v0 < a0[10]) % 8) < ((v2 ? v2 : 20) != (v1 + a1[0][13])));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v2 = (((i0 >= 6) / 7) >= ((v3 >= v2) - (v0 / 4)));
+        {
+            int i1 = 0;
+            do {
+                a0[13] = (((v1 ? a0[0] : 19) && (i0 != v3)) == ((v1 && a0[11]) * (i1 / 5)));
+                v1 = (((a0[1] != v1) == (a1[1][14] % 5)) - ((i1 * 64) * (v0 % 1)));
+                v2 = (((34 <= 45) ? (v0 > v2) : (v2 ? 70 : v3)) * ((a0[2] ? i1 : v3) == (v3 * 93)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v1 = (((69 % 1) % 5) ? ((a0[5] * 29) < (16 && 90)) : ((v3 > a1[2][13]) == (v1 < v3)));
+    }
+    if ((((v0 * a0[6]) == (v2 / 8)) - ((v0 + v2) < (v2 && v1)))) {
+        v1 = (((v2 == 46) >= (a0[1] && 9)) / 1);
+        a0[11] = (((v2 == 6) == (v0 ? v3 : v2)) <= ((9 > 12) ? (28 <= v1) : (61 <= v0)));
+        a0[5] = (((v0 + v2) * (v2 >= 90)) ? ((v3 == v0) > (10 > 63)) : ((v2 * a1[3][1]) > (a1[2][4] || v2)));
+    } else {
+        v3 = (((a1[0][0] != 15) || (v2 / 8)) >= ((a0[13] > 79) != (v3 ? v1 : a0[14])));
+        v3 = (((a1[2][9] || v1) <= (v2 - 53)) && ((v2 + v1) <= (v2 > v3)));
+        a0[5] = (((a1[0][9] < 20) * (a1[3][3] >= v1)) >= ((v2 ? v1 : 74) / 1));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v1 = (((v0 || 58) + (v3 * v2)) && ((v0 > 98) + (a0[2] + v3)));
+            v3 = (((v1 / 6) == (a1[3][10] && 82)) >= ((v2 % 7) + (v3 && 89)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v0 = (((81 ? a0[12] : i2) % 7) * ((v1 > 96) <= (5 <= a0[8])));
+                    v1 = (((v2 * 1) <= (v3 * v3)) / 1);
+                    v2 = (((v0 - v2) || (17 || i3)) >= ((93 < 88) >= (v0 == v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a0[7] - a0[6]) || (a1[0][13] <= 12)) * ((v1 < 27) + (a1[0][4] ? 49 : v0)));
+            v1 = (((96 <= i4) < (a1[3][12] && a1[1][15])) + ((84 <= 4) != (v3 + a1[1][0])));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v3 = (((a0[11] <= v3) != (v3 || a1[2][13])) || ((i5 % 9) >= (i4 % 9)));
+                a0[5] = (((a0[3] ? v3 : i5) >= (a1[3][3] % 2)) != ((a0[8] / 6) || (51 * a0[1])));
+                v3 = (((29 * v3) + (v2 && i5)) ? ((i4 <= a0[9]) % 1) : ((v0 && 60) ? (i4 ? v1 : 88) : (v3 || a1[1][14])));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v1 && v1) ? (a1[1][14] || v1) : (41 == v3)) + ((95 == v3) != (77 / 3)));
+}
+int f1() {
+    int v0 = 58;
+    int v1 = 33;
+    int v2 = 66;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    if ((((10 ? 34 : 58) && (v2 + v2)) + ((v0 && v1) >= (a0[9] + v3)))) {
+        a1[1][5] = (((v0 < 63) % 9) / 7);
+        v3 = (((52 * a1[1][6]) + (46 + v3)) ? ((79 / 1) < (v3 + 80)) : ((v0 <= v0) ? (11 % 9) : (a0[7] <= a0[1])));
+        a1[0][6] = (((74 && 0) || (a1[2][12] / 5)) || ((64 / 5) % 9));
+    } else {
+        a1[2][13] = (((v3 * v1) && (v0 * 60)) ? ((v0 != v0) <= (v1 >= v0)) : ((72 * v1) != (66 - v0)));
+        a0[13] = (((v0 != a0[13]) && (34 % 4)) % 7);
+        v0 = (((v1 || a1[0][2]) % 4) != ((v1 >= 27) - (v2 != v1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v2 / 4) / 5) % 9);
+            a0[11] = (((v1 ? v0 : v1) <= (60 < 37)) || ((92 || v3) || (59 < 44)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a0[13] = (((v1 <= 67) == (i0 && v3)) && ((a1[0][8] || 6) || (0 - v3)));
+                v3 = (((a1[1][3] < 81) < (a1[0][0] % 1)) * ((v0 < a0[1]) < (a1[0][14] < 91)));
+                a0[11] = (((v0 ? 18 : i1) - (v0 - 87)) >= ((v0 / 2) && (a1[3][2] - 83)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[3] = (((0 || v0) < (v1 % 8)) > ((a1[3][7] <= v3) < (51 && v2)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v2 <= v3) || (29 || 50)) && ((v1 - 30) >= (84 % 8)));
+                    v2 = (((v1 <= v1) + (a0[3] < i2)) >= ((v0 % 1) + (v1 <= a0[9])));
+                    a1[3][0] = (((v2 || i3) >= (a0[6] ? v1 : a1[3][15])) > ((v2 == a0[8]) != (v0 <= a1[0][6])));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v0 = (((v1 ? v0 : a0[4]) ? (i2 - a0[4]) : (a0[10] + a0[6])) - ((88 == v1) == (v0 || v2)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a1[3][12] = (((v0 * v3) || (i4 == 59)) - ((v3 == a0[14]) * (a0[1] > a1[1][11])));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                if ((a0[7] / 9) > 76) break;
+                v2 = (((a0[13] % 2) > (a1[2][15] < a1[3][15])) && ((v1 > i4) % 8));
+                v3 = (((v0 <= v0) - (40 == 97)) ? ((i5 <= 91) + (v0 == a0[6])) : ((i5 - a1[0][7]) == (i5 < a0[0])));
+                a0[0] = (((a0[11] ? 97 : v2) <= (v2 >= a1[1][9])) < ((a1[2][12] != 48) < (49 > i4)));
+            }
+            v2 = (((v1 >= v3) / 7) < ((v1 && 83) <= (i4 || a0[9])));
+            i4 = i4 + 1;
+        }
+    }
+    v1 = (((v1 - 3) == (v3 <= 8)) / 1);
+    return (((v3 < v0) != (v0 || v3)) ? ((v0 < v0) > (v2 >= a0[4])) : ((19 != v2) / 9));
+}
+int f2() {
+    int v0 = 32;
+    int v1 = 57;
+    int v2 = 43;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[1][7] = (((62 != 32) < (i0 != a0[0])) >= ((v3 % 9) <= (v0 > v2)));
+            v1 = (((47 == v0) % 8) / 2);
+            {
+                int i1 = 0;
+                do {
+                    a0[8] = (((v3 + v1) == (a1[3][2] <= a1[0][8])) * ((v0 * 0) < (v1 || i1)));
+                    v3 = (((v3 != a0[6]) >= (92 != 83)) + ((v0 ? i1 : i0) / 8));
+                    v3 = (((i0 >= 55) % 6) > ((95 == a0[12]) < (a0[0] <= v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((83 || v1) == (v2 == v2)) && ((v1 + a1[1][0]) - (v3 / 9)))) {
+        v3 = (((v1 * v0) > (0 * 34)) && ((0 <= v1) ? (57 != v0) : (v1 - v2)));
+        a1[1][9] = (((2 ? 20 : 54) < (v3 + v1)) < ((v2 != 95) || (54 + v2)));
+        v0 = (((v3 ? v3 : 82) / 6) >= ((a0[2] && v3) / 7));
+    } else {
+        v2 = (((v2 + v0) && (v3 >= v1)) == ((v0 + 64) ? (v0 > v0) : (a0[8] ? a0[5] : a0[5])));
+        a0[4] = (((a0[11] < a1[2][13]) > (v2 || v1)) % 2);
+        v3 = (((v1 / 4) < (v0 && 51)) / 5);
+    }
+    if ((((v2 != 15) == (24 ? v1 : v2)) < ((42 != v2) <= (a1[3][8] > v1)))) {
+        v3 = (((v2 <= v2) != (v1 || v2)) ? ((a0[14] * a0[1]) ? (v3 * v3) : (v1 % 3)) : ((v2 > 54) <= (v0 <= 40)));
+        a0[13] = (((v2 > v0) <= (58 > v3)) != ((64 - 70) || (v2 + v2)));
+        a1[2][0] = (((v0 || 21) >= (a1[3][9] < v2)) + ((65 > a0[8]) - (v3 == 24)));
+    } else {
+        v0 = (((a0[10] <= 47) ? (v3 ? 24 : v0) : (v1 < a0[9])) > ((a0[2] / 3) / 7));
+        v1 = (((v2 / 3) || (v2 >= v1)) != ((a0[11] == v0) + (a1[0][7] != a0[9])));
+        v2 = (((v1 * v0) < (v0 + a0[4])) % 9);
+    }
+    v1 = (((v3 * v0) && (v2 < v3)) || ((91 * 55) ? (a0[10] < v0) : (85 == 3)));
+    if ((((v2 || v1) ? (a1[3][10] || 8) : (a0[2] == 69)) <= ((v0 <= a0[2]) * (a1[0][6] ? 96 : v3)))) {
+        v1 = (((v1 <= a0[13]) < (a1[2][0] || a0[7])) ? ((a0[7] - 79) <= (79 == v2)) : ((v0 / 1) > (v3 != a0[1])));
+        v0 = (((v1 >= a1[3][12]) * (v2 && a1[3][13])) - ((v0 + v2) <= (96 && v3)));
+        v3 = (((v1 ? v2 : v1) ? (v1 >= a0[1]) : (a0[0] || a1[1][4])) - ((v1 >= v3) <= (a1[1][7] != v2)));
+    } else {
+        v0 = (((6 > v0) * (v3 >= v1)) != ((v3 || 82) && (v3 ? a1[1][0] : v0)));
+        v0 = (((a0[11] < v1) % 1) != ((31 || v1) <= (98 + v2)));
+        a0[7] = (((v2 - a1[2][11]) || (34 * v0)) != ((v3 ? a0[14] : 81) >= (v2 > a0[8])));
+    }
+    return (((v2 < v1) % 7) - ((v3 && a0[8]) <= (v1 + v1)));
+}
+int main() {
+    return 0;
+}
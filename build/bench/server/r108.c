@@ -0,0 +1,44 @@
+int f0() {
+    int v0 = 86;
+    int v1 = 41;
+    int v2 = 41;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a0[10] = (((65 <= a0[4]) + (v1 <= v0)) % 1);
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            if ((39 || v3) > 65) break;
+            v1 = (((a0[15] % 5) > (a0[3] * v2)) == ((v2 ? v2 : 88) + (40 <= a0[12])));
+            v0 = (((63 <= v2) - (v1 < 68)) || ((a1[3][13] < i1) + (v3 + 86)));
+            v1 = (((a0[0] + v3) <= (v0 - a1[0][9])) && ((i0 / 8) + (v2 * 18)));
+        }
+        v2 = (((v0 + 7) || (90 != v3)) ? ((39 - v0) == (a0[9] && v2)) : ((16 ? 3 : a1[1][6]) ? (82 ? i0 : v2) : (a0[8] + v0)));
+    }
+    v2 = (((v3 / 7) * (v2 / 3)) * ((v1 == 45) > (v0 < a0[12])));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((i2 % 8) > 95) break;
+        v0 = (((v1 != 91) ? (v3 >= v2) : (55 * a0[10])) ? ((17 <= a1[3][4]) && (v1 ? v2 : v3)) : ((v3 % 6) * (59 + v1)));
+        v0 = (((0 || 54) >= (v0 ? v2 : v2)) >= ((v0 || 74) / 4));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            if ((v1 ? i2 : a0[0]) > 69) break;
+            v1 = (((a1[3][9] * v3) > (v3 * v0)) >= ((v3 * i2) > (3 <= a1[1][12])));
+            v3 = (((v0 > v2) * (v3 * a1[2][0])) > ((57 > i2) >= (i3 <= a1[2][5])));
+            a1[3][5] = (((v3 >= i2) % 9) ? ((v1 % 8) % 1) : ((49 ? 89 : v3) < (95 % 7)));
+        }
+    }
+    v2 = (((71 % 3) * (69 % 7)) ? ((v1 ? v0 : v0) ? (45 / 5) : (v3 ? 75 : v2)) : ((v3 >= v3) / 3));
+    if ((((14 || 90) ? (v2 && v1) : (v3 == 1)) == ((36 && v0) || (v3 - a1[3][0])))) {
+        v2 = (((v0 <= v2) ? (v3 >= v2) : (a0[9] - v3)) == ((a1[2][8] / 2) <= (v3 % 3)));
+        v0 = (((v3 || a0[12]) < (v0 > v3)) - ((37 / 3) && (a1[2][1] == v2)));
+        a1[0][14] = (((a1[0][2] >= v3) ? (a0[7] != v3) : (7 * 31)) - ((v1 != 35) < (a0[4] && v3)));
+    } else {
+        v3 = (((81 - a1[1][7]) ? (v1 ? v1 : 34) : (v1 && v0)) * ((a1[2][9] * v1) ? (v2 < v3) : (v3 % 3)));
+        v1 = (((v1 >= v2) / 8) % 7);
+        v3 = (((v1 == 30) ? (a1[3][0] == 4) : (v3 ? a1[3][10] : v1)) + ((35 || a1[2][14]) ? (a1[0][5] % 9) : (v2 * v2)));
+    }
+    return (((v1 + v1) * (v2 / 6)) > ((75 > v1) + (v0 ? a0[11] : a0[14])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,115 @@
+int f0() {
+    int v0 = 92;
+    int v1 = 11;
+    int v2 = 49;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a1[0][1] ? i0 : v2) > 62) break;
+            v3 = (((v0 % 9) ? (a1[2][2] && v3) : (a0[7] ? 62 : v3)) && ((v1 == 41) > (i0 - a0[11])));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((v0 ? i0 : a1[2][13]) > 61) break;
+                a1[0][13] = (((a1[0][13] ? a0[2] : 85) < (a0[8] * v1)) != ((v3 <= i1) % 4));
+                v3 = (((65 == v2) != (58 ? v2 : i1)) == ((43 == a0[15]) + (v2 >= v3)));
+                v0 = (((a0[0] >= v3) < (v2 < 9)) ? ((v2 == i0) + (i0 ? 16 : 59)) : ((60 >= i1) ? (i1 && a1[3][1]) : (v3 % 6)));
+            }
+            v1 = (((v2 % 5) <= (a0[3] == a0[1])) || ((v0 || a0[7]) != (v0 > 10)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v1 == v2) > 80) break;
+            v2 = (((v3 && a1[2][15]) != (v1 > v1)) > ((v1 + i2) <= (a0[10] || a0[2])));
+            v0 = (((a0[2] > v3) % 5) <= ((i2 <= v1) || (v2 > 78)));
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[1][5] - a1[1][11]) > 74) break;
+                    v1 = (((v0 || a1[0][10]) && (i2 / 1)) >= ((v0 ? a1[3][9] : v3) && (v2 % 1)));
+                    v2 = (((v1 && 0) % 6) && ((v0 * 38) <= (v2 && v3)));
+                    v1 = (((i3 * v0) + (v3 * a1[1][13])) ? ((v2 != i2) == (v3 >= v2)) : ((i3 ? 33 : v0) != (22 % 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                v3 = (((a1[1][7] * a0[11]) ? (v1 ? 85 : v1) : (a0[8] > 72)) + ((a1[1][3] / 5) > (65 >= a1[2][2])));
+                v0 = (((v2 >= i5) - (a1[1][0] && i5)) >= ((51 ? 12 : v3) ? (v3 ? 23 : a0[9]) : (a0[13] >= 23)));
+                v3 = (((76 - 22) * (v1 || i4)) >= ((a1[3][6] ? v3 : i4) % 6));
+                i5 = i5 + 1;
+            }
+        }
+        a1[2][14] = (((v0 && 5) ? (v2 ? a0[13] : v1) : (a0[14] ? 37 : v1)) != ((a1[2][3] > v2) - (v1 / 6)));
+        a0[1] = (((2 * v0) > (0 % 2)) == ((v1 || 54) * (27 < 28)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    a0[4] = (((i6 > v0) ? (i6 && v3) : (a1[0][14] <= v1)) % 4);
+                    v0 = (((24 && v3) ? (v3 ? a1[3][10] : v2) : (i7 != a0[15])) * ((v2 % 3) <= (i6 - a0[13])));
+                    v0 = (((33 - 84) % 2) == ((i7 <= 4) <= (a0[8] >= a1[3][13])));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((v2 ? 24 : a1[1][8]) >= (v0 + v2)) + ((v2 <= 82) >= (v2 + v3)));
+            v1 = (((a0[5] + a0[0]) || (v3 != a0[3])) % 5);
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v0 <= 65) > (63 ? v2 : v1)) == ((a0[10] % 9) % 9))) {
+        v2 = (((a1[1][5] && v3) == (67 >= 75)) >= ((v1 < a1[3][1]) < (a1[0][13] * 5)));
+        v1 = (((61 < a1[1][11]) * (v0 == 58)) && ((0 ? a0[10] : 11) * (v3 ? v1 : v1)));
+        v0 = (((a1[2][9] || a0[1]) - (80 != a1[0][14])) != ((41 % 6) ? (74 || v3) : (a0[11] == v3)));
+    } else {
+        a0[2] = (((52 / 3) != (45 / 5)) > ((25 * a0[4]) + (v2 > v0)));
+        a0[6] = (((a0[14] * v3) > (v2 <= v2)) || ((10 / 9) ? (a0[10] >= v1) : (v3 < v2)));
+        v3 = (((v3 > v3) == (93 ? a0[14] : a1[1][12])) == ((v3 * v0) == (96 % 7)));
+    }
+    return (((96 > 20) && (a0[12] - v3)) > ((v1 ? a0[4] : v1) % 7));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 83;
+    int v2 = 91;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v2 != a1[3][5]) ? (v2 / 8) : (v3 && v1)) % 4);
+    v0 = (((v1 * v1) % 7) * ((v3 * 99) - (v2 && a1[2][2])));
+    if ((((v2 + v0) ? (31 <= v2) : (v0 > 49)) ? ((v3 < v2) && (a0[4] < 44)) : ((a1[2][15] || v0) ? (v3 ? v0 : a1[3][9]) : (17 <= v0)))) {
+        a0[10] = (((v3 == v3) ? (v3 || 39) : (a1[1][9] || 92)) < ((a0[11] > 8) * (v2 || v0)));
+        v3 = (((a0[10] ? a0[11] : a0[12]) % 9) + ((25 * 37) >= (v1 <= v3)));
+        v0 = (((v1 * 25) >= (v2 || 8)) - ((v1 == 57) < (v2 <= a1[3][8])));
+    } else {
+        a0[11] = (((v1 + v1) >= (a0[10] - v3)) >= ((v1 >= 79) || (a0[4] ? v1 : v3)));
+        v0 = (((a1[0][5] * v0) || (v0 && v0)) || ((56 != v1) == (v3 - v0)));
+        v2 = (((v2 != v2) - (v1 % 5)) - ((a1[1][0] <= 87) > (a1[1][10] == v3)));
+    }
+    v2 = (((18 == a1[0][3]) == (a0[11] / 4)) < ((v0 < 85) ? (1 - 68) : (v0 && a0[10])));
+    if ((((50 * a0[14]) / 4) <= ((v3 + 47) % 5))) {
+        v3 = (((v1 && v3) >= (13 >= v2)) / 6);
+        a0[2] = (((5 >= v2) / 5) >= ((v3 + v1) && (28 - a0[15])));
+        a0[10] = (((58 + a1[1][14]) ? (v2 * 26) : (74 / 8)) && ((v2 / 2) > (a0[10] != v3)));
+    } else {
+        v0 = (((v1 == v3) >= (v2 ? v2 : 59)) > ((71 <= v0) >= (a1[0][7] ? a1[0][15] : v1)));
+        a1[2][12] = (((v3 ? v0 : a1[1][5]) % 3) != ((v1 * a0[7]) || (61 + v3)));
+        v2 = (((a1[1][12] - a0[15]) > (a0[12] && 24)) >= ((v1 != v1) ? (a0[4] ? v2 : v1) : (48 % 9)));
+    }
+    return (((8 - a1[2][5]) / 3) < ((v2 > 51) - (v2 || a0[3])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,162 @@
+int f0() {
+    int v0 = 63;
+    int v1 = 3;
+    int v2 = 22;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a0[3] = (((a1[1][2] > v3) > (64 && v2)) / 9);
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a1[0][5] <= a1[3][12]) - (v2 * v2)) ? ((v2 >= a0[1]) || (64 == v0)) : ((v2 - i1) - (a0[0] || v1)));
+                v0 = (((v1 >= i0) * (a0[13] != a1[1][11])) + ((a1[2][4] || i0) >= (v2 + a0[0])));
+                a0[4] = (((v0 ? i1 : i1) != (a0[9] > v3)) * ((v0 % 7) % 8));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v2 = (((v1 < 70) || (v1 < 90)) % 1);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((45 % 5) > 99) break;
+        v3 = (((v1 ? a0[1] : v3) != (a0[2] >= i2)) * ((a0[2] - a0[10]) + (i2 && v2)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                a0[11] = (((v1 || v1) ? (86 && v1) : (v0 != 64)) || ((v2 >= 57) < (i3 * i3)));
+                a1[3][10] = (((a1[3][4] != a0[14]) || (i2 ? 78 : v1)) == ((v0 != 63) / 7));
+                v0 = (((a0[11] > 16) != (v1 != v2)) && ((v0 % 1) * (v3 < a1[0][0])));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((63 - v2) == (v1 <= 17)) <= ((19 && i2) < (v1 ? a0[4] : v3)));
+    }
+    if ((((89 < v1) <= (v3 / 4)) || ((v2 ? 10 : a0[1]) == (79 / 7)))) {
+        a1[0][0] = (((v3 * a0[1]) > (v2 * v3)) != ((22 == a1[2][12]) * (49 <= a1[2][10])));
+        v0 = (((a1[1][2] ? v0 : 88) + (a1[2][15] != 34)) <= ((a0[11] - 86) == (v3 > a1[0][3])));
+        v0 = (((78 <= v2) || (v0 == 3)) ? ((v2 + v3) || (a0[8] ? v1 : v1)) : ((v2 % 2) < (a1[2][15] == v2)));
+    } else {
+        v0 = (((25 ? v1 : a0[13]) && (v2 && 88)) - ((a0[14] - v0) || (a1[2][9] % 2)));
+        v2 = (((30 && v0) ? (a0[8] * v1) : (a1[2][11] && a0[0])) || ((a0[11] ? v0 : v2) ? (a0[9] / 5) : (v2 <= v1)));
+        a0[12] = (((v0 / 9) ? (a1[3][9] == v0) : (40 * 7)) - ((54 > v3) < (6 && 32)));
+    }
+    v0 = (((v3 >= a1[1][0]) <= (a1[1][1] ? a0[5] : a1[1][13])) || ((v2 > 65) != (11 % 3)));
+    if ((((a1[2][12] % 7) && (v0 <= v2)) - ((v1 != a0[13]) - (a1[1][9] && 36)))) {
+        a0[6] = (((v3 >= v2) - (v2 ? a0[1] : a0[11])) - ((v1 == v0) % 9));
+        a1[1][3] = (((42 - v0) % 3) * ((a1[1][3] <= 89) / 3));
+        v3 = (((a1[1][12] >= a1[1][11]) % 7) > ((a1[0][14] + 97) || (v3 % 2)));
+    } else {
+        v3 = (((a0[9] || a0[0]) != (v2 && a0[10])) > ((v0 * v3) >= (56 < a1[1][9])));
+        v1 = (((84 != a0[2]) + (v1 && 8)) || ((a0[4] < 0) != (a1[3][0] > a0[12])));
+        a0[12] = (((98 == v3) <= (v1 >= a1[2][7])) || ((v2 / 5) % 1));
+    }
+    return (((a1[1][7] <= 73) ? (v3 < v3) : (v2 > v2)) == ((v3 && 51) >= (v1 <= v2)));
+}
+int f1() {
+    int v0 = 24;
+    int v1 = 10;
+    int v2 = 55;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 || v3) == (28 * 5)) > ((v2 && v1) - (v3 == 57)))) {
+        a1[1][6] = (((a0[5] % 9) ? (95 == v2) : (58 - 12)) > ((v0 <= 64) != (v1 || v3)));
+        v2 = (((v2 > 89) ? (v3 != a0[2]) : (v3 / 6)) != ((a0[2] == v1) == (v0 * a1[1][6])));
+        v0 = (((v1 ? 19 : v0) && (v0 == 8)) + ((a0[15] && a1[1][9]) * (v1 < 94)));
+    } else {
+        v0 = (((v1 > v0) <= (v1 / 8)) % 5);
+        v0 = (((a0[11] + v2) >= (v0 <= v3)) ? ((a1[3][13] / 3) - (a0[14] == v2)) : ((v0 || v3) / 3));
+        a1[0][7] = (((v3 < 62) > (a0[1] % 4)) + ((v3 == a1[2][11]) >= (a0[13] == 59)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v0 > v3) > 74) break;
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((a0[6] ? 92 : a0[11]) > 61) break;
+                v3 = (((80 ? 56 : i1) || (i1 && 46)) ? ((i0 || a0[7]) && (95 < i1)) : ((40 || i1) == (72 ? a1[1][12] : v2)));
+                a0[0] = (((v0 != a0[15]) > (v0 ? 16 : v2)) != ((a0[15] * 18) ? (v3 ? 82 : v2) : (a1[1][7] && i1)));
+                a0[14] = (((v2 % 8) != (v0 % 7)) * ((33 > i0) == (a1[1][10] ? a0[8] : v1)));
+            }
+            v0 = (((66 >= i0) % 7) / 7);
+            a1[2][7] = (((v0 != a0[7]) < (v1 >= a1[2][6])) ? ((27 < 29) * (a0[0] ? 26 : a1[1][7])) : ((v0 != v1) - (i0 && 98)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 <= 95) == (v1 ? 19 : 37)) ? ((v3 >= v3) && (a0[12] ? a0[9] : a1[2][9])) : ((v2 / 5) ? (a1[3][2] ? 26 : 66) : (a1[2][4] ? 69 : 56)))) {
+        v2 = (((v1 - v0) ? (a0[3] / 9) : (a0[5] - v2)) + ((a1[3][14] * 19) % 4));
+        v2 = (((67 == 61) < (v3 <= a0[10])) * ((v1 / 9) <= (a0[8] ? v0 : a0[3])));
+        a1[0][1] = (((a0[0] && a1[3][8]) < (v3 * a0[15])) > ((v1 % 6) > (a0[7] > 55)));
+    } else {
+        v1 = (((a1[2][8] / 9) < (v3 ? v0 : v0)) && ((v0 < a0[3]) && (25 && v2)));
+        v1 = (((v0 || 22) + (17 % 3)) / 1);
+        v2 = (((a1[2][1] || v3) - (v0 * a1[0][2])) % 6);
+    }
+    v2 = (((v3 / 6) ? (a1[1][6] + v3) : (24 ? 23 : v1)) != ((v2 != a1[3][14]) % 1));
+    if ((((v2 < 77) > (v1 >= v3)) < ((v1 ? v2 : v1) % 3))) {
+        v1 = (((v1 ? v0 : a1[2][5]) == (a0[14] || a1[0][6])) / 4);
+        a0[11] = (((v0 * v2) % 4) ? ((a1[2][2] == a0[3]) + (v1 != 40)) : ((v2 > v1) ? (54 + a1[0][4]) : (v0 * a0[4])));
+        v2 = (((v0 + a1[3][14]) % 5) > ((v0 && a1[0][12]) + (47 ? v1 : 8)));
+    } else {
+        v3 = (((v0 && a1[2][12]) != (v2 - v2)) < ((v0 * v2) && (v2 * a0[13])));
+        a0[14] = (((v0 != v0) * (v2 / 1)) <= ((99 * v3) ? (v0 ? v1 : a1[1][13]) : (v0 <= a1[0][4])));
+        a0[15] = (((v0 != a0[5]) ? (a0[10] / 8) : (a1[2][10] <= 96)) <= ((a1[0][0] % 5) / 1));
+    }
+    return (((53 ? 58 : v2) + (a1[1][11] ? a1[1][15] : 37)) ? ((41 ? v0 : a0[13]) || (83 - v3)) : ((v0 == v0) / 8));
+}
+int f2() {
+    int v0 = 1;
+    int v1 = 28;
+    int v2 = 42;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 < v0) >= (v3 < v2)) || ((v2 - a1[0][15]) > (86 != v0)));
+    if ((((a0[4] && a0[0]) || (88 >= a0[9])) - ((a1[0][8] ? a0[0] : a0[7]) >= (v0 - a1[0][8])))) {
+        a0[5] = (((a1[0][12] < v1) * (14 - v0)) * ((v3 + 9) / 5));
+        a0[0] = (((v1 ? v3 : v3) >= (a0[1] < v3)) ? ((v3 || a0[15]) / 9) : ((a0[6] && 48) <= (v3 / 8)));
+        v1 = (((a0[5] >= a0[13]) ? (a1[1][12] ? v0 : 2) : (a0[4] % 9)) % 7);
+    } else {
+        v2 = (((v1 + v1) == (53 - 36)) % 4);
+        a1[2][3] = (((a0[9] && v3) ? (v2 != a1[0][5]) : (v2 - v3)) + ((v3 ? v3 : a1[2][12]) + (a0[15] < 41)));
+        v3 = (((96 && 61) > (a1[2][10] ? 76 : a1[1][6])) || ((94 + v0) >= (a0[11] + 63)));
+    }
+    a0[3] = (((53 > a1[1][2]) <= (a1[0][14] ? v2 : v3)) && ((v1 ? a0[3] : a1[0][9]) != (v0 <= a1[3][10])));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v0 = (((v3 * v0) % 7) ? ((29 || i1) ? (76 < i1) : (i1 == a0[10])) : ((v3 % 1) > (a1[3][1] - 65)));
+            a1[3][5] = (((91 % 4) >= (v1 != i1)) < ((81 % 8) % 7));
+            v3 = (((v2 && 58) != (a1[3][12] <= v1)) < ((28 <= i1) ? (i0 == 34) : (v3 != i1)));
+        }
+        v1 = (((a1[1][2] + a0[5]) % 8) <= ((v1 + 9) % 6));
+        v0 = (((a0[12] >= a0[11]) > (60 * v1)) ? ((72 == v1) ? (a0[3] - 25) : (a0[14] >= v0)) : ((81 * 53) >= (v1 > v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[3][4] >= v1) > 60) break;
+            a1[3][9] = (((v3 || a1[2][13]) != (a0[1] <= 64)) ? ((87 ? 89 : 93) <= (i2 * i2)) : ((i2 ? a0[2] : i2) && (a1[1][8] <= 30)));
+            v3 = (((v2 > v1) < (v0 ? 38 : v2)) >= ((v2 * a0[9]) > (v0 % 7)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((v2 >= 78) > 61) break;
+                    v0 = (((a0[14] - a0[6]) && (i2 && 50)) % 5);
+                    v0 = (((i2 != 59) > (19 <= a0[7])) == ((27 - i2) ? (a1[0][5] - 11) : (v3 ? v1 : v1)));
+                    a1[2][12] = (((v1 < 89) && (v3 > i2)) + ((v2 == a1[0][11]) < (v3 >= i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    return (((63 != a1[3][10]) ? (a0[13] > v2) : (27 != a1[2][15])) && ((82 >= v1) < (v1 < a0[0])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
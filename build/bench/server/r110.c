@@ -0,0 +1,180 @@
+int f0() {
+    int v0 = 0;
+    int v1 = 32;
+    int v2 = 76;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 - v1) || (v1 * 80)) - ((v0 % 6) + (33 + v3)))) {
+        v3 = (((v2 == v1) * (v3 <= v3)) != ((a0[11] <= a1[0][11]) == (a0[12] != v1)));
+        v2 = (((89 ? a1[0][3] : v0) > (a0[1] % 6)) - ((v2 >= v2) - (50 == v2)));
+        a1[3][8] = (((v3 % 6) >= (61 + a0[13])) != ((2 ? a0[9] : v1) && (a0[14] + v3)));
+    } else {
+        v2 = (((85 ? 58 : v1) || (60 / 3)) - ((a0[11] * 6) <= (v0 && 2)));
+        v3 = (((87 != a0[15]) * (v2 <= v2)) && ((72 <= v2) / 2));
+        v1 = (((v0 < v2) != (a1[2][0] % 8)) || ((57 - a0[3]) == (a1[0][15] && a0[10])));
+    }
+    a0[3] = (((a0[2] != v0) > (9 ? 77 : 81)) / 3);
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((v3 + a1[1][9]) > 90) break;
+            v3 = (((i0 < a1[3][14]) != (a0[0] - 35)) <= ((i0 > a0[1]) && (a0[4] && a0[14])));
+            v3 = (((v2 / 7) > (v1 ? v2 : a1[3][7])) > ((1 < i0) ? (v1 < a1[2][9]) : (a0[3] ? a0[12] : v0)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((11 / 8) % 2) >= ((a0[2] == v0) * (v0 % 1)));
+                    v0 = (((i0 - i0) * (a1[3][10] ? v2 : v3)) + ((25 ? a1[2][0] : 50) ? (i0 != 65) : (a1[3][2] - 25)));
+                    v2 = (((v0 < i0) || (71 / 3)) && ((i0 || a1[3][5]) <= (a1[0][7] - i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v0 = (((v2 == v3) > (34 >= 84)) ? ((a0[10] ? a1[2][0] : v1) && (90 < v2)) : ((75 == a1[0][14]) >= (a0[11] || v1)));
+        v1 = (((v0 ? 0 : a0[12]) % 2) || ((49 > i2) <= (22 > a1[3][1])));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            a1[3][6] = (((10 <= 38) || (v2 || 49)) && ((53 % 9) < (i2 / 8)));
+            v2 = (((a1[3][5] ? v0 : i3) - (21 <= i3)) != ((11 * 79) ? (i3 / 2) : (a1[2][2] % 9)));
+            v3 = (((30 * 1) == (v2 * 56)) >= ((30 * a0[2]) / 7));
+        }
+    }
+    v0 = (((v3 - v1) % 3) < ((v0 <= v2) > (v1 - v2)));
+    return (((a0[7] < a1[0][1]) >= (v2 >= 32)) ? ((v0 < 13) ? (v2 <= a0[3]) : (a1[2][7] == v2)) : ((1 < v0) * (a1[1][15] != v1)));
+}
+int f1() {
+    int v0 = 86;
+    int v1 = 22;
+    int v2 = 16;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((a0[1] > v0) > 69) break;
+            v2 = (((a0[3] / 5) % 4) * ((97 >= 92) >= (85 ? a0[2] : v0)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v0 = (((26 > i1) - (i1 || a1[3][12])) && ((i0 + a0[5]) - (20 && a0[14])));
+                    v3 = (((a1[2][10] > v2) * (a0[10] == a0[15])) != ((40 * a1[3][15]) <= (a0[4] ? a0[10] : v0)));
+                    v1 = (((a0[13] ? 69 : i1) == (43 + 17)) != ((a0[7] / 1) || (i1 ? v1 : a0[14])));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((25 && v3) != (v3 < a1[2][3])) * ((a1[3][11] / 5) < (v3 - 45)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[5] <= v2) * (v1 * 37)) * ((v3 && v0) == (90 < 42)))) {
+        v3 = (((v2 - v3) && (a0[1] * v2)) == ((32 ? v2 : v1) == (v0 ? 85 : v0)));
+        a0[7] = (((v3 > v1) == (v2 == v1)) % 6);
+        v2 = (((v2 ? v0 : 78) >= (26 || v3)) == ((v2 != 94) >= (89 != 72)));
+    } else {
+        v0 = (((66 == v0) == (v2 ? a0[4] : v2)) || ((a0[11] == a0[1]) || (v0 * 32)));
+        a0[1] = (((75 != v2) || (v1 >= a0[3])) + ((a0[1] * 16) / 6));
+        v0 = (((v2 ? v1 : v3) > (33 < v0)) ? ((v2 ? v3 : 66) || (v3 ? v2 : v1)) : ((43 == a0[15]) % 4));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v0 = (((v0 == a1[1][5]) || (20 - 47)) < ((i2 - a1[2][6]) && (a1[2][13] ? 69 : i3)));
+                v3 = (((v1 < 23) && (69 % 1)) != ((i2 && 75) - (i2 > a1[2][3])));
+                v1 = (((v3 * v1) >= (30 == 95)) && ((i3 ? i3 : v0) && (i3 <= v0)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v0 = (((v1 - 6) % 6) + ((a1[0][9] || 30) || (v0 && a0[4])));
+        a1[1][14] = (((a1[0][9] * a0[15]) != (a0[6] > v0)) ? ((v3 / 5) * (i2 || 37)) : ((v1 / 3) ? (i2 > i2) : (v0 ? i2 : 66)));
+    }
+    v0 = (((v3 < v2) || (v2 < v3)) >= ((v0 / 4) * (45 / 1)));
+    if ((((v3 >= v2) || (68 > 75)) < ((v3 / 4) % 4))) {
+        a1[3][7] = (((a0[7] == a1[0][7]) != (13 >= v2)) % 4);
+        v3 = (((24 == v1) + (22 || v2)) >= ((a0[15] ? 90 : v3) - (v3 >= a0[14])));
+        a1[0][10] = (((a1[0][0] || v1) % 3) ? ((11 - 56) && (a1[3][12] * a1[1][9])) : ((v1 % 3) * (a1[0][10] ? v3 : a1[1][13])));
+    } else {
+        v0 = (((29 < v3) == (v2 <= 73)) * ((v0 * a0[12]) / 8));
+        v0 = (((v1 ? v3 : v1) / 9) != ((v1 / 2) * (a1[1][12] && 15)));
+        v0 = (((v0 ? 9 : v1) ? (a0[8] ? a0[14] : v0) : (v3 || 54)) / 3);
+    }
+    return (((v1 % 6) || (53 / 9)) >= ((a1[3][7] * v3) >= (v0 && a1[3][10])));
+}
+int f2() {
+    int v0 = 14;
+    int v1 = 51;
+    int v2 = 86;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((68 != 63) > 58) break;
+                    v2 = (((v3 ? a1[3][6] : v0) * (v1 && 11)) ? ((93 ? 14 : 73) > (a0[10] % 4)) : ((v2 < v1) / 8));
+                    a0[2] = (((a1[1][11] > 44) ? (v2 - v3) : (v2 / 1)) > ((v2 ? 93 : a1[0][9]) == (v0 < i0)));
+                    v0 = (((v3 % 1) ? (v3 && 46) : (a1[1][4] == v0)) <= ((a1[0][13] <= i1) != (a0[9] / 9)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((31 % 8) > (46 && 62)) || ((a0[15] < a1[2][12]) % 3));
+            v0 = (((v2 < v2) >= (71 == v3)) > ((a0[2] > v3) / 9));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v3 = (((94 < a0[6]) <= (i2 % 4)) * ((v2 + v1) ? (a0[6] && a1[2][11]) : (v3 || i2)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v0 && a1[1][8]) + (i3 && i2)) > ((a1[2][5] > 81) - (i2 / 7)));
+                    v1 = (((i2 ? i2 : v2) || (i3 ? a1[0][3] : a1[2][8])) ? ((i3 >= i2) != (80 - i3)) : ((a1[1][2] >= 42) && (a0[11] || a1[3][15])));
+                    v3 = (((18 ? v2 : 55) < (7 + a0[4])) ? ((a0[5] || i2) ? (a0[1] - v0) : (a0[14] >= a1[1][4])) : ((98 > v2) / 8));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v1 = (((a0[6] ? v1 : a0[5]) + (v0 / 4)) - ((65 < v2) == (69 == v0)));
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((48 % 6) == (a0[12] && v3)) && ((52 ? 62 : v3) == (a0[1] ? 57 : a1[0][3])));
+    {
+        int i4 = 0;
+        do {
+            v0 = (((a0[7] + i4) >= (37 > 45)) % 8);
+            v3 = (((63 ? 32 : v1) >= (v3 - v3)) - ((v0 < v2) || (a0[8] < i4)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v0 = (((v0 == a1[2][2]) ? (v1 + v1) : (v1 != a1[2][15])) >= ((v0 + i4) - (a1[3][12] * v0)));
+                    v1 = (((v0 > 37) + (a0[11] % 2)) != ((a1[0][1] / 6) < (v3 != v3)));
+                    v3 = (((a0[6] - a1[2][13]) < (v0 == v0)) == ((v1 % 6) != (i4 < v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    if ((((a0[4] >= a1[0][2]) > (v3 * v3)) ? ((0 >= 67) > (v2 % 7)) : ((60 ? a1[1][10] : v1) <= (v0 ? a1[0][2] : 49)))) {
+        v1 = (((v2 ? v0 : v3) <= (43 * v1)) - ((v2 != a0[12]) / 7));
+        a0[4] = (((a0[2] / 6) + (a0[10] > v1)) && ((a0[7] ? a0[15] : v3) == (v1 > v1)));
+        a0[1] = (((v1 / 6) && (v0 && v0)) != ((a0[10] >= v1) * (96 > a1[1][1])));
+    } else {
+        v3 = (((4 != v3) / 2) ? ((v0 - v0) < (a1[2][5] ? v0 : a0[15])) : ((a0[14] / 4) ? (v2 && v0) : (v0 == v2)));
+        a1[3][1] = (((a1[3][1] + v2) == (v3 != v0)) != ((v1 ? a1[1][14] : a0[3]) / 3));
+        v3 = (((a0[7] < a0[12]) && (97 > a0[14])) * ((84 / 7) || (v0 && v0)));
+    }
+    return (((v0 ? v0 : 73) == (a1[2][3] == v0)) > ((a0[10] ? v2 : 90) && (85 <= v1)));
+}
+int main() {
+    return 0;
+}
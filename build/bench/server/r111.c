@@ -0,0 +1,71 @@
+int f0() {
+    int v0 = 84;
+    int v1 = 3;
+    int v2 = 0;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((a0[15] ? v1 : 89) > 63) break;
+        a0[3] = (((a1[0][3] ? a0[12] : i0) * (a0[10] > v1)) && ((v0 ? v2 : v2) ? (70 + a0[14]) : (v2 == a0[8])));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                v2 = (((72 || a0[12]) ? (v0 % 2) : (v3 > v3)) ? ((a1[1][9] >= 77) != (55 == i1)) : ((a0[10] != v2) >= (a1[1][10] % 4)));
+                a0[12] = (((a1[3][15] >= a0[5]) > (a0[1] - a1[2][3])) && ((19 == 79) + (71 / 8)));
+                v0 = (((9 * v3) ? (71 <= 29) : (v3 % 6)) * ((v3 >= 95) < (21 == i0)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[5] = (((a1[2][12] - v3) != (69 / 4)) && ((v0 && 79) * (v3 - 21)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a1[2][7] = (((a0[1] - 82) && (v2 ? a0[5] : a0[14])) - ((a1[3][10] || v1) > (36 + v0)));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                a1[0][13] = (((i3 == i2) + (a1[1][1] >= v3)) < ((11 * v2) != (i2 == i2)));
+                a0[0] = (((i3 && a1[0][7]) == (v0 % 5)) >= ((i2 + 91) != (a1[1][1] || v2)));
+                a1[2][10] = (((17 || i2) + (v2 != 15)) / 7);
+                i3 = i3 + 1;
+            }
+        }
+        a0[3] = (((84 == a0[14]) == (i2 / 3)) - ((28 && a0[7]) ? (i2 + v0) : (42 >= v1)));
+    }
+    v0 = (((43 / 7) - (v2 + v2)) % 9);
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((27 ? 7 : 31) && (73 <= 43)) * ((v3 < a1[0][1]) + (a0[9] / 1)));
+        {
+            int i5 = 0;
+            do {
+                a0[12] = (((i4 * v0) > (i4 ? v2 : v1)) / 3);
+                a0[12] = (((v3 && v0) - (24 >= v3)) < ((v0 * a1[1][0]) || (a0[2] + 0)));
+                a1[0][1] = (((i4 <= v0) && (i4 != a1[1][15])) || ((v3 >= 43) < (a1[2][5] ? 81 : a0[13])));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        v2 = (((a0[8] % 5) ? (v1 ? i4 : v2) : (65 <= v3)) - ((a1[3][15] == 25) / 6));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v3 > a1[2][15]) > 99) break;
+            a0[2] = (((v3 <= v0) % 8) ? ((a1[0][14] ? v2 : v3) && (84 || a1[2][15])) : ((v0 + i6) || (a1[1][11] <= 80)));
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((i7 % 6) % 2) * ((55 > i7) > (4 != i6)));
+                    a0[10] = (((v2 > v1) >= (v3 < v2)) + ((v0 == a1[0][1]) % 5));
+                    a1[0][9] = (((5 ? i6 : a0[6]) - (a0[4] > a0[8])) / 3);
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            a0[7] = (((a0[9] < 61) <= (a1[2][4] != a1[0][8])) - ((i6 < a1[2][0]) ? (83 >= i6) : (60 < v1)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((a1[3][11] + 31) + (v1 - 14)) % 8);
+}
+int main() {
+    return 0;
+}
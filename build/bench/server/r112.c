@@ -0,0 +1,116 @@
+int f0() {
+    int v0 = 29;
+    int v1 = 24;
+    int v2 = 38;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((a1[1][11] < i0) ? (v2 * a1[2][1]) : (i0 <= i0)) + ((59 / 3) && (v1 == 45)));
+            a1[3][5] = (((v2 + v3) >= (a1[3][4] > i0)) && ((v0 && v2) - (75 * a0[7])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v0 = (((v2 == v1) % 9) < ((v0 % 1) / 8));
+                v1 = (((v1 == v0) && (68 - v0)) ? ((v1 == v2) % 2) : ((a0[0] <= v3) != (i1 && 69)));
+                v0 = (((i1 - i0) >= (v2 + a0[3])) ? ((a1[1][8] || 17) != (a1[3][4] * v1)) : ((v2 ? i1 : a0[6]) < (v1 >= v0)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    a0[2] = (((a0[3] ? v2 : v0) - (v2 > a0[8])) + ((a1[2][0] + v0) % 3));
+    a1[3][11] = (((a0[1] > v2) >= (a1[0][0] && v3)) != ((70 ? v0 : v3) <= (v1 < v1)));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v1 = (((v0 > v1) * (a0[4] >= 14)) >= ((a1[2][3] ? i2 : v1) / 3));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((v3 < v2) >= (i3 ? a1[3][11] : 40)) % 4);
+                v2 = (((a1[0][0] != 53) + (68 < a0[15])) * ((69 != v1) % 7));
+                v3 = (((i3 % 1) != (v3 || i2)) + ((63 ? v2 : a1[1][4]) ? (61 == 87) : (v2 < v1)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        v0 = (((i2 ? 12 : v0) ? (a1[3][15] == v2) : (99 > v3)) ? ((a0[15] < v2) - (70 % 4)) : ((v1 >= 96) % 6));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v1 = (((v3 * v3) / 2) <= ((i4 < v2) * (v2 ? a1[0][12] : v3)));
+            a0[13] = (((i4 ? a0[13] : 51) >= (46 % 9)) ? ((v3 == i4) / 3) : ((v2 < 34) ? (v1 + a1[3][14]) : (91 && 60)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v2 = (((v2 * v3) / 5) || ((a0[4] / 1) ? (a1[3][4] == i4) : (a0[12] < v3)));
+                    a1[0][5] = (((v1 == a0[1]) - (26 <= a1[2][4])) == ((i5 == a1[3][9]) || (a0[12] <= i4)));
+                    v0 = (((a1[0][14] + a0[0]) == (i4 > 25)) && ((i4 + a1[2][0]) < (a1[2][9] && i5)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[2][10] > v3) + (59 * v2)) >= ((95 >= v2) / 8));
+}
+int f1() {
+    int v0 = 58;
+    int v1 = 60;
+    int v2 = 41;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        a0[0] = (((50 != a0[1]) <= (98 ? a0[14] : v0)) <= ((v3 ? v3 : 35) + (47 == 19)));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v1 = (((77 * i0) < (93 == 61)) ? ((i1 < 61) / 6) : ((v3 * a0[3]) / 2));
+                v3 = (((a0[1] ? 15 : a1[0][4]) - (i0 != a0[9])) != ((48 == i0) == (74 % 5)));
+                v1 = (((a0[6] > v0) ? (64 ? i0 : v0) : (v0 * v2)) <= ((a0[8] ? a1[0][4] : a0[10]) % 9));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((64 < v2) + (v0 <= a0[0])) + ((a1[1][2] || 45) / 1));
+    }
+    if ((((v0 % 8) * (v0 / 1)) * ((v2 / 8) < (v0 >= a1[1][4])))) {
+        v3 = (((v2 && a0[13]) + (v1 || v0)) || ((a1[2][6] - a0[8]) && (a0[14] ? a0[9] : 76)));
+        a0[13] = (((v3 - v1) < (v0 <= v3)) % 1);
+        v3 = (((v0 > v1) ? (v2 >= v3) : (a1[0][1] > v0)) < ((v2 - v1) != (a0[6] ? v2 : 33)));
+    } else {
+        v2 = (((24 - v3) >= (a0[4] == v0)) ? ((v0 >= a0[15]) != (v1 ? v2 : v2)) : ((v0 + v1) > (v1 / 7)));
+        v1 = (((22 > v1) <= (v1 && v0)) || ((v0 / 2) != (v3 / 7)));
+        a0[1] = (((v1 ? v2 : v1) * (58 && a1[1][4])) && ((15 >= 54) ? (a0[3] + v2) : (75 + a0[0])));
+    }
+    v3 = (((a0[11] <= 54) ? (v2 < 94) : (a0[10] < v0)) && ((v2 <= v2) >= (v2 >= v1)));
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a1[2][0] > v3) * (0 - i2)) <= ((v3 < 47) ? (30 == 16) : (89 / 3)));
+            v1 = (((67 && 34) != (v2 / 2)) % 3);
+            {
+                int i3 = 0;
+                do {
+                    if ((v1 < v2) > 91) break;
+                    v0 = (((96 != i3) || (70 != a0[7])) > ((a1[0][11] || 50) || (a1[1][7] < i2)));
+                    v1 = (((89 % 1) || (92 >= a0[13])) || ((v0 % 8) || (90 % 2)));
+                    v3 = (((v3 ? v2 : 51) < (v1 || i2)) > ((a0[13] == v0) <= (v3 != a1[3][15])));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v3 == a1[1][8]) - (v2 + v3)) != ((39 / 1) < (v0 - a0[9])))) {
+        a1[3][1] = (((v0 ? v0 : a0[6]) - (v3 == v3)) <= ((v3 > v2) != (82 * v3)));
+        v1 = (((v2 - a1[2][9]) || (v0 % 4)) != ((v1 % 9) != (59 && v3)));
+        v3 = (((a0[0] != v3) * (v1 != v1)) + ((v3 != v1) > (24 == a1[1][14])));
+    } else {
+        v1 = (((v2 % 1) * (v3 ? v0 : 16)) > ((v2 < 70) || (v0 ? v0 : v0)));
+        v3 = (((20 == a0[5]) + (83 <= 93)) ? ((69 + a1[3][13]) <= (v3 * v3)) : ((v1 || v3) >= (v2 >= a1[3][15])));
+        a1[2][4] = (((a1[3][3] ? v0 : 97) / 7) + ((56 + 38) - (68 - a0[14])));
+    }
+    return (((93 != a1[3][0]) != (a0[4] >= a0[6])) == ((a0[6] >= a1[1][12]) == (v1 || v2)));
+}
+int main() {
+    return 0;
+}
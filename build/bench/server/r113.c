@@ -0,0 +1,172 @@
+int f0() {
+    int v0 = 46;
+    int v1 = 99;
+    int v2 = 50;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((95 ? a0[8] : a0[3]) && (96 * a1[2][0])) >= ((18 * a1[1][4]) || (52 + 7)));
+    if ((((a0[7] / 1) < (v0 <= v3)) < ((v2 % 8) ? (38 ? v3 : v2) : (a1[3][15] - v3)))) {
+        v3 = (((v1 != v2) - (a1[3][11] <= 49)) + ((41 % 6) / 1));
+        a0[5] = (((a1[2][11] <= v2) * (v3 || a0[3])) > ((3 * v2) < (a0[15] % 8)));
+        v3 = (((v3 ? v0 : v2) != (v2 * v1)) ? ((0 || v1) / 7) : ((v1 ? 96 : a1[2][3]) + (74 % 4)));
+    } else {
+        a0[11] = (((a1[3][3] ? v1 : 94) ? (v3 / 2) : (v1 < v3)) <= ((v1 == v3) ? (v2 * a1[1][4]) : (97 > 77)));
+        v3 = (((v1 && 67) * (v1 && v1)) % 9);
+        v0 = (((v2 > v0) < (a0[10] / 4)) >= ((89 ? a1[0][9] : v3) + (a0[15] || 32)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((i0 && v0) > 79) break;
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v2 = (((a0[12] * a0[11]) - (i0 >= v2)) != ((41 ? v0 : i0) + (44 / 1)));
+                v0 = (((i0 * i1) < (i0 > i1)) % 6);
+                v2 = (((i0 * 22) > (i1 == a1[1][12])) ? ((44 || i0) >= (a0[10] * v1)) : ((v0 == 78) * (a1[2][13] >= v1)));
+            }
+            a1[2][8] = (((v1 % 1) / 7) > ((a0[8] * i0) ? (31 && v3) : (a0[0] < a0[0])));
+            v3 = (((11 * 56) || (92 <= 31)) || ((25 / 6) + (a0[2] * v2)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            {
+                int i3 = 0;
+                do {
+                    if ((60 != i2) > 50) break;
+                    v2 = (((40 > i3) && (a1[2][2] ? v0 : 86)) - ((a1[1][12] + i3) >= (i3 ? a0[13] : 17)));
+                    v3 = (((a0[12] % 2) - (v1 * v3)) % 1);
+                    v3 = (((a0[5] / 2) || (v0 != i2)) > ((v1 >= v0) > (65 == v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            a0[10] = (((v2 && a1[2][6]) % 6) > ((a1[2][14] % 6) ? (v1 && a1[0][3]) : (a1[1][0] % 1)));
+            a1[0][12] = (((60 - 98) || (30 % 6)) > ((a1[0][1] >= v3) + (v2 * 12)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((v0 != a0[9]) > 95) break;
+            v0 = (((a0[1] ? v2 : 14) ? (v1 == i4) : (v1 && 41)) <= ((38 >= v2) || (v1 / 6)));
+            v2 = (((v0 / 3) > (v0 ? v2 : v3)) != ((a0[12] <= v1) <= (v1 || 87)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a1[3][11] = (((a1[3][13] % 4) != (72 * a0[0])) && ((a0[11] && 35) && (2 <= v3)));
+                v3 = (((a1[0][1] == v3) + (a1[2][11] && 99)) > ((v3 * i4) % 9));
+                v2 = (((a0[1] <= 30) || (i4 ? i5 : i4)) - ((a1[2][13] >= 99) ? (i5 <= v1) : (v1 || a0[13])));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((v0 % 7) == (v3 + 66)) >= ((75 / 9) % 9));
+}
+int f1() {
+    int v0 = 78;
+    int v1 = 88;
+    int v2 = 42;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            a1[1][8] = (((66 ? a0[14] : v1) * (a0[13] > 11)) / 5);
+            v0 = (((a1[2][15] == v3) <= (37 % 8)) <= ((v2 <= 41) - (a0[13] < a1[2][1])));
+            a0[15] = (((v1 && i0) > (v2 % 4)) <= ((84 / 7) % 4));
+        }
+        v1 = (((a0[6] || i0) && (v2 && v2)) < ((i0 != 98) == (v1 != v2)));
+        v0 = (((v2 % 5) >= (v2 + v0)) >= ((44 % 4) < (a1[0][8] + v1)));
+    }
+    v3 = (((a0[13] > v2) * (v0 || v2)) != ((51 && v0) <= (v3 ? a1[2][11] : v0)));
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v1 ? 41 : a1[2][10]) > 62) break;
+            a0[4] = (((v3 ? a1[3][5] : v3) == (23 / 4)) - ((54 == 58) % 4));
+            a0[9] = (((v2 && 95) / 1) <= ((i2 > a1[2][8]) >= (i2 - 42)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((v2 || i2) > 63) break;
+                a0[2] = (((99 < v0) >= (i3 < a1[3][4])) * ((a1[1][4] / 1) ? (a0[11] <= a1[3][11]) : (v2 * i3)));
+                a0[15] = (((48 % 6) > (i2 != 77)) ? ((55 - v3) / 5) : ((a0[9] > v0) <= (17 >= 92)));
+                v0 = (((v1 || a0[9]) > (74 * v1)) % 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v3 - a0[6]) || (35 * a1[0][9])) <= ((a1[3][5] ? a0[9] : 25) / 3))) {
+        v1 = (((v2 / 4) * (v0 / 4)) / 6);
+        a1[0][1] = (((v3 / 5) == (v0 && v1)) == ((46 - a1[2][3]) > (97 ? v0 : v2)));
+        v1 = (((v2 >= 32) || (v0 || a1[3][1])) < ((24 / 9) * (a0[12] + v1)));
+    } else {
+        v2 = (((a1[3][5] > 73) < (v2 && a1[0][9])) / 7);
+        v2 = (((v2 - a1[2][5]) / 5) != ((a1[0][0] % 8) >= (61 >= 94)));
+        v1 = (((a0[0] > v3) / 2) + ((66 && a1[3][4]) % 6));
+    }
+    if ((((v2 == v3) <= (v0 * v2)) > ((v3 - a1[3][7]) + (v2 / 3)))) {
+        a1[0][8] = (((a0[5] <= v0) && (v2 > v0)) && ((6 < v3) / 3));
+        v0 = (((v3 != v0) < (v3 != a1[3][2])) != ((a0[8] + a0[10]) / 6));
+        a1[0][8] = (((a1[2][7] - v3) ? (v3 ? 68 : v0) : (86 * 29)) != ((a0[1] > a1[1][7]) < (v3 && v2)));
+    } else {
+        a1[2][12] = (((v0 % 9) != (v3 || v1)) == ((v1 == v2) ? (a1[1][1] + v1) : (a0[4] <= v0)));
+        v2 = (((v2 >= 94) ? (v1 <= v0) : (v1 % 8)) > ((v0 || 7) == (v0 > 78)));
+        v0 = (((v2 % 4) % 8) / 6);
+    }
+    return (((a1[3][3] ? 21 : 80) < (v0 && v0)) < ((76 % 1) ? (86 > a0[6]) : (a0[6] ? 13 : v1)));
+}
+int f2() {
+    int v0 = 37;
+    int v1 = 77;
+    int v2 = 26;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v0 = (((a0[12] - 16) <= (v2 + 47)) && ((v1 < 94) / 5));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v2 = (((v3 >= 91) < (i0 - 1)) && ((v1 + i0) % 4));
+                v0 = (((27 / 2) * (v3 + v3)) + ((42 == 61) < (68 > 72)));
+                a1[1][13] = (((a0[14] >= i0) > (i0 ? 89 : v0)) / 6);
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((a0[5] * v2) && (44 >= 50)) % 9);
+    }
+    v1 = (((a0[2] < v3) - (v0 * a1[2][15])) || ((v2 > v1) / 2));
+    a0[7] = (((v3 >= 29) > (v3 ? v2 : v0)) || ((49 % 1) % 1));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((v3 < v2) > 89) break;
+            v0 = (((20 % 6) - (a1[0][2] / 9)) >= ((76 <= v1) <= (v1 <= 60)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((v2 - 41) > 81) break;
+                    v0 = (((a1[1][2] <= v3) ? (v2 * 38) : (a0[6] && 61)) % 9);
+                    a0[5] = (((67 > a1[0][9]) ? (v3 < a1[0][4]) : (v3 && v2)) * ((i2 - v2) && (a1[2][10] != a0[6])));
+                    a0[7] = (((54 > v0) > (i2 + a0[4])) > ((a0[3] ? v0 : v2) || (v3 || v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[2] = (((79 != v1) >= (v1 / 7)) <= ((v0 != a1[0][8]) * (v1 || v1)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((60 == v1) + (63 < v3)) != ((52 > v2) == (99 && v3)))) {
+        v2 = (((v3 * 32) < (a0[7] % 5)) == ((98 && v3) > (a1[3][11] - v0)));
+        v0 = (((a1[2][2] ? a1[3][9] : 33) >= (27 ? a0[12] : a1[3][5])) - ((19 && v0) != (53 / 3)));
+        v1 = (((a1[0][10] > v2) / 5) > ((a1[2][6] == a1[3][9]) ? (52 / 6) : (v3 <= v3)));
+    } else {
+        a1[1][12] = (((v2 > v0) || (v1 >= a0[15])) == ((v2 + a1[3][3]) - (64 <= v3)));
+        v1 = (((a0[15] <= v2) ? (v1 + v0) : (38 || 24)) ? ((v0 || v2) ? (v2 >= a0[5]) : (86 && v0)) : ((v3 >= 21) + (v0 + v2)));
+        a0[7] = (((a0[12] && a1[0][5]) >= (0 ? v0 : v3)) || ((21 * a1[0][10]) * (28 ? v2 : a1[1][9])));
+    }
+    return (((a0[12] * a0[12]) - (v1 < a0[11])) * ((a1[3][13] / 6) > (87 && 66)));
+}
+int main() {
+    return 0;
+}
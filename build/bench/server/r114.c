@@ -0,0 +1,58 @@
+int f0() {
+    int v0 = 66;
+    int v1 = 96;
+    int v2 = 71;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 ? 63 : a1[1][11]) != (a0[13] ? 46 : v0)) ? ((v2 || v1) != (a1[0][0] * a1[3][15])) : ((a1[3][9] <= v0) && (v2 && v0)))) {
+        v1 = (((a1[3][8] % 4) + (84 + v1)) ? ((v0 >= 37) != (v3 == 24)) : ((a0[11] % 9) ? (v1 * a1[0][7]) : (a1[1][1] <= a0[8])));
+        v1 = (((a0[13] ? v2 : 31) * (v0 && v0)) * ((9 != a0[12]) % 4));
+        v2 = (((a0[2] - v2) < (a1[3][14] >= a1[1][10])) ? ((v1 + 23) * (27 || 38)) : ((a0[15] * v2) || (v1 != 92)));
+    } else {
+        v1 = (((v0 || a0[2]) * (v0 >= v2)) ? ((v3 >= 71) != (a1[1][5] != 52)) : ((a0[11] > v2) == (67 - a1[0][5])));
+        v2 = (((30 / 9) < (v3 % 5)) <= ((v2 != v0) || (38 && a1[3][8])));
+        v2 = (((8 == 5) / 1) ? ((v2 ? a0[11] : v1) * (a0[0] ? 95 : v3)) : ((a1[2][7] ? 39 : v2) / 2));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v2 = (((a1[3][5] ? a1[1][9] : a1[2][5]) <= (a0[2] == 21)) - ((a0[6] == 92) + (v3 < i0)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v1 = (((a0[7] * v2) < (v0 > a0[1])) ? ((a1[0][14] > i1) % 8) : ((66 <= v0) / 3));
+                v1 = (((v0 % 4) || (71 % 2)) != ((a0[8] - 32) >= (a1[3][10] == i1)));
+                v0 = (((v3 ? a0[7] : a0[4]) <= (v0 && a1[3][11])) != ((v1 < 46) + (a0[8] > v2)));
+            }
+            v3 = (((a0[1] < a1[0][7]) / 9) - ((v1 + v2) ? (i0 || 98) : (v0 ? i0 : a0[9])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((v3 != a0[9]) > 98) break;
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v0 = (((v3 >= 33) <= (v1 <= v0)) || ((58 * v1) != (i2 ? 97 : a0[10])));
+                v1 = (((v3 * i3) && (a0[3] ? i3 : a1[1][1])) >= ((v2 && 39) / 7));
+                a0[13] = (((v0 + i3) / 5) % 3);
+            }
+            v1 = (((a0[11] ? 37 : v3) <= (v1 - v3)) ? ((v0 % 8) != (52 - 72)) : ((16 > 22) >= (12 > 48)));
+            v3 = (((v2 / 7) < (i2 < i2)) || ((i2 != 88) - (v2 - v0)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v2 != v0) && (v0 && 93)) < ((10 / 6) - (6 > a1[3][6])))) {
+        v3 = (((a1[0][4] % 8) * (a1[3][1] && v0)) == ((v2 > v0) > (43 || v1)));
+        a1[3][11] = (((a1[1][7] % 5) % 4) - ((v3 / 2) % 4));
+        v2 = (((2 == 96) + (a1[2][3] <= v2)) + ((62 < 26) && (v2 - v3)));
+    } else {
+        a1[1][3] = (((v1 - v0) != (v2 <= a0[10])) / 5);
+        v1 = (((v3 >= v2) == (v2 <= v3)) + ((51 ? v1 : v2) / 1));
+        a0[7] = (((v0 != v3) % 5) - ((13 < 52) <= (97 % 6)));
+    }
+    v1 = (((29 + 1) * (51 * a0[5])) < ((v3 <= v3) < (v0 - v2)));
+    return (((v0 ? v3 : 70) ? (v0 && v1) : (v3 && v0)) <= ((a1[1][3] - v3) ? (v3 ? 15 : 91) : (a0[5] % 7)));
+}
+int main() {
+    return 0;
+}
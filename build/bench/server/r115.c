@@ -0,0 +1,150 @@
+int f0() {
+    int v0 = 13;
+    int v1 = 87;
+    int v2 = 8;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((96 >= v2) != (27 == v2)) % 9);
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((v3 != a0[9]) > 67) break;
+                    v2 = (((v2 % 8) <= (a1[1][12] + 65)) && ((i1 - i1) >= (57 - v3)));
+                    v2 = (((v3 <= a0[3]) + (i0 * v0)) > ((v2 == a1[0][9]) ? (a0[9] <= a0[7]) : (a0[11] * v1)));
+                    v2 = (((v2 % 6) || (91 + v1)) || ((a1[2][10] <= a1[0][1]) % 2));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((4 + v1) || (v0 <= 74)) < ((v0 != a1[0][1]) ? (v2 < 18) : (v3 != a0[6])));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v1 = (((63 == 56) + (71 <= 39)) - ((v0 + 67) && (i2 > v1)));
+                v1 = (((i2 < 59) != (v3 / 4)) ? ((i2 % 5) == (a1[3][6] ? a0[2] : 25)) : ((51 * v3) + (i2 ? v3 : v0)));
+                v3 = (((46 ? a0[11] : v2) % 4) / 8);
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        a1[0][14] = (((v0 < v2) * (v1 || a1[1][6])) ? ((36 >= 69) * (64 < 96)) : ((v0 / 9) > (a1[1][4] * i2)));
+        v2 = (((27 / 4) + (v1 ? 53 : i2)) <= ((v1 <= a1[2][10]) ? (42 % 1) : (a0[5] + a1[1][15])));
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[2][6] = (((a0[12] / 7) * (i4 || a0[7])) >= ((v2 < a0[3]) ? (v1 || 37) : (3 != a1[3][1])));
+            v0 = (((a1[0][5] - 64) < (i4 == a1[0][6])) ? ((v0 * v0) >= (i4 != 33)) : ((i4 || v0) ? (4 <= v3) : (a0[1] % 8)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v2 = (((v2 >= a0[3]) >= (i4 != v1)) > ((v0 % 3) % 4));
+                v3 = (((v1 && 83) < (i4 / 9)) / 6);
+                a0[10] = (((a1[1][14] - 31) > (a0[9] / 6)) != ((i4 <= v1) / 4));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            a1[0][4] = (((v1 + a1[1][12]) / 8) ? ((45 == 45) / 6) : ((v0 <= v2) - (a0[2] / 6)));
+            a1[1][8] = (((v0 % 9) <= (48 && v2)) * ((v0 == a1[3][1]) % 9));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v3 = (((46 >= 38) <= (i7 < a1[3][13])) < ((a1[0][13] / 6) && (v0 + 72)));
+                v0 = (((a1[0][12] >= v0) ? (v3 >= 45) : (i7 * v0)) == ((v0 ? i7 : v1) >= (v0 * v3)));
+                v2 = (((v0 == i6) % 7) >= ((44 != i7) <= (i7 && v0)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        a1[0][10] = (((v0 / 8) ? (v3 <= 85) : (9 != 17)) + ((33 != v2) % 7));
+        {
+            int i9 = 0;
+            while (i9 < 6) {
+                v1 = (((v2 > v0) ? (v3 < v1) : (a1[0][13] == 32)) + ((a0[11] + 45) ? (21 < i9) : (a1[3][0] == a1[2][1])));
+                v1 = (((i8 - a1[0][8]) != (i9 <= i9)) ? ((51 >= 69) ? (a1[3][5] <= 58) : (54 != 75)) : ((66 ? i9 : v0) != (37 <= v1)));
+                a1[3][12] = (((i8 * 88) ? (v3 ? a1[2][4] : a0[6]) : (i8 + i8)) < ((i8 > 38) / 2));
+                i9 = i9 + 1;
+            }
+        }
+        a1[1][2] = (((a1[0][15] == v1) <= (v2 + a0[7])) < ((v1 / 9) * (v3 / 7)));
+    }
+    return (((68 >= v1) == (58 + 33)) / 3);
+}
+int f1() {
+    int v0 = 63;
+    int v1 = 85;
+    int v2 = 30;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    if ((((60 * v2) - (v0 ? 72 : v3)) - ((v3 * v2) ? (a1[3][6] <= v3) : (v3 / 7)))) {
+        v3 = (((v3 == 51) + (v2 >= 98)) && ((23 / 6) < (v2 - 56)));
+        v2 = (((v1 ? v1 : 61) + (v1 || v2)) > ((a1[3][13] ? v1 : 93) % 3));
+        a0[15] = (((v2 / 2) || (64 > 90)) + ((80 && a0[6]) || (52 / 5)));
+    } else {
+        v1 = (((a0[2] < a1[2][0]) != (a0[15] - 28)) && ((79 >= v1) + (v0 >= 54)));
+        a1[2][2] = (((54 || 14) >= (v3 ? a0[6] : v0)) ? ((v3 <= 7) < (v1 / 1)) : ((a1[1][12] - a0[0]) != (v1 > 0)));
+        v2 = (((10 || a1[3][1]) ? (v3 / 3) : (30 > 56)) - ((99 != v3) <= (v3 < v0)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v3 / 5) >= (v2 + v0)) > ((v3 || i0) == (i0 != 61)));
+                    v2 = (((v1 || v3) < (v3 % 7)) > ((a0[6] > a0[1]) || (v0 % 5)));
+                    a1[0][12] = (((98 || a0[8]) != (a1[2][14] <= a0[1])) ? ((i1 <= 37) % 7) : ((99 || 82) < (v1 * 81)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v1 = (((v3 <= v0) && (a0[10] < a0[4])) <= ((a0[9] % 6) % 7));
+            a1[0][6] = (((18 / 9) >= (a0[15] ? a1[3][6] : v2)) ? ((a1[3][8] / 2) % 6) : ((a1[1][8] * i0) > (v2 ? 33 : a0[11])));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v0 = (((a1[2][5] == 41) && (83 ? a0[6] : a0[1])) || ((v0 >= a0[3]) % 4));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v0 = (((9 == v2) ? (v3 != a0[15]) : (i2 && v2)) ? ((v0 <= v2) < (61 ? a1[0][1] : v0)) : ((i2 >= 12) + (a0[6] / 4)));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((54 != v0) <= (v3 ? 99 : a1[0][3])) >= ((v2 != 41) && (v3 <= a0[3])));
+                v3 = (((a1[3][13] >= v1) - (a0[1] || 11)) * ((a0[0] == a1[0][13]) * (v2 < v2)));
+                v2 = (((v3 != v1) && (a1[3][15] + v2)) != ((a1[1][2] != a1[2][14]) + (15 < i2)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        a0[5] = (((v1 / 8) >= (v0 + 15)) == ((a0[14] != v2) ? (v2 != 21) : (v2 == 74)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((8 >= i4) > 52) break;
+            v2 = (((23 >= 7) ? (i4 * a0[5]) : (v1 ? 35 : v2)) * ((v0 * v2) - (a0[0] + 24)));
+            a1[3][13] = (((v3 != 36) || (i4 + a0[1])) ? ((89 > 14) ? (a1[3][4] * a1[1][5]) : (v1 ? a0[15] : i4)) : ((v0 && 22) == (a1[1][1] * v3)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    if ((8 <= 22) > 95) break;
+                    a0[12] = (((v0 && 51) / 2) >= ((i4 * i4) == (v1 >= i5)));
+                    a1[0][12] = (((94 && a1[2][11]) * (i5 % 5)) % 6);
+                    v2 = (((v0 ? a0[8] : i4) != (v2 % 3)) < ((a1[1][0] > a0[12]) * (v3 > 13)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((a0[4] * v3) * (34 + a1[0][13])) >= ((a1[0][11] + a1[0][14]) ? (v3 == v0) : (v3 ? v2 : a0[9])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,199 @@
+int f0() {
+    int v0 = 14;
+    int v1 = 36;
+    int v2 = 36;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v0 && a1[2][10]) <= (v2 + a1[1][6])) / 2);
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        a1[3][2] = (((v0 / 3) >= (a0[4] + v1)) && ((45 ? v1 : a1[0][2]) * (v2 != a0[9])));
+        {
+            int i1 = 0;
+            do {
+                if ((v3 / 6) > 99) break;
+                v3 = (((i1 ? 31 : v3) != (a1[0][6] < v0)) < ((a0[13] % 8) != (i0 != i0)));
+                v2 = (((a0[3] % 9) / 3) + ((i0 == a0[6]) / 6));
+                a0[12] = (((85 >= i1) + (v2 ? 95 : 41)) + ((i1 * 62) ? (v3 * v3) : (78 ? v1 : 92)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v3 = (((a1[2][4] >= 43) != (a1[1][4] == i0)) < ((v0 - v2) ? (61 <= v2) : (v3 > v2)));
+    }
+    if ((((v3 % 7) >= (a1[3][2] || v2)) % 7)) {
+        v2 = (((a1[2][13] <= v0) * (v1 ? v2 : v0)) ? ((v2 == v0) / 2) : ((v3 % 5) <= (v0 + a0[2])));
+        a1[3][4] = (((83 / 9) >= (86 <= a0[6])) ? ((93 != 67) * (a1[3][15] % 8)) : ((a0[14] > v3) ? (v1 > v3) : (v3 < a1[2][13])));
+        v2 = (((79 || v3) % 6) / 7);
+    } else {
+        v0 = (((v3 > v1) * (76 >= v0)) && ((21 >= v3) / 5));
+        v0 = (((8 == a1[0][9]) % 1) == ((v1 <= 21) / 4));
+        v3 = (((a0[12] || v0) ? (v0 && v0) : (v1 * v1)) ? ((v2 ? 59 : v3) ? (v0 >= 82) : (v0 % 7)) : ((v1 != 1) ? (v3 <= v2) : (v3 <= v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    a1[1][8] = (((a0[1] / 6) > (v1 > 70)) * ((a0[5] && i3) - (a0[0] && v0)));
+                    v1 = (((v2 / 3) == (a0[0] ? 1 : a0[13])) || ((66 < v3) - (i3 - 51)));
+                    a1[0][13] = (((a0[12] ? v0 : v2) && (27 < v0)) ? ((a0[1] ? 34 : v0) == (v1 % 2)) : ((a1[3][8] != a0[12]) ? (v0 * v1) : (v1 / 6)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v3 = (((a1[1][11] >= i2) - (v0 % 5)) % 2);
+            v3 = (((v3 != v2) % 8) >= ((a1[1][9] - 3) && (13 != v2)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((a0[8] || 35) > 61) break;
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v0 = (((a1[2][14] || a0[9]) % 7) > ((74 ? v3 : i5) - (a1[3][8] * a1[2][10])));
+                a1[0][0] = (((a0[11] == a0[3]) ? (v2 ? i5 : 91) : (2 <= 57)) / 8);
+                v1 = (((a1[0][7] > i4) / 1) + ((v1 == i4) % 5));
+            }
+            v2 = (((v1 ? v1 : v2) / 2) ? ((a1[0][13] ? v0 : 49) || (13 < 72)) : ((58 * v0) != (i4 != i4)));
+            v1 = (((v0 ? i4 : v1) * (v3 / 4)) ? ((a0[15] > 91) + (a1[2][8] >= 43)) : ((i4 && a1[0][7]) > (50 / 8)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((40 / 4) % 2) >= ((79 <= a1[2][13]) < (v3 || v1)));
+}
+int f1() {
+    int v0 = 84;
+    int v1 = 7;
+    int v2 = 68;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    if ((((59 > v3) || (v0 <= v1)) ? ((46 ? v3 : a0[2]) < (v1 <= v0)) : ((v3 - 87) > (a0[9] / 5)))) {
+        v3 = (((19 / 1) > (47 || 92)) > ((71 == 96) >= (v2 < a1[1][3])));
+        v3 = (((v1 <= v2) % 6) / 1);
+        v0 = (((a1[2][1] + a1[0][4]) ? (v2 == v2) : (v1 || a0[7])) <= ((v3 > v1) != (21 <= a0[15])));
+    } else {
+        a0[4] = (((a0[7] > v1) % 8) == ((16 - v3) != (44 && a0[1])));
+        a0[5] = (((v1 <= v3) != (a0[12] || v0)) != ((v2 == v2) - (v2 + v1)));
+        v3 = (((a1[3][13] - v2) % 3) != ((a1[2][3] == 94) ? (v1 % 7) : (v0 ? v0 : a1[0][2])));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v2 = (((a1[2][4] % 5) == (v1 % 6)) && ((49 != v3) - (v1 >= a1[0][4])));
+            a1[1][0] = (((v1 ? a0[0] : v1) + (v3 / 5)) - ((91 > v0) / 7));
+            v3 = (((46 + 34) && (v3 > v1)) && ((a0[11] || v2) == (a1[3][5] / 8)));
+        }
+        v3 = (((v1 / 7) + (v2 ? a0[8] : a1[3][1])) <= ((v3 || 26) + (v1 < v1)));
+        a0[14] = (((i0 - a1[0][10]) ? (a1[1][7] ? a1[0][4] : i0) : (v2 ? v2 : v1)) != ((v0 >= i0) != (v0 * a1[1][11])));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 && 74) > 62) break;
+            a1[1][2] = (((v2 > 91) >= (a1[3][5] != 3)) - ((i2 + v3) / 4));
+            v3 = (((v1 / 1) || (a0[14] && i2)) <= ((v1 > a0[7]) + (52 < v2)));
+            {
+                int i3 = 0;
+                do {
+                    if ((76 || v2) > 86) break;
+                    a0[0] = (((v3 != v1) != (v3 + v0)) + ((46 == a0[5]) - (i2 - v1)));
+                    v1 = (((v1 + v0) || (44 / 7)) <= ((i2 * a1[1][3]) != (a1[0][15] >= 98)));
+                    v1 = (((v1 % 9) ? (v0 || a0[0]) : (v1 / 9)) || ((a0[6] < 91) >= (i3 > a1[0][10])));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            a1[2][3] = (((98 && 52) && (v3 ? 75 : a1[3][15])) || ((i4 / 1) ? (36 - v1) : (8 <= a1[3][5])));
+            v0 = (((v0 == v2) != (v0 * v0)) - ((a0[8] ? 44 : 17) - (v1 || i4)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((a0[14] * v0) ? (v1 - v3) : (v3 * i5)) ? ((a0[10] ? 20 : i5) - (i5 && v0)) : ((v1 * i4) ? (87 <= a0[1]) : (a0[4] == 46)));
+                    v2 = (((44 / 3) ? (67 <= v2) : (18 * i5)) > ((99 == a1[1][5]) + (68 || a0[6])));
+                    v2 = (((i5 - 37) || (v1 * v3)) / 6);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            if ((65 - 36) > 73) break;
+            v0 = (((a1[1][10] ? 43 : v0) >= (i6 >= a0[5])) != ((v0 - a1[1][15]) != (46 != a0[6])));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v3 = (((v1 < a0[12]) + (30 - a1[1][4])) + ((v1 >= v2) % 4));
+                a1[3][9] = (((v2 > a1[3][4]) < (7 * v2)) / 5);
+                v0 = (((v1 ? a0[1] : 10) * (75 <= a1[2][8])) - ((v1 > a0[4]) % 9));
+            }
+            v2 = (((v1 <= a1[0][6]) / 4) && ((i6 || 2) + (i6 < 37)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((38 != v2) >= (70 <= a1[2][7])) + ((a0[0] != a1[2][3]) ? (v2 ? v1 : v2) : (v2 != v1)));
+}
+int f2() {
+    int v0 = 95;
+    int v1 = 52;
+    int v2 = 47;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            a1[0][13] = (((i1 > v3) > (12 || i0)) ? ((v1 && a0[15]) > (80 || i1)) : ((58 > i0) < (i0 || i1)));
+            a0[13] = (((41 - a1[3][15]) < (a1[2][14] > v3)) - ((a0[12] - v0) && (i1 < v0)));
+            a1[2][1] = (((a0[1] && a0[14]) <= (40 <= a0[3])) != ((v0 < i0) ? (a0[0] > i1) : (v0 % 4)));
+        }
+        v3 = (((18 == v0) == (i0 <= a1[0][3])) / 6);
+        v0 = (((v1 % 3) / 3) + ((v3 <= i0) >= (74 && v1)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a1[3][8] = (((i2 + 43) && (10 < 17)) == ((v2 <= v2) || (a1[3][5] % 2)));
+        v2 = (((v0 < a1[1][13]) ? (i2 - i2) : (45 % 9)) * ((a1[2][11] % 4) || (a1[2][0] ? v3 : i2)));
+        {
+            int i3 = 0;
+            do {
+                a0[3] = (((27 && 3) - (v0 + a1[2][4])) < ((a0[2] || v1) - (74 % 2)));
+                v2 = (((v2 != v1) == (v1 > v0)) <= ((i2 == v0) * (a1[2][14] || i3)));
+                v1 = (((a1[2][7] < v3) && (i2 != v2)) ? ((87 && 10) / 6) : ((v1 <= a1[0][8]) - (v1 == a1[3][13])));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    if ((((v0 && v0) || (a1[1][6] * v2)) >= ((39 ? 77 : v2) % 1))) {
+        v2 = (((v1 == 63) ? (v2 && 24) : (v0 - a1[3][10])) != ((v3 + v1) || (v2 && a1[3][1])));
+        v2 = (((v2 == v2) == (v3 ? a1[2][0] : 69)) - ((95 * v1) > (v3 > a0[3])));
+        v0 = (((v3 - 55) - (a1[3][14] || 64)) > ((68 == v1) * (a0[6] <= a1[1][2])));
+    } else {
+        v2 = (((a1[1][9] ? v3 : a1[0][15]) >= (99 - a1[3][7])) && ((62 ? v3 : a1[2][11]) != (a1[0][8] < a1[3][5])));
+        a1[0][1] = (((a1[2][1] ? v1 : 44) ? (v0 * v2) : (v1 ? 16 : a1[0][5])) != ((17 * v2) * (47 == v1)));
+        a0[3] = (((86 < v0) - (9 == v0)) - ((0 * 96) == (a0[10] % 6)));
+    }
+    a0[10] = (((v2 % 1) && (v3 || 36)) == ((v2 && 57) >= (a0[15] + v0)));
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            if ((v2 / 9) > 81) break;
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v3 = (((43 ? a0[2] : 89) < (a0[4] || a1[3][12])) ? ((40 / 2) != (i5 % 3)) : ((v0 && 86) != (a1[1][11] != v1)));
+                v1 = (((a0[0] <= v1) - (60 ? v2 : 90)) && ((v2 + a0[4]) ? (i4 > a1[2][9]) : (a1[0][8] ? a1[1][15] : a1[1][7])));
+                a1[1][10] = (((a0[10] ? a0[0] : i5) / 2) && ((v3 <= a1[3][4]) > (v0 ? v1 : 73)));
+            }
+            v3 = (((34 * 69) <= (70 > 1)) / 9);
+            a0[11] = (((i4 * v0) < (a1[2][10] == 34)) * ((a1[2][14] == v0) * (23 - a1[0][12])));
+            i4 = i4 + 1;
+        }
+    }
+    return (((15 && v3) && (v0 * a1[3][8])) < ((a0[13] % 4) >= (9 != v3)));
+}
+int main() {
+    return 0;
+}
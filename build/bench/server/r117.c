@@ -0,0 +1,50 @@
+int f0() {
+    int v0 = 64;
+    int v1 = 91;
+    int v2 = 31;
+    int v3 = 21;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((12 || 41) || (v0 / 4)) / 5);
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((65 >= v2) > 81) break;
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v1 = (((i1 + v3) + (v1 ? v0 : v2)) >= ((84 > v3) < (v2 ? 43 : 56)));
+            v3 = (((i1 + a0[9]) != (a1[2][15] >= i0)) + ((a0[7] ? v3 : a0[5]) / 6));
+            v2 = (((v0 == 15) + (a1[2][6] % 2)) - ((71 - 30) < (a0[3] != v2)));
+        }
+        v0 = (((a1[0][8] ? 40 : a0[9]) != (a0[1] * v1)) <= ((14 - v2) + (v3 && 79)));
+        v0 = (((a0[10] == v0) || (v0 == 76)) != ((a1[2][1] != 95) || (24 ? i0 : a0[9])));
+    }
+    if ((((v3 <= 53) != (31 >= a1[2][1])) <= ((a0[9] <= v3) <= (v3 ? v1 : v1)))) {
+        a0[12] = (((v2 && a1[3][0]) == (a1[3][8] == 59)) < ((v2 ? v1 : 35) + (v0 > v2)));
+        v3 = (((v0 + v2) && (a0[9] - 22)) != ((v2 ? a1[0][9] : v0) * (v2 * v0)));
+        v2 = (((a0[4] <= v0) >= (v3 * 41)) - ((v2 <= v0) != (v2 == v0)));
+    } else {
+        a1[3][4] = (((v1 == a0[1]) < (v2 > 69)) < ((a1[0][4] && a0[4]) == (v0 ? 87 : v0)));
+        v2 = (((v1 - v2) / 4) > ((a1[2][11] ? 6 : 74) && (v2 ? a0[10] : 33)));
+        v3 = (((v1 <= v1) <= (40 % 6)) ? ((73 || a0[0]) <= (v1 * v1)) : ((4 + v1) >= (a0[6] + v1)));
+    }
+    v2 = (((v1 >= a1[2][14]) || (13 <= a1[0][4])) % 9);
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((v3 ? v0 : 86) >= (14 < a1[1][9])) - ((i2 / 4) != (32 ? v0 : v2)));
+                    v0 = (((a0[6] < 84) - (v2 && v3)) > ((37 || 19) == (39 + v1)));
+                    a0[7] = (((v3 < 67) * (i2 / 4)) ? ((a0[2] ? i3 : v2) < (2 * a0[12])) : ((63 || 15) <= (i2 % 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            a0[2] = (((v2 / 1) * (v0 || 55)) ? ((25 ? v0 : a1[1][1]) - (69 != i2)) : ((59 ? 85 : 56) && (72 && v1)));
+            a0[11] = (((v2 && 83) > (v2 ? v1 : i2)) / 7);
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    return (((14 == v2) ? (v1 == v2) : (a0[8] * a1[3][1])) ? ((27 * a0[12]) < (v2 % 3)) : ((v1 > v2) - (a0[15] ? v1 : 75)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,128 @@
+int f0() {
+    int v0 = 86;
+    int v1 = 22;
+    int v2 = 38;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    if ((((54 < 58) % 7) / 6)) {
+        v1 = (((v2 + 52) || (15 || a1[3][7])) == ((20 || v3) ? (v3 ? v2 : v2) : (v2 >= v3)));
+        v3 = (((v1 * a0[14]) / 1) > ((62 <= 84) && (a1[0][9] && a0[12])));
+        v1 = (((v3 + v0) * (v0 && a0[4])) * ((v1 ? v0 : v1) || (a1[2][12] - 32)));
+    } else {
+        a0[6] = (((v3 * v3) != (a0[13] >= 89)) ? ((a1[1][0] && v2) ? (v1 || a0[11]) : (a1[3][2] - a1[2][12])) : ((a1[3][1] % 1) != (a1[1][5] || v0)));
+        v2 = (((v1 >= v2) < (a1[2][15] - v2)) + ((49 ? v1 : v2) + (34 != v2)));
+        v3 = (((a1[3][15] && v0) == (v2 ? 10 : v2)) != ((v2 != a1[0][10]) && (a1[1][8] <= 62)));
+    }
+    if ((((a0[8] + 43) > (v1 < v3)) ? ((7 != 8) <= (56 / 9)) : ((12 == v3) ? (v2 + v1) : (v1 - v0)))) {
+        v3 = (((v3 > a1[1][1]) - (44 != 66)) || ((0 ? a1[1][4] : v0) + (v1 != v2)));
+        v0 = (((30 + v0) * (47 ? v0 : a1[1][8])) * ((99 || 1) >= (v0 || 11)));
+        v2 = (((v3 == 27) >= (v2 > v1)) ? ((a1[1][15] * v3) || (v2 < v2)) : ((v3 != v1) >= (v3 || v0)));
+    } else {
+        v0 = (((78 + 26) > (43 < v2)) - ((v3 && v2) <= (a1[1][4] == a1[1][3])));
+        a1[0][4] = (((v0 <= v1) && (78 <= v0)) <= ((47 - a1[2][14]) > (v0 < v3)));
+        v0 = (((v3 != v2) && (a0[4] == a0[8])) > ((a1[0][8] / 3) ? (v3 * 41) : (78 * 40)));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a0[9] = (((v1 != i0) ? (a0[7] % 5) : (v2 - 84)) / 5);
+            v3 = (((a1[0][4] <= a0[12]) > (a1[2][11] >= v1)) / 1);
+            v2 = (((v3 < 4) ? (v2 >= v3) : (a0[6] * a1[3][10])) >= ((a0[2] < 72) + (73 <= a0[12])));
+        }
+        a1[2][3] = (((v2 ? v2 : i0) <= (v1 > i0)) && ((44 / 4) % 6));
+        a1[1][0] = (((40 + v0) * (a0[11] ? v3 : v2)) ? ((a1[0][5] * i0) % 6) : ((v2 >= v1) != (v3 >= a0[12])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            a1[2][10] = (((v3 <= 74) + (v1 <= v3)) - ((69 || v3) >= (61 ? v3 : v1)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a1[2][3] = (((v1 <= i3) >= (v0 ? a0[3] : a0[11])) ? ((v0 ? a1[0][13] : v0) ? (24 < 67) : (v0 % 6)) : ((v3 ? v2 : i3) >= (i2 >= a1[1][14])));
+                v2 = (((56 >= 92) + (a1[2][9] < i3)) % 9);
+                v2 = (((i2 != 17) + (14 <= 94)) == ((a0[0] - a0[10]) > (a1[1][2] && a0[7])));
+            }
+            a1[0][5] = (((70 * v3) < (i2 == a1[1][13])) * ((i2 != v1) ? (a0[4] < v2) : (80 > v3)));
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((a1[2][5] != v2) || (a1[0][0] + a1[1][3])) <= ((92 ? 24 : a1[3][8]) && (v2 / 8)));
+    return (((a1[3][7] ? a0[7] : 39) || (12 - v1)) ? ((v1 == a1[1][7]) >= (v0 >= 67)) : ((71 - a0[4]) <= (48 != v2)));
+}
+int f1() {
+    int v0 = 38;
+    int v1 = 44;
+    int v2 = 0;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((i1 >= v0) > 54) break;
+                    v0 = (((a1[0][12] ? a0[1] : i1) / 2) / 7);
+                    a0[1] = (((83 <= 73) % 8) == ((v0 - a1[2][10]) + (i0 && i1)));
+                    v2 = (((1 - i0) && (v2 <= a1[1][9])) && ((99 % 3) > (a1[3][9] >= 84)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v2 || i0) < (v0 + v3)) ? ((19 + a0[7]) >= (v0 == i0)) : ((a0[6] <= 92) && (i0 % 9)));
+            v1 = (((v3 >= 91) / 1) / 6);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v3 = (((i2 + a0[6]) >= (v1 <= v0)) + ((4 <= 35) ? (i2 - v2) : (v2 % 4)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v0 = (((v2 || v1) && (v3 > 8)) / 6);
+                    v3 = (((v2 != i2) ? (a1[2][1] >= a0[9]) : (i3 >= a0[8])) || ((v3 ? a1[0][11] : v1) / 5));
+                    a1[1][10] = (((i2 == 57) <= (i3 < i3)) != ((70 / 3) <= (a0[0] && 79)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((21 * v2) != (a1[1][11] - i2)) - ((v3 == a1[0][15]) + (4 * a1[1][5])));
+            i2 = i2 + 1;
+        }
+    }
+    a0[7] = (((68 - v1) + (v2 && v3)) == ((v3 ? v3 : a1[2][1]) || (a0[11] > 37)));
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v3 = (((45 < 49) < (63 <= a1[0][15])) ? ((v2 != 49) < (v3 * i4)) : ((a0[7] + v0) == (v3 <= a1[1][1])));
+                a1[2][10] = (((67 > 57) != (i5 / 4)) + ((a1[2][10] >= i4) >= (i4 * 55)));
+                v0 = (((34 / 4) < (92 - 59)) ? ((i5 ? v0 : 3) == (a0[8] >= 57)) : ((v2 == a1[3][5]) >= (v0 <= v3)));
+            }
+            a0[10] = (((a0[8] % 2) - (v1 * a1[3][8])) && ((v3 || a0[1]) - (a0[7] ? 3 : v2)));
+            v0 = (((70 == v0) * (a1[1][15] + v3)) <= ((v0 >= a1[3][14]) ? (55 / 1) : (a1[0][10] <= a1[2][4])));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        do {
+            v3 = (((49 / 2) % 3) - ((v0 % 2) || (v0 / 5)));
+            v0 = (((i6 >= 26) <= (a1[1][8] <= 23)) != ((v1 / 3) ? (v3 < v3) : (a0[12] % 7)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v1 = (((v0 % 4) ? (v0 == 61) : (a0[9] ? a0[11] : 13)) >= ((v3 != 86) && (i6 + 75)));
+                    a1[3][2] = (((52 <= v0) - (a1[0][5] ? 32 : a1[3][7])) * ((a0[7] >= 57) % 7));
+                    a1[3][11] = (((i7 ? 67 : 10) <= (78 && v3)) > ((v3 >= 55) ? (i6 == 16) : (59 + 97)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((v3 + v3) * (v3 ? a0[4] : v3)) && ((a0[0] != a0[15]) != (a0[15] < 78)));
+}
+int main() {
+    return 0;
+}
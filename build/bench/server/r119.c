@@ -0,0 +1,173 @@
+int f0() {
+    int v0 = 3;
+    int v1 = 68;
+    int v2 = 78;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 ? 99 : 61) - (v1 ? a0[14] : a0[9])) || ((61 >= a0[2]) - (v1 ? v3 : 80)))) {
+        v2 = (((v0 + a0[4]) * (v2 <= a1[1][7])) - ((v1 >= 57) ? (a1[3][8] + 20) : (v1 >= a1[1][14])));
+        v1 = (((v3 + v0) ? (v1 == v0) : (v0 == 34)) == ((a1[2][13] || v2) && (a0[12] * v1)));
+        v2 = (((v2 % 8) == (46 >= v2)) > ((v0 / 7) + (v1 && v0)));
+    } else {
+        v2 = (((a0[13] - a0[13]) == (v3 > v1)) > ((v0 % 4) || (v3 > 12)));
+        v3 = (((v2 && 97) > (v1 <= v2)) ? ((v3 ? v2 : 46) + (v2 || 79)) : ((a1[3][11] ? v2 : a0[0]) || (a1[3][9] && v3)));
+        v0 = (((a0[0] > a0[10]) == (57 / 8)) < ((a0[10] <= a1[0][14]) || (v3 > 74)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((54 - v2) > 91) break;
+        v3 = (((v0 > a1[2][7]) && (v0 ? a0[6] : 76)) && ((v3 <= v0) > (v1 > 67)));
+        v1 = (((v2 != v3) / 1) < ((43 != v2) != (i0 && a1[2][3])));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            a1[3][4] = (((v2 <= 36) ? (26 < v0) : (18 ? v2 : i1)) - ((v0 ? a1[3][0] : v0) >= (91 <= v0)));
+            v3 = (((a1[3][15] <= 0) || (v0 <= v2)) / 2);
+            v0 = (((70 < a0[14]) != (i1 || i1)) ? ((a0[6] - a0[4]) > (v1 < v0)) : ((i1 && a0[0]) && (v2 + 39)));
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        a0[8] = (((v2 + v1) ? (a0[9] <= v1) : (a1[2][8] * v2)) ? ((a1[2][4] * a1[3][15]) % 7) : ((v3 % 8) / 4));
+        v3 = (((v3 < 22) ? (85 + v3) : (41 >= v2)) || ((a1[1][3] != v3) ? (i2 == i2) : (31 ? a0[9] : v3)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v3 = (((52 / 2) * (i3 ? 19 : a1[0][8])) || ((39 || 72) + (v2 ? v1 : a0[12])));
+            v0 = (((a0[0] > v0) + (v1 * v2)) > ((a0[3] < 65) / 8));
+            v3 = (((i3 < v3) > (v3 * i3)) && ((v0 < i3) - (v1 ? v3 : 94)));
+        }
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v2 = (((v3 ? a0[2] : v1) >= (14 >= a0[7])) <= ((v2 < a1[0][3]) ? (a1[0][0] == v3) : (a1[0][6] + v3)));
+        v3 = (((13 || a1[0][1]) == (40 <= 12)) || ((10 * a1[0][11]) / 8));
+        {
+            int i5 = 0;
+            do {
+                v2 = (((v2 - a1[3][15]) && (v3 || a0[7])) ? ((v3 - 3) <= (a1[2][8] > v3)) : ((v2 || 95) % 2));
+                v1 = (((v1 > i5) < (i5 * a0[6])) <= ((68 + i4) ? (i4 == i4) : (94 * 84)));
+                a0[14] = (((v3 < 34) * (a1[3][12] ? i4 : a1[1][12])) ? ((i5 ? v2 : a1[1][14]) * (v2 >= i5)) : ((i4 > i5) == (i5 ? v1 : 12)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v2 = (((v3 < a1[3][12]) > (a0[11] % 6)) >= ((50 && i6) >= (v2 < i6)));
+        v1 = (((a1[1][10] < v2) ? (i6 ? a1[3][6] : v2) : (v3 / 8)) > ((22 != 33) ? (a0[7] % 9) : (v2 > a0[8])));
+        {
+            int i7 = 0;
+            do {
+                if ((a1[1][8] / 1) > 63) break;
+                v1 = (((i6 && v2) * (a1[1][6] / 2)) || ((a1[1][7] > v1) * (i7 < a0[12])));
+                a0[7] = (((i7 || 83) / 3) / 2);
+                v1 = (((a0[9] ? v0 : a1[1][14]) < (v3 * 42)) == ((v2 ? 91 : 59) ? (i6 + a0[15]) : (i6 % 8)));
+                i7 = i7 + 1;
+            } while (i7 < 2);
+        }
+    }
+    return (((54 == v3) > (a0[9] <= v0)) * ((v2 ? v1 : v1) ? (v0 || a0[0]) : (v1 >= 56)));
+}
+int f1() {
+    int v0 = 98;
+    int v1 = 84;
+    int v2 = 88;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((2 >= v2) > 86) break;
+        v1 = (((v2 == a0[6]) != (a1[1][8] > i0)) / 6);
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a1[0][14] = (((15 - 99) - (v1 >= v0)) || ((0 / 1) * (v0 + 8)));
+                a1[2][1] = (((i1 && a0[14]) / 4) ? ((v2 * v0) - (50 + v2)) : ((56 ? a0[4] : i1) % 1));
+                v0 = (((v2 % 7) / 7) != ((5 < a0[12]) * (v0 < 51)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[7] = (((78 >= 25) < (v0 == v0)) + ((a0[10] ? i0 : v1) >= (29 ? 11 : a0[5])));
+    }
+    a0[2] = (((v0 % 8) + (84 != v1)) / 4);
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v3 = (((a1[1][13] + 27) != (v0 < 48)) <= ((a0[2] >= v2) ? (i2 <= v3) : (a0[7] % 1)));
+            v2 = (((v3 % 5) <= (a0[2] ? i2 : v2)) ? ((21 >= i2) <= (v0 ? v3 : a0[14])) : ((91 - v1) / 3));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    a1[3][12] = (((v3 * 49) || (a0[8] ? v1 : i2)) <= ((i2 <= i3) + (i3 || a1[1][12])));
+                    v3 = (((a0[9] || 65) > (v2 < v2)) / 1);
+                    v0 = (((97 != i3) >= (i3 && a0[11])) > ((v2 % 7) >= (46 % 5)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((87 * v3) + (v0 != v2)) <= ((a0[3] + a1[3][11]) + (54 ? v2 : a0[6])));
+    v2 = (((a1[0][3] || a0[4]) == (a0[11] < v0)) == ((78 * v2) == (v1 % 9)));
+    return (((a1[3][1] == v0) != (v1 || 61)) <= ((a1[1][6] % 2) == (75 % 3)));
+}
+int f2() {
+    int v0 = 36;
+    int v1 = 69;
+    int v2 = 77;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v2 = (((83 < a1[1][0]) < (i0 + 53)) && ((84 * 64) / 1));
+                    v3 = (((9 < 42) && (a1[2][8] / 9)) * ((v1 > v1) || (51 && a0[13])));
+                    a1[2][0] = (((32 % 1) || (i0 * a1[1][6])) > ((v0 - 63) - (66 > v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[7] = (((61 != v1) > (13 <= 32)) != ((42 - 29) + (v3 % 8)));
+            v2 = (((21 % 4) < (a0[11] || v3)) > ((86 / 8) && (a1[0][4] != 3)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        a0[10] = (((a0[6] / 3) >= (v3 * v2)) <= ((v1 == a1[0][10]) < (75 * 1)));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((a0[6] <= i3) + (a0[8] + a0[4])) > ((v3 > a0[7]) ? (v1 - a1[2][0]) : (34 == i3)));
+                a0[13] = (((a1[3][10] || i3) - (i2 * v2)) <= ((a0[7] == 75) < (43 != i2)));
+                a1[0][13] = (((i3 * 34) / 5) && ((91 - i2) < (v0 + a1[0][6])));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        a1[1][0] = (((i2 + 55) - (v3 ? v2 : v3)) - ((v3 && i2) ? (a1[1][11] - a0[14]) : (25 < 61)));
+    }
+    if ((((10 + v3) <= (11 != a0[5])) < ((a0[2] % 9) + (v0 ? 75 : a1[3][2])))) {
+        a0[8] = (((v0 - v2) * (v0 != v3)) == ((v2 * 91) == (a0[8] && v0)));
+        v1 = (((v2 >= v0) ? (v1 > v1) : (a0[1] || v0)) >= ((7 != v0) || (a0[3] && v3)));
+        v0 = (((v2 * v3) - (a0[8] > 29)) * ((v2 == 56) * (a1[3][7] < a1[3][15])));
+    } else {
+        v1 = (((v3 <= v3) > (v2 - a1[2][15])) <= ((6 ? v2 : 12) == (v2 && v0)));
+        v1 = (((a0[9] ? 99 : a0[13]) * (v3 / 8)) - ((a1[2][15] || 48) >= (v1 ? a1[1][2] : v0)));
+        v3 = (((v2 / 6) ? (v3 > 71) : (a1[2][4] || 39)) % 9);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v3 = (((i4 < 43) < (68 == 80)) != ((i4 != v2) ? (v2 + a0[7]) : (v1 != v1)));
+        {
+            int i5 = 0;
+            while (i5 < 2) {
+                if ((i4 < v2) > 52) break;
+                v0 = (((i4 + a1[1][5]) % 9) ? ((53 == a1[0][5]) && (v1 ? a1[1][8] : v2)) : ((i4 == v1) % 2));
+                v0 = (((a0[5] != a0[11]) - (i5 < a1[3][4])) > ((v3 ? 60 : i4) ? (v0 / 7) : (28 - a1[1][11])));
+                a0[10] = (((21 * i5) && (v3 <= i5)) || ((v1 * 40) == (a0[10] != a1[2][11])));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((v0 || i4) < (a0[15] == v3)) <= ((v2 > a0[10]) <= (20 * a0[2])));
+    }
+    v3 = (((v0 - a1[2][2]) != (53 < a0[2])) < ((v0 * v1) <= (a1[2][2] != a0[12])));
+    return (((a0[2] ? a1[3][15] : v2) >= (99 != v2)) != ((a1[3][4] >= v0) ? (v2 % 2) : (a1[0][0] ? a0[8] : v0)));
+}
+int main() {
+    return 0;
+}
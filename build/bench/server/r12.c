@@ -0,0 +1,55 @@
+int f0() {
+    int v0 = 18;
+    int v1 = 52;
+    int v2 = 54;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    if ((((98 && v0) == (v2 > a0[9])) <= ((39 / 1) / 8))) {
+        v3 = (((84 - 84) < (v0 / 9)) >= ((a0[15] ? 49 : v2) && (v3 % 5)));
+        v0 = (((v3 || v3) <= (v0 && a0[13])) <= ((v1 > a1[1][13]) < (v2 * 31)));
+        a0[13] = (((v1 != a0[10]) >= (46 == a1[0][3])) + ((a0[1] != v0) > (71 < 87)));
+    } else {
+        v0 = (((59 ? v3 : 97) / 2) ? ((v0 ? v1 : v2) != (35 ? v1 : v3)) : ((v1 * 5) / 3));
+        a0[11] = (((a0[15] % 1) < (29 - v0)) ? ((v1 > a0[15]) < (26 >= a0[1])) : ((a1[2][6] || v0) * (a0[0] - v3)));
+        v1 = (((40 || v2) && (a0[1] >= v0)) <= ((a0[9] <= v2) ? (67 && 29) : (25 + 4)));
+    }
+    v2 = (((v3 >= v1) >= (a0[12] > a0[10])) < ((79 == v1) % 5));
+    if ((((v3 > a1[0][10]) >= (a0[1] == v0)) ? ((26 < 59) > (84 != v1)) : ((80 || v3) >= (a0[1] == a0[10])))) {
+        v0 = (((v2 + v3) - (v2 % 5)) || ((57 ? v1 : v2) || (70 <= 24)));
+        v2 = (((33 >= v0) < (v3 ? v3 : 4)) == ((a1[0][4] != a0[9]) != (a0[0] || v2)));
+        a0[8] = (((v3 ? v2 : v2) < (a1[3][2] - 37)) <= ((a0[4] && v3) <= (69 > v3)));
+    } else {
+        v2 = (((v3 > a0[13]) / 2) < ((a1[3][4] != 8) > (81 > v2)));
+        a1[0][10] = (((v1 ? v1 : a0[8]) + (a1[3][4] ? 27 : v0)) - ((v1 < v1) / 6));
+        a1[1][13] = (((v1 >= v0) / 1) && ((a0[1] < a0[10]) * (a1[0][14] >= v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((a1[2][10] == 29) + (10 != a0[12])) % 7);
+            v1 = (((v2 + v0) >= (61 > v2)) * ((a1[1][14] ? 62 : a0[10]) <= (v0 - v3)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v3 = (((54 % 6) / 8) + ((i1 == i0) ? (99 >= 22) : (v1 * v0)));
+                v3 = (((a1[3][0] ? v0 : v3) == (a0[12] % 6)) <= ((a0[12] == v1) - (v1 + v2)));
+                v3 = (((v1 / 6) > (98 - 10)) % 3);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 && v1) ? (62 <= v1) : (v2 + v1)) && ((v2 ? 45 : 61) % 5))) {
+        a1[1][2] = (((v1 / 9) != (v0 * v3)) ? ((v1 != 30) - (a1[2][11] <= 24)) : ((v1 <= v0) != (v0 <= 87)));
+        v3 = (((v1 == v1) % 9) + ((a1[1][15] && v3) != (v1 % 8)));
+        a1[0][11] = (((v3 / 1) == (77 && v0)) ? ((v1 <= a0[3]) == (63 % 2)) : ((a1[0][2] ? v2 : a1[1][15]) != (99 != v2)));
+    } else {
+        v0 = (((a1[2][2] - a1[1][9]) - (29 == v1)) || ((a0[5] <= v2) ? (v1 == a1[3][8]) : (a1[0][3] == 22)));
+        v0 = (((87 - a0[7]) ? (v2 != a1[0][1]) : (a1[1][10] || v1)) < ((v3 >= a0[13]) ? (v0 - v1) : (3 - v0)));
+        v3 = (((a1[1][10] <= v0) / 9) + ((v2 >= 13) % 5));
+    }
+    return (((a0[14] > v0) % 9) ? ((v0 % 9) * (49 != a1[0][0])) : ((87 + a1[2][15]) >= (v3 - v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,66 @@
+int f0() {
+    int v0 = 42;
+    int v1 = 41;
+    int v2 = 16;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v0 = (((56 % 8) % 5) && ((v3 / 1) || (a1[3][4] >= a0[3])));
+            {
+                int i1 = 0;
+                do {
+                    if ((i1 >= 98) > 94) break;
+                    a1[1][12] = (((a1[0][8] > 43) != (a1[0][2] / 8)) + ((v0 == v2) < (a0[13] * a0[7])));
+                    v3 = (((i0 ? i0 : 42) - (v1 + v2)) != ((3 >= v2) != (a1[2][9] == a0[10])));
+                    v2 = (((v1 - a1[0][10]) < (i0 * a1[2][7])) ? ((v2 == v3) <= (87 < v3)) : ((v3 - v3) > (11 + v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((70 == a0[13]) ? (a0[13] / 7) : (v1 >= 4)) != ((v1 / 7) % 9));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            v0 = (((i2 / 2) >= (a0[12] < a0[10])) ? ((42 + 93) ? (v0 <= v2) : (5 % 3)) : ((v1 == v0) == (v2 && i3)));
+            v3 = (((a1[2][6] < i2) - (a1[3][8] + v2)) != ((i3 ? i3 : i2) != (a1[2][6] / 7)));
+            a1[0][15] = (((v0 <= 89) >= (v1 != v1)) * ((a1[0][7] < a1[1][11]) % 6));
+        }
+        v3 = (((97 * i2) || (a0[7] ? a1[1][5] : a0[10])) > ((19 < a1[0][7]) != (a1[0][6] ? v3 : a0[4])));
+        a0[7] = (((v2 <= v2) || (i2 > 30)) ? ((44 != v0) ? (v2 > 13) : (v3 / 3)) : ((95 != a0[9]) * (v0 < a0[6])));
+    }
+    a1[0][0] = (((v0 ? v1 : 82) || (v3 / 5)) != ((a1[0][10] < v2) < (22 > v1)));
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            {
+                int i5 = 0;
+                do {
+                    a0[12] = (((a1[3][1] != a0[2]) ? (59 / 7) : (a0[6] ? v0 : v0)) <= ((55 != i5) / 6));
+                    v1 = (((a0[7] >= v2) / 4) % 9);
+                    v0 = (((v1 < i5) % 4) / 9);
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            a0[0] = (((91 != v3) - (v3 ? 43 : v0)) - ((a1[2][12] >= 84) < (87 < v2)));
+            v0 = (((25 ? v0 : v1) >= (a1[2][9] == a0[8])) / 4);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v1 == 20) - (72 == 17)) <= ((v0 || v2) ? (v3 ? v1 : 93) : (v3 / 9)))) {
+        a1[0][2] = (((v0 && v0) - (a0[4] * v3)) >= ((37 != 68) * (v3 >= v2)));
+        v0 = (((v0 + v0) < (a1[0][6] - v2)) && ((v2 || a0[0]) != (a0[9] <= v3)));
+        a1[1][2] = (((69 > v3) - (v0 || v2)) < ((50 ? v3 : v2) != (v3 - 5)));
+    } else {
+        a1[2][14] = (((a1[3][11] > a1[2][2]) && (a0[7] - 51)) / 4);
+        v1 = (((19 ? a0[4] : a0[5]) ? (v1 && a0[9]) : (v2 && a1[1][13])) % 6);
+        v2 = (((v0 > v2) == (v0 < v0)) && ((v3 && a0[2]) ? (v0 ? 14 : v1) : (v3 == v1)));
+    }
+    return (((a1[1][8] <= v0) ? (v3 - v3) : (92 || 45)) - ((v3 + a0[8]) * (22 % 1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,131 @@
+int f0() {
+    int v0 = 99;
+    int v1 = 6;
+    int v2 = 62;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((i0 % 1) > 59) break;
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            v3 = (((i1 / 1) <= (99 / 6)) >= ((v0 - a1[0][7]) != (97 ? v1 : a0[2])));
+            a0[7] = (((a1[1][9] <= 85) - (v0 ? 4 : v0)) && ((v3 ? v2 : v2) % 3));
+            a0[4] = (((v3 || i0) < (a0[10] ? v1 : i1)) != ((i0 - v2) - (a0[15] - 37)));
+        }
+        a0[7] = (((17 > 18) || (a0[12] <= v2)) ? ((i0 * a1[1][10]) != (v0 == v2)) : ((61 >= a0[15]) ? (v1 > v1) : (v3 % 9)));
+        v2 = (((v3 != v0) - (69 && v2)) * ((i0 < v1) || (a1[1][7] % 3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[9] = (((a0[9] && v1) != (a0[11] / 8)) > ((a0[1] < a1[2][12]) <= (a1[1][1] < a0[15])));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][15] = (((v1 * v0) ? (a0[4] && v3) : (i3 <= 61)) || ((a1[2][5] / 3) ? (a0[1] / 2) : (a0[10] > 20)));
+                    v0 = (((41 * 46) ? (a1[1][1] != a1[0][5]) : (a0[11] < v3)) * ((32 <= a0[2]) ? (i2 && 73) : (36 && v3)));
+                    v0 = (((i2 && a1[2][13]) >= (v2 == a0[6])) <= ((a0[5] % 4) % 3));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v0 = (((a0[6] && 21) ? (a1[3][13] + v1) : (v3 || v2)) || ((v3 ? v1 : i2) && (i2 > i2)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((a1[0][5] && v2) > 87) break;
+        a1[0][0] = (((v1 && v1) > (v3 ? 57 : v0)) > ((a0[9] * v1) ? (v1 >= 39) : (65 != v3)));
+        v2 = (((0 >= a0[14]) - (44 - v1)) != ((v3 > 88) >= (v0 >= i4)));
+        {
+            int i5 = 0;
+            do {
+                v3 = (((a0[1] + 71) ? (69 || a0[2]) : (1 >= a1[1][5])) * ((a0[4] + a1[2][11]) != (a1[2][11] % 6)));
+                a0[14] = (((53 % 1) / 4) ? ((a0[15] - a0[0]) == (a0[10] || a1[1][14])) : ((50 || v2) + (v1 >= a1[1][12])));
+                v0 = (((a1[2][4] < v0) / 9) / 9);
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+    }
+    if ((((a1[1][3] % 6) != (a1[0][1] < a0[15])) < ((v1 - v3) != (v3 + v1)))) {
+        v3 = (((v1 - 77) < (v3 && 64)) >= ((v3 == v0) ? (a0[12] + v1) : (68 >= v1)));
+        v3 = (((a1[1][5] >= v0) != (34 && 40)) ? ((v0 - a0[7]) != (a1[0][5] % 4)) : ((a0[7] != v2) ? (a0[4] * v1) : (20 != v2)));
+        a1[3][3] = (((a1[0][11] || 94) / 9) ? ((5 == v3) ? (61 == a1[0][9]) : (a0[8] <= a0[3])) : ((v2 < 36) % 4));
+    } else {
+        v0 = (((v0 == v1) - (v2 - 20)) == ((v2 > 15) + (v0 || a0[5])));
+        v1 = (((27 + a1[3][5]) >= (v3 ? 25 : v1)) && ((v1 && v2) ? (60 * v0) : (45 > v2)));
+        v1 = (((v3 && a0[7]) * (v3 * v0)) > ((a1[2][6] * a1[0][6]) / 8));
+    }
+    v3 = (((a0[3] % 3) ? (78 <= v3) : (v2 <= 55)) <= ((a0[4] != v2) == (v2 ? a0[10] : v0)));
+    return (((a1[0][13] > a0[3]) % 4) <= ((v0 / 5) - (99 - v0)));
+}
+int f1() {
+    int v0 = 15;
+    int v1 = 19;
+    int v2 = 66;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((56 % 2) > 70) break;
+            v0 = (((a1[0][15] / 5) / 3) * ((v1 || v0) % 4));
+            v1 = (((v2 - v2) % 9) / 6);
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((13 % 3) > 71) break;
+                    v1 = (((v2 != 45) < (i1 && i0)) > ((i1 == i0) - (v3 >= 10)));
+                    v0 = (((v2 / 3) * (a0[8] ? v1 : a1[3][8])) ? ((v2 % 1) == (i0 / 4)) : ((a1[0][14] ? v1 : v1) <= (a0[11] ? a0[8] : a1[1][11])));
+                    v0 = (((v0 * a0[13]) % 9) / 8);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v0 = (((a0[12] + a0[8]) + (i2 > a0[1])) ? ((26 != i2) ? (a0[1] < 79) : (v2 <= v1)) : ((i2 * v0) == (a0[12] <= v0)));
+                    v2 = (((a0[7] == a1[1][8]) / 9) <= ((v0 ? i3 : a1[3][9]) % 7));
+                    v3 = (((a0[12] / 6) % 2) == ((i2 ? v2 : v3) > (67 > a0[0])));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((i2 || 58) ? (v2 - a0[11]) : (v1 >= 11)) < ((i2 * i2) ? (a1[1][7] ? 30 : v0) : (v3 != a0[1])));
+            v3 = (((a1[1][12] ? a0[9] : 95) <= (v1 == a1[3][6])) != ((a0[6] || a1[2][2]) && (i2 % 9)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a0[2] = (((v1 ? a1[0][8] : i4) % 1) ? ((a0[9] != v3) > (a0[11] / 3)) : ((27 < v1) >= (11 + v3)));
+        {
+            int i5 = 0;
+            while (i5 < 8) {
+                v3 = (((10 + a0[1]) ? (i5 ? v0 : i5) : (39 <= a1[1][5])) * ((v0 < 58) ? (i5 > 67) : (a0[8] < v1)));
+                a1[1][6] = (((v1 > a0[4]) - (v2 <= 30)) ? ((a1[3][10] * v0) >= (v0 % 2)) : ((35 ? a1[0][0] : v2) > (a0[2] ? 43 : 54)));
+                a0[8] = (((9 >= 39) != (i5 / 6)) && ((a0[3] + v0) / 7));
+                i5 = i5 + 1;
+            }
+        }
+        a0[3] = (((v0 - a0[3]) < (a1[1][9] ? i4 : a0[6])) >= ((v0 / 4) <= (a0[3] % 2)));
+    }
+    if ((((v1 % 6) != (v1 != v1)) || ((76 / 7) % 3))) {
+        v3 = (((v1 ? a0[12] : v0) ? (v3 != 77) : (45 % 3)) || ((40 % 3) > (v3 <= v0)));
+        v2 = (((v1 >= v0) % 7) && ((v3 * v2) ? (v0 || v1) : (v3 > a0[8])));
+        v2 = (((v2 * v3) > (v2 * v2)) <= ((v3 + v2) % 6));
+    } else {
+        v1 = (((v0 + 91) >= (a0[10] != v0)) ? ((a0[7] * 18) > (v2 && a0[5])) : ((a0[4] != v3) / 8));
+        v1 = (((58 ? a1[2][7] : v2) % 5) + ((v0 || a0[5]) >= (a0[2] * v2)));
+        v1 = (((35 + v0) - (a0[12] || 71)) > ((a0[7] || 21) == (v1 * v1)));
+    }
+    v2 = (((a0[6] <= v0) && (v1 > v1)) > ((a0[5] || v0) / 8));
+    return (((v2 >= v1) ? (a1[1][2] == v2) : (a1[1][11] || v0)) || ((v0 == 42) == (v3 ? v0 : v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,180 @@
+int f0() {
+    int v0 = 82;
+    int v1 = 89;
+    int v2 = 2;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v0 = (((a0[1] < v3) > (55 >= v2)) % 1);
+        a0[11] = (((i0 + v3) < (1 == v3)) == ((78 > a0[14]) + (a0[8] < v0)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v1 = (((v1 || a0[14]) != (a1[2][0] > v3)) != ((v3 && v2) * (a0[4] && a0[2])));
+            a1[0][3] = (((a0[8] * a0[3]) <= (a1[3][9] <= i1)) == ((v1 ? a1[2][6] : i0) && (v1 < a1[2][10])));
+            v2 = (((v3 ? v2 : a0[13]) <= (a1[0][3] != a1[0][14])) > ((93 % 7) + (67 != i0)));
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v1 = (((a0[11] ? 56 : i2) ? (a0[14] > a0[6]) : (i2 ? 74 : a0[8])) && ((59 || v1) + (v3 ? a1[1][8] : v1)));
+            v1 = (((v2 > a1[2][11]) >= (v2 + v3)) || ((39 == v0) != (v0 % 4)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((i2 < v3) != (a0[8] / 4)) % 2);
+                    v2 = (((v2 - v2) == (v1 ? i3 : i3)) >= ((a1[2][2] * v0) == (a1[2][12] ? a1[2][3] : a1[3][3])));
+                    a0[14] = (((a1[3][12] || 57) ? (i2 == 83) : (78 && 57)) || ((v1 == 53) > (a0[15] ? i3 : v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    if ((i4 / 6) > 55) break;
+                    v1 = (((v3 % 4) / 6) || ((a0[15] >= v3) - (v1 && a1[2][14])));
+                    v2 = (((a1[3][13] < a1[1][6]) || (a1[0][14] == 2)) >= ((44 >= v1) < (i5 >= 62)));
+                    a0[2] = (((v1 < a1[1][14]) || (i4 || i5)) || ((59 == v2) >= (v1 == a1[0][3])));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][14] = (((a0[3] ? 44 : v0) ? (i4 ? v3 : v2) : (a1[0][8] >= v0)) ? ((v1 >= v1) - (v1 || v0)) : ((i4 && v1) != (a0[14] == v2)));
+            v2 = (((v0 + a1[3][6]) <= (i4 == a0[0])) ? ((v0 && v0) + (a0[2] ? a1[1][15] : a1[0][10])) : ((a1[0][11] > 72) - (7 * v1)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    a1[0][13] = (((v2 - a1[3][1]) + (a0[10] - v1)) + ((v2 > v2) >= (v0 || v3)));
+    v0 = (((v1 / 7) ? (a1[2][15] != v3) : (v2 - 54)) == ((v2 + v3) % 8));
+    return (((v2 - v3) * (21 - v0)) != ((v0 >= v3) ? (v3 * a1[1][7]) : (v3 <= a0[10])));
+}
+int f1() {
+    int v0 = 56;
+    int v1 = 69;
+    int v2 = 12;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((39 > a1[1][14]) / 9) % 2);
+    {
+        int i0 = 0;
+        do {
+            a1[0][11] = (((v1 == 91) * (a0[0] > v0)) ? ((i0 && 94) * (v3 > 76)) : ((a0[6] != 10) || (a1[3][13] || v2)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a1[1][4] = (((92 * 4) % 6) || ((i1 || 13) < (i1 + v0)));
+                v2 = (((a1[3][13] * 10) / 7) + ((a1[3][9] != a1[1][3]) && (a1[0][6] / 3)));
+                v2 = (((v1 || v0) - (v0 != a1[2][8])) > ((v0 != v0) % 3));
+            }
+            v2 = (((90 && v2) && (v0 >= a1[0][12])) - ((v0 ? i0 : v0) + (a0[2] * a0[10])));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a1[1][11] = (((v2 && a0[13]) >= (v1 ? i2 : a1[1][13])) * ((64 == v1) <= (a0[1] == v1)));
+            {
+                int i3 = 0;
+                do {
+                    a1[2][9] = (((i2 ? a0[2] : v0) % 5) <= ((i3 - a1[2][15]) / 2));
+                    v1 = (((a1[2][13] - a1[3][7]) <= (35 * v2)) && ((v2 != i3) ? (i3 - a1[0][11]) : (i3 && v3)));
+                    v3 = (((a1[2][7] || 77) * (v1 >= 29)) % 3);
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            a0[0] = (((v1 / 5) >= (i2 / 2)) && ((a0[5] == i2) / 9));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 * v0) ? (v3 ? v3 : v3) : (a0[5] == v3)) + ((67 >= v0) <= (v0 + a1[2][11])))) {
+        v1 = (((a1[0][5] - 18) != (20 < v2)) <= ((v1 ? 49 : v2) >= (11 != v3)));
+        v1 = (((v0 >= 39) || (v1 >= a1[2][0])) <= ((v0 > v0) / 2));
+        a1[1][6] = (((15 * a1[3][13]) && (v0 % 3)) >= ((a1[3][0] * v2) && (98 ? v2 : 35)));
+    } else {
+        a1[1][3] = (((v2 > v3) <= (a1[3][5] + 33)) && ((v2 / 8) ? (v1 / 5) : (v0 ? v1 : v2)));
+        a1[0][8] = (((v0 && 41) || (v0 - 36)) == ((37 / 2) * (4 + v0)));
+        v2 = (((v2 <= v2) <= (a0[3] >= 93)) < ((a1[0][9] <= 0) ? (v1 / 6) : (v2 != v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    if ((a0[12] <= i4) > 72) break;
+                    v0 = (((i4 || 44) / 9) > ((43 == i4) == (i4 < v1)));
+                    v3 = (((v3 && v2) % 2) / 9);
+                    v0 = (((v0 ? v0 : i5) != (v1 || i5)) > ((15 < i5) + (1 && 3)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v0 = (((78 % 1) ? (88 || 50) : (v1 && a1[2][6])) > ((4 > i4) ? (i4 && v3) : (v0 >= a0[15])));
+            v2 = (((58 - v1) != (a0[9] < v3)) < ((v0 % 6) || (v1 && 80)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v3 + v3) < (a1[2][11] / 2)) ? ((a1[1][5] ? v3 : a1[3][12]) - (v1 * a1[3][12])) : ((v3 != v2) ? (v0 + 0) : (a1[3][15] / 5)));
+}
+int f2() {
+    int v0 = 10;
+    int v1 = 79;
+    int v2 = 90;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[1] - a1[3][1]) != (89 ? a1[1][14] : 37)) >= ((v2 * a0[9]) <= (v0 / 9)));
+            a0[2] = (((i0 ? 23 : a0[10]) * (88 - 89)) < ((v2 || v1) % 1));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a0[9] = (((i0 >= v2) ? (a0[13] != a1[0][14]) : (a1[1][11] && 34)) / 7);
+                v3 = (((a0[0] || 51) && (a1[2][6] + 8)) > ((v0 / 4) != (a0[9] <= 42)));
+                a1[1][1] = (((a0[8] < v1) > (i0 - v3)) <= ((50 != a0[0]) == (v0 && 85)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((a0[6] && v2) % 3) > ((v1 > a1[1][12]) - (80 >= v3)))) {
+        v0 = (((v1 ? 65 : a0[7]) + (89 - v0)) == ((v2 - a1[1][13]) >= (v2 + v2)));
+        v2 = (((v2 <= v2) + (v2 == a1[0][2])) > ((v1 / 8) * (a1[0][8] || v2)));
+        v3 = (((61 % 3) < (v3 > 72)) ? ((v3 && 26) ? (24 == a0[14]) : (80 >= 46)) : ((v1 + v3) * (a0[6] % 5)));
+    } else {
+        a0[13] = (((v0 <= 47) && (32 || 19)) % 5);
+        v3 = (((79 + 55) >= (79 - v3)) + ((a0[4] || v0) > (v0 > v0)));
+        v3 = (((a1[1][10] * v2) >= (a1[0][0] * v1)) % 3);
+    }
+    v3 = (((a1[2][0] / 9) ? (a1[1][11] == v3) : (47 ? 61 : v0)) < ((v2 || a1[0][5]) && (v1 ? 87 : v1)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((i2 >= a0[15]) > 66) break;
+        v3 = (((v1 * v1) < (i2 * 27)) || ((v1 || 47) != (a1[1][1] <= 35)));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((i2 - v2) / 5) - ((a1[1][10] && 75) % 8));
+                v1 = (((i3 != i2) % 2) == ((18 <= 83) - (56 ? v3 : v0)));
+                v2 = (((v1 % 2) - (84 && a0[12])) * ((a1[1][4] * v3) != (a0[7] < 57)));
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+        v3 = (((40 % 1) - (36 < v1)) % 4);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((v3 || a1[1][12]) ? (v0 <= i4) : (a1[2][4] * a1[0][2])) ? ((i4 / 2) && (i4 - 42)) : ((a0[3] || a1[2][6]) <= (i4 ? a1[3][13] : 57)));
+        v2 = (((i4 ? v2 : v1) && (79 < i4)) > ((v3 % 2) || (v1 < v2)));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            a0[11] = (((24 ? v1 : 13) == (70 == 11)) - ((a0[1] / 9) ? (a0[1] ? 99 : v1) : (a0[0] == i4)));
+            v3 = (((a0[3] - i4) == (87 * v2)) % 2);
+            a0[10] = (((i4 - v3) <= (v3 ? v0 : i4)) != ((v0 * a1[0][3]) != (95 > v2)));
+        }
+    }
+    return (((a0[0] && 63) == (69 >= v1)) - ((42 >= v1) < (v0 % 6)));
+}
+int main() {
+    return 0;
+}
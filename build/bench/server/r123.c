@@ -0,0 +1,83 @@
+int f0() {
+    int v0 = 94;
+    int v1 = 76;
+    int v2 = 33;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][2] * a1[1][13]) ? (a0[14] <= 64) : (92 || a1[2][12])) - ((v0 * a1[1][6]) >= (v3 >= a0[5])))) {
+        a0[15] = (((95 > v1) ? (v1 < 79) : (v0 != v0)) ? ((v2 && v0) ? (v2 == v1) : (69 != a0[14])) : ((19 < v2) - (v3 / 8)));
+        a0[9] = (((v3 != 58) ? (v3 && a0[14]) : (v1 && 87)) || ((v2 ? 26 : a1[2][3]) || (v3 && a0[12])));
+        a1[1][9] = (((49 * v3) != (v1 ? v0 : v0)) && ((v1 || a0[11]) ? (a1[3][5] + a1[2][15]) : (v1 <= 23)));
+    } else {
+        a1[3][7] = (((v2 ? v1 : v2) / 3) < ((v1 != a1[1][6]) == (v1 || a1[3][12])));
+        v2 = (((v1 && v3) < (v1 ? v1 : 11)) ? ((88 / 6) * (26 < v0)) : ((v3 / 8) <= (53 ? 27 : a1[0][3])));
+        v2 = (((v3 == v2) * (88 % 6)) - ((a0[5] * a1[0][15]) || (v2 - a1[2][4])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v2 = (((i0 + 24) % 2) / 3);
+            v3 = (((v1 > a1[0][3]) - (a1[2][5] && a0[1])) >= ((a1[0][4] || 65) + (a0[8] + 33)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                a0[11] = (((i1 % 7) <= (v2 - i1)) + ((i0 == i1) + (v3 + a0[13])));
+                v0 = (((a1[3][15] >= a0[15]) && (v3 ? a1[3][2] : 55)) ? ((78 % 1) % 8) : ((v3 <= a1[1][6]) % 7));
+                v3 = (((a1[2][0] == 3) ? (i0 % 8) : (v0 - a0[9])) * ((a0[8] ? a1[2][14] : v2) ? (i0 == 82) : (v3 - v0)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v2 % 3) > 73) break;
+            v3 = (((39 / 6) >= (v2 / 3)) / 6);
+            v3 = (((20 ? v1 : v0) ? (v1 + v3) : (v3 ? a1[3][4] : v0)) ? ((v1 != i2) ? (v2 % 9) : (i2 && v3)) : ((54 && a0[6]) / 8));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((96 || 96) > (i3 % 7)) >= ((v3 > v0) + (a1[2][0] + i3)));
+                    a0[10] = (((i2 == a1[0][8]) < (a1[3][9] - 79)) % 4);
+                    v0 = (((i2 * i2) == (v2 == 53)) && ((i2 != v1) && (i2 * v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v2 && 50) - (a1[2][13] != 87)) >= ((21 < 33) ? (v3 + v2) : (49 == a1[3][3])));
+            v1 = (((i4 >= a1[1][2]) ? (a0[10] || 66) : (a1[2][2] >= 8)) || ((i4 || 30) <= (v0 == 0)));
+            {
+                int i5 = 0;
+                do {
+                    a0[1] = (((v1 ? a1[1][6] : a0[4]) == (a1[2][14] > i5)) / 8);
+                    v3 = (((v2 * 1) < (75 != i4)) / 1);
+                    v0 = (((84 + a0[1]) - (a0[13] % 2)) || ((33 <= 84) < (v3 <= v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        a0[6] = (((51 - 39) && (i6 ? 34 : v3)) == ((v2 % 3) <= (33 ? i6 : a1[1][0])));
+        {
+            int i7 = 0;
+            while (i7 < 8) {
+                if ((69 / 5) > 89) break;
+                v3 = (((v0 || a1[1][15]) ? (i7 % 1) : (a1[1][1] - a1[1][1])) == ((a1[1][7] || a0[4]) || (37 + v3)));
+                v0 = (((i6 ? v0 : a1[1][3]) > (i7 / 3)) * ((i7 ? v0 : v2) || (v3 + i6)));
+                v0 = (((a0[6] / 7) > (a1[1][12] >= 98)) >= ((a1[3][13] ? v1 : i7) <= (v1 != v0)));
+                i7 = i7 + 1;
+            }
+        }
+        a1[0][2] = (((51 > 62) % 8) - ((i6 != a0[2]) == (97 >= i6)));
+    }
+    return (((v3 * v3) >= (v3 == a1[1][12])) != ((a0[9] ? v2 : v3) <= (v3 >= v0)));
+}
+int main() {
+    return 0;
+}
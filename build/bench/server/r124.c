@@ -0,0 +1,125 @@
+int f0() {
+    int v0 = 45;
+    int v1 = 9;
+    int v2 = 50;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((31 < 45) > (v3 <= a0[13])) < ((v0 > 11) && (v0 >= v1)));
+    {
+        int i0 = 0;
+        do {
+            if ((a1[1][4] || v2) > 51) break;
+            v3 = (((v1 + a1[2][14]) > (v3 == v1)) / 4);
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((97 ? i1 : 49) ? (v1 < 16) : (v2 / 4)) < ((48 > 83) && (a0[15] < v0)));
+                    v0 = (((a1[3][0] ? v0 : v0) < (v3 < 12)) <= ((84 != 46) == (i1 ? 74 : i0)));
+                    a0[2] = (((v0 + a0[6]) != (v2 + a0[8])) - ((55 <= 82) <= (v2 / 3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a1[2][13] || v2) != (v0 % 2)) + ((30 || i0) == (84 * v3)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v1 = (((i2 <= 16) == (i2 * v0)) / 5);
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((i2 ? a1[2][7] : v3) ? (v0 ? v2 : v0) : (a1[3][3] && v1)) && ((i3 > v0) ? (66 + 57) : (v1 - i3)));
+                    a1[0][1] = (((v0 != a0[12]) > (45 >= v0)) > ((v0 >= v2) >= (a1[0][2] >= a1[0][12])));
+                    v0 = (((a1[2][13] * 33) || (v0 >= v3)) == ((a1[2][5] > a1[0][1]) > (92 && v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v0 = (((v0 % 8) ? (v0 > a1[0][12]) : (v1 ? v3 : a0[14])) >= ((v3 != 37) <= (a1[3][5] <= a1[0][11])));
+            i2 = i2 + 1;
+        }
+    }
+    a0[0] = (((v1 <= 36) - (a1[2][10] >= a0[9])) || ((74 && 36) == (a1[1][12] <= 8)));
+    a1[3][3] = (((a1[1][0] % 1) < (v3 < a1[3][12])) != ((a1[3][15] % 4) && (v1 && v2)));
+    return (((a0[10] * 70) % 7) ? ((20 - v0) <= (60 + a0[9])) : ((64 && a0[12]) % 4));
+}
+int f1() {
+    int v0 = 85;
+    int v1 = 59;
+    int v2 = 7;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((v2 / 9) > (v2 != v1)) == ((v3 < a0[13]) <= (a0[0] || v2)));
+                    a1[1][8] = (((a0[14] || v1) - (v1 >= v0)) && ((20 / 8) || (a1[2][4] / 8)));
+                    a1[2][13] = (((a0[11] >= v1) ? (v1 && v0) : (27 >= a1[1][8])) > ((a1[3][12] < a0[5]) - (i1 != a1[2][7])));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((i0 + v3) ? (i0 / 3) : (98 <= i0)) == ((a0[13] >= i0) && (a0[3] > v1)));
+            v3 = (((v3 >= v0) == (v3 && 4)) - ((a0[11] / 4) >= (a1[1][10] > 4)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v3 - v1) > 94) break;
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a1[0][10] >= i3) * (i2 ? v1 : a1[1][0])) ? ((v0 % 9) - (a1[0][3] - v2)) : ((v1 || i2) ? (v3 % 8) : (i3 - v3)));
+                    v0 = (((a0[5] > i2) > (a0[6] < a1[1][10])) / 1);
+                    a0[3] = (((68 * v1) >= (a1[1][4] - a0[1])) != ((a1[0][15] < v2) - (v2 >= 78)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a0[11] = (((i2 / 1) < (v3 ? v3 : v2)) ? ((a1[3][7] * 50) >= (a1[1][5] >= v0)) : ((a1[0][12] + 38) * (57 / 2)));
+            v3 = (((80 == 78) > (i2 != a0[3])) > ((v1 - v0) <= (v0 >= 71)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[3] = (((v3 - v0) ? (i4 / 2) : (37 && v2)) < ((v1 ? a0[14] : 7) > (v0 ? v3 : a1[3][7])));
+            v3 = (((66 * 11) / 5) && ((v2 && 14) && (v3 / 4)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v2 = (((v0 ? v1 : a1[3][7]) && (a0[12] || v3)) < ((i5 > i5) % 6));
+                v3 = (((30 - i4) / 2) - ((v2 / 1) - (80 ? a0[9] : 57)));
+                v2 = (((v1 >= 56) || (v3 - 43)) % 3);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[6] > v3) - (v2 * v2)) == ((v2 != v0) % 1))) {
+        v0 = (((v0 || v2) * (v1 % 4)) + ((v1 > a1[2][10]) <= (a1[2][11] > v2)));
+        v2 = (((v2 + v1) ? (a0[7] < v0) : (a0[2] * v2)) >= ((v3 < a0[3]) * (a1[2][3] == a1[1][3])));
+        v0 = (((v2 ? v2 : 95) ? (a0[13] || 26) : (v0 && v1)) == ((v2 - v3) && (a1[1][5] / 8)));
+    } else {
+        a1[2][0] = (((9 == v1) - (v2 && a1[3][1])) * ((v0 ? v3 : 61) == (v1 < a1[3][13])));
+        v2 = (((a1[2][8] + v0) / 3) - ((v3 >= 65) - (v3 >= a0[6])));
+        a1[3][6] = (((a1[2][4] && 60) && (v2 == v2)) ? ((1 < a0[12]) ? (v1 + 51) : (v0 || v1)) : ((v3 / 8) % 1));
+    }
+    if ((((61 - a0[15]) && (v0 ? v0 : v0)) > ((4 && a1[1][2]) % 2))) {
+        v2 = (((v2 && 18) / 1) * ((v3 < a1[0][8]) < (0 > v2)));
+        v1 = (((a0[9] > v1) < (v3 * a1[3][9])) / 1);
+        a1[2][1] = (((v0 % 9) / 8) || ((a0[14] >= 53) > (a0[9] ? v2 : v2)));
+    } else {
+        a1[1][4] = (((v2 ? v3 : v0) > (v1 || 0)) % 1);
+        v0 = (((12 ? v3 : a0[13]) % 7) ? ((v0 * a1[1][1]) + (71 - v1)) : ((a1[0][11] > 14) <= (v1 >= v2)));
+        a1[2][4] = (((v1 < v2) + (v1 / 8)) && ((a1[0][11] ? v2 : v3) && (v2 * v0)));
+    }
+    return (((v0 == v2) % 2) % 2);
+}
+int main() {
+    return 0;
+}
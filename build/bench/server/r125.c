@@ -0,0 +1,182 @@
+int f0() {
+    int v0 = 22;
+    int v1 = 15;
+    int v2 = 2;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 > v2) % 6) / 5);
+    if ((((18 ? v3 : v3) * (a0[5] < v1)) != ((v0 == v3) / 9))) {
+        v0 = (((v0 <= v0) < (v2 <= v0)) ? ((v1 >= 31) / 6) : ((v2 != v0) * (a1[0][4] || 81)));
+        v0 = (((a1[0][14] > 73) / 2) || ((a1[3][12] ? v0 : a0[12]) < (92 ? v2 : v3)));
+        v3 = (((v2 < v2) / 7) % 4);
+    } else {
+        a1[1][14] = (((a0[8] <= 2) + (v3 && v3)) || ((v0 % 7) >= (63 && a1[1][14])));
+        v2 = (((v0 > a0[5]) < (v0 && a0[15])) * ((85 % 7) + (a0[13] + a1[2][14])));
+        v2 = (((v2 <= v1) > (v3 || v1)) > ((94 <= a1[1][5]) != (87 <= 33)));
+    }
+    v3 = (((v2 && v1) * (a0[1] >= a1[1][12])) * ((v0 % 4) != (v2 > 43)));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v0 ? a0[9] : v2) > 52) break;
+            v2 = (((v0 / 3) != (v3 % 4)) ? ((v2 - v0) / 8) : ((a1[1][6] - a0[12]) != (3 + a1[3][3])));
+            v2 = (((a0[8] - 95) < (55 <= 10)) && ((v1 == v3) || (v0 != 71)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v2 * 45) < (a0[13] / 5)) + ((i0 > v0) >= (v1 <= a1[2][15])));
+                    a1[2][10] = (((v2 * i0) * (v3 + 99)) ? ((a1[1][12] != v1) % 9) : ((a1[0][9] - v3) / 3));
+                    v3 = (((v1 < v2) < (a0[12] && a1[3][5])) && ((6 + v3) / 8));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((v1 == a1[2][6]) > 54) break;
+            a0[5] = (((a1[0][9] ? a1[0][2] : a1[2][11]) - (v2 <= 49)) <= ((v2 != i2) != (v1 != a0[7])));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a0[4] = (((9 == a1[0][9]) >= (a1[3][10] != 55)) * ((72 / 1) + (v3 + 25)));
+                    v1 = (((a1[0][4] % 3) % 9) - ((a0[13] + 21) - (69 == v0)));
+                    a0[0] = (((v0 || v1) <= (a0[3] - i2)) == ((i2 != 13) <= (43 + v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((54 / 4) - (v3 % 1)) / 7);
+            i2 = i2 + 1;
+        }
+    }
+    return (((v2 <= 42) * (18 > 97)) || ((a0[2] - 85) || (v3 == a1[1][6])));
+}
+int f1() {
+    int v0 = 89;
+    int v1 = 25;
+    int v2 = 81;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v2 = (((a1[3][12] <= 19) < (v0 || 44)) < ((48 - v1) < (77 == 65)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((v2 != 34) > 98) break;
+                a0[7] = (((i1 <= a1[0][15]) / 8) || ((35 - a1[2][4]) - (v2 ? a0[1] : a1[1][8])));
+                v2 = (((i1 <= a0[5]) + (48 >= 20)) ? ((i0 ? a1[0][2] : v3) * (75 && a0[3])) : ((v3 > i0) && (v0 == v2)));
+                v0 = (((65 || v0) < (a0[8] % 8)) < ((v3 % 7) && (i1 - a1[3][6])));
+            }
+            v1 = (((v0 || 46) ? (20 > 22) : (0 * a0[7])) > ((a0[12] / 3) - (a1[3][13] + 53)));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((92 ? 78 : a0[5]) && (a0[8] % 2)) - ((a1[0][2] < v3) != (a0[5] >= v1)));
+    if ((((v3 >= v2) + (v1 == v3)) / 3)) {
+        a1[3][11] = (((17 && v1) >= (a0[13] % 2)) ? ((v0 * a1[2][7]) >= (35 > v1)) : ((v2 != v0) * (a1[0][15] >= v3)));
+        v2 = (((v3 || v3) == (93 ? a0[2] : 25)) != ((a0[12] % 6) || (48 / 8)));
+        v0 = (((v2 * a0[15]) <= (v1 / 8)) <= ((v0 < v2) - (59 && a1[2][3])));
+    } else {
+        v1 = (((73 / 5) >= (a1[1][3] || a1[0][15])) / 7);
+        v3 = (((a0[5] && v3) * (v1 > a1[2][10])) >= ((95 == v3) || (v2 != a1[3][13])));
+        a0[14] = (((v1 / 5) || (v0 && 53)) - ((a0[5] != a0[4]) + (26 % 6)));
+    }
+    if ((((v3 != v3) ? (a1[0][0] % 4) : (v2 >= v1)) > ((a1[3][4] ? v2 : v2) <= (v1 < v3)))) {
+        a1[0][9] = (((52 + v1) - (a0[6] / 2)) && ((v3 - v3) != (44 + a1[1][2])));
+        a1[0][12] = (((v3 >= v1) < (v2 ? a1[2][7] : v1)) ? ((4 <= v0) && (v0 >= 59)) : ((v2 ? v0 : v3) / 5));
+        v3 = (((v0 * v1) == (a0[3] <= a1[2][0])) == ((73 != v1) && (v1 / 7)));
+    } else {
+        v1 = (((v3 > v0) - (43 / 2)) + ((v0 ? 42 : v1) + (44 ? 59 : a0[8])));
+        v1 = (((a1[0][12] % 8) != (v3 || a0[14])) - ((60 + 85) / 6));
+        v3 = (((v1 / 8) <= (v3 && v3)) != ((v3 && a1[3][4]) != (a0[8] && v3)));
+    }
+    if ((((v3 <= v3) ? (a0[0] != 73) : (v2 || 65)) && ((35 / 5) - (v0 > v1)))) {
+        v1 = (((a1[1][3] / 4) == (v0 <= v2)) * ((a0[0] * v1) - (v1 > a0[14])));
+        v1 = (((a0[15] != v1) / 3) == ((v2 ? v1 : v3) <= (v3 >= 26)));
+        v3 = (((42 ? v3 : v0) + (v0 % 7)) != ((75 - v1) <= (v0 / 5)));
+    } else {
+        v2 = (((v2 * v3) && (34 / 1)) / 7);
+        a0[2] = (((a1[1][14] % 6) || (60 % 7)) * ((v3 * 40) > (a1[3][5] == 57)));
+        v3 = (((a0[14] ? 3 : 11) + (5 * 26)) > ((v3 / 7) >= (a1[0][3] && v2)));
+    }
+    return (((v3 * v2) && (v3 || a1[0][4])) && ((v3 - a0[1]) && (a1[0][8] % 4)));
+}
+int f2() {
+    int v0 = 93;
+    int v1 = 34;
+    int v2 = 97;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[2][12] = (((v3 - a0[7]) != (v2 + 18)) >= ((v3 ? v2 : v3) <= (a0[15] == 30)));
+            v2 = (((i0 ? 83 : v0) / 9) != ((4 / 2) == (a1[1][10] <= i0)));
+            {
+                int i1 = 0;
+                do {
+                    a0[4] = (((v1 && v3) / 7) < ((v3 > v1) && (23 || a0[12])));
+                    a0[1] = (((a0[9] * 64) - (3 - v3)) != ((43 <= v2) != (a0[9] || a1[3][14])));
+                    v0 = (((i0 / 4) != (v3 / 3)) * ((v1 ? a1[0][13] : v0) + (v3 / 9)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((a1[0][12] || v2) > 68) break;
+        {
+            int i3 = 0;
+            do {
+                if ((i3 || v1) > 96) break;
+                v0 = (((a0[8] * v0) ? (v1 * v0) : (a0[8] / 7)) % 1);
+                a0[6] = (((v3 + v1) < (i3 > i2)) + ((80 / 8) < (a1[3][13] != v3)));
+                v3 = (((i2 ? v3 : v1) % 8) + ((i2 <= v0) > (a0[8] * v3)));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        v0 = (((a1[0][3] <= 68) >= (i2 - i2)) + ((i2 * v2) ? (v1 / 1) : (v0 / 7)));
+        v2 = (((v2 >= v0) >= (v3 / 3)) / 1);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            a1[1][13] = (((54 ? v3 : v2) ? (a1[2][2] > 85) : (v1 == v0)) >= ((v1 % 8) || (64 ? a1[0][10] : v1)));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                a0[9] = (((v3 != v3) - (50 == i5)) || ((v1 && i5) + (i5 + a0[1])));
+                v0 = (((8 < i5) + (i5 <= 20)) ? ((16 || 55) * (v3 || v2)) : ((a0[14] % 1) || (23 && v2)));
+                a0[0] = (((2 - v1) / 4) && ((a1[1][4] ? i5 : 78) < (32 / 5)));
+            }
+            v0 = (((a1[0][0] % 9) <= (v0 > v0)) || ((75 / 3) ? (v3 - 24) : (91 ? a1[1][0] : 42)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v1 = (((v0 <= v2) >= (i6 - a1[3][9])) <= ((27 <= a0[2]) < (v1 != a0[5])));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    a0[11] = (((a1[1][13] && 7) >= (v2 > v2)) >= ((v3 ? v0 : v3) / 2));
+                    v0 = (((80 != v3) > (i6 != 35)) >= ((2 ? i7 : i7) ? (v1 / 7) : (a0[2] + v1)));
+                    v0 = (((a0[3] + v3) / 6) * ((v1 > v3) >= (a1[2][12] > 1)));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((v3 >= 3) % 9) - ((v0 - v1) <= (14 < 21)));
+            i6 = i6 + 1;
+        }
+    }
+    a1[3][6] = (((a1[0][11] && a1[2][5]) ? (a0[2] <= v1) : (a1[1][11] - v1)) / 3);
+    return (((v1 >= v3) - (98 ? v3 : a0[7])) >= ((43 * 75) ? (a1[2][2] == v2) : (a1[3][8] / 7)));
+}
+int main() {
+    return 0;
+}
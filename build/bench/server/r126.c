@@ -0,0 +1,59 @@
+int f0() {
+    int v0 = 85;
+    int v1 = 16;
+    int v2 = 50;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a1[3][2] % 7) <= (v0 == i0)) / 9);
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((a1[2][2] >= 57) > 51) break;
+                v1 = (((v0 == a0[3]) != (v2 <= a0[0])) ? ((23 != 30) >= (a0[7] != a0[13])) : ((i0 != v0) ? (11 - 23) : (22 * v3)));
+                v3 = (((47 < a0[12]) - (a1[0][9] == a1[0][2])) <= ((i0 * 88) || (v0 == a1[0][8])));
+                v3 = (((v2 != i0) / 6) <= ((i0 - a1[2][0]) * (a1[3][2] >= v2)));
+            }
+            a0[15] = (((22 / 3) + (v0 + 83)) != ((v1 / 8) || (v1 - v3)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    a0[2] = (((7 == a0[11]) % 8) % 4);
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((i2 < v3) >= (v2 || v3)) > ((v1 / 2) == (v0 * v0)));
+        a1[0][15] = (((v3 > 83) + (i2 * 30)) + ((v3 != a0[8]) - (i2 < a1[0][0])));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v2 = (((i3 < v2) - (v3 && 76)) < ((i3 <= a1[0][6]) < (38 && v0)));
+            v0 = (((v3 * v0) > (v2 <= a0[1])) == ((a0[5] ? a0[0] : a1[1][10]) < (a1[2][6] <= i3)));
+            a1[0][9] = (((v3 != 72) != (i3 != v1)) * ((i3 + a1[3][12]) <= (a0[14] >= 46)));
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            a0[11] = (((v0 != v0) || (v3 % 7)) ? ((5 == v1) - (a0[5] * v3)) : ((i4 % 8) - (i4 >= v1)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                if ((33 % 8) > 78) break;
+                v1 = (((a1[1][13] < 54) - (a0[1] - v2)) >= ((i5 >= 37) / 9));
+                v1 = (((a1[0][0] * 18) ? (77 != a1[0][4]) : (34 == 12)) > ((i4 || 26) % 1));
+                v1 = (((79 <= v0) * (v1 > a1[1][15])) == ((i4 || i4) >= (69 == v2)));
+            }
+            v3 = (((v3 <= v0) == (55 && v0)) / 8);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[0] * v1) - (v2 ? v1 : v3)) - ((v2 <= v3) >= (44 ? v0 : a1[0][8])))) {
+        a1[1][10] = (((26 / 3) && (v3 && a1[2][13])) != ((v2 < v3) <= (a0[10] * a1[3][10])));
+        a1[3][9] = (((v0 ? a0[6] : a1[2][15]) || (a1[0][5] + v1)) + ((v1 + a0[10]) <= (v3 <= a0[10])));
+        v3 = (((a1[3][1] + a0[0]) + (a1[2][2] || v2)) != ((a1[1][10] % 8) * (v1 - a1[0][13])));
+    } else {
+        v0 = (((v1 != a1[1][7]) == (v3 + v1)) < ((76 % 9) > (a1[2][9] % 2)));
+        v2 = (((a1[2][12] && v0) / 6) && ((v0 >= a1[0][9]) ? (32 < v1) : (v3 > v2)));
+        a1[3][15] = (((40 ? v3 : v2) > (a1[1][14] && 11)) <= ((a1[3][12] * 63) < (a0[14] / 4)));
+    }
+    return (((v0 <= a0[8]) % 1) < ((a1[1][15] != v0) && (v0 ? 13 : 22)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,91 @@
+int f0() {
+    int v0 = 46;
+    int v1 = 59;
+    int v2 = 1;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a1[1][0] && v3) < (a0[5] >= 11)) * ((a0[3] != 22) && (v0 - v0)));
+    if ((((72 == v0) < (v1 + v2)) + ((v2 * 69) * (v3 && v1)))) {
+        v3 = (((a0[12] + a0[4]) != (36 && v3)) == ((a1[3][12] && v3) / 3));
+        v1 = (((92 - a0[7]) || (a1[1][13] != a1[0][4])) >= ((v3 % 6) % 7));
+        a0[1] = (((a0[3] + v3) - (v1 < v3)) ? ((a0[4] * 84) != (a1[0][15] * v2)) : ((a0[8] != v2) == (v1 ? v3 : v2)));
+    } else {
+        v3 = (((v3 - v0) - (v2 && v0)) ? ((v1 - v2) ? (36 < v1) : (a0[2] >= a0[2])) : ((v3 > 86) - (a1[3][0] > v2)));
+        v0 = (((v0 + a0[6]) < (89 != v2)) != ((68 ? v1 : a0[12]) >= (v3 ? a0[5] : a0[1])));
+        v1 = (((v0 && v3) / 3) || ((a0[9] / 2) && (v3 != v1)));
+    }
+    v2 = (((56 < v0) <= (a1[3][1] < a0[6])) || ((a0[4] / 5) + (a0[15] / 4)));
+    a0[13] = (((84 ? v3 : 69) ? (v0 / 3) : (v1 > 17)) >= ((v3 || 87) ? (v3 >= v1) : (54 * a1[1][11])));
+    {
+        int i0 = 0;
+        do {
+            a0[2] = (((v1 - a1[2][7]) + (v2 ? v1 : a0[1])) < ((a1[2][7] >= 75) >= (v3 / 8)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v2 = (((a0[14] == 2) + (86 && i0)) ? ((29 % 9) <= (a1[2][14] ? a1[3][4] : i1)) : ((84 && v2) == (v0 < v3)));
+                    v0 = (((31 % 1) >= (v0 ? v3 : 67)) < ((a1[3][6] % 7) % 5));
+                    v3 = (((a0[13] * v1) || (v2 ? v1 : v2)) % 7);
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v3 / 5) || (i0 % 8)) >= ((v2 >= a0[4]) || (v0 >= 49)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    return (((v3 - v0) + (a1[3][12] * 83)) < ((26 == v3) != (50 % 2)));
+}
+int f1() {
+    int v0 = 89;
+    int v1 = 10;
+    int v2 = 90;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 * v0) != (35 > 35)) > ((a0[14] ? v3 : a1[1][10]) - (94 >= v0)))) {
+        v2 = (((v2 ? 60 : v2) % 7) + ((v2 || v3) < (v2 >= a0[6])));
+        v1 = (((v2 / 6) < (v2 || a1[2][14])) ? ((73 && 16) > (v1 == v2)) : ((v1 < v2) / 8));
+        a1[3][15] = (((v1 >= v2) || (a0[4] <= a0[15])) != ((v1 && a1[1][10]) ? (a1[0][4] * v0) : (v1 < v0)));
+    } else {
+        a0[15] = (((v2 ? a1[0][4] : v2) <= (v2 - 69)) + ((v1 != a1[3][3]) || (a0[2] ? v0 : a1[0][8])));
+        v2 = (((v3 - a0[5]) > (v0 - 25)) != ((v1 > v1) == (v2 > v1)));
+        v0 = (((v3 / 1) || (63 || 28)) != ((a0[2] / 2) % 7));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v3 = (((v0 >= v0) && (19 / 7)) ? ((i0 && 97) + (26 + v3)) : ((32 < 0) != (v2 % 6)));
+        {
+            int i1 = 0;
+            do {
+                v1 = (((i1 && v3) >= (a1[2][6] >= v1)) || ((v3 <= a1[3][4]) >= (a0[8] != i1)));
+                v3 = (((v0 < a1[1][12]) > (33 >= v2)) - ((a0[1] - v2) || (a1[0][7] >= 88)));
+                v2 = (((21 || i0) - (v1 / 3)) ? ((v0 <= a0[15]) || (i0 != a1[0][15])) : ((95 ? v0 : v1) && (a0[8] > a0[11])));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v0 = (((31 / 4) - (v1 <= 58)) <= ((15 >= 66) == (30 <= v3)));
+    }
+    if ((((v2 <= 42) >= (v2 > v0)) + ((12 % 8) == (a0[10] > v3)))) {
+        a1[0][10] = (((a1[3][13] <= a0[10]) / 3) && ((43 <= v0) < (a1[3][2] - v2)));
+        a1[2][6] = (((v0 == a1[2][1]) == (70 + v3)) ? ((91 > v1) == (89 % 8)) : ((a1[1][15] >= 9) ? (9 / 2) : (75 - 18)));
+        v0 = (((46 || 89) - (v1 / 2)) ? ((a1[2][15] < 44) * (23 > 17)) : ((v1 > v3) * (5 && v2)));
+    } else {
+        v1 = (((49 > a0[9]) >= (a1[3][14] + a0[7])) % 5);
+        v2 = (((v2 <= v0) || (a0[5] - v1)) + ((v3 == a0[2]) < (26 - a1[1][15])));
+        a0[2] = (((v1 >= a0[4]) < (v0 - v2)) <= ((a0[10] && a1[3][9]) < (v0 < a1[0][11])));
+    }
+    if ((((v2 * v0) - (a1[3][6] < a0[10])) || ((17 == 98) >= (v3 > a1[2][9])))) {
+        v3 = (((20 || a1[0][5]) - (a0[12] == v0)) && ((v2 > v2) != (v1 != 13)));
+        v1 = (((v0 >= a1[3][15]) >= (v3 % 7)) % 2);
+        a0[13] = (((a0[12] % 6) ? (v0 - v0) : (v0 || v0)) > ((60 + a0[10]) <= (v1 >= 89)));
+    } else {
+        v1 = (((v1 % 5) == (v1 ? v3 : a0[0])) % 5);
+        a0[7] = (((43 + v2) || (17 < v1)) && ((v1 != 64) % 8));
+        v0 = (((v3 > v1) || (v1 > v3)) + ((25 == v1) % 3));
+    }
+    v0 = (((a1[2][13] && 16) || (v0 && a0[6])) / 4);
+    return (((v2 / 8) - (v1 > a0[13])) ? ((a0[15] < 89) < (v3 + a1[0][9])) : ((24 && a0[4]) > (a0[12] - 99)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,176 @@
+int f0() {
+    int v0 = 87;
+    int v1 = 71;
+    int v2 = 52;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((v0 / 4) > 77) break;
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a1[3][8] = (((91 == i0) ? (i1 * 82) : (a1[1][10] + 65)) == ((64 >= 28) * (i0 || v1)));
+                v2 = (((v1 ? i1 : v3) && (47 != a0[6])) > ((v3 && a1[2][5]) != (i1 >= a1[3][4])));
+                v3 = (((a0[7] && v3) * (i1 ? 97 : i0)) > ((v1 > v1) / 8));
+            }
+            v0 = (((v1 ? v0 : 66) / 8) || ((v3 > a0[1]) * (i0 && 22)));
+            a1[3][7] = (((v0 == a1[0][14]) / 4) != ((94 || v3) > (a0[1] - v0)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 / 3) % 3) || ((a1[1][6] - v1) >= (v0 >= a1[3][15])))) {
+        a0[4] = (((4 <= v1) - (a1[2][8] % 1)) > ((58 % 4) % 9));
+        a0[15] = (((a0[15] ? v0 : 83) < (a1[0][9] <= v0)) == ((v0 / 9) <= (v2 ? a0[4] : v1)));
+        v1 = (((v3 != a1[2][2]) && (a1[3][10] || v1)) > ((7 == v2) * (v0 + 20)));
+    } else {
+        a0[10] = (((v3 - v0) != (92 / 3)) <= ((a0[14] % 3) ? (v0 || a0[5]) : (a0[4] % 7)));
+        v2 = (((v2 == v0) % 7) != ((v3 && a0[9]) != (v1 * v1)));
+        v0 = (((v0 % 4) <= (a0[1] / 9)) ? ((v3 % 5) % 6) : ((v0 != a1[0][9]) + (v0 > v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v0 = (((v2 % 1) + (v3 < 37)) * ((i2 ? a1[2][5] : 65) - (v2 / 1)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v2 = (((a1[3][7] <= i2) == (a0[7] < a1[2][6])) ? ((v2 <= v1) % 5) : ((a1[0][2] == 53) == (i3 / 5)));
+                v3 = (((a1[1][14] || i3) < (79 && 90)) * ((29 != a1[2][15]) <= (i3 > 64)));
+                a1[1][6] = (((a1[1][5] * i2) != (3 || a0[14])) % 8);
+            }
+            v1 = (((v3 != v2) - (i2 - v3)) && ((a0[6] != v0) % 6));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((a0[11] / 9) / 2) < ((9 - 16) >= (v1 * 16)));
+    v1 = (((v1 - 98) >= (v1 == a0[7])) && ((v0 && v3) || (9 ? a0[5] : a1[3][15])));
+    return (((a1[3][13] + 75) % 3) >= ((58 ? v3 : v1) - (v3 ? a0[13] : v0)));
+}
+int f1() {
+    int v0 = 17;
+    int v1 = 54;
+    int v2 = 42;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    if ((((7 ? a1[2][11] : a0[10]) >= (a0[7] < 91)) > ((v3 >= 72) > (36 * v0)))) {
+        a1[2][15] = (((a1[2][4] < 1) * (v1 && v0)) / 8);
+        a0[9] = (((a1[1][13] > 11) || (v2 < v1)) ? ((v1 ? v1 : v0) > (99 && v0)) : ((22 >= v2) > (9 ? v2 : a1[3][2])));
+        v0 = (((v3 != v2) + (a0[12] % 2)) != ((v2 >= a0[11]) ? (v3 + v2) : (32 / 2)));
+    } else {
+        a0[11] = (((v2 != a1[2][8]) / 1) < ((v3 == v3) ? (v3 ? 90 : 94) : (a1[1][10] ? a0[3] : v3)));
+        v1 = (((87 == v1) ? (a0[0] % 9) : (54 == v1)) ? ((a1[3][14] % 3) * (v1 || v0)) : ((a0[11] * 88) != (v1 / 6)));
+        a1[2][15] = (((v3 <= a0[9]) == (v2 <= v3)) % 4);
+    }
+    v2 = (((88 - v1) * (a0[15] - 45)) + ((a1[3][2] ? v1 : v0) / 4));
+    {
+        int i0 = 0;
+        do {
+            a0[13] = (((a1[0][13] >= 76) * (v3 * a1[1][2])) * ((v1 - v3) - (71 && a0[14])));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a0[5] = (((v3 == 60) / 7) ? ((a1[0][13] % 1) % 6) : ((v2 <= 65) == (i1 || v3)));
+                    v1 = (((a1[1][6] + a0[2]) - (a0[15] && i1)) + ((94 - a1[2][2]) * (v1 > a1[1][2])));
+                    a1[2][6] = (((v2 - 52) + (i0 > a0[10])) / 1);
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v0 > a0[7]) <= (i0 >= 45)) > ((v3 != 79) * (47 - v1)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((94 && a0[6]) > 70) break;
+            v1 = (((62 > v3) - (i2 != v2)) >= ((73 ? v0 : v0) - (i2 && 46)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v2 = (((i3 < i2) >= (v3 % 5)) - ((v1 && a0[3]) ? (i3 != i2) : (56 / 1)));
+                v2 = (((v2 - 56) != (61 || i3)) < ((a0[1] >= a0[9]) % 8));
+                v3 = (((v1 == v2) > (i3 ? i2 : 11)) >= ((v3 && 82) >= (v1 % 1)));
+            }
+            v2 = (((a1[0][11] ? a1[0][5] : v3) - (a1[1][7] < v1)) + ((a1[0][6] ? a0[13] : a1[3][15]) / 7));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((v0 != v1) ? (v1 && v1) : (v1 ? 33 : v1)) - ((34 == a1[0][3]) > (v3 <= a0[4])))) {
+        a1[3][0] = (((v3 * a0[0]) && (v1 == 92)) && ((6 <= v2) < (v0 / 3)));
+        v1 = (((a1[0][3] <= v1) >= (v1 > 19)) % 5);
+        v0 = (((v0 == 23) < (a0[13] <= v0)) != ((a1[3][12] >= v3) < (v0 - a0[10])));
+    } else {
+        v0 = (((a0[5] == v2) - (v3 < a1[3][7])) - ((1 && 50) / 3));
+        v1 = (((82 > v3) ? (a1[2][5] / 6) : (v0 < v2)) == ((80 == 17) || (52 ? v2 : a1[2][7])));
+        a1[2][4] = (((v2 % 2) && (v0 % 2)) <= ((86 / 9) % 5));
+    }
+    return (((v2 == a0[13]) + (v3 / 7)) / 2);
+}
+int f2() {
+    int v0 = 15;
+    int v1 = 72;
+    int v2 = 20;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[3] * v3) && (v0 ? a1[3][3] : 39)) % 6)) {
+        v0 = (((v3 < v1) + (v1 >= v1)) * ((v1 ? 9 : 51) ? (v2 ? v2 : a1[2][5]) : (v0 ? a1[3][14] : a0[3])));
+        v1 = (((78 || v3) || (v0 > a0[8])) < ((v1 || v0) * (v3 ? v0 : a0[13])));
+        v2 = (((v1 && v1) == (36 >= v1)) % 3);
+    } else {
+        v3 = (((v1 >= v3) % 9) && ((v1 * a0[11]) <= (v2 < a1[3][10])));
+        v0 = (((v1 + 40) > (v3 ? a1[3][8] : 65)) <= ((31 - v2) + (14 / 2)));
+        v3 = (((a1[0][14] % 1) || (v0 - a1[1][1])) >= ((v0 ? a1[1][12] : a1[3][1]) != (37 < a1[0][6])));
+    }
+    if ((((84 / 3) / 7) - ((v2 && v2) != (v0 < 29)))) {
+        v2 = (((v0 && v2) ? (v2 < v2) : (v2 / 7)) != ((21 != 77) == (a1[3][2] / 8)));
+        v3 = (((41 ? 88 : a0[11]) * (v0 + v0)) == ((v0 / 3) / 2));
+        a0[6] = (((21 > a0[10]) != (a0[3] || 60)) - ((v0 % 5) >= (31 ? v2 : v3)));
+    } else {
+        a1[2][12] = (((v2 >= v2) == (v2 >= v1)) && ((64 < v3) > (v2 % 9)));
+        v1 = (((a0[4] + v3) % 9) <= ((v0 && v2) ? (v3 > a0[10]) : (v0 >= a0[1])));
+        v0 = (((v0 * a0[6]) / 1) ? ((a0[0] - v1) % 8) : ((a0[10] > v2) < (v2 + 68)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[1][3] = (((61 >= 34) != (53 % 9)) + ((a1[1][12] / 9) - (v3 * 60)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((a1[3][4] >= 36) > 73) break;
+                    v0 = (((i1 * 12) * (i0 - 1)) == ((i1 > a0[11]) == (i0 - v3)));
+                    a1[2][0] = (((v2 < 47) != (75 * 59)) / 9);
+                    v0 = (((v1 * v2) < (58 && 45)) && ((49 + v1) < (89 && v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((27 < 83) <= (v3 < i0)) % 3);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v3 = (((v0 == 36) <= (v0 != 24)) || ((a0[3] ? v3 : a1[0][9]) / 9));
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                v1 = (((a1[3][5] || a1[2][0]) <= (v1 <= i3)) || ((v0 != i3) && (i2 != i3)));
+                a1[2][7] = (((v0 - a1[0][8]) * (v1 ? v1 : 19)) >= ((i3 / 9) < (i2 >= v0)));
+                v2 = (((v3 != v3) >= (v0 == v2)) % 5);
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v3 != 84) ? (v1 >= i2) : (v1 >= 97)) / 6);
+    }
+    if ((((29 != v3) != (v2 < v1)) - ((82 != 73) % 7))) {
+        v1 = (((73 + a1[2][5]) && (v0 < v3)) != ((a0[12] % 1) > (93 || v1)));
+        v3 = (((29 >= 9) / 8) - ((a0[9] < v1) >= (v2 > a1[1][9])));
+        v3 = (((a1[0][9] ? a0[4] : a0[0]) / 7) < ((a1[2][7] % 8) ? (v3 / 4) : (97 ? v0 : v2)));
+    } else {
+        v1 = (((v2 <= v2) && (a1[1][11] < 53)) * ((v2 && a1[1][5]) != (a0[7] == a1[1][12])));
+        v1 = (((a0[11] ? v3 : v1) / 5) < ((15 ? v2 : a0[8]) * (v0 + a1[2][6])));
+        v1 = (((a1[2][12] <= v0) <= (v2 - a1[0][0])) || ((a1[1][0] == 28) >= (v3 || v3)));
+    }
+    return (((31 == v0) + (v3 < a1[2][12])) * ((v1 == v1) / 5));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,65 @@
+int f0() {
+    int v0 = 69;
+    int v1 = 61;
+    int v2 = 61;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    if ((((51 ? v3 : a1[2][12]) && (v3 ? a0[9] : a1[1][6])) - ((77 - a0[8]) < (a0[13] + a0[7])))) {
+        v2 = (((v0 > v0) || (30 ? a1[1][8] : a1[0][2])) + ((v0 + a1[2][15]) >= (a0[9] ? 19 : v2)));
+        a0[13] = (((18 <= v1) || (v3 != a0[5])) - ((v2 >= a1[0][0]) % 9));
+        a0[11] = (((v3 * v2) && (v3 / 8)) ? ((61 <= 36) / 7) : ((a1[0][3] ? a1[0][7] : v1) % 3));
+    } else {
+        v2 = (((v0 <= 63) <= (42 > a0[13])) * ((30 * v1) % 8));
+        v3 = (((v0 ? v0 : v3) || (v1 ? a0[3] : v3)) % 9);
+        v0 = (((22 / 7) ? (a1[2][15] <= v1) : (v3 != a1[0][6])) ? ((a0[14] ? a1[3][6] : v1) || (a0[7] - v3)) : ((85 + a0[8]) + (v2 >= v3)));
+    }
+    v2 = (((53 <= 49) && (72 > a0[14])) + ((89 + 92) || (a0[13] ? 86 : 75)));
+    if ((((v1 != v3) * (v3 + a0[14])) == ((v3 >= a1[0][12]) % 3))) {
+        v0 = (((98 && a1[3][6]) ? (v1 ? v1 : 46) : (75 && 68)) == ((31 || 74) < (a0[3] > 24)));
+        v3 = (((v3 * v2) || (v3 && 18)) || ((a0[6] <= v3) < (a1[0][14] >= v3)));
+        a1[0][14] = (((53 * 82) * (a0[2] <= v0)) ? ((a1[0][15] == 67) + (v0 - a0[13])) : ((a1[0][12] || v3) * (a1[1][5] ? v0 : a0[5])));
+    } else {
+        v0 = (((v3 ? 81 : v3) > (v0 - 29)) ? ((0 % 4) != (v0 ? v1 : v1)) : ((a1[1][8] % 8) || (99 && a1[3][8])));
+        a0[1] = (((v1 < 92) != (v1 >= a1[0][7])) || ((a1[0][4] % 7) + (v3 && v0)));
+        v1 = (((a1[3][13] + v2) - (68 / 9)) < ((v2 ? v2 : 92) ? (a0[6] != a1[1][7]) : (34 / 4)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v2 = (((27 + 51) && (a0[12] ? v2 : 59)) > ((v0 >= a0[12]) % 8));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((i0 > a0[6]) - (v1 ? 29 : i1)) <= ((v0 >= i0) && (i0 / 7)));
+                    v2 = (((i0 == v3) <= (v3 + a1[3][5])) != ((v0 ? a0[14] : v0) / 4));
+                    v3 = (((4 && i1) == (a1[0][2] ? v3 : v2)) && ((a0[7] ? v3 : v0) == (61 != i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            a1[3][6] = (((97 - v1) - (v1 % 5)) * ((74 || 77) + (25 - i0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v1 ? v1 : a1[2][3]) && (v0 + 79)) != ((91 != v1) < (a0[11] / 7)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v2 = (((34 / 5) ? (v0 - v2) : (83 ? v1 : a1[2][2])) < ((a0[4] > a1[1][10]) <= (i2 < v0)));
+                    v0 = (((v1 ? 79 : v1) != (i2 ? v0 : 59)) ? ((2 || 60) != (48 - a0[9])) : ((a1[1][2] || i3) >= (i3 < v2)));
+                    a0[8] = (((i3 <= 39) || (78 - i3)) * ((23 * 78) - (v1 * a1[0][14])));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[10] = (((a1[1][9] / 6) + (i2 - a1[3][13])) && ((v0 || v2) ? (i2 || v1) : (v0 * a1[1][2])));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    return (((55 != v2) % 5) <= ((59 == 44) >= (v0 + v3)));
+}
+int main() {
+    return 0;
+}
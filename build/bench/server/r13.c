@@ -0,0 +1,112 @@
+int f0() {
+    int v0 = 35;
+    int v1 = 68;
+    int v2 = 4;
+    int v3 = 54;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 > 85) == (v2 >= 63)) || ((v0 || 77) == (37 ? v3 : a1[0][7])));
+    a0[3] = (((35 < v3) / 7) != ((a0[7] + v2) / 6));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a1[0][1] = (((v2 <= 25) ? (v2 / 5) : (a1[1][13] < a0[14])) % 7);
+        v2 = (((a0[1] == v3) / 7) || ((22 || 19) + (a0[8] < 15)));
+        {
+            int i1 = 0;
+            do {
+                if ((a0[11] + a1[0][15]) > 52) break;
+                v2 = (((78 ? a0[6] : v2) || (17 > v2)) >= ((v2 >= v3) ? (v1 * i0) : (v1 / 7)));
+                v3 = (((v1 - a0[9]) - (v2 == a0[13])) < ((v3 > i0) != (i1 != 4)));
+                v3 = (((v2 * a0[2]) == (v3 <= v2)) || ((a1[3][0] ? v3 : 40) + (v0 > v3)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+    }
+    if ((((v2 < v3) || (a1[1][10] / 7)) > ((v2 == 66) ? (v0 - v2) : (69 + v1)))) {
+        a1[3][14] = (((a0[15] || 8) * (v2 - v0)) || ((v1 + a1[1][0]) || (43 >= v3)));
+        a1[1][4] = (((v0 ? 7 : v3) == (88 == 69)) % 8);
+        v2 = (((v0 >= a1[0][0]) * (75 + v3)) != ((v2 <= a0[0]) >= (72 ? 66 : 89)));
+    } else {
+        a0[3] = (((v3 / 7) == (3 ? 26 : v0)) + ((61 && v2) != (2 ? v0 : v3)));
+        v1 = (((v1 <= a0[13]) < (v2 - 69)) / 1);
+        v2 = (((46 != v2) && (a0[7] % 8)) ? ((26 || 9) || (v0 + v3)) : ((a0[8] && a1[0][14]) || (v3 <= v0)));
+    }
+    if ((((5 < v3) - (v1 + v2)) % 7)) {
+        v2 = (((v1 <= v2) < (89 || 42)) == ((73 && 74) >= (v3 * v0)));
+        a1[1][7] = (((v3 % 2) <= (a1[3][8] <= v2)) / 5);
+        v2 = (((v3 == a1[0][2]) < (a0[2] != v2)) || ((8 - v1) ? (31 || v2) : (v3 % 4)));
+    } else {
+        a0[0] = (((a0[0] < 2) / 7) == ((v1 == a1[1][5]) * (v2 > 38)));
+        v1 = (((v1 / 8) < (v2 && v3)) / 4);
+        v3 = (((v2 == v1) - (a1[2][11] > v1)) < ((v3 + v3) - (a1[3][8] || v1)));
+    }
+    return (((82 + a0[2]) && (v0 || v1)) + ((a1[3][2] ? a1[1][14] : a0[6]) < (a0[11] - v2)));
+}
+int f1() {
+    int v0 = 88;
+    int v1 = 67;
+    int v2 = 91;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v3 = (((a1[0][5] || a1[2][11]) * (a1[2][1] / 9)) == ((a0[15] % 5) || (a0[15] <= 23)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                a0[6] = (((v3 > v3) <= (i1 == v2)) > ((v2 <= v1) <= (v2 != v3)));
+                a1[0][0] = (((v3 * 49) * (i1 * v3)) || ((72 < a0[13]) / 3));
+                a0[9] = (((i1 < i0) || (v2 != a0[10])) ? ((a1[1][3] != 18) >= (a0[8] + 40)) : ((a0[14] > i1) <= (a1[2][9] >= a1[3][5])));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((8 != v0) / 6) < ((99 > v0) <= (i0 ? v2 : a0[9])));
+    }
+    if ((((v1 >= v3) != (34 < v3)) <= ((30 % 4) == (v3 ? v1 : v1)))) {
+        v1 = (((v2 / 3) * (v0 == a1[1][4])) - ((32 % 7) != (v3 * v2)));
+        v1 = (((32 / 8) + (40 ? 67 : v2)) || ((v2 ? 91 : v2) < (a1[3][0] ? v3 : 39)));
+        a1[0][6] = (((60 ? a1[3][13] : v0) < (v2 % 7)) - ((v1 < v0) != (v2 ? v3 : 36)));
+    } else {
+        v1 = (((3 >= 52) >= (1 >= v0)) % 1);
+        v2 = (((a0[7] >= v3) / 4) / 9);
+        v0 = (((66 < v1) != (v2 != a0[4])) * ((a0[8] <= v3) != (v3 >= v3)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((v1 > 43) % 5) * ((v1 + v3) - (a1[3][5] == v0)));
+        v3 = (((a1[1][8] / 3) != (i2 ? v0 : 40)) && ((i2 == v0) == (v0 || v2)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((v3 != v0) > 54) break;
+                a1[2][4] = (((5 ? i2 : 36) ? (72 ? a1[2][2] : i2) : (v2 > 79)) > ((a1[2][14] && v3) * (v2 == 73)));
+                a0[2] = (((a1[3][12] < a0[2]) - (i2 - i2)) ? ((v0 != i3) || (33 * v0)) : ((13 / 4) || (v2 - 11)));
+                v0 = (((31 > v1) - (a0[4] <= v1)) ? ((48 < v3) % 2) : ((v2 > 83) / 4));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    v2 = (((90 + a1[2][15]) * (58 % 3)) ? ((v2 || v2) >= (76 + a0[9])) : ((69 % 5) * (a0[5] ? 13 : 73)));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v1 = (((v3 + a1[1][6]) && (a0[6] || i5)) == ((v2 || 59) - (90 - v1)));
+                    a0[2] = (((51 ? v3 : 31) ? (i4 < 81) : (a0[3] ? v1 : v2)) / 1);
+                    v3 = (((v2 || v1) != (a0[13] && a1[0][9])) && ((i5 && 20) / 7));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[1] = (((v2 ? i4 : a0[11]) ? (37 < a1[2][2]) : (v3 + 46)) && ((76 != v3) || (a1[1][12] + a1[0][3])));
+            v2 = (((v1 + v3) != (v0 >= v1)) % 5);
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v3 != 23) || (1 || a1[2][10])) || ((a0[13] < v1) ? (v1 / 3) : (v2 > a1[1][0])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
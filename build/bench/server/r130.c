@@ -0,0 +1,149 @@
+int f0() {
+    int v0 = 67;
+    int v1 = 34;
+    int v2 = 68;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v0 = (((v3 < i0) ? (v3 || a1[3][5]) : (i0 ? v2 : v2)) ? ((3 && v1) ? (v0 + a0[10]) : (a1[0][2] % 1)) : ((89 % 4) < (49 != 32)));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                a1[3][4] = (((a1[0][11] || a0[3]) % 6) ? ((a0[7] * v1) != (v3 != v1)) : ((i1 - a0[1]) > (a0[1] * 79)));
+                v3 = (((a1[1][11] || v3) || (50 * a0[2])) / 1);
+                v0 = (((a1[0][0] >= v1) != (v1 ? 17 : i1)) >= ((i0 || v2) && (v0 ? 47 : i1)));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((a0[0] * i0) >= (19 > a1[3][1])) < ((i0 / 9) ? (a1[0][13] / 5) : (a0[15] < v0)));
+    }
+    a0[4] = (((v3 - a0[3]) * (55 != v0)) / 9);
+    {
+        int i2 = 0;
+        do {
+            v3 = (((77 >= i2) == (a0[13] || v1)) ? ((a1[2][3] - 37) * (a1[0][8] > 62)) : ((93 > a0[10]) == (v2 - i2)));
+            v1 = (((v3 >= v1) + (a0[0] != a0[15])) > ((92 + v2) ? (v0 + v1) : (i2 * v0)));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][2] = (((59 ? 86 : 98) > (a1[3][0] % 1)) - ((i2 ? 90 : a0[5]) + (26 / 4)));
+                    v3 = (((23 < v2) && (66 || a0[8])) * ((89 < 68) % 1));
+                    a0[14] = (((a1[3][0] || a0[14]) >= (84 < 77)) == ((a1[1][2] * 87) ? (v2 != a0[3]) : (i3 && a0[11])));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v3 = (((a1[0][13] % 6) ? (i4 != v0) : (v2 < v0)) > ((v2 != i4) + (v2 > a0[11])));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v1 = (((i4 > a0[5]) == (v1 - v3)) <= ((i4 - i5) % 5));
+                v1 = (((20 / 2) + (i4 >= v2)) - ((v2 + v3) ? (v0 <= v0) : (96 <= 34)));
+                a0[4] = (((47 ? 81 : i4) / 3) < ((v3 == 98) % 7));
+            }
+            v1 = (((96 * a1[2][6]) + (v0 > 23)) || ((a0[1] > 94) < (v3 % 8)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a1[2][9] > v3) <= (56 ? a0[7] : v2)) >= ((v2 && v3) / 3))) {
+        v0 = (((v3 ? 33 : v0) && (v1 % 2)) ? ((v2 % 9) < (a1[2][1] / 6)) : ((v1 / 1) == (v2 + 65)));
+        v1 = (((v1 != v2) < (49 == a0[5])) < ((v2 + v3) > (49 <= a1[2][14])));
+        v0 = (((39 >= 70) <= (v1 ? a0[11] : v1)) % 6);
+    } else {
+        a1[2][15] = (((v0 * v3) - (a0[3] == v3)) >= ((79 >= v1) + (a0[7] < 11)));
+        v1 = (((v2 && a1[2][7]) >= (a1[1][2] * v1)) ? ((41 ? 99 : a1[2][6]) >= (24 / 7)) : ((v0 > a0[12]) % 7));
+        a1[2][7] = (((70 != a0[4]) * (v1 >= v2)) < ((a0[2] ? v3 : a1[0][15]) - (60 - 73)));
+    }
+    return (((v3 - v2) * (v0 >= a0[4])) ? ((v3 < v2) - (74 + v2)) : ((1 && a0[1]) + (a0[2] / 4)));
+}
+int f1() {
+    int v0 = 46;
+    int v1 = 88;
+    int v2 = 35;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                do {
+                    if ((13 ? i1 : v2) > 69) break;
+                    v2 = (((v0 != i0) / 5) <= ((94 >= i0) && (v0 * 26)));
+                    v1 = (((a1[1][0] < 37) - (71 < a1[3][13])) <= ((16 != v1) && (0 % 4)));
+                    v2 = (((a0[10] ? i0 : i0) < (a0[15] - i0)) == ((v0 ? a0[8] : 44) == (62 ? 99 : 18)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v2 = (((a1[0][7] && a1[3][3]) >= (a1[1][13] && 47)) >= ((a0[5] + a1[2][14]) ? (73 - a0[11]) : (v2 < v3)));
+            v0 = (((a1[2][14] && i0) - (v2 && v0)) > ((i0 >= 78) + (a0[5] / 7)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((26 <= v1) % 3) ? ((i2 ? a0[4] : v1) + (a1[3][5] - 87)) : ((72 >= v0) * (a1[2][15] % 5)));
+                    v2 = (((v0 - v0) * (i2 ? 86 : 29)) <= ((21 == i3) != (38 != v0)));
+                    a0[12] = (((47 * a0[5]) - (52 <= v1)) > ((a1[3][6] || v2) <= (v3 <= i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a0[7] - v1) != (v1 == v2)) ? ((i2 ? a0[15] : a1[1][13]) == (99 || i2)) : ((8 >= 26) * (74 ? v1 : a0[1])));
+            a1[0][6] = (((v3 + a1[2][14]) * (29 * 52)) > ((84 <= 98) + (31 % 8)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v0 = (((i4 / 9) ? (v2 >= 27) : (v3 ? i4 : 58)) / 5);
+                a0[12] = (((v2 == 50) >= (a1[1][6] - a0[15])) ? ((a0[6] < v0) ? (v2 < a1[0][2]) : (i4 >= v2)) : ((a0[7] < v2) / 8));
+                a0[14] = (((i4 * 93) > (54 >= 83)) - ((i5 ? a0[12] : 18) <= (a0[14] < a0[7])));
+            }
+            a0[2] = (((v2 != a1[2][15]) + (v1 * v3)) >= ((a0[9] + 38) / 3));
+            v1 = (((v1 && 27) - (v3 + 80)) <= ((i4 >= 80) >= (i4 <= 34)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        v0 = (((a1[2][13] && 95) % 9) / 3);
+        a1[1][6] = (((15 || a1[2][1]) > (a1[0][4] - a1[3][15])) / 9);
+        {
+            int i7 = 0;
+            while (i7 < 8) {
+                if ((60 + a0[8]) > 74) break;
+                v1 = (((a0[8] + 42) <= (a1[2][3] % 4)) + ((i6 < a1[1][13]) + (v1 / 5)));
+                v0 = (((v2 < i7) * (14 && 74)) >= ((12 != v1) || (v0 / 8)));
+                v3 = (((i7 > a1[0][15]) == (a1[3][0] <= i7)) <= ((48 + v3) ? (v2 - i6) : (27 <= a0[2])));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            a1[2][1] = (((i8 - v1) * (i8 / 3)) < ((v1 >= v3) / 5));
+            for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+                a0[2] = (((a0[8] && 25) && (v3 / 5)) ? ((a1[2][2] * v3) || (94 - i9)) : ((a1[1][14] ? 39 : v3) ? (v2 || i9) : (a0[11] % 2)));
+                v0 = (((v1 < i9) || (v0 != v3)) <= ((v3 * v0) - (98 == i9)));
+                v2 = (((30 <= v2) > (a1[0][9] || 9)) <= ((i8 < v1) <= (40 + v3)));
+            }
+            a1[0][8] = (((a1[0][2] && a1[2][15]) == (v0 > 80)) + ((v2 % 6) <= (v1 > 98)));
+            i8 = i8 + 1;
+        }
+    }
+    return (((a0[8] >= v0) < (v2 != a0[11])) && ((v0 < a0[1]) % 7));
+}
+int main() {
+    return 0;
+}
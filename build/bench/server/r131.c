@@ -0,0 +1,208 @@
+int f0() {
+    int v0 = 5;
+    int v1 = 50;
+    int v2 = 45;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 - v2) <= (67 > 71)) != ((a1[1][9] / 8) / 6))) {
+        v0 = (((86 ? a0[2] : a0[3]) || (a1[3][6] >= v2)) > ((a1[2][15] > v3) > (v2 ? a0[2] : 84)));
+        v2 = (((a1[3][13] || a0[3]) / 7) ? ((v1 ? v2 : v0) + (a1[1][9] && v3)) : ((v2 + 40) && (32 || a0[5])));
+        v0 = (((v0 - v1) != (88 % 9)) >= ((a1[1][11] * a1[2][1]) - (v1 || a0[2])));
+    } else {
+        v1 = (((a0[10] || v0) ? (v0 % 5) : (v1 % 8)) != ((54 * v0) == (v2 ? a1[1][14] : a0[11])));
+        v2 = (((46 || v0) > (a1[0][10] > v2)) || ((90 % 3) ? (v3 != a0[15]) : (a0[5] ? v3 : a0[12])));
+        a1[1][12] = (((v1 - 20) > (v0 + v2)) - ((a1[0][10] / 2) ? (v0 == 73) : (a1[0][6] ? 46 : 61)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        if ((9 < v3) > 79) break;
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v3 = (((a0[15] || 89) + (11 - v2)) ? ((87 || a0[13]) + (a0[7] ? v1 : a0[12])) : ((i0 + 27) - (v1 ? v2 : i1)));
+            a1[0][10] = (((27 && a0[12]) != (v2 >= v1)) >= ((v0 - v0) / 5));
+            v1 = (((v2 + 46) >= (a1[2][8] != v3)) >= ((v0 == a1[3][5]) == (v0 < a1[2][11])));
+        }
+        a0[10] = (((v0 * i0) <= (a0[2] < v3)) != ((59 > v0) != (v2 <= a0[15])));
+        v2 = (((37 < 24) + (37 / 9)) ? ((v3 == v2) + (i0 ? 29 : v3)) : ((v1 != v1) || (a0[5] && 13)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v1 = (((a0[4] >= 27) * (a0[2] >= a0[3])) + ((a1[3][4] % 5) ? (42 != i2) : (v1 + v1)));
+            v2 = (((v0 > v0) / 5) != ((v0 <= a1[2][4]) != (v0 % 7)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((a1[1][15] >= a0[6]) > 53) break;
+                v3 = (((v2 != a0[11]) >= (v2 || 72)) != ((i3 - v0) + (i2 % 9)));
+                v0 = (((a0[2] == v1) < (a0[11] != a0[11])) * ((v3 <= 92) != (i2 + a1[0][13])));
+                v2 = (((i3 - v2) != (29 * 16)) ? ((a1[0][12] <= i3) || (63 <= i3)) : ((61 - 48) - (v3 < 10)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            if ((91 || v3) > 80) break;
+            v0 = (((a0[1] > 83) >= (v3 && a1[2][3])) ? ((29 != v0) <= (84 % 9)) : ((v0 && v2) - (5 <= 77)));
+            a1[3][2] = (((v0 == a1[2][13]) != (v0 != a1[1][5])) > ((i4 || v3) % 8));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                a1[3][4] = (((v2 % 6) * (i4 < v2)) >= ((91 != a0[1]) ? (v1 && a1[3][10]) : (23 > v2)));
+                a0[14] = (((v3 != i4) != (i5 != i5)) + ((v1 - v2) + (20 <= v3)));
+                a0[7] = (((i4 || 68) ? (51 && v3) : (i5 - i4)) % 5);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[1][5] = (((a0[4] ? i6 : v1) == (v3 && a1[1][2])) && ((64 || v1) && (a0[8] / 4)));
+            a1[1][15] = (((77 != 86) <= (v3 + v2)) != ((i6 * a0[13]) / 2));
+            {
+                int i7 = 0;
+                do {
+                    v3 = (((63 * v0) || (v3 || 91)) % 6);
+                    a0[10] = (((v3 / 8) - (i7 > 91)) ? ((a0[4] / 2) <= (62 < 26)) : ((i7 / 7) > (76 ? 85 : 67)));
+                    a1[0][9] = (((a0[13] < i6) * (v0 * v1)) >= ((16 % 5) ? (v3 % 1) : (i6 > i7)));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    return (((25 * v3) == (v0 != a1[0][4])) % 8);
+}
+int f1() {
+    int v0 = 49;
+    int v1 = 72;
+    int v2 = 40;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[6] > 50) ? (60 == v0) : (a0[7] == v1)) - ((a0[1] != v2) % 7))) {
+        a0[8] = (((a1[0][7] ? 38 : a0[2]) ? (42 && v0) : (v0 || 51)) <= ((v3 || v1) * (77 / 4)));
+        a0[5] = (((v1 + v3) ? (v3 ? v0 : v3) : (v2 ? v1 : v2)) - ((28 / 1) == (v2 >= 41)));
+        v0 = (((93 ? v1 : a1[3][13]) != (97 ? 4 : 43)) < ((v1 > v0) && (v3 * v2)));
+    } else {
+        v1 = (((87 < a1[0][6]) == (a0[2] / 1)) + ((v2 || 95) ? (v3 == a0[1]) : (v3 / 9)));
+        v3 = (((v1 * v2) / 8) ? ((v3 + 10) + (4 - v2)) : ((19 % 1) == (v0 || v0)));
+        v3 = (((a1[0][15] > v1) * (12 % 7)) <= ((v2 + v1) >= (v1 + a0[11])));
+    }
+    v1 = (((v0 ? 67 : v2) ? (87 / 2) : (v2 && v1)) / 8);
+    {
+        int i0 = 0;
+        do {
+            a0[14] = (((i0 - a1[3][8]) && (v2 && a0[5])) >= ((v1 == a1[0][15]) ? (v2 * v2) : (v1 + a1[2][0])));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((v3 > v1) > 53) break;
+                v3 = (((v1 < a0[6]) / 2) ? ((v2 / 1) * (v0 ? 67 : a0[8])) : ((a0[8] * 46) && (v2 / 9)));
+                v1 = (((a1[0][0] == v0) > (i0 ? v1 : v3)) < ((20 % 8) != (53 != 40)));
+                v2 = (((82 < v0) < (i1 < 10)) > ((v1 * i0) != (31 / 5)));
+            }
+            v2 = (((i0 != v2) != (1 == v0)) || ((i0 > a1[0][4]) <= (a1[0][11] / 1)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v2 < i2) > 65) break;
+            a0[9] = (((v0 == v0) < (a0[3] >= v0)) != ((a1[2][14] >= 38) == (2 * v0)));
+            v1 = (((v1 != a0[14]) || (a1[2][0] == a0[7])) * ((22 != i2) - (v1 ? v1 : v3)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((a1[1][9] ? i3 : a1[3][13]) && (42 + 17)) ? ((i3 % 9) && (a0[13] <= i2)) : ((a0[2] - v1) - (v2 - v0)));
+                    a0[4] = (((a0[8] || v3) >= (v2 ? 39 : i2)) < ((59 - a1[3][5]) + (i3 > a1[0][13])));
+                    v2 = (((v2 + i3) > (i3 % 9)) + ((14 * v1) * (v1 % 7)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v2 = (((v3 * 40) - (44 ? a0[4] : v3)) <= ((v2 == 44) ? (v0 ? v1 : v0) : (93 / 2)));
+    return (((a1[0][11] + a0[3]) + (a1[2][6] == v3)) * ((v0 * 91) * (v1 < 54)));
+}
+int f2() {
+    int v0 = 41;
+    int v1 = 97;
+    int v2 = 31;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[14] = (((a0[9] && i0) * (v3 != a0[10])) + ((a1[2][8] / 5) / 7));
+            v3 = (((v1 <= 58) < (v3 <= 5)) || ((v0 || v1) != (v2 != v0)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((v2 < a0[7]) > 99) break;
+                    v2 = (((i1 == 29) ? (a0[9] % 6) : (v2 - i1)) == ((v2 > 65) <= (v0 <= v0)));
+                    a1[2][13] = (((i1 / 6) < (i0 || a1[2][1])) > ((79 + v0) <= (v0 <= a0[3])));
+                    v3 = (((v3 || v1) || (v2 >= v3)) + ((66 % 8) % 5));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 + v0) > (v0 ? v2 : 72)) > ((i2 && a1[1][2]) < (v0 % 4)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((v1 && a1[3][6]) > (a0[8] <= v1)) < ((29 > v2) && (v3 > a0[10])));
+                    a0[7] = (((v3 && a0[8]) >= (i3 && a0[2])) || ((95 || i3) ? (v0 / 3) : (i3 + a0[5])));
+                    a0[0] = (((v0 ? 93 : a1[3][2]) * (a1[3][7] <= i3)) * ((v0 % 9) ? (2 != v1) : (i2 > v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v2 = (((a0[12] / 3) / 3) * ((v3 * v1) / 3));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a0[4] = (((v2 <= i4) + (v2 + v1)) / 5);
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v1 = (((i5 + 95) ? (i5 ? a0[3] : i4) : (i5 || v0)) - ((v1 && v2) == (v3 < a0[12])));
+            v1 = (((5 * i5) >= (v0 / 6)) % 9);
+            v0 = (((a0[5] / 1) ? (97 + v2) : (i4 <= v3)) || ((a0[4] > a1[3][15]) % 6));
+        }
+        v1 = (((a1[1][14] * i4) * (29 / 8)) <= ((a1[2][8] / 5) >= (i4 == v0)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((56 / 1) > 86) break;
+            v0 = (((49 + 63) == (58 >= a0[9])) && ((7 / 8) * (a0[1] * i6)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    a1[3][12] = (((a0[13] / 7) / 4) <= ((v3 * 22) % 5));
+                    a0[15] = (((32 - v2) || (i6 % 7)) < ((a1[3][10] != v1) % 4));
+                    a1[2][4] = (((a1[3][15] > i7) || (i6 / 1)) != ((15 / 5) != (v1 ? i6 : i6)));
+                    i7 = i7 + 1;
+                }
+            }
+            a0[15] = (((v3 <= v0) != (a1[2][12] == v2)) % 6);
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    if ((((v0 - v1) < (3 == 84)) + ((59 < a0[9]) < (v2 || v0)))) {
+        v1 = (((24 / 9) <= (a1[1][0] * 37)) <= ((a1[1][10] ? a1[0][12] : 93) - (15 > 72)));
+        a0[10] = (((0 || a1[2][10]) || (v0 <= 75)) > ((a0[10] / 7) * (v0 ? v2 : a1[0][3])));
+        v1 = (((47 * v2) % 1) + ((a0[9] > a1[1][15]) - (v0 && v1)));
+    } else {
+        a0[4] = (((v3 && v0) ? (69 >= v3) : (83 <= a1[2][3])) / 3);
+        a0[7] = (((v0 ? v2 : v3) <= (v2 - v2)) > ((v1 > v3) - (a0[4] <= v2)));
+        v2 = (((86 || 19) >= (a1[1][5] >= v3)) <= ((v2 <= v3) < (a1[2][10] || a1[2][0])));
+    }
+    return (((v2 < 24) ? (a1[2][12] > 59) : (53 >= a0[0])) < ((v0 > v1) * (a1[0][14] == 5)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,61 @@
+int f0() {
+    int v0 = 77;
+    int v1 = 84;
+    int v2 = 44;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[6] + a1[3][5]) || (v2 && 92)) < ((a1[2][10] / 3) >= (66 <= v2)))) {
+        a1[1][3] = (((v0 < v3) < (v2 ? v3 : a1[2][10])) + ((v0 <= v3) >= (98 != 85)));
+        a0[8] = (((v3 - v2) / 8) > ((v2 || 8) / 3));
+        v2 = (((v2 && v2) < (v1 * 68)) == ((v2 - 76) >= (64 && v2)));
+    } else {
+        v1 = (((39 - v2) % 6) || ((6 ? a0[10] : v2) - (a1[2][15] / 6)));
+        v2 = (((v3 + 60) >= (83 + 61)) - ((85 && 95) % 1));
+        v3 = (((v3 * 95) / 2) > ((66 % 1) ? (v2 || v1) : (60 < a0[2])));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (((a0[8] - 0) == (v2 + v2)) ? ((v0 - v0) ? (a1[1][3] || v2) : (a1[2][9] % 1)) : ((53 != a1[0][2]) >= (a0[13] <= v1)));
+        {
+            int i1 = 0;
+            do {
+                v3 = (((a1[0][12] != v2) % 8) ? ((v2 >= 98) >= (a1[1][12] % 1)) : ((v1 / 8) <= (a1[2][8] == v1)));
+                a1[1][8] = (((33 + 29) % 8) <= ((a1[3][4] >= a1[2][2]) >= (a0[13] / 4)));
+                a1[2][4] = (((53 > v2) % 1) ? ((v0 + a1[2][13]) < (i1 < v0)) : ((i0 % 7) && (v0 != 6)));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v0 = (((34 > v1) - (a1[2][11] == v2)) < ((v3 == 41) < (i0 < a1[3][3])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a1[0][6] = (((v2 == v1) + (i2 * v2)) * ((v2 + a1[1][6]) || (i2 ? a1[3][9] : 8)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v0 = (((0 < v0) * (a0[15] || 36)) < ((a0[12] % 1) ? (v1 < v0) : (v3 ? a1[3][7] : 81)));
+                v1 = (((v3 ? 95 : i3) <= (v0 > a1[2][13])) % 5);
+                a0[1] = (((69 ? i3 : v1) ? (95 ? v1 : i3) : (67 < i3)) != ((i3 == a1[2][11]) / 8));
+            }
+            v0 = (((a1[1][9] || v2) && (a1[3][7] * 22)) % 3);
+            i2 = i2 + 1;
+        }
+    }
+    a0[0] = (((v1 < v3) ? (20 != a0[3]) : (50 != v1)) - ((v2 > v2) <= (a1[1][14] % 2)));
+    {
+        int i4 = 0;
+        do {
+            v0 = (((a1[3][6] <= 4) == (i4 >= 98)) - ((75 >= 49) - (i4 / 4)));
+            v0 = (((v3 ? v1 : i4) != (v0 - 89)) != ((a0[10] == 18) - (a0[9] * v0)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v1 = (((i4 < v2) == (50 && i4)) == ((v1 < a0[10]) > (v0 / 1)));
+                a0[4] = (((91 ? a1[0][15] : a1[2][10]) > (a0[12] <= 79)) > ((v1 == v0) + (v0 + 29)));
+                v3 = (((i5 ? v1 : v2) == (v0 != v2)) / 4);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v1 * v2) ? (v1 && 70) : (v2 ? v3 : a0[4])) != ((v0 && a1[0][0]) - (v3 == v0)));
+}
+int main() {
+    return 0;
+}
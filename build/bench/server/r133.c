@@ -0,0 +1,84 @@
+int f0() {
+    int v0 = 35;
+    int v1 = 78;
+    int v2 = 92;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 / 1) == (35 ? v3 : v3)) != ((63 * v2) != (v2 < v2)))) {
+        a1[0][5] = (((v3 ? a1[2][14] : 87) > (a0[8] ? a0[9] : 81)) >= ((75 - v2) < (36 + v1)));
+        a0[1] = (((a1[2][13] % 4) != (v3 ? a1[1][3] : v3)) < ((v1 / 4) ? (v2 / 9) : (v2 > a1[1][8])));
+        v3 = (((v2 == 51) || (v2 ? v2 : 70)) == ((a0[1] <= v1) != (v2 ? v2 : 40)));
+    } else {
+        v3 = (((v3 / 1) > (44 % 5)) + ((60 && a1[2][1]) < (v2 >= a0[1])));
+        v2 = (((a1[3][4] || v1) ? (v2 != v0) : (a0[11] ? 64 : v3)) || ((v0 != a0[1]) + (a1[2][2] >= a0[8])));
+        a0[1] = (((v3 != 13) * (a1[2][6] + v2)) <= ((a1[0][11] - a0[10]) / 3));
+    }
+    v2 = (((53 * v0) || (10 >= 45)) != ((v0 ? v2 : v3) * (v3 % 1)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a0[3] = (((v0 >= v1) ? (a0[6] + a0[15]) : (v2 ? 30 : i0)) >= ((v3 % 6) >= (a1[3][11] >= v2)));
+        {
+            int i1 = 0;
+            do {
+                v1 = (((v1 == 23) + (v0 / 2)) < ((i1 == v3) - (90 != a1[3][11])));
+                v1 = (((a1[1][7] / 7) + (v2 % 4)) / 5);
+                v1 = (((a1[2][8] % 9) < (54 > 86)) % 7);
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v2 = (((v2 > v0) ? (v1 && v3) : (i0 / 9)) && ((a0[8] || 57) ? (a0[13] + v0) : (a1[2][3] / 6)));
+    }
+    v2 = (((a0[13] < v1) && (a0[14] == v0)) / 7);
+    v0 = (((v2 * a0[14]) && (41 ? v3 : 3)) % 7);
+    return (((69 ? 36 : v3) ? (v2 > v2) : (v2 % 9)) && ((21 ? v3 : v2) || (14 >= 62)));
+}
+int f1() {
+    int v0 = 26;
+    int v1 = 38;
+    int v2 = 71;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v0 = (((a1[3][10] == 6) + (25 <= v0)) >= ((34 ? v3 : 59) - (a0[15] ? i0 : v0)));
+        {
+            int i1 = 0;
+            do {
+                if ((58 >= v2) > 92) break;
+                a0[0] = (((i0 ? v1 : 75) ? (33 > i1) : (a1[3][10] % 5)) - ((a1[0][3] || a1[3][2]) > (v3 ? 76 : i1)));
+                a0[1] = (((a0[15] ? v1 : i1) - (i1 > v3)) * ((v0 == a1[1][8]) / 2));
+                v1 = (((64 <= a1[2][10]) / 1) < ((i0 - 5) + (v2 != a0[4])));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v1 = (((v0 || 62) <= (71 > 97)) ? ((31 && v1) || (v2 && i0)) : ((87 > v2) != (79 * i0)));
+    }
+    v0 = (((v0 ? v0 : 67) * (61 < v2)) >= ((a0[3] > 71) >= (2 != v1)));
+    v3 = (((v3 ? a1[1][15] : v3) ? (v1 < v0) : (v1 || v0)) && ((a0[4] != 3) % 7));
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v3 = (((v1 <= 49) < (a0[13] == a0[6])) || ((v3 <= v2) > (v1 < 85)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                a0[13] = (((v0 - a1[3][13]) + (a0[12] % 8)) >= ((a1[3][14] >= 0) * (92 < v2)));
+                v2 = (((i2 - 66) - (a1[1][10] != 47)) && ((v3 >= a1[1][6]) >= (63 != v2)));
+                v1 = (((v2 / 9) > (26 != 55)) - ((v0 < v1) != (i2 ? a1[0][10] : a0[11])));
+            }
+            v3 = (((a1[1][3] > v1) < (v3 - a0[6])) < ((i2 ? v3 : 9) % 8));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 + v3) == (a0[9] <= a0[11])) + ((a1[1][11] && v3) < (8 >= a0[1])))) {
+        v0 = (((6 * v3) + (v3 ? 41 : a0[7])) > ((75 * v3) * (a1[2][1] % 5)));
+        v2 = (((a0[6] || v1) == (v3 / 4)) - ((v1 - a1[2][9]) / 1));
+        a1[0][9] = (((a0[15] + v1) <= (35 >= 39)) == ((80 * a0[14]) ? (v3 > v3) : (v3 % 7)));
+    } else {
+        a0[3] = (((v1 != v0) && (v0 >= v3)) != ((v2 == v0) - (v3 < v3)));
+        v1 = (((10 ? v1 : v3) || (v3 <= v2)) - ((v3 / 2) ? (v3 || v2) : (v3 > 4)));
+        a1[3][9] = (((a1[3][13] ? a1[3][14] : a0[0]) * (a0[0] + v1)) - ((v0 - 83) != (45 * a1[2][8])));
+    }
+    return (((v0 && v2) || (a1[3][13] % 2)) - ((v3 && 24) || (a1[3][2] || a0[5])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,169 @@
+int f0() {
+    int v0 = 7;
+    int v1 = 11;
+    int v2 = 43;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((a1[3][3] && v3) >= (v0 || v0)) > ((a1[2][8] * a0[6]) % 5));
+        {
+            int i1 = 0;
+            do {
+                if ((i0 < i0) > 71) break;
+                a1[2][9] = (((v3 ? v1 : a0[5]) <= (v1 / 6)) - ((61 <= 55) < (v0 % 8)));
+                v0 = (((a0[0] * a1[3][2]) != (a1[2][7] != i0)) < ((a1[1][13] ? a0[13] : 86) < (72 == a0[14])));
+                a0[2] = (((a0[14] >= i0) - (a0[8] - 82)) * ((a0[8] % 4) == (a0[12] * 17)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        v1 = (((93 != 19) / 8) ? ((a1[0][4] <= v2) * (a1[0][12] - v3)) : ((v3 == v0) + (i0 && 36)));
+    }
+    v3 = (((v0 > v2) % 6) * ((80 ? a1[1][9] : a1[3][3]) < (32 < v3)));
+    a0[3] = (((v0 / 3) % 2) + ((v3 == 38) >= (v0 < v3)));
+    v1 = (((v3 <= v0) >= (29 >= v1)) <= ((a1[1][13] > a0[7]) || (v0 >= a1[2][0])));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[11] = (((82 > v3) <= (v1 ? a0[10] : v2)) > ((a1[3][11] ? a0[14] : 88) / 9));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v2 = (((34 < 2) + (a0[8] < v0)) % 8);
+            v2 = (((i3 && v3) - (a1[0][13] * i2)) < ((a1[2][15] + i3) < (v3 != v3)));
+            v2 = (((a0[14] == v2) > (a1[1][2] ? 96 : v3)) != ((12 + v0) == (v0 < v2)));
+        }
+        v1 = (((v0 == v1) - (v3 % 9)) > ((v0 && v2) && (48 + a1[0][6])));
+    }
+    return (((9 >= 77) < (v3 || v3)) > ((81 - a1[3][7]) % 8));
+}
+int f1() {
+    int v0 = 39;
+    int v1 = 11;
+    int v2 = 22;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v2 = (((a0[1] ? v2 : v1) >= (8 < 23)) <= ((v0 % 1) >= (a1[1][1] == 17)));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                if ((i1 == i1) > 71) break;
+                a1[3][1] = (((92 * 55) != (98 ? v2 : v0)) > ((a1[2][2] <= a1[3][9]) - (61 || 81)));
+                v2 = (((v3 * v1) && (v0 / 8)) >= ((40 + 92) + (v1 || v1)));
+                v1 = (((v1 + i0) < (v2 && a0[0])) && ((v1 - v3) && (a1[1][3] ? i0 : 77)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[3] = (((a1[3][1] != a1[3][3]) == (54 * a0[13])) || ((v2 % 4) % 2));
+    }
+    if ((((v1 && 5) || (57 && 5)) && ((v0 < a0[9]) != (a0[4] % 7)))) {
+        v2 = (((17 <= 14) ? (a1[2][8] <= v3) : (a0[15] != a0[11])) ? ((v3 ? v0 : v2) - (v2 <= v3)) : ((a0[10] - a0[13]) * (v2 <= v1)));
+        v3 = (((a0[3] != 43) ? (a1[1][4] % 6) : (45 % 9)) && ((a0[12] < v0) - (v1 + a0[15])));
+        a0[12] = (((v1 == 38) / 2) - ((v1 && v0) < (v3 || v3)));
+    } else {
+        a1[3][10] = (((v2 != a0[6]) - (v1 / 3)) >= ((a0[12] ? 3 : v1) < (96 ? v0 : v3)));
+        a0[11] = (((v1 < v3) >= (v2 + v2)) - ((v0 - a1[3][11]) + (a1[2][5] ? 40 : a1[0][1])));
+        v2 = (((54 < v2) || (v3 <= v3)) / 9);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a0[2] = (((i2 ? v2 : v2) / 8) + ((v2 != 19) && (v0 >= a1[0][14])));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v2 = (((v1 == i2) % 1) && ((a1[3][1] ? a1[0][9] : v2) < (v3 ? a0[6] : 52)));
+            a0[15] = (((a0[3] && a0[2]) || (85 % 4)) && ((51 * v2) < (a0[9] / 8)));
+            a1[3][12] = (((v2 >= 96) && (v3 * v1)) + ((v0 * i2) && (i3 || 20)));
+        }
+        v1 = (((a1[3][4] > v1) % 6) <= ((55 <= i2) * (a1[1][14] / 1)));
+    }
+    if ((((v3 > v2) + (v2 % 7)) % 6)) {
+        a0[13] = (((v3 + 33) == (35 > a1[0][7])) <= ((a1[3][6] == v3) * (a1[0][12] < v3)));
+        a0[7] = (((v0 ? 50 : v2) * (77 + a0[11])) <= ((v3 != a1[3][6]) % 3));
+        a0[6] = (((17 / 4) - (44 != v3)) < ((a1[3][15] - a1[0][15]) * (99 && v2)));
+    } else {
+        v0 = (((26 || v3) * (v0 ? v3 : 82)) % 7);
+        v1 = (((71 <= 0) <= (98 - a0[5])) + ((v0 / 2) || (70 <= a1[3][14])));
+        v0 = (((a1[0][5] || v1) != (v2 < a1[1][14])) - ((49 - a0[4]) * (v0 <= a1[0][0])));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v3 = (((a1[1][6] && a1[0][3]) - (a1[2][2] + 46)) && ((v0 < 84) > (v1 >= a1[1][13])));
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                if ((84 + i4) > 57) break;
+                a1[2][13] = (((i4 / 9) <= (36 && 14)) < ((a1[0][2] ? a0[12] : 74) >= (a0[15] * a0[11])));
+                v3 = (((64 / 7) && (v1 <= v2)) && ((v0 / 7) - (v0 - v0)));
+                v2 = (((i4 && a1[0][15]) * (72 < 88)) <= ((v2 == 73) <= (v2 * 79)));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((75 != 4) <= (39 + a1[2][8])) != ((v2 != a0[2]) - (v2 ? i4 : i4)));
+    }
+    return (((91 > a0[4]) <= (v2 > 84)) % 3);
+}
+int f2() {
+    int v0 = 14;
+    int v1 = 67;
+    int v2 = 22;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a1[1][9] = (((a1[0][15] - v1) ? (a1[0][3] > 46) : (i1 - i0)) - ((a1[2][6] / 5) == (v3 >= v2)));
+                    v1 = (((v3 > a1[2][7]) && (a1[2][1] * 74)) * ((i1 || v0) > (v1 % 7)));
+                    v1 = (((45 - i1) ? (a1[1][7] && 12) : (58 >= i0)) != ((75 && a0[3]) * (46 + 6)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[7] = (((v0 <= v3) || (i0 + a0[13])) && ((95 ? v1 : v2) < (v0 / 8)));
+            v1 = (((v1 || v2) && (v3 || i0)) % 6);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v2 = (((a1[1][0] * a1[3][11]) < (v1 == 1)) * ((a1[3][4] ? a1[3][3] : v3) / 4));
+        {
+            int i3 = 0;
+            do {
+                a1[3][10] = (((a0[15] ? v3 : 89) == (i3 + a1[0][5])) * ((a1[2][8] * a0[11]) ? (i2 + 71) : (i3 / 1)));
+                a0[2] = (((57 - i2) / 8) % 8);
+                v1 = (((a1[2][13] <= 9) % 3) || ((a0[5] == 25) > (i2 > i2)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        a0[9] = (((i2 / 8) == (a0[9] / 6)) && ((a1[2][5] + 69) <= (a0[5] > i2)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a1[3][14] = (((v3 && v1) % 3) >= ((71 - v0) >= (a1[3][12] || 89)));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v1 = (((94 || v2) - (44 / 1)) > ((i5 <= v0) + (v2 < i4)));
+            a1[0][4] = (((a1[2][10] / 2) ? (a0[10] * 66) : (a1[0][3] > 10)) - ((a0[4] ? v0 : i5) < (4 ? 61 : a0[4])));
+            a0[4] = (((a0[15] < v2) == (a0[0] != i4)) >= ((a1[1][0] == i4) + (a1[1][11] < 39)));
+        }
+        v3 = (((a1[3][3] == i4) ? (v3 * v0) : (v2 * v3)) > ((v0 ? v3 : a0[15]) && (v1 || a0[9])));
+    }
+    v3 = (((v2 + 23) / 3) || ((a1[3][3] % 9) * (v3 % 1)));
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    if ((v2 > i6) > 50) break;
+                    v0 = (((a1[1][6] && v3) >= (60 * v3)) != ((45 ? a0[4] : a0[13]) ? (v1 ? v2 : v0) : (v1 != a1[1][13])));
+                    v2 = (((a1[1][2] % 1) ? (57 == v3) : (a0[7] - i7)) ? ((a0[9] && a0[12]) / 7) : ((a0[9] > 97) <= (v2 >= a1[3][7])));
+                    v3 = (((a0[10] < v3) ? (v3 >= a0[2]) : (i7 && 13)) ? ((v1 % 5) % 6) : ((a1[3][10] + a0[0]) != (a0[9] / 1)));
+                    i7 = i7 + 1;
+                }
+            }
+            a1[3][3] = (((i6 > a0[15]) ? (a0[6] >= a0[11]) : (a0[11] <= v3)) <= ((v1 * a0[5]) && (v1 >= 27)));
+            v0 = (((90 ? 12 : i6) && (i6 - 92)) <= ((a0[5] && 49) || (12 / 6)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v0 * v1) > (v2 ? a0[3] : v2)) >= ((v3 >= a0[6]) && (v1 || v3)));
+}
+int main() {
+    return 0;
+}
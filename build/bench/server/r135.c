@@ -0,0 +1,65 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 41;
+    int v2 = 98;
+    int v3 = 5;
+    int a0[16];
+    int a1[4][16];
+    if ((((11 - v1) > (v1 || v0)) >= ((36 > v1) != (v2 / 3)))) {
+        a0[1] = (((a0[9] + 99) - (v3 > a1[2][6])) / 7);
+        v1 = (((v1 / 5) && (v1 < a0[3])) == ((v2 || v1) * (a1[3][4] < v1)));
+        a1[3][2] = (((a0[8] * 80) / 5) == ((v2 * v2) != (v1 || 0)));
+    } else {
+        v1 = (((v2 - a1[3][0]) && (v2 != 87)) + ((a1[1][2] <= v3) / 7));
+        v3 = (((a0[15] / 7) < (v2 && 64)) < ((29 < v0) ? (v1 + a1[1][3]) : (v3 ? a1[3][8] : v3)));
+        v3 = (((v2 / 5) >= (34 % 7)) ? ((v0 - v2) != (a1[2][0] != v2)) : ((a1[3][8] ? v2 : v0) < (v3 % 8)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a1[3][10] ? 39 : 75) >= (64 * a1[2][14])) >= ((v0 == a1[0][2]) * (i0 <= i0)));
+                    a1[3][13] = (((v1 && 58) < (79 ? 45 : v3)) * ((i1 % 2) >= (i1 >= 35)));
+                    v0 = (((a1[3][11] > i0) > (a1[3][0] ? i1 : a0[7])) % 4);
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((v3 <= v2) == (41 <= 7)) || ((a0[13] < 35) || (a1[3][7] != v2)));
+            v1 = (((v3 || v3) + (38 == v2)) * ((67 < a0[14]) <= (v3 % 1)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    a0[15] = (((a0[14] - a0[2]) < (v1 % 5)) || ((a0[13] <= v1) != (v2 || v2)));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v1 = (((94 / 2) * (v1 * a0[5])) - ((v1 < v2) == (i2 - a0[10])));
+            a1[1][13] = (((i2 - v0) != (v2 <= v3)) * ((78 && a1[1][14]) <= (v1 + 31)));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((26 * 79) <= (35 > i2)) ? ((i3 > 11) / 8) : ((a1[1][3] - v1) + (v2 <= 53)));
+                    a1[2][1] = (((27 < a0[2]) % 9) != ((v2 == i3) ? (v0 / 4) : (v0 + 92)));
+                    v0 = (((87 == i3) ? (54 >= v1) : (v2 % 6)) <= ((v1 ? a1[2][15] : v1) ? (v2 > a1[3][7]) : (a1[0][7] >= v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[10] <= 15) > (v2 > v2)) != ((v1 <= v2) % 2))) {
+        v2 = (((a1[0][0] % 8) + (a0[12] || a1[1][6])) > ((20 < v1) + (69 != a0[3])));
+        a1[3][0] = (((v1 ? a0[8] : v1) ? (v3 ? v1 : a1[1][7]) : (a1[1][12] == v0)) != ((a0[14] >= a0[7]) ? (25 && 28) : (a0[3] < v0)));
+        v1 = (((a0[9] <= v1) >= (v2 < a1[3][4])) != ((v3 < v1) - (84 ? v1 : v1)));
+    } else {
+        a1[3][13] = (((28 <= v2) / 7) >= ((v0 > a1[2][2]) > (v3 + 4)));
+        a1[1][0] = (((v3 ? v3 : 64) != (v2 >= v1)) != ((v3 <= v2) != (a0[9] >= 39)));
+        v1 = (((66 ? 13 : 5) > (56 * v0)) != ((v1 == 68) ? (3 == v2) : (v3 == 10)));
+    }
+    return (((35 || a0[15]) >= (v3 > v1)) + ((97 < v2) < (v3 || v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,117 @@
+int f0() {
+    int v0 = 90;
+    int v1 = 14;
+    int v2 = 9;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                a0[1] = (((i1 + 27) / 3) < ((73 || 94) ? (v3 - v1) : (a0[8] >= v0)));
+                a0[3] = (((21 % 5) || (i0 && a1[0][12])) * ((i1 / 4) < (a0[2] < 55)));
+                v0 = (((67 < i0) < (73 < v3)) % 4);
+            }
+            v0 = (((i0 / 3) + (a0[15] + a0[8])) != ((v0 == i0) != (v2 <= v2)));
+            v0 = (((i0 >= v0) < (v3 - 11)) * ((v2 ? 79 : a0[9]) >= (a0[11] - 61)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    a1[0][4] = (((v2 < v0) ? (v1 % 5) : (v2 / 3)) / 1);
+    a0[0] = (((45 + 78) % 9) ? ((a0[11] / 3) >= (36 ? 63 : v3)) : ((a1[1][8] / 3) == (v1 >= a1[3][3])));
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a0[7] / 7) || (i2 < a0[8])) > ((a1[0][14] / 1) > (64 + 93)));
+            a1[3][10] = (((47 == v0) / 7) % 6);
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    if ((1 != 73) > 91) break;
+                    v3 = (((12 + a0[2]) >= (a0[9] - a0[8])) && ((i3 > 34) < (41 % 1)));
+                    v1 = (((49 + v0) && (a0[3] && v3)) * ((74 != v0) <= (v2 <= i3)));
+                    a0[3] = (((v3 - a1[1][15]) + (v0 ? v2 : v1)) && ((v3 * 53) && (49 % 1)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[3] = (((74 >= a1[1][10]) - (56 * v0)) ? ((i4 % 2) % 6) : ((a0[13] > a1[0][8]) <= (79 >= v0)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v3 = (((a1[1][14] >= 54) ? (i4 != 56) : (i4 * 24)) * ((a0[0] % 1) + (v0 >= 81)));
+                    v0 = (((v0 / 5) >= (i4 < 6)) != ((a1[2][4] - 22) + (73 + a0[4])));
+                    v3 = (((a1[2][1] == v3) > (58 >= v1)) ? ((18 == v1) == (a1[1][10] && i4)) : ((41 * 5) != (i5 + a1[1][13])));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((a0[10] + a0[3]) && (a1[3][15] || 3)) > ((59 < v2) * (i4 <= v3)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((63 ? a0[14] : v1) ? (33 % 8) : (a0[5] == 28)) * ((v1 && v3) ? (v2 + a0[13]) : (34 + a1[0][6])));
+}
+int f1() {
+    int v0 = 88;
+    int v1 = 96;
+    int v2 = 17;
+    int v3 = 58;
+    int a0[16];
+    int a1[4][16];
+    if ((((31 == 23) != (a1[1][15] + v3)) != ((47 || 10) == (v0 ? 36 : a1[0][4])))) {
+        v2 = (((v1 > 78) == (a0[14] || a1[2][13])) < ((77 < v3) + (v1 == 80)));
+        a1[1][14] = (((v3 < v0) || (a0[14] ? v2 : v1)) <= ((a1[0][14] + v2) + (a0[2] >= 36)));
+        v0 = (((v2 || 27) ? (v2 && a0[10]) : (a0[1] % 6)) + ((27 >= v1) != (v2 > v2)));
+    } else {
+        v3 = (((v2 > v0) ? (a1[2][11] - v2) : (a0[10] == v3)) && ((v3 > 33) ? (91 >= v3) : (v2 % 1)));
+        v0 = (((v3 >= a0[10]) <= (v1 / 1)) + ((v1 + v1) - (v2 <= v1)));
+        v1 = (((63 % 4) >= (0 < a0[10])) > ((a0[15] > a1[2][2]) / 5));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[1][6] = (((92 >= a1[2][1]) != (a0[13] < v1)) + ((a0[2] == a0[2]) ? (v3 == i0) : (a0[7] < i0)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    if ((v0 == v2) > 53) break;
+                    v3 = (((i1 / 7) >= (v3 + v0)) > ((v2 >= a0[3]) || (v3 <= a0[11])));
+                    a0[11] = (((v1 ? v2 : a0[14]) && (30 % 4)) % 7);
+                    v1 = (((v2 != 6) % 9) % 7);
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((42 ? v2 : v2) * (i0 > 83)) - ((v0 / 4) && (a1[1][10] == v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[1][13] = (((89 ? a1[1][4] : v2) == (96 % 6)) < ((v0 / 7) - (v2 / 4)));
+            a1[3][10] = (((72 > v0) != (a0[8] <= v3)) + ((75 / 3) && (v1 ? v3 : v1)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v1 = (((v2 == a1[0][8]) ? (v0 != v2) : (v2 * a1[0][5])) >= ((55 != 9) && (i3 >= i3)));
+                    v1 = (((a1[0][12] != v1) <= (a0[3] > i3)) < ((a0[5] >= v2) * (i3 > i3)));
+                    v2 = (((i2 / 9) > (a1[3][9] / 7)) - ((i2 ? 99 : i2) < (a1[0][13] >= 72)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    v3 = (((96 || a1[3][14]) <= (v1 || v0)) * ((v2 ? v2 : a0[7]) < (a1[0][3] ? a1[3][15] : v0)));
+    a0[3] = (((v2 ? a0[8] : 35) / 3) + ((36 % 2) + (v3 * 55)));
+    return (((a1[3][5] % 1) && (v3 ? a1[0][1] : v3)) != ((a0[13] == a0[12]) % 7));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,168 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 73;
+    int v2 = 73;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((a1[0][9] ? a1[3][0] : 26) > 94) break;
+        v1 = (((v3 % 7) && (v3 && v1)) % 6);
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            v2 = (((i0 || v1) && (i1 + v1)) / 2);
+            v1 = (((i0 ? v3 : a1[3][13]) || (a0[4] + 62)) ? ((v2 * i0) == (39 ? v2 : v3)) : ((a1[0][12] < a0[4]) + (v0 > i0)));
+            v3 = (((71 / 1) && (a1[1][5] / 5)) - ((i1 == 98) - (i1 <= a0[11])));
+        }
+        a1[3][12] = (((9 < v0) ? (67 != 31) : (94 ? v2 : 7)) < ((v0 > a0[7]) && (a1[0][15] % 8)));
+    }
+    a0[8] = (((a1[1][10] < a0[3]) * (13 / 6)) != ((v3 == a0[6]) < (4 || a1[2][4])));
+    if ((((v3 && v3) > (v1 != 67)) % 2)) {
+        a0[1] = (((v2 == v1) / 2) * ((15 == v3) != (21 >= v3)));
+        v3 = (((v0 <= v2) <= (a1[2][14] < a1[0][7])) < ((11 ? v0 : v2) ? (92 ? a1[2][8] : 68) : (v0 <= v0)));
+        a0[10] = (((v1 != v2) % 1) + ((v3 && v3) + (78 % 2)));
+    } else {
+        v3 = (((v2 == v2) && (v2 ? v1 : a1[2][2])) ? ((40 <= v2) == (a1[1][6] * a1[2][14])) : ((v3 <= a1[3][2]) == (v2 == a1[1][12])));
+        v1 = (((v2 < v3) * (v0 % 9)) / 1);
+        v0 = (((52 % 9) <= (42 - v3)) ? ((a1[0][1] < v2) * (v1 / 2)) : ((v2 * a0[1]) ? (70 > 44) : (v0 * 8)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 + 40) > 90) break;
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a1[0][5] = (((v3 && 14) && (a0[14] * i2)) ? ((v2 || 34) / 1) : ((a0[4] < a0[7]) != (a0[7] != a1[2][3])));
+                v0 = (((a1[2][12] ? 84 : a1[1][14]) % 5) <= ((i3 * 98) < (a0[7] != i3)));
+                v3 = (((i3 ? a1[0][2] : i2) != (i3 + i3)) == ((a1[1][14] > a1[3][2]) >= (a0[6] == v1)));
+            }
+            a1[1][7] = (((v1 || 9) >= (v1 != v3)) && ((v0 % 5) < (v1 != 81)));
+            a1[1][5] = (((a0[6] ? v0 : v0) ? (v3 || a1[0][3]) : (a0[2] + a1[2][7])) != ((40 > 2) % 4));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v3 = (((v0 % 5) || (v1 > v3)) / 4);
+    return (((31 != 87) % 7) - ((58 + 65) || (v1 != a1[1][8])));
+}
+int f1() {
+    int v0 = 30;
+    int v1 = 86;
+    int v2 = 41;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 + a0[8]) && (v0 <= a1[0][6])) ? ((13 != v3) || (v1 * 71)) : ((a0[15] == 60) == (v2 != a1[0][11])))) {
+        a0[2] = (((v3 + v2) % 4) / 8);
+        v1 = (((a1[3][3] != v2) < (v1 == v3)) / 5);
+        a1[2][14] = (((a1[3][4] || 89) != (v3 * a1[3][10])) ? ((a1[1][8] > v2) + (50 - a1[1][13])) : ((3 ? v1 : a1[2][15]) * (v1 + a1[0][11])));
+    } else {
+        v1 = (((v3 % 2) != (v1 > a1[1][8])) - ((v1 ? v0 : 79) % 1));
+        v0 = (((v2 != v0) ? (v1 >= 32) : (55 == a1[2][2])) % 5);
+        v3 = (((v2 <= v3) && (50 < v2)) > ((0 <= v3) >= (v2 / 4)));
+    }
+    if ((((v3 <= v3) == (a0[10] != v2)) % 1)) {
+        v3 = (((v0 <= a0[15]) > (v0 ? v0 : v3)) && ((v3 ? a0[12] : a1[0][6]) <= (a0[12] / 9)));
+        v1 = (((49 == 91) >= (a0[2] >= v2)) != ((a1[2][6] / 9) + (v1 > a0[4])));
+        v3 = (((a1[2][5] ? 72 : v0) || (v1 - v2)) < ((v3 / 5) * (37 ? a0[8] : a1[1][8])));
+    } else {
+        v2 = (((a1[0][11] - a0[1]) + (v0 % 9)) - ((v0 + v1) >= (v3 >= v2)));
+        v0 = (((v0 ? a1[1][1] : v0) == (v0 ? a0[9] : v2)) * ((a1[1][0] / 6) >= (v3 != a0[12])));
+        a0[13] = (((43 / 5) + (58 > v2)) + ((a1[2][2] && a1[2][3]) && (a0[4] > v3)));
+    }
+    v1 = (((v2 + a1[1][9]) / 5) >= ((a0[8] > 72) * (15 < v0)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v1 <= i0) > (v3 && 90)) - ((a0[14] + v3) * (v1 % 4)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v3 = (((i1 < v0) > (a0[5] && v1)) > ((7 / 8) <= (1 >= a1[0][13])));
+                    a0[5] = (((v3 > v3) - (v3 >= a0[5])) < ((i0 - 36) ? (a0[9] - 74) : (i0 + a0[9])));
+                    a1[1][12] = (((v3 * v1) != (94 || a1[3][2])) ? ((a1[1][7] * a0[2]) ? (v1 && a0[9]) : (v2 || 93)) : ((i0 <= 87) / 7));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[10] = (((v1 - v2) + (a0[11] >= 90)) >= ((a1[2][14] - 50) == (v0 <= v3)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((a1[2][10] || 75) ? (5 > 88) : (10 == 22)) / 5)) {
+        a1[0][4] = (((a0[8] > v1) % 6) != ((a0[7] ? a0[13] : v1) || (a1[2][7] >= a0[14])));
+        v0 = (((v3 - a1[1][13]) || (v2 >= v3)) * ((v3 - a1[2][0]) % 4));
+        v0 = (((8 ? 2 : v3) - (v2 < v1)) - ((43 ? v0 : a0[1]) + (a1[0][0] / 6)));
+    } else {
+        v0 = (((a1[1][9] >= v3) + (v3 / 7)) % 6);
+        v1 = (((v2 > 88) % 6) < ((a0[9] * 35) == (v3 ? v2 : 25)));
+        a1[1][1] = (((v0 * v3) ? (a0[13] ? a1[3][5] : 63) : (v2 || v0)) > ((v3 <= v2) && (v2 < 3)));
+    }
+    return (((v0 && v2) != (52 > a1[1][5])) ? ((a0[2] >= 64) <= (v3 && 45)) : ((v0 && a0[7]) - (37 * a1[0][14])));
+}
+int f2() {
+    int v0 = 13;
+    int v1 = 22;
+    int v2 = 60;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        if ((v3 ? a1[1][15] : a0[8]) > 97) break;
+        {
+            int i1 = 0;
+            do {
+                v2 = (((v2 >= i1) - (v0 - v2)) >= ((a1[3][4] / 6) / 9));
+                v1 = (((v0 ? v3 : 34) && (99 - v0)) == ((19 && i1) ? (v3 > a1[3][10]) : (v2 && a0[6])));
+                v3 = (((a1[3][13] / 9) + (v3 || 84)) / 9);
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        v1 = (((v2 / 4) ? (71 * v2) : (81 != v0)) && ((94 >= a1[1][0]) + (v2 + i0)));
+        v0 = (((v1 + a0[15]) + (a1[0][10] ? 28 : 98)) != ((v3 && v0) + (a0[12] != v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a1[0][0] = (((a0[9] && a0[7]) ? (i2 == 55) : (68 + v3)) % 8);
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v3 = (((v0 - v2) - (v0 == v1)) < ((a0[6] / 7) == (a0[14] ? 98 : v3)));
+                v1 = (((v2 ? v1 : v1) * (v3 ? a1[0][15] : 35)) || ((98 != 63) * (v1 >= i3)));
+                v3 = (((i2 != v3) >= (66 / 1)) || ((81 < i2) >= (v2 && v2)));
+            }
+            a1[2][8] = (((v3 ? v2 : v2) > (96 * 69)) >= ((99 != a0[8]) > (v1 / 7)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v3 = (((a0[3] * v3) || (v3 >= v0)) > ((a0[3] % 9) / 8));
+                v0 = (((v1 + v3) ? (a0[3] / 3) : (v2 ? i4 : v0)) == ((v2 * v3) > (a1[0][8] / 4)));
+                v2 = (((i5 > v2) != (4 <= v1)) - ((v0 == 69) < (2 < a1[2][9])));
+            }
+            a1[1][14] = (((a1[1][13] || 77) - (1 && 84)) && ((35 * 25) > (v3 ? v1 : a1[2][14])));
+            a0[15] = (((v3 % 2) == (v1 && v3)) % 9);
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v2 = (((v0 / 8) != (v3 - v2)) || ((v1 + i6) && (34 / 6)));
+                    v3 = (((a1[1][1] ? a1[1][7] : i6) >= (37 ? 54 : a0[4])) > ((v0 - i7) > (i6 != a1[1][12])));
+                    v0 = (((a1[3][5] + i7) < (v3 * a1[1][11])) % 9);
+                    i7 = i7 + 1;
+                }
+            }
+            a1[2][2] = (((v2 + v3) / 7) + ((48 > i6) * (v3 > v3)));
+            v0 = (((v0 || v3) && (i6 || v1)) < ((a1[0][10] ? 16 : v3) - (v2 + a1[1][8])));
+            i6 = i6 + 1;
+        }
+    }
+    a0[3] = (((v1 == v2) < (96 ? a1[3][13] : a0[6])) ? ((6 < 62) ? (v2 - 55) : (a1[0][1] && a1[3][8])) : ((a1[3][3] >= v0) && (v3 == v1)));
+    return (((v1 && 47) && (v1 - 84)) * ((v0 != v0) / 2));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,73 @@
+int f0() {
+    int v0 = 96;
+    int v1 = 28;
+    int v2 = 72;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[2][3] = (((12 != v2) > (a0[6] == v3)) + ((95 >= 34) < (96 != a0[13])));
+            v0 = (((v0 == v3) && (i0 - i0)) >= ((i0 == a0[13]) && (i0 / 8)));
+            {
+                int i1 = 0;
+                do {
+                    a1[0][3] = (((i1 ? a0[6] : i1) % 9) != ((a1[2][4] - a0[4]) >= (a1[0][15] ? 25 : v0)));
+                    v1 = (((v3 || i1) > (v3 && 33)) > ((22 == 6) == (v1 ? v3 : 82)));
+                    a1[3][6] = (((30 < v1) * (91 >= 1)) == ((37 || a1[0][12]) >= (v0 / 9)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    a0[8] = (((v3 > v2) > (93 <= a1[3][8])) % 6);
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a0[7] % 4) / 3) + ((v0 < i3) <= (i2 / 6)));
+                    v3 = (((v3 < v3) < (36 == a1[2][2])) <= ((i2 >= a1[2][1]) <= (a1[1][7] <= i2)));
+                    v2 = (((v1 || a0[15]) ? (93 + 90) : (v0 && v1)) == ((a0[0] ? a0[1] : a1[1][9]) || (40 || 94)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v0 = (((v1 / 3) + (a1[0][5] - v2)) ? ((94 % 8) % 5) : ((v2 % 1) ? (5 ? v2 : v2) : (60 && a1[3][4])));
+            a1[1][6] = (((i2 <= a1[3][9]) > (a1[3][5] < i2)) <= ((a1[1][8] == i2) + (v1 == v2)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((a1[3][13] || 18) ? (v2 >= 93) : (v1 || 93)) + ((v1 % 1) <= (31 / 8)))) {
+        v0 = (((3 >= v2) < (v1 || v3)) || ((v0 % 1) || (v2 != 9)));
+        v1 = (((a0[13] * a0[9]) != (v1 != v1)) >= ((v2 + 69) == (v0 / 6)));
+        v0 = (((a1[2][8] && 12) * (a1[3][5] <= a1[3][13])) + ((10 && v2) != (a1[0][10] / 7)));
+    } else {
+        v3 = (((68 < v0) == (v2 - v3)) || ((v1 <= 43) || (v0 == 92)));
+        a1[2][9] = (((v1 % 2) ? (3 < v1) : (v0 - 44)) - ((v1 || v3) < (a1[2][2] == 8)));
+        v0 = (((a0[15] >= 33) * (a1[3][1] * a0[1])) <= ((v2 ? 31 : v2) / 3));
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[0][9] = (((a1[0][1] % 6) / 9) < ((v0 >= 69) || (v0 - 94)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v3 = (((v3 % 9) + (v2 == v0)) - ((a1[0][8] <= v2) / 3));
+                    v1 = (((57 || v2) <= (a0[11] % 9)) % 8);
+                    v0 = (((a1[3][5] - v0) <= (v1 ? 15 : a1[3][12])) < ((v3 - a1[2][2]) ? (a0[3] >= 36) : (v3 >= 37)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v2 ? 71 : 38) < (v2 != a0[10])) < ((98 || a0[13]) || (17 && v2)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v3 ? 85 : v3) || (v1 <= v3)) >= ((v0 <= a0[7]) ? (a1[3][2] % 8) : (v3 ? a0[0] : v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,129 @@
+int f0() {
+    int v0 = 36;
+    int v1 = 30;
+    int v2 = 51;
+    int v3 = 62;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v0 = (((a0[15] != a0[5]) < (v2 ? a0[0] : v3)) && ((i0 == 40) > (21 - 48)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                a1[0][4] = (((a1[3][2] == a1[2][12]) ? (v0 + i0) : (v2 <= v0)) || ((15 / 2) ? (v2 ? 91 : 97) : (i0 - 58)));
+                a0[5] = (((v1 ? v3 : v2) / 2) && ((i1 != i1) >= (a1[1][12] + 12)));
+                v2 = (((i0 - 62) % 2) + ((v1 < v0) ? (i0 != v2) : (v2 > a0[1])));
+            }
+            a0[9] = (((23 || v0) > (a0[11] - v0)) == ((60 ? i0 : v0) && (a0[6] - a1[0][11])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 - a1[0][13]) / 5) % 2)) {
+        a1[1][2] = (((a1[1][13] - v0) || (50 >= 87)) * ((v3 > v3) ? (v1 ? v1 : 90) : (a1[2][10] / 2)));
+        a0[10] = (((28 % 7) == (v1 + a0[14])) / 7);
+        a1[3][13] = (((88 == a1[1][6]) >= (v1 - 11)) ? ((45 + v3) + (51 == v0)) : ((a1[2][6] % 5) || (v2 >= a1[1][9])));
+    } else {
+        a0[6] = (((v3 != v3) && (a0[0] <= v3)) < ((45 > a0[4]) || (a1[2][8] <= v2)));
+        a1[3][9] = (((a0[5] && 97) + (83 != a0[11])) ? ((v2 * 47) / 5) : ((v0 + a1[1][11]) <= (v3 % 6)));
+        v3 = (((74 <= a1[3][2]) ? (v2 % 7) : (16 && a0[9])) - ((v3 * a1[3][3]) / 7));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a1[1][2] = (((v1 != a0[0]) > (a1[1][2] < a1[0][7])) <= ((a1[0][10] * a1[1][13]) == (a1[1][13] || a0[4])));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            v2 = (((a1[3][4] && a0[9]) ? (61 ? i3 : 24) : (v2 >= a1[3][3])) ? ((12 != i2) > (16 == 34)) : ((v1 / 8) == (98 && i3)));
+            v2 = (((60 / 6) - (a1[1][15] / 6)) && ((i2 <= v1) * (i2 + 63)));
+            v0 = (((a0[13] * 12) == (a1[0][3] - 75)) != ((v2 == 39) * (v3 && v1)));
+        }
+        v2 = (((a1[3][0] < v3) ? (v2 == v0) : (a0[0] <= i2)) && ((v0 / 3) ? (v3 - 21) : (v2 > a0[3])));
+    }
+    if ((((v1 < 44) || (71 + v0)) == ((24 && a0[12]) * (v3 >= v0)))) {
+        v0 = (((a1[3][1] && a0[7]) != (88 != a1[2][8])) > ((49 - 52) ? (v1 && 13) : (71 <= a0[11])));
+        v0 = (((v3 * v2) ? (91 - v0) : (82 - v0)) > ((v2 ? v3 : a0[9]) && (v3 <= v1)));
+        v3 = (((a1[3][3] < a1[3][6]) ? (41 > a0[10]) : (v1 / 5)) != ((v0 ? 47 : v1) == (a0[13] ? v2 : v2)));
+    } else {
+        a1[0][10] = (((2 ? v0 : v3) + (v1 < 0)) < ((v1 == v3) - (v0 || v1)));
+        v2 = (((a0[11] ? v1 : 37) && (v2 >= a1[1][6])) / 5);
+        v2 = (((a1[2][13] * a1[1][8]) ? (63 - v3) : (a1[0][13] != v0)) || ((91 ? a1[0][0] : v2) + (a0[13] < v3)));
+    }
+    if ((((v1 - 53) > (v3 == v1)) ? ((v0 % 3) > (a0[13] < v2)) : ((a1[0][15] * v2) > (v3 - v2)))) {
+        v2 = (((67 >= v0) < (v3 || v3)) % 5);
+        a1[2][2] = (((77 == 98) - (75 ? 55 : 76)) == ((14 || v0) ? (v2 && 44) : (24 && v2)));
+        v1 = (((v0 % 2) || (21 + v3)) || ((v2 * a0[8]) == (a1[1][1] % 4)));
+    } else {
+        v0 = (((v3 || 84) % 2) >= ((34 >= v2) ? (54 == v1) : (v3 <= 2)));
+        a0[13] = (((v3 ? 94 : v1) >= (a0[8] <= v2)) || ((v3 || v0) % 3));
+        v2 = (((v0 <= v0) / 8) && ((v3 == v1) || (a0[0] != v0)));
+    }
+    return (((21 == v1) ? (a0[4] != 3) : (a1[1][11] == v3)) && ((v0 <= v2) != (v1 ? 36 : 82)));
+}
+int f1() {
+    int v0 = 35;
+    int v1 = 9;
+    int v2 = 9;
+    int v3 = 48;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v0 = (((v3 >= a0[14]) % 8) ? ((a0[9] % 1) == (v1 ? 32 : 55)) : ((i0 > v1) + (v0 / 6)));
+        {
+            int i1 = 0;
+            do {
+                a0[11] = (((7 % 5) >= (75 > i0)) ? ((a1[1][14] < 15) == (v0 + i0)) : ((a1[0][8] < v3) + (v1 == a0[13])));
+                v1 = (((v0 + i1) <= (44 ? v2 : a1[1][11])) && ((a1[3][9] ? i1 : a1[3][5]) ? (68 == a0[3]) : (8 <= a1[0][6])));
+                v1 = (((v1 == a0[0]) < (94 || a1[0][10])) >= ((91 <= a0[13]) ? (v0 * 72) : (v2 - v0)));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        a1[2][15] = (((v0 != i0) <= (v2 ? v0 : v2)) && ((v2 ? a1[3][11] : a1[1][2]) ? (a0[9] || v3) : (a0[6] > v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 ? v3 : a0[0]) > 98) break;
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v3 = (((a1[1][1] / 7) || (a0[12] < 46)) == ((v1 % 8) + (v0 >= a1[2][15])));
+                    a1[0][10] = (((a0[0] > a1[2][13]) >= (v2 && a1[1][13])) == ((a1[0][6] * i3) < (v3 || v3)));
+                    v3 = (((v1 >= 64) + (90 + v2)) != ((a1[3][15] != a1[2][11]) < (81 / 2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((i2 + v3) * (a0[9] - 28)) - ((v2 - a1[3][14]) >= (v1 && v3)));
+            a0[13] = (((v3 < v3) || (72 ? 94 : 40)) ? ((96 - i2) != (v2 ? v2 : 40)) : ((v2 + v0) < (v0 * a0[5])));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((v2 || a1[1][15]) ? (v0 + a0[0]) : (a1[2][5] && a0[15])) != ((46 + a1[2][15]) <= (v3 % 9)))) {
+        v0 = (((v1 - 39) != (a1[2][0] + v3)) % 2);
+        v3 = (((a1[2][0] >= 45) + (v2 - v3)) < ((a0[7] == v0) % 6));
+        v0 = (((a0[15] != v2) == (a1[2][8] || v3)) && ((a0[4] ? v2 : v3) != (a1[2][7] && v0)));
+    } else {
+        v3 = (((v0 == v0) >= (a0[8] * a1[2][2])) || ((a1[2][13] < a0[1]) && (a0[4] >= v1)));
+        v2 = (((43 / 5) / 1) <= ((v0 <= a1[0][7]) ? (61 % 1) : (6 == a1[3][10])));
+        v2 = (((a1[1][14] != v1) || (1 - v2)) == ((v0 % 6) == (a1[1][4] == 10)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((v1 % 4) > 84) break;
+        v1 = (((85 >= 21) - (a1[3][6] ? 25 : a1[3][13])) ? ((56 % 6) <= (78 == a0[7])) : ((47 ? 63 : v2) * (a0[8] || v0)));
+        v0 = (((25 == v0) && (24 % 6)) != ((v3 * a1[1][9]) != (a0[13] - 69)));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v3 = (((14 >= v3) != (v1 % 5)) < ((a1[3][12] % 7) - (41 + 50)));
+            v1 = (((49 == i4) ? (i4 / 1) : (i5 < a1[2][0])) / 9);
+            v3 = (((i4 == v0) || (74 > 15)) ? ((i4 == a0[5]) * (a0[10] / 7)) : ((v0 <= 12) && (6 >= 77)));
+        }
+    }
+    if ((((v0 && v0) % 2) * ((a1[0][4] - a1[1][0]) * (v2 - v1)))) {
+        v0 = (((v1 - 29) == (v1 ? a0[7] : 10)) || ((18 + v3) || (v2 < v3)));
+        v3 = (((99 + v1) - (22 % 6)) > ((93 * v2) / 2));
+        a1[0][5] = (((50 % 4) && (v0 > v1)) + ((a1[2][5] || 35) || (v3 > v0)));
+    } else {
+        v2 = (((v0 * v3) - (v1 ? v3 : v1)) > ((a0[8] <= v1) || (v1 == v1)));
+        a0[14] = (((v1 * a1[2][13]) != (a1[1][5] * a0[7])) % 8);
+        v2 = (((v1 > a1[1][6]) % 7) ? ((v2 * v2) == (v1 * a1[2][8])) : ((88 != v2) ? (16 ? v3 : v3) : (v2 == v3)));
+    }
+    return (((v0 >= v0) == (v1 ? v1 : 14)) >= ((a1[1][7] && v0) && (v3 > 46)));
+}
+int main() {
+    return 0;
+}
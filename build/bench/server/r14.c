@@ -0,0 +1,158 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 29;
+    int v2 = 40;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    a1[1][15] = (((v1 * v1) >= (v3 != v2)) - ((v1 != 81) || (v2 || 58)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v3 + 85) ? (79 || 7) : (v0 * 82)) >= ((64 ? v2 : a0[13]) < (a0[8] >= v0)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((a1[2][7] && a0[7]) > 61) break;
+                    a1[0][11] = (((0 ? v2 : a0[0]) || (i0 || i0)) == ((a1[3][4] < a0[3]) ? (v2 == 46) : (18 <= i0)));
+                    v1 = (((a0[9] != a0[4]) + (a0[4] >= v2)) ? ((a1[2][12] < a0[15]) / 4) : ((i0 + 8) != (80 != v2)));
+                    v3 = (((a0[4] ? v3 : 80) != (i0 + 3)) < ((i1 > a1[1][1]) != (i0 - v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[5] = (((a0[9] >= v2) > (i0 <= 88)) < ((57 + v3) > (v2 || v2)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v3 = (((v0 ? a0[2] : v0) + (a0[6] / 1)) % 8);
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v3 = (((v0 == 32) + (i3 != a1[2][8])) * ((i3 <= 11) ? (22 - 66) : (40 < 1)));
+                    v3 = (((i3 / 3) ? (61 >= a1[3][0]) : (v0 || v3)) % 4);
+                    v3 = (((v3 ? 87 : a1[1][5]) * (i3 || i3)) >= ((i2 < v2) && (v0 + i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((v2 != a1[1][3]) < (a0[5] != v0)) >= ((6 <= v0) > (v2 || i2)));
+            i2 = i2 + 1;
+        }
+    }
+    a1[3][0] = (((v2 * v3) == (v3 > v3)) > ((a0[5] + v0) <= (70 < 57)));
+    v1 = (((a0[3] != a1[1][3]) != (v3 ? v0 : a1[0][6])) || ((v1 != a1[0][13]) != (v0 <= a1[1][15])));
+    return (((v2 >= v3) <= (v1 % 8)) || ((v1 && a0[8]) < (v0 != v1)));
+}
+int f1() {
+    int v0 = 61;
+    int v1 = 86;
+    int v2 = 14;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v3 = (((v1 % 2) < (i0 + 76)) > ((88 || 28) / 5));
+        a1[1][4] = (((v3 - v1) != (a0[14] / 4)) > ((i0 || v1) / 4));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                if ((v3 && a1[3][12]) > 52) break;
+                v0 = (((v2 - v1) >= (80 && i1)) > ((i0 >= i1) * (73 || v0)));
+                v2 = (((i0 % 4) ? (v1 < a1[1][11]) : (v3 / 2)) <= ((87 / 3) == (a1[1][13] < v3)));
+                a1[1][6] = (((79 * a0[9]) <= (26 != v3)) == ((v0 + v1) != (v2 + i0)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((27 >= v3) > 94) break;
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v3 = (((i3 <= a1[0][0]) == (v2 == v3)) < ((81 ? 5 : i3) % 8));
+            v1 = (((a1[1][7] < i3) > (i2 / 7)) && ((i3 != 59) && (85 + i3)));
+            v1 = (((v3 - v3) < (v2 == v2)) == ((v3 - a1[3][6]) < (i2 == a0[3])));
+        }
+        v3 = (((v0 * 40) < (13 <= a1[3][13])) && ((v2 * 4) == (v2 / 1)));
+        v0 = (((v2 > i2) / 5) ? ((81 * i2) >= (v2 ? a0[0] : i2)) : ((v1 && 27) >= (v0 || v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            a0[12] = (((a0[8] == a1[3][7]) || (v2 - 28)) > ((v1 ? a1[2][8] : v3) / 2));
+            {
+                int i5 = 0;
+                do {
+                    if ((v1 ? 46 : 88) > 86) break;
+                    v3 = (((85 % 8) <= (i5 * i5)) + ((v2 + i4) == (i4 / 7)));
+                    a0[2] = (((i4 + a0[12]) > (i5 || a0[9])) + ((v3 < 80) ? (v3 && i5) : (v2 < i4)));
+                    v2 = (((i4 ? v1 : v3) - (28 == v3)) != ((i4 > v3) ? (a0[6] <= v3) : (v1 && i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v1 = (((i4 && a1[3][12]) / 6) ? ((a0[0] && i4) <= (v3 * a0[6])) : ((v3 / 7) && (i4 - v0)));
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((50 % 5) < (a0[13] % 8)) * ((v0 >= 5) != (v0 ? v1 : 6)));
+    v1 = (((12 >= a0[8]) ? (v2 || a0[15]) : (v1 > v0)) < ((13 ? v2 : v2) <= (50 > v2)));
+    return (((49 / 1) && (45 / 1)) + ((v2 - v0) ? (v0 + v3) : (v1 == v3)));
+}
+int f2() {
+    int v0 = 85;
+    int v1 = 65;
+    int v2 = 55;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 < v0) % 3) != ((v1 ? a0[5] : v1) * (87 - a0[3])));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                if ((74 / 7) > 82) break;
+                v2 = (((66 || i1) * (27 == v3)) >= ((57 * i0) != (v1 ? v3 : v1)));
+                a1[3][2] = (((i0 ? a1[1][6] : v2) == (v1 > i0)) || ((a1[0][11] < i1) >= (a0[5] % 1)));
+                v0 = (((a0[7] == v3) >= (a0[7] == 8)) || ((v0 <= a1[3][2]) != (a1[1][2] * a0[3])));
+                i1 = i1 + 1;
+            }
+        }
+        a1[3][2] = (((a0[8] ? v0 : a0[9]) || (a1[1][4] < v1)) ? ((a0[7] <= a0[2]) > (i0 % 8)) : ((a0[5] / 5) < (83 == v3)));
+        v3 = (((a0[1] - v3) / 1) >= ((v1 ? a0[12] : i0) > (i0 != 41)));
+    }
+    if ((((v2 < 52) != (v3 && v3)) < ((a0[5] || v2) < (50 ? 27 : v2)))) {
+        v3 = (((v0 > v1) * (56 == v2)) * ((v1 < v0) || (a1[0][5] > a1[3][11])));
+        v0 = (((v3 * v0) * (v3 || v1)) <= ((v2 < 76) ? (v0 / 5) : (v3 != v2)));
+        v2 = (((40 > v3) || (a0[3] || v3)) % 3);
+    } else {
+        a1[1][9] = (((v2 == 39) && (v2 < 43)) != ((v2 != v0) < (a1[3][10] ? a0[5] : v0)));
+        v0 = (((v0 % 7) / 9) == ((12 < a1[0][0]) <= (v1 - 92)));
+        a0[4] = (((v0 ? v1 : v2) && (59 - a1[1][12])) >= ((v1 || v2) == (a1[0][15] - v3)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v2 = (((i3 <= 83) <= (a1[1][4] > 59)) > ((a0[8] * a0[1]) ? (v2 > i2) : (55 ? v2 : i3)));
+            v1 = (((26 + i2) >= (78 / 5)) > ((i2 && v3) <= (96 < 67)));
+            v2 = (((i2 % 8) % 1) % 7);
+        }
+        v3 = (((58 <= v3) == (50 ? i2 : a1[2][12])) && ((i2 * i2) && (a0[1] == 2)));
+        v0 = (((v3 + 14) <= (60 - v0)) ? ((v2 == a1[3][0]) ? (i2 % 7) : (27 ? v2 : v1)) : ((a1[2][8] % 9) != (a1[2][2] <= a1[1][7])));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        a1[2][11] = (((70 % 3) ? (i4 >= 68) : (v2 <= i4)) >= ((64 >= v0) || (v1 == a0[2])));
+        a1[1][3] = (((a1[1][5] > 81) > (30 && v1)) >= ((5 != a0[14]) / 3));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v2 = (((v3 == 16) > (v0 && v1)) < ((v0 != 59) <= (v2 ? v2 : 65)));
+            v3 = (((v3 ? a0[5] : v2) ? (a0[14] <= v1) : (77 % 5)) % 9);
+            a1[2][0] = (((v2 ? a1[3][15] : a0[14]) % 1) <= ((v2 >= v0) != (a0[15] ? i5 : i4)));
+        }
+    }
+    return (((42 / 4) ? (v0 > v2) : (33 && v2)) % 3);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,158 @@
+int f0() {
+    int v0 = 62;
+    int v1 = 73;
+    int v2 = 17;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((35 - a1[0][11]) ? (v3 + v0) : (a0[11] != 57)) / 9);
+    if ((((a1[0][7] >= v3) > (53 * v2)) / 1)) {
+        v2 = (((a0[5] ? v0 : v2) != (73 > 78)) ? ((v0 >= v3) >= (v1 != 76)) : ((a0[0] ? v2 : v0) + (v3 - v0)));
+        a1[1][12] = (((a1[2][8] ? a1[1][14] : v1) >= (v3 != 60)) == ((59 - v1) > (v2 % 8)));
+        v0 = (((a1[0][0] / 5) / 1) <= ((13 > v2) ? (41 < a0[11]) : (v3 < v1)));
+    } else {
+        a0[3] = (((v1 * v1) % 5) - ((v3 <= a1[2][2]) * (v1 ? 53 : 18)));
+        v2 = (((v3 > v1) && (43 ? v0 : v2)) ? ((v0 > a1[3][4]) * (v0 > v0)) : ((a0[0] + v3) ? (v3 && v1) : (50 != a0[1])));
+        v3 = (((42 ? v3 : v3) || (v1 || v2)) ? ((a1[1][1] <= v0) || (v2 ? 79 : 29)) : ((v2 ? v3 : 38) <= (9 > v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a1[0][9] = (((a0[12] / 7) > (v0 || 19)) * ((a0[15] == i0) + (v2 && v3)));
+            v0 = (((59 > a0[0]) % 6) % 3);
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v2 = (((v1 + i1) % 7) <= ((49 % 3) <= (23 <= v1)));
+                    v0 = (((a1[3][6] + i1) <= (v1 ? a0[12] : a0[3])) > ((i1 % 7) ? (11 || 65) : (20 % 5)));
+                    v0 = (((i1 == v1) && (v2 > v1)) * ((12 ? v2 : v1) ? (i1 / 8) : (v0 <= 95)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a0[4] = (((75 + a1[2][7]) + (i3 / 6)) <= ((v2 + v0) ? (a0[7] || i3) : (31 * i3)));
+                a1[0][5] = (((25 * v1) ? (v0 ? a0[6] : 23) : (a1[2][5] ? v1 : 68)) == ((84 ? 86 : v3) < (a0[12] * v1)));
+                a0[15] = (((23 >= 74) != (i2 < 91)) + ((37 % 9) && (i2 * a1[0][13])));
+            }
+            a0[3] = (((v2 <= v0) / 5) - ((a1[1][7] != a1[2][13]) && (i2 ? v0 : v2)));
+            a1[1][3] = (((99 > v1) % 1) ? ((a0[10] / 1) < (v0 < v0)) : ((v2 < 16) != (i2 - a0[6])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v3 = (((v0 / 5) || (a1[0][12] ? a1[0][0] : 39)) * ((a0[14] % 6) % 7));
+    return (((64 / 9) < (41 >= 15)) ? ((v2 / 6) || (a1[2][9] >= v2)) : ((v3 <= a0[8]) >= (v1 || v2)));
+}
+int f1() {
+    int v0 = 37;
+    int v1 = 50;
+    int v2 = 66;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v1 % 4) % 7) % 4);
+            v0 = (((i0 / 5) * (a0[4] == i0)) % 1);
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((i0 % 7) > 84) break;
+                a0[8] = (((94 != v3) % 1) ? ((v1 % 3) > (v1 <= v0)) : ((i0 ? 95 : a1[1][14]) && (v0 < v3)));
+                v1 = (((a1[1][1] || v2) - (v2 ? 58 : a0[8])) <= ((v2 < a1[3][9]) * (3 ? v3 : i0)));
+                a0[6] = (((i0 / 9) % 8) >= ((v1 * 79) >= (v0 / 4)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v2 = (((v0 - a1[3][7]) + (54 ? 99 : v0)) < ((v2 + v0) || (40 % 7)));
+    v0 = (((a1[2][1] ? v0 : v0) < (a1[0][7] * a1[1][7])) == ((a0[1] / 9) ? (a1[1][14] >= a1[1][6]) : (15 + v3)));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v2 < 40) * (i2 / 3)) ? ((a1[3][12] > i2) != (a0[1] * 31)) : ((19 < i3) <= (v2 + 19)));
+                    a0[8] = (((v2 == i2) * (v1 * i2)) < ((4 * 1) - (v3 - v1)));
+                    a1[0][5] = (((v3 / 4) > (61 / 7)) != ((v0 % 9) + (i3 ? 13 : i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            a1[3][15] = (((v3 - 11) >= (67 / 7)) >= ((a1[1][8] >= i2) * (17 && v0)));
+            v0 = (((a0[9] <= v0) * (v3 / 8)) / 6);
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((a0[9] == v1) && (a1[3][15] ? 33 : v1)) ? ((94 < v1) > (v0 ? v3 : v1)) : ((10 || a1[1][1]) / 2))) {
+        v1 = (((v3 * v1) >= (11 < v2)) / 8);
+        v0 = (((v1 == v1) % 8) > ((v2 <= v2) - (a0[10] ? a1[3][5] : v1)));
+        v2 = (((v1 != 82) * (41 > a0[6])) + ((v0 <= v2) == (40 <= v0)));
+    } else {
+        a0[9] = (((20 ? v1 : a1[2][6]) < (v3 % 2)) * ((v3 ? a0[15] : 95) + (v1 && v1)));
+        v1 = (((a1[3][8] != 28) ? (a0[5] && 89) : (0 == 81)) < ((v0 < v1) < (v2 - 37)));
+        v3 = (((a1[0][11] <= v0) < (a1[3][13] ? a1[0][5] : v0)) + ((a1[3][3] ? v1 : v3) * (v2 * 67)));
+    }
+    return (((v1 == v3) + (v2 < 75)) * ((v0 + v3) != (v1 || v1)));
+}
+int f2() {
+    int v0 = 82;
+    int v1 = 37;
+    int v2 = 78;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 ? 6 : 54) < (v0 - v3)) != ((53 >= a0[2]) ? (a1[3][9] * a0[9]) : (83 && a1[0][12])))) {
+        v1 = (((v1 > a0[15]) / 6) != ((38 ? v2 : 3) >= (95 < 17)));
+        a0[7] = (((99 < a1[3][13]) > (96 <= a1[2][2])) <= ((a0[2] > 72) + (a0[1] != 70)));
+        v2 = (((a1[1][6] == a1[2][7]) == (v3 / 6)) + ((v1 >= a1[0][1]) % 1));
+    } else {
+        a1[2][8] = (((39 != v2) + (59 + 67)) != ((v3 && 40) % 4));
+        v3 = (((3 / 1) == (v0 && 51)) || ((v3 <= 82) <= (v3 * a0[12])));
+        v0 = (((v0 && v0) || (a0[8] * 15)) || ((a1[3][7] <= a1[0][0]) - (v1 ? 3 : a1[3][8])));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v3 = (((a0[11] != v2) > (30 == v2)) != ((i0 || 93) && (v2 && v2)));
+            v0 = (((v2 != a1[3][10]) != (a0[8] * v3)) && ((a0[15] >= a1[0][7]) - (i0 < v3)));
+            v2 = (((a0[3] - v2) != (v1 != 12)) - ((a0[6] / 4) > (4 && a0[15])));
+        }
+        a0[9] = (((i0 ? v3 : 63) ? (v0 || 96) : (a1[3][3] || a0[12])) || ((v0 <= v0) >= (v0 + a1[1][14])));
+        a1[3][11] = (((47 * v2) * (a1[0][1] && v3)) % 6);
+    }
+    v2 = (((20 != v0) < (v2 < v0)) / 5);
+    if ((((v3 <= v0) / 8) && ((65 ? 88 : v0) >= (a1[0][11] + v3)))) {
+        a0[12] = (((a0[0] ? v2 : a0[5]) >= (v2 ? v2 : a1[1][8])) ? ((98 + v2) == (a1[2][14] || v0)) : ((v3 && a1[0][9]) == (v0 ? a0[1] : v3)));
+        v3 = (((87 ? v2 : v3) % 1) < ((a1[1][1] % 8) ? (v2 > v0) : (a1[1][1] / 7)));
+        v2 = (((v1 || 17) <= (12 % 7)) - ((a0[14] == v1) != (v3 + v2)));
+    } else {
+        v1 = (((v0 / 1) == (v2 - v2)) == ((a0[1] % 4) > (a1[0][0] != v1)));
+        v0 = (((a1[2][0] > v0) && (a1[0][3] * 74)) % 2);
+        a1[3][13] = (((v1 ? v1 : v0) <= (67 % 7)) % 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            {
+                int i3 = 0;
+                do {
+                    a1[0][12] = (((a0[8] ? 70 : a1[2][0]) < (v3 < v0)) != ((a0[0] <= 48) > (i2 && 29)));
+                    a0[10] = (((83 != v1) + (a0[3] ? v0 : a0[2])) / 7);
+                    v0 = (((32 || 65) * (0 > v3)) || ((v3 != i3) % 2));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v2 = (((a1[0][4] && a1[1][14]) % 3) != ((a1[1][11] ? 56 : v1) >= (i2 < 79)));
+            v0 = (((v0 * v3) % 4) - ((i2 != v2) * (79 || a0[13])));
+            i2 = i2 + 1;
+        }
+    }
+    return (((a1[1][7] || v2) == (73 <= v2)) >= ((v1 > v3) - (88 / 5)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,78 @@
+int f0() {
+    int v0 = 57;
+    int v1 = 5;
+    int v2 = 47;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((i0 / 6) > 99) break;
+        a0[6] = (((v1 != i0) || (v0 % 2)) % 6);
+        {
+            int i1 = 0;
+            do {
+                a1[0][4] = (((a1[2][8] <= 84) * (a1[3][0] && i1)) - ((a1[2][9] == i0) <= (i1 / 4)));
+                a0[13] = (((v2 * 95) == (i1 != a1[1][15])) <= ((86 <= v0) + (91 ? a0[14] : a1[0][15])));
+                a1[2][6] = (((i0 / 5) + (i1 ? v2 : a0[4])) * ((a0[11] > 77) / 6));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v1 = (((v1 <= 12) / 1) || ((9 == a0[11]) / 9));
+    }
+    if ((((86 % 6) < (v1 <= v0)) * ((v2 ? v1 : v0) != (a0[4] - v0)))) {
+        v1 = (((v1 - 12) - (v0 * v2)) != ((a1[0][15] || 9) ? (v3 - v0) : (39 <= 73)));
+        a0[0] = (((v1 > a1[3][6]) != (a0[1] - v1)) % 7);
+        v3 = (((21 <= v2) - (12 != v1)) < ((a0[5] != 81) ? (v0 != a1[3][7]) : (v3 + v1)));
+    } else {
+        a1[2][5] = (((a1[3][15] % 5) / 3) && ((a1[2][9] <= v2) < (a1[2][2] * a0[0])));
+        v2 = (((40 % 8) - (16 > v2)) == ((93 || v0) <= (v2 ? v3 : v3)));
+        v0 = (((66 + v3) ? (v3 == v2) : (9 != 76)) - ((v1 % 7) + (v0 ? 78 : v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v1 = (((a1[1][1] * v3) % 5) ? ((74 && v0) == (a1[1][10] != v1)) : ((v1 ? v3 : 76) >= (v0 && a1[0][14])));
+            v2 = (((v3 + 60) ? (v1 ? a0[0] : i2) : (v0 - v0)) * ((a1[2][11] ? a0[1] : v0) ? (31 - a1[0][7]) : (a0[6] - v2)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((65 % 9) == (a1[2][1] ? v1 : a0[0])) * ((a1[2][13] % 5) + (v0 % 4)));
+                    a0[12] = (((a0[15] >= 17) >= (a0[9] >= 8)) <= ((v1 || v0) / 8));
+                    v1 = (((a1[1][0] != v0) != (a0[8] % 6)) >= ((v0 ? v2 : i2) <= (22 > v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    v0 = (((v1 >= 44) / 6) >= ((v3 != v2) / 6));
+                    v0 = (((51 ? i5 : 74) ? (96 < v1) : (11 ? a0[10] : v3)) == ((a0[14] != i4) || (a0[11] <= i5)));
+                    v2 = (((9 % 6) != (i4 && a0[2])) >= ((v3 < i5) * (i4 ? 61 : v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[3][10] = (((a1[3][9] * 61) % 9) != ((v3 && 35) <= (a1[3][3] / 9)));
+            v3 = (((v3 + v0) == (a0[0] == i4)) * ((a0[3] > a0[14]) - (v1 < 69)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    if ((((v0 % 3) <= (v2 ? v3 : v0)) ? ((v0 / 8) <= (22 >= a1[2][1])) : ((a0[15] - v2) * (v0 < v0)))) {
+        v3 = (((41 != a1[0][13]) * (v3 || a1[2][6])) >= ((a1[0][14] <= v0) * (74 <= v1)));
+        a1[1][4] = (((v0 && a1[3][9]) && (72 == v2)) >= ((v2 ? v0 : v0) + (v1 % 4)));
+        v3 = (((v0 / 8) * (v2 * 27)) % 5);
+    } else {
+        v1 = (((57 >= v0) > (v0 / 5)) + ((v1 && 85) ? (a1[0][0] - a0[15]) : (v2 / 8)));
+        v3 = (((82 % 4) - (v3 <= v2)) ? ((v3 != 2) == (v3 - 38)) : ((v2 * 11) && (v3 > a0[6])));
+        v1 = (((a1[1][9] - v3) * (a1[1][1] * a0[2])) >= ((v0 % 7) != (v3 && 94)));
+    }
+    return (((a1[2][11] <= v1) * (v3 < v0)) && ((v3 ? v0 : 49) && (a1[2][8] || v2)));
+}
+int main() {
+    return 0;
+}
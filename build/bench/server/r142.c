@@ -0,0 +1,116 @@
+int f0() {
+    int v0 = 22;
+    int v1 = 9;
+    int v2 = 81;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 <= v1) - (a1[1][5] == v3)) && ((a0[10] == v1) ? (38 + 62) : (a0[12] + a0[13])))) {
+        v2 = (((v2 / 8) - (v1 ? v0 : a1[3][12])) % 1);
+        v3 = (((91 < a0[13]) / 7) != ((v2 * a1[2][2]) != (v2 == v3)));
+        a0[7] = (((52 ? v1 : v2) ? (a1[0][1] && v1) : (86 && v1)) / 9);
+    } else {
+        v2 = (((v1 <= 92) % 4) ? ((v1 + a1[1][11]) - (a0[7] + a0[2])) : ((17 != a0[10]) + (v1 / 4)));
+        a0[4] = (((v1 * 23) == (v2 * v2)) >= ((v1 % 3) - (v0 - v2)));
+        v0 = (((v0 + v0) <= (a0[8] < a0[7])) == ((15 || v0) + (v0 + 99)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                v2 = (((v2 < i1) / 8) % 9);
+                a1[2][3] = (((91 < i0) && (28 || v3)) < ((a1[0][1] && a0[14]) && (a1[0][14] > i1)));
+                v3 = (((83 <= i1) % 4) != ((i1 != 68) + (v2 < v1)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[11] = (((v0 - a1[0][15]) ? (46 % 2) : (a1[0][11] == v1)) != ((v0 > a0[9]) < (v3 == a0[4])));
+        v0 = (((v1 || i0) || (v1 > a0[10])) * ((v2 ? a1[3][3] : v0) ? (43 < 94) : (i0 % 6)));
+    }
+    a1[1][10] = (((a0[11] == a0[14]) - (v0 - v1)) == ((a0[5] == v1) - (v0 ? v0 : v0)));
+    v0 = (((v1 >= a0[0]) - (31 + v2)) >= ((76 == v0) > (39 == v0)));
+    if ((((v3 * a0[11]) <= (a1[3][10] && 65)) != ((a0[13] || a1[0][6]) % 4))) {
+        a1[1][6] = (((47 == a0[7]) >= (v3 <= v0)) < ((12 ? a0[5] : v2) - (a0[14] / 4)));
+        v0 = (((9 == 52) == (62 != v1)) || ((v1 >= v3) || (a0[8] ? a1[1][9] : a0[13])));
+        v2 = (((29 - v1) <= (v1 || v3)) / 2);
+    } else {
+        a0[8] = (((46 * 55) < (a0[10] ? 60 : a1[1][11])) == ((37 && v0) <= (a1[3][10] ? a1[2][7] : a0[1])));
+        v3 = (((v3 * v0) / 1) && ((v2 % 2) < (v0 ? 31 : 23)));
+        v1 = (((v3 ? v2 : a0[12]) + (v0 * v2)) / 7);
+    }
+    return (((88 > 50) || (v3 < v2)) == ((v2 && v3) && (a1[0][1] ? 58 : 29)));
+}
+int f1() {
+    int v0 = 75;
+    int v1 = 2;
+    int v2 = 23;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 >= v3) && (a0[1] + a1[1][10])) > ((v1 < a1[3][5]) && (v3 ? v3 : 89)))) {
+        v0 = (((v1 || a1[2][6]) ? (a0[3] / 6) : (a0[2] || v1)) < ((v0 == v3) <= (v1 ? v0 : v0)));
+        v1 = (((a0[13] <= a0[0]) > (v3 ? 86 : v0)) * ((a0[8] && a0[15]) && (44 - a1[0][11])));
+        a1[0][0] = (((a0[12] % 8) / 5) == ((37 >= v0) <= (a0[8] + v0)));
+    } else {
+        v3 = (((v2 / 3) != (63 / 5)) % 6);
+        v1 = (((v1 ? a1[3][6] : 12) + (v1 + 57)) + ((v1 % 6) >= (27 + 20)));
+        a1[0][14] = (((v0 > v0) != (v0 != v0)) < ((v0 * 76) % 3));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[2][10] = (((98 < i0) / 5) >= ((77 < v2) >= (v0 == v1)));
+            v2 = (((a0[14] > 70) <= (i0 / 1)) * ((i0 == a0[5]) >= (64 / 8)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((31 != i1) > 95) break;
+                v1 = (((v3 - a0[10]) ? (a1[0][14] < 1) : (i0 && i0)) && ((48 <= 38) - (v0 % 6)));
+                v0 = (((4 * 59) == (v0 / 6)) - ((27 && v3) <= (a0[8] == 75)));
+                v3 = (((v3 || 82) / 3) <= ((7 * v0) ? (a1[0][12] - a0[9]) : (a0[10] || v2)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v1 = (((a1[2][12] <= a0[10]) < (24 ? 15 : i3)) >= ((67 >= a1[0][13]) > (53 * 95)));
+                    v1 = (((55 * v3) * (84 || i2)) != ((v3 > 41) % 5));
+                    v0 = (((v1 * a0[8]) + (v1 == a1[0][7])) % 3);
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((a1[2][6] ? i2 : a0[8]) < (v3 <= 1)) + ((i2 / 2) ? (4 % 6) : (v1 && v2)));
+            v1 = (((a0[13] != v1) || (a0[14] || 69)) < ((v0 * v3) < (47 > 59)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v2 && a0[14]) && (v2 ? v2 : v1)) / 4)) {
+        a1[0][13] = (((a1[3][6] != v3) ? (68 == a0[0]) : (a1[2][8] <= v0)) == ((v3 == v0) * (v3 > a1[0][0])));
+        v1 = (((v1 >= a0[7]) && (v0 <= 22)) + ((42 ? v1 : a1[0][3]) ? (a0[0] % 2) : (v0 && a1[2][1])));
+        v2 = (((v2 || v2) && (a1[2][3] < v1)) ? ((8 != a0[11]) - (v2 / 1)) : ((a1[0][12] > v1) > (v3 || a0[3])));
+    } else {
+        v2 = (((v1 % 2) && (v0 * v0)) - ((a0[5] + v0) - (v0 ? a1[1][6] : v2)));
+        a0[2] = (((v0 - v3) == (v3 ? v2 : a1[3][8])) - ((v1 * a1[0][13]) != (20 - a0[2])));
+        v2 = (((v1 ? a1[0][14] : a1[2][9]) + (95 >= 77)) / 1);
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v3 = (((16 <= 49) ? (74 - a1[3][11]) : (v0 % 3)) || ((83 || v1) * (a0[3] != v1)));
+                a1[2][11] = (((v1 + 86) ? (v3 < v3) : (a0[8] || v3)) ? ((i5 != a0[10]) - (v0 / 7)) : ((v2 ? 71 : i5) || (26 / 7)));
+                v1 = (((v3 ? i5 : v2) + (87 >= 10)) < ((i4 != 89) >= (10 / 1)));
+            }
+            v3 = (((49 < 9) != (v1 / 7)) % 5);
+            v3 = (((v1 || v0) % 9) * ((v1 * a1[1][4]) % 1));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((a0[13] >= v3) > (v2 - a1[0][10])) == ((61 ? a1[2][4] : a1[0][9]) <= (66 >= a0[0])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,150 @@
+int f0() {
+    int v0 = 71;
+    int v1 = 76;
+    int v2 = 30;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 > a1[3][1]) <= (66 || v2)) == ((v1 == 18) > (v3 != v1)))) {
+        v2 = (((v3 % 7) > (v0 < v1)) - ((a0[4] == 25) * (a1[0][15] / 3)));
+        v0 = (((a1[0][0] != a0[3]) != (v2 < 11)) <= ((a0[7] > v0) ? (v0 == a0[3]) : (v0 > a1[3][15])));
+        v2 = (((v3 * v2) < (a1[0][4] <= v0)) || ((v1 < v3) + (v3 != v3)));
+    } else {
+        v3 = (((68 ? a0[2] : v1) * (v3 ? v0 : 19)) - ((v0 * v2) ? (v3 + v3) : (a0[7] && a0[7])));
+        v1 = (((v2 > v1) || (a1[1][6] < a1[2][1])) - ((75 || v3) % 7));
+        a1[3][0] = (((v0 % 6) - (a1[0][15] >= 86)) <= ((a1[1][6] <= v2) != (v3 % 9)));
+    }
+    a0[10] = (((21 > a0[0]) - (76 / 2)) / 5);
+    a0[5] = (((v3 - v0) ? (v2 || v1) : (a0[3] ? a1[2][12] : 99)) != ((a0[15] % 4) <= (v0 >= 62)));
+    a0[1] = (((4 && v3) < (a0[15] + v1)) && ((78 % 6) - (v2 <= v2)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v3 = (((a0[15] + a1[3][13]) * (80 <= v2)) / 9);
+                a0[9] = (((a0[5] ? 61 : v1) - (98 <= a1[1][15])) ? ((48 ? a0[1] : i0) > (v0 && a0[3])) : ((i1 != v2) != (a0[2] != v2)));
+                v2 = (((a1[2][9] < v2) != (v3 / 1)) * ((v1 ? i1 : v1) != (a0[4] * 74)));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((i0 == v2) != (i0 < v3)) && ((v3 % 7) - (a1[0][15] * v2)));
+        v2 = (((58 - v2) < (91 >= v0)) ? ((i0 * a1[2][8]) ? (a0[14] ? i0 : a0[11]) : (v2 && v2)) : ((v2 ? i0 : v2) && (a1[2][15] >= v2)));
+    }
+    return (((v1 && v1) == (a0[3] ? v2 : a1[1][0])) % 9);
+}
+int f1() {
+    int v0 = 53;
+    int v1 = 52;
+    int v2 = 69;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 == v0) != (v1 && a0[12])) < ((v0 * v1) % 4))) {
+        a1[2][5] = (((91 / 6) == (44 <= v1)) % 3);
+        v1 = (((v1 ? a1[1][6] : v1) && (v0 / 5)) * ((64 / 5) * (v3 % 8)));
+        a0[3] = (((a0[10] || v2) < (v0 > a1[3][2])) >= ((a0[1] || v1) % 2));
+    } else {
+        v3 = (((a1[1][8] ? a1[3][6] : v1) > (v0 <= v2)) || ((77 - a1[0][15]) % 3));
+        a1[0][1] = (((v0 > v3) < (a0[1] ? 50 : v0)) % 4);
+        v3 = (((a1[2][4] != v0) / 4) && ((35 / 1) >= (a0[1] / 7)));
+    }
+    v1 = (((51 + v3) && (a0[13] == v3)) != ((v2 % 1) >= (a0[5] ? 71 : 11)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((v3 >= i0) > 73) break;
+                a1[1][3] = (((35 % 5) - (a0[15] > v2)) || ((i1 < v0) / 3));
+                v2 = (((a0[8] % 2) % 8) < ((a1[2][14] - a1[2][8]) <= (a1[3][8] % 1)));
+                v1 = (((23 / 8) != (a1[0][10] + a0[2])) <= ((i0 > 47) + (v2 % 6)));
+            }
+            a1[3][12] = (((v0 && a1[2][6]) + (v3 <= v1)) % 6);
+            v0 = (((v3 && v0) ? (a0[5] + v1) : (a1[2][5] != a1[0][9])) && ((82 && v2) < (39 >= a1[3][8])));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v0 = (((v0 - v1) && (v3 && v3)) >= ((v0 * a1[0][4]) < (67 / 2)));
+            a0[7] = (((v3 ? 84 : 71) == (v1 / 5)) && ((v2 + a1[2][14]) && (25 == i2)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v3 = (((v0 > v0) / 6) != ((7 || i2) < (a1[2][7] ? v3 : 19)));
+                v2 = (((v3 != i2) > (v0 < a1[0][14])) || ((a0[8] || i3) && (64 % 6)));
+                a1[2][11] = (((a0[3] ? a1[3][7] : i2) >= (v2 != a1[0][2])) != ((i3 || 90) ? (v3 ? v2 : 11) : (41 < v2)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v0 * a1[2][12]) % 9) == ((19 != v1) ? (v2 * a1[1][10]) : (v1 >= 72)));
+    return (((v2 / 2) >= (v1 + 97)) - ((55 ? a1[3][7] : a1[2][2]) <= (a0[6] - 60)));
+}
+int f2() {
+    int v0 = 11;
+    int v1 = 62;
+    int v2 = 20;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v3 = (((v3 / 7) + (v1 % 4)) > ((32 < 49) + (56 != a1[1][5])));
+            v2 = (((v3 * 64) / 2) <= ((v2 || v1) <= (v2 > 52)));
+            {
+                int i1 = 0;
+                do {
+                    a1[1][12] = (((v1 * 4) || (a0[10] == v2)) * ((63 % 3) ? (a0[4] == v3) : (v1 - v0)));
+                    v2 = (((99 + i1) || (v3 <= i0)) >= ((v2 - i0) < (v2 > a1[1][11])));
+                    v0 = (((a0[14] * i0) - (i0 + v3)) < ((86 > a0[6]) > (16 && a0[11])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((38 && v3) != (a1[3][5] == 85)) > ((54 != 2) < (a1[0][2] ? a1[1][9] : 33)))) {
+        v0 = (((33 == a0[5]) == (v3 <= v0)) >= ((35 + v1) ? (v0 > 26) : (16 == 29)));
+        a1[1][2] = (((37 % 3) ? (a1[1][13] >= v3) : (30 - 66)) > ((v3 <= a0[0]) <= (v3 == 90)));
+        a1[2][0] = (((v1 % 1) ? (v3 != 1) : (a0[7] <= v1)) == ((a1[1][4] <= 28) * (36 - v0)));
+    } else {
+        v1 = (((a1[1][1] > v1) - (a1[1][6] % 7)) - ((v2 ? v0 : v2) || (v3 < 43)));
+        v1 = (((v0 < 22) + (a0[12] < v1)) % 8);
+        v3 = (((v3 >= a0[2]) ? (v3 <= 37) : (v1 * 66)) % 6);
+    }
+    if ((((a1[3][4] > v0) - (a1[3][7] - v3)) || ((23 <= a1[1][5]) < (v0 || a0[13])))) {
+        a1[1][6] = (((94 >= v3) > (v3 + v0)) + ((a0[6] + v3) ? (a0[10] != a1[3][6]) : (v1 % 7)));
+        a0[12] = (((a0[7] - v1) > (v1 % 1)) != ((46 + v3) <= (v3 >= v3)));
+        a1[3][13] = (((69 / 8) != (v2 ? v3 : v1)) == ((17 / 3) || (v1 ? v0 : 66)));
+    } else {
+        v3 = (((a0[2] < v0) && (45 == a1[0][8])) % 1);
+        v3 = (((3 >= v0) - (33 > v2)) || ((7 % 4) % 2));
+        v0 = (((a1[1][9] <= a0[0]) / 2) && ((v2 >= a1[2][5]) >= (v0 / 1)));
+    }
+    if ((((78 / 7) % 5) / 3)) {
+        v2 = (((a1[0][6] != a0[2]) * (a1[2][0] ? a1[2][4] : a0[5])) != ((v1 - 7) && (a0[4] >= v1)));
+        v0 = (((v3 >= v0) != (v0 ? 0 : v3)) < ((v3 >= v1) + (v3 && v3)));
+        a1[0][10] = (((a0[0] / 1) * (v1 && v3)) / 1);
+    } else {
+        v3 = (((v3 != 40) < (a1[2][13] ? v2 : a1[0][12])) * ((v3 < a0[10]) != (v0 || v3)));
+        a1[1][11] = (((19 ? v0 : a1[2][15]) ? (v1 / 2) : (a1[2][0] != 85)) < ((v2 < v1) <= (85 != a1[0][2])));
+        v3 = (((a1[1][13] || v2) * (v0 + a0[0])) && ((31 <= 58) - (51 - a0[11])));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v3 ? v3 : v3) != (v0 / 5)) - ((83 <= 26) != (a1[1][5] && i2)));
+            a0[6] = (((v2 * a0[6]) + (v3 && v0)) == ((v1 ? v3 : a0[0]) * (a1[0][0] + 39)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a0[2] = (((a1[2][5] > v2) || (v0 && 17)) * ((32 && a0[6]) % 1));
+                v0 = (((59 != v3) <= (v3 <= 44)) % 2);
+                a0[1] = (((v1 || v2) < (98 || i2)) % 8);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    return (((v0 && a0[13]) * (v1 - a1[2][7])) < ((v0 >= v0) < (v0 && v1)));
+}
+int main() {
+    return 0;
+}
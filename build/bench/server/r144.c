@@ -0,0 +1,82 @@
+int f0() {
+    int v0 = 25;
+    int v1 = 17;
+    int v2 = 30;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[5] <= v0) >= (89 == v3)) * ((v3 % 2) ? (v2 % 3) : (a0[7] - a0[2])))) {
+        v1 = (((a0[15] && v0) * (a0[8] != 17)) > ((v3 != 41) >= (a1[2][9] == v3)));
+        a0[5] = (((30 ? 33 : v2) != (a1[2][4] || v3)) - ((v3 && a0[11]) < (a1[2][9] * v3)));
+        v3 = (((80 ? 56 : v3) <= (9 ? v0 : a1[0][8])) % 8);
+    } else {
+        v3 = (((v1 && v0) - (v1 * a1[0][6])) / 7);
+        v2 = (((v0 ? a1[2][12] : 32) >= (v1 >= a1[0][7])) > ((68 ? 57 : 1) ? (v3 ? v2 : a0[13]) : (v0 + v2)));
+        v1 = (((81 ? 67 : v2) * (0 % 2)) % 8);
+    }
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v3 == v2) != (a1[3][2] % 8)) + ((v2 ? a0[6] : a0[10]) >= (i0 ? 87 : v1)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((a0[4] - v2) > 71) break;
+                v0 = (((i0 / 7) || (i0 ? v3 : 97)) == ((a0[13] != 7) > (a0[0] % 2)));
+                a0[7] = (((26 && 88) != (a1[0][13] * v3)) < ((i1 - i1) || (a1[3][10] >= v1)));
+                a0[14] = (((v2 < 75) && (v0 ? v1 : 30)) <= ((12 != i0) < (v3 ? a1[0][15] : v2)));
+            }
+            v2 = (((a0[7] != a1[0][11]) < (v2 > 15)) * ((i0 || v1) == (a1[3][14] + v2)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v2 = (((v2 * v3) && (v1 >= 41)) >= ((v1 / 9) && (35 - i2)));
+            v2 = (((v1 <= 95) <= (v1 >= 14)) >= ((a0[0] ? v2 : i2) < (1 ? a1[1][1] : i2)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((v3 * i2) > (a1[2][14] ? v3 : v2)) == ((v0 == a0[9]) + (a1[1][2] - v1)));
+                    v1 = (((25 <= v0) * (v2 < 7)) - ((v1 > a0[14]) >= (i3 + i2)));
+                    v0 = (((v0 ? a0[5] : v2) || (74 > 96)) + ((i3 >= i3) > (v2 * a1[1][8])));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((80 / 5) != (46 + 92)) + ((a0[3] / 7) > (a0[12] / 6)));
+                    v2 = (((7 == 17) && (55 >= 73)) > ((i4 <= v2) > (31 - i5)));
+                    v3 = (((v3 / 7) || (v0 * 88)) || ((18 == a0[14]) * (v2 ? v3 : v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v0 = (((v3 ? 20 : a1[1][15]) % 5) == ((v2 != v2) * (v2 < 70)));
+            v3 = (((53 < 96) < (24 == 85)) / 5);
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v1 = (((v0 == 20) ? (a1[1][14] - a1[2][7]) : (25 >= i6)) / 8);
+                v0 = (((a1[0][5] == v1) || (a1[0][4] ? v3 : i7)) - ((34 ? 28 : i7) < (55 * 62)));
+                v0 = (((v2 >= 11) == (v1 ? v2 : v1)) % 7);
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        a0[12] = (((a0[6] >= v2) || (a0[8] < 69)) - ((32 != 89) / 8));
+        a0[15] = (((v3 % 2) < (i6 / 2)) == ((21 % 3) || (v2 >= 5)));
+    }
+    return (((a1[1][12] > a0[10]) - (83 == a0[13])) || ((65 < 68) > (a0[9] < v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,151 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 22;
+    int v2 = 69;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((i0 * a0[6]) || (v3 + v3)) <= ((79 && v3) && (v1 >= 15)));
+            v2 = (((v3 / 1) > (2 - v0)) || ((v3 < 92) + (74 % 7)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((v1 <= a0[13]) || (i0 ? a1[1][10] : 11)) && ((a1[0][11] > a1[1][5]) < (59 == i0)));
+                    a0[4] = (((v1 > v3) * (a1[0][14] && a0[1])) ? ((v0 ? v3 : v1) * (i0 % 3)) : ((64 + a1[3][3]) < (i0 * 27)));
+                    a1[2][9] = (((a0[5] && v0) == (i0 == i0)) <= ((a1[0][0] > 16) || (i0 * v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v0 * v0) ? (v0 ? a0[14] : 65) : (v2 <= v3)) + ((v2 != i2) % 6));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v2 = (((i3 / 3) < (v1 || v1)) || ((i2 != 98) - (55 <= 15)));
+                a1[1][14] = (((45 <= a1[0][14]) <= (a1[1][11] >= v2)) >= ((i2 <= a1[3][4]) - (59 || v2)));
+                v1 = (((i2 == 78) != (a0[3] % 2)) ? ((i3 >= v0) || (i3 == v0)) : ((61 > i3) ? (v1 - 66) : (i3 < 71)));
+            }
+            v3 = (((v2 > a1[3][9]) % 8) != ((a0[6] == 8) / 3));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    a0[7] = (((35 ? a1[0][5] : a1[1][4]) || (a1[3][6] - v2)) % 8);
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((33 ? a0[5] : v0) > 51) break;
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    a1[1][6] = (((i4 != i4) - (55 ? v0 : i5)) != ((24 % 6) == (a1[2][3] % 6)));
+                    v1 = (((v0 % 4) == (64 ? v0 : a0[8])) / 5);
+                    a0[7] = (((v3 / 4) ? (v2 % 6) : (i4 ? v1 : v3)) + ((v0 - v2) * (i5 == v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v1 ? v1 : i4) - (v1 >= v0)) - ((a1[0][15] + v3) > (a0[9] / 9)));
+            v0 = (((v1 <= a0[13]) < (62 && a1[0][7])) > ((i4 % 2) ? (84 ? v3 : v0) : (74 ? 26 : i4)));
+            i4 = i4 + 1;
+        }
+    }
+    a1[2][15] = (((v3 > 93) % 1) == ((79 <= 45) < (a1[2][14] % 1)));
+    return (((a0[12] < 34) || (25 >= a0[0])) == ((62 < v1) > (v2 - a0[0])));
+}
+int f1() {
+    int v0 = 45;
+    int v1 = 89;
+    int v2 = 8;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((94 % 3) > 50) break;
+            v1 = (((v0 <= v1) == (16 && i0)) || ((58 + v3) - (58 < a1[0][15])));
+            a1[1][13] = (((a0[1] <= v0) <= (v0 % 1)) * ((v1 > v0) - (i0 != 29)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((a1[0][14] * i0) != (a1[3][3] <= i0)) ? ((a0[4] <= a1[1][12]) < (v1 ? a0[1] : v1)) : ((v0 || v3) != (7 % 9)));
+                v0 = (((a0[0] % 2) > (26 > i1)) ? ((19 > a0[11]) >= (v1 * i0)) : ((a0[5] && v0) / 7));
+                a0[5] = (((a1[2][1] - a1[3][2]) - (a0[5] <= a0[5])) * ((29 <= 47) / 1));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a1[1][15] ? a1[1][13] : i2) + (47 - 91)) > ((v2 > a1[0][5]) && (v0 - 70)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a0[10] = (((84 / 5) - (v1 / 1)) + ((v2 ? a1[3][14] : i3) - (i3 == 76)));
+                v3 = (((v1 >= i3) <= (v0 + 81)) % 5);
+                v3 = (((3 % 4) / 4) == ((a1[0][8] != a1[1][8]) >= (79 < i2)));
+            }
+            v3 = (((a0[2] && a0[12]) ? (a1[3][12] == a0[1]) : (a1[3][12] != v3)) ? ((v1 > 86) % 5) : ((i2 != 37) - (v2 || v1)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            a0[13] = (((77 == v0) * (v2 < a1[0][13])) ? ((v0 && i4) ? (57 ? a1[3][14] : 38) : (a1[1][11] != 81)) : ((i4 >= a0[8]) - (a1[1][6] != v2)));
+            {
+                int i5 = 0;
+                do {
+                    if ((i5 + i5) > 76) break;
+                    v2 = (((82 * 80) == (a1[2][10] * i5)) != ((a0[0] < 33) >= (v3 || 28)));
+                    a0[10] = (((v1 / 8) + (a1[3][11] / 5)) * ((a1[0][14] && a1[0][9]) % 2));
+                    v3 = (((i4 != 46) - (a1[3][6] == v0)) >= ((v2 >= v0) + (v3 > a1[2][10])));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v0 = (((v0 + a0[4]) < (a0[11] < v1)) >= ((83 ? 80 : v3) - (v3 % 4)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            v3 = (((v3 ? a0[15] : a1[0][3]) > (v0 == 32)) <= ((30 == v0) / 7));
+            v0 = (((54 && v2) == (i6 >= 6)) * ((a1[0][12] < v1) * (14 ? 19 : a0[10])));
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    if ((a0[4] + i7) > 69) break;
+                    a0[14] = (((a0[0] * 88) - (73 <= i7)) + ((a0[8] != v0) % 8));
+                    v3 = (((a1[2][2] <= v2) > (i6 % 4)) != ((a0[12] || 29) > (84 && 82)));
+                    v3 = (((i7 * 27) - (a1[1][12] || v2)) && ((99 == i7) != (87 || 8)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 5) {
+            v1 = (((v2 - i8) && (v2 * a0[4])) >= ((39 != a0[11]) * (v2 || a1[1][10])));
+            {
+                int i9 = 0;
+                while (i9 < 2) {
+                    a1[2][14] = (((v2 >= v2) > (v0 > v2)) != ((v0 - i9) <= (17 == a0[2])));
+                    v3 = (((i8 - 29) + (v3 ? v2 : 73)) != ((v3 - 73) - (v3 == a0[4])));
+                    a1[3][10] = (((85 / 6) <= (a1[2][5] > 53)) ? ((4 && 6) + (v0 < 14)) : ((a1[3][7] * i9) != (i9 ? a0[12] : v3)));
+                    i9 = i9 + 1;
+                }
+            }
+            v1 = (((83 % 5) * (v1 + 50)) ? ((26 != v2) == (50 / 9)) : ((a0[11] <= v2) + (a1[1][12] - a0[4])));
+            i8 = i8 + 1;
+        }
+    }
+    return (((v1 ? v1 : v2) - (a0[6] != 91)) || ((v3 != v3) ? (v0 < v1) : (v1 / 7)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,141 @@
+int f0() {
+    int v0 = 94;
+    int v1 = 24;
+    int v2 = 63;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][2] * v0) / 7) && ((v2 * a1[0][4]) ? (v0 && 14) : (57 != v0)))) {
+        v0 = (((v1 > v0) - (v2 && a0[1])) * ((a1[1][1] != a1[2][5]) == (v1 * 35)));
+        a1[2][14] = (((v2 <= v3) != (v0 % 2)) != ((v2 / 2) != (a1[3][4] == v0)));
+        v2 = (((39 > a0[7]) ? (v2 || a0[14]) : (v0 - v0)) + ((a1[3][9] - a1[1][13]) <= (56 / 6)));
+    } else {
+        v3 = (((v1 / 6) * (98 <= v1)) ? ((v3 ? v0 : v1) - (v0 && v3)) : ((v2 / 1) + (48 - a1[1][6])));
+        v0 = (((v0 < a1[3][12]) - (61 && 86)) * ((v0 <= a0[4]) % 5));
+        a1[2][4] = (((v2 / 2) / 9) % 5);
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((21 <= 78) > 84) break;
+        {
+            int i1 = 0;
+            do {
+                v3 = (((a1[1][3] && v2) * (97 && 21)) && ((25 + i0) < (57 ? 31 : i1)));
+                v1 = (((i0 / 7) / 4) % 6);
+                a1[1][6] = (((62 > a1[0][9]) ? (i0 < v2) : (a1[1][5] ? a0[4] : v2)) / 6);
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        a1[2][13] = (((i0 / 4) && (v1 <= 38)) < ((v1 >= 37) / 3));
+        v1 = (((55 != a1[0][14]) >= (v0 != v2)) >= ((v2 + v2) >= (94 == a1[1][11])));
+    }
+    v0 = (((v1 + 76) / 9) ? ((v0 >= a1[3][6]) ? (a0[13] - 89) : (v1 ? 71 : 63)) : ((v0 || a1[1][2]) || (v0 >= v0)));
+    v2 = (((a0[5] == 13) ? (66 ? 69 : v3) : (v2 ? v1 : v1)) >= ((20 == a0[1]) || (v2 % 6)));
+    if ((((66 ? v2 : v2) * (a0[3] % 4)) >= ((v3 > 79) + (92 >= 9)))) {
+        a1[0][1] = (((v2 % 5) / 1) % 5);
+        a0[4] = (((a0[8] * v0) || (a0[4] - v2)) >= ((a1[0][6] < 59) == (v2 <= 24)));
+        a1[3][1] = (((a1[0][13] < v3) - (93 ? v0 : a1[2][7])) % 9);
+    } else {
+        v3 = (((94 <= v1) > (a0[1] % 3)) || ((v1 - v2) || (v3 + v2)));
+        v0 = (((v1 >= v2) % 4) <= ((a1[3][8] < 60) % 6));
+        v3 = (((v3 || v2) - (23 || v1)) * ((a1[0][3] / 9) || (44 < v3)));
+    }
+    return (((a1[3][2] >= v3) == (16 <= 84)) >= ((v0 == v2) != (92 / 8)));
+}
+int f1() {
+    int v0 = 89;
+    int v1 = 11;
+    int v2 = 47;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 > 12) && (a0[1] + 5)) == ((70 ? v3 : a1[1][14]) ? (v1 - a1[2][0]) : (v1 ? v0 : v2)));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((81 + a0[9]) > 62) break;
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a0[7] > a1[1][0]) + (v1 && a1[0][5])) + ((a1[1][0] ? a1[3][9] : 16) + (v1 / 1)));
+                a0[9] = (((21 ? a0[13] : 96) >= (45 * a1[0][14])) % 6);
+                v2 = (((v1 < 74) <= (i0 != i1)) <= ((a1[1][11] + v2) ? (a0[12] / 8) : (a1[1][6] == 63)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        a1[3][10] = (((13 == v3) == (a1[2][15] * v1)) > ((63 + a1[0][12]) * (a1[1][3] + a0[10])));
+        v0 = (((v1 > v0) ? (a1[0][1] && a1[1][5]) : (a0[15] != v2)) >= ((69 < a0[10]) / 6));
+    }
+    v1 = (((v2 >= v1) - (v0 / 2)) > ((a0[11] / 9) >= (61 ? v0 : v0)));
+    a0[2] = (((v1 != a0[12]) - (v2 < v1)) >= ((a0[9] > v2) < (v0 == a0[11])));
+    {
+        int i2 = 0;
+        do {
+            if ((28 < v3) > 56) break;
+            v0 = (((a1[3][7] != a0[4]) % 6) ? ((i2 >= v3) >= (16 <= v3)) : ((v1 + a1[1][2]) && (v0 > 81)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v2 = (((a0[3] >= 5) > (v1 % 4)) > ((i2 % 2) / 4));
+                    v3 = (((a1[1][6] >= v0) % 8) % 4);
+                    v0 = (((40 < a0[4]) <= (a0[13] - v3)) ? ((i3 - 73) || (v0 - 72)) : ((a0[7] == v0) <= (3 + 34)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[11] = (((23 >= a0[4]) ? (a1[1][9] + v1) : (a1[2][12] > 15)) < ((a1[0][13] / 8) != (i2 ? v3 : a0[10])));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((a0[6] * v1) && (v3 <= v1)) ? ((88 / 9) / 6) : ((20 ? a1[1][1] : v0) <= (64 / 4)));
+}
+int f2() {
+    int v0 = 5;
+    int v1 = 43;
+    int v2 = 26;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 ? v1 : v2) <= (v0 ? v3 : a1[1][6])) * ((v3 + a0[0]) % 8));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a1[2][10] = (((v1 + v3) % 3) + ((i0 != 36) || (v0 - a1[0][11])));
+        v3 = (((a0[3] % 9) ? (i0 * v0) : (a0[15] ? v1 : 97)) ? ((a0[13] && i0) ? (98 || a0[11]) : (50 || v3)) : ((98 ? a1[2][9] : 56) == (79 % 3)));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a0[1] % 4) != (a1[1][7] && 97)) == ((68 ? a0[10] : a1[2][13]) <= (v0 - v1)));
+                v0 = (((v3 > i0) ? (v0 % 4) : (v0 == v2)) <= ((v0 + 13) >= (i1 >= a0[6])));
+                v0 = (((99 * i1) <= (v3 > a1[2][5])) >= ((v0 ? i0 : a1[0][1]) >= (i0 <= a1[3][2])));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v2 = (((37 <= a1[1][2]) && (i2 - 54)) * ((2 != a0[14]) + (a1[2][2] && 0)));
+            a1[1][11] = (((a1[2][13] != v3) ? (v0 <= a1[0][6]) : (63 % 3)) && ((v1 > v1) && (18 < v3)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                if ((v3 > 93) > 58) break;
+                v2 = (((a1[2][1] > 3) || (a1[3][6] <= a1[0][0])) - ((v0 ? v3 : a0[0]) <= (v3 == v1)));
+                v0 = (((v1 - 75) || (3 ? a1[3][11] : a1[1][3])) - ((a0[15] * 51) && (v1 / 6)));
+                a0[10] = (((73 || i3) - (i2 >= 98)) >= ((v3 > v2) < (96 && v3)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v0 = (((10 + i4) / 4) || ((69 != i5) ? (a1[0][0] == 25) : (v3 == a1[0][11])));
+                v0 = (((i4 ? v0 : 16) ? (93 / 3) : (v3 * v1)) - ((85 - 84) ? (89 + 78) : (54 ? 76 : i5)));
+                a1[2][6] = (((a0[0] != 22) || (a1[2][7] != v2)) < ((v1 <= 98) <= (v0 >= a0[4])));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        v1 = (((v2 || 1) != (a0[1] || v3)) || ((v2 + v2) - (v1 > 4)));
+        a0[10] = (((1 ? 3 : v1) ? (57 - v1) : (i4 * a1[1][14])) < ((a1[0][1] - 68) >= (a1[1][14] == a0[2])));
+    }
+    v2 = (((35 > v1) * (v0 || v3)) && ((a1[2][1] - 85) && (v3 || v3)));
+    return (((v3 + v3) >= (v0 < v1)) <= ((v0 || v3) + (v0 * a1[3][12])));
+}
+int main() {
+    return 0;
+}
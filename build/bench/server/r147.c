@@ -0,0 +1,25 @@
+int f0() {
+    int v0 = 31;
+    int v1 = 59;
+    int v2 = 19;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    a1[2][12] = (((96 <= a0[4]) + (a1[0][9] ? v0 : a1[3][3])) <= ((v1 % 7) >= (47 || 54)));
+    v2 = (((v2 != 19) * (a1[0][12] ? a1[1][2] : v0)) - ((17 || v3) / 3));
+    a0[12] = (((a1[3][5] / 1) + (80 % 2)) == ((v3 >= a1[2][4]) > (a0[15] && v3)));
+    if ((((36 - 92) < (v1 + v0)) && ((v1 >= 11) != (v2 - v1)))) {
+        a1[2][10] = (((a1[1][3] + v1) < (94 % 8)) || ((a0[3] + a0[15]) * (v2 + v2)));
+        v1 = (((v1 - v2) != (v3 * 48)) ? ((a0[13] * a1[1][5]) + (v0 && v0)) : ((v1 != a1[1][11]) <= (v3 <= 35)));
+        v0 = (((v3 % 2) < (v3 != 90)) ? ((93 == a0[2]) >= (v2 == a1[3][3])) : ((v0 || 47) < (a0[3] * a1[1][9])));
+    } else {
+        v2 = (((42 == 43) || (98 / 7)) < ((a0[11] ? 50 : v2) % 8));
+        v0 = (((85 * 3) >= (v2 <= v1)) < ((v3 <= a0[8]) / 8));
+        a0[1] = (((a0[1] * v3) < (a0[3] % 1)) && ((v3 ? 23 : 30) >= (16 != v2)));
+    }
+    v1 = (((v1 % 1) == (a1[0][8] / 7)) || ((a1[2][0] % 1) * (v1 != a1[0][2])));
+    return (((v0 * v1) <= (v0 ? a1[1][12] : v3)) != ((v1 + v2) != (12 != 42)));
+}
+int main() {
+    return 0;
+}
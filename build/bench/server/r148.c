@@ -0,0 +1,121 @@
+int f0() {
+    int v0 = 21;
+    int v1 = 16;
+    int v2 = 33;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v0 = (((83 < v1) ? (a1[1][2] != 20) : (a0[14] > v1)) < ((v0 != i0) && (a1[1][14] >= a0[7])));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            if ((a0[10] != a0[10]) > 78) break;
+            v0 = (((v3 <= v1) + (17 < v2)) < ((v0 >= i0) >= (a1[2][13] > a1[2][4])));
+            v1 = (((i0 * i0) != (v1 + 17)) * ((v2 != v3) == (v2 && a0[12])));
+            v1 = (((v3 ? v0 : v3) + (i0 < i0)) < ((53 >= a1[2][4]) - (a0[12] > v2)));
+        }
+        a0[3] = (((a0[8] > 9) == (v1 || v1)) <= ((i0 - v0) >= (27 > v1)));
+    }
+    v0 = (((93 <= a1[2][11]) && (v0 + v3)) <= ((18 % 7) == (v3 - a0[8])));
+    if ((((v1 < v3) && (a1[2][3] % 7)) && ((v2 == v2) != (v3 && 61)))) {
+        v2 = (((a1[2][11] * v3) % 4) - ((v3 / 2) != (v1 <= a1[0][10])));
+        v3 = (((v2 % 5) > (90 / 6)) / 2);
+        a1[0][10] = (((v3 > v1) && (v1 && a1[2][8])) <= ((v3 || v0) <= (a1[1][14] || a1[2][3])));
+    } else {
+        v1 = (((v1 <= v1) > (v3 % 5)) == ((a1[2][13] == 74) || (a0[14] == a1[1][12])));
+        v1 = (((18 > v3) && (a0[1] && 25)) <= ((v0 > a0[2]) % 7));
+        a0[2] = (((a1[3][5] - 90) / 2) != ((v1 < v3) ? (v3 == 2) : (a1[1][3] || a0[13])));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    a0[4] = (((66 == v1) == (a0[8] && 14)) && ((v0 || 67) == (v2 % 9)));
+                    v3 = (((a0[15] ? 33 : a0[4]) && (v2 < v2)) && ((52 == a0[6]) / 6));
+                    v3 = (((16 != i2) * (v2 - 51)) < ((a0[2] ? v2 : a0[13]) * (a0[13] || i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            a1[0][8] = (((20 < v2) <= (v0 == i2)) < ((v2 || a0[15]) - (v0 >= v1)));
+            a0[7] = (((31 ? 80 : i2) != (11 ? i2 : v2)) && ((v1 < 76) > (v3 / 1)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((v3 + 16) > 88) break;
+            v1 = (((i4 % 5) != (a1[1][9] > v0)) < ((a1[1][7] - 61) - (39 || i4)));
+            a1[3][6] = (((i4 % 6) != (v2 && i4)) ? ((v2 || 22) + (i4 * a0[4])) : ((82 + 64) + (58 - v0)));
+            {
+                int i5 = 0;
+                do {
+                    a0[6] = (((v0 == 47) % 4) >= ((a1[1][11] == i5) * (v0 && 32)));
+                    v2 = (((a1[2][11] / 1) >= (v2 == 76)) >= ((94 + 61) % 7));
+                    a1[1][10] = (((v1 * i4) % 3) || ((62 ? v0 : 55) || (v0 % 4)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((v0 * v0) ? (v0 != v0) : (27 ? v2 : 3)) % 4);
+}
+int f1() {
+    int v0 = 14;
+    int v1 = 5;
+    int v2 = 39;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 + v1) || (20 == v2)) * ((a1[0][5] % 3) != (v0 ? 28 : 4)));
+    a1[0][8] = (((v0 - 87) ? (v3 == a0[0]) : (83 + a0[10])) % 9);
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v2 = (((i0 && a1[3][0]) / 7) - ((7 * i0) % 6));
+            a0[7] = (((90 && 97) - (v2 ? v1 : a0[3])) || ((i0 % 7) >= (a1[1][14] || i0)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((35 * a0[13]) && (94 >= 54)) ? ((30 % 8) / 6) : ((v3 <= v1) % 1));
+                    v3 = (((95 || 27) / 2) - ((v3 < 30) + (v0 - v0)));
+                    v0 = (((i1 / 5) != (83 ? v1 : v3)) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v1 = (((4 - 64) || (v3 / 4)) || ((62 ? v3 : v1) == (v1 ? i2 : 21)));
+            v0 = (((a0[9] != a1[1][6]) != (a0[13] + 42)) % 4);
+            {
+                int i3 = 0;
+                do {
+                    a0[11] = (((a0[3] > v3) && (a1[1][14] && 75)) && ((v0 / 5) >= (67 / 2)));
+                    a1[2][10] = (((31 == i3) > (a1[2][12] || a1[3][13])) > ((a1[0][10] + v0) && (v0 == 44)));
+                    v0 = (((a0[3] + a0[3]) >= (v3 / 8)) > ((v2 % 4) ? (i3 ? a1[2][1] : 56) : (78 % 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((16 != a1[0][11]) || (12 * v0)) > ((v3 - 48) ? (a0[4] && a1[3][5]) : (a1[2][12] && 68)))) {
+        a1[0][11] = (((v2 && a0[1]) == (a1[0][12] < 90)) > ((v3 && 28) <= (v1 <= v0)));
+        v0 = (((a1[2][4] ? a0[0] : v2) <= (2 / 8)) * ((v2 <= v3) * (77 ? 75 : a1[1][12])));
+        v1 = (((v2 + v3) > (v3 ? a1[1][13] : 94)) + ((a0[3] || 47) ? (v3 / 7) : (v3 <= a1[3][1])));
+    } else {
+        a0[6] = (((v0 < v1) != (v3 < a0[3])) || ((v0 || v1) ? (a1[1][8] + 44) : (v2 + 25)));
+        v1 = (((94 <= v3) % 7) == ((a0[7] + 85) / 3));
+        v3 = (((v2 >= 78) == (v0 ? v1 : a1[0][4])) || ((v2 * v1) * (v2 == v1)));
+    }
+    return (((v0 / 3) * (v2 && a1[2][3])) % 7);
+}
+int main() {
+    return 0;
+}
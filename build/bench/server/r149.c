@@ -0,0 +1,171 @@
+int f0() {
+    int v0 = 76;
+    int v1 = 78;
+    int v2 = 71;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 && v1) > 72) break;
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((a1[1][4] >= a1[1][11]) > 74) break;
+                v1 = (((v2 - i1) && (a0[0] > i1)) % 3);
+                v2 = (((v1 / 5) == (v2 % 7)) <= ((i1 ? v1 : i0) ? (a0[6] - a1[2][9]) : (v2 < i1)));
+                v0 = (((v1 && 40) == (a0[9] * 82)) <= ((a0[3] > a1[1][2]) + (v3 - a0[11])));
+            }
+            v0 = (((v0 >= v0) * (v0 - 88)) && ((i0 != 64) > (v3 >= a1[3][9])));
+            a1[0][15] = (((a0[0] || 93) < (a1[1][14] >= v1)) / 1);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((v3 < a1[2][11]) > 91) break;
+        v2 = (((12 - v2) % 9) || ((20 - 29) % 8));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v2 = (((30 / 8) < (58 ? v0 : 2)) >= ((i3 != a1[0][0]) / 8));
+                v0 = (((a1[0][11] >= a0[15]) ? (a0[7] || a0[11]) : (v3 % 9)) != ((v1 || i2) != (v1 == v1)));
+                a0[7] = (((12 == a0[11]) ? (v2 <= i3) : (v2 != a1[0][4])) % 6);
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((i2 || 21) ? (v1 / 7) : (a0[15] ? a0[6] : 29)) < ((i2 >= a1[1][6]) == (v0 ? v3 : i2)));
+    }
+    if ((((71 != a0[7]) != (v3 % 3)) + ((a1[1][4] || v0) ? (75 + 67) : (35 == 23)))) {
+        v1 = (((v0 <= 26) ? (v2 > 23) : (v0 || v0)) <= ((v3 == 5) / 7));
+        a0[7] = (((17 < v3) + (v3 || a1[2][15])) <= ((94 * a1[1][7]) >= (v3 ? 22 : v0)));
+        v1 = (((v0 + 54) || (76 == v1)) || ((65 || 68) <= (a1[3][10] * v3)));
+    } else {
+        v3 = (((v2 * 59) * (v0 && v2)) ? ((v2 == 48) == (a1[3][5] > v3)) : ((a0[6] > a1[1][13]) < (v0 * v0)));
+        v0 = (((v1 >= a0[6]) + (v3 == 79)) < ((22 > v1) / 2));
+        v0 = (((60 >= v2) * (v2 && v3)) ? ((v3 <= v1) * (a0[5] != v2)) : ((v1 == a1[1][3]) || (v0 - v2)));
+    }
+    v0 = (((v1 * v1) / 9) != ((v2 + 9) != (14 || v2)));
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            if ((a1[2][13] > v0) > 68) break;
+            a1[0][2] = (((i5 + i5) % 7) && ((48 < 72) < (v0 || a1[2][4])));
+            v0 = (((v0 / 2) != (49 && a1[3][3])) % 5);
+            v1 = (((a1[3][10] <= 35) != (a1[1][0] * 70)) <= ((v2 == a0[6]) % 8));
+        }
+        v3 = (((79 / 3) % 3) < ((i4 ? 30 : 75) && (1 <= v1)));
+        v0 = (((v1 ? v3 : v1) - (7 > a0[1])) ? ((i4 * i4) != (i4 * v2)) : ((v2 ? 92 : v0) >= (28 || 51)));
+    }
+    return (((v2 / 6) % 5) >= ((91 != v0) == (v3 ? v3 : v2)));
+}
+int f1() {
+    int v0 = 51;
+    int v1 = 69;
+    int v2 = 21;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                if ((v1 >= v0) > 59) break;
+                v2 = (((a0[5] == 82) % 6) < ((12 / 3) - (a0[7] == v2)));
+                v0 = (((i1 < v1) != (61 * a0[6])) || ((a1[2][13] != v2) ? (v3 > 50) : (a1[1][5] == v0)));
+                v0 = (((a0[15] / 6) != (v2 <= a0[12])) / 3);
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((v3 / 8) / 5) != ((a1[0][8] + 66) > (52 + v0)));
+        v0 = (((61 || v0) || (a0[2] != a1[0][1])) < ((a1[0][7] ? v0 : v0) != (v2 || v0)));
+    }
+    if ((((v3 / 9) && (a0[3] == 64)) > ((v2 <= v2) <= (34 * v3)))) {
+        v1 = (((v2 + 42) ? (63 <= v1) : (v3 / 3)) || ((a1[1][6] / 1) == (21 + v1)));
+        v0 = (((1 != a0[10]) >= (v2 - v2)) ? ((v1 ? v1 : v3) % 3) : ((24 + v2) == (v2 % 1)));
+        v2 = (((77 / 3) + (v3 ? a1[2][15] : 68)) <= ((v0 != v2) && (v0 + 80)));
+    } else {
+        v3 = (((a0[8] != 13) - (v0 >= 21)) != ((a1[1][5] * a0[9]) != (81 / 8)));
+        v1 = (((48 % 7) ? (v1 && a0[13]) : (v1 ? 19 : v1)) ? ((92 >= v3) != (a1[1][15] == v2)) : ((a0[8] != v1) + (43 ? v0 : a1[1][14])));
+        a0[8] = (((a1[1][0] % 5) <= (a0[0] * 58)) / 9);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v3 = (((v1 + 18) % 4) || ((a0[7] ? 21 : i2) >= (v3 == v1)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((i3 ? 97 : v0) && (v1 * i2)) ? ((a0[13] / 8) != (v1 / 9)) : ((i2 ? 75 : a0[11]) - (i3 && a1[3][4])));
+                v2 = (((a0[13] % 3) < (a0[5] != i2)) % 5);
+                a0[8] = (((v1 <= a1[3][2]) <= (v3 >= a1[2][7])) / 6);
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        v0 = (((v3 != 87) % 4) >= ((v3 + 72) ? (77 % 3) : (86 != v1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                if ((16 % 3) > 60) break;
+                a1[0][1] = (((v2 || i4) / 5) + ((50 > a1[2][7]) - (v3 || 85)));
+                v3 = (((77 == a0[10]) / 9) != ((v0 / 9) + (v1 / 8)));
+                v3 = (((v2 != v1) + (a1[1][5] * i4)) && ((a1[1][0] != i4) || (i5 > v3)));
+            }
+            v0 = (((a0[4] ? v3 : a0[8]) || (83 - 65)) == ((79 ? i4 : v0) || (v2 - 40)));
+            v1 = (((a0[6] && v1) == (v3 + 20)) > ((43 != a1[1][14]) * (v1 == v2)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    a0[15] = (((81 == v2) == (a1[3][4] / 6)) != ((49 * 18) - (v0 ? v1 : a1[3][2])));
+    return (((v2 - a0[10]) != (v0 + 17)) % 5);
+}
+int f2() {
+    int v0 = 35;
+    int v1 = 32;
+    int v2 = 79;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    if ((((95 % 1) + (15 && 18)) <= ((70 >= v2) * (a1[0][3] || v0)))) {
+        a1[2][2] = (((25 == v2) < (a1[2][15] && v2)) * ((v3 % 2) ? (43 ? v2 : v3) : (v0 + v0)));
+        v1 = (((a0[2] <= 58) <= (v0 - a0[2])) == ((10 - a0[14]) != (v0 && v2)));
+        a0[1] = (((10 >= 66) ? (v3 >= 81) : (v0 - v3)) && ((v2 % 4) <= (v0 % 5)));
+    } else {
+        v3 = (((v2 >= 59) % 3) == ((v1 * v2) > (49 >= 24)));
+        a0[15] = (((v2 != v2) - (15 || 56)) != ((v3 - v0) >= (v3 ? v2 : v2)));
+        v3 = (((a1[0][1] || 21) == (v2 >= a0[6])) - ((25 < 49) && (v3 == 64)));
+    }
+    v3 = (((a0[2] >= a1[1][15]) <= (v2 % 4)) >= ((v2 ? v3 : 94) ? (a1[0][14] % 5) : (a1[1][0] ? 88 : a1[1][12])));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v3 = (((i0 < a0[12]) + (v3 && i1)) < ((v0 || 17) == (45 * 81)));
+                v0 = (((24 / 9) % 9) / 2);
+                a1[0][11] = (((67 % 5) ? (41 > i1) : (57 ? 12 : i0)) && ((i0 <= v3) <= (a1[3][15] % 5)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v1 = (((v3 * 82) >= (v0 - v3)) ? ((36 <= 73) + (6 <= v0)) : ((46 < 8) * (a1[3][4] == a1[2][3])));
+        a0[8] = (((10 < v2) * (46 == i0)) == ((96 / 8) >= (v0 <= v1)));
+    }
+    v0 = (((v1 ? 50 : v1) || (36 && a1[2][1])) >= ((59 > v3) != (a1[1][8] < v2)));
+    {
+        int i2 = 0;
+        do {
+            a0[12] = (((34 ? v3 : v1) * (v2 ? 60 : v0)) / 4);
+            v2 = (((56 ? v3 : 23) / 7) + ((a1[2][11] ? i2 : v0) == (96 ? 22 : v2)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((i3 % 9) >= (v3 - i3)) >= ((69 <= i3) > (v2 + v1)));
+                    a0[14] = (((v1 * 50) - (a0[7] + 6)) ? ((i2 >= i2) >= (v1 % 6)) : ((18 && a1[3][9]) ? (89 || a1[3][7]) : (v2 + v1)));
+                    a1[1][9] = (((47 != 74) > (v3 >= i2)) > ((a1[3][4] < v3) * (a1[1][13] + i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    return (((v0 + a0[1]) + (a0[1] != v0)) ? ((v2 > v1) || (v1 >= v1)) : ((v3 >= 64) < (v2 / 8)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,84 @@
+int f0() {
+    int v0 = 81;
+    int v1 = 18;
+    int v2 = 65;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((42 >= 39) ? (a1[0][5] ? 30 : a1[2][2]) : (v3 ? v0 : v2)) <= ((a0[1] >= 79) == (a1[2][11] <= v2)));
+            a1[0][2] = (((a1[2][11] > i0) ? (42 != 39) : (70 == a0[4])) * ((90 <= a1[2][1]) > (v1 + 72)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((i0 * i1) / 2) <= ((a0[9] > a0[15]) + (59 || i1)));
+                    v1 = (((67 > i1) < (18 < 69)) >= ((v3 <= v1) / 5));
+                    v1 = (((i1 >= 3) <= (i0 != v3)) / 3);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v3 = (((v1 == v1) * (i2 == i2)) || ((a0[11] ? v0 : v1) * (a1[2][0] ? v2 : 41)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((i3 ? a1[3][2] : v0) <= (i3 - v1)) ? ((v2 % 4) % 2) : ((a1[0][11] + a0[8]) / 8));
+                v1 = (((v3 < i3) - (a0[15] || v0)) ? ((i3 < 8) == (a0[3] == i3)) : ((a0[8] < v2) + (a0[8] * 41)));
+                a0[4] = (((a0[13] != 25) ? (63 <= a1[3][2]) : (a0[11] + v2)) || ((a0[11] % 6) ? (v0 != a1[0][3]) : (i3 != v3)));
+            }
+            v3 = (((v1 != v2) ? (a0[15] != a0[1]) : (a0[4] ? a1[0][15] : 35)) <= ((v0 ? 54 : 67) - (v2 || a0[1])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((35 ? v1 : v3) >= (v1 / 2)) / 9);
+            v0 = (((v0 && v1) - (v3 == v2)) - ((i4 % 7) - (v3 <= v1)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((18 <= v1) < (a1[2][11] >= 21)) >= ((49 ? 61 : a1[2][11]) == (1 >= v0)));
+                    v2 = (((i5 * a0[7]) && (v3 <= i4)) || ((a1[1][4] + v0) ? (23 != 1) : (39 == i4)));
+                    v2 = (((i5 != 0) >= (i4 + 57)) * ((82 && a1[2][1]) >= (v2 && a0[12])));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((12 + v2) > 55) break;
+            v2 = (((a1[0][15] != v3) && (51 && 19)) != ((i6 <= a1[1][11]) > (v1 % 3)));
+            v0 = (((28 && v1) + (a0[6] && 87)) != ((57 ? i6 : 67) ? (v3 - v1) : (v1 ? 82 : v0)));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                v2 = (((23 ? a1[1][10] : 71) / 1) != ((v1 * a1[2][13]) >= (v2 / 8)));
+                v3 = (((97 < a0[6]) < (a0[8] * 6)) % 9);
+                v0 = (((i6 != v0) ? (v3 <= 92) : (a0[9] || 16)) / 8);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    if ((((2 && a1[1][8]) >= (2 ? a1[0][15] : a0[3])) ? ((a0[4] * 9) && (v3 ? v0 : v2)) : ((25 >= 48) >= (83 <= 97)))) {
+        a1[2][14] = (((a1[1][1] - v1) <= (a1[1][7] <= v3)) ? ((v3 ? 62 : a0[5]) && (v2 < 65)) : ((v2 != 6) * (a0[3] ? 50 : v0)));
+        v3 = (((v3 / 4) - (v1 != a0[14])) != ((a1[2][11] - v1) ? (v2 ? v1 : 78) : (v1 > v1)));
+        a0[9] = (((v2 == v0) ? (4 <= 25) : (v2 != a1[1][7])) * ((v2 * v1) == (v0 == a1[1][5])));
+    } else {
+        v3 = (((88 / 4) < (v1 + 16)) < ((a0[15] && a1[0][5]) >= (64 == v3)));
+        v1 = (((v1 < v1) % 2) % 1);
+        v0 = (((v2 < a1[3][5]) <= (a0[15] * v2)) <= ((a0[15] < 7) || (v1 + a1[3][13])));
+    }
+    return (((59 < a1[2][5]) ? (67 && a0[15]) : (0 > 7)) - ((v3 + v1) > (v0 ? a1[0][13] : 31)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
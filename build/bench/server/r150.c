@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 2;
+    int v2 = 21;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a0[10] = (((v3 <= v2) % 5) + ((v0 < v2) != (i1 ? 8 : v3)));
+                    a0[3] = (((24 >= 74) || (39 != v1)) || ((13 == a1[3][15]) - (v1 <= a0[8])));
+                    a1[2][15] = (((v2 ? a1[2][8] : a1[3][7]) || (7 >= a0[6])) < ((a0[5] + i1) / 1));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a0[5] % 1) > (a1[2][5] < v2)) ? ((v2 - i0) && (26 == v1)) : ((17 % 8) * (a1[3][4] || v2)));
+            v1 = (((a0[3] && v1) > (0 - 6)) > ((v0 <= 21) ? (v1 * a0[10]) : (0 <= v0)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((v1 == v3) / 1) <= ((a0[13] <= 45) ? (v3 >= v1) : (53 < a1[2][14])))) {
+        v3 = (((v2 ? v1 : v0) % 3) || ((a0[14] < a0[7]) * (v0 != a0[9])));
+        a0[15] = (((a0[12] >= a1[1][10]) != (v0 || a0[6])) == ((v3 == a0[4]) / 3));
+        v2 = (((v3 >= v2) ? (v2 <= v1) : (a1[0][3] || v0)) ? ((77 * 51) + (53 - v0)) : ((a1[2][12] ? v1 : v2) >= (v2 == v3)));
+    } else {
+        v3 = (((v1 ? a1[2][15] : v0) ? (v1 > v0) : (v1 ? a1[1][10] : v1)) == ((v1 - v1) >= (69 - 24)));
+        v1 = (((v0 ? v1 : a1[3][13]) <= (v2 <= v2)) || ((85 < v2) >= (v2 || a0[0])));
+        a1[0][14] = (((v1 || 55) > (v0 <= a0[14])) >= ((v3 || v1) ? (v2 / 5) : (v2 > 95)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((62 - a1[3][8]) > 69) break;
+        v0 = (((v1 + v0) - (a0[4] + a0[11])) + ((a0[7] < a0[13]) / 3));
+        a0[1] = (((a1[3][1] > 80) != (14 % 5)) / 9);
+        {
+            int i3 = 0;
+            do {
+                v3 = (((a0[1] > a0[8]) && (i2 - v1)) == ((i2 && 52) / 4));
+                v1 = (((a0[9] + v0) / 6) && ((i2 <= i2) && (58 - a0[2])));
+                a1[2][6] = (((v2 || v2) * (i2 <= v3)) ? ((i3 || i3) * (a0[0] && 27)) : ((46 / 5) + (38 % 9)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    if ((((46 == a0[6]) && (a0[8] <= v2)) / 6)) {
+        v2 = (((a0[7] * v0) < (51 / 3)) && ((v1 - 0) >= (a0[3] >= v3)));
+        a1[2][7] = (((v1 == v1) ? (a1[0][7] ? 67 : v2) : (v3 - v3)) % 7);
+        v2 = (((a1[3][6] != 68) + (25 ? a1[1][10] : a0[2])) && ((v3 + v2) % 5));
+    } else {
+        a1[2][13] = (((a1[2][3] + a1[3][0]) - (a1[2][4] == v1)) == ((v1 >= 76) - (1 <= 15)));
+        v0 = (((58 <= v1) < (v0 - a0[13])) <= ((a1[2][5] > 94) || (17 >= a0[15])));
+        v2 = (((a0[12] && a0[9]) <= (a1[3][7] < v2)) <= ((v0 <= 98) - (a1[0][9] - a0[15])));
+    }
+    if ((((v3 - 3) ? (89 ? a0[1] : v2) : (a1[2][5] % 5)) ? ((v1 + v2) && (v3 != v1)) : ((v0 + 18) * (8 % 7)))) {
+        v3 = (((59 * 16) != (a1[2][13] * 8)) == ((a1[2][6] + v3) > (v0 - a1[3][4])));
+        a1[3][6] = (((v0 ? v0 : 5) <= (v1 < a0[3])) % 2);
+        v0 = (((26 ? a0[3] : a0[9]) % 3) && ((v0 * a0[2]) > (a1[1][6] * v2)));
+    } else {
+        v1 = (((a0[2] != v0) / 6) + ((a1[0][14] * v3) < (a1[1][9] ? v3 : v1)));
+        a0[14] = (((v1 && 19) % 8) ? ((a0[14] % 3) < (v3 >= a0[14])) : ((v3 || v0) || (v3 ? v0 : 36)));
+        v1 = (((a1[3][11] || v0) && (76 % 5)) ? ((a1[0][9] ? a1[2][6] : v2) > (v0 == v1)) : ((a1[0][2] > v3) - (83 > v3)));
+    }
+    return (((v0 ? v1 : a1[3][11]) / 6) || ((v3 > v1) < (v1 || v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,90 @@
+int f0() {
+    int v0 = 80;
+    int v1 = 87;
+    int v2 = 27;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v2 < v0) ? (a0[1] * 92) : (v1 - a1[0][12])) > ((v2 >= 88) == (11 <= v1)));
+    if ((((v3 ? v1 : 21) % 1) > ((95 < v3) == (a1[0][3] / 5)))) {
+        a1[0][3] = (((v0 > v0) ? (a0[12] * a1[1][2]) : (a1[3][8] || a1[3][10])) && ((97 > 92) ? (v2 - a1[1][3]) : (v3 || v3)));
+        v3 = (((12 / 5) || (86 >= v3)) / 7);
+        v3 = (((v1 ? v2 : a1[0][12]) && (18 / 1)) != ((v1 == v3) / 3));
+    } else {
+        v2 = (((7 ? v1 : 87) < (70 && a1[3][0])) < ((v1 && a0[6]) + (v0 > 27)));
+        v0 = (((a1[2][8] >= v2) > (79 <= a0[2])) == ((v2 * v0) / 3));
+        v1 = (((v1 > 2) > (a1[3][13] > v2)) ? ((a1[3][10] ? v2 : v3) - (v2 < v3)) : ((38 + 42) ? (v3 * v0) : (a1[2][8] <= a0[6])));
+    }
+    v3 = (((49 && 10) ? (a1[2][2] || v3) : (33 >= 76)) == ((v0 ? v1 : 60) || (v0 ? 43 : a0[4])));
+    if ((((90 != v3) != (v2 == 12)) ? ((v0 - a1[1][12]) * (a0[5] <= a0[10])) : ((v2 || 15) + (v0 < a1[3][15])))) {
+        v2 = (((a1[0][6] / 6) == (79 < 39)) + ((91 % 2) / 6));
+        v0 = (((a1[2][14] > a1[2][14]) ? (v1 + v0) : (56 ? a0[8] : v0)) < ((v3 >= v1) >= (v1 < v1)));
+        v3 = (((v3 <= a1[2][12]) <= (v2 < 87)) ? ((v1 && 7) + (97 % 5)) : ((86 == a0[7]) ? (42 < v2) : (v3 * v2)));
+    } else {
+        v1 = (((v2 + a1[1][1]) ? (a0[4] % 4) : (v0 - 59)) != ((a0[7] / 8) < (v1 ? v1 : 40)));
+        v1 = (((a1[3][11] + a0[11]) != (v2 != 20)) ? ((v0 > v3) >= (50 < 94)) : ((v3 && v2) / 3));
+        a0[7] = (((v0 ? a1[2][8] : v0) + (v0 > a1[0][4])) < ((42 ? 42 : v2) == (v3 / 9)));
+    }
+    v2 = (((v0 ? a1[2][10] : v1) < (v0 > v0)) ? ((v3 >= v0) ? (37 && v0) : (v2 || v0)) : ((v2 ? v0 : a0[5]) * (v2 || v0)));
+    return (((v1 % 2) == (40 != v1)) % 6);
+}
+int f1() {
+    int v0 = 39;
+    int v1 = 28;
+    int v2 = 62;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v0 ? a0[4] : a1[1][8]) - (v2 ? 49 : 65)) == ((v1 ? v3 : v2) <= (36 < a1[2][10])));
+    if ((((v0 * v0) < (a1[3][10] || v3)) >= ((97 % 1) / 3))) {
+        v3 = (((90 == v3) && (v2 - 14)) && ((v0 % 5) < (v2 ? 15 : a1[2][1])));
+        v3 = (((v3 ? v3 : 14) != (59 % 9)) < ((v0 ? a0[15] : 27) <= (v1 || 92)));
+        v3 = (((v2 / 1) <= (14 ? 22 : 62)) * ((v3 ? a0[2] : 55) / 9));
+    } else {
+        v1 = (((78 > v1) == (a0[0] && v3)) != ((51 || v1) ? (v3 ? v0 : v2) : (v3 % 8)));
+        a1[2][8] = (((15 || v3) ? (v0 && 75) : (v3 < v3)) < ((v1 && v0) >= (a0[13] ? v1 : 3)));
+        v0 = (((v2 - a0[0]) != (a1[3][15] % 9)) * ((v2 / 8) < (34 / 3)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((v2 - i0) > 54) break;
+        v2 = (((a1[0][13] / 1) * (a0[7] + v3)) % 6);
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                a1[1][5] = (((17 <= i0) * (i0 > 62)) * ((a1[0][11] && 53) >= (v3 != 5)));
+                v3 = (((65 < 29) == (a1[2][10] / 4)) - ((v1 <= v2) ? (a1[3][15] == v1) : (v1 < v1)));
+                v0 = (((v1 == v2) && (71 <= v1)) < ((a1[2][6] ? v0 : i1) >= (i1 ? 29 : 90)));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((v1 <= i0) - (v1 + v3)) >= ((v2 ? i0 : 86) ? (v0 * 12) : (46 || v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 ? 58 : v0) > 80) break;
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a0[11] = (((i2 - 54) ? (a0[0] == i2) : (v3 ? v2 : a1[0][3])) != ((v2 % 8) % 4));
+                a1[0][5] = (((v3 && v1) ? (i3 || v3) : (v2 / 2)) || ((i3 * v3) > (v1 ? v1 : i3)));
+                v1 = (((47 / 3) < (v3 && v3)) && ((a1[2][10] == v2) > (a0[10] - a0[7])));
+            }
+            v1 = (((59 >= a0[2]) >= (v0 % 3)) > ((v0 == a1[3][10]) / 5));
+            v1 = (((11 - i2) * (35 - a1[1][3])) + ((83 < 6) >= (v0 || 8)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((82 / 9) > 99) break;
+        a0[1] = (((v0 > i4) / 7) - ((5 || i4) * (a1[2][8] <= 8)));
+        a0[7] = (((12 <= a1[0][11]) + (v1 * v3)) == ((v2 / 3) <= (v3 * a1[2][10])));
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            a0[9] = (((69 ? v2 : 3) <= (a1[0][2] % 2)) != ((v0 >= i5) > (31 - 18)));
+            v0 = (((a0[0] + v2) ? (i5 * v2) : (47 / 9)) || ((v3 / 8) <= (8 ? 60 : v3)));
+            a0[1] = (((59 <= a0[8]) * (v1 > v1)) && ((62 <= 41) || (i5 / 1)));
+        }
+    }
+    return (((v2 != 67) - (a1[1][3] ? 32 : 92)) * ((63 == v0) / 3));
+}
+int main() {
+    return 0;
+}
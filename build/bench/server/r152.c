@@ -0,0 +1,171 @@
+int f0() {
+    int v0 = 47;
+    int v1 = 20;
+    int v2 = 96;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    a0[1] = (((a0[3] + a0[0]) * (v2 + a0[4])) % 3);
+    if ((((a0[0] >= v2) >= (v3 <= v3)) % 7)) {
+        v1 = (((a1[2][10] == v1) < (a0[0] < 80)) ? ((v2 ? a1[1][2] : v1) > (15 || v2)) : ((71 ? v3 : 77) > (33 >= 86)));
+        v2 = (((89 || v1) == (v2 ? 17 : v2)) && ((8 ? v2 : v1) / 8));
+        a1[0][1] = (((v1 ? 41 : v0) || (13 > a1[3][12])) % 5);
+    } else {
+        a1[0][10] = (((v3 >= 37) < (v0 == v2)) < ((v2 ? v0 : 2) * (a0[15] > v1)));
+        v3 = (((9 * a1[2][11]) / 8) ? ((v1 + v3) % 7) : ((v3 >= v0) || (v0 - v2)));
+        v1 = (((24 ? v0 : a1[3][4]) % 1) ? ((v2 || v1) < (a0[3] == a0[1])) : ((46 != v3) - (v2 < v2)));
+    }
+    v3 = (((v2 ? a0[8] : v3) + (v2 ? v0 : 42)) / 6);
+    if ((((a1[2][0] - 41) > (18 != 41)) <= ((a0[7] + v0) ? (v0 ? a1[2][6] : a1[1][9]) : (66 || a0[10])))) {
+        a0[10] = (((a1[3][6] && v1) + (a0[4] % 8)) ? ((v3 == v1) ? (79 != 25) : (v0 || a1[2][1])) : ((a1[2][12] * a1[1][14]) >= (v0 < 83)));
+        v0 = (((v0 < 11) != (a1[3][2] + 62)) + ((v3 % 6) / 9));
+        a1[2][3] = (((v1 != v0) != (v1 != v2)) || ((90 < a1[1][9]) ? (a1[2][6] || a1[0][3]) : (v1 ? v3 : v2)));
+    } else {
+        v0 = (((a0[9] / 8) * (v3 ? 43 : 5)) == ((v3 == v2) && (v2 ? v0 : a0[11])));
+        a1[1][0] = (((v0 || v2) >= (v2 <= v1)) <= ((v3 || 89) || (80 != v2)));
+        v3 = (((80 != 42) || (2 != v0)) * ((v1 ? a0[6] : v1) ? (40 == v2) : (v1 % 3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v0 - v0) == (a0[12] ? i0 : a0[7])) + ((a1[3][0] || i0) % 1));
+                    v2 = (((v3 && 55) % 1) * ((93 / 7) >= (a1[1][1] % 8)));
+                    v1 = (((a0[9] >= 25) >= (i1 - a1[3][13])) >= ((v3 ? 46 : 94) && (i0 && v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            a0[14] = (((v1 == v3) <= (v0 && i0)) <= ((12 + v3) >= (a0[8] % 1)));
+            v2 = (((a0[11] % 6) > (v0 ? v1 : i0)) >= ((v1 >= a1[2][7]) + (9 >= a0[4])));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    return (((6 ? a1[1][0] : 77) * (v1 * a1[3][2])) ? ((a0[4] || v2) / 1) : ((v2 * a0[5]) ? (v0 > 94) : (v1 >= a0[10])));
+}
+int f1() {
+    int v0 = 99;
+    int v1 = 32;
+    int v2 = 98;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    a0[1] = (((v0 % 3) / 7) - ((v0 <= 91) ? (v0 == v2) : (30 < v2)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            a0[8] = (((v3 < 46) == (i0 % 7)) <= ((v0 == a0[0]) > (v0 || a1[1][4])));
+            a1[0][11] = (((v2 != v2) - (92 > i0)) ? ((i0 < 75) <= (v0 >= a0[5])) : ((17 >= v2) == (a0[9] == a0[9])));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v0 = (((a1[1][13] + a1[2][11]) - (i0 ? v1 : i1)) ? ((a1[3][13] <= 97) >= (v3 <= a0[2])) : ((v1 + 93) ? (v0 || a0[10]) : (v2 == i0)));
+                    v1 = (((a1[3][10] && v1) || (a1[3][2] / 5)) && ((59 / 2) + (a0[2] < i0)));
+                    v1 = (((v1 / 4) >= (a1[1][0] && v0)) - ((a1[2][12] ? a1[1][11] : i0) && (v3 + v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((90 || a1[1][9]) > (i2 % 7)) < ((v2 < 69) + (v3 > v0)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((i3 > a0[5]) / 1) ? ((v0 && a0[7]) == (i2 - v2)) : ((a0[6] && v3) <= (v3 <= i2)));
+                    v3 = (((v3 && a0[11]) <= (a0[9] || v0)) + ((v1 <= i3) + (i3 || 40)));
+                    v1 = (((v2 <= a1[0][11]) / 8) / 4);
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            a0[11] = (((v0 <= 24) > (93 ? v2 : a1[0][10])) || ((a0[6] <= i2) + (a0[9] < a0[12])));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((v2 < 85) * (v2 && v2)) && ((v3 == v2) == (v2 - v3)))) {
+        v3 = (((a1[1][7] && v1) / 8) + ((v2 >= 76) % 5));
+        a1[3][4] = (((v2 > 62) > (v0 < a1[2][13])) <= ((67 || 41) * (v2 % 2)));
+        v0 = (((v0 ? v3 : 75) || (v1 * 23)) <= ((0 / 5) >= (a1[0][0] - v0)));
+    } else {
+        a0[4] = (((v1 + a1[3][14]) != (50 == v3)) * ((62 / 8) + (v1 * v1)));
+        v3 = (((v3 >= v0) >= (a1[1][2] % 9)) / 5);
+        v0 = (((v1 && a1[1][0]) <= (58 - 10)) != ((a1[3][2] > a1[3][12]) >= (55 > v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            a0[3] = (((a0[10] == v2) > (18 * a1[2][13])) ? ((27 / 3) || (95 >= v1)) : ((v0 % 6) / 7));
+            v3 = (((59 ? a0[12] : v1) % 1) % 1);
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v1 ? a1[0][2] : i5) <= (a1[2][6] - v1)) + ((v1 - v1) * (1 < v3)));
+                    v3 = (((a0[9] && 89) != (v3 / 8)) || ((a0[5] * 41) && (31 - 78)));
+                    a1[3][8] = (((a1[2][2] != i5) + (a0[3] <= 48)) + ((i5 ? v0 : 32) ? (i4 <= i4) : (v0 >= 41)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((33 / 2) < (a1[1][6] < a0[0])) % 6);
+}
+int f2() {
+    int v0 = 17;
+    int v1 = 95;
+    int v2 = 66;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    a1[3][6] = (((v0 ? 14 : v2) == (v2 >= v2)) % 4);
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v1 = (((99 || v2) / 8) <= ((i0 < a1[0][0]) && (a1[3][10] * 24)));
+            v0 = (((a1[0][1] ? a1[0][4] : 81) + (a0[2] ? a0[10] : a1[2][12])) > ((a0[2] ? v2 : a1[2][15]) || (v0 != 99)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v2 = (((69 >= v1) || (v2 <= a1[2][2])) && ((v0 * a1[2][11]) > (v3 != 66)));
+                v0 = (((i1 == i1) + (89 * v2)) - ((v0 + a0[13]) && (v0 + 23)));
+                v0 = (((27 < v2) != (77 == i1)) < ((42 ? i0 : i0) || (i1 % 7)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((0 - 73) % 6) && ((v0 < v3) < (61 > v0)));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        a0[5] = (((v2 <= 3) ? (a0[7] || a0[10]) : (v1 && v1)) % 9);
+        {
+            int i3 = 0;
+            do {
+                if ((a0[11] ? v3 : a0[12]) > 75) break;
+                v0 = (((a0[7] || v1) / 1) >= ((v0 ? a1[2][9] : v2) < (i2 == a0[9])));
+                v1 = (((a1[0][14] % 6) || (89 ? a0[14] : i2)) / 6);
+                v3 = (((52 && a1[1][3]) > (a0[7] == 42)) / 3);
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        a0[12] = (((a1[1][12] * i2) != (v3 + v1)) ? ((v0 ? i2 : i2) / 3) : ((a1[3][1] / 3) || (a1[2][15] % 2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                if ((v2 != a1[3][2]) > 89) break;
+                v3 = (((a1[1][13] || a0[1]) * (a1[0][2] == 89)) <= ((a1[0][13] * i5) ? (a1[3][10] - 67) : (89 + a0[12])));
+                a1[0][1] = (((i4 ? v0 : a0[3]) == (i5 % 8)) == ((49 + v1) ? (i4 / 6) : (a1[2][8] * i4)));
+                a0[7] = (((a1[2][1] % 5) - (a1[2][7] && 69)) * ((i5 / 2) % 8));
+            }
+            v2 = (((v2 ? a0[10] : 74) >= (a1[0][15] % 7)) != ((v2 / 3) >= (v3 / 5)));
+            a1[2][8] = (((v3 % 7) + (3 < a0[2])) % 8);
+            i4 = i4 + 1;
+        }
+    }
+    return (((96 != 24) % 6) ? ((v1 * v2) * (v1 ? 24 : v2)) : ((30 % 1) ? (a1[0][14] > a0[12]) : (a1[3][9] >= a1[0][2])));
+}
+int main() {
+    return 0;
+}
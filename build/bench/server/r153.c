@@ -0,0 +1,65 @@
+int f0() {
+    int v0 = 69;
+    int v1 = 17;
+    int v2 = 37;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a1[3][10] = (((v2 > v0) && (v3 < v3)) + ((v2 == a0[3]) * (65 >= i0)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v0 = (((a1[0][14] * i1) == (a0[3] <= a1[0][8])) - ((52 < i1) > (i0 - v2)));
+                v0 = (((v0 == v3) % 2) ? ((i1 ? 84 : a1[2][3]) % 5) : ((a0[4] ? v1 : 42) == (47 >= 20)));
+                v2 = (((a1[3][5] ? a1[1][0] : a1[1][4]) ? (a1[0][5] >= 53) : (i0 % 9)) % 7);
+            }
+            v2 = (((0 == i0) % 3) >= ((v2 / 2) || (a0[5] < a0[6])));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((v3 <= i2) ? (a0[1] && v1) : (i2 + v3)) || ((70 && v1) == (82 - v0)));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((v2 ? 48 : v2) || (i3 && v3)) >= ((i3 - 8) != (i2 ? i3 : v1)));
+                a0[9] = (((v1 * 18) < (a1[2][1] || 68)) >= ((54 < a0[7]) / 7));
+                a1[0][8] = (((a1[2][13] <= i3) == (a1[1][0] % 3)) + ((62 / 3) * (v0 >= 5)));
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+        v3 = (((v1 ? a0[14] : v3) && (a0[12] || a1[3][15])) || ((v0 - 8) - (v1 ? v0 : v1)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((a1[0][10] == 57) >= (a0[8] == a0[12])) - ((30 % 9) > (a1[3][3] / 7)));
+                    a0[2] = (((a0[6] * v3) || (a0[14] * 57)) < ((v3 < i5) / 9));
+                    v2 = (((a0[9] && v2) ? (61 && a0[4]) : (v0 < a1[2][2])) || ((a1[2][7] < v2) > (v1 + i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v0 = (((a1[0][9] ? a1[1][4] : v2) % 5) * ((a0[3] <= a1[2][4]) * (i4 ? v0 : a1[1][15])));
+            v2 = (((97 * 60) - (v3 < v2)) * ((v2 > i4) > (v3 < i4)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+            v2 = (((a0[14] >= i7) && (77 != a1[0][3])) + ((v2 != 71) < (a0[1] <= v2)));
+            v3 = (((37 - i7) ? (a1[3][6] && v3) : (v1 <= 61)) < ((26 * 84) ? (v3 > v3) : (i7 != a0[14])));
+            v2 = (((v1 == a0[9]) == (a1[2][3] < v0)) ? ((i7 / 5) * (a1[1][5] * a1[3][2])) : ((84 ? i7 : v3) <= (v3 <= a1[2][13])));
+        }
+        v0 = (((74 ? v2 : a1[0][15]) * (v3 >= a0[3])) != ((a1[2][7] || a0[14]) - (a0[14] >= i6)));
+        a1[2][11] = (((i6 && v1) && (a0[15] && a0[10])) > ((a1[1][9] == 97) > (a1[1][9] + i6)));
+    }
+    v3 = (((75 ? v2 : v2) + (v2 % 7)) == ((a0[15] == a1[1][4]) / 1));
+    return (((v0 <= 63) || (v1 != 9)) ? ((v0 - v3) + (54 % 4)) : ((v1 != v0) == (v0 != v2)));
+}
+int main() {
+    return 0;
+}
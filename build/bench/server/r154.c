@@ -0,0 +1,126 @@
+int f0() {
+    int v0 = 44;
+    int v1 = 89;
+    int v2 = 22;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[2][10] = (((a1[1][6] <= v3) > (a0[13] % 1)) != ((a0[7] ? 66 : 78) ? (v3 ? v2 : v2) : (v1 && 3)));
+            v3 = (((a1[1][15] >= 29) == (v1 + a0[15])) <= ((a1[1][2] * 14) < (48 && v1)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a0[14] && i1) && (69 < 84)) ? ((52 <= a1[0][8]) + (v3 ? a1[3][11] : 24)) : ((v3 % 9) >= (v0 <= i0)));
+                    a0[8] = (((v2 - 23) * (i0 != v3)) ? ((42 >= a1[3][9]) || (a1[1][2] - v3)) : ((v1 < i0) ? (i1 ? i0 : v2) : (88 || 19)));
+                    a0[11] = (((a0[9] < 93) % 9) - ((51 ? 33 : a1[2][2]) <= (21 <= a0[11])));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v3 != v2) > 89) break;
+            v1 = (((v3 ? 85 : a1[3][10]) <= (v2 < 71)) && ((v0 - a1[3][10]) && (54 != 44)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v3 = (((a0[9] && v2) / 5) < ((a1[1][0] == 47) == (v0 && a1[2][9])));
+                    v2 = (((v1 && 48) || (v1 + a1[1][5])) <= ((a1[1][3] && a0[8]) > (a1[0][6] / 1)));
+                    a1[3][12] = (((i3 <= v1) ? (i3 >= a1[1][3]) : (27 >= 90)) ? ((a0[12] / 2) <= (v3 && 18)) : ((v3 * a1[2][10]) > (26 == a0[4])));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[9] = (((v3 || 29) > (v0 % 4)) * ((v3 == i2) < (v3 != v3)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[2][8] = (((v3 > v3) ? (i4 > 77) : (98 + v0)) - ((44 ? v2 : 33) * (38 / 7)));
+            v1 = (((a1[3][12] - a1[1][1]) / 6) >= ((a1[0][12] || v3) > (58 >= v3)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((i4 % 6) != (a0[7] < i4)) < ((27 <= v0) + (v0 + i4)));
+                    v1 = (((i5 / 7) + (50 % 5)) != ((v1 + a0[8]) / 9));
+                    v2 = (((v3 != v2) && (a0[12] || i5)) <= ((i4 * a0[12]) <= (v2 != v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    a0[2] = (((a0[9] > a0[13]) <= (1 ? v2 : v0)) % 5);
+    if ((((a0[14] == a0[2]) - (v3 % 9)) || ((v0 != a1[0][15]) || (a1[2][4] % 3)))) {
+        a0[15] = (((v3 > 69) == (v2 + 58)) != ((v3 > v3) < (a1[3][11] < v0)));
+        v2 = (((v1 < v3) / 2) || ((v1 != v1) && (v1 < v2)));
+        a0[6] = (((a1[1][11] < v3) > (19 ? v0 : a0[2])) < ((a0[3] - v3) <= (a1[0][8] - v3)));
+    } else {
+        v3 = (((v0 - v2) ? (a1[3][15] % 4) : (v0 - v1)) || ((v1 && 97) <= (64 == v2)));
+        a1[1][9] = (((v1 > 60) + (a0[9] && a0[3])) < ((a0[0] + 94) + (v3 != v3)));
+        a1[0][7] = (((v1 > a0[1]) != (v3 > a0[2])) * ((a1[2][6] < v0) - (a0[14] >= v1)));
+    }
+    return (((7 != v0) - (a1[0][4] || a0[15])) > ((v3 < v2) < (a0[5] - a0[7])));
+}
+int f1() {
+    int v0 = 29;
+    int v1 = 15;
+    int v2 = 68;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    if ((((82 > 20) % 9) && ((28 ? 25 : 4) > (v2 <= a1[0][7])))) {
+        v1 = (((v1 >= v1) / 7) > ((v1 % 4) < (v1 * a1[3][13])));
+        a0[15] = (((57 >= a0[6]) == (v0 % 2)) <= ((v1 && v1) && (13 - 77)));
+        v2 = (((v0 ? a1[3][9] : v0) < (v0 % 9)) != ((v3 > 14) % 8));
+    } else {
+        v3 = (((v2 ? v2 : a0[4]) >= (22 * v3)) - ((v2 > a0[12]) && (v3 * v3)));
+        v3 = (((v2 - v2) + (v0 != a0[1])) == ((a0[1] % 4) && (93 && v1)));
+        a0[12] = (((27 * v0) * (a1[3][3] < v0)) - ((24 >= 41) ? (v2 % 5) : (v1 ? a0[2] : v1)));
+    }
+    if ((((a1[0][7] != 72) ? (v3 ? a1[3][13] : v2) : (91 + v0)) / 2)) {
+        v1 = (((a0[11] > a0[14]) / 3) > ((a1[2][3] / 5) || (a1[2][0] ? a0[6] : v0)));
+        v1 = (((29 != a1[0][1]) >= (28 + v0)) >= ((v3 > v2) != (49 == v0)));
+        v3 = (((96 % 4) != (83 % 5)) <= ((23 / 2) >= (v1 + v0)));
+    } else {
+        v3 = (((v2 % 9) * (a0[6] ? v1 : v1)) != ((v2 + v0) - (v1 ? a0[14] : a0[2])));
+        v1 = (((a0[11] / 3) < (a1[2][11] != a1[2][3])) >= ((a1[1][3] - a0[2]) != (v3 <= a0[7])));
+        v0 = (((a1[2][11] && v2) + (v1 - 22)) % 3);
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((v2 != a1[3][14]) > 92) break;
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v0 = (((v1 && v2) >= (11 ? v0 : i0)) <= ((a1[3][15] ? 27 : v0) <= (66 == 54)));
+            a1[0][1] = (((v1 % 8) > (a0[8] != v1)) ? ((a1[2][2] + i0) || (a0[3] > 44)) : ((i1 && 55) * (i0 ? 45 : v3)));
+            a1[2][7] = (((i1 * i0) % 4) / 3);
+        }
+        v0 = (((v0 >= a1[0][12]) > (23 == a1[2][10])) * ((66 * v3) ? (30 < v2) : (v0 >= 59)));
+        v1 = (((a0[5] ? v2 : v0) / 1) == ((v0 + a0[2]) + (a1[3][5] == a1[2][10])));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v1 ? 4 : 92) > 71) break;
+        v3 = (((v0 * v2) ? (a1[3][3] == 1) : (16 == v1)) <= ((39 * v1) >= (v3 != 64)));
+        v3 = (((v2 != v1) + (a0[6] * 6)) || ((v0 >= v2) * (v2 + i2)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((i3 < v3) / 7) ? ((a0[14] < 69) % 9) : ((a1[2][9] ? 68 : v1) > (a1[0][15] && 69)));
+                v3 = (((a0[15] < 9) / 8) ? ((v3 ? a0[1] : v2) > (a0[11] - a0[6])) : ((a0[4] - a0[5]) ? (86 && 80) : (v2 && a1[0][15])));
+                v3 = (((83 || i3) + (a0[15] > i3)) > ((a1[2][1] < i2) && (51 <= v1)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+    }
+    a1[2][11] = (((v2 && v3) || (v3 > v1)) && ((24 <= a0[2]) > (a1[0][6] ? a1[0][12] : a0[15])));
+    return (((v0 ? a0[11] : v1) ? (v2 && v0) : (v2 > 42)) - ((a0[7] ? 39 : v0) ? (v0 || v0) : (32 != a0[11])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,133 @@
+int f0() {
+    int v0 = 16;
+    int v1 = 16;
+    int v2 = 26;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v2 != a1[2][0]) % 4) > ((53 <= 44) - (v0 < a1[2][8])));
+    v3 = (((v1 ? v0 : v3) != (45 % 3)) || ((v1 / 2) || (a0[3] - 32)));
+    if ((((v3 > 30) * (v1 - v3)) >= ((a0[2] == v0) > (68 || v2)))) {
+        v3 = (((51 * v1) ? (v3 ? a1[0][8] : a0[12]) : (v2 && v2)) || ((v1 && 93) && (a1[0][13] % 9)));
+        v0 = (((v1 + 20) < (v0 ? v3 : 38)) != ((75 <= v3) && (91 != 29)));
+        v3 = (((27 % 6) ? (5 / 9) : (20 ? v0 : 72)) >= ((a0[11] ? a0[8] : v1) && (a0[11] || v1)));
+    } else {
+        a0[4] = (((v1 <= 67) == (a0[5] || v0)) % 6);
+        a0[3] = (((v0 > a0[11]) || (35 ? v2 : v2)) == ((v1 - 10) < (v3 - v3)));
+        a1[2][11] = (((v3 && v0) * (a0[7] % 8)) ? ((v0 - a1[3][9]) > (1 < v1)) : ((v3 ? v3 : v2) ? (a1[2][6] < 39) : (73 >= v3)));
+    }
+    v0 = (((v3 <= v2) * (v2 * 36)) ? ((a1[0][0] ? 53 : 29) || (a0[4] || v1)) : ((31 == v2) / 4));
+    {
+        int i0 = 0;
+        do {
+            if ((50 - 1) > 52) break;
+            v1 = (((v3 || a1[1][10]) - (a0[10] * i0)) != ((74 < v1) ? (v3 % 2) : (v2 ? v0 : 49)));
+            v2 = (((v1 + v1) ? (a0[5] / 3) : (v0 + v1)) - ((3 ? i0 : v1) < (i0 && i0)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v2 = (((a1[2][5] != i1) != (v0 - v2)) > ((a1[2][4] * v1) >= (i0 ? a1[0][13] : a1[0][10])));
+                v3 = (((52 + 45) + (a0[7] > v0)) ? ((17 ? a0[10] : v0) != (a0[11] != 30)) : ((2 > a0[14]) < (83 % 6)));
+                v2 = (((a1[0][14] ? i1 : v1) % 9) >= ((54 > 76) < (v0 + v0)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    return (((v0 ? 19 : a1[1][4]) + (a0[13] == v3)) > ((23 < v3) * (31 + v0)));
+}
+int f1() {
+    int v0 = 98;
+    int v1 = 90;
+    int v2 = 7;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    a0[10] = (((a1[1][4] == 10) == (89 == v1)) <= ((v1 ? v2 : a0[0]) >= (19 && a1[1][5])));
+    v1 = (((a0[15] % 7) % 3) ? ((63 && 20) >= (v2 != v1)) : ((v1 * a0[12]) - (v0 == a0[1])));
+    v1 = (((v1 + 77) >= (a1[0][13] && a0[2])) > ((v0 < v0) * (v1 * v3)));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((a0[3] / 3) > 72) break;
+            a0[5] = (((a1[0][9] ? v1 : 73) || (a1[2][4] != i0)) - ((v3 == a0[8]) - (v3 % 4)));
+            {
+                int i1 = 0;
+                do {
+                    a1[2][0] = (((29 ? i1 : 24) - (v0 >= i1)) > ((a0[10] % 1) ? (16 || v0) : (v2 == a0[1])));
+                    v2 = (((v3 != v1) / 4) > ((v0 != i1) >= (36 > 14)));
+                    v2 = (((a1[1][5] && 88) % 4) > ((a0[10] != i0) ? (a1[2][5] % 5) : (97 > a0[12])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v0 = (((a0[12] && v3) || (v0 && 75)) != ((v1 + v3) >= (55 && v0)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 != a1[1][14]) % 2) && ((v2 * v2) / 5))) {
+        v0 = (((54 <= 99) <= (v2 <= v3)) / 9);
+        a0[2] = (((v1 || 53) ? (a0[11] == a1[0][12]) : (22 / 9)) && ((v3 && v2) >= (28 <= a0[4])));
+        v1 = (((94 ? v0 : v1) % 3) / 3);
+    } else {
+        v3 = (((a1[2][15] == a1[0][9]) > (v2 == 2)) != ((14 > 96) >= (13 != v3)));
+        a1[1][10] = (((a0[2] < a0[0]) != (a1[2][1] > v0)) || ((71 || v3) - (10 < v3)));
+        v2 = (((a1[0][8] != v3) * (82 ? v3 : v1)) < ((v3 * v2) / 7));
+    }
+    return (((v3 >= a1[1][4]) / 6) && ((v3 - v0) < (v3 && a1[2][15])));
+}
+int f2() {
+    int v0 = 18;
+    int v1 = 64;
+    int v2 = 5;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 >= v2) - (v2 ? 92 : 70)) || ((v1 % 2) % 1))) {
+        a1[0][10] = (((v1 && v2) + (v2 ? v2 : 96)) * ((v1 - 4) > (v3 * v2)));
+        v1 = (((v3 ? v3 : v1) - (v0 - v2)) / 9);
+        v3 = (((a0[14] || v0) > (v0 % 4)) == ((v1 - 53) ? (a1[3][7] <= a0[12]) : (v3 * v3)));
+    } else {
+        v1 = (((v0 * a1[1][2]) >= (v3 || v2)) ? ((a0[6] < v3) || (a1[0][1] - v0)) : ((88 == 35) - (a0[14] % 9)));
+        v2 = (((55 ? v2 : v3) >= (a0[11] > 43)) || ((v3 ? a1[2][7] : v3) != (a0[13] - v3)));
+        a1[2][7] = (((a0[3] / 9) + (v0 ? v0 : v3)) == ((v1 / 8) ? (v1 <= a1[0][2]) : (a0[10] || v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a1[3][10] = (((32 <= v0) % 8) <= ((i1 == i0) != (v3 - v0)));
+                    a0[9] = (((23 ? v2 : 75) || (68 ? a0[2] : v2)) != ((i1 % 1) == (i1 < i0)));
+                    a1[0][1] = (((v2 ? i0 : 18) != (v2 < v0)) - ((22 * i1) - (a0[12] == a0[0])));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[15] = (((90 <= v2) - (v2 + 36)) ? ((83 == v1) ? (a0[0] && a1[0][7]) : (v3 != a1[0][1])) : ((v1 - 12) || (a1[1][15] ? v0 : 87)));
+            v2 = (((v2 - a1[0][1]) || (v3 ? v1 : i0)) || ((8 < 42) % 5));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((26 + 5) > 77) break;
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    if ((a1[0][0] <= 64) > 67) break;
+                    v3 = (((v3 ? v0 : i3) != (89 + a1[3][6])) == ((83 ? 76 : v0) <= (a0[7] == a1[2][4])));
+                    v0 = (((a1[3][15] < v3) ? (v1 < 83) : (i2 + 47)) || ((a1[1][7] + a0[12]) + (v1 ? v0 : i3)));
+                    v1 = (((81 ? v0 : i3) % 8) <= ((25 ? i2 : a0[1]) * (v1 > 75)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((a0[4] < v2) || (a0[10] >= 80)) * ((v1 - v3) == (11 + v0)));
+            v2 = (((v3 / 2) || (a1[0][8] == v3)) >= ((96 % 9) - (a0[8] + v2)));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((a0[9] % 8) ? (v0 <= v2) : (v0 % 8)) && ((a0[11] ? 27 : v3) - (v0 > v0)));
+    a1[1][7] = (((76 - v0) * (v3 ? v2 : a1[3][4])) != ((v1 > a0[0]) % 8));
+    return (((v0 ? v3 : v2) ? (80 && v0) : (v2 + v3)) || ((87 / 5) < (v0 == v0)));
+}
+int main() {
+    return 0;
+}
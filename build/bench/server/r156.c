@@ -0,0 +1,75 @@
+int f0() {
+    int v0 = 84;
+    int v1 = 27;
+    int v2 = 2;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    if ((((53 >= a1[2][12]) >= (a1[3][13] % 8)) && ((a1[1][11] >= a1[1][7]) <= (v1 > a1[3][14])))) {
+        a1[1][11] = (((v3 && v0) < (v3 / 1)) || ((58 || 50) ? (v3 ? a0[2] : a0[14]) : (v1 < a0[9])));
+        a1[0][3] = (((99 % 3) || (15 - 79)) + ((a1[3][14] || v0) <= (29 % 9)));
+        v2 = (((v2 / 6) && (a0[7] <= v1)) == ((39 + v0) / 3));
+    } else {
+        v3 = (((58 >= v0) && (83 > v1)) == ((v0 >= v3) != (v3 - v3)));
+        a1[0][10] = (((v1 <= v2) < (v0 > v0)) == ((72 > 60) ? (a1[3][12] - 19) : (a1[2][0] % 2)));
+        a0[0] = (((16 / 9) ? (a0[15] < a1[0][2]) : (a1[3][2] > a0[13])) > ((a0[14] + v0) + (47 > v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v3 = (((a0[13] + 59) || (i0 + v0)) * ((v2 + v1) || (v2 || 82)));
+            a1[2][10] = (((v1 >= v0) % 7) == ((a0[15] != v2) && (74 != v1)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((a1[0][0] < 31) / 1) && ((99 + a0[4]) != (55 + v3)));
+                    v1 = (((v3 <= 20) ? (a1[1][9] % 7) : (v1 < v0)) * ((v2 ? a0[5] : a0[7]) == (v3 - a1[2][8])));
+                    v1 = (((v2 != v0) >= (45 % 3)) && ((a0[3] < 13) <= (i0 != i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a1[3][10] = (((15 != v3) ? (v3 + a1[2][12]) : (44 % 7)) ? ((v0 - i2) ? (a0[9] < a0[14]) : (i2 || a0[13])) : ((v2 <= 93) < (64 < v3)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((a1[1][2] >= 88) > 91) break;
+                    v3 = (((i3 == 36) <= (v2 / 7)) || ((a1[2][1] % 9) ? (a1[3][2] < 82) : (v0 > a0[0])));
+                    v3 = (((v2 / 1) || (v1 != 27)) <= ((60 * v3) < (i2 && 64)));
+                    v2 = (((v2 >= 34) && (i3 == i2)) ? ((v0 <= v2) > (v3 ? a0[9] : 15)) : ((i2 % 5) < (i3 > v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a0[10] - a0[3]) - (i2 / 3)) >= ((30 + v0) ? (v2 / 1) : (a0[5] > i2)));
+            i2 = i2 + 1;
+        }
+    }
+    a0[3] = (((a0[7] <= v3) > (v0 <= v0)) && ((v2 - 3) >= (v2 ? v2 : a0[5])));
+    {
+        int i4 = 0;
+        do {
+            a1[1][7] = (((v2 ? v2 : v3) < (i4 + v2)) / 6);
+            v3 = (((a1[0][0] != i4) * (43 == 98)) * ((a0[15] || a0[5]) % 6));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    if ((a0[5] - a1[0][10]) > 70) break;
+                    v3 = (((a1[2][15] ? v2 : a0[14]) % 7) + ((v0 == i5) / 8));
+                    v2 = (((v3 == v3) >= (42 > 27)) <= ((54 || a1[2][12]) && (i5 == 55)));
+                    v1 = (((82 >= i5) ? (v3 - a0[2]) : (v3 > a1[2][9])) != ((i5 >= v3) && (a0[11] >= 38)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((85 - 70) % 1) >= ((12 && v0) <= (34 ? a1[0][8] : 40)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,94 @@
+int f0() {
+    int v0 = 93;
+    int v1 = 14;
+    int v2 = 56;
+    int v3 = 62;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                if ((a0[5] + v3) > 71) break;
+                v2 = (((v2 >= a1[3][15]) + (a0[8] % 1)) % 3);
+                v3 = (((a0[1] * v3) != (a0[14] <= i0)) % 4);
+                v1 = (((v2 > v0) >= (i1 && 28)) == ((61 / 5) % 4));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        a0[4] = (((v0 <= 43) % 4) * ((v0 == i0) ? (a0[10] < v1) : (57 && v2)));
+        a0[7] = (((v1 % 1) < (a1[3][2] || i0)) == ((30 >= 50) ? (a1[0][10] < i0) : (a0[7] * a1[0][0])));
+    }
+    a1[3][12] = (((v3 || 40) >= (a0[2] >= v3)) % 4);
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a0[2] = (((64 - v3) / 4) != ((v2 % 9) / 3));
+            v1 = (((i2 || i2) >= (a1[0][14] && i2)) * ((v1 / 9) >= (v0 ? a0[0] : i2)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v0 = (((v2 == 28) <= (a0[14] || 6)) != ((a1[3][15] + 14) % 6));
+                    a1[1][8] = (((v3 * 91) != (2 <= v2)) > ((v3 == v1) <= (i2 * a1[3][10])));
+                    v2 = (((a0[7] + i3) != (68 != v1)) < ((30 || a1[3][0]) > (v3 != v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    a1[1][0] = (((a1[2][9] <= a1[0][10]) ? (v2 - v0) : (a0[14] / 7)) / 3);
+    if ((((v1 >= 67) + (v0 + v2)) ? ((a0[5] - v1) && (a1[3][8] % 6)) : ((v0 ? 27 : a0[3]) || (33 + v3)))) {
+        a1[3][10] = (((v3 % 9) ? (a0[12] >= v2) : (v2 / 8)) != ((v3 != a1[0][2]) < (v2 > v3)));
+        a1[0][14] = (((v0 % 2) ? (80 && v0) : (v0 <= v2)) == ((v2 ? v3 : v0) == (a0[4] + v2)));
+        v2 = (((3 != a1[0][15]) && (a0[14] == a0[11])) < ((v2 || v3) - (v1 || v2)));
+    } else {
+        a0[9] = (((a0[2] <= v3) + (35 + a1[0][12])) > ((v1 + 21) - (v0 >= v2)));
+        v3 = (((v1 ? v0 : 76) ? (v2 <= 59) : (v0 ? 34 : 28)) < ((90 <= a0[11]) ? (v3 <= v1) : (a0[2] + a0[0])));
+        v2 = (((82 == v3) && (a0[5] * 23)) % 1);
+    }
+    return (((v1 || 27) ? (15 - v2) : (56 - 3)) == ((a0[12] * a1[0][4]) <= (6 == v1)));
+}
+int f1() {
+    int v0 = 15;
+    int v1 = 26;
+    int v2 = 81;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 || a1[3][10]) ? (60 || v0) : (v3 == 81)) / 8);
+    v0 = (((v0 - a0[3]) ? (a1[3][9] + a1[0][12]) : (20 > 62)) % 2);
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v2 = (((a0[3] - a0[4]) > (v0 != v3)) < ((i0 > a0[4]) ? (v2 + v1) : (a1[1][3] / 5)));
+        a0[3] = (((v3 <= v3) * (i0 != i0)) / 8);
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            if ((v2 < v2) > 71) break;
+            v3 = (((a0[13] % 3) / 1) == ((0 == i0) != (i0 || v0)));
+            a0[6] = (((v1 <= v2) + (a1[1][11] * v0)) / 9);
+            v3 = (((v2 && a1[2][11]) ? (21 || v1) : (a0[11] - v0)) == ((v3 + v3) ? (10 + i0) : (i0 % 2)));
+        }
+    }
+    v3 = (((a0[3] / 2) && (60 && v2)) > ((a1[0][5] ? a0[5] : 73) && (v2 - v3)));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    if ((a1[1][15] != a0[10]) > 75) break;
+                    v1 = (((i3 / 5) && (v0 > v2)) < ((v2 <= v0) >= (a1[3][7] >= a0[12])));
+                    a1[1][15] = (((12 || i2) && (v2 > i3)) ? ((v3 <= a0[13]) && (v0 <= a1[1][11])) : ((v2 < v1) % 1));
+                    v1 = (((v3 == 11) != (v0 && i2)) + ((i2 / 5) ? (i2 == i2) : (v3 - a0[13])));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((5 + v1) - (52 - v0)) != ((v2 - 97) ? (85 ? 7 : a0[8]) : (27 >= v0)));
+            a0[0] = (((32 - v3) || (v2 < v2)) >= ((a1[0][10] >= a0[7]) / 7));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((v1 && 27) + (a1[1][15] && a0[13])) || ((a1[0][2] == v1) != (a0[3] - 64)));
+}
+int main() {
+    return 0;
+}
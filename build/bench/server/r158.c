@@ -0,0 +1,200 @@
+int f0() {
+    int v0 = 87;
+    int v1 = 19;
+    int v2 = 11;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v2 = (((a1[2][8] < v0) ? (v1 || i1) : (a0[13] - v3)) || ((21 ? a1[0][2] : 6) ? (i1 * a0[10]) : (v3 >= i0)));
+                v2 = (((a1[0][0] != v3) < (i0 && 84)) == ((41 + v0) < (v1 > v2)));
+                v3 = (((i1 * v2) > (v3 || v0)) >= ((v3 ? i0 : i0) <= (53 != i0)));
+            }
+            v1 = (((v0 >= v0) <= (v2 + 54)) / 3);
+            v0 = (((v3 / 9) || (a0[14] + a1[2][4])) && ((i0 ? v0 : 75) ? (v1 + i0) : (v1 + v2)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    v3 = (((v1 - 44) ? (v3 && v3) : (v3 < v3)) && ((v3 + v3) && (v3 > a1[3][0])));
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v2 = (((a1[3][9] && a1[3][15]) + (a0[2] != a0[3])) == ((v2 % 3) || (a1[3][2] ? v2 : v2)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v1 = (((v1 <= v3) * (a1[2][12] / 6)) / 1);
+                    v1 = (((v3 || i3) < (13 ? i2 : 47)) ? ((i2 + v0) * (82 < v1)) : ((a1[2][10] > a0[12]) * (a1[2][14] == i3)));
+                    a0[2] = (((v2 < 23) <= (a0[13] ? v0 : 50)) > ((v3 && i2) ? (i2 % 9) : (5 * 84)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[0][4] = (((44 - 90) - (a1[1][3] <= v1)) == ((i2 - a1[0][4]) - (10 != v2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a0[2] = (((75 < a0[12]) * (i4 && v0)) ? ((i5 > v3) / 3) : ((v2 != v3) + (v3 && i4)));
+                    v1 = (((a0[11] <= i5) >= (v1 < 74)) ? ((93 * v3) - (a1[3][5] * v2)) : ((98 == 81) + (59 ? 98 : a0[10])));
+                    v3 = (((a0[0] - 45) >= (68 <= v1)) < ((a1[1][4] / 2) < (v2 ? i5 : a0[10])));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v2 = (((a0[3] > i4) < (v0 ? v2 : v2)) && ((a1[3][6] + 3) ? (a0[1] > a0[8]) : (70 + i4)));
+            a1[2][15] = (((v1 >= v1) < (v2 || a1[0][14])) && ((v0 == 26) < (24 / 5)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            {
+                int i7 = 0;
+                do {
+                    v3 = (((i6 >= a1[0][6]) > (30 != v1)) - ((v0 ? v3 : v2) <= (v1 == i7)));
+                    v2 = (((59 && v2) && (53 % 6)) - ((39 > v1) - (v0 + a1[1][9])));
+                    v2 = (((v1 == i6) || (11 < i6)) <= ((a1[3][0] - 8) == (53 / 3)));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            a1[0][7] = (((v3 != v0) || (v1 + a1[1][7])) ? ((a1[2][2] + v3) - (30 == v3)) : ((a0[14] < v0) - (57 > a0[5])));
+            v0 = (((a0[6] || a1[2][11]) > (a0[10] != 44)) > ((i6 > v1) >= (40 ? a0[10] : 60)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((a1[3][7] || a0[14]) ? (v0 == 42) : (v2 >= a0[6])) * ((79 * 27) ? (a1[2][7] * v1) : (v0 && 42)));
+}
+int f1() {
+    int v0 = 83;
+    int v1 = 58;
+    int v2 = 62;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v0 = (((v1 % 2) % 4) % 2);
+        {
+            int i1 = 0;
+            do {
+                v2 = (((i1 >= 59) ? (v0 + a1[3][9]) : (a0[8] - 23)) / 3);
+                a0[3] = (((i1 ? a0[0] : v3) ? (a0[12] ? 18 : 27) : (67 < a0[3])) ? ((i1 == 34) || (6 % 8)) : ((32 > a1[2][14]) * (56 > v1)));
+                v2 = (((i0 < v1) <= (v2 + 34)) > ((v1 || a1[0][12]) && (a1[1][1] > v3)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        v3 = (((i0 ? a0[10] : v2) - (v3 ? a1[2][10] : v3)) % 7);
+    }
+    if ((((a0[8] < v3) ? (v1 <= 51) : (79 ? v2 : a0[0])) == ((53 < v3) * (a0[14] <= a1[0][11])))) {
+        v3 = (((35 < a1[2][10]) % 3) / 7);
+        v1 = (((v0 + 25) > (v3 / 9)) < ((76 % 7) <= (15 - a1[3][14])));
+        v1 = (((v3 <= 9) * (v1 < 67)) < ((75 % 3) - (v1 > v0)));
+    } else {
+        v1 = (((38 / 1) == (85 <= v3)) && ((a1[1][11] + 56) <= (v2 * v3)));
+        v2 = (((v0 + a0[2]) > (v1 / 7)) > ((v1 * 9) ? (a0[14] && v1) : (94 != v1)));
+        v2 = (((82 % 8) != (a1[0][7] % 4)) != ((v2 + 47) != (a0[7] > a1[1][5])));
+    }
+    if ((((a1[1][7] ? v2 : v0) % 8) ? ((v0 ? v3 : v0) <= (a0[2] < v3)) : ((76 == 69) < (v0 - 10)))) {
+        a1[3][10] = (((a0[10] != a1[0][9]) ? (v2 < 49) : (v2 && a1[0][15])) + ((v3 ? a1[1][9] : v2) ? (v2 && 48) : (41 || v3)));
+        a0[0] = (((v3 - 92) && (a1[3][15] != v0)) + ((v3 ? a0[0] : v3) != (v3 && a1[2][2])));
+        v2 = (((a0[12] > 61) >= (v0 ? v2 : v3)) + ((96 / 3) != (v1 ? v0 : a0[12])));
+    } else {
+        v2 = (((v3 < 49) <= (a1[2][13] && v0)) * ((a0[7] * 73) ? (2 <= a0[3]) : (v2 != 29)));
+        v3 = (((a0[0] / 8) != (a0[0] + v1)) ? ((a1[0][11] <= v3) ? (a1[0][12] / 3) : (v3 - 69)) : ((a1[1][4] && a1[1][10]) != (a1[1][10] && a0[2])));
+        v2 = (((v3 / 2) != (91 >= 16)) + ((v1 ? v2 : v2) != (v3 <= a0[1])));
+    }
+    v0 = (((89 == v2) * (v3 ? a0[10] : v1)) / 6);
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v1 = (((v2 || a1[0][5]) ? (v2 && a0[12]) : (i3 && 72)) % 6);
+                    v0 = (((1 && i3) ? (50 * a0[12]) : (a0[8] == v3)) && ((v1 % 9) / 1));
+                    a0[5] = (((v3 ? 24 : i2) > (v1 && 42)) || ((32 < v0) / 3));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v3 % 3) > (a1[3][12] >= 24)) == ((v1 % 9) < (94 && 28)));
+            v1 = (((a0[14] != 53) / 9) < ((v3 >= a0[15]) < (v0 != a1[0][9])));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((1 && v1) * (v2 != a1[1][1])) < ((v0 * 53) > (a1[2][1] - 35)));
+}
+int f2() {
+    int v0 = 91;
+    int v1 = 22;
+    int v2 = 28;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((a1[0][9] == v1) % 9) + ((65 > v1) <= (v2 > i0)));
+                a0[4] = (((a1[1][4] % 1) ? (v1 ? a1[2][4] : a0[5]) : (14 + 21)) && ((53 || v0) && (i0 == a0[0])));
+                v1 = (((a1[3][12] - v1) ? (v0 / 3) : (a1[3][4] <= v2)) == ((v1 ? v3 : i0) > (a0[6] * 87)));
+            }
+            a1[3][7] = (((80 / 9) * (a1[3][15] == a0[2])) + ((v3 == v3) / 1));
+            a1[2][2] = (((v0 - a1[0][13]) % 4) % 7);
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 > 34) > 81) break;
+            v0 = (((v1 ? a0[8] : v1) < (v1 && v0)) != ((v0 + v2) >= (a0[13] && i2)));
+            v3 = (((v0 % 8) - (v3 == 98)) % 6);
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((v0 ? v0 : a1[0][5]) > 89) break;
+                    a1[3][10] = (((10 == v2) ? (a1[1][15] - i3) : (a1[2][14] != v1)) < ((v2 ? v0 : 51) <= (90 != 54)));
+                    v1 = (((a1[0][10] + 8) / 8) && ((a0[0] != i3) && (86 || 39)));
+                    v2 = (((v3 / 1) ? (i3 + v1) : (24 ? v3 : a1[1][7])) < ((56 < 25) != (i3 - i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((v0 + 64) > 69) break;
+            v0 = (((a0[0] == 75) % 9) % 7);
+            v3 = (((a0[9] % 9) > (88 ? a0[1] : v0)) - ((v3 % 2) + (v2 > v2)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v2 = (((94 ? 99 : v2) % 2) % 6);
+                a1[2][7] = (((v0 > a1[2][0]) != (v1 ? a0[7] : a1[2][8])) < ((a0[0] / 2) - (v2 && a1[0][10])));
+                v3 = (((a1[3][10] < a1[1][7]) / 8) > ((a0[7] + v2) < (v2 == v1)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[5] * v1) > (v0 || a1[3][3])) > ((v2 ? v2 : v0) == (a0[3] != 19)))) {
+        v0 = (((a0[4] / 8) ? (39 != v0) : (20 == a1[1][3])) && ((8 / 6) * (v1 || 1)));
+        a0[0] = (((v1 < v2) || (23 % 9)) != ((v3 >= v2) || (v0 >= 38)));
+        v1 = (((13 ? v2 : v3) && (v2 && a0[4])) / 9);
+    } else {
+        a0[12] = (((5 % 7) % 7) + ((v0 ? v2 : v1) ? (v0 == 17) : (70 - v3)));
+        a0[14] = (((36 && a1[0][13]) == (a1[3][14] / 1)) != ((v1 ? v1 : v2) % 3));
+        a1[2][12] = (((v3 != 79) + (87 >= a1[3][1])) ? ((a1[3][5] - 6) % 3) : ((88 && v3) ? (0 * a1[2][7]) : (v1 ? v0 : v2)));
+    }
+    v0 = (((v1 <= a0[8]) + (76 && 44)) ? ((a1[0][14] > 90) + (70 / 7)) : ((v0 < 19) || (7 + 24)));
+    return (((v2 || a1[3][12]) - (a1[3][13] && 38)) ? ((89 || a1[2][4]) == (83 || v3)) : ((v0 < 83) / 8));
+}
+int main() {
+    return 0;
+}
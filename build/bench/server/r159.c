@@ -0,0 +1,66 @@
+int f0() {
+    int v0 = 20;
+    int v1 = 58;
+    int v2 = 11;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 ? 42 : 93) > 55) break;
+            v2 = (((v0 <= v1) - (i0 >= v1)) + ((a1[2][9] - a1[1][4]) + (v1 >= i0)));
+            v0 = (((v2 + i0) && (a1[3][8] * v3)) + ((v0 && v2) < (v0 >= 45)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a1[2][15] = (((91 * i1) * (v1 >= i0)) || ((v1 >= i0) == (25 > i0)));
+                    a0[3] = (((a1[0][8] > v0) >= (i1 * a1[3][5])) % 5);
+                    v2 = (((a1[1][4] / 8) <= (v0 > a0[12])) >= ((a0[10] < v3) < (37 != 65)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((71 ? v3 : v2) > (86 ? a1[3][3] : a0[13])) ? ((a1[3][11] ? v3 : a1[2][2]) ? (a1[1][5] / 6) : (a1[1][13] <= a0[2])) : ((v3 || v2) ? (90 ? v0 : 66) : (v1 ? v2 : a0[7])))) {
+        v1 = (((66 <= v1) + (v1 + 61)) < ((v0 >= 77) - (98 - v2)));
+        a1[1][10] = (((v0 - a1[2][11]) ? (41 != 17) : (54 == v2)) != ((a1[2][14] || a1[3][14]) - (a1[2][14] <= a0[9])));
+        v3 = (((v3 || 21) > (v2 - a0[2])) != ((a0[2] == 51) >= (v1 || v3)));
+    } else {
+        a1[1][11] = (((v1 ? a0[7] : 73) ? (21 ? v1 : 32) : (82 < a1[1][4])) - ((v2 - a1[0][11]) && (v1 * v0)));
+        a0[6] = (((a0[8] / 4) ? (v0 / 7) : (a1[2][14] + 58)) / 3);
+        a0[2] = (((a1[0][15] - v2) <= (76 > a0[9])) ? ((21 < a0[8]) >= (a0[5] >= a0[3])) : ((59 <= v0) == (35 ? v3 : v0)));
+    }
+    a1[3][11] = (((a0[14] + 15) >= (v1 || v2)) ? ((a1[2][7] >= a0[10]) <= (v1 ? 18 : a0[5])) : ((v0 || 57) < (a0[11] ? v0 : v1)));
+    {
+        int i2 = 0;
+        do {
+            v2 = (((44 <= 82) ? (51 == v0) : (v3 - a1[3][3])) / 6);
+            a1[3][0] = (((90 / 4) * (81 * v1)) < ((i2 * v0) || (a1[0][11] / 3)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((54 + a0[10]) * (68 != i2)) / 9);
+                    v3 = (((v3 ? 28 : i3) ? (62 ? a0[7] : 19) : (a1[0][0] || 14)) == ((a0[10] ? i3 : i3) % 6));
+                    v3 = (((v0 || v3) / 1) ? ((v1 || a0[4]) <= (v1 / 2)) : ((v1 == v1) > (a1[0][4] ? 40 : 19)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((v0 || v1) && (v2 > v3)) * ((71 + a0[3]) - (v2 + v2)))) {
+        v2 = (((v1 ? v0 : v1) == (v1 / 6)) <= ((8 + 16) ? (a1[1][4] || a0[8]) : (v2 % 6)));
+        a0[8] = (((v1 ? a1[3][13] : v1) ? (v3 / 1) : (v2 == a0[3])) + ((a1[3][14] < v1) || (a1[0][15] % 8)));
+        v3 = (((a0[14] != 87) == (58 || v1)) < ((v3 * v0) ? (v1 >= a0[1]) : (v2 > v2)));
+    } else {
+        v0 = (((a1[2][12] + 98) == (78 > 11)) % 6);
+        v2 = (((v0 != a1[1][8]) * (v0 <= 22)) * ((15 * 94) * (v1 || a1[0][5])));
+        v3 = (((60 - v2) ? (a1[1][2] != v3) : (a0[0] <= a1[0][1])) != ((52 / 1) >= (v1 <= a0[1])));
+    }
+    return (((51 == a0[6]) >= (a0[3] / 7)) && ((a1[1][12] ? 99 : a1[2][8]) ? (79 ? 31 : 83) : (v3 / 5)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,140 @@
+int f0() {
+    int v0 = 82;
+    int v1 = 47;
+    int v2 = 27;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[0][0] = (((v3 >= v0) || (0 == a0[8])) ? ((a0[7] >= v3) % 7) : ((v1 - 81) >= (v3 <= v1)));
+            a1[2][1] = (((a0[7] < 57) == (a0[6] > v1)) + ((56 && v3) % 3));
+            {
+                int i1 = 0;
+                do {
+                    a0[0] = (((i0 % 9) > (a0[15] ? v2 : v2)) > ((89 ? a0[4] : i1) < (i0 || a0[6])));
+                    a0[13] = (((55 ? 36 : v1) && (a1[1][4] / 5)) + ((i1 >= v1) - (a0[7] != v3)));
+                    a1[0][6] = (((52 && i0) + (i0 ? i0 : a0[14])) % 7);
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v3 = (((a1[2][13] < v0) || (88 * v0)) >= ((v1 != i3) || (36 == 23)));
+                v3 = (((v1 != a0[13]) / 5) != ((i2 ? a0[14] : 68) + (a0[3] - 44)));
+                a1[0][11] = (((i2 < i3) != (a1[3][4] == 90)) <= ((a0[8] ? v0 : 73) >= (i3 == 42)));
+            }
+            v0 = (((a1[2][14] && a1[0][15]) > (v3 ? a1[1][8] : i2)) && ((v0 >= v3) < (a0[5] <= v1)));
+            v0 = (((v0 % 5) && (i2 + v0)) != ((v3 + v1) > (a1[0][5] && i2)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        if ((i4 && v1) > 90) break;
+        v3 = (((a0[6] != a1[3][4]) / 2) <= ((v3 || v2) && (64 != v2)));
+        v1 = (((v1 >= v0) != (v0 < 51)) * ((86 + v1) || (28 <= i4)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((a0[5] <= i4) && (a0[15] > a1[0][6])) % 2);
+                v3 = (((75 ? 98 : 62) <= (v1 - 68)) * ((i5 + v2) ? (v0 - v2) : (18 - v2)));
+                a1[3][7] = (((i5 ? 44 : v2) == (a1[0][6] / 3)) * ((v0 ? a0[15] : a0[15]) <= (v3 > 36)));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    v3 = (((67 < 30) == (a0[3] < v1)) / 5);
+                    a1[2][5] = (((36 <= v2) <= (a0[11] <= v3)) % 4);
+                    a1[2][13] = (((v2 != 53) ? (21 % 9) : (v1 > v2)) || ((v1 > a0[14]) * (v3 * i6)));
+                    i7 = i7 + 1;
+                }
+            }
+            a0[4] = (((v2 || 38) % 7) % 3);
+            v2 = (((v1 == v0) ? (v0 <= a1[0][7]) : (26 >= 80)) || ((a1[1][9] != v1) || (v3 != a0[14])));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[3] = (((v2 - 43) % 2) + ((v1 / 1) != (a1[1][15] % 6)));
+            for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+                v1 = (((a0[4] || i8) < (29 < i8)) * ((a0[15] + i9) > (a0[15] == v0)));
+                v2 = (((6 ? v3 : a0[10]) % 6) ? ((v3 > v0) || (19 - v3)) : ((42 ? i8 : 35) + (96 ? v2 : 22)));
+                v1 = (((a1[1][1] <= v0) != (93 <= a1[2][11])) == ((v3 >= a0[10]) || (71 < 76)));
+            }
+            v2 = (((i8 * v2) == (92 <= v1)) <= ((v2 ? a0[11] : a0[14]) ? (39 <= a0[4]) : (v2 ? a0[5] : a1[0][11])));
+            i8 = i8 + 1;
+        } while (i8 < 5);
+    }
+    return (((v0 / 2) < (v0 || v2)) * ((a0[11] % 6) - (a1[2][15] + 61)));
+}
+int f1() {
+    int v0 = 95;
+    int v1 = 93;
+    int v2 = 24;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 && v2) == (14 <= v1)) * ((a0[13] && v3) < (18 >= v1)))) {
+        v1 = (((v3 < v0) ? (77 > v0) : (v2 == v2)) - ((58 ? v2 : 46) < (a0[8] + 8)));
+        a0[4] = (((a1[3][4] || v2) && (a0[7] == v1)) ? ((42 ? a1[0][4] : 25) != (v0 != v0)) : ((v2 < 67) && (v0 + v1)));
+        v3 = (((a0[1] >= 57) != (v0 % 8)) && ((a0[8] && a1[3][6]) || (v3 - 79)));
+    } else {
+        v0 = (((80 == 43) && (v0 == v3)) ? ((v0 * v3) >= (41 - v2)) : ((48 > 62) / 4));
+        v1 = (((69 == v0) * (v1 && a0[14])) ? ((v1 / 7) || (v1 * a1[0][4])) : ((v3 ? v3 : 58) || (v3 || 40)));
+        v3 = (((24 ? v1 : v3) / 4) - ((v2 == v0) / 1));
+    }
+    v3 = (((v1 && 17) > (v1 < v2)) != ((a1[0][11] - v2) >= (a1[2][2] <= v0)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v3 = (((v3 < 48) ? (v2 ? v0 : v2) : (a0[8] % 9)) <= ((84 <= i0) ? (30 + v0) : (a0[7] != a1[0][3])));
+        a1[2][12] = (((i0 != v0) == (v1 ? v1 : 22)) * ((a0[14] > i0) == (a1[1][13] < v0)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v1 = (((v2 >= 53) * (v2 && a1[1][5])) ? ((v2 * a1[2][6]) % 3) : ((i0 != 32) % 5));
+            a0[13] = (((i0 || v3) != (i1 != a0[12])) + ((i1 ? 88 : 2) / 1));
+            a1[3][13] = (((v0 + a1[0][10]) ? (1 * 69) : (v1 == 14)) % 3);
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v3 = (((i3 ? i2 : v1) ? (v3 ? a1[3][14] : a0[3]) : (a0[11] % 6)) != ((i2 % 2) + (51 < v3)));
+            v2 = (((8 * v1) - (v0 == a1[0][12])) + ((i3 + a0[11]) != (4 - v1)));
+            a1[2][10] = (((a1[1][4] + a0[9]) - (72 < v2)) + ((a0[13] && i3) ? (51 != v3) : (a1[0][12] * a0[11])));
+        }
+        v2 = (((a0[3] ? v2 : 14) != (v3 <= a0[9])) >= ((59 - 90) && (v1 <= v1)));
+        v0 = (((v1 != v1) < (i2 ? v1 : 8)) == ((a0[15] / 5) > (v0 ? v3 : i2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[1] = (((a1[1][14] - v2) >= (i4 < v0)) < ((36 ? a1[1][13] : v2) < (3 * v0)));
+            {
+                int i5 = 0;
+                do {
+                    a0[13] = (((v0 * 33) > (v2 || 28)) != ((38 <= v3) * (i4 / 9)));
+                    a0[13] = (((22 || a0[10]) % 3) > ((v3 < 71) * (a1[1][6] || a1[3][11])));
+                    a0[14] = (((32 != i5) > (75 != v3)) <= ((v0 > i4) || (a1[0][15] != 18)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v1 = (((v2 <= 27) < (i4 - 67)) >= ((a1[0][4] != a1[3][2]) * (3 == v1)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[1][4] || v1) != (79 && v1)) && ((v0 || v0) * (v1 / 8)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,176 @@
+int f0() {
+    int v0 = 59;
+    int v1 = 63;
+    int v2 = 94;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][14] % 6) + (v1 && 27)) % 3)) {
+        v2 = (((v3 && a0[10]) && (a1[3][1] >= 44)) && ((v1 < a1[2][10]) < (v0 > a1[0][10])));
+        v0 = (((88 <= v0) <= (v3 < v0)) || ((a1[0][7] * 22) == (a1[3][15] && v3)));
+        v0 = (((a0[0] >= a1[0][14]) * (34 + a0[9])) > ((a1[3][13] ? v3 : v2) <= (v1 < a1[2][5])));
+    } else {
+        a0[7] = (((a1[3][10] % 5) / 7) * ((v0 > v2) % 6));
+        v2 = (((30 < v2) % 3) >= ((54 && 90) ? (v2 == v2) : (v2 && 57)));
+        v2 = (((v0 || v3) ? (v2 + a1[0][11]) : (95 + 51)) || ((a0[6] % 8) < (a1[0][0] >= a0[1])));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((49 < v3) > 94) break;
+        v3 = (((i0 != i0) >= (36 % 6)) > ((v3 * v1) + (33 + v0)));
+        a1[3][15] = (((v1 + 71) >= (v3 + v3)) / 3);
+        {
+            int i1 = 0;
+            do {
+                if ((3 != v0) > 56) break;
+                v2 = (((a0[5] >= i1) <= (a1[0][15] >= a0[12])) >= ((57 ? 83 : a1[3][4]) < (a1[1][8] != i1)));
+                a0[8] = (((a0[8] % 8) < (v2 >= v0)) >= ((25 % 1) ? (v3 % 6) : (v0 ? v3 : 70)));
+                v2 = (((46 != 94) * (i1 > v3)) ? ((v1 * 93) * (a1[1][7] - v2)) : ((v3 % 8) == (v0 / 8)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+    }
+    v1 = (((v3 >= a1[0][9]) / 7) < ((22 || a1[2][11]) + (v3 > 75)));
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a0[11] ? i2 : a1[1][13]) && (v3 < a0[10])) >= ((10 * 39) <= (47 < 99)));
+            a1[0][13] = (((98 >= a1[1][5]) ? (v1 % 5) : (v2 * a0[6])) <= ((i2 < v1) || (89 <= 35)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((22 < 53) != (a0[1] < 20)) ? ((73 || 63) == (a0[0] >= 95)) : ((v1 % 1) - (v1 ? v2 : v2)));
+                    a0[7] = (((a0[8] < v2) || (a0[11] != i2)) ? ((a0[10] < v1) + (a1[1][10] ? a0[3] : 28)) : ((v0 != i2) < (92 || v2)));
+                    a0[12] = (((i2 % 4) / 5) < ((i2 < a0[3]) % 1));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v2 = (((a0[13] == 8) / 5) ? ((74 && a0[13]) < (v1 ? a0[7] : 14)) : ((52 != a1[3][12]) % 3));
+    return (((a0[9] != 94) ? (v0 - a1[2][1]) : (v1 != 67)) * ((45 || v1) == (v3 || a1[0][1])));
+}
+int f1() {
+    int v0 = 16;
+    int v1 = 11;
+    int v2 = 78;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a0[5] - a0[13]) != (10 <= v1)) * ((54 > a0[2]) > (v1 == 88)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v2 > 41) > 57) break;
+                    a0[0] = (((v0 != 70) > (a1[3][13] < v3)) < ((6 <= v0) && (82 - 28)));
+                    v2 = (((a1[2][0] * 80) >= (36 ? a1[2][10] : v3)) < ((a0[1] != a1[2][8]) - (i1 && i1)));
+                    v0 = (((97 * i0) ? (a1[3][15] % 8) : (v1 ? 28 : a1[1][9])) >= ((v0 && i0) * (v0 == a0[3])));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            a1[2][2] = (((a0[0] <= v1) <= (a1[1][2] > 18)) ? ((a1[0][15] % 8) - (v3 || v1)) : ((83 - 99) - (v3 < 96)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((92 < v3) * (v3 ? v3 : v2)) >= ((v1 * 53) ? (v1 || v1) : (v0 < v3)))) {
+        v3 = (((v2 * 11) || (29 > v0)) <= ((a0[12] % 5) / 8));
+        v0 = (((a1[3][12] ? a0[10] : a0[13]) * (a1[0][3] * v1)) == ((16 * 52) != (89 * v3)));
+        a1[0][9] = (((v1 != a0[14]) <= (a1[2][3] - v3)) >= ((a1[3][15] || a1[1][8]) >= (41 >= 15)));
+    } else {
+        a1[2][13] = (((v0 - v3) == (81 || v3)) - ((v2 - 84) < (v2 / 2)));
+        v0 = (((a0[11] < v0) * (33 < a1[0][12])) / 4);
+        v2 = (((v0 && a0[5]) < (a1[0][10] && v1)) <= ((v2 || a1[3][2]) + (v3 != 59)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a0[0] = (((v1 + 8) <= (a0[2] || a1[3][6])) ? ((a1[1][15] == v0) - (i2 / 3)) : ((10 || a1[0][14]) <= (v1 <= a0[6])));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v2 = (((42 < v3) < (v1 <= 60)) ? ((56 >= 16) / 9) : ((v3 - v3) < (a0[11] || v2)));
+            a0[13] = (((a1[2][15] % 5) >= (v1 ? i2 : a0[6])) <= ((a1[0][5] ? v0 : i3) ? (v0 < v3) : (i3 - a0[3])));
+            v1 = (((i2 == a0[0]) - (a0[3] ? i2 : 1)) < ((i2 + 53) == (28 / 6)));
+        }
+        a0[13] = (((a1[0][9] > v2) && (a1[3][6] ? v0 : 83)) - ((i2 * v1) * (a1[1][5] % 7)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v2 || v1) > 80) break;
+            a1[0][3] = (((v2 == a0[4]) > (8 % 7)) * ((a0[3] <= 26) <= (68 ? 54 : 80)));
+            v2 = (((50 || v2) ? (47 % 9) : (v2 + v2)) % 2);
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v0 = (((44 * i5) - (a0[15] || v0)) / 6);
+                    v1 = (((a1[3][0] - 65) + (a0[5] ? 47 : v2)) * ((v3 > a0[12]) > (a1[3][13] / 5)));
+                    v3 = (((v1 * v3) || (3 - v2)) >= ((v2 < a1[0][14]) && (i5 || i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    a1[2][3] = (((v2 && v2) + (v0 - 35)) % 6);
+    return (((26 && v1) + (v2 / 4)) <= ((17 % 2) >= (a1[3][8] >= v1)));
+}
+int f2() {
+    int v0 = 34;
+    int v1 = 1;
+    int v2 = 46;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 * a0[5]) > 99) break;
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a1[2][6] <= v3) && (a1[0][0] >= i0)) % 1);
+                    v3 = (((12 ? v2 : 88) || (v1 ? a0[10] : v3)) && ((v0 < 64) <= (82 >= 79)));
+                    v0 = (((85 / 2) == (86 <= a1[0][3])) / 5);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v3 = (((v0 != 32) < (v0 % 1)) - ((v1 > v0) % 2));
+            a0[6] = (((a0[0] >= i0) - (i0 <= v1)) < ((72 - v0) <= (i0 % 1)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((v1 == v3) / 1) * ((v3 == a0[3]) ? (v3 - a0[11]) : (a0[1] - v2)))) {
+        v1 = (((a1[3][0] - 81) < (22 % 6)) ? ((v1 ? a0[3] : 57) < (73 > a1[1][10])) : ((v1 || a0[3]) && (v0 || v0)));
+        a0[2] = (((v0 / 4) % 5) && ((v3 * 18) != (v2 * v3)));
+        a1[2][5] = (((a1[0][6] != v0) * (a1[3][3] % 3)) + ((a1[3][3] ? 92 : v3) > (v2 < v0)));
+    } else {
+        a0[7] = (((a1[2][9] < v0) ? (25 ? v3 : v2) : (a0[9] >= a1[1][1])) >= ((v3 < 90) ? (77 < 53) : (a0[12] < v3)));
+        v3 = (((v3 % 1) / 2) < ((v3 || v3) != (7 > v1)));
+        v1 = (((v0 <= a1[3][0]) && (85 || a1[2][4])) == ((55 - 22) % 2));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((40 ? a1[1][4] : i2) > 66) break;
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            if ((v3 <= a1[0][1]) > 78) break;
+            v2 = (((v0 + a0[12]) || (12 > a1[1][14])) > ((95 / 2) % 9));
+            v1 = (((i2 ? v2 : a1[0][3]) - (92 * v1)) % 3);
+            v1 = (((60 ? a0[10] : 38) * (99 == a0[10])) > ((v1 * v1) - (i2 - v0)));
+        }
+        v2 = (((a0[7] ? a0[10] : i2) >= (v1 ? a1[0][8] : i2)) != ((a1[3][11] ? v3 : v2) - (i2 <= i2)));
+        v3 = (((35 >= i2) && (v0 > a1[2][2])) - ((v1 * v3) < (11 >= v3)));
+    }
+    if ((((a0[4] / 5) > (91 != v3)) <= ((4 - v3) > (83 + 56)))) {
+        a0[6] = (((v0 < v1) && (a1[2][14] == 99)) >= ((56 * a0[5]) == (33 && v0)));
+        v3 = (((v0 / 6) > (v1 ? v3 : a0[11])) >= ((v0 && 25) || (v3 && v3)));
+        v0 = (((32 > v2) <= (38 % 8)) - ((v0 - v0) != (8 ? v2 : 68)));
+    } else {
+        v3 = (((v0 / 1) - (a0[7] == a1[3][6])) / 9);
+        v2 = (((v1 != v1) / 9) <= ((a0[3] / 2) % 3));
+        v1 = (((v3 - v3) == (v3 < v1)) == ((v2 >= 34) == (v1 != v1)));
+    }
+    v0 = (((30 + 64) + (v1 ? 88 : a0[12])) >= ((v0 >= a0[0]) != (v3 > a1[3][8])));
+    return (((v1 && 78) && (v1 > 21)) <= ((a0[5] * v2) > (v0 ? v0 : v1)));
+}
+int main() {
+    return 0;
+}
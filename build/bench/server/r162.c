@@ -0,0 +1,80 @@
+int f0() {
+    int v0 = 17;
+    int v1 = 22;
+    int v2 = 91;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 == v1) == (77 * v2)) * ((v2 || v0) || (a1[2][3] - v0)))) {
+        v1 = (((v3 % 1) - (a1[0][9] < 87)) > ((85 && v2) ? (a0[11] % 2) : (v1 ? v0 : 95)));
+        a1[0][4] = (((a0[1] % 7) != (v0 * v2)) < ((a0[9] + 19) <= (62 * 41)));
+        a0[10] = (((v1 + 63) != (a0[10] || v1)) || ((a1[1][8] || 22) >= (v2 + v0)));
+    } else {
+        v1 = (((v3 ? v3 : 49) > (a0[1] >= v0)) != ((60 ? 30 : 93) % 9));
+        a1[3][6] = (((v1 - v3) / 6) ? ((a1[1][12] ? v0 : v1) < (0 < a0[12])) : ((v3 && v2) == (a0[5] * 16)));
+        v2 = (((v3 >= v3) ? (v2 * v0) : (50 + v1)) >= ((22 % 1) < (a0[13] == a1[2][6])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a1[0][6] + a0[11]) >= (a0[11] || v2)) / 7);
+            a0[12] = (((43 * a1[0][12]) || (a0[15] - a0[4])) || ((v0 - a0[9]) && (v1 ? 37 : a0[14])));
+            {
+                int i1 = 0;
+                do {
+                    if ((v2 % 5) > 67) break;
+                    a1[0][0] = (((2 + 2) / 2) ? ((a0[8] <= i0) && (i1 >= a0[7])) : ((a1[0][7] <= i1) - (91 && i1)));
+                    v2 = (((v0 ? 75 : v1) < (a1[3][10] == v2)) < ((80 && v1) || (v2 + i0)));
+                    v2 = (((i1 + 18) <= (79 * 40)) + ((43 >= i0) >= (a1[0][5] || 95)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v0 = (((70 == v0) ? (v0 % 6) : (v0 != 90)) >= ((33 < 15) - (36 != a0[6])));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                if ((v1 ? v3 : 11) > 51) break;
+                v3 = (((v2 && v2) / 3) % 4);
+                a0[2] = (((56 ? v1 : 94) != (v3 ? v1 : v3)) && ((44 == 79) == (i2 * v3)));
+                v1 = (((v0 < v1) ? (a1[3][8] >= a0[8]) : (v0 / 4)) % 1);
+            }
+            a1[2][11] = (((a1[0][15] && 21) ? (v0 - v2) : (i2 + a0[9])) <= ((a0[0] ? v2 : v2) <= (v2 % 1)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 % 3) && (a1[0][0] > v3)) - ((a1[3][2] % 8) > (v3 + a0[5])))) {
+        v3 = (((v0 == v0) + (38 <= a1[3][4])) > ((v0 / 6) / 8));
+        v3 = (((a1[0][11] > 33) >= (v1 || v0)) && ((v1 != a1[3][15]) ? (v0 && v1) : (v1 < v2)));
+        v0 = (((v2 || v1) / 5) && ((47 <= v2) && (10 != v2)));
+    } else {
+        v1 = (((a0[5] % 3) == (v2 <= a0[1])) >= ((v3 < v2) > (38 >= a0[7])));
+        a1[3][12] = (((v2 % 2) != (v1 != 18)) != ((19 % 2) ? (45 < v2) : (a0[14] && v3)));
+        v3 = (((1 ? a0[9] : a1[2][10]) <= (54 <= v0)) > ((6 < v1) && (v3 > a0[3])));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    if ((i4 - v1) > 86) break;
+                    v3 = (((v2 / 9) > (v2 % 4)) != ((85 >= 0) * (i4 > i4)));
+                    v1 = (((a0[6] <= 82) ? (a1[0][9] == a0[0]) : (a0[12] ? a0[2] : 35)) * ((v2 != 81) && (v1 == 30)));
+                    v2 = (((24 % 1) < (v0 + v0)) > ((24 ? i4 : v3) == (i4 * v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v0 = (((97 >= 94) || (a0[5] * v1)) / 6);
+            v1 = (((i4 % 1) + (a1[0][10] > v0)) / 4);
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((72 == 2) ? (a1[3][6] ? 84 : 22) : (v0 ? v1 : 16)) * ((a0[7] == v0) == (a1[0][6] ? v3 : v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,140 @@
+int f0() {
+    int v0 = 76;
+    int v1 = 58;
+    int v2 = 89;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    if ((((7 ? v0 : v2) > (a1[0][3] < v3)) / 2)) {
+        v1 = (((a1[0][7] % 6) * (71 / 2)) && ((v1 != v0) % 6));
+        v0 = (((a1[0][1] * v1) < (v1 >= a0[10])) ? ((a1[2][13] > 86) == (10 && 76)) : ((v1 - 12) < (52 + a0[7])));
+        v1 = (((v3 == v3) ? (92 - v2) : (v1 / 8)) % 2);
+    } else {
+        v2 = (((a0[9] + a0[3]) - (v2 * v1)) - ((a1[1][6] < v1) != (v2 <= v1)));
+        v2 = (((v0 * v0) ? (v1 ? v0 : a1[0][1]) : (a0[5] % 4)) && ((a1[3][5] != 73) >= (v1 - v2)));
+        a1[0][5] = (((a1[1][15] - v3) / 1) ? ((v3 >= a0[1]) >= (15 > v1)) : ((98 == a0[10]) < (v3 >= 96)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a0[12] = (((v2 || v2) - (a1[2][4] % 6)) ? ((a1[1][5] + 53) && (v3 < a0[6])) : ((i0 == v3) || (i0 || 99)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((v1 > i0) <= (a1[0][2] % 1)) < ((v2 ? 98 : v1) / 8));
+                a0[0] = (((a1[0][5] * v1) == (i0 ? a0[14] : i0)) == ((v1 ? 90 : v2) / 2));
+                v3 = (((a0[11] % 8) ? (92 + i1) : (v2 % 2)) * ((v3 > 26) * (a0[6] >= 30)));
+            }
+            v1 = (((v0 <= v3) / 3) > ((v0 / 2) || (v1 + v3)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((77 + v0) >= (a0[15] == v1)) < ((i2 != 52) && (72 && i2)));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v2 = (((v0 * i2) < (v3 ? i2 : v3)) <= ((24 % 3) + (i3 % 2)));
+                v2 = (((a0[6] > a1[2][12]) + (58 || a0[12])) < ((v0 / 8) - (10 >= 34)));
+                v2 = (((a1[3][8] - 4) / 4) + ((v0 && i3) ? (81 - i2) : (v1 != a1[3][8])));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v0 <= v1) <= (v3 ? v1 : 93)) >= ((v3 >= a0[5]) > (a0[6] > v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[14] = (((v1 || v1) >= (v0 + 53)) || ((v3 > v0) ? (90 ? 44 : a0[9]) : (56 <= v1)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v3 = (((i5 >= a0[6]) >= (v3 < v0)) != ((i4 == v3) / 8));
+                v3 = (((a1[1][8] && 20) || (41 + i4)) && ((a1[0][6] < a0[12]) <= (v0 + a1[0][8])));
+                v1 = (((v1 == i4) && (a1[2][2] - a1[1][8])) && ((v0 % 4) <= (65 || i5)));
+            }
+            a1[3][3] = (((0 / 8) != (v0 ? v0 : v0)) <= ((v3 == 13) && (31 / 9)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v3 = (((v2 + v1) + (a1[3][7] ? v2 : 7)) < ((a1[0][10] / 6) <= (i6 - v3)));
+            a1[2][1] = (((v0 != a1[3][5]) != (a1[1][9] - 12)) <= ((a1[2][7] != v2) || (14 != v3)));
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((v3 * 72) && (a0[5] >= 38)) > ((a1[2][15] * i7) && (a1[2][8] && i6)));
+                    v3 = (((98 != a0[1]) + (a1[3][15] || v2)) ? ((v1 + 76) || (a0[15] ? 46 : i7)) : ((a0[15] == 95) && (20 + i7)));
+                    a0[3] = (((v3 ? a0[3] : v1) ? (51 * v2) : (v3 && a1[3][2])) > ((i7 < a1[2][15]) <= (a1[1][0] / 4)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v2 - v0) == (a0[4] % 5)) < ((a0[2] - v3) * (v3 + v1)));
+}
+int f1() {
+    int v0 = 21;
+    int v1 = 46;
+    int v2 = 76;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][12] + v0) * (a0[10] <= a1[0][4])) == ((v1 * v2) >= (69 + 97)))) {
+        v2 = (((87 || v3) ? (v2 % 6) : (v0 && v0)) ? ((v0 || a1[1][6]) == (a0[2] - v1)) : ((93 / 1) / 6));
+        v2 = (((v0 || v1) - (v1 - v2)) != ((39 * a1[1][5]) / 6));
+        v3 = (((a0[8] / 8) * (v0 / 7)) >= ((v2 ? v0 : v1) < (v0 != v3)));
+    } else {
+        a1[2][9] = (((v0 >= 89) ? (v0 * v3) : (a1[3][12] != v0)) <= ((v1 - 57) + (66 > v0)));
+        v1 = (((v0 != v0) + (v2 != a1[2][4])) ? ((a1[2][4] > v0) + (v2 == v2)) : ((a1[2][8] <= a0[3]) < (v3 ? a1[3][2] : a1[3][1])));
+        a1[1][8] = (((v1 - a0[15]) % 9) || ((v1 - v1) <= (v0 && a1[2][3])));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a0[1] = (((v2 >= a0[2]) + (i0 + a0[8])) <= ((a0[5] % 2) != (a0[11] ? v2 : v0)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                a0[11] = (((a0[10] % 4) - (i1 ? v1 : 59)) <= ((40 <= 89) == (v3 != 5)));
+                a1[0][9] = (((a0[4] % 3) - (v3 > 82)) % 1);
+                v1 = (((v3 ? a0[10] : v1) != (v1 != a1[3][1])) < ((a1[2][3] || i1) > (v3 * 21)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((v1 >= a0[8]) < (a0[14] * v2)) ? ((55 + v2) < (i0 < 50)) : ((i0 + v3) <= (i0 != a1[2][11])));
+    }
+    if ((((v3 + v0) ? (a1[1][9] - v0) : (a0[4] || a0[1])) + ((v3 % 9) % 7))) {
+        a1[0][4] = (((v2 >= a1[0][1]) % 9) <= ((v0 - v3) % 2));
+        v1 = (((v1 ? a1[3][5] : v2) - (44 * a0[5])) < ((a0[7] && v3) / 2));
+        v0 = (((v2 >= 29) / 2) < ((a0[13] <= v3) * (85 < v1)));
+    } else {
+        a1[2][1] = (((v1 <= v1) >= (83 > a0[6])) * ((v2 && 48) != (19 == 67)));
+        v3 = (((v3 <= a1[0][1]) - (35 / 5)) ? ((52 % 6) > (v1 >= 18)) : ((v1 % 5) <= (a1[3][6] / 9)));
+        v2 = (((v2 - v0) + (60 == 46)) == ((26 + v3) % 1));
+    }
+    if ((((a0[6] ? v3 : v0) == (v3 == 90)) || ((7 - a1[3][14]) / 8))) {
+        a1[3][5] = (((v0 % 2) <= (v0 - a0[3])) == ((a1[1][12] || v3) ? (v0 != v2) : (v1 <= 73)));
+        a0[0] = (((v3 - a0[13]) != (v0 <= v0)) && ((a0[4] < 1) < (a0[10] / 9)));
+        v2 = (((a0[7] != v0) ? (54 / 8) : (v3 - 26)) + ((v0 || v3) / 5));
+    } else {
+        a0[6] = (((v3 + v2) >= (v2 * 15)) - ((v3 > a1[0][13]) || (22 && v2)));
+        v2 = (((51 == v2) * (v0 % 3)) == ((42 * v2) != (62 != a1[0][6])));
+        v0 = (((a1[2][7] == v3) < (v0 > a1[3][12])) || ((v3 * v2) == (29 <= 71)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((54 * 31) > 64) break;
+            a1[2][4] = (((v1 >= v0) ? (v3 / 9) : (v0 / 8)) < ((a1[1][13] != v2) / 7));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a1[2][15] = (((v0 % 2) == (i2 ? v0 : 49)) == ((47 != v2) * (40 ? v1 : v2)));
+                a0[9] = (((i2 < v2) - (a0[12] / 8)) ? ((18 == v3) ? (v2 / 9) : (20 >= v1)) : ((63 / 2) * (a0[9] <= v0)));
+                v3 = (((48 ? v3 : 66) ? (a1[1][5] < a1[2][6]) : (a0[3] < a0[13])) && ((v3 / 3) != (i2 % 5)));
+            }
+            a0[6] = (((a1[3][4] <= a1[3][1]) + (a1[2][6] ? 33 : v2)) ? ((a1[2][6] + v0) != (a0[15] != a1[2][5])) : ((v0 == v1) / 5));
+            i2 = i2 + 1;
+        }
+    }
+    return (((78 || v3) / 2) || ((55 / 5) * (a1[2][14] >= v2)));
+}
+int main() {
+    return 0;
+}
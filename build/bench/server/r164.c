@@ -0,0 +1,182 @@
+int f0() {
+    int v0 = 56;
+    int v1 = 46;
+    int v2 = 60;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                v3 = (((v3 / 2) + (v2 == v2)) || ((v3 > 79) % 1));
+                v3 = (((v1 + a1[1][2]) && (a0[13] ? a1[2][15] : v0)) <= ((a0[9] && v2) < (a1[0][7] <= 14)));
+                v1 = (((90 >= a1[2][13]) <= (90 && a1[3][8])) || ((90 ? 92 : v0) == (v0 || v2)));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((v3 < v0) + (a1[0][10] < v0)) && ((v2 < a0[5]) || (a1[1][4] || v2)));
+        a1[1][8] = (((v2 >= v2) / 9) == ((a0[9] || a1[1][12]) <= (19 - i0)));
+    }
+    v1 = (((7 <= a1[3][13]) * (a1[3][0] <= v3)) && ((a1[3][4] % 5) % 3));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v0 = (((v0 / 7) / 2) == ((32 * v2) * (i2 ? 85 : i2)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v2 = (((i2 >= a0[13]) ? (v2 == 12) : (1 - 86)) ? ((a1[2][8] && v0) && (v2 / 3)) : ((v0 % 5) / 8));
+                a1[0][12] = (((a0[12] ? a1[3][0] : v1) * (v0 / 6)) && ((v0 >= v2) < (a1[3][11] != i3)));
+                v3 = (((a0[14] || 54) < (17 && v2)) > ((a1[2][11] - 16) ? (i2 ? v1 : i2) : (93 && v0)));
+            }
+            a0[2] = (((a1[2][14] * a1[1][13]) * (a0[15] == v0)) > ((a1[0][9] * v0) ? (97 - v0) : (a0[5] != a1[0][8])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[10] + a1[2][6]) >= (v0 >= 6)) && ((a1[1][11] || v2) < (v1 != 34)))) {
+        v3 = (((13 == v3) != (v3 + a0[5])) * ((v3 / 9) >= (a1[0][1] && v2)));
+        a1[3][5] = (((v1 / 3) && (v2 > v0)) + ((v1 / 7) % 4));
+        v1 = (((a0[15] - a0[2]) <= (a1[0][6] * v2)) / 9);
+    } else {
+        v1 = (((30 / 9) || (v1 != v1)) >= ((a0[12] % 2) / 4));
+        v1 = (((v2 >= a0[12]) >= (76 || v2)) >= ((a1[0][0] * v3) == (v3 / 9)));
+        a1[0][5] = (((v2 == 51) != (v2 > a1[1][3])) && ((a0[7] ? v1 : 51) <= (a0[3] / 6)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a0[11] = (((v2 || v2) && (v2 != 36)) ? ((39 > v2) || (64 ? v1 : a1[3][2])) : ((v3 || a0[1]) % 1));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((56 ? v1 : a1[2][15]) > 50) break;
+                v2 = (((16 > 51) == (v2 > v0)) != ((a1[0][3] ? v1 : a0[1]) > (46 / 7)));
+                a0[7] = (((a0[4] || v2) - (58 && a1[2][9])) < ((i4 + a1[1][0]) * (i4 - 1)));
+                v3 = (((30 / 6) / 1) + ((v1 ? v3 : 7) == (v3 < a1[3][12])));
+            }
+            v0 = (((v2 == a0[5]) - (69 && 71)) - ((57 - 83) <= (a0[8] + 75)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v2 < v3) || (v0 % 3)) >= ((a0[2] ? a0[9] : v1) >= (v3 % 1)));
+}
+int f1() {
+    int v0 = 21;
+    int v1 = 37;
+    int v2 = 54;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[0] / 9) + (v0 == v2)) || ((v2 / 6) - (v2 && 52)))) {
+        v3 = (((v1 * v2) + (24 ? v2 : 89)) != ((v0 == 49) <= (a0[4] > v0)));
+        a0[8] = (((v3 <= 0) * (a1[2][2] / 4)) >= ((v2 < a1[1][11]) > (a0[8] == a1[2][8])));
+        v1 = (((v1 < a1[1][14]) >= (2 ? v0 : 71)) > ((a1[3][11] == 85) + (v1 + v1)));
+    } else {
+        a0[8] = (((v3 % 6) || (96 > v0)) && ((a1[3][15] - 50) || (v3 ? v1 : 15)));
+        v2 = (((v0 * v1) == (v2 % 7)) ? ((v3 % 3) || (44 <= v1)) : ((a1[2][15] % 5) / 7));
+        v1 = (((a1[0][13] >= v0) % 8) == ((1 - v0) % 7));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v0 = (((i0 * a1[1][14]) != (96 % 4)) * ((v2 < v3) == (v3 < a1[2][0])));
+                    v3 = (((i1 && v3) != (i1 < 66)) * ((78 ? v1 : i0) + (v3 * v2)));
+                    v1 = (((i1 > i1) / 4) < ((a0[1] || i0) < (v3 - 58)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][9] = (((v0 ? a0[1] : 51) == (a0[8] || a0[12])) / 4);
+            a0[5] = (((v0 + i0) && (v2 || 30)) + ((96 != v0) ? (a0[3] && v3) : (v3 * v1)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((99 % 7) - (v1 >= v3)) + ((v3 >= a0[8]) + (30 * v1)))) {
+        v3 = (((v2 != a1[1][15]) < (a1[2][14] + 18)) == ((v3 + a0[9]) > (v1 * v3)));
+        v1 = (((8 == 48) + (v0 * 59)) - ((a1[0][7] + a1[0][6]) && (a0[6] ? v1 : 31)));
+        v3 = (((v3 > v0) ? (a0[13] < v0) : (v3 >= a0[7])) >= ((v0 > v3) % 9));
+    } else {
+        v0 = (((v3 ? v2 : v1) != (a1[1][1] == a1[3][7])) && ((a1[1][4] + 20) * (a0[3] <= v2)));
+        v0 = (((88 <= 73) < (11 % 6)) || ((24 % 2) - (a1[1][3] * 55)));
+        v2 = (((6 ? a0[1] : v3) ? (a1[1][6] > 18) : (v1 > v1)) > ((a1[0][8] == v0) != (v0 % 2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v0 = (((i2 <= v0) + (68 - v1)) || ((a0[10] / 5) >= (a0[6] == a1[2][11])));
+            v3 = (((v1 && v3) ? (a0[13] ? v1 : 94) : (28 && v0)) ? ((a1[1][15] - v0) / 2) : ((a0[11] - a1[2][0]) || (a0[3] && 44)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((a1[0][6] != v2) > (64 == v3)) / 1);
+                    v2 = (((a0[10] > 90) + (v1 && v2)) + ((v1 >= a0[5]) && (a0[1] || v3)));
+                    v0 = (((51 <= v0) && (0 == 10)) * ((v0 % 4) - (v3 / 8)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((89 == v2) > (91 || v3)) / 1)) {
+        a0[0] = (((64 >= v0) < (25 == 81)) * ((v0 >= a0[2]) < (61 && v1)));
+        v3 = (((v0 >= v3) || (a1[3][12] >= a1[2][7])) && ((a0[7] - v3) || (v2 / 9)));
+        v0 = (((v3 != 30) / 8) || ((v1 * a1[0][5]) <= (v3 >= v3)));
+    } else {
+        v2 = (((v2 - v0) != (v1 == a0[5])) + ((v3 ? a1[1][8] : 18) != (v0 / 5)));
+        v3 = (((v1 == v3) % 6) - ((72 <= v2) + (v1 + v2)));
+        v3 = (((97 + v2) < (24 != a0[4])) ? ((v0 && v1) ? (v3 + v0) : (v2 < v3)) : ((v0 - 1) == (a1[0][7] < v0)));
+    }
+    return (((a1[2][5] / 6) <= (v3 + v0)) * ((87 >= v0) > (v0 / 6)));
+}
+int f2() {
+    int v0 = 60;
+    int v1 = 75;
+    int v2 = 23;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[8] + v1) ? (a1[0][3] >= v2) : (a1[1][8] - v1)) - ((v3 * v0) == (a0[13] <= a1[2][4])));
+    if ((((39 ? v1 : v2) + (v2 != a1[1][8])) ? ((v1 < 64) == (a1[1][6] >= v1)) : ((a1[2][6] && a1[2][9]) % 7))) {
+        v0 = (((v1 != v3) ? (a1[0][9] * v2) : (47 > 95)) < ((3 == 25) >= (v3 * 46)));
+        v0 = (((82 < 19) - (a0[6] >= v2)) % 6);
+        v1 = (((v3 + 34) == (v0 ? v1 : 88)) <= ((41 ? a0[5] : v0) * (v1 ? v1 : v0)));
+    } else {
+        v1 = (((34 && v3) ? (a1[3][10] || 68) : (93 >= 39)) != ((v3 * v1) ? (a1[1][4] * 98) : (v2 >= 84)));
+        a0[1] = (((a1[0][13] && v1) && (a0[4] / 4)) || ((a0[4] >= v3) ? (53 > a0[2]) : (a0[3] / 5)));
+        a1[0][6] = (((a0[5] <= 87) + (a0[9] && a0[10])) + ((2 < a1[3][12]) <= (v0 * a1[2][6])));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a1[3][2] = (((v3 ? v1 : 21) > (i0 >= a1[3][5])) + ((i1 || v1) ? (35 / 2) : (a1[0][3] == 30)));
+                v0 = (((v3 == i0) || (a0[0] != i1)) % 5);
+                a0[6] = (((i1 ? i1 : 6) / 9) ? ((v2 && 82) < (a1[1][7] * v2)) : ((a0[2] < a0[0]) ? (i0 == v2) : (v0 * v0)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[11] = (((a0[14] || v1) || (v0 * v0)) > ((a1[0][14] >= v1) == (v0 < v3)));
+        a0[0] = (((a1[3][11] != v3) > (a1[3][12] ? a1[1][15] : v3)) > ((i0 == a0[10]) / 5));
+    }
+    v0 = (((v0 >= a1[3][4]) ? (v1 > 61) : (v3 < v2)) ? ((52 - v3) || (a1[0][14] && v3)) : ((11 < v0) * (a0[3] >= a0[12])));
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v2 = (((95 / 8) ? (a1[3][9] * v0) : (a1[2][11] * v1)) != ((92 != v1) - (v0 <= 41)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v0 = (((a0[6] > v2) * (a0[4] >= i3)) != ((a1[3][4] - 10) ? (i3 % 9) : (a0[3] % 1)));
+                    v0 = (((74 + i3) + (52 <= 85)) != ((i2 || a1[2][1]) == (i2 ? 61 : 17)));
+                    v2 = (((v2 / 6) % 7) ? ((a0[2] > i3) ? (i2 && i3) : (v0 == v3)) : ((6 * a1[3][0]) == (v3 * v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((v1 / 6) + (v0 >= a1[2][4])) == ((a1[1][13] + i2) || (a1[2][14] != 77)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v0 >= a1[2][1]) <= (v1 + v3)) != ((a0[3] > v2) || (a0[15] || 74)));
+}
+int main() {
+    return 0;
+}
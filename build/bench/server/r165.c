@@ -0,0 +1,67 @@
+int f0() {
+    int v0 = 97;
+    int v1 = 17;
+    int v2 = 29;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v3 < i0) > 82) break;
+            a0[9] = (((v0 ? v2 : v2) < (v1 - 21)) > ((24 - i0) * (40 == v1)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v2 % 7) > 87) break;
+                    a0[5] = (((i0 || v0) && (0 < v3)) > ((42 || i0) - (48 <= v0)));
+                    a0[11] = (((v1 - i1) ? (i1 < v3) : (v3 > v1)) <= ((v3 / 7) * (a1[0][8] <= a1[2][9])));
+                    v3 = (((v3 >= v3) && (v2 || v2)) || ((85 / 5) ? (a0[0] == i1) : (30 - i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a1[0][2] = (((v2 == v1) == (78 ? i0 : a1[1][12])) || ((a1[1][9] ? 44 : i0) - (a1[1][10] != v0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v2 / 6) > (78 > v3)) ? ((v1 < a0[12]) != (v1 > v1)) : ((v1 + 18) - (71 * v1)))) {
+        v3 = (((a0[0] / 3) + (53 <= v1)) <= ((a1[0][9] * v1) * (v0 * 89)));
+        v2 = (((v1 != v1) % 5) - ((a1[2][14] - 67) % 3));
+        v3 = (((53 ? 72 : v3) - (69 - 95)) < ((v1 == a0[7]) || (v1 >= 53)));
+    } else {
+        v3 = (((a0[0] != v3) + (v2 && v3)) > ((3 * v1) == (v0 == v1)));
+        a1[0][13] = (((42 != v1) == (v3 > 30)) <= ((v2 && a1[1][12]) * (a1[2][14] * a0[0])));
+        v0 = (((v1 % 7) > (96 == 3)) ? ((v3 ? 99 : 70) <= (v0 != 94)) : ((v2 % 2) - (a1[1][11] >= 26)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v1 <= v0) >= (v0 >= 99)) >= ((93 / 2) >= (v1 == v1)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v3 = (((i2 ? i2 : v2) / 4) > ((34 < i2) % 3));
+                    v1 = (((49 % 4) != (a0[8] - a0[15])) + ((v2 > 20) / 8));
+                    a1[3][0] = (((v3 % 7) / 7) ? ((v1 ? a1[1][14] : i3) && (v2 % 8)) : ((80 + 24) == (v0 <= 33)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a1[0][1] / 1) * (a1[1][14] * v2)) / 2);
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v3 = (((a0[13] / 7) == (v2 ? a1[3][9] : a1[0][12])) / 5);
+    if ((((a1[1][1] <= a0[6]) ? (v0 >= v0) : (30 / 2)) == ((v2 ? v2 : a1[0][13]) != (v0 <= a0[15])))) {
+        a1[0][12] = (((97 + v3) < (40 ? 91 : 67)) % 5);
+        a1[1][2] = (((v2 ? a0[9] : v1) >= (58 || a1[3][11])) < ((v3 <= v3) || (93 <= v0)));
+        a1[1][12] = (((v0 - a0[2]) > (v1 / 2)) * ((v2 * a1[1][11]) ? (v0 < a0[7]) : (24 % 4)));
+    } else {
+        v1 = (((23 + a0[13]) / 7) && ((a0[6] ? 60 : v1) ? (v2 % 6) : (16 < a0[4])));
+        v3 = (((v0 >= 62) ? (15 > a1[1][13]) : (a0[3] + 39)) != ((v2 ? v1 : v3) <= (v2 * v1)));
+        v2 = (((v0 && a1[0][3]) < (a0[10] - v3)) % 3);
+    }
+    return (((v3 ? a1[1][15] : 95) != (v0 == v0)) + ((v2 ? v0 : v2) == (29 <= v0)));
+}
+int main() {
+    return 0;
+}
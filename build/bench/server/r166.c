@@ -0,0 +1,80 @@
+int f0() {
+    int v0 = 9;
+    int v1 = 42;
+    int v2 = 85;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a1[1][6] = (((v2 >= i1) - (i1 >= 81)) >= ((v2 < 52) < (a1[2][7] >= 55)));
+            v1 = (((a0[11] || 43) * (v3 - v1)) && ((v2 * v3) + (a1[2][0] && i0)));
+            v1 = (((90 >= 11) * (i1 ? v2 : 61)) ? ((5 && v0) / 3) : ((83 >= a1[1][12]) ? (a1[0][14] == i1) : (32 + v1)));
+        }
+        v2 = (((43 >= v3) + (21 / 9)) / 1);
+        v3 = (((v1 ? v3 : v3) && (v1 < v3)) ? ((a1[1][15] / 6) + (68 <= a1[0][7])) : ((v0 == v2) ? (v2 > v1) : (65 / 9)));
+    }
+    v0 = (((95 - v1) >= (a0[13] >= a1[0][7])) >= ((v1 - a1[1][9]) % 1));
+    a0[11] = (((v0 <= a1[1][0]) > (v3 ? 14 : v1)) <= ((v1 == v2) > (78 != v0)));
+    if ((((a0[13] < a0[13]) >= (31 / 8)) / 7)) {
+        v1 = (((a1[2][6] / 3) / 4) % 8);
+        v2 = (((17 > a0[9]) % 5) ? ((v1 > v3) ? (a1[2][5] && v0) : (v0 ? 25 : 98)) : ((v3 && a1[1][8]) % 5));
+        v0 = (((v3 / 2) || (v1 * v2)) % 7);
+    } else {
+        v0 = (((a0[12] < v0) ? (27 ? 80 : a0[0]) : (73 / 8)) * ((v2 == v0) ? (v2 <= a1[1][10]) : (v1 >= a0[4])));
+        v0 = (((v2 == v3) && (a0[9] > v1)) - ((84 >= v3) < (v0 < 85)));
+        v0 = (((v1 && v0) - (v1 ? a1[2][9] : v2)) - ((a1[0][11] == a1[2][6]) + (68 <= a1[2][10])));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((a1[1][12] || v2) > 91) break;
+                    v0 = (((i3 >= 80) ? (19 ? v3 : a1[2][1]) : (v2 < i3)) != ((3 && 41) ? (v2 - v2) : (a1[2][3] != v0)));
+                    v1 = (((99 && a1[2][7]) * (a1[1][14] * 94)) % 9);
+                    v1 = (((a0[15] ? 51 : i3) != (v2 >= v2)) % 3);
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((i2 >= 28) || (a0[7] <= v2)) ? ((56 < v0) > (49 && v1)) : ((a0[12] || v3) && (a1[2][1] && a1[2][0])));
+            v2 = (((41 >= v3) + (v0 || 2)) ? ((v2 ? 52 : a1[3][4]) > (v0 != i2)) : ((v2 >= i2) < (i2 ? a0[4] : 92)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((99 * a1[1][4]) || (v3 <= 45)) / 8);
+}
+int f1() {
+    int v0 = 39;
+    int v1 = 47;
+    int v2 = 61;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 && v3) ? (v3 ? v1 : 74) : (a0[0] ? 63 : v0)) || ((a0[1] > a1[0][10]) ? (v3 - v3) : (a0[15] >= v2)));
+    if ((((v3 != a0[6]) ? (v0 / 4) : (v3 * v1)) ? ((v1 ? a1[3][4] : a0[6]) >= (84 * a1[2][15])) : ((v2 > 60) % 5))) {
+        v1 = (((79 - v1) + (v3 >= 20)) <= ((v1 > v3) <= (v1 > v2)));
+        v2 = (((v1 == 98) * (a0[9] - v2)) + ((66 || a1[0][3]) >= (v0 < a1[2][0])));
+        v3 = (((v2 % 2) || (v1 * v1)) + ((19 > v1) < (v3 ? v3 : v2)));
+    } else {
+        a0[1] = (((v2 && v3) % 1) && ((a0[8] ? v1 : 91) / 7));
+        v3 = (((1 >= a1[2][1]) * (v3 / 1)) && ((v2 / 9) || (a0[10] || v3)));
+        v0 = (((a0[14] >= a1[3][12]) * (a0[15] ? v0 : v2)) % 7);
+    }
+    if ((((a1[1][12] < a1[1][3]) && (v0 && 19)) == ((a1[3][2] > v1) || (50 <= v2)))) {
+        v0 = (((a0[6] || v2) % 3) > ((a0[3] / 5) + (v0 + v3)));
+        v1 = (((29 / 8) && (a1[3][2] && v0)) != ((v0 == 70) ? (a1[1][5] % 7) : (v0 >= v0)));
+        v1 = (((v0 ? a1[1][6] : v2) + (v0 ? v2 : v0)) ? ((v1 <= a0[3]) || (58 - a1[0][6])) : ((v3 + v0) ? (a1[3][6] / 7) : (v2 && a0[4])));
+    } else {
+        v1 = (((95 / 5) != (a1[1][6] ? 71 : 23)) % 2);
+        v3 = (((v3 / 2) / 6) || ((48 % 5) != (v1 > a1[1][11])));
+        v2 = (((a1[0][10] != v2) >= (v3 || 9)) ? ((v1 >= a0[3]) + (v3 % 6)) : ((v3 == v3) / 2));
+    }
+    v3 = (((v3 > v2) + (v0 - a1[1][4])) || ((49 * 15) / 2));
+    v3 = (((v1 ? v1 : 76) ? (v3 - v2) : (v1 >= 42)) || ((90 / 8) <= (v0 <= a1[0][3])));
+    return (((84 >= v2) <= (v1 ? v2 : 37)) % 4);
+}
+int main() {
+    return 0;
+}
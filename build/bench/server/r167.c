@@ -0,0 +1,198 @@
+int f0() {
+    int v0 = 1;
+    int v1 = 39;
+    int v2 = 1;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((22 && 39) != (v0 || a0[6])) && ((a1[0][9] * v3) * (36 ? a0[7] : a0[3])));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    a0[2] = (((i0 > 64) + (38 + a0[2])) > ((30 < a1[1][7]) - (21 == a1[2][10])));
+                    a0[11] = (((a0[11] / 4) < (i1 > a1[2][0])) + ((4 && v1) != (a0[10] >= a0[12])));
+                    v2 = (((88 % 5) >= (a0[4] && v2)) - ((a1[0][13] != 64) ? (i0 + v1) : (i0 * v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v3 = (((a1[0][10] <= v3) % 3) != ((a0[2] >= a0[15]) != (40 * a0[11])));
+            v2 = (((68 == v0) && (v0 + 32)) >= ((a1[1][5] + a0[9]) % 8));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v3 = (((a0[11] * v3) && (v3 || v3)) * ((60 <= v3) + (v1 / 7)));
+    {
+        int i2 = 0;
+        do {
+            v0 = (((6 + 16) > (v2 < v3)) ? ((v1 ? a0[5] : 10) - (a1[1][3] / 4)) : ((a0[2] <= v1) + (i2 >= 25)));
+            {
+                int i3 = 0;
+                do {
+                    if ((i2 == i3) > 98) break;
+                    v0 = (((a1[1][5] > v2) || (v0 < a1[1][14])) - ((a0[0] * i2) - (v3 && a0[1])));
+                    a1[3][11] = (((v1 != 74) || (i2 > a1[1][11])) == ((v1 || a0[15]) % 1));
+                    v2 = (((v3 <= v3) > (v3 ? i2 : v3)) == ((v0 >= a1[3][15]) + (v2 ? 0 : a1[0][3])));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v3 = (((a0[12] != v0) || (48 > i2)) >= ((v3 + v2) - (a1[3][6] + v3)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v3 = (((47 + a0[9]) % 4) % 8);
+                a1[0][2] = (((a0[6] || 8) == (a1[2][3] == 7)) || ((v1 - v3) == (v1 * i4)));
+                a0[3] = (((v1 ? a1[0][7] : v3) == (i4 + v0)) != ((v1 <= i5) < (i5 < 50)));
+            }
+            v2 = (((a1[1][15] != v2) % 7) != ((v0 == v1) % 6));
+            a1[2][3] = (((a1[1][8] - 0) != (a0[8] % 3)) && ((v3 < 88) >= (v2 && v1)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((1 / 2) && (10 >= v0)) * ((v2 <= 19) && (v0 >= v0)));
+}
+int f1() {
+    int v0 = 38;
+    int v1 = 90;
+    int v2 = 90;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                do {
+                    a0[4] = (((50 % 5) >= (a0[9] - v3)) && ((i0 > i1) == (a1[2][3] + 0)));
+                    a1[1][8] = (((a1[1][11] + a1[1][11]) == (25 == 31)) <= ((v0 != v2) && (v2 + v0)));
+                    v1 = (((v1 - a1[3][12]) || (36 ? a1[1][3] : a1[1][0])) || ((a0[5] >= 0) ? (v2 % 4) : (79 + a0[13])));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v1 = (((v2 == v0) && (v2 % 5)) || ((v2 != v3) != (v0 / 7)));
+            v1 = (((v2 * v1) ? (v0 ? 22 : a0[0]) : (76 && v3)) < ((v1 + 75) > (i0 ? 68 : v1)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a1[0][10] = (((v2 && v1) ? (a0[4] >= 85) : (v2 >= a0[12])) != ((9 ? 9 : a0[5]) / 5));
+                v2 = (((a0[14] && v3) + (23 != v2)) || ((23 == v0) ? (a0[12] + v1) : (v1 || 68)));
+                a0[11] = (((v3 == a1[1][14]) || (v1 <= v3)) % 1);
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v2 = (((i2 < v0) >= (v1 % 7)) != ((v3 > v3) >= (45 ? a0[4] : 65)));
+        v2 = (((i2 == 26) <= (62 < v3)) ? ((v1 + v1) * (93 - v3)) : ((56 || 34) != (3 + 45)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        if ((a0[6] ? v1 : a1[3][13]) > 50) break;
+        v3 = (((i4 > 68) <= (a1[2][4] || 67)) > ((a1[3][1] == a1[0][8]) / 1));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            a0[5] = (((4 || v2) == (v0 - 82)) + ((i5 - 37) * (v0 <= 64)));
+            a0[13] = (((a0[2] != v3) <= (v2 >= v3)) + ((49 < 92) && (a0[15] || a0[3])));
+            v2 = (((v0 < v0) ? (i4 <= v2) : (v0 > i4)) >= ((v1 > v0) <= (a0[13] % 6)));
+        }
+        v3 = (((88 <= v0) && (49 || v2)) > ((v1 != 40) ? (v3 <= v0) : (v2 >= 6)));
+    }
+    if ((((v3 * a1[0][14]) ? (41 != 0) : (a1[2][10] - v1)) - ((59 == a0[0]) <= (73 >= v3)))) {
+        v2 = (((a1[3][5] + v1) ? (a1[3][8] < v2) : (a0[11] / 1)) ? ((v2 % 6) + (v3 % 5)) : ((56 ? v1 : 57) != (v2 && v0)));
+        v0 = (((21 || 14) || (86 == a0[9])) ? ((v0 ? 99 : v2) || (v2 >= v3)) : ((a0[5] + v0) + (71 / 4)));
+        v0 = (((v0 * 41) % 6) >= ((a0[14] != v1) >= (v0 <= 82)));
+    } else {
+        a0[6] = (((35 <= 70) && (66 - a0[15])) || ((v2 ? 20 : v3) - (v1 / 8)));
+        v3 = (((v2 / 5) < (v2 * v2)) == ((v0 != v1) + (96 * a0[13])));
+        v0 = (((a0[8] ? v2 : a0[12]) - (60 - v1)) > ((91 < 61) % 9));
+    }
+    v2 = (((a1[3][3] ? 89 : v0) ? (v3 + v2) : (v1 % 2)) == ((v1 > 83) != (v2 % 2)));
+    return (((15 != v0) / 3) + ((v3 % 8) != (v0 != v0)));
+}
+int f2() {
+    int v0 = 78;
+    int v1 = 64;
+    int v2 = 40;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v0 = (((v0 % 7) == (a1[0][8] / 7)) * ((a1[1][5] >= 73) - (a1[3][2] / 4)));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                a1[3][11] = (((a0[5] * a1[1][14]) != (a0[5] / 6)) ? ((a1[2][2] / 1) ? (11 != i0) : (v2 ? a1[2][6] : v1)) : ((50 < v2) % 4));
+                a0[1] = (((v2 == v0) % 1) + ((v1 ? 41 : v2) || (i0 / 6)));
+                v3 = (((43 || v0) % 1) || ((13 && v1) || (v1 && 98)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[0][0] = (((v1 && 4) <= (v3 ? v2 : a0[14])) >= ((v3 && v2) >= (v0 <= v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v1 ? v1 : a0[5]) > 77) break;
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v1 = (((v1 == v3) - (v3 % 4)) && ((v1 || v3) / 9));
+                    v2 = (((v3 / 7) - (v1 && 63)) - ((33 < 70) * (v3 != 96)));
+                    v1 = (((82 ? v3 : v0) && (i2 >= v1)) || ((a0[7] ? v2 : v1) + (75 ? 30 : i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((v1 % 2) - (v2 > v3)) ? ((0 - i2) - (v1 / 5)) : ((30 != v3) >= (v3 && 64)));
+            v3 = (((a1[0][15] <= 63) ? (a0[12] % 8) : (v3 == a0[15])) / 6);
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a0[9] = (((v3 <= i4) || (i4 >= 54)) / 2);
+                    v2 = (((v1 == 13) / 3) % 8);
+                    a0[6] = (((82 ? a0[1] : v3) ? (v0 >= i5) : (v1 || a0[15])) - ((a0[6] > 60) ? (v1 <= v0) : (i5 - 86)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v3 = (((82 + v3) ? (56 <= v1) : (98 >= i4)) - ((v1 / 1) / 3));
+            a0[9] = (((v1 * a1[0][12]) > (v3 < v0)) == ((a1[1][1] % 8) == (v3 ? v0 : a0[10])));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    a0[12] = (((v1 % 8) > (v0 + 71)) == ((a1[2][0] / 1) >= (a0[11] == 95)));
+    {
+        int i6 = 0;
+        do {
+            if ((a1[2][3] ? v3 : v0) > 96) break;
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    if ((i6 + 95) > 99) break;
+                    v0 = (((a0[6] / 5) > (54 == 16)) + ((50 != a0[5]) / 2));
+                    a0[1] = (((v0 ? v3 : i7) || (v1 + v1)) % 5);
+                    a1[3][8] = (((a1[1][3] ? a0[8] : i6) != (72 + 51)) != ((v3 && 39) && (i7 - a0[0])));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((97 && 66) >= (57 + v2)) >= ((v3 || v2) < (a0[11] * i6)));
+            v0 = (((21 % 5) || (v0 == v3)) < ((93 - v3) ? (v2 > a0[13]) : (i6 ? v1 : 44)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((v3 / 1) == (v1 > v1)) && ((a1[1][0] < v0) + (a1[0][15] - 57)));
+}
+int main() {
+    return 0;
+}
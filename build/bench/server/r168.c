@@ -0,0 +1,65 @@
+int f0() {
+    int v0 = 99;
+    int v1 = 85;
+    int v2 = 45;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((64 - v1) % 4) == ((a1[0][3] ? v3 : 30) ? (a1[0][7] <= a1[0][4]) : (v2 && a0[8])));
+    if ((((55 * 50) < (45 > v2)) ? ((a0[15] + v3) > (a1[2][0] <= v0)) : ((v0 >= 18) && (v1 >= 19)))) {
+        a0[13] = (((a1[2][0] == a0[11]) / 7) % 2);
+        v0 = (((a1[1][6] && 96) - (a0[14] < a1[0][8])) / 3);
+        v2 = (((a1[3][0] ? v3 : v1) * (a0[3] == v0)) + ((v0 * 70) != (v2 + 49)));
+    } else {
+        v2 = (((v1 != v3) - (37 * v0)) || ((a1[3][15] == 91) * (a1[0][12] - a0[11])));
+        v3 = (((a0[10] > v1) ? (v0 >= 60) : (v1 < v3)) / 3);
+        v1 = (((v1 / 7) < (v0 <= 61)) > ((v3 % 5) && (a0[4] != a1[2][7])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v1 = (((a0[15] && v1) == (v1 - v2)) >= ((v2 ? a0[3] : v1) || (v0 && v2)));
+            v0 = (((a0[11] || v0) != (36 ? 57 : a0[6])) == ((v3 + i0) - (v0 / 5)));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v2 && v2) > (48 * v1)) && ((v0 < 37) - (a0[8] && i1)));
+                    a0[3] = (((i0 == a1[2][14]) + (v3 < v2)) + ((24 && v0) + (v1 ? a0[15] : 60)));
+                    v2 = (((a0[5] + 49) + (v1 > a0[5])) * ((i0 < a1[2][10]) * (78 <= v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v1 = (((a1[3][2] == 32) && (v3 ? a0[13] : 46)) && ((a0[15] ? 89 : v2) / 3));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][14] = (((a0[12] ? 58 : v1) ? (v0 < a0[8]) : (a1[3][9] + 29)) <= ((v1 - v2) / 6));
+                    v0 = (((v3 > v0) && (i3 * 24)) == ((v2 != a0[11]) ? (37 ? i2 : i2) : (v3 + a0[6])));
+                    v2 = (((v2 >= v0) / 8) == ((v0 * a0[14]) || (v2 % 3)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            a0[14] = (((v2 >= a0[11]) != (a1[2][4] ? a1[3][2] : a0[11])) * ((97 ? v3 : a0[14]) && (v1 <= v2)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 * a1[1][2]) != (87 ? v1 : v1)) <= ((v3 * v2) * (v2 == v1)))) {
+        a1[2][3] = (((a0[8] - 8) <= (v3 % 2)) ? ((v2 == 41) % 3) : ((v3 ? v1 : v1) + (v2 % 4)));
+        v0 = (((v2 % 4) > (a1[2][6] > 50)) < ((v0 + a0[4]) == (14 == v1)));
+        v0 = (((11 <= 83) / 8) <= ((v2 || a0[12]) / 7));
+    } else {
+        v2 = (((v3 % 9) + (v1 - v1)) <= ((v0 < v2) / 1));
+        v0 = (((v2 > 94) > (a0[14] && a1[2][12])) >= ((v0 ? a0[9] : v3) != (v3 ? a0[11] : a0[5])));
+        v1 = (((42 * v3) < (v2 > v3)) / 8);
+    }
+    return (((v2 < a0[8]) * (77 ? 51 : v1)) ? ((v2 && a0[12]) <= (v2 % 9)) : ((a0[10] / 3) > (v2 != v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,130 @@
+int f0() {
+    int v0 = 62;
+    int v1 = 55;
+    int v2 = 40;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((6 != v3) > 92) break;
+            {
+                int i1 = 0;
+                do {
+                    a1[2][15] = (((a0[13] - i1) && (v0 > v1)) ? ((v2 && v1) + (a1[1][3] > 90)) : ((i1 + i0) * (i1 ? 75 : a1[2][7])));
+                    v1 = (((92 && 25) < (a1[3][13] < i0)) + ((i1 + v1) && (v2 || v0)));
+                    a1[3][7] = (((a1[0][14] + v3) % 6) != ((35 + a0[11]) <= (5 == i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v3 = (((85 < a1[3][13]) >= (v1 + v1)) != ((a1[1][14] ? 92 : i0) > (i0 < i0)));
+            v3 = (((a0[4] ? 43 : 33) / 5) >= ((v3 <= v3) >= (a0[1] ? v2 : 83)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a1[1][13] = (((v2 && i2) ? (49 - 52) : (99 - v3)) / 2);
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                v1 = (((a1[0][6] && i2) - (33 < i3)) < ((i3 <= v3) ? (95 ? a1[0][2] : a0[4]) : (v0 + v1)));
+                v0 = (((a1[2][4] ? v2 : a0[4]) + (31 > i3)) * ((i2 - i2) / 8));
+                v0 = (((i3 % 5) ? (73 > v2) : (a1[1][11] - i2)) + ((80 % 6) != (v2 != v3)));
+                i3 = i3 + 1;
+            }
+        }
+        a1[2][7] = (((51 <= v2) >= (a1[3][11] != a1[0][8])) < ((a0[8] + a0[2]) + (43 > i2)));
+    }
+    v0 = (((a1[0][9] < 23) && (83 && a0[15])) ? ((a1[0][15] / 4) || (v2 || v0)) : ((v2 >= 74) == (v0 >= a0[15])));
+    if ((((v0 <= a1[2][10]) + (v1 > 58)) % 5)) {
+        v1 = (((11 <= 51) / 1) != ((v3 + v0) + (a1[2][12] * v2)));
+        v3 = (((74 == v0) / 2) >= ((v1 <= a1[2][11]) < (v0 && a0[9])));
+        a0[2] = (((v3 ? a1[1][8] : v1) > (69 + v0)) * ((v0 != 54) || (v1 / 5)));
+    } else {
+        a0[4] = (((v1 * 66) || (72 * 7)) + ((v2 - a0[15]) || (v2 ? 30 : v0)));
+        a1[3][0] = (((14 < 54) <= (a1[2][3] && a0[2])) <= ((v0 % 5) && (a1[1][6] || v1)));
+        a0[13] = (((v3 != a1[1][7]) ? (32 - v1) : (v0 / 6)) < ((a0[0] <= 88) ? (a0[11] == v2) : (a1[1][7] != 58)));
+    }
+    if ((((v0 || v0) < (v3 > a0[13])) < ((v3 ? 22 : 7) != (a1[2][9] % 5)))) {
+        v0 = (((v0 >= v1) > (33 + 14)) - ((v0 + a1[0][13]) > (19 != v1)));
+        v0 = (((v0 + v0) - (v2 % 3)) - ((69 ? 55 : v1) * (v2 / 3)));
+        a0[14] = (((v1 || 60) > (v0 == v0)) / 9);
+    } else {
+        v2 = (((a1[1][5] < v3) * (v0 >= 81)) / 7);
+        a1[0][11] = (((v2 <= 5) - (84 <= v0)) ? ((v3 != 35) * (48 % 9)) : ((a0[10] ? 94 : v1) == (v2 < a1[1][2])));
+        a0[11] = (((v1 != v2) <= (v2 ? a0[11] : a1[3][5])) ? ((a0[2] * a1[3][3]) > (90 || 88)) : ((v1 && v1) == (v0 || v2)));
+    }
+    return (((62 - v1) > (v3 ? 47 : 22)) == ((v0 ? v0 : v0) >= (v1 && v0)));
+}
+int f1() {
+    int v0 = 21;
+    int v1 = 20;
+    int v2 = 9;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 % 6) - (v2 != v2)) <= ((v2 >= 10) * (a1[2][10] / 7)));
+    {
+        int i0 = 0;
+        do {
+            if ((v1 != v3) > 72) break;
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((47 && v2) != (v1 % 4)) ? ((29 == a0[0]) * (a1[2][13] == i0)) : ((59 >= a1[1][9]) ? (v0 - i0) : (17 >= a1[2][8])));
+                    v1 = (((47 <= v1) / 4) && ((v2 ? a1[2][2] : 17) != (26 ? i1 : v3)));
+                    v1 = (((v1 < v2) + (22 ? a1[3][13] : 83)) / 3);
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v1 = (((v2 == 64) && (v2 * 98)) < ((v2 == v1) + (80 % 2)));
+            v2 = (((i0 ? a0[2] : i0) <= (v3 == a1[3][8])) >= ((v2 * v2) && (14 >= v1)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((64 || a1[0][3]) + (a0[15] ? 68 : 47)) >= ((a0[1] ? a0[1] : a0[7]) >= (a1[3][12] || a0[1])))) {
+        v2 = (((a1[3][8] == 72) % 1) == ((v0 <= a1[0][9]) <= (v2 ? 4 : a0[6])));
+        a1[3][10] = (((a0[15] || a0[3]) < (v2 > 32)) * ((v0 - v0) ? (30 - v2) : (a0[15] * v1)));
+        v3 = (((v1 <= v3) == (v1 <= 76)) != ((a1[2][10] <= v2) == (v2 * v1)));
+    } else {
+        v1 = (((a1[1][4] >= v1) || (36 * v0)) && ((a1[1][9] && v1) == (v3 > a0[1])));
+        v0 = (((9 % 4) * (v2 ? a1[1][1] : 72)) != ((3 || v0) < (v0 - a1[1][1])));
+        a0[14] = (((v3 + v3) ? (26 % 1) : (a1[1][3] != v2)) * ((v0 || v3) / 9));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v3 = (((i3 + a1[3][6]) / 6) != ((12 + i2) ? (i2 ? a0[14] : 58) : (a0[10] < v0)));
+                    a1[1][6] = (((64 / 5) || (a0[6] % 1)) ? ((i3 < 2) == (i2 && v3)) : ((69 ? a0[2] : a0[0]) / 2));
+                    v2 = (((74 * v2) ? (a0[15] < i3) : (a1[0][14] > v1)) < ((84 && i3) < (v0 / 9)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((v0 < v2) && (v2 == a1[3][2])) / 9);
+            v1 = (((v1 - a0[5]) <= (91 * v0)) < ((v2 >= v0) <= (66 != v3)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((v3 != a0[13]) > 87) break;
+        {
+            int i5 = 0;
+            do {
+                v1 = (((a0[12] && a0[6]) / 6) + ((a1[2][0] % 1) >= (v1 ? i5 : v1)));
+                v0 = (((97 ? v1 : v2) * (14 ? v1 : a0[9])) >= ((a0[5] + i5) / 7));
+                v3 = (((38 + v2) == (84 <= v1)) ? ((94 / 9) || (i5 < a0[13])) : ((v0 > 25) - (i4 < a0[1])));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+        a1[1][14] = (((i4 ? a1[1][1] : v0) ? (v2 == v0) : (i4 * a1[1][11])) == ((17 / 8) - (28 ? v0 : i4)));
+        v3 = (((v1 <= v0) > (v0 > v0)) + ((33 == v0) * (v3 ? v2 : i4)));
+    }
+    return (((88 >= 15) == (7 ? v1 : v3)) ? ((v0 ? v2 : v2) == (1 <= 82)) : ((v1 != a0[5]) * (v2 * a1[0][13])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,149 @@
+int f0() {
+    int v0 = 33;
+    int v1 = 40;
+    int v2 = 34;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 || v0) && (46 <= a0[8])) == ((a0[7] != v2) % 5))) {
+        v2 = (((v0 + 50) || (77 * 77)) > ((v3 + v1) || (15 > 25)));
+        v2 = (((v3 - v3) ? (v2 != 1) : (v3 == v2)) ? ((v1 ? v0 : v0) % 3) : ((13 != 66) <= (98 == v1)));
+        v1 = (((50 <= v1) >= (v0 + 80)) % 2);
+    } else {
+        a0[1] = (((v2 / 6) != (v1 <= v0)) - ((v3 < v3) % 9));
+        v0 = (((28 + a1[2][0]) < (a0[5] ? v3 : v3)) % 4);
+        a1[2][7] = (((37 > v0) != (v1 != 15)) % 6);
+    }
+    if ((((78 ? v3 : a0[10]) * (a0[2] && a0[2])) + ((99 || 58) != (65 ? 0 : v2)))) {
+        a0[6] = (((v0 && v3) ? (v2 != 71) : (33 || a0[5])) * ((a0[6] != v3) || (a0[2] * a1[1][9])));
+        a0[5] = (((v1 == a0[1]) - (61 >= v2)) != ((a1[2][8] / 5) - (28 + 47)));
+        v3 = (((v3 ? a1[3][4] : v3) > (v1 >= v1)) % 1);
+    } else {
+        a0[15] = (((v3 < 33) / 4) == ((v2 % 8) <= (a1[1][14] ? v2 : 29)));
+        v2 = (((58 * 13) || (v1 ? 97 : a0[9])) != ((v3 || v2) + (v1 + 6)));
+        v1 = (((a1[3][14] ? a0[13] : v1) / 6) != ((a0[2] % 5) != (v0 ? a1[0][14] : v1)));
+    }
+    a0[4] = (((v1 ? 83 : 56) && (a0[3] > v3)) && ((v3 >= v0) || (3 > v2)));
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v1 = (((v3 && v3) % 8) * ((i0 <= a1[3][10]) % 3));
+        v0 = (((v1 == 76) > (v2 / 5)) == ((v3 == v3) / 4));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a1[2][0] = (((53 >= 83) || (v3 < v2)) >= ((i0 != v2) != (v3 ? i1 : a1[3][9])));
+            v0 = (((i0 <= 53) % 2) && ((v0 || a1[1][8]) ? (a1[1][15] || 17) : (65 && 3)));
+            a0[11] = (((18 + i0) + (i1 == v0)) && ((a1[3][14] ? i0 : 62) > (i1 >= 56)));
+        }
+    }
+    a1[0][13] = (((v3 != a0[8]) + (47 - a0[6])) < ((v0 > v3) == (94 + v0)));
+    return (((v1 ? a0[9] : 48) % 4) >= ((v1 - v3) >= (v0 ? 33 : 37)));
+}
+int f1() {
+    int v0 = 99;
+    int v1 = 2;
+    int v2 = 68;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v3 ? v0 : 30) > 88) break;
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((23 > 17) || (a1[1][4] || v0)) + ((v3 % 5) % 9));
+                    v1 = (((v3 + v3) == (i1 && a1[1][11])) ? ((v1 < v2) == (a0[3] + v3)) : ((v3 == v1) && (v3 % 7)));
+                    v1 = (((i1 < 41) || (96 > 54)) ? ((64 < a1[3][12]) < (a0[0] < a1[3][10])) : ((v0 >= i1) < (v1 * v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v0 = (((v3 % 7) + (v3 <= v1)) ? ((a1[1][7] && v2) == (v1 + a1[0][6])) : ((v1 ? v2 : a0[6]) == (78 == v2)));
+            v1 = (((21 ? v2 : a0[15]) != (10 * a1[1][13])) ? ((29 <= a0[4]) + (a1[2][7] && a0[9])) : ((v1 && a0[4]) != (25 <= v2)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    a0[6] = (((v3 || 47) * (a0[12] % 2)) ? ((v0 >= a0[0]) + (a0[14] == 84)) : ((v3 ? v1 : a0[0]) < (9 ? v3 : v1)));
+    v1 = (((78 + v1) < (a0[7] <= a1[0][11])) && ((a0[7] >= a1[2][4]) != (v0 && v2)));
+    v0 = (((17 < v0) || (42 % 1)) % 9);
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a1[0][4] = (((v1 - a0[12]) % 6) >= ((v2 != v3) ? (v0 % 3) : (48 - a1[0][0])));
+            {
+                int i3 = 0;
+                do {
+                    if ((2 >= v1) > 84) break;
+                    a1[0][10] = (((a1[1][8] && 22) <= (9 && v1)) && ((a0[15] != a0[5]) / 2));
+                    v1 = (((v0 > 66) && (v2 / 8)) && ((a1[3][5] && i3) || (v0 - 92)));
+                    a0[11] = (((i3 % 7) / 8) ? ((a0[4] ? a1[3][10] : 68) || (a0[14] / 5)) : ((40 * v3) / 5));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v1 = (((77 % 9) * (v1 + v1)) || ((v2 ? a1[3][11] : 76) || (v1 > a1[3][6])));
+            i2 = i2 + 1;
+        }
+    }
+    return (((64 % 1) < (v0 * 57)) > ((a0[6] >= a1[3][3]) != (a0[5] / 6)));
+}
+int f2() {
+    int v0 = 77;
+    int v1 = 86;
+    int v2 = 72;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 % 5) + (v0 ? v2 : 41)) > ((v2 - 14) / 8))) {
+        v2 = (((a1[1][4] != a1[0][3]) - (a1[2][5] - 55)) - ((a0[15] || a0[3]) ? (v0 % 2) : (76 > 61)));
+        v0 = (((66 ? v3 : 89) >= (78 * v3)) - ((v3 + v0) ? (8 <= a0[9]) : (a1[2][2] * 23)));
+        a0[0] = (((a0[5] % 8) || (82 < a0[10])) / 9);
+    } else {
+        v1 = (((a0[14] % 2) <= (39 == v2)) != ((v2 > v1) + (a0[7] <= v1)));
+        v2 = (((a1[0][15] * v1) / 8) ? ((v0 % 1) < (v0 + 13)) : ((v2 != v1) && (v1 - v1)));
+        a1[0][7] = (((70 < 42) * (v0 - a0[8])) > ((v1 ? v1 : a0[12]) % 8));
+    }
+    v1 = (((a1[1][13] <= v2) / 8) != ((v3 && v1) % 1));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((a1[2][2] + v2) > 83) break;
+            v3 = (((v0 <= a0[6]) * (a1[1][5] + v3)) % 9);
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((a0[6] < 14) > 86) break;
+                    a1[0][12] = (((42 * v2) < (a1[0][4] > 90)) - ((i1 % 8) < (v0 ? 8 : 83)));
+                    a1[0][8] = (((i0 && i1) != (0 && a1[3][10])) || ((a1[1][13] - a0[2]) / 5));
+                    a0[1] = (((v2 - i1) > (v0 ? 9 : i1)) != ((v2 / 2) == (64 - v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((38 != 4) % 1) / 8);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v1 = (((i2 == v3) / 9) < ((i2 >= a0[5]) / 6));
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                v2 = (((i3 * a0[10]) + (a1[0][10] || a0[9])) || ((v2 * 8) || (a1[0][3] > 54)));
+                v1 = (((v0 ? v0 : 12) - (i3 >= 53)) ? ((a1[2][6] && a1[2][2]) ? (a1[2][1] ? a0[14] : a0[1]) : (38 || v0)) : ((i2 * 81) / 8));
+                v1 = (((0 + v0) < (63 % 6)) / 9);
+                i3 = i3 + 1;
+            }
+        }
+        a1[1][0] = (((v3 > 5) || (v1 && 16)) + ((v0 >= a0[5]) <= (v0 ? 74 : 63)));
+    }
+    if ((((v2 ? v0 : a0[1]) && (v2 || v2)) % 9)) {
+        a1[2][5] = (((56 - v2) ? (v1 > 91) : (81 / 8)) ? ((a1[0][4] || v0) == (v0 != v1)) : ((v1 < 72) - (v3 != a1[1][10])));
+        v3 = (((a0[8] * v0) == (88 <= 39)) && ((v1 && v2) % 8));
+        v3 = (((v0 % 2) == (v2 < 52)) < ((v3 <= v3) <= (a0[15] || v0)));
+    } else {
+        a0[8] = (((31 < v2) % 6) == ((89 < a0[0]) == (v2 ? v2 : a0[9])));
+        v1 = (((v3 || v2) < (v3 / 2)) * ((25 > v0) < (a0[11] <= v1)));
+        v3 = (((v1 == v1) >= (a1[2][10] * a1[2][7])) || ((0 != v2) ? (89 <= 44) : (a0[12] != 77)));
+    }
+    return (((85 % 7) > (v0 * a1[2][1])) ? ((42 || v3) <= (a0[0] % 4)) : ((v2 <= v2) + (a1[0][13] / 3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,65 @@
+int f0() {
+    int v0 = 58;
+    int v1 = 45;
+    int v2 = 78;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 || 81) < (v2 > v3)) + ((v0 / 1) * (v0 ? 50 : v3)))) {
+        v1 = (((62 * v1) * (v1 - a1[2][8])) % 7);
+        a1[3][12] = (((a1[0][11] / 5) > (93 - 40)) != ((v1 - 43) - (v0 || a0[15])));
+        a1[0][11] = (((v2 < 34) || (94 % 7)) * ((17 > 56) / 5));
+    } else {
+        a0[4] = (((v1 + a1[3][4]) && (v0 && v2)) < ((56 % 8) - (v2 < 13)));
+        v0 = (((a1[0][5] > v2) ? (65 % 3) : (79 == a1[3][0])) > ((a1[1][5] >= v1) > (a1[0][7] || v0)));
+        a0[7] = (((v0 > a0[13]) && (v3 * v0)) < ((v0 - v2) - (8 < 87)));
+    }
+    if ((((v3 >= v3) - (v1 ? v2 : 53)) / 7)) {
+        v2 = (((v0 || v0) <= (v0 >= v2)) && ((56 / 4) + (a0[7] >= 42)));
+        v2 = (((29 - a0[14]) > (v2 ? v2 : v1)) && ((87 + v2) / 4));
+        a1[2][14] = (((v0 || v3) >= (16 % 8)) || ((v1 && 6) <= (a1[0][8] <= v2)));
+    } else {
+        a1[2][2] = (((v3 || v0) ? (v0 >= v2) : (22 == a1[3][4])) ? ((v2 % 7) ? (54 > v0) : (a0[7] >= 23)) : ((a1[2][12] % 9) ? (22 ? v3 : 15) : (a0[2] < 26)));
+        v2 = (((21 == v3) || (a0[12] || v1)) <= ((v1 % 6) || (v2 ? a0[1] : v2)));
+        v2 = (((v0 * 41) > (11 && v1)) || ((v2 * v2) ? (v1 ? v2 : v0) : (80 % 2)));
+    }
+    if ((((v2 != a0[12]) || (82 && v2)) < ((a1[2][1] * 63) ? (a0[4] >= 74) : (v3 > v2)))) {
+        v2 = (((a1[3][7] ? 48 : v0) * (14 >= 0)) == ((v1 < v0) && (a0[11] == a0[5])));
+        v1 = (((a0[8] != 83) || (v1 > a1[3][3])) <= ((v3 - 92) && (a0[7] == v3)));
+        v0 = (((73 + a1[0][4]) + (v3 == a1[1][7])) >= ((a0[10] ? a1[0][1] : v3) >= (7 || a0[7])));
+    } else {
+        v3 = (((v1 < 82) * (a1[3][11] / 3)) * ((96 + v0) - (v2 ? v1 : 87)));
+        v1 = (((v1 * v0) > (a0[0] >= v3)) || ((v1 - 31) != (6 >= 49)));
+        a1[3][11] = (((v1 == a0[8]) != (53 || a0[5])) * ((73 * v1) ? (63 > v3) : (a0[2] / 6)));
+    }
+    if ((((v0 ? 60 : 85) == (v0 == v0)) < ((69 && v3) <= (v1 || v0)))) {
+        v1 = (((a0[7] == v1) * (v1 ? a0[5] : 32)) || ((v2 != v3) == (v3 * v1)));
+        v1 = (((v1 > 0) <= (a1[2][0] == v0)) != ((a0[6] > v0) % 4));
+        v1 = (((v2 / 1) / 7) <= ((v3 || 23) / 3));
+    } else {
+        v3 = (((v2 == v3) >= (a0[14] ? v1 : v2)) / 2);
+        v2 = (((v2 >= 54) >= (a1[1][11] == a1[3][1])) < ((v1 % 3) < (v3 < 27)));
+        v0 = (((25 % 4) && (v1 + v3)) == ((v3 - a1[1][14]) <= (v1 * v2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v0 = (((51 + v1) % 1) || ((a0[7] && v0) < (v0 + v3)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a0[0] = (((81 >= 20) && (v1 ? 81 : 82)) % 1);
+                    v2 = (((v2 == 53) != (52 / 4)) / 7);
+                    a1[0][9] = (((v2 == a0[13]) >= (a1[0][2] != 82)) >= ((79 ? v1 : v2) < (i0 >= v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((a0[14] < v2) % 7) ? ((i0 * v0) >= (a0[0] < v3)) : ((v2 > v3) % 8));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    return (((a1[1][9] || v1) ? (8 < v1) : (a0[0] * a1[1][12])) % 9);
+}
+int main() {
+    return 0;
+}
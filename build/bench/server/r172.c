@@ -0,0 +1,132 @@
+int f0() {
+    int v0 = 29;
+    int v1 = 92;
+    int v2 = 71;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a1[2][3] * 33) % 4) % 7);
+            a1[0][13] = (((a0[4] * 99) && (v0 + a1[3][1])) <= ((i0 - v1) * (v0 == v1)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a0[0] = (((v3 < v3) ? (i1 < v1) : (v0 * a1[1][9])) - ((17 == a1[2][15]) * (a1[2][11] || 15)));
+                v1 = (((v1 / 1) - (v3 != a0[0])) != ((v0 + 98) ? (11 ? a0[10] : i1) : (i0 / 2)));
+                v3 = (((44 + 47) == (a1[1][15] / 4)) > ((25 == 30) / 9));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((a1[3][13] || a0[8]) + (v3 == 10)) % 2)) {
+        v1 = (((v3 * v0) + (v0 % 4)) / 1);
+        v3 = (((a1[2][5] / 9) * (a1[3][4] == 35)) || ((a0[11] % 2) != (v2 - 46)));
+        v2 = (((a0[11] && a1[1][10]) > (14 < v3)) < ((a0[14] || 90) || (v2 && v1)));
+    } else {
+        a1[3][13] = (((a1[0][9] || v3) > (83 ? 82 : 36)) <= ((v2 % 7) % 8));
+        a1[3][11] = (((a1[3][12] / 9) >= (71 != 89)) >= ((v1 <= v2) * (v2 > v2)));
+        a0[12] = (((v1 != 52) != (a0[5] < v2)) % 6);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v0 = (((a1[3][5] - a1[1][15]) ? (v3 % 9) : (v0 / 9)) ? ((v2 >= a1[0][15]) ? (v3 - v2) : (a1[2][8] ? i2 : a0[4])) : ((v1 > a1[1][1]) / 8));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                if ((v0 * 58) > 76) break;
+                v0 = (((v3 >= v3) >= (v1 + 45)) - ((a0[5] || 93) % 8));
+                v2 = (((v0 > v1) == (i2 + a0[11])) || ((a0[4] - v1) <= (a1[0][7] != i2)));
+                v0 = (((59 || v0) < (66 - 28)) * ((v0 ? v0 : 85) || (83 ? v3 : a1[0][9])));
+                i3 = i3 + 1;
+            }
+        }
+        a1[2][2] = (((24 != a0[15]) == (94 < v2)) > ((73 && 63) * (v0 <= v3)));
+    }
+    if ((((v2 / 4) / 2) * ((78 ? 54 : v0) && (31 * 4)))) {
+        a0[13] = (((1 || v2) * (a0[3] % 5)) * ((v3 % 2) <= (a0[5] / 9)));
+        v0 = (((a0[0] == v2) < (22 < a0[14])) + ((a0[0] + 72) > (v0 + 34)));
+        a0[6] = (((v0 == v2) > (86 < a0[15])) < ((v2 >= v1) / 5));
+    } else {
+        a0[10] = (((16 != 59) - (v3 * v1)) - ((v3 <= v2) > (v0 && v0)));
+        v1 = (((v1 ? v1 : v1) >= (a1[2][7] ? v2 : v3)) == ((10 ? v1 : v3) != (11 % 4)));
+        v2 = (((v1 != a0[2]) * (62 < v3)) && ((v3 != 48) > (v2 != v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v2 * a0[9]) || (a1[2][3] >= v0)) ? ((53 % 3) > (v3 || a1[1][12])) : ((a0[6] * 38) && (a1[0][6] + 61)));
+            a1[3][8] = (((10 <= v0) || (v0 / 6)) - ((75 > a1[2][10]) / 7));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v3 = (((57 + i4) < (i4 != a1[0][11])) ? ((9 / 8) % 5) : ((v0 / 2) || (59 || 85)));
+                v1 = (((i4 && v1) > (47 ? v0 : v1)) <= ((a1[2][15] != v0) != (v1 ? i4 : a0[5])));
+                v3 = (((88 / 9) && (v0 > 9)) == ((90 != 63) - (59 >= a0[2])));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((24 % 2) >= (a0[8] ? 52 : v3)) || ((v3 - v0) && (v3 && a0[5])));
+}
+int f1() {
+    int v0 = 94;
+    int v1 = 99;
+    int v2 = 88;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((a0[6] && v0) + (v2 || v1)) / 2);
+    {
+        int i0 = 0;
+        do {
+            a1[2][4] = (((98 / 2) > (16 * i0)) > ((v2 / 7) || (v2 && 93)));
+            a1[1][10] = (((v1 > a0[9]) / 5) >= ((79 ? v3 : v2) % 9));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v3 = (((i1 + 63) != (v3 && a1[1][4])) * ((v1 != 84) > (v1 || 10)));
+                    v3 = (((v3 - v2) && (76 != i0)) || ((a0[4] != 69) % 3));
+                    v1 = (((a0[13] ? v3 : 29) >= (i1 || 67)) <= ((a1[3][14] / 6) + (v1 != 93)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((58 ? v3 : v0) > (v2 <= 51)) && ((v0 > v3) ? (v0 % 3) : (v0 && v1)))) {
+        v0 = (((v2 <= a0[9]) == (41 + 36)) && ((79 < v3) > (a0[1] ? v0 : v1)));
+        v3 = (((60 * 53) * (v3 ? v1 : 45)) % 8);
+        v2 = (((v1 - v0) - (a0[14] % 9)) <= ((v3 >= v3) % 9));
+    } else {
+        a0[2] = (((v2 ? a1[0][6] : a1[1][0]) ? (v0 >= 78) : (a1[3][11] - a0[4])) >= ((6 * v1) >= (v1 ? v2 : v2)));
+        v3 = (((23 >= 12) / 1) > ((a0[5] != a0[12]) % 5));
+        a1[2][2] = (((v0 / 8) > (v2 - a1[1][13])) ? ((a1[1][13] || 98) ? (v3 != v2) : (19 % 8)) : ((91 ? v0 : v0) < (v3 + 74)));
+    }
+    if ((((83 >= v0) / 4) - ((v0 > v3) * (v2 || 69)))) {
+        a1[2][6] = (((86 >= v2) && (18 - v1)) <= ((a0[7] <= 5) == (v0 == v2)));
+        a0[12] = (((v2 / 8) && (v0 >= a1[0][3])) > ((v1 * 63) / 1));
+        v2 = (((v3 < 78) >= (v1 <= v1)) >= ((23 / 2) ? (a1[0][7] % 1) : (90 == v0)));
+    } else {
+        v0 = (((a1[0][2] && v0) || (15 != 16)) - ((7 < v3) >= (a0[6] ? 39 : v0)));
+        a0[8] = (((v2 ? 9 : v3) == (v3 - 10)) || ((28 - v1) != (v3 ? v3 : a0[9])));
+        v2 = (((83 >= v3) <= (a0[9] >= 39)) != ((a1[2][0] + v0) * (a1[1][15] > v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[3][10] = (((v3 / 1) == (a1[1][11] && i2)) < ((3 ? 64 : v3) - (i2 / 2)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v3 = (((i2 % 7) == (59 % 5)) ? ((31 - a1[3][0]) % 4) : ((a1[3][3] % 9) - (18 > 22)));
+                    a0[0] = (((a1[1][8] < 75) / 5) <= ((59 && v2) % 4));
+                    v1 = (((a0[8] && v0) * (68 > a1[3][13])) * ((i2 ? v2 : v2) <= (31 % 2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((55 - a0[0]) % 9) / 4);
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((v1 ? a1[0][15] : a1[2][0]) != (v1 && a0[2])) != ((92 < 45) >= (38 / 4)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,152 @@
+int f0() {
+    int v0 = 9;
+    int v1 = 29;
+    int v2 = 36;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((77 >= v2) >= (v3 <= 17)) - ((a0[1] < v3) ? (83 - a1[1][3]) : (v2 < a1[0][7])));
+                a0[8] = (((v1 != v3) ? (57 % 8) : (a1[1][0] < v3)) == ((v2 <= i1) < (61 < a1[0][13])));
+                a0[14] = (((41 && v2) ? (v1 < 66) : (63 != 64)) - ((a1[3][8] * v1) && (v2 == i0)));
+            }
+            a0[5] = (((a1[1][1] > 53) > (v2 >= v1)) ? ((a0[6] && v3) < (v0 ? a0[6] : 79)) : ((57 * v3) * (v0 ? v2 : v2)));
+            a1[1][3] = (((i0 < a1[0][5]) - (a1[1][13] ? a1[2][12] : 68)) + ((32 * 6) > (v3 + 45)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    a0[7] = (((56 * a0[3]) != (v0 % 1)) * ((v1 / 5) != (v0 < v3)));
+    if ((((a1[1][12] && 32) && (a0[15] - v2)) / 5)) {
+        v3 = (((a1[2][4] > v3) > (v0 - 10)) % 5);
+        v0 = (((v1 == 95) && (v3 > a0[13])) != ((v2 != v0) * (a1[2][0] == a0[12])));
+        v3 = (((v2 / 5) != (v3 == 65)) / 2);
+    } else {
+        v3 = (((v2 <= v3) && (v2 + 87)) == ((v1 != a0[2]) % 7));
+        v3 = (((a1[3][2] <= v2) - (9 >= 94)) ? ((v0 * v1) - (a1[0][9] > 23)) : ((a1[2][6] ? a0[0] : 31) - (86 && v3)));
+        v1 = (((v1 - v1) ? (a0[13] % 6) : (57 != a0[15])) <= ((a1[0][15] ? v2 : v2) < (70 * a0[9])));
+    }
+    if ((((v2 && 40) > (a1[3][13] ? v2 : a1[3][9])) * ((90 && v1) >= (7 || v1)))) {
+        a0[8] = (((a0[8] <= 15) - (v2 % 5)) % 3);
+        a1[3][10] = (((v2 < 31) / 2) != ((v0 * 56) <= (v2 + v1)));
+        v3 = (((v3 * v0) % 2) == ((94 % 7) > (4 != 85)));
+    } else {
+        a0[11] = (((56 / 7) - (a1[1][9] && 7)) != ((v3 / 4) == (v0 % 7)));
+        v1 = (((v3 - 81) && (v2 ? 45 : 95)) / 5);
+        v0 = (((v0 <= v3) && (v3 / 7)) - ((78 == a1[2][5]) + (a0[15] * v1)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v0 = (((a1[2][0] >= 26) ? (85 ? i2 : v3) : (a0[5] % 4)) >= ((v3 ? v3 : v0) ? (i2 ? 60 : v1) : (a0[5] % 7)));
+        v1 = (((a0[1] > 8) - (v0 / 7)) * ((a1[3][12] == i2) % 4));
+        {
+            int i3 = 0;
+            do {
+                if ((v0 < 64) > 85) break;
+                v2 = (((72 / 5) < (a0[15] ? a1[3][15] : v3)) * ((74 < a0[3]) * (v0 + i3)));
+                v1 = (((v1 >= v1) / 3) >= ((v0 / 8) > (v2 * v3)));
+                a0[15] = (((a0[9] < a1[1][15]) || (15 == v0)) - ((v0 == 96) * (a0[6] < i3)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    return (((v3 - a1[2][10]) > (a0[7] < v0)) < ((v0 / 9) <= (v0 <= v2)));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 17;
+    int v2 = 92;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v0 = (((v2 * 82) < (v2 / 9)) != ((65 <= v1) == (31 * a1[0][4])));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v1 = (((v3 ? v0 : a1[0][10]) || (v1 - v1)) % 9);
+            v0 = (((a1[3][11] < i1) > (v1 != 11)) || ((42 - 69) == (v3 && v3)));
+            a1[2][7] = (((a0[6] * a1[2][7]) > (v3 < v3)) ? ((i0 + v2) + (95 <= v3)) : ((79 != v1) / 6));
+        }
+        v0 = (((v1 != i0) >= (46 == i0)) && ((v2 || 96) - (v0 == a1[0][2])));
+    }
+    v3 = (((v1 && 96) / 6) && ((a1[1][12] - a0[6]) <= (v1 || v2)));
+    a0[13] = (((a0[10] * a1[3][3]) ? (a0[6] * v3) : (v2 >= v2)) >= ((a0[8] >= a0[8]) * (v0 % 8)));
+    {
+        int i2 = 0;
+        do {
+            v2 = (((13 % 1) && (a0[11] || 29)) != ((a0[7] == i2) - (v3 ? v0 : a0[15])));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((v0 || a0[3]) >= (a1[2][5] / 8)) && ((v1 ? v1 : 9) - (i3 <= 93)));
+                v2 = (((v3 < a0[13]) ? (v3 ? v3 : i3) : (i3 > a0[5])) < ((a0[13] && 24) ? (v2 == i2) : (97 < i2)));
+                a1[3][9] = (((37 < v1) > (v3 / 8)) <= ((0 / 6) / 1));
+            }
+            v0 = (((v1 ? 83 : 22) / 8) < ((v2 || v0) ? (95 * 97) : (57 && v3)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v3 = (((40 > v2) < (i4 * a0[5])) + ((v3 / 5) >= (v0 / 5)));
+        a0[1] = (((i4 % 7) + (v0 - v1)) + ((a1[2][8] > a0[6]) && (v2 / 9)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                if ((v0 * 28) > 97) break;
+                v0 = (((v3 * a0[6]) == (v3 >= v1)) ? ((23 != 32) + (v0 ? i4 : a0[8])) : ((v3 % 8) >= (i4 != 1)));
+                v3 = (((v2 > v0) ? (i5 % 4) : (i5 % 6)) >= ((9 + i5) || (i4 < v0)));
+                v0 = (((6 % 9) % 2) > ((52 > i5) && (v3 <= i4)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    return (((v0 <= 60) ? (v1 / 7) : (a1[3][6] / 8)) <= ((v1 > v1) < (v3 - a1[3][2])));
+}
+int f2() {
+    int v0 = 31;
+    int v1 = 64;
+    int v2 = 64;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((58 / 4) * (v2 > a0[4])) - ((25 <= v1) ? (a1[0][15] * a0[3]) : (v0 != v1)));
+    {
+        int i0 = 0;
+        do {
+            if ((a0[0] > v0) > 67) break;
+            v2 = (((a1[0][2] <= v1) * (a1[3][3] % 7)) >= ((a0[15] / 8) < (v2 - 79)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((97 <= 98) && (34 > 81)) == ((a1[1][10] == 0) <= (v3 == v3)));
+                    v1 = (((v2 != a0[10]) + (a0[5] ? v3 : i1)) < ((v1 > i0) > (v1 - 42)));
+                    a0[9] = (((26 * v2) - (v3 || v1)) > ((2 + a1[3][0]) && (v1 && v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v0 = (((56 + a0[10]) % 8) < ((79 * v3) > (63 / 1)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a1[3][2] = (((v3 / 2) / 9) || ((a0[6] && v0) && (80 || v1)));
+            v3 = (((a0[5] ? 85 : a1[2][6]) / 9) - ((v1 == a0[9]) == (i2 < a0[6])));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v2 && v1) < (1 == i2)) == ((v1 ? 53 : 33) - (a0[3] < 89)));
+                    a1[1][1] = (((v0 == v0) - (75 / 2)) >= ((90 - a0[0]) % 8));
+                    a1[1][6] = (((a0[13] ? i3 : 11) == (v2 >= v3)) >= ((41 != v2) && (a1[0][13] / 4)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    a0[1] = (((v2 - 75) > (a1[2][1] < a0[11])) != ((a1[3][1] != v3) * (v1 / 5)));
+    a0[6] = (((v3 / 2) - (a1[2][0] ? v1 : a1[0][11])) >= ((v3 <= v0) / 2));
+    return (((v1 && a1[3][15]) || (a1[0][4] > v1)) ? ((v3 % 4) ? (a1[3][8] % 2) : (a1[1][10] < v0)) : ((a1[2][0] - a1[1][9]) <= (7 >= v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,57 @@
+int f0() {
+    int v0 = 76;
+    int v1 = 56;
+    int v2 = 34;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a1[1][12] = (((38 || 66) ? (v3 == a1[3][5]) : (92 && v3)) == ((a1[3][14] != v0) * (v2 > v1)));
+        v3 = (((a1[2][15] * a0[6]) >= (a1[3][3] <= a0[4])) ? ((a0[14] * v1) == (v2 % 4)) : ((22 - v0) >= (39 && 24)));
+        {
+            int i1 = 0;
+            do {
+                a1[0][5] = (((i1 % 3) > (64 || 59)) != ((a1[0][2] == 1) < (v2 <= 51)));
+                a1[0][11] = (((86 ? 56 : 84) ? (a0[10] == v1) : (i1 - i0)) || ((a0[0] / 4) * (a1[0][4] ? v0 : v2)));
+                v1 = (((i0 * 59) > (75 || 18)) * ((a0[13] - 89) + (35 % 7)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+    }
+    if ((((a1[1][10] || a0[14]) == (v2 != v0)) != ((a0[15] == 62) == (a0[6] < a1[0][6])))) {
+        v2 = (((a0[1] - a1[1][13]) <= (52 || a1[2][12])) <= ((v3 != a1[2][13]) / 3));
+        v3 = (((v2 ? v1 : v0) || (v2 < a0[5])) * ((v2 ? a0[4] : 95) - (a0[9] > a1[3][12])));
+        v3 = (((v2 && v0) > (17 == v2)) || ((v2 - a1[1][4]) != (v0 ? 50 : v2)));
+    } else {
+        v3 = (((85 / 1) == (v0 == v2)) >= ((35 < 33) >= (v3 ? v0 : 15)));
+        v3 = (((v2 ? 58 : a1[3][11]) < (v2 >= a0[1])) >= ((v1 + 1) <= (v1 <= v3)));
+        a1[1][14] = (((v1 > v3) > (a1[0][9] && a1[2][6])) > ((v3 && 55) < (a0[12] != 62)));
+    }
+    if ((((v2 ? 37 : a0[14]) == (v2 / 6)) || ((a1[1][9] != v3) < (19 * a1[2][13])))) {
+        a1[0][7] = (((1 <= a0[5]) == (93 + v1)) + ((v1 + a0[0]) < (v2 <= v1)));
+        a1[1][12] = (((v3 - v2) != (a1[3][5] >= v3)) / 8);
+        v0 = (((v3 && a0[13]) >= (v0 ? v3 : a1[0][12])) ? ((v0 ? a1[3][15] : 98) < (52 != v0)) : ((39 == v0) >= (v0 != v3)));
+    } else {
+        v2 = (((81 * v2) >= (v3 / 1)) >= ((a0[5] <= v0) > (47 + v0)));
+        v1 = (((41 < 53) ? (91 - a1[3][0]) : (v1 && v2)) < ((18 || v3) ? (v1 ? v2 : 96) : (v3 < v0)));
+        v1 = (((a1[2][7] >= v3) >= (v1 * v3)) >= ((v1 * v3) <= (v3 > v3)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v1 = (((a0[2] <= 54) == (65 / 9)) <= ((a0[4] > v1) / 6));
+                v2 = (((v3 % 3) * (v2 % 2)) && ((i2 - 65) - (a0[3] > 17)));
+                a0[12] = (((a1[0][11] || i3) <= (v2 > a0[10])) >= ((a0[9] + v3) + (a1[3][10] <= a1[2][11])));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((i2 ? v0 : v0) / 4) / 7);
+        a0[0] = (((i2 != 0) <= (i2 - a1[3][15])) + ((a1[1][1] / 2) || (a0[12] * v2)));
+    }
+    v2 = (((v0 <= 42) * (v0 ? 92 : v0)) ? ((v1 && v1) >= (v3 == 97)) : ((27 % 3) / 4));
+    return (((a0[8] == v3) ? (81 != v3) : (v0 == v1)) > ((v2 > v3) % 9));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,136 @@
+int f0() {
+    int v0 = 80;
+    int v1 = 97;
+    int v2 = 53;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[14] = (((v2 - v3) > (i0 <= i0)) ? ((a1[3][15] || v0) || (a0[0] == 77)) : ((a0[1] ? 0 : a1[3][13]) ? (60 < i0) : (v1 != 3)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((a0[15] + 4) > 59) break;
+                v2 = (((a0[6] != v3) <= (16 % 2)) < ((a1[1][0] >= v0) - (v3 ? 95 : a1[0][3])));
+                a0[0] = (((i1 ? i0 : v1) || (v3 < i0)) / 2);
+                v1 = (((i1 == i1) + (43 % 9)) != ((v0 % 8) - (77 > v2)));
+            }
+            a0[11] = (((v1 % 7) && (a0[4] == i0)) != ((v0 != a1[1][0]) ? (v2 ? 54 : v3) : (i0 < v3)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a1[1][14] = (((10 / 1) > (i2 || i2)) <= ((85 || i2) * (v2 > v2)));
+            v0 = (((0 == v2) * (v1 - 92)) < ((68 <= v2) ? (a1[2][5] + 83) : (99 + a1[3][7])));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v2 = (((a0[4] == 43) != (38 % 9)) != ((v3 * 16) - (v1 < i3)));
+                v3 = (((v0 == 63) < (77 < v2)) == ((a0[8] || a1[2][9]) ? (v3 - 97) : (26 ? v1 : 79)));
+                v1 = (((10 || i2) - (i3 - i2)) ? ((i2 <= 55) ? (84 * v1) : (v0 < 17)) : ((43 != a1[2][15]) && (a0[11] % 5)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v0 != 54) ? (v0 < v1) : (a1[3][8] || 30)) - ((v3 && a1[2][15]) - (v2 ? 1 : v1)))) {
+        v3 = (((v3 * a0[10]) * (v2 / 8)) / 7);
+        v2 = (((96 != 88) >= (69 + 62)) ? ((75 < 6) == (v1 ? v1 : v0)) : ((v3 / 5) > (v0 || v3)));
+        a1[2][9] = (((24 <= v1) + (v0 >= 39)) == ((v1 + 80) != (5 ? 9 : a0[11])));
+    } else {
+        v1 = (((v0 == a0[12]) < (v0 >= a1[2][10])) * ((v3 == v1) < (78 / 6)));
+        v2 = (((50 * v0) < (98 < v3)) <= ((v3 < a0[9]) == (a0[15] || a0[4])));
+        v3 = (((v0 / 3) && (a1[1][6] + a1[2][14])) == ((v1 + v0) && (a1[3][0] && 81)));
+    }
+    if ((((61 <= v0) == (80 ? v3 : v2)) && ((v3 ? v0 : a0[13]) ? (v3 <= a1[2][4]) : (v0 / 9)))) {
+        a1[2][9] = (((89 + 58) ? (34 ? v2 : v1) : (64 && 57)) < ((3 || v1) < (a0[2] < a1[1][2])));
+        v2 = (((a1[1][8] < v3) / 5) + ((23 % 7) < (v2 ? v3 : 57)));
+        v0 = (((a1[0][6] / 5) - (v1 % 1)) < ((50 != v3) + (v3 % 4)));
+    } else {
+        v2 = (((v2 <= v3) && (v1 < v2)) || ((v3 <= v2) ? (v3 <= v1) : (v3 ? 72 : 52)));
+        a1[1][10] = (((a1[2][6] ? v2 : v1) <= (v3 + v2)) ? ((95 < v3) % 4) : ((8 || v1) ? (98 * 61) : (v2 % 3)));
+        v0 = (((a1[2][10] > v2) ? (v1 >= v1) : (5 - v3)) ? ((v1 || a1[2][3]) ? (a1[2][2] < 79) : (v3 + v2)) : ((a0[0] == a1[0][4]) == (v0 / 3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[2][0] = (((9 && a0[10]) ? (50 > 86) : (a1[1][12] || v0)) + ((62 ? a1[3][5] : i4) > (v0 * 59)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v2 = (((4 || i4) < (v3 && 81)) || ((a1[0][0] && 62) / 5));
+                v1 = (((v3 <= i4) != (a1[1][12] + 17)) <= ((v1 > 22) % 6));
+                v2 = (((i4 + i4) > (a1[1][2] * i5)) / 1);
+            }
+            v1 = (((13 || v2) ? (70 || 25) : (v2 && 3)) - ((v0 == v0) >= (a0[13] || 21)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((v0 < v2) >= (v1 % 7)) > ((58 > a1[1][1]) == (47 + a0[12])));
+}
+int f1() {
+    int v0 = 52;
+    int v1 = 99;
+    int v2 = 9;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[3] != 67) + (a0[1] - 49)) < ((44 == 75) > (v2 + a0[13])))) {
+        v1 = (((22 < v1) < (v0 + v1)) - ((v1 >= v2) + (v3 < a0[13])));
+        a0[6] = (((72 >= v3) > (28 * 75)) - ((v1 > v0) - (v2 * v2)));
+        a1[0][14] = (((25 * a0[15]) < (82 * v3)) && ((v1 == v0) >= (2 != v1)));
+    } else {
+        a0[0] = (((v2 ? 73 : v2) ? (v1 >= 88) : (v3 - a0[13])) ? ((v2 - a0[2]) % 4) : ((86 > v2) - (a0[6] >= 84)));
+        v0 = (((a1[2][3] <= 12) > (v0 ? v3 : a0[12])) ? ((v3 ? 41 : v3) < (a0[13] && v3)) : ((v1 < a1[1][5]) + (13 - v3)));
+        v1 = (((v0 ? 11 : v2) != (9 + 36)) / 7);
+    }
+    if ((((v2 >= a1[3][12]) - (a0[13] || 46)) % 7)) {
+        v0 = (((v2 + a1[1][3]) || (v2 + v1)) == ((v2 * 58) && (v0 >= v0)));
+        a1[3][9] = (((a0[15] < 63) && (v1 - a0[8])) && ((5 > v3) / 8));
+        v3 = (((63 && a0[12]) > (v3 * v1)) || ((52 < v1) * (a0[14] / 4)));
+    } else {
+        a0[0] = (((v3 == 95) ? (v1 - a1[2][2]) : (v1 == a0[9])) > ((a1[1][13] < a1[3][11]) + (v0 + v3)));
+        v2 = (((v0 <= 64) * (v1 ? a0[4] : v2)) > ((a1[3][4] - a1[1][12]) != (a1[2][6] - v2)));
+        v3 = (((v1 >= v3) * (75 > v2)) == ((a0[15] ? 43 : v3) >= (a0[10] % 8)));
+    }
+    if ((((73 < a1[1][4]) != (v3 <= a0[10])) != ((v2 && v0) % 1))) {
+        v1 = (((v1 % 9) <= (73 + a1[3][15])) % 9);
+        v0 = (((v3 > v2) > (19 ? a1[0][9] : 2)) <= ((a0[7] % 6) - (84 >= v0)));
+        v3 = (((v0 < a0[13]) - (v2 || v2)) * ((33 != v0) - (a0[3] + v3)));
+    } else {
+        a0[8] = (((a1[0][3] / 8) < (a0[2] && a0[4])) - ((v1 ? v0 : v3) == (a0[2] ? 8 : v0)));
+        v3 = (((61 == v2) ? (a0[15] ? 61 : 78) : (a1[2][12] ? 51 : v1)) ? ((59 / 2) ? (v0 > v3) : (60 > 51)) : ((15 > v3) != (v0 > v1)));
+        v0 = (((v1 <= 67) + (a0[7] % 5)) < ((78 >= v1) == (v1 + a1[3][7])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v2 = (((a1[1][14] > v0) && (v1 >= i0)) < ((66 == v0) && (a1[1][8] * v2)));
+            v1 = (((v1 ? v2 : v3) == (96 ? 98 : 71)) && ((i0 < i0) || (v1 && v2)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v2 = (((i1 < a1[1][4]) && (a0[14] >= 25)) % 6);
+                    v1 = (((7 ? v2 : v2) + (i0 > i1)) >= ((a0[14] < v1) * (v0 / 5)));
+                    a1[0][13] = (((v0 ? i0 : 38) || (v1 / 4)) >= ((79 ? a0[2] : v1) + (6 || v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a0[12] = (((66 && 23) + (a1[0][1] < v1)) ? ((v3 - a1[0][11]) <= (a0[7] * v1)) : ((v2 % 4) > (v1 || a1[3][3])));
+                a0[11] = (((i3 % 3) - (52 > i2)) == ((v2 < v0) % 9));
+                v2 = (((a1[0][10] != v2) - (i2 ? i2 : i3)) + ((v3 == i2) <= (i2 && i3)));
+            }
+            a1[0][11] = (((24 ? v0 : a0[4]) + (6 < 69)) > ((i2 || 38) * (67 ? 47 : 37)));
+            v0 = (((v2 >= 98) ? (84 || v1) : (v2 * a1[0][5])) == ((v3 ? a1[2][3] : v3) / 4));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    return (((v0 <= 77) || (a0[1] - v1)) >= ((v3 >= v1) <= (41 * v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,85 @@
+int f0() {
+    int v0 = 85;
+    int v1 = 47;
+    int v2 = 52;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 && a0[4]) < (a1[3][7] <= 87)) > ((4 / 5) * (30 == 76)));
+    {
+        int i0 = 0;
+        do {
+            a1[3][12] = (((40 < v0) > (92 <= 77)) || ((a0[5] >= v1) && (a1[1][0] || v2)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((76 + v0) >= (v2 < a1[2][3])) / 8);
+                    v0 = (((35 - i1) != (72 || 30)) / 2);
+                    a1[0][12] = (((a1[0][9] || v0) < (i0 * 89)) ? ((v0 + 64) < (36 || i0)) : ((v1 <= v0) ? (a1[0][4] - v1) : (16 > a1[1][2])));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a1[0][13] == v3) ? (i0 % 9) : (v1 || v2)) != ((50 ? a1[1][14] : a1[0][9]) > (27 < 99)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    a0[2] = (((v3 - a1[0][7]) == (a1[3][5] > v1)) + ((a1[1][2] && v0) + (v0 - 85)));
+    if ((((a1[3][6] ? 27 : a0[6]) + (v2 % 1)) % 4)) {
+        a0[6] = (((v2 < a1[1][2]) >= (v0 > a0[0])) + ((36 || a0[4]) % 4));
+        v2 = (((v2 % 4) <= (77 * v0)) == ((v1 * 81) + (95 && v3)));
+        v1 = (((v2 > v3) > (24 <= a1[1][9])) || ((a1[3][6] + v0) % 8));
+    } else {
+        a1[1][2] = (((v3 - 31) ? (v1 != 89) : (v0 == a0[9])) || ((v3 <= 76) > (a1[1][10] != v0)));
+        v3 = (((v1 <= v2) + (98 != a1[0][2])) < ((v1 && 18) && (a1[3][10] * v2)));
+        v2 = (((15 ? 31 : 8) || (v3 - v2)) >= ((v3 == v2) * (a0[1] ? v3 : a1[0][11])));
+    }
+    if ((((87 * a0[1]) / 2) - ((v3 && 19) < (a1[0][13] <= v3)))) {
+        v2 = (((v1 * v0) || (a1[2][6] ? 17 : v2)) - ((v1 * a0[13]) ? (v0 < v2) : (v2 / 1)));
+        a1[2][0] = (((v2 > v2) ? (a0[4] ? a1[0][4] : a0[9]) : (v0 >= a0[0])) && ((v3 ? a1[2][1] : v0) + (17 == a0[7])));
+        v0 = (((v1 ? v1 : a0[7]) - (a1[3][7] || 58)) != ((v1 && v1) >= (a1[0][15] <= v2)));
+    } else {
+        v2 = (((32 != 91) >= (a0[7] % 9)) && ((47 <= v2) <= (14 ? a1[2][12] : v2)));
+        v3 = (((2 / 7) > (a0[13] % 8)) / 8);
+        v0 = (((v3 ? a0[10] : v3) * (32 < v2)) != ((a1[3][12] <= 16) ? (v1 != a0[0]) : (v1 || v2)));
+    }
+    return (((a1[1][0] * a1[0][7]) > (9 <= a1[0][5])) - ((a1[0][5] && 73) >= (v1 || a0[12])));
+}
+int f1() {
+    int v0 = 79;
+    int v1 = 54;
+    int v2 = 90;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a0[6] = (((a0[3] ? 73 : v2) && (a0[5] + 27)) + ((a1[2][6] + v2) && (v3 ? v0 : a1[1][10])));
+        a0[13] = (((a1[3][12] < v1) > (v2 <= a0[11])) || ((i0 && v2) && (81 ? v0 : 51)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v1 = (((33 - v3) > (34 - a1[3][1])) - ((v1 >= i1) || (13 == 31)));
+            v3 = (((47 >= a0[2]) % 3) > ((a1[0][13] >= a0[4]) < (38 && 2)));
+            a1[3][13] = (((66 / 8) < (46 * v1)) * ((a0[2] == a0[12]) % 4));
+        }
+    }
+    a0[12] = (((61 <= 42) >= (v1 >= 66)) % 3);
+    a0[0] = (((74 != v2) <= (v1 || 12)) / 2);
+    a1[2][10] = (((v0 * v1) >= (v1 + a1[0][5])) % 8);
+    v2 = (((47 < a1[2][11]) >= (v3 != a1[0][5])) % 4);
+    return (((v2 < v1) || (90 == 35)) ? ((92 != a1[0][13]) ? (v2 / 7) : (v1 != a1[2][5])) : ((v1 == v0) && (a1[3][3] ? 73 : v2)));
+}
+int f2() {
+    int v0 = 37;
+    int v1 = 96;
+    int v2 = 5;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((75 * a1[1][6]) / 3) >= ((v0 > v2) <= (v3 >= v2)));
+    v1 = (((51 ? v0 : v3) * (v3 ? 18 : a1[2][5])) % 4);
+    v2 = (((v1 >= v0) ? (a1[0][14] > v1) : (83 == v2)) <= ((v2 % 6) != (99 > 35)));
+    v3 = (((a0[9] == v1) == (a1[2][15] == v0)) || ((a0[12] != v3) != (v1 && a1[0][2])));
+    a1[1][15] = (((v2 * v3) - (a0[10] == a1[0][10])) + ((24 >= a1[0][9]) == (v1 - v2)));
+    return (((79 != v1) != (a0[9] ? 65 : 2)) || ((v2 * a1[3][2]) * (v1 < a0[15])));
+}
+int main() {
+    return 0;
+}
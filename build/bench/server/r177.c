@@ -0,0 +1,58 @@
+int f0() {
+    int v0 = 66;
+    int v1 = 49;
+    int v2 = 47;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[15] == v0) != (v2 + v2)) >= ((v3 || v0) || (v3 == a0[14])));
+            {
+                int i1 = 0;
+                do {
+                    if ((50 + a1[2][15]) > 56) break;
+                    v3 = (((v0 * 16) - (v2 ? i1 : 31)) ? ((90 && 31) != (v3 - a0[6])) : ((v1 * v3) > (a1[2][6] - i0)));
+                    v3 = (((0 + v0) && (66 % 5)) ? ((a1[3][2] ? v3 : 96) <= (v2 * a0[10])) : ((v3 == v1) == (i1 && v2)));
+                    a0[9] = (((i0 % 3) - (73 != 74)) ? ((15 == v3) || (a1[2][4] >= 31)) : ((i0 ? 71 : i1) > (v2 * v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v0 = (((3 + v1) != (87 || v3)) ? ((83 / 3) / 3) : ((57 || a0[14]) && (a0[5] >= i0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    a1[3][10] = (((v3 >= 0) > (7 - v1)) - ((a0[12] / 1) % 6));
+                    v2 = (((v1 == v0) % 5) / 3);
+                    v1 = (((a0[15] < 29) / 5) % 1);
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v0 ? v2 : v0) != (84 > v1)) - ((v3 <= v3) % 5));
+            a0[1] = (((v2 % 1) + (v1 < 92)) == ((42 ? v0 : 34) < (99 % 4)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((a1[0][8] / 8) || (v0 ? 96 : a1[0][5])) < ((v0 <= a0[12]) ? (v0 * a0[8]) : (v3 % 6)))) {
+        a1[2][10] = (((a0[2] >= v2) >= (a0[5] ? 7 : v3)) || ((a1[1][0] || a1[1][11]) || (a0[4] != a1[3][2])));
+        v1 = (((29 % 1) - (v1 ? a0[7] : a0[7])) + ((a1[3][3] ? 21 : a0[3]) <= (v0 - v0)));
+        a0[14] = (((a1[1][13] / 8) * (44 == a0[3])) >= ((v2 % 7) == (v2 <= a0[15])));
+    } else {
+        v2 = (((a0[14] ? v1 : v1) + (a0[9] % 6)) <= ((7 && a1[0][4]) % 1));
+        v2 = (((70 != a1[3][14]) >= (a1[3][6] / 4)) && ((a1[0][5] != v3) >= (a1[0][14] ? v3 : v0)));
+        v0 = (((v3 < 29) >= (v0 + v1)) || ((v0 && 29) == (v1 || v2)));
+    }
+    v3 = (((a1[0][1] != a0[13]) ? (v0 == a0[14]) : (v2 ? v0 : v1)) * ((v0 > 32) <= (89 + 99)));
+    a1[1][3] = (((a1[1][11] >= v3) ? (a1[3][5] % 9) : (v3 > v3)) < ((a1[0][15] > 28) >= (v2 % 2)));
+    return (((v2 + 61) < (v1 + a0[5])) > ((a0[7] % 7) < (v1 >= 17)));
+}
+int main() {
+    return 0;
+}
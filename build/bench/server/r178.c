@@ -0,0 +1,112 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 35;
+    int v2 = 63;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((10 != v1) + (a1[3][3] ? 6 : v3)) || ((a1[1][10] % 3) ? (i0 <= v0) : (v1 ? i0 : a0[1])));
+            a1[1][8] = (((v0 * 79) > (7 % 4)) * ((74 - 60) <= (15 > v2)));
+            {
+                int i1 = 0;
+                do {
+                    a1[1][4] = (((a1[3][14] <= a0[12]) ? (i0 >= v2) : (i0 * i1)) == ((v1 >= a0[3]) <= (a1[1][15] ? v0 : a1[0][12])));
+                    v1 = (((a0[12] ? v1 : i0) % 5) > ((v0 % 8) > (i0 % 4)));
+                    a1[0][10] = (((52 <= v1) == (i0 == a1[3][11])) + ((v3 * a1[0][12]) * (i1 + v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((i2 ? i2 : v0) > 72) break;
+        a0[12] = (((v0 % 8) <= (a0[5] * a1[2][14])) < ((a1[1][5] + v3) || (82 < 76)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((37 / 2) / 2) && ((v2 % 9) * (v2 == i2)));
+                a0[7] = (((8 || v1) * (a1[2][1] - a1[0][12])) && ((v1 < 83) >= (a1[2][12] / 5)));
+                v3 = (((a1[0][9] + i2) < (v2 ? a1[1][7] : v0)) && ((v1 / 5) || (v2 + v0)));
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+        v3 = (((a0[4] * a1[2][8]) && (v2 == v0)) * ((v0 == 7) != (i2 > v0)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[0] = (((v0 && 66) + (v2 + 36)) <= ((a0[1] * a0[11]) && (a0[9] * v1)));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    v1 = (((88 != v2) == (55 > 10)) <= ((v1 * 13) >= (v2 > i5)));
+                    a1[3][7] = (((a1[1][3] % 5) + (a1[3][13] - 62)) || ((v1 >= v3) % 8));
+                    v2 = (((5 || v0) * (v2 % 3)) * ((v1 / 8) || (v2 <= v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[12] = (((v0 * v1) <= (v2 == 93)) >= ((53 && v2) == (a1[3][14] <= a1[0][0])));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    a0[1] = (((v2 ? 51 : v0) + (22 == v2)) - ((a1[0][14] > v0) ? (v1 ? 42 : v3) : (a1[0][10] || 22)));
+    a1[1][3] = (((v3 - 98) || (v3 ? 19 : v0)) != ((v2 % 3) != (a1[2][3] && v0)));
+    return (((a0[1] || a0[0]) ? (a1[0][1] * a1[1][15]) : (v1 || v0)) || ((v1 >= v2) || (41 == v0)));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 6;
+    int v2 = 28;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a0[14] = (((v0 == v0) + (v1 != v2)) > ((v3 < a1[3][2]) / 8));
+                v2 = (((v1 % 3) * (a0[12] * 55)) <= ((20 == 40) != (26 >= a0[12])));
+                v3 = (((a1[1][2] ? 81 : 14) >= (72 && 96)) <= ((v2 / 7) % 4));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        a1[3][0] = (((a1[0][12] && a1[3][7]) - (v0 && 92)) != ((a1[2][1] && i0) <= (a0[9] + a1[3][4])));
+        a0[3] = (((86 < v2) % 5) % 3);
+    }
+    v1 = (((a0[6] - v0) - (62 > 22)) <= ((v2 / 9) && (v1 / 3)));
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v3 = (((v1 ? v2 : v1) + (44 % 9)) && ((v1 >= a1[1][9]) >= (a0[12] == 25)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((i3 > a0[0]) - (i3 ? 60 : v3)) <= ((v0 > 49) && (v3 + a0[7])));
+                    a1[0][13] = (((v3 < 8) || (54 / 8)) || ((i2 && 29) || (a1[2][4] ? a1[1][8] : i3)));
+                    v1 = (((v2 > i2) / 5) < ((a1[2][3] ? 16 : v0) || (a1[1][1] && v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v3 = (((2 != 69) < (34 + a1[2][10])) ? ((v2 >= 80) / 4) : ((v3 != 13) - (v1 <= i2)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 <= v0) && (a1[2][14] * 25)) && ((90 != v0) - (v0 && v2)))) {
+        v1 = (((v0 && 1) >= (v3 && 1)) / 4);
+        a1[0][6] = (((a1[0][14] <= a1[0][10]) > (v2 * v2)) % 4);
+        a1[3][4] = (((v3 < 63) > (27 + v1)) < ((v2 == a1[0][13]) * (v2 ? a0[7] : v1)));
+    } else {
+        a0[8] = (((a0[14] == 71) < (v3 >= v0)) >= ((26 - v2) != (a1[0][14] % 5)));
+        v2 = (((v0 % 5) < (v0 + v1)) - ((a0[4] != v0) % 5));
+        a1[2][1] = (((v2 ? 23 : a1[3][10]) == (v3 && v2)) ? ((a0[7] >= 66) >= (a1[0][15] != v0)) : ((7 < 41) || (a0[7] ? v1 : 80)));
+    }
+    v3 = (((v3 * v1) >= (26 < v0)) ? ((v3 ? a0[8] : v0) / 1) : ((60 && v1) * (v0 / 3)));
+    return (((a1[1][6] != 6) * (v3 >= v2)) && ((15 % 4) <= (v1 - v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,204 @@
+int f0() {
+    int v0 = 97;
+    int v1 = 6;
+    int v2 = 75;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a0[1] = (((v0 <= a0[6]) * (a1[0][12] / 5)) - ((a1[0][6] ? v2 : i0) < (a1[0][10] <= a1[3][14])));
+                a1[1][12] = (((i0 || a1[2][7]) || (i0 ? v2 : v3)) != ((a1[1][0] >= v2) % 6));
+                a0[0] = (((i1 ? a0[10] : i1) + (v2 < a1[1][0])) - ((4 / 9) - (98 ? a1[0][3] : i0)));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v3 = (((46 % 4) < (v3 <= 72)) % 2);
+        v3 = (((v0 % 5) ? (v0 || a0[12]) : (a0[12] != a0[0])) == ((v0 != v2) <= (a0[3] <= v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((95 == a0[12]) > 96) break;
+            a1[0][4] = (((v3 && a0[11]) ? (a1[2][6] == a1[1][0]) : (94 <= v3)) > ((v3 != v3) % 9));
+            v3 = (((v2 * 92) > (11 / 8)) && ((v1 ? 53 : i2) / 9));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((84 / 4) % 7) < ((32 ? i2 : v1) % 1));
+                    v0 = (((a1[1][4] <= i3) && (i3 == 58)) <= ((v3 <= v3) - (a1[3][3] != v2)));
+                    v0 = (((v0 >= v2) * (v2 - a1[2][4])) == ((a1[1][0] + a0[9]) < (v0 ? i2 : i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v1 % 8) > (25 > a0[9])) != ((29 / 3) / 1));
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v2 = (((v0 && v3) && (9 && v3)) != ((v1 * 89) - (i4 > 74)));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            v3 = (((6 - i5) >= (v1 == 12)) >= ((v1 - 78) && (i4 ? 65 : 75)));
+            a1[2][8] = (((a1[2][14] <= v3) * (92 % 7)) * ((a1[3][0] ? 32 : 94) >= (i4 * a0[9])));
+            a1[3][14] = (((v3 - 79) || (a1[0][13] + i4)) != ((a0[15] <= 31) == (v2 / 6)));
+        }
+        a0[3] = (((a1[2][9] != i4) > (63 ? v3 : v1)) ? ((v1 - 1) % 7) : ((29 < 50) * (v2 ? v2 : 8)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v2 = (((57 || 62) % 3) == ((v2 && a1[3][14]) && (v0 ? i6 : a0[3])));
+                a1[3][11] = (((73 < i7) >= (i7 || v2)) <= ((a0[7] == 37) - (v1 % 8)));
+                v1 = (((i7 % 9) >= (i7 < v0)) || ((i6 + v0) > (44 > 72)));
+                i7 = i7 + 1;
+            } while (i7 < 3);
+        }
+        a1[2][5] = (((a1[2][4] <= 83) == (v1 == i6)) > ((i6 > 99) <= (v3 <= 25)));
+        v2 = (((v1 * a0[6]) != (v0 < a0[11])) - ((v1 < v1) * (a0[15] * v3)));
+    }
+    return (((a0[4] / 9) || (64 / 6)) - ((a0[10] ? 5 : 87) != (a0[1] / 8)));
+}
+int f1() {
+    int v0 = 57;
+    int v1 = 42;
+    int v2 = 94;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 * v1) || (61 > a0[10])) || ((v3 <= a1[3][10]) == (v1 > v3)))) {
+        v2 = (((v1 - 61) / 5) < ((3 || v1) - (v2 <= 70)));
+        a1[3][10] = (((a1[0][6] % 2) >= (70 - v0)) / 3);
+        v3 = (((8 - 7) > (a1[1][12] % 3)) <= ((a1[2][1] + v1) % 2));
+    } else {
+        v2 = (((v3 / 7) > (v0 % 2)) / 1);
+        v0 = (((55 ? a0[13] : a1[3][8]) < (v1 || v0)) % 8);
+        a0[3] = (((39 != 2) || (a0[7] == v0)) <= ((v1 >= a0[7]) != (71 ? v1 : v0)));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v3 = (((v3 != v0) / 3) != ((v0 ? i0 : 35) * (v1 >= i0)));
+        v1 = (((a1[1][14] >= a0[10]) != (a0[13] - i0)) % 7);
+        {
+            int i1 = 0;
+            do {
+                if ((v3 % 7) > 63) break;
+                a0[9] = (((v3 - v3) ? (i1 ? i0 : v0) : (97 < 46)) % 1);
+                v1 = (((54 == v0) <= (v0 >= a0[9])) && ((i1 / 6) ? (v1 <= v1) : (a0[0] ? a1[0][14] : a0[8])));
+                v3 = (((a1[3][5] && v3) >= (a1[0][11] == 47)) <= ((a0[14] == v3) && (v3 / 7)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[2][9] = (((a1[3][13] ? 25 : v3) == (v2 * a1[3][1])) != ((v3 * a0[15]) < (a1[3][11] ? 84 : a1[0][8])));
+            v0 = (((22 || a0[11]) <= (a1[0][4] + v1)) % 8);
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((v0 % 2) || (a0[1] / 3)) ? ((i2 % 5) >= (91 <= v2)) : ((a0[9] > 8) && (v2 ? i2 : a0[15])));
+                    v3 = (((i2 < 43) <= (i2 != i2)) ? ((i2 && i3) < (69 / 4)) : ((a0[1] >= v2) ? (29 ? 25 : v0) : (v2 < i3)));
+                    v1 = (((18 != 2) && (a0[3] || a1[2][6])) ? ((v1 - 91) == (a1[0][13] - i3)) : ((v0 >= i2) || (v3 % 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    a0[5] = (((a0[12] / 5) > (a0[13] + a0[3])) + ((2 <= v2) + (a0[11] && a0[3])));
+    {
+        int i4 = 0;
+        do {
+            if ((76 + v1) > 81) break;
+            v0 = (((82 >= a1[0][12]) == (v1 % 4)) == ((v1 * i4) + (2 + v3)));
+            v0 = (((v1 - v3) || (v2 ? 66 : a1[1][13])) ? ((63 * 36) <= (v0 >= v3)) : ((v0 || v2) < (68 + v0)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v3 = (((v1 - v1) * (v0 < v2)) && ((v3 != a0[14]) - (a0[13] * v3)));
+                v3 = (((33 <= a0[10]) <= (99 && a1[2][8])) / 2);
+                v3 = (((v1 && 81) + (v2 >= 79)) ? ((77 == 1) - (i4 > i4)) : ((i4 >= 15) < (99 * v3)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((19 && v2) + (v3 + v0)) < ((a0[10] / 2) != (v0 > v1)));
+}
+int f2() {
+    int v0 = 84;
+    int v1 = 16;
+    int v2 = 96;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            {
+                int i1 = 0;
+                do {
+                    a0[8] = (((v1 % 5) * (a0[15] ? 53 : v0)) && ((i1 / 2) && (v0 > a1[1][11])));
+                    a0[8] = (((v2 && 85) ? (98 - 52) : (v3 * 22)) < ((4 ? v3 : i0) - (23 >= i0)));
+                    a0[8] = (((v0 >= 10) || (35 * v3)) && ((v1 > v1) >= (i1 >= i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v0 = (((75 / 3) >= (60 < v0)) % 8);
+            v3 = (((a0[8] % 8) >= (v3 < i0)) ? ((a1[0][11] != a1[0][6]) / 1) : ((38 > 51) != (i0 <= 19)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v1 = (((44 / 9) + (v1 < i2)) * ((v0 >= a0[3]) ? (a1[2][9] - v1) : (v2 && a0[9])));
+            v0 = (((24 - i2) && (a1[1][11] <= i3)) ? ((a0[15] <= i3) == (a1[1][12] + a0[6])) : ((i3 ? 25 : v3) % 4));
+            a0[10] = (((22 < 94) ? (a0[2] % 6) : (v2 ? i3 : a0[0])) || ((94 % 3) - (i2 > 78)));
+        }
+        v1 = (((a1[0][1] / 4) % 4) ? ((a0[1] % 4) <= (v0 <= a0[8])) : ((47 >= v3) % 7));
+        v3 = (((i2 != a1[3][1]) < (a1[1][0] && v2)) % 4);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v0 = (((a0[2] <= v2) || (26 != v2)) % 9);
+                v0 = (((90 ? 97 : i4) < (i4 || 74)) == ((v3 <= i5) >= (i4 || 62)));
+                v0 = (((v1 != 45) <= (a0[0] != i5)) % 2);
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        v2 = (((v0 > a0[12]) % 1) > ((v1 || a0[6]) >= (77 % 5)));
+        v3 = (((v2 - 26) && (a1[3][4] * v3)) + ((31 == 4) > (v1 || 85)));
+    }
+    if ((((v2 - 2) != (a1[1][6] <= v0)) <= ((95 || v1) != (a1[2][12] ? a1[2][13] : a1[1][8])))) {
+        a0[11] = (((a0[3] <= v3) == (v3 % 4)) * ((v0 == 46) || (a1[3][10] - a1[3][1])));
+        a0[7] = (((v0 % 2) - (v3 % 4)) > ((32 <= v0) + (v1 / 3)));
+        a0[13] = (((a1[2][6] <= v2) + (v2 >= v1)) + ((v3 && v3) == (81 || 65)));
+    } else {
+        a0[9] = (((a1[0][14] % 5) > (a0[15] || v0)) * ((a0[3] ? v1 : 85) ? (9 - v2) : (a1[3][8] || v1)));
+        v1 = (((89 / 4) >= (19 && v0)) / 2);
+        a1[2][10] = (((a0[14] ? a0[6] : a0[9]) + (70 > v1)) == ((a0[10] / 6) && (75 + v1)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v0 = (((a0[15] ? 38 : a1[0][7]) ? (a1[3][8] <= v3) : (a0[10] ? 55 : 2)) % 6);
+            {
+                int i7 = 0;
+                do {
+                    a1[1][10] = (((i6 && a0[10]) > (v1 <= i6)) < ((v0 || i7) < (v1 && a0[12])));
+                    v1 = (((94 == 21) >= (i6 <= v3)) ? ((80 / 6) % 2) : ((i7 == a1[0][9]) && (v2 == v2)));
+                    a1[0][9] = (((i6 >= a1[2][14]) / 5) % 3);
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            a1[1][10] = (((i6 <= 95) - (v2 && 24)) + ((81 == v1) < (v3 ? a0[2] : 69)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((v2 || v3) == (6 ? 78 : v1)) || ((v3 >= v1) + (68 + v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,82 @@
+int f0() {
+    int v0 = 45;
+    int v1 = 58;
+    int v2 = 45;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((58 ? a0[1] : 37) && (a0[3] - a0[1])) ? ((v0 * a0[5]) % 3) : ((a1[2][6] || 3) != (71 && a1[1][4])));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v2 = (((a0[11] == 30) - (i0 * 55)) * ((v2 != i1) == (v1 || 28)));
+                    v0 = (((i0 ? 11 : v1) || (v1 * v1)) != ((i0 || a0[6]) && (a1[0][12] != i1)));
+                    v3 = (((a0[12] * a1[2][9]) <= (i1 ? a1[0][9] : i0)) || ((a1[2][3] == a0[6]) - (v0 - v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v2 % 1) % 7) / 7);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((9 || a1[0][2]) + (a0[13] + v3)) && ((77 == a0[5]) <= (39 == 73)))) {
+        v3 = (((31 < a1[2][7]) && (v3 - 81)) || ((v2 >= v3) <= (80 / 5)));
+        v2 = (((a0[8] <= v2) * (98 + a0[3])) > ((33 % 5) + (v0 >= v3)));
+        a1[1][6] = (((a0[3] >= a0[15]) && (v3 || 52)) ? ((v3 != v3) / 5) : ((v0 && 68) / 4));
+    } else {
+        v3 = (((v2 == a1[2][13]) <= (v3 >= 56)) != ((62 > v0) <= (65 != v2)));
+        a1[0][3] = (((a1[1][2] ? a1[0][4] : a0[2]) < (93 + a0[15])) * ((a1[2][1] ? 34 : a0[7]) / 5));
+        a1[3][15] = (((a1[0][5] * 93) + (v2 >= a0[15])) * ((v2 % 6) >= (v0 > v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((66 + a1[3][0]) > 97) break;
+            a1[0][5] = (((a0[3] >= a0[13]) || (55 == v3)) <= ((76 / 5) > (v1 <= 94)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v0 ? 20 : a1[1][12]) + (43 < a0[11])) * ((i2 - i2) || (a1[3][13] < a0[5])));
+                    v3 = (((i3 % 7) - (a0[13] ? v0 : i2)) + ((v2 == v1) % 1));
+                    v1 = (((a1[3][9] + 2) != (a0[3] || a0[14])) % 3);
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v2 = (((i2 ? a0[0] : 63) ? (5 / 1) : (a1[3][13] > v1)) && ((21 == a1[1][5]) ? (v2 && i2) : (85 ? v3 : v2)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((9 <= a1[1][15]) || (a0[14] >= v2)) < ((a0[8] ? v3 : a1[1][10]) ? (v1 >= v0) : (a1[1][8] + 74)))) {
+        v0 = (((v2 + a0[0]) || (a0[15] <= v1)) == ((v2 != 27) + (v1 || v1)));
+        v2 = (((a0[15] * v0) / 3) ? ((29 && 27) ? (v0 / 2) : (80 || v0)) : ((v3 || v3) > (88 && v2)));
+        v3 = (((v3 + v3) == (a0[0] > a0[4])) && ((v3 > 40) - (v3 && 20)));
+    } else {
+        v0 = (((a0[15] > a0[14]) < (v2 <= v3)) % 9);
+        a0[9] = (((v1 + v3) || (32 ? 36 : v1)) >= ((v2 + v3) < (v1 > v3)));
+        a1[1][6] = (((v3 < 50) != (v1 / 1)) % 3);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((63 - v0) > 60) break;
+            a1[1][1] = (((a0[13] + v0) == (v0 - a0[1])) ? ((75 >= v1) - (v2 ? v2 : a1[3][8])) : ((v2 % 9) % 3));
+            v1 = (((16 > 94) == (63 > v0)) != ((v1 == 23) < (v0 && v2)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                if ((i4 ? v3 : 24) > 59) break;
+                a1[3][6] = (((6 <= 25) > (i4 == v1)) <= ((v2 > v0) > (v2 == v2)));
+                a0[12] = (((53 / 4) / 2) % 4);
+                v2 = (((v3 && a1[1][7]) + (v2 < v0)) < ((v0 - i4) >= (45 != 99)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((v0 % 3) > (v0 < 1)) + ((a1[2][7] && 21) >= (8 % 6)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,49 @@
+int f0() {
+    int v0 = 41;
+    int v1 = 69;
+    int v2 = 37;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 != v2) - (a1[1][7] < a1[1][11])) < ((71 % 4) ? (v1 && 35) : (a0[10] || 71)))) {
+        v3 = (((91 / 9) != (40 || v3)) && ((17 == v2) > (a1[0][7] ? v2 : 69)));
+        v0 = (((v2 > a0[2]) || (58 - 75)) || ((4 + 38) || (a0[12] || 30)));
+        a1[3][15] = (((v3 >= v2) && (64 <= v3)) > ((a0[12] >= a0[7]) / 7));
+    } else {
+        v0 = (((36 || a1[1][13]) || (v0 || v3)) || ((v0 && 16) - (v2 % 6)));
+        a1[1][3] = (((v3 - a1[0][13]) * (v2 + v3)) + ((a1[0][7] * a1[2][12]) && (6 % 6)));
+        v1 = (((v1 == 39) >= (v1 >= 79)) * ((v2 * v2) <= (v2 % 5)));
+    }
+    v2 = (((a0[10] && 43) != (v3 < a1[1][5])) ? ((26 % 4) == (v2 / 8)) : ((v0 * 4) % 7));
+    if ((((v2 == 62) && (53 - a1[2][6])) ? ((v1 > 77) <= (v2 + v0)) : ((4 && v1) - (v2 / 5)))) {
+        v1 = (((v0 + v1) / 5) != ((v1 != v3) % 9));
+        a0[6] = (((a1[3][13] && v3) || (v0 + v2)) + ((v3 >= a0[12]) || (v1 <= 99)));
+        v0 = (((70 <= v3) && (35 ? 17 : v0)) <= ((a0[5] / 8) ? (v0 / 1) : (v1 + v0)));
+    } else {
+        a0[3] = (((a1[1][5] || a1[0][11]) ? (v1 || 98) : (v2 && v3)) + ((v1 + v2) / 6));
+        a0[5] = (((v3 >= v1) < (v0 ? a1[1][3] : a0[13])) >= ((v3 <= v1) + (v2 && v3)));
+        v2 = (((v1 - v2) - (v0 * a1[1][4])) ? ((v2 == v1) - (15 || a1[2][2])) : ((90 < 70) * (v0 != v3)));
+    }
+    if ((((a1[2][3] + a0[8]) > (v1 ? a0[9] : v2)) % 1)) {
+        a1[1][5] = (((a1[2][3] < 85) >= (74 == v0)) / 1);
+        a0[3] = (((a1[0][0] ? v1 : v2) % 5) && ((a1[1][14] && v1) + (a0[6] ? a0[15] : v0)));
+        v2 = (((v0 ? v1 : v1) ? (v3 > 2) : (60 && v3)) - ((v0 && 38) != (99 + 63)));
+    } else {
+        v2 = (((87 + v2) % 6) + ((v0 ? 26 : 17) / 1));
+        a0[0] = (((v3 / 2) * (34 + v2)) != ((43 * v0) / 2));
+        v1 = (((v1 > v3) <= (a0[12] < v1)) && ((v1 || 5) >= (v3 / 7)));
+    }
+    if ((((v1 ? v2 : a0[14]) != (v3 || 73)) + ((v1 % 9) / 5))) {
+        a1[1][6] = (((v1 - v1) ? (v3 || v0) : (v0 * v3)) > ((58 < 96) * (v1 + 60)));
+        a0[3] = (((v1 < a1[0][4]) - (97 ? v3 : v2)) <= ((46 / 7) == (a0[9] == v0)));
+        v3 = (((v3 > v3) <= (v3 <= 94)) ? ((66 + v3) * (v3 || a1[0][7])) : ((v1 + 17) || (a1[0][5] && a1[3][4])));
+    } else {
+        v0 = (((a1[0][15] % 7) + (v2 != a0[12])) <= ((a0[3] * v0) % 4));
+        a1[1][8] = (((v1 || 57) / 8) / 4);
+        v1 = (((93 > a1[3][6]) * (a0[14] && 31)) == ((v1 / 6) <= (a1[3][10] - v2)));
+    }
+    return (((a1[1][5] == v0) + (v0 / 8)) ? ((a1[0][14] < v2) / 2) : ((20 ? 2 : v2) / 1));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,141 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 66;
+    int v2 = 43;
+    int v3 = 5;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v2 + a0[3]) ? (a0[0] - v0) : (a0[10] ? v0 : i0)) || ((a1[3][9] != v2) != (v3 && v0)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v1 = (((a0[11] - 36) + (i0 != v1)) || ((v3 && 14) != (i1 % 8)));
+                    a1[1][0] = (((v3 - i0) / 7) ? ((a0[5] / 4) ? (23 <= a1[3][13]) : (v2 + v3)) : ((v3 ? v3 : a0[10]) * (v0 == i0)));
+                    v0 = (((i0 % 5) / 1) - ((v3 >= v2) ? (49 / 7) : (89 == v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[5] = (((i0 || v3) && (v2 ? 58 : 37)) == ((i0 != v3) || (a0[11] % 5)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    v2 = (((v1 == v3) ? (v0 % 8) : (a1[1][6] > a0[12])) * ((a0[15] >= v0) % 3));
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v3 = (((64 ? v3 : 70) > (37 == v2)) || ((60 || a1[3][1]) < (v2 + v3)));
+        v2 = (((v1 ? v3 : v2) ? (v1 < a1[0][2]) : (v1 == i2)) != ((i2 % 9) + (12 - v3)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((i2 * v0) > 69) break;
+                v3 = (((v1 < 49) ? (a0[9] ? a0[6] : v3) : (v2 < a0[5])) + ((57 && a0[1]) >= (a1[2][14] / 7)));
+                a0[10] = (((a1[0][10] && a0[9]) <= (32 % 8)) >= ((v2 <= 82) == (75 < i2)));
+                v3 = (((i2 != v1) >= (a0[1] < 77)) <= ((v0 % 9) + (v2 || i3)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((v2 && 34) >= (v3 > v0)) - ((v1 || v3) && (v2 < a0[11])))) {
+        v2 = (((v3 ? v3 : v1) && (55 <= v1)) < ((v1 == v3) > (12 || v1)));
+        v3 = (((v2 > v1) / 3) <= ((40 ? v0 : a0[11]) / 4));
+        a1[3][11] = (((52 ? v2 : v0) < (a1[0][10] != 76)) ? ((v0 * v3) && (v0 > v2)) : ((11 < a1[2][5]) < (v3 + 35)));
+    } else {
+        v3 = (((v2 > v3) >= (23 || 97)) * ((v2 * 39) != (a1[2][1] ? 44 : a1[2][5])));
+        v1 = (((v3 - v1) ? (a0[14] >= a0[11]) : (a0[3] + a0[4])) <= ((v3 && v3) < (34 - 95)));
+        a0[10] = (((v1 ? 70 : 99) || (69 || a1[1][4])) && ((v0 + v0) > (v1 == v0)));
+    }
+    if ((((a0[3] + a1[0][9]) == (v3 >= v0)) + ((a1[3][10] == a1[2][5]) - (v1 >= v2)))) {
+        a1[1][0] = (((v3 != v2) * (v0 >= 71)) > ((v1 <= v1) % 9));
+        v3 = (((v1 >= a1[2][6]) ? (v2 ? v1 : v2) : (v1 ? v0 : v0)) ? ((v2 && v0) >= (71 ? a0[15] : v0)) : ((v1 + 48) * (a1[3][9] <= a1[2][10])));
+        v3 = (((v1 % 5) / 7) ? ((26 >= v1) >= (a0[7] > v1)) : ((3 <= a0[5]) < (v3 - a0[6])));
+    } else {
+        v1 = (((v1 > v0) ? (12 * v2) : (v2 * v1)) ? ((a1[2][5] && 60) ? (v1 ? v3 : 75) : (a1[2][8] && v3)) : ((a1[3][13] >= v3) < (v2 - v2)));
+        v2 = (((a0[15] != a0[7]) * (a1[2][13] && 20)) == ((a0[1] > a1[0][10]) == (v3 > v1)));
+        a1[1][12] = (((v3 % 9) >= (24 && v1)) - ((v0 ? v3 : 23) - (v3 < v0)));
+    }
+    return (((a0[13] % 6) ? (a0[15] < 74) : (v1 * a0[5])) <= ((a1[2][8] || 46) <= (52 && a0[12])));
+}
+int f1() {
+    int v0 = 72;
+    int v1 = 77;
+    int v2 = 6;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[13] = (((v0 != 1) && (24 > a1[1][5])) * ((v0 ? 18 : v3) && (v1 > a1[2][1])));
+            v1 = (((a1[0][9] || v2) <= (4 < i0)) < ((a0[13] ? v2 : a0[5]) * (v0 * a0[0])));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a0[15] = (((i1 * v0) != (49 <= 62)) || ((a1[0][15] > i1) ? (i1 ? i0 : v3) : (a1[3][9] == v0)));
+                    v0 = (((a1[2][6] || a1[2][0]) - (a0[12] / 9)) ? ((8 % 5) || (v1 < v1)) : ((11 ? 76 : 79) * (a1[2][0] + a1[1][11])));
+                    a1[1][4] = (((a0[9] > 86) || (v0 % 6)) > ((v3 || a0[11]) || (i0 >= a1[1][3])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v1 ? a1[0][1] : 33) || (53 == 43)) && ((a1[3][10] < v2) + (85 % 2)))) {
+        v0 = (((v0 ? v2 : a0[6]) || (v3 / 4)) / 9);
+        v2 = (((v0 + v0) == (94 ? 18 : a1[1][14])) * ((a1[0][8] >= a1[3][4]) * (20 ? v0 : 21)));
+        v2 = (((v1 > a0[3]) > (v2 || v1)) - ((v2 != 4) ? (v2 < 13) : (2 != a1[3][13])));
+    } else {
+        v2 = (((67 ? a0[0] : v1) && (v0 == 63)) || ((v2 > a0[12]) != (v1 * v2)));
+        v2 = (((v3 == a1[2][15]) * (41 ? v3 : v3)) <= ((a0[13] * v3) * (v2 >= 36)));
+        a1[3][5] = (((16 < a1[0][4]) || (17 + 7)) <= ((v2 != a0[3]) - (a1[3][3] > v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a1[0][11] = (((i2 <= 42) * (a0[5] % 8)) / 4);
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v0 = (((95 > v2) * (69 * a0[3])) == ((v0 < v1) > (a1[3][5] + v1)));
+                    v3 = (((i2 == v3) ? (i2 && a0[10]) : (v0 ? v3 : v2)) || ((v2 * a1[2][8]) <= (52 == a0[1])));
+                    v3 = (((53 - v1) ? (v2 || i2) : (9 >= 39)) - ((i2 > 82) || (79 && v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v3 >= 36) % 1) - ((82 ? 94 : a1[1][3]) == (i2 && a1[0][10])));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a1[3][15] = (((a1[3][8] ? a1[0][1] : v2) == (a1[0][7] < a1[1][7])) >= ((v2 == a1[3][10]) > (v0 ? a0[7] : 59)));
+        a0[2] = (((14 >= v0) < (93 ? i4 : 84)) * ((v1 < a1[1][14]) - (v3 <= a0[0])));
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                a1[3][0] = (((i5 ? v2 : a0[14]) % 9) * ((a0[13] || 78) % 2));
+                v3 = (((v3 == v0) >= (22 <= 67)) && ((72 * v2) * (v1 ? 37 : a1[3][7])));
+                v3 = (((34 > v1) >= (v3 != i4)) && ((i5 != 62) + (a0[12] == i5)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        if ((v0 ? i6 : v3) > 61) break;
+        v2 = (((a0[5] != i6) < (3 != v2)) != ((a0[3] % 3) + (a1[2][9] || a1[1][8])));
+        {
+            int i7 = 0;
+            do {
+                v2 = (((v2 % 6) != (15 ? v2 : v0)) ? ((i6 * v0) || (73 < v3)) : ((v3 + v2) / 5));
+                v1 = (((v0 ? v2 : v2) * (a0[10] - a0[5])) && ((v3 ? i7 : i7) <= (26 && v0)));
+                a1[1][10] = (((14 || v2) * (a0[14] % 9)) <= ((v2 > a1[3][1]) - (a1[3][15] != v2)));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+        a0[12] = (((v0 - v2) || (24 % 1)) >= ((v1 * v0) && (v2 ? a0[7] : v1)));
+    }
+    return (((v3 && a1[1][12]) ? (v2 > a0[15]) : (a0[13] != v3)) >= ((81 * v1) * (a1[3][7] > v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,187 @@
+int f0() {
+    int v0 = 49;
+    int v1 = 60;
+    int v2 = 81;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v3 = (((2 % 6) * (a0[8] == v2)) ? ((i0 * 25) != (a1[3][6] >= 77)) : ((a0[7] > v2) ? (v3 != v3) : (37 % 6)));
+            v3 = (((v1 || 52) % 5) == ((31 ? v2 : v3) * (v0 % 4)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a1[0][1] = (((a0[11] / 9) <= (95 >= i0)) == ((12 ? 79 : 20) ? (v0 - v2) : (i0 < i0)));
+                v3 = (((v2 ? a1[3][1] : a0[9]) == (4 + 19)) % 2);
+                v1 = (((v3 ? v1 : v2) && (a0[10] > a0[5])) ? ((89 && v1) ? (a0[10] / 5) : (19 <= v1)) : ((79 || 12) >= (v2 ? a1[2][2] : a1[1][11])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v0 ? v1 : v0) / 9) * ((v0 < v3) < (v2 == 74)));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v3 = (((a0[11] != i2) - (a1[3][0] == i2)) && ((i2 ? a0[1] : v1) ? (a0[13] && i2) : (v2 - 26)));
+            v0 = (((i2 < v0) < (70 < i2)) ? ((v0 % 4) / 4) : ((v3 && v2) == (v3 <= 45)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v2 = (((a0[11] / 3) != (v2 != a0[11])) - ((v1 < a1[2][12]) || (a0[3] ? a0[2] : i3)));
+                a1[3][10] = (((v2 && 77) ? (a1[1][15] * v2) : (24 - a1[1][2])) > ((12 ? 64 : a0[6]) / 1));
+                a0[11] = (((61 >= v0) % 8) != ((v3 && v0) >= (v3 % 8)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((57 && 58) % 4) % 2);
+    if ((((v1 && 99) * (v3 >= 7)) * ((a1[0][14] % 7) <= (a1[1][4] ? v3 : a0[7])))) {
+        v3 = (((a0[6] == 78) % 3) / 3);
+        v0 = (((v2 != v0) <= (v1 != v1)) == ((a1[1][7] < v1) && (v3 / 3)));
+        v3 = (((v1 || 7) > (v0 || a0[7])) && ((v2 % 7) + (v3 % 8)));
+    } else {
+        v1 = (((v1 / 5) <= (66 && v3)) == ((v2 % 1) <= (v3 * v0)));
+        a1[1][7] = (((v2 % 1) ? (v2 * v0) : (v1 != 23)) ? ((v3 % 9) != (v3 || a0[1])) : ((7 != 21) <= (a0[13] == 87)));
+        v0 = (((v3 % 3) > (88 || v2)) ? ((v3 || v1) + (11 * v3)) : ((90 < v0) / 3));
+    }
+    return (((72 * v0) && (87 > 57)) <= ((a0[8] % 3) == (66 >= v0)));
+}
+int f1() {
+    int v0 = 73;
+    int v1 = 23;
+    int v2 = 94;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][14] ? a1[1][5] : 73) ? (a0[4] == v2) : (44 != v0)) % 9)) {
+        v1 = (((v2 <= v2) ? (v0 + 77) : (v2 ? v0 : 79)) + ((v3 > a1[3][8]) / 8));
+        v2 = (((v2 && v3) < (v3 - a0[2])) / 5);
+        v2 = (((v2 < v1) > (v0 >= v3)) < ((a1[2][8] <= v0) >= (v2 > 25)));
+    } else {
+        v0 = (((v3 <= v3) - (v1 >= v0)) == ((a0[15] - 67) / 2));
+        v0 = (((v1 + v3) + (a0[1] != v3)) > ((a0[12] < 15) > (35 % 5)));
+        v1 = (((v0 || 60) > (v2 && a1[1][8])) != ((97 == v3) ? (v3 ? v0 : v3) : (v1 / 1)));
+    }
+    if ((((a0[14] && v1) ? (a1[1][1] * v2) : (64 % 6)) < ((24 + 77) && (v3 || 67)))) {
+        a0[4] = (((v3 > v1) > (a1[3][2] < v2)) || ((v2 * v1) > (a1[2][5] ? v0 : v2)));
+        v2 = (((v2 == 38) > (v2 <= a1[3][13])) <= ((v3 % 2) ? (a0[1] >= a0[15]) : (32 + v2)));
+        v1 = (((5 % 5) != (v0 <= v2)) || ((v2 || 28) ? (76 < a1[0][7]) : (v2 && v0)));
+    } else {
+        v2 = (((a1[3][1] != a1[3][7]) > (v0 - v2)) != ((0 / 8) % 9));
+        v3 = (((61 % 4) == (v3 || v3)) || ((v2 - v0) < (91 ? 8 : 42)));
+        v3 = (((v3 <= 94) <= (v3 % 5)) - ((a1[1][6] && v0) || (a1[3][10] + a0[13])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((a0[6] + v3) > 77) break;
+            v0 = (((v0 && v0) + (28 == a1[2][6])) * ((v2 * a0[15]) / 2));
+            v1 = (((a0[12] ? v2 : a0[10]) < (v0 - v1)) <= ((a1[3][3] + a1[2][6]) == (a1[1][1] + 95)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v3 = (((v2 || a0[7]) && (v0 + v3)) != ((a0[14] * v1) || (a1[0][7] && 39)));
+                v1 = (((v1 ? 87 : v2) * (v1 * a0[12])) <= ((a1[0][6] - a0[13]) - (i1 == i0)));
+                v2 = (((23 - 98) <= (i0 * v2)) || ((a0[0] <= a1[2][5]) > (a1[2][3] && a1[0][15])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v1 = (((v3 >= v2) / 3) * ((v1 == v3) ? (84 && i3) : (76 || v2)));
+                a1[0][11] = (((1 ? 90 : a1[2][9]) || (i2 == 40)) % 7);
+                a1[1][13] = (((v2 == i3) % 9) ? ((a0[8] + v2) ? (a0[5] * i2) : (v2 - v1)) : ((i2 != a1[1][15]) - (i3 - 81)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v0 >= 89) ? (a1[0][15] != v0) : (v0 <= a1[3][14])) || ((94 && i2) % 7));
+        v3 = (((v3 < v0) ? (a0[2] ? v3 : a0[1]) : (86 || v1)) == ((a1[3][12] && v1) * (a1[1][6] > 82)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v2 + a1[1][11]) * (a1[2][4] != a1[3][4])) || ((v1 % 4) || (89 / 5)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    a0[0] = (((v2 < a0[11]) ? (a0[1] <= v2) : (a0[14] * v2)) ? ((19 <= i4) == (i5 * v0)) : ((43 == 92) != (51 == a1[3][15])));
+                    a1[0][13] = (((v1 && i5) - (v1 >= a0[6])) || ((v2 + v3) == (68 ? a0[8] : v2)));
+                    v1 = (((14 > i5) / 9) != ((a0[6] > v0) >= (a1[1][11] % 5)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[2][2] = (((v1 * 93) < (a1[1][0] ? 37 : 34)) >= ((a0[8] ? i4 : a0[15]) / 3));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((v0 * 8) <= (v3 + 43)) > ((v1 ? v2 : a1[3][13]) != (v0 ? 36 : a0[5])));
+}
+int f2() {
+    int v0 = 35;
+    int v1 = 91;
+    int v2 = 34;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a0[2] = (((i0 * 13) >= (i0 + 3)) + ((a0[13] + v1) / 6));
+        v1 = (((a1[2][5] + v3) || (i0 + v3)) - ((a0[6] - v0) < (14 != v1)));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v3 = (((v3 > 52) + (a1[3][15] == a1[1][3])) && ((v1 == 84) - (50 > v0)));
+            a0[1] = (((v0 < v1) * (i1 < 45)) && ((i1 * v3) - (i1 + 95)));
+            v2 = (((a1[3][4] > v2) == (i1 % 7)) == ((a0[13] % 9) ? (i1 <= a1[1][2]) : (v0 * 37)));
+        }
+    }
+    if ((((v0 >= a0[0]) * (55 * v3)) && ((a0[13] ? 81 : 25) >= (a1[3][10] != v2)))) {
+        a0[5] = (((v0 <= 17) >= (v3 > v2)) >= ((v2 >= v0) == (v0 ? 32 : v1)));
+        v0 = (((v3 != v3) < (v2 >= v2)) != ((a0[0] % 7) ? (v1 != v2) : (v2 ? v0 : v2)));
+        a1[1][7] = (((v3 > v0) ? (61 != v2) : (v3 + 55)) + ((v1 == v3) || (a1[3][1] != v3)));
+    } else {
+        v0 = (((62 / 6) ? (v2 ? 28 : 22) : (a0[2] <= v1)) % 5);
+        v0 = (((a0[12] >= 55) + (v3 + 41)) % 7);
+        v0 = (((a1[3][7] - v3) != (v3 || v1)) != ((v1 ? 96 : 80) % 8));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            {
+                int i3 = 0;
+                do {
+                    a0[2] = (((v3 > 19) == (v0 < 25)) ? ((a1[3][15] && v3) - (v1 - 19)) : ((41 / 1) && (v1 ? v1 : v3)));
+                    v2 = (((i2 != a1[0][3]) - (v0 ? 48 : a0[3])) <= ((a0[0] * v1) ? (v2 ? 76 : i3) : (61 * 23)));
+                    v2 = (((74 % 9) || (v3 == a1[2][8])) * ((73 >= 42) - (57 - 10)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a0[6] = (((a1[1][12] - a1[3][10]) == (95 / 3)) || ((a0[6] && 89) || (74 ? v2 : a0[9])));
+            v0 = (((v0 <= v0) == (v2 % 1)) ? ((88 % 7) != (v2 < v3)) : ((50 + 3) || (a1[3][1] > i2)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 ? 20 : a1[1][12]) + (a0[3] * v1)) * ((64 >= 40) ? (v3 == v0) : (v0 >= v3)))) {
+        v1 = (((79 <= v1) && (v2 * v3)) * ((v0 + 4) % 7));
+        v2 = (((v3 * a0[15]) % 1) < ((23 ? v0 : v0) ? (a1[3][0] / 5) : (v2 || a0[5])));
+        a0[2] = (((v2 <= a0[12]) && (v1 == v2)) < ((v2 != a1[0][12]) <= (a0[1] ? 59 : v3)));
+    } else {
+        a0[10] = (((97 <= v2) * (v1 >= 56)) < ((a1[1][13] != 92) && (v1 || v1)));
+        a1[1][7] = (((26 ? v3 : 28) || (a0[15] && v3)) ? ((35 ? 12 : v0) > (v1 % 3)) : ((74 || v3) + (v2 % 2)));
+        a0[4] = (((88 || a1[0][0]) <= (49 ? v1 : 19)) && ((65 ? v3 : v3) % 9));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            if ((v2 >= i4) > 82) break;
+            a1[3][12] = (((v3 || 63) - (v0 != v1)) > ((v1 > i4) || (95 < v0)));
+            v3 = (((v2 < v2) < (45 - a1[2][14])) * ((a1[0][14] / 3) <= (v0 % 6)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v1 = (((v0 * v2) >= (v0 % 8)) * ((v3 == 50) <= (v1 > v3)));
+                v0 = (((19 || i5) / 2) > ((a0[4] / 5) != (i4 <= i5)));
+                a1[2][10] = (((a0[5] && i5) != (46 / 7)) != ((a0[13] <= a1[2][13]) == (i5 != a0[2])));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((65 ? v2 : v2) != (91 == v0)) <= ((a1[1][9] && v1) != (v0 < v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 30;
+    int v1 = 52;
+    int v2 = 4;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a1[0][14] >= v1) ? (v3 / 3) : (v0 >= v0)) <= ((v3 ? v1 : v3) ? (a0[6] < v3) : (v0 && 29)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a0[9] < v3) % 8) + ((a1[3][9] * v0) - (i1 || i0)));
+                    v0 = (((i0 > 36) > (18 == a1[0][3])) / 8);
+                    v0 = (((52 || i0) - (63 + 86)) || ((v0 || v1) >= (87 == v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v1 = (((a0[10] ? v3 : 57) / 9) + ((v3 < 32) || (v0 * v3)));
+            v3 = (((a1[1][15] / 3) * (v3 >= a0[5])) == ((a1[1][0] * v2) + (a0[0] > 76)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((v0 != i2) > 62) break;
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((a0[5] + v2) <= (a0[0] > i3)) == ((51 / 7) || (v0 || v1)));
+                    v3 = (((v1 >= a1[3][0]) == (v2 > v1)) || ((v1 ? v1 : v1) ? (v3 >= v2) : (v2 < 96)));
+                    a0[12] = (((v1 != i2) * (v2 * a0[11])) < ((v2 ? a0[15] : i2) - (v2 > a0[8])));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v2 = (((v1 + a1[0][4]) && (v1 && 86)) / 4);
+            v3 = (((v3 && v2) == (80 / 3)) + ((v2 ? 55 : i2) > (72 == 21)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                a0[5] = (((i4 && 5) ? (1 + 52) : (31 <= v2)) * ((v2 + 53) + (77 - v0)));
+                v1 = (((i5 == v0) ? (i4 % 2) : (v2 % 6)) - ((56 - 57) == (61 >= a1[0][15])));
+                v3 = (((57 ? i5 : v2) * (v2 && 97)) / 4);
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        v3 = (((30 - i4) == (v2 && v2)) == ((i4 == v0) < (v0 == 27)));
+        v3 = (((91 <= v1) < (v1 ? a0[6] : 99)) && ((v2 ? a1[2][11] : a1[0][9]) % 8));
+    }
+    if ((((v2 != a1[3][5]) ? (82 == v3) : (v2 == v3)) <= ((68 - v3) < (v3 ? a0[13] : a1[2][14])))) {
+        a0[1] = (((v1 != 63) <= (v2 >= v1)) != ((v3 || v0) || (a0[8] / 8)));
+        v1 = (((v1 == v0) / 9) % 4);
+        a1[0][14] = (((v1 < v1) >= (v3 * a1[2][7])) / 2);
+    } else {
+        v0 = (((v3 != v2) && (v1 ? v3 : v0)) < ((v1 - 26) != (v0 || v1)));
+        v0 = (((v3 ? 62 : 29) < (v3 || a0[0])) / 6);
+        v2 = (((a1[1][13] * a0[4]) / 2) >= ((v1 ? a0[11] : v3) < (63 != a0[11])));
+    }
+    return (((v2 == a0[3]) != (a1[1][9] > v3)) + ((49 == 55) - (a1[1][11] ? v0 : v0)));
+}
+int main() {
+    return 0;
+}
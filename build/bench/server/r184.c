@@ -0,0 +1,147 @@
+int f0() {
+    int v0 = 0;
+    int v1 = 73;
+    int v2 = 66;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[11] && a0[4]) || (90 * a0[1])) <= ((13 + v3) >= (v0 == 34)))) {
+        v1 = (((v1 ? v1 : 41) || (7 && a0[11])) % 1);
+        a0[6] = (((76 == v3) / 5) <= ((84 ? v3 : v0) % 4));
+        a0[2] = (((v2 + v3) + (v3 < 2)) + ((v2 > 83) - (15 + a0[11])));
+    } else {
+        v2 = (((v1 > v1) + (v3 <= 22)) * ((15 && a1[3][4]) * (a0[0] > 0)));
+        v2 = (((a1[0][13] - a1[1][5]) ? (v3 && v2) : (a0[7] * v3)) / 1);
+        v1 = (((v0 % 3) == (v1 / 8)) ? ((a0[12] ? v2 : v0) * (5 / 4)) : ((v3 == v1) ? (v2 / 1) : (a1[2][9] ? v3 : 99)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v1 + a0[0]) > 90) break;
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((60 || a0[15]) > 91) break;
+                v2 = (((a0[10] == v3) / 6) || ((a1[3][12] != 36) * (5 > v1)));
+                a1[0][10] = (((a0[7] <= a0[1]) <= (v2 && 44)) > ((v1 ? v2 : v0) / 1));
+                v3 = (((v3 ? i1 : v0) + (a1[0][9] || v0)) != ((v2 - i1) != (47 ? a0[9] : 97)));
+            }
+            v1 = (((i0 ? a1[0][6] : a1[0][10]) % 3) ? ((a0[12] && 31) > (a0[9] <= a1[1][7])) : ((i0 - i0) - (v2 % 6)));
+            v2 = (((v0 <= i0) <= (a0[13] * v0)) - ((v3 % 2) + (62 || 61)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v2 * i2) >= (a1[0][11] >= a1[0][7])) < ((i2 ? v2 : v1) == (v1 >= a1[2][2])));
+            v2 = (((a1[0][13] + a0[13]) == (v2 || 13)) ? ((81 * v0) != (a0[12] - 90)) : ((i2 > 85) + (64 > 87)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                if ((a1[0][8] == i2) > 66) break;
+                a0[8] = (((2 && i2) || (a0[11] < 25)) / 5);
+                a0[15] = (((v1 && a1[0][1]) * (a1[3][6] != v1)) != ((v2 / 2) > (24 + v1)));
+                v3 = (((v3 || v1) == (i3 > 13)) <= ((a1[2][1] && 7) * (v1 - 22)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((i5 != v1) >= (57 ? v0 : v0)) || ((a0[15] ? a1[0][1] : a0[2]) != (a0[0] && 99)));
+                    v1 = (((a0[6] * i4) >= (v2 < v0)) * ((46 && v0) != (v2 ? v2 : 71)));
+                    v3 = (((a0[9] / 8) >= (a0[14] && i5)) - ((a0[15] == 46) > (a1[0][15] * v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            a1[1][1] = (((i4 != 19) < (a0[15] != 31)) >= ((84 != v3) % 1));
+            v1 = (((a1[3][8] ? v3 : 18) && (v3 >= 7)) && ((a0[13] == 86) != (a0[2] == v3)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        v0 = (((v2 % 1) || (i6 % 3)) || ((v1 % 6) - (v3 % 8)));
+        v2 = (((23 < i6) > (v1 && 19)) <= ((i6 || v3) ? (22 / 4) : (a1[1][14] <= v2)));
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            a0[6] = (((v1 || a1[1][10]) / 4) || ((v3 && v0) / 2));
+            a1[2][6] = (((v3 ? 32 : a1[1][1]) <= (v3 <= a1[1][13])) != ((i6 == i6) < (a0[1] / 9)));
+            v2 = (((v1 && a1[3][8]) <= (a0[6] ? a0[3] : v1)) < ((i7 ? a0[10] : v2) % 5));
+        }
+    }
+    return (((81 % 2) > (v1 <= v0)) < ((40 / 9) ? (v1 ? 96 : a0[8]) : (a1[0][12] <= v3)));
+}
+int f1() {
+    int v0 = 82;
+    int v1 = 58;
+    int v2 = 58;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a1[0][6] = (((a1[2][10] < 49) + (a0[15] && i0)) >= ((i1 ? 96 : a0[14]) || (i1 > i0)));
+                v0 = (((a0[2] ? a1[3][6] : a1[0][2]) >= (v0 ? v1 : a1[2][10])) ? ((v1 - i1) >= (69 > i0)) : ((a1[3][12] + v1) + (16 <= a1[2][4])));
+                v3 = (((53 * a1[0][1]) ? (i1 == a0[8]) : (a0[15] == a0[9])) != ((i1 + 22) || (68 + a1[3][6])));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v1 = (((v0 <= a1[3][5]) - (a0[3] != v0)) + ((v1 + v0) != (a0[12] >= v3)));
+        v3 = (((76 >= v3) + (a1[0][7] + 38)) ? ((v0 != 22) && (2 / 7)) : ((v0 > v3) / 6));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((i2 - 76) > 50) break;
+            v0 = (((a0[15] <= 13) + (v2 / 5)) >= ((v0 ? v0 : a0[9]) - (v0 > 35)));
+            a1[2][12] = (((i2 * a0[2]) || (v3 + v0)) ? ((i2 != a1[2][15]) != (a0[3] == v0)) : ((v0 % 9) ? (75 > 70) : (i2 / 1)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v1 = (((a0[13] ? v0 : 88) <= (68 >= v3)) && ((a1[0][10] % 8) / 3));
+                    a0[7] = (((a0[4] && 43) && (v2 * v0)) <= ((67 / 6) % 4));
+                    a1[1][13] = (((i2 ? v0 : v2) && (a0[8] >= 97)) <= ((a0[11] / 8) > (i2 ? v3 : v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((a1[2][1] < a0[12]) || (v1 ? v3 : a0[6])) ? ((20 || a1[2][11]) >= (a0[6] >= v3)) : ((v1 == a0[10]) > (v1 < a1[1][13])));
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v3 = (((a1[2][2] || v0) ? (v2 * 22) : (4 / 1)) <= ((v0 >= 44) ? (a0[8] - a1[3][11]) : (a0[13] < v2)));
+            v2 = (((v0 == v2) % 5) == ((8 * a1[2][1]) ? (v3 ? a1[3][12] : 11) : (v0 ? 49 : 15)));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((v2 / 7) == (i5 >= i4)) == ((v1 || v2) / 2));
+                    v2 = (((7 ? i4 : 77) % 4) ? ((i4 % 2) != (6 * v0)) : ((v3 && 75) <= (69 || 63)));
+                    v0 = (((v0 * v2) + (v1 <= v1)) == ((31 == a1[2][2]) > (i4 >= v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[6] = (((49 < v0) - (37 != a1[0][15])) / 4);
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v2 = (((a1[3][13] || v2) ? (v3 <= i6) : (v1 && i6)) > ((i6 == i7) >= (a0[6] ? 3 : a1[2][4])));
+                a0[8] = (((i6 - v2) > (a0[3] ? i6 : i6)) >= ((i6 < v2) % 9));
+                v3 = (((55 == a1[2][4]) + (v3 >= a0[0])) - ((15 % 5) - (v0 <= a0[3])));
+            }
+            v1 = (((a0[3] && i6) * (a0[9] / 9)) ? ((v2 <= v0) > (v0 == a0[13])) : ((v2 * 51) * (i6 && 72)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((v1 != 8) < (84 != 63)) < ((v0 > 22) >= (a0[9] % 4)));
+}
+int main() {
+    return 0;
+}
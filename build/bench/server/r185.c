@@ -0,0 +1,148 @@
+int f0() {
+    int v0 = 5;
+    int v1 = 48;
+    int v2 = 23;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 * v1) - (v0 / 5)) ? ((a1[2][7] >= a0[6]) <= (v0 < 39)) : ((v3 != v1) * (a0[13] < a1[0][8])))) {
+        v3 = (((v0 / 8) == (v1 + v2)) || ((v3 >= v0) != (60 ? a0[12] : a0[10])));
+        a0[3] = (((v3 * v0) % 1) != ((32 < v3) ? (v0 * v3) : (v1 + v1)));
+        v3 = (((21 < a0[1]) ? (35 <= v1) : (53 / 2)) / 8);
+    } else {
+        v0 = (((a0[5] + v2) > (21 ? 9 : v1)) > ((v0 % 3) == (a0[10] != v0)));
+        a0[1] = (((a0[12] ? 88 : v0) || (v0 / 3)) / 4);
+        v0 = (((v2 ? v2 : v3) == (93 || v0)) != ((a0[2] - v3) ? (a1[2][12] > a0[13]) : (a1[0][10] - a1[3][15])));
+    }
+    v3 = (((a0[15] > v2) > (v2 >= v2)) ? ((v0 % 3) - (a1[3][15] % 7)) : ((v0 - 74) ? (v0 ? v0 : a1[2][1]) : (a0[8] > v1)));
+    if ((((v0 * v2) - (v2 ? 98 : v2)) ? ((a1[2][2] - v2) ? (v3 <= 87) : (v0 == v3)) : ((a1[3][9] || 85) <= (v3 / 4)))) {
+        v0 = (((v2 && v3) == (v3 - a0[1])) >= ((v3 < v2) < (a0[7] || 91)));
+        v1 = (((v2 / 9) / 9) ? ((v2 != v0) >= (v0 % 4)) : ((v2 > v0) <= (v2 / 2)));
+        a0[12] = (((v3 == v3) > (v2 ? 77 : 15)) != ((37 <= 58) && (v3 * v3)));
+    } else {
+        v3 = (((94 > v2) % 6) + ((v0 == v3) ? (53 && v0) : (50 / 4)));
+        a1[3][5] = (((93 * a1[3][0]) * (a0[13] > 60)) >= ((v0 > v0) ? (a0[0] ? a0[5] : v2) : (a1[2][3] || a0[1])));
+        v0 = (((v0 / 2) != (a0[14] < 76)) / 4);
+    }
+    if ((((v1 - v1) >= (4 && a1[2][7])) / 4)) {
+        v0 = (((10 || a0[1]) < (2 + v1)) != ((v0 > 99) % 2));
+        v3 = (((a0[12] * v0) - (a0[14] ? a1[2][14] : v1)) + ((v1 ? 17 : v1) == (v1 > v0)));
+        v2 = (((v2 - 39) < (v1 - v3)) > ((a1[0][12] ? v2 : v2) <= (67 <= 59)));
+    } else {
+        v1 = (((v0 / 9) >= (v1 / 9)) && ((a1[0][12] <= a0[11]) && (v0 > v0)));
+        v1 = (((v2 ? a0[5] : v3) && (a1[0][1] > 83)) % 1);
+        v1 = (((v0 && a1[0][7]) % 6) ? ((54 ? 23 : a0[3]) * (v2 % 9)) : ((56 || v0) ? (v1 + v0) : (v1 + v2)));
+    }
+    if ((((71 * a0[5]) && (21 / 6)) < ((v1 + 81) ? (v3 < a0[14]) : (20 != v3)))) {
+        v1 = (((v3 >= v0) <= (v2 / 4)) + ((v3 == v3) + (v2 * v0)));
+        v0 = (((v2 + v1) || (v1 && v0)) > ((v3 <= a0[15]) % 1));
+        v1 = (((a0[3] ? v0 : v0) - (a0[4] ? a1[3][2] : v2)) + ((v0 + v0) * (a1[1][8] * v2)));
+    } else {
+        v1 = (((91 != 83) / 9) + ((v2 > v1) < (v0 || a1[0][2])));
+        a0[14] = (((a1[2][2] >= 32) / 5) ? ((v3 == v3) < (a0[3] < v3)) : ((v1 >= a0[15]) + (v1 || a1[1][6])));
+        a1[1][12] = (((a1[1][6] / 8) ? (v2 < v0) : (v3 % 9)) >= ((v3 && a1[3][10]) - (v0 >= v3)));
+    }
+    return (((20 * a0[9]) - (v3 < a1[1][4])) % 8);
+}
+int f1() {
+    int v0 = 99;
+    int v1 = 18;
+    int v2 = 97;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[14] <= a1[3][4]) == (37 || a0[10])) != ((v0 > v2) ? (1 && v1) : (v1 < 15)))) {
+        v3 = (((51 + v3) && (a1[3][6] <= v0)) <= ((17 != a1[1][11]) >= (54 == v0)));
+        a1[1][10] = (((71 > v0) / 3) || ((v3 || a0[9]) % 4));
+        v2 = (((v3 != a0[6]) != (36 - a1[2][4])) ? ((v1 > v2) <= (89 < v0)) : ((v1 % 6) ? (v0 > a0[4]) : (a0[8] >= v1)));
+    } else {
+        v0 = (((v3 ? v3 : v2) % 6) && ((v1 > a1[2][2]) >= (v2 < v2)));
+        v0 = (((v0 / 9) * (13 > 58)) != ((a1[3][9] * a1[1][12]) != (v0 && v1)));
+        v3 = (((73 + v2) < (a0[10] - a1[2][13])) > ((v2 / 9) ? (39 / 6) : (v3 >= a0[5])));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a1[0][13] = (((v0 * 44) ? (v2 ? 94 : v0) : (74 >= 34)) ? ((82 != 65) <= (i1 ? 91 : a0[3])) : ((73 % 7) / 7));
+                v1 = (((a1[0][10] == i1) ? (29 <= 0) : (a0[2] == v2)) <= ((71 || a0[5]) * (v3 && i1)));
+                a1[2][5] = (((i0 ? a1[1][6] : v3) == (v3 % 8)) != ((30 <= v3) * (v3 + a1[1][3])));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        v1 = (((18 + 93) + (32 && a1[2][7])) + ((v0 / 4) > (a1[3][3] < v1)));
+        a0[8] = (((87 == a1[2][0]) - (v3 == v1)) > ((v3 < v3) / 1));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[1][14] * 38) > 67) break;
+            a0[8] = (((53 ? v0 : a0[14]) < (a1[1][7] - 14)) == ((a1[3][1] ? a1[0][7] : a0[12]) ? (i2 < a1[1][4]) : (v3 ? 89 : a0[10])));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    if ((a0[4] + 81) > 67) break;
+                    a1[0][13] = (((v3 == v2) > (64 - 5)) > ((v3 + 44) ? (a1[1][3] == v1) : (a1[3][3] <= v2)));
+                    v2 = (((i2 || v3) / 1) > ((a0[10] ? i3 : a1[3][4]) / 6));
+                    v2 = (((72 + a0[8]) != (a0[3] != i3)) == ((v3 * v1) <= (a1[1][14] <= a1[1][14])));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a1[2][15] / 7) > (i2 / 8)) > ((i2 > v1) && (34 >= i2)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v0 = (((v1 % 8) - (64 ? v0 : 74)) || ((v0 / 6) == (12 / 3)));
+    {
+        int i4 = 0;
+        do {
+            v0 = (((a0[2] + i4) ? (v2 * i4) : (i4 < i4)) * ((v1 ? v0 : a0[7]) + (21 * 2)));
+            {
+                int i5 = 0;
+                do {
+                    if ((v3 + a1[1][15]) > 90) break;
+                    v3 = (((v1 || a1[3][12]) >= (64 * a1[2][12])) != ((i4 * i5) != (0 + v2)));
+                    v0 = (((v2 || 91) > (v3 >= i4)) != ((a0[13] ? v0 : i5) == (a0[13] - a0[8])));
+                    v0 = (((v0 > i4) != (v2 || a0[8])) ? ((55 != v3) ? (79 - i5) : (v2 / 5)) : ((53 / 2) == (v2 != a1[2][13])));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a1[0][11] = (((a0[3] > i4) > (38 ? 84 : v0)) + ((v1 + v2) || (90 ? a1[2][0] : a1[3][7])));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((58 - v1) <= (a1[2][8] ? v3 : 6)) || ((a0[12] ? v0 : v1) < (v3 * a0[9])));
+}
+int f2() {
+    int v0 = 25;
+    int v1 = 33;
+    int v2 = 55;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    if ((((77 >= v0) % 7) > ((v2 - v2) * (v0 * v2)))) {
+        v3 = (((96 || a0[9]) != (v0 / 5)) == ((v2 / 6) ? (a1[3][15] - a0[6]) : (92 - 38)));
+        v1 = (((75 != v2) != (0 % 8)) ? ((60 * 2) - (a0[8] != v0)) : ((92 ? a0[9] : a1[1][14]) == (75 % 4)));
+        a0[5] = (((v1 / 7) - (a1[3][15] || v3)) ? ((v1 ? a0[4] : v1) * (v2 % 2)) : ((v3 ? v1 : v0) && (26 * v3)));
+    } else {
+        a1[3][15] = (((v1 / 3) + (v2 ? v2 : v0)) <= ((v0 != 72) || (18 || v0)));
+        a0[0] = (((v1 != a0[9]) ? (v0 || v1) : (v0 ? a0[10] : 84)) % 2);
+        a1[2][6] = (((18 * a1[1][12]) >= (v0 ? v0 : v1)) == ((v1 * v3) - (35 != 34)));
+    }
+    if ((((11 || 41) || (a0[2] && v0)) + ((a0[11] >= v1) >= (64 || a0[15])))) {
+        v3 = (((a1[3][0] || a1[3][10]) ? (a0[11] > v0) : (a1[3][14] / 5)) <= ((a0[12] <= v0) + (v0 / 5)));
+        a0[1] = (((a1[3][5] >= v3) / 8) <= ((20 && v2) / 9));
+        a1[0][6] = (((a0[5] ? 44 : a1[0][7]) ? (a0[3] <= a0[10]) : (12 <= 96)) % 1);
+    } else {
+        a1[2][15] = (((v0 || a1[2][7]) / 4) + ((a0[11] - a1[0][1]) * (6 != 88)));
+        v0 = (((a0[1] != 51) || (a0[13] == v2)) * ((v0 / 7) <= (10 || 97)));
+        v0 = (((77 && v2) == (35 != a0[1])) + ((69 * v2) ? (v0 ? v1 : 81) : (17 ? v0 : v1)));
+    }
+    a1[3][15] = (((v3 < a0[14]) / 7) * ((v1 && 72) != (v2 == a1[2][12])));
+    v3 = (((a1[3][9] / 7) % 2) != ((v2 % 8) + (a1[1][11] > a1[3][15])));
+    a1[0][5] = (((a0[1] == v2) && (36 || 33)) < ((98 <= v2) ? (2 == v3) : (v2 <= 3)));
+    return (((v2 <= v2) ? (v2 != a1[0][0]) : (98 - v1)) % 9);
+}
+int main() {
+    return 0;
+}
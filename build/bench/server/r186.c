@@ -0,0 +1,54 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 70;
+    int v2 = 78;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 < 9) && (a1[1][10] * 53)) ? ((v1 / 4) > (v0 || v3)) : ((a0[9] % 4) != (v3 != a0[4])))) {
+        v0 = (((v2 || v3) > (v2 && v3)) < ((v2 % 9) % 4));
+        v2 = (((a1[2][14] ? 74 : v3) >= (30 * 35)) % 5);
+        v0 = (((v1 ? v3 : v2) / 7) - ((a0[15] * v2) / 1));
+    } else {
+        v1 = (((v1 % 8) == (a1[3][12] + a1[1][12])) % 5);
+        v0 = (((a1[3][15] ? a0[12] : a1[3][1]) + (v3 - v3)) < ((43 >= v0) <= (v3 * v0)));
+        v0 = (((76 / 7) + (v3 ? v2 : v2)) ? ((a0[6] != a0[0]) == (a0[15] >= v1)) : ((34 ? 25 : v1) == (a0[8] < a0[13])));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a0[14] = (((v2 ? a1[0][10] : a1[3][0]) == (v0 != 92)) * ((v2 == v0) <= (i0 <= 10)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                if ((32 == a0[9]) > 92) break;
+                v2 = (((2 >= v3) % 3) / 9);
+                a1[1][2] = (((61 ? a0[1] : i0) ? (i1 * v0) : (i1 >= v0)) / 2);
+                a1[1][9] = (((v0 / 7) && (a0[2] ? v3 : a1[2][11])) && ((v0 < i1) - (a0[13] == i0)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[9] = (((i0 * a1[2][8]) ? (a0[14] + 36) : (a0[12] * i0)) < ((a1[3][5] % 6) > (65 == 41)));
+    }
+    if ((((v0 / 1) < (a0[13] <= v3)) % 6)) {
+        v2 = (((v1 > 97) * (a0[6] ? 46 : v1)) && ((a0[4] / 1) % 9));
+        v0 = (((99 ? v1 : a1[1][0]) < (v3 - 87)) % 3);
+        v3 = (((a1[1][7] >= a0[6]) % 9) || ((a0[12] ? v2 : 66) < (v3 + v3)));
+    } else {
+        a0[3] = (((a0[12] < v3) * (89 + v3)) <= ((a1[0][5] - a0[9]) > (88 > a1[2][11])));
+        v1 = (((a0[15] < 44) % 9) + ((80 / 4) > (75 * v2)));
+        v0 = (((v0 % 6) / 2) && ((7 == v2) && (5 != a0[7])));
+    }
+    if ((((v0 == 35) * (v1 && v3)) < ((v2 == 12) % 7))) {
+        v3 = (((60 == a0[4]) * (v1 != 48)) - ((v0 + a0[6]) <= (v1 ? 65 : v0)));
+        a1[0][0] = (((91 % 1) != (a0[11] <= v2)) && ((99 - a0[14]) ? (v3 >= v0) : (v0 ? v2 : 45)));
+        v3 = (((a0[11] != a1[0][2]) < (v2 - 93)) - ((v3 * v3) >= (a0[1] / 4)));
+    } else {
+        v3 = (((v1 < v3) < (a0[11] * 46)) >= ((a1[0][2] || v3) >= (a0[13] <= a1[2][15])));
+        v0 = (((26 - 21) / 5) - ((11 ? 33 : v3) + (98 > v2)));
+        v0 = (((a1[1][10] != v2) % 8) ? ((v3 - 79) ? (v2 * a1[1][9]) : (v3 > v2)) : ((v2 >= 82) == (v1 > v2)));
+    }
+    a0[1] = (((a0[11] * a0[4]) && (34 || v3)) / 8);
+    return (((v0 || v0) == (v2 ? a1[3][7] : a0[13])) || ((v3 || v2) || (v2 <= a0[12])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,130 @@
+int f0() {
+    int v0 = 22;
+    int v1 = 22;
+    int v2 = 9;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    if ((((8 ? v3 : 96) == (v2 == a0[14])) <= ((v3 - v1) == (v1 && v1)))) {
+        a1[1][10] = (((v2 < 55) ? (v3 / 2) : (v3 || 44)) ? ((v0 ? a1[3][9] : v1) / 2) : ((99 < v3) && (v3 > v1)));
+        v3 = (((a0[14] + a0[8]) == (31 - 49)) - ((v1 % 9) >= (33 / 3)));
+        v0 = (((a1[2][1] - 6) - (47 % 1)) ? ((v3 % 7) >= (v2 && v2)) : ((a1[3][8] || v1) + (v0 && a1[0][9])));
+    } else {
+        a1[2][6] = (((v1 - a1[0][0]) / 3) ? ((v0 / 1) != (v3 - a0[10])) : ((v0 == v2) + (v1 - v0)));
+        a1[2][6] = (((a0[11] && a1[2][12]) != (a0[8] % 2)) != ((v3 > v2) == (a0[5] - a0[0])));
+        a1[1][8] = (((v0 || 53) && (v2 <= 6)) ? ((41 * v3) != (a1[0][9] / 6)) : ((v0 < v3) || (a0[13] % 4)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((i0 - a0[3]) > 78) break;
+            v2 = (((i0 + a0[6]) >= (40 != a0[0])) % 6);
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((v0 ? v2 : 56) < (v1 / 3)) == ((a0[14] >= v3) ? (a1[3][6] || 28) : (v1 && a0[9])));
+                a1[3][3] = (((a1[2][0] > 78) == (33 && a1[1][4])) || ((a1[1][4] * i1) == (v3 <= v1)));
+                a0[10] = (((a1[3][0] ? v1 : v0) * (v1 + 51)) - ((v3 % 2) || (v3 == v0)));
+            }
+            v0 = (((v0 % 1) + (a1[1][9] ? 93 : v1)) <= ((a0[8] - v0) == (v1 >= v1)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v3 == v1) > 69) break;
+            v0 = (((v0 + v1) >= (v3 * a0[8])) == ((97 % 7) || (v0 == a0[7])));
+            v3 = (((37 ? i2 : v1) / 1) < ((v3 <= v1) % 2));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v1 = (((i2 * 65) <= (i3 != i2)) + ((v1 ? v1 : 7) > (46 != v2)));
+                    v2 = (((a0[10] <= i2) == (v1 + v3)) / 5);
+                    v2 = (((a0[8] * 10) % 1) > ((i2 - 3) + (i3 == v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((79 <= a0[8]) - (v1 > 70)) && ((27 ? 16 : a0[1]) ? (1 * v2) : (v3 / 4)))) {
+        v2 = (((v3 + 53) >= (a0[10] ? 77 : a0[3])) ? ((85 ? a0[6] : v2) <= (v1 < a0[7])) : ((a0[3] >= v0) && (v3 && v1)));
+        v1 = (((v2 == 59) % 8) / 7);
+        v2 = (((v1 ? 59 : a0[0]) + (v2 < v0)) >= ((76 && 31) * (v2 + 66)));
+    } else {
+        a0[14] = (((v1 / 9) % 2) <= ((8 && v1) > (v0 || 71)));
+        a1[1][4] = (((v0 <= 55) || (v2 <= v0)) - ((50 - v2) != (a1[2][7] ? v2 : a1[2][6])));
+        a0[1] = (((v3 < a0[0]) && (v1 != v2)) < ((15 % 8) != (v3 / 6)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v0 = (((86 != v2) / 3) == ((a0[2] > v2) * (75 || v2)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v3 = (((a1[1][3] + a0[6]) && (i5 / 4)) - ((a0[0] <= v3) >= (v0 + v2)));
+                v3 = (((79 != v2) * (20 || v0)) >= ((i4 - a0[1]) ? (v2 ? a1[2][5] : 73) : (i5 - 64)));
+                a0[9] = (((2 + v2) < (v1 && a0[0])) + ((i5 > 74) ? (v3 <= v2) : (a1[2][13] == v3)));
+                i5 = i5 + 1;
+            }
+        }
+        a1[3][6] = (((66 <= a0[0]) + (32 ? 2 : v1)) ? ((a0[11] - 59) == (a0[6] >= v3)) : ((v2 && 8) / 4));
+    }
+    return (((v2 / 6) == (18 == 99)) - ((v1 ? a1[1][2] : v1) == (v2 != 96)));
+}
+int f1() {
+    int v0 = 57;
+    int v1 = 8;
+    int v2 = 32;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((a1[0][2] && i0) > 85) break;
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                a0[4] = (((a0[9] < a1[1][13]) + (18 + a0[9])) ? ((i1 > a0[3]) - (i0 || v2)) : ((44 == a0[1]) > (72 + 33)));
+                v0 = (((v3 < v1) + (13 % 5)) <= ((58 - a1[3][10]) == (35 - 40)));
+                v1 = (((v0 ? v0 : 80) > (v0 * i0)) || ((95 / 8) / 1));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((a1[0][11] - a1[3][0]) % 5) ? ((v3 >= v3) == (a0[4] >= 94)) : ((31 <= v2) <= (v2 ? v0 : v3)));
+        v2 = (((v1 < a1[0][7]) ? (v2 + v2) : (v2 / 2)) ? ((v0 ? 70 : v0) || (a0[8] > v0)) : ((i0 == v3) - (v1 ? a1[3][3] : v1)));
+    }
+    a0[5] = (((v1 > a0[11]) ? (12 || a0[11]) : (65 % 5)) || ((v2 <= v2) * (v3 && v2)));
+    {
+        int i2 = 0;
+        do {
+            v1 = (((95 ? a1[0][7] : i2) == (22 > v0)) * ((v3 / 8) % 2));
+            a0[10] = (((v3 >= v1) != (v0 / 6)) || ((0 < 82) != (v1 * a0[0])));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v3 = (((49 % 6) && (i3 <= a1[3][5])) != ((i3 ? a1[0][1] : a1[0][2]) + (94 % 1)));
+                    v1 = (((v0 ? 76 : v1) >= (v2 * v3)) - ((v3 || a0[15]) ? (v1 != v1) : (12 && 1)));
+                    v0 = (((v0 >= v1) ? (v1 / 5) : (a1[0][13] ? 53 : a1[0][5])) ? ((a0[5] - v1) <= (91 > v3)) : ((30 <= a0[5]) + (40 * a1[0][14])));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v1 = (((28 - v0) != (a0[15] % 7)) - ((v2 / 1) ? (v0 % 2) : (27 && v1)));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            a1[2][4] = (((63 || v2) * (a0[0] != v2)) || ((96 ? v3 : a1[2][9]) > (v3 + 0)));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                a1[0][8] = (((39 == a1[0][6]) < (66 < 32)) || ((a1[1][12] <= v2) || (a1[2][13] / 4)));
+                v3 = (((40 + v0) * (47 > 83)) && ((94 > 83) * (52 * v1)));
+                a1[2][0] = (((5 || v2) < (i5 % 9)) % 1);
+            }
+            v1 = (((v3 ? v1 : a1[3][13]) < (a1[3][3] % 5)) == ((v0 * 43) < (a0[9] <= a1[2][1])));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v2 != v0) > (v0 ? a0[11] : a0[6])) != ((v3 < v2) >= (v0 / 1)));
+}
+int main() {
+    return 0;
+}
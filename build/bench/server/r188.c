@@ -0,0 +1,184 @@
+int f0() {
+    int v0 = 67;
+    int v1 = 4;
+    int v2 = 85;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    a1[1][4] = (((v1 % 4) <= (v3 == 36)) < ((v1 <= v2) >= (83 && v0)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v1 = (((i0 && v3) && (a1[3][15] + 13)) - ((a0[6] >= v0) - (i0 > i0)));
+        v0 = (((v0 > v0) && (v0 ? v3 : 95)) != ((a1[1][15] != 5) >= (87 != v1)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                if ((i1 % 1) > 69) break;
+                v1 = (((v2 ? a0[8] : 41) ? (v2 != v1) : (v3 || v0)) == ((v0 <= v2) + (99 + v1)));
+                v0 = (((a0[1] + v0) ? (a1[3][9] > 32) : (v1 <= 8)) - ((i1 != i0) != (v1 % 9)));
+                v2 = (((v0 != a1[0][0]) && (i0 + v1)) && ((v3 != a1[0][8]) ? (v1 ? v2 : a0[0]) : (v1 + i0)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    if ((((24 ? v0 : v2) != (v0 > a1[2][15])) ? ((v1 - v3) - (65 <= v2)) : ((1 || a0[9]) % 2))) {
+        v0 = (((v0 == v0) || (9 + 21)) > ((v3 < a1[2][9]) - (48 || v0)));
+        v0 = (((v3 <= 42) < (47 >= v0)) == ((76 == v3) ? (77 + v0) : (33 && a1[1][15])));
+        a0[15] = (((v2 ? v1 : a0[6]) >= (45 >= 62)) ? ((29 / 3) != (29 > v1)) : ((53 - v1) && (v1 / 6)));
+    } else {
+        v2 = (((a0[11] || 22) ? (a1[3][14] > v0) : (42 == 85)) < ((v0 != v2) >= (v0 > v1)));
+        v1 = (((a1[2][5] && 57) >= (a0[7] >= v2)) * ((a1[0][12] - v1) && (48 == a0[8])));
+        a0[15] = (((a1[2][5] <= 33) - (a1[2][10] % 2)) % 3);
+    }
+    if ((((v0 && v0) < (v3 + a1[3][13])) || ((93 ? v1 : a0[11]) <= (49 < v3)))) {
+        v1 = (((12 != 25) <= (6 ? v1 : 54)) ? ((v3 + v1) && (a1[2][15] >= 7)) : ((v0 + a1[2][0]) * (a0[4] == 17)));
+        a0[2] = (((v3 % 5) / 4) > ((v3 > v0) > (v1 ? a0[4] : v1)));
+        a0[0] = (((v2 / 1) != (v1 * 61)) < ((v2 / 3) ? (a0[12] + v3) : (17 < a0[6])));
+    } else {
+        v0 = (((v2 || 29) > (a1[1][2] ? a0[9] : v3)) && ((12 && 19) >= (a1[2][13] != v2)));
+        a0[9] = (((v2 / 4) + (a1[1][1] / 6)) != ((89 * v0) < (v0 != v2)));
+        a1[2][9] = (((41 + v2) != (a1[1][9] / 5)) - ((a1[0][9] == a1[3][1]) > (71 >= a0[2])));
+    }
+    v2 = (((v1 != 75) ? (a1[3][14] || v1) : (a1[3][6] + a1[0][9])) / 4);
+    return (((44 || v1) != (v3 != 97)) || ((a1[2][7] / 1) - (v3 * a1[0][0])));
+}
+int f1() {
+    int v0 = 58;
+    int v1 = 92;
+    int v2 = 50;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    if ((((41 > v2) + (v1 + 40)) != ((a0[14] % 1) >= (v2 < v2)))) {
+        v3 = (((v2 && 0) ? (v3 + a0[11]) : (92 >= v2)) + ((v0 + 24) <= (58 <= v1)));
+        v2 = (((v2 / 3) % 2) == ((v2 == 61) > (v3 || v1)));
+        v0 = (((19 ? a1[3][14] : 20) || (a0[2] < v3)) || ((a0[14] ? a0[2] : v2) == (v1 > 42)));
+    } else {
+        v0 = (((a1[3][12] || 73) <= (79 > a1[3][10])) ? ((v1 > 95) || (a1[0][9] - v0)) : ((v0 && v3) / 3));
+        v3 = (((a0[9] == v1) - (v0 && v3)) == ((v0 && a1[2][7]) && (82 >= v2)));
+        a0[7] = (((a1[2][0] || v2) % 7) ? ((v2 != v2) * (a0[12] * v2)) : ((v2 > v3) > (v0 ? v0 : v3)));
+    }
+    if ((((13 % 5) + (v1 / 5)) > ((22 % 7) != (84 - v3)))) {
+        v1 = (((v2 || v2) > (v2 + v0)) ? ((v1 + v1) || (v1 ? v0 : 52)) : ((v2 || a0[8]) - (v2 && v0)));
+        v2 = (((v2 > v0) > (a1[0][0] * v2)) <= ((84 - 44) <= (v2 != v2)));
+        a0[11] = (((85 > a1[3][0]) ? (64 < v0) : (v0 > v3)) * ((v2 == 99) / 4));
+    } else {
+        v0 = (((v3 != v0) ? (v3 < v2) : (v3 % 3)) == ((87 && v3) % 1));
+        v2 = (((51 ? a0[14] : a1[2][3]) && (v1 >= a0[7])) ? ((a1[0][9] < 53) % 8) : ((a0[6] % 2) <= (v3 - v0)));
+        v1 = (((v3 % 7) % 6) <= ((a0[3] / 8) < (a1[2][2] - v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v1 ? a1[0][10] : i0) > 73) break;
+            v3 = (((v3 < a1[3][1]) <= (i0 && 88)) < ((v0 * a0[13]) % 1));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[6] = (((v1 <= v0) <= (v3 ? 25 : a1[2][6])) < ((a0[0] / 5) || (v2 % 1)));
+                v0 = (((i1 / 4) - (a1[1][13] % 1)) % 9);
+                a0[9] = (((v3 ? i0 : a1[2][5]) == (v0 - 1)) ? ((a0[6] && v0) || (i0 != 91)) : ((v1 + 65) == (a0[9] * a0[8])));
+            }
+            v3 = (((v0 ? 65 : v0) == (a0[15] % 8)) % 3);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((v3 + v2) > 56) break;
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            if ((v3 <= a0[4]) > 72) break;
+            a0[15] = (((a1[1][5] + 15) - (v3 || v1)) ? ((a1[0][15] < a0[13]) - (i3 % 6)) : ((v1 + a1[2][12]) + (i2 % 4)));
+            a1[3][1] = (((97 > v0) && (i2 <= 28)) && ((i3 <= a1[3][11]) && (a0[8] / 6)));
+            v0 = (((a0[11] <= a1[0][0]) == (33 / 3)) < ((11 >= v3) * (95 / 3)));
+        }
+        v2 = (((i2 / 5) < (v0 ? 79 : a0[10])) ? ((i2 <= v2) == (a1[0][12] * v0)) : ((a0[8] ? a1[3][9] : 7) + (39 - 80)));
+        a0[12] = (((56 ? 29 : a1[2][4]) == (a0[15] ? v0 : 75)) <= ((v1 < v3) < (71 ? i2 : a1[0][5])));
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a0[5] = (((4 - 68) == (68 != 78)) && ((56 <= v2) - (i4 ? v1 : v3)));
+        v2 = (((22 + v0) % 8) != ((98 / 8) / 5));
+        {
+            int i5 = 0;
+            while (i5 < 8) {
+                v1 = (((v3 < i5) - (93 - v0)) >= ((53 % 5) < (23 < i4)));
+                v0 = (((v2 != a1[3][3]) * (84 ? a0[13] : a1[1][8])) ? ((v2 > v3) <= (a0[5] + i5)) : ((a1[3][6] - v1) < (v2 ? v2 : a0[9])));
+                a1[0][15] = (((85 >= 22) < (v1 - a1[3][3])) < ((v3 >= a0[4]) ? (v3 > a1[1][12]) : (v2 >= v1)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    return (((v0 % 4) ? (44 ? v3 : v2) : (v1 ? 73 : v3)) ? ((v2 + 25) <= (a1[0][2] >= a1[2][3])) : ((v1 ? v1 : v1) || (22 != v1)));
+}
+int f2() {
+    int v0 = 32;
+    int v1 = 31;
+    int v2 = 11;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            {
+                int i1 = 0;
+                do {
+                    if ((v0 <= v2) > 72) break;
+                    v1 = (((a0[8] <= a0[7]) || (a1[3][12] + v2)) > ((40 ? v2 : v1) ? (v3 % 2) : (v3 == a0[11])));
+                    a0[3] = (((43 % 5) == (v1 <= i0)) < ((v1 < a1[2][8]) || (83 && v2)));
+                    v2 = (((v0 / 1) / 1) < ((a1[3][0] >= 79) || (a1[0][0] != a0[0])));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v0 = (((v1 / 6) && (v2 && a0[1])) <= ((v2 % 4) ? (86 != v3) : (a0[12] ? 14 : v3)));
+            v1 = (((a1[3][1] ? 21 : v2) == (48 == v0)) < ((25 < v3) > (65 * a1[1][3])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[1][4] ? 8 : a1[2][5]) > 55) break;
+                    a1[0][7] = (((32 ? 38 : a0[2]) % 1) <= ((a1[1][2] != 40) > (a0[15] <= 18)));
+                    v3 = (((v3 || 72) == (a1[2][2] % 7)) || ((i3 < a1[3][4]) || (45 || 53)));
+                    a0[2] = (((i2 && v2) + (a1[1][10] < a0[2])) > ((17 % 2) - (v0 <= v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v3 = (((v3 != a0[8]) + (a0[3] % 9)) + ((v3 + v1) ? (v2 && 26) : (58 / 4)));
+            a1[2][5] = (((a0[2] - 19) % 1) >= ((v0 || a1[0][13]) && (v2 - v2)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((a0[11] % 7) > 67) break;
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v2 = (((v2 + i5) - (53 || a1[2][6])) ? ((22 ? v1 : v2) ? (17 >= 17) : (v3 - i5)) : ((i4 < a0[9]) == (26 - v0)));
+                    v2 = (((v3 || 10) <= (v3 % 3)) + ((i5 ? a0[6] : i4) * (v0 ? v0 : 97)));
+                    a1[3][15] = (((a1[3][11] >= 26) - (i4 > i4)) <= ((v2 ? a1[2][4] : v3) < (39 != a1[0][4])));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[8] = (((73 != 73) ? (a0[14] == a0[12]) : (v0 >= 73)) * ((v3 <= 97) <= (90 / 9)));
+            v0 = (((a0[4] / 3) * (v1 + a0[10])) % 1);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[15] < 92) % 6) && ((v1 / 4) != (a1[0][12] && 98)))) {
+        a0[4] = (((89 % 1) && (a1[2][5] <= v3)) - ((a0[6] * 98) < (57 || v0)));
+        a1[2][3] = (((v0 <= 86) / 9) ? ((a1[2][6] * v1) ? (a1[2][15] != v2) : (84 ? v0 : v2)) : ((a0[1] - v0) >= (72 <= a0[13])));
+        a1[3][13] = (((v0 == a1[2][9]) || (0 + a1[0][13])) == ((v0 < v0) <= (v2 % 6)));
+    } else {
+        v0 = (((14 <= 24) - (73 * v3)) < ((v0 / 5) > (v3 - v1)));
+        v3 = (((v1 * v2) != (a1[3][13] < v0)) > ((v1 - v2) ? (v3 / 6) : (52 ? a0[1] : v3)));
+        a0[13] = (((v3 < v2) ? (91 >= v1) : (31 && a1[3][10])) - ((a0[5] < v3) <= (v2 >= v2)));
+    }
+    a0[9] = (((45 + 65) ? (a1[0][4] != 44) : (69 > v2)) * ((v2 / 7) / 9));
+    return (((34 ? a0[3] : 24) + (v3 ? v1 : 17)) / 3);
+}
+int main() {
+    return 0;
+}
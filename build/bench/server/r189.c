@@ -0,0 +1,46 @@
+int f0() {
+    int v0 = 98;
+    int v1 = 48;
+    int v2 = 87;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v2 = (((a1[1][4] % 9) % 4) && ((20 >= 93) <= (v2 || v1)));
+        a1[1][3] = (((99 ? v0 : a0[5]) != (20 + v0)) * ((v1 ? 15 : v0) ? (v3 / 7) : (v2 && v1)));
+        {
+            int i1 = 0;
+            do {
+                if ((24 <= i0) > 57) break;
+                v1 = (((v1 >= v1) - (87 >= 16)) != ((v0 / 6) - (a1[3][14] > 77)));
+                a1[1][1] = (((70 > a1[2][14]) >= (a1[3][11] < 42)) && ((a1[0][3] / 6) ? (v1 * 79) : (i1 <= 41)));
+                v3 = (((a1[0][6] + v0) <= (a1[0][2] > 50)) < ((v2 || 90) < (a1[3][13] >= 44)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+    }
+    a0[14] = (((93 && v0) > (95 + v1)) ? ((35 <= v0) - (5 > v1)) : ((v3 - 16) != (v0 != v2)));
+    a1[0][5] = (((v3 + v1) ? (v1 == a0[4]) : (v3 ? 63 : v0)) % 7);
+    a0[6] = (((v3 < v2) == (81 * v3)) - ((v0 / 2) != (79 > 58)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((i3 ? v3 : i3) ? (i3 ? 87 : 59) : (v1 > 93)) * ((i3 == 77) > (a1[2][4] + 25)));
+                    v1 = (((i2 * 95) * (v1 || a0[13])) != ((v2 % 4) - (12 && v2)));
+                    a0[13] = (((v1 - v0) <= (i2 && a1[3][0])) <= ((a0[3] > 94) <= (v2 == a1[2][3])));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v3 = (((v0 == 8) < (v0 && a1[2][7])) + ((57 != a1[3][10]) % 7));
+            v3 = (((v0 - a0[7]) <= (a0[2] >= a1[2][10])) || ((54 * v3) == (v3 != v3)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((77 || v0) == (36 && a0[3])) ? ((v1 / 4) * (a1[2][15] && 65)) : ((v1 * a1[1][6]) <= (12 ? 42 : v0)));
+}
+int main() {
+    return 0;
+}
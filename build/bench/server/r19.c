@@ -0,0 +1,140 @@
+int f0() {
+    int v0 = 31;
+    int v1 = 50;
+    int v2 = 87;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((i0 - v0) > 87) break;
+            v1 = (((25 && v0) != (a1[1][15] == v2)) > ((a1[2][11] <= a1[1][14]) * (i0 ? v2 : v2)));
+            v2 = (((i0 && v3) ? (v3 / 8) : (30 - i0)) % 6);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((v2 * v0) > (i0 > v0)) >= ((i1 == i0) > (v1 == 4)));
+                    v2 = (((84 ? i1 : a1[1][10]) > (20 < v0)) < ((i0 != a1[2][9]) * (32 == v1)));
+                    v2 = (((v3 - a0[9]) && (a1[0][9] + a1[1][2])) >= ((a0[8] >= 52) >= (62 != a0[11])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 * a0[1]) > 97) break;
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                a0[4] = (((5 >= v3) / 3) / 4);
+                v3 = (((19 && a1[3][15]) / 2) + ((i3 / 4) > (v3 == a1[3][7])));
+                a0[9] = (((80 && v2) * (v0 || i3)) && ((v0 > v2) != (v2 / 2)));
+            }
+            v2 = (((a0[11] / 8) && (v0 >= a0[9])) && ((95 <= v3) && (v3 == v1)));
+            a0[6] = (((v0 > v3) % 4) - ((a1[0][5] <= v2) ? (a0[15] == v0) : (v0 || i2)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    v1 = (((v1 >= v1) || (v0 > 17)) / 4);
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v1 = (((63 > i4) - (v1 > 9)) + ((50 != a1[3][0]) < (92 / 9)));
+                a1[1][13] = (((i4 >= a1[1][2]) / 2) / 6);
+                v3 = (((a0[10] >= 85) % 9) - ((a0[14] / 4) == (48 + 76)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        a0[8] = (((v3 % 5) - (v0 && a1[1][8])) >= ((v0 == v2) != (49 != a1[1][5])));
+        v0 = (((59 ? a1[2][14] : i4) && (v1 >= 57)) ? ((17 ? a0[12] : a0[5]) || (i4 ? v3 : v3)) : ((23 < 90) >= (a0[8] > 31)));
+    }
+    if ((((v2 <= v2) ? (74 ? a0[4] : v1) : (v0 && 31)) * ((a0[4] >= v2) >= (98 - 4)))) {
+        a1[3][6] = (((v3 <= 98) < (76 && a1[3][10])) ? ((a0[14] * 93) * (v0 <= a0[3])) : ((v1 ? v3 : v1) < (v0 > 57)));
+        v3 = (((v1 ? v1 : v0) ? (v1 ? 42 : 58) : (v2 < v2)) > ((34 < 14) && (v0 >= a0[7])));
+        v3 = (((97 * a0[3]) || (v0 >= a1[3][1])) / 8);
+    } else {
+        v3 = (((a1[1][3] <= a1[3][5]) == (v3 / 3)) >= ((v2 == 91) != (v1 * a0[11])));
+        v2 = (((95 && a0[1]) != (a0[9] / 6)) - ((50 != 68) - (v3 < a0[3])));
+        v2 = (((a0[10] <= a0[11]) < (v2 != v1)) > ((35 <= v3) >= (8 <= 61)));
+    }
+    return (((a1[0][3] % 6) < (v1 - v3)) > ((3 <= a0[8]) ? (6 >= a0[12]) : (v0 - v2)));
+}
+int f1() {
+    int v0 = 74;
+    int v1 = 35;
+    int v2 = 67;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v1 = (((v0 > v1) != (v2 >= v0)) < ((a0[4] > 7) < (a1[0][1] > a1[3][9])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((a0[7] <= v1) && (v1 <= 13)) * ((2 > a1[1][1]) || (52 > v2)));
+                a1[0][15] = (((a0[6] == i0) % 2) > ((a1[2][15] / 8) || (9 || 67)));
+                v2 = (((v2 + a0[5]) * (i0 % 6)) % 7);
+            }
+            v2 = (((i0 >= 58) * (i0 > v3)) == ((i0 < a1[1][15]) > (0 && 11)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v0 == a0[0]) >= (a1[3][10] >= v0)) < ((51 == a0[0]) == (a1[1][10] ? v0 : 86)));
+            v3 = (((i2 / 2) + (a1[3][11] || 15)) == ((a1[2][15] ? a0[2] : i2) == (v0 / 6)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((27 == a0[9]) % 1) >= ((a0[5] > a1[3][3]) / 9));
+                v1 = (((v3 <= v0) * (10 + i3)) * ((v0 ? v3 : i3) != (a0[14] ? v3 : a1[2][8])));
+                v3 = (((a0[3] && i2) >= (20 ? v0 : 12)) - ((i2 ? 5 : v3) >= (18 > a0[8])));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v2 = (((88 % 1) + (v1 < v0)) > ((v2 != v2) || (a0[0] < v3)));
+                v2 = (((a0[6] / 3) != (37 > 82)) || ((i4 - a0[9]) < (i5 ? v3 : i4)));
+                v0 = (((98 == i5) != (a0[10] * a0[5])) || ((a1[1][6] >= v3) < (i5 + v1)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        v0 = (((31 - i4) <= (v3 && v2)) || ((a0[15] == v0) <= (v1 - 48)));
+        v0 = (((61 > 35) ? (78 > v0) : (44 <= 97)) - ((v3 - v0) + (v0 ? a0[6] : v0)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v0 = (((v0 % 2) - (i6 <= v1)) * ((i6 % 7) - (a0[6] || v1)));
+            a1[3][15] = (((v1 < v2) - (60 == a1[2][9])) != ((v3 != a0[15]) + (72 * 11)));
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                a0[5] = (((i6 / 7) + (a0[2] ? v2 : i7)) * ((i6 / 6) % 7));
+                v0 = (((60 > i7) < (i6 ? i6 : a1[3][1])) != ((v2 <= i6) + (a0[15] ? i6 : v1)));
+                a0[2] = (((a0[3] % 3) ? (v2 || v2) : (i7 - 62)) <= ((v2 != 55) <= (a1[0][13] * a0[5])));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v2 + 88) / 1) % 6)) {
+        v3 = (((v0 - 75) % 8) ? ((v2 ? a1[2][0] : a1[2][15]) == (a0[12] <= v0)) : ((v2 >= a1[2][2]) && (a1[0][7] >= 67)));
+        v3 = (((a1[3][10] >= v3) ? (v2 == v0) : (v0 != v3)) / 4);
+        v1 = (((v3 <= 71) - (33 || 60)) != ((v3 - v0) + (a0[10] ? v1 : v0)));
+    } else {
+        v1 = (((61 || 57) <= (v0 - v1)) < ((a0[3] + v0) == (a0[6] - 40)));
+        v0 = (((v3 > v1) != (9 / 8)) >= ((v0 != a0[6]) < (55 / 5)));
+        v3 = (((38 ? a1[1][3] : v1) > (v0 == v1)) % 6);
+    }
+    return (((a0[7] ? 20 : a0[9]) != (v3 > v1)) || ((v1 && a0[11]) ? (v1 % 2) : (a0[8] != v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
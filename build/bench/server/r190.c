@@ -0,0 +1,134 @@
+int f0() {
+    int v0 = 45;
+    int v1 = 19;
+    int v2 = 92;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((12 < 42) > 84) break;
+            v3 = (((v3 < 22) >= (v3 - 65)) <= ((v2 >= 78) * (90 >= a0[9])));
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[4] > 17) > 62) break;
+                    a0[6] = (((v1 + 13) > (v2 == v2)) / 6);
+                    v2 = (((a0[3] + v2) * (a1[3][8] >= i1)) > ((v2 - a1[0][0]) != (a0[13] % 3)));
+                    a0[2] = (((v0 < a0[12]) ? (19 * i1) : (i1 ? v3 : v2)) / 2);
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v1 = (((a1[2][15] / 8) / 2) * ((i0 && i0) != (38 ? 61 : 12)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v0 = (((v1 <= v3) || (62 != v2)) ? ((v0 >= v1) % 8) : ((v2 > 48) + (22 ? v2 : 20)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v2 = (((15 - i2) || (i2 || i2)) * ((v2 - v3) ? (2 - a1[0][5]) : (a0[13] != a1[1][4])));
+            v1 = (((50 * v1) < (a0[1] >= 97)) && ((40 * v3) > (68 / 6)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                a1[2][2] = (((a0[4] > a1[3][6]) != (a1[1][3] > a1[2][14])) / 2);
+                v3 = (((31 > v0) || (i3 < 42)) <= ((a1[0][12] <= v2) ? (88 >= 31) : (73 > v3)));
+                v1 = (((i2 && 86) ? (v3 || v3) : (i3 ? v2 : v0)) + ((v1 ? v2 : i3) * (a0[5] > 67)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            a0[3] = (((i4 % 7) - (49 <= v0)) > ((54 < 71) % 4));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    a1[0][9] = (((v0 * a0[15]) || (i5 == a0[8])) > ((i4 + v0) / 2));
+                    v3 = (((39 || 89) == (v0 != a0[4])) - ((i4 > a0[5]) % 9));
+                    v0 = (((v2 <= i5) ? (3 && v0) : (74 == a1[2][9])) + ((v2 && v3) * (a1[3][4] - 81)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[4] = (((16 / 8) != (v2 ? a0[8] : v3)) || ((i4 % 9) < (v2 % 8)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[1][1] = (((v0 < v3) % 6) != ((13 ? v3 : a0[12]) - (a1[3][14] * 17)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v2 = (((a0[13] / 6) / 3) ? ((a1[2][11] - v0) >= (i7 <= 18)) : ((v0 > v1) == (v0 + v2)));
+                    v0 = (((v1 == 90) - (a0[6] ? a1[3][15] : v3)) > ((72 == a1[0][0]) * (4 <= v0)));
+                    a1[1][12] = (((55 >= v3) - (v1 + v3)) != ((v3 ? 6 : a1[0][7]) - (11 <= v3)));
+                    i7 = i7 + 1;
+                }
+            }
+            a1[3][0] = (((v0 ? 5 : v1) + (a0[15] != a1[3][13])) % 9);
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    return (((v2 ? a1[3][10] : 91) && (23 != a0[3])) <= ((a1[0][7] != a0[9]) > (a1[1][7] < 29)));
+}
+int f1() {
+    int v0 = 57;
+    int v1 = 80;
+    int v2 = 9;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a1[2][10] && v3) * (v1 && a1[1][11])) && ((v1 == v0) ? (v2 <= a0[9]) : (v1 / 7)));
+    if ((((v3 < v3) + (v3 + a1[2][2])) != ((v0 <= 54) != (v1 || v1)))) {
+        v3 = (((a0[15] || v0) ? (a1[2][1] >= 92) : (v0 < 50)) < ((3 - v1) >= (v2 <= a1[2][9])));
+        v3 = (((31 <= v3) ? (a0[8] > 46) : (61 < a0[10])) / 3);
+        a1[0][8] = (((v0 || a0[5]) && (92 ? v2 : a0[8])) >= ((68 <= v0) < (v1 >= a1[2][15])));
+    } else {
+        a1[0][5] = (((v2 == v3) - (4 + v0)) - ((v3 > v1) + (44 % 3)));
+        v1 = (((v0 != 91) < (v1 >= 82)) < ((v0 && v0) * (33 + v2)));
+        a0[4] = (((9 + a1[2][0]) ? (23 < 13) : (4 != a1[1][2])) > ((v3 != v3) - (a0[13] + v1)));
+    }
+    if ((((a1[3][12] && a0[11]) - (65 + 34)) ? ((v0 >= 29) != (v1 / 9)) : ((v3 && v3) < (90 == a0[14])))) {
+        v2 = (((v2 != a0[12]) + (v3 / 7)) >= ((v0 == v0) ? (60 % 7) : (a1[3][8] ? a0[15] : a1[3][1])));
+        a0[13] = (((13 != v2) > (67 < v2)) / 8);
+        v3 = (((a1[3][12] != a1[2][8]) ? (a0[6] / 1) : (v1 || a0[2])) > ((a1[0][3] < v1) < (a0[4] ? 93 : v1)));
+    } else {
+        v2 = (((v2 == a0[0]) ? (v2 || v2) : (v2 / 9)) || ((87 < v3) / 8));
+        v1 = (((v0 * 66) ? (17 + v1) : (80 <= v3)) % 8);
+        a1[3][2] = (((v0 % 4) + (a1[1][1] >= v2)) == ((v0 / 7) ? (92 * 66) : (a0[13] != v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((a1[2][3] ? a0[3] : a0[1]) > 60) break;
+            a1[3][3] = (((a0[2] && v0) ? (a0[8] >= a1[1][12]) : (a1[3][9] / 2)) ? ((v0 || v2) * (2 / 4)) : ((v3 && v2) <= (21 == 7)));
+            v0 = (((a0[13] || a1[2][4]) >= (v0 >= 35)) ? ((a0[3] < a1[1][4]) ? (13 == v2) : (a0[0] != v3)) : ((a1[1][10] && 75) ? (v3 >= v3) : (i0 % 5)));
+            {
+                int i1 = 0;
+                do {
+                    a0[6] = (((24 < i1) <= (i0 ? a1[2][10] : 61)) ? ((v3 ? i0 : a0[7]) * (a1[2][6] ? 15 : v0)) : ((i0 != 3) / 1));
+                    v2 = (((i1 < i0) / 1) >= ((i0 - 2) - (12 || 75)));
+                    v0 = (((v1 > v1) + (v3 && i1)) - ((i1 * a1[1][14]) < (v3 >= i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((a1[2][7] && 52) != (v1 <= v1)) * ((v1 != v3) != (83 % 1)))) {
+        a0[6] = (((v3 >= v0) == (30 <= v0)) + ((v2 % 7) < (a1[2][3] ? v2 : 55)));
+        v3 = (((v3 ? a0[12] : a1[0][11]) >= (77 && v2)) > ((v2 == v1) ? (v0 > a1[1][8]) : (79 / 7)));
+        v3 = (((a0[7] != v0) == (v2 <= 89)) && ((v3 / 4) >= (v3 || 95)));
+    } else {
+        a0[13] = (((v2 + v3) ? (a0[0] && 82) : (v0 >= v1)) * ((v0 != 18) % 8));
+        v3 = (((16 + v0) <= (a0[7] == 18)) <= ((v0 + v2) || (a0[11] == v0)));
+        a0[3] = (((v2 <= v2) && (a0[15] - v2)) > ((a1[0][11] || a1[2][11]) != (97 >= 57)));
+    }
+    return (((v2 == 62) >= (a0[15] + a0[4])) ? ((a0[8] <= a1[2][15]) ? (v0 + a0[4]) : (v2 ? v3 : a1[3][1])) : ((a0[2] == a1[2][10]) % 2));
+}
+int main() {
+    return 0;
+}
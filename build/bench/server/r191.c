@@ -0,0 +1,211 @@
+int f0() {
+    int v0 = 78;
+    int v1 = 95;
+    int v2 = 69;
+    int v3 = 66;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((66 ? 84 : v1) + (a0[2] <= v3)) + ((a0[5] || 11) ? (v3 || v2) : (a1[2][6] == v1)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((v0 && v3) > 74) break;
+                    a0[1] = (((i1 / 8) - (v3 % 6)) || ((i1 - 8) > (36 >= 55)));
+                    a1[1][6] = (((a0[1] || i0) ? (a0[1] % 4) : (93 + v0)) - ((13 > a0[12]) && (v2 || v0)));
+                    a0[10] = (((i1 % 4) * (i1 - a1[1][10])) / 6);
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((15 >= a1[3][9]) ? (v1 || v2) : (40 ? v3 : i0)) > ((v0 >= v0) % 4));
+            a0[10] = (((v1 >= i0) + (v2 < 88)) / 6);
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((22 * 95) - (v3 && v2)) + ((v1 / 6) > (v2 - v2)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v0 = (((50 == v0) && (27 * i2)) + ((i2 ? i2 : 60) / 3));
+                v2 = (((12 == a0[11]) != (92 <= a1[2][10])) || ((v1 > v2) < (44 < i2)));
+                a0[5] = (((a1[3][6] && v0) ? (a1[1][3] ? 35 : i2) : (v1 >= a0[14])) - ((34 != i3) + (a1[2][15] * 52)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((88 - v0) ? (85 ? 93 : v1) : (a0[2] <= 76)) % 2);
+        a0[8] = (((a1[3][9] / 2) == (i2 > a0[6])) - ((v3 * v2) && (21 || a0[15])));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v3 ? i4 : a0[9]) > 60) break;
+            a1[0][1] = (((a1[0][0] ? a1[3][4] : a0[9]) % 2) == ((66 + a1[3][1]) < (v2 * 73)));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v1 = (((i5 < 66) >= (v0 % 7)) * ((96 <= a1[0][1]) - (a1[3][11] + v1)));
+                    v0 = (((a0[13] || 61) ? (80 >= v0) : (a1[3][12] % 9)) != ((i5 == 15) <= (i5 - i4)));
+                    a0[13] = (((i4 ? 89 : v1) % 3) ? ((v0 && v3) > (v0 - i5)) : ((v2 * i4) - (v0 * v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((21 % 6) < (v0 ? v3 : 53)) < ((a1[2][15] * v0) || (i4 ? 44 : 85)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((99 == 46) == (v3 && 83)) - ((a1[0][9] ? 55 : v3) || (68 + v3)));
+}
+int f1() {
+    int v0 = 27;
+    int v1 = 58;
+    int v2 = 19;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v3 + a1[2][1]) > 67) break;
+            a0[7] = (((58 && v2) > (14 && v2)) * ((v2 >= a1[3][4]) > (v3 / 8)));
+            v1 = (((55 != v0) >= (v3 ? v3 : a0[15])) ? ((73 ? a0[4] : v1) + (v2 / 9)) : ((v3 ? 2 : a1[3][6]) == (a1[2][14] + i0)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v0 = (((a1[2][0] - v2) <= (93 >= v0)) >= ((a0[10] ? i1 : 3) >= (54 ? 54 : v3)));
+                a0[3] = (((v1 == v1) % 4) && ((v0 > 20) || (i0 + 23)));
+                a1[2][4] = (((i1 >= a0[6]) || (a1[0][11] <= i0)) >= ((65 == a1[3][8]) % 3));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v0 * a1[2][3]) ? (a1[0][10] != a0[11]) : (v2 / 4)) != ((20 > v2) && (v0 == v3)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    if ((a0[2] + v0) > 52) break;
+                    v0 = (((19 > v2) * (97 > a0[3])) <= ((i2 ? 43 : a1[2][14]) ? (a0[10] && i3) : (a0[14] || 4)));
+                    a1[2][6] = (((a0[4] + i3) ? (v3 < i2) : (v2 % 2)) == ((a1[3][2] > v0) >= (24 + v0)));
+                    v3 = (((v0 % 9) > (a0[14] + v2)) / 7);
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((59 / 5) && (a0[13] != v3)) && ((61 != v0) <= (v1 + 63)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v3 = (((64 ? a0[15] : v0) <= (51 || v0)) * ((v3 + a0[15]) ? (55 ? v0 : v3) : (a1[1][13] * a0[6])));
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v3 = (((a0[15] && v1) - (v3 || 23)) != ((v3 % 7) - (v0 + i4)));
+            a0[13] = (((69 - 83) <= (27 / 9)) != ((v0 % 8) || (82 % 4)));
+            {
+                int i5 = 0;
+                do {
+                    a1[2][2] = (((21 ? v3 : i5) + (78 ? v0 : v3)) < ((a1[1][10] - v3) % 6));
+                    v3 = (((v2 && a1[3][13]) > (65 + 25)) * ((a1[1][14] ? 14 : v1) <= (v2 + v3)));
+                    v3 = (((v3 >= 59) || (a0[5] - i5)) <= ((v1 < v3) + (v1 && a0[14])));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v1 ? a1[2][8] : v3) % 1) + ((39 < v2) ? (v3 <= v3) : (a1[3][7] || v0)))) {
+        a1[1][14] = (((a0[8] != v2) - (v1 + v3)) && ((v0 - v3) + (a0[15] ? v3 : 58)));
+        v0 = (((v1 / 7) <= (v2 <= v0)) && ((77 + v1) != (a1[0][9] >= v0)));
+        a0[13] = (((63 && v0) - (v3 ? v1 : v2)) == ((a0[7] ? 1 : 62) >= (v3 % 7)));
+    } else {
+        v3 = (((v2 * 88) / 9) % 3);
+        v3 = (((a1[3][8] >= v1) <= (v2 && 58)) % 2);
+        v1 = (((45 / 2) * (v1 > a0[6])) + ((76 > a0[6]) != (v0 && a1[3][12])));
+    }
+    return (((v0 && v1) ? (a1[3][1] != v0) : (16 < a1[2][11])) || ((a1[3][14] > 74) % 2));
+}
+int f2() {
+    int v0 = 49;
+    int v1 = 34;
+    int v2 = 59;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 || 61) ? (a0[2] >= 10) : (a0[15] / 6)) ? ((v2 != v1) * (v0 || 22)) : ((a0[13] / 1) || (v0 < v0)))) {
+        v0 = (((v1 != v2) || (v2 < v2)) * ((a1[2][0] ? v3 : a1[2][9]) ? (v0 == 12) : (68 + a1[3][10])));
+        v3 = (((22 != 47) <= (v0 ? v1 : 16)) || ((a1[3][8] || 90) ? (a1[0][12] != 63) : (a0[9] + 37)));
+        a0[14] = (((73 >= v2) == (v3 != 44)) < ((v3 == v1) - (v1 >= 57)));
+    } else {
+        v3 = (((v2 ? 73 : v3) ? (v0 <= v0) : (v3 || 73)) > ((a1[2][14] / 4) % 2));
+        v2 = (((a0[14] || v1) + (v3 / 8)) >= ((55 - v1) >= (v1 == v0)));
+        a1[3][14] = (((74 <= v3) < (99 == v2)) < ((a0[2] && 85) <= (v0 > 56)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[0][10] = (((a0[8] == a0[15]) == (v3 < 41)) + ((v3 <= v0) != (v3 % 1)));
+            v2 = (((5 && a1[1][5]) > (i0 <= a1[2][14])) <= ((v1 % 3) + (v0 || a0[7])));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((78 <= v2) != (i1 != a0[9])) >= ((83 && i1) <= (a1[2][12] % 8)));
+                    v3 = (((i0 > v0) != (a1[1][0] == v2)) % 4);
+                    v3 = (((i1 + a0[2]) == (v0 % 4)) > ((i0 % 2) != (47 ? a1[3][5] : 45)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v1 = (((a0[7] >= v3) / 7) == ((22 || v3) % 6));
+                v3 = (((v0 - a1[3][10]) != (v0 || 92)) && ((v1 ? v1 : 32) ? (v3 <= v2) : (24 + 31)));
+                v3 = (((i3 <= 13) >= (v1 ? 0 : i2)) <= ((2 == a0[2]) > (a0[5] % 9)));
+            }
+            v1 = (((v3 < a1[2][2]) ? (a0[3] < 43) : (a0[8] % 9)) < ((63 && a0[7]) + (i2 * 68)));
+            a1[2][3] = (((v1 >= v2) ? (84 * a1[0][8]) : (51 < v2)) + ((a1[0][15] > v0) > (v1 + 64)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v1 = (((a1[3][11] < a1[0][0]) - (a1[2][10] && v3)) < ((a0[12] + v1) != (a0[13] || a1[2][5])));
+                v1 = (((a1[2][14] % 1) - (v1 >= v3)) ? ((v3 ? 80 : 61) ? (11 || i4) : (v0 / 6)) : ((38 * 38) && (87 != v1)));
+                a1[1][5] = (((v0 ? v0 : i5) / 5) > ((a1[2][0] * i4) != (v3 >= v0)));
+            }
+            a0[11] = (((i4 < v2) / 4) != ((a0[11] > v3) % 4));
+            v1 = (((i4 > v0) < (29 == a1[0][13])) % 9);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            if ((a0[1] ? a1[0][5] : i6) > 58) break;
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    if ((i7 % 2) > 68) break;
+                    a1[3][14] = (((i7 <= v2) >= (v3 ? i6 : 80)) && ((i7 >= v3) - (i6 / 3)));
+                    v0 = (((v2 - a0[0]) / 5) || ((a0[5] || 76) - (67 ? v2 : 95)));
+                    v3 = (((a0[12] == v0) ? (a0[15] * a1[2][4]) : (v3 ? a0[0] : i6)) - ((73 + i6) >= (v2 && v1)));
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((a1[0][11] - v2) && (a0[14] || a0[0])) * ((v1 / 7) / 7));
+            v1 = (((v0 == v2) + (a0[12] || 72)) * ((49 * a0[8]) != (i6 - a0[3])));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v3 || v3) > (23 && 79)) || ((v2 ? v0 : v1) < (v1 < v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,77 @@
+int f0() {
+    int v0 = 38;
+    int v1 = 90;
+    int v2 = 38;
+    int v3 = 94;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((94 <= v1) > 86) break;
+            a0[2] = (((a1[0][0] + 88) && (a0[12] < a1[3][12])) - ((60 ? a1[2][0] : 37) != (3 == a0[3])));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a1[0][0] % 1) && (i1 + v1)) * ((i1 || v0) || (i1 > v2)));
+                    a1[3][10] = (((v2 / 5) < (42 && v1)) ? ((v0 ? 51 : a1[1][3]) > (a1[3][11] ? v2 : v3)) : ((a0[12] ? a0[11] : a1[2][11]) - (a0[6] + v0)));
+                    v0 = (((a0[2] >= v2) && (50 < v3)) && ((v3 ? 61 : v2) ? (v2 / 3) : (a1[0][6] / 8)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v1 = (((a0[14] != v2) != (5 || v1)) > ((v1 / 1) > (v2 || 63)));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v0 + 11) != (v2 ? v1 : a0[12])) >= ((v0 <= 26) - (v3 || a1[0][10])));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            if ((i2 < i2) > 96) break;
+            v1 = (((v2 > 39) ? (58 != v3) : (v3 ? 93 : v0)) ? ((4 == v2) == (20 + 52)) : ((v3 < a1[0][6]) - (i2 < a0[2])));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v3 = (((55 < 72) != (v3 && a0[9])) ? ((98 >= a0[1]) ? (v2 || v2) : (v0 / 5)) : ((v0 < i3) || (v2 || i3)));
+                    v2 = (((4 - a0[9]) <= (a0[2] * 61)) == ((a0[1] >= v1) > (a0[3] + a1[1][13])));
+                    a0[8] = (((48 < 41) >= (a0[13] > v3)) && ((v0 || a0[9]) / 5));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[10] = (((a0[12] > a1[1][7]) / 2) == ((v3 + v0) - (a0[13] * v0)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((v3 <= v0) > 77) break;
+            a0[0] = (((v2 < v2) && (i4 != a1[3][14])) * ((v0 != v2) <= (v1 / 4)));
+            {
+                int i5 = 0;
+                do {
+                    if ((a1[0][13] - v2) > 54) break;
+                    v1 = (((v2 >= v3) <= (a1[2][13] % 6)) + ((a0[1] ? i4 : a1[2][0]) != (i5 ? 88 : a1[2][12])));
+                    a1[1][4] = (((67 - 49) < (71 / 5)) - ((v3 + a0[0]) * (i4 >= i4)));
+                    a0[14] = (((i5 - v3) == (50 < 20)) >= ((v0 <= a1[0][10]) % 3));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v1 = (((v3 > a0[7]) ? (v1 - 31) : (v0 && v1)) ? ((v2 < i4) != (i4 || a0[8])) : ((40 != v2) == (v0 && v2)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((33 ? a1[2][11] : v2) * (v2 || 34)) < ((v2 || v3) >= (v1 != a0[13])))) {
+        v0 = (((18 / 2) < (29 < v2)) || ((a1[2][2] || v3) ? (v1 && v0) : (v1 ? v3 : a1[1][5])));
+        v1 = (((v2 - v0) ? (98 || a0[4]) : (v0 <= v2)) || ((v0 <= a1[2][8]) ? (v0 == 74) : (v3 == v0)));
+        v1 = (((v0 || a1[1][10]) % 7) + ((a0[8] <= 71) ? (37 > v0) : (32 == v1)));
+    } else {
+        v2 = (((a1[2][7] / 3) && (v0 > 53)) ? ((v2 < 26) && (v2 + v3)) : ((v3 + v0) ? (51 + v2) : (v2 <= a1[0][3])));
+        v3 = (((v0 + a0[4]) != (v0 ? a0[9] : v3)) >= ((a1[2][13] >= v2) >= (v2 <= 94)));
+        a0[6] = (((a1[3][5] * a0[10]) <= (a0[5] % 1)) / 2);
+    }
+    return (((v2 % 4) ? (v3 >= 83) : (47 % 2)) >= ((v3 + 15) < (a0[6] + v2)));
+}
+int main() {
+    return 0;
+}
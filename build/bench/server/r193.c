@@ -0,0 +1,101 @@
+int f0() {
+    int v0 = 41;
+    int v1 = 82;
+    int v2 = 26;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 <= v0) / 5) || ((a0[4] + 79) ? (v1 ? v2 : 46) : (v3 == v1)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v2 = (((a1[3][15] / 7) != (a1[1][0] < v2)) ? ((a1[3][4] ? 44 : a0[2]) < (a1[1][15] < 66)) : ((v0 > v1) % 7));
+                    v3 = (((i1 == 63) / 5) * ((43 / 5) == (v1 ? i1 : v3)));
+                    a1[2][5] = (((a1[0][15] <= i1) ? (i1 != 50) : (v0 <= v0)) * ((v3 && a0[13]) - (i0 > a1[3][9])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[3][13] = (((v2 * v1) ? (a1[1][5] && i0) : (a0[14] ? i0 : v3)) ? ((a1[2][1] >= v1) || (a0[13] == a0[5])) : ((2 || 87) < (a1[0][13] / 9)));
+            a0[7] = (((79 * a1[2][1]) % 3) == ((a0[12] - i0) == (i0 != v3)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((82 + v2) >= (a0[7] + v1)) || ((23 < 36) + (v1 + v3)))) {
+        a1[1][15] = (((v3 - v1) > (v3 % 1)) <= ((42 + 18) * (v1 != 71)));
+        a0[3] = (((12 ? a1[3][14] : a0[2]) - (33 <= v3)) && ((v3 && 99) / 4));
+        v0 = (((a0[6] >= v1) > (9 - v0)) > ((v0 <= v3) == (v2 != 62)));
+    } else {
+        a1[0][8] = (((a0[1] == v1) <= (96 >= a1[0][4])) ? ((v3 ? 21 : a0[1]) != (v0 >= 68)) : ((v2 % 5) ? (v2 < v2) : (a0[4] == a1[1][14])));
+        a0[13] = (((95 / 5) ? (v1 + a1[0][12]) : (20 && v2)) == ((v0 >= v3) >= (v3 <= v0)));
+        v0 = (((v2 < a1[3][1]) ? (a0[9] ? 24 : a1[1][6]) : (a1[0][0] % 6)) ? ((38 != a0[5]) != (v0 || 43)) : ((a0[1] ? v2 : v2) || (a0[6] || a1[2][10])));
+    }
+    v0 = (((v1 < a0[1]) - (v2 > a0[1])) <= ((a0[5] % 8) ? (73 ? v1 : v1) : (a1[2][7] != v2)));
+    v3 = (((a1[2][11] != a1[2][13]) * (v1 <= 82)) % 2);
+    return (((v1 != 92) ? (33 / 4) : (v0 <= a1[2][12])) <= ((v1 == v3) > (a1[1][11] && v0)));
+}
+int f1() {
+    int v0 = 28;
+    int v1 = 49;
+    int v2 = 52;
+    int v3 = 62;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((i0 * 22) > 58) break;
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((33 / 4) >= (v0 + a1[0][10])) / 7);
+                    a1[3][9] = (((a1[3][15] % 9) ? (i1 % 4) : (32 < v3)) - ((v1 * a1[0][6]) > (61 * a0[8])));
+                    v3 = (((a0[15] / 8) - (v0 / 8)) > ((a0[15] / 5) >= (v3 == v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v1 = (((43 && 1) * (v1 && 78)) || ((v2 < a0[1]) ? (v1 && a0[15]) : (37 / 5)));
+            v3 = (((a0[5] ? 86 : 75) / 3) || ((a1[2][5] ? a0[7] : 92) < (v3 < a0[12])));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((a0[8] ? v0 : 74) % 8) / 9)) {
+        a1[0][1] = (((v0 ? v0 : 3) || (v1 / 3)) ? ((92 && a0[6]) - (v2 - v2)) : ((a1[2][13] && 54) / 2));
+        v0 = (((61 <= 4) ? (a0[2] < v3) : (v0 - a0[0])) != ((a0[6] - 27) <= (v1 > v3)));
+        v3 = (((a0[5] % 9) + (v3 % 6)) / 8);
+    } else {
+        a0[7] = (((67 - a0[10]) && (21 >= v1)) - ((47 / 3) || (v3 >= v2)));
+        a1[3][6] = (((18 ? v0 : v1) ? (v0 == v3) : (v0 >= v2)) < ((82 < v3) > (v3 == 23)));
+        a1[3][7] = (((a0[8] == a1[1][15]) || (a0[11] - 9)) ? ((v1 + v0) % 4) : ((v0 != a1[1][14]) >= (a1[2][13] || v3)));
+    }
+    if ((((v1 ? 57 : v1) > (12 == 11)) % 8)) {
+        v0 = (((v0 > 27) ? (v0 < 24) : (78 ? 49 : 61)) * ((70 + v2) <= (v0 || 56)));
+        v3 = (((v2 ? 20 : a1[1][6]) ? (69 != a0[11]) : (43 / 8)) <= ((v2 ? 89 : v1) && (a1[3][9] && a0[4])));
+        v0 = (((a0[9] + 25) < (8 && 55)) != ((v2 % 1) % 1));
+    } else {
+        a1[2][14] = (((v1 >= v3) >= (v3 && a1[1][9])) - ((v3 + 40) ? (a1[0][14] - v1) : (v3 - v0)));
+        v2 = (((a0[12] != v1) >= (75 ? v0 : 84)) || ((v3 < v1) - (71 || 33)));
+        v0 = (((a1[3][0] - v1) <= (a1[0][2] >= 71)) * ((a1[3][13] - v0) + (92 + v2)));
+    }
+    v2 = (((a1[3][2] < v1) >= (v1 * 39)) / 5);
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a1[2][6] < a0[8]) <= (a1[0][13] <= 72)) <= ((v1 * 48) > (a1[2][1] && v0)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((v2 ? a0[10] : a1[0][3]) > 95) break;
+                v0 = (((48 + v3) < (i3 / 3)) >= ((v0 / 3) + (9 < 57)));
+                a0[11] = (((a0[12] && v0) + (a1[3][4] || 5)) || ((a0[14] >= a1[2][0]) >= (i3 ? v3 : i2)));
+                v2 = (((13 ? a0[8] : 75) - (a0[12] % 9)) > ((99 != 95) == (v1 <= v1)));
+            }
+            a1[2][15] = (((a1[3][5] ? i2 : v3) && (v0 ? a0[14] : a0[10])) + ((v2 >= a1[2][9]) / 7));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((v1 ? v2 : v3) * (v2 - v1)) ? ((58 ? 69 : v1) / 9) : ((a0[3] ? v2 : a1[2][8]) < (a0[8] && 11)));
+}
+int main() {
+    return 0;
+}
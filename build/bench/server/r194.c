@@ -0,0 +1,139 @@
+int f0() {
+    int v0 = 73;
+    int v1 = 95;
+    int v2 = 17;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a0[11] == a0[3]) > (v2 && v0)) % 9);
+    if ((((v0 != a1[0][5]) || (v0 < v1)) && ((44 == 28) || (v2 - a0[7])))) {
+        a1[3][4] = (((v1 < v2) <= (v2 || a1[0][15])) ? ((44 * a1[2][1]) != (a0[1] >= a0[4])) : ((v3 ? v2 : 62) % 7));
+        v0 = (((v3 && a1[2][8]) < (48 % 8)) == ((v0 != a0[14]) ? (0 || 22) : (86 > v3)));
+        v1 = (((69 <= a0[7]) || (2 || v2)) % 3);
+    } else {
+        a1[2][0] = (((v0 <= v0) % 8) < ((23 > v2) / 8));
+        v2 = (((61 ? a1[1][6] : v3) != (v2 ? a1[1][14] : 96)) - ((v1 - v0) * (v3 / 3)));
+        a0[6] = (((a0[6] && 4) * (v0 >= v3)) ? ((v0 == 19) && (v2 ? a0[14] : 16)) : ((v3 != v2) - (v2 * v1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 == v2) ? (v3 % 9) : (v2 - 53)) ? ((a0[6] - v0) % 2) : ((v1 == 46) % 2));
+            v2 = (((84 != 33) && (v1 / 1)) + ((93 + 73) * (i0 && v2)));
+            {
+                int i1 = 0;
+                do {
+                    a1[2][4] = (((v0 && 76) + (28 % 6)) + ((v3 > a1[1][4]) || (i1 > v1)));
+                    a0[3] = (((40 >= v0) ? (62 == 81) : (i0 - i1)) && ((i1 + a1[3][8]) - (v2 + i0)));
+                    v1 = (((60 % 6) + (61 > i0)) > ((v0 == a0[4]) == (v2 == a0[2])));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v3 = (((v2 + v3) * (v0 / 3)) != ((a1[0][15] < a1[2][14]) / 4));
+        v2 = (((v2 > 7) ? (a0[5] < v0) : (v0 > 79)) ? ((v0 >= v1) ? (v3 * v0) : (v3 && 89)) : ((26 < a1[0][12]) / 2));
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            v3 = (((86 > i3) >= (73 && v1)) || ((8 * a0[6]) == (i3 != v0)));
+            v1 = (((v3 ? v3 : a0[9]) + (a1[3][6] <= 43)) && ((v0 < 21) || (23 || a1[0][0])));
+            v0 = (((v3 ? 3 : 88) >= (i2 < i3)) ? ((i3 < a0[0]) ? (63 % 6) : (v2 % 4)) : ((i3 <= a1[3][2]) >= (i3 < 87)));
+        }
+    }
+    if ((((v2 != v3) / 1) / 4)) {
+        v2 = (((25 / 1) != (v1 + v1)) < ((v1 - a1[0][2]) / 5));
+        a1[1][11] = (((15 ? v3 : v2) == (v3 < a1[0][7])) - ((90 * 45) ? (v0 > v1) : (a0[13] > v1)));
+        v2 = (((a1[0][12] != v0) >= (a0[7] * v1)) > ((a1[1][0] || v0) == (v0 || a0[5])));
+    } else {
+        v0 = (((a0[11] - v0) % 2) != ((v2 >= a0[0]) / 4));
+        a1[2][8] = (((v1 < 71) * (94 >= a1[2][14])) && ((a1[3][10] != 83) == (v3 || a1[1][15])));
+        a0[12] = (((v3 == 19) > (v3 != a1[0][2])) >= ((v0 >= v1) >= (v0 ? v1 : 61)));
+    }
+    return (((v3 ? a0[8] : 13) >= (v2 / 1)) > ((48 || a1[3][4]) ? (v3 * a1[1][12]) : (v3 / 1)));
+}
+int f1() {
+    int v0 = 91;
+    int v1 = 54;
+    int v2 = 44;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    if ((((68 ? 0 : 46) - (v2 && a1[2][4])) ? ((v3 <= a0[6]) < (a1[0][7] >= a0[9])) : ((v0 == a1[1][3]) == (v3 / 5)))) {
+        v2 = (((77 || a0[4]) <= (v2 - v1)) != ((v0 <= a0[15]) < (v1 || v2)));
+        v0 = (((98 ? v1 : 86) >= (a1[2][6] ? v1 : a0[8])) <= ((v1 / 6) && (25 < v1)));
+        v1 = (((v0 - 14) >= (v2 <= a0[6])) >= ((v0 > a0[4]) <= (v3 != v1)));
+    } else {
+        v1 = (((v2 + 14) >= (v0 ? v3 : v3)) <= ((80 % 1) + (a1[3][12] < v1)));
+        v3 = (((v2 + v2) >= (v2 * 32)) ? ((v0 ? 82 : 19) || (v3 > v0)) : ((v1 - a0[3]) == (50 == 59)));
+        a1[3][13] = (((70 / 1) / 7) >= ((33 + v1) && (a0[5] * v2)));
+    }
+    a1[0][4] = (((19 ? a1[1][12] : v3) / 1) && ((79 * a1[1][0]) + (a0[0] <= a1[0][11])));
+    v3 = (((v2 * v3) ? (57 <= a1[2][0]) : (50 / 5)) == ((v1 - v2) + (a0[6] <= v3)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((v3 ? v2 : a0[10]) + (35 / 6)) == ((v3 && v0) ? (v3 || i0) : (82 && v3)));
+                v3 = (((a1[3][6] / 9) && (v0 < 80)) - ((v3 < a1[0][12]) + (a0[1] <= i0)));
+                a0[13] = (((40 % 4) || (v0 <= v2)) ? ((i0 >= a0[5]) <= (a1[0][6] ? 66 : v0)) : ((v3 != 68) % 5));
+            }
+            v1 = (((v1 ? a1[2][0] : a0[13]) + (a1[3][2] != v0)) || ((31 * 36) ? (1 / 2) : (v0 != 24)));
+            v2 = (((40 % 4) || (v2 == v1)) % 3);
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((7 != v2) * (v0 ? i2 : 40)) ? ((i2 % 7) - (v2 != v0)) : ((v3 >= a1[3][7]) != (a1[0][5] && v0)));
+        v0 = (((a1[3][15] && v3) % 5) - ((v2 == 56) >= (i2 == v3)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v0 = (((a1[0][1] <= 39) > (a0[3] == 63)) % 3);
+            v0 = (((a0[6] || a0[12]) % 8) && ((v0 ? a0[2] : a0[11]) && (v1 + v2)));
+            a1[0][14] = (((a0[1] - 87) + (v0 == a0[8])) ? ((54 * a0[1]) && (i2 * i3)) : ((v1 * v3) <= (v3 * v1)));
+        }
+    }
+    return (((39 - 58) != (v1 && a1[0][2])) ? ((v0 > a0[4]) + (v3 % 1)) : ((v2 <= v1) % 5));
+}
+int f2() {
+    int v0 = 63;
+    int v1 = 27;
+    int v2 = 26;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((34 == v3) == (46 - a0[9])) % 3);
+    {
+        int i0 = 0;
+        do {
+            v1 = (((54 >= a1[0][14]) + (v2 - a1[3][14])) != ((v1 - a0[2]) ? (62 - a1[1][0]) : (a1[2][3] > i0)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a1[1][2] = (((91 - v1) >= (v3 - 13)) ? ((v2 + 2) < (a1[1][12] == a1[1][15])) : ((a1[1][4] >= 91) < (v0 != a1[2][2])));
+                v1 = (((i1 * i0) < (38 && i0)) % 7);
+                a0[3] = (((9 ? v1 : i1) / 4) ? ((v0 / 3) - (75 > i1)) : ((v2 == i0) * (v0 || v2)));
+            }
+            v1 = (((v1 * v1) > (70 ? v0 : a0[11])) ? ((v2 > 98) == (i0 < v0)) : ((i0 >= a0[7]) || (95 == v0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((v2 >= 96) > 78) break;
+        v3 = (((49 < v3) ? (v3 % 5) : (79 < 29)) >= ((v0 == a1[3][4]) + (v3 == v1)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((i2 + 44) > 87) break;
+                v3 = (((54 >= 52) != (i2 * a0[8])) - ((a0[14] - 16) >= (i3 && v3)));
+                v2 = (((89 ? v0 : v1) - (99 * a1[3][9])) * ((i2 / 7) != (a1[1][10] + 69)));
+                a0[1] = (((v2 >= i2) == (i3 - 31)) != ((a0[11] > i3) || (v2 <= 38)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((i2 ? a0[14] : v1) + (a0[0] / 7)) >= ((59 > v2) / 9));
+    }
+    v2 = (((v0 ? v3 : v2) != (v2 + v2)) % 2);
+    v2 = (((79 == v0) ? (v1 % 4) : (99 <= v1)) >= ((a1[0][3] ? v1 : 65) && (v2 ? v3 : 72)));
+    return (((v2 ? v1 : a1[1][10]) <= (v0 == 40)) && ((a0[11] == v2) && (v3 > v3)));
+}
+int main() {
+    return 0;
+}
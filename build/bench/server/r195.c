@@ -0,0 +1,58 @@
+int f0() {
+    int v0 = 4;
+    int v1 = 96;
+    int v2 = 88;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    a1[3][13] = (((v3 ? v0 : v1) || (v3 ? v3 : 56)) < ((a1[0][14] >= a0[10]) < (v1 - v1)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((v1 && 27) > 96) break;
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v1 = (((v1 ? i0 : 47) ? (v0 ? 54 : a0[13]) : (a0[11] <= i0)) > ((i0 <= v0) < (i1 ? a0[1] : v2)));
+                v2 = (((i1 != v1) && (i1 || a1[1][12])) * ((24 % 9) ? (v1 == 57) : (a0[14] % 4)));
+                v1 = (((i0 ? v2 : 56) ? (74 - a0[14]) : (v0 <= a1[2][15])) < ((a1[2][12] || 28) != (v3 <= v0)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[2][5] = (((a0[7] ? 17 : i0) == (v2 == a1[2][11])) || ((28 < a1[0][14]) <= (v3 ? 17 : a0[14])));
+        v0 = (((a0[0] / 4) || (v3 ? v2 : v0)) + ((a0[0] * 16) + (i0 && v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a1[3][12] == 1) % 5) - ((v1 / 9) == (72 > v0)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((v2 + 44) ? (i3 || v2) : (i3 && v0)) >= ((a0[10] || a1[1][9]) || (i2 > i2)));
+                v3 = (((v0 || i3) % 5) > ((v0 / 9) >= (78 || a1[1][2])));
+                a1[2][12] = (((a1[3][8] != a0[8]) ? (86 % 9) : (v3 % 1)) - ((i2 < 2) + (v1 < 11)));
+            }
+            v0 = (((a1[1][14] ? v1 : a0[7]) && (15 <= i2)) && ((a0[7] ? v3 : 69) != (a0[14] < v0)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v1 = (((a0[4] < a0[8]) < (65 >= v2)) < ((50 + 32) * (v1 ? v3 : i5)));
+                    v3 = (((48 || a0[10]) >= (v0 <= 24)) + ((v1 - 41) != (v2 - v2)));
+                    a0[13] = (((v0 ? v1 : 28) ? (i5 || v1) : (i5 * v1)) * ((46 <= a0[7]) - (v2 - v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][0] = (((a0[12] ? 87 : i4) != (20 >= 42)) ? ((v1 ? v3 : v0) % 1) : ((v0 - a1[0][2]) % 9));
+            a0[5] = (((a1[3][3] <= a0[11]) < (a0[3] >= a1[0][1])) != ((i4 + a0[3]) || (i4 % 3)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    v0 = (((a0[12] ? 24 : 30) % 2) % 5);
+    return (((v2 <= v2) <= (a0[1] ? v2 : 89)) + ((50 - 67) + (27 <= a0[15])));
+}
+int main() {
+    return 0;
+}
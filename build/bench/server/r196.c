@@ -0,0 +1,147 @@
+int f0() {
+    int v0 = 21;
+    int v1 = 40;
+    int v2 = 35;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 && 28) || (v2 < 28)) % 6)) {
+        a0[6] = (((41 - 15) < (v3 != v3)) || ((v3 + v1) * (v3 && 6)));
+        v3 = (((a1[1][3] < v3) == (a1[0][14] / 4)) != ((v1 < a0[14]) == (v2 < v0)));
+        v3 = (((93 - a0[5]) == (v2 >= v3)) / 9);
+    } else {
+        a1[3][0] = (((a1[2][4] % 7) || (a1[3][4] || v3)) > ((a0[8] ? v2 : a0[4]) >= (17 + 55)));
+        v1 = (((v0 == a1[2][15]) ? (v0 % 8) : (24 || a0[10])) * ((61 % 6) + (v1 != 65)));
+        v1 = (((a1[1][1] && v3) % 7) <= ((79 || v1) || (50 + v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[9] = (((v2 != a0[15]) ? (a0[14] - a0[7]) : (a0[6] > 96)) * ((a0[1] * v3) <= (69 % 1)));
+            a1[2][8] = (((v2 * v3) > (i0 / 2)) < ((v2 ? v2 : i0) * (a0[9] % 4)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[14] >= v3) > 54) break;
+                    a0[3] = (((i0 >= a0[1]) > (1 / 6)) <= ((v2 >= v1) / 3));
+                    a1[3][1] = (((a0[3] - v2) ? (a1[3][9] % 3) : (i0 % 8)) + ((i0 == 51) ? (a1[2][11] <= a0[15]) : (a1[2][14] > i0)));
+                    v2 = (((74 && v1) != (a0[4] != a1[3][1])) == ((a1[2][13] ? v3 : i0) && (88 <= a0[15])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v2 = (((62 % 2) ? (i3 > 13) : (i3 == i3)) ? ((v3 - 38) * (a1[1][2] != i2)) : ((a0[8] + i2) + (13 < a1[0][5])));
+                v2 = (((i2 < v1) + (v3 + v2)) + ((20 < v2) == (i3 * v3)));
+                v0 = (((a0[8] ? 81 : i2) <= (a0[10] ? a1[1][9] : 96)) ? ((v3 > i3) + (a0[5] || i3)) : ((v2 / 9) && (a0[11] == a0[14])));
+                i3 = i3 + 1;
+            }
+        }
+        a0[13] = (((a1[3][11] ? 17 : 76) > (a1[1][8] - v1)) % 6);
+        a0[14] = (((90 != a0[4]) ? (i2 && a1[1][4]) : (24 ? a0[0] : v3)) - ((v1 < a1[2][1]) && (a1[0][6] >= i2)));
+    }
+    if ((((v1 * 60) > (83 ? a0[4] : v2)) != ((a1[1][12] + 53) && (v3 ? v2 : v1)))) {
+        v0 = (((a1[1][0] < 37) - (83 != v0)) + ((v2 && a1[2][13]) % 7));
+        a0[5] = (((69 && v1) < (57 + a1[3][10])) * ((v3 ? a1[1][14] : a0[2]) && (a1[1][3] == v0)));
+        a1[0][11] = (((v0 < a0[5]) > (a0[14] + v1)) <= ((a0[10] != v2) - (a0[14] % 1)));
+    } else {
+        v2 = (((a0[6] + a1[2][1]) % 7) <= ((a0[0] > 16) / 1));
+        v1 = (((v1 || 48) == (v2 * v2)) - ((v2 != v3) - (10 + 14)));
+        v2 = (((a0[10] <= a0[10]) <= (a1[2][2] && v3)) ? ((v3 + v0) < (a0[12] == v0)) : ((a1[0][13] && 12) ? (41 >= 38) : (v3 + v1)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            if ((a0[8] > a0[3]) > 62) break;
+            {
+                int i5 = 0;
+                do {
+                    a1[1][10] = (((99 - a1[3][10]) % 2) != ((84 / 8) % 4));
+                    a0[1] = (((v3 ? 21 : i5) > (v2 + v1)) / 7);
+                    v3 = (((81 == a1[3][3]) < (v3 == v3)) > ((a1[0][12] >= a1[3][11]) < (a1[3][2] / 2)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a0[9] = (((25 <= a1[3][9]) || (v0 % 6)) ? ((a1[3][2] % 1) > (1 && v3)) : ((17 != 36) || (a1[2][12] - 76)));
+            a1[0][4] = (((a0[4] + v3) ? (i4 * a1[2][9]) : (v2 % 1)) - ((i4 <= a1[1][6]) < (v2 && a0[4])));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v1 != v1) * (v2 != a0[5])) % 1);
+}
+int f1() {
+    int v0 = 35;
+    int v1 = 95;
+    int v2 = 25;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((a1[2][6] / 5) + (96 ? a0[8] : 60)) - ((76 ? v3 : v3) + (v1 ? i0 : v3)));
+                    a1[3][8] = (((21 >= v2) > (v0 < a1[1][14])) ? ((21 != v0) / 4) : ((87 + 33) % 5));
+                    v3 = (((94 ? i1 : i0) - (v2 >= v0)) / 6);
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][3] = (((a1[2][1] > v1) - (77 <= a0[6])) == ((v0 - 79) / 1));
+            a1[1][2] = (((75 ? 92 : i0) < (v3 < i0)) <= ((v0 >= i0) % 4));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[4] = (((i2 % 9) % 1) || ((24 >= v0) >= (a1[0][15] ? a0[8] : a0[0])));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((76 <= i3) > 94) break;
+                v1 = (((a0[10] + v1) ? (v0 == v3) : (v3 == v1)) >= ((55 && 56) != (v3 - 63)));
+                a1[3][2] = (((i2 > a0[4]) % 2) % 4);
+                v3 = (((i3 != v1) >= (48 && i3)) + ((78 ? 5 : 41) != (i3 ? v3 : i2)));
+            }
+            v0 = (((a1[1][5] >= v2) ? (v3 ? v3 : i2) : (a1[0][15] ? a0[0] : 94)) / 4);
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v3 = (((0 > v2) >= (v2 == 48)) % 3);
+            v0 = (((a0[2] + v2) >= (a0[6] * v0)) >= ((a0[5] != v3) ? (80 < v1) : (v1 == i4)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    if ((37 > i5) > 79) break;
+                    v0 = (((i4 % 1) > (i5 && v2)) * ((v0 ? i5 : 92) % 1));
+                    v2 = (((v2 + i5) >= (a0[14] * a0[10])) ? ((a0[12] == 14) ? (v3 && a1[0][11]) : (v2 + 35)) : ((v2 && a0[0]) < (i5 + i5)));
+                    v2 = (((a0[4] + a0[15]) == (46 % 3)) % 5);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    a1[3][4] = (((v3 % 1) == (a0[13] < v0)) + ((14 >= a1[2][3]) % 7));
+    if ((((21 == v1) < (a0[10] + a1[2][3])) ? ((v3 && 77) ? (v0 || v1) : (a0[4] && a1[2][8])) : ((v3 % 9) || (v2 % 1)))) {
+        v3 = (((v0 * a1[0][4]) - (v3 ? v2 : a1[2][7])) > ((85 < 78) != (49 + v2)));
+        v0 = (((v1 != v0) ? (v0 < v1) : (a0[12] > a0[11])) - ((a0[11] != v0) > (a1[3][8] + a0[11])));
+        a0[12] = (((v0 + 1) - (v3 * v2)) ? ((46 >= v0) > (v2 ? a1[1][8] : v1)) : ((v0 == v2) % 7));
+    } else {
+        a0[4] = (((v0 == 60) != (v1 > v3)) <= ((v0 + v2) < (48 * v3)));
+        v0 = (((v1 <= v3) ? (v0 != a1[0][1]) : (v0 ? a1[1][5] : a1[0][12])) % 6);
+        a0[5] = (((v2 ? v1 : v2) != (a1[3][5] <= a1[3][0])) * ((v3 / 9) > (a1[0][10] <= v2)));
+    }
+    return (((v2 == 94) && (v2 % 8)) > ((v3 * 57) % 2));
+}
+int main() {
+    return 0;
+}
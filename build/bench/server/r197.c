@@ -0,0 +1,183 @@
+int f0() {
+    int v0 = 86;
+    int v1 = 75;
+    int v2 = 45;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v3 = (((a1[3][15] == v0) == (v3 ? a0[6] : 46)) / 7);
+                a1[2][14] = (((a0[15] < i0) ? (25 == a0[10]) : (v0 % 3)) ? ((i0 <= v3) && (76 == a1[3][12])) : ((52 > v0) ? (v2 ? i0 : a0[4]) : (i0 || v3)));
+                a1[2][15] = (((v1 < v0) < (v1 / 8)) == ((a1[1][4] - 13) - (36 % 6)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        a1[2][1] = (((v3 * a1[0][15]) ? (56 * a1[1][7]) : (a1[2][7] % 4)) > ((36 >= a1[1][9]) % 4));
+        v2 = (((83 >= 22) <= (a1[3][7] == v0)) ? ((a0[7] > v3) ? (14 && 5) : (v2 || a1[0][3])) : ((v2 / 3) <= (v2 - v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((6 + a1[0][4]) > 92) break;
+            a0[8] = (((a1[0][12] || v1) != (a1[1][5] >= a0[13])) - ((v1 < a0[15]) || (v3 != a1[2][9])));
+            a1[2][1] = (((v2 || v1) != (54 * i2)) > ((a1[1][12] ? a0[9] : a0[11]) || (a1[3][5] <= v2)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a1[0][6] = (((v2 >= 31) ? (v1 - 76) : (v3 - i2)) - ((a0[5] ? a0[11] : v3) ? (a1[0][0] || v0) : (v2 ? v1 : v3)));
+                v1 = (((a0[2] ? a1[0][15] : v2) == (v3 - 65)) && ((v2 * 84) - (i3 * a0[14])));
+                v0 = (((12 % 4) - (v3 ? 59 : a0[15])) % 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    a1[2][12] = (((v3 && a1[1][2]) / 4) - ((v0 > a0[8]) % 1));
+    if ((((v1 / 8) != (v2 + a1[0][3])) <= ((a0[8] ? a1[2][12] : a0[11]) == (71 > v1)))) {
+        v3 = (((v2 <= v1) <= (81 / 1)) < ((v0 - v3) > (v1 ? a1[3][9] : a0[8])));
+        v2 = (((a1[2][6] || v2) && (v0 + 90)) == ((v2 || v3) ? (v2 == v1) : (54 || v0)));
+        a0[8] = (((26 == v1) == (68 != v1)) % 1);
+    } else {
+        a1[3][4] = (((v3 < v1) - (82 ? 13 : v2)) || ((v2 > v3) != (a0[12] * v2)));
+        v2 = (((v0 >= v2) % 4) >= ((v0 / 7) * (v3 && 7)));
+        v1 = (((v1 <= v2) != (a0[1] == a0[3])) > ((a0[9] == 90) / 1));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            a1[2][7] = (((86 <= a0[15]) && (36 == v0)) - ((v0 ? v1 : a0[12]) && (a1[3][13] < v2)));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    a0[10] = (((v1 > i4) <= (v2 <= a0[13])) && ((v2 < i4) - (70 ? a0[5] : a1[2][14])));
+                    v2 = (((v0 <= 28) >= (a1[0][9] % 8)) + ((62 || 34) || (78 > v3)));
+                    a0[2] = (((73 ? v0 : v3) >= (a1[2][14] ? v0 : i5)) + ((a1[3][5] == i4) ? (v0 > i4) : (a0[14] ? 48 : 92)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((0 == i4) <= (49 != v2)) * ((v2 - a1[1][2]) >= (v2 <= i4)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((69 ? v0 : 49) <= (a0[0] == a1[1][1])) ? ((42 ? v3 : 12) < (v0 < 42)) : ((v2 || v0) + (v1 ? v1 : a1[1][2])));
+}
+int f1() {
+    int v0 = 65;
+    int v1 = 7;
+    int v2 = 73;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    a1[1][8] = (((v2 != a0[1]) >= (v2 < a0[7])) && ((a0[14] * a1[2][9]) / 9));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((i0 * v0) * (a1[2][15] + a1[1][1])) != ((a0[11] <= 70) < (a0[1] < i1)));
+                v2 = (((i1 ? v3 : 97) < (a0[4] == v1)) + ((i0 * v3) * (41 % 3)));
+                a0[4] = (((60 <= i0) / 3) < ((29 || a1[0][3]) - (v3 / 9)));
+            }
+            v2 = (((v1 * v1) == (v0 == i0)) - ((18 / 5) ? (v1 == a1[0][1]) : (v1 && 98)));
+            v1 = (((a0[9] ? 30 : a0[2]) % 9) * ((a0[10] % 7) / 8));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v1 <= v0) || (86 && v0)) != ((v1 - v2) - (a0[3] >= v2)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a0[2] && i3) > (i2 || a1[2][11])) / 2);
+                    a1[2][2] = (((28 ? a1[3][6] : 67) % 1) * ((a0[15] == 12) > (v1 >= 1)));
+                    a1[2][13] = (((i3 + v3) >= (45 || 34)) + ((v3 == 12) % 1));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v3 = (((v2 >= i2) - (a0[15] ? 62 : a0[12])) != ((64 + v0) < (12 % 7)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v1 = (((v2 == v0) - (76 + 26)) != ((86 <= v1) <= (v2 == v1)));
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v0 >= 58) * (v3 || 22)) / 1);
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                if ((a1[2][3] != v1) > 99) break;
+                v3 = (((a1[3][10] == i5) || (92 > 64)) <= ((v2 == 68) - (v3 % 4)));
+                v3 = (((a1[2][15] >= a1[1][13]) == (89 ? 65 : i5)) - ((a1[3][11] + v3) ? (i4 == 58) : (17 / 7)));
+                a1[0][6] = (((20 > v0) * (6 >= i5)) < ((33 <= 33) || (i4 - 64)));
+            }
+            a0[11] = (((v1 != a0[13]) / 4) || ((i4 + 46) ? (v0 || a0[0]) : (a1[3][0] ? v0 : 5)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    return (((a1[1][2] > v0) / 2) == ((a0[1] % 2) - (58 + v1)));
+}
+int f2() {
+    int v0 = 61;
+    int v1 = 51;
+    int v2 = 82;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 != v3) <= (9 / 2)) / 2)) {
+        a0[12] = (((24 > v1) != (a1[0][3] ? v3 : 71)) ? ((v3 + 4) && (v1 && v0)) : ((v1 || a0[0]) + (v1 - v2)));
+        a1[1][9] = (((v2 * v3) || (44 + 68)) / 8);
+        v0 = (((96 && v3) >= (v2 ? a1[2][12] : 18)) <= ((a1[3][9] - a0[1]) * (v2 >= v2)));
+    } else {
+        v1 = (((88 || a1[2][9]) || (a1[0][2] ? v3 : 43)) >= ((a0[0] >= v1) <= (v0 < v2)));
+        a0[11] = (((98 % 2) < (v2 % 5)) > ((v1 || v1) <= (16 - 10)));
+        v3 = (((94 > v2) / 7) > ((49 + a1[2][9]) * (57 / 2)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a0[12] = (((v0 % 2) || (94 && v3)) || ((v2 ? v1 : a1[3][9]) <= (v1 * a1[2][10])));
+        a1[2][8] = (((v1 / 5) ? (a1[2][14] + a1[1][6]) : (59 < v1)) > ((a0[10] - v1) * (v0 ? a1[0][5] : 76)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a0[6] = (((73 >= a0[6]) ? (a1[1][3] ? i0 : a1[2][10]) : (i0 >= i0)) < ((i1 / 4) || (v2 ? v0 : i0)));
+            a0[4] = (((v3 <= v2) / 7) > ((i0 + a0[14]) + (i1 >= v0)));
+            v2 = (((a0[10] - i0) == (v1 - 77)) || ((v1 && 29) / 4));
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            a0[6] = (((v2 || a0[10]) * (v2 / 5)) + ((i2 ? a1[2][3] : 15) == (v2 - a0[8])));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v0 = (((i3 == v2) || (i3 != a1[0][11])) <= ((a0[9] < i3) ? (v1 ? i3 : 86) : (v3 >= v0)));
+                a1[3][2] = (((v1 % 8) || (68 - v0)) <= ((i3 >= 46) <= (a0[8] != v0)));
+                v3 = (((63 <= v1) < (i2 || 62)) / 9);
+            }
+            a0[9] = (((v0 % 8) + (a0[1] >= 78)) + ((a0[5] / 6) || (9 >= v3)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v3 ? v2 : 37) == (29 || a0[2])) * ((a1[1][15] * a1[3][1]) <= (a0[10] || v1)))) {
+        v3 = (((50 + v2) && (v1 ? v1 : a1[0][7])) / 1);
+        v0 = (((v1 <= v3) || (v3 && v1)) < ((a0[14] >= v3) < (95 >= v1)));
+        v3 = (((10 && v1) || (56 != a1[0][6])) >= ((a1[3][11] > v3) - (v0 || a0[0])));
+    } else {
+        v2 = (((36 || a1[3][3]) ? (v0 < a1[3][10]) : (v3 ? v2 : 83)) || ((v2 ? 46 : v1) < (94 > 40)));
+        v1 = (((v0 <= a1[1][4]) != (86 <= a1[0][5])) + ((v1 && a0[11]) ? (95 && a1[1][12]) : (v0 != a1[3][4])));
+        v1 = (((78 >= v3) % 2) - ((5 != a1[2][13]) ? (54 >= v0) : (a0[9] * v0)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((a0[2] <= a0[11]) * (a1[1][4] / 1)) == ((v2 % 1) && (93 == 51)));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                a1[3][0] = (((v0 * 44) != (v1 - a0[2])) * ((a1[1][12] < a0[0]) && (v3 % 9)));
+                v3 = (((i5 >= v3) < (v0 % 5)) < ((v0 > v0) ? (v1 ? a1[0][8] : v0) : (61 * v2)));
+                v0 = (((v3 - v0) ? (i4 || 66) : (v2 > 58)) >= ((i5 >= a0[7]) > (v2 && v2)));
+            }
+            a1[2][7] = (((v3 - a0[2]) % 2) * ((i4 + v3) == (v2 <= 77)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((v2 >= v0) && (27 < v2)) <= ((v0 - v3) % 4));
+}
+int main() {
+    return 0;
+}
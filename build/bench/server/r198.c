@@ -0,0 +1,63 @@
+int f0() {
+    int v0 = 0;
+    int v1 = 82;
+    int v2 = 92;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v2 ? v3 : v1) <= (v3 < 21)) * ((v0 >= 35) % 5));
+    {
+        int i0 = 0;
+        do {
+            if ((v2 != a1[1][9]) > 62) break;
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    if ((v0 / 9) > 88) break;
+                    v0 = (((v2 * a0[11]) <= (v2 % 5)) <= ((i0 + 51) >= (41 < v3)));
+                    v1 = (((v2 / 5) - (a0[2] >= 22)) + ((a0[9] != i0) + (i0 ? a0[3] : 76)));
+                    v1 = (((v3 >= v1) <= (v2 < 87)) - ((77 + i0) * (83 < 61)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v3 / 4) == (v2 % 9)) != ((i0 >= i0) - (v0 > 92)));
+            v3 = (((30 <= i0) ? (v1 || v3) : (i0 == v2)) * ((a0[4] >= v3) && (v1 || v3)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v0 = (((v0 >= 31) < (a1[0][6] + 31)) ? ((28 * a1[3][13]) ? (a1[1][4] ? a0[0] : v3) : (v3 / 1)) : ((7 || i2) <= (a1[0][11] ? v2 : v3)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v3 = (((v3 ? a0[0] : v2) + (92 == i2)) % 4);
+            a0[3] = (((i3 == i2) <= (v1 && 7)) || ((a1[3][10] < v2) % 1));
+            v3 = (((a1[3][13] || v3) <= (a0[0] * v1)) >= ((a1[1][14] + a1[2][0]) <= (a1[1][3] > v2)));
+        }
+        a1[0][10] = (((13 / 3) ? (a0[10] - i2) : (60 != 99)) / 2);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        a1[0][7] = (((63 - a1[3][1]) <= (25 / 1)) >= ((v0 - a1[0][3]) == (i4 || a1[3][4])));
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                a0[12] = (((v3 == a1[0][4]) * (v0 - i5)) ? ((v0 >= i5) == (i5 * 51)) : ((a1[0][11] + i4) <= (69 ? a1[1][14] : 21)));
+                v3 = (((a1[3][7] > i5) <= (v0 >= a1[2][4])) || ((a0[10] || 36) % 7));
+                a0[7] = (((v1 % 6) <= (a0[1] ? v3 : v3)) != ((v0 >= i5) ? (i4 == a0[3]) : (a1[0][7] - i4)));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((v3 ? 32 : v2) ? (a0[7] >= 89) : (a0[8] != a0[10])) == ((a1[3][8] ? 30 : 36) ? (62 || v3) : (v1 ? v0 : a0[11])));
+    }
+    if ((((v3 || 29) < (v0 && v0)) >= ((v0 || a1[3][1]) * (a1[1][11] == v1)))) {
+        a0[13] = (((65 == v0) + (v0 <= a0[14])) ? ((v0 > v3) + (v3 < v3)) : ((29 >= v2) % 3));
+        v0 = (((v3 > v0) && (9 < 51)) && ((10 / 7) ? (v1 + a0[3]) : (a1[2][5] ? v0 : v0)));
+        v3 = (((v3 == v3) - (99 > v2)) - ((2 * v3) ? (a0[11] * a1[3][0]) : (86 - a0[9])));
+    } else {
+        v3 = (((v1 <= v3) > (a0[15] && v2)) >= ((v3 / 8) * (64 && 81)));
+        a0[14] = (((v0 != v3) && (v2 < a0[6])) + ((v0 > v3) == (v0 ? v2 : a1[2][1])));
+        v1 = (((v1 >= a0[3]) == (v3 || 32)) > ((v1 >= a0[14]) >= (49 < a1[3][10])));
+    }
+    return (((a0[12] || v2) < (v1 != 10)) >= ((v2 > v3) + (72 > v3)));
+}
+int main() {
+    return 0;
+}
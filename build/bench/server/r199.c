@@ -0,0 +1,95 @@
+int f0() {
+    int v0 = 62;
+    int v1 = 29;
+    int v2 = 76;
+    int v3 = 60;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[11] + a1[2][10]) && (v3 / 3)) || ((v1 - v2) == (91 + v3)))) {
+        v2 = (((a0[4] ? 90 : a1[1][13]) && (v3 / 6)) < ((v2 ? v1 : 8) % 8));
+        a1[0][10] = (((v2 > v0) <= (45 / 9)) > ((a0[6] || a0[9]) / 7));
+        v3 = (((v0 >= v2) / 8) - ((v2 && a1[1][13]) * (12 ? v3 : v0)));
+    } else {
+        a0[7] = (((a1[1][15] ? v2 : v3) % 7) && ((a0[10] == v3) && (39 * v1)));
+        v2 = (((v2 > v1) * (v3 / 7)) / 7);
+        v1 = (((v1 / 7) ? (a0[3] ? a1[0][0] : a0[15]) : (99 > v0)) > ((v1 ? v2 : 87) ? (94 >= v3) : (a0[13] % 9)));
+    }
+    v3 = (((v1 && 39) ? (v1 < v3) : (50 > 97)) < ((v1 == 82) + (v3 + 11)));
+    if ((((95 && 74) % 5) ? ((91 - v2) != (a1[3][7] / 3)) : ((v3 > v2) && (87 ? 42 : v1)))) {
+        v1 = (((v2 && a1[2][10]) != (v1 && v0)) - ((10 / 2) ? (v0 ? a0[4] : v0) : (a1[0][5] && v3)));
+        a0[13] = (((64 >= v1) - (87 % 7)) > ((89 * v1) % 3));
+        a1[0][5] = (((v3 ? a0[10] : v2) <= (v3 <= v3)) ? ((v2 ? v1 : a0[9]) ? (99 >= v0) : (v2 || a0[15])) : ((v2 % 8) > (v2 + v3)));
+    } else {
+        a0[12] = (((v2 + 45) >= (v2 + 30)) + ((v3 % 1) + (a1[0][12] - v0)));
+        v2 = (((a0[3] || v1) / 4) || ((a0[6] > v2) ? (27 + v2) : (v2 <= v1)));
+        v3 = (((a0[8] * 35) + (v3 != a1[3][11])) * ((v3 - v0) % 8));
+    }
+    a1[2][5] = (((v3 ? v1 : v3) + (v3 == 7)) > ((64 || a1[3][6]) >= (93 * v3)));
+    if ((((18 ? 45 : 74) > (v3 ? 45 : 12)) + ((v1 && v2) % 1))) {
+        a0[15] = (((77 < v0) && (v2 / 5)) && ((55 == 65) ? (37 / 2) : (v3 * a1[0][2])));
+        v2 = (((v3 <= a0[1]) || (v3 % 4)) * ((a0[7] >= v2) <= (a1[1][9] > a1[2][0])));
+        v2 = (((90 ? v1 : 4) / 6) >= ((v0 ? v3 : v2) % 7));
+    } else {
+        v0 = (((a1[0][3] % 7) % 5) + ((v0 ? v0 : v2) * (v2 % 5)));
+        v0 = (((v3 == 60) + (94 != 93)) >= ((45 / 3) - (15 / 9)));
+        v0 = (((v3 <= 56) / 8) && ((v3 == 54) && (v2 != 65)));
+    }
+    return (((74 ? v3 : v0) == (3 <= v1)) ? ((v3 && 66) >= (v2 ? v2 : v0)) : ((63 * 18) >= (a1[2][13] - v3)));
+}
+int f1() {
+    int v0 = 36;
+    int v1 = 93;
+    int v2 = 50;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    a1[3][5] = (((a1[3][9] ? v3 : v3) >= (a1[1][10] ? v0 : v1)) <= ((v1 + a0[6]) >= (a0[0] != a0[0])));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v1 = (((v2 > v1) < (v1 || 20)) * ((v1 != i0) == (60 > v3)));
+        {
+            int i1 = 0;
+            do {
+                v3 = (((a0[1] >= v2) || (v2 <= a1[0][9])) <= ((79 > v3) / 9));
+                a0[10] = (((v2 % 8) % 3) / 6);
+                v1 = (((v3 % 8) != (i0 < 67)) / 8);
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        a0[11] = (((a0[11] * i0) < (v1 && a0[12])) > ((i0 * i0) < (a1[0][15] == v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a1[1][5] || v0) * (a1[2][10] - 59)) || ((v2 < v3) == (v1 < v3)));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v2 = (((i2 && a0[8]) != (14 > v2)) - ((v2 * a0[10]) || (i3 / 4)));
+                    v2 = (((v0 ? v3 : a1[2][4]) == (13 + 26)) - ((7 && 69) / 3));
+                    a0[9] = (((a1[2][10] || v3) / 1) ? ((a1[2][8] || v2) || (74 != a1[1][14])) : ((v0 == 11) > (a0[1] % 3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((v2 * 56) > (a0[11] - i2)) == ((68 <= v1) && (17 / 9)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a1[2][2] = (((a1[1][5] <= v0) && (58 || 8)) % 3);
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v1 = (((v2 > 71) % 2) ? ((45 + v3) >= (v0 < v3)) : ((73 == i5) - (v1 && v1)));
+                v1 = (((a1[1][12] ? a0[6] : v0) % 7) < ((a0[10] * a1[3][14]) % 2));
+                v3 = (((i4 ? v1 : a1[3][3]) >= (a0[3] ? a1[1][11] : a1[0][11])) - ((a1[0][2] ? v1 : a1[3][7]) ? (i5 && 47) : (a1[0][2] ? v2 : v1)));
+            }
+            a0[7] = (((v0 ? v1 : 0) + (v0 ? v0 : a0[0])) % 3);
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((v0 != v0) + (a1[1][13] || v3)) < ((78 >= 43) && (v1 > a0[8])));
+    return (((v1 < 88) != (a0[11] > a0[8])) % 4);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,194 @@
+int f0() {
+    int v0 = 86;
+    int v1 = 48;
+    int v2 = 37;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v1 = (((a0[5] / 7) + (29 % 2)) != ((i0 + v1) || (v2 * 62)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            if ((i0 || a1[3][0]) > 95) break;
+            v3 = (((a1[2][4] != v0) && (16 ? v1 : a0[4])) > ((i1 && a1[1][7]) || (0 * v2)));
+            a0[1] = (((a1[1][2] ? v0 : 34) ? (44 < v3) : (i0 > 48)) ? ((a0[0] <= a1[3][12]) ? (i1 < a0[8]) : (99 && v0)) : ((v2 != 6) ? (a0[0] + a0[1]) : (v1 * 75)));
+            v0 = (((v0 <= a0[12]) >= (a1[3][0] > 48)) > ((v0 < 72) != (i0 >= v0)));
+        }
+        v0 = (((a0[1] / 9) && (31 / 1)) - ((v2 ? 76 : 18) == (52 <= v3)));
+    }
+    a0[12] = (((v1 || 11) ? (v2 && 5) : (57 + v3)) != ((a1[0][8] / 7) * (v0 == v3)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v3 = (((29 < v1) && (v1 * a0[8])) * ((a0[5] % 9) >= (v3 - i2)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v2 = (((33 > a1[0][2]) < (a0[8] && 1)) >= ((27 != a0[14]) ? (i2 ? i3 : 6) : (v2 / 5)));
+            a0[13] = (((a0[4] || i3) && (v2 == i3)) + ((v3 == v0) != (65 && v3)));
+            a1[2][14] = (((15 / 2) <= (a1[1][1] <= a0[11])) - ((v0 - v1) ? (a1[2][14] % 6) : (i3 - i3)));
+        }
+        v0 = (((v0 * v3) >= (a1[2][2] && a0[12])) ? ((v0 > a0[4]) == (a1[1][10] || v0)) : ((a0[15] < 20) + (v0 * i2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v3 = (((i4 - v1) + (v0 != v0)) / 4);
+                v3 = (((31 ? v0 : a0[15]) ? (a1[1][0] >= v0) : (v0 * v2)) == ((36 ? v0 : a0[8]) % 7));
+                a1[2][14] = (((i4 / 3) % 6) > ((i4 - v3) % 3));
+            }
+            v1 = (((v2 ? a0[8] : a1[0][12]) % 7) / 4);
+            v1 = (((10 >= v2) / 8) ? ((76 == a1[2][14]) * (v3 + 32)) : ((67 * v0) + (a1[3][13] - 42)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    v2 = (((v0 ? v0 : 18) && (76 != v0)) != ((v3 != 32) == (93 == v2)));
+    return (((a1[1][13] ? a1[1][6] : v0) || (v0 != a0[14])) + ((a0[8] || a1[1][8]) % 7));
+}
+int f1() {
+    int v0 = 33;
+    int v1 = 5;
+    int v2 = 64;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][6] % 1) < (26 / 9)) * ((55 / 2) % 6))) {
+        a1[1][12] = (((v0 || 52) % 6) == ((a1[2][8] + v2) - (v2 % 5)));
+        v2 = (((a0[15] && 47) / 2) - ((v3 <= a1[0][10]) != (v3 == v2)));
+        v0 = (((v3 - a1[2][0]) <= (v0 / 6)) + ((54 <= 21) - (a1[2][9] ? 60 : v0)));
+    } else {
+        v3 = (((a1[1][5] && 61) != (v0 && v2)) <= ((a1[1][8] <= 57) != (v3 * v2)));
+        a0[6] = (((v0 && v2) / 5) > ((v1 * v3) > (v1 || 92)));
+        v1 = (((a1[1][1] < 67) + (v0 <= v2)) / 7);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v1 == i1) != (i0 >= v3)) - ((i1 < a0[4]) ? (a0[15] * 15) : (i1 - 56)));
+                    v0 = (((i0 < i1) <= (i1 > 63)) - ((73 && i0) * (2 - v0)));
+                    v3 = (((v0 == i1) >= (a0[6] == a1[3][0])) + ((v3 <= i1) != (v1 && 77)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((v2 <= a0[1]) - (v0 % 3)) / 8);
+            v2 = (((v1 >= a0[4]) != (i0 > v0)) && ((v0 || v2) % 5));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 <= v3) + (v1 < v2)) / 2)) {
+        v1 = (((v3 ? v3 : a1[0][5]) > (v3 ? v1 : 51)) <= ((a1[3][10] && v1) && (37 - 89)));
+        v0 = (((v1 * 99) / 7) + ((76 <= a0[9]) != (42 >= v0)));
+        a1[0][4] = (((38 == a0[15]) < (v0 == a1[2][5])) % 5);
+    } else {
+        a1[2][13] = (((a1[0][9] || 69) % 2) >= ((20 * a1[1][14]) || (30 * a0[12])));
+        v3 = (((v2 ? a1[1][3] : v0) ? (21 * a1[0][10]) : (v2 * v2)) < ((a0[3] || 45) != (v1 ? a0[4] : 89)));
+        a0[6] = (((98 || a0[11]) >= (v3 * 59)) == ((28 > v1) == (v3 <= 37)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            a0[15] = (((a1[2][0] < v3) % 3) < ((a1[3][6] && i2) < (v0 < 4)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((34 - a1[3][0]) > 96) break;
+                    v0 = (((v2 - v2) - (v2 >= a0[9])) || ((v0 != a0[8]) <= (v3 * 16)));
+                    v1 = (((a0[5] % 6) != (30 >= a0[5])) < ((88 <= 76) || (v2 * 35)));
+                    v0 = (((a0[12] != v1) / 3) >= ((v1 == i3) || (13 || v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v3 - v2) != (63 % 9)) % 2);
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v0 != 59) && (a0[12] / 9)) || ((a0[14] || v1) + (v0 % 8)));
+    return (((a1[3][14] < a0[0]) > (v3 + v0)) * ((v2 || v3) < (v2 || v3)));
+}
+int f2() {
+    int v0 = 84;
+    int v1 = 32;
+    int v2 = 86;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((i0 >= 25) > 56) break;
+        {
+            int i1 = 0;
+            do {
+                v1 = (((31 - 70) < (v0 && v2)) ? ((a1[3][15] % 7) - (i1 * v0)) : ((a0[15] + v3) >= (75 ? i1 : i0)));
+                v0 = (((v1 > a0[15]) + (v2 * v2)) < ((i0 + v1) > (56 + v1)));
+                a0[7] = (((i0 >= i0) + (52 % 1)) + ((v1 * a0[6]) > (46 && i0)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v2 = (((55 * v2) >= (v0 % 2)) - ((i0 * a0[15]) >= (66 ? v1 : v2)));
+        a0[5] = (((v3 < a1[3][1]) < (v1 + 67)) < ((v3 != v1) != (50 + i0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a0[10] != v0) || (a1[3][2] == a1[0][7])) < ((i2 > i2) % 5));
+            v3 = (((v3 != 72) != (v1 ? v3 : 7)) && ((i2 + v2) || (v2 < 75)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v0 = (((v2 && i3) >= (94 % 9)) * ((v0 ? v1 : i3) || (a0[4] >= v0)));
+                    v1 = (((v0 + 39) ? (a0[13] * i2) : (v3 <= v0)) ? ((i3 ? 1 : a0[6]) - (v0 - i3)) : ((i3 != v3) && (i2 ? 35 : a1[0][5])));
+                    a0[7] = (((91 >= i2) >= (v3 ? v3 : v1)) != ((18 ? v1 : v3) % 7));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((v3 < 36) >= (51 ? a1[1][9] : 39)) <= ((v0 * v1) == (a0[5] <= v1)))) {
+        v1 = (((31 && v0) - (22 == v3)) ? ((59 != v3) / 2) : ((a0[8] + 24) < (v0 <= v3)));
+        a1[0][12] = (((a0[1] ? v1 : a0[13]) > (a0[1] < v3)) ? ((38 > v0) > (v2 + v2)) : ((a1[1][13] != v1) ? (a0[11] != v3) : (v3 != a1[2][6])));
+        v3 = (((a1[2][5] % 6) ? (v0 + a1[0][6]) : (v3 != v0)) == ((19 ? 4 : v0) - (82 / 2)));
+    } else {
+        v2 = (((v3 / 6) / 3) > ((33 < a0[8]) && (v3 / 5)));
+        v0 = (((v2 >= v2) ? (v2 ? 83 : 72) : (17 == v2)) <= ((v1 <= v1) ? (v1 / 3) : (v3 ? v0 : v3)));
+        v2 = (((a1[1][5] >= a0[1]) * (a0[9] - 32)) <= ((v2 - a1[2][13]) - (v2 || a0[7])));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a1[3][14] * v2) > 61) break;
+            v1 = (((53 - i4) % 7) + ((i4 && 86) - (37 >= v0)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((a0[14] < a1[2][5]) > 84) break;
+                    v1 = (((41 % 1) / 4) ? ((v0 <= v1) / 9) : ((61 * 8) || (v0 - i5)));
+                    a1[0][15] = (((48 % 7) || (a1[0][7] / 7)) != ((v2 ? 89 : v1) || (0 >= v3)));
+                    a1[3][8] = (((a1[3][13] + a0[15]) >= (a1[3][0] / 5)) ? ((v0 * i4) || (v1 % 4)) : ((39 - 19) > (92 * i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v3 ? a1[1][7] : a0[15]) <= (a0[12] <= v0)) == ((v0 || a1[1][1]) - (v2 % 1)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v3 = (((i7 == v0) / 4) <= ((i7 * v3) ? (a0[3] - 94) : (i6 == v3)));
+                a1[2][5] = (((97 * v2) / 8) || ((v1 <= a1[2][8]) + (a1[3][6] >= v3)));
+                v0 = (((v2 || a1[2][11]) ? (v0 + a1[2][4]) : (i6 ? a0[1] : i6)) && ((v3 && 85) ? (i6 < v0) : (39 <= a1[3][0])));
+            }
+            v1 = (((40 * v3) + (v2 ? v0 : a0[15])) ? ((v3 * v1) - (v1 * a1[0][2])) : ((v3 == v0) != (v1 % 3)));
+            v3 = (((v1 && v2) / 5) && ((v2 - v2) <= (a1[3][12] < v2)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v1 < v1) > (v0 || v0)) >= ((v3 >= v0) >= (v3 + v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
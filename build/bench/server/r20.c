@@ -0,0 +1,177 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 43;
+    int v2 = 36;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a0[4] = (((a0[10] ? 13 : 82) * (v1 ? a0[0] : 59)) ? ((13 < i1) / 6) : ((45 + a1[2][10]) - (90 == v2)));
+                    v0 = (((v0 ? a1[1][6] : a0[5]) && (v0 < a0[10])) < ((v3 ? a1[1][14] : 91) <= (2 == i0)));
+                    v2 = (((a1[2][7] ? v3 : a0[14]) / 7) <= ((v2 / 9) != (i1 ? v1 : v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[1] = (((v3 || a0[3]) != (i0 && a1[3][13])) || ((a0[6] - a1[1][11]) == (v1 != v0)));
+            v0 = (((v3 ? a1[0][3] : v3) + (86 <= 28)) + ((v2 + v1) + (a0[3] - v3)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 && v3) > 70) break;
+            v2 = (((i2 * v3) < (v0 / 7)) != ((97 + v3) > (a0[3] - a1[3][3])));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((27 * i3) > 98) break;
+                    v2 = (((i3 > v0) - (41 % 4)) % 2);
+                    v2 = (((18 % 7) <= (a0[8] / 3)) ? ((v1 || i3) * (45 / 4)) : ((v1 == a1[1][10]) - (74 || a1[1][6])));
+                    a1[0][9] = (((i3 && 25) ? (a1[0][13] ? v3 : i3) : (a0[11] <= i2)) >= ((92 + i3) <= (2 / 6)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a1[1][1] % 7) - (i2 + a0[12])) < ((i2 * 73) >= (a0[1] && 74)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v0 = (((69 * a0[1]) != (v3 >= v2)) >= ((v3 / 3) == (37 / 4)));
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((a0[15] < i4) > 59) break;
+        v1 = (((30 <= a1[2][15]) && (v0 >= 87)) != ((73 || 63) != (94 + v1)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                a1[3][7] = (((a0[9] - v0) - (33 ? v1 : v0)) <= ((v3 ? 37 : 50) - (46 + a1[3][6])));
+                v3 = (((v3 || v2) <= (v1 <= i4)) * ((v0 ? v2 : a1[3][5]) || (96 ? 93 : 57)));
+                v0 = (((v2 - v2) == (22 % 3)) + ((v3 != v3) - (v2 - i5)));
+                i5 = i5 + 1;
+            }
+        }
+        v1 = (((i4 == a1[1][10]) % 8) <= ((i4 || v1) * (v2 ? a1[0][10] : i4)));
+    }
+    if ((((a0[10] - 2) > (73 / 4)) % 5)) {
+        v0 = (((61 + v3) ? (v3 || a0[10]) : (v3 > 82)) < ((v1 >= a0[15]) / 5));
+        a1[0][8] = (((v1 >= a1[3][9]) == (a0[9] ? 60 : a0[11])) / 3);
+        a1[0][3] = (((a1[1][9] - 17) % 1) >= ((a0[13] != 64) ? (v1 + v1) : (v2 == 61)));
+    } else {
+        a1[1][0] = (((v2 || 59) * (v0 > v3)) && ((v3 % 3) % 1));
+        v1 = (((a1[1][6] != a1[3][1]) && (a0[15] * v0)) - ((83 && v0) > (v1 ? v2 : v1)));
+        v2 = (((v0 / 9) && (v0 <= v3)) == ((97 && a1[0][10]) || (25 <= 75)));
+    }
+    return (((89 ? v3 : v3) / 5) ? ((a0[2] > v2) && (v0 <= v0)) : ((a0[7] / 8) < (v1 * v0)));
+}
+int f1() {
+    int v0 = 88;
+    int v1 = 53;
+    int v2 = 55;
+    int v3 = 5;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v2 = (((v2 ? 9 : v2) && (a0[3] ? a0[13] : v3)) + ((i0 ? v2 : i0) / 5));
+                v3 = (((v0 < i0) * (59 - a0[4])) ? ((1 ? v0 : 36) < (13 * 81)) : ((a1[2][14] == i0) ? (27 + 71) : (v1 && a1[1][7])));
+                v1 = (((66 * 89) / 4) % 6);
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        a0[12] = (((a1[3][12] || v3) / 2) != ((a0[12] && v0) == (i0 ? i0 : v1)));
+        v3 = (((v3 / 8) >= (v3 <= 29)) && ((v2 ? 90 : v3) <= (v1 <= a0[3])));
+    }
+    v3 = (((86 && 78) <= (v0 / 5)) ? ((a0[7] > a1[1][11]) < (a0[12] > v1)) : ((v3 > v1) && (v0 || 19)));
+    v3 = (((a1[1][12] >= v2) > (a1[0][12] <= a0[13])) - ((v2 == 68) > (a0[4] >= a1[2][15])));
+    a1[3][10] = (((v3 <= 12) ? (v0 && v2) : (0 / 3)) * ((a1[2][3] + v0) != (v3 != 39)));
+    if ((((v1 || a1[3][1]) + (v3 ? v2 : v0)) >= ((v2 == v3) <= (36 + 1)))) {
+        a1[0][0] = (((v1 > v0) ? (v3 < 60) : (6 > 29)) * ((20 ? 72 : v2) && (v3 + v2)));
+        v3 = (((v0 != 7) != (a0[5] > v3)) < ((v1 % 1) ? (v3 >= 98) : (a1[0][2] > a1[2][13])));
+        a1[2][1] = (((v2 < v1) && (23 ? 89 : a1[0][9])) && ((v3 == v3) == (74 == v2)));
+    } else {
+        v3 = (((v2 % 7) == (a0[2] == v3)) ? ((v2 || v1) * (v2 == v1)) : ((v1 >= 85) ? (v2 % 1) : (a0[6] != a1[0][13])));
+        v0 = (((87 * v0) - (93 ? 30 : v2)) < ((v1 == v1) >= (a0[14] < a1[3][13])));
+        v3 = (((v1 >= v0) <= (v2 != v2)) && ((44 >= a1[0][10]) - (70 >= v3)));
+    }
+    return (((a0[3] != a1[1][15]) || (a0[3] + a0[1])) || ((7 <= a0[1]) - (a1[3][0] >= v2)));
+}
+int f2() {
+    int v0 = 37;
+    int v1 = 51;
+    int v2 = 80;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v1 < 14) != (v2 ? 10 : 87)) > ((v2 < v0) * (a1[3][4] >= v3)));
+            v3 = (((v1 >= v2) <= (v0 && a1[0][10])) > ((v3 <= a1[3][3]) * (35 % 3)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((78 + 19) || (v1 * a0[9])) % 2);
+                    v1 = (((v2 >= v2) ? (i1 ? i1 : v1) : (v0 - 27)) && ((v2 || 67) || (v3 + v2)));
+                    v2 = (((v3 + v1) + (i1 + v1)) != ((15 < v2) * (a1[1][1] < v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((66 < v0) > 73) break;
+            a0[8] = (((v0 - 50) ? (92 % 9) : (51 ? v3 : i2)) < ((25 % 1) ? (a1[2][9] % 1) : (i2 * v3)));
+            v1 = (((55 + a1[2][4]) / 8) % 1);
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v2 = (((a1[0][15] - 29) <= (i3 == a0[15])) - ((69 + a0[15]) - (i2 <= 35)));
+                a0[6] = (((i2 - v2) % 9) >= ((a0[10] % 3) >= (i2 >= a0[5])));
+                v1 = (((67 && i3) ? (i2 / 1) : (81 % 8)) * ((v1 != a0[5]) ? (99 < v1) : (v1 < v1)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a0[7] = (((a0[11] - 99) / 5) / 2);
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            v3 = (((i5 % 2) - (9 == a0[14])) || ((36 % 9) < (97 * 7)));
+            v2 = (((v2 || v3) >= (v1 + 54)) >= ((v3 <= i4) * (i4 != v0)));
+            v1 = (((69 && a0[5]) != (19 / 7)) / 8);
+        }
+        a0[5] = (((v0 % 9) * (a0[12] * v0)) != ((a0[1] / 3) > (v0 >= v2)));
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        v2 = (((56 - 14) < (58 >= v1)) / 8);
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            v2 = (((v3 * v1) ? (72 ? v1 : v3) : (i7 % 8)) ? ((v1 >= 40) || (44 > a1[1][8])) : ((i7 * 48) < (28 + a0[1])));
+            v3 = (((v3 + 73) ? (i6 ? 34 : i6) : (34 == 23)) < ((i6 > v0) * (a0[14] % 9)));
+            v0 = (((v1 * i6) >= (65 || i6)) < ((36 + v0) * (a1[0][12] >= v3)));
+        }
+        v1 = (((91 * v0) >= (i6 || v1)) - ((v0 > v1) && (a1[2][8] ? v3 : 98)));
+    }
+    if ((((v2 > 35) < (a0[11] + v3)) <= ((a1[0][0] ? v1 : v1) < (v2 >= a1[2][8])))) {
+        a1[1][5] = (((v2 / 8) >= (v3 < v0)) - ((34 < v1) * (v0 / 1)));
+        v3 = (((v0 && v2) || (a0[15] < v2)) / 1);
+        v2 = (((v1 ? v1 : a0[2]) <= (37 && v1)) < ((69 + v2) >= (v0 >= a1[1][1])));
+    } else {
+        v0 = (((v2 ? a0[15] : v0) >= (61 ? v1 : 43)) == ((v1 / 9) > (v3 >= 31)));
+        a1[2][11] = (((v2 && v1) / 9) ? ((v1 + v2) != (1 ? v3 : v1)) : ((a0[5] && a1[3][0]) * (v3 >= v1)));
+        v1 = (((a0[7] * v1) != (v1 != v3)) ? ((v2 * v0) ? (v3 <= v2) : (v2 % 8)) : ((v2 >= v2) != (a1[2][4] ? v1 : 61)));
+    }
+    return (((32 ? 33 : v1) && (a0[12] == 72)) + ((v1 && 59) ? (a0[15] / 3) : (v0 % 3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,173 @@
+int f0() {
+    int v0 = 12;
+    int v1 = 37;
+    int v2 = 48;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v0 <= a0[8]) > (25 * v1)) && ((18 - v2) ? (7 ? 35 : i0) : (i0 && 56)));
+                    a0[14] = (((a0[6] ? i0 : 37) != (i0 - v2)) + ((72 ? a0[2] : 60) ? (v0 == v2) : (i1 > 76)));
+                    a1[0][5] = (((58 < 31) * (a0[1] != v0)) * ((a1[2][1] > 4) - (v2 + i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            a0[12] = (((v2 + 70) - (a0[4] / 3)) ? ((a0[11] || v0) < (a1[3][14] && 84)) : ((80 ? a0[1] : v0) < (38 ? i0 : a1[2][9])));
+            a1[0][4] = (((v3 || v3) == (i0 ? v2 : a0[15])) <= ((v3 ? v0 : v0) - (75 % 2)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((91 >= v3) + (a0[13] >= a0[8])) - ((45 - a1[2][14]) && (i2 % 7)));
+            a0[15] = (((v2 || 49) != (25 ? v3 : 17)) ? ((v3 && v0) <= (i2 % 7)) : ((a0[6] < a0[6]) ? (61 > v3) : (a0[4] - v0)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((37 != 85) >= (v1 != a0[3])) < ((36 % 7) / 1));
+                    a1[0][15] = (((a0[10] - a0[3]) + (a0[15] + i3)) <= ((a0[9] != 48) && (v1 && i3)));
+                    v0 = (((i2 == 1) == (a1[1][2] / 8)) && ((i3 * v2) == (32 % 6)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((v3 ? 9 : 67) == (v2 + 72)) != ((a1[0][8] == a1[0][2]) > (v3 < v3)))) {
+        v2 = (((v3 != 82) * (v2 - 80)) < ((v0 - v2) <= (63 != 29)));
+        v2 = (((76 * v3) ? (v0 + 79) : (v0 || v3)) + ((v0 / 9) != (70 && v3)));
+        a0[6] = (((a1[1][11] ? v2 : v3) / 3) == ((79 / 3) <= (v3 ? v0 : v3)));
+    } else {
+        a0[5] = (((35 == a0[15]) >= (a1[0][1] >= v3)) == ((v3 == v2) + (a1[1][1] && a1[0][14])));
+        v1 = (((99 && 10) + (v1 - 86)) != ((v0 * a0[9]) >= (v1 && v3)));
+        v1 = (((a0[11] + v2) >= (v3 || a1[2][10])) <= ((a0[3] < v0) % 8));
+    }
+    a1[2][13] = (((v1 < v1) != (v3 == v3)) ? ((46 || v1) <= (v2 ? a1[2][1] : 93)) : ((v0 < 16) * (v2 % 7)));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v0 = (((23 * v2) - (a0[9] != 34)) == ((v1 - i4) % 7));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    if ((86 + a1[0][4]) > 89) break;
+                    a1[3][3] = (((90 || i4) == (v0 ? v0 : v0)) <= ((73 % 3) > (v3 ? v3 : a1[0][5])));
+                    v3 = (((a0[0] >= i4) * (52 + a1[2][0])) + ((i4 || a1[2][3]) ? (a1[2][3] / 4) : (v1 * 28)));
+                    v2 = (((i5 || v2) && (10 && i4)) && ((v2 > a0[11]) * (92 >= a1[0][0])));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((i4 - a0[10]) || (i4 || v2)) || ((25 != 85) <= (v0 > a0[12])));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v0 && a0[2]) > (a1[1][14] / 2)) * ((v3 > 3) ? (a0[2] && 40) : (v3 * a0[15])));
+}
+int f1() {
+    int v0 = 77;
+    int v1 = 3;
+    int v2 = 7;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    a0[3] = (((76 ? v1 : v1) && (v1 ? v1 : v1)) ? ((v3 < a0[10]) && (v0 || a1[3][10])) : ((v0 + v3) > (v1 ? a1[1][15] : a1[1][9])));
+    if ((((v3 / 5) * (v3 + v0)) ? ((v2 <= a1[0][4]) >= (v0 - 52)) : ((v3 < 82) + (v3 + v2)))) {
+        v0 = (((v2 > v1) + (a0[14] - 43)) == ((v0 != 23) == (v3 + v3)));
+        v1 = (((v0 < a0[14]) >= (v1 && a0[3])) < ((v0 ? 0 : v3) + (a0[8] > v3)));
+        v0 = (((a0[12] != v3) >= (v1 / 4)) >= ((v0 ? 68 : v3) - (a1[2][4] == v1)));
+    } else {
+        v0 = (((v1 * v0) ? (v1 ? 18 : v3) : (96 ? 96 : 77)) <= ((18 || v0) <= (v1 - 83)));
+        v0 = (((a0[10] <= v1) || (80 - v1)) ? ((v3 != 73) >= (v0 < v0)) : ((80 ? 39 : v2) % 8));
+        v0 = (((v1 || 42) > (v2 <= v2)) * ((v3 % 6) > (v1 / 8)));
+    }
+    if ((((60 ? v3 : v1) < (78 == a1[1][4])) || ((v1 >= 61) ? (v2 * 15) : (v1 && 33)))) {
+        a1[3][9] = (((v0 <= a1[1][8]) <= (67 <= a1[1][6])) - ((a1[1][12] % 5) > (v1 != v2)));
+        a0[12] = (((v3 % 9) / 2) - ((a0[3] + 87) ? (v3 || v0) : (v2 && v2)));
+        v3 = (((v1 && 69) - (v2 >= 99)) ? ((28 == v0) - (a1[0][4] + v3)) : ((a1[2][5] ? a0[3] : a1[2][12]) % 5));
+    } else {
+        v3 = (((a1[2][9] > a0[11]) <= (v1 % 7)) * ((18 * a1[3][15]) == (v3 < 6)));
+        v2 = (((a1[0][6] >= v3) - (19 * a0[9])) && ((v3 + v3) > (95 % 3)));
+        v0 = (((a1[1][7] * v2) && (32 ? v2 : v0)) && ((60 < v3) < (12 == v0)));
+    }
+    if ((((v3 % 6) ? (70 <= v0) : (v3 / 7)) == ((79 || 8) + (v0 / 5)))) {
+        v3 = (((v0 < v0) == (a0[0] ? v2 : v0)) || ((v1 * a1[2][13]) / 9));
+        v1 = (((v3 != a1[1][6]) == (v0 >= a0[6])) * ((94 / 5) - (a1[2][14] || v0)));
+        v2 = (((59 <= a1[3][13]) - (a1[0][7] < a1[0][12])) ? ((v1 ? a0[0] : v3) + (a1[0][14] >= v1)) : ((90 ? 48 : a1[2][14]) / 2));
+    } else {
+        v1 = (((v0 && a1[0][4]) + (a0[12] > v0)) < ((a0[1] || v0) && (a0[14] <= 57)));
+        v1 = (((v1 % 1) || (v3 - v0)) * ((v1 / 9) && (50 ? v1 : v1)));
+        v0 = (((a0[7] != 17) >= (a1[2][2] % 1)) == ((v0 - 10) ? (96 + 50) : (a1[1][3] + 54)));
+    }
+    v3 = (((v0 - 51) && (v2 > 67)) > ((v3 <= v0) + (a0[13] ? v0 : v2)));
+    return (((v1 >= a1[3][2]) > (v1 / 3)) != ((v1 ? a0[13] : 44) != (14 ? v3 : a1[2][1])));
+}
+int f2() {
+    int v0 = 0;
+    int v1 = 82;
+    int v2 = 64;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((21 < v2) ? (i0 * 85) : (a1[0][15] > i0)) || ((22 % 3) == (v3 && 38)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((v1 <= a0[4]) > 61) break;
+                a1[0][1] = (((i0 || 71) > (i0 % 9)) || ((i1 >= v2) > (i1 >= 11)));
+                v2 = (((i0 ? i1 : 68) < (90 || i1)) / 1);
+                v1 = (((i1 * i0) == (a1[2][5] + i1)) + ((i0 < a0[0]) ? (v3 > v3) : (v0 / 5)));
+            }
+            v1 = (((v1 > v3) < (v2 ? i0 : 0)) + ((v1 <= a0[6]) % 9));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[14] < 10) > 58) break;
+            a0[1] = (((31 + i2) >= (v0 > a1[0][11])) ? ((70 || i2) ? (73 / 1) : (v0 && 63)) : ((92 * a0[5]) == (50 != 78)));
+            {
+                int i3 = 0;
+                do {
+                    if ((v3 % 3) > 70) break;
+                    v1 = (((a0[12] <= i2) < (v0 ? a1[0][7] : i3)) || ((i3 / 4) && (v0 / 5)));
+                    v3 = (((a1[1][7] * v1) || (a0[4] % 4)) + ((v1 ? i2 : v3) >= (i2 % 6)));
+                    v1 = (((25 <= 0) + (v2 ? v1 : 77)) / 5);
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a0[7] = (((a0[7] && i2) && (v1 <= v0)) * ((v0 + 48) + (v3 - a0[0])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v1 = (((v1 != v3) != (v1 ? 44 : a1[0][10])) ? ((a0[2] <= v0) ? (v3 || v3) : (v3 <= v1)) : ((a0[14] < a1[0][7]) >= (a1[3][7] % 6)));
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        a1[3][8] = (((i4 <= v2) != (39 || a0[3])) % 7);
+        v0 = (((v2 > i4) % 7) - ((64 % 8) != (v1 || a1[2][14])));
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v0 = (((v1 && i5) != (v3 - a1[3][8])) * ((i5 % 4) ? (80 > a0[6]) : (i4 / 6)));
+            v0 = (((i4 / 3) != (a0[11] * v3)) ? ((54 == a1[2][2]) == (i5 / 6)) : ((68 + 22) || (a1[0][7] != 91)));
+            v1 = (((i5 == v2) >= (15 == 51)) == ((53 * v2) == (22 != v0)));
+        }
+    }
+    if ((((89 <= 34) || (v3 == v3)) || ((a1[3][4] != 4) || (v2 || v3)))) {
+        v1 = (((8 >= 91) || (a0[2] / 9)) * ((v1 || 53) + (27 * 84)));
+        a0[0] = (((47 <= v2) / 5) % 2);
+        v0 = (((a1[2][12] < 61) > (v2 != v1)) - ((v0 / 1) % 7));
+    } else {
+        a1[1][12] = (((v1 <= v3) > (67 / 5)) > ((81 ? v2 : a1[3][9]) == (v3 && v0)));
+        v0 = (((v1 || a0[7]) && (a1[3][13] ? a0[2] : a0[14])) >= ((v0 || v3) ? (v0 >= v0) : (v3 % 8)));
+        v2 = (((10 != v0) / 8) && ((a1[0][5] ? a1[0][10] : v2) < (v0 - 55)));
+    }
+    return (((v3 - v3) / 1) * ((37 % 9) < (v2 != v1)));
+}
+int main() {
+    return 0;
+}
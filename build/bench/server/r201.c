@@ -0,0 +1,95 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 59;
+    int v2 = 36;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a0[4] >= 31) < (30 == v3)) < ((a0[3] - 64) - (v0 <= a1[2][8])));
+                    a1[3][15] = (((a0[8] || i1) - (v1 > i0)) + ((v0 || a0[6]) >= (v3 <= v0)));
+                    v3 = (((a1[1][5] + 7) != (49 > v1)) - ((a1[2][3] ? v3 : i0) != (10 / 9)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a0[3] = (((v0 * i0) % 1) <= ((a0[5] == 62) > (a0[1] - v0)));
+            a0[3] = (((v2 > 9) <= (v3 == v3)) % 9);
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[1][9] ? a0[3] : a0[10]) > 88) break;
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v0 = (((a1[2][12] % 1) > (i3 ? a0[6] : a0[6])) * ((a0[8] <= a1[1][3]) || (v3 || a0[1])));
+                    a0[6] = (((a0[15] % 5) * (9 <= a1[2][3])) - ((a0[9] == v1) || (v2 ? v3 : 70)));
+                    v3 = (((89 <= a0[0]) || (i2 * 13)) || ((i2 <= v0) / 4));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v0 % 8) >= (v1 ? a0[4] : v1)) != ((v3 % 5) + (a1[2][3] <= v0)));
+            v0 = (((69 ? v3 : 60) || (72 ? v2 : 26)) - ((14 / 3) ? (a1[0][14] || 93) : (a0[4] * 8)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((v3 ? a0[4] : v1) / 8) < ((v0 + v1) - (68 >= 43)));
+            a1[1][10] = (((58 == v0) && (31 - v1)) * ((v2 + a0[11]) > (v1 != a1[3][7])));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v1 = (((a1[2][5] >= 23) < (v2 * 40)) <= ((a1[0][14] >= a1[0][5]) != (a1[0][10] < v3)));
+                    a1[1][0] = (((a1[1][11] < v2) * (a1[2][1] * i5)) || ((v1 / 4) - (v3 && a1[1][14])));
+                    v0 = (((i5 != v1) * (v0 || i4)) <= ((v3 || i5) % 5));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            if ((a1[3][5] - v2) > 94) break;
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v0 = (((v3 ? i7 : 87) && (a0[11] + a0[0])) || ((v1 / 2) ? (v3 && a1[2][1]) : (v0 > i6)));
+                v1 = (((v2 > i6) == (72 ? i6 : v1)) % 3);
+                v2 = (((74 != a1[0][15]) ? (a0[4] != v2) : (v1 / 9)) ? ((a0[11] >= a1[3][15]) >= (v1 <= 17)) : ((i7 == v0) ? (60 == a0[13]) : (a0[1] >= a1[3][11])));
+            }
+            a1[1][11] = (((3 / 8) ? (a0[13] < v2) : (a0[2] / 2)) % 5);
+            a1[1][2] = (((57 || 58) / 9) * ((a0[15] <= a0[11]) / 5));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v1 = (((v2 != a0[3]) - (v0 / 2)) * ((v3 / 9) == (v3 && i8)));
+            v3 = (((83 != v1) != (a0[7] ? 99 : i8)) ? ((a0[2] != v2) >= (6 > 56)) : ((91 && i8) < (a1[2][4] == v1)));
+            {
+                int i9 = 0;
+                while (i9 < 3) {
+                    a1[0][2] = (((82 <= v3) >= (80 != a0[0])) ? ((v1 > i9) - (12 + v1)) : ((v2 ? i9 : 60) >= (19 || i8)));
+                    v0 = (((3 ? 46 : a1[3][0]) == (i8 ? i8 : a1[3][3])) + ((46 ? v2 : i9) ? (v1 / 3) : (i8 < v3)));
+                    a1[3][8] = (((83 > v3) <= (i8 * i9)) > ((v2 / 9) * (a0[5] + a1[2][15])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 3);
+    }
+    return (((50 >= v0) <= (55 % 9)) == ((56 * a0[4]) - (v0 != a1[3][8])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,118 @@
+int f0() {
+    int v0 = 20;
+    int v1 = 45;
+    int v2 = 80;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((v3 + v2) > 59) break;
+        a0[6] = (((54 != 33) * (v3 / 3)) < ((v3 >= a1[1][2]) - (v2 >= 52)));
+        v1 = (((v2 != 2) != (v0 % 4)) >= ((v3 ? v1 : 89) < (25 != v2)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v1 = (((v2 || a0[12]) != (94 >= v0)) < ((70 < v2) - (a1[0][9] > v1)));
+            v3 = (((85 / 5) >= (i1 - a1[0][6])) + ((a1[2][12] + a0[8]) ? (a1[1][4] >= v0) : (a0[15] ? i0 : i0)));
+            v2 = (((v3 >= 30) ? (a1[3][15] ? v1 : v3) : (v3 * a1[3][11])) || ((31 + 89) - (a0[5] ? v2 : v0)));
+        }
+    }
+    v3 = (((v0 && v2) || (a0[4] == a1[1][14])) && ((v1 - 71) > (v3 && v0)));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a1[0][11] = (((v3 && v0) == (a0[15] ? v2 : 77)) <= ((v2 > 72) != (v0 != i3)));
+                v3 = (((56 * 35) / 8) + ((a0[9] + i2) > (i2 >= v3)));
+                a0[1] = (((i2 > v1) < (v2 / 5)) - ((i2 != 69) >= (v3 >= v2)));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        v0 = (((v0 < 13) ? (v0 != 97) : (i2 == a0[1])) == ((v0 < 71) > (i2 % 3)));
+        v0 = (((a0[14] % 2) || (a1[2][1] == a0[12])) + ((a0[14] == i2) % 9));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((v0 != 71) > 61) break;
+            {
+                int i5 = 0;
+                do {
+                    a1[1][4] = (((i5 <= a1[3][6]) / 7) / 1);
+                    v0 = (((a1[2][3] >= a0[5]) < (61 + v3)) % 4);
+                    v0 = (((v0 == 15) >= (v1 ? v0 : i4)) != ((v3 && v0) == (82 || a1[3][0])));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v1 = (((v2 != 76) ? (24 ? v3 : v1) : (v2 || a0[10])) <= ((a1[2][8] + v2) && (i4 < v2)));
+            v0 = (((v2 != v0) <= (16 > v1)) % 8);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 && v3) >= (73 >= v2)) || ((v1 <= v0) * (v2 < 32)))) {
+        v3 = (((64 ? v2 : v0) <= (v1 != a0[1])) && ((v1 - v0) || (v2 >= a0[5])));
+        v2 = (((v1 || v1) / 1) == ((v0 * a1[0][10]) || (v0 >= v3)));
+        v1 = (((v0 ? v0 : v1) && (v2 / 6)) ? ((v3 ? v3 : v0) / 4) : ((a1[2][10] >= 52) < (v1 == v0)));
+    } else {
+        a1[3][14] = (((v2 - v1) - (38 > v3)) * ((v1 && v2) < (a1[1][15] * v1)));
+        a0[6] = (((v1 > 74) * (v0 == 60)) % 4);
+        v3 = (((16 ? 74 : 84) + (a0[7] || v3)) > ((10 || v0) && (v1 ? 71 : v1)));
+    }
+    return (((v3 < 3) ? (v2 <= a0[6]) : (a1[3][8] ? 82 : a1[3][12])) * ((a1[1][12] * a0[14]) <= (a1[1][9] * v3)));
+}
+int f1() {
+    int v0 = 4;
+    int v1 = 56;
+    int v2 = 53;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    if ((((9 > v1) ? (36 - v3) : (a1[0][9] + a0[4])) * ((a1[1][0] || v0) * (v0 ? a0[14] : 24)))) {
+        a0[4] = (((35 >= v3) || (v0 <= 75)) >= ((a0[11] >= a0[4]) * (v3 - 44)));
+        v2 = (((v2 * a0[3]) == (v3 ? a0[3] : 72)) + ((5 % 8) - (v2 <= 82)));
+        v1 = (((v1 && v1) >= (a1[3][13] ? v2 : 98)) + ((78 == v2) && (39 && a1[1][6])));
+    } else {
+        v1 = (((a1[2][4] / 8) <= (v0 * 61)) >= ((a0[0] == v2) * (83 ? v3 : a1[3][3])));
+        v3 = (((59 == a0[0]) >= (v0 ? a1[0][0] : 27)) - ((90 ? 25 : v0) == (a0[6] + v3)));
+        v3 = (((48 - v3) - (99 / 4)) ? ((34 != a0[14]) && (a0[13] ? a1[0][12] : a1[1][15])) : ((a1[3][10] > v0) ? (v1 ? v0 : v2) : (v0 ? v1 : v2)));
+    }
+    v2 = (((v1 == a1[0][6]) == (v2 < v1)) > ((a0[15] == v3) == (v3 == 74)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((75 ? a1[0][13] : v3) > 98) break;
+                    v2 = (((i1 < i1) * (3 == v2)) % 4);
+                    v2 = (((19 >= a1[3][0]) % 3) >= ((v1 < v2) - (v1 >= a0[4])));
+                    a1[0][12] = (((v3 > 14) && (i0 + v1)) != ((v1 > i0) > (v0 > 17)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((63 != v1) && (v3 / 4)) && ((9 - 69) && (v3 - 81)));
+            a0[2] = (((28 ? 55 : v0) == (v1 && 70)) == ((a0[2] != v0) ? (v2 != v3) : (v1 < v0)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v1 = (((a0[11] ? v1 : 91) >= (v1 > v2)) * ((72 || a0[6]) * (a1[3][9] / 1)));
+        v2 = (((7 < 19) != (i2 ? v0 : 84)) - ((v1 != v2) > (a1[1][12] >= v0)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a0[4] = (((v3 > v2) < (v0 ? v1 : v2)) && ((i3 + i2) / 2));
+            v1 = (((12 * a1[3][15]) + (70 <= 85)) < ((30 % 5) < (a1[3][4] && i2)));
+            v1 = (((a1[3][10] + 8) ? (57 + v0) : (v0 ? a1[1][2] : 95)) > ((a1[1][9] || 82) >= (a0[13] > a1[1][4])));
+        }
+    }
+    if ((((58 != 17) % 7) % 3)) {
+        a1[2][12] = (((v2 > 47) || (v1 > v2)) == ((a1[3][10] ? v3 : a0[2]) && (a1[3][0] != v0)));
+        a0[15] = (((v2 * v2) <= (v3 >= a1[2][5])) / 8);
+        v3 = (((94 - a1[2][14]) > (v0 - a1[1][14])) != ((v2 / 6) * (a1[1][7] <= a1[3][6])));
+    } else {
+        v2 = (((97 + 5) > (v2 * a0[12])) ? ((v1 ? v0 : v0) > (92 ? a1[1][2] : 63)) : ((v0 != a0[11]) ? (v3 ? v3 : 33) : (v1 ? v1 : v0)));
+        v2 = (((a0[1] > v1) / 9) * ((a1[3][12] >= a0[3]) ? (v3 < 32) : (18 % 8)));
+        v3 = (((29 != 69) || (a0[8] != v3)) ? ((v3 && v0) - (50 + 4)) : ((a1[1][15] + v0) + (70 ? a1[2][1] : v1)));
+    }
+    return (((v3 + v3) >= (a1[3][14] / 5)) > ((a0[11] <= v2) > (v1 * v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,218 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 24;
+    int v2 = 65;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((39 / 7) > 88) break;
+                    v2 = (((22 || v2) != (v0 / 2)) / 8);
+                    v2 = (((a0[3] ? 77 : 83) * (a0[8] >= 28)) + ((a1[2][12] || a0[6]) > (v1 - a0[15])));
+                    v0 = (((i1 * v1) == (81 / 8)) != ((v1 && v1) / 6));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v3 % 1) - (i0 || v1)) ? ((a0[11] <= a1[0][15]) < (a0[15] <= a0[12])) : ((v1 ? i0 : a0[11]) - (60 == a0[1])));
+            v3 = (((a0[5] || i0) == (a0[6] < i0)) / 8);
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v1 = (((v1 ? v1 : 57) * (v3 == v0)) >= ((v2 > v0) != (91 < 75)));
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v2 = (((1 * v3) != (85 >= v0)) - ((v0 > v0) ? (a1[0][15] < a1[0][13]) : (a1[0][7] - a1[2][4])));
+            a1[2][2] = (((53 < 62) >= (v3 - v3)) || ((v2 > v0) || (v3 < a0[13])));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v2 = (((i2 % 2) ? (v2 ? 17 : v1) : (i3 ? v3 : v2)) ? ((i3 * 36) < (a1[0][6] || i2)) : ((a1[0][1] >= v1) * (i2 || v1)));
+                    v1 = (((7 != a0[6]) % 8) || ((v3 >= i2) * (v3 + i2)));
+                    v0 = (((v0 && a1[0][2]) == (i3 * i2)) * ((v1 < v0) * (a1[1][2] > v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v2 > 67) ? (v0 - v3) : (a1[1][6] % 4)) / 6);
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v3 = (((a1[2][1] && v0) * (v3 ? v2 : a1[1][15])) < ((v1 == v3) <= (28 < v0)));
+            v0 = (((v0 + v3) != (i4 * v3)) && ((58 > 76) > (i4 != v0)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v2 = (((a0[12] - a0[15]) >= (v1 ? i5 : a0[5])) ? ((61 && 64) ? (a0[12] > 32) : (i4 ? a0[4] : v0)) : ((v2 == v3) % 6));
+                    v0 = (((i5 >= v2) != (v1 ? 43 : 90)) <= ((v2 + a0[2]) >= (v3 >= a0[9])));
+                    v3 = (((a0[2] / 4) <= (v0 >= i5)) ? ((v0 != 20) || (v3 == 30)) : ((v2 == 79) != (i5 || v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((v2 ? 76 : v1) == (v1 / 1)) ? ((a1[2][14] && v3) - (v1 <= v3)) : ((v2 + v0) % 2));
+}
+int f1() {
+    int v0 = 6;
+    int v1 = 84;
+    int v2 = 27;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((52 * i0) > 63) break;
+        {
+            int i1 = 0;
+            do {
+                if ((v1 == a0[5]) > 52) break;
+                a0[2] = (((v1 == 90) ? (a0[9] <= i0) : (v2 + i0)) ? ((a1[2][11] == i1) * (v2 * v2)) : ((v0 || v2) ? (v2 && i1) : (v1 || v3)));
+                a0[12] = (((36 == 28) <= (a0[2] - 32)) % 2);
+                a1[3][2] = (((a1[1][3] >= i1) - (v0 ? a1[2][6] : a1[0][7])) != ((75 == 47) < (v3 != i0)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v2 = (((a1[1][13] % 9) - (v1 ? v2 : v0)) ? ((58 > 37) * (a0[10] ? v0 : 99)) : ((a1[3][0] > i0) ? (v0 - v2) : (v1 % 7)));
+        a0[6] = (((51 != v1) ? (v1 >= v0) : (a1[1][9] <= v0)) <= ((a1[1][7] && v3) + (v0 * 18)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v2 + 95) > 81) break;
+        {
+            int i3 = 0;
+            do {
+                v0 = (((33 ? v2 : a1[1][13]) / 3) >= ((i3 > i2) + (v1 - i3)));
+                a1[0][2] = (((i3 >= v2) > (v0 + i2)) ? ((68 != v1) / 3) : ((a0[3] == i2) > (i3 / 1)));
+                v3 = (((67 / 3) + (63 || a1[3][5])) * ((a0[12] >= v2) ? (a1[3][3] / 7) : (v3 < a0[3])));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v0 = (((65 ? v2 : v3) ? (a1[0][14] + v3) : (93 ? 70 : 74)) / 5);
+        a0[15] = (((v0 / 4) >= (v1 % 1)) > ((2 == v2) && (57 ? v3 : v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v2 = (((75 + 80) ? (31 && 44) : (99 && v2)) < ((23 > v3) % 3));
+            a0[10] = (((a1[2][15] * a0[2]) < (a1[3][1] || 88)) >= ((99 <= 14) >= (53 ? v0 : a0[11])));
+            {
+                int i5 = 0;
+                do {
+                    a0[3] = (((a0[15] % 1) % 6) ? ((i5 <= i4) && (67 - 33)) : ((i5 > v1) && (84 < i5)));
+                    v2 = (((a0[14] / 5) && (89 == a1[2][8])) - ((v1 > v2) % 3));
+                    a1[0][15] = (((v3 * v1) ? (i4 % 4) : (v1 - v1)) - ((33 / 7) * (v3 != 23)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        a0[13] = (((14 == i6) < (42 ? i6 : a1[0][3])) <= ((v2 < 94) && (v2 * a0[0])));
+        {
+            int i7 = 0;
+            do {
+                v1 = (((v2 == a1[0][11]) * (86 != a1[2][15])) - ((32 < i6) + (94 < v0)));
+                a0[1] = (((a0[10] != 12) <= (i6 == i7)) / 5);
+                v3 = (((v1 > v2) > (58 / 4)) % 7);
+                i7 = i7 + 1;
+            } while (i7 < 5);
+        }
+        v0 = (((99 || v3) == (66 != v0)) ? ((98 * v1) < (45 / 6)) : ((48 || 59) ? (a1[2][6] > v3) : (v0 || v2)));
+    }
+    for (int i8 = 0; i8 < 4; i8 = i8 + 1) {
+        v2 = (((v1 * v0) >= (i8 == v0)) % 8);
+        v3 = (((v3 > 84) && (a0[4] <= v0)) <= ((a0[7] > v0) / 5));
+        {
+            int i9 = 0;
+            while (i9 < 8) {
+                a0[3] = (((v3 == 70) >= (v1 - v1)) > ((i8 > v2) >= (a1[2][10] ? 92 : 18)));
+                v2 = (((94 / 6) - (83 && 60)) || ((a0[7] ? 2 : v3) < (i9 + a0[8])));
+                v2 = (((v3 > a1[3][8]) <= (46 ? v3 : 68)) == ((82 || a0[12]) != (60 == v0)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    return (((a0[2] - 46) - (v0 && v1)) != ((v0 % 7) + (v2 < v0)));
+}
+int f2() {
+    int v0 = 49;
+    int v1 = 83;
+    int v2 = 4;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    if ((v2 + 38) > 74) break;
+                    v2 = (((a0[3] == 29) < (i1 / 5)) - ((a0[0] && v1) ? (v1 >= v0) : (v2 != i0)));
+                    v2 = (((a1[0][11] + a1[3][2]) <= (a0[13] > i1)) != ((41 / 1) || (v2 && v1)));
+                    v2 = (((v1 ? v3 : 68) < (a0[13] <= a1[1][7])) * ((a0[13] ? i0 : v3) || (i0 != 41)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][3] = (((i0 * i0) < (a0[6] <= 27)) != ((12 && v0) * (v1 != a0[3])));
+            v2 = (((v2 / 7) < (v0 > 3)) < ((21 ? v3 : 99) ? (a0[3] <= v3) : (44 - v0)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            a1[1][14] = (((50 > a0[11]) - (v1 >= i3)) / 2);
+            v1 = (((67 != v1) + (a0[8] - a1[0][14])) > ((i2 ? v1 : a0[5]) - (v0 >= i3)));
+            v3 = (((30 > a1[2][4]) && (83 / 7)) != ((81 - 39) + (a1[2][4] && 56)));
+        }
+        a0[3] = (((i2 + v3) == (v2 && v0)) / 7);
+        a0[4] = (((a1[0][15] >= 44) > (a1[2][13] * v2)) == ((a0[2] * a0[4]) != (i2 + 42)));
+    }
+    if ((((a0[4] > v0) == (v3 != a1[1][1])) * ((v1 != v1) ? (a0[7] >= 8) : (v2 == a0[0])))) {
+        a0[9] = (((a1[1][14] >= a0[1]) ? (83 == v0) : (v0 / 9)) != ((52 % 2) < (a1[2][8] || 65)));
+        v3 = (((v2 < v3) ? (v0 - a1[2][6]) : (91 * a1[1][12])) || ((v1 ? v2 : 89) || (v1 && v1)));
+        a1[0][2] = (((v1 ? a0[6] : v3) ? (v0 <= v3) : (a1[3][6] <= 68)) || ((v3 || 21) && (a1[0][12] >= 14)));
+    } else {
+        a0[9] = (((v2 + v1) / 3) && ((19 / 8) > (v1 == v2)));
+        a1[2][10] = (((93 % 7) >= (a0[5] - a0[4])) * ((35 <= a1[2][10]) != (a1[0][7] - v0)));
+        v1 = (((35 != 41) || (a0[6] >= 47)) - ((25 < v1) && (v2 + 67)));
+    }
+    if ((((a0[13] == a1[3][5]) <= (a0[3] + v3)) == ((a1[0][15] % 1) / 6))) {
+        v1 = (((v3 ? a0[12] : 26) < (v0 / 8)) * ((50 ? 95 : a1[0][3]) || (v2 * v2)));
+        a0[4] = (((a0[14] || a1[0][13]) && (v2 + v1)) % 6);
+        a0[8] = (((v0 / 2) == (54 ? a1[2][12] : 66)) ? ((11 <= 89) * (48 != a0[11])) : ((71 != v2) * (a1[1][9] - 7)));
+    } else {
+        a0[12] = (((v1 ? v0 : v1) % 2) && ((v3 || 67) * (a1[3][10] % 9)));
+        v1 = (((a0[14] / 2) != (95 % 4)) == ((99 - v0) * (v1 && 59)));
+        v0 = (((11 > v1) != (14 == v3)) - ((v2 ? a0[15] : v3) * (a1[3][8] < 60)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v2 = (((a0[2] <= a0[6]) < (a0[10] != 78)) >= ((i4 && i4) ? (i5 || 99) : (v0 || a1[0][9])));
+                    a0[6] = (((v1 ? v3 : i5) * (a1[0][12] == v2)) > ((i5 * a1[1][13]) <= (a1[0][8] != 36)));
+                    a1[1][4] = (((i4 ? a0[12] : i4) + (a0[2] == 68)) != ((v0 <= a1[3][2]) / 7));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][12] = (((v1 - a1[1][6]) >= (v3 >= 14)) <= ((a0[14] || 64) % 4));
+            a1[2][9] = (((v2 || 55) % 1) || ((a1[1][0] > 94) * (i4 / 4)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((a0[12] >= v1) ? (v3 * a0[10]) : (v1 && v3)) * ((98 >= 7) < (67 * v0)));
+}
+int main() {
+    return 0;
+}
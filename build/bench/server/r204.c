@@ -0,0 +1,71 @@
+int f0() {
+    int v0 = 22;
+    int v1 = 56;
+    int v2 = 14;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        if ((i0 / 5) > 50) break;
+        v3 = (((v1 ? a1[0][10] : a0[4]) >= (14 == v2)) != ((v0 / 8) ? (v2 ? a1[1][7] : v3) : (v2 >= v3)));
+        v0 = (((v1 == v0) >= (30 - a1[3][11])) > ((a0[6] - i0) > (50 == i0)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                if ((i1 && v3) > 74) break;
+                a1[1][14] = (((50 >= i0) <= (i0 != v0)) >= ((a0[0] > a0[8]) != (a1[1][2] % 3)));
+                v2 = (((v3 % 3) ? (v1 ? v3 : 39) : (98 || v0)) % 2);
+                v0 = (((i1 == 22) / 7) >= ((v0 ? 10 : i0) == (i0 < 94)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    v3 = (((v0 % 7) >= (v1 - 72)) < ((v0 >= 34) >= (50 - a1[1][8])));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a0[9] = (((38 > a1[0][8]) ? (a1[2][14] / 2) : (53 <= a1[1][12])) > ((33 <= a1[2][8]) == (34 <= a0[5])));
+                    a0[13] = (((a0[10] - 22) != (v1 % 7)) - ((a0[9] < i3) ? (v3 + v1) : (71 || 67)));
+                    v0 = (((v0 == 26) != (a0[11] + a0[13])) == ((32 && a1[2][1]) != (v1 * a0[2])));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v0 != v0) % 4) || ((v0 > v2) >= (v1 - 78)));
+            v3 = (((23 && a0[9]) <= (7 % 4)) < ((36 ? v1 : v2) == (i2 <= 5)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((75 - 17) != (35 == v1)) <= ((58 ? v3 : v3) < (v1 && a1[2][9])))) {
+        a0[13] = (((a1[2][15] >= v3) + (v2 ? 9 : v3)) <= ((v2 == v0) ? (v2 || a1[3][10]) : (v3 ? 84 : 28)));
+        a1[1][11] = (((49 ? v3 : v2) != (22 || v1)) % 5);
+        a1[3][15] = (((v2 <= 0) ? (v0 + 23) : (a0[6] > v2)) <= ((a0[13] - v0) && (v0 >= 61)));
+    } else {
+        v2 = (((a0[4] * a1[3][12]) <= (15 + v2)) < ((v0 - v3) > (43 - v1)));
+        v0 = (((47 <= v3) ? (v1 <= a1[2][0]) : (v1 > v3)) * ((14 >= a0[7]) || (83 == v1)));
+        v1 = (((84 != v3) % 2) && ((v2 || a1[3][0]) == (55 > 28)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v0 = (((a0[0] != 56) || (a0[8] != v1)) >= ((a0[4] % 5) <= (a1[1][0] * 61)));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v1 = (((v3 >= v3) || (v2 ? v2 : v2)) * ((v1 * v0) > (a0[10] > 26)));
+                    v3 = (((v2 % 8) ? (i4 - 64) : (v1 ? 6 : 10)) || ((i4 % 5) != (19 / 2)));
+                    a1[0][3] = (((i4 - 16) != (a0[2] && a0[5])) - ((a1[0][8] ? a1[2][12] : a1[0][15]) <= (v3 / 6)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((a1[3][8] == i4) ? (v3 < i4) : (a1[2][6] > v0)) / 4);
+            i4 = i4 + 1;
+        }
+    }
+    return (((56 == v1) && (v1 * v0)) % 6);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,114 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 90;
+    int v2 = 88;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 > a1[2][10]) / 2) && ((21 > a1[3][10]) != (a1[3][12] || 16)))) {
+        a1[2][5] = (((v2 != v1) && (83 * 20)) >= ((v3 < 37) && (20 > v3)));
+        a1[1][8] = (((a0[11] < 76) ? (v2 ? a0[15] : a0[5]) : (v3 + a1[2][7])) >= ((a0[13] / 1) / 1));
+        v0 = (((a0[10] ? a0[14] : v1) != (5 >= a0[0])) + ((69 * v3) <= (a1[2][6] && a1[1][14])));
+    } else {
+        a1[3][13] = (((v3 <= 95) ? (19 >= 34) : (a1[0][2] % 7)) * ((25 + v0) && (v0 >= v2)));
+        v1 = (((v3 <= v0) == (a0[15] / 4)) && ((7 && v3) + (a1[1][12] || v1)));
+        a1[0][9] = (((a1[3][14] >= v0) >= (a0[14] < v1)) < ((v3 || a0[11]) || (v3 == 31)));
+    }
+    if ((((64 % 9) <= (v0 || 18)) < ((v1 ? 31 : 70) == (v1 || v2)))) {
+        v3 = (((a0[10] ? 31 : 45) != (a0[15] / 4)) ? ((40 ? v0 : a1[2][14]) >= (v3 / 3)) : ((v1 % 4) % 8));
+        a1[2][7] = (((v3 - v0) || (a1[2][8] / 6)) >= ((26 ? v0 : 74) / 1));
+        v1 = (((88 <= v0) <= (52 == 30)) == ((68 || v3) >= (66 - v0)));
+    } else {
+        v0 = (((72 || a0[11]) != (v3 >= v2)) && ((v3 || v0) * (87 != 80)));
+        v1 = (((56 - v1) * (a1[3][0] != v0)) - ((v2 - 36) ? (a1[0][14] != v2) : (75 / 1)));
+        a1[3][1] = (((a0[11] ? v3 : v1) || (v3 * v3)) == ((10 && a1[0][1]) ? (56 / 8) : (v3 / 9)));
+    }
+    v1 = (((62 < v0) - (70 ? a0[10] : v2)) > ((v2 == a0[4]) % 2));
+    v2 = (((v0 == v0) >= (a0[1] + v0)) ? ((v1 && v0) < (36 && v0)) : ((a0[2] <= a1[3][8]) && (v3 - v0)));
+    v1 = (((72 < 27) && (a0[9] || a0[12])) + ((a1[3][3] && v1) % 8));
+    return (((27 * v2) + (14 + v1)) / 6);
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 66;
+    int v2 = 66;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((93 + a1[0][1]) > 55) break;
+            v2 = (((a1[2][8] % 7) / 4) || ((79 % 7) && (22 ? 29 : a0[8])));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((a0[1] - v2) > 61) break;
+                    a0[3] = (((a1[2][1] <= 51) || (a0[2] > i1)) * ((53 < i1) && (a0[5] < 67)));
+                    v2 = (((16 * a0[5]) <= (v1 ? a0[5] : i1)) * ((i1 / 8) >= (v1 > i1)));
+                    v2 = (((i1 > i0) + (a0[7] / 6)) && ((v1 < 7) >= (77 || v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[14] = (((i0 <= v1) != (v3 - a1[1][9])) / 6);
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v1 = (((a1[2][8] && a1[2][4]) <= (a1[1][9] > 18)) >= ((v2 ? i2 : i3) > (v3 != v1)));
+                    v3 = (((v2 || v1) && (i2 < 63)) != ((51 > 24) != (97 - 6)));
+                    v1 = (((i2 + a0[1]) == (i2 * a1[0][9])) ? ((a0[2] * 60) ? (a1[1][7] ? a0[0] : a0[4]) : (v1 || v1)) : ((i2 - a1[0][4]) < (v1 || 0)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((9 != v1) ? (20 ? 81 : 4) : (v0 > 66)) > ((v3 || a1[0][9]) % 3));
+            a0[9] = (((v1 == 82) + (38 < v3)) <= ((a1[0][14] >= a0[13]) || (v1 % 8)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[3][3] = (((59 ? a1[1][0] : 85) - (v2 ? v0 : a0[0])) > ((i4 * v0) ? (3 == 61) : (v0 * v2)));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                if ((v2 == a0[13]) > 85) break;
+                v0 = (((v1 ? a1[3][11] : v2) + (a0[10] ? v3 : 86)) * ((a1[3][0] < v2) > (v2 + a1[3][12])));
+                a0[14] = (((v3 < v1) % 1) <= ((i4 == v3) && (11 <= 32)));
+                v0 = (((v2 >= v3) + (a0[12] == v1)) < ((61 <= i5) / 8));
+            }
+            v2 = (((i4 - v1) * (v2 - v3)) % 5);
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        a1[3][2] = (((a1[1][5] ? a0[6] : 78) != (a1[1][8] >= v1)) == ((a1[3][12] < i6) - (2 <= v0)));
+        v1 = (((v1 - a1[1][9]) == (v3 + v2)) - ((i6 != v1) * (21 / 7)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                a0[1] = (((i6 != 4) < (a0[12] + 55)) % 6);
+                v1 = (((v2 || i7) && (a0[6] % 7)) || ((v2 < a1[2][1]) <= (13 >= v3)));
+                v2 = (((v2 == a0[13]) <= (a0[8] / 6)) * ((67 > v2) * (v1 || a0[6])));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    if ((((a1[3][4] ? v0 : 9) == (v3 || v3)) < ((a1[1][10] > v2) ? (v0 % 3) : (95 ? 47 : a1[2][14])))) {
+        v0 = (((v3 - v1) > (a1[1][14] && 99)) == ((v1 - 13) && (v1 - a0[15])));
+        v1 = (((30 == 26) + (v2 + a1[0][3])) == ((v2 > a1[2][12]) ? (a1[3][7] == 43) : (v1 * v0)));
+        a0[2] = (((84 || v0) % 5) - ((23 ? a0[5] : 69) * (v1 * v1)));
+    } else {
+        a0[8] = (((a0[0] != a0[1]) ? (v2 * a0[9]) : (v1 < a1[0][2])) < ((v1 && v2) > (a0[8] && a0[15])));
+        v0 = (((a0[10] > a0[1]) - (12 && 69)) ? ((v2 - 12) && (a0[10] >= 36)) : ((50 == 59) > (29 == v2)));
+        a1[1][15] = (((98 <= 99) && (v0 ? v2 : v0)) - ((v1 + a1[2][12]) / 2));
+    }
+    return (((a0[5] != v0) != (40 % 8)) * ((a1[2][1] == v3) > (v1 != v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,166 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 22;
+    int v2 = 65;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 * a1[3][9]) >= (a0[8] + v0)) && ((v0 <= v2) <= (v1 ? a0[3] : v3)))) {
+        a0[14] = (((v3 > v0) < (v2 >= v3)) <= ((v0 <= 4) % 6));
+        v3 = (((a1[3][8] && v2) == (a0[8] - 45)) + ((45 == 34) != (v1 && a1[3][3])));
+        a0[4] = (((v3 != v0) && (v0 || v0)) || ((v1 - v3) || (46 < a1[1][2])));
+    } else {
+        v0 = (((v2 > v2) > (v0 < v1)) && ((v1 - 30) / 4));
+        a1[3][2] = (((81 ? v0 : a1[1][4]) && (a0[14] + a0[8])) * ((52 < a0[0]) || (v1 || 81)));
+        v1 = (((a1[1][9] > v1) / 1) - ((v1 * v3) && (v3 >= v2)));
+    }
+    if ((((49 <= a0[0]) >= (v1 || 50)) < ((v2 <= 13) == (v3 != 48)))) {
+        v3 = (((a0[4] / 4) / 8) > ((v3 && a0[14]) == (v0 == v2)));
+        v0 = (((v0 % 9) || (v2 == v3)) == ((a0[2] || v0) * (81 ? v2 : 45)));
+        v1 = (((v0 - v0) - (64 ? v1 : v2)) > ((v3 == a1[2][2]) && (28 ? 46 : v1)));
+    } else {
+        a0[0] = (((v0 ? a0[4] : v2) >= (a1[1][0] ? v2 : v1)) ? ((a1[2][11] >= 25) % 4) : ((a1[2][4] * v0) ? (a0[14] < v1) : (v2 <= v2)));
+        a0[15] = (((v1 || v2) ? (v2 >= 32) : (v2 && 28)) && ((a1[0][7] != v3) * (39 == v0)));
+        v2 = (((a0[3] / 4) / 2) / 3);
+    }
+    a0[7] = (((v1 < 18) % 9) != ((7 < a1[1][10]) < (v2 <= a0[2])));
+    if ((((v0 != v2) - (a1[1][9] != a0[0])) ? ((a1[1][6] - v2) <= (a1[3][10] <= v1)) : ((82 || v1) % 1))) {
+        v2 = (((v0 * v1) != (v1 > a1[3][10])) / 3);
+        v2 = (((v0 >= 98) * (v2 % 4)) ? ((v1 >= a0[11]) >= (v1 && a1[3][2])) : ((30 ? a0[14] : 3) != (78 * v3)));
+        a1[0][12] = (((v0 == v1) / 7) < ((a1[3][15] > v3) > (v0 ? v0 : 60)));
+    } else {
+        a0[9] = (((a0[9] + v0) % 7) >= ((a0[2] ? 17 : 13) && (v0 < v1)));
+        v1 = (((v1 < 71) >= (a0[11] < a1[3][5])) % 9);
+        v0 = (((v1 + a1[3][0]) > (a0[6] <= v1)) >= ((a0[5] != v0) - (a1[2][4] == 2)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v3 = (((28 != 17) || (a0[11] + v0)) >= ((i0 != 7) == (a1[0][9] && v0)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                v2 = (((i0 == 80) ? (v2 >= a1[0][5]) : (a1[3][3] + 93)) || ((v3 != v1) != (26 <= a0[10])));
+                v1 = (((i1 != v2) % 4) ? ((a1[1][1] + 90) == (16 ? a1[3][1] : a0[15])) : ((v3 < 24) - (53 - 66)));
+                v1 = (((v0 <= v2) ? (v0 >= i1) : (14 != 11)) ? ((v2 + v1) > (v0 ? v0 : i1)) : ((84 == v2) + (a0[6] / 4)));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((v3 - v1) == (v2 ? 89 : v1)) == ((v0 != i0) * (14 < a1[0][0])));
+    }
+    return (((65 - 98) ? (10 >= 64) : (a1[2][1] || v1)) <= ((a0[14] + 55) + (a1[1][13] - v3)));
+}
+int f1() {
+    int v0 = 97;
+    int v1 = 57;
+    int v2 = 45;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 != v1) % 5) <= ((v2 || v1) && (v0 < a1[2][1])))) {
+        v0 = (((a0[11] - 9) * (a1[3][12] || a0[6])) > ((56 >= a1[3][3]) ? (a1[3][2] <= a1[0][0]) : (a1[0][10] / 8)));
+        a1[2][9] = (((v0 ? 44 : v2) * (a0[12] >= v0)) ? ((a1[3][8] / 3) % 1) : ((v0 / 5) == (39 % 4)));
+        v1 = (((v1 == a0[1]) - (v3 ? 45 : a0[2])) > ((v2 > a1[0][0]) + (a0[10] + 96)));
+    } else {
+        v0 = (((a1[2][5] % 2) % 7) % 4);
+        v3 = (((v2 > v0) - (v1 || v1)) < ((87 && v1) == (v0 >= 29)));
+        v0 = (((v1 ? v3 : v3) ? (v1 + 84) : (36 != a1[3][7])) + ((v0 == 0) != (v1 >= a0[1])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v3 < 2) + (a0[7] / 8)) < ((v1 ? 31 : v0) == (i0 <= a1[0][12])));
+            a1[0][14] = (((v3 || a0[3]) + (88 + i0)) + ((a0[7] == v0) != (v0 / 2)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v3 / 2) == (v1 + v1)) != ((v2 <= i1) != (i1 < v3)));
+                    v3 = (((a0[1] - i1) && (v3 || i0)) ? ((a1[1][3] ? i1 : 91) != (v0 <= 94)) : ((v3 / 8) < (i1 && a1[1][13])));
+                    a0[14] = (((a0[12] == 77) <= (v3 == v3)) / 2);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v0 = (((a1[0][10] || v0) / 9) + ((v1 > v3) && (a0[0] % 3)));
+    if ((((v3 >= v3) * (v2 != v3)) / 6)) {
+        a1[1][5] = (((a1[3][2] == 10) % 5) > ((v0 < v1) && (16 == v3)));
+        a0[6] = (((a0[5] / 9) && (v3 && 17)) / 8);
+        v2 = (((v1 - v1) > (a0[7] && a1[2][1])) > ((v1 + a1[3][3]) % 3));
+    } else {
+        v2 = (((v2 ? v0 : v3) * (6 || 18)) + ((v1 || v2) ? (a0[11] % 3) : (v3 <= a0[3])));
+        v2 = (((v3 != v0) < (v1 ? a0[13] : v1)) - ((72 % 2) - (a0[5] < a0[7])));
+        v0 = (((24 == v3) < (v2 == v2)) - ((a0[1] * v1) ? (a1[2][5] || 40) : (v2 <= v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a0[2] == i2) * (69 ? v2 : 9)) - ((a1[0][9] < v1) == (v1 && 38)));
+            v0 = (((v0 < 89) ? (v0 || v0) : (a1[3][5] || a1[0][5])) < ((18 >= i2) <= (a1[3][12] != a0[2])));
+            {
+                int i3 = 0;
+                do {
+                    if ((49 <= a0[8]) > 65) break;
+                    v0 = (((v0 > a0[2]) + (a1[0][0] > a0[2])) / 6);
+                    v1 = (((i3 == 50) * (a0[10] ? a0[12] : v1)) <= ((v3 - a0[0]) * (v1 - a1[0][7])));
+                    v2 = (((v2 + i2) || (i2 + v3)) && ((a1[3][15] > v3) == (5 <= v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((v0 >= 20) && (v0 || a0[12])) - ((v1 + 40) > (v2 != v0)));
+}
+int f2() {
+    int v0 = 12;
+    int v1 = 65;
+    int v2 = 20;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 - v3) > (v2 <= 69)) % 9)) {
+        v2 = (((v2 || a0[2]) < (v0 ? a1[0][10] : 44)) * ((v3 >= 90) + (a1[3][0] != 26)));
+        a0[10] = (((a1[0][13] < a1[2][14]) != (32 >= v0)) / 4);
+        v2 = (((18 + v2) ? (v1 < v0) : (v3 && v1)) + ((v2 || v2) + (a0[13] && a1[0][2])));
+    } else {
+        v1 = (((a1[0][15] - v2) >= (a0[11] * a1[3][0])) >= ((a0[3] / 4) == (47 ? 17 : v1)));
+        v2 = (((15 ? v2 : a1[3][9]) || (v1 * a0[6])) ? ((v0 < v3) > (15 * v2)) : ((v0 != a1[1][6]) > (13 >= 17)));
+        a0[6] = (((88 != 76) + (a1[2][15] < 63)) <= ((a1[1][0] != 16) - (v0 <= v0)));
+    }
+    if ((((75 || a0[15]) < (95 * 91)) != ((v3 > v2) - (v1 / 8)))) {
+        v1 = (((89 - 44) <= (32 / 1)) ? ((v1 >= a1[2][1]) - (95 != v3)) : ((43 || a1[1][15]) ? (a0[10] >= 94) : (v3 * v2)));
+        a1[2][2] = (((a1[1][4] <= v0) + (66 * v3)) / 9);
+        v1 = (((60 == a1[3][5]) >= (v0 - v1)) || ((14 + v3) ? (a0[12] ? 48 : v2) : (v2 ? v0 : v1)));
+    } else {
+        v3 = (((a1[3][3] ? 23 : v3) ? (a1[2][0] != 19) : (21 ? a1[2][7] : 99)) * ((v3 * v3) || (v2 || v2)));
+        v2 = (((a1[1][4] < v0) * (v3 ? v3 : v3)) == ((81 % 4) ? (v1 * v1) : (v1 >= v3)));
+        v0 = (((v0 != v3) / 8) * ((v1 <= a0[14]) && (v0 / 3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v0 = (((87 + v0) > (v0 >= v3)) <= ((v3 + v3) + (v1 % 2)));
+                a1[3][7] = (((a1[0][15] < 39) - (v3 + a1[1][0])) == ((11 - a0[13]) % 2));
+                v0 = (((v2 == a0[6]) % 7) || ((v0 < v1) || (v3 ? v0 : a1[1][4])));
+            }
+            v0 = (((v1 || v3) < (74 ? v2 : v3)) < ((a0[12] - 57) < (a1[0][7] ? a0[15] : a1[3][14])));
+            v3 = (((a1[3][15] != 27) || (16 > v0)) <= ((a1[2][4] % 2) == (a1[1][1] % 1)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v2 = (((v2 + v0) < (12 || v3)) == ((v3 || v0) + (v2 && v1)));
+    if ((((a1[0][5] < a1[2][11]) - (a1[3][15] >= v2)) >= ((50 != 69) == (v3 && a0[3])))) {
+        a1[2][13] = (((17 * v3) && (a1[0][9] / 4)) >= ((v2 <= 33) ? (47 <= a0[9]) : (v2 - v3)));
+        v2 = (((a1[3][7] < v1) != (v0 != 89)) % 6);
+        a1[3][13] = (((v2 || v1) - (32 < 2)) >= ((34 % 7) == (a1[0][12] > v3)));
+    } else {
+        a0[3] = (((v1 ? 29 : 59) % 5) >= ((73 > v0) == (63 >= v1)));
+        v0 = (((v1 * 76) <= (v0 + v0)) % 5);
+        v2 = (((v1 <= v1) != (45 % 6)) == ((33 && v0) >= (v3 % 4)));
+    }
+    return (((v1 >= a0[12]) * (18 + v1)) * ((a1[2][3] * v0) * (a1[3][5] ? v0 : a1[0][4])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,82 @@
+int f0() {
+    int v0 = 14;
+    int v1 = 78;
+    int v2 = 18;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((27 ? 43 : i1) ? (a1[2][14] % 5) : (a1[0][9] - a0[11])) == ((v0 % 2) - (a1[2][12] ? i1 : v3)));
+                    v0 = (((v2 && a1[3][10]) <= (i1 && 3)) ? ((a0[6] ? i1 : v0) ? (v2 + 92) : (v1 + v1)) : ((i1 + v1) <= (v0 != i0)));
+                    v3 = (((v0 ? 78 : i1) || (10 ? v1 : i1)) == ((13 ? v0 : v3) + (v0 && 8)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a0[14] = (((v0 > 7) < (48 * a0[3])) ? ((a1[3][11] < v2) < (v0 >= i0)) : ((v1 ? i0 : v3) ? (a0[9] - a0[1]) : (v2 / 3)));
+            v2 = (((v2 <= a0[0]) == (a0[0] ? v3 : v2)) != ((40 ? v0 : 8) || (v2 + v3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v2 / 3) > 51) break;
+        v3 = (((v0 - 60) / 7) && ((i2 > i2) > (v1 % 5)));
+        a1[3][4] = (((88 <= v3) >= (v3 == v1)) - ((43 / 1) || (a1[1][5] * v2)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((i2 == i3) % 6) <= ((v2 && 71) + (v3 != v2)));
+                v0 = (((v2 <= v2) <= (a1[1][6] * v1)) % 3);
+                v2 = (((v3 % 3) <= (v0 % 2)) && ((a0[8] <= i2) != (v3 == 88)));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    if ((((15 ? a0[6] : v2) <= (v0 - v0)) % 1)) {
+        a1[3][8] = (((v0 % 1) % 7) ? ((a0[10] / 7) >= (v1 % 9)) : ((26 - a1[2][11]) % 3));
+        v0 = (((a0[6] - 75) * (v2 != v0)) <= ((a0[3] && v1) > (v0 + a1[2][4])));
+        v2 = (((a1[0][3] < v3) < (a0[9] < a1[1][5])) ? ((a0[14] == v2) <= (a1[0][4] * 20)) : ((v0 >= a0[4]) - (a1[2][5] ? v3 : a0[6])));
+    } else {
+        a0[10] = (((8 >= v1) || (v3 <= 54)) > ((v3 || 40) || (v1 > v1)));
+        v0 = (((45 <= a0[7]) > (v0 == 74)) - ((v1 + v2) != (59 ? v0 : 22)));
+        v2 = (((v2 != v2) - (50 + a0[10])) <= ((v0 - a1[2][13]) ? (v3 == v2) : (51 + v3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[2][6] = (((i4 >= v2) < (v3 * 56)) != ((a1[3][11] + v2) == (v3 ? a0[15] : a1[0][11])));
+            v2 = (((75 * v1) == (a1[2][7] > a1[0][9])) == ((v3 || 3) > (18 ? 5 : v1)));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((23 <= v1) >= (96 != i4)) && ((a0[12] - i5) - (8 ? v0 : 58)));
+                    a1[0][8] = (((v0 || 53) * (i4 && a1[1][8])) % 2);
+                    a1[1][11] = (((a0[3] == i5) || (4 > v2)) && ((v3 ? v3 : 82) % 1));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v0 = (((82 ? a0[15] : 66) - (i6 > v0)) * ((96 != v1) ? (v0 - 11) : (v3 <= a0[5])));
+        v2 = (((14 % 6) > (v2 + v3)) - ((27 != a0[15]) + (v2 < v2)));
+        {
+            int i7 = 0;
+            do {
+                a1[2][11] = (((28 * v1) > (a1[1][3] < a1[1][8])) + ((v2 != v0) * (a1[3][10] || a1[2][12])));
+                v0 = (((a0[15] * i6) == (v0 != i7)) < ((i7 == 74) + (v2 && v2)));
+                v0 = (((i7 ? v0 : v2) % 1) == ((v2 ? v1 : v3) >= (59 == a1[0][14])));
+                i7 = i7 + 1;
+            } while (i7 < 3);
+        }
+    }
+    return (((84 == a1[2][5]) % 2) <= ((v3 * v3) && (v2 < a0[15])));
+}
+int main() {
+    return 0;
+}
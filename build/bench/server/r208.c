@@ -0,0 +1,126 @@
+int f0() {
+    int v0 = 46;
+    int v1 = 25;
+    int v2 = 32;
+    int v3 = 21;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v3 + 80) || (v1 == v1)) <= ((v2 ? v2 : v1) || (v2 > v3)));
+    v0 = (((v0 - v0) - (43 && 13)) - ((v0 < 29) < (a0[15] ? v1 : v3)));
+    v2 = (((v0 / 7) % 2) <= ((5 || v3) >= (v1 ? v0 : 39)));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((a0[7] <= v2) > 68) break;
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a0[4] = (((63 && v0) <= (99 - v0)) > ((48 + 89) - (38 == 73)));
+                a1[2][10] = (((55 * i0) || (v2 == v0)) || ((v3 + v2) == (v2 % 5)));
+                a1[3][9] = (((55 > v2) <= (v2 <= v0)) || ((56 || v2) < (0 % 3)));
+            }
+            v3 = (((v0 != v2) != (v3 - a1[2][5])) == ((v2 % 8) < (v3 ? a1[3][4] : v0)));
+            a0[6] = (((a1[2][13] >= v2) > (71 <= 7)) == ((95 != 50) || (v3 == v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            a0[3] = (((a1[3][4] || v2) < (a1[3][1] + 89)) * ((a0[0] ? a1[2][7] : v0) == (97 <= a1[0][6])));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v3 = (((40 < i3) - (a1[1][6] / 1)) || ((v1 || a0[5]) < (v3 > v2)));
+                    v0 = (((v2 ? 68 : i2) + (4 * a1[0][11])) * ((43 ? 54 : v2) % 1));
+                    a0[15] = (((i2 && i3) - (a0[15] + v1)) <= ((a0[12] ? 0 : 37) / 2));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((v2 + v0) > (v2 ? a0[15] : a1[1][4])) * ((v0 / 8) - (90 != a1[0][11])));
+            i2 = i2 + 1;
+        }
+    }
+    return (((80 >= v0) * (a0[3] < a1[2][12])) > ((a0[8] % 4) > (v2 + v0)));
+}
+int f1() {
+    int v0 = 41;
+    int v1 = 92;
+    int v2 = 22;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v2 = (((a0[8] - i0) ? (a0[7] <= i1) : (a1[1][8] / 4)) ? ((a1[2][4] ? 4 : 78) - (93 >= i1)) : ((v0 > 70) ? (v0 ? a1[3][6] : v0) : (v3 > v1)));
+                    a1[2][4] = (((a0[15] ? v2 : v0) && (86 <= a1[0][2])) && ((v2 > v1) % 9));
+                    v3 = (((a1[2][14] - i1) / 9) && ((i0 * 21) - (v1 - v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a1[3][9] ? 0 : a1[0][1]) - (87 - v3)) % 7);
+            a0[11] = (((v0 + v3) * (v1 ? 68 : 55)) ? ((i0 && v0) || (v0 + a0[12])) : ((v2 >= a1[1][15]) >= (a0[12] ? v2 : a1[1][14])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[9] = (((v2 > a1[2][14]) != (v0 <= v0)) % 4);
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((v2 + v3) > 88) break;
+                    a1[0][7] = (((5 > i3) > (12 <= a0[11])) / 8);
+                    a0[12] = (((v1 - 99) + (26 == i2)) >= ((v2 || v0) * (v1 / 3)));
+                    v0 = (((i3 + v2) || (v2 ? v0 : v1)) < ((a1[3][3] >= v0) >= (v0 <= i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((v2 + i2) != (v1 && v1)) < ((v1 != 17) != (v2 ? v2 : 2)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v2 = (((v0 <= v3) / 6) != ((15 % 8) - (v1 ? v0 : v1)));
+        {
+            int i5 = 0;
+            do {
+                a0[10] = (((v0 % 9) == (a0[8] >= a1[3][8])) - ((a1[1][11] > v1) >= (3 * v3)));
+                v0 = (((84 < i4) - (56 ? i5 : v1)) * ((a1[0][2] > 91) < (v3 == a0[13])));
+                v1 = (((a0[6] >= a1[2][6]) - (i4 ? v3 : v1)) ? ((34 - v3) && (v0 % 6)) : ((v1 + v2) < (13 / 9)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        a1[3][6] = (((a0[0] >= 10) >= (v3 ? v3 : a0[4])) <= ((82 ? a0[7] : v2) * (v0 == v3)));
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        a0[12] = (((i6 == 40) % 8) - ((63 || a0[4]) > (a0[12] + a1[3][10])));
+        v3 = (((i6 / 7) == (a0[7] % 9)) != ((a1[2][12] / 7) == (a1[1][8] * 76)));
+        {
+            int i7 = 0;
+            while (i7 < 6) {
+                if ((a0[12] / 9) > 92) break;
+                a1[0][6] = (((v0 * a1[3][12]) % 1) && ((39 * a1[0][12]) / 2));
+                v0 = (((v2 >= a0[8]) >= (0 == v1)) && ((a0[11] || v2) < (17 || a0[14])));
+                v0 = (((v2 < a1[0][12]) ? (v1 || 68) : (v0 < 94)) && ((a1[2][7] ? v0 : a1[0][3]) || (i7 ? i7 : 73)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+            v3 = (((95 || a0[11]) != (a0[14] % 4)) / 5);
+            a1[3][4] = (((v2 / 6) + (15 == a1[1][1])) == ((18 * 82) % 9));
+            a0[10] = (((48 < v0) && (a1[0][3] + i8)) ? ((30 / 6) % 3) : ((v2 * i9) / 3));
+        }
+        v2 = (((a0[13] >= a1[3][13]) + (34 ? a1[1][14] : i8)) - ((a0[12] + v0) - (59 > v2)));
+        v3 = (((i8 - a1[2][9]) - (23 + 38)) < ((v3 + v3) == (v0 > a0[8])));
+    }
+    return (((v0 < v2) != (a1[1][4] || 34)) != ((v2 - v3) * (a1[1][10] <= v3)));
+}
+int main() {
+    return 0;
+}
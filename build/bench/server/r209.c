@@ -0,0 +1,153 @@
+int f0() {
+    int v0 = 10;
+    int v1 = 71;
+    int v2 = 68;
+    int v3 = 21;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][6] > 90) * (v2 == 40)) * ((a0[14] && a0[8]) % 6))) {
+        a0[10] = (((a1[0][0] - 31) ? (v3 > v3) : (a1[2][3] * a0[9])) <= ((v1 ? v0 : a0[7]) > (v1 > v3)));
+        v2 = (((v0 && 95) + (v1 - v0)) / 3);
+        v2 = (((24 ? v2 : v2) || (87 ? 94 : v1)) <= ((v3 % 7) && (v1 < v1)));
+    } else {
+        v3 = (((v0 * 8) == (v2 % 7)) * ((11 % 8) <= (a1[2][1] + a1[1][9])));
+        v3 = (((v0 <= v0) == (a0[0] < v3)) <= ((11 >= v3) + (74 % 4)));
+        v2 = (((a0[7] % 3) ? (v0 > a0[6]) : (15 == a1[3][14])) <= ((v0 < 45) % 4));
+    }
+    if ((((97 / 5) * (v0 ? v3 : v3)) >= ((v2 != v3) > (a1[1][2] ? a1[0][6] : v1)))) {
+        v3 = (((a1[1][3] != v0) != (a0[15] % 8)) > ((a1[2][1] < 69) >= (v0 > v1)));
+        a1[2][4] = (((v0 * v1) + (v0 > v2)) ? ((a0[15] || 90) || (a1[2][1] < a1[3][7])) : ((43 ? 3 : a0[11]) ? (a0[14] ? 99 : v3) : (v1 ? v2 : a1[3][1])));
+        v3 = (((v2 ? v3 : a0[4]) >= (v1 != v3)) != ((v2 ? a0[4] : 19) ? (v0 + v3) : (a0[1] || a1[0][5])));
+    } else {
+        a0[10] = (((a0[13] ? v1 : 75) % 2) ? ((v0 && v1) && (11 ? v0 : 82)) : ((v2 && 22) && (a0[7] / 3)));
+        v1 = (((a0[4] || 50) >= (32 ? 40 : v3)) + ((7 <= 96) != (3 + 25)));
+        a0[8] = (((a0[12] || 34) ? (v1 + 60) : (v3 + a0[8])) * ((v2 || 73) == (v1 / 5)));
+    }
+    if ((((a0[12] > a1[1][4]) % 9) || ((a0[9] + v0) % 4))) {
+        a1[3][3] = (((a0[9] != v1) ? (v0 != 97) : (55 > a1[1][9])) > ((a1[0][11] / 6) + (a0[0] > 59)));
+        v3 = (((31 > 43) ? (v2 / 7) : (a0[10] ? a1[1][11] : a0[5])) == ((a0[1] * v3) * (7 * v1)));
+        a0[5] = (((a0[8] / 8) * (v3 >= v0)) / 2);
+    } else {
+        a0[4] = (((v1 <= v3) % 8) || ((v1 != v1) <= (66 >= a0[1])));
+        v2 = (((a1[2][7] >= a1[0][7]) == (a0[15] ? v0 : v1)) * ((v1 + a0[11]) % 7));
+        v1 = (((v3 ? v0 : v2) > (76 < a1[0][4])) / 7);
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v1 = (((79 * a1[3][4]) != (v3 != a0[13])) % 9);
+        {
+            int i1 = 0;
+            do {
+                v2 = (((90 ? v2 : a0[12]) ? (i1 || v0) : (a0[1] ? i0 : i0)) + ((72 >= 62) < (v2 || i0)));
+                a1[3][10] = (((i1 <= 11) >= (v0 ? a1[3][15] : 22)) == ((64 || v1) * (v0 + v0)));
+                v1 = (((v0 && v3) + (v1 >= a1[3][4])) / 2);
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v3 = (((v2 % 1) && (a1[0][9] == 24)) || ((18 > 86) % 6));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v0 - v2) + (i2 == 21)) % 4);
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v0 = (((a1[3][3] != v3) / 7) && ((v0 / 3) * (v0 % 1)));
+                a0[3] = (((i3 + i3) % 6) != ((i3 - i3) != (76 / 8)));
+                v3 = (((i2 ? i3 : a1[3][12]) ? (92 % 3) : (v0 ? v3 : v2)) > ((a0[14] < v0) < (a1[2][13] + i3)));
+            }
+            v1 = (((a1[1][3] <= v3) <= (v2 - v1)) - ((v3 >= a0[15]) % 1));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    return (((v1 ? 19 : 72) > (v1 < a1[1][8])) == ((v3 == 20) ? (a0[0] == 82) : (v1 * v0)));
+}
+int f1() {
+    int v0 = 55;
+    int v1 = 86;
+    int v2 = 15;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    a0[13] = (((v0 + v0) == (v2 < v1)) % 7);
+    v2 = (((a1[2][13] == 87) % 3) ? ((88 ? v1 : a0[0]) - (v2 > a0[6])) : ((a1[3][12] + v3) ? (95 + v3) : (a1[1][7] == v1)));
+    if ((((v2 && a1[2][4]) * (v3 % 4)) && ((v3 / 8) != (v1 ? a0[15] : 39)))) {
+        v3 = (((93 != v0) != (v0 ? a1[1][1] : v1)) < ((a0[6] <= v2) || (a1[2][2] <= 26)));
+        v2 = (((v2 <= v1) * (a0[6] - 18)) >= ((v3 == 29) % 2));
+        a1[0][13] = (((v3 ? v0 : v0) >= (v3 && a1[0][5])) * ((v3 ? v2 : 51) % 8));
+    } else {
+        a0[3] = (((v2 <= 69) && (56 - v1)) ? ((v3 ? v1 : a0[14]) / 5) : ((v1 ? a0[6] : a0[7]) >= (66 * a0[4])));
+        a0[15] = (((v0 || a0[1]) <= (v3 > v0)) && ((81 ? a1[0][0] : a1[1][14]) != (a0[12] > a0[5])));
+        v1 = (((24 ? v0 : v2) ? (v1 != 35) : (a1[2][7] ? v1 : v3)) ? ((a1[1][3] && v2) % 3) : ((66 ? 45 : v0) == (a1[1][3] % 6)));
+    }
+    v1 = (((0 % 1) + (37 >= a0[10])) * ((v0 + v1) <= (a1[0][8] <= v2)));
+    if ((((a1[3][9] < 82) ? (a0[1] == v1) : (v1 != a0[3])) * ((23 + v2) % 9))) {
+        a1[2][12] = (((v0 % 6) >= (v2 ? a1[2][14] : a1[1][14])) == ((v3 <= a1[3][14]) + (4 / 4)));
+        v3 = (((v3 && v3) - (v1 - a1[0][0])) + ((v0 % 3) < (31 >= a0[14])));
+        v0 = (((v2 == 4) ? (v2 % 4) : (v2 / 4)) || ((a0[14] <= 35) > (3 == a0[15])));
+    } else {
+        v3 = (((a1[3][2] >= v3) ? (a0[9] <= 59) : (a1[3][10] > v3)) ? ((a1[0][6] || v1) >= (v1 >= 98)) : ((v0 >= a1[3][2]) + (v1 < a0[14])));
+        v2 = (((v2 > a1[3][11]) <= (23 > a0[5])) && ((a1[3][13] ? 84 : a0[4]) ? (v2 ? v2 : v0) : (a0[6] > 43)));
+        v3 = (((36 < v0) != (a1[3][6] > v0)) ? ((v3 / 6) ? (v3 ? 77 : v2) : (v1 < a0[15])) : ((a0[14] <= a1[2][15]) > (a0[8] <= v3)));
+    }
+    return (((98 != v3) <= (a0[7] && a1[1][8])) + ((v3 - v0) != (v1 > 10)));
+}
+int f2() {
+    int v0 = 74;
+    int v1 = 46;
+    int v2 = 18;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((96 <= 61) <= (a0[11] <= a0[1])) ? ((v1 < i0) == (11 ? v0 : a1[3][4])) : ((81 || v3) % 3));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v0 = (((i1 % 1) % 9) <= ((52 % 9) != (a0[9] > a1[2][2])));
+                    v0 = (((i1 ? i1 : a0[4]) / 4) / 8);
+                    v2 = (((i1 + i1) < (v0 && v3)) > ((0 <= v1) < (3 - a1[3][10])));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[7] = (((a0[11] && a0[8]) ? (15 != 31) : (v2 >= a1[3][1])) >= ((v2 > a1[1][9]) <= (v0 || 14)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v1 = (((a1[1][7] >= a0[6]) == (45 - v0)) > ((i2 / 2) > (v1 - i2)));
+        a0[7] = (((a1[0][0] - v3) && (a1[2][15] ? 25 : v3)) != ((85 < 44) ? (v1 % 9) : (a0[1] >= v3)));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((a1[1][9] * a0[12]) - (i3 <= i3)) == ((i2 >= v1) / 2));
+                v0 = (((i2 < v0) != (a1[3][12] && 2)) && ((i2 > a1[3][2]) < (41 > a1[0][1])));
+                v1 = (((28 && a1[0][3]) % 9) ? ((v3 > 93) ? (93 * 21) : (i3 == 68)) : ((a1[1][8] * i2) ? (81 ? 20 : a0[5]) : (v0 && v3)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+    }
+    v3 = (((v3 + v0) || (v0 ? v1 : v0)) <= ((a0[8] + v1) == (v1 < a0[5])));
+    if ((((v1 >= v3) % 1) ? ((72 != a0[6]) == (3 < v2)) : ((26 * 99) * (v0 + 15)))) {
+        v2 = (((v0 > 16) + (a1[0][15] ? a0[4] : 58)) - ((a1[1][10] <= a1[3][15]) <= (84 % 6)));
+        v3 = (((v1 && 26) && (v0 ? a0[5] : v1)) + ((73 / 5) % 4));
+        v2 = (((v0 / 9) < (96 != 27)) && ((v0 ? v0 : v3) || (v3 && a0[9])));
+    } else {
+        v1 = (((44 <= v0) / 2) + ((25 % 3) >= (81 >= 19)));
+        v0 = (((39 - 25) < (83 > v3)) > ((32 || v0) == (a0[11] == a0[15])));
+        v2 = (((a0[15] == v2) ? (75 * v3) : (37 != 87)) < ((v1 == a0[3]) >= (v0 / 9)));
+    }
+    if ((((v1 <= 4) == (v0 <= v3)) ? ((v0 ? v0 : 20) >= (v1 < v3)) : ((a1[1][14] * 70) >= (84 * 69)))) {
+        v0 = (((v2 ? 12 : v1) != (86 == v0)) != ((a1[0][8] != v0) + (93 / 3)));
+        v2 = (((10 >= a1[2][0]) / 7) / 3);
+        v0 = (((a1[3][15] < v3) >= (47 == 94)) / 5);
+    } else {
+        v1 = (((v1 <= v1) > (v0 >= v0)) - ((a1[3][10] % 8) != (a0[3] ? v0 : v3)));
+        v0 = (((v1 % 7) + (v3 % 2)) != ((a1[0][2] >= a0[4]) <= (v2 != v0)));
+        a1[3][8] = (((v1 + a0[2]) || (v2 * v3)) >= ((a1[3][8] / 3) || (v0 >= a1[2][6])));
+    }
+    return (((v0 <= 49) || (v0 != v2)) <= ((a1[0][8] == 73) > (v3 * v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,72 @@
+int f0() {
+    int v0 = 89;
+    int v1 = 36;
+    int v2 = 96;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][2] = (((i0 + a0[10]) + (i0 / 2)) - ((v1 * a0[1]) % 5));
+            a1[0][3] = (((v3 > v0) > (a0[11] % 2)) > ((a1[3][3] != a0[0]) != (a1[1][5] - a1[1][4])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((v0 ? a0[8] : v1) ? (43 - a0[5]) : (v3 && v2)) - ((a0[13] < v3) != (a0[0] && v1)));
+                a1[0][4] = (((92 ? a1[2][1] : v3) + (55 ? a1[1][4] : a0[15])) * ((a0[8] ? 77 : v0) <= (a0[10] || v3)));
+                v1 = (((i1 >= a0[14]) <= (7 && v3)) == ((i0 - 51) + (i1 <= a0[2])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v2 = (((34 ? 38 : 22) + (42 && v0)) ? ((v1 >= v0) == (i2 != v2)) : ((i2 == v3) ? (i2 && 35) : (a1[2][11] >= 67)));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v3 = (((87 >= v0) == (v3 < a1[3][2])) > ((i2 > 56) == (v3 >= i3)));
+                v0 = (((i2 >= a0[9]) * (a0[8] ? a0[11] : 10)) > ((a1[1][1] * a1[3][12]) > (i2 + a1[3][1])));
+                v3 = (((i2 > a1[0][0]) == (i3 && a0[5])) * ((a1[1][9] || v1) * (a1[2][14] ? i3 : v1)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((v1 || v1) < (v0 > a0[0])) || ((55 > a1[2][2]) / 4));
+    }
+    if ((((v0 && v3) || (34 % 9)) ? ((a1[1][9] % 9) * (v3 - 41)) : ((v3 <= v1) ? (v1 && v3) : (a1[0][8] != v1)))) {
+        v0 = (((v2 > v3) > (v0 - v0)) != ((75 ? 72 : v1) % 1));
+        v1 = (((88 * v0) + (85 <= v0)) >= ((v2 - v2) + (a0[5] % 8)));
+        v2 = (((v2 % 9) && (a1[2][9] ? a1[0][3] : v1)) > ((a1[2][2] != v0) + (v0 > v2)));
+    } else {
+        v3 = (((a1[2][10] + a0[8]) || (v0 / 7)) < ((37 + a1[0][6]) && (v2 + v0)));
+        v0 = (((66 / 4) <= (a0[12] * v0)) >= ((v2 < a1[3][14]) >= (v3 / 6)));
+        v2 = (((v0 > 40) > (a0[4] < a0[13])) != ((v0 >= v0) ? (v2 - v2) : (v2 == a0[11])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v2 = (((v0 - 61) + (v3 ? 57 : 73)) ? ((a1[1][0] % 8) * (40 >= v1)) : ((35 + v0) ? (v3 / 6) : (v2 && v0)));
+            v2 = (((v0 + 55) < (v3 ? v3 : v0)) ? ((a1[0][8] + a1[0][9]) - (62 > 5)) : ((a0[10] ? a0[3] : a1[1][10]) / 5));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((88 ? v2 : i4) > 61) break;
+                v2 = (((a0[9] + a0[15]) * (20 || 73)) ? ((v0 / 6) != (v1 >= v1)) : ((a0[8] || 60) + (v0 < v2)));
+                v0 = (((v0 - 14) > (v2 && a0[12])) == ((a0[14] % 8) || (v2 + v1)));
+                v0 = (((24 % 5) > (a0[1] + i5)) != ((3 <= a1[0][6]) <= (v3 * i5)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 - v3) ? (49 != a1[1][12]) : (34 / 9)) * ((v1 ? 46 : a0[3]) <= (v1 ? 2 : a0[10])))) {
+        v3 = (((4 != 81) % 8) > ((v1 || a1[0][9]) && (v0 % 8)));
+        v1 = (((v2 - v2) == (v2 / 6)) ? ((v0 > 25) <= (v0 <= v1)) : ((v2 < v1) != (v2 == 73)));
+        a0[6] = (((v3 - 15) <= (15 > v3)) ? ((v0 / 7) / 4) : ((85 + v2) > (v3 == a0[7])));
+    } else {
+        v1 = (((v3 == v2) + (v1 ? v3 : a1[3][3])) ? ((v0 || v3) <= (55 && 84)) : ((a0[8] == 46) % 8));
+        v1 = (((v2 + 65) != (v2 + a1[0][13])) > ((a0[4] && v0) >= (v3 > v0)));
+        v0 = (((v1 ? v2 : a1[2][3]) / 7) < ((a0[8] <= 61) == (v3 * 27)));
+    }
+    return (((v0 / 5) ? (v2 + 9) : (v3 < v1)) != ((49 && v0) ? (v0 * v3) : (94 && 34)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,72 @@
+int f0() {
+    int v0 = 42;
+    int v1 = 74;
+    int v2 = 86;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a1[1][11] = (((v3 || v3) > (v1 * i0)) - ((v3 < i0) > (v1 < v3)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                v0 = (((v1 + 13) ? (v3 + 55) : (39 + v0)) % 1);
+                v3 = (((v0 + 23) > (a1[2][6] || v1)) == ((i1 != v0) && (a1[1][11] || i0)));
+                v2 = (((81 == 47) >= (45 != i1)) / 9);
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((9 >= a0[8]) * (v2 && a1[1][14])) ? ((v1 != a0[0]) % 4) : ((v3 / 4) / 9));
+    }
+    if ((((a1[1][6] < v0) / 3) ? ((62 <= v0) > (19 < a1[0][14])) : ((60 % 1) < (a0[0] % 5)))) {
+        a0[1] = (((v1 - 39) + (v3 >= v2)) - ((v2 || v0) > (61 + v1)));
+        a0[15] = (((74 != 93) ? (v3 ? a1[3][11] : v2) : (73 - a0[14])) <= ((a1[0][1] && a0[4]) != (98 % 5)));
+        a0[6] = (((v3 >= v2) * (v3 ? v0 : v2)) && ((a0[0] ? v3 : 71) % 8));
+    } else {
+        v1 = (((a0[2] && 46) ? (57 == a1[0][14]) : (56 || v0)) / 5);
+        v1 = (((a1[3][5] <= v2) >= (v2 ? v0 : v3)) % 4);
+        v3 = (((v0 == v2) || (a0[10] >= a1[2][11])) == ((0 <= v0) - (v1 - a0[12])));
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((15 ? 51 : v0) + (i2 * i2)) && ((v2 ? 60 : v3) && (i2 < a0[14])));
+            v0 = (((71 < v0) ? (v0 > a0[1]) : (i2 != 99)) ? ((31 == v3) != (v1 > a1[0][7])) : ((i2 + a1[0][0]) == (v3 < v3)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                if ((80 >= v1) > 85) break;
+                a0[15] = (((73 >= 75) ? (40 >= i2) : (i3 - a0[2])) * ((a1[2][14] || a0[5]) > (i2 != 53)));
+                a1[1][13] = (((93 % 6) + (a1[2][7] || v3)) == ((i2 > a0[14]) > (a1[2][1] + a1[0][12])));
+                v2 = (((i3 + a1[3][7]) && (i2 + v2)) != ((i2 > 52) <= (i3 && v2)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((a0[7] % 5) > 63) break;
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v3 = (((v3 - v0) / 1) < ((v3 - i5) == (v2 <= a1[3][2])));
+                v1 = (((v0 ? v3 : a1[1][5]) ? (46 || v3) : (i4 ? v1 : 61)) ? ((40 - 19) / 4) : ((60 == v0) % 2));
+                a0[5] = (((53 != a0[11]) >= (a1[0][8] || 49)) ? ((v2 > a1[1][8]) != (v0 ? v3 : v3)) : ((i5 * i5) / 1));
+            }
+            a1[3][11] = (((a1[0][8] >= 17) * (v3 >= 93)) % 3);
+            a1[0][2] = (((i4 >= i4) % 7) ? ((a1[3][15] / 2) + (v0 + v0)) : ((a0[2] != 75) >= (a1[2][15] ? v1 : v0)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            if ((a0[15] == i6) > 91) break;
+            v3 = (((a1[3][4] && v1) >= (v3 == i6)) || ((a1[3][6] > v1) / 3));
+            v0 = (((49 > v2) ? (a0[2] || v0) : (v3 < a0[7])) * ((80 == 9) ? (v0 ? i6 : v3) : (i7 >= i6)));
+            v0 = (((a0[14] != v1) >= (v0 && i7)) >= ((34 != i7) ? (55 ? 23 : 58) : (75 - a1[0][11])));
+        }
+        a1[2][2] = (((v3 - a1[2][4]) == (66 % 2)) == ((17 == 82) * (3 * a1[0][8])));
+        v2 = (((v3 * a1[2][11]) + (i6 && v3)) * ((62 ? 93 : v3) ? (4 >= i6) : (a1[2][14] ? a0[11] : v1)));
+    }
+    return (((v3 / 3) / 4) || ((v3 >= 0) != (a0[11] ? a1[2][13] : a1[2][8])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,92 @@
+int f0() {
+    int v0 = 20;
+    int v1 = 49;
+    int v2 = 98;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][14] <= v3) * (a0[6] ? 40 : v1)) + ((40 && v0) != (v3 ? v1 : 55)))) {
+        a0[10] = (((v2 <= v2) ? (v3 % 9) : (v1 != 70)) * ((v3 / 5) - (v1 - v1)));
+        a0[6] = (((v3 && a0[5]) >= (v2 % 6)) > ((v2 ? 70 : 70) <= (v1 <= v3)));
+        v2 = (((v3 >= 40) * (a1[1][14] < v0)) <= ((v0 >= v2) < (v1 || 37)));
+    } else {
+        v2 = (((v0 / 7) > (v2 < v1)) && ((v0 > 91) - (a0[13] ? v2 : v2)));
+        v1 = (((v2 == v1) > (v1 < a0[7])) * ((28 - v3) - (a1[3][15] ? v2 : v1)));
+        v0 = (((29 / 2) && (31 * v2)) <= ((91 % 7) < (a1[3][6] - v1)));
+    }
+    v2 = (((v1 == 73) >= (a1[1][2] % 7)) > ((v2 * 91) * (v3 + v2)));
+    if ((((v3 != 28) + (v3 ? v3 : 79)) + ((v2 / 4) / 4))) {
+        v0 = (((v2 >= a0[8]) != (v1 && a1[1][15])) - ((v3 % 8) - (39 == 39)));
+        v1 = (((99 <= a0[4]) - (v1 ? v1 : a0[0])) % 3);
+        v2 = (((v2 / 8) * (v3 / 1)) < ((1 / 1) <= (v3 || v2)));
+    } else {
+        v2 = (((v3 || a0[13]) % 1) - ((v2 + 91) < (v0 <= v0)));
+        a1[3][14] = (((v3 < a0[14]) + (v1 || v2)) % 7);
+        v2 = (((a1[0][7] + v0) || (v3 % 5)) ? ((a0[4] * v0) != (a0[2] + v2)) : ((v3 ? v1 : a1[1][10]) == (55 * a1[0][0])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v0 = (((a1[2][12] < 43) - (v1 % 4)) / 1);
+                v3 = (((i1 <= a0[13]) % 7) < ((a0[15] != i1) ? (a0[13] ? i0 : 68) : (v1 <= v2)));
+                a0[4] = (((72 > v0) > (89 % 8)) + ((11 / 2) <= (v0 || a1[2][7])));
+            }
+            v3 = (((a0[8] && a0[3]) + (a1[3][3] != a0[3])) != ((i0 || v0) ? (v2 % 9) : (a1[1][8] * 61)));
+            v0 = (((v1 == 67) != (61 / 8)) + ((i0 == v3) != (a1[0][6] || v0)));
+            i0 = i0 + 1;
+        }
+    }
+    a0[4] = (((a0[8] - v0) / 7) && ((v1 + a1[3][0]) < (v3 > v1)));
+    return (((v0 * v0) ? (v1 < 43) : (v2 < 48)) < ((v1 - 23) - (v1 + v1)));
+}
+int f1() {
+    int v0 = 5;
+    int v1 = 42;
+    int v2 = 35;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((i1 || i1) > 83) break;
+                v2 = (((77 + v0) % 3) || ((v2 == a1[0][13]) * (24 ? 64 : v2)));
+                v1 = (((v2 <= 64) && (a0[11] % 1)) / 6);
+                v2 = (((i1 % 4) != (a1[0][0] ? v2 : a0[8])) ? ((i1 || i1) / 6) : ((a1[2][11] != 7) % 2));
+            }
+            v1 = (((3 || v0) != (v1 >= 61)) == ((38 ? v0 : 67) && (v1 != 41)));
+            v1 = (((a1[2][7] / 2) % 2) % 1);
+            i0 = i0 + 1;
+        }
+    }
+    a1[1][1] = (((a1[0][2] ? 25 : v2) >= (v1 * v1)) ? ((a0[2] == v2) < (a0[5] == 28)) : ((a0[8] + v0) > (v3 <= a0[10])));
+    if ((((a1[1][6] < v0) ? (v1 < a0[5]) : (v0 / 8)) * ((v2 || v3) == (v2 < a0[14])))) {
+        a0[4] = (((a0[12] / 2) == (a0[12] / 5)) - ((a1[1][13] % 5) * (v1 * a0[10])));
+        a0[11] = (((4 || 53) + (v2 / 9)) <= ((a1[0][9] && v2) * (v2 >= 12)));
+        a0[3] = (((54 >= v0) + (v1 ? 95 : v3)) ? ((a0[7] && 47) ? (v0 <= v0) : (v2 != 12)) : ((a1[2][0] < v0) * (a0[4] || v3)));
+    } else {
+        v1 = (((88 == v2) / 2) * ((v0 >= a0[8]) != (v3 < 88)));
+        v0 = (((52 - 15) || (7 != v2)) || ((v2 < v2) % 5));
+        v3 = (((v2 && a1[2][15]) - (v0 < a1[1][3])) - ((v3 ? v1 : v1) == (v3 / 6)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v0 = (((16 || a0[2]) - (v2 >= v1)) > ((v0 > v2) < (a0[3] - v1)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v3 = (((77 < a1[2][11]) > (a0[10] <= v2)) || ((v3 != a1[2][10]) == (78 ? i3 : 10)));
+                v2 = (((a1[3][3] ? i2 : i3) + (a0[0] - v2)) % 7);
+                v3 = (((a0[4] % 6) * (a1[3][15] % 5)) + ((v1 || 91) - (i2 >= v0)));
+            }
+            a0[2] = (((a0[7] * v1) <= (92 <= v1)) ? ((74 > a1[0][1]) * (v2 == 30)) : ((v0 ? v0 : v3) == (v0 < a0[13])));
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v2 ? 46 : 64) >= (v2 % 2)) * ((v3 % 2) >= (a0[15] == a0[4])));
+    return (((a1[3][15] != 33) == (v3 * a1[2][11])) + ((v0 ? a0[13] : 16) ? (a0[9] != v2) : (56 != v2)));
+}
+int main() {
+    return 0;
+}
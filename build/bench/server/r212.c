@@ -0,0 +1,164 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 52;
+    int v2 = 80;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    a1[3][4] = (((v3 != v1) && (a0[3] % 4)) < ((v2 + v2) < (v1 == v0)));
+    if ((((a0[1] == v3) - (v2 * 47)) && ((v3 || v0) >= (v3 % 9)))) {
+        v1 = (((v3 / 4) && (v1 && v3)) == ((v2 >= 55) >= (v3 - v3)));
+        v0 = (((78 * v0) ? (a0[1] < a0[8]) : (v2 + 42)) - ((52 ? v2 : v1) < (v0 && v2)));
+        v2 = (((a0[6] < a1[0][5]) < (v3 == v1)) >= ((66 < 36) != (v1 ? v2 : 74)));
+    } else {
+        v3 = (((v0 || v0) < (a1[2][2] >= 96)) % 7);
+        v2 = (((a0[2] * 28) < (v0 * v2)) <= ((a1[0][6] || v3) % 2));
+        a1[1][1] = (((v3 - v3) - (a0[13] ? 27 : v1)) == ((v1 || v1) && (v0 / 1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((50 < 58) > 77) break;
+            v3 = (((74 - 77) < (v0 <= a0[15])) * ((87 <= a0[15]) ? (a0[7] < 30) : (i0 && a0[7])));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a1[1][14] * v0) > (a0[11] > a0[8])) * ((v3 / 5) / 1));
+                    v1 = (((v2 != v0) / 9) == ((v0 ? v0 : a1[1][13]) % 2));
+                    v2 = (((v2 >= a1[0][0]) <= (a0[14] % 2)) && ((37 != a0[7]) < (52 - v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            a1[3][2] = (((43 / 1) != (v3 % 4)) / 5);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v1 % 5) % 3) >= ((i2 || v2) < (i2 ? 26 : v0)));
+            {
+                int i3 = 0;
+                do {
+                    if ((86 / 8) > 50) break;
+                    v0 = (((a1[0][4] && v2) >= (v1 % 7)) * ((a0[0] <= v0) * (a0[14] && a0[14])));
+                    a1[1][3] = (((68 == i2) % 8) <= ((a1[2][2] == a1[2][5]) + (i2 + a1[3][8])));
+                    a1[1][10] = (((a0[6] ? 84 : i3) - (a1[1][14] % 4)) <= ((v1 != i3) || (a0[11] > i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v1 = (((a1[0][6] < 62) / 3) == ((v1 ? a0[14] : a0[3]) || (v1 - v3)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v1 == v0) - (v1 != 76)) * ((42 + v1) - (v1 % 9)))) {
+        v2 = (((a1[1][15] < v0) || (v1 || v3)) ? ((v1 > v1) < (47 <= v3)) : ((a1[3][9] ? a1[2][6] : a1[1][5]) - (17 - 18)));
+        v2 = (((66 > v2) <= (a1[1][5] != v3)) ? ((45 / 4) / 3) : ((a0[5] / 9) == (a0[13] != a0[5])));
+        a0[1] = (((v1 >= a0[11]) ? (v2 - v3) : (74 <= a0[9])) > ((v1 ? v2 : a1[1][4]) - (v0 < v3)));
+    } else {
+        v1 = (((70 < v3) / 1) < ((a1[2][6] >= v2) || (v3 >= v3)));
+        v2 = (((v3 ? v3 : v0) + (a1[1][13] ? v3 : v3)) <= ((v3 * 10) % 6));
+        v2 = (((51 < 42) && (a1[1][10] - 80)) <= ((86 || 27) + (v2 * a1[1][7])));
+    }
+    return (((v0 || 47) ? (v0 > v0) : (21 && v3)) <= ((a0[0] ? v3 : v3) < (a1[2][8] < v3)));
+}
+int f1() {
+    int v0 = 30;
+    int v1 = 91;
+    int v2 = 77;
+    int v3 = 42;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[0][15] ? 37 : v1) == (a1[0][8] < 59)) != ((10 < a0[5]) <= (v2 || 55)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                do {
+                    if ((v3 != 25) > 50) break;
+                    v0 = (((v2 || a0[6]) && (48 <= a1[0][13])) > ((a0[15] && v0) + (a0[9] / 3)));
+                    v1 = (((a0[8] * i1) != (50 || 61)) > ((a0[1] || 29) != (v1 ? i1 : v3)));
+                    a1[1][1] = (((a1[0][7] && v1) - (v0 >= 18)) % 5);
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a0[0] = (((a0[0] > a1[1][7]) ? (i0 * v0) : (a1[1][10] / 9)) + ((v2 != v2) - (v0 - 42)));
+            a0[3] = (((a0[6] / 4) - (i0 != i0)) ? ((v0 == 21) == (v2 / 3)) : ((a0[5] ? 95 : v3) >= (a1[0][0] ? 86 : v1)));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((37 + v2) * (v0 && v2)) == ((v3 <= 1) && (v1 == v0)));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a1[2][1] = (((a0[2] != 89) + (a0[9] / 5)) > ((1 && i2) - (42 / 1)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                a0[14] = (((a1[1][14] ? 61 : a0[4]) == (v3 >= 39)) >= ((3 ? v3 : v2) - (86 % 9)));
+                v1 = (((a0[15] > i2) - (a1[0][12] >= 57)) * ((0 * i2) || (a0[11] + 58)));
+                v1 = (((v2 < v1) + (39 == i2)) <= ((10 ? 25 : i2) + (88 < v1)));
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((a1[3][0] && v1) + (v0 - a1[2][15])) ? ((v1 != v1) ? (i2 ? v3 : 97) : (v3 % 6)) : ((68 + v0) / 5));
+    }
+    a1[1][14] = (((v2 - v0) && (v0 == v0)) && ((a0[8] + v0) && (a0[8] * a1[2][6])));
+    return (((v0 && a1[0][7]) <= (v2 * v1)) / 6);
+}
+int f2() {
+    int v0 = 74;
+    int v1 = 98;
+    int v2 = 43;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v3 = (((v1 + 49) <= (a1[2][4] * 36)) + ((a1[1][11] * v3) <= (v3 + v1)));
+            v0 = (((51 != i0) / 6) && ((v3 < v0) && (0 * v0)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a0[7] % 3) == (a1[1][5] >= v1)) || ((i0 || 54) <= (a0[12] && 25)));
+                    a0[4] = (((v0 == a0[6]) <= (i0 > 48)) || ((a0[5] != 44) > (a0[14] <= 25)));
+                    a1[3][5] = (((i0 >= a0[10]) < (17 / 1)) > ((a1[1][1] != i0) && (12 - i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v2 && a1[3][14]) && (v3 < v1)) - ((v0 > a1[3][13]) || (29 % 5)));
+    a0[10] = (((37 / 3) && (a0[10] || v2)) % 7);
+    {
+        int i2 = 0;
+        do {
+            a1[3][2] = (((v1 / 5) - (v0 ? v1 : v2)) / 8);
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v3 * i3) == (74 >= 42)) / 7);
+                    v1 = (((v0 - 16) * (80 || v2)) >= ((23 != i2) * (v2 ? v1 : v0)));
+                    a0[5] = (((a0[8] <= v1) >= (v0 + v2)) ? ((v1 > a0[7]) / 2) : ((i3 > 74) != (i2 != v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v2 = (((v0 / 9) ? (v3 ? 31 : a0[4]) : (v3 <= 64)) * ((i2 ? v1 : v0) * (a1[1][7] && v0)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((v3 * 89) == (v0 ? 25 : 1)) * ((v1 - v2) != (77 <= v0)))) {
+        a0[3] = (((a1[0][2] ? v2 : v1) < (a1[3][9] ? v3 : v0)) - ((a0[10] && v3) == (v0 && v3)));
+        v1 = (((a0[15] && a0[8]) && (55 <= a1[1][12])) / 2);
+        v1 = (((a0[1] != v0) || (21 != a1[0][5])) / 2);
+    } else {
+        a1[3][15] = (((v2 + v3) == (v1 % 3)) <= ((a1[1][5] - v3) % 2));
+        a1[3][8] = (((a1[1][14] ? v1 : v3) ? (74 && a1[0][15]) : (a0[14] / 1)) >= ((a1[0][6] ? 85 : 53) - (a0[0] ? a1[1][5] : v2)));
+        a1[2][7] = (((65 ? v3 : 80) >= (a1[3][5] ? a0[11] : v3)) >= ((42 + v0) < (21 ? a1[1][12] : a0[3])));
+    }
+    return (((v3 || 56) || (a1[3][15] * a1[3][10])) || ((v0 ? a0[15] : v3) == (16 ? a0[15] : v3)));
+}
+int main() {
+    return 0;
+}
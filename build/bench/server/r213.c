@@ -0,0 +1,68 @@
+int f0() {
+    int v0 = 17;
+    int v1 = 9;
+    int v2 = 17;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((52 >= v3) * (44 <= v3)) || ((a1[1][3] > v2) % 2));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((v0 <= 31) > 97) break;
+                    a1[2][8] = (((v1 / 9) ? (91 < i0) : (49 < v1)) == ((a1[2][11] % 1) <= (v2 < 38)));
+                    v2 = (((a0[13] || i1) - (a1[2][3] * 64)) - ((47 != i1) == (v0 > v1)));
+                    a1[2][0] = (((8 && a1[2][13]) / 4) / 8);
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][9] = (((a0[5] + 46) != (a0[9] / 5)) ? ((92 <= a1[1][8]) > (a1[0][13] - i0)) : ((v3 + v0) || (a1[1][4] || v3)));
+            a1[3][3] = (((2 ? v3 : v2) - (v3 * 5)) || ((61 % 8) != (v2 <= a1[2][7])));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((1 || a0[4]) / 5) >= ((a0[4] <= 25) == (a0[15] || 40)))) {
+        v2 = (((29 ? v3 : a1[1][7]) ? (v3 * v2) : (a1[0][15] % 1)) ? ((a1[1][13] >= v2) % 1) : ((a0[3] % 7) ? (v1 * v0) : (10 ? a0[12] : 74)));
+        a1[0][7] = (((66 && v3) % 3) % 5);
+        v3 = (((a1[2][12] || 23) / 3) * ((v0 == a0[9]) >= (v0 != v2)));
+    } else {
+        a1[3][11] = (((v0 >= 72) <= (v1 != a0[5])) >= ((a1[3][0] <= v3) ? (a1[3][9] > v3) : (v1 && 4)));
+        v0 = (((37 + v3) != (a1[3][9] ? v1 : v0)) ? ((a0[5] ? a1[2][15] : v3) == (a1[2][8] == v1)) : ((85 <= v3) ? (93 >= v1) : (v0 <= 51)));
+        a1[0][9] = (((v0 < a0[15]) >= (a0[6] == a1[2][4])) ? ((v3 ? 96 : v2) <= (a0[1] > v1)) : ((v0 + a1[1][9]) - (64 >= 73)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((a1[2][4] < i2) > 89) break;
+        v3 = (((6 == v3) == (v3 / 8)) + ((49 % 7) / 3));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v3 = (((i3 > v2) + (6 || i3)) ? ((v2 || v0) % 8) : ((i2 != a0[1]) && (a0[2] && v0)));
+            v3 = (((a0[15] && v3) / 1) + ((35 != 57) - (a1[0][0] && v0)));
+            v1 = (((55 > a1[2][11]) <= (i2 * v3)) <= ((v3 ? i3 : a1[1][0]) - (76 - a0[3])));
+        }
+        v3 = (((a0[0] ? v1 : 75) && (a0[2] < a0[9])) ? ((v3 * v1) && (a0[13] > v3)) : ((22 || i2) ? (3 * 23) : (i2 <= a1[3][11])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v3 = (((54 ? a0[14] : a0[4]) || (14 >= i4)) % 3);
+            {
+                int i5 = 0;
+                do {
+                    if ((i5 ? a0[14] : i4) > 57) break;
+                    v0 = (((v1 - 90) || (a1[3][1] >= a1[3][8])) <= ((v3 != v3) % 3));
+                    a0[2] = (((85 > i4) == (a1[2][10] >= i5)) >= ((v0 <= a0[10]) ? (a1[1][3] != a0[1]) : (a0[12] == a0[7])));
+                    a1[1][12] = (((v2 <= 81) + (v3 - a0[9])) >= ((v3 % 8) && (42 % 5)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v3 = (((53 + v0) * (v3 && v3)) < ((73 ? a1[3][13] : v2) && (v2 < v2)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[7] * v0) < (v0 * 97)) > ((a1[3][11] && v3) / 5));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,169 @@
+int f0() {
+    int v0 = 98;
+    int v1 = 58;
+    int v2 = 80;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a0[6] = (((v0 ? a0[13] : v2) ? (v2 < a0[6]) : (a0[11] || v0)) ? ((a1[3][1] / 9) > (a0[4] + 13)) : ((v3 / 2) != (v2 <= v2)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((50 > a0[10]) > 57) break;
+                    a0[14] = (((i1 ? a1[2][11] : a0[15]) > (i0 > i0)) <= ((v0 % 9) != (66 ? a1[0][7] : 63)));
+                    a0[3] = (((a1[2][14] == 79) + (i1 && 0)) >= ((v1 != a1[2][9]) % 3));
+                    v0 = (((a0[7] == a0[0]) ? (i1 ? v1 : v2) : (i1 != i1)) >= ((i0 ? i0 : a1[2][3]) % 6));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v3 % 7) < (v3 * a1[1][7])) - ((a1[1][14] == a0[15]) ? (i0 != a1[0][15]) : (16 ? 59 : v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                a0[8] = (((a0[12] > i2) % 4) ? ((v3 != i2) >= (i3 ? i3 : a0[0])) : ((a1[2][4] % 9) ? (44 && 88) : (a1[0][3] * 25)));
+                v2 = (((i2 / 5) * (i2 >= i3)) > ((v1 > a0[2]) / 3));
+                a1[1][12] = (((v0 == v2) / 2) < ((i2 > v1) == (26 % 3)));
+            }
+            a0[6] = (((i2 <= 87) % 3) == ((a1[3][15] ? 58 : 14) + (v2 % 6)));
+            v3 = (((4 && a0[15]) != (v1 > a1[1][10])) <= ((i2 > v1) - (9 ? i2 : 17)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((a1[0][3] ? i4 : 93) - (v0 + v0)) > ((v2 >= 77) && (a1[0][12] || i4)));
+        a0[4] = (((a1[1][14] / 7) * (v3 / 1)) != ((84 / 9) != (36 ? i4 : 98)));
+        {
+            int i5 = 0;
+            do {
+                if ((v3 * 21) > 78) break;
+                v2 = (((a0[7] >= v3) + (2 * i4)) || ((v3 * v3) && (a1[2][8] * a1[2][8])));
+                v2 = (((v2 != 35) <= (v2 >= v2)) != ((v2 % 7) <= (49 - i5)));
+                v3 = (((40 >= v0) % 3) >= ((a1[1][6] && a1[3][14]) && (6 == 44)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+    }
+    if ((((v1 * v0) % 1) ? ((v0 % 3) || (v3 != v1)) : ((v2 == 87) ? (8 / 9) : (a1[0][1] - v3)))) {
+        v0 = (((a0[12] == a0[9]) != (v0 % 4)) ? ((v1 == 25) ? (v2 != a0[15]) : (v2 ? v1 : 65)) : ((66 > v0) + (94 * 13)));
+        v0 = (((v3 < a1[0][12]) > (33 % 8)) < ((a1[1][4] * 0) > (28 + v0)));
+        v0 = (((a1[3][3] ? 48 : a1[3][0]) ? (3 == v3) : (v1 - 98)) - ((a0[7] || v2) || (v3 == v0)));
+    } else {
+        v0 = (((a0[14] * a0[2]) && (v2 == v0)) == ((a0[4] + a0[15]) ? (a1[0][11] - 39) : (v0 >= v3)));
+        v2 = (((v0 / 4) > (a1[0][11] ? a1[1][2] : a1[0][12])) ? ((v2 ? a0[4] : 73) && (a1[1][1] != 90)) : ((a0[2] % 1) / 7));
+        v1 = (((v3 + v0) <= (v1 && 1)) + ((v3 >= 56) || (v1 % 4)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            {
+                int i7 = 0;
+                do {
+                    if ((a0[8] || v0) > 72) break;
+                    a1[0][12] = (((5 < a1[1][11]) != (i7 * 65)) || ((a0[14] <= v0) - (a0[14] <= v2)));
+                    v2 = (((v1 - 48) >= (42 / 1)) * ((79 >= a1[2][0]) <= (v2 + 73)));
+                    a1[3][15] = (((v2 > i6) > (a0[10] <= a1[2][12])) != ((v3 % 2) ? (1 * 69) : (v0 % 6)));
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            v2 = (((v2 * a1[0][4]) || (2 >= 94)) >= ((a1[0][2] != i6) ? (v0 || 57) : (i6 / 1)));
+            a0[14] = (((a0[5] + 53) > (90 * v1)) / 3);
+            i6 = i6 + 1;
+        }
+    }
+    return (((a1[3][9] == 84) / 2) - ((a0[15] >= v1) <= (92 > a0[10])));
+}
+int f1() {
+    int v0 = 10;
+    int v1 = 84;
+    int v2 = 45;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][12] = (((a0[7] ? v2 : v0) + (83 % 7)) && ((v0 * 72) > (7 != i0)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((a1[3][12] ? 94 : a1[1][8]) > 94) break;
+                v3 = (((a0[14] + 39) < (a1[0][2] ? i0 : v3)) + ((i1 - v0) - (v2 ? v0 : a1[1][9])));
+                v2 = (((97 / 8) ? (85 >= 45) : (23 <= a0[15])) == ((59 <= a0[0]) ? (v1 - a1[1][0]) : (5 < 15)));
+                a1[0][1] = (((v0 - 48) == (i1 >= 91)) || ((a1[1][10] > v0) ? (a0[0] + a1[3][7]) : (i0 || a1[2][5])));
+            }
+            a1[2][12] = (((v3 >= v3) ? (a0[3] != a1[1][15]) : (a0[11] >= v0)) ? ((56 || v0) / 2) : ((a1[0][0] == i0) >= (a1[2][0] * 92)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v0 = (((a0[10] != 98) > (67 / 4)) / 3);
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v3 = (((i3 ? v1 : v3) % 6) < ((a1[2][2] * v3) >= (92 * v0)));
+                v1 = (((v2 ? a1[1][6] : a0[3]) != (v0 - a0[15])) || ((38 == 39) == (i2 + a0[4])));
+                v2 = (((i3 < 44) / 9) - ((a1[1][10] / 1) * (i2 >= 48)));
+            }
+            a1[1][2] = (((80 > a1[2][15]) + (v1 % 2)) / 5);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v0 = (((29 ? 26 : a1[0][1]) ? (11 / 9) : (i4 / 9)) <= ((i4 / 2) && (20 ? 3 : i4)));
+        {
+            int i5 = 0;
+            do {
+                a0[9] = (((50 % 6) / 6) <= ((15 > a1[2][3]) ? (i4 % 5) : (87 == i4)));
+                a0[0] = (((v0 != v1) != (90 >= v2)) || ((a0[7] && a1[0][8]) > (v0 * v1)));
+                v0 = (((i4 && a1[0][2]) / 5) > ((v1 < a1[3][1]) ? (a1[2][6] <= i4) : (18 < 40)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v1 = (((v2 < v2) || (v1 / 7)) / 1);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v0 = (((v1 < a0[10]) >= (a0[11] ? v2 : 79)) >= ((a1[0][11] ? a1[0][13] : 80) > (39 <= 43)));
+            v2 = (((a0[15] || 19) < (v1 <= 59)) != ((a1[0][10] ? v3 : 45) && (a1[1][3] || v0)));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    if ((a1[2][3] / 7) > 95) break;
+                    v1 = (((v1 * 99) > (a1[2][5] ? v0 : a1[2][1])) || ((i7 && v0) > (v3 || a1[3][4])));
+                    v0 = (((a1[1][1] / 4) + (v0 > a1[0][2])) - ((v2 || a0[1]) <= (1 >= a0[2])));
+                    a0[8] = (((a1[1][6] == i7) != (v3 * i6)) == ((v3 < v0) && (37 % 6)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            if ((a1[2][5] >= 55) > 87) break;
+            a0[4] = (((v1 ? 45 : 41) * (a1[1][5] ? 4 : a0[11])) < ((i8 / 2) >= (v0 >= i8)));
+            v1 = (((v2 - v0) || (a0[10] != 70)) ? ((v1 % 5) ? (i8 >= v2) : (a1[3][15] || a0[4])) : ((v0 ? v0 : i8) >= (v1 >= v1)));
+            {
+                int i9 = 0;
+                while (i9 < 8) {
+                    a1[2][5] = (((31 * v0) >= (v0 > v1)) > ((26 >= a0[12]) > (a1[0][9] ? v3 : v3)));
+                    a1[3][2] = (((i8 <= a0[11]) == (i9 % 5)) * ((23 < a0[15]) * (a1[2][9] != v2)));
+                    v2 = (((a0[13] == 86) - (a0[9] < a0[5])) ? ((v0 && v3) ? (i9 || a0[3]) : (i9 ? v1 : i9)) : ((v2 % 7) && (i8 < i8)));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v1 * 10) >= (v3 * v2)) != ((92 / 5) && (a0[2] > v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,229 @@
+int f0() {
+    int v0 = 44;
+    int v1 = 34;
+    int v2 = 75;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 != v2) - (v1 ? v0 : 53)) == ((v1 == v2) % 6));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((8 ? i0 : 99) > 56) break;
+            v0 = (((v3 <= 18) - (a0[10] != v1)) || ((25 && v2) < (27 > 10)));
+            a1[3][9] = (((9 < v2) < (24 <= i0)) + ((v2 ? a1[0][12] : a1[2][5]) <= (v0 >= 67)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v0 = (((i0 && v2) * (65 - v1)) - ((v0 || v2) > (a1[3][15] && a0[1])));
+                v1 = (((a1[3][9] + v1) * (82 <= v2)) >= ((v0 || v0) - (a1[0][1] ? a0[14] : 10)));
+                a0[5] = (((a0[15] - v2) >= (13 && v0)) * ((a1[0][9] == v3) / 5));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v3 = (((a0[5] == i2) != (v0 != 18)) || ((v2 + a0[8]) ? (99 || a1[3][15]) : (v2 - a0[12])));
+        v3 = (((a0[15] > 40) < (a0[14] != v3)) < ((v3 != a1[1][3]) / 8));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                a0[0] = (((i2 - 7) && (a1[2][7] < 91)) <= ((55 > 46) < (92 <= 45)));
+                v2 = (((v2 <= a0[8]) || (v1 && a1[0][6])) % 4);
+                v3 = (((v2 / 5) >= (0 ? a0[9] : v3)) * ((a0[13] == v1) || (a1[3][10] + 35)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((v1 ? v3 : v3) > 84) break;
+        {
+            int i5 = 0;
+            do {
+                v2 = (((v3 * 82) <= (a0[7] && 26)) % 3);
+                v2 = (((15 != 50) > (94 <= v0)) != ((a1[3][15] >= v1) < (i5 < 21)));
+                v1 = (((i5 || 46) != (62 && v0)) + ((v1 != i4) >= (87 / 3)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        a0[7] = (((v3 && v0) && (v0 % 2)) >= ((v0 == v2) % 9));
+        v1 = (((47 || v0) - (a0[1] >= 33)) * ((a0[1] >= v2) > (i4 ? v1 : v0)));
+    }
+    a1[3][5] = (((a1[0][12] / 9) && (v0 / 6)) && ((v1 || a0[3]) / 4));
+    return (((v1 / 2) / 4) ? ((v2 && 7) >= (92 && v3)) : ((v0 == v1) / 7));
+}
+int f1() {
+    int v0 = 31;
+    int v1 = 5;
+    int v2 = 44;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                a0[6] = (((a0[13] / 1) ? (i1 || i0) : (94 || v2)) + ((v2 + v0) > (a1[3][14] <= a1[3][6])));
+                v3 = (((a1[3][1] != a1[0][0]) || (34 / 4)) <= ((v3 && i1) ? (v0 || a1[0][1]) : (86 / 9)));
+                v2 = (((79 - 12) <= (v0 - 84)) || ((28 >= v2) ? (a1[1][4] % 2) : (64 && i1)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[2] = (((a0[2] < 90) < (10 && a1[1][3])) && ((a1[3][6] == a1[1][2]) > (a1[2][6] <= v2)));
+        a0[7] = (((a1[3][8] > v2) ? (a1[3][11] && v1) : (a0[8] && v2)) || ((a0[2] / 5) >= (v1 <= 52)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 != v2) && (v3 || 80)) <= ((60 * v2) > (25 % 3)));
+            a1[1][15] = (((v1 <= 52) + (v1 - i2)) == ((v0 - 87) + (v2 != v0)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v3 = (((i3 >= v1) * (93 / 1)) != ((v3 > a0[2]) && (v3 <= v3)));
+                    a1[3][10] = (((49 < v2) > (1 < a1[2][5])) || ((a1[2][5] == 77) != (v0 ? a0[4] : v1)));
+                    a0[14] = (((11 < a1[3][13]) - (v2 && v3)) != ((a0[14] > v3) && (v3 * i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((4 > a1[0][12]) > 83) break;
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((30 / 7) ? (v3 ? a1[3][0] : 98) : (v3 - 12)) == ((v1 ? i4 : v1) + (a1[3][9] < v0)));
+                    a0[12] = (((a0[3] - a0[7]) % 7) ? ((v0 % 5) * (83 > a0[14])) : ((80 ? a1[2][8] : i4) % 1));
+                    a1[2][3] = (((v2 == 45) || (i5 + v3)) / 2);
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            a0[8] = (((93 >= a1[2][6]) * (v2 / 7)) && ((v2 - 82) - (14 < a1[3][7])));
+            v1 = (((v1 - v0) % 7) * ((i4 < v3) * (i4 ? v3 : v0)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((74 <= 21) > (v0 < a1[0][7])) - ((70 && v3) < (v2 % 8)));
+            v2 = (((a0[9] > a0[13]) % 6) > ((v0 != 16) % 7));
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((8 > v0) || (v0 <= a0[1])) % 3);
+                    a0[9] = (((9 % 7) * (v1 != v1)) && ((v1 / 4) == (98 && v2)));
+                    v0 = (((v0 > i7) ? (i6 + a1[3][5]) : (v2 - a1[1][5])) && ((a0[4] >= v0) <= (v3 >= a0[9])));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    if ((((v3 ? 13 : v2) - (27 % 6)) / 8)) {
+        v1 = (((a1[1][4] % 2) * (29 < v2)) + ((a0[14] + 79) + (0 && a1[1][9])));
+        v1 = (((v0 == 37) / 3) >= ((a0[12] && v0) / 4));
+        a1[1][13] = (((a0[15] < v0) / 6) <= ((8 + v1) || (a0[12] || v3)));
+    } else {
+        a0[9] = (((v0 % 2) < (v1 ? v1 : 96)) + ((v1 % 6) ? (v0 && v1) : (v2 ? v0 : v1)));
+        v3 = (((v1 != v0) != (v2 > a1[2][9])) > ((a0[2] + 28) - (68 * 72)));
+        v3 = (((v3 ? 92 : v2) || (70 % 8)) / 4);
+    }
+    return (((v0 % 9) ? (v3 != v0) : (a1[2][13] % 7)) && ((v1 + v0) * (v2 ? 3 : v2)));
+}
+int f2() {
+    int v0 = 77;
+    int v1 = 76;
+    int v2 = 81;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((77 > 87) * (i0 ? a1[0][12] : a1[3][12])) % 8);
+            {
+                int i1 = 0;
+                do {
+                    a0[13] = (((v1 ? v0 : v3) + (i1 <= 94)) ? ((i1 >= a1[2][2]) <= (a0[8] * i1)) : ((9 / 5) - (v3 || a0[0])));
+                    a1[0][10] = (((a1[3][1] != v0) ? (v3 == v1) : (v1 - v3)) % 8);
+                    a1[3][13] = (((a1[3][4] / 1) != (76 / 4)) == ((i0 <= 4) < (a1[2][10] ? a1[1][8] : 13)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v3 = (((97 && a0[14]) - (v3 < a1[0][9])) || ((v0 > a0[11]) * (10 < a0[10])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((a1[2][3] + a1[2][0]) > 75) break;
+            v3 = (((64 - v3) - (a0[7] ? 93 : 68)) > ((i2 && 51) + (a1[0][1] != v1)));
+            a0[8] = (((a0[2] > v3) < (a1[3][3] == v3)) % 2);
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                if ((v1 == v2) > 77) break;
+                v3 = (((59 == a0[15]) >= (21 ? 88 : v0)) && ((v2 == i3) < (i3 ? v1 : 66)));
+                v3 = (((v1 + a0[0]) + (41 / 9)) >= ((a0[7] * v2) + (a1[1][13] % 6)));
+                v1 = (((a1[2][2] < a0[8]) != (v2 || i3)) == ((v0 < v0) > (a0[13] - 85)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((v2 <= v0) > 72) break;
+                    v2 = (((32 < i5) && (i4 + a1[2][5])) >= ((a1[0][13] > 98) + (v3 < 11)));
+                    v3 = (((v1 || v0) != (8 ? v1 : 69)) == ((v3 <= v3) && (a1[3][1] / 8)));
+                    v2 = (((i4 % 3) ? (a0[11] + i4) : (74 < a1[2][0])) && ((21 || v2) / 4));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[6] = (((v0 > 49) && (v3 % 6)) + ((v1 == v1) ? (v2 / 4) : (v0 != v1)));
+            a0[4] = (((35 * 58) == (v3 && a0[5])) / 3);
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v0 == v1) > 67) break;
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                a0[11] = (((i7 > i6) - (57 % 9)) * ((i7 * 97) != (74 && v1)));
+                a0[5] = (((v3 != v3) % 9) % 9);
+                v3 = (((a0[3] || v3) <= (i6 < 65)) != ((i6 * v3) ? (i6 ? i6 : a1[2][13]) : (a1[3][0] + v3)));
+            }
+            a0[7] = (((v2 * v0) / 5) < ((v2 > 91) ? (v2 == v2) : (v3 <= a0[10])));
+            v2 = (((53 > a0[10]) / 4) ? ((v0 - v0) * (v0 == v0)) : ((a1[1][1] ? v1 : 71) || (37 && i6)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    {
+        int i8 = 0;
+        do {
+            v2 = (((i8 / 8) + (v3 != 1)) <= ((v2 ? 71 : a0[15]) < (46 == v2)));
+            {
+                int i9 = 0;
+                do {
+                    if ((v1 - a1[2][3]) > 72) break;
+                    v2 = (((a1[1][8] || i8) >= (v0 >= v1)) > ((v2 + 3) || (16 && a0[6])));
+                    a1[0][2] = (((87 > i8) < (v3 ? a1[3][12] : 5)) != ((a0[11] > i9) ? (i8 < 0) : (v0 / 5)));
+                    v3 = (((a0[15] < a1[1][1]) != (v2 && a0[2])) ? ((v1 - v2) == (68 == v3)) : ((a1[1][4] == 82) ? (9 * v0) : (a1[1][0] || v2)));
+                    i9 = i9 + 1;
+                } while (i9 < 2);
+            }
+            v2 = (((31 != 20) * (v2 % 5)) && ((a0[9] ? v1 : 12) <= (v0 ? 45 : v3)));
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    return (((a0[5] <= a0[10]) * (96 && v0)) > ((v0 > a1[2][14]) == (v0 && 12)));
+}
+int main() {
+    return 0;
+}
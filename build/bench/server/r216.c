@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 60;
+    int v2 = 5;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v1 = (((a1[3][11] ? v0 : i0) + (v1 == 23)) * ((71 || v3) + (0 >= v0)));
+        v3 = (((26 % 4) / 1) / 4);
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v2 = (((70 >= v3) && (a1[2][3] * 92)) ? ((v1 * a0[7]) + (v0 && v2)) : ((53 > v3) ? (v1 ? v2 : 88) : (v2 / 1)));
+                a1[1][11] = (((a0[12] || 82) && (a0[8] ? 27 : 22)) <= ((v2 ? v0 : i0) <= (i0 ? a1[3][3] : v2)));
+                a1[3][0] = (((v3 ? 35 : v3) <= (v2 && a1[3][2])) >= ((v2 >= 62) * (45 && a1[0][2])));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    a1[0][3] = (((a0[4] / 6) / 8) < ((a1[3][6] && a0[10]) < (a0[7] >= a0[3])));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((a1[3][7] ? a1[3][3] : v3) > 94) break;
+        {
+            int i3 = 0;
+            do {
+                v1 = (((i2 * a0[2]) / 7) / 3);
+                a1[3][6] = (((v1 < a0[6]) || (a0[0] <= v1)) > ((v2 ? i3 : v2) * (a1[3][6] > a0[6])));
+                v1 = (((v1 && v0) - (a1[1][1] && i3)) != ((v0 ? a1[3][15] : 11) % 5));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        v3 = (((a0[5] ? 23 : 11) > (i2 && v1)) <= ((15 >= v2) % 1));
+        v2 = (((a0[8] != 76) < (a1[2][1] ? a0[13] : v1)) ? ((v1 > v0) && (v0 < 71)) : ((v3 == v0) == (a0[6] ? a0[9] : i2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((i4 ? v1 : a0[2]) <= (a1[2][4] * a1[1][15])) ? ((38 * 86) ? (2 > 61) : (a0[7] >= 97)) : ((v1 ? v1 : a1[0][1]) ? (a1[0][6] >= a0[0]) : (a0[10] >= a0[15])));
+            v2 = (((v2 + v0) && (v1 != 8)) == ((84 * a1[0][0]) >= (3 % 1)));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((v3 / 6) / 3) < ((i4 <= 46) != (a1[3][15] != 43)));
+                    v3 = (((a1[1][5] % 1) - (v1 > v3)) != ((11 ? v0 : v1) ? (a0[2] > v1) : (a1[2][6] && a1[2][9])));
+                    a0[8] = (((v1 > 27) == (a1[1][4] && v3)) != ((v3 || v0) || (a0[7] - a1[1][4])));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v3 = (((v1 != 5) + (a1[0][9] > v1)) + ((i6 >= a1[0][7]) != (13 > i7)));
+                v2 = (((v3 * i7) >= (v2 / 6)) < ((v3 ? a0[11] : 73) * (a0[5] > a1[0][2])));
+                v3 = (((a0[11] || a1[3][12]) >= (v3 <= a0[3])) / 6);
+            }
+            v0 = (((76 > 98) / 1) ? ((a1[1][3] == a0[14]) >= (a0[0] - a0[1])) : ((i6 && v1) + (21 ? a1[2][3] : v1)));
+            v0 = (((v1 == v2) % 9) ? ((36 % 7) * (71 / 8)) : ((a1[0][1] > v3) > (a1[3][13] == v3)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((a1[0][9] / 9) || (a1[0][12] && 67)) && ((v1 % 2) && (v1 || 24)));
+}
+int main() {
+    return 0;
+}
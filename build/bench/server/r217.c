@@ -0,0 +1,127 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 34;
+    int v2 = 62;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[0] = (((v3 % 4) != (32 > v1)) && ((i0 * a0[2]) - (v3 || v2)));
+            a1[0][7] = (((a1[3][3] <= a1[3][7]) != (78 % 5)) == ((v1 % 6) != (79 > a0[14])));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((v1 > i0) > 71) break;
+                a0[13] = (((60 < a1[1][2]) && (i1 + 71)) > ((i0 % 3) >= (v3 ? a1[0][13] : a0[0])));
+                v2 = (((58 ? a1[0][2] : 54) <= (a1[3][6] ? a0[13] : i1)) - ((v0 % 1) % 7));
+                a0[9] = (((v0 + a0[5]) != (v1 < a0[2])) || ((v2 + a0[8]) < (i0 % 8)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((13 < i2) > 78) break;
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                a0[1] = (((a1[1][6] ? v3 : a1[2][10]) >= (a0[4] * 87)) != ((45 - 40) != (a0[5] || i2)));
+                v3 = (((v0 > 15) / 6) < ((v2 + v2) < (a1[2][13] < v1)));
+                v1 = (((i3 * a1[2][14]) >= (91 && v1)) % 7);
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((v2 > v0) <= (29 / 7)) ? ((v2 <= v3) % 4) : ((55 || a1[0][2]) ? (v1 == 57) : (50 * 83)));
+        v1 = (((v0 ? i2 : a0[1]) || (v2 - v0)) * ((a0[11] == 95) ? (a0[7] < v0) : (v3 != 10)));
+    }
+    v1 = (((v1 != 75) ? (9 + 49) : (v1 || 46)) || ((v0 / 6) ? (a1[3][12] % 9) : (a1[0][5] * v3)));
+    if ((((a1[3][9] ? 17 : a0[9]) < (v2 < a1[0][10])) * ((a0[7] / 2) ? (v1 > v1) : (v1 != v3)))) {
+        v2 = (((v0 >= v2) % 8) || ((v3 == 91) ? (a0[7] - v2) : (a0[0] + a0[8])));
+        v3 = (((a1[3][10] > v2) >= (v2 ? a0[11] : 39)) > ((4 ? v2 : v3) ? (v0 != v2) : (v3 <= 68)));
+        v0 = (((26 ? v1 : a0[13]) ? (v3 % 7) : (35 != a1[2][15])) <= ((v3 < v1) / 9));
+    } else {
+        v1 = (((89 < a0[11]) - (56 != a1[1][10])) && ((72 || 27) + (70 && v0)));
+        v2 = (((v0 == v1) * (a1[0][12] ? v2 : 65)) * ((v1 == a0[5]) * (v0 + 53)));
+        v2 = (((v2 == v3) ? (v2 >= v1) : (v2 && a1[0][13])) * ((v1 - v2) && (83 - 20)));
+    }
+    v3 = (((86 - 16) <= (v1 != a1[0][5])) % 1);
+    return (((v1 > 21) == (a1[0][9] / 5)) + ((v3 > a0[6]) || (v1 > a1[2][2])));
+}
+int f1() {
+    int v0 = 25;
+    int v1 = 4;
+    int v2 = 90;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v3 < i0) || (v2 / 7)) > ((a1[0][8] * 41) / 6));
+            v2 = (((v3 + i0) ? (v1 <= a0[5]) : (a1[1][12] < v1)) <= ((i0 <= v1) >= (v3 - a0[3])));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((i0 < v1) || (6 <= 5)) - ((i1 == a0[13]) && (a1[3][4] * a1[2][2])));
+                    a0[13] = (((v0 && a1[3][5]) && (i1 < a0[15])) * ((i1 != v2) - (66 + i0)));
+                    v2 = (((58 >= v3) * (v1 * v3)) / 4);
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v1 - v2) <= (v2 - v1)) || ((79 < v3) > (92 >= v3)))) {
+        v0 = (((v3 && v3) % 7) - ((50 ? 93 : a1[1][0]) == (a0[15] + a1[3][10])));
+        v0 = (((v3 > 84) || (v1 + v2)) >= ((a1[1][5] / 5) / 8));
+        v0 = (((v3 >= v3) > (50 / 4)) != ((68 || v1) - (a1[3][5] >= v2)));
+    } else {
+        v1 = (((90 % 1) % 4) != ((a1[3][14] + a0[5]) && (a1[3][3] % 9)));
+        v3 = (((v1 <= 33) - (v1 + 69)) <= ((v1 || a0[8]) && (v0 ? v3 : 47)));
+        v0 = (((v0 * v0) != (v0 / 7)) != ((a1[1][3] || v2) * (94 || v0)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((a0[8] % 7) > 99) break;
+        v2 = (((v2 >= v2) || (v3 >= v1)) ? ((a1[3][4] <= 51) <= (40 <= v1)) : ((i2 * 61) != (18 ? i2 : v2)));
+        v3 = (((24 ? v2 : v3) || (a1[0][3] % 1)) && ((a0[4] < a1[0][0]) > (v3 || a0[13])));
+        {
+            int i3 = 0;
+            do {
+                a1[3][6] = (((v2 && a1[0][15]) > (72 % 9)) * ((i3 ? v0 : a1[2][1]) <= (a1[0][2] % 1)));
+                v1 = (((30 && a0[0]) <= (45 ? 38 : 17)) ? ((a0[5] % 4) <= (a1[1][1] > 25)) : ((21 / 4) == (a0[15] == i3)));
+                v1 = (((a0[2] >= v1) * (a1[1][9] > a0[7])) - ((v3 ? v3 : v0) / 1));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    if ((((v1 >= v3) >= (v1 <= 99)) && ((v0 || a0[4]) < (4 * v0)))) {
+        a1[0][9] = (((a0[7] == v0) >= (v2 % 4)) < ((v2 * 97) && (91 >= a1[3][15])));
+        v2 = (((v3 || v3) ? (v1 != v3) : (v2 - v2)) - ((v2 ? 2 : v2) && (a1[3][10] != v0)));
+        a0[6] = (((v1 >= 79) ? (v2 * v0) : (83 || v2)) > ((v1 > v2) ? (v2 > v3) : (a1[1][14] != v1)));
+    } else {
+        a1[1][0] = (((v1 < v2) || (19 || 84)) / 6);
+        a1[2][14] = (((a1[0][13] || v3) < (24 >= v1)) && ((v1 - 3) + (v0 ? a1[3][11] : 34)));
+        v2 = (((a0[8] || v3) <= (v1 - a1[0][7])) ? ((0 + a1[0][10]) ? (a0[6] != a1[0][5]) : (10 + a1[1][3])) : ((78 * a0[7]) + (1 ? 42 : v3)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a1[0][7] = (((v2 / 8) * (i4 > i4)) ? ((v1 < 31) > (48 * a1[0][13])) : ((0 < a1[1][12]) / 9));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    if ((i4 || v0) > 50) break;
+                    a1[0][12] = (((70 == v2) + (16 && 96)) && ((a0[8] >= 49) != (v3 && a1[1][15])));
+                    v3 = (((i4 >= v0) || (a1[1][1] ? a0[5] : v0)) < ((v3 ? v2 : v3) >= (13 / 1)));
+                    v0 = (((36 ? i4 : i5) || (a0[0] > a0[13])) || ((i5 ? i5 : 60) ? (a1[0][0] ? i5 : v1) : (63 && 18)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[2] = (((a0[1] >= v3) - (30 * v0)) ? ((v1 <= i4) && (45 > 0)) : ((a0[2] % 5) >= (26 || v1)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v0 && a0[8]) <= (77 ? v0 : v0)) * ((v1 - v1) <= (v2 < a1[1][15])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,144 @@
+int f0() {
+    int v0 = 29;
+    int v1 = 84;
+    int v2 = 41;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[4] = (((a0[5] % 1) && (73 % 8)) != ((a1[2][7] % 1) % 7));
+            a0[5] = (((v3 ? 63 : 25) * (i0 > v0)) || ((v3 >= 72) >= (a1[3][0] < a0[5])));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[0][11] = (((a1[3][15] == v2) + (v3 <= 21)) == ((a0[15] != v2) - (v3 / 6)));
+                    a1[1][14] = (((v0 % 9) || (a1[1][6] || a0[2])) < ((v3 / 6) >= (i1 <= 79)));
+                    a1[1][1] = (((v2 ? i0 : i1) == (19 ? i0 : v2)) >= ((v2 / 6) < (35 / 1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((v2 <= a1[3][14]) > 96) break;
+        v0 = (((30 > v2) - (27 <= i2)) ? ((i2 / 3) || (53 && v2)) : ((39 ? v1 : a1[3][14]) < (19 + 85)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v2 = (((9 > a1[1][7]) || (74 == 53)) != ((v0 || v3) <= (i2 < a1[0][2])));
+            v2 = (((74 - 74) + (a1[2][15] == v1)) < ((a0[7] != a0[6]) == (i2 + 87)));
+            v2 = (((a1[0][11] * v1) + (i2 <= i3)) <= ((28 / 9) || (a1[3][2] ? 98 : 0)));
+        }
+        v1 = (((v0 <= a1[2][4]) == (46 && v3)) == ((v0 >= a0[3]) != (a0[10] / 2)));
+    }
+    v0 = (((v0 * v3) * (v3 - 88)) < ((v3 + a1[1][14]) + (a0[4] >= a1[0][1])));
+    if ((((v3 ? 40 : v3) < (39 + a0[15])) / 8)) {
+        v1 = (((a1[1][8] / 5) || (v0 - v3)) % 4);
+        v1 = (((70 == a1[1][1]) + (25 < 13)) ? ((a0[11] + v1) && (29 / 6)) : ((v3 - v3) % 7));
+        a1[2][9] = (((v1 || a0[3]) ? (89 ? 29 : a1[3][1]) : (29 > a1[0][11])) > ((v2 / 9) || (a0[7] <= a0[8])));
+    } else {
+        v1 = (((22 % 3) == (a0[7] == v3)) ? ((71 > 25) <= (v0 >= 49)) : ((v2 <= v0) ? (a1[3][8] % 5) : (v1 >= v0)));
+        a0[1] = (((v3 < 14) < (v2 < v0)) ? ((v1 != v2) || (21 == v2)) : ((a0[0] && v1) || (v3 % 4)));
+        v0 = (((a0[15] + v3) + (v2 <= a0[11])) / 1);
+    }
+    v3 = (((v3 >= v0) || (v3 <= v2)) % 8);
+    return (((v2 == a0[6]) <= (53 == v1)) ? ((v0 / 2) < (v0 >= 80)) : ((v2 - v0) != (a0[7] - a1[2][8])));
+}
+int f1() {
+    int v0 = 93;
+    int v1 = 67;
+    int v2 = 38;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 <= v1) || (a0[1] ? v2 : v3)) - ((v1 && v0) ? (v1 ? v2 : v1) : (v1 * 90)))) {
+        v0 = (((85 >= v3) % 9) ? ((a0[11] ? v3 : v1) % 3) : ((v0 * a1[3][0]) <= (v2 < v2)));
+        a0[8] = (((v1 > 46) - (73 >= 28)) % 3);
+        v2 = (((v3 ? v0 : 29) ? (68 - v2) : (a1[1][14] && a1[0][8])) < ((v1 > 52) <= (5 <= v2)));
+    } else {
+        v3 = (((68 % 1) % 9) + ((a0[3] || v0) * (a0[5] > v2)));
+        a1[1][13] = (((v1 && v0) - (2 && 27)) < ((18 < v2) - (a0[11] == 71)));
+        v0 = (((a0[15] || v2) - (a1[1][15] > v2)) != ((v3 == v1) <= (v0 < v0)));
+    }
+    if ((((a1[2][12] && a0[5]) || (v2 == v1)) * ((v0 > a0[3]) - (a1[1][8] ? v1 : v2)))) {
+        a0[8] = (((v3 == v2) < (a1[2][9] == 52)) || ((45 == a1[2][0]) * (a0[7] != a0[0])));
+        v1 = (((a1[3][1] + a0[11]) && (v0 >= a1[3][13])) ? ((43 / 1) ? (a0[4] == a0[12]) : (97 == v2)) : ((a0[7] != 44) != (v3 / 4)));
+        v1 = (((v0 <= v2) != (a0[13] ? a1[2][9] : v3)) == ((18 % 2) ? (v0 || v3) : (a0[8] ? v1 : 57)));
+    } else {
+        v1 = (((a0[1] >= 18) < (v2 > a0[14])) ? ((10 - 66) * (v3 ? v1 : v0)) : ((a0[1] >= v2) ? (0 == 61) : (83 - a1[0][1])));
+        v2 = (((7 - v1) <= (a0[0] <= v0)) || ((58 - v2) != (a0[0] / 7)));
+        a1[3][13] = (((v3 < 16) == (a1[1][1] != a0[13])) + ((v0 != v3) <= (v2 < v0)));
+    }
+    a0[13] = (((v2 > a1[3][8]) == (v2 % 2)) % 5);
+    if ((((v1 && v0) % 3) - ((a1[0][7] >= v1) == (a0[14] * a1[0][9])))) {
+        v3 = (((21 || a0[15]) && (16 && 17)) ? ((a1[3][4] <= 46) + (v2 / 2)) : ((v0 * a1[3][12]) >= (v1 >= 39)));
+        v3 = (((v2 == v2) < (21 ? a0[0] : v0)) ? ((50 - 35) % 9) : ((19 ? 26 : v3) ? (13 ? a1[0][0] : v2) : (v1 % 9)));
+        a1[0][5] = (((11 / 9) || (v3 >= 5)) <= ((97 != v2) / 5));
+    } else {
+        a1[2][12] = (((v3 != v1) / 6) != ((v3 == v3) || (7 ? a0[11] : v0)));
+        a1[0][0] = (((45 >= v2) <= (v1 * v3)) + ((v0 % 7) + (47 < v3)));
+        v2 = (((v1 < v0) && (v2 != a0[13])) % 2);
+    }
+    v1 = (((84 >= a0[6]) == (v1 || a0[14])) || ((v2 || 74) ? (a0[12] * a1[1][14]) : (v2 == 2)));
+    return (((a0[14] >= a0[13]) % 4) % 6);
+}
+int f2() {
+    int v0 = 71;
+    int v1 = 25;
+    int v2 = 72;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((4 / 6) > 58) break;
+            v1 = (((v1 ? 25 : a1[2][11]) > (v0 + 19)) ? ((12 <= a0[15]) * (i0 > v3)) : ((6 % 1) * (18 * v3)));
+            v1 = (((i0 > i0) && (90 ? 47 : a0[10])) < ((v3 % 5) && (66 > v0)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((32 / 1) > (v2 % 8)) - ((i1 / 5) < (a0[13] != i1)));
+                    a0[9] = (((i0 >= 11) >= (26 > 16)) / 8);
+                    v3 = (((23 * 23) % 2) * ((v3 || 49) == (31 - v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[3][7] != v3) > (37 * 83)) + ((6 <= v3) && (v2 ? v1 : 94)))) {
+        v3 = (((27 > v3) >= (a1[2][1] >= a0[3])) && ((v1 != 70) && (18 && v1)));
+        a0[4] = (((a1[1][15] < a1[2][1]) * (v0 - 5)) ? ((66 + a1[0][11]) > (v3 == 87)) : ((v2 / 7) * (a1[2][3] < v3)));
+        a1[0][12] = (((24 * a0[10]) == (v2 <= a1[0][7])) / 9);
+    } else {
+        v0 = (((5 % 3) || (v0 ? a0[3] : 0)) + ((a0[12] ? 43 : 1) > (v0 * 17)));
+        v1 = (((v1 ? a0[0] : a0[9]) + (85 <= 76)) != ((91 >= a0[8]) && (v2 % 6)));
+        v1 = (((v0 * 80) && (v0 ? a1[1][2] : v1)) - ((v3 > a0[2]) > (v3 == 34)));
+    }
+    v0 = (((v3 < 80) < (v2 - v1)) <= ((a0[11] >= 84) == (v1 ? v3 : 70)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v3 = (((46 <= a1[1][1]) + (1 - a1[2][1])) && ((a1[2][15] || 16) > (32 - a1[3][0])));
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[12] >= a1[0][7]) > 91) break;
+                    v3 = (((v0 || v3) == (i3 % 4)) % 2);
+                    v0 = (((v3 + 99) - (i2 != v0)) != ((i3 > a0[1]) ? (77 - a1[0][12]) : (v1 && 62)));
+                    v0 = (((v3 && a1[2][2]) + (i3 ? v2 : a1[1][8])) ? ((v2 / 1) && (a0[9] && i2)) : ((a1[3][1] && a1[2][10]) - (a1[1][5] % 3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v1 = (((v3 != a0[1]) / 1) && ((93 == a1[0][10]) + (37 == 73)));
+            i2 = i2 + 1;
+        }
+    }
+    a0[11] = (((v2 / 4) >= (a1[3][9] < v0)) || ((v1 > v2) <= (a0[12] != a1[3][3])));
+    return (((66 || 42) + (v3 > v1)) + ((v0 <= 10) / 2));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,75 @@
+int f0() {
+    int v0 = 71;
+    int v1 = 40;
+    int v2 = 99;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[0][10] = (((75 - v3) < (v3 > a1[2][0])) % 4);
+            {
+                int i1 = 0;
+                do {
+                    if ((38 && i1) > 80) break;
+                    a1[1][2] = (((v3 != v0) || (15 == a0[6])) ? ((v2 % 8) >= (i1 + v2)) : ((a1[2][8] / 9) == (72 % 7)));
+                    a1[1][9] = (((32 && a1[3][10]) > (a1[3][14] > 90)) > ((v0 || v1) || (82 < v2)));
+                    a1[3][10] = (((54 % 3) + (v1 != 55)) + ((v1 ? i1 : a1[2][13]) % 1));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v0 = (((v0 && a1[2][4]) <= (v3 ? 44 : v3)) / 6);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v1 >= v0) != (v3 == v2)) * ((v0 < v0) && (a0[8] * v0)))) {
+        v3 = (((78 * v0) > (a1[1][8] % 5)) < ((16 / 6) <= (v0 ? v2 : a1[0][9])));
+        v1 = (((v0 ? v1 : v0) ? (a1[1][9] + 15) : (v3 && a1[1][11])) <= ((98 != a0[5]) + (37 != v3)));
+        a1[3][3] = (((v3 == v0) < (v3 && 21)) > ((v0 ? v2 : 79) - (a1[0][2] >= a1[1][4])));
+    } else {
+        v2 = (((28 / 8) || (v2 / 5)) ? ((49 ? v3 : v3) >= (a1[3][2] != v1)) : ((v2 / 5) ? (a0[10] / 1) : (v0 / 5)));
+        v1 = (((v1 % 2) != (v1 % 4)) ? ((21 == a0[3]) ? (v1 >= v3) : (v2 <= a1[3][12])) : ((a0[9] <= v0) <= (v0 && v1)));
+        v0 = (((a1[2][4] ? a0[11] : 31) % 2) || ((v1 < v3) && (v3 / 7)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[0][2] = (((v2 * i2) / 7) <= ((25 / 6) ? (0 >= v2) : (a1[3][2] / 6)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v2 = (((a1[1][5] < 20) != (v0 || i3)) >= ((i3 - 80) != (a1[0][11] >= a0[8])));
+                    v3 = (((96 * a1[1][5]) && (a1[2][11] * i2)) - ((a0[5] || 24) + (86 >= v1)));
+                    v1 = (((86 % 5) + (v1 / 8)) + ((i2 <= v3) || (v3 % 1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((65 + i2) ? (i2 != a1[1][11]) : (i2 || a0[9])) - ((i2 && i2) ? (a0[4] > a0[9]) : (v1 != a1[3][3])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        a0[11] = (((a0[10] ? 16 : a1[1][10]) ? (v2 <= i4) : (31 / 5)) > ((45 <= v2) >= (i4 + i4)));
+        a1[1][12] = (((v3 == v2) && (45 == a1[2][10])) == ((v3 - a0[11]) / 9));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            if ((i4 ? 52 : i5) > 76) break;
+            v0 = (((75 && a0[13]) <= (47 * 9)) - ((a1[1][4] && v1) == (v1 <= 73)));
+            v3 = (((58 != 5) / 2) > ((v2 == v2) % 6));
+            v2 = (((71 != 45) <= (0 != i4)) > ((96 == a1[3][4]) <= (a1[3][13] ? i5 : a0[9])));
+        }
+    }
+    if ((((v0 < a1[1][8]) > (v2 >= v3)) / 7)) {
+        v0 = (((v0 + a0[1]) || (a1[1][15] / 5)) * ((51 || a0[2]) + (v3 == v3)));
+        v2 = (((v0 == v2) * (a0[2] >= a1[1][5])) / 2);
+        v1 = (((2 / 9) != (v0 > v3)) <= ((v2 % 2) == (8 == a1[0][5])));
+    } else {
+        v2 = (((a1[2][15] ? v2 : v2) != (v3 > 92)) != ((17 != a0[1]) * (v1 * a1[0][15])));
+        v0 = (((v0 ? 39 : a1[3][2]) + (21 == v2)) != ((v3 > 83) % 7));
+        v0 = (((a0[6] % 5) ? (a0[12] ? a1[2][5] : a1[0][15]) : (v0 || 78)) <= ((v1 ? v3 : 90) % 7));
+    }
+    return (((a1[2][4] / 2) < (v1 == v0)) * ((v1 || 79) != (a0[1] && v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,134 @@
+int f0() {
+    int v0 = 91;
+    int v1 = 46;
+    int v2 = 16;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[11] < v3) && (v2 >= v2)) ? ((48 == 21) == (v1 + a1[3][15])) : ((27 <= v1) > (v1 || a0[11])))) {
+        a0[3] = (((v3 ? 94 : 57) + (33 + 42)) - ((7 >= v3) ? (v1 && v2) : (v2 >= 78)));
+        v0 = (((v3 != a0[0]) < (v1 && 10)) - ((19 > v0) && (v2 != v2)));
+        v2 = (((v0 >= v1) * (v3 ? v1 : v3)) ? ((30 / 8) && (v1 <= v1)) : ((v1 <= v3) || (59 >= 91)));
+    } else {
+        v3 = (((v2 ? 67 : v2) ? (89 <= v1) : (v2 ? v2 : v1)) <= ((v2 <= 37) || (v3 != v2)));
+        v2 = (((a1[1][0] == a1[2][11]) % 4) + ((v3 - v2) >= (v0 && a1[0][1])));
+        v3 = (((v1 + v1) <= (17 + a1[0][8])) == ((v0 - a1[3][6]) * (a0[0] || a0[3])));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((i0 && 4) > 81) break;
+            v3 = (((a1[2][3] ? a0[12] : i0) == (a1[0][1] - v3)) * ((v0 == 32) && (86 >= v3)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((v3 ? 61 : i0) ? (93 + v1) : (v2 >= v0)) > ((29 > a1[0][4]) || (a0[0] > 2)));
+                v0 = (((v2 >= i1) <= (i0 != a1[2][10])) || ((a0[15] ? i1 : 12) + (i0 >= a1[1][6])));
+                a1[3][9] = (((65 < i1) ? (3 ? v3 : v2) : (v1 - v1)) ? ((8 || i1) != (i0 / 2)) : ((i1 + v2) || (a1[3][13] && a0[14])));
+            }
+            v1 = (((66 + a1[3][2]) ? (71 * a0[13]) : (a1[1][12] <= v1)) >= ((a1[1][10] || v1) >= (a1[2][7] + 81)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((20 > v1) > 98) break;
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                if ((i2 < a0[7]) > 78) break;
+                a0[6] = (((a1[2][8] - i3) < (v0 - v3)) / 1);
+                v2 = (((a0[4] / 3) < (v2 + v0)) < ((i3 - i3) && (92 && a1[2][1])));
+                v0 = (((i2 <= 39) ? (a1[1][7] % 2) : (a1[0][0] * v2)) || ((a1[2][11] <= v1) < (95 != 20)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((v2 >= v3) && (19 ? v3 : a1[0][12])) % 4);
+        v2 = (((i2 == 19) * (a0[7] >= a0[3])) ? ((i2 ? v1 : a1[1][12]) ? (76 % 8) : (v3 % 9)) : ((14 - v2) + (a0[3] + a0[8])));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((48 == v3) - (v0 == 52)) != ((a0[2] != a1[0][13]) - (53 / 8)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                a1[1][1] = (((a1[1][10] || v1) >= (v1 * v3)) && ((a0[14] && v3) * (80 > 27)));
+                v1 = (((v2 >= 56) != (72 - v0)) != ((i5 <= a0[9]) - (v2 + a0[15])));
+                v2 = (((v0 ? a1[1][0] : a0[7]) + (a1[1][13] <= 71)) != ((v2 * a1[0][4]) - (a0[7] / 8)));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((v0 <= v3) ? (73 > v2) : (a1[2][8] || v0)) >= ((19 ? a0[2] : v0) && (v1 >= 80)));
+    }
+    v1 = (((v3 < 50) == (v0 >= 24)) > ((a0[9] != v2) <= (v3 / 8)));
+    return (((1 ? 29 : 10) >= (43 || a1[3][14])) / 6);
+}
+int f1() {
+    int v0 = 83;
+    int v1 = 25;
+    int v2 = 11;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v2 = (((v2 / 4) % 1) && ((v2 % 2) % 2));
+                v1 = (((v0 <= v0) <= (i0 ? 67 : 12)) == ((v3 ? v2 : a0[0]) % 9));
+                a0[9] = (((68 * a0[8]) == (v2 || a1[2][15])) && ((0 + a1[3][8]) < (v2 != 70)));
+            }
+            v3 = (((v2 % 9) && (a1[3][15] == v1)) == ((a0[5] / 5) - (v1 > v1)));
+            v1 = (((v0 != a1[2][6]) == (v2 && v2)) >= ((v3 && i0) && (37 * v0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((a0[12] >= i2) > 84) break;
+            v0 = (((a1[0][9] >= v2) / 6) + ((61 - a0[1]) > (i2 == i2)));
+            v1 = (((a1[3][14] ? v0 : v2) % 9) || ((12 > v0) % 2));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v1 % 6) < (a0[3] ? v0 : v2)) ? ((9 >= v0) + (v2 - a0[6])) : ((39 % 9) >= (a1[1][1] > a1[3][12])));
+                    v1 = (((7 && v0) != (i2 * a1[3][12])) == ((a1[0][1] == i2) >= (60 + 87)));
+                    v3 = (((i3 >= i2) % 9) / 1);
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v3 || a1[1][8]) >= (a0[3] == a0[11])) * ((v1 >= a0[2]) <= (a1[2][12] < v1)))) {
+        v1 = (((v0 + v2) ? (v2 * v2) : (v1 > v2)) > ((a1[2][9] != a0[9]) != (62 >= v3)));
+        v2 = (((v0 + 10) ? (a0[8] == v1) : (v2 == 67)) != ((v1 + v0) >= (70 <= a1[2][14])));
+        v2 = (((v3 >= v2) / 3) != ((v1 && a1[0][10]) - (a0[12] / 7)));
+    } else {
+        v2 = (((26 ? 21 : v2) != (v1 >= 28)) ? ((a1[3][14] != v3) > (a1[0][1] <= a1[3][2])) : ((a0[11] && 43) + (a1[0][11] ? v1 : v2)));
+        v3 = (((v0 == v3) - (a1[0][4] == v0)) % 5);
+        a0[12] = (((v2 * v2) < (v1 + v2)) < ((v0 / 4) ? (69 ? v0 : v1) : (a1[1][9] * v1)));
+    }
+    v0 = (((a1[2][4] >= a0[8]) ? (v3 + 37) : (29 - v1)) % 5);
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v0 = (((v3 % 7) && (a0[10] || v3)) - ((0 <= i4) % 3));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v1 = (((i4 <= v1) + (i4 != 91)) != ((v1 || i5) > (a0[14] / 9)));
+                    v2 = (((v0 / 5) % 9) ? ((26 ? a0[13] : a0[6]) - (v3 ? 86 : 70)) : ((73 % 2) - (i4 / 5)));
+                    v0 = (((6 ? 71 : a0[1]) != (v3 * 29)) && ((a0[4] && a1[1][10]) >= (a1[1][3] || a1[3][4])));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[3][9] = (((v2 >= i4) >= (a1[1][12] - v0)) * ((v2 != v2) > (i4 < v3)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[0][10] ? a0[11] : v0) && (30 ? v1 : v3)) % 9);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
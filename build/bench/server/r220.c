@@ -0,0 +1,112 @@
+int f0() {
+    int v0 = 36;
+    int v1 = 34;
+    int v2 = 32;
+    int v3 = 98;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((i0 % 3) > 69) break;
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v0 = (((21 < 71) - (i1 > v2)) || ((a0[9] * v0) * (95 < v0)));
+                v3 = (((v3 * v1) < (a0[2] + i1)) ? ((v2 % 6) || (i1 || 39)) : ((a0[14] > i1) % 2));
+                v3 = (((a0[12] < v3) ? (v2 || v2) : (v2 - a1[2][10])) >= ((v0 && 22) <= (a0[13] % 4)));
+            }
+            v0 = (((54 + v0) / 4) >= ((a1[3][14] * v3) < (v2 + a0[0])));
+            v0 = (((v1 + v0) ? (96 <= a1[1][3]) : (a1[3][4] * v3)) != ((v0 * 18) ? (84 && 82) : (v0 || v2)));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v3 < 18) ? (1 || v2) : (a1[1][11] % 8)) != ((v1 == 60) > (v2 < 65)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v2 = (((a0[1] + v3) / 2) * ((v2 < v2) / 6));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                v1 = (((i2 != v0) && (a0[13] > a0[0])) && ((65 % 2) == (i2 > i3)));
+                a0[1] = (((21 ? v0 : i2) >= (v0 ? i2 : 97)) ? ((61 || v1) > (a1[0][4] ? i2 : a1[3][3])) : ((v0 && a1[2][2]) / 4));
+                v2 = (((a1[0][1] / 8) * (a1[2][9] == i3)) + ((v3 / 7) - (5 || 84)));
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((92 != v0) % 6) * ((v1 >= v2) ? (70 > a1[0][12]) : (v3 == v2)));
+    }
+    a0[6] = (((a1[1][4] > 89) ? (v3 != 47) : (v1 - v0)) < ((a0[10] / 6) <= (8 / 3)));
+    v1 = (((70 ? 86 : v3) < (v2 * v2)) || ((34 ? 65 : a1[1][13]) ? (a0[1] / 4) : (v0 * v3)));
+    return (((v0 / 9) % 2) <= ((87 - a0[15]) >= (52 || v3)));
+}
+int f1() {
+    int v0 = 69;
+    int v1 = 84;
+    int v2 = 20;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v1 = (((38 ? 56 : v2) ? (43 / 4) : (i0 || 79)) > ((v0 + v0) % 8));
+                v2 = (((v2 ? 92 : 29) ? (i1 || a1[0][3]) : (v0 - 2)) > ((i1 >= v1) <= (v0 >= a0[1])));
+                v0 = (((a0[14] >= i0) ? (v3 == i1) : (i0 > 17)) >= ((i0 / 8) ? (a0[11] && a1[0][15]) : (v1 >= v3)));
+            }
+            a1[3][5] = (((a0[9] - v2) <= (7 + i0)) > ((v3 % 1) >= (14 >= a0[1])));
+            v0 = (((a0[15] ? v3 : 3) && (v2 ? v1 : i0)) + ((42 % 4) != (52 <= a1[2][1])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v0 = (((a0[2] < a1[1][4]) ? (v0 + v0) : (10 && 62)) && ((v3 * a1[2][3]) || (98 == 19)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v3 = (((i2 % 9) < (a0[3] ? v3 : v1)) - ((i2 * a0[4]) / 2));
+                    v1 = (((i2 || 29) / 2) < ((v3 % 5) - (a0[10] ? 10 : a0[0])));
+                    v1 = (((a0[6] / 5) / 8) - ((v0 < v1) ? (2 != v2) : (a1[1][5] + a0[11])));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[14] = (((18 + v2) % 1) - ((v3 != 99) && (56 < a1[1][7])));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        a1[0][4] = (((a1[0][4] / 5) != (a0[13] != v3)) < ((57 ? 92 : v1) ? (v2 == a1[0][0]) : (a1[3][11] ? v3 : v0)));
+        a1[0][4] = (((v1 / 4) || (i4 / 5)) * ((41 * 49) * (i4 <= a1[2][14])));
+        {
+            int i5 = 0;
+            do {
+                a0[5] = (((i5 ? 74 : i5) >= (v2 || i5)) * ((a0[13] != a0[3]) && (v2 != a0[14])));
+                v3 = (((a0[0] <= 12) || (i5 > 58)) <= ((a1[0][5] && 22) <= (i4 != 75)));
+                v1 = (((v0 || v0) * (v3 ? a0[6] : 45)) || ((v1 < 15) - (v0 - v3)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+    }
+    if ((((a0[5] * v2) % 6) ? ((22 == a1[2][1]) > (33 || a1[3][4])) : ((v2 / 6) == (a1[2][3] ? v2 : 58)))) {
+        v0 = (((2 < v1) > (v0 - v0)) + ((a1[2][9] || v3) == (v3 > a1[2][0])));
+        v1 = (((10 && a0[4]) ? (v3 * v3) : (41 != 73)) || ((41 - v3) + (41 != v2)));
+        a0[9] = (((82 * v3) % 1) ? ((v1 * v3) ? (a1[0][2] < 99) : (v0 > v1)) : ((v1 ? v2 : a0[15]) && (v0 ? 73 : v0)));
+    } else {
+        v0 = (((v3 ? 35 : 13) >= (91 ? 72 : 62)) / 6);
+        a1[0][2] = (((v1 == 1) % 6) % 8);
+        v0 = (((v1 || v3) < (a1[1][15] % 3)) != ((v2 == v3) == (v1 ? 83 : 54)));
+    }
+    if ((((v3 != v1) && (v0 && v0)) && ((49 || a0[3]) ? (v2 % 7) : (48 <= v2)))) {
+        v0 = (((a1[2][7] <= v3) - (a0[2] < v0)) >= ((a1[0][11] ? a0[9] : a0[11]) / 3));
+        v2 = (((v3 + a0[1]) <= (v3 / 2)) >= ((v0 + a0[1]) < (v2 && v3)));
+        v1 = (((12 % 5) == (v2 != a1[3][10])) < ((a1[2][4] && 98) == (v2 >= v3)));
+    } else {
+        a1[2][13] = (((v0 && v2) * (42 ? v0 : v2)) >= ((49 && v0) + (v3 < v0)));
+        a1[2][13] = (((v1 + 29) && (a1[0][13] > 41)) <= ((v0 ? v3 : v3) == (v3 || v1)));
+        v2 = (((a0[3] / 9) ? (v3 == a0[13]) : (56 % 8)) ? ((2 ? 64 : v2) / 9) : ((v0 != v3) == (43 != 45)));
+    }
+    return (((v0 % 3) <= (v3 >= v1)) <= ((v3 > a0[12]) || (a1[0][10] <= a0[0])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,166 @@
+int f0() {
+    int v0 = 86;
+    int v1 = 73;
+    int v2 = 99;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 == a1[0][8]) && (v2 + 20)) > ((v3 == v3) - (a0[15] < 98)))) {
+        v1 = (((v3 <= a1[0][13]) > (v0 + a1[1][15])) + ((v0 * v0) ? (a0[6] ? a1[2][2] : a1[3][7]) : (72 * a0[0])));
+        a0[15] = (((v2 / 7) - (v3 >= 2)) || ((v3 != a0[5]) > (v2 >= v0)));
+        v1 = (((v2 ? 5 : 57) >= (v1 <= v3)) != ((34 ? v1 : v0) > (v0 >= v1)));
+    } else {
+        a0[4] = (((13 >= v1) || (93 + 71)) / 2);
+        a1[0][12] = (((a0[10] <= 88) >= (v3 || a0[8])) / 7);
+        a0[3] = (((v2 > v0) / 7) && ((v3 ? v3 : 70) + (a1[0][4] <= v3)));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                a0[2] = (((i1 * v1) < (99 * 30)) > ((v3 ? a0[1] : v2) - (i0 && a1[2][15])));
+                v2 = (((v2 * 81) < (15 / 2)) && ((i0 % 9) > (i0 - 56)));
+                v0 = (((v2 * v3) + (v1 || 26)) + ((a1[0][13] ? a0[2] : a0[3]) / 6));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((v0 == a0[8]) == (v2 - v1)) < ((51 ? a1[3][5] : i0) > (5 != v1)));
+        a1[0][10] = (((a1[1][10] || v3) % 6) != ((a1[0][15] - v2) < (a1[3][10] % 1)));
+    }
+    if ((((a0[13] ? v0 : 36) <= (41 % 1)) != ((v2 > v3) == (v2 && 68)))) {
+        a0[3] = (((10 * v0) / 7) && ((v0 || v2) && (v1 <= v3)));
+        v2 = (((a1[0][10] ? 45 : 5) / 5) <= ((v2 - v2) >= (62 < v0)));
+        v2 = (((v2 % 2) || (a1[0][15] % 9)) % 6);
+    } else {
+        v0 = (((27 == a1[2][7]) * (a0[8] / 5)) - ((17 * 85) && (a1[1][9] != a0[5])));
+        v3 = (((v0 ? 99 : v0) <= (32 / 7)) * ((v0 + 42) <= (v1 == v0)));
+        a0[5] = (((v2 < 36) % 6) == ((12 + 48) != (v1 < a1[0][9])));
+    }
+    if ((((1 <= v2) <= (30 > v3)) % 3)) {
+        v1 = (((a1[2][0] % 3) && (a1[0][2] * v3)) >= ((35 < 74) && (v0 || 98)));
+        v3 = (((a1[3][2] != 66) ? (v0 != v2) : (a1[2][14] <= a0[13])) > ((v1 ? a1[3][14] : 58) < (v1 - v2)));
+        v3 = (((9 > v2) / 5) / 7);
+    } else {
+        a0[7] = (((47 == 9) - (v2 > 21)) && ((a1[0][6] ? v2 : v2) + (33 > v3)));
+        v3 = (((v3 <= v2) < (v1 > v0)) != ((v0 - v1) > (36 <= a1[2][5])));
+        v1 = (((55 > a1[0][13]) && (v1 % 8)) * ((v3 % 5) || (v1 ? 37 : v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[5] = (((a0[3] < a1[0][6]) == (v0 && a0[0])) % 7);
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a1[3][6] = (((2 == 0) ? (a0[11] > i3) : (i3 + v1)) != ((i3 / 2) ? (20 >= v1) : (v3 ? a0[13] : v3)));
+                v3 = (((v3 ? 28 : a0[8]) && (31 ? 61 : 32)) <= ((i2 >= v0) / 2));
+                v0 = (((66 - 41) - (a1[1][0] ? a0[10] : v1)) ? ((23 == i2) ? (v0 ? v2 : 94) : (v2 >= a0[7])) : ((v0 != v2) ? (78 * a0[6]) : (a1[3][15] ? 29 : i2)));
+            }
+            a1[3][8] = (((65 - a0[7]) - (a0[13] ? i2 : a1[1][0])) < ((v2 > 35) % 8));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((v3 != v1) + (47 > 15)) - ((62 * v1) && (a0[13] == a0[10])));
+}
+int f1() {
+    int v0 = 4;
+    int v1 = 47;
+    int v2 = 54;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 == v3) * (a0[2] > v2)) + ((v2 >= v3) <= (a0[12] && v1)))) {
+        v1 = (((a0[6] + a0[13]) - (14 < a1[0][14])) + ((v1 && v3) != (32 >= 95)));
+        v2 = (((a0[8] + v1) - (56 < v1)) ? ((66 && a0[10]) * (v0 == 7)) : ((a1[3][14] - 88) && (a0[8] <= 64)));
+        a0[12] = (((a0[1] && a1[1][13]) && (48 <= a0[2])) <= ((a1[0][1] ? v1 : v3) + (a0[1] - v2)));
+    } else {
+        v1 = (((v3 ? a0[7] : v0) + (a0[6] == v3)) && ((v3 > a1[1][8]) + (v0 <= v2)));
+        a1[2][2] = (((v3 + 47) >= (v1 ? 71 : v0)) * ((a0[8] * 37) > (v1 % 9)));
+        v2 = (((v3 > a1[3][13]) != (a0[10] <= 20)) == ((a0[6] % 9) / 6));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                a0[14] = (((i1 >= v1) != (a0[12] / 9)) == ((87 < v3) < (77 * i0)));
+                a0[11] = (((a0[14] < v3) / 5) ? ((73 == v0) - (i1 > a0[11])) : ((12 >= v1) - (a1[1][10] * 63)));
+                v3 = (((v3 - 10) ? (a1[2][4] >= 26) : (51 != i0)) + ((v3 - a1[2][12]) && (55 * 80)));
+            }
+            v0 = (((v0 <= v1) <= (a0[3] > v2)) ? ((a1[2][11] / 8) == (a1[1][0] || v2)) : ((a1[1][9] + 25) < (v1 % 6)));
+            v1 = (((v2 || v2) < (52 != v3)) || ((v0 && 79) < (v1 % 7)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 > v1) <= (61 + 49)) == ((v2 == v2) + (a0[4] && a1[1][0])))) {
+        v0 = (((v2 != 55) == (a0[9] < a1[2][9])) ? ((v1 * v1) > (v2 ? 59 : v2)) : ((v3 + 64) - (v2 / 4)));
+        v2 = (((v3 == v2) ? (v0 ? v3 : a1[3][13]) : (v1 >= a0[13])) <= ((a1[1][15] != v1) ? (v0 / 8) : (a0[15] >= v1)));
+        a1[1][15] = (((v2 && a0[13]) > (v0 <= v3)) % 8);
+    } else {
+        v1 = (((62 < a1[3][5]) / 6) % 1);
+        v2 = (((v2 - v2) >= (v1 * v0)) < ((a0[1] != 69) == (v2 < 96)));
+        v3 = (((56 % 6) != (v1 ? 46 : a1[3][12])) - ((v2 != v3) != (7 || 16)));
+    }
+    v2 = (((v0 && a1[2][14]) ? (a0[14] > v2) : (87 > 58)) > ((64 <= a1[3][0]) || (80 ? a0[10] : v3)));
+    if ((((v3 - v3) < (50 * v0)) >= ((65 > a1[2][1]) <= (15 ? v0 : v3)))) {
+        v2 = (((7 % 7) && (v3 ? v0 : 53)) > ((v0 >= v3) + (20 ? v3 : a1[0][11])));
+        v0 = (((95 + a0[10]) != (46 ? v0 : v3)) == ((62 ? v3 : a1[0][10]) == (a0[11] - v2)));
+        v1 = (((v3 / 9) ? (v0 >= v2) : (83 % 7)) >= ((v3 ? 11 : v3) > (v3 <= a1[2][11])));
+    } else {
+        v2 = (((58 != v2) / 7) > ((v2 ? a0[8] : v0) != (v2 && v0)));
+        v2 = (((17 < v0) == (v3 + v2)) <= ((v1 + v3) / 4));
+        a0[1] = (((v3 != a0[5]) > (v3 == a0[2])) < ((92 ? 94 : a1[0][5]) / 3));
+    }
+    return (((a0[14] > v1) < (v2 * v1)) && ((v2 == 36) <= (92 ? a0[3] : v2)));
+}
+int f2() {
+    int v0 = 10;
+    int v1 = 52;
+    int v2 = 8;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((28 < 81) > 96) break;
+        a0[12] = (((19 || v3) || (38 ? 7 : 22)) * ((v2 - i0) + (v2 || i0)));
+        a0[12] = (((v1 == a0[11]) % 8) % 2);
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v2 = (((a1[1][9] == v2) - (a1[1][4] != a0[8])) ? ((i1 ? v1 : 53) != (i0 - i1)) : ((15 >= v0) + (37 || a1[0][9])));
+            a0[6] = (((74 / 4) + (v3 == v1)) || ((56 <= i0) * (32 / 2)));
+            a0[8] = (((i0 && i0) * (a1[0][12] - v0)) - ((60 != i0) ? (a0[5] >= 53) : (57 < i0)));
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v2 = (((v2 == a1[3][7]) > (v2 >= v2)) >= ((21 > v2) - (i2 - v3)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((i2 - a0[6]) < (79 - a1[1][10])) >= ((5 * 46) < (v1 + i2)));
+                v2 = (((i2 ? v2 : a1[0][13]) || (a0[12] - v1)) || ((30 + v0) != (a1[1][5] != 66)));
+                a1[1][1] = (((v0 > 51) == (55 - v3)) != ((a0[0] && 29) <= (v2 ? 89 : a1[0][14])));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        v1 = (((97 * a0[13]) || (a0[5] && v0)) % 7);
+    }
+    v0 = (((58 * 83) >= (v1 * a0[7])) > ((v3 * a0[7]) && (97 / 5)));
+    if ((((v0 / 8) && (v3 == 42)) != ((a1[3][14] / 2) ? (v2 && v3) : (97 == 94)))) {
+        a0[12] = (((v2 < v0) || (v0 != v3)) || ((v1 + v1) / 9));
+        a0[13] = (((95 == a0[7]) / 8) || ((v2 && v3) >= (v0 - v1)));
+        a0[8] = (((v2 - v2) >= (94 < v1)) > ((75 ? 14 : v0) == (v3 != v3)));
+    } else {
+        v2 = (((65 <= a1[1][6]) != (36 > v2)) > ((a1[0][5] + v3) || (v3 ? a0[8] : a1[1][3])));
+        a0[1] = (((v0 <= v2) >= (a0[5] >= v3)) ? ((89 - v2) - (v3 ? 53 : v2)) : ((v3 * a1[2][6]) < (a0[11] < 38)));
+        v2 = (((v1 < v1) <= (a1[0][6] == v1)) && ((v0 < a0[13]) % 5));
+    }
+    if ((((45 / 7) / 8) != ((v0 >= 35) > (v0 < a0[2])))) {
+        v2 = (((13 % 2) <= (v2 || v1)) <= ((a0[12] != 98) <= (v3 + a1[1][3])));
+        v1 = (((a0[9] + 28) ? (v1 % 7) : (v1 % 3)) && ((v3 != 79) ? (90 - v3) : (60 || v3)));
+        v1 = (((19 == v1) <= (v3 - 41)) + ((v3 < a1[2][3]) != (14 / 5)));
+    } else {
+        a1[0][6] = (((v3 - v0) > (v1 < a0[7])) ? ((a0[7] < v1) != (v2 * v0)) : ((v0 < v0) + (v3 == a1[3][12])));
+        v0 = (((v2 && a1[0][15]) ? (v3 ? a1[0][8] : 77) : (v3 != v0)) > ((80 <= v3) >= (84 <= a1[0][2])));
+        a1[0][4] = (((44 == 70) * (31 % 3)) / 6);
+    }
+    return (((89 < v2) % 9) - ((91 > v3) ? (a1[1][2] && a1[2][10]) : (v0 || 81)));
+}
+int main() {
+    return 0;
+}
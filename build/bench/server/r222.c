@@ -0,0 +1,45 @@
+int f0() {
+    int v0 = 54;
+    int v1 = 89;
+    int v2 = 2;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((56 % 8) >= (a1[2][3] <= 84)) - ((v1 ? v3 : 6) % 9));
+    v1 = (((v0 / 4) > (v1 >= 98)) + ((a1[3][6] * v0) ? (v0 / 4) : (v1 % 7)));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v2 = (((71 ? v3 : a0[3]) <= (v2 >= 54)) || ((a1[1][5] && v3) != (72 >= v2)));
+            v3 = (((i0 / 1) / 2) * ((55 ? v2 : v3) + (a0[7] - 53)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[11] = (((7 < a0[4]) && (73 == 98)) >= ((v0 < v0) == (v2 == a0[8])));
+                v1 = (((a0[14] <= 58) && (a0[1] < i1)) > ((v0 / 1) > (v2 && v2)));
+                v0 = (((a0[6] + a1[0][10]) < (v0 && 10)) == ((56 >= a0[8]) * (v0 + a0[4])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 ? v3 : v3) || (37 <= 66)) % 7)) {
+        v1 = (((a0[4] == v0) >= (v2 ? v2 : 51)) <= ((a0[8] + 39) / 7));
+        v2 = (((v1 ? v1 : v3) ? (32 > 59) : (4 / 7)) || ((v2 <= v3) == (a0[10] + 32)));
+        v2 = (((99 < v0) < (a0[5] >= 20)) != ((36 % 1) >= (v1 >= a1[2][12])));
+    } else {
+        v2 = (((95 < 23) != (v2 > v1)) ? ((v1 != a0[5]) + (v2 == v3)) : ((v0 || v2) <= (a0[0] != v2)));
+        v2 = (((v2 / 9) || (36 != v3)) - ((a0[4] < v3) != (v1 ? 37 : a1[2][12])));
+        v0 = (((a1[0][12] <= 42) % 9) <= ((94 < v0) == (a1[0][11] < v3)));
+    }
+    if ((((v1 / 1) - (23 * v2)) % 8)) {
+        v3 = (((88 > v3) * (40 % 2)) < ((90 != v3) - (a1[3][9] == v3)));
+        v2 = (((v1 - v2) ? (a0[3] != a1[3][8]) : (a0[0] || v2)) || ((v1 < a1[1][3]) && (v1 > 23)));
+        v1 = (((v2 || v2) + (30 > 4)) * ((a0[15] % 8) - (v2 && v2)));
+    } else {
+        a0[5] = (((v2 != 84) >= (88 != a1[3][9])) <= ((a0[4] == 65) - (99 + v0)));
+        v1 = (((v0 ? a0[4] : 33) ? (v2 < v1) : (v2 || v0)) >= ((73 - a1[1][4]) < (v2 % 3)));
+        a0[9] = (((v0 && a1[2][11]) < (v2 % 4)) / 5);
+    }
+    return (((v2 ? v0 : a0[7]) - (46 <= 14)) > ((v3 != 76) < (a0[2] % 9)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,137 @@
+int f0() {
+    int v0 = 40;
+    int v1 = 29;
+    int v2 = 67;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][5] != 42) > (35 ? v3 : 11)) == ((v3 * a1[1][15]) <= (61 > a1[1][1])))) {
+        v1 = (((a0[13] < a0[8]) || (v3 != v3)) - ((a1[1][9] && a0[15]) || (69 < v2)));
+        v2 = (((v0 == a0[12]) && (19 && v1)) == ((v0 >= v1) / 3));
+        a1[2][6] = (((v0 ? a1[2][11] : a1[0][11]) || (80 < v1)) / 3);
+    } else {
+        v3 = (((v1 ? a1[0][5] : v2) < (v3 < 73)) <= ((v2 != a1[0][9]) || (71 ? 8 : v1)));
+        v2 = (((v1 < 30) ? (90 * v1) : (v3 && 64)) != ((a1[1][6] <= a1[2][0]) >= (v2 / 1)));
+        a1[1][9] = (((v3 == a1[2][7]) || (a1[1][8] + 46)) >= ((v1 < 35) + (a1[2][8] - v0)));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v0 = (((82 / 8) ? (i0 + 76) : (i1 || 6)) >= ((51 ? i0 : i1) <= (i0 >= i1)));
+            v3 = (((27 - i1) + (76 >= v1)) != ((i0 / 8) % 9));
+            v3 = (((95 + v2) != (66 ? a0[5] : v2)) % 7);
+        }
+        v2 = (((a0[5] && v3) >= (v3 * v1)) && ((i0 >= a0[2]) < (a0[7] + a1[3][10])));
+        v3 = (((v1 - v3) >= (25 && v0)) - ((a1[0][10] ? v0 : a1[2][8]) != (i0 + v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((94 <= v1) > 52) break;
+            a1[2][11] = (((a0[2] <= v3) > (v1 ? v2 : a1[0][15])) > ((a0[11] && 84) >= (a0[10] - v2)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a0[13] = (((31 > a1[1][11]) / 7) >= ((a0[7] * a0[0]) <= (a1[0][11] && a1[1][3])));
+                    a0[12] = (((a1[2][1] ? 76 : v0) == (v1 ? v3 : a1[1][13])) || ((93 > v3) / 8));
+                    a0[0] = (((i3 * v0) >= (a1[0][2] ? v2 : v1)) <= ((84 ? 73 : a0[5]) || (a0[3] * v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v0 > i2) ? (23 != v2) : (a1[1][15] != 97)) % 1);
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((i5 * i5) || (26 < 74)) % 2);
+                    v0 = (((i4 * a0[15]) + (i4 > 0)) * ((92 / 8) != (97 ? 41 : a1[2][7])));
+                    a0[7] = (((i5 > a1[3][3]) == (a0[8] == i4)) * ((v3 % 4) - (96 != v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v3 = (((88 - v1) * (v3 || v1)) ? ((19 <= a1[3][7]) || (a0[4] || a1[3][4])) : ((a1[0][7] || a1[3][14]) == (v2 > i4)));
+            v2 = (((v1 - a1[3][3]) + (71 * 38)) / 4);
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v0 = (((i7 * v1) > (37 == 45)) > ((i7 || v1) == (v2 - 83)));
+                    v1 = (((v1 != a1[2][15]) <= (v2 > v3)) == ((v0 * v0) ? (8 % 8) : (82 <= i7)));
+                    v0 = (((99 * a0[8]) == (a1[1][13] ? i7 : v3)) > ((v2 % 4) % 1));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((v0 - 76) && (a1[3][8] && a1[0][6])) * ((v1 == v2) >= (96 < v0)));
+            v2 = (((55 >= v2) / 8) || ((v1 ? a1[2][8] : a1[1][5]) != (v2 ? a1[3][2] : v1)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    return (((11 && a1[1][12]) <= (v3 <= v1)) * ((v3 + v3) + (80 && v3)));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 51;
+    int v2 = 86;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a0[14] = (((v2 > 30) < (a1[0][6] ? 19 : a0[15])) <= ((v1 % 7) % 3));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v0 = (((i1 % 6) / 3) ? ((30 ? v3 : a0[5]) || (i1 / 7)) : ((a1[3][0] / 1) != (a1[3][13] * i0)));
+                v1 = (((v0 + a1[3][10]) % 4) <= ((55 == a0[6]) > (v1 ? i1 : a0[14])));
+                a1[1][4] = (((i0 ? i1 : a0[0]) && (a1[3][14] > a1[0][1])) > ((a1[0][4] + v3) <= (62 >= 96)));
+            }
+            v3 = (((v3 < v0) / 7) != ((a0[0] == a1[3][12]) > (a0[4] - 37)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                if ((i3 % 5) > 69) break;
+                v2 = (((a1[3][10] >= a0[5]) >= (48 % 8)) <= ((a1[3][1] != v3) <= (v2 && i3)));
+                v1 = (((a0[4] - v3) >= (a1[2][11] || 63)) != ((i2 >= 98) < (i2 != v0)));
+                v3 = (((v2 >= v1) ? (v1 >= 89) : (v2 == 0)) || ((i3 - a0[6]) * (v2 * i2)));
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((i2 != i2) / 2) * ((a0[4] < 74) && (a0[15] <= v1)));
+        a1[1][1] = (((a1[0][15] < 11) < (69 >= v2)) == ((1 + v0) < (a1[2][3] >= v0)));
+    }
+    a0[2] = (((v0 == a1[0][0]) != (v0 || 39)) - ((v2 ? a1[2][1] : 5) == (v1 * v3)));
+    if ((((v1 / 2) + (v2 - v2)) == ((v0 * a1[3][14]) > (v3 <= v0)))) {
+        a0[0] = (((v2 - a1[0][0]) > (v1 >= a1[3][9])) && ((v3 && v2) - (v3 / 6)));
+        a0[0] = (((27 < v2) ? (a0[6] % 9) : (86 < 21)) ? ((80 % 1) && (v3 - 20)) : ((87 + a1[0][2]) ? (v1 != a0[11]) : (v3 == v1)));
+        v2 = (((51 == 15) % 5) <= ((v0 ? 60 : 90) - (a1[1][12] < a1[3][2])));
+    } else {
+        a1[1][0] = (((a1[1][3] + a1[0][1]) * (a1[0][7] > a0[7])) % 8);
+        v2 = (((v3 + v3) * (a0[8] || 53)) - ((73 && a1[2][2]) * (v0 + v0)));
+        v2 = (((48 && a0[6]) / 9) <= ((v1 > v3) <= (v2 > v0)));
+    }
+    if ((((53 + v0) / 8) && ((v2 == a0[10]) <= (12 + v0)))) {
+        v1 = (((a1[0][8] % 1) + (a1[2][2] != v1)) || ((12 ? 50 : a0[5]) && (v2 > v0)));
+        v0 = (((v0 && v2) < (v2 <= v3)) / 1);
+        v3 = (((v0 >= a0[4]) / 2) || ((39 ? v3 : 15) > (a1[1][6] >= 37)));
+    } else {
+        a1[3][12] = (((v3 ? 14 : v2) * (78 && v2)) % 8);
+        v1 = (((v0 * v0) * (v2 + v3)) / 2);
+        v0 = (((v3 < v3) ? (a0[8] < 19) : (a0[7] <= v3)) != ((v1 / 3) >= (v2 || a0[13])));
+    }
+    return (((44 && v1) + (v1 / 1)) / 9);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,167 @@
+int f0() {
+    int v0 = 19;
+    int v1 = 40;
+    int v2 = 94;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 > 16) + (9 || v2)) >= ((a1[1][13] - v0) != (a0[6] >= a0[3])));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((a0[0] ? v3 : 70) < (91 + v2)) >= ((24 != v2) + (v2 + i0)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v1 = (((i1 <= a0[15]) * (75 > 82)) < ((82 || a0[0]) / 5));
+                    a1[0][12] = (((v2 > 72) / 1) >= ((a0[7] ? 59 : v1) ? (a1[0][7] / 1) : (v3 ? a1[2][0] : v1)));
+                    v2 = (((a1[2][10] > a1[1][0]) / 8) % 1);
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a1[0][4] - v1) * (v2 / 2)) >= ((v0 / 5) * (0 <= a1[1][14])));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v3 = (((a0[14] >= v2) / 8) >= ((99 * v3) % 1));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v0 = (((38 || a0[7]) + (71 % 1)) ? ((61 && a1[3][11]) != (78 && a1[3][6])) : ((31 ? 25 : v0) > (a1[2][2] + a0[0])));
+            v1 = (((v2 > a0[7]) < (27 * a0[14])) / 1);
+            a1[2][15] = (((i3 == v0) - (v2 < 23)) >= ((i2 + a0[13]) >= (v3 > i2)));
+        }
+        a1[2][2] = (((a1[2][14] ? a0[2] : 59) + (v0 + v1)) == ((i2 == v0) <= (v1 - v2)));
+    }
+    if ((((v2 - a1[0][15]) ? (a1[0][15] == 8) : (v3 ? a1[3][8] : a0[4])) == ((v0 % 3) ? (21 % 4) : (v3 % 4)))) {
+        a0[13] = (((9 > v1) <= (a0[9] && 40)) * ((a0[15] ? v0 : a0[2]) - (44 * a0[4])));
+        v0 = (((68 * a0[3]) >= (a1[1][0] + v2)) * ((a0[5] > v3) % 6));
+        a0[14] = (((a0[3] > v2) * (v3 && a1[2][1])) ? ((a1[1][11] % 9) == (91 ? a1[3][14] : 21)) : ((63 ? a1[0][4] : v3) / 2));
+    } else {
+        a1[2][10] = (((v3 || v0) == (v3 || 19)) || ((a1[2][7] != a1[1][8]) / 4));
+        v0 = (((a1[2][8] > v2) ? (v3 / 1) : (a1[0][6] && 34)) ? ((38 || v1) == (a1[3][4] < v3)) : ((v3 < 54) <= (69 / 8)));
+        v0 = (((v2 ? 87 : a0[2]) && (v0 || 48)) + ((v2 - v2) < (21 % 7)));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((i4 ? 29 : 47) > 76) break;
+        {
+            int i5 = 0;
+            while (i5 < 6) {
+                if ((i4 == a0[7]) > 80) break;
+                v2 = (((38 / 2) >= (a1[1][14] + i4)) * ((v3 / 8) < (62 < v1)));
+                v0 = (((73 / 4) / 5) <= ((a1[3][8] + v2) < (49 >= 54)));
+                v1 = (((v1 + v3) == (v3 != v2)) < ((i5 || 78) != (57 + a0[4])));
+                i5 = i5 + 1;
+            }
+        }
+        a1[2][2] = (((99 * a0[12]) ? (5 == 29) : (69 > a0[5])) > ((v3 ? v3 : 51) || (24 < a0[5])));
+        a0[9] = (((6 != i4) ? (v2 <= i4) : (a0[0] < a0[0])) >= ((35 % 2) > (i4 || a1[0][9])));
+    }
+    return (((a0[14] != 76) <= (v2 / 6)) <= ((v0 || 51) / 5));
+}
+int f1() {
+    int v0 = 86;
+    int v1 = 98;
+    int v2 = 13;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 > v1) && (v1 || v0)) != ((v0 == v1) < (a1[3][7] != a0[10])));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a1[3][0] = (((v2 + 34) && (v2 % 7)) < ((a0[12] ? a1[0][12] : a1[1][2]) < (v2 ? v0 : v0)));
+            {
+                int i1 = 0;
+                do {
+                    a0[7] = (((57 % 3) == (v3 && 45)) <= ((42 == i0) >= (v2 * v3)));
+                    v0 = (((i1 < v3) != (a1[2][15] <= i0)) ? ((a0[2] ? a1[0][9] : v3) <= (v1 == v0)) : ((v0 ? v3 : a1[0][14]) - (i1 < i0)));
+                    v2 = (((v2 >= 71) ? (86 && i0) : (v2 > 68)) <= ((a0[3] / 3) >= (i0 % 2)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            a1[3][8] = (((87 == 25) == (v0 * v0)) >= ((v2 - i0) >= (5 >= a1[1][3])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 <= v3) % 8) + ((v1 <= v1) ? (a1[0][8] && 43) : (v2 || v0)))) {
+        v3 = (((27 - a1[3][1]) - (88 < v1)) >= ((82 + v2) || (v1 != a1[3][13])));
+        a0[15] = (((a1[2][6] > v3) * (a1[1][6] > 58)) <= ((a1[1][6] - v1) * (a0[11] % 1)));
+        a0[9] = (((a0[0] % 9) % 7) > ((92 < 19) * (14 ? a1[2][8] : v0)));
+    } else {
+        v3 = (((a1[2][11] ? v2 : 24) == (v2 >= a0[14])) * ((a1[3][4] && 38) ? (v0 % 9) : (a1[1][5] && a0[4])));
+        v0 = (((v3 && a1[0][6]) == (v3 ? 62 : 19)) > ((v3 && 17) + (v0 >= a1[0][2])));
+        a0[5] = (((63 + v3) < (v0 || 45)) || ((v3 * 36) >= (2 || v3)));
+    }
+    if ((((v2 / 5) == (v0 - 88)) >= ((v2 >= 86) <= (50 <= v3)))) {
+        v2 = (((v0 < v0) ? (a0[1] % 4) : (42 % 2)) ? ((25 > v3) >= (v2 && 42)) : ((v2 == v3) % 1));
+        v0 = (((v0 - a0[5]) >= (v1 % 9)) == ((a1[1][6] >= 8) >= (v3 >= a1[1][10])));
+        a0[2] = (((84 && 24) / 7) >= ((0 / 7) ? (a1[2][10] > 76) : (v0 == v2)));
+    } else {
+        a1[2][15] = (((v1 == a0[9]) + (v3 ? a1[0][2] : v3)) < ((52 / 7) > (v1 ? a1[0][13] : v0)));
+        a1[2][7] = (((a1[2][8] >= v3) == (37 || 63)) % 1);
+        a0[14] = (((v3 != v3) < (a1[3][5] - v1)) ? ((a0[15] > 34) == (v0 ? v1 : 44)) : ((54 == v1) % 6));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((72 < i2) <= (v3 % 2)) - ((62 * 4) + (v1 || i2)));
+            v3 = (((v2 || 13) / 2) <= ((4 <= v0) || (77 != v3)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((a0[0] / 4) == (47 <= a1[1][9])) < ((a1[0][11] - 45) ? (v0 + 8) : (40 % 5)));
+                v0 = (((i3 && 80) ? (a1[2][15] ? v1 : 21) : (a1[1][3] <= v0)) > ((v3 > 34) && (38 > v3)));
+                a0[7] = (((v3 != a1[0][10]) || (v3 <= v1)) != ((v2 < i2) <= (v3 < v3)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    return (((v3 * v0) && (v2 >= a1[2][10])) && ((0 >= a1[0][6]) && (92 || v0)));
+}
+int f2() {
+    int v0 = 94;
+    int v1 = 59;
+    int v2 = 40;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[0] <= 72) - (v0 * 66)) >= ((v3 <= v0) >= (4 < v1)))) {
+        a1[3][1] = (((v0 && 34) >= (3 ? a1[0][2] : 25)) > ((v3 == v1) / 6));
+        v1 = (((v2 >= v0) >= (v0 > v3)) && ((a1[1][9] != a0[5]) ? (v0 && v0) : (v1 - v3)));
+        v2 = (((a1[3][1] && a1[0][8]) * (v3 || v3)) * ((3 / 5) <= (19 || 97)));
+    } else {
+        v3 = (((57 % 6) <= (a0[9] > v3)) != ((23 == a0[13]) <= (8 < a0[10])));
+        v1 = (((v1 == v0) >= (78 <= a1[2][6])) ? ((v1 * 42) != (a1[1][1] / 7)) : ((v0 > v0) / 4));
+        a0[6] = (((69 == v2) == (v2 || 54)) > ((47 >= v3) * (56 - a0[6])));
+    }
+    if ((((v0 == v1) * (a1[2][9] > v2)) < ((a1[3][12] + v1) == (v3 >= 48)))) {
+        v3 = (((24 || v0) || (30 - 74)) && ((91 >= v3) * (a1[0][12] + v1)));
+        v0 = (((v3 == v1) % 8) ? ((v2 ? v1 : 5) * (a1[1][15] + v0)) : ((v2 == v1) ? (a0[1] + v0) : (a1[2][1] % 8)));
+        v3 = (((v2 > v3) && (90 >= a0[15])) <= ((a0[1] == v3) % 4));
+    } else {
+        v3 = (((v2 == a0[9]) ? (a0[14] != v1) : (a1[2][8] && v2)) < ((a0[9] % 3) >= (69 || v0)));
+        v2 = (((8 != v3) ? (v2 ? 95 : 27) : (a1[2][12] ? v2 : v0)) > ((a1[2][3] ? v2 : v1) ? (v3 <= 43) : (a0[11] ? 16 : v1)));
+        v3 = (((v3 && v3) + (18 != v0)) - ((v0 > v1) ? (a1[3][1] ? 50 : v0) : (42 <= v2)));
+    }
+    v3 = (((a0[11] == v0) / 4) >= ((v0 < 35) ? (v2 && v1) : (80 != v0)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v1 = (((a0[5] ? v0 : 16) < (95 ? a0[11] : i0)) && ((78 >= a1[3][1]) - (72 != i0)));
+            a0[8] = (((a0[9] + v3) || (v3 ? 13 : a1[2][15])) ? ((v3 < 76) || (v2 == v2)) : ((a0[4] || v1) && (a1[2][13] * v3)));
+            {
+                int i1 = 0;
+                do {
+                    a0[4] = (((a0[10] + v3) != (i1 * 94)) <= ((13 >= a1[3][5]) / 4));
+                    a0[11] = (((i0 > 47) / 3) * ((v1 < v0) % 3));
+                    a1[1][5] = (((32 * a0[14]) * (v3 >= v3)) >= ((v0 == 55) * (a0[4] || v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v0 % 9) <= (a0[8] / 9)) > ((a1[0][3] >= 39) || (31 > a1[2][15])));
+    return (((v3 + a0[13]) == (20 > v2)) && ((v1 / 1) != (v1 - v0)));
+}
+int main() {
+    return 0;
+}
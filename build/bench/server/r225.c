@@ -0,0 +1,67 @@
+int f0() {
+    int v0 = 60;
+    int v1 = 50;
+    int v2 = 64;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v1 ? a1[2][13] : v1) <= (v1 / 9)) >= ((v3 >= a0[6]) - (v0 || a0[12])));
+            a1[3][6] = (((v2 && 7) && (i0 == 55)) != ((a0[15] >= v0) - (v3 + i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((64 - v1) > 54) break;
+                    a0[2] = (((a0[13] > i1) / 2) % 1);
+                    v3 = (((v3 == v1) + (a0[7] <= v3)) >= ((7 ? a1[0][7] : a0[8]) == (v2 + v3)));
+                    a0[10] = (((i1 < 10) ? (i0 > 16) : (v1 != a0[15])) == ((i1 || i0) <= (i0 && a0[0])));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v2 ? 70 : v2) ? (v2 <= 6) : (v3 || v0)) && ((a1[3][2] + 50) == (10 < v0)))) {
+        v1 = (((v1 ? v0 : 79) <= (v1 && v1)) > ((v2 < v0) - (v0 && v2)));
+        a0[5] = (((v0 == v0) + (v0 % 7)) + ((v0 ? 54 : a1[2][7]) && (v0 > 14)));
+        v2 = (((v0 >= 86) && (a1[1][2] > a1[3][11])) >= ((a1[2][0] && 95) ? (95 && v3) : (v3 ? v1 : v1)));
+    } else {
+        v0 = (((v2 ? a0[4] : v3) * (42 / 7)) % 8);
+        a0[11] = (((82 || v2) && (47 ? v3 : a1[3][1])) > ((94 <= a0[0]) && (v0 == v0)));
+        v2 = (((a1[0][13] == v3) == (v3 > v3)) / 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 != 33) > 57) break;
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    a0[6] = (((v3 ? a1[3][11] : 90) / 4) * ((i3 > v3) % 2));
+                    v3 = (((73 ? a0[7] : v1) >= (a0[12] <= 62)) && ((37 || 67) ? (i3 == v2) : (a1[3][10] ? v0 : a1[3][3])));
+                    v3 = (((i2 % 1) && (55 / 7)) < ((a1[0][2] - 71) == (48 / 8)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v2 >= 68) - (8 && 76)) != ((v2 >= i2) <= (a0[13] + a1[1][8])));
+            v0 = (((v2 && 56) || (i2 ? 69 : 42)) || ((v0 - a1[0][5]) % 9));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v2 = (((a0[7] != v1) ? (11 / 3) : (v2 / 7)) < ((v3 != a1[3][12]) - (v2 * v0)));
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v2 = (((a0[1] * v3) >= (3 >= i4)) || ((11 <= a0[2]) - (a1[0][4] == a0[7])));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            a1[1][4] = (((v3 == v0) > (v2 == i4)) + ((i4 * 39) >= (35 ? i5 : v2)));
+            a1[3][7] = (((v0 < a1[1][0]) - (25 / 8)) - ((i5 % 5) >= (83 * v2)));
+            v0 = (((56 >= a0[6]) * (60 + a1[0][6])) && ((v3 > v1) && (a1[1][5] / 6)));
+        }
+        a1[3][14] = (((56 - a0[12]) ? (v0 / 5) : (v2 == 85)) + ((14 <= 97) / 3));
+    }
+    return (((v2 > a1[1][7]) - (v2 >= 8)) != ((v2 || v1) || (73 - v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,107 @@
+int f0() {
+    int v0 = 28;
+    int v1 = 0;
+    int v2 = 44;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((72 > a1[0][1]) < (v0 + v1)) - ((a0[12] != 51) * (a1[3][0] != a1[0][1])));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a0[12] = (((v0 <= i0) == (a0[10] < 77)) > ((50 ? i0 : a0[11]) != (v1 && v0)));
+                    a0[8] = (((v0 ? i0 : i1) % 9) - ((i1 && 38) + (v2 && 9)));
+                    v1 = (((19 > v0) != (v0 <= v1)) >= ((i1 < 76) >= (a0[5] && a1[1][4])));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[12] = (((37 / 3) ? (i0 % 5) : (i0 == 36)) ? ((v0 || i0) && (a1[3][6] ? a1[2][14] : v1)) : ((12 >= a1[0][11]) && (a1[2][15] < a1[3][4])));
+            v1 = (((80 && a1[0][4]) % 8) ? ((v0 < i0) <= (91 >= 3)) : ((a1[3][2] - i0) && (95 || v2)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((76 / 6) == (a1[3][3] - v0)) && ((a0[10] * v3) < (a1[2][0] / 1)))) {
+        v3 = (((v3 < v1) * (8 || 2)) / 3);
+        a0[13] = (((44 <= v2) && (v1 >= a1[1][9])) < ((a0[6] % 6) <= (59 == v3)));
+        a1[2][1] = (((16 > v1) <= (v2 ? v2 : 50)) > ((a0[11] <= v3) ? (v3 <= a0[15]) : (a1[2][7] - v3)));
+    } else {
+        a1[1][7] = (((v0 - v1) - (v3 && v3)) / 6);
+        v1 = (((v1 != 83) < (a0[3] ? v3 : v1)) / 1);
+        v2 = (((v2 * v0) ? (v1 >= a0[8]) : (33 || a0[15])) - ((86 + 33) >= (36 || a0[12])));
+    }
+    if ((((a1[1][6] != a0[3]) / 8) || ((v2 / 5) && (v1 / 8)))) {
+        v0 = (((v0 + v1) == (a0[8] != v1)) >= ((v1 == v3) != (61 <= a1[2][5])));
+        v0 = (((v3 + 91) > (v1 == a1[2][3])) && ((a1[1][2] >= v3) && (a0[4] ? 95 : a1[2][15])));
+        v1 = (((a1[2][15] - v2) == (v0 != 71)) + ((v3 * 77) ? (v2 >= 38) : (74 == v3)));
+    } else {
+        v3 = (((51 ? 12 : 35) ? (v3 - v2) : (v0 ? 88 : v0)) <= ((80 ? 17 : a0[5]) ? (v0 >= v0) : (v3 % 8)));
+        a1[0][14] = (((80 - a0[11]) - (v2 == a0[5])) ? ((12 && 70) ? (64 && a1[3][9]) : (a1[3][1] < 12)) : ((v1 % 7) <= (v2 && 31)));
+        a1[1][5] = (((v2 ? a0[5] : 56) <= (16 + a1[3][15])) >= ((v3 >= v2) >= (v1 >= v2)));
+    }
+    if ((((a0[11] + v1) >= (v3 ? 71 : 24)) ? ((40 % 8) < (a1[0][7] - a0[5])) : ((a0[14] / 3) || (v2 % 9)))) {
+        v0 = (((v2 ? 16 : a1[1][7]) * (a1[2][7] ? a1[1][6] : a1[1][3])) != ((v3 * v2) != (a1[0][13] < a1[0][13])));
+        v3 = (((68 ? a1[2][11] : a0[13]) > (47 && v2)) != ((v2 && v3) > (32 / 9)));
+        a0[10] = (((v1 == v2) > (46 < a1[1][14])) - ((v0 + v2) / 5));
+    } else {
+        a0[1] = (((v3 >= 93) / 5) / 3);
+        a1[2][8] = (((v3 + a0[13]) % 5) / 1);
+        v2 = (((a1[1][13] ? v1 : v1) && (16 - v1)) ? ((6 % 2) + (v1 < 71)) : ((a1[1][11] * v3) <= (54 > v2)));
+    }
+    return (((v1 <= v1) >= (a1[1][9] >= v0)) != ((a0[4] < v3) <= (a0[13] > 81)));
+}
+int f1() {
+    int v0 = 65;
+    int v1 = 56;
+    int v2 = 84;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 != a0[12]) != (v1 < 9)) > ((v3 + v3) >= (a0[12] - 29)))) {
+        v1 = (((v1 ? v2 : v2) >= (v1 % 2)) || ((a0[8] - 0) == (a0[3] ? a1[0][10] : v3)));
+        v0 = (((v1 <= a1[2][2]) + (a1[2][1] + v2)) ? ((99 - 26) * (a1[1][14] ? 96 : 30)) : ((v1 || a1[3][3]) % 7));
+        v2 = (((v0 < v1) * (v1 / 9)) < ((v3 <= v2) / 7));
+    } else {
+        v2 = (((a0[3] != v1) - (73 + v1)) || ((a1[1][5] % 1) != (v0 != a0[14])));
+        a1[0][5] = (((a1[3][13] + 43) % 8) <= ((a1[1][14] * v0) <= (15 != v3)));
+        a0[1] = (((a1[0][10] > v2) + (a0[8] || a1[1][2])) || ((28 * a0[10]) || (6 / 7)));
+    }
+    v1 = (((41 ? a1[3][6] : v0) > (v1 <= v1)) % 5);
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v3 != a0[5]) > (v2 >= i0)) + ((a1[3][3] * a0[0]) / 7));
+            v3 = (((v1 ? v3 : v3) && (49 / 2)) != ((4 ? a0[9] : 98) * (51 ? v2 : 17)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v2 = (((47 > a0[9]) <= (i0 <= 62)) ? ((i1 >= 66) == (v0 >= 54)) : ((i0 != v0) != (i1 ? v3 : a0[8])));
+                a0[11] = (((i1 <= 96) < (8 - 19)) ? ((v3 || a0[4]) > (i1 + v3)) : ((38 / 8) >= (v1 != a0[5])));
+                v2 = (((v1 >= 49) ? (76 * i0) : (v1 != 78)) + ((v2 / 6) - (a0[7] || v1)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v1 = (((v0 - v1) != (v1 >= 67)) > ((a1[2][14] >= v3) <= (v2 >= v2)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v3 = (((54 < v2) / 7) / 4);
+            v0 = (((49 >= i2) && (a1[3][10] > 74)) ? ((42 ? 81 : v1) < (a0[14] == 35)) : ((i2 == v1) ? (v1 % 9) : (v0 ? i2 : v1)));
+            {
+                int i3 = 0;
+                do {
+                    a0[1] = (((84 - a1[2][2]) > (a1[3][6] % 7)) <= ((a1[0][4] ? i3 : a0[15]) % 1));
+                    v0 = (((a1[1][7] && 20) + (80 && 15)) - ((25 || a1[3][15]) / 8));
+                    v1 = (((v1 + 69) > (a1[2][1] ? 1 : v3)) >= ((92 || 76) * (i2 * v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((a0[2] + 19) ? (59 % 5) : (v0 <= a0[0])) > ((v2 != v1) <= (v1 != 30)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,197 @@
+int f0() {
+    int v0 = 73;
+    int v1 = 96;
+    int v2 = 75;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((i1 + v1) + (v3 != 47)) - ((i0 / 4) || (94 ? 58 : a0[4])));
+                    v3 = (((a1[1][15] % 5) - (a1[1][13] == v1)) <= ((i0 / 8) && (v2 >= v1)));
+                    v3 = (((a1[0][6] || i0) + (v3 >= i1)) + ((v2 >= a1[3][11]) == (46 && a0[11])));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v2 = (((v1 <= 96) < (91 > 33)) > ((a0[11] * v1) != (a1[2][8] % 1)));
+            v0 = (((v1 - a0[15]) < (83 % 7)) != ((v2 ? a1[3][5] : 76) <= (34 >= 11)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((a1[0][10] < v1) || (53 && v0)) <= ((v2 - a0[12]) - (v2 - v3)))) {
+        v0 = (((39 / 9) <= (v0 / 8)) > ((v1 - v2) - (v2 / 6)));
+        v2 = (((a1[1][2] && 80) <= (v1 / 1)) * ((v2 == 12) < (a1[1][6] * v2)));
+        a0[13] = (((80 * 10) > (41 ? a1[0][13] : v0)) ? ((v3 + v1) >= (92 < 74)) : ((v3 < v0) / 8));
+    } else {
+        a1[0][6] = (((a1[2][8] % 2) > (a1[3][13] - v0)) ? ((v3 * v3) * (a0[12] >= v2)) : ((v1 <= a1[0][13]) && (54 == a0[12])));
+        v1 = (((a0[11] == a1[2][13]) > (14 || a0[4])) >= ((a1[1][7] + v2) >= (a1[1][1] / 3)));
+        a0[10] = (((a1[0][11] + 88) < (v3 && v3)) + ((v3 / 2) / 9));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v2 = (((i2 % 8) % 5) && ((v1 || 27) > (i2 - 16)));
+        v3 = (((v3 > v0) && (12 ? v0 : 52)) == ((v3 / 8) <= (v1 ? a1[2][0] : i2)));
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            a0[10] = (((v2 != i2) / 6) > ((a1[3][11] && 9) ? (39 - 66) : (61 * a0[7])));
+            a0[6] = (((a0[4] * 83) == (23 != v1)) && ((a1[1][12] || v0) || (58 >= v2)));
+            a0[3] = (((v3 >= 92) / 3) <= ((i3 ? v0 : 35) * (48 == i3)));
+        }
+    }
+    if ((((v0 >= v3) > (a1[1][5] || v2)) + ((v2 < a0[15]) == (64 || v2)))) {
+        v2 = (((88 - v2) <= (a0[6] * 77)) ? ((a0[12] + v0) ? (v2 + a1[3][4]) : (v2 && 47)) : ((4 <= 23) * (v2 / 5)));
+        a1[3][7] = (((v3 ? 16 : v1) * (33 == v3)) >= ((v0 < v1) ? (a1[1][15] || a1[1][1]) : (53 <= v3)));
+        v3 = (((a1[3][12] / 2) - (v0 > v3)) + ((48 ? 28 : 53) || (a0[9] >= 0)));
+    } else {
+        v2 = (((5 || v0) > (v3 + a1[1][0])) <= ((v2 ? a0[10] : v1) && (a0[15] - v0)));
+        v0 = (((v0 == v1) || (a0[3] ? v1 : 68)) || ((v3 != 11) > (a1[2][13] % 5)));
+        a1[1][0] = (((v1 + v0) ? (v1 < 16) : (64 && v1)) * ((2 % 8) <= (59 % 4)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[7] = (((i4 && 77) < (v3 < v3)) && ((a0[7] - 24) ? (v2 == 44) : (i4 ? 51 : v2)));
+            v3 = (((v0 >= 47) ? (v1 ? v3 : a0[3]) : (v2 % 1)) * ((a0[10] + v2) >= (36 >= 61)));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    if ((a0[2] <= v2) > 98) break;
+                    a0[12] = (((a1[2][14] + a1[0][5]) >= (a0[1] % 1)) || ((v3 + v0) < (v1 + v1)));
+                    v0 = (((a0[7] != 19) % 7) % 7);
+                    v3 = (((74 == a0[8]) >= (v0 && a1[3][12])) && ((67 && 71) > (v2 + v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    return (((a0[8] > v2) && (v0 - v3)) && ((80 >= 81) - (a0[5] % 9)));
+}
+int f1() {
+    int v0 = 4;
+    int v1 = 70;
+    int v2 = 11;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v0 = (((72 / 9) * (v0 > 2)) - ((v1 ? 63 : 26) && (v0 || a1[1][14])));
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[0][10] ? 72 : i0) > 64) break;
+                    v3 = (((v3 ? v1 : i0) >= (v0 != i0)) || ((a1[3][10] > 56) - (i1 != 42)));
+                    a0[15] = (((a1[0][12] == v2) ? (70 != 0) : (i0 && 97)) <= ((i0 - v1) + (5 > a1[2][0])));
+                    v2 = (((v0 ? v2 : i1) % 4) <= ((v3 == a1[3][8]) && (v2 && v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v3 = (((63 - v2) % 2) == ((75 == v3) + (v0 < 75)));
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((a1[2][9] * v0) ? (a0[10] + v2) : (v1 ? 88 : 15)) != ((v1 != v0) % 3));
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((v0 ? a1[3][10] : v1) > 80) break;
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            a1[3][1] = (((50 || a1[1][0]) && (v3 || 32)) + ((80 / 9) > (54 && v3)));
+            v2 = (((v2 > a0[14]) ? (i3 && v3) : (v2 <= i3)) - ((v1 ? i2 : 42) * (61 <= i2)));
+            v0 = (((a0[8] != i2) ? (21 * v0) : (a0[14] == 99)) * ((97 == v2) - (i2 / 4)));
+        }
+        v0 = (((v2 < i2) <= (v2 >= a0[3])) < ((30 > 78) != (33 <= a1[3][9])));
+        a0[12] = (((i2 - v0) % 6) ? ((a0[4] >= v2) != (13 - 91)) : ((i2 && a0[11]) == (a0[8] - 86)));
+    }
+    if ((((v1 ? a1[2][3] : a0[7]) / 5) ? ((v1 + v2) ? (a0[8] / 7) : (a0[13] || a1[0][12])) : ((v3 >= v1) > (v3 || 2)))) {
+        v0 = (((47 != v2) * (a1[2][11] <= v0)) * ((v2 / 8) / 1));
+        a1[3][5] = (((v1 == 19) && (v3 * a1[3][9])) <= ((v1 <= v0) + (v3 || v3)));
+        v2 = (((17 != v0) < (a1[1][2] != v0)) ? ((55 >= a1[0][11]) + (v1 ? v1 : v2)) : ((20 == 82) % 1));
+    } else {
+        v0 = (((a0[9] * 93) > (v2 ? v1 : v0)) ? ((a1[2][15] + v3) <= (98 ? v2 : 7)) : ((v2 * v0) < (a1[3][5] < v1)));
+        v3 = (((v3 <= v0) ? (v0 ? 7 : v1) : (68 <= v0)) ? ((v3 == a0[7]) % 7) : ((v0 + v2) >= (v1 <= v1)));
+        v3 = (((28 || v1) != (v0 % 7)) % 4);
+    }
+    v0 = (((v2 > 57) < (84 < 70)) / 7);
+    return (((v3 <= a1[0][13]) && (v3 < v0)) && ((v2 % 7) && (v2 < v2)));
+}
+int f2() {
+    int v0 = 12;
+    int v1 = 75;
+    int v2 = 96;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    if ((((48 > a1[0][9]) && (33 < a0[13])) ? ((v2 || v1) - (v2 ? v1 : 73)) : ((a1[3][3] && v2) ? (v2 == v2) : (v1 * v1)))) {
+        v1 = (((v0 ? v0 : 76) - (a1[1][15] > 91)) * ((v0 || v3) / 7));
+        a1[1][11] = (((v1 && a1[1][14]) ? (v1 || v1) : (a1[0][11] / 6)) + ((v3 < a1[3][10]) % 1));
+        v2 = (((v0 - v2) / 7) ? ((v1 * v2) && (a0[3] % 5)) : ((6 * v3) % 5));
+    } else {
+        a0[3] = (((a0[8] <= v1) ? (a0[7] != v1) : (a1[1][8] && 51)) && ((v2 && a0[13]) != (10 ? v3 : 24)));
+        v2 = (((v0 - v1) - (55 == v0)) - ((15 <= v2) || (a0[3] * a1[3][3])));
+        v0 = (((v0 != v2) + (a1[1][11] * v0)) && ((v0 - 21) - (a1[2][3] + v0)));
+    }
+    if ((((a0[11] != 74) && (a1[1][13] && v0)) % 7)) {
+        a1[0][1] = (((v0 + 3) > (v1 * v3)) != ((1 <= v2) < (v0 || v2)));
+        v1 = (((v2 + a1[2][8]) != (v2 && v2)) < ((v0 && 18) / 1));
+        v2 = (((70 ? a1[2][7] : a0[3]) < (v1 ? 18 : v1)) || ((35 >= a1[0][6]) / 9));
+    } else {
+        v2 = (((v1 && 65) <= (v3 != v1)) % 5);
+        v3 = (((a1[1][8] != a0[15]) ? (v0 || v1) : (v0 ? a0[11] : v3)) || ((v0 != v0) / 2));
+        a0[0] = (((81 > 10) == (v0 == v3)) ? ((v0 + v2) + (v2 && a1[3][3])) : ((45 < 69) < (v3 ? v1 : a0[1])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v0 = (((86 ? 91 : a1[2][7]) >= (a1[3][1] || v0)) - ((v3 / 5) ? (i0 > a0[13]) : (v1 >= 23)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v3 = (((v2 < a1[1][11]) || (v3 != 14)) <= ((86 + 44) * (i1 > 94)));
+                v2 = (((v0 >= v1) <= (v3 && a1[0][3])) - ((v3 && v1) % 4));
+                v0 = (((a1[0][0] && a1[1][3]) < (v3 ? a0[0] : a0[8])) || ((a1[3][7] == 76) != (i1 - a1[3][2])));
+            }
+            v1 = (((24 ? 5 : a0[2]) - (v3 == v2)) / 2);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    a0[6] = (((20 - 69) || (v0 <= 70)) <= ((a0[15] > i2) > (a0[3] > 63)));
+                    v3 = (((v0 >= 11) <= (v1 >= a0[13])) ? ((27 ? 11 : v0) % 3) : ((v2 - a1[0][9]) ? (v0 >= a1[3][10]) : (v3 >= 84)));
+                    v3 = (((v0 - 27) * (3 || v0)) % 3);
+                    i3 = i3 + 1;
+                }
+            }
+            a1[0][10] = (((a0[15] - 33) == (v2 <= v0)) <= ((v2 / 2) <= (v3 % 1)));
+            v2 = (((41 && v1) % 6) ? ((v0 != a0[6]) - (v0 ? a0[12] : v2)) : ((v1 == i2) >= (38 < 51)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((v2 > 68) > 62) break;
+            v2 = (((i4 ? v3 : 11) - (69 <= v2)) ? ((72 != 29) && (i4 || v0)) : ((a0[0] >= a1[0][9]) ? (v3 != a0[8]) : (i4 <= 59)));
+            {
+                int i5 = 0;
+                do {
+                    a0[9] = (((i5 < v1) || (10 >= i5)) ? ((a0[13] * 99) ? (91 % 3) : (v2 / 9)) : ((v3 ? a0[0] : i4) == (a1[3][11] > a1[2][14])));
+                    v3 = (((24 == v3) * (i4 <= a1[0][7])) - ((10 && 7) ? (a0[1] - 68) : (2 < v3)));
+                    v3 = (((a1[2][9] + 60) * (v1 >= a1[3][6])) == ((62 && v2) >= (11 <= v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v1 = (((a1[2][7] - v2) ? (a0[9] != v1) : (v1 ? 49 : 44)) == ((a0[6] / 1) ? (v1 < i4) : (v2 ? i4 : a1[2][13])));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[0][7] + a1[3][5]) > (86 != v0)) ? ((a0[4] ? a0[1] : v2) <= (v0 / 1)) : ((v0 && 88) != (a1[3][7] < v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,87 @@
+int f0() {
+    int v0 = 93;
+    int v1 = 65;
+    int v2 = 68;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v2 = (((a0[0] == v3) < (i0 - v0)) < ((9 / 7) > (i0 || v2)));
+        {
+            int i1 = 0;
+            do {
+                if ((22 <= v3) > 93) break;
+                a1[2][6] = (((a0[7] >= v3) != (v2 % 4)) == ((66 % 9) ? (v0 >= v1) : (v0 * v1)));
+                a1[3][0] = (((a1[3][10] >= a0[10]) || (11 && v3)) % 8);
+                v3 = (((v0 > i1) == (i1 > i1)) + ((v3 - a0[14]) ? (a1[1][10] <= i1) : (a1[3][5] == 80)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        a0[14] = (((v2 ? a1[0][15] : v0) != (v0 >= 62)) || ((v3 != a1[1][7]) != (44 >= 33)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a1[1][14] = (((v0 && 21) % 6) == ((a1[1][9] * a0[6]) || (v0 < v1)));
+                    v0 = (((90 <= v0) + (v2 < 45)) ? ((10 < i3) <= (i2 <= a0[10])) : ((v0 + 94) <= (a0[15] <= a0[5])));
+                    v1 = (((v2 > i2) || (a1[3][2] != 60)) || ((i3 == a1[0][13]) == (a1[2][7] < a0[5])));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v2 ? v1 : a0[12]) <= (19 > v3)) == ((45 >= v3) % 2));
+            v2 = (((37 < v0) * (i2 != a1[0][15])) < ((i2 < v0) ? (v1 ? i2 : a1[2][7]) : (v1 >= v2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v3 % 8) >= (47 || a1[3][6])) + ((v3 + v0) == (a1[2][11] ? i5 : v3)));
+                    v2 = (((i4 < a0[6]) <= (v3 * i4)) || ((i4 || v0) - (v1 / 4)));
+                    v0 = (((a1[0][10] - v0) ? (a1[3][14] && 56) : (a1[0][4] * v3)) * ((v2 == a0[8]) * (60 != 93)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            a1[2][12] = (((v3 && a1[2][14]) || (v0 % 6)) ? ((v3 / 7) >= (v0 && v0)) : ((v2 + a1[3][9]) != (63 + a0[13])));
+            v3 = (((v0 - 70) || (a1[3][14] > v0)) % 8);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v1 = (((97 || v0) <= (a0[1] >= 83)) > ((v2 > 8) / 9));
+                v1 = (((a0[4] && v0) - (i6 == v3)) >= ((a1[0][12] % 1) ? (a1[1][6] + a1[3][3]) : (v3 % 9)));
+                v2 = (((a0[7] < 85) / 3) <= ((v2 == 15) / 4));
+            }
+            v3 = (((a0[2] * 35) - (v3 ? i6 : a0[0])) != ((a0[14] <= v0) + (a0[10] > v1)));
+            a0[2] = (((v0 ? 87 : v1) >= (47 / 6)) <= ((v2 ? v2 : v3) ? (v3 ? v2 : i6) : (v1 ? v3 : 28)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 6; i8 = i8 + 1) {
+        v0 = (((v0 ? v2 : a1[3][6]) * (v0 || v3)) % 4);
+        a0[9] = (((i8 ? 10 : v2) > (a1[2][9] <= v2)) == ((v2 != v3) || (v3 - a0[6])));
+        {
+            int i9 = 0;
+            do {
+                if ((i9 == a1[0][0]) > 57) break;
+                v2 = (((i9 - i9) && (v2 != v3)) > ((v0 / 1) * (5 && v1)));
+                a0[4] = (((v1 ? i8 : 68) != (a0[1] * i9)) * ((18 / 9) || (v1 != v3)));
+                a0[0] = (((45 <= a0[5]) > (59 + 70)) < ((i9 && v3) / 3));
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+    }
+    return (((12 && 86) < (v2 && 51)) % 8);
+}
+int main() {
+    return 0;
+}
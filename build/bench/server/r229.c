@@ -0,0 +1,104 @@
+int f0() {
+    int v0 = 88;
+    int v1 = 40;
+    int v2 = 8;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    a1[3][6] = (((v3 % 1) - (v1 + a1[3][13])) * ((v0 == a0[5]) / 5));
+    a0[9] = (((v3 < a1[3][8]) % 2) % 9);
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v0 < 64) > 90) break;
+            a0[15] = (((19 ? v3 : 9) >= (v0 || i0)) != ((v2 || 10) < (v3 >= v2)));
+            v3 = (((v0 - a1[3][12]) / 5) % 6);
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[12] == v0) > 95) break;
+                    v0 = (((v3 - v3) <= (42 / 3)) % 4);
+                    v2 = (((79 ? v2 : i0) >= (v1 ? v0 : v2)) ? ((v0 + 83) && (i0 / 8)) : ((v2 < v0) == (a1[2][2] < a0[10])));
+                    v0 = (((i1 <= 42) - (82 % 9)) >= ((i1 / 1) ? (a1[1][9] <= v0) : (2 - 10)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((64 + 23) * (v3 > v3)) / 5)) {
+        v2 = (((v2 >= v2) / 4) ? ((v2 || a0[10]) + (v3 && v0)) : ((v1 / 7) > (v1 > v1)));
+        v2 = (((v1 >= v1) - (77 == v0)) % 9);
+        a0[13] = (((v2 == v2) < (52 <= v1)) || ((38 > a0[9]) * (a0[3] * a1[2][5])));
+    } else {
+        v3 = (((a1[2][7] % 3) && (27 / 4)) != ((v1 % 7) == (a0[13] / 8)));
+        a1[1][6] = (((v3 ? 29 : 54) * (v3 > v3)) > ((a1[2][3] > 83) <= (v3 && a1[2][3])));
+        v3 = (((v1 && v0) || (a0[1] + v3)) ? ((v0 || a1[3][1]) ? (a0[6] - v2) : (62 == 58)) : ((v1 != v1) < (a1[2][13] < v3)));
+    }
+    v1 = (((26 <= 78) != (v0 >= v1)) < ((v1 % 5) * (53 != a1[2][7])));
+    return (((v2 < v3) && (v0 && v1)) ? ((a0[3] != v1) && (v1 < 23)) : ((v1 / 8) ? (v3 >= 99) : (13 >= v3)));
+}
+int f1() {
+    int v0 = 36;
+    int v1 = 19;
+    int v2 = 75;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][0] * 53) <= (v0 % 2)) ? ((v3 ? a1[3][12] : a1[3][8]) && (a0[5] || 49)) : ((a1[0][13] == v3) >= (a1[3][1] ? 3 : 75)))) {
+        v3 = (((v1 - 35) - (v0 <= a0[4])) || ((v0 != 5) + (14 < v3)));
+        v3 = (((v0 && 30) % 4) * ((v1 - a0[7]) - (a0[4] + a1[0][5])));
+        a1[0][9] = (((47 > v3) == (82 == v3)) != ((53 ? a0[12] : 21) + (v2 <= a0[1])));
+    } else {
+        a0[11] = (((2 < v3) * (9 ? v3 : a0[9])) * ((v0 % 2) > (69 != a0[14])));
+        v0 = (((v3 != v2) - (v0 || v0)) > ((50 < v3) >= (1 / 4)));
+        v3 = (((a0[8] || v3) ? (26 * v1) : (a0[3] && v3)) < ((a0[15] % 5) || (v0 % 2)));
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a1[3][3] = (((v0 > v0) ? (7 - v3) : (v3 % 6)) || ((36 || 29) ? (i0 < 88) : (i0 != 56)));
+        a0[10] = (((a1[1][12] / 8) - (a1[2][3] ? 27 : a1[1][13])) ? ((v3 <= a1[0][5]) != (v3 < v1)) : ((7 % 7) == (a0[12] + v3)));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                if ((a1[3][7] - v1) > 64) break;
+                v0 = (((34 > v0) || (57 ? v1 : a0[13])) != ((65 >= a1[3][4]) + (i1 ? a1[2][14] : v2)));
+                a1[2][14] = (((a0[3] != 56) == (v3 < i1)) > ((a0[14] >= 27) >= (v1 - i0)));
+                a0[13] = (((61 ? a1[0][1] : v3) - (v2 * a1[1][14])) ? ((v2 <= i1) - (v1 == 77)) : ((71 % 5) != (v2 <= 93)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[3][14] <= i2) > 89) break;
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                a0[0] = (((a1[1][14] <= 21) % 9) == ((a0[9] <= 46) + (97 ? a0[6] : v2)));
+                v1 = (((90 * a0[7]) % 2) * ((v1 < v3) + (i2 * v0)));
+                v2 = (((a0[11] / 6) * (a1[3][6] || v3)) * ((24 - 24) && (v1 / 4)));
+            }
+            v3 = (((a1[3][3] ? i2 : i2) && (a0[0] != a1[3][11])) < ((a0[0] - 85) - (77 % 6)));
+            a0[7] = (((v0 == 33) % 9) ? ((v2 <= a1[2][5]) ? (99 * v0) : (80 % 6)) : ((v2 * a1[0][12]) % 2));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((v3 ? v2 : v1) > 83) break;
+        a1[3][1] = (((v2 ? i4 : i4) > (v1 || i4)) ? ((i4 * v2) > (13 * v2)) : ((a0[7] >= v1) ? (v0 < v1) : (a0[3] ? a1[2][12] : v2)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((v0 % 8) / 7) - ((v2 && v0) < (a1[0][10] ? 25 : v3)));
+                v2 = (((92 && v3) != (a1[0][15] >= a0[8])) != ((v3 + a1[1][6]) % 9));
+                v3 = (((v0 - 77) ? (19 == i5) : (75 + 18)) - ((v3 % 2) < (i4 >= v1)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        v2 = (((a0[1] <= v0) < (a1[0][13] && 53)) - ((i4 == v0) > (v3 % 9)));
+    }
+    v0 = (((v0 / 1) % 4) ? ((a0[4] || v0) >= (55 + 57)) : ((a1[0][9] || v1) < (37 ? 8 : v1)));
+    return (((v0 < 98) ? (a0[1] + v1) : (16 != 36)) != ((a1[3][1] % 4) ? (14 > v3) : (v2 - v2)));
+}
+int main() {
+    return 0;
+}
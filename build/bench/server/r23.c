@@ -0,0 +1,194 @@
+int f0() {
+    int v0 = 14;
+    int v1 = 55;
+    int v2 = 76;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((7 != v0) > 93) break;
+            a1[0][10] = (((a0[7] + a1[1][15]) >= (a0[7] ? v3 : v3)) != ((v1 == v1) % 7));
+            v3 = (((33 % 7) - (41 ? v3 : a1[1][12])) > ((a0[11] > v2) <= (a1[0][15] ? i0 : i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[3][10] && a1[0][11]) > 95) break;
+                    v3 = (((i0 ? i0 : i0) == (i0 / 6)) > ((v2 == v2) + (i0 - v0)));
+                    a0[11] = (((i0 ? 21 : a0[9]) / 2) && ((v3 <= i0) != (50 ? a1[1][4] : a1[3][4])));
+                    v0 = (((90 * v3) || (v2 % 4)) >= ((i0 - v2) * (v2 + i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v1 = (((a0[15] + a0[5]) <= (v0 || v0)) ? ((15 || v1) / 9) : ((7 < a0[14]) * (i2 * 63)));
+                    v3 = (((v1 ? a1[2][12] : v3) * (i3 || v3)) <= ((v1 > a0[14]) || (v1 || 91)));
+                    a1[2][15] = (((32 && v0) ? (v0 / 3) : (v1 >= 56)) != ((i2 == 86) || (v3 <= a0[6])));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((98 ? 37 : 51) * (53 / 5)) % 3);
+            v3 = (((81 < v1) > (a1[3][9] < a1[1][14])) < ((v3 <= v1) <= (v1 <= a0[13])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[3] > v2) || (v2 % 5)) + ((a0[2] / 1) % 6))) {
+        a1[1][11] = (((50 < v2) + (54 * 50)) % 5);
+        v2 = (((42 + v3) != (v3 + 4)) ? ((v2 + a0[15]) ? (v3 != v2) : (v1 * v2)) : ((41 > 71) != (v3 == 36)));
+        v2 = (((80 > a1[2][0]) - (a0[11] - v2)) / 4);
+    } else {
+        a0[4] = (((95 < v2) != (v2 + v3)) ? ((v3 ? a0[12] : a1[1][11]) ? (v3 <= v1) : (47 && 56)) : ((a1[3][12] ? v0 : a0[15]) ? (v0 * v0) : (82 || 92)));
+        v3 = (((v1 * v0) - (v0 ? 37 : v3)) ? ((a0[9] == a0[2]) - (v2 <= 4)) : ((v1 + 3) % 4));
+        v0 = (((17 ? 25 : v1) - (v3 >= 34)) || ((a1[3][3] - v2) < (64 == 26)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((58 != 59) / 7) % 6);
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((a1[1][4] > 74) / 8) || ((v1 && a0[2]) <= (52 < 27)));
+                    v3 = (((35 ? 1 : 25) <= (65 ? v1 : 57)) + ((v3 ? 74 : i4) <= (a0[1] == 88)));
+                    v2 = (((i4 > a0[9]) / 9) > ((6 != 10) - (15 && v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a1[1][3] = (((v1 - v1) || (v1 ? v2 : i4)) > ((i4 - 14) % 7));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    if ((((a1[3][3] < a0[10]) > (a0[6] || v2)) <= ((v2 < 38) >= (v0 % 4)))) {
+        v0 = (((46 <= v2) * (8 != v1)) ? ((v1 == a0[6]) * (a1[0][9] > v3)) : ((v2 < v0) && (71 ? a1[0][15] : v0)));
+        v3 = (((v0 ? 3 : v3) == (v0 / 4)) % 1);
+        v0 = (((v0 <= 34) ? (v0 + a0[15]) : (v0 || v1)) % 1);
+    } else {
+        v3 = (((53 || v1) + (39 * a0[0])) <= ((v2 && v3) <= (86 < v0)));
+        v0 = (((60 <= v2) ? (v3 < v0) : (v3 ? v1 : v3)) % 5);
+        v2 = (((v3 - a0[8]) ? (34 * v2) : (48 >= v2)) && ((84 <= 47) == (a0[14] * v2)));
+    }
+    return (((v2 < v0) / 1) > ((v2 != 58) / 8));
+}
+int f1() {
+    int v0 = 47;
+    int v1 = 39;
+    int v2 = 43;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v0 != v3) - (a0[8] ? 4 : 7)) >= ((71 - v1) < (v3 / 9)));
+    v1 = (((80 - v2) || (86 % 2)) ? ((v3 ? v3 : 40) / 8) : ((93 < 5) >= (v1 <= v0)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v3 = (((v1 + v3) != (75 && v1)) ? ((i1 && v0) + (v1 + 77)) : ((a1[3][1] % 3) > (a0[8] % 4)));
+                a1[0][0] = (((i1 % 8) ? (v3 + i1) : (a0[10] + 19)) % 2);
+                v1 = (((v2 >= v2) > (a1[2][2] ? 73 : a0[4])) != ((60 == a0[7]) - (v2 % 9)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v0 = (((84 == v0) && (i0 <= i0)) ? ((a0[2] % 8) > (v0 ? a1[3][6] : v1)) : ((93 * v3) >= (98 % 5)));
+        v2 = (((v1 > 50) || (v1 || a0[12])) / 2);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((a1[1][6] % 5) > 76) break;
+        a1[3][13] = (((a0[3] % 1) == (86 - 66)) ? ((i2 ? a1[0][7] : i2) == (11 <= v0)) : ((64 % 5) <= (v2 != 94)));
+        v1 = (((v0 < v2) + (a0[3] < 37)) * ((27 + v0) != (a0[13] == v0)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v2 = (((v1 ? i2 : 33) || (17 || v2)) != ((v3 > 68) || (v0 % 2)));
+            v0 = (((i2 <= v0) + (i3 && a1[3][6])) * ((1 <= 61) ? (39 <= 30) : (v2 && a1[1][7])));
+            a0[7] = (((v3 >= 94) != (a0[9] % 5)) * ((a0[8] && a0[4]) % 6));
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((48 != 11) > 84) break;
+        {
+            int i5 = 0;
+            do {
+                v0 = (((v1 < a1[3][14]) < (i5 <= a0[4])) <= ((v3 / 7) > (a1[2][4] * v3)));
+                v1 = (((i5 / 3) ? (i5 % 2) : (a1[1][2] % 3)) / 3);
+                a1[1][4] = (((v0 / 3) || (0 && v0)) % 5);
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v2 = (((i4 >= i4) * (26 && a1[1][6])) / 9);
+        a1[3][8] = (((v3 || v0) - (v3 - v2)) % 7);
+    }
+    return (((a0[12] - a0[14]) % 7) != ((a0[4] - v3) != (v0 ? a0[13] : a1[1][7])));
+}
+int f2() {
+    int v0 = 19;
+    int v1 = 95;
+    int v2 = 42;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v1 ? v1 : a1[0][12]) > 60) break;
+            v1 = (((a0[8] <= a0[6]) && (a1[2][4] + i0)) + ((32 && i0) == (a1[0][8] > v2)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[0][15] = (((i1 == 29) || (a1[2][5] != a0[6])) || ((v1 && 83) + (i0 != v2)));
+                    a0[14] = (((i1 || a0[3]) != (v2 / 7)) ? ((i1 > i1) < (15 ? a0[5] : v1)) : ((a1[3][3] % 8) % 1));
+                    a0[12] = (((v0 < i1) == (a0[4] || v1)) * ((v2 == 67) ? (i1 > v0) : (a1[1][3] + v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a1[3][13] < i0) && (a1[3][12] > a0[0])) ? ((27 % 7) / 7) : ((a0[15] > v1) || (a1[1][14] || a0[12])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 || v1) ? (v0 * v1) : (50 - 41)) <= ((v3 >= 69) != (a0[6] == v1)))) {
+        v1 = (((a0[7] / 7) % 3) == ((v0 || v0) || (v1 >= v1)));
+        v3 = (((71 ? v3 : 83) <= (v2 % 9)) < ((41 > a1[0][0]) / 9));
+        a0[9] = (((v1 - 83) <= (v0 / 2)) <= ((90 < 14) - (a0[7] == v1)));
+    } else {
+        a1[3][9] = (((v2 == v1) || (v2 <= v2)) % 8);
+        v0 = (((1 != v1) > (a1[2][2] + v0)) <= ((v3 % 5) < (a0[7] - v3)));
+        v3 = (((v1 && v1) != (a0[1] >= v3)) != ((v3 * 89) / 4));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v3 = (((42 + v0) % 6) ? ((v3 + v2) < (a1[0][3] > a1[0][7])) : ((i2 ? v0 : v2) < (a0[6] < v1)));
+        a0[14] = (((v0 && v0) - (i2 / 3)) < ((v0 + v2) < (a0[0] && v0)));
+        {
+            int i3 = 0;
+            do {
+                a0[4] = (((v2 || 50) || (16 * v1)) < ((v0 + v2) == (a0[1] % 7)));
+                v2 = (((v0 >= a0[0]) * (a0[15] ? a1[0][11] : a0[15])) ? ((a0[13] != v3) <= (v2 < a0[7])) : ((i2 ? a1[3][10] : i2) || (v3 >= i2)));
+                v1 = (((v0 ? v2 : v1) && (v0 - 82)) || ((89 ? a1[0][12] : a0[13]) ? (52 + v0) : (v1 <= 5)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+    }
+    if ((((v0 < 78) ? (v0 && v3) : (v3 || v3)) != ((v3 * v3) - (v2 >= a0[10])))) {
+        a0[12] = (((28 && a1[0][2]) != (v1 > v1)) ? ((v3 < v3) >= (v3 % 7)) : ((59 ? 72 : a0[14]) || (a1[1][8] % 6)));
+        v1 = (((56 * a1[2][2]) % 4) <= ((3 <= a1[0][1]) <= (v2 || 27)));
+        v3 = (((a1[0][13] - v2) != (v1 ? v2 : v1)) - ((23 < a0[15]) < (a0[8] / 9)));
+    } else {
+        v2 = (((72 == 19) != (a0[3] ? 78 : a0[5])) || ((v0 < a0[8]) || (12 > v1)));
+        v2 = (((v1 && v1) + (66 <= v1)) / 3);
+        v0 = (((v1 * v0) <= (12 == 14)) || ((v0 >= a1[2][14]) % 4));
+    }
+    v3 = (((62 ? v3 : v0) >= (77 * v2)) && ((a1[3][8] >= 2) ? (66 && 93) : (v3 / 7)));
+    return (((v3 ? v3 : v2) ? (3 + a0[8]) : (91 == 28)) <= ((v0 / 6) % 4));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,151 @@
+int f0() {
+    int v0 = 51;
+    int v1 = 0;
+    int v2 = 60;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    a0[1] = (((42 * v2) + (a1[1][12] + a1[1][13])) || ((v3 < 24) <= (v0 || v3)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                a1[1][15] = (((v3 / 9) > (a1[2][10] != a1[1][12])) <= ((31 ? a1[1][4] : 1) * (63 >= v2)));
+                v1 = (((v0 > a1[0][14]) && (a0[13] <= v2)) / 5);
+                v2 = (((a1[1][1] != 10) ? (v2 * i1) : (40 / 1)) - ((a0[12] * a0[7]) <= (v2 / 4)));
+            }
+            v1 = (((a1[1][14] > 45) < (27 ? v0 : v1)) ? ((v2 < v3) - (v3 + v2)) : ((v3 <= a1[3][12]) - (a1[0][13] - 88)));
+            a0[1] = (((v1 || v3) + (45 && v3)) ? ((78 <= a0[13]) * (v3 * i0)) : ((v2 ? a0[13] : v2) ? (v1 - v2) : (a0[8] + 99)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((42 <= v3) % 5) != ((19 * a1[1][5]) <= (a0[4] != v2)))) {
+        v3 = (((v3 - v0) != (v1 > a0[9])) ? ((v2 && 49) || (v0 ? v0 : 68)) : ((a0[12] <= a0[10]) <= (v0 < v3)));
+        v3 = (((37 < v3) <= (a1[0][4] || a1[2][12])) + ((v0 ? 12 : v3) && (35 >= a0[8])));
+        v3 = (((a1[0][12] == a0[15]) > (v2 ? v0 : v0)) < ((v3 || v1) >= (38 && v1)));
+    } else {
+        v2 = (((a0[0] == 45) ? (v3 <= v1) : (2 > 97)) - ((v3 ? a1[2][14] : a0[2]) * (v1 < a1[3][0])));
+        v1 = (((v1 != v3) / 3) && ((a0[13] ? a0[7] : a1[0][8]) <= (50 || v2)));
+        a0[0] = (((v3 - v3) * (a0[9] && a0[1])) ? ((a1[0][4] + v3) == (a1[1][10] == v1)) : ((v1 >= a1[1][9]) < (a0[12] % 1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((90 + i2) > (83 - a1[3][5])) >= ((i3 && i3) + (i2 * i2)));
+                    a1[1][14] = (((i3 && i2) - (47 % 5)) <= ((v0 < v0) - (i2 != v0)));
+                    a1[2][1] = (((a1[0][7] == v0) > (v3 > v0)) == ((a0[8] ? 23 : i2) + (v1 != 13)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a1[0][5] = (((a1[0][1] % 9) / 3) < ((62 || a1[1][14]) || (a0[7] || 15)));
+            v2 = (((a1[3][10] <= i2) % 2) < ((v1 + v3) - (v0 != v1)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((a0[12] < 89) <= (v3 < v1)) == ((v2 < a0[11]) <= (a0[3] > 16)))) {
+        a0[5] = (((43 >= a0[15]) / 5) * ((a1[1][10] % 5) - (v1 < v2)));
+        v0 = (((v3 || 27) ? (v0 ? v1 : a1[1][14]) : (v1 < 87)) ? ((42 / 4) % 6) : ((a0[11] >= 22) <= (v2 || a0[14])));
+        v0 = (((68 ? v3 : v2) - (a1[0][10] && a0[13])) - ((v0 == v0) >= (3 >= v3)));
+    } else {
+        v2 = (((v1 / 6) + (v1 && v2)) > ((v0 * v2) < (55 ? v0 : 25)));
+        a0[1] = (((v3 ? v1 : 36) && (a1[1][2] || v1)) < ((89 > v0) < (94 ? v1 : a0[15])));
+        v0 = (((a0[6] ? v1 : a0[2]) < (v0 ? v3 : v3)) <= ((v2 / 9) * (a0[14] == a0[14])));
+    }
+    return (((73 / 6) - (v1 % 9)) * ((v2 ? v1 : v1) || (a1[0][7] ? 87 : v2)));
+}
+int f1() {
+    int v0 = 61;
+    int v1 = 71;
+    int v2 = 58;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    a0[8] = (((a1[1][10] + v0) / 6) < ((6 <= v0) >= (88 && a0[10])));
+    if ((((v0 || v2) + (a1[3][14] % 8)) > ((v1 + v2) % 9))) {
+        v1 = (((86 - 64) < (v1 == 12)) || ((v3 == 36) > (v1 ? a1[3][8] : v2)));
+        v0 = (((v2 <= 70) && (v0 >= v3)) && ((5 != v0) + (87 == a0[8])));
+        v1 = (((v0 % 3) == (v2 % 5)) <= ((v1 / 7) * (79 * v0)));
+    } else {
+        a1[0][2] = (((a0[3] + a1[3][0]) && (v1 || a1[1][15])) - ((v1 ? v3 : v1) < (a0[9] && v3)));
+        a0[1] = (((v0 > v2) - (76 % 5)) || ((v3 * v3) / 7));
+        a0[14] = (((v2 == v1) ? (v2 ? v0 : a1[2][6]) : (v1 * a0[6])) && ((v3 || v0) % 8));
+    }
+    v3 = (((a0[10] ? a0[8] : v3) ? (50 ? v0 : a0[10]) : (v3 <= a1[0][8])) < ((v0 > a1[3][1]) < (v0 <= v0)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 + a1[3][7]) >= (v0 / 4)) >= ((a0[13] ? a0[5] : 97) > (39 ? v3 : 90)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v0 - v2) && (a0[0] == v1)) && ((27 > v0) <= (i0 <= a0[9])));
+                    v0 = (((a1[3][15] == i0) == (v2 == v2)) && ((a0[12] < v0) * (36 <= i1)));
+                    v0 = (((v2 < v3) > (v3 - i0)) / 8);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a0[11] = (((i0 - 22) * (v1 < a1[1][5])) > ((v3 >= i0) != (48 != v2)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v0 = (((a1[0][1] || a1[0][4]) != (a1[2][3] % 6)) ? ((a1[3][15] ? v0 : v2) > (i2 + v1)) : ((v1 / 4) + (v2 && i2)));
+            v1 = (((i3 || 0) >= (91 && v3)) && ((i3 >= a1[2][12]) / 3));
+            a0[7] = (((a0[13] >= a1[1][15]) && (v1 || 37)) != ((v3 - i2) ? (v1 > v1) : (a1[1][13] != 50)));
+        }
+        v3 = (((v2 ? a1[0][4] : a0[5]) && (i2 % 9)) + ((v0 * 88) < (a0[6] % 5)));
+        v1 = (((i2 + v1) + (a0[12] <= v3)) == ((v1 && a1[2][7]) ? (v1 + a0[3]) : (i2 <= v0)));
+    }
+    return (((v0 / 8) ? (90 || v2) : (a1[3][12] ? a1[0][2] : 15)) == ((v2 > 30) ? (a1[3][11] < 66) : (v2 + v1)));
+}
+int f2() {
+    int v0 = 94;
+    int v1 = 75;
+    int v2 = 32;
+    int v3 = 98;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        a0[2] = (((44 || v2) < (v2 == v2)) * ((v1 >= v0) * (v2 / 1)));
+        {
+            int i1 = 0;
+            do {
+                if ((i0 >= v0) > 63) break;
+                v0 = (((i0 && v0) >= (v2 ? a0[11] : v1)) || ((a0[6] <= v0) != (v2 != i1)));
+                a0[12] = (((v1 == v3) >= (v0 ? i0 : i1)) % 8);
+                v0 = (((i1 && 94) > (80 != 92)) - ((v1 >= v2) || (v0 ? i1 : 90)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        v1 = (((v1 < a1[2][11]) / 1) || ((16 <= v2) + (a0[8] < 92)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((v1 <= v1) > 63) break;
+        a1[3][11] = (((a0[15] - 90) != (v1 - 42)) * ((a1[0][2] + v0) / 8));
+        a0[11] = (((a1[1][4] != a1[2][6]) <= (a1[3][2] != a0[5])) + ((v3 ? a1[2][11] : v2) ? (v0 != v2) : (i2 - 34)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            v3 = (((a1[3][9] != v3) ? (82 > i2) : (v3 && 78)) == ((a0[7] - v3) ? (i2 ? 24 : 93) : (6 >= v3)));
+            a1[1][15] = (((26 % 6) > (v1 * v2)) && ((a0[3] > a0[5]) <= (a0[9] <= v3)));
+            a0[2] = (((a0[0] >= v3) && (v3 < 5)) * ((74 ? v0 : a0[7]) <= (i3 && 32)));
+        }
+    }
+    a1[3][13] = (((a0[4] * 95) && (a1[2][1] / 1)) * ((v0 % 4) + (a1[2][3] % 8)));
+    if ((((a1[0][14] <= v1) * (v0 ? a0[1] : v2)) || ((37 % 4) >= (65 == v0)))) {
+        a1[3][10] = (((v3 - a0[0]) || (v0 + v1)) * ((v3 ? v3 : 5) - (v3 % 5)));
+        v3 = (((a1[3][0] + v2) ? (v3 >= v0) : (a1[0][0] % 2)) <= ((29 + a0[1]) - (v3 % 8)));
+        v1 = (((a1[3][1] || a0[3]) ? (v2 + a0[12]) : (v2 * 96)) && ((v3 != 32) - (a0[4] <= v0)));
+    } else {
+        a1[1][2] = (((58 || a1[1][11]) && (v1 / 2)) % 7);
+        v0 = (((a0[15] >= 93) ? (31 <= v0) : (v2 * 16)) ? ((85 ? a0[6] : v3) > (v3 % 7)) : ((41 - 60) != (v2 / 6)));
+        a1[0][15] = (((a1[0][14] * a1[0][6]) / 4) - ((v2 + v1) && (a0[6] >= 66)));
+    }
+    v2 = (((v2 ? v0 : a1[0][6]) - (a1[2][2] >= v2)) ? ((v3 * 65) - (a1[0][15] ? 79 : a0[12])) : ((v1 != v1) - (v3 != 88)));
+    return (((81 ? a0[10] : v0) / 6) == ((v2 < a0[7]) ? (38 || a1[3][6]) : (16 >= v0)));
+}
+int main() {
+    return 0;
+}
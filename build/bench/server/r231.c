@@ -0,0 +1,76 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 45;
+    int v2 = 94;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 * a0[12]) % 1) && ((a0[2] && v1) ? (v3 % 3) : (a0[13] >= v1)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((a0[6] - v3) > 80) break;
+                    v3 = (((i1 % 3) > (v3 || v0)) == ((a0[0] - v2) * (19 && a1[1][13])));
+                    a1[0][8] = (((v1 ? 16 : 55) || (v2 != 15)) ? ((a1[2][13] < v0) == (i0 != a1[3][0])) : ((v0 ? v0 : v1) && (v1 % 9)));
+                    v3 = (((v0 >= a1[3][2]) > (v0 || i0)) ? ((62 / 3) || (54 * 5)) : ((v2 > a1[3][9]) >= (13 || v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][10] = (((v0 < 52) < (85 >= i0)) > ((90 != 38) < (68 >= v2)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((57 / 9) > 57) break;
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((a1[3][1] >= i3) > 67) break;
+                v3 = (((29 && v0) >= (i3 == 69)) || ((68 && a1[1][2]) || (i2 ? a0[4] : v2)));
+                v2 = (((v2 || i2) * (i2 ? 72 : v2)) * ((i3 + i2) == (18 - v3)));
+                v3 = (((v0 ? v1 : 46) != (v3 + v2)) ? ((78 != v1) * (56 || v2)) : ((22 ? a1[3][6] : a0[0]) % 8));
+                i3 = i3 + 1;
+            }
+        }
+        a1[2][15] = (((28 ? a0[15] : a1[0][13]) > (i2 || i2)) * ((12 >= v3) + (59 < v2)));
+        v2 = (((a1[2][12] * v1) < (a0[4] >= v1)) < ((75 && v1) / 5));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v3 = (((22 % 9) >= (i5 % 4)) != ((73 * v2) + (v2 % 3)));
+                v1 = (((49 > 1) - (39 - 82)) || ((v2 != v1) && (a0[0] <= i5)));
+                v0 = (((v2 / 8) == (86 + 77)) || ((80 % 1) - (a1[0][6] == a0[1])));
+            }
+            v2 = (((i4 != 60) * (v3 < v3)) / 1);
+            a0[3] = (((v0 != a1[3][13]) > (a1[1][15] ? 64 : v1)) - ((a1[2][0] / 7) < (v3 ? a0[10] : 95)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[8] % 3) / 8) > ((v0 || a0[8]) - (a0[15] || 49)))) {
+        v0 = (((65 - v3) && (v0 >= v3)) / 9);
+        a0[3] = (((v1 ? a0[4] : v3) ? (v3 ? v3 : v0) : (a0[3] / 1)) > ((v1 / 3) || (v2 == v2)));
+        v2 = (((a0[7] <= v2) || (a0[5] - 58)) != ((64 ? v1 : a1[2][1]) / 2));
+    } else {
+        a1[3][7] = (((v3 <= 35) != (v0 <= a0[6])) % 4);
+        a0[14] = (((v3 == v1) * (v0 ? 21 : a1[2][1])) ? ((v1 > 11) <= (a1[0][3] ? a1[1][0] : a0[6])) : ((v2 >= v0) + (58 / 2)));
+        v1 = (((a1[2][4] ? 39 : v3) % 7) >= ((a0[8] + a1[1][2]) <= (a0[4] == v3)));
+    }
+    if ((((v2 * v3) > (83 * v3)) % 4)) {
+        v3 = (((29 ? v0 : 75) % 2) >= ((17 / 9) / 7));
+        v1 = (((75 / 5) >= (v2 < v0)) - ((v0 == v2) > (a0[14] > v1)));
+        v0 = (((a1[0][12] * a0[11]) - (86 ? 57 : 33)) < ((v1 == 38) >= (v3 != v2)));
+    } else {
+        a0[4] = (((41 || v2) <= (47 || v0)) * ((a1[0][0] / 5) > (64 == 71)));
+        v3 = (((v3 > v2) ? (16 + 39) : (22 || v1)) < ((v1 * a0[8]) - (37 + 3)));
+        v1 = (((v2 ? a0[15] : 75) / 3) > ((24 / 7) == (0 - a0[6])));
+    }
+    return (((25 || v0) / 5) != ((6 > v2) * (v3 - v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,111 @@
+int f0() {
+    int v0 = 31;
+    int v1 = 27;
+    int v2 = 21;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                if ((v2 - v2) > 65) break;
+                v1 = (((v2 < 17) >= (44 / 6)) || ((43 + v0) ? (v1 != a0[10]) : (a0[15] / 1)));
+                v1 = (((v1 <= v0) != (v0 <= v3)) + ((86 > i1) ? (96 + 58) : (47 % 2)));
+                v2 = (((94 <= a1[1][3]) / 8) / 4);
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        v0 = (((71 % 1) + (v3 != v2)) && ((0 >= a1[0][12]) < (v1 + v3)));
+        v1 = (((v3 ? 90 : i0) * (v0 != v1)) * ((a1[0][6] + v1) < (a0[5] || i0)));
+    }
+    v2 = (((70 > v1) > (a0[2] < 89)) / 8);
+    a1[3][8] = (((v3 && v0) ? (a0[5] ? a1[2][6] : v0) : (67 != v0)) * ((v1 >= v2) != (44 >= v0)));
+    if ((((v2 && 51) >= (18 >= 14)) || ((v1 == a1[0][4]) > (a0[4] - 98)))) {
+        a1[3][6] = (((23 <= v0) == (v0 % 2)) > ((27 < v1) >= (26 < v0)));
+        v1 = (((7 == v0) != (2 > 53)) == ((v3 && a0[4]) ? (v3 || 7) : (27 ? v0 : v2)));
+        v2 = (((v0 / 2) * (v0 != v1)) >= ((a1[0][11] - a0[9]) * (21 == v3)));
+    } else {
+        v1 = (((v0 ? v1 : a1[2][10]) > (v2 * v0)) ? ((v3 >= a0[11]) - (84 ? v1 : 52)) : ((77 ? 63 : v1) ? (a1[2][15] % 1) : (a1[2][13] || v3)));
+        a1[1][10] = (((a1[2][13] || v0) * (a0[5] % 2)) >= ((7 * v3) || (v3 < a1[3][3])));
+        a1[3][14] = (((53 + v0) + (v0 != v3)) != ((v2 ? v0 : v0) <= (a1[1][11] <= v3)));
+    }
+    v3 = (((v3 && v1) - (v3 - 82)) || ((v0 < a1[0][7]) ? (v2 + v0) : (1 % 1)));
+    return (((a0[3] ? a1[1][4] : v3) * (65 >= v1)) || ((73 % 5) % 2));
+}
+int f1() {
+    int v0 = 41;
+    int v1 = 34;
+    int v2 = 28;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((v0 * v3) > 80) break;
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v3 = (((18 <= v3) < (a1[3][9] || 14)) && ((8 > a0[2]) >= (48 % 8)));
+                    v2 = (((a0[4] != a1[3][4]) - (83 + a0[10])) && ((35 < 93) <= (78 != v2)));
+                    a0[3] = (((v1 && a1[1][8]) != (35 == v1)) == ((v1 || i0) == (a1[1][4] * 27)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][12] = (((a0[5] ? v1 : v3) * (v1 % 4)) || ((1 == v1) - (a1[2][5] ? 24 : a0[4])));
+            v1 = (((a0[0] * a1[2][15]) * (a1[1][12] > v1)) ? ((v1 * v2) * (a0[5] && a0[4])) : ((3 ? a0[10] : v2) * (v3 < a1[1][15])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((43 == v3) >= (v1 - a1[0][9])) * ((v3 % 6) <= (53 < v1)));
+            v0 = (((v3 || v1) / 8) && ((v3 > v2) ? (a1[0][7] == a1[2][6]) : (v1 && 62)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((a0[9] * 99) > 75) break;
+                    v2 = (((v1 && i2) || (v1 * 88)) == ((i3 - v1) && (v0 * 61)));
+                    v0 = (((i2 != a1[1][13]) > (v1 >= v0)) % 5);
+                    v1 = (((v2 <= i3) < (1 / 2)) >= ((97 && 17) * (v1 != a1[3][9])));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((a0[8] < v3) < (a0[8] < v2)) % 2)) {
+        v2 = (((53 * v0) ? (a0[5] <= v2) : (v2 - v1)) + ((a1[0][3] || 84) - (a0[13] ? v1 : a0[3])));
+        v0 = (((v3 > v0) <= (v2 || v1)) && ((a1[3][5] % 1) * (24 || v2)));
+        v1 = (((27 <= v0) <= (83 != 73)) != ((a0[15] <= v1) ? (v3 != 84) : (v1 >= 65)));
+    } else {
+        v0 = (((v2 - 99) > (a1[0][8] == 21)) + ((v3 || v3) - (v1 * 14)));
+        v1 = (((37 - v0) % 1) - ((v2 && v2) > (v1 + a0[1])));
+        v3 = (((90 ? a1[3][12] : 50) / 7) == ((91 < v2) <= (v3 * v2)));
+    }
+    a0[13] = (((a0[14] % 4) || (61 || v0)) - ((v1 < a0[0]) - (57 + v0)));
+    {
+        int i4 = 0;
+        do {
+            if ((2 * 8) > 81) break;
+            v2 = (((v0 % 9) ? (49 ? 77 : 28) : (6 - v0)) % 3);
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((a1[3][5] <= 66) == (v1 == v3)) != ((v2 / 8) == (a1[3][0] != v3)));
+                    v3 = (((v1 && 83) / 7) ? ((58 == i5) ? (a0[0] < a0[2]) : (a0[8] * i4)) : ((v0 / 2) <= (a1[3][9] > 76)));
+                    a0[3] = (((14 % 7) ? (v3 + v2) : (a1[1][3] * a1[2][9])) - ((v3 <= v1) && (20 < i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a1[2][0] = (((v2 == i4) >= (v2 + 99)) % 6);
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    return (((a1[2][5] != a1[3][6]) + (40 < v3)) * ((v3 > 58) < (a1[2][0] != v2)));
+}
+int main() {
+    return 0;
+}
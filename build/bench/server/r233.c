@@ -0,0 +1,156 @@
+int f0() {
+    int v0 = 20;
+    int v1 = 91;
+    int v2 = 88;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    a1[3][13] = (((v0 / 6) <= (v0 == 17)) != ((v0 >= v0) - (a1[3][15] / 3)));
+    v3 = (((4 > a1[2][7]) / 7) >= ((97 - v2) < (a1[0][10] < v1)));
+    a0[9] = (((v2 != v0) - (23 < a0[5])) ? ((v1 + v1) == (a1[1][0] ? a0[0] : v2)) : ((63 ? v2 : v0) <= (v2 * v2)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                v2 = (((14 || v0) || (i0 - a0[9])) <= ((82 >= 79) <= (v1 + v3)));
+                v2 = (((v0 / 1) % 8) * ((v2 && a0[5]) % 3));
+                v2 = (((v2 && i1) / 6) || ((v0 != a0[5]) + (v2 >= v3)));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((16 != v0) * (a0[15] % 5)) > ((a1[2][0] == a0[8]) - (a0[1] > i0)));
+        v3 = (((14 + a0[10]) == (v2 - 57)) ? ((36 + 88) || (v0 != v2)) : ((v0 % 2) < (v2 / 5)));
+    }
+    v2 = (((v2 + v3) == (v3 ? a0[12] : v1)) && ((v0 * v0) <= (14 <= 62)));
+    return (((10 >= a1[2][8]) >= (v3 ? v0 : v1)) == ((v2 >= v1) % 2));
+}
+int f1() {
+    int v0 = 51;
+    int v1 = 32;
+    int v2 = 7;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 <= 93) || (59 < v3)) * ((v0 < v0) > (11 < a0[13])));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v3 <= v1) ? (a1[3][13] != i0) : (v1 != 47)) * ((v0 && v0) != (v1 <= v3)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v1 = (((v1 ? v3 : a1[3][2]) && (v0 < a1[1][10])) % 4);
+                    v2 = (((v2 % 3) > (a0[12] == i1)) * ((a1[0][7] * 14) || (54 % 7)));
+                    v1 = (((v0 >= v2) <= (i1 > v3)) == ((97 || v1) + (a1[0][7] * v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((67 != v1) - (a1[2][8] > v3)) - ((v0 - 35) || (a0[12] ? a0[9] : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v1 = (((v3 || v1) > (v3 <= a0[2])) >= ((v3 != v3) >= (a1[2][2] > 8)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v1 || 9) > 71) break;
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                v3 = (((i2 >= 75) + (i2 != 59)) % 2);
+                a1[1][12] = (((a0[6] * a1[0][12]) <= (59 && i3)) + ((a1[1][0] >= a1[0][13]) ? (27 / 9) : (82 < v2)));
+                v0 = (((i2 == 59) % 9) / 6);
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((68 == 50) == (v0 && i2)) - ((v1 < i2) / 4));
+        a0[7] = (((v1 % 3) == (v1 == 2)) ? ((i2 - 27) <= (v3 / 1)) : ((3 > 5) - (a0[5] % 1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((a1[1][3] || 52) != (v1 - a0[15])) ? ((v1 || 91) - (a0[13] > v3)) : ((53 && 68) % 9));
+            {
+                int i5 = 0;
+                do {
+                    if ((a0[6] > a1[1][10]) > 98) break;
+                    v1 = (((a0[3] || i5) ? (v3 ? i5 : i5) : (v2 == v2)) <= ((15 ? v3 : 70) / 9));
+                    v2 = (((94 ? a0[11] : i4) % 9) > ((15 + a1[3][12]) != (a1[3][4] % 1)));
+                    a1[2][12] = (((v1 == v2) >= (84 >= v2)) > ((a1[1][13] ? a1[3][6] : 50) == (v2 ? v2 : a1[2][11])));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v3 = (((v3 % 1) + (32 <= a0[10])) - ((v1 >= i4) - (i4 != v3)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v2 / 7) >= (a0[9] != v3)) > ((v0 - v1) * (v0 > 42)));
+}
+int f2() {
+    int v0 = 83;
+    int v1 = 72;
+    int v2 = 51;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 || v2) > 97) break;
+            v0 = (((v2 < v3) / 5) * ((v1 ? a0[1] : 4) % 4));
+            {
+                int i1 = 0;
+                do {
+                    a1[0][4] = (((1 < a1[2][11]) == (27 == a0[12])) <= ((v3 - 93) < (i1 != v2)));
+                    a1[3][12] = (((54 * v0) > (v0 - v2)) > ((a1[1][13] / 9) ? (v2 <= i0) : (i1 <= i1)));
+                    a1[2][1] = (((v3 == a1[1][15]) * (v3 * a0[9])) * ((i0 && 91) ? (i0 != i0) : (i1 % 3)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v1 = (((v0 / 3) && (a1[2][11] && i0)) != ((v1 ? 27 : v1) <= (a0[0] / 3)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((v2 ? v3 : v1) != (v0 && 83)) || ((v2 <= i2) == (v3 == 86)));
+        v3 = (((v3 - i2) > (18 / 5)) == ((a0[7] < i2) ? (a0[13] % 3) : (i2 && v0)));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((a0[8] - v0) != (a0[15] >= i3)) ? ((a0[15] <= a0[2]) + (a0[1] + a1[1][0])) : ((v3 == a1[1][8]) - (a1[0][0] == 53)));
+                v2 = (((71 || 40) || (v0 ? 59 : a1[2][3])) ? ((89 <= i2) ? (55 <= 80) : (a1[0][8] > v0)) : ((a1[3][15] ? a0[15] : v2) != (a0[4] >= v3)));
+                v0 = (((v3 <= a1[1][6]) / 9) / 9);
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    if ((((a1[2][5] == v1) % 3) * ((v0 == a0[13]) != (19 * a0[0])))) {
+        v2 = (((v0 <= a1[0][9]) < (v3 ? 33 : a0[15])) * ((v3 <= v0) >= (v1 - v1)));
+        v3 = (((a0[3] ? 30 : v1) >= (v0 == v0)) >= ((a1[0][14] >= a1[0][0]) != (81 <= v0)));
+        v1 = (((a1[1][0] / 7) * (v1 > v2)) * ((a1[0][11] >= v3) < (v1 - v2)));
+    } else {
+        v2 = (((v3 > v2) > (v2 <= v1)) * ((v1 > v1) * (v0 % 4)));
+        v1 = (((a1[1][11] * v0) >= (a0[11] <= 52)) && ((v3 / 3) == (v0 < a0[8])));
+        a0[1] = (((v2 >= a0[11]) || (v3 + v1)) > ((v3 && v0) || (v3 > v0)));
+    }
+    v1 = (((a0[7] * a1[2][4]) < (20 < a1[2][11])) + ((v0 || 43) ? (v3 ? v3 : a0[1]) : (a0[1] <= a0[5])));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((v1 % 6) % 7) != ((v3 * a1[1][1]) * (a0[11] || a1[3][8])));
+                    v0 = (((v0 || a1[1][3]) >= (26 ? v2 : 59)) <= ((49 + a1[0][6]) ? (2 == 65) : (i5 ? v3 : 52)));
+                    a0[9] = (((v3 > i4) % 9) - ((v0 || v0) != (91 > 94)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v0 = (((a0[10] || v2) - (30 <= v3)) % 5);
+            a0[10] = (((v1 ? v1 : a0[1]) + (13 != v0)) && ((i4 - a1[0][13]) || (87 ? v0 : v0)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v2 < 10) && (v1 > v1)) != ((v2 / 2) >= (28 > 59)));
+}
+int main() {
+    return 0;
+}
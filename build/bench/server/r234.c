@@ -0,0 +1,77 @@
+int f0() {
+    int v0 = 64;
+    int v1 = 66;
+    int v2 = 81;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        if ((a1[0][11] >= i0) > 76) break;
+        a0[0] = (((a1[3][15] < v2) / 7) + ((v0 ? 35 : v3) % 1));
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            if ((6 && i0) > 72) break;
+            v0 = (((v2 * i0) <= (i0 >= a1[1][14])) != ((i1 == v1) > (v2 % 1)));
+            a1[1][2] = (((10 == i0) >= (a0[13] ? v1 : 37)) <= ((i0 != v2) % 6));
+            v0 = (((i0 / 7) ? (v1 == v2) : (v0 % 7)) - ((75 && 7) >= (i0 ? 73 : a0[14])));
+        }
+        a0[7] = (((52 ? a0[7] : 93) || (a1[1][15] != 77)) <= ((v1 >= i0) <= (a0[2] == v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[1][2] % 5) > 93) break;
+                    v3 = (((i2 < v0) ? (33 <= v3) : (25 % 2)) % 7);
+                    v0 = (((v0 ? 60 : i3) + (a0[8] ? v0 : a0[11])) / 6);
+                    v0 = (((i2 ? v3 : i3) + (i3 % 1)) + ((56 % 7) % 3));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a1[2][6] = (((a1[2][13] / 4) ? (v3 + 18) : (v2 >= v2)) % 8);
+            a0[10] = (((v0 || v2) ? (a1[3][3] != v2) : (v0 && v3)) >= ((a1[1][9] + a0[8]) ? (i2 % 9) : (a1[0][9] % 6)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[0][4] = (((a0[5] % 9) < (32 % 7)) + ((i4 / 1) + (v2 != v2)));
+            {
+                int i5 = 0;
+                do {
+                    if ((67 != 83) > 96) break;
+                    v0 = (((v0 % 5) * (v0 ? i5 : a1[0][7])) >= ((67 * a1[3][6]) * (29 - i5)));
+                    v0 = (((a0[8] - i5) % 7) == ((i4 - a0[8]) || (v0 && 93)));
+                    a0[1] = (((48 != a0[15]) % 1) && ((i4 == i4) > (27 <= 81)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            a0[3] = (((v1 >= v1) / 8) <= ((v2 ? i4 : i4) * (a1[0][8] && a1[2][9])));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    if ((((a0[7] ? 94 : 95) == (v0 <= 84)) <= ((v3 ? v2 : v1) + (v0 ? v1 : a0[10])))) {
+        v2 = (((v1 >= v0) && (a1[3][13] - v0)) && ((97 && v3) >= (a1[2][4] < v2)));
+        a1[1][15] = (((3 < 32) ? (a1[1][8] ? 37 : a0[10]) : (39 && v2)) == ((v3 != v2) || (v2 && a0[3])));
+        a0[13] = (((v3 * v2) ? (v2 / 9) : (20 / 6)) > ((94 == v0) ? (56 + a0[15]) : (v3 != 38)));
+    } else {
+        a0[4] = (((87 % 2) * (v1 || v3)) && ((v1 || v2) ? (42 - a1[1][7]) : (v0 - a1[3][8])));
+        v3 = (((v2 > a1[2][12]) && (30 - a1[2][10])) && ((94 % 7) >= (a1[1][13] < v0)));
+        a1[1][14] = (((10 || v3) % 1) != ((a0[10] == 10) % 8));
+    }
+    if ((((v2 ? 40 : v1) != (20 - 46)) == ((a0[13] && v0) == (v3 % 9)))) {
+        a0[4] = (((a1[3][7] == 86) ? (v0 / 8) : (v0 % 9)) + ((92 != v0) <= (86 ? 18 : a1[0][11])));
+        v1 = (((v2 < a0[12]) + (v3 == v2)) != ((v2 * 73) - (v0 / 5)));
+        v0 = (((a0[8] >= v0) && (v2 - a1[0][1])) < ((86 != 9) + (v0 && 93)));
+    } else {
+        v2 = (((v1 >= v1) < (v2 < 9)) && ((a1[1][9] > v0) > (48 ? a0[14] : a0[10])));
+        v3 = (((v0 != v2) != (a1[0][4] + v2)) > ((a0[7] * 15) && (v3 ? v3 : v2)));
+        a1[2][2] = (((v0 + 47) ? (v3 / 4) : (81 ? a1[0][15] : 94)) / 5);
+    }
+    return (((34 || 36) || (v1 == 50)) ? ((19 % 2) && (v0 && 45)) : ((v3 - a0[9]) * (a0[11] > v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,142 @@
+int f0() {
+    int v0 = 5;
+    int v1 = 86;
+    int v2 = 10;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v0 - v3) > (v2 >= v2)) + ((a0[9] * 94) * (a1[0][9] != i0)));
+            v1 = (((46 ? 52 : v0) || (a1[1][2] / 8)) < ((a1[0][10] >= 64) != (v1 && a0[13])));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((v0 % 3) > 57) break;
+                    v3 = (((v2 / 2) || (a0[5] == i1)) * ((99 > v0) ? (22 != i0) : (a1[2][6] - v1)));
+                    v0 = (((a1[2][9] || 6) / 7) > ((34 + i0) > (i0 || 72)));
+                    v0 = (((i1 == i1) / 5) < ((v1 >= v2) == (89 || a1[0][12])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a0[7] || 91) > 77) break;
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                a0[7] = (((v1 / 5) ? (a1[0][11] / 5) : (a0[5] % 1)) * ((v0 * v1) >= (v0 > v0)));
+                v2 = (((v3 >= 6) == (v1 ? v3 : i2)) > ((a0[1] - v2) != (a0[13] && i3)));
+                a1[1][3] = (((94 / 7) - (v0 > 73)) > ((a1[1][8] && v0) - (a0[1] % 6)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((a1[2][5] ? a0[14] : v1) * (v3 || v2)) <= ((v3 % 5) && (90 == v2)));
+        v0 = (((25 <= a0[6]) ? (81 < v0) : (16 == 10)) ? ((v2 <= a1[0][6]) * (v0 != v1)) : ((a0[0] - a1[1][9]) + (a1[2][6] != a0[9])));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v1 = (((a0[15] - a0[1]) % 5) * ((v0 <= 95) ? (67 / 7) : (24 / 2)));
+        v0 = (((a0[2] > v3) * (i4 + v1)) < ((v0 + 60) ? (v1 < 59) : (v0 / 5)));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v0 = (((v3 / 6) < (9 == a0[3])) && ((a1[1][1] / 9) ? (v0 ? i4 : v1) : (i4 + v2)));
+            a0[15] = (((i5 == i4) ? (97 && v2) : (79 >= 67)) || ((v0 || 9) - (v0 ? v3 : 92)));
+            v1 = (((a0[8] + 98) || (i5 <= v3)) / 2);
+        }
+    }
+    a1[2][3] = (((a0[11] && v0) / 8) > ((a0[7] <= v1) >= (v3 || a1[3][10])));
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            if ((36 <= a0[14]) > 60) break;
+            v0 = (((v0 > v3) || (76 > 80)) && ((50 * a1[0][9]) * (v1 && 68)));
+            v0 = (((a1[1][6] + v0) != (v0 * 13)) % 9);
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v3 = (((a1[0][15] + 81) ? (3 * a0[14]) : (v2 ? 91 : a0[5])) || ((v0 && i7) - (92 % 3)));
+                v2 = (((i6 + v0) >= (a0[3] == 71)) != ((69 ? a1[1][10] : v3) * (a1[0][5] != v3)));
+                a0[8] = (((v3 ? 41 : v1) * (i6 >= 53)) || ((57 ? v1 : 27) == (85 >= 35)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((a0[7] && v2) * (v2 != 26)) <= ((v1 % 1) && (v1 <= a1[1][10])));
+}
+int f1() {
+    int v0 = 37;
+    int v1 = 95;
+    int v2 = 94;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 < v2) > 83) break;
+            v2 = (((i0 - v2) * (86 ? i0 : v1)) / 3);
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[5] = (((i1 ? 12 : a1[1][2]) >= (92 * 35)) <= ((i0 ? v2 : v2) > (v2 == i0)));
+                v2 = (((v0 * 7) && (v2 > a0[8])) ? ((a0[8] - v1) * (a0[14] - i0)) : ((7 == 10) == (v2 == v0)));
+                v2 = (((3 <= a1[1][10]) != (45 <= 60)) <= ((30 ? v3 : v1) || (a1[3][8] - v3)));
+            }
+            v3 = (((v3 == 16) || (58 % 7)) % 7);
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((83 ? v3 : a1[3][2]) > 69) break;
+            {
+                int i3 = 0;
+                do {
+                    if ((v1 && a1[0][10]) > 71) break;
+                    a1[3][0] = (((a0[13] == i2) ? (a0[7] != 32) : (a0[10] == a1[2][13])) % 5);
+                    v3 = (((v0 == 49) * (v2 - 74)) <= ((v0 == v3) <= (84 / 1)));
+                    v3 = (((a0[11] - a0[7]) - (a0[2] >= v0)) > ((v3 - 56) <= (v1 >= 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v1 = (((83 && v1) >= (v1 < 42)) ? ((62 >= 80) - (v3 - i2)) : ((v1 ? a0[4] : i2) <= (a1[2][9] == v0)));
+            a1[1][12] = (((54 == v1) % 2) < ((v0 <= 2) * (a1[3][7] / 1)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((a0[14] || 69) * (31 != a1[0][10])) ? ((3 > 46) != (v0 != v0)) : ((a0[0] - i5) % 3));
+                    a1[0][0] = (((33 <= a1[1][8]) - (v0 || v1)) >= ((a1[1][6] >= v2) || (a1[2][5] % 9)));
+                    v2 = (((a0[5] - i4) == (v0 || v0)) == ((v0 * v0) <= (a0[5] >= 79)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            a0[14] = (((v0 + v3) ? (29 || 55) : (v3 && i4)) < ((a0[14] + v0) / 8));
+            v3 = (((42 || 67) + (v3 ? a0[8] : a0[12])) / 7);
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((a0[3] > v0) && (v0 ? v3 : a0[12])) <= ((v0 >= v0) == (11 < v2)));
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        v2 = (((33 / 4) ? (a1[0][3] && i6) : (v0 - v0)) != ((v3 < v0) <= (v3 ? v1 : 71)));
+        {
+            int i7 = 0;
+            while (i7 < 6) {
+                if ((65 + i6) > 99) break;
+                v2 = (((i7 <= a1[1][7]) >= (i7 == v3)) == ((25 > 15) / 9));
+                v3 = (((v1 >= 70) == (34 / 2)) > ((v0 - i6) > (79 * v2)));
+                v0 = (((v0 > v1) <= (a1[3][13] ? v2 : a1[1][15])) ? ((a1[1][12] == i7) >= (v0 == a0[12])) : ((v3 % 9) * (a0[10] && a0[14])));
+                i7 = i7 + 1;
+            }
+        }
+        v0 = (((a1[0][13] >= a0[7]) % 6) >= ((v3 * v3) >= (69 || 50)));
+    }
+    return (((a1[3][12] && v1) / 4) == ((v3 ? 63 : a0[14]) <= (v2 >= 27)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,177 @@
+int f0() {
+    int v0 = 87;
+    int v1 = 96;
+    int v2 = 74;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((67 < a1[0][14]) > 96) break;
+        {
+            int i1 = 0;
+            do {
+                v1 = (((39 - a1[0][10]) == (v3 || i1)) % 2);
+                v1 = (((i1 <= a1[2][15]) * (97 ? 43 : a1[3][3])) ? ((v0 + 25) <= (v3 ? 84 : 7)) : ((v2 * v2) ? (84 != v1) : (v1 >= 62)));
+                a0[13] = (((a0[10] / 3) < (i0 < 44)) || ((v0 + 48) * (90 || a0[4])));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v2 = (((a0[14] >= v1) * (v0 == a1[3][2])) ? ((v2 < 21) && (a1[0][8] % 7)) : ((a1[2][0] >= v3) % 3));
+        v0 = (((a1[1][5] + i0) < (v0 + a0[2])) || ((46 || v0) - (v2 <= v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v0 = (((35 && 77) ? (v1 - a1[1][14]) : (v1 > v2)) ? ((v0 != v3) || (v0 && a0[13])) : ((10 % 1) == (v3 - a0[12])));
+            {
+                int i3 = 0;
+                do {
+                    if ((v2 < i3) > 85) break;
+                    v1 = (((a1[0][13] != v2) / 1) * ((32 - v2) == (v1 || v3)));
+                    a0[7] = (((v2 == a0[7]) ? (24 != i3) : (v1 + v0)) < ((0 <= a1[1][9]) % 6));
+                    v0 = (((v1 || v0) != (v3 % 2)) > ((a0[1] + v1) && (65 != i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v0 = (((a0[6] && a0[2]) == (a1[0][15] && a0[1])) >= ((a0[1] % 3) >= (13 ? v2 : v1)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v2 < v1) - (v2 > v2)) < ((v2 + v1) / 5))) {
+        v0 = (((v2 >= v2) ? (v1 ? 70 : v2) : (v0 != v2)) && ((87 + v1) != (v3 >= v0)));
+        v1 = (((v1 < v0) + (v3 - 11)) || ((a0[10] <= v0) ? (86 % 1) : (a0[2] <= v2)));
+        a1[0][12] = (((a1[2][10] * a1[0][3]) >= (86 - 21)) >= ((v3 >= v3) * (v0 / 3)));
+    } else {
+        a1[3][1] = (((a1[3][12] >= 76) == (v0 + 40)) ? ((v2 && v1) ? (a1[3][14] == v3) : (v1 && v0)) : ((v0 / 9) * (47 / 3)));
+        a0[15] = (((94 + v0) >= (a1[0][4] || 4)) || ((v2 && 86) ? (a1[1][15] == a0[10]) : (v0 % 7)));
+        a1[0][10] = (((v1 || a1[0][11]) / 7) ? ((a0[5] < v1) <= (a0[0] && 88)) : ((a0[13] - v2) * (8 / 4)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v2 = (((a0[5] ? 42 : v0) * (v2 ? a0[11] : v3)) % 6);
+            v1 = (((v2 == a1[2][7]) % 7) > ((a0[6] >= v1) == (i4 && 86)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v3 = (((i5 ? 0 : v0) % 4) > ((v2 ? a1[1][4] : i5) == (16 * a1[0][3])));
+                    v3 = (((v0 < v3) / 3) <= ((48 != a0[4]) * (i4 % 7)));
+                    v1 = (((v2 / 4) <= (18 == a1[2][1])) ? ((i5 < 0) && (v3 / 7)) : ((v0 <= a0[12]) - (20 * a0[4])));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a1[1][4] - a0[15]) + (v0 / 6)) ? ((v0 != v2) > (v3 - v3)) : ((v1 != v0) <= (47 * a1[0][10])))) {
+        v2 = (((a1[2][1] + 97) / 4) % 1);
+        v3 = (((a1[3][2] && v2) < (2 == 83)) > ((v0 / 4) < (56 / 1)));
+        v3 = (((a0[1] < 43) ? (6 > 30) : (v2 ? v0 : a0[13])) ? ((18 == 53) || (v2 && 35)) : ((v0 && 4) == (v1 ? v0 : v1)));
+    } else {
+        v3 = (((v2 > a1[0][1]) >= (a0[9] == v2)) == ((a1[3][1] >= a0[4]) >= (a1[2][3] == 92)));
+        v1 = (((a0[9] + v2) >= (v0 % 3)) >= ((v1 - v1) && (v2 ? 39 : v1)));
+        v3 = (((94 <= v3) % 5) * ((v3 || v0) > (a1[3][1] != v0)));
+    }
+    return (((v3 > 88) != (a1[1][5] != 72)) == ((v0 > a0[11]) == (v2 >= v0)));
+}
+int f1() {
+    int v0 = 67;
+    int v1 = 82;
+    int v2 = 96;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    a0[1] = (((v3 - v3) % 3) - ((v2 ? 45 : v1) + (22 == 29)));
+    if ((((v2 + a1[3][15]) != (4 ? a1[1][9] : v2)) <= ((v0 < 5) != (v0 % 3)))) {
+        v2 = (((v1 ? a1[2][6] : v3) % 5) || ((v3 != v3) != (v2 ? v0 : v1)));
+        v3 = (((v2 != v1) >= (28 == v3)) > ((v3 * v1) ? (v3 == v2) : (a0[12] >= 66)));
+        a0[14] = (((v0 * v2) > (14 < v0)) && ((v3 >= a0[8]) - (v0 / 9)));
+    } else {
+        a0[1] = (((a1[0][2] ? a1[0][7] : v3) % 7) != ((a1[2][6] - 3) == (v2 % 8)));
+        a1[1][7] = (((a0[8] > v1) / 8) < ((37 == 97) > (a0[6] / 9)));
+        a1[3][5] = (((v2 ? a0[3] : v3) * (v1 != 88)) >= ((a0[10] != v2) || (v1 + 90)));
+    }
+    a1[0][2] = (((a1[3][13] || a1[0][14]) < (16 < v2)) < ((v2 < a0[13]) > (v2 || v0)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((a1[3][7] && 84) < (87 < 60)) > ((v2 != v3) + (v0 % 7)));
+            a1[3][8] = (((v1 / 4) ? (v0 + v1) : (i0 >= v0)) >= ((v3 && i0) > (49 < 57)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((i0 % 1) < (v0 / 6)) * ((v3 >= v2) || (v0 == i0)));
+                    v3 = (((a1[3][11] <= 44) ? (i1 / 1) : (i1 > 94)) % 4);
+                    v0 = (((i0 < i0) < (v0 != v1)) / 9);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v2 = (((v0 - a1[3][6]) <= (v1 > v1)) || ((a1[0][3] > v2) != (19 % 9)));
+    return (((a0[14] ? a0[11] : a1[2][2]) * (v1 ? 17 : v2)) > ((v3 <= 99) >= (v0 > a1[2][13])));
+}
+int f2() {
+    int v0 = 60;
+    int v1 = 67;
+    int v2 = 40;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    a0[15] = (((v3 ? v2 : v1) && (a1[0][10] && 57)) / 1);
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v3 = (((a1[3][6] >= a1[1][12]) >= (v3 ? 69 : a1[2][2])) == ((a1[2][4] * 33) <= (v1 + i0)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((v0 <= v3) > 52) break;
+                    a0[12] = (((v2 > a1[1][12]) && (v1 || 86)) == ((52 < a0[13]) < (i0 >= a1[2][5])));
+                    v0 = (((a1[0][4] == v0) - (5 + a1[1][0])) % 4);
+                    v3 = (((88 - 84) || (72 <= 18)) <= ((v2 - i0) - (51 % 8)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((32 <= v3) * (i0 - 37)) > ((29 > v3) != (v0 && v0)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                if ((v0 > a0[11]) > 59) break;
+                a1[1][7] = (((v3 % 8) ? (17 % 9) : (i2 % 5)) || ((v2 >= v3) || (66 - 79)));
+                a0[6] = (((65 || 63) - (i3 || 37)) <= ((v2 <= v2) <= (v3 ? i2 : a0[2])));
+                a1[3][1] = (((i2 <= a0[4]) <= (v3 * v3)) >= ((v1 > i3) ? (i2 && a1[3][4]) : (v3 ? i3 : 74)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v1 = (((59 == v2) * (1 % 2)) ? ((i2 ? v2 : i2) + (a1[0][10] > v0)) : ((v3 <= v2) || (v2 != v1)));
+        v0 = (((v0 - v3) * (a1[3][13] % 6)) > ((v1 == v3) && (i2 / 5)));
+    }
+    if ((((53 - v0) || (v3 <= v0)) <= ((v1 * a1[1][3]) != (v2 <= v3)))) {
+        v0 = (((95 < a1[3][12]) <= (52 < 38)) != ((v2 != a0[12]) >= (21 == v0)));
+        a1[2][9] = (((59 && v2) <= (76 < v3)) <= ((v1 / 4) == (a1[1][7] < 3)));
+        v0 = (((a0[15] ? 45 : v3) * (a0[11] < a0[4])) != ((10 != 68) == (v1 != 50)));
+    } else {
+        v0 = (((a1[2][7] != v0) - (a1[3][2] ? v3 : v3)) > ((v0 == a0[9]) * (v3 || 68)));
+        a0[10] = (((a0[4] >= v3) ? (v1 ? v1 : v0) : (a1[3][1] ? v3 : v0)) - ((v2 && v2) ? (a1[0][4] || v0) : (v3 || v2)));
+        v0 = (((v2 * v3) + (v3 != 80)) ? ((a0[2] > v0) != (v0 ? a1[3][9] : v1)) : ((v3 * 33) / 6));
+    }
+    if ((((v1 <= v3) > (v3 && v0)) || ((v3 || a0[9]) >= (v2 || 71)))) {
+        a0[4] = (((12 > 18) && (v0 > v3)) ? ((37 ? v1 : v3) % 3) : ((v3 * v2) && (v2 ? 93 : v2)));
+        v3 = (((80 ? 26 : a1[2][10]) >= (v1 / 8)) && ((v1 - v2) * (44 + v1)));
+        v3 = (((a1[1][7] && v0) && (v3 != 8)) / 7);
+    } else {
+        a0[12] = (((v3 / 9) * (v3 + a1[0][10])) || ((v1 == v0) % 8));
+        v3 = (((v3 >= 64) == (v0 - a0[0])) <= ((34 + v2) <= (v3 > 13)));
+        a0[3] = (((a0[2] ? v3 : v0) ? (v0 < a1[3][15]) : (a0[5] ? 72 : a1[1][11])) % 5);
+    }
+    return (((v2 ? 24 : v2) == (44 < v1)) == ((47 != a0[8]) && (v0 * v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,77 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 18;
+    int v2 = 46;
+    int v3 = 56;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((i0 || 51) > 93) break;
+            v0 = (((v1 / 1) / 8) != ((v1 * v2) ? (a1[0][9] % 7) : (v0 / 2)));
+            v1 = (((v1 <= v2) < (v2 * v1)) - ((90 || a1[1][2]) <= (27 * v2)));
+            {
+                int i1 = 0;
+                do {
+                    if ((i0 + i0) > 70) break;
+                    v3 = (((38 != a1[0][6]) >= (v0 / 4)) % 5);
+                    v1 = (((v3 % 7) <= (v3 > v2)) <= ((v1 && i0) - (a0[2] != 18)));
+                    v0 = (((55 % 3) > (v1 / 6)) * ((v1 < 82) * (v2 + a1[2][6])));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v0 = (((v3 > v0) ? (a0[6] <= v1) : (a0[14] == v1)) <= ((13 < 19) / 1));
+    if ((((75 < a1[1][9]) - (v3 <= a1[3][11])) > ((48 == v2) ? (85 >= a0[15]) : (v2 >= a1[2][3])))) {
+        a1[0][5] = (((a1[0][3] ? a0[12] : v0) * (42 >= v2)) && ((62 >= a1[1][2]) / 8));
+        v1 = (((v1 && a1[0][6]) * (a1[3][4] - 47)) ? ((a1[2][3] / 4) - (a1[0][4] % 9)) : ((v1 ? a1[1][14] : v2) > (v0 ? a1[0][5] : a1[1][11])));
+        v0 = (((a1[1][13] <= 42) < (v1 && v3)) / 1);
+    } else {
+        v0 = (((a0[4] > v0) / 4) <= ((a1[2][6] < a0[10]) < (v2 && v3)));
+        v3 = (((v1 || v1) >= (v3 / 2)) / 6);
+        v1 = (((v2 - 81) != (v2 / 9)) && ((v2 || 71) || (v0 % 7)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a0[0] = (((v1 - 1) > (v1 - a1[3][10])) + ((a0[11] > 14) < (i2 != 49)));
+            v0 = (((v3 || v1) <= (v3 <= v1)) ? ((v1 - v0) >= (a1[3][9] && a1[0][3])) : ((i2 % 4) * (v1 > v1)));
+            {
+                int i3 = 0;
+                do {
+                    if ((17 - v3) > 73) break;
+                    a0[15] = (((v1 != i3) / 3) % 1);
+                    a0[7] = (((v0 <= v0) < (16 ? 54 : v3)) || ((62 % 5) + (v2 < 48)));
+                    v2 = (((i2 == v3) * (a1[2][15] >= i2)) ? ((a1[0][5] > 1) ? (i2 < a1[3][11]) : (63 ? v1 : a1[1][7])) : ((v2 * a1[1][2]) >= (95 >= a0[15])));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a0[8] || 44) > 55) break;
+            v2 = (((a1[3][15] / 6) != (a0[10] / 9)) % 7);
+            a0[2] = (((v2 ? v2 : v3) ? (47 + v1) : (a0[9] % 4)) >= ((21 > 90) < (a1[3][15] == 66)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    a0[15] = (((v3 % 5) == (a1[0][9] || i5)) || ((a1[2][2] && 48) <= (35 <= a0[5])));
+                    v2 = (((79 + a1[2][0]) == (a0[0] % 2)) + ((a0[11] > i4) > (v1 % 2)));
+                    a1[0][9] = (((a1[0][6] * i5) / 8) == ((i5 >= 38) < (v0 && a0[15])));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v0 > v3) - (v0 && a1[1][8])) != ((46 - 38) % 1));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,127 @@
+int f0() {
+    int v0 = 48;
+    int v1 = 1;
+    int v2 = 84;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((5 ? i0 : v0) && (55 * v3)) != ((v1 ? v3 : i0) % 8));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((39 + 92) > 97) break;
+                    v1 = (((63 - 87) <= (a0[15] || a1[2][4])) + ((i1 + i0) % 2));
+                    a1[3][13] = (((v2 % 7) - (a1[3][5] ? i1 : v0)) >= ((i0 || v2) < (42 * 77)));
+                    v3 = (((25 / 8) && (i0 ? a1[0][5] : v1)) > ((i0 - a0[11]) <= (i1 / 7)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][7] = (((v1 ? v2 : v2) - (v1 - v1)) == ((v3 + v1) != (10 + v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 == v3) > 84) break;
+            v0 = (((11 % 8) < (a0[14] >= a0[3])) != ((v2 ? i2 : 75) - (a1[0][1] <= v0)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                a1[2][5] = (((i3 ? v0 : v3) > (v1 * i2)) == ((i2 && v0) == (27 < i3)));
+                a0[6] = (((a1[0][5] >= v1) && (76 % 8)) < ((a0[15] % 1) - (v3 == v1)));
+                v3 = (((51 ? v2 : v0) && (46 ? i2 : v2)) * ((16 < a0[6]) ? (i2 ? i2 : a1[2][7]) : (i3 || a0[12])));
+            }
+            a0[11] = (((v3 == v2) == (v1 / 5)) == ((v1 >= v3) == (a1[2][12] ? v2 : v1)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v1 = (((v2 > a1[2][1]) * (v0 ? 66 : v3)) != ((a1[1][5] != v2) > (8 > v1)));
+    v2 = (((a1[2][10] ? 35 : a0[9]) || (a0[7] != v1)) ? ((v3 <= v2) != (v0 < 38)) : ((79 ? v3 : a1[1][5]) || (64 == v1)));
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((v2 >= 5) > 67) break;
+            a0[9] = (((53 % 2) && (v3 >= v3)) / 9);
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a1[2][11] = (((v3 % 7) / 5) < ((a0[3] || a0[3]) >= (v0 + a1[0][9])));
+                v1 = (((45 < v2) <= (i5 / 7)) < ((v2 - 98) >= (v3 % 9)));
+                v1 = (((v0 || i5) * (25 ? a0[1] : v2)) < ((a1[3][4] || i5) * (a1[0][8] * 78)));
+            }
+            v1 = (((a0[14] ? a0[0] : v3) ? (v2 != v1) : (v2 ? 49 : a0[0])) / 2);
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[14] / 9) > (v3 >= v3)) / 5);
+}
+int f1() {
+    int v0 = 22;
+    int v1 = 85;
+    int v2 = 90;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a1[0][14] = (((v2 && a1[3][9]) ? (v1 && 18) : (a0[7] * a1[3][7])) >= ((v0 - 36) || (46 % 2)));
+        v2 = (((v0 ? v1 : v0) != (a0[7] == a0[11])) % 8);
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            if ((v3 % 5) > 68) break;
+            v1 = (((v2 == a0[3]) <= (a1[2][4] >= a0[14])) % 6);
+            a1[2][4] = (((a1[3][12] + a0[9]) < (94 ? a0[3] : 68)) >= ((v1 % 4) + (67 > 63)));
+            v0 = (((v2 >= a1[0][15]) > (a0[9] < 14)) && ((v3 == 74) + (i1 - a1[1][15])));
+        }
+    }
+    if ((((85 == 32) == (a1[1][14] && 12)) ? ((96 > a0[1]) - (a0[3] ? a1[1][11] : a0[3])) : ((a1[1][2] == a1[0][7]) <= (v0 && a1[3][5])))) {
+        v3 = (((v2 - a1[1][3]) % 6) + ((a1[3][4] != a0[6]) ? (67 / 8) : (a1[2][10] % 7)));
+        v0 = (((v2 == a0[12]) * (v1 != 45)) && ((v1 || v2) ? (a0[9] + 47) : (v3 + a1[1][15])));
+        a0[0] = (((97 || a1[0][12]) > (v2 ? v2 : v2)) * ((67 % 6) == (80 <= a0[0])));
+    } else {
+        v2 = (((a1[2][3] ? 46 : v1) % 7) * ((5 ? v3 : 13) && (a0[2] > v0)));
+        v3 = (((a1[2][2] ? 74 : 84) * (v2 >= 82)) + ((a1[2][11] >= a0[1]) || (a0[9] && 60)));
+        v3 = (((a0[8] / 4) + (a1[0][9] + 56)) * ((v2 == v0) <= (v0 % 1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v3 = (((a0[15] <= a1[0][13]) < (v1 % 8)) >= ((v2 ? 72 : v2) && (a1[1][15] <= v3)));
+                    v2 = (((v0 - a1[3][7]) ? (i3 >= 61) : (v0 < v0)) ? ((v3 < a0[14]) * (i2 - a0[0])) : ((v1 - v0) - (a1[3][8] ? a1[3][15] : 95)));
+                    a1[0][4] = (((v1 >= 72) / 7) && ((74 != a0[10]) || (a0[1] && a0[14])));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[1][8] = (((a0[3] <= 15) <= (a1[2][12] ? a1[2][13] : v3)) / 2);
+            v2 = (((5 || v2) && (v3 <= a0[1])) <= ((v1 - a1[3][10]) / 9));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v1 = (((a1[0][15] && a0[11]) == (i4 != v0)) > ((v0 && v3) ? (11 ? a0[12] : v2) : (v2 < v2)));
+                v2 = (((v0 - a0[4]) ? (a1[3][7] % 1) : (a1[0][12] && i4)) % 1);
+                v3 = (((i4 ? a1[1][10] : 17) || (a1[3][7] && a0[2])) != ((24 * v2) == (i5 % 3)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        v3 = (((17 && a0[5]) <= (v3 ? a0[5] : v1)) < ((a0[4] || a0[1]) * (74 >= i4)));
+        v3 = (((i4 * v1) / 7) && ((9 < i4) < (18 % 2)));
+    }
+    if ((((v0 < v0) / 2) / 1)) {
+        v2 = (((v1 * v1) * (a0[14] % 8)) ? ((v1 < a0[7]) != (v1 / 2)) : ((84 <= a1[0][15]) + (v0 != v1)));
+        a1[3][12] = (((87 / 7) * (v2 ? v3 : v0)) > ((v3 * 81) != (78 && v1)));
+        v3 = (((v2 / 4) == (66 < v2)) < ((4 + a0[4]) || (92 + a0[6])));
+    } else {
+        v1 = (((a1[1][10] > 61) + (a0[5] ? v1 : 23)) < ((v0 * v0) - (a0[11] / 4)));
+        a1[1][8] = (((73 > a0[7]) * (v1 == a1[2][9])) <= ((v1 && v1) && (v2 - a1[1][12])));
+        v3 = (((a0[2] < 60) / 1) == ((v1 < 29) > (v1 || v2)));
+    }
+    return (((v0 ? 47 : v1) >= (43 > v2)) < ((v3 ? 49 : v1) > (a0[6] * v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,184 @@
+int f0() {
+    int v0 = 75;
+    int v1 = 96;
+    int v2 = 67;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a0[8] > 62) - (54 >= a0[12])) || ((v3 - v1) == (85 || 23)));
+    if ((((a0[10] && v2) >= (a1[2][7] == v0)) <= ((v2 ? v3 : v0) == (v2 - v1)))) {
+        v1 = (((a0[12] + a1[1][6]) == (v3 ? 90 : v1)) ? ((a0[15] < 83) % 9) : ((15 * a0[3]) && (64 / 5)));
+        v2 = (((a1[1][4] + 86) || (a0[11] / 6)) / 6);
+        a0[3] = (((v3 >= v1) + (v0 < v2)) ? ((v3 && v3) % 4) : ((v3 * v2) - (v1 ? a0[13] : v1)));
+    } else {
+        a0[1] = (((a1[3][8] - 73) < (v1 < a0[3])) * ((v2 - 78) ? (v2 > v3) : (v1 <= v0)));
+        a0[4] = (((19 && v3) / 4) / 9);
+        v2 = (((a0[2] - v3) >= (v2 == v1)) - ((a0[10] - 87) >= (85 != a0[15])));
+    }
+    a0[7] = (((v2 <= v1) != (a0[6] - v2)) ? ((v3 && a0[11]) <= (v0 + v1)) : ((v1 ? v3 : v3) / 3));
+    v3 = (((v2 < 66) / 5) != ((v1 % 6) + (v0 < a1[2][6])));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((v0 ? v3 : v1) > 61) break;
+        {
+            int i1 = 0;
+            do {
+                v0 = (((v2 == i0) == (a0[5] % 5)) > ((v0 == v3) < (16 == a0[12])));
+                a1[0][10] = (((v0 > a0[6]) == (a0[10] + 64)) ? ((v0 && v0) >= (v3 < a0[10])) : ((a0[9] != v3) != (v0 ? i1 : a1[1][14])));
+                v1 = (((i0 + v1) >= (57 ? v2 : v0)) ? ((a0[12] && 37) / 3) : ((v1 || v3) <= (i0 != v3)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        a1[3][0] = (((v0 < i0) > (v0 ? a1[0][1] : v3)) <= ((a0[14] <= i0) * (63 - 94)));
+        v3 = (((i0 > 27) % 9) <= ((a1[0][12] || v0) < (v1 * 0)));
+    }
+    return (((a1[0][6] && v2) % 6) == ((v3 <= 86) % 8));
+}
+int f1() {
+    int v0 = 76;
+    int v1 = 34;
+    int v2 = 49;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    if ((((91 && v2) && (v0 || 88)) || ((v1 < v1) >= (v2 < v2)))) {
+        v3 = (((v1 ? v1 : v0) ? (33 < v2) : (v1 || v3)) + ((a0[8] * v1) > (v2 || v2)));
+        v1 = (((3 * a1[2][0]) == (v2 + v1)) ? ((a0[6] + v1) || (a0[2] < a1[1][11])) : ((v2 % 8) - (v1 < a0[14])));
+        a1[2][11] = (((v2 || v1) ? (a1[2][8] == 92) : (a1[3][6] / 3)) + ((a1[3][3] ? v1 : v3) <= (94 < a1[0][13])));
+    } else {
+        v3 = (((v2 == 51) % 3) || ((v1 >= 77) ? (v3 - v3) : (v3 < v2)));
+        v0 = (((v0 != v2) ? (a1[1][14] ? a1[3][1] : 42) : (v3 ? a0[1] : a0[14])) == ((a1[3][3] - v0) != (24 >= 88)));
+        v0 = (((93 <= a1[1][13]) ? (45 ? a0[2] : 52) : (35 > v1)) && ((v1 + 74) - (a0[14] != a0[9])));
+    }
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a0[13] = (((a1[2][4] * v3) * (a0[6] * a1[2][5])) ? ((a0[13] * a1[1][5]) != (a0[5] >= a1[3][14])) : ((56 * a0[14]) - (28 > 48)));
+                v2 = (((a0[4] <= v0) > (17 && 96)) / 6);
+                v3 = (((83 > v3) >= (i0 - 94)) && ((a0[1] * v0) ? (a0[15] == 42) : (a0[6] <= a1[1][15])));
+            }
+            a0[0] = (((a1[3][11] ? 18 : v0) - (a1[0][0] || a1[3][2])) - ((a0[15] || i0) + (v3 >= v2)));
+            v1 = (((i0 >= a0[6]) && (a1[1][1] ? 5 : v3)) != ((0 == i0) && (46 - a1[0][1])));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v2 + 46) > 71) break;
+            a1[0][6] = (((v0 || 95) ? (i2 && a1[2][12]) : (v3 + 24)) - ((v3 % 5) == (a0[14] / 2)));
+            {
+                int i3 = 0;
+                do {
+                    if ((v1 != 45) > 81) break;
+                    v0 = (((v3 && i2) ? (a0[7] ? v3 : 61) : (a1[3][1] || a0[9])) * ((v2 || a1[1][5]) || (v0 ? 5 : v2)));
+                    v2 = (((v1 + i2) % 4) && ((v2 + v2) == (v0 < a0[6])));
+                    v0 = (((1 + a1[1][4]) / 2) <= ((v3 * a0[15]) != (a0[2] && 32)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            a0[12] = (((94 >= v0) != (63 >= 2)) < ((a1[3][2] && a1[2][1]) <= (v0 == i2)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v2 = (((a1[2][3] / 9) + (v1 <= 95)) / 9);
+                v1 = (((a0[7] / 1) ? (i5 / 6) : (a1[1][2] < v3)) == ((v3 / 2) - (22 % 4)));
+                a0[0] = (((v0 ? a1[3][2] : 27) - (77 - a0[1])) + ((v2 * v2) == (i5 / 6)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v1 = (((a0[0] ? v2 : 13) ? (61 <= 0) : (81 / 6)) * ((93 / 5) / 3));
+        a1[1][12] = (((v3 <= 21) || (v2 && v2)) <= ((v3 + v3) / 2));
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[0][7] = (((a0[5] && i6) <= (v0 % 4)) > ((v0 == i6) <= (a1[0][12] >= v2)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v3 = (((i6 && v0) / 9) % 1);
+                    v0 = (((a1[3][11] / 3) * (a0[9] < v1)) > ((a1[2][1] && v1) ? (a0[10] != v0) : (v3 > 90)));
+                    a1[1][0] = (((v3 % 6) % 7) * ((43 * i7) > (v0 == 83)));
+                    i7 = i7 + 1;
+                }
+            }
+            a0[7] = (((i6 * v0) < (v3 + a1[2][11])) - ((i6 + a0[1]) + (a0[7] ? i6 : i6)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((20 >= v1) > (v1 > 99)) != ((a1[1][4] || 24) > (a0[10] >= a1[2][11])));
+}
+int f2() {
+    int v0 = 22;
+    int v1 = 14;
+    int v2 = 37;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v3 = (((a1[2][14] || a0[7]) * (95 + v1)) > ((v2 > v1) >= (88 >= a1[1][4])));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            a1[2][15] = (((a0[10] > 33) && (v0 > a0[9])) / 7);
+            a0[11] = (((a0[4] - v3) + (12 < 83)) + ((v0 * 14) % 3));
+            a1[3][3] = (((v3 && a0[6]) ? (v2 + v3) : (v1 - v1)) == ((v1 || i1) + (22 / 3)));
+        }
+        v1 = (((65 % 1) ? (a1[0][1] * v1) : (a1[2][13] ? v1 : 12)) < ((v2 / 2) < (a1[2][0] - v3)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((a1[0][8] >= v1) > 92) break;
+            v0 = (((v1 && v0) ? (v2 >= v2) : (a0[3] / 3)) > ((25 >= v3) || (44 < v2)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    if ((v0 == i2) > 70) break;
+                    v2 = (((a1[3][5] >= v0) >= (a0[3] >= 64)) - ((v2 > 81) ? (i2 >= v0) : (v0 < v1)));
+                    v3 = (((18 * i3) / 8) * ((v0 == v0) ? (v3 < i2) : (a0[2] >= a0[6])));
+                    v3 = (((v0 * i3) % 3) - ((a0[14] && v3) == (a1[0][5] || v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[2][15] = (((a1[1][9] > 46) / 8) == ((i2 * v2) || (v2 < 30)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            if ((a0[11] ? v1 : i4) > 99) break;
+            a1[0][3] = (((a0[12] % 1) && (22 * i4)) + ((v0 < 88) ? (a0[8] || i4) : (36 + a0[11])));
+            a0[11] = (((v3 != 31) <= (a1[1][0] || v2)) || ((a0[8] && v1) ? (6 == v1) : (i4 > v3)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    if ((a0[5] ? v3 : 45) > 84) break;
+                    v0 = (((i4 || v1) != (38 * 29)) == ((v3 ? i5 : v1) ? (i4 > a1[2][15]) : (54 != 43)));
+                    v3 = (((i4 > v3) * (i5 ? v2 : a1[0][10])) - ((i5 ? a1[3][1] : a0[10]) == (v2 + a1[2][0])));
+                    a0[14] = (((i4 >= a0[8]) / 9) || ((v0 || v3) != (i5 <= 22)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 > a0[3]) >= (a0[13] > v3)) % 9)) {
+        v2 = (((v3 + 4) || (a1[2][4] && v2)) > ((9 < 2) && (v1 ? v1 : 58)));
+        v3 = (((a1[2][15] == v1) / 1) < ((v1 - 18) < (v2 * a0[8])));
+        a1[0][7] = (((a0[11] - v0) ? (v3 != v0) : (a0[8] == a0[14])) == ((v1 / 1) && (v0 * v3)));
+    } else {
+        v0 = (((v0 * a1[0][5]) != (a0[12] ? v1 : v0)) < ((v1 || v3) <= (v0 || v0)));
+        a0[2] = (((a0[3] && v1) ? (v0 ? v0 : v0) : (82 + a0[4])) && ((34 * v1) > (a0[6] ? v0 : v1)));
+        v0 = (((v0 % 9) > (a1[1][7] / 3)) && ((v1 - v3) != (v3 * v1)));
+    }
+    v2 = (((83 / 7) ? (v0 || 77) : (v1 < 96)) - ((v0 / 4) == (a0[5] >= v1)));
+    return (((66 ? a1[1][1] : v2) >= (a0[0] < a1[1][0])) || ((v1 ? a1[1][7] : 38) < (v2 || v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,88 @@
+int f0() {
+    int v0 = 92;
+    int v1 = 6;
+    int v2 = 78;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 == v2) ? (a1[3][8] < v1) : (9 > v1)) || ((1 ? v3 : 89) <= (83 - a0[11])));
+            a1[2][7] = (((v1 - i0) * (v2 < a0[0])) * ((v1 && i0) + (i0 == v2)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v3 ? a1[1][13] : v3) != (i0 - i1)) <= ((v1 <= 63) && (v1 ? v1 : 43)));
+                    a1[2][3] = (((i1 % 1) == (v2 % 2)) % 6);
+                    v0 = (((a0[2] ? 13 : v2) + (v3 ? v0 : v3)) ? ((94 ? v3 : 1) != (57 != v3)) : ((39 == i0) ? (96 % 1) : (45 ? 72 : i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v0 = (((i2 == v2) ? (a0[11] <= a0[13]) : (v3 == 2)) + ((a1[3][9] >= 56) >= (v0 == 11)));
+            v3 = (((50 || v1) >= (v3 >= v2)) ? ((a0[7] % 9) < (v2 >= v0)) : ((i2 >= v0) >= (v1 > a0[12])));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][12] = (((i3 + a1[3][1]) ? (a1[2][2] ? 25 : v0) : (v2 > 78)) >= ((v2 - i2) / 3));
+                    v0 = (((70 > 48) ? (a1[1][5] % 5) : (a0[5] > v0)) < ((v0 % 6) * (a0[6] / 6)));
+                    v1 = (((v3 < a1[3][12]) > (a0[15] / 1)) / 2);
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                if ((i4 > 85) > 52) break;
+                a0[10] = (((a0[2] != v3) == (v3 + a1[2][4])) == ((i4 >= i4) / 1));
+                a0[6] = (((a1[1][10] != i4) / 9) - ((a0[14] != v1) / 9));
+                v1 = (((44 >= 52) < (v1 % 1)) - ((v1 < i4) != (v0 < 40)));
+                i5 = i5 + 1;
+            }
+        }
+        v0 = (((52 && 0) / 5) ? ((40 - i4) > (a1[0][5] + a0[12])) : ((v2 * i4) ? (v1 ? i4 : 17) : (a1[3][4] != i4)));
+        a1[1][13] = (((97 ? a1[2][4] : a0[12]) + (23 > i4)) > ((a0[0] % 9) >= (v1 % 8)));
+    }
+    if ((((v2 + v0) || (v1 ? a1[1][10] : a1[1][7])) > ((v3 % 6) <= (v2 >= v3)))) {
+        v1 = (((56 ? 93 : v0) != (a0[5] + a1[0][1])) != ((a0[10] || a0[13]) >= (13 > 26)));
+        v2 = (((a0[7] >= 60) / 1) != ((50 == 48) - (48 >= v2)));
+        v3 = (((a1[1][13] > a1[0][13]) == (a1[2][6] ? a0[4] : 75)) + ((a0[15] ? v1 : v0) == (v2 >= 5)));
+    } else {
+        v1 = (((v0 && 54) >= (75 / 4)) > ((a1[0][1] ? a0[10] : 19) == (a1[1][12] + v2)));
+        v1 = (((v1 && v1) || (v1 - a1[1][1])) * ((v0 % 9) / 5));
+        v3 = (((v2 + 77) ? (27 - v2) : (v0 > v3)) && ((49 < v3) || (84 / 7)));
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v2 = (((a1[2][15] - 37) == (a1[2][3] > a0[5])) + ((v1 - a1[3][8]) < (54 / 8)));
+                    a0[15] = (((v2 + v3) == (v1 - a0[14])) + ((99 >= i6) <= (v1 / 8)));
+                    v0 = (((i7 >= a1[1][1]) && (v2 / 8)) ? ((93 <= v0) ? (v0 <= v3) : (17 == v3)) : ((a1[2][15] - v1) >= (v2 ? a0[0] : v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            a0[14] = (((87 * a1[3][12]) / 5) && ((v3 || i6) % 5));
+            v1 = (((v0 ? v1 : v0) * (a1[0][10] - v0)) ? ((v0 / 9) >= (v0 * a1[1][5])) : ((a1[2][8] >= i6) < (52 || 52)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((32 + v3) ? (v1 && a0[14]) : (a0[14] <= 77)) * ((v2 == v0) == (40 ? v2 : v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,46 @@
+int f0() {
+    int v0 = 52;
+    int v1 = 86;
+    int v2 = 34;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 != v0) ? (v3 && v3) : (a1[0][12] || v3)) == ((56 % 5) <= (58 == v0)));
+    v3 = (((v3 ? v0 : 83) || (v2 / 9)) ? ((21 <= 53) + (v0 ? a0[9] : 19)) : ((v0 && v2) * (v0 - a0[1])));
+    v2 = (((v1 ? a0[2] : v3) * (v0 + 54)) - ((v2 || v2) ? (22 == v2) : (v2 < v1)));
+    {
+        int i0 = 0;
+        do {
+            a0[0] = (((22 / 5) + (i0 || a1[0][14])) <= ((i0 >= a1[0][3]) ? (a1[0][0] < 14) : (a0[1] == 96)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v3 = (((a1[3][3] - v0) * (17 || 17)) % 4);
+                    v1 = (((a1[2][6] * 49) + (i0 != i0)) <= ((v2 ? 14 : v1) * (96 < 4)));
+                    a1[2][0] = (((62 ? 71 : 50) / 3) + ((v3 || 0) * (75 >= v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[3] = (((v0 || v2) == (v1 * a0[5])) ? ((v1 ? a0[12] : i0) <= (a0[11] * a1[1][10])) : ((a0[7] < 16) <= (86 * v3)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v1 || a0[2]) ? (a1[1][10] - v3) : (v1 ? i2 : a1[1][10])) + ((v0 <= 98) - (v2 <= i2)));
+            a0[12] = (((91 > 31) / 4) >= ((37 / 9) >= (a0[0] < v0)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((a0[12] != v3) > 82) break;
+                v1 = (((v0 >= v2) != (31 && a0[3])) * ((i2 <= i2) * (62 == a0[15])));
+                v0 = (((v0 != 34) == (31 + i2)) + ((a0[2] && 68) ? (11 && 59) : (a1[2][9] > 73)));
+                v2 = (((v2 && 2) / 3) != ((v2 / 2) <= (v2 / 1)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    return (((v0 + v1) + (v0 || a0[5])) ? ((50 * a0[8]) > (v2 < v3)) : ((a0[12] != 33) >= (v0 >= a1[0][6])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,101 @@
+int f0() {
+    int v0 = 34;
+    int v1 = 35;
+    int v2 = 42;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((24 / 4) * (v0 && v1)) < ((74 != v1) == (v2 > v2)));
+    if ((((a1[2][11] != v1) || (a1[0][4] % 2)) < ((v1 / 8) - (v3 + v2)))) {
+        a1[2][9] = (((v0 % 9) - (v2 ? a0[5] : 74)) % 9);
+        v2 = (((a1[1][1] <= v0) != (a0[9] > v1)) < ((v1 % 8) >= (v1 < v0)));
+        v1 = (((48 - v3) % 7) <= ((v3 * v1) ? (v2 + 18) : (a1[1][8] ? a1[3][7] : v2)));
+    } else {
+        v2 = (((v2 / 5) + (v0 - 63)) ? ((66 == v3) + (80 % 3)) : ((a1[3][2] ? v2 : a0[7]) ? (v3 && a0[12]) : (v1 != a0[10])));
+        v2 = (((v1 ? v1 : v3) < (v1 ? a0[2] : v0)) > ((45 >= 57) || (v1 < v2)));
+        v2 = (((69 + a1[3][9]) % 3) - ((v0 == v0) || (a0[8] >= v0)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[2] = (((a1[0][7] != 2) > (v0 || a0[1])) > ((v1 ? 92 : v3) || (v1 % 3)));
+            v3 = (((79 <= v3) ? (v2 > v1) : (a1[1][2] ? i0 : v2)) > ((24 ? a1[0][8] : a0[2]) < (v0 || 86)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((v1 ? 97 : i1) > (v0 > 10)) * ((a0[14] && a0[5]) * (v0 == a1[3][6])));
+                    a1[0][3] = (((46 ? 23 : 73) > (32 ? a0[3] : a1[0][12])) < ((a1[0][10] * v1) + (i0 < 51)));
+                    a1[0][14] = (((76 == a0[15]) ? (i1 * i0) : (a0[10] % 9)) - ((a0[0] ? i0 : 16) % 8));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[1][9] > v2) > 55) break;
+            a1[0][8] = (((a1[3][5] - 31) / 2) != ((i2 / 3) < (v1 ? v2 : v1)));
+            v2 = (((v1 && 25) > (v2 - 63)) / 2);
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v3 = (((93 || a0[10]) || (i3 / 2)) && ((v0 != v3) < (a0[14] > i3)));
+                a1[0][8] = (((i2 <= i2) + (51 && 40)) == ((a1[0][0] != v1) != (86 == v2)));
+                v3 = (((a0[9] <= 28) == (i3 > v3)) ? ((10 != i3) <= (v3 + 6)) : ((v0 == 14) ? (v3 < a1[3][12]) : (a0[6] && v3)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v2 > v3) < (2 <= v3)) < ((v1 ? a0[9] : v1) < (v2 * v0)))) {
+        v3 = (((70 > a0[11]) != (43 != v0)) / 7);
+        a1[2][13] = (((v3 || a1[0][0]) >= (v3 < a0[1])) + ((v2 + 19) * (v0 + 60)));
+        v3 = (((17 > a1[0][4]) >= (94 ? v1 : a1[1][7])) || ((v0 <= v2) % 8));
+    } else {
+        a1[2][10] = (((v2 * a0[1]) != (a1[0][1] ? 52 : v2)) + ((a0[15] ? 99 : v0) == (v1 && a1[2][9])));
+        v2 = (((a1[2][5] >= a0[5]) / 3) == ((a0[12] == 79) <= (0 ? v2 : 27)));
+        a0[0] = (((a1[1][8] - v0) != (v1 || a0[7])) == ((54 < v2) * (v1 && 82)));
+    }
+    return (((v2 > v0) + (a0[9] && v3)) / 6);
+}
+int f1() {
+    int v0 = 0;
+    int v1 = 60;
+    int v2 = 60;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v3 == v3) < (v1 + a0[13])) && ((93 * a1[1][12]) - (60 == v2)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 - v1) - (45 || 95)) - ((v3 > v3) != (a0[6] || v2)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    if ((a0[1] <= v0) > 82) break;
+                    v3 = (((v2 >= i1) >= (42 + 43)) * ((i1 >= i1) || (v1 && a1[1][6])));
+                    v3 = (((v3 >= v0) ? (v1 > v3) : (42 + v3)) ? ((a1[1][5] - 89) / 1) : ((i0 || a1[2][3]) + (a1[3][15] % 8)));
+                    v1 = (((v2 + v0) * (a0[12] - 38)) / 1);
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((i0 % 7) ? (v1 >= a0[11]) : (v3 == 37)) % 6);
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    v0 = (((a1[2][13] < v1) < (10 ? v0 : v2)) / 9);
+    v1 = (((a1[3][7] ? a0[15] : a1[2][15]) ? (v1 ? v3 : v2) : (77 <= v2)) == ((v1 < v2) ? (2 ? v2 : 1) : (v3 && a0[8])));
+    if ((((v0 == v1) > (a0[13] || v0)) / 9)) {
+        v1 = (((v1 == a0[15]) && (a1[3][12] != v2)) % 3);
+        a0[5] = (((a1[2][14] < a1[3][3]) != (4 ? a0[6] : v2)) && ((86 || v0) ? (71 != a0[15]) : (47 / 7)));
+        a1[2][15] = (((70 ? 79 : 0) ? (58 * a1[1][12]) : (v2 == 43)) && ((28 <= a0[2]) * (v3 <= v2)));
+    } else {
+        a0[4] = (((a0[4] + 31) && (a0[10] - v2)) + ((a1[2][8] < 12) / 3));
+        a1[0][1] = (((v1 - a1[0][6]) ? (a1[2][5] >= a1[3][5]) : (v3 >= v3)) - ((v2 && v1) && (a1[3][11] || v2)));
+        a0[12] = (((v3 <= a0[8]) < (30 && v0)) <= ((v1 >= v1) - (v1 >= a0[1])));
+    }
+    return (((45 + 83) * (82 * a1[0][7])) * ((a0[4] ? v0 : 6) ? (a1[2][10] < a0[12]) : (a1[2][2] % 2)));
+}
+int main() {
+    return 0;
+}
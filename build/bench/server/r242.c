@@ -0,0 +1,205 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 93;
+    int v2 = 2;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    if ((((46 || a1[1][12]) || (64 ? v1 : v3)) - ((v2 / 4) || (47 && v2)))) {
+        v2 = (((v1 / 1) > (v1 % 8)) || ((v2 % 2) * (a0[9] != v2)));
+        v3 = (((95 != v1) + (v2 ? a1[2][14] : v2)) + ((a1[0][12] >= v3) >= (64 + a1[2][9])));
+        v2 = (((v1 == v2) && (51 > a1[3][3])) || ((31 && a1[1][1]) > (v2 && a1[0][7])));
+    } else {
+        v1 = (((v2 * 54) && (a0[12] && v1)) != ((v0 || v0) % 3));
+        a1[0][9] = (((v0 || v1) ? (v0 > a1[2][5]) : (v3 % 6)) + ((a0[12] || v0) > (v2 < a0[8])));
+        v3 = (((2 ? 58 : 51) < (v1 <= 22)) * ((v0 < a0[14]) - (v1 ? v1 : a0[15])));
+    }
+    v3 = (((a1[1][10] % 3) < (v0 + v0)) ? ((98 >= 53) <= (v0 || 35)) : ((v1 ? a1[1][12] : v0) == (v3 >= v2)));
+    if ((((20 ? 27 : 2) + (v2 < v1)) <= ((a1[3][4] / 4) ? (34 || a1[0][4]) : (a1[1][8] != v3)))) {
+        v3 = (((v2 < 55) <= (v1 / 3)) <= ((33 != 8) ? (a1[1][3] % 3) : (v3 && a0[12])));
+        v0 = (((a0[14] + v1) && (v1 > v3)) < ((v2 % 1) <= (11 * a0[8])));
+        v3 = (((58 ? v2 : v0) != (53 ? v2 : a0[1])) || ((v3 != v0) <= (v3 + v2)));
+    } else {
+        v1 = (((a1[0][10] < 17) >= (v1 - a1[3][10])) > ((v2 / 7) * (38 * a1[2][3])));
+        v3 = (((v1 ? v2 : v3) + (a1[2][5] * v2)) <= ((v1 * v0) ? (75 - v0) : (v3 + 79)));
+        v0 = (((v2 == a0[0]) <= (a0[15] == a0[11])) <= ((v0 && a0[8]) > (a1[1][3] < a0[2])));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[11] = (((v0 || 70) / 8) == ((89 != v1) && (70 >= i0)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v2 = (((a1[0][12] > 91) <= (i0 != a1[3][10])) ? ((i1 < a0[5]) && (v3 * v3)) : ((i1 + v1) * (a1[3][14] ? v3 : i0)));
+                v0 = (((72 + a0[12]) - (v0 ? v0 : 78)) <= ((a0[6] > 41) % 3));
+                v0 = (((a0[2] - v3) ? (73 > 37) : (i0 * 8)) < ((31 < a1[2][8]) < (a1[0][3] > v2)));
+            }
+            a1[2][3] = (((a1[3][7] == v3) == (v3 > v3)) + ((94 || 91) <= (v3 > i0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            if ((6 < a0[1]) > 99) break;
+            v0 = (((40 >= 53) ? (v0 < a0[6]) : (v3 == 51)) >= ((16 || 1) * (v3 ? a1[2][12] : v2)));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((v0 && v3) > (a1[2][9] % 7)) || ((a0[7] <= v3) % 9));
+                    a1[1][7] = (((i3 > a1[3][1]) <= (v1 <= v1)) % 7);
+                    a0[14] = (((v0 - v2) / 2) - ((v0 % 5) ? (28 || 5) : (v1 ? a1[2][5] : a0[3])));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v0 = (((a1[3][10] >= 16) && (47 >= v0)) == ((a1[1][13] + v1) - (92 == 50)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v3 % 6) ? (a1[0][13] == v1) : (10 % 1)) != ((v1 - a1[1][12]) || (v1 == v1)));
+}
+int f1() {
+    int v0 = 72;
+    int v1 = 92;
+    int v2 = 63;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v1 = (((v1 >= v0) <= (76 < 7)) ? ((33 > 62) < (a1[2][15] && a1[1][3])) : ((a0[3] - i1) - (i0 % 6)));
+                    a0[9] = (((v0 * a0[8]) - (v0 != 3)) - ((82 != a1[3][0]) ? (a1[0][4] || a0[6]) : (65 && a0[12])));
+                    v3 = (((a1[0][3] % 7) && (i0 * 37)) && ((v0 > 20) == (a0[0] != i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a1[0][3] * v3) % 4) > ((26 * 77) && (v3 && i0)));
+            a1[2][3] = (((a1[0][5] >= 93) > (a1[0][10] >= a1[3][11])) >= ((67 != v3) <= (72 / 9)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((a1[2][2] ? v2 : v1) <= (v2 ? v2 : a0[14])) - ((a1[3][14] == v3) == (v0 + v1)))) {
+        v3 = (((a0[11] + a0[13]) >= (26 * v3)) % 5);
+        v1 = (((a0[14] || v3) == (75 <= 38)) != ((v1 - a1[2][0]) * (a1[2][4] == v1)));
+        a0[4] = (((v2 % 4) + (v1 != 1)) / 9);
+    } else {
+        a1[3][14] = (((a0[9] ? v3 : 48) < (a1[1][5] % 1)) * ((v2 || v1) || (v3 * v3)));
+        a1[2][5] = (((a1[0][1] || 51) != (v1 >= a1[0][8])) < ((v2 && v1) || (v0 == v0)));
+        v2 = (((v2 ? 34 : v3) + (v0 ? a1[1][14] : v3)) - ((v3 == v0) < (v1 > 49)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[8] = (((i2 >= a0[6]) && (v3 == i2)) == ((v2 + v2) < (a0[10] ? i2 : v0)));
+        {
+            int i3 = 0;
+            do {
+                v1 = (((47 && a1[2][8]) - (a1[3][5] == v2)) == ((v3 < 84) < (v0 % 4)));
+                v2 = (((a1[2][7] || a0[14]) >= (a0[13] % 8)) || ((v0 != 63) * (a1[1][9] && 56)));
+                v2 = (((a0[7] <= i3) % 1) != ((a0[6] || v2) || (a1[3][9] + 92)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        v3 = (((v3 - 49) || (v2 != v3)) % 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                if ((v2 >= v1) > 90) break;
+                v1 = (((67 > i5) < (v3 * v3)) - ((v0 && a0[5]) ? (i4 ? a1[1][8] : v3) : (a0[8] * v2)));
+                a1[3][9] = (((i4 == 18) == (v0 * a0[3])) * ((v0 - v1) <= (v1 % 5)));
+                a1[2][1] = (((v0 && i5) < (v1 <= v2)) <= ((i4 ? a0[15] : i5) != (a0[2] ? v2 : v1)));
+            }
+            a1[1][11] = (((72 * 82) <= (v2 && a1[0][11])) * ((26 + 66) && (99 ? a1[3][7] : v2)));
+            v2 = (((v3 ? i4 : v0) - (a0[2] > v1)) < ((i4 && i4) % 5));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    if ((((v1 > v2) * (a1[2][5] % 6)) % 3)) {
+        v0 = (((18 ? 2 : v1) - (v3 || 59)) % 9);
+        a1[1][3] = (((v0 != a0[15]) == (v2 && a0[3])) ? ((19 / 2) <= (v1 && v0)) : ((v0 < 51) + (v1 <= a0[13])));
+        v2 = (((1 == 40) - (v0 <= a1[3][13])) >= ((v2 > a0[12]) ? (98 != v3) : (v2 > v0)));
+    } else {
+        a0[3] = (((v0 == a0[14]) < (v0 % 2)) <= ((v1 || v2) / 4));
+        v1 = (((v3 ? v3 : v3) <= (v1 % 7)) && ((45 % 2) > (a0[9] - v3)));
+        v0 = (((v3 / 6) - (v2 <= v1)) < ((60 <= v0) ? (v1 == 32) : (a1[2][15] - a1[2][5])));
+    }
+    return (((v0 <= a1[0][4]) >= (v3 % 6)) * ((v1 == a1[2][9]) >= (v3 != a0[8])));
+}
+int f2() {
+    int v0 = 58;
+    int v1 = 56;
+    int v2 = 36;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    if ((((42 > 39) ? (v0 >= v1) : (12 != v2)) - ((v0 || v3) + (24 * v2)))) {
+        v2 = (((48 + v2) ? (a1[0][14] <= 86) : (a0[12] >= 58)) * ((a1[1][8] ? a0[1] : v3) ? (58 - 90) : (v1 >= v2)));
+        v2 = (((v0 > v2) <= (a0[14] >= v1)) ? ((v1 >= v1) == (54 + a0[9])) : ((v1 != 74) - (8 - v0)));
+        v2 = (((v0 % 2) ? (a1[2][10] >= v3) : (v2 + 30)) == ((v1 <= v3) ? (v1 * 49) : (v0 / 9)));
+    } else {
+        v2 = (((34 != a0[15]) != (95 < a0[14])) > ((85 ? v2 : 71) * (v0 > v0)));
+        v1 = (((v2 + a0[3]) == (a1[1][4] - 24)) > ((a0[14] / 2) || (a0[10] || a1[1][4])));
+        v1 = (((v0 < v3) != (v3 % 9)) + ((a1[2][4] != 94) <= (v0 + a1[1][14])));
+    }
+    if ((((46 * v1) > (v0 ? a1[3][1] : 39)) + ((v0 > a1[3][10]) ? (v0 ? v1 : a0[2]) : (v3 - v3)))) {
+        v1 = (((34 > a0[13]) >= (a1[2][11] * v2)) ? ((v0 % 7) && (v3 != v0)) : ((v0 > a0[11]) || (v1 >= v2)));
+        v0 = (((37 / 9) >= (v2 % 3)) / 1);
+        v0 = (((v3 && v3) + (a1[0][10] / 9)) <= ((v0 < v2) ? (v2 >= v3) : (v3 - v3)));
+    } else {
+        a0[7] = (((a0[9] > v1) - (v0 ? v3 : v3)) % 7);
+        a1[3][1] = (((v0 / 9) < (a0[3] || v0)) && ((a0[6] > 3) % 2));
+        v3 = (((67 || v2) ? (v2 && v1) : (v3 + 44)) > ((v2 || v3) || (v2 % 2)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v1 = (((90 > i0) ? (57 / 8) : (41 != 72)) < ((59 + 86) && (v3 < i1)));
+            v1 = (((v2 - a1[0][11]) / 3) + ((a1[3][15] < i1) / 4));
+            v2 = (((i1 < v0) * (i1 * a1[2][11])) != ((v0 % 2) - (v2 / 8)));
+        }
+        v2 = (((v3 - a0[10]) - (i0 && i0)) + ((i0 || v0) < (v0 > a1[0][15])));
+        v3 = (((0 != a1[3][2]) > (a0[0] <= 84)) >= ((a0[15] + v2) < (v2 * 40)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((47 || 15) > 58) break;
+            v0 = (((v3 > v3) >= (i2 ? 43 : v3)) > ((v3 == v0) ? (92 / 3) : (a1[3][1] <= v1)));
+            {
+                int i3 = 0;
+                do {
+                    if ((39 + v3) > 59) break;
+                    v0 = (((v0 && i2) ? (i3 <= a1[2][12]) : (a0[7] < 41)) > ((v0 == 90) - (a1[2][2] - v3)));
+                    a1[0][12] = (((a1[1][4] && 43) - (a0[12] <= v2)) < ((v1 == a1[0][10]) > (v2 != i3)));
+                    v1 = (((i2 > a0[13]) - (i3 + i3)) < ((v3 ? a1[1][14] : a0[4]) + (i3 ? 60 : v2)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v3 = (((69 < a0[3]) == (33 % 8)) && ((v3 % 9) ? (i2 ? 34 : v2) : (v0 >= v2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            v2 = (((v1 / 8) > (i4 / 1)) + ((35 ? a1[3][13] : i4) % 9));
+            a0[15] = (((v1 == i4) <= (a1[1][6] * v0)) == ((a1[0][6] ? v2 : v1) / 1));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    a1[2][13] = (((a0[1] <= v2) + (44 >= a0[12])) / 2);
+                    v0 = (((i5 % 5) < (i5 + 87)) != ((a1[3][3] / 1) && (v1 != 55)));
+                    a1[2][12] = (((60 > v2) || (v1 || a0[5])) / 1);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[2][10] && a1[3][1]) || (75 ? v2 : a1[3][11])) > ((89 == v3) != (v0 > a1[3][2])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,63 @@
+int f0() {
+    int v0 = 50;
+    int v1 = 94;
+    int v2 = 88;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 * v0) && (v3 >= v2)) % 8);
+    if ((((89 % 4) ? (a0[9] / 5) : (v1 / 9)) == ((a0[4] ? v0 : 37) < (v0 && a1[0][5])))) {
+        a1[2][10] = (((a0[9] <= v0) ? (v3 < v2) : (v2 == a0[1])) + ((v2 || v3) / 7));
+        v0 = (((a1[1][2] ? 66 : v1) > (v3 > a0[2])) >= ((47 == a1[2][2]) || (14 - v3)));
+        v3 = (((v1 && 56) == (a0[12] / 1)) || ((a0[2] < v0) && (v0 > 15)));
+    } else {
+        v0 = (((v2 > v2) <= (94 - a1[3][4])) % 4);
+        v1 = (((a1[2][4] <= v2) + (47 + 9)) >= ((v0 ? 13 : v1) ? (94 > v1) : (v2 < 64)));
+        a1[0][7] = (((a0[10] % 9) - (27 + v1)) > ((a1[2][2] > a0[4]) != (v3 <= 5)));
+    }
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v0 = (((a1[3][2] == 38) || (v3 < v2)) - ((50 % 2) || (88 - 38)));
+                a0[9] = (((v1 % 2) || (a0[14] ? v3 : a1[0][4])) && ((a1[2][1] - 73) % 3));
+                a0[6] = (((i1 % 3) < (2 && 33)) != ((a1[2][15] ? a1[3][11] : a1[0][4]) != (46 && v0)));
+            }
+            a0[0] = (((a1[3][8] ? v2 : v2) && (a0[5] != a0[3])) + ((v3 + i0) ? (a1[0][14] && v2) : (i0 % 4)));
+            v0 = (((a1[3][5] && 36) ? (a1[3][0] + a1[3][4]) : (v0 > a0[15])) ? ((i0 || v2) / 6) : ((v3 + 48) - (8 ? 25 : 52)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((v0 - a0[5]) > 91) break;
+        v0 = (((a0[15] * v3) ? (a1[2][0] > 27) : (v0 - v2)) >= ((a1[2][7] >= v2) + (v0 * 4)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            if ((v0 * i3) > 65) break;
+            v2 = (((40 > 90) != (i2 ? i2 : a0[7])) || ((a0[13] != v3) < (i3 ? 94 : a1[1][15])));
+            a1[1][2] = (((v1 != 77) <= (v0 - v3)) < ((74 >= 64) / 6));
+            a1[2][14] = (((v0 != 38) ? (67 / 7) : (1 < v0)) % 9);
+        }
+        v3 = (((v3 ? v1 : a0[11]) % 1) > ((a0[12] - i2) <= (38 < 69)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((a0[9] ? v1 : v3) + (67 % 8)) <= ((v1 <= v3) || (i4 + v0)));
+                    v1 = (((68 > a1[0][12]) / 9) % 5);
+                    a0[10] = (((a1[0][0] - v0) != (i4 <= i4)) / 6);
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v0 != 85) * (i4 < v3)) == ((27 ? v2 : a0[8]) / 5));
+            a0[9] = (((a1[0][4] ? 59 : 81) != (v2 && 29)) == ((a1[3][15] == a1[2][3]) < (82 == a0[3])));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((a1[0][2] != v2) != (v3 ? 24 : v2)) == ((v3 ? v1 : v1) <= (a0[15] != v1)));
+}
+int main() {
+    return 0;
+}
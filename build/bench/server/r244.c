@@ -0,0 +1,112 @@
+int f0() {
+    int v0 = 1;
+    int v1 = 71;
+    int v2 = 84;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 && v2) || (v0 && a1[1][3])) * ((11 ? 21 : a1[3][5]) != (36 || v1)))) {
+        v0 = (((a1[1][0] >= v0) + (58 != 74)) < ((v1 <= a1[0][11]) && (2 > 17)));
+        v0 = (((v0 ? 90 : 62) ? (v3 + a1[1][13]) : (2 != 70)) >= ((v1 - 43) >= (v0 == v2)));
+        a1[1][10] = (((v2 + 47) || (v2 * v1)) <= ((v2 == v0) || (v0 > v3)));
+    } else {
+        v3 = (((v1 ? a0[1] : 27) && (28 > a0[7])) + ((21 && a0[2]) <= (v3 ? 96 : 8)));
+        a1[0][5] = (((v3 != v2) > (77 >= v0)) + ((52 > v3) - (21 ? v0 : v0)));
+        v2 = (((v1 % 4) + (65 <= 82)) + ((a1[3][14] ? v1 : a0[11]) <= (44 ? v0 : a1[3][10])));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((76 ? i1 : 44) || (v2 - 42)) < ((i0 ? a0[11] : i1) - (v1 || v2)));
+                    a1[3][6] = (((a0[0] < v0) <= (44 || i0)) == ((v0 % 2) >= (i0 < v1)));
+                    v0 = (((v0 + 12) == (a1[3][15] ? i1 : v0)) % 3);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v2 = (((2 != i0) - (a0[3] <= 28)) <= ((v2 / 8) >= (a1[1][14] >= a0[15])));
+            v1 = (((v1 / 5) > (a1[1][14] ? 24 : 56)) - ((a1[3][10] - 57) < (v2 + a0[8])));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[9] = (((a1[3][5] % 6) * (a1[3][7] <= a1[0][14])) != ((v1 ? v2 : i2) - (a0[0] < a1[0][9])));
+        v2 = (((i2 < v2) || (99 * 84)) / 7);
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            v0 = (((57 != 26) % 9) ? ((v0 > a0[13]) != (a0[8] <= v1)) : ((i3 + a1[3][5]) < (v1 ? a1[1][14] : 19)));
+            a0[6] = (((34 || a0[12]) + (i3 <= a0[0])) / 2);
+            v3 = (((v3 ? i2 : v0) != (v2 ? 93 : v0)) >= ((v2 && v0) * (1 + 14)));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v0 = (((i4 != i5) && (a0[13] ? a1[3][8] : v3)) ? ((a0[14] <= 83) || (a1[1][7] % 7)) : ((v0 != i5) != (v0 > v3)));
+                v1 = (((v3 > i4) >= (53 == i4)) * ((v3 == v0) != (v1 == v3)));
+                v3 = (((v2 * v1) + (i4 != v2)) ? ((a1[2][10] * 67) >= (a1[2][15] ? v2 : v2)) : ((a1[0][8] != v0) == (v2 % 4)));
+            }
+            v3 = (((v2 < v1) ? (25 * a0[7]) : (a1[0][8] ? a1[2][1] : 13)) == ((v2 != a1[3][8]) == (v3 + a0[13])));
+            a0[0] = (((80 >= 4) - (v2 || a1[3][2])) != ((i4 / 8) <= (v3 % 9)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    a0[13] = (((98 == v2) <= (8 + v1)) >= ((v3 || 39) < (80 <= a1[0][7])));
+    return (((v0 ? v0 : a1[0][5]) * (v0 / 5)) % 1);
+}
+int f1() {
+    int v0 = 34;
+    int v1 = 69;
+    int v2 = 82;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[8] >= a0[2]) * (a0[3] >= 0)) > ((a0[5] >= a0[3]) * (4 < v0)))) {
+        a1[2][9] = (((v2 <= 60) >= (v2 <= v3)) >= ((a1[1][3] - 33) % 6));
+        v1 = (((v2 + v1) && (a0[0] / 9)) ? ((v0 == v0) % 6) : ((v2 != v0) / 1));
+        v1 = (((v3 || v3) % 5) || ((v1 + 62) < (v2 >= a0[3])));
+    } else {
+        v0 = (((a1[3][7] - v2) - (v2 <= 5)) != ((v2 + v2) ? (v3 && v1) : (v3 + 16)));
+        v2 = (((12 < a0[10]) && (v1 / 6)) > ((76 != v0) != (v3 - 22)));
+        v1 = (((v3 == v2) || (v3 - a1[3][9])) != ((v2 <= 62) % 4));
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v1 = (((v1 % 9) >= (75 || 5)) + ((i0 < v3) || (v2 != a0[6])));
+        v2 = (((69 ? v0 : v3) ? (v0 - a0[10]) : (v0 + v2)) ? ((a0[2] && 30) / 7) : ((a0[0] % 2) * (v1 ? 90 : i0)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v1 = (((v1 * 91) == (a0[13] + a1[0][15])) ? ((a1[3][8] ? v2 : a1[2][9]) || (v1 * i1)) : ((91 + v3) || (a0[13] || v1)));
+            v0 = (((a1[0][15] <= 25) ? (0 * i1) : (a0[3] % 2)) * ((v1 * a0[0]) / 2));
+            v3 = (((v0 <= 41) / 3) >= ((15 - a0[5]) % 7));
+        }
+    }
+    if ((((v1 % 5) / 9) <= ((4 < v3) > (v2 / 9)))) {
+        v2 = (((a0[0] > v3) / 3) % 4);
+        v1 = (((a0[2] * 97) && (v3 || 88)) != ((v1 / 4) <= (v0 * 87)));
+        v2 = (((v2 >= a1[2][13]) || (v1 >= v2)) && ((56 ? a1[1][13] : v0) >= (15 % 7)));
+    } else {
+        v3 = (((a0[11] ? a0[11] : a1[3][3]) + (70 != 37)) ? ((v1 <= v0) ? (v1 == v3) : (76 % 1)) : ((v3 == 78) == (v2 >= v3)));
+        v3 = (((v1 * 55) ? (98 != v1) : (v3 % 4)) && ((20 / 8) - (a1[2][15] * v2)));
+        a1[1][8] = (((a1[3][15] == v0) || (a0[11] + 96)) || ((4 + v3) % 4));
+    }
+    a0[12] = (((v0 - 22) % 8) && ((a1[1][2] ? 67 : 1) ? (a1[3][5] != 38) : (82 || 96)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v3 = (((6 && a1[2][13]) || (a0[5] ? a1[1][0] : 47)) >= ((a1[0][1] || 18) % 3));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((v1 <= 69) > 63) break;
+                a0[11] = (((49 <= v0) % 6) + ((i2 % 5) ? (a1[3][8] ? v2 : a0[2]) : (a1[0][13] < i3)));
+                v3 = (((i3 % 6) - (v0 < 49)) || ((a1[2][6] / 4) == (v2 || v1)));
+                v0 = (((v2 > i2) > (i3 - 64)) ? ((a1[1][13] % 4) == (i3 < v1)) : ((v1 <= a0[11]) >= (a0[7] && a0[5])));
+            }
+            a0[11] = (((v3 != 24) < (v2 && v3)) != ((i2 < v1) && (v1 < a0[8])));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v0 > v3) != (v1 >= 31)) ? ((v1 / 7) ? (v1 + a0[2]) : (v1 > a0[6])) : ((v0 / 6) < (a0[2] == v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,165 @@
+int f0() {
+    int v0 = 88;
+    int v1 = 6;
+    int v2 = 8;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a0[10] = (((52 >= 30) == (v0 < 34)) <= ((a1[0][13] != i1) ? (76 == v1) : (7 - v1)));
+                a1[0][4] = (((i1 ? a1[2][0] : 92) > (v2 != a0[6])) ? ((31 - v2) ? (v0 && a0[6]) : (v3 != 43)) : ((3 <= 66) * (a1[0][14] < i1)));
+                a0[9] = (((i0 == v2) <= (4 == 67)) != ((87 != a1[3][12]) && (a1[2][11] / 1)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        a1[1][3] = (((72 - i0) - (i0 - 97)) == ((v0 / 4) + (a0[1] / 7)));
+        v0 = (((v3 != 23) > (v2 != a1[1][5])) ? ((17 == 36) || (v3 ? v1 : v0)) : ((6 >= v3) && (v0 >= v0)));
+    }
+    v3 = (((a0[8] - v1) && (88 % 7)) >= ((v2 >= 46) == (v0 > 82)));
+    if ((((v3 < v0) > (v0 || v2)) - ((a1[2][14] * v3) >= (73 == a1[0][9])))) {
+        a1[2][10] = (((v0 && 78) < (v3 % 7)) / 2);
+        v0 = (((v2 < v2) <= (80 ? 44 : a0[5])) % 2);
+        v3 = (((a0[10] < v2) ? (a0[1] || v1) : (v3 >= v3)) % 7);
+    } else {
+        a1[3][2] = (((v0 / 9) % 4) && ((v1 < 34) + (30 < 50)));
+        v0 = (((a0[2] ? v3 : a1[0][13]) && (52 >= v3)) || ((v0 || v3) % 9));
+        v2 = (((v3 || a0[1]) <= (a1[3][1] != v2)) - ((v3 + a1[1][8]) != (v1 <= v3)));
+    }
+    if ((((v1 <= 36) != (88 ? a0[5] : a1[1][9])) * ((v1 && 79) * (54 > v1)))) {
+        v2 = (((54 / 3) / 1) || ((v3 / 6) == (0 * a1[0][13])));
+        v2 = (((57 >= v2) || (a1[0][12] || a1[3][1])) + ((v1 >= 21) < (v1 <= 75)));
+        v3 = (((v0 < v2) >= (v3 && v3)) == ((1 == v1) % 9));
+    } else {
+        a0[10] = (((a0[2] % 8) - (7 - v0)) < ((v0 + v3) + (a1[1][5] == 2)));
+        v2 = (((11 % 8) / 5) < ((v1 >= a0[15]) < (58 ? 72 : v0)));
+        v1 = (((v2 ? v0 : 28) || (35 <= a1[1][15])) || ((v0 ? v3 : a1[3][3]) > (v1 ? v0 : a0[8])));
+    }
+    v2 = (((82 || v1) ? (v1 >= a1[1][1]) : (a1[2][11] + v1)) < ((v1 || 59) / 1));
+    return (((69 + v1) <= (v3 < 19)) >= ((35 && a0[7]) == (v2 >= v1)));
+}
+int f1() {
+    int v0 = 66;
+    int v1 = 53;
+    int v2 = 19;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((55 == 83) > 79) break;
+            v0 = (((i0 / 9) ? (a1[2][8] * v0) : (i0 <= a0[8])) > ((10 || a1[2][11]) * (v0 * v2)));
+            v3 = (((v2 * v0) != (v3 ? v3 : v1)) % 3);
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((a1[0][15] == i0) > 87) break;
+                a0[12] = (((v1 <= 22) * (69 / 1)) == ((v0 + i0) / 1));
+                v0 = (((v2 && 65) == (v0 < a0[8])) ? ((i1 % 1) / 7) : ((41 < 5) == (i1 % 4)));
+                a0[7] = (((v3 || i1) <= (28 && i0)) && ((a0[4] ? 53 : v1) - (a1[3][5] != v2)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v2 = (((i2 <= 22) ? (70 ? v3 : 91) : (15 % 9)) > ((77 >= v0) >= (v1 % 4)));
+            v0 = (((a0[14] ? a0[0] : 11) && (45 != v2)) == ((a0[14] - 55) < (v1 / 3)));
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[2][6] < 90) > 86) break;
+                    a1[1][0] = (((i3 / 7) / 2) >= ((v1 / 5) * (i3 % 3)));
+                    a0[15] = (((v0 && 10) == (v1 == i3)) ? ((80 - v2) >= (88 || v2)) : ((i2 ? 73 : i3) >= (i2 / 3)));
+                    v3 = (((59 - 17) - (i3 <= a1[2][13])) ? ((a1[2][13] / 2) <= (16 % 1)) : ((28 && v0) * (v0 - 16)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a1[0][4] = (((v1 == a0[3]) != (v0 - v1)) <= ((21 ? i4 : i4) > (a0[15] != v2)));
+        v1 = (((a0[12] - 11) == (v2 % 9)) * ((v1 ? v2 : v1) == (v2 ? a1[1][0] : a1[1][15])));
+        {
+            int i5 = 0;
+            do {
+                a1[3][7] = (((i4 && v1) != (a0[15] % 7)) < ((v2 % 2) != (v0 > a1[1][6])));
+                a1[1][12] = (((46 ? i4 : v0) >= (v0 + 0)) == ((i4 * 61) && (51 != i4)));
+                a0[14] = (((a0[0] % 4) || (13 / 4)) > ((a1[1][1] < 34) && (v2 - a0[8])));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            v2 = (((v0 ? v2 : 60) < (v3 != a1[1][10])) >= ((a0[1] < i6) ? (i6 <= v0) : (v1 ? v1 : i6)));
+            v1 = (((v3 / 7) < (v0 - v0)) - ((a0[10] - 6) % 7));
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v2 = (((a0[3] + a1[0][4]) || (v0 == v2)) + ((i7 != 13) ? (v2 <= 59) : (i7 || v0)));
+                    v3 = (((v1 || a0[13]) <= (a0[4] && v2)) + ((49 <= v2) && (v0 && 21)));
+                    a0[4] = (((a0[7] * a0[6]) + (v1 >= i7)) * ((v3 * i7) > (v2 * v1)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        v0 = (((v0 - i8) * (a1[0][7] || v0)) ? ((v1 || v3) <= (i8 <= v2)) : ((v2 > v2) > (v3 * 79)));
+        v2 = (((v0 || v1) ? (a0[14] <= v2) : (v2 - v3)) <= ((v1 ? 25 : v2) - (v1 && a0[8])));
+        {
+            int i9 = 0;
+            while (i9 < 5) {
+                if ((i8 - i8) > 90) break;
+                a1[3][9] = (((20 ? v2 : 48) - (a1[2][0] == a1[3][0])) >= ((a0[9] <= 28) * (v3 % 4)));
+                v0 = (((v2 || 47) - (a1[2][6] <= a1[1][0])) || ((a0[13] >= a1[0][13]) || (a0[11] ? a0[14] : i8)));
+                a1[2][0] = (((a0[10] / 7) >= (a0[12] && 83)) > ((53 != 59) + (i9 - v2)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    return (((42 ? 61 : v2) != (72 && a1[2][14])) / 7);
+}
+int f2() {
+    int v0 = 57;
+    int v1 = 90;
+    int v2 = 32;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((32 < v1) > (v1 ? v3 : v1)) > ((v2 == a0[15]) < (v1 || 14)));
+    v2 = (((v1 || v3) == (38 + a1[1][6])) % 1);
+    v3 = (((v0 >= v3) != (a0[9] ? 87 : v2)) / 4);
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v3 = (((97 < v0) >= (v2 || v1)) != ((a1[2][6] && v0) - (v2 ? v3 : v2)));
+        v1 = (((a1[0][10] % 6) == (32 != a1[1][1])) - ((a0[7] - i0) * (v2 ? v3 : a0[14])));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            a0[7] = (((a1[3][7] - 3) / 1) ? ((46 != v2) <= (v2 % 6)) : ((a0[7] - v1) || (i0 || v3)));
+            v0 = (((v2 ? 76 : v1) != (a1[1][0] || 64)) ? ((22 && 49) / 1) : ((v2 || 15) ? (a1[2][2] == a0[15]) : (a0[1] - 94)));
+            v1 = (((v3 - a0[13]) || (i1 && a0[1])) - ((67 - v3) == (44 - a0[12])));
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v1 = (((49 % 9) % 1) && ((i2 > v1) - (26 / 3)));
+        v3 = (((a1[2][13] > v1) != (v0 < a1[3][9])) ? ((99 ? v3 : a1[3][13]) * (v0 >= v0)) : ((a0[11] - v2) + (a0[11] != v0)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v3 = (((v1 % 4) && (a0[12] ? v0 : v2)) ? ((i2 <= a0[7]) == (v0 >= a1[3][6])) : ((35 > i3) == (v3 / 9)));
+                v2 = (((i2 ? i2 : v2) % 5) + ((i3 && v2) <= (a1[3][3] >= a0[1])));
+                v2 = (((i3 != v0) < (5 > 82)) && ((a1[2][4] <= a0[15]) < (92 || a1[2][6])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    return (((v3 || 88) != (a0[2] ? v1 : a0[0])) != ((a1[1][5] != 86) || (a0[2] + 20)));
+}
+int main() {
+    return 0;
+}
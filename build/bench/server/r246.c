@@ -0,0 +1,47 @@
+int f0() {
+    int v0 = 43;
+    int v1 = 39;
+    int v2 = 80;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a0[12] = (((v2 > 51) ? (v2 >= 38) : (v3 > 26)) != ((v1 || 82) ? (22 && v0) : (v0 % 3)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            if ((v2 == 67) > 78) break;
+            v1 = (((a1[0][0] / 8) > (i0 || a0[7])) > ((v0 != a0[4]) * (v0 == v0)));
+            v3 = (((a0[15] == 12) == (a1[2][14] <= v0)) || ((i0 == v1) * (63 || i0)));
+            v2 = (((a1[1][11] && 87) >= (a0[3] / 5)) <= ((v2 * i0) <= (1 * 2)));
+        }
+        v0 = (((51 >= i0) * (i0 >= v0)) % 9);
+    }
+    if ((((v3 != v0) * (a0[12] == v3)) / 7)) {
+        a0[0] = (((a0[11] > 88) || (a0[14] % 5)) == ((v0 % 1) % 1));
+        a1[3][8] = (((v1 > v3) < (v3 != a0[6])) != ((v3 ? v0 : 22) > (v0 - v0)));
+        v1 = (((v0 + 50) ? (v2 && 11) : (a1[1][2] || a1[3][8])) / 3);
+    } else {
+        v1 = (((a1[0][3] >= 15) || (a0[1] <= 13)) ? ((v1 && a0[13]) ? (v1 <= v1) : (v3 * v0)) : ((53 <= a0[14]) ? (v0 == v0) : (35 / 7)));
+        v2 = (((v0 ? 69 : 53) != (a0[12] < v2)) != ((v3 >= v3) || (62 <= v2)));
+        v3 = (((v0 < v2) == (v2 == a0[5])) >= ((v2 && 6) + (v2 != v3)));
+    }
+    a1[0][15] = (((a0[3] || v0) != (a1[1][4] >= v2)) / 8);
+    v2 = (((a1[3][6] % 4) != (a0[0] > 42)) - ((13 ? v3 : v3) ? (29 || v0) : (54 != v0)));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a1[0][6] * a0[4]) > 93) break;
+        v2 = (((a0[13] || v2) - (39 + a1[3][15])) || ((a1[3][15] != 2) / 9));
+        v2 = (((a1[3][4] == 91) + (i2 ? 29 : 74)) * ((a1[2][13] - i2) != (a0[9] >= 49)));
+        {
+            int i3 = 0;
+            do {
+                a0[13] = (((a0[6] < i2) >= (i3 ? v0 : a0[4])) > ((i2 + v3) < (a0[4] <= v2)));
+                v1 = (((32 - i3) * (v1 > i2)) - ((a0[14] % 6) + (52 ? v3 : a1[1][4])));
+                v0 = (((a1[0][5] / 8) != (a0[15] < a0[6])) == ((a0[0] < a0[0]) != (75 % 6)));
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+    }
+    return (((v0 * 70) ? (v2 ? a1[2][1] : a1[3][9]) : (36 < v0)) / 4);
+}
+int main() {
+    return 0;
+}
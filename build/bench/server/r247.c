@@ -0,0 +1,120 @@
+int f0() {
+    int v0 = 2;
+    int v1 = 87;
+    int v2 = 3;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    if ((((80 + v3) % 4) / 2)) {
+        v2 = (((a0[2] <= a1[1][7]) > (a1[0][1] > v3)) * ((a0[4] && a1[2][5]) % 8));
+        v1 = (((v3 <= a0[9]) >= (v3 + v3)) >= ((v2 || v3) < (85 > 66)));
+        a1[3][9] = (((a0[1] < v3) % 1) != ((71 || v3) > (v1 + a1[2][15])));
+    } else {
+        v1 = (((v2 < v0) / 5) > ((v3 ? v2 : 22) + (a0[8] >= v2)));
+        a0[2] = (((v1 * a0[9]) / 9) - ((98 + a0[10]) >= (v0 < a1[1][1])));
+        v3 = (((v0 - v3) + (v2 < 80)) >= ((v3 >= v1) % 4));
+    }
+    if ((((a1[3][4] != 12) > (a1[0][5] >= v0)) > ((78 > v0) / 9))) {
+        v0 = (((a0[0] != 29) * (44 > v0)) || ((v1 - a0[13]) ? (a1[2][0] / 7) : (18 < 77)));
+        v2 = (((v2 != 11) / 9) ? ((v3 > v3) / 2) : ((a1[1][2] && 36) == (v0 % 5)));
+        v0 = (((a1[0][15] * v0) - (v1 % 2)) && ((v2 > 74) ? (a1[3][11] >= v3) : (v0 / 6)));
+    } else {
+        a0[2] = (((60 + v1) && (v2 || a1[2][13])) != ((a0[4] == a0[4]) % 3));
+        v1 = (((80 == v0) / 4) ? ((a0[11] >= v3) ? (v0 == a0[14]) : (v1 >= 93)) : ((v1 || 86) - (v3 * v2)));
+        v1 = (((13 > v0) && (a0[5] * v0)) >= ((v2 != 29) / 2));
+    }
+    if ((((81 > v1) ? (a0[1] < a0[2]) : (v1 < v0)) / 4)) {
+        a0[11] = (((v2 * v3) <= (v1 * v2)) == ((a0[10] <= v2) ? (v2 * v3) : (v1 + v0)));
+        v3 = (((62 < a1[1][15]) / 3) ? ((14 == a0[6]) ? (a0[5] <= v1) : (a0[9] == 98)) : ((v2 + 3) / 6));
+        v2 = (((65 && 36) + (v3 || 37)) || ((62 > a1[2][13]) * (72 < a0[6])));
+    } else {
+        a0[3] = (((10 - v1) <= (v0 != v0)) || ((65 % 9) != (v0 != v0)));
+        a1[1][15] = (((a1[1][3] * v1) / 8) - ((v3 ? a1[1][5] : 43) && (35 && a0[2])));
+        a0[9] = (((v3 * v0) <= (78 < a0[6])) ? ((v2 < 18) != (v3 % 6)) : ((v2 > a1[1][7]) / 4));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[2][12] = (((a0[2] || a1[0][6]) != (v0 + a0[3])) || ((21 % 5) >= (v2 + a1[1][1])));
+            a1[0][4] = (((v3 ? v1 : i0) * (v3 ? a1[0][7] : v1)) * ((54 != 34) / 4));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((52 % 4) || (a1[1][1] == i0)) >= ((v1 > 30) || (16 <= 10)));
+                    v3 = (((v3 * v1) != (v3 ? v2 : i1)) != ((i1 / 3) <= (a0[4] * v1)));
+                    v1 = (((a1[3][6] >= a0[11]) > (56 + v3)) ? ((v2 > 37) || (a0[15] < 51)) : ((a0[7] - v1) != (a1[3][1] != 48)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v1 = (((v3 <= v3) ? (66 >= v0) : (84 <= 24)) >= ((v1 && 11) + (a0[0] && v0)));
+            v1 = (((v2 && a0[12]) + (i2 - 42)) >= ((62 < v1) ? (71 < v3) : (67 > a0[2])));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a0[15] = (((v2 || v0) > (v0 % 9)) < ((a0[1] - 31) ? (13 >= v1) : (50 && v0)));
+                    v0 = (((i3 <= 50) ? (a1[1][2] == v0) : (v3 % 4)) + ((a0[6] || i3) ? (80 ? a0[5] : 96) : (v2 && a1[1][6])));
+                    a0[15] = (((i3 && 59) * (38 + v0)) ? ((v3 > v2) >= (v2 ? v1 : a1[0][9])) : ((v2 && i3) != (89 || i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((v2 + v1) ? (v1 && 53) : (a0[12] * 48)) && ((a1[0][4] != v2) ? (v0 ? 49 : v2) : (a1[3][1] / 4)));
+}
+int f1() {
+    int v0 = 34;
+    int v1 = 45;
+    int v2 = 13;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v3 % 7) >= (45 != v3)) ? ((v2 < v1) && (a1[3][4] < v0)) : ((85 || a0[8]) >= (a0[3] % 9)));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (((a1[1][15] > 48) > (v0 && v1)) == ((v0 > v3) != (v2 <= v2)));
+        v3 = (((a0[4] ? a0[2] : v1) && (v1 / 3)) / 9);
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                if ((v2 == a0[2]) > 62) break;
+                v0 = (((i1 == i0) % 8) / 5);
+                v1 = (((10 >= v3) * (v1 && a0[5])) + ((25 < a0[10]) >= (a0[13] - a1[0][6])));
+                v0 = (((75 == 99) > (v2 % 5)) + ((63 > v3) / 5));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v0 = (((i2 < v0) * (v3 - 46)) ? ((a1[2][2] + 26) >= (v0 && v3)) : ((v2 - 22) + (77 < v3)));
+        v0 = (((i2 <= a1[2][6]) || (v2 + v3)) * ((a1[0][12] + v1) - (a0[0] % 3)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                a0[5] = (((46 * v1) >= (a1[0][4] ? v0 : v3)) ? ((75 <= 54) % 8) : ((15 || 23) >= (27 > i3)));
+                v3 = (((v0 / 9) / 2) != ((a0[1] && a0[3]) >= (i2 % 6)));
+                a0[15] = (((a0[8] > v1) >= (20 >= 95)) ? ((v3 % 2) - (2 * 93)) : ((51 > i3) % 5));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((a0[12] / 6) - (v2 <= 55)) <= ((a0[2] ? a1[0][7] : v3) / 5))) {
+        v1 = (((v3 > 37) % 5) % 2);
+        v1 = (((15 == v3) || (v0 ? v1 : 84)) < ((a0[15] + v1) ? (16 <= 71) : (65 < 94)));
+        a1[3][12] = (((a0[14] == a0[7]) <= (v0 - a0[8])) ? ((97 ? v1 : a0[14]) > (v3 == v2)) : ((v3 * a0[4]) == (a1[3][1] != v3)));
+    } else {
+        v0 = (((v0 > v0) >= (v0 + 55)) * ((v0 * 71) && (35 % 1)));
+        v3 = (((44 || 83) && (v1 * v2)) - ((a0[15] != v2) - (v1 == v2)));
+        a1[2][8] = (((a0[11] >= a0[5]) && (4 || a1[1][11])) ? ((v1 < a1[1][0]) >= (a0[4] >= a0[7])) : ((v3 != 71) >= (v2 < a1[2][10])));
+    }
+    v3 = (((84 >= 27) ? (34 >= v3) : (29 ? a1[2][4] : 5)) < ((v0 <= 87) ? (v0 || 13) : (a1[2][1] * v2)));
+    return (((40 - v0) < (v2 * v1)) >= ((22 != v0) ? (a1[3][1] / 9) : (a0[12] != v3)));
+}
+int main() {
+    return 0;
+}
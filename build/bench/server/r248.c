@@ -0,0 +1,161 @@
+int f0() {
+    int v0 = 8;
+    int v1 = 3;
+    int v2 = 11;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    a0[0] = (((a1[2][9] <= 1) || (v2 ? v2 : v2)) >= ((v0 * v1) + (32 ? v0 : 82)));
+    if ((((v2 != 66) > (v1 ? a1[1][0] : 88)) == ((a1[0][2] % 8) ? (74 < v0) : (v1 ? a0[2] : v0)))) {
+        a1[1][4] = (((31 != a0[1]) - (v0 != a1[1][10])) ? ((a1[1][5] < a1[3][7]) >= (v3 > a0[1])) : ((16 != a1[1][9]) / 6));
+        a0[8] = (((v1 == 66) * (56 - a1[1][1])) + ((v3 / 6) * (v3 == 67)));
+        a0[9] = (((v0 != a1[0][0]) - (v0 ? v0 : a1[1][0])) > ((v0 / 4) >= (v2 != v0)));
+    } else {
+        v0 = (((a1[0][2] + 93) <= (45 <= 50)) ? ((51 >= 26) > (a1[2][10] / 9)) : ((v1 && v0) - (v0 != a0[0])));
+        v0 = (((93 + 78) ? (a1[0][13] % 3) : (v3 > 60)) ? ((v0 < v2) && (v1 && a1[2][11])) : ((a0[10] ? a0[0] : v2) - (97 % 7)));
+        v3 = (((69 <= v1) - (v3 % 1)) - ((a1[1][15] <= a0[5]) - (48 <= 8)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((a1[1][7] * 77) > 85) break;
+            v2 = (((a1[2][15] == 18) ? (33 * 58) : (a0[14] || 82)) && ((40 <= v1) < (12 || i0)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((v3 < a0[6]) > 98) break;
+                v1 = (((i0 >= 34) % 4) == ((a1[2][2] / 4) ? (81 / 2) : (i1 == 74)));
+                v0 = (((a1[2][12] == v1) != (v1 || a0[8])) * ((a1[1][10] != i1) && (a0[7] && a0[2])));
+                v1 = (((63 == i0) <= (a0[13] / 3)) != ((v3 <= i0) % 1));
+            }
+            a0[8] = (((v3 > v2) < (v1 != 23)) <= ((71 < v3) < (a1[2][13] < v1)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    v2 = (((68 <= 58) == (v3 >= 9)) >= ((a1[1][2] != v0) > (v1 == v2)));
+    if ((((v1 >= 25) >= (a1[0][15] != v3)) - ((v2 || a0[15]) ? (a1[0][6] >= v2) : (v3 != v3)))) {
+        a1[2][0] = (((v1 <= v1) * (53 < v0)) < ((a0[15] ? v0 : v0) - (80 && v0)));
+        v0 = (((a0[9] <= v1) / 9) % 2);
+        v3 = (((a0[5] * v1) < (v2 >= 1)) + ((98 >= v2) % 5));
+    } else {
+        v2 = (((a0[3] < v1) * (90 ? v1 : 86)) <= ((a0[0] >= v3) == (67 + a1[2][3])));
+        v2 = (((v2 ? 76 : 32) / 8) || ((a0[1] > a1[0][14]) != (v0 - v3)));
+        a1[1][11] = (((a0[4] >= a0[13]) >= (21 % 1)) > ((v0 + v2) == (14 == a0[12])));
+    }
+    return (((3 == v1) && (v3 / 3)) / 7);
+}
+int f1() {
+    int v0 = 97;
+    int v1 = 4;
+    int v2 = 88;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][2] * v1) * (82 != v1)) < ((16 * v3) && (v2 / 5)))) {
+        a0[0] = (((v3 / 9) / 8) != ((a1[2][15] % 9) ? (v0 % 6) : (v0 / 3)));
+        v0 = (((v1 / 7) / 2) == ((v3 < 95) - (81 && 57)));
+        v0 = (((a0[4] ? 84 : v1) * (78 ? 16 : 21)) >= ((48 != a0[13]) / 8));
+    } else {
+        v0 = (((v1 <= a1[3][8]) - (a1[3][13] * 78)) == ((v1 % 2) * (a0[1] / 4)));
+        v3 = (((v1 - v0) ? (0 ? v2 : v2) : (55 < 77)) % 1);
+        v1 = (((v2 > v3) / 9) && ((v1 || v2) % 3));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((a1[2][4] - i0) > 57) break;
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                a1[1][3] = (((v1 > i1) / 1) * ((i1 + v3) >= (v0 % 2)));
+                v3 = (((v1 ? v1 : 18) <= (a0[4] - a1[1][3])) - ((a0[4] ? v3 : 20) <= (39 - v0)));
+                v1 = (((v2 >= i0) >= (a0[8] ? 81 : a1[2][10])) || ((71 >= v1) < (67 || a1[1][3])));
+                i1 = i1 + 1;
+            }
+        }
+        a1[0][4] = (((a0[5] && v0) * (v1 / 4)) > ((i0 - v0) >= (v3 - v3)));
+        v3 = (((i0 > v2) == (v2 >= v2)) ? ((v1 == 50) ? (a1[0][5] / 5) : (v1 || 52)) : ((a0[9] >= v3) * (a0[9] && v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[0][10] = (((a0[1] > a0[14]) ? (79 / 7) : (v0 != a0[0])) / 2);
+            v1 = (((v1 > v1) || (v1 > a1[2][2])) == ((v2 % 2) && (72 / 7)));
+            {
+                int i3 = 0;
+                do {
+                    if ((v1 < 21) > 74) break;
+                    v2 = (((a1[1][7] + v1) * (v2 % 9)) % 1);
+                    v0 = (((a0[8] ? 66 : v3) - (a0[9] ? v0 : v1)) + ((a1[0][15] > 34) % 2));
+                    a1[1][5] = (((a0[0] / 7) > (63 > 58)) || ((i2 != v2) * (v0 + v2)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((31 > 14) < (v2 ? a0[15] : a0[2])) > ((21 - a1[1][12]) || (v2 + v1)))) {
+        v0 = (((63 < v0) || (4 >= 72)) ? ((v0 ? a1[2][12] : 36) >= (v1 && v0)) : ((v3 < v0) + (28 > v3)));
+        v0 = (((a1[1][15] == a0[5]) * (98 >= v2)) + ((14 != v0) % 3));
+        a1[1][2] = (((a0[0] * v0) < (v0 <= a1[0][1])) < ((v0 * v3) || (75 + 40)));
+    } else {
+        a0[0] = (((v2 == v0) % 9) - ((v0 - 47) >= (a0[6] <= a0[0])));
+        a0[7] = (((a1[3][5] == v1) <= (v1 == 9)) ? ((v3 || v1) < (a1[2][2] || 75)) : ((v0 ? v1 : v2) >= (v1 / 3)));
+        a0[4] = (((a1[1][15] % 5) || (v2 != a0[3])) > ((v3 - v3) % 6));
+    }
+    if ((((v1 + 40) != (v1 * 92)) != ((v0 % 5) != (v1 ? 26 : a0[7])))) {
+        v1 = (((v3 ? v2 : 25) >= (v0 - v0)) != ((v1 * v2) < (a1[1][1] - v2)));
+        a0[3] = (((a0[1] / 2) ? (23 ? v3 : v2) : (a1[2][15] % 3)) ? ((v1 < v3) == (v3 / 3)) : ((v2 - v1) ? (81 + v3) : (a1[3][0] < a1[2][11])));
+        v3 = (((2 / 7) + (a0[3] > a0[13])) >= ((v0 && v0) - (a0[15] < a1[2][8])));
+    } else {
+        v3 = (((v2 * v2) < (v0 <= 31)) + ((v3 > a0[15]) >= (a0[13] ? v1 : v0)));
+        v1 = (((a0[1] || v0) <= (a0[4] && 73)) && ((32 && a1[3][8]) / 1));
+        v3 = (((a0[4] ? 20 : v3) || (84 * v1)) == ((41 <= v2) > (72 % 4)));
+    }
+    return (((a0[3] == a1[2][1]) != (a1[1][0] ? v0 : a0[8])) % 6);
+}
+int f2() {
+    int v0 = 51;
+    int v1 = 1;
+    int v2 = 89;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    if ((((16 * v2) <= (v3 ? 94 : a1[2][10])) != ((a1[0][3] % 4) > (17 - v2)))) {
+        v2 = (((77 && a1[2][6]) ? (39 == a1[3][1]) : (v1 * v3)) % 2);
+        a1[0][5] = (((v0 ? v2 : a1[2][15]) < (8 || a0[0])) == ((v2 != 19) ? (a1[3][4] * v0) : (v2 == v3)));
+        v0 = (((63 < v0) ? (v3 ? a0[4] : v1) : (a1[1][4] - a1[3][10])) != ((v2 == a1[0][2]) != (v0 + 92)));
+    } else {
+        v3 = (((a1[3][7] != v2) == (v2 + v2)) % 1);
+        v2 = (((a1[1][2] > 18) == (a1[0][5] && v3)) < ((v0 != v1) ? (a1[0][5] < v3) : (a1[2][6] * v2)));
+        v1 = (((v3 % 5) / 8) || ((69 % 5) * (v3 - v2)));
+    }
+    if ((((v0 == 88) ? (a1[0][0] * v0) : (v1 > 33)) + ((a1[1][12] && v0) > (v0 - v3)))) {
+        v1 = (((v3 ? v3 : a1[0][10]) + (v1 * v0)) + ((v2 ? a0[11] : v3) / 7));
+        v1 = (((v2 && v0) || (a0[2] && v2)) <= ((68 <= v2) > (a0[15] + v0)));
+        v0 = (((v2 != v0) != (a0[8] / 3)) / 9);
+    } else {
+        v1 = (((a0[15] == v3) == (a0[5] % 6)) >= ((v1 % 4) || (v0 + 15)));
+        v2 = (((a0[14] * 29) ? (4 + 2) : (v1 * v1)) && ((v0 < 89) != (71 + 53)));
+        v0 = (((v3 < a1[2][3]) - (v2 - v3)) % 9);
+    }
+    if ((((v1 || v1) || (v2 == a0[5])) / 3)) {
+        v0 = (((77 >= 95) && (v0 != 37)) == ((v1 < a1[1][14]) + (v2 + 77)));
+        a1[0][5] = (((v0 != v3) ? (v2 >= v1) : (a1[3][3] + v2)) && ((v1 < v1) - (v2 + v2)));
+        v2 = (((v3 < a0[8]) >= (v0 != v0)) % 7);
+    } else {
+        v3 = (((a0[8] == 71) + (v0 - v2)) != ((63 * 71) * (38 ? v1 : a1[2][7])));
+        a1[1][13] = (((v2 ? v1 : v0) != (a0[13] + 57)) % 5);
+        v2 = (((85 + 80) ? (a1[0][0] ? v0 : a1[0][11]) : (v0 * v2)) ? ((a1[2][12] > v1) > (v0 < v0)) : ((v3 && v0) < (v3 + a0[4])));
+    }
+    if ((((v0 * v2) % 7) >= ((v2 + v0) == (v3 % 4)))) {
+        v1 = (((v2 % 9) * (v0 != v1)) >= ((v3 - v2) % 8));
+        v1 = (((a1[2][5] % 6) != (a0[9] != v3)) ? ((27 - v1) >= (13 && v0)) : ((v0 <= a1[2][13]) || (a0[1] + v2)));
+        v0 = (((v1 || 67) - (v3 % 6)) && ((v0 >= a1[2][8]) * (v1 >= v0)));
+    } else {
+        v1 = (((a0[7] % 3) || (6 > v0)) <= ((v2 ? v2 : 97) >= (v1 ? v3 : a1[2][1])));
+        v1 = (((a1[3][1] == a1[0][13]) - (32 || 51)) - ((v2 - a1[1][14]) != (18 && a1[3][5])));
+        v3 = (((52 - 18) + (79 / 7)) / 2);
+    }
+    v0 = (((a1[0][3] && 80) + (v0 % 4)) && ((a0[7] % 8) > (v0 != a0[8])));
+    return (((90 - v0) % 8) || ((v0 % 9) == (v1 == v0)));
+}
+int main() {
+    return 0;
+}
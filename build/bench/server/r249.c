@@ -0,0 +1,42 @@
+int f0() {
+    int v0 = 54;
+    int v1 = 97;
+    int v2 = 34;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((53 / 5) >= (a0[0] / 3)) > ((v0 >= a0[4]) ? (0 * a1[0][4]) : (v2 ? v2 : 42)));
+    v3 = (((44 > v3) % 8) <= ((a1[2][10] ? v0 : v1) - (v0 && a0[4])));
+    if ((((a1[1][6] || v2) <= (64 * v2)) ? ((v0 ? 27 : 62) % 1) : ((v3 / 3) % 4))) {
+        a1[3][3] = (((v1 ? v1 : v0) + (v0 < v0)) ? ((a1[2][2] * a0[1]) / 9) : ((v0 ? 7 : v2) % 4));
+        a1[1][9] = (((7 || v2) >= (98 <= v3)) != ((13 ? a1[2][7] : a1[0][14]) % 4));
+        v1 = (((v0 % 8) ? (v2 + a0[2]) : (v3 / 9)) + ((a1[3][11] ? a1[0][0] : a0[13]) < (v0 >= 27)));
+    } else {
+        a0[12] = (((v2 >= v1) == (v1 > v0)) - ((v0 / 3) > (v2 / 9)));
+        a0[1] = (((a0[10] * 13) ? (a0[5] % 6) : (v3 <= v3)) + ((a1[2][7] * a0[3]) < (v0 <= v2)));
+        a0[5] = (((70 / 4) ? (a0[10] - v1) : (v2 ? a0[14] : a1[3][11])) - ((v3 <= 10) && (61 < v3)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            if ((i0 > a1[2][5]) > 59) break;
+            a0[9] = (((i1 && 70) <= (77 >= i1)) <= ((a1[3][3] * i0) == (v1 / 3)));
+            a1[0][1] = (((a1[0][9] == 82) < (a0[4] % 3)) != ((v2 || 53) && (63 % 8)));
+            a0[4] = (((v1 < a1[3][1]) >= (a1[2][4] || v0)) != ((a0[14] * 99) || (v0 >= v3)));
+        }
+        a0[1] = (((a0[12] * v3) ? (i0 % 4) : (a1[3][13] <= a1[3][1])) * ((83 && v0) - (i0 > v3)));
+        a0[2] = (((v3 ? v2 : v1) + (96 || v1)) * ((i0 + a1[0][15]) / 5));
+    }
+    if ((((a0[1] != v3) ? (a0[9] != a1[0][1]) : (v1 - 94)) * ((91 * a1[1][7]) ? (34 >= 76) : (v1 == 77)))) {
+        v1 = (((a1[0][4] - a1[3][11]) < (71 <= v3)) + ((v0 * a0[6]) < (v1 % 7)));
+        a1[0][3] = (((27 == v1) > (39 % 3)) < ((a0[15] != 60) < (v0 % 8)));
+        a1[1][7] = (((v3 == a1[0][7]) ? (v1 && v0) : (v0 % 2)) <= ((v3 && v3) <= (24 - v3)));
+    } else {
+        v0 = (((a0[4] < a0[12]) != (a0[4] <= 60)) >= ((35 || 27) == (v1 > v3)));
+        v2 = (((4 && 18) == (v3 && a0[1])) <= ((49 % 8) != (a1[0][7] == 15)));
+        v1 = (((v2 ? 95 : 89) + (23 / 2)) < ((95 ? v0 : 86) + (v3 / 9)));
+    }
+    return (((v3 <= a1[1][0]) <= (a0[3] / 4)) || ((a1[1][4] + a1[3][13]) + (a0[4] != v0)));
+}
+int main() {
+    return 0;
+}
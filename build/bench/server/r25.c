@@ -0,0 +1,137 @@
+int f0() {
+    int v0 = 49;
+    int v1 = 38;
+    int v2 = 14;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[12] = (((a1[3][5] + 46) % 8) <= ((v3 <= v1) + (v2 < v3)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[3][12] || 89) > 65) break;
+                    v2 = (((36 <= 88) ? (a0[15] != i0) : (36 < 7)) && ((i0 / 1) < (a1[1][3] ? a1[0][6] : 9)));
+                    v0 = (((1 * a0[8]) ? (a1[2][14] != v2) : (67 % 4)) ? ((8 ? a1[3][3] : a0[8]) || (99 == 67)) : ((v0 + 58) < (i1 != a0[2])));
+                    v2 = (((i1 + v0) <= (58 == 11)) ? ((v1 > v0) < (a1[0][4] != v0)) : ((v1 + a0[4]) && (v1 ? i1 : v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a1[2][1] = (((a1[1][0] - a0[1]) % 8) + ((73 < 37) <= (v3 ? v2 : a0[4])));
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((v2 ? a0[15] : v2) < (v0 + a0[2])) / 4);
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((a1[2][12] ? v2 : 55) / 6) >= ((a1[0][3] != i3) <= (9 / 9)));
+                    v0 = (((44 - i2) - (v0 * i3)) - ((v1 - v0) || (35 - 40)));
+                    v2 = (((v1 != a1[0][11]) >= (a0[15] && 98)) == ((v1 >= i2) * (v0 <= v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[2][0] = (((i2 ? v1 : v3) && (v2 ? v3 : 24)) / 2);
+            a1[0][6] = (((a0[15] != a1[0][10]) == (v1 || a1[0][15])) || ((a1[1][14] >= i2) - (i2 != v0)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v3 = (((a0[12] - v0) || (v3 * 3)) - ((a0[0] * v3) || (74 + i4)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a1[3][0] = (((v2 || 64) + (v3 * i4)) ? ((v1 / 3) % 2) : ((73 && v3) * (v3 <= a1[0][14])));
+                a0[10] = (((99 ? a0[8] : v1) > (30 ? 54 : a1[1][2])) && ((i5 && v2) / 4));
+                v1 = (((82 != i5) ? (a0[5] / 2) : (i5 * v0)) * ((85 || i5) % 6));
+            }
+            v1 = (((i4 >= a0[4]) % 8) - ((90 % 2) / 6));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                a1[3][8] = (((a1[0][15] != i7) >= (v1 || i6)) * ((19 == 75) || (a0[12] && a1[0][4])));
+                a1[1][7] = (((i6 >= v3) >= (v1 <= i7)) ? ((64 + 0) ? (12 <= a1[2][10]) : (v2 ? 56 : i6)) : ((v3 < i6) + (v3 != 9)));
+                v1 = (((v1 || i6) >= (90 != v3)) ? ((v3 || a0[7]) + (a1[1][3] + 34)) : ((a0[12] * 99) - (v3 < v3)));
+            }
+            v1 = (((v2 || v0) - (33 > a1[1][12])) || ((94 <= v3) ? (v0 + 31) : (13 / 5)));
+            a0[7] = (((v2 / 9) + (42 ? a0[13] : v1)) % 6);
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    return (((v3 > a0[2]) <= (a0[12] * a1[0][10])) >= ((26 != v3) || (21 > v1)));
+}
+int f1() {
+    int v0 = 41;
+    int v1 = 19;
+    int v2 = 10;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    if ((((40 ? v0 : a1[1][2]) / 4) && ((v1 && v1) == (a1[1][4] * a0[10])))) {
+        v3 = (((80 ? v1 : v1) && (v3 > 47)) % 2);
+        v2 = (((v2 ? 61 : a0[1]) - (v1 || v0)) == ((v3 && a1[2][5]) != (v1 + v0)));
+        v2 = (((a1[3][7] / 1) / 4) != ((v2 % 4) * (a0[13] % 7)));
+    } else {
+        a1[1][11] = (((v0 < v3) % 3) || ((80 != v0) == (v3 == v1)));
+        a0[5] = (((v0 * 95) == (v2 * v1)) || ((a0[14] % 1) > (v3 != a1[0][6])));
+        v2 = (((95 * a0[2]) < (a0[12] * 34)) == ((22 || v3) ? (a1[0][14] == a1[1][6]) : (v3 / 8)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v3 % 9) > 60) break;
+            v1 = (((24 != v0) == (a0[12] ? v0 : i0)) + ((i0 || 32) ? (77 % 6) : (v3 ? v2 : v2)));
+            v0 = (((v0 >= i0) && (78 > a1[2][8])) >= ((a1[0][1] ? 29 : v2) % 7));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v2 = (((a0[13] >= 6) == (90 && a0[6])) == ((v2 % 9) * (25 || v1)));
+                a0[8] = (((30 <= v2) + (a1[3][13] ? i1 : i0)) <= ((a1[3][4] / 9) % 9));
+                v1 = (((v2 > 13) != (32 + 65)) && ((v3 + i0) ? (v3 + a1[2][4]) : (a1[2][9] ? a1[2][13] : a0[7])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    a1[3][8] = (((v1 && a0[3]) >= (a0[10] / 4)) != ((a0[15] ? v1 : a0[7]) || (v1 >= 75)));
+    {
+        int i2 = 0;
+        do {
+            if ((v0 * v1) > 56) break;
+            v2 = (((3 ? v1 : v0) < (v2 + a0[12])) == ((v3 * i2) < (35 && v2)));
+            v2 = (((a1[2][10] / 3) - (18 ? a0[10] : 87)) ? ((v3 <= a0[14]) + (40 < a1[2][5])) : ((8 >= v2) || (i2 > 50)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v3 + a1[1][2]) && (79 > v2)) || ((81 == v0) == (v3 % 2)));
+                    v1 = (((5 && a0[15]) && (i3 <= a1[2][10])) || ((i2 <= i2) != (v2 + v0)));
+                    v2 = (((45 - a1[0][9]) > (82 ? 98 : a1[1][14])) ? ((a0[8] ? 58 : v3) < (a0[15] ? a1[2][0] : v1)) : ((59 - v3) * (i2 || i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((a0[2] <= 22) / 7) % 8)) {
+        v2 = (((v0 ? 89 : 24) / 9) == ((54 - 98) == (v0 <= v2)));
+        v1 = (((v0 <= a0[13]) - (53 > 38)) >= ((v3 >= v0) + (v3 >= v3)));
+        v0 = (((v2 * a0[14]) && (v3 > v1)) && ((v1 ? v1 : 35) ? (a1[0][12] ? v1 : v1) : (a0[1] % 6)));
+    } else {
+        v1 = (((v1 <= 45) && (v2 % 1)) % 5);
+        a0[12] = (((a0[7] * 40) || (v3 >= 34)) < ((v3 * a1[3][10]) == (a0[2] * v3)));
+        v0 = (((v0 == 71) <= (a0[1] <= a0[13])) * ((a1[3][8] < v1) < (34 != a0[4])));
+    }
+    return (((v3 * v2) - (v2 + a1[1][2])) ? ((a1[2][15] <= 3) == (v0 == 85)) : ((52 ? 35 : 30) % 8));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
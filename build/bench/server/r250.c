@@ -0,0 +1,111 @@
+int f0() {
+    int v0 = 85;
+    int v1 = 71;
+    int v2 = 15;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v3 == v3) >= (52 < v1)) != ((19 >= v1) > (a0[5] + v3)));
+    if ((((a0[8] != v0) >= (46 + a1[1][5])) == ((v1 ? a0[7] : v2) == (v1 >= 17)))) {
+        v0 = (((a1[1][11] - 82) || (v1 != v3)) ? ((a0[5] && 44) != (a0[13] * 85)) : ((15 % 6) - (v1 * a1[1][3])));
+        v2 = (((v0 && v3) != (27 < 25)) / 2);
+        v0 = (((v2 || v3) ? (v1 * a0[13]) : (v0 > a1[3][13])) < ((v0 / 1) * (72 >= 24)));
+    } else {
+        a1[1][7] = (((75 - v3) + (a1[2][6] * 38)) / 9);
+        v2 = (((v3 % 8) < (v1 >= v1)) || ((18 || 81) ? (v3 >= a0[2]) : (v3 - v1)));
+        v0 = (((a0[13] ? 63 : v3) / 4) + ((v1 - 57) && (a1[1][12] ? 98 : a0[5])));
+    }
+    v1 = (((v0 / 1) || (a1[0][7] * v1)) - ((72 * a1[3][9]) == (8 % 3)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((v0 > i0) > 70) break;
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            if ((a0[11] && i0) > 82) break;
+            a1[1][6] = (((a0[11] && i0) % 9) < ((a0[14] + v3) + (62 ? i1 : a0[12])));
+            v0 = (((6 != v1) % 8) >= ((19 <= a0[2]) / 6));
+            a1[0][2] = (((13 || a0[3]) ? (40 + 39) : (v1 <= v3)) != ((39 - i1) > (v3 + v1)));
+        }
+        v3 = (((40 >= v3) == (i0 <= a1[3][1])) ? ((v2 > 39) / 8) : ((77 ? a0[5] : 92) ? (v1 + 66) : (v0 ? a0[9] : i0)));
+        v1 = (((43 - v2) <= (a0[6] * v1)) + ((v1 == a0[8]) + (a0[2] % 3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((7 - 63) != (a0[13] ? 95 : 81)) >= ((v3 < 11) + (25 % 7)));
+            v3 = (((a0[9] + a1[3][3]) / 5) && ((26 != i2) < (v2 != v3)));
+            {
+                int i3 = 0;
+                do {
+                    a0[9] = (((a0[14] || i2) <= (90 >= i3)) != ((v0 ? v2 : 41) > (i3 || 29)));
+                    a0[2] = (((96 % 6) && (a1[1][11] == a0[15])) <= ((v3 == 32) < (i3 != 85)));
+                    a0[15] = (((v0 > 37) || (a1[1][11] == v0)) > ((v3 == 61) != (v0 > 70)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    return (((v2 / 5) && (v0 ? a1[2][1] : 80)) ? ((v1 > v1) - (v0 < v2)) : ((64 - v0) + (v0 ? a0[0] : 70)));
+}
+int f1() {
+    int v0 = 11;
+    int v1 = 57;
+    int v2 = 57;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[3] - v0) > (v2 - 99)) / 4)) {
+        v1 = (((v1 + v3) ? (16 + v0) : (v2 / 3)) != ((v3 + a1[0][5]) + (v2 + 58)));
+        v1 = (((v2 * v0) ? (v3 ? a0[14] : v3) : (v0 ? v1 : a1[1][12])) ? ((28 <= a0[11]) - (v2 && a0[7])) : ((72 - v3) - (32 % 1)));
+        a0[11] = (((15 ? v0 : v1) % 5) == ((a1[0][10] / 9) == (a0[13] - v3)));
+    } else {
+        a1[1][12] = (((v1 <= 66) + (v2 == a1[2][3])) == ((a1[0][8] || v1) && (a1[2][12] || v3)));
+        a0[3] = (((v3 - v3) != (v3 > v2)) > ((34 ? v0 : a1[3][1]) % 6));
+        a0[14] = (((61 <= 2) * (v1 && 6)) ? ((v2 && v1) / 7) : ((v3 == 1) || (86 >= 58)));
+    }
+    if ((((v2 && a1[1][10]) ? (v2 && 26) : (39 - 29)) > ((a0[7] / 5) - (a1[3][7] / 7)))) {
+        v2 = (((v3 / 6) != (v2 <= v0)) == ((80 ? v0 : 33) && (a0[4] * 38)));
+        v2 = (((v2 / 3) != (37 ? v3 : v3)) - ((v2 * v3) * (a1[0][5] != 61)));
+        a0[10] = (((v1 != v1) % 9) != ((65 * a0[15]) && (19 == a1[3][2])));
+    } else {
+        v0 = (((v2 + v1) <= (v0 ? v0 : 85)) != ((v1 ? v3 : v1) == (61 / 1)));
+        v1 = (((v2 <= v1) > (v1 / 8)) / 5);
+        v2 = (((v3 || v0) ? (v1 != a1[2][14]) : (v2 != v1)) - ((v1 <= a0[8]) >= (a1[3][4] ? v1 : v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((v1 + a0[12]) > 50) break;
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((81 == a1[1][9]) > 74) break;
+                v0 = (((v0 + i1) + (a1[1][9] || a1[2][2])) > ((29 == a1[1][0]) == (i0 || 75)));
+                a0[2] = (((v1 * a0[11]) <= (i0 ? i0 : i0)) && ((62 && i0) && (a0[5] == 25)));
+                a0[4] = (((v2 != a0[9]) && (a1[2][15] ? 48 : v0)) || ((25 || v1) < (79 > 24)));
+            }
+            a0[3] = (((v0 <= v2) || (i0 ? v0 : a1[0][15])) / 1);
+            v0 = (((v0 - a1[3][8]) < (v1 > a0[4])) % 8);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((85 - a1[0][11]) != (a0[6] >= v1)) - ((a1[2][14] / 9) < (a0[12] != v1)))) {
+        v1 = (((v1 || a1[3][12]) ? (v0 ? v0 : v1) : (a0[2] > a0[5])) < ((73 <= v1) <= (v0 > v1)));
+        v0 = (((99 || a1[1][6]) ? (a1[3][14] + 70) : (v3 % 7)) == ((a1[2][6] >= v0) != (v3 == a1[1][15])));
+        v1 = (((38 >= v2) <= (2 * a1[2][4])) - ((a0[8] / 3) < (a1[1][11] > a1[2][9])));
+    } else {
+        v3 = (((v2 && v2) / 7) > ((v0 >= a1[2][1]) - (26 <= a1[3][5])));
+        v0 = (((47 ? 7 : 19) - (93 ? a1[1][1] : 17)) != ((v0 + 47) * (v1 % 8)));
+        v2 = (((v0 / 1) <= (v0 || v0)) ? ((a0[0] * a1[0][11]) < (v0 && v0)) : ((v1 != 19) * (4 || v2)));
+    }
+    if ((((v3 / 9) || (a0[11] + v1)) != ((a0[9] ? a1[1][9] : 58) || (88 ? 0 : a1[2][8])))) {
+        a0[13] = (((v2 - v0) * (3 == a1[0][7])) - ((a1[2][8] <= 60) != (32 / 6)));
+        v2 = (((91 == 27) || (a1[2][11] ? v1 : v2)) <= ((a0[1] * 89) || (v1 >= 96)));
+        v1 = (((31 <= a0[13]) <= (a0[9] / 4)) ? ((v3 > v1) != (27 - v3)) : ((v3 && v2) ? (v3 ? a0[13] : v2) : (a1[3][0] + 59)));
+    } else {
+        v2 = (((73 % 6) != (a0[10] % 3)) ? ((v2 < 14) / 1) : ((93 ? v3 : 64) % 3));
+        a0[11] = (((v2 || a1[2][2]) * (v0 >= 36)) / 2);
+        a0[5] = (((a1[2][14] || a1[1][8]) == (21 ? v3 : v2)) * ((a1[0][6] && 92) && (a1[3][9] ? a1[3][15] : v2)));
+    }
+    return (((4 - v3) % 8) == ((a1[2][6] % 6) >= (a0[0] != v2)));
+}
+int main() {
+    return 0;
+}
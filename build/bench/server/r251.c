@@ -0,0 +1,146 @@
+int f0() {
+    int v0 = 75;
+    int v1 = 22;
+    int v2 = 74;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[12] = (((v1 / 7) % 7) && ((v0 > 93) <= (v0 % 9)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v2 = (((v2 * i0) != (v2 % 2)) < ((0 % 5) % 5));
+                    v2 = (((85 % 5) <= (v3 * 49)) ? ((a0[9] >= 97) ? (v0 <= i0) : (a0[6] * a0[7])) : ((a0[5] - a1[3][11]) || (v1 == 53)));
+                    v0 = (((v1 % 6) - (a1[1][1] * a0[8])) - ((v3 != v1) != (11 % 9)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((99 / 8) <= (1 ? a1[1][1] : v1)) >= ((a0[13] - v0) <= (v2 ? v3 : v3)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((a1[3][5] || 21) < (v2 != a0[8])) % 3)) {
+        v1 = (((a0[7] == v2) >= (82 != v3)) >= ((v0 / 4) && (a1[2][7] == 98)));
+        v3 = (((a0[8] < v0) > (47 ? v0 : 83)) >= ((13 && 56) <= (a1[3][2] * 39)));
+        v3 = (((v0 != 98) && (18 >= 62)) || ((v2 < 47) > (53 >= a0[2])));
+    } else {
+        v3 = (((63 < v3) ? (v3 < v0) : (64 != a0[12])) >= ((a0[2] % 6) > (v0 < v2)));
+        v0 = (((v2 == v2) + (a0[4] / 9)) ? ((v3 < v1) % 1) : ((a1[3][5] ? a0[7] : 5) ? (v0 < 26) : (v3 >= a0[2])));
+        a0[4] = (((4 == 87) - (35 - v1)) % 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[2] ? v1 : i2) > 58) break;
+            a1[3][13] = (((64 % 1) + (i2 - i2)) == ((a0[6] == 6) >= (a1[2][13] ? 86 : a1[1][11])));
+            a0[8] = (((a0[5] > i2) * (52 ? v1 : a1[2][6])) || ((a0[2] % 1) * (a0[5] > 84)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((i3 * i2) < (a1[3][4] != i3)) ? ((94 + a0[10]) || (a1[0][2] + i3)) : ((51 || a0[9]) > (57 < v0)));
+                v2 = (((a0[7] <= 51) == (99 * i3)) * ((63 < i2) || (i2 / 2)));
+                v1 = (((7 || a0[5]) == (i3 < 86)) % 2);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((a0[2] ? v3 : v3) == (13 + v2)) + ((v3 > a1[1][5]) <= (v0 > v1)))) {
+        a1[1][6] = (((a0[2] ? 60 : 10) - (46 < v0)) != ((a1[1][8] || v0) ? (a1[2][15] + v0) : (v2 ? 29 : a0[12])));
+        a0[13] = (((v3 || v3) < (a1[1][4] || 30)) || ((v0 != 27) == (83 || 58)));
+        a1[3][15] = (((v2 == v3) == (v3 ? v2 : v1)) ? ((v3 ? a0[8] : 55) ? (v2 < 21) : (a0[7] + v1)) : ((v0 <= a0[0]) ? (v0 + a1[2][7]) : (a1[0][15] && a0[9])));
+    } else {
+        v1 = (((v3 % 7) > (61 && 95)) / 1);
+        v1 = (((v3 + 5) || (v1 > 66)) ? ((v1 || v1) == (v0 <= a1[3][9])) : ((v3 / 9) == (v1 ? a0[4] : v3)));
+        a1[0][2] = (((v3 > v1) == (79 ? v2 : v2)) ? ((v3 >= v2) > (29 == v0)) : ((v2 == v0) != (a1[2][10] < v1)));
+    }
+    a0[2] = (((v3 >= v0) ? (42 > 36) : (38 * 6)) == ((a0[0] < v3) ? (a0[11] ? 52 : 18) : (a1[1][8] ? 66 : v1)));
+    return (((26 ? 7 : 31) >= (86 >= a1[1][4])) ? ((v2 * v2) <= (a1[1][14] % 9)) : ((a1[2][0] >= v3) != (v3 / 7)));
+}
+int f1() {
+    int v0 = 98;
+    int v1 = 48;
+    int v2 = 91;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a1[2][12] ? v1 : a1[0][11]) || (v1 || v3)) * ((v3 != 21) != (v2 < 66)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a0[3] = (((i0 / 5) <= (v2 < a1[1][14])) || ((a1[1][9] != v3) && (v0 == a1[1][2])));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a1[1][14] = (((i0 % 4) ? (v2 ? i0 : a0[4]) : (v3 % 8)) % 2);
+                a1[2][4] = (((a1[1][5] - 31) / 1) > ((i1 / 2) || (i0 + 47)));
+                v3 = (((v1 || v2) + (v2 ? a0[11] : a0[3])) >= ((i0 ? 8 : i1) ? (a1[1][5] ? a1[2][9] : v2) : (i0 > 46)));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((59 % 3) == (v0 <= 53)) && ((a1[0][4] * v2) != (13 ? a1[0][2] : i0)));
+    }
+    a0[8] = (((v1 > v1) || (a1[2][9] + v0)) <= ((76 > a1[3][9]) > (a0[2] % 3)));
+    if ((((58 + v2) > (68 + a1[2][10])) % 3)) {
+        v0 = (((v2 * v0) * (v2 - v1)) == ((v3 * v3) != (v3 < a1[0][10])));
+        a0[2] = (((v0 == v3) ? (66 + 14) : (76 == v0)) ? ((v1 / 3) > (v1 < v0)) : ((a0[1] ? v2 : v2) + (v3 != 83)));
+        a1[2][1] = (((v2 != a1[3][13]) > (91 || 78)) >= ((61 != v0) == (v2 ? v1 : 21)));
+    } else {
+        a0[14] = (((a0[12] < 90) < (v2 || 54)) - ((a0[11] + a1[2][5]) + (v2 ? v0 : v2)));
+        a0[5] = (((97 == a1[1][10]) > (v1 * v3)) + ((v1 ? v1 : 95) ? (a1[0][14] < 68) : (a0[14] + v3)));
+        v1 = (((v0 >= v3) % 7) == ((a0[1] != 37) / 7));
+    }
+    if ((((a0[8] * v0) == (v3 - v3)) || ((77 ? v3 : v3) - (v0 == a1[3][1])))) {
+        a1[1][13] = (((a0[6] % 2) - (v1 > a1[0][3])) - ((v2 - v1) == (4 - v2)));
+        v1 = (((v3 ? v2 : 46) ? (52 || v0) : (v1 ? 57 : a0[7])) ? ((a1[3][12] ? v2 : a1[3][5]) || (a1[2][0] - v1)) : ((v0 || 44) - (v3 || 54)));
+        v0 = (((v1 && v3) / 5) ? ((v3 && a0[3]) > (v3 <= v2)) : ((56 < 5) / 1));
+    } else {
+        v3 = (((v3 * 14) != (v2 / 5)) != ((55 <= 13) > (a0[13] <= 92)));
+        v3 = (((a0[13] && v0) == (v0 - a1[3][12])) % 1);
+        v2 = (((a0[5] && 97) / 5) / 4);
+    }
+    return (((v1 - v0) ? (68 * a1[0][10]) : (v3 || a0[6])) <= ((v0 - a1[0][3]) != (a1[1][0] / 7)));
+}
+int f2() {
+    int v0 = 42;
+    int v1 = 4;
+    int v2 = 11;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    a1[3][1] = (((a1[2][1] + v3) && (a0[3] >= v1)) && ((v2 != a0[9]) + (v0 || v3)));
+    if ((((a0[9] && 35) ? (v0 + v0) : (21 && 65)) ? ((a0[8] > v0) || (64 % 3)) : ((v2 * a1[2][11]) % 1))) {
+        a1[2][13] = (((a1[1][1] <= 14) || (v1 >= v3)) + ((89 > v1) % 9));
+        v2 = (((v2 == a0[7]) - (v3 > v0)) < ((53 > 16) > (v0 - a1[1][7])));
+        v1 = (((v0 + v0) <= (a0[7] % 3)) >= ((22 >= v0) != (15 != a0[7])));
+    } else {
+        v0 = (((v2 + v1) ? (v0 / 2) : (54 / 1)) / 4);
+        a0[6] = (((v2 == v3) >= (v3 >= 41)) || ((a0[7] != v0) != (v2 >= 76)));
+        v0 = (((v1 >= 8) || (a0[14] - 32)) ? ((v0 || a0[0]) ? (a1[2][1] * 0) : (v1 < v3)) : ((v2 ? v3 : v0) != (v0 == 2)));
+    }
+    if ((((v1 ? v0 : v0) / 2) == ((v2 && 95) && (72 > v3)))) {
+        v2 = (((v3 ? v1 : 5) ? (a1[1][8] * v3) : (v3 ? v0 : v2)) == ((61 > a0[3]) && (a0[7] ? a1[2][12] : v1)));
+        a0[3] = (((a0[8] / 9) > (v3 != 99)) * ((39 > 11) <= (v1 % 7)));
+        v1 = (((a0[2] * 34) / 1) / 3);
+    } else {
+        v2 = (((v0 ? a0[6] : v1) * (16 / 1)) != ((v1 != a0[8]) > (v0 > v1)));
+        v0 = (((v1 - a0[2]) + (a0[13] != v3)) % 9);
+        v3 = (((a0[11] % 1) < (a1[1][8] ? 73 : a1[2][7])) / 5);
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v1 || a0[8]) * (47 >= 41)) > ((a1[1][10] > 12) % 5));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v2 = (((i0 > v0) <= (a0[10] ? a0[2] : a0[14])) && ((46 % 3) >= (65 - v3)));
+                v1 = (((a1[0][9] / 8) >= (v2 ? v2 : v0)) == ((i1 ? v2 : a1[2][4]) == (i0 + v0)));
+                a0[7] = (((38 != v0) <= (v0 ? 25 : 8)) < ((i0 > a0[2]) - (2 || a1[3][8])));
+            }
+            a1[1][11] = (((v0 > v3) % 7) - ((v0 * v1) > (94 / 8)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    v1 = (((v2 % 8) != (64 ? 12 : a1[0][1])) ? ((20 ? v2 : v0) ? (v3 < v3) : (14 >= v2)) : ((v0 - v2) - (6 != a1[3][4])));
+    return (((v0 ? a1[1][6] : a0[15]) == (v1 >= v3)) - ((98 < v2) && (v3 % 5)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,75 @@
+int f0() {
+    int v0 = 71;
+    int v1 = 53;
+    int v2 = 78;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a0[8] = (((a1[1][13] != v1) == (a0[11] > v0)) < ((v2 || v2) + (a0[8] <= v1)));
+                v0 = (((v0 ? a0[6] : 45) == (v1 > a0[0])) < ((a1[1][2] >= 38) != (a0[14] / 6)));
+                v3 = (((v1 && a0[1]) >= (i1 % 9)) / 5);
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((a1[2][2] / 4) || (a1[3][15] >= a1[3][14])) != ((29 != i0) || (77 <= a0[14])));
+        a0[8] = (((3 ? a1[1][0] : 55) ? (v1 && v0) : (50 + a1[3][1])) >= ((29 % 7) || (v3 + v2)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v1 = (((i2 || i2) <= (99 || 10)) - ((v3 >= 22) >= (72 < v2)));
+        v3 = (((a0[12] * v2) != (5 / 2)) * ((v2 < v1) >= (33 <= 55)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((v1 > a1[1][8]) != (44 != 52)) + ((v1 || a1[3][7]) * (i2 ? v2 : i2)));
+                v3 = (((a1[3][0] < a1[0][11]) >= (a1[1][0] ? v1 : i3)) + ((i3 ? v2 : v1) - (v2 > v2)));
+                v2 = (((v2 <= v3) < (v0 - 9)) > ((i3 != i3) % 8));
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+    }
+    if ((((a1[1][10] - a0[6]) > (30 / 3)) || ((v2 <= a1[2][0]) > (64 == v3)))) {
+        a1[1][7] = (((91 % 8) <= (v1 >= a1[3][4])) == ((73 ? v0 : v0) - (v3 && v2)));
+        a0[12] = (((32 % 8) != (v2 != a1[3][10])) > ((v2 >= v2) - (v0 == a1[0][1])));
+        v0 = (((v0 <= v3) * (22 == v0)) == ((v3 || v2) + (v3 < v0)));
+    } else {
+        v2 = (((v3 ? v0 : v1) % 5) + ((v0 ? 1 : 12) - (v0 == 65)));
+        v1 = (((v2 * 54) ? (v2 / 6) : (a0[11] * v3)) == ((v0 < a1[1][11]) + (a1[2][3] * v3)));
+        v1 = (((v0 == a0[8]) >= (v3 == v1)) ? ((a0[12] - v3) ? (v3 == a1[0][14]) : (93 / 4)) : ((24 < v2) - (v2 > v0)));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        a1[3][8] = (((v2 >= 93) >= (v1 - a1[0][14])) ? ((23 % 8) || (a1[3][12] != i4)) : ((v3 / 5) ? (v2 + 22) : (14 != v1)));
+        a0[9] = (((a1[1][7] % 3) ? (42 / 4) : (v1 + a1[3][14])) * ((v1 + v2) != (a0[10] % 4)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            if ((a0[6] != v1) > 81) break;
+            v1 = (((v0 % 9) > (v3 || i4)) % 6);
+            v1 = (((43 == v2) && (a1[0][15] - i5)) + ((65 > 4) && (10 && a1[0][1])));
+            v0 = (((69 >= a1[0][14]) % 3) / 1);
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                do {
+                    if ((80 || v3) > 94) break;
+                    v2 = (((24 <= v2) ? (45 * a1[2][5]) : (v2 >= 61)) - ((i7 && a0[11]) > (v1 == 11)));
+                    v0 = (((i6 && a1[2][5]) - (v0 && v3)) ? ((80 > i6) ? (v2 <= 24) : (a1[0][11] && i7)) : ((a0[9] + a0[1]) != (a0[15] - v0)));
+                    v1 = (((v3 / 5) > (v0 - v2)) - ((i7 + a1[0][14]) || (v2 ? 94 : v3)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            a1[1][1] = (((a1[2][2] && i6) >= (78 - v3)) + ((a1[3][1] < a0[15]) <= (a1[1][12] && v0)));
+            a1[0][4] = (((a0[2] < v3) / 4) < ((a0[4] ? v0 : 68) <= (v1 - i6)));
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((v0 < v2) && (v1 >= v3)) ? ((v3 ? a0[8] : 50) <= (v0 / 1)) : ((a1[1][13] ? 88 : 53) / 2));
+}
+int main() {
+    return 0;
+}
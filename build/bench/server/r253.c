@@ -0,0 +1,101 @@
+int f0() {
+    int v0 = 46;
+    int v1 = 53;
+    int v2 = 6;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    a1[0][12] = (((78 ? v2 : v2) + (v3 > v0)) < ((a0[11] ? 21 : a1[2][6]) && (14 - v3)));
+    if ((((v2 ? a0[2] : v2) / 1) <= ((3 > v1) == (a1[1][10] <= v0)))) {
+        v2 = (((v2 == v2) + (v1 * 24)) && ((v3 || 46) < (66 - v0)));
+        a1[3][1] = (((v2 || a1[2][7]) ? (v3 == 20) : (v1 * 41)) % 1);
+        v3 = (((a0[13] >= v2) > (v2 <= v1)) * ((40 || v1) != (46 > a0[5])));
+    } else {
+        v1 = (((55 != v0) % 7) >= ((30 <= a1[1][1]) / 3));
+        v3 = (((v3 - v3) % 6) && ((a0[5] ? v2 : 96) != (v2 && v3)));
+        v1 = (((v3 > v0) ? (v2 != v0) : (v1 ? 82 : v2)) ? ((v0 / 8) < (v0 > v1)) : ((v3 + v1) != (a0[4] * 14)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((15 != v0) > 77) break;
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((47 + i1) > (v2 > 77)) && ((a0[0] < 27) >= (a0[6] != v1)));
+                v2 = (((a1[0][4] >= i0) % 7) ? ((v1 != v0) / 1) : ((6 + v1) < (i1 ? v0 : 72)));
+                v0 = (((a1[1][15] ? v1 : 77) && (v2 > a0[7])) + ((v0 < 3) * (i1 <= v3)));
+            }
+            v3 = (((a1[0][6] >= v3) * (a1[1][10] * v1)) / 2);
+            v1 = (((v3 + v0) + (98 < v3)) > ((v3 * a0[15]) * (a1[0][12] / 9)));
+            i0 = i0 + 1;
+        }
+    }
+    a1[0][8] = (((v3 / 4) < (v3 == v1)) == ((v3 - a1[2][12]) - (v0 ? v1 : a0[10])));
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((v0 && v3) > 76) break;
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((79 % 2) % 9) >= ((i2 > a0[14]) == (v3 <= i2)));
+                    v1 = (((v0 >= 13) >= (90 > 56)) && ((a1[3][14] == v2) % 7));
+                    a0[8] = (((v0 / 8) * (v1 ? 47 : v0)) % 1);
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v1 = (((a0[11] <= i2) < (i2 != i2)) ? ((61 ? v1 : v2) && (i2 >= v1)) : ((a1[3][0] >= v3) ? (v0 - 74) : (v3 >= v2)));
+            a1[3][5] = (((76 - v1) && (v1 + v0)) % 6);
+            i2 = i2 + 1;
+        }
+    }
+    return (((v1 >= a0[0]) <= (v0 / 2)) / 6);
+}
+int f1() {
+    int v0 = 31;
+    int v1 = 95;
+    int v2 = 86;
+    int v3 = 54;
+    int a0[16];
+    int a1[4][16];
+    if ((((86 - 23) / 1) || ((a1[3][10] * 21) % 4))) {
+        a1[3][15] = (((v1 + v1) / 4) % 4);
+        a1[1][11] = (((a1[0][0] ? v0 : v2) == (v3 + v1)) <= ((v2 || a0[12]) != (v3 + 13)));
+        v3 = (((v1 ? v0 : a1[2][10]) < (v3 % 4)) / 7);
+    } else {
+        v3 = (((v1 ? v1 : v2) - (v0 - v0)) != ((v3 < a1[1][15]) / 7));
+        v2 = (((v3 * v0) > (a1[0][8] + a1[0][9])) ? ((v0 && a1[1][12]) == (97 ? a0[9] : 75)) : ((a0[3] / 5) % 6));
+        v3 = (((v2 ? v2 : v1) != (v1 > a1[2][10])) - ((v3 ? 87 : v3) && (a0[14] - a0[14])));
+    }
+    if ((((v0 % 7) > (16 ? v1 : v0)) % 7)) {
+        v3 = (((v3 ? 75 : 39) != (a0[2] && a1[3][12])) == ((85 - 90) == (v2 > a1[3][5])));
+        v0 = (((v3 + 22) && (3 + a1[3][13])) == ((v1 > v2) > (78 / 3)));
+        a0[3] = (((v2 / 3) + (v0 % 9)) ? ((a1[2][14] == 65) / 6) : ((v1 >= a1[1][4]) / 9));
+    } else {
+        v1 = (((a1[3][1] ? a0[5] : v2) + (v3 * v1)) * ((v1 > 52) ? (80 < v2) : (v3 ? 19 : 21)));
+        a1[2][12] = (((92 < v2) * (v0 * v2)) < ((96 + 86) % 4));
+        a1[3][2] = (((a0[4] ? v1 : v3) + (v0 % 6)) - ((8 + v2) && (a0[2] + 52)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v3 = (((a0[15] != v0) / 1) || ((v0 > 84) > (i0 ? 29 : v3)));
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            a0[5] = (((34 % 6) && (i0 && v1)) ? ((i0 * 16) <= (i0 && a0[13])) : ((a1[3][4] ? v0 : v0) != (a0[2] >= i1)));
+            v0 = (((v2 >= 33) ? (a1[1][14] == i0) : (52 > i0)) == ((a1[3][14] ? i1 : 96) == (v2 == 37)));
+            v3 = (((a0[9] <= v1) != (27 % 7)) % 6);
+        }
+        v2 = (((72 - a1[0][5]) && (v3 + i0)) > ((71 ? a0[12] : v1) >= (v3 * a0[7])));
+    }
+    v3 = (((v1 > v1) - (v1 ? v0 : 88)) ? ((v1 != a1[0][1]) >= (a1[2][3] && v1)) : ((6 - 47) ? (a0[11] / 6) : (v1 < v3)));
+    if ((((v0 ? v3 : a0[4]) + (v3 && v3)) >= ((a0[1] + v3) != (v2 && v0)))) {
+        v2 = (((a0[4] == v3) ? (a0[6] ? 68 : v2) : (55 / 6)) ? ((68 > v2) % 2) : ((v0 <= v2) != (a1[1][12] || v1)));
+        a0[8] = (((v3 / 9) < (a0[3] * v0)) < ((56 ? a0[9] : v1) > (a1[3][0] * 55)));
+        a0[0] = (((v2 == 30) / 9) <= ((v0 ? v3 : 42) * (a1[0][2] < 52)));
+    } else {
+        a0[2] = (((49 / 6) - (v0 != 69)) || ((8 - a1[3][1]) && (v0 % 1)));
+        v1 = (((v2 && 76) % 9) - ((v3 > v3) < (v1 <= 97)));
+        v0 = (((v1 < v2) ? (78 <= 10) : (v3 != v2)) || ((a0[3] ? a0[5] : v1) || (7 == v3)));
+    }
+    return (((a1[1][15] ? v3 : 67) || (72 * v2)) || ((v2 ? v2 : a0[11]) < (96 >= v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,160 @@
+int f0() {
+    int v0 = 79;
+    int v1 = 53;
+    int v2 = 95;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 ? a0[12] : a1[2][4]) && (92 * v0)) != ((v3 + v0) || (v0 == v0)))) {
+        v0 = (((v2 <= v1) >= (a1[1][4] ? a0[7] : v2)) || ((v1 && v1) || (a1[1][15] ? v3 : v2)));
+        a1[0][15] = (((69 <= v1) ? (v0 > v3) : (v1 - v0)) + ((v2 % 5) ? (a1[0][2] ? v1 : 46) : (98 - v1)));
+        v2 = (((a1[1][0] < 89) || (v0 && v1)) % 5);
+    } else {
+        v1 = (((v2 / 7) == (a0[10] != v1)) && ((v0 ? a0[13] : 94) > (v2 - v0)));
+        v3 = (((v0 == a0[15]) / 9) ? ((54 != v1) || (a1[0][0] != v0)) : ((5 - 33) < (v0 * 82)));
+        v2 = (((a0[14] ? a1[0][12] : v3) / 2) % 3);
+    }
+    a0[11] = (((a1[2][11] ? a1[3][11] : a0[4]) || (33 + a0[2])) / 9);
+    if ((((v1 > 31) != (29 && 50)) > ((v0 / 6) - (a1[0][8] < a1[3][7])))) {
+        a1[2][15] = (((v0 > 74) - (v1 / 6)) % 4);
+        a1[0][15] = (((a0[2] || v2) > (a1[3][9] > a0[8])) || ((v0 - a0[15]) * (v2 ? a1[3][4] : v0)));
+        v1 = (((v3 && v3) >= (53 * a1[0][5])) >= ((58 ? v0 : a1[1][4]) && (v3 == 56)));
+    } else {
+        a0[8] = (((v1 <= v3) ? (v3 > v2) : (v1 * a0[15])) >= ((v3 + 47) - (v2 % 6)));
+        a0[12] = (((v2 < v3) ? (v2 > 68) : (v0 * v3)) > ((92 == 3) > (v3 != a0[13])));
+        v1 = (((v0 ? v2 : 10) % 2) * ((a1[2][4] + v0) && (a0[9] > a0[11])));
+    }
+    a1[2][11] = (((89 * a0[4]) > (v3 > v1)) <= ((v3 + a1[2][9]) - (a0[12] || 2)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a1[0][13] = (((1 < i0) <= (a1[0][15] * v1)) - ((v3 || 35) <= (a1[0][7] <= v3)));
+        v3 = (((i0 && a1[0][2]) && (v1 != v2)) <= ((v3 ? 8 : v0) < (a0[6] * i0)));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v1 = (((7 <= a1[3][5]) || (5 - a1[2][8])) + ((v3 + i1) % 4));
+            a1[2][10] = (((68 ? i1 : v3) + (i1 + a1[3][14])) || ((a1[2][7] && i0) && (v3 / 1)));
+            v0 = (((53 < i0) < (v1 > a1[3][9])) > ((v0 + v3) % 1));
+        }
+    }
+    return (((a1[3][14] == v0) < (v1 > 15)) - ((a0[5] >= a0[11]) && (v1 + v1)));
+}
+int f1() {
+    int v0 = 78;
+    int v1 = 56;
+    int v2 = 81;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a0[9] = (((68 > v2) / 8) && ((v3 ? a1[2][11] : i0) && (71 && a0[10])));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((i0 ? i0 : 17) > 96) break;
+                a0[3] = (((i1 && v2) > (a0[5] == v3)) && ((i1 > v1) - (v1 >= a0[7])));
+                v2 = (((v3 % 3) && (v0 || i1)) <= ((2 * i1) - (i0 + 54)));
+                v0 = (((v2 && v1) ? (a1[0][15] + i1) : (v2 >= a0[14])) % 8);
+            }
+            v3 = (((a1[1][2] ? 87 : a0[13]) > (v3 + v0)) ? ((v2 - v1) <= (v0 > a0[13])) : ((a1[0][10] < a0[12]) < (v2 * a0[12])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 < a1[1][6]) + (a1[3][12] && a1[3][9])) < ((v2 + v0) / 8))) {
+        a1[3][2] = (((16 == a1[2][14]) <= (v3 + v1)) + ((v1 + v3) > (a0[15] >= v0)));
+        a1[1][7] = (((69 != v0) >= (v1 > 22)) + ((v3 ? v3 : a0[12]) >= (a0[9] != 2)));
+        v2 = (((4 || v2) ? (12 ? v1 : a1[2][12]) : (29 < a1[0][9])) < ((v2 <= 31) * (22 / 5)));
+    } else {
+        v2 = (((a1[3][13] || v3) <= (a1[1][0] % 2)) + ((55 ? v1 : v3) != (40 || v1)));
+        v3 = (((6 ? v2 : a1[1][3]) % 2) > ((v2 || v3) && (v2 >= 59)));
+        v0 = (((v0 * v0) / 2) >= ((a0[14] - v0) ? (93 || 86) : (a1[0][8] % 4)));
+    }
+    if ((((v1 * v0) || (v1 + v2)) + ((v2 >= v2) || (a1[1][4] % 4)))) {
+        a0[15] = (((a1[2][13] >= 11) <= (41 > v1)) != ((v1 * v2) != (7 + a1[1][10])));
+        v3 = (((9 - a0[3]) >= (v3 - v2)) ? ((v2 || 63) ? (v0 || v1) : (a0[14] && v3)) : ((v1 / 7) > (v0 >= 23)));
+        a0[9] = (((v0 == 32) < (a0[1] != v0)) && ((81 >= v2) != (a0[10] >= 71)));
+    } else {
+        v1 = (((v2 ? v1 : 44) || (19 % 7)) != ((10 / 3) <= (v3 == v0)));
+        a0[1] = (((87 || a1[2][11]) * (72 % 8)) != ((v1 && 53) <= (42 || 63)));
+        v0 = (((v0 ? 52 : 62) > (v1 * 60)) && ((v3 < 42) && (32 + a0[12])));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((a0[14] < 44) > 55) break;
+        a1[2][0] = (((i2 >= v2) >= (24 || a1[3][1])) == ((v0 != 64) % 1));
+        v1 = (((v1 && v0) * (v0 ? v1 : v2)) == ((v1 + v1) != (v1 > v3)));
+        {
+            int i3 = 0;
+            do {
+                if ((i2 < a1[2][13]) > 54) break;
+                v0 = (((88 + v2) && (i3 != v2)) >= ((58 >= v2) || (a0[5] ? a1[2][12] : i3)));
+                a1[2][8] = (((18 < v0) == (v2 || a1[2][7])) ? ((a0[11] != i3) < (56 > 74)) : ((v3 <= 12) > (v2 || a1[1][3])));
+                v0 = (((v0 < v1) % 7) * ((18 < 28) == (a0[11] == v1)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v0 = (((v3 <= i4) > (i4 < 34)) % 7);
+            v1 = (((a0[2] / 1) != (v2 + a0[4])) == ((a1[2][6] < v2) == (40 * i4)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((50 * a1[1][3]) % 8) ? ((a0[12] ? v3 : i5) < (5 == 31)) : ((i5 ? v0 : a0[9]) && (i5 ? v1 : i5)));
+                    v3 = (((45 / 9) ? (a0[6] - i4) : (i4 || v0)) ? ((a0[11] ? 11 : a1[3][8]) < (a0[5] && v1)) : ((a0[6] / 2) / 6));
+                    v1 = (((a0[8] ? v3 : v1) * (v3 >= v2)) < ((i4 < a0[12]) ? (i5 - 44) : (76 ? 84 : a0[0])));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 ? 18 : a1[0][14]) / 5) / 9);
+}
+int f2() {
+    int v0 = 31;
+    int v1 = 64;
+    int v2 = 78;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 / 7) && (91 >= 50)) + ((a0[10] ? v0 : 52) * (v0 + v1)));
+    v3 = (((a1[3][5] % 4) ? (v0 + v0) : (45 || 21)) && ((1 ? v1 : v3) ? (39 - 35) : (69 && a0[15])));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v3 = (((14 / 5) != (v0 < 64)) ? ((v1 <= 4) == (v2 <= v3)) : ((a1[1][13] * 4) || (v2 && a1[2][14])));
+                    v3 = (((a0[3] * v0) * (i0 >= a1[3][14])) ? ((i0 == 97) / 5) : ((3 < 57) ? (v2 / 5) : (i1 ? i0 : a1[0][7])));
+                    a1[2][10] = (((a1[1][15] ? 6 : v1) || (58 != a1[1][14])) / 8);
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v1 && 9) - (v3 / 1)) != ((v3 == a1[2][9]) / 1));
+            v0 = (((v0 != v2) && (a1[1][0] >= a0[7])) == ((a0[11] >= a1[3][6]) >= (20 % 1)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v1 ? 90 : 17) / 6) <= ((a0[13] <= v1) > (v1 != 14)))) {
+        v0 = (((v3 && v2) < (v2 != v1)) > ((68 < a0[7]) - (72 + a0[10])));
+        a1[1][3] = (((a1[2][4] + a1[1][10]) * (a0[3] % 3)) + ((v0 > v3) ? (a0[12] && v1) : (v0 / 2)));
+        v2 = (((a0[12] ? 71 : 85) ? (42 == a0[3]) : (60 == 18)) - ((17 / 8) % 9));
+    } else {
+        v2 = (((v0 ? a1[3][7] : 50) > (v1 % 3)) && ((v1 ? v0 : v0) + (43 == a0[0])));
+        a1[1][5] = (((a0[14] != a0[0]) ? (v2 && v0) : (v2 ? v1 : v1)) || ((a1[2][12] && v3) || (a0[5] / 3)));
+        v1 = (((v2 >= v2) - (88 <= 38)) && ((5 / 5) / 9));
+    }
+    if ((((v1 > v0) && (v1 == 48)) + ((a1[2][12] < 15) * (a1[0][7] * v2)))) {
+        v0 = (((98 && a1[1][11]) ? (v3 > a1[0][2]) : (a1[1][6] || 46)) && ((v0 % 8) < (a0[13] / 3)));
+        v1 = (((v3 - 36) + (v2 >= 79)) / 8);
+        a1[3][7] = (((a0[5] >= a0[2]) == (14 < a0[8])) > ((v0 / 2) < (v2 ? v1 : a0[10])));
+    } else {
+        v3 = (((v2 % 3) % 7) <= ((8 != v3) - (71 && 90)));
+        a1[3][14] = (((14 - v3) * (69 * 86)) <= ((41 - v0) || (v2 > 95)));
+        v2 = (((81 % 9) >= (59 ? v0 : a1[2][7])) ? ((v2 / 3) != (v0 + a1[0][2])) : ((v2 - 59) % 5));
+    }
+    return (((8 < v1) / 6) && ((v1 / 8) > (a0[13] < a0[7])));
+}
+int main() {
+    return 0;
+}
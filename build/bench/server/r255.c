@@ -0,0 +1,69 @@
+int f0() {
+    int v0 = 4;
+    int v1 = 34;
+    int v2 = 55;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v0 = (((23 % 6) && (v3 <= v1)) + ((a0[15] < 41) + (i0 / 8)));
+            v3 = (((i0 ? v1 : a0[3]) >= (v1 == 86)) < ((a0[2] * a0[9]) >= (v2 != 48)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v3 = (((v0 <= v3) ? (97 >= 23) : (v3 <= v2)) ? ((v2 * v0) >= (v2 ? a1[1][13] : i1)) : ((a1[2][9] + v3) >= (i0 > v1)));
+                v2 = (((73 > v3) - (v2 >= a1[0][4])) != ((v0 || i0) / 4));
+                v0 = (((v2 ? a0[0] : a0[0]) ? (v3 * v3) : (7 + i0)) ? ((v3 || v3) || (64 % 4)) : ((v3 && v2) ? (47 >= v0) : (97 * a0[8])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 >= v1) / 8) >= ((v3 <= v3) != (v3 * v2)))) {
+        a0[3] = (((a1[2][5] + 37) <= (v3 ? a1[2][12] : a0[0])) ? ((v2 * 73) % 6) : ((v1 >= a1[3][7]) || (a0[9] && 42)));
+        v3 = (((v0 < a0[5]) - (a0[9] >= v0)) / 6);
+        v1 = (((v3 * v2) && (a0[5] <= v2)) || ((v1 + v2) - (4 - a0[14])));
+    } else {
+        v3 = (((v1 ? v2 : a1[3][13]) > (a1[0][12] / 9)) + ((v2 * a0[15]) && (v2 || v0)));
+        a0[7] = (((4 < a1[0][12]) <= (a0[5] < v1)) != ((a0[9] * v3) ? (v1 ? a0[6] : v2) : (v0 + v0)));
+        v3 = (((v1 % 5) != (a0[14] > a0[5])) <= ((v1 || 36) <= (a0[14] + v3)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v0 = (((a1[3][6] < 95) <= (a0[3] + 66)) - ((a0[2] ? 51 : 26) + (a0[4] % 2)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            a1[2][0] = (((i2 >= 40) ? (i2 % 3) : (a0[13] - a1[0][10])) % 2);
+            v3 = (((55 % 1) > (a1[3][4] > 80)) + ((34 <= 14) + (a0[7] * i2)));
+            v0 = (((a1[0][3] * v3) == (68 + 88)) || ((35 ? 6 : v0) * (a0[0] && a0[8])));
+        }
+        v1 = (((v3 > a1[3][13]) >= (a1[3][8] % 6)) || ((v2 > a0[4]) == (16 * a0[11])));
+    }
+    if ((((v2 > 61) || (95 && v2)) != ((v1 && 49) + (v0 <= 94)))) {
+        a0[12] = (((v2 || 51) >= (v0 || a0[12])) / 4);
+        v2 = (((56 || v0) == (v0 ? v3 : a1[2][9])) || ((61 || v2) <= (v1 == v0)));
+        a1[2][8] = (((a1[3][11] != v2) % 2) != ((1 ? v3 : v2) * (6 * a0[14])));
+    } else {
+        a0[8] = (((a0[14] > a0[15]) == (43 > a1[0][6])) < ((v0 <= v0) <= (a1[2][3] >= v2)));
+        v3 = (((v0 < v2) || (v2 != a1[3][12])) * ((73 > v2) % 2));
+        a1[2][15] = (((a1[0][1] * 55) >= (v3 && a1[0][10])) + ((v3 <= 67) <= (v2 == v0)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v0 = (((78 ? 86 : 68) - (72 > 20)) * ((a1[0][9] ? a0[0] : v2) - (a0[10] % 3)));
+                    a0[1] = (((a1[2][5] + a1[3][8]) / 2) != ((v3 < i5) == (a1[3][2] % 7)));
+                    a0[1] = (((i4 > a0[3]) >= (a1[0][3] || 53)) == ((v3 - 59) < (v3 <= v2)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((v0 == a1[0][15]) || (i4 < v1)) || ((v0 != 72) / 3));
+            v2 = (((2 < a0[0]) ? (v0 ? v0 : i4) : (a0[2] - a1[3][10])) >= ((34 != v1) != (v1 >= 55)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((a0[0] - 3) < (56 == 15)) == ((2 % 2) <= (v1 ? 78 : v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,142 @@
+int f0() {
+    int v0 = 78;
+    int v1 = 15;
+    int v2 = 14;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[15] == i0) > 68) break;
+                    a1[2][3] = (((v1 && a1[3][7]) > (43 - v3)) ? ((v2 <= v3) + (a1[3][11] * i0)) : ((a1[3][8] + 57) || (a0[11] * 22)));
+                    v1 = (((v2 * i0) == (a1[3][13] != v1)) < ((v1 != a0[8]) == (v1 > i0)));
+                    v0 = (((v3 >= v0) / 7) + ((i1 >= v3) < (v2 + a1[2][11])));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v1 = (((v0 + i0) ? (v2 == a1[3][12]) : (7 <= v2)) == ((a1[0][5] / 3) >= (v1 <= a1[1][3])));
+            v3 = (((65 != 5) && (v3 || v0)) ? ((3 / 2) < (23 && a0[15])) : ((v2 % 6) ? (v3 * a0[4]) : (2 ? v1 : v3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((v1 ? i2 : i2) > 63) break;
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v2 = (((v3 / 2) - (v1 > v2)) * ((i3 == a1[0][15]) >= (i3 && a0[8])));
+                a0[5] = (((i3 <= v1) - (a0[3] % 2)) == ((v2 < 32) != (15 ? 14 : v3)));
+                v1 = (((a1[2][8] == a0[7]) ? (v1 != v2) : (v0 != v3)) >= ((i2 <= 10) || (a0[8] - i3)));
+            }
+            v0 = (((a1[2][2] - a1[0][2]) && (i2 || v1)) != ((v2 % 3) - (v3 + 96)));
+            v2 = (((a0[14] - i2) % 9) * ((a0[6] <= v0) ? (i2 || 35) : (73 == v0)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                if ((v2 < 92) > 87) break;
+                v2 = (((v3 == v0) ? (v3 / 7) : (a1[2][8] || i4)) > ((i4 != 61) / 8));
+                v2 = (((3 ? v3 : v0) != (i4 + i4)) / 1);
+                v2 = (((84 || i4) + (i4 != 1)) || ((96 / 2) && (i4 > 76)));
+            }
+            v0 = (((87 * v1) * (i4 ? a0[14] : a0[11])) != ((69 > i4) ? (a1[0][4] ? a0[4] : a0[0]) : (i4 * v0)));
+            a1[0][13] = (((a0[13] < i4) ? (97 && a1[1][13]) : (a1[0][13] + i4)) * ((v0 <= a0[13]) == (11 != 16)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    v1 = (((64 * v3) && (43 % 8)) || ((v0 - v3) > (46 + 9)));
+    if ((((a0[0] ? 1 : v3) + (v2 * v3)) + ((27 / 5) == (a0[14] ? a0[6] : 74)))) {
+        v1 = (((a0[13] % 7) >= (57 <= v0)) % 3);
+        v3 = (((a0[10] >= 1) > (v0 ? 47 : 91)) || ((30 / 2) != (a1[0][6] >= 32)));
+        v0 = (((v1 / 8) != (a0[13] != v2)) > ((v1 ? v1 : 14) / 4));
+    } else {
+        v3 = (((v0 < v2) / 2) + ((v3 - v1) + (93 % 7)));
+        v2 = (((16 || v3) != (a1[3][14] - v1)) * ((58 && 23) || (v0 % 2)));
+        a1[1][7] = (((v1 + v2) * (27 > a0[13])) <= ((v3 < v0) / 3));
+    }
+    return (((v1 || v3) || (v1 || v3)) ? ((66 && a0[2]) != (v1 * v2)) : ((v0 && 16) > (25 <= 26)));
+}
+int f1() {
+    int v0 = 3;
+    int v1 = 80;
+    int v2 = 93;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][7] <= v0) * (v0 <= a0[8])) ? ((v0 <= v0) == (v1 == v3)) : ((v2 % 9) >= (v2 != v3)))) {
+        v0 = (((v1 == 90) + (48 / 8)) != ((v3 % 2) >= (a1[0][9] <= 35)));
+        v1 = (((v2 % 8) <= (v0 >= v0)) ? ((4 <= v0) <= (a1[3][9] * v3)) : ((v2 < v3) != (3 || a1[1][15])));
+        v0 = (((a0[10] - v0) <= (a1[0][14] ? a1[0][2] : a0[15])) < ((v1 * v2) * (v0 < v1)));
+    } else {
+        a1[3][3] = (((v1 - a1[1][12]) < (v2 || v0)) * ((a0[9] * 60) < (a1[3][4] && a1[3][4])));
+        v2 = (((2 % 8) ? (v0 && 75) : (v1 >= a1[2][9])) - ((v2 % 5) % 3));
+        v2 = (((v0 <= v0) ? (36 / 2) : (v0 + v2)) - ((v2 % 2) >= (v0 || v2)));
+    }
+    if ((((v2 != v3) || (v3 * v0)) < ((v3 != v1) > (v2 && v1)))) {
+        v1 = (((a1[3][13] > a0[9]) == (v3 ? v0 : v0)) || ((a0[5] != v2) != (a1[1][7] <= v3)));
+        a0[14] = (((19 / 8) != (v2 % 3)) % 6);
+        v3 = (((v3 + a0[14]) * (v0 <= v2)) > ((39 % 1) < (v2 - v0)));
+    } else {
+        v3 = (((a0[15] >= v1) ? (a1[0][2] - v0) : (a0[12] > 10)) && ((97 == v3) - (47 != v1)));
+        a1[1][3] = (((20 - a0[8]) <= (v3 >= 89)) < ((52 * 31) >= (93 / 5)));
+        v1 = (((v1 / 1) * (v0 < 71)) || ((v0 * v3) / 7));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((a0[15] - v0) > 77) break;
+        {
+            int i1 = 0;
+            do {
+                if ((a1[0][6] % 1) > 83) break;
+                a1[0][2] = (((i0 ? 1 : 23) > (v3 ? a0[0] : i0)) == ((a0[13] ? v0 : 42) * (89 <= v2)));
+                v0 = (((22 ? v0 : v0) || (a0[0] >= 71)) || ((a0[0] * 1) - (v2 != a1[0][14])));
+                a0[4] = (((i1 <= v1) || (44 && v0)) != ((93 ? a1[2][2] : 15) % 7));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v0 = (((v2 > v1) - (v2 >= a0[5])) < ((a1[0][4] >= a0[9]) || (60 - a1[1][11])));
+        v1 = (((22 % 6) ? (8 % 9) : (a0[13] && v3)) != ((a1[0][0] ? i0 : v0) + (a0[4] >= a1[3][5])));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v1 / 9) > 88) break;
+            v2 = (((83 % 9) % 3) ? ((65 || 60) % 8) : ((a0[14] >= i2) >= (a1[3][8] != v3)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v1 = (((a0[14] <= v0) != (11 && i2)) < ((a0[4] ? i2 : v3) % 8));
+                v3 = (((i3 <= a1[1][12]) < (v2 >= a1[3][5])) + ((40 == 5) > (i3 - v3)));
+                v0 = (((i2 && 57) || (v2 < v0)) - ((i3 * a1[2][7]) - (71 ? v1 : i3)));
+            }
+            a0[1] = (((v3 + a0[4]) - (a0[14] > a0[2])) == ((v2 % 7) ? (v1 < 28) : (6 - v0)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((i4 ? v2 : v0) > 74) break;
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    a1[2][6] = (((i5 / 4) && (89 - i5)) > ((a1[3][8] < 18) > (v0 ? 61 : 6)));
+                    v0 = (((a0[2] && i4) / 5) < ((a1[2][15] < 1) * (v3 < a1[1][15])));
+                    a0[14] = (((i5 ? i5 : 94) + (34 > a1[1][13])) % 9);
+                    i5 = i5 + 1;
+                }
+            }
+            a1[2][12] = (((v3 > v3) == (v1 ? v2 : v2)) % 5);
+            v2 = (((v3 - v2) ? (v3 % 7) : (v3 != v0)) - ((77 != a0[3]) / 8));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 && v1) - (a0[12] / 3)) < ((v1 > v0) || (v0 * v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,146 @@
+int f0() {
+    int v0 = 47;
+    int v1 = 77;
+    int v2 = 71;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 != v3) < (89 - v1)) * ((a1[3][1] / 6) ? (10 ? a0[2] : v1) : (a1[1][8] - v3)))) {
+        v0 = (((v0 < a1[0][8]) - (a1[3][15] + a0[13])) > ((a1[0][13] - a1[2][8]) <= (a0[11] != v1)));
+        v1 = (((a1[3][15] + v2) != (v0 % 6)) != ((v1 ? v1 : v2) && (v3 % 8)));
+        v0 = (((19 && a0[6]) == (v0 == 55)) % 2);
+    } else {
+        a0[14] = (((a1[1][5] != a1[0][10]) != (v2 && v2)) * ((v1 + a0[13]) <= (a0[15] * a0[6])));
+        v1 = (((v0 * v0) ? (v1 % 3) : (0 + v3)) && ((v2 >= 84) > (v3 ? v1 : a1[2][14])));
+        v2 = (((v1 - v1) || (v2 == a1[3][14])) / 2);
+    }
+    v2 = (((v2 == v1) == (v3 && a1[0][10])) - ((v2 && v2) ? (78 > v0) : (v1 != v1)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((i0 - a0[1]) > 68) break;
+            a1[3][4] = (((94 * v1) || (v3 || a0[4])) ? ((a0[10] - v3) >= (a0[5] && i0)) : ((i0 <= a1[0][9]) - (12 % 4)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((i0 % 2) - (i1 + i1)) >= ((a0[15] / 4) <= (15 % 8)));
+                    v3 = (((v0 ? v0 : a1[2][8]) || (41 ? v3 : v2)) != ((i0 + v0) != (a1[2][1] % 8)));
+                    v2 = (((i1 ? v2 : a1[2][15]) - (i0 / 1)) - ((75 != a0[4]) == (v2 || v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v3 = (((55 > v0) > (a1[0][1] > a1[1][0])) && ((v0 ? 38 : v0) && (a1[3][6] > 70)));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v0 > a1[3][13]) > (68 > v0)) != ((v3 + a0[5]) ? (79 && v0) : (v0 / 7)));
+    a0[4] = (((a0[12] ? 27 : v3) / 6) > ((v2 / 2) - (v0 != v3)));
+    return (((v0 <= a1[1][12]) && (v1 + v1)) * ((v1 - v1) || (v2 < a0[6])));
+}
+int f1() {
+    int v0 = 72;
+    int v1 = 85;
+    int v2 = 65;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v3 >= a0[7]) - (v1 || v3)) % 4);
+    if ((((88 + v1) + (6 ? a0[9] : a0[1])) + ((a1[0][5] < v3) + (62 - 20)))) {
+        a0[1] = (((v2 / 6) ? (a0[4] > a0[1]) : (a0[3] % 4)) > ((a0[12] ? 53 : v1) <= (a0[10] >= v2)));
+        a1[3][9] = (((23 < v2) && (a1[2][8] || a0[0])) - ((v3 <= v0) * (61 + a0[15])));
+        a0[15] = (((52 - 97) % 4) > ((v1 / 1) * (v2 - v0)));
+    } else {
+        v1 = (((94 <= v3) % 6) || ((v2 ? a1[1][7] : 66) ? (13 || v0) : (17 || v2)));
+        v1 = (((v1 != a0[3]) ? (26 == a1[1][2]) : (v1 * v0)) && ((v2 + a1[1][13]) ? (12 ? v0 : a1[2][8]) : (a0[6] == v3)));
+        v3 = (((56 + a0[1]) <= (v1 != v3)) <= ((v1 != 36) != (v1 != v1)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((a0[14] ? i0 : a0[11]) > 64) break;
+        v2 = (((i0 % 8) % 1) ? ((38 % 4) % 5) : ((9 > a1[3][4]) < (a1[1][9] && 13)));
+        {
+            int i1 = 0;
+            do {
+                a1[2][8] = (((66 + i1) < (v0 <= v1)) ? ((78 != a1[2][4]) >= (2 < v1)) : ((65 && v2) ? (v2 <= i0) : (i0 < a1[1][10])));
+                v3 = (((78 * v1) != (74 && a0[12])) * ((i1 == 35) ? (70 <= 38) : (5 * v2)));
+                a0[7] = (((4 < a0[12]) < (a1[2][7] + a0[8])) % 4);
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        v3 = (((a1[2][9] > 30) + (v2 && a1[0][5])) / 7);
+    }
+    v1 = (((a0[13] < a0[13]) != (a1[2][7] * v1)) <= ((v0 != 66) ? (a0[10] != a0[12]) : (v2 >= 20)));
+    v1 = (((v2 != v3) >= (v2 != 36)) || ((v1 < 13) / 8));
+    return (((90 != v2) <= (v0 - v2)) - ((v0 == v2) || (v2 < a0[1])));
+}
+int f2() {
+    int v0 = 91;
+    int v1 = 16;
+    int v2 = 11;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((27 - a0[3]) > 54) break;
+                a1[2][12] = (((a1[0][4] != v1) && (i1 == a0[11])) > ((v0 + v0) * (v3 == a1[2][15])));
+                a0[7] = (((i0 < v1) <= (a1[0][8] % 6)) || ((v2 == a1[2][0]) || (i1 - 49)));
+                a1[1][15] = (((a1[1][1] && i0) != (v2 % 2)) * ((a1[1][10] > v3) >= (v1 + v1)));
+            }
+            a0[12] = (((v0 / 2) ? (v3 < v1) : (17 && a1[1][13])) != ((i0 / 8) + (v1 % 4)));
+            a0[5] = (((i0 + v2) > (v3 == 96)) > ((v0 || v2) + (a1[2][14] >= v0)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 % 8) / 6) >= ((a1[1][2] > 23) != (a1[3][11] + v1)))) {
+        a1[3][8] = (((v1 > a0[10]) - (a0[4] ? a1[0][11] : v2)) ? ((20 || a1[0][4]) / 9) : ((a1[1][14] < 27) >= (a0[6] > v1)));
+        v1 = (((v1 || a0[9]) + (a1[1][5] <= v1)) <= ((v2 != v3) < (v1 == a1[0][8])));
+        v2 = (((v3 > a1[2][14]) >= (54 < 69)) + ((58 != 92) > (v0 >= a1[0][6])));
+    } else {
+        v0 = (((v3 || 95) || (a0[0] - v1)) || ((v1 < 89) || (a1[1][7] + a0[3])));
+        v2 = (((40 >= v3) && (49 ? a0[0] : 78)) < ((a0[11] - 85) + (a0[13] || v0)));
+        a1[1][4] = (((v3 ? v0 : v0) == (v0 == v1)) % 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((v2 * 55) > 82) break;
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                a1[0][0] = (((8 < v0) ? (a1[1][3] == v0) : (a0[15] == 44)) / 9);
+                v1 = (((a1[3][10] / 7) ? (v0 >= i2) : (v3 ? a0[2] : v2)) + ((i3 && v1) != (i3 * 79)));
+                v1 = (((68 + 79) / 2) ? ((65 <= 64) ? (v2 >= a1[3][6]) : (v2 == v0)) : ((64 % 8) + (34 + 90)));
+            }
+            a1[0][10] = (((64 > a0[6]) >= (70 >= i2)) == ((a1[1][8] ? 36 : v3) ? (76 < 43) : (v1 * v1)));
+            v0 = (((a1[0][9] % 8) - (v3 * 61)) ? ((a0[7] || 33) <= (1 >= v1)) : ((a1[1][8] * v1) * (v1 / 8)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((25 < 95) <= (v2 - v0)) <= ((a1[1][0] * 32) <= (v3 ? a0[12] : a1[0][7])))) {
+        a1[0][5] = (((v1 % 6) || (36 > v1)) ? ((v3 * v0) + (4 <= 73)) : ((v0 - v1) * (v0 > a1[3][7])));
+        v0 = (((v2 || v1) < (v0 < 64)) * ((7 + v1) ? (a1[0][7] > v1) : (v2 == 4)));
+        a0[3] = (((v1 > a0[12]) != (a0[5] != v1)) || ((5 / 7) == (16 < a0[13])));
+    } else {
+        v2 = (((42 && 83) + (v3 < v3)) <= ((v2 > v1) || (42 > 79)));
+        v2 = (((37 >= v2) != (16 + a1[3][5])) > ((47 <= v3) && (v2 ? v0 : a1[1][1])));
+        v0 = (((v3 + 9) || (v0 + v3)) <= ((92 / 8) <= (a1[2][2] < v1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v1 > v3) > 56) break;
+            v0 = (((a0[2] && v1) ? (v0 == v3) : (2 % 1)) && ((v0 || a0[12]) && (v1 ? v2 : a1[1][12])));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a0[14] = (((a1[3][1] || v3) ? (52 && v2) : (v2 > 16)) - ((v0 < 26) == (v3 > a0[11])));
+                v2 = (((a1[3][12] == 22) ? (a0[7] ? v3 : 58) : (a1[0][8] ? v0 : i5)) || ((a0[10] < v2) / 2));
+                v0 = (((v1 <= 74) - (i4 * a0[10])) * ((v1 ? v0 : v0) / 3));
+            }
+            a0[14] = (((i4 % 8) >= (v3 <= v2)) || ((i4 == v2) > (v1 >= v0)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((53 || v2) % 2) < ((v2 ? v0 : a0[7]) - (90 % 5)));
+}
+int main() {
+    return 0;
+}
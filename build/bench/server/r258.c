@@ -0,0 +1,57 @@
+int f0() {
+    int v0 = 12;
+    int v1 = 93;
+    int v2 = 31;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[15] = (((a1[0][6] == 43) % 2) ? ((a1[3][1] ? v3 : v1) % 1) : ((v3 == v0) >= (v1 < a1[0][14])));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v2 = (((a0[4] && i1) >= (a0[9] != 72)) && ((28 > 65) || (75 || i1)));
+                    v2 = (((v2 ? a1[2][0] : v1) ? (a1[2][2] <= v0) : (v0 - 33)) - ((i0 == v0) <= (a1[2][6] - v2)));
+                    a0[10] = (((v3 <= a1[2][11]) < (i0 || a1[1][3])) > ((v2 || a1[2][1]) / 6));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][15] = (((a1[2][3] == 56) == (v3 * a0[15])) > ((54 > a0[13]) <= (a0[6] || v1)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    a0[12] = (((44 >= a0[1]) >= (11 ? v1 : 62)) ? ((v1 / 2) == (37 % 6)) : ((a1[3][10] == a0[14]) || (a1[1][9] > a1[0][10])));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v2 = (((v2 < 64) || (v2 <= 55)) % 7);
+            v1 = (((42 == 94) >= (a1[0][15] % 1)) ? ((v2 ? a0[7] : a0[7]) * (v0 == v2)) : ((a0[0] <= v3) && (v3 + a0[7])));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v1 = (((a1[2][9] > a0[11]) ? (v1 + v0) : (i2 < v1)) * ((a0[8] || a0[14]) * (i2 < 41)));
+                v3 = (((i2 - 9) || (i3 > a0[0])) ? ((v0 < 39) && (v2 >= 56)) : ((v3 == v3) ? (a1[3][9] % 9) : (62 == v1)));
+                a1[2][9] = (((a1[2][2] != i3) ? (a0[4] >= a0[15]) : (9 >= 55)) > ((a1[3][10] == v2) - (a0[11] < 73)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v1 = (((61 <= 70) ? (v0 && v3) : (52 && 41)) % 1);
+                a1[1][6] = (((v2 ? i4 : v3) != (20 % 7)) <= ((83 >= i4) && (v1 != i4)));
+                v2 = (((v3 == i5) < (v1 % 8)) >= ((i5 != v1) <= (a1[1][11] > i5)));
+            }
+            v1 = (((v0 * a0[15]) ? (a0[7] + a1[0][12]) : (12 * a1[0][3])) >= ((v3 - 98) * (3 == v2)));
+            v1 = (((a0[6] + a0[4]) % 9) - ((a0[11] ? v0 : 10) * (a1[0][5] || 36)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    a0[2] = (((a1[1][6] + a0[13]) >= (a0[4] || v2)) / 9);
+    return (((v0 <= 13) == (v0 || v0)) && ((89 <= v3) - (v3 > v1)));
+}
+int main() {
+    return 0;
+}
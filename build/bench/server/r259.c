@@ -0,0 +1,104 @@
+int f0() {
+    int v0 = 66;
+    int v1 = 31;
+    int v2 = 86;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    if ((((85 == v1) < (48 + 23)) || ((v1 || 90) <= (v1 + v3)))) {
+        a1[2][8] = (((v3 <= v3) * (v3 + a1[2][0])) + ((90 == 75) == (v1 - 28)));
+        v0 = (((a1[1][13] >= a1[1][12]) / 7) || ((16 || 43) + (a0[13] * v2)));
+        a0[13] = (((a0[5] ? v0 : a1[3][14]) - (v3 ? 24 : 7)) || ((a1[3][1] != v3) == (v1 <= a1[3][12])));
+    } else {
+        v0 = (((v1 == 99) * (14 >= v2)) || ((a0[15] % 6) ? (56 / 1) : (85 || v0)));
+        v1 = (((45 == a0[13]) ? (v0 < v3) : (77 % 7)) > ((v3 || 40) / 4));
+        v0 = (((a1[2][2] > 37) ? (44 * 2) : (80 <= v1)) <= ((77 - v3) ? (v0 >= v1) : (a0[13] ? v0 : a0[15])));
+    }
+    if ((((v2 >= a1[0][9]) >= (54 - v2)) > ((43 + a0[2]) || (v0 || 32)))) {
+        a1[1][2] = (((89 / 3) >= (a0[9] % 8)) ? ((42 - 16) > (5 * 68)) : ((a0[1] ? a1[1][3] : a0[10]) * (v2 / 5)));
+        v1 = (((v2 <= v2) ? (v2 - 32) : (a0[15] ? a0[13] : v0)) > ((v0 && 33) != (a1[2][14] / 5)));
+        v0 = (((a1[3][2] == v0) && (v1 < a0[6])) % 6);
+    } else {
+        v3 = (((v1 >= 51) == (a0[3] ? a0[13] : 12)) > ((v0 - v0) * (a0[3] == v2)));
+        v2 = (((v0 + 33) / 6) - ((a0[9] ? 15 : a1[0][8]) / 7));
+        v2 = (((39 % 8) < (a0[10] * 57)) - ((a1[0][9] ? v1 : v3) != (v2 ? v3 : 59)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v3 = (((58 != i0) != (v0 * i0)) == ((v3 && a0[2]) || (6 - a0[4])));
+                    v2 = (((3 ? a1[2][10] : v1) <= (i0 / 9)) / 7);
+                    v2 = (((66 / 7) == (v2 - a1[2][13])) && ((v3 < a0[9]) + (13 != v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v1 != a0[15]) % 4) ? ((v3 == a1[1][12]) + (a1[0][2] || v2)) : ((v2 != v1) + (64 != 86)));
+            v2 = (((i0 * a1[2][6]) != (a1[2][1] || i0)) && ((a0[3] < v3) >= (v1 <= 38)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[0][0] < v3) != (v0 || v3)) * ((v2 || v1) * (v2 + a0[2])))) {
+        a0[4] = (((v3 < a0[10]) != (v1 > v0)) <= ((a0[8] ? a0[9] : v2) > (a0[10] && 93)));
+        v2 = (((v3 - v0) < (v3 >= v1)) <= ((a0[12] || v0) == (v2 == a0[8])));
+        a0[1] = (((3 != v2) == (v2 - 41)) ? ((v0 / 8) / 3) : ((v1 ? a0[14] : 69) * (v2 / 3)));
+    } else {
+        a0[11] = (((6 >= v1) - (13 < a0[2])) >= ((a0[15] > 57) >= (35 > 40)));
+        v3 = (((0 + v3) >= (v2 < v0)) <= ((a0[10] + v1) ? (53 * a0[10]) : (v2 - v2)));
+        a1[0][13] = (((a1[3][14] - v1) || (a0[3] ? a1[0][3] : v1)) || ((v2 + 81) != (v2 <= a1[3][9])));
+    }
+    v3 = (((20 != a0[10]) ? (53 ? v2 : 94) : (v3 * a1[1][6])) ? ((a1[3][3] > v0) + (v3 == 40)) : ((a1[1][4] < 85) == (a1[0][2] + a0[5])));
+    return (((v0 <= 19) > (62 > v3)) < ((v3 ? v2 : v2) % 7));
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 49;
+    int v2 = 29;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    a1[0][4] = (((v1 + v1) / 1) == ((v1 && v0) ? (a1[2][9] || v2) : (54 - a0[15])));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            a0[15] = (((i0 == v1) || (25 / 1)) ? ((v2 + a0[1]) / 3) : ((a1[0][12] / 5) == (v2 ? a1[1][8] : 71)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a1[2][4] = (((i1 >= a0[7]) ? (41 == v2) : (89 - 38)) + ((a0[10] ? v0 : a0[7]) % 1));
+                v2 = (((83 * i0) + (a0[13] * v0)) + ((a0[15] ? v0 : 21) <= (a0[8] >= v3)));
+                v2 = (((i1 != v0) <= (49 == 87)) && ((v3 ? a0[9] : 51) ? (i0 > a1[1][0]) : (a0[12] || 22)));
+            }
+            a1[0][3] = (((a1[1][1] + v1) == (v1 * a0[1])) - ((a0[0] >= i0) < (v3 ? a0[15] : 10)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v2 < v3) > 51) break;
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v2 = (((i2 * v2) || (v1 > a0[2])) >= ((i2 * a1[3][7]) <= (v2 + v2)));
+                a1[3][1] = (((36 > v2) < (a1[0][4] * 76)) * ((68 < v2) * (i3 >= v0)));
+                a1[3][2] = (((a0[7] && a1[1][9]) == (v2 % 9)) || ((v2 <= 29) - (v2 * v2)));
+            }
+            v2 = (((i2 > a1[1][14]) % 9) < ((v0 - v3) <= (a0[9] || 97)));
+            v0 = (((a0[1] * 88) || (v1 && v1)) <= ((a0[10] ? v0 : 27) > (i2 * v2)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((80 > v3) != (v2 != v0)) >= ((v0 || v2) + (v0 / 3)))) {
+        a0[1] = (((v2 ? a1[3][0] : a0[11]) > (v0 - 36)) != ((v2 % 5) ? (v2 ? v1 : a0[3]) : (v1 * v0)));
+        v3 = (((v2 ? v0 : 85) == (v3 >= 37)) != ((v0 > v0) - (v1 > v1)));
+        v1 = (((a1[2][14] > 17) < (65 && v1)) != ((a1[2][14] % 4) == (v2 < 1)));
+    } else {
+        a1[3][1] = (((v1 - a1[0][2]) < (a0[3] - 1)) * ((v0 != v0) || (v0 ? v1 : v2)));
+        a1[0][6] = (((v3 / 1) ? (v1 < a0[2]) : (9 - 88)) > ((v0 / 7) + (v1 != v1)));
+        v2 = (((56 && a0[8]) != (a1[2][11] || a0[7])) * ((61 * a1[0][12]) >= (v0 <= v2)));
+    }
+    a1[0][9] = (((32 > v3) >= (v1 < a1[2][6])) + ((a1[3][13] <= a0[7]) / 3));
+    return (((v2 >= 34) * (v1 || a0[0])) && ((v0 || v0) % 3));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,185 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 44;
+    int v2 = 4;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a0[15] >= i0) > 97) break;
+        v0 = (((v3 + i0) / 3) == ((9 != v2) > (i0 || i0)));
+        v2 = (((i0 || v1) < (a0[7] == 57)) > ((a1[0][4] ? 0 : v2) <= (v0 < i0)));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a0[13] != v2) >= (v3 && v1)) ? ((11 < a0[4]) * (42 > a0[0])) : ((a1[0][5] > a0[3]) <= (i1 - a0[7])));
+                v1 = (((v1 > a1[2][14]) + (i0 > i1)) && ((v3 + v3) / 8));
+                v1 = (((v0 == 76) == (v3 || 51)) % 6);
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    v1 = (((v2 != a1[0][14]) / 2) ? ((v1 || 73) / 8) : ((v0 <= v0) > (a0[4] > a1[1][3])));
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 && i2) == (v3 % 5)) % 1);
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((a1[1][14] + a0[15]) > 96) break;
+                v1 = (((a0[14] ? a0[7] : 45) + (a1[3][5] == i2)) <= ((a1[2][2] - v0) >= (v2 < i2)));
+                v0 = (((v0 % 2) == (a0[8] % 9)) ? ((a0[6] < a0[4]) + (a0[7] <= a0[5])) : ((97 % 4) > (v2 <= a1[1][6])));
+                v0 = (((10 && 92) * (14 || a0[8])) - ((a0[5] <= a1[2][0]) < (v3 / 1)));
+            }
+            v0 = (((17 > i2) <= (v3 <= 85)) - ((85 > a0[12]) > (a0[6] < 51)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((v2 == v2) * (11 - v1)) < ((a1[3][10] >= a0[7]) && (v0 == a1[0][7])))) {
+        a0[8] = (((34 != 70) || (a0[7] / 9)) < ((v1 * v0) <= (a1[0][9] != v3)));
+        v3 = (((9 != v3) <= (v0 / 2)) == ((v0 != a0[5]) % 1));
+        v1 = (((v2 ? v2 : 18) <= (v0 || v1)) <= ((67 / 2) / 5));
+    } else {
+        v0 = (((v3 - 31) % 4) < ((a1[2][8] * v3) == (a1[3][13] && v1)));
+        v3 = (((70 > a1[3][4]) || (32 != v0)) * ((v0 || 67) != (v2 / 8)));
+        v1 = (((64 ? v3 : v2) >= (v1 - v0)) || ((a0[13] <= a0[9]) == (v2 < v2)));
+    }
+    if ((((v0 ? v1 : a0[0]) % 8) && ((v0 != 45) + (v3 != v2)))) {
+        v0 = (((v1 || v0) >= (a0[5] * v2)) * ((v2 < v0) / 8));
+        v0 = (((v2 < a1[1][15]) ? (v3 && a1[1][3]) : (v0 ? v1 : a0[13])) && ((v2 != v1) && (77 % 4)));
+        a0[15] = (((87 > v3) >= (a1[0][1] > a1[2][14])) == ((v0 / 1) > (v0 && a0[6])));
+    } else {
+        v3 = (((54 * v3) ? (a0[2] + 80) : (51 ? 23 : v2)) * ((v2 < v3) && (a1[0][10] == v3)));
+        v3 = (((a0[8] % 6) > (v3 * v1)) || ((57 && v1) - (26 ? v1 : v2)));
+        v2 = (((v1 >= a0[7]) + (v2 + v3)) <= ((a0[2] ? v2 : 10) >= (v3 % 6)));
+    }
+    return (((76 * 47) != (v1 - v3)) && ((v1 + a1[1][3]) - (v1 && v3)));
+}
+int f1() {
+    int v0 = 63;
+    int v1 = 36;
+    int v2 = 4;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v2 = (((i0 >= v1) ? (v3 <= v0) : (v1 + v1)) || ((a1[3][6] && 38) > (v3 < 89)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((17 > v0) > 90) break;
+                    v1 = (((a1[1][2] && i1) + (v2 * 4)) > ((v0 >= 1) >= (61 ? v2 : v0)));
+                    v3 = (((a0[11] > a0[5]) != (v3 <= v2)) ? ((a0[14] == v3) <= (50 ? a1[1][1] : a1[2][11])) : ((i0 / 6) == (v1 < a0[12])));
+                    v2 = (((i1 && i0) * (75 ? v0 : i0)) && ((78 * a0[5]) >= (v1 % 1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[6] = (((a1[1][13] + a1[2][5]) || (v0 > v0)) && ((a0[10] == i0) ? (2 % 8) : (v1 || 40)));
+            i0 = i0 + 1;
+        }
+    }
+    a1[0][8] = (((a0[12] % 5) ? (v1 > v2) : (a1[3][7] >= v1)) ? ((30 + a1[2][11]) % 3) : ((v3 * v2) / 2));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v3 = (((v1 > v2) && (i2 && v1)) > ((v1 % 7) || (a0[8] / 8)));
+            a0[13] = (((15 * a0[11]) / 6) != ((33 > 98) < (v1 + v0)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((v3 != a1[0][12]) > 96) break;
+                    v1 = (((a0[9] || a1[2][15]) - (i3 && 51)) || ((58 ? 91 : i3) <= (v1 > 93)));
+                    v2 = (((34 - a0[13]) ? (51 < i2) : (a0[5] - 9)) == ((v2 == v3) + (i3 || 70)));
+                    v2 = (((11 + 12) > (v3 ? 54 : v2)) ? ((a1[1][15] && i2) ? (i2 > i3) : (6 / 1)) : ((a0[9] && v3) + (v3 * v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((a0[6] < a0[3]) ? (a1[3][2] && v1) : (v1 / 5)) <= ((v1 % 8) && (a0[13] % 6)));
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v0 = (((v1 == a1[1][1]) ? (v0 < a1[1][1]) : (a1[3][7] ? i4 : v3)) * ((v0 < a1[2][7]) < (v3 * v0)));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((51 || v0) != (i5 && i4)) % 2);
+                    a1[2][0] = (((v2 - v1) - (a0[1] - 16)) <= ((v3 < i4) || (11 <= i5)));
+                    v3 = (((a1[0][3] ? v0 : 48) || (90 / 6)) && ((v1 ? v1 : 84) <= (60 % 8)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v0 = (((88 ? v1 : 25) / 7) <= ((88 != v0) < (v2 || 58)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((19 == v1) == (v2 ? v0 : a1[1][12])) / 3);
+}
+int f2() {
+    int v0 = 43;
+    int v1 = 63;
+    int v2 = 35;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    if ((((30 > v0) == (v2 - v0)) == ((v0 && a0[12]) / 7))) {
+        v2 = (((a0[14] / 4) <= (v2 + a0[3])) ? ((v2 && v1) >= (v3 ? a0[5] : v2)) : ((v1 || v2) == (v2 >= v2)));
+        v0 = (((v2 > a1[1][13]) >= (v0 == 41)) % 6);
+        a0[2] = (((v2 == v3) % 3) - ((a1[2][13] % 5) > (78 / 7)));
+    } else {
+        v0 = (((v0 >= v0) / 2) && ((v3 <= 83) < (a1[0][3] - v3)));
+        v2 = (((v0 >= 68) ? (a0[3] * v2) : (v2 % 8)) ? ((49 < a1[0][10]) && (v3 > v0)) : ((v0 != 25) == (18 ? v0 : 38)));
+        a0[0] = (((15 || v0) * (v0 == v1)) + ((v2 <= a0[2]) - (82 > a0[2])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a0[0] * a0[10]) && (v0 <= a1[2][12])) > ((a1[0][15] != a0[10]) ? (i0 ? a1[3][7] : v3) : (v0 && v3)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v0 || i0) / 8) >= ((v0 / 6) % 6));
+                    v0 = (((a0[5] * a1[2][12]) && (36 < v2)) > ((a0[1] - a0[2]) + (v1 < v2)));
+                    a0[8] = (((a0[7] <= i1) == (v0 >= v0)) <= ((15 != 14) + (i0 ? v0 : a1[3][5])));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v0 = (((v0 >= v2) ? (a1[0][10] ? a0[2] : v0) : (a1[2][1] && a1[3][5])) - ((v0 + 43) || (v2 ? v0 : a0[14])));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v0 < 78) || (a1[0][10] != a1[3][2])) + ((64 % 2) % 3))) {
+        v1 = (((a0[0] ? 49 : v1) < (43 <= a0[15])) - ((24 > v3) == (32 != v1)));
+        a0[10] = (((a0[0] ? v1 : 74) < (a1[1][10] || 78)) ? ((v1 <= 40) != (a1[3][9] % 8)) : ((v0 != a1[0][15]) < (v3 < v2)));
+        v1 = (((v3 || 24) + (a0[7] / 5)) || ((23 + v2) == (73 / 7)));
+    } else {
+        v0 = (((v3 >= v0) > (v0 > v3)) + ((v2 / 1) != (v2 && 20)));
+        v2 = (((v1 != a1[0][13]) + (1 < v0)) ? ((v3 ? 99 : v1) || (40 + v2)) : ((v3 && v2) == (v0 % 6)));
+        v1 = (((v2 - a0[8]) ? (v2 * v2) : (a1[3][4] == v3)) * ((v0 / 8) ? (v3 > 54) : (v2 ? v2 : v2)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v0 = (((11 ? v0 : i3) >= (30 - 38)) * ((v0 * a0[13]) - (35 / 1)));
+                v1 = (((i2 != v2) < (v3 || a0[0])) <= ((v2 / 9) && (13 || 32)));
+                v0 = (((48 > v3) >= (a0[5] / 9)) * ((i3 / 6) == (a1[3][2] && a0[13])));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        v0 = (((v3 ? v2 : 58) <= (v0 && 78)) || ((a0[11] >= i2) >= (a1[2][14] <= a0[4])));
+        v0 = (((v0 != 24) || (a0[11] <= 96)) || ((v2 < v2) < (v3 <= 99)));
+    }
+    v3 = (((v0 / 7) < (v0 % 3)) - ((v0 >= 31) > (94 && v0)));
+    return (((9 >= 55) * (v3 < a1[1][10])) > ((70 + v2) < (a1[0][0] >= v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,193 @@
+int f0() {
+    int v0 = 68;
+    int v1 = 95;
+    int v2 = 53;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((65 / 7) != (v2 - 47)) != ((v2 ? 55 : v0) > (a1[0][9] - v0)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a1[3][3] = (((v0 < v2) == (a1[1][2] + 49)) * ((v0 < 76) != (v2 >= a0[6])));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a1[1][8] = (((a0[2] || 39) || (18 != i0)) != ((v3 % 9) != (i0 <= v0)));
+                v1 = (((a1[2][10] >= i1) * (v3 || 46)) % 9);
+                a0[15] = (((62 * v1) * (36 && 40)) != ((v2 + a1[1][15]) > (a1[0][7] == a0[13])));
+            }
+            v0 = (((v2 * v1) >= (a1[1][7] != 0)) * ((14 > a0[8]) < (a1[2][12] != a0[6])));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a1[2][0] = (((a0[0] ? 51 : a0[5]) > (v1 < v0)) || ((a1[3][5] / 7) <= (v2 <= a0[10])));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            if ((v1 / 4) > 82) break;
+            v0 = (((a1[1][12] || 76) ? (a0[1] * a1[2][14]) : (v2 && 22)) > ((v1 + a0[15]) / 9));
+            v1 = (((i3 ? a0[14] : 91) * (v2 < 53)) > ((a1[0][3] != v3) > (a0[13] == i3)));
+            v0 = (((i3 * 24) > (i2 ? v2 : v1)) == ((v2 + a1[2][13]) < (a0[12] * v1)));
+        }
+        v3 = (((v3 ? v0 : a1[3][2]) != (i2 % 2)) * ((a1[1][7] == v1) + (i2 / 6)));
+    }
+    if ((((v2 > v0) + (a1[1][12] >= v3)) + ((a0[3] != 89) ? (v1 > 54) : (v2 || 33)))) {
+        v0 = (((v0 <= v3) == (96 + v2)) % 3);
+        v0 = (((78 != v2) - (a0[11] % 7)) <= ((v3 >= 9) > (61 / 1)));
+        v1 = (((v2 > 55) >= (a1[3][10] == v0)) - ((v1 > v3) != (v3 + a1[3][15])));
+    } else {
+        v2 = (((v1 == v1) && (v2 / 3)) - ((v0 / 4) ? (a0[13] <= 1) : (88 && 82)));
+        a1[3][8] = (((35 != v0) * (v2 % 8)) % 3);
+        a1[2][14] = (((a0[1] && a0[8]) % 9) % 1);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                if ((i5 ? 76 : a0[14]) > 87) break;
+                a1[0][9] = (((v1 > v1) >= (v3 == v2)) ? ((v0 <= v2) != (v0 > v1)) : ((v3 + v3) / 8));
+                v1 = (((i4 - v3) <= (v2 || i4)) % 9);
+                a1[3][4] = (((i4 - a0[10]) + (32 ? 66 : 21)) ? ((37 && 57) >= (37 + v1)) : ((v0 ? a0[7] : v0) ? (35 || i4) : (80 % 9)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+        v2 = (((a0[6] <= v2) < (41 || 14)) == ((a1[2][12] && v0) ? (a1[3][13] > v3) : (v1 * i4)));
+        v2 = (((v3 == v3) == (a1[2][15] || a1[1][11])) / 9);
+    }
+    return (((v0 < a1[2][9]) < (v3 > a0[6])) != ((83 + a0[10]) * (v0 > v0)));
+}
+int f1() {
+    int v0 = 45;
+    int v1 = 94;
+    int v2 = 32;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v0 = (((v2 / 6) + (a1[1][3] != i0)) < ((i0 + i0) ? (85 / 2) : (a0[5] ? i0 : a0[15])));
+        v2 = (((a0[8] && a1[2][10]) ? (v3 ? a0[3] : v3) : (a0[7] && 6)) <= ((v2 ? v0 : v2) <= (v1 * 29)));
+        {
+            int i1 = 0;
+            do {
+                if ((70 >= v1) > 94) break;
+                v3 = (((i1 > a0[2]) * (93 >= v3)) + ((v0 - v0) <= (v2 / 3)));
+                v3 = (((i0 / 7) >= (v3 && i0)) ? ((v1 >= 93) > (83 && a1[0][3])) : ((i0 == a0[11]) / 8));
+                v0 = (((v3 < 86) || (v2 + 90)) / 2);
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        a0[12] = (((a1[1][8] != v3) + (58 != 75)) - ((26 ? 81 : i2) == (32 % 5)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            a0[4] = (((i2 + a0[0]) && (a1[2][0] >= i3)) == ((30 + a1[0][12]) * (v3 != v0)));
+            v2 = (((55 / 5) >= (a1[1][12] <= a1[2][2])) || ((i3 && a1[3][0]) / 4));
+            v1 = (((v2 < v2) < (25 <= 17)) / 5);
+        }
+        v0 = (((a1[0][13] <= a0[0]) > (v1 > v2)) * ((v3 <= v0) * (v0 != 71)));
+    }
+    if ((((v1 % 6) <= (v2 < v2)) ? ((49 == a1[0][15]) - (a1[3][6] - 63)) : ((a1[0][15] ? 29 : a1[3][11]) % 3))) {
+        a0[15] = (((45 * v0) % 4) || ((30 + v0) > (v2 ? 86 : v1)));
+        v2 = (((v3 || 72) + (a0[0] != 91)) <= ((85 != v2) <= (v1 || v1)));
+        v2 = (((v0 == v2) / 5) + ((a0[13] && v2) % 6));
+    } else {
+        v0 = (((a0[4] >= v2) >= (v1 || 62)) || ((v3 / 3) > (52 / 1)));
+        v0 = (((v3 + a0[7]) / 5) ? ((v2 * 67) ? (v1 == a0[7]) : (a1[0][2] >= v3)) : ((v0 % 6) * (v3 == v2)));
+        v2 = (((a1[0][5] != 29) && (60 ? a0[7] : v0)) != ((v0 % 4) * (v2 <= 14)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    if ((v3 + i5) > 62) break;
+                    v0 = (((a0[1] % 5) ? (0 % 4) : (i4 / 9)) && ((13 > v3) ? (v2 < 80) : (v1 ? 25 : v2)));
+                    v3 = (((a1[1][8] ? 96 : v0) < (21 || i5)) ? ((v3 < v1) < (25 - 72)) : ((v3 + 71) || (32 >= v2)));
+                    v1 = (((i4 ? v0 : i5) < (a0[11] ? a1[3][11] : 4)) + ((i5 || a0[2]) > (v1 && 61)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            a0[3] = (((56 * v2) + (a0[7] / 8)) && ((a0[2] <= a1[0][13]) >= (53 + 59)));
+            a1[2][12] = (((i4 && v2) >= (12 >= 16)) % 9);
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                if ((v2 > i7) > 93) break;
+                a1[1][4] = (((a1[1][2] && i6) > (i7 ? a1[1][7] : i7)) % 2);
+                v0 = (((39 ? a1[3][1] : v2) != (23 == 57)) > ((i7 <= a1[3][7]) == (i6 >= a1[0][1])));
+                v3 = (((v3 < 45) - (i7 != a0[15])) ? ((v1 / 4) >= (40 || v1)) : ((v0 * i7) % 2));
+            }
+            a1[2][14] = (((v0 * a1[3][14]) < (v2 && v1)) || ((a1[3][10] && v3) < (v2 || v3)));
+            v3 = (((a0[8] >= v0) + (a1[3][11] - v1)) && ((v0 == v1) * (v0 % 1)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((58 && 35) <= (v3 < v0)) + ((84 != v3) % 2));
+}
+int f2() {
+    int v0 = 15;
+    int v1 = 94;
+    int v2 = 40;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v2 + i0) > 92) break;
+            v2 = (((i0 % 1) % 6) >= ((a1[2][4] >= v1) ? (26 % 5) : (9 - 76)));
+            v3 = (((a0[3] == v0) || (a0[1] <= v0)) / 2);
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((a0[8] * a1[0][6]) > 72) break;
+                v3 = (((32 < a0[12]) > (43 != v3)) != ((14 + v0) > (i0 == a0[12])));
+                v3 = (((73 ? i0 : i0) % 2) < ((v0 != v1) / 5));
+                v0 = (((v0 >= v2) > (94 ? 19 : a1[1][0])) >= ((a1[2][9] * 79) % 8));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a0[4] = (((a0[0] > v0) > (v1 >= a1[2][3])) && ((v0 == a1[0][8]) >= (v2 / 5)));
+        v2 = (((i2 < a0[14]) > (a0[6] % 6)) < ((i2 / 6) <= (v1 == v2)));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((v3 <= a1[0][1]) > (a1[0][5] + 69)) ? ((v2 >= i2) ? (82 && v0) : (v3 ? v0 : v3)) : ((88 >= a0[10]) / 8));
+                v2 = (((v3 / 5) != (v0 ? i3 : 90)) >= ((58 && 81) % 2));
+                v1 = (((v2 / 4) <= (a0[1] > a0[13])) / 2);
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    if ((((v1 || v3) && (a0[4] ? v1 : 13)) >= ((70 > 52) <= (v0 % 9)))) {
+        v2 = (((v0 ? a0[10] : v2) >= (v3 >= 50)) == ((v1 <= v3) % 2));
+        a1[1][15] = (((v3 != a1[2][4]) - (v2 < a0[2])) ? ((a1[3][6] == v0) / 6) : ((91 && v1) ? (a0[3] <= 54) : (38 == v3)));
+        v0 = (((59 <= v2) && (v3 <= v2)) >= ((v1 + v2) / 6));
+    } else {
+        a1[2][13] = (((a0[7] || v0) > (v3 > a0[4])) - ((12 >= a0[7]) / 8));
+        a1[2][3] = (((v3 && v0) || (v2 >= v0)) == ((v3 * v0) <= (v1 == a1[0][8])));
+        v2 = (((v3 / 5) ? (75 * v1) : (a0[9] * v2)) < ((a1[0][3] * a1[2][9]) ? (a1[3][14] + a0[4]) : (v0 == 21)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((53 <= 73) > 55) break;
+            v3 = (((v0 == a1[3][4]) && (a1[3][6] ? v2 : v1)) * ((v1 - v1) + (95 == 90)));
+            v2 = (((i4 - 13) % 9) > ((i4 != v3) / 4));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                a0[5] = (((a0[13] > i5) || (v0 && a0[3])) / 5);
+                a0[13] = (((81 + v3) % 3) > ((a1[1][9] <= 32) ? (9 / 1) : (v3 != i4)));
+                v1 = (((3 * a1[1][3]) / 6) && ((47 ? v2 : v2) % 1));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((15 <= 65) ? (v1 + 58) : (76 < 42)) != ((v0 ? v0 : v2) + (v0 || 32)));
+    return (((v2 <= 56) == (v1 == 63)) < ((46 * a1[3][6]) - (a0[6] || 26)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,53 @@
+int f0() {
+    int v0 = 9;
+    int v1 = 66;
+    int v2 = 62;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v3 ? v3 : 8) / 3) < ((a1[3][0] > v1) ? (v3 / 9) : (v0 % 8)));
+    v1 = (((27 + 6) % 9) || ((a0[10] && v0) <= (25 % 5)));
+    if ((((v0 * v0) * (9 ? v1 : v3)) || ((v3 && v1) + (v3 * v2)))) {
+        v0 = (((a0[7] < v0) > (v1 - a0[13])) && ((v2 - v1) / 1));
+        a0[14] = (((a1[0][2] <= a1[1][13]) || (v1 != a0[15])) - ((79 < v1) ? (11 <= a1[3][11]) : (v2 % 1)));
+        v2 = (((v2 != a1[0][10]) != (a0[9] < v1)) == ((66 || v2) >= (43 <= a1[3][9])));
+    } else {
+        v1 = (((24 != a1[0][9]) != (a0[8] ? v0 : 16)) || ((v0 >= 85) < (v0 + a1[2][7])));
+        a0[14] = (((a1[2][1] ? v3 : v0) ? (v3 - v2) : (v2 != v1)) >= ((a1[0][2] || v1) * (v2 >= a1[0][10])));
+        v2 = (((v2 <= v2) != (v0 <= v2)) || ((v0 >= v3) - (v1 * 64)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v2 = (((i0 || v1) == (i0 < a1[3][11])) * ((a0[12] ? 62 : v3) && (34 / 9)));
+                v3 = (((a1[1][12] * v3) && (30 % 5)) - ((19 / 6) + (a0[1] / 7)));
+                a1[3][2] = (((35 + 41) + (a1[0][1] + 40)) * ((44 <= a1[1][15]) + (a0[14] - v3)));
+            }
+            v2 = (((94 == a1[2][13]) * (22 == a1[1][14])) != ((i0 || v3) > (a0[9] || 73)));
+            v2 = (((a0[8] != v3) * (91 - a0[12])) <= ((a1[2][10] == 80) ? (v0 && 50) : (a1[0][7] ? 78 : a1[0][3])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v2 = (((a1[2][13] < v0) * (a1[0][13] - i2)) % 7);
+            a0[12] = (((a1[0][11] < i2) ? (a0[11] / 7) : (v1 && v2)) / 8);
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a1[1][3] || v2) * (v2 && 51)) / 9);
+                    v0 = (((a1[0][12] * v1) >= (i3 >= a0[10])) + ((v3 || i2) > (v3 * i3)));
+                    a0[9] = (((a0[1] == 75) + (i2 + 9)) >= ((a1[3][13] - i2) ? (a0[10] >= 3) : (a1[0][4] - a0[10])));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((v1 > a1[3][13]) < (a0[7] ? a0[12] : a0[13])) / 6);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,97 @@
+int f0() {
+    int v0 = 9;
+    int v1 = 67;
+    int v2 = 35;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 - v0) % 5) ? ((51 / 5) * (v1 ? 92 : a0[6])) : ((54 == a1[0][12]) == (43 % 9)));
+    a1[1][14] = (((a1[1][10] && 56) == (a0[9] <= v2)) && ((v3 == v2) < (v0 == v0)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v3 = (((65 != 13) / 1) < ((v0 * v1) <= (64 ? 56 : 98)));
+                    v0 = (((v1 * a1[1][7]) / 5) || ((i0 ? a0[1] : v0) <= (v2 > 81)));
+                    v2 = (((v0 <= 4) <= (77 + v2)) && ((v0 * 50) % 2));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a0[14] == a0[4]) != (v3 * 26)) && ((a0[14] * v3) || (a0[13] && a0[7])));
+            a0[11] = (((v3 ? 47 : 62) >= (i0 * v0)) || ((a1[0][13] + 60) - (44 - v1)));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v1 + v2) ? (v1 && 42) : (v2 % 8)) != ((93 % 1) - (16 ? v2 : v3)));
+    v3 = (((v1 >= 20) <= (v0 != 80)) > ((76 ? a0[10] : a0[12]) * (v3 == a0[13])));
+    return (((v3 < v0) > (v3 || a1[2][13])) != ((44 <= v3) && (v3 / 3)));
+}
+int f1() {
+    int v0 = 30;
+    int v1 = 50;
+    int v2 = 40;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[11] + 94) + (v0 ? v0 : v1)) == ((v0 / 3) < (v2 % 4)))) {
+        v0 = (((3 ? v1 : a1[0][4]) == (56 + 7)) || ((69 > v2) - (15 < a1[1][15])));
+        v0 = (((30 == v2) ? (55 < a0[5]) : (v2 != 89)) > ((v2 ? v2 : a0[6]) ? (23 >= v0) : (v3 || a1[1][2])));
+        a0[6] = (((v0 / 9) && (a0[13] % 9)) + ((v2 != 77) || (76 < v2)));
+    } else {
+        a0[4] = (((v1 != v1) + (v3 <= 81)) <= ((v3 - v1) + (v0 ? 77 : v3)));
+        v2 = (((a1[1][11] + v3) || (v1 - a1[2][8])) > ((25 <= a1[0][8]) / 3));
+        a1[1][9] = (((v0 / 4) != (v2 + v1)) == ((a1[0][3] >= 14) <= (v3 + 57)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            a0[12] = (((i0 || v3) - (a1[2][0] == 73)) ? ((a0[8] - 71) / 7) : ((v2 * v2) % 6));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    if ((v0 * v3) > 72) break;
+                    v2 = (((88 <= i1) >= (24 >= v3)) - ((37 < i0) <= (a1[1][6] > i0)));
+                    a0[14] = (((i0 / 7) != (a1[2][15] - 63)) + ((34 ? 8 : 96) + (a0[11] - a1[2][6])));
+                    a0[7] = (((a1[1][11] >= v0) + (v3 <= 43)) >= ((a0[14] < 96) + (i0 / 8)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a1[3][14] % 9) > (v2 % 9)) && ((a1[1][13] >= a0[12]) >= (v3 >= i0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v1 || 33) > 73) break;
+            a0[10] = (((a1[1][1] / 6) ? (19 + v0) : (a0[2] ? 19 : 16)) / 8);
+            v1 = (((a1[3][1] % 9) - (52 ? v3 : 8)) != ((27 % 7) && (72 != i2)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((37 * 10) >= (v0 > v1)) >= ((v3 == a0[10]) >= (a1[2][10] && v1)));
+                    v0 = (((24 < v2) ? (42 ? 63 : 44) : (58 ? v0 : a1[2][6])) + ((v0 || v2) ? (i2 / 6) : (a0[1] < a1[2][12])));
+                    v3 = (((v3 > 76) < (v1 - v1)) <= ((47 <= i3) != (v0 < v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((a1[0][3] || 57) <= (10 != v1)) > ((v1 || a1[3][12]) ? (v0 < 99) : (86 < v1)));
+    if ((((v1 ? v2 : v3) >= (v1 + a1[1][10])) ? ((12 < 18) <= (v0 > v0)) : ((v1 != v0) > (53 * a0[3])))) {
+        v0 = (((5 != v3) <= (60 + v0)) ? ((v0 ? v3 : v0) * (a1[0][2] >= 52)) : ((28 == v0) >= (v0 < 41)));
+        v1 = (((51 - 76) * (a0[5] != a0[15])) || ((a1[2][11] >= v1) + (a0[2] != v0)));
+        v0 = (((v0 - v0) - (a1[3][14] - v2)) <= ((a1[0][13] < v3) && (11 ? v0 : v3)));
+    } else {
+        v1 = (((v0 > v0) && (a1[2][14] ? 46 : v0)) == ((v1 - a1[0][14]) < (77 * v1)));
+        v1 = (((v1 && v0) * (a1[2][14] >= v2)) ? ((v2 <= 96) >= (v3 && v1)) : ((v3 || 97) <= (v0 || v2)));
+        v0 = (((v1 || v3) ? (v1 > a1[3][7]) : (a1[0][4] || v3)) % 3);
+    }
+    return (((a1[1][4] || a0[12]) % 7) ? ((v1 != a0[13]) % 3) : ((a0[9] / 4) < (73 ? 70 : a0[11])));
+}
+int main() {
+    return 0;
+}
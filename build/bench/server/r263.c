@@ -0,0 +1,210 @@
+int f0() {
+    int v0 = 90;
+    int v1 = 35;
+    int v2 = 76;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v0 = (((a0[2] && i0) > (v3 - 74)) ? ((i0 == a1[1][5]) || (v3 ? i0 : a1[0][1])) : ((i1 % 9) / 4));
+                    a0[9] = (((i1 + 33) != (20 ? v0 : a0[9])) || ((a1[1][2] - i1) > (68 ? v3 : v2)));
+                    v3 = (((v0 / 4) ? (a1[3][4] && i0) : (a1[3][3] ? v0 : i1)) <= ((a0[6] % 6) < (v2 + i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v3 && 45) / 7) != ((v0 || a1[1][8]) && (v2 * v1)));
+            a0[0] = (((a0[15] >= i0) + (78 || 95)) % 9);
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[1][14] = (((68 * v2) <= (v2 && i2)) || ((i2 ? a1[2][10] : 77) ? (1 && i2) : (64 ? a1[0][15] : a0[1])));
+            a0[14] = (((a0[15] * v2) != (80 == a0[7])) <= ((v3 * 60) == (i2 && v3)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a1[1][8] + a0[2]) && (v2 <= a1[2][7])) < ((a1[0][13] * 67) - (a1[1][15] * a1[1][8])));
+                    v0 = (((34 <= v0) && (i2 != 94)) >= ((v2 % 9) || (a0[7] && a1[1][11])));
+                    a1[3][13] = (((2 / 8) ? (v3 * a0[0]) : (v1 == 56)) > ((a0[0] <= v3) * (35 ? i2 : v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v0 * a0[14]) >= (v1 - v0)) < ((a1[0][13] % 1) == (v3 ? v2 : a1[0][12])))) {
+        a1[1][10] = (((v1 == a1[0][15]) != (v2 ? v3 : v0)) > ((v3 == v0) + (v2 == a1[0][10])));
+        v1 = (((v1 && v1) - (v1 && v3)) % 5);
+        v1 = (((a0[10] || 50) <= (v1 / 2)) * ((v1 || v0) / 8));
+    } else {
+        a1[1][3] = (((a1[3][14] >= 71) % 7) * ((a1[1][13] ? v0 : v1) && (a1[3][2] || v1)));
+        a1[2][12] = (((28 - 12) ? (a0[6] >= 72) : (18 != a0[12])) * ((a1[3][1] >= v2) ? (a0[3] && a1[3][13]) : (v2 == a1[1][6])));
+        a1[2][2] = (((94 <= v0) - (v3 % 4)) / 1);
+    }
+    if ((((v0 && 65) - (v1 * v2)) % 3)) {
+        a1[3][6] = (((v2 && a1[3][0]) * (a1[0][7] || v1)) || ((v2 == a1[1][9]) - (v2 + v1)));
+        v3 = (((a1[3][9] != v3) > (a0[11] * 10)) % 9);
+        a0[0] = (((23 - a0[2]) && (a1[2][5] > a0[11])) != ((36 * a0[6]) < (a0[0] > v1)));
+    } else {
+        v2 = (((v0 < v0) && (v1 / 2)) * ((4 <= a0[5]) <= (a1[1][10] <= 2)));
+        a1[2][9] = (((a0[2] || v0) * (v2 / 5)) != ((v3 + v2) + (v2 / 5)));
+        v0 = (((v3 == v3) && (a1[0][0] + v3)) != ((v0 || 85) + (v1 || v3)));
+    }
+    if ((((a0[15] + v3) > (v3 || v0)) + ((v0 == a0[6]) || (v1 != v2)))) {
+        v2 = (((v1 ? v1 : v3) ? (92 == v2) : (v3 || a0[6])) * ((84 % 5) <= (a1[2][13] <= 86)));
+        v2 = (((v2 * a1[1][8]) >= (v2 == v3)) > ((v1 > a1[0][1]) == (v0 || a0[11])));
+        a1[3][12] = (((v0 + a1[0][0]) != (41 <= 5)) < ((74 >= v3) != (a0[3] || v2)));
+    } else {
+        v1 = (((v2 - v2) && (v3 + 18)) != ((v2 <= a1[0][6]) / 2));
+        v3 = (((v0 * v3) - (v3 - v3)) > ((v3 * v3) < (v0 % 7)));
+        a1[3][10] = (((v0 >= a1[0][4]) && (64 % 4)) >= ((71 != v0) && (a0[15] * v3)));
+    }
+    return (((v3 != 70) >= (56 - v1)) || ((92 - a0[9]) == (v3 > v1)));
+}
+int f1() {
+    int v0 = 75;
+    int v1 = 53;
+    int v2 = 59;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    a1[0][0] = (((v3 == v0) <= (v3 != v3)) >= ((4 > v3) % 8));
+                    v1 = (((i1 != v0) / 8) < ((v0 - i0) <= (v3 && a1[2][6])));
+                    v3 = (((a0[0] || a0[2]) <= (v1 == v0)) >= ((i1 || a0[15]) < (v1 && i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((v2 && v1) ? (v3 / 4) : (37 != v0)) < ((40 % 1) != (70 > 28)));
+            v2 = (((v1 ? v2 : v3) && (v0 && i0)) ? ((i0 % 1) + (8 && v3)) : ((37 != a1[3][14]) != (43 ? 81 : 13)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v2 = (((a1[1][10] / 4) / 6) == ((v3 <= v0) * (a0[9] ? v0 : 55)));
+    v3 = (((61 - 42) - (53 <= v2)) < ((3 ? 5 : a1[1][10]) - (v0 >= a0[10])));
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v3 = (((v2 >= v3) ? (a1[3][1] ? 7 : 39) : (a1[1][8] / 1)) * ((i2 > v0) - (23 / 6)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((88 || v2) || (v0 >= 36)) || ((a0[5] + v1) / 2));
+                    v1 = (((a1[3][11] && v3) * (4 >= v0)) + ((v3 && i3) != (35 % 8)));
+                    v2 = (((v0 * a1[3][6]) || (8 % 6)) >= ((i2 - v0) >= (i2 % 7)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            a0[14] = (((i2 > i2) - (v2 == a0[11])) ? ((v0 ? v0 : i2) > (31 != v0)) : ((i2 ? v2 : v3) > (v2 != v1)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((46 ? 3 : v3) > 88) break;
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                if ((v3 % 6) > 70) break;
+                a0[9] = (((a1[0][5] || 21) + (a1[1][4] == v3)) != ((a1[2][12] || a0[2]) - (i4 / 1)));
+                v2 = (((v1 && 40) && (i4 && v1)) % 5);
+                v3 = (((a1[1][7] && a1[0][9]) != (v0 * v0)) - ((71 ? 22 : i5) <= (82 == i4)));
+            }
+            v1 = (((a1[3][3] >= v2) - (a0[12] || v2)) != ((v1 > v0) != (95 <= a0[2])));
+            v2 = (((52 && a0[1]) % 9) && ((a0[0] || v0) ? (i4 / 7) : (33 / 8)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((v2 > v3) > (a0[6] / 1)) != ((v1 && a0[15]) * (v0 == 77)));
+}
+int f2() {
+    int v0 = 38;
+    int v1 = 59;
+    int v2 = 24;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((v1 * 45) ? (97 * i0) : (85 / 3)) * ((v3 > a1[1][10]) != (v1 <= a0[6])));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v3 = (((59 ? i0 : a1[1][5]) % 7) < ((3 ? i0 : v2) <= (v3 == 99)));
+                    a1[2][9] = (((a0[6] != i0) < (i0 ? 10 : i0)) == ((51 - v3) >= (a1[3][2] <= v3)));
+                    v1 = (((i1 < 57) ? (v1 == a0[11]) : (v2 + 61)) + ((a0[4] ? 26 : 49) == (v2 > i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[0] = (((a0[10] >= 72) <= (5 + v0)) > ((v3 > v1) / 3));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v3 = (((62 >= a0[8]) >= (v0 > v3)) ? ((v2 ? 88 : i2) >= (v2 == 5)) : ((v0 - a1[3][14]) < (v3 + i3)));
+                v1 = (((v0 - i3) / 2) != ((a1[0][8] / 4) + (v0 - v1)));
+                v1 = (((97 + 83) <= (v3 || a1[0][6])) > ((i3 || i2) == (i3 <= v2)));
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((57 % 5) ? (v3 > a1[0][4]) : (a0[5] > 69)) ? ((98 * 38) > (a1[1][9] >= a0[6])) : ((62 < v2) * (v2 <= a0[3])));
+        a1[2][15] = (((i2 % 5) == (47 + v2)) ? ((a1[3][3] >= a1[3][6]) != (a0[9] >= 91)) : ((a1[2][14] && v1) <= (v1 / 8)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((v0 < v3) > 78) break;
+        a0[2] = (((v1 || v0) + (98 < 4)) ? ((50 <= v2) - (74 ? 53 : v2)) : ((14 ? v0 : v0) * (i4 > a0[6])));
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            if ((i4 - v3) > 84) break;
+            v2 = (((66 ? v0 : v2) / 1) == ((8 != v0) && (a1[3][7] - v3)));
+            v0 = (((i4 == a1[0][7]) <= (a0[13] <= 42)) / 8);
+            v1 = (((a1[2][12] % 3) ? (v1 % 2) : (i4 - 48)) ? ((88 <= a1[1][11]) && (54 || v1)) : ((v0 ? v2 : a0[11]) ? (a1[1][4] <= i5) : (a1[1][15] || i4)));
+        }
+        v1 = (((73 == 1) == (v0 <= a0[2])) == ((92 != i4) < (v0 - v3)));
+    }
+    if ((((v2 ? v1 : v1) ? (v1 + a1[3][11]) : (3 % 8)) >= ((v1 % 9) < (a1[1][12] - v2)))) {
+        v2 = (((v3 || 99) != (v0 >= 1)) % 5);
+        v0 = (((v2 + v3) || (v1 / 2)) * ((v1 < v1) != (v3 <= v0)));
+        v3 = (((21 - v2) ? (22 ? a1[1][2] : 51) : (v2 + 5)) % 9);
+    } else {
+        v3 = (((v2 != a0[9]) < (46 && a1[3][4])) >= ((v3 < a1[2][3]) + (10 ? 75 : v0)));
+        a1[2][13] = (((v3 ? v2 : 4) * (12 <= v0)) / 3);
+        a0[7] = (((79 == v1) <= (v3 >= a1[0][14])) % 1);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 3) {
+            v2 = (((v3 <= v0) ? (i6 >= v3) : (a0[1] == a0[0])) == ((22 < v3) + (a0[8] && v3)));
+            a1[3][2] = (((v0 - v2) ? (49 ? i6 : a1[0][15]) : (v2 ? i6 : a1[3][1])) ? ((v1 % 8) < (73 ? a1[0][15] : 27)) : ((v1 + a0[12]) > (a0[10] == a1[1][1])));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    if ((i7 && i6) > 60) break;
+                    v3 = (((v0 != 44) * (67 <= v2)) % 2);
+                    v3 = (((72 < 83) * (50 + v1)) - ((47 || i7) - (88 ? a0[9] : v0)));
+                    v0 = (((83 >= v2) != (v0 >= v2)) - ((78 ? a1[0][12] : 24) || (v2 * v3)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v0 < v0) + (42 || a1[2][0])) - ((v2 && v0) ? (37 <= 1) : (v0 && v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,58 @@
+int f0() {
+    int v0 = 25;
+    int v1 = 83;
+    int v2 = 70;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v0 / 6) && (91 && a0[9])) != ((19 <= v0) / 6));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v2 = (((i1 != i1) * (v1 - 1)) > ((99 / 9) < (35 % 8)));
+                a1[0][0] = (((a1[1][3] < i0) == (v0 <= i0)) * ((a1[0][1] < i1) < (i0 || i1)));
+                a1[0][10] = (((71 * 34) - (v3 < 21)) > ((i1 / 7) && (v0 ? 53 : v0)));
+            }
+            v3 = (((a0[15] <= a0[11]) > (a1[1][13] < 14)) || ((v1 != a0[7]) * (v1 % 4)));
+            a0[1] = (((a0[0] + a1[2][13]) + (i0 && v2)) ? ((v1 || v2) > (v3 != v0)) : ((61 <= a1[1][3]) && (i0 * i0)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v2 = (((v1 || a1[1][3]) * (v1 != 51)) - ((a0[11] + v1) - (i2 - v1)));
+            a0[7] = (((v0 * a0[5]) == (v0 != v2)) ? ((a0[9] != 37) || (v2 == 22)) : ((v2 <= a0[3]) >= (a0[12] || v3)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((80 != 86) > 76) break;
+                    v1 = (((a0[10] < 5) + (i2 != a0[13])) ? ((62 < v1) * (a1[1][8] ? v1 : v2)) : ((7 ? i3 : 3) > (v3 > v2)));
+                    v1 = (((i3 / 8) * (24 % 2)) >= ((85 ? a0[4] : 49) <= (45 ? a1[2][6] : v1)));
+                    v0 = (((v2 != v0) < (i2 / 7)) ? ((a1[0][0] ? a1[0][9] : i2) / 8) : ((42 * a0[12]) % 1));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((v3 < a1[2][8]) * (v1 >= i4)) % 5);
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                v1 = (((v3 != a0[2]) == (80 ? a0[4] : a0[11])) / 9);
+                a1[3][2] = (((i5 || a0[4]) <= (21 || v0)) ? ((81 % 3) != (a0[11] <= 88)) : ((a1[1][1] && a1[2][14]) <= (a0[13] != 44)));
+                v0 = (((12 ? a1[2][6] : v3) >= (a1[1][9] % 3)) > ((63 != v1) ? (45 || i5) : (95 == v2)));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((v1 - a0[3]) >= (v1 > a0[9])) || ((81 == 40) - (48 > a1[2][4])));
+    }
+    a1[3][13] = (((48 || v1) / 7) * ((20 ? a0[6] : 5) || (69 <= 2)));
+    return (((3 != v1) * (60 % 2)) * ((a1[1][9] || v3) <= (v0 ? v1 : a1[1][4])));
+}
+int main() {
+    return 0;
+}
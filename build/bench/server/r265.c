@@ -0,0 +1,129 @@
+int f0() {
+    int v0 = 46;
+    int v1 = 3;
+    int v2 = 51;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((58 != i0) > 89) break;
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((46 != i0) * (i0 != 58)) + ((64 + i1) - (8 - 57)));
+                    v2 = (((v2 * 43) % 7) - ((v0 != a1[0][0]) * (a0[3] ? 22 : 68)));
+                    v0 = (((v3 != a0[15]) / 2) ? ((89 * 13) ? (64 < 59) : (1 == v0)) : ((i0 != a1[1][15]) / 7));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            a1[0][7] = (((99 > a0[13]) <= (v3 >= a0[13])) != ((a0[14] < v3) > (v2 || v2)));
+            v0 = (((v0 != a0[2]) ? (v1 > v1) : (45 > v1)) < ((45 && 63) > (a1[3][11] ? a1[2][5] : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((52 ? a1[0][13] : v2) > 85) break;
+            v2 = (((5 % 7) ? (i2 == v1) : (a0[9] != v1)) != ((v0 >= 83) == (21 * i2)));
+            a0[2] = (((a1[0][9] != v1) - (i2 / 2)) - ((v1 ? 3 : v3) >= (a0[6] < v1)));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((i3 >= v2) * (a1[3][0] != 11)) < ((i2 % 5) > (v0 * v1)));
+                    a1[2][15] = (((a0[5] < v2) == (i3 >= v1)) ? ((v3 / 3) - (84 < a0[10])) : ((v2 >= a0[6]) <= (a0[2] + 70)));
+                    v3 = (((7 > v1) == (v2 ? a1[0][8] : 34)) < ((v0 != v3) + (a1[1][14] <= 53)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[15] = (((74 / 1) ? (v1 ? v0 : 59) : (i4 ? i4 : i4)) == ((48 > 12) / 6));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    a1[2][3] = (((89 <= a1[0][8]) > (i5 < 38)) ? ((i4 % 6) * (a1[1][11] % 4)) : ((a0[0] != i5) % 5));
+                    a0[13] = (((a1[0][11] - 59) <= (v1 + 29)) <= ((v2 || v1) ? (a0[10] == 11) : (v0 + i4)));
+                    v1 = (((v1 <= 69) ? (a1[1][8] / 5) : (55 == v0)) || ((a1[1][12] ? v3 : 55) / 5));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((i4 % 6) + (49 + v0)) || ((v2 ? v0 : v3) > (v3 == a1[2][8])));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((v1 % 6) - (a1[1][15] >= v1)) + ((i6 / 5) < (56 - 23)));
+            v0 = (((23 + v3) != (v0 ? i6 : v0)) - ((19 >= v1) || (21 + 92)));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    a0[15] = (((i6 || v1) || (71 ? a0[0] : a1[2][1])) * ((42 || a1[2][14]) || (v0 > v3)));
+                    v1 = (((v3 / 2) >= (98 > 68)) == ((v3 >= 40) >= (a0[9] || v3)));
+                    v1 = (((38 && v0) < (a0[9] ? 49 : 58)) % 2);
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    {
+        int i8 = 0;
+        do {
+            a0[12] = (((i8 && v1) ? (76 != v0) : (i8 < 58)) / 9);
+            a0[0] = (((87 >= i8) % 8) - ((v1 <= a1[2][4]) % 1));
+            {
+                int i9 = 0;
+                while (i9 < 2) {
+                    v0 = (((a1[3][4] + 47) ? (a0[14] != v0) : (a0[11] < v2)) > ((v0 == a1[1][0]) ? (a0[14] < v1) : (i8 != v0)));
+                    v3 = (((i8 && v3) + (v3 * a0[7])) <= ((i9 - a1[2][2]) <= (97 > a0[10])));
+                    a0[10] = (((51 - 48) <= (v0 > 97)) > ((a1[3][5] - v2) || (v0 && a0[12])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        } while (i8 < 6);
+    }
+    return (((a0[6] - 31) && (v3 < v3)) - ((a0[12] > 83) + (v1 < 86)));
+}
+int f1() {
+    int v0 = 11;
+    int v1 = 69;
+    int v2 = 82;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[1] && a0[2]) || (a0[7] == v1)) >= ((v1 / 2) > (v1 - a1[2][15])))) {
+        v3 = (((a0[8] + v2) <= (v2 < 65)) >= ((v3 != v2) ? (a0[1] != v0) : (v0 - v2)));
+        v0 = (((v0 + 74) || (52 > 85)) > ((17 ? v3 : v1) && (10 < a1[2][14])));
+        a0[14] = (((a0[13] ? 91 : 34) + (a1[0][14] + 78)) / 9);
+    } else {
+        v2 = (((v3 - a1[1][1]) > (v1 >= v1)) > ((a0[6] ? a1[0][8] : v0) == (13 != v0)));
+        v3 = (((v2 <= v2) % 3) % 5);
+        a0[0] = (((v0 != a0[8]) * (a1[0][5] > 90)) * ((76 + a0[15]) != (52 && 92)));
+    }
+    a0[12] = (((v3 % 8) ? (a0[1] % 8) : (v3 && v1)) % 5);
+    if ((((v1 * v0) > (v0 && v3)) / 4)) {
+        v2 = (((v0 + a0[14]) != (v3 % 5)) / 3);
+        v2 = (((v1 != v0) + (v1 != v2)) - ((v0 != v1) ? (16 > v2) : (59 == a0[12])));
+        v0 = (((v3 - v0) != (v0 >= a1[3][8])) == ((92 > v1) && (23 || 50)));
+    } else {
+        a1[3][6] = (((v1 <= a0[7]) ? (v3 && v1) : (76 <= v3)) + ((49 != 34) != (91 ? a1[3][9] : a0[13])));
+        v1 = (((a1[2][8] * v3) == (a0[6] <= 1)) >= ((v2 - a0[4]) - (v0 % 9)));
+        v0 = (((73 ? 48 : v1) > (98 % 3)) % 7);
+    }
+    a1[1][6] = (((v1 - v0) % 7) < ((v2 || a0[2]) <= (a1[0][5] <= v0)));
+    a0[4] = (((a0[6] == a1[1][10]) != (v1 / 9)) * ((a1[0][9] ? v0 : 69) + (73 && v0)));
+    return (((88 < v2) * (60 / 3)) >= ((87 % 4) % 8));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,180 @@
+int f0() {
+    int v0 = 41;
+    int v1 = 8;
+    int v2 = 80;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v2 = (((a1[3][1] >= v3) % 4) == ((18 * 81) && (a1[3][1] >= v3)));
+            a0[6] = (((1 <= a0[12]) % 2) != ((v2 + v2) < (v2 == a1[0][2])));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((i0 < 98) == (v2 - a0[5])) / 2);
+                    a0[4] = (((a0[5] || v0) <= (v0 + a1[2][15])) * ((i0 != i1) / 1));
+                    v3 = (((i1 - a0[0]) <= (a1[3][0] == 43)) - ((39 >= v1) - (14 == a0[4])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[10] = (((15 ? v2 : a1[1][2]) / 9) >= ((v1 > a0[4]) == (v0 > 64)));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                v3 = (((v3 || a0[4]) != (i3 >= i3)) > ((v0 * a1[3][9]) / 3));
+                v3 = (((21 * i3) ? (53 ? a1[2][2] : i2) : (i3 % 8)) / 6);
+                v2 = (((47 >= i2) * (v3 % 1)) && ((a1[0][5] / 8) && (v0 && 10)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((61 != 70) / 2) ? ((v0 <= a1[1][6]) / 1) : ((v3 <= v2) % 9));
+    }
+    v1 = (((v1 - a1[3][2]) >= (v3 <= v3)) + ((v2 + 10) - (v0 > a1[0][13])));
+    if ((((v1 == a1[1][13]) < (60 <= a1[3][14])) + ((34 % 9) != (v1 <= a0[13])))) {
+        a0[3] = (((31 ? 88 : v0) && (v0 - a0[3])) * ((a1[1][5] == a1[0][13]) > (v1 >= v3)));
+        v1 = (((70 == v2) != (a0[0] && a1[0][2])) ? ((55 + a0[11]) + (a1[3][13] ? 87 : a1[3][4])) : ((a1[1][11] == v3) && (a1[0][1] ? v2 : v2)));
+        v3 = (((v0 ? 33 : v3) <= (v2 ? a1[3][15] : v3)) > ((v3 != v1) == (v0 % 8)));
+    } else {
+        v2 = (((v2 < v3) + (v1 ? v3 : 47)) ? ((a1[3][12] < 74) + (56 * 17)) : ((a1[2][8] > a1[2][1]) == (v2 - a0[15])));
+        v0 = (((91 + a1[0][4]) - (a1[2][10] + v1)) % 9);
+        a1[1][0] = (((a0[8] <= v3) ? (a1[1][13] / 3) : (a1[2][8] == 10)) || ((v0 ? v0 : v2) || (v3 % 5)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            v2 = (((a1[0][3] ? v2 : i4) && (v1 % 2)) * ((43 <= v0) >= (v1 == i4)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v3 = (((v2 + v2) != (v2 ? a1[1][13] : v0)) - ((i5 != i4) < (a1[1][10] && 77)));
+                    v0 = (((a1[3][15] % 4) / 5) || ((19 != 6) && (v3 / 2)));
+                    a1[0][11] = (((i5 % 6) ? (a1[0][7] / 2) : (i4 != v0)) > ((a0[1] ? v2 : i5) == (i4 || a1[0][5])));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v3 && v0) < (v1 / 7)) > ((v3 || v1) * (a0[13] ? v3 : 49)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v0 ? v0 : v3) <= (97 != v1)) <= ((14 % 6) != (a1[1][0] % 7)));
+}
+int f1() {
+    int v0 = 75;
+    int v1 = 47;
+    int v2 = 43;
+    int v3 = 5;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((v3 % 4) > 89) break;
+        v3 = (((a1[2][3] != v3) || (v1 ? a1[0][9] : v2)) - ((39 && a0[0]) != (v1 || 77)));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            if ((a1[2][3] >= 88) > 71) break;
+            v0 = (((37 <= a0[11]) % 8) + ((v1 ? a0[3] : v3) >= (i1 && v0)));
+            v0 = (((22 + i0) || (i0 + a1[1][5])) / 7);
+            a1[3][3] = (((74 > 57) < (v3 != v0)) > ((v1 ? v3 : i1) * (v0 % 9)));
+        }
+        a0[3] = (((a0[7] * 49) != (v3 ? 28 : v1)) / 3);
+    }
+    a0[13] = (((83 ? v3 : a0[13]) + (v3 > v1)) ? ((v0 + v0) || (94 % 5)) : ((v3 / 3) && (v1 * v2)));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((a1[2][8] || i2) > (a1[1][14] <= 55)) == ((95 <= v3) && (a0[3] % 4)));
+        v1 = (((a0[0] < a1[1][7]) ? (v2 ? 75 : 39) : (v0 > a0[5])) || ((v1 == v1) || (v1 ? v3 : 97)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            a0[9] = (((a0[9] % 1) / 9) + ((58 / 8) + (i2 || a0[2])));
+            v0 = (((v1 == v0) || (76 != 1)) == ((15 == v0) ? (89 <= v2) : (2 != 67)));
+            v3 = (((v2 && 55) < (58 % 1)) <= ((i3 != v0) < (v0 < a0[0])));
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v2 = (((68 <= a0[15]) <= (v1 * v2)) + ((i4 >= v0) * (v0 >= v0)));
+            a1[2][3] = (((a1[3][3] == 57) <= (a0[10] ? a1[1][3] : v3)) < ((a1[1][0] == a1[1][5]) * (77 ? 59 : v0)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v2 = (((v2 ? i5 : a0[2]) / 4) % 5);
+                a0[12] = (((95 > v3) < (72 % 9)) && ((29 || v3) * (a1[2][2] >= a1[0][5])));
+                a0[10] = (((i5 * 97) * (a0[13] && v1)) < ((a0[2] < i4) < (v0 - 78)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v2 ? v3 : a0[8]) > (95 % 4)) * ((v3 || v2) ? (v3 ? v0 : v1) : (99 % 3)));
+    return (((85 <= a0[7]) ? (v1 || v2) : (v2 % 1)) - ((15 || 6) <= (v1 == v3)));
+}
+int f2() {
+    int v0 = 18;
+    int v1 = 80;
+    int v2 = 3;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((95 + a0[14]) > 60) break;
+                a0[9] = (((26 != a1[3][2]) * (a0[3] > a1[2][8])) / 2);
+                v3 = (((10 % 8) < (94 && a0[7])) != ((v2 < v2) ? (v3 >= a1[3][5]) : (a1[2][7] <= i1)));
+                a1[1][11] = (((55 % 3) % 7) || ((v0 >= v1) + (i0 <= a1[2][2])));
+            }
+            a1[0][9] = (((v3 != 71) && (a0[3] && v2)) && ((v2 ? a0[11] : v0) && (34 * i0)));
+            v0 = (((46 == a1[3][6]) - (v2 != i0)) * ((i0 == 62) % 1));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v0 = (((a1[2][10] - v1) > (49 <= 19)) / 3);
+            v1 = (((a0[3] % 1) == (v1 % 6)) * ((v1 == a0[7]) ? (v3 >= v0) : (a0[10] == v1)));
+            a1[0][8] = (((v0 || v1) <= (77 >= i2)) <= ((a0[7] * v1) || (i2 >= v2)));
+        }
+        a1[0][11] = (((v0 % 9) < (v0 > v2)) == ((a0[12] >= v2) * (40 ? i2 : a1[0][13])));
+        v2 = (((82 - v1) >= (v1 + 19)) > ((87 == i2) || (a0[8] / 1)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v3 = (((v0 >= 69) || (a0[13] + a1[2][14])) || ((i4 == v0) > (a0[5] % 3)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    a0[5] = (((i5 == v1) % 1) / 1);
+                    v1 = (((v3 % 3) / 5) == ((a1[3][8] <= a1[1][4]) == (i5 % 1)));
+                    v0 = (((8 ? 22 : v0) % 4) < ((v0 * v3) < (38 || a1[0][5])));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((v0 == v0) ? (49 < a1[3][2]) : (46 - a1[2][1])) - ((69 || a0[4]) < (25 || 44)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v0 = (((v0 ? v3 : a0[3]) * (52 % 4)) * ((87 + 66) < (52 != v3)));
+        v2 = (((v1 > 15) == (v3 / 8)) ? ((a0[10] / 3) - (v3 * v0)) : ((30 ? 81 : v0) ? (v0 * v1) : (v1 * a1[3][12])));
+        for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+            v2 = (((v1 == a1[1][2]) - (a1[0][9] + v3)) > ((a1[3][12] / 2) + (v3 / 2)));
+            a0[2] = (((v2 >= v0) / 8) < ((v1 < 6) >= (v2 != i6)));
+            v0 = (((69 > i7) == (34 ? 29 : v2)) * ((i6 >= 87) % 1));
+        }
+    }
+    if ((((v1 % 5) >= (a0[6] && v3)) <= ((v3 > 86) != (v2 || v1)))) {
+        v2 = (((9 <= v2) == (v0 <= v2)) * ((v0 % 6) / 4));
+        v2 = (((v2 ? a0[4] : 40) ? (v2 + a0[6]) : (a1[2][7] == a0[5])) || ((a0[3] ? v2 : 75) ? (61 ? 72 : 10) : (a0[7] > v3)));
+        v2 = (((v1 > v2) > (28 / 8)) - ((a0[8] % 3) - (a1[3][11] && v0)));
+    } else {
+        v1 = (((v1 - v0) ? (v3 && a1[2][1]) : (a0[2] && a1[0][14])) != ((44 % 8) + (1 ? v3 : v1)));
+        v2 = (((75 ? v3 : a1[1][5]) * (44 * v0)) != ((a0[5] - 44) && (v0 % 7)));
+        v3 = (((76 == 93) < (a0[11] - v1)) * ((v3 ? 31 : v0) / 3));
+    }
+    return (((78 < v0) == (12 >= v1)) ? ((a0[1] || v1) > (v3 <= v2)) : ((v2 * a1[0][11]) <= (v3 != v0)));
+}
+int main() {
+    return 0;
+}
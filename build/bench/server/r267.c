@@ -0,0 +1,50 @@
+int f0() {
+    int v0 = 71;
+    int v1 = 53;
+    int v2 = 15;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    if ((((2 >= v1) && (v1 * v3)) || ((44 % 8) == (a0[6] || 99)))) {
+        a0[4] = (((v2 < v1) + (v0 < v1)) && ((v0 != a1[2][7]) && (v0 % 3)));
+        v2 = (((v3 * 40) && (v1 * 99)) - ((v0 - v1) ? (v0 + v0) : (v2 <= v0)));
+        v3 = (((v0 >= 77) ? (13 ? v1 : v3) : (v3 || v3)) >= ((a1[1][6] - v2) ? (v3 != 69) : (v0 >= v3)));
+    } else {
+        v0 = (((26 && 6) != (a0[11] > a0[2])) && ((a1[0][15] < v3) <= (a0[1] ? v3 : a1[2][13])));
+        v2 = (((v3 - v0) - (a1[0][14] >= 83)) && ((v0 != v2) && (a1[2][6] / 5)));
+        v0 = (((a0[12] < v1) - (a0[5] != v0)) || ((a0[4] || v1) / 3));
+    }
+    v3 = (((v0 > a0[1]) ? (a1[2][6] == a0[14]) : (a1[0][14] == v0)) > ((v3 * 71) * (a1[2][15] / 6)));
+    v1 = (((v1 / 2) <= (v1 || 64)) < ((v1 ? a0[2] : v2) != (v3 * 49)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((v1 && v2) > 98) break;
+        v3 = (((i0 == i0) == (73 < a0[2])) % 1);
+        {
+            int i1 = 0;
+            do {
+                v1 = (((v1 >= v0) ? (v0 % 3) : (a0[3] != 46)) <= ((i1 + 87) ? (i0 + 12) : (v2 ? i1 : 29)));
+                v3 = (((a0[11] >= 7) && (9 && a1[2][2])) - ((89 || 30) ? (a0[8] / 1) : (i0 <= 58)));
+                v1 = (((v0 * v2) < (a0[4] + v2)) ? ((36 + i1) ? (a0[12] / 4) : (v1 != i1)) : ((i0 ? i0 : v2) == (22 <= i1)));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v1 = (((v0 && v3) / 2) ? ((v2 ? i0 : v3) % 7) : ((a1[0][6] && a0[11]) ? (36 ? v3 : i0) : (v1 > v3)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a1[0][9] = (((a0[14] + v2) ? (v2 * 55) : (v2 ? i2 : v2)) != ((21 < a0[13]) ? (v2 > v1) : (a1[2][13] == v3)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v3 = (((a0[15] ? v3 : 72) % 2) != ((i2 == i3) > (a1[1][8] * a1[0][0])));
+                v3 = (((v0 < v2) < (v0 + v1)) >= ((26 % 8) ? (i2 == v3) : (v2 && v1)));
+                v1 = (((v1 ? v2 : 25) + (5 > 29)) != ((a0[12] * v3) != (v2 >= a0[0])));
+                i3 = i3 + 1;
+            }
+        }
+        a1[3][7] = (((v0 ? v1 : v0) && (v3 ? v3 : v3)) == ((a0[7] <= a0[2]) > (v0 <= v2)));
+    }
+    return (((v0 > v0) != (v3 > 72)) - ((a0[9] < a0[0]) % 2));
+}
+int main() {
+    return 0;
+}
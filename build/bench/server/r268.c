@@ -0,0 +1,108 @@
+int f0() {
+    int v0 = 40;
+    int v1 = 86;
+    int v2 = 24;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[10] = (((v1 <= a1[0][3]) * (i0 / 9)) + ((a0[3] ? a0[12] : v3) > (i0 - v3)));
+            {
+                int i1 = 0;
+                do {
+                    a0[13] = (((v2 != 21) + (i0 ? a1[0][7] : v2)) > ((42 * v1) ? (v0 == i1) : (a0[10] % 8)));
+                    v1 = (((v1 != v1) ? (42 * v2) : (87 <= 19)) ? ((28 % 4) ? (a1[2][5] <= 22) : (a1[0][3] / 5)) : ((a1[1][5] * v2) % 6));
+                    a1[2][15] = (((i0 ? 63 : a0[9]) != (i1 <= a0[10])) > ((i0 <= 97) + (65 != v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v1 = (((16 <= v0) && (v1 > 76)) <= ((12 == v0) + (12 * a0[13])));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v0 = (((v3 % 2) == (v0 || a0[4])) >= ((v0 || v2) ? (v3 / 2) : (v1 >= v0)));
+    a1[1][0] = (((a0[1] && v1) || (29 <= 90)) * ((v1 + v1) / 5));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        a1[0][4] = (((v0 <= v3) || (v1 > a1[0][13])) == ((17 ? a0[12] : i2) * (a1[0][13] % 4)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a1[0][5] = (((a0[15] + 66) > (43 > 85)) ? ((a0[0] != v2) / 4) : ((a0[4] && a1[1][5]) / 7));
+            v1 = (((i3 - a0[14]) < (v3 % 3)) > ((v1 != 45) / 7));
+            v3 = (((a0[3] * 66) / 9) != ((40 ? a1[3][1] : v2) - (a0[13] % 7)));
+        }
+        a1[1][13] = (((v3 != v1) + (v1 <= v0)) < ((a1[1][12] * v0) < (v3 == a1[2][10])));
+    }
+    v3 = (((v3 % 6) - (a0[14] ? a0[11] : v3)) + ((a0[3] >= 33) / 2));
+    return (((62 + v2) >= (73 < v1)) == ((a1[0][14] % 7) / 6));
+}
+int f1() {
+    int v0 = 79;
+    int v1 = 44;
+    int v2 = 82;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 <= v3) > 74) break;
+            v0 = (((a1[1][4] ? v2 : i0) ? (15 != 5) : (a0[12] && v0)) ? ((v0 % 4) * (a0[13] > v3)) : ((54 ? v1 : v3) ? (v1 <= v3) : (v3 * 37)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v0 = (((v2 * v1) * (v3 != 72)) <= ((v1 * v1) || (i0 ? 54 : v3)));
+                a1[3][2] = (((a0[14] < 70) ? (v3 ? v3 : 28) : (a1[0][3] ? a0[10] : a0[8])) <= ((26 && i1) != (a0[11] / 3)));
+                v1 = (((a1[3][10] >= 15) / 2) > ((v2 > v2) <= (a0[13] <= 0)));
+            }
+            v3 = (((a1[1][8] % 4) ? (8 / 2) : (v3 < v3)) ? ((a0[9] <= v2) / 8) : ((v0 && a0[10]) ? (44 || v2) : (a0[10] && v3)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v1 = (((a0[4] ? v3 : v3) > (a0[8] <= v3)) ? ((v3 != v2) < (i2 + a0[2])) : ((a0[15] * v3) < (v1 * v1)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v1 = (((a0[11] < v3) > (v3 || a0[1])) >= ((71 / 2) == (92 <= v0)));
+            v2 = (((i3 * 24) >= (v3 % 3)) && ((a0[2] ? v2 : v1) == (i2 || v1)));
+            v1 = (((a1[2][11] - v3) % 2) / 3);
+        }
+        a0[5] = (((v2 ? i2 : v0) || (v2 || a0[11])) == ((v2 * 2) ? (i2 >= 3) : (6 > 99)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v2 = (((6 <= a1[3][4]) >= (v1 % 3)) / 6);
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    a0[15] = (((a1[0][0] ? v2 : a1[3][10]) ? (a0[8] ? v3 : v2) : (v1 != 42)) - ((v2 && v2) ? (v2 || a1[2][3]) : (a1[1][12] == v1)));
+                    v1 = (((v0 && a1[3][11]) > (v2 >= 81)) % 6);
+                    v1 = (((68 >= i5) >= (v2 + i5)) > ((41 % 5) || (v3 >= 56)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[12] = (((i4 ? v2 : 43) % 4) < ((61 == a1[0][5]) / 5));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((55 > v0) && (v0 ? 84 : v1)) ? ((v0 - v0) <= (60 != 76)) : ((91 ? 32 : v2) != (v0 || a0[9])))) {
+        a1[3][1] = (((v0 && v1) || (v1 == a1[2][14])) - ((v3 == v0) ? (v0 / 7) : (38 > v0)));
+        v3 = (((a0[12] / 5) < (v1 <= a0[5])) / 4);
+        v1 = (((v3 ? v2 : a0[14]) * (v0 * v1)) / 8);
+    } else {
+        v1 = (((38 * v2) == (a0[10] - v2)) ? ((3 - v1) && (v2 && 55)) : ((29 - v0) != (62 >= v0)));
+        a0[8] = (((39 == a1[2][15]) != (v1 - v0)) - ((a0[15] == v1) + (a0[10] > 77)));
+        a0[9] = (((a0[7] ? v2 : 28) + (a0[10] ? v1 : a0[14])) > ((v3 * v0) % 8));
+    }
+    if ((((v0 <= 95) && (a1[2][11] == v2)) || ((a1[0][3] - 1) ? (v1 > v2) : (v2 * a1[0][3])))) {
+        v2 = (((42 == a0[4]) / 7) ? ((72 ? a1[1][2] : v0) && (a1[1][2] != a0[13])) : ((a0[7] == v3) && (52 == v1)));
+        a0[9] = (((v1 - a0[3]) == (v3 / 9)) != ((v1 != v3) / 5));
+        v1 = (((a0[15] / 6) != (v3 ? a1[2][5] : v1)) > ((v2 * v2) == (a0[10] ? 18 : v0)));
+    } else {
+        v0 = (((48 && 34) >= (v1 != v0)) == ((v1 - v0) * (a0[9] - 26)));
+        a1[2][11] = (((v2 / 9) >= (v2 % 6)) * ((a1[3][7] <= a0[10]) / 4));
+        a0[13] = (((v0 < a1[1][15]) || (88 / 2)) + ((98 && v3) * (a1[1][3] || a0[1])));
+    }
+    return (((v3 % 1) && (v1 ? v0 : v1)) <= ((v0 + a1[3][9]) != (v3 + v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,149 @@
+int f0() {
+    int v0 = 36;
+    int v1 = 96;
+    int v2 = 75;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 + v2) || (83 % 9)) <= ((a0[5] + v3) / 8));
+    a1[0][15] = (((42 % 2) || (53 < 47)) != ((v1 % 4) != (a0[4] || v0)));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a0[0] = (((i0 == 56) % 4) == ((v1 <= 19) / 1));
+            v1 = (((i0 - a0[12]) % 1) / 7);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a0[11] = (((i1 * v2) >= (v3 + i0)) / 9);
+                    a0[9] = (((v0 == 14) ? (v0 <= a1[1][5]) : (i1 ? 16 : v3)) / 2);
+                    a1[3][5] = (((30 < v3) != (a1[1][1] <= v0)) ? ((v1 ? v3 : 12) ? (23 != 55) : (i1 == i0)) : ((5 != a0[0]) * (90 != 19)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((46 && v2) / 1) == ((a1[0][15] != v3) <= (v0 ? v0 : v0)))) {
+        v2 = (((v0 <= v1) || (a1[1][6] - v0)) && ((a1[0][8] >= v2) == (v3 || v3)));
+        a1[2][14] = (((v0 ? v3 : 97) ? (v1 % 7) : (v1 ? v0 : v3)) >= ((a1[3][12] ? v1 : 40) && (v0 * a1[3][3])));
+        a0[4] = (((v1 * a0[9]) != (v2 != 41)) >= ((a1[2][15] ? v0 : a0[7]) * (69 + 65)));
+    } else {
+        v3 = (((a0[9] % 8) && (a0[9] + v0)) ? ((35 >= v2) || (v2 < 17)) : ((41 / 1) == (v3 ? a0[13] : v3)));
+        a1[1][3] = (((a0[10] <= v1) * (a1[3][1] % 1)) ? ((v1 == a0[0]) ? (22 <= v2) : (v1 >= 26)) : ((a0[0] + v3) >= (v3 * v3)));
+        a0[14] = (((24 <= v1) && (a1[1][7] % 5)) <= ((a1[1][14] * v3) <= (a0[4] + v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v2 == v1) / 1) > ((a0[7] ? a1[1][6] : a1[1][13]) <= (26 == 97)));
+            v0 = (((a1[2][12] <= v3) >= (a0[4] <= v0)) + ((i2 != v1) - (a1[3][12] <= 30)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    if ((i2 ? a0[3] : i3) > 60) break;
+                    v2 = (((a1[3][2] + v3) - (i2 <= 9)) ? ((46 + a1[0][6]) + (61 + v2)) : ((i3 < 37) > (41 ? a1[3][14] : a0[8])));
+                    v0 = (((v0 > a1[0][11]) * (v1 ? i3 : v3)) + ((a0[2] == a1[1][13]) && (v3 > a1[1][7])));
+                    a1[1][6] = (((7 ? v1 : 53) && (a1[0][7] >= v0)) <= ((i3 > a1[0][11]) / 5));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((a1[3][12] != a1[3][5]) * (a1[2][14] > v1)) * ((v1 + a0[14]) * (14 == v3)));
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 62;
+    int v2 = 14;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[3][3] == a1[2][15]) < (v1 * a0[2])) ? ((a1[0][8] % 7) ? (96 ? 80 : 17) : (v1 ? v3 : a1[2][13])) : ((v0 > v0) == (10 + v3)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v2 = (((65 ? v2 : v3) < (34 - a0[9])) > ((58 || 40) * (v3 - v0)));
+        v3 = (((v0 != v2) <= (v2 || i0)) / 8);
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            if ((v0 - 53) > 64) break;
+            v3 = (((i1 ? v1 : i0) < (87 <= v2)) && ((v3 ? i1 : 92) != (v0 - a0[1])));
+            v2 = (((v0 % 7) <= (86 * 7)) ? ((a0[14] <= v2) <= (v3 < 93)) : ((27 || 45) ? (a1[3][10] == i1) : (v2 < v2)));
+            v1 = (((v1 ? 79 : i1) || (v3 || v1)) * ((v0 % 4) != (v0 && v1)));
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v0 = (((i2 + i2) % 1) >= ((a1[3][7] ? 75 : a0[6]) - (v3 ? 28 : v0)));
+        {
+            int i3 = 0;
+            do {
+                if ((a1[2][14] == a1[1][12]) > 99) break;
+                a0[9] = (((a1[3][10] <= 78) >= (v1 >= 81)) && ((a1[0][9] - 20) >= (a1[1][6] > v0)));
+                v1 = (((46 == 0) * (47 || i3)) - ((15 % 6) / 8));
+                v3 = (((v2 * 62) > (a1[1][4] < a0[4])) ? ((v0 + 21) > (v2 / 3)) : ((82 ? v2 : v2) > (a1[1][10] <= i3)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        v1 = (((a0[2] == a0[13]) || (22 ? v1 : v2)) - ((10 <= i2) / 7));
+    }
+    v3 = (((v3 <= a1[3][13]) / 5) / 6);
+    {
+        int i4 = 0;
+        do {
+            v1 = (((4 && v2) * (v3 || v1)) % 2);
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v3 = (((31 ? 78 : v2) - (v2 - a1[0][2])) + ((v0 < a1[3][3]) * (v0 % 8)));
+                v1 = (((i5 * a1[2][5]) * (v1 < v0)) && ((v1 > i5) < (v1 - a1[1][12])));
+                v2 = (((14 >= a0[9]) / 7) != ((i4 ? v1 : i4) / 8));
+            }
+            v3 = (((a0[11] ? 35 : i4) / 3) % 7);
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    return (((v2 * v0) ? (v0 % 7) : (83 != 99)) ? ((19 || 46) * (v1 * a0[3])) : ((84 * v0) + (v0 ? 65 : v3)));
+}
+int f2() {
+    int v0 = 70;
+    int v1 = 89;
+    int v2 = 21;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][2] % 5) < (v1 * v3)) / 1)) {
+        v2 = (((v1 > v2) && (a1[3][13] ? a0[9] : v1)) * ((a1[1][3] - a0[11]) > (v3 ? a1[0][4] : 60)));
+        v0 = (((a1[2][7] && v1) + (v3 % 9)) ? ((a1[3][1] + v3) - (a1[3][8] - 37)) : ((v2 - v3) + (a1[2][2] ? a0[0] : 70)));
+        a0[11] = (((v1 == v3) % 8) ? ((75 == a1[0][4]) + (a1[2][10] >= a1[3][6])) : ((a0[5] + 21) / 6));
+    } else {
+        v2 = (((a1[3][1] <= 14) > (15 <= 25)) ? ((v0 / 7) ? (a0[12] != 75) : (v3 == v0)) : ((a1[0][13] == a1[1][3]) + (a1[3][6] && 19)));
+        v0 = (((v0 ? v1 : v2) % 9) && ((a0[9] - v1) >= (88 ? a1[1][9] : v3)));
+        v1 = (((v3 >= v1) <= (v0 % 4)) == ((a1[3][14] / 7) - (a1[3][0] >= 86)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v2 >= v2) > 96) break;
+            a1[2][8] = (((a0[15] != 78) >= (v0 || a0[3])) && ((v0 > v0) >= (v3 < a0[10])));
+            a1[2][12] = (((v1 - v3) ? (v1 % 9) : (a0[10] - i0)) <= ((a0[2] ? v2 : v2) > (69 >= a0[12])));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a0[0] = (((65 != a1[3][7]) <= (71 - a1[0][10])) - ((i0 / 2) - (75 ? v2 : 64)));
+                v0 = (((v2 > i0) + (i0 >= a0[3])) == ((v3 >= 80) || (i0 / 2)));
+                v0 = (((i1 ? i1 : v2) < (i1 / 8)) ? ((20 - v0) * (2 % 2)) : ((41 - i1) < (v0 * v3)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    a0[4] = (((v2 >= 26) != (5 + 4)) - ((v1 >= v0) ? (a1[1][12] && 92) : (v0 || v0)));
+    a1[0][0] = (((v1 ? 70 : v0) ? (40 ? v1 : v2) : (2 ? a0[6] : v2)) == ((v1 == v2) / 9));
+    if ((((v2 + a0[6]) || (v3 ? v2 : 93)) || ((39 != a1[1][12]) && (53 % 3)))) {
+        a1[1][0] = (((v1 || v3) == (v2 >= 64)) ? ((a1[2][12] - v3) ? (a0[6] && v3) : (v2 >= v2)) : ((37 + v0) ? (a0[10] % 6) : (a0[15] != v1)));
+        v1 = (((v2 < v0) ? (v3 + v1) : (v3 >= a0[15])) % 9);
+        v1 = (((80 - 84) ? (a1[3][14] && a0[11]) : (51 < a0[13])) / 3);
+    } else {
+        v2 = (((v2 > v0) - (v1 == 69)) - ((v3 % 1) * (a1[2][2] - v3)));
+        v0 = (((v2 < v1) == (v0 || a0[14])) <= ((62 != v0) * (70 >= v0)));
+        a1[3][6] = (((a1[0][3] || v1) % 4) == ((v3 && a0[4]) % 8));
+    }
+    return (((a0[4] ? v0 : a1[0][5]) / 2) <= ((v2 < v2) - (a1[1][7] * v2)));
+}
+int main() {
+    return 0;
+}
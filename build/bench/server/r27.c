@@ -0,0 +1,56 @@
+int f0() {
+    int v0 = 77;
+    int v1 = 9;
+    int v2 = 33;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[7] = (((61 < 86) * (8 < a0[14])) * ((v0 != 21) + (92 && v3)));
+            a0[9] = (((a0[3] % 4) + (v0 ? a1[2][1] : a0[10])) / 8);
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v0 = (((a1[3][12] ? i1 : 7) ? (a0[10] / 8) : (i1 + i1)) + ((61 + v3) < (a0[12] || v1)));
+                a0[5] = (((16 <= v1) == (i0 >= v2)) == ((v2 + v2) ? (v1 / 3) : (a1[2][9] && a0[11])));
+                a0[3] = (((a0[11] == v3) && (53 != a0[13])) <= ((a1[1][1] ? v1 : i0) > (37 ? i1 : v3)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v2 % 4) > (v1 == v1)) == ((10 + a0[11]) ? (a1[2][10] < v3) : (v0 != v3)))) {
+        v0 = (((13 < a0[12]) + (48 / 8)) ? ((v2 != 86) % 6) : ((63 == v0) + (6 - v0)));
+        v3 = (((v2 - 26) != (a1[3][5] % 1)) ? ((v1 ? v1 : a0[6]) % 8) : ((99 * 73) >= (a1[3][12] + 8)));
+        v0 = (((v3 == v2) >= (29 / 7)) - ((a1[3][5] == v0) >= (v3 / 4)));
+    } else {
+        v0 = (((a0[6] ? v2 : v3) == (19 == v2)) ? ((v3 + v0) ? (v3 != v3) : (47 < 7)) : ((a0[10] > 87) || (92 ? a1[1][4] : v1)));
+        v0 = (((v3 > v0) == (56 % 7)) > ((a1[0][14] ? a1[3][6] : 77) == (v1 <= 98)));
+        v1 = (((29 ? v3 : v3) != (v0 * a1[3][14])) % 1);
+    }
+    if ((((v2 <= v3) > (v3 >= v2)) ? ((a0[15] != v1) + (v0 >= 76)) : ((v0 % 8) - (v3 ? a1[3][1] : v1)))) {
+        v2 = (((v3 != v2) > (v0 > v1)) / 3);
+        v2 = (((v2 > 20) * (v0 <= v1)) >= ((a0[7] <= 5) - (47 ? 82 : 2)));
+        v3 = (((7 * v0) % 9) < ((v1 >= v1) % 1));
+    } else {
+        v3 = (((36 % 1) - (48 * v3)) && ((3 >= 41) < (36 - 80)));
+        v3 = (((a1[1][0] > v0) / 5) ? ((61 >= 1) && (a0[7] ? a0[11] : a1[2][11])) : ((89 ? 98 : v2) * (12 || v2)));
+        v0 = (((11 / 4) || (a1[2][15] / 3)) && ((v3 > v1) % 3));
+    }
+    v2 = (((v2 && 23) <= (a1[3][7] + v2)) <= ((a1[2][15] % 2) > (12 ? a1[1][2] : v1)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((v0 == a1[0][7]) && (90 ? a0[4] : 93)) != ((a1[2][0] == v0) / 9));
+        v1 = (((a1[1][7] * v0) ? (a1[0][14] == v2) : (v0 <= v3)) - ((a1[3][13] - v3) > (a0[2] - 67)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            if ((22 >= i3) > 86) break;
+            v3 = (((i2 || a1[0][3]) == (a1[0][10] - i2)) % 4);
+            a0[15] = (((a0[12] >= v3) != (v0 >= 63)) > ((43 / 5) <= (i3 || 54)));
+            v0 = (((a1[2][1] == 44) <= (a0[14] + 17)) <= ((v1 % 3) < (a0[12] - v2)));
+        }
+    }
+    return (((v1 || v3) / 9) && ((v3 >= a0[0]) < (67 < v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,60 @@
+int f0() {
+    int v0 = 97;
+    int v1 = 5;
+    int v2 = 84;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((a0[2] % 9) > 65) break;
+        a1[1][11] = (((98 ? 21 : 28) + (34 <= i0)) == ((i0 >= 40) - (a0[9] % 8)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a0[9] = (((a1[3][8] % 8) + (a1[1][4] - a1[2][9])) ? ((v1 - a1[1][8]) && (v2 - v3)) : ((a1[1][6] == 56) <= (v2 <= v1)));
+                v0 = (((a0[15] + v1) != (v3 * a0[1])) % 6);
+                a1[3][1] = (((v1 != 83) == (a1[0][4] > v3)) != ((i0 > v2) <= (82 - a1[2][12])));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((v3 ? 84 : v0) == (i0 <= v3)) - ((v1 || 18) % 6));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        a1[2][5] = (((i2 > i2) ? (a0[13] <= v1) : (46 || a1[3][8])) && ((a1[0][6] + 40) <= (v1 + v1)));
+        a0[5] = (((a0[0] / 5) != (v1 + v3)) >= ((92 <= v1) && (v2 && 87)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            if ((v2 && a0[1]) > 80) break;
+            a1[3][10] = (((a1[1][7] >= a1[0][1]) % 7) != ((v3 && a0[2]) / 3));
+            a1[2][8] = (((i3 || 59) > (a1[2][0] % 5)) + ((i3 + 31) >= (a0[13] % 1)));
+            v3 = (((v1 + v1) + (i3 && 4)) % 6);
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[14] = (((a1[1][12] < 51) ? (v3 - v2) : (i4 ? i4 : v2)) ? ((a1[1][10] <= 84) >= (a1[0][15] < i4)) : ((v2 / 2) > (v3 + v3)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                if ((83 ? v1 : 43) > 68) break;
+                v0 = (((a1[1][7] / 5) == (87 * 29)) == ((59 % 6) + (i5 >= v3)));
+                v0 = (((i5 * a0[0]) > (v0 && a0[11])) ? ((4 > a1[0][14]) < (v1 <= i4)) : ((66 > v1) ? (a1[2][10] < v3) : (a1[0][2] ? v0 : i5)));
+                a1[1][15] = (((a1[0][2] != i4) < (a1[2][10] / 8)) >= ((0 - i5) > (v3 == v0)));
+            }
+            v3 = (((v2 && 84) == (64 < a1[0][10])) > ((a0[10] <= 90) > (a0[5] || a0[1])));
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v0 && 13) <= (v1 / 9)) <= ((v2 / 7) || (a0[6] >= v2)));
+    if ((((v2 * a0[8]) > (93 == 19)) + ((v3 > a1[0][9]) / 4))) {
+        v1 = (((v1 <= v3) || (a0[10] ? 92 : v3)) / 5);
+        v3 = (((a0[4] || a1[0][9]) < (a1[1][0] ? a1[3][4] : v3)) || ((v3 == 20) / 7));
+        v3 = (((v1 % 1) + (66 || a1[1][14])) || ((v2 || 30) + (v0 ? a1[2][8] : v3)));
+    } else {
+        v1 = (((47 ? v0 : 66) ? (a1[3][11] + v3) : (a1[3][9] && a1[2][8])) != ((v2 + v2) < (67 - v1)));
+        v0 = (((a1[0][14] * v0) < (v2 <= v1)) || ((v0 + 12) <= (v2 * a1[3][3])));
+        v3 = (((a1[3][0] < v2) || (v2 >= v0)) ? ((v2 < 88) ? (60 > v1) : (v1 > v0)) : ((a0[9] && a1[3][6]) >= (24 - a1[3][14])));
+    }
+    return (((v3 / 9) % 3) && ((47 > v3) == (v1 % 9)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,110 @@
+int f0() {
+    int v0 = 2;
+    int v1 = 63;
+    int v2 = 82;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 <= 20) + (85 + 17)) && ((9 && v3) + (a0[4] && 27)))) {
+        a1[3][14] = (((v0 == 41) > (v0 % 7)) > ((40 || a1[1][3]) != (53 && 52)));
+        a0[6] = (((v0 >= 37) <= (24 != a1[0][2])) != ((v1 <= a1[1][14]) / 3));
+        a0[15] = (((75 || 17) <= (v2 != a0[1])) >= ((96 * v0) != (v0 % 2)));
+    } else {
+        v1 = (((v2 - v2) != (a1[3][0] ? v2 : v0)) > ((v1 - a0[7]) >= (a1[1][4] > a0[11])));
+        a1[3][15] = (((v2 > 92) ? (v2 || v3) : (v1 ? 44 : v3)) ? ((v3 ? v0 : v3) <= (a0[13] / 4)) : ((94 ? a0[6] : v2) < (v3 - 77)));
+        a1[1][11] = (((69 + v2) < (v2 <= 73)) == ((a0[15] - v0) ? (v0 ? v2 : a1[1][3]) : (v1 + a1[3][5])));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((96 ? a1[3][8] : v1) > 66) break;
+            a0[13] = (((v2 > 10) > (24 ? 18 : 78)) && ((46 - v3) - (i0 != v2)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((10 / 5) > 57) break;
+                    v2 = (((a1[2][14] ? v1 : 98) ? (i0 < 63) : (a0[9] <= 71)) % 2);
+                    v0 = (((a1[3][15] ? 60 : i0) != (a0[13] <= 46)) / 7);
+                    v1 = (((a0[8] + v1) ? (v3 + v1) : (a1[0][9] % 3)) > ((18 ? 94 : 36) % 5));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][10] = (((v1 <= i0) - (70 > a0[3])) / 4);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((a0[15] == v3) <= (a0[15] % 6)) > ((v1 == a1[2][3]) + (v1 - a1[3][13])))) {
+        v1 = (((65 / 3) && (57 / 1)) / 8);
+        a0[0] = (((a1[1][10] != v0) + (v3 <= 39)) != ((v0 == 16) * (v2 ? a0[5] : v0)));
+        v0 = (((33 < v3) >= (v3 * a0[3])) ? ((v2 % 2) > (v3 / 2)) : ((a1[2][9] ? 63 : 68) > (a1[2][8] * v1)));
+    } else {
+        v2 = (((a0[9] * v0) != (77 >= a1[1][7])) <= ((v1 != v0) || (a0[3] || a0[11])));
+        a0[4] = (((a1[1][10] * v1) + (v0 == a1[0][3])) == ((v2 != a0[5]) / 8));
+        v0 = (((11 == 60) / 1) + ((81 >= 8) ? (98 != 53) : (a0[7] <= v0)));
+    }
+    if ((((v0 <= v3) || (v1 > a1[1][8])) || ((a1[3][3] ? a0[12] : v1) <= (91 ? v2 : v0)))) {
+        v2 = (((v2 ? a0[0] : a0[6]) ? (v2 * 47) : (60 != v0)) != ((a0[14] >= 87) || (v1 - 15)));
+        v0 = (((89 > v2) / 7) ? ((v0 != v3) || (31 == v0)) : ((a1[2][3] == a0[7]) >= (94 >= v2)));
+        v3 = (((28 && a1[2][13]) < (v1 + a0[4])) + ((42 ? v0 : v2) == (a0[15] ? a0[3] : v3)));
+    } else {
+        v1 = (((a0[12] || v3) < (a1[1][7] >= 81)) ? ((v3 ? v0 : v1) / 5) : ((v3 / 5) ? (v2 ? 68 : v2) : (a1[3][3] > 73)));
+        a1[3][15] = (((v1 <= a0[8]) <= (v2 * a1[2][6])) <= ((v1 * a0[2]) < (v0 - 56)));
+        v0 = (((v0 <= 89) / 2) >= ((16 != v1) ? (94 - v3) : (v1 / 7)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[2][9] * v0) > 56) break;
+            v1 = (((i2 - i2) ? (a1[3][7] && v3) : (a1[2][11] <= 45)) < ((95 ? a0[4] : 51) + (v2 ? a1[0][3] : 31)));
+            v1 = (((91 ? v1 : v0) <= (68 + a0[12])) * ((v3 <= v2) <= (v2 && v1)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v2 = (((46 && a0[15]) / 4) ? ((89 >= v3) * (a1[1][0] && v2)) : ((50 ? v0 : v0) - (v0 > 72)));
+                    v2 = (((v3 % 2) > (97 ? v2 : 73)) != ((87 * a1[2][2]) <= (v3 / 6)));
+                    a1[3][5] = (((44 == v1) % 5) && ((v2 ? 19 : v3) > (i3 * 80)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    return (((92 - 89) == (v3 + 15)) || ((a1[3][2] >= v1) != (87 <= a1[1][5])));
+}
+int f1() {
+    int v0 = 98;
+    int v1 = 41;
+    int v2 = 3;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 / 4) / 9) && ((96 != v3) / 6));
+    v2 = (((v0 % 4) <= (v1 || v1)) + ((97 ? v3 : a0[15]) > (a1[0][9] ? a1[3][1] : v2)));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v3 = (((a0[0] * 98) ? (39 * 16) : (23 / 5)) + ((92 != v1) <= (96 / 9)));
+            a0[7] = (((a1[3][5] && v3) ? (48 != 50) : (25 == 96)) % 4);
+            v2 = (((95 % 6) ? (v2 ? a0[7] : v3) : (0 != a0[13])) != ((i0 != 57) != (v0 + v1)));
+        }
+        v2 = (((v2 > 88) % 3) / 5);
+        v0 = (((18 >= a0[11]) ? (a0[14] + a0[1]) : (v2 != v2)) || ((v0 - 81) * (a0[15] * v1)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v3 = (((i2 * v2) / 9) / 4);
+        v0 = (((a0[6] ? v0 : 1) % 7) <= ((v1 ? v0 : 81) / 7));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                a1[0][11] = (((a0[0] || a1[1][4]) || (36 || i3)) - ((a0[11] - v2) * (75 + i2)));
+                v2 = (((a1[3][3] <= v1) % 4) || ((v0 - v2) < (a1[3][7] - 59)));
+                v2 = (((a0[1] * a1[1][13]) * (i2 || 3)) >= ((v2 || 11) > (a0[10] == a1[1][10])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    a1[3][8] = (((v2 % 9) / 8) >= ((a1[2][3] * v2) - (v2 || v2)));
+    return (((v0 ? v2 : v2) + (a1[3][15] > a1[3][8])) / 4);
+}
+int main() {
+    return 0;
+}
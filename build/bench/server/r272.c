@@ -0,0 +1,167 @@
+int f0() {
+    int v0 = 31;
+    int v1 = 66;
+    int v2 = 18;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a0[14] = (((v2 / 8) - (i0 ? 41 : a1[0][5])) ? ((v2 <= a1[1][0]) != (51 % 2)) : ((i0 ? a0[15] : 91) + (v3 && 4)));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            if ((v2 != a1[0][5]) > 62) break;
+            v0 = (((v2 + a0[7]) || (a1[1][8] + 37)) + ((85 * 89) && (a0[11] + 51)));
+            v3 = (((a1[3][6] || v0) + (v2 && a0[0])) > ((a0[10] <= a1[2][2]) <= (v0 != v0)));
+            v0 = (((92 == 62) == (62 / 7)) && ((70 + v1) >= (v2 ? 14 : i1)));
+        }
+        a1[3][2] = (((v0 ? 81 : 90) + (v1 == a1[1][3])) <= ((v1 - v0) ? (v0 && v1) : (v1 != 79)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v2 = (((v3 - v1) || (i2 % 9)) ? ((a0[12] < a0[3]) != (a1[0][13] != v3)) : ((a0[7] != a0[5]) * (v2 != v2)));
+            a0[2] = (((67 <= 62) < (1 ? a1[3][7] : v2)) >= ((v0 || 7) || (71 <= a1[3][1])));
+            {
+                int i3 = 0;
+                do {
+                    a0[9] = (((i2 > i3) != (36 ? a0[2] : i3)) ? ((i2 != i3) >= (v3 <= 16)) : ((89 / 2) < (a1[3][2] ? 2 : a1[3][8])));
+                    v0 = (((a1[3][1] >= a0[6]) <= (41 > a1[3][1])) * ((12 >= a0[6]) || (6 || 25)));
+                    v0 = (((a0[10] * 99) - (v1 >= v1)) - ((a0[4] >= i2) == (v2 ? i2 : v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v1 = (((v1 - v2) * (v3 >= v2)) ? ((a1[1][5] > v1) % 2) : ((v3 != 53) ? (v0 > a0[11]) : (v2 != v0)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                if ((v1 ? v2 : a0[8]) > 59) break;
+                v1 = (((i5 != 41) + (v2 ? a0[7] : v1)) / 5);
+                a0[2] = (((94 % 9) <= (v0 - v0)) / 6);
+                v3 = (((v2 - v2) < (40 <= v2)) % 9);
+            }
+            v2 = (((v2 ? v0 : v3) - (v2 >= v1)) + ((4 + a0[15]) ? (v0 == v2) : (43 <= 23)));
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v1 ? v0 : v2) || (86 && v2)) <= ((a1[2][13] == v3) > (68 != v0)));
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v0 = (((26 % 9) ? (v3 < 5) : (v3 < a0[13])) * ((v1 + i6) / 7));
+            v3 = (((a0[7] ? a1[2][0] : v0) <= (v2 && 6)) / 1);
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                v0 = (((a0[10] % 2) - (v0 < v3)) / 4);
+                a0[5] = (((a1[3][13] && v3) * (v3 < i7)) + ((i7 || 53) <= (v1 >= a1[0][12])));
+                v1 = (((4 == v0) / 7) + ((i6 == v3) <= (v3 + 53)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v1 == v2) - (93 || v2)) == ((62 - a1[3][9]) || (27 && v1)));
+}
+int f1() {
+    int v0 = 94;
+    int v1 = 80;
+    int v2 = 54;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v1 = (((17 * v1) % 4) < ((a0[3] - i0) > (v1 - a1[1][6])));
+                a0[5] = (((i1 <= a1[2][9]) > (a0[9] / 7)) * ((i1 && i0) / 6));
+                v2 = (((a0[11] < 9) % 6) / 9);
+                i1 = i1 + 1;
+            }
+        }
+        a0[8] = (((v2 ? 9 : v1) || (v0 && v0)) || ((v0 * v1) > (i0 ? v3 : a0[10])));
+        a0[12] = (((61 > a1[1][15]) ? (a1[0][10] <= 53) : (96 && v3)) < ((v3 - 81) && (v0 >= a0[13])));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((a1[3][8] ? a0[9] : v2) > 87) break;
+        v2 = (((78 - a1[3][14]) * (24 || v3)) + ((i2 > v0) ? (a1[2][2] / 4) : (58 < 46)));
+        a0[14] = (((44 < i2) == (v0 && v1)) < ((a0[3] * 69) >= (v0 < i2)));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v1 = (((i2 % 6) / 4) < ((98 || a1[1][11]) + (v3 && i2)));
+            a0[7] = (((v1 && v2) ? (a1[3][8] % 6) : (a1[0][9] / 8)) / 2);
+            v1 = (((v2 / 1) * (v3 > 24)) / 5);
+        }
+    }
+    v3 = (((v3 ? v0 : v2) < (a0[11] != 28)) && ((98 ? v1 : v2) && (v3 || v0)));
+    a1[2][14] = (((1 >= 89) % 7) ? ((v0 == v2) ? (v2 || a0[10]) : (v3 > v2)) : ((a0[8] > 44) >= (v3 < 18)));
+    if ((((70 == v2) && (a0[2] ? 47 : 34)) <= ((a1[1][2] * v2) < (v0 ? v1 : v2)))) {
+        a1[3][3] = (((v1 && a0[3]) ? (v1 % 2) : (v2 == v0)) || ((a1[0][1] ? v3 : a1[0][9]) ? (36 || 50) : (a0[1] * v0)));
+        v2 = (((v2 > 40) + (a0[5] ? v3 : a0[15])) < ((53 || 59) == (a0[2] == a0[4])));
+        v0 = (((v0 * a0[6]) - (13 || v1)) / 7);
+    } else {
+        v3 = (((v3 ? v2 : 87) ? (v0 < v2) : (v1 ? v1 : v1)) > ((a1[2][8] || v0) * (a1[2][6] <= a1[2][13])));
+        a1[1][9] = (((v3 ? v1 : v0) >= (23 - 64)) <= ((a0[0] < 13) != (v0 <= v2)));
+        v1 = (((v3 == v3) - (a0[9] % 3)) ? ((a0[3] == 6) % 9) : ((v3 > a0[2]) * (v2 <= v3)));
+    }
+    return (((a0[13] - v0) && (v0 / 1)) + ((33 == v2) != (v1 < 91)));
+}
+int f2() {
+    int v0 = 67;
+    int v1 = 16;
+    int v2 = 55;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v1 / 3) / 7) - ((a1[3][12] / 7) + (a1[2][6] || 75)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            if ((i1 <= v1) > 64) break;
+            a0[4] = (((v0 >= v3) ? (v3 + 26) : (a0[12] != v3)) >= ((v2 != 2) != (a1[0][3] / 5)));
+            v0 = (((v1 % 8) * (v1 && v0)) == ((3 ? a0[11] : 63) >= (9 < v2)));
+            v0 = (((63 * 98) / 8) % 6);
+        }
+        v1 = (((a1[0][15] && v3) / 8) || ((v3 * v1) >= (i0 == a1[1][12])));
+        a1[2][0] = (((v1 != a0[9]) != (a0[12] ? 38 : v0)) || ((v0 == a0[8]) < (a0[14] == i0)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a1[3][13] = (((v2 <= a1[2][8]) ? (v1 - v2) : (v0 * v0)) + ((i2 <= i2) ? (a0[14] * v1) : (a0[3] + v2)));
+        v3 = (((a1[0][10] != 96) / 3) + ((a1[1][8] || v2) ? (a0[6] ? v0 : i2) : (a0[8] >= a0[8])));
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            if ((12 + v1) > 69) break;
+            v1 = (((88 != a1[0][4]) > (74 / 1)) >= ((a0[15] % 2) == (v1 / 1)));
+            a1[0][8] = (((a1[3][1] / 6) ? (a0[3] ? 7 : i2) : (v2 % 9)) - ((v3 ? 18 : v3) * (v0 <= a0[15])));
+            v0 = (((v1 - 66) < (a1[2][3] && 27)) || ((i3 || 70) / 1));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    if ((v0 || a0[13]) > 82) break;
+                    v2 = (((a0[15] % 5) < (54 % 2)) < ((14 <= v3) % 8));
+                    a1[2][12] = (((v3 == v2) / 2) && ((v1 || 84) ? (i4 == i4) : (78 >= v2)));
+                    a0[8] = (((i4 % 3) ? (i5 == v3) : (v2 + i5)) ? ((i5 > v0) < (29 && a1[2][0])) : ((i5 <= a1[1][11]) % 1));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v0 = (((a1[1][8] > v2) % 4) >= ((58 == a1[2][1]) <= (v3 - v0)));
+            a1[2][14] = (((v1 > 4) || (a1[2][12] != v1)) >= ((14 + 76) + (v2 || v2)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    if ((((v0 - v1) % 8) && ((v0 ? 24 : 24) || (a1[3][3] >= v2)))) {
+        v3 = (((a0[15] != 93) ? (a0[15] && v1) : (85 == v2)) - ((a0[15] * a0[4]) || (a1[3][14] > v0)));
+        a0[5] = (((v1 - v1) + (a0[11] % 5)) > ((a1[3][7] ? v2 : v0) < (a0[13] && 5)));
+        v2 = (((v3 % 7) % 6) + ((v3 + v1) / 5));
+    } else {
+        v1 = (((a1[0][1] - v0) <= (v0 < v0)) / 7);
+        v1 = (((75 != a1[1][8]) - (v2 == v0)) == ((40 || v0) - (v1 == v0)));
+        v2 = (((a0[7] - 10) * (v3 <= a1[1][1])) == ((a0[6] != a1[2][13]) ? (a0[4] - a0[14]) : (v0 != 90)));
+    }
+    return (((a1[3][6] >= a1[1][4]) ? (v3 - 30) : (64 * v3)) % 5);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,65 @@
+int f0() {
+    int v0 = 30;
+    int v1 = 78;
+    int v2 = 87;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v0 = (((a0[6] * 86) < (10 && v1)) < ((i0 * 68) >= (v1 ? v0 : a0[14])));
+                v2 = (((v2 > v3) <= (i1 != v1)) <= ((4 || a1[3][8]) <= (a0[9] + v1)));
+                v2 = (((a1[1][4] && v1) * (a0[7] <= v0)) && ((i1 != i0) % 5));
+            }
+            v2 = (((a0[10] < v2) <= (v1 % 5)) <= ((v1 <= a1[2][4]) && (v1 > v1)));
+            v2 = (((a0[11] == a1[0][5]) * (v1 <= v2)) < ((4 > a0[4]) < (43 < 80)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 / 5) >= (a0[3] % 9)) + ((v1 / 2) > (v3 + v1)))) {
+        v3 = (((v0 - 40) <= (36 / 1)) > ((35 ? 80 : v0) + (v0 || a1[3][15])));
+        v3 = (((v0 != v3) != (v0 || a1[1][9])) / 9);
+        v1 = (((v3 * 41) || (v1 + 1)) || ((v2 > v2) < (86 + 86)));
+    } else {
+        a0[5] = (((v0 == v1) && (v0 >= 1)) && ((v3 == 73) >= (v2 || 78)));
+        v0 = (((v2 && 60) ? (v0 / 6) : (a0[0] && a1[0][11])) % 1);
+        a1[3][4] = (((a1[0][9] - v1) * (41 >= v0)) ? ((2 <= a1[1][3]) > (32 % 4)) : ((45 % 5) >= (a0[8] - v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[12] = (((59 / 8) || (6 / 4)) ? ((v1 >= a1[0][11]) != (a1[3][6] % 5)) : ((a0[1] * 39) > (v3 + v2)));
+            v3 = (((a0[5] * v1) <= (v3 && i2)) || ((a0[2] > v2) ? (a0[3] ? a1[1][4] : 81) : (8 && v0)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v0 = (((v1 * 73) % 3) >= ((a0[12] && v2) <= (v1 % 5)));
+                    v1 = (((62 * i3) >= (a1[2][2] / 2)) ? ((a0[13] > v1) ? (9 < v3) : (i2 ? a0[12] : v2)) : ((9 == v0) >= (23 ? i2 : a0[9])));
+                    a0[3] = (((i2 || a1[0][5]) > (a0[3] <= 38)) == ((i3 * v1) / 7));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    a1[3][11] = (((v3 - v2) != (a1[0][3] * a0[3])) / 8);
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v2 = (((64 && a0[12]) == (v2 == v1)) / 8);
+        a1[0][10] = (((v1 >= a0[3]) != (v2 == 35)) % 6);
+        {
+            int i5 = 0;
+            do {
+                a1[3][9] = (((v0 % 6) / 4) ? ((a1[0][14] == 51) > (13 / 7)) : ((v0 / 6) == (i5 ? a1[0][11] : v1)));
+                v1 = (((a1[2][4] >= a1[0][10]) + (i4 < i4)) - ((v2 + v0) < (v3 ? a1[3][12] : i4)));
+                v2 = (((v3 < i4) + (a1[0][4] == 90)) + ((v2 == a0[11]) != (a1[3][0] && v1)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+    }
+    return (((53 || 26) != (v0 ? 53 : v0)) ? ((a0[2] || v3) && (v0 != a0[4])) : ((a0[12] * 77) * (56 % 8)));
+}
+int main() {
+    return 0;
+}
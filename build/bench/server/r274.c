@@ -0,0 +1,103 @@
+int f0() {
+    int v0 = 7;
+    int v1 = 18;
+    int v2 = 38;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v3 = (((i0 && v2) * (a0[12] || a0[6])) > ((v3 * v3) + (v1 % 6)));
+            v3 = (((i0 && 33) || (35 + v0)) ? ((i0 && v0) && (a0[5] + i0)) : ((63 != 25) % 9));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((a0[5] || i0) <= (v2 % 3)) ? ((a0[10] + v0) > (a0[11] < v3)) : ((a0[4] > a0[12]) / 4));
+                    v1 = (((i0 ? a1[3][1] : a1[0][6]) && (a1[0][4] < 20)) - ((a0[1] < i1) > (54 % 9)));
+                    a0[4] = (((i1 / 1) >= (i0 % 5)) && ((47 > v2) * (a0[5] ? v1 : a0[13])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 < 59) + (v1 > v0)) - ((v2 > v3) > (a0[11] < v1)))) {
+        v2 = (((v0 * v3) <= (0 ? 34 : 27)) && ((v3 < v1) > (v2 + 98)));
+        a0[9] = (((a0[1] != 11) / 6) ? ((v3 <= 52) - (a1[2][0] * v1)) : ((v2 >= a1[3][5]) <= (v3 >= v1)));
+        v0 = (((v3 ? 91 : v3) * (v2 == 21)) && ((a1[3][6] < a0[5]) / 6));
+    } else {
+        v2 = (((v0 ? v0 : v0) >= (v1 ? v2 : v0)) ? ((v2 || v3) - (19 + 64)) : ((v2 == v3) + (a0[7] > v3)));
+        a1[0][0] = (((v0 <= 40) >= (93 <= 81)) != ((26 && v2) < (25 % 4)));
+        a0[1] = (((64 >= v1) >= (a1[0][5] / 3)) ? ((a0[12] >= v0) / 8) : ((58 || 45) || (v3 - a0[5])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((i3 ? 10 : 55) ? (90 - 47) : (i3 >= a1[2][13])) || ((77 / 3) ? (v3 ? v2 : v3) : (i2 <= v2)));
+                    a1[2][14] = (((6 ? v0 : v2) != (7 + v3)) / 9);
+                    v3 = (((40 <= 54) < (41 ? 53 : v1)) ? ((v0 && i2) ? (a0[4] % 3) : (v1 > i3)) : ((47 == a0[15]) + (a1[2][12] - i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v3 = (((v2 != a1[1][14]) <= (v3 || 47)) / 9);
+            v2 = (((3 == 38) == (44 - v3)) > ((v0 && a1[1][15]) || (i2 >= a1[3][6])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((64 >= v1) * (v3 / 6)) >= ((a0[2] == v1) ? (v3 != a0[9]) : (41 == a0[7])))) {
+        v3 = (((v3 + a0[5]) || (v3 * 89)) || ((v3 <= a0[2]) ? (76 == v1) : (12 - a0[14])));
+        v3 = (((v2 / 1) != (a0[10] || v0)) % 8);
+        v0 = (((v1 / 3) != (v1 >= 62)) / 5);
+    } else {
+        v2 = (((a1[1][13] || v1) ? (a0[9] >= v2) : (v0 && a0[5])) && ((v2 ? 68 : 52) == (91 ? v0 : v3)));
+        a1[1][7] = (((a0[14] == a0[10]) || (v0 > v2)) - ((a0[8] > v2) > (v2 % 9)));
+        v0 = (((v3 + v0) <= (80 || v3)) || ((a1[1][3] >= a1[3][10]) + (a1[0][14] - 59)));
+    }
+    a0[7] = (((v2 > 26) / 3) ? ((a0[10] ? v0 : a0[5]) - (v3 ? 87 : a1[1][10])) : ((31 ? a1[1][2] : v2) ? (v1 != v2) : (v3 ? a1[3][9] : v1)));
+    return (((a0[9] || a1[1][10]) + (98 / 4)) ? ((v3 / 9) - (a1[1][8] == a0[12])) : ((v0 > v0) == (a0[0] >= v3)));
+}
+int f1() {
+    int v0 = 16;
+    int v1 = 84;
+    int v2 = 49;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][13] - v0) - (v3 != v2)) > ((a1[2][0] + v1) > (v0 % 3)))) {
+        v0 = (((v2 >= v1) == (v2 / 1)) + ((v3 != v3) != (10 ? v2 : 85)));
+        v3 = (((v3 && v3) ? (85 * a1[0][1]) : (58 <= 77)) / 7);
+        a0[1] = (((58 && v1) <= (v1 < v0)) < ((v3 != a0[11]) / 3));
+    } else {
+        v2 = (((a1[2][11] && v0) <= (v3 >= a1[1][13])) * ((v3 >= 24) <= (a1[0][11] && 72)));
+        v3 = (((a1[1][3] * a1[2][12]) <= (v2 <= a0[9])) ? ((v0 <= 89) * (v3 < v0)) : ((v0 && a0[11]) <= (a0[12] || v1)));
+        a0[0] = (((36 || v1) ? (a0[7] - v1) : (v2 / 9)) && ((a1[1][4] == v1) % 1));
+    }
+    v1 = (((a0[13] == a1[2][10]) + (v3 ? v2 : v2)) || ((v3 == v0) >= (a0[14] == v1)));
+    if ((((71 - a1[0][5]) - (v0 > a1[1][9])) <= ((9 || a1[2][13]) && (a0[4] ? 53 : 80)))) {
+        v0 = (((v0 * a1[3][14]) % 2) <= ((a1[1][13] / 3) + (v3 && a1[3][12])));
+        v0 = (((v0 == 79) >= (63 != 17)) != ((v3 - v0) == (58 != 96)));
+        v2 = (((91 % 6) ? (v2 * a1[3][7]) : (v1 && v0)) % 4);
+    } else {
+        v3 = (((a0[3] % 1) / 6) || ((v2 || a0[0]) || (22 == 13)));
+        v3 = (((v0 - v1) == (a1[2][5] ? v1 : 36)) / 6);
+        a0[13] = (((a0[13] ? v3 : 5) / 7) ? ((91 < v3) == (v0 && 74)) : ((v0 % 7) + (v3 <= 14)));
+    }
+    v2 = (((v2 == v3) ? (v1 >= 25) : (v1 <= a0[15])) / 7);
+    if ((((a0[10] && v3) * (a1[3][1] - v3)) ? ((v2 ? v3 : 80) % 9) : ((67 < v0) && (v1 <= 23)))) {
+        v1 = (((v1 >= 92) || (a0[10] && 35)) >= ((22 ? 66 : a0[9]) / 6));
+        a0[9] = (((v3 && a1[0][8]) + (a0[0] * v3)) >= ((v0 >= a0[9]) * (81 == v3)));
+        v0 = (((a1[2][2] * v1) > (94 != v1)) < ((a1[2][6] == a1[2][4]) ? (v2 && v2) : (v0 == v2)));
+    } else {
+        a1[2][10] = (((50 <= a0[1]) && (v3 * a0[2])) == ((v1 >= v3) - (v2 ? v3 : v2)));
+        v0 = (((63 ? v0 : v1) && (16 && v0)) < ((28 >= v1) ? (a0[11] - a1[3][11]) : (v1 / 5)));
+        a0[14] = (((v3 % 3) ? (v3 > 34) : (35 >= v2)) && ((99 ? v2 : 66) == (12 > a1[2][1])));
+    }
+    return (((a1[2][3] ? v0 : 13) + (58 <= 92)) || ((4 % 2) + (99 + 36)));
+}
+int main() {
+    return 0;
+}
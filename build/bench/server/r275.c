@@ -0,0 +1,188 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 98;
+    int v2 = 64;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 != a0[4]) == (v0 || a1[3][11])) > ((v3 + a0[6]) ? (v3 ? a0[14] : a0[3]) : (72 / 5)));
+    if ((((66 ? v1 : 70) < (v2 > v1)) && ((v0 != 34) || (a1[3][9] == a1[3][15])))) {
+        v1 = (((76 ? v3 : 22) < (v1 || a0[2])) != ((34 > 95) <= (a1[3][9] <= v3)));
+        v1 = (((v3 ? v0 : a1[1][11]) != (v1 * a0[12])) < ((22 % 2) * (v3 || a0[10])));
+        v2 = (((v2 && a0[4]) >= (67 || v1)) >= ((v3 + a0[7]) < (v0 - v1)));
+    } else {
+        v2 = (((a0[3] / 5) >= (v0 <= v2)) ? ((1 == v1) >= (v2 - v2)) : ((81 >= 76) > (a1[1][10] <= v1)));
+        a1[2][12] = (((v3 >= v1) >= (v0 >= 6)) && ((a1[3][8] % 4) != (v0 % 1)));
+        v3 = (((a1[2][8] < v0) < (a1[1][4] / 4)) ? ((61 ? 24 : 32) <= (v3 / 9)) : ((66 || v3) / 6));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((19 ? a1[2][2] : 51) > 73) break;
+            v2 = (((59 > i0) != (v2 ? v0 : a1[0][14])) < ((a1[2][7] - v3) % 7));
+            a1[3][10] = (((a0[12] - v1) != (v2 * a0[4])) ? ((v1 >= a0[2]) <= (v0 < a1[0][13])) : ((v1 ? 49 : 16) % 2));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v3 = (((v1 <= 83) ? (a0[5] && i0) : (v1 % 8)) == ((i1 >= v3) / 7));
+                    v0 = (((i1 * a1[2][0]) <= (26 != v2)) >= ((a0[14] != i0) && (v3 * v2)));
+                    v3 = (((v1 * v0) ? (i0 % 2) : (v3 < i0)) ? ((i1 * 48) && (i1 + i1)) : ((73 >= v0) > (v2 && a1[3][6])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a1[3][15] % 4) > 61) break;
+        {
+            int i3 = 0;
+            do {
+                v1 = (((72 ? a1[2][1] : v0) && (v2 && a0[13])) / 3);
+                v0 = (((6 / 2) <= (a1[2][12] % 1)) - ((94 <= a0[7]) % 9));
+                v0 = (((v2 ? a1[2][13] : a0[14]) && (a0[8] || v0)) != ((a0[13] != a1[1][4]) < (i2 % 1)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        v0 = (((v2 ? a0[5] : v0) ? (v1 > a1[3][5]) : (v2 >= i2)) % 1);
+        a0[8] = (((v2 >= a0[14]) ? (i2 || v2) : (a1[2][3] * 71)) < ((87 > v3) * (v2 <= v1)));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            if ((i5 % 9) > 75) break;
+            v2 = (((a1[3][4] < a0[10]) <= (i5 - v3)) && ((v2 || i5) % 6));
+            a0[10] = (((v2 ? v0 : v1) == (2 == v3)) != ((v2 * a0[12]) != (v2 <= 92)));
+            v3 = (((i5 < 47) - (v1 != 97)) != ((20 - a1[1][3]) % 7));
+        }
+        a1[0][12] = (((a1[0][7] <= v2) / 1) - ((43 + v1) * (76 && 69)));
+        a1[3][14] = (((13 - 1) ? (a0[13] == a0[7]) : (50 || 64)) <= ((a1[2][10] <= v1) >= (v1 || a0[1])));
+    }
+    return (((16 - v0) + (v3 + 63)) - ((6 || v1) + (v2 >= v0)));
+}
+int f1() {
+    int v0 = 41;
+    int v1 = 59;
+    int v2 = 84;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v2 = (((i0 > v0) != (a0[0] >= v3)) < ((i0 > 91) + (i0 <= 44)));
+            v3 = (((67 ? v1 : v3) >= (a1[2][10] ? 33 : 78)) / 9);
+            {
+                int i1 = 0;
+                do {
+                    a1[2][8] = (((a1[2][2] || i1) <= (i1 ? 86 : 93)) >= ((68 - v3) != (47 != a0[7])));
+                    a0[15] = (((i0 / 9) >= (a0[14] / 7)) == ((47 + v0) >= (v0 || v1)));
+                    v0 = (((a1[3][13] == v0) != (13 % 2)) < ((90 + 15) ? (a1[2][2] / 5) : (a0[5] >= a1[0][15])));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 + 75) >= (a1[1][12] % 9)) + ((48 * a1[2][6]) > (29 ? v0 : v1)))) {
+        a1[3][2] = (((v1 + 87) >= (a0[15] != v1)) ? ((7 % 1) || (14 >= 19)) : ((10 > v0) + (v3 ? v2 : v3)));
+        v0 = (((v0 == v0) != (v3 ? v1 : v3)) * ((a0[15] < a1[3][14]) < (78 && a0[7])));
+        v2 = (((v3 != 18) - (v2 != v3)) || ((v3 && v2) > (v3 != v2)));
+    } else {
+        a1[1][3] = (((v1 / 2) % 9) && ((v3 < v3) ? (a1[1][15] >= a1[1][7]) : (v0 != 4)));
+        v0 = (((v0 == 82) - (v1 ? 27 : a0[5])) && ((v0 < v3) - (70 || a1[2][6])));
+        v1 = (((v1 % 3) + (a1[0][4] > v0)) <= ((v0 == v0) / 3));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((72 >= 58) > 91) break;
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            v3 = (((90 <= 23) * (13 <= i2)) || ((a0[7] <= v2) && (56 - i2)));
+            v1 = (((28 == a1[1][2]) + (66 <= a0[11])) < ((i2 % 1) >= (v1 && v3)));
+            v0 = (((v3 > v0) >= (a0[12] ? 54 : v3)) == ((a0[10] == i2) <= (v3 && i3)));
+        }
+        v0 = (((v0 <= a1[1][10]) == (v0 <= v3)) < ((72 != v3) < (v1 && v2)));
+        v3 = (((a1[1][5] + v2) || (34 != a0[7])) + ((i2 == a0[15]) || (37 >= 87)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            a0[7] = (((v1 <= 84) <= (v2 >= v1)) ? ((a0[9] < v1) / 7) : ((v3 ? v2 : v2) > (26 < 16)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v1 = (((28 < v3) >= (a0[10] < 19)) / 8);
+                v2 = (((51 != v3) + (v3 != 21)) + ((32 - 0) ? (a1[2][1] != v3) : (a1[3][7] == i4)));
+                v2 = (((i5 ? v0 : i4) > (a1[2][0] != v1)) ? ((i4 == a0[7]) + (a0[2] + v2)) : ((a0[2] / 7) == (80 && v3)));
+            }
+            a1[3][6] = (((a0[13] - a0[14]) - (14 < a1[1][9])) >= ((v1 / 3) && (v1 * v3)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v0 == v0) > 99) break;
+            v1 = (((98 <= v2) % 8) != ((a0[7] == 89) && (v2 && a1[2][6])));
+            a1[0][2] = (((a0[5] - v3) < (v0 * a0[5])) != ((i6 ? 20 : 58) <= (a0[5] && a0[9])));
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    if ((v1 >= i7) > 58) break;
+                    v3 = (((a1[1][5] <= 60) / 5) + ((a0[0] < v0) % 2));
+                    v2 = (((i7 && v0) != (a1[1][12] * v3)) != ((v0 == 94) && (v3 / 6)));
+                    v0 = (((v1 % 6) > (i6 ? v1 : 70)) != ((a1[0][15] == 25) <= (v1 != 2)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    return (((52 <= a0[12]) == (a0[11] < a0[9])) || ((v3 && 39) == (v0 ? v2 : a0[4])));
+}
+int f2() {
+    int v0 = 98;
+    int v1 = 22;
+    int v2 = 82;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    a0[0] = (((v3 - v1) && (23 != 74)) % 4);
+    if ((((90 != v0) != (a1[3][14] / 9)) && ((a0[7] / 8) < (81 >= v3)))) {
+        a1[3][14] = (((1 - 42) < (57 % 3)) > ((v1 ? 48 : 22) > (12 / 2)));
+        v3 = (((v2 - v2) % 2) == ((a0[13] || v1) - (a1[3][3] < 81)));
+        v0 = (((a1[2][11] <= 66) >= (v2 > v1)) || ((a0[9] - v0) % 4));
+    } else {
+        a1[2][14] = (((v3 / 4) != (v0 != a0[10])) + ((a1[2][8] * a1[3][3]) > (50 >= 98)));
+        v2 = (((v2 ? 59 : v3) ? (v0 < v2) : (25 == 72)) / 1);
+        v3 = (((a0[8] ? 95 : 89) * (33 > a0[8])) > ((a0[4] % 8) % 8));
+    }
+    if ((((v0 % 5) >= (v3 + a1[3][2])) ? ((14 < v1) + (v2 && 80)) : ((v1 || a0[1]) > (v1 < 10)))) {
+        v2 = (((v0 < v1) % 6) ? ((30 > a0[6]) <= (a1[1][1] % 5)) : ((v0 || 70) < (a0[10] <= v0)));
+        a1[0][1] = (((a1[2][0] / 3) < (v2 ? v2 : 77)) >= ((v2 == v0) + (v2 / 5)));
+        v0 = (((a1[2][2] + 24) + (a1[2][8] / 7)) ? ((17 > v3) * (22 && v3)) : ((v3 + v1) - (49 / 2)));
+    } else {
+        a0[8] = (((v3 % 3) < (a0[8] + 31)) > ((v0 < v3) || (v3 % 5)));
+        v2 = (((v2 > v3) && (a1[0][13] >= a1[2][6])) == ((v2 < 46) <= (v2 * v1)));
+        a1[3][4] = (((a1[0][7] ? 18 : 56) >= (a1[1][0] ? v2 : v0)) ? ((v1 > 45) + (84 >= a1[3][3])) : ((a0[7] - 10) ? (v1 * a1[1][10]) : (v2 * v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v0 / 5) > 77) break;
+            a1[1][11] = (((a1[2][15] >= v0) != (a1[2][13] - v2)) ? ((v3 < v0) != (a0[12] != 49)) : ((v0 > v1) - (v3 && v3)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v2 - a0[7]) ? (61 + v3) : (65 * a0[5])) || ((a1[3][9] % 3) <= (27 == i1)));
+                    v0 = (((i1 || v2) ? (v3 >= 41) : (v3 || v0)) / 2);
+                    v0 = (((a1[2][6] && a1[0][5]) || (i1 >= v3)) - ((i0 >= v0) - (46 != v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v1 = (((a0[2] / 4) / 4) < ((16 / 3) % 5));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    a0[9] = (((v3 <= a0[3]) + (v2 - a1[1][13])) || ((38 > v0) ? (v2 || 13) : (v0 - a0[7])));
+    return (((v1 && a1[3][3]) ? (v3 > v2) : (a1[0][15] - v0)) + ((11 > v3) * (v3 <= a1[1][7])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,54 @@
+int f0() {
+    int v0 = 63;
+    int v1 = 25;
+    int v2 = 10;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 ? 18 : a1[2][2]) % 9) != ((13 + v3) + (v1 > a1[1][0])))) {
+        v3 = (((v2 <= v1) > (88 ? 28 : v1)) == ((a1[2][13] || 28) ? (a1[3][10] <= a0[9]) : (98 || 45)));
+        v2 = (((v3 * 81) + (v1 <= v2)) || ((a1[1][11] || v2) % 8));
+        v1 = (((a0[3] <= v0) <= (v3 ? v3 : a1[2][3])) && ((69 || v2) * (v1 >= v1)));
+    } else {
+        a1[2][14] = (((a1[1][15] < v2) - (63 + a1[1][10])) ? ((a0[13] - 21) % 4) : ((a1[3][14] && 99) ? (v0 ? v2 : a0[3]) : (v2 + v1)));
+        a0[14] = (((56 / 2) >= (a0[13] - a1[2][13])) < ((v0 - 67) * (v3 && v2)));
+        v0 = (((a1[2][5] || v2) ? (v1 == a0[13]) : (v0 % 1)) % 8);
+    }
+    v2 = (((v1 / 5) <= (v1 || a1[3][9])) / 2);
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a0[7] = (((v3 * v2) - (a1[2][15] ? v0 : 1)) * ((v0 - v2) < (72 < v3)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((a0[8] >= i1) > 88) break;
+                a0[0] = (((i1 != 56) - (v0 != v1)) >= ((a0[13] * v3) != (v3 + v0)));
+                v2 = (((42 ? a1[0][6] : a0[11]) ? (v3 && 21) : (v1 ? i1 : v0)) >= ((0 % 3) % 8));
+                a1[2][0] = (((26 + v0) * (v1 / 9)) / 1);
+            }
+            v2 = (((v1 + i0) % 2) / 4);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v0 = (((53 / 9) || (v2 == 81)) < ((94 / 8) < (v1 ? a1[2][10] : 1)));
+                    a1[3][10] = (((v2 % 4) > (70 ? 77 : a1[3][0])) != ((19 + 43) * (a1[3][5] - v3)));
+                    a1[3][11] = (((v3 + a0[5]) ? (i3 - v3) : (v3 + a1[1][3])) <= ((a0[4] || 8) ? (92 ? i3 : 53) : (69 && a0[5])));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[2] = (((i2 <= v2) <= (v1 < a1[2][13])) % 1);
+            v1 = (((a1[3][7] + a1[1][1]) != (80 - v3)) <= ((v2 ? v0 : a1[3][3]) == (a0[2] == a1[0][5])));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((v1 || 46) >= (a1[3][1] < v2)) - ((v3 == v0) && (v2 && 15)));
+    return (((v1 ? v2 : 25) / 6) || ((a0[5] || a1[0][12]) != (v3 + v1)));
+}
+int main() {
+    return 0;
+}
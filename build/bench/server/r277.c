@@ -0,0 +1,166 @@
+int f0() {
+    int v0 = 20;
+    int v1 = 89;
+    int v2 = 50;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a0[10] - a1[2][1]) > 69) break;
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v1 = (((2 / 7) >= (v2 / 4)) || ((v0 ? 63 : v1) / 4));
+                    v1 = (((v1 ? 42 : 22) % 7) == ((v1 >= v3) / 2));
+                    v3 = (((v0 % 9) ? (14 * 7) : (a0[15] > a1[2][1])) && ((v3 ? v3 : i1) || (61 == v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v0 - v1) + (v3 % 1)) ? ((i0 != a1[2][12]) == (a1[3][1] * a1[1][14])) : ((56 ? v0 : v3) < (55 / 9)));
+            a0[14] = (((23 == v3) < (a0[8] >= v1)) && ((12 == v3) <= (v0 != 65)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v2 = (((v1 > 40) && (a1[1][13] ? v3 : v3)) < ((9 == a1[2][14]) * (a1[1][10] || i2)));
+                    v1 = (((a1[2][15] % 8) + (v1 >= i2)) != ((a1[2][8] == a0[1]) && (33 >= i3)));
+                    v1 = (((a0[8] == 29) || (i2 < 8)) <= ((44 > a1[0][11]) || (v0 >= i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v1 == v3) > (51 < a1[3][13])) < ((v2 ? v3 : a1[2][9]) ? (v1 != a0[7]) : (v1 + a0[7])));
+            v2 = (((i2 == 70) || (v2 + v3)) ? ((54 > 75) < (a1[3][14] % 9)) : ((30 < v2) != (44 < a0[1])));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v2 != v2) && (v0 / 9)) ? ((v0 ? v0 : v1) > (32 == 62)) : ((a1[0][7] >= v2) / 4));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v3 = (((a1[1][0] > a1[3][13]) != (3 / 8)) <= ((45 <= i4) > (63 / 8)));
+                    a1[2][12] = (((a0[9] < v0) == (v3 ? 63 : a1[0][7])) <= ((i4 - 96) > (a0[7] >= v0)));
+                    a1[3][1] = (((a1[2][4] ? a0[10] : 16) <= (v2 >= v3)) > ((i4 + a1[1][5]) ? (a0[3] < 11) : (v0 && 33)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][14] = (((a1[3][10] - a0[3]) - (v3 && 20)) && ((v3 / 9) > (v0 <= a0[14])));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    a0[10] = (((v2 != v0) < (i7 || 20)) || ((1 >= a0[10]) || (v0 - i6)));
+                    a1[2][11] = (((a0[2] <= 34) >= (v3 / 7)) - ((v1 < v1) * (12 + 7)));
+                    v3 = (((v3 == v2) || (i7 == v1)) >= ((a1[2][10] < v1) + (v2 > v1)));
+                    i7 = i7 + 1;
+                }
+            }
+            a1[2][5] = (((v0 && v1) - (a1[3][8] < v1)) + ((a0[5] * a0[13]) ? (a1[2][10] == a1[1][11]) : (99 || a0[12])));
+            v0 = (((8 < v0) >= (i6 < 52)) < ((v1 || 70) ? (a1[3][2] || i6) : (a1[2][8] ? i6 : 16)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        if ((82 != a0[2]) > 83) break;
+        v0 = (((i8 / 1) <= (a0[9] && i8)) != ((10 >= 62) >= (70 <= v1)));
+        v0 = (((36 <= v1) <= (v2 < v0)) ? ((a1[0][9] ? 6 : 44) * (59 + v1)) : ((46 < i8) ? (i8 > a0[10]) : (25 > a0[13])));
+        {
+            int i9 = 0;
+            while (i9 < 2) {
+                v1 = (((i9 / 8) >= (96 % 3)) > ((v0 != i9) >= (a0[7] > i9)));
+                v3 = (((v0 - v3) + (85 == v3)) >= ((a0[6] < 83) % 5));
+                v2 = (((75 ? a1[2][0] : v3) / 3) + ((v2 * 11) * (v2 ? i9 : i8)));
+                i9 = i9 + 1;
+            }
+        }
+    }
+    return (((a1[2][8] ? v3 : v2) - (a0[10] == v3)) - ((a0[10] < v0) % 9));
+}
+int f1() {
+    int v0 = 74;
+    int v1 = 39;
+    int v2 = 5;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 > a0[1]) != (v2 == v3)) < ((v2 % 5) > (44 ? a0[8] : v0)))) {
+        v0 = (((v0 * v1) + (a1[2][3] == a0[8])) != ((a1[0][14] % 9) > (v2 % 5)));
+        v1 = (((45 == v2) || (v2 % 3)) >= ((64 / 9) + (a1[1][10] / 7)));
+        a0[13] = (((v3 % 9) >= (v0 >= v3)) >= ((51 ? 40 : a0[9]) % 2));
+    } else {
+        v3 = (((a1[1][0] <= 11) >= (35 <= 61)) == ((a0[10] * 0) || (v1 > v1)));
+        v0 = (((26 > a1[2][12]) + (v3 + 38)) >= ((v1 == a0[8]) > (a1[3][8] < v0)));
+        v0 = (((v3 <= v0) == (a0[7] + v1)) - ((v1 - 3) <= (v3 % 6)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a0[13] = (((48 - v1) % 5) == ((21 && v0) != (v1 || 18)));
+            v2 = (((21 <= 9) < (50 % 4)) || ((a0[8] / 8) ? (v2 < a0[6]) : (i0 % 1)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((73 < a0[14]) ? (a0[11] ? i1 : 27) : (i0 || i1)) <= ((i1 ? i0 : v3) / 3));
+                    a0[9] = (((54 > 68) < (i0 / 1)) ? ((a1[0][3] < a0[14]) > (i0 % 3)) : ((v0 % 1) * (22 / 7)));
+                    v0 = (((v3 / 3) != (v2 ? a0[14] : a1[0][4])) > ((a1[3][12] * 15) ? (v1 + 15) : (a1[3][14] * 20)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v2 = (((v1 == 63) ? (98 / 9) : (v1 != a0[13])) / 6);
+                    a1[0][3] = (((a1[0][10] != v3) ? (a1[0][10] > i2) : (a1[1][12] * i2)) / 8);
+                    v3 = (((a0[12] ? a0[13] : a1[2][6]) % 6) == ((73 ? a1[2][6] : 38) == (a1[3][14] >= 92)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[3][9] = (((88 != v3) >= (39 && a0[1])) != ((v3 - a1[0][12]) ? (63 + v3) : (v0 != a0[5])));
+            v0 = (((a1[0][7] * a0[6]) % 6) ? ((v3 && 81) ? (v0 > v0) : (i2 - a1[2][5])) : ((v2 >= v2) * (41 % 5)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        if ((68 % 6) > 56) break;
+        v3 = (((i4 < v0) < (a0[13] || v0)) ? ((84 - v3) && (88 > 67)) : ((62 ? v2 : 58) ? (a0[11] >= 79) : (18 + 52)));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v0 = (((a1[0][14] >= a1[3][14]) % 3) <= ((v2 * 86) > (a1[3][5] && a0[2])));
+            v2 = (((7 ? v0 : v3) >= (88 == v0)) >= ((a1[3][7] * a1[3][15]) && (87 / 7)));
+            v2 = (((i5 != 4) % 3) ? ((90 * a1[3][5]) || (51 ? a0[9] : 77)) : ((v1 && v2) - (v1 > i5)));
+        }
+        v3 = (((a0[1] <= a1[2][8]) ? (54 ? v2 : a1[1][7]) : (a1[1][12] < 96)) / 2);
+    }
+    if ((((v0 == v3) == (24 != 47)) > ((v1 == v2) - (v1 % 4)))) {
+        v0 = (((v1 - a1[2][13]) && (a0[9] % 9)) ? ((30 <= v1) && (v1 * v1)) : ((a1[2][0] + v0) - (a1[3][2] || v1)));
+        v3 = (((16 / 4) / 8) && ((a0[9] + v3) >= (a0[6] != v1)));
+        v1 = (((v2 < a1[3][2]) < (a1[0][10] + v1)) % 5);
+    } else {
+        v3 = (((v0 / 4) * (v3 || v3)) == ((v3 + a1[1][3]) ? (v2 * v3) : (94 ? a0[3] : v0)));
+        v2 = (((a1[3][5] < v3) != (v0 / 9)) < ((v1 % 1) < (a1[1][4] || v2)));
+        v2 = (((a0[0] || 8) - (v2 * 78)) % 6);
+    }
+    return (((v3 ? v0 : 63) / 9) && ((v0 || v1) < (a0[2] < v2)));
+}
+int main() {
+    return 0;
+}
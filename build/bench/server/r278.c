@@ -0,0 +1,162 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 78;
+    int v2 = 64;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 != a1[1][10]) < (73 ? 55 : v3)) >= ((v3 && v3) <= (v2 < a1[1][7])));
+    if ((((v2 - a1[1][1]) % 5) <= ((25 == 46) > (v3 % 9)))) {
+        a1[1][1] = (((a1[0][6] * a1[3][5]) % 2) || ((v1 > a0[11]) * (v2 >= v2)));
+        a1[1][13] = (((a0[3] + a0[2]) != (20 % 8)) || ((21 - 0) * (a0[13] % 2)));
+        v1 = (((a1[2][2] < v2) && (34 <= 20)) < ((a1[2][15] < v1) != (a1[0][9] - 20)));
+    } else {
+        v1 = (((a0[2] && 83) + (25 && 69)) >= ((9 + v0) - (v3 && v1)));
+        a1[3][2] = (((39 <= v2) + (61 * v2)) < ((v0 % 9) || (v1 == v0)));
+        a1[0][5] = (((a1[0][7] / 4) % 8) / 4);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                do {
+                    a1[3][0] = (((a1[0][2] < v1) != (a1[2][11] % 6)) + ((a0[1] / 8) - (v3 != v2)));
+                    v0 = (((79 ? v3 : 60) >= (a1[3][13] <= a1[2][2])) <= ((v1 + 97) + (27 >= 75)));
+                    v3 = (((a1[0][9] * v2) - (i0 == 17)) && ((a1[3][3] > v1) ? (v0 - v3) : (a1[0][15] * a0[12])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v2 = (((a0[1] == v0) % 1) <= ((a1[3][13] || i0) > (a1[3][7] ? 22 : 56)));
+            v2 = (((v0 == 69) ? (v2 != v2) : (i0 <= v2)) % 9);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((90 % 9) > 55) break;
+        v1 = (((40 || 70) ? (38 != a1[2][6]) : (a1[0][2] + v1)) || ((11 >= 48) % 5));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((v3 >= 36) ? (2 ? v2 : a1[2][12]) : (i3 != a0[15])) / 4);
+                a0[9] = (((i3 * i3) * (v0 + a0[1])) <= ((v2 / 9) * (47 / 6)));
+                a0[4] = (((46 ? i3 : a1[1][1]) / 7) % 8);
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v0 = (((i2 >= a0[9]) - (8 && 67)) != ((a1[2][3] != 16) != (17 > a0[7])));
+    }
+    if ((((a1[1][4] != a0[15]) && (10 * a1[1][4])) - ((65 >= v0) ? (v2 > v0) : (a1[1][11] || v3)))) {
+        v0 = (((v2 * a1[3][1]) && (v1 > 12)) * ((v3 >= v2) - (85 <= v1)));
+        a1[1][4] = (((v3 == a0[13]) == (v3 >= v1)) ? ((v3 < 37) == (a1[3][5] == a1[3][3])) : ((v1 - v0) <= (55 >= a0[11])));
+        v3 = (((v3 > v3) || (32 < v2)) || ((13 ? a0[8] : v2) == (a0[11] + v2)));
+    } else {
+        a1[0][6] = (((v0 - v0) < (8 == 52)) % 9);
+        a0[14] = (((a0[14] / 2) >= (a1[2][0] % 1)) || ((v3 < a1[3][13]) / 1));
+        v2 = (((2 || v0) % 6) / 8);
+    }
+    return (((a0[2] + a0[4]) - (v0 / 2)) ? ((a0[3] <= 19) || (82 > 75)) : ((v1 / 9) ? (v0 + v0) : (37 ? 6 : a0[2])));
+}
+int f1() {
+    int v0 = 87;
+    int v1 = 4;
+    int v2 = 5;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v3 = (((v2 / 9) % 2) * ((a0[15] * v0) / 6));
+        v3 = (((v1 || v1) + (a0[7] > a1[0][5])) > ((v0 ? a1[0][1] : v0) && (a1[2][0] ? a1[2][7] : i0)));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v2 = (((i1 ? 65 : v2) / 7) * ((i0 / 6) == (i1 >= v1)));
+                a1[3][10] = (((a0[7] / 3) != (16 && a0[15])) ? ((v2 >= i1) * (i0 - 42)) : ((v0 % 4) == (v2 / 9)));
+                a0[5] = (((87 == v0) * (v3 + 33)) <= ((74 && a1[0][8]) > (i0 / 8)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    v2 = (((a0[2] ? v2 : v2) != (v2 != 79)) % 1);
+    if ((((v2 + 92) % 5) && ((a1[1][9] || 97) + (v3 || v1)))) {
+        a0[8] = (((61 >= a0[1]) >= (59 || v3)) == ((a1[3][8] >= 15) || (v2 >= a0[15])));
+        v2 = (((81 > v3) || (a1[1][11] % 4)) % 5);
+        v3 = (((v2 || a0[6]) || (a1[0][5] * a1[3][3])) || ((v0 > 21) > (v2 > v1)));
+    } else {
+        v1 = (((25 == a0[14]) || (v3 == 87)) <= ((v2 && v0) == (v3 * a0[11])));
+        a0[1] = (((v3 % 8) / 4) || ((v3 ? 79 : v3) / 3));
+        v1 = (((a0[7] % 3) % 2) - ((47 ? v0 : a0[15]) || (19 < a1[0][4])));
+    }
+    if ((((a1[0][11] || a1[2][13]) / 2) == ((93 - v1) / 5))) {
+        v2 = (((v2 > a1[3][4]) > (84 == v0)) * ((a1[0][9] > a0[13]) % 2));
+        v0 = (((a0[4] != v3) && (v1 || a0[13])) ? ((a1[2][14] ? a1[3][9] : 44) ? (v2 != v0) : (v2 % 3)) : ((27 ? a0[14] : a0[8]) % 2));
+        a0[15] = (((a0[13] ? v1 : a0[12]) + (45 + v1)) ? ((a1[0][6] - 34) != (72 && 19)) : ((82 % 2) > (v0 || v3)));
+    } else {
+        a0[14] = (((v0 % 3) ? (a1[1][10] <= 48) : (a0[7] && v1)) >= ((v0 || 64) % 1));
+        v2 = (((a1[0][0] < v2) > (v0 == 63)) % 7);
+        v0 = (((35 - v1) || (53 - 32)) <= ((a1[2][0] <= a1[3][5]) >= (v1 || v2)));
+    }
+    a0[7] = (((a0[13] ? a1[2][5] : v3) ? (v2 == a1[3][3]) : (83 && v2)) - ((v3 < v0) && (v3 % 3)));
+    return (((v3 || v0) ? (28 > v1) : (a1[0][8] >= v2)) - ((a1[0][11] != 82) - (a0[6] > a1[2][5])));
+}
+int f2() {
+    int v0 = 25;
+    int v1 = 50;
+    int v2 = 11;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((a1[3][10] || v2) >= (v2 + v0)) % 1);
+            a0[1] = (((a1[1][6] % 6) - (v2 && v3)) ? ((v1 > a1[3][1]) <= (i0 <= a1[3][14])) : ((a1[0][13] == a0[3]) && (v0 > a1[0][5])));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v0 = (((v3 && a0[10]) <= (v3 % 2)) || ((a1[0][2] + 70) >= (91 / 3)));
+                v2 = (((a0[4] ? 71 : v3) ? (v0 || 37) : (i1 ? v3 : 80)) * ((a1[0][2] % 5) + (i1 * v3)));
+                a0[14] = (((v2 || a0[12]) < (v0 ? a1[0][14] : a0[5])) && ((a0[5] ? i0 : i1) * (v0 && a1[1][4])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((a0[7] >= 79) % 4) ? ((v0 != 74) / 5) : ((v0 ? a0[11] : v3) >= (a1[0][11] >= v1)))) {
+        v0 = (((97 < v1) % 9) ? ((a0[8] && v3) % 9) : ((14 != a0[2]) >= (27 - v0)));
+        v2 = (((v2 >= 83) ? (88 != 12) : (v2 % 7)) * ((38 > v2) * (v1 ? a0[10] : v1)));
+        v1 = (((31 == v2) ? (41 % 8) : (v0 * v0)) < ((v2 && 83) + (78 < 90)));
+    } else {
+        a1[3][15] = (((9 + 6) || (89 <= 88)) > ((v1 ? v1 : a0[4]) && (v2 <= 87)));
+        v0 = (((55 * v0) || (v1 - 10)) < ((v2 / 9) <= (a0[1] || 13)));
+        a1[3][14] = (((a0[8] == 46) && (a0[5] ? a0[0] : 67)) % 9);
+    }
+    if ((((a0[3] >= v1) / 7) * ((a0[10] + a0[6]) ? (a0[14] != 49) : (49 >= v3)))) {
+        v1 = (((a0[15] + v3) / 6) ? ((a1[3][1] >= 71) % 5) : ((30 ? v3 : 54) * (33 > v2)));
+        a0[7] = (((v1 > 73) <= (98 != a0[12])) > ((v3 != 94) + (a0[12] || 8)));
+        v1 = (((a1[3][13] && 66) < (31 == v0)) && ((v1 ? a1[2][6] : v2) < (v1 % 7)));
+    } else {
+        v3 = (((v2 - v3) || (3 > 92)) ? ((a0[9] > a0[1]) > (v1 - v1)) : ((91 > v0) % 3));
+        v2 = (((v3 == a1[0][0]) > (a0[7] > v0)) || ((a1[2][5] <= a1[3][9]) ? (a0[13] ? a1[2][2] : a0[12]) : (v1 < v1)));
+        v1 = (((a1[1][11] <= a1[1][4]) || (a0[3] ? a1[2][10] : v3)) - ((83 + v0) ? (v1 < 34) : (a1[1][8] < a1[1][0])));
+    }
+    if ((((a0[12] <= 72) <= (v2 != v2)) || ((v0 > v0) + (a0[15] - v0)))) {
+        a1[2][6] = (((v2 * 58) >= (v2 >= v1)) == ((v0 || a0[6]) / 5));
+        v2 = (((v3 > a1[3][13]) || (v0 / 9)) ? ((v1 ? a1[3][11] : 16) < (a0[14] / 6)) : ((v0 != v0) ? (a1[3][14] || 38) : (72 == v2)));
+        v3 = (((v0 != 70) ? (v3 > v2) : (v0 / 8)) < ((v1 / 1) > (v0 >= a0[15])));
+    } else {
+        v0 = (((a1[3][3] < v2) > (a0[7] - a1[0][5])) % 1);
+        v2 = (((v2 % 7) ? (v0 / 2) : (45 || 1)) >= ((24 - v1) != (v1 ? a0[1] : a0[5])));
+        v0 = (((a1[0][0] != v0) != (27 / 6)) - ((v2 + v3) < (v3 % 8)));
+    }
+    if ((((a0[10] - a0[10]) != (v2 >= 51)) + ((60 * v0) < (v0 / 7)))) {
+        v1 = (((v1 - v3) == (v1 ? v1 : v2)) != ((a0[1] >= a0[2]) - (v3 || 23)));
+        v3 = (((73 >= 56) < (a1[0][5] > a1[2][11])) ? ((23 && v3) ? (73 < v0) : (v3 * v0)) : ((v3 + 8) && (a1[0][3] == v0)));
+        v1 = (((a0[6] <= v3) && (a0[5] < v0)) >= ((a0[15] * 64) ? (a0[13] <= 88) : (v2 ? v2 : v1)));
+    } else {
+        v0 = (((98 == v0) % 6) != ((a0[3] / 6) ? (38 != 93) : (v3 * 16)));
+        a0[9] = (((v3 ? a1[2][6] : v0) % 3) != ((v1 < 41) % 4));
+        a1[1][2] = (((v1 + a1[3][13]) == (v2 ? 7 : 45)) % 1);
+    }
+    return (((a0[12] < 91) - (v3 ? a1[2][10] : v0)) - ((v1 * v3) <= (22 * 85)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,88 @@
+int f0() {
+    int v0 = 89;
+    int v1 = 9;
+    int v2 = 80;
+    int v3 = 60;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        if ((v3 == 56) > 59) break;
+        {
+            int i1 = 0;
+            do {
+                if ((27 == 7) > 77) break;
+                v0 = (((a1[0][7] || a0[9]) > (a0[15] || a0[14])) * ((v2 || v3) + (i1 / 1)));
+                a0[2] = (((67 >= a0[3]) ? (i1 > 32) : (i0 > 46)) > ((i1 < 92) - (i1 > v0)));
+                v0 = (((v1 || v1) && (37 / 7)) <= ((64 % 3) && (a0[7] != 31)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        a0[15] = (((i0 >= v1) ? (v1 / 4) : (64 && a1[3][12])) == ((a0[3] <= 18) ? (v2 >= a0[2]) : (v3 == 42)));
+        a0[2] = (((i0 < v1) >= (i0 == a1[1][3])) + ((v1 && v1) ? (i0 ? 79 : 68) : (v2 >= v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 != v1) > 93) break;
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v3 = (((v1 * i2) ? (v2 / 7) : (v2 % 6)) == ((a1[1][10] <= v3) % 5));
+                    v2 = (((a1[3][5] != a0[3]) >= (v2 / 3)) == ((v3 ? a1[1][4] : 5) || (a0[2] <= 92)));
+                    v0 = (((v1 && a1[3][6]) && (65 ? v2 : v2)) < ((a0[14] / 9) / 8));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((a0[7] && v0) == (a0[11] % 4)) * ((62 % 8) > (i2 ? v0 : v0)));
+            v0 = (((i2 || i2) % 8) != ((a0[5] - 54) || (v3 >= v0)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[3][3] = (((v1 + v0) > (i4 <= 9)) > ((i4 >= v1) / 6));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((i5 ? v0 : a1[1][13]) >= (a0[0] < 69)) <= ((a0[10] > a1[3][9]) - (97 % 9)));
+                    a0[12] = (((a1[2][6] || i5) + (a1[0][4] && 25)) < ((86 % 1) ? (a1[1][2] / 1) : (a0[7] && v1)));
+                    a0[6] = (((v0 >= 28) % 4) * ((59 * a1[3][12]) && (i4 >= i4)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            a0[11] = (((75 - 7) && (a0[9] < 63)) * ((i4 == 46) * (a0[10] / 8)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    if ((((36 < v1) && (v0 >= v1)) / 4)) {
+        v3 = (((v2 || v2) <= (5 / 3)) - ((55 != 51) <= (a1[2][8] / 5)));
+        v1 = (((a1[2][8] * v2) % 6) * ((57 >= v2) >= (v2 % 9)));
+        v3 = (((a1[2][12] + v2) - (a0[8] + v3)) + ((16 <= 39) + (a1[1][9] && v3)));
+    } else {
+        a1[0][5] = (((70 == v2) ? (a1[3][5] && v2) : (11 ? 36 : a1[1][8])) >= ((v2 ? v1 : 89) / 6));
+        v0 = (((a0[10] / 8) + (a1[1][15] && v0)) != ((a1[0][5] && v0) < (v3 != 42)));
+        v3 = (((v0 + v0) == (a1[3][3] + 0)) >= ((v2 <= a0[12]) != (v3 != 40)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v0 = (((v3 > a0[10]) < (v1 >= 91)) ? ((34 && v0) == (a0[6] || a0[11])) : ((a0[13] % 2) + (58 == v2)));
+            a0[4] = (((v2 ? 44 : a1[1][10]) <= (a0[9] + i6)) / 5);
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    a0[7] = (((58 > v0) ? (a1[0][1] ? v2 : v1) : (i7 || v0)) / 4);
+                    a0[7] = (((v1 * a1[1][1]) / 2) ? ((v0 / 4) != (65 / 7)) : ((31 >= a1[1][6]) ? (v0 - v3) : (55 <= 62)));
+                    a1[2][9] = (((a1[0][12] > a1[3][5]) - (v1 || 46)) >= ((v0 + a0[9]) + (v1 / 4)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    return (((a1[1][0] || 89) != (a1[0][14] ? a1[3][2] : v0)) >= ((a1[1][9] * 87) >= (v1 * 97)));
+}
+int main() {
+    return 0;
+}
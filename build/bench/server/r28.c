@@ -0,0 +1,135 @@
+int f0() {
+    int v0 = 85;
+    int v1 = 83;
+    int v2 = 4;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 / 9) - (v0 + 64)) ? ((v3 * v3) - (v0 % 9)) : ((a0[14] >= 12) ? (v0 % 5) : (a0[5] / 7)))) {
+        v1 = (((98 > a0[1]) ? (v2 != 12) : (v1 && v0)) ? ((a0[14] > 62) || (71 * 98)) : ((v0 == v1) && (a1[0][6] * v0)));
+        v1 = (((v2 % 8) / 2) == ((0 && v3) == (v3 || a0[6])));
+        v1 = (((a0[12] == v1) + (a1[3][12] > a1[1][1])) < ((v0 - v1) < (a0[5] && v1)));
+    } else {
+        a0[8] = (((v3 || a1[0][6]) / 9) || ((a0[10] > a0[4]) == (41 - v3)));
+        v1 = (((v3 || v3) - (v2 % 3)) % 8);
+        v2 = (((84 % 1) || (v2 >= 5)) + ((v0 < v2) + (a1[1][2] % 2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v3 = (((v1 ? a1[1][10] : v3) > (v0 >= v2)) == ((v0 < a0[3]) < (v3 == v2)));
+            v0 = (((32 || a1[1][10]) ? (v3 / 4) : (3 ? v3 : 92)) % 2);
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[1][6] = (((a0[10] / 7) >= (a0[7] > 23)) && ((77 ? v1 : v0) + (76 / 4)));
+                v0 = (((v3 ? a1[0][8] : a0[9]) / 2) || ((a0[6] <= a0[11]) == (v3 < i1)));
+                v2 = (((i1 < v1) == (a1[2][13] / 9)) ? ((a1[0][11] < 77) != (v3 >= 6)) : ((12 || a1[2][6]) > (a1[0][8] >= v1)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a1[1][0] = (((v2 + v1) == (55 / 2)) && ((v0 && 40) != (5 >= a0[13])));
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v2 >= 6) > (v2 < 78)) + ((90 * v0) * (21 ? a0[8] : v3)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((v2 >= i2) > 61) break;
+                a0[8] = (((i2 >= a0[2]) / 4) ? ((i3 ? i2 : a0[15]) ? (50 * v0) : (a1[0][10] <= a1[1][4])) : ((i2 || a0[6]) - (a1[0][10] == i3)));
+                v3 = (((a0[11] + a0[7]) > (82 > v3)) != ((v1 != a1[3][4]) || (a1[2][0] && v2)));
+                v2 = (((92 * 98) >= (a0[8] - v2)) >= ((93 ? i2 : a0[14]) == (i3 || v1)));
+            }
+            v0 = (((v3 * a0[0]) % 5) < ((v0 + v0) > (a1[0][9] >= v2)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            v1 = (((v0 < v3) % 1) >= ((a0[7] <= v0) == (v0 && 60)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v3 = (((i5 <= a1[2][7]) <= (i4 * 11)) <= ((a0[6] != v0) >= (a0[0] % 6)));
+                    v0 = (((a1[0][4] ? a1[0][2] : v0) != (a1[3][7] > v0)) + ((a0[13] % 1) * (a1[1][14] * i5)));
+                    a0[11] = (((a0[7] * 26) ? (v0 / 9) : (57 ? v0 : v2)) >= ((v0 < v1) ? (v3 > i5) : (58 || v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((v2 && 89) != (48 ? a0[7] : 11)) >= ((v1 >= a1[0][11]) > (v0 > i4)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 * a0[2]) / 7) ? ((v1 || v3) - (v2 || v1)) : ((v0 * 94) / 5));
+}
+int f1() {
+    int v0 = 79;
+    int v1 = 83;
+    int v2 = 51;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[6] = (((a1[1][12] + a1[2][6]) % 1) ? ((a1[1][14] ? v2 : a1[3][3]) ? (a0[1] > v3) : (91 || v0)) : ((10 || v1) && (a0[6] != i0)));
+            a0[4] = (((v2 + v2) ? (70 || 44) : (i0 * 85)) % 8);
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((v3 >= a0[0]) == (65 ? a0[13] : 65)) != ((v1 / 4) && (a1[0][15] <= 32)));
+                v0 = (((45 < 57) ? (v3 ? v1 : i0) : (a1[1][2] < i1)) <= ((a1[0][11] ? 68 : v3) || (a1[0][8] + a1[0][14])));
+                a1[0][5] = (((i0 > 58) - (i1 > a0[13])) > ((a1[1][2] < 20) <= (86 <= i1)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((a0[9] != a1[3][8]) <= (47 <= v0)) * ((v3 % 1) || (v1 / 6)));
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a1[0][9] ? 59 : 40) % 8) ? ((v1 && 84) && (99 ? i2 : v1)) : ((37 < 79) + (v2 ? v0 : 92)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v0 = (((84 ? 47 : a0[14]) + (a0[5] == 36)) || ((v3 || a1[1][6]) >= (a1[2][9] && a0[13])));
+                v0 = (((a1[1][8] / 7) * (v0 + a0[5])) != ((v3 - i2) / 9));
+                v2 = (((a0[3] <= v0) >= (v2 == i2)) - ((i2 ? v2 : a0[1]) * (14 != 39)));
+            }
+            v0 = (((i2 > a1[3][0]) % 3) != ((35 && 48) % 6));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((52 == a1[0][7]) == (52 - i4)) - ((v0 < v0) - (v0 % 1)));
+            v2 = (((a0[3] > 41) ? (i4 < a0[6]) : (v3 && a0[7])) >= ((90 - i4) == (a1[1][12] / 1)));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v3 = (((46 >= v0) + (a1[0][9] && a0[4])) <= ((v2 < v1) && (52 ? v2 : a0[14])));
+                    a1[1][3] = (((70 + 59) - (56 - v3)) * ((v3 % 8) / 3));
+                    v1 = (((v0 * v1) + (v0 <= 78)) ? ((a0[3] != 61) ? (54 && v3) : (i4 % 1)) : ((a1[2][12] % 6) >= (84 >= 23)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                a0[14] = (((a1[1][1] >= 8) ? (a0[10] > a0[9]) : (i7 - a0[12])) % 8);
+                a0[1] = (((v0 / 2) || (i7 != v2)) ? ((a1[1][1] ? 82 : v3) <= (a1[0][6] ? v0 : i7)) : ((a0[3] >= 80) * (i7 + 92)));
+                a0[15] = (((i7 + 57) / 7) % 8);
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+        v1 = (((v1 - v3) == (v2 && 3)) <= ((i6 <= i6) % 1));
+        v2 = (((a0[2] > a0[1]) > (i6 >= a1[3][12])) >= ((86 < a1[2][15]) ? (v3 || 92) : (v2 ? a0[8] : 47)));
+    }
+    return (((a0[2] >= v0) + (a0[10] + a1[3][4])) % 3);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
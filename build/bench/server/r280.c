@@ -0,0 +1,131 @@
+int f0() {
+    int v0 = 8;
+    int v1 = 66;
+    int v2 = 80;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((84 == 42) > 74) break;
+            {
+                int i1 = 0;
+                do {
+                    a0[2] = (((a1[2][14] || v2) == (v1 >= v0)) + ((a1[3][13] <= a0[13]) ? (v0 % 6) : (a1[2][4] > a1[2][5])));
+                    v2 = (((a1[1][14] * a0[9]) > (a1[0][9] < i0)) > ((5 % 8) - (v1 / 7)));
+                    v0 = (((v1 == v0) + (i0 < 1)) != ((a1[3][14] - v2) % 4));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v3 = (((5 ? 38 : v2) && (33 && v0)) * ((i0 != v2) <= (51 > 68)));
+            v2 = (((v3 && a0[4]) > (i0 == v0)) + ((a0[3] > a1[3][2]) != (v2 <= 90)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((60 != a0[10]) < (v3 != 5)) <= ((i2 % 8) - (a0[10] > a0[3])));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    a0[9] = (((a0[14] >= i3) > (i3 > v2)) - ((41 == 56) && (i2 > v3)));
+                    v0 = (((i2 ? 49 : 75) < (a0[3] != v0)) ? ((41 <= v3) != (i2 >= a1[0][10])) : ((v0 ? v0 : v0) == (i3 != 87)));
+                    a1[2][10] = (((a0[14] != v1) || (i2 + i3)) / 1);
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((a1[0][5] <= i2) + (a1[3][15] >= v1)) / 9);
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a1[1][11] = (((a1[0][5] > v3) <= (v2 && v1)) / 2);
+        v1 = (((a0[7] / 1) == (v3 * v2)) >= ((v2 - 70) ? (37 % 3) : (v1 && a1[3][13])));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                if ((a1[0][1] ? a0[4] : a1[2][15]) > 90) break;
+                a1[2][5] = (((58 <= a1[2][14]) ? (v0 ? v0 : v3) : (a0[6] + v2)) ? ((65 % 5) >= (v1 == 24)) : ((v2 > 24) * (a0[15] % 7)));
+                v2 = (((v1 / 1) ? (a1[2][4] < i4) : (v2 >= a0[5])) != ((64 <= v2) > (a1[0][14] >= 22)));
+                a1[2][2] = (((a0[3] - v2) != (93 != a0[14])) <= ((a1[2][7] * a1[0][10]) - (v0 || a0[5])));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    v0 = (((58 <= v2) + (a1[3][7] * 27)) == ((a1[1][4] < 93) ? (v1 == 41) : (v3 - 31)));
+    {
+        int i6 = 0;
+        do {
+            v3 = (((96 + a1[3][1]) * (v3 + 63)) * ((v0 + i6) <= (v0 ? a0[15] : v3)));
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    if ((47 % 3) > 72) break;
+                    v2 = (((i6 && i7) >= (6 < v0)) > ((v3 < 19) <= (i7 <= a1[1][2])));
+                    v3 = (((v2 >= 61) < (i7 / 2)) == ((a1[1][10] % 4) < (60 >= a1[1][3])));
+                    v0 = (((a1[1][0] || 28) / 3) || ((v1 <= a1[2][8]) && (a1[1][12] + v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((88 || a1[0][14]) != (70 && 22)) <= ((73 != i6) % 7));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((v1 && v0) >= (v1 && v3)) != ((a1[3][0] / 3) / 6));
+}
+int f1() {
+    int v0 = 12;
+    int v1 = 56;
+    int v2 = 49;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    a1[2][2] = (((a1[0][0] >= v1) > (a1[2][5] + a0[5])) % 8);
+    v0 = (((a0[10] <= a0[7]) == (v0 || 73)) > ((6 < a0[14]) + (76 ? a0[12] : 21)));
+    {
+        int i0 = 0;
+        do {
+            a0[10] = (((97 < v0) >= (22 - 91)) || ((a0[0] % 7) * (i0 || a1[3][1])));
+            v2 = (((57 == 92) != (v0 != v0)) * ((42 <= v3) + (v2 >= v2)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                a0[6] = (((v3 <= 46) || (a0[7] >= v0)) >= ((i1 > a0[13]) != (v3 + a1[2][14])));
+                a0[12] = (((a1[2][5] / 6) >= (v2 == 28)) == ((v2 < a1[1][0]) * (a0[10] * 1)));
+                v0 = (((v3 >= v2) * (63 && 77)) > ((v2 >= 0) > (i1 / 4)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((53 > a0[0]) || (v3 >= a0[4])) == ((10 ? 6 : 26) / 7))) {
+        v3 = (((v3 * v2) > (v3 <= a1[3][11])) * ((v2 % 3) < (v1 + v0)));
+        v1 = (((v1 > v0) != (v1 ? a1[0][11] : 15)) == ((16 == v2) || (v2 - 84)));
+        v2 = (((v2 ? v1 : 95) <= (a0[15] || a1[2][0])) * ((a1[1][7] >= v0) + (v2 < v1)));
+    } else {
+        a1[2][7] = (((37 > a0[7]) % 2) && ((v1 % 7) ? (v0 + v1) : (v0 / 4)));
+        v1 = (((3 > 56) == (a1[0][11] || a0[15])) <= ((a1[2][7] && v1) >= (a1[2][2] * v3)));
+        v2 = (((v2 + 22) - (a0[0] != v2)) > ((93 <= v1) ? (v1 * 26) : (80 % 4)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((89 / 5) > 51) break;
+            v0 = (((a1[3][8] * v3) - (a0[7] < i2)) - ((a0[12] % 3) - (12 % 9)));
+            v3 = (((13 || v0) < (87 * i2)) + ((72 && 75) != (v3 == v3)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v2 = (((4 || a1[2][14]) ? (v1 / 2) : (a1[1][6] % 4)) > ((a1[3][4] == 90) <= (i3 >= a0[12])));
+                    v2 = (((90 >= v2) * (a0[9] > v2)) / 7);
+                    v0 = (((a0[10] / 5) && (65 >= i2)) < ((i2 ? v0 : a1[0][1]) == (a1[3][0] >= 55)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((v0 == a0[7]) <= (8 / 1)) > ((17 * v3) - (a1[2][6] > v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,209 @@
+int f0() {
+    int v0 = 73;
+    int v1 = 20;
+    int v2 = 38;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v0 * v0) > 83) break;
+            v0 = (((63 ? v2 : a0[0]) || (13 >= i0)) || ((2 > v0) + (v2 < a0[5])));
+            {
+                int i1 = 0;
+                do {
+                    a0[5] = (((v3 - i1) <= (v1 + v0)) ? ((a0[2] <= v1) ? (a1[3][12] ? a0[1] : 97) : (v1 && i0)) : ((v2 * 88) < (i1 ? v2 : 96)));
+                    a1[2][5] = (((v3 - v0) == (v3 ? a1[2][11] : v0)) >= ((v1 <= a0[4]) - (i1 + a1[2][10])));
+                    v1 = (((a1[0][12] != i0) ? (a0[9] || v2) : (a1[2][10] / 7)) * ((v0 / 2) != (98 + v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v2 = (((v2 - a1[3][12]) != (v0 % 3)) <= ((i0 < v3) >= (v2 != 2)));
+            i0 = i0 + 1;
+        }
+    }
+    a0[5] = (((v2 * a1[2][12]) / 6) != ((a1[0][13] / 4) ? (v2 == a0[5]) : (a1[2][3] - 80)));
+    a1[0][4] = (((77 || a0[9]) < (a1[3][8] < a1[3][8])) == ((98 - 90) * (3 && 6)));
+    a1[0][3] = (((53 ? a0[0] : v2) * (v1 * v1)) - ((v0 > a1[0][0]) % 8));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v1 = (((v3 < a1[1][1]) - (a1[3][15] > 65)) < ((i2 % 6) + (a1[3][10] && a1[1][7])));
+                    v0 = (((3 != 17) > (4 % 6)) != ((57 % 1) && (26 && v0)));
+                    v1 = (((a0[5] / 6) < (i3 <= 65)) != ((a0[8] / 6) < (i3 != i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((v3 && v2) + (a1[3][10] ? v3 : 94)) > ((23 ? v2 : a0[13]) <= (47 && 47)));
+            a1[3][1] = (((v0 >= a0[0]) && (i2 ? a1[2][5] : 62)) - ((v0 * 35) && (i2 ? 44 : v2)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((a0[1] < a1[1][2]) ? (v1 - v3) : (v0 && 95)) != ((v0 || 55) == (v3 == 8)));
+}
+int f1() {
+    int v0 = 47;
+    int v1 = 43;
+    int v2 = 44;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v1 = (((13 / 5) % 9) % 5);
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v0 = (((v2 >= v3) == (v2 * v0)) < ((v3 / 8) >= (v2 < v1)));
+                    v1 = (((a0[15] * a0[9]) ? (i1 - 69) : (35 != i1)) ? ((54 / 3) <= (v0 + 72)) : ((a0[6] < a1[0][6]) >= (i0 != v0)));
+                    a0[11] = (((82 + i1) < (a0[8] / 5)) ? ((i0 ? v1 : v2) / 5) : ((i0 ? v3 : a0[11]) / 7));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((i0 / 3) == (v1 > i0)) + ((a0[5] ? 36 : 89) % 6));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a1[3][12] < v1) + (a1[0][9] * i2)) - ((v0 == a1[3][0]) <= (37 != 16)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v0 = (((i2 ? 47 : 28) + (62 / 3)) && ((i2 && 1) < (v3 / 5)));
+                a1[3][1] = (((89 ? i3 : i2) || (70 / 4)) ? ((a1[3][3] + i2) / 7) : ((a0[13] <= a0[0]) / 2));
+                v3 = (((1 / 6) == (a1[3][8] / 1)) * ((v0 && v2) || (a1[0][12] - i3)));
+            }
+            v2 = (((20 && i2) - (v0 <= v1)) ? ((a1[0][1] >= i2) > (37 / 6)) : ((v0 <= 34) < (a1[1][6] - a0[3])));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v1 = (((v1 - a1[3][7]) || (18 - v1)) > ((29 >= 53) ? (a0[7] * v0) : (v3 != v2)));
+            v0 = (((a0[15] == v0) < (72 % 5)) == ((a1[3][14] == v0) + (2 ? a0[9] : a0[5])));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((a0[10] <= 68) || (34 ? v2 : i4)) <= ((65 * 19) != (1 * 16)));
+                    v0 = (((v0 > i5) - (v1 >= v0)) <= ((a0[11] % 3) <= (v0 == i5)));
+                    v1 = (((v3 * 1) % 8) - ((v1 != i5) != (v2 ? 27 : v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            a0[4] = (((i6 < v1) < (i6 != a1[3][11])) && ((a1[3][13] && 46) >= (a0[2] > a1[2][0])));
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                a0[7] = (((a0[15] - v3) != (9 > a1[2][14])) == ((v2 <= 37) + (a1[2][12] ? i7 : v3)));
+                a1[1][7] = (((i7 && a0[0]) != (v1 + a1[1][12])) != ((v3 ? 22 : 62) <= (23 - v0)));
+                v1 = (((64 && v1) * (i7 != v1)) >= ((38 != a0[8]) / 2));
+            }
+            v2 = (((30 < a1[1][11]) > (i6 >= 5)) + ((25 % 4) % 8));
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 4) {
+            if ((a0[3] <= v0) > 85) break;
+            v1 = (((i8 >= v3) <= (15 == a0[3])) > ((v3 * 26) && (v1 > v2)));
+            {
+                int i9 = 0;
+                while (i9 < 5) {
+                    v0 = (((51 || i9) ? (86 && 88) : (97 != a1[2][4])) || ((i8 % 8) - (a1[2][5] - a1[0][5])));
+                    v3 = (((v1 == i9) > (a1[0][12] || v1)) ? ((a0[7] % 2) < (v0 < 13)) : ((58 < a0[0]) <= (0 ? a1[0][15] : i9)));
+                    v3 = (((v0 + a1[2][15]) != (82 ? i8 : 0)) / 3);
+                    i9 = i9 + 1;
+                }
+            }
+            v2 = (((a0[7] ? 30 : a1[3][15]) || (v2 % 5)) || ((v0 / 5) + (29 <= v2)));
+            i8 = i8 + 1;
+        }
+    }
+    return (((37 || v1) - (v1 <= a1[0][6])) ? ((a1[0][12] % 1) - (78 < v1)) : ((v3 || v1) < (v2 % 5)));
+}
+int f2() {
+    int v0 = 39;
+    int v1 = 41;
+    int v2 = 85;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v3 = (((91 >= 98) > (v0 == 57)) - ((a1[0][10] * a1[2][7]) == (v3 || a1[1][11])));
+        a0[12] = (((v0 + i0) / 5) - ((98 * 22) > (v2 <= a1[2][11])));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v3 = (((i1 == a0[7]) == (a0[8] != i1)) < ((10 / 8) || (v1 / 8)));
+                a1[3][8] = (((a1[3][7] <= 84) == (a1[3][6] - v3)) && ((v2 >= v2) - (a0[13] / 2)));
+                v0 = (((v0 || a0[7]) * (v3 != i1)) != ((v1 / 4) * (a0[9] ? i1 : v3)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((19 - a0[2]) > 51) break;
+            v0 = (((v0 >= v0) || (a0[15] % 2)) * ((89 && a1[1][2]) + (v3 * 55)));
+            v0 = (((v2 <= 23) >= (a1[3][1] % 5)) >= ((66 + i2) > (92 + i2)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((a0[15] % 3) > 94) break;
+                v0 = (((a1[3][3] - v3) != (v0 - a1[1][4])) <= ((v2 / 9) + (a0[7] >= a1[2][8])));
+                a1[1][3] = (((12 < 68) || (v3 >= 51)) < ((v0 < 37) ? (41 - i2) : (87 % 8)));
+                v1 = (((8 * a1[3][6]) == (0 >= v2)) == ((a1[2][13] % 8) < (a0[9] <= v0)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            a0[11] = (((i4 * i4) != (a1[3][15] == v2)) + ((v2 < a1[2][5]) + (i4 >= 77)));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    v1 = (((a1[2][12] != v0) && (44 * a0[11])) == ((v0 < a1[3][5]) < (v1 / 3)));
+                    v1 = (((a1[1][9] <= 18) ? (v1 ? a1[0][12] : i4) : (v0 && v0)) - ((49 > i5) && (8 + a1[0][10])));
+                    a1[2][10] = (((v3 || a1[3][9]) - (v0 || a0[5])) <= ((a1[2][10] == v2) >= (72 + a1[2][5])));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((a1[1][13] != v2) >= (86 || 67)) || ((a1[0][3] ? a1[2][2] : i4) != (v1 <= v0)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            v3 = (((a1[1][6] < 47) > (v2 < a1[3][12])) < ((28 ? v2 : a0[13]) && (61 ? v3 : 40)));
+            v3 = (((v3 != 93) != (a1[1][6] || v0)) < ((v3 < v2) && (83 && v0)));
+            v3 = (((5 * v3) - (i6 * v2)) + ((v0 / 6) % 3));
+        }
+        v1 = (((a0[1] * a0[5]) >= (v0 <= v2)) >= ((12 < 23) > (a1[2][3] / 6)));
+        v1 = (((v3 % 7) < (v2 != v0)) < ((58 * a0[14]) || (i6 || a0[11])));
+    }
+    if ((((a0[3] < a0[15]) % 1) - ((a1[0][5] < 32) == (v3 * v2)))) {
+        v3 = (((v0 >= 18) * (v1 ? v1 : v3)) || ((v1 >= v3) + (v0 ? v3 : 97)));
+        v2 = (((v1 + a1[2][12]) - (v0 ? v1 : 53)) >= ((82 < v1) && (a1[0][2] ? v0 : 80)));
+        v0 = (((v1 / 3) ? (v0 - v2) : (28 ? v0 : v1)) * ((2 + v0) <= (v3 >= a0[1])));
+    } else {
+        v0 = (((a1[3][12] || 47) ? (v2 > v3) : (12 <= v2)) / 1);
+        v1 = (((a0[7] >= a1[1][5]) * (a1[2][4] && a0[10])) && ((a0[14] < a0[10]) || (v1 < 12)));
+        a0[6] = (((a1[2][15] <= a1[2][9]) ? (v2 && v0) : (v0 >= a0[10])) || ((v1 - v2) / 4));
+    }
+    return (((v2 / 2) && (94 <= 7)) - ((v3 || v0) == (66 - v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,75 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 99;
+    int v2 = 17;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((v3 <= a0[7]) || (a1[1][13] >= 10)) - ((v3 > 64) == (a0[7] - a1[2][10])));
+                a0[9] = (((a1[2][2] - 24) > (a1[2][7] != i0)) != ((i0 > 51) % 1));
+                v1 = (((74 > 40) > (i0 % 4)) / 8);
+            }
+            v3 = (((v1 != v2) ? (i0 <= 23) : (v1 - 6)) && ((32 ? v2 : 46) <= (v2 + 94)));
+            v3 = (((a1[3][6] > v0) ? (v3 != i0) : (a1[2][7] || v0)) > ((a1[2][4] >= v2) == (a0[0] ? 9 : a1[1][5])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((73 <= v1) > 68) break;
+            a0[11] = (((89 == 67) >= (v0 / 5)) + ((v3 > v3) * (i2 * 0)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((a0[4] * a0[4]) * (v1 < a0[0])) / 5);
+                v2 = (((i3 > v0) != (v3 >= v1)) + ((v0 * i2) ? (86 ? 66 : v1) : (i2 >= v3)));
+                v1 = (((v2 == 88) != (a0[10] * 65)) / 2);
+            }
+            v1 = (((3 || a1[0][13]) <= (70 == a0[11])) ? ((a0[1] || v1) ? (i2 + v3) : (i2 >= v3)) : ((v2 < i2) <= (v2 || i2)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v0 = (((a0[13] != a1[2][7]) == (16 ? v1 : v1)) <= ((v3 ? v2 : 19) < (76 > a0[9])));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((14 + v3) ? (v2 && a0[3]) : (12 >= 55)) == ((90 >= v3) ? (v0 || a1[0][12]) : (i4 || 34)));
+                    v3 = (((v0 >= v3) / 8) == ((i5 >= a1[2][11]) >= (v3 >= v3)));
+                    v2 = (((i5 && a1[0][7]) / 3) ? ((a1[1][11] == i5) && (i5 + v2)) : ((i5 ? v2 : 55) && (v1 % 8)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            a1[3][1] = (((96 ? 44 : v3) || (49 >= a1[3][7])) <= ((i4 <= i4) ? (a1[0][12] - v1) : (v1 ? 84 : i4)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((83 + i6) > 79) break;
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v2 = (((43 >= a0[2]) + (a0[8] == v1)) + ((v1 != i7) != (i6 && v1)));
+                    a1[1][11] = (((88 <= v1) >= (v0 < i6)) <= ((i6 % 5) % 1));
+                    v3 = (((4 - a0[8]) < (v1 && v1)) != ((v3 ? a0[11] : 32) + (60 % 6)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((a1[2][12] != 28) + (a1[3][7] % 5)) * ((11 ? i6 : a0[15]) <= (v2 || a0[6])));
+            v2 = (((a1[2][5] || v2) == (18 ? a1[2][12] : v2)) + ((v0 && 9) < (v0 % 2)));
+            i6 = i6 + 1;
+        }
+    }
+    a1[3][1] = (((v2 / 7) && (v3 || a0[10])) || ((48 % 5) && (v3 * 61)));
+    return (((v0 >= v3) * (54 > v2)) >= ((a0[9] ? a1[1][2] : v1) <= (a0[11] + a0[1])));
+}
+int main() {
+    return 0;
+}
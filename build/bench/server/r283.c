@@ -0,0 +1,153 @@
+int f0() {
+    int v0 = 80;
+    int v1 = 85;
+    int v2 = 36;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    a0[14] = (((88 / 3) != (v2 >= 0)) + ((v3 <= a0[3]) % 4));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a1[3][5] % 3) && (v0 && v3)) && ((v0 > i0) >= (v3 + i0)));
+                    v0 = (((29 ? a0[9] : a1[1][3]) == (v2 - 20)) || ((v1 % 2) % 3));
+                    v0 = (((v3 / 6) <= (30 ? a1[0][15] : 74)) || ((3 != 81) > (9 >= v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v0 = (((v1 ? 27 : a1[1][1]) <= (v3 / 3)) + ((12 > 6) != (a0[13] <= a0[1])));
+            v2 = (((a0[2] || i0) ? (a0[0] < a0[8]) : (v3 == 85)) + ((v1 <= 94) / 3));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a0[1] = (((v1 >= v1) > (v0 == a0[3])) >= ((a0[7] || v1) != (33 % 2)));
+            v1 = (((v1 * 56) * (v0 / 6)) || ((78 - v2) || (v3 == v1)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    a0[8] = (((v3 - a0[5]) + (i2 / 4)) + ((a1[0][12] ? a1[3][8] : a1[0][9]) / 2));
+                    v0 = (((v3 ? i2 : a0[5]) ? (i2 > v0) : (v1 > a0[2])) * ((a1[0][4] * i2) % 1));
+                    v3 = (((a0[13] != a0[8]) * (a0[6] ? i2 : i3)) <= ((i2 <= v1) % 1));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((57 + a1[1][12]) > 68) break;
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v3 = (((a1[2][13] ? a0[8] : 13) != (v2 - a1[0][13])) - ((a0[3] < v1) / 6));
+                    v2 = (((v2 < v3) != (7 < a1[3][2])) / 4);
+                    v1 = (((v2 % 3) ? (i5 && i4) : (v0 >= 27)) || ((a0[13] < v2) != (i4 < a1[0][14])));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[5] = (((v2 >= v1) && (v2 <= 71)) > ((a1[1][8] * v1) / 9));
+            v2 = (((0 > a0[7]) ? (v0 ? i4 : v2) : (a1[3][6] ? 13 : 45)) != ((66 <= 62) - (i4 ? a0[3] : v3)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        if ((v2 * v2) > 85) break;
+        v2 = (((v0 - v3) >= (4 || v0)) && ((v1 + v0) ? (v0 * v1) : (v0 > a1[0][9])));
+        a1[2][0] = (((v1 ? a1[1][2] : i6) / 9) != ((8 * i6) < (a0[13] > 70)));
+        {
+            int i7 = 0;
+            do {
+                a0[6] = (((i6 + v3) > (i7 != a1[1][2])) ? ((a0[8] % 5) * (v3 == 82)) : ((a0[2] < i6) == (v3 + i7)));
+                v1 = (((a0[7] - v3) && (a0[14] >= v3)) ? ((i7 - a0[14]) / 3) : ((v2 || a1[0][10]) ? (i6 != v0) : (v2 * 23)));
+                v1 = (((v2 <= v2) < (v3 - i7)) > ((v2 % 7) <= (55 >= 55)));
+                i7 = i7 + 1;
+            } while (i7 < 2);
+        }
+    }
+    return (((v0 - v1) != (v3 - v1)) / 3);
+}
+int f1() {
+    int v0 = 60;
+    int v1 = 86;
+    int v2 = 99;
+    int v3 = 98;
+    int a0[16];
+    int a1[4][16];
+    if ((((50 + 24) ? (7 < v1) : (43 && 9)) - ((v3 + a1[0][9]) && (a1[3][10] >= 34)))) {
+        a0[4] = (((v3 + v1) ? (a1[2][14] / 2) : (a1[3][15] < v0)) / 4);
+        a1[2][9] = (((v3 >= a1[1][7]) ? (a1[0][2] && v0) : (v2 >= v0)) || ((a0[5] >= a0[15]) <= (a1[3][0] * v0)));
+        a1[2][11] = (((v0 ? 91 : v1) > (v0 > 77)) % 1);
+    } else {
+        v1 = (((a0[3] >= v2) * (a0[7] || 10)) - ((a1[3][1] * 29) + (a0[4] != 98)));
+        a1[3][0] = (((v1 <= v2) + (a0[7] && a1[2][8])) - ((12 < 94) + (92 - 74)));
+        v0 = (((61 % 7) >= (v0 ? a0[12] : a0[2])) % 2);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[0][5] = (((v2 < v0) <= (v3 * a1[2][4])) && ((a1[1][6] == v1) == (v2 - v0)));
+            v3 = (((a1[3][8] || i0) || (v0 <= v3)) ? ((v1 || 95) || (a1[2][3] / 5)) : ((v1 / 4) + (a0[0] == v0)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((83 || v1) ? (v0 / 4) : (a0[14] != 18)) > ((v1 % 5) % 1));
+                    a1[0][15] = (((a0[9] ? v3 : a0[11]) ? (39 % 3) : (v3 * v0)) ? ((i0 || 75) != (v3 && v3)) : ((92 / 3) > (i0 >= 99)));
+                    a0[0] = (((i0 != 24) - (10 > 39)) / 6);
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[3][1] = (((17 / 6) == (v0 ? a0[15] : a0[13])) != ((v0 || v0) + (2 != 92)));
+            v3 = (((81 <= a0[7]) <= (0 % 2)) * ((a0[4] && v3) > (22 / 3)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v2 = (((77 % 9) * (11 < a1[3][12])) || ((v2 * a0[2]) && (i3 || a1[2][7])));
+                v3 = (((v2 != v0) / 5) == ((92 != i3) % 9));
+                v2 = (((i2 / 9) * (v0 >= 42)) < ((39 || v0) / 7));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((v3 ? 23 : v2) >= (v1 * a1[2][4])) - ((v3 / 2) + (97 ? a1[3][1] : 12)))) {
+        v2 = (((v0 >= a1[3][14]) + (v3 * v1)) ? ((v0 * v3) ? (a0[11] != 8) : (49 != v1)) : ((v2 ? 27 : v0) / 9));
+        a1[1][12] = (((v3 != 64) - (47 % 7)) && ((22 || a0[5]) % 7));
+        v1 = (((v2 > v0) + (v0 ? v0 : v2)) / 2);
+    } else {
+        v1 = (((v0 && a0[8]) && (97 / 9)) && ((70 - a1[1][10]) == (a0[4] % 9)));
+        a0[5] = (((66 / 6) <= (v3 * v2)) != ((v3 != v0) != (46 <= v3)));
+        a1[3][2] = (((v0 > 98) && (v0 >= 53)) > ((16 <= 50) >= (a1[2][0] == v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a0[0] = (((v1 > a1[3][8]) != (24 > a0[0])) + ((a1[0][11] > v2) % 7));
+            a0[9] = (((a0[15] >= 94) == (13 - v2)) >= ((i4 % 2) / 8));
+            {
+                int i5 = 0;
+                do {
+                    a1[0][12] = (((3 || a0[3]) < (v3 / 2)) * ((i5 * v2) >= (a0[15] && v0)));
+                    v3 = (((78 ? a0[6] : a1[3][11]) ? (v3 != v0) : (a1[3][4] != a1[2][10])) * ((75 < v3) >= (i5 || a1[1][0])));
+                    v2 = (((v0 < v1) == (i5 < v0)) ? ((62 < a0[0]) <= (v3 * i5)) : ((v1 > v2) < (i5 == i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((v0 % 3) % 9) ? ((v2 || a0[7]) > (a0[2] * 33)) : ((v2 % 2) * (v1 ? 36 : v0)));
+}
+int main() {
+    return 0;
+}
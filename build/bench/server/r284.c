@@ -0,0 +1,199 @@
+int f0() {
+    int v0 = 97;
+    int v1 = 10;
+    int v2 = 24;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 >= a0[6]) + (a1[0][3] ? v3 : v0)) - ((v3 && 61) % 3))) {
+        v1 = (((v2 ? v3 : a1[1][8]) + (a0[1] ? v0 : v2)) < ((99 || v1) || (v2 || 18)));
+        a0[6] = (((a1[3][14] ? a1[0][14] : v0) != (73 + v3)) >= ((v3 <= v1) > (v3 || 51)));
+        v0 = (((v1 || v2) < (a1[2][7] / 7)) == ((v1 <= a1[3][4]) && (v3 % 1)));
+    } else {
+        v0 = (((a0[7] == v1) ? (20 > 39) : (34 && a1[2][10])) / 8);
+        a0[6] = (((v1 <= a1[2][4]) ? (a0[4] < a0[1]) : (v3 < v0)) - ((v3 != v3) + (v2 * a1[3][4])));
+        v0 = (((v1 < a0[10]) ? (16 ? v0 : 93) : (v0 >= 75)) && ((a0[1] <= 91) != (a0[0] ? v0 : v0)));
+    }
+    a0[14] = (((v0 / 2) < (v0 * 94)) ? ((v0 % 2) && (71 || v3)) : ((25 < 13) < (v2 <= 7)));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v1 = (((v2 >= v1) < (v1 >= a1[2][12])) >= ((a0[12] ? 90 : v2) ? (v2 > 52) : (23 <= v3)));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                v0 = (((i0 >= i0) == (a1[3][14] < v0)) ? ((a1[1][4] % 4) ? (v0 - v3) : (a1[3][2] <= v2)) : ((42 / 2) % 1));
+                v3 = (((a1[3][2] ? a0[1] : 18) - (v3 * 19)) > ((v2 != a0[7]) < (71 > v3)));
+                v3 = (((a0[4] == i0) + (79 != v3)) && ((i0 / 1) * (a1[2][8] <= i1)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[3][2] = (((a0[1] % 1) ? (v3 * a0[1]) : (55 != v0)) / 4);
+    }
+    if ((((66 == 46) - (a1[2][9] / 4)) > ((87 ? 74 : 66) > (v0 > 0)))) {
+        v1 = (((v0 % 8) - (8 * v2)) >= ((v3 < 87) ? (v2 / 1) : (65 / 2)));
+        v3 = (((v2 * a0[11]) / 1) || ((21 * v2) > (68 % 1)));
+        v1 = (((v1 ? a1[2][12] : v1) ? (89 || a1[0][6]) : (v1 > v2)) / 9);
+    } else {
+        v0 = (((a0[4] > v0) == (v1 >= v1)) == ((a0[5] + v3) <= (a0[3] || v2)));
+        a0[6] = (((a1[3][5] || v3) ? (52 <= 3) : (v0 ? a1[0][6] : 11)) % 4);
+        a1[2][15] = (((v0 + v1) && (v2 != a1[2][15])) ? ((a0[9] && a1[2][6]) || (a0[9] != 67)) : ((a0[0] != a0[8]) < (8 > v3)));
+    }
+    a1[1][14] = (((v2 ? a1[1][7] : v3) && (31 - v0)) || ((20 + v1) <= (a1[0][4] ? v3 : 69)));
+    return (((a1[2][12] * 63) * (v2 ? a1[2][0] : v1)) > ((12 - v1) > (v0 / 5)));
+}
+int f1() {
+    int v0 = 6;
+    int v1 = 72;
+    int v2 = 32;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((14 / 8) ? (v2 < 35) : (31 != a1[2][11])) != ((98 % 1) * (85 ? a1[0][1] : 60)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v1 = (((41 <= v2) <= (v3 != a0[10])) + ((v2 - i1) / 8));
+                v1 = (((v1 != v3) > (91 * v2)) >= ((v3 != v0) / 4));
+                v3 = (((i0 * i1) + (i0 ? v1 : v3)) && ((v1 || 10) % 7));
+            }
+            a0[13] = (((10 != v1) || (a1[0][10] * i0)) >= ((a0[1] - v1) == (a1[3][14] ? i0 : v3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[9] = (((v3 >= i2) % 9) % 7);
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a0[9] = (((a0[7] <= 63) * (a1[1][3] + a0[6])) > ((v0 > i2) ? (i2 >= i3) : (a1[3][13] && 25)));
+                    a0[10] = (((96 <= v0) || (v2 && v1)) == ((v2 ? 8 : 53) != (i2 ? a0[4] : 99)));
+                    v0 = (((a1[2][12] + v0) ? (v1 + a1[0][6]) : (v3 ? v1 : a0[14])) ? ((v2 == a1[2][0]) <= (v2 % 3)) : ((86 * a0[0]) ? (i2 * 39) : (6 >= v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((a1[1][15] / 8) / 7) >= ((a1[3][11] ? a0[8] : v1) != (58 != i2)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a1[0][5] = (((i4 + v2) > (v1 % 3)) + ((v2 + a1[0][11]) + (v3 * a0[9])));
+            v3 = (((v3 != 10) - (40 + a1[3][7])) == ((a0[12] && a0[5]) ? (v3 || 87) : (v3 - a1[0][15])));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a0[5] = (((a1[2][8] / 8) != (12 > i5)) + ((v2 || a0[7]) / 8));
+                a1[0][2] = (((v3 == v0) >= (v3 % 9)) || ((v1 > v2) <= (v1 + v0)));
+                v3 = (((v1 / 4) * (i5 / 7)) >= ((70 < a0[10]) % 8));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[6] >= a0[14]) <= (v0 / 2)) ? ((a0[1] + 77) || (v0 % 4)) : ((32 != v3) / 5))) {
+        v3 = (((v0 > v3) != (13 == v0)) - ((v1 >= 7) / 1));
+        a1[0][1] = (((v1 ? 99 : 67) / 9) * ((69 <= 14) != (v0 != 51)));
+        a1[2][4] = (((19 ? 97 : v1) / 8) >= ((v3 == v1) % 5));
+    } else {
+        v1 = (((a1[2][6] <= v2) || (v1 < v3)) + ((93 + 59) / 7));
+        v3 = (((v3 > 52) || (a1[3][3] < v0)) + ((a0[13] / 3) * (v0 < v3)));
+        a0[6] = (((v3 < v0) || (v0 < v1)) != ((a0[4] == v3) != (v2 > v0)));
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        if ((i6 - a0[11]) > 61) break;
+        v1 = (((v3 <= v3) ? (v1 >= 56) : (a1[3][3] * v0)) * ((a1[0][10] / 6) && (a1[2][5] <= a1[3][1])));
+        v2 = (((88 * v0) != (39 >= a0[15])) - ((v1 / 4) != (v3 < 84)));
+        {
+            int i7 = 0;
+            do {
+                v3 = (((v0 - 8) != (i7 || 83)) != ((a1[3][0] + 73) ? (70 / 5) : (i6 >= v0)));
+                a1[0][8] = (((v0 <= a0[7]) - (69 == 85)) / 4);
+                v2 = (((v1 + 0) % 7) && ((a1[0][3] && a1[3][0]) % 2));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+    }
+    return (((41 * a1[2][1]) > (a1[3][2] && 93)) > ((v2 < v2) * (v2 == v1)));
+}
+int f2() {
+    int v0 = 43;
+    int v1 = 4;
+    int v2 = 31;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 == a0[15]) % 3) != ((v2 / 4) == (v1 % 4)))) {
+        a1[0][15] = (((84 != 82) + (v3 != a1[2][7])) == ((v1 || 18) * (a1[3][12] % 9)));
+        v1 = (((v2 % 3) > (a1[2][10] ? v2 : v3)) * ((v0 ? a1[3][4] : a1[2][14]) * (a0[7] == v2)));
+        v3 = (((v0 - v2) >= (65 % 4)) >= ((64 < v3) ? (8 * v3) : (v0 * 97)));
+    } else {
+        v3 = (((v0 % 9) % 6) < ((v2 && 60) / 8));
+        v1 = (((v3 <= v1) != (a0[6] && a1[3][12])) == ((a0[14] != v0) != (68 > 12)));
+        v0 = (((v0 >= 57) * (v2 > v1)) * ((v2 == v3) ? (v3 + 73) : (v3 - 83)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((27 >= 6) > 92) break;
+            a0[8] = (((70 == v0) <= (a0[7] || v2)) && ((v2 > i0) <= (i0 % 2)));
+            v3 = (((7 % 2) >= (84 != v0)) * ((v2 * 72) ? (v1 ? a1[2][11] : a0[13]) : (18 == v1)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((45 && a0[8]) % 3) > ((i0 >= a1[3][7]) ? (v0 / 8) : (v1 % 3)));
+                    a1[1][8] = (((a1[1][15] ? a0[7] : a0[0]) < (v1 - i0)) ? ((a1[2][11] < 33) > (44 >= v3)) : ((a0[0] && 0) * (a1[1][6] + a1[0][12])));
+                    v2 = (((v3 * a0[6]) - (i0 != 3)) >= ((a0[7] - v1) - (95 / 5)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((v3 && v3) > 88) break;
+                    a1[2][2] = (((v2 > 7) == (a0[10] != 30)) != ((15 < 52) > (a0[14] ? v2 : 53)));
+                    v0 = (((v1 - 14) == (v2 <= a1[0][8])) + ((v3 != i3) ? (34 || a1[2][7]) : (v2 + a0[12])));
+                    a1[0][13] = (((71 % 4) * (v1 - 1)) && ((i3 < a0[0]) ? (22 >= v3) : (a1[1][10] <= v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((54 % 8) * (a0[3] / 5)) ? ((v1 > a1[3][12]) && (a0[6] ? a0[6] : 41)) : ((v3 + 95) > (10 || v2)));
+            v1 = (((a1[1][13] >= 35) && (v1 % 8)) > ((v1 + a1[3][8]) + (v1 || i2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((a0[7] >= i4) > 80) break;
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                a0[11] = (((78 * 32) > (v3 == v2)) != ((v1 + 60) ? (a1[2][8] ? i4 : v0) : (14 != a0[9])));
+                v1 = (((v0 * 57) < (v1 * v0)) != ((v0 == i5) ? (31 && v0) : (a1[1][0] && v2)));
+                a0[3] = (((v0 / 2) + (v3 == a1[1][10])) + ((a0[6] ? i4 : a1[1][6]) > (v3 == v2)));
+            }
+            v0 = (((a0[2] % 1) - (a0[14] / 8)) || ((83 || 48) > (v2 % 5)));
+            a1[1][9] = (((88 <= v3) <= (v0 && a0[9])) || ((v2 ? v3 : a0[1]) == (97 % 8)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        if ((a1[2][13] / 3) > 50) break;
+        a0[3] = (((i6 ? v3 : a1[3][3]) <= (a1[2][1] / 6)) ? ((v1 % 5) * (3 || v3)) : ((v1 >= a0[3]) % 9));
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            if ((64 < i6) > 58) break;
+            v2 = (((a1[3][6] < i6) != (43 ? 75 : v2)) >= ((a1[1][14] == v2) * (v1 == v1)));
+            v3 = (((a1[0][12] - v3) % 7) % 1);
+            v0 = (((a1[1][0] / 1) / 2) <= ((56 - v2) * (a0[6] != v2)));
+        }
+        a1[1][11] = (((a1[3][14] - a0[8]) > (a0[15] || 26)) == ((4 % 4) > (v0 * i6)));
+    }
+    return (((46 % 9) == (v3 == a1[0][15])) + ((v3 < v2) != (22 < a0[6])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,59 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 47;
+    int v2 = 65;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][6] = (((v0 <= a0[2]) == (v3 == a0[1])) > ((v1 > i0) == (v0 / 2)));
+            v0 = (((v0 > 78) + (v2 && 34)) ? ((i0 > i0) || (a1[2][11] == v0)) : ((v3 ? v3 : i0) > (v0 == v1)));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((i1 || v1) == (i0 ? 49 : 18)) < ((v1 / 2) || (v3 * 84)));
+                    a0[1] = (((v3 / 2) ? (v1 - 28) : (18 < 16)) ? ((v3 * v1) != (a1[3][10] ? i1 : i1)) : ((v1 <= v1) ? (a0[13] / 7) : (v3 != 83)));
+                    v3 = (((66 ? v0 : v2) >= (i1 && a0[10])) || ((20 && v3) >= (v0 < v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v3 < i2) * (v2 > 70)) - ((16 < v0) ? (i2 < a1[1][8]) : (v3 >= 92)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                if ((18 != 82) > 88) break;
+                v3 = (((v1 <= i2) == (i3 + v2)) != ((v0 <= 18) ? (v0 % 7) : (v2 % 4)));
+                a1[3][15] = (((v3 + a1[1][0]) != (v1 > 8)) % 6);
+                v2 = (((v1 && i3) || (20 <= i2)) || ((22 - a0[2]) ? (a0[13] <= 6) : (a0[10] ? i2 : v0)));
+            }
+            v3 = (((a0[7] == a1[2][10]) ? (81 + 75) : (a0[7] < a1[1][14])) < ((v0 - 45) + (i2 <= v0)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v2 = (((83 / 8) / 8) || ((v2 != 2) ? (v3 - v3) : (10 % 4)));
+    a1[0][6] = (((a1[2][14] / 8) - (a0[0] ? v1 : 94)) || ((2 || 97) + (a1[3][5] - v3)));
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        if ((v3 ? a0[0] : v1) > 50) break;
+        v1 = (((v1 * v0) ? (i4 * v0) : (a0[0] % 8)) == ((v1 <= 22) || (a0[10] >= v2)));
+        v1 = (((v0 < 9) % 7) < ((v2 || a0[4]) <= (a0[14] + a0[9])));
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                a1[1][0] = (((29 ? i5 : i4) < (v0 > i5)) || ((34 ? v0 : 82) || (a0[6] - v1)));
+                v0 = (((v1 / 4) / 1) || ((i5 == a1[0][9]) < (i4 % 7)));
+                a1[1][14] = (((i4 + v2) % 6) - ((v0 != a1[0][8]) % 2));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    return (((a1[3][11] * 91) == (v1 <= 84)) == ((v2 * 93) % 3));
+}
+int main() {
+    return 0;
+}
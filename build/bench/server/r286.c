@@ -0,0 +1,134 @@
+int f0() {
+    int v0 = 51;
+    int v1 = 71;
+    int v2 = 91;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    if ((((91 != v2) - (a0[2] > a0[11])) < ((v2 + a1[1][4]) && (v1 && 6)))) {
+        a1[2][14] = (((v0 >= v1) ? (19 ? v2 : a0[13]) : (27 != 49)) < ((32 != a1[2][2]) - (v3 || a0[13])));
+        v0 = (((a1[1][3] / 8) != (1 + 36)) != ((a0[4] > a1[3][5]) * (82 ? v3 : a1[1][5])));
+        v1 = (((82 % 1) + (a1[2][12] && v2)) / 6);
+    } else {
+        v0 = (((91 ? v1 : v1) ? (a0[13] < v0) : (a0[1] % 1)) * ((v1 * v2) <= (v2 < a0[14])));
+        a1[3][9] = (((a1[1][5] * v0) == (a0[12] > v1)) <= ((v0 ? 29 : v0) ? (77 * a0[5]) : (a1[0][7] / 8)));
+        a1[2][4] = (((v3 / 7) <= (a0[0] * v1)) % 6);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a1[1][0] = (((28 ? i0 : 9) - (i1 <= v0)) % 1);
+                    a1[3][8] = (((v2 < 26) ? (v3 % 3) : (i0 * a0[12])) % 2);
+                    v0 = (((v3 * i0) % 9) && ((a1[1][3] != a0[11]) * (97 > a0[8])));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[9] = (((v2 <= a1[1][8]) * (v0 / 5)) / 3);
+            v3 = (((a1[0][7] > 53) && (v0 || v0)) || ((a0[0] > v0) - (v1 > v1)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            if ((i3 <= v3) > 59) break;
+            v0 = (((v2 || 59) ? (82 - 51) : (i3 <= v2)) * ((44 ? a1[2][3] : i2) > (a0[13] / 8)));
+            a0[7] = (((v2 / 8) != (v0 % 9)) % 5);
+            v3 = (((i3 < v3) + (39 ? i3 : a1[0][0])) % 5);
+        }
+        v3 = (((a1[1][5] >= 0) > (a0[6] != v0)) ? ((65 + v2) < (v0 / 5)) : ((12 + a1[2][13]) ? (v3 || 20) : (a0[12] != a1[2][13])));
+        a0[13] = (((i2 == v0) > (v2 && v2)) / 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    a0[5] = (((a1[2][6] % 3) ? (i4 || 76) : (a1[1][7] > v1)) <= ((v0 - a0[9]) <= (a1[1][9] + v1)));
+                    v1 = (((57 <= v1) <= (a1[1][5] / 2)) ? ((19 > a0[14]) ? (v1 || v0) : (0 != i4)) : ((a1[0][2] ? v1 : 41) || (56 - a1[0][7])));
+                    v0 = (((a0[1] ? v0 : i4) <= (v2 ? v3 : v1)) != ((94 && a1[3][4]) + (86 < i5)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[13] = (((83 ? i4 : 55) != (a0[2] / 3)) != ((v1 || 36) + (v2 && v2)));
+            a0[0] = (((a1[0][6] < i4) < (v3 % 2)) > ((91 % 7) % 2));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a1[2][6] < 87) % 9) ? ((a0[10] == v1) / 4) : ((28 <= v2) + (a1[3][12] / 8)))) {
+        v0 = (((a1[2][7] || 89) * (v1 ? a1[2][9] : 65)) < ((v1 < a0[7]) - (46 ? v1 : v1)));
+        a0[8] = (((60 && v3) || (a0[0] == v2)) * ((a1[0][15] + a0[5]) < (a1[2][13] > v1)));
+        v0 = (((v3 != v1) * (v3 > v0)) > ((18 % 4) == (v0 ? 57 : 97)));
+    } else {
+        a1[3][8] = (((14 - v1) && (v2 < 86)) <= ((97 - a0[3]) * (75 < v1)));
+        v0 = (((v2 < v2) && (a0[7] + 79)) / 3);
+        v3 = (((v2 == v0) >= (v0 % 6)) == ((v2 == v1) % 2));
+    }
+    return (((a0[7] && v0) ? (a0[7] < 64) : (a0[3] * v3)) <= ((a0[8] <= v0) + (41 * v3)));
+}
+int f1() {
+    int v0 = 44;
+    int v1 = 74;
+    int v2 = 1;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    if ((((96 == v2) - (58 <= 58)) && ((a1[1][14] < a1[3][7]) ? (50 <= v1) : (v1 < v1)))) {
+        v2 = (((a1[2][3] >= a0[12]) != (v0 % 2)) ? ((a1[2][1] / 6) && (4 > 93)) : ((94 == v0) - (84 < 31)));
+        v0 = (((v2 && v2) * (a1[2][7] > v0)) > ((v2 >= 74) <= (v1 - v2)));
+        v3 = (((v2 ? a1[0][10] : v1) - (a0[11] == v1)) + ((v2 < v0) != (v1 ? v0 : 70)));
+    } else {
+        v3 = (((v3 >= v3) != (v3 ? v1 : a0[2])) + ((a0[4] || v2) / 2));
+        v0 = (((v0 / 1) >= (25 != v3)) ? ((a1[2][4] > v1) < (a0[15] || v0)) : ((a0[11] ? v3 : v1) == (52 % 3)));
+        v1 = (((a0[9] < v2) + (14 >= 78)) * ((2 != v2) ? (72 >= a0[11]) : (40 ? 68 : v2)));
+    }
+    if ((((v2 != v1) * (a0[9] || 71)) <= ((v3 - a1[2][7]) && (a1[3][1] != v1)))) {
+        a0[0] = (((a1[2][12] <= v3) && (a1[0][4] * v3)) >= ((v2 != 94) > (a0[6] && v3)));
+        v0 = (((v2 ? v0 : 52) == (v3 / 1)) > ((v0 && a0[2]) ? (v1 ? v1 : v1) : (v0 - a1[3][7])));
+        v0 = (((v3 == 13) < (v2 < v2)) % 6);
+    } else {
+        v3 = (((a0[6] - v0) >= (61 * v0)) - ((a0[6] ? a1[2][4] : v0) < (v1 + 34)));
+        v2 = (((a1[3][2] > v1) >= (98 != a1[0][13])) ? ((v1 / 4) != (22 < a0[9])) : ((v0 <= v1) > (v1 % 1)));
+        v2 = (((v1 >= a1[3][7]) ? (v3 > v2) : (v2 != v2)) <= ((57 || v2) / 1));
+    }
+    a0[1] = (((16 / 9) < (a0[13] || 35)) >= ((48 || v0) < (81 * v0)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((64 ? v0 : 54) > 61) break;
+        v3 = (((a0[3] >= a0[6]) * (v2 ? 71 : v1)) + ((v2 == v0) ? (36 - 86) : (i0 < v0)));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                v1 = (((a1[3][11] ? v3 : a1[0][7]) > (86 ? v2 : v3)) + ((61 + v2) ? (v0 / 1) : (v1 + i0)));
+                v1 = (((v3 / 4) || (a0[8] ? v1 : a1[1][14])) && ((v1 != a0[1]) != (i1 != v1)));
+                v2 = (((v0 <= a1[0][0]) - (i0 + a1[3][1])) || ((a0[9] != i0) <= (i1 ? 47 : a1[0][15])));
+                i1 = i1 + 1;
+            }
+        }
+        a0[3] = (((i0 || a0[14]) >= (75 ? v3 : 44)) == ((v3 * v3) + (a1[1][11] > 42)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a0[6] ? v2 : 17) ? (v0 < v3) : (a1[0][11] ? a0[12] : v3)) || ((v0 < v3) && (v3 != a1[3][12])));
+            v3 = (((v1 > v0) && (v0 / 8)) / 1);
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    if ((i3 + i2) > 86) break;
+                    v3 = (((i2 ? v2 : a1[2][3]) >= (a0[0] <= 21)) > ((a1[1][11] <= 71) * (i3 - a1[3][13])));
+                    v2 = (((i3 || a1[2][3]) || (v3 + a1[1][13])) != ((v0 >= v0) != (v2 < 8)));
+                    a1[3][7] = (((v0 - 50) != (a0[4] - i2)) < ((34 + a0[5]) ? (i2 % 8) : (i2 % 6)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    return (((a0[13] && a0[11]) % 2) % 2);
+}
+int main() {
+    return 0;
+}
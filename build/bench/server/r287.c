@@ -0,0 +1,209 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 21;
+    int v2 = 64;
+    int v3 = 5;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 || a1[3][1]) > 78) break;
+            v3 = (((a1[0][12] - 7) / 7) % 7);
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v2 = (((a0[4] ? 18 : 75) != (a1[1][14] != i0)) + ((i0 > i1) ? (v3 == v1) : (v3 ? a1[1][9] : a1[0][11])));
+                    a1[2][14] = (((v1 != 83) / 9) - ((a1[2][4] && a1[0][14]) || (14 + v2)));
+                    a0[0] = (((53 / 9) / 5) != ((12 != 76) % 4));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((47 == a1[2][9]) >= (i0 > v1)) >= ((v1 < i0) != (13 && v1)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((v0 >= v1) / 6) - ((v1 < v1) - (a1[3][0] == a0[12])))) {
+        v0 = (((a1[1][0] > v2) * (63 ? 99 : v1)) * ((55 == v1) ? (a0[2] == v1) : (v0 <= v3)));
+        a0[10] = (((a0[12] * a1[1][8]) - (a0[4] ? v1 : a1[1][12])) ? ((v2 % 9) % 1) : ((27 > 98) <= (a0[3] / 1)));
+        v1 = (((a0[7] % 2) < (76 >= v1)) <= ((43 ? 54 : 24) % 3));
+    } else {
+        v3 = (((v2 * v1) > (v3 ? 6 : a0[15])) > ((a0[3] < v2) ? (72 || 88) : (v0 && a1[1][4])));
+        v1 = (((v2 != 66) > (v1 == v3)) < ((10 ? v0 : a1[1][10]) - (a1[0][3] && a1[1][2])));
+        v2 = (((v3 != v1) >= (a0[15] - v3)) + ((v3 * 3) * (10 * 10)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((i2 > a1[0][1]) > 75) break;
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    a0[10] = (((16 >= a1[2][5]) > (v0 ? i3 : a1[0][13])) % 2);
+                    v2 = (((a0[14] / 7) <= (v1 != 5)) != ((a1[1][8] % 9) % 7));
+                    a1[1][1] = (((a1[1][14] && i2) && (23 + 51)) * ((a1[1][8] / 3) + (i3 % 8)));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((i2 - v2) - (25 < v2)) - ((v1 || v3) != (a0[1] * 6)));
+            v1 = (((v3 ? a1[1][4] : v3) - (v2 < 54)) * ((v2 / 4) ? (v0 * a0[12]) : (v0 != a1[2][3])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            {
+                int i5 = 0;
+                do {
+                    a1[0][11] = (((64 <= i4) && (72 != a0[0])) != ((v2 ? 24 : a0[8]) + (a1[0][3] >= 15)));
+                    a1[3][12] = (((i4 % 4) - (v0 % 7)) > ((a1[3][11] * v2) >= (70 - i5)));
+                    v1 = (((85 - v3) >= (i5 != v1)) < ((a1[1][6] >= v0) || (i4 % 5)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            a0[8] = (((v0 / 6) <= (a0[8] + v3)) || ((47 > v0) && (a0[10] / 7)));
+            v0 = (((39 % 9) - (v2 >= v2)) ? ((a0[5] + v1) >= (v0 <= v0)) : ((v0 ? v0 : 19) ? (i4 - v3) : (a0[7] - a1[2][8])));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        a0[5] = (((98 != i6) ? (a1[2][14] / 3) : (v3 - v1)) + ((v3 <= a0[4]) < (52 <= a1[0][0])));
+        v2 = (((i6 - i6) <= (89 - a1[0][2])) > ((a0[1] / 9) != (a0[9] && 1)));
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            v1 = (((v3 ? a1[3][2] : v3) < (a0[5] - v3)) < ((v3 || 96) - (33 && i6)));
+            v0 = (((v1 && i7) - (v3 >= 93)) || ((i6 <= 48) <= (v2 || v1)));
+            a0[3] = (((66 ? 26 : 22) + (63 != i6)) || ((i7 * v2) ? (a0[8] / 8) : (20 >= a0[2])));
+        }
+    }
+    return (((v1 == 88) ? (a1[0][14] == a1[3][9]) : (v2 >= a0[10])) || ((v3 ? v2 : a0[15]) ? (a1[3][0] && 32) : (v1 >= v0)));
+}
+int f1() {
+    int v0 = 1;
+    int v1 = 80;
+    int v2 = 21;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    a0[12] = (((a0[13] % 1) != (v0 + v3)) % 1);
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v1 = (((v0 + i0) - (40 == a1[2][0])) / 4);
+                v3 = (((v2 || i1) / 1) >= ((23 == a0[5]) > (a0[9] ? v0 : a0[6])));
+                v2 = (((i0 >= v3) + (a1[2][15] || a0[12])) ? ((a1[3][14] + a0[6]) > (78 / 4)) : ((v1 ? a0[5] : 14) ? (57 ? v0 : i1) : (14 != i1)));
+            }
+            v0 = (((v1 % 2) && (v3 <= 85)) && ((a0[5] >= 98) - (v1 == v1)));
+            v3 = (((v2 + a1[0][6]) <= (v2 && 45)) * ((v0 < a0[9]) <= (v2 > a0[9])));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    a0[14] = (((v0 >= v3) == (v3 >= v0)) >= ((a0[7] + v2) % 3));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v2 = (((v1 >= v3) || (v2 && v1)) || ((i2 <= a0[5]) % 1));
+            {
+                int i3 = 0;
+                do {
+                    if ((v3 >= a1[0][0]) > 75) break;
+                    a0[10] = (((a0[12] - i3) < (v0 / 7)) && ((a0[14] && 87) && (a1[2][10] + v2)));
+                    v1 = (((11 <= v3) - (v2 / 2)) / 7);
+                    v0 = (((v0 / 3) ? (60 && i2) : (i2 + i2)) + ((v0 || i3) < (9 + i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v1 = (((i2 && 23) - (v1 % 6)) == ((a1[2][6] >= 83) ? (62 - a1[1][6]) : (a0[2] + 66)));
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((a0[5] > v0) % 6) + ((v0 / 9) != (v3 + a1[3][10])));
+    return (((a0[5] % 2) + (a1[3][0] || v3)) ? ((70 ? 89 : 95) < (v2 < 14)) : ((13 ? v3 : v2) / 2));
+}
+int f2() {
+    int v0 = 47;
+    int v1 = 65;
+    int v2 = 22;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[0][12] = (((i0 <= v1) <= (73 / 7)) - ((74 + v0) != (75 + v0)));
+            v0 = (((a1[1][10] % 4) > (i0 / 7)) - ((v3 * 11) * (v3 < 23)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v0 = (((v1 / 8) && (v3 - v2)) >= ((v3 % 2) * (v1 ? 16 : a1[3][7])));
+                    a1[0][12] = (((52 ? 54 : v0) == (v2 / 1)) > ((78 + v0) > (79 <= 29)));
+                    a1[2][13] = (((i0 && 8) / 1) <= ((86 <= 97) ? (v3 > i0) : (a1[1][1] == a1[2][15])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((i2 % 2) == (87 + 19)) - ((74 > 54) <= (v3 * 25)));
+            a0[11] = (((v1 > 89) > (v2 ? v0 : 43)) * ((v3 % 8) > (a1[1][1] ? i2 : v3)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((a0[0] >= a1[0][8]) > 86) break;
+                    v2 = (((v0 == v1) >= (a1[3][5] || 36)) && ((43 < v2) + (58 <= 21)));
+                    v2 = (((a0[8] - v2) || (a1[0][10] && v2)) || ((91 % 9) / 7));
+                    v1 = (((i3 < i3) == (v0 ? 70 : 70)) || ((i2 <= i3) || (33 <= v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v1 = (((71 >= a0[15]) && (i4 ? 25 : a0[12])) != ((v3 >= i5) > (v1 != 83)));
+                v1 = (((a0[10] / 5) % 8) == ((a1[2][2] != a0[12]) && (v2 + 93)));
+                v0 = (((a1[2][8] ? a1[0][3] : i5) <= (47 >= v2)) / 5);
+            }
+            v0 = (((a1[3][10] ? a0[4] : 20) % 3) > ((13 % 3) != (v0 + 57)));
+            a0[7] = (((4 * a0[14]) == (i4 != 12)) < ((v0 + a0[6]) ? (54 != 64) : (85 - v3)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            v2 = (((i6 < 74) > (a0[7] ? v3 : a1[3][12])) % 3);
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v3 = (((52 == v3) <= (v3 ? a1[1][8] : v3)) && ((i6 == i6) || (a1[2][4] + v2)));
+                a1[1][7] = (((56 - v1) && (a1[2][6] < 29)) ? ((25 || v2) ? (74 < v3) : (23 * a1[0][12])) : ((18 <= a0[12]) < (v3 || v3)));
+                v3 = (((v3 ? a0[10] : a0[7]) ? (v2 + 55) : (v3 / 5)) ? ((v3 / 4) != (v0 != a0[3])) : ((v3 >= v1) + (33 && v0)));
+            }
+            v2 = (((53 ? a1[1][8] : 15) && (a1[2][11] == v2)) == ((a1[3][4] ? v2 : 7) + (i6 >= 93)));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 7; i8 = i8 + 1) {
+        v3 = (((11 < a1[0][2]) ? (a0[10] != v3) : (v2 / 4)) == ((v2 ? v0 : 21) ? (64 == a0[9]) : (v1 <= a1[2][0])));
+        {
+            int i9 = 0;
+            while (i9 < 7) {
+                v2 = (((a1[0][7] % 1) >= (v0 || v3)) <= ((i9 ? v1 : v2) || (v2 ? a0[12] : v0)));
+                v2 = (((i9 / 8) <= (v0 - i9)) > ((a0[8] ? a1[3][5] : a0[14]) < (v3 ? i9 : i8)));
+                v0 = (((i8 >= i9) < (v3 ? a0[7] : i9)) ? ((v3 >= 58) >= (i8 + v2)) : ((i8 > 68) < (98 / 4)));
+                i9 = i9 + 1;
+            }
+        }
+        v1 = (((i8 <= a1[1][11]) <= (v3 > v3)) || ((86 >= v3) && (6 / 4)));
+    }
+    return (((v0 > v3) * (a0[4] == v2)) + ((v1 > v0) <= (21 <= v3)));
+}
+int main() {
+    return 0;
+}
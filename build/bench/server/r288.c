@@ -0,0 +1,45 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 4;
+    int v2 = 58;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v3 >= v3) * (75 / 8)) < ((a0[1] && a0[12]) <= (v3 || 48)));
+    if ((((v2 * v1) != (18 - a1[2][3])) - ((16 / 8) <= (a0[2] * 97)))) {
+        v0 = (((v2 ? 27 : v1) % 6) - ((v1 != 42) / 4));
+        v0 = (((v2 == 39) <= (v1 / 1)) ? ((a0[4] >= 93) ? (a0[6] ? 8 : v0) : (v3 && a1[3][4])) : ((a0[5] >= 54) ? (a0[0] / 8) : (v3 - 74)));
+        v2 = (((a0[7] / 8) && (42 ? v1 : v3)) ? ((a1[2][10] > v1) && (47 - a1[1][7])) : ((v0 % 3) < (v0 && 91)));
+    } else {
+        a0[10] = (((21 + v0) <= (69 >= 1)) - ((v3 && v1) && (v1 % 3)));
+        v2 = (((v3 > a0[15]) >= (43 * v0)) <= ((v3 > v2) >= (0 != a0[15])));
+        v0 = (((a1[2][5] / 4) != (a1[3][5] <= v0)) != ((v2 < 8) * (a0[10] ? a1[0][10] : v1)));
+    }
+    if ((((a1[1][5] % 7) != (a0[2] * 4)) / 3)) {
+        a1[3][14] = (((36 / 8) ? (v0 > v1) : (36 * v0)) ? ((a0[2] < v1) + (a1[2][3] * 44)) : ((a0[0] + a0[7]) < (v0 && 13)));
+        v0 = (((90 ? v1 : v1) % 4) && ((v2 != v3) != (a0[9] ? v2 : v1)));
+        a0[15] = (((a0[14] % 7) || (v2 <= a0[1])) * ((v3 - v0) % 2));
+    } else {
+        v3 = (((13 % 7) + (a0[15] ? 30 : v2)) > ((v3 * v3) <= (29 * v0)));
+        v1 = (((77 * v1) && (v0 != v3)) != ((v2 < a0[15]) % 4));
+        v1 = (((v3 >= a1[0][10]) * (v0 ? v0 : 33)) > ((19 == 81) * (a0[15] != 70)));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v0 = (((a0[13] + v2) + (0 || v0)) == ((v2 - 52) <= (v0 - v2)));
+        a1[2][3] = (((8 > a1[0][2]) < (v3 && v2)) >= ((i0 ? 26 : a0[6]) / 2));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v1 = (((v2 <= 73) + (v3 ? i1 : 56)) >= ((49 * a0[12]) || (40 - v1)));
+                v3 = (((i1 == v3) < (a0[15] || i0)) ? ((v0 >= v0) < (22 % 4)) : ((v0 || i0) > (v2 + a0[2])));
+                v3 = (((v0 || 76) / 6) ? ((i1 <= 25) == (a1[1][12] ? v1 : 10)) : ((a1[1][2] < v0) == (v2 && a0[1])));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    a1[2][4] = (((a0[4] ? a1[3][0] : v2) != (v0 > a0[7])) == ((v3 == 15) + (v2 * a1[3][8])));
+    return (((a0[5] + v3) <= (v1 <= v2)) >= ((v3 != 90) < (v0 == v2)));
+}
+int main() {
+    return 0;
+}
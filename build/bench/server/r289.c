@@ -0,0 +1,159 @@
+int f0() {
+    int v0 = 92;
+    int v1 = 25;
+    int v2 = 50;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((v3 ? a1[1][11] : v0) > 96) break;
+            v0 = (((a1[3][8] >= a1[2][2]) - (v0 / 2)) <= ((a1[3][7] > 92) ? (v1 > v1) : (a0[13] ? v3 : v0)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((63 * a1[1][12]) + (v2 + i1)) ? ((i0 < v0) ? (v3 <= i0) : (38 - v2)) : ((95 || v0) == (v0 != 76)));
+                    v2 = (((94 / 6) ? (83 ? a0[9] : v1) : (32 % 8)) ? ((v0 % 1) == (v0 % 8)) : ((47 || v3) + (a1[0][2] <= 74)));
+                    v0 = (((i0 - 89) != (87 % 7)) ? ((17 > i1) >= (v3 >= v0)) : ((a0[9] ? a1[2][4] : a1[3][0]) ? (a1[3][1] != 86) : (v0 != 45)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a0[15] || v3) || (v2 - v2)) / 8);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((87 - v0) ? (a1[1][0] < a0[2]) : (v3 - v1)) ? ((i2 + i2) >= (a1[3][9] * v2)) : ((v2 - 65) ? (75 * a0[7]) : (v2 || i2)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    if ((v1 / 3) > 62) break;
+                    a1[2][5] = (((24 + i3) >= (a1[3][7] >= v0)) * ((a1[2][15] == 53) >= (v2 / 3)));
+                    a1[3][1] = (((87 * i3) >= (v3 + v0)) != ((i3 - a1[2][12]) / 8));
+                    v1 = (((i2 ? a1[1][1] : 58) % 9) * ((a1[3][1] < 36) == (69 != v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((37 / 6) > (a0[3] >= a0[10])) && ((v1 - v2) ? (18 > a0[7]) : (v0 % 5)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((v0 != v2) || (30 ? a1[1][1] : v1)) + ((v2 / 6) >= (59 ? 14 : v1)))) {
+        v3 = (((a1[1][0] <= v0) % 6) < ((v3 != a0[9]) == (a0[0] + v0)));
+        v1 = (((v3 + v2) - (v2 % 8)) || ((v2 ? a1[1][12] : v3) <= (a0[12] % 6)));
+        v0 = (((a0[5] * a0[4]) || (v3 == v2)) == ((a1[3][9] < v1) ? (v0 > a0[13]) : (57 != v3)));
+    } else {
+        v2 = (((a0[9] * v0) == (65 && v3)) * ((a0[1] >= v2) == (39 * v3)));
+        v0 = (((73 * 4) ? (a1[0][14] <= a0[4]) : (v1 ? v3 : 96)) + ((v1 <= 90) < (v2 ? v3 : a0[13])));
+        v2 = (((8 % 9) != (v2 * v0)) - ((a1[3][7] < v2) ? (0 / 8) : (5 < a0[6])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((a1[2][9] / 1) > 73) break;
+            v2 = (((v0 % 1) ? (61 != a1[2][14]) : (a1[3][13] >= a0[15])) || ((v2 != a1[0][14]) + (0 && a1[1][14])));
+            a0[13] = (((v3 > a0[14]) != (v3 ? a1[1][6] : a1[2][6])) <= ((v1 ? 89 : v3) != (a1[0][10] >= 87)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    if ((i5 && a1[0][8]) > 96) break;
+                    v1 = (((34 + 80) && (a1[0][13] / 3)) || ((v0 * i5) + (v3 ? a0[3] : i4)));
+                    v1 = (((a0[3] * a0[9]) - (i5 <= a1[1][0])) / 1);
+                    v2 = (((v2 * i5) / 7) + ((76 ? a0[14] : a1[0][1]) >= (v3 && 48)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    v3 = (((a1[1][5] - a0[7]) / 1) == ((i6 != 36) ? (i6 < v3) : (i6 != a0[9])));
+                    v3 = (((v2 * v3) * (v3 - 52)) ? ((a1[3][7] % 2) != (i6 != 71)) : ((i7 - i7) * (v1 && a1[3][6])));
+                    v2 = (((v1 > 57) % 5) < ((54 != 19) || (i7 != v0)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((v2 / 5) % 1) * ((68 > v0) / 7));
+            v0 = (((a0[3] != i6) || (v1 - v3)) <= ((v3 * i6) == (a1[3][9] - 20)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v0 <= v0) ? (v2 || v1) : (a1[0][8] + v0)) + ((72 && 48) != (v3 / 4)));
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 9;
+    int v2 = 69;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][11] + v3) >= (v1 * v0)) - ((56 == v1) + (a0[5] <= v1)))) {
+        a1[0][0] = (((51 || v0) ? (70 - 51) : (v2 * a1[2][14])) < ((5 >= a0[6]) > (v0 || v0)));
+        a0[10] = (((v1 > a0[13]) ? (v3 ? v1 : 95) : (40 == v2)) < ((30 != v2) % 5));
+        v2 = (((a0[3] && a0[14]) % 6) != ((7 ? v0 : 52) ? (a0[6] < v2) : (a1[0][13] < a0[14])));
+    } else {
+        a0[10] = (((v3 <= a0[9]) >= (39 && 45)) - ((71 / 7) != (a1[1][15] < v0)));
+        a0[10] = (((v0 <= 26) - (v3 + a1[0][13])) <= ((10 <= v1) ? (a1[1][2] ? v3 : 41) : (v1 == a0[8])));
+        v2 = (((90 % 5) <= (a1[3][13] && v1)) < ((v0 * v2) < (30 < a0[3])));
+    }
+    if ((((v1 == v1) - (v2 != a1[1][0])) ? ((a0[10] != 56) || (22 / 5)) : ((v1 > v0) - (v2 || v0)))) {
+        a0[9] = (((69 ? v2 : v0) ? (72 ? v2 : a1[0][4]) : (13 || 69)) - ((a1[3][4] == a1[0][12]) / 5));
+        a1[2][11] = (((1 ? 71 : 28) % 5) % 6);
+        a1[0][14] = (((v2 + a1[1][8]) == (v3 && a0[7])) / 5);
+    } else {
+        v0 = (((v3 >= v0) || (46 == v0)) / 6);
+        v2 = (((a1[1][14] >= a1[2][10]) == (v0 - 43)) >= ((v3 - a0[6]) % 7));
+        a1[0][8] = (((v1 ? v0 : v2) || (v0 <= v3)) >= ((68 / 2) < (a0[10] - 74)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v1 = (((a1[0][7] != a0[0]) < (v1 && a1[3][13])) * ((a0[0] && a0[15]) * (a0[4] || 2)));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v2 = (((11 < a0[0]) + (a1[3][5] <= 8)) + ((79 <= a1[1][5]) % 3));
+            v1 = (((a0[5] != a0[5]) || (i1 > v2)) / 2);
+            v0 = (((v3 >= 40) >= (60 > 55)) % 7);
+        }
+        a0[4] = (((a1[3][15] <= v2) - (v1 == 59)) && ((v1 + a1[1][15]) == (2 <= a1[2][5])));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v3 = (((v0 ? v1 : a0[5]) * (a0[14] >= i3)) || ((i3 || v0) == (v1 * v2)));
+                a0[5] = (((27 < 79) - (42 == a1[0][11])) <= ((a1[2][13] && i3) || (v3 > 95)));
+                a0[10] = (((v0 > 1) > (v1 != i2)) - ((a0[11] - a1[0][5]) && (a0[0] != 42)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((v2 + v1) > (36 == v2)) || ((a1[2][0] < 34) * (50 || a0[0])));
+        v1 = (((v1 * 57) == (v1 != v2)) <= ((v3 == v2) ? (a1[3][6] ? a0[4] : v3) : (a0[7] ? 92 : 70)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[0][9] = (((96 || 25) || (36 + a0[9])) % 1);
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((a0[4] < 26) >= (a0[2] % 9)) ? ((i4 - v2) || (i5 + v1)) : ((v3 != a1[1][8]) ? (i5 || 26) : (80 >= v0)));
+                    v3 = (((i5 / 2) != (v2 / 5)) ? ((v2 >= v1) ? (v2 % 4) : (v2 >= 68)) : ((a0[14] == v3) ? (v0 + v1) : (97 / 6)));
+                    v1 = (((65 == 23) / 5) == ((v2 && i4) / 1));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v1 = (((i4 / 5) != (v3 + 15)) >= ((a1[1][6] ? a1[0][14] : v3) % 3));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((v2 * v0) + (v0 * a0[2])) * ((v2 + 4) + (58 - v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,183 @@
+int f0() {
+    int v0 = 97;
+    int v1 = 37;
+    int v2 = 17;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a0[11] = (((a1[3][1] <= a1[3][2]) + (2 || 14)) - ((a0[14] - v3) > (v1 * 25)));
+            v3 = (((a0[10] ? v1 : a0[0]) ? (a0[15] >= 34) : (v3 == a1[1][7])) <= ((v2 >= 12) / 8));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((i1 && 55) > 94) break;
+                a1[3][12] = (((66 <= v2) < (v1 < a1[3][6])) - ((47 <= a1[0][7]) != (81 || 71)));
+                v1 = (((v1 != i0) + (v2 / 1)) >= ((a1[2][3] == v2) < (2 && v3)));
+                a1[2][4] = (((6 / 3) >= (a1[1][5] <= v0)) || ((v1 >= v2) ? (v3 - 25) : (v1 + 20)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v2 = (((53 * a1[1][5]) % 6) + ((a1[1][9] && i3) <= (v0 % 6)));
+                a0[8] = (((v3 / 4) + (a1[0][4] != a0[15])) <= ((i3 / 3) && (v2 <= 17)));
+                v3 = (((a1[1][12] % 2) > (80 ? a0[8] : v3)) / 5);
+                i3 = i3 + 1;
+            }
+        }
+        a0[10] = (((v0 >= v0) == (12 || 69)) - ((a1[2][6] ? v2 : 63) - (i2 ? v1 : a0[12])));
+        v2 = (((86 != v3) != (a0[12] != v2)) == ((v3 - i2) ? (a1[3][13] ? v2 : 20) : (60 && v0)));
+    }
+    a1[1][0] = (((a1[0][1] || 68) % 4) > ((v0 == 98) ? (v2 >= v1) : (v1 < v0)));
+    {
+        int i4 = 0;
+        do {
+            if ((a1[2][7] + 76) > 91) break;
+            {
+                int i5 = 0;
+                do {
+                    if ((v0 ? 55 : i5) > 89) break;
+                    v3 = (((a0[1] / 8) + (a0[6] + i5)) - ((v1 >= v2) / 9));
+                    v1 = (((i4 == a0[15]) != (a0[0] ? v3 : 14)) + ((v3 + a0[0]) == (v1 || i4)));
+                    v2 = (((v3 || 2) < (a1[2][3] <= i5)) >= ((v0 + a1[0][15]) + (i5 ? v3 : v1)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v2 = (((v2 == 27) + (v2 * v3)) > ((v2 == 11) - (v1 || a0[11])));
+            v2 = (((v1 * v0) < (v3 == i4)) / 2);
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            if ((39 < v1) > 90) break;
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((a1[0][15] ? a0[7] : v3) > 67) break;
+                v0 = (((a1[2][9] || v3) < (72 / 1)) != ((55 + v2) + (v3 * 5)));
+                v1 = (((i6 - v3) ? (a0[3] < 69) : (v1 ? a0[12] : v2)) >= ((v0 && v3) - (v0 <= a1[2][10])));
+                a0[5] = (((a0[6] % 9) && (a1[0][4] ? i6 : a0[0])) ? ((v3 / 1) >= (35 || v2)) : ((v0 ? i6 : i6) + (i6 / 5)));
+            }
+            a1[0][9] = (((v0 ? a1[0][2] : v2) / 7) > ((v2 / 5) || (a1[1][15] <= v3)));
+            a0[11] = (((i6 % 8) >= (v3 && a1[2][1])) <= ((v0 ? a1[3][15] : i6) / 3));
+            i6 = i6 + 1;
+        }
+    }
+    return (((80 != v3) % 6) >= ((55 % 9) / 2));
+}
+int f1() {
+    int v0 = 52;
+    int v1 = 95;
+    int v2 = 82;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 ? v2 : a0[11]) < (a1[1][12] % 5)) ? ((a1[2][5] > 18) * (v2 || v2)) : ((a0[2] && v3) ? (33 != 24) : (v1 == v2)))) {
+        a1[2][8] = (((v3 - v0) > (v2 < v3)) ? ((v2 && v0) >= (a0[9] - v3)) : ((v2 > v2) || (34 - v3)));
+        a0[15] = (((a0[12] || v2) + (93 / 8)) || ((v3 ? v2 : v2) != (25 * v0)));
+        a1[0][5] = (((v2 / 7) * (7 == a1[3][11])) && ((a1[2][8] == a1[1][10]) * (v0 - a1[1][8])));
+    } else {
+        v0 = (((v2 == 68) - (v2 <= v3)) / 7);
+        v3 = (((92 ? v1 : a1[0][8]) == (v0 < a0[12])) && ((47 != v2) || (a0[12] ? v0 : v3)));
+        v0 = (((41 * a1[2][14]) != (v3 != v0)) ? ((a1[0][15] == a1[2][13]) > (23 - v1)) : ((v2 / 3) >= (98 / 2)));
+    }
+    if ((((a1[1][11] ? 42 : v0) ? (v1 ? a1[1][14] : v0) : (54 + a0[10])) * ((a0[8] > a1[1][11]) % 7))) {
+        a0[6] = (((v1 >= v0) > (v2 > v2)) >= ((a0[15] > v2) == (a0[15] && v1)));
+        v1 = (((a1[0][12] ? v1 : a1[2][11]) > (v0 % 7)) != ((v2 - v2) * (23 - 52)));
+        a0[5] = (((v3 >= v2) || (12 && v3)) <= ((a0[9] * a1[1][15]) ? (v3 >= v3) : (a0[0] || v1)));
+    } else {
+        v3 = (((v1 == v0) <= (v2 <= v0)) && ((a1[0][0] >= v3) * (v0 >= v2)));
+        a1[2][14] = (((v1 % 6) <= (v2 != a1[2][4])) >= ((v3 ? 64 : v2) >= (v0 < 90)));
+        v3 = (((v2 != 88) ? (38 <= v3) : (a0[6] >= a0[5])) == ((29 && a0[1]) && (6 ? a1[2][8] : 90)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v1 = (((i0 <= 46) > (73 * v0)) % 6);
+            v1 = (((a0[0] || i0) != (v1 < v1)) >= ((50 ? v3 : v2) ? (i0 >= v1) : (v1 ? a1[3][12] : a0[14])));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v0 = (((i1 % 8) ? (85 % 5) : (33 && i0)) + ((3 ? a0[9] : i0) >= (9 / 5)));
+                v2 = (((v2 >= 83) <= (v0 + 76)) ? ((i1 + i0) != (i0 == i0)) : ((v3 > a0[6]) * (v3 < a0[1])));
+                v1 = (((65 == 0) < (i1 >= a0[7])) && ((v3 == a0[4]) / 4));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((58 > v1) + (a1[2][12] < a0[9])) / 6);
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v1 || a0[14]) && (v1 * a1[0][13])) != ((v1 + 0) > (i2 ? 10 : a0[12])));
+            v3 = (((v0 && a1[3][8]) > (v3 < a1[1][5])) >= ((v2 < v0) - (a1[3][1] < v2)));
+            {
+                int i3 = 0;
+                do {
+                    a1[2][13] = (((i2 > v3) > (18 <= 42)) <= ((a0[9] / 1) <= (a1[0][14] < v3)));
+                    v0 = (((21 ? v0 : i3) && (v0 <= v3)) != ((v2 ? 16 : v1) + (i3 || 99)));
+                    v3 = (((v0 * v1) * (10 + 91)) - ((a0[5] < v1) ? (i2 > a0[15]) : (a0[7] < 65)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((64 + v0) / 3) > ((v2 * a1[3][0]) ? (v1 > 71) : (v0 < v3)));
+}
+int f2() {
+    int v0 = 87;
+    int v1 = 44;
+    int v2 = 54;
+    int v3 = 56;
+    int a0[16];
+    int a1[4][16];
+    if ((((57 ? a1[1][2] : a1[0][11]) != (a1[2][14] - v3)) || ((22 ? 61 : 5) || (a0[13] == 85)))) {
+        a1[0][8] = (((v0 <= 44) % 6) == ((98 % 1) <= (a1[2][13] / 8)));
+        v1 = (((4 > 11) / 7) * ((36 * 59) / 5));
+        v1 = (((a0[1] ? v1 : v1) / 5) <= ((a0[12] / 1) ? (91 < v2) : (a1[3][7] && 69)));
+    } else {
+        v3 = (((v0 % 8) && (v1 - v1)) > ((v0 || v1) <= (v0 != v2)));
+        v1 = (((50 && v2) >= (a1[0][0] ? a1[2][3] : v3)) * ((v2 % 1) > (a0[10] * v1)));
+        v3 = (((82 + a0[13]) && (v0 ? a0[3] : a0[7])) == ((v1 * a1[2][12]) != (81 ? 66 : v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((94 >= v1) > 58) break;
+            a0[5] = (((v3 / 4) - (v3 - v2)) != ((v0 * v3) ? (a0[4] < v0) : (v1 == v2)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a1[0][2] = (((67 * a0[14]) - (14 - i1)) < ((a0[10] >= i1) * (v2 <= i1)));
+                    v1 = (((a1[1][12] && v3) != (v3 && a0[7])) == ((i0 != v3) || (v1 != 45)));
+                    v2 = (((a1[1][9] > 66) >= (v3 / 6)) >= ((a1[2][9] % 3) ? (a0[11] ? v3 : v2) : (v0 <= a0[13])));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a0[2] <= a1[2][13]) * (i0 != a0[9])) - ((v1 <= v3) + (v3 == v0)));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v2 || 50) + (v1 ? v1 : v2)) * ((36 * v2) % 3));
+    v1 = (((v0 != a1[1][10]) >= (v0 * v2)) || ((v3 - 14) != (v3 - 43)));
+    if ((((v2 && v3) != (72 == a1[0][15])) ? ((v2 * 58) % 5) : ((80 / 4) > (v2 != v0)))) {
+        v1 = (((v0 || v1) >= (a0[10] ? a1[1][0] : v2)) == ((78 > v2) - (v1 - v0)));
+        v1 = (((v1 || 49) && (a0[3] / 7)) - ((v2 * 66) ? (a1[1][15] - a1[0][5]) : (a1[0][13] > v1)));
+        a0[11] = (((a1[2][13] == 36) / 5) + ((v2 / 7) >= (v3 != 3)));
+    } else {
+        v0 = (((v2 == v1) ? (a0[3] * v0) : (v3 > v2)) && ((v1 % 9) ? (a1[1][8] + a1[3][10]) : (v3 > v1)));
+        a1[3][10] = (((v1 != 61) / 4) && ((v0 - 80) && (61 / 3)));
+        v3 = (((v1 - a1[2][3]) + (v0 != a1[3][8])) != ((61 >= 5) && (83 && v2)));
+    }
+    return (((v0 <= 33) + (v0 % 3)) < ((3 < v2) + (39 <= 46)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,185 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 9;
+    int v2 = 37;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    a0[11] = (((v0 <= 2) + (11 || v0)) / 3);
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (((i0 % 2) % 3) >= ((a0[3] <= v3) || (v3 > v3)));
+        v3 = (((v1 / 2) != (85 != v3)) ? ((i0 && a0[5]) || (a1[2][0] ? v1 : 3)) : ((a1[2][4] > v3) <= (v1 ? v3 : 66)));
+        {
+            int i1 = 0;
+            do {
+                if ((a1[3][13] != a1[1][1]) > 89) break;
+                v2 = (((10 < 31) != (67 - a1[0][5])) >= ((36 ? v0 : v2) > (a0[1] != i1)));
+                v1 = (((a0[13] * i1) == (v1 || 19)) != ((v3 ? v1 : 73) == (i1 || v0)));
+                v0 = (((i0 + v1) ? (v3 % 5) : (94 || a1[1][6])) ? ((79 != v1) ? (v3 + 42) : (i0 > v0)) : ((v3 || 26) > (v1 * i0)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v2 = (((v0 < v2) ? (a1[0][8] > a1[3][0]) : (54 != a0[13])) / 7);
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((52 == v1) >= (i3 / 1)) != ((a0[1] == a1[3][8]) != (v2 && v0)));
+                    v1 = (((a0[4] - v1) || (72 % 9)) + ((89 ? 89 : a0[11]) * (42 ? a1[2][1] : v3)));
+                    a0[8] = (((a1[3][5] * v1) - (v3 >= i3)) || ((i3 != 89) == (v0 && i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v0 = (((9 * v3) ? (3 && 12) : (56 ? a1[2][9] : 19)) >= ((v1 == v3) % 1));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((v1 - v1) - (v2 ? v3 : v3)) < ((v3 != a0[5]) % 9));
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            v1 = (((v1 * a0[3]) ? (a0[9] ? v2 : v0) : (v3 || 7)) > ((v1 <= i4) + (71 / 1)));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v2 = (((85 == v0) * (i5 || v3)) >= ((91 < i4) == (a0[11] != i5)));
+                v0 = (((v1 * v3) % 1) + ((a0[14] / 6) <= (i5 * v3)));
+                v2 = (((52 >= a1[2][12]) == (v3 ? v3 : a0[3])) + ((93 % 7) >= (v1 != v3)));
+            }
+            v1 = (((85 != a1[0][5]) >= (i4 >= v3)) + ((i4 + v1) * (57 + a1[1][8])));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v1 == a0[2]) == (a1[3][15] || 0)) + ((v0 % 7) / 7));
+}
+int f1() {
+    int v0 = 50;
+    int v1 = 39;
+    int v2 = 78;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    a0[13] = (((a1[0][12] * a1[1][0]) ? (v0 > a1[2][13]) : (a1[2][10] ? a0[1] : v0)) < ((a1[1][5] < 78) > (v0 * 18)));
+    v2 = (((a1[1][3] == v3) <= (32 > v3)) ? ((a0[12] * 42) % 6) : ((88 || v1) ? (v3 ? a0[11] : 70) : (a0[2] || v2)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    a0[2] = (((a0[9] == a1[3][6]) + (16 >= 14)) * ((v2 ? a1[1][7] : a0[0]) == (88 % 9)));
+                    v2 = (((v0 * 16) / 5) != ((i0 > 69) + (v1 != a0[13])));
+                    a1[1][11] = (((i1 % 2) && (a0[14] || v1)) && ((69 + a0[9]) != (a1[0][9] || i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a1[2][4] = (((v1 < a1[1][3]) - (v0 % 3)) % 2);
+            v1 = (((v2 <= v2) % 1) % 1);
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v2 = (((a1[2][12] && i2) % 2) - ((v2 - v3) ? (v2 > v2) : (a0[13] / 6)));
+            a1[0][12] = (((a0[4] * 74) > (92 || a0[9])) / 1);
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((i3 < 69) > 79) break;
+                    v1 = (((i2 || a0[14]) || (v3 * a0[11])) / 9);
+                    v2 = (((i2 > v1) <= (a1[1][13] + 70)) ? ((a0[4] % 2) == (v3 ? v3 : 54)) : ((v3 * v3) - (v1 || i3)));
+                    v2 = (((v1 == v0) - (i2 < v1)) + ((v3 % 1) + (62 % 2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v2 = (((v3 % 2) % 3) || ((v3 ? 0 : 0) <= (v0 == a0[2])));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v0 = (((21 < a0[4]) / 4) <= ((a1[1][9] <= v0) / 5));
+            a0[7] = (((v1 % 7) ? (63 - a1[0][10]) : (a1[2][6] / 2)) ? ((a0[10] * 41) < (a1[2][15] ? a0[1] : v0)) : ((v0 + i4) % 7));
+            v3 = (((83 ? a0[7] : v1) != (v0 > v2)) && ((v2 > i5) ? (a1[3][3] % 9) : (i4 ? v1 : a0[9])));
+        }
+        v3 = (((57 < v3) || (v2 > a0[11])) && ((v1 <= v2) ? (28 && i4) : (v2 > a0[11])));
+    }
+    return (((v2 - v3) + (v0 ? a0[12] : v1)) > ((a0[10] > v1) && (78 < v2)));
+}
+int f2() {
+    int v0 = 7;
+    int v1 = 95;
+    int v2 = 57;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((i0 ? v3 : 7) > 63) break;
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((v0 && v3) > 59) break;
+                    a1[2][14] = (((a0[4] && 55) && (v3 - a1[0][10])) > ((v1 ? 35 : v1) % 2));
+                    v3 = (((a0[2] == 68) < (7 ? 40 : v3)) > ((i1 <= v2) || (v2 * 81)));
+                    v1 = (((13 - 44) + (v1 <= i1)) <= ((i1 == v0) <= (v2 > v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[10] = (((v3 + 8) < (i0 >= a0[5])) - ((69 <= a0[0]) > (v0 < v1)));
+            a1[3][4] = (((5 - i0) >= (a1[2][3] ? v0 : v1)) < ((v3 || a1[2][0]) != (a0[11] < 22)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((70 == v2) || (a1[3][10] % 2)) < ((10 / 3) ? (77 % 1) : (v2 * v0)))) {
+        a0[13] = (((a1[2][5] == v3) && (v0 > v1)) ? ((v1 / 1) % 3) : ((75 / 2) <= (v3 >= v0)));
+        a1[3][2] = (((a0[6] * v1) * (7 || v0)) ? ((v2 == a1[0][4]) != (v1 + v1)) : ((a1[1][13] || a1[3][14]) <= (a0[4] <= a0[2])));
+        a0[7] = (((83 * v0) >= (a0[0] || v0)) - ((v0 >= 83) <= (a0[3] <= v3)));
+    } else {
+        a0[14] = (((v1 >= 80) + (a1[1][0] > v3)) || ((v2 == v2) || (a0[14] * 97)));
+        v3 = (((82 ? 85 : v2) && (v0 - 71)) * ((v3 && 76) - (v3 / 8)));
+        a0[15] = (((v1 % 6) / 6) / 2);
+    }
+    if ((((v1 ? 53 : v1) < (40 ? a1[1][3] : v3)) * ((18 - v3) == (v2 != 63)))) {
+        v1 = (((v2 > 7) <= (v2 < v2)) == ((v3 ? v0 : v1) ? (v1 - v2) : (a0[15] - v3)));
+        v0 = (((81 || 10) * (2 != v0)) > ((v3 + v1) * (72 + v1)));
+        a1[1][10] = (((v0 ? v1 : 61) ? (v1 / 2) : (a0[15] ? 59 : v3)) - ((v1 ? v3 : a1[1][3]) != (v3 / 9)));
+    } else {
+        v3 = (((v3 + 26) * (v1 % 7)) || ((80 * v2) + (0 && 88)));
+        a0[8] = (((v2 <= v0) != (a0[13] && v2)) != ((v0 && 26) <= (v2 ? v1 : v1)));
+        v2 = (((73 ? v0 : 81) * (1 ? a0[12] : v2)) && ((v2 / 4) <= (27 / 1)));
+    }
+    if ((((89 != v3) / 3) == ((v3 * 8) ? (v3 < 86) : (v0 + v2)))) {
+        a1[2][12] = (((v3 >= v3) ? (v0 ? v2 : a0[9]) : (46 <= 14)) < ((v0 % 4) != (a1[0][10] != 65)));
+        a0[1] = (((a1[2][12] != a0[2]) * (v3 ? a0[1] : a1[3][7])) > ((v1 - v0) == (a1[0][14] != v1)));
+        v3 = (((35 && 90) || (v2 >= a0[13])) >= ((v3 <= a1[3][7]) >= (v3 ? a1[2][2] : v3)));
+    } else {
+        v2 = (((v3 >= 25) && (70 >= a1[3][12])) ? ((32 && 67) + (v1 >= a1[1][11])) : ((v0 < v1) == (69 == a0[6])));
+        v1 = (((v1 * 82) >= (a0[13] / 4)) - ((51 >= v3) - (0 == a1[0][7])));
+        v3 = (((v2 + 50) >= (v3 != v0)) / 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((i2 * 79) != (i2 > a1[2][3])) ? ((a1[1][8] < a0[1]) <= (v3 ? a1[3][8] : 64)) : ((a0[13] == a0[4]) % 2));
+            {
+                int i3 = 0;
+                do {
+                    a0[8] = (((87 * v1) && (a0[6] % 2)) + ((i2 % 3) == (63 > a0[5])));
+                    v0 = (((i3 < 53) % 4) <= ((89 / 6) >= (17 < 88)));
+                    v2 = (((a1[3][10] >= 64) < (i2 + i2)) / 5);
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v1 = (((26 < v0) || (94 < a0[10])) != ((i2 / 3) ? (v1 >= i2) : (8 < v0)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    return (((52 > v1) > (66 + v0)) <= ((a1[1][6] >= a1[1][1]) >= (a0[10] ? v2 : v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,84 @@
+int f0() {
+    int v0 = 88;
+    int v1 = 30;
+    int v2 = 46;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((i0 > v2) && (v0 || v0)) > ((v3 / 7) < (86 > a0[0])));
+            v3 = (((47 ? i0 : i0) == (v1 ? 3 : a0[6])) != ((a1[0][3] / 2) < (33 % 9)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((92 == 74) > 78) break;
+                    a0[13] = (((34 ? a0[0] : v3) ? (v0 ? a0[6] : a0[3]) : (i0 / 6)) == ((i1 || 13) <= (i1 < 65)));
+                    v3 = (((i0 ? a0[4] : v1) <= (v0 == v0)) || ((i1 >= v0) && (2 + v3)));
+                    v3 = (((a0[1] ? v3 : v0) ? (v0 == v0) : (40 ? v2 : a0[3])) == ((v0 * 46) == (18 != i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v0 = (((33 * a1[0][15]) > (v0 ? v1 : v3)) != ((a0[4] >= 79) / 8));
+            v2 = (((v3 != v0) % 5) + ((97 < a0[12]) ? (v3 > 2) : (a0[7] || v3)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((a0[8] ? v2 : 55) > 59) break;
+                    a0[2] = (((a0[10] % 4) >= (i2 * a0[3])) * ((8 - 79) % 2));
+                    v3 = (((28 + v1) >= (a1[2][2] && v0)) > ((a1[2][8] || v1) - (v0 - v1)));
+                    a1[0][6] = (((a0[5] + v1) + (v3 != 47)) || ((v2 < 24) - (v2 || a1[0][12])));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((83 > v1) - (a0[11] > a0[15])) < ((v0 ? 67 : a1[1][13]) / 2))) {
+        v0 = (((v2 == a0[5]) == (a1[1][13] < v0)) + ((v3 % 7) != (v2 ? a1[0][13] : v1)));
+        a1[0][4] = (((15 % 8) ? (a1[1][6] * a1[0][8]) : (a1[0][12] <= a0[5])) / 9);
+        v3 = (((v1 - v1) ? (93 / 7) : (v0 + a1[2][10])) && ((v0 < v1) - (20 > v1)));
+    } else {
+        v3 = (((7 % 8) || (v3 < v3)) >= ((a0[7] <= a0[13]) >= (v0 != v1)));
+        v3 = (((18 != v3) / 3) ? ((1 != 85) && (39 % 9)) : ((v3 != 26) ? (74 - v0) : (a0[14] + v1)));
+        v1 = (((v3 / 6) && (a1[0][11] >= v0)) * ((a0[1] || v3) / 6));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((70 / 6) > 62) break;
+            v0 = (((64 != 26) ? (v3 == v2) : (a1[3][15] + i4)) - ((v1 % 1) * (v3 == v2)));
+            v1 = (((78 % 8) - (v2 % 7)) + ((60 <= v0) <= (v3 ? a1[2][12] : v1)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((i5 < v3) % 5) >= ((v2 + i4) / 8));
+                    v0 = (((a1[3][15] * i4) / 8) && ((a0[1] / 6) < (a1[0][13] < 49)));
+                    v0 = (((i5 + v2) && (0 ? v3 : i4)) % 3);
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    if ((((a0[7] || 18) >= (a1[2][1] ? a0[6] : v0)) % 2)) {
+        v0 = (((v3 > v1) >= (a1[3][3] + v3)) == ((v0 >= v0) % 2));
+        v1 = (((v1 < v3) * (98 == a1[3][5])) && ((v3 % 6) % 8));
+        a0[10] = (((88 >= a0[13]) ? (a0[10] / 5) : (21 != 10)) * ((33 % 9) / 2));
+    } else {
+        v3 = (((v1 ? v1 : v0) <= (96 || 14)) - ((17 || a0[12]) != (36 && a1[1][2])));
+        v2 = (((v0 < 30) + (v1 != 79)) < ((v2 <= v1) <= (95 <= v1)));
+        a0[8] = (((v3 % 5) && (v1 % 2)) <= ((76 && a1[2][5]) && (a0[5] ? v2 : v2)));
+    }
+    return (((v3 * 46) < (v3 && v1)) - ((a1[2][8] * a0[1]) <= (a1[2][10] ? 89 : v1)));
+}
+int main() {
+    return 0;
+}
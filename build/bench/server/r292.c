@@ -0,0 +1,147 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 35;
+    int v2 = 85;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a1[3][5] + v2) / 9) != ((a1[3][5] && v0) < (a1[0][12] && a0[7])));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v0 * a0[14]) < (i1 + v2)) - ((62 != v3) - (v2 + a1[2][5])));
+                    v2 = (((a0[11] != i0) != (v1 * v1)) * ((i0 ? i1 : v2) <= (v2 <= i0)));
+                    v1 = (((a1[3][15] / 6) - (a1[0][4] ? a1[0][11] : v1)) == ((a1[1][6] && 91) < (v2 / 7)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v1 = (((69 * 42) == (v3 > 58)) - ((v0 >= 95) != (i0 / 7)));
+            a1[1][15] = (((a0[1] ? a1[3][4] : i0) < (i0 - a0[7])) % 9);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((8 && 8) - (a0[2] != v0)) <= ((v2 / 8) ? (42 == v3) : (a1[1][1] + 15)));
+            v0 = (((v0 ? i2 : v3) * (a1[2][13] <= v3)) ? ((v2 > v0) <= (a1[3][3] && v0)) : ((a1[2][10] ? v1 : v0) ? (v0 - i2) : (v0 >= v1)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v1 = (((36 * v2) + (27 % 4)) != ((82 / 6) <= (a1[2][15] ? i3 : v1)));
+                v2 = (((i2 != v0) ? (38 * 18) : (7 != a1[1][10])) ? ((95 - v2) - (v2 && a0[10])) : ((v0 % 4) == (i2 != v2)));
+                v0 = (((78 == 78) ? (v3 ? i3 : a1[3][1]) : (i3 + i2)) <= ((v0 * i2) == (98 % 3)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((i4 + 19) / 5) % 7);
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v1 = (((v0 <= v1) ? (39 > v3) : (16 / 3)) % 2);
+                v0 = (((v2 >= v1) || (a0[5] > v0)) < ((v3 / 5) + (v3 > v0)));
+                v3 = (((0 % 1) || (6 && 48)) == ((7 + a0[5]) % 4));
+            }
+            v0 = (((v1 || 48) >= (a0[13] / 7)) == ((v1 >= 2) > (i4 ? v0 : v0)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            if ((v2 - i6) > 92) break;
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    if ((a1[3][8] < 99) > 62) break;
+                    a0[10] = (((a0[9] / 6) || (a0[5] >= a1[1][0])) && ((i7 - v1) <= (v1 <= i7)));
+                    v3 = (((a1[1][8] >= 21) - (84 / 6)) - ((89 != i7) ? (i6 > v3) : (v0 < i7)));
+                    v2 = (((92 == 47) * (v1 < i6)) || ((a1[0][8] ? v2 : 75) - (a1[1][8] > 45)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((v3 ? v0 : v1) == (46 % 4)) * ((a1[1][13] ? a1[0][10] : a1[1][12]) > (25 % 4)));
+            v2 = (((a0[8] ? v0 : v1) != (43 - a0[5])) && ((34 > v2) - (a1[1][0] && v2)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v0 >= 62) != (20 ? 4 : v2)) > ((a1[2][11] / 1) - (32 * a0[6])));
+}
+int f1() {
+    int v0 = 2;
+    int v1 = 88;
+    int v2 = 76;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    a0[12] = (((73 && 88) - (72 || v2)) ? ((a0[14] % 3) + (a1[2][11] % 2)) : ((51 >= 10) ? (a1[1][6] <= v0) : (a1[3][5] <= 38)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[3][3] != v0) > 92) break;
+                    v0 = (((i1 || v0) >= (9 != 85)) == ((43 < a1[1][3]) ? (a0[12] < a0[13]) : (a0[2] && 72)));
+                    v3 = (((i1 != 37) >= (a0[10] * i1)) && ((a0[13] < a1[3][2]) + (a0[11] ? a0[11] : i0)));
+                    a1[0][2] = (((a0[14] - 12) - (v0 >= 39)) == ((v1 && a1[1][2]) % 9));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a0[8] = (((v2 % 4) != (v1 || a0[7])) > ((v2 * a0[4]) > (93 == 93)));
+            a0[11] = (((v2 && v2) < (v1 < v2)) < ((a1[2][2] - a1[2][11]) >= (71 - i0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[3][10] = (((v3 < 36) % 9) < ((a0[7] && v1) != (v2 ? v3 : a0[12])));
+            v2 = (((a0[7] * v0) <= (7 >= a1[0][5])) && ((v0 - a0[5]) ? (84 ? v0 : v0) : (v3 - v2)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((a1[2][15] > 96) + (v1 ? a1[2][2] : v2)) && ((v0 % 4) + (a1[1][7] && a1[1][14])));
+                    v3 = (((i2 % 2) - (i2 ? i2 : 21)) % 8);
+                    v3 = (((65 / 5) < (a0[2] <= a0[0])) >= ((16 % 1) * (3 != v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v2 = (((60 < v3) - (v0 >= a1[3][4])) - ((36 == 20) || (97 * 9)));
+            {
+                int i5 = 0;
+                do {
+                    if ((38 / 9) > 98) break;
+                    a1[2][3] = (((i4 / 6) - (77 >= a0[10])) == ((v0 % 1) == (v2 / 5)));
+                    v3 = (((a0[5] ? i5 : 12) ? (67 && v0) : (v3 % 9)) != ((v3 <= v2) * (i5 > a0[7])));
+                    v0 = (((a0[10] - a1[2][2]) + (v2 ? 17 : v1)) / 3);
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v1 = (((v1 / 3) == (v1 * a0[12])) * ((a1[2][15] == 96) == (18 < v1)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((30 ? a1[2][12] : a1[0][5]) ? (v2 + v1) : (v1 && v3)) > ((71 >= 44) >= (v3 && v1)))) {
+        v3 = (((v0 + v1) || (94 != a0[6])) * ((v1 >= a0[7]) && (v3 - v3)));
+        v2 = (((v2 != 42) <= (a1[0][13] && a1[0][9])) && ((v1 > a0[13]) * (v0 && 29)));
+        a0[14] = (((v2 || a0[8]) != (v0 >= 13)) || ((v2 >= v3) - (v3 % 6)));
+    } else {
+        a1[1][10] = (((74 ? v1 : v2) / 4) * ((v1 || v1) >= (v1 <= v2)));
+        a0[8] = (((a0[4] > 25) == (a1[1][3] ? v1 : 17)) > ((a1[3][1] != v0) % 9));
+        v3 = (((v2 || v1) > (v1 != 51)) < ((v1 >= a1[1][13]) && (a0[3] == v1)));
+    }
+    return (((v3 + 8) >= (v3 >= a1[3][4])) / 4);
+}
+int main() {
+    return 0;
+}
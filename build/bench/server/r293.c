@@ -0,0 +1,209 @@
+int f0() {
+    int v0 = 98;
+    int v1 = 13;
+    int v2 = 45;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v0 = (((v1 - 32) ? (a0[6] == v1) : (v1 == i1)) || ((v1 % 2) >= (v0 == 3)));
+                v3 = (((i0 <= 49) * (v1 - i0)) <= ((38 >= 83) + (a1[1][15] && 12)));
+                v2 = (((i1 == v0) == (v0 < a0[0])) <= ((i1 > a1[3][13]) > (v3 % 6)));
+            }
+            a0[8] = (((a0[1] ? v3 : v0) - (a1[0][7] && v3)) ? ((v3 ? v1 : v3) % 8) : ((v3 || i0) && (v2 == v1)));
+            v2 = (((v1 >= a0[13]) ? (v2 > a0[10]) : (a0[15] ? i0 : a0[12])) < ((89 % 4) % 1));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a1[0][3] && v3) && (70 && a0[11])) || ((a1[2][8] < 88) ? (i2 / 7) : (a0[15] % 8)));
+            v1 = (((v1 % 9) && (v3 - v3)) < ((a0[10] >= v3) != (a0[5] ? v1 : v2)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v3 = (((v0 && a1[0][1]) + (v1 > v3)) || ((v2 ? v3 : 58) + (v1 >= a1[3][15])));
+                a1[1][15] = (((6 != v3) > (59 || v0)) - ((a1[0][13] != v0) - (v1 && v1)));
+                v3 = (((v3 + v3) <= (15 == 71)) ? ((i2 ? i3 : a0[3]) < (26 * a0[0])) : ((a0[4] && 52) >= (v1 && i2)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((v0 < a0[15]) <= (v1 % 6)) - ((a1[0][5] == a1[2][15]) - (v3 && 56)))) {
+        v2 = (((v3 || 23) < (a0[14] >= v1)) ? ((91 != a1[2][14]) / 6) : ((v0 && v2) || (77 + 75)));
+        v3 = (((a1[0][2] == v3) + (a1[1][9] ? 63 : v2)) > ((v2 % 7) || (a1[1][0] * v3)));
+        v2 = (((a1[3][8] ? 68 : 12) <= (v3 == v1)) - ((a1[3][15] > v1) == (a1[2][14] && a0[4])));
+    } else {
+        v2 = (((a1[2][9] - v3) ? (98 + a0[4]) : (90 / 5)) - ((21 ? v2 : v3) && (64 || a1[2][15])));
+        v3 = (((v2 || a0[14]) != (13 % 1)) * ((v3 * v1) ? (83 && 39) : (v1 + 91)));
+        v2 = (((91 / 4) ? (a0[14] || a1[3][5]) : (5 >= 98)) * ((v0 >= a1[0][1]) % 6));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v0 = (((v2 % 2) - (v0 / 6)) < ((98 == v0) * (v0 % 6)));
+            {
+                int i5 = 0;
+                do {
+                    if ((i5 || a0[12]) > 83) break;
+                    v1 = (((a0[13] * v0) - (94 < 44)) <= ((a1[2][9] / 5) > (0 * 61)));
+                    v3 = (((39 + a0[13]) || (a0[7] - a1[3][6])) <= ((v0 + v1) ? (v2 <= i5) : (v3 <= a1[3][6])));
+                    v2 = (((v0 + v0) / 7) ? ((a1[2][0] < a0[11]) == (a1[2][2] != v1)) : ((v2 ? v1 : 95) - (a0[2] / 8)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v2 = (((a1[0][4] ? a0[10] : a1[2][10]) <= (v2 * 65)) <= ((a1[2][6] && v3) == (v1 == a1[2][3])));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        if ((v0 * a1[2][1]) > 70) break;
+        a0[8] = (((v1 / 3) < (v1 == v0)) < ((87 * 15) && (a1[2][0] != v3)));
+        {
+            int i7 = 0;
+            do {
+                a1[3][9] = (((a0[8] != i6) || (v1 <= v3)) % 7);
+                v1 = (((v1 % 6) + (i7 - v0)) - ((i6 == a0[0]) == (v2 / 4)));
+                a0[4] = (((v1 ? 38 : 8) || (v3 ? a1[2][0] : v3)) + ((40 + a1[2][14]) && (v0 <= a1[2][3])));
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        a0[0] = (((v2 ? a1[0][10] : a1[3][6]) % 3) ? ((2 / 2) > (61 != a1[2][11])) : ((a1[1][9] < v2) % 3));
+    }
+    return (((v1 ? v2 : a0[0]) == (a1[3][8] ? 62 : 19)) <= ((a0[0] ? 57 : v3) <= (v1 / 1)));
+}
+int f1() {
+    int v0 = 31;
+    int v1 = 67;
+    int v2 = 99;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v2 && v3) == (87 < v3)) ? ((a0[0] + 12) * (50 == a0[6])) : ((v3 && v1) != (92 == a0[11])));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v1 = (((v1 >= 14) != (a1[1][1] != i0)) > ((v1 > a1[1][5]) == (a0[6] > a1[3][4])));
+        a1[1][15] = (((v1 ? v1 : 47) - (62 % 2)) % 6);
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            if ((v2 < 91) > 81) break;
+            a0[5] = (((65 - v3) ? (v3 > a1[1][4]) : (30 >= v3)) * ((v3 / 1) ? (i1 - 42) : (a0[13] ? v1 : a1[3][8])));
+            v2 = (((a1[1][8] <= i1) && (v0 + i0)) * ((85 != 0) - (3 == v1)));
+            a1[2][2] = (((v3 < v2) ? (i1 * 76) : (i1 ? 40 : 82)) < ((v1 ? v1 : a0[13]) && (11 || a1[0][14])));
+        }
+    }
+    if ((((v3 * 53) != (v1 == a1[2][0])) / 9)) {
+        v2 = (((v0 ? v0 : a0[7]) || (v0 && a0[8])) / 7);
+        v1 = (((v0 ? v3 : a1[1][9]) / 1) < ((v2 && 6) / 1));
+        v1 = (((v1 ? v0 : v3) == (v3 * 67)) == ((12 != a1[1][12]) >= (v1 * v1)));
+    } else {
+        v3 = (((a1[1][3] < a1[3][0]) != (v3 / 7)) % 4);
+        v3 = (((3 < v1) >= (a1[3][1] == v3)) * ((v1 <= 19) / 1));
+        v3 = (((a1[3][7] - a1[1][12]) + (32 && 93)) || ((a1[0][8] || v1) > (72 - 29)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((v3 % 9) < (v3 / 1)) <= ((a1[3][2] - v3) * (v0 - v2)));
+                    v1 = (((a0[14] * a0[5]) != (i3 >= a1[2][5])) / 9);
+                    a0[5] = (((a0[2] * v0) < (v3 && a1[0][13])) || ((13 / 8) <= (i3 / 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v0 = (((v2 >= a1[0][12]) / 2) && ((a1[2][9] || 62) - (a0[14] <= v1)));
+            v0 = (((a0[0] - v0) % 9) || ((a0[5] == a1[1][15]) && (i2 / 5)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v0 = (((i4 == v3) + (v3 + a0[13])) >= ((a0[4] / 6) < (v2 + i4)));
+                    v1 = (((a0[8] * 61) * (v2 - a1[2][14])) && ((a1[3][4] * v0) + (v3 <= v1)));
+                    a0[15] = (((a0[15] < i5) && (i4 < i4)) && ((32 < 65) || (v1 + v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[2][13] = (((a1[2][15] || v0) == (a1[2][3] <= v3)) >= ((v1 / 8) != (v0 / 2)));
+            v1 = (((i4 < 63) >= (v2 || a0[4])) && ((v0 * a0[5]) * (v0 > v2)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((54 == v0) > (91 + 10)) || ((a0[15] == v1) ? (v1 / 3) : (v3 / 9)));
+}
+int f2() {
+    int v0 = 65;
+    int v1 = 90;
+    int v2 = 17;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((97 / 1) * (72 ? a1[1][11] : a0[15])) / 4);
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((a0[13] <= v3) - (a1[1][7] - a1[3][3])) != ((a0[15] >= v3) == (6 <= 17)));
+                a0[9] = (((v0 || a1[1][6]) < (v2 || 76)) <= ((a0[8] < a0[15]) / 4));
+                v3 = (((v3 ? 64 : a0[12]) >= (v2 && v0)) + ((a1[1][11] == a0[3]) - (70 * v1)));
+            }
+            v0 = (((71 ? v3 : 69) <= (23 == v1)) % 4);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v0 = (((v3 >= v1) - (v2 + a1[1][3])) || ((v0 % 8) % 4));
+        a1[3][0] = (((a0[15] && 85) > (a0[9] ? 49 : v3)) > ((a0[8] % 6) > (a0[9] ? a0[11] : 95)));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                a0[11] = (((v3 % 8) ? (v0 - 91) : (62 + 97)) - ((v2 ? i2 : i3) % 4));
+                a1[1][10] = (((v3 + v0) % 7) == ((v1 <= 67) - (v3 % 6)));
+                a0[3] = (((a0[2] / 5) < (v0 >= v1)) ? ((i3 - v2) && (v2 || v2)) : ((v2 + 34) ? (71 > 89) : (v2 / 3)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a0[8] = (((v0 ? v1 : v2) && (a1[2][14] < v3)) - ((60 > v1) <= (76 + a1[2][8])));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            if ((a0[4] / 4) > 61) break;
+            v0 = (((a1[2][0] && v1) - (v1 || a1[2][5])) ? ((v0 >= 12) / 2) : ((a0[9] ? v3 : i5) ? (i4 * a1[2][1]) : (a0[11] < v1)));
+            v3 = (((a0[9] >= a0[6]) / 1) <= ((i4 || a1[2][7]) < (a1[0][1] ? 57 : 81)));
+            a0[10] = (((86 ? a0[6] : v3) ? (i5 == v1) : (v0 == a0[1])) ? ((v3 / 5) >= (28 && 33)) : ((v1 == 8) >= (16 > a0[3])));
+        }
+        v1 = (((a1[2][9] ? v2 : a1[3][3]) >= (a0[10] % 6)) * ((v1 != v2) ? (v0 + a1[2][5]) : (41 <= a0[13])));
+    }
+    if ((((v1 ? 19 : 59) ? (a0[7] / 8) : (v0 || v3)) == ((v0 && 23) || (v0 ? 1 : v0)))) {
+        v1 = (((v0 == 7) < (47 / 1)) == ((89 || 58) - (v3 < v0)));
+        a0[4] = (((a1[1][4] && 80) && (18 ? v3 : v0)) % 7);
+        v0 = (((v0 % 8) * (v1 - a1[0][5])) * ((v1 || v3) && (v2 || 36)));
+    } else {
+        v0 = (((v2 && 96) ? (v3 >= a1[2][11]) : (v3 > v0)) + ((v1 == 65) == (v3 ? 58 : 46)));
+        v3 = (((v1 ? a0[11] : v0) >= (v0 != a0[3])) <= ((22 ? 78 : v1) ? (v1 || a1[3][12]) : (9 || a1[0][8])));
+        v2 = (((a1[2][7] / 4) * (a0[14] <= 54)) + ((v2 < a0[5]) != (v3 && v2)));
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        v0 = (((v1 && i6) && (i6 != a1[3][9])) > ((v2 <= a0[15]) - (v2 * i6)));
+        {
+            int i7 = 0;
+            while (i7 < 3) {
+                a1[3][7] = (((v1 < v0) + (a1[3][6] / 3)) / 1);
+                v3 = (((92 ? 35 : 28) / 2) * ((v1 == a0[15]) * (81 && a1[1][3])));
+                a1[1][1] = (((37 % 5) / 5) % 9);
+                i7 = i7 + 1;
+            }
+        }
+        v3 = (((35 > v2) / 4) && ((i6 == a0[13]) * (a0[8] <= a1[3][11])));
+    }
+    return (((a1[3][7] <= v1) != (v2 - v0)) ? ((95 < v1) || (v3 / 8)) : ((a0[8] == a0[4]) <= (v3 ? 83 : v0)));
+}
+int main() {
+    return 0;
+}
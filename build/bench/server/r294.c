@@ -0,0 +1,79 @@
+int f0() {
+    int v0 = 24;
+    int v1 = 95;
+    int v2 = 27;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v0 >= v1) > 64) break;
+            v3 = (((v3 % 2) % 5) >= ((14 + v3) ? (a1[3][8] ? 59 : v1) : (91 >= a1[2][8])));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v1 = (((a0[7] != 78) ? (i0 <= 86) : (15 <= a1[1][2])) ? ((v1 || 92) != (35 * v2)) : ((i1 + 51) && (i0 <= 10)));
+                    v0 = (((57 || 31) > (i1 / 5)) % 8);
+                    v2 = (((a0[0] - v1) && (v0 || a1[1][12])) * ((i0 && v0) || (a1[3][4] ? i1 : a1[2][1])));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v0 / 8) != (a1[2][14] / 3)) / 7);
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v3 = (((i2 > a1[3][1]) < (a0[7] && i2)) % 5);
+            v3 = (((47 <= i2) ? (a1[0][0] ? v2 : 41) : (a1[1][3] == i2)) != ((v1 % 4) / 3));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    a1[2][14] = (((v3 - 80) * (i2 <= v0)) <= ((a1[3][7] ? i3 : a0[0]) * (a0[8] + v1)));
+                    v3 = (((v0 > 40) && (i3 % 9)) ? ((v3 > v2) % 3) : ((i3 <= 92) + (34 % 2)));
+                    a1[2][14] = (((28 <= 78) - (v3 >= v1)) != ((i2 / 7) < (i2 / 5)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            {
+                int i5 = 0;
+                do {
+                    a0[9] = (((94 ? v2 : v2) && (79 > 69)) % 7);
+                    v2 = (((v1 != 24) || (a0[8] || v2)) <= ((a0[1] / 6) / 9));
+                    a1[3][8] = (((a0[11] && i5) ? (v2 ? a1[0][12] : a0[6]) : (v1 <= i5)) >= ((a0[7] ? i4 : v1) && (i5 >= a1[0][9])));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v1 = (((i4 >= a1[3][10]) > (77 == v1)) != ((i4 >= 67) ? (6 < a1[2][2]) : (v0 || 18)));
+            v1 = (((i4 < a0[8]) >= (v1 ? a0[1] : 65)) % 2);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v0 * v0) > 97) break;
+            v1 = (((a0[15] - a0[5]) <= (v3 + 98)) >= ((v1 != v1) ? (v1 == 92) : (a1[3][13] > 46)));
+            a1[1][15] = (((a1[2][7] + a1[1][1]) <= (i6 ? 84 : i6)) != ((24 * 78) == (74 ? v2 : v0)));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v2 = (((v2 ? a0[4] : a1[2][6]) * (a0[3] < i7)) < ((i6 < i6) * (a1[2][15] > i7)));
+                a0[9] = (((v2 ? a1[3][7] : 81) > (30 * v3)) % 9);
+                v0 = (((i6 != 27) != (2 % 7)) && ((i6 && 5) == (60 - a0[8])));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    v0 = (((v1 / 9) + (2 < v0)) - ((v3 + v3) == (14 != 22)));
+    return (((a0[14] != v0) < (21 / 4)) >= ((80 > v1) >= (v2 - v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,124 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 63;
+    int v2 = 76;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    a1[0][13] = (((a1[3][9] < v2) != (v3 % 6)) + ((a0[9] > 25) || (v3 || 91)));
+    a1[2][12] = (((v3 >= 48) <= (a1[2][7] % 5)) / 3);
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    a0[7] = (((v3 > i0) - (90 + a0[1])) != ((78 * 66) > (a1[0][15] - i1)));
+                    v3 = (((41 == v0) && (61 ? 0 : 47)) < ((v1 * 55) <= (10 && 67)));
+                    a1[2][15] = (((7 != v2) > (3 ? 63 : 46)) < ((i0 - a0[10]) ? (a0[6] ? a1[1][9] : a1[2][0]) : (v3 <= a1[2][5])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v2 = (((a1[3][0] ? a1[0][5] : 73) ? (a0[6] <= a0[10]) : (v2 >= v3)) ? ((i0 ? v1 : a1[2][4]) / 9) : ((38 * v0) - (i0 && 29)));
+            v2 = (((v1 || a0[11]) <= (a1[1][5] < v0)) >= ((v0 || 43) > (v3 ? i0 : a1[0][8])));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v1 = (((i3 && v0) != (37 - a1[1][6])) ? ((77 * v1) ? (v3 ? a1[2][14] : i2) : (34 + v1)) : ((v2 == v0) && (a1[0][10] / 2)));
+                    v1 = (((i3 || i3) || (47 >= i2)) && ((v3 <= v3) != (v3 ? 41 : v0)));
+                    v1 = (((21 < i2) / 7) >= ((a0[0] ? a1[0][0] : a0[14]) == (11 / 1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((39 <= 9) <= (v2 != v3)) <= ((26 > 69) == (40 < v3)));
+            v0 = (((26 || a1[3][3]) > (v1 + v1)) >= ((a1[3][2] % 9) + (v3 > a1[0][7])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((v2 <= v0) ? (i4 / 4) : (i4 >= v1)) ? ((v2 * v0) == (v2 != i4)) : ((6 % 1) <= (v3 - v1)));
+            v3 = (((a0[13] + i4) / 5) == ((v3 == a1[1][3]) >= (v2 > a1[1][13])));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v0 != i5) ? (v2 * a1[2][6]) : (v2 && i4)) < ((a0[6] <= i4) % 6));
+                    v3 = (((i4 < i4) - (57 || a0[15])) || ((91 <= 8) && (v3 % 2)));
+                    a1[3][10] = (((v0 % 3) - (a1[1][6] && a1[3][6])) >= ((a0[0] >= i5) / 2));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((a1[1][2] <= 40) == (a0[15] <= v1)) - ((a0[4] ? v3 : 71) || (33 >= v3)));
+}
+int f1() {
+    int v0 = 27;
+    int v1 = 38;
+    int v2 = 85;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((53 / 7) <= (a1[0][8] < a0[4])) != ((83 / 9) / 3));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    a0[14] = (((a0[9] > 92) < (73 >= v2)) * ((86 != i1) / 7));
+                    a0[15] = (((i1 == 82) != (v1 - a0[2])) / 6);
+                    a0[4] = (((i1 != 42) != (v3 && a1[0][3])) * ((v1 - 61) <= (81 + v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a0[15] = (((a1[2][8] == a0[5]) / 4) == ((v0 == a1[3][8]) || (v1 % 8)));
+            a1[2][0] = (((v0 > i0) <= (v2 / 3)) >= ((v1 || a0[8]) + (v1 && a1[1][11])));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v0 = (((v1 / 6) >= (a0[9] < a0[12])) * ((85 < v0) != (a1[3][14] % 9)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a0[9] = (((v0 != 71) < (v1 > v2)) != ((i2 - 41) % 5));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v2 = (((v0 && 29) > (i2 >= i3)) ? ((76 > 46) + (a1[3][8] * v2)) : ((v0 ? v0 : 10) - (v1 || a1[3][12])));
+                v0 = (((46 + 64) % 8) >= ((a0[9] <= a1[0][4]) * (a0[10] < a0[11])));
+                v2 = (((69 * v3) + (a1[1][12] ? 23 : i3)) != ((v0 != v2) || (i3 == i3)));
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((33 > 5) + (a0[5] ? v2 : 92)) ? ((v0 || 99) - (a0[13] * 18)) : ((i2 < v3) < (a0[3] % 7)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            a0[10] = (((i4 + v3) || (a0[5] ? 54 : a1[3][8])) < ((v1 == v1) ? (94 < v1) : (i4 <= i4)));
+            {
+                int i5 = 0;
+                do {
+                    if ((72 <= v0) > 66) break;
+                    v2 = (((v2 <= v2) + (a1[0][8] ? a1[1][13] : a1[0][14])) >= ((v0 % 3) < (v1 != v1)));
+                    v1 = (((v1 ? v3 : v2) && (i4 - a0[15])) % 7);
+                    v0 = (((0 * v2) / 5) * ((22 < 93) == (22 || i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v2 = (((a1[0][9] && a0[11]) + (v1 / 1)) ? ((v2 != v0) || (v2 * 9)) : ((80 / 9) == (v3 > 59)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v1 / 4) >= (v0 ? 20 : v2)) && ((a1[0][10] - v3) != (v3 > v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,181 @@
+int f0() {
+    int v0 = 66;
+    int v1 = 64;
+    int v2 = 38;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((a1[0][13] ? a0[15] : a0[11]) > 58) break;
+            v3 = (((a0[12] % 6) - (v3 / 2)) >= ((a1[3][8] <= v0) >= (a1[1][5] < a1[1][4])));
+            a1[1][4] = (((a1[3][4] % 4) || (i0 && i0)) + ((17 && v1) != (v1 && a1[3][8])));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[15] = (((v0 + i0) == (v0 - v3)) != ((41 ? v2 : i1) >= (v3 - i0)));
+                v0 = (((a0[9] ? i1 : a1[2][1]) + (a1[2][15] * a1[2][12])) >= ((92 && 92) != (77 < 56)));
+                v0 = (((v1 ? i0 : v3) ? (60 > v3) : (a0[9] <= a0[10])) <= ((a0[14] >= 29) || (v3 - v0)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v1 < 48) ? (a0[6] && v0) : (v3 && v1)) == ((22 + 65) <= (7 - v0)));
+            v2 = (((v1 <= v2) == (v3 % 4)) || ((a0[12] / 9) % 5));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((0 != i3) <= (v1 || 65)) + ((v1 ? a1[0][2] : a1[0][14]) || (v2 && a0[8])));
+                    v1 = (((v2 == 65) * (61 < v2)) > ((86 >= 91) + (v0 + 61)));
+                    v1 = (((v0 % 4) * (a1[1][12] % 8)) + ((v2 == v0) < (a1[0][3] >= v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((a0[10] + a1[2][2]) > 69) break;
+        a0[3] = (((a1[1][8] + 63) > (21 >= v2)) % 2);
+        v2 = (((v2 ? v3 : 29) - (v2 == 16)) < ((92 ? v1 : a1[0][4]) + (a1[0][9] || i4)));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            a1[1][6] = (((a1[1][1] && 37) != (i5 > 37)) + ((a0[7] - 1) * (v2 / 6)));
+            v1 = (((v1 / 3) ? (61 - 44) : (i5 >= v0)) % 8);
+            v1 = (((70 ? a0[4] : a1[2][1]) == (66 >= i5)) + ((v2 ? v2 : a1[2][7]) % 1));
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        a1[0][2] = (((11 + a1[0][11]) ? (a1[2][1] || 21) : (v0 < v2)) ? ((a1[1][8] < 73) > (28 && 1)) : ((a1[3][2] != 60) || (i6 + a1[1][0])));
+        v3 = (((70 != v2) * (91 - v2)) ? ((v2 && v0) % 5) : ((a0[1] <= 65) * (a1[2][15] == 1)));
+        {
+            int i7 = 0;
+            while (i7 < 8) {
+                if ((i7 && i6) > 84) break;
+                a1[3][12] = (((v1 && a0[0]) != (97 ? v0 : a1[3][4])) > ((v2 - 14) - (i7 <= a0[14])));
+                a1[1][10] = (((a0[9] / 8) > (i6 || v1)) / 2);
+                v3 = (((v3 > 45) / 1) != ((51 > v2) >= (40 ? v2 : i6)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    v2 = (((v3 + a0[2]) % 8) || ((50 / 3) < (a0[0] ? 88 : v3)));
+    return (((v3 ? v1 : a0[11]) < (8 % 8)) >= ((a1[2][1] || v1) <= (v1 + v2)));
+}
+int f1() {
+    int v0 = 12;
+    int v1 = 66;
+    int v2 = 80;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((a1[1][12] == v1) < (a0[12] ? 45 : a0[14])) / 5);
+            v1 = (((v2 || v2) < (a1[2][13] ? v3 : 57)) || ((a0[0] <= 56) / 8));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((98 != v3) / 5) * ((v3 / 6) < (v1 == 87)));
+                    v3 = (((83 * 69) && (9 - 70)) < ((v0 >= a1[0][3]) >= (a0[8] <= i1)));
+                    v0 = (((a0[14] / 1) * (a0[6] / 4)) == ((a1[2][5] && v3) * (i0 / 1)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((85 < 84) > 53) break;
+        {
+            int i3 = 0;
+            do {
+                v2 = (((25 >= a1[1][5]) / 5) != ((v1 / 9) / 5));
+                v3 = (((a0[3] < 34) ? (i2 * a1[3][10]) : (i3 % 7)) * ((i2 == 25) / 5));
+                a0[11] = (((v2 >= i2) >= (v3 % 8)) / 7);
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        a1[0][6] = (((a1[0][11] + v1) / 8) == ((v2 && v3) < (v1 ? 8 : 5)));
+        v2 = (((v3 - 77) || (13 - 48)) / 8);
+    }
+    if ((((v0 && v0) * (93 != v1)) <= ((v2 == v3) / 5))) {
+        v0 = (((51 < 21) + (a0[6] ? a1[0][10] : v3)) % 4);
+        v0 = (((v1 == a1[0][0]) ? (73 == 55) : (a0[15] != v3)) != ((a0[4] <= v3) && (v3 <= a1[3][7])));
+        v0 = (((a0[0] == 37) || (v1 * 63)) < ((v2 + v1) % 5));
+    } else {
+        v0 = (((v0 >= v2) + (a1[3][8] >= a1[2][4])) == ((81 <= v0) > (v3 % 8)));
+        a0[12] = (((52 * v2) > (91 < v1)) <= ((v0 >= 79) || (66 * 12)));
+        v3 = (((v2 + v2) > (v0 / 9)) <= ((v0 || 83) == (v0 == 31)));
+    }
+    if ((((a1[1][13] != v2) - (v0 < v3)) + ((v0 ? 36 : a0[15]) >= (v1 == v0)))) {
+        v1 = (((v3 || a1[0][13]) + (56 && a0[1])) && ((32 - v1) ? (v3 - a1[0][2]) : (v1 ? v3 : v3)));
+        a1[2][0] = (((a1[0][0] <= v0) < (v0 > v1)) == ((v0 ? v3 : a0[3]) + (83 || a1[0][10])));
+        v1 = (((v2 % 8) > (46 % 6)) / 4);
+    } else {
+        v2 = (((8 != 24) - (v3 <= v2)) < ((v3 ? 25 : a1[2][13]) < (a0[6] + 87)));
+        v1 = (((v3 ? v0 : 28) <= (35 ? a1[2][2] : v3)) ? ((a1[3][4] != a0[2]) != (v3 / 2)) : ((a1[1][3] ? 18 : a0[9]) == (v2 >= v1)));
+        v1 = (((a0[1] != v2) != (v2 == a0[14])) < ((a1[0][0] ? v0 : v2) + (v0 && 71)));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v2 = (((32 - v3) < (i5 * 49)) || ((v2 == a0[4]) && (i4 != a1[0][8])));
+            v0 = (((24 || i4) && (i4 ? v0 : a1[1][15])) <= ((v3 * a0[11]) / 5));
+            a0[14] = (((i4 < a0[10]) > (a1[1][13] - v1)) * ((i5 % 2) % 1));
+        }
+        a0[15] = (((a1[1][15] && 85) == (a1[0][2] <= a1[1][2])) >= ((v3 ? i4 : v2) / 8));
+        v3 = (((v1 ? 66 : a0[8]) != (v2 * 3)) <= ((a0[5] < v2) && (a0[6] % 9)));
+    }
+    return (((a0[13] ? 32 : a1[2][7]) != (a1[3][12] <= a0[5])) ? ((v0 - a0[4]) ? (45 % 5) : (v0 > a0[4])) : ((a0[1] * v1) && (86 / 9)));
+}
+int f2() {
+    int v0 = 47;
+    int v1 = 16;
+    int v2 = 95;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 > v1) * (v2 + v1)) <= ((a0[2] <= a1[3][12]) >= (v0 && 61)))) {
+        v3 = (((v0 != v2) <= (v0 - v1)) / 8);
+        v2 = (((23 != v2) >= (v1 / 6)) % 8);
+        a0[14] = (((a0[12] / 5) > (49 == v0)) >= ((v2 + v1) / 2));
+    } else {
+        v2 = (((30 && v3) == (v3 ? v3 : v3)) * ((v2 != v0) * (v3 == a1[0][2])));
+        v2 = (((28 ? 27 : v1) < (a0[8] + v1)) ? ((v0 % 6) >= (a0[4] ? 44 : 5)) : ((v3 && 6) / 6));
+        a1[0][2] = (((v0 >= 2) + (v3 > a1[2][2])) < ((v3 == v0) ? (77 % 9) : (v0 ? v3 : a1[1][7])));
+    }
+    v0 = (((a0[11] == 42) || (74 == a1[3][11])) || ((v3 && 36) >= (v3 != 87)));
+    if ((((a0[4] != a0[13]) - (v2 || v0)) <= ((v0 + 35) * (v1 % 9)))) {
+        v3 = (((a1[1][0] || v0) != (a0[15] - 54)) >= ((34 % 5) >= (v3 / 3)));
+        v3 = (((34 / 2) % 3) <= ((v3 / 3) <= (v0 + 11)));
+        v0 = (((v0 ? v3 : 25) * (v3 >= 6)) >= ((v1 == a0[3]) * (96 % 3)));
+    } else {
+        v2 = (((v1 > a0[2]) > (v3 || a0[15])) <= ((v2 || v0) + (v1 != 16)));
+        a1[3][14] = (((a0[0] ? a0[3] : v0) < (v2 < a1[1][11])) / 4);
+        v3 = (((v1 - a1[0][6]) / 4) * ((78 || v0) && (v0 % 6)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[3][6] = (((3 - a0[3]) != (v0 <= 40)) != ((i0 / 9) * (i0 <= v2)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v1 != v2) && (a0[7] ? i0 : a0[14])) > ((v1 <= v1) + (81 >= a0[6])));
+                    v0 = (((40 / 1) ? (v2 / 4) : (38 && v2)) / 9);
+                    a0[10] = (((41 != 71) + (a0[0] ? 8 : 46)) > ((11 != a0[4]) || (43 || 2)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v0 = (((26 >= 90) < (2 || i0)) / 9);
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v0 = (((v2 == a1[2][13]) ? (v2 >= 35) : (v3 || v0)) ? ((v2 != 58) < (a1[3][4] ? 79 : a1[3][5])) : ((a1[3][1] >= 61) ? (74 - 25) : (36 < a1[0][1])));
+    return (((89 && v3) == (59 / 5)) * ((v0 <= v0) % 3));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 16;
+    int v1 = 84;
+    int v2 = 68;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v3 = (((v0 ? v3 : i0) > (i0 && a1[3][9])) || ((v1 + 64) == (v3 || i0)));
+        a1[2][3] = (((a1[1][7] - i0) >= (31 - 33)) * ((i0 % 1) - (29 + v0)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a1[2][0] = (((a1[1][5] || 89) <= (a0[7] - 66)) ? ((v0 ? a1[0][10] : v0) - (v2 ? i1 : 65)) : ((50 < v1) == (v3 || 20)));
+                v1 = (((a0[14] % 5) - (i0 >= v3)) + ((v1 < v3) % 4));
+                v1 = (((43 % 1) <= (a0[12] == 52)) && ((a0[10] != 26) > (a1[2][6] - 57)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[15] < 60) > 86) break;
+                    v2 = (((v2 + 20) > (v2 == 75)) ? ((v1 || 68) ? (48 || v2) : (75 || i2)) : ((56 <= a1[0][3]) || (a1[1][10] - i2)));
+                    a0[9] = (((v3 != v2) / 9) ? ((a0[8] && i2) != (a1[3][13] != 74)) : ((a0[7] * a1[2][1]) ? (4 && 7) : (i3 - v3)));
+                    v1 = (((73 ? a0[2] : 39) - (45 ? v2 : v3)) >= ((v0 % 9) / 8));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v2 = (((v3 || i2) < (a0[15] == a0[0])) / 2);
+            v3 = (((a0[10] * a0[5]) <= (v2 < v2)) - ((1 == a1[2][12]) || (v0 > v1)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((42 && v1) * (v0 * v0)) && ((v0 != v3) - (v1 / 5)))) {
+        a1[0][1] = (((a1[0][11] / 2) == (v1 + v3)) || ((v2 && v1) > (a0[11] != 36)));
+        v2 = (((14 ? v3 : v1) ? (v1 >= 96) : (94 == v2)) || ((v2 ? a1[1][0] : 73) >= (a0[4] <= v3)));
+        v2 = (((64 <= v2) != (a0[1] == v2)) - ((64 * v3) % 5));
+    } else {
+        a1[1][11] = (((8 + v1) > (38 - v1)) || ((v0 == v0) <= (a1[1][1] || 84)));
+        v0 = (((a0[13] >= v2) < (v1 < v3)) / 5);
+        v1 = (((v1 / 7) || (v0 || v1)) ? ((18 - a0[14]) - (v0 ? a1[2][0] : 36)) : ((2 == v3) != (a0[5] && a0[15])));
+    }
+    if ((((a1[0][14] == 95) >= (11 >= v3)) >= ((v0 + a0[4]) && (38 < v1)))) {
+        v2 = (((2 ? 22 : v2) ? (93 > v1) : (a0[5] > 66)) > ((v2 && v3) < (v3 % 4)));
+        v2 = (((v0 && v3) && (v0 < v0)) - ((57 ? a0[5] : v0) * (48 * 95)));
+        v2 = (((v3 == v0) <= (a1[0][8] - 85)) > ((v3 && v3) != (v3 && v3)));
+    } else {
+        v3 = (((85 || a1[0][7]) <= (v2 / 7)) ? ((a1[2][1] < 27) ? (v0 != v3) : (v2 + a1[0][0])) : ((v0 + v3) >= (v3 && 96)));
+        v1 = (((v3 ? a0[8] : v1) - (98 >= v0)) > ((a1[2][10] + 41) <= (v2 && 71)));
+        a1[3][9] = (((v0 >= 2) + (v1 > a1[1][0])) ? ((7 != v3) * (a0[0] && 98)) : ((v0 * a0[9]) <= (v2 || v0)));
+    }
+    if ((((a1[1][14] >= 68) >= (a0[1] || v0)) <= ((90 && v3) >= (v2 + 65)))) {
+        v1 = (((27 - v0) >= (a1[2][1] >= v1)) || ((v3 % 8) % 4));
+        v1 = (((v2 <= v0) >= (a0[2] / 1)) == ((v1 != v2) <= (6 < a0[10])));
+        a0[14] = (((a0[10] ? v0 : a1[3][10]) >= (v1 || v0)) > ((v2 != v3) || (a1[0][13] * v2)));
+    } else {
+        a1[0][15] = (((a0[12] ? a1[1][9] : a0[10]) - (a1[0][7] <= v0)) - ((93 % 7) % 7));
+        a0[11] = (((v3 != v2) + (a1[2][10] && 32)) >= ((v0 < v3) >= (v0 ? 92 : 99)));
+        a1[0][15] = (((v3 && v3) <= (7 > 47)) / 6);
+    }
+    return (((20 >= 78) * (11 && a1[1][14])) >= ((89 - a1[0][2]) == (a0[0] ? v0 : a1[1][11])));
+}
+int main() {
+    return 0;
+}
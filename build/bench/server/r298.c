@@ -0,0 +1,101 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 50;
+    int v2 = 77;
+    int v3 = 48;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a1[2][3] || 93) < (a0[15] <= a1[3][4])) == ((v3 || v2) >= (v2 / 5)));
+    v2 = (((41 >= 76) * (50 + a1[0][10])) ? ((a0[7] % 4) <= (v3 < 69)) : ((v3 + 43) / 8));
+    if ((((a1[0][13] < a1[3][8]) / 6) * ((80 ? a1[0][7] : 16) == (v0 >= 22)))) {
+        v3 = (((20 ? v0 : v2) <= (a0[10] % 9)) % 8);
+        v2 = (((32 + v0) && (a0[13] != v3)) ? ((v2 % 2) * (v2 <= 78)) : ((v1 >= v0) < (33 - v3)));
+        v3 = (((v2 || 74) ? (a0[1] ? v1 : v2) : (v2 != v3)) && ((v1 / 9) != (30 <= a0[13])));
+    } else {
+        v0 = (((a0[15] != v3) ? (v0 * v3) : (5 >= v3)) >= ((a1[0][1] <= a0[15]) - (25 > v3)));
+        v3 = (((v2 / 2) <= (v3 + a0[10])) / 7);
+        a0[8] = (((v3 % 9) - (21 / 2)) ? ((v3 + a0[7]) <= (v3 < v2)) : ((14 * v0) != (a0[8] > a1[3][13])));
+    }
+    v0 = (((v3 % 1) >= (v3 < v0)) / 5);
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v2 = (((48 < v2) == (a0[15] == 71)) >= ((v2 || 85) * (i0 - 85)));
+        v1 = (((59 ? i0 : a1[1][12]) * (45 ? a1[3][6] : v0)) ? ((v0 ? v3 : a0[10]) ? (23 % 9) : (i0 ? v1 : 76)) : ((v1 * a1[2][4]) < (i0 == v1)));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                v3 = (((v1 - v1) / 8) / 4);
+                v0 = (((i1 ? 17 : i1) ? (29 && a1[1][1]) : (v0 ? v0 : v1)) || ((a0[14] > 21) % 3));
+                a1[3][14] = (((v0 < 35) * (v2 % 8)) == ((30 ? a0[12] : a0[11]) < (a0[11] < v3)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    return (((v3 != a1[3][12]) || (a1[0][14] / 8)) + ((84 + a1[2][14]) >= (v1 - v0)));
+}
+int f1() {
+    int v0 = 83;
+    int v1 = 81;
+    int v2 = 98;
+    int v3 = 54;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((18 % 1) > 51) break;
+            v0 = (((v2 == i0) % 2) > ((v0 + 93) - (v1 * a1[1][15])));
+            a1[1][2] = (((v0 - i0) || (a1[0][14] >= v3)) % 5);
+            {
+                int i1 = 0;
+                do {
+                    if ((v1 <= a0[5]) > 92) break;
+                    a0[9] = (((i1 - 55) > (a0[14] > v2)) - ((i1 <= v2) * (i1 * a1[2][5])));
+                    v0 = (((i1 || 2) ? (a0[1] >= 51) : (i0 && v3)) < ((47 % 9) != (58 / 9)));
+                    a1[0][7] = (((v0 || 13) != (i1 != i0)) <= ((a0[12] - a1[2][14]) % 3));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v0 = (((v0 && a1[3][0]) >= (a1[0][0] || a0[1])) <= ((v2 && a0[6]) * (v2 <= v1)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a1[0][5] = (((v0 && v1) && (v3 % 6)) ? ((i2 <= v3) % 5) : ((v1 == i2) == (v3 == 72)));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((a1[3][5] < i3) ? (i3 - 40) : (79 + v3)) == ((8 && 6) ? (v2 * 41) : (i3 < a1[3][12])));
+                a0[4] = (((a1[0][15] / 6) / 2) >= ((90 ? a1[3][7] : a1[0][2]) > (v0 <= 72)));
+                v3 = (((i3 - v0) - (v2 ? v3 : i3)) == ((i2 != v1) && (i3 * v2)));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        v2 = (((v1 - a0[6]) * (v2 != a1[2][12])) ? ((a1[1][1] && v2) > (46 ? v3 : v0)) : ((a0[4] == a0[5]) >= (a0[0] - a0[1])));
+    }
+    if ((((v2 >= v3) <= (v3 - a1[1][10])) ? ((v2 / 8) % 3) : ((v2 == v3) ? (v3 >= v0) : (a0[0] > a0[14])))) {
+        v3 = (((a0[8] || v3) < (26 + a1[2][3])) >= ((96 > v2) >= (a1[3][15] ? v1 : v1)));
+        a1[3][15] = (((v3 * 61) && (47 != a0[3])) ? ((a1[1][13] || 55) ? (a0[12] <= v0) : (v3 != v2)) : ((4 * 62) <= (72 ? v1 : v3)));
+        a0[15] = (((v1 > v0) < (v2 + v2)) + ((9 != v3) || (v0 * 72)));
+    } else {
+        v1 = (((v0 / 6) + (a0[9] * a0[15])) <= ((v2 * a0[15]) <= (v3 || v1)));
+        a1[3][15] = (((v2 && 20) >= (v2 + v1)) * ((v0 > v1) && (v0 <= 38)));
+        v0 = (((89 <= v1) - (v1 && v0)) ? ((v3 < v0) - (v0 % 2)) : ((a0[12] / 1) + (v3 ? v0 : v2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v1 = (((v1 == 81) != (v1 < v3)) % 7);
+                v1 = (((v1 == 95) > (a1[1][5] == v3)) == ((a0[14] * v3) ? (8 <= v1) : (64 || v1)));
+                a1[2][11] = (((a1[2][11] * a1[2][13]) || (i4 == a0[12])) / 9);
+            }
+            a0[4] = (((35 >= v3) % 2) != ((i4 < v2) != (1 == v0)));
+            a0[6] = (((91 || 30) % 5) != ((73 % 1) || (v3 < v0)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v2 - v2) > (74 / 2)) > ((v0 < 24) != (v0 ? a1[1][12] : a1[3][12])));
+}
+int main() {
+    return 0;
+}
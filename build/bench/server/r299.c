@@ -0,0 +1,167 @@
+int f0() {
+    int v0 = 89;
+    int v1 = 17;
+    int v2 = 33;
+    int v3 = 94;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 <= a0[6]) && (91 < v3)) * ((84 + 29) ? (a1[2][11] / 5) : (a1[0][1] - a1[3][4])))) {
+        v0 = (((v1 && v3) < (v2 > a0[10])) + ((a0[3] + a1[1][15]) <= (a1[0][0] % 7)));
+        a1[3][0] = (((74 + 3) ? (91 - 19) : (v1 == a0[9])) % 3);
+        v0 = (((56 ? v2 : v3) / 1) < ((v1 > 72) ? (v0 ? v0 : a0[2]) : (v3 ? a1[0][6] : a1[2][6])));
+    } else {
+        v3 = (((56 > a0[4]) == (a1[3][0] ? 19 : 85)) >= ((v0 % 5) >= (v2 && v1)));
+        v2 = (((v2 % 9) ? (v0 / 5) : (28 || v0)) == ((v2 >= 68) < (a1[0][12] >= 36)));
+        v3 = (((92 >= v3) == (a1[1][0] != 17)) * ((v0 != a0[10]) ? (a0[3] != 52) : (v1 % 1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v0 = (((i0 > a1[2][3]) > (i0 % 8)) / 8);
+                    v0 = (((a1[3][12] / 6) * (v3 >= a1[1][13])) || ((65 == 14) / 4));
+                    v1 = (((44 && a0[12]) ? (i1 > v3) : (89 < a1[1][11])) || ((i1 < v1) % 1));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v3 < v0) > (i0 ? 90 : v3)) % 2);
+            a1[3][3] = (((32 < v1) && (v2 ? a1[2][15] : v3)) ? ((v0 || i0) < (v3 ? 53 : a0[9])) : ((a1[2][6] ? v0 : a1[1][12]) != (i0 ? 2 : v2)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v1 = (((57 ? v3 : i3) != (i2 % 4)) * ((a0[11] < a0[15]) || (i3 || v0)));
+                v1 = (((19 <= i2) - (47 < i2)) > ((v1 % 3) || (14 <= i3)));
+                v0 = (((v2 ? a0[10] : i3) % 2) && ((v1 ? 49 : v2) >= (v1 <= i2)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((a0[3] * a0[8]) > (6 >= a1[3][1])) != ((76 * a1[1][14]) || (v3 > v3)));
+        a1[2][15] = (((i2 - a1[1][9]) > (41 < 38)) - ((a0[8] * a0[9]) * (11 / 1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((70 || a1[0][3]) > 91) break;
+            a1[0][10] = (((v0 / 2) < (68 <= a1[3][8])) ? ((v3 < i4) - (v3 < v1)) : ((16 > a0[14]) < (v1 / 7)));
+            v3 = (((a0[13] != v1) <= (v3 > v0)) ? ((a0[14] ? v0 : v3) > (i4 ? 67 : i4)) : ((63 + v2) + (v1 || v1)));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((17 >= 8) || (i4 ? i4 : a0[13])) / 7);
+                    v1 = (((19 + a1[2][14]) > (v3 < 45)) ? ((i5 || 58) * (v2 >= a0[6])) : ((a1[0][9] <= 43) && (v1 > i4)));
+                    v3 = (((a0[9] - v3) < (77 != v2)) / 2);
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    v3 = (((88 < 41) && (v0 ? v2 : 59)) ? ((12 % 8) != (v1 / 2)) : ((a0[2] ? a1[1][3] : v0) + (18 / 3)));
+    return (((v2 - v3) - (17 != a0[11])) * ((43 - 35) ? (v3 % 4) : (74 * a0[2])));
+}
+int f1() {
+    int v0 = 27;
+    int v1 = 82;
+    int v2 = 32;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((87 || a0[7]) == (v0 == a0[1])) * ((84 ? a0[15] : 8) * (18 && v0)));
+            v2 = (((v1 || v1) / 4) ? ((67 ? v3 : 90) > (v3 ? 90 : 87)) : ((v0 <= 41) ? (a1[1][15] != v1) : (76 + 29)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a0[12] = (((v3 * 70) / 4) - ((i1 && v2) == (v0 * 33)));
+                v0 = (((41 % 8) != (i0 > 7)) % 5);
+                a0[14] = (((v2 * v2) - (a0[10] || v3)) % 1);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((39 - v2) > 56) break;
+            a0[6] = (((v2 != a1[2][2]) ? (i2 * a0[7]) : (20 ? i2 : 51)) ? ((v2 >= v1) && (a1[3][8] < i2)) : ((i2 && 67) ? (a1[3][2] != 81) : (a0[15] >= v3)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v1 = (((a0[13] % 6) - (29 % 7)) + ((i3 % 4) && (a1[0][4] == a0[1])));
+                v2 = (((v0 * i3) > (i3 * a0[10])) < ((v0 && v3) / 1));
+                v3 = (((6 >= 15) ? (v3 * a1[1][7]) : (i2 ? i2 : v0)) <= ((i3 == a0[1]) && (i2 < a0[4])));
+            }
+            v0 = (((v3 >= v1) < (55 + a0[12])) >= ((a1[1][0] ? 16 : 32) * (a1[2][5] * v2)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v0 = (((i4 || a0[13]) ? (29 >= a0[2]) : (v0 * 28)) / 6);
+        v2 = (((87 % 7) % 7) && ((v3 != v1) ? (a0[13] / 4) : (16 <= v1)));
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                v1 = (((a1[2][11] == 66) >= (a0[2] * a0[14])) + ((v2 / 7) || (v3 ? v2 : a1[0][2])));
+                v3 = (((i5 % 1) == (v2 && v3)) ? ((v0 || i5) <= (a1[3][6] / 8)) : ((i4 >= a1[0][10]) == (a0[10] > 84)));
+                a0[13] = (((34 + a0[5]) / 2) || ((v3 < v1) ? (54 != v3) : (v1 > i5)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    if ((((a1[0][7] * 8) && (87 == 98)) + ((79 > v0) > (v0 && v0)))) {
+        v2 = (((v0 == 78) % 5) ? ((92 * v0) % 4) : ((a0[5] / 8) != (a0[5] * 91)));
+        v2 = (((37 * 59) % 7) > ((a0[10] + a0[5]) - (v2 && a0[4])));
+        a0[3] = (((v3 % 6) < (a1[1][11] <= 49)) >= ((v1 - v2) + (v3 + a0[11])));
+    } else {
+        v1 = (((27 ? a1[1][5] : v2) != (29 != 0)) || ((98 ? a1[0][1] : 69) >= (v2 != a0[14])));
+        v0 = (((v0 ? v1 : v2) * (v1 != v1)) / 7);
+        v1 = (((94 && v2) - (a1[0][9] || 13)) > ((v2 <= v0) - (25 + v0)));
+    }
+    v1 = (((v0 && v1) + (v2 >= v1)) > ((v2 != 45) - (v2 * a1[3][7])));
+    return (((v2 - a1[0][11]) != (v2 > v0)) ? ((v0 <= 53) == (a1[0][10] && v2)) : ((a1[2][9] >= 18) || (a0[4] < 63)));
+}
+int f2() {
+    int v0 = 44;
+    int v1 = 57;
+    int v2 = 74;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((56 != a0[15]) % 6) != ((v0 - v3) >= (v1 && 82)));
+    if ((((v1 + a0[14]) <= (19 / 2)) + ((19 && v0) >= (v1 > 44)))) {
+        a0[1] = (((a1[3][9] + a0[4]) + (a1[3][14] <= a0[9])) || ((a1[1][6] / 3) ? (a0[4] / 9) : (v2 * 3)));
+        a1[0][2] = (((v1 ? 3 : a0[11]) != (v2 <= 88)) * ((8 <= 93) && (a0[13] && a0[11])));
+        v2 = (((a0[3] + v1) || (v0 != v0)) ? ((51 < v0) ? (v2 < v2) : (v3 < v0)) : ((17 ? 12 : 96) - (v2 ? 30 : v1)));
+    } else {
+        v2 = (((a1[0][3] * v2) + (v3 <= a0[13])) < ((v3 ? a1[2][6] : 52) != (v3 && v0)));
+        a1[0][11] = (((a1[0][14] >= 2) || (v2 != a1[0][6])) + ((v0 <= v2) == (a0[1] / 2)));
+        a1[2][12] = (((v3 <= v0) && (71 && v2)) || ((v3 - 31) ? (v2 >= 17) : (v3 ? 39 : 87)));
+    }
+    if ((((37 >= v3) <= (54 > a0[14])) || ((v1 < v3) - (v1 / 8)))) {
+        a1[1][9] = (((v1 || v2) > (24 || a0[11])) - ((v1 ? a0[15] : v1) && (12 + v0)));
+        v1 = (((v2 > v1) ? (v3 && v1) : (v3 - v1)) && ((54 > v2) ? (v1 == v1) : (v2 <= v2)));
+        v0 = (((v2 / 9) != (v3 > a1[0][7])) != ((v0 + v3) / 4));
+    } else {
+        v1 = (((a1[1][15] > 57) == (a1[0][1] < v1)) * ((41 <= v0) / 9));
+        v0 = (((v2 / 3) / 7) ? ((v1 ? a0[2] : v3) ? (a0[0] != 32) : (v2 ? v3 : v3)) : ((a0[1] ? v1 : a0[14]) <= (v0 ? 80 : 64)));
+        a1[0][11] = (((a0[3] >= a1[0][6]) == (23 * v2)) ? ((14 <= a0[2]) + (v2 <= v0)) : ((v1 > a1[3][12]) > (v3 == v2)));
+    }
+    if ((((a0[13] && v1) ? (89 >= 71) : (a1[1][0] % 7)) - ((a1[2][1] ? v2 : v0) / 6))) {
+        v3 = (((v1 > a1[3][13]) + (3 >= a0[12])) - ((v3 == v0) != (22 + v2)));
+        v2 = (((v1 + v0) ? (25 ? 53 : v1) : (a1[3][9] ? v3 : a0[8])) ? ((v0 <= 55) % 8) : ((87 + a0[13]) ? (a1[1][5] > 68) : (v3 - v3)));
+        v0 = (((v3 - v1) % 1) % 3);
+    } else {
+        v3 = (((v0 - 35) <= (v3 <= v0)) < ((a1[3][3] ? v3 : v0) && (v2 - 75)));
+        v0 = (((a1[0][4] - v3) ? (v2 <= 63) : (a0[5] % 9)) == ((a1[2][11] != v1) % 4));
+        a1[1][14] = (((90 / 4) <= (v2 ? v1 : a1[0][12])) == ((v0 <= a1[3][3]) && (v1 * 54)));
+    }
+    v1 = (((v1 ? v0 : v0) < (54 <= 98)) > ((24 == 80) + (v3 * 32)));
+    return (((19 / 8) % 6) - ((29 != a0[5]) > (v2 || a0[2])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,86 @@
+int f0() {
+    int v0 = 30;
+    int v1 = 94;
+    int v2 = 31;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 / 5) > 82) break;
+            v2 = (((v2 ? 18 : 78) % 3) && ((a1[2][13] && 86) % 4));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v3 = (((v2 + 57) ? (v1 / 9) : (a0[3] ? a1[0][14] : v2)) % 3);
+                    v3 = (((i0 % 9) == (v0 <= v1)) / 8);
+                    v2 = (((v2 < v3) == (v3 - 57)) && ((13 == a1[1][4]) ? (8 ? v3 : v2) : (v3 / 8)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][15] = (((v2 + 20) == (i0 || 46)) - ((a0[11] < i0) < (v1 ? v3 : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v1 < v2) > 94) break;
+            v3 = (((v1 % 2) + (60 <= v3)) <= ((v2 <= v0) && (v1 != 0)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v3 = (((a1[2][8] + a1[0][13]) * (39 || 89)) / 4);
+                v3 = (((50 - i2) - (i3 > a1[1][4])) || ((30 + v2) || (a0[9] && a0[15])));
+                v1 = (((20 * i3) + (v3 + i2)) >= ((v1 / 7) / 5));
+            }
+            v2 = (((v2 >= a1[3][15]) != (41 ? v3 : 33)) >= ((97 + a0[3]) <= (v0 / 7)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v3 = (((79 + 85) == (a0[3] ? v1 : v2)) + ((33 ? v1 : 43) / 3));
+            a1[2][10] = (((v0 - v0) != (4 / 8)) >= ((25 * v1) > (v3 - v2)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v0 = (((v2 > 53) != (a0[11] + i4)) ? ((v3 >= a0[1]) ? (a0[9] * a1[1][12]) : (a0[3] < a1[2][6])) : ((v3 <= v1) > (65 % 5)));
+                a1[2][6] = (((v0 >= v2) / 6) ? ((v1 >= i4) / 4) : ((a0[2] * v1) == (a1[2][5] == 38)));
+                v1 = (((52 ? v1 : 30) && (49 != a1[0][2])) && ((0 || a1[3][7]) > (84 % 5)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+            v0 = (((a0[5] * 53) ? (75 % 4) : (i7 < 49)) ? ((i6 / 3) <= (i7 ? 22 : a1[1][8])) : ((a1[1][3] && a0[12]) || (i7 <= v3)));
+            v3 = (((88 && v2) - (a0[10] < i6)) / 5);
+            v1 = (((v3 <= i7) + (a0[14] == 72)) && ((i6 < i6) >= (a0[7] == 0)));
+        }
+        a0[14] = (((a1[1][9] && v3) + (a0[15] != 58)) - ((v3 % 1) != (a1[1][14] || v0)));
+        v3 = (((i6 > v1) / 1) < ((v0 || v2) / 1));
+    }
+    {
+        int i8 = 0;
+        while (i8 < 6) {
+            if ((a0[12] + i8) > 84) break;
+            v2 = (((68 > v3) && (i8 + a1[3][5])) <= ((48 ? v2 : v1) / 4));
+            v2 = (((i8 && 69) ? (v0 < 47) : (3 >= v1)) || ((a1[1][14] < a0[12]) || (54 ? v2 : a1[2][9])));
+            {
+                int i9 = 0;
+                while (i9 < 7) {
+                    v2 = (((i8 - a0[10]) / 6) * ((a1[3][3] * v2) || (v3 || v0)));
+                    v0 = (((43 && 63) / 4) + ((i9 && 28) + (67 ? v2 : a1[1][6])));
+                    v2 = (((a1[2][8] % 3) != (79 || 95)) <= ((v3 ? 31 : 19) > (i8 * a1[0][11])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((a0[3] || v0) ? (81 < v3) : (73 ? v2 : v1)) ? ((a0[8] > v1) != (v3 + v0)) : ((a1[2][1] || v2) <= (87 - v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
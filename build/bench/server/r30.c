@@ -0,0 +1,77 @@
+int f0() {
+    int v0 = 26;
+    int v1 = 75;
+    int v2 = 80;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    if ((((25 + 70) < (v2 >= v1)) % 9)) {
+        v1 = (((a0[10] != v3) > (v2 + v3)) % 7);
+        a0[12] = (((v0 >= v1) || (a1[1][14] <= 6)) != ((a0[9] < v1) >= (v0 || 51)));
+        a1[2][11] = (((40 / 8) > (a0[13] >= 77)) && ((v2 > v2) * (v2 > a1[3][12])));
+    } else {
+        v2 = (((v1 % 7) * (v3 / 2)) * ((v2 == v2) == (a1[1][4] * v3)));
+        v2 = (((a0[0] % 4) / 9) == ((39 >= 79) / 7));
+        v1 = (((v3 == a1[2][11]) >= (4 >= v0)) < ((a0[15] > a1[1][8]) ? (v1 != a1[1][2]) : (v2 - a0[2])));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((a1[3][5] && a1[0][14]) > 91) break;
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v1 || a0[4]) == (a0[2] % 8)) % 4);
+                    a1[2][11] = (((i0 * v2) != (62 ? v1 : i1)) == ((v3 * 89) / 8));
+                    v3 = (((3 && 91) % 4) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((26 >= i0) >= (a1[0][14] ? 27 : a1[3][10])) % 6);
+            v0 = (((v3 && v3) < (v2 % 6)) > ((17 && 19) <= (5 ? i0 : a0[15])));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v0 - v2) > 77) break;
+            a1[2][14] = (((a1[1][12] ? i2 : a1[0][5]) <= (a1[1][6] || a0[10])) > ((80 ? v3 : a0[2]) == (v3 >= 19)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((a0[6] / 4) == (a0[11] * 86)) + ((14 == v1) <= (v1 >= v0)));
+                    v1 = (((39 >= v0) ? (v0 * a1[3][8]) : (30 <= v0)) > ((82 % 7) <= (i2 / 1)));
+                    v1 = (((i3 * a1[3][4]) >= (a1[2][14] + 10)) + ((31 == v3) <= (v2 != 72)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[13] = (((v3 >= 41) + (a1[1][0] >= a0[6])) / 4);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[0] - v0) > (v1 * a0[3])) / 4)) {
+        v1 = (((v0 > a1[3][0]) || (a0[8] - v0)) + ((51 * 20) && (a0[3] ? a0[8] : v0)));
+        a1[0][9] = (((79 ? 61 : v0) >= (v0 != a1[2][7])) <= ((a1[3][5] == v2) / 8));
+        v2 = (((v2 - 26) < (v0 < a1[1][3])) - ((v1 / 1) && (v2 && v3)));
+    } else {
+        v1 = (((58 * a1[1][5]) <= (v1 ? 93 : v2)) || ((76 - v2) * (v3 && v3)));
+        v3 = (((v2 * v2) || (v1 / 7)) >= ((44 ? v3 : v0) < (v0 * v2)));
+        v0 = (((v2 != v1) || (v1 <= v3)) * ((a1[0][9] % 3) / 5));
+    }
+    if ((((2 < a0[10]) + (v3 && a1[0][12])) && ((v0 == v1) <= (a0[9] || a1[1][15])))) {
+        a0[2] = (((a1[0][10] || a0[0]) ? (6 > 59) : (v0 <= v2)) >= ((v1 || 90) * (61 <= a1[0][14])));
+        v3 = (((v1 != a0[14]) >= (a0[11] != 66)) <= ((v0 <= a1[1][4]) && (v2 < 59)));
+        v1 = (((v0 == v3) <= (v0 <= v0)) == ((a0[3] / 4) != (a0[0] && v3)));
+    } else {
+        v0 = (((v3 - 85) && (v3 + 26)) >= ((a1[0][10] % 9) != (v0 <= v2)));
+        a0[9] = (((a1[2][13] < a0[14]) ? (a1[3][4] % 9) : (a0[4] || v3)) != ((v2 != v2) - (74 <= v1)));
+        v3 = (((a1[0][15] != 55) <= (v1 == v0)) < ((v0 >= v3) != (a1[1][9] && v1)));
+    }
+    return (((v2 && v3) == (v0 - v2)) / 3);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
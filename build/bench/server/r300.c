@@ -0,0 +1,61 @@
+int f0() {
+    int v0 = 81;
+    int v1 = 60;
+    int v2 = 79;
+    int v3 = 48;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 && 40) || (v2 ? v0 : v2)) / 7)) {
+        v3 = (((v1 ? a0[8] : v1) || (13 ? 98 : v2)) == ((a0[10] == v3) <= (v0 * 1)));
+        v1 = (((a1[1][11] >= a0[4]) > (36 < a1[2][11])) + ((30 / 6) <= (a1[3][3] - 69)));
+        v2 = (((v2 + a0[11]) ? (v0 - a0[8]) : (v0 ? v2 : v0)) != ((v2 != v0) * (a1[2][3] || v2)));
+    } else {
+        v0 = (((95 % 1) >= (v2 >= 84)) % 3);
+        v0 = (((v3 <= v3) % 6) ? ((39 + v0) && (a1[2][4] > a1[0][0])) : ((v3 <= v3) ? (v0 + a0[6]) : (v0 + v1)));
+        v0 = (((v1 && v1) || (43 / 3)) / 3);
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a0[6] = (((v2 && 17) - (a0[13] + 81)) ? ((v2 ? v2 : v0) > (a0[11] && 83)) : ((0 ? v0 : v0) || (94 <= i0)));
+        v0 = (((v0 + i0) != (v0 - 1)) - ((64 >= a0[13]) <= (i0 ? i0 : a1[1][5])));
+        {
+            int i1 = 0;
+            do {
+                a1[1][6] = (((17 + v1) > (v1 >= a0[7])) < ((v0 != i1) || (v2 ? a1[2][13] : 24)));
+                a0[12] = (((11 + i0) <= (v1 >= v1)) < ((a1[1][9] != 26) ? (a0[8] == a0[0]) : (a0[10] && v0)));
+                a0[10] = (((a0[8] * 42) * (58 == v2)) == ((i1 + 14) ? (33 && i1) : (98 / 7)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+    }
+    if ((((v0 * a1[3][12]) && (65 ? v0 : v1)) + ((v1 < 5) > (64 != v2)))) {
+        v2 = (((v2 != v1) - (a0[2] && v1)) < ((v1 * 15) <= (v2 + a0[4])));
+        a1[2][3] = (((v3 && a1[3][6]) * (v3 == v0)) <= ((v1 - v3) + (a1[1][3] == v2)));
+        v0 = (((a1[3][3] == v1) <= (v2 >= v2)) % 8);
+    } else {
+        v3 = (((a0[9] < v0) / 4) <= ((68 + v0) < (a0[15] - a1[3][14])));
+        a0[8] = (((v1 > 64) >= (v0 * a1[2][12])) ? ((a0[3] > v2) == (v0 < 9)) : ((88 ? 57 : v0) ? (v3 || v0) : (v2 * v0)));
+        v1 = (((22 != v1) <= (v1 + v1)) % 3);
+    }
+    a1[1][1] = (((23 + a1[3][0]) || (v3 >= v1)) - ((20 / 5) < (v3 ? a1[1][9] : v1)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                do {
+                    a1[1][12] = (((i3 ? v0 : 87) % 4) ? ((i2 % 8) / 4) : ((a1[3][9] ? v2 : a0[1]) || (v0 - 59)));
+                    v1 = (((v2 ? v1 : 78) && (70 >= a1[2][8])) != ((v3 == v0) ? (v1 ? a1[3][8] : 57) : (a1[3][11] * a0[9])));
+                    v3 = (((28 <= i2) + (a0[6] + v1)) - ((15 || a1[2][13]) == (81 ? v3 : i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            v1 = (((v3 <= a1[1][12]) < (i2 > a0[0])) + ((a1[3][3] > v1) * (v3 != v1)));
+            a1[0][3] = (((a1[2][10] ? i2 : v1) <= (i2 != 46)) <= ((6 <= 84) <= (66 * v1)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((9 && a1[1][4]) == (80 ? v2 : 57)) % 8);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,148 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 11;
+    int v2 = 60;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((a1[2][1] * v0) > 81) break;
+        v3 = (((14 - i0) <= (v0 - 49)) / 7);
+        {
+            int i1 = 0;
+            do {
+                a1[2][3] = (((i1 || v2) >= (30 % 2)) ? ((v2 > 96) ? (v0 / 7) : (v3 != v3)) : ((34 ? a1[3][10] : 63) + (v1 ? a1[2][4] : a1[2][0])));
+                v1 = (((a1[1][8] >= i1) ? (v1 - a1[3][12]) : (10 >= a0[14])) != ((98 || 86) >= (a0[15] % 2)));
+                v3 = (((a0[5] * a0[3]) % 4) < ((23 <= v2) < (v3 < v2)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v0 = (((v1 * v0) != (v0 + v1)) != ((v1 > a1[2][13]) - (v0 % 1)));
+    }
+    if ((((v3 ? a0[11] : v1) != (62 == v3)) + ((v3 / 4) != (42 <= a0[4])))) {
+        a1[3][15] = (((a0[14] % 8) >= (63 * v3)) || ((v1 || v0) && (6 > v1)));
+        v2 = (((79 % 8) < (a1[2][8] ? v3 : a1[3][13])) ? ((26 < a1[2][12]) <= (v2 < a0[3])) : ((91 > 53) / 5));
+        v2 = (((v2 + a0[5]) != (a0[2] * v3)) > ((v1 ? 83 : v0) < (37 || v0)));
+    } else {
+        v2 = (((v1 % 6) && (v0 != 22)) + ((v1 >= v0) < (v2 + a1[1][15])));
+        a0[0] = (((v0 && v2) == (a0[2] * a0[2])) != ((v0 < v1) ? (26 < v2) : (a0[15] + a1[3][13])));
+        a1[1][1] = (((v2 - v3) >= (a0[7] < 40)) * ((v1 && v1) == (88 > v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v3 || a1[3][11]) > 88) break;
+            v1 = (((v1 / 4) / 2) * ((v2 != v0) || (v0 != a0[3])));
+            a1[3][6] = (((v0 <= v0) ? (i2 ? 59 : 82) : (65 - 55)) <= ((a1[0][11] - 85) - (v1 >= 37)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((50 ? 48 : a0[15]) > (v0 <= i3)) / 5);
+                    v3 = (((v0 && a0[12]) - (61 != v0)) || ((a0[4] * v3) * (a1[0][3] * v2)));
+                    v0 = (((a1[1][8] - 2) - (v2 / 1)) != ((22 != a0[0]) <= (a1[3][8] <= v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((i4 > v3) > 96) break;
+            v3 = (((i4 <= 53) + (24 < i4)) < ((v1 == v2) && (v2 == 84)));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                if ((v0 >= i4) > 59) break;
+                v0 = (((a0[4] || v0) / 5) && ((v2 - a0[10]) != (v0 && v0)));
+                v2 = (((91 == 30) ? (v2 / 9) : (a1[1][8] ? 15 : 9)) > ((v1 && 11) % 9));
+                v1 = (((v1 != 71) - (v1 - v3)) <= ((i4 != 84) == (5 >= 28)));
+            }
+            v0 = (((v0 == a0[10]) / 6) + ((v0 <= v3) >= (v0 + a1[0][7])));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    if ((((v0 - v3) % 8) || ((36 >= 81) >= (88 != v1)))) {
+        v2 = (((66 ? 85 : v1) * (v2 * 51)) % 3);
+        a1[0][7] = (((v1 - v0) <= (v2 + v2)) * ((v2 - 5) * (29 < v1)));
+        v3 = (((47 / 5) || (9 ? v3 : v3)) < ((58 - a1[1][4]) >= (v3 ? v1 : a0[12])));
+    } else {
+        v2 = (((a0[13] + 27) || (a1[0][7] && v3)) ? ((a0[14] >= 84) || (v0 / 3)) : ((v2 != a0[6]) * (v0 ? v3 : a0[12])));
+        v1 = (((a0[15] * a0[6]) % 7) && ((v0 % 2) == (v3 <= 46)));
+        v0 = (((a1[2][3] - v3) != (v3 - 5)) ? ((v2 + 76) > (a1[1][15] % 8)) : ((v3 - v0) < (a1[1][3] ? v0 : v0)));
+    }
+    return (((v1 ? v1 : v1) ? (v0 ? 94 : 13) : (v3 + 15)) ? ((a0[13] && 19) == (v1 != 8)) : ((a0[9] % 3) >= (12 - 57)));
+}
+int f1() {
+    int v0 = 85;
+    int v1 = 58;
+    int v2 = 87;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                do {
+                    a1[0][2] = (((i1 + v0) > (63 ? a1[3][7] : v3)) && ((v2 <= 99) == (v2 % 4)));
+                    v1 = (((a1[3][5] + 59) < (v0 % 9)) && ((v3 - v3) == (v0 / 1)));
+                    a1[1][5] = (((79 / 8) || (a1[2][6] ? v0 : a1[3][3])) - ((i1 || i0) > (a0[6] != v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v2 = (((i0 ? v2 : v3) % 6) == ((a0[14] > i0) * (a0[6] >= v1)));
+            v0 = (((12 > v3) - (83 / 7)) / 2);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((15 >= v3) > 78) break;
+            v3 = (((58 % 2) ? (52 || a1[1][7]) : (35 <= v0)) && ((a0[15] <= v0) % 4));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v2 = (((a1[2][11] && v1) - (v2 - 99)) && ((73 / 6) < (v2 ? 55 : a1[0][5])));
+                v2 = (((v2 || v0) ? (a0[6] - i3) : (55 != v2)) < ((v3 / 9) != (v2 && 28)));
+                a0[12] = (((42 + 17) >= (a0[12] && i3)) < ((v3 ? i3 : 64) && (a0[5] != v0)));
+            }
+            v2 = (((62 / 1) == (v0 < v3)) >= ((a0[6] * a1[1][14]) >= (75 - a0[5])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v0 = (((a0[13] <= i4) + (20 + a1[0][5])) % 3);
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v2 = (((v3 ? v1 : v2) - (v3 * v2)) >= ((a1[3][13] % 2) ? (49 >= i4) : (19 - i4)));
+                v0 = (((i4 / 8) || (v0 * i5)) * ((v1 % 4) / 1));
+                a0[14] = (((a0[2] <= i5) ? (i4 != v3) : (a1[0][6] || a0[15])) && ((v0 >= a1[3][6]) <= (a0[10] - i4)));
+            }
+            v1 = (((i4 ? a0[13] : a0[0]) || (v1 || i4)) ? ((v1 > v0) != (v1 / 2)) : ((i4 / 3) % 6));
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((v1 - 77) ? (v2 % 4) : (v1 != 22)) == ((a0[0] != 27) + (a1[2][15] < 77)));
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            a0[10] = (((a1[0][1] <= 94) >= (a0[14] + a0[8])) - ((a1[0][1] - v3) + (v0 && i6)));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    a1[0][0] = (((62 ? v1 : v3) != (a1[2][2] || i6)) <= ((v1 || 45) ? (v2 && v1) : (i6 >= 64)));
+                    v2 = (((i6 >= 71) >= (83 ? i6 : a1[3][15])) / 4);
+                    v0 = (((a0[7] > 92) != (v0 % 7)) && ((i6 || a0[8]) % 5));
+                    i7 = i7 + 1;
+                }
+            }
+            a1[3][6] = (((a1[3][10] == a0[11]) % 7) == ((30 != 10) && (v2 || a0[2])));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v3 * v3) >= (v2 * v1)) < ((98 == v2) + (5 / 6)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,243 @@
+int f0() {
+    int v0 = 71;
+    int v1 = 88;
+    int v2 = 34;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v3 = (((17 != 64) ? (a1[0][15] - v1) : (i0 || 91)) == ((84 >= 57) < (i0 * a0[2])));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((4 - 46) && (v3 ? v2 : v1)) || ((v1 != v2) <= (v3 < a0[10])));
+                    v2 = (((a0[12] < v3) != (a1[0][14] % 7)) == ((v3 ? a1[1][6] : v0) <= (81 == i0)));
+                    v1 = (((a0[2] % 9) == (v1 - 39)) + ((v1 > v1) + (a1[1][15] >= 71)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v0 = (((v3 == 7) / 9) && ((v1 / 3) < (i0 / 5)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[2][2] / 6) - (a0[11] > v2)) ? ((7 >= v3) % 7) : ((39 - v3) != (v1 * a0[12])))) {
+        v0 = (((v2 <= a1[1][8]) * (v3 && 55)) > ((v2 / 6) * (v3 <= v0)));
+        a1[0][14] = (((v3 / 7) + (22 - 59)) / 8);
+        a1[0][10] = (((v2 * v0) ? (60 && 47) : (26 + v2)) != ((89 > 1) + (a1[3][7] / 9)));
+    } else {
+        a1[2][10] = (((v0 >= a0[6]) ? (v0 / 6) : (v1 <= v3)) && ((47 - v3) - (v2 ? v0 : v0)));
+        v0 = (((v1 ? 24 : 23) ? (14 % 1) : (83 * a0[7])) && ((v1 && v2) <= (v1 && v2)));
+        v3 = (((a0[7] || 46) >= (v3 * 68)) < ((a0[9] >= v1) + (v3 / 8)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v0 = (((v1 || v3) * (v2 < 8)) / 2);
+        v0 = (((v1 / 5) * (v2 + v1)) || ((22 - a1[0][15]) + (99 / 2)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((i3 < a0[15]) > 86) break;
+                v3 = (((v3 <= i3) < (i2 - v2)) != ((18 % 7) + (v0 < i2)));
+                v1 = (((v3 < i2) == (a1[0][5] && v1)) >= ((a1[2][7] * 43) <= (a0[2] + 95)));
+                v3 = (((v3 >= v1) > (12 * i2)) ? ((2 >= a1[1][5]) > (26 >= v0)) : ((99 || v2) * (v1 ? a1[1][3] : v1)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            a0[9] = (((v0 % 3) < (v0 / 7)) ? ((i4 ? v3 : 79) >= (88 > 78)) : ((89 < 61) && (v1 - 82)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v2 = (((48 / 7) < (v2 / 5)) - ((i4 - 6) < (2 - 51)));
+                    a0[6] = (((a1[0][15] ? a0[5] : a1[0][0]) + (v1 - v1)) >= ((a1[2][3] > a1[2][0]) && (55 % 1)));
+                    v3 = (((v0 < v0) - (v3 && i4)) + ((v0 || a0[1]) == (a1[1][9] - i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((i4 >= i4) == (63 <= 30)) < ((11 < 89) || (a1[3][13] != a0[4])));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((a0[9] % 5) % 9) < ((a1[3][2] || 87) < (v2 || 22)))) {
+        v0 = (((v1 != v1) ? (a1[2][10] < v1) : (v2 != v3)) ? ((v0 % 9) || (v0 != v0)) : ((v1 / 5) || (68 + a1[1][1])));
+        v2 = (((v2 > 20) + (a1[1][4] <= v2)) ? ((25 - 40) / 4) : ((a0[2] && 81) > (85 * 55)));
+        a1[2][5] = (((78 == v1) ? (42 && v1) : (v1 / 6)) && ((v2 >= v0) % 9));
+    } else {
+        v1 = (((v0 == a1[2][8]) != (v2 % 3)) ? ((a1[0][13] && v0) < (v0 + a1[3][7])) : ((78 + a0[13]) >= (a1[0][1] ? v0 : v3)));
+        v1 = (((a0[8] || 75) + (v3 <= v2)) / 2);
+        v1 = (((v2 > 41) ? (v2 * v1) : (59 * v3)) % 7);
+    }
+    return (((v1 % 9) >= (v0 <= a1[1][15])) >= ((v3 ? a0[1] : v3) > (a1[1][4] * v2)));
+}
+int f1() {
+    int v0 = 50;
+    int v1 = 64;
+    int v2 = 3;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 || v1) / 6) < ((54 >= a1[2][11]) + (v2 && a0[0])))) {
+        a0[6] = (((45 >= v1) - (v2 % 9)) > ((a0[13] ? v2 : v1) / 5));
+        v1 = (((v0 >= 1) <= (73 == v1)) > ((a0[4] != 21) < (v1 < v0)));
+        a0[1] = (((a0[9] < v2) == (v0 + a0[2])) || ((v3 ? v0 : a1[1][9]) || (88 < a1[1][7])));
+    } else {
+        v1 = (((v3 && v1) || (a1[2][15] == a0[14])) / 5);
+        a1[0][13] = (((v1 + v2) && (v0 % 9)) * ((a1[0][1] * v0) * (96 * 10)));
+        a1[1][9] = (((15 == 15) > (a0[12] * 66)) > ((a1[0][15] - v3) == (v1 == v2)));
+    }
+    if ((((79 / 7) % 9) / 2)) {
+        v3 = (((99 < a1[1][2]) != (24 && a1[3][15])) < ((v3 / 6) / 2));
+        v0 = (((v1 != 59) / 5) - ((v2 >= a0[7]) / 5));
+        v2 = (((a1[2][8] > a1[3][9]) != (v2 == 19)) % 1);
+    } else {
+        v3 = (((v1 * a0[10]) + (v3 - 81)) < ((v1 + a0[10]) != (v2 > v0)));
+        v2 = (((v1 + v3) == (v3 ? a1[0][4] : v3)) || ((v0 == v1) >= (89 && a0[8])));
+        v1 = (((v1 >= v2) != (v3 > v3)) ? ((35 < a1[2][2]) != (v1 < v1)) : ((a0[7] % 8) + (v2 != a0[5])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v3 = (((v3 < v3) <= (v2 ? a1[3][13] : i0)) && ((v0 != v3) <= (63 * 91)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((82 % 6) % 5) - ((a1[2][12] && v1) / 5));
+                    a1[1][12] = (((v1 && v1) > (a0[14] > 24)) * ((73 * 28) >= (a1[1][14] < 7)));
+                    a1[0][6] = (((a0[2] > v3) != (v3 / 5)) && ((a0[12] <= v1) ? (v1 <= v0) : (v2 || 61)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((7 % 7) - (i0 == v3)) > ((v0 ? v3 : 55) < (v2 ? 83 : a0[13])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[2][14] = (((13 == v1) ? (v2 <= a1[1][2]) : (i2 + a0[1])) - ((a1[1][6] > 69) || (v1 && a1[3][5])));
+            {
+                int i3 = 0;
+                do {
+                    a1[1][12] = (((a1[3][15] <= 20) + (a1[1][4] && v0)) == ((a1[1][10] == v3) == (i2 % 5)));
+                    a0[1] = (((a1[1][8] >= v0) % 3) + ((v0 / 7) < (i2 * 42)));
+                    v1 = (((a0[7] - a1[2][8]) / 2) * ((v3 / 8) >= (a0[2] + a1[0][12])));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v2 = (((i2 > i2) ? (55 * i2) : (63 - v0)) || ((v3 == v2) || (v2 <= a0[9])));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((v3 ? v3 : v3) > 84) break;
+            a1[2][6] = (((v2 != 52) ? (i4 * v2) : (v0 <= 21)) <= ((v1 != 1) * (a1[2][3] > 71)));
+            a0[7] = (((v0 ? a0[12] : 29) ? (9 < v3) : (v3 ? i4 : v0)) != ((29 - a1[1][8]) != (a1[2][2] % 2)));
+            {
+                int i5 = 0;
+                do {
+                    if ((29 >= v1) > 90) break;
+                    a0[15] = (((a1[1][9] <= v3) - (i5 ? i5 : v2)) / 3);
+                    v1 = (((21 * a1[1][10]) - (a0[12] >= a0[13])) ? ((v0 ? v1 : a1[3][13]) != (i4 / 3)) : ((a0[12] == i4) != (v3 != 98)));
+                    a0[8] = (((i4 ? 43 : a0[5]) == (v3 != i4)) ? ((a1[2][14] > v1) >= (a0[4] ? a0[14] : v1)) : ((91 && i5) >= (a1[3][4] / 5)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 * v2) / 5) - ((a0[7] % 3) != (80 <= a0[7])));
+}
+int f2() {
+    int v0 = 88;
+    int v1 = 17;
+    int v2 = 9;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 && v1) == (v3 > v1)) ? ((a1[3][6] - a0[15]) * (a1[0][4] && v0)) : ((a1[0][3] || 98) * (a1[0][9] / 9)))) {
+        v3 = (((a1[1][15] || a1[1][4]) || (v3 > 37)) < ((v0 == v2) * (v0 - a1[3][3])));
+        a0[14] = (((v0 >= v1) + (a0[7] / 7)) < ((v1 == 45) / 7));
+        a0[4] = (((14 ? v1 : a0[4]) - (v0 * a0[6])) >= ((55 % 4) && (63 ? v2 : 46)));
+    } else {
+        v2 = (((a1[3][8] + a0[9]) && (a0[2] != v3)) + ((a0[12] ? a1[0][0] : v2) / 9));
+        v0 = (((a0[12] % 2) + (a1[0][9] + v3)) * ((47 / 4) ? (55 ? 78 : v3) : (v1 % 1)));
+        v1 = (((v3 - a0[10]) % 2) + ((a0[15] || v1) <= (83 / 3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a1[0][9] % 9) ? (i0 + v1) : (a0[13] - a0[10])) <= ((a0[3] || 99) + (61 % 7)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a0[1] || v2) != (v0 % 3)) + ((i1 >= v0) > (i1 != v0)));
+                    v0 = (((a1[0][5] || 2) > (v1 == a0[9])) % 8);
+                    v1 = (((v1 > 36) > (v2 != v1)) + ((a0[2] <= 40) ? (a0[12] / 5) : (28 + 67)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v3 = (((a0[5] ? a1[3][3] : v2) > (a0[4] + a1[3][13])) <= ((i0 != a0[0]) % 8));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((58 <= a1[1][2]) > 97) break;
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    a0[12] = (((34 / 9) - (i2 ? i2 : 11)) || ((a1[1][5] == v1) == (85 + 81)));
+                    v2 = (((54 - i2) || (a1[0][5] * v2)) <= ((v0 * v1) % 6));
+                    v2 = (((a1[2][5] < 84) || (v2 || 27)) || ((i3 ? a0[11] : v3) + (v0 && 83)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v2 != v2) >= (29 >= 84)) >= ((v3 > a1[2][15]) || (v2 && i2)));
+            v1 = (((v0 ? a0[9] : v2) ? (76 || 62) : (i2 ? 76 : i2)) >= ((i2 || i2) ? (v3 ? v2 : 92) : (i2 % 9)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v0 = (((v3 / 3) - (v0 / 5)) != ((a1[3][4] || a1[3][12]) - (v0 || v3)));
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                if ((i5 != v0) > 69) break;
+                v3 = (((11 != 92) ? (v3 < a0[1]) : (v2 * 48)) < ((i5 >= 42) + (a1[0][15] ? v1 : a0[8])));
+                v3 = (((v0 == 49) == (i5 && i5)) || ((i4 && 97) + (v3 ? 99 : a0[4])));
+                a0[5] = (((a0[1] > a1[1][10]) % 2) % 5);
+                i5 = i5 + 1;
+            }
+        }
+        v0 = (((8 * 21) && (v1 ? v0 : i4)) || ((v0 > a0[7]) == (a1[3][14] ? 8 : a1[1][12])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((v2 ? 93 : 0) > 97) break;
+            v0 = (((76 ? i6 : v3) / 1) ? ((v0 + 83) && (69 % 3)) : ((44 ? a0[0] : v1) % 4));
+            a1[3][13] = (((a0[13] ? 37 : a1[1][13]) % 1) != ((19 > 37) == (90 ? v3 : a1[3][12])));
+            {
+                int i7 = 0;
+                do {
+                    a1[3][13] = (((a1[2][12] % 1) ? (30 ? 87 : i7) : (44 && v3)) == ((93 ? a0[6] : a0[8]) ? (a0[3] + 40) : (v2 / 8)));
+                    v0 = (((a0[2] && 42) < (97 ? v0 : a0[0])) > ((v1 && v2) - (62 < 11)));
+                    a0[4] = (((a0[2] < i6) > (v0 ? v3 : 3)) >= ((v2 && 45) ? (64 >= v2) : (v1 + v1)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v2 * v0) && (v3 - v1)) && ((65 - v2) > (a1[0][15] != v2)));
+}
+int main() {
+    return 0;
+}
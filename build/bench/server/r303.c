@@ -0,0 +1,73 @@
+int f0() {
+    int v0 = 59;
+    int v1 = 26;
+    int v2 = 21;
+    int v3 = 62;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[1][14] || v3) != (v1 * 28)) && ((67 && v1) + (v2 - a1[3][5])));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v2 = (((a0[15] ? 37 : a1[2][4]) - (89 && 64)) - ((15 >= a0[4]) ? (v2 - v1) : (a1[2][2] / 8)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((a1[1][6] != v2) > 50) break;
+                    v0 = (((v0 + 46) <= (a1[2][4] ? 95 : 76)) <= ((v0 < 53) < (v1 * v1)));
+                    v0 = (((42 > v0) || (v1 <= a0[15])) < ((a1[2][11] != v2) * (v1 % 8)));
+                    v0 = (((i0 && a0[11]) / 6) < ((v3 >= v0) - (36 <= a1[1][10])));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((29 && 92) >= (a0[13] > v0)) * ((99 ? v1 : a0[15]) ? (v3 - i0) : (78 % 2)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            {
+                int i3 = 0;
+                do {
+                    a0[2] = (((60 <= a0[13]) <= (a0[15] / 3)) > ((12 > i2) && (a1[1][10] >= v0)));
+                    a1[3][5] = (((a1[2][12] == a1[1][10]) && (29 ? a0[3] : a0[6])) / 3);
+                    a1[2][8] = (((i2 >= a1[3][5]) == (i3 / 5)) <= ((i2 * 12) ? (a0[7] && v1) : (v1 ? v2 : i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v1 = (((a1[2][12] && v1) < (v0 > v3)) / 8);
+            a1[0][15] = (((v0 >= a1[2][3]) >= (v1 || 38)) >= ((a1[2][9] && a1[1][2]) >= (13 <= v1)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        if ((v1 ? v1 : i4) > 62) break;
+        v0 = (((v0 % 4) || (a0[3] < v2)) < ((v2 || 59) / 3));
+        {
+            int i5 = 0;
+            do {
+                if ((v2 % 9) > 61) break;
+                v1 = (((v2 < v2) > (v1 ? 75 : v2)) && ((v2 * 35) / 7));
+                v3 = (((i4 - a0[10]) || (17 * v0)) * ((v2 ? v3 : 30) || (i5 >= v2)));
+                v1 = (((v1 - v3) && (94 >= 88)) - ((v0 + a0[15]) > (a0[15] % 3)));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        a0[15] = (((a0[14] >= i4) < (v3 < v0)) + ((40 != 73) + (v0 ? a0[13] : a1[0][8])));
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        v0 = (((v0 && i6) != (81 < 2)) ? ((a1[1][7] ? a1[2][0] : v1) < (a1[3][15] != v2)) : ((a1[2][11] == a0[13]) >= (a1[0][3] ? 95 : v2)));
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            if ((v2 && i6) > 63) break;
+            v1 = (((13 <= 28) ? (v3 != a0[12]) : (41 / 8)) * ((v0 + a0[5]) && (v3 != 9)));
+            a0[10] = (((v0 < v1) * (a0[0] >= v2)) >= ((29 < 17) || (60 + 88)));
+            a1[1][5] = (((a0[13] || v0) + (v1 != i6)) - ((v1 != a1[0][7]) * (v2 && 2)));
+        }
+        a1[2][8] = (((v1 >= v0) == (v1 >= a1[0][15])) >= ((v1 == v2) * (v0 ? a0[0] : v2)));
+    }
+    return (((16 == v0) >= (28 > v0)) == ((a1[1][4] && v2) ? (v3 == v2) : (a1[1][2] || a0[2])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,148 @@
+int f0() {
+    int v0 = 85;
+    int v1 = 27;
+    int v2 = 39;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((v2 >= a1[1][2]) && (v2 + a1[2][5])) >= ((a0[13] - v3) ? (77 <= a0[7]) : (77 >= a0[5])));
+    {
+        int i0 = 0;
+        do {
+            if ((46 % 1) > 53) break;
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    if ((v1 == 18) > 66) break;
+                    v0 = (((a0[6] ? 25 : a0[4]) == (a1[3][9] ? a0[6] : a0[6])) + ((7 > v2) / 8));
+                    v0 = (((i0 / 9) ? (a1[2][11] <= 19) : (v0 * a0[3])) / 2);
+                    a0[14] = (((78 * 71) % 8) <= ((i1 && a0[1]) > (v1 - i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[12] = (((v3 == v0) || (i0 / 6)) > ((a0[14] && a1[2][15]) > (v1 % 6)));
+            a0[11] = (((v2 == 88) ? (v2 || v2) : (v1 >= 44)) % 8);
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v3 > v0) && (v1 - 51)) > ((v3 - a0[0]) / 8))) {
+        a0[9] = (((a0[4] * 27) * (91 >= v1)) / 6);
+        a1[1][13] = (((8 > a0[15]) + (a0[9] - v3)) <= ((v3 ? a1[0][15] : v1) >= (v3 - v0)));
+        v2 = (((a0[13] == v2) ? (a0[4] * 45) : (v0 || 37)) >= ((a0[6] + 69) / 7));
+    } else {
+        v1 = (((51 * v2) && (v2 <= v0)) / 2);
+        a1[0][4] = (((v2 ? v3 : a1[1][9]) && (v1 * a1[1][15])) >= ((0 || v0) > (96 && 33)));
+        v3 = (((v0 ? v3 : 15) > (a0[1] % 5)) < ((a0[1] == 17) ? (a0[2] > a1[1][5]) : (a1[1][4] + a0[8])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v2 = (((v2 - a0[0]) == (v3 ? 36 : i2)) - ((64 <= i2) * (i2 >= a1[0][9])));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((71 && a0[1]) > (v1 <= i2)) < ((a1[2][4] + v0) >= (i2 < a1[1][0])));
+                    a0[11] = (((v3 / 2) >= (v0 % 2)) - ((v3 >= a0[13]) > (a1[3][15] >= i3)));
+                    v0 = (((i2 != i3) + (a1[3][13] + 76)) ? ((i2 / 4) <= (76 ? a1[1][10] : v1)) : ((v1 >= i3) <= (36 != v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v1 = (((v3 == v3) < (a0[4] * v3)) || ((13 == 97) != (a0[4] >= 63)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[1] <= v1) == (86 <= v2)) % 2)) {
+        v3 = (((a0[12] % 3) / 7) < ((a1[0][15] || v0) / 9));
+        a1[2][14] = (((a0[10] && v2) >= (20 / 5)) ? ((20 ? v3 : v2) * (a1[2][5] ? a0[9] : 59)) : ((v1 < a1[2][9]) < (v1 ? v1 : v0)));
+        v0 = (((v0 != v0) >= (a0[15] ? a1[1][1] : 81)) ? ((55 / 1) == (v2 && a0[2])) : ((v2 % 9) != (v2 < v1)));
+    } else {
+        a0[8] = (((a1[2][7] * a1[3][6]) || (v1 && v3)) <= ((v0 || 38) / 2));
+        a0[14] = (((v0 >= v3) >= (a1[1][7] - v1)) == ((76 * a0[2]) < (v2 % 1)));
+        v3 = (((v0 < a0[0]) / 8) <= ((v1 || 71) || (a0[10] > a0[9])));
+    }
+    return (((v2 >= v2) ? (39 / 6) : (v3 ? a1[1][3] : 86)) / 6);
+}
+int f1() {
+    int v0 = 68;
+    int v1 = 47;
+    int v2 = 0;
+    int v3 = 94;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 > v1) >= (a1[0][15] < v2)) / 2)) {
+        a1[1][6] = (((v1 <= 29) == (v1 >= 59)) - ((v1 / 6) > (a1[0][15] && v2)));
+        v2 = (((a1[3][1] ? v3 : 24) ? (v0 % 8) : (a1[1][7] >= v3)) || ((58 + v0) && (a1[0][4] % 3)));
+        v0 = (((92 || v2) || (v1 / 7)) - ((v0 > a1[1][4]) || (v3 == a1[2][15])));
+    } else {
+        a1[1][14] = (((v1 && 9) ? (a1[2][11] * v0) : (v2 < v2)) != ((v0 + v2) || (a1[0][0] <= v0)));
+        a0[8] = (((v1 * v3) <= (v3 <= 13)) + ((a1[2][14] <= 15) + (v2 + 77)));
+        a0[6] = (((a0[7] % 1) % 5) * ((v3 ? v0 : v2) * (v0 + v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v0 = (((a1[0][13] * a1[0][10]) - (a1[1][1] == 9)) >= ((a1[2][3] % 8) && (21 * v3)));
+            a0[14] = (((44 <= v0) && (v3 || 42)) ? ((v3 > 61) < (v1 < a1[1][4])) : ((a1[0][1] != v1) != (a0[11] + v3)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v0 = (((80 != a0[15]) + (v1 - a1[2][11])) ? ((a1[0][6] ? 2 : 48) == (57 + v0)) : ((71 ? a1[2][10] : 97) < (a1[3][11] <= 16)));
+                    a1[1][0] = (((a1[0][0] ? a0[5] : a1[0][10]) / 3) % 8);
+                    a0[12] = (((v2 / 7) && (29 == a1[1][6])) / 4);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v0 = (((v1 <= a1[2][4]) + (a0[7] * v0)) ? ((i2 || a1[2][8]) > (37 > v2)) : ((a1[2][12] * v3) ? (v3 && 0) : (a0[4] * a1[0][14])));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a0[0] = (((a0[0] < 98) > (i2 + v0)) / 2);
+                    a1[1][8] = (((v0 ? a0[14] : 38) && (a0[7] != i3)) != ((a0[8] < v3) <= (42 || 95)));
+                    v2 = (((a0[6] - 99) && (i2 ? i2 : a0[13])) || ((70 && v2) * (7 != a1[1][9])));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((12 + a0[13]) / 1) / 4);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v0 = (((a0[5] ? a1[0][15] : 73) / 9) - ((v1 - i4) + (23 ? 62 : a1[1][13])));
+        v1 = (((i4 + v3) != (v3 ? 23 : 26)) <= ((a1[2][12] == a1[1][14]) - (a1[1][4] ? v0 : 49)));
+        {
+            int i5 = 0;
+            do {
+                if ((i5 || 82) > 58) break;
+                a0[1] = (((v2 ? 50 : i5) ? (v3 == a1[0][0]) : (i5 && v1)) >= ((v3 > a1[2][3]) + (v0 <= a1[3][15])));
+                v3 = (((3 == v2) && (v2 - v1)) != ((i5 % 1) || (v3 != a0[6])));
+                v2 = (((v2 ? v2 : 88) >= (a1[3][4] / 9)) - ((84 == v2) <= (37 < a0[11])));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((62 || a1[1][9]) > 72) break;
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                if ((22 && v0) > 62) break;
+                a1[1][13] = (((a0[5] < 74) == (v3 && 11)) == ((v2 > a0[2]) && (i7 * a0[15])));
+                v0 = (((a1[2][11] != a1[2][13]) ? (v2 <= a0[2]) : (a0[2] * a0[7])) == ((i6 && i6) == (i6 - a0[5])));
+                a0[2] = (((a1[0][12] * v2) * (v3 > a1[2][1])) >= ((46 && a0[4]) ? (i6 > 92) : (i6 == a0[0])));
+            }
+            v2 = (((v2 / 4) || (v3 * i6)) - ((i6 + 54) / 5));
+            v1 = (((a0[10] - i6) >= (a0[6] || a0[13])) / 7);
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    return (((52 ? 59 : v3) < (v0 - v3)) * ((74 > v2) && (v0 ? a0[2] : a0[4])));
+}
+int main() {
+    return 0;
+}
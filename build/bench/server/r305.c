@@ -0,0 +1,202 @@
+int f0() {
+    int v0 = 84;
+    int v1 = 37;
+    int v2 = 73;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][3] = (((a1[2][10] <= v1) + (65 && 73)) - ((a0[0] ? v3 : a0[0]) ? (a1[1][14] >= v2) : (i0 % 5)));
+            v1 = (((a0[15] >= v0) ? (v0 || v1) : (v2 / 3)) <= ((v0 && a0[4]) - (v2 || 7)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a1[0][11] = (((56 || v1) ? (10 ? 61 : i0) : (a0[10] <= v2)) || ((a0[9] == 92) / 5));
+                    v2 = (((68 == 30) > (i0 - 82)) - ((a1[2][13] || 35) > (23 && a0[6])));
+                    v1 = (((i1 || a1[3][14]) < (44 >= a1[0][14])) + ((v0 ? v0 : a1[3][9]) < (a0[8] != v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a1[3][13] = (((20 != v0) || (v0 == v1)) > ((95 != a1[2][7]) + (v0 && v2)));
+            a0[2] = (((v1 - v3) / 3) * ((84 < v1) ? (v3 ? 42 : v1) : (a1[1][11] || v1)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v0 = (((a1[0][15] > a0[1]) < (v1 - 97)) || ((22 + i3) > (a0[4] || 27)));
+                a1[1][12] = (((a1[3][14] + v3) && (27 == 22)) ? ((i2 / 7) && (v3 ? i3 : v1)) : ((a0[14] - v3) - (v0 || 63)));
+                v2 = (((59 ? v2 : i2) + (v3 < v3)) != ((a1[1][5] || v1) * (77 % 2)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v0 = (((a1[0][6] - v1) ? (i4 > a0[10]) : (25 < 82)) || ((v2 > a1[0][13]) + (v1 && a0[8])));
+        v0 = (((83 == v3) - (v3 || 58)) && ((v0 || 21) > (v2 > v2)));
+        {
+            int i5 = 0;
+            while (i5 < 6) {
+                if ((i4 + v1) > 54) break;
+                v0 = (((11 && 88) * (i4 != v3)) + ((a0[3] % 8) != (a1[2][15] == 55)));
+                v1 = (((v0 >= 98) >= (a1[3][1] < a1[2][13])) / 6);
+                v0 = (((i5 >= v3) && (v0 ? i4 : 63)) > ((a0[1] == v3) % 5));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((v0 != i6) > 81) break;
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((85 != a1[0][9]) || (1 + 78)) < ((4 > v0) >= (v3 > 18)));
+                    v0 = (((v0 - a1[2][6]) == (78 || 86)) != ((i6 ? v2 : v2) < (v1 || v1)));
+                    v2 = (((v2 == v2) >= (i6 + i6)) == ((52 != i6) * (49 >= 36)));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            a0[13] = (((v2 + 74) ? (a1[3][7] / 5) : (13 == 48)) && ((a1[1][7] ? 34 : 65) * (i6 <= a0[1])));
+            a0[6] = (((v2 <= v2) && (30 / 3)) <= ((v3 + 18) || (v3 != a0[5])));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v2 && v0) && (a0[9] - v0)) <= ((v1 && 48) / 1))) {
+        v2 = (((v1 != v3) || (62 == v0)) != ((v3 - a0[7]) && (77 + v1)));
+        v2 = (((a1[2][2] <= v0) % 9) * ((v2 || 67) >= (88 % 3)));
+        v0 = (((a1[1][6] || v1) && (79 ? a0[7] : v3)) <= ((a0[12] <= v2) ? (v1 ? a1[3][8] : 16) : (v2 >= a0[8])));
+    } else {
+        v3 = (((v0 - v2) >= (56 * a1[3][10])) ? ((a0[15] + v3) > (v3 - v1)) : ((v1 ? 31 : 40) + (30 - a0[8])));
+        v1 = (((35 % 3) != (v0 < 77)) != ((8 + v3) > (v1 + v1)));
+        v2 = (((v2 && v2) / 5) + ((a1[1][1] && 88) * (v1 || v2)));
+    }
+    return (((v0 / 7) >= (a1[3][15] > a0[8])) != ((v1 * v1) ? (a1[1][0] % 2) : (v1 && 30)));
+}
+int f1() {
+    int v0 = 95;
+    int v1 = 69;
+    int v2 = 51;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v3 * 89) * (a0[2] != v1)) > ((v3 != v1) % 7));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v1 = (((v1 < a0[11]) < (v0 <= i1)) - ((v0 + a1[1][7]) && (i0 < 73)));
+                a1[1][5] = (((v3 == 28) % 5) < ((i1 == i0) ? (i0 + 77) : (i0 >= a1[3][12])));
+                a1[0][9] = (((a0[14] - a0[15]) + (v0 || a0[12])) % 1);
+                i1 = i1 + 1;
+            }
+        }
+        a0[5] = (((a0[15] && v2) || (i0 + a0[14])) || ((v3 >= i0) % 4));
+        v3 = (((a0[6] != a0[6]) * (v1 || v3)) < ((v3 > a1[3][1]) && (32 != 97)));
+    }
+    if ((((v2 >= v3) && (v1 ? a0[7] : v0)) && ((13 * a0[3]) * (44 <= a1[0][14])))) {
+        a1[1][12] = (((a1[0][10] == v1) ? (v3 ? v3 : v3) : (a1[0][5] ? 7 : a0[15])) == ((v1 ? v1 : v3) < (v2 < v2)));
+        v0 = (((2 || 12) / 1) ? ((a1[0][13] <= v2) == (a1[2][0] && a1[2][8])) : ((v2 % 3) != (v1 || v1)));
+        v1 = (((a0[8] <= v1) && (v2 - v2)) > ((v3 == 92) * (a0[11] <= v1)));
+    } else {
+        v1 = (((49 + v2) ? (v1 == v0) : (a0[2] < a0[8])) > ((v3 ? v1 : 88) ? (v3 / 1) : (v0 || a0[14])));
+        v1 = (((v2 ? 3 : v3) > (v0 / 9)) % 7);
+        v0 = (((v0 && v2) - (v0 + 92)) < ((v3 < a0[15]) ? (53 < a0[7]) : (v2 * v0)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v0 = (((66 ? 76 : 29) % 1) / 6);
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            if ((63 ? v0 : i2) > 69) break;
+            a0[0] = (((51 - 12) ? (v3 <= i3) : (a0[13] && a0[15])) + ((a1[1][5] / 6) + (a0[4] > a0[12])));
+            v3 = (((v2 && i2) >= (v1 + 35)) <= ((4 && v3) % 2));
+            v1 = (((v2 > a1[1][14]) <= (a0[14] * i3)) - ((i3 <= i3) >= (21 || v2)));
+        }
+        v1 = (((v2 - 26) % 1) && ((95 || a1[3][3]) >= (v0 ? 5 : 86)));
+    }
+    if ((((40 / 9) >= (a1[2][2] == a1[3][12])) > ((v2 || v1) % 2))) {
+        v2 = (((v3 || 63) ? (v3 ? 12 : v3) : (21 && v0)) < ((v3 ? v2 : 76) || (92 == v3)));
+        a0[12] = (((v1 * a0[5]) - (v0 + 90)) % 6);
+        v0 = (((v3 - a1[0][14]) ? (v1 <= 10) : (v3 != 61)) - ((v3 * 78) ? (11 && 18) : (37 || 75)));
+    } else {
+        a0[0] = (((37 && v0) >= (v0 > a0[2])) ? ((v3 == 32) == (50 / 4)) : ((v0 + v1) >= (40 >= 66)));
+        v2 = (((v1 != a0[9]) + (v1 % 4)) == ((v0 || v1) / 7));
+        v1 = (((32 ? 48 : v0) - (v3 || v0)) < ((v2 || a0[0]) || (v1 - a0[10])));
+    }
+    return (((v2 - v1) - (a1[0][13] / 2)) < ((a1[2][9] % 2) != (v2 <= v2)));
+}
+int f2() {
+    int v0 = 59;
+    int v1 = 1;
+    int v2 = 96;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v2 = (((v1 < i0) != (v1 ? v3 : v0)) ? ((20 % 7) >= (67 < v1)) : ((a1[3][8] && a1[2][6]) || (99 <= i0)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((95 == 20) > 89) break;
+                v0 = (((v3 * 55) - (v1 + i1)) < ((58 / 5) * (a1[3][14] % 6)));
+                v3 = (((8 / 7) && (43 < v2)) == ((44 != v2) < (a0[15] / 8)));
+                v0 = (((21 + a1[3][2]) || (i1 ? 31 : a0[1])) || ((v1 + a1[0][12]) ? (1 % 3) : (v2 >= v1)));
+            }
+            a1[2][10] = (((v0 || v3) / 3) ? ((a0[1] && v0) && (a1[2][10] || v1)) : ((v2 - i0) > (59 <= 57)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v1 = (((v0 - v3) ? (a0[9] <= v1) : (64 && 58)) >= ((v3 >= 69) + (a1[2][13] ? a1[0][2] : a1[0][2])));
+            v2 = (((v3 != a0[10]) % 1) % 5);
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                if ((a1[2][13] >= v3) > 99) break;
+                v0 = (((91 != 31) ? (a1[3][11] - v2) : (v2 % 9)) == ((v2 ? v2 : v0) && (v0 ? i2 : a0[14])));
+                v2 = (((v0 == v1) < (v3 / 8)) >= ((44 / 9) / 8));
+                a1[1][14] = (((i2 ? 42 : v1) >= (v2 || a1[0][8])) + ((a0[0] + a1[0][1]) || (64 < i2)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[7] ? 87 : a0[5]) != (a1[1][6] / 8)) + ((a0[2] || a0[11]) ? (a0[5] % 4) : (a0[9] < v1)))) {
+        v0 = (((92 - a1[0][6]) % 6) >= ((v1 + v1) - (v0 <= v0)));
+        v3 = (((v3 > 83) || (55 ? v1 : v1)) * ((a0[11] == v0) && (9 > 34)));
+        v3 = (((42 / 1) && (v1 && 94)) || ((v1 <= v0) * (13 == 44)));
+    } else {
+        v2 = (((a0[3] && v2) / 4) * ((79 / 6) / 7));
+        v0 = (((v1 + 68) && (a0[10] && a1[3][1])) || ((a1[2][6] - v0) && (31 >= 21)));
+        v3 = (((90 == a0[7]) || (a0[10] <= 20)) ? ((89 / 8) + (a1[1][14] > a0[14])) : ((v2 + v1) == (v2 > a1[3][1])));
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a0[9] = (((v1 / 9) + (v0 ? v3 : v3)) - ((v2 >= v2) == (v3 != 25)));
+        v3 = (((v1 <= 87) >= (v0 < 24)) == ((v2 / 2) ? (v3 >= v0) : (v1 || 6)));
+        {
+            int i5 = 0;
+            do {
+                a1[2][1] = (((a1[1][8] ? v3 : 20) >= (7 * v0)) % 9);
+                v3 = (((v2 ? 4 : a0[12]) >= (a0[13] % 5)) < ((v1 ? i4 : 97) + (i5 + a0[0])));
+                v2 = (((v2 + a0[5]) != (a1[0][12] != 83)) ? ((i5 == 8) != (a1[2][4] - 24)) : ((v3 == 82) / 9));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+    }
+    if ((((21 + a0[7]) - (a1[0][12] % 2)) <= ((a1[3][2] == v2) >= (a0[5] ? v2 : v0)))) {
+        a0[1] = (((a0[2] == v0) ? (v2 - 9) : (v0 - v3)) || ((v0 * v2) >= (a0[12] ? 52 : a0[6])));
+        a0[4] = (((9 % 5) ? (a0[15] ? v3 : 68) : (a1[3][2] || 7)) * ((a0[5] ? 75 : v3) > (v3 ? v3 : 55)));
+        v2 = (((v0 + a0[7]) + (83 ? v3 : v0)) || ((a1[2][5] || 27) % 9));
+    } else {
+        v1 = (((a0[8] < a0[2]) * (a0[4] && 42)) <= ((a1[1][13] > a0[15]) != (a0[11] < 43)));
+        a1[3][13] = (((v3 - 96) != (v3 || v1)) ? ((v3 || v2) > (a0[11] || v2)) : ((a1[1][3] || v1) + (a0[2] != a1[2][2])));
+        a0[11] = (((v3 || v3) && (72 != a1[0][1])) % 5);
+    }
+    return (((v1 ? v2 : 31) % 1) || ((v1 + v0) == (a1[0][1] / 4)));
+}
+int main() {
+    return 0;
+}
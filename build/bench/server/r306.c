@@ -0,0 +1,69 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 33;
+    int v2 = 20;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            a1[1][14] = (((a0[15] < 92) * (24 > a0[1])) >= ((15 ? v2 : i0) ? (v1 == 1) : (v1 || v3)));
+            a0[0] = (((v2 > 1) > (a0[8] + a1[0][4])) * ((66 % 2) == (v0 != v3)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a0[5] = (((i1 ? 88 : 93) * (a1[2][14] < v3)) && ((v1 && a0[9]) || (v2 + 61)));
+                    v3 = (((a1[1][11] >= a1[3][12]) || (v3 < i1)) == ((i1 ? 0 : a1[1][14]) || (v1 ? 64 : 23)));
+                    a0[8] = (((a1[0][10] < v1) >= (v3 + i1)) != ((v2 % 4) >= (v2 && 67)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v3 = (((97 != i2) || (v3 % 3)) % 5);
+                v3 = (((v2 != a0[14]) + (36 >= 57)) - ((a0[7] > 24) / 4));
+                a0[8] = (((67 <= a1[2][12]) + (a0[4] - v0)) - ((73 || a0[13]) >= (v3 / 5)));
+            }
+            a1[3][9] = (((53 - a0[5]) >= (v2 ? 3 : a1[2][15])) > ((v2 * a1[0][15]) <= (v2 <= 50)));
+            v0 = (((i2 - v2) == (a1[2][11] == v0)) && ((a1[3][12] != v3) == (v1 ? v3 : 87)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[1] = (((87 + v1) ? (a1[0][2] / 1) : (63 || v1)) * ((i4 % 4) <= (i4 && i4)));
+            a1[1][1] = (((v1 <= a0[14]) != (69 % 2)) <= ((47 != 96) >= (i4 <= v0)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a1[1][13] = (((91 % 3) ? (v3 != i4) : (a0[9] <= 45)) - ((v1 - 63) - (v1 || 51)));
+                v3 = (((a1[3][8] <= 98) || (42 || v2)) > ((v2 >= a0[1]) * (v3 * 41)));
+                a0[2] = (((i5 * 51) ? (a0[1] || 37) : (i5 >= a0[11])) ? ((v0 >= v2) <= (v0 / 7)) : ((v0 <= 84) != (81 ? v3 : a0[13])));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    a0[4] = (((a0[10] - a1[2][13]) == (a1[2][14] < a1[2][1])) - ((v1 >= v2) <= (v3 >= v0)));
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v2 = (((59 ? v0 : i7) ? (i7 % 8) : (18 < a1[1][1])) + ((a1[2][3] <= v3) == (v2 <= a0[12])));
+                a0[6] = (((v0 % 4) ? (v2 < a0[7]) : (v2 != 94)) >= ((a1[2][11] && 3) % 8));
+                v1 = (((v2 == v1) >= (v0 ? a0[4] : i7)) < ((v2 - 57) != (a1[0][13] >= i7)));
+                i7 = i7 + 1;
+            } while (i7 < 8);
+        }
+        a1[3][10] = (((v1 < 79) + (86 >= v0)) / 7);
+        v1 = (((v3 && 67) <= (v1 != 50)) && ((17 && 9) <= (95 > v3)));
+    }
+    return (((v3 < 13) + (94 / 7)) == ((78 / 1) < (a0[12] >= a1[0][13])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,123 @@
+int f0() {
+    int v0 = 51;
+    int v1 = 30;
+    int v2 = 1;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    a1[3][15] = (((a1[0][11] == v2) * (39 ? 8 : v1)) ? ((a1[1][15] < v1) >= (v0 == 43)) : ((v3 && 34) && (8 / 4)));
+    {
+        int i0 = 0;
+        do {
+            if ((v0 - v1) > 79) break;
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[10] || i1) > 55) break;
+                    v0 = (((v0 && v3) != (v1 < 76)) != ((6 / 4) / 7));
+                    a1[2][3] = (((a1[2][0] || 49) / 5) < ((a1[0][4] * 81) - (i0 + 96)));
+                    v2 = (((i0 ? i0 : 49) < (a0[4] || a0[1])) == ((v1 != a0[1]) + (12 >= a1[3][4])));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v2 = (((v1 * v2) != (a1[2][4] % 6)) - ((v1 && v0) && (v1 - a1[3][8])));
+            v0 = (((i0 / 6) != (a0[10] > a1[0][9])) <= ((v2 <= v0) != (a0[0] == i0)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((51 == v3) * (v3 % 8)) * ((v2 || 68) - (v2 <= a0[2])))) {
+        a1[1][3] = (((v3 >= v3) % 4) < ((v3 >= 79) != (v3 && v0)));
+        v2 = (((62 > a1[2][15]) + (45 - a1[3][8])) != ((v0 ? v3 : 23) - (1 + a1[0][6])));
+        v0 = (((77 && v3) > (v2 || a1[3][0])) ? ((47 % 3) % 3) : ((40 / 2) <= (55 / 6)));
+    } else {
+        v1 = (((v2 > v0) * (v1 || a1[1][10])) - ((v3 > 0) + (v2 / 8)));
+        v2 = (((13 <= 4) <= (v0 > v0)) && ((v3 + 67) - (a0[15] ? v3 : 67)));
+        a1[1][3] = (((a0[2] <= v3) || (v0 * 71)) < ((90 >= v2) > (6 >= 56)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v0 / 4) > 53) break;
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((58 * v0) >= (a0[7] ? v3 : 39)) * ((v2 != a0[4]) * (84 > v0)));
+                    v1 = (((v0 >= v1) - (v3 * i3)) && ((v3 * a0[0]) < (a1[0][12] || 66)));
+                    v2 = (((88 == 33) ? (55 + a0[11]) : (v2 >= 75)) > ((v2 < i2) + (16 >= v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((a0[14] % 5) && (i2 ? i2 : i2)) == ((a1[0][10] == i2) % 6));
+            v0 = (((v3 || a1[3][8]) <= (a0[6] >= a1[0][10])) + ((v1 == v1) * (v3 || 51)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v1 = (((16 <= v0) != (v1 < v0)) == ((a1[3][11] / 8) <= (a0[7] || v3)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v1 = (((v2 ? i5 : 49) && (59 + 71)) > ((v2 - a0[8]) / 9));
+            v3 = (((i4 ? 2 : i5) % 4) && ((30 && i4) && (v2 * v1)));
+            v3 = (((79 <= a1[0][11]) >= (v0 - a1[3][8])) >= ((a0[7] > v3) ? (i4 <= v3) : (i5 > a0[15])));
+        }
+        v0 = (((v3 % 9) % 9) ? ((i4 ? v3 : a1[1][3]) < (v3 == i4)) : ((a0[5] / 3) * (a1[3][15] >= i4)));
+    }
+    return (((v3 - v0) * (v1 < v0)) <= ((99 / 9) + (v1 / 8)));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 82;
+    int v2 = 51;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 % 3) / 9) || ((75 * v1) == (82 / 4)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v0 = (((v3 == a1[1][8]) == (i0 < 47)) == ((i0 < v0) + (a0[6] % 8)));
+                    a0[11] = (((a1[3][13] < 26) && (v1 ? i0 : i0)) && ((v3 - v1) || (a0[15] * v0)));
+                    v3 = (((i0 ? a0[6] : a1[0][4]) + (v3 != v1)) >= ((v3 == i1) ? (v1 == a1[2][6]) : (v2 < 84)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v0 || 64) ? (a0[8] && v3) : (a0[3] % 4)) > ((a1[1][12] / 1) ? (83 >= a0[6]) : (v3 / 8)));
+            v3 = (((70 / 2) / 3) > ((v0 <= 53) + (24 <= v3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((60 ? a1[0][7] : v0) > 65) break;
+            v0 = (((90 <= v2) % 4) / 7);
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a1[1][9] = (((v2 ? a1[3][7] : 90) ? (v1 + 33) : (i2 != a0[6])) != ((a1[0][4] && v3) != (a1[3][14] >= i3)));
+                    v0 = (((i2 || v0) || (i2 && 5)) * ((a0[13] >= a1[2][0]) - (a1[1][14] >= v0)));
+                    a0[14] = (((v1 < i3) + (50 != i2)) || ((36 * 31) <= (38 < a1[3][13])));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((a1[3][10] < v3) <= (43 != a0[12])) / 7);
+            i2 = i2 + 1;
+        }
+    }
+    a1[1][6] = (((a0[3] > a1[1][13]) * (v3 + v2)) * ((v1 >= a1[1][13]) / 5));
+    if ((((v3 < 45) - (v2 * v1)) >= ((v2 ? a0[7] : v0) > (v0 < v2)))) {
+        v0 = (((3 > v2) ? (18 ? a0[3] : a0[5]) : (v1 % 5)) % 8);
+        a0[14] = (((22 <= a0[2]) > (a1[0][3] ? v2 : 34)) < ((v2 <= a1[1][6]) ? (v0 ? 70 : v3) : (v1 == a0[13])));
+        a1[0][11] = (((v3 == a1[0][5]) ? (v2 && v0) : (a1[2][2] < v2)) || ((55 + v0) && (a0[1] && 54)));
+    } else {
+        v2 = (((68 % 9) - (v3 != a1[3][10])) <= ((16 ? v2 : 44) / 2));
+        v2 = (((v2 >= v3) - (a1[1][3] < 15)) && ((v2 / 7) >= (15 >= 89)));
+        v0 = (((a0[14] || v1) * (v0 == 47)) && ((a1[1][14] - 61) < (v1 - v1)));
+    }
+    return (((21 ? v2 : a1[2][0]) != (v2 ? v2 : 31)) * ((v1 ? v3 : 61) <= (a1[2][14] && 12)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,184 @@
+int f0() {
+    int v0 = 45;
+    int v1 = 99;
+    int v2 = 12;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v2 = (((55 ? 51 : 60) != (v0 <= 66)) - ((i0 == a0[8]) ? (v2 <= 91) : (a1[2][7] && 18)));
+        a0[2] = (((a1[3][7] || v1) != (v0 / 6)) >= ((v1 && v3) ? (v3 && a0[12]) : (40 <= v3)));
+        {
+            int i1 = 0;
+            do {
+                v2 = (((v1 >= v2) / 2) + ((a0[7] % 3) != (a0[10] != v1)));
+                v0 = (((v3 < 73) + (v1 % 4)) >= ((a0[12] ? a1[2][6] : v3) % 3));
+                a1[1][0] = (((i0 != v3) >= (v2 - v1)) >= ((57 * i1) && (i1 + a0[15])));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((v0 >= v0) - (36 || a1[0][1])) && ((v1 == v1) + (v0 || 6)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a0[0] = (((v2 >= i2) || (i2 - 68)) ? ((v3 == 67) % 5) : ((v0 % 1) + (i3 % 6)));
+            v0 = (((89 / 8) / 1) && ((v3 ? i3 : 81) <= (v3 % 9)));
+            v3 = (((i2 || v1) <= (v3 % 6)) ? ((i3 + a1[3][12]) || (a0[6] ? v3 : v2)) : ((4 % 5) / 9));
+        }
+        v1 = (((a0[12] && a0[12]) >= (a0[13] > v2)) < ((38 * a0[12]) != (v3 <= 71)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((i4 && v3) && (i4 ? 83 : v0)) ? ((v1 / 9) + (v3 % 9)) : ((v0 - a0[0]) % 7));
+            v2 = (((v1 < v3) / 8) < ((v3 == v2) || (3 <= v0)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v1 = (((47 >= 84) + (i4 && 81)) <= ((43 ? v0 : i4) - (a0[10] / 9)));
+                a1[0][10] = (((v0 <= a0[12]) - (a1[0][10] <= i4)) && ((i5 + i5) / 8));
+                v1 = (((i5 % 1) >= (i5 == v2)) * ((i4 <= i5) >= (v1 != 74)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        do {
+            v0 = (((v0 * v1) || (1 != v2)) ? ((v2 == v1) ? (a1[2][7] % 3) : (v2 <= v2)) : ((a1[2][15] == 54) == (v0 || v2)));
+            a1[0][10] = (((v1 != v0) < (i6 / 2)) + ((97 - v3) / 7));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    if ((85 + v0) > 88) break;
+                    v1 = (((v1 != a1[2][15]) < (a1[0][2] ? 50 : v1)) < ((a1[0][2] + 31) <= (v3 * i6)));
+                    v2 = (((a0[8] >= v0) != (i7 % 1)) ? ((94 * v3) < (v2 % 7)) : ((42 && v1) && (a0[0] * i6)));
+                    v2 = (((a0[8] == 84) ? (34 > v3) : (82 <= 13)) - ((a1[1][11] < v0) - (a0[13] <= v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    for (int i8 = 0; i8 < 3; i8 = i8 + 1) {
+        if ((a1[0][3] != 38) > 79) break;
+        {
+            int i9 = 0;
+            while (i9 < 6) {
+                a0[9] = (((a1[0][2] != i9) ? (28 && v1) : (v3 % 6)) ? ((15 + a1[3][6]) % 6) : ((v3 && 43) >= (i8 == v0)));
+                v3 = (((a1[3][15] % 5) ? (a0[7] ? v2 : v1) : (v1 && v0)) % 2);
+                v0 = (((i9 || i8) ? (27 && v2) : (a0[8] ? 80 : v2)) * ((v3 > v3) / 2));
+                i9 = i9 + 1;
+            }
+        }
+        v2 = (((a1[1][14] < i8) > (a0[1] % 5)) > ((v0 > 95) ? (43 == a1[3][11]) : (a1[3][14] > i8)));
+        v2 = (((a1[3][9] < i8) * (a1[2][12] > v3)) * ((v3 && 74) < (v0 / 5)));
+    }
+    return (((v1 ? 32 : v0) ? (v1 <= a0[4]) : (v1 > a0[1])) <= ((v2 <= a1[3][15]) > (v0 || v0)));
+}
+int f1() {
+    int v0 = 5;
+    int v1 = 7;
+    int v2 = 31;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v1 = (((v1 >= a1[0][11]) >= (a0[3] >= a0[3])) || ((i0 - a0[10]) ? (v2 + a0[10]) : (24 ? v0 : i0)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                if ((a0[5] <= 73) > 81) break;
+                a1[0][6] = (((61 && v1) * (30 / 2)) ? ((i0 % 1) != (a0[2] != 54)) : ((v3 % 5) / 2));
+                a0[4] = (((a0[12] < 21) / 8) > ((i1 - a1[2][2]) <= (a0[6] == v0)));
+                v2 = (((v0 % 2) > (a0[4] >= a1[2][13])) >= ((v0 > v0) + (a0[10] / 7)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((v2 || 36) < (v0 + a1[2][10])) * ((v0 <= 50) ? (41 >= v3) : (a1[0][10] && i0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v2 = (((v2 || v0) ? (24 >= i2) : (a0[8] || v3)) % 2);
+                a1[3][8] = (((v1 + 36) / 6) ? ((v2 <= v0) && (a0[7] * v2)) : ((a1[2][10] > 55) * (v1 % 1)));
+                v2 = (((v1 ? v1 : v3) ? (8 != v2) : (30 / 7)) <= ((v1 ? 59 : 15) % 4));
+            }
+            v3 = (((30 + v1) / 2) == ((a0[15] >= 3) / 8));
+            v3 = (((i2 % 5) - (v1 % 3)) ? ((v3 && i2) && (23 % 3)) : ((i2 > v0) >= (a1[3][4] ? v2 : v2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v3 = (((90 > a1[3][5]) / 7) == ((v0 - 47) * (a0[14] * 31)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v2 = (((a1[1][14] > a1[3][13]) / 2) / 9);
+                v0 = (((a0[13] * 61) * (v3 ? i5 : a0[8])) == ((a0[0] / 8) <= (a1[3][0] * 59)));
+                a0[14] = (((v2 + 14) && (v2 ? a1[3][3] : v2)) ? ((73 <= i4) ? (96 < v2) : (v0 % 2)) : ((i5 >= a0[3]) % 4));
+            }
+            v2 = (((a1[3][6] * v1) && (v3 + v2)) || ((31 >= v2) - (v1 == 37)));
+            i4 = i4 + 1;
+        }
+    }
+    a0[5] = (((46 <= v3) < (1 + a1[1][10])) > ((v1 != 80) + (v0 || 59)));
+    v0 = (((a1[0][11] + 22) == (a0[5] <= 2)) && ((a0[12] - a0[7]) < (v2 != 38)));
+    return (((92 - v3) == (v0 || a1[2][15])) > ((a1[1][0] != v0) % 7));
+}
+int f2() {
+    int v0 = 98;
+    int v1 = 93;
+    int v2 = 77;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a0[10] = (((i0 && v2) * (i0 && i1)) <= ((v2 ? v0 : v0) <= (a1[2][14] <= v0)));
+            v3 = (((i1 >= a0[14]) - (v2 == v1)) <= ((v1 ? i0 : a1[2][1]) ? (i0 && 80) : (a0[15] < a0[9])));
+            v0 = (((a0[11] <= v0) - (i0 * v3)) || ((2 + v0) <= (a1[1][12] % 1)));
+        }
+        a0[11] = (((i0 > a1[3][8]) || (v2 >= a1[1][1])) || ((a0[10] * a0[1]) / 7));
+        a0[9] = (((v2 + a0[2]) != (a1[3][2] ? 3 : 9)) + ((15 ? v1 : v3) ? (a0[8] < v1) : (99 < a0[12])));
+    }
+    if ((((v0 || v3) <= (a1[3][14] ? v3 : a0[5])) + ((62 > 12) * (v2 * v3)))) {
+        a0[0] = (((a0[12] % 4) == (26 * 84)) % 9);
+        v2 = (((v3 < a1[1][6]) >= (v2 >= a0[3])) < ((v3 && v3) < (13 - v0)));
+        a1[2][8] = (((39 % 5) - (60 * v2)) >= ((v3 - 43) > (a0[11] > v1)));
+    } else {
+        v2 = (((50 || v1) > (v3 ? 34 : a0[9])) - ((v1 % 6) < (a1[0][5] > v0)));
+        v0 = (((v2 || 19) || (99 <= 48)) || ((v2 + a1[3][9]) ? (a1[1][3] != 14) : (a0[7] != v1)));
+        v1 = (((73 - a0[15]) && (v0 == v1)) != ((a0[8] != v0) < (60 <= v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v0 = (((50 <= a0[5]) == (v3 >= a0[2])) || ((a0[6] % 2) != (v2 <= 67)));
+                    v2 = (((v3 ? v0 : v1) / 1) % 6);
+                    v0 = (((a1[3][4] + v3) * (i3 > v0)) - ((v0 || a0[3]) % 4));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[0][10] = (((55 - v3) != (i2 > v3)) ? ((v0 && a0[11]) != (v0 >= 51)) : ((a0[0] >= i2) - (12 ? 60 : v0)));
+            v1 = (((a0[5] * v2) + (90 - 43)) == ((i2 || 62) % 9));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a1[1][2] = (((a0[6] + v2) <= (89 ? 25 : i4)) * ((v2 - 79) >= (i4 < a0[5])));
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            v1 = (((a1[2][3] < a1[3][2]) || (i4 <= i4)) > ((a0[0] >= 45) / 3));
+            v1 = (((a0[12] || i4) * (a1[2][0] != v3)) ? ((v3 < 10) - (v3 ? a1[0][12] : i4)) : ((79 != i4) ? (a1[0][10] * 88) : (v0 ? a1[0][12] : i5)));
+            v1 = (((a0[8] / 3) * (18 + v3)) || ((78 > i5) - (a1[3][10] ? v1 : 58)));
+        }
+        v0 = (((i4 == 90) ? (a1[3][9] >= a0[9]) : (74 == v3)) >= ((v1 * i4) <= (i4 - v0)));
+    }
+    v3 = (((a1[2][4] <= a0[3]) + (26 < 43)) % 1);
+    return (((a1[1][4] == v3) > (v0 * v3)) * ((a0[4] > a1[3][5]) ? (54 || v1) : (v2 <= v2)));
+}
+int main() {
+    return 0;
+}
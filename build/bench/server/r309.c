@@ -0,0 +1,66 @@
+int f0() {
+    int v0 = 46;
+    int v1 = 64;
+    int v2 = 16;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v0 = (((i0 >= 10) && (i1 <= v1)) >= ((a0[7] % 9) <= (v1 ? v2 : i0)));
+            a0[8] = (((v1 ? i1 : 62) <= (a0[4] && i1)) > ((a0[1] >= v1) >= (i1 || v2)));
+            v3 = (((57 || 77) != (43 <= v3)) || ((i0 < a1[1][8]) + (v0 - v3)));
+        }
+        v3 = (((v0 == 21) || (59 / 1)) && ((73 - i0) <= (v2 < 56)));
+        a1[3][4] = (((50 <= 33) || (v2 <= v3)) + ((v2 >= a0[7]) >= (a0[10] && v3)));
+    }
+    a1[3][0] = (((16 <= v0) % 4) != ((34 < a1[1][9]) >= (a0[7] ? 29 : v2)));
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a0[7] + a0[15]) != (a0[14] != i2)) != ((v0 % 4) != (v3 >= v3)));
+            v1 = (((76 && a0[9]) > (86 < 10)) < ((v0 <= v0) != (a1[1][10] && 20)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((33 + a1[0][15]) > 67) break;
+                    a1[2][14] = (((6 % 4) % 4) <= ((a1[2][2] - a1[0][8]) > (88 && v1)));
+                    v3 = (((i2 > a1[1][14]) >= (v1 != v1)) % 6);
+                    v0 = (((v3 <= 11) ? (a1[2][9] ? v2 : v0) : (a1[1][7] + v1)) && ((v2 >= i2) < (v0 ? v0 : i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v1 = (((v3 && v2) || (i4 || 2)) > ((28 || a1[1][6]) % 7));
+            v3 = (((v3 && v2) < (v3 || 35)) && ((a1[2][4] >= v1) / 9));
+            {
+                int i5 = 0;
+                do {
+                    a0[15] = (((v1 < 50) >= (34 % 2)) + ((16 || 65) != (v2 * 90)));
+                    v1 = (((i5 ? v2 : a0[15]) || (48 * v1)) / 9);
+                    v2 = (((33 ? a1[2][3] : 78) < (a1[3][9] % 8)) ? ((39 + i4) / 2) : ((a1[2][5] == a0[1]) && (v0 && 9)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 % 6) <= (v2 * 8)) <= ((v1 && 73) > (47 && v1)))) {
+        a0[14] = (((a0[0] > a0[11]) != (a0[14] && v2)) < ((v1 >= v3) && (91 / 1)));
+        v1 = (((18 >= v3) <= (57 ? v1 : a1[1][1])) == ((v0 < v3) ? (a0[9] < a0[15]) : (v1 == v0)));
+        v2 = (((v0 * 97) || (v0 || 45)) ? ((v3 % 9) && (31 / 7)) : ((a0[0] && v3) < (a0[5] ? v3 : v0)));
+    } else {
+        a1[0][11] = (((15 != v3) / 1) <= ((v1 > 12) < (a0[5] - a0[6])));
+        v3 = (((v2 - v2) - (v1 % 7)) / 4);
+        v0 = (((11 >= v2) || (v0 || 55)) ? ((v3 - a1[1][11]) && (v3 + a0[3])) : ((v1 ? a1[1][14] : v3) - (a1[0][1] < a1[2][6])));
+    }
+    return (((v1 < 69) == (v3 + v3)) || ((a0[15] == a1[1][12]) != (93 > 46)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,143 @@
+int f0() {
+    int v0 = 35;
+    int v1 = 63;
+    int v2 = 13;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a0[15] = (((a0[9] >= i0) + (i0 >= i0)) <= ((16 >= a1[2][13]) >= (v3 > a0[13])));
+        v2 = (((i0 == a0[0]) >= (a0[3] * v0)) > ((v2 * v0) < (a1[1][4] && 8)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v0 = (((v3 / 9) % 4) ? ((a1[3][1] - i1) >= (v3 && v0)) : ((a0[14] - v1) != (i0 % 7)));
+            a0[2] = (((v1 >= 5) || (v3 ? 50 : v0)) % 3);
+            v0 = (((a1[2][10] ? v3 : v1) <= (65 - i0)) ? ((i0 % 1) < (a0[0] ? 35 : i1)) : ((v2 > v2) == (i0 ? v3 : v1)));
+        }
+    }
+    if ((((v1 && a0[15]) && (v1 && a0[4])) < ((21 <= 4) != (v3 / 4)))) {
+        v1 = (((71 + a1[2][1]) >= (a1[0][6] && v3)) && ((a0[2] < v3) != (a0[0] ? a1[2][5] : 6)));
+        a0[14] = (((38 || a1[2][0]) ? (48 || v0) : (v1 ? v3 : a0[11])) && ((73 * a0[15]) < (v2 ? v1 : 12)));
+        v0 = (((v2 + v2) < (23 + 21)) >= ((19 > a0[6]) || (v0 != a1[1][11])));
+    } else {
+        v2 = (((65 != 39) == (v0 * v0)) || ((a1[3][10] || a1[1][4]) != (v1 == a0[15])));
+        a0[12] = (((v2 && v1) < (v0 == v0)) * ((v1 && v3) <= (26 - a1[3][5])));
+        a1[0][11] = (((v0 && 64) % 4) == ((a0[4] >= v3) > (v1 || v0)));
+    }
+    if ((((v0 != v0) ? (v2 / 9) : (v2 == a0[7])) != ((1 >= 37) <= (v3 != a1[2][6])))) {
+        a1[1][2] = (((v3 <= a0[14]) == (62 - a1[2][5])) ? ((a0[1] * a1[0][3]) && (a1[1][4] - 11)) : ((v2 < v0) != (a0[10] / 6)));
+        a0[4] = (((a0[8] + 61) <= (87 > 63)) % 1);
+        v0 = (((14 || v3) ? (v0 * v3) : (a0[8] > 72)) / 3);
+    } else {
+        v0 = (((a0[4] / 1) > (v3 % 9)) != ((a0[11] <= v1) == (45 > 69)));
+        a0[0] = (((v2 && v2) + (v0 * a0[10])) != ((v2 % 1) && (v0 < v2)));
+        v1 = (((v0 && a1[0][3]) ? (88 * v3) : (a0[6] / 8)) < ((97 >= a0[12]) <= (80 + 29)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a1[0][9] = (((v1 + i2) % 9) && ((a0[12] > v0) <= (i2 ? 41 : a1[1][6])));
+            a1[0][14] = (((v0 ? i2 : 79) <= (30 % 4)) ? ((39 != a1[3][11]) > (v3 <= v1)) : ((28 * i2) || (a1[0][6] - 66)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v0 = (((i3 ? v0 : v0) <= (12 == i3)) * ((v0 + a0[8]) / 3));
+                    a1[3][12] = (((a0[7] != i3) || (i3 >= a1[3][0])) + ((v3 != a0[4]) <= (v3 * a0[0])));
+                    v3 = (((i2 + a1[2][8]) >= (i3 != v2)) == ((v1 + i3) && (v0 <= 25)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v0 - 98) ? (v2 != v3) : (v0 ? 4 : 58)) ? ((49 * 98) || (a1[1][13] || v3)) : ((a0[4] || 47) ? (a1[3][13] * a0[15]) : (v2 / 2)));
+    return (((a1[0][5] && 60) / 1) || ((v3 || a0[10]) + (a0[7] || a0[1])));
+}
+int f1() {
+    int v0 = 54;
+    int v1 = 34;
+    int v2 = 32;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((v0 > v3) > 82) break;
+            a0[15] = (((39 ? i0 : v1) ? (v0 || 56) : (v1 - 22)) >= ((v3 >= v1) >= (a0[3] <= a0[7])));
+            v0 = (((0 ? 49 : a1[0][3]) ? (v3 ? 80 : v3) : (v2 + 41)) != ((3 * v2) % 8));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((81 + 75) && (a1[0][10] != 16)) <= ((i0 != i0) ? (2 - i1) : (a0[1] + 39)));
+                    v3 = (((94 || i1) || (99 + v1)) == ((78 % 4) >= (47 >= a0[8])));
+                    v2 = (((a1[3][7] - 32) ? (v2 ? v2 : a1[2][7]) : (i1 ? 70 : a0[12])) ? ((a0[15] - v0) ? (i1 != 15) : (i1 || v1)) : ((i1 <= a1[3][4]) % 3));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v0 = (((a1[2][2] >= v3) / 8) ? ((2 && v3) ? (a0[12] <= a0[9]) : (v3 == a1[2][8])) : ((v3 ? v2 : a0[2]) < (v1 * 8)));
+            v3 = (((a0[1] <= 40) <= (v3 <= v1)) ? ((11 <= a0[0]) && (a1[3][7] + a0[1])) : ((i2 * 4) ? (a1[0][10] && v1) : (30 != a0[5])));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v2 = (((v2 - v0) + (43 || v1)) >= ((a0[5] + a1[0][4]) <= (v0 < i2)));
+                    a1[0][1] = (((v0 ? v2 : v0) ? (v0 <= i2) : (v0 / 6)) && ((96 >= 28) == (v0 ? a0[6] : v3)));
+                    v0 = (((50 <= 54) - (v3 < a1[2][2])) >= ((v1 ? a0[1] : v1) || (92 > v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v3 = (((v0 < v2) != (9 == 58)) - ((92 / 9) - (46 < 97)));
+                    v1 = (((v3 % 6) ? (v0 * a1[1][1]) : (2 < 85)) >= ((a1[0][0] * v0) * (a1[2][9] >= i5)));
+                    v2 = (((a0[3] < i5) / 1) + ((0 == i4) != (v3 >= i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((v1 + 0) <= (v2 / 6)) + ((v2 < v2) != (a0[5] <= v1)));
+            v2 = (((v2 || 34) <= (v1 * a1[0][4])) && ((v0 <= a0[12]) || (33 ? v0 : v2)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    if ((((a1[1][12] - a1[2][9]) >= (68 / 6)) && ((35 <= a1[3][8]) ? (v1 - v2) : (v3 < v2)))) {
+        a1[0][5] = (((v1 != a0[4]) ? (v0 * 28) : (a0[5] % 5)) || ((18 >= a1[3][8]) + (v2 ? v1 : 51)));
+        v2 = (((a0[8] % 3) - (a1[3][13] < v1)) || ((a0[13] && v1) ? (v0 * v2) : (v2 > v1)));
+        v2 = (((v3 * v0) || (85 + a0[8])) <= ((v3 >= a1[3][8]) <= (98 && 45)));
+    } else {
+        v3 = (((v0 != v1) != (v0 ? 20 : v2)) || ((v2 + v0) >= (v2 - v1)));
+        v2 = (((v1 < v2) * (v1 / 1)) ? ((93 * v0) < (32 ? a1[2][4] : 78)) : ((v1 > a0[2]) && (23 + v3)));
+        a0[2] = (((48 % 8) + (70 || a1[0][10])) > ((a1[1][11] > v3) < (v1 > v1)));
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        v0 = (((v3 / 6) < (23 < v0)) >= ((a0[15] != v1) != (v3 > a1[2][11])));
+        {
+            int i7 = 0;
+            while (i7 < 3) {
+                v0 = (((a0[14] && 76) / 2) != ((v1 || i6) * (37 ? i7 : 90)));
+                a1[1][15] = (((a0[8] < 81) % 2) / 8);
+                v0 = (((84 > a1[3][5]) != (64 == v1)) <= ((i7 && v1) ? (v2 == a1[2][13]) : (i6 >= 54)));
+                i7 = i7 + 1;
+            }
+        }
+        a0[3] = (((a1[1][13] + v1) ? (42 ? i6 : a0[4]) : (v1 > v0)) >= ((a1[2][2] * v1) * (54 - v2)));
+    }
+    return (((v0 && a0[2]) > (v2 / 4)) == ((59 + v0) >= (86 - v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
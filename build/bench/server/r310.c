@@ -0,0 +1,89 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 36;
+    int v2 = 5;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((i0 % 4) > 63) break;
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                v1 = (((v0 > i0) && (v0 * v1)) + ((a0[15] > i0) || (a1[1][6] != 66)));
+                a1[0][4] = (((a1[2][3] + v1) + (v2 <= i0)) || ((a1[0][12] % 3) * (a0[5] ? a1[0][3] : 7)));
+                v2 = (((v1 == 82) ? (v2 && 17) : (v2 ? v1 : i0)) || ((i0 ? a1[3][10] : 9) || (v1 + 80)));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((v0 && i0) % 6) < ((52 && a1[3][12]) ? (v3 ? v1 : 85) : (v1 > v0)));
+        a0[8] = (((47 * 72) <= (50 * v2)) % 2);
+    }
+    a0[3] = (((v1 * v0) == (a0[15] + a1[3][4])) == ((v0 <= a0[1]) / 6));
+    if ((((v0 ? 44 : v0) > (v3 == v0)) == ((17 >= 59) ? (v1 || 10) : (a0[8] != 8)))) {
+        a0[2] = (((21 == v3) < (a1[1][12] != v3)) != ((a0[5] < v1) <= (v3 * 35)));
+        a1[1][1] = (((5 < a1[2][9]) <= (38 * v2)) * ((89 * v0) + (a1[1][3] * a0[6])));
+        v0 = (((v1 % 8) == (39 + v0)) - ((a0[5] * v3) * (v2 >= v1)));
+    } else {
+        v1 = (((v3 == v1) ? (v1 + a0[10]) : (v3 / 2)) - ((v0 || 58) == (v0 * a0[6])));
+        v2 = (((a0[8] == v0) > (v2 == 45)) || ((56 > a0[15]) * (v1 && v3)));
+        v0 = (((v0 ? v1 : a0[14]) / 1) < ((v0 > v0) && (39 && a0[6])));
+    }
+    v1 = (((v3 >= a0[10]) ? (v0 <= v3) : (35 + 31)) || ((a1[2][5] + a1[0][5]) == (v3 + v2)));
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((v1 % 2) > 64) break;
+            a0[1] = (((v3 / 8) || (a0[1] != 91)) && ((i2 % 6) / 7));
+            v2 = (((51 > i2) >= (v0 >= v0)) * ((v1 >= a1[2][10]) % 5));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v3 = (((50 / 6) ? (i2 < a1[0][6]) : (v2 || v2)) > ((i3 % 9) + (a1[3][10] / 5)));
+                a0[2] = (((4 + i3) <= (v3 <= v0)) == ((i2 == v2) <= (55 < v1)));
+                v1 = (((32 > 34) >= (v0 < a0[7])) < ((i3 ? i2 : a1[0][2]) && (a0[9] ? i2 : 80)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((a0[11] >= v2) == (v1 >= v1)) ? ((v0 - v3) < (33 % 4)) : ((v0 + v2) && (69 >= a1[0][1])));
+}
+int f1() {
+    int v0 = 61;
+    int v1 = 79;
+    int v2 = 94;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    a1[3][3] = (((12 <= 96) > (40 == v3)) - ((a0[5] * v2) == (v2 == v3)));
+    v3 = (((a1[1][1] || v0) != (v0 != 17)) ? ((24 / 5) == (a0[5] == a0[1])) : ((v2 ? v2 : a0[9]) && (v1 > 28)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a1[2][10] = (((v0 ? v0 : v0) + (81 / 8)) + ((v3 || v1) == (v0 / 5)));
+        v3 = (((v0 <= v3) || (i0 <= 51)) || ((i0 >= v0) >= (10 * 67)));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v0 = (((73 <= v3) && (i0 >= v0)) / 3);
+                v3 = (((a0[7] ? 0 : v3) <= (a1[1][12] && v0)) % 4);
+                v2 = (((v3 && i1) ? (v3 < i1) : (a0[5] / 3)) + ((v2 ? i0 : v3) > (73 != v3)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[0][14] = (((a0[1] <= 33) + (v3 - i2)) > ((v2 - a0[5]) >= (v0 == a0[15])));
+            v2 = (((v0 > v0) >= (v1 / 3)) < ((v1 && 89) < (i2 ? v0 : i2)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v2 = (((34 / 2) <= (i3 >= v0)) < ((i2 / 9) % 7));
+                a0[14] = (((v2 != 83) * (82 ? v1 : a1[3][4])) >= ((v0 % 8) - (v0 == a0[11])));
+                v2 = (((v3 / 6) != (i2 - 70)) || ((a1[0][15] + v0) + (i2 % 4)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    a0[14] = (((a0[10] <= a1[3][9]) <= (a1[0][8] * a1[1][15])) ? ((v0 + 4) ? (v1 * a1[0][4]) : (v0 <= v0)) : ((a0[4] || a0[13]) >= (93 && 84)));
+    return (((v0 < a0[15]) * (a1[0][0] != a0[5])) % 6);
+}
+int main() {
+    return 0;
+}
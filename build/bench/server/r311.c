@@ -0,0 +1,163 @@
+int f0() {
+    int v0 = 48;
+    int v1 = 40;
+    int v2 = 95;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[6] = (((v1 < 49) == (a1[1][8] || v1)) > ((v0 == v0) > (a1[3][0] * v3)));
+            v3 = (((v2 != v3) < (99 / 5)) > ((a0[15] % 6) * (a1[1][12] <= v3)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[12] >= a1[1][5]) > 56) break;
+                    a0[0] = (((v0 * 1) / 5) < ((v1 || a0[8]) < (46 != 99)));
+                    v3 = (((v1 >= 21) - (98 / 4)) > ((a0[8] >= a1[1][1]) ? (v0 == v3) : (43 && i1)));
+                    a0[7] = (((v0 || i1) || (a0[4] >= 12)) > ((a0[9] ? a0[3] : i0) % 5));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((a1[2][12] / 9) == (a1[0][13] && 7)) >= ((31 + 11) < (v1 / 2)));
+    if ((((75 == v1) || (11 ? v1 : a0[1])) / 1)) {
+        a1[3][3] = (((v3 % 2) - (v3 != v2)) % 5);
+        v0 = (((98 * a1[0][14]) && (v3 ? v2 : 65)) - ((33 <= a0[11]) < (a1[1][13] + v1)));
+        v2 = (((23 + v0) || (v0 % 1)) % 6);
+    } else {
+        a0[4] = (((v3 || v3) ? (a0[5] > 67) : (v0 != v2)) - ((45 ? v2 : 24) - (v2 >= 58)));
+        v3 = (((v2 % 1) % 4) || ((a1[3][14] / 8) + (v1 ? a0[3] : a0[5])));
+        a0[12] = (((v2 * v0) < (v1 / 2)) % 9);
+    }
+    a0[8] = (((v0 > v1) <= (a0[8] < a1[1][0])) ? ((v2 != v0) == (50 - v2)) : ((v0 - 56) || (v0 / 2)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a0[13] = (((i2 || v1) && (v1 >= v1)) > ((v1 % 9) <= (i2 ? v3 : 45)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            if ((a0[7] / 4) > 60) break;
+            v1 = (((v2 || v1) / 5) > ((a1[0][10] ? v1 : 59) + (43 || i2)));
+            v1 = (((24 % 2) >= (v0 % 1)) > ((a1[2][15] && i3) > (v1 % 3)));
+            a1[1][8] = (((6 * v1) ? (a0[11] % 8) : (v2 - 18)) ? ((i3 + i3) != (78 ? v2 : v1)) : ((v0 >= i3) % 5));
+        }
+        v3 = (((96 % 1) <= (a0[8] % 8)) > ((a0[12] != 22) != (a0[15] != a0[6])));
+    }
+    return (((v2 < a1[2][12]) == (v3 - a1[3][10])) * ((a0[9] * 40) < (v3 == 81)));
+}
+int f1() {
+    int v0 = 67;
+    int v1 = 63;
+    int v2 = 25;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    if ((((81 > v1) ? (v1 < 64) : (a1[0][13] && v0)) + ((v0 != v0) == (46 == a1[2][6])))) {
+        a1[0][15] = (((v2 - v3) % 5) && ((v3 < 41) <= (65 != 88)));
+        v1 = (((a0[13] / 8) / 6) ? ((34 % 6) == (v0 > v1)) : ((a0[13] + 15) * (v1 % 6)));
+        a1[2][12] = (((v3 || v3) <= (v3 ? a0[5] : v1)) * ((v1 || a0[10]) % 6));
+    } else {
+        a0[15] = (((v1 / 8) + (v1 ? 19 : v2)) ? ((v0 >= v3) / 7) : ((a0[0] && v2) % 3));
+        v1 = (((a1[1][4] >= 29) ? (a1[1][9] - v1) : (v1 == v1)) >= ((v0 && 43) % 7));
+        v2 = (((74 ? v0 : v1) + (v3 >= v3)) >= ((v3 || a1[3][9]) >= (v2 && v3)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v1 = (((a0[14] * v1) < (a1[0][0] / 8)) && ((v1 > 41) != (v3 % 1)));
+        a1[3][0] = (((v0 * a0[3]) >= (4 <= v2)) ? ((a1[3][1] == a0[15]) || (57 <= v1)) : ((v2 - 70) ? (a1[1][8] == 93) : (a1[0][1] + v1)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v0 = (((i0 ? v3 : v0) < (a0[15] < 81)) && ((a0[9] == v2) == (v1 || a1[2][14])));
+            v3 = (((i1 >= i0) >= (v1 ? 60 : i0)) < ((i0 > a1[0][1]) <= (a1[2][10] ? v1 : v0)));
+            v0 = (((a1[3][12] || 10) != (v3 % 3)) != ((5 ? i0 : i1) >= (a1[1][3] ? v2 : 83)));
+        }
+    }
+    if ((((a0[13] < v1) / 9) ? ((v1 % 8) + (35 <= 37)) : ((a0[12] <= v3) < (v2 == a1[3][8])))) {
+        a0[14] = (((v1 >= v3) ? (a1[3][3] == a1[0][12]) : (v3 == v1)) > ((v2 + v2) < (v3 / 5)));
+        v0 = (((a1[3][6] != v0) ? (v1 + v3) : (v3 / 2)) > ((v3 ? v3 : v3) - (v2 ? a1[3][7] : 68)));
+        v2 = (((a1[1][3] / 5) <= (v3 >= v3)) + ((a1[3][15] < v1) != (21 <= a0[13])));
+    } else {
+        v2 = (((v0 * v1) * (v1 || 95)) <= ((5 && v1) <= (v1 - v1)));
+        v3 = (((v2 - 8) <= (a0[6] && v0)) < ((42 >= v1) / 8));
+        v0 = (((77 == v0) < (44 != v1)) > ((v2 * v1) / 3));
+    }
+    if ((((30 / 7) * (v0 <= v0)) * ((a1[1][1] >= a1[3][3]) <= (3 > 12)))) {
+        a1[2][12] = (((v3 && 75) <= (63 != 1)) == ((v3 % 6) && (98 * v2)));
+        v2 = (((v1 * 4) % 7) != ((a1[0][12] ? a0[4] : a0[5]) >= (a1[0][0] / 7)));
+        v3 = (((53 || v0) ? (v1 != v1) : (a0[0] <= v1)) != ((a0[5] ? v0 : 2) || (89 >= a0[0])));
+    } else {
+        a1[0][12] = (((78 % 5) && (v1 ? a1[2][6] : v0)) - ((a1[3][7] && v3) / 9));
+        a0[9] = (((v3 != a1[3][5]) + (63 ? v2 : v3)) > ((81 - 9) >= (v2 > v3)));
+        v2 = (((v1 + 21) && (92 <= v3)) <= ((v1 % 8) % 8));
+    }
+    if ((((a1[3][3] < v2) + (v2 ? v3 : v0)) % 9)) {
+        v0 = (((v0 > 66) != (v2 || v3)) * ((v3 < v2) && (4 >= 59)));
+        v0 = (((v1 + 69) && (v3 ? 94 : 30)) <= ((v0 % 2) && (a1[0][9] % 4)));
+        v1 = (((64 && v1) < (1 == 80)) != ((v2 == a0[1]) != (a0[6] < v3)));
+    } else {
+        a1[3][7] = (((v0 == v1) + (a1[2][11] && 56)) ? ((61 > 87) - (v2 || 23)) : ((v3 && v0) + (93 > 36)));
+        a1[0][4] = (((a1[2][6] * v0) == (20 - v2)) / 9);
+        v2 = (((a0[15] ? a1[0][9] : v2) <= (v2 / 6)) || ((56 - 94) / 6));
+    }
+    return (((a0[4] != v2) != (v0 <= a1[2][3])) < ((v1 && v3) > (60 % 6)));
+}
+int f2() {
+    int v0 = 98;
+    int v1 = 12;
+    int v2 = 85;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][0] % 4) > (v0 + 8)) * ((v0 != 21) != (v0 ? 50 : v0)))) {
+        v0 = (((v2 < 78) == (v2 || v1)) % 4);
+        v2 = (((80 || a0[8]) && (99 >= 60)) > ((63 / 1) != (v2 >= v0)));
+        v3 = (((v0 >= v0) || (a0[3] > 35)) + ((a1[1][5] + v1) / 7));
+    } else {
+        a1[1][7] = (((a1[2][14] * a0[13]) != (v1 == a1[3][1])) * ((26 ? v3 : v2) - (v1 >= 47)));
+        a1[2][8] = (((a1[2][15] >= v2) <= (8 % 1)) || ((v2 ? a0[7] : a0[2]) <= (v3 ? v1 : 15)));
+        v1 = (((v1 + v1) ? (42 >= v1) : (12 - v2)) - ((98 / 6) <= (v2 && v2)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v2 = (((v2 && i0) == (v2 == i0)) || ((v0 < i1) || (49 + a0[9])));
+                v2 = (((i0 == a1[1][10]) / 4) != ((2 <= a0[11]) * (54 ? v0 : v3)));
+                v1 = (((a1[1][11] || v3) == (9 * a1[3][2])) >= ((v1 % 2) > (v0 - a0[15])));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v3 = (((52 / 3) * (v2 >= a0[14])) >= ((a0[14] != i0) < (86 ? v3 : v2)));
+        v1 = (((v2 <= v2) || (29 % 1)) % 3);
+    }
+    if ((((15 * v1) >= (a1[0][3] > 20)) < ((v0 || v1) * (a0[3] >= 24)))) {
+        v1 = (((46 + a0[15]) % 1) + ((61 ? v2 : a1[2][0]) % 4));
+        a1[2][3] = (((53 * a0[11]) - (16 % 5)) / 1);
+        v3 = (((a0[10] % 8) ? (v0 || 24) : (v3 == 95)) ? ((v0 + a1[1][3]) ? (v1 <= a0[9]) : (a0[10] / 5)) : ((a1[1][8] <= 59) > (a0[13] != 21)));
+    } else {
+        a0[15] = (((v0 ? 40 : a1[3][5]) % 5) >= ((v0 - v0) - (v2 && v3)));
+        v2 = (((a0[4] - v2) - (a0[2] && a0[6])) || ((v0 - v1) / 9));
+        v0 = (((v2 > a1[3][13]) / 1) ? ((85 != v0) - (v2 < 94)) : ((22 && v3) ? (a1[1][11] && v3) : (73 >= 29)));
+    }
+    if ((((a0[1] <= v0) > (a1[0][11] + 7)) / 6)) {
+        v0 = (((a1[0][2] + 45) + (35 * v1)) / 3);
+        v3 = (((v2 ? v3 : a0[11]) >= (a0[1] > v1)) > ((20 ? v1 : a1[3][7]) % 3));
+        v3 = (((v0 % 6) == (v2 > v2)) || ((v3 >= v3) / 9));
+    } else {
+        v3 = (((v0 >= v2) ? (v1 < v0) : (a1[3][5] ? a0[14] : v3)) / 4);
+        v3 = (((a0[2] * 33) || (v2 && v3)) > ((21 <= v3) && (v3 + 87)));
+        v2 = (((a0[10] + v3) != (v2 >= a0[6])) + ((76 <= 40) && (a1[1][11] / 1)));
+    }
+    if ((((47 && 58) && (v2 * 5)) == ((v1 != v3) ? (a0[14] <= v3) : (64 * 46)))) {
+        v0 = (((63 + v1) < (v2 >= v2)) % 7);
+        a1[3][1] = (((99 % 3) + (v2 * v1)) != ((v0 < a1[0][12]) ? (v2 == 91) : (v1 || 82)));
+        v2 = (((v3 > v3) ? (33 ? a0[5] : a0[2]) : (a0[15] <= a1[0][13])) % 1);
+    } else {
+        v3 = (((v2 <= 54) <= (v0 % 3)) < ((v3 + v2) - (v2 != a0[10])));
+        v0 = (((a1[1][6] <= v3) >= (a1[1][3] ? 27 : 24)) <= ((v3 <= v1) * (v1 - v2)));
+        v0 = (((55 <= v3) % 5) > ((a0[11] > a1[1][4]) - (v0 && v0)));
+    }
+    return (((a0[13] < a0[1]) >= (v1 ? v1 : v3)) != ((v2 <= a0[2]) < (v2 || a1[1][15])));
+}
+int main() {
+    return 0;
+}
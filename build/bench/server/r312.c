@@ -0,0 +1,54 @@
+int f0() {
+    int v0 = 72;
+    int v1 = 2;
+    int v2 = 79;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a1[0][5] < v0) ? (a0[11] < a1[2][7]) : (92 ? v0 : v2)) / 7);
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((i0 <= v3) + (v3 != 67)) != ((v3 * v1) || (v2 && 44)));
+                    v3 = (((i0 / 7) && (v1 != 16)) >= ((11 <= v0) + (v2 == 99)));
+                    a1[2][10] = (((i1 * a0[7]) != (a0[2] && v3)) / 6);
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a0[9] = (((v3 <= v1) || (i0 ? v3 : v2)) - ((v0 >= 61) * (12 && v2)));
+            v2 = (((58 * v3) >= (v0 <= 21)) != ((v3 > v1) ? (v1 - 71) : (v3 / 3)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v1 = (((v2 / 8) < (v0 && v3)) - ((v2 ? 89 : a1[2][5]) % 9));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((i2 || i3) * (a1[1][11] && a1[2][3])) - ((v2 || v1) - (v3 * a1[0][11])));
+                v2 = (((v1 == a0[0]) % 4) ? ((i3 / 7) != (i2 * v2)) : ((i3 != a1[2][6]) >= (a0[0] && 79)));
+                v0 = (((v3 <= i2) / 8) != ((a0[1] - a0[1]) && (62 || i2)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v1 = (((v0 != 78) == (94 * i2)) * ((v0 + i2) != (v1 >= v0)));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((v1 == a0[0]) > 88) break;
+        v1 = (((v0 == v3) + (v3 <= i4)) == ((7 / 8) >= (a1[3][14] != a1[2][2])));
+        v0 = (((v0 - v0) < (i4 < 96)) || ((i4 ? i4 : a0[11]) - (a1[2][2] / 2)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v0 = (((i5 % 7) > (v1 + i5)) && ((v3 ? a1[3][13] : a1[0][4]) > (92 >= a0[2])));
+            v0 = (((88 && v0) <= (v1 - i5)) / 4);
+            v1 = (((v1 == 22) / 6) <= ((v2 >= a0[7]) ? (61 == 16) : (v3 || v0)));
+        }
+    }
+    v3 = (((v2 % 4) == (v1 != v3)) > ((v2 || v2) && (a1[2][1] >= v3)));
+    return (((a0[11] <= 41) % 5) ? ((68 && a0[8]) > (17 * 73)) : ((v1 <= 0) ? (v1 % 7) : (v3 / 2)));
+}
+int main() {
+    return 0;
+}
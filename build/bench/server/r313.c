@@ -0,0 +1,118 @@
+int f0() {
+    int v0 = 24;
+    int v1 = 1;
+    int v2 = 65;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 ? v0 : v2) || (2 != 40)) && ((a0[8] / 9) == (v1 == v2)))) {
+        a0[0] = (((v1 ? v3 : v0) > (a1[2][13] <= v3)) == ((v1 / 5) <= (97 > 27)));
+        v0 = (((v2 <= a0[2]) <= (a1[0][0] >= a1[1][3])) && ((v3 + v3) < (16 / 3)));
+        v1 = (((a0[5] != v3) + (v1 ? a0[4] : 25)) / 6);
+    } else {
+        v0 = (((a0[10] % 5) || (a1[3][13] >= v0)) > ((v0 >= a1[1][15]) > (v2 || 94)));
+        v1 = (((v1 >= v2) <= (a1[2][2] != v1)) < ((v2 >= v2) && (v2 % 8)));
+        a1[2][3] = (((v0 || v2) != (24 >= v3)) + ((78 != v0) * (v3 ? v2 : a0[11])));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v2 == 30) > (v0 >= a0[13])) || ((a0[4] ? i0 : a1[0][12]) + (v2 < i1)));
+                    v2 = (((v1 - a0[13]) != (i0 == v2)) + ((16 ? v3 : v1) != (v0 != 13)));
+                    v3 = (((v1 ? 51 : 21) - (a0[13] + 50)) ? ((a0[5] * a0[7]) <= (a0[10] - 2)) : ((6 % 5) <= (a1[2][4] && v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            a1[2][10] = (((i0 == 30) > (62 <= 55)) || ((v2 > 67) * (41 * a1[1][15])));
+            v2 = (((33 && a0[14]) - (a1[3][13] || 60)) * ((76 ? a0[0] : v1) + (i0 && 37)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((a0[8] * v2) != (v3 + v3)) > ((a1[2][12] * v2) - (v0 < v0)))) {
+        v0 = (((v3 == v2) > (v1 / 2)) * ((v1 % 1) - (a1[2][5] || v3)));
+        a1[2][13] = (((v1 < v1) * (v0 ? 56 : v3)) + ((2 ? v3 : v1) && (v1 ? v0 : 79)));
+        a0[13] = (((v3 <= 7) > (a0[8] != v2)) && ((a0[12] % 1) <= (a0[9] * v3)));
+    } else {
+        a0[3] = (((41 + 71) == (v0 / 9)) + ((v2 - a1[2][7]) || (71 % 2)));
+        a1[2][11] = (((v1 != 55) == (v3 + v1)) ? ((a0[10] - 53) % 2) : ((21 + v3) || (v1 + v3)));
+        v0 = (((v2 > v1) >= (23 - 59)) + ((v2 <= v0) ? (v1 == 32) : (66 == a0[7])));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a1[0][1] = (((99 || v2) / 1) <= ((i2 >= a0[12]) == (a1[1][8] >= 47)));
+        v0 = (((a0[6] / 4) != (v3 > a0[8])) && ((a1[3][7] <= 2) == (a1[2][0] != i2)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            a0[10] = (((a0[10] >= v0) % 7) ? ((v1 + i2) >= (i2 ? v0 : 91)) : ((a1[0][2] && 21) + (v1 - i2)));
+            a0[0] = (((v0 / 8) ? (i3 > v3) : (a0[6] || i2)) || ((i3 > v1) <= (v0 % 8)));
+            a1[2][1] = (((v2 >= v2) + (i3 != v3)) * ((a1[3][13] % 7) >= (v1 + i3)));
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        if ((v3 / 4) > 59) break;
+        v2 = (((42 - a1[1][8]) ? (v1 > 40) : (v0 == a1[3][13])) * ((v1 == a1[3][5]) && (v2 != v1)));
+        a1[2][1] = (((a1[3][6] ? a0[1] : 34) - (v1 < v1)) || ((12 == a0[5]) >= (v2 * v0)));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            if ((v2 || a1[1][12]) > 89) break;
+            a0[14] = (((v0 / 1) / 9) % 5);
+            v2 = (((v3 % 8) < (v3 * v2)) ? ((v3 % 2) >= (i4 || 55)) : ((93 - a0[13]) + (14 != i4)));
+            a0[4] = (((a0[9] <= 35) || (v3 % 6)) > ((a0[13] ? v2 : v1) <= (a1[2][13] ? a1[3][10] : 3)));
+        }
+    }
+    return (((v0 - v3) ? (v3 == v2) : (a1[3][15] + v2)) - ((v3 != 64) - (a1[0][3] % 1)));
+}
+int f1() {
+    int v0 = 20;
+    int v1 = 64;
+    int v2 = 18;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a1[1][5] || a1[1][10]) >= (3 - v2)) <= ((v3 - 59) ? (v1 % 9) : (a0[7] ? 96 : v3)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v1 = (((a1[3][1] + 48) || (90 && a1[0][9])) ? ((v1 == a0[10]) - (a0[4] > v0)) : ((v2 <= v2) / 6));
+            v0 = (((42 != 77) == (v3 > v2)) / 8);
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v2 = (((10 ? a0[9] : 67) % 8) < ((v2 + 70) / 5));
+                a0[11] = (((v2 ? 42 : a1[0][8]) ? (v0 && 20) : (a1[2][14] > a0[15])) > ((91 + v3) + (a0[11] * v3)));
+                v0 = (((v1 != a1[1][6]) < (v0 + a0[4])) || ((v2 > a1[1][13]) < (v3 >= v0)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a1[0][5] = (((38 || v3) < (v0 > v0)) ? ((v1 % 6) >= (a1[3][2] != v3)) : ((v3 + a0[3]) <= (a1[1][2] - v3)));
+            a1[3][0] = (((a0[15] < 16) + (v0 % 4)) * ((i2 == a1[2][11]) || (a0[5] > a1[2][12])));
+            {
+                int i3 = 0;
+                do {
+                    if ((v1 % 8) > 64) break;
+                    v2 = (((v1 ? 92 : i3) == (i2 + i3)) != ((v3 == v0) ? (v2 != v2) : (v2 ? 67 : 77)));
+                    a0[9] = (((i3 || v0) < (i2 - a0[0])) == ((v2 < v3) >= (v1 - a0[8])));
+                    v2 = (((v1 * v2) > (v1 >= a0[7])) > ((v1 ? a0[8] : 86) ? (a0[7] >= i2) : (i2 ? 78 : 27)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((a1[1][8] || v0) - (v2 + v0)) - ((v1 - v2) + (v0 < v2)));
+    if ((((v2 / 3) < (v3 == 63)) || ((a1[3][13] <= a1[0][13]) * (a1[0][8] <= v2)))) {
+        v1 = (((v1 / 3) % 2) * ((10 % 4) ? (a0[9] ? v3 : 30) : (v1 >= a1[2][11])));
+        a0[13] = (((v0 >= 4) != (v3 > 72)) != ((a0[14] + v3) ? (93 / 6) : (a0[13] + 18)));
+        v0 = (((95 == a0[15]) / 6) >= ((v3 > 39) || (51 || v0)));
+    } else {
+        v3 = (((91 % 2) <= (a0[7] <= a1[3][8])) ? ((a0[15] < v0) && (v3 > 57)) : ((86 || v0) * (v0 * v3)));
+        a1[1][3] = (((48 != v3) > (a0[14] / 8)) < ((a0[3] ? v0 : v1) < (v0 < v3)));
+        v3 = (((v2 != v3) - (v0 >= a0[12])) ? ((v2 - 57) / 2) : ((v2 * v0) >= (13 || v3)));
+    }
+    return (((v1 >= a0[14]) >= (38 * a0[10])) % 5);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,132 @@
+int f0() {
+    int v0 = 9;
+    int v1 = 75;
+    int v2 = 73;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    a1[2][8] = (((v3 > a0[4]) / 8) >= ((1 != a0[6]) <= (v0 < 19)));
+    v0 = (((v1 >= 15) / 3) + ((38 != v0) > (a0[10] != a0[9])));
+    if ((((v2 % 8) * (35 - v0)) > ((a1[1][14] || v0) ? (a1[2][14] ? v2 : 0) : (v1 || v1)))) {
+        v3 = (((v3 * a1[0][8]) < (v1 || 49)) < ((a0[7] != v3) / 3));
+        v2 = (((a0[9] > v0) <= (a0[14] * v3)) >= ((96 != v2) * (a0[1] ? v1 : v3)));
+        v1 = (((a1[3][14] * a0[11]) && (v3 >= v3)) >= ((68 <= v0) || (v0 && 94)));
+    } else {
+        v0 = (((a1[1][14] / 9) >= (a1[2][12] < v0)) < ((96 == 70) > (84 + a0[12])));
+        v0 = (((v0 % 4) == (v1 >= v2)) >= ((22 == 16) && (v2 == a1[2][0])));
+        v1 = (((v1 == v2) || (a1[3][2] - 34)) + ((83 >= 66) ? (a0[5] < a0[15]) : (a0[3] % 6)));
+    }
+    if ((((a0[13] - 7) && (v3 ? 77 : v2)) ? ((v2 + a1[2][4]) > (13 % 2)) : ((v3 >= v2) ? (v1 / 3) : (11 < v3)))) {
+        v3 = (((v1 && v1) - (49 ? v2 : v3)) < ((55 < v2) && (a0[5] + a1[3][14])));
+        v2 = (((v0 != v2) ? (24 + 81) : (83 ? v1 : 98)) - ((a1[2][7] >= 75) / 7));
+        v2 = (((v2 < v1) / 4) % 8);
+    } else {
+        a0[5] = (((v2 == v3) > (v0 >= a1[0][12])) || ((v2 >= v2) || (66 == v3)));
+        v1 = (((26 ? a0[14] : v2) * (15 <= 33)) || ((v1 <= v0) ? (81 % 4) : (5 <= v3)));
+        a0[2] = (((a0[5] - 57) && (7 != a0[10])) != ((18 >= a0[15]) <= (a1[0][4] && 90)));
+    }
+    a1[3][0] = (((77 + v1) < (v1 != v1)) && ((18 || a1[1][8]) <= (v3 % 3)));
+    return (((v3 / 6) || (40 == 18)) * ((35 >= v2) % 4));
+}
+int f1() {
+    int v0 = 9;
+    int v1 = 34;
+    int v2 = 1;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((58 * v1) <= (v0 && a1[3][3])) || ((30 ? i0 : 88) <= (a0[15] % 1)));
+            a1[3][7] = (((v3 > v3) == (v1 <= 79)) == ((a0[13] < 69) && (v3 <= 79)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[3][4] = (((a1[0][2] + v2) < (a0[0] * v2)) != ((50 + i0) % 8));
+                v3 = (((a1[1][7] || v2) - (v1 - v3)) == ((i0 == v3) + (v3 > v0)));
+                v3 = (((i0 <= 43) / 9) >= ((29 || a1[1][9]) + (45 != v1)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((a1[1][14] && v3) <= (v2 + 16)) + ((v3 >= v0) || (v1 ? 91 : v3)));
+    a0[14] = (((a1[0][14] != v0) != (v3 * a0[3])) ? ((a0[3] ? v1 : v0) * (a1[2][5] < 25)) : ((v3 - v1) < (v1 > v0)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a1[1][5] = (((26 * a1[3][3]) * (v2 < a1[2][2])) >= ((a0[7] < a1[3][3]) == (61 || 54)));
+            v2 = (((10 % 9) ? (a0[7] * a1[3][4]) : (v3 - v1)) && ((a1[0][13] >= a1[0][11]) / 2));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((v1 + a1[1][9]) > 82) break;
+                v2 = (((a1[2][4] <= a0[9]) / 6) * ((i3 < 82) || (v2 <= v2)));
+                v3 = (((i2 / 8) / 3) * ((a0[8] != 87) * (v3 ? 35 : v3)));
+                v1 = (((a1[1][12] ? a1[3][6] : 90) - (i3 < v1)) && ((66 ? i2 : a1[2][0]) <= (9 / 6)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((a0[8] >= a0[11]) > 82) break;
+            {
+                int i5 = 0;
+                do {
+                    if ((i4 <= v2) > 79) break;
+                    v1 = (((57 && a1[1][10]) <= (v2 && 89)) + ((i5 < a0[4]) <= (i4 < v1)));
+                    v3 = (((a0[6] && a0[9]) - (63 % 6)) * ((90 >= v3) >= (a1[1][10] >= 21)));
+                    v2 = (((v0 ? v0 : a1[0][11]) + (v1 ? v3 : v3)) <= ((v1 ? v3 : a1[1][10]) > (a0[12] / 2)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v3 = (((v2 > a1[1][1]) % 9) - ((v0 > v0) < (72 == i4)));
+            v0 = (((34 ? v1 : v0) * (v2 != v0)) % 5);
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[0][6] > 27) <= (67 < 36)) * ((v1 != v0) > (a0[8] != v0)));
+}
+int f2() {
+    int v0 = 36;
+    int v1 = 25;
+    int v2 = 77;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 && v3) + (v1 * a1[1][4])) ? ((v3 + 52) >= (64 - v1)) : ((32 || v3) != (v0 / 8)))) {
+        a1[3][10] = (((a1[1][3] * v3) < (a0[15] ? a1[2][8] : 13)) || ((a0[2] - a0[9]) >= (v1 ? a1[2][9] : v1)));
+        a0[6] = (((v2 % 1) == (87 != a0[1])) * ((55 <= v3) && (v0 + v1)));
+        v3 = (((v3 - v2) ? (87 % 6) : (v0 ? 37 : a0[5])) < ((v1 || 68) - (v2 ? 88 : a1[2][4])));
+    } else {
+        v1 = (((v3 + 54) <= (v2 < v2)) > ((69 % 8) ? (v1 != a1[0][15]) : (a0[10] ? 83 : 23)));
+        v2 = (((v1 && a1[0][8]) - (14 * v2)) > ((v1 <= v1) < (69 * v2)));
+        a0[12] = (((a0[4] || v1) <= (v1 % 2)) == ((v0 || v3) ? (71 > a1[3][13]) : (v1 ? a1[3][7] : v2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[2][5] = (((v1 == v0) * (94 ? v1 : v2)) - ((a0[15] > v3) - (a0[12] > a1[2][1])));
+            v3 = (((87 * 78) == (a0[5] <= v1)) >= ((v0 > i0) / 5));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                a1[2][14] = (((13 * v0) <= (25 != v1)) ? ((v0 + a0[14]) != (i0 - v0)) : ((a1[1][1] + v2) ? (i0 != i1) : (78 / 5)));
+                v1 = (((v2 == 72) == (88 * i1)) || ((11 - v0) - (v0 % 8)));
+                v1 = (((28 / 9) / 8) ? ((93 != i1) || (13 >= v0)) : ((v1 && 89) == (a0[15] ? a0[15] : i1)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    v0 = (((96 > 54) <= (v0 || 34)) * ((v1 + v2) / 5));
+    if ((((a0[8] / 4) == (v1 == v2)) % 8)) {
+        a1[3][4] = (((v1 && v1) / 4) / 3);
+        a1[2][1] = (((v1 * v2) - (24 >= a1[0][5])) <= ((v0 / 9) && (63 || 9)));
+        v3 = (((v1 == v2) > (v1 <= 14)) % 3);
+    } else {
+        a1[3][13] = (((v0 * v0) ? (v2 < 3) : (1 > a0[5])) <= ((v3 == v0) - (15 + v2)));
+        a1[1][5] = (((a1[1][5] ? 0 : v1) < (33 || a1[1][11])) - ((a0[10] == v3) == (39 || v3)));
+        v2 = (((10 + v2) - (v1 >= v1)) + ((v1 ? a1[0][0] : 75) * (50 / 1)));
+    }
+    a1[1][1] = (((a0[13] / 2) ? (v0 == 58) : (a1[3][12] + 20)) * ((v0 < v3) ? (a0[13] || v1) : (v3 / 1)));
+    return (((a1[2][7] ? a0[8] : v1) - (v3 > a1[2][7])) % 2);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,62 @@
+int f0() {
+    int v0 = 65;
+    int v1 = 42;
+    int v2 = 71;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((v3 && 91) > 54) break;
+            v0 = (((i0 && a1[2][9]) == (v2 * a0[14])) / 2);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v3 = (((v2 > v0) != (99 != v3)) - ((a0[1] != a1[2][9]) || (i0 + v2)));
+                    v2 = (((a1[3][10] * i0) >= (92 < a1[3][0])) ? ((v0 / 6) || (i0 || a0[10])) : ((v3 || i1) * (a1[0][8] - i1)));
+                    v1 = (((14 - a1[3][5]) <= (i0 == a1[1][10])) - ((a0[6] && v1) != (v3 != a1[2][13])));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v2 % 5) * (a1[2][2] >= a0[10])) - ((a0[15] >= 50) / 6));
+            i0 = i0 + 1;
+        }
+    }
+    a1[3][7] = (((v3 - v2) * (57 % 5)) == ((v3 < v3) != (v2 ? 70 : a1[3][3])));
+    if ((((v0 && v3) % 5) - ((48 ? a0[0] : 0) == (64 < v1)))) {
+        a0[5] = (((a1[0][8] > 12) ? (90 ? a0[7] : a0[4]) : (v0 && v0)) <= ((v0 >= v0) ? (v0 % 9) : (1 >= a1[1][15])));
+        v2 = (((v1 ? v3 : a1[3][4]) || (88 != v3)) <= ((v1 * a0[1]) == (a1[0][2] >= v0)));
+        v1 = (((46 * v2) || (v2 || v1)) && ((94 ? v2 : a0[5]) && (62 != a0[6])));
+    } else {
+        a0[11] = (((v3 > v1) % 1) || ((a0[8] / 2) % 2));
+        v1 = (((a0[6] == v2) * (v1 == v3)) * ((v0 / 8) <= (43 % 6)));
+        v2 = (((98 - v1) ? (75 + v0) : (98 && a1[3][7])) < ((v3 - v3) != (v1 + 46)));
+    }
+    if ((((v2 && v0) || (v2 % 8)) <= ((v1 >= a0[2]) || (49 - a1[3][5])))) {
+        v3 = (((a1[1][12] ? v0 : a0[3]) || (v2 <= a0[13])) + ((27 || 74) <= (3 % 5)));
+        v1 = (((33 < 30) * (a1[3][4] <= 45)) ? ((15 - v3) ? (v1 >= v3) : (v0 >= a1[1][5])) : ((a1[0][14] > v2) + (v0 < v1)));
+        a0[2] = (((v3 % 9) == (v0 < v1)) < ((a1[2][12] != a1[1][4]) == (v0 ? a1[3][12] : v0)));
+    } else {
+        a0[2] = (((v2 + a1[2][5]) - (v3 && v1)) > ((83 + 46) ? (60 > v2) : (v3 || v3)));
+        v2 = (((v1 + 9) - (v1 - a0[8])) >= ((v1 * v0) ? (a1[2][8] - a0[8]) : (85 ? a1[0][8] : v3)));
+        a1[3][8] = (((v1 < v0) ? (a1[2][13] < a0[9]) : (a0[14] * a0[7])) != ((v0 <= v2) + (a0[2] == v2)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                a0[12] = (((v2 < v0) > (v2 ? 50 : v0)) != ((v0 >= v2) * (28 != i2)));
+                a0[9] = (((a0[11] != a1[2][2]) / 6) >= ((69 - v1) && (9 + i2)));
+                a1[2][14] = (((45 / 6) == (52 && 9)) > ((i2 % 8) + (3 ? 15 : v2)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((57 - a0[11]) ? (81 || 47) : (v0 / 1)) - ((v1 == v0) || (v3 - a0[3])));
+        v0 = (((a0[4] != 25) <= (a0[11] == a0[7])) ? ((50 > a0[0]) && (33 != v2)) : ((54 / 2) ? (v3 * v2) : (v0 == 57)));
+    }
+    return (((44 ? v0 : 40) * (v3 || 26)) ? ((v3 + 52) % 3) : ((v0 * a1[2][12]) >= (57 / 2)));
+}
+int main() {
+    return 0;
+}
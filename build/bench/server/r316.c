@@ -0,0 +1,87 @@
+int f0() {
+    int v0 = 47;
+    int v1 = 46;
+    int v2 = 78;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((4 >= 45) == (a0[10] <= a1[1][14])) >= ((v2 || 76) >= (v0 < v2)));
+    if ((((a0[0] < a1[1][3]) == (72 <= v0)) != ((a0[3] ? 89 : a0[0]) < (a1[0][2] != v1)))) {
+        a0[5] = (((a0[0] < a1[3][15]) <= (a1[3][8] + 74)) && ((18 ? v1 : v2) && (81 > v2)));
+        v1 = (((v3 != a1[2][3]) && (76 && v1)) || ((v1 - 38) + (v0 > v3)));
+        a1[3][1] = (((v1 && v2) + (v2 > v0)) / 7);
+    } else {
+        v1 = (((a0[0] || v1) >= (24 * v3)) * ((v0 <= 30) % 2));
+        a0[5] = (((a0[7] + v0) - (v1 < v0)) < ((v1 ? 42 : v0) ? (12 - v3) : (v2 || v3)));
+        v1 = (((v2 ? v1 : a0[13]) < (90 % 5)) * ((v1 ? a1[1][12] : v3) - (v3 * 34)));
+    }
+    if ((((v2 + a0[14]) != (a1[2][8] % 8)) < ((v1 * a1[1][5]) ? (97 * v0) : (v0 > v2)))) {
+        a0[13] = (((v3 >= v1) >= (a0[5] || 62)) % 2);
+        a0[3] = (((71 > a1[2][12]) > (a0[6] != a1[2][12])) != ((v1 / 4) + (a1[0][7] == 89)));
+        a1[1][2] = (((a0[4] <= a1[0][0]) ? (v2 || v0) : (v2 != 97)) && ((a1[0][0] >= v0) >= (v1 > a1[3][0])));
+    } else {
+        v1 = (((v2 < a0[0]) != (v1 + 90)) >= ((v3 == v0) - (v0 || 67)));
+        v1 = (((v3 * a0[8]) / 5) > ((73 <= v2) <= (43 != a1[3][3])));
+        v1 = (((v3 ? a0[2] : a0[2]) > (v2 >= a0[3])) ? ((22 && a0[3]) ? (v2 % 1) : (v1 != v2)) : ((v0 < v3) < (v2 + 61)));
+    }
+    v3 = (((a0[12] ? v0 : v3) / 9) / 6);
+    if ((((11 ? 57 : 59) % 8) && ((75 < a0[12]) == (a1[2][5] != a1[1][11])))) {
+        v2 = (((v0 ? a0[11] : v0) * (a0[7] / 8)) % 1);
+        v1 = (((a0[2] > v3) / 8) || ((a0[7] < v2) < (a1[0][9] >= v3)));
+        a0[9] = (((a0[12] || v2) <= (a0[4] ? 38 : v2)) ? ((a0[8] >= a0[8]) && (v2 >= a0[0])) : ((v1 < v2) != (v2 == v2)));
+    } else {
+        a1[3][2] = (((v0 != a1[1][6]) == (v0 < a1[3][4])) >= ((v3 != v2) && (a0[11] && v0)));
+        v0 = (((57 * v2) % 9) >= ((34 * 56) <= (13 != v0)));
+        v2 = (((v3 ? 40 : v3) > (v3 != a1[1][15])) < ((a0[9] ? v1 : a0[12]) == (59 > 17)));
+    }
+    return (((a0[8] <= v2) ? (v1 == a1[2][13]) : (a1[3][14] ? v2 : v2)) - ((v2 / 8) + (v3 * a0[11])));
+}
+int f1() {
+    int v0 = 19;
+    int v1 = 54;
+    int v2 = 71;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 <= v3) == (a1[2][6] != 47)) == ((a0[3] ? v2 : 15) ? (v3 + 54) : (a0[7] - v0)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v2 = (((a1[0][2] ? v3 : v2) * (94 * a0[0])) % 2);
+            a0[0] = (((v2 ? v3 : v0) < (i1 * v0)) ? ((v0 ? a1[0][8] : v2) > (a0[4] % 9)) : ((i0 || 67) ? (i1 == 55) : (v3 < 13)));
+            v2 = (((v1 != a0[12]) > (v0 >= 66)) + ((v2 == a1[1][4]) + (94 ? 41 : v0)));
+        }
+        a1[3][1] = (((31 ? i0 : 13) <= (v2 && v3)) - ((60 <= i0) / 5));
+        v2 = (((v1 != 9) <= (a1[2][7] == v1)) < ((v0 * a1[1][8]) && (v0 - 63)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a1[2][7] ? 21 : v2) ? (12 > v1) : (44 % 9)) ? ((v0 <= 40) != (a1[0][6] + v2)) : ((i2 < a0[3]) * (a1[2][0] || v2)));
+            v3 = (((i2 ? 80 : a0[7]) ? (22 ? a0[8] : 42) : (66 + a0[2])) == ((a1[1][4] >= 49) * (v1 * v2)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a0[14] && i2) ? (90 + v2) : (v2 * i2)) - ((92 - 30) < (62 * 36)));
+                    v2 = (((3 * v3) / 6) || ((v0 ? v1 : a1[0][8]) - (v3 / 7)));
+                    v3 = (((98 + 90) <= (v2 / 9)) == ((v2 ? v0 : i3) || (v1 && i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        a0[11] = (((v3 ? a0[1] : i4) && (v0 / 7)) / 8);
+        v1 = (((v0 > v3) ? (v2 * v3) : (v1 || a1[3][0])) - ((27 <= i4) <= (a0[8] - v3)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v2 = (((i4 / 2) == (v0 < v0)) % 9);
+            a0[15] = (((11 <= a1[0][12]) + (59 % 6)) == ((v0 / 4) / 6));
+            a0[7] = (((v2 == i4) ? (a1[2][1] ? 6 : a0[1]) : (v2 < 16)) * ((a1[3][14] <= a1[2][13]) == (a1[1][4] != a1[2][9])));
+        }
+    }
+    a0[5] = (((v0 * v0) <= (v0 * a0[3])) != ((v2 < a1[0][4]) && (v3 % 2)));
+    return (((v1 % 6) > (55 > v0)) ? ((v3 % 9) > (v0 >= v3)) : ((a1[0][0] && 8) == (v2 * v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,141 @@
+int f0() {
+    int v0 = 3;
+    int v1 = 30;
+    int v2 = 58;
+    int v3 = 56;
+    int a0[16];
+    int a1[4][16];
+    if ((((42 >= v2) - (v0 - a0[4])) + ((v3 <= a1[1][10]) <= (v0 && v2)))) {
+        v1 = (((v3 < 42) <= (a0[0] % 4)) * ((41 / 4) ? (v1 * a0[3]) : (a1[1][2] % 8)));
+        v1 = (((a1[1][9] % 8) >= (v0 == v0)) ? ((v0 - v3) + (11 ? v3 : a0[0])) : ((v0 + 5) == (54 % 2)));
+        a1[2][1] = (((a1[0][3] + a1[2][1]) && (v2 > v2)) && ((v1 >= a1[1][9]) / 2));
+    } else {
+        v1 = (((a0[1] >= a0[3]) % 7) / 4);
+        v2 = (((2 <= v2) != (v3 <= 63)) * ((a1[0][13] ? v0 : 9) != (v0 % 5)));
+        a0[2] = (((71 && a0[9]) ? (a1[3][13] > a1[0][10]) : (a0[4] - v3)) == ((4 + 94) || (82 - v3)));
+    }
+    a1[3][4] = (((v1 < v1) + (96 / 2)) != ((a1[0][11] % 2) >= (80 ? v3 : a0[8])));
+    a1[1][0] = (((v0 == v2) % 8) - ((a1[3][3] / 5) && (a1[1][0] - 1)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a0[10] = (((v1 && a0[15]) >= (v2 || a0[2])) * ((v3 - a1[0][12]) + (v3 <= a0[1])));
+        {
+            int i1 = 0;
+            do {
+                v3 = (((v3 ? v1 : i1) + (a0[5] || 95)) < ((29 == v0) >= (v3 == v2)));
+                v0 = (((5 < 96) == (a1[3][8] && v3)) || ((i0 ? v2 : a0[8]) % 6));
+                v3 = (((a1[1][9] <= 34) - (v0 == i0)) || ((a1[0][14] && v2) < (16 < i1)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v0 = (((72 ? 32 : a0[12]) % 4) >= ((i0 && a1[1][1]) ? (a0[4] < v3) : (v3 && a0[15])));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a1[3][3] = (((v0 ? a0[0] : a1[3][5]) ? (v2 && 20) : (a0[1] + a1[0][8])) ? ((i3 == a1[3][9]) && (83 ? v1 : i2)) : ((v2 != a1[0][2]) / 4));
+                v0 = (((a0[0] == v1) >= (v1 != 19)) * ((37 * v2) != (38 == 61)));
+                v3 = (((a1[2][1] + v2) < (v0 ? i3 : 8)) ? ((v3 == v3) && (v1 ? a1[3][15] : a0[11])) : ((a1[0][5] >= 61) > (48 && v0)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v1 = (((v0 + v1) > (v1 > a0[1])) >= ((42 <= 72) == (a1[0][12] <= v3)));
+        v3 = (((i2 + a0[10]) + (v1 ? v3 : v3)) == ((v3 ? a0[8] : 32) / 4));
+    }
+    return (((a1[1][4] % 2) || (9 >= 37)) * ((v1 < 49) && (v3 || v1)));
+}
+int f1() {
+    int v0 = 97;
+    int v1 = 93;
+    int v2 = 89;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    a1[0][11] = (((a0[14] * v0) / 8) + ((v3 && a1[2][3]) ? (v3 <= 89) : (v3 == v1)));
+    v1 = (((82 ? v3 : v2) != (a1[2][3] <= v3)) <= ((a0[14] > v2) * (v0 >= 62)));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((v2 - i1) > 62) break;
+                a1[0][2] = (((i0 < 77) != (i0 <= a1[3][8])) < ((i0 - i1) + (60 ? 1 : v0)));
+                v2 = (((a1[2][10] < 54) != (v1 - 86)) % 5);
+                a1[3][12] = (((a1[0][15] - v1) - (a1[3][1] != v3)) == ((43 > a0[0]) + (v1 && v0)));
+            }
+            a1[1][12] = (((v1 && 68) >= (v3 && 41)) <= ((32 / 1) && (v2 > 20)));
+            v3 = (((v2 * a1[3][5]) && (10 && v1)) ? ((59 >= 17) ? (v0 < a0[11]) : (72 != 45)) : ((74 > i0) && (v1 - 33)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            if ((a1[2][8] != v1) > 64) break;
+            v3 = (((v2 >= v0) || (v1 - a0[7])) == ((i2 > a0[13]) || (a1[3][2] > a0[9])));
+            a1[0][14] = (((v3 + v1) && (i2 >= a0[6])) / 2);
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a1[2][13] = (((a0[15] || v2) ? (i2 && v2) : (a1[1][13] * v1)) * ((v2 * i3) || (94 >= i2)));
+                a0[4] = (((38 ? v0 : v3) ? (a0[9] < v3) : (v1 ? 76 : 88)) ? ((a1[1][14] > v2) < (4 || 77)) : ((a0[6] ? 28 : v0) && (41 ? v2 : 62)));
+                v1 = (((a1[0][3] >= a1[0][3]) == (i3 <= i2)) > ((40 && v3) - (a1[1][6] >= 15)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((50 >= a0[13]) / 9) <= ((a0[3] * a0[12]) / 1))) {
+        v3 = (((a0[8] / 2) != (91 % 8)) >= ((a1[0][1] && a1[2][6]) != (v3 % 2)));
+        v2 = (((v2 > a1[0][11]) <= (38 + v1)) - ((v2 != v0) + (v1 || v1)));
+        v2 = (((a0[1] && v1) != (a0[8] + a1[3][12])) != ((29 + v3) / 2));
+    } else {
+        a0[7] = (((v0 <= a0[7]) ? (v3 >= 64) : (52 < v0)) % 3);
+        v0 = (((a1[2][8] < 28) < (v1 >= 23)) >= ((v0 || v1) != (46 && v2)));
+        v3 = (((v2 >= a0[1]) ? (v2 && a1[3][11]) : (64 + a0[7])) * ((52 <= v3) && (a0[14] != v3)));
+    }
+    return (((v3 ? v3 : v3) && (v0 >= 62)) ? ((49 * 55) || (v2 < v0)) : ((1 <= v3) || (a1[3][13] - a1[0][11])));
+}
+int f2() {
+    int v0 = 29;
+    int v1 = 15;
+    int v2 = 86;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 % 3) / 5) * ((a1[0][15] + v3) ? (v0 ? a1[2][6] : 94) : (35 != i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v0 ? a0[0] : 74) > 97) break;
+                    a1[1][10] = (((i0 / 7) + (a0[0] + v2)) <= ((v0 / 8) && (v3 <= v0)));
+                    v0 = (((a1[0][6] >= v2) < (a0[3] - v1)) || ((i0 >= v2) || (a1[3][14] && a1[1][15])));
+                    v2 = (((v2 && a0[1]) ? (v0 ? v3 : i1) : (38 <= a1[1][6])) > ((a1[3][1] && 21) != (12 || v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            a0[14] = (((30 + v0) > (v1 % 5)) < ((i0 == v0) == (a0[13] >= v1)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v0 = (((v1 || v0) * (v1 <= 26)) ? ((a1[0][10] % 2) >= (v2 < v3)) : ((v3 != a0[3]) - (v3 && 89)));
+    v0 = (((v2 <= v3) % 1) + ((v1 / 8) * (v3 == a1[0][1])));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((a0[6] / 9) || (i2 != a1[1][0])) / 8);
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                if ((9 * v3) > 93) break;
+                v1 = (((a0[14] <= a0[2]) ? (a1[3][15] == 92) : (a1[1][9] >= v2)) > ((v0 < v1) - (v2 ? a0[5] : 11)));
+                v3 = (((a0[11] || v1) / 4) && ((a1[2][13] % 2) < (i2 / 4)));
+                v1 = (((5 - v0) > (i2 - v2)) == ((33 || i2) ? (37 + 30) : (13 / 2)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((a0[5] < 57) <= (v1 + 60)) != ((i2 && v1) * (a1[2][3] * 56)));
+    }
+    a1[1][14] = (((a1[1][1] != v1) >= (v2 ? a1[1][12] : v1)) / 3);
+    return (((v3 >= v2) - (a1[1][6] ? a1[3][2] : a0[7])) ? ((v0 % 3) || (v1 % 8)) : ((66 < a0[14]) && (v2 % 1)));
+}
+int main() {
+    return 0;
+}
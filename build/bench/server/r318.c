@@ -0,0 +1,74 @@
+int f0() {
+    int v0 = 97;
+    int v1 = 39;
+    int v2 = 87;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 * 34) > (a1[1][7] ? v2 : a0[15])) - ((v3 >= v1) % 1))) {
+        a0[1] = (((v1 * v0) >= (26 != a0[15])) && ((17 + v0) > (v3 && v1)));
+        v3 = (((39 + a1[3][8]) <= (v3 == v0)) <= ((a0[4] <= v2) % 4));
+        v2 = (((v1 >= v1) && (v1 + 65)) ? ((v0 * 40) == (v2 && a0[6])) : ((v1 % 7) < (v3 && a1[0][3])));
+    } else {
+        a0[7] = (((v2 ? 86 : v1) >= (v2 > a0[2])) && ((52 - v1) >= (5 == 50)));
+        a0[10] = (((v2 % 1) > (a0[2] ? 26 : 82)) || ((a0[15] > 27) == (v3 <= v2)));
+        v0 = (((v0 - v0) / 5) > ((a1[3][7] ? v3 : a1[3][8]) + (22 * 69)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((a0[10] + a0[11]) > 55) break;
+        v2 = (((57 < v0) > (i0 / 5)) < ((v3 == v1) < (a0[12] ? v3 : v1)));
+        {
+            int i1 = 0;
+            do {
+                a1[3][12] = (((i1 >= v2) * (i1 != a0[8])) * ((v0 ? a1[3][8] : v3) && (73 == v0)));
+                v2 = (((a0[12] * a0[8]) + (a0[15] + 95)) % 9);
+                a0[11] = (((v1 * 43) * (a1[3][10] - v3)) / 6);
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        a1[2][7] = (((a1[3][6] ? v2 : v3) < (21 + v3)) ? ((a1[0][11] * v3) <= (v3 == a0[10])) : ((a0[2] || a0[6]) == (a1[1][9] / 8)));
+    }
+    if ((((a0[11] - a1[3][9]) ? (v0 + a0[0]) : (59 != v2)) > ((31 ? v0 : a1[1][5]) ? (55 || v2) : (67 % 4)))) {
+        a1[2][10] = (((v2 % 7) ? (v3 <= 30) : (v3 ? 49 : v1)) - ((v3 % 5) != (v1 % 4)));
+        a0[8] = (((v2 / 5) % 5) <= ((v1 * a1[2][4]) == (4 < v3)));
+        v0 = (((v2 * v2) + (70 ? v1 : 92)) - ((a0[7] != a1[1][14]) == (11 <= a0[1])));
+    } else {
+        a1[3][4] = (((v0 * v3) % 8) ? ((v1 ? 0 : v0) ? (v0 % 3) : (v3 % 3)) : ((25 * v0) % 3));
+        v1 = (((a1[0][13] > v3) == (a1[3][10] <= v2)) > ((v1 == 51) / 8));
+        a1[0][9] = (((58 == v1) <= (v1 > 51)) != ((a0[7] / 6) * (a1[1][6] >= v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a1[0][2] = (((v0 == v1) ? (37 % 7) : (v0 == a1[3][10])) ? ((54 != v2) % 8) : ((1 * 20) % 5));
+            a1[1][2] = (((v1 > v0) && (v1 && a1[1][15])) != ((v3 || v0) < (v2 || v0)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v3 = (((a0[1] == v3) <= (45 % 2)) != ((a0[14] > 9) + (a0[14] ? v1 : 36)));
+                    v3 = (((a0[9] != 51) != (a1[0][10] || a1[3][4])) > ((v0 == v0) > (v3 || a1[1][2])));
+                    v3 = (((v2 && 72) - (a1[1][4] * 28)) >= ((56 - 79) ? (v0 > a1[1][3]) : (92 < a1[3][4])));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v2 = (((34 ? 90 : 53) >= (31 / 9)) - ((v2 && v3) == (v1 + 91)));
+                v3 = (((i5 < a0[7]) > (v0 - i5)) && ((a0[14] / 1) >= (a1[3][15] < a1[1][14])));
+                a1[3][13] = (((i4 ? a1[0][9] : a1[2][5]) != (v3 || v3)) <= ((v2 >= a1[2][15]) && (i4 - a1[1][4])));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        v1 = (((a1[1][15] * v2) && (v0 && 7)) >= ((v2 / 4) && (v2 >= v0)));
+        v1 = (((76 <= v1) != (v0 && 4)) == ((5 * v1) + (a0[8] || 3)));
+    }
+    return (((70 / 2) + (a0[11] - v0)) ? ((v3 <= a0[9]) != (a0[10] && 62)) : ((v1 <= v3) || (55 / 9)));
+}
+int main() {
+    return 0;
+}
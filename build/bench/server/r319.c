@@ -0,0 +1,127 @@
+int f0() {
+    int v0 = 89;
+    int v1 = 22;
+    int v2 = 2;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    a0[13] = (((80 + v2) > (67 < 69)) == ((v1 && i1) == (i0 * a0[3])));
+                    v1 = (((v0 && a0[1]) != (66 >= v2)) % 2);
+                    v0 = (((a0[1] ? a1[3][7] : v3) ? (a0[4] / 8) : (31 ? a0[10] : a1[2][14])) <= ((i1 * v1) && (i1 || v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            a0[3] = (((v2 - v2) ? (57 && v2) : (v3 != a0[9])) == ((80 >= i0) ? (i0 <= a0[11]) : (v3 ? v2 : v0)));
+            v0 = (((v1 >= i0) * (v2 && a0[6])) / 9);
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v0 = (((75 ? a1[3][1] : v1) == (a1[1][2] * a1[0][2])) <= ((a1[1][11] ? 75 : 14) + (28 > i2)));
+            v1 = (((57 < v1) != (a0[1] >= 49)) / 2);
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((a1[1][2] <= i2) >= (v1 / 1)) == ((24 + a1[0][3]) <= (v0 + 88)));
+                v1 = (((28 % 3) - (81 <= v3)) ? ((v3 >= 99) != (v2 + a1[1][9])) : ((v1 * v2) != (a1[3][6] <= v1)));
+                v0 = (((a0[7] ? v3 : v0) / 1) && ((a1[2][6] ? 8 : a1[1][0]) - (a1[0][6] != 48)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a0[3] = (((i4 || 22) <= (v2 ? v2 : a0[10])) && ((i4 + a0[7]) == (v3 <= a0[12])));
+        a1[1][15] = (((a1[1][1] + v0) % 2) || ((i4 || v3) % 7));
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                a1[2][10] = (((a1[1][5] ? i4 : i5) * (2 <= a1[2][5])) ? ((a0[14] != v2) == (v1 + i5)) : ((a1[3][10] <= a0[9]) ? (i4 == a1[1][12]) : (v0 >= v2)));
+                v0 = (((i5 && i4) % 3) / 7);
+                v2 = (((33 < v0) && (i4 == 18)) % 6);
+                i5 = i5 + 1;
+            }
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            v1 = (((10 > a0[3]) % 9) ? ((27 != a0[4]) || (a0[0] * 28)) : ((i6 - v2) % 9));
+            a1[2][4] = (((v2 != 77) ? (a1[3][12] && v0) : (v1 <= v0)) / 1);
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v0 = (((27 - i7) * (97 == 85)) && ((v3 == a0[13]) * (i6 < v2)));
+                    a1[1][0] = (((a1[1][8] + a0[8]) && (i7 || a1[0][11])) < ((47 > v1) >= (i7 ? 20 : v2)));
+                    a0[14] = (((v3 - v3) + (a0[0] >= a0[2])) + ((v1 && 9) || (a0[3] >= v0)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    v3 = (((26 >= 74) != (0 / 2)) > ((v2 + a1[1][10]) * (a0[5] / 4)));
+    return (((a1[0][1] == 46) == (v2 + a1[2][0])) <= ((v1 || v1) && (v3 || v3)));
+}
+int f1() {
+    int v0 = 23;
+    int v1 = 74;
+    int v2 = 30;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    if ((((28 > v1) != (v2 ? a0[15] : v2)) * ((87 * 70) - (v3 <= 60)))) {
+        a1[2][0] = (((v1 ? v1 : 29) || (3 + v3)) && ((v0 < a1[2][0]) != (v2 == v3)));
+        a1[2][13] = (((11 * a1[1][10]) % 5) - ((v1 * v2) && (v2 < 63)));
+        a0[3] = (((49 == a0[10]) + (a1[2][3] * v1)) - ((v0 >= a1[0][10]) * (v2 ? v1 : 92)));
+    } else {
+        v0 = (((a1[1][11] > v3) ? (a0[4] - a1[1][14]) : (v2 * v0)) > ((61 ? v3 : a1[1][3]) - (v0 - v2)));
+        v3 = (((v1 < a1[1][10]) || (v2 / 1)) <= ((a1[1][13] % 6) != (v1 == 55)));
+        a0[4] = (((89 - v1) == (v3 && v0)) >= ((a1[0][1] != 40) >= (a0[8] % 9)));
+    }
+    if ((((34 * a1[3][9]) + (74 > 29)) != ((v1 == 35) ? (v1 + v2) : (v0 ? v2 : 5)))) {
+        v2 = (((v0 - 79) < (v0 ? 56 : a0[12])) / 8);
+        v1 = (((v0 == v2) * (v2 % 4)) / 7);
+        v1 = (((v0 <= v1) * (38 < 60)) > ((11 == v2) - (v2 - v0)));
+    } else {
+        v0 = (((v1 >= a0[11]) * (a0[9] + v3)) < ((36 + a1[0][1]) < (v3 != v0)));
+        a0[14] = (((38 > v1) - (v3 ? 48 : v2)) ? ((1 * 22) != (47 > a1[3][14])) : ((16 <= v2) > (v2 / 4)));
+        v2 = (((v2 % 7) > (v3 + v1)) < ((a0[9] < a0[14]) != (v1 < v2)));
+    }
+    a1[2][0] = (((a0[5] < v3) == (v3 ? v2 : v2)) ? ((a1[1][14] == v0) <= (v0 >= a1[1][6])) : ((76 < a0[2]) < (47 / 5)));
+    {
+        int i0 = 0;
+        do {
+            v2 = (((86 <= a1[2][5]) ? (a1[1][11] <= i0) : (v3 - i0)) % 4);
+            v0 = (((v3 ? 45 : v2) <= (v0 == i0)) - ((a1[2][11] <= 3) <= (24 * v3)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    a0[2] = (((a1[1][12] / 3) || (v3 / 1)) && ((25 == a1[3][11]) + (a1[2][5] && 41)));
+                    v1 = (((a1[2][8] ? v0 : 11) == (a0[5] != v1)) < ((v2 < 90) ? (v3 && v1) : (v0 || a1[1][15])));
+                    v3 = (((v2 ? a1[0][11] : i0) != (65 < v1)) != ((v1 % 1) - (v0 == 7)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((a1[1][2] <= v0) < (a0[6] > 14)) < ((v3 + a0[1]) && (a1[3][11] ? 58 : a0[9])))) {
+        v1 = (((a1[0][13] > a0[0]) >= (v2 == 7)) <= ((a0[4] % 7) - (10 || v0)));
+        v3 = (((48 + 15) / 8) % 1);
+        v2 = (((v1 || a1[1][5]) < (a1[0][10] * 44)) ? ((v1 <= a1[2][5]) <= (v1 ? v1 : 34)) : ((v0 ? a1[0][13] : v3) <= (a1[0][14] - 59)));
+    } else {
+        v0 = (((v0 <= a1[0][7]) == (v2 && 3)) % 3);
+        v2 = (((a1[2][14] <= v0) || (v3 != v1)) > ((34 == a0[9]) == (v1 * v0)));
+        v2 = (((v2 % 9) || (0 > v2)) < ((v3 != v3) % 8));
+    }
+    return (((v0 % 5) % 7) * ((v0 < 52) % 3));
+}
+int main() {
+    return 0;
+}
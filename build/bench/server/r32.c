@@ -0,0 +1,152 @@
+int f0() {
+    int v0 = 68;
+    int v1 = 3;
+    int v2 = 20;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 >= v0) < (v1 < v0)) <= ((v2 >= 74) / 7))) {
+        v1 = (((v2 >= v0) ? (v1 % 7) : (v3 ? a1[3][7] : v3)) - ((a0[2] + a0[7]) % 5));
+        v1 = (((a1[1][15] >= v2) - (v0 ? 76 : v0)) || ((4 / 7) >= (v2 <= a0[6])));
+        v1 = (((v1 - v3) % 4) && ((92 == 56) <= (v2 <= 65)));
+    } else {
+        v2 = (((93 > v3) ? (a1[3][8] % 6) : (v2 % 5)) <= ((v2 || v2) == (a0[15] >= a0[13])));
+        v1 = (((v0 && 20) - (a0[12] % 8)) && ((a0[1] < v3) * (v3 - 6)));
+        v1 = (((v0 > v2) % 1) > ((v2 && v3) ? (v2 - v2) : (a0[8] ? 40 : a0[7])));
+    }
+    v0 = (((v3 * 14) - (a0[11] ? v3 : 82)) - ((a0[0] >= 89) * (a1[2][7] + 6)));
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((v2 && 13) > 56) break;
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a0[9] = (((i1 ? v1 : i1) ? (i0 * i0) : (i1 == i0)) >= ((v0 % 4) % 9));
+                    v0 = (((29 * a0[7]) - (i1 / 2)) % 1);
+                    v2 = (((v2 / 5) * (a0[14] <= i0)) / 9);
+                    i1 = i1 + 1;
+                }
+            }
+            a0[13] = (((v1 / 5) <= (a0[9] >= v0)) * ((v1 == v3) > (99 == v3)));
+            v1 = (((32 != v1) >= (v1 ? v0 : 7)) % 6);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a1[1][15] = (((a0[15] != 45) / 1) % 7);
+            v2 = (((81 / 6) == (i2 + a0[4])) / 5);
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v3 = (((i3 == v1) != (99 < a0[11])) ? ((73 >= v0) ? (i2 ? i2 : a1[3][1]) : (v1 + a0[13])) : ((v1 * v0) - (v3 % 8)));
+                v2 = (((v2 / 2) >= (57 <= v0)) + ((i2 * a0[6]) - (i3 ? a1[1][0] : v0)));
+                a1[1][0] = (((v2 % 1) <= (i2 <= v0)) * ((58 > v3) >= (a0[3] * a0[13])));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((98 ? a1[1][7] : v0) ? (v3 * 59) : (a0[8] > v1)) + ((v1 || a1[1][6]) == (a0[14] >= 99)));
+    return (((23 != a0[13]) && (v0 <= a1[1][15])) - ((v0 && v1) + (13 <= 14)));
+}
+int f1() {
+    int v0 = 27;
+    int v1 = 61;
+    int v2 = 20;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    a1[1][10] = (((v0 > 22) - (a1[3][11] == a1[0][8])) ? ((v1 == 7) && (v3 / 8)) : ((25 / 6) != (83 ? v2 : v1)));
+    if ((((v3 ? v2 : v2) != (v0 % 2)) <= ((v3 || a0[13]) < (v1 * v0)))) {
+        v1 = (((a1[1][5] <= 14) ? (v1 / 1) : (v2 * a1[0][14])) ? ((v2 < 88) ? (42 % 1) : (a0[8] * a0[0])) : ((5 ? 1 : v0) ? (v1 || v2) : (v3 || v2)));
+        v2 = (((a0[2] ? v2 : v0) == (5 % 1)) <= ((v0 - 37) > (a0[1] && 78)));
+        v0 = (((v2 % 4) / 8) >= ((v3 - 17) > (96 < a0[10])));
+    } else {
+        a1[2][12] = (((a1[3][3] >= a0[2]) != (a1[1][1] + v3)) * ((v0 >= 2) ? (a0[2] % 2) : (v2 == v1)));
+        v3 = (((v3 || v3) * (v2 * a0[10])) - ((13 ? a1[0][13] : a1[2][14]) < (v1 % 7)));
+        v3 = (((a0[14] <= 98) + (v3 ? v2 : a0[1])) + ((v1 % 9) <= (v2 - v0)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v0 = (((v1 / 7) >= (93 || a1[1][12])) <= ((2 ? v3 : a0[4]) < (v0 <= 90)));
+        v1 = (((69 - v2) < (a0[2] > v0)) <= ((a1[2][5] % 9) % 5));
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v0 = (((a0[11] <= 64) < (a0[8] == 81)) % 5);
+            a0[9] = (((a0[11] % 5) < (v2 == 88)) >= ((v2 ? 89 : a1[2][14]) <= (v3 ? 52 : a0[7])));
+            v1 = (((v3 / 2) + (v3 % 2)) > ((a1[2][6] % 5) - (v3 == v3)));
+        }
+    }
+    v1 = (((v0 != 58) + (44 == 84)) != ((v0 == v3) != (v2 >= v1)));
+    if ((((26 ? a1[1][3] : v3) ? (v0 >= v2) : (v3 - a0[4])) != ((v3 > 89) != (v1 * a1[1][15])))) {
+        v0 = (((v0 % 8) && (14 < v2)) || ((v3 * 81) && (89 && v0)));
+        v2 = (((v0 / 1) % 7) != ((v0 != v0) || (a1[3][5] ? v1 : 93)));
+        v3 = (((73 * v2) ? (v3 * a1[1][8]) : (a0[10] <= a1[1][5])) - ((78 && 12) || (v2 && v3)));
+    } else {
+        v3 = (((v3 != v2) || (v0 - a0[11])) > ((v0 != v2) <= (a0[11] / 6)));
+        a1[2][1] = (((v0 ? a1[0][14] : a0[7]) != (a0[9] / 8)) || ((v2 % 2) + (v0 % 1)));
+        v2 = (((68 || 76) % 7) || ((v1 || 64) != (v1 && 5)));
+    }
+    return (((v2 > v3) <= (v1 == a0[3])) && ((v3 > v0) / 3));
+}
+int f2() {
+    int v0 = 46;
+    int v1 = 4;
+    int v2 = 9;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a1[3][0] = (((23 - v2) != (35 || v1)) * ((v0 % 2) <= (i1 == v3)));
+                    v1 = (((v0 ? i1 : v0) != (42 && i1)) != ((v2 <= a0[15]) >= (v0 - v0)));
+                    a1[2][0] = (((i1 % 5) && (v1 + a0[5])) ? ((38 * v3) || (v1 >= a1[1][12])) : ((74 >= v0) ? (v1 - v3) : (i0 != v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v0 * i0) || (a0[9] * a1[1][3])) <= ((26 >= i0) <= (a0[12] ? a0[11] : v2)));
+            a0[15] = (((v3 != a1[1][3]) * (a1[0][10] <= v2)) || ((v3 * a0[6]) ? (8 % 5) : (v1 % 7)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((a1[0][0] ? v1 : 14) ? (v1 <= v3) : (v1 ? v1 : v1)) >= ((v3 - a1[0][10]) == (v2 < v0)))) {
+        a0[11] = (((v1 && v1) % 7) < ((v0 ? v0 : v1) - (27 || v3)));
+        a1[0][10] = (((a1[2][10] != v0) > (v1 == 99)) ? ((a0[13] < a1[3][2]) <= (v1 * v0)) : ((v2 > v2) == (64 > v0)));
+        v0 = (((v2 < 19) != (v0 + 34)) >= ((v1 == 47) + (v3 < a0[2])));
+    } else {
+        v1 = (((v3 != 82) > (v1 || 0)) + ((a1[0][12] * v2) % 4));
+        a0[11] = (((v3 > v1) - (v3 * a0[4])) % 3);
+        v1 = (((v0 > v3) / 9) >= ((13 || a1[0][6]) || (v2 - v1)));
+    }
+    v3 = (((v3 && v1) ? (v1 >= v2) : (a0[14] - 97)) <= ((v3 > 46) > (72 ? a0[0] : a0[15])));
+    v0 = (((a1[3][9] + v3) || (a0[3] / 9)) / 6);
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((a1[2][11] ? v1 : v3) > 91) break;
+            v0 = (((v1 + v0) / 6) != ((i2 > v0) && (83 / 4)));
+            a1[0][1] = (((v3 == i2) >= (v1 - 40)) ? ((i2 / 3) + (87 == 59)) : ((v1 && v1) - (58 < v2)));
+            {
+                int i3 = 0;
+                do {
+                    if ((15 >= 81) > 97) break;
+                    a0[4] = (((68 / 7) - (i3 >= 57)) ? ((59 && i2) <= (v0 != v3)) : ((v3 <= v2) != (88 == a0[12])));
+                    a1[3][2] = (((a1[3][11] * a1[3][1]) || (v3 >= v3)) != ((a1[1][1] - a0[13]) + (v0 % 7)));
+                    a0[5] = (((v0 && i3) - (25 - 25)) <= ((a0[14] * v0) >= (v0 * 85)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((a1[2][4] + 3) != (v2 && a0[15])) / 9);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,205 @@
+int f0() {
+    int v0 = 28;
+    int v1 = 50;
+    int v2 = 36;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((v0 ? 23 : 65) > 58) break;
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((v2 - i0) > 87) break;
+                    v3 = (((v1 - i0) > (a0[11] / 8)) <= ((62 != v3) == (i1 || 67)));
+                    a0[5] = (((i1 != v0) - (v0 == a0[2])) * ((a1[3][0] * i0) - (31 > 42)));
+                    v3 = (((a1[1][10] * 55) ? (a1[0][15] * i0) : (a1[1][2] != a0[10])) >= ((a1[2][8] && v3) != (v2 == v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a0[15] && 25) - (v0 < 12)) ? ((v0 - a1[0][7]) ? (71 || v2) : (a0[7] % 5)) : ((v1 / 8) == (3 * v1)));
+            a0[12] = (((v3 <= v1) > (i0 % 3)) % 6);
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((74 ? a0[7] : a1[1][9]) <= (v0 > v2)) + ((97 >= v2) * (90 >= v0)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v3 = (((7 && 97) - (v0 * v1)) > ((50 && v3) - (22 && a0[4])));
+            v0 = (((v3 ? a0[5] : i2) - (88 * 40)) == ((i2 % 2) == (i2 > 26)));
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[13] - i2) > 80) break;
+                    v1 = (((2 / 4) % 2) ? ((a1[1][5] != 2) > (i2 + a1[1][14])) : ((v1 - v3) < (i2 - a1[2][14])));
+                    a1[0][13] = (((v2 + a0[2]) && (v0 > 54)) ? ((i2 > a0[3]) + (82 ? i3 : 44)) : ((9 || a0[12]) && (v1 != 37)));
+                    v3 = (((v3 <= 97) <= (a0[1] != i3)) < ((v2 - i2) % 2));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v1 == i4) > (v1 > v0)) + ((v0 - v0) < (a0[8] % 4)));
+            {
+                int i5 = 0;
+                do {
+                    if ((98 || v2) > 81) break;
+                    a1[1][1] = (((26 > a1[2][7]) == (i5 >= i5)) - ((a0[6] != v0) > (90 > 6)));
+                    v0 = (((21 + a1[0][15]) - (a1[1][6] ? 28 : v3)) <= ((v2 != v1) != (v3 < v3)));
+                    a0[2] = (((i4 > v1) * (i5 ? i5 : 13)) || ((v3 != 99) == (12 / 5)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v2 = (((v3 == a1[2][7]) < (72 / 4)) > ((22 || a1[0][11]) + (v3 + v3)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    v1 = (((47 || v1) <= (v0 > 20)) < ((v3 / 6) + (a1[0][2] == 12)));
+    return (((a0[1] <= v1) == (v2 >= v0)) >= ((v0 != a1[2][0]) > (v1 && v1)));
+}
+int f1() {
+    int v0 = 95;
+    int v1 = 22;
+    int v2 = 92;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((76 && 89) > 72) break;
+            {
+                int i1 = 0;
+                do {
+                    a1[1][11] = (((a1[3][0] < i0) && (v2 <= a1[1][1])) == ((53 <= 35) - (v3 || v0)));
+                    a1[2][13] = (((82 != v1) > (22 >= v1)) - ((a0[3] ? a1[2][14] : a1[3][13]) > (a0[12] > v3)));
+                    v0 = (((i0 <= v2) + (a1[1][15] < i0)) + ((a1[0][4] <= 50) % 3));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v1 = (((i0 - v3) <= (v3 * 46)) == ((v0 == a1[3][12]) && (v2 ? i0 : a0[9])));
+            v2 = (((a1[1][8] * v2) / 1) != ((a1[1][11] > i0) ? (v0 && v1) : (a0[15] <= 37)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            {
+                int i3 = 0;
+                do {
+                    if ((i2 ? v1 : i3) > 95) break;
+                    v1 = (((i2 / 8) > (a1[3][5] >= 16)) && ((v3 % 6) && (25 * 5)));
+                    a1[2][13] = (((i3 ? v3 : a1[0][11]) == (i2 >= a1[3][6])) || ((59 != v2) != (v3 <= a0[15])));
+                    a1[3][8] = (((v1 / 3) ? (v3 + i3) : (v3 / 5)) - ((v0 && a1[3][6]) / 3));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            a0[2] = (((v2 != a0[4]) == (51 != 91)) < ((v0 && v3) - (5 == v0)));
+            v2 = (((36 * v2) && (i2 / 5)) <= ((v0 % 3) - (77 ? 18 : 82)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((18 && a1[1][0]) / 1) == ((v3 == v3) < (v0 + a0[3])));
+            v3 = (((54 || v3) == (v0 >= i4)) < ((v0 ? 43 : a0[13]) < (v1 > 38)));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((v2 / 5) < (73 + v1)) <= ((a1[2][2] - a1[1][3]) || (a1[1][13] >= i5)));
+                    v0 = (((a1[3][2] * a0[8]) ? (a1[2][1] > i4) : (a1[3][8] == v0)) != ((a0[12] && i5) ? (i5 == v1) : (v3 != i4)));
+                    v2 = (((v3 - v0) ? (a1[3][10] - 33) : (a1[1][11] + i5)) >= ((i4 % 4) >= (71 - a0[15])));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((a1[0][2] <= v1) > 55) break;
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((i7 || v0) < (a0[13] == v3)) <= ((a0[7] > a0[5]) ? (i7 / 7) : (a0[1] <= 83)));
+                    a1[0][8] = (((i6 && i7) > (79 % 3)) < ((a1[2][1] > a1[0][2]) ? (v3 * 12) : (v1 == 92)));
+                    v0 = (((a0[8] > v2) + (10 / 7)) ? ((v3 < v3) * (85 && a1[3][14])) : ((v1 >= v0) ? (i6 ? a1[3][5] : i7) : (v2 || 61)));
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            v0 = (((13 >= 9) && (v1 && i6)) / 3);
+            v1 = (((v3 - a1[0][3]) + (i6 / 8)) || ((v1 ? a1[0][10] : v3) * (59 % 5)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    if ((((77 > v2) <= (84 / 6)) >= ((a0[9] / 7) ? (a1[2][9] <= a0[14]) : (a0[15] ? v1 : 57)))) {
+        a0[9] = (((a1[0][2] < v1) == (a1[2][5] || v1)) && ((53 != v2) % 1));
+        a1[0][15] = (((84 < a1[0][15]) % 3) * ((84 != a1[2][14]) / 7));
+        v0 = (((v3 - v1) == (v3 && a1[0][9])) / 5);
+    } else {
+        a0[9] = (((5 ? v2 : v1) / 9) > ((v2 ? a1[1][1] : a0[7]) >= (v3 >= 76)));
+        v3 = (((v0 == a0[12]) < (v3 ? v2 : v3)) == ((a0[12] % 8) / 6));
+        v2 = (((v2 > 69) ? (a0[4] + v1) : (55 > 67)) % 6);
+    }
+    return (((16 % 8) - (38 > a1[2][0])) >= ((10 >= v0) + (v2 <= v3)));
+}
+int f2() {
+    int v0 = 93;
+    int v1 = 93;
+    int v2 = 22;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 ? v0 : a1[1][8]) - (92 > v3)) / 9);
+    v0 = (((v2 ? v0 : a1[1][12]) != (v1 / 9)) % 9);
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a0[3] = (((i0 < v0) > (a1[0][15] / 5)) * ((v3 == i0) <= (a1[2][12] <= 13)));
+            v2 = (((v0 >= 18) < (a0[7] ? v1 : v2)) < ((v2 - v0) % 7));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((i0 == 24) % 5) - ((v3 <= a1[0][1]) != (v1 * v3)));
+                    v0 = (((v3 != v1) * (v1 != 3)) <= ((41 ? 12 : 77) >= (v1 >= 99)));
+                    a0[9] = (((a1[2][5] != i0) / 8) / 2);
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((a0[8] / 5) > 94) break;
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v1 = (((a1[2][2] ? 15 : 87) >= (v2 > 96)) % 9);
+                    v2 = (((v0 % 2) ? (16 + 93) : (v3 / 9)) == ((a0[5] != a0[12]) >= (v3 * i3)));
+                    a1[1][0] = (((a1[1][4] && i3) || (a1[3][11] < v0)) != ((a0[13] == 23) <= (14 >= a0[15])));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v1 <= a1[3][13]) / 9) != ((v1 * 67) <= (v1 || v3)));
+            v0 = (((v3 ? a0[7] : a1[3][5]) ? (14 ? v0 : v2) : (12 ? v1 : v2)) ? ((a1[0][3] != a0[10]) < (9 % 6)) : ((6 + v0) + (a0[4] && a1[1][0])));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v2 > v0) * (a1[2][3] >= v3)) == ((v3 * v3) ? (v1 == 40) : (41 ? a0[8] : v1)));
+    return (((a0[15] == 95) ? (95 ? v2 : v2) : (v3 ? 17 : v1)) ? ((v3 == v1) - (a0[2] && 24)) : ((v3 + 97) >= (v0 ? v2 : v1)));
+}
+int main() {
+    return 0;
+}
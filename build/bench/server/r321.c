@@ -0,0 +1,51 @@
+int f0() {
+    int v0 = 4;
+    int v1 = 45;
+    int v2 = 73;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        a0[15] = (((a1[3][6] && i0) * (v0 == v2)) < ((a0[3] - a0[1]) < (v0 < 82)));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                if ((a1[3][7] / 1) > 94) break;
+                v0 = (((v2 + 30) % 5) <= ((a0[2] <= a0[13]) / 3));
+                v1 = (((v1 && v1) + (65 + a0[15])) - ((59 % 8) != (i1 * 61)));
+                v2 = (((a1[3][9] ? v0 : i1) < (a1[1][0] % 7)) - ((37 || 43) == (v1 + a0[3])));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((v0 * v3) + (v0 < a1[3][9])) > ((a0[12] ? a0[14] : 28) != (a0[0] / 8)));
+    }
+    if ((((v3 + v0) || (74 != v3)) > ((v0 % 5) - (a0[15] > v2)))) {
+        v0 = (((a1[0][0] / 4) && (a0[8] && v1)) ? ((v1 != v2) >= (v1 >= a0[14])) : ((v3 + v2) == (v2 + 94)));
+        a0[3] = (((v1 || v2) || (a0[0] == a0[9])) && ((v1 == 62) + (a1[2][11] <= a0[9])));
+        v3 = (((57 ? v3 : v3) || (64 / 6)) && ((a0[14] && a1[3][7]) < (a0[8] * v2)));
+    } else {
+        v3 = (((70 >= a0[0]) && (v2 >= 44)) != ((v1 <= 48) || (v2 != v1)));
+        v1 = (((v1 - a0[2]) < (v1 != 2)) ? ((v0 * 7) - (54 - a1[3][2])) : ((40 != 90) != (v3 / 9)));
+        v1 = (((v2 / 7) + (v1 != v0)) % 6);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                if ((v1 || i3) > 52) break;
+                v3 = (((a0[5] ? i2 : v1) + (v1 >= i3)) % 5);
+                v1 = (((v0 <= i2) < (a1[2][6] < v0)) - ((v0 <= 76) || (v2 + i2)));
+                a1[0][15] = (((i2 * a0[2]) == (v2 * a1[2][14])) - ((v2 < v0) && (v3 % 7)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v3 && v3) || (a1[0][4] > a1[0][9])) / 2);
+        v0 = (((a1[2][4] * i2) / 3) / 3);
+    }
+    v0 = (((a1[0][9] >= v2) * (95 >= a1[2][13])) > ((v0 <= a1[0][13]) ? (v2 <= v1) : (28 ? v1 : v0)));
+    v2 = (((12 && v3) * (a0[9] || a0[13])) != ((6 + v0) + (v0 && v3)));
+    return (((6 > a1[0][8]) <= (v0 * v2)) ? ((a1[1][6] < 77) || (v3 || v0)) : ((v0 < a1[3][13]) != (v2 - a1[0][14])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,138 @@
+int f0() {
+    int v0 = 72;
+    int v1 = 2;
+    int v2 = 20;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 + v1) - (v0 * v0)) != ((a0[7] <= 24) && (v1 >= v0)))) {
+        v1 = (((16 % 1) ? (a0[4] || v3) : (v3 < a1[2][12])) <= ((v3 * 94) % 4));
+        v0 = (((95 && v0) == (a1[3][6] >= 53)) % 6);
+        a1[3][14] = (((v0 || v2) < (a0[11] ? a1[0][5] : a0[8])) >= ((90 + v3) >= (v1 - v3)));
+    } else {
+        a0[13] = (((67 > a0[0]) || (v0 && v2)) % 4);
+        v1 = (((v2 * 18) == (v3 * a0[11])) * ((48 ? 99 : v0) != (a1[3][6] ? a1[2][12] : v0)));
+        v0 = (((v2 < a0[10]) && (a0[9] >= 83)) || ((a0[7] + 35) > (v3 * v0)));
+    }
+    v0 = (((a0[0] + a0[12]) >= (v0 ? v2 : v1)) && ((a1[2][6] < v1) != (v3 % 2)));
+    {
+        int i0 = 0;
+        do {
+            v2 = (((i0 / 9) <= (v3 >= a1[0][11])) * ((v3 && v3) <= (a1[3][3] / 8)));
+            v2 = (((5 - 46) * (v2 != 77)) == ((16 == v0) * (v3 || v1)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    if ((a0[7] < 16) > 57) break;
+                    v3 = (((13 <= a1[0][4]) ? (17 + v0) : (i0 / 5)) ? ((45 * 35) * (71 % 4)) : ((v2 * v0) - (i0 != 87)));
+                    v0 = (((i1 / 3) ? (v0 < i1) : (v1 <= 0)) >= ((62 && i1) % 6));
+                    a0[0] = (((a0[6] % 1) < (a0[14] > a0[10])) && ((92 >= 1) >= (11 >= v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((86 - a0[14]) <= (28 || 96)) / 3);
+                    a0[10] = (((56 <= v2) == (i2 - a1[3][3])) || ((8 % 8) ? (a1[1][5] - 61) : (a1[3][9] < i2)));
+                    v3 = (((i3 > i2) / 2) != ((a0[6] + i3) < (84 > i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v0 = (((i2 + v0) != (v0 < a1[1][12])) + ((58 != v3) + (v3 ? 86 : v2)));
+            a0[6] = (((25 / 2) - (82 <= v3)) ? ((v3 != v3) * (v0 - 51)) : ((v0 <= 29) / 8));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[6] <= v2) || (a0[6] * a0[3])) % 5)) {
+        v3 = (((a0[9] ? v1 : 13) ? (v3 * v1) : (v1 / 9)) <= ((v0 ? a1[0][7] : 38) ? (v3 / 8) : (2 ? v2 : v3)));
+        a1[1][7] = (((51 == v1) < (a0[1] && 72)) % 4);
+        v3 = (((v2 == 68) - (2 % 5)) != ((v0 % 3) ? (a0[11] - a0[7]) : (a1[1][13] && v0)));
+    } else {
+        a1[2][13] = (((51 * a0[4]) || (12 == v1)) / 7);
+        v3 = (((v1 * v1) ? (v3 * a1[0][10]) : (v1 >= a0[7])) && ((53 >= a1[2][6]) == (a1[1][8] < a1[1][10])));
+        v1 = (((v2 || a1[3][1]) && (v1 / 3)) ? ((v1 ? 34 : v3) ? (v3 ? 93 : a1[0][6]) : (a0[4] != v3)) : ((36 || v3) <= (v2 < v0)));
+    }
+    return (((v1 < v1) / 4) ? ((v2 ? 46 : a0[14]) ? (v3 ? a1[0][6] : a0[9]) : (v3 > a1[2][4])) : ((v0 ? a1[0][11] : v1) != (a0[2] == v0)));
+}
+int f1() {
+    int v0 = 9;
+    int v1 = 87;
+    int v2 = 86;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[11] = (((v1 + v3) - (v1 == i0)) >= ((48 > 77) > (a0[12] % 1)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a0[14] = (((32 ? v3 : a1[2][8]) <= (45 ? v0 : 62)) / 7);
+                    a0[0] = (((v3 * v1) - (29 == v0)) + ((v1 - i1) < (i1 || v0)));
+                    v1 = (((i1 * 35) != (v2 || 91)) && ((v1 && v3) > (v2 < v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v3 + i0) * (v0 ? a0[0] : v2)) + ((a1[1][0] % 8) >= (a0[7] >= v2)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((17 != v2) > 75) break;
+            v2 = (((i2 ? a1[2][0] : v3) ? (v1 > 39) : (v0 || i2)) - ((v2 ? a0[15] : a1[3][12]) == (30 == a1[0][0])));
+            a0[15] = (((v3 >= a0[5]) >= (v0 == i2)) >= ((v2 <= v3) != (v2 + v2)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v1 = (((45 * v1) || (97 == a0[3])) ? ((v0 ? 29 : i2) / 3) : ((a0[4] > 30) - (i2 < 38)));
+                v2 = (((26 ? a1[1][6] : a0[15]) ? (i2 % 2) : (i2 < 67)) || ((v1 ? 7 : 69) ? (a0[5] + 9) : (10 / 9)));
+                v2 = (((i2 % 9) / 5) * ((a1[2][0] % 1) == (v3 ? v2 : v2)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((7 - a0[14]) ? (0 <= v1) : (49 || a0[15])) >= ((a0[4] <= a1[3][14]) > (a0[7] > v0)))) {
+        a0[11] = (((v2 >= v0) >= (v3 && v1)) == ((v3 < v3) % 8));
+        v3 = (((17 || v0) >= (v0 && v0)) - ((a0[9] * v0) && (55 < v2)));
+        v1 = (((v1 / 3) >= (96 - v3)) || ((a0[2] % 3) == (v2 > v1)));
+    } else {
+        v3 = (((69 - v1) < (v2 && v1)) > ((a0[12] > v3) * (a0[6] / 4)));
+        v3 = (((a1[1][11] || 84) / 8) <= ((v0 ? 54 : v2) ? (a0[12] >= v2) : (v3 / 5)));
+        a1[2][5] = (((a0[12] ? v2 : a1[3][3]) > (v2 <= v2)) % 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v1 > v1) > 65) break;
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a1[1][2] = (((a1[1][6] && 52) < (v1 || v1)) < ((i5 || i5) - (v2 ? a0[11] : v1)));
+                v2 = (((a0[8] == 90) == (17 || v3)) == ((54 >= a0[8]) <= (i5 && v3)));
+                v0 = (((33 <= v0) <= (v1 >= 44)) ? ((43 * 9) || (i4 || a0[4])) : ((a1[0][12] < 11) + (v0 * v3)));
+            }
+            a0[2] = (((55 + v3) ? (i4 + v1) : (62 >= v1)) == ((a0[2] ? 11 : v2) <= (v3 >= v2)));
+            a1[1][14] = (((v3 ? v3 : v1) / 1) + ((a0[13] <= v1) <= (v0 + 1)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    if ((((48 / 8) || (v3 ? v1 : 99)) != ((a0[6] ? a0[6] : 77) >= (v0 == a0[8])))) {
+        v0 = (((v1 || v1) + (27 == 74)) > ((v0 / 6) ? (a0[11] / 7) : (v3 - v2)));
+        v0 = (((84 <= 99) / 6) && ((a1[1][2] * v3) * (v3 + v0)));
+        a0[6] = (((a0[0] / 3) == (4 < a0[3])) && ((a0[12] % 1) + (v2 != v2)));
+    } else {
+        a0[8] = (((78 < a0[2]) > (v3 < v1)) <= ((v0 >= v1) * (v1 && a1[3][5])));
+        a0[6] = (((v0 * 98) ? (v1 + v3) : (v1 && v3)) + ((v2 ? v2 : a1[2][12]) == (v3 / 2)));
+        a0[2] = (((v1 || v0) && (a0[8] >= 61)) >= ((v1 % 5) > (a1[3][14] / 2)));
+    }
+    return (((75 < v2) == (v0 <= a0[2])) >= ((9 <= a1[0][1]) <= (84 > a1[3][7])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,185 @@
+int f0() {
+    int v0 = 29;
+    int v1 = 72;
+    int v2 = 16;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            a1[3][3] = (((i0 ? v2 : v2) ? (a0[11] <= 15) : (a1[1][2] <= 30)) % 1);
+            v2 = (((v3 % 4) ? (a1[2][10] || v1) : (v2 % 3)) ? ((75 == v2) <= (a0[13] * i0)) : ((a1[0][13] - v3) - (23 + a0[1])));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((a1[1][13] > a1[0][5]) > 84) break;
+                    v1 = (((3 < v0) >= (v1 / 3)) || ((a0[0] != v1) - (v0 == v0)));
+                    a1[3][1] = (((a1[2][14] ? 35 : v3) == (i0 <= 10)) ? ((i1 + i1) ? (v0 / 7) : (26 != 69)) : ((v3 ? a0[12] : a0[13]) + (82 >= a0[12])));
+                    v1 = (((v3 > v1) - (v0 && 74)) <= ((87 != i1) % 3));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((a1[1][13] < 45) == (v0 - 19)) > ((a1[0][5] + 26) < (53 ? v3 : v2)));
+    if ((((a1[1][7] ? v2 : v2) + (a0[2] * 10)) % 1)) {
+        a0[11] = (((a1[2][7] >= a0[15]) ? (a1[0][9] == a1[3][11]) : (68 / 7)) + ((v1 ? 97 : v2) - (v0 ? a1[2][1] : a0[5])));
+        v0 = (((v3 == a0[5]) % 2) && ((v1 >= v2) && (v0 >= v2)));
+        v3 = (((67 + v3) && (v0 + v2)) > ((v0 && 43) * (v2 % 9)));
+    } else {
+        v0 = (((a0[15] * 57) > (26 - a0[4])) ? ((v2 != 96) || (a1[0][13] && v1)) : ((a0[3] <= a0[2]) / 2));
+        v0 = (((v0 < 51) ? (v0 ? v3 : v2) : (v0 > v1)) >= ((a1[1][7] * 35) && (v3 > v2)));
+        v0 = (((95 == 67) / 1) ? ((17 / 7) >= (v0 > 52)) : ((v1 + v1) / 1));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v0 ? 88 : v2) > 98) break;
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v3 = (((i3 == 50) * (59 - v1)) % 5);
+                v0 = (((v1 + i2) % 1) ? ((v1 || 45) != (i2 % 3)) : ((a1[3][2] * v1) > (v1 > a0[10])));
+                v2 = (((a0[6] - v2) >= (v0 ? a0[15] : a1[0][11])) == ((v1 + v0) * (87 + a0[9])));
+                i3 = i3 + 1;
+            }
+        }
+        a1[2][5] = (((i2 < i2) ? (a1[2][5] && a1[3][2]) : (a1[3][14] * v2)) > ((a0[3] - v2) ? (a0[8] > v0) : (v1 || v0)));
+        a0[14] = (((a1[3][1] ? a1[3][6] : v3) != (v1 + 71)) && ((a0[9] ? 70 : a1[2][13]) ? (73 / 9) : (a0[4] || a0[0])));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v1 = (((v1 >= v0) > (v2 - 76)) == ((a0[11] + v3) / 1));
+        v1 = (((i4 || a1[3][12]) < (43 != 60)) < ((v2 <= v3) ? (a1[2][2] - i4) : (26 >= i4)));
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                v2 = (((a1[1][7] != 50) >= (i5 < v0)) - ((i4 ? 67 : v1) != (i5 * v0)));
+                a1[3][13] = (((a0[8] > v3) == (94 >= a0[4])) != ((a1[3][3] * v1) < (a1[2][6] > v3)));
+                v2 = (((v3 || 55) ? (a1[1][4] - a1[1][9]) : (a0[11] ? v3 : a0[10])) ? ((87 % 1) * (v2 - a1[2][11])) : ((67 == i4) + (a1[0][14] || i4)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    return (((68 / 4) > (v1 / 4)) && ((a1[1][0] >= 38) && (45 / 7)));
+}
+int f1() {
+    int v0 = 98;
+    int v1 = 33;
+    int v2 = 70;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((v1 == v2) > 95) break;
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v2 = (((a1[0][2] * i0) ? (v0 <= v0) : (v1 % 7)) * ((36 == v3) >= (a1[2][12] <= 5)));
+            a1[0][3] = (((v3 + 62) % 3) && ((85 <= i0) != (v3 == v3)));
+            a1[2][7] = (((17 % 7) == (56 - v0)) > ((a1[2][6] >= 20) == (a0[10] ? a0[15] : v3)));
+        }
+        v0 = (((v0 ? v2 : a0[11]) * (v3 != a1[0][2])) || ((v2 + 63) > (v0 - i0)));
+        v3 = (((v3 != 35) && (v2 && a0[11])) * ((30 >= v1) >= (a1[0][2] >= 22)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v3 = (((v0 >= 72) >= (i3 != i3)) + ((a0[15] * 81) ? (a1[2][10] / 4) : (44 >= v3)));
+                    v3 = (((3 != a1[2][1]) < (a0[8] ? a1[0][5] : i2)) && ((i2 ? a0[1] : 39) >= (35 != i2)));
+                    v1 = (((i3 + v1) && (a0[15] % 7)) < ((a0[3] <= 97) + (82 >= i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[1][15] = (((v0 % 9) ? (v3 * 82) : (a0[0] % 7)) ? ((v1 ? 50 : a1[0][10]) + (a1[0][13] % 5)) : ((a0[8] ? v1 : 69) ? (v0 && v1) : (v3 != i2)));
+            a1[1][1] = (((80 / 1) != (a0[2] && i2)) != ((32 % 1) ? (v0 ? v0 : v0) : (a1[3][6] < 61)));
+            i2 = i2 + 1;
+        }
+    }
+    a1[0][0] = (((v2 + v0) == (v1 >= a1[1][1])) || ((a0[10] / 4) / 8));
+    if ((((a1[2][2] * 28) >= (a1[3][3] ? a0[6] : v1)) ? ((a1[1][6] && v0) ? (a0[3] != v3) : (v2 && a1[0][3])) : ((a1[0][4] * a1[2][8]) * (v2 * v3)))) {
+        v2 = (((26 ? a1[0][3] : 78) != (v2 - v2)) ? ((38 / 9) > (a0[8] ? v0 : a1[0][1])) : ((v3 + v1) % 8));
+        a1[1][4] = (((v3 * v2) % 8) <= ((47 ? v1 : v0) + (72 % 7)));
+        v0 = (((v2 - 22) > (a1[2][8] % 5)) % 7);
+    } else {
+        v2 = (((92 < a0[13]) ? (v0 % 9) : (95 + a0[13])) <= ((v1 < v0) % 4));
+        v1 = (((v1 % 4) >= (v2 ? v3 : v2)) >= ((85 ? v2 : 68) <= (a0[1] != v2)));
+        v3 = (((70 - a0[4]) <= (v2 > v0)) || ((26 >= v1) ? (v1 < 62) : (v3 && a0[15])));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[11] = (((88 == v2) + (9 < 3)) / 6);
+            {
+                int i5 = 0;
+                do {
+                    if ((a0[6] || 2) > 97) break;
+                    a0[0] = (((v1 / 1) + (v0 <= v3)) == ((i4 && v3) <= (i5 == v2)));
+                    v2 = (((v2 ? v3 : 7) || (a0[8] + a0[10])) >= ((v3 * v0) <= (a0[5] ? a1[2][0] : a1[0][10])));
+                    a1[1][9] = (((v0 != i5) ? (v2 > 46) : (v1 < v3)) && ((v1 < 96) / 1));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v1 = (((i4 != v0) != (a1[0][2] / 1)) ? ((a1[3][11] % 7) != (a1[2][2] + v0)) : ((a1[2][12] / 5) - (v2 % 9)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v2 + a0[7]) - (v0 % 6)) || ((v0 || 93) > (12 / 2)));
+}
+int f2() {
+    int v0 = 34;
+    int v1 = 47;
+    int v2 = 17;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v3 = (((51 * 67) ? (v3 || 89) : (88 || 79)) * ((v2 > v1) <= (i0 == i0)));
+            v3 = (((v2 >= 43) / 8) || ((v3 != v1) >= (a1[2][7] > i0)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((v1 && 51) && (a1[2][4] >= v1)) * ((v3 <= a1[0][3]) * (a1[1][1] <= v3)));
+                    a0[2] = (((i0 || a0[13]) || (a1[2][2] / 4)) > ((v1 ? v1 : v1) != (i0 >= v0)));
+                    a0[4] = (((a0[15] > v1) ? (a0[1] - i1) : (v0 * v1)) <= ((v2 - 99) && (a1[3][10] && v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[1][9] = (((v0 <= v2) || (a0[7] + a1[3][6])) <= ((v0 == i2) < (17 ? a1[0][10] : v3)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v1 = (((a1[1][14] ? i2 : 10) / 4) != ((v2 + a1[3][11]) / 1));
+                    a1[3][12] = (((6 >= a0[4]) + (v1 && a1[2][10])) < ((2 - v3) <= (i3 == v2)));
+                    a0[3] = (((10 <= a0[7]) <= (v1 + a1[0][2])) < ((v3 * v0) >= (a1[2][4] ? v1 : a1[3][15])));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((i2 == v1) + (37 - v3)) * ((v2 % 3) - (v0 - v2)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((a0[11] * v3) < (v3 * a1[2][6])) <= ((v0 < v2) / 6))) {
+        v3 = (((v3 ? v1 : a1[2][11]) ? (v2 + v0) : (73 && v3)) && ((v0 <= v2) * (v2 <= v1)));
+        v0 = (((v0 * a0[12]) > (v0 == v3)) ? ((a0[13] % 2) == (a0[3] && a0[7])) : ((v1 > v3) ? (v2 == a1[1][11]) : (a0[10] / 5)));
+        v1 = (((v3 ? v2 : v2) / 6) && ((v1 > v1) - (a0[9] - v3)));
+    } else {
+        v3 = (((v0 % 4) > (v2 / 7)) <= ((66 * v0) % 8));
+        v3 = (((v2 - 30) / 5) % 6);
+        v1 = (((a1[2][6] / 2) || (v3 ? v1 : a0[0])) >= ((a0[4] <= a0[10]) == (a1[0][3] > v0)));
+    }
+    a0[10] = (((v3 > v3) > (v3 == 18)) - ((v3 <= a0[1]) ? (88 != a1[3][1]) : (a1[2][11] < v1)));
+    a0[2] = (((77 < v1) ? (v3 % 4) : (v0 <= v1)) * ((v3 && v2) || (v2 ? v0 : 23)));
+    return (((a0[8] ? 4 : 16) - (v0 <= v1)) < ((36 - 62) % 6));
+}
+int main() {
+    return 0;
+}
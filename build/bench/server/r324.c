@@ -0,0 +1,46 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 49;
+    int v2 = 1;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v2 * a0[5]) != (v0 - a1[3][14])) != ((v2 * v3) - (14 && v2)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v0 = (((a0[14] - v3) ? (i0 + a0[11]) : (v1 >= v2)) < ((a1[2][13] % 2) ? (a0[10] - v1) : (29 + 43)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a0[14] = (((v0 <= v3) ? (a0[3] % 4) : (27 % 9)) < ((i0 || 67) != (i0 / 9)));
+                    a1[3][12] = (((v3 / 4) >= (a1[3][12] || a0[12])) + ((89 != a1[2][6]) && (v3 != a1[3][4])));
+                    v3 = (((36 - i1) && (v1 % 4)) < ((v3 != 3) ? (32 < i0) : (a0[11] % 9)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v1 ? 26 : 5) == (84 / 6)) < ((a0[3] != v2) - (61 ? v0 : v3)));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v2 < v3) > (v0 >= a1[1][6])) || ((v2 < v2) || (v1 || 27)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v0 = (((50 - v3) / 7) + ((v0 * a0[14]) <= (v0 && v2)));
+        v0 = (((v2 && a0[13]) ? (v2 * 6) : (i2 && v2)) || ((29 * 45) + (a1[2][15] == v3)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                if ((26 - a0[15]) > 62) break;
+                v2 = (((v0 < i3) - (99 && 9)) % 8);
+                v2 = (((i3 - i2) >= (v1 == i3)) && ((0 % 5) % 3));
+                a1[0][14] = (((i3 ? a1[0][9] : 70) && (a1[3][9] < v2)) % 9);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    a0[7] = (((v3 > v1) - (a1[1][2] - a1[0][15])) / 2);
+    return (((80 < a1[2][12]) ? (v1 < v1) : (v2 / 8)) ? ((v3 == v0) == (67 <= v3)) : ((v3 ? a1[2][11] : v2) * (a0[5] || 96)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,101 @@
+int f0() {
+    int v0 = 33;
+    int v1 = 88;
+    int v2 = 16;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((62 - 78) != (v3 > 74)) ? ((v1 <= v3) ? (v2 > a0[7]) : (a1[2][0] + a1[0][4])) : ((47 < v1) < (a0[15] * v2)));
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v3 + a0[13]) > (23 > i0)) != ((i0 || i0) ? (a1[0][6] / 3) : (i0 / 4)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((i1 ? i1 : 74) < (v0 / 9)) ? ((v2 + v1) % 4) : ((92 && v3) ? (a1[1][7] ? v1 : v1) : (v3 / 7)));
+                v0 = (((93 == i0) >= (v3 && v2)) - ((a0[13] * i1) > (v3 && v0)));
+                a1[0][6] = (((92 < v0) && (v2 + v3)) >= ((52 == a0[1]) != (v3 * 59)));
+            }
+            v1 = (((57 * 19) ? (v3 / 5) : (i0 % 8)) < ((v3 < a1[2][3]) / 3));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((v3 * v3) > 72) break;
+                v2 = (((a1[0][12] != 24) / 5) - ((i2 >= a0[10]) - (a0[14] != v3)));
+                a1[3][15] = (((98 != v2) / 7) > ((a1[3][14] || i3) * (91 / 1)));
+                v3 = (((v1 + v3) < (67 != a0[3])) == ((a0[5] <= 2) && (i3 != a0[9])));
+            }
+            v2 = (((a1[1][12] > v3) == (v2 % 3)) <= ((a1[1][6] > 28) == (3 * v2)));
+            v3 = (((v3 && v1) - (a0[12] > 30)) > ((i2 >= a1[0][4]) > (42 && 87)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    a1[3][15] = (((31 != 45) >= (v1 ? v1 : v3)) || ((78 > v1) > (v0 == v3)));
+    a1[1][15] = (((81 - v1) ? (v2 * v2) : (v3 < a0[4])) ? ((v2 <= v1) && (v0 > a1[0][7])) : ((a0[14] % 4) == (v1 >= a0[0])));
+    return (((v0 == a1[2][8]) ? (v0 && a0[0]) : (v0 + 66)) ? ((v1 != v0) <= (v3 != v3)) : ((55 % 2) + (v1 < v1)));
+}
+int f1() {
+    int v0 = 44;
+    int v1 = 34;
+    int v2 = 33;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[7] <= v2) == (a0[0] > 56)) >= ((a0[2] || a1[3][10]) || (a0[15] >= 67)))) {
+        v3 = (((4 ? 46 : v0) == (a0[7] - v2)) && ((65 ? 23 : v3) == (v2 + v3)));
+        a0[0] = (((v1 + v3) ? (v1 >= v2) : (v2 / 3)) || ((a1[0][4] >= a0[2]) && (a0[13] || v1)));
+        a0[8] = (((a0[1] - 21) >= (v0 % 1)) < ((58 == v1) % 5));
+    } else {
+        a1[1][3] = (((v0 ? v3 : v3) - (v3 - v2)) < ((v3 || a1[0][2]) != (v3 == v0)));
+        v2 = (((v1 ? a1[2][10] : 74) ? (v0 - a1[1][8]) : (97 ? v1 : v1)) / 1);
+        v0 = (((a1[2][4] - v1) / 8) || ((a0[15] - v1) != (69 - 8)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v1 = (((a1[1][14] == 81) <= (37 != v1)) || ((v1 && 74) ? (91 + v3) : (v3 ? v0 : v3)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((a0[7] <= a1[2][9]) > 51) break;
+                v0 = (((a1[2][11] != v1) != (81 ? v0 : i0)) == ((16 && i0) % 5));
+                v1 = (((a0[3] ? a0[11] : 68) >= (v0 % 2)) ? ((v0 >= i1) > (i0 % 3)) : ((29 ? i1 : v3) < (a0[5] / 2)));
+                v2 = (((v3 == a0[13]) / 7) && ((i1 >= i1) != (v1 || i0)));
+            }
+            v3 = (((v3 == a1[3][5]) > (i0 * 47)) == ((a0[4] / 4) * (87 / 4)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 != a1[3][7]) == (a1[1][2] < 31)) + ((a0[2] != v3) + (a0[4] && 42)))) {
+        v0 = (((a0[2] < a0[0]) || (a0[6] || 76)) && ((v0 % 9) ? (56 >= a0[11]) : (v0 != v0)));
+        v0 = (((47 - a1[3][4]) ? (v1 != v2) : (v0 != a1[2][13])) + ((a1[1][15] * v2) % 4));
+        a1[0][5] = (((v3 && v0) && (v1 - v0)) && ((22 < v1) ? (a1[1][10] == a0[4]) : (a1[0][9] >= v2)));
+    } else {
+        v2 = (((a0[8] == 63) <= (a0[3] != v1)) / 8);
+        v0 = (((a0[1] - 62) <= (v3 > a0[9])) % 7);
+        v1 = (((v3 + 70) * (v1 > v1)) == ((a1[1][15] <= a0[13]) / 5));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            a1[2][2] = (((56 <= v0) / 8) < ((v3 && i2) > (73 / 1)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v0 = (((a0[3] <= v3) / 5) >= ((v0 * 47) || (66 >= a1[3][12])));
+                    v1 = (((a1[1][13] || i3) || (87 >= v2)) || ((a1[1][2] + 96) >= (v3 > 32)));
+                    v3 = (((a1[1][11] / 4) < (a0[9] || a1[3][2])) + ((17 > v0) != (7 ? v1 : i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[1] = (((a1[1][12] && 50) + (a1[3][7] ? v3 : i2)) * ((v0 * v2) * (a0[11] >= i2)));
+            i2 = i2 + 1;
+        }
+    }
+    a1[1][15] = (((v0 < 12) > (v3 * 6)) && ((v0 >= v2) < (v2 ? 15 : a0[1])));
+    return (((v0 * v3) * (23 / 7)) - ((a0[7] - a1[0][0]) == (v1 != a0[13])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,199 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 81;
+    int v2 = 48;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    if ((((18 ? v1 : a0[8]) - (v3 / 4)) && ((v3 * v3) - (v1 > a0[1])))) {
+        v0 = (((v3 < v3) < (14 > v1)) >= ((v0 > v2) ? (a0[3] - a0[11]) : (a1[3][3] * 59)));
+        a1[0][12] = (((a1[0][3] + 21) > (86 / 9)) % 4);
+        v1 = (((v1 ? v3 : v2) / 8) < ((a1[2][12] && v0) > (v2 / 9)));
+    } else {
+        v1 = (((v3 || 96) != (a0[15] ? 29 : a0[10])) > ((36 && v3) * (0 || a0[2])));
+        v1 = (((v1 + v0) > (a0[5] - v0)) ? ((13 % 8) >= (44 || a0[9])) : ((a0[15] <= 18) == (v3 > a1[3][14])));
+        v3 = (((v2 % 7) ? (v0 < 59) : (v3 == 88)) || ((1 - a1[1][3]) - (80 > v0)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            a0[1] = (((a1[3][4] && 64) < (v1 + 32)) ? ((v3 * v3) - (i0 == a1[2][0])) : ((v0 * i1) == (a0[13] % 1)));
+            v0 = (((a0[13] == 4) * (i0 && v2)) * ((64 / 2) + (a1[2][3] && 67)));
+            a1[1][2] = (((80 % 1) % 3) == ((v0 / 9) % 9));
+        }
+        v3 = (((a1[0][8] <= 20) < (14 ? v1 : v2)) || ((66 && 45) <= (v1 < 72)));
+        v0 = (((v3 <= a1[0][11]) > (a0[7] != 0)) || ((a0[12] != i0) <= (i0 / 7)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a0[13] ? v1 : a1[3][14]) == (v0 % 5)) * ((a1[3][12] % 8) >= (v2 % 1)));
+            v2 = (((v1 < v1) ? (a1[0][0] != a1[3][11]) : (a0[15] * 91)) < ((84 % 2) ? (i2 >= 40) : (99 || v0)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((i2 ? 68 : a0[11]) > 50) break;
+                v2 = (((14 ? v2 : a0[10]) <= (v3 || 95)) <= ((v2 ? 90 : 2) != (94 - i3)));
+                a0[4] = (((v2 + a1[1][7]) + (a0[10] != v0)) ? ((v3 < v0) / 8) : ((v0 <= 78) <= (29 || v2)));
+                a0[13] = (((i2 + 71) < (v2 - a0[2])) <= ((v2 > i2) % 3));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v2 = (((v3 && v3) >= (v2 / 7)) / 9);
+            v3 = (((v3 > a0[12]) >= (v1 <= a0[7])) ? ((a1[1][10] * 57) ? (26 ? 93 : a0[6]) : (a1[3][8] >= a1[0][11])) : ((v1 > i4) < (73 / 9)));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((v0 + i4) - (a1[0][13] || a0[9])) < ((a0[15] < i5) / 2));
+                    v0 = (((v2 != i4) <= (45 < a0[4])) ? ((35 % 1) ? (v1 <= v3) : (v0 != v2)) : ((v3 - 95) ? (a0[14] >= v1) : (a0[13] / 2)));
+                    v1 = (((7 || a0[1]) - (v1 || a1[2][9])) ? ((90 == v3) ? (v0 >= 43) : (a1[1][0] ? a1[1][4] : a1[0][2])) : ((v0 || 27) <= (62 * 65)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v3 = (((a1[3][1] + v2) % 6) ? ((88 + v1) != (v3 >= i7)) : ((a1[0][11] % 9) <= (89 <= 83)));
+                a1[3][15] = (((33 <= 39) ? (v2 <= v3) : (67 % 7)) <= ((a0[14] < v3) >= (a0[6] / 1)));
+                v0 = (((59 && 46) / 5) == ((v1 != i6) / 4));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+        a0[15] = (((v2 && a0[4]) && (v1 + i6)) || ((80 ? v1 : v1) && (a0[15] < v2)));
+        v2 = (((i6 > a1[2][11]) ? (a1[1][1] ? a1[1][10] : 58) : (v0 || 38)) + ((v3 != i6) || (a0[14] == a0[2])));
+    }
+    return (((a0[15] ? a0[12] : v2) * (v2 < v3)) == ((a1[2][15] + v0) || (v1 ? a0[10] : 9)));
+}
+int f1() {
+    int v0 = 99;
+    int v1 = 88;
+    int v2 = 60;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    if ((((87 * 70) <= (v1 + v3)) - ((v2 || v1) % 2))) {
+        v3 = (((v0 < v0) == (v0 != v1)) || ((77 < v1) - (v0 || v2)));
+        v1 = (((v0 < v0) <= (a0[4] ? 7 : v0)) == ((22 && a0[4]) - (v0 / 7)));
+        v1 = (((v3 + v2) ? (v0 == a0[7]) : (v0 - v1)) != ((25 || v1) >= (v1 % 7)));
+    } else {
+        v3 = (((20 > 14) - (v2 != v3)) == ((v3 == v0) * (75 && v0)));
+        v3 = (((a0[15] * v2) - (v2 < v1)) >= ((v1 / 1) / 2));
+        v2 = (((16 % 2) > (4 + a1[2][2])) != ((a1[1][10] - 5) && (v3 ? v0 : 42)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((24 ? 13 : v1) > 67) break;
+            v0 = (((28 != 92) != (7 != i0)) ? ((a1[2][3] * v1) < (a1[3][8] != a0[8])) : ((v1 >= 66) && (v2 || a0[0])));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    a1[2][15] = (((a0[9] ? v0 : v3) * (13 > a1[1][11])) || ((i1 == v1) == (39 + 58)));
+                    a1[3][6] = (((v0 - 95) && (87 + v3)) && ((55 ? 42 : a0[13]) - (v2 || a0[13])));
+                    v0 = (((i0 > v2) && (v1 ? v2 : 24)) * ((i0 || i0) * (51 < v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v1 % 3) * (14 - v2)) ? ((12 ? i0 : v2) < (69 % 8)) : ((v1 ? v1 : 82) < (v3 == a1[0][14])));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    v3 = (((75 * 80) ? (v3 % 8) : (a0[2] * a1[3][8])) + ((v0 ? v1 : a1[3][3]) != (v2 <= v3)));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v3 = (((i2 < v0) / 2) * ((v3 - 12) || (a1[0][2] * i3)));
+                    v3 = (((a0[9] > 93) ? (43 || a0[1]) : (72 - v0)) != ((34 > a0[7]) <= (a0[12] < v2)));
+                    a0[13] = (((v0 >= 97) + (75 ? a0[10] : v3)) || ((v1 >= v3) > (i3 ? a1[2][9] : v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[1][8] = (((v1 || i2) < (a0[12] != i2)) / 5);
+            v3 = (((62 / 4) > (a0[5] * a0[10])) ? ((a1[0][7] > v3) ? (46 * v3) : (i2 <= v1)) : ((v1 < v2) <= (99 >= a1[2][3])));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((v3 < v1) + (v1 < a1[1][13])) / 1)) {
+        a1[3][0] = (((v1 >= a1[3][0]) > (29 ? v2 : 12)) - ((a0[9] >= v1) || (a0[15] < v2)));
+        a1[3][4] = (((v2 < 98) * (v2 * v0)) == ((23 != 18) < (a1[2][15] == a0[10])));
+        v1 = (((v1 < a1[2][15]) != (a1[3][6] >= 96)) >= ((v3 && 12) || (45 != v3)));
+    } else {
+        v1 = (((20 < v1) ? (95 <= a1[0][15]) : (v2 + a0[14])) == ((40 % 3) - (a0[0] || v3)));
+        v2 = (((a1[1][14] || a0[8]) - (89 * a0[14])) != ((v0 > v1) != (98 ? v2 : 23)));
+        a0[5] = (((86 != v2) * (a1[1][6] < v2)) * ((v0 * 76) <= (a0[15] == v2)));
+    }
+    return (((a1[3][11] + v3) - (v2 < v2)) * ((v2 && a0[6]) % 6));
+}
+int f2() {
+    int v0 = 80;
+    int v1 = 39;
+    int v2 = 50;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][11] = (((a1[2][2] == a1[1][1]) || (19 ? v1 : a1[2][15])) % 7);
+            v2 = (((a0[3] ? i0 : v2) ? (i0 > v2) : (a1[3][7] || v3)) * ((a0[0] >= a0[14]) / 6));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((i1 && a1[0][5]) + (82 == a1[0][10])) <= ((i1 || 78) - (v2 && i0)));
+                v0 = (((a0[9] <= a0[2]) ? (v1 > v0) : (i0 / 4)) != ((92 && 4) || (a1[3][2] && i1)));
+                v3 = (((95 - v0) == (v1 + a1[2][15])) || ((a1[3][2] - v2) <= (i0 && v1)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v1 * v0) + (v3 * v1)) - ((3 ? v3 : v3) * (v1 && 1)))) {
+        v1 = (((a1[3][8] != 65) % 4) * ((88 * v3) == (v0 <= 51)));
+        v3 = (((a1[2][14] != v2) < (v2 <= v0)) && ((v2 <= 48) ? (v3 || v1) : (a0[7] == a1[3][6])));
+        v2 = (((a1[3][14] >= 23) % 8) <= ((v2 != v0) || (a1[3][6] > a0[1])));
+    } else {
+        v2 = (((55 > v2) == (v1 % 2)) % 6);
+        v2 = (((v2 ? v2 : 38) * (v2 % 7)) * ((80 * v0) <= (v1 / 7)));
+        a1[2][8] = (((v1 && v2) ? (v1 ? 70 : v2) : (v1 <= v3)) && ((59 % 4) % 6));
+    }
+    if ((((v3 / 5) - (53 != v1)) / 9)) {
+        a0[2] = (((v0 == 30) ? (a1[2][7] > 66) : (a0[2] || v0)) > ((v3 == a0[2]) || (v3 != v1)));
+        a1[3][15] = (((21 == a1[1][11]) - (v3 % 9)) > ((v0 || a1[2][10]) == (a0[10] == v0)));
+        v3 = (((v1 ? 3 : a0[5]) / 5) && ((v0 != v3) <= (v0 <= v0)));
+    } else {
+        v2 = (((v2 != v1) + (v3 / 1)) + ((4 != v1) + (v0 && 46)));
+        v2 = (((v2 > v0) / 3) <= ((v3 >= 21) - (a0[0] > v1)));
+        v1 = (((a0[5] - a1[0][6]) < (a0[14] >= a1[1][10])) - ((a0[13] >= v3) > (66 / 3)));
+    }
+    if ((((v0 || v0) && (27 < v0)) - ((99 % 8) > (v3 >= v3)))) {
+        a0[14] = (((v3 * 48) || (v2 % 2)) != ((50 <= v3) >= (v2 && a0[0])));
+        v1 = (((v0 < a1[2][14]) <= (v1 - v2)) || ((v1 > v0) ? (v2 + v0) : (v2 || 79)));
+        v3 = (((v3 ? v3 : a1[0][5]) + (v1 / 5)) ? ((v1 == v2) + (v1 * 65)) : ((v1 >= a0[7]) != (v1 / 6)));
+    } else {
+        v2 = (((v2 && 79) && (a0[9] - 90)) <= ((51 ? v2 : a1[2][13]) + (a1[3][5] == a0[14])));
+        v3 = (((83 / 8) % 1) >= ((v1 ? v1 : v1) <= (a1[1][12] <= 56)));
+        a1[2][1] = (((a0[9] + v3) || (v3 != a0[10])) && ((v3 ? a0[13] : a0[11]) <= (69 % 4)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v3 = (((15 && v3) / 5) < ((64 / 5) || (a0[9] || v2)));
+        a1[2][14] = (((71 != v2) < (v0 * 13)) ? ((a0[6] + v0) * (a0[15] > i2)) : ((46 >= v1) && (a1[3][4] >= v0)));
+        {
+            int i3 = 0;
+            do {
+                a1[1][7] = (((2 ? a0[14] : v1) + (a0[12] > a1[2][4])) + ((v3 * v1) - (v2 >= a1[0][7])));
+                v3 = (((v0 ? 68 : v3) - (a1[3][15] >= a0[1])) <= ((v0 > a1[0][1]) ? (v2 - a1[2][9]) : (a0[11] / 5)));
+                v2 = (((56 && 43) - (60 > i3)) <= ((v0 % 9) / 6));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    return (((a1[3][12] - 11) == (v1 / 4)) / 7);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,59 @@
+int f0() {
+    int v0 = 12;
+    int v1 = 70;
+    int v2 = 79;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((81 * 69) < (v3 % 2)) * ((17 * 23) >= (v3 && v3)));
+    if ((((v3 || 64) * (v1 > a1[3][8])) % 5)) {
+        v2 = (((55 * 22) != (a0[6] == 10)) >= ((7 && a0[10]) == (a1[0][3] > 31)));
+        a0[4] = (((v1 == 46) < (v2 < v0)) >= ((a1[0][11] || v3) ? (a0[7] % 8) : (a0[10] && v2)));
+        a0[9] = (((16 || v3) % 7) != ((v2 && 3) + (v2 / 4)));
+    } else {
+        v0 = (((v3 ? v3 : 97) > (v1 - v3)) || ((a1[0][6] < 79) - (v3 == 65)));
+        v3 = (((a0[3] + v3) > (99 - a0[15])) ? ((38 ? 9 : v1) ? (75 <= a0[7]) : (a1[0][4] - v1)) : ((a0[5] || v2) < (v1 < 3)));
+        v0 = (((v2 != v1) ? (65 / 2) : (v2 < a0[11])) <= ((v3 != 24) != (a0[15] && v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((a1[0][1] || 62) > 88) break;
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((i0 * a1[3][10]) > 96) break;
+                v0 = (((a0[9] == 45) && (v1 ? i1 : v1)) * ((i1 - 36) * (v1 && a1[2][6])));
+                v1 = (((a0[0] % 5) && (v2 && a1[0][3])) < ((v1 || 15) || (a0[6] % 9)));
+                v2 = (((77 >= i0) - (v3 * i1)) || ((48 <= i0) && (a0[2] ? i1 : i0)));
+            }
+            a0[9] = (((v1 * v1) % 5) ? ((v2 < 68) ? (i0 / 5) : (31 > a1[3][0])) : ((i0 >= 93) - (v3 % 6)));
+            v1 = (((94 == a0[14]) / 3) ? ((v3 * v2) < (v3 >= v3)) : ((v2 * a0[13]) >= (v0 == a0[6])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v0 && v3) + (v2 / 8)) * ((v1 == i2) >= (a1[0][7] - v1)));
+            a0[2] = (((v2 < v1) != (a0[12] == v3)) && ((v3 + v0) || (v3 % 5)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a0[7] = (((a0[15] % 7) + (i3 || v1)) + ((a1[3][13] >= v2) >= (48 ? v3 : v3)));
+                a1[3][5] = (((a1[0][14] != a0[10]) / 8) / 2);
+                v0 = (((i2 > a0[7]) % 4) ? ((0 * v3) > (41 >= v1)) : ((i3 > v2) < (a0[2] || i3)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((v2 / 6) ? (99 <= v1) : (v1 >= v3)) ? ((49 && a0[1]) / 2) : ((a1[3][11] - 92) || (v1 == a1[1][6])))) {
+        v2 = (((v3 < v1) > (a0[3] < v2)) || ((v1 > v3) || (10 ? v1 : v3)));
+        v0 = (((a1[3][0] * v1) == (v1 % 2)) % 3);
+        v3 = (((v1 && a1[3][13]) ? (v0 + v2) : (35 <= 41)) / 5);
+    } else {
+        a0[8] = (((a1[2][8] >= v1) && (v0 || v2)) || ((v2 >= v1) != (a1[0][0] < v0)));
+        v1 = (((v1 == 11) <= (a0[10] / 5)) / 6);
+        a0[13] = (((v2 >= v2) * (v3 / 6)) / 1);
+    }
+    return (((33 * a1[3][1]) % 4) == ((96 - v3) % 5));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,114 @@
+int f0() {
+    int v0 = 65;
+    int v1 = 30;
+    int v2 = 8;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 - a0[4]) > 75) break;
+            v1 = (((23 == v0) || (a1[0][5] != 66)) >= ((v3 * 56) != (v1 == v0)));
+            v3 = (((a1[0][1] != a1[0][1]) % 2) || ((a0[8] <= v3) + (i0 ? i0 : v0)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                a0[1] = (((v0 ? v2 : a1[0][3]) + (22 < a0[4])) >= ((a1[0][9] * v2) && (v3 <= a0[8])));
+                v1 = (((65 <= a1[2][4]) * (v1 ? v2 : i0)) != ((i0 && a1[2][12]) - (a0[12] ? v1 : a0[0])));
+                v1 = (((v2 + a1[2][1]) || (v1 % 9)) > ((v3 >= 68) > (v3 > a1[0][11])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((i3 >= i2) > 86) break;
+                v3 = (((v0 >= i3) ? (v0 % 8) : (v1 >= i2)) != ((23 / 7) || (v1 < 33)));
+                v3 = (((v1 == v1) <= (i3 < 10)) ? ((a1[3][5] < i3) != (v2 >= i2)) : ((a1[0][10] <= 31) <= (v3 ? a0[11] : a0[11])));
+                a1[2][7] = (((29 <= a0[13]) && (46 != i3)) > ((51 - v2) == (a1[0][0] || i2)));
+            }
+            v2 = (((i2 ? a0[2] : i2) + (41 == v2)) % 1);
+            v3 = (((i2 > v0) ? (v3 || i2) : (75 % 5)) || ((i2 >= a0[7]) >= (a0[5] * i2)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((v1 > v0) > 52) break;
+        v1 = (((v0 ? 11 : i4) || (v2 * v2)) <= ((i4 - v3) == (8 ? a0[15] : v0)));
+        v1 = (((49 || v2) * (i4 ? v3 : 28)) != ((v3 == 80) % 5));
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                v1 = (((v3 ? 76 : 79) + (v0 * 17)) - ((34 <= 36) ? (17 ? 30 : 19) : (a0[11] <= 80)));
+                v0 = (((v0 + 66) <= (74 && a1[2][8])) * ((a1[1][1] ? a1[1][10] : 94) || (i4 && v1)));
+                a0[8] = (((92 + i5) * (v2 ? v2 : a1[0][8])) ? ((v1 / 6) < (a0[8] || a0[7])) : ((i4 || v0) / 8));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    a1[1][8] = (((v3 > v0) <= (a0[8] >= a0[15])) % 4);
+    v1 = (((62 - v0) || (v1 * a0[3])) ? ((a0[9] || 46) <= (a0[2] == a1[2][9])) : ((13 && a0[0]) == (a0[10] + v0)));
+    return (((v0 == 28) <= (a0[12] > v3)) * ((63 + v3) <= (a0[0] * v1)));
+}
+int f1() {
+    int v0 = 84;
+    int v1 = 17;
+    int v2 = 59;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            a0[8] = (((i1 != v2) / 6) * ((v1 + a1[1][2]) % 3));
+            v0 = (((v0 > a1[3][7]) < (a0[1] <= i1)) || ((51 * a0[1]) > (a1[1][5] ? v2 : a1[2][12])));
+            v1 = (((i0 * a0[1]) / 6) ? ((v3 / 6) ? (53 / 8) : (v2 * a1[2][0])) : ((i1 || i0) < (a0[4] == a0[3])));
+        }
+        v3 = (((a0[12] != v0) * (90 / 7)) <= ((v2 ? v1 : v0) == (v1 - i0)));
+        a1[1][15] = (((i0 / 2) ? (a1[0][10] ? 59 : 38) : (42 < a1[2][0])) < ((v0 >= a1[3][13]) > (v3 ? v2 : v2)));
+    }
+    if ((((v0 > a1[3][8]) > (v2 < 90)) == ((v3 || a1[1][14]) || (14 && 46)))) {
+        v2 = (((84 == a1[2][7]) < (v3 - a1[3][4])) + ((41 ? 69 : v1) * (a0[12] <= 1)));
+        a1[1][5] = (((v2 / 9) ? (v2 != 53) : (v1 * 32)) <= ((27 - 19) - (a0[15] % 7)));
+        v1 = (((a0[7] % 2) - (5 - v1)) != ((v2 >= a0[10]) + (a1[3][13] - v1)));
+    } else {
+        v2 = (((v2 < v2) || (v3 == a1[2][13])) == ((a1[1][10] == 8) + (67 + a1[1][1])));
+        a1[3][9] = (((v3 % 5) == (v3 > a1[3][3])) / 8);
+        v2 = (((a1[0][14] * v3) ? (v3 / 9) : (a0[7] > 64)) * ((78 != v3) > (v3 && v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a0[10] / 9) - (a1[3][2] != i2)) != ((v2 || 19) && (i2 != 64)));
+                    v3 = (((v2 - v3) % 7) ? ((24 - a0[12]) - (v1 * i3)) : ((i2 - 47) + (v0 - a1[0][3])));
+                    v0 = (((a1[2][2] < 19) + (v0 <= 25)) > ((i3 > 68) * (a0[14] * v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            a1[1][7] = (((97 || i2) != (a1[1][8] && v1)) - ((v1 > i2) ? (a1[3][6] != v1) : (v2 < 12)));
+            a1[2][5] = (((i2 != v3) ? (i2 == a1[1][10]) : (a1[3][8] && v2)) < ((v0 < a1[1][15]) >= (v3 * a0[0])));
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((v1 >= 56) > (v3 == a1[3][11])) / 8);
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((i4 >= a1[2][11]) <= (v0 > v0)) || ((a1[1][12] == v3) >= (v0 != v3)));
+        v3 = (((v0 >= v0) ? (v2 || v1) : (a0[14] ? i4 : 32)) > ((84 / 5) ? (v0 < i4) : (v0 ? 23 : v1)));
+        {
+            int i5 = 0;
+            while (i5 < 2) {
+                a1[2][15] = (((v0 * i5) && (a1[2][11] || v3)) <= ((2 != 26) ? (a1[0][1] - 33) : (v3 <= a1[2][6])));
+                v1 = (((a0[5] <= v1) == (i5 ? 19 : 6)) ? ((a0[9] < i4) ? (v1 > v1) : (i5 - v1)) : ((v0 + 49) || (a1[3][1] > 49)));
+                a0[0] = (((a0[13] - 41) % 3) || ((90 && i5) + (a1[3][0] || v1)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    return (((a0[8] * v2) == (41 + v1)) && ((46 > 53) - (v3 != v3)));
+}
+int main() {
+    return 0;
+}
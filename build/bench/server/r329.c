@@ -0,0 +1,145 @@
+int f0() {
+    int v0 = 13;
+    int v1 = 56;
+    int v2 = 76;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[1][7] = (((93 ? v3 : v2) == (a0[12] + 2)) ? ((a0[13] % 6) - (v1 + v2)) : ((v0 || 59) != (87 || v0)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v2 = (((v0 ? a1[2][7] : v2) ? (v1 > 83) : (i1 != v3)) / 5);
+                    v0 = (((a1[3][2] || a1[0][13]) <= (78 != 74)) / 9);
+                    v3 = (((43 < a1[2][13]) == (18 < v0)) <= ((80 >= 44) ? (v1 >= a1[2][1]) : (v3 + i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][10] = (((a1[1][9] < a1[0][11]) <= (v3 && v1)) / 3);
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v2 = (((14 || i2) ? (v3 - 75) : (40 >= i2)) > ((v0 < a0[2]) + (i2 >= v1)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((v0 + 79) || (v2 > 46)) - ((v1 ? v2 : v2) || (a1[3][3] - a0[10])));
+                    v2 = (((v0 >= v0) % 1) / 9);
+                    a1[2][5] = (((a0[6] && 11) * (29 <= v1)) ? ((66 >= 81) ? (v2 ? i3 : 60) : (95 >= v3)) : ((v1 > v3) - (37 == 85)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v2 = (((52 + v2) != (a0[12] % 9)) > ((i2 ? v0 : 17) <= (v2 != 48)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((53 ? 40 : a1[0][1]) == (v0 > 31)) * ((v2 + 31) ? (v3 / 8) : (a1[0][10] > v0)))) {
+        a0[3] = (((97 != v3) ? (a1[3][13] < 30) : (v2 % 5)) < ((a1[3][12] + a1[3][10]) % 2));
+        v0 = (((v2 || v1) || (v2 > v0)) >= ((v2 || 64) ? (81 / 7) : (v0 <= v1)));
+        a1[2][8] = (((a0[9] == a0[0]) * (57 % 9)) || ((56 == 87) <= (a0[15] - 96)));
+    } else {
+        v2 = (((v3 != v0) <= (27 > 27)) == ((v3 % 3) >= (v0 < a0[15])));
+        v0 = (((a1[0][5] >= v3) + (v0 <= a0[9])) - ((v0 <= v0) == (43 / 7)));
+        a0[10] = (((a0[12] - v1) / 2) >= ((v2 + 29) == (58 || v1)));
+    }
+    if ((((a0[9] < v1) * (21 > v3)) * ((v0 <= a1[1][9]) != (v3 == a0[0])))) {
+        a1[2][13] = (((a0[8] >= v2) - (11 && 39)) + ((a1[2][0] + 68) == (3 != 64)));
+        v1 = (((v3 - a1[1][12]) / 6) % 1);
+        v3 = (((a0[6] <= v2) >= (a1[3][5] - a1[2][6])) == ((v3 <= v1) || (v0 != v3)));
+    } else {
+        v0 = (((v2 == v0) % 1) + ((a0[1] > v0) || (v2 / 1)));
+        v1 = (((v2 ? v2 : a1[2][4]) + (v2 != v3)) && ((a0[1] <= v3) ? (93 <= v1) : (v2 % 2)));
+        v3 = (((47 + a1[3][8]) != (57 + 62)) ? ((a0[6] / 7) < (a0[7] && v0)) : ((v2 == 68) < (v0 ? a1[1][3] : v1)));
+    }
+    v2 = (((31 >= v1) <= (a1[1][3] - v3)) && ((v1 ? a0[7] : v2) * (47 && 74)));
+    return (((v2 == a1[3][11]) + (a1[2][12] ? 49 : 75)) ? ((a0[4] / 8) && (v3 <= v0)) : ((v2 || 95) ? (a1[1][11] * v0) : (a1[2][10] == a1[3][10])));
+}
+int f1() {
+    int v0 = 86;
+    int v1 = 86;
+    int v2 = 86;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 != 17) ? (a1[2][4] > 1) : (80 || v1)) && ((v0 == a0[14]) * (v3 >= v2)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((a0[4] + 33) == (v0 > a1[0][0])) == ((v2 < a1[2][4]) && (80 != 66)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a1[2][2] = (((76 % 8) ? (v0 >= a1[2][9]) : (89 ? a0[10] : v2)) >= ((v0 + v3) && (v1 - a1[2][9])));
+                v1 = (((i1 ? v2 : v2) % 1) % 9);
+                a0[15] = (((v0 && v2) ? (6 % 7) : (44 && 42)) < ((i0 / 2) + (i1 ? 47 : a1[2][8])));
+            }
+            v1 = (((10 ? a0[3] : v3) % 9) - ((v2 % 3) >= (a1[0][10] ? a0[11] : 52)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v0 % 8) + (a0[15] * 65)) ? ((26 ? v3 : a1[0][9]) != (v3 + v2)) : ((44 ? v2 : v3) * (a0[10] == 24)))) {
+        v2 = (((v1 - a0[9]) <= (a1[3][7] >= v2)) / 3);
+        v1 = (((v2 ? 29 : 52) <= (v1 - 97)) != ((v2 && 73) || (a0[9] <= 22)));
+        v3 = (((83 != v1) != (v1 >= v2)) || ((v2 ? v1 : 97) + (v3 || v2)));
+    } else {
+        v1 = (((a0[7] % 5) == (a0[4] - a1[2][9])) > ((v3 > a0[1]) > (v3 && v0)));
+        v3 = (((v2 > v0) + (a0[15] - a0[12])) == ((v1 > v1) % 1));
+        a0[7] = (((93 == 31) < (57 % 3)) == ((a1[0][6] && a0[13]) ? (53 * a1[3][0]) : (a0[3] || v0)));
+    }
+    v0 = (((44 > v1) == (v1 / 4)) == ((v0 % 7) ? (v1 - a1[3][14]) : (a0[1] && v2)));
+    a0[14] = (((78 * a1[1][8]) == (v2 ? a1[0][3] : v0)) / 6);
+    return (((60 > v1) < (v2 >= 48)) != ((v1 ? v3 : v3) < (v1 > v1)));
+}
+int f2() {
+    int v0 = 70;
+    int v1 = 56;
+    int v2 = 37;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    if ((((71 + v3) - (30 % 5)) != ((32 || v3) + (a0[4] % 3)))) {
+        v1 = (((6 > a0[5]) == (v3 >= v2)) * ((7 != 50) != (v2 ? a0[12] : v0)));
+        v0 = (((v3 == v0) > (v3 % 3)) || ((a0[1] != a0[6]) % 3));
+        v1 = (((v1 ? 63 : a1[0][7]) % 4) ? ((v2 ? v3 : v1) > (95 < a0[12])) : ((v3 || a0[9]) || (v3 || 64)));
+    } else {
+        v2 = (((v2 >= a1[0][6]) - (v1 != v1)) >= ((v3 - a1[2][10]) + (44 >= 77)));
+        v0 = (((v1 / 3) && (37 >= 17)) ? ((a1[1][8] / 7) <= (71 % 3)) : ((a1[3][7] ? v0 : 94) >= (8 / 3)));
+        a0[3] = (((v2 / 7) ? (v0 / 9) : (v0 >= 30)) % 7);
+    }
+    if ((((v1 != v3) ? (a0[1] > v3) : (v0 && a0[3])) || ((v3 ? a0[10] : 5) != (v0 != v2)))) {
+        v2 = (((78 + v1) % 4) == ((a1[0][12] == v1) * (88 && v2)));
+        v1 = (((v1 % 9) || (a0[4] > v1)) * ((a1[0][9] > v1) >= (a1[2][7] / 7)));
+        v0 = (((v0 >= v2) > (v0 * v2)) % 6);
+    } else {
+        v1 = (((v1 / 3) - (a0[11] ? v1 : 38)) || ((67 - v1) == (20 - v1)));
+        v2 = (((v0 && a0[13]) ? (v2 + a1[3][14]) : (v1 ? 8 : v3)) <= ((v0 == 62) * (v1 <= a1[3][1])));
+        v2 = (((v2 || 26) / 4) != ((v1 * a0[14]) + (99 / 1)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (((i0 > a1[2][8]) / 7) / 9);
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v3 = (((20 / 3) % 2) == ((a0[12] * v3) / 5));
+            v3 = (((a1[1][5] != i0) || (v0 <= v3)) <= ((v1 != v3) / 9));
+            v0 = (((93 >= a0[13]) * (v2 ? 48 : v2)) - ((v1 == i1) ? (a0[5] + a0[12]) : (52 % 5)));
+        }
+        v1 = (((v2 || v2) <= (13 + 62)) != ((34 != a0[9]) == (v0 == 87)));
+    }
+    if ((((v1 < v3) > (96 >= a1[0][15])) + ((v0 > v0) == (v0 && v2)))) {
+        a1[3][12] = (((35 <= v0) - (58 % 3)) < ((a0[3] <= v0) != (v0 + v1)));
+        a0[1] = (((52 < 4) ? (4 - a1[1][14]) : (v3 <= 78)) * ((v3 * v2) >= (v0 >= a1[2][2])));
+        v1 = (((v3 >= v3) && (v2 < v3)) != ((v1 < v1) == (v0 % 5)));
+    } else {
+        v3 = (((v2 + v3) > (61 != 84)) == ((a1[2][15] ? 79 : v1) / 3));
+        v1 = (((v0 >= v2) <= (v0 != 99)) - ((v0 > v0) / 8));
+        v3 = (((40 <= a1[0][7]) == (64 >= 6)) != ((v0 + v3) >= (v1 + a1[0][9])));
+    }
+    v0 = (((v3 || v1) ? (a0[12] % 7) : (v1 < v2)) >= ((a1[2][12] && 91) * (v0 && v3)));
+    return (((2 > v3) == (v2 ? a0[4] : 5)) || ((10 && v2) < (34 && v0)));
+}
+int main() {
+    return 0;
+}
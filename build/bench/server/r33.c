@@ -0,0 +1,56 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 54;
+    int v2 = 62;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][14] % 4) / 4) >= ((a0[4] > 34) <= (v3 || a1[0][8])))) {
+        v1 = (((42 != a0[2]) > (v2 <= v1)) > ((22 % 2) < (a0[15] && 68)));
+        a0[0] = (((a1[0][7] <= v1) >= (v1 + v0)) != ((4 > a0[13]) || (a0[9] % 3)));
+        v2 = (((53 || v3) >= (v1 / 3)) + ((v1 != v1) + (v1 ? v0 : a0[7])));
+    } else {
+        a1[1][4] = (((a0[15] - a1[1][6]) / 2) - ((30 <= 0) > (v2 * v3)));
+        a0[8] = (((89 <= v1) % 9) && ((26 == a1[1][7]) > (a1[0][14] * a1[0][12])));
+        a0[3] = (((v2 >= 32) + (v0 ? v0 : a1[0][7])) % 1);
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[1][9] = (((v0 ? v3 : i0) >= (v3 || 31)) >= ((v1 - a1[2][14]) && (a0[14] ? i0 : v0)));
+            a0[5] = (((v0 < 60) ? (i0 ? a0[14] : 37) : (i0 ? 17 : v3)) ? ((v2 + 83) / 7) : ((v3 / 9) + (a0[0] >= v2)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                a0[15] = (((v2 && 66) ? (75 != v1) : (v0 == v0)) <= ((i1 != 55) < (a0[9] < 36)));
+                a0[2] = (((v2 < a1[2][12]) ? (i0 * v0) : (91 ? 52 : 75)) / 5);
+                v3 = (((30 + a0[14]) ? (a1[1][5] % 6) : (v3 % 6)) <= ((v2 ? 41 : v1) / 5));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((22 > v0) > (v3 / 9)) && ((30 && v3) || (v3 && a1[1][6])))) {
+        v0 = (((36 ? 6 : v1) > (v2 % 9)) >= ((v0 * 34) || (2 == v2)));
+        a1[3][13] = (((74 ? v1 : a1[1][9]) / 6) ? ((v1 + a1[0][7]) || (v0 == v1)) : ((v1 - v0) / 6));
+        a0[13] = (((25 <= 12) != (6 % 8)) >= ((v3 ? 19 : 98) >= (v0 > v0)));
+    } else {
+        v2 = (((9 >= a0[2]) ? (10 < v2) : (26 != v0)) >= ((v0 <= v3) ? (a0[6] % 9) : (v1 == 88)));
+        a1[2][5] = (((v2 % 8) + (10 * v2)) >= ((v0 - v0) * (a1[2][6] <= v3)));
+        v2 = (((v1 ? 32 : v0) < (v3 * a0[13])) > ((23 ? v3 : 22) != (78 != a1[0][5])));
+    }
+    v1 = (((a0[10] ? a0[6] : v2) ? (v0 == v0) : (50 * 72)) == ((52 >= v0) * (v0 || a0[1])));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a0[1] <= 75) > 66) break;
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            a1[3][15] = (((i2 != a0[5]) >= (a1[3][2] >= 13)) >= ((i2 > a0[15]) <= (14 - i3)));
+            v2 = (((a0[10] > v0) == (36 ? 37 : v1)) == ((a1[0][9] || a1[0][14]) > (i2 / 7)));
+            v2 = (((20 == v2) && (65 > 69)) - ((a1[2][13] >= v2) % 9));
+        }
+        a1[1][8] = (((v1 * a1[2][4]) ? (a0[5] + 46) : (83 % 9)) <= ((a0[10] < a0[0]) || (56 % 8)));
+        v3 = (((v3 ? v0 : i2) / 3) == ((v3 || a0[12]) != (a0[15] || 23)));
+    }
+    return (((a0[1] % 3) * (a1[1][12] >= v2)) && ((v3 ? v2 : 36) % 3));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
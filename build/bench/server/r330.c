@@ -0,0 +1,79 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 69;
+    int v2 = 0;
+    int v3 = 58;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v0 = (((v0 % 2) ? (41 / 3) : (19 && v3)) == ((i0 ? 57 : a1[2][0]) || (a1[1][2] != a0[13])));
+                    v0 = (((41 / 4) && (v1 < i1)) ? ((v1 > i0) && (i1 - v0)) : ((15 < a1[1][10]) != (74 != a0[5])));
+                    a0[5] = (((2 < a1[0][3]) && (v2 ? i1 : i0)) && ((84 <= v0) + (35 + 33)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[10] = (((v3 >= v0) <= (v0 <= a0[8])) / 5);
+            v1 = (((74 != 66) % 5) + ((v0 || 27) == (a0[10] ? a0[2] : v3)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a1[1][14] = (((v2 > i2) + (i2 < a0[2])) < ((a0[13] != v2) < (a0[15] == v2)));
+        a0[7] = (((v0 != v1) || (v2 || v3)) + ((a0[12] == v0) == (v3 >= a1[3][6])));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                if ((v1 + i3) > 91) break;
+                v1 = (((i2 != v0) * (v0 + v0)) - ((i2 - 25) + (i3 <= v3)));
+                v1 = (((82 ? v0 : a0[7]) != (i2 ? i3 : v2)) == ((a1[1][13] <= i3) ? (v2 < v0) : (v1 == v2)));
+                a1[3][0] = (((v3 && a0[11]) >= (v3 ? v1 : a0[11])) ? ((v0 % 2) + (i3 > v1)) : ((i3 ? 38 : v0) || (87 + 80)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v3 = (((a0[15] + v2) + (a0[0] ? v2 : v2)) == ((v1 == v2) - (v2 * i4)));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v2 = (((v2 ? i5 : a1[2][1]) ? (i5 > a1[0][10]) : (v1 == a0[9])) || ((i5 % 6) && (i4 > v0)));
+                a1[0][0] = (((v1 / 6) ? (a0[7] || 19) : (48 + v3)) % 4);
+                a0[5] = (((v3 > v1) == (21 - v3)) ? ((a0[2] > v1) < (v0 % 5)) : ((36 ? i5 : v2) != (v2 >= v2)));
+            }
+            v3 = (((v0 || a1[1][4]) ? (a1[0][11] && 7) : (i4 % 9)) * ((18 <= v0) != (i4 <= 22)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v0 = (((a0[3] % 3) / 4) || ((i6 <= a0[1]) % 4));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((v1 <= v2) > 89) break;
+                v1 = (((a0[10] % 8) && (v2 ? 19 : 52)) || ((v0 ? a0[12] : v1) > (v2 != a1[0][13])));
+                v1 = (((a1[2][10] % 1) || (v3 && v2)) <= ((76 < v0) < (v1 != i6)));
+                a0[2] = (((v2 <= 93) < (v2 >= v2)) ? ((i6 / 6) ? (10 != 87) : (v2 || i7)) : ((v0 - 67) ? (v1 != 96) : (v1 ? v1 : v2)));
+            }
+            v1 = (((89 % 6) ? (v0 < v1) : (a1[1][12] && v0)) >= ((v1 ? 48 : a0[3]) * (a1[3][10] - a0[11])));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v1 < v0) <= (v0 <= a1[1][1])) ? ((15 * 55) == (v1 ? v0 : a0[10])) : ((v1 ? v2 : a1[1][4]) || (a0[0] > v2)))) {
+        v3 = (((a0[4] + a0[6]) ? (87 <= v1) : (v1 <= v0)) ? ((v0 ? v0 : 38) * (v0 || a0[2])) : ((v3 > a0[14]) >= (v1 % 3)));
+        v2 = (((v1 ? a1[0][3] : a0[13]) * (15 * 24)) == ((61 ? v3 : v0) / 9));
+        v0 = (((v1 ? v2 : a1[1][6]) && (v2 >= v0)) > ((a1[3][2] || a1[2][14]) == (v1 || v3)));
+    } else {
+        v2 = (((v2 <= a0[7]) || (a0[13] - v0)) || ((v2 || 11) < (v1 - 84)));
+        v2 = (((51 - a0[14]) >= (a0[1] >= a1[1][0])) == ((55 - v0) || (67 == v1)));
+        v1 = (((12 + 25) != (8 || a0[1])) ? ((a1[2][5] - v2) >= (v1 == v0)) : ((88 - v3) || (a1[3][8] / 9)));
+    }
+    return (((v1 ? v1 : v0) % 4) - ((23 * v0) || (v1 ? a1[3][8] : 29)));
+}
+int main() {
+    return 0;
+}
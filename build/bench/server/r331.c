@@ -0,0 +1,137 @@
+int f0() {
+    int v0 = 67;
+    int v1 = 4;
+    int v2 = 76;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v0 = (((i1 < a0[2]) < (65 <= v1)) < ((62 <= a0[3]) == (v0 > v1)));
+                a1[0][12] = (((v2 ? a1[2][12] : v2) == (a0[7] ? i1 : v2)) + ((v1 != i0) - (a1[2][13] ? 53 : v0)));
+                v3 = (((v1 + 87) ? (a1[3][13] > v1) : (v1 * 73)) || ((i0 - a0[12]) - (43 <= i1)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[1][1] = (((54 <= v3) / 4) ? ((11 > 86) ? (87 <= v1) : (82 || 78)) : ((v2 < v1) >= (a0[15] * a1[0][14])));
+        v0 = (((v2 ? a1[3][6] : v0) == (91 ? a1[3][15] : v2)) * ((a1[1][1] >= v0) == (v1 >= 45)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a0[14] = (((37 + i3) / 4) && ((v3 < v3) || (a0[11] == 52)));
+                v0 = (((a0[10] > v1) / 8) >= ((v1 != v2) % 8));
+                a0[3] = (((v1 <= v1) < (i3 != i3)) + ((v1 > 40) - (a1[2][5] ? v3 : v2)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        v1 = (((a1[1][5] % 6) / 7) < ((v2 || 77) > (a0[12] >= v2)));
+        a1[0][0] = (((a0[3] == v2) + (82 - i2)) ? ((v1 % 4) <= (a0[14] ? a1[0][0] : a1[0][5])) : ((v3 || i2) || (67 <= v0)));
+    }
+    if ((((8 && v2) ? (62 / 7) : (v2 % 8)) > ((v2 < v1) && (a0[7] * v2)))) {
+        v2 = (((v0 ? 16 : v3) == (42 != v0)) / 7);
+        a0[12] = (((v3 != a0[14]) ? (53 || a0[8]) : (87 == v1)) ? ((v3 >= a1[2][13]) == (v3 ? a1[2][3] : v0)) : ((v0 > a0[6]) - (93 / 8)));
+        v0 = (((v1 * 53) && (v3 <= v1)) * ((v1 > a0[10]) / 5));
+    } else {
+        v3 = (((56 ? a1[3][13] : v2) - (a1[3][6] ? 58 : v1)) || ((v0 >= v1) ? (v3 - v2) : (v3 == v1)));
+        v2 = (((v0 > v0) ? (v1 ? v0 : v1) : (v1 > v3)) || ((11 ? 88 : 11) + (v1 * v2)));
+        v1 = (((v0 ? v2 : v2) ? (a0[6] * a0[6]) : (a1[3][12] ? v2 : v1)) / 3);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v2 = (((22 ? 61 : v2) / 3) && ((i4 <= v3) % 2));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v0 = (((28 % 7) >= (67 < i5)) ? ((i4 ? 98 : i5) + (v2 > 27)) : ((i5 != i4) && (v0 ? 73 : v0)));
+            v1 = (((v0 * a1[2][2]) ? (51 - 82) : (v2 + v0)) > ((71 > a1[1][10]) >= (v0 >= 2)));
+            v1 = (((v0 / 9) % 4) <= ((i4 + a0[12]) / 8));
+        }
+        v1 = (((v3 - v0) ? (68 == v2) : (v0 - 68)) ? ((5 && v1) != (v1 - a0[10])) : ((a1[2][0] > a1[1][0]) != (v1 ? v2 : v0)));
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        a1[2][1] = (((a1[3][1] < v0) + (a0[5] || 77)) % 9);
+        v1 = (((v0 > v0) + (74 - 62)) % 3);
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            if ((v0 + 38) > 70) break;
+            a1[2][9] = (((v2 + i7) >= (i7 == a0[0])) || ((74 != v0) + (48 * v0)));
+            a0[15] = (((i6 + a1[0][5]) < (5 > v3)) > ((86 <= v1) % 3));
+            a0[2] = (((77 * 76) / 7) - ((v1 <= 46) >= (v2 != a1[3][11])));
+        }
+    }
+    return (((v3 != v1) - (v1 == a0[9])) / 9);
+}
+int f1() {
+    int v0 = 99;
+    int v1 = 93;
+    int v2 = 31;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((43 / 1) + (v2 || 26)) && ((v1 > v3) && (19 && 79)));
+                    v1 = (((i1 >= v0) ? (85 - 41) : (a1[3][5] * v1)) && ((a0[3] != a1[1][13]) > (6 ? 43 : i0)));
+                    v2 = (((i1 - 64) * (60 != 74)) * ((a1[0][8] ? a0[12] : a1[3][12]) >= (1 == v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            a0[9] = (((a1[3][3] >= 89) < (v0 - v2)) * ((v0 > a0[0]) % 9));
+            v3 = (((v0 > v2) ? (v1 - a0[5]) : (a0[13] <= v0)) ? ((v1 * v2) + (a0[0] > 72)) : ((33 > 44) / 3));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 / 6) && (a1[3][9] < v0)) > ((a0[9] ? v3 : 71) >= (a0[9] * v1)))) {
+        a0[7] = (((32 - v0) % 1) >= ((v3 >= a1[2][11]) - (a1[0][4] != a1[1][14])));
+        v0 = (((v2 ? 20 : v3) - (a0[6] ? a1[3][9] : 25)) == ((v3 || v1) ? (v1 / 2) : (54 && 79)));
+        a1[1][1] = (((v1 ? v2 : v2) != (v3 - a1[2][3])) ? ((v1 * 51) - (v2 >= 50)) : ((70 > v0) < (a0[13] / 8)));
+    } else {
+        v1 = (((v3 != v2) <= (a0[10] ? a1[3][5] : v2)) * ((v0 * v3) + (24 ? 19 : 47)));
+        v2 = (((a1[0][11] != 47) / 3) != ((84 && v1) != (v3 <= v0)));
+        v2 = (((v1 == a1[0][0]) > (a1[2][7] && 80)) ? ((v0 > 55) || (3 >= v3)) : ((v1 ? a0[6] : 88) * (88 != v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            a0[12] = (((70 ? 35 : v2) / 5) - ((v0 % 1) || (15 + 71)));
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[4] * a0[15]) > 54) break;
+                    a1[2][1] = (((v3 != v2) != (60 * i3)) + ((a0[11] + 40) > (82 ? a1[0][1] : a0[11])));
+                    v2 = (((a0[6] >= a1[1][5]) ? (74 < v0) : (v0 * a1[3][2])) > ((i2 < a1[1][12]) >= (i3 ? i3 : a1[3][13])));
+                    a1[2][15] = (((v1 > v0) - (v0 * i3)) * ((v3 >= 45) >= (a0[11] ? a0[7] : v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v2 = (((a1[1][6] >= v2) ? (i2 && v3) : (16 ? a1[1][6] : 0)) / 9);
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((v1 / 1) <= (a1[1][15] ? a0[0] : 80)) ? ((v0 && a0[3]) <= (a1[3][3] > v1)) : ((17 < 38) < (v0 >= v3)));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    a0[7] = (((v2 || v2) != (v3 == a0[5])) % 4);
+                    v3 = (((a0[14] < i4) && (v2 - 0)) % 7);
+                    a1[3][7] = (((a0[10] || v3) * (92 != 1)) * ((a0[14] >= v0) != (v1 > v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((v0 == v2) / 5) > ((v0 ? 17 : v3) + (v1 || v3)));
+            v2 = (((a0[14] ? v1 : 83) || (v2 ? i4 : v1)) ? ((v0 > a0[14]) * (v2 && v2)) : ((a0[6] != 64) >= (a1[1][0] != a1[0][8])));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((3 <= v0) && (27 <= 57)) != ((48 > a1[2][12]) || (v1 <= 10)));
+}
+int main() {
+    return 0;
+}
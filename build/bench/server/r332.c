@@ -0,0 +1,151 @@
+int f0() {
+    int v0 = 52;
+    int v1 = 16;
+    int v2 = 33;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    a1[3][13] = (((v1 * v0) % 5) - ((81 / 5) == (a1[0][8] != v3)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a0[12] = (((v3 < v0) <= (v3 < 77)) ? ((85 || 74) % 4) : ((a1[3][10] ? v2 : i1) >= (a0[7] ? i1 : 77)));
+            v0 = (((v3 * 10) < (28 < v0)) * ((v3 ? a1[1][10] : 30) == (i0 ? 25 : v2)));
+            v0 = (((11 == 13) - (i1 || v1)) - ((55 && i0) && (v0 <= 81)));
+        }
+        a1[0][8] = (((i0 ? i0 : v1) || (v1 <= a1[2][15])) || ((v2 && v0) && (v2 ? v2 : v1)));
+        v1 = (((v0 % 9) || (a0[15] && a0[15])) >= ((i0 >= a0[9]) == (a0[7] != a1[2][11])));
+    }
+    if ((((v1 % 3) != (75 % 9)) >= ((v2 >= 48) < (v1 == a1[2][7])))) {
+        a0[7] = (((45 % 7) / 5) && ((v0 || v0) && (v1 + 59)));
+        v0 = (((v3 / 9) % 7) - ((a0[2] || 70) && (v3 % 8)));
+        v3 = (((v1 <= a1[3][13]) != (21 || 94)) >= ((a1[2][13] > v0) >= (v3 || v2)));
+    } else {
+        a0[10] = (((v3 && v0) ? (v3 && v3) : (96 != 13)) == ((a0[7] / 6) && (68 || 8)));
+        a0[14] = (((98 / 1) <= (41 > v3)) >= ((61 == v0) != (a0[3] || v2)));
+        v3 = (((a1[0][13] == a1[2][14]) == (v3 > 76)) <= ((v2 / 9) * (10 * v3)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v0 = (((v1 + 58) ? (v3 + a0[10]) : (0 > v3)) == ((i3 > v3) && (v3 - v1)));
+                v1 = (((a0[8] && v1) == (a0[4] || i3)) ? ((v1 && i3) * (6 <= v0)) : ((17 && a0[12]) > (26 < a1[2][10])));
+                v2 = (((i3 ? v0 : v1) ? (v3 ? 36 : 86) : (10 < a0[14])) != ((v3 * a1[0][12]) == (v0 != v1)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v0 < i2) || (52 <= a0[15])) < ((v3 || v2) * (i2 / 2)));
+        a0[4] = (((v0 != v3) && (64 % 5)) < ((97 >= 21) && (a0[6] + 51)));
+    }
+    v2 = (((13 - a0[6]) < (v2 ? v1 : 12)) && ((a0[5] > v1) + (v3 * 70)));
+    return (((v2 != 84) <= (27 + v1)) || ((35 % 5) >= (a0[15] * 33)));
+}
+int f1() {
+    int v0 = 96;
+    int v1 = 11;
+    int v2 = 69;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((a0[0] * 19) + (v2 <= a0[2])) || ((a0[7] / 8) ? (i0 <= a0[13]) : (i1 ? v1 : v3)));
+                    a0[2] = (((v1 < a0[1]) == (a1[3][11] ? v2 : v2)) <= ((a0[12] / 1) % 8));
+                    a0[1] = (((v1 + a1[2][12]) && (a0[6] || v0)) * ((i1 + v2) % 2));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a1[3][8] || a1[3][10]) - (86 > i0)) < ((v2 * v3) ? (a0[8] < a1[2][10]) : (v3 < v1)));
+            a1[3][10] = (((v0 + a0[0]) <= (v2 % 2)) != ((i0 - v3) / 5));
+            i0 = i0 + 1;
+        }
+    }
+    a0[14] = (((v3 * v2) ? (v1 || v3) : (v0 + v3)) < ((72 < v3) && (14 < a0[14])));
+    v0 = (((v3 == a0[3]) >= (v1 && 85)) * ((v1 != a0[15]) == (27 + v1)));
+    v1 = (((v0 || v2) == (0 > v1)) < ((a1[0][4] % 5) > (a1[2][5] < v3)));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v0 = (((i2 >= v1) >= (a0[15] > a0[11])) + ((3 - a1[3][0]) + (44 && v3)));
+        v2 = (((v1 ? v1 : a0[4]) || (98 != 6)) || ((v2 + 84) <= (a0[12] - 29)));
+        {
+            int i3 = 0;
+            do {
+                v1 = (((a0[3] * 41) || (42 != v1)) - ((i2 && a0[9]) % 7));
+                a1[1][14] = (((i3 <= 26) >= (v1 ? v1 : v2)) && ((v2 == a1[1][15]) ? (16 != a1[2][2]) : (v1 == 84)));
+                v3 = (((a1[3][2] < a1[2][1]) != (a1[1][13] + 82)) % 5);
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    return (((v3 % 9) || (73 + 67)) != ((a0[14] ? 0 : 99) ? (a0[5] > 68) : (57 * a0[12])));
+}
+int f2() {
+    int v0 = 43;
+    int v1 = 74;
+    int v2 = 25;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v3 > i0) < (i0 + a0[3])) ? ((36 % 2) % 6) : ((a0[15] || a0[1]) / 7));
+            v2 = (((v0 * v3) % 5) != ((66 < 79) ? (i0 > v3) : (35 % 9)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((86 && v2) > 95) break;
+                v1 = (((81 / 7) / 2) > ((a0[12] <= v0) ? (v2 && v3) : (v0 <= 69)));
+                v2 = (((a1[1][4] >= v2) > (v2 + a1[3][12])) < ((v0 >= a0[4]) != (53 || v0)));
+                v3 = (((a1[3][15] ? i0 : v1) < (v3 && a0[6])) && ((a0[7] + 22) && (a1[1][13] <= 30)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((i2 <= a1[0][11]) > 79) break;
+        v1 = (((v1 <= v0) % 3) >= ((v1 - a0[12]) * (v2 + a0[11])));
+        v1 = (((a0[6] && 28) > (a0[15] % 1)) / 8);
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v3 = (((a0[2] / 3) || (v2 / 6)) ? ((v1 / 5) / 3) : ((8 > a1[3][14]) && (i3 || 11)));
+                a1[0][9] = (((a1[0][2] || 38) * (a0[9] == v3)) == ((i3 == v1) >= (5 ? i2 : a0[14])));
+                v0 = (((v3 * i2) > (a1[2][5] || a0[6])) - ((59 != 15) - (a1[2][5] % 3)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    a0[0] = (((14 >= a0[0]) >= (v3 == v1)) == ((v3 >= a1[0][9]) <= (a0[1] <= a0[0])));
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v1 = (((31 - 25) * (i4 ? a1[3][4] : a0[12])) && ((a0[11] >= 63) == (41 / 6)));
+                v3 = (((a0[5] > v3) + (i5 * a1[0][3])) + ((v2 == 84) / 7));
+                v0 = (((v0 % 7) == (a0[11] || a0[9])) != ((i4 % 1) % 8));
+            }
+            v2 = (((13 >= a0[13]) != (v1 > 33)) <= ((8 != v2) >= (v3 == i4)));
+            v1 = (((v0 <= a1[0][10]) > (v1 >= v0)) + ((v1 && a1[3][15]) != (v0 ? v0 : 95)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[4] = (((a1[2][11] * a0[2]) > (v3 / 2)) - ((a0[4] || i6) != (v1 > i6)));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v0 = (((a0[4] - i7) ? (i7 > 9) : (81 * 73)) > ((a0[6] - v2) ? (v0 % 1) : (a1[1][10] == 44)));
+                a1[2][10] = (((13 ? 29 : v0) - (a1[0][12] ? a0[13] : a1[2][6])) == ((66 > 15) <= (69 != v1)));
+                a0[12] = (((92 / 4) == (a0[6] ? v2 : i6)) != ((96 <= v1) && (a1[0][15] == a1[3][15])));
+            }
+            v3 = (((a0[2] < 83) >= (v1 < 58)) >= ((v0 == v2) || (a0[4] > v2)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    return (((v3 != 2) != (v1 ? v2 : 3)) * ((30 * a1[2][11]) ? (v3 <= v1) : (a1[2][3] + v1)));
+}
+int main() {
+    return 0;
+}
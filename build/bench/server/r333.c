@@ -0,0 +1,68 @@
+int f0() {
+    int v0 = 38;
+    int v1 = 58;
+    int v2 = 34;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v3 / 4) * (v3 + a1[1][6])) + ((v1 == v3) ? (v3 ? a1[3][9] : v1) : (13 * v3)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a0[10] = (((i0 < v2) >= (i0 || a0[10])) + ((38 != 23) == (v2 + v3)));
+                    a0[6] = (((v2 <= v3) ? (91 && 9) : (v1 ? v0 : v3)) == ((i1 || a0[10]) == (v3 >= 50)));
+                    v0 = (((a1[1][12] + v1) > (88 && a1[1][15])) != ((57 - a1[3][13]) && (a1[2][15] != 96)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v0 + v2) / 7) * ((54 == 14) == (v0 ? v1 : a0[8])));
+            a1[1][13] = (((23 <= 78) == (a1[2][11] < a1[0][11])) || ((v3 > 4) != (a0[10] >= a1[2][7])));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((i2 != 1) > 81) break;
+        v1 = (((v3 * v1) <= (v1 + i2)) - ((a0[7] || a0[3]) <= (5 ? v1 : v0)));
+        v1 = (((i2 || 52) < (a0[6] == 55)) / 6);
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            if ((a1[2][3] != v0) > 79) break;
+            v0 = (((i2 != v1) - (v3 >= 33)) % 6);
+            a0[15] = (((18 * i2) > (v0 ? v3 : v2)) > ((v1 >= v0) == (v3 * v3)));
+            v1 = (((v3 < a0[13]) >= (i2 ? v3 : v1)) ? ((74 / 9) / 7) : ((43 / 2) <= (i3 % 5)));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((21 ? i4 : 25) + (80 >= 41)) <= ((84 && a1[1][0]) - (v2 / 9)));
+            v3 = (((a0[10] * i4) == (v1 == a1[3][13])) >= ((a0[1] && v1) == (v0 / 2)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v3 = (((i4 * i5) < (v1 <= v3)) || ((80 % 1) - (v2 >= a1[0][12])));
+                    v1 = (((a1[1][3] - i4) != (v1 * a1[1][9])) >= ((v1 > a1[3][3]) / 7));
+                    v1 = (((a1[1][4] || v0) / 5) || ((13 && i4) >= (a0[9] ? i4 : v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v2 = (((a0[12] * v2) && (a1[1][2] >= v2)) < ((74 < a0[3]) || (a1[3][10] && i6)));
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            if ((v2 ? a1[1][10] : v3) > 54) break;
+            a0[5] = (((67 && 71) && (43 != v1)) ? ((v3 >= i7) <= (33 && v3)) : ((4 == 91) ? (i7 >= a1[1][3]) : (v0 + a1[2][13])));
+            a1[0][10] = (((a0[1] < i6) / 3) == ((13 ? a1[1][13] : 98) <= (v1 % 7)));
+            a1[0][0] = (((v3 * a0[2]) - (i6 != 55)) * ((v2 > v3) ? (i7 * 11) : (v2 < v0)));
+        }
+        v0 = (((v2 + v1) > (v0 % 5)) / 8);
+    }
+    return (((v1 + a1[3][4]) == (a1[0][2] % 6)) % 2);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,139 @@
+int f0() {
+    int v0 = 30;
+    int v1 = 48;
+    int v2 = 61;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v1 ? a1[2][6] : 64) * (v1 != i0)) != ((83 < a0[12]) ? (93 <= v3) : (i0 < 70)));
+            v2 = (((29 || 6) && (39 != v3)) * ((a1[3][5] > 74) % 4));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((i1 <= a0[1]) / 9) * ((i1 >= v0) + (a0[15] || 69)));
+                    v3 = (((3 * a1[1][7]) - (v3 || i1)) - ((v3 % 6) < (v2 * v0)));
+                    v0 = (((v2 / 5) != (v2 == 1)) != ((87 != i1) / 7));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    a1[3][5] = (((a1[2][14] + a1[3][3]) == (14 ? 89 : v1)) == ((55 > a0[12]) / 8));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((a0[11] < a1[3][2]) > 66) break;
+        a0[2] = (((a1[2][1] / 2) <= (a0[10] + v1)) ? ((v1 < v1) < (v3 / 5)) : ((a0[10] != v3) / 2));
+        v1 = (((v1 > v3) / 2) || ((10 || i2) / 4));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            if ((38 >= a0[7]) > 96) break;
+            a0[0] = (((v2 != v2) ? (v1 % 4) : (v2 % 2)) * ((a1[2][7] || 65) % 6));
+            a0[4] = (((22 + v0) >= (i3 ? a0[11] : 41)) != ((52 || a0[8]) && (65 % 8)));
+            v3 = (((v0 % 8) || (a1[3][0] ? v3 : i2)) % 3);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((v1 / 2) < (v0 ? 83 : 98)) < ((v1 <= 68) != (v3 < 55)));
+            v2 = (((v1 && a1[0][11]) ? (8 % 8) : (a1[3][12] + v1)) < ((35 && v3) - (a1[2][10] - 63)));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    v1 = (((v2 != a0[9]) + (13 ? a0[8] : v2)) || ((i5 / 6) * (a0[2] + v3)));
+                    v2 = (((97 && v1) * (v3 - 25)) ? ((a1[3][12] ? v0 : 59) || (v2 / 2)) : ((41 || i4) ? (v1 - v2) : (a1[1][5] < v1)));
+                    v3 = (((a1[1][3] / 3) / 3) % 3);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            {
+                int i7 = 0;
+                do {
+                    if ((a1[1][5] * v1) > 73) break;
+                    v1 = (((11 - i7) >= (v2 > v2)) >= ((a0[14] == v3) * (v1 || 56)));
+                    v2 = (((a1[2][6] * v3) != (a0[15] * v0)) ? ((v3 + 13) || (v1 / 7)) : ((v0 * a0[13]) && (56 + a1[2][2])));
+                    v0 = (((v0 || 74) == (76 * i7)) <= ((6 % 7) < (i6 != i7)));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            a1[3][15] = (((v0 != a0[2]) ? (v3 - 52) : (v2 == 31)) / 3);
+            v2 = (((i6 ? v3 : i6) / 5) && ((10 % 3) != (38 % 3)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((a0[4] / 8) <= (58 <= v0)) < ((64 + v0) < (a1[0][10] && v3)));
+}
+int f1() {
+    int v0 = 21;
+    int v1 = 92;
+    int v2 = 35;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 && 52) > 85) break;
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((v2 + i1) ? (i0 == 59) : (v1 - 99)) ? ((v3 > 37) ? (v2 ? v3 : a1[2][1]) : (v2 - 30)) : ((a1[2][7] ? v0 : 97) == (v0 + v0)));
+                    v1 = (((v2 - a0[15]) + (a1[3][12] ? v1 : 23)) + ((v3 - a0[6]) > (a1[0][9] + 44)));
+                    v2 = (((58 > 65) % 8) + ((30 < a1[1][8]) + (i1 && 59)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((17 + 96) ? (i0 && v3) : (v2 < v1)) >= ((11 % 4) < (26 ? 33 : a1[1][11])));
+            v3 = (((v0 ? v2 : v1) || (i0 + 91)) > ((82 > a0[8]) + (v1 - v0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((a1[0][1] * 89) || (v0 - a0[5])) - ((87 || a1[3][10]) ? (v0 * 28) : (46 || v0)))) {
+        a0[14] = (((76 ? 46 : 24) && (v2 / 7)) ? ((v3 <= a1[2][14]) < (96 >= v2)) : ((v1 % 2) % 5));
+        v0 = (((a1[2][4] * v3) + (45 != v0)) > ((v3 < v0) <= (v0 != v3)));
+        a0[14] = (((v1 == v1) % 3) + ((v1 * a1[3][1]) < (a1[2][10] != 51)));
+    } else {
+        a0[13] = (((63 ? 94 : 82) - (39 + a0[5])) == ((v1 <= v3) * (v2 > 74)));
+        a1[3][9] = (((v1 ? v2 : 13) > (v1 != v3)) + ((a1[0][9] <= v2) + (a0[12] || a0[1])));
+        v2 = (((v1 + a1[0][6]) * (v0 < 6)) != ((a1[1][8] >= v3) != (51 % 3)));
+    }
+    if ((((v3 - v2) ? (v2 <= a1[2][14]) : (51 < v1)) > ((v0 % 3) % 8))) {
+        a1[2][7] = (((v3 ? v2 : v3) == (v3 / 4)) > ((a0[9] ? 55 : v3) >= (a0[12] >= 99)));
+        v0 = (((a0[0] < a0[3]) + (v1 <= 77)) == ((61 ? v1 : 76) >= (v0 + v2)));
+        v2 = (((v3 + v0) && (87 ? v0 : v3)) || ((v2 < 82) % 7));
+    } else {
+        v0 = (((53 || a1[0][12]) < (v3 / 6)) + ((a1[2][2] < 16) - (a1[2][10] ? a1[2][9] : v3)));
+        v2 = (((v0 >= a1[3][7]) % 4) ? ((83 - 31) || (v0 - a1[0][3])) : ((v2 % 6) % 1));
+        v0 = (((v2 > 74) && (v2 * v1)) <= ((v1 ? a1[1][10] : a0[0]) - (v1 % 4)));
+    }
+    v3 = (((55 && v3) ? (a0[0] / 2) : (91 >= v0)) > ((v3 == v3) >= (56 * v3)));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v0 = (((a1[2][4] == v2) / 2) * ((a1[3][12] || v2) >= (v0 > 53)));
+                    v2 = (((52 <= v1) == (v2 || v2)) * ((11 / 6) || (v3 && v1)));
+                    v3 = (((a0[7] || 43) ? (82 > a1[3][13]) : (a1[3][0] < 12)) ? ((a1[2][8] || a1[0][14]) > (6 * 77)) : ((a0[6] == a0[7]) * (v2 != v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((85 % 1) % 9) ? ((a1[3][1] < v0) * (v1 < v0)) : ((v3 + v3) || (77 >= 10)));
+            v3 = (((i2 - v0) != (a0[0] - a1[0][0])) ? ((84 != v1) % 4) : ((a1[1][0] + v3) != (a0[0] % 1)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((45 != v0) > (34 <= 92)) >= ((23 || v3) == (a0[12] && 51)));
+}
+int main() {
+    return 0;
+}
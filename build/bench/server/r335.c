@@ -0,0 +1,178 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 88;
+    int v2 = 67;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v0 = (((a0[6] % 6) % 3) - ((v3 <= v2) % 3));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                if ((i1 % 6) > 89) break;
+                v3 = (((7 ? 84 : v3) - (i1 == v1)) - ((a1[1][2] || 55) + (i0 - 60)));
+                a0[11] = (((a0[4] > 83) < (a1[1][12] ? 0 : 14)) % 5);
+                a0[12] = (((35 % 6) < (i0 - a1[0][6])) ? ((a1[3][11] % 5) >= (40 % 6)) : ((a0[4] / 1) && (i0 != 12)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((v0 + 82) % 6) && ((v2 ? v0 : i0) ? (87 > v1) : (i0 + i0)));
+    }
+    if ((((v0 != a0[6]) && (v3 * v3)) - ((v1 == v1) == (15 ? a0[6] : 19)))) {
+        a1[2][0] = (((v0 - v2) || (21 != v3)) >= ((v2 - v3) <= (v2 < v2)));
+        v3 = (((a1[1][4] % 7) * (v0 == v0)) >= ((v3 >= a0[6]) == (39 && v3)));
+        v1 = (((v0 % 1) || (v1 % 6)) ? ((v2 > v3) || (95 / 3)) : ((v3 > a1[2][9]) || (54 % 2)));
+    } else {
+        v1 = (((v3 == 95) + (62 ? 39 : v0)) - ((v2 <= 65) <= (v1 - a1[0][11])));
+        a0[1] = (((v3 / 3) ? (v3 ? 81 : 4) : (v1 ? v1 : 73)) - ((v3 != v1) >= (86 >= v1)));
+        v2 = (((v0 >= v2) == (v1 && a0[5])) / 2);
+    }
+    if ((((55 % 9) > (v1 % 3)) < ((v2 || 44) > (a0[7] + v0)))) {
+        a0[12] = (((v0 && 80) || (a0[11] ? v1 : a0[8])) ? ((v3 && a1[2][8]) - (v1 ? v0 : v3)) : ((v1 != v2) || (55 % 1)));
+        a0[14] = (((a1[3][3] >= v1) < (v0 ? v2 : v1)) != ((v0 >= 51) - (v0 - v0)));
+        v3 = (((v1 < v0) % 9) - ((v2 && 39) > (v2 && 16)));
+    } else {
+        a1[2][9] = (((96 ? 30 : v3) == (v2 + a0[7])) ? ((v0 + a0[4]) * (57 <= 19)) : ((23 <= 86) * (a1[1][6] == 42)));
+        a0[11] = (((v0 ? v2 : a1[1][1]) ? (v0 > v0) : (37 > 43)) ? ((v2 < 69) - (a1[2][5] % 4)) : ((37 <= a0[1]) <= (v3 - v1)));
+        a0[2] = (((4 / 5) ? (v0 % 7) : (a1[3][9] / 7)) != ((97 + v1) * (12 / 9)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v2 = (((a0[7] <= a0[5]) % 4) > ((v1 && i2) % 2));
+                v1 = (((62 + i3) + (v0 % 1)) != ((v3 / 3) - (39 + i2)));
+                v0 = (((i2 > a1[3][13]) * (a0[12] || 9)) || ((a0[5] % 4) == (33 == 90)));
+            }
+            v0 = (((a1[1][14] > v2) * (a0[9] || a0[8])) % 8);
+            a1[2][9] = (((3 && v3) / 9) * ((35 - a0[14]) % 6));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 2) {
+                v2 = (((15 != 1) >= (0 > a1[0][3])) + ((v2 * v3) == (v1 != 64)));
+                a0[2] = (((v0 > i4) * (v2 && v3)) && ((i4 - v0) ? (a0[3] != a1[3][6]) : (i5 != v2)));
+                v2 = (((v3 ? a0[14] : a1[1][15]) % 7) || ((v2 + a1[2][0]) || (50 * a1[3][0])));
+                i5 = i5 + 1;
+            }
+        }
+        v3 = (((v2 == 31) <= (v3 ? v3 : v1)) ? ((i4 == v0) < (a1[0][5] ? a1[1][6] : v3)) : ((v1 < v0) == (83 / 9)));
+        a1[0][5] = (((v0 <= a0[1]) ? (v0 || v3) : (60 % 2)) <= ((a0[10] / 3) != (i4 / 8)));
+    }
+    return (((v2 / 6) > (36 ? v1 : v0)) <= ((a0[3] > v2) == (a0[5] > v3)));
+}
+int f1() {
+    int v0 = 57;
+    int v1 = 1;
+    int v2 = 85;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    a0[7] = (((v0 ? 41 : a1[3][7]) / 4) && ((v3 ? v3 : 35) + (93 >= v3)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((v3 >= a1[2][1]) > 53) break;
+        v2 = (((v0 ? v2 : a1[2][10]) < (56 < v1)) && ((a0[7] ? 43 : 56) == (v2 * i0)));
+        v0 = (((v0 && v1) < (1 - v3)) ? ((v1 / 1) <= (v3 % 8)) : ((i0 / 2) && (43 != v0)));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v3 = (((22 ? v1 : 95) - (v1 / 2)) != ((v2 > i1) < (i1 < v3)));
+                a0[2] = (((i1 <= i0) >= (a1[0][3] - i1)) ? ((v1 < v3) > (v3 % 4)) : ((v1 + v0) - (a1[2][2] <= v2)));
+                v2 = (((8 || i0) > (a1[2][4] <= i0)) - ((a1[0][14] - i0) * (v3 ? a1[1][7] : v2)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    if ((((20 < v0) <= (4 * v1)) + ((v2 / 9) == (a0[11] && v0)))) {
+        v1 = (((a1[2][0] + v0) / 5) < ((18 == 35) < (v3 < a1[2][11])));
+        v3 = (((a1[2][0] ? v0 : 15) > (56 - a0[12])) + ((1 / 1) || (v3 ? v2 : 17)));
+        v2 = (((56 >= 56) < (89 || v0)) > ((56 % 5) + (v2 && v1)));
+    } else {
+        a1[2][11] = (((v1 != a0[4]) < (v2 / 4)) * ((v0 == 20) * (v1 || 15)));
+        a0[13] = (((a1[3][11] - a0[5]) < (v3 || v2)) ? ((v3 / 6) - (v1 ? 65 : v0)) : ((a1[3][9] == 89) ? (v3 / 4) : (a1[2][2] == v0)));
+        a1[3][11] = (((v0 < a0[3]) < (43 != 39)) % 6);
+    }
+    v0 = (((21 > 26) ? (v0 * v1) : (v3 && v2)) < ((v1 < a0[11]) != (v1 > v1)));
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v3 ? a0[10] : 86) || (v3 > v2)) > ((i2 && a0[13]) || (v1 < 98)));
+            v2 = (((i2 <= 6) % 7) == ((7 != v1) < (35 * a1[3][7])));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v0 = (((v3 || 22) && (v3 / 3)) + ((v2 || 83) < (a0[0] <= a0[3])));
+                    v1 = (((a1[2][15] % 1) ? (a0[0] * 58) : (v0 || 1)) && ((61 ? v1 : i2) || (91 && 44)));
+                    a1[1][2] = (((49 > a0[15]) * (a1[0][10] % 5)) + ((a0[8] > 69) >= (39 != 85)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    return (((v1 / 2) % 6) >= ((v3 - v0) ? (a0[7] != 3) : (v1 && 32)));
+}
+int f2() {
+    int v0 = 15;
+    int v1 = 5;
+    int v2 = 32;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((i0 / 2) > 99) break;
+            a1[1][13] = (((26 != v2) <= (v1 && 61)) && ((48 && 12) ? (v3 / 1) : (55 - v0)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((84 - a1[0][3]) > 86) break;
+                v1 = (((66 ? v0 : v1) >= (i1 <= 2)) + ((i1 < 57) && (a1[0][4] + v1)));
+                a1[2][7] = (((v2 <= a1[1][4]) + (v3 + 28)) ? ((i0 + v1) % 7) : ((v2 != i0) == (68 - a0[6])));
+                v0 = (((a0[14] == 23) - (63 <= v3)) <= ((i1 ? v0 : a0[3]) - (i0 ? a0[5] : v0)));
+            }
+            v0 = (((5 - v2) >= (a0[2] ? a0[3] : a0[9])) > ((i0 ? a1[1][1] : v2) > (v3 >= v1)));
+            i0 = i0 + 1;
+        }
+    }
+    a1[2][5] = (((a1[1][7] && v0) || (v1 != 65)) / 5);
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((v0 <= v2) - (a1[1][5] / 3)) && ((a1[1][7] <= 84) == (a1[1][13] != v2)));
+        {
+            int i3 = 0;
+            do {
+                if ((i3 < v1) > 61) break;
+                v1 = (((a1[1][12] >= 92) ? (94 != i3) : (11 <= i3)) ? ((i3 < v0) * (13 % 7)) : ((v0 && 93) ? (v0 == v0) : (v0 != v2)));
+                a0[14] = (((i2 + v3) && (83 >= a1[0][11])) < ((i2 / 9) == (a0[3] % 2)));
+                v2 = (((a1[0][4] || v2) != (i2 >= v0)) >= ((v2 || a1[3][11]) >= (v0 > a0[7])));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        a1[3][4] = (((v1 + v1) + (v1 > v0)) && ((i2 <= v2) % 2));
+    }
+    if ((((47 != v0) == (v2 || a1[0][7])) <= ((42 && v1) > (v2 - 9)))) {
+        v0 = (((v3 && v3) < (a1[1][9] / 8)) && ((a1[0][6] >= a0[3]) >= (26 && v0)));
+        v2 = (((v0 && a1[3][4]) && (v2 == 6)) < ((v0 - a0[7]) != (a1[3][13] <= v1)));
+        v3 = (((89 * a0[14]) ? (55 && v2) : (v2 == v3)) * ((a1[3][0] <= v0) - (77 >= v3)));
+    } else {
+        a0[8] = (((a0[3] ? v1 : v1) - (a0[2] % 4)) && ((a1[0][6] >= v2) ? (a1[2][3] || 40) : (v0 || v2)));
+        a0[15] = (((v2 && v3) * (a1[2][15] * a1[2][1])) < ((v0 < v1) > (4 + 9)));
+        v2 = (((a0[2] ? v0 : a0[9]) == (v1 > 21)) - ((v0 / 5) >= (v1 / 7)));
+    }
+    if ((((v1 < a0[1]) <= (v3 && v1)) && ((a0[2] / 3) - (32 < v3)))) {
+        v3 = (((a1[3][2] && v2) != (a0[9] >= v1)) >= ((v2 >= v1) - (v2 ? 55 : a0[10])));
+        v1 = (((v3 - v3) / 8) < ((96 + v3) != (63 / 7)));
+        v3 = (((v0 == 79) * (v0 == v2)) ? ((55 && v0) && (v3 < 9)) : ((v0 == v2) / 9));
+    } else {
+        v2 = (((v2 <= a0[3]) && (v1 && v1)) / 5);
+        a1[2][3] = (((a0[15] < v2) != (a0[2] && 64)) && ((97 || v1) && (7 * v1)));
+        a0[3] = (((a0[11] ? 82 : v2) / 1) ? ((v0 <= v0) - (v1 ? a0[13] : v3)) : ((v3 + v1) - (v2 ? v0 : v3)));
+    }
+    return (((28 && v1) <= (v3 % 9)) ? ((v0 || v3) % 8) : ((v0 + a1[3][12]) * (v1 >= 78)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,67 @@
+int f0() {
+    int v0 = 8;
+    int v1 = 90;
+    int v2 = 33;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[4] != v2) && (a1[2][4] && v3)) % 2);
+    {
+        int i0 = 0;
+        do {
+            a0[14] = (((i0 + v1) % 7) ? ((v1 + a0[4]) <= (a1[1][13] >= a1[3][1])) : ((v1 == v2) || (63 ? a0[15] : v3)));
+            v0 = (((70 > v0) ? (14 && a1[0][6]) : (a1[0][10] % 1)) - ((a0[15] / 5) && (a0[8] + v0)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((a1[0][3] >= v0) > 77) break;
+                    a1[3][15] = (((a1[0][8] <= v1) < (63 == v3)) ? ((i0 ? i0 : v2) * (38 + v3)) : ((a0[2] - v3) / 5));
+                    v2 = (((12 == a0[13]) ? (45 > i0) : (v2 == a1[1][9])) <= ((11 < 93) == (v1 ? 4 : i1)));
+                    v3 = (((89 / 6) ? (v2 || v3) : (a0[12] * a1[1][10])) || ((v2 < a1[0][0]) && (63 ? i1 : 25)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v1 = (((v0 - v0) < (v0 != 66)) * ((v0 - v1) != (a1[2][11] ? a0[12] : a1[3][6])));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[4] == 93) > 80) break;
+                    a1[1][10] = (((v1 * i3) ? (a0[15] + a1[0][15]) : (a0[11] % 9)) <= ((59 != v1) * (v1 || a0[10])));
+                    a0[1] = (((a1[0][11] > a1[0][0]) * (5 != v3)) > ((64 % 9) <= (v3 < v3)));
+                    v3 = (((a1[3][5] - i3) || (i2 >= i2)) || ((i3 ? a0[2] : v1) <= (71 < v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            a1[3][10] = (((a1[0][15] ? v2 : a0[14]) < (v0 ? a1[1][7] : v0)) ? ((v3 && a1[3][15]) || (a0[13] * v3)) : ((v2 % 6) > (v1 ? 39 : 89)));
+            a0[12] = (((94 || 71) < (i2 != v0)) + ((v0 + a0[1]) && (i2 + a0[0])));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v3 = (((v2 % 5) * (43 % 3)) != ((v1 ? 2 : a1[3][5]) % 2));
+            a0[11] = (((v2 < v3) % 9) == ((63 != a1[1][15]) && (i4 ? i4 : v0)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v1 / 1) ? (v3 > i4) : (i5 || v0)) <= ((55 ? 24 : v1) <= (a0[8] - v0)));
+                    v3 = (((47 >= a0[6]) ? (v1 + v0) : (i5 - i5)) > ((v3 ? v2 : 33) && (v2 || v1)));
+                    v3 = (((76 == a1[2][2]) == (i5 < a1[3][4])) != ((v0 <= i4) || (83 ? 99 : v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[4] > a1[1][5]) > (a1[1][3] + a0[12])) + ((v0 % 3) != (48 <= v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,130 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 20;
+    int v2 = 65;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((53 < v0) <= (v2 - a0[14])) >= ((a0[13] ? v0 : 85) && (i0 && 66)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a1[2][14] = (((v3 >= 86) <= (88 ? v1 : 91)) / 6);
+                v1 = (((74 / 1) && (v1 * v2)) ? ((76 != i0) - (a1[0][3] < 26)) : ((v2 == i0) / 2));
+                v0 = (((v1 > v1) <= (v3 ? v2 : 13)) != ((a1[0][13] < i0) * (57 / 7)));
+            }
+            v2 = (((23 < a0[12]) == (37 - 12)) || ((v3 * v3) / 2));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                if ((v3 < 32) > 74) break;
+                v1 = (((91 <= v0) ? (v1 ? v3 : 2) : (v0 >= v3)) > ((v0 - a0[8]) + (a0[10] ? a1[1][2] : a0[2])));
+                v3 = (((66 != v0) <= (2 - 1)) % 3);
+                v0 = (((i2 >= i2) ? (a1[2][9] >= i3) : (v3 / 7)) >= ((69 > i2) ? (a0[13] - v0) : (60 * v2)));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        a1[2][1] = (((a1[0][12] != 19) >= (v0 < 25)) - ((i2 % 3) < (i2 != v1)));
+        a1[3][8] = (((a0[11] * 47) == (v1 % 2)) || ((a1[2][11] * i2) ? (a0[5] ? v0 : v2) : (v0 + v0)));
+    }
+    if ((((a1[1][13] || v1) + (v3 + a0[5])) != ((a0[5] * v1) ? (5 == v2) : (25 || v3)))) {
+        a1[2][5] = (((a0[8] ? v1 : 61) / 3) != ((v0 == v0) ? (v0 / 5) : (v2 != 18)));
+        a1[0][2] = (((v2 <= v1) <= (44 != 23)) * ((v3 || v1) >= (v3 > v0)));
+        v0 = (((v0 * v2) < (4 <= 57)) || ((14 ? v0 : 70) || (v1 == v1)));
+    } else {
+        v1 = (((a0[10] >= 9) % 7) == ((a1[0][14] && v3) < (v1 != v1)));
+        v0 = (((v2 ? 91 : v0) ? (8 && a0[3]) : (v2 ? v1 : 19)) != ((53 ? v3 : v0) % 5));
+        v3 = (((v3 + v1) * (60 == 62)) % 1);
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v2 > 19) <= (a1[0][10] ? v3 : a0[13])) % 6);
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v1 = (((v1 % 5) * (36 || v2)) && ((v3 == 56) * (i5 || 56)));
+                v1 = (((a1[1][8] + a0[14]) - (v3 ? v0 : 83)) ? ((49 > a0[8]) == (v0 && 91)) : ((i5 == v0) != (v1 && a0[9])));
+                v1 = (((a0[15] / 9) - (v0 != v2)) != ((i4 <= a1[2][2]) >= (50 == 79)));
+            }
+            v2 = (((a1[2][10] * a0[8]) == (a0[13] + a1[2][1])) >= ((21 % 9) ? (a1[3][1] && 17) : (v1 < 26)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                if ((i7 < 82) > 65) break;
+                v2 = (((91 - v0) >= (i7 ? 59 : a0[4])) >= ((6 < 84) > (a1[3][7] > 37)));
+                v0 = (((v2 - 39) + (35 <= v0)) + ((i7 * a1[1][2]) < (i7 * v1)));
+                v0 = (((a0[0] ? v1 : 50) ? (v2 + 53) : (v3 * v1)) >= ((v0 / 5) - (71 || a0[0])));
+            }
+            v2 = (((a1[2][3] ? 94 : v2) > (7 + v1)) || ((v2 >= v0) * (v3 && a1[1][5])));
+            v0 = (((v0 < 8) <= (a1[1][1] == i6)) == ((v0 <= v2) * (v1 % 5)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    return (((26 < 38) - (a0[4] ? a1[1][13] : 79)) / 3);
+}
+int f1() {
+    int v0 = 73;
+    int v1 = 7;
+    int v2 = 42;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v2 >= a1[1][5]) || (v0 >= v1)) / 6);
+            v2 = (((v3 || a0[4]) ? (36 ? v2 : i0) : (78 && a1[3][9])) != ((i0 <= i0) * (v3 > 8)));
+            {
+                int i1 = 0;
+                do {
+                    a0[15] = (((v1 + 77) != (a0[15] * a0[13])) + ((20 > 65) + (i1 == 94)));
+                    v0 = (((a1[1][5] > 8) * (v2 % 4)) || ((v1 > v3) < (i0 % 8)));
+                    v0 = (((a1[0][5] != i0) > (v1 ? v0 : 36)) + ((i1 % 3) % 3));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v2 = (((v1 >= v3) && (87 && v0)) && ((a0[3] - v2) * (v2 < a1[3][8])));
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v2 + a0[11]) == (i2 % 1)) % 2);
+            v1 = (((v0 + 81) != (i2 - v0)) - ((v1 != 4) ? (v3 >= v3) : (v3 - a1[0][15])));
+            {
+                int i3 = 0;
+                do {
+                    if ((v1 > v0) > 58) break;
+                    a0[0] = (((v1 ? v2 : i2) != (v1 ? i2 : a0[14])) * ((v2 / 3) >= (60 * i3)));
+                    v2 = (((v2 > i2) * (v0 - 98)) + ((i2 >= 76) < (v1 * 27)));
+                    v1 = (((a1[3][9] > v1) == (50 ? i3 : 49)) < ((a0[8] / 6) ? (86 >= a0[6]) : (22 || 63)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v1 = (((i5 > 45) ? (i5 && 40) : (a1[2][12] ? v1 : v2)) <= ((v3 ? v2 : 82) >= (a0[13] * 95)));
+            v0 = (((a1[2][11] + v3) >= (i5 > a0[14])) != ((63 / 2) / 7));
+            v1 = (((v2 > i5) == (v0 < v0)) == ((a0[1] ? a0[8] : a1[3][12]) && (a1[0][5] - i5)));
+        }
+        a1[3][7] = (((a0[8] || i4) % 8) >= ((v3 % 6) < (v1 || v2)));
+        v3 = (((45 * v3) * (i4 != a1[3][7])) ? ((a0[4] ? 20 : 9) && (v2 >= v0)) : ((99 ? 14 : a0[3]) + (78 % 3)));
+    }
+    a0[11] = (((a0[4] >= 36) > (v2 >= v2)) || ((5 - 70) ? (45 / 7) : (v1 <= v3)));
+    return (((a0[12] ? a1[1][11] : v0) >= (a1[3][9] + 17)) < ((v1 || 66) % 1));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,193 @@
+int f0() {
+    int v0 = 62;
+    int v1 = 19;
+    int v2 = 94;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    if ((((42 / 1) % 7) + ((v2 ? v2 : a0[13]) < (v3 == a0[8])))) {
+        a0[1] = (((v0 + v0) < (v0 >= 17)) >= ((v1 ? a0[7] : v1) ? (5 * 73) : (v0 + v3)));
+        v1 = (((v3 || v1) <= (17 - v2)) < ((v2 && v3) ? (43 == 49) : (a1[2][10] >= v0)));
+        a0[4] = (((v0 + a0[9]) == (v2 - v1)) ? ((a0[1] > v0) == (a0[9] == v2)) : ((a0[15] >= 45) == (v1 || v2)));
+    } else {
+        v0 = (((v0 - 82) * (v0 < v0)) <= ((20 || a0[15]) - (v2 + v0)));
+        v2 = (((v0 == v1) < (v0 > v2)) < ((a1[0][2] > v2) || (57 > v0)));
+        v2 = (((v0 % 7) == (v2 + v0)) < ((v2 >= a0[9]) - (v3 % 4)));
+    }
+    v3 = (((v1 != a1[1][2]) ? (v1 * v2) : (v2 + a0[2])) / 2);
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((a1[3][10] < v3) > 80) break;
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v3 % 4) == (a0[13] / 5)) <= ((i1 <= 98) < (62 < a1[2][9])));
+                    v2 = (((v2 % 9) <= (v0 == v3)) + ((88 - a0[8]) == (a0[10] ? v0 : a0[0])));
+                    a1[0][14] = (((v2 / 9) > (v2 * a1[2][3])) >= ((65 >= v1) <= (i0 != 58)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v2 = (((a1[3][8] * 20) ? (a1[2][9] * i0) : (a0[15] || a1[2][14])) + ((v2 == a1[3][15]) < (a0[10] >= a0[1])));
+            v2 = (((v2 || v2) ? (92 || a1[0][8]) : (85 / 6)) ? ((82 * a0[4]) || (a0[4] && a1[3][7])) : ((a0[0] < v3) == (40 + a0[9])));
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((a1[0][2] >= v0) ? (v3 - a1[1][13]) : (v1 < v3)) - ((v1 ? a1[0][0] : v2) <= (v1 <= v0)));
+    if ((((v3 >= 68) < (44 && 79)) % 4)) {
+        v0 = (((v1 ? 79 : a1[1][10]) + (60 >= v3)) ? ((v1 == v3) ? (90 % 5) : (v1 != v1)) : ((42 <= v2) <= (v1 != a0[2])));
+        v0 = (((90 > 53) - (a0[7] || 88)) + ((a0[0] <= v2) + (v0 == v0)));
+        v3 = (((a1[1][10] != v1) != (a1[1][7] && v1)) == ((v1 <= a1[0][7]) == (99 ? v3 : a1[2][8])));
+    } else {
+        a1[3][11] = (((95 == a1[2][6]) > (a1[3][11] % 3)) - ((60 + v2) > (36 ? 26 : v1)));
+        v2 = (((21 == a1[3][9]) - (37 < a1[2][0])) && ((22 < 7) == (46 || v0)));
+        v2 = (((16 ? a0[12] : v0) == (v2 ? 94 : a0[4])) == ((12 && a1[2][14]) * (v0 >= a1[2][2])));
+    }
+    return (((a0[4] >= 49) || (v1 <= v2)) != ((a0[3] >= 19) < (v1 * v0)));
+}
+int f1() {
+    int v0 = 3;
+    int v1 = 21;
+    int v2 = 87;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((a1[1][5] + i0) > 51) break;
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    a0[7] = (((58 ? i1 : 37) >= (6 <= 90)) - ((a1[0][3] + a1[2][9]) / 3));
+                    v3 = (((a0[5] ? i1 : a1[1][10]) ? (v1 >= i0) : (63 == v2)) - ((i1 - v0) * (47 > v0)));
+                    a0[13] = (((68 > v2) < (a0[6] + v2)) / 4);
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v2 ? v1 : a1[2][9]) * (v2 ? v3 : 33)) ? ((v3 == 54) <= (8 / 3)) : ((v3 && v1) == (12 <= v2)));
+            v2 = (((a0[5] / 3) ? (v2 * a1[1][12]) : (a1[3][2] ? 64 : 37)) ? ((a0[0] != 58) == (v3 || v2)) : ((a0[14] ? v3 : v0) <= (v3 >= v0)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 % 2) <= (v3 && v1)) == ((v2 - a0[4]) && (v2 - v2)))) {
+        v2 = (((57 <= a0[10]) * (v1 <= v1)) == ((v0 ? 99 : a0[13]) >= (v3 ? v2 : v3)));
+        v2 = (((v2 - v2) <= (91 + 73)) && ((81 ? v3 : v0) && (a0[9] + 30)));
+        v1 = (((v2 != a0[2]) < (a1[3][14] - 77)) % 2);
+    } else {
+        v3 = (((v3 - a0[11]) / 8) * ((a0[14] ? a1[3][0] : 7) != (a1[1][2] > 86)));
+        v0 = (((91 + v0) && (v3 ? v2 : 5)) * ((v2 > v1) % 2));
+        v0 = (((v0 >= v0) != (a1[2][8] ? a0[11] : v1)) ? ((96 || a1[2][15]) != (v0 >= a0[4])) : ((a1[1][13] + v0) * (v3 % 6)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a0[3] = (((v0 && v2) ? (41 < v3) : (26 != a1[1][14])) || ((18 && v3) <= (40 * 88)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            a0[11] = (((a0[6] <= v2) && (v1 ? a1[2][8] : v0)) ? ((61 && 44) || (i3 >= v0)) : ((83 ? a0[11] : 22) > (14 - a1[2][10])));
+            v2 = (((a0[13] > a1[2][15]) && (68 != v0)) % 3);
+            a0[6] = (((a0[14] ? i3 : 98) == (i3 ? a1[0][2] : a0[8])) + ((v2 != v0) / 7));
+        }
+        v2 = (((66 || a0[5]) ? (46 - v1) : (v1 + 72)) * ((92 == v2) < (a1[3][9] < v3)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    a1[3][13] = (((v3 != v2) < (86 ? 32 : i5)) && ((i5 != a1[3][9]) && (v1 || v3)));
+                    a1[0][6] = (((34 <= a1[2][10]) > (a0[0] > v3)) ? ((v0 * v1) + (a0[14] * 94)) : ((a1[1][4] + a1[3][8]) % 4));
+                    v1 = (((v0 <= v2) ? (a0[12] + 64) : (v0 % 5)) < ((v2 || 99) < (73 < 52)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((v1 * a1[2][2]) + (v2 <= v3)) <= ((29 || v0) > (i4 < a0[13])));
+            v2 = (((v3 == 4) / 6) ? ((a0[11] <= a1[0][1]) != (v0 / 8)) : ((a1[3][0] != v0) <= (v2 * v2)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    v3 = (((a1[2][2] > v3) >= (v0 < a1[2][1])) / 9);
+                    v2 = (((97 >= a1[1][10]) != (65 != a0[0])) || ((i6 < 50) == (v1 <= a1[0][7])));
+                    v3 = (((v1 + 18) / 5) <= ((a0[10] > v0) || (a1[0][0] > 80)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((a1[0][5] == v1) <= (44 / 3)) / 8);
+            v2 = (((i6 ? v3 : v1) + (a0[12] + v0)) || ((a0[13] == 88) ? (a1[1][7] && v0) : (v2 <= 59)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((17 + 17) == (38 % 8)) || ((a0[3] ? a1[3][14] : a0[8]) || (v1 + a1[1][10])));
+}
+int f2() {
+    int v0 = 49;
+    int v1 = 5;
+    int v2 = 81;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v3 / 9) < (20 || a0[5])) * ((v3 >= a0[3]) - (v2 ? 30 : a0[10])));
+    if ((((v3 == 5) >= (v1 / 8)) && ((51 < a0[11]) + (16 ? v0 : 50)))) {
+        v1 = (((a1[3][1] != v0) < (82 / 4)) <= ((74 - 19) ? (v1 % 5) : (37 >= v0)));
+        v2 = (((97 >= a0[7]) && (a0[8] * v2)) % 8);
+        a1[2][3] = (((v2 > 50) - (86 ? 12 : 35)) ? ((v3 * 65) == (v2 ? a0[1] : a0[14])) : ((v1 != v2) + (49 < v0)));
+    } else {
+        v3 = (((v1 ? v1 : v0) + (v3 && v2)) - ((v0 / 5) + (v1 <= a0[0])));
+        v1 = (((47 * a1[1][10]) && (a1[2][7] && 0)) % 2);
+        a0[0] = (((v2 * 2) > (a0[15] != 91)) >= ((a1[3][7] <= a0[12]) / 2));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v0 = (((v1 < i0) + (12 && 69)) ? ((i0 + a1[1][11]) <= (a1[1][0] * 69)) : ((a1[3][2] <= v3) ? (a0[14] || v2) : (i0 && v0)));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a1[2][6] >= a0[4]) * (v2 + i0)) ? ((v1 - v2) == (i0 < 34)) : ((i1 / 7) != (v2 && a0[5])));
+                a1[0][13] = (((a0[5] < v1) ? (a0[6] / 8) : (i1 - 89)) == ((i0 == v3) == (v1 == a1[0][14])));
+                v1 = (((a0[11] && i0) <= (a1[0][7] % 8)) >= ((v3 ? 89 : v1) < (63 <= a0[3])));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v0 = (((60 ? 80 : 79) < (75 - v1)) == ((v0 ? a1[1][10] : 40) <= (v0 ? a1[2][6] : a0[13])));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((a0[10] <= a0[11]) > 81) break;
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v3 = (((74 == i2) ? (52 && 3) : (v2 == 29)) == ((v1 ? a0[2] : 31) > (17 != a0[3])));
+                v0 = (((v1 > v1) >= (a1[3][12] < v2)) / 5);
+                v2 = (((v1 ? v1 : 99) <= (i3 ? v3 : a1[1][13])) || ((i2 <= 12) - (i2 != 81)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((32 * a1[2][15]) % 2) > ((v0 / 3) + (89 % 4)));
+        v1 = (((77 == v0) % 3) > ((9 || v1) - (a0[9] % 6)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v1 == v0) > 78) break;
+            v1 = (((52 ? v3 : 56) / 5) && ((v0 + v1) / 8));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((37 < i4) ? (a1[3][8] < v2) : (v1 % 8)) - ((11 / 6) <= (a0[5] - v1)));
+                    v1 = (((41 || v1) - (v2 - v3)) / 9);
+                    v2 = (((i5 * a1[1][15]) != (v3 % 9)) + ((a1[3][4] ? a0[5] : v2) ? (a0[6] <= a0[0]) : (a1[3][14] % 6)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v0 = (((v3 % 5) ? (a0[0] && v1) : (v2 || a0[13])) || ((64 / 1) <= (v1 ? a1[0][6] : 9)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((v1 <= v2) <= (v2 + v2)) >= ((v1 < a0[3]) || (v2 - 15)));
+}
+int main() {
+    return 0;
+}
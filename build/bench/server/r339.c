@@ -0,0 +1,54 @@
+int f0() {
+    int v0 = 84;
+    int v1 = 41;
+    int v2 = 94;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    a0[11] = (((v3 > 19) >= (a1[1][3] ? v2 : 69)) ? ((89 || v0) == (v0 != v1)) : ((a0[4] < 34) ? (v0 == 54) : (v2 > v2)));
+    if ((((v3 / 2) < (v0 * v2)) % 6)) {
+        v0 = (((a1[2][15] <= v2) == (a1[2][4] * 44)) + ((v1 * a0[2]) / 4));
+        v1 = (((a1[3][14] <= 75) < (v1 * v0)) || ((v0 ? v2 : a0[5]) - (78 - v1)));
+        a1[2][4] = (((v0 <= v2) >= (24 ? v3 : 63)) || ((v0 < 32) - (a0[3] && a0[11])));
+    } else {
+        v1 = (((a0[12] / 6) ? (66 <= a1[0][12]) : (v1 >= 79)) > ((v1 < 46) == (a0[10] && a0[10])));
+        v1 = (((a1[0][0] >= 37) < (v1 % 6)) <= ((a1[0][5] == a0[2]) || (a0[14] - v2)));
+        a1[3][12] = (((48 + a0[7]) * (v3 == v1)) ? ((v2 >= v3) ? (v2 + a0[1]) : (v3 ? v3 : a0[3])) : ((v1 / 2) <= (v2 ? 72 : v3)));
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((56 < a1[0][11]) && (v2 / 8)) / 5);
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            v3 = (((v1 - a0[0]) || (6 || i1)) ? ((i1 != i1) >= (32 <= 41)) : ((v1 - 92) + (78 ? 25 : i1)));
+            v3 = (((30 < a1[3][11]) - (v2 == v3)) || ((a0[8] == i1) ? (49 / 1) : (v1 != a1[1][8])));
+            v1 = (((v2 > 44) == (69 - i0)) ? ((v2 ? a1[3][9] : v0) % 5) : ((a0[3] % 3) + (i1 <= v2)));
+        }
+        a1[1][8] = (((v1 == v1) && (91 != v3)) * ((i0 + a0[6]) == (61 % 6)));
+    }
+    if ((((92 && 51) ? (47 != v0) : (v1 ? 62 : 83)) || ((64 != 49) != (v0 == a0[6])))) {
+        a1[3][15] = (((10 > a1[2][0]) ? (v1 % 6) : (a0[6] * v0)) % 2);
+        v1 = (((a0[9] % 4) != (v3 && v2)) / 6);
+        v3 = (((a0[7] >= v0) ? (v3 + 0) : (35 > v1)) * ((v3 + 22) >= (41 || 35)));
+    } else {
+        v3 = (((a0[6] != v1) + (27 + a0[9])) && ((v2 + a1[1][11]) == (v0 != v3)));
+        v1 = (((a0[10] == 62) + (19 != v2)) + ((v1 * 48) * (14 <= a0[1])));
+        v0 = (((46 * v3) != (9 ? v3 : v0)) != ((v0 != a1[3][14]) || (15 % 3)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                if ((a0[9] != i3) > 96) break;
+                v0 = (((a0[8] && 48) + (10 + v3)) != ((a1[3][15] >= 13) - (a0[0] - 71)));
+                a0[6] = (((v1 / 2) != (i3 <= v1)) ? ((63 && i3) * (i2 + a1[0][11])) : ((v1 <= v0) < (76 < 38)));
+                a1[1][0] = (((i3 || a0[7]) ? (54 < v3) : (33 + v3)) && ((11 < i3) * (77 - v2)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v3 = (((v0 * a0[12]) > (a0[2] / 4)) / 1);
+        a1[3][8] = (((v0 != 93) / 1) - ((a1[3][13] ? v2 : v3) % 5));
+    }
+    return (((v2 == v1) - (a0[15] % 6)) == ((93 != v0) >= (v1 - v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,138 @@
+int f0() {
+    int v0 = 17;
+    int v1 = 19;
+    int v2 = 68;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a1[2][12] ? 52 : v3) > 93) break;
+        v1 = (((a0[10] ? 53 : a0[12]) ? (a1[0][7] - 74) : (a1[3][3] ? v0 : a0[13])) != ((67 ? i0 : v0) == (18 / 5)));
+        a1[0][13] = (((92 || v2) > (a0[3] < 18)) % 5);
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                a1[0][13] = (((a0[7] && 53) * (71 - v1)) + ((v2 + 77) + (a0[15] + v0)));
+                v0 = (((v1 != v1) < (a1[3][4] && v0)) <= ((i0 >= v3) % 3));
+                v2 = (((v0 - v0) - (v3 + v2)) + ((i1 / 7) == (v1 || v2)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((75 > v2) > 80) break;
+        a1[0][4] = (((4 || i2) >= (a0[13] || v1)) > ((a1[0][13] / 5) != (v1 && v2)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v1 = (((77 >= a1[1][3]) == (v1 < a0[6])) == ((v2 != v1) <= (v0 ? 91 : 41)));
+                a0[12] = (((54 || i3) ? (v1 <= v3) : (i2 < 66)) || ((a1[0][6] - v0) / 6));
+                v1 = (((v1 != a1[2][14]) && (a1[2][10] <= i2)) < ((v1 || v0) >= (a1[0][14] <= v2)));
+                i3 = i3 + 1;
+            }
+        }
+        a1[1][10] = (((a0[3] <= v1) == (v0 && v0)) + ((a0[2] / 7) / 6));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((a1[3][11] ? v2 : 79) > 89) break;
+            a1[2][15] = (((v2 < v2) ? (v0 - i4) : (a0[9] || v1)) != ((84 - 31) == (78 == 42)));
+            a1[0][13] = (((v3 % 8) > (v3 || a0[5])) / 6);
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v0 = (((v0 == a0[12]) != (a0[1] == i4)) > ((i4 + v0) || (v2 / 5)));
+                    v2 = (((62 < i5) % 7) - ((v1 + a1[2][2]) ? (i4 * v1) : (27 ? i5 : i4)));
+                    v3 = (((88 ? 36 : v0) % 1) >= ((98 / 4) + (a1[1][5] <= i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v2 = (((v3 ? 75 : v0) && (a1[3][0] == v3)) <= ((i6 >= v2) * (a1[2][9] < v1)));
+            a0[13] = (((v3 >= v0) + (12 ? i6 : a1[2][9])) <= ((16 > 73) - (a0[12] < a1[0][12])));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v0 = (((v1 < v0) % 9) ? ((a1[2][11] < a1[0][15]) ? (v0 == 44) : (a1[1][3] == i7)) : ((v0 >= a0[0]) && (v3 <= v1)));
+                v0 = (((v1 + i6) != (99 == v3)) ? ((i7 ? i6 : v1) * (i6 % 8)) : ((a0[9] - v2) + (39 ? v0 : v1)));
+                a1[3][3] = (((v2 != a0[10]) ? (i6 * v1) : (v0 && i6)) ? ((i6 % 1) || (64 ? i7 : 43)) : ((71 != i7) > (73 - v2)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    a1[1][10] = (((a0[5] > v3) < (v1 || v2)) % 2);
+    return (((v2 > v0) * (v0 % 2)) <= ((v2 - a1[2][8]) < (v0 >= 40)));
+}
+int f1() {
+    int v0 = 28;
+    int v1 = 3;
+    int v2 = 48;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 * 65) / 9) ? ((v2 - 39) >= (v2 <= v1)) : ((v2 && v0) ? (62 * v0) : (v3 + v3)))) {
+        v3 = (((v1 <= 97) * (v3 > v1)) >= ((a1[2][1] % 3) && (v1 < v3)));
+        v1 = (((v2 && v3) % 7) / 7);
+        v3 = (((v3 && 46) != (a0[0] * v0)) || ((v1 && a1[0][2]) >= (v3 < 60)));
+    } else {
+        a1[3][9] = (((a0[3] + a0[6]) % 5) % 9);
+        a0[14] = (((54 / 1) != (50 != a1[3][1])) ? ((v2 ? 14 : a1[2][4]) > (v3 || 15)) : ((a0[2] || v2) && (79 + v0)));
+        a1[2][12] = (((a0[7] + a0[9]) || (v2 * 7)) > ((v3 % 9) != (v3 || v0)));
+    }
+    if ((((a1[2][7] == v0) ? (a1[3][11] / 8) : (a0[13] < a0[14])) <= ((v0 ? 14 : v3) > (a0[4] + v2)))) {
+        v0 = (((v1 + v1) != (38 || v1)) && ((v3 + v2) ? (a1[0][8] <= a0[7]) : (a0[11] + v1)));
+        a1[2][6] = (((a0[1] * a1[0][15]) == (v0 >= 83)) == ((v1 && a0[5]) && (a1[1][5] + v2)));
+        v1 = (((a0[7] / 5) > (14 >= a1[1][1])) == ((62 <= v1) < (a1[2][3] + a0[12])));
+    } else {
+        a0[11] = (((v2 + a1[0][3]) / 6) != ((96 != v1) * (v1 < v0)));
+        a1[3][4] = (((35 != v0) >= (v2 < a1[2][8])) == ((v3 * a1[2][0]) <= (a0[8] % 1)));
+        v2 = (((17 ? v2 : a1[2][0]) / 9) != ((v0 * v0) == (v0 == a0[8])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                a1[2][6] = (((8 && a1[1][11]) >= (v2 < i1)) && ((v2 ? a0[10] : v0) - (i1 < a1[0][14])));
+                v2 = (((a1[2][9] >= 56) * (a1[3][15] / 6)) <= ((v1 <= i0) ? (v0 || v0) : (i1 <= a1[0][1])));
+                a1[2][5] = (((v2 > v3) >= (v3 + v0)) ? ((v0 ? v1 : a1[2][10]) <= (a0[3] >= 81)) : ((v0 - a0[5]) ? (a1[2][10] / 6) : (20 ? i1 : 13)));
+            }
+            v0 = (((31 <= 96) || (i0 * a1[2][10])) < ((94 ? 9 : v2) <= (a0[12] / 3)));
+            a1[2][9] = (((20 / 6) == (v3 / 9)) > ((v3 || a0[9]) + (i0 && 1)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v3 = (((95 >= v0) < (a1[1][11] == 4)) - ((a0[2] % 9) >= (v2 <= a1[1][2])));
+        v2 = (((i2 != a1[0][14]) / 4) / 2);
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                if ((a0[8] <= 4) > 86) break;
+                a1[3][4] = (((83 - a0[2]) == (23 < 28)) % 5);
+                v0 = (((a0[5] != a0[12]) % 7) < ((v0 <= a1[2][14]) > (v3 * a1[1][5])));
+                v2 = (((v3 + i2) > (86 % 6)) - ((93 && 31) != (v0 * 77)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((10 >= v0) <= (v0 && v0)) || ((v1 ? v1 : 71) / 1))) {
+        v0 = (((59 + v3) != (v1 - 98)) % 3);
+        v1 = (((9 * 15) <= (a1[2][6] ? v1 : a1[1][1])) >= ((43 / 8) * (a0[2] == v0)));
+        a0[3] = (((a0[13] >= v2) + (v3 && a0[0])) && ((v0 % 6) - (69 != 17)));
+    } else {
+        a0[12] = (((v0 * v0) - (v3 / 8)) ? ((v3 - v2) == (v3 >= a0[2])) : ((a0[1] || a0[15]) % 6));
+        a0[7] = (((v0 >= v2) + (v1 >= v0)) % 9);
+        v3 = (((v2 ? 44 : v1) + (3 ? 89 : 83)) + ((v3 || a0[5]) > (v2 > v2)));
+    }
+    return (((v3 ? 92 : 7) * (v2 - v0)) ? ((a1[0][15] <= a1[3][11]) || (v2 ? v0 : v0)) : ((v3 == v2) <= (a1[2][4] + v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
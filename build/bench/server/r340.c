@@ -0,0 +1,119 @@
+int f0() {
+    int v0 = 87;
+    int v1 = 85;
+    int v2 = 71;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[12] || 39) || (v2 < v0)) % 3)) {
+        v3 = (((a0[1] > a1[1][2]) && (60 == v2)) <= ((a0[2] != a1[1][3]) || (v2 == a1[3][7])));
+        v2 = (((v3 / 2) ? (v0 >= 20) : (71 ? v0 : v2)) % 3);
+        v3 = (((v0 ? 56 : v2) + (a1[0][14] * v0)) - ((v2 - 45) % 6));
+    } else {
+        a0[5] = (((v2 >= a1[1][9]) != (v3 != a0[15])) / 5);
+        v0 = (((v0 ? v0 : 10) * (a0[9] * v1)) || ((a1[3][4] - v3) <= (9 > a1[0][7])));
+        a0[10] = (((a1[3][4] * v0) <= (70 || v1)) > ((v2 == v0) == (a1[0][14] || 47)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            a0[5] = (((v0 > v0) && (84 && v3)) == ((12 < i0) < (90 + v2)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    a1[3][8] = (((v2 / 8) * (a0[2] < v2)) && ((i0 >= 98) / 4));
+                    v2 = (((a1[2][8] || a0[11]) % 2) >= ((a0[7] >= i1) >= (76 ? v0 : a0[3])));
+                    a1[3][6] = (((36 ? i1 : v3) ? (a1[2][2] * a1[2][8]) : (34 || 97)) != ((73 % 3) >= (20 % 3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v2 % 2) - (v3 == 11)) >= ((v3 != v1) || (v3 != 29)));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((v1 && a0[15]) ? (v3 / 8) : (v3 != v3)) % 4);
+    v0 = (((v3 <= a1[2][4]) == (v1 ? v0 : 22)) > ((a0[5] == v0) - (v2 ? v1 : v0)));
+    if ((((29 <= v0) >= (v1 ? a1[0][3] : 79)) <= ((a1[3][8] * 59) >= (v3 < v3)))) {
+        v3 = (((86 != v1) != (20 - v0)) != ((38 - v0) / 3));
+        v2 = (((54 - 39) != (v2 == 61)) / 8);
+        v3 = (((68 % 1) + (6 / 7)) > ((a1[0][6] % 2) != (3 - v2)));
+    } else {
+        a0[11] = (((a0[10] ? 78 : a0[7]) > (v1 < v1)) ? ((a0[14] - 1) && (64 == v0)) : ((a0[10] > a0[11]) ? (a0[11] ? v2 : v1) : (45 || a0[15])));
+        v3 = (((5 && a0[0]) > (v0 <= v0)) && ((v0 / 1) == (v1 + v0)));
+        v2 = (((v2 / 7) < (a1[2][12] - v1)) + ((v3 > v0) > (53 * v0)));
+    }
+    return (((a1[0][0] * v0) % 3) < ((a1[1][6] && v2) || (v0 + a0[11])));
+}
+int f1() {
+    int v0 = 49;
+    int v1 = 47;
+    int v2 = 86;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v2 = (((62 ? a1[3][4] : a0[4]) < (a1[1][8] / 4)) >= ((v1 && a1[0][8]) && (56 > i0)));
+        v1 = (((64 + 44) ? (a0[11] || a1[2][7]) : (60 && 70)) - ((a1[1][10] && 83) >= (97 < v1)));
+        {
+            int i1 = 0;
+            do {
+                a0[10] = (((64 == i0) / 6) ? ((v0 <= v2) && (91 != a0[11])) : ((v0 + i1) != (v2 % 4)));
+                v0 = (((a1[3][1] + v3) + (i1 <= a1[1][4])) <= ((38 % 1) ? (v0 + a1[1][2]) : (a1[3][1] && i0)));
+                v1 = (((12 <= 76) >= (v1 < a0[1])) % 4);
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    if ((((v0 * 85) ? (a1[0][6] * a0[10]) : (70 || 84)) || ((v1 || v1) && (v2 == v1)))) {
+        a1[2][13] = (((a1[1][8] ? v1 : 55) ? (v1 * 15) : (v3 ? v1 : a0[15])) < ((v2 || a0[2]) + (v0 || v0)));
+        a1[1][4] = (((v3 && v3) <= (v0 > a0[11])) + ((61 % 8) / 8));
+        a1[0][9] = (((v2 + 24) || (v3 < 52)) >= ((52 >= v1) + (a0[15] > v3)));
+    } else {
+        v3 = (((7 - 89) <= (a1[0][12] < 94)) + ((v2 / 8) != (v3 + v3)));
+        a1[2][0] = (((68 == v2) != (67 <= v1)) ? ((a0[11] ? v1 : 63) ? (a1[0][15] / 9) : (a0[7] > a0[14])) : ((a1[0][1] == v3) > (v2 ? v2 : v3)));
+        a0[8] = (((54 + a1[2][7]) || (v1 ? v2 : a0[14])) + ((a0[4] && 41) ? (19 < 82) : (v2 % 1)));
+    }
+    if ((((v0 / 3) > (29 != a0[0])) || ((v1 * a0[1]) <= (v2 == v3)))) {
+        v3 = (((v0 < v1) - (v1 * v3)) || ((v0 == 73) < (v3 * a1[2][8])));
+        a0[10] = (((v0 / 7) <= (v0 * 79)) % 1);
+        a1[0][11] = (((45 != a1[1][3]) - (a1[1][9] <= a1[3][8])) ? ((v0 <= 24) != (v0 ? a0[6] : a1[3][7])) : ((a1[1][15] && v0) ? (v2 || v1) : (v1 / 4)));
+    } else {
+        a1[0][10] = (((v0 ? 38 : v2) == (v2 / 1)) > ((v1 < v3) <= (v2 >= v0)));
+        a1[2][2] = (((v2 ? v2 : v0) ? (a1[0][13] <= 56) : (52 == v0)) ? ((v1 || 66) / 2) : ((48 ? a0[5] : a1[2][0]) - (a0[13] || 45)));
+        v0 = (((v2 % 4) <= (v1 && a0[5])) - ((v3 + a0[6]) != (v0 % 3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v0 = (((v3 != a0[3]) - (v3 ? 70 : 80)) ? ((64 + v3) / 1) : ((19 <= v3) % 8));
+                    a1[0][3] = (((59 == 56) + (a1[1][6] + 55)) - ((v3 <= 43) + (v0 / 2)));
+                    v3 = (((a1[0][12] - v0) + (v0 && 64)) && ((i3 ? a0[4] : a0[15]) % 9));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v3 ? i2 : i2) / 1) < ((v1 - a0[12]) * (49 >= v0)));
+            a1[0][15] = (((v2 || 57) && (62 >= v0)) + ((v2 * 3) >= (a0[10] + v3)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v2 = (((v3 == i5) % 5) && ((68 || a0[9]) - (v1 ? a0[4] : v3)));
+                a1[3][1] = (((v1 == a0[8]) ? (73 + a1[3][4]) : (16 ? 20 : a1[0][8])) != ((a0[11] != i5) && (v0 != a0[7])));
+                a1[1][0] = (((a1[2][0] + v1) - (v2 % 2)) + ((i5 % 8) / 1));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+        v0 = (((a1[0][3] || v0) / 2) && ((a1[0][11] - 30) || (97 - v3)));
+        a1[2][13] = (((v2 && 70) < (v2 <= 92)) ? ((v1 == v0) ? (v0 <= v1) : (16 % 2)) : ((5 ? v1 : 68) || (v2 < a1[1][6])));
+    }
+    return (((26 != v3) || (90 || 83)) + ((v3 == v0) * (a1[2][3] + v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,195 @@
+int f0() {
+    int v0 = 95;
+    int v1 = 87;
+    int v2 = 92;
+    int v3 = 94;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 || v1) < (v2 || a0[6])) * ((a0[10] + v2) || (v0 < 83)));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((26 * a0[4]) > 51) break;
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((a0[14] * 52) || (v2 || a0[2])) >= ((v0 - i1) * (a0[12] % 1)));
+                    a1[1][0] = (((v2 < i0) / 4) && ((i0 - a1[1][1]) % 7));
+                    a0[15] = (((54 >= a0[15]) ? (a1[0][1] && 11) : (i1 || i1)) != ((a1[3][5] ? a0[15] : v2) - (v2 * a0[11])));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v3 <= v3) >= (v1 && i0)) == ((39 != a0[6]) && (v1 != v0)));
+            a0[7] = (((93 == a1[0][5]) != (a1[2][6] > v1)) ? ((a0[8] / 2) != (a0[5] < 45)) : ((v0 - v1) + (v2 / 5)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((13 + v1) ? (v0 - 75) : (v3 >= 93)) || ((v3 || v2) + (v3 <= v2)))) {
+        a0[0] = (((a1[3][2] && 16) ? (a1[2][2] > a1[2][1]) : (a1[3][13] < v3)) > ((v3 + a0[10]) / 7));
+        v1 = (((51 < a0[5]) % 3) >= ((61 || v3) ? (v1 >= v3) : (a1[1][4] <= a0[15])));
+        a1[0][10] = (((a1[0][10] % 7) % 8) > ((24 - 75) != (v3 < a0[11])));
+    } else {
+        a0[1] = (((v3 ? 72 : a0[12]) != (v1 + v1)) > ((a1[3][6] && a1[2][12]) == (v3 * 7)));
+        v3 = (((v1 == a0[14]) % 7) > ((v1 - a0[12]) >= (v3 ? 53 : v3)));
+        v1 = (((a0[9] % 6) > (0 >= 95)) + ((v0 + 25) % 5));
+    }
+    v0 = (((21 >= 60) >= (34 <= a1[3][12])) % 1);
+    v3 = (((v2 && a0[13]) ? (v2 ? v1 : v1) : (v3 < v3)) || ((v1 < 61) && (a0[2] - v2)));
+    return (((v3 % 8) * (a1[3][4] / 4)) ? ((61 / 7) == (v3 ? v1 : v0)) : ((v2 > a0[13]) + (v2 % 9)));
+}
+int f1() {
+    int v0 = 97;
+    int v1 = 87;
+    int v2 = 73;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((18 ? 21 : v3) % 7) > ((a1[0][11] != v1) ? (v1 != i0) : (67 - a1[2][1])));
+                    v0 = (((a1[3][12] * 63) + (i0 < a1[0][1])) / 8);
+                    a1[1][13] = (((47 / 2) < (i0 ? a0[15] : i1)) % 4);
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a1[2][13] + v3) == (5 > a0[4])) != ((5 + 68) ? (a1[2][10] != 64) : (63 > i0)));
+            v0 = (((v3 || 78) < (i0 % 8)) <= ((v1 >= v1) <= (a0[13] / 2)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((a0[5] - v3) > 58) break;
+        a1[2][13] = (((i2 <= a1[3][7]) && (v2 - 62)) * ((a1[3][0] * a0[4]) < (v0 != v2)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            a1[0][4] = (((i3 > 67) > (a0[14] - v0)) ? ((7 - i2) - (v3 < v0)) : ((a0[8] > v3) - (38 || v1)));
+            v2 = (((v3 > 54) * (a0[7] * v1)) ? ((11 / 1) % 6) : ((a0[13] > v3) <= (v0 ? 66 : i2)));
+            a1[1][0] = (((i2 - i2) || (26 <= i3)) / 4);
+        }
+        v1 = (((v2 && 99) ? (99 != v2) : (v1 > 67)) && ((v3 <= a1[1][8]) == (v1 >= 1)));
+    }
+    if ((((a0[15] % 2) % 4) - ((v0 ? v1 : v0) > (83 > a1[1][2])))) {
+        a0[1] = (((70 < v2) + (v1 % 4)) ? ((71 == a1[2][10]) != (a0[9] % 5)) : ((v1 > v3) != (v3 || a1[0][15])));
+        v0 = (((a1[3][13] > v1) ? (55 == 69) : (32 ? v1 : 50)) % 9);
+        v3 = (((v0 % 5) == (v1 && a1[2][4])) >= ((a1[3][10] < 16) + (63 != v2)));
+    } else {
+        v1 = (((a1[1][4] > a1[2][8]) >= (v1 || v2)) > ((a0[1] == 52) && (v0 ? v1 : v2)));
+        v2 = (((a1[2][2] == v2) != (a1[3][6] <= v3)) < ((v2 + a1[3][13]) + (44 >= v2)));
+        a0[4] = (((v1 < v0) ? (v3 * v0) : (59 < 61)) + ((v1 <= v0) % 7));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    if ((a1[3][0] <= v1) > 72) break;
+                    v2 = (((i5 <= 89) ? (i4 >= v1) : (v3 % 8)) + ((v3 == v3) - (i5 ? v1 : a1[0][12])));
+                    v3 = (((45 && 14) <= (94 ? i5 : 9)) || ((a1[0][3] || a0[10]) ? (v1 >= i4) : (a0[6] ? v1 : a0[1])));
+                    a1[3][12] = (((22 == 91) == (i4 < a1[0][15])) ? ((a0[7] - a0[14]) ? (a1[0][8] / 1) : (v2 * a1[0][2])) : ((v3 == 92) * (v2 + 85)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v0 || a0[8]) && (47 && v2)) > ((a0[6] % 8) * (17 < a1[2][13])));
+            v1 = (((i4 % 2) != (59 * v2)) < ((a1[1][10] > v0) != (a0[9] && v2)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 + v3) == (v2 <= 74)) + ((58 % 4) || (14 > v1)))) {
+        a0[10] = (((4 <= v0) && (v2 / 3)) % 8);
+        v0 = (((v1 - 17) && (v2 && v1)) < ((v2 || v0) + (v3 + v3)));
+        a0[4] = (((77 <= v1) < (v1 < 21)) > ((a0[10] ? v0 : v2) * (v3 * 77)));
+    } else {
+        v0 = (((9 <= v2) <= (45 / 1)) == ((a1[2][2] ? 44 : 2) <= (v3 - v3)));
+        v2 = (((48 >= v1) * (77 && a0[10])) > ((v3 || 98) ? (v1 && v3) : (14 * v3)));
+        v0 = (((v1 ? v3 : v3) != (a0[6] * v3)) * ((v3 <= a1[3][9]) < (v1 >= v1)));
+    }
+    return (((v3 == v0) > (a0[1] + a1[0][10])) < ((v2 <= a1[1][13]) || (v0 ? v3 : a0[13])));
+}
+int f2() {
+    int v0 = 80;
+    int v1 = 82;
+    int v2 = 18;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v0 = (((a0[11] / 8) - (v3 > v1)) + ((v3 ? i0 : v0) < (i0 % 6)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v1 = (((v3 >= a0[13]) ? (21 != v1) : (v0 ? i0 : i1)) != ((97 && 2) + (i0 != a1[3][8])));
+                a0[2] = (((a1[1][6] / 3) > (8 > v2)) - ((a1[3][2] - i0) && (a0[12] - i1)));
+                v1 = (((i1 < 77) <= (v2 < 3)) + ((i1 ? v1 : 52) == (v0 > a1[1][5])));
+            }
+            a0[1] = (((69 - v3) && (3 > a1[3][15])) && ((49 >= a0[12]) * (12 ? v1 : a1[0][9])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((i2 && v0) && (v1 > 94)) % 9);
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    a0[1] = (((v3 % 2) ? (a0[2] ? a1[2][2] : a0[10]) : (a0[0] == a1[3][0])) ? ((75 < i3) || (i3 <= 79)) : ((v1 != v2) ? (11 && 12) : (v1 + v0)));
+                    v2 = (((i3 / 1) >= (42 == i2)) != ((v2 + a1[0][13]) % 4));
+                    v0 = (((i2 && a1[3][6]) > (a0[12] / 5)) / 9);
+                    i3 = i3 + 1;
+                }
+            }
+            a1[1][14] = (((v2 ? v3 : v1) % 1) % 9);
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((a1[0][9] / 4) ? (v2 + 68) : (v2 > v2)) || ((v1 <= v0) + (a0[8] <= 29)))) {
+        a0[5] = (((v2 <= v0) < (a0[9] || a0[11])) > ((76 <= 86) >= (v3 > v1)));
+        a0[5] = (((v2 - a1[3][8]) ? (v3 > v0) : (v2 < 55)) >= ((v1 == a1[3][4]) ? (10 == v0) : (v3 || v0)));
+        v0 = (((82 == a0[4]) % 9) > ((a1[1][6] <= v3) > (42 + a0[4])));
+    } else {
+        a1[0][14] = (((a1[2][3] >= v1) < (v2 == 91)) && ((v3 ? 90 : v3) && (v3 / 1)));
+        v0 = (((a0[7] > v2) - (v0 && v0)) ? ((a1[0][15] == v2) == (a1[1][8] >= v3)) : ((70 / 6) == (a0[5] != v0)));
+        v1 = (((a1[1][10] + 17) >= (a0[15] != 44)) && ((a0[9] == v3) != (v1 > 3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a1[1][6] ? 81 : a1[1][14]) > 87) break;
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    if ((a0[4] && a0[7]) > 67) break;
+                    v1 = (((v2 * v1) + (a1[1][14] && v3)) || ((v2 - 5) + (v3 ? i4 : a0[9])));
+                    a0[12] = (((v1 > v3) <= (a1[1][4] / 8)) == ((58 >= i5) && (67 || a1[1][6])));
+                    v0 = (((29 + i5) <= (i4 + 28)) >= ((v0 >= i4) <= (77 <= i5)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v0 != i4) >= (83 <= a0[4])) + ((35 && 2) != (v3 <= i4)));
+            v1 = (((v2 == v1) % 1) - ((v2 == 24) ? (a1[2][12] - a1[0][6]) : (v2 || v2)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((37 - a1[3][1]) > 68) break;
+        v2 = (((62 < v2) >= (0 != i6)) < ((a1[2][5] && v0) <= (a0[7] < i6)));
+        a0[1] = (((v0 <= a1[1][0]) != (v2 * v1)) < ((a1[3][1] <= v0) > (v0 - 88)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                v1 = (((v1 == v3) != (v1 - i6)) == ((a0[3] + i6) || (v1 ? 30 : i6)));
+                v1 = (((66 - v0) < (v1 % 2)) || ((v3 <= a0[8]) > (30 * i7)));
+                a1[2][3] = (((62 ? v2 : v0) % 9) <= ((v0 == 45) >= (37 / 6)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    return (((v2 == v1) - (v1 == v1)) ? ((61 == v2) % 8) : ((v0 <= v1) ? (27 != v0) : (43 > 78)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,84 @@
+int f0() {
+    int v0 = 99;
+    int v1 = 61;
+    int v2 = 46;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v3 = (((v0 == a1[3][10]) + (a0[10] % 7)) + ((v1 / 3) > (a1[3][3] % 5)));
+            v0 = (((v1 ? v0 : v0) != (a0[4] >= v3)) + ((a1[2][2] - v2) != (39 <= v1)));
+            v1 = (((a1[3][5] - i0) / 4) + ((i1 * v0) * (i0 && 10)));
+        }
+        v0 = (((a0[14] - v3) * (v1 && v3)) ? ((a1[0][9] < v1) / 4) : ((a1[2][9] * v0) || (v1 / 5)));
+        v2 = (((v0 && 14) - (94 == v0)) && ((v2 > v3) > (v3 + i0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[1] ? v1 : a0[9]) > 78) break;
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    a1[0][13] = (((i3 / 5) + (i2 != v3)) + ((a1[2][11] && v0) ? (v3 - 15) : (v3 > v1)));
+                    v0 = (((v0 || a1[1][6]) + (v3 ? a0[2] : v0)) >= ((v3 >= 19) >= (97 + i2)));
+                    v1 = (((a0[13] + a0[15]) < (i3 || v2)) && ((v2 % 4) ? (i3 != v0) : (a0[3] || a1[3][9])));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[1][10] = (((v3 <= 56) / 7) + ((a1[3][4] - v1) / 8));
+            v3 = (((90 <= v3) / 9) <= ((20 ? v0 : v2) ? (a0[14] ? a1[3][3] : v2) : (v2 || 95)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((v2 ? v1 : 27) > 67) break;
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((v1 + 62) % 4) > ((i5 || 55) == (36 < a0[0])));
+                    a1[2][9] = (((v2 ? a1[1][6] : i4) >= (v1 < i5)) > ((i5 - 76) ? (26 != i5) : (v2 != a0[11])));
+                    v1 = (((a0[4] - 12) && (i5 * i4)) || ((v3 % 5) / 8));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((v0 ? a1[2][13] : a1[2][7]) <= (a1[0][13] >= v1)) + ((v0 > v2) > (a1[1][15] % 7)));
+            v3 = (((6 < a0[6]) / 4) || ((v0 == v2) && (i4 ? a1[2][9] : 43)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v2 = (((a0[11] ? v2 : v3) && (45 - v1)) % 8);
+        a0[12] = (((77 && v3) || (v3 >= a1[1][5])) % 5);
+        {
+            int i7 = 0;
+            while (i7 < 5) {
+                v3 = (((i7 % 7) == (v1 > v0)) || ((i6 > a0[10]) || (32 != v3)));
+                a1[3][7] = (((65 + a0[14]) * (v0 ? a0[1] : 75)) * ((31 + v3) * (a1[3][2] == a0[3])));
+                a1[1][9] = (((i7 * a1[2][8]) % 5) + ((26 == i7) + (i7 > v0)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+                if ((v3 || v1) > 80) break;
+                v1 = (((a1[0][5] > 75) <= (35 == v1)) / 7);
+                v1 = (((v0 <= a1[2][6]) * (8 ? v2 : a1[0][15])) + ((i8 != 44) - (v1 - v1)));
+                v3 = (((i8 >= v1) ? (56 <= a0[13]) : (a1[0][15] > i9)) && ((33 ? v2 : i8) * (i9 != 76)));
+            }
+            a1[1][4] = (((a1[2][8] || v3) + (9 || a1[0][2])) ? ((i8 && v2) && (v0 && v3)) : ((v2 >= a1[1][13]) >= (90 || v2)));
+            a1[0][10] = (((v3 + i8) > (v3 % 7)) % 7);
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    return (((16 != a0[6]) == (a0[6] ? a0[15] : 15)) / 8);
+}
+int main() {
+    return 0;
+}
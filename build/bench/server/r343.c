@@ -0,0 +1,127 @@
+int f0() {
+    int v0 = 97;
+    int v1 = 48;
+    int v2 = 41;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v2 = (((v3 ? i0 : 18) || (v0 || v0)) >= ((4 < v3) == (73 ? v1 : v1)));
+        v0 = (((v1 + i0) ? (i0 < a1[2][0]) : (v0 - a0[1])) && ((v0 % 3) / 6));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                a1[1][13] = (((i0 < v1) < (v3 ? 5 : 65)) - ((a0[13] != v1) >= (38 % 8)));
+                a0[6] = (((a0[14] || a1[0][14]) + (a0[14] || 81)) >= ((v2 / 5) - (63 != 5)));
+                v2 = (((v2 * 49) >= (i0 != a0[5])) > ((a1[1][7] % 6) || (v3 != i1)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            {
+                int i3 = 0;
+                do {
+                    a0[6] = (((v1 ? a0[7] : i3) < (i2 != a1[0][10])) % 5);
+                    v2 = (((v3 - v1) / 4) < ((a1[1][8] == v1) < (v3 != 40)));
+                    a1[1][3] = (((a1[1][9] > v3) + (27 == 62)) || ((86 - 27) * (i2 > v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            a0[1] = (((7 < v0) <= (v3 + 65)) + ((v1 <= 34) ? (59 % 4) : (34 < a0[3])));
+            v3 = (((a0[13] ? v1 : 8) && (65 <= a1[1][14])) / 9);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[2][12] ? v1 : a0[8]) || (a1[3][7] != v3)) < ((v2 ? 7 : v1) % 9))) {
+        a0[12] = (((a0[9] != a0[0]) < (a0[6] || v3)) == ((v3 <= a0[12]) || (a0[11] ? v1 : a0[7])));
+        a0[9] = (((a0[11] < 59) || (46 <= 73)) < ((94 % 7) || (v0 && a1[0][2])));
+        v2 = (((v1 % 2) == (25 == 0)) <= ((a1[1][3] != v1) <= (1 >= a0[8])));
+    } else {
+        a1[0][5] = (((v2 == v3) <= (82 < 59)) >= ((v2 == v2) != (26 / 8)));
+        a0[12] = (((v3 == a0[7]) ? (v0 == 37) : (a1[0][14] == a0[11])) <= ((v3 <= v1) >= (v1 * 42)));
+        v1 = (((a1[0][14] ? 77 : a1[3][0]) < (v3 - v0)) != ((v2 + v2) <= (v2 <= a1[3][13])));
+    }
+    if ((((v1 >= 85) == (v0 >= v2)) >= ((47 == 16) / 7))) {
+        v0 = (((a1[0][11] < v1) >= (v0 && a1[3][10])) < ((v0 ? a0[5] : v3) > (a1[1][13] + a1[2][12])));
+        a0[7] = (((v3 <= v2) - (v3 != 11)) / 5);
+        v1 = (((a0[13] % 5) > (v2 % 9)) ? ((v2 || 74) ? (a1[1][9] || v0) : (v2 ? v2 : 85)) : ((v2 || v2) <= (v2 != a0[12])));
+    } else {
+        v1 = (((31 && v0) - (v2 == v3)) - ((v3 - v0) + (v2 / 4)));
+        v1 = (((v0 > a0[7]) * (v3 == v3)) < ((a0[12] > a0[5]) ? (a0[3] - a1[3][2]) : (v3 > a1[2][10])));
+        v2 = (((v1 + v3) && (a0[8] > a0[8])) || ((v3 ? v0 : a0[15]) ? (v3 + a1[1][14]) : (v2 != 35)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v2 = (((3 + i4) && (33 != 66)) > ((v3 >= a1[3][7]) ? (83 >= 9) : (i5 <= v3)));
+                    v1 = (((7 - v0) ? (v0 % 4) : (v3 / 7)) <= ((v2 < a0[5]) <= (v2 < i4)));
+                    a0[10] = (((v3 ? i4 : 0) % 8) % 3);
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v2 <= a0[2]) < (v0 != v3)) < ((a1[0][13] == 12) * (a0[11] / 2)));
+            v1 = (((v0 / 8) > (a1[0][6] ? a0[4] : 86)) - ((v0 <= v2) + (v2 && 26)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v2 && 97) > (98 || 42)) - ((v1 || v0) < (a1[1][1] && v3)));
+}
+int f1() {
+    int v0 = 81;
+    int v1 = 18;
+    int v2 = 9;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[2][9] = (((a1[1][5] + a1[3][14]) - (54 + 79)) ? ((v1 && v1) % 7) : ((v2 >= a1[2][11]) || (v2 && v2)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[1][9] = (((a0[11] > v2) >= (85 && v2)) * ((v0 != i0) * (a0[3] ? v1 : v3)));
+                    v1 = (((10 * i0) < (v0 >= 81)) && ((a1[0][15] <= a1[3][0]) || (a0[4] >= a1[2][11])));
+                    v2 = (((i1 || a1[0][8]) == (v0 ? v3 : a1[3][11])) / 6);
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((i0 % 7) || (v3 > a0[13])) % 1);
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a0[0] || v1) > (a1[3][14] <= v0)) >= ((a1[0][1] && 10) != (a0[8] / 4)));
+            v2 = (((17 || v0) % 2) ? ((a0[13] == 78) * (a0[8] * 10)) : ((i2 && a0[6]) < (85 - v2)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v1 = (((65 / 5) ? (i3 && v2) : (a1[0][9] <= v0)) && ((i3 < v2) - (v0 ? a0[10] : v1)));
+                v3 = (((v1 / 2) % 9) + ((a1[1][2] - v1) && (a1[1][8] || a1[1][1])));
+                v0 = (((57 >= 30) + (i2 <= v1)) / 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v2 = (((v3 > v2) - (64 <= a1[3][8])) * ((v2 > v3) / 7));
+    a0[5] = (((84 != a0[3]) < (1 + v1)) != ((52 < v2) != (v3 <= 51)));
+    if ((((3 % 3) != (a0[4] == a1[1][1])) / 3)) {
+        v2 = (((32 >= a1[1][0]) + (a0[10] && a1[1][10])) > ((a0[15] > 15) <= (a1[0][1] >= a0[1])));
+        v2 = (((v0 < v3) / 8) % 9);
+        v0 = (((40 - 57) == (a1[0][2] < v1)) - ((v2 * 42) * (v3 / 5)));
+    } else {
+        a0[12] = (((v0 + a0[7]) - (90 != v3)) || ((a1[1][0] % 9) ? (a0[14] % 4) : (v0 >= a1[1][6])));
+        v3 = (((v3 == v2) || (a0[2] ? v2 : a0[10])) * ((a1[0][8] <= v1) * (9 + v3)));
+        a0[1] = (((29 >= 47) < (a0[3] * v0)) && ((v0 * v1) * (v0 - 88)));
+    }
+    return (((v3 ? a0[13] : v0) < (v2 > 34)) - ((v3 ? a0[3] : v2) ? (v3 > v2) : (34 ? v2 : a1[1][3])));
+}
+int main() {
+    return 0;
+}
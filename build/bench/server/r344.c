@@ -0,0 +1,137 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 56;
+    int v2 = 19;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        a0[12] = (((i0 && 72) != (v2 <= 40)) == ((a1[1][7] / 8) || (a1[0][8] <= i0)));
+        v1 = (((20 != v3) && (54 / 3)) > ((i0 * a1[1][10]) < (v0 > v0)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v3 = (((a0[4] != i0) % 8) ? ((52 != a1[3][8]) || (v1 % 6)) : ((83 % 9) > (67 / 8)));
+            a1[3][10] = (((i1 > a1[3][8]) + (v2 == a1[1][12])) ? ((v1 + a0[5]) >= (a1[1][15] ? i1 : v0)) : ((v2 && i1) < (a0[4] <= v2)));
+            a0[10] = (((78 + a0[15]) * (a0[11] ? 84 : 38)) / 5);
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a0[1] = (((a1[2][15] + i2) >= (43 + v3)) ? ((v1 * i3) != (v2 / 9)) : ((a0[10] - a1[0][15]) || (2 - i3)));
+                    a0[15] = (((i2 * v2) * (36 != 71)) > ((v0 - 50) != (v0 >= v2)));
+                    a1[1][5] = (((27 >= v3) % 4) <= ((i2 ? a1[3][13] : 6) % 5));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((47 <= 29) >= (0 < 7)) / 8);
+            v2 = (((26 ? 79 : 20) - (v0 && 75)) * ((a0[14] && v3) || (i2 && a1[1][1])));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v1 == v2) && (a0[8] < v1)) - ((v2 == v2) && (v1 < a1[2][3])));
+    v1 = (((31 && v3) && (v1 > a1[0][5])) <= ((97 > 70) + (v2 ? v3 : 78)));
+    v2 = (((v2 >= 67) + (a1[2][6] + v0)) != ((v0 / 5) != (a0[0] <= v2)));
+    return (((a1[1][13] / 4) <= (v3 >= v0)) < ((v2 >= a1[0][8]) > (a0[10] < a1[2][3])));
+}
+int f1() {
+    int v0 = 99;
+    int v1 = 51;
+    int v2 = 61;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 - a1[3][5]) > (43 * a0[1])) && ((33 < v2) % 6));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((a1[0][12] != v2) <= (59 != v1)) <= ((v0 <= v0) > (54 != 80)));
+                a1[1][0] = (((a0[11] ? i1 : 19) * (i1 > v1)) % 3);
+                a1[2][12] = (((a0[11] % 9) && (v3 == v2)) % 4);
+            }
+            a1[0][9] = (((a0[0] && 50) - (95 < v2)) % 9);
+            v0 = (((v2 >= a1[3][15]) == (a1[0][4] + 36)) * ((v1 % 2) % 6));
+            i0 = i0 + 1;
+        }
+    }
+    a1[0][14] = (((v0 != v3) > (a0[12] + 35)) ? ((v1 * v1) == (v3 == a0[15])) : ((a1[0][6] != v2) >= (9 - v3)));
+    if ((((v2 ? 92 : v1) + (75 ? v2 : a0[2])) > ((a1[3][1] < a0[8]) * (v1 / 3)))) {
+        a0[5] = (((v3 + v1) >= (a0[4] || v2)) || ((a0[3] >= a0[15]) && (23 / 1)));
+        a0[6] = (((a0[3] >= a0[1]) * (41 + 85)) ? ((v3 < v3) > (a0[13] >= a0[15])) : ((14 || v3) == (v1 % 8)));
+        v0 = (((a1[1][4] ? v2 : v0) >= (a0[2] ? v0 : a1[0][12])) % 9);
+    } else {
+        v2 = (((a0[2] == v2) <= (10 ? a0[9] : v2)) < ((v1 + v3) + (v0 * v1)));
+        v0 = (((v2 > a1[0][13]) >= (a0[8] % 6)) ? ((a0[10] != a1[2][1]) != (66 > v0)) : ((v2 > v0) == (6 > v3)));
+        v2 = (((v1 || a1[1][13]) * (84 < v3)) < ((v1 % 3) / 2));
+    }
+    if ((((v0 != a1[0][2]) / 2) > ((34 / 2) / 2))) {
+        v1 = (((v2 / 2) && (a0[6] % 6)) == ((v1 >= 16) && (22 ? v1 : a0[3])));
+        a1[3][3] = (((v3 / 6) < (a0[0] == v1)) / 6);
+        v1 = (((v2 > a0[13]) > (v3 >= v2)) && ((a1[2][14] == 36) - (a1[2][12] < a1[2][0])));
+    } else {
+        v3 = (((a0[8] % 5) != (v3 + 25)) / 1);
+        v0 = (((v2 != 2) == (a1[2][3] || a0[13])) > ((80 <= v1) <= (a0[11] || a1[1][13])));
+        v3 = (((v0 || a1[1][8]) / 3) / 1);
+    }
+    return (((v0 % 1) % 6) - ((v0 || 80) < (80 ? v0 : v3)));
+}
+int f2() {
+    int v0 = 37;
+    int v1 = 67;
+    int v2 = 7;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((33 % 7) ? (v0 > v3) : (v1 == v2)) % 5);
+    if ((((a1[3][12] % 9) / 5) - ((92 <= v2) + (59 + v0)))) {
+        a0[4] = (((45 != v2) <= (v3 ? v1 : a1[1][2])) == ((v0 || v1) % 8));
+        v2 = (((v0 - v1) * (89 >= 27)) ? ((v2 > 34) - (24 % 2)) : ((a1[0][3] == a1[0][14]) < (26 != a1[3][6])));
+        v3 = (((v3 * 33) / 1) % 6);
+    } else {
+        a0[10] = (((v3 >= v3) * (v0 <= v3)) ? ((89 && v3) || (61 > v1)) : ((v3 < v2) == (50 % 5)));
+        a0[11] = (((a1[1][6] && v2) <= (v2 % 8)) || ((v0 && v1) + (v0 + a0[14])));
+        v0 = (((v3 || a0[2]) || (9 || a1[1][13])) * ((34 > 30) <= (18 - v1)));
+    }
+    if ((((v1 || v0) <= (v2 != 28)) >= ((v2 < a0[5]) ? (v0 * 89) : (v0 % 8)))) {
+        v0 = (((40 ? a1[1][12] : v0) < (a1[2][10] || v3)) ? ((v3 < a1[0][14]) * (a0[13] == v2)) : ((a0[13] % 6) <= (v3 > v3)));
+        a1[2][15] = (((81 * v0) != (11 + a1[2][2])) ? ((v3 * v0) <= (68 && v0)) : ((v2 / 5) / 7));
+        a1[3][13] = (((v3 ? a1[1][2] : v3) || (75 || a1[2][5])) > ((v1 / 3) > (v0 * 78)));
+    } else {
+        v1 = (((v1 ? v1 : a0[4]) + (a0[7] ? v0 : a1[2][14])) >= ((v0 < v3) ? (v3 != v1) : (v2 > a1[3][0])));
+        a0[9] = (((a1[0][1] % 1) <= (a0[5] / 6)) ? ((v0 == 94) || (v1 * a1[0][0])) : ((v3 || 56) != (a1[1][7] && 41)));
+        v3 = (((v0 ? v1 : v0) && (13 < v2)) <= ((71 ? v3 : a1[3][8]) / 4));
+    }
+    if ((((8 - 80) ? (a0[5] && a0[7]) : (v3 / 2)) / 2)) {
+        v3 = (((v1 / 7) ? (a0[13] ? 60 : 51) : (55 > v3)) < ((v0 ? v0 : v1) - (v1 || v0)));
+        a1[3][7] = (((v2 + 33) % 4) != ((57 ? 37 : a1[1][2]) ? (67 ? 48 : 29) : (76 ? a0[9] : v0)));
+        a0[7] = (((a1[3][8] + v3) <= (28 >= v0)) ? ((v1 % 4) > (a0[13] != a0[6])) : ((a1[3][14] < 21) ? (a0[13] && 42) : (v3 - v3)));
+    } else {
+        v1 = (((a1[2][15] + v0) && (v1 / 3)) != ((a1[0][4] + v3) + (20 % 5)));
+        v2 = (((47 < v0) || (54 % 7)) != ((a1[0][8] ? a1[0][8] : v1) == (a1[0][3] > 4)));
+        v2 = (((v1 - v1) - (69 < v0)) ? ((v1 < a0[5]) - (v1 + 80)) : ((a0[13] || 35) || (v1 ? v2 : v2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[3][12] = (((i0 >= 20) || (v3 == i0)) ? ((33 < a0[4]) && (29 <= i0)) : ((v0 % 4) <= (i0 >= a0[7])));
+            v3 = (((v0 <= v3) > (v3 % 9)) % 2);
+            {
+                int i1 = 0;
+                do {
+                    a1[0][13] = (((v0 ? i0 : 33) != (i0 >= a0[9])) % 4);
+                    v1 = (((49 - a0[14]) ? (a0[0] % 2) : (a0[10] / 6)) ? ((v2 - i1) || (18 * v0)) : ((a0[9] ? a1[3][12] : v2) / 7));
+                    a0[8] = (((v1 / 5) && (i1 ? v0 : 14)) * ((83 ? v1 : 52) - (a0[3] > v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    return (((v1 != v1) <= (91 ? v3 : v2)) < ((a1[2][2] / 6) < (v3 > v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,63 @@
+int f0() {
+    int v0 = 68;
+    int v1 = 67;
+    int v2 = 69;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v3 = (((a0[15] * v3) == (v2 + a0[5])) == ((a0[8] * a0[11]) == (a1[2][0] < a0[11])));
+            a0[0] = (((28 * v3) > (a0[10] / 6)) > ((a0[2] + a0[8]) || (i0 ? v2 : v3)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v0 >= a0[14]) > 67) break;
+                    v3 = (((v1 == 75) && (40 * v1)) ? ((v2 ? 44 : v3) < (v2 > v2)) : ((a0[14] % 4) == (a0[9] != 95)));
+                    v3 = (((a1[3][0] - 27) <= (v0 - a0[14])) > ((a1[3][4] / 5) % 1));
+                    a0[5] = (((v1 < v0) < (i1 / 7)) == ((v3 != a1[2][2]) >= (v2 / 5)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v0 = (((a0[1] && a0[7]) / 9) >= ((a1[0][6] || 28) - (v3 < 5)));
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                if ((a1[0][5] ? 63 : i3) > 59) break;
+                v3 = (((v3 >= 3) < (v3 ? v2 : v1)) || ((i3 > a1[0][0]) && (v3 ? 64 : v3)));
+                a1[2][12] = (((a1[3][3] ? a0[13] : a0[5]) <= (i2 > 93)) <= ((74 % 6) <= (a1[3][3] <= a0[9])));
+                v2 = (((v1 ? i2 : i3) * (v3 - 2)) > ((v3 - a0[4]) * (a1[1][14] ? i3 : 60)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((51 == 67) < (i2 * v3)) + ((v2 > v2) ? (a0[2] / 8) : (i2 || 21)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v1 = (((v3 >= a1[2][3]) != (44 - v1)) * ((22 - v1) ? (a1[1][12] <= i4) : (v0 / 8)));
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v3 = (((v3 + i4) ? (44 <= v3) : (v3 && a1[2][4])) % 5);
+            v1 = (((v2 || i5) ? (v2 - 13) : (v1 / 7)) == ((v3 >= v3) < (a1[1][1] * 77)));
+            v1 = (((80 + v3) || (a0[12] <= 35)) + ((a0[13] == 55) * (v0 || 41)));
+        }
+        v0 = (((v1 > v2) <= (14 || a1[3][11])) || ((a1[0][12] * v1) || (a0[8] <= a1[3][15])));
+    }
+    if ((((v2 < a1[3][4]) - (a0[4] <= v0)) && ((v1 && v3) - (a0[0] * v1)))) {
+        v1 = (((v0 <= v1) ? (a0[1] ? 5 : v0) : (v2 != a1[2][8])) <= ((65 == v0) ? (v1 != v2) : (v1 * a1[3][7])));
+        v1 = (((98 ? v3 : v1) / 8) ? ((48 > v2) && (v1 < 38)) : ((v3 >= a1[0][7]) >= (v0 >= a1[3][3])));
+        a1[2][11] = (((v2 / 5) * (43 >= 34)) > ((v0 - v0) || (v0 + v3)));
+    } else {
+        v0 = (((17 % 7) == (62 > v2)) && ((v0 == 30) && (65 || v1)));
+        v1 = (((14 / 9) * (v3 <= v3)) - ((a0[11] ? 96 : 43) > (v2 ? v1 : v0)));
+        v2 = (((v2 - v1) + (6 / 8)) ? ((v1 && v2) - (v2 != v3)) : ((4 ? a0[13] : a1[2][2]) <= (10 < v0)));
+    }
+    a0[13] = (((a1[2][9] * v3) + (a1[3][7] ? a1[3][5] : v1)) + ((v2 && 58) >= (v1 - v0)));
+    return (((v1 > a1[3][9]) >= (v2 % 8)) || ((v1 < v1) % 5));
+}
+int main() {
+    return 0;
+}
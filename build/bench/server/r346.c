@@ -0,0 +1,109 @@
+int f0() {
+    int v0 = 29;
+    int v1 = 8;
+    int v2 = 16;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 ? i0 : a0[14]) * (i0 < 76)) / 2);
+            a1[0][2] = (((55 != i0) == (i0 < a1[1][8])) * ((26 < v1) / 3));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v0 = (((v0 >= v3) < (i0 != a1[3][10])) != ((21 >= a0[11]) > (a1[2][1] < v2)));
+                    v3 = (((37 ? v0 : 24) / 7) == ((26 >= a1[3][9]) != (0 <= v1)));
+                    v1 = (((v0 && v2) || (i1 - 87)) > ((83 * a0[14]) + (63 || i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    a0[10] = (((v1 + a1[1][6]) != (v2 < 44)) || ((a0[14] + a0[2]) >= (86 != v0)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v3 != a0[5]) > 82) break;
+        {
+            int i3 = 0;
+            do {
+                v0 = (((i2 != a0[8]) < (v0 == a1[2][5])) >= ((v1 % 7) / 5));
+                a0[0] = (((v2 ? a1[0][6] : 84) % 6) < ((v0 <= v0) == (v3 > v2)));
+                a1[3][11] = (((41 - 52) <= (i3 && v0)) ? ((v1 <= a0[2]) + (82 % 8)) : ((a1[3][6] ? 67 : v2) + (87 % 9)));
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+        v0 = (((58 * i2) % 4) == ((90 / 9) > (a1[3][9] % 8)));
+        a1[0][9] = (((v2 >= a0[1]) >= (a0[5] && v2)) - ((a1[3][3] || v0) || (v0 != a1[3][3])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((v0 % 7) > 51) break;
+            v1 = (((32 || a1[0][5]) >= (v3 ? i4 : v0)) == ((a1[3][8] * v2) || (a0[13] < a1[1][0])));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((a1[2][12] ? 61 : v3) ? (a1[0][2] != 0) : (88 <= v3)) - ((73 ? a0[9] : a1[0][10]) ? (a0[14] > 48) : (a0[0] != i4)));
+                    v1 = (((a0[5] ? i5 : 42) && (a1[3][6] >= a0[15])) > ((v1 < i4) - (13 ? i5 : a0[13])));
+                    a0[3] = (((74 < v1) - (v1 > i5)) > ((69 - a0[13]) > (55 <= v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v1 = (((a1[3][5] || v2) ? (64 && a0[15]) : (71 || a1[3][8])) && ((v1 && a1[2][4]) && (a1[2][1] >= i4)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 < 13) ? (a0[4] < v1) : (v3 > v3)) < ((v0 != a0[15]) == (a0[0] && v1)))) {
+        v3 = (((v1 || a0[0]) > (v1 || v0)) - ((a0[11] % 3) >= (v0 - 53)));
+        a0[2] = (((64 + v3) - (80 <= a0[15])) >= ((v2 < v1) / 8));
+        a0[9] = (((a1[2][0] && v2) == (2 == v3)) || ((a1[1][9] * v3) % 1));
+    } else {
+        v1 = (((v3 - v1) / 1) > ((a1[0][2] != 24) % 2));
+        v1 = (((v1 - v1) ? (v2 && v0) : (a0[10] % 2)) ? ((44 && v1) == (a0[15] < 2)) : ((v1 || v0) < (a1[1][7] - v1)));
+        v1 = (((v1 - 83) && (v0 > a0[9])) - ((v1 || 51) || (0 + a1[1][0])));
+    }
+    return (((v3 == v3) > (v1 * a1[2][15])) <= ((5 < a0[11]) % 2));
+}
+int f1() {
+    int v0 = 21;
+    int v1 = 65;
+    int v2 = 64;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[6] || a1[1][5]) - (v3 || 16)) > ((v3 <= 44) ? (v2 % 7) : (4 - v0)));
+    if ((((v3 >= 40) / 3) - ((91 > a1[2][14]) - (v1 % 9)))) {
+        v0 = (((a1[0][8] == v3) - (v0 + 41)) + ((v3 * 11) ? (v1 + v0) : (a1[0][7] % 7)));
+        v1 = (((9 > 35) + (59 >= a0[12])) == ((v0 && a1[2][4]) <= (4 * v1)));
+        v2 = (((a1[0][11] < v2) >= (v3 <= v3)) && ((v1 || v0) >= (24 < v0)));
+    } else {
+        v0 = (((v2 + v0) < (a1[0][4] > v1)) || ((a1[1][2] / 1) - (v0 && v3)));
+        v3 = (((v2 % 7) && (a0[3] / 2)) && ((57 || v0) / 4));
+        a1[1][10] = (((v3 != a0[3]) && (v2 ? 4 : v0)) ? ((v1 < a0[3]) == (15 - a0[15])) : ((v0 > a0[5]) != (a0[7] == v2)));
+    }
+    a0[8] = (((v1 - a0[1]) && (v3 + v1)) * ((v1 ? a1[2][15] : a0[15]) < (92 && 47)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v3 ? v1 : v0) + (v3 * 71)) || ((v3 > i0) ? (a0[2] < v3) : (a0[8] > v2)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((70 - v3) ? (a0[11] || i0) : (a1[2][1] != 93)) * ((v2 > i1) >= (40 > 25)));
+                    a1[1][2] = (((v2 == i0) < (i0 < a1[3][15])) || ((28 * a0[7]) != (v3 ? i0 : 61)));
+                    v3 = (((v0 >= a0[4]) == (66 && v2)) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            a1[1][3] = (((a1[0][6] ? 70 : v0) / 2) * ((v0 < a0[6]) ? (a1[2][12] ? v0 : 7) : (a1[1][3] == i0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v3 = (((a0[13] ? v1 : 22) && (v3 < v1)) * ((v1 <= v2) < (a1[1][1] + a0[6])));
+    return (((a0[13] ? 86 : 54) > (a0[1] % 2)) ? ((a1[2][11] != v2) * (v3 != 18)) : ((12 == v3) >= (5 > v0)));
+}
+int main() {
+    return 0;
+}
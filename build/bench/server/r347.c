@@ -0,0 +1,242 @@
+int f0() {
+    int v0 = 47;
+    int v1 = 72;
+    int v2 = 29;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 % 9) ? (a1[2][1] * v1) : (v2 - v3)) - ((v0 ? 23 : 48) > (v1 * v2)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v2 == 90) <= (v2 / 1)) < ((v2 < i0) * (68 != v2)));
+            a1[0][5] = (((v2 >= v3) != (v0 ? v0 : a0[9])) < ((a1[3][14] + v3) == (64 != v1)));
+            {
+                int i1 = 0;
+                do {
+                    if ((i0 && a1[2][15]) > 79) break;
+                    v0 = (((a0[2] <= 17) == (a0[13] * 16)) + ((a1[1][8] ? 67 : v3) <= (a0[8] <= v2)));
+                    v1 = (((v1 / 5) + (i0 || a0[2])) % 5);
+                    v0 = (((v1 >= v1) ? (57 != v0) : (34 / 1)) / 8);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v0 == 89) * (v0 <= 96)) && ((v1 <= 52) && (a0[6] >= 17)));
+            v0 = (((v0 && v3) + (v1 / 6)) * ((a0[13] / 3) && (v0 != v3)));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    a0[8] = (((i2 - a1[1][10]) == (a0[12] + v1)) > ((87 == i2) && (17 == 46)));
+                    v1 = (((a0[2] >= a0[9]) || (a0[0] || 9)) == ((30 % 7) <= (41 - v3)));
+                    a1[3][3] = (((79 || i2) < (a1[0][3] * v1)) == ((a1[3][11] != v1) >= (i2 <= v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v3 >= 81) % 7) || ((v2 == 17) <= (61 - 10)));
+                    a0[13] = (((v3 > i4) || (i4 && 40)) / 8);
+                    v3 = (((80 < v2) && (73 - v0)) <= ((a1[2][5] == 8) ? (v2 + v1) : (a1[2][8] < a1[1][13])));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v2 = (((a0[13] ? v2 : 3) && (85 > a0[4])) && ((v0 > v3) / 5));
+            a1[3][14] = (((a1[3][9] >= 1) < (94 != v2)) / 7);
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[4] = (((a0[12] + a0[12]) - (v3 ? a1[0][0] : v0)) || ((a1[3][11] % 2) >= (v0 > i6)));
+            a1[0][15] = (((v2 && v0) < (v3 ? i6 : v3)) < ((v3 / 7) / 3));
+            {
+                int i7 = 0;
+                while (i7 < 7) {
+                    v2 = (((i7 || 54) * (v0 + v2)) + ((a0[14] - v3) < (76 ? a0[6] : i6)));
+                    v0 = (((a1[2][9] + v0) || (a1[1][2] + i7)) || ((v0 / 2) % 8));
+                    v3 = (((a0[3] ? v2 : a1[0][11]) == (i7 > i7)) > ((a1[3][12] != 34) && (v3 == v0)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((v0 - a0[3]) / 6) / 5);
+}
+int f1() {
+    int v0 = 3;
+    int v1 = 49;
+    int v2 = 58;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v1 && a1[3][5]) * (v2 > v2)) < ((59 || i0) < (v3 % 2)));
+            v1 = (((v2 && 97) >= (v0 >= a0[2])) <= ((a0[11] != a0[4]) < (v2 || i0)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v1 = (((a0[13] % 1) && (86 + v3)) - ((a0[3] + v2) % 1));
+                a1[3][13] = (((44 <= i1) >= (76 == 23)) % 5);
+                v3 = (((v1 * a0[8]) - (v2 != i1)) ? ((i0 && v2) == (a0[4] * v2)) : ((a0[8] ? 58 : v1) - (v3 == a0[15])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((v2 < 8) * (v2 > a1[2][5])) * ((a0[0] % 9) && (v2 <= v3)))) {
+        a1[3][2] = (((v0 > v3) == (a0[14] ? a0[15] : 30)) - ((v0 || a0[11]) + (v1 * a0[3])));
+        v1 = (((45 / 1) >= (a1[0][0] == v3)) && ((a0[12] < v1) < (v0 % 7)));
+        v2 = (((v2 < v1) % 4) < ((v0 * v2) >= (47 >= v3)));
+    } else {
+        v1 = (((v2 || v0) ? (80 || a0[11]) : (v2 > 59)) && ((v0 != v3) != (v1 <= v0)));
+        v1 = (((7 + v3) < (a1[1][5] || v0)) == ((a1[0][2] == 3) - (26 + 62)));
+        v2 = (((v1 * 23) >= (v3 || a1[2][6])) <= ((a0[9] && a1[0][3]) != (v2 && 95)));
+    }
+    v1 = (((a0[11] != a1[0][6]) <= (38 || a1[0][15])) > ((54 ? 12 : a0[7]) / 1));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v3 = (((i3 % 1) ? (i3 > v2) : (v3 - 61)) > ((i2 > a0[13]) * (a0[1] - 49)));
+                    a0[6] = (((a0[3] <= 67) ? (v1 + a0[2]) : (i2 >= a1[0][6])) != ((a0[1] || v3) == (v3 > a1[1][2])));
+                    a0[11] = (((i3 <= v3) <= (32 + v0)) || ((58 < i3) != (v2 > 37)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((20 < 18) - (v2 < v2)) ? ((a0[15] < v2) || (6 ? v2 : a0[11])) : ((v0 <= i2) + (i2 <= 76)));
+            a1[0][3] = (((v1 + v2) >= (83 > v1)) ? ((62 >= v2) >= (a0[14] == 35)) : ((3 > a1[0][15]) % 9));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((v2 ? 62 : i4) * (92 % 5)) + ((85 && 14) + (v1 - a1[2][2])));
+                    v0 = (((v1 * i5) * (85 ? v3 : v0)) < ((a1[0][11] % 4) == (i4 && i4)));
+                    v3 = (((i5 != a1[2][15]) != (a0[15] - v0)) >= ((a0[14] ? i4 : i5) != (v2 || 0)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v2 >= v0) * (a0[4] < 97)) ? ((26 < a0[15]) / 2) : ((64 > i4) > (a0[8] - 40)));
+            a0[0] = (((v0 + v1) - (v1 ? v3 : v2)) ? ((a0[7] && v1) * (a0[0] * 23)) : ((v3 >= i4) > (51 ? v3 : 63)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((a1[1][14] || v1) - (v2 != 79)) - ((v1 / 1) != (v3 == 39)));
+}
+int f2() {
+    int v0 = 54;
+    int v1 = 5;
+    int v2 = 2;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((i1 != 42) * (v1 ? i1 : v1)) && ((v0 ? v3 : v1) < (22 + v0)));
+                    a1[0][0] = (((a0[12] == 80) || (a1[3][3] - i1)) ? ((12 % 8) != (i0 != 43)) : ((v3 + v2) ? (17 * a1[2][0]) : (a0[5] <= v2)));
+                    v2 = (((v2 ? 7 : v3) || (62 / 4)) == ((i0 * v0) * (a0[4] * i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v2 = (((a0[11] / 8) && (v1 * 22)) * ((a0[10] != v3) < (13 && v3)));
+            v3 = (((v0 < a0[3]) == (v0 * v1)) >= ((15 <= v2) && (v1 * a1[3][14])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((9 ? 20 : a1[1][10]) / 2) > ((78 >= v3) && (a1[1][9] * v3)));
+                    v3 = (((v3 || v0) * (i2 * v3)) && ((18 * 69) * (2 / 1)));
+                    a0[14] = (((99 && a0[9]) == (i3 != v2)) / 3);
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v0 = (((67 == v1) % 1) > ((v3 != v2) - (i2 % 6)));
+            v0 = (((a0[13] % 3) && (v1 < a1[3][5])) * ((66 != 72) == (i2 < 13)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((9 > v2) > 91) break;
+            v3 = (((87 / 4) <= (a1[0][10] * 76)) != ((86 <= i4) ? (i4 || v1) : (v3 < 11)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((a0[12] <= 51) > 89) break;
+                    v1 = (((i4 + i5) || (39 == v0)) ? ((40 + a0[2]) / 5) : ((41 >= v3) % 9));
+                    a1[2][9] = (((93 - v0) < (v0 != v2)) % 1);
+                    a0[7] = (((8 + 60) == (v1 * v3)) != ((a0[9] / 8) ? (75 ? v0 : v0) : (i5 < v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v3 && a0[6]) <= (v2 >= v2)) + ((a0[5] == 27) ? (v2 && 98) : (27 <= 61)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v0 = (((a1[3][6] > v2) / 9) || ((a1[3][12] == a1[3][10]) + (a1[3][3] <= a1[2][7])));
+            v3 = (((25 > v2) == (v0 < v2)) + ((56 - 19) < (i6 / 8)));
+            {
+                int i7 = 0;
+                do {
+                    if ((a1[2][10] == i7) > 92) break;
+                    v2 = (((v3 > v2) % 7) - ((v0 * 80) == (v0 < a1[3][15])));
+                    v1 = (((51 <= v1) > (v1 >= a1[0][13])) || ((a0[9] >= v0) && (v1 && a0[5])));
+                    a1[2][14] = (((i7 || a1[2][5]) ? (v2 || 75) : (i6 == v2)) >= ((v1 - 56) % 2));
+                    i7 = i7 + 1;
+                } while (i7 < 2);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            if ((45 ? v2 : 24) > 72) break;
+            v0 = (((v3 != 88) || (79 % 7)) / 4);
+            for (int i9 = 0; i9 < 6; i9 = i9 + 1) {
+                v2 = (((a0[15] && i9) || (32 ? a0[2] : 25)) == ((v0 || 66) != (v1 < a0[5])));
+                v1 = (((a1[3][15] > i9) && (a1[2][13] < v0)) ? ((a1[0][0] + 59) % 6) : ((v2 / 9) && (a1[0][0] >= v0)));
+                a0[0] = (((a0[5] - a0[6]) > (53 / 6)) && ((i9 <= v3) * (v3 && a0[2])));
+            }
+            a0[13] = (((i8 == a1[3][10]) >= (a1[2][10] ? v1 : 32)) != ((v2 ? a0[14] : v2) ? (v3 * 99) : (v0 <= a0[3])));
+            i8 = i8 + 1;
+        }
+    }
+    return (((a0[3] && v2) > (a1[1][12] * a1[3][13])) == ((v1 >= v1) > (v1 == a0[14])));
+}
+int main() {
+    return 0;
+}
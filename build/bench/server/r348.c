@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 25;
+    int v1 = 83;
+    int v2 = 86;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    a0[0] = (((a0[2] != v1) % 3) == ((87 <= a1[0][12]) && (v2 == a1[0][12])));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a0[1] = (((27 == 72) >= (v0 || v3)) >= ((i0 || 33) + (61 <= a0[13])));
+        v1 = (((v2 % 8) && (69 || 58)) > ((v3 <= a0[11]) / 4));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v2 = (((a0[0] || v2) ? (v2 || 43) : (57 != a0[7])) || ((a1[1][14] && v1) % 5));
+                v1 = (((9 || v3) - (46 + a0[5])) ? ((a1[2][4] != i0) ? (v3 > a0[3]) : (v0 && i1)) : ((85 && v1) - (94 != a1[1][13])));
+                v3 = (((v1 > v1) <= (i1 == i1)) <= ((v2 ? a1[3][3] : i0) || (a0[7] <= 97)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    if ((((a0[14] < 91) * (v0 < v1)) < ((v2 != a1[2][0]) < (10 > v2)))) {
+        v3 = (((a0[12] > v2) <= (a1[2][2] || 87)) ? ((v0 || v0) || (69 % 2)) : ((8 * v1) && (v0 - 83)));
+        v0 = (((v2 - a1[3][4]) >= (v2 / 2)) && ((19 >= v1) ? (80 / 3) : (v2 != 62)));
+        a0[7] = (((v3 >= a1[1][1]) || (v0 != v1)) != ((a1[0][3] ? v3 : v0) % 5));
+    } else {
+        v0 = (((49 == v2) != (v2 - v1)) >= ((v1 <= a1[2][3]) <= (57 < v2)));
+        v2 = (((57 - v2) ? (v3 % 5) : (64 / 7)) ? ((a0[9] / 6) < (v1 ? v1 : 11)) : ((v1 && 15) > (v0 >= v2)));
+        a1[2][14] = (((v0 >= a0[14]) * (a0[12] - 74)) > ((47 < v0) * (v2 >= v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v3 != 33) && (v2 && 78)) / 7);
+            v1 = (((98 ? 28 : v3) >= (8 * 76)) + ((v2 % 6) + (v2 < 84)));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    v1 = (((a1[2][3] - a1[1][7]) + (38 != 72)) ? ((v2 + v0) ? (51 - 43) : (i3 - v3)) : ((a1[1][6] / 9) <= (i3 && v3)));
+                    a1[1][6] = (((i2 + 69) && (i3 <= v0)) > ((v1 && a1[2][12]) ? (v2 > v1) : (i2 ? v3 : a0[13])));
+                    v1 = (((v3 <= v1) - (v2 && 72)) * ((i2 == a1[2][8]) < (a1[0][9] - v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            {
+                int i5 = 0;
+                do {
+                    if ((v1 >= 88) > 97) break;
+                    v1 = (((v3 <= v2) || (a1[3][2] && v2)) ? ((a1[2][6] >= a0[1]) / 6) : ((77 * i4) < (v3 ? v2 : v1)));
+                    v2 = (((v2 ? v3 : v2) != (v1 * v1)) - ((v1 ? v3 : 67) >= (v3 + 20)));
+                    v1 = (((v1 <= a1[1][0]) ? (a0[0] > a1[1][4]) : (a1[3][5] || a1[2][8])) == ((a1[1][12] - i4) ? (a1[0][5] != i5) : (i4 ? v2 : i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v1 = (((v2 / 5) % 5) % 2);
+            v3 = (((v0 > v0) != (v1 + v2)) != ((v1 / 3) / 1));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 < 77) >= (66 < a1[1][15])) || ((v1 ? a0[12] : a1[2][1]) % 7));
+}
+int main() {
+    return 0;
+}
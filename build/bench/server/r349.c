@@ -0,0 +1,120 @@
+int f0() {
+    int v0 = 71;
+    int v1 = 30;
+    int v2 = 6;
+    int v3 = 98;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((52 && 46) > 52) break;
+        a1[3][7] = (((i0 && a1[1][11]) > (75 <= a0[1])) > ((v1 <= v3) == (a1[3][8] * v3)));
+        {
+            int i1 = 0;
+            do {
+                if ((v2 ? 11 : a0[2]) > 99) break;
+                v3 = (((i1 <= 95) || (i0 * 29)) < ((v3 + v0) < (a1[0][6] / 2)));
+                a0[12] = (((v3 / 4) * (v3 / 3)) ? ((i1 == i0) - (v3 <= v3)) : ((v0 ? v0 : a0[7]) != (89 > 8)));
+                v2 = (((a1[2][14] > 0) > (v2 * i1)) >= ((9 * i0) >= (98 != v1)));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v0 = (((53 >= 28) < (v2 + i0)) > ((v1 > v1) >= (82 >= v1)));
+    }
+    if ((((12 && 29) != (v1 % 9)) >= ((v3 % 8) && (56 > v3)))) {
+        v0 = (((v2 / 7) <= (a0[7] == v2)) > ((a0[14] / 9) - (48 || v3)));
+        v3 = (((a0[2] && v1) * (a1[0][1] >= v1)) <= ((v1 >= v0) % 8));
+        v1 = (((66 >= v1) <= (94 - v1)) <= ((a0[9] > 88) != (v1 > v0)));
+    } else {
+        v3 = (((v1 != v3) / 4) < ((v0 || v1) % 6));
+        a1[0][13] = (((v1 == v1) <= (v0 ? v3 : a0[1])) == ((22 ? a1[3][8] : v2) - (v2 * 49)));
+        v3 = (((a1[0][2] % 5) * (v0 - a0[13])) != ((v2 ? v2 : a0[1]) + (v3 && v2)));
+    }
+    if ((((v1 * 52) >= (v0 || v0)) ? ((13 == a1[3][1]) * (35 >= a0[9])) : ((v3 > a0[7]) != (v2 && a1[2][1])))) {
+        v2 = (((v2 == v0) >= (v3 > 9)) || ((v2 * a1[0][6]) <= (a0[15] || 57)));
+        v0 = (((30 && 17) == (65 && v1)) * ((a1[3][14] / 6) % 5));
+        a1[1][0] = (((v1 < a0[3]) || (a1[0][8] || v0)) != ((v2 - v3) >= (v1 + 99)));
+    } else {
+        a0[14] = (((a0[15] >= 52) + (v1 == a1[3][1])) * ((a0[7] || v2) == (v3 != v1)));
+        a1[2][13] = (((60 == a1[2][15]) * (a1[2][9] / 1)) ? ((v1 < 54) || (a1[2][4] / 3)) : ((a1[0][13] > v0) + (a0[10] + 41)));
+        v2 = (((v3 ? a1[2][0] : a0[4]) + (47 ? a0[2] : 83)) % 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 % 7) > 64) break;
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((a0[7] != a0[13]) && (v0 == v2)) && ((25 >= a0[6]) != (a0[11] - 25)));
+                    v1 = (((i2 && 62) != (20 / 6)) ? ((1 <= a0[10]) + (37 % 8)) : ((i3 <= v3) >= (i3 >= i3)));
+                    a0[5] = (((v1 <= 30) > (75 % 5)) && ((v1 * i2) - (v2 || 39)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v2 = (((v2 / 2) - (a1[0][10] == v0)) >= ((a0[8] <= v1) > (a1[0][14] ? 59 : v0)));
+            v2 = (((v0 == a1[0][4]) || (a0[7] - i2)) <= ((v3 < v1) ? (v1 - v2) : (v0 && 41)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v1 = (((a1[0][15] != 1) / 5) - ((61 ? v2 : a1[3][5]) < (v1 >= v2)));
+    return (((v0 ? a0[1] : 42) - (v1 + 73)) && ((v0 <= a1[2][1]) ? (v0 * 7) : (v3 / 8)));
+}
+int f1() {
+    int v0 = 97;
+    int v1 = 43;
+    int v2 = 99;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                if ((45 || 53) > 98) break;
+                v0 = (((73 ? 51 : a1[1][6]) == (14 <= v3)) && ((72 ? a1[1][14] : a1[3][11]) == (i1 == i0)));
+                v1 = (((a0[3] == a1[3][4]) || (v3 - 71)) > ((a0[9] % 7) < (v2 - a1[1][5])));
+                v3 = (((v3 * v3) * (i0 % 5)) ? ((66 <= i0) + (74 >= i1)) : ((v2 != 77) * (40 <= v1)));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((v0 / 5) > (v2 < i0)) >= ((29 > 55) * (v3 || 59)));
+        a0[3] = (((v1 < i0) + (83 ? 50 : i0)) + ((i0 / 8) && (a1[0][2] || a1[2][14])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v2 = (((v2 / 9) == (v3 % 7)) % 8);
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((v3 ? i2 : v3) >= (v2 > v0)) < ((74 + v3) >= (69 && a0[12])));
+                a1[1][2] = (((50 != a1[1][14]) < (a1[1][5] >= v1)) % 2);
+                v0 = (((21 < 65) % 5) ? ((a1[3][8] >= v2) == (46 < 48)) : ((v0 ? 47 : a1[3][15]) - (a0[3] || v1)));
+            }
+            a0[6] = (((a0[13] / 5) - (i2 == v1)) ? ((17 * 66) >= (1 % 8)) : ((99 * 1) <= (v3 % 7)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((a0[11] - v2) > 60) break;
+                    v1 = (((v3 ? a1[1][2] : v3) - (i5 != v0)) == ((75 ? v2 : v1) > (91 > a0[10])));
+                    v3 = (((70 || a1[1][8]) - (97 && a1[0][11])) / 3);
+                    v2 = (((a0[5] > 12) < (v2 || a1[1][11])) || ((v1 ? 15 : v1) <= (i5 % 4)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][3] = (((v0 % 2) > (v2 || a0[10])) - ((a0[14] ? 92 : a1[1][13]) - (a1[1][13] >= i4)));
+            v2 = (((v3 / 9) > (63 + i4)) > ((i4 && v3) > (90 * i4)));
+            i4 = i4 + 1;
+        }
+    }
+    a0[14] = (((92 && v0) >= (v3 > v0)) <= ((v2 || v0) <= (v3 + v3)));
+    v0 = (((v0 ? 51 : a1[1][4]) / 8) % 9);
+    return (((a1[3][4] <= a0[14]) / 4) ? ((v2 != 16) >= (a1[3][11] <= 76)) : ((v2 == v1) ? (v1 ? a1[1][14] : v2) : (a0[10] <= v1)));
+}
+int main() {
+    return 0;
+}
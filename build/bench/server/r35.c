@@ -0,0 +1,168 @@
+int f0() {
+    int v0 = 65;
+    int v1 = 26;
+    int v2 = 74;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((v2 <= 7) > 65) break;
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((36 - i1) < (a0[13] <= a1[0][6])) >= ((75 * a1[1][0]) % 9));
+                    a0[1] = (((79 <= 82) ? (a1[2][4] && v2) : (i0 + i1)) <= ((14 != v1) ? (a0[15] - v2) : (v0 ? i0 : v3)));
+                    v1 = (((v0 ? 69 : 10) / 1) && ((25 >= 16) >= (92 > i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a0[15] = (((v0 * a0[5]) / 8) <= ((46 * 12) / 6));
+            a1[3][11] = (((a0[8] - v2) * (i0 >= v2)) % 9);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((61 == v3) > (v1 ? v2 : a1[1][13])) == ((43 > v1) - (a1[2][8] && a0[7])))) {
+        v1 = (((v3 % 2) - (a1[2][7] ? 74 : 44)) * ((v1 / 2) && (a0[12] == v2)));
+        v3 = (((0 >= a1[2][1]) ? (a0[13] ? a1[0][5] : v3) : (a1[0][0] ? a0[12] : a1[3][15])) + ((a0[9] == v2) <= (v0 < a0[12])));
+        v2 = (((a0[2] ? a1[3][11] : 49) >= (65 % 4)) > ((v0 == a1[3][12]) > (v3 != a0[5])));
+    } else {
+        a1[2][13] = (((v3 / 5) || (v1 >= a1[2][5])) - ((v1 - a1[1][8]) <= (a1[2][0] ? 51 : v3)));
+        v3 = (((v0 ? a1[2][1] : 43) * (a1[0][12] ? 98 : v0)) ? ((v0 != a1[2][5]) >= (10 * v1)) : ((a1[2][14] ? a1[3][12] : v3) && (v1 < a0[5])));
+        v3 = (((48 - v3) != (83 / 1)) && ((v2 ? a1[0][15] : a1[2][7]) != (v3 || v2)));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((v0 + a1[0][7]) > 55) break;
+        a1[0][6] = (((v3 * v1) + (v2 % 7)) - ((62 + a0[3]) / 2));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v2 = (((a1[3][2] ? v0 : i3) <= (i2 ? 34 : a1[2][1])) && ((a0[0] ? v1 : a0[6]) == (a1[2][15] / 8)));
+                a1[1][14] = (((92 % 2) * (v0 == v2)) && ((v2 >= v1) / 2));
+                v2 = (((i2 < 99) ? (v2 && v3) : (30 > a0[12])) == ((a1[0][5] == v1) && (v3 / 7)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[12] = (((a1[0][12] == i2) ? (v2 == 3) : (v3 == i2)) % 4);
+    }
+    v0 = (((v3 ? v0 : a1[2][1]) / 6) < ((77 / 1) % 6));
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v1 = (((v0 - a1[0][6]) && (a1[2][13] % 8)) != ((a0[3] - a0[6]) + (42 < a0[4])));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    a1[0][13] = (((i4 >= v0) || (66 && v3)) || ((42 >= 13) < (77 ? 58 : 50)));
+                    a0[14] = (((90 || i5) > (v3 || 45)) == ((68 % 4) + (30 / 4)));
+                    a0[0] = (((60 <= v2) <= (v3 % 1)) > ((i4 < i4) <= (i4 && a1[0][11])));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((i4 && v2) * (63 <= 48)) + ((6 > a1[3][2]) - (a1[1][15] * i4)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((45 / 7) <= (78 > v2)) && ((62 != v2) - (v0 < v1)));
+}
+int f1() {
+    int v0 = 70;
+    int v1 = 97;
+    int v2 = 83;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v0 = (((a1[2][12] == a1[2][8]) > (a1[0][12] % 7)) ? ((54 ? a1[3][5] : v2) - (a1[3][12] ? v2 : i0)) : ((76 <= 77) == (56 || i0)));
+            a1[2][6] = (((34 / 6) && (50 ? v2 : a0[7])) * ((v3 % 7) - (a1[2][1] % 1)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((a0[14] ? v1 : i1) + (v0 || a0[2])) || ((i1 > 52) >= (a1[1][3] || 72)));
+                v0 = (((v1 > v2) - (v0 || 82)) + ((41 - a0[0]) && (17 % 3)));
+                a1[1][9] = (((i1 * v2) >= (28 != 65)) > ((i1 * a1[1][9]) <= (i1 != i0)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 == v2) && (v1 % 3)) < ((a0[4] && v3) < (v2 * a1[1][7])))) {
+        v0 = (((v2 >= 6) == (v0 == v3)) * ((v2 <= v1) <= (92 / 7)));
+        a0[14] = (((87 > v3) > (a1[0][7] / 6)) - ((v2 * 12) ? (v1 <= v1) : (v0 * a0[4])));
+        v2 = (((a0[13] * 97) < (90 && a1[3][11])) / 9);
+    } else {
+        v3 = (((v2 % 8) >= (a1[2][2] - a1[1][4])) ? ((v1 * v3) / 7) : ((a1[3][5] ? v2 : v1) == (a0[7] == a1[2][1])));
+        v0 = (((6 < 9) >= (v2 > 50)) >= ((v1 * v3) <= (a1[3][5] != 40)));
+        v3 = (((a0[2] + v1) ? (a0[4] % 9) : (v3 || v0)) % 2);
+    }
+    if ((((6 + v0) ? (v2 % 6) : (v0 ? v2 : v1)) - ((a1[0][5] % 4) <= (v2 ? v0 : v1)))) {
+        v2 = (((a1[0][6] < 45) - (a0[12] >= 85)) ? ((v3 ? v3 : a0[7]) < (a1[3][7] || 9)) : ((69 + 53) ? (50 * 47) : (3 && v1)));
+        a0[1] = (((43 || a1[2][6]) / 8) * ((v0 * v2) > (v3 + v2)));
+        v2 = (((3 || v2) - (74 < a1[1][15])) == ((v3 % 3) != (v1 ? 41 : v2)));
+    } else {
+        v3 = (((a0[7] > a1[3][9]) - (83 % 8)) > ((a1[1][5] || a1[0][4]) * (a1[3][0] && a1[2][14])));
+        v2 = (((a0[3] && v1) && (30 && v3)) || ((v2 <= 23) || (v0 > a1[1][14])));
+        v2 = (((63 - v3) * (69 == 81)) % 3);
+    }
+    v1 = (((v0 % 6) > (v0 / 1)) % 2);
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v3 = (((a0[8] != a0[15]) && (48 / 4)) && ((a1[1][3] ? v3 : a0[4]) < (v2 % 6)));
+        v3 = (((v0 > i2) != (v1 ? a1[0][7] : a1[1][12])) || ((i2 - 25) == (a1[0][2] % 6)));
+        {
+            int i3 = 0;
+            do {
+                if ((i3 <= a0[10]) > 81) break;
+                v2 = (((a0[10] == 7) || (a1[0][4] >= a0[5])) <= ((i2 > a0[15]) >= (40 && 4)));
+                v0 = (((66 >= v1) < (a1[3][5] ? v1 : i3)) / 5);
+                a0[0] = (((v1 && 85) <= (a1[1][0] ? i2 : a1[0][5])) - ((i3 ? a0[1] : v3) ? (a0[7] != v1) : (v3 >= v1)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    return (((v1 / 9) != (96 <= v1)) || ((a1[0][4] / 4) && (v0 - v0)));
+}
+int f2() {
+    int v0 = 72;
+    int v1 = 4;
+    int v2 = 8;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v2 = (((i0 * v2) > (i0 > a1[3][5])) - ((i0 >= v0) || (v0 + v2)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v2 = (((a0[8] % 4) <= (v3 != i1)) >= ((a1[3][13] != i1) % 5));
+            v2 = (((19 + v1) + (i1 <= v2)) >= ((i1 * v3) && (a1[1][13] == i0)));
+            a1[2][14] = (((i0 ? v1 : i1) > (v3 * v1)) % 2);
+        }
+        v2 = (((v2 || a0[7]) >= (v2 >= v3)) ? ((v1 + v0) <= (a1[1][15] % 8)) : ((v1 || a1[3][14]) < (v0 ? v0 : v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((i2 || 98) * (v0 / 7)) % 9);
+            a1[0][7] = (((v0 - v2) / 3) - ((i2 * v2) || (v1 && a1[1][1])));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((79 > 27) - (a0[11] <= i2)) || ((a0[6] * v2) || (82 ? 25 : 65)));
+                    a0[13] = (((i3 != 52) ? (i2 != i2) : (v2 && v2)) < ((99 > v2) < (12 == v1)));
+                    a0[9] = (((v0 / 8) ? (i2 > v1) : (a1[0][13] && v3)) / 9);
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    v3 = (((v0 > v1) <= (v3 <= a0[4])) || ((v1 - 55) <= (92 < 73)));
+    v3 = (((v2 <= v3) != (a0[15] <= v1)) % 5);
+    v3 = (((a1[1][12] - v1) && (v1 ? v3 : 20)) ? ((a0[14] == a0[9]) < (v2 && a1[1][1])) : ((v1 * 33) || (22 + v1)));
+    return (((v2 < v2) - (a1[3][14] * v2)) / 4);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,165 @@
+int f0() {
+    int v0 = 14;
+    int v1 = 18;
+    int v2 = 26;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[4] ? v3 : v1) != (a1[2][10] >= 60)) && ((v1 ? 29 : a1[0][7]) ? (46 ? 85 : v0) : (a1[2][9] < 79)))) {
+        v2 = (((v3 == v3) < (42 % 1)) + ((a0[4] != v2) > (a1[2][11] < 18)));
+        v2 = (((a0[8] > 23) ? (a0[14] + v0) : (29 - 90)) != ((v1 - v2) > (v0 == a0[9])));
+        a0[11] = (((a1[1][0] / 1) * (52 - v0)) ? ((v0 - 83) ? (v0 > 50) : (30 <= 64)) : ((v3 && a1[0][5]) && (16 && 11)));
+    } else {
+        v1 = (((a1[1][4] * v3) / 1) * ((44 >= 4) == (85 && v1)));
+        v3 = (((v3 % 4) || (v0 == v3)) ? ((a1[2][7] != v3) != (v0 <= v3)) : ((a0[10] >= a0[13]) <= (26 || v0)));
+        v0 = (((v2 < 46) ? (v1 < v3) : (11 + 1)) == ((v1 ? v0 : a1[2][12]) % 7));
+    }
+    if ((((a0[3] / 3) / 7) / 4)) {
+        v3 = (((69 * v1) / 6) == ((10 <= a1[3][8]) && (v1 - 44)));
+        v1 = (((v0 <= v1) ? (a1[2][6] < v2) : (99 * v2)) + ((a0[11] == 73) > (v0 && v2)));
+        a1[3][2] = (((v3 < 22) != (20 * v1)) > ((a0[7] <= 54) || (a1[3][15] ? a1[3][2] : 88)));
+    } else {
+        a0[10] = (((v0 >= a1[3][4]) + (43 + v3)) == ((v3 || a0[10]) > (42 != 58)));
+        a0[12] = (((a1[0][8] - v1) || (a0[4] && a1[1][12])) && ((v0 >= 82) + (v3 / 7)));
+        v2 = (((v2 ? v3 : 7) || (v3 + 89)) > ((v2 || v0) >= (64 < v1)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v3 = (((a0[14] <= i0) >= (v0 >= 43)) && ((66 < 15) - (a1[3][0] * a0[12])));
+        v3 = (((v2 == a0[3]) ? (a0[2] == i0) : (a0[0] > v2)) * ((21 < 92) * (i0 == 8)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                if ((v2 % 3) > 91) break;
+                a0[9] = (((v0 > 65) * (48 || v0)) >= ((v0 <= v2) ? (v1 && v2) : (a0[0] ? 12 : v3)));
+                v1 = (((a1[2][9] + a0[3]) * (a1[2][11] > v2)) == ((i0 != v1) != (a1[3][2] ? v1 : 16)));
+                a0[15] = (((a1[1][0] % 6) != (2 || a1[1][3])) * ((v3 || 81) <= (v0 <= v2)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    if ((((v3 != v3) <= (a1[2][5] % 3)) / 3)) {
+        v1 = (((a0[15] && a0[13]) * (a1[1][6] >= v1)) || ((v2 != a1[2][4]) ? (29 != v0) : (v2 == a1[0][0])));
+        v1 = (((a1[3][3] < 23) ? (a1[3][15] <= 97) : (v2 < v3)) != ((a0[11] < a0[14]) - (v0 >= 36)));
+        v3 = (((v1 * 13) > (v3 ? v2 : a0[6])) != ((31 <= v3) % 4));
+    } else {
+        v0 = (((21 + a0[15]) / 3) + ((37 / 5) % 3));
+        a1[0][10] = (((a1[2][4] / 4) % 2) == ((v0 + v1) <= (v0 ? a0[5] : v0)));
+        a0[15] = (((62 * v0) / 8) && ((v3 && v3) || (63 > v2)));
+    }
+    if ((((v0 - 87) <= (v2 && a0[6])) || ((v3 <= 85) <= (42 > a1[3][9])))) {
+        a1[0][3] = (((v2 - 18) >= (v2 - v0)) * ((v1 / 2) - (a1[2][6] ? v3 : 20)));
+        v2 = (((v1 && v1) / 9) ? ((v0 <= 74) > (1 && v0)) : ((v1 ? 31 : 99) * (v1 ? v1 : a0[8])));
+        a0[6] = (((v1 % 5) != (95 >= 56)) && ((67 < v2) <= (v0 == v1)));
+    } else {
+        a0[9] = (((v3 || v3) <= (v3 ? 72 : v2)) == ((v1 / 9) >= (v2 > a1[2][15])));
+        v2 = (((v0 % 3) && (a1[3][13] <= v3)) > ((v0 || v2) * (v0 && v3)));
+        a0[7] = (((v3 + v3) ? (v0 + v1) : (v0 || 41)) || ((v3 ? 39 : 92) ? (a1[1][8] % 3) : (a1[0][14] != v3)));
+    }
+    return (((v1 || 79) < (a0[15] == v0)) / 5);
+}
+int f1() {
+    int v0 = 31;
+    int v1 = 65;
+    int v2 = 94;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((52 * v3) * (a0[4] != 85)) != ((v1 >= v0) >= (v2 ? 69 : a0[14])));
+    {
+        int i0 = 0;
+        do {
+            if ((v3 ? i0 : v2) > 97) break;
+            v3 = (((v3 == v2) == (v2 % 2)) * ((63 ? 8 : a1[2][10]) - (a0[10] < v2)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((v0 > a0[7]) ? (a0[10] >= a1[1][1]) : (32 <= 96)) * ((4 || 32) * (95 && a0[11])));
+                v0 = (((a1[2][13] + v3) || (a0[0] <= a0[15])) && ((i1 / 2) + (a0[7] ? v2 : v1)));
+                a1[3][1] = (((a1[0][6] >= v0) == (i0 < i0)) + ((58 == v0) ? (a1[3][1] && a0[11]) : (v2 == 88)));
+            }
+            v1 = (((a1[1][10] % 4) || (a0[4] <= a0[3])) <= ((a0[7] > a1[0][9]) > (i0 == 45)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((54 <= a1[0][13]) == (v2 * a1[2][7])) < ((v1 ? a1[0][9] : i2) % 4));
+            v2 = (((30 + v2) >= (v1 >= 99)) ? ((v3 >= a1[1][6]) * (v1 ? v1 : v3)) : ((v1 < a0[12]) && (v0 <= i2)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v2 = (((i3 - 37) && (a0[2] >= v1)) * ((a0[14] || v0) % 9));
+                a1[1][15] = (((a1[1][0] && a0[7]) ? (v1 <= v1) : (7 != 36)) < ((v1 != a1[3][10]) || (i3 ? 57 : 11)));
+                v2 = (((v0 - v2) == (i2 || 26)) ? ((13 < a1[2][11]) < (v1 || v3)) : ((v0 || i3) - (v1 || a0[5])));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v2 <= 83) && (v3 >= a0[6])) > ((71 >= a1[3][4]) == (a0[14] <= 65)))) {
+        a1[3][4] = (((v3 >= 97) == (v0 || v2)) != ((45 * v0) * (v3 ? a1[1][10] : 82)));
+        v1 = (((v0 && a1[1][10]) == (a1[1][4] * v1)) - ((40 - v0) != (v1 && v3)));
+        v1 = (((a1[0][9] % 7) / 2) - ((48 >= a0[11]) * (a1[2][11] + 19)));
+    } else {
+        a0[13] = (((v0 + a0[5]) >= (61 >= 63)) - ((v2 / 1) + (a1[2][7] * 55)));
+        v0 = (((35 == v1) || (a0[15] && a0[1])) > ((v2 ? v0 : v0) == (a0[12] < v0)));
+        v2 = (((v3 < a0[15]) < (a0[6] || v2)) == ((v1 && a0[7]) != (v3 ? v1 : v1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v1 = (((a0[8] / 4) - (a1[3][12] >= v2)) && ((76 < 65) - (v0 >= a0[2])));
+                a1[1][9] = (((a0[1] + v0) < (a1[0][11] != a0[13])) < ((v0 / 5) ? (a1[1][3] == a1[3][8]) : (v1 != a1[3][1])));
+                a0[4] = (((v2 && v2) != (a0[6] != a0[10])) + ((53 % 3) == (v2 % 5)));
+            }
+            a1[3][12] = (((a1[1][6] <= v0) + (i4 != v2)) / 9);
+            a0[1] = (((71 % 2) % 3) >= ((v1 == 72) * (v2 / 2)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((a0[12] > 54) > (v1 == v1)) < ((a0[2] <= v3) > (a1[2][9] <= a1[2][7])));
+}
+int f2() {
+    int v0 = 26;
+    int v1 = 43;
+    int v2 = 24;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    a1[2][9] = (((v3 > v2) % 7) && ((a0[12] < 2) + (a1[0][9] > 27)));
+    v2 = (((v0 ? v1 : v1) ? (v3 ? a0[8] : 50) : (v3 <= a1[2][5])) + ((v1 <= v0) > (22 <= a0[6])));
+    {
+        int i0 = 0;
+        do {
+            a1[2][2] = (((a0[0] > i0) % 6) <= ((a0[8] ? i0 : v3) < (a0[13] ? 23 : v2)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v2 == a0[11]) > (5 >= v2)) || ((i0 ? i0 : 44) <= (a0[4] || a0[5])));
+                    a1[3][8] = (((i0 % 3) * (v0 % 9)) ? ((78 < a0[10]) ? (i1 <= v1) : (i1 <= 58)) : ((65 && a1[3][3]) == (i1 > a0[13])));
+                    v3 = (((v3 ? 13 : 90) ? (v0 - v3) : (62 ? a1[1][6] : v2)) && ((i0 == i1) ? (v1 % 2) : (i1 && 6)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v3 = (((96 + 87) ? (a0[4] && a0[5]) : (9 && v1)) - ((a0[15] || 22) == (i0 ? a1[1][13] : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    a1[1][13] = (((v2 >= v0) < (v1 ? v0 : v3)) > ((v1 >= 52) % 6));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((a0[9] || v3) > 84) break;
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                if ((50 != v2) > 50) break;
+                v2 = (((48 / 2) <= (i3 != v0)) ? ((51 <= v0) + (i3 != 3)) : ((i3 + v0) != (93 * v2)));
+                v2 = (((v0 && 93) <= (i3 * 2)) && ((v1 < a0[10]) ? (i3 == 85) : (a1[2][3] >= 8)));
+                a0[5] = (((v0 + v2) < (a1[0][15] / 4)) >= ((84 != 67) < (a1[0][1] <= v1)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[12] = (((76 == i2) ? (i2 < 24) : (46 ? v0 : i2)) ? ((v3 / 2) != (v0 / 4)) : ((a0[10] % 7) < (27 || v1)));
+        v3 = (((a1[0][8] == v0) >= (a1[2][9] - v2)) * ((v1 < v0) > (v3 - 0)));
+    }
+    return (((a1[1][13] == a1[1][2]) > (96 && 66)) != ((v1 + v3) < (78 || 73)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,25 @@
+int f0() {
+    int v0 = 50;
+    int v1 = 86;
+    int v2 = 86;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v1 || a1[0][10]) < (12 - v1)) > ((a0[14] != a1[1][14]) - (v0 ? v0 : a1[2][13])));
+    v2 = (((v3 % 5) ? (47 ? 95 : a0[13]) : (a0[12] - 4)) + ((v2 && v1) < (v0 <= a1[1][11])));
+    if ((((v3 >= 47) % 6) - ((22 + a1[2][13]) || (v3 >= a1[0][0])))) {
+        v2 = (((a0[9] && 46) <= (v2 % 7)) % 9);
+        v0 = (((v0 + v3) ? (v1 / 7) : (v0 % 3)) != ((a0[9] + a1[1][0]) ? (v3 ? v1 : v1) : (a0[14] > a1[1][6])));
+        v1 = (((a1[3][10] ? v0 : v3) ? (a1[1][8] < 59) : (a1[0][4] - 13)) <= ((v1 >= v0) ? (a1[3][5] && v0) : (v3 * v1)));
+    } else {
+        v1 = (((29 * v1) / 7) == ((67 && v3) ? (v0 % 9) : (a1[1][5] != a1[1][3])));
+        v3 = (((v3 ? 41 : 38) ? (v2 == v2) : (v2 <= a0[10])) <= ((a0[4] * v3) || (v3 ? v1 : v0)));
+        a1[0][15] = (((42 ? a0[5] : v1) <= (88 % 6)) / 3);
+    }
+    v3 = (((39 == v2) % 1) == ((v2 > 93) <= (14 % 1)));
+    v0 = (((v0 + 31) / 3) ? ((v2 == v2) % 6) : ((v1 < a0[7]) % 3));
+    return (((a0[15] ? v0 : a1[1][4]) < (v2 / 2)) - ((v0 / 1) + (98 || v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,115 @@
+int f0() {
+    int v0 = 41;
+    int v1 = 10;
+    int v2 = 31;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v1 = (((9 && v1) || (88 + v1)) != ((67 == v1) ? (v0 || i0) : (i0 + a0[0])));
+            a0[12] = (((v0 && v0) % 7) && ((v1 == v2) + (44 == v2)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v3 = (((v3 % 4) > (98 * 6)) <= ((v1 && i0) && (1 != a0[14])));
+                    v1 = (((v2 * a0[2]) + (a1[0][8] || i0)) != ((v1 >= v1) != (a0[7] - v3)));
+                    v2 = (((v1 <= v0) < (v3 * i0)) || ((v2 ? v1 : i1) ? (a0[7] / 9) : (v0 < v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v2 = (((41 ? v2 : v2) == (1 ? a0[5] : v0)) < ((a0[15] + v1) + (v2 ? 30 : i3)));
+                v1 = (((a1[1][1] >= v0) && (84 >= 3)) < ((a0[12] % 8) == (a0[1] ? v0 : a0[10])));
+                a1[1][7] = (((a0[2] / 2) % 7) == ((a1[2][9] && v3) / 1));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v1 = (((79 - 83) < (v1 * i2)) ? ((v2 * 31) ? (15 && v3) : (i2 + v2)) : ((i2 - v0) + (v3 - 17)));
+        a0[1] = (((a0[4] - v3) > (32 * a1[3][15])) > ((v0 && a0[12]) == (70 < 66)));
+    }
+    v3 = (((v0 - v2) <= (v2 && 76)) <= ((a0[11] % 1) / 9));
+    a1[2][1] = (((a0[9] < a1[2][1]) ? (v1 == v0) : (v2 < v3)) % 9);
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v2 = (((i4 ? i4 : i5) ? (a0[13] <= v3) : (v3 != v2)) <= ((i4 == 57) > (v1 || 73)));
+                    v1 = (((v0 + v0) > (v0 >= a1[2][3])) && ((i4 > v1) ? (v2 % 5) : (v3 > 31)));
+                    v3 = (((i5 % 4) != (v3 > 64)) >= ((v2 > v2) || (a1[0][6] != v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((a0[14] / 2) != (v0 - 93)) - ((32 > 17) < (a0[4] / 6)));
+            v1 = (((a0[7] ? 8 : a0[3]) + (i4 % 3)) != ((53 || a1[1][15]) != (36 && 33)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 <= v3) || (v2 >= 83)) ? ((v1 != v1) - (47 || 54)) : ((v2 ? v0 : v2) || (v0 + v2)));
+}
+int f1() {
+    int v0 = 36;
+    int v1 = 2;
+    int v2 = 37;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[2] < v0) * (v3 == 29)) || ((v0 / 4) != (28 ? a0[8] : 42)))) {
+        v2 = (((a0[15] * v3) - (a1[1][5] <= a1[0][1])) && ((a0[11] + 22) / 7));
+        a0[9] = (((v2 * v0) ? (v0 + v1) : (28 == v1)) % 2);
+        a0[9] = (((60 || 73) || (a1[2][2] ? v1 : 28)) != ((a0[7] >= 75) >= (59 != v1)));
+    } else {
+        v1 = (((a1[0][4] <= 27) * (v3 >= a0[11])) - ((74 <= v3) ? (v2 * a1[1][4]) : (a1[1][9] ? 27 : 35)));
+        v1 = (((v2 <= v1) || (a0[14] > 16)) >= ((v0 || a1[1][10]) - (55 / 3)));
+        v1 = (((a0[4] ? v1 : v1) > (a0[11] * a1[0][13])) ? ((a1[1][3] < v2) >= (v2 - v1)) : ((v3 ? v3 : a1[3][3]) >= (v0 ? a0[6] : a0[3])));
+    }
+    if ((((76 + 56) || (a1[1][14] && 38)) - ((v3 >= v2) * (v1 < v0)))) {
+        a1[3][14] = (((51 % 7) + (v1 <= v3)) ? ((a1[3][3] < 78) != (a1[0][12] * v3)) : ((a1[2][3] != 11) * (v0 * 25)));
+        v1 = (((v0 > v0) / 7) && ((v3 ? v2 : v1) && (v3 || a1[3][11])));
+        v1 = (((v1 ? v3 : a0[9]) >= (a1[3][12] ? 53 : v0)) ? ((v2 <= v1) <= (v2 >= v1)) : ((v3 >= v1) * (a1[2][4] || v2)));
+    } else {
+        a0[11] = (((v0 > a0[14]) || (v0 || a0[9])) || ((v1 != a0[4]) / 4));
+        v3 = (((v3 <= v0) * (v2 == v3)) <= ((a1[2][13] - v1) <= (65 <= v0)));
+        v2 = (((25 >= 41) ? (a1[1][10] / 8) : (a0[5] ? 88 : v1)) ? ((a1[0][2] > a1[2][4]) <= (v2 >= a1[3][1])) : ((v2 * a1[3][15]) && (v2 && v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v1 = (((v1 >= a0[14]) < (69 <= a1[3][15])) && ((v0 <= v3) <= (v3 >= v1)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v1 = (((v3 != v2) ? (1 ? v3 : i0) : (52 || a1[3][11])) || ((12 <= v0) - (53 - 9)));
+                v1 = (((a0[4] ? i1 : v2) > (42 - a1[0][0])) + ((i1 >= i1) <= (92 < v0)));
+                a1[3][5] = (((49 - 97) > (a1[0][13] > 30)) ? ((20 ? a0[6] : v1) * (16 - a1[2][6])) : ((a0[10] > a1[2][2]) != (a0[2] && a0[12])));
+            }
+            v2 = (((a1[2][3] || v3) < (a0[1] && v0)) - ((36 >= v2) <= (v0 * v3)));
+            i0 = i0 + 1;
+        }
+    }
+    a1[1][10] = (((v0 * a0[2]) <= (v0 > 8)) % 4);
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v1 = (((88 == a1[1][12]) || (93 == 43)) && ((v1 == v0) > (v3 >= a1[1][12])));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v0 = (((a0[11] < 33) || (i2 || 96)) ? ((i2 || v0) <= (4 != 3)) : ((31 ? i2 : 78) || (i3 ? a1[3][11] : 37)));
+                a0[0] = (((41 ? a1[1][7] : 23) != (95 != v0)) ? ((15 <= 16) % 2) : ((i3 != i3) != (a1[1][12] >= v2)));
+                a1[0][9] = (((i2 / 2) >= (a1[0][3] > i3)) % 3);
+            }
+            v2 = (((8 < a1[3][11]) ? (a0[6] ? v2 : v1) : (a1[0][5] + a1[0][10])) >= ((i2 + a1[2][3]) - (a0[12] < 56)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v1 ? a0[0] : a1[2][2]) ? (86 ? a0[3] : v0) : (v3 && v1)) ? ((17 || a1[3][0]) || (v3 % 9)) : ((65 % 2) && (a1[2][8] >= v2)));
+}
+int main() {
+    return 0;
+}
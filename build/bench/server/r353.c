@@ -0,0 +1,186 @@
+int f0() {
+    int v0 = 33;
+    int v1 = 32;
+    int v2 = 90;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[1][0] = (((v1 * v1) == (v1 + a0[14])) != ((i0 > v3) - (v1 - v3)));
+            v3 = (((v0 > a0[2]) % 9) + ((v3 && v2) == (i0 ? v2 : a1[2][7])));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v1 = (((45 == i0) / 5) != ((47 >= 27) + (v1 <= v1)));
+                    a0[10] = (((i0 <= 8) >= (v3 ? 65 : v3)) || ((i0 + a1[0][6]) && (97 > 92)));
+                    v3 = (((34 <= a0[5]) - (v1 / 1)) + ((v0 % 5) || (86 * a0[11])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v0 = (((v2 != 9) ? (v1 ? 33 : v3) : (21 != v1)) >= ((v2 || a0[15]) - (13 && v2)));
+    v1 = (((v2 > v1) == (v0 ? 31 : 7)) || ((v1 % 2) / 3));
+    {
+        int i2 = 0;
+        do {
+            if ((v1 ? a1[0][15] : v2) > 71) break;
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((v1 > v0) > 54) break;
+                v1 = (((a0[11] != v3) == (29 == v1)) >= ((a0[14] + a0[3]) != (v3 == a1[2][8])));
+                a0[4] = (((v1 ? 71 : v0) ? (a0[11] ? v1 : a1[2][5]) : (81 <= v0)) && ((i2 > v2) / 6));
+                v1 = (((v0 >= a0[7]) > (v2 > 54)) == ((a1[1][6] || a1[1][11]) <= (v2 ? v0 : 78)));
+            }
+            v2 = (((a1[0][15] % 5) > (i2 || v0)) || ((v0 % 3) >= (a0[15] ? v2 : v3)));
+            a0[8] = (((v0 ? v0 : 96) == (v1 < i2)) && ((a0[1] <= 54) > (60 % 2)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v2 <= 28) + (v2 && a0[10])) + ((18 || v2) / 7))) {
+        v2 = (((54 * v0) < (0 <= 4)) != ((88 != 49) == (v2 != v0)));
+        v0 = (((a0[13] >= a1[0][10]) >= (v1 == v1)) > ((a1[2][7] || v1) <= (a1[2][1] == 18)));
+        a1[2][7] = (((v3 == 81) || (v1 != v0)) * ((a0[1] ? a0[8] : a1[0][11]) > (v2 * v2)));
+    } else {
+        v3 = (((v0 ? v1 : v2) ? (a1[2][3] ? v3 : 42) : (v2 < a1[1][7])) || ((v1 - v1) != (60 == v2)));
+        a0[12] = (((v3 / 6) * (v1 >= v3)) < ((v0 > 68) >= (a0[4] - a1[1][1])));
+        v3 = (((14 || 42) - (62 || a0[13])) % 6);
+    }
+    return (((89 == v1) * (v1 ? 27 : v2)) ? ((v0 ? a0[3] : v3) % 8) : ((v1 % 5) / 2));
+}
+int f1() {
+    int v0 = 44;
+    int v1 = 63;
+    int v2 = 72;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a0[1] <= v1) >= (75 + v2)) > ((v1 >= a1[3][2]) * (v1 >= i0)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((a0[2] + a0[12]) || (v3 != v3)) * ((v1 >= 75) ? (70 * v0) : (a1[2][7] < a1[3][2])));
+                v2 = (((a0[11] ? a1[3][2] : 0) + (a0[3] > 52)) > ((i1 - v0) ? (i1 / 1) : (v0 < v1)));
+                a0[8] = (((v1 + v3) * (v1 >= a0[11])) ? ((v2 * a1[1][1]) > (a0[12] >= 97)) : ((v1 >= i0) > (i1 || i0)));
+            }
+            a0[1] = (((v1 % 1) / 4) <= ((25 >= 78) ? (v1 + a1[2][11]) : (34 >= 46)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((55 + v3) >= (14 - 78)) % 9)) {
+        v1 = (((v2 == a1[1][6]) ? (94 * v1) : (v3 + v2)) != ((a1[2][13] ? 48 : v3) == (v0 ? v0 : 70)));
+        a0[9] = (((v2 / 6) ? (v1 % 8) : (v3 || a1[1][7])) - ((v2 || v2) || (v2 + v1)));
+        v1 = (((91 != v1) && (a1[2][2] || a1[2][3])) + ((64 < a1[2][4]) % 9));
+    } else {
+        v2 = (((a1[1][8] - v0) <= (73 / 7)) == ((89 % 5) == (2 && v3)));
+        v1 = (((v0 % 7) % 9) % 4);
+        v2 = (((a1[0][9] ? 53 : 54) && (84 / 3)) + ((a1[0][0] * v3) * (34 % 5)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                if ((v1 == 95) > 88) break;
+                v1 = (((20 < v0) ? (i2 ? v3 : a1[0][0]) : (v0 >= v0)) && ((i2 == i2) > (v2 / 5)));
+                v3 = (((v0 < 30) > (a1[1][1] <= a0[15])) < ((71 <= v2) * (v3 < i2)));
+                a0[8] = (((i3 || i2) - (9 + 11)) / 9);
+            }
+            v1 = (((v2 < i2) >= (a1[3][12] > v0)) != ((a1[2][13] ? v2 : v2) > (a0[5] < 64)));
+            a0[3] = (((i2 == v0) < (62 || v0)) % 4);
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((50 <= v1) > 74) break;
+            v1 = (((i4 + a1[0][7]) <= (18 % 6)) ? ((a0[8] - 36) - (98 / 8)) : ((i4 > i4) != (v3 == v1)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((49 && v1) ? (47 < a0[6]) : (i5 ? v2 : a1[1][0])) != ((v1 ? 67 : v0) < (v0 * i4)));
+                    a0[7] = (((v1 < 84) ? (v0 > 29) : (50 && v3)) >= ((v2 % 9) < (i4 <= v1)));
+                    a0[10] = (((v3 % 8) < (v2 == a1[0][3])) != ((i5 - v0) && (i4 || v1)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v1 = (((v2 >= v0) == (v3 ? v0 : v3)) - ((a0[12] > 11) - (v2 > v0)));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        v2 = (((79 % 5) - (a0[3] ? a0[9] : v3)) || ((v1 + v0) - (58 >= v2)));
+        {
+            int i7 = 0;
+            while (i7 < 3) {
+                if ((51 && v0) > 52) break;
+                a0[13] = (((i7 - a1[3][12]) ? (i7 * i6) : (a0[8] != 33)) % 7);
+                a0[14] = (((v0 <= 9) <= (a1[0][3] ? a1[1][11] : v3)) ? ((v1 || a0[10]) != (v0 > 80)) : ((v1 == i6) + (9 || 20)));
+                v2 = (((i7 ? v1 : a1[3][0]) > (39 == v3)) / 8);
+                i7 = i7 + 1;
+            }
+        }
+        v1 = (((0 >= a0[1]) >= (v1 % 6)) * ((a0[12] / 8) == (v3 > v1)));
+    }
+    return (((v1 * v3) > (a0[7] / 1)) / 4);
+}
+int f2() {
+    int v0 = 27;
+    int v1 = 48;
+    int v2 = 37;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((a1[3][13] * i1) - (v1 != 27)) ? ((a1[0][4] % 3) && (a1[0][10] ? v0 : i1)) : ((a0[5] || v2) >= (v0 / 1)));
+                    v0 = (((a0[6] + v3) % 8) * ((i0 != v0) % 4));
+                    v1 = (((i1 % 5) > (76 >= 35)) % 5);
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v0 >= a1[2][13]) ? (v2 > i0) : (a1[2][13] < v1)) * ((v0 <= 52) % 6));
+            v2 = (((a1[2][15] / 1) % 9) / 9);
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[1] == a0[2]) == (v1 != a0[6])) % 5)) {
+        v2 = (((a0[2] >= v2) == (1 > v1)) % 9);
+        v2 = (((53 <= v3) / 3) && ((v0 <= v2) && (58 || 74)));
+        v3 = (((40 > v1) && (v2 >= a0[12])) ? ((v2 ? 10 : a0[8]) * (a1[0][12] ? a1[0][10] : a1[1][0])) : ((a0[10] - 35) <= (v1 == v2)));
+    } else {
+        v3 = (((v3 && a0[6]) <= (50 && v2)) < ((37 > a0[7]) >= (v1 ? v1 : v3)));
+        a1[2][14] = (((v0 <= 88) * (v0 || v3)) > ((v0 + 32) ? (v2 && v2) : (v0 || v0)));
+        a0[9] = (((v0 == a1[0][0]) || (v0 ? v1 : v2)) <= ((v0 ? v0 : 35) || (a0[13] || v1)));
+    }
+    if ((((52 <= v1) + (v0 + v2)) || ((v3 && v3) % 9))) {
+        v1 = (((a0[12] ? v0 : v3) % 6) != ((a1[3][2] ? v3 : v0) || (v3 * v3)));
+        v3 = (((24 > v0) ? (v1 || v2) : (a1[3][15] <= a1[1][10])) > ((39 != a0[6]) / 8));
+        v0 = (((v0 % 1) / 4) >= ((v2 < 86) ? (20 && a0[8]) : (v1 > 7)));
+    } else {
+        v0 = (((v2 != v1) >= (v2 * a0[2])) + ((a0[8] / 1) ? (v1 > v2) : (a0[3] % 4)));
+        v0 = (((v3 ? v2 : v1) != (v3 <= 57)) * ((a1[3][2] || a0[8]) ? (a0[4] > 51) : (v2 % 3)));
+        a1[3][11] = (((35 + v3) ? (v1 == a0[10]) : (a1[1][15] > 79)) == ((50 || v0) - (72 - a1[3][0])));
+    }
+    if ((((7 % 1) > (v2 - v3)) ? ((v1 <= 94) >= (75 >= a1[2][7])) : ((94 % 1) < (a1[2][10] % 9)))) {
+        v2 = (((v3 != a1[3][11]) == (v2 + a0[11])) >= ((v1 != v1) / 3));
+        v3 = (((a1[0][6] <= 27) ? (23 + a1[0][13]) : (a0[2] && v3)) || ((a1[3][7] - v3) >= (23 + 11)));
+        v2 = (((v0 < v0) * (a1[0][1] ? v3 : v3)) == ((v3 || a0[11]) + (a1[2][2] % 2)));
+    } else {
+        a0[6] = (((v2 >= a1[3][0]) / 3) != ((39 < a1[1][6]) % 2));
+        v1 = (((57 <= v3) % 3) ? ((v1 != 45) / 8) : ((58 >= a0[10]) + (v1 < a0[12])));
+        v3 = (((a1[2][7] - a0[13]) / 8) != ((35 ? a1[1][14] : a0[6]) && (v2 % 7)));
+    }
+    v3 = (((39 || v2) <= (v3 != v1)) % 9);
+    return (((v2 / 3) == (a1[1][9] ? a0[6] : v3)) + ((a0[3] == a0[3]) != (v1 - v2)));
+}
+int main() {
+    return 0;
+}
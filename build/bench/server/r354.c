@@ -0,0 +1,78 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 38;
+    int v2 = 34;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 < a1[2][13]) - (a0[1] / 6)) % 8);
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v2 = (((i0 * v3) > (87 / 3)) <= ((78 == 25) ? (a0[7] * a0[3]) : (v0 || a0[13])));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a1[2][8] * 71) == (v1 || a0[7])) || ((63 ? a0[1] : a0[4]) > (a1[2][11] + 81)));
+                    a0[5] = (((v2 ? 86 : v2) * (i0 <= a0[6])) == ((a0[8] == i0) >= (a0[4] <= a0[9])));
+                    v1 = (((v2 && v1) >= (v3 < i1)) || ((v1 ? a1[2][3] : v2) * (i1 || v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v0 = (((a0[6] == v2) < (63 < 99)) == ((17 || 59) - (64 || a1[3][9])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            a1[0][8] = (((v0 >= v0) - (a1[1][11] + a1[2][3])) >= ((a0[14] <= v1) && (31 >= v3)));
+            a0[7] = (((a0[12] - a0[15]) && (v2 >= 4)) <= ((v0 == a1[0][7]) && (a0[5] || v0)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v0 % 2) < (i3 % 4)) ? ((a1[2][4] < v2) ? (v0 * 19) : (i2 >= 32)) : ((65 <= v3) <= (v1 * a0[3])));
+                    v2 = (((79 <= 7) / 3) >= ((31 >= i2) % 3));
+                    a0[4] = (((v0 ? v0 : v2) == (17 / 5)) ? ((i2 != a0[7]) && (v0 == v0)) : ((91 != 73) == (i3 && i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            a0[7] = (((v3 / 5) % 7) > ((66 / 7) && (8 - 48)));
+            v0 = (((v3 != a0[5]) % 3) ? ((12 <= 76) >= (a1[0][3] - a0[14])) : ((67 - 14) != (v1 * v0)));
+            {
+                int i5 = 0;
+                do {
+                    a1[3][7] = (((v1 > i4) > (v0 + a0[9])) + ((v3 < v3) ? (i5 == 63) : (i5 > i5)));
+                    v2 = (((v1 * v3) != (i4 % 7)) ? ((v1 * v1) * (a1[3][1] <= v2)) : ((i5 < v2) < (a0[8] > 80)));
+                    a0[5] = (((v3 || 60) && (a1[1][13] ? i4 : v3)) < ((8 % 5) <= (v2 % 4)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v1 - v1) > 77) break;
+            v3 = (((a0[5] >= a1[1][0]) / 5) != ((a1[1][15] >= a1[2][7]) * (v0 / 3)));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v0 = (((45 != i7) ? (31 % 2) : (77 >= 57)) <= ((i6 < v2) >= (v0 > 26)));
+                v1 = (((a1[0][9] || v0) <= (v1 == i6)) < ((a0[2] && v1) == (i6 > v1)));
+                v3 = (((83 * v0) ? (a0[8] != 67) : (v1 / 6)) + ((v2 >= a1[2][10]) >= (90 < a1[3][5])));
+            }
+            a1[0][6] = (((a1[3][1] >= v2) - (i6 && 66)) <= ((i6 < i6) || (i6 ? v2 : v1)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    return (((v0 ? v3 : 36) <= (v2 ? a1[1][14] : 61)) * ((v0 && v1) && (v2 * v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,137 @@
+int f0() {
+    int v0 = 79;
+    int v1 = 4;
+    int v2 = 4;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a1[0][12] = (((a0[10] && i0) * (v2 || v0)) || ((a1[2][3] || 68) <= (v3 / 3)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((a0[1] > a1[2][4]) > 87) break;
+                v0 = (((a1[3][10] != 76) <= (a0[5] || v1)) == ((a1[1][14] > v3) / 1));
+                a0[10] = (((a1[0][4] ? v1 : 53) - (9 ? a1[3][11] : 66)) < ((i1 / 2) || (a1[3][12] || 43)));
+                a1[2][6] = (((a0[6] && a1[2][11]) * (33 < a0[0])) == ((v1 == v1) >= (v1 >= v0)));
+            }
+            a1[0][15] = (((a1[0][11] > a1[0][14]) - (a0[6] >= a0[9])) * ((90 % 8) * (i0 / 4)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[12] ? v0 : v2) * (v2 % 3)) - ((a0[14] && 13) - (a0[1] == v1)))) {
+        v2 = (((a1[3][14] < v2) / 8) < ((a1[2][12] != v3) > (v3 * a0[5])));
+        a0[14] = (((v2 == 87) < (a0[15] * 98)) > ((25 || a0[9]) || (v0 == v1)));
+        v3 = (((a0[9] / 1) || (a0[10] == v3)) < ((a0[0] / 1) / 2));
+    } else {
+        v2 = (((v3 != 70) - (v0 ? v0 : 9)) != ((v0 != v0) >= (v3 ? v2 : v1)));
+        a0[11] = (((89 + v3) % 5) == ((a0[14] && a1[1][6]) != (28 - a0[2])));
+        a1[0][7] = (((v3 < v0) == (v2 ? v2 : 80)) >= ((a1[3][4] != v2) <= (v0 > 8)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[3][4] = (((13 / 9) == (i2 / 3)) < ((a1[1][4] <= v0) >= (10 ? 11 : 45)));
+            {
+                int i3 = 0;
+                do {
+                    a0[9] = (((v1 + v3) < (v2 && i2)) + ((i2 != 96) / 3));
+                    v0 = (((52 ? i3 : 30) && (a1[0][15] || a0[12])) != ((1 ? v1 : i2) ? (v0 + i3) : (i2 < v0)));
+                    a1[0][3] = (((i3 + v0) + (v1 * v3)) / 4);
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            a0[12] = (((v3 < i2) < (65 % 5)) % 9);
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((a0[4] + v0) % 6) < ((v2 <= v3) > (v2 > 24)))) {
+        a1[3][11] = (((v2 >= v3) % 2) ? ((a0[15] >= a1[1][3]) ? (a1[1][13] >= a1[3][7]) : (a0[13] < v0)) : ((a1[2][9] % 7) + (v0 != v0)));
+        v3 = (((v3 && v0) * (77 == v3)) && ((a1[2][4] + 27) && (56 * a1[0][3])));
+        v1 = (((27 / 9) % 8) ? ((25 != a1[3][8]) + (v3 ? 82 : 20)) : ((v2 ? v1 : a0[8]) - (a0[11] % 2)));
+    } else {
+        v3 = (((v0 || v3) == (a0[1] * a0[6])) == ((a0[10] - v3) || (a0[3] <= v1)));
+        a1[3][1] = (((v1 ? v0 : 92) >= (6 + 61)) * ((a0[3] - v0) ? (v2 * v0) : (69 < v3)));
+        v2 = (((v1 - a1[3][12]) >= (a0[15] == 47)) / 1);
+    }
+    if ((((v2 * v0) ? (v2 ? v2 : a0[2]) : (95 != 58)) % 6)) {
+        v1 = (((a0[11] <= a0[2]) % 9) ? ((v3 / 4) == (v2 == v2)) : ((v3 == a1[3][15]) >= (a0[13] >= a0[14])));
+        a0[13] = (((v2 != 28) ? (v2 <= v0) : (v3 != v3)) && ((49 && v3) > (a0[7] ? v0 : 47)));
+        a0[4] = (((a1[2][2] / 4) + (v3 == v0)) * ((v2 || a0[14]) != (v0 ? v1 : v2)));
+    } else {
+        v3 = (((a0[8] || v2) + (23 + 69)) ? ((v3 >= a1[0][13]) == (v1 && 2)) : ((v3 <= v0) - (v0 / 8)));
+        a0[1] = (((41 % 2) >= (a1[3][1] % 5)) <= ((v1 > v2) - (a1[2][3] <= v0)));
+        a0[13] = (((a0[3] >= 52) ? (v2 > v0) : (v2 / 7)) != ((39 >= v2) - (25 && v1)));
+    }
+    return (((87 || v0) != (v2 / 2)) != ((a1[0][15] > 91) - (11 && a1[2][8])));
+}
+int f1() {
+    int v0 = 57;
+    int v1 = 17;
+    int v2 = 65;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((a0[7] % 6) > 85) break;
+            v3 = (((a1[2][0] ? v1 : a0[7]) - (v2 == a1[2][15])) ? ((9 < a0[11]) / 2) : ((71 >= 3) == (v2 > v3)));
+            v1 = (((v1 * 60) || (18 - v1)) || ((a1[2][3] * v2) == (4 / 8)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((a1[1][11] ? i1 : 24) < (a1[3][4] > 46)) ? ((a1[1][7] <= i0) - (a0[10] - v2)) : ((a1[1][13] <= v1) ? (a0[12] % 6) : (32 || v3)));
+                v2 = (((i0 ? a1[0][8] : v1) ? (80 / 6) : (90 ? v0 : a1[3][9])) >= ((a1[3][1] >= a0[14]) ? (57 % 2) : (i0 >= v3)));
+                v0 = (((a0[10] ? 87 : v0) ? (i0 && i0) : (v1 != a0[8])) <= ((v1 && v0) - (22 <= a0[3])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a0[14] = (((52 % 1) % 7) ? ((46 ? a0[8] : 42) && (v3 ? v1 : 48)) : ((v0 != v2) ? (a0[8] * v0) : (v3 * v2)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((79 < v0) > 83) break;
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[8] >= 73) > 98) break;
+                    v1 = (((a0[14] / 1) < (i3 * v3)) ? ((5 < v2) < (68 >= v1)) : ((40 > 87) % 3));
+                    a1[0][12] = (((v3 || 5) % 3) >= ((2 % 3) / 6));
+                    v0 = (((v1 == a0[0]) >= (i2 && a0[4])) < ((i2 && v3) ? (v2 / 7) : (a1[2][7] ? i3 : 11)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            a0[12] = (((a0[7] - 8) && (v1 || a1[1][5])) <= ((v3 == v1) <= (i2 <= 10)));
+            v2 = (((76 - v0) >= (i2 + v3)) + ((23 <= a1[3][3]) ? (15 * 19) : (v0 != i2)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v2 * 47) ? (v1 > a0[11]) : (v2 ? 42 : v1)) + ((v3 + a1[2][2]) ? (a0[6] / 4) : (v1 <= a0[9])))) {
+        a1[2][5] = (((a1[1][3] == v0) != (v2 == 14)) < ((19 ? v1 : v0) + (v0 / 3)));
+        v2 = (((v0 / 9) ? (v1 < v0) : (v1 > v0)) <= ((17 >= a0[10]) == (v2 - v2)));
+        v2 = (((a1[1][13] == v2) + (a0[12] && 42)) || ((a1[0][15] ? v3 : 72) <= (v2 || v2)));
+    } else {
+        a1[1][15] = (((a1[2][7] + a0[1]) + (v0 % 9)) ? ((v0 + v2) > (a1[1][1] >= v1)) : ((v0 ? a1[1][11] : v2) <= (v2 ? 93 : v0)));
+        v0 = (((67 ? v1 : v2) ? (v0 == a1[2][14]) : (v2 && 68)) / 2);
+        v3 = (((16 <= 29) != (52 + v1)) / 3);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        if ((v1 ? v2 : a1[3][0]) > 75) break;
+        v1 = (((v0 + v3) && (v0 / 5)) && ((10 / 8) * (a1[1][15] <= i4)));
+        a1[0][14] = (((v1 + a0[7]) <= (v3 ? a0[9] : a0[2])) == ((a1[0][12] ? v3 : a0[11]) ? (76 ? v1 : 74) : (63 ? v1 : a0[10])));
+        {
+            int i5 = 0;
+            do {
+                if ((a1[3][12] ? i4 : v0) > 84) break;
+                a1[0][13] = (((38 < v1) < (i4 && 40)) >= ((i4 * i5) >= (a0[12] / 6)));
+                v1 = (((v1 / 9) * (v3 != 42)) * ((42 ? a0[2] : v2) <= (53 / 7)));
+                v3 = (((19 % 5) > (v3 + v0)) != ((a1[0][2] && a0[4]) + (i4 / 9)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+    }
+    return (((v3 + v2) || (a0[11] || v1)) % 5);
+}
+int main() {
+    return 0;
+}
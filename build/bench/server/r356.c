@@ -0,0 +1,165 @@
+int f0() {
+    int v0 = 52;
+    int v1 = 77;
+    int v2 = 77;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v2 = (((v1 && 74) + (25 % 5)) >= ((v2 && 59) == (63 / 7)));
+        {
+            int i1 = 0;
+            do {
+                a0[8] = (((i1 > v1) % 5) - ((v1 == v1) && (11 + a1[1][6])));
+                v2 = (((i1 < i1) || (v3 * v1)) ? ((a1[0][7] < 63) % 5) : ((83 * 53) > (4 > a0[10])));
+                v2 = (((v2 || a0[6]) / 2) > ((a1[1][5] || a0[1]) > (v1 != 50)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        v0 = (((15 != 88) % 4) % 2);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v1 = (((i2 < a1[3][1]) ? (v1 || a1[3][11]) : (a0[8] + v2)) % 4);
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                a1[0][8] = (((v3 == i2) + (v0 || i2)) > ((a0[14] != 64) ? (v0 == 80) : (48 != v2)));
+                v0 = (((i2 != v0) >= (v1 || 3)) % 2);
+                v3 = (((a0[5] + 98) <= (i2 % 3)) || ((v2 < v2) != (i3 == a0[2])));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((v2 < v2) <= (49 / 5)) - ((i2 + i2) ? (4 && 80) : (63 != a0[9])));
+    }
+    if ((((a0[13] || v3) || (v1 % 9)) > ((v2 != v3) + (a1[0][13] || v0)))) {
+        a1[0][10] = (((v3 * 52) ? (v1 <= a0[12]) : (a1[3][7] ? a0[11] : v1)) + ((v3 < v1) || (17 != 93)));
+        v1 = (((a1[3][6] >= v1) / 7) && ((a0[9] != v2) * (v3 == a0[9])));
+        v2 = (((v1 ? a0[6] : v3) + (v2 > 2)) + ((a1[1][3] || v1) - (46 > 49)));
+    } else {
+        v1 = (((a0[13] ? v3 : a1[2][15]) ? (56 == a0[4]) : (v0 != 46)) + ((v3 >= v3) - (a1[2][10] % 3)));
+        a1[1][8] = (((v2 != a0[9]) - (2 == a1[1][11])) >= ((72 <= v3) >= (v2 >= 69)));
+        v3 = (((v1 != a1[3][8]) - (85 && 30)) ? ((v2 && a0[2]) || (v3 == 95)) : ((13 * a1[1][4]) >= (v1 ? a1[2][7] : v2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            a1[1][15] = (((63 && a1[0][0]) != (i4 != v3)) < ((v0 && 60) != (83 || 52)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v2 = (((80 < a1[2][14]) > (i5 || 94)) && ((a0[13] > a0[9]) > (v0 && i5)));
+                    v2 = (((63 * v0) ? (i4 != i4) : (97 / 6)) != ((71 || a0[12]) != (a0[14] ? v2 : v3)));
+                    v0 = (((i4 - v1) + (a0[3] * i4)) == ((a1[3][10] % 7) - (v3 >= 8)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[2][11] = (((a0[5] == i4) < (v3 <= a0[9])) >= ((43 >= 11) < (a1[1][9] && 84)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v2 = (((v1 + 45) * (82 <= 42)) != ((a1[2][2] != a1[0][15]) / 8));
+            v2 = (((v1 / 2) || (v3 && v2)) && ((v0 < v3) != (v0 ? 69 : 7)));
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((a1[3][14] || v1) ? (v2 * 34) : (12 == i6)) >= ((36 ? v0 : v2) / 1));
+                    a0[4] = (((22 % 5) / 1) == ((a1[0][6] * a1[2][3]) == (83 - 27)));
+                    v0 = (((48 % 3) < (a1[3][5] >= a0[14])) % 1);
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((a0[4] / 2) <= (62 || v1)) >= ((v2 >= v1) <= (88 != 92)));
+}
+int f1() {
+    int v0 = 8;
+    int v1 = 96;
+    int v2 = 57;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 && a1[2][6]) < (v2 * a0[8])) % 4);
+    if ((((v3 / 3) / 8) ? ((v0 < v3) ? (v1 % 2) : (v0 * v1)) : ((99 == a0[4]) ? (v2 % 6) : (v2 || v3)))) {
+        v2 = (((v2 <= a0[3]) - (v1 % 8)) < ((v3 == 92) * (v0 < v3)));
+        a1[3][15] = (((v0 > a1[0][15]) ? (v0 % 3) : (v2 && v1)) == ((74 <= a1[1][10]) >= (v3 == a1[3][14])));
+        v0 = (((82 ? a0[1] : 80) < (v0 - 80)) && ((65 / 7) - (7 || a1[3][8])));
+    } else {
+        v0 = (((v2 + v2) / 5) && ((v3 < a0[3]) >= (a1[2][13] && v1)));
+        v1 = (((31 && 7) == (76 || 62)) <= ((v1 % 5) == (v0 >= 9)));
+        v1 = (((v0 - v0) && (30 ? v1 : 37)) || ((v2 / 9) > (95 * a0[7])));
+    }
+    v2 = (((v0 - 39) ? (a0[10] - v0) : (v0 == v0)) * ((a1[3][10] ? 36 : v0) <= (55 ? v3 : 47)));
+    if ((((84 && a0[1]) != (v1 && v3)) > ((86 % 3) > (v0 || a0[14])))) {
+        v3 = (((9 % 9) <= (a0[3] > v2)) <= ((48 / 7) >= (v3 && v3)));
+        v3 = (((v0 == v2) != (v1 < 94)) >= ((72 + a1[0][0]) >= (v3 * a1[3][2])));
+        v1 = (((66 != a0[8]) < (v2 || a1[3][1])) ? ((a0[3] > v3) && (58 <= v1)) : ((6 % 2) ? (v2 * a0[0]) : (73 || v2)));
+    } else {
+        v1 = (((v2 == v3) > (34 + a0[0])) >= ((v2 || v0) / 4));
+        a0[13] = (((v1 < 55) || (v2 ? a1[0][4] : 3)) * ((v1 ? 31 : 57) && (29 <= v2)));
+        a0[15] = (((a1[3][12] == v2) && (15 == v1)) % 8);
+    }
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a0[1] && v3) > (v1 ? a1[1][9] : v3)) != ((v3 >= 47) != (a0[6] == 65)));
+            a0[14] = (((63 * v3) || (a0[9] >= 94)) - ((v2 * a1[2][5]) != (96 + v0)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v1 = (((v3 < a0[13]) <= (v3 < 31)) > ((v3 ? a0[5] : v0) || (a1[1][14] ? v2 : i1)));
+                v0 = (((i1 || v2) >= (78 == i0)) && ((a0[3] ? 25 : 68) / 8));
+                v3 = (((a1[3][15] || 47) < (v0 ? v0 : 84)) / 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    return (((v3 ? 74 : 61) == (v1 / 6)) % 3);
+}
+int f2() {
+    int v0 = 23;
+    int v1 = 95;
+    int v2 = 97;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((51 ? a1[0][5] : v0) <= (v3 / 3)) - ((v3 * v2) % 5));
+    if ((((v2 * a1[2][5]) && (76 - v1)) - ((66 && v3) != (v1 && 56)))) {
+        v2 = (((a1[0][2] * a1[1][0]) <= (77 < 74)) < ((v0 > a1[2][7]) ? (92 != 97) : (v1 + 81)));
+        a0[12] = (((63 && v3) < (47 <= a0[13])) != ((v2 / 3) / 3));
+        v2 = (((v3 == a0[4]) / 3) != ((v3 + 84) == (v0 <= v3)));
+    } else {
+        v3 = (((v0 || v3) && (28 != a0[4])) ? ((v1 == 34) % 8) : ((a1[1][8] > a1[0][14]) * (10 ? 40 : v0)));
+        a1[1][0] = (((a0[9] / 7) < (a1[3][12] < v0)) || ((a0[12] <= a1[3][13]) * (v3 < a0[4])));
+        v3 = (((v3 > v0) ? (a0[14] <= v0) : (v2 % 4)) >= ((v0 && v1) / 6));
+    }
+    v3 = (((v3 != 60) == (v1 - v1)) ? ((v2 * 16) < (v3 < a1[3][7])) : ((v2 / 8) == (a0[14] ? v0 : v0)));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            a1[2][12] = (((v0 == 37) <= (v1 ? a1[1][11] : v1)) != ((a0[6] - a0[14]) <= (v1 * i1)));
+            v2 = (((v0 % 4) > (0 != i0)) ? ((v0 && a1[3][0]) && (v0 >= 22)) : ((a1[1][3] != v0) * (v0 - 56)));
+            a0[1] = (((v3 == i1) - (v2 == 7)) ? ((v2 <= i0) < (v1 ? v1 : v2)) : ((a0[8] > a1[3][4]) != (v1 - 0)));
+        }
+        v3 = (((a0[10] > v3) >= (a0[8] || v3)) || ((86 && a0[6]) > (a0[3] || v3)));
+        a0[4] = (((i0 % 3) < (v0 % 5)) || ((a0[11] && a1[1][2]) + (3 != v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v1 || 55) / 7) ? ((a1[0][0] != a1[1][11]) || (v0 == a0[10])) : ((v0 * a0[12]) > (i2 > v1)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v3 = (((a1[1][10] && a0[3]) / 4) ? ((v2 >= i3) >= (v0 * 32)) : ((a0[13] > v2) ? (i3 + 42) : (33 % 8)));
+                v1 = (((i3 ? v0 : v3) != (a1[0][5] ? a0[9] : v2)) - ((v0 != 58) / 6));
+                v3 = (((57 % 2) - (a0[7] <= 96)) / 2);
+            }
+            a0[9] = (((2 > v0) - (v0 > 42)) ? ((v0 < v1) > (v0 ? v1 : v3)) : ((i2 > v0) * (99 ? i2 : v0)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((a1[0][14] % 5) * (a1[1][12] - v3)) < ((31 ? a1[0][4] : a1[2][0]) >= (a1[2][8] ? v3 : v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,49 @@
+int f0() {
+    int v0 = 81;
+    int v1 = 69;
+    int v2 = 33;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 == v0) ? (v3 > v0) : (v2 < v2)) / 8)) {
+        v0 = (((a1[2][10] + a1[2][0]) > (3 <= v0)) && ((v1 == 88) <= (v2 ? a0[6] : a1[3][11])));
+        a1[3][2] = (((v0 || v2) ? (a0[8] && v1) : (v1 > a1[1][15])) != ((v2 > v0) != (60 && a1[1][11])));
+        v2 = (((a1[0][4] / 9) == (v3 > a0[9])) != ((55 - v3) - (v2 != a1[3][12])));
+    } else {
+        v3 = (((v1 - v0) * (v3 == v1)) + ((97 == v2) <= (a0[14] ? 26 : v1)));
+        v0 = (((v0 >= 74) % 4) < ((v1 < v0) != (v0 < v2)));
+        v1 = (((v2 + 20) / 5) / 4);
+    }
+    if ((((a0[11] <= a1[1][13]) != (37 * v0)) >= ((v0 + 88) == (5 + v3)))) {
+        a0[2] = (((v0 + 26) != (a1[1][10] && v2)) + ((a1[2][6] - v2) >= (v1 ? 81 : a0[0])));
+        a0[8] = (((a1[2][5] == v1) / 7) * ((v1 != 60) + (v2 > v3)));
+        v2 = (((v3 > 39) != (17 + v3)) && ((v3 % 8) >= (v0 <= v1)));
+    } else {
+        a1[1][3] = (((v1 / 5) ? (v1 - v2) : (65 == v1)) != ((v1 / 8) && (a1[3][2] && 25)));
+        v0 = (((87 >= v3) ? (89 ? v1 : v3) : (v2 && 77)) + ((52 % 2) / 6));
+        v2 = (((a0[9] * a1[1][14]) || (v0 < v3)) > ((a0[14] >= v2) / 9));
+    }
+    if ((((v1 != v1) == (v1 < v2)) > ((v1 % 7) >= (v3 >= v2)))) {
+        v1 = (((v1 - a0[1]) < (a1[2][3] < v1)) <= ((a0[10] % 8) && (59 > 67)));
+        a1[2][6] = (((v2 <= a0[9]) + (a1[1][0] > 19)) / 9);
+        a0[0] = (((v3 ? a0[7] : a1[1][8]) * (v1 <= a1[2][12])) < ((a1[1][12] * 89) && (a1[2][10] / 4)));
+    } else {
+        v3 = (((a0[6] < v1) == (v1 <= a0[7])) < ((98 + v0) == (69 ? 2 : a0[3])));
+        v0 = (((v1 < v0) - (12 - a0[1])) < ((a1[1][14] || v1) + (5 * v0)));
+        v1 = (((90 || a0[15]) > (a0[4] - v2)) ? ((v2 ? v1 : v0) != (88 >= a0[6])) : ((v2 > 18) || (54 % 5)));
+    }
+    v3 = (((a1[0][14] / 7) * (v3 || v1)) < ((v1 || v2) > (a0[1] > v0)));
+    if ((((v1 <= a0[8]) % 3) != ((v0 - 26) > (a0[12] * 88)))) {
+        v2 = (((a0[8] != v0) <= (v1 - a0[13])) - ((56 || a1[2][10]) >= (87 % 6)));
+        v3 = (((v3 % 3) ? (v1 == 44) : (a0[5] >= v3)) ? ((v3 > 5) != (v3 <= v0)) : ((15 >= v2) ? (a1[0][12] <= v0) : (v3 <= a0[3])));
+        a0[3] = (((a1[3][14] >= v3) <= (v0 <= 21)) < ((v2 * v3) >= (v0 || 41)));
+    } else {
+        v2 = (((v3 ? 51 : 59) * (2 ? v3 : v3)) && ((v1 && v2) <= (a1[2][13] > a0[2])));
+        v0 = (((v0 / 7) < (a1[1][15] / 1)) >= ((19 || v2) ? (88 + a1[3][8]) : (v3 ? a1[3][0] : v0)));
+        v3 = (((v0 ? v1 : v1) != (v1 ? v3 : a0[9])) >= ((a1[3][13] ? 54 : v1) <= (13 == 14)));
+    }
+    return (((64 || v3) <= (v1 < v1)) <= ((v3 > a1[0][7]) - (a0[7] > v3)));
+}
+int main() {
+    return 0;
+}
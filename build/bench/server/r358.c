@@ -0,0 +1,128 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 46;
+    int v2 = 11;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((86 / 2) * (v1 && v0)) != ((a0[2] <= v0) && (v3 % 1)));
+    if ((((v3 % 9) ? (v2 <= v2) : (a1[3][14] + a1[1][15])) + ((a1[1][13] ? 47 : v2) < (a0[8] == 96)))) {
+        a1[1][11] = (((v2 == v0) - (64 / 1)) ? ((v3 < v1) == (v3 ? a0[0] : v0)) : ((v3 % 6) ? (v1 - 65) : (17 != a0[8])));
+        a0[4] = (((v0 - 44) <= (a0[5] && a1[0][8])) % 3);
+        a0[4] = (((v3 ? a1[3][13] : 71) != (a0[6] ? a1[1][14] : 36)) - ((51 * v3) % 5));
+    } else {
+        a0[15] = (((a0[7] || v3) <= (v2 - v0)) * ((v1 <= 11) || (85 * 21)));
+        a0[11] = (((41 == 98) ? (v1 / 9) : (v3 / 7)) == ((v1 != v3) >= (v1 == 25)));
+        v2 = (((v1 % 8) - (v1 / 9)) - ((a1[0][2] ? a0[15] : 25) / 8));
+    }
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v2 - v2) > (v1 ? v2 : 38)) >= ((v2 - v3) == (a1[1][1] && 11)));
+            v2 = (((a1[0][1] / 5) > (v2 / 7)) - ((i0 && 79) && (v1 > i0)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((v2 && a1[1][4]) > 59) break;
+                a0[5] = (((v1 % 5) > (v1 ? v0 : 84)) * ((v0 ? a1[2][14] : v1) ? (a0[3] > a1[0][0]) : (a0[11] <= v3)));
+                v1 = (((v2 * 6) <= (i1 || v3)) > ((v0 && i0) % 5));
+                a1[0][0] = (((i1 == 58) + (a1[2][8] || v2)) + ((15 < 49) / 3));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((a1[1][2] == v0) && (1 == v0)) <= ((v3 && a0[5]) >= (98 != a0[3])))) {
+        v2 = (((a0[2] >= a1[2][0]) ? (28 < 31) : (29 - a1[3][15])) - ((2 >= a0[15]) >= (v0 * v2)));
+        v0 = (((a0[11] ? a0[8] : a1[2][5]) * (79 + 43)) - ((a1[1][12] >= v3) + (82 <= v2)));
+        v1 = (((54 != v1) % 1) - ((v2 / 6) % 7));
+    } else {
+        a1[3][12] = (((72 / 9) == (a1[3][4] - a0[5])) % 9);
+        a0[12] = (((46 / 1) != (24 / 4)) || ((v0 + v1) * (a0[8] <= 28)));
+        v3 = (((v1 - 15) - (v3 >= v3)) > ((34 < 3) / 6));
+    }
+    if ((((15 >= v0) || (v3 ? v3 : a1[0][10])) - ((10 - v3) == (48 && v0)))) {
+        a0[8] = (((a1[2][14] == a1[2][3]) * (v3 - v1)) <= ((a1[3][8] ? a0[13] : 64) - (v2 ? a0[0] : 20)));
+        a0[14] = (((79 / 1) != (v2 ? 74 : v0)) - ((33 && a1[3][5]) - (a1[1][10] / 1)));
+        a1[3][9] = (((v2 < 0) > (v3 <= v0)) % 9);
+    } else {
+        a0[14] = (((a1[1][8] != v2) + (v2 > v3)) != ((v3 > 9) >= (v2 != 25)));
+        v3 = (((v2 && v3) + (v0 <= a1[1][2])) < ((a0[0] < v1) != (a1[1][15] / 3)));
+        a0[10] = (((a1[2][8] % 5) || (v2 || 63)) <= ((50 >= v2) ? (88 < v2) : (v2 <= v3)));
+    }
+    return (((a1[2][8] ? v2 : 92) && (v2 + v2)) - ((3 == v1) - (v0 % 6)));
+}
+int f1() {
+    int v0 = 40;
+    int v1 = 64;
+    int v2 = 7;
+    int v3 = 58;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((v2 > 38) > 94) break;
+            v1 = (((v2 < 13) / 6) <= ((v2 >= 92) + (i0 <= 92)));
+            {
+                int i1 = 0;
+                do {
+                    if ((58 && i1) > 70) break;
+                    a1[3][8] = (((v3 ? i0 : a0[8]) < (v0 != 93)) != ((69 != a1[1][13]) > (v0 && v1)));
+                    v2 = (((a0[9] * v0) / 8) % 8);
+                    a0[8] = (((i0 == a1[0][14]) + (v2 + 63)) < ((a1[0][11] - a1[1][1]) || (v1 || a1[1][11])));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((v3 || i0) / 6) - ((a1[3][6] / 6) * (a0[1] ? 35 : v3)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        a0[0] = (((1 >= i2) <= (11 == v0)) / 4);
+        a1[1][6] = (((23 ? i2 : i2) != (90 ? 74 : v3)) ? ((v0 && 63) - (v0 ? v0 : v2)) : ((17 && v3) >= (v2 - a1[0][7])));
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                if ((a0[9] ? a0[12] : 75) > 78) break;
+                a1[0][5] = (((a1[1][9] * a1[2][11]) % 2) + ((i2 == v0) != (v0 == a1[0][0])));
+                a0[6] = (((i2 >= v3) % 6) / 3);
+                a0[7] = (((v2 < v3) && (a0[7] % 5)) >= ((24 * v2) == (a1[1][4] < a0[14])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        a1[2][9] = (((6 != v0) * (v1 <= 92)) != ((a0[1] + 33) > (v0 != v3)));
+        v3 = (((a0[5] < v1) && (i4 != v1)) ? ((a1[3][2] <= 12) == (a0[12] - v0)) : ((v1 > a1[1][5]) * (v3 < a0[0])));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            a1[1][3] = (((v1 || i4) ? (v2 > v1) : (a1[2][14] ? v1 : i4)) % 2);
+            v1 = (((i5 > v0) <= (89 ? v1 : 35)) == ((a0[1] - a1[3][11]) <= (i4 <= 59)));
+            v2 = (((a1[1][9] > v2) < (22 + v3)) <= ((a1[1][4] >= a0[4]) && (i5 == a1[3][9])));
+        }
+    }
+    if ((((29 * v0) * (a0[2] % 4)) * ((87 - a0[11]) - (a0[14] - 11)))) {
+        v1 = (((23 != v3) >= (a0[7] * 54)) ? ((v3 || v1) / 2) : ((55 != 17) == (v1 && 95)));
+        v2 = (((69 * 63) || (v2 % 9)) ? ((v3 + v3) % 8) : ((v0 % 3) && (a1[0][13] <= a1[0][4])));
+        v3 = (((a1[1][4] ? 24 : v1) != (v2 || a1[3][10])) >= ((v3 % 1) % 9));
+    } else {
+        v1 = (((17 > 12) ? (v3 ? v0 : v3) : (v2 && v3)) || ((v1 + v0) - (79 < v2)));
+        v1 = (((v2 - a0[7]) * (83 > v2)) >= ((v0 % 8) * (a1[1][5] > 94)));
+        a1[3][4] = (((23 - a0[5]) * (v0 && v0)) / 1);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((v0 < 99) > 68) break;
+        {
+            int i7 = 0;
+            while (i7 < 8) {
+                a1[0][6] = (((i6 || a1[1][8]) - (v3 >= i6)) + ((v3 ? 64 : 1) < (18 * v2)));
+                v3 = (((a1[0][0] * a1[3][5]) > (4 / 1)) && ((v0 / 2) && (97 - v0)));
+                v1 = (((i6 == 84) % 9) % 8);
+                i7 = i7 + 1;
+            }
+        }
+        a0[8] = (((a1[3][7] != a1[1][11]) * (3 || v2)) > ((v1 >= 89) || (i6 >= a1[3][7])));
+        v0 = (((a1[1][9] >= i6) && (v1 * i6)) ? ((v0 + 65) || (v1 < v1)) : ((a1[0][4] || v3) + (v2 != a1[0][15])));
+    }
+    return (((v1 != v2) * (27 - 83)) > ((a1[3][9] + v2) ? (v1 || v0) : (a1[1][8] / 6)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,146 @@
+int f0() {
+    int v0 = 56;
+    int v1 = 41;
+    int v2 = 4;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    a1[1][13] = (((v0 <= 95) / 1) != ((a0[2] <= 29) || (98 % 2)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a1[2][8] = (((12 ? v0 : 81) || (a1[1][13] * i0)) >= ((v0 ? v2 : a0[4]) * (v2 >= i0)));
+        {
+            int i1 = 0;
+            do {
+                v3 = (((36 > a0[12]) - (4 && i0)) * ((97 && v3) - (v2 > 97)));
+                v0 = (((v2 <= v1) < (i1 <= 80)) && ((a0[8] ? i1 : 63) > (60 ? v1 : v3)));
+                a1[3][4] = (((a1[1][13] && a0[0]) || (68 * 14)) > ((a0[10] != v0) % 6));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        a1[0][13] = (((a1[2][15] * i0) % 8) - ((55 < 98) - (v3 != 45)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a0[11] = (((64 || a0[13]) ? (92 != i2) : (v1 ? a0[15] : 44)) < ((i2 + a0[4]) || (a0[4] ? v2 : v0)));
+        a1[3][7] = (((4 || 55) == (v3 ? i2 : 87)) && ((a0[6] > 15) > (10 != v2)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v0 = (((v3 ? v0 : v2) * (i2 % 3)) + ((a0[8] > v1) ? (63 ? v0 : v1) : (76 / 6)));
+                a1[2][14] = (((v1 != v3) != (v0 ? i2 : v1)) * ((v2 != a1[0][9]) < (v1 / 4)));
+                v1 = (((v0 != 67) == (i2 || i3)) > ((v1 - v0) >= (i2 > 13)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((v3 >= v1) - (v0 > 81)) > ((v0 % 8) != (41 * v1)))) {
+        v0 = (((a0[9] != 16) % 2) + ((v3 != v3) - (a0[10] && v3)));
+        a0[8] = (((22 && v0) == (22 || v3)) >= ((v0 * v3) + (v3 ? v1 : v3)));
+        a0[8] = (((v2 > 65) % 5) ? ((v2 % 5) * (v3 == a1[0][11])) : ((v1 * v3) % 3));
+    } else {
+        a0[7] = (((v3 / 2) != (11 + v1)) > ((45 > v3) < (3 <= 16)));
+        v2 = (((v1 <= a0[15]) / 2) <= ((30 > v1) < (v3 + v0)));
+        v2 = (((73 >= a1[2][6]) != (a0[14] - v0)) - ((v0 <= v2) > (v0 - a0[0])));
+    }
+    v3 = (((24 * a1[3][14]) && (10 || v1)) <= ((v2 * 29) / 6));
+    return (((a0[12] - 37) || (a1[1][10] < a0[0])) - ((v1 && 55) == (v0 == a0[2])));
+}
+int f1() {
+    int v0 = 15;
+    int v1 = 46;
+    int v2 = 78;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 <= v3) != (a1[2][7] ? v3 : v3)) > ((v2 <= 83) + (a0[13] || v3)))) {
+        v2 = (((a1[3][10] != 31) ? (v1 || a1[1][0]) : (v2 > 16)) || ((62 / 6) < (v1 ? 9 : a1[0][2])));
+        v2 = (((v0 / 3) / 8) != ((v2 / 6) || (v3 % 7)));
+        v1 = (((61 != v2) - (v1 == 37)) < ((4 ? a0[14] : a0[1]) != (a1[2][9] + v1)));
+    } else {
+        v1 = (((v0 * v2) - (a1[2][7] + v0)) % 6);
+        a1[2][11] = (((53 != v2) > (a1[2][0] > a1[1][9])) * ((v2 % 6) >= (73 ? v0 : a1[1][15])));
+        v0 = (((47 ? v1 : 4) ? (v0 ? v2 : v2) : (a0[9] != a0[7])) == ((v3 - 88) > (v2 == 21)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v0 >= a1[0][13]) != (a0[12] && v1)) + ((80 == v1) % 4));
+            a1[1][8] = (((v1 % 7) ? (i0 != a1[2][13]) : (v0 > v1)) ? ((i0 % 2) || (v1 / 6)) : ((a1[3][8] >= 91) / 8));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v3 % 2) == (v3 < 73)) - ((v2 != i0) % 3));
+                    v2 = (((a1[1][7] - 42) < (v2 ? v0 : 56)) == ((i0 * v2) >= (75 % 9)));
+                    v2 = (((v0 <= v1) > (a1[1][10] < a0[0])) * ((a1[0][0] % 9) < (22 < a1[1][0])));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v2 = (((32 / 4) == (a0[6] != v3)) != ((83 - 55) * (a0[0] - 37)));
+    v0 = (((a0[3] == 79) >= (42 >= v2)) >= ((v3 + v3) - (59 != v1)));
+    v3 = (((a1[1][6] != v0) <= (a1[0][1] / 3)) - ((a0[1] ? 25 : v3) != (v0 <= v1)));
+    return (((a1[1][2] > 23) == (v1 % 8)) > ((v0 < 56) ? (v0 != v2) : (a1[0][13] == v2)));
+}
+int f2() {
+    int v0 = 15;
+    int v1 = 88;
+    int v2 = 18;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a0[3] >= 84) > 65) break;
+        {
+            int i1 = 0;
+            do {
+                v0 = (((59 ? i1 : a0[3]) - (a1[2][13] ? i0 : a0[13])) % 6);
+                a0[3] = (((65 * 15) > (i1 != v3)) / 5);
+                v3 = (((v3 != i0) + (a0[9] / 1)) == ((a0[13] * v3) + (v1 == v0)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v1 = (((50 != v0) ? (84 * 35) : (v1 >= 85)) <= ((v3 + 41) ? (21 > a1[2][12]) : (v0 ? a1[2][12] : a1[1][5])));
+        v3 = (((v0 < a0[13]) < (51 <= i0)) ? ((v1 ? a0[10] : 24) >= (9 + a0[6])) : ((a1[3][7] - a0[11]) + (v1 <= v0)));
+    }
+    v3 = (((a1[3][1] >= v2) && (v0 >= 90)) * ((v3 + 15) || (37 - v2)));
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a1[0][11] == 94) <= (50 == v3)) - ((i2 < i2) + (59 * v3)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    a1[1][7] = (((i2 - 67) ? (a1[2][0] > a0[8]) : (a0[9] % 8)) || ((i2 < v0) < (v0 || v2)));
+                    v0 = (((v0 % 1) >= (i2 == 1)) + ((94 ? v2 : v2) == (a0[5] <= 87)));
+                    v1 = (((v0 != 44) <= (a0[5] - 58)) != ((i3 / 8) ? (v2 % 6) : (i2 - 74)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((45 && i2) % 8) >= ((78 || a1[1][8]) + (v0 ? v2 : v1)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v3 = (((a0[9] < v3) == (v2 % 6)) && ((v3 ? a0[15] : v1) < (v3 <= a1[0][15])));
+    {
+        int i4 = 0;
+        do {
+            v3 = (((27 >= v3) == (38 % 4)) < ((a1[2][14] || a0[12]) >= (i4 ? v0 : v3)));
+            a1[1][2] = (((a1[2][2] >= a1[1][5]) / 3) <= ((v2 < v2) % 8));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v1 = (((93 || v0) != (a1[3][7] || i4)) <= ((v0 < a1[1][3]) - (v0 || 46)));
+                    v2 = (((i4 == v0) >= (59 >= v2)) / 9);
+                    a0[9] = (((i4 * a0[11]) <= (a0[15] || 47)) + ((v0 ? v3 : 95) + (69 + v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((v0 || v2) <= (v1 <= a1[0][9])) <= ((v1 ? v1 : a1[3][12]) == (v1 / 1)));
+}
+int main() {
+    return 0;
+}
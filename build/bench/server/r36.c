@@ -0,0 +1,67 @@
+int f0() {
+    int v0 = 31;
+    int v1 = 7;
+    int v2 = 76;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[2][3] = (((37 % 8) * (94 ? v1 : 39)) && ((42 < 44) / 5));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a0[4] = (((v3 < a0[6]) && (v0 >= i1)) % 9);
+                    a1[3][8] = (((a1[0][3] ? i1 : 53) + (v1 >= i0)) > ((71 == i1) == (i0 ? i1 : v0)));
+                    v3 = (((45 <= v3) % 9) + ((v1 + v0) - (v2 % 4)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((a1[0][0] / 5) + (v0 || v2)) <= ((11 <= v0) && (91 - 49)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v1 = (((a1[1][6] >= v0) + (i2 == v1)) - ((i2 >= v1) ? (15 / 7) : (42 ? v2 : 24)));
+            a1[0][2] = (((95 != i2) || (v1 > a1[0][13])) <= ((a0[11] / 9) == (a0[12] / 8)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((v0 + a1[2][14]) - (v2 - v0)) >= ((i2 != i3) > (66 % 7)));
+                v1 = (((v1 < 82) / 3) <= ((i2 - v0) > (a1[1][2] % 9)));
+                a1[3][11] = (((v0 - 79) == (a1[1][13] ? v2 : 41)) >= ((1 - v0) ? (a0[6] ? i3 : v1) : (35 % 2)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v3 = (((v2 <= i5) * (i4 + a1[1][0])) <= ((91 - 12) ? (v0 >= v2) : (i5 + a1[3][13])));
+                v0 = (((21 != v1) == (24 ? 3 : a1[0][13])) - ((a0[7] < 47) + (i4 || a0[3])));
+                v2 = (((30 % 5) <= (i4 <= v2)) ? ((v2 >= v0) && (86 / 6)) : ((a1[3][5] || v0) || (v0 ? a0[4] : v1)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        a0[9] = (((a1[1][12] ? i4 : 83) > (17 % 8)) % 5);
+        a0[10] = (((a1[3][7] == i4) < (v0 && a1[3][15])) <= ((a0[1] && 1) / 6));
+    }
+    if ((((14 + a1[0][3]) <= (20 == v2)) * ((v0 > a0[7]) * (50 % 5)))) {
+        v0 = (((a1[0][5] * a1[3][10]) > (25 >= v3)) + ((v1 == a0[9]) <= (v3 * v0)));
+        v1 = (((v3 ? 54 : 39) && (a0[11] >= v2)) > ((v0 == 86) && (v0 ? 11 : v2)));
+        v2 = (((12 + v0) > (v2 - a0[6])) <= ((87 > v2) / 6));
+    } else {
+        v2 = (((a0[12] ? a1[3][15] : a1[2][5]) || (98 ? v2 : v0)) > ((v0 % 7) / 8));
+        v0 = (((76 && a1[0][5]) * (72 * 12)) || ((v1 + 59) == (26 <= v2)));
+        v2 = (((v0 <= a0[9]) * (98 < v1)) ? ((v3 ? v1 : v2) % 9) : ((72 + v1) && (a1[3][1] + v1)));
+    }
+    v3 = (((a0[5] >= v3) ? (v3 - v1) : (82 != 74)) || ((v1 ? v3 : v3) == (v3 / 6)));
+    return (((v3 - v0) % 9) < ((9 * v3) <= (v3 != v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,50 @@
+int f0() {
+    int v0 = 33;
+    int v1 = 48;
+    int v2 = 71;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v0 = (((v1 >= 46) - (a1[3][3] ? 68 : v0)) / 9);
+        a0[13] = (((v2 - 55) != (61 || 35)) <= ((v2 - v1) % 5));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            if ((a1[2][7] - a1[3][9]) > 85) break;
+            v1 = (((25 <= a1[2][10]) && (a0[0] < i1)) * ((40 < a1[0][15]) / 7));
+            v3 = (((92 < 47) || (i1 || 36)) < ((a0[5] && a1[0][13]) * (v0 + v3)));
+            v2 = (((v0 % 3) - (v2 - v3)) > ((i0 > v1) % 6));
+        }
+    }
+    v1 = (((v0 * 75) ? (13 < v0) : (a0[4] / 3)) && ((6 >= v0) <= (v3 < v1)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    a0[13] = (((a0[7] + i3) / 2) == ((a0[7] - v2) == (i3 - a1[0][13])));
+                    v2 = (((14 + v3) + (v0 || 80)) ? ((a0[8] - v0) + (v0 ? a1[0][9] : v3)) : ((37 < 85) == (a0[3] / 4)));
+                    v2 = (((a0[4] && 44) ? (v1 > 86) : (v1 && a1[1][14])) || ((67 / 1) == (i2 ? i2 : v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v1 > v3) < (a1[3][13] >= 3)) && ((v0 % 9) > (v1 ? a1[1][1] : v3)));
+            v3 = (((v3 && 29) <= (i2 % 7)) == ((i2 ? 44 : v2) - (v2 <= 2)));
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v3 == v1) >= (v3 != 63)) <= ((a0[5] > 55) == (v3 ? a1[2][10] : a0[10])));
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v3 = (((a0[11] + a1[2][0]) - (v2 / 8)) < ((a1[0][7] > v1) ? (6 && 65) : (a1[0][14] ? 11 : a1[2][14])));
+        v3 = (((i4 == 80) || (a0[10] <= 78)) && ((90 != v2) != (98 * 29)));
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            v1 = (((v1 % 9) < (v2 == v1)) + ((v3 <= v3) < (v2 < v2)));
+            v1 = (((83 == 49) >= (a1[1][9] ? 20 : a1[2][13])) / 5);
+            v2 = (((i5 != v2) - (85 + 24)) || ((86 && a1[1][1]) + (76 <= v0)));
+        }
+    }
+    return (((v2 < a1[2][6]) > (v3 / 3)) && ((v3 <= 92) ? (a1[2][14] == v3) : (v3 <= a1[0][6])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,115 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 34;
+    int v2 = 4;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    if ((((31 && v0) - (a1[3][15] > v0)) / 5)) {
+        v0 = (((a1[3][1] || 10) <= (v3 >= v3)) * ((27 > 73) - (a0[0] < v0)));
+        a0[13] = (((84 <= v2) - (85 == 92)) < ((v3 >= 87) ? (v1 - a0[1]) : (v3 > v0)));
+        a1[2][0] = (((63 + v1) < (19 ? v0 : v1)) != ((v3 * 80) ? (a1[2][3] ? v2 : a0[5]) : (15 % 7)));
+    } else {
+        v3 = (((a1[0][12] ? a1[1][13] : v3) / 4) < ((a1[1][14] - a1[2][12]) ? (v1 == a0[15]) : (98 < v2)));
+        v3 = (((a0[1] > v3) * (v3 && a0[12])) <= ((v0 && 56) == (v0 ? a0[4] : v3)));
+        v2 = (((a0[14] ? a1[0][13] : v2) != (11 + 84)) || ((a0[4] >= a0[3]) == (a0[2] || a1[2][6])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((i0 * v3) > 95) break;
+            a1[3][5] = (((v2 + a1[3][8]) + (a0[1] >= i0)) || ((v0 && 6) ? (v3 <= i0) : (19 >= a0[12])));
+            v3 = (((v1 == a0[3]) * (v1 + a0[11])) != ((a0[4] != v3) % 2));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((v2 * v0) <= (v3 * i0)) * ((v2 < v3) - (36 ? v3 : 74)));
+                    a0[5] = (((a0[0] * a1[2][13]) != (47 == 99)) && ((0 ? v2 : i0) > (v0 - v2)));
+                    v3 = (((13 ? i1 : v2) && (v3 < 99)) - ((i0 ? v1 : 71) ? (i1 ? v3 : a0[14]) : (a1[1][0] <= v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 != a1[2][2]) > 61) break;
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((a0[8] == v0) > 60) break;
+                a1[3][11] = (((76 == a1[3][2]) / 9) || ((v0 >= v1) ? (v2 != a0[5]) : (40 % 3)));
+                v3 = (((v3 - 22) < (40 <= 95)) && ((a0[4] ? a0[5] : i2) * (72 < i3)));
+                a1[1][3] = (((v0 < a0[12]) || (58 || a0[14])) ? ((a1[0][5] > v1) < (v1 < v0)) : ((a1[1][8] || a0[1]) - (v2 + 14)));
+            }
+            a0[8] = (((i2 + a0[9]) % 3) * ((a0[0] != 38) >= (a0[11] && 83)));
+            v3 = (((v3 <= 70) > (86 || i2)) <= ((v1 > v1) && (v2 >= v2)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((v1 || v3) || (92 ? v1 : v1)) == ((v3 % 6) || (v0 * a1[0][1])))) {
+        a1[2][8] = (((a1[1][9] <= v2) >= (a0[11] > v0)) != ((v3 <= a1[3][1]) > (a0[13] && 42)));
+        v0 = (((a1[3][7] <= v2) > (v3 + v1)) > ((v2 < a0[4]) >= (v0 >= 54)));
+        v1 = (((v2 && 60) / 9) == ((16 != v0) != (v0 == 34)));
+    } else {
+        v3 = (((36 ? a1[3][8] : a1[1][14]) < (v3 != v1)) - ((a1[1][13] ? a0[13] : a0[0]) + (v0 == v2)));
+        v3 = (((v3 >= 70) ? (v1 % 4) : (v1 == 86)) > ((a0[15] >= v0) && (44 ? a0[2] : v0)));
+        v0 = (((39 < v1) || (33 > a1[2][15])) < ((v1 != v2) <= (a0[9] && 9)));
+    }
+    a0[6] = (((v3 >= 79) >= (v3 >= 56)) < ((14 % 9) + (v1 < 33)));
+    return (((v3 && a0[11]) && (v1 + v0)) <= ((67 < a0[8]) % 2));
+}
+int f1() {
+    int v0 = 69;
+    int v1 = 32;
+    int v2 = 46;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 || a1[3][14]) / 5) || ((v2 <= 38) == (a1[3][10] >= v3)))) {
+        v0 = (((39 >= a0[1]) <= (v1 * v2)) == ((9 - v0) - (a1[1][12] * 64)));
+        v3 = (((a0[11] ? v1 : a0[9]) != (v0 == v3)) || ((21 % 5) / 5));
+        a0[12] = (((v1 - a1[0][14]) >= (v2 ? 27 : a1[3][8])) ? ((a0[15] % 1) ? (v2 * v1) : (a0[9] < v2)) : ((v3 <= a0[1]) ? (34 - v1) : (a1[1][11] / 9)));
+    } else {
+        a0[7] = (((a1[2][14] && 25) < (v1 / 9)) - ((v1 || v2) % 3));
+        v2 = (((a0[10] - a1[3][6]) / 1) && ((2 && v2) >= (64 - v3)));
+        v2 = (((v2 % 4) >= (a0[8] <= v0)) - ((a1[2][12] < v1) ? (a0[6] % 2) : (v3 >= 17)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((i0 - a1[2][9]) > 50) break;
+            v1 = (((a0[7] % 1) && (v3 >= v2)) ? ((2 >= v1) * (a0[9] * i0)) : ((a0[12] || a0[6]) % 4));
+            a0[10] = (((i0 * v1) ? (i0 < i0) : (v2 > v3)) / 5);
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v3 = (((v3 && 50) / 3) && ((77 || v0) ? (a0[8] == v3) : (v2 == a1[1][1])));
+                v1 = (((v1 <= 2) != (45 - v2)) <= ((a1[1][12] % 5) <= (i1 ? i0 : v3)));
+                a1[3][6] = (((v3 || v2) && (52 - i0)) <= ((i0 || v0) == (v0 < i1)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a0[2] = (((v2 >= a0[14]) * (v3 == v3)) * ((a0[3] == 5) * (v1 && a0[11])));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((i3 - v3) - (v1 - v1)) >= ((i3 ? v0 : v1) / 4));
+                    v2 = (((a1[3][5] == v3) % 5) <= ((v2 <= a1[0][9]) + (a1[0][14] != v0)));
+                    v0 = (((v3 == 15) * (v0 * v3)) / 5);
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            a0[6] = (((a0[11] != v2) == (a0[14] > v1)) == ((v0 / 9) && (a0[11] + a1[1][2])));
+            a1[0][9] = (((i2 - v2) ? (v0 ? 59 : a0[3]) : (92 / 2)) * ((v0 % 7) >= (a0[7] && v3)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v1 = (((v1 + 79) && (88 && 81)) >= ((v2 >= 14) && (v1 ? a1[2][11] : v1)));
+    return (((a1[2][11] - v1) && (a1[2][14] / 5)) + ((v1 && 80) ? (a0[0] != v0) : (v1 || a1[0][6])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,142 @@
+int f0() {
+    int v0 = 81;
+    int v1 = 78;
+    int v2 = 88;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[13] > 89) >= (v3 ? v1 : v0)) + ((a0[6] <= v3) != (v3 <= v2)))) {
+        a0[6] = (((v3 != 28) <= (v1 - v3)) ? ((55 - 55) ? (v1 && v3) : (v0 / 6)) : ((50 ? v3 : a1[3][10]) > (a0[11] <= v0)));
+        a1[2][1] = (((v2 == v2) % 2) >= ((v0 <= 60) - (a1[0][4] % 5)));
+        v1 = (((v1 - 50) % 4) == ((a0[3] >= v2) || (v1 * v3)));
+    } else {
+        v0 = (((31 <= 36) ? (v3 ? v2 : v0) : (14 && a1[1][2])) - ((v2 != v2) != (v1 == a1[1][5])));
+        v0 = (((a0[14] / 1) - (v2 == v2)) <= ((v3 >= 10) > (57 / 6)));
+        a0[15] = (((a1[0][4] < v2) ? (v2 <= 63) : (v2 + v0)) ? ((v3 - v1) < (88 - 78)) : ((a0[8] + 45) == (a0[0] < a1[1][10])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v2 <= v2) + (v0 * a1[3][7])) || ((v3 ? v0 : a1[3][9]) ? (69 < 19) : (v2 > a0[10])));
+            {
+                int i1 = 0;
+                do {
+                    a0[12] = (((v3 % 7) > (51 != v1)) < ((i1 >= 85) >= (a1[2][7] - 72)));
+                    v1 = (((i0 ? v0 : v3) % 4) == ((99 >= i0) || (28 / 6)));
+                    a0[11] = (((v1 ? a0[11] : v1) / 3) && ((v0 + a0[6]) >= (v2 <= v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((4 < 72) >= (v0 - v3)) > ((i0 % 1) > (22 / 3)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a1[0][15] = (((a1[1][6] % 4) % 2) && ((47 ? v3 : a1[2][15]) && (i3 >= i3)));
+                v2 = (((v3 == v3) == (i3 <= 87)) ? ((a1[1][3] == 70) || (a1[2][0] > a1[3][14])) : ((72 ? 26 : a0[13]) <= (57 ? i3 : 19)));
+                a1[0][2] = (((v1 < v0) && (a1[2][14] + v1)) * ((60 + v3) >= (i3 % 3)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        a1[2][10] = (((a1[2][2] || v0) != (14 / 2)) == ((a1[0][4] - v1) / 5));
+        a1[2][10] = (((i2 > i2) * (a0[15] % 2)) || ((v1 > v1) ? (v1 ? 13 : v2) : (v2 < 50)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((a0[8] + a1[3][8]) > 77) break;
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                v0 = (((v3 < 34) - (a0[10] > a1[3][10])) < ((v0 ? i5 : i5) + (a0[6] % 9)));
+                a1[0][13] = (((i5 != v1) / 6) == ((v1 / 6) / 6));
+                v3 = (((a1[2][11] >= i4) && (v0 <= i5)) < ((v2 || 14) + (a0[13] <= v2)));
+                i5 = i5 + 1;
+            }
+        }
+        v0 = (((v0 <= 86) / 7) < ((a1[2][7] != a0[3]) || (a0[12] <= v0)));
+        v3 = (((26 >= v3) * (a1[0][3] * 48)) ? ((a1[2][4] || i4) || (a1[1][12] < a1[0][13])) : ((v2 + i4) ? (v1 != v3) : (53 >= a0[1])));
+    }
+    v3 = (((2 / 4) != (v1 != v2)) && ((a1[1][4] * v3) + (a0[6] != v0)));
+    return (((a0[9] / 5) ? (v1 > a0[10]) : (6 && v3)) / 3);
+}
+int f1() {
+    int v0 = 79;
+    int v1 = 14;
+    int v2 = 50;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 - a0[1]) - (a0[13] < 77)) != ((v1 + a1[3][2]) ? (41 ? v0 : a1[3][2]) : (v2 / 9)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v3 = (((v1 % 6) < (62 != a1[3][13])) && ((i0 >= 86) % 4));
+            a1[2][10] = (((69 > a0[9]) - (a1[3][12] >= i1)) < ((74 * v3) >= (a1[3][9] % 7)));
+            v2 = (((a1[1][0] <= a1[2][4]) ? (40 || a0[6]) : (18 / 2)) * ((i0 == i1) == (v3 || v1)));
+        }
+        v0 = (((v2 > 95) > (v1 < 17)) >= ((a0[15] < a0[13]) > (i0 / 3)));
+        v0 = (((v1 / 9) < (v2 ? v1 : v3)) > ((19 > v3) < (a0[8] / 3)));
+    }
+    v2 = (((v2 || v2) == (a1[2][6] || a1[1][0])) <= ((63 > v1) < (44 > 58)));
+    a0[15] = (((2 || v3) || (36 == v2)) ? ((a1[0][14] == v1) + (a1[0][6] ? 40 : a1[2][14])) : ((v1 - v0) + (v1 ? a0[8] : v0)));
+    if ((((a1[1][12] + 77) > (a1[0][9] != v3)) + ((70 / 2) % 2))) {
+        v3 = (((8 % 1) - (v2 && a0[5])) % 3);
+        a0[7] = (((44 / 3) != (v0 - v1)) == ((a0[2] ? 65 : v2) % 9));
+        a1[3][15] = (((a0[12] >= v2) == (v1 != v3)) > ((a1[2][0] + v0) % 2));
+    } else {
+        a1[0][13] = (((v3 <= v2) && (v1 <= v0)) > ((v1 == v1) < (v1 && 30)));
+        v0 = (((60 < v3) / 3) == ((v0 / 1) >= (v3 * a0[5])));
+        a0[11] = (((a1[1][2] ? v2 : a1[3][7]) + (v2 && a1[2][4])) % 9);
+    }
+    return (((78 + v1) / 1) * ((v1 / 4) + (v2 > v1)));
+}
+int f2() {
+    int v0 = 1;
+    int v1 = 82;
+    int v2 = 42;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    if ((((56 == v0) ? (v3 < v1) : (31 == v2)) ? ((v2 == v1) == (v0 - v0)) : ((v0 < v1) == (v1 % 4)))) {
+        v2 = (((v1 + 22) ? (a1[3][5] - a1[0][12]) : (v0 >= a1[1][9])) == ((22 ? 25 : v3) - (v0 && v1)));
+        v1 = (((29 != a1[1][1]) ? (v0 != 4) : (v3 != v3)) || ((v1 != a1[1][0]) && (a1[0][3] ? 72 : 59)));
+        a0[13] = (((22 - v2) - (a1[1][14] < v0)) < ((17 - a0[11]) ? (v0 - v3) : (v2 <= v1)));
+    } else {
+        v2 = (((v3 * a0[15]) == (a0[9] >= 39)) != ((v1 < a1[0][5]) ? (a1[3][3] || 61) : (v2 ? v1 : 42)));
+        v0 = (((97 ? v2 : a1[0][5]) % 7) || ((a0[2] / 2) >= (19 == 32)));
+        v0 = (((v1 * v3) * (v1 <= v2)) * ((v0 <= v3) - (v2 > a1[3][11])));
+    }
+    if ((((a1[1][1] <= a1[1][15]) * (v0 ? a1[2][6] : v0)) == ((61 < a0[10]) && (68 / 8)))) {
+        v3 = (((v2 == 4) != (a0[14] / 3)) < ((a1[1][14] + 84) == (v3 >= a0[13])));
+        v1 = (((v2 > a0[14]) - (v1 > v2)) == ((v0 >= a1[2][6]) * (v0 % 5)));
+        a0[8] = (((v1 / 3) ? (v1 >= 36) : (70 || v2)) + ((28 != 88) % 8));
+    } else {
+        v0 = (((v1 || 86) < (v3 != v0)) / 8);
+        a1[2][1] = (((v0 < v1) % 3) - ((v2 && a0[2]) % 4));
+        a0[10] = (((v0 * a1[3][9]) >= (v0 < a0[5])) ? ((v1 ? a0[11] : a1[2][5]) ? (v3 + 29) : (v1 % 5)) : ((v0 * v2) ? (v1 != v3) : (a0[4] - v3)));
+    }
+    if ((((54 + v1) != (v1 ? 83 : 52)) ? ((64 + a0[1]) / 6) : ((v3 != 21) < (v3 * v0)))) {
+        v3 = (((23 || a1[3][11]) / 3) + ((a1[2][7] % 6) > (v3 && 69)));
+        v2 = (((v3 ? v3 : a0[10]) <= (a1[2][2] / 7)) && ((v0 ? v2 : v0) != (v1 ? 64 : a1[0][3])));
+        v2 = (((a1[0][10] * v3) <= (v1 == v0)) * ((v3 * a0[4]) * (a0[7] >= v3)));
+    } else {
+        a1[2][6] = (((v3 && v0) / 9) * ((a0[6] <= v3) ? (v2 || v1) : (a1[2][13] + v1)));
+        v2 = (((a1[3][13] * v1) > (a0[5] * v2)) <= ((v0 > a1[2][2]) <= (v2 - v1)));
+        a0[4] = (((a1[3][8] && v0) == (95 ? v1 : 91)) ? ((a1[1][4] >= a1[3][8]) > (v0 ? a0[7] : v2)) : ((v0 != v0) / 5));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a0[8] = (((a0[1] || a0[9]) > (v3 ? v3 : v2)) ? ((a1[2][3] + 39) == (v0 <= a1[3][8])) : ((v1 - 65) ? (a0[0] + v2) : (a1[0][11] && a0[13])));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v3 = (((v2 + a0[0]) / 6) && ((v0 >= a1[1][7]) + (i1 > i0)));
+            v0 = (((v2 <= v2) / 2) >= ((v0 > i1) >= (v1 % 6)));
+            a0[6] = (((32 <= 76) - (i1 >= v2)) > ((i1 / 7) == (v3 - 61)));
+        }
+        a0[10] = (((64 && a1[3][15]) % 9) + ((a0[6] ? a0[0] : v3) > (a1[1][11] >= i0)));
+    }
+    a1[3][6] = (((v2 ? v0 : 71) - (v0 ? 16 : v2)) >= ((v0 < v0) - (a1[0][13] == v0)));
+    return (((a0[12] == 7) == (v3 <= 85)) ? ((53 / 2) < (a0[2] || v3)) : ((a1[1][15] + a0[9]) ? (91 && a1[1][8]) : (v1 + v0)));
+}
+int main() {
+    return 0;
+}
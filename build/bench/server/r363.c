@@ -0,0 +1,46 @@
+int f0() {
+    int v0 = 42;
+    int v1 = 53;
+    int v2 = 84;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[9] - v2) % 7) > ((a1[0][2] >= v0) != (74 / 8)))) {
+        v1 = (((v1 ? v3 : a0[3]) * (v0 % 3)) / 8);
+        v0 = (((a0[5] == v1) - (55 || a1[2][8])) >= ((a0[12] <= v3) > (v1 * v3)));
+        a1[1][9] = (((4 % 3) + (v3 || v1)) == ((v1 / 8) / 8));
+    } else {
+        v3 = (((62 == 96) != (a0[13] ? a1[2][14] : 25)) || ((v0 ? 11 : v3) == (46 / 4)));
+        a1[0][11] = (((a0[4] && v2) > (a0[8] + v2)) || ((v0 > a1[1][1]) && (v3 || v1)));
+        v3 = (((39 == a1[2][0]) * (47 && v0)) ? ((92 + v3) < (v3 || a0[3])) : ((v2 <= v0) ? (v3 == v0) : (v2 - a0[0])));
+    }
+    a0[8] = (((v0 >= v0) > (v1 + 21)) - ((a0[4] % 1) != (v0 - v1)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((39 + a1[2][3]) > 60) break;
+        {
+            int i1 = 0;
+            do {
+                a1[2][2] = (((v1 < a1[3][6]) >= (v2 / 5)) <= ((5 > 87) / 8));
+                v3 = (((v2 / 9) >= (70 * v2)) < ((v0 < i1) / 6));
+                a1[2][5] = (((i1 % 6) != (92 && i1)) * ((25 >= 45) - (9 ? a1[1][4] : 7)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v1 = (((v2 == 24) + (a1[3][4] || v2)) * ((a1[1][7] <= a0[12]) == (v1 / 4)));
+        a1[0][12] = (((v0 ? i0 : v2) - (v1 != 42)) + ((26 == v2) >= (i0 > 53)));
+    }
+    v3 = (((a1[2][0] ? 41 : 28) != (75 + v1)) && ((v1 % 5) % 5));
+    if ((((98 >= v1) == (59 <= v1)) || ((a1[0][0] ? 65 : a1[1][15]) && (72 + 62)))) {
+        v1 = (((a0[13] ? a1[3][1] : v3) < (v0 != a0[5])) >= ((v2 != v3) != (v0 / 3)));
+        a1[0][10] = (((a0[7] > v1) <= (a0[11] <= v2)) <= ((v0 >= v0) <= (v3 - a0[13])));
+        a1[3][14] = (((v2 <= a1[1][3]) <= (v1 && 64)) < ((v0 || 55) <= (84 % 7)));
+    } else {
+        v3 = (((83 <= a1[2][4]) == (v2 ? v3 : a1[0][15])) >= ((v2 >= 7) < (18 >= v1)));
+        a1[2][7] = (((v0 * a1[1][1]) - (v1 != a0[14])) <= ((v0 != v3) * (57 && v2)));
+        a0[7] = (((v3 ? a0[3] : a0[13]) * (a0[6] && v2)) == ((v1 && v3) != (72 - v3)));
+    }
+    return (((54 == 57) - (v2 >= v2)) == ((v0 == v1) > (a1[0][2] > v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,131 @@
+int f0() {
+    int v0 = 18;
+    int v1 = 36;
+    int v2 = 25;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((i1 * v1) > 74) break;
+                    v2 = (((v2 % 9) > (i0 % 4)) == ((i1 <= v1) > (v2 && 53)));
+                    v2 = (((a0[12] || i1) || (41 >= i1)) / 2);
+                    v2 = (((a0[5] ? i0 : a1[0][0]) / 3) > ((a1[3][9] % 7) != (i1 && v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][14] = (((98 >= a1[3][9]) >= (v0 ? i0 : 78)) ? ((v3 >= v0) && (a0[3] % 9)) : ((a0[6] || v3) / 1));
+            v3 = (((a0[15] % 8) ? (v2 && 75) : (23 - v1)) * ((i0 + v2) ? (6 != a1[1][1]) : (v1 == v0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                if ((93 * a1[3][5]) > 90) break;
+                a1[1][12] = (((a1[2][0] >= v3) ? (a1[3][8] >= a0[10]) : (i3 % 2)) + ((a0[10] || v3) - (55 && i3)));
+                v2 = (((50 >= v3) == (62 <= 8)) - ((i3 <= i2) > (v2 != a0[7])));
+                v0 = (((a0[2] != 79) < (v3 + a1[3][6])) >= ((27 >= i2) > (v3 >= v0)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((i2 == a0[14]) != (30 - v1)) || ((a0[11] < i2) - (v2 <= 30)));
+        a0[6] = (((6 ? a1[2][5] : a0[3]) / 8) >= ((26 == v2) + (v0 == 53)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a0[2] = (((a0[5] % 3) * (v2 % 5)) - ((i4 ? 91 : 7) + (2 <= a1[3][5])));
+                v0 = (((a1[3][2] <= v2) + (81 + 24)) && ((i4 / 7) == (v1 ? 88 : i4)));
+                v0 = (((a0[8] ? i4 : v1) <= (v1 * 27)) || ((v2 + v1) != (v3 >= v1)));
+            }
+            a1[2][14] = (((v1 - 53) ? (16 % 9) : (v1 <= i4)) - ((38 + 81) ? (13 % 7) : (a0[5] ? a0[9] : v3)));
+            a1[2][1] = (((i4 - v3) == (v3 % 6)) <= ((15 / 3) - (a1[2][0] < v1)));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v0 = (((a0[8] < 37) < (1 < i7)) < ((i6 ? v2 : v2) / 1));
+                a1[1][15] = (((78 <= v3) % 8) ? ((v0 % 4) ? (95 > v2) : (i7 - v0)) : ((i6 == v2) || (2 + 45)));
+                v3 = (((a0[15] ? a0[11] : v0) != (v2 && v1)) == ((v0 || i7) - (70 * a0[4])));
+                i7 = i7 + 1;
+            } while (i7 < 4);
+        }
+        a1[1][4] = (((v0 ? 80 : v3) % 2) ? ((i6 ? 64 : a0[0]) == (v1 ? i6 : v0)) : ((v3 || a0[8]) + (v3 / 4)));
+        a1[1][6] = (((v2 - i6) ? (a1[2][0] <= 27) : (v1 ? i6 : 42)) - ((a1[0][6] <= a1[3][1]) ? (v3 < 37) : (v0 % 8)));
+    }
+    if ((((79 + v1) || (v0 <= a0[12])) + ((v0 || v1) % 8))) {
+        v1 = (((v1 != v2) <= (v0 || v3)) < ((74 < a0[9]) != (v2 && v1)));
+        a1[1][9] = (((a0[9] > v2) + (v2 >= v2)) != ((56 + a0[0]) * (38 || a0[5])));
+        v1 = (((59 == a0[15]) != (a1[3][9] <= v3)) % 4);
+    } else {
+        a1[3][3] = (((v3 / 1) - (a1[2][14] < v0)) || ((v3 && v0) ? (v0 / 4) : (v1 >= a0[12])));
+        v2 = (((67 > v3) >= (61 ? v3 : a0[4])) >= ((v3 + a0[4]) - (8 >= 49)));
+        v0 = (((88 * 48) / 7) ? ((v3 < a1[3][4]) - (a1[1][14] && a0[10])) : ((a1[3][13] >= v0) ? (v1 ? a0[5] : v3) : (v3 ? v1 : v3)));
+    }
+    return (((98 + v3) - (17 == 47)) || ((v0 ? a0[4] : v2) ? (84 == v1) : (v1 == v2)));
+}
+int f1() {
+    int v0 = 2;
+    int v1 = 98;
+    int v2 = 41;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[0][14] == v3) / 3) || ((a0[12] * 98) ? (v2 < a1[2][1]) : (v3 + v3)));
+    v2 = (((a1[3][14] || v2) * (v3 - v1)) > ((v2 * v1) ? (v1 <= v3) : (a1[1][3] ? a0[3] : 99)));
+    if ((((v1 ? a0[4] : v1) - (v0 <= v0)) % 4)) {
+        a1[2][0] = (((v2 && 6) * (61 % 9)) < ((v3 <= 99) <= (7 > v3)));
+        a0[7] = (((a1[1][1] && a1[3][13]) % 4) / 3);
+        a1[2][11] = (((32 != a1[0][11]) % 5) >= ((5 ? v0 : a0[11]) ? (94 + a0[0]) : (v3 != a1[3][14])));
+    } else {
+        a1[3][2] = (((79 * v0) || (10 % 4)) <= ((a0[2] >= v0) / 6));
+        v1 = (((v3 % 9) != (v1 < v1)) >= ((v0 ? a0[2] : v3) <= (a1[1][7] == 42)));
+        v0 = (((v0 % 8) * (a1[2][15] >= 56)) % 8);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((a1[3][5] >= i0) > 63) break;
+            v0 = (((20 == 37) ? (39 > v0) : (a0[11] - v1)) == ((i0 <= v2) && (65 ? a1[0][13] : v3)));
+            v1 = (((45 > a0[0]) ? (v0 && v2) : (v0 < 38)) && ((v2 != v0) >= (48 >= i0)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((31 ? 16 : v3) > 65) break;
+                a1[1][9] = (((v3 / 1) % 3) >= ((a1[0][4] % 9) + (v1 + v2)));
+                v0 = (((v2 * a1[2][0]) % 9) == ((v2 % 7) != (a1[2][13] ? v2 : 71)));
+                v3 = (((v0 ? 30 : a0[1]) * (11 != 15)) >= ((72 || v1) == (76 / 3)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[7] = (((v3 * v1) < (v2 != i2)) != ((v0 % 3) >= (a0[7] && 89)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a1[1][7] % 3) < (29 / 7)) / 4);
+                    a0[8] = (((a0[10] ? v2 : v0) ? (v0 - v1) : (i2 && v2)) != ((v3 >= 52) ? (a1[3][4] % 1) : (58 < v0)));
+                    v3 = (((a0[4] <= a1[0][0]) ? (a1[2][8] <= v0) : (i2 || i2)) != ((v3 - 35) != (a0[3] && 54)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            a0[13] = (((a0[15] != v3) < (v0 / 6)) && ((a1[0][3] >= a1[1][14]) < (v1 > v2)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    return (((51 && a1[0][8]) || (14 >= 95)) || ((a0[1] > v3) > (v3 == 10)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,170 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 85;
+    int v2 = 46;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    if ((((15 != v1) * (v2 || a1[2][5])) % 3)) {
+        a0[7] = (((a0[1] % 1) >= (v2 - v3)) < ((v3 % 3) == (v3 * v3)));
+        a0[10] = (((61 * v0) - (v0 % 9)) <= ((v1 ? a1[3][11] : a1[2][3]) % 7));
+        a0[7] = (((v1 ? a0[0] : 54) && (v2 && v2)) == ((68 * v3) * (73 ? 50 : v1)));
+    } else {
+        v1 = (((v2 - a1[1][4]) > (v2 * v2)) ? ((a1[1][2] % 7) / 7) : ((v3 || v1) || (17 != v2)));
+        v0 = (((81 != a1[1][10]) / 4) != ((v3 == a1[2][5]) - (v0 % 9)));
+        v0 = (((13 && 51) ? (a0[1] % 2) : (23 != v2)) && ((v1 < a1[1][11]) >= (a1[0][8] ? v0 : v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((v1 - v1) && (i0 ? a1[3][0] : 15)) % 3);
+            a1[0][15] = (((a1[3][13] >= a0[5]) < (13 - v3)) == ((i0 * 81) + (a0[3] + a0[7])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((a1[2][12] * a1[1][0]) > 97) break;
+                v1 = (((v1 / 4) > (18 > a1[3][8])) ? ((a1[0][5] || i0) < (37 && 69)) : ((v1 != v2) != (i1 - v1)));
+                v2 = (((a0[3] <= i1) + (v3 * i0)) <= ((v2 < i0) < (v1 > a1[3][6])));
+                a1[1][7] = (((i1 ? 57 : i0) ? (v0 % 6) : (i0 != 12)) || ((a0[2] == a1[3][11]) > (i0 >= i0)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v2 = (((56 % 7) == (a1[3][13] * 11)) * ((a0[7] == 99) <= (a0[4] < 5)));
+                v3 = (((v1 < v3) ? (86 > v1) : (54 != v3)) != ((v1 ? v3 : v2) == (i3 ? v1 : 52)));
+                v0 = (((v0 && 23) > (85 ? v0 : v1)) == ((v0 % 9) <= (87 + v0)));
+            }
+            v3 = (((v3 != a0[7]) >= (i2 - v3)) && ((a1[2][9] == v1) ? (v2 <= 98) : (v3 ? a0[10] : a1[0][8])));
+            v3 = (((v3 || v2) ? (i2 != 74) : (a1[1][13] % 4)) > ((a0[14] % 3) ? (a0[10] % 7) : (45 == 78)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v2 = (((v1 >= v3) < (64 < v3)) / 7);
+    if ((((a0[8] != 58) + (v0 < 65)) <= ((a0[15] || a1[2][8]) + (a1[0][8] || v1)))) {
+        v3 = (((77 ? 26 : v2) != (50 * v0)) <= ((v0 ? v1 : v0) || (v0 % 2)));
+        v3 = (((50 * 90) / 8) % 8);
+        v3 = (((13 <= a0[2]) > (93 ? v3 : 36)) && ((84 / 9) && (76 ? v0 : v3)));
+    } else {
+        a1[0][3] = (((v3 > 1) % 7) + ((93 != v0) ? (a0[10] != a0[10]) : (v2 ? a1[1][7] : v1)));
+        v1 = (((v0 == v2) && (v1 >= 59)) / 1);
+        v1 = (((v3 >= v1) == (v0 + a1[1][15])) >= ((v1 / 4) != (24 > v1)));
+    }
+    return (((v0 < v0) <= (v1 * v1)) < ((a0[14] && 63) ? (87 ? v0 : a0[8]) : (v3 % 4)));
+}
+int f1() {
+    int v0 = 14;
+    int v1 = 33;
+    int v2 = 0;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v3 - v1) < (v3 ? v2 : a0[0])) <= ((97 % 4) > (v0 % 6)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((82 == 61) <= (a1[0][0] <= 88)) <= ((a0[14] ? a1[2][6] : a0[13]) > (i0 ? 68 : 65)));
+            a1[2][12] = (((i0 - 48) <= (a0[12] >= a0[13])) < ((i0 || 17) || (27 && v3)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((a1[1][15] + a1[3][10]) >= (a0[1] != a1[2][11])) <= ((2 + v1) / 7));
+                    v3 = (((i0 == a0[5]) >= (v0 > v3)) != ((v1 < i1) <= (i1 >= a0[5])));
+                    a0[2] = (((a1[2][13] == v3) / 8) % 1);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v1 || a0[14]) + (a0[13] <= v2)) * ((95 / 6) / 8))) {
+        a0[6] = (((40 + 64) - (v0 % 7)) * ((v1 / 7) != (v0 % 4)));
+        v3 = (((v0 || v3) * (v0 ? 81 : a0[2])) ? ((a1[1][8] < a0[10]) * (a1[1][0] < v2)) : ((v3 <= a1[1][2]) != (a0[9] ? 66 : v1)));
+        a1[1][3] = (((v2 > 17) < (78 >= 13)) || ((34 / 1) || (30 ? v2 : v0)));
+    } else {
+        a0[14] = (((26 ? 8 : v1) - (a0[8] >= 59)) - ((v0 * v0) * (v2 / 9)));
+        v2 = (((v0 < v0) < (v2 == v3)) ? ((v0 != v0) < (v2 || 71)) : ((83 || v2) + (v0 || 55)));
+        v2 = (((v3 <= 61) > (a0[10] > v2)) - ((a1[0][13] <= v2) < (34 < a0[10])));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((v3 ? i2 : v0) > (57 <= 69)) >= ((78 / 2) >= (v1 != v2)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((v1 >= v3) > 68) break;
+                a1[0][15] = (((i2 - 51) + (85 ? a1[1][4] : v1)) - ((a0[14] ? 5 : i3) * (v3 % 6)));
+                v1 = (((v1 == i2) ? (i3 < v2) : (v0 ? v3 : 28)) || ((a1[1][4] < v0) == (a0[6] / 6)));
+                v0 = (((i2 / 4) < (61 ? 65 : i2)) + ((a0[6] <= v3) < (63 < v1)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[0] = (((36 ? 94 : 71) - (v0 && 88)) >= ((i2 >= v0) && (a1[2][4] * a1[1][3])));
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        if ((v3 % 7) > 62) break;
+        a0[12] = (((51 <= v2) > (a0[14] < i4)) ? ((a0[4] * a1[1][4]) ? (v0 >= v2) : (57 == v2)) : ((a1[2][13] ? v0 : i4) != (a1[3][7] <= 10)));
+        v2 = (((v1 < a1[3][9]) <= (a0[5] < v2)) ? ((v3 > a0[2]) % 1) : ((i4 || v2) / 7));
+        {
+            int i5 = 0;
+            do {
+                a0[4] = (((v2 <= a0[4]) * (17 < v1)) < ((13 + a1[2][3]) <= (6 == v2)));
+                v1 = (((v0 * v1) <= (3 < 14)) != ((48 || 23) < (69 + v2)));
+                a0[3] = (((v1 && i4) / 7) >= ((a1[2][1] + v3) > (v0 ? v1 : v2)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+    }
+    return (((v0 + v0) != (v3 && v1)) < ((a1[1][1] > v2) == (v1 - v2)));
+}
+int f2() {
+    int v0 = 93;
+    int v1 = 54;
+    int v2 = 35;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a1[2][2] > a1[3][5]) || (v0 >= a0[3])) < ((v1 > a0[0]) % 1));
+    if ((((v0 > 14) - (99 + a1[3][11])) * ((v3 ? 53 : a1[1][13]) / 2))) {
+        v1 = (((a1[1][7] && a0[4]) / 8) >= ((66 + v3) && (v2 || v1)));
+        v0 = (((v0 || v3) % 4) || ((a1[1][4] >= v3) / 1));
+        v3 = (((v3 ? 26 : a1[3][3]) && (40 == v1)) && ((a0[2] - v2) <= (a0[8] == v3)));
+    } else {
+        a1[0][1] = (((v1 ? 43 : 49) * (v2 - v3)) + ((v2 == v3) <= (v3 || a1[0][12])));
+        a0[15] = (((a1[1][13] / 6) || (a1[0][7] / 2)) % 5);
+        a0[4] = (((a1[0][4] ? a1[1][12] : v1) == (v2 <= a1[0][14])) < ((a1[1][1] || 90) * (0 && v2)));
+    }
+    v1 = (((74 == 24) < (v2 <= v1)) || ((a1[0][8] != v0) < (v1 * 40)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((i0 ? 48 : a0[7]) > 73) break;
+                a0[10] = (((v2 % 2) ? (77 * v0) : (v2 != v3)) + ((81 ? v0 : v1) != (a1[2][14] <= 1)));
+                a1[1][14] = (((a1[2][0] ? a0[11] : 95) ? (v3 ? 49 : a1[1][4]) : (v1 / 5)) * ((a1[0][4] > v1) >= (a1[1][10] * 26)));
+                a0[12] = (((1 + i0) >= (i1 ? i0 : i1)) && ((a0[11] * v0) >= (v2 < a1[3][4])));
+            }
+            a1[2][1] = (((v0 != a0[8]) ? (a0[1] % 9) : (a1[2][1] - v2)) % 9);
+            v3 = (((v1 > 13) <= (v3 == v1)) ? ((26 < a0[5]) >= (42 <= 38)) : ((52 ? 84 : v1) * (i0 ? 29 : v2)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[3] >= i2) > 79) break;
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v3 = (((i2 % 7) * (a0[2] ? a1[1][0] : 78)) == ((74 > v1) > (i2 && v1)));
+                v3 = (((a0[13] && i2) * (a0[1] != a0[6])) + ((v1 >= v2) && (a0[3] - 55)));
+                a0[5] = (((i2 >= v1) == (a1[1][8] * i3)) / 5);
+            }
+            a1[3][11] = (((27 != 36) > (86 < v0)) - ((i2 && 89) ? (i2 > v0) : (v0 % 1)));
+            a1[0][3] = (((v2 ? 96 : a0[3]) + (a0[15] + 24)) * ((a0[8] || a1[1][10]) && (v1 == 73)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((a0[15] * v2) ? (v3 < v1) : (v0 && v0)) < ((v3 / 5) == (25 && a1[0][10])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,33 @@
+int f0() {
+    int v0 = 54;
+    int v1 = 43;
+    int v2 = 40;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a0[1] = (((95 > v2) > (a1[1][15] / 3)) >= ((i0 ? v1 : 0) < (a1[3][13] / 8)));
+        a1[1][12] = (((89 || v3) <= (i0 && v3)) + ((v1 >= v1) % 2));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v1 = (((i1 * i1) ? (v1 != v1) : (v2 % 2)) != ((a0[5] + v2) >= (v0 < a0[5])));
+            v3 = (((v3 && v3) / 8) && ((v2 <= 21) ? (a0[2] ? a0[9] : i0) : (i0 + v1)));
+            v3 = (((v2 % 2) <= (i1 || a0[13])) + ((v0 ? v3 : v0) % 1));
+        }
+    }
+    if ((((v3 / 3) * (v2 && a1[2][2])) == ((17 ? 2 : v0) == (v3 > v3)))) {
+        v3 = (((v1 + v3) || (v0 >= a0[1])) > ((a1[3][10] || v1) % 3));
+        a1[2][6] = (((v0 % 6) % 6) > ((v1 || v2) >= (v3 * v2)));
+        v0 = (((66 + 92) ? (72 ? v0 : 21) : (v0 / 2)) >= ((35 ? v2 : 83) / 3));
+    } else {
+        v0 = (((90 / 9) || (93 % 4)) && ((35 >= v0) - (37 + v2)));
+        v3 = (((36 >= v0) * (43 > 49)) * ((v2 != a1[2][5]) > (v3 == 86)));
+        v2 = (((v0 ? v0 : a0[2]) != (57 - 35)) && ((v2 >= 91) && (a0[15] + v0)));
+    }
+    v2 = (((a0[9] ? v3 : a1[1][1]) == (5 < v3)) % 8);
+    a1[2][2] = (((v1 || a0[15]) + (v3 >= a0[8])) <= ((v0 > v1) != (v1 ? 93 : 83)));
+    v3 = (((a1[1][11] > v2) / 6) + ((v3 % 5) <= (a0[8] == 5)));
+    return (((37 * a0[9]) != (a0[6] ? 61 : v1)) * ((a1[1][6] == 33) / 8));
+}
+int main() {
+    return 0;
+}
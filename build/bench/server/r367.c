@@ -0,0 +1,134 @@
+int f0() {
+    int v0 = 77;
+    int v1 = 25;
+    int v2 = 64;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 == v2) <= (a1[0][9] ? 76 : v1)) == ((64 / 1) || (41 * v1)))) {
+        a0[4] = (((44 + 43) / 9) + ((v1 - a0[8]) > (v1 + v1)));
+        a1[1][7] = (((1 > a0[3]) == (a1[1][11] ? a1[3][4] : a1[2][0])) <= ((37 - 80) + (v3 / 1)));
+        v2 = (((52 + a1[1][14]) ? (v1 || v2) : (v0 && a0[8])) < ((v1 ? v1 : v3) - (a1[2][11] && v3)));
+    } else {
+        a0[5] = (((a1[1][0] && a1[0][5]) > (v0 && a0[15])) >= ((v0 ? a0[9] : a0[6]) - (a0[8] >= 82)));
+        a1[2][1] = (((86 <= v3) - (a1[2][2] != a0[10])) ? ((v3 != a1[2][3]) >= (30 == a1[3][1])) : ((v0 != v0) ? (v3 + a1[0][1]) : (v2 + a0[9])));
+        v0 = (((38 - v0) && (a1[2][2] <= 43)) || ((v1 == v1) < (a1[3][1] < 34)));
+    }
+    v0 = (((a1[2][5] <= 8) < (v1 >= v1)) ? ((v3 >= a0[6]) ? (v0 <= a0[14]) : (a0[12] * v2)) : ((v1 >= v2) - (v3 ? v0 : 49)));
+    if ((((v3 == v0) == (47 / 8)) - ((v1 ? v3 : a1[1][10]) && (v2 + 12)))) {
+        v3 = (((23 == a1[0][14]) ? (v0 ? v1 : 4) : (v0 || v3)) ? ((a1[3][3] >= v0) && (85 + v3)) : ((81 ? a0[4] : v3) || (a0[2] * v0)));
+        a1[0][3] = (((95 % 1) ? (a0[8] && a1[3][5]) : (v0 ? v1 : a0[0])) * ((v1 <= a0[15]) >= (a0[2] == 78)));
+        a0[11] = (((v0 == a1[2][7]) <= (v3 % 2)) - ((a1[1][8] > 62) + (v0 / 2)));
+    } else {
+        a0[11] = (((a0[15] > v0) == (30 > a0[12])) < ((96 / 8) ? (a0[13] % 8) : (a0[0] == v2)));
+        a0[11] = (((a1[1][0] ? 97 : v3) ? (a0[10] || 84) : (v1 == v0)) == ((67 / 7) <= (v2 || 74)));
+        a0[11] = (((a0[10] || 4) > (v1 ? v1 : a0[14])) != ((92 / 4) < (73 || a0[13])));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        a1[2][12] = (((v0 * v1) / 9) != ((i0 + i0) ? (a0[13] - a1[3][11]) : (v2 || v2)));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v1 = (((v3 < 36) > (v3 / 3)) / 9);
+                v3 = (((i1 <= i1) && (32 ? v1 : 95)) * ((i0 - i1) + (v3 < i0)));
+                v1 = (((v1 >= 20) == (v2 * 0)) + ((v1 || 46) == (a1[2][8] || 57)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((46 != v3) ? (v3 && 74) : (i0 - v3)) || ((a0[3] <= a0[11]) / 3));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v2 = (((i2 == v0) && (a0[14] >= 30)) >= ((a1[2][12] / 8) > (i2 / 9)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((v1 * v3) > 98) break;
+                v2 = (((v3 == i2) >= (a1[1][9] - i2)) > ((87 < a0[0]) ? (i2 || a0[14]) : (v3 >= v1)));
+                v2 = (((i3 - v1) != (76 / 4)) ? ((v2 ? a0[6] : v2) >= (a0[11] * i2)) : ((v0 ? a1[0][12] : v0) >= (a1[0][9] || i2)));
+                v1 = (((v1 > a1[2][3]) / 6) < ((a0[6] == i2) >= (v2 % 2)));
+            }
+            a0[6] = (((v2 % 9) >= (a1[1][7] / 8)) < ((i2 % 9) < (v1 == 94)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v2 % 3) ? (v2 / 3) : (v3 - v1)) && ((41 > 98) || (82 != 84)));
+}
+int f1() {
+    int v0 = 91;
+    int v1 = 12;
+    int v2 = 47;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((98 > a0[12]) > 97) break;
+            v0 = (((v1 ? i0 : v0) >= (i0 - v3)) ? ((v3 < v2) != (v0 * i0)) : ((i0 || 85) / 9));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((9 == v2) > (99 < v3)) <= ((a0[12] != a1[2][13]) * (61 + 18)));
+                    a1[3][10] = (((v1 != v3) <= (v0 * i1)) < ((v1 <= i0) - (61 % 8)));
+                    v0 = (((42 != i1) <= (6 / 9)) % 7);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a0[1] = (((47 / 8) + (84 && a1[0][7])) || ((i0 % 4) || (v2 != v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v0 = (((v2 == v2) < (7 == v3)) + ((97 > a1[3][10]) ? (v3 >= a0[14]) : (v2 - v3)));
+                v1 = (((46 ? i2 : i3) ? (v0 % 4) : (a1[1][0] != a0[10])) ? ((a0[2] > v3) < (30 && v0)) : ((6 != 39) > (a0[10] ? v3 : v2)));
+                v1 = (((19 >= a1[2][4]) > (i2 + 63)) ? ((v3 == v0) >= (i2 || 78)) : ((68 != v3) * (i3 ? v3 : a1[3][7])));
+            }
+            v2 = (((74 * i2) - (v3 / 7)) == ((a1[3][14] < 78) >= (v3 + a0[9])));
+            v3 = (((v3 <= a0[10]) % 8) + ((a0[14] || a0[12]) - (v0 <= v1)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v3 == 95) == (a1[1][11] > v3)) != ((3 < a0[2]) == (v3 != a0[6])));
+            v2 = (((a0[0] ? v0 : a1[0][15]) || (a0[8] && v1)) * ((v3 - 55) % 3));
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v0 = (((a1[1][6] > i5) <= (10 > v1)) ? ((v3 == 7) || (a0[6] == 67)) : ((v2 ? v0 : a1[3][3]) % 1));
+                    a0[1] = (((69 > 50) / 8) && ((a1[1][2] - 84) <= (v1 || v2)));
+                    v3 = (((v3 != v3) != (v2 / 9)) >= ((a1[3][11] < 20) % 2));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    if ((((v2 != 58) * (v3 > 38)) <= ((a1[3][5] * v2) * (v2 < 59)))) {
+        v2 = (((a0[9] % 2) ? (v1 && a0[11]) : (v3 != v0)) ? ((v3 < 60) / 2) : ((v0 ? a0[10] : a0[13]) ? (v2 ? v0 : v2) : (v0 >= 4)));
+        v1 = (((a0[0] < 48) != (49 > v3)) ? ((27 - v1) * (a1[1][2] <= v0)) : ((v0 * v2) / 3));
+        v3 = (((v0 != v3) ? (v1 - a0[10]) : (57 ? v2 : v1)) + ((v2 % 6) + (12 ? v0 : a1[3][7])));
+    } else {
+        v1 = (((90 || a0[11]) <= (a1[2][0] ? a1[3][0] : v2)) ? ((v0 * a0[14]) * (v0 < 0)) : ((v2 >= a1[1][4]) - (60 && a0[6])));
+        v3 = (((a1[1][13] > 4) ? (15 % 6) : (v0 == v0)) / 2);
+        v2 = (((a0[5] - a0[8]) ? (v1 / 5) : (30 / 7)) <= ((a0[0] * v1) ? (v0 <= v0) : (v1 * 28)));
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        v0 = (((v2 < a0[4]) < (i6 + i6)) * ((70 - 96) == (v3 < a1[0][15])));
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            if ((v2 <= i7) > 64) break;
+            v0 = (((a1[3][5] ? 98 : 19) && (v0 + a0[13])) ? ((v2 ? i7 : a1[2][13]) % 7) : ((a1[1][8] && a1[0][8]) > (v0 < v0)));
+            a0[11] = (((v1 % 5) >= (68 ? 94 : a1[0][4])) <= ((a1[0][0] / 8) == (32 >= i7)));
+            v0 = (((i6 <= a0[10]) <= (a0[1] && i6)) <= ((v2 + i7) ? (47 && a1[1][14]) : (59 * v3)));
+        }
+        a1[3][11] = (((i6 != v3) && (v0 ? 0 : v2)) && ((17 / 8) || (a1[1][3] && v3)));
+    }
+    return (((87 * v2) * (v1 ? a0[0] : v1)) <= ((v3 ? v2 : 41) < (v0 ? a1[1][1] : a0[4])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,169 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 2;
+    int v2 = 61;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 <= v2) ? (88 / 4) : (v2 >= v2)) < ((63 - a0[13]) > (v3 || v3)))) {
+        v2 = (((0 && a0[8]) / 9) % 9);
+        v1 = (((v2 <= v1) + (v1 <= a0[11])) && ((v1 ? a0[12] : 44) >= (a0[8] + v1)));
+        v1 = (((a0[14] < a0[8]) % 2) || ((v3 ? v0 : v3) + (47 ? 36 : v2)));
+    } else {
+        a0[3] = (((v3 + v1) || (v0 / 9)) % 4);
+        a1[3][0] = (((a0[8] && 92) - (46 ? v3 : 59)) + ((20 ? v1 : 53) <= (21 > 52)));
+        v0 = (((a0[13] ? a0[7] : a0[14]) && (v0 >= a0[14])) != ((a1[3][14] < a0[6]) || (a0[3] + 22)));
+    }
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v1 = (((i1 < v3) ? (i1 - i0) : (i0 > 21)) / 5);
+                v0 = (((v0 <= 97) > (i1 || i0)) - ((i0 == v0) < (a0[11] <= i0)));
+                a1[2][11] = (((a0[11] % 7) || (36 > v1)) > ((v2 && 54) != (38 ? a0[2] : i0)));
+            }
+            v3 = (((a0[13] * v3) * (a1[0][6] && v1)) || ((v2 % 2) ? (i0 / 7) : (v0 >= v3)));
+            a0[5] = (((v0 ? v0 : i0) && (v1 < v3)) * ((a1[0][2] <= 2) > (12 >= i0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v0 < a0[6]) && (8 >= v2)) == ((63 * v0) / 8))) {
+        v1 = (((a0[10] <= 61) ? (a1[2][8] < v0) : (v2 > v1)) + ((v0 || v2) % 4));
+        v3 = (((v0 < v0) && (a0[3] <= 9)) > ((26 / 7) >= (v0 && a0[1])));
+        v1 = (((a1[0][13] != v2) == (a1[3][11] && a0[3])) <= ((38 <= 67) ? (v0 ? v0 : 68) : (49 ? 57 : v2)));
+    } else {
+        a0[6] = (((v3 > v3) - (v1 && v3)) || ((v1 + 0) && (a0[9] < v3)));
+        v1 = (((v3 == v0) > (v1 - v3)) + ((v0 >= v3) - (13 != a0[13])));
+        v2 = (((v1 > 48) || (86 ? v2 : v0)) <= ((v0 > v2) != (a1[0][5] / 5)));
+    }
+    v0 = (((a1[0][9] % 5) * (27 < 1)) != ((33 != a0[2]) >= (v2 || 87)));
+    if ((((v1 || a1[1][14]) == (v3 == v2)) > ((48 != a1[2][15]) ? (72 != 55) : (a0[6] && v2)))) {
+        v1 = (((a1[1][14] < v2) <= (v2 ? 77 : a1[3][5])) - ((v1 / 6) > (25 >= v2)));
+        v2 = (((v3 || a0[10]) && (v2 + a1[1][0])) && ((a0[15] * v0) / 9));
+        a1[3][2] = (((v1 % 1) == (90 != v1)) ? ((27 * 53) / 5) : ((a1[1][1] > v0) / 3));
+    } else {
+        v0 = (((89 - a1[2][8]) * (v2 <= v1)) == ((9 + v1) ? (a0[10] / 3) : (a0[14] * 57)));
+        v3 = (((a0[10] < v1) && (v2 >= 31)) + ((v1 > v0) || (73 > v0)));
+        a1[1][12] = (((v1 >= v2) <= (v3 == a1[3][4])) && ((5 && v0) + (9 < a0[12])));
+    }
+    return (((63 <= a0[2]) <= (v0 != a0[1])) <= ((a0[4] + a1[1][6]) || (4 < a0[7])));
+}
+int f1() {
+    int v0 = 81;
+    int v1 = 49;
+    int v2 = 71;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a1[3][6] ? v1 : a0[13]) > (v3 == a0[9])) + ((v0 % 5) != (v2 && v0)));
+                    v0 = (((a0[4] >= 3) / 5) + ((19 < a1[3][7]) - (a1[2][3] - v2)));
+                    a1[3][12] = (((i0 ? a0[14] : a0[6]) ? (v2 != v2) : (v0 * 17)) == ((v1 != v0) / 7));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v3 = (((v3 || v0) != (38 || 22)) / 4);
+            a1[2][11] = (((v2 ? 14 : a1[3][8]) / 8) || ((a1[3][9] + a0[15]) == (v0 - i0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v2 = (((a1[3][1] || v3) * (15 + a0[12])) == ((v1 >= a1[3][5]) ? (v2 ? v0 : v1) : (v1 + 53)));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v0 = (((i2 || i3) == (a1[2][9] % 9)) <= ((i3 / 6) == (a0[6] != a0[1])));
+                v3 = (((5 / 1) >= (i2 > a1[1][10])) * ((v0 - v1) <= (v3 + 81)));
+                a1[2][8] = (((v3 <= 57) - (62 < 78)) ? ((a0[6] == i2) % 7) : ((v0 ? v1 : v3) == (v1 ? 47 : a1[0][4])));
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((v2 >= v3) ? (57 < a0[5]) : (6 / 2)) <= ((9 % 6) >= (v0 <= v0)));
+        v2 = (((i2 == a1[0][8]) == (a0[14] != 86)) * ((v3 ? 60 : 49) && (a1[2][6] < v3)));
+    }
+    if ((((76 && v3) && (v0 - 84)) || ((v2 % 2) * (a1[0][4] && 67)))) {
+        a1[0][5] = (((v0 == a1[2][11]) >= (v0 >= a1[3][2])) * ((67 - 18) ? (v1 >= 57) : (v3 - a1[2][13])));
+        a0[15] = (((51 && a1[1][10]) <= (25 && v3)) - ((a1[3][4] || 6) != (v3 - a0[9])));
+        v0 = (((13 && v1) > (31 >= v2)) / 7);
+    } else {
+        v3 = (((v1 != a0[2]) / 7) % 5);
+        a0[2] = (((v0 && a0[9]) - (v2 > v2)) ? ((a1[2][3] == v3) % 9) : ((4 + v3) > (a1[3][1] >= a0[14])));
+        a0[6] = (((v0 >= v0) ? (a0[9] % 9) : (a0[4] > v3)) != ((a0[5] == a0[4]) % 3));
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[0][15] = (((a0[11] * 14) / 2) + ((i4 / 3) <= (v2 ? v3 : v3)));
+            a1[3][14] = (((a0[3] % 3) ? (34 ? v2 : a1[1][1]) : (92 % 2)) > ((13 % 1) ? (4 || 77) : (v3 * a0[13])));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a0[11] = (((69 + 95) - (v0 <= 23)) != ((v2 % 1) % 5));
+                v0 = (((59 < a0[14]) == (i5 < v0)) + ((v2 * a0[7]) / 5));
+                a0[5] = (((56 < a1[3][8]) != (97 <= i4)) ? ((i4 < 54) ? (61 ? 75 : v3) : (90 && 91)) : ((v2 || a1[2][2]) || (a1[0][0] || i4)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((17 - v0) != (84 < v3)) || ((v1 > v1) >= (26 >= v2)));
+}
+int f2() {
+    int v0 = 12;
+    int v1 = 51;
+    int v2 = 58;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            if ((88 != i0) > 91) break;
+            v0 = (((a1[1][8] < 78) ? (v1 * v2) : (a0[3] ? v3 : a1[1][0])) / 7);
+            a0[14] = (((34 <= v3) ? (v3 % 3) : (v1 + a1[2][11])) ? ((a1[2][2] < a0[3]) && (a1[0][6] < i1)) : ((19 * i1) ? (a0[8] < a0[12]) : (i0 <= v2)));
+            v1 = (((a0[9] != v3) / 3) > ((a0[12] && a0[11]) + (a1[0][13] % 5)));
+        }
+        v1 = (((a1[1][0] - v1) * (70 == a1[0][0])) * ((55 ? a0[6] : v3) * (a1[0][2] != a0[1])));
+        a0[14] = (((v0 ? 68 : v0) < (86 - v3)) == ((v0 ? 91 : 15) % 2));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[4] ? a0[11] : v1) > 93) break;
+            v2 = (((60 ? a0[4] : v2) < (v1 < 99)) + ((a1[2][14] - 67) < (v3 - 48)));
+            v3 = (((i2 ? v0 : v0) > (a0[6] >= v3)) / 4);
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((a1[2][6] % 1) > 62) break;
+                    a1[0][7] = (((v2 * a0[7]) >= (i2 != 94)) != ((a1[3][6] <= i3) ? (a0[2] / 4) : (a0[0] + i2)));
+                    v3 = (((49 ? a0[4] : a1[2][2]) / 7) % 6);
+                    v1 = (((v2 >= a0[6]) <= (v1 <= i3)) != ((v1 ? v0 : a0[11]) ? (v0 && a1[0][11]) : (v0 >= 32)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    a0[0] = (((v0 <= v2) ? (v3 / 2) : (v3 && v1)) > ((v1 ? v3 : 86) % 8));
+    v1 = (((v2 + v1) - (v1 ? v2 : 46)) && ((a0[4] + v3) % 1));
+    {
+        int i4 = 0;
+        do {
+            if ((v0 ? v1 : a0[6]) > 99) break;
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v2 = (((15 <= v0) == (a1[1][9] ? v1 : i4)) <= ((v3 + v1) <= (v1 == a1[2][14])));
+                v1 = (((v1 < v3) * (a0[8] >= a0[10])) > ((27 == i5) / 8));
+                v1 = (((23 * a1[0][6]) < (63 - a0[3])) > ((a1[2][4] ? 49 : 36) ? (i5 == a0[5]) : (92 <= v2)));
+            }
+            v1 = (((v1 + a1[0][2]) ? (84 >= v2) : (36 < v1)) / 6);
+            v3 = (((70 == v0) * (v1 ? v3 : 36)) ? ((v1 / 5) != (a1[3][7] <= a1[3][0])) : ((65 ? 15 : a1[3][0]) * (15 ? 9 : a0[12])));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((39 + v1) / 9) <= ((98 ? v0 : v0) < (a0[9] && v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,46 @@
+int f0() {
+    int v0 = 28;
+    int v1 = 65;
+    int v2 = 7;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((6 / 7) == (a0[9] && v3)) * ((v2 || v1) ? (a1[1][9] < a0[1]) : (27 ? 70 : v1)));
+    v2 = (((a1[1][14] / 4) > (86 > v0)) > ((70 + v0) > (73 && 26)));
+    v2 = (((v2 == v1) > (v2 < v2)) && ((a0[2] % 3) % 5));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((96 <= v0) > 92) break;
+        {
+            int i1 = 0;
+            do {
+                a1[2][9] = (((61 || i0) / 8) < ((i0 - a1[3][7]) < (a0[8] == v2)));
+                v2 = (((a0[0] * i0) != (a1[1][2] && 85)) < ((a0[9] == v2) - (a0[5] * a1[1][0])));
+                a0[5] = (((i1 < 90) >= (v3 % 5)) * ((53 ? i1 : i1) ? (a0[9] < 91) : (i1 - v0)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        a1[3][13] = (((a1[0][12] - i0) != (v2 ? i0 : i0)) / 8);
+        v2 = (((a0[2] < 92) + (i0 - v3)) >= ((84 && 10) || (a1[2][11] ? i0 : v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((7 && v3) > (v2 < a0[3])) * ((i2 % 2) && (8 - v2)));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    a1[3][0] = (((i3 ? i2 : a0[7]) <= (a0[1] || v3)) * ((34 * a1[1][2]) - (v1 ? v3 : 20)));
+                    v3 = (((i2 ? v2 : a0[14]) && (v3 && v0)) < ((i3 <= 47) > (29 <= a0[8])));
+                    a1[3][9] = (((15 || v3) ? (i2 ? a1[2][15] : v1) : (v3 + a1[1][13])) ? ((v3 >= a0[1]) == (a1[1][12] && a1[3][3])) : ((a0[2] > a1[1][5]) > (v2 >= v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[0][15] = (((99 % 4) - (v3 * v3)) <= ((61 > v1) && (v0 % 4)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    return (((v1 - a1[3][15]) + (v1 || v1)) || ((v3 % 7) * (a1[0][10] > v2)));
+}
+int main() {
+    return 0;
+}
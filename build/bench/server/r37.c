@@ -0,0 +1,103 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 87;
+    int v2 = 77;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[0][7] = (((v1 ? v3 : i0) ? (v3 - a1[3][1]) : (v0 != a0[3])) != ((v0 < 37) > (v2 && v1)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a0[3] != a1[3][12]) < (v3 >= 15)) <= ((v2 > v3) <= (v3 ? a0[5] : v3)));
+                    a0[13] = (((a0[12] <= a1[1][11]) / 1) / 5);
+                    v0 = (((v2 || 91) >= (v1 * a0[13])) ? ((i1 >= a0[0]) + (v3 != a0[0])) : ((15 == v3) != (i1 <= i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v1 = (((40 ? a1[2][5] : v0) || (98 && v3)) * ((v3 <= a0[9]) <= (a1[2][6] != v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v0 = (((a0[12] * a0[10]) + (v0 != a1[0][7])) == ((v1 + a1[3][2]) * (33 ? a0[8] : v1)));
+                    a1[1][4] = (((15 - v3) - (v1 ? i2 : i2)) ? ((v2 == 36) % 9) : ((v0 || 74) < (3 % 2)));
+                    a1[0][14] = (((i2 || 52) / 1) != ((a1[3][6] / 1) <= (51 > 69)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[4] = (((a1[1][14] < 99) > (i2 ? a0[12] : v1)) < ((69 ? a1[3][4] : 28) * (a0[1] < v1)));
+            v2 = (((i2 != v0) && (a1[0][6] - 30)) - ((35 ? a1[2][7] : v1) / 9));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v2 = (((a0[10] / 9) ? (v3 ? 7 : a1[1][1]) : (55 == a0[13])) * ((i4 ? a0[10] : v3) && (a1[0][10] || v2)));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            if ((a1[3][5] < 1) > 83) break;
+            v3 = (((v3 ? 55 : v1) >= (v1 > v2)) == ((18 - v2) % 2));
+            a1[1][12] = (((i5 || a0[11]) / 8) ? ((v3 <= 71) % 1) : ((a1[1][5] >= 30) ? (a1[2][4] != 69) : (v3 < 53)));
+            v1 = (((v0 / 4) ? (i5 > a0[8]) : (i5 || v1)) / 8);
+        }
+        a1[1][4] = (((i4 >= v1) == (v1 > i4)) < ((42 >= v1) != (a1[1][15] < v3)));
+    }
+    a1[0][14] = (((v0 * v2) || (v0 && v3)) ? ((v3 >= a1[3][5]) <= (v3 != v1)) : ((a1[2][2] >= 7) || (v1 - a1[2][14])));
+    v0 = (((a0[7] >= a1[3][13]) * (a0[9] - a0[6])) <= ((a1[2][5] ? v2 : v2) && (39 * v0)));
+    return (((v2 != 72) ? (v1 + v2) : (a0[3] && a0[8])) >= ((v1 <= 15) >= (v1 > v2)));
+}
+int f1() {
+    int v0 = 54;
+    int v1 = 48;
+    int v2 = 12;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 && a0[13]) ? (v1 > a0[1]) : (v2 == 16)) > ((v2 + a0[11]) >= (v1 + v2)))) {
+        v1 = (((87 != a0[9]) ? (v2 % 9) : (39 == v0)) > ((a0[4] / 7) || (v2 - a0[5])));
+        v0 = (((v1 % 9) ? (a0[5] / 4) : (a0[3] <= 54)) > ((a0[15] ? a1[3][2] : 57) < (a0[10] ? v0 : v1)));
+        v1 = (((v1 - v2) - (v3 * 43)) || ((a1[0][5] * v2) < (9 * a1[2][2])));
+    } else {
+        a1[0][2] = (((96 - v2) < (a0[3] * v0)) < ((v3 < v1) - (v0 != v1)));
+        a0[8] = (((17 <= v3) && (v1 != a0[6])) < ((v0 / 7) ? (56 >= v1) : (v2 > v0)));
+        a0[5] = (((a1[2][8] == v0) || (79 % 9)) != ((v3 >= v1) / 5));
+    }
+    if ((((9 && 39) / 6) + ((v0 != v3) == (v0 % 5)))) {
+        v1 = (((v3 == v1) != (v2 > v3)) < ((68 <= 77) >= (v2 != v2)));
+        a0[5] = (((94 * v1) + (47 % 7)) - ((a0[5] >= v1) + (a1[0][7] >= a0[4])));
+        a0[7] = (((v3 && 97) * (v3 <= 77)) != ((a1[2][2] - a0[5]) && (a0[8] - 25)));
+    } else {
+        a1[1][12] = (((31 < 9) < (v1 != a0[4])) == ((64 > a1[0][3]) || (v3 == 23)));
+        a1[1][7] = (((v1 || v0) * (v2 - v2)) >= ((a1[3][2] ? 15 : v2) < (v1 - a0[6])));
+        a0[9] = (((7 || 16) ? (v2 > 47) : (v3 <= 18)) ? ((v0 ? a1[2][5] : 68) - (50 * a1[3][3])) : ((v0 - a1[0][6]) && (a0[10] < 70)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v2 = (((a0[12] ? v3 : a1[1][12]) >= (a0[1] / 6)) / 1);
+                v1 = (((v2 && v0) == (v3 > v3)) - ((v0 && v2) ? (i0 > v2) : (70 + a1[1][2])));
+                v2 = (((v3 - v2) >= (v3 + v3)) ? ((a1[2][8] == a1[1][4]) < (a1[0][1] ? v1 : v3)) : ((a1[1][1] >= i1) || (a1[2][0] > 0)));
+            }
+            v2 = (((v0 || a1[2][5]) % 7) + ((v1 ? a1[2][12] : 95) == (v1 && v1)));
+            v3 = (((22 * i0) != (61 <= 98)) / 5);
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((a0[5] ? 46 : v3) != (v1 > a0[13])) + ((v2 <= v2) || (50 != v3)));
+    a1[0][5] = (((v1 % 2) / 5) % 7);
+    return (((51 > v0) ? (v1 ? v0 : 54) : (a1[3][14] * a0[1])) ? ((9 + v0) || (40 >= v2)) : ((a0[15] == v2) == (v2 == a1[3][5])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
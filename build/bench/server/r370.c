@@ -0,0 +1,106 @@
+int f0() {
+    int v0 = 13;
+    int v1 = 73;
+    int v2 = 78;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((v1 || a0[3]) || (v1 >= 63)) > ((v1 % 8) ? (98 || v3) : (12 > 8)));
+        v0 = (((a1[3][3] - 27) && (i0 - 97)) ? ((i0 / 5) && (a1[2][15] >= a1[2][12])) : ((78 ? v0 : v3) != (a1[0][15] > v3)));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            a1[3][4] = (((i0 || v0) <= (i1 ? 27 : v3)) * ((v1 != 82) ? (v0 ? a0[7] : a1[0][9]) : (a1[1][7] * v1)));
+            a0[1] = (((a0[13] <= a0[6]) >= (i1 + v1)) != ((a0[11] == a0[7]) + (a1[3][4] < v1)));
+            v0 = (((15 && v1) >= (i1 ? 79 : v2)) * ((a0[9] && a1[2][7]) >= (a0[4] == v0)));
+        }
+    }
+    a0[7] = (((a0[2] ? v3 : a1[1][14]) - (81 > 27)) != ((v1 % 3) > (v1 >= 47)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v3 = (((i3 <= 40) + (a1[0][10] - v3)) ? ((v2 % 4) > (v3 == 11)) : ((a1[1][4] < v3) + (i3 - v3)));
+                v3 = (((a1[3][13] % 2) >= (a0[3] == i3)) - ((i3 == 68) % 1));
+                a1[3][10] = (((v0 >= 84) < (76 != 95)) - ((v1 > v1) <= (a1[0][6] - v3)));
+                i3 = i3 + 1;
+            }
+        }
+        a1[0][8] = (((v3 ? a1[1][2] : i2) % 4) || ((v0 == v2) <= (v1 != v3)));
+        a1[2][11] = (((56 % 9) - (i2 * a0[13])) ? ((v1 % 1) == (a0[5] - i2)) : ((40 - v2) == (92 + i2)));
+    }
+    if ((((83 ? v0 : a1[2][2]) != (v2 != 17)) ? ((a1[2][12] || 68) != (36 ? a0[4] : 1)) : ((30 % 8) ? (v2 * a1[0][3]) : (a1[2][10] % 7)))) {
+        v2 = (((v1 < 64) - (v0 || v2)) / 6);
+        a1[2][13] = (((v3 <= v1) || (v3 ? 55 : 92)) <= ((v2 <= v3) == (46 == v2)));
+        v1 = (((a0[11] + v2) > (v3 < v0)) && ((39 % 9) || (v1 == a1[1][0])));
+    } else {
+        a1[1][13] = (((a0[9] / 7) <= (87 <= v0)) > ((a0[11] != v0) > (v3 - a0[12])));
+        a1[2][7] = (((47 < v3) >= (v1 && 93)) == ((v3 && v0) <= (77 ? a1[3][1] : a1[1][6])));
+        a0[8] = (((v0 < a0[0]) != (v0 * 28)) % 2);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        if ((30 + a1[3][1]) > 71) break;
+        a0[7] = (((i4 ? 91 : a1[2][2]) != (35 / 1)) % 8);
+        v0 = (((v3 / 7) || (i4 % 5)) && ((v0 - 95) ? (18 / 2) : (v1 ? 43 : v2)));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            if ((v3 != i5) > 66) break;
+            a0[9] = (((a0[4] <= a0[5]) == (31 == 73)) % 3);
+            v3 = (((46 / 8) - (v1 && a0[0])) * ((a1[2][11] - 98) % 5));
+            v0 = (((i5 >= v1) * (86 * i5)) ? ((v1 == a0[4]) == (v1 != a1[3][5])) : ((v2 ? v3 : v2) ? (92 >= a1[3][12]) : (49 < a0[14])));
+        }
+    }
+    return (((v2 >= 91) == (a1[3][0] || v2)) <= ((v2 || 4) % 6));
+}
+int f1() {
+    int v0 = 98;
+    int v1 = 36;
+    int v2 = 61;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((v1 >= v0) > 59) break;
+        {
+            int i1 = 0;
+            do {
+                v1 = (((67 > 92) != (i0 < v0)) <= ((32 / 8) <= (v1 > a1[1][9])));
+                a0[4] = (((a1[1][11] * a0[4]) % 7) && ((a1[0][10] || 31) * (v0 < a1[0][12])));
+                a1[1][7] = (((v3 && a0[15]) + (v1 == i1)) && ((v2 > v3) * (a1[2][15] == i0)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        v1 = (((a1[3][13] * 19) >= (1 * i0)) != ((51 - a1[0][0]) * (v3 ? v0 : a0[6])));
+        a1[1][14] = (((a1[1][8] / 8) / 3) || ((v3 + v0) ? (v0 <= a1[1][11]) : (a0[12] != v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((v2 && i2) == (60 * v0)) == ((v2 == 46) - (i3 != v1)));
+                    v3 = (((v1 + 82) ? (v2 == a1[3][8]) : (v3 <= v3)) * ((v3 <= v3) + (0 ? i3 : 35)));
+                    v0 = (((i3 <= v2) % 2) * ((21 <= a0[13]) ? (i3 != 41) : (a0[0] && a0[9])));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[2][7] = (((a1[1][11] * 11) / 1) && ((75 == a1[3][8]) * (i2 || 85)));
+            v2 = (((v1 || v0) ? (41 % 3) : (i2 + v2)) <= ((a1[3][2] <= v0) < (v2 / 8)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v2 * v0) % 3) >= ((84 >= a0[8]) > (a1[1][9] || a1[2][1])))) {
+        v2 = (((93 <= 29) > (a0[0] <= a1[2][12])) > ((v2 >= 37) <= (v0 != v3)));
+        v0 = (((a1[0][3] || a1[0][10]) - (a0[7] ? v3 : a0[5])) && ((34 || a0[0]) > (v1 <= a1[2][8])));
+        v1 = (((24 / 2) / 4) != ((a1[2][7] + 43) + (a0[15] > v1)));
+    } else {
+        a0[2] = (((11 <= v2) != (v0 * a0[2])) + ((v2 || v2) + (v3 >= v1)));
+        v2 = (((v1 && 39) <= (a1[2][10] ? a0[9] : 42)) && ((a1[1][14] * a0[15]) <= (v1 >= 22)));
+        v1 = (((a0[2] <= v1) >= (v1 + v2)) ? ((a0[7] && a1[3][13]) % 3) : ((93 <= 22) >= (v0 != v3)));
+    }
+    v1 = (((v1 * v3) < (v0 * v0)) ? ((v1 + v3) ? (57 % 7) : (v1 && a1[1][5])) : ((80 ? v3 : a1[1][6]) / 6));
+    v2 = (((v0 >= v1) < (v2 * v2)) == ((a0[3] || a0[15]) <= (v2 / 2)));
+    return (((v1 != v1) % 7) < ((v2 > v2) / 6));
+}
+int main() {
+    return 0;
+}
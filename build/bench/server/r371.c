@@ -0,0 +1,159 @@
+int f0() {
+    int v0 = 79;
+    int v1 = 74;
+    int v2 = 22;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((v0 >= v1) > 78) break;
+        v2 = (((59 + i0) <= (a0[13] - a0[6])) < ((v0 || i0) < (v1 * v2)));
+        v3 = (((v2 >= 85) != (33 ? a1[2][2] : a0[13])) != ((a1[3][7] ? v2 : 38) ? (i0 > 61) : (i0 <= v2)));
+        {
+            int i1 = 0;
+            do {
+                v2 = (((v0 || v2) / 7) <= ((a1[0][7] <= i1) == (3 == i0)));
+                v1 = (((i0 + v2) + (a1[3][7] - a1[0][4])) != ((a1[2][4] < v2) || (15 ? 96 : v0)));
+                a1[1][12] = (((v1 > 44) != (v0 >= v1)) < ((v3 <= a0[8]) ? (12 == a0[14]) : (i0 ? a0[8] : a0[15])));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+    }
+    a1[0][6] = (((38 * a1[3][10]) <= (v0 ? v0 : v0)) - ((v0 * 70) > (v3 > v2)));
+    v1 = (((v2 % 9) != (v3 >= v1)) != ((a1[2][6] && v0) < (v1 ? 41 : v1)));
+    if ((((v0 + 72) / 1) >= ((a0[9] * v1) || (v0 / 7)))) {
+        v1 = (((69 <= a1[2][12]) + (79 / 7)) > ((55 ? v2 : v2) > (a1[0][5] == v1)));
+        v1 = (((a0[8] != v0) && (6 / 1)) + ((a1[1][5] >= v1) != (a1[3][8] < a0[11])));
+        a0[1] = (((v0 <= 44) || (87 != v2)) > ((v1 || v2) % 5));
+    } else {
+        a0[1] = (((39 || a0[11]) % 2) ? ((v3 < v3) + (20 >= v0)) : ((64 ? a0[11] : v1) || (a0[11] == v2)));
+        v2 = (((v3 ? a0[7] : v3) ? (v3 + 86) : (v1 - 16)) ? ((a1[0][5] * v2) * (a1[1][7] && a1[2][10])) : ((v1 && v2) + (a0[15] / 9)));
+        v1 = (((a0[10] ? v0 : v3) ? (39 / 4) : (v0 + v2)) && ((v1 * v1) / 4));
+    }
+    a0[14] = (((v0 ? v0 : a0[5]) >= (v0 / 7)) + ((v2 + v3) == (v1 || v0)));
+    return (((v0 <= a1[3][1]) ? (v0 > 74) : (v1 <= 98)) - ((a0[12] >= v0) ? (v2 * v2) : (v1 && v3)));
+}
+int f1() {
+    int v0 = 33;
+    int v1 = 38;
+    int v2 = 36;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v2 = (((v0 + v1) % 9) == ((v1 / 4) || (51 && v0)));
+        v3 = (((i0 % 8) % 3) != ((v3 > v0) ? (a0[4] && 79) : (a1[1][15] || a0[14])));
+        {
+            int i1 = 0;
+            do {
+                if ((33 + v0) > 58) break;
+                v0 = (((a0[8] / 2) * (a1[0][3] / 5)) < ((a1[3][5] >= v1) + (v2 >= v2)));
+                v2 = (((v0 && a0[13]) || (a0[4] % 5)) >= ((a0[4] || 88) > (v1 * v1)));
+                a1[3][8] = (((67 == 0) + (a1[2][7] != v3)) > ((v1 ? v2 : 21) ? (a1[1][6] - v0) : (v2 == 34)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+    }
+    if ((((v3 - v2) > (v1 || a0[0])) >= ((v0 <= a0[11]) < (v3 == a0[13])))) {
+        v0 = (((v2 <= v1) ? (15 <= a0[4]) : (v1 > a1[2][10])) % 3);
+        v1 = (((a0[4] - v3) ? (a0[4] ? a0[9] : v0) : (v2 == a0[9])) && ((23 ? v3 : 62) ? (81 / 9) : (78 / 3)));
+        v3 = (((v2 ? v2 : v3) % 9) || ((a1[0][13] >= v3) && (v2 - 24)));
+    } else {
+        v1 = (((v3 <= 75) ? (v3 > 90) : (a1[1][9] && v2)) || ((89 <= 90) > (v3 && v3)));
+        v2 = (((v0 && v3) % 8) >= ((26 % 2) || (43 || 1)));
+        v3 = (((v1 != v2) / 3) != ((a1[1][7] != v2) == (a0[15] ? 41 : a1[1][12])));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        a0[2] = (((22 == a0[6]) < (a0[0] * v3)) ? ((v1 >= v2) ? (40 - v0) : (v2 + v0)) : ((i2 + v1) >= (43 >= 37)));
+        {
+            int i3 = 0;
+            do {
+                a1[3][2] = (((a0[11] && a0[11]) && (v1 ? v0 : a0[2])) < ((v2 < v1) != (v2 <= 74)));
+                v0 = (((54 ? v0 : i3) ? (51 / 9) : (v0 < v1)) >= ((12 ? v3 : i2) == (a1[2][11] - a1[1][2])));
+                v1 = (((i2 >= i2) >= (a1[0][12] > v3)) <= ((29 % 6) || (a1[3][12] || i2)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        a1[2][0] = (((v1 * 90) ? (25 + v2) : (i2 < i2)) ? ((v3 * v0) < (73 % 9)) : ((i2 || v3) < (24 ? v1 : 55)));
+    }
+    v1 = (((v3 ? 91 : 45) || (v3 > a1[1][13])) + ((v2 < 98) > (a1[0][6] && v3)));
+    if ((((v3 != v2) != (31 >= a1[0][4])) * ((50 <= v1) ? (v2 == v3) : (v2 ? v3 : v0)))) {
+        a1[0][10] = (((v1 == a1[3][0]) % 2) ? ((v2 > v1) - (70 || v1)) : ((a0[10] ? 83 : 71) ? (a1[1][15] ? v1 : 42) : (v3 != v0)));
+        a1[3][9] = (((v0 * 23) && (v3 == 38)) < ((a1[3][10] + v2) + (v3 || a0[11])));
+        v3 = (((a0[14] && v0) <= (v2 ? a1[2][12] : a1[3][11])) * ((v1 + a0[6]) <= (v0 != v2)));
+    } else {
+        v0 = (((94 - v2) || (v1 != v3)) - ((a1[0][9] ? v0 : 19) ? (a1[0][8] > v2) : (a1[0][7] && v1)));
+        v2 = (((a1[1][8] && v0) != (a1[1][14] / 7)) + ((v0 <= v0) || (v0 % 8)));
+        v3 = (((31 || 77) >= (a0[8] ? v2 : v3)) / 4);
+    }
+    return (((v3 ? v3 : a0[2]) <= (78 > a1[0][14])) < ((a0[9] < a1[3][5]) + (24 >= v3)));
+}
+int f2() {
+    int v0 = 99;
+    int v1 = 43;
+    int v2 = 32;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[0] && a1[3][6]) >= (a1[1][9] ? v2 : v0)) * ((v1 || v3) * (v3 % 7)))) {
+        a1[1][11] = (((60 >= a0[3]) != (v0 % 2)) / 6);
+        v2 = (((96 * 78) && (46 + 47)) != ((v3 > 1) >= (v3 * 40)));
+        v2 = (((v0 <= v0) / 8) || ((a1[3][3] == a0[15]) * (a0[14] == v2)));
+    } else {
+        v0 = (((64 / 3) < (a1[1][8] * v0)) ? ((a0[6] - a0[7]) * (7 / 1)) : ((a1[3][15] > a1[1][4]) * (32 < v3)));
+        a1[0][0] = (((8 - v3) && (v0 % 6)) ? ((v1 ? 3 : v0) < (12 > v1)) : ((a0[8] < a0[3]) || (v1 == a0[0])));
+        a1[0][2] = (((v3 - 64) > (32 ? 32 : a0[9])) - ((v1 % 5) + (v0 ? a0[4] : v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[1][6] = (((a0[2] + v3) <= (v1 * v0)) && ((a0[1] % 1) < (88 ? 82 : a1[1][6])));
+            {
+                int i1 = 0;
+                do {
+                    a0[13] = (((v0 / 2) < (29 + v3)) / 9);
+                    v3 = (((7 ? 2 : a1[3][14]) <= (v0 >= 94)) / 6);
+                    v2 = (((i1 && a0[7]) / 1) && ((v0 * a1[3][1]) > (v0 >= i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v3 = (((85 + 78) ? (9 <= 40) : (v0 % 1)) * ((v2 <= 32) < (v2 || 86)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v2 = (((27 - 40) || (i3 - 38)) != ((i3 % 5) <= (9 - a1[1][10])));
+                v1 = (((a0[4] || v1) > (a1[2][12] && 11)) ? ((v1 + v0) ? (a0[13] < 14) : (i2 < a0[4])) : ((i3 / 3) ? (a1[1][9] < a0[1]) : (27 && v1)));
+                a0[1] = (((a0[14] || 35) == (i2 >= a0[11])) || ((a0[3] + i2) <= (v3 < v2)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        a1[0][12] = (((i2 && v2) * (a1[1][9] && v2)) % 8);
+        v3 = (((v2 % 4) <= (49 % 5)) && ((93 == 8) || (18 >= v3)));
+    }
+    if ((((v2 * a1[1][7]) % 4) == ((95 || 66) == (v2 == v3)))) {
+        v1 = (((a1[0][4] * v1) / 7) * ((v3 > v1) - (v0 == 61)));
+        v2 = (((v1 && a1[1][4]) / 6) + ((v1 / 9) >= (v3 > a0[0])));
+        a0[0] = (((v0 <= a1[1][6]) >= (88 < v3)) * ((a1[1][4] - 71) ? (v0 - v1) : (v3 != v0)));
+    } else {
+        v2 = (((v3 && v2) + (v2 % 1)) <= ((v2 > a0[3]) % 1));
+        a0[3] = (((a1[1][0] >= v0) ? (v2 - v1) : (v0 == v3)) >= ((30 ? v3 : a1[0][8]) / 3));
+        a0[14] = (((v3 % 2) && (42 / 9)) || ((a0[10] && v1) % 3));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v3 = (((i4 + v1) % 4) - ((a1[3][15] / 7) ? (v0 != a1[2][14]) : (i4 > v3)));
+            v3 = (((4 != v2) && (a1[0][10] * i5)) >= ((5 < v3) < (a0[6] - 85)));
+            a1[1][7] = (((v1 * 25) % 9) - ((a1[0][4] > i5) >= (i4 > i4)));
+        }
+        v3 = (((v2 > v2) != (9 > v3)) == ((51 == v2) + (v3 && v2)));
+        a0[4] = (((a1[0][10] ? 79 : v0) != (i4 != 15)) < ((v0 + a1[2][7]) % 3));
+    }
+    return (((v3 >= v2) < (12 >= v1)) && ((a1[0][6] > 20) * (a1[2][2] > a1[3][8])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,76 @@
+int f0() {
+    int v0 = 94;
+    int v1 = 81;
+    int v2 = 94;
+    int v3 = 42;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((v0 * i0) > 65) break;
+                    v0 = (((v0 / 2) < (a0[9] >= v2)) % 6);
+                    v1 = (((v1 ? 1 : i1) - (a1[0][15] <= a0[1])) - ((i0 > 64) % 7));
+                    a1[2][12] = (((v3 % 8) != (v1 * 42)) || ((v2 <= 32) - (i0 % 1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((21 + a0[12]) || (35 || 82)) - ((a0[1] * v0) % 3));
+            v2 = (((45 - a1[3][15]) != (a1[1][2] * 2)) * ((a0[10] + v2) == (v3 * i0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a0[3] * v3) % 6) != ((a0[4] == 6) ? (v3 / 9) : (v3 - v3)));
+            v0 = (((4 >= i2) > (i2 + v1)) - ((33 || i2) <= (23 == i2)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    if ((a1[3][12] >= a0[13]) > 59) break;
+                    v2 = (((v1 >= v0) % 5) - ((32 * v3) - (v2 < 75)));
+                    v3 = (((42 > 67) - (46 >= v2)) + ((i2 || 44) || (v3 * i3)));
+                    a0[1] = (((a0[4] / 1) - (a0[10] + i2)) != ((v0 < v1) - (i2 != v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((v2 / 7) == (v2 && v1)) % 2)) {
+        v3 = (((v1 + v1) ? (65 == v3) : (20 - v2)) >= ((v3 <= v3) - (v2 == 99)));
+        v0 = (((v3 || a1[2][6]) < (a1[2][8] || a0[11])) != ((v0 && a0[14]) >= (a1[1][2] % 6)));
+        v1 = (((a0[3] && 68) <= (v1 > a0[4])) || ((a0[0] + v2) + (a0[10] >= v2)));
+    } else {
+        a1[1][2] = (((a0[1] || v2) / 3) == ((v3 % 7) ? (v2 && v1) : (v3 - v1)));
+        a1[2][8] = (((v0 - v2) + (24 * v1)) ? ((71 ? v3 : v2) <= (8 % 7)) : ((a0[5] - a1[2][9]) * (67 <= a1[1][12])));
+        v0 = (((v1 && v2) - (v1 ? v1 : 93)) ? ((89 || v3) < (v0 == v1)) : ((v2 > 37) > (v2 <= v3)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((99 - v1) > 97) break;
+            a0[5] = (((a1[0][2] < 13) + (v1 * v3)) ? ((v3 && 74) ? (v0 && a0[9]) : (a1[3][6] - a1[1][6])) : ((v3 <= 92) ? (v3 ? 80 : v0) : (22 * 1)));
+            a1[1][12] = (((10 % 2) <= (a0[15] ? a1[0][12] : a0[14])) ? ((89 && 81) == (a0[3] > 85)) : ((v3 > 60) != (a1[2][7] ? v2 : v2)));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    v1 = (((55 - v2) && (a1[1][2] % 5)) * ((i4 * v2) + (15 / 3)));
+                    a0[15] = (((65 > 48) != (9 % 7)) * ((63 && 98) ? (v0 != v1) : (v0 + 11)));
+                    v1 = (((95 < a0[5]) ? (86 - v1) : (a1[0][4] > 4)) % 8);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    a0[1] = (((v0 < v3) >= (v3 / 2)) >= ((v0 < 37) <= (a1[1][12] % 8)));
+    return (((v2 + 37) >= (a0[1] || 87)) >= ((69 / 8) < (v2 ? 78 : v3)));
+}
+int main() {
+    return 0;
+}
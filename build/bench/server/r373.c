@@ -0,0 +1,125 @@
+int f0() {
+    int v0 = 7;
+    int v1 = 75;
+    int v2 = 79;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[2][5] = (((67 ? v1 : a1[1][0]) % 2) ? ((v0 ? a1[3][6] : v3) != (i0 && a0[13])) : ((v0 && v1) > (v1 % 6)));
+            v0 = (((a0[2] && 72) ? (22 < v1) : (i0 / 8)) < ((i0 && a1[1][9]) && (v1 ? 89 : v1)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v0 = (((i1 >= v1) / 9) + ((a1[3][13] > v3) >= (a1[1][12] != a1[1][0])));
+                v0 = (((i0 - a0[1]) / 2) <= ((v1 <= a1[0][7]) < (v3 > v0)));
+                a0[13] = (((v2 < v2) > (35 - a1[1][3])) / 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[7] = (((a0[11] && i2) % 5) % 8);
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((a1[3][13] && 43) * (0 % 4)) + ((v1 ? 65 : i3) / 3));
+                    v3 = (((v0 < a0[14]) == (23 / 9)) > ((a0[0] ? a0[1] : 20) ? (a0[4] >= 68) : (v0 && i3)));
+                    v3 = (((i3 ? i2 : i2) ? (a1[2][10] + a0[13]) : (a1[2][12] - i2)) * ((v1 != 28) % 7));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((i2 <= v0) >= (a1[2][0] / 9)) < ((v1 != 99) >= (i2 * v2)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v3 = (((v3 ? a0[7] : v3) || (v0 <= i4)) == ((v1 ? v1 : i4) >= (89 == 95)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((i4 * a0[8]) < (a1[3][2] >= v0)) / 9);
+                    v3 = (((i5 / 7) % 1) > ((a1[1][4] <= i4) > (a1[3][9] && i5)));
+                    v3 = (((v2 - a1[2][0]) + (v0 && v2)) <= ((a1[3][5] <= 32) ? (a0[5] / 2) : (25 > v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((v2 ? a0[14] : v0) != (v1 % 2)) * ((v3 / 6) != (22 != a0[14])));
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((v3 >= 78) - (a0[2] ? a1[2][14] : v2)) <= ((a1[1][8] ? a0[1] : v2) >= (v3 <= 70)));
+    v3 = (((v2 % 9) % 4) || ((32 + 54) >= (v3 - 98)));
+    return (((a1[0][6] < v1) >= (83 / 6)) / 7);
+}
+int f1() {
+    int v0 = 7;
+    int v1 = 50;
+    int v2 = 52;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    if ((((42 < 79) >= (40 / 7)) ? ((v2 == 49) ? (v0 - v2) : (v1 || v3)) : ((a0[13] - v2) ? (v1 - v2) : (a1[3][6] && a0[0])))) {
+        v1 = (((v0 ? v1 : a0[0]) ? (v1 || 92) : (a0[5] == v0)) >= ((45 - v0) == (a0[3] < v0)));
+        v1 = (((v3 > a0[2]) || (a0[7] >= v0)) / 9);
+        a1[1][15] = (((a1[1][0] >= a1[0][5]) == (a0[5] || 0)) < ((5 <= a1[3][11]) * (a1[1][1] + v3)));
+    } else {
+        v2 = (((v1 ? v0 : v0) > (96 || a1[1][15])) <= ((a0[13] == a0[9]) && (v3 ? v1 : 61)));
+        v1 = (((0 + v1) && (v2 == a1[1][13])) < ((v3 || 66) + (47 ? v1 : v1)));
+        v1 = (((v2 < v3) < (51 || a0[7])) == ((v3 || 29) > (a1[1][11] > a1[3][6])));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v0 % 7) > 89) break;
+            v2 = (((94 - v0) / 9) ? ((28 / 4) != (v2 <= 0)) : ((a1[1][3] ? 55 : v3) * (a1[3][6] >= v2)));
+            a1[1][7] = (((57 + v2) ? (i0 - a0[14]) : (v0 * v3)) == ((a0[6] != a0[7]) * (v2 || 56)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v2 = (((a1[3][9] < 62) ? (84 / 3) : (v3 && a0[1])) * ((a0[8] < v3) * (v3 ? v1 : 32)));
+                v3 = (((v2 < a0[11]) % 4) ? ((33 < i0) * (a0[15] - v0)) : ((i0 <= a1[1][6]) != (36 || a0[13])));
+                a0[12] = (((i0 + a0[5]) ? (v1 % 1) : (54 * v2)) == ((32 && 29) && (v1 && a0[7])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((v1 || v1) ? (a1[3][14] || v0) : (v3 > v2)) / 7)) {
+        v0 = (((v2 == v3) && (v3 ? 43 : a1[0][8])) && ((v2 != 77) % 3));
+        a0[11] = (((40 / 3) % 5) != ((9 <= a0[4]) >= (v0 == v1)));
+        v0 = (((a1[3][11] + a1[3][13]) && (v0 / 5)) || ((v3 / 3) < (v1 ? 47 : v0)));
+    } else {
+        v0 = (((a0[15] ? 36 : a0[10]) / 8) + ((73 ? v2 : v2) == (v0 || v1)));
+        v0 = (((v1 > a1[1][7]) && (v2 % 3)) != ((v1 ? a1[3][7] : v3) < (v0 != v3)));
+        a1[2][13] = (((a1[0][1] % 9) > (92 == 57)) * ((52 * v2) <= (10 / 5)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[3][13] != v1) > 87) break;
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((a0[11] * a0[1]) < (55 > v0)) * ((i3 / 6) ? (v0 ? v0 : v2) : (i2 % 8)));
+                v0 = (((a1[1][8] + a1[1][0]) == (50 > a0[13])) > ((i2 > 27) > (v0 ? a1[0][5] : i3)));
+                a0[6] = (((v2 + v0) >= (v1 - i3)) != ((48 - i3) % 8));
+            }
+            v3 = (((a1[1][2] / 8) != (35 >= v1)) < ((a0[15] >= v3) && (a0[2] && a1[1][15])));
+            v0 = (((v3 != a1[1][8]) - (14 ? v2 : v0)) < ((a1[3][7] / 9) ? (a0[12] * v0) : (a1[0][0] || 89)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v0 > a0[13]) ? (a0[5] ? 47 : v2) : (59 != a1[3][4])) < ((15 > a1[1][8]) >= (v0 >= v0)))) {
+        v1 = (((v0 ? v0 : a0[4]) ? (v2 < a1[0][0]) : (v3 - v2)) > ((v2 - a1[1][4]) || (v3 + 17)));
+        a1[3][13] = (((20 >= 79) % 6) * ((v0 && v0) && (v2 || a1[3][0])));
+        v0 = (((a0[5] && v3) + (v3 + a0[13])) ? ((92 != v0) && (v1 != a0[14])) : ((v0 < a1[0][11]) <= (v3 > a0[10])));
+    } else {
+        v0 = (((32 ? v0 : v1) * (a0[10] <= a0[4])) > ((v2 / 9) % 1));
+        a1[1][9] = (((a1[3][14] || a1[0][9]) ? (v3 ? 73 : v2) : (15 <= a0[3])) * ((v3 ? v1 : v2) % 4));
+        a1[0][6] = (((v2 <= v0) / 5) + ((v2 + 21) != (v3 <= a1[3][2])));
+    }
+    return (((v1 / 4) || (a0[8] == 25)) != ((v3 <= 68) / 6));
+}
+int main() {
+    return 0;
+}
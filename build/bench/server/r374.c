@@ -0,0 +1,164 @@
+int f0() {
+    int v0 = 79;
+    int v1 = 56;
+    int v2 = 42;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v2 = (((i1 != v1) < (v1 ? v2 : v1)) * ((v1 - 76) % 4));
+                    a0[8] = (((i0 <= a1[1][9]) > (a0[12] >= v0)) - ((v1 > v3) || (i1 % 6)));
+                    v2 = (((29 - v3) % 6) / 9);
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((65 + a1[0][7]) <= (v1 > a1[2][9])) > ((a0[13] == a0[6]) % 6));
+            a0[3] = (((v2 % 8) ? (a1[3][10] != a0[4]) : (v3 < i0)) * ((66 - a1[1][6]) - (a0[1] ? a0[5] : v0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((i2 >= v0) > 81) break;
+            a1[0][14] = (((v0 < v0) % 4) ? ((49 >= 48) == (v3 ? v1 : v2)) : ((86 / 8) < (i2 || v3)));
+            a0[12] = (((v1 <= v1) != (97 ? v2 : v0)) ? ((59 >= i2) < (48 ? a0[14] : a1[3][2])) : ((82 == 30) - (60 >= 97)));
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    if ((a0[14] % 1) > 83) break;
+                    v0 = (((a0[10] != a0[13]) - (i3 != 95)) % 7);
+                    v0 = (((v2 - 49) - (11 != 62)) ? ((i3 < v3) ? (a1[3][6] / 2) : (i2 ? v3 : v2)) : ((62 + a0[0]) == (a0[12] ? i3 : 89)));
+                    a1[1][3] = (((v0 - 18) <= (a1[2][15] && 41)) % 2);
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((v0 || 36) / 4) ? ((i4 <= v2) < (v2 + 42)) : ((a1[1][10] <= v2) == (v1 - a0[0])));
+        {
+            int i5 = 0;
+            do {
+                v2 = (((i5 ? 24 : i5) == (v0 && 50)) >= ((v1 || a1[0][13]) - (v0 / 8)));
+                a0[15] = (((1 / 8) > (70 < 89)) <= ((v3 * v3) * (a1[3][0] + 20)));
+                v3 = (((a1[2][1] - a0[8]) < (v3 || 88)) / 5);
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        a1[3][0] = (((v2 <= 25) / 3) != ((11 || v1) && (a1[1][9] == 95)));
+    }
+    if ((((v2 - v3) % 9) + ((v3 * v1) <= (a0[9] ? a1[1][1] : v3)))) {
+        a0[5] = (((v1 || 88) + (52 || a1[3][9])) ? ((68 % 5) < (a1[1][0] || 62)) : ((a1[3][9] != v2) && (a1[0][1] * 4)));
+        v0 = (((a0[4] / 6) || (v0 == v2)) > ((v0 < v2) == (v1 != v3)));
+        v3 = (((55 ? v1 : v0) + (v2 != 39)) * ((v3 || 20) || (v1 ? a1[2][13] : a1[0][13])));
+    } else {
+        v1 = (((v0 ? a1[0][7] : v3) || (a0[3] - v3)) || ((v1 < 23) * (v3 >= a1[2][15])));
+        v3 = (((39 ? v1 : a0[15]) ? (v0 ? a1[0][14] : v2) : (a1[3][3] || a1[2][5])) < ((a1[1][3] > 16) >= (97 >= v3)));
+        v1 = (((v2 < a0[7]) / 8) % 3);
+    }
+    {
+        int i6 = 0;
+        do {
+            v1 = (((77 % 9) ? (v2 < 27) : (92 >= 39)) > ((v1 <= a0[1]) ? (i6 % 8) : (a1[1][14] || 76)));
+            a0[12] = (((63 && v3) - (30 - a1[0][13])) ? ((a1[3][0] && 3) * (v0 != i6)) : ((v2 + v2) % 4));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v2 = (((14 >= v3) != (a1[1][14] < v3)) != ((99 % 1) ? (57 > 68) : (v3 ? a0[5] : a0[12])));
+                    v1 = (((59 * i7) ? (v1 * 20) : (i6 < i6)) <= ((v3 ? a1[1][0] : a1[3][2]) > (v0 ? a0[0] : 75)));
+                    v2 = (((2 > 43) != (8 ? i6 : a1[2][0])) || ((95 != v1) + (v0 != 35)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((v1 ? a0[0] : 29) && (a1[1][11] + a0[2])) || ((a0[7] ? a1[2][5] : v1) == (v0 <= v0)));
+}
+int f1() {
+    int v0 = 79;
+    int v1 = 68;
+    int v2 = 87;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((30 - v3) || (a1[3][11] + v0)) != ((v1 > a1[1][10]) - (v1 % 4)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v3 = (((a1[1][2] ? v1 : v0) > (v3 % 4)) != ((i0 >= i0) - (a0[2] >= 0)));
+            a0[2] = (((62 % 4) >= (a0[6] && 52)) || ((v0 > a1[1][12]) - (i0 * 46)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v3 = (((a1[1][14] ? a1[3][7] : v3) > (v2 >= 62)) < ((55 == 22) ? (v3 || v2) : (i0 > a1[1][12])));
+                    v3 = (((v0 <= 17) != (i1 < i0)) > ((v0 ? 47 : 64) + (v1 + 66)));
+                    v3 = (((v3 - v3) + (a1[0][8] == a1[0][9])) != ((i1 + a0[12]) <= (i1 * v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v3 < 28) || (a1[0][10] - a0[5])) && ((a1[0][5] <= v2) >= (v1 >= 73)));
+    if ((((44 <= v0) > (a1[1][7] == 82)) < ((v2 % 6) ? (v1 == 3) : (21 ? v3 : a0[10])))) {
+        v3 = (((v1 && v0) < (a1[1][12] && a0[1])) + ((a1[2][3] + v0) ? (v2 > 21) : (a0[8] * v1)));
+        a0[6] = (((59 < 82) * (v0 >= v1)) != ((v1 || 15) != (87 - v0)));
+        a0[14] = (((a1[0][15] != a1[3][8]) >= (v1 ? a1[0][7] : 61)) >= ((48 < a1[3][15]) && (a1[1][14] % 3)));
+    } else {
+        v2 = (((a0[10] >= v1) <= (a0[15] <= v2)) + ((v0 ? v1 : v0) < (v3 * 39)));
+        v1 = (((v1 * v1) > (v3 ? 75 : 16)) % 9);
+        v0 = (((v0 % 7) ? (v1 * v2) : (v3 > v3)) < ((77 == v1) ? (37 <= v1) : (82 / 9)));
+    }
+    v2 = (((55 <= a1[1][5]) ? (v0 - v3) : (a1[1][3] || v1)) * ((v2 + v3) == (v0 * 72)));
+    return (((v1 / 4) + (v2 != v1)) >= ((v0 ? 52 : 12) < (v1 ? v0 : v1)));
+}
+int f2() {
+    int v0 = 78;
+    int v1 = 82;
+    int v2 = 5;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[2][3] == v2) <= (68 < 82)) + ((v3 + 33) == (a0[7] != 41)));
+    v1 = (((32 && a0[11]) + (v1 - 84)) >= ((v0 <= a1[2][5]) <= (v3 < v3)));
+    if ((((v3 ? v3 : v0) < (88 && v3)) * ((63 != a0[7]) < (a1[0][6] <= a0[3])))) {
+        a1[3][9] = (((a0[10] >= v2) * (v0 >= a1[1][3])) % 7);
+        a0[8] = (((v1 < v2) * (v2 <= v3)) % 2);
+        v1 = (((a0[10] >= a0[3]) - (v1 ? v1 : 70)) * ((a1[1][12] % 2) / 9));
+    } else {
+        v0 = (((62 && v0) - (v0 > v0)) == ((v2 >= a0[4]) != (21 + 59)));
+        v3 = (((v2 - 6) % 3) * ((a1[1][10] < v1) * (97 ? v3 : a0[7])));
+        v0 = (((v1 < v3) >= (35 && v0)) ? ((24 == v3) - (38 > v0)) : ((a1[3][0] == v2) != (a0[9] > a0[1])));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((v1 / 8) > 86) break;
+        a0[6] = (((v2 == v0) % 4) % 7);
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            v3 = (((a1[1][3] / 3) || (a0[10] ? v3 : v1)) || ((v0 - i0) != (v1 <= v1)));
+            v0 = (((i0 % 6) / 7) || ((v3 > v1) || (i0 * 2)));
+            v3 = (((i1 <= a0[12]) - (a0[10] && a0[10])) * ((i1 ? 47 : a0[9]) % 2));
+        }
+        v1 = (((v1 != v2) <= (49 ? v2 : 52)) == ((i0 % 2) >= (i0 <= 32)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v0 = (((9 % 2) % 8) && ((v3 == 1) == (i2 <= 77)));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v1 = (((9 * 39) + (94 > 26)) && ((v0 >= i3) < (v2 - a1[3][1])));
+            a1[3][12] = (((88 || a0[13]) + (i3 * v3)) > ((i2 || v0) || (v2 ? a0[7] : 29)));
+            a1[3][0] = (((v0 || a0[2]) > (a0[6] != 94)) || ((12 ? v0 : v1) != (v1 * v3)));
+        }
+        v3 = (((v1 - 40) != (v0 / 3)) <= ((v2 < v2) ? (88 == v2) : (v3 && 96)));
+    }
+    return (((v3 && v2) || (65 < v2)) / 9);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,45 @@
+int f0() {
+    int v0 = 92;
+    int v1 = 80;
+    int v2 = 90;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((23 - v2) + (a0[10] || v0)) + ((v2 > 97) * (v0 - 44)));
+            v2 = (((a1[2][13] <= v2) > (v1 == v3)) - ((v1 / 9) || (91 < v1)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v2 = (((v1 - v2) >= (v0 <= a1[3][2])) > ((a0[9] + v3) > (69 != i0)));
+                v1 = (((26 * a1[1][10]) || (v0 + a1[2][4])) - ((i1 / 6) == (a1[1][13] == 95)));
+                a1[3][3] = (((a0[3] >= v0) * (a0[3] ? v3 : v1)) && ((v0 * 96) + (v2 / 5)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((19 ? v0 : v3) ? (v3 >= 12) : (82 < a1[1][14])) >= ((a0[1] % 3) - (a0[10] * v2)))) {
+        a1[0][14] = (((v1 >= v0) == (80 == a0[3])) || ((v0 ? a0[5] : v2) || (v2 || a1[2][5])));
+        a1[2][12] = (((a0[6] - v0) / 7) >= ((a0[6] % 9) != (13 + v2)));
+        a0[14] = (((v2 <= 58) + (70 * 10)) + ((a1[0][2] == a1[3][8]) - (a0[11] || 90)));
+    } else {
+        a0[6] = (((v1 - v2) && (a1[3][1] >= v0)) < ((36 % 1) != (68 < v1)));
+        a0[4] = (((v3 == v1) <= (v2 ? v3 : a0[11])) == ((v3 ? v1 : a1[3][9]) * (v3 >= 80)));
+        v1 = (((35 - a1[0][9]) || (v0 / 7)) || ((v2 / 7) && (a0[7] <= a1[0][2])));
+    }
+    if ((((a0[5] != v2) != (v2 || v3)) < ((a1[3][1] && v3) < (a0[11] < v1)))) {
+        v0 = (((v1 <= a0[10]) != (v2 < 61)) >= ((a0[13] % 1) + (30 * 53)));
+        v3 = (((a0[7] + 55) - (74 && v2)) * ((a1[2][15] + v1) == (v0 / 6)));
+        v3 = (((v1 || a0[11]) ? (0 ? v0 : v0) : (v0 || 54)) < ((19 || v1) && (v0 % 3)));
+    } else {
+        a0[3] = (((a0[5] || 77) + (a0[0] && v3)) > ((9 + v2) != (a0[6] >= a1[2][13])));
+        v0 = (((v1 < v1) <= (v3 < a1[0][9])) && ((a1[3][10] - v1) || (a1[2][1] >= 25)));
+        v0 = (((a0[10] ? 87 : a1[3][12]) <= (a0[7] == 71)) % 2);
+    }
+    v3 = (((v3 > v0) < (a1[3][9] != a0[15])) <= ((a0[14] == a1[0][9]) > (a0[7] ? 29 : v2)));
+    v3 = (((v3 <= v3) - (11 % 5)) ? ((v3 >= v3) ? (53 != 96) : (a0[0] || v0)) : ((70 + v1) + (46 != v0)));
+    return (((a1[0][9] ? a0[4] : v2) / 7) % 2);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,127 @@
+int f0() {
+    int v0 = 19;
+    int v1 = 77;
+    int v2 = 0;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    a0[2] = (((v2 ? v0 : a1[3][7]) > (v3 / 3)) && ((a0[15] ? v3 : 53) != (4 > v2)));
+    {
+        int i0 = 0;
+        do {
+            v2 = (((65 && v3) == (29 != a0[10])) % 3);
+            v3 = (((i0 ? a0[0] : 50) * (v2 % 8)) ? ((v1 / 4) || (v1 >= v3)) : ((v3 <= i0) + (a0[3] - a0[9])));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a1[2][9] = (((57 <= a1[3][4]) - (a0[0] == 65)) % 8);
+                v1 = (((v0 >= 26) * (v2 == a1[1][5])) || ((88 > v1) / 4));
+                v3 = (((a1[1][12] + a1[2][15]) - (10 + 97)) <= ((56 % 5) * (v2 < v1)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((a1[0][10] / 5) ? (a0[13] >= 42) : (a0[12] >= v1)) == ((v1 > 93) != (i2 ? a0[11] : v1)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            if ((37 ? v0 : 6) > 99) break;
+            v2 = (((a0[2] < 21) ? (i3 >= 99) : (54 < v1)) - ((a0[0] - v0) || (v0 * 19)));
+            v2 = (((v3 < v2) / 8) >= ((v3 * v2) ? (v3 < v2) : (i2 <= v3)));
+            a1[3][6] = (((a0[5] + 19) > (i2 == a0[0])) > ((a1[3][11] && v0) - (a0[4] >= i3)));
+        }
+        v3 = (((a1[2][12] + v1) == (10 % 1)) <= ((91 < v3) == (74 ? v3 : a1[2][6])));
+    }
+    if ((((57 > v3) && (7 >= a1[1][15])) == ((a0[1] == a1[1][9]) > (a1[0][5] ? v2 : v2)))) {
+        v1 = (((32 + 26) == (49 * 86)) ? ((v1 ? v1 : v0) || (v3 != 17)) : ((3 < v2) + (v3 * a0[6])));
+        a0[5] = (((v1 / 4) ? (12 ? a0[5] : v3) : (a0[3] / 8)) * ((v0 >= 27) * (67 && v2)));
+        v0 = (((94 ? 79 : a0[12]) ? (v0 > a0[9]) : (96 * a0[15])) - ((v0 + a1[1][11]) - (a0[7] >= 3)));
+    } else {
+        v3 = (((66 / 5) != (42 >= a0[4])) == ((v3 % 3) != (a0[10] == v2)));
+        a0[1] = (((92 && v0) / 7) > ((v0 > v3) * (a0[9] >= a0[3])));
+        v1 = (((v3 / 4) == (88 != v0)) % 4);
+    }
+    v3 = (((77 + v3) * (v0 - 6)) || ((a1[1][14] / 5) / 5));
+    return (((1 != v2) * (a0[6] ? v1 : v0)) ? ((72 / 8) * (7 != a1[1][2])) : ((a1[0][5] * v0) != (a0[11] > 78)));
+}
+int f1() {
+    int v0 = 19;
+    int v1 = 28;
+    int v2 = 16;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((84 + a1[1][8]) > 66) break;
+            a0[4] = (((v1 <= v0) != (v2 == 17)) % 3);
+            v0 = (((v1 % 4) >= (85 % 8)) * ((38 && v0) ? (38 == v1) : (v1 || v3)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a0[12] = (((v3 + a1[2][2]) <= (v1 + 29)) >= ((a0[15] ? i0 : i1) == (24 ? v1 : i1)));
+                    v3 = (((v3 || a0[11]) <= (v0 ? 64 : v3)) <= ((v0 - v0) - (i1 ? i0 : v0)));
+                    v1 = (((i0 + v1) - (a1[3][3] * i1)) ? ((a0[6] ? a1[1][8] : 10) / 7) : ((68 - 56) ? (v1 == 46) : (19 <= 86)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v0 = (((82 + 60) >= (i2 < i2)) == ((i2 % 8) != (93 <= 18)));
+            v2 = (((a1[1][0] >= v0) ? (i2 > 54) : (v1 <= 23)) >= ((a0[13] / 7) ? (83 - v0) : (v0 < v1)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((65 % 9) > 78) break;
+                    v3 = (((a1[0][14] != i3) || (a0[13] == a1[0][1])) >= ((a0[4] - i2) ? (a0[11] * a1[3][15]) : (99 / 7)));
+                    a0[13] = (((v1 < a1[1][5]) * (45 - v3)) ? ((62 || 27) > (v1 % 3)) : ((a0[14] && v3) || (v1 || v1)));
+                    v1 = (((i2 % 9) != (10 * v2)) != ((a0[0] && v2) - (v1 ? v3 : i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a1[2][12] = (((a0[1] < v1) < (v1 + v1)) != ((v1 || v3) + (v2 ? v1 : a0[8])));
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            if ((a1[3][4] + 57) > 54) break;
+            v0 = (((v0 <= 80) >= (a1[3][6] + 45)) * ((95 + v1) / 5));
+            v0 = (((27 <= v3) == (v1 / 9)) ? ((v3 == a1[3][6]) != (v2 * v0)) : ((a1[3][11] >= a1[2][1]) ? (v2 && v2) : (v2 >= v2)));
+            v1 = (((v0 % 6) - (v1 <= i4)) > ((82 % 3) / 8));
+        }
+        v0 = (((a1[1][13] > a0[6]) && (a0[14] && i4)) / 3);
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        v2 = (((v3 >= i6) > (4 % 7)) + ((a0[5] + v0) - (v1 > a0[14])));
+        {
+            int i7 = 0;
+            do {
+                v2 = (((61 || 75) - (v1 || v0)) != ((i6 + a1[2][14]) == (a1[2][1] / 3)));
+                a0[8] = (((v1 % 7) * (15 && i7)) != ((82 ? 13 : 69) <= (v1 == a1[1][10])));
+                v2 = (((v0 ? i7 : a1[1][0]) > (64 - a0[12])) - ((v1 * i7) * (87 + 0)));
+                i7 = i7 + 1;
+            } while (i7 < 7);
+        }
+        a0[10] = (((v0 == a1[0][9]) % 4) % 6);
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        v0 = (((a1[2][1] > a1[2][3]) < (v2 <= v3)) / 7);
+        {
+            int i9 = 0;
+            do {
+                v2 = (((a0[0] / 8) ? (85 || i9) : (a0[6] <= v1)) - ((v2 <= i9) != (a1[1][4] == v2)));
+                v1 = (((v3 != a0[0]) != (v2 % 6)) > ((a1[2][2] > i8) < (a0[10] ? 32 : v1)));
+                v2 = (((v2 == i8) >= (a0[15] == v1)) ? ((v2 && v3) || (37 ? v3 : v1)) : ((v0 > v2) - (46 ? v0 : a1[1][15])));
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+        v0 = (((59 >= i8) || (a1[0][15] ? 35 : v1)) || ((v3 != v3) == (a1[0][4] ? i8 : a1[3][2])));
+    }
+    return (((v2 / 1) - (v0 + v0)) && ((25 % 7) != (a1[2][15] != v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,132 @@
+int f0() {
+    int v0 = 68;
+    int v1 = 89;
+    int v2 = 14;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a1[0][1] != 67) + (v2 * v2)) >= ((v0 <= a1[1][5]) % 5));
+    v1 = (((v3 >= v2) * (v1 <= a0[6])) ? ((a1[3][2] != a0[7]) / 8) : ((v2 || a1[1][2]) < (v3 || a0[5])));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v0 = (((a1[1][5] ? 73 : a0[11]) < (i0 >= a1[1][15])) < ((a0[4] <= v1) == (i0 - 45)));
+        v1 = (((54 || v3) <= (91 != 35)) <= ((81 ? 80 : i0) == (74 + 36)));
+        {
+            int i1 = 0;
+            do {
+                a1[2][7] = (((i0 <= a1[1][2]) >= (v3 ? i0 : a0[15])) ? ((a1[0][9] ? a1[1][10] : a0[6]) >= (i1 != 33)) : ((v1 <= a0[5]) || (a0[13] >= i1)));
+                v1 = (((v1 == 36) % 7) ? ((v0 / 5) >= (i1 == v3)) : ((v3 ? v2 : 77) ? (i1 - 18) : (v2 ? a0[12] : 26)));
+                v0 = (((a0[1] < v1) != (i0 > a1[2][7])) && ((i0 / 3) >= (a0[0] * 21)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+    }
+    if ((((v2 == a0[5]) == (v0 <= v0)) <= ((a0[5] || v2) == (30 ? v0 : a1[3][0])))) {
+        v0 = (((33 % 9) / 6) * ((3 - a0[0]) != (12 ? v3 : a0[8])));
+        v0 = (((v3 != v1) && (v1 && v2)) != ((v0 - a1[0][15]) % 2));
+        v0 = (((v2 > v0) % 5) < ((69 || 38) && (a1[0][7] != v3)));
+    } else {
+        a1[2][7] = (((v0 != v3) == (a0[11] - a1[0][13])) || ((64 / 7) != (54 * v0)));
+        v0 = (((v0 ? 80 : v3) || (v1 * 43)) == ((a1[3][3] + a0[4]) * (27 % 8)));
+        v1 = (((a0[8] > v0) ? (v2 ? v1 : a0[3]) : (v2 ? v3 : 26)) % 6);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v1 = (((v0 >= v2) + (a0[12] < i2)) || ((a0[14] <= v2) * (v0 * 69)));
+            v3 = (((i2 == v3) == (v1 - i3)) > ((10 > 71) || (v2 < 33)));
+            v1 = (((88 || i3) + (i3 * i2)) == ((v0 ? v2 : a0[9]) < (v2 ? v1 : v3)));
+        }
+        v2 = (((v1 > a1[0][0]) == (a1[1][6] < v3)) - ((i2 * a0[13]) || (49 - v1)));
+        a1[1][7] = (((a1[0][15] <= v2) - (v3 >= i2)) == ((i2 >= 93) < (i2 != a1[0][6])));
+    }
+    return (((v0 / 9) ? (50 > v2) : (v1 && 69)) * ((v1 != v3) && (v2 * 27)));
+}
+int f1() {
+    int v0 = 55;
+    int v1 = 19;
+    int v2 = 7;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v1 || v3) > 70) break;
+            v1 = (((v1 >= 49) > (42 / 6)) < ((v2 / 6) && (a0[9] / 3)));
+            v3 = (((36 || v2) <= (v2 || a1[2][4])) != ((21 && v0) == (v3 >= a0[14])));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a1[3][7] = (((21 - i0) != (v3 && v1)) > ((v0 + i1) && (a0[14] || i1)));
+                    a0[0] = (((i0 >= 22) != (a0[12] % 7)) != ((i1 > 2) == (68 && v0)));
+                    v3 = (((64 - i0) && (v2 < a0[12])) ? ((v3 / 1) && (v3 / 9)) : ((35 ? v2 : i1) == (90 != v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    a1[3][7] = (((a0[7] ? 51 : a0[5]) / 4) > ((78 == v3) <= (a1[2][12] && v2)));
+    v2 = (((v2 ? v0 : 78) < (a1[2][7] ? a1[2][10] : v3)) == ((63 && v1) % 9));
+    v2 = (((v3 < v0) ? (v0 ? v1 : a0[4]) : (94 && a0[14])) + ((50 * v1) != (a1[2][0] * v3)));
+    v0 = (((a1[0][5] || v2) / 2) && ((a1[3][6] % 6) * (a0[15] || 71)));
+    return (((63 || a0[8]) <= (a0[12] ? v2 : v3)) + ((v0 * 87) / 8));
+}
+int f2() {
+    int v0 = 21;
+    int v1 = 64;
+    int v2 = 64;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v0 == v3) < (v0 >= a0[9])) == ((85 && v2) == (69 + 3)));
+    {
+        int i0 = 0;
+        do {
+            a0[12] = (((v3 || a1[1][12]) ? (i0 != v2) : (v1 * 33)) * ((a1[2][8] ? v1 : a0[8]) ? (v1 < a1[3][6]) : (a1[3][4] ? v1 : v3)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v1 = (((a0[6] <= i0) && (v1 * 57)) * ((i0 || a0[3]) - (v3 - i0)));
+                    a1[3][2] = (((i0 >= v0) > (v1 < i1)) / 1);
+                    a0[5] = (((v0 <= a1[1][8]) * (v0 || a1[0][6])) <= ((v3 == a0[5]) && (21 ? v3 : a1[3][12])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][4] = (((v0 - v3) * (56 && v1)) / 3);
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    v0 = (((v0 ? v1 : v0) * (v3 % 8)) && ((a1[1][8] < a0[9]) + (a1[0][8] >= 36)));
+    {
+        int i2 = 0;
+        do {
+            if ((v3 % 7) > 81) break;
+            v0 = (((96 + v3) < (v2 > 56)) != ((21 % 4) / 3));
+            {
+                int i3 = 0;
+                do {
+                    if ((i2 || a1[1][6]) > 87) break;
+                    a1[3][0] = (((a0[5] / 1) || (v0 + v1)) * ((i2 ? 31 : v3) * (v3 == i3)));
+                    a0[12] = (((v3 < 65) || (i2 != i2)) <= ((36 / 3) ? (i2 + a1[1][0]) : (a0[4] * i3)));
+                    a0[12] = (((v2 ? i3 : a1[2][1]) - (66 < v0)) >= ((v0 <= v3) > (5 - v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a0[2] = (((v3 / 2) ? (v3 % 2) : (v0 % 9)) - ((v1 == v1) ? (v0 && 21) : (v0 == v1)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((41 || a0[5]) == (v2 / 3)) % 5)) {
+        a0[12] = (((a1[1][0] >= 39) && (v3 ? v3 : v3)) > ((v2 == 46) <= (a1[1][7] > v2)));
+        a1[3][8] = (((58 * 27) >= (61 < 39)) || ((90 > v0) && (47 * v0)));
+        v2 = (((16 == 11) ? (v2 <= v1) : (v3 < v0)) * ((a1[2][7] ? v3 : 66) || (a0[11] ? v1 : v0)));
+    } else {
+        v0 = (((a0[1] - a1[3][9]) != (a0[5] + v1)) % 4);
+        v0 = (((v0 < v0) || (v0 % 4)) + ((v2 ? v1 : 36) ? (v1 % 7) : (a0[7] * 34)));
+        v2 = (((v0 > v0) - (v2 ? 8 : v0)) < ((v0 - 77) != (v1 <= a1[0][15])));
+    }
+    return (((v2 > v1) % 2) > ((68 != 6) - (65 / 8)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,80 @@
+int f0() {
+    int v0 = 64;
+    int v1 = 39;
+    int v2 = 23;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    a0[11] = (((92 * a0[4]) / 9) - ((v1 - 31) == (v2 + v2)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((a0[6] ? i0 : v2) && (28 + 84)) && ((v0 % 7) + (v0 + i0)));
+            v0 = (((a0[7] >= v3) >= (a0[2] % 7)) * ((v1 + v3) % 7));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v2 = (((i1 && v2) <= (i0 > v1)) <= ((a1[1][13] < a0[15]) == (v1 * i0)));
+                    v2 = (((45 ? a1[2][15] : v2) <= (v1 <= a0[7])) && ((a0[1] ? a0[9] : v0) < (v0 ? a1[3][9] : 94)));
+                    a0[6] = (((v1 || i1) ? (a1[1][8] == i1) : (i0 > i0)) / 8);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[4] = (((31 > v0) ? (v3 > i2) : (24 && 76)) * ((v3 || 17) * (v1 != 8)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                if ((a1[1][0] || a1[1][7]) > 68) break;
+                a0[7] = (((a0[13] / 3) < (a0[13] || i3)) && ((a0[8] / 1) - (46 != 23)));
+                v2 = (((v2 / 2) * (a1[1][8] < 62)) >= ((v0 ? i2 : i2) >= (v3 ? i3 : a1[1][2])));
+                v3 = (((v1 ? a1[2][1] : i2) != (a1[1][3] ? 98 : i3)) > ((a0[14] + 20) - (a1[0][1] ? v3 : v3)));
+            }
+            v3 = (((a0[11] < v2) <= (a0[7] * a1[2][12])) + ((61 ? v3 : v2) || (62 || v2)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((i4 < 62) > 79) break;
+            v2 = (((v0 + v2) != (a0[10] % 1)) + ((v1 < a1[1][0]) <= (a1[0][5] - a0[11])));
+            v2 = (((i4 / 3) >= (i4 / 4)) - ((24 - a1[1][3]) && (v3 > v3)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((a0[7] < i4) > 95) break;
+                    v3 = (((a1[2][10] == i4) - (80 - a1[1][12])) / 3);
+                    v0 = (((48 + 38) >= (v0 / 6)) >= ((v2 >= 68) * (i5 > i5)));
+                    v1 = (((1 ? i5 : 48) != (86 == 14)) < ((i5 + a0[12]) * (69 + a1[2][10])));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[1] = (((v0 ? a1[3][12] : 2) || (a1[1][15] <= v0)) * ((a0[3] >= 42) ? (a1[0][11] * 86) : (a0[12] >= a1[0][8])));
+            v0 = (((v3 - v3) <= (v2 - a1[2][13])) ? ((58 || 64) == (v3 ? 43 : v0)) : ((a0[8] > i6) ? (v2 ? a1[3][3] : a1[3][8]) : (v1 != 52)));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    v0 = (((v2 + a1[2][7]) > (i6 + v2)) - ((v2 || a1[2][8]) > (97 && a1[2][13])));
+                    v2 = (((v2 ? 54 : a0[14]) % 5) * ((22 >= 93) ? (14 + i6) : (v2 && i6)));
+                    v0 = (((i6 > 75) > (a1[1][1] % 9)) > ((98 ? v3 : 94) || (53 != i6)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((v1 || v0) && (45 && 39)) ? ((v2 >= 25) || (v0 - 42)) : ((23 > v3) && (18 >= a1[2][1])));
+}
+int main() {
+    return 0;
+}
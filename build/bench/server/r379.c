@@ -0,0 +1,85 @@
+int f0() {
+    int v0 = 74;
+    int v1 = 6;
+    int v2 = 82;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v2 || 66) && (a1[0][3] && v1)) - ((v3 - a0[4]) * (v3 + 19)));
+    a0[6] = (((v1 <= a0[15]) / 2) ? ((99 < v0) > (a0[3] >= v2)) : ((v3 ? v1 : v0) + (v1 ? v1 : a1[0][11])));
+    a1[1][4] = (((v0 == v2) * (13 ? 68 : a0[1])) <= ((v2 + 46) * (v0 * a0[1])));
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                a0[14] = (((v1 + v3) * (72 % 4)) > ((v0 && 92) % 7));
+                v1 = (((16 >= v0) || (v2 % 1)) ? ((i0 && i1) != (i0 >= a0[4])) : ((v3 + i1) >= (46 / 7)));
+                a1[2][13] = (((v3 < v1) > (v1 ? v1 : 43)) >= ((1 >= 98) % 3));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((i0 < v2) >= (75 != 26)) == ((v1 || v0) ? (v3 <= a1[1][6]) : (a0[2] + v1)));
+        v0 = (((77 == v1) % 1) <= ((75 == v1) ? (v2 && v2) : (53 ? v0 : v1)));
+    }
+    if ((((v0 / 8) == (v0 >= v1)) == ((a1[0][11] / 5) > (v3 - v2)))) {
+        v0 = (((a0[6] ? 28 : v0) - (a0[6] ? v0 : a1[1][7])) || ((v3 < a0[5]) * (v3 ? a0[13] : a0[9])));
+        v1 = (((7 * v1) >= (v1 ? 91 : a0[3])) || ((v1 ? v1 : v3) < (41 ? 47 : v0)));
+        v3 = (((v3 - v0) - (v1 <= v3)) % 6);
+    } else {
+        a1[0][8] = (((15 ? a1[2][3] : v2) ? (v2 * v1) : (v1 == a1[0][15])) + ((a0[2] < 33) ? (45 < 19) : (34 % 4)));
+        v2 = (((v2 % 8) || (v1 + v1)) <= ((a1[1][9] / 6) == (v2 != v2)));
+        v0 = (((a1[2][9] + v1) <= (v3 == a1[3][11])) ? ((a1[0][5] <= v2) + (v3 % 6)) : ((a1[3][3] - v2) % 9));
+    }
+    return (((v1 >= a1[0][14]) < (97 >= a0[7])) ? ((a0[4] - 82) <= (a0[14] ? 5 : v1)) : ((v2 % 8) == (v2 / 6)));
+}
+int f1() {
+    int v0 = 38;
+    int v1 = 19;
+    int v2 = 99;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v2 != 38) && (a1[3][3] == a0[11])) ? ((4 == a0[7]) < (a0[15] - 71)) : ((v0 && v1) % 8));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((a1[1][12] % 7) > 80) break;
+                v1 = (((v0 % 9) != (a1[0][7] != 2)) % 2);
+                v0 = (((i0 != a1[2][6]) && (v3 * a0[9])) + ((i1 >= v0) < (i1 != 29)));
+                a1[0][15] = (((v0 % 2) <= (v3 != v1)) / 6);
+            }
+            v2 = (((v1 > 24) && (a1[1][4] ? v0 : v0)) == ((v1 ? a0[9] : a1[1][13]) * (99 * a0[8])));
+            v2 = (((16 % 3) % 5) % 3);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((i2 * a1[1][4]) > 92) break;
+                v3 = (((a1[3][3] <= a0[15]) % 3) >= ((a1[2][15] + 17) >= (i2 - 97)));
+                v0 = (((v0 ? a0[0] : 25) ? (v0 < a0[6]) : (a0[11] % 4)) - ((97 || a0[5]) * (28 || 85)));
+                v0 = (((a0[12] > a1[2][4]) > (a0[0] ? 77 : a1[3][1])) ? ((v3 != i3) ? (a0[4] + v1) : (a1[2][6] ? 44 : v1)) : ((i2 + v0) != (a1[1][5] % 2)));
+            }
+            a0[12] = (((v3 > 86) ? (v3 ? v3 : v2) : (i2 != v3)) != ((v3 + v0) || (a1[2][4] == i2)));
+            a0[2] = (((v2 > v1) != (v3 && v3)) * ((v0 / 4) != (a1[0][15] + 55)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((79 >= v0) + (v1 < a1[3][8])) > ((a0[0] - v3) - (89 || a1[1][7])))) {
+        v0 = (((v0 - 53) + (93 * a1[2][7])) >= ((a1[1][11] / 8) && (70 > 39)));
+        a0[15] = (((v3 && v0) < (v2 <= v1)) < ((v2 == v2) ? (2 / 1) : (v2 / 7)));
+        v1 = (((v3 <= a1[3][1]) / 7) - ((98 || 54) > (a0[13] || v2)));
+    } else {
+        v2 = (((a1[0][12] % 6) >= (v2 ? v1 : v2)) - ((v1 ? a0[13] : v0) <= (42 * v0)));
+        v3 = (((v1 != v0) || (v1 < a1[2][15])) < ((v2 ? 37 : a1[1][15]) % 6));
+        v2 = (((v3 || 53) % 2) >= ((v3 / 4) - (a0[11] >= 53)));
+    }
+    v0 = (((37 > a1[0][14]) < (a1[0][0] <= a0[0])) == ((45 || v2) || (v0 <= v1)));
+    return (((v3 < a1[3][7]) + (a0[13] || a1[3][5])) ? ((a1[0][6] ? v1 : 57) && (a0[10] ? a1[0][5] : a0[15])) : ((64 > v0) - (64 ? a1[2][3] : 44)));
+}
+int main() {
+    return 0;
+}
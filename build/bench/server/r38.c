@@ -0,0 +1,216 @@
+int f0() {
+    int v0 = 49;
+    int v1 = 37;
+    int v2 = 85;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[13] && 88) / 4) > ((v1 ? 60 : v2) / 6));
+            v1 = (((a1[0][6] % 1) ? (a0[14] - v2) : (v0 ? v2 : 21)) == ((a1[2][1] + a0[5]) ? (v1 ? v2 : a1[3][7]) : (a0[15] ? 72 : 61)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[2][1] = (((i0 - v1) == (8 / 6)) == ((12 >= i1) ? (23 ? 87 : v2) : (i1 == a0[15])));
+                a0[14] = (((v3 ? v1 : i0) * (v3 % 5)) ? ((v3 != a0[15]) - (i0 == a0[1])) : ((a0[5] <= a1[1][11]) != (v1 ? v3 : 54)));
+                a0[11] = (((a1[1][5] + a1[2][2]) || (a0[9] % 1)) > ((v0 && a0[4]) ? (v1 && v2) : (i1 && 23)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v2 = (((v0 ? a0[10] : v0) ? (6 <= 91) : (13 > v0)) <= ((v1 == 19) && (v0 < v3)));
+                a0[8] = (((i2 % 3) % 1) - ((v1 || 9) ? (95 - i2) : (13 + v0)));
+                v1 = (((v0 < v0) ? (v2 == v3) : (16 ? 32 : 47)) > ((v3 <= v1) * (a1[1][10] == a1[1][9])));
+            }
+            v0 = (((58 || 35) <= (0 % 3)) - ((v0 / 8) ? (15 < 65) : (v2 <= v2)));
+            v2 = (((i2 * a0[3]) > (83 == v2)) < ((v3 < 47) != (82 <= a0[11])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v1 = (((v0 <= a0[1]) > (v1 != 97)) - ((a0[7] + a0[5]) < (93 % 2)));
+                v1 = (((v3 > v0) > (v3 % 3)) || ((a1[3][5] < a1[2][14]) && (v0 > 40)));
+                v0 = (((71 % 9) == (v3 - v3)) < ((43 >= v0) < (v3 && a0[1])));
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((v3 % 1) != (76 && i4)) ? ((v1 != 46) >= (i4 ? v3 : 99)) : ((i4 ? v0 : a1[2][15]) == (v0 >= 28)));
+        a0[15] = (((45 >= 66) + (a0[9] / 4)) * ((v0 != a0[1]) <= (v0 % 3)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((i6 || a1[1][5]) > 57) break;
+            a1[3][0] = (((v3 + a1[0][3]) && (v2 == 61)) > ((89 % 9) / 5));
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v2 = (((i6 ? v1 : i7) && (i6 ? 23 : 91)) >= ((i7 + i7) <= (a0[11] ? 18 : i6)));
+                v3 = (((a0[13] / 5) ? (a0[10] - a0[14]) : (v2 - 66)) < ((v2 <= v2) < (a1[0][14] && v2)));
+                v3 = (((a0[4] ? 88 : a1[3][1]) && (i6 < v3)) >= ((v3 ? i6 : v2) || (20 == 89)));
+            }
+            v0 = (((57 || v2) < (v2 || a1[1][3])) ? ((v1 * v3) + (v0 == 91)) : ((a0[14] == a1[3][15]) ? (a0[14] == v1) : (v2 || a0[3])));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    {
+        int i8 = 0;
+        while (i8 < 7) {
+            v3 = (((a0[2] && a1[1][11]) % 7) / 2);
+            a0[10] = (((44 ? v1 : a1[2][14]) != (7 * v3)) + ((i8 ? a0[10] : i8) - (v1 - 4)));
+            {
+                int i9 = 0;
+                do {
+                    if ((89 * 40) > 86) break;
+                    a0[14] = (((v0 && a0[12]) && (i8 || a1[2][8])) + ((48 > 3) != (92 * v0)));
+                    a0[1] = (((v1 + v1) < (79 && 84)) <= ((a1[2][0] - v2) - (a0[11] && 71)));
+                    a0[3] = (((i9 / 7) || (i8 != v3)) % 9);
+                    i9 = i9 + 1;
+                } while (i9 < 7);
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v2 >= a0[15]) > (43 <= a1[2][3])) ? ((a0[11] && v3) - (a1[2][14] * v1)) : ((a1[2][2] ? a1[0][14] : v1) * (65 && a0[15])));
+}
+int f1() {
+    int v0 = 13;
+    int v1 = 76;
+    int v2 = 31;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a1[0][7] + v0) || (81 + v1)) * ((v3 && a0[14]) - (v3 || 2)));
+    {
+        int i0 = 0;
+        do {
+            v2 = (((31 ? a0[12] : v3) < (v0 ? a0[2] : v3)) == ((66 || 98) != (v1 % 2)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v1 = (((a1[0][7] || i0) >= (a1[0][10] / 1)) && ((v3 - a0[1]) && (v3 == i0)));
+                    v3 = (((i1 ? a1[3][6] : i0) + (a0[7] || a0[14])) < ((a1[2][14] ? i1 : 31) ? (a0[12] % 7) : (a1[2][10] || 27)));
+                    a0[11] = (((i0 - v3) >= (96 ? 52 : v2)) / 9);
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((91 / 6) ? (v2 % 9) : (a1[2][15] * v3)) - ((a0[13] / 3) != (79 >= v1)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a0[4] ? 25 : v3) % 1) + ((78 ? 81 : 72) % 8));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a0[4] != v2) % 1) > ((17 + v2) ? (a0[7] - v0) : (29 ? 0 : a1[1][10])));
+                    v0 = (((a1[1][9] ? a1[2][2] : i2) % 7) && ((i2 ? 35 : 66) >= (40 ? 90 : v1)));
+                    v1 = (((17 == 40) - (v3 ? v0 : 89)) != ((a1[1][13] <= i2) && (50 - 0)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v1 = (((a0[0] ? v3 : 67) <= (v1 || v2)) - ((v1 != 70) ? (89 + v0) : (a0[8] ? v0 : v1)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((v0 + 4) && (v2 < v3)) < ((v1 == a0[9]) <= (v3 || a0[14])))) {
+        v0 = (((v1 ? a0[7] : v3) && (v2 % 6)) || ((72 ? a0[12] : a0[3]) != (v1 ? v2 : v0)));
+        a0[2] = (((v0 && 30) > (v1 - 76)) - ((v3 + v3) / 4));
+        a1[1][1] = (((a0[13] == a0[3]) ? (66 ? v0 : 9) : (v3 + v2)) != ((v0 ? 40 : v1) ? (a0[13] % 2) : (v1 <= v2)));
+    } else {
+        v2 = (((v1 < 75) > (a0[3] + v0)) + ((v1 + v3) != (v0 < v0)));
+        a1[2][0] = (((v0 <= v1) ? (a1[0][4] || a0[12]) : (v3 < v3)) != ((17 ? a0[14] : v1) || (27 + v2)));
+        v3 = (((v3 * 2) != (4 / 2)) - ((42 < v3) && (v3 * v1)));
+    }
+    v1 = (((76 * v1) ? (32 == v3) : (71 <= a1[1][5])) + ((8 / 2) ? (v0 < 48) : (v3 >= a0[7])));
+    return (((44 ? 42 : a0[3]) % 7) || ((10 / 5) * (a1[3][11] < a0[7])));
+}
+int f2() {
+    int v0 = 98;
+    int v1 = 0;
+    int v2 = 93;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v3 * 57) > 55) break;
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a0[5] * a1[3][13]) >= (80 * a0[1])) || ((i1 / 8) / 5));
+                    a1[3][5] = (((v3 < a1[0][8]) >= (9 <= v1)) != ((v1 + 38) / 2));
+                    a0[13] = (((a1[0][6] * v0) && (26 ? 28 : 1)) != ((i0 <= v2) >= (i0 - i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a0[3] = (((v0 >= 83) ? (v3 == 18) : (v1 / 1)) * ((60 == a0[1]) / 6));
+            v1 = (((v2 > 68) >= (v1 % 4)) + ((v2 <= v1) <= (v2 == v3)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((v0 >= a1[2][15]) || (v2 ? 59 : v2)) || ((45 >= 99) ? (v0 >= 58) : (59 <= v2)))) {
+        v3 = (((v0 > v0) == (v1 <= v0)) * ((v1 ? v0 : v0) || (a0[7] % 7)));
+        v3 = (((59 || a1[0][7]) - (v0 || v1)) ? ((v0 % 8) + (a1[2][3] ? v2 : v0)) : ((78 + 17) ? (3 > v2) : (a0[12] + a0[7])));
+        a0[1] = (((a1[2][9] * a1[0][7]) > (a1[3][14] || a1[0][3])) ? ((a1[3][1] <= a0[11]) / 2) : ((1 + v1) ? (93 && a1[1][3]) : (33 / 6)));
+    } else {
+        v3 = (((v1 / 2) <= (6 ? a1[2][0] : v2)) || ((78 >= 85) || (v1 ? a1[1][10] : a0[5])));
+        a1[3][4] = (((19 ? v3 : a0[7]) / 9) * ((a1[0][9] + a1[2][14]) / 1));
+        v1 = (((87 ? 49 : a1[1][2]) + (8 < 21)) >= ((v0 != 89) && (64 && v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a0[11] || 28) <= (v2 == 61)) == ((a0[6] <= i2) / 4));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v0 - i3) || (v2 % 4)) - ((87 % 3) == (v1 || v0)));
+                    v0 = (((a1[2][5] - 17) > (a0[15] == i3)) < ((a0[10] ? a1[3][6] : a1[3][11]) ? (v1 >= 36) : (v2 - 97)));
+                    v2 = (((41 / 7) + (v3 ? 25 : i3)) + ((v0 + a0[4]) * (50 - a1[3][8])));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v1 = (((i2 <= a0[3]) >= (v2 / 7)) <= ((v1 > v0) >= (v2 - v2)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((62 ? 8 : v1) > (a1[3][6] || v0)) >= ((v1 * a1[0][11]) > (a1[0][6] - 81)))) {
+        v2 = (((v0 / 7) > (48 + v1)) <= ((v0 + v3) || (v2 >= a1[2][2])));
+        v0 = (((0 / 7) < (45 ? v2 : 49)) ? ((a1[0][15] ? v1 : a0[8]) && (a0[1] ? a1[0][7] : v3)) : ((v3 < v1) < (v0 / 3)));
+        a1[3][8] = (((v3 || v1) <= (v1 + a1[3][1])) ? ((a1[3][2] - a1[3][5]) + (1 <= v3)) : ((a0[7] ? a1[0][5] : 47) < (a0[14] ? v2 : a1[2][0])));
+    } else {
+        v1 = (((0 || a1[1][11]) + (v0 != v1)) * ((83 ? v3 : 53) - (72 <= v3)));
+        v0 = (((50 || v2) != (6 ? 81 : v0)) ? ((a1[2][14] && v0) + (v2 >= 87)) : ((v2 <= 98) ? (a1[2][6] % 2) : (v2 * v0)));
+        a1[0][6] = (((90 >= 4) - (38 == v2)) + ((v2 > a0[3]) > (v0 < 20)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v0 ? i4 : i4) < (62 - v0)) >= ((v1 || v3) * (v1 ? a0[13] : a0[15])));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                a0[13] = (((45 != v1) || (a1[3][11] || v0)) ? ((i5 + a0[1]) == (76 < i4)) : ((94 + a1[1][11]) || (a1[1][9] < v3)));
+                v0 = (((6 / 5) ? (7 >= v2) : (a0[2] != a1[2][11])) <= ((i5 <= 14) <= (87 >= v0)));
+                v0 = (((v0 * a0[6]) * (i5 - a1[2][8])) == ((v3 ? 25 : i5) >= (44 % 1)));
+            }
+            a1[2][12] = (((53 == v0) ? (i4 < v1) : (78 || i4)) % 6);
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((v3 >= a0[2]) < (a0[5] || a1[1][14])) ? ((a0[6] == 74) > (a1[1][1] + a0[4])) : ((v0 && v0) < (v3 < v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
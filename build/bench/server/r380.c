@@ -0,0 +1,177 @@
+int f0() {
+    int v0 = 25;
+    int v1 = 59;
+    int v2 = 91;
+    int v3 = 63;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 < v2) % 4) || ((3 ? v3 : 60) <= (a0[13] && a1[0][9])))) {
+        v2 = (((a0[2] <= v2) != (v0 || 64)) <= ((v3 % 3) * (74 ? v1 : v0)));
+        v1 = (((v2 && 80) != (v0 / 2)) >= ((v3 ? a1[0][13] : 97) >= (v0 || a0[8])));
+        v3 = (((64 ? v2 : v1) - (v2 != v3)) < ((a0[11] ? v2 : v1) ? (v0 / 1) : (v1 / 8)));
+    } else {
+        a1[1][4] = (((v2 % 5) >= (v1 && 28)) < ((21 == a0[9]) || (v0 || a1[2][4])));
+        v1 = (((a1[1][3] + v2) ? (a0[3] >= v0) : (v1 && 18)) == ((8 <= a0[9]) == (a0[3] <= a0[8])));
+        v2 = (((71 > 75) || (v0 || 11)) / 7);
+    }
+    v3 = (((v3 >= v3) + (61 >= 47)) && ((a1[1][10] * 55) || (4 || v3)));
+    a1[2][1] = (((a1[2][8] - a1[1][11]) - (a1[3][5] >= 63)) < ((v2 ? v0 : v0) + (v3 / 9)));
+    if ((((90 || a1[1][6]) && (a1[3][13] + a1[0][1])) - ((v1 ? v2 : v0) >= (v3 + v2)))) {
+        a1[0][15] = (((a1[0][0] ? v3 : v2) > (a1[0][7] + v0)) && ((a1[0][8] - a1[3][15]) ? (v0 > v2) : (v1 / 7)));
+        v0 = (((v1 + v0) == (v1 * v1)) != ((v0 * a0[4]) % 6));
+        v1 = (((a1[3][12] && a0[13]) < (v2 ? 91 : a0[11])) && ((v0 ? v0 : v2) / 8));
+    } else {
+        a1[2][8] = (((12 || v1) % 3) * ((v0 >= v3) * (a0[1] < v1)));
+        v1 = (((a0[10] - v3) >= (v1 * v1)) != ((v2 != v0) % 2));
+        a1[3][15] = (((v1 + v0) % 8) ? ((v1 - v3) * (v1 <= a0[4])) : ((v2 && a0[10]) == (a1[1][0] ? v1 : v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            {
+                int i1 = 0;
+                do {
+                    if ((v0 > v2) > 54) break;
+                    v0 = (((4 <= a1[2][1]) && (i1 >= i0)) && ((v0 == 98) % 7));
+                    a1[2][0] = (((v2 != a1[0][9]) == (70 * v0)) % 4);
+                    a0[1] = (((v1 ? i0 : 30) > (11 + i0)) * ((v3 <= v0) ? (i1 && v2) : (a1[2][7] != i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v1 = (((v3 != v1) != (a1[3][10] > a0[11])) < ((v2 < i0) && (a0[5] % 5)));
+            a1[0][10] = (((a0[1] <= v2) / 3) < ((i0 * v3) > (a0[10] * i0)));
+            i0 = i0 + 1;
+        }
+    }
+    return (((v2 > 11) <= (a1[1][9] || a0[6])) == ((a1[0][15] <= a1[3][13]) < (54 * 3)));
+}
+int f1() {
+    int v0 = 93;
+    int v1 = 19;
+    int v2 = 95;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 < 38) - (a0[6] >= 38)) - ((a1[1][7] + a1[0][1]) != (30 * a1[1][9])))) {
+        v0 = (((v3 != a1[1][5]) != (a1[3][5] || v2)) + ((a0[2] ? a0[9] : v2) <= (v2 <= 33)));
+        v0 = (((a1[3][12] >= 94) == (v1 + a1[1][11])) > ((v0 >= a0[10]) + (a0[7] != v3)));
+        v0 = (((v3 ? v3 : 3) && (a1[1][5] / 1)) / 5);
+    } else {
+        a1[2][12] = (((73 ? v3 : v0) ? (99 <= a1[3][14]) : (a1[2][7] < v0)) % 8);
+        v3 = (((v1 + v2) == (v2 % 9)) > ((a1[0][6] + v1) ? (v2 % 8) : (68 ? 47 : v0)));
+        v2 = (((a0[14] <= v1) / 1) - ((14 ? 95 : v3) % 1));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((v0 >= v3) > 73) break;
+            v0 = (((39 > v2) < (i0 ? 85 : a0[9])) == ((v3 && v3) * (i0 < 67)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((77 != a1[1][15]) > 68) break;
+                v2 = (((v0 != a0[14]) >= (29 != 78)) - ((v0 < v3) ? (i1 > 62) : (a0[1] / 4)));
+                v3 = (((v3 / 8) * (v2 >= 77)) > ((v3 || a0[9]) ? (i1 == v2) : (a0[7] < i1)));
+                a0[5] = (((a0[14] != i0) * (13 <= v3)) + ((v0 % 9) % 3));
+            }
+            a1[3][3] = (((v3 <= a1[1][5]) > (v2 > v1)) ? ((68 > 60) >= (v1 / 2)) : ((11 > v2) && (v2 / 4)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a1[0][4] = (((v0 * v2) ? (36 + 88) : (i2 == v1)) + ((51 ? 97 : 92) % 1));
+            v0 = (((47 - i2) > (79 > v2)) * ((43 * a1[2][13]) == (v3 != 74)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a0[8] = (((a1[0][11] - a0[1]) / 2) ? ((a1[0][0] >= a1[0][11]) ? (v2 != 87) : (i3 ? a1[1][4] : 5)) : ((v1 ? v1 : i3) && (a1[1][15] > 29)));
+                a1[2][15] = (((a0[12] + v0) / 1) ? ((96 - a0[15]) + (a0[3] || v1)) : ((v0 / 8) + (a0[2] - a0[2])));
+                v3 = (((v2 >= i2) ? (57 != v0) : (i2 >= a0[10])) - ((i3 + v2) / 9));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    if ((v1 + a0[9]) > 54) break;
+                    v3 = (((6 && 98) ? (21 != v3) : (58 / 6)) >= ((74 + 29) && (51 < 39)));
+                    v0 = (((v2 + v1) != (v2 - v3)) + ((a0[4] - i5) <= (i4 >= 27)));
+                    v0 = (((i5 >= i5) + (1 < v2)) > ((a1[0][14] != a1[0][10]) % 1));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            a1[1][7] = (((v0 - a0[3]) - (i4 < 9)) == ((i4 && a0[13]) == (i4 + 2)));
+            v3 = (((v1 ? i4 : v0) || (v2 || v3)) < ((a1[3][1] < i4) || (v1 ? 69 : v2)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    if ((((v1 >= v2) || (v3 - 54)) <= ((a1[3][14] % 6) < (v3 == v3)))) {
+        v2 = (((v2 - v0) && (v0 && 19)) / 5);
+        v2 = (((v0 + v1) <= (a1[2][2] ? 19 : 17)) && ((59 || v2) - (v1 ? 57 : 65)));
+        v3 = (((a0[10] / 7) * (45 < 11)) / 3);
+    } else {
+        v0 = (((v2 >= v2) || (69 < v2)) + ((61 != v2) == (a0[12] % 7)));
+        v2 = (((v3 / 8) != (6 && v2)) && ((v2 >= 21) > (v1 + v1)));
+        v3 = (((v1 + v0) ? (v1 * a1[0][7]) : (v2 >= a0[14])) ? ((84 < a1[2][13]) / 8) : ((v3 < v2) <= (49 || 46)));
+    }
+    return (((v2 % 8) <= (v3 / 4)) > ((a0[7] == v2) == (v0 / 6)));
+}
+int f2() {
+    int v0 = 31;
+    int v1 = 82;
+    int v2 = 0;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v0 = (((v2 ? 49 : v0) ? (a1[2][6] < i0) : (v3 > a0[7])) * ((v2 / 9) >= (v2 >= v3)));
+            v0 = (((v2 * a1[3][6]) < (v3 ? a0[12] : v2)) || ((v0 ? v2 : v1) && (a1[0][5] + v2)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((i1 < v1) > 80) break;
+                    a0[6] = (((v1 <= 61) ? (52 % 6) : (a0[9] != a0[7])) - ((a1[2][7] + a0[10]) + (a1[2][10] * i1)));
+                    a0[1] = (((i0 != v2) * (i1 == i1)) || ((90 + i1) + (73 + v1)));
+                    a1[0][14] = (((a1[3][14] >= v2) == (v2 >= 98)) != ((v0 || 58) ? (v1 / 5) : (a0[3] > v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v3 ? v1 : v0) >= (v0 && 90)) <= ((v0 % 4) > (v2 <= v0)));
+    v1 = (((46 <= 70) + (v0 ? v0 : 58)) % 8);
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((v0 ? v3 : 27) > 71) break;
+        {
+            int i3 = 0;
+            do {
+                if ((a1[0][1] || v0) > 86) break;
+                a1[3][8] = (((v2 - 5) == (a0[4] % 8)) + ((33 - i2) <= (4 != v1)));
+                v0 = (((v2 < a1[3][0]) != (a0[6] <= 48)) || ((a1[2][0] == v3) >= (v2 - v3)));
+                a1[0][3] = (((v2 - v1) && (a1[3][15] <= 86)) % 9);
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        v3 = (((v2 ? v0 : a0[12]) + (a1[0][6] ? i2 : i2)) + ((v1 > 16) + (v0 * v1)));
+        v0 = (((77 >= v3) % 1) >= ((v3 >= v0) + (a0[11] > v1)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((v3 % 2) > 50) break;
+        a1[0][12] = (((v2 - 14) == (v1 >= 16)) % 8);
+        a1[0][14] = (((17 && 58) ? (65 == a1[3][8]) : (i4 < a1[2][15])) + ((v1 * v0) ? (44 <= 87) : (56 / 2)));
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v1 = (((i5 % 1) % 9) ? ((33 >= 33) % 5) : ((33 ? v1 : v2) % 8));
+            v2 = (((a0[1] > v3) > (i5 ? 62 : i4)) - ((a0[15] && 60) + (v1 && v3)));
+            v1 = (((a1[1][13] - v0) % 7) > ((a1[0][10] - 81) == (41 || v0)));
+        }
+    }
+    return (((22 && a1[3][14]) <= (v2 != v1)) / 6);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,69 @@
+int f0() {
+    int v0 = 20;
+    int v1 = 59;
+    int v2 = 33;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][12] >= 59) <= (8 >= v2)) != ((v0 > v2) ? (a0[5] != v0) : (v1 < v1)))) {
+        v3 = (((a1[3][12] + v2) * (v3 <= a0[2])) || ((v0 ? v2 : v1) ? (v0 > v1) : (v2 != v0)));
+        v3 = (((v3 > 47) <= (53 - a1[2][12])) <= ((a1[0][5] - a0[9]) != (a1[0][11] && 11)));
+        a0[2] = (((v0 <= v0) - (v2 != a0[4])) || ((a0[12] && a1[0][1]) != (v1 / 1)));
+    } else {
+        v2 = (((a0[13] < v2) + (v3 < v2)) == ((a0[0] < v1) || (73 + a1[3][6])));
+        v1 = (((a0[5] >= a1[0][12]) + (a1[1][3] ? v1 : 11)) / 6);
+        v1 = (((a0[3] * v3) ? (a0[12] < 2) : (86 - v2)) != ((a0[4] >= a0[9]) / 4));
+    }
+    if ((((v3 == a1[3][6]) != (v0 * v3)) - ((v2 && 79) && (26 + a0[0])))) {
+        v0 = (((77 % 6) > (v1 % 3)) < ((36 && v0) / 6));
+        v3 = (((98 <= v0) * (a1[2][3] - a0[6])) - ((v1 == 8) > (v0 - 74)));
+        v0 = (((a1[0][11] >= a1[0][2]) > (a1[2][3] <= v0)) <= ((a0[0] % 1) % 9));
+    } else {
+        v1 = (((a0[8] <= a0[0]) == (32 / 8)) < ((v1 != v3) <= (9 + 51)));
+        v1 = (((v3 > 82) >= (v1 || v0)) < ((40 * a1[0][12]) ? (v1 && v0) : (41 ? v3 : 46)));
+        v2 = (((a1[1][14] ? a0[7] : a1[0][4]) ? (v2 + 3) : (59 > v1)) || ((v3 <= v1) == (a1[0][8] || v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v0 = (((i0 - a1[0][12]) <= (v3 || v3)) > ((56 != a0[14]) != (i0 > a1[0][3])));
+            a0[6] = (((15 * 85) + (a0[14] + 34)) == ((a0[4] % 1) <= (90 - 5)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a0[11] = (((i1 ? 37 : a0[11]) ? (a1[3][7] / 6) : (v1 && v2)) + ((a0[10] + a0[5]) || (v1 - v0)));
+                    v0 = (((82 ? i1 : a0[10]) * (v2 && v0)) && ((i0 && a1[2][10]) ? (a0[5] ? 12 : a0[3]) : (84 && v0)));
+                    v3 = (((v1 && i0) || (v1 % 3)) ? ((v0 && 5) + (v3 % 7)) : ((4 / 1) + (a0[13] ? i0 : 59)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            v3 = (((a1[1][15] % 4) % 7) >= ((41 - i3) ? (57 && i2) : (i3 % 2)));
+            a1[1][8] = (((a0[7] < v2) != (v1 < v3)) >= ((v3 % 4) <= (93 != v3)));
+            a1[3][0] = (((a0[10] + 36) ? (v1 == a1[1][6]) : (37 && a1[0][7])) + ((v1 != a0[0]) ? (i2 == a1[0][6]) : (a0[5] < v2)));
+        }
+        v3 = (((24 % 9) == (a1[2][4] > v1)) != ((57 % 3) - (2 <= 2)));
+        v0 = (((20 < v3) == (i2 && i2)) > ((v0 > v1) / 4));
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v2 = (((a1[0][15] < v0) + (v2 ? v3 : i4)) % 6);
+        a1[2][14] = (((a0[15] >= a0[6]) - (34 ? v2 : 33)) || ((v2 % 4) * (v1 || v0)));
+        {
+            int i5 = 0;
+            do {
+                a0[9] = (((66 <= a0[12]) ? (74 != i5) : (a1[2][11] > a0[3])) < ((i4 >= i4) < (a0[12] != a1[3][14])));
+                a0[2] = (((v0 || a1[0][2]) * (v1 || v0)) / 9);
+                a1[3][1] = (((a1[2][11] + v3) != (a0[6] - a1[1][8])) && ((v1 % 1) && (v1 != a1[2][0])));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+    }
+    return (((v3 > v3) / 3) < ((v2 % 2) != (a0[3] >= a0[0])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,134 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 23;
+    int v2 = 85;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((2 == 82) > 97) break;
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((i0 < v0) || (20 > 34)) > ((a0[2] > v0) ? (v2 + 99) : (2 / 4)));
+                    v0 = (((v3 > v0) / 2) ? ((a0[9] != a0[4]) / 9) : ((i1 > v2) + (v0 < a1[2][8])));
+                    v3 = (((a0[12] >= v1) - (47 <= i1)) == ((i1 ? a0[1] : v1) == (i1 / 3)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v0 = (((v0 + v0) % 2) ? ((a0[0] > v0) + (v1 ? i0 : i0)) : ((a1[2][4] || 12) % 6));
+            v3 = (((v1 >= v0) - (32 % 8)) != ((i0 * i0) == (45 == v1)));
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((99 < v3) % 4) - ((v0 >= v1) / 2));
+    {
+        int i2 = 0;
+        do {
+            if ((a1[3][9] ? v2 : v1) > 66) break;
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                a0[0] = (((a0[4] || v1) < (v2 ? v0 : i3)) < ((i3 == i3) || (a0[2] + a1[2][10])));
+                v2 = (((v1 && 75) <= (v2 ? 66 : a1[3][10])) ? ((2 <= v3) + (66 * v2)) : ((59 + v2) / 1));
+                v1 = (((65 && i3) && (a1[1][1] / 9)) + ((a1[3][14] / 7) ? (a0[15] >= 95) : (i2 > a0[2])));
+            }
+            a1[1][0] = (((43 <= a0[10]) ? (v3 && a0[10]) : (i2 > v0)) / 4);
+            a0[7] = (((4 >= a1[3][7]) / 1) == ((v3 > 2) <= (a0[7] < v2)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    if ((i4 / 9) > 99) break;
+                    a1[0][15] = (((a0[14] - v2) * (53 < v1)) - ((78 * v3) * (73 || 35)));
+                    v0 = (((a0[0] == a1[2][9]) ? (v1 % 9) : (a1[3][12] && a0[10])) ? ((a0[0] ? v0 : a0[9]) ? (55 % 4) : (v1 * a1[1][15])) : ((a1[0][11] * 43) / 2));
+                    v0 = (((1 < v2) ? (i4 <= v0) : (9 && 52)) * ((a0[10] && a0[14]) - (v3 >= a1[2][1])));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v1 || v2) ? (v2 * i4) : (82 == v2)) ? ((90 / 9) == (i4 <= v3)) : ((v0 != v2) > (a0[11] / 9)));
+            v3 = (((a1[1][15] && i4) && (v0 * a1[0][14])) != ((a1[2][11] % 3) + (a0[12] != a0[9])));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        a0[9] = (((56 || v1) > (90 || a0[11])) - ((v1 % 6) == (i6 >= v0)));
+        v2 = (((a0[14] <= v1) && (a0[7] ? a1[2][14] : v2)) != ((v3 / 8) ? (11 != a0[14]) : (a0[8] < v1)));
+        {
+            int i7 = 0;
+            while (i7 < 5) {
+                v1 = (((v0 * a0[10]) > (4 < v0)) * ((i7 > 28) && (v2 && i7)));
+                a0[10] = (((v0 * a1[0][4]) != (v3 == a1[2][7])) - ((78 != 40) <= (92 && 84)));
+                v2 = (((78 ? v1 : 11) * (v1 / 5)) >= ((v1 / 4) <= (i7 || a1[0][5])));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    return (((v2 + 0) + (92 ? 76 : v0)) ? ((v1 ? v1 : v1) % 4) : ((36 ? a1[0][14] : 50) - (55 && 78)));
+}
+int f1() {
+    int v0 = 56;
+    int v1 = 65;
+    int v2 = 18;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a0[6] = (((20 + v0) && (32 < v3)) / 5);
+            v3 = (((50 >= a1[1][15]) < (a1[3][8] != v2)) / 1);
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                a1[1][14] = (((v1 > v0) ? (v2 && 9) : (a1[2][14] < v0)) - ((a0[5] && 74) > (v1 % 7)));
+                a0[5] = (((47 % 1) - (i1 > a1[3][13])) ? ((i0 * i1) % 4) : ((v0 <= a1[0][2]) == (i1 ? v2 : i1)));
+                v3 = (((i0 <= v1) || (i1 || v0)) <= ((i0 <= 2) * (40 % 4)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 < v0) != (a1[2][4] ? v0 : v1)) < ((1 * a1[1][12]) >= (v1 >= v2)))) {
+        a1[2][13] = (((a0[10] < 76) + (v1 / 3)) != ((v0 == v0) % 7));
+        v0 = (((a1[0][4] == a0[11]) && (v1 >= a0[12])) % 9);
+        v2 = (((14 - a1[1][2]) * (v2 ? v3 : v0)) % 1);
+    } else {
+        v3 = (((v2 ? v3 : a1[2][9]) >= (v1 == 18)) < ((a1[1][9] == v1) == (v3 <= v2)));
+        v3 = (((a0[7] ? 93 : a1[0][14]) + (v3 > 58)) && ((v2 != v3) + (v3 / 6)));
+        a0[9] = (((48 || a1[2][11]) * (a1[1][14] > a1[0][8])) + ((v3 >= 31) * (56 && 67)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v2 = (((i2 > v2) + (v1 || v1)) + ((54 > a0[3]) - (v2 <= v1)));
+            v1 = (((i2 == v3) == (a1[2][1] && a1[3][4])) > ((a1[1][1] ? 39 : a1[3][2]) ? (v1 > 53) : (v3 != a0[6])));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a1[0][13] = (((a1[2][12] * a1[2][9]) == (v2 == a1[0][0])) - ((a0[12] > v2) > (44 + 87)));
+                a1[3][6] = (((a0[10] == a0[15]) % 7) ? ((a0[2] != v3) - (a1[0][2] % 6)) : ((4 && a0[10]) ? (v3 * v0) : (v0 >= v2)));
+                v3 = (((18 ? 18 : a0[12]) / 6) == ((1 > i3) != (v0 >= v0)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v3 >= a1[0][1]) >= (v3 ? v3 : v0)) % 6);
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v0 = (((a1[0][7] - 48) <= (v3 ? v0 : a1[0][7])) ? ((v0 * i4) != (1 == v2)) : ((a0[4] <= a1[0][7]) >= (v1 / 7)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v2 = (((v3 == a0[7]) / 5) < ((i5 == 83) >= (v2 == a1[1][9])));
+                v2 = (((8 <= a1[1][3]) * (a1[2][12] - v3)) > ((7 == 94) ? (a1[2][10] ? i5 : 37) : (a0[7] ? a0[4] : i5)));
+                v3 = (((88 % 6) * (a1[1][13] < a1[3][6])) == ((v1 == a0[12]) > (v0 && i5)));
+                i5 = i5 + 1;
+            }
+        }
+        v0 = (((48 + i4) || (a0[7] != i4)) - ((54 || i4) ? (v3 / 3) : (92 < v0)));
+    }
+    return (((a0[10] && a1[1][15]) * (73 % 5)) == ((v3 < a0[12]) != (v1 > 40)));
+}
+int main() {
+    return 0;
+}
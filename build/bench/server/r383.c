@@ -0,0 +1,187 @@
+int f0() {
+    int v0 = 94;
+    int v1 = 53;
+    int v2 = 91;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v1 = (((v1 && 63) != (v3 ? 12 : a1[3][11])) > ((29 == v0) % 6));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v3 = (((a0[0] != v3) ? (17 >= 25) : (a1[0][8] / 3)) - ((a1[0][1] / 9) >= (13 % 5)));
+            v1 = (((a1[1][9] % 4) / 5) != ((a0[9] + a1[3][3]) || (28 ? a1[3][5] : v3)));
+            a1[0][7] = (((v1 - 41) ? (66 != i0) : (73 >= a0[10])) || ((53 <= v0) % 5));
+        }
+        v0 = (((v2 < v2) > (v2 && a1[2][2])) * ((a1[2][5] > 1) - (a1[1][5] || a1[2][7])));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v1 = (((a0[7] >= v1) > (v2 ? v2 : a1[0][0])) + ((a1[1][7] > 8) != (41 || v1)));
+        v1 = (((25 || 38) && (v1 - a0[8])) + ((v3 != v2) == (23 / 3)));
+        {
+            int i3 = 0;
+            do {
+                v1 = (((a0[13] % 8) + (a0[1] ? a1[3][11] : v1)) > ((47 ? v1 : i2) <= (55 >= v1)));
+                a0[14] = (((v1 < v1) ? (80 <= v0) : (v2 ? 20 : a0[13])) == ((v2 || i3) % 8));
+                v1 = (((a1[2][7] <= v3) ? (33 && 16) : (88 <= v1)) / 1);
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v2 % 8) != (v1 * v1)) % 4);
+            v3 = (((v3 <= v0) ? (v1 / 3) : (a0[5] / 2)) < ((v2 * a1[2][3]) >= (i4 <= i4)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((a0[6] ? 35 : 7) != (i4 < a1[1][4])) ? ((a1[3][0] < i4) * (4 - a1[2][5])) : ((v0 != i5) - (25 < a0[3])));
+                    v0 = (((a0[12] != v1) >= (4 % 4)) <= ((v0 < a1[1][3]) <= (39 - 94)));
+                    v1 = (((i5 == v3) > (87 ? 17 : v2)) > ((a0[4] == i4) > (84 && 73)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    if ((((92 ? a0[9] : 66) - (22 && 86)) < ((v3 / 1) / 6))) {
+        a1[1][6] = (((74 == a0[3]) - (v1 == v0)) > ((v2 >= v3) <= (96 >= 18)));
+        a1[0][0] = (((v3 ? a1[3][9] : v2) && (a1[3][10] >= 83)) ? ((a0[7] ? 26 : v1) * (v2 - 90)) : ((v3 % 6) > (32 > v3)));
+        v1 = (((a1[3][8] * a1[0][7]) >= (v0 <= a1[3][7])) >= ((v1 > v2) > (6 >= v2)));
+    } else {
+        v3 = (((v0 || v3) && (v2 && 82)) + ((v3 || a0[12]) * (v1 && v1)));
+        a0[10] = (((a1[1][12] <= v1) ? (v0 / 1) : (a1[2][0] - v3)) != ((v3 ? v3 : 23) != (a0[5] && v1)));
+        v3 = (((66 >= v1) != (v0 || v3)) - ((v3 % 6) + (a0[10] + 45)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[6] = (((v2 ? 86 : 72) / 8) * ((v0 <= v3) ? (a1[3][7] != v0) : (v3 ? 26 : a0[14])));
+            v0 = (((1 + 18) == (a1[3][8] >= v2)) * ((v3 - v2) < (a1[1][2] + 19)));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((i6 ? 40 : v0) % 1) != ((4 ? v1 : v3) / 5));
+                    a1[2][8] = (((v1 || 81) - (a0[14] <= a1[0][0])) ? ((i7 > i6) > (v2 != i6)) : ((56 > i6) % 8));
+                    a0[4] = (((a1[3][10] % 9) + (v0 ? a1[1][3] : a1[2][15])) % 4);
+                    i7 = i7 + 1;
+                } while (i7 < 4);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((75 == a1[2][5]) % 7) || ((v1 % 1) * (v2 + 28)));
+}
+int f1() {
+    int v0 = 36;
+    int v1 = 82;
+    int v2 = 32;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((60 <= 52) > (a0[9] % 7)) >= ((v0 * a1[3][15]) != (a1[0][0] - 59)));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v3 = (((v3 % 7) <= (i0 - 83)) - ((v0 / 1) - (a0[5] >= a1[2][4])));
+            v1 = (((76 || a0[7]) && (i0 + v2)) || ((a0[6] == v0) > (a1[0][5] <= a1[2][1])));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v3 = (((v2 != 57) != (4 == v1)) ? ((i1 % 5) % 7) : ((a1[2][13] ? i1 : i1) ? (v3 && 48) : (v1 || v1)));
+                a1[1][9] = (((i1 / 9) * (v2 + v0)) >= ((a1[2][2] || v0) ? (a0[13] > 30) : (v1 ? v0 : v1)));
+                v3 = (((a0[2] ? a1[1][7] : 87) * (v0 - v0)) == ((a1[0][5] / 4) >= (v1 + i0)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((v2 >= v2) != (a0[7] || a1[2][2])) + ((45 % 5) - (a0[11] % 4)));
+                v1 = (((v2 > i2) == (i2 * 13)) && ((89 <= v0) < (i2 ? 47 : a1[2][11])));
+                v0 = (((v2 >= 87) || (v3 < v2)) >= ((i2 * 58) / 7));
+            }
+            v0 = (((a1[0][9] || 76) * (72 || v0)) == ((v2 == a0[4]) + (v3 + v0)));
+            v2 = (((v1 < a0[12]) ? (i2 - 79) : (62 != a0[4])) && ((68 || v0) < (27 > v2)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[12] && a0[0]) % 5) == ((a1[1][14] - a1[3][7]) >= (v0 ? v1 : a0[11])))) {
+        v1 = (((a1[3][9] > v1) == (v2 + v2)) % 3);
+        v1 = (((a0[11] > 42) ? (a0[11] >= a1[3][3]) : (a0[9] / 4)) ? ((v3 * 70) && (v0 != v1)) : ((a0[15] && 0) ? (a1[3][14] % 7) : (a1[2][10] + v0)));
+        v2 = (((25 || a1[0][14]) || (a0[2] > a1[2][7])) > ((a0[15] || v1) - (v2 % 2)));
+    } else {
+        a1[1][15] = (((v1 * a1[1][10]) != (95 <= v2)) < ((49 + v1) / 1));
+        v2 = (((v0 > v3) || (v3 > a0[3])) || ((v3 - v1) ? (v2 + v3) : (v1 % 3)));
+        v2 = (((v3 + v0) || (74 <= v0)) < ((97 != v2) == (2 / 4)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((i4 - i4) ? (i4 >= 45) : (15 * v1)) == ((90 - a0[0]) < (a0[14] % 5)));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((33 > 0) > (v2 >= v0)) < ((5 > 47) / 5));
+                    a1[0][9] = (((40 * v0) / 5) + ((i5 || v2) != (93 < 79)));
+                    v2 = (((i4 || a0[13]) && (i4 > v3)) * ((v2 != 85) < (a0[2] * 75)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            a1[2][9] = (((a1[0][13] && v2) != (v1 / 1)) != ((a0[9] > a1[2][6]) || (a1[1][10] || a0[3])));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((97 <= 16) <= (v0 / 5)) * ((v1 && v0) <= (61 >= a0[0])));
+}
+int f2() {
+    int v0 = 7;
+    int v1 = 91;
+    int v2 = 89;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a1[0][7] % 1) > (a1[2][5] >= v2)) <= ((v0 ? a1[3][8] : 52) >= (22 * a1[3][15])));
+    {
+        int i0 = 0;
+        do {
+            v0 = (((42 ? a0[1] : v0) ? (v3 || 15) : (17 < v1)) % 1);
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((58 % 5) && (a1[2][0] % 3)) && ((a1[2][4] > a0[2]) <= (19 + a1[1][7])));
+                    a1[3][3] = (((v0 ? 7 : v0) - (a0[5] != i1)) - ((i0 ? v2 : v2) - (v3 ? i1 : v3)));
+                    a0[10] = (((a1[2][9] < i1) % 7) - ((44 * v0) / 8));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[11] = (((i0 % 1) && (v0 ? v3 : 78)) ? ((i0 >= v0) < (v0 % 6)) : ((v1 && 6) <= (v0 < 96)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    a0[4] = (((v2 ? 6 : v0) != (a0[1] + a0[12])) - ((v0 ? v3 : v0) < (v1 ? v1 : 74)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((20 + v2) > 79) break;
+        v1 = (((a1[2][1] + v0) ? (v0 ? 44 : 36) : (a0[15] + v3)) * ((a0[10] < v0) ? (28 / 6) : (i2 % 2)));
+        v1 = (((v3 != a1[2][4]) < (a1[0][13] - 65)) || ((v3 * 29) || (v0 && v2)));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            a0[5] = (((v0 % 4) * (v3 / 1)) / 3);
+            v0 = (((v1 + v0) ? (a0[2] == i2) : (v3 || v3)) * ((a0[5] - 3) <= (v1 < a1[3][0])));
+            v0 = (((v1 - a1[3][7]) * (i2 / 1)) != ((i2 < v1) % 9));
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            if ((a1[1][1] && a0[2]) > 64) break;
+            v2 = (((v3 && v1) * (i4 >= a1[0][4])) != ((31 - v0) && (a0[9] < i4)));
+            v2 = (((v0 < v3) / 7) - ((a0[13] + v3) < (v2 <= v0)));
+            v2 = (((v0 * 10) + (v3 + v1)) && ((i4 ? v0 : i4) || (v3 >= 78)));
+        }
+        v0 = (((v3 == v2) >= (i4 % 9)) > ((a1[2][9] * a1[0][15]) < (94 <= v0)));
+        v2 = (((87 ? i4 : 50) ? (a0[4] <= a0[10]) : (13 / 8)) < ((i4 ? 25 : 97) * (a1[0][14] ? 51 : 22)));
+    }
+    return (((94 - v1) > (v1 > v1)) == ((v3 >= a0[8]) && (v0 < a0[1])));
+}
+int main() {
+    return 0;
+}
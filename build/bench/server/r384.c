@@ -0,0 +1,46 @@
+int f0() {
+    int v0 = 18;
+    int v1 = 49;
+    int v2 = 57;
+    int v3 = 42;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((v0 < i0) > 77) break;
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v1 = (((a1[2][14] < i0) >= (v1 <= i1)) || ((36 || 93) <= (i0 || v2)));
+                v2 = (((a0[13] ? i0 : i0) * (a1[0][7] % 1)) % 1);
+                a1[0][6] = (((a1[2][3] > v3) || (a1[0][13] ? a1[1][10] : 45)) < ((61 / 9) && (v3 < 54)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[12] = (((v1 != v2) || (v0 - 29)) == ((v0 <= a0[3]) >= (a0[9] > a1[2][15])));
+        v1 = (((v2 < i0) - (a1[0][10] > v2)) ? ((v1 + 72) <= (a1[2][9] && v3)) : ((v2 / 4) && (a1[0][13] > a1[2][8])));
+    }
+    if ((((v0 / 2) >= (v0 == v1)) == ((v0 >= v0) + (v0 != 42)))) {
+        v3 = (((a1[2][3] - a1[3][6]) == (v3 || v1)) == ((a0[3] ? v0 : 54) < (97 || a1[2][13])));
+        a1[0][13] = (((v3 + 97) + (v2 < a1[2][1])) <= ((a1[2][3] % 6) > (v2 < v3)));
+        a0[14] = (((v3 && v3) - (a0[12] < v0)) + ((a1[2][9] ? 23 : a0[4]) ? (60 > v2) : (v0 && v0)));
+    } else {
+        v1 = (((v3 ? 1 : 6) != (a1[2][4] && a1[0][0])) > ((v3 + a0[10]) ? (v0 == a0[12]) : (v0 ? v3 : v2)));
+        v1 = (((30 > v3) > (a1[1][7] + v2)) ? ((v3 ? 93 : v3) > (a0[6] <= v0)) : ((a1[2][3] == 64) == (v2 == v1)));
+        v1 = (((v1 || v2) ? (v2 == v3) : (3 == 82)) || ((a1[3][8] == 53) ? (91 ? v2 : a0[2]) : (v3 % 3)));
+    }
+    v1 = (((v1 ? a1[0][9] : 93) / 3) * ((v0 != v2) % 4));
+    a1[2][7] = (((98 >= a1[3][6]) < (a1[2][10] != v2)) || ((v0 ? v1 : 93) / 7));
+    if ((((v2 * 90) && (a0[4] <= 85)) && ((v2 || v1) >= (a0[13] / 2)))) {
+        a0[14] = (((a0[11] || 30) - (v0 && a0[14])) > ((a0[4] > v3) / 4));
+        a1[3][8] = (((v0 >= v3) - (66 > v3)) ? ((93 == v3) ? (v1 <= v0) : (v3 - a0[4])) : ((a0[7] != v0) && (v2 <= v3)));
+        a0[5] = (((v2 * 76) * (a0[9] / 1)) % 9);
+    } else {
+        v1 = (((v3 != a1[0][4]) <= (v2 != a1[1][9])) <= ((v0 || a1[0][9]) / 7));
+        v2 = (((89 != a1[0][8]) != (a1[0][9] + v1)) <= ((v1 < v2) >= (a0[10] < v0)));
+        v2 = (((v3 + a1[3][0]) >= (v2 <= v1)) > ((a0[9] <= a0[5]) != (a0[3] - 92)));
+    }
+    return (((a0[4] ? a1[2][7] : a0[5]) >= (v0 > 72)) ? ((v0 && a1[0][7]) >= (a0[11] ? v1 : a1[3][4])) : ((v2 ? a1[2][5] : v2) / 3));
+}
+int main() {
+    return 0;
+}
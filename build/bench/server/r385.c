@@ -0,0 +1,155 @@
+int f0() {
+    int v0 = 57;
+    int v1 = 6;
+    int v2 = 73;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v1 / 2) <= (v0 <= 22)) > ((v1 * a1[3][8]) % 8));
+            {
+                int i1 = 0;
+                do {
+                    a0[13] = (((i1 || v2) && (v1 - a0[9])) % 2);
+                    v3 = (((v3 == i0) / 3) + ((9 >= 54) > (81 || i1)));
+                    v1 = (((82 != a0[14]) <= (i1 * i0)) >= ((v1 != v0) >= (a0[12] > 8)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            a1[3][13] = (((v3 / 4) != (v3 % 7)) == ((v2 / 4) > (i0 * 1)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a0[6] <= v0) || (v3 > a1[3][0])) ? ((v3 != a0[1]) ? (99 >= a1[3][5]) : (i2 % 4)) : ((i2 ? v1 : v0) ? (v3 / 7) : (i2 > i2)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v2 = (((20 >= 65) / 7) ? ((v2 != a1[0][9]) && (a1[2][10] || a1[2][0])) : ((v3 == a0[9]) ? (i3 <= a1[3][8]) : (i2 > a0[6])));
+                    v1 = (((20 || a0[11]) ? (12 - v3) : (i2 >= a1[3][3])) || ((v2 + i2) <= (a0[9] % 4)));
+                    v3 = (((i3 != i3) ? (a1[0][9] - v2) : (a0[7] * v0)) - ((v2 && a0[2]) % 5));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[12] = (((46 <= a1[1][9]) ? (71 == i2) : (28 - a1[3][1])) ? ((3 ? i2 : a1[0][3]) ? (v1 > i2) : (v0 >= i2)) : ((v3 <= a1[1][15]) > (30 ? v2 : v0)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((5 ? a0[0] : 66) ? (v1 ? v0 : a1[0][15]) : (58 ? v1 : a1[2][4])) - ((67 > v3) || (98 + v1)))) {
+        v0 = (((15 % 3) == (v1 ? 18 : 15)) > ((a0[1] % 2) - (v0 - v2)));
+        a1[2][10] = (((v2 && v3) || (60 - 58)) != ((0 && a0[13]) > (v0 >= 98)));
+        v1 = (((v0 <= 50) ? (v0 != v1) : (53 - a0[0])) + ((v0 != v2) && (v1 ? 56 : 8)));
+    } else {
+        a0[2] = (((v3 ? v2 : v0) <= (33 - v3)) > ((56 != v3) != (v1 / 8)));
+        v0 = (((v0 < 4) == (v3 <= v3)) && ((v2 % 3) && (v1 * v3)));
+        v2 = (((a1[3][14] || 91) >= (v3 - v3)) || ((v3 && a1[1][14]) >= (v3 != a0[10])));
+    }
+    if ((((66 == v2) - (v1 % 6)) || ((a1[1][15] / 4) >= (67 + v1)))) {
+        v2 = (((v3 != v0) + (a1[2][4] < v0)) / 1);
+        a1[0][14] = (((a0[1] >= v2) % 3) + ((v1 * 1) > (23 + v1)));
+        v1 = (((87 > a1[3][8]) / 7) >= ((v0 && 88) > (a1[2][4] - 5)));
+    } else {
+        v0 = (((a1[0][7] != a0[9]) != (v0 || a1[3][7])) < ((v2 != v2) >= (58 % 7)));
+        a0[13] = (((v2 + v2) / 1) - ((v2 % 9) == (v3 ? v0 : v3)));
+        v1 = (((a0[13] - 11) != (68 < v1)) && ((v3 == v2) ? (a1[3][12] == a0[13]) : (v0 % 4)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((a1[1][10] != v0) < (8 <= 43)) ? ((45 - a0[0]) + (71 < i4)) : ((a1[1][1] != v2) < (i4 % 2)));
+                    a0[1] = (((i5 * v2) * (v2 ? v0 : v3)) != ((v1 * a0[15]) < (v0 == v1)));
+                    a1[3][1] = (((a0[1] / 1) <= (i4 >= i4)) <= ((73 ? a0[14] : 49) > (v2 != 42)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v1 = (((v3 ? v0 : 52) / 9) / 8);
+            v3 = (((i4 - v3) / 1) < ((v0 / 7) ? (51 && a1[0][2]) : (a1[1][6] > i4)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v2 || v1) && (v1 >= v1)) % 6);
+}
+int f1() {
+    int v0 = 13;
+    int v1 = 46;
+    int v2 = 94;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((9 < 50) <= (a1[0][15] - a0[7])) ? ((82 < v3) * (57 > i0)) : ((v1 ? i0 : i1) && (v0 + i1)));
+                    v1 = (((v3 >= 12) && (a1[0][8] * a1[1][15])) ? ((88 ? v3 : 63) % 3) : ((i1 ? a0[12] : v0) && (a0[15] * v3)));
+                    a0[1] = (((65 > 40) ? (a0[3] > a0[11]) : (96 * i0)) > ((a1[0][0] - 98) && (v3 + 62)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            a1[0][15] = (((12 != 81) - (25 < a0[11])) + ((a1[1][1] - v3) - (v1 <= v3)));
+            a1[2][4] = (((v2 ? a0[13] : a0[13]) / 1) * ((85 ? a1[2][1] : v3) > (i0 || 63)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((70 == v0) - (v3 % 6)) * ((a1[2][10] && v0) ? (v3 / 9) : (v2 >= v1)))) {
+        v3 = (((a0[12] && a0[0]) == (57 <= v3)) ? ((a1[2][7] || v0) - (v2 < v3)) : ((11 * v2) ? (a1[1][3] < a1[1][11]) : (v2 || a0[6])));
+        a1[0][2] = (((v3 != v2) != (a1[2][11] / 3)) != ((v1 / 5) - (a1[1][3] % 6)));
+        v3 = (((v0 >= v0) ? (v2 <= a1[3][2]) : (30 > v1)) ? ((v1 > 63) <= (v0 != v1)) : ((v0 != 97) && (a0[13] != a1[3][1])));
+    } else {
+        v3 = (((a1[3][8] / 5) != (v3 >= v2)) != ((a1[2][5] > v2) <= (12 % 3)));
+        v1 = (((v1 % 8) != (v2 > a1[0][11])) * ((62 / 9) / 3));
+        v0 = (((24 ? a0[11] : 92) / 3) == ((83 <= 81) == (60 || v0)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v0 = (((22 != v2) && (v2 < 71)) - ((i2 != 40) || (v1 + 0)));
+                a1[3][3] = (((34 != 43) > (i3 ? a0[5] : 61)) / 5);
+                v0 = (((v1 || 38) ? (a1[0][10] ? i2 : v1) : (77 > a1[0][7])) / 3);
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+        v2 = (((a1[0][10] ? 36 : v1) + (v2 ? 78 : a1[2][11])) ? ((v0 / 5) || (i2 + 81)) : ((a0[11] - v1) - (39 ? a0[15] : v1)));
+        v1 = (((v1 > v0) - (v3 >= 90)) - ((a1[2][2] % 7) ? (i2 > v0) : (v0 ? a0[14] : v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            a0[0] = (((v0 * i4) / 1) <= ((a1[2][14] + a1[0][8]) ? (38 ? 63 : 38) : (v1 != a0[13])));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((a0[7] > a0[8]) % 3) + ((i5 || i4) <= (v3 * 82)));
+                    v2 = (((v2 - a1[3][5]) != (95 || 2)) % 7);
+                    v3 = (((i4 == v0) - (i4 <= 45)) ? ((v1 || a1[0][13]) == (v1 ? v3 : 76)) : ((a1[2][11] >= i4) <= (8 * 50)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((12 / 9) * (a1[3][4] - v2)) ? ((v3 / 6) % 4) : ((v2 == a1[1][5]) % 7));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 > v3) == (v1 && 58)) + ((v2 - v2) % 9))) {
+        v0 = (((v0 <= a1[1][9]) / 1) - ((66 / 4) == (8 <= v0)));
+        a1[0][5] = (((v3 && v2) == (v0 && v3)) + ((a0[13] > v3) >= (v2 && a0[3])));
+        v2 = (((v3 && v2) + (a1[3][10] ? v2 : a0[2])) ? ((v1 / 9) <= (32 <= 32)) : ((99 != v2) + (16 * a0[0])));
+    } else {
+        v0 = (((3 == v3) + (95 == a1[1][12])) < ((a0[0] - v3) - (a1[0][0] || a0[9])));
+        a0[5] = (((v0 != v1) <= (a0[10] <= v1)) ? ((61 > a1[3][4]) > (a0[15] ? v1 : v0)) : ((15 || 40) > (20 == v3)));
+        v2 = (((a0[12] / 4) % 9) < ((v2 <= 30) ? (a0[13] == 23) : (v2 * 51)));
+    }
+    return (((a0[3] + v2) / 4) || ((43 && v1) >= (24 == 52)));
+}
+int main() {
+    return 0;
+}
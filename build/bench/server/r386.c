@@ -0,0 +1,184 @@
+int f0() {
+    int v0 = 7;
+    int v1 = 96;
+    int v2 = 51;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a0[9] != 29) != (i0 && v3)) + ((a1[1][1] ? v3 : a1[0][7]) % 3));
+                    v2 = (((v0 || 69) - (v0 % 7)) < ((97 <= 67) * (v3 <= v1)));
+                    v1 = (((a1[1][13] > 4) + (a0[2] <= 57)) < ((v1 && i0) || (1 != i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            a0[12] = (((a0[14] <= v1) < (88 == v3)) && ((a1[3][2] ? 96 : v1) != (v3 % 4)));
+            v0 = (((v0 * v0) == (v0 * 45)) < ((v2 / 3) ? (a1[3][3] * 7) : (a0[7] <= v3)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[3][1] ? a0[7] : v0) % 5) && ((a1[1][5] && 24) <= (v1 - v2)))) {
+        v3 = (((v3 * v3) / 4) ? ((43 / 8) || (a0[12] <= v1)) : ((v1 + v3) == (17 - v1)));
+        v0 = (((v3 % 1) < (a0[5] ? a1[0][7] : v2)) > ((40 * a0[0]) != (a1[1][14] >= v2)));
+        v1 = (((v3 > 91) ? (v3 / 2) : (v0 == v0)) >= ((21 != a1[0][9]) ? (v2 - 5) : (94 <= v1)));
+    } else {
+        v2 = (((a0[11] % 9) < (71 || v1)) && ((61 - v3) == (v2 + 18)));
+        v3 = (((v3 ? v0 : v3) % 6) ? ((98 >= 43) ? (77 < 15) : (26 <= 56)) : ((v3 % 9) ? (v2 <= a1[3][6]) : (v1 && 81)));
+        v1 = (((a0[12] > v1) < (a1[0][6] < 51)) && ((v3 != a1[3][5]) == (v0 || 35)));
+    }
+    v2 = (((v2 <= v3) >= (a0[5] <= v2)) < ((v3 == v3) <= (a1[3][5] >= v1)));
+    v0 = (((0 >= v1) < (v1 * a1[0][6])) >= ((78 != v0) == (v1 || v0)));
+    if ((((v1 && v3) != (35 < v1)) || ((v1 + v0) >= (a0[15] % 6)))) {
+        v3 = (((v2 / 5) - (v2 >= a0[6])) >= ((12 || v3) / 9));
+        v0 = (((a1[0][8] + a1[0][6]) % 2) > ((v1 <= 33) > (v2 == a1[2][12])));
+        a1[3][13] = (((v0 ? 85 : v3) - (7 + v3)) + ((76 != 24) * (v3 == v1)));
+    } else {
+        v3 = (((v0 + a1[1][0]) >= (a0[9] || 19)) / 8);
+        a0[14] = (((v1 > v1) % 6) >= ((a1[1][7] && v3) / 2));
+        v0 = (((v1 + v3) <= (v0 ? v2 : a0[1])) <= ((62 % 2) >= (v3 / 9)));
+    }
+    return (((v2 ? 65 : v1) ? (v3 >= a1[2][9]) : (v2 || v1)) && ((11 / 2) < (v2 ? a0[8] : a0[1])));
+}
+int f1() {
+    int v0 = 16;
+    int v1 = 95;
+    int v2 = 42;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((a1[0][11] % 9) < (10 ? 90 : 70)) >= ((23 - i1) == (i0 < 67)));
+                v3 = (((v0 > 66) - (v2 < 38)) ? ((a0[6] + a1[3][11]) > (40 < a1[0][9])) : ((58 != v0) % 4));
+                v0 = (((a1[3][7] * a1[0][1]) && (a1[1][12] == a1[3][5])) ? ((v0 ? i1 : a1[3][2]) ? (a1[2][11] && 36) : (60 < 58)) : ((84 > a1[3][11]) != (v3 || 58)));
+            }
+            v1 = (((v1 / 6) || (i0 <= v1)) || ((v0 || a0[4]) <= (v0 % 4)));
+            v0 = (((v2 == v2) ? (v3 * v1) : (i0 >= a0[12])) / 2);
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    a0[7] = (((v2 == a0[14]) != (78 == v3)) || ((a0[6] / 1) != (v2 % 7)));
+    if ((((73 < 48) ? (v1 ? v1 : a1[3][9]) : (a1[1][7] != v0)) ? ((35 ? a0[12] : 7) <= (v3 == 26)) : ((v2 <= v2) ? (v0 + a1[1][2]) : (a1[0][10] >= a0[4])))) {
+        v2 = (((v1 / 1) * (25 - a0[8])) % 3);
+        v2 = (((v1 < 0) || (a0[5] >= v1)) != ((68 ? v2 : a1[3][7]) ? (v1 != v2) : (34 % 4)));
+        v3 = (((a1[3][11] && a1[2][14]) != (v1 < v0)) / 3);
+    } else {
+        v2 = (((v3 ? v0 : a1[2][9]) == (v2 || 8)) && ((v0 > 28) - (v3 - 61)));
+        a1[0][12] = (((v2 - 25) - (a0[5] <= 46)) == ((v2 / 7) || (a0[7] - v3)));
+        v3 = (((v3 > 42) <= (a1[0][12] >= a1[1][0])) > ((v3 / 8) > (v2 || 73)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((a0[14] && a0[4]) > 96) break;
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            a0[13] = (((i2 || v2) / 1) / 3);
+            v1 = (((a0[1] < 67) * (53 < v3)) && ((a1[2][8] - v0) || (26 > 40)));
+            a0[7] = (((a0[7] < a1[2][4]) < (a1[0][2] && v3)) + ((v1 <= i2) == (44 + i3)));
+        }
+        v3 = (((a1[0][8] || v0) == (v1 > v0)) ? ((v2 < i2) && (95 + a1[0][5])) : ((v2 >= v2) < (v3 > a1[1][13])));
+        v1 = (((i2 % 8) <= (a1[2][11] < 51)) && ((a1[3][10] || 75) % 8));
+    }
+    if ((((v1 >= v3) && (a0[10] * v1)) % 2)) {
+        a0[7] = (((95 ? v0 : 37) * (11 + 35)) < ((20 <= 76) / 4));
+        v0 = (((v3 != v3) <= (a0[2] <= 94)) >= ((v0 >= 35) && (v3 >= 85)));
+        v3 = (((v3 || a0[8]) <= (v1 > a1[0][10])) > ((a1[1][6] ? v2 : v0) < (a0[5] * v1)));
+    } else {
+        v1 = (((v3 && a0[10]) - (v3 * v1)) != ((68 ? a0[1] : 45) >= (55 && v3)));
+        v0 = (((a1[2][9] != v2) >= (13 / 7)) || ((a0[6] >= 24) ? (v3 != a0[11]) : (v3 == a0[10])));
+        a1[1][4] = (((a0[5] > v1) > (a0[8] ? v0 : v1)) <= ((v2 % 3) ? (71 ? a0[6] : v0) : (a1[0][5] != a0[14])));
+    }
+    return (((a0[13] != v1) != (v0 != 11)) ? ((v1 + v3) && (v0 / 4)) : ((v2 ? v0 : v1) / 9));
+}
+int f2() {
+    int v0 = 36;
+    int v1 = 79;
+    int v2 = 23;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((a1[3][9] % 5) == (v3 == v1)) <= ((i0 ? a0[3] : a0[4]) && (v1 <= a0[13])));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((i1 - v1) % 6) > ((v3 || v0) * (v0 && 34)));
+                    a0[13] = (((95 - a0[0]) ? (v0 + v3) : (96 && 9)) || ((a0[15] < 83) ? (34 - 87) : (75 >= a0[9])));
+                    v1 = (((a0[6] && v3) - (a0[8] / 1)) || ((i1 > i0) % 5));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v2 || a0[10]) > (v3 ? 91 : a1[1][9])) && ((a1[3][14] != v2) * (a1[0][4] && a0[8])));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((i3 < i3) != (v0 == a1[0][8])) % 7);
+                    v0 = (((i3 ? a1[1][3] : v1) == (a0[11] > v0)) * ((30 && a0[10]) || (a1[3][13] && v0)));
+                    v2 = (((v0 >= v2) + (v1 + v2)) <= ((a0[9] / 5) % 4));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v1 = (((v0 ? i2 : v3) > (a1[0][15] < 28)) - ((12 * a0[5]) || (54 > 12)));
+            v1 = (((a0[14] || v0) % 6) % 2);
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    a1[0][2] = (((80 == i4) > (17 / 7)) >= ((i5 / 2) / 8));
+                    v1 = (((v3 < 53) <= (v3 > a0[7])) * ((a1[3][13] > a0[8]) + (v1 == a1[2][5])));
+                    a1[1][11] = (((v2 <= v3) >= (v0 < 19)) >= ((93 < a0[3]) ? (v0 > v3) : (a0[3] / 3)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v0 * 77) ? (v2 ? v1 : v2) : (v2 >= v1)) - ((v2 / 1) % 6));
+            a1[0][2] = (((a0[10] - v2) / 6) ? ((v0 > 25) * (v2 >= v3)) : ((93 * v2) < (a1[3][9] <= v3)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 > v2) + (a1[3][9] != 69)) ? ((a0[4] * v2) < (v1 && v2)) : ((v3 - v3) < (v3 / 6)))) {
+        v3 = (((v0 <= v3) == (a0[5] == v1)) ? ((v1 - v1) % 4) : ((v2 > v3) || (60 >= 3)));
+        a1[1][1] = (((v3 == 24) && (a1[2][2] && v0)) + ((a1[2][4] ? a0[2] : v2) / 8));
+        v2 = (((a1[0][6] - v1) || (v1 != 42)) % 5);
+    } else {
+        v1 = (((a0[3] * 80) + (53 > v2)) < ((a1[0][2] / 7) || (v1 && v3)));
+        v0 = (((v0 == v1) <= (40 % 5)) != ((v1 + a0[11]) > (a0[3] == v2)));
+        v3 = (((94 < v3) / 2) <= ((a1[1][10] * 6) == (v2 ? 49 : v1)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((a0[14] - a0[5]) > 62) break;
+            a1[0][11] = (((a0[8] == 54) > (v0 ? v1 : v0)) < ((94 - 42) == (a0[0] && v2)));
+            for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+                if ((v0 ? v1 : v3) > 61) break;
+                v2 = (((a0[9] != v2) - (4 < v0)) % 5);
+                v3 = (((i6 <= 33) - (v1 * i7)) && ((18 && a1[3][9]) > (a0[4] ? a0[4] : v1)));
+                a1[3][7] = (((v3 >= a0[0]) < (79 ? 67 : 66)) / 1);
+            }
+            v2 = (((v0 && 99) <= (v0 - v0)) + ((v3 + v2) * (v3 <= a0[8])));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    return (((v3 || 54) % 1) && ((12 % 1) / 5));
+}
+int main() {
+    return 0;
+}
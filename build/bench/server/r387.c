@@ -0,0 +1,62 @@
+int f0() {
+    int v0 = 94;
+    int v1 = 70;
+    int v2 = 98;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[2][11] = (((v1 == v0) ? (72 >= 96) : (v0 <= a1[0][8])) == ((i0 <= v1) > (a1[0][3] == i0)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((v0 >= v1) > 85) break;
+                v2 = (((38 ? v0 : i0) > (a1[1][11] >= v0)) + ((i1 <= a1[3][2]) && (v1 ? 43 : v1)));
+                a0[5] = (((v1 > a0[8]) || (67 * v0)) * ((v3 <= a1[2][10]) > (v1 > v3)));
+                v0 = (((a1[3][7] != i1) < (a0[5] <= a0[6])) / 8);
+            }
+            v2 = (((v3 % 7) + (7 - a0[14])) ? ((a1[3][11] && 59) ? (a1[2][15] % 3) : (16 == v3)) : ((73 <= 13) && (v0 >= v3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v3 = (((81 >= v2) != (v1 >= 8)) - ((11 + i2) >= (v2 >= v1)));
+                    v3 = (((4 % 2) - (a0[6] || v2)) + ((7 * v2) > (21 * a1[3][1])));
+                    a1[0][12] = (((33 ? a1[2][8] : a0[11]) + (v0 % 2)) || ((v2 + v1) / 2));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[2] = (((a0[1] >= 16) ? (v2 != a0[7]) : (52 > 46)) <= ((a0[7] > v3) < (66 % 4)));
+            a1[2][3] = (((v3 <= 56) - (i2 == v0)) > ((v0 < a1[1][9]) ? (v0 >= i2) : (a1[2][5] != 53)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 - v2) || (a1[1][6] % 3)) <= ((a1[1][14] + 20) || (v2 >= v3)))) {
+        v1 = (((30 * v0) <= (89 ? v1 : 97)) ? ((v2 - a1[2][1]) != (7 <= a0[1])) : ((v0 - 81) >= (v0 || 0)));
+        v0 = (((v3 ? v3 : 87) >= (a0[15] < v0)) == ((29 / 9) * (a0[3] < a1[1][11])));
+        v2 = (((v2 != a1[1][4]) < (76 == v3)) > ((v2 ? v3 : v0) - (59 - v1)));
+    } else {
+        v0 = (((a1[1][11] ? 27 : a1[3][4]) >= (a1[0][11] > v2)) && ((v1 + v3) > (v0 && a1[3][9])));
+        a0[2] = (((a0[12] ? v2 : v3) > (v1 / 3)) ? ((v3 - a1[1][8]) ? (v1 % 2) : (53 && 37)) : ((a1[2][8] ? v1 : v0) / 6));
+        v3 = (((a0[8] < a0[1]) < (a1[1][7] != 16)) <= ((a1[1][6] / 1) < (93 > v0)));
+    }
+    if ((((v0 * v1) >= (v0 && a1[2][9])) % 4)) {
+        v3 = (((46 >= v2) || (v2 && 26)) ? ((a1[3][9] + v3) >= (30 >= v1)) : ((v2 == v2) ? (59 ? a0[10] : a0[14]) : (v1 / 7)));
+        v2 = (((v1 - 79) != (v1 > v2)) > ((a1[1][14] * a0[8]) ? (v1 && a0[9]) : (v0 && v2)));
+        v3 = (((a1[0][15] != v0) * (a1[0][5] == v0)) || ((a1[0][7] < 92) != (v3 > v3)));
+    } else {
+        a0[9] = (((v3 - v1) - (87 % 8)) <= ((a1[1][9] >= 96) ? (0 - v0) : (50 % 8)));
+        a0[6] = (((v3 % 6) && (v3 <= a0[6])) >= ((v1 + a0[13]) > (10 <= 63)));
+        v1 = (((v3 < v3) != (v3 >= v0)) > ((v1 > v0) < (v1 && 14)));
+    }
+    v1 = (((v2 >= v1) <= (v2 * 52)) - ((90 || v0) <= (19 / 4)));
+    return (((v2 != a1[0][13]) ? (v1 == 96) : (93 <= a0[14])) >= ((a1[0][15] > v1) > (v3 / 2)));
+}
+int main() {
+    return 0;
+}
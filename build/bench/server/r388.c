@@ -0,0 +1,100 @@
+int f0() {
+    int v0 = 2;
+    int v1 = 80;
+    int v2 = 69;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    if ((((53 <= 63) > (v1 - a0[0])) || ((v0 ? 75 : a1[3][15]) == (v0 ? v3 : v2)))) {
+        v3 = (((84 >= v1) != (2 != v0)) % 6);
+        v1 = (((a0[7] != a0[2]) == (v2 ? v1 : 70)) || ((a1[0][2] % 9) + (a1[1][9] / 8)));
+        v0 = (((a0[10] - v2) <= (a0[9] <= v2)) - ((v2 <= 66) * (v2 ? 61 : v0)));
+    } else {
+        v2 = (((v0 % 3) ? (a1[3][1] != 65) : (v1 || a0[1])) + ((v2 >= v0) / 4));
+        v0 = (((v1 * a1[2][12]) - (52 != v0)) - ((v3 && v1) + (v0 + v1)));
+        v2 = (((a1[1][5] == v2) ? (v2 && v3) : (a0[10] && 79)) * ((v3 % 3) != (19 ? v2 : v2)));
+    }
+    if ((((v0 * v2) / 2) && ((43 != 64) && (v0 - v0)))) {
+        v0 = (((16 <= v2) ? (v3 || a1[2][12]) : (61 + v2)) != ((a0[9] || v2) * (30 <= v2)));
+        v0 = (((46 && a0[3]) - (v1 || v0)) || ((v3 ? v1 : v3) >= (v2 || v3)));
+        a0[2] = (((a0[7] % 9) * (v0 % 1)) ? ((a1[0][14] || v3) == (0 && v3)) : ((v3 > v2) + (v1 / 3)));
+    } else {
+        v2 = (((a0[5] == a1[0][1]) - (v3 > a0[3])) && ((a1[1][5] > a0[15]) && (v1 + 75)));
+        v0 = (((a1[3][7] >= v3) ? (72 != v3) : (a1[1][8] + v3)) / 9);
+        a0[12] = (((0 / 3) && (v1 >= v3)) >= ((67 / 6) + (41 ? a0[9] : v3)));
+    }
+    v0 = (((v0 >= 39) % 7) <= ((a0[13] / 1) ? (v0 < a1[2][10]) : (a1[2][12] <= v1)));
+    if ((((a1[2][12] && v1) >= (v2 ? v2 : a1[3][13])) * ((76 != 88) - (26 / 4)))) {
+        a1[2][6] = (((v3 != v1) + (15 || v1)) - ((61 - v3) ? (a1[3][6] % 5) : (v2 >= a0[1])));
+        v3 = (((v2 >= v1) * (v1 * v3)) / 8);
+        v2 = (((a1[2][5] + a0[1]) == (12 ? v0 : v2)) / 6);
+    } else {
+        v0 = (((v1 + v1) % 2) == ((v2 > a0[5]) >= (a1[1][3] == 82)));
+        v0 = (((v3 + v1) % 3) || ((a1[1][2] / 9) != (a0[5] < 20)));
+        v2 = (((a0[12] % 8) < (a1[1][3] / 6)) <= ((a1[0][11] != 86) < (v2 % 9)));
+    }
+    v0 = (((a1[0][12] != 88) ? (v1 / 8) : (a1[1][8] || v0)) * ((98 % 4) <= (v0 + v2)));
+    return (((a0[10] == a1[1][2]) - (v3 / 1)) <= ((v3 != a0[6]) ? (v1 < v3) : (a0[3] == 13)));
+}
+int f1() {
+    int v0 = 21;
+    int v1 = 89;
+    int v2 = 83;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v2 = (((v3 * i1) >= (v2 >= i0)) == ((v3 % 1) || (v1 < 2)));
+                    v3 = (((a1[1][15] - v0) - (v3 % 5)) < ((i0 && 83) + (97 - 23)));
+                    v2 = (((v0 || v3) ? (4 >= i1) : (v3 / 3)) != ((43 > a1[0][14]) * (12 || a1[2][13])));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v0 == 7) < (v1 == v2)) > ((42 < a0[3]) * (v0 > i0)));
+            a1[0][4] = (((29 <= 36) != (i0 - a0[1])) <= ((a1[1][2] ? v0 : a0[7]) <= (0 != v3)));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((a0[4] % 1) ? (57 + 44) : (v2 * 27)) / 8);
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v2 = (((a1[2][13] - v3) == (a1[0][11] / 7)) * ((v1 || v2) || (v1 != a0[6])));
+            a1[0][12] = (((v0 <= 5) % 1) + ((4 <= 97) / 1));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v1 = (((v0 % 9) >= (73 ? 47 : i3)) - ((v1 >= 33) > (21 > 26)));
+                v2 = (((v3 >= a1[0][15]) / 6) * ((34 && v2) ? (a1[1][14] - 0) : (i3 - i3)));
+                a0[7] = (((v1 == a1[0][9]) > (a1[3][3] != v0)) || ((56 && a0[7]) % 1));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v0 = (((a0[13] / 9) - (a0[12] + v0)) == ((v3 + a0[15]) < (v1 + v3)));
+            a0[2] = (((95 || 80) < (v0 % 5)) * ((a1[1][6] == a1[2][6]) ? (a0[4] == v1) : (a1[0][12] ? a1[1][3] : a0[8])));
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    if ((81 % 3) > 73) break;
+                    a0[5] = (((i5 + 77) % 6) == ((v3 != v0) * (9 && v3)));
+                    a0[7] = (((v1 > i4) + (v0 > a0[0])) < ((i5 != a1[3][10]) / 9));
+                    v1 = (((a1[0][6] == a0[12]) - (i4 || i4)) * ((95 + 8) != (a0[3] != i5)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((a1[3][15] != a1[1][15]) * (3 + a0[6])) < ((v0 + a0[10]) ? (a0[4] / 1) : (a1[1][9] <= v1)));
+    return (((v3 * v1) * (v1 ? 59 : 90)) % 8);
+}
+int main() {
+    return 0;
+}
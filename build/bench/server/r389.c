@@ -0,0 +1,184 @@
+int f0() {
+    int v0 = 1;
+    int v1 = 48;
+    int v2 = 42;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v2 != a1[1][14]) != (a0[2] >= 82)) && ((36 && 4) ? (v0 < v2) : (v1 <= v1)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((v0 ? a1[2][14] : 5) > 87) break;
+        v1 = (((48 ? v0 : v1) * (a0[13] ? a1[0][13] : v3)) != ((v3 <= a1[3][4]) * (42 && v0)));
+        v0 = (((i0 + a1[0][8]) < (v3 <= i0)) + ((a0[14] == v2) / 1));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v0 = (((v2 > v3) ? (i0 < 54) : (5 < v1)) && ((a0[0] != v0) - (i1 * i0)));
+            a0[0] = (((a0[7] + 52) <= (v2 + i0)) == ((i0 - v1) + (a1[3][15] * v3)));
+            v0 = (((a1[0][2] && i0) <= (i0 ? v0 : i1)) || ((v0 != v2) + (v2 / 1)));
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v1 = (((i2 && 2) >= (a0[2] % 3)) / 6);
+                v1 = (((75 + a0[0]) < (v2 || i3)) >= ((v3 * 48) >= (a0[5] / 9)));
+                v3 = (((30 ? v2 : a1[2][8]) % 8) + ((v3 / 9) >= (i3 < i2)));
+            }
+            a1[3][6] = (((i2 != i2) == (v3 + a0[0])) ? ((a1[2][9] == v2) / 7) : ((v1 == 80) % 3));
+            v1 = (((i2 * 94) < (46 <= 86)) == ((i2 == 77) || (67 ? v1 : v0)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v3 = (((a0[3] + 25) - (97 <= 70)) * ((a0[14] % 9) % 7));
+    if ((((a0[9] == v3) >= (v1 <= v1)) && ((v1 < 18) || (53 ? v2 : v0)))) {
+        v1 = (((a0[7] + v3) + (v2 >= a0[11])) % 7);
+        v3 = (((v1 < 19) < (v3 ? 68 : v2)) > ((v1 == v2) <= (v2 && v0)));
+        v2 = (((72 ? 37 : a1[2][2]) * (a0[11] + v2)) && ((a0[0] < a1[0][6]) / 7));
+    } else {
+        v3 = (((v3 || v0) % 3) || ((72 ? a1[0][13] : a0[7]) >= (v1 == a1[2][14])));
+        v2 = (((45 >= 45) ? (a1[0][1] || a0[6]) : (v1 % 9)) != ((78 > 79) * (83 * v2)));
+        v3 = (((v0 && v0) != (v2 && v2)) != ((68 != 66) / 9));
+    }
+    return (((v0 <= v2) < (39 < v0)) > ((v2 && v1) + (v1 < a0[5])));
+}
+int f1() {
+    int v0 = 25;
+    int v1 = 81;
+    int v2 = 12;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v0 = (((a0[10] >= 39) * (i0 + i0)) && ((v0 != v0) / 8));
+        a0[8] = (((a1[1][9] >= v3) ? (v2 + v3) : (a1[0][7] * v3)) + ((74 + a1[2][12]) ? (v0 - 73) : (i0 + 17)));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((i0 ? 57 : v1) == (i0 <= 70)) / 5);
+                v3 = (((v3 % 7) - (v1 <= v2)) ? ((v3 != 22) ? (23 ? 84 : a1[0][11]) : (a0[8] <= v3)) : ((11 > v0) != (54 ? v3 : v0)));
+                v2 = (((a0[6] - i0) % 6) >= ((v2 ? a0[0] : a1[2][4]) >= (i1 && v3)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[1] = (((v3 % 1) > (v2 > 45)) || ((i2 < 99) >= (a1[1][8] >= 32)));
+            v2 = (((a1[3][9] >= a1[3][14]) != (v1 - 47)) == ((a1[3][12] && v1) - (2 && v0)));
+            {
+                int i3 = 0;
+                do {
+                    a1[3][2] = (((v3 / 1) > (47 ? a0[11] : a1[2][8])) && ((i2 > v2) ? (v2 * v0) : (i3 <= 87)));
+                    v0 = (((v0 ? i2 : a1[2][11]) + (v1 > i3)) || ((i3 || v1) && (v3 < a1[2][11])));
+                    v0 = (((48 < i3) + (v3 + v1)) * ((v2 <= i3) - (a0[5] != v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v0 >= v3) < (75 * v1)) <= ((a0[7] >= v0) >= (44 == a1[2][3])))) {
+        a1[2][0] = (((a0[3] + v0) < (v1 % 7)) < ((18 || v3) >= (v1 == v2)));
+        a1[1][15] = (((74 ? v3 : v2) + (8 && a0[4])) <= ((84 ? 93 : v1) ? (43 > v0) : (a0[14] <= v0)));
+        a1[2][10] = (((a0[14] == v1) + (v2 * v3)) * ((10 >= a0[9]) % 6));
+    } else {
+        v1 = (((v2 >= v2) >= (v3 * 77)) && ((v2 - 38) <= (v0 * a0[1])));
+        a1[2][8] = (((a0[10] - a0[10]) % 5) <= ((v1 == a1[0][11]) != (v3 / 1)));
+        v0 = (((v3 || 38) / 1) != ((v2 ? 38 : 93) <= (v2 < v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 2) {
+                    v3 = (((a0[4] == a1[0][10]) != (52 % 5)) + ((a1[2][2] ? v1 : i5) - (a1[1][10] ? i5 : a1[2][11])));
+                    a1[3][3] = (((v0 >= 25) % 7) < ((v0 || a0[11]) || (v2 * a1[0][2])));
+                    a1[0][14] = (((a1[1][2] * v3) * (v1 < v0)) < ((26 > i4) || (88 / 9)));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((i4 ? v1 : a1[1][14]) < (v1 ? v0 : 37)) != ((v3 % 8) ? (i4 ? a0[14] : v1) : (37 < v2)));
+            a0[1] = (((v3 ? a1[3][14] : 35) != (52 <= a0[4])) ? ((a1[0][11] / 8) ? (v1 * v2) : (83 * a0[6])) : ((5 > v1) * (76 <= v3)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v1 = (((a1[1][9] / 6) % 4) >= ((v3 - v1) % 7));
+    return (((v0 > v1) / 2) < ((v3 ? a1[1][4] : 22) + (v1 * a1[3][9])));
+}
+int f2() {
+    int v0 = 22;
+    int v1 = 84;
+    int v2 = 70;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[13] && a1[2][14]) != (v2 >= a1[3][3])) != ((v0 && 64) / 3))) {
+        v3 = (((a0[4] > a1[3][4]) - (v0 < v2)) < ((a1[0][2] * 82) < (a0[10] ? a1[1][3] : v1)));
+        v2 = (((v2 - v2) || (23 <= a0[10])) * ((v1 ? v0 : 25) / 3));
+        v3 = (((v1 <= v3) * (v1 * v0)) ? ((a0[3] ? 31 : a1[2][3]) - (a0[0] ? a0[14] : v1)) : ((a0[12] / 2) < (v1 ? v1 : v2)));
+    } else {
+        a1[0][9] = (((v2 < 92) != (v3 + v3)) || ((56 >= 65) / 7));
+        a0[4] = (((28 % 3) * (v3 * v0)) || ((85 - 44) >= (v1 + a1[1][6])));
+        v0 = (((v1 != a0[12]) - (v3 / 5)) != ((v2 + v0) || (v1 > 54)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[13] = (((v1 || a1[0][15]) ? (81 ? v3 : 2) : (v0 - v2)) * ((a1[1][9] % 4) >= (5 + v0)));
+            a1[3][14] = (((v3 / 7) % 5) || ((a0[8] && v2) && (5 + 72)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v1 = (((a0[12] != v3) - (v0 - 54)) && ((a1[1][9] == 47) != (a1[2][13] % 6)));
+                v0 = (((a0[0] < 78) + (i0 <= a1[2][7])) % 7);
+                v3 = (((v0 * v1) - (i1 && i1)) == ((v2 == 17) / 2));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 || 97) < (a0[15] % 9)) > ((v3 > v0) + (a0[9] / 1)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((61 * a1[2][4]) > 51) break;
+                    v2 = (((i3 > 92) ? (i3 ? i3 : a1[2][9]) : (v0 && 2)) <= ((v2 - a1[1][8]) <= (v1 * v3)));
+                    v2 = (((a0[14] >= i3) % 6) || ((v3 % 6) % 2));
+                    a1[0][10] = (((91 != a1[1][8]) < (i3 * i2)) > ((a0[9] == v0) > (12 - a0[10])));
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((v1 ? 34 : 59) >= (v1 == v3)) ? ((83 && 60) == (v2 == v0)) : ((a0[12] / 1) && (i2 ? 94 : a1[2][4])));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((a0[7] ? 67 : a0[0]) ? (v3 <= a1[2][14]) : (v3 * a0[7])) >= ((a0[15] + 63) ? (v1 - 96) : (1 <= a0[0])))) {
+        a0[10] = (((v2 && v1) ? (v0 && a1[1][2]) : (v0 > 65)) > ((13 - a1[2][1]) * (65 > 97)));
+        a0[4] = (((v1 > v3) - (73 > a0[3])) || ((a1[0][8] % 7) != (37 % 8)));
+        v0 = (((a1[0][14] && 26) + (v0 + a0[5])) || ((43 >= a0[14]) < (62 || 2)));
+    } else {
+        v2 = (((v3 ? a1[1][4] : v2) && (v0 - a1[0][3])) < ((v3 <= v2) % 1));
+        v0 = (((a1[0][15] / 8) * (a1[0][1] % 4)) / 9);
+        v1 = (((v2 && v3) - (32 + a0[6])) / 9);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((96 == a0[4]) > 87) break;
+            v3 = (((41 ? v2 : a1[1][3]) > (v1 >= v2)) != ((4 >= a0[5]) != (v0 % 2)));
+            v1 = (((a1[2][13] && v3) > (a1[0][11] ? i4 : 61)) ? ((a0[11] % 4) != (v1 > v1)) : ((a0[5] * v1) == (v2 ? v1 : i4)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v0 = (((a0[2] / 9) + (a0[1] ? a0[7] : v3)) ? ((v0 ? i4 : 49) - (v0 * a1[3][9])) : ((a0[8] != 51) == (v2 >= v1)));
+                a1[0][14] = (((a0[8] == 85) < (v1 > 10)) > ((87 - i5) - (i4 ? a0[9] : 15)));
+                a1[3][7] = (((45 + 60) && (81 ? v0 : v3)) / 7);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[0][9] / 3) ? (v1 <= v0) : (v1 && a0[10])) > ((v1 > v2) ? (73 <= 19) : (91 % 3)));
+}
+int main() {
+    return 0;
+}
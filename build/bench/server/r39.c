@@ -0,0 +1,77 @@
+int f0() {
+    int v0 = 38;
+    int v1 = 3;
+    int v2 = 35;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v3 * 37) % 5) == ((v2 - 20) == (v1 / 4)));
+                    v1 = (((89 == v0) >= (i0 / 9)) % 5);
+                    v2 = (((i0 / 7) / 8) * ((v1 % 7) > (a0[9] < i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((73 - 23) || (a0[14] ? a0[8] : 17)) >= ((1 != 78) + (v2 > i0)));
+            v2 = (((i0 >= v0) ? (i0 > v3) : (v1 * 7)) * ((a1[3][10] <= v1) + (a1[2][0] && a1[3][8])));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 <= v0) >= (9 > v1)) == ((i2 >= a0[13]) - (v2 % 5)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((75 ? i2 : v0) || (66 <= i3)) ? ((97 * a0[10]) >= (36 && a0[9])) : ((v1 ? 35 : i2) || (a0[9] <= v3)));
+                    a0[1] = (((v0 < 27) % 3) * ((25 % 2) / 9));
+                    v2 = (((v2 || 62) < (8 != v1)) ? ((72 == a0[13]) / 1) : ((v1 - v2) && (i3 - v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            a1[2][15] = (((v1 >= v2) - (12 == 75)) ? ((a1[0][4] >= a0[1]) ? (v1 / 6) : (a0[9] + i2)) : ((a1[3][12] != i2) / 7));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                if ((v1 / 5) > 95) break;
+                v2 = (((i4 && a1[3][7]) <= (a0[12] - a0[7])) != ((25 || 97) / 9));
+                a1[1][8] = (((1 ? 49 : v0) / 9) >= ((a0[1] * a0[4]) - (v1 >= 51)));
+                v2 = (((v1 ? i4 : v1) == (5 <= i4)) <= ((v3 || a0[14]) ? (a1[1][4] + v3) : (v2 * 96)));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        a0[4] = (((v3 ? a1[0][11] : v2) > (a1[3][12] / 5)) || ((a1[3][3] / 1) && (v1 && i4)));
+        v1 = (((v1 < a0[9]) * (a1[1][13] % 7)) % 6);
+    }
+    v1 = (((v3 < v0) / 6) - ((63 >= a0[15]) > (v1 || v2)));
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v2 = (((96 % 1) || (a1[0][15] != a1[3][11])) * ((v2 != v2) * (v2 <= v3)));
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                if ((v1 >= i6) > 59) break;
+                a1[0][12] = (((48 / 9) > (77 / 4)) / 4);
+                a1[3][13] = (((v3 == v3) && (97 < 70)) + ((53 - 62) <= (v2 != 13)));
+                a1[2][3] = (((v2 ? a1[2][9] : i7) / 6) + ((v2 <= v2) || (a0[8] > a1[2][8])));
+            }
+            a1[1][12] = (((a0[2] && v3) == (30 < v3)) > ((a1[0][0] == 29) == (a0[5] * i6)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((65 ? v1 : v2) * (v2 <= v3)) * ((a0[6] != v2) == (v1 ? a0[12] : a1[1][3])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
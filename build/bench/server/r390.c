@@ -0,0 +1,77 @@
+int f0() {
+    int v0 = 22;
+    int v1 = 36;
+    int v2 = 58;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    a1[3][5] = (((a1[2][0] ? a1[3][0] : v1) / 4) * ((a1[3][4] || v2) && (v2 * a1[2][10])));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((v0 + i0) > 87) break;
+        v3 = (((a0[15] == 28) != (v0 > v1)) != ((i0 % 1) + (30 / 7)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a1[2][5] = (((a0[7] && i0) >= (v2 ? v0 : a1[0][8])) / 1);
+            v2 = (((52 - i1) + (a0[14] - a0[4])) - ((i1 ? v3 : a0[6]) ? (v1 + v1) : (i0 % 9)));
+            v3 = (((v1 < 70) >= (i1 ? v0 : i1)) < ((88 <= a0[9]) == (v2 != 86)));
+        }
+        a0[4] = (((v0 - 33) < (85 != i0)) < ((a0[13] >= v0) || (83 != v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((i3 ? a1[2][11] : i3) > (v2 >= a1[0][3])) + ((88 ? 29 : v3) != (i3 < a0[6])));
+                    a0[3] = (((v1 % 4) - (v1 - a0[5])) ? ((a1[0][13] == 57) ? (v0 >= i3) : (v0 > 73)) : ((68 % 4) == (16 / 7)));
+                    v2 = (((v1 || 2) ? (i2 == a0[13]) : (v1 || a1[1][4])) + ((72 ? i3 : 68) < (v2 - v2)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v2 = (((6 >= v0) % 6) / 6);
+            a1[2][6] = (((v1 >= i2) && (v0 ? v0 : v3)) % 4);
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v2 <= v0) > 79) break;
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v2 = (((v2 + i5) - (v3 && a1[1][14])) - ((a1[1][9] >= v0) || (21 * a0[7])));
+                    v2 = (((a0[14] * a0[2]) != (v2 || v2)) && ((a1[3][12] && v1) == (i5 ? v1 : v2)));
+                    v2 = (((44 ? a0[13] : v3) == (a0[10] < i5)) != ((v1 - v2) * (59 ? a1[1][1] : a0[13])));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v0 % 5) / 5) != ((i4 + a0[13]) <= (v1 > 26)));
+            v3 = (((v1 && 20) >= (v3 + v0)) * ((v3 ? v1 : 23) == (v2 != a1[2][11])));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v0 / 1) > 78) break;
+            v2 = (((v2 ? v3 : v1) || (v2 % 7)) ? ((81 - 46) % 5) : ((v1 / 3) >= (82 <= 96)));
+            v3 = (((i6 > a1[2][3]) ? (i6 > 5) : (72 ? a1[0][2] : a1[1][9])) <= ((v1 ? a0[10] : v1) <= (a0[10] >= v3)));
+            {
+                int i7 = 0;
+                do {
+                    if ((v0 % 5) > 63) break;
+                    v2 = (((95 % 7) - (v3 || v3)) < ((a1[1][8] + a1[3][11]) % 4));
+                    v3 = (((a0[0] >= i6) ? (v0 && 43) : (v1 >= a1[3][5])) ? ((v2 % 9) ? (v0 * v1) : (79 == 60)) : ((51 || i6) % 2));
+                    v2 = (((a0[0] || v0) == (1 >= v3)) && ((i7 != a1[0][4]) % 8));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    return (((79 ? v1 : v3) > (v0 || v1)) >= ((v2 / 7) || (a0[12] / 7)));
+}
+int main() {
+    return 0;
+}
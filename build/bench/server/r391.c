@@ -0,0 +1,102 @@
+int f0() {
+    int v0 = 96;
+    int v1 = 59;
+    int v2 = 93;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 > v1) == (v0 > v0)) * ((a1[3][1] || v3) ? (v3 + v1) : (91 != a1[1][0])));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v0 ? i0 : v1) > 53) break;
+            v1 = (((v0 % 6) || (76 - v2)) - ((v1 ? v3 : v1) && (v1 > v1)));
+            v3 = (((9 >= 94) % 4) != ((a1[3][2] || i0) ? (12 == 18) : (v2 || v2)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((a0[12] ? 93 : v1) > 76) break;
+                v0 = (((i1 || i1) ? (a0[8] > 75) : (v1 || v0)) % 7);
+                v3 = (((v1 != 82) < (a1[3][3] - 33)) < ((a1[2][10] + a0[8]) != (a1[2][14] ? v0 : v3)));
+                v0 = (((2 + v0) / 8) > ((43 <= a1[1][5]) > (57 != v2)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 > a1[1][11]) < (v3 <= v0)) ? ((a1[2][6] * v0) / 3) : ((a0[13] * 34) / 9))) {
+        a1[1][13] = (((82 * v2) <= (v1 ? v1 : 59)) >= ((25 / 5) > (v0 - 16)));
+        v1 = (((a0[6] > v0) || (a0[11] / 9)) < ((a1[3][10] <= 20) % 8));
+        a1[3][10] = (((v3 ? v0 : v1) == (85 % 3)) && ((v2 - 73) + (19 == 69)));
+    } else {
+        v1 = (((v2 + 83) ? (v3 == a0[9]) : (v3 != 6)) == ((v2 || 2) && (v1 == v2)));
+        v1 = (((v1 && a0[3]) || (58 || v0)) ? ((38 >= v1) && (v0 >= 54)) : ((96 ? 87 : 92) - (v1 ? 24 : 36)));
+        a1[0][4] = (((v1 - a1[1][14]) >= (v2 < v2)) ? ((v0 != 64) < (v2 == 58)) : ((51 < 2) <= (90 && v2)));
+    }
+    if ((((v0 && a1[1][3]) - (a1[0][6] * v2)) ? ((v2 && 81) <= (a1[2][9] <= 84)) : ((70 >= v2) == (a0[13] != v3)))) {
+        a0[7] = (((v1 ? v3 : 19) * (22 <= v2)) < ((v2 ? v1 : 36) && (38 / 4)));
+        a1[3][8] = (((a0[13] >= a1[1][12]) ? (44 * 70) : (a0[7] != v0)) >= ((v2 < 79) >= (v3 || a0[0])));
+        a0[11] = (((v1 >= a1[1][3]) * (71 * a0[6])) == ((v0 * a0[6]) == (v0 && 30)));
+    } else {
+        v0 = (((v2 <= 22) == (44 / 9)) % 1);
+        v2 = (((v3 % 1) ? (33 != v0) : (50 || v1)) != ((54 % 6) * (v0 <= a0[8])));
+        a1[0][8] = (((v2 ? v3 : a1[0][8]) != (a0[6] - a1[3][13])) < ((2 < v0) ? (v2 ? v3 : v0) : (v3 ? v3 : v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[2][9] = (((75 % 2) >= (a0[6] != a0[3])) <= ((v1 * 9) ? (v0 <= a0[4]) : (73 % 7)));
+            {
+                int i3 = 0;
+                do {
+                    if ((76 > v2) > 94) break;
+                    v1 = (((a1[2][14] && a0[10]) + (v3 == v1)) && ((27 ? v0 : v3) % 1));
+                    a0[13] = (((46 >= a1[0][5]) ? (93 && i3) : (73 % 1)) + ((i3 < v2) < (a1[0][11] - a0[5])));
+                    v1 = (((41 / 2) == (v2 != a0[13])) * ((3 ? 83 : v2) || (26 <= v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v0 = (((v0 % 2) * (a0[11] + v2)) || ((v3 ? v3 : v3) && (36 - a0[12])));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    return (((47 + 39) == (v1 >= v2)) < ((v0 >= v1) == (v0 * v3)));
+}
+int f1() {
+    int v0 = 15;
+    int v1 = 58;
+    int v2 = 98;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][10] >= a1[3][6]) == (v3 != 31)) && ((v3 - 43) - (v3 * v3)))) {
+        v0 = (((92 ? v0 : v2) >= (v2 ? a0[10] : 16)) / 6);
+        v3 = (((78 - 84) - (a1[1][6] > 84)) ? ((a1[0][10] != v0) - (v2 - a0[13])) : ((40 <= v3) % 6));
+        a0[12] = (((v3 ? v2 : 35) * (v0 != 94)) + ((v0 * v1) / 1));
+    } else {
+        v1 = (((v2 / 5) == (75 < v2)) != ((a0[15] == v0) / 5));
+        a0[2] = (((39 && 10) <= (a1[2][3] < 65)) / 6);
+        v0 = (((78 >= a0[12]) + (79 == a0[8])) > ((a0[5] + a0[12]) - (a0[9] != v0)));
+    }
+    if ((((v1 < a1[1][11]) && (v3 - v3)) - ((v0 % 4) && (9 < a1[0][0])))) {
+        v3 = (((21 < 7) <= (v0 < v2)) - ((a1[1][4] % 9) / 1));
+        v3 = (((v2 % 8) && (a0[1] >= a1[0][14])) * ((v3 ? v2 : a0[0]) % 9));
+        a0[9] = (((a1[1][7] * v0) % 5) != ((v2 != v0) || (50 == v2)));
+    } else {
+        v0 = (((a0[3] % 7) ? (v2 && 4) : (v2 * v3)) && ((a1[0][2] >= v0) != (v1 + 43)));
+        v1 = (((v1 + a0[15]) ? (a0[3] * v1) : (v0 && 98)) == ((v1 > a1[0][6]) != (v2 * 5)));
+        v2 = (((v3 ? a0[4] : v1) / 6) + ((78 % 2) != (61 && v0)));
+    }
+    a1[2][8] = (((a0[12] * v1) || (89 || v2)) * ((v1 - a0[10]) + (v1 % 9)));
+    a0[9] = (((a1[3][11] != 54) * (v0 || v1)) != ((8 && v0) % 5));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        a0[14] = (((v3 / 6) > (a0[12] ? v2 : v3)) == ((v3 - 2) < (a1[2][0] <= 75)));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v2 = (((a0[2] / 9) >= (v0 * 69)) < ((a1[2][15] && 62) >= (11 || 7)));
+            v0 = (((a1[3][4] ? v2 : v3) > (v0 < i0)) / 7);
+            v0 = (((v2 * a0[13]) > (99 != a0[10])) >= ((52 != 5) != (11 >= v2)));
+        }
+        v1 = (((v0 >= a1[0][9]) ? (v3 + 72) : (v0 + v1)) < ((a0[0] ? v3 : 53) ? (a0[8] < a1[3][12]) : (v2 / 1)));
+    }
+    return (((16 + a0[13]) ? (97 > 6) : (a1[2][10] == v3)) - ((a1[3][1] % 1) || (77 ? v1 : 62)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,181 @@
+int f0() {
+    int v0 = 19;
+    int v1 = 44;
+    int v2 = 61;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 ? 42 : v2) > (v1 % 2)) == ((88 <= v3) != (v3 > v3)))) {
+        v0 = (((v0 == a0[13]) > (a0[0] + 55)) <= ((v3 / 7) ? (v1 >= v0) : (54 <= 6)));
+        v2 = (((a1[2][0] || v2) == (v2 >= a0[11])) % 3);
+        v1 = (((v1 && 91) < (a0[5] + 64)) * ((v0 && v3) <= (96 != a0[6])));
+    } else {
+        a0[9] = (((a0[11] / 2) > (v2 ? v0 : v3)) ? ((68 || v3) * (v1 ? a1[1][14] : v3)) : ((96 - 84) ? (v0 < 26) : (a1[3][10] * v0)));
+        a1[0][6] = (((a1[3][13] || a1[3][6]) <= (a1[0][14] < a1[0][4])) != ((v3 - v3) + (a1[3][0] > a1[2][5])));
+        a1[2][0] = (((v1 + a0[3]) / 4) >= ((a0[6] % 2) - (v2 % 4)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v1 = (((v3 - a1[1][0]) % 5) != ((v2 == 10) != (i0 != a0[7])));
+            v3 = (((v0 - v3) / 6) > ((a0[0] != 7) == (a1[2][6] / 4)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a1[3][9] = (((a1[1][9] / 8) ? (i0 ? a0[2] : 61) : (a1[2][14] > 62)) % 9);
+                    v0 = (((v0 ? a1[2][4] : a0[9]) != (a1[0][14] / 6)) != ((i0 && 88) / 8));
+                    v0 = (((i1 + v1) * (76 / 1)) * ((21 ? v1 : 5) / 4));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v2 == v1) % 5) / 2);
+    if ((((v2 >= 5) != (a1[0][9] ? v2 : a1[2][15])) ? ((v3 != v0) < (v3 <= v1)) : ((79 ? v3 : v0) % 6))) {
+        v3 = (((a0[2] + a1[1][5]) / 9) % 9);
+        a0[13] = (((a0[3] * 79) > (79 <= a0[15])) >= ((v2 - 48) % 2));
+        a0[5] = (((v2 != 22) ? (v1 <= a0[11]) : (v0 <= v1)) / 8);
+    } else {
+        a1[1][4] = (((v0 ? v3 : v1) % 9) >= ((a1[1][6] + v2) % 2));
+        v2 = (((v3 || v0) || (a1[2][14] + v1)) / 8);
+        a0[7] = (((v3 || 62) < (a1[2][12] ? a0[9] : 97)) == ((v3 && v0) == (v0 != v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((77 > a0[10]) > 93) break;
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v3 = (((v1 != i3) != (v1 && a0[5])) * ((4 && a1[0][15]) || (25 == v2)));
+                v0 = (((a1[3][8] * 22) >= (v3 * a1[1][0])) - ((17 > v1) + (i3 * v0)));
+                a0[12] = (((v2 * v1) * (v1 / 4)) + ((v0 ? a0[7] : 31) + (v1 >= i3)));
+            }
+            v1 = (((87 || i2) != (a0[1] == 3)) == ((v2 || 22) > (v2 + 20)));
+            v1 = (((11 <= a1[3][10]) % 6) == ((44 == a1[0][5]) > (i2 > v1)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    return (((v1 ? a0[6] : v0) + (v2 % 8)) ? ((46 && a1[1][7]) == (71 || 99)) : ((v1 % 8) < (55 <= v2)));
+}
+int f1() {
+    int v0 = 22;
+    int v1 = 74;
+    int v2 = 82;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((42 < a1[0][9]) >= (92 || a1[1][0])) - ((v1 || a1[3][4]) != (a1[2][4] % 3)));
+    if ((((v3 && v0) == (v3 * v1)) || ((17 ? v3 : v2) > (v3 && v0)))) {
+        v3 = (((60 % 4) == (25 ? a0[11] : 40)) % 7);
+        a1[3][13] = (((v1 < 88) < (a0[14] <= v2)) || ((v1 && v2) == (79 <= 27)));
+        v2 = (((v2 + a1[2][13]) ? (31 || v1) : (a1[0][2] < v0)) && ((49 != v2) >= (a0[7] + v2)));
+    } else {
+        v3 = (((v0 - v3) < (68 > v1)) / 7);
+        a1[3][11] = (((v1 <= a0[1]) && (12 ? v3 : a1[2][3])) + ((v2 ? v2 : v1) ? (v0 >= a0[3]) : (v2 < a0[1])));
+        v3 = (((v2 == v0) || (v1 && v3)) != ((13 + 73) - (v2 + v3)));
+    }
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a1[1][3] = (((90 == i0) <= (11 % 9)) == ((i0 / 4) ? (32 ? a1[0][2] : 83) : (v1 != v1)));
+        v1 = (((21 != v1) ? (v2 % 7) : (a1[2][3] != i0)) || ((5 ? a0[15] : 63) - (v1 >= a0[3])));
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            v0 = (((a1[3][13] % 9) || (v1 * v2)) <= ((v3 ? v1 : a1[0][9]) % 9));
+            v2 = (((a1[0][7] - v0) >= (v1 - v1)) && ((i0 > v0) == (i0 <= v2)));
+            v2 = (((i1 - v0) && (39 % 2)) > ((i1 == a0[9]) ? (a0[15] || 79) : (i1 || a1[0][15])));
+        }
+    }
+    if ((((v3 > a1[1][12]) <= (v0 + a0[14])) % 7)) {
+        a1[0][10] = (((a0[13] != a0[15]) - (v0 < v1)) > ((v0 % 3) * (v3 - 97)));
+        v2 = (((v0 % 8) * (v1 / 2)) / 7);
+        a1[0][6] = (((20 ? a0[10] : v3) * (v2 != a0[7])) + ((v0 <= a0[2]) ? (5 ? 23 : v2) : (63 != v1)));
+    } else {
+        v3 = (((v1 && v0) != (a0[10] <= 88)) < ((v2 != 80) - (v3 / 3)));
+        v3 = (((a1[3][9] - a1[0][11]) == (a0[1] && v2)) % 4);
+        v3 = (((48 >= 46) >= (v0 && 61)) == ((a0[4] < a1[2][5]) - (v0 <= v1)));
+    }
+    a0[10] = (((a1[1][15] + a0[13]) ? (v1 == 97) : (v1 && 7)) + ((v0 - v0) - (v0 - v1)));
+    return (((62 ? a0[8] : 30) && (96 % 7)) != ((a1[3][9] % 6) <= (59 ? a0[11] : a0[12])));
+}
+int f2() {
+    int v0 = 12;
+    int v1 = 22;
+    int v2 = 85;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((61 ? 64 : v1) > 73) break;
+            v2 = (((v3 > v1) ? (a0[15] >= v3) : (70 ? v3 : a0[13])) >= ((a0[9] ? 78 : v1) == (v3 >= v1)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v3 = (((14 ? a0[15] : 98) == (v1 - i1)) <= ((17 - a0[3]) != (45 == 65)));
+                    v3 = (((v0 ? 85 : 56) && (v0 ? v0 : a1[1][5])) >= ((v3 != v3) % 3));
+                    a0[14] = (((52 < i1) + (a0[9] % 3)) % 4);
+                    i1 = i1 + 1;
+                }
+            }
+            a0[7] = (((v0 - a1[3][0]) <= (v0 < v0)) && ((v0 * v1) > (7 ? 70 : 4)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 * a0[7]) != (v2 == a0[11])) != ((v3 >= a1[0][9]) % 2))) {
+        v1 = (((v3 < v1) - (a1[2][12] / 4)) || ((22 <= a0[15]) <= (v2 == a1[2][4])));
+        a1[3][14] = (((a0[3] - 4) ? (a0[13] == a0[13]) : (a1[2][15] ? v2 : v2)) == ((a1[0][3] / 5) <= (32 <= v0)));
+        v3 = (((v0 == v3) > (a1[1][2] || v0)) != ((a1[0][10] / 2) / 4));
+    } else {
+        v1 = (((63 && v1) - (2 - a0[4])) * ((v1 == v2) ? (v1 <= a0[6]) : (v0 || 68)));
+        v1 = (((v1 >= 1) + (v0 == v1)) || ((45 > v2) ? (v3 + v1) : (81 / 8)));
+        a0[15] = (((v3 % 2) < (51 != 60)) / 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[9] > 28) > 60) break;
+            a0[6] = (((a1[3][5] ? v2 : a1[1][12]) ? (i2 ? 11 : v3) : (86 <= v3)) > ((60 != a0[4]) >= (a0[8] && v1)));
+            v0 = (((90 / 7) != (i2 ? a1[0][13] : v2)) / 7);
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[3][6] >= v3) > 73) break;
+                    a1[0][5] = (((a0[8] + 21) ? (i3 ? v2 : v3) : (67 < a1[2][6])) - ((v1 ? a0[0] : a0[1]) ? (17 / 6) : (a0[2] * v1)));
+                    v2 = (((18 % 6) != (a1[0][15] ? a0[4] : v1)) / 5);
+                    a0[14] = (((v2 != v1) % 3) > ((v0 + a1[0][11]) >= (i2 == i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[2][8] = (((a1[3][13] >= v3) == (a0[4] ? a1[0][5] : v3)) ? ((a1[3][2] > 65) > (19 <= 50)) : ((v1 && v3) || (a0[7] % 4)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v2 <= a0[13]) <= (v2 % 3)) > ((49 == a0[10]) || (a0[14] / 5)));
+                    a0[11] = (((63 && 46) < (a1[0][2] ? v1 : a0[14])) * ((92 % 6) >= (v2 + a1[3][6])));
+                    v2 = (((v0 * v0) == (a1[0][3] && a1[0][10])) - ((v2 - 41) <= (i5 * 44)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v0 = (((a0[9] * v1) - (a0[13] <= a0[3])) * ((v1 / 7) <= (a1[0][8] / 7)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    if ((((31 + a0[14]) || (a1[3][4] == v1)) != ((a0[4] > a0[13]) % 4))) {
+        v3 = (((78 ? 57 : v2) && (13 / 1)) && ((v3 && v3) <= (v3 >= 60)));
+        v2 = (((a1[3][1] < 5) != (v2 % 4)) - ((43 / 3) <= (v0 % 2)));
+        a1[0][0] = (((v1 * v0) % 5) > ((78 ? 77 : 57) + (a0[7] * v0)));
+    } else {
+        a1[3][15] = (((a1[1][5] >= 70) - (v0 + v1)) / 4);
+        v0 = (((a1[1][13] ? 95 : v2) <= (a0[2] == 19)) / 7);
+        v1 = (((v2 || v2) ? (v2 || 21) : (39 < 88)) ? ((3 && 5) - (v2 / 4)) : ((a1[0][10] / 7) && (v3 > v2)));
+    }
+    return (((v1 <= v2) > (v0 % 7)) >= ((v3 + 20) && (a0[11] < 64)));
+}
+int main() {
+    return 0;
+}
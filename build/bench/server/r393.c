@@ -0,0 +1,73 @@
+int f0() {
+    int v0 = 87;
+    int v1 = 94;
+    int v2 = 92;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                a0[10] = (((v3 - v1) && (a0[14] <= i0)) % 7);
+                v1 = (((66 - a1[1][11]) || (a1[3][3] >= a1[3][0])) >= ((v3 ? a1[2][8] : 76) * (v2 + 31)));
+                a0[6] = (((54 || a1[0][8]) - (a0[13] != 43)) <= ((a0[3] / 6) ? (43 + a1[3][12]) : (i0 % 7)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        a1[0][13] = (((v3 ? a1[2][9] : v0) > (27 - i0)) > ((14 >= v0) <= (v1 >= 36)));
+        v3 = (((a0[4] > 39) != (i0 <= a1[1][2])) >= ((v1 / 3) && (v1 < a1[0][8])));
+    }
+    a0[14] = (((v3 * a1[1][4]) > (47 == a1[3][0])) % 4);
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v2 = (((v3 > v2) ? (a1[3][13] || 98) : (v3 + a1[0][3])) > ((46 ? v1 : 14) == (19 ? 24 : v3)));
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                a1[2][12] = (((86 <= i2) % 5) == ((64 != 1) % 1));
+                v1 = (((v3 && a1[1][0]) && (v0 && v2)) || ((v1 || a0[11]) ? (v2 || v2) : (v1 % 4)));
+                v3 = (((a1[3][13] == a0[14]) ? (i2 ? 63 : v1) : (v1 % 4)) % 7);
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v1 % 4) >= (a1[2][11] ? v3 : 48)) <= ((v3 * 37) && (77 <= 75)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((v1 >= i5) * (a0[0] != v2)) < ((v2 && a0[11]) / 1));
+                    v0 = (((i4 ? 89 : a1[1][1]) / 3) || ((i4 ? v0 : 23) || (v3 - i4)));
+                    v1 = (((a0[14] + 12) == (v3 + 22)) / 9);
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v1 = (((a0[10] > a0[6]) || (a1[1][7] >= 59)) ? ((a1[1][15] < 6) > (v3 <= v2)) : ((i4 <= v1) != (v3 != a1[0][2])));
+            a0[15] = (((a0[10] ? a1[1][12] : 94) ? (v1 ? v1 : 28) : (v3 != a0[12])) != ((v1 && a0[11]) / 4));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            v1 = (((a0[9] ? v1 : i6) && (v0 >= 41)) || ((v0 != v0) >= (v0 + v2)));
+            {
+                int i7 = 0;
+                while (i7 < 3) {
+                    v1 = (((i6 <= v2) && (v1 == 23)) + ((39 == 60) % 8));
+                    v3 = (((99 * v3) / 6) - ((67 > v0) + (v1 <= i7)));
+                    v2 = (((v3 ? v3 : i6) ? (v2 < i6) : (v1 * v0)) % 4);
+                    i7 = i7 + 1;
+                }
+            }
+            a1[1][1] = (((v3 != 5) && (i6 % 2)) == ((38 <= i6) < (v3 + 97)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v1 ? v1 : 26) + (a1[0][3] <= a1[3][1])) * ((a1[1][11] + v0) < (v1 - v0)));
+}
+int main() {
+    return 0;
+}
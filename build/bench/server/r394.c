@@ -0,0 +1,126 @@
+int f0() {
+    int v0 = 56;
+    int v1 = 89;
+    int v2 = 62;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v1 = (((81 <= i0) + (a1[2][13] != a0[3])) ? ((v1 <= v1) * (19 > a1[0][12])) : ((0 || v0) - (a0[4] ? 55 : a1[2][7])));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v1 = (((a1[0][8] % 4) * (i0 / 9)) - ((v1 > i1) - (40 < a0[10])));
+                v2 = (((67 * a1[0][1]) ? (41 != 89) : (i1 > v1)) ? ((a0[11] != v0) + (87 < v1)) : ((36 >= v2) && (i0 / 6)));
+                a0[0] = (((37 / 8) < (a0[3] <= a1[3][8])) - ((v2 <= v2) + (v0 + a0[4])));
+            }
+            a1[1][1] = (((96 + v0) % 8) ? ((v0 + 69) >= (i0 == i0)) : ((45 + v0) ? (37 == 5) : (v3 < a0[13])));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((v1 > i2) > 92) break;
+        v1 = (((v2 / 6) && (v2 ? 30 : 52)) != ((v0 && v1) - (52 > 88)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            if ((a0[8] < i3) > 51) break;
+            v2 = (((i3 > i2) || (i3 / 8)) >= ((v2 ? i2 : v3) ? (v1 && a1[3][7]) : (i3 != v0)));
+            v3 = (((11 + i2) * (81 || 97)) >= ((65 || a0[2]) <= (v2 < 78)));
+            v1 = (((v0 + 14) ? (i3 <= a0[6]) : (i3 || 11)) - ((a0[4] - v0) == (a0[5] != v2)));
+        }
+        a0[5] = (((a0[2] <= v2) / 2) ? ((a1[3][13] <= v1) <= (a1[2][2] && v1)) : ((v1 / 5) * (15 ? 90 : v0)));
+    }
+    if ((((v3 / 2) > (a0[14] == v2)) ? ((v1 >= 94) == (v1 != v0)) : ((4 < 65) ? (v1 >= a1[0][2]) : (v1 != v2)))) {
+        v1 = (((a0[12] ? 51 : 53) >= (79 || 36)) || ((86 - 1) == (a0[12] - 26)));
+        v1 = (((v3 != v3) * (v2 ? a0[2] : a1[0][2])) ? ((v1 != 28) != (60 / 8)) : ((1 ? 19 : v2) - (a0[13] || a1[2][5])));
+        v1 = (((a1[0][4] % 6) * (a1[2][10] || a0[0])) * ((v3 <= v2) <= (1 && 40)));
+    } else {
+        a0[11] = (((v0 >= v2) < (a1[3][10] + v1)) >= ((92 < 35) < (a1[1][10] || v3)));
+        a1[1][10] = (((a1[3][3] >= 99) + (v3 ? 68 : 4)) / 3);
+        v1 = (((a0[10] >= v1) < (a0[15] * 92)) + ((v2 + v3) * (v3 <= a0[9])));
+    }
+    if ((((v0 * v2) ? (v0 == v3) : (a0[8] - 98)) > ((v2 * v2) >= (69 > 95)))) {
+        v0 = (((a0[1] - a1[2][6]) == (v0 / 3)) == ((a1[3][2] == v3) + (a0[6] < a0[4])));
+        v2 = (((v3 > v1) - (v3 ? v2 : 91)) || ((v2 - v2) > (27 + v1)));
+        a0[11] = (((67 > a1[2][12]) / 8) < ((a0[14] ? a1[3][10] : v0) || (v2 <= a1[0][6])));
+    } else {
+        v1 = (((a1[1][9] >= v2) == (v2 != v0)) + ((v3 > a0[9]) || (v1 % 3)));
+        a1[1][15] = (((a0[2] + 42) || (v1 / 3)) && ((11 * v2) / 8));
+        v3 = (((v2 / 8) != (92 ? a0[6] : 47)) == ((8 ? a1[0][14] : a0[8]) < (v2 ? a1[3][11] : v1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v3 = (((93 && 7) != (a0[6] ? 31 : a1[1][3])) ? ((v0 != v0) * (a1[0][12] || 31)) : ((v0 && 28) >= (21 - a1[2][9])));
+                v3 = (((v2 < 52) < (a0[3] < a1[2][11])) != ((a0[6] < v3) || (69 ? a0[0] : 42)));
+                v3 = (((a1[3][11] == a0[5]) != (i4 < v3)) % 5);
+            }
+            v0 = (((a0[15] * a0[11]) ? (a1[3][5] * 90) : (a0[7] / 4)) ? ((i4 / 5) % 5) : ((v0 || a0[3]) * (a1[2][1] ? a1[0][13] : v0)));
+            a0[6] = (((v1 < a0[13]) || (v3 - a0[2])) + ((55 + v2) && (v1 && v2)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v3 ? a1[1][1] : 21) - (v2 == 24)) != ((v1 ? 90 : 9) && (18 == 25)));
+}
+int f1() {
+    int v0 = 67;
+    int v1 = 51;
+    int v2 = 12;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a1[1][14] = (((i0 || a0[10]) <= (v3 < a0[3])) <= ((38 && v0) / 9));
+        v1 = (((a1[3][12] % 8) != (v3 % 9)) < ((v0 && a1[2][2]) == (v0 > i0)));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a0[0] = (((v2 % 2) <= (i0 * v1)) + ((v2 == 70) >= (v3 + a1[2][7])));
+            a1[0][13] = (((35 * v3) ? (a1[1][10] <= i0) : (v3 - a0[1])) * ((2 % 5) - (a0[10] / 4)));
+            v2 = (((83 + i1) ? (v0 >= i0) : (a0[12] != i0)) * ((24 && i0) ? (21 > 20) : (v2 * a1[2][8])));
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v0 = (((a1[3][12] ? i2 : a1[3][5]) != (v0 ? a0[9] : i2)) < ((81 ? a1[3][14] : v2) > (v2 >= v0)));
+        v1 = (((v2 * v3) > (v1 + 48)) <= ((30 != 83) < (a1[1][12] || a1[0][2])));
+        {
+            int i3 = 0;
+            do {
+                a1[0][10] = (((v2 <= v2) <= (a1[2][2] >= a0[3])) + ((52 == 20) < (a1[0][12] != i3)));
+                v3 = (((92 ? v0 : a1[2][12]) <= (v1 <= a1[2][13])) == ((i2 / 6) >= (a1[0][5] > i2)));
+                v0 = (((12 ? a0[14] : 57) ? (v3 < i3) : (v1 ? i2 : v2)) > ((v3 != i3) % 1));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    a1[2][5] = (((v3 - v2) || (a0[7] - a0[4])) % 3);
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                a1[3][8] = (((v0 != i5) % 3) ? ((i4 ? a1[0][1] : v2) + (9 <= a1[3][14])) : ((v2 >= v1) ? (91 < a0[13]) : (a0[8] + 10)));
+                a0[10] = (((v3 / 9) >= (a0[4] * v1)) / 9);
+                v1 = (((v1 % 6) / 2) == ((v1 != i5) + (a0[14] <= v0)));
+            }
+            a1[0][2] = (((i4 ? a0[3] : i4) ? (91 - v0) : (a0[7] != v3)) * ((v3 ? v2 : 16) <= (v2 * v2)));
+            a0[7] = (((62 >= v3) * (a0[1] % 9)) && ((v0 > 5) / 3));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            v1 = (((10 >= v2) && (v2 - v0)) % 2);
+            v2 = (((97 != i6) % 1) % 3);
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                if ((64 == a1[0][13]) > 98) break;
+                v1 = (((19 % 3) / 7) || ((a1[3][15] + v0) == (a1[2][13] && i6)));
+                v1 = (((67 ? a1[2][1] : 92) + (i7 * i7)) * ((v0 - a0[8]) != (a1[2][12] > v1)));
+                v1 = (((i7 * 47) ? (a0[0] / 6) : (a1[2][0] || a1[1][4])) <= ((i7 ? v0 : 65) || (v2 != 67)));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((a0[8] && 29) <= (a1[3][6] - v1)) - ((v0 ? v1 : v0) % 2));
+}
+int main() {
+    return 0;
+}
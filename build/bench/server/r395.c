@@ -0,0 +1,167 @@
+int f0() {
+    int v0 = 92;
+    int v1 = 0;
+    int v2 = 87;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    if ((((35 < 0) != (v3 ? 29 : a0[12])) && ((a0[12] <= 59) % 2))) {
+        v2 = (((22 * 56) % 8) <= ((v0 || v3) || (97 - v0)));
+        v3 = (((63 && v2) || (90 * v0)) / 3);
+        v2 = (((v2 <= 14) / 8) ? ((v0 % 1) < (20 <= a1[3][5])) : ((a0[14] && v0) > (v3 && v2)));
+    } else {
+        v2 = (((46 % 3) ? (a0[3] * v2) : (v2 - v3)) + ((a0[6] % 1) <= (v1 <= 43)));
+        v1 = (((v0 == a1[2][6]) > (v3 == v3)) / 2);
+        v2 = (((v1 > v1) < (a1[3][15] < v3)) || ((75 % 2) - (v0 != v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((v2 == a1[0][6]) - (v1 <= 40)) != ((21 >= v3) <= (v2 ? 14 : 5)));
+            a0[7] = (((0 == 31) >= (i0 <= a1[2][14])) && ((36 / 3) + (v3 / 4)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((v0 + 61) >= (a1[1][7] / 3)) - ((80 * v1) % 2));
+                v2 = (((a1[1][12] >= 8) > (a1[0][7] + 33)) != ((v0 == 90) - (a0[0] || i0)));
+                a1[1][7] = (((a1[1][14] < v1) + (v1 / 7)) < ((6 && 55) >= (i1 + v3)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v1 != v2) && (v0 <= a0[9])) || ((v3 % 2) < (a0[0] - v2)));
+    if ((((v3 - 33) ? (v1 >= v1) : (33 / 8)) == ((85 < 43) + (a1[1][15] + v3)))) {
+        a0[4] = (((v0 + a1[1][6]) == (v1 >= v2)) <= ((v1 ? a0[4] : a1[3][2]) == (a0[11] != v3)));
+        a0[3] = (((v3 / 3) ? (v0 > 21) : (a0[9] && v0)) ? ((v1 < a1[1][10]) ? (v3 == v2) : (v0 % 9)) : ((v0 / 4) > (v0 ? a0[3] : 45)));
+        v0 = (((1 * 99) ? (44 < v3) : (a1[0][3] ? v0 : a1[3][12])) >= ((a1[2][11] ? v1 : a0[1]) * (v0 ? v3 : 12)));
+    } else {
+        a1[3][6] = (((64 >= a1[1][8]) >= (65 || v1)) - ((v1 * v0) ? (v2 / 5) : (a1[1][7] || v2)));
+        v2 = (((v1 ? a1[3][4] : a0[5]) - (v3 >= v2)) < ((a1[3][3] > v0) ? (v3 ? a1[1][9] : 87) : (a0[12] < a0[9])));
+        v2 = (((v3 <= a0[10]) * (61 ? a1[1][2] : v3)) || ((v1 ? a1[2][14] : v0) || (v2 ? 10 : v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v0 = (((99 > v0) == (i2 >= 8)) ? ((a1[3][11] != 41) ? (43 && i2) : (v3 > 47)) : ((v2 >= v3) % 6));
+            a0[6] = (((v0 * v0) ? (a0[2] / 9) : (a1[0][2] > a1[3][15])) ? ((v1 % 3) != (v2 <= v1)) : ((v1 <= 11) % 6));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((a0[0] && a0[10]) ? (a1[2][0] && a1[1][5]) : (a0[14] != v1)) ? ((a0[4] ? i3 : 63) <= (67 - v3)) : ((v3 * i2) < (51 / 3)));
+                    v2 = (((a0[15] * v2) > (93 ? v0 : a1[1][15])) ? ((v1 + v1) <= (67 * v0)) : ((v2 + v3) <= (i2 != a1[3][10])));
+                    a0[14] = (((25 || a0[4]) ? (i3 > a0[7]) : (a1[3][8] ? v0 : 6)) / 8);
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((v1 == a0[5]) + (v1 && a1[1][12])) || ((v3 > 48) || (82 == a1[1][5])));
+}
+int f1() {
+    int v0 = 8;
+    int v1 = 94;
+    int v2 = 65;
+    int v3 = 48;
+    int a0[16];
+    int a1[4][16];
+    if ((((26 % 8) == (v0 + a1[1][0])) - ((v2 / 4) % 8))) {
+        v1 = (((60 && 95) * (v0 % 2)) + ((60 && v2) - (v0 ? 66 : 41)));
+        v1 = (((v2 >= v3) != (a0[3] ? v0 : a1[3][3])) && ((v2 >= 16) < (v3 / 7)));
+        v0 = (((a0[9] % 6) <= (v1 * 94)) > ((v1 + a1[1][9]) != (a0[6] % 7)));
+    } else {
+        a0[1] = (((v2 > v3) >= (v2 == v0)) > ((10 != v1) < (v0 || v1)));
+        v0 = (((68 ? v0 : a0[1]) ? (a0[5] && v3) : (v3 == v3)) ? ((v1 != v2) ? (v3 >= v2) : (v1 - a1[2][7])) : ((a0[9] > a0[9]) >= (v0 == 86)));
+        a0[11] = (((v3 ? v0 : v1) != (v1 * v2)) >= ((12 < v3) && (v0 >= 55)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((42 && a1[0][13]) > 60) break;
+        v0 = (((v2 != v1) <= (v2 != i0)) - ((i0 < v2) + (v0 % 6)));
+        v3 = (((v1 ? i0 : a0[15]) + (97 - a1[3][0])) % 7);
+        {
+            int i1 = 0;
+            do {
+                a0[8] = (((56 || v1) - (v0 == v2)) > ((v0 <= i1) ? (v2 <= a1[3][8]) : (i0 != v1)));
+                v2 = (((23 == a0[4]) ? (v2 <= v1) : (v2 > 95)) || ((a0[2] * v0) >= (a0[12] == a1[3][7])));
+                a1[3][14] = (((a1[0][11] >= v0) / 4) || ((i1 == v3) * (a0[8] ? i1 : i0)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+    }
+    if ((((v2 || 70) ? (a1[1][9] < 99) : (a1[2][15] < v2)) ? ((v1 < v3) || (1 != v3)) : ((v3 % 4) / 8))) {
+        v1 = (((13 % 5) ? (v0 == v3) : (v0 && a0[9])) ? ((v2 - v2) + (v2 ? a1[0][15] : 59)) : ((v1 ? v3 : 94) || (v2 == a1[0][2])));
+        a0[12] = (((v1 > v2) == (54 - v3)) > ((v3 && a1[2][1]) < (v0 > 13)));
+        a1[1][7] = (((v1 || 31) + (52 != 20)) != ((88 - a0[11]) ? (v3 > 24) : (48 / 2)));
+    } else {
+        v1 = (((v0 < 88) / 3) ? ((84 * v3) || (v3 && a1[0][4])) : ((91 || v1) > (6 + v0)));
+        v3 = (((v3 == 97) * (66 * a0[9])) ? ((a1[3][7] + v0) || (v0 < v1)) : ((11 != v1) >= (v0 != a1[1][2])));
+        a0[11] = (((a0[8] == v1) < (v1 == v3)) * ((a0[8] % 9) || (a0[3] + a0[4])));
+    }
+    v1 = (((v3 == v1) + (a0[0] != a0[6])) < ((v2 || v0) + (51 + a0[0])));
+    v1 = (((a1[3][6] != v1) || (v0 && v2)) + ((v3 - 3) < (v2 + a0[4])));
+    return (((v2 * v0) ? (v0 <= a1[3][5]) : (57 || v2)) != ((v0 ? v3 : a1[0][7]) == (v1 == v3)));
+}
+int f2() {
+    int v0 = 81;
+    int v1 = 1;
+    int v2 = 0;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][11] > a1[2][11]) / 2) + ((v0 ? 5 : a0[11]) != (a1[2][4] >= v0)))) {
+        a1[1][12] = (((36 / 6) != (a0[13] || v1)) <= ((v3 ? 76 : 91) % 7));
+        v3 = (((v1 || v2) + (10 / 7)) < ((22 ? a1[3][2] : a0[9]) * (v3 / 7)));
+        v3 = (((a1[3][7] - v2) - (60 && 66)) / 8);
+    } else {
+        v2 = (((66 <= v3) ? (a1[3][14] ? v0 : a0[12]) : (v2 || a1[2][7])) * ((v3 / 1) ? (a1[1][0] >= v1) : (5 ? 55 : a1[0][12])));
+        v3 = (((v1 + 83) == (v3 ? 93 : 69)) * ((v2 || 69) - (30 * v2)));
+        a0[7] = (((v3 + 24) >= (v0 == v1)) / 4);
+    }
+    if ((((v3 < v3) ? (a1[1][6] != v1) : (a1[3][8] == v1)) + ((v2 != v1) >= (v3 <= a1[1][4])))) {
+        a1[2][13] = (((54 + 28) % 5) < ((v1 != a0[5]) ? (a1[0][12] + v0) : (94 ? v2 : v1)));
+        a0[12] = (((a1[1][1] <= 25) % 4) ? ((a1[2][15] <= v3) > (v2 >= a0[9])) : ((a1[2][8] ? a0[14] : 70) <= (v2 && 78)));
+        v3 = (((v3 <= v0) * (v2 || v0)) != ((a0[15] && v2) ? (90 && a1[3][7]) : (v0 ? a1[2][5] : a1[3][5])));
+    } else {
+        a1[0][8] = (((52 ? v3 : 39) >= (a0[9] >= v0)) != ((v0 <= 10) / 4));
+        v1 = (((14 - v2) <= (v3 ? v2 : v0)) - ((a1[0][9] && 65) ? (57 % 4) : (v1 != v2)));
+        v2 = (((v1 != v1) <= (v2 ? v0 : a1[1][1])) >= ((v2 * 79) == (v2 == a1[3][11])));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                if ((v2 < 22) > 83) break;
+                v2 = (((v1 < v2) || (i1 % 5)) && ((a1[0][10] % 8) <= (96 - v2)));
+                a0[4] = (((v1 != v3) * (79 < v2)) / 4);
+                v3 = (((12 != a0[2]) ? (a1[1][6] - i0) : (v1 * v0)) * ((i0 ? a1[3][7] : v1) != (a1[2][14] ? 19 : 20)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[0][13] = (((a0[1] == 54) < (i0 / 7)) * ((33 == 49) > (v0 ? 10 : a0[12])));
+        v1 = (((a0[11] < a1[2][12]) > (29 + v2)) < ((v0 ? v2 : 92) <= (v2 >= v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v3 = (((6 != v1) && (a0[1] || i2)) || ((a0[13] == i3) * (v0 >= i3)));
+                a1[0][11] = (((14 <= 38) && (a0[9] != a1[0][10])) == ((v1 + v3) / 2));
+                v2 = (((70 <= v3) * (a1[1][3] % 3)) % 1);
+            }
+            a0[12] = (((12 * v0) ? (a0[8] ? v1 : v0) : (v3 <= i2)) > ((a0[0] && i2) > (a1[1][15] < v3)));
+            v3 = (((a1[1][10] + 51) < (74 >= 57)) - ((21 - v3) / 2));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[1][15] <= 14) / 5) % 8)) {
+        v2 = (((v0 ? a1[0][7] : v2) == (v0 != v3)) ? ((21 % 1) <= (v3 >= v0)) : ((a0[3] ? v1 : v3) || (v2 && v2)));
+        a0[3] = (((a1[3][2] + a1[0][4]) * (v0 % 1)) && ((v0 || a0[6]) + (v0 || 51)));
+        v2 = (((a1[1][13] / 4) != (v3 + v1)) != ((a0[15] >= v0) - (v1 == v1)));
+    } else {
+        v1 = (((v3 % 9) - (v1 - v3)) < ((v0 >= 91) ? (a1[1][13] >= 25) : (a0[7] != v0)));
+        a0[1] = (((v1 && a0[10]) ? (v0 % 2) : (v3 ? v0 : 38)) > ((a1[3][6] + v0) ? (v3 ? 99 : v1) : (v0 / 6)));
+        v0 = (((v1 >= v3) + (v2 || 38)) != ((v1 > 99) ? (a0[10] * 23) : (v0 >= v1)));
+    }
+    return (((6 >= v1) >= (v0 ? v2 : v3)) - ((v0 || 45) && (v2 * v0)));
+}
+int main() {
+    return 0;
+}
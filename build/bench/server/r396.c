@@ -0,0 +1,45 @@
+int f0() {
+    int v0 = 11;
+    int v1 = 96;
+    int v2 = 0;
+    int v3 = 66;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v0 = (((i1 - 35) - (i1 != a1[3][12])) != ((a0[8] <= 84) == (a0[12] <= v0)));
+                v0 = (((a1[0][7] - a1[0][1]) <= (i0 < a0[8])) ? ((v2 ? a1[0][11] : v0) != (i0 > i1)) : ((v3 <= i0) ? (v2 <= v3) : (a0[1] - v3)));
+                v0 = (((v0 >= 43) / 7) * ((v3 > v1) || (v1 <= a1[3][0])));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((v1 || v1) || (0 ? v2 : i0)) ? ((a1[3][3] - v1) >= (i0 || v3)) : ((i0 - v0) || (a0[4] ? v1 : a1[2][12])));
+        v0 = (((v3 ? a0[14] : v1) * (v3 / 6)) ? ((v0 - v0) || (a0[9] + a1[0][0])) : ((i0 - 1) || (a1[2][11] + a1[3][1])));
+    }
+    if ((((75 <= v2) + (v0 || 59)) > ((v2 && v0) <= (a0[3] != 53)))) {
+        v0 = (((a0[0] - 62) && (52 && 25)) - ((96 - 53) / 6));
+        v2 = (((a0[3] * a1[2][3]) * (v2 < v0)) ? ((a1[3][9] <= v2) <= (v2 != a1[0][0])) : ((v3 || v1) * (a0[8] / 6)));
+        a1[3][8] = (((v1 % 2) * (v1 > 98)) != ((v0 / 4) != (25 > 72)));
+    } else {
+        v1 = (((a1[0][0] >= a0[12]) && (v3 > v2)) <= ((32 - a0[9]) * (a1[2][15] > 27)));
+        v3 = (((a0[10] == v3) != (v1 > 57)) > ((a0[4] && v0) < (v0 < a0[2])));
+        a0[10] = (((v2 == a1[3][8]) + (15 > v2)) ? ((v1 ? v3 : v0) / 8) : ((75 % 8) != (a1[0][5] == v2)));
+    }
+    if ((((a1[2][12] != 70) != (v1 - v0)) || ((v3 ? v0 : a0[10]) % 8))) {
+        v2 = (((44 <= 49) > (v0 / 3)) / 9);
+        v3 = (((v1 - v1) && (48 / 9)) ? ((v1 / 3) || (48 || 97)) : ((v3 - a0[1]) != (v0 == v1)));
+        v0 = (((a0[6] < v1) <= (v3 > 49)) >= ((a0[13] && v3) && (v3 + a0[14])));
+    } else {
+        v0 = (((v3 || 40) > (v1 % 5)) <= ((v0 <= 79) ? (v2 || v3) : (v0 ? v2 : 64)));
+        v1 = (((a0[2] < v0) ? (v1 % 7) : (v1 ? 5 : 94)) * ((55 + v2) >= (a1[0][4] || a0[5])));
+        v0 = (((v1 / 2) <= (a0[7] / 1)) ? ((v0 % 6) != (a0[3] ? 51 : v1)) : ((29 - a0[5]) <= (a1[2][4] > v2)));
+    }
+    a0[4] = (((v0 && 34) <= (17 == 11)) != ((v2 == 56) == (v1 % 3)));
+    v3 = (((v0 > a0[11]) < (v3 == 70)) + ((39 <= 71) ? (a1[1][2] && v1) : (6 <= v0)));
+    return (((v3 ? 34 : v0) <= (72 || 9)) == ((v2 && v0) >= (v0 * a0[10])));
+}
+int main() {
+    return 0;
+}
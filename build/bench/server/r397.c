@@ -0,0 +1,123 @@
+int f0() {
+    int v0 = 50;
+    int v1 = 9;
+    int v2 = 66;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        a0[9] = (((87 ? i0 : v2) < (1 != i0)) > ((10 && a0[2]) >= (v1 ? 61 : a0[7])));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((v3 >= v2) > (v3 <= v1)) / 2);
+                v3 = (((66 + v2) >= (v1 ? i0 : v1)) ? ((27 != a1[2][4]) != (v1 % 7)) : ((12 - a0[1]) && (57 == v3)));
+                v2 = (((24 + v3) >= (a1[2][11] <= v3)) <= ((8 % 8) % 5));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        v0 = (((v3 * a0[0]) != (v2 && 89)) == ((a0[15] > v3) / 2));
+    }
+    if ((((a0[11] <= 41) + (53 ? a0[11] : v2)) >= ((13 != v0) - (v1 / 5)))) {
+        a1[1][1] = (((89 >= v1) + (v0 || a1[2][12])) || ((v2 - 29) + (40 == v1)));
+        v1 = (((v1 || a1[3][11]) - (v3 < v0)) == ((v3 * v0) + (23 == v0)));
+        a0[8] = (((44 < v1) <= (a1[1][1] * 5)) % 7);
+    } else {
+        v1 = (((a1[2][11] / 7) / 1) && ((74 < a1[3][13]) >= (a0[6] / 6)));
+        a1[3][3] = (((v3 + 35) != (v1 != 87)) < ((v3 * v2) + (a1[1][9] || v1)));
+        a1[0][13] = (((61 && v0) < (v2 - v2)) < ((a1[0][8] > a0[14]) % 4));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a0[10] != 81) >= (v1 >= i2)) ? ((60 < 81) != (a0[0] <= 37)) : ((a0[7] || 71) <= (v2 > v2)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a0[5] = (((v1 && v2) == (v3 || i2)) != ((a0[6] % 2) ? (v1 || i2) : (a0[3] % 5)));
+                v1 = (((30 < a0[7]) + (a1[1][8] + i2)) >= ((v3 % 9) >= (i3 > 26)));
+                v1 = (((a0[9] > 84) % 7) > ((v0 <= v2) + (i2 ? v0 : a1[1][6])));
+            }
+            a0[1] = (((v3 % 2) < (a0[3] >= 9)) % 1);
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((i4 ? a1[2][6] : 93) > 79) break;
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v1 = (((i4 > i4) != (i4 - v2)) <= ((v1 > i5) ? (v0 + i4) : (v2 && 91)));
+                v0 = (((i5 && 30) < (v2 - i5)) ? ((61 && 46) / 1) : ((54 % 1) - (i4 ? v2 : i5)));
+                a1[0][2] = (((a0[15] % 3) % 6) ? ((a1[1][5] || v0) + (v0 ? v3 : i4)) : ((31 > 95) <= (v1 || a1[2][10])));
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((a0[5] < 41) > (v0 && v2)) * ((v2 / 2) != (v3 / 8)));
+        v3 = (((v0 ? a0[11] : i4) <= (i4 ? 49 : v0)) || ((19 >= a1[3][8]) < (20 / 3)));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v1 / 1) > 86) break;
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    if ((v1 && v3) > 83) break;
+                    a0[5] = (((i7 > v2) - (a0[4] ? a0[11] : v3)) != ((3 - v1) && (v1 == v1)));
+                    a1[3][6] = (((77 || v0) - (61 != v1)) * ((a0[1] > 11) / 2));
+                    v2 = (((27 == v0) && (72 || a1[2][13])) - ((i6 - v3) && (25 % 1)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((a0[5] % 2) ? (i6 / 2) : (a0[0] ? 94 : i6)) % 4);
+            v1 = (((v1 / 5) * (v1 && a0[4])) - ((22 * 66) == (a1[2][10] != a0[1])));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    return (((v3 && v0) * (a0[0] <= 72)) >= ((83 * a0[8]) && (33 == v2)));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 82;
+    int v2 = 65;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[7] = (((a0[12] && a1[1][10]) / 9) == ((v3 <= v1) * (a1[1][12] != i0)));
+            v3 = (((22 + v3) && (v0 < v0)) > ((v0 == a1[1][14]) != (v1 >= v1)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((i1 || a0[8]) > 89) break;
+                v0 = (((a0[10] >= 31) && (93 % 1)) >= ((i1 > 2) && (74 != v2)));
+                a1[2][12] = (((38 < 33) + (v1 + 59)) ? ((v3 && i0) ? (a0[15] == i0) : (v2 % 3)) : ((74 < a1[0][15]) - (v0 <= 66)));
+                v0 = (((a0[9] / 4) < (11 + v0)) != ((i0 <= 90) <= (a1[2][5] % 6)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((v2 / 2) % 5) / 9)) {
+        a0[10] = (((0 || 35) * (v1 && v0)) % 7);
+        v2 = (((45 - a0[3]) != (v0 % 5)) && ((v3 && a1[1][5]) % 7));
+        a0[5] = (((23 ? v1 : v1) <= (a1[0][14] > a1[2][11])) != ((v1 * v3) + (v3 <= a0[11])));
+    } else {
+        v1 = (((v3 || a1[2][8]) + (53 / 4)) % 5);
+        v3 = (((v1 < 38) % 5) <= ((v0 && v0) % 4));
+        v3 = (((v0 && v3) && (59 >= v3)) - ((v1 == 68) < (a1[3][1] > v2)));
+    }
+    if ((((v0 ? 26 : 53) < (v2 <= a0[0])) - ((v0 % 1) || (v0 - v3)))) {
+        v2 = (((74 <= a1[1][14]) != (a1[1][8] ? a0[6] : 41)) < ((71 && a1[0][5]) / 5));
+        a0[3] = (((a1[3][9] ? v1 : v0) == (8 < v1)) > ((v1 / 4) > (a1[0][10] != v0)));
+        v2 = (((a0[8] != a1[3][0]) / 5) || ((47 == 76) > (v0 >= a0[11])));
+    } else {
+        a0[4] = (((v3 - a0[7]) - (19 >= v1)) && ((v2 != a1[0][6]) + (v3 ? v0 : v0)));
+        a1[2][0] = (((95 && 68) <= (v0 - v2)) - ((v1 / 4) ? (a1[0][7] && 77) : (a1[2][13] && v3)));
+        v1 = (((v1 != v0) ? (v0 >= v1) : (v0 == v2)) < ((33 <= v2) ? (a0[2] * a0[0]) : (v2 * v3)));
+    }
+    a0[9] = (((42 != 94) || (v3 ? v1 : v1)) / 6);
+    v2 = (((17 != 72) || (v1 || 11)) || ((v0 == v1) % 3));
+    return (((v3 / 9) % 4) >= ((72 != v0) || (a1[2][13] ? v2 : 77)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,164 @@
+int f0() {
+    int v0 = 58;
+    int v1 = 79;
+    int v2 = 30;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v0 >= a1[2][14]) ? (a1[1][9] <= a1[3][8]) : (33 > v1)) >= ((72 + v1) - (v3 < a1[1][13])));
+    v1 = (((a0[8] < a1[0][0]) || (31 && v3)) || ((a1[2][15] && 12) > (a1[3][11] - v1)));
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((a0[6] / 7) > 91) break;
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a0[7] = (((v1 >= a1[0][11]) || (v0 - 45)) - ((v3 ? v1 : v0) + (v0 != 1)));
+                    v0 = (((v2 * a0[9]) < (13 < v2)) < ((i1 ? a0[13] : a1[1][4]) && (a1[2][2] + a1[2][8])));
+                    v2 = (((51 + 25) ? (17 + a1[3][13]) : (i1 % 7)) != ((i1 <= 52) < (a0[14] != i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[0] = (((a0[3] <= 94) <= (a1[3][1] ? v3 : v2)) ? ((v0 / 2) == (v2 || a1[1][10])) : ((v0 == v0) + (v3 / 2)));
+            v3 = (((52 % 3) ? (a1[1][12] > 72) : (3 && v0)) ? ((97 < a0[1]) < (v2 || 89)) : ((v1 ? 10 : v3) * (v2 != a0[11])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 <= 1) != (a0[1] && 18)) ? ((a1[2][4] != 55) < (47 ? v3 : a1[3][15])) : ((a0[9] != a1[1][3]) && (v3 * v2)))) {
+        v3 = (((a0[1] + v1) >= (v2 - v1)) != ((35 && a0[2]) % 8));
+        v1 = (((v2 < v0) / 2) + ((a1[1][0] / 9) <= (v2 != 70)));
+        a0[0] = (((v2 - 24) >= (v2 % 1)) > ((60 >= v3) <= (93 != v1)));
+    } else {
+        v2 = (((57 > a1[0][6]) * (v1 >= v1)) || ((v0 != 13) < (v0 / 6)));
+        a1[3][5] = (((v0 < 25) - (v1 - v3)) > ((45 % 5) + (a0[10] != v0)));
+        v2 = (((v3 || v1) || (v1 < v2)) * ((v1 <= 7) <= (20 > a0[12])));
+    }
+    v2 = (((v0 != 64) ? (a0[6] ? a1[3][9] : 49) : (v0 / 1)) ? ((v2 < v2) < (17 == a1[1][6])) : ((v3 % 6) ? (a1[3][12] * v1) : (a0[11] < v1)));
+    return (((v3 >= a1[3][7]) && (v2 >= v2)) * ((v1 > v3) != (v1 >= 60)));
+}
+int f1() {
+    int v0 = 27;
+    int v1 = 94;
+    int v2 = 69;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[5] && a0[10]) >= (v0 == v0)) == ((12 <= 39) / 8))) {
+        v2 = (((v2 > v3) <= (41 || v1)) >= ((a1[2][10] >= 85) >= (v0 || v0)));
+        v2 = (((a0[8] / 9) % 5) < ((v3 == v2) == (v3 || 50)));
+        v0 = (((a1[0][15] ? a0[5] : v2) <= (23 + v0)) ? ((a0[10] || v3) <= (a0[9] > 52)) : ((77 / 4) && (21 == v3)));
+    } else {
+        v2 = (((62 && 54) / 7) == ((v0 < a1[0][1]) != (a0[10] + 6)));
+        v1 = (((v1 > 70) - (19 <= 25)) < ((v0 >= v3) + (v1 == 79)));
+        a0[11] = (((v2 && a0[13]) >= (v2 >= v1)) % 9);
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((10 % 6) > 86) break;
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((i1 ? 87 : a1[2][2]) != (i0 != a0[6])) ? ((a0[2] ? i1 : a0[11]) < (v0 && v1)) : ((96 == a0[14]) || (v1 < 16)));
+                    v3 = (((a1[3][2] ? a1[2][3] : v0) && (26 == 85)) >= ((i1 || v1) * (22 != 85)));
+                    v2 = (((v1 <= a0[6]) - (a1[3][14] - 39)) <= ((6 > i1) % 1));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v2 = (((v1 - 97) - (32 % 7)) % 7);
+            v2 = (((v2 >= 99) > (9 ? a0[11] : v2)) ? ((a1[0][9] >= 71) + (v2 <= i0)) : ((v1 || 33) >= (v0 ? v0 : 40)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a0[3] = (((v3 && 42) % 3) != ((34 - v0) - (a0[1] * v2)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            if ((79 ? a0[2] : 2) > 70) break;
+            a1[1][11] = (((v2 != 3) - (i2 / 2)) / 7);
+            v0 = (((v1 ? 33 : v0) > (a0[10] > a1[1][7])) > ((i3 >= 35) < (a0[6] <= a0[7])));
+            a0[8] = (((a1[1][9] != v1) % 1) ? ((v0 + v3) >= (v2 / 8)) : ((97 ? v1 : a1[1][0]) <= (v0 - v0)));
+        }
+        v3 = (((a1[3][14] || a0[15]) + (a1[1][10] - i2)) || ((a0[0] ? 16 : 88) == (39 && i2)));
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v2 = (((a1[3][14] || 11) - (67 + a1[3][0])) ? ((v0 == a1[2][12]) * (a0[1] <= v0)) : ((89 != 74) % 4));
+        {
+            int i5 = 0;
+            while (i5 < 8) {
+                if ((a0[2] + i4) > 60) break;
+                v3 = (((i4 / 8) && (v2 > 31)) % 9);
+                a0[3] = (((a0[12] + 5) >= (a0[0] ? a1[1][13] : v1)) != ((v3 * v3) / 7));
+                v2 = (((i4 == 75) - (20 - a0[14])) > ((a1[2][15] % 5) != (v0 * a1[3][5])));
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((a1[2][2] == i4) > (a0[12] <= v3)) ? ((i4 <= v2) <= (82 > v3)) : ((a0[1] - a1[2][14]) % 1));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((14 <= v3) > 63) break;
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                if ((24 >= a0[3]) > 98) break;
+                a0[15] = (((a0[2] + v2) >= (42 < i6)) != ((a0[6] + v3) || (a1[1][9] % 8)));
+                a1[2][4] = (((67 <= v1) >= (v3 * v0)) + ((a0[14] ? i6 : 33) % 3));
+                a1[0][14] = (((v2 < v1) != (a1[1][11] == a1[2][15])) - ((v1 ? 66 : v2) ? (v1 + i6) : (a0[3] ? 66 : v2)));
+            }
+            v3 = (((i6 > v1) ? (v1 ? i6 : 83) : (v3 >= v2)) < ((12 + v1) ? (75 >= i6) : (v3 / 6)));
+            a1[3][15] = (((39 && v3) && (63 % 8)) ? ((26 && 21) > (90 > v1)) : ((v2 + v0) ? (v2 + v0) : (a1[3][1] < 4)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    return (((a0[4] && v2) / 3) + ((v2 < a1[0][6]) % 3));
+}
+int f2() {
+    int v0 = 24;
+    int v1 = 52;
+    int v2 = 21;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                a1[1][9] = (((51 || v1) - (v2 && v2)) != ((a1[3][12] == 95) * (a1[0][12] < v1)));
+                a1[2][9] = (((a1[0][14] == i1) >= (50 > 98)) == ((a1[3][4] - a1[0][10]) / 1));
+                a1[2][7] = (((a0[2] ? v2 : 17) % 9) % 9);
+            }
+            v2 = (((v1 <= a0[10]) < (v3 % 1)) ? ((v2 && a1[3][12]) ? (a0[7] <= 27) : (82 || v2)) : ((6 / 1) <= (v0 ? 30 : v3)));
+            v3 = (((a0[5] || i0) * (a0[8] % 5)) == ((v0 < a0[1]) < (i0 == v1)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[0][2] = (((v1 >= 2) - (i2 % 9)) ? ((a0[4] > a0[6]) > (a1[3][3] >= v3)) : ((v2 * 43) + (v3 != v2)));
+            v0 = (((i2 || v0) % 6) ? ((v3 || v3) && (v1 > i2)) : ((v1 - 1) * (69 ? a1[1][3] : a0[2])));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                if ((0 - a0[5]) > 96) break;
+                a0[1] = (((i3 < v2) || (90 / 4)) ? ((v2 ? 42 : a1[2][6]) != (i2 <= v1)) : ((v1 <= i2) >= (a1[0][10] < a1[0][0])));
+                v1 = (((a1[3][15] ? i3 : 71) * (a0[15] || 42)) || ((8 || v0) || (32 && 20)));
+                v2 = (((v3 ? i2 : a1[0][6]) <= (i2 || i2)) > ((61 % 8) / 5));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v2 = (((a0[2] + a1[3][1]) <= (v0 > v1)) % 6);
+    v1 = (((85 >= a1[2][7]) || (a0[7] % 4)) ? ((a0[12] * a1[0][10]) <= (98 % 7)) : ((a1[3][14] || 97) / 5));
+    if ((((a0[4] < 37) % 7) % 2)) {
+        v0 = (((v0 < v2) * (62 && a1[1][12])) % 5);
+        v3 = (((a1[0][2] <= 56) % 6) / 5);
+        v1 = (((a0[10] <= 15) || (v2 && v3)) >= ((a1[0][5] && a1[3][7]) < (34 * a0[1])));
+    } else {
+        v2 = (((87 < a1[2][13]) - (a0[15] / 3)) * ((v0 ? 25 : a1[0][12]) == (a1[3][12] + 21)));
+        a0[8] = (((v1 - v3) || (11 ? 35 : a1[0][9])) + ((60 == v3) % 6));
+        a1[3][14] = (((65 + v1) ? (v3 % 7) : (v3 ? v2 : 36)) > ((a1[1][6] && 36) ? (a0[1] == a0[9]) : (a0[13] + a0[15])));
+    }
+    return (((a1[2][2] || a0[0]) == (v0 >= v3)) || ((v2 && v1) ? (v1 != v0) : (a0[10] >= v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,85 @@
+int f0() {
+    int v0 = 96;
+    int v1 = 51;
+    int v2 = 62;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v2 >= v2) >= (a1[2][7] > v0)) > ((i0 && a1[1][1]) == (v3 >= v2)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a0[0] = (((i1 / 4) - (18 + a0[4])) < ((90 % 2) == (v1 == a1[3][4])));
+                v3 = (((i0 ? v0 : 69) % 1) - ((46 < a0[6]) >= (i1 * 52)));
+                v1 = (((a0[10] != v2) <= (10 % 7)) * ((v2 ? a1[2][14] : v0) ? (a1[0][4] ? i1 : v0) : (a1[0][11] <= v1)));
+            }
+            v3 = (((a1[3][3] % 9) + (a0[4] ? 67 : v1)) < ((v0 != 80) + (14 == v3)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((a1[1][11] ? v3 : v3) <= (76 + v1)) * ((a1[3][5] < v1) * (v2 == a1[1][6])))) {
+        v0 = (((a0[13] / 6) || (a0[4] >= v0)) ? ((v0 ? v0 : a0[6]) * (v1 ? a1[1][0] : 10)) : ((v1 + v3) ? (v2 || v3) : (v3 >= a1[1][13])));
+        v0 = (((v0 && v0) * (v2 % 4)) <= ((80 - v1) != (a1[3][2] / 6)));
+        v3 = (((v3 ? v1 : a1[0][9]) / 1) >= ((67 / 7) > (v2 == v1)));
+    } else {
+        a1[0][11] = (((v2 >= a0[9]) ? (97 - v0) : (v1 - v0)) && ((a1[2][0] <= 94) != (v3 ? 79 : 77)));
+        v3 = (((a0[15] != v0) / 1) > ((v1 > 11) && (a1[1][8] + 6)));
+        v3 = (((a0[9] / 4) ? (v2 && v1) : (a0[14] || a1[0][3])) < ((a1[3][12] ? v1 : 9) > (78 == a1[1][11])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v0 - a0[12]) > 69) break;
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((a0[3] >= 8) > 58) break;
+                    v3 = (((v3 > v2) < (14 && 0)) >= ((94 < i2) > (v2 != i2)));
+                    v2 = (((i2 + 93) < (13 - 66)) == ((v3 + v2) || (a0[12] - a0[3])));
+                    v3 = (((v1 < i3) - (a0[6] || 48)) >= ((v3 % 4) * (v1 == 86)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((v0 + v2) + (v3 >= v3)) * ((34 ? i2 : 51) * (98 <= v1)));
+            a0[14] = (((13 % 5) + (83 * i2)) % 9);
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[1][8] = (((a0[15] / 7) + (v1 || 70)) == ((v2 ? 0 : v1) == (a1[2][11] || a0[1])));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                if ((a0[6] - a1[3][0]) > 88) break;
+                v2 = (((16 / 7) + (a1[3][5] <= a1[3][8])) || ((v0 ? i4 : v2) % 6));
+                v2 = (((i4 < v0) <= (v2 <= a0[1])) % 2);
+                a1[2][2] = (((80 <= a0[4]) % 2) || ((30 - v1) ? (v0 + v3) : (v1 ? 63 : i5)));
+            }
+            a1[3][14] = (((89 / 2) < (v0 && a0[10])) && ((v0 ? i4 : 60) < (v2 / 6)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[5] = (((60 + v0) != (v2 <= v2)) ? ((v0 - a0[11]) != (58 ? i6 : v1)) : ((a0[4] < v3) - (i6 + 5)));
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    if ((v3 <= 37) > 75) break;
+                    a1[2][8] = (((v1 && i7) + (v3 <= a1[0][8])) > ((v2 + v3) - (a0[14] >= a1[3][1])));
+                    v3 = (((i7 + a0[4]) >= (v2 > a0[3])) + ((a1[2][1] || 22) / 2));
+                    v3 = (((i7 - a1[2][14]) + (a1[2][14] >= 53)) || ((67 < 52) != (i6 % 3)));
+                    i7 = i7 + 1;
+                }
+            }
+            v1 = (((v1 ? i6 : 35) > (v1 || a1[2][11])) / 1);
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    return (((v2 && a1[2][6]) || (70 >= v0)) < ((v0 / 8) <= (v1 - a0[10])));
+}
+int main() {
+    return 0;
+}
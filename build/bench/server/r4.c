@@ -0,0 +1,125 @@
+int f0() {
+    int v0 = 11;
+    int v1 = 14;
+    int v2 = 67;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 + 17) ? (v1 ? v0 : v0) : (4 <= v3)) <= ((v0 || a0[14]) < (v1 != v1)))) {
+        a1[3][11] = (((v3 * a1[3][4]) ? (a1[3][15] && 14) : (a0[0] - 42)) != ((v3 % 7) % 7));
+        v0 = (((a1[3][0] - v2) && (v3 == a0[13])) != ((11 == v3) ? (49 <= v2) : (v3 && v0)));
+        v3 = (((45 > v3) * (79 == 54)) ? ((v3 ? 11 : 89) || (a1[0][0] != a0[11])) : ((v1 || v1) == (41 - 35)));
+    } else {
+        v0 = (((v2 ? v0 : v3) == (v2 >= v1)) % 5);
+        v2 = (((8 == 98) && (12 || v1)) - ((v0 * v2) == (a1[3][15] == v2)));
+        v1 = (((a1[1][12] * v2) ? (71 <= v0) : (v3 ? 44 : a1[1][9])) / 3);
+    }
+    if ((((v0 >= 89) || (v2 != v1)) == ((67 * v1) / 5))) {
+        a1[3][0] = (((v1 / 5) <= (v0 * a1[2][9])) >= ((v0 == v3) * (v2 - a0[2])));
+        a0[0] = (((a0[11] && a0[11]) % 2) <= ((v1 < v2) == (v0 <= a0[4])));
+        a1[1][14] = (((v1 * 27) + (a0[3] >= 32)) / 7);
+    } else {
+        v2 = (((v2 > v0) * (v3 > a1[3][9])) > ((99 && a1[0][0]) && (v1 <= v2)));
+        a0[3] = (((v3 ? v2 : v2) >= (a1[0][2] < 18)) >= ((89 < a1[0][6]) <= (a1[3][8] < a0[3])));
+        v3 = (((v0 ? v3 : v0) / 7) || ((v1 % 3) || (v3 >= a1[1][0])));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((34 + a1[2][7]) > 90) break;
+        v3 = (((v2 != i0) || (79 >= v3)) - ((i0 == v0) / 1));
+        {
+            int i1 = 0;
+            do {
+                v3 = (((a0[15] + 78) % 9) * ((v1 && v3) >= (a0[1] * v2)));
+                v1 = (((v1 && i0) == (v3 != a1[1][8])) - ((a0[13] == 14) >= (84 == a1[1][1])));
+                a1[2][2] = (((i1 && 3) || (a0[8] || 19)) * ((a0[11] != a0[15]) > (i1 ? a1[2][6] : v0)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        a0[5] = (((v2 < v1) && (v1 != v3)) > ((a0[0] && v3) - (a1[1][10] % 9)));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((a0[12] >= v3) > 80) break;
+        a1[3][8] = (((i2 ? a1[2][5] : 53) != (v0 != v0)) != ((v1 / 7) < (v0 ? v0 : 83)));
+        v0 = (((v0 ? v1 : a0[0]) - (a1[3][7] > v3)) == ((i2 - v3) - (v3 + 68)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v3 = (((3 * v1) - (a0[8] || i2)) < ((v1 == v2) >= (v0 || i3)));
+                a1[1][2] = (((v0 || i2) % 5) / 8);
+                v1 = (((53 && v3) > (v1 ? a1[2][14] : 38)) == ((v3 >= v1) * (v2 == 14)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((a0[13] >= a0[13]) % 2) - ((v3 == v2) <= (a0[1] ? 25 : v2)))) {
+        a0[1] = (((a0[14] > 0) || (93 == a0[3])) < ((26 && 65) || (v1 % 4)));
+        a1[0][12] = (((84 - 58) ? (v3 + v0) : (67 * v1)) - ((12 - v1) - (a0[14] / 2)));
+        v1 = (((v2 ? a0[0] : 54) != (57 / 2)) ? ((a0[1] < v1) % 1) : ((38 % 6) + (99 ? v2 : v1)));
+    } else {
+        a0[13] = (((41 > v0) > (v1 < 80)) ? ((v2 <= v2) % 3) : ((11 / 1) || (72 - a0[14])));
+        a0[0] = (((v2 && a1[2][14]) >= (27 - a1[0][11])) ? ((v0 && v1) != (v2 < v1)) : ((20 * 5) && (v3 ? 51 : 66)));
+        v0 = (((a1[2][13] > 84) ? (v3 < v2) : (v1 > v1)) ? ((v0 / 5) < (v0 > v3)) : ((v3 || a1[2][7]) < (a0[11] <= 55)));
+    }
+    return (((a1[3][5] + v3) + (a0[11] <= a0[4])) || ((v1 >= v2) ? (a1[0][14] / 7) : (v1 != v1)));
+}
+int f1() {
+    int v0 = 55;
+    int v1 = 92;
+    int v2 = 49;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[5] % 6) != (v2 ? v3 : v3)) == ((v2 % 1) - (a0[5] + 10)));
+    if ((((a0[7] + v3) || (28 >= 32)) < ((47 / 4) && (v3 && 10)))) {
+        v2 = (((41 != v1) == (a1[2][11] && a1[2][5])) >= ((a0[1] && v0) == (v3 && 95)));
+        a0[8] = (((a0[13] * 3) + (87 ? a0[2] : v1)) ? ((53 > v0) % 4) : ((v2 >= v0) % 2));
+        v3 = (((v3 <= 46) - (v0 - 21)) > ((v1 ? a0[13] : 30) == (40 != v3)));
+    } else {
+        v0 = (((a1[2][12] % 8) < (29 + 37)) % 6);
+        v1 = (((v3 <= 54) != (v2 > v2)) ? ((a1[3][8] * v0) + (v2 - v3)) : ((a0[2] - v0) == (v0 == 75)));
+        v0 = (((v0 - 63) % 4) + ((v2 > a1[2][2]) > (54 != a0[1])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((13 || a0[6]) > 86) break;
+            {
+                int i1 = 0;
+                do {
+                    a1[3][15] = (((v1 > a0[8]) < (v0 + 88)) > ((a1[0][10] <= v2) % 6));
+                    v0 = (((a1[3][10] - v2) != (a0[14] || i1)) || ((a0[10] || a0[14]) || (a1[1][4] > v3)));
+                    v3 = (((a1[1][15] ? v3 : i0) - (a1[3][4] > 81)) + ((31 != 14) % 1));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            a1[0][10] = (((a1[0][9] != a1[1][8]) == (v0 ? a1[1][6] : v3)) == ((v0 != v1) >= (a1[1][9] % 1)));
+            a1[2][5] = (((v0 ? i0 : a1[3][1]) / 5) != ((a0[0] < v2) > (v2 * v2)));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v3 || 71) || (v2 % 6)) >= ((a1[1][4] ? 0 : v0) != (97 + v1)));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    a0[0] = (((v1 * 42) + (15 % 9)) ? ((a1[0][14] == a1[2][6]) ? (v0 == i3) : (i2 - v1)) : ((i2 > v1) ? (v3 ? a1[1][6] : 61) : (i3 > a1[0][3])));
+                    v2 = (((a0[14] == v0) >= (a0[12] * 19)) % 7);
+                    a1[1][13] = (((a0[3] > a1[2][6]) ? (87 < i2) : (v1 > 77)) + ((v2 % 7) && (v3 < a1[3][14])));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[5] = (((v1 % 5) * (52 + v1)) ? ((23 < i2) + (26 <= a1[3][15])) : ((v0 && a1[3][1]) <= (v2 + v2)));
+            v0 = (((v2 + v3) * (v0 <= i2)) / 7);
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    return (((v2 % 7) - (v3 < v2)) % 8);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
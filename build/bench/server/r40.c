@@ -0,0 +1,159 @@
+int f0() {
+    int v0 = 36;
+    int v1 = 3;
+    int v2 = 44;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((23 - i0) == (v2 / 3)) - ((a1[2][15] / 3) ? (v3 != 9) : (0 >= v0)));
+            a1[1][14] = (((v3 == a0[5]) - (66 >= v0)) * ((v0 < v1) < (v3 - a0[14])));
+            {
+                int i1 = 0;
+                do {
+                    a1[3][8] = (((v2 < 95) + (a0[13] + v2)) % 8);
+                    v1 = (((v2 - a1[2][2]) + (a0[8] >= v3)) < ((v0 ? a1[1][10] : 89) % 3));
+                    v3 = (((a1[2][14] || i0) ? (v1 || i0) : (a0[7] == i1)) / 1);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v0 = (((a1[1][4] ? v1 : v0) ? (v1 != v0) : (v2 > 75)) || ((60 > 81) / 5));
+                v1 = (((v1 == a1[1][7]) >= (i2 && v3)) > ((i3 <= a1[2][2]) * (v3 != a0[9])));
+                a1[0][7] = (((v2 <= i2) || (60 <= 79)) && ((24 == a1[2][6]) / 3));
+            }
+            a0[5] = (((27 % 7) + (a1[3][10] <= a1[0][14])) * ((40 / 4) > (v0 <= v0)));
+            a0[14] = (((v1 <= 80) - (22 >= 66)) != ((84 + 59) + (a0[3] && 34)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    a0[2] = (((3 || v3) * (69 - 96)) > ((v2 ? v3 : a0[9]) + (a1[1][15] >= 72)));
+    {
+        int i4 = 0;
+        do {
+            v0 = (((51 + a0[14]) - (v2 < a0[8])) ? ((v1 % 8) ? (v2 % 2) : (i4 ? v1 : v2)) : ((v1 && a0[13]) >= (a0[1] <= 53)));
+            v0 = (((91 ? 91 : v3) < (a1[3][10] / 6)) + ((a1[3][11] / 8) ? (v3 <= v3) : (v1 && a0[3])));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    v3 = (((v0 + v3) == (i4 / 4)) == ((v0 == v3) + (20 + i4)));
+                    a0[7] = (((i5 ? i5 : v3) < (93 * 57)) % 7);
+                    v2 = (((v3 <= a0[9]) || (a0[5] * i4)) * ((53 != v1) && (a0[8] % 3)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            v2 = (((85 ? v3 : 26) != (v1 && a1[2][11])) == ((77 ? v1 : a1[2][13]) - (v1 && v0)));
+            v1 = (((a0[1] == 39) || (i6 % 9)) % 2);
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v2 = (((a1[2][0] / 2) > (i6 && i7)) == ((v2 + 34) && (v0 == v1)));
+                v2 = (((v2 >= 16) == (v3 * a1[2][9])) > ((i6 > v0) > (v3 ? v2 : v0)));
+                v2 = (((17 || a0[14]) >= (34 && 27)) ? ((v3 && v2) ? (i7 % 8) : (i7 / 8)) : ((a1[3][2] ? a1[1][1] : a1[1][5]) % 7));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((25 ? v3 : v3) * (a0[0] * v3)) % 8);
+}
+int f1() {
+    int v0 = 46;
+    int v1 = 16;
+    int v2 = 79;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v2 = (((a1[1][6] < i0) % 2) || ((1 / 2) / 6));
+                    v0 = (((i1 < a1[0][7]) * (v3 * 66)) ? ((78 <= 50) || (70 % 7)) : ((i1 <= v3) != (v2 % 8)));
+                    a0[7] = (((i0 % 5) / 1) || ((76 <= v3) || (a1[1][3] ? a1[2][3] : v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v3 / 6) ? (v1 >= a0[3]) : (45 * 77)) != ((86 - v0) == (v3 + v2)));
+            a0[14] = (((a1[2][7] ? v0 : a1[1][10]) && (a1[0][8] % 4)) > ((v2 ? 21 : v0) / 3));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[0][3] || v0) > 71) break;
+                    v2 = (((a1[1][9] >= v0) + (i3 <= a0[9])) / 4);
+                    v1 = (((54 >= v1) ? (a0[7] % 2) : (65 * a0[1])) ? ((v2 <= v1) > (i2 * v3)) : ((a1[1][7] % 1) % 7));
+                    a0[8] = (((a0[2] / 9) && (a1[3][8] >= 51)) > ((v1 ? 47 : 30) ? (v3 % 7) : (a1[1][10] != v0)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a0[13] = (((v3 > v1) && (a1[1][3] > v0)) && ((v3 * v3) % 4));
+            v0 = (((a0[4] * a0[6]) >= (a0[6] >= v2)) / 9);
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((v1 == v2) || (v0 && v3)) / 1)) {
+        a1[2][13] = (((v2 ? a1[2][1] : 69) || (69 == a1[1][11])) ? ((a0[15] != v0) + (v3 ? a1[1][1] : a1[1][3])) : ((v1 >= a1[0][0]) <= (v2 == v1)));
+        v3 = (((v3 > v0) + (26 % 7)) % 3);
+        a1[3][4] = (((a0[6] && v1) != (v0 + v3)) % 2);
+    } else {
+        a0[3] = (((v0 >= a1[2][4]) && (v2 != v0)) == ((a1[1][4] + 69) >= (v2 ? v0 : a0[3])));
+        a0[10] = (((a1[0][15] == 49) == (v2 >= v0)) < ((v2 || v3) && (a1[3][4] * a0[8])));
+        v1 = (((a1[2][14] >= a0[12]) == (v2 == v1)) <= ((a0[4] < 87) % 3));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v2 = (((a0[1] + v3) ? (v0 ? i4 : v2) : (i4 >= 75)) - ((a0[5] >= v3) == (68 - a0[6])));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v0 = (((v3 <= 20) * (96 + v2)) == ((v2 >= v1) == (v3 + v3)));
+                v0 = (((v0 <= 74) || (i5 >= i5)) && ((a1[1][0] == i5) < (a1[3][5] - i5)));
+                a0[2] = (((85 != 86) * (a0[2] != v0)) ? ((a0[9] * v0) + (v3 < i4)) : ((v0 > 18) || (a0[7] + 21)));
+            }
+            v3 = (((v1 * v0) + (i4 < a0[8])) + ((23 <= v1) ? (20 - 2) : (a1[3][12] == v3)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            {
+                int i7 = 0;
+                do {
+                    a1[3][5] = (((i6 || a1[2][10]) == (i7 + i7)) > ((v2 * v3) % 4));
+                    v0 = (((i7 <= 65) != (a0[0] / 6)) <= ((a1[0][5] > v0) ? (v1 == v3) : (12 <= a1[2][5])));
+                    a1[0][6] = (((v3 != a0[7]) <= (v1 / 3)) + ((a0[3] ? v0 : i7) - (a0[8] != 96)));
+                    i7 = i7 + 1;
+                } while (i7 < 5);
+            }
+            a0[13] = (((v3 * v3) * (a0[3] + v3)) % 4);
+            v3 = (((a0[8] >= a0[0]) ? (a1[1][2] * v2) : (41 - i6)) * ((72 / 8) >= (30 >= i6)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((a0[9] ? v3 : v3) >= (a0[8] ? a1[2][0] : v3)) || ((v2 % 9) / 2));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,105 @@
+int f0() {
+    int v0 = 84;
+    int v1 = 56;
+    int v2 = 91;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a0[8] - 91) < (v0 - v2)) ? ((61 ? a1[0][4] : a0[1]) * (63 != 38)) : ((v1 <= 60) < (a1[3][7] == v2)));
+    v3 = (((a1[2][11] > v3) <= (v1 && a0[15])) % 7);
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a1[1][7] = (((i0 == v2) < (i1 - i1)) == ((v1 >= i1) + (a1[0][5] < 10)));
+                    a1[1][0] = (((v1 != a0[10]) >= (a0[8] == a0[9])) || ((v0 - i1) && (v0 * v2)));
+                    v1 = (((a1[2][9] * a1[3][7]) <= (v0 && v0)) % 9);
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a0[9] > 86) <= (v2 == v0)) + ((v1 != a0[2]) > (v0 != i0)));
+            v1 = (((44 || a0[5]) ? (v0 || v1) : (v1 > 92)) == ((a0[11] - v1) && (i0 >= a0[3])));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((v2 ? 92 : a0[3]) > 91) break;
+                    v1 = (((a0[9] % 5) || (a0[12] && 53)) >= ((a0[7] && a0[8]) ? (v0 ? i3 : a1[3][3]) : (27 <= 4)));
+                    v3 = (((82 <= v2) < (40 || a0[4])) % 7);
+                    v2 = (((65 >= a1[3][2]) >= (i3 || 74)) < ((48 - a0[1]) - (82 >= v1)));
+                    i3 = i3 + 1;
+                }
+            }
+            v3 = (((a1[0][12] * a0[5]) ? (a0[9] == v3) : (94 + v3)) > ((i2 % 3) == (a0[10] - a0[1])));
+            v0 = (((a0[3] ? 67 : v0) > (v0 <= v1)) * ((20 <= v3) < (a1[1][3] * v1)));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((76 >= 38) >= (a1[0][4] < v0)) > ((30 || a1[1][12]) ? (v2 >= v0) : (a1[0][4] >= 71)));
+    return (((v2 || v1) <= (v2 != 70)) || ((v2 || a0[8]) + (v2 / 1)));
+}
+int f1() {
+    int v0 = 45;
+    int v1 = 76;
+    int v2 = 23;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v1 = (((91 % 5) || (32 ? v2 : 41)) ? ((v2 == v1) ? (a1[1][0] > 39) : (v2 / 7)) : ((a1[2][10] - i0) >= (a0[6] ? 36 : 31)));
+            v2 = (((56 && v3) && (62 % 9)) ? ((v3 > a0[7]) < (a0[3] < 20)) : ((v3 < i0) && (83 > 17)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((v2 != 5) < (a1[0][5] % 8)) <= ((i1 / 7) > (v3 ? i1 : v1)));
+                a0[3] = (((i1 <= v0) && (28 < 28)) != ((i1 >= v3) <= (a1[3][14] ? i1 : 25)));
+                a1[2][12] = (((25 <= i1) == (70 || 36)) > ((i0 || a1[3][12]) <= (v3 ? a1[3][2] : v3)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a0[11] = (((a0[15] || a1[2][1]) ? (v1 + v1) : (35 == v1)) % 3);
+                    v2 = (((v0 || i3) + (i3 >= 54)) % 5);
+                    v0 = (((a0[11] ? v0 : 94) && (35 <= v0)) * ((a0[6] * v3) && (80 ? i2 : a1[2][6])));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[12] = (((v2 <= v0) < (i2 == a1[2][11])) > ((a0[9] && 23) && (a0[11] == v2)));
+            a1[1][15] = (((a0[13] / 1) ? (v0 < v3) : (v0 != a1[3][8])) >= ((v0 != 76) - (26 >= 76)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((76 || i4) > 71) break;
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a0[12] = (((29 != v0) && (v0 <= a1[0][4])) || ((v3 || v0) && (v1 / 8)));
+                a1[3][11] = (((v1 < 83) ? (a1[1][7] || 76) : (v3 == 49)) / 2);
+                v0 = (((v2 - i4) * (v0 - a1[3][3])) % 3);
+            }
+            a0[5] = (((v3 / 9) / 6) % 3);
+            a1[1][2] = (((v1 == v0) - (27 == 32)) == ((v1 ? a0[10] : v1) % 2));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    v0 = (((v3 ? 85 : 12) >= (v1 - 23)) != ((16 / 6) <= (v0 == v3)));
+    a1[2][1] = (((v3 ? v0 : v0) < (42 + v0)) + ((a1[2][1] ? a0[15] : 88) + (a0[1] * 20)));
+    return (((v1 || 52) + (v2 || 19)) <= ((a1[0][13] ? v0 : a1[1][3]) ? (38 < a0[0]) : (v1 * a0[10])));
+}
+int main() {
+    return 0;
+}
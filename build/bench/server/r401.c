@@ -0,0 +1,192 @@
+int f0() {
+    int v0 = 77;
+    int v1 = 6;
+    int v2 = 98;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 % 1) < (v3 % 7)) == ((v2 / 2) >= (v3 <= 73)))) {
+        a0[6] = (((v0 >= a1[0][5]) && (94 > v3)) && ((v0 * v3) == (v0 * a0[4])));
+        v3 = (((v1 <= a1[1][11]) != (44 <= v1)) / 3);
+        v3 = (((v1 && v3) * (21 * v1)) != ((v0 && 79) * (a0[5] * v1)));
+    } else {
+        v1 = (((v2 != v2) <= (v2 + v3)) == ((v2 < 50) ? (v3 && v0) : (v0 || a1[0][13])));
+        v0 = (((v0 > v3) <= (a0[13] % 6)) > ((v0 + 82) < (a0[12] + a1[2][9])));
+        a0[9] = (((v3 + v1) && (a1[2][11] / 9)) == ((31 + v1) % 7));
+    }
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v2 = (((42 % 7) < (i1 >= 63)) <= ((a0[15] % 1) + (v2 ? 35 : v2)));
+                a1[0][0] = (((v0 > 2) || (v0 >= v3)) || ((25 ? a0[1] : v2) - (i1 || v0)));
+                v3 = (((a1[1][11] <= a0[0]) <= (45 <= 72)) > ((i1 || v2) != (62 * i1)));
+            }
+            v0 = (((a0[14] >= v1) || (a0[0] > v3)) ? ((v0 + v0) - (a0[0] < v3)) : ((41 ? 66 : v3) - (v2 * v2)));
+            v3 = (((v0 % 6) <= (88 <= v3)) <= ((a0[3] % 8) != (a0[11] / 6)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a0[15] != i2) - (v2 * v2)) / 5);
+            v0 = (((v1 > 53) ? (i2 + v0) : (i2 % 1)) % 6);
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((v1 ? 91 : 13) ? (25 >= v1) : (v1 <= v0)) < ((v2 < i3) ? (42 / 6) : (v0 >= a0[4])));
+                    a0[4] = (((v3 < v3) ? (i2 < i2) : (a1[0][4] || i2)) || ((3 / 5) % 9));
+                    v1 = (((i2 <= v3) < (i3 && v3)) ? ((40 != 26) || (i2 + v0)) : ((a0[7] == a0[3]) && (v3 && i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v2 = (((36 % 9) && (26 == v2)) ? ((a0[1] ? a1[1][0] : v1) * (a1[1][7] ? 63 : 99)) : ((v3 <= 69) && (i4 ? 63 : a0[9])));
+            a0[4] = (((v2 < v2) % 4) + ((a0[11] ? v1 : v3) == (i4 ? v0 : a1[1][0])));
+            {
+                int i5 = 0;
+                do {
+                    a0[12] = (((80 ? i5 : 73) + (v1 || v1)) / 5);
+                    v1 = (((80 * i5) >= (10 >= a0[15])) == ((i4 - a1[2][1]) ? (a1[3][7] + v3) : (i4 > v3)));
+                    v3 = (((66 >= a0[0]) > (v3 > a1[0][8])) % 4);
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                a0[2] = (((i7 ? i7 : v2) - (v0 % 1)) <= ((21 * i7) || (v3 ? 62 : v0)));
+                v1 = (((v3 >= a1[1][3]) >= (59 < 4)) / 6);
+                v0 = (((6 % 3) + (a1[1][15] > v2)) < ((v1 % 6) + (v3 >= i7)));
+            }
+            v0 = (((72 ? v1 : 40) == (v3 + i6)) ? ((a1[2][12] * 55) > (a0[7] < v2)) : ((a0[5] * v1) >= (v3 <= a1[2][0])));
+            v1 = (((v3 != a0[1]) ? (v2 * v1) : (v3 && v2)) % 9);
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    return (((31 && 94) <= (1 >= v2)) % 6);
+}
+int f1() {
+    int v0 = 34;
+    int v1 = 86;
+    int v2 = 57;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v2 > v2) % 1) && ((a0[5] <= a1[1][7]) ? (11 == v2) : (a0[2] % 6)));
+    v2 = (((v2 - v0) ? (a1[0][4] >= 58) : (v0 ? v0 : a0[13])) || ((v1 / 6) / 5));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v1 = (((v0 && i1) ? (a1[3][0] - 29) : (a0[12] < v0)) + ((a1[1][4] % 4) - (i1 < a0[3])));
+                v3 = (((i0 || a1[0][5]) + (a0[6] / 9)) > ((v1 < a1[0][12]) == (a0[5] % 1)));
+                v3 = (((5 <= i0) || (v0 > 2)) + ((55 % 5) != (v3 == a0[9])));
+            }
+            v1 = (((v2 ? 94 : 89) ? (i0 <= 94) : (v2 ? v0 : v0)) == ((v3 % 6) <= (v1 <= i0)));
+            v3 = (((83 * v0) < (24 % 4)) - ((34 && v0) / 5));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((7 <= i2) > 78) break;
+        a0[2] = (((v0 >= v3) && (i2 > i2)) < ((v1 / 5) - (v0 ? i2 : 86)));
+        v1 = (((v2 % 1) - (v0 ? 13 : v0)) + ((v1 <= 34) >= (v0 >= i2)));
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            if ((a0[7] + v1) > 96) break;
+            a0[4] = (((v3 > a0[3]) > (v3 >= i2)) || ((a0[7] + v1) + (v3 - a0[1])));
+            a1[0][2] = (((28 || a1[3][5]) / 1) >= ((v2 && 29) ? (v1 && i3) : (v3 != v1)));
+            v3 = (((v1 < v3) || (v2 == v2)) + ((a1[1][15] ? v1 : 56) <= (v2 ? v1 : 74)));
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v3 = (((v1 && i5) - (i5 != 49)) / 8);
+                v3 = (((34 ? v0 : a1[0][10]) > (a1[3][12] == a0[8])) + ((v3 ? 53 : 77) ? (v1 / 1) : (87 ? a0[2] : v0)));
+                v1 = (((80 >= i4) != (i4 || v0)) || ((i5 - a0[12]) && (v2 <= v1)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+        v1 = (((v3 * a0[15]) / 8) - ((v3 / 1) * (v0 >= 86)));
+        v0 = (((v3 == v2) == (v0 - 94)) > ((a1[0][1] && v3) * (a1[0][2] <= a0[11])));
+    }
+    return (((v2 ? 40 : 21) < (a0[3] && 29)) || ((a0[7] / 1) < (v1 % 4)));
+}
+int f2() {
+    int v0 = 53;
+    int v1 = 18;
+    int v2 = 28;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v3 && a1[3][5]) != (v3 - v3)) >= ((v2 && v2) && (v2 - a1[0][8])));
+            v0 = (((i0 > 97) >= (52 / 6)) <= ((v0 || v0) ? (v1 && 3) : (v3 && a0[13])));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a0[12] && v0) != (30 - v1)) == ((a1[0][15] == 1) > (50 * 96)));
+                    v2 = (((a0[9] * i1) <= (44 <= 10)) == ((i1 >= 84) > (28 >= 37)));
+                    v0 = (((v3 - v1) && (v3 || 56)) * ((a0[2] + a1[0][9]) + (12 <= v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((v2 != a1[0][14]) == (91 <= v2)) > ((a1[1][2] >= a1[1][1]) * (v0 <= v1)))) {
+        v0 = (((83 >= v3) >= (v1 % 1)) ? ((71 == v2) % 2) : ((v0 ? 19 : v0) < (a0[1] ? v1 : v1)));
+        a1[2][4] = (((44 >= v3) != (59 == 42)) / 1);
+        v3 = (((a1[1][7] || v1) - (a1[0][0] || a0[9])) < ((a1[1][3] && 39) * (8 == v3)));
+    } else {
+        a1[3][12] = (((77 <= a1[3][5]) && (v3 <= a1[2][7])) ? ((50 % 7) / 1) : ((v0 - 25) != (v3 + a1[2][0])));
+        v0 = (((53 <= v0) ? (v1 < v3) : (19 / 4)) + ((a1[2][3] * a1[3][7]) + (a1[1][7] ? v0 : v2)));
+        a0[8] = (((45 / 8) && (v0 && 14)) >= ((28 + v2) >= (69 + v3)));
+    }
+    if ((((69 / 8) || (a0[0] % 6)) % 4)) {
+        v1 = (((41 > a1[0][9]) + (33 / 3)) || ((v0 / 8) >= (v0 && a1[3][11])));
+        a0[10] = (((v0 == a0[13]) - (v3 != 94)) + ((58 > a1[0][4]) + (81 / 2)));
+        v2 = (((v0 ? a0[15] : v1) ? (v2 >= v3) : (v1 >= v1)) > ((63 - 98) || (a0[7] / 3)));
+    } else {
+        a1[2][7] = (((v2 || v0) / 8) / 3);
+        a0[7] = (((v0 == v2) - (a0[0] - v3)) || ((v0 ? v2 : a1[0][15]) % 2));
+        v1 = (((a0[7] > a1[1][15]) ? (v0 - a1[1][15]) : (v1 != 30)) * ((83 ? a0[0] : v3) <= (v0 + a1[1][1])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((v3 * v0) > 67) break;
+            v2 = (((v3 >= v0) && (9 && i2)) > ((v2 < 18) ? (v1 > 18) : (v1 * a0[7])));
+            v1 = (((37 > i2) && (63 >= i2)) % 4);
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((i3 || a0[11]) != (v1 < v0)) ? ((92 <= i3) + (a0[7] < i3)) : ((v3 ? a0[10] : i2) >= (i2 || a0[0])));
+                    a1[1][0] = (((v3 * 91) % 1) < ((40 * v1) > (a1[1][8] || 67)));
+                    v0 = (((69 == 95) - (v3 ? i2 : i3)) || ((a1[2][8] && i3) < (v1 || 1)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    a0[2] = (((v0 - a1[3][12]) >= (87 > v3)) - ((a1[3][9] % 4) != (v0 + v0)));
+    return (((17 == a0[14]) / 7) || ((a0[11] == v1) <= (v3 * 37)));
+}
+int main() {
+    return 0;
+}
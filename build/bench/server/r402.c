@@ -0,0 +1,66 @@
+int f0() {
+    int v0 = 98;
+    int v1 = 31;
+    int v2 = 4;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((v2 - v3) % 9) - ((v0 <= 41) - (i0 / 7)));
+                    v1 = (((v3 && v2) > (v0 > 74)) ? ((v3 == a1[2][14]) * (a1[2][10] % 4)) : ((i0 < 94) ? (19 + v3) : (a0[6] / 8)));
+                    v1 = (((v2 ? a0[2] : i0) - (85 != v0)) <= ((i0 ? a0[1] : a1[0][1]) % 4));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v1 = (((97 <= a0[7]) ? (33 == a1[0][10]) : (i0 % 9)) - ((11 % 7) < (a0[7] / 6)));
+            a1[1][12] = (((86 && v3) == (v1 > 12)) && ((v2 < v1) > (a1[2][13] == a1[2][8])));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((a1[0][1] * a0[8]) % 7) == ((v1 / 2) * (53 || 10)));
+    {
+        int i2 = 0;
+        do {
+            if ((v0 || a0[15]) > 80) break;
+            v1 = (((v2 - a0[1]) == (a1[1][3] && v2)) >= ((a1[1][9] && v1) == (13 == 14)));
+            v3 = (((a1[2][0] - a0[10]) == (v2 || a1[3][2])) % 9);
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a0[6] >= a0[13]) + (v2 ? v1 : i2)) != ((41 <= a1[1][4]) / 7));
+                    a1[0][3] = (((38 != a0[8]) / 4) <= ((v0 + a1[3][12]) > (a0[2] != a0[13])));
+                    v1 = (((i2 >= a1[1][6]) ? (a0[4] + 26) : (76 ? a1[2][9] : v1)) == ((v2 && v3) ? (v0 <= 28) : (i3 ? 42 : 6)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((v2 == 67) < (v1 + v2)) < ((24 + 74) < (55 ? v3 : 62)));
+            {
+                int i5 = 0;
+                do {
+                    a0[12] = (((98 >= 53) / 6) == ((4 < a0[0]) + (i5 == 65)));
+                    v1 = (((v3 || a1[0][12]) ? (i5 <= v2) : (a1[0][6] != v2)) == ((3 || 64) * (i4 || a1[2][14])));
+                    v0 = (((a0[11] / 3) + (a0[4] == a1[0][5])) - ((i5 == i5) <= (i4 || i4)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v2 = (((i4 <= v0) ? (i4 ? a1[2][13] : v2) : (90 ? 23 : i4)) ? ((v2 + a0[8]) >= (v0 % 2)) : ((v0 * 41) == (v2 ? 37 : i4)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    v3 = (((v3 % 5) - (33 <= v2)) || ((v0 >= v3) || (a1[0][3] && a1[3][8])));
+    return (((7 / 4) || (v3 / 9)) / 5);
+}
+int main() {
+    return 0;
+}
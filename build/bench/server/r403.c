@@ -0,0 +1,145 @@
+int f0() {
+    int v0 = 63;
+    int v1 = 44;
+    int v2 = 10;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a0[0] = (((a1[1][8] > v3) <= (v1 < v3)) == ((v2 - i0) <= (a0[2] * i1)));
+                v0 = (((a1[2][11] >= a1[2][2]) > (a0[5] > i0)) || ((v1 < v2) <= (2 && a0[0])));
+                v3 = (((a1[1][9] - a1[0][13]) != (i0 <= a0[7])) - ((i1 == a1[2][12]) <= (i0 / 2)));
+            }
+            v1 = (((75 / 8) * (v3 <= a1[0][1])) <= ((a1[0][8] - v2) * (53 % 3)));
+            v0 = (((a0[2] > v0) ? (a0[9] || 20) : (a1[0][7] ? 47 : 83)) != ((76 <= 22) || (v3 % 8)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((11 + v0) > 50) break;
+        a0[14] = (((v2 * a0[1]) ? (v1 + v2) : (v3 + 6)) && ((i2 % 2) / 2));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v1 = (((i3 ? 41 : i3) >= (a1[2][15] ? v2 : a0[15])) * ((i2 == v0) != (v2 > i3)));
+                v1 = (((i3 != 79) >= (v0 || 1)) ? ((a1[3][10] == v3) || (i3 && a0[12])) : ((a1[1][7] || v2) != (v3 - i3)));
+                v0 = (((a0[8] * i3) >= (a1[1][2] % 5)) < ((a1[2][3] - i2) >= (a1[0][8] % 4)));
+                i3 = i3 + 1;
+            }
+        }
+        a1[2][0] = (((67 / 4) + (v2 > 66)) <= ((v3 && 5) * (a1[0][9] + v3)));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        a1[2][3] = (((v1 / 7) && (a1[0][7] || 20)) >= ((5 || v2) > (15 >= v2)));
+        {
+            int i5 = 0;
+            do {
+                if ((a1[3][12] && v1) > 58) break;
+                v0 = (((i5 >= v0) / 4) - ((a1[1][13] == a0[11]) + (v0 * 6)));
+                v1 = (((i5 % 1) && (a0[10] >= 75)) - ((a0[14] + v2) % 9));
+                v2 = (((83 == 77) && (v2 != v3)) == ((v1 % 1) != (a1[1][15] && 9)));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        a0[10] = (((v1 != 76) || (a0[12] || v0)) - ((73 > 26) * (v3 * 86)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            if ((v2 / 5) > 96) break;
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                if ((v2 >= a0[10]) > 68) break;
+                a0[15] = (((a0[6] * a1[0][7]) && (a1[1][6] >= i6)) * ((8 - 43) != (a0[6] / 3)));
+                a1[0][13] = (((i7 ? 19 : v2) >= (v1 < 74)) > ((v0 || a1[0][6]) ? (v3 != 81) : (25 && v0)));
+                a1[1][11] = (((a1[1][15] < a0[4]) || (v0 != a0[1])) == ((v2 >= a0[0]) < (a0[14] - 95)));
+            }
+            a0[6] = (((99 == i6) ? (12 > i6) : (a0[5] != 53)) + ((v3 - a0[11]) - (v2 ? a1[0][15] : a1[0][11])));
+            v1 = (((v3 != 47) == (v2 < 56)) || ((v3 ? a1[1][3] : v2) / 4));
+            i6 = i6 + 1;
+        }
+    }
+    v1 = (((64 != v0) <= (89 && v3)) < ((a0[1] <= a0[8]) % 9));
+    return (((v0 ? v2 : a0[8]) % 4) * ((v3 != 96) + (56 % 5)));
+}
+int f1() {
+    int v0 = 35;
+    int v1 = 15;
+    int v2 = 50;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[7] || a1[0][0]) != (v3 % 1)) * ((v0 <= 3) - (v3 || v1)))) {
+        v1 = (((94 < v0) >= (9 - 42)) != ((v2 <= v2) - (v0 % 1)));
+        a1[0][11] = (((a0[15] == v2) ? (v0 % 6) : (9 + v0)) + ((a1[3][15] ? 70 : v0) <= (v0 == v2)));
+        v1 = (((v0 <= a0[3]) ? (v2 <= v3) : (v0 + v1)) || ((v0 + a0[5]) && (v3 != a1[0][7])));
+    } else {
+        v3 = (((37 / 6) <= (v1 <= v1)) <= ((a1[3][4] > v2) < (a1[2][7] ? v2 : 76)));
+        v2 = (((v2 || 90) && (v2 - v2)) < ((a1[3][1] - 51) != (v3 / 9)));
+        v3 = (((a0[14] >= v1) || (a1[1][8] / 8)) ? ((56 > 1) < (v2 < v0)) : ((v0 ? 8 : v0) - (71 - v1)));
+    }
+    if ((((v2 && v2) / 8) || ((v2 == v2) - (v1 == v3)))) {
+        a0[14] = (((v2 && v3) || (v0 - v0)) && ((v3 / 1) * (51 ? v2 : v0)));
+        a1[1][15] = (((v2 <= v2) <= (a1[0][6] / 1)) > ((v1 + 97) || (v2 > v0)));
+        v1 = (((a1[0][5] % 1) || (37 + a0[14])) < ((v2 / 4) > (26 - v0)));
+    } else {
+        a0[8] = (((v0 % 6) % 4) * ((15 < v3) >= (a0[11] && a1[3][5])));
+        a0[12] = (((v1 != a1[2][12]) && (v1 <= v0)) == ((v2 || 50) < (v3 - v2)));
+        a0[1] = (((v1 * 85) == (29 - v3)) && ((v0 > v3) == (v0 > a0[13])));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((i0 == a1[3][12]) && (66 ? 44 : i0)) + ((45 < v3) || (a0[7] + a1[3][6])));
+                    v3 = (((98 <= 15) && (a0[5] >= v3)) * ((v1 ? v3 : 66) >= (v0 % 9)));
+                    v2 = (((99 && i0) / 1) * ((i1 % 3) * (a0[2] ? 12 : 53)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v2 = (((11 > v3) <= (a1[0][2] <= i0)) ? ((i0 < 87) / 4) : ((15 >= v2) >= (v1 ? i0 : 37)));
+            a0[0] = (((v2 <= v1) || (v0 <= v3)) % 5);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((76 ? v1 : a0[2]) > 89) break;
+            v3 = (((a1[0][15] * v2) != (a1[3][14] <= v1)) - ((v2 + v2) > (a0[14] * v3)));
+            v0 = (((50 >= a1[2][5]) < (v3 < a0[3])) < ((v2 < i2) && (38 / 2)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v0 = (((v3 + v0) / 3) % 1);
+                a1[3][3] = (((a0[4] <= v2) || (v3 == a1[3][15])) + ((a1[2][6] - i3) ? (a1[2][9] % 6) : (89 || i3)));
+                a1[0][5] = (((18 && a0[14]) / 1) ? ((a0[13] && v0) || (a0[12] * v0)) : ((i3 - v1) - (a0[7] || a0[11])));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            {
+                int i5 = 0;
+                do {
+                    if ((90 * v3) > 62) break;
+                    v3 = (((a0[15] + 37) && (v2 * a0[14])) <= ((v0 - a0[14]) * (v3 >= v1)));
+                    v1 = (((a1[1][14] > i5) < (v1 || v1)) ? ((i5 / 7) == (i5 - v2)) : ((15 == 31) <= (45 ? v2 : v0)));
+                    a0[8] = (((a1[3][3] || 42) && (i5 || 75)) && ((41 + v3) * (a0[15] % 4)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v0 = (((11 <= 38) % 4) / 4);
+            v0 = (((v1 < 36) * (v0 > v0)) + ((a1[2][3] * a1[1][0]) ? (a1[3][13] < 33) : (v1 <= i4)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 * 54) ? (a0[14] <= v0) : (40 <= v0)) || ((57 <= v3) != (a0[9] ? v2 : a0[10])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,180 @@
+int f0() {
+    int v0 = 84;
+    int v1 = 93;
+    int v2 = 79;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 ? a0[2] : v0) != (a0[12] <= v0)) ? ((v2 || v2) == (a0[4] * 87)) : ((82 % 2) % 7))) {
+        v3 = (((v2 > a0[1]) / 8) ? ((a0[5] / 8) - (a1[3][2] - a0[7])) : ((a0[2] && a1[2][9]) >= (a0[3] >= 76)));
+        v3 = (((v3 % 2) <= (v0 ? v0 : 66)) * ((63 == a0[0]) >= (v0 < a0[2])));
+        a1[0][5] = (((a0[8] || v3) != (a1[0][1] ? v1 : 49)) > ((a0[6] <= 2) - (77 > 29)));
+    } else {
+        v2 = (((21 ? 0 : 55) * (v1 * v1)) >= ((v0 > 22) && (v3 - 17)));
+        v1 = (((v1 <= v1) && (v1 - 60)) <= ((v3 && a1[2][13]) % 4));
+        v2 = (((v2 ? v3 : v0) >= (25 && 40)) && ((v0 > 49) > (a1[2][13] <= a1[3][7])));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            if ((a0[12] / 3) > 78) break;
+            v1 = (((v0 > v1) ? (13 && 48) : (90 != v1)) / 9);
+            v2 = (((v0 && a1[3][7]) > (44 * a1[2][7])) <= ((a0[14] + i0) || (a1[2][15] <= a0[12])));
+            a0[11] = (((v0 - v2) % 8) > ((v2 != i0) ? (i0 <= a1[0][5]) : (a0[7] ? v1 : i0)));
+        }
+        a1[2][11] = (((v2 ? 74 : 74) == (a1[0][5] ? v2 : 31)) + ((a0[13] ? v2 : a0[15]) == (v3 % 4)));
+        v3 = (((v2 >= v0) ? (a1[3][2] + v0) : (91 + 74)) != ((a1[1][15] <= i0) * (a0[9] > v3)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v3 = (((v3 + a0[10]) + (i3 ? 54 : a0[1])) - ((i2 + i2) == (i3 - v3)));
+                    v1 = (((a1[0][6] == v0) < (58 % 4)) && ((97 <= v3) != (v2 < v3)));
+                    v1 = (((v3 / 6) / 8) > ((v3 >= i3) || (90 + v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((60 ? v1 : i2) - (v3 % 4)) + ((v1 != v3) ? (4 && v3) : (v2 <= v2)));
+            v2 = (((v3 >= a1[1][8]) || (v1 >= a0[12])) - ((37 + i2) || (96 == v0)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[3] * v0) != (67 * v0)) < ((v1 / 3) <= (11 % 4)))) {
+        v0 = (((80 <= v2) || (v1 / 7)) - ((v1 > a0[0]) && (v0 ? a0[9] : v2)));
+        a0[2] = (((v1 || v2) >= (35 % 2)) > ((a1[3][15] != 35) != (97 % 9)));
+        v3 = (((v2 ? v2 : v3) < (a0[15] / 9)) <= ((v0 * 86) && (v2 + 56)));
+    } else {
+        v1 = (((v3 % 6) != (v1 >= v3)) * ((33 / 3) > (v1 / 5)));
+        v3 = (((v0 / 8) * (v2 && 83)) || ((a1[1][3] || v2) == (v2 < a0[13])));
+        a1[2][1] = (((v2 * v3) == (4 % 3)) != ((43 <= a0[3]) > (a1[1][14] + a1[2][3])));
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        if ((v0 / 2) > 83) break;
+        a1[3][12] = (((v2 % 7) % 4) / 3);
+        {
+            int i5 = 0;
+            do {
+                a1[0][7] = (((43 - a1[2][6]) <= (v0 >= v2)) + ((v0 == a0[13]) && (v0 || v3)));
+                v2 = (((v1 + a1[3][7]) && (43 && v1)) - ((i4 <= 32) && (i4 && 85)));
+                v3 = (((36 || v2) < (v0 > a1[0][7])) != ((i5 || 80) % 1));
+                i5 = i5 + 1;
+            } while (i5 < 4);
+        }
+        a1[1][9] = (((v3 == 61) >= (50 < a0[6])) * ((a1[0][2] ? a0[8] : v2) != (i4 ? v2 : i4)));
+    }
+    return (((a1[0][13] > 10) || (v3 + 14)) != ((8 ? v2 : v2) / 8));
+}
+int f1() {
+    int v0 = 82;
+    int v1 = 35;
+    int v2 = 57;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            if ((a0[13] < 74) > 91) break;
+            a1[0][5] = (((53 == a1[2][14]) == (a0[6] == v1)) % 9);
+            v0 = (((v2 < v2) ? (i0 < 40) : (39 || 99)) * ((v0 <= v1) / 1));
+            a0[14] = (((v0 <= v0) - (v3 / 2)) ? ((a0[0] > a0[14]) && (a0[12] <= i1)) : ((v2 / 8) % 5));
+        }
+        v0 = (((v3 <= 23) + (33 / 8)) != ((a0[9] > 71) / 5));
+        a0[0] = (((a0[15] && 14) + (a1[1][7] > v2)) ? ((18 >= v1) / 1) : ((14 - a1[1][0]) != (40 > v0)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a1[1][1] = (((i2 != a0[8]) == (a0[3] + 0)) || ((59 && a0[5]) < (v0 / 7)));
+        v1 = (((a1[2][12] != v2) && (10 != a1[0][3])) / 9);
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v1 = (((1 % 9) && (i3 == a0[14])) >= ((v2 || 25) >= (v3 ? a1[3][2] : v3)));
+            v0 = (((a1[0][10] || i2) ? (i2 * 26) : (i2 + 92)) - ((v1 + 66) < (43 < i3)));
+            a1[3][14] = (((a1[0][0] || i3) % 3) < ((a1[0][7] ? v1 : v0) > (48 % 1)));
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v0 = (((a1[2][3] * a0[5]) ? (i4 * v2) : (93 || v3)) + ((i4 == i4) > (v0 ? 56 : 84)));
+        v3 = (((24 ? a0[0] : 66) <= (8 / 8)) == ((v0 || i4) >= (v2 <= 26)));
+        {
+            int i5 = 0;
+            do {
+                a0[11] = (((a0[4] ? 69 : a0[15]) % 8) ? ((36 > a1[2][7]) * (v0 * 30)) : ((i4 / 8) <= (v2 * a1[3][15])));
+                a0[5] = (((i4 < 72) <= (v1 < a0[0])) == ((v2 ? 89 : a1[0][1]) - (i5 < a1[1][5])));
+                v0 = (((a0[9] ? 68 : 56) >= (89 || i5)) + ((91 * i5) / 2));
+                i5 = i5 + 1;
+            } while (i5 < 2);
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                v3 = (((a0[6] + 79) / 3) || ((i7 < v0) >= (a1[1][2] == v3)));
+                a0[11] = (((45 / 2) && (i7 && v2)) % 7);
+                a1[1][11] = (((v2 % 3) * (v3 + 33)) > ((a0[10] ? v2 : v0) < (v1 + a0[0])));
+            }
+            v3 = (((i6 >= v1) ? (v2 * i6) : (a1[1][6] <= 79)) || ((89 && a1[2][13]) / 8));
+            v0 = (((i6 > a1[0][15]) + (v1 ? 62 : v1)) < ((22 % 5) + (28 && 48)));
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    a0[5] = (((v1 > v2) > (v2 < a0[5])) + ((a0[3] - a1[1][8]) && (a0[8] < v2)));
+    return (((v1 || v3) || (a0[12] > a0[13])) - ((a1[2][4] / 4) >= (v0 > a1[1][9])));
+}
+int f2() {
+    int v0 = 99;
+    int v1 = 18;
+    int v2 = 15;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v1 = (((v3 ? v1 : a0[7]) / 2) / 8);
+            a0[12] = (((v0 >= v3) - (a0[12] + v1)) && ((v1 ? v3 : v0) < (v3 && a1[0][6])));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                a1[0][5] = (((v3 < v0) <= (v3 % 8)) != ((a0[8] < 27) == (a0[6] && 55)));
+                a1[2][10] = (((a1[1][2] <= v2) < (69 >= a0[7])) ? ((v0 < v0) ? (i1 <= i1) : (v1 + v2)) : ((v3 ? v1 : i1) % 9));
+                v1 = (((i1 ? a1[3][4] : a0[6]) != (88 * v0)) ? ((i1 == a0[11]) >= (a0[1] || 6)) : ((i1 || v0) || (v1 - a1[3][11])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v0 % 3) ? (a0[8] < 74) : (v3 >= a1[1][7])) < ((v1 || v3) != (74 % 9)));
+    if ((((4 % 9) && (v3 ? v1 : 30)) || ((v0 == a1[2][0]) + (v0 + v2)))) {
+        a1[3][5] = (((34 || v1) && (a0[7] >= 79)) || ((v2 % 6) - (a0[9] % 7)));
+        a1[3][1] = (((v0 || v3) - (72 >= a0[14])) ? ((v2 ? v0 : v3) && (79 / 4)) : ((a1[0][9] % 9) || (34 / 6)));
+        a1[3][5] = (((43 * a0[14]) >= (23 > v0)) % 2);
+    } else {
+        a1[3][1] = (((v1 + 14) + (v1 / 5)) - ((v0 / 9) ? (54 != 88) : (v2 * v0)));
+        a1[2][12] = (((v0 + a0[1]) ? (v2 >= v3) : (7 + v0)) > ((v2 <= a0[2]) && (a0[2] + 38)));
+        a1[3][14] = (((a0[3] - v1) > (a1[2][6] <= v0)) + ((v1 + 84) && (v0 <= 72)));
+    }
+    if ((((v3 ? v3 : 22) < (31 >= 68)) > ((v2 < 42) * (v2 % 9)))) {
+        v1 = (((v3 || v3) ? (a1[3][3] ? 55 : v3) : (a0[12] != v2)) < ((v1 / 4) + (a1[0][2] ? a0[7] : 65)));
+        v3 = (((v3 + v2) + (76 + 45)) ? ((v3 ? 44 : v0) != (16 * v0)) : ((v1 || 92) && (v1 ? v2 : 86)));
+        a1[2][13] = (((50 != 65) - (v2 ? v1 : a1[1][1])) <= ((v3 ? v3 : a0[7]) < (v2 == a1[1][0])));
+    } else {
+        a1[0][2] = (((a1[2][13] >= 76) ? (a0[10] < a0[4]) : (v3 >= v3)) ? ((v3 % 2) * (58 || a1[3][14])) : ((a0[9] ? v2 : v2) || (v3 / 8)));
+        v1 = (((86 || 0) * (v2 || a1[1][7])) != ((59 ? v3 : a1[2][5]) ? (49 * a0[3]) : (a1[1][5] % 1)));
+        a0[7] = (((v0 * v1) <= (v0 > 41)) % 2);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a1[3][12] = (((14 || v2) >= (a0[5] || a1[3][8])) - ((v0 && v1) <= (v2 / 9)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v3 = (((v3 <= v0) ? (25 % 2) : (50 && a0[4])) * ((i3 == v1) || (i2 - v2)));
+                v0 = (((v2 + 48) && (v1 || i2)) / 3);
+                v3 = (((v2 >= v2) / 8) ? ((v0 < 49) % 2) : ((a1[3][9] % 3) * (7 ? a0[2] : i3)));
+                i3 = i3 + 1;
+            }
+        }
+        a1[0][3] = (((v2 < v1) > (v0 * i2)) ? ((i2 - 30) % 9) : ((a1[0][14] / 2) <= (v3 - v1)));
+    }
+    return (((18 == a0[7]) - (a0[5] < 55)) / 6);
+}
+int main() {
+    return 0;
+}
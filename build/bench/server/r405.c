@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 33;
+    int v2 = 42;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a0[1] = (((v2 >= a0[4]) <= (i0 > a1[0][13])) > ((2 / 6) + (v2 != v2)));
+            a1[0][8] = (((72 * 9) == (a0[8] && 32)) / 3);
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v3 = (((v2 || v0) >= (17 < a0[5])) - ((a0[3] || a1[1][1]) + (a1[1][7] - a1[1][1])));
+                v3 = (((v3 + v0) % 3) + ((10 ? 39 : v3) / 4));
+                a0[14] = (((6 && 97) ? (15 < i1) : (v2 <= v0)) > ((a1[3][13] * 28) - (v0 || 8)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((67 % 8) ? (v0 ? v0 : v2) : (v3 || v1)) % 6)) {
+        v3 = (((v1 + v1) > (a0[11] / 4)) % 7);
+        v1 = (((89 <= v0) + (a0[9] / 4)) <= ((a0[5] + v0) ? (a1[0][11] * v0) : (v2 >= 71)));
+        v2 = (((99 * v1) / 2) > ((v0 == 46) > (v2 % 6)));
+    } else {
+        v1 = (((v0 <= 5) && (v0 < a1[2][13])) != ((v3 <= a0[9]) ? (70 ? v0 : 8) : (v2 > a1[3][10])));
+        v0 = (((v2 + v1) != (v0 / 3)) == ((v0 <= a0[14]) || (v0 || v1)));
+        v0 = (((v2 ? a0[10] : 14) <= (v3 <= v2)) ? ((v3 <= v2) && (v3 - 78)) : ((a1[0][7] + a1[2][3]) * (88 <= v2)));
+    }
+    if ((((v2 % 9) > (v2 > v3)) <= ((v0 != v0) - (v1 / 4)))) {
+        v0 = (((a0[6] >= 34) + (a1[2][1] != v2)) ? ((v2 || 85) && (a1[0][14] * v0)) : ((v0 >= v2) ? (78 <= v1) : (v3 >= 46)));
+        v0 = (((v1 || v1) >= (v0 > v0)) >= ((a0[2] / 5) && (a1[0][13] == 92)));
+        v1 = (((v2 * v3) && (a0[3] / 7)) ? ((38 % 4) >= (71 - v2)) : ((v2 < 90) + (v1 == a1[0][2])));
+    } else {
+        a0[15] = (((12 >= a1[3][3]) && (v3 && v0)) != ((80 / 1) ? (a0[6] ? 78 : v2) : (v2 <= v0)));
+        v0 = (((57 && 62) == (a1[1][13] == v3)) - ((v2 ? a1[0][11] : 5) && (v3 || 86)));
+        a1[3][8] = (((v2 ? 62 : 38) && (26 / 8)) >= ((v0 == v2) - (v2 == 51)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v1 = (((v1 <= v0) != (v3 / 7)) == ((v1 && v0) / 2));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a0[12] = (((v0 * i3) ? (v1 / 9) : (42 && v0)) % 4);
+                v3 = (((v1 && v0) != (a1[2][11] ? 97 : 69)) < ((v1 * a1[1][15]) <= (a1[3][9] / 8)));
+                v0 = (((a0[15] || a1[1][15]) == (v2 > a1[3][5])) < ((v2 + a1[0][9]) % 3));
+            }
+            a0[0] = (((v3 % 8) ? (50 ? 47 : a1[3][3]) : (79 || 76)) && ((88 % 1) - (v0 <= a0[0])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v0 + v0) - (28 > 54)) == ((a1[3][9] > i4) + (v0 / 2)));
+            a0[8] = (((v1 && v2) <= (a1[0][10] - v2)) + ((v0 > v2) <= (v3 ? v0 : i4)));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                if ((a1[1][2] + a0[0]) > 61) break;
+                v2 = (((a1[3][7] < v3) != (v1 != a0[11])) < ((a1[0][0] + v1) % 8));
+                v0 = (((34 <= v2) <= (v0 ? a0[11] : i4)) != ((v1 && v2) >= (a1[3][10] + a1[3][5])));
+                v2 = (((a0[1] >= 82) * (v0 && 38)) - ((i4 - 19) % 2));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    return (((v3 > a1[2][15]) && (v1 - 55)) * ((v3 + a1[2][4]) < (a1[3][14] * v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,124 @@
+int f0() {
+    int v0 = 72;
+    int v1 = 5;
+    int v2 = 72;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v3 = (((v3 && v0) + (42 > v1)) == ((a0[15] || v3) - (a0[4] + 41)));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v2 = (((a1[2][3] <= v0) <= (39 * v1)) == ((v2 == a0[6]) + (95 + 24)));
+                v1 = (((i1 >= 92) + (i1 > i1)) - ((65 == i1) ? (i1 * 54) : (v0 || i1)));
+                v0 = (((a1[1][12] - v2) * (70 < a0[12])) >= ((a0[10] / 3) ? (a1[0][8] <= 21) : (v0 < v0)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((15 ? 67 : 70) ? (v1 <= v2) : (i0 > a0[12])) && ((14 || a1[3][10]) || (30 && a0[9])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            a0[14] = (((a1[1][15] >= v1) * (76 % 1)) + ((v2 <= v3) * (i2 % 4)));
+            v1 = (((a1[1][1] >= v2) / 3) / 1);
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v2 = (((a0[2] ? 10 : v0) ? (v2 % 7) : (a1[3][1] % 4)) > ((v0 != 62) == (a1[3][6] == v0)));
+                    a0[10] = (((v0 * v0) / 2) ? ((a0[2] < a1[2][6]) == (i2 || v2)) : ((v1 + v3) * (63 && 71)));
+                    v0 = (((30 || v0) + (a1[0][15] ? 3 : a0[1])) + ((i3 ? i2 : v3) - (a1[3][13] * a0[3])));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v2 = (((a0[5] * a1[2][9]) * (i5 % 9)) <= ((93 % 4) >= (v0 && v3)));
+                    v1 = (((v3 < v2) - (v0 <= 61)) + ((v1 && a1[2][13]) == (11 + a0[13])));
+                    a0[9] = (((a0[0] && v0) ? (v3 - v2) : (v3 > a1[0][13])) > ((v2 + a1[3][14]) <= (i5 - 79)));
+                    i5 = i5 + 1;
+                }
+            }
+            a0[14] = (((a0[10] ? a0[13] : i4) && (v2 % 9)) > ((v0 >= i4) <= (a1[1][0] == v3)));
+            v0 = (((88 || v3) - (a0[11] < v0)) <= ((v3 - v2) && (i4 >= v2)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((8 ? i6 : 34) > 56) break;
+            v3 = (((v1 != 82) + (a0[7] != a0[14])) ? ((48 <= v3) - (i6 / 1)) : ((v0 && 80) && (a0[1] || v3)));
+            a1[0][7] = (((i6 % 1) < (v1 >= a1[1][8])) < ((v3 >= v3) / 7));
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                v3 = (((4 && 30) != (v2 || a0[8])) > ((22 % 2) ? (37 * i7) : (i7 && v0)));
+                a1[2][14] = (((i7 > i7) % 5) > ((v2 / 4) == (a0[10] == i6)));
+                v3 = (((v2 - 43) * (v1 >= 50)) % 3);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    if ((((a1[1][6] ? a1[2][12] : a1[2][12]) - (v1 % 3)) / 2)) {
+        v2 = (((63 * a0[10]) >= (a1[1][15] >= v3)) != ((51 != v1) < (50 - 57)));
+        v2 = (((48 != v1) || (a0[1] / 4)) != ((18 <= v1) ? (v3 <= v2) : (v2 ? 45 : v2)));
+        a0[14] = (((v1 - 75) * (32 > v1)) / 5);
+    } else {
+        v2 = (((71 % 8) || (a0[15] < v0)) >= ((v0 ? v1 : v2) > (93 % 5)));
+        v3 = (((v3 - a1[2][0]) - (a0[13] ? v2 : v3)) >= ((v3 || 17) <= (76 ? v0 : v2)));
+        v2 = (((v1 < a1[0][1]) % 3) % 2);
+    }
+    return (((v3 || a0[8]) < (a1[3][11] < 78)) <= ((v0 < v1) || (a1[2][2] && a0[2])));
+}
+int f1() {
+    int v0 = 34;
+    int v1 = 57;
+    int v2 = 99;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 * 45) <= (a0[12] >= v0)) ? ((a0[11] != a0[2]) <= (a0[12] < 23)) : ((a0[15] < v2) % 7))) {
+        v1 = (((v0 ? 53 : v3) / 3) >= ((a0[6] % 7) ? (v1 < v0) : (v2 < v0)));
+        v0 = (((a1[3][13] > a0[10]) != (v2 > a0[3])) * ((v2 * 40) >= (a0[2] + v1)));
+        v0 = (((v3 && 82) || (v3 && 15)) && ((v3 >= a0[14]) > (27 < a0[7])));
+    } else {
+        a1[0][5] = (((a0[15] * v1) && (49 - 47)) + ((a1[2][8] || a1[1][2]) ? (98 * v0) : (33 / 4)));
+        v1 = (((v0 + 52) % 7) != ((a0[4] ? 80 : 0) / 3));
+        v2 = (((18 ? v0 : v0) - (v2 - v0)) >= ((a0[10] ? a0[7] : a0[14]) ? (85 / 6) : (83 <= v1)));
+    }
+    v0 = (((a1[1][2] / 4) != (83 / 7)) * ((v1 >= v1) || (a0[15] + v3)));
+    if ((((v1 < 36) * (v1 * v0)) + ((v0 != a0[6]) < (a1[3][9] || a1[1][12])))) {
+        a1[2][14] = (((v0 / 2) && (v3 + v2)) % 5);
+        a1[1][4] = (((24 / 6) <= (1 == v1)) >= ((96 ? 23 : 47) >= (a1[2][6] != a0[9])));
+        a1[1][15] = (((v2 + v0) && (v3 == 17)) > ((a1[3][12] ? v3 : v2) || (v0 > v0)));
+    } else {
+        v0 = (((v2 / 8) >= (v1 <= v0)) ? ((v1 % 3) / 2) : ((v1 >= v1) % 9));
+        v1 = (((v1 < 41) || (v2 != 4)) < ((37 >= v2) < (a1[3][2] / 4)));
+        a1[1][8] = (((v2 || 67) ? (16 || v2) : (v2 % 4)) - ((v3 % 1) != (a1[2][12] / 1)));
+    }
+    v3 = (((a1[3][6] > v3) % 7) < ((a0[6] - a0[6]) <= (a1[1][0] < v1)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a1[2][2] = (((v0 || v0) ? (85 == 78) : (93 + 47)) + ((86 > v1) == (i0 * 63)));
+        v1 = (((i0 != v3) && (a0[15] >= a1[1][14])) * ((a1[2][9] < a1[1][1]) != (v0 > 54)));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v2 = (((84 / 4) > (i1 != i1)) <= ((78 / 6) && (i1 % 9)));
+                v0 = (((44 != a1[0][3]) ? (a1[0][5] != a0[6]) : (v2 - 81)) || ((v0 < 84) == (v2 == a0[8])));
+                v0 = (((v1 * v3) ? (i0 && a0[7]) : (a1[3][3] ? a1[1][9] : i1)) ? ((78 || 33) - (a0[7] < 97)) : ((v0 * a0[14]) == (40 * a1[2][5])));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    return (((v2 < a0[15]) && (a0[11] + v1)) % 4);
+}
+int main() {
+    return 0;
+}
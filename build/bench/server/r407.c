@@ -0,0 +1,187 @@
+int f0() {
+    int v0 = 19;
+    int v1 = 66;
+    int v2 = 73;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v1 = (((v3 < a0[11]) % 1) / 2);
+            a0[9] = (((v1 ? 56 : 11) + (16 || 18)) * ((v0 || v1) % 7));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v0 = (((i1 > a0[10]) / 6) * ((v0 % 3) < (a0[0] && i1)));
+                    a0[8] = (((a0[11] <= i0) * (v3 != 6)) || ((a0[10] != 79) * (a1[3][12] - a0[5])));
+                    a0[1] = (((45 >= v1) - (i1 == v0)) <= ((8 ? a0[0] : a1[2][0]) < (i1 ? i0 : 11)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v2 <= 94) && (87 || i2)) <= ((v3 || v1) != (v3 ? a0[6] : a1[2][14])));
+            a1[2][2] = (((v2 != a1[0][13]) < (v1 <= v3)) + ((v1 && a0[9]) / 7));
+            {
+                int i3 = 0;
+                do {
+                    if ((i2 ? i3 : v3) > 66) break;
+                    v0 = (((a1[0][4] < a1[2][5]) + (7 ? v0 : v2)) > ((i2 ? 15 : v3) * (v1 ? v3 : a1[2][8])));
+                    a0[1] = (((v3 >= a1[2][10]) ? (v0 || a0[15]) : (1 || a0[14])) == ((12 ? v1 : v0) * (90 - v0)));
+                    v2 = (((v1 > v1) || (i3 ? 4 : i3)) ? ((a1[1][14] + i3) % 1) : ((v2 ? 83 : v1) % 8));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v2 ? v1 : a1[1][7]) > 51) break;
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                if ((a0[12] || a0[14]) > 72) break;
+                v1 = (((v2 / 8) > (88 ? 42 : 49)) + ((a1[0][5] - a0[3]) || (v3 ? v0 : 61)));
+                v3 = (((a1[3][5] ? i5 : a0[7]) ? (v1 < a1[3][5]) : (v3 != a1[0][1])) <= ((83 && a0[12]) - (v2 + a1[0][8])));
+                a0[15] = (((v0 >= i4) ? (v2 >= v2) : (a1[1][4] <= a1[2][6])) ? ((i4 || v0) % 4) : ((i4 < a0[10]) || (i5 / 1)));
+            }
+            v3 = (((v2 < 43) * (a1[0][0] == a1[2][14])) && ((v3 < 67) <= (v1 || v1)));
+            a0[0] = (((i4 - i4) && (a0[12] != v3)) || ((v0 || 51) > (v0 != a0[1])));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    v3 = (((a1[0][7] ? v3 : v0) && (69 % 7)) - ((v1 + v2) || (v0 != a0[15])));
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    a1[1][12] = (((11 != 97) < (15 || v0)) + ((33 != v3) > (a1[0][14] / 5)));
+                    v0 = (((v1 == 60) || (v3 / 2)) + ((v2 > a1[0][14]) > (56 - a0[4])));
+                    v1 = (((i7 % 5) <= (a1[2][7] != v2)) % 1);
+                    i7 = i7 + 1;
+                }
+            }
+            a1[2][13] = (((v1 || 11) > (a0[4] != 51)) < ((v3 != v3) / 8));
+            v2 = (((v1 ? v3 : 56) < (v1 && v2)) * ((v2 >= v2) <= (87 < 30)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((47 >= a1[1][5]) || (a1[3][8] - a0[8])) - ((a0[0] == v2) ? (a0[15] && 41) : (v2 > a1[2][0])));
+}
+int f1() {
+    int v0 = 98;
+    int v1 = 54;
+    int v2 = 68;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 + a0[2]) * (v2 * v1)) >= ((57 % 1) < (v3 ? v2 : v2)))) {
+        v3 = (((27 ? a0[4] : v0) ? (v0 % 3) : (v1 % 5)) != ((a1[2][9] ? 51 : v2) > (v2 != a0[12])));
+        a1[3][6] = (((v2 < v3) <= (96 == a0[1])) - ((12 > v0) < (35 || v2)));
+        v0 = (((v3 - a0[7]) ? (v1 * a1[2][7]) : (v2 != 0)) < ((v2 * v2) == (v1 % 8)));
+    } else {
+        v0 = (((v2 ? v1 : v0) - (a1[1][7] && a1[3][12])) / 1);
+        v0 = (((v2 * v3) <= (33 % 3)) ? ((v1 % 5) % 1) : ((v1 || v0) ? (v0 == a0[10]) : (v3 > v3)));
+        a1[0][12] = (((a1[0][6] == v0) && (60 <= v2)) / 8);
+    }
+    if ((((a0[7] && a1[2][2]) > (7 ? 5 : 12)) || ((17 / 9) == (a0[7] == v3)))) {
+        a1[1][4] = (((a0[8] ? v1 : v0) || (v3 && v3)) >= ((v2 ? a1[2][12] : 5) > (v0 <= v2)));
+        v0 = (((42 % 9) % 6) + ((v1 == v0) < (v0 - v2)));
+        v1 = (((92 + v2) * (a0[13] ? v2 : 59)) ? ((a1[3][10] / 4) * (a1[3][13] < a1[2][15])) : ((a0[8] > a0[7]) % 3));
+    } else {
+        v1 = (((61 ? a0[9] : v2) * (a0[4] % 7)) % 6);
+        v3 = (((69 || a1[3][14]) + (v3 + v2)) < ((v3 - v3) >= (v3 < v0)));
+        v1 = (((v1 == a0[10]) / 4) % 6);
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v1 = (((v0 + v2) || (v3 - 98)) && ((2 == v0) <= (v2 < a1[1][5])));
+        v0 = (((i0 > 3) && (v2 < v1)) > ((v3 ? v3 : a0[14]) % 7));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v2 = (((v1 || a0[9]) || (v3 <= 55)) && ((a1[3][8] - i0) % 5));
+                v1 = (((a1[0][1] && 46) > (v1 - v0)) > ((v1 - 59) - (v3 > v0)));
+                v0 = (((v1 != 29) < (v1 * i1)) * ((26 <= i0) ? (i1 > 23) : (a0[0] ? i0 : a0[5])));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    v1 = (((v1 ? v1 : 5) >= (v0 <= v2)) >= ((a0[6] - a0[13]) != (v3 * v0)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                if ((i2 + 4) > 58) break;
+                a0[10] = (((v1 <= i2) != (v0 <= 95)) + ((v3 != i2) >= (a0[8] >= a0[12])));
+                v3 = (((73 || v2) >= (i2 <= i3)) % 7);
+                v1 = (((v3 % 8) == (45 * i3)) && ((a0[5] ? a0[5] : 60) && (78 ? a1[3][2] : a0[15])));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((v1 >= a1[1][1]) ? (a1[1][8] % 3) : (37 ? 1 : i2)) >= ((59 < i2) < (v3 * 60)));
+        a0[2] = (((47 || v1) <= (i2 % 9)) + ((81 < 61) <= (60 < a1[0][10])));
+    }
+    return (((18 == a1[2][15]) * (3 > v3)) || ((v1 + v2) / 6));
+}
+int f2() {
+    int v0 = 34;
+    int v1 = 98;
+    int v2 = 61;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((15 * v2) > 52) break;
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            a1[3][10] = (((v3 >= 32) > (a0[15] || 72)) != ((v1 + 82) > (i0 < v2)));
+            v3 = (((58 + v0) ? (35 != 92) : (a1[3][6] ? 71 : i1)) <= ((62 ? i1 : i1) % 9));
+            v1 = (((a0[0] ? 1 : 38) == (v0 * i0)) >= ((56 % 6) >= (v3 * a1[2][12])));
+        }
+        v1 = (((i0 == a0[6]) >= (15 > a0[5])) && ((v1 + a0[6]) == (51 >= a1[3][13])));
+        a0[14] = (((72 == 61) ? (a0[14] >= v1) : (47 ? v3 : a0[0])) % 2);
+    }
+    v3 = (((v2 * a1[0][3]) - (v2 && 91)) > ((a0[2] >= v1) < (a1[2][9] != 30)));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[7] = (((v0 != v3) + (a0[12] ? v0 : v2)) && ((v2 / 1) >= (i2 >= 62)));
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                v0 = (((i2 ? i2 : 94) <= (v1 - v3)) / 5);
+                v3 = (((i2 >= v0) && (a0[4] || a0[0])) > ((64 * v3) <= (v2 >= v0)));
+                v2 = (((47 * v3) - (i2 ? a1[1][13] : 83)) >= ((a0[9] && i2) % 4));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v0 + 83) || (a0[12] + a1[3][5])) ? ((a1[2][15] <= a1[1][9]) < (i2 + v1)) : ((v1 || v0) % 8));
+    }
+    if ((((v1 >= 94) && (a0[11] ? v0 : a0[7])) > ((a1[3][11] && 77) / 6))) {
+        v0 = (((a0[5] - a0[15]) == (23 * v0)) * ((v2 * v2) / 5));
+        a0[8] = (((2 < v1) <= (68 - a1[2][9])) + ((v2 && a1[1][6]) && (v3 <= v2)));
+        a1[1][10] = (((v0 % 2) <= (v3 && v1)) % 9);
+    } else {
+        v3 = (((v0 / 1) ? (v0 ? a0[13] : v0) : (v1 - a0[5])) ? ((v2 != v0) <= (v1 / 1)) : ((v0 <= v3) * (37 ? v2 : v3)));
+        a1[0][11] = (((a1[0][15] % 2) + (a1[3][12] - v1)) > ((v2 ? v2 : a1[1][8]) / 6));
+        a0[10] = (((64 % 1) - (a0[5] > a1[1][12])) + ((v1 && v0) * (a0[3] >= v1)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a0[12] = (((a1[2][2] ? 4 : a1[0][8]) != (v1 != v3)) >= ((a0[3] || v1) >= (a0[11] <= 90)));
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            if ((v3 - i4) > 99) break;
+            v2 = (((v1 || a0[11]) <= (98 * i5)) * ((96 % 5) && (i5 || a1[0][12])));
+            v3 = (((v1 ? a1[1][12] : v3) - (i5 > i4)) != ((i5 || v0) != (v3 + v0)));
+            a1[2][10] = (((v1 + 32) ? (a1[1][2] ? v0 : v0) : (a1[2][3] + i5)) > ((v3 >= 24) + (v2 <= i4)));
+        }
+        a0[2] = (((i4 != a0[3]) || (a1[0][2] != v3)) ? ((v2 != v0) != (a1[1][10] < v3)) : ((v0 * v1) == (33 == a0[12])));
+    }
+    return (((a1[1][15] + v2) < (a0[14] && a0[1])) != ((a1[0][7] < a1[1][5]) ? (v2 % 3) : (a1[1][5] < 48)));
+}
+int main() {
+    return 0;
+}
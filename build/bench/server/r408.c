@@ -0,0 +1,65 @@
+int f0() {
+    int v0 = 55;
+    int v1 = 76;
+    int v2 = 83;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((70 - a0[9]) > 85) break;
+            v1 = (((v3 / 9) ? (50 || 49) : (v1 + 7)) ? ((v1 || v2) ? (v3 && v0) : (43 == i0)) : ((54 * a1[1][8]) - (38 % 3)));
+            v0 = (((65 != v3) < (a1[1][0] <= 87)) ? ((v2 / 8) != (v0 || v0)) : ((79 >= a1[3][6]) / 3));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v3 = (((a1[0][3] || i0) * (v3 > a1[2][11])) && ((18 < a0[7]) + (33 != i0)));
+                    v3 = (((i1 > v1) * (a0[12] > i0)) && ((v3 / 7) > (6 - a1[2][8])));
+                    v3 = (((a1[2][6] > a0[3]) ? (a1[0][11] >= i0) : (16 > a0[12])) || ((v3 >= v2) > (46 * a1[0][4])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v0 = (((i2 * a1[2][3]) / 7) % 2);
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    if ((v2 >= a0[4]) > 58) break;
+                    v0 = (((a1[2][8] || v1) != (a0[1] >= a0[10])) > ((a0[7] + i2) + (a0[3] > v0)));
+                    v0 = (((44 || 51) <= (a0[0] * a1[2][7])) ? ((46 / 2) ? (i2 || v0) : (a1[0][13] ? v2 : 82)) : ((a1[0][7] < i3) / 9));
+                    a1[2][0] = (((8 % 8) && (a1[3][0] > 88)) * ((a1[1][8] - v0) ? (i3 < v1) : (v1 != v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[1] = (((i2 < 73) * (i2 * v3)) % 4);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((v3 / 2) > 74) break;
+        {
+            int i5 = 0;
+            do {
+                if ((a0[13] / 1) > 81) break;
+                v0 = (((v2 != a1[1][1]) != (84 >= v0)) ? ((i5 + v1) + (7 > 74)) : ((i5 > a1[2][1]) == (v2 && i4)));
+                a0[12] = (((v3 != i5) && (v2 > v2)) == ((62 > i4) > (v1 < v2)));
+                v0 = (((62 > 5) || (v0 % 8)) && ((i5 != i4) != (a1[0][6] <= 94)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v2 = (((v3 % 4) >= (v1 % 6)) / 7);
+        v0 = (((74 < a1[3][15]) || (v1 / 9)) - ((25 >= a1[3][8]) && (85 >= a0[5])));
+    }
+    a0[6] = (((56 ? v2 : 19) % 3) * ((a1[1][14] - v1) ? (v3 && v3) : (a0[13] && v3)));
+    v2 = (((a0[7] >= 94) <= (v1 ? v2 : v2)) && ((v2 ? 43 : v3) ? (v0 + v0) : (a0[11] || a0[0])));
+    return (((v3 % 7) * (78 - 14)) > ((a0[14] * a1[2][9]) % 3));
+}
+int main() {
+    return 0;
+}
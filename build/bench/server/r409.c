@@ -0,0 +1,150 @@
+int f0() {
+    int v0 = 42;
+    int v1 = 18;
+    int v2 = 78;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a1[2][1] = (((v1 * 80) ? (i0 ? 42 : a0[1]) : (44 < v1)) % 4);
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                if ((v0 / 5) > 88) break;
+                v0 = (((i1 ? 62 : i1) >= (52 > v2)) >= ((98 || v2) % 1));
+                v0 = (((i0 || a1[1][13]) ? (97 != 87) : (v0 * i0)) + ((v1 % 1) * (a0[14] != 55)));
+                v3 = (((a0[9] + a1[1][11]) > (56 + i1)) != ((38 || a1[2][11]) && (i0 > i1)));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((v2 - a1[2][2]) > (v0 || v3)) || ((51 / 1) % 1));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    if ((3 && v1) > 91) break;
+                    v3 = (((v1 * 94) <= (v2 > v3)) != ((v2 / 1) ? (a0[5] / 8) : (i2 < 83)));
+                    v1 = (((76 >= a1[1][3]) <= (v3 * v1)) - ((i3 * 89) / 5));
+                    a1[2][15] = (((v1 && a1[1][9]) <= (v1 && i2)) ? ((v2 ? v1 : i2) || (i3 && 59)) : ((88 < a0[14]) ? (v1 <= a0[6]) : (41 != v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a1[1][14] != v1) < (a1[0][8] ? 4 : v3)) > ((a1[2][7] + 81) && (65 * v1)));
+            v2 = (((v0 ? v2 : v0) > (v3 == v2)) > ((v0 * a0[8]) * (v0 == i2)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    v2 = (((a1[0][5] ? v0 : a1[3][5]) == (v1 ? v2 : v3)) < ((35 <= a0[14]) && (v1 % 7)));
+    if ((((v1 / 1) < (a0[15] * 8)) % 4)) {
+        v2 = (((v3 % 2) - (v2 / 2)) < ((35 >= v2) - (a0[4] * v1)));
+        v3 = (((v0 ? v2 : v0) + (44 ? 26 : v0)) - ((v3 || 47) <= (v2 - 47)));
+        v3 = (((a1[3][1] ? v2 : 62) || (35 * a0[2])) + ((5 <= v3) == (v3 != a0[6])));
+    } else {
+        v1 = (((a0[0] % 5) || (v0 != 65)) < ((v1 - a1[2][9]) + (a1[1][3] || 84)));
+        v1 = (((v0 >= a0[13]) && (a0[1] ? a0[0] : a1[3][15])) >= ((7 ? 58 : a0[13]) && (98 % 8)));
+        v3 = (((v2 ? a1[0][4] : a0[10]) - (v0 || v0)) == ((13 || a1[0][11]) <= (v3 * a1[0][1])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v2 >= a1[0][8]) >= (i4 >= 73)) >= ((72 < v3) <= (a1[3][10] || 97)));
+                    v2 = (((v1 % 5) == (a1[2][4] != v1)) < ((a1[3][15] + i5) / 8));
+                    a1[0][1] = (((a0[7] / 9) ? (a1[1][6] ? a1[3][7] : 72) : (i4 > a1[0][1])) < ((v0 + v1) && (42 ? v2 : a1[3][9])));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            a1[1][2] = (((20 <= 13) > (v0 ? a1[3][8] : v2)) == ((v2 ? v3 : a0[8]) > (v1 + v2)));
+            v3 = (((a1[2][13] <= 17) / 4) && ((v2 >= v2) > (a1[1][5] * 92)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[0] - a0[11]) * (v3 ? 93 : v3)) ? ((v0 % 1) * (v0 && v1)) : ((v1 % 6) ? (a0[0] % 1) : (83 ? 21 : v2)));
+}
+int f1() {
+    int v0 = 13;
+    int v1 = 9;
+    int v2 = 24;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v3 = (((10 || a0[8]) > (v2 > a1[0][9])) - ((a0[5] - v1) > (v2 / 1)));
+                    v1 = (((v1 * 79) > (i0 != a0[2])) > ((99 || a0[12]) / 9));
+                    v0 = (((v0 + v2) ? (36 / 5) : (i1 + v2)) % 6);
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((i0 / 8) >= (a0[13] != 76)) % 4);
+            v0 = (((v1 - 8) * (a0[7] - 70)) * ((v1 < a1[0][7]) >= (a1[3][4] == i0)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 == v3) + (48 / 5)) < ((a1[1][13] - v2) <= (64 * 97)))) {
+        v3 = (((29 != v0) || (v1 >= v1)) ? ((a0[10] + a0[14]) > (a1[1][11] || v1)) : ((v3 >= v3) * (35 * v2)));
+        a1[3][9] = (((v3 % 1) * (a0[7] % 2)) ? ((a0[15] * 67) ? (v1 || a1[3][9]) : (v2 % 9)) : ((v3 ? v0 : v2) + (v1 ? v2 : 75)));
+        v2 = (((23 / 9) || (40 >= v0)) + ((a1[2][0] ? v2 : a1[3][2]) > (a1[2][2] != 32)));
+    } else {
+        v2 = (((v1 >= a1[2][10]) > (v3 % 3)) - ((v3 != v3) >= (v3 || 67)));
+        v1 = (((41 / 6) != (a1[0][6] ? 69 : v0)) || ((v1 + v2) != (a0[12] / 9)));
+        v3 = (((a1[0][4] ? a0[2] : v0) < (a0[8] ? v2 : a0[7])) >= ((a1[1][2] > a0[4]) >= (25 ? 48 : a1[0][11])));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 == a1[0][13]) > 87) break;
+            v1 = (((v2 > 55) <= (a0[15] ? v2 : v0)) <= ((61 >= v3) != (v1 ? 15 : 64)));
+            v1 = (((v3 % 7) >= (a1[2][12] == v2)) <= ((72 || 28) * (12 ? a1[0][3] : v1)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v0 = (((i2 >= i3) - (36 % 5)) < ((a0[3] ? v2 : i3) % 8));
+                    v0 = (((52 ? 66 : a0[13]) % 1) <= ((v3 >= v1) % 7));
+                    v2 = (((i3 % 5) ? (59 ? i3 : i2) : (v2 || 38)) <= ((24 && 78) || (a0[11] ? 12 : 79)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((v3 >= 1) <= (v1 % 5)) >= ((v3 != 47) ? (i4 / 3) : (i4 <= v2)));
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((66 ? v0 : a1[0][3]) / 6) * ((55 ? 26 : a0[1]) * (40 > 44)));
+                    v3 = (((a1[1][7] > a0[14]) * (94 && i4)) % 3);
+                    a1[2][3] = (((i4 != a1[2][14]) + (27 % 1)) <= ((v0 != i4) + (i4 || 44)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            a0[4] = (((i4 && v2) * (86 - a1[3][4])) != ((i4 - v0) && (v0 < v3)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    if ((((a1[1][2] % 5) == (16 % 3)) <= ((v3 && 51) % 8))) {
+        v0 = (((39 - v2) * (a0[12] < v2)) != ((v2 <= a1[3][11]) < (a0[2] - 38)));
+        a0[13] = (((v1 <= 90) < (v1 + 49)) * ((65 || 21) / 3));
+        v1 = (((11 != a0[10]) || (a1[1][3] > v0)) + ((61 && 88) - (a1[1][0] != v3)));
+    } else {
+        v1 = (((a1[2][9] != a0[12]) == (v3 - a1[2][9])) && ((v1 != a1[2][15]) >= (v2 * v2)));
+        a1[0][14] = (((a1[0][8] == a1[2][11]) < (v3 + v2)) / 6);
+        a0[11] = (((v2 <= 2) ? (v2 + v0) : (a1[2][0] != v3)) == ((17 >= a1[2][1]) != (v2 && 95)));
+    }
+    return (((v1 ? v0 : a1[1][10]) != (v0 + 42)) < ((a1[2][5] == 42) < (v1 >= v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,191 @@
+int f0() {
+    int v0 = 42;
+    int v1 = 67;
+    int v2 = 76;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 % 5) < (v0 >= v3)) <= ((a1[3][13] >= a1[3][4]) || (a1[0][11] > 10)))) {
+        v0 = (((v3 >= v1) < (a0[11] != v3)) <= ((v2 <= 70) == (11 * a1[0][9])));
+        v1 = (((v2 / 3) && (v1 / 3)) + ((a1[1][5] % 8) == (v1 > v1)));
+        a0[12] = (((v2 != a0[11]) * (v0 < 17)) || ((a0[11] - v0) / 5));
+    } else {
+        v2 = (((58 || v1) < (2 + v1)) ? ((v2 ? a0[15] : v3) ? (v1 > v2) : (v2 - v0)) : ((v2 ? v3 : v0) / 9));
+        v2 = (((v1 % 6) >= (v1 - v0)) || ((v0 * 95) + (74 % 7)));
+        v0 = (((v2 == v1) * (a0[13] >= 25)) - ((v3 - a0[15]) <= (v0 + a0[0])));
+    }
+    if ((((a1[3][14] - a1[3][7]) ? (v0 >= 12) : (4 * v1)) < ((a0[1] ? v3 : a0[9]) <= (v0 ? v0 : 92)))) {
+        a0[15] = (((v0 >= 72) * (a0[11] >= v1)) != ((v2 > v0) >= (v0 + a1[1][10])));
+        a0[8] = (((a1[0][3] >= 49) || (a1[0][4] * v2)) ? ((a1[0][10] ? v2 : 23) <= (a1[2][6] ? v2 : 61)) : ((v2 && v2) ? (v2 || v1) : (v1 * 78)));
+        a1[1][2] = (((v3 / 1) || (v3 ? v0 : v3)) / 3);
+    } else {
+        a1[1][5] = (((v3 ? a0[15] : v0) ? (a1[2][15] * 87) : (56 == v1)) != ((v0 / 6) <= (v2 <= v1)));
+        v2 = (((v2 >= a0[13]) && (v3 * 3)) == ((v2 != 99) || (v1 == a0[5])));
+        v0 = (((v1 >= v1) + (v2 * a1[0][7])) ? ((63 > v1) - (v1 % 4)) : ((12 + 38) - (15 != 64)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a1[2][13] = (((v0 ? i1 : i0) <= (v0 || i1)) - ((v0 / 5) <= (v0 && a0[8])));
+            a0[2] = (((a0[3] != a0[5]) <= (96 < 63)) == ((v1 != 3) % 3));
+            v1 = (((37 <= a1[2][0]) || (v1 < v1)) == ((a0[14] <= v2) && (a0[14] >= i1)));
+        }
+        v1 = (((i0 - v1) >= (66 > 45)) ? ((a1[2][4] / 8) + (i0 <= 81)) : ((96 / 2) > (v1 < 66)));
+        a1[1][2] = (((a0[3] % 5) <= (a0[9] * 3)) == ((v0 != i0) > (i0 < v0)));
+    }
+    v3 = (((62 ? a0[1] : v3) % 5) ? ((a0[2] - v2) != (v0 <= a1[1][1])) : ((v0 < v0) - (a0[11] <= 59)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            if ((0 && v1) > 65) break;
+            v2 = (((62 % 9) != (v2 % 6)) == ((82 + a0[0]) == (v2 - 2)));
+            a0[6] = (((14 || 6) * (v3 > v1)) == ((58 - 99) - (v2 % 3)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a0[2] * 90) * (v1 * a1[3][0])) * ((a0[7] > 65) == (a0[12] && a0[7])));
+                    v3 = (((v2 <= 50) && (a0[14] - 12)) ? ((a1[2][6] >= v2) || (v1 > i3)) : ((62 >= 64) - (a1[2][2] - v3)));
+                    a0[8] = (((a1[0][15] || 70) <= (a0[10] != 83)) && ((45 || 16) + (v2 + a1[2][15])));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((v3 != a1[3][11]) && (a1[3][9] >= a1[1][11])) != ((v0 ? v1 : v3) != (v0 ? 11 : 95)));
+}
+int f1() {
+    int v0 = 40;
+    int v1 = 77;
+    int v2 = 14;
+    int v3 = 56;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v1 = (((v0 > v1) == (77 > v2)) / 9);
+                    v3 = (((v2 > a0[13]) != (36 <= a0[0])) ? ((48 <= 97) < (v0 % 8)) : ((v2 <= 93) > (v2 && i0)));
+                    a0[0] = (((v2 * a1[1][5]) < (a1[0][5] > 29)) / 2);
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v1 + a1[2][2]) / 5) >= ((a1[1][1] - v1) - (a1[0][5] <= v1)));
+            v2 = (((4 < v2) && (41 ? i0 : a0[11])) == ((17 > v3) / 5));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((i2 / 2) + (v0 + 51)) == ((v2 / 6) != (a0[5] > a0[4])));
+            v3 = (((17 > 82) == (26 / 9)) <= ((v2 < 52) > (67 < v0)));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v2 * i3) != (a0[7] + v2)) == ((i2 >= 85) / 1));
+                    a1[1][10] = (((i2 ? v3 : v2) - (a1[1][11] < 60)) <= ((a0[4] >= v1) ? (a1[2][7] || 87) : (a0[8] + a0[3])));
+                    a1[1][3] = (((64 > 5) + (a0[15] >= a0[13])) == ((v2 + v2) > (v2 || v2)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v1 = (((a0[13] || a0[13]) != (v2 || a0[12])) % 6);
+    {
+        int i4 = 0;
+        do {
+            v2 = (((37 < v3) ? (i4 > 86) : (v2 != a1[1][4])) * ((i4 < v2) || (6 ? 8 : v3)));
+            v0 = (((a0[0] != a1[3][1]) < (i4 <= a1[2][2])) + ((a1[3][12] != v0) > (v0 + 0)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v1 = (((v1 ? 17 : 29) && (a1[2][12] || 46)) * ((i5 ? 62 : 96) < (v3 && i4)));
+                v1 = (((i5 != i4) > (39 == v0)) / 5);
+                v0 = (((v0 && v2) && (i5 != v2)) ? ((v0 > 39) < (v2 + 0)) : ((v2 % 7) + (a1[0][10] - 81)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v3 = (((a1[3][6] && a1[2][11]) || (v1 < 36)) && ((v3 - v3) / 5));
+    return (((a0[11] <= a0[5]) > (a1[0][5] + v0)) != ((a1[3][5] != 52) * (v2 + v0)));
+}
+int f2() {
+    int v0 = 82;
+    int v1 = 32;
+    int v2 = 24;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((a0[5] ? v1 : i0) > 99) break;
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v0 = (((39 < 48) ? (v0 / 4) : (v2 || v2)) && ((a1[1][4] == v0) != (91 ? a1[3][14] : 39)));
+                a0[6] = (((v1 ? v0 : i0) > (i1 > v2)) ? ((v3 >= a0[14]) + (a1[0][1] - a0[14])) : ((a0[2] >= i0) - (a0[0] + 93)));
+                v3 = (((71 > 90) <= (i0 != 11)) == ((v3 % 6) ? (v3 < v3) : (58 < 19)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[6] = (((77 * i0) / 1) % 5);
+        a0[3] = (((i0 != v2) - (a0[1] ? i0 : v0)) > ((i0 * 37) >= (53 / 6)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a0[15] / 5) - (61 / 7)) && ((i2 ? a1[2][13] : v0) || (65 % 1)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a1[2][4] ? 29 : a1[0][4]) % 3) != ((a1[0][8] ? i3 : i3) > (a0[0] / 3)));
+                    v2 = (((a1[1][10] == v2) == (a0[4] >= v0)) + ((a1[2][14] ? i2 : v2) && (a0[7] || a1[2][3])));
+                    a0[10] = (((13 ? v3 : a0[12]) >= (12 % 7)) != ((a1[1][11] >= 95) ? (v1 || v3) : (v1 == 78)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v2 = (((14 || a1[1][7]) ? (v0 == v3) : (14 && v3)) >= ((80 ? v2 : v0) < (v1 - v3)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        a0[10] = (((14 && i4) != (45 + a1[2][2])) < ((v1 || v0) < (v3 / 3)));
+        a1[0][13] = (((v2 || v1) * (a0[12] * 55)) != ((a1[2][2] * a1[2][6]) || (a1[3][2] != i4)));
+        {
+            int i5 = 0;
+            do {
+                a1[1][3] = (((61 - i4) ? (58 % 6) : (i5 || 93)) % 1);
+                v3 = (((v2 ? 73 : v0) / 5) % 1);
+                v0 = (((20 + v1) <= (v1 && v3)) / 9);
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+    }
+    if ((((v3 * v1) && (53 % 6)) + ((28 ? v1 : 98) ? (88 != v2) : (24 <= v3)))) {
+        a0[8] = (((a1[0][7] - v2) / 2) <= ((8 >= a0[1]) > (44 ? v3 : v2)));
+        v1 = (((v2 ? 72 : v3) <= (v2 != v2)) % 9);
+        v2 = (((v0 >= 24) >= (v0 >= a0[2])) >= ((v1 > v0) == (86 ? v3 : a1[2][15])));
+    } else {
+        a0[15] = (((a0[0] <= 75) + (v3 % 1)) ? ((40 == v1) ? (v2 - v1) : (v2 == a1[2][4])) : ((12 != a1[2][10]) != (v0 < 49)));
+        a1[3][1] = (((a0[15] % 5) * (v1 < 81)) % 9);
+        a0[5] = (((a0[5] ? 81 : v1) / 1) - ((a1[2][12] && v2) && (23 < 14)));
+    }
+    if ((((v1 % 4) * (a0[3] <= v0)) - ((v0 == v3) - (v1 == a0[10])))) {
+        a0[4] = (((v3 ? v1 : 83) < (v3 || 12)) ? ((a0[8] == v2) == (v1 != a0[2])) : ((v3 + 30) % 2));
+        v3 = (((a1[2][2] / 7) <= (v3 * v3)) > ((41 ? a1[3][3] : a1[2][0]) != (a1[3][10] ? a1[0][4] : v2)));
+        v1 = (((a1[0][1] > 56) <= (76 <= a1[2][1])) ? ((40 ? a0[7] : v2) && (77 ? a1[3][3] : a1[2][15])) : ((a1[3][1] > v2) || (v0 * 47)));
+    } else {
+        v2 = (((a0[1] || v3) > (v0 && v1)) >= ((a1[3][7] ? v0 : v2) != (a1[1][14] != v2)));
+        a0[6] = (((a1[1][14] % 5) >= (a1[2][1] < v2)) + ((a1[0][7] ? a0[6] : 58) % 8));
+        a1[0][3] = (((a1[2][5] > v3) - (v3 >= v2)) > ((v2 == v3) < (90 + 63)));
+    }
+    return (((v3 % 7) * (v0 % 2)) / 5);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
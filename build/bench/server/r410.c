@@ -0,0 +1,157 @@
+int f0() {
+    int v0 = 36;
+    int v1 = 56;
+    int v2 = 19;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 || 84) && (90 || 68)) && ((a1[0][6] > 8) <= (v3 == v2)))) {
+        v0 = (((v1 < v1) + (v2 != a1[3][5])) + ((a0[5] || 54) >= (67 ? a0[8] : 55)));
+        v3 = (((v3 == 2) / 4) || ((a0[4] * v3) <= (v3 ? v0 : a1[0][9])));
+        v1 = (((v1 > v0) != (a1[0][2] && 13)) - ((19 ? a0[12] : a1[0][4]) && (81 <= v2)));
+    } else {
+        v2 = (((v2 / 9) * (v0 ? 3 : v0)) && ((v2 || v0) ? (55 / 6) : (v1 / 7)));
+        a0[6] = (((v0 < v0) != (a0[5] >= v1)) - ((a1[3][8] % 5) < (a0[15] ? a1[0][10] : 16)));
+        a1[0][9] = (((22 > v3) / 2) <= ((v3 || a0[12]) > (v1 < 94)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v0 = (((a1[1][9] * a1[0][3]) <= (v0 ? v0 : a0[1])) == ((i0 && v0) % 6));
+            v3 = (((v3 ? 23 : i0) || (v0 && v3)) != ((v2 ? v1 : 94) % 8));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                a0[13] = (((i0 / 2) >= (a0[3] && i0)) - ((v2 >= v0) < (v0 && 80)));
+                v0 = (((a0[15] ? v3 : 42) + (10 || a0[15])) % 2);
+                v2 = (((v2 - v0) ? (v0 < a0[3]) : (v0 == a1[1][8])) + ((a0[12] * 90) - (a0[2] || 68)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v2 > v0) == (a0[7] != a1[3][1])) ? ((44 != 75) + (v2 && v3)) : ((v1 != 62) <= (v2 > 62)));
+    {
+        int i2 = 0;
+        do {
+            a1[0][12] = (((v2 > a1[0][13]) != (41 > i2)) != ((v1 / 9) == (v3 <= 26)));
+            a1[1][7] = (((47 - v1) < (44 && 16)) != ((a1[2][14] ? v2 : v0) ? (a0[4] % 2) : (a0[4] >= a0[4])));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a0[9] = (((a0[11] ? i2 : i3) ? (a0[2] ? 59 : i2) : (i2 < i3)) == ((13 + v2) / 5));
+                v3 = (((v0 % 2) < (a0[10] ? i2 : v0)) <= ((a0[1] - a1[3][6]) ? (v2 || v0) : (a0[6] && i2)));
+                v3 = (((v2 >= 72) > (a0[0] % 6)) + ((i2 <= v1) > (a1[1][3] < a0[3])));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    v0 = (((v3 / 4) != (24 + v2)) == ((v3 ? v2 : a0[7]) % 6));
+    return (((36 + a1[2][15]) / 2) <= ((89 == v1) == (v1 == a1[2][6])));
+}
+int f1() {
+    int v0 = 32;
+    int v1 = 57;
+    int v2 = 4;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v0 = (((v1 || 47) - (v1 * v3)) % 1);
+            v0 = (((v3 >= v3) * (i0 - 71)) ? ((v3 - a0[11]) >= (a0[4] - i0)) : ((i0 % 9) != (56 < v2)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[1][4] = (((a0[3] || v0) == (61 / 8)) ? ((a0[13] < 1) >= (a1[3][1] < v1)) : ((50 > v0) * (a1[0][13] / 4)));
+                    v2 = (((v2 ? v0 : 44) == (a0[1] % 9)) / 5);
+                    v0 = (((v1 || 14) && (i0 + v1)) == ((a0[10] && i0) - (i1 && i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((17 || v1) > 69) break;
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                a0[11] = (((v2 || i3) % 9) / 1);
+                a0[12] = (((i3 / 1) < (i2 != a0[14])) + ((a0[12] % 7) ? (v3 ? i2 : a0[11]) : (8 && 89)));
+                v2 = (((v0 <= 22) >= (i3 || i2)) >= ((v3 < v1) / 5));
+                i3 = i3 + 1;
+            }
+        }
+        a1[3][13] = (((i2 <= 6) < (7 * 23)) ? ((67 == v3) && (v2 > a0[8])) : ((v3 != a0[4]) <= (i2 < a0[4])));
+        v1 = (((a1[2][1] <= a1[0][13]) < (v2 > v1)) || ((v1 ? v1 : a0[11]) >= (a1[1][3] == 71)));
+    }
+    if ((((77 > a1[2][0]) ? (a0[2] > v0) : (v1 - v0)) != ((v0 / 4) && (v2 / 9)))) {
+        v0 = (((v3 % 2) == (v1 != v3)) != ((v2 - v2) > (v2 ? a1[0][10] : v3)));
+        v3 = (((a0[3] % 9) == (a1[3][8] >= v3)) >= ((v1 * v1) - (v2 ? v1 : v0)));
+        v3 = (((a0[2] == 2) * (a0[6] >= a1[0][12])) / 7);
+    } else {
+        v3 = (((v3 / 2) != (a0[1] < 71)) >= ((v3 * 70) == (v0 > v0)));
+        a1[1][5] = (((58 + a0[12]) % 6) != ((a0[6] % 4) < (a0[13] ? v2 : 34)));
+        v1 = (((27 / 1) <= (v1 / 8)) ? ((a0[13] >= 33) || (v2 <= v1)) : ((a1[2][0] == v3) ? (a0[15] != a1[3][9]) : (31 || a1[1][8])));
+    }
+    if ((((69 / 9) ? (v0 <= 58) : (86 > 97)) ? ((a1[0][9] != a1[0][2]) < (38 == a0[12])) : ((v1 + 90) == (a1[3][6] % 5)))) {
+        v0 = (((a1[1][7] * a0[5]) <= (a1[2][4] && v2)) != ((95 % 4) != (a1[0][15] != 98)));
+        v3 = (((18 % 1) / 6) * ((v2 <= a1[0][2]) % 5));
+        v0 = (((v1 < v0) - (81 - v3)) <= ((v2 ? v2 : v2) < (a0[14] / 3)));
+    } else {
+        v3 = (((40 / 1) <= (32 - 51)) * ((26 < v1) - (a0[4] < v2)));
+        a1[2][15] = (((a0[9] / 4) || (v2 - v3)) > ((v2 <= v3) / 8));
+        v0 = (((a1[0][3] - a1[0][7]) >= (a1[0][1] > a0[4])) < ((v2 || a1[2][6]) - (v1 && v2)));
+    }
+    v2 = (((v3 ? v3 : v3) + (v0 && v3)) - ((v3 / 4) != (v0 == 64)));
+    return (((v3 && v3) > (v1 ? 1 : v2)) <= ((5 && a0[8]) ? (a1[1][4] + 25) : (a0[5] % 9)));
+}
+int f2() {
+    int v0 = 23;
+    int v1 = 7;
+    int v2 = 29;
+    int v3 = 48;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                if ((13 ? v2 : a0[10]) > 55) break;
+                v1 = (((a0[6] == i1) || (a0[11] < a1[3][13])) ? ((i0 || a1[3][7]) >= (a0[14] - v3)) : ((i1 != v3) ? (31 == i0) : (v3 != a1[1][2])));
+                a0[3] = (((v1 <= v3) != (92 ? 27 : a0[3])) != ((i0 > 64) && (a0[15] && 86)));
+                a1[1][5] = (((i1 ? v3 : a1[3][11]) / 7) && ((a0[9] * i0) && (64 && 91)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v3 = (((v1 >= a1[2][0]) / 3) + ((12 >= v0) / 2));
+        v1 = (((52 * 10) % 7) + ((59 ? a1[2][7] : v2) ? (v3 <= i0) : (20 ? v3 : 50)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v2 = (((v3 || 78) <= (v0 != v1)) * ((a1[3][11] && a0[8]) || (22 || i2)));
+        a0[9] = (((v0 * a0[14]) == (53 * a0[0])) != ((v0 / 9) ? (a0[14] == i2) : (v2 + v2)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                if ((77 || v1) > 84) break;
+                v1 = (((a1[3][8] % 9) ? (7 % 8) : (a0[2] / 9)) ? ((a0[13] != 89) - (a1[3][1] + v2)) : ((v0 <= v0) < (i2 ? 64 : 7)));
+                v1 = (((v0 > i3) >= (v0 >= 71)) ? ((a0[8] ? i2 : a1[0][2]) == (32 ? a0[4] : v0)) : ((a1[0][15] <= 62) - (a0[6] ? v3 : v1)));
+                v0 = (((i2 * a1[0][5]) && (v2 < v1)) % 9);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v1 = (((v1 <= v0) - (40 - v0)) == ((35 && a1[3][14]) ? (v0 <= a1[2][0]) : (v0 != a1[3][14])));
+        for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+            if ((i5 || i5) > 80) break;
+            a0[0] = (((53 * i5) >= (v0 ? 19 : 83)) < ((i4 < a0[13]) * (i4 + 0)));
+            v2 = (((i4 != 23) + (43 - i5)) || ((v0 * 9) || (a1[2][2] && i4)));
+            v2 = (((v2 && a1[0][7]) != (i4 ? 6 : v3)) / 1);
+        }
+        a1[2][6] = (((v1 <= 90) == (65 > v0)) < ((i4 || i4) % 9));
+    }
+    v3 = (((29 * 96) >= (76 % 7)) % 1);
+    v2 = (((10 >= v1) && (a0[10] > 99)) * ((a1[0][15] || 90) != (a0[8] ? v1 : 33)));
+    return (((v1 / 1) % 8) >= ((a1[1][12] + v2) / 6));
+}
+int main() {
+    return 0;
+}
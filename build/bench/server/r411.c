@@ -0,0 +1,50 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 32;
+    int v2 = 69;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 < 59) / 3) / 3)) {
+        v3 = (((86 ? 26 : 61) ? (v1 ? 37 : v1) : (v2 > v3)) > ((a1[3][15] <= a0[6]) * (v1 * 51)));
+        v2 = (((89 < v3) ? (23 >= v3) : (v2 * 87)) < ((a1[0][13] > a1[3][1]) <= (v0 % 4)));
+        v2 = (((v3 != v1) <= (a0[10] <= v0)) || ((26 >= a0[3]) != (v1 && v1)));
+    } else {
+        v0 = (((v3 - 14) && (54 ? 4 : a0[13])) > ((12 ? v0 : v3) >= (a0[12] * a1[3][9])));
+        a1[2][1] = (((v2 || 18) <= (v1 ? a1[2][5] : a0[11])) / 4);
+        v0 = (((81 == 71) < (v0 > a1[0][5])) || ((a0[0] / 5) || (a1[0][5] ? 21 : 13)));
+    }
+    v1 = (((v1 && a1[2][7]) * (22 * v1)) >= ((v1 != a0[12]) - (57 > a1[0][4])));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((69 || a1[1][15]) > 61) break;
+        a1[2][15] = (((19 ? v0 : i0) != (v1 == v1)) <= ((v3 == 82) != (50 + a1[1][10])));
+        {
+            int i1 = 0;
+            do {
+                v2 = (((25 == 69) <= (v0 % 9)) % 2);
+                v1 = (((13 + 92) && (i0 && 68)) ? ((v0 ? i1 : v0) - (v3 < a0[1])) : ((a0[5] % 2) / 8));
+                v2 = (((v1 && 52) % 6) > ((i0 - v0) || (i1 < v3)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v1 = (((71 % 6) > (a1[1][3] && v0)) > ((v0 * v2) % 3));
+    }
+    a0[13] = (((v3 < a1[3][12]) < (v0 < v2)) || ((72 ? a0[7] : v2) >= (v1 ? 88 : v0)));
+    {
+        int i2 = 0;
+        do {
+            a1[2][10] = (((1 < a1[2][7]) == (a0[0] || v1)) - ((v0 >= a0[3]) != (v1 == i2)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v1 = (((64 * v2) || (v1 || 96)) && ((72 ? i3 : v0) ? (a1[2][11] * 18) : (i2 / 1)));
+                v3 = (((a1[1][9] >= v2) > (98 * v2)) >= ((a1[2][10] == a1[1][10]) + (i2 < a1[0][1])));
+                v1 = (((i2 > a1[1][5]) == (a0[15] < v2)) - ((a0[12] >= 52) ? (30 + v1) : (v0 && v3)));
+            }
+            a1[1][10] = (((a0[0] + 27) != (a1[2][1] / 8)) ? ((v3 > 65) - (v2 * v2)) : ((a0[10] - i2) - (v0 >= a0[5])));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    return (((61 || 15) < (a1[2][1] + v2)) < ((23 ? a0[14] : a0[3]) % 7));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,102 @@
+int f0() {
+    int v0 = 67;
+    int v1 = 86;
+    int v2 = 62;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 < a1[3][11]) ? (v1 < v2) : (v3 % 2)) > ((v1 <= a1[1][1]) - (3 < 86)))) {
+        v2 = (((v0 / 5) < (a0[10] != v3)) == ((a1[2][3] && v2) % 2));
+        a0[8] = (((v3 == v2) - (v0 < v1)) ? ((a0[5] <= a0[9]) != (a1[3][15] > v1)) : ((a1[2][5] >= v0) / 5));
+        v0 = (((a0[6] < 13) <= (71 == v3)) + ((90 - v1) ? (v3 - 48) : (88 / 3)));
+    } else {
+        a0[9] = (((v2 != a1[2][12]) <= (a1[1][7] / 6)) <= ((v2 <= v3) < (75 % 4)));
+        a1[3][9] = (((95 ? v1 : v1) > (13 && v1)) == ((v0 == v1) ? (v1 ? v3 : 76) : (v2 == 23)));
+        v0 = (((v2 * v1) == (a1[3][5] >= a1[3][1])) <= ((v2 + v2) ? (v0 <= 57) : (v1 == a1[1][2])));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a0[6] = (((a1[1][6] <= v0) / 2) == ((a0[15] * 90) || (i1 / 7)));
+            a1[0][9] = (((i0 == a1[0][9]) >= (a0[2] < v0)) % 7);
+            v3 = (((v1 >= v2) % 2) && ((v2 % 3) != (v1 > i0)));
+        }
+        a1[3][0] = (((v0 / 7) != (v0 % 1)) >= ((33 / 4) != (43 || v2)));
+        v2 = (((v3 - v2) || (v0 + v3)) <= ((v3 && v2) || (5 >= 1)));
+    }
+    v2 = (((a0[7] && v1) ? (v2 / 2) : (v3 != v0)) % 6);
+    v2 = (((a0[12] || 39) ? (a0[3] && a1[1][3]) : (a0[11] != a1[2][15])) ? ((a0[6] - v2) / 9) : ((94 >= v1) <= (v0 / 3)));
+    {
+        int i2 = 0;
+        do {
+            if ((94 > 8) > 92) break;
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((39 || i2) ? (a1[2][9] / 4) : (v2 ? i3 : a1[0][1])) / 3);
+                a0[10] = (((v2 / 7) > (v2 >= 83)) % 1);
+                a0[13] = (((56 != 97) > (i2 == v1)) && ((v1 % 9) >= (a1[2][9] == i2)));
+            }
+            a0[5] = (((a0[7] <= v3) < (v1 < v0)) || ((4 ? a0[12] : v0) % 6));
+            v3 = (((v1 ? a1[1][9] : v0) % 7) / 7);
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    return (((a0[5] >= a1[3][1]) < (v3 / 8)) || ((v2 && v2) < (v0 != v1)));
+}
+int f1() {
+    int v0 = 65;
+    int v1 = 21;
+    int v2 = 26;
+    int v3 = 60;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((90 < a0[12]) && (a0[6] ? v1 : v2)) && ((v3 % 9) == (v0 == 13)));
+    if ((((a1[2][0] >= 21) ? (a1[1][13] && a1[2][6]) : (v2 || 73)) >= ((82 - 45) > (v0 < a0[2])))) {
+        v0 = (((v3 % 7) > (a0[1] == a1[0][12])) && ((a0[14] <= v2) ? (v3 % 8) : (v1 <= v0)));
+        a1[1][4] = (((57 ? v2 : a1[1][15]) <= (v2 || 41)) == ((v2 + a1[2][14]) != (v1 - v0)));
+        v2 = (((v0 - 77) != (73 + 89)) == ((67 != v0) ? (6 % 2) : (v1 != v2)));
+    } else {
+        v3 = (((a1[0][0] >= a1[2][2]) > (a0[13] - v2)) / 2);
+        a0[13] = (((v1 % 6) / 5) < ((52 / 7) && (v3 + v3)));
+        v1 = (((v1 * v0) / 4) * ((v3 % 6) ? (a1[2][7] ? v3 : 15) : (v1 % 7)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a1[0][9] = (((i0 < a0[6]) <= (v2 && v3)) / 5);
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v1 = (((v2 - v0) == (v1 ? a1[0][9] : v2)) || ((v2 == 80) < (i1 == v3)));
+                    a0[7] = (((v1 + 75) < (a1[0][1] && i1)) ? ((51 / 2) <= (a0[2] || a0[14])) : ((i0 > v2) <= (65 + i1)));
+                    v0 = (((1 || 34) >= (91 || 54)) * ((v1 == v2) != (v0 % 2)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a1[0][15] > a1[0][10]) || (a1[1][2] || v1)) * ((45 || a1[3][1]) || (80 + v1)));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v2 + 56) - (a0[15] + v1)) >= ((18 == v3) * (a0[6] <= v1)));
+    {
+        int i2 = 0;
+        do {
+            if ((a0[6] == a0[0]) > 58) break;
+            v3 = (((a0[2] / 6) > (v2 || 45)) ? ((a1[0][0] % 9) ? (a0[4] < a1[0][11]) : (v0 == 37)) : ((v0 != v0) == (69 * v1)));
+            v0 = (((a1[3][3] > 99) > (2 * 24)) || ((v3 == a0[3]) && (74 <= v1)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((i2 * i2) > 76) break;
+                    v3 = (((i2 * a0[7]) <= (73 != a1[0][14])) > ((a1[1][14] >= a1[1][6]) && (a1[3][3] <= i2)));
+                    v3 = (((i3 - 15) * (a0[0] > a0[5])) > ((35 >= i2) ? (v2 < v2) : (v1 + i3)));
+                    a1[3][7] = (((i2 / 7) && (i3 >= a0[0])) + ((a0[9] > 1) ? (69 || i2) : (11 ? v0 : i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((v3 == a0[1]) || (61 ? a1[3][6] : a1[1][2])) || ((72 >= 55) <= (v1 >= v2)));
+}
+int main() {
+    return 0;
+}
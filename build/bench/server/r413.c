@@ -0,0 +1,190 @@
+int f0() {
+    int v0 = 64;
+    int v1 = 57;
+    int v2 = 69;
+    int v3 = 58;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v0 = (((70 % 4) && (99 || a1[2][10])) >= ((a1[3][7] / 2) == (39 > 12)));
+            v1 = (((v3 ? 56 : v2) && (a0[7] <= a1[3][15])) <= ((v2 < i0) && (68 == 75)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((a1[2][2] && a0[5]) <= (i0 || a0[11])) >= ((11 == 7) % 8));
+                    a0[2] = (((v2 != i0) < (a0[0] + 7)) ? ((i1 == i0) <= (v2 == a1[2][1])) : ((v2 ? v1 : a1[0][15]) && (v1 ? v2 : v2)));
+                    v2 = (((v0 || v0) && (a0[5] != i0)) ? ((41 ? 20 : a1[0][11]) + (v0 % 1)) : ((v1 ? v0 : 64) * (i0 ? 26 : i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a0[4] = (((v0 == a0[5]) ? (v1 && a1[0][2]) : (13 / 1)) % 4);
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v0 = (((v3 && v2) + (a0[10] / 1)) % 8);
+                v0 = (((82 && a0[0]) + (i3 == a0[0])) && ((i3 - i2) * (v1 / 8)));
+                v3 = (((a1[1][12] ? 76 : v3) * (a1[3][7] / 5)) + ((31 - v1) / 7));
+            }
+            v3 = (((a0[6] <= a1[2][12]) > (i2 ? i2 : v2)) || ((v2 <= 22) || (v2 ? v2 : v2)));
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((34 && 88) / 7) + ((a0[15] <= a0[5]) * (a1[3][4] ? v3 : a1[1][15])));
+    if ((((a0[13] ? a1[1][13] : v2) - (v0 || a0[15])) == ((v3 >= a0[4]) < (79 * v1)))) {
+        v3 = (((v1 < 9) + (27 != a0[12])) || ((a0[7] + v1) >= (49 || 92)));
+        v0 = (((v2 < v1) != (v2 * v1)) && ((v3 % 9) > (a0[14] % 3)));
+        a0[1] = (((v1 + a0[2]) <= (v3 == a1[0][11])) <= ((a0[11] >= 0) ? (79 && 83) : (v0 > 36)));
+    } else {
+        v2 = (((13 || v0) && (34 >= a0[4])) + ((a1[3][9] == v0) || (v2 >= 81)));
+        v0 = (((v2 >= a0[10]) + (75 == 45)) ? ((a1[0][12] * v2) - (v1 && a1[3][6])) : ((v0 * 10) * (88 ? v1 : 22)));
+        a1[1][10] = (((v3 != a0[3]) > (v2 != v0)) ? ((a0[5] * v1) < (v1 < 85)) : ((v2 >= v1) < (v3 + v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v0 = (((v0 || v3) >= (a0[10] > i4)) - ((v1 % 3) == (v2 ? v3 : v2)));
+            {
+                int i5 = 0;
+                do {
+                    a0[4] = (((a1[1][6] * a1[3][0]) > (v0 % 2)) * ((46 / 9) <= (i5 % 8)));
+                    v0 = (((a0[4] > i5) > (a0[11] <= a0[12])) + ((v0 * v0) % 5));
+                    v2 = (((v0 <= v1) - (v3 ? v1 : v0)) || ((v2 / 5) > (v1 == v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            a0[0] = (((v0 == 66) ? (v2 % 9) : (24 + v3)) < ((a0[12] && 55) > (a1[2][2] * v3)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[12] / 9) - (70 / 1)) < ((17 != a0[15]) <= (v1 * 60)));
+}
+int f1() {
+    int v0 = 17;
+    int v1 = 18;
+    int v2 = 36;
+    int v3 = 48;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][3] ? v2 : v2) || (v2 ? a0[5] : 70)) % 4)) {
+        v0 = (((a1[1][13] >= 91) + (a1[1][4] / 6)) < ((v0 < 91) > (v2 - a0[6])));
+        a0[6] = (((a0[15] % 5) || (81 ? 18 : v0)) > ((64 / 5) != (a1[1][15] * v2)));
+        v2 = (((v1 && v3) < (v3 >= v0)) % 2);
+    } else {
+        v1 = (((v1 < v3) ? (a0[1] + v1) : (v3 / 4)) > ((a0[10] - v0) < (12 * a0[14])));
+        v3 = (((a0[7] != 86) * (v1 ? a0[3] : a0[3])) ? ((v1 == v0) ? (19 % 5) : (a1[1][5] * 96)) : ((v1 != 61) == (v1 / 3)));
+        v2 = (((a0[8] ? v0 : v2) < (v0 % 7)) < ((20 ? v0 : v1) < (38 && 87)));
+    }
+    v3 = (((a0[10] != 11) % 5) <= ((a0[12] && v3) ? (a0[8] >= v1) : (v2 && a0[4])));
+    {
+        int i0 = 0;
+        do {
+            if ((v1 >= v0) > 68) break;
+            v2 = (((v0 == v3) >= (34 == a1[1][14])) ? ((a0[13] % 3) % 3) : ((a1[2][3] * v1) > (31 / 6)));
+            v0 = (((a1[0][2] || v3) && (36 != 72)) ? ((29 >= v3) && (a1[2][2] <= v3)) : ((a0[4] > a1[0][7]) <= (i0 <= v3)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v3 = (((v2 >= a1[0][8]) % 2) % 2);
+                    a0[5] = (((a0[15] <= v3) < (v3 % 8)) - ((46 != 68) >= (a0[9] == a1[1][6])));
+                    v1 = (((v3 == i0) >= (v2 % 3)) < ((i1 && v0) && (v2 * i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v0 = (((a0[12] && a1[2][8]) >= (v2 / 4)) ? ((v1 ? a0[10] : a1[1][2]) > (v1 * v2)) : ((v1 <= a1[1][0]) % 1));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v2 = (((i3 == 74) * (v1 ? v3 : 11)) && ((v2 <= v2) * (i3 / 8)));
+            v0 = (((v0 + i3) ? (v3 == 52) : (v3 / 5)) ? ((a1[1][13] || v2) && (98 <= v1)) : ((i3 ? i2 : 87) == (21 - a1[0][11])));
+            v3 = (((v0 != 95) ? (a1[2][0] * v2) : (i2 == a1[0][9])) && ((v0 <= v3) > (a1[2][13] || a0[14])));
+        }
+        v1 = (((v0 < v1) / 5) == ((i2 % 3) >= (v1 <= v1)));
+    }
+    if ((((v1 - v0) ? (a1[0][5] && 76) : (a1[0][9] % 8)) * ((a0[8] % 1) < (a1[0][14] / 2)))) {
+        v1 = (((v0 ? v0 : v0) - (v3 + v1)) * ((81 % 4) <= (v0 >= v3)));
+        v3 = (((99 >= a0[0]) < (v2 > 38)) + ((v3 > 41) ? (v3 / 9) : (90 >= v0)));
+        a1[2][10] = (((v2 > v3) != (v1 || a1[2][14])) % 9);
+    } else {
+        v2 = (((80 || v2) || (a1[1][8] % 6)) + ((95 ? a1[3][13] : v0) ? (v3 + 54) : (v1 <= 22)));
+        v3 = (((a0[6] % 2) ? (v2 || 12) : (10 ? v3 : v1)) < ((a0[7] >= a1[0][3]) / 9));
+        v1 = (((v0 != 6) * (48 - a0[4])) / 6);
+    }
+    return (((v2 ? v0 : v3) == (59 ? v3 : 42)) != ((19 < a1[2][11]) - (v3 + v3)));
+}
+int f2() {
+    int v0 = 64;
+    int v1 = 53;
+    int v2 = 45;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 != v3) * (v3 / 4)) == ((v2 && v3) > (a0[8] * v1)))) {
+        a0[2] = (((55 * v2) <= (60 < a1[2][2])) >= ((v3 >= v2) < (67 ? v3 : 84)));
+        v2 = (((v1 >= a1[1][12]) ? (v2 > 2) : (v1 * 66)) != ((82 ? v1 : a1[1][8]) <= (36 && v3)));
+        a1[1][13] = (((a1[1][3] * a1[0][6]) <= (a1[0][15] != v3)) * ((15 != v1) < (a0[7] ? 56 : 12)));
+    } else {
+        a0[15] = (((29 / 8) != (v3 || v1)) ? ((88 < v2) <= (v3 < v0)) : ((v1 != v3) != (v3 - v3)));
+        v1 = (((v2 > v1) >= (v3 ? 25 : v0)) <= ((v1 + a0[4]) % 7));
+        v3 = (((v1 ? v3 : a1[2][13]) != (4 / 8)) && ((v2 <= v3) ? (36 % 3) : (v2 > 17)));
+    }
+    if ((((v1 ? 87 : v1) / 8) == ((36 > a0[1]) - (v0 ? 80 : v1)))) {
+        v0 = (((58 - v3) + (v0 && 57)) || ((48 && v0) + (a1[1][5] / 8)));
+        v1 = (((a1[1][6] || v3) * (v2 && v1)) - ((a0[10] > v2) < (19 ? a0[11] : v0)));
+        v0 = (((a1[2][7] + a1[3][5]) && (a0[14] - a0[12])) - ((v2 == v2) - (8 % 8)));
+    } else {
+        v0 = (((v0 != v1) || (58 >= a0[13])) - ((80 - 92) ? (v3 ? a0[10] : 83) : (58 <= 99)));
+        a0[9] = (((v3 >= a1[0][8]) + (v0 * v3)) ? ((53 < a1[1][13]) / 6) : ((a1[2][9] && 82) ? (a1[3][0] % 9) : (a0[9] > a0[14])));
+        v0 = (((44 != v3) * (v2 && v3)) - ((93 / 4) <= (a1[0][13] >= v2)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v0 = (((a1[0][13] <= a0[9]) <= (a1[3][0] <= a1[1][1])) > ((v3 - v2) != (v0 != a0[9])));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v1 = (((22 / 4) || (a1[3][6] && i0)) != ((7 != v0) * (v0 <= i1)));
+                v0 = (((31 > i0) * (64 != i0)) == ((a1[3][14] + a1[2][10]) >= (21 != 82)));
+                v1 = (((39 <= 19) >= (i0 * v1)) / 8);
+                i1 = i1 + 1;
+            }
+        }
+        a0[1] = (((v2 && a1[1][14]) && (v0 * a1[1][6])) > ((v3 + 71) ? (a1[1][2] ? v3 : i0) : (a0[13] != a1[1][11])));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v0 = (((26 >= a0[13]) ? (v3 <= v2) : (a1[1][12] || a1[1][12])) && ((50 + v2) < (v3 / 2)));
+        a1[0][3] = (((82 != 73) || (v3 && a0[0])) >= ((i2 % 6) + (10 + a1[2][11])));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v0 = (((v0 % 5) && (v0 == a0[8])) % 4);
+            a0[11] = (((83 * 22) > (2 > v1)) || ((a0[14] / 1) + (66 || v0)));
+            v1 = (((v3 / 8) ? (v3 >= a0[9]) : (v3 || a1[0][8])) > ((63 != a0[3]) % 8));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    a0[6] = (((v1 < v2) ? (i4 < 98) : (a1[3][3] == 41)) && ((7 > 89) > (v2 == i5)));
+                    v3 = (((v1 * v0) + (v3 == i5)) != ((v3 <= i5) && (v2 && v0)));
+                    v2 = (((35 && a0[5]) > (v3 * v2)) == ((66 < i4) * (a1[3][8] != i5)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((a1[1][0] / 5) != (a1[1][2] == 98)) % 7);
+            a1[1][1] = (((i4 < a0[7]) || (a1[1][5] + v2)) > ((a1[3][1] - i4) ? (a1[3][7] < 30) : (a1[3][9] && 71)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    return (((26 / 5) || (20 >= 73)) - ((73 ? 35 : 82) < (v3 < v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,49 @@
+int f0() {
+    int v0 = 5;
+    int v1 = 78;
+    int v2 = 50;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    a1[1][1] = (((a1[0][12] == v0) ? (a0[12] == a1[3][6]) : (a1[1][11] && a1[3][4])) < ((56 != v2) > (a1[2][14] == a1[0][4])));
+    v0 = (((v1 ? v1 : v2) != (v2 && v1)) / 1);
+    {
+        int i0 = 0;
+        do {
+            a1[1][13] = (((v3 == 23) || (v0 <= v2)) || ((i0 < v1) * (24 && v0)));
+            a1[0][14] = (((v0 || a0[3]) > (v3 - 80)) || ((73 / 9) >= (i0 % 4)));
+            {
+                int i1 = 0;
+                do {
+                    a1[0][1] = (((32 * a1[2][3]) % 7) || ((v1 * v0) && (a1[3][7] % 6)));
+                    v2 = (((i0 && a0[11]) < (v3 % 5)) >= ((39 ? 9 : v0) == (v1 == 48)));
+                    a1[0][6] = (((i0 == 69) / 1) ? ((a1[2][10] ? a0[5] : 3) >= (0 > v0)) : ((v0 > a0[13]) + (v1 / 7)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v2 % 4) >= (21 ? v1 : a1[2][8])) % 3);
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((v1 > 6) * (v1 / 5)) < ((v0 ? 14 : v2) == (v3 <= v3)));
+                    v3 = (((50 > i2) >= (40 != 6)) + ((v3 - v0) >= (i3 < i3)));
+                    a1[0][10] = (((i2 != i2) || (a0[11] && a0[4])) && ((v2 / 3) == (a0[5] && v2)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v0 = (((i2 * a0[3]) < (a0[12] - v0)) || ((i2 % 9) && (i2 <= 90)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    a0[3] = (((v1 || v2) > (a1[0][5] > a1[1][8])) < ((v3 / 8) || (v1 < v3)));
+    return (((50 + 94) > (90 ? v2 : a1[3][10])) && ((a0[10] ? v3 : 80) ? (62 > 93) : (4 + v3)));
+}
+int main() {
+    return 0;
+}
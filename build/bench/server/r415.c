@@ -0,0 +1,112 @@
+int f0() {
+    int v0 = 64;
+    int v1 = 98;
+    int v2 = 68;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v3 || v2) >= (11 / 7)) + ((a0[2] != v2) ? (v2 > v3) : (93 / 7)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((v2 * 51) > (v0 != 72)) == ((93 || 64) * (i1 % 7)));
+                    v1 = (((85 ? v3 : a1[0][2]) / 3) == ((a0[0] == v2) == (v2 != i1)));
+                    v0 = (((v1 <= v0) + (v2 ? i1 : 55)) * ((a0[12] || v1) % 5));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v0 = (((v3 > i0) ? (v3 ? a1[1][0] : v2) : (a1[0][10] || i0)) * ((v2 ? a0[13] : i0) && (v1 ? v1 : 11)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v0 = (((v3 * v0) ? (a0[6] ? 7 : 94) : (v0 || a1[3][13])) % 9);
+            v0 = (((v0 / 1) ? (i3 / 7) : (a1[2][0] && a0[8])) == ((5 != v2) / 7));
+            v1 = (((46 >= a1[2][13]) == (v2 != v1)) + ((v3 - a1[1][8]) - (i2 == v2)));
+        }
+        v3 = (((i2 + v0) ? (51 < v0) : (36 != v2)) % 3);
+        a0[4] = (((a1[2][5] > a1[1][4]) || (90 / 7)) < ((98 % 2) || (v1 + 50)));
+    }
+    if ((((a1[0][1] >= a1[1][11]) || (a0[15] != a1[1][1])) >= ((51 - a1[1][1]) >= (62 < a0[11])))) {
+        a0[6] = (((a1[2][5] == v1) + (v1 / 2)) < ((76 <= 79) ? (v3 * v3) : (v0 % 2)));
+        v0 = (((74 == a0[12]) && (95 * a0[11])) * ((a0[13] / 5) || (a0[8] && 5)));
+        v3 = (((v3 || a1[0][15]) > (a0[11] <= v3)) % 3);
+    } else {
+        a0[9] = (((52 || a0[11]) == (v3 >= 49)) / 3);
+        v2 = (((v2 - 66) * (v1 ? 34 : 86)) != ((v1 - v2) == (v1 >= v2)));
+        a0[11] = (((76 % 9) || (a1[3][5] % 4)) <= ((a1[3][4] + v0) == (98 + v0)));
+    }
+    v3 = (((v2 ? v0 : 34) != (v2 <= v3)) != ((v3 * v1) >= (v3 != v2)));
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            a1[3][7] = (((v2 || v3) - (i4 <= 50)) < ((a1[3][14] % 9) <= (a0[0] < a0[5])));
+            v2 = (((i4 == a1[1][15]) / 8) - ((v0 && 85) > (25 - v0)));
+            a0[10] = (((4 == v0) == (v2 > v3)) ? ((a0[14] < v2) - (v0 != v1)) : ((v3 <= i5) > (v1 <= 81)));
+        }
+        a1[0][11] = (((v3 ? a1[3][10] : 7) < (v2 % 9)) >= ((a0[12] + a0[1]) != (3 / 3)));
+        v1 = (((a1[3][15] + 21) + (a0[8] <= v2)) + ((v0 - v2) ? (94 <= v3) : (a1[0][4] * 78)));
+    }
+    return (((a0[14] / 8) >= (48 && a1[3][12])) <= ((v1 - v1) > (89 <= 84)));
+}
+int f1() {
+    int v0 = 46;
+    int v1 = 45;
+    int v2 = 85;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 >= 38) > (v3 / 9)) && ((v0 != v0) <= (a1[0][4] / 1)))) {
+        v1 = (((a1[3][0] * v3) * (a0[0] == v1)) != ((v3 - v2) + (v1 * 81)));
+        v0 = (((44 >= v2) + (55 >= v1)) % 6);
+        a1[3][8] = (((v2 && 28) <= (58 || v2)) * ((v3 * v0) ? (v3 > v1) : (v3 || v3)));
+    } else {
+        v2 = (((v1 >= a0[0]) != (a1[1][13] * v2)) ? ((v3 + v3) && (v0 >= v2)) : ((v1 < v3) - (v3 > a1[1][14])));
+        v3 = (((6 + v2) % 5) ? ((v1 % 9) / 4) : ((a1[2][11] && v1) * (v1 && v0)));
+        v1 = (((a1[1][15] ? v1 : 88) / 7) ? ((24 > v2) ? (a0[10] && v1) : (63 + 91)) : ((v1 != 30) + (5 != a0[11])));
+    }
+    if ((((a1[2][8] != v3) * (a0[4] ? 5 : a0[0])) * ((35 > v1) % 4))) {
+        v3 = (((a1[3][9] != 1) < (0 + 72)) != ((52 >= v0) % 6));
+        v2 = (((20 <= v2) && (v2 && a1[3][8])) ? ((v3 + 65) >= (66 >= 64)) : ((a1[1][10] == v0) - (v0 * a1[0][15])));
+        v2 = (((a0[15] / 2) * (a1[2][4] == v1)) <= ((26 + v3) ? (a1[3][11] - a1[3][13]) : (v3 < v1)));
+    } else {
+        a0[3] = (((77 * v1) >= (a0[15] <= a1[3][7])) && ((v2 + 87) || (v2 % 5)));
+        v3 = (((v3 < v2) || (v1 * a0[0])) >= ((v0 - v1) != (98 >= v1)));
+        a1[1][0] = (((32 % 2) || (v1 >= 41)) % 6);
+    }
+    a0[1] = (((v1 + v1) + (14 * v1)) / 9);
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                if ((i1 / 4) > 90) break;
+                v1 = (((81 <= v2) % 9) % 2);
+                a1[3][1] = (((80 * v0) || (a0[1] / 9)) + ((i1 ? a1[1][7] : a0[12]) + (v0 <= v2)));
+                a0[1] = (((v0 / 6) ? (v0 || a1[3][8]) : (i0 <= i1)) == ((i0 >= i0) == (i1 / 9)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((38 / 3) ? (v0 > a0[0]) : (i0 * 24)) ? ((91 ? v0 : 57) ? (47 && v3) : (v0 || a0[13])) : ((a0[15] / 3) && (v3 && v2)));
+        v3 = (((94 ? v0 : v3) >= (v3 % 9)) > ((v2 || a0[7]) && (i0 > a1[2][10])));
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                a1[2][3] = (((5 / 9) >= (73 + a1[3][0])) ? ((25 < v0) <= (7 || v3)) : ((94 - i2) + (19 && v1)));
+                v1 = (((a1[1][0] % 9) / 6) || ((a1[3][12] > v0) / 9));
+                a1[2][3] = (((v3 != i2) - (v3 < i2)) + ((92 != i3) <= (30 == a0[15])));
+            }
+            v0 = (((66 / 6) || (a0[10] * 54)) ? ((83 <= a0[9]) == (47 && a1[0][9])) : ((46 || 52) < (99 != i2)));
+            v1 = (((a0[5] != a1[1][10]) ? (0 % 3) : (48 - v0)) ? ((v0 && i2) && (32 * v2)) : ((53 * 34) > (40 % 3)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    return (((a0[4] / 4) - (v1 <= v1)) > ((a0[7] ? v2 : 37) >= (v2 % 6)));
+}
+int main() {
+    return 0;
+}
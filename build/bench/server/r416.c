@@ -0,0 +1,149 @@
+int f0() {
+    int v0 = 79;
+    int v1 = 75;
+    int v2 = 75;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[13] != a0[14]) || (v1 || v1)) < ((a0[12] ? a1[2][14] : a0[8]) <= (v2 || a1[0][2])))) {
+        a1[2][1] = (((a0[15] >= 46) && (v1 < v2)) < ((a0[2] % 8) % 4));
+        v2 = (((v0 + v0) >= (a0[4] > v3)) * ((a0[11] || 97) > (v0 - 5)));
+        v0 = (((v2 + v1) * (17 * 35)) + ((48 ? v0 : v0) && (a1[1][7] != 23)));
+    } else {
+        a1[2][7] = (((56 * v0) % 9) ? ((v0 == v2) && (a0[8] >= v3)) : ((v3 ? a0[3] : v0) < (a0[5] < a0[14])));
+        v3 = (((v1 == v0) ? (93 <= v3) : (a0[2] >= v2)) || ((a1[2][11] % 4) ? (v0 >= v2) : (v3 > a0[10])));
+        v3 = (((a1[2][6] + a0[2]) <= (a0[8] == 78)) >= ((a1[1][10] / 9) / 4));
+    }
+    if ((((v2 * v2) && (v1 > v2)) <= ((a0[2] == v2) > (v2 >= v0)))) {
+        v0 = (((v0 >= a1[0][5]) % 8) && ((36 >= a1[1][7]) == (a0[10] <= a1[2][1])));
+        v2 = (((v3 % 4) % 4) != ((95 % 2) != (v0 || v2)));
+        v0 = (((v2 ? a1[1][14] : v1) != (v0 * 63)) - ((a1[0][2] ? v1 : 81) || (30 ? a1[2][2] : v2)));
+    } else {
+        v3 = (((v2 >= a1[2][8]) ? (v0 || a1[1][14]) : (31 > 94)) + ((47 ? v1 : v3) < (4 + a0[9])));
+        v2 = (((a1[3][6] * v2) ? (v2 + 77) : (86 <= v0)) - ((v1 % 6) <= (a0[4] ? 4 : v1)));
+        a0[10] = (((a0[5] / 8) % 2) || ((v3 / 2) > (14 / 9)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a1[0][9] - 38) >= (a0[8] * v0)) * ((i0 < i0) ? (v0 < 82) : (v1 < v3)));
+                    a0[14] = (((a0[7] + v1) < (v3 / 6)) < ((a0[10] == a0[4]) > (81 > i0)));
+                    v1 = (((v2 >= 83) + (a1[3][15] ? v3 : 92)) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v3 = (((v3 && v1) <= (a0[12] == i0)) < ((a1[1][0] / 5) <= (a0[13] * v1)));
+            a0[2] = (((94 % 2) / 4) <= ((a1[3][5] + 97) * (20 || a1[0][7])));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    v0 = (((66 > v2) > (a1[1][7] <= v2)) != ((29 ? v1 : v1) ? (44 < a1[0][10]) : (18 ? v1 : a1[1][12])));
+    v3 = (((a1[2][15] > 78) / 5) % 1);
+    return (((v2 <= a0[4]) && (a1[2][4] == v0)) / 1);
+}
+int f1() {
+    int v0 = 57;
+    int v1 = 63;
+    int v2 = 43;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a0[0] = (((i0 > v2) == (v2 / 1)) != ((82 <= 7) % 8));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            if ((i1 ? i1 : 85) > 69) break;
+            v1 = (((v1 / 8) - (27 / 5)) <= ((8 > 70) > (i1 || 83)));
+            v3 = (((44 < a0[0]) + (a1[3][5] % 1)) >= ((a1[2][1] - a1[3][4]) * (v3 < 47)));
+            a1[2][13] = (((79 ? v0 : 84) || (a1[1][11] && v0)) == ((81 ? v3 : a0[9]) || (a1[0][12] == v1)));
+        }
+        v0 = (((77 - v0) + (a0[1] <= i0)) == ((86 % 2) % 5));
+    }
+    v0 = (((v1 != v3) || (96 < v3)) == ((a0[0] / 5) < (v1 % 8)));
+    if ((((v0 ? v2 : 58) && (15 * v2)) / 3)) {
+        v0 = (((41 >= v3) / 6) % 8);
+        v2 = (((v0 < v3) && (78 / 2)) < ((v3 >= 18) ? (v1 / 1) : (83 <= 49)));
+        a0[5] = (((29 / 7) + (v0 == a0[1])) + ((a0[14] ? v0 : a0[0]) ? (63 + 82) : (a0[2] <= v1)));
+    } else {
+        a1[0][6] = (((a0[8] == v3) < (a1[3][5] * v2)) + ((31 != a1[0][2]) || (v2 || v2)));
+        v2 = (((35 != 58) % 5) ? ((18 * a0[8]) || (79 == v0)) : ((v2 || v3) >= (a1[3][11] * v3)));
+        v0 = (((v1 - v3) + (44 && 40)) >= ((94 <= a0[5]) || (v3 % 9)));
+    }
+    v1 = (((a1[1][8] ? v0 : v2) < (a1[0][11] / 6)) > ((v1 - a0[9]) / 3));
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v3 = (((54 - v2) && (44 ? 74 : i3)) % 9);
+                v2 = (((53 && v3) * (v1 >= 87)) || ((78 || i2) - (80 || a1[2][12])));
+                a1[2][12] = (((v3 / 2) != (82 >= a1[2][9])) && ((a0[10] / 3) * (47 != v0)));
+            }
+            v1 = (((v3 - a1[2][9]) < (a0[3] ? 15 : 32)) + ((90 + a0[13]) * (a0[0] ? a1[3][0] : 13)));
+            v0 = (((v2 - a1[3][2]) ? (87 - 85) : (a0[11] == v0)) - ((a1[0][8] / 6) && (v1 <= v1)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    return (((41 != 82) > (a1[1][15] == a0[14])) > ((a0[4] >= a0[2]) != (v0 > v3)));
+}
+int f2() {
+    int v0 = 79;
+    int v1 = 86;
+    int v2 = 96;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 ? a1[0][9] : v2) > (9 ? v0 : 79)) == ((a0[13] > a0[5]) % 2))) {
+        a0[14] = (((v2 / 2) || (86 ? 4 : 18)) - ((a1[1][8] || a0[8]) ? (v3 - a1[1][13]) : (v0 ? 51 : a0[15])));
+        v0 = (((41 ? v1 : a1[0][14]) >= (v1 >= v3)) % 9);
+        v1 = (((96 > a1[2][12]) > (v1 * 27)) || ((a1[3][8] > 51) < (v3 < 18)));
+    } else {
+        a0[4] = (((82 * a1[3][6]) > (v1 >= a0[10])) < ((15 && v1) - (71 / 1)));
+        v0 = (((v3 != 68) * (a0[12] < 95)) != ((a1[0][10] + 94) * (v2 && v0)));
+        a1[1][12] = (((a1[2][8] > a0[0]) != (a0[13] < v2)) != ((a0[1] <= 97) >= (a0[3] > 60)));
+    }
+    a0[4] = (((v1 / 3) ? (a0[15] != v1) : (a1[2][15] > 29)) % 1);
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((a1[2][13] && 56) > 53) break;
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((99 || v0) > 74) break;
+                a1[3][3] = (((v2 == 84) || (a1[2][8] ? i0 : i0)) && ((a1[0][10] + a1[1][10]) <= (8 - 27)));
+                a1[3][3] = (((v1 % 1) ? (v0 && a1[0][7]) : (82 > v3)) <= ((v0 < i0) <= (84 > v1)));
+                a1[1][11] = (((i0 % 5) + (a1[3][15] ? v3 : 65)) * ((v0 / 4) + (a0[8] || 9)));
+            }
+            v1 = (((v1 != a1[1][9]) / 7) < ((27 % 8) ? (i0 % 9) : (a0[9] - 90)));
+            a1[0][7] = (((12 ? 52 : a1[1][6]) % 7) <= ((v1 == 8) + (v2 <= a1[1][2])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((12 - v3) >= (20 ? v1 : a0[7])) % 4)) {
+        a1[2][4] = (((v3 && v0) > (v1 != 55)) ? ((v3 > 76) <= (4 == v3)) : ((a0[2] - 81) && (v3 >= a0[7])));
+        v3 = (((a1[3][14] % 3) >= (v0 * v1)) > ((v1 || 50) != (v0 ? a1[0][15] : 90)));
+        v3 = (((v2 % 5) / 6) > ((a1[0][7] || v3) && (a0[12] + v3)));
+    } else {
+        v1 = (((71 == 15) / 9) == ((58 && a0[0]) <= (68 * 69)));
+        a1[1][1] = (((66 > a1[2][12]) + (a0[1] < v3)) == ((v0 / 4) - (a1[2][9] || v3)));
+        a1[2][4] = (((a0[13] * a1[1][7]) * (86 % 8)) ? ((a1[0][7] / 2) / 5) : ((a1[1][6] < 63) && (9 > v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 % 6) > 88) break;
+            a1[2][5] = (((v0 <= 38) ? (v2 ? a0[7] : a1[1][11]) : (23 >= v3)) < ((a0[0] == 21) + (v2 < 89)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((v1 <= i3) >= (i3 + 50)) / 4);
+                v1 = (((a0[0] != i2) && (i3 % 2)) || ((a0[13] <= v1) != (15 * a1[2][5])));
+                v2 = (((v1 * 26) > (31 < 87)) ? ((25 == i2) - (81 == v3)) : ((a0[15] == a1[3][11]) ? (53 ? 91 : a1[2][10]) : (i3 ? i2 : v3)));
+            }
+            v3 = (((i2 && i2) * (a0[9] > v3)) && ((v3 == 41) * (a1[2][7] + a1[3][7])));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((v1 % 6) % 2) + ((a1[0][2] || v3) || (a1[0][14] + 14)));
+}
+int main() {
+    return 0;
+}
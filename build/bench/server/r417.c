@@ -0,0 +1,33 @@
+int f0() {
+    int v0 = 41;
+    int v1 = 52;
+    int v2 = 69;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((a0[7] * v3) == (v1 ? 3 : v0)) == ((v3 ? v1 : 85) - (v3 > v2)));
+    if ((((v1 / 5) + (a1[0][3] + v3)) || ((v0 / 8) - (59 || 88)))) {
+        v3 = (((a0[3] ? 64 : v0) <= (v1 > 81)) / 9);
+        a0[14] = (((a1[1][9] >= 22) != (a1[3][5] || a0[11])) || ((v1 < v1) + (63 - v1)));
+        v1 = (((v3 > a0[11]) % 5) ? ((v3 + v3) != (v2 > a1[0][11])) : ((v3 < a1[2][8]) / 8));
+    } else {
+        v1 = (((94 && v0) >= (80 * v1)) ? ((v3 <= v3) + (v1 ? v2 : v3)) : ((v0 / 9) * (4 <= v3)));
+        v3 = (((v3 <= v1) / 1) ? ((v3 <= 54) != (75 * v2)) : ((17 % 8) / 3));
+        v1 = (((76 < 3) != (v1 == v0)) ? ((v0 ? 98 : v3) <= (a1[2][13] <= v3)) : ((v3 < a1[1][12]) ? (v2 ? v0 : a1[0][0]) : (81 + a0[6])));
+    }
+    v1 = (((36 >= v0) > (v1 < 39)) >= ((v0 != a1[0][3]) == (v0 % 2)));
+    v2 = (((99 - v3) * (v2 == v1)) && ((40 > v3) ? (v2 % 5) : (v1 ? v1 : v3)));
+    if ((((v1 ? a1[0][2] : v0) / 2) + ((a0[8] + 47) && (v0 > v2)))) {
+        a0[14] = (((v0 - a0[11]) % 3) + ((v0 > a0[15]) || (a0[15] != v2)));
+        v0 = (((75 - v2) ? (35 - v1) : (v2 ? 69 : 23)) / 3);
+        v2 = (((a0[11] || v0) ? (v0 <= 55) : (v3 ? 30 : v3)) == ((a0[11] ? 30 : v0) - (v3 % 2)));
+    } else {
+        v0 = (((v3 || v2) ? (a0[15] ? 49 : v2) : (58 ? v3 : 89)) - ((38 ? v2 : 55) || (v0 != v1)));
+        v1 = (((v2 <= 57) % 3) != ((v0 + v2) ? (a0[9] / 9) : (v2 && v1)));
+        v1 = (((v1 ? 35 : v1) == (a1[0][8] - 33)) > ((v0 && v3) - (86 ? 32 : v1)));
+    }
+    return (((v3 || a0[0]) ? (a0[6] != v0) : (71 / 5)) + ((92 % 3) * (v0 < v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,116 @@
+int f0() {
+    int v0 = 50;
+    int v1 = 36;
+    int v2 = 78;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v2 = (((v2 ? i0 : 70) ? (v2 >= v3) : (v3 % 4)) != ((6 > 42) + (i0 / 2)));
+            v2 = (((42 <= v0) - (81 == v3)) < ((35 >= 88) - (v3 / 7)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((i0 == a0[11]) > 78) break;
+                    v1 = (((55 && v2) >= (v2 * a1[3][7])) % 8);
+                    v2 = (((i0 || i1) && (v3 % 2)) >= ((v2 ? a0[14] : a0[5]) ? (i1 * v3) : (a1[0][1] != a1[3][13])));
+                    a0[12] = (((v3 * v0) ? (92 + i1) : (v0 + v1)) ? ((a0[4] > 1) + (v3 / 7)) : ((i0 ? 38 : 45) + (87 - 4)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((78 >= v3) > (a0[3] == a0[0])) || ((v3 / 8) <= (a0[11] < 82)));
+    if ((((v1 < a1[3][0]) == (a0[15] || v3)) != ((a0[4] == v1) < (65 <= 88)))) {
+        v3 = (((v0 <= v2) + (v0 * a0[6])) + ((24 || a1[1][12]) || (v0 % 5)));
+        v3 = (((v1 - v0) != (31 >= 84)) <= ((v1 * 95) != (v3 ? v3 : v0)));
+        v2 = (((a1[2][5] ? v0 : 23) + (v2 ? v1 : 24)) <= ((v3 % 6) != (a1[2][5] > v1)));
+    } else {
+        v1 = (((v2 * 14) && (36 >= 54)) - ((v0 == 18) > (a1[3][2] - v2)));
+        a1[2][0] = (((v3 || 17) && (a0[4] % 7)) || ((a1[2][12] - 44) / 4));
+        v0 = (((a0[8] && a0[3]) / 1) >= ((64 >= v2) >= (a1[2][14] ? a1[0][4] : v3)));
+    }
+    v1 = (((v3 - 58) ? (81 ? v1 : v2) : (v3 / 1)) * ((a1[1][7] + 2) >= (v0 >= a1[3][1])));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v2 = (((a1[0][15] == a1[3][10]) == (a1[2][6] % 1)) + ((i2 >= 35) != (92 >= v0)));
+            a0[5] = (((v3 ? a1[3][13] : v3) < (v3 ? v0 : 51)) ? ((v3 != a0[14]) > (v3 > 23)) : ((a1[2][8] % 6) == (a1[0][12] >= 94)));
+            {
+                int i3 = 0;
+                do {
+                    a1[3][12] = (((v1 ? 14 : 18) * (85 - a1[0][15])) * ((78 % 1) / 6));
+                    v0 = (((58 * 52) != (i2 != v0)) || ((v1 == v2) && (a0[15] <= i3)));
+                    v2 = (((a0[9] ? i3 : a1[3][0]) % 2) > ((v0 || i2) ? (52 % 8) : (i3 != 31)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((v1 <= a1[3][14]) ? (v0 >= v1) : (v3 <= v1)) == ((v2 == v3) == (v3 ? a0[3] : 27)));
+}
+int f1() {
+    int v0 = 51;
+    int v1 = 6;
+    int v2 = 62;
+    int v3 = 60;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 == a0[3]) > (v2 != a1[3][10])) * ((v2 % 5) % 2));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((19 || a0[4]) > 64) break;
+            a1[3][10] = (((a1[2][12] || a0[2]) >= (a0[5] + v0)) > ((v0 + v1) / 3));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((v3 && 34) > 89) break;
+                v0 = (((v0 + 93) && (v3 != a0[10])) && ((20 && v2) == (85 && i1)));
+                v3 = (((37 ? a0[10] : 12) || (32 % 5)) ? ((a0[3] / 8) > (87 != v1)) : ((i1 ? i1 : v1) <= (0 * a0[6])));
+                v2 = (((v2 ? 9 : v3) - (v3 ? 89 : i0)) <= ((53 < a1[1][9]) < (96 || 95)));
+            }
+            v1 = (((v2 ? 25 : v0) >= (55 / 7)) || ((a1[1][4] == 49) - (i0 / 9)));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((v0 * a1[2][13]) ? (v1 % 9) : (85 || v2)) <= ((83 ? v0 : a1[2][5]) == (a1[0][3] > v3)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v1 < a0[0]) > 60) break;
+        a1[2][9] = (((v1 ? 91 : v0) / 8) ? ((39 >= v0) % 9) : ((a1[1][15] - a0[12]) < (a0[4] % 8)));
+        v2 = (((v2 && a1[3][2]) || (99 / 4)) == ((v1 * v3) != (a1[1][4] || 88)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((i2 > v0) + (v1 && v0)) - ((a1[2][4] - v0) <= (v2 + a0[8])));
+                v1 = (((v2 - v1) != (i2 == i2)) * ((v3 || i3) ? (v2 + v3) : (v0 % 5)));
+                a1[1][10] = (((45 > i2) / 3) > ((i2 ? 49 : i3) <= (i3 % 4)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    if ((36 == i5) > 89) break;
+                    v2 = (((v0 <= v2) > (i4 || 63)) - ((86 ? 16 : v2) ? (19 || v3) : (i5 == v2)));
+                    v0 = (((i5 == i5) || (v3 / 4)) && ((a0[14] + v0) < (75 + a1[2][7])));
+                    a1[3][11] = (((v3 < i4) / 9) % 8);
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a0[13] = (((v2 == v3) && (a0[0] >= v2)) != ((95 ? v1 : a0[11]) % 6));
+            v2 = (((i4 && v2) + (a0[2] ? v3 : v1)) || ((v1 >= 19) < (28 < v1)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    return (((a1[3][15] < v2) < (v1 * a1[1][6])) == ((v1 % 1) < (v3 % 7)));
+}
+int main() {
+    return 0;
+}
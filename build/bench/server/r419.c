@@ -0,0 +1,166 @@
+int f0() {
+    int v0 = 81;
+    int v1 = 16;
+    int v2 = 42;
+    int v3 = 47;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v0 > v2) + (v0 - a0[0])) != ((a1[0][8] + v0) / 6));
+    v1 = (((v1 - 7) && (57 >= v0)) + ((v1 == 94) % 3));
+    if ((((a1[0][4] % 8) <= (a0[1] == 99)) % 3)) {
+        v3 = (((v0 <= v2) / 1) < ((3 + v2) <= (v0 ? 3 : v2)));
+        v3 = (((v3 ? a0[15] : a1[2][14]) * (93 > a1[0][2])) * ((v1 == a0[2]) ? (v0 ? a1[2][14] : v2) : (v1 ? v0 : 83)));
+        v3 = (((12 || 90) ? (v0 ? a1[0][12] : 97) : (a1[0][6] != a0[0])) && ((v0 % 3) && (64 / 1)));
+    } else {
+        a0[14] = (((24 != v3) ? (v2 ? v1 : a1[0][6]) : (v0 && 99)) <= ((a1[3][4] || v1) + (a0[6] / 1)));
+        v1 = (((v2 + 79) >= (a0[15] != 4)) - ((v0 && v1) == (v3 - a0[6])));
+        a0[14] = (((v2 <= v0) && (v1 < 63)) + ((a0[12] - 34) ? (v0 <= v3) : (v1 / 1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[0][3] = (((a1[0][6] == i0) || (v1 / 9)) && ((a1[2][2] && 3) % 8));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v2 = (((v3 && 17) <= (v1 == v3)) == ((41 <= 91) == (i1 <= 76)));
+                v2 = (((v0 || v3) ? (i0 - 43) : (a1[0][0] ? a1[2][4] : i0)) >= ((i0 != 9) ? (v0 ? v2 : v3) : (9 ? i0 : v3)));
+                v0 = (((v2 < a0[6]) ? (a0[5] != i0) : (64 < 6)) != ((36 < i0) == (v2 && v1)));
+            }
+            v3 = (((v0 != 73) <= (i0 * v2)) * ((i0 ? v0 : a1[0][0]) <= (a0[9] * 71)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((v2 < v1) > 92) break;
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a0[6] = (((v2 || i2) - (18 == a1[2][11])) && ((71 * 64) && (i2 ? a1[3][11] : v3)));
+                a1[2][1] = (((v1 ? i3 : 87) && (a1[1][6] <= a0[14])) + ((v2 + i3) < (a1[3][10] + v1)));
+                v3 = (((i3 + v3) / 4) >= ((v0 * a0[12]) - (i3 % 4)));
+            }
+            v0 = (((v1 < v1) + (i2 % 2)) < ((10 * 96) || (v0 - i2)));
+            v1 = (((v1 != i2) != (a1[0][5] * 81)) == ((v1 >= v0) || (a1[0][9] / 6)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v1 ? v0 : a0[6]) < (v2 != a0[6])) / 3);
+}
+int f1() {
+    int v0 = 74;
+    int v1 = 61;
+    int v2 = 62;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v2 = (((87 && a1[3][6]) >= (v0 && v0)) ? ((v2 >= a1[1][0]) ? (v0 ? v3 : a1[1][2]) : (v1 * v2)) : ((a0[4] >= v2) + (v1 <= 43)));
+            v2 = (((77 != v2) && (a0[8] >= a0[6])) ? ((6 - v1) >= (79 ? a0[14] : a0[3])) : ((v2 >= i0) ? (i0 / 9) : (v2 ? a1[1][1] : 27)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((v0 == v2) <= (i1 < v2)) + ((a1[0][2] % 8) == (89 ? 76 : v1)));
+                    v3 = (((v3 % 4) <= (a0[3] * a0[0])) < ((62 <= 84) / 2));
+                    v0 = (((v1 + a0[12]) > (v3 < i0)) + ((v3 ? i1 : i0) % 5));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[2][13] % 8) < (v2 != a0[3])) / 8)) {
+        v3 = (((49 && v2) ? (a1[0][6] >= 57) : (51 ? 20 : a1[0][4])) == ((v2 != v2) || (v1 != v2)));
+        v3 = (((a1[2][10] <= 55) >= (a0[3] ? 0 : 25)) < ((v0 > 38) + (v1 < v0)));
+        v2 = (((v0 != a1[0][11]) != (v1 > v2)) <= ((78 ? a1[0][10] : v1) || (v0 * v3)));
+    } else {
+        v0 = (((0 || a1[3][13]) + (a0[13] >= 5)) ? ((44 > 77) > (v0 != 57)) : ((v1 >= v2) - (a0[7] < v1)));
+        v1 = (((a0[13] / 8) - (a0[3] == v0)) / 4);
+        v0 = (((v3 / 1) >= (v2 > v2)) + ((69 || a1[2][13]) - (39 != 43)));
+    }
+    if ((((v3 % 5) != (a0[2] >= v0)) && ((a1[3][8] > v1) / 9))) {
+        a0[4] = (((80 < v3) || (a0[13] && v3)) == ((v0 > v1) + (v1 < v0)));
+        a0[2] = (((v1 > v3) == (a1[2][15] - a0[11])) ? ((73 != v0) ? (v1 ? v0 : a0[5]) : (8 >= a0[11])) : ((a0[1] % 9) / 6));
+        a0[1] = (((a1[0][8] >= v0) > (a1[2][14] * v2)) ? ((v1 ? v3 : v3) > (v0 - v0)) : ((a0[2] >= a0[4]) - (5 / 2)));
+    } else {
+        v1 = (((v0 != 80) < (v3 || v1)) * ((a0[10] < v3) == (v3 / 2)));
+        v0 = (((v0 <= a0[9]) == (v1 < v3)) >= ((a0[5] != a1[0][7]) - (v3 ? v0 : v1)));
+        v0 = (((13 + 69) || (19 * 48)) ? ((v0 >= v3) / 9) : ((a0[2] != a0[11]) != (a0[15] % 5)));
+    }
+    v2 = (((v3 + v0) / 8) % 7);
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a0[7] = (((72 || v3) % 5) == ((v0 && v0) * (v2 % 1)));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v1 = (((v0 != a0[13]) < (21 > 6)) > ((a1[2][13] / 6) <= (a0[6] != v1)));
+                v3 = (((44 || i2) * (a1[3][12] + 75)) == ((a0[4] || v0) * (v1 == 78)));
+                v3 = (((i3 && 47) * (v1 != a1[0][11])) != ((v0 || v1) && (68 - a1[0][10])));
+                i3 = i3 + 1;
+            }
+        }
+        a1[2][5] = (((a1[3][2] < v2) > (a1[0][13] ? v2 : i2)) ? ((a0[4] >= v2) || (84 != a1[3][12])) : ((v3 != i2) * (a1[3][1] ? 78 : 49)));
+    }
+    return (((88 >= v1) == (44 || 88)) == ((a0[5] == 87) != (43 ? 52 : v0)));
+}
+int f2() {
+    int v0 = 35;
+    int v1 = 74;
+    int v2 = 26;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 || a1[0][6]) ? (87 < v0) : (v2 < v1)) ? ((a0[7] - a1[3][15]) > (a1[2][4] != v1)) : ((v2 / 1) / 6))) {
+        a0[8] = (((40 >= 90) < (a0[4] * 99)) / 8);
+        v0 = (((v1 + v2) * (a1[0][12] + 94)) % 4);
+        v0 = (((v1 == v0) == (31 > a1[1][15])) >= ((v0 + a1[1][11]) * (a1[1][8] >= v1)));
+    } else {
+        v3 = (((v1 % 3) ? (v2 < 97) : (v2 <= a0[15])) < ((v0 && 46) || (v1 != v2)));
+        v3 = (((64 && v3) ? (v0 <= v2) : (9 <= a1[3][4])) % 7);
+        a1[1][0] = (((v0 ? v1 : v0) / 4) ? ((a1[0][13] != v2) == (v0 == 20)) : ((a1[3][13] <= a0[11]) - (v1 <= v1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v3 / 2) % 3) % 7);
+                    v1 = (((i0 * i0) + (47 ? i1 : i0)) - ((85 / 7) + (v3 * 80)));
+                    a1[0][13] = (((v3 + i0) / 8) <= ((a1[2][6] + v0) / 8));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v1 = (((v1 >= a1[1][8]) * (90 ? 94 : v0)) / 7);
+            v3 = (((v3 > v3) ? (a0[5] - 79) : (v2 ? a1[2][9] : i0)) ? ((a1[2][6] > 15) <= (v3 <= v1)) : ((a0[6] ? v2 : v3) - (v3 * i0)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    a0[15] = (((15 ? v1 : a0[2]) / 4) < ((v0 || v0) / 6));
+    if ((((33 >= a1[1][15]) < (v2 >= v2)) ? ((a0[10] / 6) < (v1 == v0)) : ((a0[7] - 48) - (v0 == 82)))) {
+        v2 = (((87 ? a1[1][7] : v1) == (v1 * v1)) != ((a0[11] % 7) / 6));
+        a1[1][1] = (((94 >= v2) ? (a0[5] + a0[13]) : (v3 % 9)) && ((v2 >= v1) ? (v2 != 3) : (73 % 2)));
+        v3 = (((v0 && a1[3][9]) < (v3 ? 58 : a1[0][13])) <= ((v3 == 78) < (a0[11] != v0)));
+    } else {
+        v2 = (((a0[4] == 62) || (35 || v3)) - ((a1[2][7] <= v0) < (v1 - v0)));
+        v0 = (((a1[1][8] == 30) <= (v1 / 6)) <= ((0 == a0[7]) && (v2 - a0[0])));
+        v1 = (((v2 ? v2 : 46) == (46 / 1)) >= ((v0 * 47) ? (v2 ? v2 : 16) : (v0 + v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((a0[11] * 63) % 7) % 1);
+                a0[14] = (((v2 || a1[1][0]) <= (v1 == i2)) ? ((a1[0][2] != v3) * (41 == a0[2])) : ((a0[0] * a0[4]) % 4));
+                v0 = (((v0 ? a0[2] : 25) ? (v0 + 56) : (i3 != a0[2])) / 1);
+            }
+            a1[3][9] = (((24 == v1) + (i2 && a1[0][3])) == ((a0[7] < v1) * (91 / 8)));
+            v3 = (((a0[2] / 9) % 9) / 5);
+            i2 = i2 + 1;
+        }
+    }
+    return (((v3 || a1[3][7]) / 4) ? ((v0 + a1[3][12]) || (55 / 7)) : ((a1[3][12] || v0) % 3));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,58 @@
+int f0() {
+    int v0 = 88;
+    int v1 = 8;
+    int v2 = 95;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v1 = (((v2 + i0) > (i0 * v2)) && ((a0[4] % 1) == (72 ? 74 : 91)));
+        {
+            int i1 = 0;
+            do {
+                if ((23 ? v3 : 77) > 50) break;
+                a0[3] = (((v1 || a1[2][3]) ? (i1 * a0[10]) : (v3 && a1[0][6])) || ((22 && i1) - (41 ? a0[7] : i0)));
+                v1 = (((a1[0][11] >= a1[1][5]) ? (i0 && 58) : (v3 % 8)) >= ((i0 ? i0 : 44) ? (v1 >= 57) : (i0 ? a0[14] : v0)));
+                a0[10] = (((96 ? v0 : i0) ? (97 >= 94) : (5 > a1[0][15])) >= ((v2 < v0) + (i0 == a0[3])));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v0 = (((v1 == v3) - (i0 / 2)) >= ((a0[13] != 82) % 2));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 < v1) > 66) break;
+            v0 = (((69 * a0[0]) >= (v2 >= 79)) ? ((84 > v0) < (10 ? v0 : v0)) : ((a1[1][4] / 1) == (v2 && v1)));
+            v3 = (((v3 < v0) <= (v2 <= 38)) % 4);
+            {
+                int i3 = 0;
+                do {
+                    if ((8 + v1) > 73) break;
+                    v1 = (((a1[0][13] + a1[1][8]) ? (v3 % 9) : (v2 ? a0[1] : v2)) > ((1 >= a1[0][1]) > (v2 % 8)));
+                    v0 = (((v3 < v2) ? (49 && a1[0][1]) : (a0[15] != v0)) / 4);
+                    v1 = (((v1 != v1) ? (i3 == a1[1][0]) : (i2 != i2)) < ((i2 ? a0[13] : a0[8]) / 5));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v0 = (((v2 - 67) == (v2 ? a1[0][7] : 66)) && ((v1 - a0[7]) < (a0[6] != 22)));
+    if ((((v1 != 87) ? (a0[6] <= 96) : (a0[8] + a1[2][15])) % 2)) {
+        v3 = (((v2 / 5) - (a1[0][9] > a1[0][1])) != ((a0[4] / 1) + (3 % 3)));
+        v3 = (((a0[12] && v1) % 1) < ((v0 > 79) || (1 && 17)));
+        v3 = (((a1[3][3] * 50) % 7) + ((v0 % 8) % 3));
+    } else {
+        v2 = (((v1 / 3) < (a0[15] != v2)) / 9);
+        v3 = (((17 || v0) % 7) % 2);
+        v0 = (((14 != v0) - (v2 * 59)) <= ((21 && a1[3][1]) < (v2 ? v2 : 82)));
+    }
+    v1 = (((v1 % 9) == (a0[11] * v1)) * ((82 + 85) ? (v2 >= v2) : (v2 + v1)));
+    return (((99 ? v1 : a0[5]) ? (v1 ? 11 : v3) : (v2 / 4)) / 7);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,49 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 53;
+    int v2 = 11;
+    int v3 = 20;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v3 / 6) > (v0 ? a0[0] : v2)) == ((v3 + a1[1][14]) != (v3 - a1[0][4])));
+    if ((((v0 || v2) >= (81 * 59)) && ((v3 == 70) && (38 > v2)))) {
+        v2 = (((v1 || v2) > (v1 ? v1 : v1)) * ((v2 ? v2 : 58) == (a1[1][15] || v3)));
+        v3 = (((67 ? 29 : v3) ? (v1 - a0[4]) : (a1[2][3] < v3)) + ((v0 || 69) >= (a1[0][14] == a0[7])));
+        a0[1] = (((v3 * v1) * (a0[4] + a0[6])) - ((v0 <= v0) == (v0 && a0[14])));
+    } else {
+        a1[3][4] = (((a0[4] || a1[1][5]) || (62 && a0[9])) == ((17 ? a0[1] : v1) >= (v0 > v1)));
+        v1 = (((a1[1][1] - a1[0][10]) - (v0 || a0[6])) ? ((v0 < a1[0][10]) || (v1 <= a0[6])) : ((a0[8] < v3) <= (v3 || a0[9])));
+        v1 = (((v1 ? v1 : v3) > (a0[3] > v3)) <= ((v0 != v3) + (v0 == 65)));
+    }
+    a0[15] = (((a0[7] - v0) || (v2 / 5)) + ((a1[1][11] == a0[12]) || (v3 - 88)));
+    if ((((a0[2] >= 94) < (v3 % 5)) + ((v1 > v2) && (97 / 6)))) {
+        a1[3][3] = (((v0 && 53) || (a1[1][6] ? v3 : a0[10])) ? ((v1 || a0[14]) % 9) : ((v3 <= v0) <= (a0[7] * 95)));
+        a0[6] = (((v3 ? 39 : 94) >= (v1 > 18)) == ((27 != v0) / 7));
+        v1 = (((v2 ? 70 : a0[8]) - (v3 > a0[12])) ? ((24 >= a1[2][11]) % 2) : ((v2 + a0[4]) < (a1[3][12] % 5)));
+    } else {
+        v2 = (((v0 % 9) >= (v0 + a0[14])) ? ((50 != v0) && (a1[0][0] ? v2 : v2)) : ((v0 || 63) < (v1 + a0[9])));
+        v0 = (((v2 || v1) * (v3 > v0)) ? ((12 != a0[4]) ? (v1 >= a1[1][2]) : (70 != v2)) : ((v3 % 5) != (39 * a1[1][10])));
+        v0 = (((v3 != 59) >= (v3 == v3)) * ((v0 <= v0) ? (a0[15] % 3) : (95 >= a1[3][1])));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[3] = (((v0 / 4) && (v0 % 6)) >= ((v0 <= 13) <= (a0[2] + v2)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a1[3][8] = (((i1 % 8) + (a0[6] != i1)) * ((v0 * v1) != (v2 % 6)));
+                    v0 = (((v2 ? 34 : v2) && (v3 ? v1 : 32)) ? ((70 / 4) >= (a0[9] - 96)) : ((a1[1][11] > a1[3][15]) == (v0 >= 29)));
+                    a0[10] = (((a1[1][6] ? v3 : i0) && (i1 > v3)) ? ((v1 / 6) != (v2 && a0[10])) : ((a1[1][10] * a0[5]) < (33 <= a1[0][6])));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((52 || v0) >= (54 >= i0)) == ((v0 % 1) != (v3 / 9)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    return (((v0 % 4) < (v0 % 5)) <= ((v3 != 38) && (a0[12] + v2)));
+}
+int main() {
+    return 0;
+}
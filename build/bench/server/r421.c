@@ -0,0 +1,133 @@
+int f0() {
+    int v0 = 78;
+    int v1 = 99;
+    int v2 = 70;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((a0[9] / 4) > 91) break;
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a0[7] + v2) == (v3 && 32)) <= ((a0[8] * v0) >= (62 % 8)));
+                    a0[4] = (((i0 < i0) || (a0[1] ? 24 : a1[3][11])) / 8);
+                    v2 = (((i0 / 4) == (v3 < v2)) != ((53 ? 68 : v2) <= (v3 ? v2 : a0[9])));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a0[13] = (((a1[1][15] >= v0) % 2) % 4);
+            v3 = (((v3 != 43) < (v1 >= v0)) < ((71 == a1[2][12]) != (a0[13] ? v0 : v0)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v0 > 22) > 87) break;
+        v1 = (((v3 > 57) / 9) || ((v2 == v0) <= (a1[1][3] + v2)));
+        a0[8] = (((18 <= i2) <= (v2 ? v2 : a1[1][13])) ? ((27 ? v1 : i2) / 8) : ((a0[14] != a0[4]) == (v3 ? v1 : i2)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            if ((96 >= v3) > 93) break;
+            a1[2][6] = (((v3 > i2) >= (a1[0][3] ? a1[2][15] : v3)) <= ((i2 - a0[0]) >= (38 || 82)));
+            a1[0][6] = (((v0 ? 79 : 64) ? (a0[6] + a1[0][1]) : (a0[8] % 7)) - ((v3 > v2) >= (v1 ? v0 : v1)));
+            a1[2][11] = (((v2 != v3) < (8 >= v0)) >= ((a0[5] * i3) >= (a0[3] && 41)));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    v2 = (((6 * a1[3][4]) % 1) ? ((i5 < 43) >= (a0[1] < 63)) : ((24 - v1) - (v1 >= v2)));
+                    v1 = (((a0[14] && a1[2][12]) + (i4 != i5)) + ((a0[8] ? i5 : v3) ? (72 % 9) : (a1[0][9] * a1[3][1])));
+                    v2 = (((i4 && a1[0][1]) * (a1[2][13] || a1[2][0])) < ((i5 ? 81 : 73) || (39 != v2)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[0][14] = (((v2 + v0) && (84 != a1[2][15])) != ((v3 || 61) * (v2 - v1)));
+            v2 = (((i4 != a0[15]) ? (v2 ? 36 : 88) : (v1 <= v3)) == ((1 + v1) <= (v0 || 36)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    if ((((a1[1][11] ? v3 : v0) < (v3 || v1)) > ((v0 > v1) - (25 == a1[1][2])))) {
+        v3 = (((a0[0] - v1) ? (a1[1][9] - 95) : (v1 <= a1[0][3])) ? ((a0[10] && v3) == (v2 * v2)) : ((26 * v1) ? (v1 + v1) : (a1[1][0] < v3)));
+        a1[1][0] = (((60 > v3) < (v0 % 1)) ? ((v3 < a1[3][7]) > (a1[2][5] ? 5 : a1[3][6])) : ((v2 % 1) < (v3 - a1[2][11])));
+        v1 = (((v3 ? v1 : a1[3][0]) * (13 - v0)) != ((v3 <= a1[1][11]) || (v0 > a0[4])));
+    } else {
+        a0[5] = (((38 == a1[2][15]) && (v3 < v2)) ? ((v2 && v3) > (v1 < 27)) : ((v1 > a1[2][11]) <= (v1 ? v1 : v2)));
+        a1[0][8] = (((v1 < a0[14]) && (v2 * a1[1][2])) / 2);
+        v3 = (((a1[1][8] && 77) != (a0[13] + a0[10])) / 3);
+    }
+    if ((((v2 <= a0[3]) ? (a1[3][4] * a0[12]) : (28 >= a0[10])) <= ((v0 <= v0) <= (v0 + v3)))) {
+        a0[8] = (((v3 % 3) > (v0 <= a0[12])) ? ((91 && v2) * (v2 * v3)) : ((v3 ? v3 : v1) / 7));
+        v2 = (((v3 % 6) != (a0[12] != 30)) * ((9 || v3) && (89 ? v0 : v0)));
+        v3 = (((48 > 78) / 6) || ((a1[1][12] ? v2 : a1[3][10]) - (v1 && 32)));
+    } else {
+        a0[5] = (((v0 != a0[7]) + (82 ? 69 : 52)) - ((a1[1][1] * v3) ? (v0 < v3) : (67 + v0)));
+        v0 = (((v3 <= v2) ? (v2 % 6) : (v3 < v1)) ? ((a1[3][9] ? 70 : a0[11]) || (v1 ? v0 : 87)) : ((v0 ? 81 : 33) == (v2 / 3)));
+        v1 = (((v0 / 2) * (a0[11] && v3)) < ((v1 || a1[3][1]) + (43 % 7)));
+    }
+    return (((a0[14] - a1[3][6]) ? (v2 <= a0[8]) : (v3 / 6)) + ((a0[14] < 51) == (a0[8] <= v0)));
+}
+int f1() {
+    int v0 = 94;
+    int v1 = 73;
+    int v2 = 63;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v3 = (((v0 + v3) >= (a0[1] / 7)) - ((v0 != 25) <= (i0 + i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((29 ? i1 : 80) > 72) break;
+                    v0 = (((60 ? v3 : 45) && (36 > 45)) % 7);
+                    v1 = (((v2 ? v1 : a1[2][12]) >= (v0 || v1)) + ((v1 * v1) || (39 <= a1[3][11])));
+                    a1[1][15] = (((v3 >= v3) + (v3 != 17)) < ((v2 >= i1) - (a1[1][6] ? 79 : 96)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            a1[2][0] = (((a1[3][8] < v1) || (i0 || v3)) == ((v2 && v0) || (v0 ? a1[3][15] : 91)));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v3 <= a0[1]) + (v2 > a1[1][2])) != ((55 == 94) == (a1[0][8] * v0)));
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            a0[8] = (((a0[8] + 12) - (v1 % 6)) - ((v2 != v1) > (a0[5] * v0)));
+            v1 = (((v1 || v1) + (v3 - 15)) + ((v1 > a0[6]) != (38 && v1)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((v3 > v3) > 87) break;
+                v2 = (((i2 != a1[2][15]) ? (a0[7] + a0[0]) : (v0 ? v2 : v1)) < ((v0 ? i3 : 57) && (a0[13] <= v0)));
+                a1[3][12] = (((39 % 5) ? (a1[3][10] && v3) : (a0[7] <= v1)) >= ((v1 - 95) >= (v3 - a1[0][3])));
+                a0[8] = (((36 ? 39 : 32) >= (i2 != a1[2][6])) && ((v0 / 8) ? (v3 < 49) : (v0 - 4)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a0[4] <= i4) > 82) break;
+            v2 = (((15 ? v0 : v1) > (a1[2][4] - 74)) != ((v3 || 35) - (i4 ? v2 : 15)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v2 = (((v2 % 2) ? (a1[0][2] >= 86) : (i5 || i5)) >= ((a1[0][6] / 1) <= (v3 ? 80 : v3)));
+                a0[12] = (((45 / 3) % 6) || ((i4 + v3) || (v3 - v0)));
+                v0 = (((i4 <= a0[3]) * (i5 == a1[0][14])) % 4);
+            }
+            a0[5] = (((v0 || 67) || (v2 || i4)) - ((v0 <= a1[1][12]) != (a1[3][1] == v2)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    a0[9] = (((a1[3][13] || a1[3][7]) < (a1[2][7] / 3)) + ((v0 || 94) > (a1[3][11] < v0)));
+    return (((v2 / 7) - (a0[11] != v2)) == ((v1 <= a0[8]) > (v3 <= a1[1][7])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,169 @@
+int f0() {
+    int v0 = 50;
+    int v1 = 84;
+    int v2 = 11;
+    int v3 = 98;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            if ((70 <= 42) > 86) break;
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a0[4] = (((55 < i0) >= (v2 / 7)) < ((a0[0] / 7) - (64 ? a0[0] : v2)));
+                    v3 = (((v3 * v2) * (v2 == a0[11])) - ((v1 * v0) || (15 ? a1[2][10] : i1)));
+                    a0[3] = (((22 <= i1) ? (v2 <= v1) : (a1[1][8] <= v3)) != ((72 > 87) ? (19 % 1) : (v2 ? 59 : v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][1] = (((a1[1][6] > i0) ? (a1[0][9] / 4) : (v1 || 7)) >= ((a1[1][12] == v1) || (a1[3][5] < v3)));
+            a1[1][5] = (((92 > v1) == (a0[15] && a0[8])) - ((v1 ? v3 : v3) ? (19 <= 78) : (v0 != v2)));
+            i0 = i0 + 1;
+        }
+    }
+    a0[12] = (((54 ? v1 : a0[9]) * (v1 ? v0 : v2)) <= ((v3 + a0[8]) < (83 * 48)));
+    if ((((v3 >= v3) % 3) >= ((a1[1][3] + a0[12]) || (a1[3][14] + a1[2][12])))) {
+        v2 = (((a1[3][5] || v0) >= (v1 + v0)) ? ((v2 && v1) <= (a0[5] + 16)) : ((a0[2] || v1) || (v3 > 1)));
+        a1[2][8] = (((v2 + 30) + (v2 > v0)) < ((88 ? v1 : 36) ? (94 ? v2 : 68) : (v2 && a1[3][4])));
+        a1[2][9] = (((a1[0][5] ? v2 : 75) != (a0[12] - 32)) < ((78 ? 55 : v1) * (v2 - a0[2])));
+    } else {
+        a1[1][3] = (((80 == v0) ? (v0 / 8) : (v3 ? 16 : v1)) > ((v0 != v3) ? (v0 / 4) : (a1[2][13] < 19)));
+        v0 = (((5 >= v2) != (a1[1][14] != v3)) < ((a1[3][8] ? a1[3][7] : v3) && (a1[0][4] ? v3 : 54)));
+        v0 = (((a0[0] / 5) && (v2 - a1[0][12])) / 5);
+    }
+    a1[0][10] = (((a1[3][14] > a0[15]) != (v0 > a1[3][0])) * ((77 <= 62) == (0 || v2)));
+    {
+        int i2 = 0;
+        do {
+            if ((88 / 4) > 89) break;
+            v2 = (((a0[3] != a1[3][3]) >= (v1 ? a1[0][9] : a0[8])) ? ((v2 || a0[10]) >= (a1[1][3] ? v3 : 77)) : ((98 + v2) && (95 == 62)));
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[2][10] || a1[2][14]) > 59) break;
+                    v1 = (((i2 / 9) + (v0 > v0)) * ((a0[5] != v3) && (v0 != v2)));
+                    v3 = (((32 ? a1[1][15] : 25) % 6) ? ((a1[2][4] ? i3 : i2) / 3) : ((a0[14] % 5) / 8));
+                    v2 = (((i2 ? v0 : 96) != (v3 < 27)) ? ((35 - i2) || (a1[0][12] ? a1[1][0] : a1[0][11])) : ((v3 && v0) != (v3 != i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            a1[1][5] = (((a0[10] ? i2 : v2) <= (i2 / 9)) - ((a0[7] <= i2) ? (0 / 1) : (87 + 24)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((v1 || v0) * (v3 > 71)) < ((v2 % 5) >= (v0 >= v1)));
+}
+int f1() {
+    int v0 = 99;
+    int v1 = 4;
+    int v2 = 47;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((a0[13] / 2) || (94 < 85)) != ((v3 < i0) < (84 && 88)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    if ((a0[15] <= i1) > 57) break;
+                    a0[11] = (((a0[5] || v0) + (v3 * v0)) && ((5 >= v0) <= (a0[10] && 89)));
+                    v1 = (((a0[9] && 46) ? (a1[1][1] != v1) : (v0 <= a0[15])) % 5);
+                    v0 = (((a1[0][2] ? 2 : a0[13]) <= (58 < i0)) ? ((a1[0][0] ? 42 : v3) - (a0[8] >= v2)) : ((33 - a1[2][1]) <= (a0[0] % 2)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][14] = (((a0[4] < v2) == (14 == 72)) ? ((i0 > i0) >= (4 - i0)) : ((v1 * 78) % 6));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((7 <= i2) != (34 > i2)) && ((a0[1] ? v3 : v1) < (v2 + v1)));
+            v2 = (((i2 % 4) + (a1[1][7] + v3)) ? ((61 < a1[2][7]) / 2) : ((a1[3][9] * a1[2][15]) - (53 % 4)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((99 && v0) % 6) + ((i3 != v0) ? (a1[1][1] <= a0[15]) : (i2 && v0)));
+                    v0 = (((v3 ? 32 : a1[0][0]) == (a1[2][0] == 89)) < ((43 && v0) % 7));
+                    v2 = (((v2 != v0) / 4) - ((a1[3][3] && 94) < (a0[10] ? v1 : 77)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a0[12] = (((84 + 23) > (v1 ? i4 : v2)) * ((v1 >= v1) && (10 != v3)));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v1 = (((41 * 42) / 7) * ((v2 >= a0[7]) ? (18 ? v3 : a0[5]) : (v2 >= v3)));
+                v1 = (((v2 ? a1[1][9] : a1[3][7]) * (v0 == i4)) || ((i4 >= 22) - (a1[1][14] || v1)));
+                a0[15] = (((a0[15] % 7) ? (a1[1][13] * v1) : (v2 >= i5)) || ((62 < a0[7]) >= (a1[3][8] && i4)));
+            }
+            v0 = (((i4 / 8) == (a1[2][14] > i4)) / 5);
+            i4 = i4 + 1;
+        }
+    }
+    if ((((34 + 63) / 1) ? ((39 % 9) + (v2 == a1[3][2])) : ((63 - 31) > (a1[1][3] <= 78)))) {
+        v0 = (((v3 ? v2 : v1) && (v1 == 55)) % 2);
+        v3 = (((24 / 1) < (v3 ? a1[2][14] : v3)) >= ((v0 >= v2) >= (83 <= v0)));
+        v1 = (((43 != 81) <= (a0[3] ? v3 : v0)) == ((64 < v0) == (a0[14] && v0)));
+    } else {
+        v1 = (((47 % 3) - (33 >= a1[1][10])) ? ((a0[12] || v0) - (v2 >= a0[0])) : ((v0 - v1) ? (v2 > 99) : (v0 >= v2)));
+        v3 = (((v0 ? v1 : v3) != (79 != 79)) / 2);
+        a1[2][7] = (((v3 >= a1[0][8]) > (v3 && v1)) <= ((v0 >= v1) + (v0 == 56)));
+    }
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        a1[3][4] = (((51 + i6) || (a1[0][2] ? v1 : 42)) + ((a0[10] ? a0[6] : 91) / 1));
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                v2 = (((a0[3] - v3) * (12 % 1)) % 5);
+                v1 = (((77 < 43) * (v1 > v3)) == ((i6 >= a0[13]) < (v1 + v3)));
+                v2 = (((v2 == 9) || (11 ? i7 : v1)) < ((v3 == i7) <= (v2 ? v1 : 56)));
+                i7 = i7 + 1;
+            }
+        }
+        a1[0][14] = (((v3 * a1[1][2]) % 3) ? ((52 != a0[12]) > (v3 / 4)) : ((v0 != v1) / 2));
+    }
+    return (((v0 * a1[0][4]) * (a1[1][1] || 4)) > ((v0 / 1) && (34 ? a1[0][14] : v1)));
+}
+int f2() {
+    int v0 = 51;
+    int v1 = 38;
+    int v2 = 11;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v3 = (((v0 / 6) >= (25 * v1)) ? ((a0[4] ? a1[3][10] : i0) == (i0 + v1)) : ((15 ? v0 : v0) == (i0 ? 50 : a0[8])));
+            v3 = (((a1[1][0] ? v2 : a0[13]) && (v1 || 29)) / 7);
+            {
+                int i1 = 0;
+                do {
+                    a1[3][15] = (((a1[2][12] != a1[2][10]) || (13 || v3)) * ((a1[1][5] - i0) || (v3 * a1[1][2])));
+                    v2 = (((v3 && i0) && (39 >= a0[10])) ? ((a0[7] == v3) < (a0[0] ? v2 : v0)) : ((a1[2][4] % 7) + (v2 || a1[3][9])));
+                    v2 = (((5 == 87) > (a1[3][13] / 4)) != ((v0 - v1) == (v2 - i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((14 ? v3 : v0) >= (87 / 2)) ? ((34 < v3) ? (64 >= v3) : (v2 == a1[1][2])) : ((v0 != v0) * (v1 >= a0[14])));
+    a1[1][10] = (((v3 ? v2 : v0) != (a1[3][5] + 58)) / 5);
+    v1 = (((v0 <= v0) * (v3 * 48)) != ((v3 ? v1 : v1) == (64 + v3)));
+    v2 = (((a1[0][3] <= v1) < (35 * v0)) >= ((89 != v2) / 8));
+    return (((v3 <= v0) / 4) ? ((v0 >= v1) ? (a1[3][3] * v3) : (v2 ? a1[1][12] : a1[2][1])) : ((v3 != v1) % 3));
+}
+int main() {
+    return 0;
+}
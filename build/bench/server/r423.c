@@ -0,0 +1,72 @@
+int f0() {
+    int v0 = 47;
+    int v1 = 4;
+    int v2 = 76;
+    int v3 = 62;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 == v3) >= (v0 || v0)) && ((v2 != v2) * (a1[0][1] <= v3)))) {
+        a0[13] = (((65 < v2) != (73 < v2)) ? ((v3 > a0[9]) / 6) : ((a1[3][9] > a0[13]) != (a1[2][12] == v1)));
+        v3 = (((v1 * v3) != (v1 + a0[11])) > ((a1[1][6] ? v0 : v3) / 3));
+        v0 = (((v2 >= v1) == (v1 || v0)) <= ((80 > v1) < (v1 ? a1[1][9] : 32)));
+    } else {
+        a1[3][15] = (((v3 != 71) ? (v1 < v0) : (71 - v1)) / 8);
+        v1 = (((v3 >= 82) != (v3 <= 23)) ? ((a0[4] && v1) > (a1[1][10] / 7)) : ((v1 - a1[3][0]) < (41 * v3)));
+        a0[1] = (((44 ? 11 : v1) * (v1 * v2)) ? ((24 % 2) <= (92 % 3)) : ((a0[10] * v1) || (v0 && a1[3][15])));
+    }
+    if ((((a1[1][12] * v2) + (v0 <= v2)) <= ((1 / 5) && (v2 * 91)))) {
+        v3 = (((86 * v3) ? (69 <= a0[14]) : (a0[13] / 6)) != ((a0[4] <= 98) <= (v2 && 19)));
+        v2 = (((v2 <= v0) >= (a0[8] - 57)) < ((a1[3][1] % 9) != (v3 > v3)));
+        a0[10] = (((v0 >= v0) % 2) < ((12 ? a1[1][14] : a0[7]) >= (v1 - 81)));
+    } else {
+        v3 = (((a1[2][0] <= 92) < (v1 <= v1)) - ((v3 < v1) == (v3 && v2)));
+        v1 = (((v0 + v3) / 2) <= ((v2 ? v0 : v3) || (v3 - 78)));
+        a1[1][14] = (((v2 || 36) && (v0 <= v0)) > ((a1[2][3] <= v1) <= (a0[9] && v3)));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                if ((54 == 70) > 97) break;
+                a0[13] = (((i1 * 61) > (a1[0][9] * v3)) ? ((a0[1] + v2) && (v2 == 47)) : ((a1[0][3] != v3) * (5 <= a1[0][12])));
+                v2 = (((v1 >= i1) % 1) ? ((v2 ? 28 : v1) == (47 != 87)) : ((a0[12] ? 86 : 65) >= (12 + v3)));
+                v1 = (((16 || 0) || (v0 >= v0)) % 6);
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v0 = (((a0[14] <= 92) / 4) - ((44 / 7) == (i0 == i0)));
+        v0 = (((v2 <= v0) ? (a1[0][15] < v1) : (21 > v0)) / 1);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a1[1][8] < 10) > 62) break;
+            a1[1][10] = (((a0[3] % 4) == (48 - a1[1][14])) ? ((i2 < i2) / 7) : ((v1 * v3) + (v2 <= a0[6])));
+            v1 = (((v2 < i2) + (v3 < v3)) != ((1 * v3) >= (v1 >= i2)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v2 = (((a0[13] + i3) == (56 || a1[0][13])) < ((v2 + v2) <= (i3 >= 37)));
+                a1[0][4] = (((v1 != v3) + (v1 >= v0)) >= ((i3 ? i2 : i2) != (v3 + a0[10])));
+                v2 = (((28 + a1[0][15]) && (v0 % 8)) <= ((v1 && i3) ? (v1 * 66) : (v2 * 59)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        v1 = (((29 ? 98 : v2) == (19 ? v0 : v0)) != ((i4 ? v3 : i4) > (v3 != v3)));
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                if ((i5 && i4) > 90) break;
+                v2 = (((v3 % 8) <= (i4 >= a0[4])) > ((90 == i4) == (i4 + a0[14])));
+                v2 = (((i5 == i4) >= (v2 == v3)) ? ((a1[2][11] >= a0[9]) * (v1 || v0)) : ((i5 - v0) || (23 ? a1[0][1] : v2)));
+                v2 = (((7 >= a1[0][9]) ? (a0[9] >= v1) : (v0 == v1)) ? ((a1[2][13] + a0[8]) >= (v2 + v1)) : ((v0 >= a0[10]) == (a0[6] <= a1[1][0])));
+                i5 = i5 + 1;
+            }
+        }
+        v1 = (((68 * a1[2][9]) || (a1[3][0] - v1)) / 9);
+    }
+    return (((v3 ? v2 : v0) && (v0 != 35)) % 5);
+}
+int main() {
+    return 0;
+}
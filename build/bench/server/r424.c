@@ -0,0 +1,126 @@
+int f0() {
+    int v0 = 49;
+    int v1 = 45;
+    int v2 = 78;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v2 = (((a0[4] && a1[3][9]) / 9) != ((a1[0][12] < v2) % 3));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v2 = (((97 || 85) / 4) * ((a0[0] ? v3 : i0) || (v3 % 5)));
+                a0[14] = (((29 || a0[8]) && (4 || a1[1][6])) && ((25 != 77) >= (78 == 8)));
+                a0[8] = (((23 && 57) - (v0 > v1)) ? ((a1[2][8] % 4) >= (44 % 1)) : ((i0 == v1) * (v0 / 2)));
+            }
+            v1 = (((v1 * v1) > (v2 > v2)) < ((v0 <= 29) % 6));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v2 >= v2) > 77) break;
+            v1 = (((15 < a1[2][1]) + (v0 - a1[0][2])) ? ((69 / 5) != (a0[5] == v2)) : ((64 >= 8) && (v0 + a1[1][3])));
+            v3 = (((v3 > a1[3][0]) / 4) / 5);
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    if ((9 || a0[2]) > 51) break;
+                    a0[9] = (((i3 / 8) + (a1[0][8] / 5)) <= ((a0[14] * 54) > (i2 >= a1[2][8])));
+                    a1[1][11] = (((8 ? v0 : v1) > (v1 + a0[12])) != ((69 + i3) - (v2 && v3)));
+                    v1 = (((a0[12] >= a0[9]) * (v2 * v2)) < ((a0[5] + v1) <= (81 ? 37 : v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        a1[1][3] = (((v1 % 1) * (a0[7] != v0)) - ((v1 != v3) && (7 == v3)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v3 = (((84 || v1) <= (42 ? 78 : i5)) < ((a1[1][3] - v0) >= (a0[9] - v3)));
+                v2 = (((81 == i5) ? (a1[1][11] % 8) : (v1 + 51)) - ((a1[2][2] * i4) < (v1 >= a0[14])));
+                v2 = (((a1[0][14] >= 56) != (v0 != a0[0])) - ((a0[1] || 25) != (a0[3] >= 38)));
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((v2 == v3) && (a0[2] ? v3 : i4)) == ((v2 + v0) != (v3 && v3)));
+    }
+    v1 = (((78 == v1) ? (v2 <= v0) : (v1 && v1)) ? ((a0[9] != v0) % 6) : ((v2 > v2) + (44 - v2)));
+    if ((((v1 < v2) * (28 % 9)) != ((a1[1][9] < v1) * (v2 > a1[0][4])))) {
+        a0[11] = (((v0 * v2) ? (v1 < v2) : (v1 > v2)) - ((v3 <= a0[2]) / 4));
+        v2 = (((v1 || a0[15]) || (v3 || v1)) + ((a1[2][2] && 91) > (v1 < 6)));
+        v1 = (((v1 + a1[0][7]) != (a0[13] < v1)) % 1);
+    } else {
+        v0 = (((a1[2][12] == v3) - (80 ? 61 : v3)) >= ((80 || a1[1][9]) % 8));
+        a0[6] = (((73 == a0[13]) * (a0[1] - v2)) == ((a1[1][11] - v1) - (a1[3][12] == v1)));
+        v1 = (((v0 || a1[2][6]) + (15 + a0[2])) >= ((70 % 8) <= (a0[4] ? v1 : v2)));
+    }
+    return (((v1 || 8) > (a1[0][0] == a0[11])) >= ((v2 % 1) != (a0[10] && 13)));
+}
+int f1() {
+    int v0 = 33;
+    int v1 = 7;
+    int v2 = 90;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v0 = (((v2 < i1) / 1) >= ((a1[2][10] % 8) - (a1[0][15] ? 14 : v3)));
+                a1[1][4] = (((a1[1][6] / 2) % 8) >= ((v2 < v1) && (35 / 1)));
+                a0[4] = (((v0 || a1[3][7]) || (a0[8] + 21)) == ((i1 != v0) ? (v1 > a1[2][14]) : (v2 + a0[6])));
+            }
+            v2 = (((v2 != a1[2][1]) != (v2 ? v1 : 74)) ? ((a1[3][9] || i0) + (a1[0][13] >= v3)) : ((79 <= v2) % 2));
+            v3 = (((a0[12] != v3) % 5) < ((59 / 4) != (v0 <= a0[6])));
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v0 == a1[0][13]) || (91 / 5)) != ((59 > v1) && (v1 * 71)));
+    if ((((82 / 7) != (v0 > 66)) > ((v3 - v1) && (v2 != v2)))) {
+        a1[2][7] = (((v0 <= 76) % 1) || ((56 % 7) ? (v1 <= v2) : (a0[7] && a0[6])));
+        v3 = (((v3 == v2) != (a1[0][12] || v0)) / 9);
+        v3 = (((v0 ? 58 : v1) >= (32 + v2)) + ((v3 != v1) + (v3 && 58)));
+    } else {
+        a0[11] = (((29 > v2) >= (v3 && v2)) && ((88 >= a1[0][12]) / 9));
+        a0[11] = (((v2 - a1[2][6]) < (84 + a0[11])) != ((v0 < a0[1]) * (v2 / 1)));
+        v2 = (((v0 + v3) - (99 != 66)) < ((v3 > v0) / 3));
+    }
+    if ((((29 >= v1) ? (a0[6] > v2) : (v2 <= v1)) > ((a1[3][5] == 10) ? (a1[0][11] > 65) : (v2 * v2)))) {
+        v3 = (((v3 <= 18) ? (11 - 66) : (v3 < v0)) + ((v1 >= v3) != (0 ? v3 : a0[4])));
+        v1 = (((a0[5] * a1[2][9]) * (41 + a1[0][8])) + ((v1 < v3) && (v0 > v3)));
+        v2 = (((v0 % 9) == (a0[7] * a0[2])) ? ((a0[9] + 14) >= (a0[2] > v0)) : ((a0[12] <= v3) / 4));
+    } else {
+        v1 = (((a0[4] != 25) ? (a1[2][1] - 71) : (57 != a1[1][14])) + ((57 / 1) != (v0 * v2)));
+        a0[12] = (((78 == 41) != (v0 > v2)) - ((35 / 7) - (a0[4] || 5)));
+        v0 = (((v2 != v0) % 8) % 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((13 <= v0) > 77) break;
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a0[0] / 7) / 8) >= ((v1 > a1[2][7]) ? (i2 ? 12 : v0) : (a0[14] != a0[13])));
+                    v2 = (((a1[0][9] + a0[10]) / 8) == ((71 - v2) <= (i3 && 90)));
+                    v3 = (((a1[2][3] && 1) && (a1[2][9] ? i2 : v0)) ? ((24 + v0) >= (v0 ? 54 : v1)) : ((69 < i2) % 5));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            v0 = (((v2 || a1[0][10]) ? (v0 != i2) : (94 < a0[6])) ? ((a1[3][14] + v2) == (v1 ? v3 : v3)) : ((a0[2] ? v2 : i2) + (47 - a0[11])));
+            a0[2] = (((12 <= v0) || (a1[0][1] || a0[13])) ? ((v3 ? 93 : a0[7]) % 9) : ((v3 + v1) > (70 / 4)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    return (((69 < 73) || (a0[2] * a0[14])) ? ((v1 + 48) <= (a0[3] % 9)) : ((83 || v1) != (v1 + a1[0][11])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,168 @@
+int f0() {
+    int v0 = 10;
+    int v1 = 22;
+    int v2 = 99;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    a0[6] = (((a1[0][0] + v2) < (v0 <= v0)) > ((v2 ? v3 : v3) != (59 >= 26)));
+    if ((((v1 > 6) == (v2 ? a1[0][2] : v2)) ? ((v0 / 8) >= (16 - v0)) : ((v0 + v1) + (v2 % 5)))) {
+        a0[8] = (((v2 != v2) % 3) * ((v1 < 42) ? (v1 % 3) : (v3 / 2)));
+        v0 = (((70 < a0[3]) == (a1[0][2] / 3)) <= ((v3 != v3) && (v3 > a0[15])));
+        v0 = (((v2 > v1) * (53 * a1[2][15])) >= ((v3 < 85) * (a0[6] == a1[1][12])));
+    } else {
+        v1 = (((39 > 93) / 9) < ((a1[1][6] || v0) && (a0[5] <= a0[4])));
+        a1[1][6] = (((v0 + a0[0]) <= (63 != a1[2][5])) == ((v3 - 58) * (v3 > 93)));
+        v1 = (((v2 != 74) <= (v0 ? a1[2][9] : a0[6])) && ((v2 || a0[11]) / 8));
+    }
+    v3 = (((a1[2][13] ? v1 : v2) / 4) <= ((v3 && a0[15]) - (v0 < v1)));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v0 = (((a0[7] < i1) % 3) + ((i0 / 9) <= (v1 < v1)));
+                    v1 = (((a0[3] >= i1) || (a1[3][12] ? 68 : v1)) * ((35 < a1[3][0]) != (5 != 87)));
+                    a1[0][8] = (((i1 || i1) - (v1 == a1[0][0])) / 9);
+                    i1 = i1 + 1;
+                }
+            }
+            a1[3][5] = (((v1 != 50) ? (65 != a0[12]) : (33 ? v0 : i0)) % 2);
+            v0 = (((i0 >= v3) ? (a0[12] % 6) : (81 - v2)) + ((a0[2] >= v0) - (a1[1][12] ? 92 : v0)));
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((12 ? v3 : v2) - (v2 || v0)) % 1);
+    return (((v1 - v0) || (v2 - v2)) <= ((v0 > v1) <= (33 == v1)));
+}
+int f1() {
+    int v0 = 15;
+    int v1 = 73;
+    int v2 = 76;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        a0[13] = (((85 ? 94 : v0) > (v2 - a1[3][10])) > ((v0 * v0) > (a0[6] >= 88)));
+        v0 = (((v1 > v3) % 2) ? ((29 % 1) ? (v3 > v3) : (a1[3][0] >= v3)) : ((v0 || i0) >= (a1[1][5] <= a1[0][12])));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            if ((v0 % 5) > 67) break;
+            v2 = (((a1[3][1] >= 25) == (v1 == a1[0][4])) - ((88 % 9) != (37 - v2)));
+            v2 = (((a0[11] ? 64 : v0) ? (v1 ? 50 : v3) : (15 * 87)) && ((i0 == v1) < (i0 + v3)));
+            v0 = (((i1 <= i1) - (a0[7] / 6)) || ((7 == i1) + (89 || i1)));
+        }
+    }
+    if ((((v1 % 6) % 2) <= ((91 - 32) == (v2 > 62)))) {
+        a1[2][2] = (((55 || a1[1][8]) == (v0 != v3)) >= ((v0 != a0[11]) % 7));
+        a1[1][12] = (((v3 / 3) > (98 ? v3 : 12)) + ((v0 != v0) > (28 ? a1[0][6] : v1)));
+        v2 = (((v1 * 33) / 9) * ((v3 > a0[9]) != (v1 ? 47 : 48)));
+    } else {
+        v3 = (((v3 == v0) == (v1 + a0[11])) <= ((v2 ? a1[3][6] : v0) / 7));
+        a1[1][3] = (((v0 == v0) != (a0[10] < a1[0][6])) < ((64 >= a0[5]) >= (a0[6] < 76)));
+        a1[0][12] = (((v0 <= v3) * (v1 ? 20 : v3)) && ((0 % 2) >= (v3 < a1[2][5])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v1 = (((v0 && a0[2]) ? (29 > a0[0]) : (29 >= 65)) ? ((70 * v1) ? (v1 || v2) : (v1 >= v0)) : ((a0[3] ? i2 : i2) == (a1[3][8] > a0[12])));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((a1[0][15] ? 76 : 2) > 76) break;
+                a0[12] = (((38 - 2) == (53 ? 0 : a0[13])) * ((a0[12] ? v2 : v1) < (v1 * a1[1][2])));
+                v2 = (((23 + a0[0]) > (29 <= 7)) ? ((v3 / 3) ? (a0[4] < v1) : (v1 == 18)) : ((15 != 22) == (a0[1] && i3)));
+                v0 = (((48 || 53) - (a1[0][14] + a1[3][2])) / 1);
+            }
+            a0[8] = (((v3 && i2) + (15 * i2)) <= ((a1[0][12] / 7) ? (35 / 8) : (i2 >= i2)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v1 = (((57 && v3) ? (i4 == a1[1][12]) : (v1 <= a0[12])) ? ((66 + v2) % 9) : ((v1 != a0[13]) && (13 - a1[3][15])));
+                a0[15] = (((76 == i4) - (v3 >= v3)) || ((v0 >= a0[12]) - (i4 < v2)));
+                a0[2] = (((v2 || v3) ? (49 ? a1[3][12] : i5) : (60 % 5)) <= ((a0[6] > 23) ? (v2 != v2) : (i4 / 8)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        v3 = (((a1[2][6] ? v1 : v1) <= (v1 - v3)) + ((v0 || v2) * (14 ? v0 : a1[0][2])));
+        a1[2][3] = (((v2 / 2) < (a0[9] < v1)) && ((i4 / 1) && (i4 * v0)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a0[9] = (((a0[12] / 7) != (a1[2][3] > 49)) != ((a1[3][9] != v3) && (v2 ? 82 : a1[0][13])));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    a0[11] = (((v2 * i6) <= (v0 < 48)) != ((v0 <= v0) * (i6 >= a1[0][5])));
+                    a0[13] = (((9 ? a1[0][10] : 23) / 9) - ((v0 * 40) ? (v0 / 6) : (i6 / 2)));
+                    a1[1][14] = (((i7 != i6) >= (i7 == a1[2][11])) - ((v2 % 4) < (73 || i7)));
+                    i7 = i7 + 1;
+                }
+            }
+            v2 = (((v3 && a1[1][3]) % 8) <= ((v3 > a0[14]) < (15 ? v3 : 23)));
+            i6 = i6 + 1;
+        } while (i6 < 3);
+    }
+    return (((a1[0][2] < 49) ? (v0 - v0) : (a0[1] >= v2)) + ((v1 && 19) ? (15 > a0[13]) : (a0[14] - 1)));
+}
+int f2() {
+    int v0 = 24;
+    int v1 = 14;
+    int v2 = 10;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v3 ? v2 : v2) >= (69 >= v2)) != ((v1 >= 2) ? (86 < v1) : (56 > v2)));
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v1 = (((a0[7] <= 21) <= (a0[7] - a1[2][9])) && ((15 % 7) == (a0[7] > 33)));
+        {
+            int i1 = 0;
+            do {
+                a0[8] = (((6 >= v1) - (96 >= i1)) >= ((i1 != v0) || (v1 - v1)));
+                v1 = (((29 > a0[4]) != (v3 != 0)) - ((5 == a0[11]) && (76 % 7)));
+                v0 = (((i1 && 66) ? (38 > a0[4]) : (a1[1][8] <= a1[0][13])) - ((53 == 96) == (55 ? 16 : v3)));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v3 = (((63 || v0) == (a1[0][12] != a1[2][13])) || ((v2 < v3) >= (v0 != i0)));
+    }
+    if ((((a1[3][11] * 44) + (v1 ? a0[13] : 19)) - ((a0[12] == 91) > (35 || v3)))) {
+        v1 = (((a1[0][1] * v3) && (a0[5] && v2)) * ((a0[15] / 9) / 9));
+        v3 = (((v0 && 54) && (v1 / 9)) && ((a0[15] > 47) != (a0[8] || a1[3][13])));
+        a1[3][13] = (((20 == 29) ? (v3 || a1[2][10]) : (v3 != 90)) ? ((28 && a1[0][8]) == (a1[0][9] ? 33 : v3)) : ((a1[2][0] + a0[14]) ? (a0[5] ? v3 : 20) : (v1 % 3)));
+    } else {
+        a1[2][3] = (((v1 / 8) || (37 / 9)) <= ((v2 / 5) < (v2 || v3)));
+        a0[0] = (((71 > 71) + (a0[13] == a0[3])) - ((v3 > v1) > (v2 && a0[12])));
+        v1 = (((v2 != v1) != (a0[15] > v1)) > ((v2 * v3) == (v1 ? 98 : v1)));
+    }
+    if ((((a0[7] && v2) || (v0 && a1[3][3])) < ((v0 > 0) < (v1 || a1[3][7])))) {
+        a0[0] = (((a0[1] > v1) / 5) && ((v3 ? 25 : v1) >= (96 % 4)));
+        a0[3] = (((a0[5] != 80) == (25 >= 76)) ? ((v2 ? v1 : a1[0][5]) || (a0[6] - 37)) : ((75 * 90) ? (65 < 5) : (v2 < v0)));
+        a0[3] = (((57 >= v2) >= (v2 && v2)) >= ((a0[2] * a1[0][14]) != (a1[2][9] || a1[3][12])));
+    } else {
+        v3 = (((7 || 35) >= (75 <= a0[0])) < ((a0[6] - a0[1]) > (a0[6] && v0)));
+        v3 = (((4 <= 34) / 4) * ((v0 > v1) ? (v0 || a0[4]) : (v1 != 44)));
+        v3 = (((a1[3][11] == 34) == (v3 == v0)) * ((v2 || v0) + (62 % 8)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a0[6] = (((a1[1][14] < 69) <= (v0 < 45)) <= ((a1[1][9] >= v3) != (a0[6] % 9)));
+        v1 = (((61 && v1) / 6) + ((a1[3][10] % 9) % 8));
+        {
+            int i3 = 0;
+            do {
+                if ((v3 <= a0[3]) > 50) break;
+                v2 = (((v3 < 64) || (a1[0][5] * v3)) * ((a0[3] % 1) && (a0[7] - v0)));
+                v3 = (((v3 - i2) > (89 < a1[2][6])) <= ((a1[0][10] / 3) && (a1[3][14] % 3)));
+                a1[1][10] = (((v0 && 12) <= (a1[3][1] == 6)) + ((39 && v1) || (69 * a0[1])));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    return (((v3 < 26) * (88 <= 83)) != ((v1 / 6) == (v3 * v3)));
+}
+int main() {
+    return 0;
+}
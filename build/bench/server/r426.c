@@ -0,0 +1,62 @@
+int f0() {
+    int v0 = 94;
+    int v1 = 27;
+    int v2 = 10;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v3 = (((16 - a1[2][3]) > (v2 / 2)) || ((56 && v1) * (74 != v1)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a0[11] = (((v0 / 5) * (a0[0] - v1)) != ((94 - a0[8]) % 3));
+                    v1 = (((v0 * a1[3][4]) || (89 <= i0)) * ((v2 ? v0 : a0[2]) || (34 % 5)));
+                    a1[2][4] = (((a1[2][11] == 28) / 1) >= ((i1 - v1) ? (v0 / 5) : (i1 / 4)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a0[10] >= v3) + (62 / 4)) ? ((a0[8] * 42) % 9) : ((a1[3][14] ? a1[0][4] : v0) > (80 + i0)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((a0[5] < v2) && (a0[15] > a1[2][14])) + ((a0[12] == v1) >= (v0 * a0[1])));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((i2 || i2) % 9) || ((54 + a1[3][2]) * (v0 ? v3 : i3)));
+                    v3 = (((1 - i2) - (a0[6] + v1)) - ((a0[10] || v2) - (v0 * v2)));
+                    v0 = (((58 <= a0[12]) && (v2 && i3)) + ((a1[1][1] % 1) != (a0[6] ? v0 : v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v2 = (((a1[2][7] || a1[1][15]) * (a1[2][4] % 1)) == ((i2 < v2) < (v1 * v0)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    v1 = (((v0 % 7) ? (21 <= v3) : (v1 < a1[1][2])) ? ((a1[0][0] && 8) != (v3 == v0)) : ((a1[0][3] + v3) / 1));
+    v3 = (((v0 < v2) < (a0[3] || v3)) < ((v1 / 4) ? (v2 != a1[1][6]) : (v3 || 61)));
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                if ((i5 * 54) > 91) break;
+                a1[3][7] = (((v2 / 3) + (v2 < 20)) + ((13 * v3) % 9));
+                v1 = (((a1[3][8] / 9) <= (v1 >= a1[2][7])) && ((9 > 92) + (a1[0][12] * i4)));
+                v2 = (((9 * v0) + (i5 + 7)) >= ((38 / 2) - (i4 == a0[15])));
+            }
+            v1 = (((5 * v0) < (a0[0] - v2)) - ((i4 == i4) && (a1[3][4] > v3)));
+            a1[3][10] = (((i4 == v3) * (62 && v3)) - ((v1 ? v3 : v2) <= (35 % 3)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[0][12] <= v2) == (a0[13] != a1[3][11])) != ((v3 == v1) || (a1[2][7] || v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,110 @@
+int f0() {
+    int v0 = 52;
+    int v1 = 23;
+    int v2 = 2;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((39 % 1) > 71) break;
+        v0 = (((a0[0] < v0) < (v1 > v0)) && ((1 ? v2 : i0) > (77 + v3)));
+        v1 = (((v2 * 49) <= (68 == 26)) / 3);
+        {
+            int i1 = 0;
+            do {
+                v0 = (((i0 || i0) - (v0 / 9)) < ((84 > v1) + (v1 ? a0[4] : v2)));
+                a0[3] = (((54 + v1) <= (a1[2][12] && v0)) % 2);
+                v2 = (((71 % 3) ? (v0 * 51) : (a0[3] ? a0[4] : a1[0][9])) ? ((v3 / 9) * (a0[14] * a1[3][2])) : ((v0 ? v0 : v0) > (v3 && a1[1][3])));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v2 = (((v0 == v1) <= (a1[2][12] == v2)) && ((a1[3][8] < v1) != (v0 >= v0)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v0 = (((a1[2][2] < v2) + (v0 ? v2 : a0[9])) % 5);
+                a1[3][14] = (((31 % 9) % 4) > ((a1[2][5] && i3) * (v1 != a0[4])));
+                v1 = (((a1[1][0] == i2) / 4) <= ((36 ? 15 : i3) != (v3 || v2)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((a1[0][13] - a1[2][14]) / 4) <= ((v1 < a1[3][14]) != (v1 / 2)));
+    }
+    if ((((v3 ? v0 : v3) && (v0 < v0)) ? ((a0[11] >= 94) % 1) : ((v0 + v0) && (a1[3][2] % 7)))) {
+        a1[2][4] = (((v0 * a1[3][2]) / 8) + ((20 > 53) ? (94 ? v1 : v0) : (v1 - a1[2][12])));
+        v1 = (((19 ? 79 : v3) / 6) != ((9 ? v1 : v1) <= (76 ? a0[6] : a1[1][7])));
+        v3 = (((v3 + v1) < (98 < a0[12])) == ((v1 / 4) && (a0[4] <= v0)));
+    } else {
+        a0[8] = (((a0[2] % 8) ? (27 > v3) : (v1 * a1[2][10])) && ((38 < 35) != (v1 || a0[2])));
+        v1 = (((14 ? 31 : a1[3][9]) == (a1[2][15] >= 1)) != ((v2 ? v3 : 66) ? (v0 - v0) : (v0 > v0)));
+        v0 = (((v0 * v2) ? (v1 ? a0[10] : v0) : (a0[1] + a1[3][14])) + ((a0[1] ? a1[0][3] : 3) == (v0 != v0)));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                v2 = (((v2 || v2) ? (66 >= a0[15]) : (v1 && a1[1][3])) < ((a1[0][15] ? i4 : a1[3][1]) == (46 < 96)));
+                v2 = (((v2 <= v2) ? (v1 + v0) : (v3 || i5)) == ((a1[0][3] <= 39) > (v0 < i5)));
+                v0 = (((i5 || i5) == (a0[8] ? 37 : i4)) / 9);
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+        a1[0][6] = (((v1 + v2) && (v1 ? v3 : 99)) <= ((v3 && 23) >= (v0 == a0[3])));
+        v3 = (((a1[3][10] || a1[3][2]) + (v0 > v2)) <= ((v1 * a1[3][3]) >= (v2 && v3)));
+    }
+    v3 = (((a1[0][10] != v1) / 8) == ((13 ? a0[7] : a0[4]) < (a1[0][4] > v3)));
+    return (((v1 > v1) < (a1[1][8] >= a1[3][10])) ? ((v1 && a0[15]) * (v2 == 51)) : ((v3 > v0) <= (a0[1] / 6)));
+}
+int f1() {
+    int v0 = 28;
+    int v1 = 28;
+    int v2 = 24;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v1 / 8) > 68) break;
+            a1[0][11] = (((a1[3][7] * a0[7]) < (a0[8] <= a0[9])) < ((36 + v0) * (v1 > 67)));
+            v3 = (((2 == a0[0]) < (a0[6] % 9)) < ((i0 > 82) || (34 || a0[8])));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v3 = (((a1[1][9] * 16) + (i0 || v0)) >= ((v1 && 36) % 9));
+                v3 = (((v3 * 55) && (v3 + a1[1][14])) ? ((v0 == 67) * (v2 > v0)) : ((i1 > v3) && (a1[2][13] > 48)));
+                v0 = (((a1[1][15] + v1) || (v3 / 1)) || ((v1 / 3) + (21 == v3)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v0 <= v3) + (a1[3][12] / 1)) <= ((65 < v2) / 7));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((a1[3][2] + v2) > 73) break;
+            v1 = (((v2 ? v1 : v2) == (i2 * a0[3])) < ((v2 || 44) * (v0 * 92)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a1[3][14] = (((v1 && 16) || (a1[0][3] * i3)) - ((a0[15] || a1[0][13]) > (55 * 69)));
+                v1 = (((v1 != a1[1][12]) < (71 + a1[2][10])) ? ((a1[3][15] < i3) ? (a0[15] * i2) : (v3 == 89)) : ((v3 ? 7 : a1[1][2]) <= (95 ? 9 : v2)));
+                v2 = (((78 > i2) && (a1[1][9] || v3)) > ((v1 * a1[0][6]) ? (37 / 9) : (a0[14] < a0[0])));
+            }
+            v1 = (((18 * v3) > (a0[13] * i2)) % 7);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((51 != v1) < (a0[5] && 18)) && ((v1 <= a1[2][3]) < (99 || v1)))) {
+        a1[0][5] = (((a0[15] * 42) % 9) ? ((v2 >= a0[7]) <= (18 == v1)) : ((v1 ? 89 : v0) >= (v0 / 9)));
+        v1 = (((v1 > v0) > (a1[2][2] > a0[10])) > ((v3 * v2) ? (v0 || v2) : (v1 / 3)));
+        a0[12] = (((v3 ? a1[1][8] : v3) == (v2 * 84)) || ((v1 != a1[1][5]) != (a0[9] && v3)));
+    } else {
+        v2 = (((v3 <= v2) / 3) == ((a1[1][4] ? 82 : a0[13]) * (v2 != v3)));
+        v2 = (((a0[11] || v0) * (65 || 23)) ? ((70 <= 76) && (v2 % 7)) : ((75 < v1) ? (22 != a1[2][4]) : (a0[10] + v0)));
+        v2 = (((73 + v3) * (v0 <= v3)) || ((a0[3] ? a0[7] : v1) == (v0 < a1[3][4])));
+    }
+    v1 = (((a0[15] && 51) - (a1[1][0] >= 20)) - ((v3 % 6) * (83 > v3)));
+    return (((v1 < 88) != (v3 != a1[1][2])) || ((v3 * v2) * (a1[2][3] && v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,175 @@
+int f0() {
+    int v0 = 59;
+    int v1 = 81;
+    int v2 = 94;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 < v3) ? (v3 ? 84 : a1[3][1]) : (18 ? v1 : a0[10])) ? ((a1[1][2] + v2) > (a0[1] > v2)) : ((v2 / 8) == (a1[2][0] - a1[3][3])))) {
+        v1 = (((v0 - a0[5]) + (90 == v2)) <= ((v3 / 6) * (v2 * v2)));
+        v2 = (((a0[14] == v3) && (46 > 46)) != ((v0 ? 84 : a0[13]) % 8));
+        v3 = (((v1 / 4) + (v1 + v0)) < ((a1[1][15] <= v2) >= (v0 < v3)));
+    } else {
+        v2 = (((48 % 3) <= (v2 * v0)) - ((v0 / 2) / 6));
+        v3 = (((a0[14] + v3) != (v3 % 1)) != ((54 != v2) / 9));
+        v1 = (((a0[11] ? v0 : 68) || (v3 != 63)) && ((a1[1][1] - 8) > (v0 / 3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((i0 && v1) > 75) break;
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((66 || i0) % 2) > ((v2 ? 72 : i0) ? (v3 % 9) : (75 ? v1 : 95)));
+                    v1 = (((a1[0][11] % 6) == (v3 ? v2 : 74)) * ((99 > v1) ? (a1[3][1] <= 44) : (i1 / 4)));
+                    v0 = (((51 - 9) - (v2 + 97)) - ((v0 && i0) + (v3 / 2)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            a0[3] = (((i0 != 12) != (v3 + i0)) >= ((a1[2][10] <= 89) - (v3 || v1)));
+            v1 = (((55 * 53) + (80 > a0[10])) - ((33 - a0[13]) != (v1 != 19)));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v1 && v3) % 4) > ((v3 > v1) + (v0 ? a0[3] : v2)));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a0[14] = (((89 <= v1) <= (i2 * 42)) - ((23 || v1) - (a0[1] >= a1[1][9])));
+            v1 = (((a0[7] % 5) ? (a0[14] ? i2 : 99) : (i2 != 96)) || ((v1 || v3) && (31 + v1)));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((v1 * 92) > 74) break;
+                    v3 = (((v1 % 8) - (v0 > a1[1][14])) <= ((i3 >= 31) + (a0[4] ? v3 : i2)));
+                    v2 = (((3 % 6) == (91 ? v1 : a1[3][8])) % 4);
+                    a0[12] = (((56 >= a0[5]) ? (v1 >= 31) : (v3 || 96)) && ((a0[7] / 7) != (a1[2][2] ? v0 : 10)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v3 == v3) != (a0[14] > v0)) < ((v0 % 1) - (a1[3][11] >= v3)));
+    return (((v2 ? v0 : v2) > (v1 ? 74 : v2)) > ((v0 > v1) == (a1[2][7] > v3)));
+}
+int f1() {
+    int v0 = 95;
+    int v1 = 87;
+    int v2 = 13;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((20 || v3) % 9) >= ((v3 - v2) - (v0 % 2)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((a0[1] % 3) > 78) break;
+        a1[1][7] = (((67 < a1[1][11]) == (2 ? v0 : 71)) % 5);
+        {
+            int i1 = 0;
+            do {
+                a0[12] = (((v1 >= v1) * (2 - v3)) * ((v1 || 62) * (73 ? 66 : 57)));
+                v1 = (((86 * a1[1][4]) + (v3 >= a0[14])) <= ((v2 < v2) && (91 ? a1[0][10] : v3)));
+                a0[7] = (((a0[8] / 2) % 2) > ((a0[9] > v2) / 4));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+        v0 = (((a0[7] || a1[1][3]) != (a1[1][5] + a1[1][7])) ? ((a1[3][15] * 78) + (65 / 9)) : ((92 > v0) * (a1[3][2] % 3)));
+    }
+    if ((((v1 * v0) > (v0 ? v2 : v0)) - ((44 > v0) < (67 / 5)))) {
+        a1[3][8] = (((v1 - v3) <= (v3 * v1)) || ((64 < 48) && (a0[7] % 2)));
+        a1[3][14] = (((v1 / 6) % 3) == ((a0[13] + v2) > (a0[1] && v3)));
+        a1[1][12] = (((v3 / 7) + (v0 || a0[14])) / 9);
+    } else {
+        v3 = (((v2 <= v1) % 1) - ((v0 ? a1[1][7] : v3) || (a1[1][1] && a1[1][2])));
+        a0[15] = (((a1[2][7] == v0) / 7) >= ((a1[1][3] < 36) * (30 / 1)));
+        v1 = (((v3 && a0[10]) == (v0 <= v1)) ? ((v2 < 8) == (37 != v1)) : ((a0[6] - v0) ? (a0[0] >= a1[1][0]) : (v3 == v3)));
+    }
+    v3 = (((v0 > v0) * (v3 ? 34 : v2)) == ((v0 != v3) < (16 - 19)));
+    v2 = (((a1[1][10] <= v2) % 3) + ((v1 * v3) * (v1 / 3)));
+    return (((v2 - v3) > (v1 + 71)) - ((11 <= v2) < (v2 >= v2)));
+}
+int f2() {
+    int v0 = 54;
+    int v1 = 48;
+    int v2 = 32;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][15] >= v0) - (a1[1][2] - a0[10])) >= ((v1 ? v0 : 67) || (67 + a1[1][1])))) {
+        v0 = (((a0[14] - v0) == (v0 * a1[0][12])) == ((51 || v0) <= (v2 != v2)));
+        v3 = (((v1 > 13) < (v0 > a1[1][14])) ? ((a1[2][9] ? v2 : v2) == (0 <= 38)) : ((a0[1] < 66) != (29 % 8)));
+        v3 = (((41 || 14) && (v3 + v2)) || ((a1[1][0] > a0[2]) || (v1 && 20)));
+    } else {
+        v3 = (((v2 == v0) >= (v0 || v2)) ? ((a0[12] == v2) <= (v0 ? v3 : v3)) : ((v1 && a1[3][15]) == (a1[1][2] && a1[1][11])));
+        v3 = (((v2 == v1) >= (44 == v2)) != ((a1[0][14] < v0) && (v0 * v1)));
+        v0 = (((v2 > v2) == (a0[6] != 2)) != ((a1[0][1] - a1[3][9]) + (v2 / 6)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((a1[3][8] <= v0) > 90) break;
+            v1 = (((a0[15] > v2) * (v1 && a1[0][4])) <= ((v0 <= v1) > (82 != v3)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a1[0][15] > a1[2][2]) > (i0 != 51)) > ((a0[14] || i1) ? (v0 - 15) : (v3 == v0)));
+                    a0[15] = (((32 ? 35 : 89) <= (a1[2][12] >= a1[3][2])) == ((i0 / 2) <= (a0[11] < a0[12])));
+                    a0[12] = (((v0 > 53) <= (v0 % 5)) != ((v3 && v3) - (i0 == 56)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v2 = (((v1 <= 58) < (62 || a0[4])) != ((a1[0][14] <= v3) - (a1[2][8] * 48)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v1 - 39) > 64) break;
+            v0 = (((a0[11] <= v2) != (a1[0][8] - 35)) != ((v1 ? v3 : a1[3][1]) == (i2 ? v3 : v3)));
+            a1[0][14] = (((a1[0][14] + v0) + (v1 ? v2 : i2)) || ((94 * a0[9]) && (v2 - v0)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a1[3][6] = (((17 < a1[3][1]) / 6) - ((a1[0][8] < v3) % 5));
+                v2 = (((27 / 9) ? (26 / 8) : (92 % 8)) || ((v3 <= i2) / 2));
+                v1 = (((v1 + 91) % 1) != ((v2 && a0[12]) * (v0 * v1)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((a0[9] && v2) < (4 != v0)) != ((v2 ? v1 : 34) >= (v1 / 6)));
+            v1 = (((96 / 9) == (51 % 1)) == ((v0 && a1[2][3]) + (a1[1][8] + 31)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((v1 <= a0[5]) > 77) break;
+                v3 = (((74 + i4) != (8 >= v0)) > ((a1[1][8] / 9) % 6));
+                v3 = (((i5 <= 1) || (a1[3][2] < a1[0][1])) ? ((a0[0] * v1) < (i5 && a1[3][5])) : ((a1[2][6] ? v1 : v1) <= (14 >= v1)));
+                v2 = (((13 != 61) + (a1[1][13] && v2)) != ((v2 && v1) || (v2 >= a0[1])));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 8) {
+                    v2 = (((67 > a0[13]) <= (v1 ? v2 : i6)) && ((a1[3][12] - v3) || (a0[2] * a0[13])));
+                    a0[5] = (((58 * 46) - (a0[13] == 84)) != ((74 % 8) % 2));
+                    v3 = (((v1 <= i6) + (a1[0][8] <= v3)) / 1);
+                    i7 = i7 + 1;
+                }
+            }
+            a0[2] = (((v1 <= i6) - (v0 * i6)) && ((a1[1][10] < a0[11]) < (a0[15] > v1)));
+            v3 = (((38 + 30) + (67 % 8)) - ((v2 == v3) * (v2 + v1)));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    return (((v2 / 1) % 6) != ((80 * v0) ? (v0 < 58) : (v3 > a0[4])));
+}
+int main() {
+    return 0;
+}
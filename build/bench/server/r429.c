@@ -0,0 +1,61 @@
+int f0() {
+    int v0 = 25;
+    int v1 = 95;
+    int v2 = 39;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a1[3][3] - v2) >= (v1 && v0)) == ((v1 <= 11) ? (13 > a0[3]) : (v1 / 3)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v2 = (((v2 ? i0 : a0[6]) || (i1 && i1)) < ((96 - a0[2]) >= (35 ? 89 : v0)));
+                a0[15] = (((v1 / 9) + (i1 * v0)) - ((v2 + 79) <= (v2 ? v0 : 4)));
+                a0[1] = (((17 / 1) * (v3 >= a1[1][11])) && ((a1[1][11] + i0) % 9));
+            }
+            v2 = (((4 ? i0 : v1) % 1) >= ((40 >= v2) * (v2 > 9)));
+            v0 = (((a0[6] ? 41 : a0[0]) + (v3 && a0[13])) + ((v2 - v2) != (i0 % 5)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((83 > v1) % 2) % 2);
+            v0 = (((v0 + 59) ? (a0[8] && v2) : (v3 < 80)) + ((76 * v0) <= (v2 + v1)));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v3 = (((v0 && a1[3][5]) != (84 * 35)) ? ((i2 == a1[0][11]) > (a0[13] != i3)) : ((89 - 70) < (32 == a1[2][6])));
+                    v0 = (((i3 * v2) != (50 / 3)) || ((a0[6] > i2) != (i2 + 79)));
+                    v1 = (((96 || v0) ? (92 + v0) : (v1 - v3)) ? ((v3 != v2) != (v1 == v3)) : ((a0[4] || v0) <= (v2 > v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    v2 = (((v3 - 96) % 6) && ((v0 ? 6 : v1) / 4));
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v1 <= 82) > (a0[5] * a1[3][11])) && ((67 / 5) <= (a1[0][0] > a1[0][2])));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v3 = (((18 && v0) + (i5 * a0[13])) >= ((v3 * a1[3][11]) <= (a0[10] * a0[8])));
+                    v0 = (((a0[10] % 8) && (i5 - 38)) > ((v1 / 4) && (a1[2][14] ? v2 : v1)));
+                    v1 = (((v2 < v2) - (a1[3][9] && 54)) >= ((25 != i4) <= (9 ? v0 : 87)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v1 ? 65 : 56) % 4) + ((i4 || a1[2][9]) ? (v3 < v0) : (a0[2] != 84)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v0 % 5) * (v1 < v0)) != ((v3 < v1) && (v0 >= a1[1][14])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,120 @@
+int f0() {
+    int v0 = 32;
+    int v1 = 83;
+    int v2 = 57;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    a1[2][2] = (((1 * 86) + (v0 - 40)) ? ((1 || a0[8]) || (a1[3][0] && 33)) : ((v2 * v3) != (v3 && v2)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((a1[3][6] >= a1[1][1]) ? (22 / 8) : (57 && v0)) - ((i0 / 5) * (66 / 6)));
+                a1[1][10] = (((88 > 92) != (v3 + i0)) <= ((i1 < 58) <= (34 ? v0 : a1[0][4])));
+                v3 = (((26 <= v1) != (75 + a1[2][13])) != ((i0 > 40) >= (v1 != v1)));
+            }
+            v1 = (((51 != i0) || (v2 / 1)) % 8);
+            v3 = (((v0 / 1) && (0 * i0)) != ((i0 && v2) != (i0 ? a0[2] : v1)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((55 && v0) > 51) break;
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    a1[1][10] = (((a0[2] || a0[4]) >= (v2 ? i3 : v3)) + ((3 && a0[13]) >= (i3 == a1[1][6])));
+                    v2 = (((a0[2] && a1[1][9]) != (a0[8] != a0[3])) || ((v0 ? i2 : a0[6]) != (a0[9] % 4)));
+                    v0 = (((i3 ? 62 : 84) + (a0[9] ? v1 : 87)) || ((68 == a0[5]) ? (62 < 87) : (v1 + v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[3][0] = (((v1 ? v2 : v3) ? (v1 && a1[3][11]) : (v3 && 2)) && ((v2 && 85) && (v3 % 4)));
+            a0[15] = (((42 || 3) ? (a1[3][10] && 58) : (a1[2][1] + 10)) && ((a0[11] != i2) || (v3 / 9)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v0 % 6) && (a0[1] + v0)) <= ((a1[3][14] - 29) - (v1 / 9)))) {
+        a0[8] = (((a0[8] != 22) * (70 / 4)) ? ((a0[14] ? v1 : a0[11]) * (13 && v3)) : ((v3 && v3) * (34 <= v0)));
+        v2 = (((v2 > 40) < (a0[15] == a0[1])) * ((v1 + v3) < (a0[13] ? v3 : v2)));
+        v3 = (((a0[10] || 73) >= (v2 == a1[0][1])) >= ((16 * a0[6]) % 6));
+    } else {
+        a0[0] = (((3 <= 95) < (47 != a0[14])) <= ((v0 == v1) && (6 ? 80 : a0[3])));
+        v0 = (((v0 / 4) * (v0 == v0)) + ((82 + a0[15]) >= (v3 > a0[8])));
+        v2 = (((65 ? v1 : a1[1][9]) == (a1[0][0] && a1[3][11])) % 1);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    if ((v1 && 16) > 71) break;
+                    v1 = (((i4 || 50) > (v0 / 5)) ? ((v3 == a0[10]) > (a0[10] * i4)) : ((i4 ? a1[0][14] : 54) < (53 - 3)));
+                    a0[15] = (((a1[3][0] - v1) != (i5 ? a0[12] : v3)) <= ((74 && 2) > (v1 ? 42 : 15)));
+                    v0 = (((v2 && a1[3][13]) ? (i4 || a0[15]) : (i5 < a1[2][1])) == ((a0[0] == 10) < (v0 != a1[2][13])));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((a1[2][6] / 7) || (i4 * v3)) % 8);
+            v2 = (((a1[3][12] * a1[3][9]) && (i4 <= v1)) >= ((v1 == v1) < (3 < 72)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 && v2) > (a1[2][2] && a1[3][9])) / 5);
+}
+int f1() {
+    int v0 = 90;
+    int v1 = 15;
+    int v2 = 37;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 != v1) + (a0[12] + v0)) < ((v3 && 89) != (v1 + 94)));
+    v0 = (((v0 && a0[0]) / 5) < ((v3 ? 70 : 48) - (a1[0][7] * a1[0][3])));
+    if ((((v2 - 37) <= (64 >= 12)) >= ((10 ? v1 : v1) - (v1 || 82)))) {
+        a0[10] = (((a1[1][5] / 7) || (v2 != v1)) + ((v3 < v3) == (v1 == v0)));
+        v3 = (((66 < 83) > (v2 && 39)) || ((v3 > a0[4]) % 2));
+        a1[2][1] = (((87 * v2) / 7) - ((v3 % 5) ? (11 ? v3 : v1) : (22 < v2)));
+    } else {
+        a0[8] = (((v3 != a0[6]) == (v0 || v2)) / 2);
+        v2 = (((v2 + v2) + (43 ? v1 : a1[0][11])) / 9);
+        a0[9] = (((24 ? v3 : v3) ? (v0 < a1[1][10]) : (23 && a0[9])) && ((a0[1] == a1[3][7]) - (16 + v0)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a1[0][14] || v2) < (v3 == i0)) ? ((v1 - v0) ? (a0[13] <= 35) : (v2 != v0)) : ((i0 * a1[3][2]) <= (17 / 2)));
+            v2 = (((v1 >= v3) / 4) / 2);
+            {
+                int i1 = 0;
+                do {
+                    a0[13] = (((v1 ? a1[3][13] : v3) == (a0[11] < v1)) / 1);
+                    v2 = (((v1 > v3) * (2 == a0[8])) * ((v3 * 79) == (v3 >= i1)));
+                    a0[12] = (((i0 < v0) ? (v0 > 68) : (a0[10] > i0)) ? ((v1 <= i1) / 4) : ((a0[1] * 66) && (v0 % 3)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((v3 / 6) != (v0 || v3)) <= ((v3 == a0[14]) >= (a0[12] * v2)))) {
+        a0[14] = (((v3 * 56) / 9) / 4);
+        a0[12] = (((v0 <= a1[3][6]) <= (v2 * v3)) || ((43 > a1[1][12]) ? (a1[0][10] ? a1[2][9] : v3) : (v2 / 1)));
+        v2 = (((64 - v2) == (v2 ? a0[10] : v1)) >= ((v2 < a1[3][14]) ? (a1[0][6] >= v3) : (v0 ? 66 : a0[6])));
+    } else {
+        a0[14] = (((61 * a1[0][1]) <= (19 - 34)) ? ((v1 >= 56) - (v3 ? v2 : v2)) : ((34 || 47) + (v1 % 5)));
+        v0 = (((v1 || 95) ? (v0 >= v0) : (a1[1][8] == 81)) <= ((a0[3] < 78) ? (v1 * v2) : (v3 || v0)));
+        v2 = (((v3 == v3) && (v0 && v1)) % 1);
+    }
+    return (((v2 / 1) * (v1 == a1[0][3])) ? ((v1 >= a1[0][3]) == (25 <= v2)) : ((v0 > 74) != (v2 % 2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,92 @@
+int f0() {
+    int v0 = 69;
+    int v1 = 23;
+    int v2 = 22;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][8] - v3) == (56 >= v1)) % 5)) {
+        v3 = (((v3 < v0) / 3) < ((a0[10] || v1) < (a1[0][10] && 35)));
+        v1 = (((a0[3] ? 58 : 19) * (v1 <= v0)) % 5);
+        a0[14] = (((v2 + 7) % 1) >= ((a1[0][15] + a1[3][13]) ? (70 + a1[0][1]) : (v0 > a1[2][8])));
+    } else {
+        v0 = (((v2 ? 19 : v3) <= (45 <= v1)) ? ((73 + 87) != (a0[12] > 45)) : ((v1 * 56) > (a0[13] && v1)));
+        v3 = (((a0[14] / 8) || (a0[8] != 82)) > ((76 % 4) > (a1[0][11] && v3)));
+        v0 = (((97 == v3) % 7) || ((a0[6] - v2) / 1));
+    }
+    a1[1][14] = (((v1 % 9) >= (v2 >= v3)) < ((v3 && v3) <= (v0 ? v0 : v0)));
+    v0 = (((a1[2][2] == 91) > (v3 && a0[4])) && ((a0[6] == v1) - (v1 % 6)));
+    if ((((v1 + 43) - (a0[7] == 72)) != ((v2 != 21) == (v0 && v2)))) {
+        v1 = (((v2 == 75) || (a1[0][5] * v0)) && ((v2 || v2) > (64 < 69)));
+        v0 = (((v2 < a1[2][5]) || (v1 / 2)) ? ((v1 >= v1) / 2) : ((v0 ? v2 : a1[1][2]) * (56 / 1)));
+        v3 = (((v1 + v1) / 1) || ((a0[14] == v3) * (21 < 1)));
+    } else {
+        v2 = (((49 != 27) * (v1 - v1)) + ((25 * v0) == (a1[0][7] >= v0)));
+        a1[3][0] = (((v3 ? a1[0][11] : 66) / 2) > ((v3 <= a0[1]) != (v0 < v1)));
+        a0[5] = (((v2 == v2) - (a0[12] + a1[0][2])) <= ((79 > a0[2]) ? (a1[1][11] > v2) : (v1 <= v1)));
+    }
+    v0 = (((v0 || v2) >= (v1 + a1[1][14])) >= ((45 != 33) * (3 ? a1[2][11] : v0)));
+    return (((v0 != a0[15]) <= (a1[2][1] != a0[2])) + ((71 % 7) && (77 / 6)));
+}
+int f1() {
+    int v0 = 10;
+    int v1 = 54;
+    int v2 = 34;
+    int v3 = 58;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 - 99) >= (v1 ? v2 : v2)) >= ((v0 && 49) != (77 - a1[3][2])))) {
+        a1[3][12] = (((v0 / 9) < (v1 + v0)) >= ((a1[1][8] >= 79) + (v1 + v0)));
+        a0[2] = (((v0 + v2) / 5) > ((v3 == v1) || (v2 ? 49 : v2)));
+        v2 = (((a0[8] - v0) ? (0 % 8) : (69 < v3)) < ((a0[10] % 1) ? (v1 != 6) : (v2 < a1[2][13])));
+    } else {
+        v1 = (((v3 ? a1[3][4] : v2) >= (v1 > 39)) && ((23 && 9) == (70 != v1)));
+        v1 = (((v1 != 67) ? (v0 == 19) : (44 / 9)) != ((v1 < a0[9]) <= (v0 % 8)));
+        v3 = (((17 + 15) - (5 && v3)) < ((v0 + a0[9]) < (a1[1][14] <= v2)));
+    }
+    a1[2][13] = (((v1 + 93) + (a0[11] || 78)) ? ((a0[10] < v0) <= (43 / 8)) : ((88 && v1) < (a0[1] - 24)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((a0[8] + a0[5]) > 82) break;
+        a0[5] = (((47 >= v3) ? (48 * v1) : (a1[1][11] * v0)) ? ((v0 != a0[13]) == (v3 || v1)) : ((v2 > v0) || (a0[0] == v3)));
+        v2 = (((7 != a1[3][15]) + (a0[13] < v2)) < ((v0 + 48) - (a1[3][15] ? v2 : 62)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                a0[14] = (((45 ? 23 : 54) && (28 <= a1[0][3])) % 2);
+                a1[3][10] = (((v1 || v1) && (a1[1][0] > 67)) || ((v0 + a1[2][4]) + (v3 > 21)));
+                a1[1][13] = (((a1[0][5] > v1) < (i1 ? v2 : 91)) > ((i0 % 2) != (87 == v2)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v2 < a1[0][10]) && (30 - a0[15])) - ((i3 <= v2) != (v2 >= a0[1])));
+                    v3 = (((i2 >= 8) < (i3 != v0)) < ((a0[0] % 8) > (i3 != v1)));
+                    v0 = (((a1[3][6] / 5) / 7) <= ((v2 <= v2) - (1 + a0[10])));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v2 = (((v0 - 58) % 1) ? ((i2 % 8) * (a1[1][8] % 8)) : ((a0[6] + v3) > (98 - 51)));
+            v1 = (((v1 > 72) * (54 * i2)) - ((12 * i2) ? (v0 / 8) : (79 + v0)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v2 || v0) != (a1[1][9] || v0)) % 6)) {
+        v0 = (((a1[1][6] >= a0[7]) - (63 || a1[0][13])) == ((48 <= v2) != (a1[1][2] || v3)));
+        v0 = (((v3 || v2) <= (35 != v1)) != ((87 <= v2) ? (v3 + v3) : (33 >= v1)));
+        a1[1][2] = (((v0 * a0[10]) < (v2 < a0[5])) == ((v0 + v0) - (a1[3][3] ? 59 : 93)));
+    } else {
+        v1 = (((v0 || 35) == (v3 % 3)) % 7);
+        v1 = (((v1 * 75) / 3) % 1);
+        a1[3][2] = (((a0[12] * a1[0][0]) + (v3 > a1[1][14])) > ((a1[3][0] ? 25 : v3) < (a0[15] + v2)));
+    }
+    return (((v3 <= 74) ? (44 < v0) : (a1[2][13] % 9)) % 7);
+}
+int main() {
+    return 0;
+}
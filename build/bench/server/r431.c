@@ -0,0 +1,186 @@
+int f0() {
+    int v0 = 82;
+    int v1 = 8;
+    int v2 = 27;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    a1[2][6] = (((v3 * v1) <= (v2 ? 73 : v0)) * ((a0[9] < v2) ? (v3 == a1[1][14]) : (v2 * a0[0])));
+    v3 = (((v2 == v0) ? (a0[1] || v2) : (v0 >= 67)) * ((a0[7] % 2) >= (a0[15] < 32)));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v3 = (((v1 < 87) > (a1[3][6] == v1)) ? ((v1 && 36) != (i0 ? v0 : 59)) : ((v0 - v1) == (v3 % 8)));
+            v1 = (((a0[13] && v1) != (61 % 2)) / 6);
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a0[13] > a0[8]) <= (a1[1][3] - i1)) / 8);
+                    v2 = (((6 - a0[10]) >= (81 == v0)) == ((v3 || v3) < (i1 == v1)));
+                    v2 = (((i0 / 3) != (80 || v2)) || ((56 && v2) <= (72 <= v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        if ((a1[2][2] > v3) > 83) break;
+        v2 = (((v3 >= a1[0][7]) ? (a1[1][4] * 17) : (v0 ? v1 : a1[0][2])) / 1);
+        {
+            int i3 = 0;
+            do {
+                a0[8] = (((32 ? v0 : 27) == (v1 + 54)) ? ((i2 / 1) || (v1 ? i3 : a0[11])) : ((a0[15] * a0[8]) - (a1[2][0] / 9)));
+                v3 = (((a0[8] < 66) < (i2 / 7)) || ((i2 || i2) <= (a1[1][0] != a0[12])));
+                v1 = (((i3 >= v3) / 6) ? ((v1 / 4) % 7) : ((17 + v2) >= (a0[8] % 6)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        a0[14] = (((6 != a1[3][4]) + (v1 && v1)) * ((a0[14] > 50) >= (v3 && a0[2])));
+    }
+    v2 = (((81 < v0) < (v0 && v2)) > ((v3 % 6) < (98 / 4)));
+    return (((v3 || v1) < (72 && v2)) == ((v2 ? v0 : v0) + (v0 < a0[1])));
+}
+int f1() {
+    int v0 = 65;
+    int v1 = 12;
+    int v2 = 58;
+    int v3 = 42;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a0[14] <= 98) >= (a1[3][4] ? a0[15] : v1)) != ((44 <= 4) < (v0 <= v0)));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((a1[3][9] > 0) > 78) break;
+            a1[2][0] = (((i0 * 64) ? (75 * v3) : (11 <= 15)) ? ((i0 + v1) <= (v1 >= v2)) : ((v1 != v0) ? (a0[5] > v0) : (74 >= i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v1 / 3) > 62) break;
+                    a1[1][12] = (((v3 < i1) / 7) / 9);
+                    a1[3][0] = (((i1 != i1) < (6 && i0)) >= ((v1 ? v2 : 12) != (i0 <= 22)));
+                    v1 = (((80 % 1) - (81 && 14)) != ((a0[0] <= v3) != (1 > 45)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v0 = (((i0 + 67) - (90 > v1)) - ((v2 * 53) >= (v1 - i0)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            if ((i3 || v2) > 70) break;
+            a0[2] = (((v3 > 94) ? (i2 <= a1[0][2]) : (v1 * a0[9])) + ((v0 * v1) % 5));
+            v2 = (((86 ? i2 : a1[0][5]) <= (v3 || 38)) ? ((a1[2][0] ? 24 : a1[2][12]) >= (v2 ? v1 : 16)) : ((v3 == 54) != (a0[11] >= a0[10])));
+            a0[3] = (((i3 * v0) > (a0[14] != v2)) > ((a1[2][3] + 47) || (18 * i2)));
+        }
+        v1 = (((86 * i2) - (2 == i2)) >= ((a1[1][9] || v3) % 7));
+        v3 = (((a1[1][8] <= v0) + (a0[15] ? v0 : a0[13])) != ((v0 % 3) <= (v3 % 1)));
+    }
+    if ((((v0 - v3) != (a0[11] ? v0 : 10)) ? ((v3 && 19) && (v1 * v0)) : ((a1[0][8] * a1[1][12]) * (v3 % 6)))) {
+        a1[1][13] = (((v2 != 3) > (a1[2][11] && a0[11])) - ((38 + v2) ? (44 + v0) : (a1[2][0] ? 79 : v2)));
+        v1 = (((a1[2][6] != v1) != (v3 ? v3 : v2)) * ((v3 ? v0 : v1) && (v1 > v3)));
+        v1 = (((v3 ? 65 : v1) && (a1[1][2] ? a1[3][9] : a1[1][10])) < ((a0[9] * a1[3][8]) == (73 == v0)));
+    } else {
+        v0 = (((27 != 5) || (v3 * 37)) != ((a1[0][5] || 85) ? (v0 / 2) : (a1[2][12] >= v1)));
+        a1[0][2] = (((v1 || a0[2]) && (38 != v0)) < ((a0[8] * a0[8]) == (v0 + 95)));
+        v2 = (((v1 + v2) < (96 ? a0[4] : 48)) || ((16 == v0) || (a1[1][15] * v1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((70 ? v1 : a0[13]) > 70) break;
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    if ((i5 ? v0 : 84) > 77) break;
+                    v3 = (((v2 - v3) != (91 == a1[0][5])) <= ((17 % 5) * (v1 % 8)));
+                    a1[0][15] = (((v1 >= i4) || (1 && i5)) == ((i5 + a0[0]) / 6));
+                    v3 = (((1 >= i5) / 2) ? ((v0 ? 32 : v1) || (i4 < v2)) : ((8 + 78) * (i5 - a0[3])));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[3][2] = (((98 + 35) % 3) > ((v3 < i4) * (v3 ? 11 : 13)));
+            v2 = (((v2 ? a1[1][7] : v1) >= (v1 * v2)) >= ((a0[6] % 6) % 8));
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    return (((a0[9] ? v3 : 59) == (v2 ? 82 : v2)) + ((v2 || v1) && (v2 * 67)));
+}
+int f2() {
+    int v0 = 62;
+    int v1 = 79;
+    int v2 = 98;
+    int v3 = 2;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 < v3) && (a1[3][8] ? v3 : v1)) > ((a1[0][3] * a0[15]) * (v3 + a1[3][3])))) {
+        v0 = (((19 || a0[0]) < (v0 != 5)) && ((a1[1][4] >= v0) ? (v3 || v2) : (a0[8] / 2)));
+        v0 = (((v2 * v0) && (a1[1][9] && v1)) <= ((a1[1][8] > v3) && (v3 - v1)));
+        v1 = (((a0[5] <= v2) >= (a0[1] || a1[0][14])) ? ((v3 > 11) % 4) : ((v2 != v2) ? (29 ? 87 : v1) : (v0 || a1[2][9])));
+    } else {
+        v0 = (((a1[0][7] > v1) % 1) > ((a0[1] < v1) / 4));
+        v1 = (((a1[1][2] / 3) > (a1[2][14] / 4)) % 8);
+        v1 = (((a0[8] == v1) <= (v0 - v0)) != ((v0 == 83) ? (a0[4] ? v1 : a0[7]) : (a0[9] + v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v0 = (((v3 ? v1 : 74) <= (i0 ? a0[6] : 4)) >= ((v3 + a1[1][7]) + (a0[8] / 6)));
+            v2 = (((v0 - v1) * (84 % 8)) > ((v1 >= 94) > (v3 < a1[0][4])));
+            {
+                int i1 = 0;
+                do {
+                    a1[0][2] = (((22 ? 11 : a1[0][13]) ? (a1[2][15] >= v0) : (v1 > 9)) || ((v2 / 7) > (a0[12] || 57)));
+                    a1[0][6] = (((v0 && v3) ? (v2 ? a1[3][4] : a1[2][12]) : (v1 + a1[3][13])) % 1);
+                    v1 = (((a0[1] % 5) ? (29 / 8) : (77 > v2)) * ((a0[3] % 4) > (50 / 4)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            v2 = (((v0 - v1) >= (73 <= 18)) * ((i2 <= 24) >= (i3 < i2)));
+            v2 = (((a0[5] / 1) < (v3 + i3)) > ((a0[11] > i3) % 2));
+            v2 = (((64 - a1[2][11]) != (v2 <= 44)) != ((v0 == v1) == (a0[11] == 67)));
+        }
+        v2 = (((76 != 73) ? (v1 ? v0 : i2) : (v1 || v1)) + ((a1[0][13] ? v1 : a0[4]) >= (a1[3][7] == i2)));
+        v3 = (((v0 - v0) / 7) + ((61 != i2) == (v1 % 2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((a0[2] ? a0[9] : a1[1][5]) > 85) break;
+                a0[10] = (((2 * v1) % 4) % 3);
+                v2 = (((v1 >= v0) == (2 >= i4)) ? ((v1 % 7) < (94 < v2)) : ((82 || a1[3][15]) == (a0[9] >= 25)));
+                a0[13] = (((75 != 46) % 6) <= ((i5 ? 48 : 26) >= (a0[9] % 6)));
+            }
+            v0 = (((a0[5] <= 40) * (a0[5] != v3)) <= ((a0[3] && v3) && (a0[2] ? i4 : v3)));
+            a1[1][11] = (((v1 > v0) + (a0[10] || v1)) - ((a1[3][0] % 5) > (a1[2][10] == a1[2][9])));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((v3 < 0) > 63) break;
+        v0 = (((i6 <= v0) != (35 || i6)) % 4);
+        {
+            int i7 = 0;
+            while (i7 < 2) {
+                if ((v2 == a0[5]) > 58) break;
+                a1[3][3] = (((76 + a1[2][4]) ? (94 % 9) : (v0 || 11)) < ((77 || v0) ? (v2 + v2) : (43 > a1[3][4])));
+                v0 = (((v0 >= i6) <= (59 % 9)) ? ((a1[1][0] != v0) ? (v2 <= v0) : (v2 > 67)) : ((50 > a0[1]) >= (v0 / 2)));
+                v1 = (((a0[8] == i7) / 2) < ((3 % 9) || (v0 < a1[1][15])));
+                i7 = i7 + 1;
+            }
+        }
+        a1[0][7] = (((a1[0][7] + i6) <= (94 * v1)) == ((v1 * v2) <= (12 * v3)));
+    }
+    return (((v2 >= a0[10]) - (v2 * v3)) * ((v3 ? v1 : v1) || (v3 && v3)));
+}
+int main() {
+    return 0;
+}
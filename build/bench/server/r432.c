@@ -0,0 +1,85 @@
+int f0() {
+    int v0 = 90;
+    int v1 = 75;
+    int v2 = 53;
+    int v3 = 14;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[0][11] = (((v3 / 8) % 5) / 3);
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((92 <= a1[2][6]) ? (a0[11] * v1) : (i0 && i1)) ? ((a0[8] ? v2 : v2) - (a1[0][4] > a1[3][14])) : ((v1 && v0) > (i0 % 3)));
+                    v3 = (((v2 ? 59 : v3) == (v1 % 9)) >= ((77 != i1) < (i0 > v3)));
+                    v1 = (((95 - v1) > (v2 <= v1)) < ((v2 && i0) % 4));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v2 = (((56 && v3) % 5) ? ((v0 > v0) ? (v2 / 3) : (v1 - a0[7])) : ((12 && v3) * (50 * 6)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((v3 * v3) ? (v1 == a0[3]) : (99 != a0[3])) == ((57 != a0[9]) >= (35 || 33)));
+                v3 = (((44 == v0) || (v3 * 34)) * ((i3 != a1[3][9]) > (a0[0] != v3)));
+                v3 = (((65 * 5) - (i3 >= a0[11])) && ((v3 <= a1[0][4]) < (v0 != v0)));
+            }
+            a1[3][2] = (((i2 != v0) == (v3 + 12)) && ((v2 < v1) != (v3 || a1[1][2])));
+            a0[8] = (((i2 && 82) * (v3 || i2)) % 3);
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v0 = (((a0[2] == a0[8]) >= (v0 * 37)) ? ((v0 >= 47) * (a1[1][5] - 4)) : ((v0 < v0) / 6));
+            a1[0][2] = (((a0[13] + a1[2][10]) * (78 / 2)) ? ((a0[4] ? v2 : 62) - (v3 < v3)) : ((v1 == a1[3][2]) < (83 > 27)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v2 = (((v0 || i4) || (v2 ? i5 : v0)) ? ((v0 != v2) || (26 > i5)) : ((80 / 6) != (33 <= a0[10])));
+                    v0 = (((a0[0] / 3) ? (a0[5] ? v1 : 81) : (v3 * 49)) < ((i4 - i4) || (v1 || 71)));
+                    v0 = (((a0[13] && a1[3][10]) <= (v2 / 2)) ? ((a0[6] != a1[0][3]) < (v1 && 23)) : ((a1[1][0] && a1[0][3]) || (v2 % 7)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            {
+                int i7 = 0;
+                do {
+                    v3 = (((a0[5] <= i7) % 5) && ((v2 * a1[3][5]) >= (50 < i7)));
+                    v3 = (((a1[1][14] || v3) || (84 ? i6 : i6)) != ((2 + i6) - (v2 + i7)));
+                    a1[2][3] = (((a1[0][12] % 2) || (a1[2][12] >= v3)) && ((a0[3] > v0) == (a0[9] - a1[0][8])));
+                    i7 = i7 + 1;
+                } while (i7 < 6);
+            }
+            a0[15] = (((46 && v3) && (a1[2][1] > v3)) / 8);
+            v0 = (((v1 ? 62 : v3) % 1) || ((v1 ? v3 : v2) - (i6 < v3)));
+            i6 = i6 + 1;
+        }
+    }
+    if ((((v2 % 4) <= (a1[2][0] ? a0[5] : 78)) && ((30 ? a0[2] : v2) == (v3 ? v3 : v3)))) {
+        a0[11] = (((v0 == v1) && (a1[1][7] * v1)) * ((v2 % 8) || (v0 / 3)));
+        v3 = (((v0 - v3) > (v2 == v1)) == ((21 || v3) / 4));
+        v3 = (((v2 / 2) || (v0 * 83)) >= ((12 > v0) >= (v0 || a0[9])));
+    } else {
+        a1[2][8] = (((41 != v3) + (a0[2] && v2)) * ((a1[3][8] || 13) >= (v3 + v2)));
+        v2 = (((a0[2] <= a1[3][14]) * (a0[0] || v3)) > ((v3 > 15) / 5));
+        v1 = (((a1[3][12] || v1) == (a0[0] ? v1 : a0[8])) < ((28 && 3) + (a0[15] + v0)));
+    }
+    return (((a1[2][6] / 6) || (v0 == v1)) + ((a0[5] == 30) != (v0 % 5)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,136 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 82;
+    int v2 = 48;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a0[4] = (((v0 - 27) - (45 <= a1[1][15])) / 9);
+            v1 = (((v1 * 57) / 8) > ((v1 ? v0 : a1[2][2]) <= (80 * 13)));
+            {
+                int i1 = 0;
+                do {
+                    a0[15] = (((v0 * 42) ? (v2 >= 62) : (i1 - a1[1][15])) || ((84 == a0[2]) || (v3 * v3)));
+                    v2 = (((49 || v3) < (63 ? i1 : 74)) + ((58 < v1) ? (77 * 20) : (0 ? a0[5] : i0)));
+                    a0[9] = (((i1 - v1) > (93 <= a1[1][9])) < ((34 ? i1 : v3) == (i0 || a1[2][13])));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((a0[5] ? v2 : v2) >= (v2 == v1)) > ((v2 || a1[3][4]) - (a0[4] / 7)));
+    if ((((v3 && v2) + (v1 - 74)) >= ((15 < 9) == (39 ? 19 : v3)))) {
+        a0[0] = (((a1[2][2] <= a1[0][10]) ? (v0 < a1[2][3]) : (39 + v2)) <= ((v0 != 85) >= (41 <= 46)));
+        v1 = (((98 >= a0[15]) >= (a0[3] ? a0[1] : a0[14])) != ((a0[13] >= a1[2][1]) < (v0 - v3)));
+        v1 = (((22 <= v2) != (24 * a1[0][7])) ? ((a0[9] < a0[1]) <= (v3 ? a1[3][6] : 85)) : ((v2 < 12) >= (92 < v3)));
+    } else {
+        v0 = (((60 != 6) <= (v1 || v2)) == ((v1 + v1) + (v0 <= v3)));
+        v3 = (((99 >= v3) && (80 && v2)) - ((a0[15] && v3) || (v1 > 44)));
+        a0[2] = (((v0 == v1) / 8) * ((v0 - a0[8]) < (v3 ? 55 : v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[5] = (((41 != v3) != (a0[3] - 24)) ? ((a0[10] > v0) < (v2 % 6)) : ((75 + v3) < (32 == 24)));
+            v1 = (((v1 != v0) || (50 % 5)) < ((72 && a1[1][10]) || (v3 ? a1[1][8] : v3)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    a0[0] = (((v1 * 85) * (a0[8] % 1)) + ((49 / 2) + (a0[4] && a1[0][1])));
+                    v2 = (((i2 && v3) < (v2 % 6)) || ((v3 < 41) >= (41 && v3)));
+                    a0[2] = (((a1[3][14] * i2) && (v2 <= v1)) && ((a1[1][12] != 1) && (a0[10] == 7)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a0[2] > a0[6]) >= (27 ? 84 : a0[11])) <= ((v2 == v1) <= (a0[2] + a0[5])));
+            for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+                v2 = (((13 && v0) && (v0 ? v2 : v0)) != ((i4 ? 76 : a1[1][6]) > (75 <= 58)));
+                v3 = (((v3 <= 64) && (i4 > 13)) <= ((v1 || a0[7]) || (13 ? v2 : a0[9])));
+                a1[0][6] = (((97 != v1) != (v2 ? 93 : a0[9])) && ((a1[1][8] * v3) * (i5 || i4)));
+            }
+            v3 = (((74 >= i4) <= (41 || 41)) ? ((v3 != 23) % 3) : ((47 ? a1[3][5] : a0[10]) < (v2 % 7)));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    return (((43 <= 70) % 6) || ((v2 ? a0[1] : 54) <= (v2 != 91)));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 72;
+    int v2 = 7;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[8] = (((73 - 11) <= (v1 / 2)) == ((i0 - 12) >= (v0 && 93)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((v1 / 8) / 7) - ((25 * a1[2][13]) / 5));
+                    v3 = (((i1 + v2) * (v3 > a1[0][11])) % 2);
+                    a0[2] = (((v3 ? a1[2][13] : i1) > (60 == 73)) * ((i0 + i1) + (v3 * a1[1][9])));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((55 + v1) < (a0[12] == v1)) == ((i0 + a1[3][0]) / 8));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((77 == 28) ? (a1[2][10] % 2) : (v3 / 7)) + ((v3 * 84) < (v1 % 1)))) {
+        v1 = (((v2 == 43) == (71 ? a0[10] : a1[2][8])) * ((v0 && a0[5]) / 9));
+        a0[13] = (((v0 + v0) && (v2 >= v0)) + ((v3 >= v2) > (a0[7] < v1)));
+        a0[8] = (((74 >= v2) && (a1[1][6] <= 47)) != ((a1[1][2] * a0[10]) - (24 ? a0[5] : 75)));
+    } else {
+        a1[3][15] = (((79 > v2) ? (99 - v0) : (v3 < a0[8])) && ((v3 - v3) || (v1 / 5)));
+        v1 = (((3 >= v0) || (46 && 42)) == ((v1 >= v1) + (99 && 51)));
+        a1[1][0] = (((v2 <= v3) - (v3 ? a0[9] : 45)) || ((70 > a0[12]) % 5));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((0 && v2) > 89) break;
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a1[2][5] = (((a0[4] > 45) != (16 > v2)) == ((87 || v0) % 5));
+                a0[15] = (((i2 ? i3 : v3) || (v1 != i2)) != ((v2 % 7) > (v1 + v1)));
+                v0 = (((i2 + 38) * (i2 ? i2 : v3)) <= ((i2 != v2) * (50 && 58)));
+            }
+            v1 = (((i2 != i2) * (v3 ? 97 : 17)) * ((a0[11] / 3) ? (a0[12] >= v0) : (a0[15] < v1)));
+            a0[2] = (((v2 == v0) - (a1[1][7] % 6)) && ((v1 && v2) >= (49 != v0)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    a1[2][15] = (((55 <= a1[1][2]) == (v2 + v0)) / 2);
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v0 != v0) && (a0[6] && 67)) / 7);
+            {
+                int i5 = 0;
+                while (i5 < 6) {
+                    a0[8] = (((i5 >= 6) * (a0[11] / 5)) && ((64 && i5) || (i4 <= i5)));
+                    v3 = (((62 != v0) + (v0 || a0[0])) - ((i5 - v2) / 9));
+                    v2 = (((a0[7] ? a0[7] : v2) <= (a0[12] != v3)) * ((32 || v3) > (a0[9] - v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[1][9] = (((23 >= v3) == (v1 != i4)) * ((a0[2] || a1[2][3]) && (a0[4] && v3)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v1 && a0[4]) / 5) <= ((v2 * v2) <= (v3 > v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,219 @@
+int f0() {
+    int v0 = 2;
+    int v1 = 29;
+    int v2 = 69;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((i0 / 2) + (a1[3][13] == 36)) - ((a0[2] && v2) ? (16 == a0[12]) : (a1[1][14] < v0)));
+                a0[14] = (((a0[10] < v0) == (41 ? i1 : i1)) <= ((a1[2][12] ? i0 : v2) <= (a0[9] ? v3 : a0[15])));
+                v0 = (((22 ? v0 : i1) <= (26 - v0)) >= ((v3 < i0) == (32 - i1)));
+            }
+            a0[0] = (((a1[1][7] <= a0[4]) <= (v0 < a1[0][7])) + ((v2 == v0) != (74 ? 77 : v0)));
+            v0 = (((a0[4] + 25) != (v2 >= a0[6])) / 2);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v1 > 38) < (v3 * v0)) < ((8 == v3) ? (v3 != 27) : (v0 < a0[6])))) {
+        v3 = (((v1 > v3) % 7) != ((v0 > v2) != (a0[9] ? v3 : v1)));
+        a1[2][3] = (((a1[3][1] < a0[12]) > (71 * 81)) - ((v2 || v0) != (57 < v2)));
+        a0[11] = (((27 % 4) ? (49 % 8) : (v3 + a1[0][0])) >= ((v3 != v3) || (v2 == 1)));
+    } else {
+        a0[9] = (((v3 / 7) && (44 && v1)) < ((v3 != v0) <= (50 / 8)));
+        v2 = (((v3 * a1[0][8]) < (v2 / 6)) % 6);
+        a0[15] = (((v1 + 86) % 4) >= ((a1[1][12] <= v2) > (a0[12] / 3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((i2 > 42) > 71) break;
+            a1[2][0] = (((41 != v1) != (v2 < v0)) * ((a1[2][12] % 6) / 2));
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v2 = (((93 || v0) || (v3 - a0[14])) - ((a1[0][14] - i2) % 7));
+                    v1 = (((66 <= v3) == (35 != 40)) ? ((a1[3][9] && 39) % 9) : ((20 == v3) >= (a1[1][11] / 2)));
+                    a0[1] = (((a0[4] ? i3 : a1[3][7]) > (40 / 7)) / 5);
+                    i3 = i3 + 1;
+                }
+            }
+            a1[3][6] = (((v1 + a1[1][4]) >= (v3 != v0)) <= ((41 * 70) <= (a1[3][1] < v1)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[6] = (((a0[10] - v3) / 2) >= ((v3 ? 36 : 94) / 7));
+            a0[4] = (((a1[2][10] / 7) != (25 - 42)) - ((v2 / 8) % 8));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                a1[1][10] = (((7 < 58) && (99 > a0[1])) > ((a0[15] * 73) >= (v3 % 9)));
+                a1[0][1] = (((v0 < a0[12]) <= (i5 == i5)) * ((33 <= i5) ? (a1[2][10] ? 53 : v2) : (81 == i5)));
+                v1 = (((i4 ? v3 : v3) && (89 <= i4)) ? ((v1 >= v3) || (i4 && a0[10])) : ((a1[2][11] >= v3) && (a0[3] ? i5 : a0[9])));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    if ((((v2 >= 15) || (87 != a0[12])) < ((a0[12] == 87) == (v2 == a0[4])))) {
+        v3 = (((20 && a0[11]) - (v3 <= 79)) >= ((a1[3][8] - v0) != (v0 > v3)));
+        a1[2][11] = (((a1[1][9] > v3) ? (21 >= a0[9]) : (v1 <= v2)) - ((v3 ? a1[2][9] : v0) ? (a1[1][12] && v0) : (v1 <= v2)));
+        v3 = (((v2 && v0) ? (v0 - v0) : (v2 + v2)) >= ((v2 > a0[12]) != (a0[2] ? v1 : 58)));
+    } else {
+        v2 = (((a1[1][11] / 7) <= (v2 && v1)) || ((v2 % 4) / 3));
+        v0 = (((51 / 9) % 1) <= ((95 ? a0[13] : 61) || (v3 - a1[2][14])));
+        v0 = (((a0[4] % 7) >= (a0[4] == v3)) / 7);
+    }
+    return (((v2 < v2) ? (28 && a1[1][4]) : (v0 ? a0[10] : v1)) || ((58 * 94) * (73 * a0[12])));
+}
+int f1() {
+    int v0 = 57;
+    int v1 = 93;
+    int v2 = 63;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((a1[1][0] >= v1) > 70) break;
+                    v0 = (((v0 != 76) > (85 > i0)) == ((i1 < a1[3][13]) - (i1 != a0[9])));
+                    a0[2] = (((v0 / 2) / 7) ? ((v0 / 8) - (a1[2][15] <= a0[2])) : ((v3 && a0[7]) >= (a1[1][7] && i0)));
+                    a0[12] = (((a1[2][0] || 81) <= (a0[3] ? 45 : v1)) != ((6 || 87) <= (13 ? v3 : v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v1 == i0) && (v1 <= a0[1])) * ((v2 ? v0 : i0) ? (a0[2] >= a0[15]) : (41 % 4)));
+            v3 = (((a0[5] != v2) >= (a0[0] == v1)) != ((7 && i0) / 9));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            a0[2] = (((v0 ? a0[7] : a0[6]) ? (a0[4] > 55) : (v2 % 9)) * ((72 + v2) ? (11 + v3) : (a1[2][9] * v1)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((95 + a0[12]) != (6 / 8)) - ((v0 > i3) < (47 ? v1 : a0[12])));
+                    v2 = (((a0[2] ? i2 : v3) >= (v2 ? i3 : i2)) ? ((a1[1][12] + a0[2]) <= (v0 - v3)) : ((61 / 6) || (a0[3] % 4)));
+                    v0 = (((v2 ? i3 : a0[1]) >= (v2 >= v1)) > ((9 < i2) >= (a1[2][9] < v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            v1 = (((4 % 9) || (v2 * v3)) == ((10 * v0) && (v3 / 2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v3 = (((93 / 2) % 2) ? ((a0[5] - 88) < (a0[14] * 34)) : ((v1 - 40) * (a1[2][11] - i4)));
+            {
+                int i5 = 0;
+                do {
+                    a0[11] = (((v3 ? 24 : a0[11]) > (i5 - 67)) == ((v3 || a0[10]) != (v1 <= v2)));
+                    v2 = (((89 + v1) + (v0 < 44)) && ((v0 + v2) ? (40 + 86) : (a1[2][0] ? v1 : a1[2][0])));
+                    v2 = (((44 ? i5 : 59) * (a1[0][11] == 5)) % 1);
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v2 = (((v1 ? a1[2][8] : v1) + (77 % 4)) != ((a0[12] >= a1[0][3]) ? (a0[0] ? v3 : i4) : (a0[8] != v0)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            v2 = (((0 + a1[2][1]) < (i6 != v0)) + ((v2 && 0) < (i6 % 2)));
+            a0[8] = (((a1[0][11] ? 10 : v3) - (v0 || v2)) > ((a1[0][6] >= 62) || (36 < a1[3][6])));
+            {
+                int i7 = 0;
+                do {
+                    if ((i7 + a0[11]) > 87) break;
+                    a0[1] = (((i6 <= i6) + (v3 == a0[13])) / 1);
+                    v1 = (((v3 ? v3 : v0) < (i7 ? v1 : 7)) && ((a1[2][12] * a1[3][1]) ? (v2 && v0) : (26 || v1)));
+                    a1[3][8] = (((a0[15] - a0[8]) % 3) <= ((a0[3] ? 70 : a0[0]) != (i7 > a1[2][1])));
+                    i7 = i7 + 1;
+                } while (i7 < 8);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    if ((((v3 <= v0) >= (27 <= v2)) && ((0 != v0) > (v0 <= v0)))) {
+        a1[1][2] = (((v1 < v0) <= (v0 == v3)) / 9);
+        a0[12] = (((70 + 51) - (v3 >= v3)) / 3);
+        a1[1][10] = (((a0[15] / 9) < (v1 || a0[14])) ? ((15 ? v0 : 56) && (a1[3][10] / 5)) : ((v1 ? v1 : 31) || (v0 + 60)));
+    } else {
+        a1[2][10] = (((v0 > 77) % 7) + ((v1 || 94) || (43 % 1)));
+        v3 = (((v3 / 5) <= (v3 == a1[1][10])) != ((a0[8] == v1) != (v0 + v1)));
+        a0[5] = (((a1[1][9] * v3) || (v2 ? 26 : 77)) + ((a1[0][8] / 3) % 9));
+    }
+    return (((v2 == a0[9]) - (v3 / 3)) > ((v1 + v1) ? (v2 / 5) : (a0[13] != v1)));
+}
+int f2() {
+    int v0 = 53;
+    int v1 = 63;
+    int v2 = 81;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    if ((((65 / 7) == (v3 - v2)) % 8)) {
+        v0 = (((v3 * v0) / 5) || ((a0[12] * 93) / 1));
+        v0 = (((v1 == 62) || (v0 < v3)) % 5);
+        a1[1][10] = (((27 <= a1[3][14]) < (25 == v0)) < ((12 != v3) % 1));
+    } else {
+        a0[5] = (((v0 == a1[1][13]) || (v1 * a0[9])) <= ((v1 - v3) >= (v2 / 9)));
+        a1[2][14] = (((99 > v2) % 3) != ((v0 != a0[11]) % 6));
+        a1[1][9] = (((25 != v1) != (v2 > a1[2][13])) / 2);
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v3 = (((a1[0][1] > 60) || (v3 == v3)) != ((v0 >= v0) % 2));
+        v1 = (((v2 > v1) ? (89 <= 80) : (v1 * i0)) - ((20 * 18) || (a1[2][11] / 6)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                if ((i1 - a1[0][8]) > 58) break;
+                v2 = (((a1[3][6] && 18) < (i0 >= i1)) ? ((v0 - a0[8]) || (a0[6] == 16)) : ((6 != 19) < (v2 - a1[0][12])));
+                v2 = (((11 > 41) <= (a1[0][0] > a1[2][8])) ? ((i1 == 29) >= (a0[0] ? v1 : v1)) : ((97 ? v1 : v2) > (a0[9] + v2)));
+                v1 = (((73 - i1) - (i1 && a0[8])) <= ((v3 / 6) <= (v0 > 85)));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    if ((((84 - v2) < (a1[0][4] && a1[3][14])) >= ((23 % 5) ? (v3 ? 60 : v3) : (a1[1][1] - a0[13])))) {
+        v2 = (((v0 * a1[1][10]) / 8) + ((v2 == v1) ? (v0 ? 45 : v1) : (86 && v1)));
+        v1 = (((v2 && a1[2][7]) > (v3 / 8)) || ((17 && 79) || (v3 - a1[2][5])));
+        v0 = (((v1 / 5) == (v3 >= v0)) ? ((20 ? v3 : a1[2][10]) != (89 == a1[3][2])) : ((v2 > 37) * (v1 + v2)));
+    } else {
+        v3 = (((a1[2][12] < a1[0][15]) && (a0[6] > v0)) + ((v0 || 84) >= (68 - v1)));
+        v2 = (((60 ? a1[0][2] : v1) ? (a0[2] != v0) : (a0[10] >= 88)) != ((v0 ? v3 : 19) == (v0 > 63)));
+        v1 = (((a0[9] % 3) + (v2 > v2)) + ((v1 == v3) >= (v2 > a0[12])));
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((7 || v3) > 93) break;
+        {
+            int i3 = 0;
+            do {
+                if ((a0[7] < i2) > 93) break;
+                v0 = (((56 || i3) ? (a0[6] % 9) : (97 / 4)) / 1);
+                v2 = (((62 == a0[9]) == (a1[2][12] || v1)) && ((a1[3][1] || 96) || (v0 && i3)));
+                v0 = (((v2 == v0) < (v2 && 44)) % 3);
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        a1[2][7] = (((i2 > v0) * (v2 % 1)) % 7);
+        v3 = (((88 && i2) ? (a1[1][8] && a0[6]) : (v0 ? v2 : v3)) ? ((v0 && i2) && (22 >= 44)) : ((v3 * 99) || (a1[1][15] ? i2 : v1)));
+    }
+    a0[9] = (((93 <= 79) / 6) > ((v3 || v2) != (a0[7] ? a1[2][3] : 10)));
+    return (((a1[0][6] || a1[3][5]) <= (79 < v1)) ? ((v2 * v3) / 2) : ((a1[0][10] != a1[0][1]) * (44 * v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,46 @@
+int f0() {
+    int v0 = 80;
+    int v1 = 2;
+    int v2 = 27;
+    int v3 = 81;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 / 4) ? (a0[6] || v3) : (a1[0][7] < 98)) % 2);
+    if ((((10 >= 34) ? (v1 / 2) : (a0[7] > a0[1])) == ((v0 < 94) * (a0[7] - v2)))) {
+        v0 = (((59 <= v1) - (v3 >= 0)) <= ((v3 - v2) % 4));
+        a1[3][8] = (((v0 % 3) / 2) / 1);
+        v1 = (((24 >= v0) < (v0 / 8)) != ((v2 <= a0[12]) >= (45 + 29)));
+    } else {
+        v0 = (((7 / 7) * (v3 <= 94)) ? ((v3 < v3) >= (93 * 39)) : ((v2 >= v1) != (a1[1][0] < 3)));
+        a0[11] = (((v0 ? v1 : a1[1][5]) + (v1 && v3)) && ((v3 ? 80 : v2) == (80 + 67)));
+        a0[9] = (((71 ? v2 : v3) ? (v0 <= v2) : (v3 / 7)) != ((a0[10] != a1[1][7]) > (9 / 1)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            if ((i0 < a0[10]) > 56) break;
+            v1 = (((a1[2][5] / 7) - (v0 ? v2 : v2)) != ((a0[3] + 74) >= (79 <= i0)));
+            a1[3][9] = (((v3 >= a0[11]) > (a1[1][3] != a0[12])) % 5);
+            v3 = (((a0[6] <= v3) % 2) != ((v2 - v0) + (a0[2] * v0)));
+        }
+        v0 = (((29 != a1[2][0]) < (v1 == v1)) / 1);
+        a1[0][1] = (((v2 % 6) != (i0 || 41)) / 6);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v2 = (((34 && v3) >= (a0[5] + a1[1][9])) >= ((i3 >= v0) % 7));
+                a0[0] = (((i2 <= v0) != (a0[5] < i3)) ? ((i2 - v1) != (a1[0][13] || v1)) : ((v1 ? v2 : v1) && (34 * v2)));
+                v2 = (((a0[10] + 35) || (a0[9] ? v3 : i3)) < ((a0[13] * 35) ? (i2 * v0) : (a0[5] * 29)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        v0 = (((79 >= v0) && (i2 != v2)) - ((i2 + 42) >= (71 && a1[1][10])));
+        a0[14] = (((31 - v1) <= (a0[6] * a1[2][14])) / 8);
+    }
+    v1 = (((v2 == v1) <= (a0[7] > 78)) * ((12 * v0) % 9));
+    return (((a1[3][5] != v2) * (v2 ? v2 : 78)) * ((2 / 2) < (69 > v3)));
+}
+int main() {
+    return 0;
+}
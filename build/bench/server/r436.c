@@ -0,0 +1,76 @@
+int f0() {
+    int v0 = 83;
+    int v1 = 31;
+    int v2 = 66;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a0[10] ? v0 : v1) < (v2 <= v2)) == ((v2 == v1) > (v3 > v1)));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((a0[10] < 72) / 8) > ((v3 || i0) < (v3 <= v2)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v3 = (((31 * i1) > (v1 ? v1 : 72)) != ((i0 < a0[12]) || (i0 / 4)));
+                    v0 = (((v2 + a0[11]) > (i1 - v0)) + ((a1[3][11] + 84) * (66 == i1)));
+                    a1[3][14] = (((i0 / 2) ? (53 % 4) : (v3 ? v2 : v3)) && ((v2 || 35) ? (a0[8] ? v3 : v1) : (i0 * 73)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][13] = (((v2 / 6) > (v3 > 89)) - ((a1[2][8] / 8) != (a1[0][10] % 6)));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((v1 <= a1[3][6]) && (50 + a0[10])) / 3);
+    v2 = (((v0 % 1) >= (97 || v1)) % 2);
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((a0[5] / 7) > 93) break;
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v3 = (((12 % 6) - (v3 <= i3)) ? ((a1[0][4] - i3) < (a0[13] ? a0[12] : a0[3])) : ((a0[10] <= v3) && (a0[6] * a0[6])));
+                a1[1][1] = (((i3 >= v2) <= (v2 % 5)) / 9);
+                a0[4] = (((a0[7] < v1) - (i3 ? a1[0][1] : 32)) + ((v1 <= v0) - (i3 / 7)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v2 - a0[0]) && (34 <= 62)) % 9);
+        v1 = (((74 >= 20) > (v2 || 2)) ? ((55 >= 49) ? (65 ? 71 : 10) : (a0[3] - i2)) : ((6 >= v3) % 4));
+    }
+    return (((v1 >= v3) + (v3 > a1[0][5])) / 4);
+}
+int f1() {
+    int v0 = 71;
+    int v1 = 16;
+    int v2 = 10;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v3 < v3) ? (v2 + 73) : (40 <= a0[10])) ? ((a0[14] ? v3 : 79) != (a1[1][10] - 80)) : ((v1 - v0) + (v0 <= a0[9])));
+    if ((((17 + a0[9]) >= (a1[0][13] + v3)) != ((v3 <= v2) / 4))) {
+        v0 = (((v3 - 24) || (a1[3][14] ? 34 : 11)) >= ((93 ? v1 : a1[1][10]) * (v1 && a0[7])));
+        a0[15] = (((v2 - 87) % 3) * ((a0[11] + v3) % 3));
+        v2 = (((v2 - 76) <= (89 >= v1)) - ((v1 - v1) * (v1 - v0)));
+    } else {
+        v1 = (((a1[3][5] + a1[0][0]) % 1) * ((v1 / 6) && (24 && a0[3])));
+        v0 = (((a0[5] <= a1[0][5]) <= (v2 ? v1 : v2)) + ((v3 ? v0 : a0[0]) / 4));
+        v3 = (((v0 <= 24) == (v1 % 6)) + ((v3 || v1) && (a0[9] ? v0 : v2)));
+    }
+    v0 = (((v1 && a1[2][8]) * (v1 * a1[2][2])) - ((a1[2][12] + v3) < (v0 <= 14)));
+    v0 = (((v3 != 0) ? (v1 && v3) : (v3 >= 69)) || ((88 % 3) <= (a1[0][6] >= v3)));
+    if ((((88 >= 26) + (a0[10] == v0)) + ((v1 < v0) <= (v1 + v3)))) {
+        v2 = (((v3 != a0[8]) || (15 - v0)) > ((v0 > 25) <= (a1[2][0] / 7)));
+        v2 = (((v2 && v1) - (22 % 7)) - ((v0 > 51) == (a1[0][15] ? v1 : 20)));
+        v1 = (((v3 ? a1[1][9] : v2) != (a0[8] / 8)) > ((75 * v1) || (a1[0][14] * v1)));
+    } else {
+        v2 = (((v3 + 64) <= (v2 && v3)) && ((a0[12] > 15) - (a0[15] ? v2 : v2)));
+        v0 = (((v0 || v2) ? (55 && v2) : (a1[0][15] - a0[11])) >= ((49 <= v1) ? (v3 - a1[3][1]) : (v3 >= v1)));
+        v0 = (((a0[1] % 5) > (v0 == v0)) || ((90 <= 83) <= (a1[3][7] / 8)));
+    }
+    return (((v2 >= v1) / 4) == ((v0 - a1[1][11]) * (v2 * a1[2][3])));
+}
+int main() {
+    return 0;
+}
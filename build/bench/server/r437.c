@@ -0,0 +1,149 @@
+int f0() {
+    int v0 = 80;
+    int v1 = 65;
+    int v2 = 35;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((a0[14] / 8) - (15 / 4)) * ((93 && v3) == (v1 / 2)));
+    if ((((a0[8] > a1[2][1]) == (v0 % 5)) ? ((a0[10] >= v1) ? (88 != v1) : (v0 >= a0[6])) : ((a1[3][4] < v3) % 5))) {
+        a0[13] = (((a1[2][10] > 78) % 4) || ((v0 > a0[7]) + (v1 % 5)));
+        v1 = (((a0[1] >= v3) != (v0 - v0)) ? ((29 <= v0) == (a0[3] * v0)) : ((71 + v0) && (v3 + a0[13])));
+        v0 = (((a1[1][3] - v3) ? (a0[5] ? v1 : a1[1][4]) : (a1[0][4] ? v0 : 66)) / 3);
+    } else {
+        v0 = (((a0[3] == a0[2]) != (a1[1][5] * v2)) != ((v3 != a1[2][3]) <= (a0[3] > 37)));
+        v3 = (((a1[2][6] + a0[6]) % 9) - ((a0[0] && v2) > (v1 || v0)));
+        v3 = (((58 <= 48) < (v2 >= a0[2])) ? ((83 + v3) * (v0 ? a0[15] : 86)) : ((v3 % 2) <= (36 % 4)));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((v1 + i0) > 75) break;
+        v0 = (((a1[0][5] + v2) < (15 ? a1[1][7] : a0[2])) / 4);
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                a0[8] = (((i0 > 18) <= (v3 % 5)) > ((i0 % 5) == (a1[3][9] ? 77 : a1[0][1])));
+                v2 = (((a1[0][8] && 62) && (v3 <= 48)) ? ((v1 * a1[3][0]) ? (v0 || v2) : (9 % 1)) : ((26 != v3) > (i1 == v0)));
+                a0[12] = (((v3 % 7) >= (a1[0][6] > a1[2][11])) % 2);
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((17 || v0) * (11 >= v2)) || ((i0 <= a0[13]) == (v0 != 3)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((a0[14] + a1[0][1]) > 86) break;
+        a0[9] = (((60 > v0) || (v0 == 92)) / 2);
+        {
+            int i3 = 0;
+            do {
+                v3 = (((v2 || 33) > (i3 ? a0[1] : a0[13])) - ((i3 + 57) / 2));
+                a1[2][3] = (((a0[7] != i3) <= (v3 <= v1)) || ((i3 % 5) > (a0[10] <= 21)));
+                v0 = (((v1 == i2) + (55 && a0[13])) ? ((v0 - v1) != (a0[6] > v0)) : ((v2 >= i3) * (a1[1][12] ? 51 : v0)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v0 = (((v2 < a0[10]) < (v1 - a1[1][7])) <= ((v0 || a1[0][3]) + (a1[0][6] - a1[1][11])));
+    }
+    v2 = (((10 / 5) % 8) > ((a1[0][3] > 86) - (a1[1][6] % 9)));
+    return (((a0[15] >= v3) < (v2 <= v3)) % 9);
+}
+int f1() {
+    int v0 = 57;
+    int v1 = 15;
+    int v2 = 16;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a0[13] || v1) != (v0 > v3)) * ((v2 ? v2 : v3) * (a0[4] * 69)));
+    a0[3] = (((14 < a0[10]) < (v3 < 11)) <= ((76 ? 8 : 21) != (a1[1][5] ? 49 : a0[13])));
+    if ((((v0 - 37) * (v2 * a0[12])) + ((v1 == v1) ? (v0 && v0) : (v3 != 60)))) {
+        a1[0][1] = (((v0 && v2) != (a1[1][8] != v0)) >= ((v1 >= a1[0][7]) - (58 != 34)));
+        v3 = (((a0[7] == 43) - (34 ? a1[0][5] : a1[2][13])) ? ((v0 || 63) / 3) : ((v0 != v3) / 7));
+        v2 = (((18 || v1) < (v2 ? 10 : a1[2][5])) ? ((a1[0][15] / 1) * (a1[0][6] && v1)) : ((v0 - v0) / 9));
+    } else {
+        v2 = (((17 / 3) ? (v3 % 8) : (a0[13] != 3)) && ((v0 - v2) && (v3 >= v3)));
+        v2 = (((v1 >= v2) ? (v3 ? v3 : v1) : (13 >= v3)) < ((34 / 9) && (v2 / 6)));
+        v3 = (((61 - v0) ? (90 <= 62) : (v1 + v0)) / 5);
+    }
+    if ((((v2 == 6) ? (v1 || 34) : (a1[2][11] + v1)) - ((v3 ? 55 : v1) || (v0 == 8)))) {
+        a1[1][14] = (((83 ? v2 : v3) && (66 == a0[0])) ? ((a0[0] != a0[14]) < (v0 % 8)) : ((v3 <= v2) && (a1[2][2] != a1[3][10])));
+        v1 = (((v0 / 5) || (53 && v2)) * ((42 >= 87) ? (v0 ? 44 : 67) : (v3 <= v1)));
+        v2 = (((9 > v1) ? (99 % 1) : (45 < v2)) <= ((a1[0][11] + 10) <= (73 > v3)));
+    } else {
+        v1 = (((a0[7] ? v3 : a1[0][8]) + (v1 > v0)) && ((23 != v0) <= (a0[15] * a0[10])));
+        v0 = (((v1 || v1) != (70 == v1)) % 3);
+        v1 = (((v2 && a0[3]) / 2) < ((26 % 1) - (v2 / 4)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v2 = (((80 || 76) < (v3 < a0[15])) / 1);
+            v0 = (((a1[3][10] - v3) != (i0 > 35)) <= ((a0[15] || v3) / 2));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v2 = (((a0[10] <= 90) != (v3 + 5)) >= ((9 && a1[3][10]) * (i1 < v0)));
+                v1 = (((a1[3][14] * 50) * (a0[9] + a1[0][12])) ? ((2 - a0[7]) % 5) : ((18 / 4) && (v0 ? 48 : 1)));
+                v0 = (((a1[3][1] || v2) && (79 == a0[15])) <= ((a1[2][5] * 48) % 6));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    return (((v0 + 51) * (50 != 13)) % 9);
+}
+int f2() {
+    int v0 = 26;
+    int v1 = 56;
+    int v2 = 39;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((42 || 17) >= (v0 > 47)) > ((v2 ? v3 : 30) ? (a1[3][15] ? 65 : a0[6]) : (20 ? v3 : v1)));
+                    a1[1][0] = (((v0 ? v1 : a1[2][8]) ? (v3 == v0) : (i0 / 5)) > ((i0 && a0[0]) > (1 <= i1)));
+                    v1 = (((v2 && 2) - (i1 && 62)) ? ((54 <= v2) || (46 / 8)) : ((v1 || a0[10]) / 7));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v3 = (((v3 <= a0[2]) > (v1 * v3)) % 5);
+            v0 = (((v2 - v2) >= (13 * a1[3][2])) == ((v1 ? v0 : 95) && (a0[2] > v0)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v3 = (((88 - a1[1][3]) > (30 > a1[1][12])) + ((v3 + v0) % 7));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                a0[1] = (((21 != a1[0][7]) ? (75 == v2) : (a1[0][9] > v3)) > ((v1 >= 21) > (i2 != a1[1][13])));
+                v2 = (((i3 > i2) + (a1[1][6] % 9)) / 8);
+                v1 = (((a0[6] <= v3) + (i2 >= 98)) ? ((37 || i2) && (i2 + 89)) : ((27 - a1[0][12]) == (30 >= v2)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((v0 - a0[1]) > (a0[12] ? a1[1][5] : a0[6])) >= ((v0 ? a0[13] : v1) ? (a0[6] < v1) : (9 * 29)));
+        a0[5] = (((v3 == 16) ? (v3 / 1) : (a1[2][7] != 31)) <= ((v1 % 3) / 8));
+    }
+    a1[0][7] = (((v1 % 8) == (77 && a0[11])) != ((45 == v1) >= (97 ? 88 : v0)));
+    {
+        int i4 = 0;
+        do {
+            if ((66 && a0[2]) > 97) break;
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                if ((a1[3][10] >= v3) > 97) break;
+                v2 = (((4 < a0[2]) < (i4 >= v3)) - ((i4 * v3) ? (a0[11] + 76) : (v3 + i4)));
+                v2 = (((57 == 15) / 4) && ((a1[1][8] + v1) * (a1[0][0] && 45)));
+                a0[13] = (((75 && v1) - (v3 && i4)) > ((a1[1][14] + v0) && (86 < 67)));
+            }
+            a1[3][11] = (((v2 * i4) != (53 == a1[3][9])) < ((4 + i4) > (a1[0][2] != a1[3][2])));
+            a0[14] = (((v3 - v3) - (v1 % 9)) / 8);
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    return (((94 > v0) > (91 - a1[2][6])) + ((v2 * a0[14]) / 3));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,83 @@
+int f0() {
+    int v0 = 68;
+    int v1 = 4;
+    int v2 = 25;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v2 + v3) != (67 && 79)) ? ((v1 % 3) && (a1[2][10] * 75)) : ((a0[6] && v2) == (72 >= 5)));
+            {
+                int i1 = 0;
+                do {
+                    a1[0][2] = (((i0 && i0) > (a1[3][0] && v1)) * ((a1[0][15] ? a1[0][0] : 79) || (v1 && v3)));
+                    v1 = (((a0[2] <= v2) || (v1 + a0[4])) ? ((v1 / 1) && (66 % 8)) : ((v2 == v3) % 9));
+                    v3 = (((44 != a0[10]) + (a1[3][7] || i1)) ? ((a0[4] <= a1[0][11]) > (a1[0][10] || v2)) : ((v3 || 50) ? (v0 + a0[3]) : (a0[2] >= a0[1])));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v3 = (((a0[13] == 92) == (a0[2] + v1)) || ((v0 + 27) * (a1[1][6] != a1[3][8])));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                v1 = (((i3 > 78) >= (i2 ? v2 : 92)) - ((v1 ? v0 : 28) - (v3 && v1)));
+                v1 = (((v1 * v0) * (i3 == v3)) == ((v3 % 9) % 2));
+                v2 = (((i2 || a1[2][0]) / 5) ? ((v1 && a0[5]) != (v0 ? a0[10] : 16)) : ((11 ? 28 : v2) + (98 != a0[6])));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((75 && a0[4]) || (i2 >= a0[15])) * ((i2 >= a1[3][1]) * (a0[2] ? 55 : 93)));
+        v1 = (((v2 > v0) ? (v0 - a0[11]) : (v1 % 5)) != ((a1[1][3] + i2) + (i2 > i2)));
+    }
+    if ((((a0[9] ? v0 : v1) == (v0 * a0[12])) && ((v2 % 4) != (v3 < v2)))) {
+        v2 = (((25 * a1[0][5]) * (a1[3][1] && a1[1][8])) <= ((25 / 8) <= (v0 == a1[1][9])));
+        v2 = (((v0 - 12) ? (a1[0][1] / 5) : (v1 || 62)) >= ((v3 % 6) > (33 * 1)));
+        v3 = (((v1 - v1) - (v2 + 31)) > ((97 == 79) > (v3 - a1[2][7])));
+    } else {
+        a1[1][6] = (((v3 == v0) >= (a0[3] && v2)) > ((v0 && a0[6]) || (a0[2] && v0)));
+        a1[3][15] = (((a0[8] ? a0[6] : v3) < (a1[3][9] <= 34)) > ((a0[13] != v1) == (v1 || v0)));
+        a1[2][5] = (((v1 || a0[3]) + (a0[9] + 10)) || ((a0[11] + a0[3]) - (6 == 23)));
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v2 = (((v0 ? a0[14] : i4) || (v0 == v0)) ? ((v3 && v0) + (v3 / 3)) : ((58 == i4) > (a0[10] / 8)));
+        {
+            int i5 = 0;
+            do {
+                if ((v2 || i4) > 99) break;
+                v1 = (((a1[2][13] && v2) - (i4 * v2)) - ((25 || a1[3][15]) && (v0 >= 36)));
+                a0[5] = (((v2 || 0) <= (a0[14] % 3)) < ((v0 > v1) == (a1[3][3] || 72)));
+                a0[0] = (((v3 * a1[0][9]) != (a0[1] || i4)) + ((v1 >= 1) && (a0[11] * i5)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        v3 = (((v1 <= i4) >= (v0 / 9)) || ((a0[15] / 9) + (i4 >= a0[14])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            if ((a1[3][13] / 7) > 62) break;
+            a0[15] = (((1 == 16) - (92 == a0[5])) ? ((a0[8] > a1[1][9]) || (v3 - a1[3][15])) : ((v0 % 1) != (a0[8] % 7)));
+            a0[2] = (((28 + 97) + (a1[0][8] / 6)) <= ((a0[7] ? 47 : v2) / 7));
+            {
+                int i7 = 0;
+                do {
+                    v2 = (((v2 % 9) + (v2 % 6)) < ((v1 != a0[4]) % 8));
+                    a1[1][1] = (((i7 * a1[2][11]) >= (a0[14] >= v1)) == ((v0 > 87) ? (i7 ? 20 : i6) : (v3 > v1)));
+                    v0 = (((97 + v1) != (i6 != v2)) - ((v0 == i6) != (v0 ? v1 : i6)));
+                    i7 = i7 + 1;
+                } while (i7 < 7);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((a1[3][12] <= v1) > (a1[3][1] || v0)) == ((v0 * v3) && (v2 < v3)));
+}
+int main() {
+    return 0;
+}
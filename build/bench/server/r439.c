@@ -0,0 +1,123 @@
+int f0() {
+    int v0 = 22;
+    int v1 = 71;
+    int v2 = 82;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 / 8) >= (v1 <= v3)) - ((a1[2][2] && 61) / 9))) {
+        v0 = (((v2 && v1) != (a1[3][6] / 3)) % 2);
+        a0[6] = (((v2 && v3) - (v3 + a1[2][1])) < ((v3 + v0) == (v1 >= v1)));
+        v3 = (((21 * 24) > (a0[13] || a1[3][1])) > ((a1[0][6] < a0[9]) - (v3 && v3)));
+    } else {
+        v3 = (((v0 + 19) || (67 ? v1 : a0[7])) != ((v2 * a1[1][11]) != (v1 >= a1[2][14])));
+        v3 = (((76 / 8) * (a0[8] < v1)) > ((v0 ? 97 : 41) && (79 ? a1[1][4] : v3)));
+        v1 = (((v3 ? v3 : 39) != (13 > a0[15])) / 7);
+    }
+    if ((((83 - a0[2]) / 6) + ((v0 % 2) - (v3 ? 37 : a1[3][14])))) {
+        a0[0] = (((v3 >= v3) ? (v1 != 45) : (v0 ? v1 : 70)) ? ((a1[2][10] - v0) ? (v2 * v2) : (a0[15] <= v0)) : ((v2 ? v0 : v2) % 1));
+        a1[3][3] = (((v3 / 8) || (v1 % 5)) % 1);
+        v0 = (((v3 == v3) != (v1 || v2)) % 4);
+    } else {
+        a1[1][12] = (((v0 % 9) > (v3 + a1[1][8])) > ((v3 == v0) >= (a0[3] != v0)));
+        v1 = (((v2 - v1) ? (v1 < v0) : (v3 / 8)) * ((a0[10] % 8) <= (v3 > v2)));
+        a0[7] = (((17 >= a0[2]) + (v1 != v2)) || ((v3 < 76) / 8));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v3 = (((a0[0] < v3) != (a0[10] * 31)) > ((v0 < v3) <= (i0 >= v1)));
+        a0[1] = (((v2 >= v3) > (v1 % 5)) ? ((v0 > 17) + (24 && a0[8])) : ((v1 >= a0[7]) != (a0[7] ? v0 : v2)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v1 = (((1 && a0[12]) ? (v3 - v2) : (i0 >= 47)) && ((v3 >= a0[7]) && (i1 <= a1[0][2])));
+            v0 = (((v3 > a0[7]) + (80 ? i0 : v2)) != ((a1[0][13] - v0) != (a0[2] == i0)));
+            v2 = (((58 > a0[15]) || (v1 <= v2)) ? ((19 > a1[1][13]) * (i0 * v2)) : ((a0[4] == a1[1][3]) == (v3 && v3)));
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v3 = (((v0 < a1[3][8]) - (33 ? a1[0][9] : a0[0])) != ((39 / 9) < (v3 % 9)));
+                v0 = (((a0[12] == v1) > (a0[7] && i2)) < ((a0[5] ? a1[1][9] : 58) ? (v0 - 60) : (v2 && a1[2][8])));
+                v0 = (((v0 ? 34 : v1) > (a1[2][4] < a1[0][9])) < ((v0 < 53) && (62 < a0[7])));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((v0 / 9) * (v3 ? 49 : v3)) * ((i2 > i2) == (v3 == 21)));
+        v0 = (((v2 + a0[1]) >= (a0[14] > i2)) == ((12 % 3) < (a0[14] < a1[3][7])));
+    }
+    if ((((94 / 1) % 5) + ((a1[0][8] != a0[11]) - (86 || a0[3])))) {
+        a0[10] = (((89 < a0[12]) * (v2 == v1)) * ((v2 ? v0 : v2) ? (v2 == v3) : (a1[3][6] >= 42)));
+        v0 = (((a0[9] <= 70) == (60 >= v0)) || ((v2 % 5) + (a0[2] - v1)));
+        a1[2][2] = (((a0[2] <= 12) ? (v3 && v2) : (a0[2] < 46)) != ((v1 && 42) % 1));
+    } else {
+        a0[8] = (((v2 < v3) <= (v3 + v3)) == ((v1 + a1[3][2]) && (v1 < v3)));
+        v3 = (((v1 / 2) * (v3 ? v0 : v3)) == ((v2 >= v0) != (a0[15] + v3)));
+        a1[2][2] = (((v3 ? v2 : a1[3][4]) < (61 + 11)) >= ((97 - v3) - (17 * v0)));
+    }
+    return (((a0[15] <= v0) == (a0[3] > v2)) - ((42 - 99) + (23 * v1)));
+}
+int f1() {
+    int v0 = 0;
+    int v1 = 49;
+    int v2 = 6;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((27 * v2) || (a0[12] > a1[3][5])) ? ((66 ? 23 : a1[0][8]) == (a1[3][9] || a0[7])) : ((56 % 2) && (v0 / 8)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a1[0][3] = (((v3 <= v1) || (68 % 6)) ? ((v3 || v3) * (a0[7] < v3)) : ((84 + i1) % 2));
+                    v3 = (((a0[0] * i0) ? (v3 - a0[7]) : (55 == v1)) == ((v3 + v3) % 3));
+                    v0 = (((1 <= v2) / 9) != ((78 && 62) % 7));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[9] = (((v3 ? v3 : v2) ? (v2 == v1) : (v3 < 93)) + ((a0[7] + 13) && (v2 != v2)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    a0[6] = (((46 == v2) || (a0[6] / 7)) != ((a0[6] ? 93 : v3) ? (v0 <= 53) : (10 <= 6)));
+    if ((((a1[2][9] > v0) > (a1[3][5] && v3)) >= ((v2 - 53) % 2))) {
+        a0[2] = (((76 % 2) - (v3 >= a1[1][11])) % 5);
+        v3 = (((a0[14] % 9) ? (a1[0][15] != v2) : (48 * a0[1])) / 1);
+        a0[7] = (((v3 != v3) ? (80 / 1) : (v1 ? v1 : a0[4])) ? ((26 || v0) % 3) : ((v0 < a1[1][13]) != (a0[11] ? 72 : v2)));
+    } else {
+        a1[2][6] = (((a0[11] + a1[2][2]) >= (v3 * v1)) == ((v3 > v0) >= (v3 % 6)));
+        v0 = (((65 % 9) >= (a0[12] < a0[11])) ? ((43 + a1[3][8]) * (87 + a0[10])) : ((v0 + v3) - (29 * v0)));
+        a1[2][9] = (((50 != v2) * (v2 + 16)) * ((52 == 90) ? (v0 - v3) : (v3 % 2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v1 = (((v2 >= a0[9]) == (v3 && 67)) >= ((v1 > a1[2][9]) ? (v0 * 47) : (a1[2][13] <= a0[15])));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((v2 - i3) == (55 / 1)) < ((i3 * i3) > (v3 == a1[1][4])));
+                    v3 = (((v1 * v2) / 5) != ((v0 / 6) >= (v2 + v1)));
+                    a0[7] = (((a0[6] < 65) > (53 + a1[3][12])) || ((v1 == a0[12]) >= (a1[0][6] >= 24)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a0[5] = (((28 > v0) < (v0 * a1[0][4])) < ((76 >= a0[6]) % 9));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v2 = (((a1[1][0] - 31) / 6) != ((v2 && a1[1][8]) ? (v3 ? a1[1][6] : v2) : (i5 == 69)));
+            a1[3][14] = (((i5 != i5) % 9) ? ((22 >= 88) - (i5 - v3)) : ((i4 || 64) ? (47 && a1[1][2]) : (a1[0][1] ? v1 : 48)));
+            a1[2][5] = (((a1[3][11] - a0[3]) >= (14 && i5)) < ((v2 >= 58) || (72 / 9)));
+        }
+        a0[3] = (((v3 + v1) * (v0 / 9)) ? ((a0[11] / 1) != (a0[9] ? 29 : i4)) : ((v1 ? a1[0][7] : v0) < (v0 < 38)));
+        v3 = (((a0[0] && a1[3][10]) * (v1 <= v1)) && ((v2 ? a1[1][1] : v2) / 1));
+    }
+    return (((68 || a1[2][14]) * (a0[15] % 6)) > ((v2 - v3) * (v3 > a0[10])));
+}
+int main() {
+    return 0;
+}
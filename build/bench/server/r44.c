@@ -0,0 +1,171 @@
+int f0() {
+    int v0 = 7;
+    int v1 = 46;
+    int v2 = 11;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v3 = (((60 + i0) ? (18 ? 29 : v2) : (a0[5] % 4)) >= ((46 != 63) <= (a1[3][1] && 54)));
+            v3 = (((v1 < v0) ? (v2 - i0) : (v2 > 96)) ? ((v3 || v1) == (i0 < a0[6])) : ((i0 < v2) - (17 ? 27 : 41)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v0 = (((i1 == a1[1][11]) == (v2 >= v3)) / 7);
+                v3 = (((i0 * i0) || (v2 / 8)) || ((i0 % 6) + (57 + a1[2][7])));
+                v1 = (((a0[2] != v3) == (a0[12] != i1)) * ((v1 / 9) + (a1[0][0] / 7)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 - v3) < (a1[3][15] % 8)) % 3)) {
+        v1 = (((54 > v0) >= (v2 * a0[12])) + ((36 / 1) && (57 + v0)));
+        a1[2][2] = (((54 != v0) ? (v2 < v0) : (v3 || 86)) <= ((a0[4] >= 72) == (65 ? 31 : a1[1][12])));
+        a0[3] = (((v1 < a0[0]) == (v0 || 68)) * ((v2 || v1) * (v2 > 42)));
+    } else {
+        v0 = (((a1[0][5] || v0) - (v1 / 3)) ? ((a0[3] * a0[7]) != (v1 ? 9 : a1[2][12])) : ((54 % 4) != (v3 >= v1)));
+        v1 = (((v0 / 4) != (v2 + a1[3][10])) < ((a0[3] > a1[3][3]) < (9 % 9)));
+        a1[2][5] = (((a0[1] * a0[11]) && (v0 + v3)) > ((10 <= a1[2][14]) || (17 ? 36 : v1)));
+    }
+    v1 = (((0 <= 53) + (v1 < v3)) < ((94 * v3) - (v1 != v3)));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v0 = (((a1[3][14] <= v1) - (v0 ? v2 : i3)) ? ((v3 * a1[3][14]) * (v0 ? 51 : v0)) : ((i2 * 21) * (34 && a0[1])));
+            v2 = (((35 < a0[8]) > (i3 < 28)) == ((17 == i3) || (i2 > 16)));
+            v1 = (((21 > v2) ? (v1 ? v0 : a0[4]) : (85 == 79)) <= ((v3 <= i3) && (a0[11] == i3)));
+        }
+        v0 = (((a1[1][12] == i2) % 6) / 4);
+        v3 = (((v1 / 6) * (a1[3][14] * v1)) ? ((66 >= v3) ? (i2 > v2) : (v1 % 2)) : ((v1 < v0) / 6));
+    }
+    if ((((v0 % 3) >= (27 == v3)) && ((v0 <= a0[3]) >= (v0 - a1[3][6])))) {
+        v3 = (((10 - v1) < (v0 ? v2 : a1[1][10])) && ((v0 + a0[8]) ? (a1[2][11] < v1) : (v0 <= a1[2][14])));
+        v2 = (((81 <= v0) / 5) != ((a1[3][11] - v0) > (65 || v1)));
+        a0[11] = (((64 - v3) % 2) < ((63 ? a0[5] : v3) > (v2 != 17)));
+    } else {
+        a1[2][6] = (((a1[3][6] <= v0) ? (v3 || v0) : (a1[2][12] && 85)) || ((v1 - v0) != (a1[1][14] > v1)));
+        a1[1][13] = (((a0[0] < a0[8]) >= (v0 && v0)) >= ((16 + v3) * (v2 % 1)));
+        v0 = (((v2 / 1) % 3) || ((v3 || v1) == (v2 - v0)));
+    }
+    return (((73 - 6) && (57 > a0[11])) > ((a0[8] || v3) >= (45 <= a1[3][13])));
+}
+int f1() {
+    int v0 = 77;
+    int v1 = 25;
+    int v2 = 92;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[10] >= a0[15]) / 4) ? ((a1[0][5] || a0[2]) > (a0[8] * a0[8])) : ((v0 ? v0 : v0) * (a1[0][13] != v3)))) {
+        v1 = (((v2 * a0[3]) <= (v0 % 2)) < ((v0 < 0) / 5));
+        v1 = (((95 >= v0) <= (12 < v3)) % 3);
+        v1 = (((21 != v0) % 9) / 8);
+    } else {
+        v0 = (((v1 || v3) == (v0 <= a1[1][2])) * ((v0 || a1[0][4]) ? (7 ? v3 : a0[5]) : (a0[1] <= a1[0][4])));
+        v0 = (((15 ? 69 : v0) < (v2 > a1[0][5])) / 9);
+        v0 = (((v1 > v1) / 4) % 7);
+    }
+    if ((((97 || a0[5]) == (v2 % 2)) + ((v1 ? v1 : 14) * (a1[0][9] > v2)))) {
+        a1[0][10] = (((1 == v1) || (60 < v1)) ? ((v3 / 5) != (a1[2][2] % 7)) : ((v1 < v1) / 9));
+        v0 = (((88 * v1) < (a0[10] % 2)) <= ((a1[3][11] ? v0 : v1) + (88 * 1)));
+        a0[1] = (((v0 != v3) * (a1[0][3] + v0)) && ((v2 * 41) <= (a1[0][13] > 91)));
+    } else {
+        a1[3][7] = (((v1 % 4) % 8) ? ((56 < 35) >= (65 != a0[0])) : ((v0 - v2) <= (v0 + 90)));
+        v0 = (((v2 * v2) ? (v1 % 9) : (a1[3][7] * v0)) == ((a0[3] / 1) / 3));
+        v1 = (((v0 + v1) <= (v2 * a1[0][5])) > ((a1[0][10] + v1) + (7 < 45)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        if ((v1 / 5) > 89) break;
+        {
+            int i1 = 0;
+            do {
+                v3 = (((a1[2][6] >= a1[2][11]) % 9) == ((55 == i0) % 7));
+                a0[13] = (((52 + 44) < (a1[3][1] <= a0[10])) * ((a1[0][9] && 65) * (v0 - 63)));
+                v1 = (((v1 ? v0 : v1) && (63 + 64)) ? ((88 / 1) <= (11 <= 65)) : ((v2 <= v1) ? (a1[3][10] > v2) : (i1 || a0[12])));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        v1 = (((i0 <= 66) + (a1[3][12] == 88)) * ((v2 - i0) >= (a0[4] ? a0[0] : a0[5])));
+        v0 = (((v0 || v3) ? (a0[14] <= 54) : (v1 ? 2 : v2)) - ((a0[0] || a1[1][5]) <= (v1 * i0)));
+    }
+    if ((((v3 && 35) && (a1[2][7] && a0[2])) + ((69 || v1) / 3))) {
+        a0[10] = (((a1[2][10] < a1[2][7]) || (v3 + 83)) % 7);
+        a1[1][5] = (((v2 == v2) == (v3 && v3)) < ((a1[1][12] > 78) == (a1[0][1] <= v0)));
+        a0[1] = (((a1[2][15] == v1) % 1) >= ((v1 >= 50) && (v1 && a0[2])));
+    } else {
+        v1 = (((v3 % 8) != (v2 - v0)) < ((v2 <= v0) - (v1 * 52)));
+        v0 = (((a1[1][11] < a0[11]) * (v3 == a1[3][7])) <= ((a1[1][15] ? v2 : 51) < (39 < a0[0])));
+        v1 = (((v1 ? v1 : a1[3][6]) <= (61 != 48)) % 5);
+    }
+    v3 = (((96 <= a0[0]) / 9) == ((v0 - 55) > (90 <= a0[2])));
+    return (((v3 >= v0) < (11 && v3)) * ((51 >= a0[15]) || (67 != a0[5])));
+}
+int f2() {
+    int v0 = 86;
+    int v1 = 38;
+    int v2 = 61;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v0 = (((v1 == v2) >= (v0 > i0)) == ((v0 >= v3) ? (v2 - v1) : (v0 + a1[3][9])));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v3 = (((v3 == a1[1][1]) / 8) <= ((v2 + 60) ? (83 < v0) : (43 / 4)));
+            a1[1][1] = (((i0 < 32) / 7) || ((45 % 6) / 6));
+            v0 = (((v2 <= 52) ? (v0 * v2) : (a1[1][15] > v2)) != ((v1 % 3) == (v1 % 1)));
+        }
+        v0 = (((81 && a1[2][0]) == (65 == 90)) != ((97 >= a1[2][10]) <= (i0 || v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            if ((v3 * i2) > 87) break;
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v0 = (((a1[1][7] % 8) - (81 * a0[8])) || ((v3 > 40) - (a0[11] < i2)));
+                v0 = (((86 ? i3 : 69) && (13 ? v3 : i2)) || ((26 != a1[0][11]) - (i2 % 4)));
+                v3 = (((v2 != a0[6]) == (a0[8] * a0[5])) && ((i2 <= 13) <= (49 >= a1[2][1])));
+            }
+            a1[3][10] = (((i2 && i2) < (38 * v2)) <= ((v0 > v3) || (i2 < a1[3][15])));
+            v0 = (((v2 && v2) ? (v1 % 7) : (v1 ? 22 : i2)) - ((v2 / 7) >= (v2 ? a1[1][8] : v3)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        a1[3][2] = (((6 && 63) && (a0[4] && v0)) == ((v1 ? v0 : v1) - (i4 <= v1)));
+        v0 = (((a0[9] <= a1[2][9]) + (a1[3][11] ? 22 : i4)) > ((a1[2][0] || i4) ? (v3 + 24) : (v3 + v2)));
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v1 = (((v1 * 46) ? (v3 < 23) : (a0[10] + a1[1][3])) <= ((a0[13] / 5) * (v1 % 4)));
+            a0[15] = (((a0[9] ? v1 : 57) || (v2 ? 49 : v1)) >= ((v0 > 62) && (v1 || i4)));
+            a1[3][15] = (((a0[4] ? a0[12] : 89) >= (i4 % 1)) ? ((v0 <= v3) ? (v3 != v1) : (v2 ? i5 : v1)) : ((a1[0][7] || v3) / 1));
+        }
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        a1[2][1] = (((37 - v2) % 2) > ((v2 * i6) ? (v0 < v3) : (a1[3][3] >= a0[13])));
+        a0[0] = (((a1[1][11] ? v0 : v0) - (v3 > v3)) / 6);
+        {
+            int i7 = 0;
+            while (i7 < 5) {
+                a0[8] = (((v0 / 8) ? (a1[3][8] + v2) : (31 ? a1[0][2] : v2)) % 7);
+                v3 = (((v0 ? v3 : i6) * (v3 ? i6 : v3)) * ((v3 * i7) * (i7 < v1)));
+                a0[0] = (((a0[11] && 45) >= (v3 || v0)) == ((i6 % 1) < (a0[11] > v1)));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    if ((((a1[1][2] != 70) == (a1[0][5] ? 26 : v0)) || ((v0 >= a0[14]) && (a1[3][10] || v1)))) {
+        v0 = (((a1[0][0] - v1) || (v2 >= 84)) <= ((v1 / 5) % 7));
+        a1[1][8] = (((v1 ? a1[2][10] : v2) >= (v3 / 3)) + ((a1[1][6] >= a0[11]) <= (74 || v3)));
+        a0[14] = (((27 ? 8 : v0) / 3) + ((a0[11] < v0) % 8));
+    } else {
+        v3 = (((v3 || 51) ? (v3 || v3) : (v2 || 68)) < ((v0 ? v0 : 16) / 6));
+        v0 = (((v3 / 2) && (v2 > a1[0][11])) % 4);
+        v3 = (((v1 || v3) * (a1[3][11] - v0)) * ((v0 ? v3 : v2) ? (v1 <= v1) : (v0 - a1[3][2])));
+    }
+    return (((v2 ? v1 : v0) < (v1 == v3)) >= ((a1[3][11] <= 87) + (3 >= v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
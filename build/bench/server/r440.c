@@ -0,0 +1,164 @@
+int f0() {
+    int v0 = 89;
+    int v1 = 95;
+    int v2 = 99;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][4] % 5) ? (v3 ? 54 : v2) : (v0 * a0[6])) > ((a0[11] + 62) || (29 != a0[8])))) {
+        a0[9] = (((v2 % 3) - (a1[3][10] <= v3)) > ((a1[2][9] || 7) + (v1 == 40)));
+        a0[1] = (((v3 ? a0[11] : v2) && (74 < 63)) ? ((v2 || v1) % 5) : ((v3 >= v0) >= (44 + 27)));
+        v0 = (((v3 ? a1[1][9] : v2) ? (v1 ? a0[5] : 31) : (v2 > 43)) % 1);
+    } else {
+        v1 = (((v1 == v1) && (v1 ? v1 : 75)) / 2);
+        a0[2] = (((a1[1][7] - v3) ? (v3 / 8) : (v1 != v0)) ? ((v1 ? v0 : a0[6]) < (v3 >= a1[3][13])) : ((v3 == v3) / 3));
+        a0[12] = (((29 ? v1 : v0) <= (a1[3][12] % 7)) && ((a0[13] || a0[4]) || (48 > 64)));
+    }
+    a1[1][10] = (((v3 + v2) < (v3 + 91)) % 6);
+    v2 = (((v1 == 96) / 2) == ((10 / 9) < (a0[4] >= v1)));
+    if ((((v3 + v3) < (a1[2][15] - 70)) || ((83 * 58) || (v2 == 51)))) {
+        a1[3][14] = (((v2 != a1[0][13]) + (64 != a1[2][1])) > ((v0 * a1[0][12]) == (a1[3][11] + a0[3])));
+        v0 = (((a1[3][14] % 1) < (v1 ? 62 : v2)) * ((30 >= v0) <= (62 / 3)));
+        v1 = (((v3 || a1[1][13]) ? (v1 && 18) : (v3 % 6)) % 4);
+    } else {
+        a1[3][12] = (((a0[12] / 3) && (a1[1][10] >= v2)) ? ((a1[3][5] <= a0[10]) * (57 < v2)) : ((v0 || v2) && (a0[15] * v1)));
+        v3 = (((a0[7] >= v3) < (19 * 85)) && ((v0 >= a0[7]) ? (26 % 9) : (80 != 85)));
+        v3 = (((a1[0][9] < v0) >= (a0[11] - v2)) || ((v1 - a0[4]) - (v2 && v1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    if ((v2 * a0[1]) > 61) break;
+                    v2 = (((74 + 15) * (18 - v2)) || ((25 * i1) ? (v0 - i1) : (a1[2][2] % 1)));
+                    v1 = (((78 <= 81) * (a1[0][5] <= a0[3])) == ((36 ? a0[9] : 85) + (90 * v0)));
+                    a0[11] = (((i0 < v2) - (73 - v3)) + ((a1[0][5] != 80) <= (53 > a1[1][11])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[3][15] = (((81 < v2) * (v2 * v0)) + ((i0 ? a1[3][0] : v3) == (a0[3] != v2)));
+            v2 = (((a0[7] / 9) ? (v2 < 48) : (2 && a1[1][13])) - ((i0 == i0) - (a0[9] || v3)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    return (((a1[1][11] % 7) + (a1[3][12] % 4)) >= ((a1[2][13] < v2) * (v1 >= a1[0][1])));
+}
+int f1() {
+    int v0 = 43;
+    int v1 = 94;
+    int v2 = 50;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v3 = (((a1[1][6] + v3) ? (i0 && v2) : (i0 - 69)) + ((45 && i0) % 4));
+            v2 = (((v3 <= 98) - (25 <= v0)) < ((v0 ? 4 : i0) - (12 % 4)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((a0[0] + 73) > 98) break;
+                    a1[2][12] = (((a0[6] || v0) <= (a1[0][5] < a0[4])) == ((a1[1][7] ? a1[2][13] : a0[8]) != (a1[0][2] % 6)));
+                    a1[3][10] = (((32 % 8) + (v2 - a1[3][3])) ? ((a1[3][11] || a0[10]) > (v0 < a0[14])) : ((a0[0] != a0[14]) / 5));
+                    a0[4] = (((a1[0][13] < a0[6]) < (i1 < i0)) ? ((v2 + v2) != (86 && a1[1][10])) : ((v1 && 31) / 7));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((a0[14] == v3) ? (a0[10] || 0) : (v1 != a1[3][3])) / 6);
+    if ((((v3 || 97) - (47 && v3)) || ((70 == a1[2][14]) - (72 * 1)))) {
+        a1[2][12] = (((92 && v2) * (62 != 51)) > ((a0[8] - a1[0][5]) ? (a1[3][0] + a1[3][15]) : (42 - v3)));
+        v1 = (((24 < v2) >= (8 * 16)) <= ((v2 * v2) < (7 != v0)));
+        v1 = (((a0[1] % 2) ? (v0 != v3) : (v3 || v2)) <= ((v1 >= v2) - (14 ? v0 : a0[0])));
+    } else {
+        v2 = (((a0[13] <= 97) <= (a1[3][9] == a0[7])) > ((v1 + v1) - (v0 || v1)));
+        a0[15] = (((v0 % 1) || (a0[3] ? v3 : 70)) && ((v2 >= v2) < (a0[7] && v1)));
+        a0[9] = (((12 < v3) > (a1[3][13] || v2)) <= ((96 == 55) && (v0 != 16)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            a0[14] = (((a1[2][4] / 9) <= (a0[5] + i2)) / 1);
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((50 ? i3 : a0[0]) % 6) / 3);
+                    v0 = (((93 == 53) != (v3 ? v3 : v0)) % 4);
+                    v2 = (((a1[3][8] >= v3) - (75 && i3)) == ((a1[1][3] * 20) ? (88 % 9) : (0 >= i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a1[2][5] = (((v3 || 56) < (63 / 1)) % 4);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((37 ? v3 : v3) || (91 / 1)) <= ((v0 < v3) == (v1 ? v1 : v0)))) {
+        v3 = (((v2 >= 66) || (a0[2] - 47)) > ((v2 == v2) ? (a0[11] <= v1) : (v0 > v0)));
+        v0 = (((a1[3][0] == v1) + (v2 ? v1 : v1)) || ((v3 < 15) < (a1[0][6] && v0)));
+        v2 = (((v1 < v2) != (a0[9] == v0)) % 9);
+    } else {
+        v1 = (((v2 == v1) - (v3 && 40)) == ((v1 < 86) < (v3 >= v0)));
+        a1[0][7] = (((a1[2][8] > v2) ? (a0[11] < v1) : (6 ? 5 : v2)) > ((a1[2][6] + v3) * (a0[13] && a1[1][3])));
+        v3 = (((v0 % 9) / 9) * ((v1 + v1) + (a0[2] == 81)));
+    }
+    return (((30 / 5) / 6) == ((v0 != v1) < (17 * v1)));
+}
+int f2() {
+    int v0 = 77;
+    int v1 = 14;
+    int v2 = 51;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 / 8) % 1) * ((10 % 6) >= (2 < v2)))) {
+        v1 = (((v2 <= 33) - (v1 % 6)) < ((v3 ? a1[1][5] : 44) * (a0[0] && 18)));
+        v1 = (((21 != v0) <= (92 != a1[1][7])) > ((a0[14] % 9) > (v0 < v2)));
+        v1 = (((v0 ? a1[1][15] : 77) > (25 ? 62 : 10)) % 4);
+    } else {
+        v2 = (((57 && v3) > (a1[2][13] > v0)) % 7);
+        a1[2][4] = (((71 && a0[13]) ? (v3 || v3) : (v2 > 29)) >= ((a0[13] ? 67 : v0) == (v3 - a1[1][12])));
+        v1 = (((21 > a0[6]) * (a0[0] + v1)) * ((v2 % 8) + (30 >= v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((a0[8] + v1) > 83) break;
+            v0 = (((i0 == 21) - (a0[13] <= i0)) + ((v1 || 47) < (87 ? 21 : a0[13])));
+            a1[2][5] = (((72 < v3) && (91 <= v1)) % 1);
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v3 = (((a0[0] <= v2) > (v1 > v1)) > ((v3 < v2) - (23 + v1)));
+                a1[3][12] = (((a0[2] < v2) < (v1 ? 34 : v2)) + ((a1[1][5] > v1) ? (a1[2][2] < v1) : (v0 * a0[15])));
+                v0 = (((a1[3][8] >= v1) - (v3 ? 72 : a1[0][8])) - ((i1 ? v1 : i0) * (14 ? 70 : i0)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((a1[3][1] / 2) || (v1 || a0[4])) == ((v2 != a0[8]) == (a1[0][11] <= 14)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a0[4] = (((a1[2][8] % 2) * (i2 > i2)) % 1);
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((41 != 3) < (a0[15] - i2)) < ((a1[1][8] > 46) != (19 ? a0[13] : i3)));
+                    a1[1][7] = (((a0[14] <= v3) ? (a0[0] == a1[2][7]) : (89 != 54)) == ((a1[0][14] * 87) || (59 * v3)));
+                    a0[11] = (((48 / 7) < (93 * 68)) / 5);
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v1 = (((i2 + 17) || (v3 / 6)) / 4);
+            i2 = i2 + 1;
+        }
+    }
+    a0[8] = (((42 <= 48) + (a1[0][11] && a1[0][0])) || ((v1 == a1[0][4]) < (a0[15] <= 44)));
+    return (((v1 ? 47 : 31) > (v0 % 4)) <= ((v0 / 8) == (a1[3][12] ? a1[0][1] : v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 50;
+    int v1 = 96;
+    int v2 = 53;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v0 = (((a0[2] && i1) ? (0 == v0) : (24 ? v1 : 31)) > ((a1[1][14] * v0) ? (i0 % 5) : (v2 % 3)));
+                    v2 = (((i0 ? a0[2] : 44) < (a0[2] >= a1[3][8])) == ((79 * 72) != (v0 >= a0[6])));
+                    a0[4] = (((a1[0][12] >= 45) || (i1 <= v1)) ? ((v1 || 73) - (v1 ? i1 : v0)) : ((i1 - i0) <= (60 - v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[0] = (((v2 || a1[3][15]) * (v1 + i0)) <= ((v3 * i0) + (77 + 53)));
+            a0[10] = (((a1[1][10] >= i0) + (a1[3][2] * a1[1][2])) && ((73 < 24) ? (21 != v2) : (v2 + v2)));
+            i0 = i0 + 1;
+        }
+    }
+    a1[3][6] = (((v2 < v2) > (a1[1][7] - v3)) != ((v1 * v1) <= (a1[1][8] < v1)));
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v0 + 75) * (v0 >= v2)) > ((88 ? v0 : i2) - (a0[8] || 14)));
+            v2 = (((28 && a0[2]) <= (63 < v3)) != ((62 ? v1 : a1[2][14]) != (i2 <= i2)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v2 = (((v2 * v2) && (37 / 1)) + ((v1 > 58) > (a1[1][5] - 12)));
+                    v3 = (((a0[3] - i2) - (20 || i2)) <= ((50 || 98) < (v0 == v2)));
+                    v2 = (((v1 ? a0[10] : v0) <= (a1[1][2] < a0[15])) && ((i3 && v0) + (i2 < 5)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        a0[0] = (((i4 / 9) || (i4 ? v3 : i4)) > ((a0[6] ? 57 : a1[2][1]) ? (v3 % 4) : (v0 ? v3 : 68)));
+        v1 = (((v1 ? 14 : a1[3][6]) + (19 / 8)) % 7);
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v3 = (((a1[2][10] * 92) && (a1[2][9] == i5)) && ((12 >= i5) > (v0 ? a0[2] : v1)));
+            a1[2][11] = (((a0[1] / 8) == (a0[13] != i4)) <= ((v1 == 86) != (a1[0][7] && v0)));
+            a0[2] = (((24 < v3) + (v3 <= 22)) ? ((89 && a1[1][8]) > (a0[4] > a0[5])) : ((a0[11] - v0) && (i4 > 40)));
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            v2 = (((17 / 1) >= (v3 - a1[1][0])) + ((a0[0] - v1) || (77 + i6)));
+            a0[9] = (((v0 <= a0[9]) * (v2 != a0[0])) * ((v2 + i6) ? (i6 / 6) : (v1 != 88)));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                if ((v2 < 77) > 56) break;
+                v1 = (((v2 >= 59) / 7) ? ((a1[1][0] % 4) <= (12 >= v2)) : ((a0[7] != i6) != (a1[2][9] && v0)));
+                a0[9] = (((24 + v0) ? (a0[5] || 60) : (a1[3][4] + 63)) * ((36 - v2) / 6));
+                v2 = (((62 % 4) + (a0[8] ? 9 : a0[4])) % 6);
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v3 < v0) >= (v0 <= v0)) || ((v2 || 17) % 3));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,114 @@
+int f0() {
+    int v0 = 49;
+    int v1 = 84;
+    int v2 = 26;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a1[2][0] && v0) ? (a1[2][15] - v1) : (v3 <= 32)) && ((57 <= v3) >= (v2 - 31)));
+    if ((((80 >= v3) ? (v2 && v3) : (v1 ? a1[3][0] : a0[8])) > ((81 != a1[1][8]) + (v2 + v3)))) {
+        v2 = (((v0 % 8) < (v3 > v1)) > ((a1[0][0] ? 85 : 91) || (79 == 55)));
+        v1 = (((v3 > v3) - (a0[13] || 16)) ? ((v0 >= v3) <= (a0[9] == a0[10])) : ((v0 != v2) ? (a1[1][3] && v3) : (v1 % 8)));
+        a0[2] = (((a1[1][1] * v2) % 5) <= ((v2 % 8) <= (v3 ? a0[13] : a1[0][0])));
+    } else {
+        a1[2][2] = (((v3 < 99) && (v2 <= v1)) < ((73 || v0) + (v2 != v1)));
+        v3 = (((70 > v3) < (v0 ? 79 : v1)) - ((a1[0][2] || 70) <= (v3 != v3)));
+        v0 = (((31 && a0[14]) <= (94 - 8)) + ((v3 && v2) && (v1 > v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((i0 / 2) ? (v1 >= 18) : (92 || a1[1][7])) || ((v1 || v2) && (a1[2][6] > 54)));
+            a1[3][12] = (((a0[3] > a1[0][0]) != (70 != a1[1][10])) <= ((v0 - v2) != (71 == v1)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a0[6] = (((i0 < i1) ? (v1 <= 86) : (89 % 3)) != ((a1[0][13] || a0[8]) && (a1[0][5] != v2)));
+                    a1[0][4] = (((62 > 78) / 6) > ((v0 || 95) - (a1[3][7] == a1[3][6])));
+                    a0[0] = (((a1[0][13] * v2) % 5) > ((i1 && 17) || (i0 == a0[14])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((0 == v1) <= (v2 < v3)) > ((v1 && 58) * (v0 % 5)))) {
+        a0[0] = (((a0[4] < v0) - (v2 + a0[1])) < ((v3 == v2) > (v0 >= v2)));
+        v0 = (((57 % 2) != (v0 || v0)) != ((50 < 35) != (v2 / 2)));
+        a0[2] = (((v2 != 86) || (88 || 33)) / 7);
+    } else {
+        v1 = (((v3 != a0[8]) ? (v2 / 2) : (11 && v1)) || ((a0[12] % 7) % 6));
+        v0 = (((a1[0][8] / 7) / 4) / 7);
+        v0 = (((v3 && 70) < (37 <= v1)) < ((v0 ? v1 : a0[9]) < (v3 + v3)));
+    }
+    if ((((v3 < 63) >= (v1 + v3)) * ((v0 % 6) && (a0[6] / 7)))) {
+        v3 = (((v2 <= v3) && (48 > a0[9])) || ((v2 == v3) + (v2 >= 21)));
+        v1 = (((v0 ? v1 : a1[1][8]) * (v2 - 86)) / 9);
+        v0 = (((58 && v2) - (v3 <= v2)) != ((v2 != 54) ? (a0[0] % 1) : (77 + v0)));
+    } else {
+        a0[14] = (((v2 + a1[2][2]) / 3) / 2);
+        v3 = (((a0[11] != 65) / 9) + ((v1 * v3) < (v1 == v0)));
+        v3 = (((v2 >= a1[1][9]) == (90 - a1[1][15])) - ((v3 >= a1[3][11]) || (50 / 3)));
+    }
+    return (((a1[2][7] ? v1 : 38) || (a1[2][15] >= 42)) == ((86 < 35) < (v1 && v0)));
+}
+int f1() {
+    int v0 = 32;
+    int v1 = 17;
+    int v2 = 91;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((a0[14] / 6) > 56) break;
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v1 = (((a1[3][1] < i0) ? (v3 % 3) : (i0 + a1[2][5])) * ((70 % 5) == (a1[1][8] ? 97 : v0)));
+                v0 = (((i1 > v3) / 4) * ((i0 >= 91) / 2));
+                v2 = (((i1 == v2) - (a0[8] % 4)) / 8);
+            }
+            v0 = (((i0 ? v0 : i0) != (18 != a1[1][14])) + ((v2 / 2) == (i0 % 2)));
+            v1 = (((94 >= a1[2][13]) < (i0 || a1[0][15])) ? ((v1 % 4) ? (80 ? v0 : a1[0][11]) : (71 * v2)) : ((i0 == i0) ? (80 < a1[1][13]) : (v2 && v3)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v2 - i2) > 71) break;
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v0 = (((a0[10] && 10) % 4) >= ((v0 > v0) ? (98 >= 33) : (63 && a1[2][11])));
+                v2 = (((a1[1][2] != i2) - (58 != a1[2][13])) <= ((i2 < 86) <= (i2 == 97)));
+                v1 = (((a1[2][14] + a0[1]) + (a0[12] * i2)) * ((a0[4] - 83) % 2));
+            }
+            a1[0][15] = (((93 ? v1 : v3) && (a1[3][13] >= v1)) != ((a0[10] - a1[0][7]) < (v0 % 3)));
+            a1[3][0] = (((a0[12] / 3) == (a0[2] == v1)) > ((v2 != 31) % 3));
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((87 == a0[6]) || (v2 < v3)) == ((58 ? v0 : v1) ? (8 % 9) : (a0[15] != v2)));
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            v1 = (((i4 % 6) % 6) - ((v1 * a1[0][4]) + (v0 > v3)));
+            {
+                int i5 = 0;
+                do {
+                    if ((a0[3] * 40) > 90) break;
+                    v1 = (((a1[1][8] || v0) <= (v1 == v0)) ? ((v3 * v3) / 3) : ((76 || i4) && (a0[15] || v0)));
+                    v0 = (((v3 <= 41) && (i4 ? i4 : 72)) ? ((a0[7] != a0[13]) % 3) : ((a0[8] - a0[14]) * (89 ? 32 : a1[1][8])));
+                    v0 = (((v0 + 2) != (v3 == a0[0])) ? ((v2 < a0[10]) > (i5 <= 57)) : ((69 ? v1 : i5) - (v3 >= v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v1 = (((58 > v1) >= (56 != a1[1][9])) ? ((v1 % 9) > (v1 - v2)) : ((36 % 2) + (i4 == a1[1][12])));
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((81 + v0) <= (31 == v1)) == ((v3 && a0[12]) / 7));
+    return (((a1[0][6] / 1) ? (v2 || v3) : (77 <= a0[5])) % 7);
+}
+int main() {
+    return 0;
+}
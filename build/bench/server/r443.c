@@ -0,0 +1,168 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 76;
+    int v2 = 31;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 < 98) < (v2 > v0)) || ((33 * v2) ? (v3 < v0) : (80 != v0)));
+    v2 = (((51 < v1) && (v2 > 91)) == ((v2 * v1) <= (v2 == 91)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((36 % 2) > 71) break;
+            a1[1][3] = (((a1[0][0] > 43) == (85 >= v3)) ? ((6 + v2) >= (i0 - v2)) : ((45 == 59) / 7));
+            v2 = (((v0 == a1[0][13]) / 8) > ((i0 <= 87) || (a0[11] >= 98)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v3 < a1[3][6]) > 53) break;
+                    v1 = (((i0 % 4) + (v2 != a0[1])) ? ((70 < i1) < (v1 >= a1[0][14])) : ((a0[15] == v1) && (v3 || v2)));
+                    v3 = (((v3 <= i0) / 6) != ((i0 == i0) <= (v2 / 1)));
+                    a1[2][1] = (((54 || i1) < (i1 * a0[15])) ? ((24 - v0) == (i1 % 9)) : ((i0 * 84) / 1));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((a0[11] ? v1 : 43) > 96) break;
+            v3 = (((72 >= v0) ? (96 && v1) : (a1[3][0] ? i2 : 26)) % 5);
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((61 / 3) > 85) break;
+                v2 = (((46 == v1) < (v2 * v2)) <= ((v2 / 5) - (a1[3][10] > 35)));
+                a0[15] = (((13 ? v3 : v0) / 2) * ((a1[3][11] - v2) > (a1[2][5] * 54)));
+                a0[14] = (((12 > a1[1][15]) + (v2 - 69)) < ((a1[1][7] + v2) + (v3 - a0[6])));
+            }
+            v1 = (((49 % 4) || (v2 * 26)) * ((v0 ? i2 : 70) - (a0[10] + v0)));
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((19 - v2) * (49 && 58)) <= ((v3 == 44) && (v3 ? v0 : 87)))) {
+        v2 = (((81 == v2) % 6) + ((a1[0][11] != 63) > (a0[15] < v0)));
+        v3 = (((88 <= v0) <= (34 ? v2 : v3)) && ((v2 <= v1) || (a1[1][11] <= a1[3][5])));
+        a1[0][4] = (((16 ? v0 : v0) >= (v2 <= v2)) < ((v0 != v1) || (a1[1][7] % 8)));
+    } else {
+        v1 = (((44 >= a1[0][5]) ? (a0[6] || 48) : (91 <= v1)) >= ((v1 > a0[4]) || (a0[0] % 9)));
+        v1 = (((v3 - v1) / 1) + ((v0 < v2) || (v3 == v3)));
+        v2 = (((a0[15] >= v2) + (93 / 3)) ? ((96 > v0) - (a1[1][7] * v1)) : ((79 != v0) - (v1 / 1)));
+    }
+    return (((v2 < 23) && (v2 <= v3)) ? ((v2 ? a0[5] : a1[0][11]) + (v3 && a1[0][4])) : ((v2 ? v3 : a1[3][12]) > (v3 > a0[14])));
+}
+int f1() {
+    int v0 = 32;
+    int v1 = 39;
+    int v2 = 70;
+    int v3 = 84;
+    int a0[16];
+    int a1[4][16];
+    a0[11] = (((38 - v0) % 9) >= ((a1[1][8] - v1) == (v3 - v0)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((v0 > 79) > 97) break;
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v2 = (((33 <= v2) % 9) <= ((v2 ? v3 : 53) - (v2 != 23)));
+                v3 = (((a0[13] || v2) <= (43 || 19)) < ((v0 || a0[5]) && (i0 != 74)));
+                v0 = (((v2 * a0[11]) / 8) ? ((v1 / 7) || (i1 ? 14 : a0[4])) : ((v1 || a1[0][12]) > (a1[0][3] < a0[7])));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((a1[2][2] >= v1) % 5) <= ((v1 || a0[6]) > (a0[5] >= v2)));
+        v2 = (((v3 + v2) >= (64 ? v3 : v1)) < ((25 >= a0[9]) != (v0 + v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v3 % 8) > 91) break;
+            v2 = (((v1 > 34) > (v0 > i2)) != ((v2 < v3) % 1));
+            v2 = (((72 ? 52 : 71) / 6) / 8);
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v3 = (((a0[0] < a0[13]) == (v0 > i2)) == ((i3 ? i2 : v1) && (a0[0] || i3)));
+                v1 = (((a1[1][4] ? 75 : v1) - (v0 == v1)) && ((v0 ? v2 : a1[1][12]) <= (v2 - a0[14])));
+                a0[1] = (((v0 != 60) == (v1 >= a1[3][14])) / 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 8; i5 = i5 + 1) {
+            v0 = (((v0 == i5) >= (v3 || a1[2][8])) && ((a0[3] <= a1[2][4]) ? (v2 ? v3 : i5) : (v0 % 5)));
+            v1 = (((v0 || v2) && (i5 <= v1)) != ((v2 != v2) || (v2 + a1[0][8])));
+            v0 = (((v0 - 53) % 6) + ((i4 <= v1) || (42 < a0[8])));
+        }
+        v2 = (((v0 + 75) || (95 > i4)) % 1);
+        v3 = (((a1[2][3] + v1) > (v0 < v1)) + ((v1 <= v3) > (a0[0] < a1[3][15])));
+    }
+    v2 = (((v2 ? v2 : v2) || (26 / 5)) && ((19 == 25) % 7));
+    return (((a1[0][3] == v2) == (v2 < v2)) > ((v0 ? a1[1][11] : 25) != (v1 == 91)));
+}
+int f2() {
+    int v0 = 50;
+    int v1 = 74;
+    int v2 = 13;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 / 9) >= (v2 != v3)) == ((50 <= 92) % 4))) {
+        v2 = (((a0[1] <= v3) || (v3 != v0)) >= ((a1[2][2] >= a0[9]) || (v3 > v1)));
+        a0[13] = (((a1[3][6] - a1[2][4]) + (v1 * v2)) == ((a0[14] - v2) > (a1[3][0] != v3)));
+        a0[1] = (((20 >= 50) / 5) > ((v3 || a1[0][10]) / 7));
+    } else {
+        v2 = (((v3 < 38) + (v1 + v3)) && ((97 > 7) + (a1[3][9] || a1[3][6])));
+        v1 = (((90 <= v3) * (4 * 87)) - ((v1 <= 26) >= (a1[0][6] - v2)));
+        v3 = (((v3 || 91) / 1) || ((v1 >= v2) <= (v2 + v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v2 = (((v0 || i1) == (i1 && 17)) ? ((76 * v1) <= (v0 == v2)) : ((a0[13] * 16) < (a1[2][1] != 6)));
+                    a1[0][2] = (((a0[10] == i1) / 2) ? ((97 / 4) ? (v0 ? v0 : a0[11]) : (59 <= v2)) : ((v2 + v1) / 4));
+                    v3 = (((24 / 7) ? (64 / 4) : (v2 != v3)) ? ((91 / 2) * (79 > i0)) : ((v0 == v3) || (70 || i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v3 - v2) == (i0 || 52)) / 7);
+            v3 = (((v0 == 47) != (a0[0] || a0[8])) - ((v2 != 91) || (a1[2][7] ? a0[15] : a0[0])));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v3 + v1) - (v1 % 4)) >= ((a0[13] ? 45 : a1[1][11]) != (v2 < 14)));
+    if ((((v1 % 3) ? (33 && v1) : (a0[7] || v1)) - ((v3 - a1[0][9]) * (12 < v3)))) {
+        v0 = (((v2 / 3) < (61 || v2)) + ((45 <= v2) <= (a0[11] != 28)));
+        v2 = (((a1[0][11] <= v0) * (57 ? v1 : v2)) == ((40 / 8) - (a0[4] || v1)));
+        a0[7] = (((a0[2] != a0[3]) > (v1 + a1[3][9])) >= ((v0 ? 25 : 58) ? (a0[11] ? v0 : a1[3][1]) : (81 > v0)));
+    } else {
+        v0 = (((84 >= v3) * (v3 + v0)) * ((5 + v2) % 8));
+        v1 = (((v2 >= v3) != (7 * a1[0][12])) == ((a0[14] / 2) >= (a0[7] >= v1)));
+        a1[1][4] = (((14 * v2) >= (a1[2][12] * v0)) != ((v1 % 1) <= (a0[2] || v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((27 < a0[8]) > 87) break;
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v1 = (((a0[8] || v0) / 2) - ((61 <= a0[11]) ? (i2 < v1) : (i2 > 99)));
+                    v3 = (((i2 && a1[0][12]) != (i2 ? a0[9] : v0)) > ((i2 <= v0) % 1));
+                    a0[2] = (((v1 && 71) < (82 < 43)) && ((v2 && v1) ? (v3 * i3) : (i3 != 29)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((i2 ? i2 : v1) >= (28 && v0)) <= ((v2 ? 15 : a0[5]) / 4));
+            v3 = (((a0[1] ? v1 : a0[14]) >= (a0[9] / 6)) && ((a0[0] || 14) / 2));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((a1[2][3] >= v2) == (v2 > v3)) && ((a0[11] % 9) >= (a1[2][11] ? v1 : a1[2][11])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,41 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 16;
+    int v2 = 21;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][6] != 24) <= (67 <= 31)) ? ((v0 / 6) == (64 * 42)) : ((v0 / 1) - (a0[1] <= v3)))) {
+        v3 = (((v2 == v3) < (a0[6] < 64)) + ((16 || v3) != (a1[2][5] <= 97)));
+        v0 = (((v0 || 84) < (28 ? 28 : 32)) <= ((58 ? v3 : a0[9]) ? (5 * v0) : (25 / 4)));
+        v3 = (((v1 != v0) < (v0 < a0[1])) < ((a1[0][15] || 59) <= (v0 < a1[3][13])));
+    } else {
+        v2 = (((a1[2][11] == v1) ? (a0[15] || a1[3][8]) : (v3 >= 82)) <= ((61 ? a1[2][3] : v0) <= (75 - 21)));
+        a1[0][2] = (((a0[12] > v3) && (2 + 54)) >= ((v2 != v0) ? (v0 < 83) : (v3 <= 7)));
+        v2 = (((a1[1][8] == v1) == (v2 > a0[1])) && ((v2 < 13) ? (v3 - v2) : (v3 ? v2 : v1)));
+    }
+    a1[2][8] = (((v0 || v1) % 1) || ((42 <= v2) >= (v3 > 71)));
+    a1[0][1] = (((v1 <= v3) ? (49 <= v2) : (v1 / 7)) >= ((a1[1][9] % 7) % 7));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v3 = (((29 != i0) == (v0 - a1[0][1])) && ((17 != 88) <= (39 >= i0)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a1[1][3] = (((v2 / 4) && (a1[2][5] >= v1)) ? ((v0 != v3) + (74 + a0[12])) : ((69 <= 29) < (v2 - a0[9])));
+            v2 = (((v2 ? v1 : v3) >= (v2 + a1[3][5])) || ((v3 - v2) && (a1[1][1] <= v1)));
+            v3 = (((v2 + v3) <= (53 - v1)) ? ((v3 || a0[13]) <= (a1[2][13] < i0)) : ((v0 || 0) >= (a0[15] != 96)));
+        }
+        a1[3][2] = (((v1 ? a0[6] : 44) / 8) && ((a0[11] * v2) >= (v0 + i0)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a1[1][1] = (((1 > v1) == (a1[0][12] && a1[3][12])) * ((v1 >= i2) || (v3 || v1)));
+            v1 = (((v1 != i2) / 8) * ((a1[2][2] <= 6) / 4));
+            v0 = (((a1[2][2] < 88) ? (v1 <= a0[10]) : (19 ? a0[12] : v3)) > ((38 + v0) ? (v2 != i3) : (72 * v3)));
+        }
+        v3 = (((i2 % 1) ? (v3 * 29) : (57 + v0)) - ((a1[3][14] <= 28) > (a1[3][10] <= 89)));
+        v2 = (((a0[1] == v3) ? (v2 < 49) : (a0[4] * i2)) + ((62 * v1) && (67 != 81)));
+    }
+    return (((v1 ? a1[1][0] : v1) + (66 != v0)) != ((a1[3][4] ? 84 : 62) < (v0 <= v1)));
+}
+int main() {
+    return 0;
+}
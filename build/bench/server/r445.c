@@ -0,0 +1,134 @@
+int f0() {
+    int v0 = 87;
+    int v1 = 50;
+    int v2 = 3;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            a1[1][13] = (((v1 <= 77) ? (v1 * v3) : (i1 <= a0[11])) || ((a0[6] >= v3) ? (a1[3][15] || v2) : (92 / 4)));
+            v0 = (((a0[8] != i0) > (i1 ? a1[3][10] : v1)) <= ((a0[7] ? 64 : a1[0][10]) < (a1[3][4] > a1[2][8])));
+            v0 = (((i1 / 9) - (i0 > v3)) < ((i0 % 1) ? (a0[5] / 9) : (a0[15] || a1[1][10])));
+        }
+        v1 = (((a1[3][9] ? 10 : v1) || (v1 != 66)) % 5);
+        v1 = (((56 ? i0 : v2) ? (v2 && 33) : (a0[1] + v2)) + ((i0 / 9) != (43 == a1[0][1])));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            a1[2][15] = (((v0 >= v0) < (v3 * 65)) > ((85 / 3) > (a1[0][3] < v3)));
+            a1[0][10] = (((a1[2][10] || i2) / 1) < ((a0[10] > i2) < (v2 * 34)));
+            {
+                int i3 = 0;
+                do {
+                    a0[10] = (((v2 || v3) + (61 < 63)) % 3);
+                    v3 = (((i3 && v0) > (i3 + 12)) % 1);
+                    v2 = (((50 * v0) * (v0 != v2)) <= ((a1[1][13] % 4) <= (v3 >= a0[14])));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((48 / 2) > 85) break;
+            v2 = (((v0 <= 48) && (86 - a1[0][9])) != ((v1 ? v2 : 66) || (75 ? v1 : 82)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((i4 != a1[2][6]) ? (v1 > i5) : (61 % 1)) / 6);
+                    a0[11] = (((33 % 5) || (36 == 89)) ? ((v2 / 5) >= (23 - a0[14])) : ((v2 ? v0 : 54) < (v3 != v3)));
+                    v1 = (((a1[1][8] + v0) != (v3 - a1[2][9])) < ((48 > v1) ? (v2 && 69) : (58 != a0[8])));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v0 = (((v0 * v1) || (v1 / 8)) / 7);
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    if ((((92 + a0[7]) >= (a1[3][1] > v1)) - ((v3 % 4) && (5 + 31)))) {
+        v3 = (((v0 / 5) < (a0[5] != v1)) || ((v2 > v3) ? (v1 < 50) : (a1[2][1] > v0)));
+        a1[2][12] = (((15 % 6) ? (v3 ? a0[15] : 42) : (23 - v2)) != ((v3 > v0) >= (v0 || v3)));
+        v3 = (((98 / 3) < (9 / 9)) && ((a0[3] * 60) != (v2 < a0[8])));
+    } else {
+        v2 = (((a1[3][0] < 49) <= (a0[13] >= 80)) && ((a0[7] <= 59) * (81 % 7)));
+        v3 = (((a0[5] % 3) && (v3 > 35)) && ((v2 || 87) == (a0[8] != v1)));
+        a1[3][0] = (((v2 < v1) + (v3 || v2)) || ((v1 > v0) % 9));
+    }
+    v2 = (((v3 == v3) >= (v2 ? 68 : 22)) <= ((v0 / 9) <= (a1[0][7] - a1[1][11])));
+    return (((61 != v0) >= (v3 / 9)) - ((v1 + v2) < (22 <= v1)));
+}
+int f1() {
+    int v0 = 31;
+    int v1 = 99;
+    int v2 = 99;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][1] || a1[1][0]) / 9) ? ((v1 ? v0 : v0) == (v2 ? v0 : 70)) : ((a0[4] ? a1[1][3] : a1[1][7]) - (a0[15] - v0)))) {
+        a1[2][4] = (((8 >= v3) ? (a1[2][3] < v2) : (a0[6] && 84)) + ((v3 * 77) != (24 % 2)));
+        a0[5] = (((v0 >= v0) ? (a1[0][11] <= v2) : (a0[8] != 48)) <= ((a1[1][3] > a0[6]) >= (6 - a1[0][14])));
+        v0 = (((73 && v3) != (v1 ? 55 : v1)) ? ((42 > v3) < (v3 <= 4)) : ((v3 % 3) + (v0 - v2)));
+    } else {
+        v0 = (((v0 == v1) <= (10 - v3)) > ((v3 - 84) < (60 != v3)));
+        a1[2][0] = (((v1 - a1[3][7]) >= (v1 && 93)) && ((v3 % 9) % 5));
+        v1 = (((v0 <= 82) / 7) * ((v2 && a1[3][3]) ? (a0[4] || a0[13]) : (43 + 96)));
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v0 = (((v1 % 7) < (a1[1][4] >= 8)) ? ((v0 > v2) >= (67 < 65)) : ((58 > v3) ? (23 + a0[1]) : (a1[3][9] ? v3 : a0[1])));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                v0 = (((a1[1][4] != a0[8]) || (v3 >= i0)) % 1);
+                v0 = (((a1[3][8] + 93) ? (i0 ? v1 : v1) : (v2 < 46)) - ((v3 != a1[2][11]) || (i1 < v2)));
+                a0[2] = (((a1[1][11] != v1) || (v1 >= 60)) > ((28 == v1) / 4));
+                i1 = i1 + 1;
+            }
+        }
+        a0[3] = (((v2 ? v3 : a1[1][12]) + (v2 / 7)) <= ((78 / 8) ? (v2 ? a1[0][5] : v3) : (i0 != v3)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((v0 || 14) > 52) break;
+        a0[5] = (((a1[2][6] ? 63 : 55) < (v3 + a1[2][1])) ? ((v2 == a1[0][11]) + (2 % 2)) : ((3 && a1[0][10]) == (85 ? a0[14] : a1[0][11])));
+        v3 = (((34 <= v3) % 3) != ((4 + a1[3][3]) + (v1 + v0)));
+        {
+            int i3 = 0;
+            do {
+                a1[3][13] = (((6 && v1) * (a1[1][7] ? i3 : 18)) % 7);
+                v2 = (((i3 && a1[1][11]) || (56 <= v1)) != ((i2 + v0) ? (i3 != 96) : (v3 >= i3)));
+                v2 = (((67 ? 26 : a0[8]) * (45 - i3)) + ((i3 < 37) != (v2 ? 84 : 91)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    if ((((26 > a0[11]) >= (v2 <= v2)) >= ((v2 <= v1) + (v0 + v0)))) {
+        v2 = (((99 ? v3 : a1[0][5]) && (a0[2] && v2)) || ((a1[0][3] ? 15 : v0) < (v3 >= v1)));
+        a0[12] = (((36 + v0) * (a0[5] != 82)) * ((53 == v1) + (v2 > v0)));
+        a1[3][2] = (((v3 - v2) - (v3 < a0[11])) % 9);
+    } else {
+        a0[6] = (((v2 > a0[3]) * (a0[5] == 38)) - ((a1[1][7] % 8) && (a0[2] + v0)));
+        v3 = (((67 > v1) ? (v2 / 8) : (a1[2][6] / 6)) >= ((v0 - 84) ? (53 > v3) : (v2 >= a1[2][0])));
+        v3 = (((v3 / 5) || (a1[1][14] || 20)) <= ((v2 - a0[2]) - (v0 * v2)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        a1[0][2] = (((v2 && v0) ? (11 ? a1[1][11] : v0) : (10 != a1[2][12])) ? ((a0[8] <= v3) > (a0[12] % 7)) : ((v3 || i4) >= (a0[1] + v2)));
+        v0 = (((44 / 6) != (a1[1][12] * 0)) > ((83 != a0[2]) != (i4 == a1[3][1])));
+        {
+            int i5 = 0;
+            do {
+                if ((v0 < i4) > 72) break;
+                v0 = (((i5 && a1[2][6]) && (i5 > 98)) <= ((a0[12] % 1) || (v2 > v3)));
+                v1 = (((a0[9] % 7) + (61 / 6)) + ((a0[7] || 61) % 1));
+                a1[1][2] = (((v1 <= v2) || (i5 >= v1)) || ((a1[0][1] >= v2) ? (a1[3][13] - i4) : (i5 / 4)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+    }
+    return (((v0 == 46) ? (v2 + a0[1]) : (v0 >= 38)) || ((v1 / 5) < (75 || 28)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,192 @@
+int f0() {
+    int v0 = 29;
+    int v1 = 40;
+    int v2 = 64;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a1[2][4] = (((i0 - 44) ? (a0[10] % 8) : (v2 ? a0[0] : 24)) ? ((i1 * 44) == (a0[2] + 4)) : ((a1[0][14] == 85) == (a1[3][15] % 4)));
+                    v0 = (((v0 / 2) ? (41 + a0[4]) : (v0 && i0)) >= ((a0[5] ? v0 : i1) + (a0[2] > a0[4])));
+                    v2 = (((13 + v3) || (i0 + a0[9])) / 8);
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a1[1][13] && v0) == (v3 || 63)) / 9);
+            v2 = (((54 - v3) % 6) && ((v3 - 78) < (v0 * v1)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((v1 || a1[0][8]) > 67) break;
+        v2 = (((v1 >= a0[0]) > (v3 && v1)) ? ((a1[2][0] < v0) % 1) : ((v0 / 6) != (a1[3][13] * v1)));
+        v2 = (((v3 + a0[12]) - (56 / 4)) < ((a0[11] >= 68) && (v3 > v3)));
+        {
+            int i3 = 0;
+            do {
+                a1[0][6] = (((a1[1][12] <= 18) + (i3 + a1[2][11])) ? ((i2 || i3) + (a1[3][1] ? a1[0][3] : i3)) : ((90 ? a0[13] : v3) * (i3 != v2)));
+                v2 = (((v3 + 43) && (v0 * a1[0][10])) == ((a0[9] >= v1) != (a1[3][14] >= a0[8])));
+                a1[3][12] = (((i3 <= a0[7]) >= (a1[0][15] ? a0[7] : a0[8])) ? ((v3 == a0[0]) - (i3 <= a0[14])) : ((v0 <= a1[0][8]) + (i3 * v0)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        if ((i4 / 6) > 56) break;
+        a1[3][14] = (((36 && 52) / 3) <= ((a1[0][11] && v0) <= (22 + i4)));
+        {
+            int i5 = 0;
+            do {
+                a1[3][14] = (((v3 / 4) ? (i4 + a1[1][2]) : (60 % 5)) <= ((i4 < v3) - (28 % 9)));
+                v1 = (((i5 && a0[13]) != (v0 ? 8 : a1[1][11])) != ((a0[12] >= v0) - (65 < v2)));
+                v1 = (((i5 + a0[0]) > (v3 ? i4 : 74)) && ((91 || i4) * (68 < v0)));
+                i5 = i5 + 1;
+            } while (i5 < 7);
+        }
+        v0 = (((19 < 2) + (97 >= i4)) <= ((v1 < 83) + (a0[9] / 2)));
+    }
+    v3 = (((v0 - a0[14]) / 3) || ((45 ? 59 : 84) >= (55 >= 93)));
+    for (int i6 = 0; i6 < 4; i6 = i6 + 1) {
+        v3 = (((26 && v2) % 9) || ((v3 <= 79) >= (v1 + v1)));
+        a0[4] = (((a1[1][13] < v0) > (43 % 1)) + ((v1 - 88) != (a1[3][4] - v2)));
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            v2 = (((i6 / 2) + (80 % 1)) + ((a1[3][4] * 16) / 3));
+            v2 = (((27 <= a0[2]) - (v3 < a0[5])) / 6);
+            v0 = (((a1[0][4] > a0[10]) + (v0 / 7)) || ((v2 != 49) ? (81 * a0[15]) : (i7 != 47)));
+        }
+    }
+    return (((a0[10] + v0) <= (18 >= 48)) * ((9 ? 46 : a0[15]) != (a1[3][0] % 9)));
+}
+int f1() {
+    int v0 = 38;
+    int v1 = 28;
+    int v2 = 56;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 == v0) % 4) <= ((v2 >= v2) + (85 ? v3 : v3)));
+    if ((((85 >= v1) * (a1[1][7] / 7)) >= ((8 && v3) > (v3 % 5)))) {
+        a1[1][2] = (((a0[14] ? 38 : v0) / 6) || ((a0[0] - v3) >= (69 * v3)));
+        v3 = (((a0[10] != 21) >= (v2 * 99)) <= ((v1 || a1[2][4]) || (a0[1] && v2)));
+        v0 = (((v1 * a0[11]) || (a1[0][0] < v0)) == ((76 || a1[1][14]) ? (v1 >= 67) : (v1 * 5)));
+    } else {
+        v0 = (((90 > v2) == (v3 + v1)) ? ((18 != 21) < (94 > v0)) : ((a1[0][1] != a0[14]) <= (a1[3][13] + 55)));
+        v1 = (((v3 * v2) && (99 >= v0)) < ((v1 - v3) == (a0[12] >= v2)));
+        a1[0][12] = (((v1 <= v2) != (v3 && v2)) ? ((v0 <= a1[0][12]) != (a1[2][7] > a1[0][5])) : ((v3 || v3) >= (v2 != 60)));
+    }
+    v0 = (((v1 ? 3 : 27) % 6) * ((v0 == v1) - (a0[11] != 23)));
+    {
+        int i0 = 0;
+        do {
+            if ((v1 / 9) > 95) break;
+            v1 = (((v0 == i0) * (v2 - v2)) + ((v1 < a1[3][9]) % 7));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v2 = (((i0 || a1[2][8]) % 7) / 5);
+                v0 = (((i0 <= v1) * (v3 && i0)) ? ((56 ? i0 : 22) > (86 && i0)) : ((a0[0] / 7) * (i1 < 89)));
+                a1[2][3] = (((79 != v0) >= (a0[14] - a1[1][8])) != ((v1 * 62) % 4));
+            }
+            v3 = (((a1[0][0] < 35) || (i0 == v0)) % 3);
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v3 && 12) > 75) break;
+            v2 = (((68 >= v0) < (v1 + 98)) ? ((20 > 99) && (a1[2][11] >= v0)) : ((a0[11] || v3) > (v1 / 4)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((73 == v3) > (78 ? v3 : i2)) % 7);
+                    a1[0][1] = (((a1[3][7] && v0) && (a0[6] != a1[1][10])) ? ((i2 ? a1[2][7] : i2) + (69 / 7)) : ((a1[0][6] % 3) > (i2 ? v0 : a1[2][4])));
+                    v3 = (((51 + v2) - (i2 ? 76 : 44)) - ((83 % 1) - (i3 < i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a0[8] % 4) > (v1 < a1[1][14])) > ((v2 / 2) != (v2 * v3)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((a0[1] >= a0[7]) * (v2 * v3)) - ((a1[3][5] && v0) / 8));
+}
+int f2() {
+    int v0 = 44;
+    int v1 = 76;
+    int v2 = 74;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((v1 * a1[3][15]) > 57) break;
+        {
+            int i1 = 0;
+            do {
+                v3 = (((9 % 7) ? (a0[5] < v1) : (v2 == 49)) == ((89 != 2) * (v0 != i1)));
+                v1 = (((v3 == i0) % 5) + ((i1 != v1) ? (90 || a0[1]) : (a0[7] ? v0 : 61)));
+                v0 = (((v2 && 27) ? (48 * a1[0][2]) : (v0 * a0[9])) ? ((v2 - v2) >= (91 % 6)) : ((v0 * 4) ? (69 == 13) : (1 == i0)));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+        a1[3][8] = (((v0 && v1) * (a0[6] || v3)) <= ((a0[8] <= v2) >= (a0[8] ? a1[0][5] : 30)));
+        v0 = (((v2 && v3) <= (25 ? 91 : v0)) != ((a0[5] % 7) >= (v1 == a1[1][2])));
+    }
+    if ((((a1[0][4] < v3) % 7) > ((a1[2][13] / 8) > (a0[12] >= 30)))) {
+        v3 = (((70 - v0) ? (v3 ? v3 : v1) : (a1[2][4] >= 84)) > ((v1 ? v0 : a1[0][3]) || (v3 <= v0)));
+        v3 = (((a0[7] - a1[1][5]) < (a0[14] != 15)) % 6);
+        v2 = (((v3 && a1[3][6]) % 2) != ((a0[5] ? 99 : a0[12]) / 8));
+    } else {
+        a0[0] = (((62 != v3) || (v1 != a0[4])) == ((v2 % 9) - (v0 == v2)));
+        v3 = (((a0[0] < v1) != (a0[13] >= 26)) < ((v0 % 9) * (a1[2][0] <= v1)));
+        v1 = (((v3 / 9) * (35 ? v0 : v0)) >= ((v2 + a1[2][6]) ? (v2 * v2) : (5 ? 70 : v3)));
+    }
+    if ((((v3 || v2) ? (41 && 40) : (a0[6] <= v2)) && ((a0[5] ? a1[3][5] : v0) * (v0 > v2)))) {
+        v2 = (((v3 >= 33) / 5) != ((v0 < v3) % 5));
+        v0 = (((43 < v3) < (v1 > a1[0][2])) || ((v0 || 78) && (a0[2] % 3)));
+        v0 = (((9 % 2) * (8 < v0)) - ((0 != a0[7]) <= (v0 > v2)));
+    } else {
+        v0 = (((v0 == v0) < (v3 || v3)) <= ((54 * v1) + (22 / 9)));
+        v0 = (((44 % 9) ? (75 ? 97 : v1) : (v1 + 86)) * ((v1 == v0) > (v2 < v0)));
+        v2 = (((a0[11] ? v0 : v3) && (a0[5] == v3)) % 7);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[7] = (((55 ? v0 : a0[15]) < (80 <= 40)) >= ((a0[9] ? 53 : i2) >= (v1 == v1)));
+            a0[7] = (((i2 + v1) > (v2 && a1[0][9])) <= ((97 <= a0[9]) + (85 - 37)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                if ((a0[2] - a0[3]) > 70) break;
+                v0 = (((v0 && i3) == (18 < 77)) / 4);
+                v2 = (((v0 ? v0 : a1[2][2]) / 5) * ((a0[6] * v1) * (v3 + v1)));
+                v0 = (((92 != 57) && (i2 ? 58 : i2)) != ((v0 || a1[2][14]) - (70 / 6)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((26 + v0) > 59) break;
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((v0 - i5) / 7) ? ((54 > v0) / 5) : ((i5 <= v3) ? (v3 + a0[3]) : (a0[11] > v0)));
+                    a1[2][15] = (((v3 ? 38 : v3) < (v3 - i5)) <= ((i4 || 44) > (a1[3][8] / 5)));
+                    v2 = (((v0 + v2) != (v1 ? a0[7] : a0[8])) != ((a0[4] > v1) || (a1[0][11] < 51)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v0 = (((97 == i4) && (i4 <= 76)) - ((v0 / 9) % 6));
+            v2 = (((v3 + v1) > (i4 < v3)) && ((v1 <= a1[2][11]) == (v3 * v0)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v0 != v3) == (25 != 10)) * ((v1 % 9) && (a1[1][14] || v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 12;
+    int v1 = 52;
+    int v2 = 41;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][4] >= a1[3][14]) == (a1[1][13] ? a1[0][2] : a0[5])) ? ((a1[1][5] > v1) > (v0 / 2)) : ((a1[0][7] ? v3 : 7) * (93 < 97)))) {
+        a1[0][1] = (((v2 > 57) != (v1 != 17)) || ((v2 || a1[2][12]) != (53 >= v1)));
+        v2 = (((v1 > v3) != (v3 == a0[14])) ? ((63 < v2) ? (v3 > 24) : (98 == 52)) : ((v0 + a1[2][15]) ? (v3 + 47) : (a1[2][12] == 38)));
+        v2 = (((v3 > 40) <= (a0[6] * a1[1][11])) <= ((a1[1][4] - v2) || (32 ? v0 : 85)));
+    } else {
+        a0[7] = (((v2 < 51) / 7) > ((57 % 3) + (v3 ? a1[1][11] : a0[15])));
+        v1 = (((v0 != 33) && (53 || v3)) * ((a1[3][14] % 7) > (a0[9] ? 60 : v3)));
+        a1[2][11] = (((a0[15] * v3) ? (a1[1][4] > 94) : (14 || a0[14])) && ((47 || v3) ? (v1 * a1[0][3]) : (66 && v0)));
+    }
+    if ((((a0[1] + v3) > (v2 != a0[7])) || ((v2 && v0) / 1))) {
+        v3 = (((a1[1][9] >= 76) ? (84 ? 49 : 58) : (v0 != v2)) ? ((34 + v1) / 8) : ((a1[2][12] <= 24) <= (v1 != v0)));
+        v0 = (((v1 >= v2) > (v2 - a0[1])) == ((44 || a1[3][5]) <= (v3 == v0)));
+        v0 = (((56 >= v1) - (v3 % 8)) - ((v3 != 40) <= (8 > 10)));
+    } else {
+        v1 = (((v2 || v2) || (a0[13] > 63)) < ((v2 < 58) || (v1 == v1)));
+        a0[11] = (((a0[10] / 8) * (v1 / 9)) == ((v1 % 1) || (v2 + 69)));
+        v3 = (((a0[13] || v1) % 6) || ((a1[0][2] > v1) % 6));
+    }
+    if ((((2 / 5) / 2) && ((a0[13] % 3) - (v2 + a0[1])))) {
+        v3 = (((v0 > v1) != (v3 ? a1[2][10] : v2)) % 1);
+        a1[0][0] = (((71 && v2) != (a0[12] > v0)) >= ((52 < a0[15]) && (a0[3] < v3)));
+        a0[2] = (((a1[0][2] <= 65) < (v2 < v1)) * ((v1 <= v2) && (a1[2][0] + a1[2][6])));
+    } else {
+        v0 = (((v3 && v0) == (29 - v2)) || ((a1[3][12] ? 76 : v0) ? (35 % 2) : (a1[2][15] > 57)));
+        a1[0][14] = (((a0[5] && a0[5]) % 8) != ((v3 * v0) > (v2 * a1[3][6])));
+        v2 = (((v2 ? 26 : a1[3][1]) + (v1 != v1)) != ((v0 == v1) && (v0 ? 7 : v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v0 > 55) > 99) break;
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a0[14] % 3) <= (v3 + 77)) != ((22 + 82) != (24 >= v2)));
+                    v2 = (((v0 >= 94) || (i0 == a1[3][3])) > ((v2 - 21) || (i0 / 2)));
+                    v2 = (((v2 ? v2 : i1) ? (i0 == i0) : (i1 >= a1[1][1])) + ((v3 % 7) / 5));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v0 = (((a1[3][10] && a1[1][2]) <= (a0[9] || 8)) != ((i0 / 8) ? (62 <= 56) : (v0 == 18)));
+            v0 = (((v1 ? a0[3] : 40) % 7) * ((49 - v0) ? (a0[14] || a1[1][3]) : (v1 || i0)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a0[10] = (((v1 <= a0[10]) && (37 ? i2 : 18)) > ((69 <= a1[2][3]) >= (53 == v3)));
+        v2 = (((v2 <= v0) || (v0 == 56)) < ((i2 * v0) * (1 ? 69 : v1)));
+        {
+            int i3 = 0;
+            do {
+                a0[6] = (((a0[5] && v0) || (47 && i2)) % 4);
+                a1[3][10] = (((v3 - a1[0][10]) < (35 || 3)) < ((v3 || i2) < (41 % 6)));
+                v2 = (((98 || v1) > (a1[3][2] >= a0[8])) - ((a0[7] < 55) ? (v2 <= a0[12]) : (i2 ? a0[6] : a0[12])));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    return (((v3 % 9) < (a1[3][9] && v3)) || ((81 * 98) * (v2 >= a0[1])));
+}
+int main() {
+    return 0;
+}
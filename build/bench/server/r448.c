@@ -0,0 +1,139 @@
+int f0() {
+    int v0 = 7;
+    int v1 = 92;
+    int v2 = 17;
+    int v3 = 98;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v3 = (((v1 - v1) <= (a1[0][9] % 8)) && ((a0[14] <= a0[14]) + (a1[1][6] < a0[5])));
+            v1 = (((a1[2][12] >= 55) - (84 == 22)) ? ((32 <= v3) != (v2 ? 5 : v2)) : ((a1[3][4] && 75) % 6));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((i1 + v3) || (93 < i1)) ? ((i1 <= v1) / 6) : ((64 >= 61) || (16 / 9)));
+                    a0[1] = (((a1[0][10] >= a1[2][13]) == (i0 ? 38 : 91)) >= ((i1 * i1) > (99 / 3)));
+                    a1[1][3] = (((i1 <= v3) > (a1[2][4] && a0[15])) * ((a0[4] <= 57) <= (v0 - a0[3])));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v0 = (((92 - a1[3][13]) < (v1 > 66)) % 8);
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a0[7] = (((v1 <= a0[0]) || (71 ? v0 : i3)) ? ((v2 != 85) != (a1[3][12] + a1[2][10])) : ((i2 % 3) >= (63 == v3)));
+                v2 = (((v0 > i3) >= (7 <= v2)) ? ((i2 * a0[0]) != (i3 != v3)) : ((v1 - 4) != (27 - i2)));
+                a1[2][14] = (((i3 >= v0) && (a0[11] == 93)) != ((v2 != i3) - (49 * a1[1][6])));
+            }
+            v2 = (((i2 != v2) == (a0[8] && a0[0])) || ((v1 <= 66) != (i2 > 87)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            a0[1] = (((v2 - v3) < (v3 && v0)) * ((v0 > v3) ? (a0[5] < 38) : (a0[6] / 9)));
+            {
+                int i5 = 0;
+                do {
+                    a0[9] = (((i4 ? 94 : v2) <= (55 ? a1[2][3] : 35)) ? ((v3 <= 90) * (i5 || v0)) : ((v3 ? a1[1][0] : a0[15]) % 6));
+                    v1 = (((a1[2][8] ? 63 : 96) - (84 && v0)) ? ((a1[2][2] >= a0[0]) || (v2 - a0[14])) : ((v2 ? v2 : v3) ? (35 > v0) : (i4 || v3)));
+                    v2 = (((a1[1][0] || v3) >= (v1 != v3)) - ((88 || v0) <= (v1 || a1[1][1])));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            a1[0][9] = (((v0 < 42) != (i4 == a0[8])) ? ((a0[3] % 8) + (v2 != a1[0][14])) : ((48 ? v0 : v3) >= (a0[7] - v2)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 > 66) < (67 ? v2 : a1[2][0])) * ((v3 <= v1) <= (v1 == v1)))) {
+        v2 = (((v2 - v1) - (3 && v3)) - ((v1 || a0[0]) % 7));
+        v1 = (((a0[0] * v2) || (a1[3][0] && 9)) < ((a1[1][3] + v2) % 5));
+        v1 = (((12 && 9) - (a1[2][4] - v0)) % 5);
+    } else {
+        a1[2][8] = (((26 >= v1) >= (60 == 9)) <= ((v2 || 33) / 4));
+        a0[11] = (((v1 ? a0[12] : v1) || (v0 == v0)) || ((v3 ? v2 : v2) % 5));
+        v2 = (((v3 > v1) + (v0 >= v0)) && ((v3 >= v0) != (v0 % 2)));
+    }
+    if ((((v1 < 68) < (a1[2][3] <= v1)) / 6)) {
+        v0 = (((a0[12] - a0[4]) != (92 <= v2)) * ((v3 ? 9 : a1[2][3]) / 6));
+        v0 = (((a0[5] ? 46 : v2) % 5) % 5);
+        v2 = (((66 * v1) ? (v3 ? a0[4] : v0) : (v0 || 36)) - ((v1 * a0[0]) ? (78 >= 26) : (a0[11] ? a1[3][8] : 74)));
+    } else {
+        v3 = (((v0 + v1) % 6) && ((v0 - 40) ? (a1[3][14] % 3) : (v3 + v1)));
+        v1 = (((v1 != 91) - (v1 > a1[0][8])) >= ((v1 || v2) <= (v1 % 1)));
+        v0 = (((15 - v0) * (v0 < v1)) >= ((31 - 39) || (v1 * 59)));
+    }
+    return (((v0 && v2) && (v0 % 4)) == ((v0 % 6) ? (v1 <= a0[5]) : (v1 + v3)));
+}
+int f1() {
+    int v0 = 73;
+    int v1 = 83;
+    int v2 = 82;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((84 * a1[1][2]) <= (v0 == a1[3][10])) != ((v2 - v2) || (90 || v3)));
+    if ((((v1 - 29) >= (47 <= v2)) ? ((a0[2] == 88) || (v2 % 4)) : ((91 % 5) && (v3 || a1[2][9])))) {
+        v3 = (((a1[0][3] ? 37 : 8) ? (a1[3][14] == a1[0][0]) : (54 < v3)) <= ((a0[9] / 8) < (v3 != v3)));
+        a1[0][3] = (((79 / 7) * (35 - v3)) != ((a0[0] || v0) / 3));
+        v2 = (((v1 == 90) < (80 >= v1)) + ((a0[13] ? v2 : v0) >= (v2 > v1)));
+    } else {
+        a0[5] = (((a0[13] ? a1[3][4] : v0) + (a0[3] >= v3)) > ((v3 > 67) / 2));
+        v1 = (((v1 || 82) ? (v1 < 85) : (v1 - 47)) <= ((v1 || a1[2][1]) > (v1 ? a1[3][7] : 88)));
+        v0 = (((a1[0][5] != a0[6]) == (v3 || v2)) + ((v1 <= a1[1][6]) == (a1[3][5] > v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[3][1] = (((48 || 93) < (a0[11] > v3)) ? ((45 ? v0 : 75) / 5) : ((1 > a1[1][12]) + (v2 - 57)));
+            {
+                int i1 = 0;
+                do {
+                    a1[1][1] = (((v0 / 6) % 1) < ((a0[15] * i1) ? (v3 * v0) : (v0 > i0)));
+                    v2 = (((a1[3][14] * 80) > (37 - v1)) ? ((v2 * v1) < (v3 > a1[1][13])) : ((i1 - v3) == (91 || v0)));
+                    v2 = (((3 + a1[0][10]) != (a1[2][12] ? 58 : 81)) > ((a0[5] - 47) * (v3 ? 93 : v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v3 = (((v2 && 51) || (v2 - v0)) * ((v0 ? a0[9] : v2) % 8));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[1] + 77) >= (16 == a1[1][12])) <= ((18 == v0) && (a1[2][2] % 2)))) {
+        v0 = (((v1 && 38) + (a1[2][13] / 6)) > ((v1 != v1) || (a1[1][9] && v2)));
+        a1[1][9] = (((v3 == a0[7]) ? (a1[0][5] * a0[9]) : (40 && 43)) + ((v1 < v0) != (a0[1] != 21)));
+        v0 = (((v0 + v3) == (v0 <= a0[1])) && ((v3 <= v1) / 1));
+    } else {
+        v2 = (((v0 > v2) + (a0[13] > a0[13])) <= ((40 - a0[13]) / 7));
+        v3 = (((v2 < a1[0][15]) >= (v0 == v0)) - ((v0 * v1) ? (v2 * 37) : (66 <= v1)));
+        v0 = (((v3 && v3) <= (v0 && v0)) < ((v1 <= 18) >= (v3 != v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v2 = (((a1[2][7] - 67) < (v3 >= v2)) > ((v1 ? v2 : v1) ? (9 == a0[14]) : (0 >= a1[0][3])));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    v1 = (((i2 == a0[12]) % 2) * ((a1[3][11] != i3) && (v1 || v0)));
+                    a0[1] = (((i2 ? v0 : v3) + (v2 > 74)) + ((a0[10] >= v2) >= (v1 <= 92)));
+                    v0 = (((i3 || a0[12]) % 4) <= ((v2 != a0[15]) < (v1 >= i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[3] = (((32 > v1) + (a1[2][10] != v2)) >= ((a1[2][14] > a0[8]) <= (v3 % 6)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v1 - 54) >= (v1 + v0)) - ((a0[4] ? a1[1][7] : a1[0][2]) / 7));
+}
+int main() {
+    return 0;
+}
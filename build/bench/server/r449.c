@@ -0,0 +1,202 @@
+int f0() {
+    int v0 = 95;
+    int v1 = 97;
+    int v2 = 10;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 / 7) > (v3 || v3)) % 5)) {
+        v1 = (((v3 / 3) ? (a0[3] ? v0 : v2) : (v1 || a0[2])) == ((v0 - v3) < (a0[14] - 18)));
+        a0[2] = (((23 || 58) % 5) % 6);
+        a1[2][4] = (((70 * a1[1][7]) && (a0[6] ? 38 : a1[0][2])) < ((v2 || 71) && (a0[1] || v2)));
+    } else {
+        v2 = (((a1[1][15] > 19) >= (v3 / 8)) % 8);
+        v1 = (((v2 - 26) != (v2 ? 72 : 51)) > ((a0[13] / 9) >= (v2 * 60)));
+        v0 = (((v3 != 52) > (96 * 72)) - ((7 ? v0 : 53) + (90 - v3)));
+    }
+    if ((((a0[1] < 55) != (a1[2][4] || 80)) > ((84 || v0) <= (62 < v3)))) {
+        v2 = (((v2 != 57) < (a0[5] != v1)) || ((v0 / 5) ? (a1[2][7] ? v2 : v2) : (v2 >= a1[3][2])));
+        v3 = (((19 - v3) == (21 < a0[3])) == ((30 != a0[0]) > (v0 * a0[12])));
+        v3 = (((v2 <= 27) != (a1[0][5] - 22)) - ((89 && 70) - (78 != a1[1][8])));
+    } else {
+        v0 = (((v1 <= v3) && (v0 % 1)) * ((a1[0][5] / 1) && (a0[4] + a0[0])));
+        v1 = (((v1 != 97) * (a1[2][4] >= v3)) - ((v1 ? 9 : v3) * (63 != 44)));
+        a1[1][11] = (((v1 != v0) ? (v0 % 4) : (v3 != v3)) - ((v3 > a0[0]) != (v0 ? v2 : v0)));
+    }
+    v3 = (((60 >= 58) / 3) - ((v0 || 20) + (v1 < 20)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((8 > v1) > 61) break;
+        v2 = (((i0 <= i0) % 7) < ((v2 / 8) <= (v3 < i0)));
+        a1[1][14] = (((v3 != v2) >= (a0[8] || v1)) ? ((v0 || 39) == (v0 - 85)) : ((25 <= a0[14]) && (v0 * v3)));
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            a0[10] = (((79 + a1[3][1]) != (18 >= a0[11])) ? ((74 != i0) * (v3 % 7)) : ((a1[0][10] > v1) == (v3 + 21)));
+            v1 = (((a1[1][1] != 64) > (i0 / 5)) < ((16 != v1) == (a0[2] - i0)));
+            a1[1][12] = (((29 + v2) <= (v1 - a0[9])) > ((i0 % 9) - (90 % 5)));
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((i3 * v2) && (82 && v1)) % 8);
+                v1 = (((i2 * i2) != (v2 + v2)) - ((v1 ? v3 : a0[6]) || (60 ? a0[1] : 23)));
+                v0 = (((v0 + v2) / 5) && ((v0 - a0[1]) % 6));
+            }
+            v3 = (((v3 + i2) && (75 - v0)) ? ((v0 * i2) % 8) : ((v3 - a0[10]) / 9));
+            v2 = (((a0[3] && v0) % 6) == ((78 ? 87 : 50) * (1 / 5)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((60 || a0[3]) ? (v2 <= v2) : (a1[1][10] || v3)) < ((v3 > v2) || (31 * a0[8])));
+}
+int f1() {
+    int v0 = 91;
+    int v1 = 33;
+    int v2 = 54;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v1 = (((a1[2][14] == v2) - (v3 - i0)) < ((v3 ? v1 : a0[12]) - (v0 > a0[0])));
+            a0[13] = (((a0[8] * v2) != (49 && 21)) % 7);
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a1[3][8] <= a0[11]) + (79 * 46)) && ((59 >= i0) < (17 < v3)));
+                    v3 = (((i0 || a0[5]) / 6) && ((v3 ? i0 : 70) ? (61 / 2) : (a1[2][12] % 6)));
+                    v2 = (((52 ? 14 : 65) != (i0 + 11)) % 7);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a1[1][2] <= 36) + (v3 <= 34)) / 5);
+            v2 = (((v1 >= v1) >= (29 ? i2 : a0[11])) / 4);
+            {
+                int i3 = 0;
+                do {
+                    a0[3] = (((v0 ? a1[1][13] : i2) * (i3 != i2)) ? ((a0[4] <= 71) % 9) : ((a1[0][7] % 5) / 3));
+                    a0[6] = (((a0[1] < i3) + (v0 && i3)) - ((a0[1] && a1[2][3]) <= (15 <= a1[1][6])));
+                    a1[3][12] = (((i3 - 47) % 2) ? ((i2 == 71) && (v2 <= a1[1][6])) : ((i2 + v0) + (a0[9] / 2)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v1 = (((32 > 23) ? (a1[0][11] >= 19) : (60 - a1[2][7])) + ((31 < v1) <= (v2 || v2)));
+            v2 = (((29 ? a0[5] : a0[12]) - (a0[14] && 7)) + ((a0[13] * i4) != (v0 - a1[1][15])));
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    a0[0] = (((i4 ? v1 : 85) || (42 - i5)) - ((i4 % 6) < (15 ? v0 : 45)));
+                    v3 = (((79 || v1) && (v2 >= a1[2][2])) / 4);
+                    v3 = (((12 || a1[2][11]) && (6 > 21)) + ((i5 - 29) >= (v1 >= i4)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((75 + 71) + (43 * a1[1][14])) ? ((59 <= v0) * (v2 == v1)) : ((v0 ? a0[6] : v0) != (56 >= a0[14])))) {
+        v3 = (((v2 < v2) ? (v3 - 97) : (68 + a0[11])) > ((13 * v0) % 5));
+        v2 = (((a1[2][3] ? v1 : a0[4]) || (a0[12] == 28)) ? ((a0[7] == v1) * (20 <= v0)) : ((v0 <= a0[5]) <= (v0 < 17)));
+        v3 = (((a1[3][0] >= v3) != (v0 != v3)) >= ((a0[9] <= v1) - (32 >= 38)));
+    } else {
+        v1 = (((92 ? 2 : v3) % 5) < ((a1[3][9] ? v2 : v0) <= (a1[2][6] && v3)));
+        a1[0][2] = (((v1 ? v0 : 64) <= (v0 < 53)) != ((a0[1] % 3) * (v1 > v2)));
+        v2 = (((a1[0][1] && v3) % 8) && ((a0[7] ? a1[0][3] : 62) >= (v1 >= v1)));
+    }
+    if ((((95 * 63) && (v2 + v2)) >= ((v2 % 7) <= (v0 > 1)))) {
+        v0 = (((v1 == v2) ? (a0[5] || 0) : (a1[3][12] != v1)) && ((v2 || v3) - (a1[1][9] < a0[5])));
+        v2 = (((v3 != 36) ? (v2 != v1) : (v1 / 7)) + ((a1[1][10] + 64) - (18 >= 19)));
+        a0[13] = (((v2 <= a0[2]) ? (v2 % 8) : (v0 > a0[7])) % 1);
+    } else {
+        v2 = (((38 == v2) % 5) % 4);
+        a1[2][2] = (((76 || v2) >= (85 && 12)) + ((a0[15] % 4) ? (a1[2][11] == v2) : (17 < 62)));
+        a1[1][10] = (((68 >= v0) > (v1 == 64)) % 8);
+    }
+    return (((v2 >= 78) == (v3 * v0)) == ((a0[4] < v1) + (98 > v3)));
+}
+int f2() {
+    int v0 = 55;
+    int v1 = 23;
+    int v2 = 24;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][9] != a0[7]) - (v3 / 8)) && ((v0 && 17) > (v0 == v1)))) {
+        v3 = (((v0 < v2) > (a0[9] - 13)) < ((v2 % 7) && (a1[3][11] == 71)));
+        a0[0] = (((v3 < v2) / 2) <= ((v1 % 5) + (v3 - v1)));
+        a1[0][9] = (((v1 - v2) - (31 / 1)) < ((0 ? a1[0][2] : v2) - (v0 <= v1)));
+    } else {
+        v0 = (((20 * 33) && (a0[0] % 1)) != ((a0[7] == v1) || (a0[12] + a1[2][15])));
+        a0[7] = (((v0 > 65) * (v0 / 4)) >= ((v1 * v3) % 9));
+        v2 = (((v3 || a1[0][6]) >= (48 % 9)) >= ((a1[0][12] > v2) / 9));
+    }
+    if ((((v3 == v3) || (v2 <= a0[6])) > ((v0 >= v1) > (v1 % 4)))) {
+        a1[1][12] = (((v2 / 2) == (v2 ? v2 : 61)) < ((v1 / 3) - (v3 ? v0 : v2)));
+        v1 = (((v2 / 1) <= (v2 < a1[3][7])) % 7);
+        v0 = (((v1 || v2) < (v3 % 1)) ? ((v0 >= 44) || (38 <= v0)) : ((a1[0][13] >= a1[1][11]) <= (67 >= v2)));
+    } else {
+        a0[12] = (((v3 > v2) / 2) > ((v1 + a1[3][2]) >= (a0[3] / 9)));
+        v0 = (((61 != v3) + (a0[2] ? a0[10] : v0)) || ((v1 + v2) != (v1 < a0[13])));
+        a0[9] = (((v3 * 90) + (76 <= v2)) < ((13 ? v0 : a0[5]) - (v0 * v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v3 = (((v3 < i0) < (v0 % 1)) == ((v2 < 94) ? (a1[1][8] * i0) : (a1[2][13] - i0)));
+            a0[15] = (((v2 - 65) ? (45 * v0) : (a0[1] * a0[12])) * ((v1 % 3) != (v0 - v3)));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((i0 != v3) != (a0[4] && v0)) && ((a1[0][3] / 4) && (v0 * v3)));
+                    a1[3][12] = (((i0 - i1) / 5) * ((a1[3][14] ? 43 : 31) == (a1[2][5] % 3)));
+                    v1 = (((v3 - a1[2][6]) != (a1[0][15] != a0[0])) == ((i1 ? i0 : i1) || (a1[1][15] || v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[1][11] == v2) ? (v1 > v2) : (v2 >= v1)) != ((v1 - 84) ? (a1[2][15] > v0) : (75 + v3)))) {
+        v1 = (((96 - a0[4]) - (61 % 9)) / 9);
+        v3 = (((12 + v3) || (a1[1][0] - 19)) - ((44 <= 28) % 9));
+        v0 = (((28 >= 93) > (a1[3][14] < v1)) % 1);
+    } else {
+        v3 = (((v3 - v1) * (v3 - v2)) % 9);
+        a0[14] = (((a1[3][1] - 68) != (v2 ? a0[8] : a0[12])) % 1);
+        v0 = (((a1[1][0] < v3) + (v3 <= a0[14])) != ((v1 - v3) < (v3 % 1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[14] = (((a1[1][14] == v1) + (v1 + a0[7])) <= ((v2 * v0) / 2));
+            v2 = (((v2 != i2) || (19 < v1)) - ((88 || 9) / 7));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v3 = (((a1[2][9] / 6) == (70 >= v0)) && ((a0[12] && 49) && (65 * i2)));
+                    a0[5] = (((83 || 45) ? (84 != a1[3][5]) : (99 / 9)) > ((a1[1][1] == v3) + (v0 > v0)));
+                    v0 = (((i3 / 6) || (v3 <= i3)) >= ((i2 / 2) >= (i3 > v2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((a0[0] || 98) >= (v3 != 14)) - ((a1[1][3] - 92) == (v3 - 76)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,55 @@
+int f0() {
+    int v0 = 33;
+    int v1 = 61;
+    int v2 = 92;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[11] - v2) + (v3 ? v2 : v3)) != ((v2 && 28) || (70 || v0)))) {
+        v0 = (((a1[0][14] > v2) % 5) ? ((v0 <= 18) != (v1 > v3)) : ((1 - 0) + (a1[0][13] + a0[0])));
+        v3 = (((a1[2][3] != v2) >= (78 || a0[5])) < ((v2 - v3) - (54 + v3)));
+        v1 = (((a1[3][9] || v3) <= (a1[1][13] && v0)) + ((13 >= a0[7]) + (v0 != v3)));
+    } else {
+        v2 = (((v2 == v1) != (v3 && a1[1][3])) != ((v0 == 37) <= (a0[0] != v2)));
+        a0[13] = (((v1 - v3) <= (v3 != a1[3][8])) ? ((a1[1][2] / 4) < (a0[12] <= v1)) : ((53 == 73) % 8));
+        a1[0][13] = (((v0 <= v1) * (a0[14] % 8)) / 2);
+    }
+    v0 = (((a0[0] + a0[13]) ? (v3 <= v0) : (a0[15] % 4)) >= ((57 && v2) != (v3 || v1)));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v3 = (((i0 < v3) && (a0[6] * a1[1][15])) && ((i0 ? a0[13] : 16) == (v1 % 1)));
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            a0[2] = (((v3 == 80) ? (v1 >= v0) : (50 && v3)) && ((a0[5] / 3) * (47 <= i1)));
+            a0[13] = (((v0 <= 8) % 2) != ((v2 % 5) * (i0 >= v3)));
+            v2 = (((31 * 0) - (i0 ? i1 : v0)) == ((v0 * v3) || (i1 && 55)));
+        }
+        v0 = (((i0 && v1) ? (99 || a0[2]) : (a1[2][13] % 1)) && ((i0 == i0) ? (99 ? 54 : v2) : (96 ? a0[1] : 7)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v2 = (((v0 - a1[0][5]) % 8) * ((a1[1][6] <= 89) == (v2 <= a0[6])));
+        {
+            int i3 = 0;
+            do {
+                v1 = (((a0[1] == i3) / 7) % 5);
+                v2 = (((79 > v1) + (10 ? a1[2][11] : v1)) > ((7 ? v3 : v0) + (78 * v0)));
+                v1 = (((i3 == a1[1][15]) ? (v2 || 43) : (a0[2] % 8)) * ((i2 * 82) < (i2 + 26)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v1 = (((i2 < v0) * (37 > v2)) || ((51 >= a0[7]) != (v2 % 4)));
+    }
+    if ((((a0[4] - 78) - (34 * v1)) > ((a1[3][4] * 3) || (v3 + a0[1])))) {
+        v0 = (((93 <= a1[2][7]) < (18 % 2)) % 1);
+        v3 = (((a0[4] % 6) * (v3 / 8)) <= ((v0 == a0[4]) + (a0[9] || v0)));
+        a0[14] = (((v3 <= 72) - (v0 ? a0[2] : v0)) > ((22 <= v1) / 7));
+    } else {
+        v2 = (((93 != v3) != (v3 * v1)) * ((v2 + v2) == (0 && a0[15])));
+        v0 = (((v3 <= a1[3][7]) < (8 < a0[7])) <= ((v1 % 4) == (v2 - a1[1][9])));
+        a1[1][13] = (((v2 + a1[0][4]) && (a0[7] * v2)) % 1);
+    }
+    return (((a1[3][0] == 13) && (v3 * v1)) >= ((88 && 89) != (v2 % 9)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
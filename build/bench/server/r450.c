@@ -0,0 +1,62 @@
+int f0() {
+    int v0 = 95;
+    int v1 = 65;
+    int v2 = 6;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((v0 / 9) > 75) break;
+                    v0 = (((v2 <= a0[9]) % 7) == ((a0[15] - v3) > (51 / 5)));
+                    v1 = (((3 < i0) ? (v1 - v0) : (v3 + i0)) || ((v1 * v0) - (1 + v3)));
+                    v1 = (((v1 % 8) == (10 + 84)) || ((v1 + a1[2][9]) < (v3 < v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((53 == 75) % 9) % 7);
+            v1 = (((v2 <= 22) + (a1[3][1] > v0)) > ((i0 - 13) == (64 != 70)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                a0[2] = (((a1[3][5] < 48) > (i3 != v3)) || ((78 * 79) && (a1[1][11] - 61)));
+                v3 = (((i2 < a1[0][15]) > (3 % 8)) * ((v1 && 37) && (a0[4] + 0)));
+                v1 = (((a1[1][15] ? v2 : a0[6]) * (78 / 1)) ? ((i2 != v2) ? (v0 / 6) : (a1[3][4] < v3)) : ((v0 - 91) < (46 * i2)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[7] = (((a0[7] % 3) + (v2 || v2)) || ((a1[3][5] <= 74) / 9));
+        v0 = (((v2 > v3) ? (78 > i2) : (v1 >= 86)) && ((v0 && 18) >= (86 > v1)));
+    }
+    if ((((v2 < v3) || (33 % 3)) >= ((v3 * v0) && (29 ? v2 : 45)))) {
+        v0 = (((v2 > 42) != (a1[2][12] > v3)) ? ((52 <= 14) % 2) : ((v2 == v3) % 7));
+        a0[14] = (((88 == a1[2][0]) == (v0 && a0[11])) / 7);
+        v1 = (((v1 < 68) / 7) ? ((a1[3][3] <= a0[2]) - (v0 * v0)) : ((a0[9] - v1) >= (v1 / 2)));
+    } else {
+        a1[3][11] = (((86 == v1) / 2) ? ((v0 ? 51 : v0) >= (74 != v0)) : ((36 <= v0) && (a0[14] >= a1[1][14])));
+        a1[1][7] = (((v1 <= 37) == (v0 < 46)) % 2);
+        v0 = (((a1[1][4] % 6) >= (v3 >= 79)) && ((a1[0][5] ? a1[0][11] : a0[6]) * (v2 <= v1)));
+    }
+    a1[1][15] = (((v1 == 81) - (81 >= v0)) > ((a0[12] % 7) || (a1[3][3] == a1[1][0])));
+    if ((((v3 <= v2) ? (94 == a0[6]) : (a1[1][14] * v3)) >= ((v2 || 96) % 3))) {
+        v2 = (((v1 <= v3) != (v2 > a0[7])) == ((v3 && 84) ? (a0[9] % 2) : (v3 * a0[11])));
+        a1[2][10] = (((v1 == v2) != (v0 - a1[0][8])) - ((a1[1][5] / 9) / 3));
+        v0 = (((v2 + a0[4]) + (v0 + v2)) || ((37 < 81) ? (v2 || v2) : (a1[2][4] && 54)));
+    } else {
+        v0 = (((66 || a1[0][0]) <= (v2 < a0[9])) <= ((a0[12] ? 76 : a1[0][3]) > (a0[3] + v2)));
+        v2 = (((69 && a1[3][6]) <= (v1 < v2)) > ((v1 >= v3) != (v1 ? 9 : 67)));
+        a1[2][1] = (((v3 ? 16 : a0[13]) > (52 + a0[14])) || ((v2 && a0[4]) != (v3 != a0[1])));
+    }
+    return (((19 != v2) / 2) / 6);
+}
+int main() {
+    return 0;
+}
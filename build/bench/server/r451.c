@@ -0,0 +1,132 @@
+int f0() {
+    int v0 = 18;
+    int v1 = 20;
+    int v2 = 11;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((41 + 62) >= (a0[14] <= 31)) ? ((a0[10] != v1) || (90 || v0)) : ((92 < a0[2]) ? (v0 ? 55 : 33) : (70 < v3)));
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((91 == 52) > 59) break;
+        v0 = (((72 ? a1[3][12] : v3) <= (48 * a0[0])) / 4);
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            if ((a1[3][11] && a1[3][10]) > 74) break;
+            a0[13] = (((56 - a1[3][4]) < (a0[4] < v3)) + ((v2 >= v1) >= (a1[1][8] == a0[15])));
+            a0[15] = (((v1 > i0) <= (v3 - a1[2][4])) > ((v1 ? i1 : i1) < (a1[0][6] % 7)));
+            a0[1] = (((a0[7] ? 76 : a1[2][11]) ? (a0[10] / 3) : (v2 % 8)) <= ((v0 || v2) / 7));
+        }
+        a1[1][1] = (((a1[0][4] + v0) || (90 && 15)) < ((v3 && v2) + (a1[1][13] / 2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            a1[3][8] = (((a0[1] != i2) ? (a0[1] == a1[2][0]) : (v0 || a0[13])) <= ((v0 ? 1 : v1) && (v0 > 79)));
+            a1[2][9] = (((a1[3][5] % 3) / 3) > ((78 || a1[1][10]) > (a0[7] <= a0[13])));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    a0[14] = (((a0[13] > v0) && (v0 != 26)) != ((a1[1][0] ? v3 : i2) > (a0[14] % 4)));
+                    a0[3] = (((37 != i3) > (i3 < v1)) + ((i2 != 86) % 9));
+                    v0 = (((55 && v2) + (5 == v1)) + ((v2 >= a1[2][8]) || (a1[2][0] >= i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((v0 / 3) > 55) break;
+        {
+            int i5 = 0;
+            do {
+                a1[0][5] = (((30 - i4) % 7) || ((a1[1][7] % 6) * (v3 < i5)));
+                v1 = (((26 == 83) / 5) && ((44 <= a1[2][0]) > (v2 <= 5)));
+                v3 = (((v0 ? v2 : 47) && (87 - v2)) - ((86 % 4) <= (v1 == i5)));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+        v3 = (((i4 * a0[4]) == (a0[4] - i4)) / 7);
+        v0 = (((a1[3][1] * v1) == (v2 >= i4)) ? ((a0[14] - i4) < (41 * 17)) : ((v3 ? 42 : v1) <= (v0 > 19)));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 6) {
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    a1[1][5] = (((v1 >= 48) && (v2 ? 41 : v3)) != ((i6 <= i6) * (v1 != a1[1][10])));
+                    a1[3][15] = (((62 - 64) && (i7 == 23)) == ((64 || v3) != (i7 - v0)));
+                    a1[2][11] = (((15 == 88) != (v1 && v2)) != ((v1 + v0) * (v0 - 64)));
+                    i7 = i7 + 1;
+                }
+            }
+            a0[10] = (((i6 + 57) + (v0 <= v1)) <= ((a1[0][4] % 1) > (v0 <= v1)));
+            v0 = (((v0 <= v2) + (i6 % 3)) < ((i6 * 47) && (v3 ? a0[14] : a1[0][6])));
+            i6 = i6 + 1;
+        }
+    }
+    return (((a1[1][3] % 4) <= (v3 || v1)) * ((a1[1][8] < v3) && (a0[12] ? a0[12] : a1[3][13])));
+}
+int f1() {
+    int v0 = 71;
+    int v1 = 92;
+    int v2 = 1;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v1 = (((v2 % 9) != (46 / 4)) / 7);
+            v0 = (((v2 ? 39 : a1[0][7]) && (a1[3][9] * i0)) / 3);
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((a0[15] ? a1[0][14] : v1) > 79) break;
+                v3 = (((a0[9] ? 45 : v2) && (1 != v1)) == ((a1[1][15] || v0) < (v1 < a1[1][12])));
+                v1 = (((v2 ? a0[6] : i1) >= (v3 || 93)) >= ((91 >= a1[1][14]) / 1));
+                v1 = (((v1 || 39) ? (v0 ? a1[1][7] : a0[14]) : (40 / 7)) + ((v0 > a0[0]) % 2));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                if ((v0 - i3) > 60) break;
+                v0 = (((40 == v3) != (80 ? i3 : v1)) % 5);
+                v2 = (((v2 != a0[1]) * (i3 <= a1[3][9])) * ((i3 / 6) <= (v3 < 76)));
+                a1[0][0] = (((i3 * v3) != (i3 || 62)) % 4);
+                i3 = i3 + 1;
+            }
+        }
+        v0 = (((a1[2][6] >= i2) == (a1[2][12] + a0[4])) < ((a0[0] != v3) || (v2 ? a1[2][15] : 80)));
+        v3 = (((61 > v2) % 8) * ((24 + a0[15]) * (i2 / 9)));
+    }
+    if ((((v3 * v1) || (v3 != v1)) <= ((v1 / 9) + (v3 > v2)))) {
+        v1 = (((v1 ? a0[7] : a0[4]) / 8) * ((v1 * a0[12]) ? (49 != v2) : (24 < a1[1][7])));
+        v0 = (((10 >= a0[13]) > (v3 - v3)) + ((a0[15] > 74) < (v1 ? 96 : 39)));
+        a1[2][14] = (((56 > a1[0][12]) < (46 % 2)) > ((60 != v1) * (v2 ? 20 : a0[0])));
+    } else {
+        v0 = (((v3 % 9) >= (85 != v0)) || ((13 ? v2 : v0) <= (v3 ? v0 : v3)));
+        v3 = (((v2 % 6) + (v3 >= v0)) % 1);
+        v3 = (((v3 != v2) - (a0[1] ? v0 : v0)) > ((v1 == v3) && (v3 + 98)));
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v0 = (((v1 - v2) % 1) * ((a1[0][12] + a0[11]) > (i4 || 73)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v1 = (((v3 && i4) * (i5 > i5)) / 3);
+                v1 = (((67 < v2) >= (v0 - a0[7])) && ((v0 ? a1[1][4] : v3) ? (v0 + i5) : (23 <= 5)));
+                v0 = (((a1[1][3] == a1[0][5]) || (v1 != v3)) % 9);
+                i5 = i5 + 1;
+            }
+        }
+        a1[1][8] = (((a0[6] * 33) <= (v3 || a1[2][11])) / 3);
+    }
+    v0 = (((v2 == a1[1][7]) < (v3 + v1)) % 5);
+    return (((v0 < v1) || (56 - v3)) <= ((a1[2][10] || a0[12]) ? (47 * 7) : (21 * v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,160 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 54;
+    int v2 = 92;
+    int v3 = 56;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[6] = (((18 - 98) < (v2 % 1)) == ((33 % 8) ? (v1 == v3) : (v3 == v0)));
+            a0[11] = (((v1 && v2) * (24 + i0)) >= ((i0 < v1) / 1));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a0[14] = (((a0[14] * v3) && (v2 > a0[0])) + ((v0 % 1) > (63 % 8)));
+                v0 = (((v1 < i0) < (a1[3][4] == i0)) >= ((11 || a0[15]) < (31 != 5)));
+                a0[0] = (((95 % 4) + (i1 != 94)) && ((i1 >= a1[0][2]) != (v3 <= a1[2][4])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((i3 > v0) <= (v1 >= i2)) <= ((42 != 7) * (49 < a0[8])));
+                    a1[2][6] = (((v3 > v2) >= (10 - a0[8])) - ((v3 >= 35) <= (v2 * v2)));
+                    v3 = (((0 ? 63 : v0) - (a1[2][9] <= 55)) >= ((44 <= i2) != (99 && v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((v1 == 3) && (a1[3][10] % 5)) + ((v0 + a1[1][10]) != (v2 || v1)));
+            a0[1] = (((94 ? a0[11] : 45) * (v3 % 8)) && ((a1[0][8] - v1) <= (9 * a0[8])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((7 != v0) + (v1 % 3)) == ((a1[2][8] ? 90 : a1[1][12]) / 7))) {
+        a0[9] = (((a1[3][8] - 32) == (v1 <= a1[1][13])) % 5);
+        v3 = (((v3 > a0[13]) / 9) - ((21 * a1[1][5]) && (a1[1][13] + 92)));
+        v3 = (((a0[8] ? v1 : v0) - (a1[1][1] == v2)) != ((a0[14] * v0) != (v3 < a1[0][5])));
+    } else {
+        v3 = (((v1 >= 4) - (v1 ? a1[2][6] : v1)) == ((v2 == a1[0][0]) <= (v3 >= v2)));
+        v3 = (((v2 ? a1[0][5] : v2) + (v0 - 40)) >= ((v0 + v0) % 7));
+        v3 = (((a0[8] == v2) - (62 <= 12)) % 7);
+    }
+    if ((((v0 > 13) && (75 * v3)) <= ((54 / 2) - (v2 % 1)))) {
+        v2 = (((v1 * a1[1][9]) <= (v0 / 8)) * ((a0[5] % 2) ? (v3 || 81) : (1 + v1)));
+        v1 = (((v1 <= 89) * (v2 < v0)) ? ((36 < v2) == (a0[10] >= a1[3][9])) : ((v1 && 20) >= (v0 % 1)));
+        a1[1][3] = (((a0[2] != v2) + (73 || v1)) >= ((98 ? 34 : a1[0][14]) % 9));
+    } else {
+        v2 = (((v3 ? v2 : 73) == (a1[0][8] / 7)) ? ((88 != v3) > (7 - 78)) : ((v0 ? a1[3][2] : 53) % 5));
+        a1[1][14] = (((v1 > v2) * (v2 + a1[0][3])) >= ((22 / 6) ? (v0 == v0) : (v0 || v3)));
+        v2 = (((78 ? a1[1][5] : a1[0][12]) > (v1 ? v1 : 87)) ? ((8 - v1) || (a1[1][8] * v0)) : ((a0[3] || v1) >= (v2 == v3)));
+    }
+    v0 = (((a0[14] <= a1[0][10]) ? (v1 / 9) : (v3 / 8)) - ((a0[12] % 8) <= (v1 * v0)));
+    return (((a1[2][3] != a0[5]) > (v2 / 1)) ? ((v0 < a1[2][10]) + (a0[3] >= v0)) : ((v1 > v0) < (v1 <= a1[1][9])));
+}
+int f1() {
+    int v0 = 9;
+    int v1 = 40;
+    int v2 = 7;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[1][7] / 6) == (v3 / 5)) % 6)) {
+        v3 = (((37 + 12) == (6 || v3)) - ((a0[11] < v2) ? (27 >= v2) : (17 >= 58)));
+        a1[3][9] = (((v2 - 62) + (46 <= v2)) && ((a0[6] && a1[3][0]) > (35 > 88)));
+        a1[1][3] = (((a1[0][3] % 6) <= (50 < a1[1][11])) / 5);
+    } else {
+        a0[6] = (((v1 % 3) > (a0[13] / 9)) * ((v1 != v3) != (v3 * a0[15])));
+        v3 = (((v1 ? v3 : 22) - (a0[7] || a1[1][15])) >= ((v2 % 7) > (v1 / 8)));
+        a1[3][1] = (((v1 <= v0) <= (22 || a0[15])) - ((26 || v3) % 7));
+    }
+    v1 = (((v2 && v0) <= (53 * a0[8])) / 2);
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v2 = (((v1 >= 88) > (v0 * 20)) ? ((a1[3][7] != a0[2]) ? (v3 % 9) : (72 == 76)) : ((a1[0][1] ? v1 : v2) <= (a1[3][3] != 10)));
+            v1 = (((a1[2][9] + 74) >= (a0[8] != 0)) ? ((6 / 7) >= (24 >= v3)) : ((a0[2] - v0) >= (v1 + 32)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    if ((a0[5] ? a1[3][5] : v2) > 69) break;
+                    v1 = (((v2 % 7) + (a0[0] < i0)) ? ((v2 < 20) * (a1[3][15] + v1)) : ((i0 / 3) > (a1[3][8] != a0[7])));
+                    v0 = (((72 >= a1[3][4]) == (35 / 7)) ? ((v3 <= 12) / 2) : ((v0 > 96) || (a1[2][11] + 48)));
+                    v2 = (((47 * v2) / 9) && ((i1 != i0) <= (v1 <= v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a0[5] = (((a1[0][0] < a0[14]) >= (v1 != a0[13])) * ((a1[0][7] != a0[1]) == (a0[9] || v3)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v0 ? 36 : a1[1][8]) > 84) break;
+            v1 = (((v1 > v3) / 8) / 3);
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((v1 ? v2 : v2) ? (34 + a1[0][12]) : (76 > a1[0][5])) != ((0 && v0) > (i2 != v3)));
+                    v2 = (((a0[7] || 23) % 4) <= ((i2 * i3) != (a0[4] % 8)));
+                    v2 = (((a1[1][10] == i3) + (7 == i3)) * ((32 - 31) + (a0[3] ? i3 : v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v1 = (((31 != 42) <= (a1[2][0] ? a1[1][8] : 97)) && ((i2 > v0) - (v0 && 75)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v0 < v0) + (a1[0][0] != v0)) / 9);
+}
+int f2() {
+    int v0 = 24;
+    int v1 = 96;
+    int v2 = 52;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((49 < v2) == (84 ? 88 : a0[15])) * ((v0 - v3) && (61 - v1)));
+    v2 = (((v1 % 4) ? (71 || v1) : (v1 && v1)) * ((v1 < 20) < (73 >= a0[2])));
+    if ((((3 < v1) == (v3 ? 50 : v0)) - ((67 * 23) >= (59 * v2)))) {
+        v2 = (((77 != a0[12]) <= (43 - a1[2][4])) > ((5 <= 22) || (v3 && a0[3])));
+        v1 = (((a0[13] * v1) == (61 < 51)) % 5);
+        a1[3][11] = (((v3 || a1[1][14]) ? (76 + 11) : (v0 + 16)) ? ((85 || 1) || (v3 + v2)) : ((v3 != a0[7]) < (v2 > v1)));
+    } else {
+        a0[12] = (((a0[14] != v2) * (v2 && 42)) * ((a0[7] * a1[2][10]) / 9));
+        v1 = (((v1 != 76) < (84 > v0)) < ((v3 * 21) < (v2 / 5)));
+        a0[10] = (((a1[2][9] && v3) * (72 % 6)) + ((a0[6] && v2) > (v1 >= 81)));
+    }
+    if ((((v3 >= a1[3][1]) - (v3 && v2)) && ((v3 + 12) % 2))) {
+        v2 = (((v1 % 2) + (65 != 17)) ? ((v0 + 63) || (12 ? v3 : 8)) : ((96 > 50) < (v3 * v0)));
+        a0[10] = (((v3 + 17) || (v0 * a0[14])) <= ((56 <= v3) ? (a0[11] ? a1[0][8] : v2) : (27 || v0)));
+        v3 = (((v0 * a1[1][8]) ? (v1 != 81) : (a0[2] % 4)) == ((v3 <= a1[1][4]) && (72 || 16)));
+    } else {
+        a1[3][12] = (((v2 - v1) > (a1[1][5] == a0[15])) <= ((30 ? v0 : v3) <= (v2 ? v1 : v3)));
+        v0 = (((v0 ? 59 : a1[0][13]) != (a0[8] ? 32 : a0[7])) * ((v1 < v1) >= (21 / 9)));
+        a1[0][0] = (((v2 / 5) <= (a1[2][11] || v3)) && ((a0[5] % 6) < (v3 == 88)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                if ((v1 ? i0 : 16) > 51) break;
+                v2 = (((72 && a1[2][1]) != (a1[1][11] != v1)) ? ((a0[3] * v0) || (15 > a0[11])) : ((v2 ? a1[1][3] : a1[1][4]) % 4));
+                a0[11] = (((73 != a1[0][10]) > (v2 && 79)) > ((v3 % 9) != (89 ? v1 : i1)));
+                v3 = (((i0 + a0[15]) > (a0[5] || i1)) > ((v2 ? v3 : v1) % 9));
+                i1 = i1 + 1;
+            }
+        }
+        a1[3][7] = (((v0 % 2) - (i0 && v0)) / 3);
+        v1 = (((a1[3][2] > v2) > (a1[2][7] < v0)) >= ((i0 >= a1[0][9]) % 4));
+    }
+    return (((a0[15] != v2) % 4) ? ((59 - v2) && (15 < a1[3][13])) : ((v3 == v1) == (v2 * a1[3][3])));
+}
+int main() {
+    return 0;
+}
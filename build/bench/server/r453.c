@@ -0,0 +1,49 @@
+int f0() {
+    int v0 = 87;
+    int v1 = 14;
+    int v2 = 9;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a0[11] - v0) || (a0[9] % 7)) ? ((v3 < v2) <= (a1[1][1] <= a1[1][7])) : ((61 >= v2) && (v0 == a0[3])));
+    v2 = (((a1[3][0] && v1) % 7) ? ((v0 < v1) + (v0 * 99)) : ((a0[7] != 54) * (a1[1][10] / 7)));
+    if ((((a0[13] * v3) >= (v2 - v0)) ? ((41 < v0) >= (v3 != a1[1][1])) : ((71 < 10) && (30 < v0)))) {
+        v2 = (((7 - v1) ? (v3 && a0[4]) : (a1[0][10] || 21)) / 2);
+        v1 = (((a0[14] != 21) - (a0[0] && v2)) <= ((v0 >= 46) == (a1[2][3] > 69)));
+        v0 = (((v1 ? v0 : a1[0][1]) != (92 <= a0[0])) ? ((v1 / 2) < (a0[7] + 52)) : ((43 > v3) == (v1 && 65)));
+    } else {
+        a1[1][0] = (((v3 - v3) <= (49 / 9)) || ((a1[1][7] <= v0) < (v2 <= a1[2][14])));
+        v2 = (((v2 && a0[2]) ? (a0[4] ? v1 : v1) : (a1[0][12] || a0[15])) >= ((v0 >= v0) && (a0[13] * 49)));
+        v3 = (((v2 - v2) && (39 % 8)) >= ((a1[1][0] ? a1[1][7] : a0[2]) >= (1 % 2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[3] = (((23 > v3) && (v2 + v1)) >= ((v0 <= 77) <= (v1 - v0)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((a1[1][13] % 2) >= (63 && a0[6])) / 5);
+                    a1[2][14] = (((v0 * v0) / 3) > ((i1 != i1) != (36 != i1)));
+                    a1[3][7] = (((a0[2] * a1[1][7]) < (a1[1][10] < 37)) != ((v0 != v1) && (i1 != a0[4])));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v1 = (((v0 / 8) || (74 ? v2 : a1[0][2])) ? ((a0[15] == v3) >= (i0 ? v1 : v1)) : ((a0[9] <= i0) - (46 > v1)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((v1 / 1) != (67 == v3)) >= ((a1[0][8] || a0[9]) == (v1 <= v0)))) {
+        a1[0][14] = (((v3 != v1) < (a1[3][1] ? 49 : v2)) <= ((v3 || 72) + (a0[3] + v2)));
+        v2 = (((57 + 21) <= (a1[2][14] >= a0[4])) ? ((a0[11] * v0) > (v1 > 9)) : ((a0[8] ? 1 : v3) || (v2 <= v0)));
+        v0 = (((v0 / 5) <= (v3 * 77)) <= ((v0 + a0[1]) || (a0[15] ? 10 : v1)));
+    } else {
+        v1 = (((v0 ? v2 : 79) - (v3 - 82)) == ((a1[3][1] * v0) >= (v0 || a1[1][15])));
+        a1[1][13] = (((10 == v1) - (a1[3][1] * v2)) < ((a1[3][4] >= v2) <= (76 ? v0 : v0)));
+        v0 = (((a1[1][2] == v0) * (v1 && a1[3][13])) - ((v3 / 2) <= (v2 == v2)));
+    }
+    return (((v2 == a1[0][4]) && (a0[2] < 55)) != ((76 != a1[1][7]) >= (a1[3][11] % 6)));
+}
+int main() {
+    return 0;
+}
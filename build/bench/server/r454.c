@@ -0,0 +1,116 @@
+int f0() {
+    int v0 = 57;
+    int v1 = 68;
+    int v2 = 69;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a0[11] % 7) && (a1[1][5] > v1)) ? ((v0 + a0[1]) != (v2 != 7)) : ((55 <= v1) % 1));
+    if ((((v0 % 4) > (a0[2] >= v2)) == ((33 <= v2) ? (v2 > 66) : (4 && a0[1])))) {
+        a0[3] = (((v2 < a0[14]) * (v2 * 32)) || ((v1 < a1[0][3]) + (v2 != v0)));
+        v0 = (((a0[1] + v2) + (a0[0] ? v3 : v2)) && ((a1[0][1] ? v2 : 17) % 8));
+        v0 = (((v1 * a1[2][10]) - (62 ? 16 : a0[13])) > ((a1[0][2] / 2) == (v1 != 88)));
+    } else {
+        v1 = (((a1[2][1] != 67) >= (v0 > v2)) != ((v0 <= a0[10]) - (v1 == v3)));
+        v3 = (((1 - v2) + (13 <= 53)) || ((v2 ? a1[2][8] : 5) || (86 ? 22 : v3)));
+        v3 = (((42 - 0) && (v1 * v1)) % 7);
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        a1[0][1] = (((a0[12] * a0[14]) + (a0[3] == a0[0])) / 3);
+        v3 = (((37 > v2) && (a0[9] > v1)) > ((i0 / 4) && (v2 ? v2 : v0)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                if ((a1[0][15] == i1) > 61) break;
+                v0 = (((a0[1] - i1) != (a0[11] != v3)) && ((v0 <= v0) != (63 >= a1[3][1])));
+                a0[1] = (((v2 / 2) >= (a0[7] < a0[5])) * ((a1[1][1] + v2) - (i1 || a1[0][11])));
+                v3 = (((v3 * a1[0][8]) || (53 <= 50)) - ((v1 - 13) != (v3 >= a0[4])));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    a0[11] = (((v1 - 81) == (v0 % 8)) / 8);
+    if ((((v1 + 3) >= (v1 || 78)) < ((4 ? v1 : 55) * (v0 % 2)))) {
+        v1 = (((v1 || a1[2][1]) >= (v3 / 7)) >= ((v2 <= 26) * (a0[13] > v1)));
+        v0 = (((v1 <= v3) / 1) >= ((v2 ? a0[9] : a1[2][12]) / 9));
+        v3 = (((a1[0][11] - a0[12]) != (a0[2] - a1[1][5])) == ((v3 ? a0[11] : 61) / 3));
+    } else {
+        a1[1][11] = (((a0[0] / 6) >= (a1[3][6] - a0[0])) ? ((v2 ? v3 : v0) || (35 >= v1)) : ((a0[0] > 77) != (v3 != 16)));
+        v1 = (((v3 - 58) >= (a0[15] && 25)) % 6);
+        a0[9] = (((a0[10] && v0) != (a0[11] / 2)) || ((a1[3][5] >= 51) / 3));
+    }
+    return (((v3 / 5) * (v0 <= v2)) % 4);
+}
+int f1() {
+    int v0 = 90;
+    int v1 = 70;
+    int v2 = 43;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((a0[2] == i0) > 57) break;
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((i0 / 3) > 53) break;
+                    a0[9] = (((a1[0][14] / 1) < (v0 ? a0[10] : v2)) <= ((v1 > v3) < (a1[1][6] / 8)));
+                    a1[0][1] = (((43 - a1[2][3]) == (v0 > a1[2][7])) >= ((a1[0][13] != v2) && (16 ? v3 : i1)));
+                    v3 = (((a0[0] || a1[2][15]) != (v3 * a0[6])) ? ((40 >= a0[9]) && (i1 != 22)) : ((94 ? i0 : v2) >= (a0[15] || v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((27 && v3) != (v3 && a0[10])) * ((v3 ? i0 : 12) > (v3 ? a1[1][11] : i0)));
+            v3 = (((v0 + 34) + (v3 / 8)) + ((93 <= 50) != (37 || v2)));
+            i0 = i0 + 1;
+        }
+    }
+    a1[0][2] = (((a0[13] * 49) <= (44 < v2)) > ((40 * v0) || (v2 != v2)));
+    {
+        int i2 = 0;
+        do {
+            if ((v3 ? v2 : v0) > 61) break;
+            v0 = (((v2 != 10) ? (a1[3][3] || i2) : (27 > a1[2][0])) - ((v1 * v3) * (i2 || a1[0][3])));
+            v2 = (((v0 || 83) && (a0[5] >= 35)) == ((v2 < a1[2][14]) % 3));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((v1 + v2) >= (72 >= a0[9])) * ((19 + v1) / 9));
+                a1[1][1] = (((16 || a0[1]) - (i2 ? 9 : a0[10])) / 6);
+                v3 = (((v1 && v2) <= (v0 <= i2)) / 7);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((v0 ? v1 : 93) > 86) break;
+            v0 = (((0 ? a1[0][13] : v3) != (v2 && 82)) ? ((v3 * 2) * (a1[0][7] || v1)) : ((94 >= v0) % 7));
+            a1[0][3] = (((v2 - v3) + (a0[9] && 67)) > ((30 >= a1[0][5]) * (v0 >= 20)));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v1 = (((a0[9] ? a1[2][11] : 10) || (v2 - i4)) <= ((v3 || 83) * (v0 + a0[7])));
+                    v1 = (((v0 >= 43) % 4) * ((a1[1][15] * 9) < (i5 - a1[1][9])));
+                    v2 = (((a0[4] == 22) && (v3 - a0[14])) == ((84 * a0[8]) % 5));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((28 ? 73 : 65) == (v3 && 80)) * ((85 <= 93) < (86 < v3)))) {
+        v0 = (((a0[0] + 93) / 3) != ((84 || a1[2][13]) ? (a1[3][7] + a1[1][8]) : (89 - a0[15])));
+        a0[0] = (((40 > v0) % 2) - ((42 - a0[1]) <= (v2 != v0)));
+        v3 = (((v3 % 7) / 5) * ((a0[15] >= 12) * (v0 < a1[0][6])));
+    } else {
+        v1 = (((v3 >= a0[2]) ? (v3 ? v3 : v0) : (v3 && 81)) ? ((v1 && v3) >= (v2 / 1)) : ((33 != a1[1][9]) <= (v3 < v1)));
+        a0[4] = (((a0[3] >= v0) <= (58 ? a1[1][14] : v3)) ? ((a1[1][8] ? v3 : 43) / 3) : ((v0 == v3) + (v0 > v3)));
+        v2 = (((v0 <= v2) > (v1 >= v0)) < ((6 >= v0) * (13 / 5)));
+    }
+    return (((86 / 1) - (v0 ? a1[1][4] : a1[1][1])) && ((v1 <= a0[2]) / 6));
+}
+int main() {
+    return 0;
+}
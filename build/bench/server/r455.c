@@ -0,0 +1,149 @@
+int f0() {
+    int v0 = 91;
+    int v1 = 65;
+    int v2 = 7;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 < a0[13]) % 8) && ((59 / 9) > (54 == v0)))) {
+        v1 = (((49 ? a1[2][12] : a0[10]) || (v3 < v2)) ? ((v1 && v2) / 9) : ((v0 <= v0) < (v2 < 8)));
+        a1[3][14] = (((97 + a0[2]) || (a0[3] - v2)) - ((73 + v3) != (85 / 3)));
+        a1[0][12] = (((65 || v1) <= (a1[2][0] / 7)) % 9);
+    } else {
+        a0[15] = (((v0 * v0) <= (90 + 85)) * ((52 * v2) < (v2 && v3)));
+        v1 = (((4 * v0) ? (v1 + a0[0]) : (a1[0][7] || a0[13])) >= ((a0[1] / 1) > (v3 > a0[6])));
+        v3 = (((v3 || a0[15]) % 3) ? ((v2 >= a1[0][5]) ? (v0 * v3) : (v2 < a1[2][0])) : ((v2 == v1) != (v1 <= a0[4])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a0[14] = (((54 || a1[1][7]) < (a0[13] || a0[12])) > ((a1[0][2] - 78) >= (v3 && v0)));
+            a0[4] = (((v3 > v0) > (v0 ? 57 : i0)) ? ((a1[1][6] > 75) == (v1 != v2)) : ((38 || a0[3]) == (v3 || v3)));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v2 = (((i0 == a0[6]) > (v3 <= i0)) || ((v1 - i0) || (v1 < a0[5])));
+                v3 = (((a1[2][1] / 6) * (v2 < 13)) || ((a1[1][12] > i1) / 5));
+                a0[8] = (((v3 == a1[3][7]) || (v0 + v2)) + ((a1[2][15] <= 72) == (v1 - v2)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 || a0[7]) + (v0 || v2)) >= ((v2 != v1) - (a0[9] || v3)))) {
+        v0 = (((v0 / 5) >= (v1 + v1)) % 6);
+        a0[0] = (((77 ? a0[7] : v1) < (a0[0] % 6)) <= ((v3 && a0[7]) % 8));
+        a0[12] = (((v3 ? v0 : v2) < (v3 * 54)) ? ((9 != a1[0][3]) * (v3 % 3)) : ((a1[1][9] < 64) / 7));
+    } else {
+        v3 = (((83 + a1[2][1]) % 9) <= ((v3 % 5) % 8));
+        a0[7] = (((97 >= v0) <= (a1[3][6] == v3)) * ((v2 ? v3 : v0) * (v0 <= v0)));
+        v1 = (((60 ? v1 : a0[11]) > (51 >= a0[6])) < ((10 == v2) - (v1 < v0)));
+    }
+    v3 = (((a1[0][5] / 7) || (19 >= v3)) < ((v3 > 83) ? (82 - v1) : (a0[2] > 93)));
+    if ((((37 == v0) != (v2 ? v0 : 13)) >= ((v1 % 3) ? (v2 > v2) : (a0[11] != v1)))) {
+        v1 = (((a1[0][6] + v2) + (23 <= 94)) != ((v3 / 8) != (a0[12] - v2)));
+        a1[1][1] = (((37 == 44) || (v0 >= v1)) ? ((v2 > a0[6]) * (v0 ? a1[1][7] : a1[1][8])) : ((a0[6] ? 16 : v3) + (38 || a0[13])));
+        v0 = (((v3 <= v1) / 5) % 4);
+    } else {
+        a0[2] = (((v2 <= v3) && (v3 || v2)) * ((71 || 97) > (a0[12] - v2)));
+        a1[1][10] = (((a1[3][11] % 9) - (5 * v2)) && ((a1[0][6] - v2) < (38 ? a0[11] : v2)));
+        a0[8] = (((v0 % 3) - (v0 && a0[14])) != ((a0[10] < v2) % 3));
+    }
+    return (((v1 / 5) / 2) < ((22 * v1) == (v1 ? a1[2][12] : v0)));
+}
+int f1() {
+    int v0 = 61;
+    int v1 = 57;
+    int v2 = 29;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v1 ? v3 : 2) <= (v0 > 29)) < ((v1 >= a0[7]) / 4));
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v3 = (((v0 ? 39 : a0[5]) ? (33 + a1[1][15]) : (v1 == v0)) >= ((34 % 7) || (87 < v1)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a0[8] = (((5 >= a1[0][1]) <= (a1[0][14] * a0[0])) >= ((96 && 97) != (v1 / 7)));
+                a1[2][13] = (((i1 ? i0 : i0) ? (98 >= i1) : (a0[4] * i0)) * ((a1[2][8] || i0) <= (i0 % 9)));
+                v0 = (((a0[2] > a0[14]) != (v0 % 3)) == ((30 + v1) - (v0 <= v3)));
+            }
+            v0 = (((v2 <= a1[0][11]) <= (i0 ? 71 : v0)) / 2);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[11] = (((v0 < v3) < (55 % 5)) + ((6 <= v3) <= (73 && v3)));
+            v3 = (((a1[3][7] / 7) || (25 - a1[2][0])) % 2);
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v2 / 3) >= (v3 != a1[1][1])) % 9);
+                    v3 = (((v3 > 40) <= (v2 - a1[2][12])) < ((a0[1] + v3) > (a0[14] % 4)));
+                    a0[7] = (((a1[1][12] == a0[8]) / 4) > ((59 - a1[0][5]) ? (v1 || 34) : (81 ? 45 : a0[0])));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    v2 = (((v1 * v0) % 6) != ((14 * v3) < (a1[1][2] - 12)));
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v3 = (((v0 <= v1) % 3) / 3);
+            {
+                int i5 = 0;
+                while (i5 < 3) {
+                    a1[2][2] = (((a1[2][10] == v2) * (a1[2][5] ? a1[1][13] : i5)) + ((99 < v0) || (a0[9] ? a0[11] : v1)));
+                    a1[0][3] = (((43 % 8) + (95 >= i5)) ? ((a1[3][5] <= a0[9]) == (13 ? i5 : a0[15])) : ((v0 < 91) ? (a1[3][7] * v2) : (a0[9] < a0[11])));
+                    a1[0][8] = (((a1[0][4] || i5) ? (70 - i4) : (i5 && i5)) ? ((85 - v3) != (65 ? v1 : v0)) : ((a1[3][4] * 70) >= (v0 != v0)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((51 * v0) ? (v1 + v3) : (i4 + v1)) != ((a1[0][6] > v3) <= (a1[0][9] / 4)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[15] * v0) != (a1[2][9] && a0[10])) < ((v2 - v1) ? (v3 + 70) : (v0 + a1[2][13])));
+}
+int f2() {
+    int v0 = 23;
+    int v1 = 67;
+    int v2 = 17;
+    int v3 = 37;
+    int a0[16];
+    int a1[4][16];
+    if ((((48 % 2) ? (a0[1] ? v1 : v3) : (v3 && a1[3][2])) < ((a0[13] <= a0[2]) && (v0 / 7)))) {
+        v0 = (((v2 / 7) - (a1[3][4] * v0)) != ((a1[0][14] % 6) < (a0[0] % 4)));
+        v1 = (((v3 ? 33 : a1[3][10]) ? (a0[14] < 30) : (a0[4] + 33)) > ((v3 + a0[4]) != (38 < 65)));
+        v1 = (((a0[7] % 7) * (v1 / 5)) && ((v0 ? v1 : v1) != (v0 - v0)));
+    } else {
+        a0[14] = (((v0 * v3) > (a1[0][2] == a0[0])) ? ((v1 ? v1 : a0[2]) >= (a1[2][7] < v1)) : ((25 <= v3) ? (a1[0][0] && v2) : (v1 - 80)));
+        a1[2][8] = (((a0[8] >= v2) >= (47 && 58)) + ((73 <= v1) - (a0[11] * a1[0][5])));
+        v2 = (((a1[1][8] ? v2 : a1[1][12]) ? (a1[3][8] == 25) : (51 && v1)) != ((v2 == 47) ? (v3 % 4) : (a1[0][12] < v3)));
+    }
+    a1[3][1] = (((a1[2][15] && 98) > (a0[15] >= a1[1][15])) - ((v2 - v0) >= (89 >= a1[0][12])));
+    if ((((a0[12] * v3) * (41 || a1[1][9])) >= ((70 - a0[10]) >= (v3 != a1[0][4])))) {
+        v2 = (((v2 || 84) && (a0[6] && a0[15])) == ((v0 - 11) > (a0[11] > 58)));
+        v0 = (((a0[4] > v0) - (v0 && 94)) < ((a0[4] == v3) <= (a1[0][15] ? 85 : v0)));
+        v0 = (((a0[4] / 2) < (a1[3][2] < v3)) % 3);
+    } else {
+        a1[3][10] = (((v3 + v0) != (v0 % 3)) < ((v1 + v3) * (v2 % 2)));
+        v0 = (((v0 == v2) > (38 ? v2 : a1[3][7])) % 1);
+        v0 = (((v2 == v2) <= (68 - a0[13])) || ((v2 != a0[6]) > (v3 + a0[9])));
+    }
+    a1[2][8] = (((a1[0][14] ? v2 : v2) <= (v3 % 9)) >= ((v1 ? v2 : a0[11]) || (a0[1] - 43)));
+    if ((((a0[5] > v1) % 2) ? ((a0[6] && a1[2][0]) > (v2 != v1)) : ((a0[11] % 9) % 6))) {
+        a0[4] = (((a0[3] + v1) ? (v1 ? 35 : v2) : (v1 ? a1[1][2] : a1[3][7])) < ((58 && 44) ? (v1 > v3) : (v2 > v1)));
+        v3 = (((v3 != 12) / 5) == ((a1[3][0] * a0[3]) < (v2 == a0[4])));
+        v1 = (((v1 >= a0[6]) + (3 / 3)) / 7);
+    } else {
+        a1[2][14] = (((v3 && 84) < (v3 * v2)) - ((a0[1] == v2) != (a0[11] / 5)));
+        v0 = (((47 >= a1[3][9]) / 4) <= ((v0 && 31) ? (v0 / 8) : (v2 == v1)));
+        v0 = (((v0 ? v2 : a0[9]) * (a1[3][9] / 7)) % 8);
+    }
+    return (((v0 ? a1[3][15] : a1[0][1]) - (82 * a0[3])) != ((v3 != a0[5]) < (v0 < 19)));
+}
+int main() {
+    return 0;
+}
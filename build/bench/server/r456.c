@@ -0,0 +1,70 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 19;
+    int v2 = 83;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            v2 = (((v2 && v3) % 4) > ((a1[2][9] * a0[6]) >= (a1[3][4] ? a1[0][6] : v2)));
+            {
+                int i1 = 0;
+                do {
+                    a0[11] = (((i1 - 15) ? (a0[11] <= v0) : (11 ? a0[3] : a1[1][14])) ? ((a1[3][0] % 8) - (50 && i1)) : ((v1 || i0) - (i1 - 2)));
+                    v0 = (((v2 - a1[0][13]) * (a1[3][8] > a1[1][5])) + ((v1 >= v1) || (a0[7] == v2)));
+                    v1 = (((a1[0][13] <= v0) * (i1 ? a0[8] : v3)) >= ((v0 + 80) || (a0[5] > 80)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v1 = (((v1 < i0) % 7) ? ((i0 < v1) >= (v3 && v3)) : ((i0 % 4) || (i0 >= i0)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((v3 == a0[8]) > 56) break;
+        a0[15] = (((i2 ? v0 : v1) >= (i2 != 40)) / 3);
+        {
+            int i3 = 0;
+            do {
+                v1 = (((v3 != 97) > (70 % 8)) || ((a1[0][15] ? i2 : 41) && (v1 && v0)));
+                v1 = (((a0[10] || v0) && (v1 == 68)) != ((i3 * v1) < (v0 != 48)));
+                v0 = (((a1[2][4] ? a0[14] : 45) > (a1[3][12] < 95)) ? ((v3 || 35) || (v3 - a1[2][5])) : ((i3 && i2) / 4));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        a0[13] = (((a1[2][9] || 70) != (v0 == a1[0][10])) && ((v3 != 90) / 5));
+    }
+    if ((((2 || 6) < (v3 + 57)) ? ((v1 >= 70) > (v3 != a0[10])) : ((v2 && v2) % 6))) {
+        a1[0][13] = (((48 > a1[0][13]) / 8) + ((96 > 2) >= (a0[0] > a0[1])));
+        v2 = (((v0 - 41) < (v0 || a1[1][0])) % 8);
+        a1[2][11] = (((v0 <= a0[11]) == (v1 || 94)) ? ((v2 <= 2) - (91 % 2)) : ((a0[6] != 91) || (39 != v2)));
+    } else {
+        v0 = (((v2 - v1) && (v1 && v3)) || ((v2 % 4) - (52 * v0)));
+        v3 = (((a0[3] && v2) * (v0 ? 3 : v1)) * ((v2 / 6) || (v1 >= v0)));
+        v2 = (((v1 ? a0[7] : a1[1][1]) - (18 || v1)) < ((v2 ? 75 : v3) * (v0 ? v1 : v2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v2 = (((v3 ? a1[0][10] : 70) >= (a1[2][3] < 76)) < ((a1[3][8] ? a0[6] : i4) - (a1[2][15] / 7)));
+                    v2 = (((60 ? a1[2][5] : 8) > (i5 >= v0)) + ((v1 / 6) % 9));
+                    v0 = (((i5 != v3) < (v2 == a1[2][12])) ? ((v0 || v2) > (v0 % 3)) : ((73 >= 82) + (v3 ? 19 : a1[0][3])));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v0 < v0) || (v3 < a0[3])) % 3);
+            a1[3][8] = (((8 < v2) && (v3 != i4)) + ((37 != v3) / 6));
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v3 ? 52 : v1) ? (19 || 29) : (v3 >= v0)) / 5);
+    return (((v3 * v3) ? (v0 || 43) : (v1 ? a0[9] : v0)) + ((v3 == 12) ? (v3 - v1) : (56 != v3)));
+}
+int main() {
+    return 0;
+}
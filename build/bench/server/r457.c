@@ -0,0 +1,131 @@
+int f0() {
+    int v0 = 1;
+    int v1 = 20;
+    int v2 = 81;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][13] != a1[0][0]) % 9) * ((v0 + v1) == (a0[11] ? v2 : a1[2][11])))) {
+        v1 = (((36 != 79) <= (63 * a0[3])) / 1);
+        a1[3][15] = (((77 != a0[11]) == (v0 >= v3)) ? ((53 / 4) / 4) : ((v1 == v0) > (40 >= 87)));
+        a0[10] = (((83 % 9) >= (93 % 4)) + ((v1 * a1[0][13]) >= (a1[2][15] >= 75)));
+    } else {
+        a0[5] = (((v3 < a0[15]) - (v3 / 4)) - ((v2 / 1) > (v1 ? v3 : v3)));
+        v1 = (((v2 - v2) < (a0[12] || v3)) != ((v2 <= 10) * (a0[4] > a0[3])));
+        v2 = (((v3 / 8) ? (v3 != 78) : (v0 + a1[0][12])) || ((v1 + v1) != (v3 < a1[1][11])));
+    }
+    a0[11] = (((v3 / 5) / 8) < ((a0[9] == 58) / 2));
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v3 = (((i0 + a1[1][7]) / 2) > ((v3 - v0) || (v1 - v3)));
+        v3 = (((29 > 8) % 4) + ((a0[1] != v3) - (a0[10] || 97)));
+        {
+            int i1 = 0;
+            do {
+                a0[5] = (((v2 != v1) || (a0[14] >= 1)) > ((32 != v0) - (v0 % 3)));
+                v0 = (((v1 / 4) % 6) == ((a0[13] % 2) > (a1[3][13] * v2)));
+                v0 = (((64 + 80) % 8) % 6);
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((a0[6] || v1) / 7) % 1);
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v1 = (((93 % 3) + (46 != v3)) <= ((74 / 6) < (v1 * a1[3][12])));
+                v1 = (((v3 || i3) >= (i3 ? 70 : v0)) + ((55 <= a0[11]) ? (98 <= 1) : (i2 < 42)));
+                a0[3] = (((55 < a1[2][3]) > (v1 * 41)) && ((v0 < a1[3][5]) <= (a1[3][9] / 9)));
+            }
+            a0[1] = (((v0 / 1) <= (i2 >= 38)) && ((40 % 7) && (v0 * v3)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v1 > v1) ? (v0 && 48) : (97 % 3)) > ((v1 % 6) || (v1 <= v1)));
+            v1 = (((90 % 4) % 8) != ((58 * v3) || (7 == 33)));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                a0[2] = (((a0[3] || a1[0][2]) > (i4 > 57)) ? ((24 / 1) >= (a0[3] ? a0[8] : i5)) : ((i4 % 5) % 6));
+                v2 = (((98 >= v2) < (i5 <= 6)) < ((i4 < v2) * (27 + 83)));
+                v2 = (((a1[1][9] != i4) ? (i4 / 7) : (32 ? i4 : v3)) / 3);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    return (((a1[3][8] % 6) <= (a0[14] - a1[1][4])) ? ((82 ? v2 : v3) * (v1 ? v3 : v1)) : ((v3 <= 85) < (v3 <= 52)));
+}
+int f1() {
+    int v0 = 93;
+    int v1 = 16;
+    int v2 = 11;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a0[11] = (((v3 * v0) ? (v3 || a1[2][1]) : (i0 == 57)) * ((a1[0][3] * 99) ? (i0 || 0) : (v2 && a0[10])));
+            a0[8] = (((35 != v1) / 7) > ((v1 <= a0[15]) - (98 != v1)));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v0 = (((a0[10] <= 87) >= (v3 / 1)) <= ((v3 * a1[2][8]) >= (v2 != i1)));
+                v2 = (((v3 == 1) * (a0[10] + v1)) && ((i0 ? 87 : v0) == (46 % 6)));
+                a1[1][15] = (((14 + i1) != (v1 / 7)) * ((a0[15] / 6) % 7));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v3 = (((a0[9] % 5) <= (15 == a0[0])) && ((68 / 6) > (v1 - v2)));
+        v3 = (((43 ? a1[1][12] : 82) < (v3 / 9)) + ((a1[0][8] || 24) ? (a0[2] * a0[10]) : (v0 ? v3 : v3)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                a1[2][2] = (((i3 < i3) + (a0[5] != v1)) - ((i2 && a0[10]) >= (v2 / 6)));
+                a0[6] = (((i3 && a1[1][12]) / 5) == ((41 > i3) - (v2 + a0[4])));
+                v3 = (((i3 * v0) <= (71 * i2)) && ((a0[13] == a0[6]) - (v3 + v2)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v1 = (((i4 < v1) - (i4 / 9)) && ((14 || a1[3][0]) <= (a0[2] / 2)));
+                    v1 = (((v2 % 7) ? (v2 && a0[2]) : (a1[0][7] % 5)) ? ((i4 == v3) ? (83 ? v1 : a1[0][15]) : (v2 + a1[0][14])) : ((v2 ? v1 : v0) % 8));
+                    v1 = (((i5 < 19) <= (31 / 4)) - ((29 < i4) != (v2 * v2)));
+                    i5 = i5 + 1;
+                }
+            }
+            v2 = (((v1 || 41) >= (v0 / 9)) % 6);
+            v2 = (((i4 < 3) + (54 || 84)) <= ((i4 <= i4) >= (94 - 84)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v1 % 4) ? (a0[4] >= v1) : (v0 > v1)) - ((v1 >= v3) ? (v0 % 2) : (69 % 8)))) {
+        v3 = (((a0[11] + a0[3]) == (a0[3] ? v1 : a0[14])) > ((a1[1][8] - a1[0][1]) != (v1 > v1)));
+        a0[13] = (((v2 == 28) && (v2 * v3)) / 2);
+        v2 = (((a0[4] < 56) ? (a1[1][10] + a0[0]) : (v1 == 2)) ? ((2 != v3) - (48 != a0[15])) : ((v1 == v3) != (a0[8] % 5)));
+    } else {
+        v0 = (((v2 >= v0) < (v0 < 97)) <= ((v1 >= v1) || (v1 + v1)));
+        a0[10] = (((v3 ? a1[0][8] : a1[2][14]) < (a1[2][14] >= v2)) * ((a0[13] / 2) >= (a0[11] - v1)));
+        a0[7] = (((13 >= a1[3][13]) - (71 ? 45 : v1)) / 5);
+    }
+    if ((((v0 * 62) % 9) * ((v3 ? a1[0][11] : 0) || (v3 * 94)))) {
+        a0[3] = (((a1[1][5] > 78) <= (v3 != a1[0][11])) == ((v0 <= a0[5]) && (a0[7] != a1[3][5])));
+        v2 = (((a1[0][6] == v3) >= (43 - a0[8])) * ((v3 || v1) - (v0 + v2)));
+        a1[2][6] = (((v1 >= 1) && (2 == v0)) / 8);
+    } else {
+        a0[6] = (((a0[9] < a0[15]) % 3) / 2);
+        v3 = (((v3 && a0[6]) - (v2 > 72)) % 5);
+        v3 = (((v0 % 7) && (a0[5] > v0)) == ((45 != v3) > (v0 + a1[0][12])));
+    }
+    return (((v1 * 4) ? (33 != v3) : (v3 * 73)) / 9);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,202 @@
+int f0() {
+    int v0 = 22;
+    int v1 = 64;
+    int v2 = 64;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    a0[5] = (((a0[15] * a0[2]) || (v1 - a0[8])) >= ((96 > 64) ? (a0[4] ? 87 : v1) : (v2 < v3)));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v1 = (((v3 <= v2) % 1) == ((v0 - 86) ? (v1 / 4) : (v1 ? i0 : v3)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v3 = (((a1[0][11] > i1) * (v1 != 66)) ? ((i1 - 95) ? (v3 ? v3 : a0[3]) : (v2 / 1)) : ((59 / 7) < (a0[5] > a0[1])));
+                    a0[1] = (((a0[0] - a0[1]) != (a1[2][8] >= v2)) && ((a0[4] || 69) && (a1[0][6] ? v3 : a1[0][0])));
+                    a1[0][6] = (((65 != i0) + (i0 - i0)) && ((i0 ? v3 : a0[14]) <= (v2 - 54)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][2] = (((i0 - v0) != (a0[7] > 64)) && ((51 || v3) > (i0 >= 97)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((45 <= v0) == (82 * v1)) && ((65 == v2) % 8))) {
+        v0 = (((a0[4] < 72) ? (v3 != a1[1][1]) : (a0[6] >= 68)) && ((v2 / 2) % 3));
+        v2 = (((v2 != v0) || (66 > a1[3][2])) == ((v3 == 28) + (72 > 76)));
+        v3 = (((v3 * v0) == (56 <= v3)) - ((60 != v3) - (41 + v1)));
+    } else {
+        v1 = (((v3 || v0) ? (v3 * v0) : (a1[3][12] ? v3 : a0[11])) / 5);
+        a1[3][9] = (((v2 == 77) != (39 ? v2 : v3)) - ((v0 % 7) != (19 == 79)));
+        v1 = (((97 == v2) / 1) != ((93 <= a0[3]) + (a1[1][10] < v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a1[0][4] = (((a1[3][0] <= a1[3][11]) == (i3 - a0[5])) - ((v2 * 47) == (37 || 14)));
+                    v3 = (((i2 * 4) ? (a0[6] - a0[0]) : (a1[3][7] >= i2)) >= ((68 >= a1[1][3]) ? (a0[4] == i2) : (v0 - v2)));
+                    a0[9] = (((v3 ? v3 : v3) != (32 - 76)) * ((i3 > v2) >= (v0 || a0[2])));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[2][15] = (((a1[3][14] <= i2) >= (a1[3][6] && a1[3][15])) % 4);
+            v2 = (((i2 || v0) != (v1 % 7)) < ((95 / 9) < (i2 && a0[5])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((a1[1][9] >= 14) > (a1[3][13] + i4)) > ((a1[1][12] > 3) - (i4 > v0)));
+                    v0 = (((v1 < v2) ? (v3 + 13) : (48 && v0)) - ((79 > 51) && (a1[2][6] && a0[10])));
+                    v3 = (((v1 > 49) <= (a0[3] ? i4 : v2)) != ((i5 / 4) || (5 > v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            a1[0][11] = (((a1[3][0] != a0[0]) - (84 / 4)) != ((a0[0] + v0) < (v2 >= a0[1])));
+            a0[1] = (((v2 * v3) + (a0[4] < v1)) <= ((a0[12] > 20) != (a1[3][11] > v1)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((v1 >= a1[1][12]) + (v2 >= 91)) || ((17 || v1) && (a1[2][7] || v0)));
+}
+int f1() {
+    int v0 = 84;
+    int v1 = 77;
+    int v2 = 99;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[0] + v3) == (a0[4] == v1)) > ((v2 <= 96) != (33 * 81)));
+            v3 = (((v2 != a1[0][14]) && (v1 > a0[6])) <= ((v3 ? v2 : i0) * (v3 ? v1 : a1[3][9])));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                if ((v0 / 2) > 71) break;
+                v1 = (((31 / 8) <= (20 % 7)) > ((49 < v2) || (a0[5] < v2)));
+                v3 = (((i1 * v3) <= (3 % 6)) - ((86 % 6) >= (v1 < a1[0][2])));
+                v2 = (((a0[15] != a0[8]) == (v3 * i1)) % 5);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((v0 <= v0) * (v0 / 2)) ? ((46 != 11) >= (v0 - v3)) : ((36 == 38) == (a1[2][7] || 14)))) {
+        v3 = (((a0[3] ? a1[2][8] : a1[3][12]) > (45 + v1)) && ((v1 >= v2) % 3));
+        a1[0][11] = (((a0[7] / 2) >= (15 != 53)) <= ((36 <= a0[8]) / 9));
+        v0 = (((a1[3][11] >= v1) ? (v2 <= v1) : (a0[4] ? 23 : v1)) * ((v1 ? v3 : a0[7]) + (v1 % 3)));
+    } else {
+        v0 = (((v2 * v3) || (v0 == 23)) <= ((a1[3][1] / 4) + (82 == v0)));
+        a0[12] = (((a1[2][8] || a1[2][15]) <= (v3 / 2)) - ((a1[2][1] && v2) > (a1[3][14] != v3)));
+        a1[3][5] = (((97 != v1) == (v3 || v3)) - ((17 && v3) <= (a0[14] && 13)));
+    }
+    v0 = (((a1[1][0] ? v0 : v3) ? (v0 < a1[0][5]) : (v0 / 2)) || ((v1 - v3) || (v0 <= v2)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                a1[0][12] = (((v3 / 9) <= (a0[6] || a1[0][5])) == ((v0 ? v2 : a1[2][15]) + (a1[0][1] / 7)));
+                v0 = (((v0 / 6) * (v1 % 8)) == ((20 * i2) ? (v2 >= a1[0][15]) : (i2 >= i2)));
+                v0 = (((a0[13] < i3) || (v0 == 98)) - ((a0[14] > a0[14]) + (94 % 5)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        a0[11] = (((a1[3][3] % 3) <= (74 ? v1 : 65)) / 9);
+        v2 = (((a1[1][6] >= a0[12]) && (v1 - v3)) || ((69 || a1[3][10]) >= (v3 > i2)));
+    }
+    if ((((v2 == a1[3][11]) > (72 + a0[11])) * ((62 ? a0[13] : a0[5]) == (91 % 5)))) {
+        v0 = (((a0[2] ? 85 : v1) > (v2 + a0[7])) % 9);
+        a0[0] = (((v2 && a1[2][6]) == (a1[2][2] % 4)) ? ((a1[2][3] > a1[1][6]) <= (84 <= a0[15])) : ((a0[5] / 3) <= (a0[9] + v3)));
+        a0[13] = (((v0 > 80) * (v1 > 82)) - ((a0[11] == v1) > (v2 - v1)));
+    } else {
+        v1 = (((a1[3][0] % 7) ? (a0[6] ? v2 : 95) : (a1[1][14] + 69)) >= ((v2 + 69) <= (v3 <= v2)));
+        a1[2][8] = (((85 || v1) ? (96 - v1) : (v0 && a0[3])) <= ((a1[0][1] < v3) && (v3 ? v3 : v0)));
+        a0[2] = (((a1[1][11] - a0[11]) + (a0[12] != a0[3])) == ((v2 != 35) ? (v0 - 50) : (96 && v3)));
+    }
+    return (((99 != v3) <= (69 ? v3 : 72)) ? ((v2 ? v2 : 39) == (v0 % 2)) : ((a1[3][11] || 32) % 9));
+}
+int f2() {
+    int v0 = 37;
+    int v1 = 86;
+    int v2 = 71;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v3 = (((28 / 2) >= (i0 % 4)) - ((25 || a1[0][12]) ? (v1 != a0[3]) : (36 + v2)));
+                v3 = (((v1 >= a1[2][13]) > (33 != 60)) >= ((i0 <= a0[12]) >= (v0 * i0)));
+                v1 = (((87 < a0[11]) + (a1[0][4] != v1)) < ((v3 == v2) < (i1 - a0[8])));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((a0[8] * 13) ? (i0 ? v0 : v0) : (81 * a1[0][12])) - ((v3 * v1) <= (4 % 5)));
+        v1 = (((55 == a1[3][2]) < (v3 == 7)) == ((v0 / 3) * (v0 ? a1[0][14] : v3)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v1 = (((v2 + a1[2][14]) - (v1 == 54)) - ((74 * a0[10]) / 3));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v0 = (((i2 ? v0 : a0[8]) - (95 == i2)) > ((v3 ? i2 : 14) % 5));
+                    v1 = (((v3 == 29) > (53 || v1)) >= ((i2 != 6) == (17 && 92)));
+                    a0[10] = (((13 && a1[1][14]) || (a0[9] || i2)) ? ((v3 >= a1[1][8]) == (a1[0][14] && v1)) : ((v1 > a1[3][10]) && (a0[4] ? a1[1][0] : a0[4])));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((v2 - i2) ? (87 >= a1[0][2]) : (a1[3][1] < i2)) / 1);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[5] > v2) * (59 + v1)) == ((v2 ? 69 : 66) == (a0[9] * 39)))) {
+        a1[3][10] = (((v1 - v1) > (v3 % 2)) > ((95 - a0[6]) / 1));
+        a0[7] = (((v3 && 97) >= (v3 ? v1 : v3)) % 2);
+        v2 = (((31 >= 79) ? (v3 > 98) : (14 || v3)) * ((v3 && 3) + (v1 / 4)));
+    } else {
+        v1 = (((v3 + 6) * (v3 && v2)) || ((v3 != a1[0][2]) == (a1[3][5] > 52)));
+        v1 = (((v0 && a0[1]) != (v0 * a0[11])) * ((v0 / 4) != (v0 ? v3 : v0)));
+        a0[9] = (((v1 * 1) - (v0 || v1)) || ((v2 <= a1[1][10]) % 2));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            a0[14] = (((v1 + i4) / 2) || ((a0[13] && 88) > (v3 - 50)));
+            {
+                int i5 = 0;
+                do {
+                    a1[0][15] = (((i4 && i5) % 7) == ((v1 - v0) / 9));
+                    a1[2][5] = (((a1[0][8] / 7) ? (72 >= 48) : (21 % 9)) ? ((i4 || 57) <= (v0 ? i5 : v3)) : ((68 > v1) < (i4 ? a0[11] : a1[0][6])));
+                    v0 = (((a0[12] >= i4) % 6) - ((v2 < a0[5]) < (6 && 20)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v0 = (((a1[3][7] >= v2) + (a1[2][0] - a1[0][2])) > ((v1 % 3) && (11 >= v1)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v0 % 5) / 3) / 2)) {
+        v0 = (((70 || 88) < (v2 - v0)) * ((v0 == a0[0]) != (a0[8] || a1[3][12])));
+        v3 = (((1 < v2) - (v1 != 70)) * ((a1[1][2] ? v3 : 92) || (a0[10] ? v3 : v0)));
+        v2 = (((a0[14] + v2) / 8) + ((v3 + 3) < (v0 <= a0[3])));
+    } else {
+        v3 = (((v1 && 99) ? (v1 != 16) : (75 - 20)) == ((v1 || 67) + (63 / 4)));
+        a0[15] = (((v2 ? 25 : a0[6]) && (v0 / 2)) >= ((v1 % 6) / 6));
+        v3 = (((14 ? v1 : v1) <= (v2 + v2)) > ((v2 != a1[1][14]) <= (a0[0] > 28)));
+    }
+    return (((v2 / 1) <= (v3 - a1[0][7])) / 2);
+}
+int main() {
+    return 0;
+}
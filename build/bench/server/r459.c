@@ -0,0 +1,45 @@
+int f0() {
+    int v0 = 62;
+    int v1 = 75;
+    int v2 = 82;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    if ((((33 <= v3) % 7) || ((v0 * a1[1][6]) ? (79 || 77) : (60 && a1[0][13])))) {
+        v3 = (((v0 < 88) == (v2 < v3)) / 5);
+        v3 = (((a0[12] ? v3 : v0) > (28 * 73)) % 6);
+        v3 = (((61 || v1) || (v0 ? v2 : v2)) || ((a1[2][2] ? 28 : a0[13]) + (a1[3][7] == v2)));
+    } else {
+        v2 = (((a1[0][14] % 7) % 1) && ((34 ? 7 : a0[11]) ? (93 < a0[14]) : (6 - a1[2][6])));
+        v1 = (((v2 % 7) / 9) > ((v0 / 1) - (v0 == a0[12])));
+        v0 = (((v0 && 58) / 2) == ((14 - v3) % 3));
+    }
+    v2 = (((a0[14] * v1) - (a1[2][15] > a1[0][1])) < ((v1 / 7) > (v2 / 2)));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                v2 = (((v1 + i1) || (a1[0][5] + a0[14])) > ((a0[2] ? a0[5] : 31) >= (a0[14] * v3)));
+                v1 = (((87 <= i1) < (a1[2][10] + 63)) - ((v2 >= a0[1]) ? (i0 == 8) : (v2 < v1)));
+                a0[3] = (((a1[1][5] * 8) >= (53 == a0[6])) - ((a0[13] ? 55 : a1[2][4]) < (a0[13] == v0)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[12] = (((a0[13] <= v1) ? (19 >= v0) : (69 % 8)) || ((a1[1][0] && v1) || (a0[8] > v1)));
+        v0 = (((v1 > v2) * (44 / 7)) == ((a1[3][12] % 3) > (i0 < v2)));
+    }
+    if ((((v0 / 9) == (24 ? a0[9] : v2)) <= ((v0 == a0[5]) == (v1 ? v1 : a0[14])))) {
+        v1 = (((32 / 8) == (v2 - 93)) * ((v2 != a0[14]) < (65 == 4)));
+        v3 = (((37 || v2) <= (v2 > v1)) - ((v3 == 35) ? (v3 / 3) : (v3 + 22)));
+        a1[0][1] = (((17 ? v2 : a0[3]) % 8) && ((71 != a1[2][7]) || (v0 % 3)));
+    } else {
+        a0[1] = (((v2 ? v3 : v1) != (v0 && a0[3])) == ((80 - v2) >= (v3 > v3)));
+        v1 = (((a0[4] && v0) % 2) < ((v3 || a1[2][11]) != (a1[3][5] * v3)));
+        v2 = (((73 != v1) ? (15 - v1) : (v0 >= a0[12])) < ((a1[1][9] ? v3 : v2) > (v2 % 4)));
+    }
+    a0[2] = (((a1[2][14] / 9) ? (v2 <= a1[3][10]) : (v1 && v0)) + ((v0 > v1) + (v0 + 29)));
+    return (((a0[2] != a0[10]) && (v3 < v3)) || ((a1[1][5] + 46) / 2));
+}
+int main() {
+    return 0;
+}
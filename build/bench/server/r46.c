@@ -0,0 +1,117 @@
+int f0() {
+    int v0 = 55;
+    int v1 = 98;
+    int v2 = 99;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        a1[1][11] = (((a1[2][10] > v1) <= (92 - i0)) * ((i0 ? 90 : a0[2]) != (v2 >= a1[2][6])));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v1 = (((3 >= a0[3]) < (84 < v1)) <= ((4 == v2) + (i1 > v0)));
+            v0 = (((v0 ? a0[12] : v2) / 1) != ((i1 * 36) * (a0[0] < a0[12])));
+            a1[3][6] = (((72 <= a1[0][11]) && (73 != i1)) % 4);
+        }
+        a0[14] = (((a0[14] >= v2) % 9) >= ((v1 && v1) ? (v3 != v0) : (v1 + 81)));
+    }
+    if ((((v3 > v2) > (v0 < v2)) >= ((v2 < a1[2][14]) > (v0 - v0)))) {
+        v2 = (((v2 % 2) ? (v1 && v3) : (4 != 1)) ? ((v3 >= v0) - (v2 % 3)) : ((9 / 4) && (v2 * a0[5])));
+        a1[1][13] = (((7 ? v1 : v1) == (a1[3][15] || 93)) >= ((v2 + v2) > (a0[15] && 82)));
+        a0[12] = (((a0[12] * 2) && (v3 >= v2)) <= ((v2 % 1) == (v0 && v1)));
+    } else {
+        a0[3] = (((v2 * a0[2]) && (a1[2][15] / 5)) % 3);
+        v3 = (((20 * v2) <= (a1[3][1] ? a1[1][0] : a1[3][0])) + ((v1 && a1[2][2]) < (v1 != v1)));
+        v0 = (((a0[2] - a0[9]) == (19 % 1)) >= ((95 / 9) ? (58 && v3) : (v2 <= v3)));
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    a1[0][12] = (((3 % 7) + (a0[2] / 4)) <= ((v3 * 74) <= (9 ? i2 : v2)));
+                    a0[3] = (((a1[3][9] * 95) ? (i2 * v1) : (v1 != v2)) > ((v3 < 75) * (v2 * i2)));
+                    v2 = (((17 >= 43) * (a0[2] > v1)) || ((a1[1][1] || i2) - (17 / 5)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v2 = (((v0 <= a1[1][13]) / 1) >= ((a0[10] ? 37 : 88) ? (40 ? 96 : v0) : (v2 && v3)));
+            v1 = (((58 || v2) != (a0[11] < 96)) > ((a0[10] < i2) || (v2 <= a1[3][12])));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    v0 = (((v1 ? 22 : a0[10]) <= (a1[0][14] ? v1 : a1[2][13])) > ((v3 && a0[3]) / 4));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((v1 || i5) > 98) break;
+                    a1[0][9] = (((8 || i4) != (a1[3][6] <= v1)) == ((i5 && v2) - (8 == v3)));
+                    v2 = (((v2 ? a0[12] : 5) >= (v2 > v1)) ? ((a0[1] - 28) - (94 % 1)) : ((18 * 56) == (a0[9] < 53)));
+                    v2 = (((v3 && v2) <= (i4 > i5)) % 2);
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((a1[0][10] ? 28 : v2) >= (a1[0][5] || a1[1][6])) % 3);
+            a1[1][1] = (((31 % 7) - (v1 || v3)) + ((a0[9] < v1) >= (18 || v2)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((a1[1][15] == a0[7]) >= (80 * v3)) <= ((a1[1][0] <= a1[3][11]) < (v1 + a1[2][9])));
+}
+int f1() {
+    int v0 = 3;
+    int v1 = 32;
+    int v2 = 22;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[15] ? v3 : v3) / 9) || ((44 + v1) || (a0[10] + v2)))) {
+        v2 = (((v0 % 9) / 4) >= ((49 || v2) != (v0 || a0[2])));
+        v0 = (((62 || a0[14]) > (a0[2] || 81)) >= ((a0[8] < 89) ? (69 <= v2) : (a1[1][7] || a1[0][13])));
+        a1[2][0] = (((v3 - 47) * (v1 % 4)) > ((v3 && v1) > (a0[9] <= v2)));
+    } else {
+        v2 = (((v1 <= 44) * (a1[3][10] + a0[3])) > ((16 ? a0[13] : a0[8]) ? (v3 / 5) : (v3 != 68)));
+        v0 = (((v0 / 1) % 6) ? ((a0[15] - v3) || (v0 < a0[0])) : ((v3 - v0) > (a0[2] && v3)));
+        a1[1][4] = (((a0[1] ? a1[0][12] : v0) + (16 != v1)) >= ((64 != v3) || (68 + v0)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((i0 == a1[1][3]) > 89) break;
+            a1[0][5] = (((a0[9] >= 99) ? (v0 ? v2 : v0) : (a1[3][7] < 84)) || ((a1[3][15] != a1[1][6]) < (a0[5] ? v3 : 38)));
+            v3 = (((i0 != 7) ? (v2 == i0) : (i0 > 52)) == ((v2 <= v0) ? (53 != i0) : (a0[8] < v1)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((72 <= 16) || (v2 / 4)) + ((v2 % 8) * (a1[2][2] != i1)));
+                a1[2][7] = (((a0[2] + v3) < (a1[2][4] != v2)) != ((53 + 2) > (a0[4] ? 62 : 71)));
+                v3 = (((v2 > v2) != (a0[6] ? a0[15] : a0[3])) % 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v0 = (((v2 && v3) == (v1 == v1)) + ((v3 >= v0) || (v0 != 1)));
+        {
+            int i3 = 0;
+            do {
+                if ((i2 % 8) > 51) break;
+                a0[3] = (((8 * 26) / 4) != ((v0 >= 10) / 4));
+                a1[1][13] = (((v0 % 9) < (a0[8] != 51)) ? ((i3 || a1[3][5]) && (5 < a1[2][4])) : ((64 && 68) < (v3 - v1)));
+                a0[15] = (((a0[7] / 4) > (i2 * i3)) - ((v1 * 96) <= (78 && 24)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+        v2 = (((v0 + a1[3][13]) / 8) + ((a1[0][5] % 1) - (i2 < 87)));
+    }
+    a1[3][4] = (((a0[7] && v2) % 7) + ((2 ? a1[2][3] : v0) % 1));
+    v0 = (((a1[3][1] < 41) && (v3 && 22)) ? ((a1[1][6] < v0) && (18 != 82)) : ((a1[0][14] && 65) ? (a1[0][2] > v1) : (84 && v2)));
+    return (((v2 != v3) == (v1 || v2)) <= ((a0[11] ? v1 : v3) || (27 - 75)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,119 @@
+int f0() {
+    int v0 = 81;
+    int v1 = 21;
+    int v2 = 98;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    a0[2] = (((a0[14] || a1[1][10]) || (a0[13] <= 53)) < ((v3 != v3) - (v2 ? 2 : 31)));
+    v2 = (((a0[11] % 1) >= (v2 == 18)) == ((a0[6] && v2) / 8));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v0 = (((v3 ? i0 : a1[0][1]) ? (41 >= i0) : (85 * a1[3][5])) <= ((a1[0][7] != v3) != (v2 % 8)));
+        a0[3] = (((v2 * i0) ? (i0 % 3) : (v2 < 2)) + ((a1[0][0] || 45) * (a0[0] >= v2)));
+        {
+            int i1 = 0;
+            do {
+                a1[1][5] = (((38 > 47) <= (v1 >= 67)) <= ((a1[2][11] && v1) + (21 >= v2)));
+                a0[10] = (((a1[2][4] % 4) ? (62 / 8) : (v3 - v1)) <= ((a1[3][11] % 4) ? (i0 / 5) : (90 || v0)));
+                a1[2][7] = (((a1[1][5] == a1[2][10]) && (v3 ? a1[3][11] : a0[11])) >= ((v3 < 11) - (v1 && i0)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    if ((((v2 ? a0[2] : v1) ? (a0[5] - a1[0][10]) : (4 + a1[2][8])) < ((a0[13] / 7) * (v2 + 61)))) {
+        a1[1][14] = (((v1 != a1[1][5]) < (32 > a0[14])) != ((15 + v1) > (18 * v1)));
+        a0[7] = (((a0[10] == a0[3]) - (a1[1][7] != a1[2][7])) * ((v2 || a1[2][12]) && (v3 - a1[0][15])));
+        v3 = (((90 > v1) > (a1[0][4] / 1)) > ((v1 ? v0 : v2) >= (a1[0][11] != v1)));
+    } else {
+        v0 = (((82 ? v3 : v0) / 2) || ((v1 - a1[3][6]) + (v0 ? 50 : v2)));
+        v1 = (((1 && 21) + (44 + a0[3])) > ((48 != 36) / 7));
+        a1[1][7] = (((v1 == v0) < (v3 ? v0 : 81)) - ((11 || a1[1][6]) <= (v3 == 98)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a1[0][9] = (((9 < a0[9]) % 5) + ((a1[1][13] >= v0) <= (v1 / 7)));
+            v1 = (((v3 % 1) ? (a1[1][0] + v0) : (i2 == v1)) * ((90 >= v3) * (36 - a1[2][6])));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((v1 + a1[0][9]) && (96 != a0[6])) % 9);
+                    a0[6] = (((i2 / 7) ? (v3 == i2) : (v3 < v3)) || ((25 <= a1[3][15]) && (v0 > i3)));
+                    v1 = (((v0 % 8) * (v3 > v1)) * ((i2 ? 30 : 61) * (a0[11] ? i2 : i2)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((v2 == 5) == (60 % 2)) <= ((v2 >= 69) || (a0[6] ? 89 : v3)));
+}
+int f1() {
+    int v0 = 26;
+    int v1 = 95;
+    int v2 = 85;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a0[12] < a0[3]) < (v0 < a1[1][4])) % 8);
+            a1[0][12] = (((v2 == 32) == (v2 ? i0 : v2)) == ((v0 && a0[3]) ? (a0[15] && v3) : (v2 / 2)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[2][3] = (((a0[13] || v2) == (i1 % 9)) ? ((v3 > 76) ? (a1[3][1] >= i0) : (76 != i1)) : ((i0 / 9) < (a0[13] > i0)));
+                v0 = (((v0 > v2) || (84 % 9)) % 6);
+                v3 = (((v0 || 35) < (v3 - 64)) && ((45 - v1) < (v1 != a0[0])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        a0[2] = (((a0[5] != v0) ? (71 ? a0[3] : a0[6]) : (v1 / 7)) && ((7 > a0[7]) + (7 * v3)));
+        {
+            int i3 = 0;
+            while (i3 < 7) {
+                a0[11] = (((47 < 61) != (v0 % 7)) > ((i2 % 6) % 6));
+                a0[4] = (((i3 - v0) * (i3 || a0[10])) && ((a1[0][2] || 71) != (v2 && a0[7])));
+                v0 = (((v2 == a0[6]) % 7) || ((v3 == v2) && (v1 != 39)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((a1[0][13] * a1[2][15]) >= (a1[1][10] && v2)) >= ((38 && v0) >= (a1[3][3] < v0)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v3 = (((81 + 67) == (a0[14] > v1)) < ((v2 - a0[4]) ? (95 > v1) : (i4 > v0)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v3 = (((a1[3][8] / 3) && (45 != v0)) > ((i5 * i4) <= (v2 < v3)));
+                v0 = (((i5 ? a1[3][4] : a1[1][7]) ? (a0[8] == 41) : (v1 * i5)) ? ((v1 % 1) < (v2 < v2)) : ((i4 <= a0[15]) < (91 != a0[1])));
+                a1[0][14] = (((i4 <= i5) + (a0[4] != 56)) % 2);
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((a1[2][1] && v2) != (a1[2][5] * v1)) ? ((v3 < 20) % 9) : ((a0[3] - 70) && (v3 / 5)));
+    }
+    if ((((a0[7] < a0[1]) == (a1[0][7] / 8)) ? ((16 / 2) * (39 <= a1[2][8])) : ((v0 || v0) + (v0 <= a0[13])))) {
+        v0 = (((90 < a0[8]) >= (v0 != v0)) && ((51 < v0) == (99 ? a1[0][4] : 61)));
+        v3 = (((73 / 7) != (v2 <= v0)) + ((v2 < v0) % 9));
+        v2 = (((a1[1][11] % 9) > (a0[12] - v2)) <= ((a1[1][9] >= a1[3][9]) == (11 / 9)));
+    } else {
+        v1 = (((v1 <= a0[13]) ? (v2 <= 75) : (89 - v1)) > ((a1[2][4] + a1[0][15]) != (v2 < v3)));
+        v0 = (((90 && v2) ? (6 ? a0[10] : 27) : (v2 && v1)) * ((v0 + v2) + (v3 + a0[2])));
+        v0 = (((a0[8] == a1[2][14]) ? (a0[15] >= v0) : (4 > 35)) || ((v1 % 4) <= (16 ? a0[4] : v3)));
+    }
+    if ((((a0[10] <= v1) || (v1 < a1[1][0])) - ((v0 * a0[5]) ? (a0[11] ? a1[1][11] : v0) : (a0[9] + 42)))) {
+        a1[0][14] = (((a1[1][15] + 88) && (v3 > a0[6])) != ((71 ? v0 : a0[12]) / 6));
+        v3 = (((92 ? v2 : v3) || (a1[2][1] != 23)) ? ((v3 / 7) < (a1[2][9] == a0[14])) : ((v0 > v0) || (a0[10] ? 29 : v3)));
+        v1 = (((54 >= a0[9]) >= (41 == 18)) == ((v1 && a0[11]) && (a1[2][3] == 77)));
+    } else {
+        a1[1][9] = (((v0 < v3) > (8 / 8)) + ((v2 * v1) ? (a1[1][2] >= v0) : (v0 - v3)));
+        v3 = (((v2 >= 94) / 6) + ((a1[0][4] || v2) >= (v2 >= a0[0])));
+        v0 = (((a0[6] ? a1[1][9] : v2) != (v1 * 30)) || ((a0[14] > v1) - (a1[1][1] / 9)));
+    }
+    return (((v3 - v0) % 4) - ((v2 == 49) >= (a1[2][5] - a0[14])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,156 @@
+int f0() {
+    int v0 = 52;
+    int v1 = 79;
+    int v2 = 68;
+    int v3 = 80;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 >= v3) / 6) != ((a1[0][0] * v1) ? (46 >= a1[3][13]) : (v2 || a0[0])))) {
+        v3 = (((a0[8] <= v0) + (v2 <= a1[1][11])) >= ((v2 ? v2 : a1[0][0]) < (a0[8] ? v3 : a1[0][8])));
+        v1 = (((v2 && 3) > (a0[11] % 7)) <= ((63 ? 62 : v0) ? (2 && v0) : (v3 || 58)));
+        v3 = (((27 ? v1 : 18) <= (v1 * v3)) && ((v0 <= v3) - (79 ? v3 : v1)));
+    } else {
+        v0 = (((v2 != a0[3]) ? (26 * a1[3][13]) : (v2 ? a1[3][0] : a1[3][14])) - ((v3 - v3) != (87 == a1[0][1])));
+        v2 = (((26 % 7) == (v1 >= v2)) ? ((v1 || v3) + (a0[1] - v3)) : ((v1 > 19) != (39 || v1)));
+        v1 = (((v0 != a1[3][8]) * (36 + a1[1][15])) || ((87 || v1) >= (95 ? v2 : v0)));
+    }
+    a0[13] = (((a1[0][8] ? 19 : v3) != (v1 + v1)) + ((a1[2][3] != v1) - (5 < a0[1])));
+    a0[5] = (((v3 / 6) > (a0[9] < v3)) != ((v2 ? 72 : v2) == (v2 % 9)));
+    if ((((a0[11] && v2) - (82 >= v2)) != ((a1[2][3] * v2) != (v3 / 1)))) {
+        v1 = (((70 == v0) <= (v3 || v2)) % 7);
+        v0 = (((a0[14] + v1) == (12 % 3)) && ((a1[0][13] <= v0) != (a0[5] ? v1 : v2)));
+        v0 = (((v3 && 64) <= (71 - v0)) == ((a1[3][0] && a0[14]) / 6));
+    } else {
+        a1[0][1] = (((22 / 8) || (a0[13] % 7)) % 7);
+        v3 = (((v2 != v1) / 5) + ((v0 == a1[3][12]) >= (v3 ? a0[4] : 29)));
+        a1[3][12] = (((a0[1] % 5) < (93 < a0[1])) > ((v3 > v3) > (a0[5] <= a1[3][0])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[3][0] = (((a1[3][1] >= v1) <= (81 != v2)) && ((v2 || i0) * (v0 / 1)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v1 || 94) > 84) break;
+                    a1[2][3] = (((a1[3][11] >= v1) <= (v3 >= i1)) + ((a0[15] - a1[3][6]) >= (a1[3][2] > a0[9])));
+                    a1[2][7] = (((v2 == 98) && (v1 > 73)) >= ((i0 <= a0[2]) % 7));
+                    v0 = (((v0 != a1[0][10]) < (93 % 5)) - ((v2 ? v1 : v3) < (88 >= v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v2 = (((v3 <= v1) * (13 <= 69)) - ((v2 != a1[1][12]) % 1));
+            i0 = i0 + 1;
+        }
+    }
+    return (((20 != a0[1]) ? (v0 / 4) : (a1[1][10] >= a0[8])) / 9);
+}
+int f1() {
+    int v0 = 55;
+    int v1 = 5;
+    int v2 = 51;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((70 && 5) - (45 && a1[2][3])) || ((a1[0][13] <= a1[2][7]) - (v1 == a0[3])));
+    a1[2][13] = (((v2 == v3) - (v0 ? a0[9] : v3)) + ((51 != v2) <= (v1 ? v1 : v1)));
+    if ((((a1[2][2] / 9) != (v0 + 69)) ? ((94 % 7) % 7) : ((50 < a0[12]) < (v0 - a0[6])))) {
+        v1 = (((a1[0][14] != v3) - (v2 && a1[3][1])) > ((v3 != v0) / 1));
+        a1[1][13] = (((v1 >= v0) + (v1 % 2)) ? ((v0 + v1) > (84 ? v2 : v2)) : ((a1[2][9] < v1) <= (v1 <= v3)));
+        a1[1][13] = (((v3 >= 0) > (v2 == a0[14])) * ((77 % 8) > (35 / 6)));
+    } else {
+        v1 = (((a0[7] - a0[2]) > (84 + a0[3])) < ((v2 * v1) + (5 > 31)));
+        a1[0][0] = (((a0[12] + v1) != (v2 >= a0[14])) && ((v3 != v1) == (a0[5] <= v3)));
+        a0[6] = (((v1 <= v2) ? (a0[13] <= a1[0][6]) : (a0[9] != v2)) / 1);
+    }
+    if ((((a1[0][9] > v0) ? (a1[2][1] && a0[10]) : (a1[2][2] + 90)) * ((v3 + a0[5]) >= (v1 != a1[2][0])))) {
+        v3 = (((v0 ? 31 : v2) + (v2 / 2)) <= ((v0 - v1) > (85 + v3)));
+        v0 = (((62 < v1) ? (v0 % 5) : (v2 < v2)) != ((v2 < v3) >= (v3 <= v3)));
+        a0[11] = (((19 == v3) - (v3 <= 67)) + ((v3 && 8) * (v3 >= v1)));
+    } else {
+        v2 = (((v2 + v1) % 5) <= ((v3 ? 26 : 75) + (38 * v1)));
+        v1 = (((v1 > a0[12]) >= (a0[5] - v3)) == ((a1[3][3] >= a1[3][1]) || (88 > v1)));
+        v1 = (((v1 - a1[2][13]) && (v2 * v3)) ? ((a0[6] != a0[7]) >= (a0[9] != v1)) : ((v2 == a1[2][9]) || (6 - v3)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v1 = (((a1[0][8] / 3) < (86 / 3)) + ((38 % 7) ? (a1[2][12] ? a0[1] : i0) : (a0[6] <= 15)));
+        {
+            int i1 = 0;
+            while (i1 < 7) {
+                if ((63 || v1) > 56) break;
+                v3 = (((v0 && i0) != (i1 && 40)) < ((v3 == v3) >= (82 ? i1 : 10)));
+                v2 = (((v3 > i1) || (v2 ? a1[0][3] : v1)) - ((v3 ? v0 : v0) / 7));
+                v3 = (((a0[2] % 5) * (a0[11] + i1)) ? ((i0 < 97) == (a0[5] + i0)) : ((a1[1][3] && v1) >= (v1 <= a0[14])));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((31 != i0) ? (v0 - v1) : (i0 < 75)) != ((a1[0][9] <= v0) ? (v1 == v1) : (v3 - a0[11])));
+    }
+    return (((30 / 6) ? (4 * 70) : (v1 == a1[2][1])) && ((v1 + v2) * (v2 < a0[15])));
+}
+int f2() {
+    int v0 = 88;
+    int v1 = 58;
+    int v2 = 32;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v3 < v3) && (a1[2][11] >= v2)) >= ((v2 - a1[3][8]) <= (v3 || v2)));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v3 ? v1 : v0) > 61) break;
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v0 = (((97 && 12) ? (v2 + 47) : (v3 || v3)) % 6);
+                    v2 = (((i0 > v3) / 8) ? ((a1[1][7] - 15) != (v2 != a1[0][9])) : ((v2 > v3) >= (v1 % 7)));
+                    v1 = (((a1[0][13] == 28) != (a0[4] % 7)) && ((86 && v3) != (v2 != a1[1][0])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][4] = (((v2 % 9) + (v2 || v2)) <= ((24 * 24) < (i0 == a1[3][14])));
+            a0[1] = (((a0[6] < a1[3][15]) >= (v3 / 4)) % 4);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[11] = (((a1[3][3] + a0[3]) % 4) + ((49 <= 81) <= (a0[11] <= v3)));
+            {
+                int i3 = 0;
+                while (i3 < 8) {
+                    v2 = (((v2 >= v1) != (v0 >= 12)) + ((97 || v3) * (v3 > i2)));
+                    v1 = (((v2 / 8) < (98 < 20)) || ((37 % 6) || (v2 < v0)));
+                    a0[10] = (((14 <= v3) != (a0[11] < 4)) <= ((a1[2][11] / 8) ? (35 % 1) : (a0[11] >= i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[9] = (((v0 > v2) && (v1 == 49)) > ((v0 ? v1 : v0) <= (a1[1][10] / 8)));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v0 > a0[5]) ? (81 == 88) : (a0[9] * v1)) / 5)) {
+        v1 = (((a1[0][11] == a0[10]) + (v0 - a0[11])) >= ((92 >= v2) ? (88 ? v1 : 28) : (v0 % 1)));
+        v1 = (((86 <= v2) > (v0 % 8)) ? ((14 + v2) && (a0[10] || 60)) : ((a0[14] >= a0[10]) ? (v0 > v3) : (v3 / 5)));
+        v1 = (((a0[14] - v2) || (4 < v0)) <= ((v0 < v1) <= (v3 >= 80)));
+    } else {
+        a0[1] = (((87 && v3) ? (v3 < v0) : (v2 < v2)) > ((a1[0][11] * v2) / 9));
+        v1 = (((v2 * v1) + (v1 <= a1[1][15])) || ((3 < a1[3][9]) > (a1[3][14] - a1[1][12])));
+        v2 = (((v2 && v0) < (19 ? 98 : v2)) && ((a1[3][12] < v2) < (v2 * a0[3])));
+    }
+    if ((((v1 != v3) != (v1 >= v1)) < ((91 && v0) % 6))) {
+        v3 = (((a1[0][7] ? v1 : a1[1][0]) < (a1[0][12] + v2)) / 1);
+        v0 = (((94 && a1[3][3]) && (v1 % 9)) + ((v3 == a1[2][11]) / 7));
+        v3 = (((v0 || a1[2][3]) % 9) * ((v0 % 6) ? (75 / 9) : (a0[10] == v0)));
+    } else {
+        v0 = (((85 * 16) ? (v3 <= v3) : (2 - v3)) >= ((a0[13] && v3) ? (v0 == a1[1][7]) : (v1 && 85)));
+        v1 = (((76 && v1) - (43 > v0)) < ((43 - a1[2][10]) <= (v1 - v0)));
+        v1 = (((v2 && v0) ? (38 == a1[0][9]) : (5 >= a0[0])) / 4);
+    }
+    return (((v3 > 5) + (v3 <= v2)) - ((a1[3][6] ? v0 : v3) != (2 % 7)));
+}
+int main() {
+    return 0;
+}
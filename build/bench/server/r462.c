@@ -0,0 +1,57 @@
+int f0() {
+    int v0 = 48;
+    int v1 = 64;
+    int v2 = 99;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((v2 ? 9 : 91) + (i0 && v3)) % 1);
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v0 = (((v0 || a1[1][14]) == (v3 ? i0 : 48)) > ((22 < a1[2][7]) == (i1 < a1[3][11])));
+                    a1[3][13] = (((v1 || i1) || (a0[6] * 10)) || ((i1 ? a0[9] : a1[3][5]) + (a0[2] || a0[12])));
+                    v1 = (((29 - v0) >= (a0[7] * a0[4])) - ((a1[1][2] || 55) > (a1[3][9] < i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v1 - v0) + (99 == a1[2][10])) * ((a1[1][1] < i0) == (v0 > i0)));
+            i0 = i0 + 1;
+        }
+    }
+    a1[1][12] = (((a1[3][9] ? v1 : a0[15]) <= (v3 % 6)) + ((v3 >= 17) / 8));
+    a0[7] = (((a1[1][15] + v2) < (v2 + v3)) && ((60 / 5) >= (a0[12] % 3)));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((v1 && 24) <= (v3 - i3)) && ((67 >= 94) + (60 - v2)));
+                v3 = (((v0 == a0[12]) != (29 >= v1)) || ((17 - v1) == (v0 < v1)));
+                v1 = (((v2 > v0) == (v3 < 71)) ? ((v3 > v1) ? (a0[14] < v3) : (v2 - v2)) : ((85 >= i2) != (0 < i3)));
+            }
+            a0[12] = (((i2 ? 66 : 4) % 6) >= ((a0[13] < v2) && (78 != v2)));
+            a0[8] = (((v3 && 64) >= (v3 % 2)) % 7);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a0[3] = (((14 || 48) <= (v3 * v2)) >= ((86 > a0[10]) < (v0 <= v2)));
+        a0[13] = (((v2 % 2) > (i4 % 3)) >= ((42 == v3) ? (v3 != 96) : (v2 * a1[1][8])));
+        {
+            int i5 = 0;
+            do {
+                v2 = (((v2 > v0) == (i4 - v3)) / 3);
+                v1 = (((i4 + v3) <= (a1[1][15] == 12)) - ((27 > a0[6]) == (i4 > a0[15])));
+                v0 = (((v3 >= v3) - (97 && i5)) <= ((48 % 7) > (v3 + v1)));
+                i5 = i5 + 1;
+            } while (i5 < 3);
+        }
+    }
+    return (((v0 && 54) - (v1 <= v0)) ? ((7 + v0) || (70 != 43)) : ((v2 || a0[9]) - (a1[3][12] * v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,148 @@
+int f0() {
+    int v0 = 83;
+    int v1 = 31;
+    int v2 = 19;
+    int v3 = 34;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v3 + a0[13]) || (47 / 1)) <= ((v1 == a1[2][1]) && (a1[1][14] % 3)));
+            v3 = (((a1[0][8] * v1) % 2) - ((61 == v3) ? (v3 >= v3) : (58 * a1[1][3])));
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v2 = (((i1 >= a0[13]) && (v3 * v1)) / 6);
+                v3 = (((v1 - 57) == (22 - v1)) > ((a0[7] ? v1 : 10) || (a1[3][4] / 6)));
+                v2 = (((a0[10] / 1) != (a0[0] != a1[1][9])) * ((a1[3][14] - i1) * (a1[1][8] ? i1 : v0)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v1 ? v1 : i2) > 87) break;
+            a0[6] = (((v2 == 72) < (a1[0][0] - a0[15])) >= ((v3 > v0) && (v1 <= a0[10])));
+            a0[3] = (((v3 ? 13 : a0[13]) ? (v0 + a0[14]) : (15 - 63)) - ((v3 && a1[0][13]) / 7));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][10] = (((a1[2][4] && v3) - (i3 - a0[3])) + ((v2 ? a1[2][2] : i2) == (v2 ? a1[3][14] : 38)));
+                    a1[1][13] = (((v1 <= i2) * (i3 < 70)) ? ((v0 ? v0 : v2) < (v0 || a0[6])) : ((68 + a1[1][6]) > (v0 <= i3)));
+                    a1[3][7] = (((a1[0][13] == i3) > (a1[3][10] % 8)) * ((i3 > a0[11]) / 1));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v0 ? v2 : 24) != (83 % 9)) ? ((i4 % 3) >= (a1[3][5] == v0)) : ((62 == 39) % 7));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v2 % 3) / 9) && ((58 <= 61) < (a1[2][7] < 49)));
+                    v2 = (((7 * 2) % 7) >= ((a0[1] == v2) - (26 <= 11)));
+                    v2 = (((90 % 9) ? (a1[0][5] > a0[6]) : (a1[3][6] * i4)) % 1);
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            v2 = (((33 <= v3) ? (a0[11] != i4) : (a1[2][7] && a1[3][14])) % 2);
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    if ((((v2 && a0[2]) != (v1 || v3)) > ((a0[6] ? v0 : v1) == (v0 != v0)))) {
+        v1 = (((64 % 9) % 9) == ((v0 <= v1) == (v0 > 9)));
+        v3 = (((84 && a0[0]) <= (46 % 1)) > ((a1[1][12] - 7) != (v0 * a0[0])));
+        a1[0][13] = (((v2 && v0) <= (v2 - v2)) ? ((v1 >= 48) ? (v3 + v2) : (v3 ? v1 : a0[6])) : ((v3 ? v2 : v2) ? (54 > v2) : (a0[2] == v1)));
+    } else {
+        v0 = (((v0 + v0) % 6) < ((v3 != v0) || (a0[1] < 24)));
+        a1[1][11] = (((v0 > v3) && (v1 >= v0)) || ((v2 + v3) * (27 < a1[1][3])));
+        v2 = (((a0[8] || v2) || (95 && 29)) && ((52 == 21) != (a0[14] ? v3 : 9)));
+    }
+    {
+        int i6 = 0;
+        do {
+            a1[3][12] = (((a0[13] && 32) != (v3 <= 26)) ? ((v3 && i6) > (v3 % 6)) : ((19 % 4) && (7 - a1[2][14])));
+            v0 = (((v2 != v0) / 9) < ((51 * v1) == (v3 > v2)));
+            for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+                v0 = (((62 || 28) && (i6 != i7)) >= ((v1 * v1) ? (v3 != v3) : (a1[2][0] >= 17)));
+                v2 = (((v3 || 76) < (v3 % 8)) != ((18 > v0) * (v0 % 9)));
+                v3 = (((i7 % 4) ? (v0 && v0) : (v3 > a0[14])) ? ((85 < 81) != (73 == 22)) : ((a1[3][14] > v0) * (a1[3][7] != i7)));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    return (((18 + v0) == (24 % 1)) >= ((v2 != v3) ? (v0 ? v0 : v0) : (61 < a0[3])));
+}
+int f1() {
+    int v0 = 93;
+    int v1 = 50;
+    int v2 = 87;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    if ((((54 ? v3 : v3) + (v2 % 8)) != ((a0[4] <= 30) / 2))) {
+        v3 = (((89 || a0[4]) / 9) < ((v1 && v3) < (v1 || v3)));
+        v1 = (((a0[1] ? 63 : v2) > (90 - 1)) || ((a1[0][4] ? a1[0][5] : v2) / 1));
+        a1[2][2] = (((v2 || 83) + (v2 < 94)) || ((22 / 1) || (48 > v2)));
+    } else {
+        v2 = (((v3 / 8) < (v2 >= a0[7])) ? ((v3 && v2) != (v2 / 5)) : ((5 > 95) != (v2 + 81)));
+        v3 = (((v3 || a1[2][10]) * (60 - 6)) ? ((v3 + v0) ? (v0 || 16) : (30 == v1)) : ((a0[10] != a1[0][12]) * (v2 - a0[0])));
+        v2 = (((71 < a1[2][4]) <= (v3 * v0)) ? ((12 <= a0[4]) / 3) : ((a1[3][6] >= v0) ? (v0 && 44) : (v1 < v2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v1 >= 38) > 86) break;
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((a1[2][13] * 56) > 93) break;
+                    v3 = (((v1 > v2) == (v1 - a0[2])) - ((77 && v0) || (18 || v3)));
+                    v0 = (((v0 > a1[1][7]) > (a1[0][6] >= a0[14])) < ((a1[3][1] >= a1[3][14]) + (v0 < 71)));
+                    v0 = (((a1[1][11] / 1) >= (41 >= 35)) <= ((i1 ? 61 : v2) * (55 + i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][1] = (((i0 ? a0[13] : v3) != (a0[5] ? v2 : v3)) && ((a1[1][0] <= i0) - (v2 == v3)));
+            v0 = (((i0 ? i0 : a1[0][9]) && (v2 ? i0 : 50)) || ((v2 ? a0[15] : a1[0][0]) / 2));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((8 <= v0) * (73 / 3)) / 5)) {
+        a1[0][8] = (((v0 ? v2 : v2) < (a0[6] / 3)) <= ((a0[3] && v3) <= (v0 ? v1 : 7)));
+        v0 = (((v1 == a1[2][3]) >= (v3 < v1)) || ((v2 < 40) * (41 != v0)));
+        a1[0][9] = (((62 < v3) >= (a1[0][6] + v1)) / 9);
+    } else {
+        v2 = (((v3 != v0) / 8) || ((v2 ? v0 : a1[3][5]) + (a0[15] > a1[0][8])));
+        v1 = (((v1 ? v2 : v1) == (22 ? a0[11] : v2)) != ((v3 ? a0[13] : v1) || (5 != v2)));
+        v3 = (((v1 || v3) ? (a0[0] == 98) : (v0 ? v0 : v2)) < ((v1 > 62) >= (v0 > v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v2 >= 5) > 97) break;
+            v3 = (((88 != v2) / 2) - ((32 || 43) || (23 - v2)));
+            v1 = (((v3 - a0[5]) < (45 / 9)) < ((v2 <= v3) ? (v1 - a1[3][6]) : (v1 >= a1[3][2])));
+            {
+                int i3 = 0;
+                do {
+                    if ((a1[1][4] % 3) > 51) break;
+                    v3 = (((72 <= 71) % 7) <= ((i2 < v3) <= (v2 || a1[3][3])));
+                    v3 = (((v2 ? a0[10] : 33) % 6) ? ((a0[6] < i3) != (a0[12] < 69)) : ((9 != i3) * (v3 || v0)));
+                    a0[3] = (((v3 % 5) <= (i3 <= a1[1][11])) && ((a0[7] > v3) != (9 ? v1 : i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((a1[2][5] % 3) + (v1 * 76)) ? ((94 / 7) >= (70 ? 29 : 39)) : ((a1[1][12] / 8) > (60 || v0)));
+    return (((v2 > v1) / 2) > ((a1[0][8] * a0[7]) >= (a1[1][3] || v1)));
+}
+int main() {
+    return 0;
+}
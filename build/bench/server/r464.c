@@ -0,0 +1,213 @@
+int f0() {
+    int v0 = 38;
+    int v1 = 49;
+    int v2 = 95;
+    int v3 = 61;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a1[0][3] - a1[3][10]) ? (a0[13] - v2) : (a0[6] ? v0 : 19)) || ((i0 == v3) || (a1[3][7] >= 34)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    a1[3][13] = (((a1[1][15] ? i1 : 26) + (v3 / 4)) < ((v2 && 90) + (a0[13] - a1[2][2])));
+                    v1 = (((v1 > v3) != (i1 / 2)) ? ((35 ? v2 : 89) / 2) : ((85 - a1[0][3]) * (a0[1] || 87)));
+                    a1[0][14] = (((a1[2][13] + a0[14]) + (a1[2][10] <= 92)) < ((8 && a1[0][14]) <= (49 <= i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((v3 + a1[2][4]) != (v0 <= 88)) ? ((v2 <= 94) && (83 + a1[3][3])) : ((a1[2][3] && 88) ? (49 <= a1[2][12]) : (v2 != v1)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((a1[0][10] * v1) > (16 == v2)) - ((55 > 21) - (a0[15] / 9)))) {
+        a1[0][0] = (((v0 && v2) - (v2 * v2)) - ((a1[1][13] >= a1[0][3]) - (v3 && v3)));
+        v1 = (((v2 && 8) != (a0[14] ? a0[12] : 93)) / 7);
+        a1[2][5] = (((a0[8] < v0) && (97 > v2)) >= ((v1 ? v2 : 69) != (a0[7] || v1)));
+    } else {
+        v0 = (((a0[5] != v1) ? (v1 != v3) : (a1[0][0] != v3)) % 8);
+        v2 = (((v1 < v2) >= (a0[12] / 1)) || ((v2 && v0) ? (a0[1] && v2) : (a0[0] >= v1)));
+        a1[1][4] = (((a1[2][2] || v0) * (v1 && a0[4])) > ((a0[5] - 8) ? (v1 / 3) : (v3 / 2)));
+    }
+    if ((((v1 * v3) / 3) != ((v2 ? 12 : v3) && (v1 - a1[2][4])))) {
+        a0[3] = (((v1 && a1[3][0]) >= (a1[2][5] > a0[3])) == ((42 / 3) <= (24 % 2)));
+        a1[0][5] = (((v2 > v0) * (v1 - a0[4])) % 5);
+        v0 = (((v0 >= a0[6]) == (v2 <= v3)) > ((v0 >= 44) <= (58 < v3)));
+    } else {
+        a1[0][12] = (((31 / 5) != (95 / 9)) == ((a1[0][12] % 4) || (38 == v2)));
+        v2 = (((28 <= v2) * (v2 < v1)) % 6);
+        v1 = (((v0 - v3) / 4) == ((v2 > v2) / 2));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a0[11] = (((a0[6] > a1[0][0]) - (v0 / 8)) + ((a0[15] > i2) == (v0 && v2)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((20 && i2) % 2) - ((a0[12] && v2) * (i3 > 28)));
+                    v0 = (((95 * v3) && (46 * 73)) <= ((i3 ? v1 : 81) % 2));
+                    a1[0][3] = (((51 * 66) && (a0[13] && 56)) && ((a1[2][10] - 56) - (v3 < v3)));
+                    i3 = i3 + 1;
+                }
+            }
+            a0[5] = (((v1 <= v1) <= (v2 == v3)) / 3);
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((42 && v0) != (67 < 57)) > ((v3 > v2) ? (v3 != v3) : (v0 < v1)));
+    return (((a0[2] < 73) / 7) + ((52 * a0[3]) / 1));
+}
+int f1() {
+    int v0 = 5;
+    int v1 = 79;
+    int v2 = 95;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((32 + i0) > 96) break;
+        a1[3][6] = (((a0[13] / 7) > (v3 + v0)) == ((42 < 11) / 8));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                if ((v2 <= a0[5]) > 98) break;
+                v0 = (((a0[5] <= v1) || (a0[13] <= i0)) + ((v2 < v3) * (90 || i1)));
+                a1[0][1] = (((3 && 29) || (35 < 98)) == ((74 / 1) < (70 / 9)));
+                v2 = (((i0 && v1) - (i1 / 5)) + ((a1[0][5] + i1) % 7));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((v2 <= 12) + (v1 + v0)) - ((a0[9] - 56) - (a1[1][3] > 4)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v3 = (((94 / 9) / 8) - ((a0[11] - v1) != (v3 == a1[0][15])));
+        v3 = (((a1[3][9] && 98) * (5 > 97)) > ((i2 > 66) + (v3 * a1[0][4])));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                v1 = (((64 == 94) ? (i3 <= i3) : (a0[0] ? v2 : 48)) <= ((a1[1][3] + 66) || (a1[2][9] * v1)));
+                v2 = (((v1 ? a0[4] : i2) ? (75 ? v1 : 41) : (v3 / 1)) >= ((30 <= i2) % 7));
+                v1 = (((91 * 4) < (a1[3][2] && i3)) <= ((v0 >= 19) == (v0 + 90)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v0 ? 37 : v0) < (a0[6] + 99)) * ((v2 != 20) || (i4 * v1)));
+            v1 = (((i4 + a0[15]) + (i4 != i4)) * ((v0 * i4) > (28 >= 5)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v3 = (((53 == i5) && (i5 > v0)) ? ((i4 ? v1 : a1[1][13]) > (v2 <= i5)) : ((v2 == i5) - (62 * v3)));
+                v1 = (((99 / 8) ? (a0[2] % 1) : (57 <= v2)) * ((v0 && a0[8]) > (v0 == v3)));
+                v1 = (((30 * i4) - (v2 * v0)) >= ((a1[2][4] > v0) - (i5 >= i5)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        if ((v0 % 7) > 56) break;
+        v2 = (((35 <= 41) || (a1[3][14] != a1[2][4])) > ((10 || a0[13]) != (v1 + a0[6])));
+        a1[2][5] = (((i6 * v1) * (a0[7] + v3)) == ((a0[8] != v0) || (v2 / 6)));
+        {
+            int i7 = 0;
+            while (i7 < 3) {
+                if ((v0 <= 64) > 72) break;
+                a1[1][15] = (((a0[1] % 7) || (v1 < i7)) > ((9 != i6) && (15 * v0)));
+                v2 = (((71 || i7) < (24 - i6)) - ((i6 && 23) <= (v1 || i6)));
+                v2 = (((v3 == a1[3][6]) || (v0 % 6)) / 9);
+                i7 = i7 + 1;
+            }
+        }
+    }
+    for (int i8 = 0; i8 < 8; i8 = i8 + 1) {
+        v1 = (((v0 < 0) && (a1[1][2] > 21)) || ((28 / 9) - (45 + v3)));
+        {
+            int i9 = 0;
+            do {
+                if ((91 != i9) > 59) break;
+                a0[2] = (((v0 || i8) > (14 ? v1 : v2)) < ((64 < v1) || (v1 && 0)));
+                a1[2][9] = (((v2 && v0) + (a0[3] <= i9)) < ((9 ? v1 : a0[14]) ? (a0[15] - a1[1][2]) : (v2 || v0)));
+                v2 = (((11 - v3) % 1) * ((80 - 29) && (i8 >= v2)));
+                i9 = i9 + 1;
+            } while (i9 < 6);
+        }
+        a0[14] = (((a0[13] <= 20) < (a1[2][0] ? a0[13] : i8)) - ((17 || v2) && (85 + a0[4])));
+    }
+    return (((v1 + 39) % 5) + ((a0[12] % 9) - (v2 && v3)));
+}
+int f2() {
+    int v0 = 51;
+    int v1 = 57;
+    int v2 = 9;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[3][3] = (((a0[0] % 8) % 7) < ((a1[2][8] >= v3) && (v1 % 5)));
+            v2 = (((79 < a0[11]) ? (v0 || a0[3]) : (v1 != v0)) ? ((v3 % 1) == (0 ? 21 : v1)) : ((v3 < 13) * (86 ? 71 : a1[2][3])));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    a1[1][10] = (((75 == v0) <= (v1 ? 91 : 21)) && ((a1[3][13] <= a0[14]) == (a0[4] ? 38 : v1)));
+                    v1 = (((27 ? v1 : 27) ? (v0 - a1[1][7]) : (83 <= v1)) ? ((8 == 46) && (a1[0][7] % 6)) : ((v2 ? v2 : v0) != (v0 + v2)));
+                    a0[3] = (((48 + a1[2][8]) ? (i0 - v2) : (59 + a0[13])) % 6);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((67 * v0) > 89) break;
+        v0 = (((a0[10] ? a0[7] : v0) / 9) - ((42 != a0[5]) != (v0 % 2)));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            a0[15] = (((v2 > 81) <= (v1 ? v1 : a1[3][10])) >= ((v0 % 4) >= (a1[1][14] > a0[15])));
+            v3 = (((a1[1][12] * 73) <= (i3 > v2)) % 4);
+            a1[3][9] = (((v1 >= 27) * (a1[0][2] != v3)) >= ((31 < i3) || (i2 % 7)));
+        }
+        a0[0] = (((70 || a0[6]) && (v3 / 7)) > ((i2 || v0) && (v1 - 55)));
+    }
+    v0 = (((v1 + v0) && (v1 - a0[6])) - ((v1 >= 30) ? (a1[3][8] * v0) : (v2 ? v2 : 92)));
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v1 <= a1[1][2]) - (13 % 1)) < ((2 % 1) > (v0 * 76)));
+                    v3 = (((61 <= v2) ? (49 < a0[10]) : (a1[1][13] <= v1)) ? ((50 || v3) / 6) : ((88 ? 49 : a0[14]) + (v3 % 4)));
+                    v0 = (((44 * a0[7]) || (a1[3][14] <= 95)) < ((v1 == i5) > (a0[8] ? a0[6] : v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v2 = (((v2 / 7) - (v2 || a1[0][12])) < ((v0 > a0[9]) > (v0 != a0[13])));
+            v1 = (((a1[1][14] + a1[3][4]) % 8) + ((37 != v3) == (v0 + i4)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            if ((v0 || v0) > 75) break;
+            for (int i7 = 0; i7 < 6; i7 = i7 + 1) {
+                if ((i6 || v0) > 87) break;
+                a1[3][0] = (((a0[1] != v1) * (v1 + 1)) > ((54 || 31) < (27 && i7)));
+                v1 = (((70 == 4) > (v0 > v0)) >= ((57 + a0[6]) ? (v3 > v1) : (v1 / 5)));
+                v2 = (((a1[2][5] == i7) == (v3 ? i7 : a1[2][7])) / 2);
+            }
+            v3 = (((v1 / 1) > (v3 / 9)) && ((i6 == i6) != (a1[0][14] < v3)));
+            v2 = (((94 < a1[2][2]) <= (a1[1][10] && a0[14])) <= ((i6 - i6) || (74 < i6)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v3 <= a0[11]) - (v3 / 9)) < ((v1 <= v0) - (v1 < 66)));
+}
+int main() {
+    return 0;
+}
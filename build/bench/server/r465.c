@@ -0,0 +1,64 @@
+int f0() {
+    int v0 = 46;
+    int v1 = 5;
+    int v2 = 12;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 && a0[6]) - (v1 % 6)) ? ((a0[11] / 7) && (v0 >= v1)) : ((a0[0] && 74) > (3 ? 28 : v0)));
+    {
+        int i0 = 0;
+        do {
+            if ((60 * a1[3][0]) > 88) break;
+            v1 = (((v0 / 4) && (a0[14] ? v1 : v2)) > ((i0 && v1) * (57 + i0)));
+            v2 = (((v3 ? 94 : 3) + (37 != v3)) && ((v0 % 2) ? (v2 == a0[14]) : (v0 && a0[1])));
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[0][12] && v3) > 66) break;
+                    v3 = (((v0 + i1) ? (v0 < 98) : (a1[3][2] - v3)) ? ((v3 + 84) && (39 * 50)) : ((34 + v3) != (v0 == a1[2][1])));
+                    a0[6] = (((v2 + a0[14]) || (92 <= v3)) + ((v1 && a0[6]) > (18 ? v1 : a0[4])));
+                    a0[9] = (((14 != a1[0][14]) - (a0[14] - v3)) / 7);
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            if ((4 != 65) > 64) break;
+            v2 = (((v3 + i2) / 4) ? ((i2 + a1[3][3]) >= (v0 > a1[1][0])) : ((41 && 97) % 7));
+            v0 = (((v0 % 4) + (v3 > v3)) + ((a1[0][2] ? v1 : v0) + (34 + v0)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a0[1] < 57) <= (v3 % 6)) > ((42 ? i2 : v2) < (v2 && i3)));
+                    v3 = (((a0[3] && a0[13]) <= (v3 == i2)) || ((a0[10] > 16) >= (80 != 92)));
+                    a0[1] = (((v0 / 5) && (i3 % 7)) % 7);
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v2 = (((i4 * 59) < (62 * v0)) + ((a1[0][5] > 73) == (99 + v0)));
+                v3 = (((38 > i5) > (a1[2][7] * i5)) ? ((9 != v0) == (i5 == i5)) : ((i5 || v0) == (v3 <= a1[2][11])));
+                v0 = (((v3 * i5) * (99 % 1)) - ((v0 >= v3) < (v1 && v3)));
+            }
+            v0 = (((a1[1][2] ? 24 : i4) || (i4 * 45)) >= ((a1[1][10] != v0) == (v0 < i4)));
+            v1 = (((v2 >= v2) * (v0 - v3)) + ((57 && a1[2][12]) >= (v2 / 1)));
+            i4 = i4 + 1;
+        }
+    }
+    a0[13] = (((95 / 2) + (2 / 8)) / 4);
+    return (((v2 - 90) % 8) < ((v2 <= v0) >= (v2 || v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,120 @@
+int f0() {
+    int v0 = 5;
+    int v1 = 42;
+    int v2 = 68;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    a0[13] = (((v3 ? a1[2][7] : v1) > (v1 || v1)) ? ((24 <= 97) ? (a0[8] % 4) : (v0 >= v2)) : ((v2 + v3) || (60 == v0)));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v1 = (((v2 ? v3 : v1) * (a0[7] < v1)) > ((a0[2] < v0) >= (v3 <= v2)));
+            v2 = (((v2 && i0) + (64 == 95)) ? ((v3 + v1) * (97 / 4)) : ((v3 > v1) % 3));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v1 = (((i0 != a0[0]) + (i0 == 42)) >= ((v0 > i1) % 1));
+                    a0[7] = (((a1[3][14] / 6) < (a0[6] > 20)) || ((v0 % 8) < (71 && 2)));
+                    v3 = (((i1 < 80) > (v1 != a1[3][15])) && ((i1 + 2) != (i1 / 6)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v2 = (((a1[1][1] % 2) % 4) + ((v1 || v3) * (v1 <= 78)));
+            a1[0][14] = (((a0[4] || 78) ? (24 + v0) : (a0[9] / 6)) / 1);
+            {
+                int i3 = 0;
+                do {
+                    a1[2][14] = (((v3 ? 28 : a1[3][4]) * (v3 && v1)) ? ((a1[0][14] >= 38) ? (v0 >= a0[10]) : (i2 % 5)) : ((i2 > i2) < (a1[0][0] <= a0[8])));
+                    a1[1][15] = (((i3 != 49) / 5) && ((i3 == i2) + (v2 > i3)));
+                    v2 = (((30 <= i3) >= (a0[1] == 36)) ? ((v3 - v2) <= (v2 || 58)) : ((a0[6] != 65) ? (a1[1][6] / 6) : (i2 + a1[0][9])));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[5] / 7) >= (v1 >= a1[3][13])) % 8)) {
+        v0 = (((52 && a0[14]) < (v2 > 90)) || ((75 == v3) && (v2 >= v0)));
+        v0 = (((a1[2][2] >= 42) / 7) >= ((a1[1][15] && 54) ? (57 <= 54) : (88 + v2)));
+        v3 = (((v0 == a0[5]) != (a0[4] - a0[3])) + ((v0 || v0) * (v3 <= v0)));
+    } else {
+        a1[1][4] = (((a0[5] <= v0) ? (v3 || v2) : (a0[14] * 28)) / 6);
+        v1 = (((v2 <= 79) ? (a1[1][14] ? v3 : v1) : (a1[3][10] - a0[9])) ? ((27 > a0[15]) ? (v0 ? 55 : 96) : (40 ? v2 : 59)) : ((87 * a1[3][12]) && (a1[0][11] == v1)));
+        a1[2][7] = (((a1[3][0] + 57) < (v3 >= v3)) > ((94 <= 35) > (a1[0][14] <= v1)));
+    }
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v3 = (((82 * 25) && (v1 >= i4)) <= ((99 || a0[0]) <= (a1[1][1] >= 24)));
+                v3 = (((i5 * v2) <= (v3 != a0[3])) ? ((i5 / 1) ? (v0 != i5) : (v0 % 2)) : ((v2 && 78) * (a1[1][9] ? v1 : a1[0][1])));
+                v0 = (((a1[1][6] < v3) > (a0[9] / 7)) * ((v3 != v0) % 3));
+            }
+            v3 = (((62 + 51) == (18 && 45)) || ((a0[3] + a1[0][0]) < (v0 ? v1 : 34)));
+            v3 = (((v0 != i4) ? (v1 ? v3 : 92) : (50 < 87)) > ((v1 || v0) || (i4 - a0[9])));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((4 ? v0 : 98) / 6) % 5);
+}
+int f1() {
+    int v0 = 75;
+    int v1 = 73;
+    int v2 = 50;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v3 - v2) * (a0[9] || v1)) <= ((v1 % 7) + (v0 != a0[9])));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v3 = (((v0 != v1) % 7) && ((i0 / 4) > (v0 % 5)));
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            a0[10] = (((a1[1][7] == v0) > (a0[11] * 17)) <= ((46 || i0) * (i0 % 8)));
+            v3 = (((i0 - 36) - (a1[3][15] >= i1)) > ((i1 - v0) && (i1 < v1)));
+            a0[9] = (((a1[0][6] - a0[15]) >= (v0 * v2)) < ((a0[1] >= 88) + (59 % 3)));
+        }
+        v3 = (((v3 <= a0[10]) && (40 - a1[1][8])) - ((v1 < v0) != (v0 <= 64)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((a1[2][10] <= v3) > 72) break;
+                a1[3][3] = (((84 % 7) / 4) + ((a1[0][8] % 2) < (a0[1] && 73)));
+                v2 = (((94 == i3) <= (i3 ? v1 : a0[6])) && ((89 || a0[8]) - (i2 * i3)));
+                v1 = (((v2 - a0[0]) ? (28 + v1) : (9 == 91)) - ((a1[2][10] && a0[7]) - (56 - v3)));
+            }
+            v1 = (((47 ? a1[1][1] : a0[5]) <= (27 > a0[3])) * ((i2 >= v3) == (v0 != i2)));
+            v0 = (((a1[1][11] >= 83) + (a0[6] / 8)) + ((a0[5] / 1) - (v0 + 85)));
+            i2 = i2 + 1;
+        }
+    }
+    a0[11] = (((v2 + 79) ? (92 ? a1[1][8] : v2) : (3 / 8)) ? ((96 < 78) || (a1[1][12] < v3)) : ((0 % 7) > (v1 ? v2 : v3)));
+    {
+        int i4 = 0;
+        do {
+            a1[1][5] = (((70 * v1) == (v2 <= v1)) < ((76 != v0) + (v3 && v1)));
+            a1[1][7] = (((i4 - v1) ? (v3 != v3) : (a0[12] % 3)) ? ((a1[2][1] % 8) * (i4 == v1)) : ((77 - 17) - (a0[10] > v1)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((v1 - a0[4]) || (77 / 9)) ? ((v0 - a0[2]) || (i5 % 5)) : ((i4 <= 97) + (v0 / 1)));
+                    v2 = (((a0[2] * v3) >= (i4 - i4)) <= ((v2 >= v1) ? (v0 + v1) : (a1[3][9] != a0[5])));
+                    v0 = (((i4 / 2) > (90 != v2)) != ((55 <= v3) < (52 == v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    return (((a0[15] || a0[14]) > (v1 && a0[7])) <= ((a0[5] != v1) != (a1[3][10] && v2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,179 @@
+int f0() {
+    int v0 = 57;
+    int v1 = 52;
+    int v2 = 79;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v2 - v3) && (v0 + v0)) / 7);
+    a0[5] = (((v1 > v1) - (a0[15] || 37)) != ((1 < v0) == (76 >= v1)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((v2 - v0) > 82) break;
+        v2 = (((v3 >= v1) < (v0 >= i0)) < ((i0 || 21) < (i0 < i0)));
+        v3 = (((v3 < 67) * (v2 ? i0 : 20)) / 7);
+        for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+            if ((a1[2][14] < i0) > 54) break;
+            v0 = (((v2 && a1[2][9]) * (44 * v0)) ? ((a0[5] > a1[1][13]) && (i0 || v2)) : ((v2 - a1[0][6]) / 3));
+            a0[4] = (((a0[4] % 5) >= (v1 >= i1)) >= ((85 < i1) / 4));
+            v0 = (((i1 == v0) ? (i0 - v3) : (v1 || v1)) <= ((v3 < a0[4]) && (v1 / 7)));
+        }
+    }
+    v0 = (((86 < 0) == (v2 != a0[4])) || ((v3 + v0) < (v0 ? a0[1] : a1[1][15])));
+    {
+        int i2 = 0;
+        do {
+            a0[6] = (((88 > i2) != (a0[14] ? v0 : i2)) / 2);
+            v2 = (((9 > a1[0][4]) >= (i2 && 90)) ? ((v1 * v2) / 1) : ((v3 + v1) < (a0[13] >= v1)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                v2 = (((a0[8] < i2) - (i2 > 17)) / 1);
+                v3 = (((v2 * i3) > (78 % 6)) > ((42 == 34) ? (v1 || i3) : (26 + v2)));
+                v3 = (((94 % 5) || (v2 || v0)) % 2);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((27 ? v2 : a1[3][10]) < (v1 - a0[6])) * ((v3 ? 8 : v3) - (42 - v1)));
+}
+int f1() {
+    int v0 = 55;
+    int v1 = 19;
+    int v2 = 42;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v3 < 3) >= (a1[0][15] % 8)) / 3);
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a0[4] = (((71 / 8) >= (37 <= i0)) * ((91 != a0[14]) < (i1 >= v1)));
+                    v2 = (((i0 / 6) + (v1 >= 39)) > ((i1 ? 36 : a0[13]) / 3));
+                    v2 = (((v0 * i0) && (v3 % 5)) + ((v0 * i1) < (v3 ? a1[3][4] : 48)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[15] = (((v1 >= 57) && (a1[2][8] / 4)) * ((77 / 3) || (a1[2][0] <= a1[2][4])));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v1 = (((v2 + a0[8]) && (i2 < 23)) + ((v0 - v2) > (v3 ? a0[4] : 73)));
+            a1[1][9] = (((v2 > 79) % 6) + ((a0[11] && a1[2][10]) / 4));
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    a0[15] = (((59 == i3) || (v3 ? v0 : v1)) || ((v2 != a0[1]) != (24 > v1)));
+                    v2 = (((a0[6] - 18) < (a0[3] >= i2)) == ((34 == i2) ? (v0 || v1) : (30 < 32)));
+                    v2 = (((47 ? a0[5] : 37) && (a0[2] % 7)) ? ((a1[1][15] * 61) + (v1 / 5)) : ((69 % 8) % 8));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((v3 < v0) <= (a1[1][12] + a0[6])) ? ((v2 % 2) != (30 ? 47 : a0[9])) : ((v0 ? v2 : v2) / 6));
+    {
+        int i4 = 0;
+        do {
+            if ((52 % 3) > 88) break;
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                v0 = (((v2 ? 41 : i4) / 3) > ((v2 <= a1[1][11]) ? (a1[2][9] && 62) : (i4 >= v1)));
+                a0[1] = (((v1 != a1[3][10]) - (i4 ? v3 : 89)) < ((89 % 9) == (i5 || i4)));
+                v2 = (((v3 * 1) != (34 == i4)) ? ((i4 != i4) % 6) : ((20 - a0[1]) <= (a1[1][11] % 3)));
+            }
+            a0[2] = (((v3 + 83) + (16 <= 70)) - ((v2 <= a1[2][11]) ? (82 == v3) : (i4 ? a0[8] : 17)));
+            v2 = (((i4 / 4) >= (v3 <= 67)) != ((12 + v0) == (v0 != v2)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    for (int i6 = 0; i6 < 3; i6 = i6 + 1) {
+        v1 = (((a0[15] || i6) ? (69 - i6) : (i6 % 2)) * ((38 || a0[15]) > (29 <= 92)));
+        for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+            a0[11] = (((v2 * a1[2][1]) >= (v0 && a0[6])) <= ((99 <= a0[7]) % 4));
+            v2 = (((v2 == v1) % 2) || ((v2 >= 87) / 7));
+            v2 = (((i7 ? 60 : a0[4]) / 2) - ((v3 >= v0) == (24 + 32)));
+        }
+        v0 = (((v0 / 9) ? (v3 ? a1[2][1] : v3) : (i6 ? a0[2] : a1[0][10])) || ((a0[10] || a0[10]) || (21 || v0)));
+    }
+    return (((a1[2][9] ? a0[0] : v0) ? (v2 + 71) : (v1 <= v3)) > ((a0[11] * a0[11]) / 1));
+}
+int f2() {
+    int v0 = 64;
+    int v1 = 8;
+    int v2 = 52;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 ? v0 : v2) && (a1[2][10] * a0[12])) < ((a0[9] != v1) >= (9 < v0)))) {
+        v2 = (((v0 < v0) == (a0[8] / 7)) ? ((60 < v1) <= (v2 % 2)) : ((a1[3][6] < 74) <= (93 ? 4 : a0[11])));
+        a1[0][13] = (((v3 == v2) * (78 - v1)) == ((v0 ? 59 : 61) % 8));
+        v2 = (((v3 && 64) == (a0[10] + 98)) == ((v0 ? a0[11] : v0) && (v1 > v3)));
+    } else {
+        v2 = (((a0[9] >= a1[2][10]) ? (v3 < a1[3][1]) : (v3 && 40)) * ((34 - v2) || (8 < 98)));
+        v0 = (((a1[3][4] && v1) - (v3 > v3)) || ((a0[4] != v3) / 9));
+        v3 = (((a0[7] == 72) || (37 ? 6 : 74)) > ((a1[0][0] || v0) / 7));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((51 > 83) > 75) break;
+            v2 = (((3 % 3) > (v1 - v2)) - ((v3 > v1) < (99 ? a1[1][15] : a1[1][14])));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a1[2][0] = (((i0 || 31) - (v1 ? v1 : v1)) > ((a1[1][3] > i1) + (v0 + a0[9])));
+                    a0[15] = (((42 * v3) || (v2 ? a1[1][13] : v1)) <= ((74 <= v3) <= (a0[5] == i0)));
+                    a0[14] = (((v2 - i0) / 6) == ((a1[3][3] < i1) / 6));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v2 * 51) > (v0 == i0)) > ((32 || 47) ? (81 || v3) : (v1 ? a1[2][10] : i0)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((81 - v1) > 82) break;
+        a1[1][14] = (((i2 != v0) != (30 && 80)) + ((v1 + i2) == (i2 < v0)));
+        a0[10] = (((v3 && i2) + (57 != v2)) >= ((v0 >= 52) != (a0[0] == 69)));
+        {
+            int i3 = 0;
+            do {
+                if ((16 - v3) > 88) break;
+                v0 = (((i3 && a0[0]) < (i2 && 40)) == ((v2 && v2) >= (i3 && i2)));
+                v3 = (((41 || v3) && (11 ? i2 : v2)) > ((v0 < v2) * (i2 < i2)));
+                v3 = (((a1[0][0] == v3) <= (v0 + a0[1])) <= ((5 ? 68 : a0[13]) / 2));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                a0[9] = (((v3 * 41) > (76 <= 29)) == ((v3 - a0[1]) < (v0 ? a1[3][11] : a1[2][2])));
+                v0 = (((i5 || a1[2][11]) % 3) != ((81 >= v2) == (v3 >= i5)));
+                a0[13] = (((37 != i4) <= (i5 * v2)) % 2);
+                i5 = i5 + 1;
+            }
+        }
+        a0[14] = (((95 > 93) || (65 && v1)) ? ((28 - v2) == (a0[15] % 7)) : ((v1 + v0) && (a0[0] <= a1[0][8])));
+        v2 = (((44 ? a0[2] : 20) / 8) ? ((v1 / 6) != (8 * v3)) : ((86 / 4) != (a0[5] * v2)));
+    }
+    if ((((v0 >= a0[11]) ? (a1[3][7] < v2) : (25 ? v2 : v2)) >= ((v0 == 23) < (30 % 2)))) {
+        v1 = (((61 * v2) || (v1 ? v2 : v1)) == ((a0[6] && v3) <= (v1 <= v2)));
+        v2 = (((v0 <= v1) || (75 ? 62 : a1[1][2])) || ((a0[10] / 2) != (v3 != v0)));
+        v1 = (((83 / 4) * (a1[0][13] / 6)) < ((v3 < a0[14]) > (v1 > v3)));
+    } else {
+        v2 = (((v0 - 20) > (a0[11] - 11)) * ((v2 + 69) * (67 / 4)));
+        a1[0][14] = (((a1[1][5] * a1[0][10]) >= (a1[2][8] + v0)) / 4);
+        v0 = (((57 - a0[14]) >= (45 ? a0[13] : v3)) + ((a1[0][10] ? v2 : v3) > (70 >= a0[6])));
+    }
+    return (((37 + a0[5]) || (a1[1][1] >= a1[1][4])) ? ((v3 + v2) && (a0[12] == v1)) : ((52 % 6) / 8));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,59 @@
+int f0() {
+    int v0 = 73;
+    int v1 = 27;
+    int v2 = 63;
+    int v3 = 52;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v2 == a1[0][2]) > 63) break;
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v2 = (((a0[0] * i0) <= (v2 != 96)) + ((v1 % 9) != (a1[0][8] - a0[4])));
+                v3 = (((i1 - v1) / 3) <= ((a1[0][12] / 5) / 8));
+                a0[4] = (((a1[2][4] != 49) || (i1 - 67)) % 7);
+            }
+            v0 = (((v2 / 9) ? (i0 || a1[3][5]) : (v2 && v2)) / 1);
+            a0[12] = (((a1[0][7] && v2) > (i0 ? a0[3] : v0)) ? ((v2 == 84) ? (v2 ? 13 : 49) : (v1 != a0[2])) : ((v1 && v0) - (64 % 5)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v2 = (((v1 - v3) == (a0[10] % 7)) || ((a1[1][3] * v3) % 5));
+        v0 = (((81 % 2) ? (v3 / 2) : (v3 < i2)) * ((54 % 1) * (16 - a1[1][9])));
+        for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+            a0[0] = (((v3 + 56) || (a1[1][9] % 4)) > ((i3 == i3) || (39 <= 54)));
+            a1[0][9] = (((v3 && a1[1][12]) == (a0[10] * v1)) % 6);
+            v1 = (((a1[3][0] >= a1[1][14]) ? (67 ? i2 : v2) : (3 / 4)) <= ((v2 * a1[2][9]) >= (a1[1][14] < a0[12])));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((v2 || v0) ? (v2 >= v3) : (a1[2][11] / 9)) <= ((a0[6] || 9) && (a1[0][12] ? v2 : v0)));
+            v3 = (((72 ? v3 : v2) + (0 + a0[6])) ? ((a1[3][0] ? 98 : i4) + (v2 != 93)) : ((v1 % 6) > (a1[3][4] + 60)));
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                if ((4 <= v3) > 75) break;
+                a0[11] = (((i4 != i4) >= (v2 || a1[3][8])) != ((v1 * 20) >= (83 % 6)));
+                a1[2][15] = (((a1[3][8] <= 81) || (a0[0] / 4)) ? ((25 >= a0[4]) - (v2 < i5)) : ((a1[2][4] <= v0) != (v3 ? i4 : i5)));
+                v1 = (((35 > 84) && (i4 ? 62 : a1[3][1])) >= ((v0 && v0) / 8));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    v0 = (((a0[5] && v2) ? (v2 + v0) : (v0 <= 62)) < ((v2 <= v3) < (57 > v3)));
+    if ((((a1[3][7] % 5) || (v3 / 2)) + ((14 || 80) >= (a0[0] + v0)))) {
+        v1 = (((v0 - v0) + (v3 == v0)) && ((a1[2][2] < v1) - (v2 + v0)));
+        v2 = (((v1 - v1) > (v0 / 7)) ? ((v1 * v1) > (v0 * v0)) : ((a0[11] != 31) != (28 >= v0)));
+        v1 = (((v1 < v1) ? (v1 != a0[13]) : (a1[1][2] * a0[1])) * ((v3 || v1) >= (4 || 88)));
+    } else {
+        a1[1][4] = (((v0 != a1[0][9]) >= (28 != v0)) == ((v0 > a1[3][5]) + (v2 || 57)));
+        v0 = (((a0[11] && v2) - (v1 < a1[0][0])) && ((80 * a1[1][0]) || (v3 - 84)));
+        v3 = (((a0[7] > 82) < (v0 == v0)) * ((v2 <= v2) || (a0[9] || 96)));
+    }
+    return (((a1[3][5] < v0) < (v3 > v1)) ? ((21 < a1[2][8]) ? (28 / 6) : (v1 > v3)) : ((19 >= a0[13]) - (a0[4] <= a1[1][10])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,124 @@
+int f0() {
+    int v0 = 40;
+    int v1 = 29;
+    int v2 = 49;
+    int v3 = 15;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[6] = (((i0 ? a1[1][15] : a0[9]) < (v0 - 83)) % 9);
+            v2 = (((v1 && v1) ? (i0 > v3) : (a1[0][10] && v0)) / 6);
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a1[1][9] = (((v3 == v3) * (a0[5] / 3)) * ((86 != a0[6]) > (77 < i0)));
+                    v0 = (((v2 / 7) > (v1 && 99)) / 6);
+                    v2 = (((72 * 18) > (a1[3][12] ? v2 : a1[0][13])) == ((a0[11] + 43) + (v2 / 1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((56 + 87) + (a0[11] == v0)) - ((v0 == v2) - (v1 / 8)))) {
+        a0[14] = (((65 >= v3) - (v0 < v3)) - ((74 != v2) && (a1[3][3] > v0)));
+        a1[0][3] = (((v0 || a1[1][2]) - (v3 >= 22)) % 9);
+        v2 = (((57 + a0[11]) * (49 >= v1)) <= ((98 / 5) + (a0[7] || 97)));
+    } else {
+        v0 = (((v3 / 7) || (v0 ? v3 : a1[3][5])) / 3);
+        v3 = (((v0 > 27) <= (v1 != v2)) ? ((v1 == v3) == (a1[3][6] && a1[3][11])) : ((a1[2][9] < 66) - (v1 || v0)));
+        a1[1][5] = (((61 * a1[0][12]) + (v3 * a1[0][8])) || ((36 / 1) * (v0 ? v1 : a0[5])));
+    }
+    v1 = (((v1 > a1[2][12]) - (v0 / 3)) || ((v3 - v0) <= (a1[3][10] * 95)));
+    v3 = (((v3 < v2) > (v1 >= v0)) != ((v0 ? a1[2][0] : a0[2]) != (a1[0][14] || v2)));
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v0 = (((a1[2][2] + i2) % 8) - ((20 - 52) == (a0[4] ? v0 : a0[8])));
+        v2 = (((v3 ? v3 : v2) <= (a0[9] % 3)) >= ((77 || a1[0][5]) + (v2 != 47)));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v3 = (((a0[11] + a0[11]) % 5) <= ((a0[2] - v0) < (71 <= v2)));
+                v2 = (((a1[0][3] % 8) <= (v1 != v3)) ? ((v0 * i3) < (v2 >= a0[14])) : ((97 == 15) || (11 / 2)));
+                v3 = (((i2 && a1[3][15]) + (v0 ? a0[11] : a0[4])) ? ((65 == a1[3][14]) >= (v3 && v1)) : ((i3 / 5) + (a1[1][1] == v3)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    return (((v1 ? 39 : v0) % 5) != ((a1[3][10] * v1) || (v2 >= v3)));
+}
+int f1() {
+    int v0 = 65;
+    int v1 = 10;
+    int v2 = 72;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 >= v1) <= (v3 + v2)) ? ((v1 % 3) / 9) : ((64 || 63) % 9))) {
+        v1 = (((7 ? v1 : v3) / 6) ? ((62 <= v0) == (v2 && a0[5])) : ((v1 || a0[4]) <= (18 > 56)));
+        a0[8] = (((8 > 6) || (a1[1][14] != a1[3][6])) ? ((v0 == 57) - (a0[12] <= 2)) : ((v2 * v2) > (v0 != v1)));
+        v3 = (((a0[6] > 76) % 4) > ((v0 + v1) <= (v0 == v1)));
+    } else {
+        a0[8] = (((v0 % 1) % 4) != ((a0[12] || v0) >= (v3 == v1)));
+        v1 = (((a1[0][15] ? a0[4] : v2) || (39 == v0)) >= ((v3 % 2) <= (56 + v3)));
+        v3 = (((v2 - v3) ? (68 >= v0) : (17 ? a0[10] : 8)) > ((v2 >= 86) == (v2 ? v3 : a1[2][9])));
+    }
+    if ((((v1 % 1) <= (69 > v0)) == ((48 ? v0 : a0[0]) < (v3 && v0)))) {
+        v1 = (((v0 < v0) > (v3 >= a0[15])) * ((v2 ? v0 : a0[5]) < (a0[2] > v3)));
+        v2 = (((17 < v2) % 3) <= ((77 ? 28 : a1[1][14]) / 2));
+        v2 = (((a0[4] / 3) ? (v1 * 26) : (v0 != v2)) - ((34 ? v1 : v0) != (0 && a0[1])));
+    } else {
+        a1[0][11] = (((a0[12] != v0) > (a1[3][5] > v3)) && ((v3 < v0) == (v3 + v0)));
+        v1 = (((v0 >= v2) >= (v3 < 93)) - ((54 && v2) != (v0 == 14)));
+        v1 = (((v1 % 9) <= (v2 * a1[1][15])) / 4);
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v3 = (((31 >= a0[8]) ? (a1[1][0] > a0[5]) : (v3 % 4)) || ((i0 || i0) > (v0 - v2)));
+        v2 = (((a1[2][14] <= 44) * (v3 % 3)) % 8);
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                a0[15] = (((i0 * v3) >= (71 && v1)) * ((i1 && a0[3]) > (i1 <= v2)));
+                v0 = (((v2 % 7) > (a0[8] && a1[3][0])) / 6);
+                v2 = (((a1[1][12] ? a1[1][12] : 6) <= (v3 >= i0)) % 7);
+                i1 = i1 + 1;
+            }
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[11] = (((16 < 32) < (a1[2][11] && 41)) != ((v0 != v0) < (a0[10] ? a1[2][2] : 71)));
+        v1 = (((a1[2][9] < i2) <= (v3 > v3)) >= ((v1 == v0) * (v1 && 78)));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((46 != i2) == (v1 && a0[14])) || ((i3 == i2) <= (v3 > v2)));
+                v2 = (((i3 / 5) ? (66 >= i2) : (v1 + v1)) || ((v2 ? v3 : 81) == (i3 && i3)));
+                v2 = (((a0[11] / 4) == (i2 || a0[12])) / 5);
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v3 < v2) > 85) break;
+            a0[12] = (((95 < v1) * (a1[3][8] >= a0[7])) % 2);
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v3 > v1) && (31 || a0[3])) <= ((i4 ? 1 : v1) && (63 * v1)));
+                    v2 = (((a0[15] % 7) - (v3 * v2)) != ((v0 && a0[12]) <= (v3 >= 3)));
+                    a1[2][13] = (((v2 != v1) * (a0[1] * v2)) && ((98 <= 26) % 3));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            v0 = (((v1 ? 19 : a0[3]) >= (91 && a1[3][9])) < ((v2 % 6) < (v2 % 2)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((a1[0][9] / 1) / 5) * ((v3 * v1) || (v2 / 2)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,174 @@
+int f0() {
+    int v0 = 28;
+    int v1 = 11;
+    int v2 = 33;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((58 - v2) > (a0[15] % 2)) ? ((v0 < v2) != (v2 * a0[2])) : ((v0 < 41) == (v2 / 5)));
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v1 = (((v1 != 25) || (v1 % 1)) + ((v1 < v3) || (v0 >= a1[1][12])));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                v1 = (((v0 <= 90) - (83 >= v0)) * ((a1[3][14] == i0) + (68 % 8)));
+                a1[3][5] = (((v1 ? a0[11] : i1) / 6) + ((53 ? 62 : 11) || (v2 || 96)));
+                a1[0][11] = (((a0[7] != 35) % 6) > ((v2 <= a0[9]) ? (48 * 75) : (38 ? a1[3][12] : v3)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[2][10] = (((v1 ? v3 : v1) <= (v2 <= v2)) + ((v0 == 69) ? (a0[11] == 53) : (i0 - v3)));
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a1[2][12] = (((a1[0][7] - v2) ? (a1[1][3] % 9) : (v3 == a0[6])) ? ((a0[4] <= 70) + (41 > a1[3][11])) : ((v3 / 3) > (v2 + v2)));
+        v1 = (((11 == a0[5]) * (a1[2][2] <= v0)) <= ((9 < v3) < (v1 < 50)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a1[2][9] = (((a1[0][13] <= a1[1][11]) == (v0 ? i3 : v2)) <= ((v1 || 71) > (v2 ? v1 : a0[15])));
+            a1[1][5] = (((v0 ? i3 : 9) >= (84 <= v3)) ? ((68 < i2) - (33 != 94)) : ((19 % 2) + (a1[0][14] / 3)));
+            v1 = (((a1[2][5] ? i3 : i2) + (v2 <= a1[3][7])) || ((v0 >= a1[2][12]) <= (v1 % 9)));
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a1[0][13] - a0[9]) ? (v3 <= a1[3][15]) : (v2 <= 58)) < ((v0 / 9) + (a0[9] ? v0 : v3)));
+            {
+                int i5 = 0;
+                do {
+                    a1[1][12] = (((i4 % 2) / 2) || ((38 != v3) > (8 / 6)));
+                    v1 = (((2 % 1) > (v1 * v2)) ? ((v1 / 5) + (v3 <= v3)) : ((66 <= a1[3][14]) % 2));
+                    v0 = (((a0[13] && 1) <= (58 / 5)) < ((v0 <= i5) ? (i5 || 33) : (i5 / 6)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v3 = (((v1 <= v2) <= (v0 > a1[0][6])) && ((78 >= v1) / 6));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v3 = (((a1[1][15] > 71) % 9) > ((a1[3][0] * v2) ? (v2 + v2) : (v0 == a0[9])));
+    return (((v1 != 82) ? (v2 == a1[0][3]) : (20 - v2)) != ((v2 < a0[12]) <= (v1 == v1)));
+}
+int f1() {
+    int v0 = 45;
+    int v1 = 66;
+    int v2 = 71;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a0[10] * v3) > 54) break;
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v1 = (((v0 / 5) % 4) * ((i0 / 6) - (80 > i0)));
+                    v1 = (((v2 || v0) % 5) || ((a1[0][8] * 97) ? (v3 || i1) : (v2 != v0)));
+                    a1[3][7] = (((v3 <= 80) && (19 || 98)) < ((0 ? i0 : 41) + (a0[11] >= v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a1[1][7] ? i0 : v1) || (v1 != i0)) || ((a1[1][12] - v0) > (17 + i0)));
+            v1 = (((i0 <= i0) && (a0[13] > i0)) - ((a1[0][6] || v3) >= (5 && 80)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v1 = (((33 ? v2 : 18) ? (v2 / 1) : (v1 > 57)) < ((v3 / 2) == (v2 / 2)));
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v2 % 8) + (v0 / 2)) % 5);
+            {
+                int i3 = 0;
+                do {
+                    a1[1][9] = (((i3 ? 89 : v0) != (v0 < a1[1][15])) ? ((v2 == 28) <= (v3 < v2)) : ((a1[1][8] * a0[10]) <= (87 < a1[3][7])));
+                    v0 = (((v2 != a0[10]) % 9) ? ((a0[0] != a1[3][9]) / 4) : ((52 == 4) || (i3 == a1[1][8])));
+                    a0[14] = (((a0[2] - v1) || (85 + v2)) ? ((v3 >= v3) < (a0[10] ? a1[3][11] : v2)) : ((a1[1][9] || 1) && (i3 * 8)));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v1 = (((i2 > v2) ? (v1 <= v1) : (v1 == v0)) * ((70 % 4) < (a1[2][2] == v2)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v2 % 2) <= (v0 / 6)) / 1)) {
+        a1[2][2] = (((35 && 92) ? (v3 != v1) : (v0 || v0)) * ((v2 <= v2) + (a1[1][10] == v0)));
+        a0[0] = (((0 == v0) && (a0[4] / 4)) + ((v0 && v0) ? (v1 >= 59) : (a1[1][9] / 7)));
+        a0[12] = (((v1 || v2) && (v2 != 54)) > ((37 != v2) > (19 + v2)));
+    } else {
+        v3 = (((v3 && v0) > (v1 + 41)) == ((v2 || a1[3][2]) || (a1[1][10] - a0[5])));
+        v2 = (((94 && v2) + (v3 * v3)) && ((v3 || 82) > (v1 * v0)));
+        v2 = (((v2 <= v1) >= (v0 ? v3 : 27)) == ((a0[2] ? v3 : a1[2][12]) && (v0 ? v0 : v0)));
+    }
+    v3 = (((v2 - 37) <= (a1[1][0] < a1[0][3])) % 6);
+    return (((a0[9] == v0) >= (a0[7] % 8)) * ((v2 <= 6) ? (v2 != a0[6]) : (a0[6] + a1[1][9])));
+}
+int f2() {
+    int v0 = 66;
+    int v1 = 97;
+    int v2 = 19;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][4] * v1) < (v0 > a1[2][13])) <= ((v3 ? 85 : a0[2]) / 9))) {
+        v0 = (((v0 != a1[0][3]) ? (a1[2][3] ? v0 : v2) : (v1 == v3)) / 3);
+        v1 = (((v0 != a1[2][0]) + (74 ? a1[1][14] : v3)) && ((10 + 51) <= (v0 ? v3 : 77)));
+        a1[2][5] = (((v2 / 2) / 3) >= ((a0[11] != v1) >= (89 - a1[2][5])));
+    } else {
+        v0 = (((a1[0][5] % 9) >= (v0 / 3)) < ((v0 * v0) ? (v2 * 83) : (a1[3][14] ? a0[12] : v1)));
+        v3 = (((v2 / 5) < (v0 ? v1 : v0)) && ((v1 != v1) || (44 - 56)));
+        a1[2][5] = (((59 > v0) - (v1 <= 89)) ? ((62 % 2) && (v3 || 1)) : ((27 && a0[4]) == (v1 >= v1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v2 = (((a1[3][14] * 55) < (v2 > 91)) != ((v1 <= a0[12]) * (v2 <= 0)));
+            a0[6] = (((v1 - v0) ? (v3 || v3) : (28 ? 78 : v2)) - ((90 || 61) <= (a0[12] || v3)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a1[0][2] = (((a0[11] ? a1[0][1] : 1) + (99 ? i1 : 44)) && ((v1 != 18) ? (i0 - v1) : (38 >= a0[10])));
+                    a0[9] = (((v1 / 5) * (v3 - i0)) && ((v1 ? a1[0][10] : v2) ? (v0 && v2) : (14 ? a0[7] : 72)));
+                    a1[0][9] = (((76 >= v2) + (67 ? v3 : a0[11])) ? ((71 > v3) / 8) : ((i1 != i1) <= (31 % 5)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    a1[3][13] = (((v0 > 5) + (18 + v3)) ? ((v0 / 8) == (13 - v1)) : ((v1 % 2) <= (a1[3][14] ? 9 : a0[6])));
+    {
+        int i2 = 0;
+        do {
+            v3 = (((16 * v2) < (41 ? a1[2][0] : v0)) != ((v3 ? a0[15] : v3) % 6));
+            v2 = (((a0[9] ? v2 : v1) ? (a0[12] != a0[5]) : (a1[0][13] == 34)) + ((53 <= a0[11]) / 4));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v2 = (((i3 == i2) + (i2 * v0)) <= ((i2 >= i2) - (a1[3][7] != v1)));
+                    v0 = (((a0[1] / 8) || (68 || a1[0][7])) - ((a1[2][11] >= 61) && (23 % 1)));
+                    v1 = (((a1[3][15] * a0[5]) <= (v2 || v2)) > ((a1[3][1] ? a1[3][10] : 48) != (14 / 5)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    if ((((a0[5] >= a1[2][6]) * (v2 - v1)) ? ((a0[8] < 65) ? (a0[11] > a0[7]) : (v3 > a0[0])) : ((v0 == 84) - (a1[1][10] ? 58 : 15)))) {
+        v0 = (((49 * v1) || (v0 && 12)) + ((v2 ? v0 : a1[1][14]) + (v1 <= v3)));
+        v0 = (((77 * v0) || (a0[7] - a0[15])) >= ((a1[1][1] < v3) * (a0[10] == v1)));
+        v2 = (((v2 <= 65) + (2 == v2)) ? ((2 ? a1[2][12] : v2) ? (v1 == a0[13]) : (24 && v3)) : ((85 || v3) % 6));
+    } else {
+        v1 = (((63 || v0) / 2) % 8);
+        v2 = (((a1[0][1] <= v2) + (21 <= v1)) == ((v2 ? 85 : v3) ? (v2 % 6) : (83 >= v1)));
+        a0[5] = (((90 != v2) > (11 != v3)) / 4);
+    }
+    return (((a1[3][15] < v0) * (a0[15] % 4)) % 9);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,180 @@
+int f0() {
+    int v0 = 65;
+    int v1 = 6;
+    int v2 = 83;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v1 || 10) - (i0 > v1)) / 2);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    a0[0] = (((i0 < v2) >= (18 <= 9)) % 2);
+                    a0[9] = (((34 ? 71 : a0[9]) ? (79 < v2) : (16 * v0)) || ((v1 || 12) ? (v3 != v3) : (65 != a1[2][7])));
+                    a1[3][8] = (((i1 <= i0) * (71 <= a0[9])) * ((a0[14] + 49) > (v0 ? i0 : v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v1 % 6) / 1) >= ((49 || v1) ? (74 && v1) : (a1[2][2] / 6)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a1[3][8] == a0[11]) / 8) != ((a0[2] + 39) || (v1 < i2)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((i3 ? 86 : 8) && (46 - v1)) / 8);
+                    v1 = (((31 ? v1 : v3) ? (a0[15] - v0) : (v0 == a1[0][15])) % 9);
+                    v2 = (((v1 || v1) < (a1[2][7] - i2)) ? ((76 && v2) <= (48 / 8)) : ((a1[2][8] * a0[9]) != (v1 + a0[4])));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            a0[2] = (((v2 ? a0[12] : a1[3][1]) ? (v0 <= 70) : (53 / 3)) || ((a1[1][5] ? i2 : v0) == (v1 / 5)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    if ((((a1[0][14] ? v3 : 68) < (92 == 98)) ? ((29 || v3) % 8) : ((a0[2] * v1) - (82 < v1)))) {
+        v0 = (((v0 + v3) < (v1 || v2)) != ((a0[15] ? v3 : 28) - (a1[2][7] + v1)));
+        v0 = (((a1[3][5] && a1[1][11]) && (a1[0][15] ? a1[3][1] : v2)) >= ((v2 != 23) % 7));
+        a1[3][14] = (((86 > 28) != (v0 - a0[6])) / 3);
+    } else {
+        v1 = (((v0 >= a0[7]) == (99 ? 58 : 44)) == ((v1 > a0[13]) && (14 <= v0)));
+        v1 = (((a0[8] - v2) < (v2 * a0[3])) - ((44 ? 24 : v2) != (a0[4] + v1)));
+        v0 = (((a0[4] * v3) < (a0[13] >= v2)) % 1);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v2 <= a1[0][1]) > 73) break;
+            v1 = (((v1 / 7) ? (33 < v2) : (a1[3][8] - 67)) == ((22 || v1) != (62 < v1)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v0 = (((v2 != a0[13]) * (i5 < 26)) >= ((12 > v3) == (i5 ? v0 : a1[0][1])));
+                a1[2][8] = (((v0 == 39) || (v0 + v2)) / 8);
+                v2 = (((a0[3] != a1[0][10]) == (v3 * v0)) - ((a1[0][4] || v3) > (92 - a1[0][7])));
+            }
+            v2 = (((49 ? 22 : v1) == (27 - a1[3][4])) != ((55 + v1) && (v2 + 83)));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    for (int i6 = 0; i6 < 5; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                if ((v1 + a1[1][6]) > 94) break;
+                v3 = (((a1[3][5] || a1[3][6]) ? (a1[2][7] ? 45 : a0[2]) : (73 != v0)) < ((84 - a1[0][13]) - (v0 != v3)));
+                a0[1] = (((a1[2][4] ? v1 : a0[13]) - (53 + v3)) > ((v1 > v3) % 9));
+                a0[4] = (((v1 <= 69) % 8) > ((26 / 6) / 1));
+                i7 = i7 + 1;
+            } while (i7 < 6);
+        }
+        a1[1][3] = (((v2 < i6) >= (v3 / 2)) != ((a1[3][3] && 84) - (a0[4] && v2)));
+        v1 = (((a0[5] - a0[10]) || (v0 == i6)) - ((v2 < a1[3][10]) % 9));
+    }
+    return (((v2 - a1[2][6]) % 7) ? ((80 % 2) || (v3 != 52)) : ((v2 ? 2 : v3) <= (v2 * v0)));
+}
+int f1() {
+    int v0 = 61;
+    int v1 = 2;
+    int v2 = 70;
+    int v3 = 71;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][12] ? a0[11] : v3) / 4) && ((v0 % 2) / 4))) {
+        v3 = (((a0[10] < 53) <= (59 != 30)) < ((v1 || v1) / 2));
+        v3 = (((v0 && 75) >= (v3 / 5)) || ((v2 >= v0) >= (v1 || v0)));
+        v1 = (((a0[14] / 5) * (v3 && a0[13])) ? ((v3 && 74) + (v2 != a1[0][7])) : ((a1[0][9] + a1[0][14]) / 9));
+    } else {
+        v1 = (((a1[1][10] / 5) != (v1 - v3)) - ((22 ? v3 : v2) ? (16 - 33) : (v3 ? v3 : 77)));
+        a1[1][11] = (((v0 * a0[10]) && (v1 / 2)) < ((38 > a1[3][1]) * (a1[3][1] && v1)));
+        v1 = (((v3 == 86) / 9) >= ((a1[2][5] <= v2) > (25 - v2)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((v2 > 51) == (a0[9] == 62)) ? ((i0 * v2) <= (v3 <= i0)) : ((a0[13] <= v2) > (v1 || v3)));
+            a0[15] = (((i0 > v3) ? (v1 - a1[1][11]) : (93 != 31)) < ((92 && v0) == (i0 >= a1[3][9])));
+            {
+                int i1 = 0;
+                do {
+                    a1[1][11] = (((a1[3][5] * i1) || (v0 == 21)) != ((v2 + 91) && (v2 % 3)));
+                    a0[9] = (((v0 * a1[2][13]) > (v0 % 9)) > ((v3 <= 4) ? (a1[0][11] || i1) : (8 % 4)));
+                    v2 = (((v1 == 96) != (i1 == 63)) || ((i0 ? 1 : v3) >= (7 == 88)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((v3 ? v0 : a0[11]) && (v1 / 1)) && ((18 <= 18) > (38 * a1[1][11])));
+    {
+        int i2 = 0;
+        do {
+            v3 = (((0 != v1) >= (v1 < v3)) % 9);
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                if ((54 * a0[3]) > 58) break;
+                a0[11] = (((a1[3][0] ? i2 : 78) / 3) != ((i3 + v3) >= (i2 <= v3)));
+                v1 = (((i2 % 4) != (91 ? 50 : v2)) >= ((45 < a1[3][3]) <= (32 < 85)));
+                v0 = (((28 == v2) > (a0[0] && 76)) ? ((a0[13] ? 49 : v1) % 9) : ((a0[5] * v0) == (v3 || 45)));
+            }
+            a0[6] = (((i2 || a1[0][1]) / 7) > ((4 < 32) || (v1 * 47)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v3 = (((v3 + 2) > (v3 * v3)) && ((a1[3][2] - v0) && (v2 != v2)));
+    return (((v0 / 4) >= (v0 || 12)) < ((a0[0] == v0) <= (v1 < v3)));
+}
+int f2() {
+    int v0 = 18;
+    int v1 = 58;
+    int v2 = 27;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    if ((((91 && v1) / 3) % 1)) {
+        v1 = (((a1[1][13] ? a0[10] : 37) <= (v1 > v2)) ? ((v0 / 2) >= (v3 - 65)) : ((v1 == v1) && (a1[0][3] ? a1[0][11] : v2)));
+        v3 = (((a0[2] % 7) == (a1[0][14] == v2)) / 2);
+        v3 = (((a1[3][7] == v0) % 5) && ((v3 > v1) / 2));
+    } else {
+        v1 = (((v0 / 7) ? (a0[14] * v3) : (v0 == 97)) ? ((a1[3][3] * v3) - (82 >= v1)) : ((v1 * 92) < (50 + v1)));
+        v2 = (((a1[3][14] != 41) >= (v2 + a1[2][1])) ? ((v1 - v0) < (v3 ? a0[13] : a0[2])) : ((v0 > a0[6]) ? (4 == 43) : (v2 / 6)));
+        v3 = (((a1[2][1] || v0) > (v3 ? v2 : 68)) % 7);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((v0 > 57) ? (36 >= a0[14]) : (a0[13] / 2)) != ((61 > v0) + (20 == 93)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((81 != v1) > (v2 || v1)) || ((a1[3][15] + v2) ? (v2 > a0[11]) : (a1[0][1] >= 88)));
+                    a0[6] = (((v3 / 1) && (i1 ? v0 : v0)) * ((i1 == 70) != (a0[10] < a0[10])));
+                    v2 = (((v0 <= v3) == (v2 || 42)) ? ((a1[2][12] / 1) % 5) : ((v0 ? i1 : 70) * (99 > 71)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v2 = (((i0 * v1) ? (42 < 16) : (37 - v3)) - ((a1[2][7] * v3) ? (v3 * v2) : (11 > i0)));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((6 && v0) || (a0[9] <= 47)) >= ((v1 < v0) != (a0[5] * v0)));
+    if ((((v3 == v1) % 7) > ((v0 <= 8) >= (a0[4] && v3)))) {
+        v1 = (((19 - v2) % 6) ? ((v2 % 6) + (60 != v3)) : ((39 ? v0 : 61) <= (v2 / 5)));
+        a0[14] = (((v0 && a1[2][14]) * (16 >= a1[0][6])) == ((18 / 2) <= (65 / 8)));
+        v3 = (((a1[2][12] == v3) >= (a1[3][15] < a1[3][10])) > ((2 || 91) >= (v0 == 4)));
+    } else {
+        v1 = (((v1 - v3) ? (v2 + a1[2][11]) : (a0[1] / 3)) / 2);
+        a0[6] = (((49 == v1) || (a1[1][11] <= v0)) || ((a0[7] < v3) <= (12 * a0[1])));
+        v0 = (((v1 && 56) >= (a1[0][6] != v3)) * ((v1 < a0[12]) ? (89 == 92) : (a1[3][5] != a0[1])));
+    }
+    a0[1] = (((a0[0] * 90) * (a0[12] - 77)) + ((v2 - v2) ? (v2 != v2) : (v0 && v3)));
+    return (((30 && v1) > (a1[3][10] / 6)) >= ((a0[13] < 42) <= (v0 == v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,78 @@
+int f0() {
+    int v0 = 12;
+    int v1 = 34;
+    int v2 = 87;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((v1 ? 95 : v3) > 99) break;
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v2 && 58) != (14 - v1)) != ((50 ? v3 : 25) && (v3 * 43)));
+                    a0[2] = (((i0 / 2) || (36 && a0[13])) % 4);
+                    v2 = (((i1 != v3) ? (71 == a1[1][2]) : (v3 % 7)) || ((v2 <= 35) || (a1[0][13] == a1[1][14])));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v2 = (((a1[1][4] >= 59) && (v1 > 1)) && ((a0[15] && 87) == (v1 ? 87 : v2)));
+            v0 = (((71 - 75) % 4) / 3);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[8] = (((a1[2][4] || a1[3][10]) % 5) == ((i2 ? v1 : 44) <= (v1 >= a1[2][4])));
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                v1 = (((v0 ? a1[2][2] : v1) != (i3 && v3)) == ((v1 && v2) == (a1[3][14] * a0[13])));
+                a0[7] = (((v3 ? v3 : i3) % 8) || ((a1[1][9] < a0[7]) >= (i2 <= v3)));
+                v1 = (((i2 ? a0[10] : a1[3][1]) % 3) / 1);
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((a0[13] ? a1[2][4] : 45) && (v0 || a0[4])) && ((v0 != i2) > (73 && i2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            a1[2][14] = (((v0 > 17) == (a0[10] ? i4 : v3)) * ((a0[2] * 24) >= (v3 - 28)));
+            v1 = (((a0[2] == a0[1]) <= (79 && a1[0][5])) + ((i4 < 70) || (15 != a1[2][11])));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((a1[0][7] + v0) + (58 == i5)) == ((v2 || 26) == (i5 ? v3 : i5)));
+                    v0 = (((6 == i5) / 1) % 2);
+                    v3 = (((v2 ? 20 : a1[1][11]) <= (94 % 9)) / 4);
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v0 = (((a1[2][10] != v1) >= (v1 ? v0 : a1[0][5])) <= ((v3 ? 14 : v3) >= (v2 < v1)));
+    {
+        int i6 = 0;
+        while (i6 < 5) {
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((a0[0] <= v0) * (v0 < v1)) >= ((81 < 9) && (a1[1][2] <= 42)));
+                    a1[2][13] = (((v3 + 1) * (v2 % 6)) * ((v0 > a0[7]) - (27 / 8)));
+                    v3 = (((v2 + 21) < (48 == v1)) ? ((a0[9] / 8) ? (56 || v2) : (v3 || a1[3][0])) : ((a0[10] / 5) ? (v0 * 79) : (v0 % 4)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            v0 = (((v1 % 3) >= (v0 || a1[2][14])) == ((v1 + 58) + (v0 != v1)));
+            v1 = (((v3 || 50) != (97 + 88)) > ((i6 > v3) || (14 ? v0 : 49)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v0 + a1[3][12]) / 9) >= ((a0[9] <= v0) >= (69 && a0[8])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,117 @@
+int f0() {
+    int v0 = 10;
+    int v1 = 84;
+    int v2 = 13;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][9] <= v0) || (a0[13] + 33)) ? ((32 >= a1[2][15]) && (v0 < v2)) : ((v2 < v3) > (a0[5] == 98)))) {
+        a0[6] = (((a1[2][14] / 9) == (25 != v0)) / 4);
+        v3 = (((v3 ? a1[0][14] : 16) / 8) + ((a1[0][3] ? v3 : 46) <= (v0 > v1)));
+        a0[14] = (((7 || a1[0][11]) > (a1[3][5] >= 92)) <= ((a0[12] <= v2) * (a1[2][7] == 26)));
+    } else {
+        a0[14] = (((a1[2][11] ? v1 : 7) ? (v0 * v2) : (65 % 1)) + ((v3 || v2) < (v2 || 8)));
+        v1 = (((v0 <= v3) ? (a1[0][5] / 9) : (93 && a1[1][12])) == ((39 / 3) ? (v3 != v2) : (v3 - v1)));
+        a1[1][1] = (((v2 > v2) >= (77 && a0[5])) ? ((v0 - 91) + (v1 == a1[1][11])) : ((v2 >= a0[7]) != (a0[15] || v1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((a1[2][12] || v0) > 98) break;
+            v3 = (((v0 != v1) ? (66 >= 44) : (v0 * v3)) % 1);
+            v0 = (((a0[4] && v1) + (88 || 71)) ? ((a0[7] > i0) < (v2 % 2)) : ((a0[3] * 64) ? (v3 * v2) : (49 >= a0[12])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((i0 > 56) < (4 <= 71)) * ((57 ? i0 : v2) <= (v0 || v3)));
+                v0 = (((46 || a1[0][14]) ? (26 || a0[15]) : (v0 * v0)) == ((v1 / 8) / 4));
+                a1[1][4] = (((i1 ? v0 : i1) > (a0[10] && a0[13])) ? ((i1 || 90) - (v2 ? v1 : i0)) : ((93 / 5) || (i1 && v2)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((2 && a0[9]) / 4) % 5)) {
+        a1[2][5] = (((v2 <= v0) / 7) >= ((v2 > v3) > (71 / 9)));
+        v1 = (((a1[1][3] - v3) >= (a0[13] <= a1[1][9])) != ((v3 || v0) * (73 > v0)));
+        v0 = (((a0[6] - 38) <= (v2 != v0)) || ((v3 <= 88) >= (v3 < v0)));
+    } else {
+        v0 = (((97 <= 49) <= (a0[0] != v0)) && ((v0 % 7) || (v0 == a1[0][1])));
+        v3 = (((a0[0] % 4) / 3) * ((a0[14] ? a0[0] : v1) > (4 + v1)));
+        v1 = (((70 + 50) + (a0[5] - a1[0][5])) - ((84 >= v1) <= (50 > v3)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((v2 <= 39) != (a1[0][10] % 8)) / 2);
+                    a1[0][14] = (((75 % 5) <= (v1 / 8)) - ((v2 >= a1[2][9]) <= (a0[12] - v2)));
+                    a0[15] = (((82 < v3) * (i2 < v1)) || ((a0[10] < a1[0][11]) < (v2 / 7)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((87 ? i2 : v2) % 5) <= ((v3 > a0[3]) % 6));
+            v2 = (((v0 == a1[3][10]) >= (53 ? v0 : v2)) % 5);
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[14] + 19) || (a0[4] + v0)) < ((v2 <= v2) > (v1 > a0[7])))) {
+        v2 = (((v3 - v0) % 2) / 9);
+        a1[1][13] = (((v3 - 29) >= (v1 - a1[0][6])) <= ((27 / 5) % 9));
+        v1 = (((a0[11] || v0) ? (a1[2][14] ? v1 : v0) : (a1[1][5] ? v3 : 69)) || ((a0[12] ? 97 : v1) || (v2 > a1[0][14])));
+    } else {
+        v1 = (((56 >= 83) <= (v1 ? v0 : 38)) ? ((a0[14] == 40) + (v2 >= v2)) : ((v3 <= v3) + (28 % 4)));
+        v1 = (((v2 + a1[1][3]) ? (v3 % 1) : (a0[7] ? 28 : v1)) <= ((v3 * v0) != (v1 && v1)));
+        v0 = (((a1[0][13] * 95) + (a0[11] < v1)) ? ((v2 && v3) || (v0 ? v0 : v2)) : ((v2 && v3) + (25 != a1[1][14])));
+    }
+    return (((v2 + 99) == (v3 != a0[7])) == ((v0 + a0[14]) < (v1 / 3)));
+}
+int f1() {
+    int v0 = 2;
+    int v1 = 51;
+    int v2 = 21;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((14 % 7) ? (a0[15] <= a1[0][15]) : (v3 && 29)) / 9);
+    v1 = (((v1 / 5) ? (v0 > 96) : (v2 && v1)) < ((v3 / 8) + (85 - v2)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((96 ? v1 : 60) > 65) break;
+                v0 = (((a0[0] <= i0) > (a1[3][11] && v1)) * ((42 / 2) && (a1[0][5] || v0)));
+                a1[2][11] = (((a1[2][2] && v2) / 3) % 3);
+                a0[3] = (((v1 != a0[15]) ? (v0 && 58) : (v0 - a1[3][12])) - ((i0 / 4) >= (a1[1][12] - i1)));
+            }
+            a1[0][10] = (((v1 + 30) ? (v2 * v1) : (v3 > a1[3][14])) <= ((91 - a0[0]) >= (48 || 35)));
+            v2 = (((3 >= i0) + (a0[3] >= i0)) % 1);
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v1 = (((v1 - a0[0]) / 7) >= ((a1[2][4] > v1) >= (v2 && v2)));
+        v1 = (((a1[2][13] * v1) ? (v0 && a0[0]) : (a0[7] ? 5 : v3)) == ((56 == a0[2]) - (v3 <= 10)));
+        {
+            int i3 = 0;
+            do {
+                a1[2][5] = (((v2 < a0[8]) != (v1 ? v1 : v1)) - ((v2 ? i2 : a0[14]) ? (i3 && a1[2][9]) : (a0[1] != 91)));
+                a0[7] = (((v1 && v2) == (70 || v1)) || ((v3 != i3) > (a0[11] + a0[4])));
+                v1 = (((a0[8] / 3) + (8 + a0[9])) > ((a0[8] == i3) >= (a1[1][11] <= i2)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+    }
+    if ((((v0 * v2) >= (66 <= a1[2][12])) <= ((v2 ? a0[4] : v1) == (v0 > v0)))) {
+        v2 = (((45 == 37) * (v0 - a1[2][14])) && ((v0 / 8) || (84 / 3)));
+        v2 = (((v0 != v3) > (a0[12] >= 82)) != ((a1[3][9] || v3) - (21 ? a0[11] : v1)));
+        v0 = (((v1 <= v3) == (a1[0][0] / 9)) % 3);
+    } else {
+        v0 = (((v2 == v2) ? (a1[1][6] ? v2 : 81) : (v1 ? a0[3] : v0)) ? ((v2 <= v0) != (65 > v2)) : ((a0[12] && v1) % 2));
+        v1 = (((v2 != v3) ? (a0[1] ? 48 : v1) : (a0[1] < v1)) == ((a1[2][4] + a1[0][13]) % 5));
+        a1[3][12] = (((v1 ? v0 : 63) < (a1[0][12] || v1)) && ((v1 <= v0) != (v1 % 1)));
+    }
+    return (((v3 >= 43) % 1) != ((v1 < 84) && (42 / 7)));
+}
+int main() {
+    return 0;
+}
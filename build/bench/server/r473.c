@@ -0,0 +1,145 @@
+int f0() {
+    int v0 = 0;
+    int v1 = 77;
+    int v2 = 42;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((73 == v1) + (75 != a0[12])) ? ((a0[0] >= a0[8]) >= (a0[3] && v3)) : ((15 || 7) == (v3 || 2)));
+    if ((((v2 == v2) && (v3 || a0[9])) || ((v2 >= a0[0]) >= (a1[3][3] ? v0 : v2)))) {
+        a1[2][0] = (((a1[3][15] / 1) && (v3 / 6)) ? ((v0 || a0[1]) * (a0[10] * v2)) : ((v1 != v2) && (15 ? 94 : 19)));
+        v3 = (((73 <= 69) && (v3 > v3)) ? ((v0 >= a0[4]) <= (55 == 77)) : ((v0 - 54) % 4));
+        a1[2][13] = (((a0[5] != 84) >= (a0[11] * a0[4])) || ((v0 * v3) / 7));
+    } else {
+        a0[1] = (((a0[14] > v3) <= (98 >= 23)) && ((v1 && 56) != (v2 && 92)));
+        v0 = (((v0 - a1[1][13]) > (v0 / 6)) / 2);
+        v1 = (((a1[1][15] == 89) * (v0 != v2)) * ((v1 == a1[3][14]) && (v3 >= v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a1[3][5] = (((v0 == v0) && (v1 || 40)) || ((a0[8] < i0) || (35 || i0)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a1[3][12] = (((a1[0][2] ? 59 : v1) * (v3 > a0[13])) % 6);
+                    v0 = (((29 % 3) || (21 != 6)) + ((v2 ? i0 : a0[4]) ? (56 > 41) : (v0 && v1)));
+                    a0[6] = (((v3 ? v3 : v2) < (v2 != 49)) >= ((v2 - v0) <= (a0[7] / 6)));
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((a0[2] % 1) % 4) != ((a0[11] ? a1[3][3] : v0) ? (v3 > 14) : (v0 < 98)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v0 <= a1[1][15]) ? (v3 == v3) : (a0[6] - a1[2][8])) <= ((v0 ? a0[4] : v2) < (a1[1][3] / 7)))) {
+        v3 = (((41 > v2) >= (a0[9] < a1[2][4])) ? ((v2 || a0[2]) - (v0 < 62)) : ((v2 || a0[1]) || (v0 % 9)));
+        a0[2] = (((a1[3][5] >= v2) % 1) / 1);
+        v0 = (((v3 * 17) % 1) == ((a1[3][7] != v1) ? (v3 == a1[3][9]) : (75 ? v3 : a1[0][12])));
+    } else {
+        v3 = (((69 / 8) < (v2 - v0)) >= ((v0 / 7) ? (v1 ? 80 : v2) : (v0 && v3)));
+        v2 = (((46 <= 73) % 4) / 6);
+        a1[1][15] = (((96 % 7) < (v2 % 2)) < ((a0[6] <= a0[1]) > (a0[3] >= v3)));
+    }
+    v1 = (((v0 || v1) > (a0[9] % 1)) >= ((v1 / 3) > (92 / 7)));
+    return (((7 - v1) >= (v3 >= v1)) == ((v0 <= v1) ? (a0[12] ? v0 : v3) : (23 || v1)));
+}
+int f1() {
+    int v0 = 97;
+    int v1 = 35;
+    int v2 = 48;
+    int v3 = 49;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v0 + v3) - (5 % 1)) % 3);
+    v3 = (((v2 + v0) || (a1[2][11] != 74)) % 6);
+    if ((((v2 == a0[0]) ? (v2 < a0[5]) : (v1 > 71)) < ((v1 != v3) ? (v3 ? v0 : v2) : (38 != v2)))) {
+        v2 = (((a1[0][12] == v0) != (v3 * v1)) + ((a0[0] || v1) ? (54 + v2) : (v3 && 89)));
+        v3 = (((a0[13] ? v2 : a1[1][4]) ? (a1[2][13] && v3) : (a0[6] >= v2)) - ((v3 < v1) > (65 == v1)));
+        v1 = (((28 ? v2 : v3) > (a1[2][9] * 67)) || ((v1 * a0[5]) ? (v1 < a1[0][10]) : (v0 * v3)));
+    } else {
+        a0[8] = (((v3 && v3) != (v3 + v1)) + ((v2 <= a1[1][13]) ? (a0[7] >= 93) : (a1[3][0] ? v2 : v0)));
+        v2 = (((68 == v2) / 5) > ((v0 ? v2 : a0[7]) < (v1 > v0)));
+        a1[1][10] = (((a1[0][9] >= v3) >= (87 ? 58 : 27)) == ((6 < a0[12]) && (a1[0][14] < v2)));
+    }
+    a0[1] = (((v0 ? 54 : v1) * (81 > v0)) == ((61 % 4) ? (a0[11] + v2) : (v1 != v0)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((a1[0][10] * a1[0][0]) + (a0[11] <= v3)) < ((v3 - i0) == (v1 < v0)));
+            v1 = (((v0 ? 47 : 6) <= (5 < v1)) ? ((v3 < i0) || (v2 <= 29)) : ((a0[5] != 75) && (v1 == 81)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a0[7] = (((i1 % 5) == (v1 || i0)) <= ((v3 >= v0) * (a0[14] != a0[14])));
+                    v2 = (((i0 <= v0) - (v2 + a1[3][9])) || ((v1 * 88) && (v0 && a1[1][8])));
+                    v0 = (((v3 <= v2) && (v3 / 4)) ? ((i1 || v2) || (78 - a1[1][2])) : ((a0[6] <= a1[0][11]) != (v0 % 6)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    return (((28 == 93) + (a1[1][11] + a1[1][12])) >= ((v3 * v3) - (a1[2][1] ? v0 : v2)));
+}
+int f2() {
+    int v0 = 82;
+    int v1 = 4;
+    int v2 = 95;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v2 = (((v3 / 1) >= (63 == 73)) + ((a0[3] <= a1[3][0]) != (v1 != 98)));
+            v0 = (((v2 / 5) ? (54 <= v0) : (v1 != i0)) != ((78 > v2) && (a1[3][14] > v1)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v1 = (((v2 / 3) / 1) ? ((i0 * a1[3][2]) % 1) : ((a1[1][2] + 44) <= (v0 != a1[1][14])));
+                v2 = (((i0 < a0[11]) % 1) <= ((v0 || i0) >= (77 < a0[15])));
+                v0 = (((v2 ? 91 : a1[2][8]) ? (a0[7] <= v2) : (a1[2][1] == 50)) ? ((i1 - v2) ? (a1[0][3] / 4) : (63 * i0)) : ((27 - v0) + (v0 % 2)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v3 == v2) && (53 * v0)) % 5)) {
+        v2 = (((v0 >= a0[6]) > (v0 ? 3 : v2)) != ((v0 ? a0[12] : 57) < (v2 < v1)));
+        v3 = (((v1 <= 20) >= (v0 + 35)) >= ((5 - a1[2][15]) >= (v0 % 9)));
+        a0[5] = (((a0[7] >= v0) ? (v3 || 60) : (v1 / 8)) == ((a1[2][11] != v1) ? (a1[3][2] || 7) : (v3 <= v2)));
+    } else {
+        a1[3][0] = (((v1 && 85) ? (v0 ? a0[12] : v3) : (v1 && v3)) / 5);
+        v0 = (((v3 < a1[2][12]) - (v0 ? a0[10] : a1[0][7])) / 9);
+        v0 = (((11 > v3) == (v1 <= 40)) && ((a1[3][11] > v1) - (v0 >= v2)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v3 = (((a1[3][14] ? v1 : a0[8]) ? (v3 != 52) : (79 || v3)) ? ((17 == v3) || (v3 > a1[0][11])) : ((57 + v3) == (v3 ? v3 : v1)));
+            a1[3][2] = (((a1[0][7] ? a1[3][15] : v0) >= (v1 + a0[7])) / 4);
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a1[1][11] = (((v0 < v0) - (v2 % 2)) - ((a0[5] || v2) * (v3 != v1)));
+                a0[14] = (((v0 && v3) / 5) < ((a0[8] >= a1[0][14]) != (v3 != a0[3])));
+                a1[0][2] = (((a1[1][11] ? i2 : 77) || (v0 ? a1[0][2] : v0)) / 9);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            a1[2][7] = (((v2 % 3) != (v3 == v3)) != ((v2 % 7) != (44 <= 31)));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                v0 = (((v1 == 31) * (19 < a0[13])) || ((89 > i4) ? (6 * 90) : (v1 <= a0[6])));
+                a1[1][2] = (((i4 > a0[0]) <= (v3 > v0)) % 8);
+                v3 = (((i4 == 11) != (a1[2][12] && v0)) * ((a0[1] ? a0[0] : v1) * (v3 == a0[2])));
+            }
+            a0[5] = (((a0[0] != a1[0][6]) == (74 >= v0)) % 8);
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((51 ? a0[4] : v2) + (59 % 7)) >= ((a0[14] <= v1) > (45 - 73)));
+    return (((v0 || v1) && (v2 * v2)) % 7);
+}
+int main() {
+    return 0;
+}
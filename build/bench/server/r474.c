@@ -0,0 +1,74 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 10;
+    int v2 = 79;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v0 = (((v3 > a1[0][14]) * (i0 || a0[10])) && ((53 <= 92) ? (a0[15] % 5) : (24 + 23)));
+            a0[2] = (((a0[7] ? v3 : v2) == (16 / 9)) % 9);
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[1] = (((v0 * v1) ? (v0 / 8) : (v0 - v0)) ? ((a0[15] % 4) - (i0 != i1)) : ((a1[0][7] ? v0 : v1) != (v1 ? a1[0][15] : v0)));
+                v1 = (((i1 != i1) / 8) <= ((58 < 38) - (i1 ? v0 : 24)));
+                v1 = (((85 == a0[14]) == (v3 > 64)) && ((24 / 7) != (v0 % 1)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v2 = (((8 == v1) == (v3 != v3)) / 7);
+            v1 = (((a0[7] - 42) || (v0 - v2)) <= ((37 > a0[1]) - (i2 >= 46)));
+            {
+                int i3 = 0;
+                do {
+                    a1[1][14] = (((74 / 6) ? (v0 && v2) : (a0[12] * i2)) == ((a1[2][0] - a1[3][15]) <= (15 ? a0[12] : v2)));
+                    v2 = (((18 == 76) ? (7 < v2) : (v2 && i2)) * ((v2 > v0) || (v0 < v2)));
+                    v3 = (((i3 && a1[0][7]) * (i3 - i3)) <= ((30 && v0) != (v2 == 64)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((a0[6] && v1) > 57) break;
+            a1[1][2] = (((a0[13] != v2) ? (a0[4] || 71) : (a0[10] + v2)) % 3);
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((v0 && 78) != (v3 >= v3)) < ((i5 + 33) == (i4 % 4)));
+                    v2 = (((45 >= i4) || (i4 / 6)) == ((a1[2][13] < i4) && (51 * a0[4])));
+                    v2 = (((a0[9] != i4) == (v1 + i5)) || ((v3 * i5) && (i4 || v1)));
+                    i5 = i5 + 1;
+                }
+            }
+            v0 = (((47 / 6) || (49 % 8)) ? ((v0 * a1[0][5]) - (63 / 4)) : ((v3 == v3) % 8));
+            i4 = i4 + 1;
+        }
+    }
+    v1 = (((54 ? v0 : a0[0]) || (v3 + v3)) || ((a1[3][15] >= 22) && (27 != a1[0][8])));
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        {
+            int i7 = 0;
+            do {
+                v0 = (((a0[9] <= v1) ? (62 ? 54 : i6) : (a0[6] != v0)) || ((v1 > a0[11]) || (a1[3][15] || 96)));
+                v0 = (((v2 % 8) <= (a1[2][13] >= v0)) == ((a1[3][12] || a1[3][0]) % 9));
+                v3 = (((a1[1][3] * a0[2]) <= (i6 <= a1[0][1])) == ((v1 || v1) * (v2 ? v2 : a1[3][11])));
+                i7 = i7 + 1;
+            } while (i7 < 5);
+        }
+        v1 = (((i6 ? v2 : v3) || (a0[15] * 73)) ? ((v1 ? v0 : v3) && (88 * v3)) : ((v1 ? v3 : v2) > (v1 < 81)));
+        a0[9] = (((93 / 7) - (a0[5] ? a1[3][14] : 63)) == ((20 - a0[1]) + (i6 && v1)));
+    }
+    return (((a1[2][4] ? v2 : 1) && (62 < 22)) % 9);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,134 @@
+int f0() {
+    int v0 = 55;
+    int v1 = 58;
+    int v2 = 30;
+    int v3 = 73;
+    int a0[16];
+    int a1[4][16];
+    a1[3][4] = (((31 > v3) <= (a1[0][9] / 4)) || ((v1 % 5) && (38 ? v1 : v1)));
+    if ((((7 <= v2) || (52 <= a1[2][10])) != ((23 ? v0 : v0) / 8))) {
+        v3 = (((v3 <= v2) - (4 <= a1[2][4])) ? ((v0 < 25) * (a1[0][11] ? a0[1] : v0)) : ((v2 == 22) % 4));
+        a0[0] = (((v1 > v0) <= (v2 < v2)) && ((0 && a0[9]) < (14 ? a0[0] : v2)));
+        a1[2][2] = (((3 + v0) + (v3 || a1[1][13])) != ((59 <= v2) * (a0[11] != v3)));
+    } else {
+        v1 = (((a1[2][5] == v0) ? (28 && v1) : (v1 > a0[3])) + ((43 < 38) * (a1[3][9] - a0[1])));
+        a0[3] = (((v0 && v1) - (a0[3] != 76)) / 1);
+        v3 = (((v2 <= v3) <= (v0 <= a1[3][11])) >= ((v1 <= v2) > (v3 != v1)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v1 = (((v3 <= v1) != (24 != 69)) > ((v1 % 6) == (v0 - 72)));
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((23 != v2) > 67) break;
+                v3 = (((a1[1][15] != i0) <= (a1[1][13] <= v2)) / 5);
+                v2 = (((a1[2][9] > a1[0][10]) ? (i1 != v3) : (a0[15] / 7)) - ((v3 - v1) != (a1[1][13] ? a0[2] : v1)));
+                v1 = (((40 + v2) ? (i0 - 14) : (25 || v2)) || ((v2 * 96) - (a0[14] >= v3)));
+            }
+            v2 = (((v3 >= 24) * (v2 == 77)) - ((v2 <= 26) <= (i0 && v2)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v2 = (((i2 == v3) ? (a0[10] || i2) : (i2 + 24)) <= ((99 && v3) >= (i2 ? i2 : v2)));
+            v1 = (((v2 > a0[2]) * (v3 != a0[4])) != ((34 ? i2 : a1[1][11]) <= (v1 > 59)));
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                if ((v0 * v2) > 66) break;
+                a1[2][3] = (((v2 == a1[3][12]) - (50 || 85)) == ((19 % 5) % 6));
+                v2 = (((v0 + a1[2][14]) >= (a0[11] <= 12)) == ((v3 / 4) - (50 == v3)));
+                v0 = (((88 > a1[0][15]) ? (a1[3][15] > v1) : (v3 * 39)) > ((v3 || i3) > (v1 <= v3)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v0 = (((a0[13] != v1) == (45 < 75)) == ((63 / 9) > (i4 == a0[14])));
+            v3 = (((v2 <= v1) - (v0 <= a0[3])) ? ((a0[13] + a1[0][15]) + (v3 || a0[6])) : ((i4 ? v1 : v0) > (a1[0][12] <= v3)));
+            {
+                int i5 = 0;
+                do {
+                    a1[1][1] = (((a0[10] != i4) <= (i4 >= v1)) && ((i5 * 74) < (90 + i4)));
+                    v3 = (((i5 * 68) >= (a0[13] % 6)) <= ((v3 * v3) == (52 == 81)));
+                    v2 = (((v1 * a1[3][14]) < (v2 && a1[3][9])) ? ((85 == 45) - (i5 || v2)) : ((i5 > v2) || (i5 || 98)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[12] ? 12 : 74) / 3) != ((v0 / 6) < (v1 ? a0[15] : v3)));
+}
+int f1() {
+    int v0 = 27;
+    int v1 = 3;
+    int v2 = 19;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v0 = (((i0 > v2) % 4) > ((v1 > i0) % 9));
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            v3 = (((a0[12] % 5) / 6) && ((16 % 1) ? (61 <= i0) : (v3 % 2)));
+            v1 = (((v2 % 3) == (v0 * 76)) % 6);
+            v1 = (((i1 >= 36) < (i0 <= a1[0][0])) == ((10 || v3) != (a1[0][2] || a1[2][2])));
+        }
+        a1[0][5] = (((i0 == 50) + (28 / 9)) >= ((v3 % 1) ? (i0 > i0) : (0 - a1[1][9])));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[5] = (((v3 / 6) || (a0[6] + a1[0][13])) && ((i2 / 8) % 2));
+        v3 = (((99 || v2) - (60 && v2)) <= ((a1[0][13] * a0[9]) || (a1[1][7] && v1)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a0[2] = (((78 <= v0) == (48 + 61)) >= ((i3 != a1[0][2]) + (a0[1] == a1[1][7])));
+            v0 = (((v3 || a1[2][3]) || (37 != a0[9])) % 4);
+            v2 = (((i3 && v3) ? (i3 >= i3) : (v0 <= 13)) != ((a0[7] || 39) >= (i3 * 49)));
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            if ((v0 ? v1 : a1[3][8]) > 57) break;
+            a1[3][6] = (((v3 % 5) && (v3 >= v0)) <= ((66 && a0[6]) + (a1[2][0] ? a0[5] : a1[0][2])));
+            v0 = (((v1 || a0[3]) / 2) == ((v0 && v0) ? (v2 % 7) : (48 * a0[5])));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v2 = (((a0[5] != v2) + (32 ? i5 : i5)) >= ((v2 >= v1) > (a1[2][12] >= v2)));
+                v1 = (((v0 ? v3 : 20) >= (v2 != i4)) <= ((47 ? a0[10] : v1) ? (v2 && i5) : (v0 >= v0)));
+                v3 = (((i5 % 1) || (a1[3][0] <= a0[0])) == ((12 ? i4 : i5) ? (v0 != a0[14]) : (i4 >= v2)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 && a0[0]) > (1 < v0)) <= ((a0[9] ? v2 : 34) == (7 && 90)))) {
+        v2 = (((a1[2][8] < 55) != (a0[3] ? v2 : 97)) && ((v1 - 95) != (a1[2][6] % 9)));
+        v2 = (((v1 == v1) + (a0[10] % 4)) != ((a0[15] != a0[13]) + (35 == a1[3][4])));
+        v2 = (((v1 >= a0[10]) ? (a1[2][9] % 6) : (v3 >= v1)) >= ((87 % 9) * (a1[2][3] && v0)));
+    } else {
+        v3 = (((v2 ? a1[3][0] : a0[1]) % 4) / 1);
+        a0[0] = (((74 && v1) > (97 < v3)) * ((v3 ? a0[7] : a0[2]) && (33 / 3)));
+        v3 = (((24 % 6) || (v3 >= 68)) != ((v2 || 21) <= (v2 == v0)));
+    }
+    {
+        int i6 = 0;
+        do {
+            v2 = (((a1[2][13] ? v3 : 46) + (59 >= v0)) / 8);
+            a0[10] = (((v2 * v2) ? (94 - v0) : (37 <= 81)) < ((a0[11] * i6) ? (9 + a0[2]) : (a1[1][13] > a1[0][4])));
+            {
+                int i7 = 0;
+                do {
+                    v0 = (((i7 >= 71) ? (a0[8] ? 83 : 76) : (72 ? 37 : a0[8])) + ((a1[1][0] != i7) - (84 == v0)));
+                    a0[10] = (((a1[1][1] || a0[14]) && (i6 >= v3)) <= ((84 <= v2) == (a0[3] * v3)));
+                    v3 = (((a1[1][8] - 75) * (v3 % 2)) > ((a1[0][10] < v1) <= (v3 && a1[2][7])));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    return (((v0 >= v0) * (v1 < 12)) ? ((a0[11] + v1) ? (34 % 1) : (v2 < v2)) : ((v2 ? 78 : v0) % 3));
+}
+int main() {
+    return 0;
+}
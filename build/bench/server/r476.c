@@ -0,0 +1,195 @@
+int f0() {
+    int v0 = 86;
+    int v1 = 27;
+    int v2 = 56;
+    int v3 = 23;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v3 = (((i0 && v1) < (95 ? 27 : v0)) ? ((v1 - v3) / 6) : ((v0 ? v2 : v3) * (a1[0][5] < a1[1][5])));
+            v0 = (((v3 > 18) > (v2 && v2)) ? ((v2 ? a1[0][6] : 37) <= (a0[12] ? v0 : v2)) : ((a0[12] != a0[13]) == (v0 == v0)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    a0[8] = (((i1 - v1) % 1) == ((a0[15] / 6) / 2));
+                    a0[13] = (((70 - 35) ? (97 || 60) : (i1 <= a1[0][13])) != ((i0 <= a0[15]) != (16 != v0)));
+                    v2 = (((v3 && v0) != (i0 - i1)) + ((a0[6] != 97) && (v2 && i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((v1 - a0[13]) && (a0[2] ? v0 : 44)) > ((v3 * v0) > (v1 + 55)));
+    if ((((v2 ? v3 : 23) ? (v2 - a1[1][6]) : (v1 || v1)) > ((a1[3][10] == 67) < (37 >= 10)))) {
+        a0[8] = (((v1 && a0[9]) * (80 / 5)) < ((v3 || v1) ? (a0[6] != v2) : (51 ? v1 : a1[0][12])));
+        v1 = (((16 == v3) > (38 ? v1 : v1)) ? ((v0 >= a1[3][7]) ? (a1[0][6] > v3) : (v3 != 21)) : ((a0[0] - v2) ? (a1[2][15] || v3) : (v1 || v0)));
+        v0 = (((36 >= 1) <= (35 ? v0 : v3)) || ((a0[11] ? v1 : 75) && (99 >= v0)));
+    } else {
+        v0 = (((v2 || 18) || (a0[5] && a0[3])) == ((v1 > v1) / 5));
+        a1[1][11] = (((v2 > v2) ? (a0[13] > v0) : (a0[8] ? a0[1] : a1[2][6])) - ((v3 <= v3) ? (v1 < 50) : (v0 > v3)));
+        a1[2][3] = (((v2 != 95) >= (v2 <= a0[13])) * ((v1 >= v1) || (v3 || v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a0[9] && v3) > (v3 && v2)) || ((v0 / 1) >= (v3 ? 97 : v2)));
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((73 ? i2 : a1[1][15]) && (a1[1][9] * a1[0][4])) + ((a0[15] == v0) * (v0 >= i2)));
+                    a0[1] = (((27 / 7) <= (v3 == v0)) < ((v1 || v0) * (i3 < a1[2][5])));
+                    a1[2][2] = (((67 ? v1 : 90) ? (v2 + 70) : (87 != v0)) + ((i3 / 3) && (a1[0][4] ? a0[14] : 60)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v0 = (((a0[11] > a0[6]) > (a0[1] <= v2)) - ((v3 - v2) % 8));
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((a1[1][5] * 47) + (a1[3][2] < 50)) ? ((v1 ? a0[9] : a1[3][2]) ? (a1[1][4] && v1) : (v0 != v2)) : ((a1[0][10] + v0) <= (a1[0][10] < 12)))) {
+        v1 = (((63 && 43) ? (v2 * 2) : (a0[6] < 33)) / 2);
+        a1[0][5] = (((a1[3][14] <= v3) * (v1 <= a0[14])) != ((v0 / 6) + (a1[2][7] <= v1)));
+        a0[13] = (((75 + v1) == (v0 > a1[2][0])) / 2);
+    } else {
+        a0[0] = (((v2 - v3) > (v2 || v1)) + ((72 > 93) + (a0[14] >= v3)));
+        v1 = (((v0 ? v1 : v0) != (v2 && 70)) == ((60 % 3) - (92 / 1)));
+        a1[0][8] = (((a1[2][7] > a0[13]) >= (v1 / 7)) <= ((19 >= 70) ? (v2 * v1) : (v3 ? v0 : v2)));
+    }
+    return (((a1[1][1] < 76) || (a0[6] ? a0[10] : v1)) / 9);
+}
+int f1() {
+    int v0 = 44;
+    int v1 = 29;
+    int v2 = 6;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v3 = (((v2 - 87) - (i0 < 15)) + ((v3 == i0) / 6));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                if ((v3 * a1[3][15]) > 67) break;
+                a1[0][9] = (((8 + a0[1]) != (i1 == 69)) == ((v0 > v2) == (v1 ? a0[2] : i1)));
+                a0[4] = (((v2 ? 67 : v3) <= (v3 != v0)) <= ((42 >= v3) ? (a1[2][14] ? 49 : a0[13]) : (13 && v0)));
+                v1 = (((v2 == v1) <= (i1 >= v0)) <= ((v3 || v1) == (6 >= v2)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[1] = (((79 + a1[1][7]) ? (v3 / 8) : (v3 > v3)) >= ((71 ? v0 : a0[10]) / 9));
+    }
+    if ((((a1[2][14] != a0[1]) <= (a1[1][11] >= v1)) / 1)) {
+        a0[15] = (((v3 && v1) / 7) / 1);
+        v2 = (((74 ? v2 : v2) + (a1[2][10] <= a1[1][15])) ? ((v3 <= 75) >= (a0[2] < v2)) : ((v0 >= 10) % 4));
+        a0[13] = (((a0[6] ? a1[2][15] : v3) <= (v3 < a0[11])) <= ((v3 != v0) < (v3 % 8)));
+    } else {
+        a0[2] = (((a0[12] ? 84 : a0[6]) == (12 / 1)) > ((v1 || v3) ? (v2 ? v1 : a1[0][14]) : (v2 ? a1[1][8] : v3)));
+        a0[15] = (((v1 ? v3 : 86) ? (v0 / 7) : (v3 ? v1 : a1[3][2])) * ((v3 - 91) % 7));
+        v0 = (((v2 <= v3) * (v1 % 2)) && ((a0[14] > 88) + (a0[4] % 9)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v3 = (((v3 < a0[11]) <= (v3 - v1)) <= ((i2 ? 47 : v3) / 3));
+            v3 = (((i2 != 94) ? (6 < 54) : (a1[1][5] <= v1)) >= ((v3 ? a0[3] : 43) && (v0 ? v3 : 40)));
+            {
+                int i3 = 0;
+                do {
+                    a1[2][10] = (((v1 && 16) * (a1[2][8] * v3)) && ((v3 || v3) ? (v0 || 90) : (a1[0][13] && a0[0])));
+                    v1 = (((v1 < i3) || (v3 / 4)) != ((89 ? a0[4] : 26) + (a1[0][11] + 54)));
+                    v2 = (((v0 - v3) + (v1 && i2)) <= ((v3 + a0[2]) / 9));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    a0[11] = (((a1[2][4] - 68) + (v3 ? v1 : 28)) % 6);
+    if ((((39 < a1[0][2]) + (a0[15] && a1[3][9])) > ((v3 == v2) * (a1[0][6] + a1[0][10])))) {
+        v3 = (((v3 != v3) || (60 >= 28)) * ((v1 ? 97 : a0[3]) % 5));
+        v3 = (((a0[3] || a0[12]) < (v3 ? v1 : a1[2][14])) && ((v1 && v1) <= (v0 <= v2)));
+        a1[0][14] = (((v3 >= v0) && (v3 - a0[1])) && ((a1[2][6] < 95) == (v1 != 72)));
+    } else {
+        v1 = (((v1 == 59) < (v1 + v3)) != ((v0 <= v2) % 1));
+        v3 = (((12 + 17) ? (24 || v0) : (a0[15] ? a1[3][11] : 29)) + ((45 ? a1[1][15] : 79) ? (v3 % 2) : (v1 >= v0)));
+        a0[13] = (((41 * a1[0][2]) == (v1 > 8)) + ((v2 <= v3) + (v0 || a0[0])));
+    }
+    return (((v0 % 5) ? (a0[10] <= 76) : (v0 == v3)) != ((a0[3] ? 92 : a1[0][1]) != (a1[2][13] / 7)));
+}
+int f2() {
+    int v0 = 23;
+    int v1 = 93;
+    int v2 = 39;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a1[0][5] = (((v1 == a1[2][15]) != (v2 + a1[2][6])) + ((a0[13] || i0) < (v3 || 89)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((i0 < 79) < (a1[3][14] ? a1[3][4] : v3)) / 8);
+                    v1 = (((v0 == v0) >= (v2 % 8)) < ((a1[3][5] == v3) && (v3 != v1)));
+                    v2 = (((a1[3][14] - i0) - (82 < a0[13])) * ((35 >= 46) >= (36 * a1[0][1])));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            a1[1][15] = (((v2 != a0[7]) + (v0 ? v1 : i0)) + ((v3 == 59) / 2));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            a1[1][7] = (((i2 >= a0[6]) == (i2 != a0[4])) <= ((v0 != 85) <= (v1 * 7)));
+            a0[3] = (((84 / 5) <= (v3 + 1)) || ((53 < a0[7]) - (a0[7] != v3)));
+            v0 = (((25 <= 48) ? (63 + i2) : (v1 && 47)) == ((i2 == 77) && (v2 * v1)));
+        }
+        v3 = (((v2 || i2) + (10 + a1[3][3])) && ((62 * v1) || (v0 || i2)));
+        v0 = (((v0 >= 74) || (20 * v1)) != ((v2 || 56) % 6));
+    }
+    if ((((a1[1][13] + v2) < (v2 - a0[2])) == ((75 >= v2) ? (v3 && v2) : (a1[0][4] + 61)))) {
+        v1 = (((v1 / 9) || (v3 <= v3)) == ((a0[9] / 9) == (84 > v3)));
+        v1 = (((v0 ? 87 : v2) * (v1 ? 79 : v3)) && ((a0[10] < 17) >= (v0 / 8)));
+        v0 = (((a1[2][11] > v2) % 4) > ((a1[0][0] < v2) ? (72 % 3) : (88 > 58)));
+    } else {
+        v3 = (((28 < a0[1]) - (v1 * v2)) < ((a0[9] < 23) - (24 + 59)));
+        a1[1][6] = (((v2 ? v0 : a0[0]) + (73 / 3)) <= ((41 * v0) ? (a1[1][14] + a1[1][4]) : (a0[9] % 6)));
+        v3 = (((18 <= v1) ? (v2 && v0) : (54 - 1)) < ((v0 <= 48) * (v2 + v2)));
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        {
+            int i5 = 0;
+            do {
+                a0[4] = (((i4 - a0[2]) || (41 >= v1)) == ((v2 || a1[1][6]) || (60 * a1[2][11])));
+                v2 = (((5 / 2) - (v3 > a0[15])) - ((a0[9] >= v2) ? (v0 * 89) : (a0[7] / 4)));
+                v3 = (((i4 != 49) ? (68 && 95) : (21 == v0)) || ((71 || a0[8]) == (i5 ? v3 : i4)));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+        v0 = (((v2 * 71) ? (1 == 39) : (15 / 8)) ? ((v1 - 29) * (a0[6] + 31)) : ((v0 ? v2 : v2) >= (a0[11] == 77)));
+        v3 = (((v0 >= a0[2]) == (v2 % 8)) < ((v2 + v0) == (9 * v0)));
+    }
+    {
+        int i6 = 0;
+        do {
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                if ((v2 || v3) > 97) break;
+                v3 = (((i6 && 84) > (18 - a0[9])) <= ((74 < v0) + (35 ? i6 : a0[9])));
+                a0[0] = (((i7 / 8) % 7) && ((v2 / 3) ? (i6 <= 24) : (v2 - a0[1])));
+                v0 = (((a0[11] != v3) ? (v0 && v3) : (49 <= v2)) < ((v2 * 64) / 2));
+            }
+            v2 = (((86 ? v2 : v0) < (v1 / 3)) && ((i6 == i6) ? (a1[3][7] ? i6 : 0) : (i6 / 9)));
+            v3 = (((v1 && v2) >= (v3 > 40)) < ((i6 + a1[1][7]) * (9 <= 46)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    return (((v2 > v0) + (v2 % 8)) < ((a0[12] > 96) ? (a1[0][12] && v1) : (a0[10] && 29)));
+}
+int main() {
+    return 0;
+}
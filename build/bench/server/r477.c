@@ -0,0 +1,57 @@
+int f0() {
+    int v0 = 78;
+    int v1 = 39;
+    int v2 = 55;
+    int v3 = 62;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((20 * a0[1]) && (v0 * 8)) < ((26 != 37) < (v2 - i0)));
+                    v0 = (((96 / 4) != (a1[3][11] == 40)) >= ((a1[1][15] != v0) - (a1[1][9] > v0)));
+                    a1[2][13] = (((76 % 6) <= (v2 + a1[2][3])) || ((a0[9] * i0) + (56 || 62)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((86 >= 8) && (v1 && v0)) * ((97 ? v1 : v0) == (a0[2] <= a1[3][6])));
+            a0[14] = (((i0 >= 19) % 1) ? ((a1[0][2] >= a1[3][10]) - (a1[1][4] * v3)) : ((v2 >= a0[6]) && (v3 >= 22)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        a0[12] = (((v2 ? i2 : 0) == (a0[14] <= i2)) % 8);
+        v3 = (((a0[3] > v1) != (a1[0][13] || a1[1][5])) > ((a1[3][4] <= v1) / 6));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v0 = (((a1[0][7] ? v1 : a0[7]) ? (i3 || 40) : (i2 / 1)) / 9);
+            a1[3][4] = (((v0 + v3) != (a1[0][8] && a0[13])) && ((a1[2][1] <= 75) % 8));
+            v0 = (((49 ? i3 : 15) && (87 || i2)) != ((i2 + a1[0][1]) && (i2 && v3)));
+        }
+    }
+    v0 = (((v2 ? v0 : v1) - (a0[1] ? v0 : 54)) > ((v0 % 3) > (v0 < a1[3][13])));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((v1 * a1[1][5]) ? (v2 % 8) : (v1 / 9)) == ((a1[2][10] ? v3 : 11) ? (88 <= v2) : (v0 / 7)));
+                    v1 = (((i5 < 70) - (i4 != i4)) <= ((17 != 90) % 7));
+                    a0[1] = (((v3 * v1) * (v1 && 38)) && ((a1[0][10] && 61) * (v3 <= 58)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a1[0][7] = (((a0[8] && a0[8]) * (85 * a0[10])) || ((v1 % 2) % 7));
+            v3 = (((v0 > i4) + (a0[12] < a0[0])) == ((a1[2][0] % 1) + (v0 ? v1 : 42)));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    v1 = (((v3 / 6) <= (22 == 71)) ? ((57 % 1) && (a0[12] ? 47 : v0)) : ((a1[0][9] % 5) >= (60 ? v2 : v1)));
+    return (((a1[0][5] && v1) % 7) != ((32 || a0[10]) || (a1[0][1] - 66)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,113 @@
+int f0() {
+    int v0 = 40;
+    int v1 = 74;
+    int v2 = 86;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a0[7] == v3) / 5) < ((v2 <= 38) * (a1[3][14] >= v3)));
+            v2 = (((v1 / 3) <= (v1 ? i0 : v2)) == ((85 < 8) >= (v1 == i0)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((a1[0][7] || i0) && (v2 ? v1 : a1[0][6])) != ((a0[11] ? 40 : a0[10]) && (a1[3][0] && i0)));
+                    v2 = (((14 + v0) == (45 - v1)) > ((v1 - 26) > (a0[2] * 25)));
+                    v0 = (((a1[0][5] <= 72) * (v1 > 82)) == ((i0 || a1[3][7]) != (50 - v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v1 = (((v3 <= v0) < (a0[6] + a0[8])) == ((80 >= a1[1][7]) / 5));
+    v1 = (((v1 || v0) > (67 % 5)) == ((v1 ? 44 : a1[0][1]) < (58 && 54)));
+    {
+        int i2 = 0;
+        do {
+            v1 = (((78 ? 82 : 38) ? (v1 || v2) : (a0[2] / 2)) > ((v0 || 8) == (v1 == a0[7])));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((v3 || i3) == (v0 > 89)) ? ((a1[3][9] <= v0) % 9) : ((38 <= a0[7]) > (a1[1][8] >= i2)));
+                    a0[11] = (((4 < a0[10]) && (a0[5] ? i3 : 17)) > ((72 ? 43 : v0) > (76 && v2)));
+                    v3 = (((v2 - v1) - (v0 ? a1[3][13] : i3)) || ((v0 > v1) - (a1[2][12] == v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a1[3][5] = (((v0 && a0[5]) - (v0 != a1[0][8])) < ((v0 + 21) && (v0 - a1[3][7])));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((a1[0][15] * a0[1]) || (3 / 2)) / 5)) {
+        a0[7] = (((63 != v3) || (a1[0][6] != 37)) || ((a1[0][2] % 5) >= (v3 - 90)));
+        a0[14] = (((a0[9] ? v3 : v0) / 4) * ((v1 < a0[1]) == (93 - 68)));
+        a1[2][12] = (((a1[0][15] || a1[1][8]) ? (a1[1][10] > v3) : (v0 < v1)) >= ((21 >= 46) + (v0 % 4)));
+    } else {
+        a0[12] = (((88 <= 67) < (v3 + 43)) && ((v3 <= 20) ? (a0[1] == v0) : (v0 != v2)));
+        a0[9] = (((v1 ? v0 : a0[2]) + (a1[1][9] + a1[1][15])) <= ((85 || v1) * (a1[0][4] / 6)));
+        v1 = (((79 + a1[1][13]) % 1) || ((a0[8] >= v1) > (a0[6] < v2)));
+    }
+    return (((v3 <= v3) - (v0 % 7)) ? ((a0[15] || 79) > (a1[3][4] + v0)) : ((v2 ? v3 : 92) - (v2 >= a0[14])));
+}
+int f1() {
+    int v0 = 85;
+    int v1 = 4;
+    int v2 = 78;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v1 = (((a1[2][6] - v1) > (71 > a1[0][6])) ? ((6 >= 50) != (v0 <= i0)) : ((72 / 3) + (v0 % 1)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            if ((a1[3][4] <= v3) > 52) break;
+            v0 = (((v2 % 1) || (99 ? 61 : a1[0][9])) ? ((v2 || i0) * (a0[7] ? v2 : 54)) : ((86 % 4) * (a0[11] < v1)));
+            v2 = (((v0 >= 35) + (v0 != i1)) != ((i1 > 69) < (89 > a1[2][13])));
+            v2 = (((v3 == 86) && (i0 || v2)) - ((i0 % 6) * (29 * a1[2][9])));
+        }
+        v3 = (((25 * v0) ? (v1 && a1[2][8]) : (i0 ? 97 : v2)) == ((14 == v2) && (v0 || a1[1][3])));
+    }
+    v3 = (((v2 - v2) == (a1[2][6] > v0)) || ((22 ? v1 : a1[0][0]) <= (v0 + 92)));
+    {
+        int i2 = 0;
+        do {
+            if ((i2 && a1[1][0]) > 96) break;
+            v3 = (((a0[3] <= v0) && (a0[2] <= a0[0])) ? ((v2 && i2) ? (v0 && v1) : (45 < v3)) : ((65 <= 70) > (79 > v1)));
+            a1[1][13] = (((v2 || a1[0][14]) - (31 || 98)) - ((v3 / 9) * (v0 ? a0[9] : 65)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                a0[13] = (((90 == 65) ? (1 || 60) : (a0[15] == v3)) * ((55 <= a1[2][2]) + (v3 > v3)));
+                v0 = (((v2 >= 93) > (v1 >= i2)) != ((v0 ? 73 : v2) * (v3 + a0[6])));
+                v1 = (((i3 + v2) || (v3 == v0)) == ((i3 * a0[8]) - (v1 % 8)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((21 / 7) != (86 >= v0)) <= ((a1[0][12] * v1) == (48 + 5)))) {
+        a1[3][12] = (((v3 - 75) + (78 ? a1[2][15] : a0[9])) < ((v2 > 19) >= (a1[1][15] < v3)));
+        v0 = (((v2 + 40) ? (a1[1][15] > a0[0]) : (5 > 14)) > ((v2 ? 70 : v2) > (v0 == a0[10])));
+        v0 = (((72 <= v2) != (v3 < a0[10])) || ((a1[1][6] != a1[2][7]) % 4));
+    } else {
+        a0[8] = (((v2 && v1) - (33 % 5)) >= ((99 * a1[1][2]) || (v2 ? v1 : a1[3][6])));
+        v0 = (((v1 >= v1) / 5) && ((v1 ? v1 : v0) >= (14 / 5)));
+        v1 = (((v0 ? a1[3][13] : v2) != (v1 >= 27)) * ((v2 % 1) % 7));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v2 = (((a1[3][9] ? i4 : v1) || (a1[0][0] - a1[0][0])) * ((65 >= v0) <= (v0 == v0)));
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                a1[0][12] = (((v2 - i5) - (i5 == v2)) ? ((i5 == v0) + (a1[3][0] - i4)) : ((i4 % 4) < (i5 && a1[1][3])));
+                v1 = (((24 ? i5 : v1) - (i4 * v2)) * ((38 || i4) ? (v3 / 4) : (v0 - i5)));
+                v1 = (((v0 == v3) < (90 == 83)) <= ((v2 < v2) ? (a1[2][6] + v0) : (v0 && 33)));
+            }
+            v0 = (((i4 - 26) != (v0 == v2)) ? ((v2 / 6) % 4) : ((41 ? 26 : 6) / 5));
+            i4 = i4 + 1;
+        }
+    }
+    return (((20 * 36) != (a1[3][0] * 8)) && ((a1[1][0] + v3) == (v3 <= v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,189 @@
+int f0() {
+    int v0 = 60;
+    int v1 = 30;
+    int v2 = 20;
+    int v3 = 21;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            v0 = (((v2 > i1) == (v0 < i1)) % 2);
+            a0[8] = (((v2 / 5) >= (53 % 8)) && ((i1 - i1) / 4));
+            v3 = (((v1 / 2) ? (v2 ? i1 : i0) : (v2 + v2)) ? ((a0[15] ? a0[4] : 87) * (32 || v0)) : ((v2 - v3) % 4));
+        }
+        v1 = (((v3 <= v0) ? (v2 > v2) : (10 < v1)) >= ((v3 > v1) + (v2 - v0)));
+        a0[2] = (((v0 * v3) + (a0[3] != v2)) >= ((v1 != v0) != (33 >= a0[14])));
+    }
+    v3 = (((58 || v0) + (a1[3][7] * a0[2])) ? ((7 + v0) - (a1[3][1] >= 42)) : ((a1[2][11] - a0[2]) < (a1[2][8] / 7)));
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v2 = (((87 == a1[2][8]) / 9) + ((a0[15] == a1[0][14]) >= (18 ? v0 : v3)));
+        {
+            int i3 = 0;
+            do {
+                if ((v2 == v0) > 57) break;
+                v1 = (((v1 - a1[1][6]) / 4) || ((v2 ? v3 : v0) > (a0[2] < 54)));
+                v3 = (((a1[2][5] + v2) < (v3 + 82)) >= ((20 - 14) > (v2 != v1)));
+                v0 = (((v0 + 23) / 8) ? ((a0[8] ? v1 : a1[0][8]) || (v0 == v1)) : ((70 / 5) > (v2 || 60)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        v3 = (((a1[3][5] && a0[14]) || (a0[5] || a1[0][1])) ? ((v2 >= v1) >= (v1 >= i2)) : ((35 != v0) - (a0[9] && i2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a0[1] * v0) > 78) break;
+            a0[13] = (((v1 / 4) ? (i4 % 8) : (v0 % 4)) % 1);
+            a1[3][9] = (((98 + v3) + (a0[1] == a1[1][15])) + ((i4 == 76) ? (v1 + v1) : (a0[8] ? a0[8] : 89)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((49 && i4) / 3) + ((i5 % 1) + (64 <= a1[2][1])));
+                    a1[2][3] = (((51 <= i4) == (a0[8] >= i5)) ? ((71 && v0) > (v3 + a1[1][8])) : ((a1[1][3] != 65) / 8));
+                    a0[14] = (((a1[3][12] == 93) != (53 == a0[13])) <= ((44 ? a0[15] : 22) * (a0[12] / 2)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    v1 = (((26 * v1) + (34 <= v2)) != ((v2 && v2) && (37 + v1)));
+    return (((19 / 7) >= (v0 && v0)) > ((a0[10] || 21) ? (v1 != a1[3][5]) : (v0 >= v3)));
+}
+int f1() {
+    int v0 = 48;
+    int v1 = 7;
+    int v2 = 85;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a1[1][2] = (((v3 + 95) != (v0 + v0)) % 8);
+        v2 = (((a1[1][13] > 64) / 8) ? ((v2 && 6) >= (v1 == a0[7])) : ((i0 / 3) && (a1[2][14] == v2)));
+        {
+            int i1 = 0;
+            do {
+                v0 = (((78 != a0[1]) < (11 - v1)) || ((a0[0] && v1) < (80 ? 58 : 0)));
+                v2 = (((v3 && 51) ? (v2 && v1) : (v3 >= a0[10])) + ((v2 / 4) ? (a0[2] >= v0) : (a0[7] <= v3)));
+                v0 = (((29 || 65) > (41 || a1[2][10])) || ((v0 / 3) % 2));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                do {
+                    if ((i2 && v1) > 67) break;
+                    a1[3][11] = (((a0[15] / 2) - (v1 + i3)) <= ((75 >= a1[2][0]) - (57 / 1)));
+                    a0[7] = (((70 * v3) - (a1[3][7] && a0[8])) || ((v1 + a0[8]) != (9 * a1[3][10])));
+                    v3 = (((i3 && v2) / 8) <= ((v0 == a1[3][15]) / 9));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a0[5] = (((a1[2][0] < v1) - (v3 || v3)) * ((a1[2][7] + a0[5]) ? (i2 ? 5 : v3) : (v0 != a0[12])));
+            v1 = (((63 || i2) / 5) || ((i2 ? i2 : v0) != (30 < v0)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((v2 <= v1) != (a1[2][1] >= v2)) >= ((v1 < a1[0][10]) == (v2 != a0[15])));
+                    v1 = (((v2 && a0[4]) || (a0[13] <= 11)) && ((v1 > a0[14]) != (i5 || 72)));
+                    v0 = (((v0 == 41) ? (i5 ? 29 : a1[0][5]) : (60 > v0)) && ((77 % 6) > (a1[2][1] || i4)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v2 = (((65 >= v3) * (i4 >= v2)) ? ((v2 || v3) <= (v3 ? a1[3][10] : 94)) : ((v3 / 2) + (v1 != a1[3][13])));
+            v1 = (((v1 != 21) - (8 ? 67 : a1[1][4])) > ((v2 > i4) <= (71 != a1[1][9])));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    v1 = (((a0[2] && a1[1][9]) ? (v3 || a1[0][13]) : (a1[1][0] % 9)) ? ((6 || 32) < (v0 && 15)) : ((v2 != v3) || (a0[7] != 8)));
+    {
+        int i6 = 0;
+        while (i6 < 7) {
+            a1[0][6] = (((a1[3][6] * v2) ? (35 || v3) : (56 / 5)) ? ((i6 - v1) && (i6 / 4)) : ((v0 ? v0 : i6) + (a1[2][5] / 5)));
+            {
+                int i7 = 0;
+                while (i7 < 6) {
+                    v1 = (((i6 * a1[1][6]) ? (83 >= v3) : (v2 % 5)) - ((v0 % 9) >= (91 ? a1[1][0] : i6)));
+                    v0 = (((v3 < i6) - (a0[12] ? a1[2][11] : v1)) != ((a0[10] + a0[12]) ? (v2 != v0) : (32 < a1[0][6])));
+                    a0[6] = (((i6 ? a0[6] : v1) >= (94 + 88)) && ((50 || 78) ? (65 > a0[6]) : (v0 ? a0[15] : 2)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((53 - a0[1]) >= (46 / 8)) ? ((v0 && v1) % 9) : ((80 + v0) < (82 / 3)));
+            i6 = i6 + 1;
+        }
+    }
+    return (((v0 + v2) || (a0[13] && v1)) * ((v3 ? v3 : a0[14]) != (v0 + v1)));
+}
+int f2() {
+    int v0 = 55;
+    int v1 = 37;
+    int v2 = 63;
+    int v3 = 78;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v3 = (((a1[1][2] - v1) || (i0 == v1)) + ((v0 <= v1) > (i0 ? a1[0][0] : a1[3][14])));
+            v1 = (((i0 <= a1[1][0]) <= (73 > v3)) || ((a1[1][6] ? 95 : a0[2]) % 2));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v0 = (((87 + v2) || (v2 ? a1[3][12] : a1[0][3])) % 7);
+                v1 = (((v3 / 3) > (v2 != 75)) >= ((v1 + i0) - (74 + 46)));
+                v3 = (((a1[1][1] == v0) + (a1[3][8] > 77)) / 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((v3 < v1) - (31 && a0[0])) > ((62 - v3) ? (91 <= a1[1][10]) : (v1 % 9)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        a1[3][6] = (((v2 && v1) >= (v1 >= v0)) && ((v0 % 6) / 6));
+        {
+            int i3 = 0;
+            do {
+                if ((64 / 1) > 56) break;
+                v0 = (((68 || a1[1][13]) > (v0 + 63)) + ((24 * v3) || (a0[0] * 57)));
+                v1 = (((i2 ? v2 : 94) + (a0[4] * a0[7])) > ((v3 - v2) * (6 < v1)));
+                v1 = (((29 + v1) - (v1 && v2)) * ((v2 && a0[5]) % 3));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v2 = (((v3 ? a1[2][1] : v2) >= (v3 - a0[8])) ? ((a0[2] || 72) + (3 < v3)) : ((27 - v3) * (85 / 2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((v0 + i4) + (a1[1][9] % 5)) ? ((v3 == a1[0][8]) && (v2 && v1)) : ((v2 + v3) < (i4 ? v1 : v2)));
+            a1[3][14] = (((a1[0][13] <= v2) == (77 * v1)) + ((v2 - a1[2][12]) ? (8 <= v0) : (v3 >= a0[4])));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v2 = (((i4 * i5) && (v2 || i4)) ? ((v1 + 47) ? (2 ? i5 : 18) : (a0[2] - 45)) : ((v0 > 7) / 9));
+                v1 = (((2 && i5) <= (i4 * 10)) || ((36 > a1[3][0]) >= (v2 * 10)));
+                a0[3] = (((v3 + a1[3][8]) < (v2 < a0[4])) * ((a0[5] - 51) <= (a1[2][15] / 7)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    for (int i6 = 0; i6 < 8; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 2; i7 = i7 + 1) {
+            v3 = (((i6 && 95) > (v1 >= v2)) && ((i6 / 5) >= (v2 - i6)));
+            v1 = (((60 <= 5) % 8) >= ((a0[0] <= v3) % 2));
+            v1 = (((v1 * 31) - (15 < v2)) * ((81 == v3) != (51 >= i7)));
+        }
+        v0 = (((75 ? a0[4] : v2) && (92 > i6)) - ((v0 != i6) ? (v3 * a0[10]) : (a0[14] < v0)));
+        v1 = (((v3 / 9) > (a1[2][6] ? 4 : a0[8])) * ((a1[3][4] + a0[0]) % 9));
+    }
+    return (((v3 % 9) && (v1 >= v3)) <= ((v2 != 67) + (v2 || 40)));
+}
+int main() {
+    return 0;
+}
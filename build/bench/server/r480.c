@@ -0,0 +1,75 @@
+int f0() {
+    int v0 = 86;
+    int v1 = 67;
+    int v2 = 29;
+    int v3 = 6;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((89 && v0) % 9) && ((v3 / 4) - (v3 % 4)));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[2][15] = (((v2 != v1) && (v0 / 6)) != ((a1[2][13] < a0[2]) >= (80 ? 40 : a0[6])));
+            v0 = (((12 != v3) - (77 - i0)) == ((i0 ? a1[2][10] : 54) ? (a0[13] % 3) : (a0[13] + v2)));
+            {
+                int i1 = 0;
+                do {
+                    a0[3] = (((52 - v1) < (i0 + v0)) == ((93 / 4) / 7));
+                    a1[0][15] = (((80 > v1) < (i0 ? v0 : 40)) || ((v2 || i0) % 2));
+                    a1[0][13] = (((i1 >= v1) == (v2 * i0)) ? ((a1[0][7] ? i0 : v2) || (i0 > a0[4])) : ((13 % 3) <= (a1[3][2] - 64)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            if ((v0 >= a0[9]) > 74) break;
+            v0 = (((v3 <= v0) / 3) <= ((v0 <= a0[1]) != (a0[1] + a1[3][10])));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((v2 ? v1 : v2) > 58) break;
+                    a1[0][6] = (((a1[1][11] % 3) || (21 == a0[5])) < ((a0[7] && 55) != (i3 ? v0 : 70)));
+                    v0 = (((48 % 2) - (14 && 22)) % 6);
+                    a1[0][1] = (((a0[15] ? v2 : 30) ? (i3 * i2) : (v3 == 55)) || ((v2 < a0[3]) + (v3 && a1[0][9])));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a0[5] >= a0[9]) == (v0 == a0[9])) <= ((94 / 9) ? (v1 >= v1) : (a0[14] / 2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((a1[1][0] != v2) >= (v1 <= v0)) + ((35 ? 38 : 52) * (i4 % 4)));
+                    v2 = (((i4 % 8) + (a0[10] >= v1)) < ((4 - v1) >= (v1 || v3)));
+                    a0[8] = (((v1 * 14) - (v0 ? i4 : 93)) - ((v3 / 6) ? (v1 >= a1[2][12]) : (96 || 44)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            a1[0][13] = (((v3 % 6) != (a1[1][10] < v2)) >= ((8 / 3) ? (v2 >= a0[3]) : (69 / 9)));
+            a1[3][2] = (((a0[2] < 63) * (v3 * v2)) + ((a0[0] + v0) ? (v3 ? v0 : v2) : (i4 * i4)));
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v3 != v0) < (v2 >= v1)) ? ((v0 - 7) + (v3 * a1[1][2])) : ((v3 + v2) - (v1 != v1)))) {
+        a1[3][0] = (((v2 == v0) % 9) != ((v2 != a1[3][0]) == (v3 ? 39 : v0)));
+        v0 = (((v2 - v1) ? (v3 ? v1 : a0[14]) : (v2 - 16)) && ((v1 > v3) % 4));
+        v3 = (((v2 || v3) > (a0[2] + a1[1][4])) || ((v3 != v0) ? (v1 / 6) : (v1 >= v3)));
+    } else {
+        v3 = (((83 && a1[0][9]) <= (v3 || a0[7])) % 3);
+        v2 = (((a1[0][5] + v0) % 8) > ((a1[3][12] >= 73) % 6));
+        v1 = (((46 <= v0) || (a1[3][14] - v0)) % 6);
+    }
+    return (((28 % 8) != (v3 < 94)) % 7);
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,113 @@
+int f0() {
+    int v0 = 44;
+    int v1 = 96;
+    int v2 = 33;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((86 ? v0 : a1[0][10]) || (68 + v0)) > ((15 * a0[6]) + (v3 ? 70 : a0[7])));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v3 = (((74 / 6) / 8) * ((v2 * i0) ? (v1 % 8) : (v1 - v0)));
+                    a0[11] = (((a0[9] || v1) && (v2 != 65)) || ((v0 % 9) / 9));
+                    v0 = (((v0 ? i1 : v0) > (62 + i0)) + ((v1 % 7) * (v1 && v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((7 / 1) >= (90 != a1[3][13])) || ((15 && v3) != (a1[3][3] && 59)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    v2 = (((73 ? 60 : 97) > (v1 <= 6)) != ((v1 >= a1[3][0]) && (v0 <= v2)));
+    if ((((a0[11] >= v3) % 6) == ((v3 || v0) / 7))) {
+        a0[15] = (((61 >= v0) == (v0 > 4)) / 1);
+        v0 = (((0 < a1[0][0]) <= (v3 && v2)) - ((75 ? v1 : v2) == (98 - v2)));
+        v3 = (((11 <= v2) + (45 && v3)) != ((v2 ? v0 : v0) ? (20 == a0[10]) : (v3 + v1)));
+    } else {
+        v0 = (((v1 ? v2 : v0) % 2) * ((a0[14] == v0) > (v1 >= a1[2][2])));
+        a0[6] = (((a0[2] * a1[3][4]) / 5) < ((a1[0][10] < v3) == (a1[3][3] > 52)));
+        a0[6] = (((a1[1][4] || 60) > (v0 && v2)) - ((90 >= v0) / 2));
+    }
+    if ((((v0 < 5) >= (v3 > v0)) ? ((92 != a1[1][9]) ? (v2 > 38) : (17 - 61)) : ((87 % 9) ? (14 < a0[13]) : (a1[2][7] % 5)))) {
+        v2 = (((a1[3][1] != 44) <= (v2 == 21)) || ((v2 <= v2) || (a1[1][0] / 8)));
+        a1[2][9] = (((v2 + a1[0][12]) || (a0[5] ? 6 : v2)) && ((v3 > v0) == (72 / 4)));
+        v1 = (((85 ? a1[1][4] : 57) * (a0[2] && v0)) / 9);
+    } else {
+        v2 = (((v2 != v0) && (v1 != v2)) >= ((v0 / 5) > (v1 + a1[0][3])));
+        a0[10] = (((v1 < 77) * (v2 * v3)) <= ((a0[0] - v1) ? (90 == a1[1][10]) : (a0[4] == v3)));
+        v2 = (((v1 && v3) == (6 / 2)) >= ((16 + v0) ? (a0[6] / 8) : (10 / 1)));
+    }
+    if ((((a0[2] % 9) - (a1[1][5] + a1[2][1])) > ((v1 >= v0) - (20 - v2)))) {
+        a0[7] = (((a1[0][2] != 32) <= (v2 % 9)) + ((55 || v3) % 4));
+        v0 = (((32 ? a0[14] : v0) == (v3 - v3)) >= ((v2 % 8) == (v3 * a0[1])));
+        v0 = (((v3 && 8) % 8) * ((v0 ? v2 : a1[3][8]) || (v0 + v1)));
+    } else {
+        v2 = (((a1[1][5] || a1[3][0]) ? (a0[7] * a0[15]) : (a0[4] ? v3 : 60)) * ((98 ? v3 : v3) % 1));
+        v2 = (((v0 < v2) < (v1 ? v0 : 22)) * ((a0[1] < v0) / 8));
+        a0[3] = (((a0[3] * 59) / 5) != ((a1[0][9] - v0) ? (63 <= a0[15]) : (v3 + v2)));
+    }
+    return (((a1[0][3] != a1[2][9]) > (v0 >= v3)) && ((v2 != v1) != (a1[3][4] < a1[3][6])));
+}
+int f1() {
+    int v0 = 5;
+    int v1 = 76;
+    int v2 = 47;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    a1[3][2] = (((v2 > 1) - (v2 * v3)) || ((43 + a1[0][15]) + (82 / 9)));
+    v3 = (((a0[7] || 75) == (a0[12] % 2)) ? ((v3 ? v1 : 34) <= (a0[2] || v1)) : ((a0[9] ? v3 : v1) - (v3 - v3)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                v3 = (((88 <= v3) - (a1[1][2] * a0[12])) <= ((v1 < v2) == (1 * a0[2])));
+                v0 = (((v2 >= v0) <= (i0 + 80)) && ((i0 ? v1 : 26) == (86 + v1)));
+                a1[1][14] = (((i1 < a0[5]) ? (i1 ? v0 : v0) : (v0 < 69)) < ((v2 ? a1[1][3] : 2) ? (49 > a0[15]) : (i0 != i1)));
+            }
+            v3 = (((96 > v1) > (i0 < 54)) / 2);
+            v0 = (((v2 <= v0) <= (a0[14] && v3)) / 9);
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v0 = (((v3 % 2) / 3) ? ((v1 || 27) * (a1[0][11] || a1[0][13])) : ((v1 + a0[14]) ? (19 / 7) : (a0[13] ? 96 : 51)));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((v0 == 68) != (v2 - i2)) ? ((v1 == v0) / 6) : ((i2 && a0[6]) && (84 < v2)));
+                a0[5] = (((a0[1] - i3) / 9) <= ((80 <= i3) % 7));
+                v3 = (((v3 ? 95 : a1[0][7]) <= (i3 ? v3 : v1)) || ((v0 / 7) <= (a0[7] / 2)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        a1[1][15] = (((a0[1] ? 72 : v1) <= (33 == a1[2][14])) ? ((95 + 3) ? (v1 < v1) : (15 <= v1)) : ((v3 % 1) <= (v0 ? v1 : v2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            if ((31 * v2) > 76) break;
+            {
+                int i5 = 0;
+                do {
+                    if ((v3 && v2) > 95) break;
+                    v1 = (((33 == v1) && (57 == i4)) / 5);
+                    v2 = (((v0 + a0[6]) != (i5 && i5)) ? ((v1 && v3) < (60 > v1)) : ((10 > 17) / 7));
+                    a1[2][15] = (((a1[1][3] >= a0[11]) > (i4 * v0)) * ((42 ? i4 : v2) ? (a0[6] - a1[2][15]) : (41 > v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v3 = (((i4 < v0) % 6) < ((a0[8] > 44) > (93 % 4)));
+            v0 = (((92 - i4) / 7) * ((a0[0] % 9) < (13 > v3)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v2 * 39) < (v0 >= v0)) + ((a0[5] > a1[1][14]) ? (v3 * v2) : (56 - 38)));
+}
+int main() {
+    return 0;
+}
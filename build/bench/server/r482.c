@@ -0,0 +1,183 @@
+int f0() {
+    int v0 = 20;
+    int v1 = 36;
+    int v2 = 95;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v2 || v0) + (33 < 87)) >= ((16 + v0) < (v1 / 4)));
+            v0 = (((92 ? a1[2][8] : v3) <= (15 || i0)) != ((v3 < v3) ? (a1[3][7] / 4) : (i0 >= 54)));
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v0 = (((v3 && 79) || (v3 / 3)) <= ((a0[7] > 48) || (a1[3][15] != 70)));
+                v1 = (((a1[2][8] <= a1[0][6]) + (i0 / 2)) > ((v1 ? a1[0][1] : 26) ? (83 <= i0) : (a1[3][1] && v2)));
+                a1[0][7] = (((v2 == i0) * (76 != v1)) + ((v1 ? a1[1][4] : a1[3][1]) * (i1 ? v1 : 18)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v3 = (((a1[2][15] % 2) * (a0[14] == 51)) ? ((v0 > 43) != (v1 - i3)) : ((a1[3][7] * v1) < (v2 ? i2 : 80)));
+                v3 = (((v2 >= i2) && (v2 + a0[8])) ? ((v2 && v3) > (i2 ? a0[8] : v1)) : ((i2 == v1) != (a1[0][2] < 38)));
+                v1 = (((v0 || i3) > (v2 == a1[0][13])) % 7);
+            }
+            a0[5] = (((a0[2] < a0[5]) / 6) <= ((a1[2][15] <= 54) > (a0[2] == 29)));
+            a1[3][2] = (((40 ? 54 : i2) >= (v1 * v3)) != ((15 >= a0[14]) <= (a0[6] >= a0[4])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[4] = (((v3 ? v2 : a0[15]) && (v3 + v1)) - ((a1[0][5] - a1[2][8]) >= (a1[0][3] == v0)));
+            {
+                int i5 = 0;
+                while (i5 < 8) {
+                    v1 = (((94 && v1) % 6) <= ((a0[4] / 6) / 8));
+                    a0[3] = (((v1 != v1) ? (v2 != v0) : (v1 < i4)) % 3);
+                    a1[3][12] = (((v1 <= 92) + (3 == a0[5])) != ((a1[0][12] && v1) ? (v2 - v1) : (82 != a0[7])));
+                    i5 = i5 + 1;
+                }
+            }
+            v3 = (((v0 ? i4 : v2) && (v0 < 81)) <= ((v1 && v2) + (a0[12] - v3)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    a0[12] = (((v0 && 50) * (v0 || v3)) ? ((v1 > v2) == (v3 * v0)) : ((97 / 7) * (44 * 87)));
+    v0 = (((35 == v3) ? (a0[8] || 76) : (v1 == 47)) ? ((v2 % 4) > (v3 <= v1)) : ((90 <= v2) || (99 ? a0[2] : a1[0][9])));
+    return (((v1 != v1) < (v1 % 8)) <= ((89 <= v2) ? (a1[0][8] % 2) : (v3 - a0[5])));
+}
+int f1() {
+    int v0 = 12;
+    int v1 = 12;
+    int v2 = 73;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[6] = (((v2 && v3) && (56 / 9)) || ((v1 && 57) >= (i0 == a0[11])));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((50 + i0) ? (a1[1][14] % 2) : (a0[3] ? 52 : 20)) && ((v3 > 45) != (i0 != v3)));
+                    v2 = (((i1 ? i1 : v2) && (i1 < 97)) > ((72 / 6) && (36 + v3)));
+                    a0[3] = (((i0 >= v1) ? (v2 - v3) : (a0[14] + v1)) * ((a1[0][4] - a0[7]) % 4));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v2 / 3) * (a1[3][13] + 83)) < ((v1 + v3) + (v2 / 4)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v1 = (((v2 % 9) && (v0 && a1[2][11])) || ((v1 ? a0[12] : a1[3][10]) % 1));
+            v3 = (((v3 < 82) * (a1[1][9] != 62)) / 6);
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                a0[9] = (((i2 / 5) - (v3 % 9)) * ((81 && a1[3][10]) / 4));
+                v0 = (((82 && a1[1][4]) < (i3 > v0)) ? ((75 + 29) && (v2 - v3)) : ((v0 - v2) ? (23 != a1[2][7]) : (55 <= 49)));
+                a1[2][8] = (((i3 && i3) ? (v0 % 6) : (v2 + v3)) != ((65 && v3) != (3 % 8)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v0 != a0[5]) % 2) < ((76 ? v3 : v1) / 6))) {
+        v2 = (((v2 <= v1) != (29 ? v3 : 93)) + ((v3 / 8) >= (22 == 77)));
+        a0[4] = (((v3 >= 49) > (a0[1] ? v1 : v3)) > ((a1[0][7] + v2) + (a0[14] / 3)));
+        a0[2] = (((v0 < v3) || (57 / 1)) ? ((58 % 1) == (45 <= v1)) : ((v3 <= v1) >= (v1 || v2)));
+    } else {
+        a0[11] = (((13 - v2) >= (v1 == 72)) / 8);
+        v0 = (((v3 < v1) % 4) - ((35 % 1) < (a0[0] != v2)));
+        v1 = (((26 == 57) <= (25 ? 39 : v0)) != ((v3 == v0) < (v0 * v3)));
+    }
+    if ((((v0 + 55) ? (a1[2][9] - 16) : (v0 >= v1)) ? ((v2 >= v1) == (v2 <= v0)) : ((0 % 5) < (v3 <= a0[7])))) {
+        a0[2] = (((a1[0][5] == a1[1][3]) + (v2 % 8)) && ((a1[2][3] || 6) < (32 * v1)));
+        a0[10] = (((v1 || a0[5]) == (v1 <= v0)) && ((37 || v2) ? (96 != v2) : (v0 - 85)));
+        v2 = (((34 - v1) ? (v0 <= v2) : (v0 > v0)) % 1);
+    } else {
+        v0 = (((a0[12] < v3) % 2) <= ((v0 - 67) && (a0[0] == v0)));
+        a0[10] = (((a1[2][11] ? v2 : v2) ? (51 && a0[2]) : (52 / 3)) < ((v2 ? 52 : v0) == (v1 > v1)));
+        a0[1] = (((a0[4] && 90) < (v1 - 80)) && ((8 + a0[7]) > (v0 != v3)));
+    }
+    if ((((21 && v0) + (v2 && a0[1])) != ((a1[3][3] && v3) < (v3 > 51)))) {
+        a0[0] = (((v0 != v3) ? (v2 - 60) : (47 < a1[0][14])) + ((v0 * v1) - (a0[3] && 56)));
+        a0[0] = (((v1 >= v2) ? (a0[2] - v3) : (v2 || a0[3])) && ((v2 || v0) + (v1 != v3)));
+        a1[1][15] = (((a1[0][5] || 57) / 2) / 8);
+    } else {
+        v0 = (((a0[2] * 81) == (v2 && 35)) != ((v2 + a1[2][13]) <= (v0 <= v3)));
+        a1[0][0] = (((v0 != a0[14]) % 8) + ((19 != a0[10]) != (88 && 92)));
+        a1[2][0] = (((a0[9] ? v1 : 78) ? (a0[3] && 68) : (a0[10] - v2)) || ((v1 > a1[1][15]) % 9));
+    }
+    return (((a0[4] + 8) * (a0[8] && 15)) + ((v1 < 85) ? (47 <= v1) : (97 ? 87 : 12)));
+}
+int f2() {
+    int v0 = 84;
+    int v1 = 73;
+    int v2 = 58;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    a1[3][4] = (((v2 <= 56) % 4) <= ((v0 && v3) == (a0[8] + v0)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((v2 > a0[5]) > 65) break;
+        {
+            int i1 = 0;
+            do {
+                a0[13] = (((7 == v3) + (i0 + 43)) + ((i0 <= v2) * (a0[3] * v0)));
+                v0 = (((v2 ? a0[1] : a0[14]) / 8) || ((a0[5] > v3) == (v1 ? a1[1][15] : v2)));
+                v0 = (((80 != v2) != (i0 && 98)) % 2);
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v0 = (((a0[14] != a1[3][10]) == (11 % 6)) && ((v3 >= v3) <= (a1[0][7] < 91)));
+        a0[12] = (((i0 < v2) && (66 || a0[2])) % 5);
+    }
+    if ((((67 / 2) - (v2 < a1[2][1])) != ((v0 == v1) ? (70 - v2) : (16 <= a1[0][15])))) {
+        v0 = (((v2 % 4) != (v0 - 86)) + ((78 ? a0[2] : 50) != (6 == v1)));
+        a1[0][13] = (((75 && v2) > (v2 * 91)) / 4);
+        v3 = (((v3 > v3) == (v1 < v1)) ? ((v1 ? v3 : 82) == (a1[2][13] == v3)) : ((v2 || v0) * (90 || v3)));
+    } else {
+        v3 = (((v0 || a0[15]) == (a1[2][0] < 72)) != ((a0[1] <= a1[3][11]) ? (v3 < v3) : (v2 + 52)));
+        v0 = (((v2 - v1) * (v1 > 79)) % 6);
+        v3 = (((v3 >= v2) / 4) - ((10 % 7) < (v0 && a1[0][13])));
+    }
+    if ((((44 / 7) < (a1[2][5] / 6)) || ((v0 < a1[3][1]) ? (v2 + v0) : (3 + v1)))) {
+        a0[0] = (((v3 && 93) ? (28 ? v0 : v2) : (v2 > v2)) >= ((v1 ? 41 : v0) - (v2 ? v2 : v1)));
+        v2 = (((v1 < v3) * (v3 + a0[1])) * ((75 ? a1[3][11] : v0) ? (a1[2][11] % 2) : (a0[5] == v1)));
+        v1 = (((34 ? v3 : v3) || (1 || a1[1][9])) || ((a1[1][2] <= v0) / 9));
+    } else {
+        v3 = (((v0 != 30) > (v3 < v1)) ? ((v0 * v1) < (v1 % 6)) : ((v1 >= a0[1]) ? (a1[1][10] > a0[4]) : (v1 || v1)));
+        v1 = (((a0[4] ? a1[1][1] : v0) * (v2 * v3)) > ((v3 + v2) / 8));
+        v3 = (((93 <= v2) <= (v3 + 82)) <= ((22 <= a0[5]) % 1));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v1 = (((58 >= 27) + (v2 / 2)) + ((v0 || v1) + (i2 >= 53)));
+            {
+                int i3 = 0;
+                do {
+                    if ((v1 / 4) > 88) break;
+                    a1[1][4] = (((a0[8] ? 45 : v2) * (a1[3][0] <= i3)) == ((v1 / 4) == (v0 - a0[11])));
+                    a1[1][3] = (((v3 % 7) % 4) != ((v2 > v0) != (i2 ? i3 : a1[3][15])));
+                    a0[15] = (((a0[5] ? v3 : i2) >= (i3 * 11)) % 3);
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v1 = (((v0 / 4) >= (v0 >= v2)) != ((v2 % 2) % 9));
+            i2 = i2 + 1;
+        }
+    }
+    return (((a1[0][2] <= v2) ? (a1[2][9] && a0[9]) : (a1[1][2] || v3)) < ((v1 + 10) * (a0[6] * v2)));
+}
+int main() {
+    return 0;
+}
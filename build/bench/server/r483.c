@@ -0,0 +1,63 @@
+int f0() {
+    int v0 = 3;
+    int v1 = 28;
+    int v2 = 17;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((a0[14] && v3) > 69) break;
+        v0 = (((v0 > v2) ? (a0[13] > v1) : (v2 / 2)) * ((v2 >= 42) ? (v1 + a1[1][5]) : (76 != v3)));
+        {
+            int i1 = 0;
+            do {
+                a1[2][1] = (((i0 * a1[1][8]) * (a1[2][0] || v0)) <= ((a0[11] <= v0) + (v3 % 2)));
+                v0 = (((v2 * v0) <= (a1[0][3] >= v2)) ? ((v2 * v3) <= (v0 <= v2)) : ((a0[2] + a1[2][7]) || (i1 % 8)));
+                v3 = (((v2 ? a0[7] : a1[2][12]) >= (v0 - v2)) + ((i0 ? i0 : i1) || (80 - v3)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        a0[15] = (((v2 != 49) * (a1[2][12] - v1)) >= ((v3 && 43) <= (66 > v2)));
+    }
+    a0[4] = (((v3 != a1[3][14]) <= (v0 ? v3 : v1)) / 7);
+    {
+        int i2 = 0;
+        do {
+            if ((66 / 7) > 68) break;
+            v2 = (((v0 == v0) != (29 <= 84)) || ((v1 ? 44 : 2) <= (v0 == 86)));
+            a1[0][0] = (((a1[2][15] == a1[2][14]) < (a0[10] >= v1)) + ((i2 && v0) == (a0[7] <= 91)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v3 = (((a1[3][14] / 7) < (36 + i2)) > ((i2 && v2) % 4));
+                    v3 = (((a0[8] * 13) + (19 >= a1[3][13])) + ((a1[0][0] > 84) == (v1 <= a0[10])));
+                    v1 = (((v1 || a1[3][14]) && (83 && v0)) ? ((a1[2][4] != v1) > (i2 < a1[1][15])) : ((v0 ? a1[1][2] : 57) % 3));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((a0[15] * v0) >= (a1[3][0] <= a1[0][4])) <= ((a1[3][2] % 3) * (v1 <= v1)))) {
+        a1[1][10] = (((v0 > a1[0][3]) || (v2 != 63)) ? ((a0[15] + v1) == (93 == a0[14])) : ((89 ? 1 : v3) < (v1 != 35)));
+        v0 = (((82 != v2) - (a1[3][7] ? 6 : v1)) != ((v3 > a1[3][3]) / 7));
+        v0 = (((v2 / 5) != (a0[9] <= v2)) * ((a1[0][1] / 6) <= (6 == v1)));
+    } else {
+        v3 = (((v3 >= v2) % 9) ? ((v2 + 17) + (v3 && v3)) : ((v3 > a1[1][10]) + (71 > a1[3][2])));
+        a1[1][4] = (((82 ? v2 : a0[11]) && (80 ? a0[0] : v3)) % 5);
+        v3 = (((a0[13] > v0) % 7) || ((v1 >= a1[1][5]) + (v1 >= 33)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v0 = (((80 % 8) / 6) >= ((a1[1][11] * a0[9]) ? (v3 >= a1[1][5]) : (i4 == a0[12])));
+            v0 = (((v0 || 61) * (i4 && 33)) % 1);
+            a1[0][8] = (((a1[2][11] < v3) >= (i4 >= a0[12])) % 1);
+        }
+        v2 = (((2 * v1) / 8) - ((a0[11] == 34) * (a0[1] ? v2 : 11)));
+        v1 = (((v0 ? a1[0][7] : a0[14]) * (v3 - v2)) ? ((v0 * 82) == (v2 + v0)) : ((5 > a0[13]) >= (v1 - a0[8])));
+    }
+    return (((26 % 5) + (a1[1][7] && v2)) - ((a1[2][4] * 25) + (a0[14] > 56)));
+}
+int main() {
+    return 0;
+}
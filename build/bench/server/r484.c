@@ -0,0 +1,112 @@
+int f0() {
+    int v0 = 88;
+    int v1 = 52;
+    int v2 = 54;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    if ((((35 == a0[3]) < (v2 + 91)) ? ((v0 + v3) ? (v0 > v1) : (a0[1] / 9)) : ((v1 - 67) - (v1 > a1[0][3])))) {
+        a0[6] = (((a1[0][5] < v2) || (v1 * a1[2][4])) >= ((a0[10] == v2) < (a0[15] || v3)));
+        v0 = (((v3 - v0) / 3) && ((v1 != v3) / 9));
+        v0 = (((v3 == a0[14]) || (7 == a1[1][1])) ? ((95 <= v1) % 3) : ((35 + v1) * (22 / 7)));
+    } else {
+        v1 = (((a1[1][11] == v3) < (78 >= 28)) / 7);
+        v2 = (((v2 * a1[0][11]) ? (v1 - a1[0][5]) : (v1 ? a1[0][0] : v3)) / 4);
+        v2 = (((v1 % 4) - (v0 / 4)) && ((a1[0][10] * 7) / 8));
+    }
+    if ((((v0 <= v1) % 9) % 6)) {
+        a0[9] = (((v1 > v2) < (v1 / 1)) - ((a1[0][0] >= 13) < (a1[3][6] <= v0)));
+        v1 = (((v0 ? v2 : 40) ? (61 % 3) : (a1[0][11] <= v0)) % 3);
+        a1[1][3] = (((a0[11] >= v2) == (14 ? v1 : a0[2])) ? ((v1 ? v3 : 10) == (v1 ? 30 : 39)) : ((50 * 23) != (a1[3][9] >= v2)));
+    } else {
+        a1[3][14] = (((a1[3][15] * v1) == (a1[0][3] != v2)) ? ((v3 || v2) + (v1 * a1[1][12])) : ((v2 / 6) % 5));
+        v2 = (((v2 && v0) + (v0 && 17)) * ((v3 ? v0 : v1) != (a0[1] ? v3 : 16)));
+        v0 = (((9 >= 84) <= (a0[11] == 15)) ? ((v1 ? v2 : a1[1][15]) != (v0 ? v0 : 38)) : ((a0[4] >= v2) && (v0 / 3)));
+    }
+    a0[11] = (((v0 ? v3 : v1) + (25 >= v0)) + ((v3 >= a1[2][15]) != (v3 == a1[3][2])));
+    if ((((v0 % 6) + (91 ? 73 : v0)) - ((49 % 7) * (a1[1][12] % 9)))) {
+        v3 = (((v0 ? 46 : v3) ? (a0[14] % 4) : (a0[9] >= a0[6])) < ((a1[0][11] + v0) ? (v1 % 1) : (61 ? v0 : v0)));
+        v3 = (((v0 ? a0[3] : v1) >= (v0 % 6)) % 3);
+        v0 = (((v3 % 7) != (a1[2][5] >= 31)) - ((a1[2][13] % 9) >= (v2 + v1)));
+    } else {
+        a1[3][14] = (((a0[9] || 64) || (a1[1][14] ? v0 : a1[1][2])) / 4);
+        v0 = (((v3 ? a0[0] : a1[2][9]) > (a1[2][12] || a0[11])) % 5);
+        v2 = (((5 || v0) % 4) < ((a1[1][1] != 67) % 3));
+    }
+    if ((((v0 == a1[1][11]) < (a0[11] < v0)) ? ((v0 % 4) >= (a0[0] % 7)) : ((v1 ? a1[2][1] : v1) != (a0[6] + 78)))) {
+        a1[1][10] = (((39 >= v0) > (18 != a0[8])) && ((a1[1][7] <= 59) % 7));
+        v3 = (((v2 + 11) - (v0 > v1)) ? ((v3 && 46) && (27 - a1[1][14])) : ((a1[3][11] / 3) + (v3 < 27)));
+        a0[1] = (((a0[12] + v2) / 5) || ((94 >= a0[12]) || (v2 || v1)));
+    } else {
+        a0[7] = (((v1 ? v2 : v3) || (a1[3][0] == v3)) != ((v1 < a0[3]) != (a0[12] * v2)));
+        v0 = (((15 >= v2) - (a0[5] / 8)) >= ((a1[0][15] < a1[0][15]) * (v1 ? v2 : 3)));
+        v0 = (((v2 && 95) > (a1[1][2] + 22)) + ((91 < a0[7]) + (v3 * a1[0][11])));
+    }
+    return (((v0 <= v1) ? (v1 > a1[3][13]) : (v2 % 6)) - ((v1 != v1) - (v1 <= v2)));
+}
+int f1() {
+    int v0 = 61;
+    int v1 = 89;
+    int v2 = 15;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v0 / 4) == (v3 - a0[0])) + ((v3 != 39) % 6));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((a1[3][6] || i1) > 68) break;
+                a0[6] = (((i0 != a1[1][8]) * (a0[1] < 47)) / 1);
+                a1[2][3] = (((91 != a1[2][4]) >= (i1 <= a1[3][6])) != ((a1[0][5] && 69) && (i1 ? i1 : a0[15])));
+                a1[2][4] = (((a0[6] || a0[8]) + (v0 == i0)) / 2);
+            }
+            v1 = (((56 >= 24) ? (a0[14] != v3) : (i0 == v2)) >= ((v3 ? v2 : i0) == (v1 <= 9)));
+            v2 = (((v3 ? v0 : v2) / 6) + ((i0 ? a1[1][11] : v1) && (i0 - a0[8])));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((59 != a1[0][2]) + (31 + a1[2][6])) < ((v0 ? v2 : 45) <= (12 || v2)))) {
+        v3 = (((76 <= v0) ? (v0 ? 99 : v0) : (v3 ? v0 : a0[7])) % 9);
+        v2 = (((v1 ? a0[1] : v2) != (v0 <= v3)) * ((a1[1][13] ? v0 : v2) + (v0 && v0)));
+        v1 = (((a0[15] <= a1[0][8]) * (v0 ? v3 : v2)) >= ((a1[3][0] || 0) * (v2 != a1[2][7])));
+    } else {
+        a1[2][5] = (((a0[0] / 5) ? (64 <= v1) : (v1 >= v3)) || ((v0 == a0[13]) != (v2 + v2)));
+        a0[14] = (((v0 ? v1 : v1) ? (35 < 55) : (25 || a1[2][1])) - ((v1 != 63) < (a1[0][12] <= v1)));
+        v2 = (((97 && v2) + (v3 == a0[6])) && ((a1[3][14] ? v3 : v2) == (v3 || a1[2][14])));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v0 = (((v0 <= 40) ? (v0 >= v1) : (v0 * 26)) && ((i2 ? a1[2][9] : i2) < (32 || 32)));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v1 = (((v2 >= a0[11]) <= (31 && v1)) < ((v2 != 2) - (v2 > 82)));
+                v1 = (((i3 <= 0) >= (a0[12] || v1)) ? ((v1 && v2) > (50 < 54)) : ((87 && a1[3][3]) && (v1 != i3)));
+                v3 = (((a0[8] != v0) * (v2 == i3)) - ((a1[1][8] + 53) || (a1[2][12] ? i2 : i3)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[14] = (((95 > v2) - (v2 * a0[0])) || ((32 + i2) || (i2 * v0)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a0[12] > a0[9]) != (i4 % 7)) / 3);
+            v0 = (((v3 != a0[10]) * (v3 + i4)) > ((v0 >= a0[0]) != (a0[4] >= v1)));
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((v1 > v1) - (v2 == i4)) < ((a0[15] / 1) - (10 < v2)));
+                    a1[3][2] = (((26 == v3) / 9) ? ((a0[6] * v0) <= (i5 < a1[3][5])) : ((48 ? i4 : 30) + (i5 ? v1 : i4)));
+                    a1[2][1] = (((v0 + v3) == (29 * 97)) + ((40 / 5) && (36 ? 16 : v1)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((35 < a1[2][4]) % 9) && ((55 % 4) + (v0 * v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,198 @@
+int f0() {
+    int v0 = 68;
+    int v1 = 16;
+    int v2 = 4;
+    int v3 = 82;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v0 - 55) < (v0 % 5)) ? ((25 < a0[13]) ? (v1 + v0) : (21 - v3)) : ((v2 + v2) && (a0[7] * v3)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        v2 = (((v1 % 3) >= (74 == v1)) - ((v2 && 18) <= (i0 || 74)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            v0 = (((43 == a1[3][5]) % 7) != ((v0 > a0[4]) + (46 ? 62 : v3)));
+            a0[7] = (((6 * a1[1][10]) + (73 * i0)) > ((12 % 3) > (v0 < 35)));
+            v2 = (((i1 / 9) != (v2 ? a0[4] : i1)) != ((v3 ? a1[1][11] : 9) >= (a0[5] || 15)));
+        }
+        v3 = (((54 > v1) > (38 > v3)) / 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a0[5] = (((13 + v3) > (v0 >= i3)) && ((v1 >= v3) <= (v2 || a0[3])));
+                v2 = (((a1[3][14] - 80) / 4) / 4);
+                v2 = (((i3 || i3) - (i3 <= v2)) >= ((a1[2][3] || a1[1][3]) <= (v3 / 9)));
+            }
+            v2 = (((68 < v0) == (i2 * v0)) - ((v0 - v1) % 3));
+            v2 = (((v1 ? v1 : i2) * (v3 ? a0[14] : 6)) <= ((11 + a1[1][4]) < (a0[6] <= v1)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((6 * v1) / 8) * ((v1 && a0[10]) < (v1 != v1)))) {
+        a1[3][13] = (((v2 / 1) == (v1 / 4)) == ((a1[0][10] - v3) == (v3 >= a1[0][2])));
+        v0 = (((97 / 9) + (a0[11] && 66)) > ((v3 + v2) - (v3 ? a0[10] : a0[8])));
+        a1[2][3] = (((v2 == a0[0]) || (v2 / 3)) <= ((a1[0][4] ? v1 : v3) % 2));
+    } else {
+        a1[0][14] = (((v2 < v1) < (31 && v3)) ? ((95 % 3) + (v0 ? v3 : 75)) : ((v1 != a0[0]) && (66 >= 55)));
+        a0[12] = (((v1 < a1[2][13]) % 5) ? ((a0[3] ? 43 : v3) / 4) : ((v2 ? v1 : v2) + (v0 / 5)));
+        a1[0][15] = (((78 + v3) || (73 > v0)) ? ((53 && 30) > (a1[0][8] - a1[2][7])) : ((5 * v0) && (40 > a1[0][13])));
+    }
+    v0 = (((v3 + v3) ? (v2 <= a1[1][15]) : (a0[11] ? v1 : a0[8])) ? ((99 ? 84 : a1[3][1]) <= (v1 || v1)) : ((v0 && v1) ? (v2 ? v1 : v1) : (v2 < v1)));
+    return (((a1[1][15] && v1) / 3) > ((v1 * v1) != (a0[14] < v0)));
+}
+int f1() {
+    int v0 = 6;
+    int v1 = 56;
+    int v2 = 63;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((i0 % 7) || (i1 / 2)) >= ((i1 && i1) * (56 && 28)));
+                    v1 = (((a1[2][12] < i1) - (a0[1] != 48)) ? ((45 > v2) % 3) : ((i1 ? i1 : v1) ? (v3 ? v3 : a0[6]) : (a0[11] ? 67 : a0[2])));
+                    v0 = (((a1[0][12] && 59) ? (a1[3][6] > v0) : (i0 > a0[15])) * ((81 ? v0 : v0) || (v0 && a1[1][9])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            v2 = (((v2 / 2) >= (v2 > a1[1][8])) == ((v3 / 8) >= (a0[9] > v0)));
+            a0[12] = (((v1 < a1[3][2]) && (73 * i0)) < ((a0[2] > a0[13]) * (v0 == a1[2][2])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[3] ? v1 : a1[2][9]) < (v0 - a1[2][7])) + ((90 + a1[2][10]) == (89 > 54)))) {
+        a1[0][2] = (((v1 < v0) + (86 % 5)) == ((v0 < v0) && (v1 >= v2)));
+        a1[1][15] = (((34 - 8) <= (9 != 21)) - ((a1[1][3] / 4) && (52 + a1[1][5])));
+        v2 = (((v2 + v2) < (a0[3] == v2)) / 5);
+    } else {
+        a1[0][12] = (((v2 <= v0) ? (a1[3][12] >= v2) : (a1[0][2] - v3)) * ((v2 * v2) || (80 + v2)));
+        a1[0][0] = (((v1 == v3) != (v0 >= 52)) + ((v3 || v1) > (v3 / 6)));
+        v0 = (((v2 < v2) && (v3 ? 84 : v1)) * ((v3 ? a1[3][14] : v3) <= (36 - v0)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((a1[3][14] || i3) && (i3 >= a0[1])) && ((33 * a0[10]) % 7));
+                    a0[10] = (((i2 - a1[3][6]) == (61 < v1)) > ((v3 && i3) != (i3 != v1)));
+                    a0[15] = (((v3 + i2) == (v2 || a1[3][0])) <= ((v2 >= a0[5]) < (7 - a0[7])));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v0 = (((a0[10] % 3) ? (a0[7] >= a1[0][0]) : (a0[10] ? v0 : a1[0][12])) + ((v2 / 5) == (v2 && 37)));
+            v3 = (((v1 == a1[1][7]) / 5) != ((a1[3][8] / 3) ? (75 < v0) : (v2 * i2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((61 < v2) > 79) break;
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                v1 = (((87 || i4) < (i5 + a0[0])) == ((v3 >= a0[11]) ? (94 / 1) : (v3 < v1)));
+                a1[1][11] = (((30 != 90) != (v1 + a0[1])) ? ((36 + i5) / 8) : ((a0[13] % 6) >= (v2 ? 78 : i5)));
+                v3 = (((i5 ? v1 : v3) - (v3 && 94)) + ((v2 < i4) != (a0[8] != 77)));
+            }
+            v3 = (((8 <= v2) == (v2 / 5)) && ((84 - a0[0]) < (i4 / 6)));
+            v2 = (((a0[7] != v2) ? (v0 - i4) : (a0[3] ? a0[9] : a0[7])) <= ((a1[1][2] == a0[3]) <= (a1[1][8] ? v2 : 90)));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v2 < 27) > 80) break;
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    if ((v0 != v0) > 69) break;
+                    a1[2][12] = (((v3 != 17) ? (a0[2] < a1[3][0]) : (i7 && 37)) || ((a0[6] == 61) + (a0[13] == 89)));
+                    v1 = (((5 || a1[0][8]) ? (v0 - v0) : (a1[1][11] % 4)) + ((a1[0][7] ? i6 : i6) ? (a1[1][0] <= a1[0][9]) : (i7 - a1[0][13])));
+                    v3 = (((a1[1][3] * i7) < (98 ? i6 : i6)) || ((24 == v1) ? (i6 > v0) : (v3 == a0[0])));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((a1[1][10] > v1) ? (50 / 8) : (36 == v1)) > ((v2 - a1[2][2]) && (v0 == a0[14])));
+            a1[1][2] = (((84 < a1[1][14]) && (a1[1][6] != v1)) - ((a1[1][13] > a0[11]) - (v2 ? 21 : a1[1][2])));
+            i6 = i6 + 1;
+        } while (i6 < 7);
+    }
+    return (((a0[0] / 3) >= (a1[0][6] > v3)) < ((v1 / 9) < (56 < a1[1][7])));
+}
+int f2() {
+    int v0 = 16;
+    int v1 = 94;
+    int v2 = 5;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v3 = (((a0[15] - v1) + (66 % 9)) <= ((49 - v3) ? (v2 >= a0[0]) : (32 || v2)));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            v3 = (((v2 == v2) > (a1[2][6] <= v2)) * ((a1[1][0] % 1) ? (81 ? v3 : v1) : (v3 ? 56 : v2)));
+            v3 = (((4 ? a1[1][14] : i0) == (v0 * a0[1])) * ((a1[2][10] ? a0[9] : 65) != (a1[0][4] != v3)));
+            a0[8] = (((a0[8] > 90) / 9) && ((v1 + 62) - (a1[2][0] > i1)));
+        }
+        v2 = (((v2 > v0) < (v1 ? v1 : i0)) ? ((v0 || v1) < (v3 * v0)) : ((v2 <= a0[11]) / 7));
+    }
+    v0 = (((v3 / 5) >= (25 && 89)) % 6);
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v1 = (((25 >= v1) * (v2 > v0)) < ((a0[9] ? a0[12] : a0[6]) * (60 - a1[0][7])));
+        a0[11] = (((a0[13] || i2) * (v1 - a1[1][6])) == ((68 * v1) % 4));
+        {
+            int i3 = 0;
+            while (i3 < 4) {
+                a1[3][6] = (((30 == v3) > (61 <= v3)) + ((v2 > i3) ? (a0[6] && v1) : (47 > a0[12])));
+                v3 = (((42 * i3) || (v0 % 9)) ? ((a1[0][15] >= a0[6]) == (a1[0][12] || v0)) : ((a0[7] || v1) > (i3 != i3)));
+                v1 = (((72 == i2) + (15 + i2)) >= ((v1 == a1[0][14]) >= (42 == 75)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[11] = (((v0 % 1) - (v3 && v0)) * ((v2 ? v2 : i4) - (a1[0][11] + 94)));
+            v2 = (((95 * v1) <= (i4 >= a1[1][6])) * ((a1[3][4] >= v1) || (59 != v1)));
+            {
+                int i5 = 0;
+                do {
+                    a1[0][15] = (((v1 / 7) > (v1 % 5)) < ((v2 % 8) + (57 >= i5)));
+                    a1[2][6] = (((v0 ? i5 : a1[0][7]) <= (i5 * a0[7])) != ((i5 / 2) == (i5 * a1[3][12])));
+                    v2 = (((a0[9] ? v1 : 98) < (a0[15] - i5)) * ((a1[3][15] || v1) || (v0 > v3)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v1 <= a1[3][1]) > 96) break;
+            v2 = (((97 < v1) > (21 - v1)) - ((85 ? 23 : 7) % 3));
+            a0[5] = (((v1 ? 42 : a0[14]) > (v0 % 6)) < ((37 > a0[10]) == (a0[13] * a0[1])));
+            {
+                int i7 = 0;
+                while (i7 < 2) {
+                    if ((v3 <= v0) > 92) break;
+                    v2 = (((i7 ? a0[11] : i7) || (a1[3][9] ? i7 : i6)) - ((a1[2][12] < v0) < (77 != v3)));
+                    a1[2][7] = (((v2 && v1) || (v3 ? v1 : a0[8])) == ((68 || i6) < (81 && v1)));
+                    a0[7] = (((v1 >= v1) ? (a0[8] ? i6 : a1[2][7]) : (v2 && v1)) + ((v2 * i6) ? (73 || 27) : (v1 ? i7 : v2)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        } while (i6 < 6);
+    }
+    return (((v0 + a1[3][15]) / 2) - ((v2 ? v1 : a0[14]) == (a0[8] >= 98)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,62 @@
+int f0() {
+    int v0 = 9;
+    int v1 = 71;
+    int v2 = 57;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[13] / 6) % 4) || ((v2 >= v3) > (a0[0] == 42)))) {
+        v0 = (((v0 < 77) == (v0 ? a1[1][11] : a1[1][6])) && ((7 >= v0) >= (v2 == v2)));
+        v0 = (((v0 >= v1) && (v0 <= v1)) != ((40 && v1) - (v2 ? 29 : v3)));
+        v1 = (((v3 >= v2) - (v0 <= 87)) % 2);
+    } else {
+        v2 = (((v2 + v2) != (a1[1][6] && 59)) == ((89 * v3) >= (v1 % 1)));
+        a0[4] = (((v3 * v1) > (v3 % 9)) * ((a1[1][2] ? v0 : 70) ? (v1 != 42) : (9 != v0)));
+        v0 = (((v0 ? v3 : 45) + (a1[1][12] <= v3)) / 6);
+    }
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        if ((a1[1][9] || 29) > 63) break;
+        v0 = (((v0 == v0) != (a0[8] ? 76 : v1)) ? ((a0[14] && 91) != (v2 >= 67)) : ((93 == 68) % 1));
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                a1[3][11] = (((36 ? i0 : i1) * (41 * a1[3][9])) + ((i1 && 49) || (i1 > i0)));
+                a1[0][11] = (((i1 - i0) >= (a0[3] || a0[11])) == ((82 && 45) || (5 * 63)));
+                v2 = (((v1 >= a0[15]) * (v3 > v1)) + ((v0 % 9) <= (a1[1][11] > 22)));
+                i1 = i1 + 1;
+            }
+        }
+        a1[3][4] = (((a0[1] - 82) ? (43 < i0) : (v2 * i0)) / 3);
+    }
+    if ((((v1 || v0) >= (58 / 7)) / 9)) {
+        v1 = (((v0 == a1[3][12]) ? (v0 * 13) : (v3 <= v1)) ? ((64 / 4) == (v0 - v0)) : ((a0[6] >= v3) - (34 * v2)));
+        v2 = (((a1[2][9] + v0) + (60 ? a1[3][11] : 9)) >= ((v3 && v1) > (v1 / 6)));
+        v3 = (((18 ? a1[3][6] : v3) % 6) && ((47 || v3) * (v1 / 7)));
+    } else {
+        a0[2] = (((v0 == a0[5]) > (92 >= v3)) ? ((a1[2][1] != v2) < (84 ? 2 : v1)) : ((v0 - v1) <= (v2 || v2)));
+        a1[3][15] = (((v3 != 0) / 6) || ((v3 < v1) % 4));
+        v1 = (((35 != a0[1]) != (a0[1] < a0[0])) == ((v1 > 28) + (v3 >= a1[1][9])));
+    }
+    if ((((v3 != v1) != (v1 > v2)) > ((a0[4] >= a0[10]) / 7))) {
+        a1[0][7] = (((21 == a1[1][7]) == (9 < v0)) / 3);
+        v1 = (((97 - v2) * (33 - 71)) && ((v0 == a0[4]) ? (v1 % 9) : (a0[9] * a1[2][7])));
+        a1[2][13] = (((v2 < a0[7]) < (75 * 9)) ? ((v1 || 22) % 8) : ((v3 % 2) >= (a1[3][14] != v1)));
+    } else {
+        a1[0][3] = (((v3 * a1[3][15]) - (v3 / 5)) == ((v2 % 6) / 2));
+        a1[3][8] = (((a1[2][14] % 9) || (v0 > a1[1][2])) == ((a1[0][5] ? v0 : 7) - (69 && v0)));
+        a0[15] = (((v1 || v0) ? (a1[3][9] / 1) : (30 >= v1)) * ((a0[11] + a0[9]) >= (v2 && v0)));
+    }
+    if ((((v1 * v3) % 6) / 6)) {
+        v3 = (((v1 || v1) > (v1 == v2)) >= ((a0[2] < a0[3]) ? (v0 || 18) : (v2 + a1[3][8])));
+        a0[10] = (((13 - 36) <= (v2 == 56)) || ((a1[1][14] > 60) != (70 - v2)));
+        v0 = (((82 % 2) || (v3 >= a1[2][8])) == ((99 != 67) ? (v3 != v3) : (a1[0][6] < 6)));
+    } else {
+        v1 = (((6 / 2) || (a1[1][7] - 25)) > ((59 ? v2 : 81) && (56 && a1[0][13])));
+        v3 = (((v3 && 82) % 8) >= ((v3 >= v2) == (v2 / 1)));
+        v1 = (((31 + v1) + (a1[0][9] - a0[5])) < ((v1 - v0) < (a1[0][8] - a1[3][10])));
+    }
+    return (((v3 || v2) > (a0[11] - v0)) * ((v0 < 60) / 3));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,130 @@
+int f0() {
+    int v0 = 71;
+    int v1 = 89;
+    int v2 = 76;
+    int v3 = 35;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 / 4) < (v1 ? v2 : 0)) == ((29 ? v1 : a0[13]) != (15 / 2)));
+            {
+                int i1 = 0;
+                do {
+                    a1[0][0] = (((v0 || i1) >= (v3 % 9)) <= ((a0[1] <= i1) % 8));
+                    a1[2][5] = (((79 && v0) || (a0[9] - 35)) || ((i1 <= v2) - (i1 < v2)));
+                    v0 = (((i0 ? i0 : a1[0][13]) != (a0[3] <= 17)) ? ((v2 >= v1) + (50 == i1)) : ((a0[0] - 36) && (v2 < 17)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v0 = (((v0 * v0) ? (a1[1][1] >= a0[11]) : (v0 / 1)) > ((v0 > a1[3][11]) > (v2 - v3)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v3 = (((25 * v1) <= (30 == 33)) / 2);
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                if ((i3 <= a0[10]) > 64) break;
+                v3 = (((a1[2][11] && v2) ? (29 % 7) : (v3 - v3)) <= ((a0[6] <= v2) ? (v2 ? v3 : 15) : (v1 * 60)));
+                a1[3][9] = (((45 != i2) != (v1 ? v3 : a1[1][9])) % 8);
+                a1[2][1] = (((40 - 61) <= (a1[3][11] * v2)) ? ((20 / 2) * (a1[3][12] + a1[3][12])) : ((v1 >= a1[0][0]) && (v1 / 4)));
+            }
+            v1 = (((v2 && 50) != (v0 - v3)) && ((v0 || a0[0]) > (21 - v2)));
+            a1[0][15] = (((v2 == v0) / 4) * ((a1[1][13] % 2) >= (a0[14] != v1)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v0 = (((v2 ? 30 : a1[2][9]) > (1 != v3)) + ((a0[2] != i4) && (v1 * v1)));
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                v1 = (((a1[0][9] > a0[1]) + (v0 >= i4)) < ((a1[1][13] + v0) > (v2 < a1[0][3])));
+                v1 = (((v2 ? i5 : 90) * (a1[0][5] == v1)) != ((a0[5] ? a1[1][7] : a1[1][10]) ? (a0[2] / 5) : (a0[9] - 41)));
+                a0[2] = (((i4 == a1[1][2]) + (a1[3][3] <= a0[11])) == ((i4 < i5) % 1));
+                i5 = i5 + 1;
+            }
+        }
+        v1 = (((i4 <= v3) ? (v3 > a0[0]) : (v3 <= a1[0][7])) ? ((v1 ? v2 : v0) % 4) : ((v0 > a1[2][12]) < (v3 / 2)));
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+            if ((a0[4] + 89) > 80) break;
+            v2 = (((v1 / 5) == (v0 < v3)) ? ((a0[8] && a0[7]) <= (23 ? v3 : i6)) : ((v1 > v1) ? (v2 ? a1[0][3] : 19) : (a1[2][5] % 5)));
+            v3 = (((74 * v2) == (v3 / 7)) / 3);
+            a0[14] = (((a1[1][3] % 7) <= (i7 ? a0[10] : a0[11])) ? ((a1[0][5] ? a0[7] : i6) > (v3 ? i7 : v0)) : ((i6 * a1[1][6]) == (a0[4] - v3)));
+        }
+        a0[15] = (((95 >= 30) >= (56 == a0[7])) && ((v0 < a0[4]) > (85 != v0)));
+        v3 = (((v1 - i6) || (v2 * i6)) > ((i6 <= v0) / 4));
+    }
+    return (((57 ? 23 : a1[0][15]) - (69 != v3)) != ((v1 <= a1[2][9]) == (a0[9] / 8)));
+}
+int f1() {
+    int v0 = 25;
+    int v1 = 25;
+    int v2 = 29;
+    int v3 = 22;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 * 55) == (v1 == v3)) && ((a0[11] || 43) || (a1[1][11] >= v3)))) {
+        v2 = (((56 <= v1) <= (v2 * v2)) + ((72 - v3) < (66 / 7)));
+        v2 = (((v1 > v1) && (v1 * v3)) ? ((40 && a0[11]) ? (v3 == v2) : (v2 * 63)) : ((40 ? v2 : v1) * (a0[8] + v0)));
+        v2 = (((v3 * 9) - (a0[5] == v2)) && ((v0 % 1) || (81 < v1)));
+    } else {
+        v0 = (((a1[2][13] > 2) <= (72 && v1)) + ((v3 >= 52) * (84 ? v0 : a0[13])));
+        v1 = (((v1 < 80) / 8) == ((77 == 93) > (86 <= 69)));
+        a0[2] = (((v1 && v3) >= (a0[3] < v3)) % 1);
+    }
+    if ((((a0[0] > v1) ? (a0[2] != a1[3][0]) : (20 > a1[2][7])) ? ((v2 % 5) + (v2 != v2)) : ((v2 < a0[4]) == (9 <= a1[3][2])))) {
+        a0[13] = (((v1 - v1) > (v0 + v0)) || ((v0 - 15) || (v1 == v0)));
+        v2 = (((21 ? v1 : v2) != (v1 != v1)) > ((v1 < v2) - (v0 <= v0)));
+        a0[14] = (((v3 ? v3 : v2) && (a1[3][15] < v3)) + ((v1 % 3) % 3));
+    } else {
+        a0[5] = (((a0[0] <= 17) <= (v2 * a0[2])) && ((v3 <= a1[0][5]) == (a1[2][3] + v0)));
+        v3 = (((v1 || v0) % 4) <= ((v1 + v2) * (v1 == v0)));
+        a0[12] = (((v2 || 74) + (a0[0] > v2)) > ((v1 * v2) % 4));
+    }
+    if ((((v1 ? v0 : v0) != (a1[2][3] % 9)) ? ((45 ? 84 : v0) * (v1 || v3)) : ((a1[1][5] - a0[11]) == (85 || a0[14])))) {
+        v3 = (((74 + v1) >= (a0[2] != v0)) || ((a0[4] || v1) >= (v3 - v3)));
+        v3 = (((v1 ? v3 : v1) ? (a1[1][7] / 7) : (73 != v3)) != ((v1 > v2) < (20 && v3)));
+        a0[5] = (((v3 ? v2 : v0) && (v2 <= 11)) + ((v1 * 70) % 7));
+    } else {
+        a0[2] = (((7 * a0[11]) && (20 < 34)) > ((v3 && v1) || (a1[0][10] ? 13 : v1)));
+        v1 = (((25 || v0) != (84 / 6)) > ((v0 >= v3) - (76 >= 51)));
+        v2 = (((v0 ? v1 : 83) || (48 + 83)) <= ((v1 * 93) - (a1[1][12] == 0)));
+    }
+    if ((((a0[2] ? v1 : v1) + (63 && 37)) ? ((6 * 88) * (v0 + v2)) : ((a1[1][13] && a1[0][14]) * (a1[0][4] || v2)))) {
+        v3 = (((a0[10] <= v3) && (99 % 3)) || ((v3 - v3) / 9));
+        a0[5] = (((v0 != a1[3][5]) != (v1 ? a1[0][3] : v2)) && ((v1 * v0) ? (a1[1][15] ? v1 : a1[3][4]) : (38 || a1[2][13])));
+        a0[1] = (((v3 - v1) != (v1 ? v1 : v1)) != ((a1[1][5] < v1) || (a1[2][12] ? v3 : v1)));
+    } else {
+        v2 = (((v3 * a1[0][13]) && (v1 != v3)) > ((v2 >= a1[1][8]) > (a0[14] ? v2 : v3)));
+        a1[2][10] = (((v3 ? a1[1][4] : 87) && (24 / 9)) + ((v2 / 8) && (v0 / 1)));
+        v1 = (((v0 % 7) - (v1 * v2)) && ((a0[6] + v1) && (v3 <= v1)));
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((21 % 7) > 64) break;
+            a1[0][11] = (((i0 * a1[2][9]) / 3) == ((66 != a1[2][3]) != (v3 % 5)));
+            v3 = (((51 / 3) + (i0 || v0)) != ((52 > i0) % 9));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v0 = (((9 / 6) && (46 + a0[0])) * ((i0 < v1) < (v0 ? 3 : v0)));
+                    a0[14] = (((31 ? i1 : v2) < (i0 * 73)) % 6);
+                    a0[15] = (((a1[1][9] <= v2) >= (v1 == i1)) ? ((a1[1][7] || i1) == (v2 || i1)) : ((a1[0][13] == a1[0][6]) * (53 && v2)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    return (((a1[1][11] && v1) <= (v2 * 96)) != ((v3 != v3) / 8));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,180 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 93;
+    int v2 = 6;
+    int v3 = 26;
+    int a0[16];
+    int a1[4][16];
+    a0[10] = (((38 - a0[3]) && (v2 < 37)) != ((v2 % 8) == (v0 ? a0[13] : 4)));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        v1 = (((v2 + a0[5]) - (16 && v0)) < ((a1[3][1] != v2) >= (a1[0][10] > a0[0])));
+        {
+            int i1 = 0;
+            while (i1 < 5) {
+                v2 = (((25 && v1) % 1) == ((i1 ? a1[0][3] : i1) > (a0[10] >= 10)));
+                v1 = (((78 ? v3 : a0[14]) > (a1[0][6] - i0)) && ((i1 != 37) && (v2 * a0[1])));
+                v0 = (((v3 / 8) * (v1 - i0)) % 1);
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((a0[0] > 10) - (97 % 9)) * ((98 ? a1[0][7] : i0) >= (v3 / 7)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v2 = (((46 <= v1) + (v1 && v1)) ? ((99 > v0) / 3) : ((a0[15] && a1[1][2]) == (a1[0][5] * a0[2])));
+                a0[2] = (((i3 < 39) != (i2 || a0[7])) + ((19 * 23) * (v1 || v2)));
+                v0 = (((26 >= a0[2]) == (i3 > i3)) == ((a0[11] == i2) <= (v0 == v0)));
+                i3 = i3 + 1;
+            }
+        }
+        v1 = (((v3 ? a1[3][3] : v0) / 8) ? ((13 ? a0[1] : 72) == (25 ? i2 : v0)) : ((v0 >= a1[0][0]) || (a0[13] - v1)));
+        v1 = (((a0[15] >= v1) - (v3 * a0[9])) == ((v1 + 44) || (25 < a0[13])));
+    }
+    if ((((a0[9] ? 75 : v3) < (a0[8] && v1)) == ((a1[2][13] != a0[8]) * (a0[4] || 98)))) {
+        v2 = (((v3 <= v1) / 6) ? ((v2 + 35) ? (v2 > v1) : (27 <= v2)) : ((v0 > v2) == (v0 ? a1[3][1] : v0)));
+        a0[1] = (((32 != v2) ? (v2 ? 86 : a0[6]) : (v2 - v2)) * ((a0[0] || a1[0][4]) > (6 && a0[15])));
+        v1 = (((33 < v1) > (v0 >= v2)) == ((90 || 66) < (v1 <= v3)));
+    } else {
+        a0[5] = (((29 <= 76) && (v1 > v0)) < ((48 != 55) ? (71 || 80) : (v0 ? v1 : v3)));
+        v0 = (((7 != v3) % 2) && ((40 - v1) + (v0 - 39)));
+        v3 = (((v2 || v0) < (3 || a0[12])) < ((61 || 35) / 6));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            a0[15] = (((a0[15] || v1) <= (a0[13] - a0[9])) * ((23 == 92) * (0 / 3)));
+            {
+                int i5 = 0;
+                do {
+                    a0[1] = (((a1[3][13] ? v2 : i4) != (i5 < v3)) / 5);
+                    a0[4] = (((v1 ? v1 : v0) % 2) * ((v3 != v1) >= (0 / 4)));
+                    v0 = (((v2 * 4) ? (70 - 24) : (v3 <= a0[8])) == ((40 ? 35 : a1[0][12]) < (a0[5] / 6)));
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            v1 = (((v2 >= a0[2]) != (94 / 2)) ? ((a1[1][1] % 6) || (a0[6] ? v2 : v0)) : ((a1[1][15] || 21) > (v3 || i4)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((77 < v0) > (a1[3][13] ? a1[1][11] : v3)) + ((v1 ? v3 : v2) || (a0[13] <= a1[2][3])));
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 87;
+    int v2 = 10;
+    int v3 = 12;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][8] ? v2 : a0[6]) || (a1[3][9] >= a1[2][1])) + ((v3 >= 38) % 9))) {
+        a0[1] = (((v0 <= v2) % 9) + ((a1[2][0] / 3) <= (36 - v2)));
+        v3 = (((a0[9] * 22) <= (v3 > v1)) || ((v0 ? v0 : v2) ? (v0 >= a1[3][1]) : (99 ? a0[4] : v3)));
+        v2 = (((v2 > a1[1][1]) / 4) <= ((v0 * v2) != (77 / 5)));
+    } else {
+        v1 = (((v1 - 87) >= (3 && v0)) >= ((a1[1][4] - a1[0][4]) > (a1[0][8] != 32)));
+        v0 = (((v2 - v0) ? (56 || v2) : (v0 * v2)) - ((29 < v0) < (a1[1][15] / 3)));
+        v2 = (((a1[0][10] == 96) > (98 ? v3 : a1[2][15])) % 8);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((50 / 7) > 62) break;
+            a0[14] = (((v3 == a1[1][13]) % 5) > ((v1 == a1[0][9]) / 5));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a1[2][4] = (((a1[2][1] + a1[0][7]) != (v2 - i0)) != ((i0 == 75) / 7));
+                v3 = (((a1[1][11] + a0[2]) ? (38 > 82) : (a1[1][10] ? v2 : 39)) ? ((v2 > v2) * (v2 > v0)) : ((98 < v2) / 5));
+                v1 = (((93 % 3) < (v1 % 8)) > ((a0[2] / 3) <= (a0[11] < a0[8])));
+            }
+            v0 = (((a1[3][1] + v0) >= (a0[6] && v3)) < ((a1[2][3] ? v3 : 45) * (v2 * v1)));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((i2 % 2) > 63) break;
+        a0[3] = (((i2 - i2) != (v1 ? a0[13] : 72)) + ((a1[2][3] ? v1 : v1) > (74 - a0[7])));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            v1 = (((96 + a0[13]) ? (v3 ? 70 : v1) : (a0[2] == a0[12])) <= ((7 / 2) && (v0 < i3)));
+            v3 = (((v0 != a1[0][13]) ? (26 || v2) : (i3 > 38)) == ((0 ? a1[1][13] : 94) ? (v3 / 9) : (a1[2][5] > v1)));
+            v1 = (((43 <= v3) != (v2 <= 61)) < ((a0[8] || v3) > (v1 ? i3 : a1[1][8])));
+        }
+        v3 = (((43 >= i2) < (i2 - a0[13])) - ((a0[6] ? 88 : 29) ? (v3 % 3) : (a1[3][1] && 89)));
+    }
+    v3 = (((a1[0][5] - v3) != (v2 - v0)) || ((v0 * v3) && (v0 * v1)));
+    {
+        int i4 = 0;
+        do {
+            for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+                a0[11] = (((a0[1] != v0) / 1) > ((v0 * i5) % 6));
+                v0 = (((i4 < 98) != (v1 >= i5)) > ((i4 / 2) ? (a1[3][15] < a1[1][8]) : (v3 / 1)));
+                a1[2][10] = (((64 - a0[5]) % 8) - ((i5 == a0[14]) || (v1 + v1)));
+            }
+            a1[2][13] = (((v3 > v3) * (a0[7] >= a0[9])) ? ((v2 ? v1 : v2) * (89 && i4)) : ((a1[0][8] % 6) % 3));
+            v2 = (((a0[12] >= i4) ? (i4 >= i4) : (a1[2][1] > v1)) / 8);
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    return (((v1 < v2) < (v1 + v2)) + ((22 || v3) - (a1[3][4] - a1[2][15])));
+}
+int f2() {
+    int v0 = 62;
+    int v1 = 28;
+    int v2 = 79;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v1 = (((v0 && v0) < (v3 == a1[0][15])) % 6);
+            {
+                int i1 = 0;
+                do {
+                    if ((a1[2][5] && v0) > 85) break;
+                    v1 = (((95 && 63) ? (24 * 55) : (v3 < v0)) >= ((v3 / 7) <= (80 == 25)));
+                    v1 = (((i1 * v0) ? (23 <= a0[2]) : (v2 == v1)) == ((62 - 61) && (i0 ? 1 : 13)));
+                    v3 = (((i1 || v1) >= (64 == 29)) / 7);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            a0[2] = (((53 ? i0 : a1[2][8]) <= (a0[2] * 4)) < ((a0[14] / 8) || (a1[3][3] >= a0[6])));
+            i0 = i0 + 1;
+        }
+    }
+    a1[3][9] = (((a1[2][11] * 55) && (v2 / 2)) || ((51 ? a0[13] : 94) / 9));
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((62 <= v3) >= (v1 || v0)) == ((25 <= 24) >= (v1 % 1)));
+        v2 = (((v2 ? v1 : 69) && (40 / 4)) == ((v0 / 5) / 4));
+        {
+            int i3 = 0;
+            do {
+                v1 = (((a0[8] % 2) ? (v3 == v1) : (i3 < v1)) - ((45 % 1) % 4));
+                v2 = (((24 ? i3 : a0[1]) % 6) >= ((i3 > a0[9]) ? (i3 >= v2) : (v1 < a1[1][12])));
+                v1 = (((78 >= a0[0]) - (i2 / 1)) >= ((i2 == a0[5]) + (a1[0][5] == i3)));
+                i3 = i3 + 1;
+            } while (i3 < 6);
+        }
+    }
+    if ((((v3 || v0) ? (v3 + a1[2][0]) : (v0 >= 47)) / 1)) {
+        v3 = (((v0 - v1) < (v3 / 1)) >= ((v3 % 4) % 1));
+        v1 = (((v2 > v2) < (v1 <= v3)) < ((57 >= v1) ? (v2 != 39) : (12 - v2)));
+        a1[0][2] = (((a1[1][8] >= v2) < (v3 ? v2 : v0)) != ((v3 || a1[2][1]) ? (v1 ? a0[5] : a0[0]) : (v1 % 3)));
+    } else {
+        a0[0] = (((66 || v3) == (v3 == v2)) <= ((a1[1][4] > a0[2]) >= (v2 / 4)));
+        v2 = (((8 * v0) - (a1[3][3] * 37)) != ((a1[2][14] > a0[11]) > (v0 == a0[8])));
+        v1 = (((a1[2][12] < 40) <= (v3 + a1[2][8])) <= ((v3 - v1) ? (v3 % 2) : (1 % 7)));
+    }
+    if ((((v2 == v1) != (a0[7] > v3)) - ((a0[15] != v2) >= (44 >= a0[3])))) {
+        a0[3] = (((a0[14] > v0) % 3) - ((29 >= v1) >= (5 ? v1 : a1[0][15])));
+        a1[2][10] = (((53 != v0) / 4) < ((2 ? a0[10] : 27) + (v0 > v0)));
+        a0[11] = (((a1[0][4] ? v1 : 69) - (v3 || v1)) * ((19 > v1) > (v0 < v2)));
+    } else {
+        v0 = (((a0[4] || v2) == (v3 || 86)) - ((v2 || v0) >= (v3 ? 99 : 61)));
+        a1[3][11] = (((a0[4] - a0[7]) ? (v2 != v2) : (v3 % 6)) / 1);
+        v3 = (((13 == v2) && (a1[2][6] ? v3 : a0[3])) > ((66 >= 87) - (11 ? v0 : v3)));
+    }
+    return (((a1[0][2] >= a1[1][11]) - (43 >= 12)) + ((a0[10] >= v0) < (v3 * v1)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,69 @@
+int f0() {
+    int v0 = 82;
+    int v1 = 39;
+    int v2 = 34;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 / 2) / 2) ? ((v1 && v2) != (v3 - a1[0][10])) : ((v2 + 50) * (v1 - a0[14])))) {
+        v3 = (((v2 / 4) * (v2 ? a0[2] : a0[6])) < ((v2 ? v0 : a1[2][10]) || (46 / 4)));
+        a1[2][14] = (((v1 - 55) ? (v2 >= a1[1][13]) : (91 - a1[3][6])) || ((a0[9] < a1[0][8]) ? (58 <= v3) : (30 > v1)));
+        a1[2][0] = (((a1[1][15] < v3) + (a1[0][1] > a0[13])) % 5);
+    } else {
+        v1 = (((a0[0] && 56) > (a0[2] ? a0[12] : a1[0][9])) * ((v3 ? 63 : a0[6]) * (v0 < v1)));
+        a0[15] = (((23 != 29) / 6) >= ((89 - v2) && (v2 / 4)));
+        a0[8] = (((a1[0][7] / 6) / 8) != ((v2 > a1[2][6]) + (a1[1][7] <= 31)));
+    }
+    a1[2][8] = (((v0 - a0[13]) > (9 == v1)) == ((v3 == a1[0][7]) ? (v0 * 51) : (19 / 4)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 >= v2) && (v1 < v1)) > ((42 <= 59) || (38 ? 85 : v2)));
+            v3 = (((a0[11] >= v3) == (i0 != i0)) && ((v3 / 7) >= (60 % 4)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v0 > v3) > 80) break;
+                    v1 = (((i1 - a1[0][4]) * (86 && a0[13])) / 2);
+                    v3 = (((53 || 48) > (v0 + v1)) ? ((v2 < v1) > (a0[6] * v0)) : ((v0 > a0[10]) + (a1[2][2] < v0)));
+                    v0 = (((v1 != 75) / 1) ? ((v3 > v1) < (i0 - v1)) : ((v3 && 52) > (i0 > v1)));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v1 * v2) > 56) break;
+        {
+            int i3 = 0;
+            do {
+                a0[8] = (((i3 * v1) - (a0[7] > a0[13])) <= ((i2 % 2) + (v0 / 5)));
+                v0 = (((80 && v0) + (i2 % 9)) / 8);
+                a1[3][14] = (((94 % 6) * (34 <= v3)) * ((v2 % 7) == (a1[1][14] == 51)));
+                i3 = i3 + 1;
+            } while (i3 < 8);
+        }
+        a1[3][8] = (((a1[2][13] || a0[8]) ? (v1 / 6) : (a1[0][3] ? v1 : v0)) / 5);
+        v1 = (((56 < v0) ? (2 + v0) : (v0 + 85)) >= ((v0 || v3) ? (v0 % 4) : (v0 <= i2)));
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((a0[4] == v2) > 76) break;
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                if ((4 < v2) > 74) break;
+                a1[1][6] = (((a1[0][14] % 9) ? (v2 <= 63) : (87 <= i4)) >= ((4 && a0[11]) == (i4 || 51)));
+                v0 = (((i5 > 69) ? (51 ? v3 : 13) : (v3 ? i5 : i5)) ? ((41 >= a0[14]) >= (v3 / 9)) : ((i4 < 40) % 2));
+                a1[0][0] = (((a0[9] + a1[3][10]) * (v1 % 7)) + ((93 < v2) >= (v2 != a1[2][15])));
+                i5 = i5 + 1;
+            }
+        }
+        v2 = (((67 * i4) < (v2 == i4)) % 1);
+        v1 = (((v2 <= a0[0]) - (9 ? a1[1][11] : v0)) / 6);
+    }
+    return (((a1[0][15] && 17) >= (43 && v0)) / 1);
+}
+int main() {
+    return 0;
+}
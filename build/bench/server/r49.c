@@ -0,0 +1,121 @@
+int f0() {
+    int v0 = 4;
+    int v1 = 8;
+    int v2 = 83;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v0 = (((v3 != v3) < (v0 * 19)) + ((i1 && v3) == (v3 * a1[3][10])));
+                    a1[3][10] = (((v3 ? v2 : i0) && (a0[0] > v2)) == ((63 && i1) && (68 != v0)));
+                    v3 = (((a1[0][11] / 3) == (i1 % 5)) || ((52 * a0[4]) % 5));
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((v1 ? v3 : v1) ? (v1 || 15) : (v2 != v1)) % 3);
+            v0 = (((a0[8] && i0) && (v2 || a0[3])) * ((v2 && v3) / 7));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a1[1][14] <= v2) != (v0 != v1)) < ((v1 >= 34) || (v0 ? a0[4] : v3)))) {
+        v1 = (((v3 != 66) * (v0 >= v0)) >= ((17 >= 1) != (47 % 3)));
+        v0 = (((v0 && v0) - (a0[7] * a1[1][12])) >= ((a0[13] >= v2) != (v0 != v2)));
+        v0 = (((13 < 13) ? (14 / 2) : (v0 ? 10 : v1)) + ((v3 > 68) + (v2 && v1)));
+    } else {
+        a1[1][5] = (((50 <= v3) && (42 || 97)) % 1);
+        v2 = (((37 + v3) - (v0 != v3)) * ((v3 < v3) < (v1 - a1[2][2])));
+        a1[0][2] = (((v0 + v1) < (v1 - 4)) * ((v3 % 9) >= (79 ? 79 : v3)));
+    }
+    if ((((a0[13] && v0) == (a0[5] <= v1)) / 7)) {
+        v2 = (((a1[1][10] == v2) > (v3 > a1[2][5])) ? ((1 != a0[9]) == (v0 - a1[0][10])) : ((v3 ? v0 : v2) * (v1 > v2)));
+        v1 = (((v1 >= a1[3][4]) <= (v3 * a0[7])) / 8);
+        a1[3][14] = (((a0[14] && a1[1][12]) ? (78 * v3) : (v0 != v3)) % 3);
+    } else {
+        v2 = (((37 >= 19) >= (v3 - v3)) > ((a1[0][3] ? 86 : 89) + (v1 ? v0 : a0[5])));
+        v2 = (((53 - a1[3][0]) + (a1[0][12] != 14)) - ((59 && v0) / 2));
+        v2 = (((a0[3] - v1) || (a0[4] - a1[3][6])) == ((a0[3] + v2) - (v0 - v3)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((v0 ? v1 : v3) > 61) break;
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a0[12] = (((i2 ? v3 : 82) + (53 - 50)) * ((v3 <= 20) + (44 + 33)));
+            v1 = (((v3 ? v3 : a0[0]) <= (v1 * i2)) ? ((a1[1][1] >= 90) > (66 || i2)) : ((75 + i2) != (a1[1][2] <= 57)));
+            a0[10] = (((v3 >= 64) - (v0 != v0)) ? ((i3 ? a1[3][11] : a0[7]) < (0 < a1[2][12])) : ((v1 + v1) * (v3 ? v2 : i3)));
+        }
+        a0[8] = (((36 || a1[3][10]) + (v0 == 28)) - ((v3 != 24) == (v1 >= v3)));
+        v1 = (((a1[0][15] / 8) + (77 > v2)) >= ((a0[12] || v3) == (a1[2][7] > a1[3][8])));
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        v3 = (((v1 > i4) < (v3 != a1[3][8])) * ((v3 + v2) + (a1[1][5] / 7)));
+        v0 = (((v2 == a0[14]) - (v1 + 68)) == ((a1[1][6] < i4) + (65 <= v3)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            if ((5 == v3) > 75) break;
+            v2 = (((v0 != v3) % 7) ? ((a0[1] ? 65 : v3) + (v3 + v3)) : ((v1 < 6) && (96 > v0)));
+            v1 = (((a0[15] - a1[3][4]) ? (i5 + a1[0][4]) : (v2 + v2)) >= ((v1 > v3) < (i5 || 3)));
+            v0 = (((i4 + v3) < (i4 && i5)) && ((a1[0][5] / 1) > (v2 * v2)));
+        }
+    }
+    return (((v0 + 85) - (v1 < v1)) / 9);
+}
+int f1() {
+    int v0 = 89;
+    int v1 = 34;
+    int v2 = 99;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    a0[14] = (((a1[2][9] != 41) >= (a1[3][7] == a1[3][6])) == ((v3 > v3) && (a1[1][15] - v3)));
+    a1[0][4] = (((a0[8] > a1[3][0]) ? (v3 <= 42) : (26 != 51)) / 5);
+    if ((((a1[1][8] % 6) >= (v0 != 7)) * ((v0 < v1) >= (v1 / 4)))) {
+        v2 = (((v2 <= v0) < (a0[0] % 8)) * ((v1 * v2) ? (6 <= 75) : (a0[14] - v1)));
+        v0 = (((v2 / 9) == (v0 != a1[0][4])) * ((v2 / 8) * (v2 > v3)));
+        v0 = (((a1[0][14] == 17) ? (a0[15] ? 16 : v3) : (v0 && v3)) == ((v2 * 82) >= (a1[1][11] != v3)));
+    } else {
+        v2 = (((a0[2] < v1) >= (93 - 21)) <= ((66 || v2) + (81 * v3)));
+        v1 = (((59 > a1[2][0]) % 4) ? ((a1[1][10] < v0) <= (v3 + 64)) : ((v0 || a0[3]) > (74 ? v0 : a1[1][0])));
+        v2 = (((v0 && a1[3][8]) <= (v2 * a0[13])) / 1);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            if ((v3 < i0) > 58) break;
+            v1 = (((v0 - a1[1][14]) <= (v3 * v1)) >= ((a0[13] * a1[0][15]) - (v3 ? a1[3][1] : 11)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((88 == 53) != (v1 * v2)) == ((i1 <= 85) / 2));
+                    v0 = (((v2 && 63) > (v0 / 3)) / 9);
+                    v0 = (((53 || a0[12]) - (v0 <= v1)) >= ((a0[15] != a1[1][14]) <= (97 > i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a1[3][1] = (((v3 + 31) || (a0[13] >= v0)) ? ((a1[3][4] < a0[6]) % 1) : ((v1 - a1[0][10]) <= (v2 - a0[14])));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v3 = (((v2 - v0) + (v2 >= v1)) / 7);
+        a0[8] = (((v1 && 47) && (a1[2][4] != a1[3][15])) - ((a0[15] ? v0 : 90) < (v0 > v0)));
+        {
+            int i3 = 0;
+            do {
+                v3 = (((37 < i2) < (3 == v1)) ? ((96 + 53) + (90 && i3)) : ((i2 != 14) > (a1[2][7] || 60)));
+                v1 = (((41 <= v3) - (86 || v2)) >= ((37 % 7) - (v1 - 92)));
+                v2 = (((i3 != 59) <= (v2 ? 30 : i2)) ? ((a0[7] / 2) % 4) : ((a1[2][11] % 1) + (a1[0][14] % 2)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    return (((68 || a0[6]) != (a1[3][0] % 9)) != ((v2 >= a0[14]) != (v0 ? a1[0][0] : v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
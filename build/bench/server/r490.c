@@ -0,0 +1,156 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 2;
+    int v2 = 60;
+    int v3 = 48;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v3 = (((v0 + a1[2][15]) - (v0 ? i0 : 58)) <= ((a0[10] > a0[3]) ? (v3 % 3) : (a0[11] || 84)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[10] = (((a0[10] < a1[2][10]) && (0 / 3)) == ((v2 * v2) * (v0 && 98)));
+                v2 = (((87 ? a1[1][10] : 19) > (a1[3][5] < a1[2][8])) && ((a1[2][9] || v2) / 6));
+                a0[3] = (((v1 <= i0) / 3) != ((60 == 96) ? (a1[1][8] < 53) : (i0 != v0)));
+            }
+            v0 = (((a1[1][2] == v1) < (v0 > 37)) == ((43 * v2) >= (71 >= v3)));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((a1[0][9] * v1) * (v0 + a0[13])) == ((88 - v3) ? (v1 + v3) : (v3 / 1)));
+    {
+        int i2 = 0;
+        do {
+            v1 = (((v2 + 23) % 4) < ((v2 / 1) == (v2 || 19)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    a0[9] = (((61 - a1[3][11]) != (a0[3] >= a0[5])) + ((v2 > 55) % 1));
+                    a1[0][8] = (((v0 > a0[8]) >= (i3 > a0[0])) || ((46 ? v0 : 53) / 2));
+                    v2 = (((a0[8] > a1[3][2]) % 1) || ((v0 + i2) - (i2 >= a0[2])));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((1 ? a1[3][15] : 83) >= (a1[2][3] == 31)) || ((40 + v1) <= (35 >= v2)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((31 <= i4) ? (a0[11] ? v2 : v2) : (v1 / 5)) <= ((a1[3][0] + v0) % 1));
+            v3 = (((i4 != 94) + (v2 / 3)) - ((a1[2][6] ? a1[2][15] : i4) >= (97 > v0)));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((a0[11] % 3) + (a0[14] % 3)) && ((v0 < 19) != (a1[1][9] * a0[8])));
+                    v2 = (((v2 + i5) - (v2 + v2)) - ((v1 && 5) > (a1[1][3] < v2)));
+                    v1 = (((v0 == v1) - (v2 <= v0)) != ((a1[1][9] ? v2 : v0) + (v0 == v1)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 4) {
+            if ((v3 != v3) > 66) break;
+            v3 = (((i6 ? v3 : a1[0][3]) > (i6 && 80)) == ((v0 * a0[8]) <= (a0[5] - v1)));
+            v1 = (((4 ? i6 : v0) + (a0[13] ? i6 : v3)) ? ((a1[1][6] != v1) && (a1[3][10] * a0[4])) : ((85 > v0) ? (v0 - a1[3][5]) : (64 <= i6)));
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v2 = (((77 < a0[13]) + (v0 <= i7)) && ((v0 ? a0[5] : a0[13]) == (v1 == v2)));
+                    v0 = (((v0 ? i6 : i7) <= (a1[3][12] * a0[7])) == ((i6 > v1) % 7));
+                    v3 = (((78 >= 0) <= (19 > a1[2][11])) - ((22 ? 69 : v2) > (85 ? a0[6] : v3)));
+                    i7 = i7 + 1;
+                }
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v1 ? 6 : v1) <= (76 * v1)) || ((a0[9] / 9) && (v3 < 34)));
+}
+int f1() {
+    int v0 = 5;
+    int v1 = 68;
+    int v2 = 68;
+    int v3 = 83;
+    int a0[16];
+    int a1[4][16];
+    if ((((69 - a1[1][14]) * (v2 / 8)) < ((v3 != a0[2]) || (a1[0][3] == 85)))) {
+        a1[2][6] = (((a0[3] % 9) % 9) >= ((8 > 41) - (a0[14] / 5)));
+        a1[3][5] = (((a0[3] >= v0) < (92 < 30)) * ((a0[15] - a0[15]) && (v0 * 36)));
+        v1 = (((a1[0][13] - v3) == (v2 > v3)) - ((a1[1][11] + v1) && (61 != 77)));
+    } else {
+        v3 = (((a1[2][13] != a0[8]) >= (15 >= a0[12])) || ((a1[3][1] + v1) + (v0 > v2)));
+        v0 = (((v3 ? v2 : v1) > (a0[0] ? v2 : v3)) || ((97 - v1) == (17 || v0)));
+        v2 = (((v2 + a0[5]) ? (52 <= 87) : (44 + 34)) ? ((v1 + a1[3][7]) >= (v1 ? v3 : a0[8])) : ((v1 - v3) != (a0[1] && v3)));
+    }
+    {
+        int i0 = 0;
+        do {
+            v2 = (((4 - v2) <= (v3 + v2)) == ((v2 % 4) ? (i0 >= a1[1][10]) : (v0 && a1[2][6])));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((a1[1][15] * 38) == (41 == v2)) != ((a1[3][2] / 1) - (v2 == v3)));
+                    a1[1][9] = (((v1 % 1) || (34 / 2)) && ((16 % 7) == (v1 % 2)));
+                    v2 = (((a0[2] * 24) ? (v0 && v1) : (i1 - 8)) < ((v3 % 3) / 4));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v3 = (((v2 <= v1) <= (v3 % 8)) || ((44 % 3) > (a1[2][5] * 11)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((a1[0][2] < v0) ? (95 + v3) : (v1 && v3)) != ((v1 && a1[1][13]) > (28 && a0[5])))) {
+        v1 = (((73 * 17) || (v1 ? a0[15] : 14)) % 8);
+        v3 = (((26 % 2) > (95 * 3)) <= ((v2 == v1) / 9));
+        v1 = (((86 != v0) * (86 || 53)) ? ((v3 && v0) && (v1 / 4)) : ((14 || v1) ? (a1[2][8] || v0) : (v2 * a1[0][4])));
+    } else {
+        a1[3][7] = (((v0 >= 1) ? (v3 % 1) : (81 / 4)) <= ((v1 && a1[0][0]) + (v0 != v1)));
+        a1[0][0] = (((v3 * 94) >= (v3 >= v3)) >= ((37 / 1) || (a0[14] >= v3)));
+        v3 = (((a1[0][8] || v0) > (a0[9] + v1)) != ((v3 ? a1[1][0] : 15) < (v3 || v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            a0[9] = (((a0[12] - v1) < (89 * a0[14])) != ((v3 >= a0[7]) || (a0[3] < v2)));
+            {
+                int i3 = 0;
+                do {
+                    a1[3][15] = (((v1 == v0) ? (58 < i3) : (v3 || i2)) == ((i2 ? a1[2][0] : v1) ? (i2 ? v0 : a0[11]) : (i3 != i3)));
+                    v3 = (((i2 / 4) && (18 < a0[0])) - ((a1[3][12] != a0[1]) != (v0 % 7)));
+                    v3 = (((i2 <= v0) > (a1[1][7] == i2)) * ((a0[8] ? v2 : v1) || (a1[0][1] >= 8)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            v1 = (((i2 % 8) - (30 + 1)) && ((v0 + v1) - (71 >= a0[10])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 2) {
+            v2 = (((a1[0][15] <= i4) || (i4 < v3)) > ((v3 && 24) > (a1[1][13] < v2)));
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((i4 > i4) == (v0 && 35)) && ((4 / 4) || (27 || v0)));
+                    a0[15] = (((v0 == 28) == (61 < 49)) ? ((7 > v2) ? (73 + v2) : (i4 != a1[3][6])) : ((i5 >= v0) <= (0 ? v2 : a0[2])));
+                    v0 = (((a0[1] && v1) % 4) == ((30 != 96) * (a0[11] % 7)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            v0 = (((8 <= a1[0][2]) && (43 || v1)) + ((v2 >= v0) - (a1[0][6] <= v2)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a1[0][0] % 5) == (21 == a1[2][2])) == ((3 / 9) != (v0 <= v3)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,219 @@
+int f0() {
+    int v0 = 64;
+    int v1 = 26;
+    int v2 = 32;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((v0 >= 86) > 90) break;
+            v3 = (((v3 < 80) || (83 < i0)) / 2);
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                if ((a1[1][0] > v0) > 64) break;
+                a1[2][11] = (((v2 && i1) <= (v0 * a1[0][15])) == ((a1[2][3] != a1[3][10]) < (a0[15] - v3)));
+                v0 = (((v1 == i1) != (83 || v2)) == ((v3 == a0[7]) < (v2 > 53)));
+                v1 = (((v3 / 4) > (53 - a0[5])) != ((i0 ? 5 : i1) - (4 || i1)));
+            }
+            a0[2] = (((v2 % 9) / 5) < ((60 < v2) == (v2 / 2)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((v2 % 4) > (v2 == v3)) + ((88 - v0) ? (v0 - v0) : (v0 - v0)))) {
+        v2 = (((a0[10] * v1) + (v3 <= v3)) ? ((a1[0][1] != a0[12]) - (a0[11] * v0)) : ((v0 <= 32) ? (a1[0][13] * v2) : (v1 <= a0[15])));
+        v0 = (((v2 > v2) == (50 == a1[0][7])) != ((54 >= v3) ? (v1 + 98) : (a0[8] * 59)));
+        a1[0][8] = (((a0[13] * a1[2][14]) * (v2 % 1)) < ((v3 ? 92 : a0[3]) < (42 && v0)));
+    } else {
+        a1[1][2] = (((v3 && v0) * (v3 % 2)) >= ((88 && 82) && (a0[0] - a0[5])));
+        v0 = (((v0 > a0[5]) * (3 > v2)) != ((a1[0][14] <= 53) == (a1[0][13] != v1)));
+        v0 = (((v1 == v3) * (v0 && v2)) + ((8 > v2) < (a1[1][0] ? v3 : 40)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            v1 = (((i2 || 34) / 5) + ((60 / 2) < (a1[2][15] + v2)));
+            v3 = (((v0 >= v2) == (92 + v1)) > ((v3 - v1) != (v2 ? a1[3][12] : a0[4])));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a0[12] + v2) < (a1[3][8] != i3)) ? ((a1[2][9] + v2) || (a0[7] - i2)) : ((i2 % 5) == (4 >= 74)));
+                    v0 = (((i3 != i3) ? (a0[2] && i2) : (a1[1][14] ? 86 : i2)) != ((v3 ? a0[14] : 93) != (13 && 10)));
+                    v3 = (((v3 > 91) - (v3 != i2)) * ((a1[0][13] ? 74 : v0) > (v1 && 94)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v0 = (((a1[3][8] || a1[2][15]) >= (v0 == v2)) - ((a0[0] / 4) < (v0 <= a0[2])));
+    if ((((44 || v3) || (a0[12] <= 99)) - ((89 - 90) + (58 * v2)))) {
+        v3 = (((a1[3][0] / 3) || (a0[7] > 16)) > ((v2 - v1) ? (v3 >= a0[15]) : (a1[3][14] + a0[13])));
+        v2 = (((v0 < v1) * (a1[0][9] > a0[1])) ? ((v0 <= v2) + (v0 + v3)) : ((v0 != a0[0]) <= (6 + v2)));
+        v2 = (((a0[6] || 82) < (v3 < v1)) > ((69 < a1[1][8]) && (a0[15] >= v0)));
+    } else {
+        v0 = (((v2 % 1) && (v0 * 95)) < ((85 && 44) ? (a0[12] > v3) : (v0 + 90)));
+        v2 = (((v3 ? v3 : 72) ? (v1 && v0) : (v3 + v2)) <= ((v1 % 3) != (v3 && 53)));
+        a0[1] = (((a1[1][10] > 75) ? (v2 / 2) : (21 < a1[0][15])) < ((v3 == v0) * (37 != 52)));
+    }
+    return (((v1 >= v2) && (v1 <= v3)) % 4);
+}
+int f1() {
+    int v0 = 6;
+    int v1 = 88;
+    int v2 = 81;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 > 65) / 5) + ((v0 >= 42) + (v3 % 4)))) {
+        v3 = (((v3 + a1[3][13]) * (a1[2][9] ? v2 : a1[3][5])) % 1);
+        v0 = (((a0[4] - v1) < (v3 < v1)) - ((a0[9] <= v3) + (a0[15] * v0)));
+        v2 = (((v2 - a1[3][2]) < (58 > 31)) ? ((a0[8] && 20) || (86 <= 83)) : ((26 / 5) + (a0[3] - v3)));
+    } else {
+        a1[2][12] = (((v2 && 49) == (v3 ? a0[3] : a1[2][1])) / 3);
+        v2 = (((v0 + 69) && (v3 * v1)) - ((22 ? v2 : 12) != (v2 ? v3 : v0)));
+        a1[1][5] = (((v0 != 58) != (v1 > v1)) || ((v3 * a1[1][4]) * (v1 == 54)));
+    }
+    if ((((49 - v2) < (v2 <= a1[2][6])) || ((v0 % 6) ? (71 / 6) : (a1[1][11] - 40)))) {
+        v1 = (((v2 + 82) < (a1[1][10] - a0[12])) * ((a0[4] - 63) && (81 == v1)));
+        v0 = (((a1[1][0] ? 87 : v0) == (v2 >= a0[2])) <= ((v1 * 92) ? (71 * 87) : (v0 > v3)));
+        a0[5] = (((v2 && v3) == (v2 - a1[3][1])) - ((v3 - v0) * (v0 != a1[2][11])));
+    } else {
+        v1 = (((v2 <= a1[2][11]) ? (45 * 92) : (9 && v2)) != ((v2 ? 59 : v3) <= (v3 < 48)));
+        a1[2][13] = (((v3 >= a0[7]) * (98 != 65)) != ((v3 + 42) >= (v1 < v0)));
+        v1 = (((a0[6] > 41) && (a1[3][7] && v2)) ? ((v3 / 5) && (a0[6] + 69)) : ((v2 && 24) - (50 < 24)));
+    }
+    if ((((v2 / 4) != (v1 ? v1 : v1)) || ((a1[1][10] ? v3 : v3) || (a0[0] || v3)))) {
+        v1 = (((v3 - v1) ? (a1[1][6] >= v0) : (99 || a0[6])) || ((a1[1][11] < 50) > (37 && v1)));
+        v2 = (((a1[3][13] >= 38) <= (v2 >= 35)) % 7);
+        v3 = (((72 || v1) <= (a0[3] < 99)) ? ((v0 <= v2) < (55 && 86)) : ((v3 / 7) >= (a0[14] <= v1)));
+    } else {
+        v3 = (((a1[2][6] || a1[1][7]) >= (v3 <= 41)) - ((v2 < v2) - (a0[15] % 2)));
+        v1 = (((a0[14] - v3) > (a0[3] - v1)) - ((v0 && a0[2]) - (v3 == v2)));
+        v2 = (((94 != 40) + (v0 ? 45 : v2)) > ((v2 || v0) > (a1[3][14] && a0[3])));
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        v3 = (((v3 != a0[15]) * (a1[2][7] - i0)) < ((i0 ? a0[1] : a1[3][11]) - (v0 <= 69)));
+        {
+            int i1 = 0;
+            do {
+                if ((i0 > a1[2][15]) > 74) break;
+                v2 = (((i0 > i0) - (v2 * 46)) != ((v0 / 8) ? (i0 == v1) : (a0[11] > a0[6])));
+                v1 = (((v3 - 73) ? (70 && 56) : (i1 - v0)) != ((v0 * v0) - (81 >= 81)));
+                v0 = (((a0[9] && v1) >= (a0[15] && 2)) >= ((i1 <= 18) && (v0 || i0)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        v1 = (((a0[3] || v0) % 2) - ((v3 > a1[1][8]) == (i0 != 6)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v3 = (((1 % 1) == (i2 && v3)) ? ((i2 > 56) != (v0 + v3)) : ((a0[10] < 90) ? (v1 > 45) : (77 <= a0[7])));
+        a0[8] = (((i2 || v2) < (a1[2][15] * v3)) < ((39 > 89) == (a1[1][3] < v0)));
+        {
+            int i3 = 0;
+            do {
+                if ((a1[3][10] ? 76 : v0) > 66) break;
+                v2 = (((v3 < 68) ? (i3 <= v2) : (v3 < a1[1][4])) && ((v0 ? a0[12] : a0[6]) ? (13 && a1[2][14]) : (a0[11] * i3)));
+                v3 = (((11 / 8) * (v0 * v2)) && ((i2 / 3) <= (i3 >= a0[9])));
+                v3 = (((a0[13] - 86) - (v2 - 85)) % 8);
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    return (((v2 * 41) ? (v1 / 5) : (83 + 65)) / 5);
+}
+int f2() {
+    int v0 = 5;
+    int v1 = 69;
+    int v2 = 81;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[8] = (((v2 % 5) - (a1[0][9] / 5)) && ((41 > 26) % 9));
+            v0 = (((61 == a0[8]) < (v3 < i0)) % 4);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    if ((v1 > i0) > 69) break;
+                    a0[11] = (((a0[6] - i1) - (i0 / 1)) < ((a0[10] - i1) < (19 == i1)));
+                    a1[0][4] = (((v1 == v3) - (a1[3][4] % 4)) && ((63 == a1[3][15]) && (41 || a1[2][4])));
+                    a1[0][6] = (((20 >= 47) > (54 == v2)) == ((98 * v2) < (a1[3][13] && a0[3])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((14 % 2) > 70) break;
+            v3 = (((v0 / 4) >= (v0 * a1[1][14])) > ((v2 <= v3) ? (i2 > 63) : (a1[1][12] != a0[3])));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((a0[15] * i3) ? (v0 == v0) : (v1 > a1[1][6])) >= ((v0 + 4) != (i2 ? 88 : i2)));
+                    v1 = (((v0 == 61) ? (v2 + 46) : (v1 > i2)) && ((i2 && v0) != (i3 > v1)));
+                    v2 = (((v0 % 3) >= (29 % 6)) >= ((a1[1][15] < a0[14]) - (63 * i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            v0 = (((v1 < 86) ? (a1[3][0] <= 79) : (v3 <= a0[8])) ? ((a1[0][12] && 82) || (i2 - 74)) : ((v2 || a0[7]) + (a0[14] <= v1)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a0[10] = (((a1[2][5] / 5) != (a0[11] != a0[6])) % 7);
+            {
+                int i5 = 0;
+                do {
+                    v2 = (((31 != v1) ? (11 > a0[10]) : (v1 == a0[4])) != ((65 == v3) + (a0[9] >= 65)));
+                    a1[0][14] = (((64 || 61) ? (v3 <= v3) : (v3 >= 47)) / 1);
+                    a1[1][4] = (((i4 % 4) <= (v1 >= 53)) && ((a0[7] && a1[3][3]) > (48 ? v0 : a1[0][12])));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            a0[5] = (((v2 < a1[1][9]) != (v0 * a1[2][3])) <= ((86 ? v1 : a1[3][15]) == (v2 >= a1[3][3])));
+            i4 = i4 + 1;
+        }
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 5) {
+                    v3 = (((a0[13] <= a1[3][8]) >= (i7 - a0[2])) || ((i6 || 55) >= (i7 > 97)));
+                    a1[3][8] = (((a1[1][12] && a0[7]) ? (a1[1][15] ? a0[13] : a0[6]) : (i7 < v1)) >= ((93 < a1[3][13]) || (88 <= 55)));
+                    a0[1] = (((v1 - v2) == (a1[2][14] >= 60)) / 7);
+                    i7 = i7 + 1;
+                }
+            }
+            v3 = (((v3 / 4) % 6) < ((34 <= 26) * (13 % 4)));
+            v0 = (((45 - v0) ? (a0[5] * 47) : (a1[3][5] && 93)) ? ((94 < 42) / 5) : ((v0 ? v2 : v1) + (i6 != v0)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    for (int i8 = 0; i8 < 2; i8 = i8 + 1) {
+        v0 = (((v2 > v2) ? (17 || v0) : (a1[2][15] ? i8 : 76)) <= ((v1 * 31) != (a1[2][13] - 54)));
+        {
+            int i9 = 0;
+            do {
+                v0 = (((i9 + 57) - (a0[11] ? 31 : v3)) / 4);
+                v3 = (((i9 != v2) > (92 > i8)) + ((68 == i9) / 6));
+                a0[4] = (((v1 > i9) || (i9 + i9)) <= ((34 == 74) % 7));
+                i9 = i9 + 1;
+            } while (i9 < 4);
+        }
+        a1[0][11] = (((v1 ? 96 : i8) || (a0[6] < a1[0][2])) == ((a0[9] == 72) ? (i8 > 94) : (a0[2] ? 52 : a0[14])));
+    }
+    return (((a0[7] < 90) * (a0[10] != 6)) * ((a1[1][2] ? v1 : v2) / 9));
+}
+int main() {
+    return 0;
+}
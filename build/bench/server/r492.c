@@ -0,0 +1,54 @@
+int f0() {
+    int v0 = 62;
+    int v1 = 70;
+    int v2 = 26;
+    int v3 = 44;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    if ((v2 / 8) > 98) break;
+                    v2 = (((a1[0][10] >= a0[5]) || (35 && v0)) ? ((i0 * i1) == (51 / 1)) : ((a0[0] >= i0) / 1));
+                    v3 = (((52 ? 31 : v1) < (62 + i1)) % 7);
+                    a1[3][1] = (((73 == 4) + (19 || a0[6])) >= ((v3 < 4) ? (i1 == v3) : (a0[4] != i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            a0[8] = (((v1 && a0[5]) - (a0[9] == v3)) || ((a1[3][0] + v3) <= (v0 / 9)));
+            v1 = (((v3 > v0) * (i0 <= i0)) + ((29 || v3) >= (74 * 95)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v1 = (((v3 == v0) == (a1[0][15] <= a1[3][13])) ? ((a1[2][13] || v1) >= (a1[1][8] * v0)) : ((v0 ? 86 : 99) && (v1 || 12)));
+    if ((((34 < v1) >= (a0[5] % 6)) >= ((21 != a0[1]) > (v1 < a1[3][10])))) {
+        a1[2][12] = (((v1 ? 57 : v0) ? (v3 ? 98 : v3) : (96 + v0)) && ((v1 % 7) / 7));
+        a1[0][2] = (((v2 % 6) != (v3 || 39)) ? ((v0 + a0[14]) < (a1[3][3] + a0[9])) : ((v1 * a0[14]) || (a1[0][11] || v0)));
+        a1[0][0] = (((a1[2][1] < 54) + (a1[2][1] || a0[0])) % 7);
+    } else {
+        v3 = (((a0[0] || 38) ? (v2 - v2) : (14 && v3)) % 2);
+        v2 = (((v3 > v2) ? (a0[0] >= v0) : (98 / 3)) || ((a1[0][3] / 4) <= (a0[10] != 40)));
+        v1 = (((v0 != v1) != (v3 == a0[7])) == ((48 != 76) != (v1 % 9)));
+    }
+    v0 = (((20 == a0[8]) ? (v3 && v0) : (v3 != a0[5])) && ((v1 * a1[3][2]) && (a0[11] == v2)));
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v3 = (((v0 / 1) * (v2 % 3)) + ((v1 / 2) || (78 != i2)));
+                a0[1] = (((57 ? i3 : i3) > (v3 <= a1[0][14])) < ((v3 >= 83) ? (i2 < i2) : (6 > 87)));
+                v0 = (((a0[7] / 7) ? (56 != v2) : (v0 >= 7)) >= ((v1 + 59) == (i2 ? v2 : 24)));
+            }
+            v0 = (((v1 - i2) < (a0[15] ? v0 : a0[3])) == ((i2 > i2) > (a0[12] > a0[5])));
+            v3 = (((2 % 2) != (a0[2] <= v1)) && ((v1 % 3) ? (29 + v1) : (a1[1][3] ? v0 : v3)));
+            i2 = i2 + 1;
+        }
+    }
+    return (((v0 + v1) / 8) >= ((a0[5] && v2) * (v1 * v2)));
+}
+int main() {
+    return 0;
+}
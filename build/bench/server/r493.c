@@ -0,0 +1,100 @@
+int f0() {
+    int v0 = 52;
+    int v1 = 31;
+    int v2 = 35;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 / 9) || (v1 >= v3)) >= ((a1[3][6] ? 92 : 39) || (v0 >= v1)))) {
+        a0[7] = (((v0 >= v0) ? (a1[2][2] ? v1 : v2) : (v3 - a1[3][7])) * ((a0[8] ? a0[2] : v2) + (v0 % 3)));
+        v3 = (((v3 && a0[0]) != (v0 || 69)) - ((v0 && v0) == (a1[3][5] != 55)));
+        v1 = (((v2 + v1) && (v0 == a0[0])) ? ((v1 && v2) < (a1[2][13] < 42)) : ((21 / 8) != (v0 % 3)));
+    } else {
+        v2 = (((v3 * v2) < (a0[9] && a1[3][6])) || ((a0[14] / 6) <= (0 % 8)));
+        v0 = (((v1 || 70) - (v3 ? v1 : a0[6])) == ((a0[14] == v3) > (a0[8] || 42)));
+        v3 = (((a0[4] / 5) == (a0[5] ? v1 : 8)) != ((45 == v2) + (v1 ? v2 : 10)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            if ((54 || v2) > 66) break;
+            a1[3][5] = (((i0 + a0[10]) == (i0 == v1)) + ((v3 == v0) + (a0[8] >= a1[2][13])));
+            v1 = (((a1[3][11] > a1[3][13]) <= (a1[1][8] != a1[2][9])) < ((20 % 9) ? (v0 % 8) : (i0 >= a0[7])));
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((17 * a1[1][9]) + (v1 == a1[0][9])) && ((i0 < a0[2]) % 4));
+                    v0 = (((35 ? v3 : i1) || (a0[3] + 19)) <= ((i1 % 2) && (63 < 6)));
+                    a1[0][13] = (((a0[8] * a0[1]) || (a1[1][8] + 17)) * ((v3 > 23) + (v2 != v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((34 > 58) - (v3 ? a0[1] : v0)) + ((v2 >= v2) - (v1 * 26)));
+    v2 = (((v2 * v1) != (v0 ? v2 : v2)) >= ((v0 * a1[1][3]) % 3));
+    {
+        int i2 = 0;
+        do {
+            a0[5] = (((v3 < a1[2][13]) == (i2 ? v1 : 81)) || ((79 ? 97 : v1) != (96 < v1)));
+            v3 = (((v3 || v3) + (19 % 4)) < ((a0[0] && 56) == (a0[14] >= v3)));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((v1 || i3) > (i3 / 2)) != ((71 / 7) && (70 ? 4 : v2)));
+                    a0[0] = (((i2 && 2) - (55 + a1[2][15])) != ((v2 <= 88) - (v0 % 3)));
+                    a1[0][1] = (((v3 * a1[1][3]) < (a1[3][15] == a1[1][8])) - ((a1[2][9] % 7) == (74 || v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    return (((v2 ? v2 : a0[8]) % 8) > ((55 * 0) && (54 > v2)));
+}
+int f1() {
+    int v0 = 18;
+    int v1 = 83;
+    int v2 = 37;
+    int v3 = 41;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((95 != v3) ? (a0[9] % 6) : (v1 || v2)) + ((a0[8] * 65) < (v2 * v1)));
+    if ((((a1[3][6] - a1[1][10]) + (v2 / 7)) / 5)) {
+        a0[0] = (((v2 / 1) % 1) ? ((a1[1][10] - v2) ? (a0[1] ? v2 : a0[4]) : (v3 * a1[0][7])) : ((v1 <= v3) > (23 || v3)));
+        v0 = (((v3 && v1) - (v2 == a1[0][4])) >= ((a0[3] ? v0 : v1) == (8 <= a1[3][10])));
+        v0 = (((12 + a0[1]) - (60 - a1[1][5])) > ((24 >= v0) ? (v2 < 82) : (a0[0] * a0[6])));
+    } else {
+        v3 = (((v1 % 3) % 6) >= ((17 + v0) > (16 > v2)));
+        a0[11] = (((64 ? v1 : 35) % 1) < ((v0 + v3) <= (v0 == 8)));
+        v2 = (((v1 >= 81) - (17 >= v0)) != ((91 / 5) < (v1 <= a1[3][6])));
+    }
+    a0[11] = (((v2 > a0[6]) == (v0 == a1[3][5])) % 3);
+    if ((((15 == a1[2][6]) == (v1 >= v3)) / 8)) {
+        v1 = (((v2 && v0) > (v0 < 95)) / 6);
+        v2 = (((v2 == 28) == (a1[0][0] == v1)) <= ((79 ? 79 : v3) == (v0 <= v0)));
+        v3 = (((a0[15] % 7) != (81 * a1[3][11])) != ((a1[3][0] < a0[10]) != (a0[10] && v2)));
+    } else {
+        a1[3][15] = (((v2 < v1) && (v2 <= v3)) % 9);
+        v1 = (((74 > v3) ? (v0 / 1) : (30 != 48)) || ((v0 && a1[2][3]) <= (v3 >= 25)));
+        v0 = (((a0[5] ? v3 : a0[4]) / 3) != ((v3 > v0) || (v3 || a1[1][4])));
+    }
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v0 = (((a0[8] > 55) - (i0 >= 66)) || ((i0 ? v1 : i0) / 8));
+                v3 = (((v1 || v0) >= (a0[0] - v1)) != ((v1 ? a0[3] : a0[9]) % 8));
+                a1[1][0] = (((a1[2][8] > a1[1][15]) / 4) >= ((v3 ? a1[2][1] : v0) ? (v2 < 70) : (a0[12] >= v3)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+        v0 = (((a1[0][15] + v0) > (v0 == i0)) ? ((a1[0][8] != v0) || (v3 && 61)) : ((i0 - a1[0][3]) > (v2 - a1[0][3])));
+        a1[1][11] = (((v0 >= 72) || (87 != 81)) != ((26 && i0) != (a1[3][15] ? a0[4] : a0[15])));
+    }
+    return (((v2 * v0) ? (21 % 7) : (a0[11] > v1)) >= ((39 != a1[1][5]) ? (v0 && a1[0][9]) : (v1 > a0[4])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,216 @@
+int f0() {
+    int v0 = 41;
+    int v1 = 73;
+    int v2 = 43;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            {
+                int i1 = 0;
+                do {
+                    a1[1][8] = (((v0 * a0[1]) * (17 / 7)) == ((a1[3][9] && v3) < (v0 == 66)));
+                    v0 = (((v3 != i1) == (79 != i0)) + ((a1[1][4] && 27) - (v2 && i1)));
+                    a1[1][15] = (((v1 ? 24 : v0) * (i1 == v0)) == ((i1 == a0[11]) ? (i1 * 42) : (i0 && a0[7])));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a0[15] = (((67 && v1) != (v0 <= v2)) != ((i0 < v3) + (a1[2][14] ? 71 : a0[4])));
+            a1[2][1] = (((i0 < i0) != (65 > 30)) ? ((v0 != i0) != (v2 % 1)) : ((87 == 85) ? (a0[2] > i0) : (a0[10] + a0[2])));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                v3 = (((a1[1][4] && 30) % 9) || ((74 > i3) % 9));
+                v2 = (((v1 / 4) == (23 > 8)) - ((v3 * v2) % 8));
+                v2 = (((80 > v1) >= (v3 || 63)) ? ((a0[0] ? v2 : 43) && (v0 ? 86 : a1[1][2])) : ((i3 < 70) - (v2 * a1[1][3])));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        a1[0][12] = (((v2 || 51) || (v2 ? 58 : v2)) - ((83 != a1[2][10]) <= (a0[7] - 84)));
+        v3 = (((v3 >= v2) == (v3 >= v1)) % 7);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v0 = (((46 && 83) ? (5 / 9) : (60 < v0)) || ((73 >= v2) - (v3 + 66)));
+            v1 = (((a1[3][12] <= a0[13]) % 5) && ((v3 / 3) * (92 % 5)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((v2 > a1[1][14]) >= (v3 ? a1[1][1] : 86)) / 5);
+                    a0[3] = (((i5 < a0[1]) != (a1[1][15] + v3)) / 5);
+                    a0[7] = (((v3 % 2) != (i5 <= 60)) < ((19 <= i4) || (v2 + 73)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((v2 ? v0 : v2) ? (a1[2][14] != v3) : (v0 < v2)) / 1)) {
+        v3 = (((20 && v1) > (v3 % 7)) * ((a0[7] ? a0[5] : a0[8]) < (92 || a0[7])));
+        a0[8] = (((a1[2][7] < 68) + (20 && a1[1][4])) % 9);
+        a0[2] = (((5 + a0[1]) ? (v1 == a1[0][14]) : (v2 || v2)) || ((v3 != a0[13]) ? (a0[2] - v2) : (96 > v0)));
+    } else {
+        v1 = (((a1[0][6] - v3) % 6) || ((v2 && v0) ? (v1 <= v0) : (62 > v3)));
+        v2 = (((v3 / 1) + (a0[8] > a1[3][10])) + ((v1 + v2) && (v0 ? v1 : v1)));
+        v3 = (((v2 > v0) ? (70 != v2) : (a1[3][0] != a1[0][10])) - ((v1 >= v1) / 3));
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v0 - 82) > 61) break;
+            v3 = (((v0 >= a0[12]) >= (a0[14] - a0[13])) == ((97 != 22) && (a1[3][1] % 4)));
+            {
+                int i7 = 0;
+                do {
+                    a0[2] = (((v2 ? v0 : a0[1]) == (v3 - a0[10])) != ((i6 % 5) < (v2 <= v3)));
+                    v0 = (((2 ? 70 : v1) <= (67 == i7)) || ((a0[1] >= v0) || (64 >= v1)));
+                    v0 = (((v0 > 82) * (v1 == 62)) == ((41 % 8) && (a1[2][3] * 36)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            a1[3][10] = (((v2 && a1[3][13]) >= (v0 == a0[14])) + ((32 == a0[15]) || (i6 && a1[1][12])));
+            i6 = i6 + 1;
+        } while (i6 < 4);
+    }
+    return (((v2 - 6) >= (a0[15] > v3)) - ((v2 <= v2) ? (v0 <= v0) : (a0[11] * v1)));
+}
+int f1() {
+    int v0 = 9;
+    int v1 = 88;
+    int v2 = 33;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                if ((v1 / 2) > 59) break;
+                v0 = (((v0 <= i0) - (v1 > 24)) <= ((41 || v0) <= (a1[3][9] && v3)));
+                v3 = (((82 + a0[7]) + (a0[3] > a0[13])) + ((v1 >= a1[3][9]) * (a1[3][10] == i1)));
+                v1 = (((i1 && 87) && (6 == v1)) + ((65 && a0[0]) < (26 != a0[7])));
+            }
+            v0 = (((i0 < a0[7]) ? (58 * 42) : (a0[5] ? 31 : v1)) || ((a1[1][7] != 15) > (a0[0] >= 95)));
+            v2 = (((72 < a1[0][3]) == (16 != v1)) * ((v2 / 1) || (80 < 96)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v0 = (((v3 == v0) % 5) % 1);
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((75 / 5) > 51) break;
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            a1[3][9] = (((v2 ? v2 : 90) < (68 ? 28 : v1)) != ((47 || a0[10]) - (a1[2][13] % 3)));
+            v0 = (((i2 || i3) / 9) / 2);
+            v2 = (((a0[0] && v2) <= (i3 > a1[3][15])) / 4);
+        }
+        v0 = (((i2 % 4) - (a0[4] >= v0)) && ((35 >= 37) <= (v0 != v0)));
+        a1[3][15] = (((v3 ? v1 : v2) && (v2 <= a1[3][4])) && ((a1[3][8] >= a0[13]) ? (v2 / 5) : (a0[15] || v3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a1[2][8] = (((v2 || v0) && (v3 ? 73 : 47)) >= ((a1[0][7] > i5) <= (v2 ? v2 : i4)));
+                    a0[12] = (((i5 >= a1[2][9]) ? (v3 && v0) : (v1 > i5)) || ((v2 != a0[11]) <= (v2 <= v0)));
+                    a0[11] = (((77 + i5) >= (i4 - 53)) < ((v1 < a0[0]) != (59 - v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            a0[6] = (((i4 / 4) + (v2 <= i4)) != ((a1[3][7] && a0[3]) % 8));
+            a0[4] = (((a1[2][4] % 9) < (24 != v3)) && ((v3 >= 96) % 8));
+            i4 = i4 + 1;
+        } while (i4 < 8);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v1 = (((a0[13] * i6) ? (v3 ? v3 : 0) : (a1[0][3] <= a1[2][4])) <= ((i6 ? v0 : v0) - (a1[0][15] && a1[0][7])));
+        for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+            v3 = (((a0[14] ? v2 : 6) / 5) < ((a0[8] / 4) + (37 <= v2)));
+            a1[1][1] = (((44 ? v3 : v0) % 9) ? ((i6 > 62) * (i7 > 33)) : ((72 / 8) ? (i6 * i6) : (36 * 70)));
+            v3 = (((a0[3] - i6) ? (a1[0][2] ? a0[5] : v1) : (v1 + v3)) % 8);
+        }
+        v1 = (((i6 / 7) % 6) < ((57 * v3) < (29 != v1)));
+    }
+    return (((v3 >= v2) <= (v3 <= a1[3][6])) / 4);
+}
+int f2() {
+    int v0 = 15;
+    int v1 = 93;
+    int v2 = 75;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((74 + a0[14]) > 60) break;
+            v3 = (((a1[3][14] ? 43 : a0[15]) && (v0 == v0)) && ((28 && 64) >= (v3 || v2)));
+            v1 = (((v2 && 28) && (v0 && v2)) ? ((i0 <= 91) / 3) : ((v1 == a0[1]) / 8));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    if ((v2 % 3) > 94) break;
+                    v2 = (((i1 ? 75 : a0[11]) == (v0 != 44)) <= ((62 && v2) * (v3 >= a0[7])));
+                    v1 = (((60 % 7) >= (16 != v1)) / 1);
+                    v2 = (((a0[11] > a0[14]) || (a1[3][12] * 90)) ? ((87 + a1[2][1]) < (i0 || i0)) : ((v0 <= v3) % 2));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((15 + v1) > 58) break;
+        v3 = (((v1 >= v3) * (a1[1][0] < 3)) || ((v2 || v1) != (v2 && 16)));
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            if ((i2 / 1) > 69) break;
+            v3 = (((a0[15] % 3) / 1) == ((v1 != 32) - (i2 - a1[3][4])));
+            v3 = (((v1 <= v2) + (i2 >= i2)) != ((a0[11] - a0[15]) < (v3 + v3)));
+            v3 = (((a0[3] * i2) * (i3 || a0[4])) > ((26 + i2) + (a1[1][0] && a0[6])));
+        }
+        a0[14] = (((i2 % 7) == (65 > 93)) <= ((v0 * v2) > (v3 ? 44 : v2)));
+    }
+    if ((((64 >= 62) ? (a0[15] ? v2 : v3) : (a0[10] >= v3)) ? ((a1[0][8] == a1[0][1]) - (v3 + a0[1])) : ((v0 ? v2 : v3) % 7))) {
+        v3 = (((v2 - 10) <= (v2 == a0[15])) * ((28 && a0[15]) < (a0[15] * v1)));
+        v2 = (((15 > v0) * (v1 ? 54 : 50)) ? ((v0 - a0[15]) && (v0 ? 71 : 44)) : ((v0 / 4) != (v2 && v0)));
+        v2 = (((v1 ? a0[11] : 54) > (a1[1][2] == v1)) * ((86 >= v0) || (a0[8] - v0)));
+    } else {
+        a1[0][0] = (((v0 >= v0) != (v3 / 6)) || ((v2 && a0[5]) > (a0[4] == v3)));
+        v2 = (((v3 >= v2) >= (v1 / 1)) <= ((v3 ? v3 : v0) > (v3 >= 46)));
+        v3 = (((v1 || v1) - (91 - a1[1][7])) >= ((a1[2][9] % 2) ? (v0 == v1) : (a1[1][4] - a0[9])));
+    }
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        v0 = (((v2 == i4) <= (v1 - a1[2][15])) == ((v0 * a1[0][12]) != (v1 + v0)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((a1[1][6] - v0) ? (v2 == 80) : (v2 > 86)) <= ((a0[2] ? v1 : v1) && (v3 / 7)));
+                a1[3][8] = (((v2 ? i4 : 47) % 7) >= ((i4 >= v1) ? (46 > a0[13]) : (a0[1] > v3)));
+                v0 = (((39 <= 78) ? (i5 * a0[11]) : (14 && a1[0][10])) ? ((a0[1] ? a1[0][15] : v0) || (17 - i4)) : ((i5 >= a0[15]) && (i5 <= v1)));
+                i5 = i5 + 1;
+            } while (i5 < 2);
+        }
+        a1[0][2] = (((a1[0][1] != a1[2][5]) * (a0[11] % 9)) <= ((a0[0] % 1) && (a0[2] && 76)));
+    }
+    if ((((a0[8] || 28) + (v3 / 9)) == ((76 && 67) % 3))) {
+        v0 = (((30 ? v3 : a1[0][14]) ? (v1 - 84) : (23 - v3)) ? ((v1 >= v1) != (v2 % 5)) : ((v3 != v0) || (v2 != v3)));
+        v1 = (((a1[0][13] - v2) + (v1 || v3)) == ((v1 + v1) - (v3 ? v3 : v2)));
+        v3 = (((a0[6] > v1) + (4 % 8)) ? ((v3 * v1) / 1) : ((v1 > v3) == (v3 * v0)));
+    } else {
+        v1 = (((a1[0][8] != v1) ? (27 + a0[12]) : (v1 || a1[3][13])) ? ((a0[14] || v0) * (a0[3] ? v3 : a0[15])) : ((v1 > v0) ? (v1 * 79) : (v0 ? v2 : 99)));
+        a1[1][3] = (((v2 + 60) != (v2 / 3)) && ((v3 % 8) % 9));
+        a0[1] = (((v2 && 64) / 7) - ((a1[0][4] / 8) ? (a1[3][13] ? 68 : v2) : (v2 != 79)));
+    }
+    return (((54 != 33) <= (19 % 9)) || ((a0[14] == v3) < (v3 < a0[13])));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,49 @@
+int f0() {
+    int v0 = 77;
+    int v1 = 20;
+    int v2 = 15;
+    int v3 = 60;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        v0 = (((a0[13] == v3) * (v3 ? v2 : a1[1][15])) - ((i0 * 81) <= (i0 == a1[3][15])));
+        v2 = (((v0 > i0) == (v1 || v3)) < ((25 * a1[2][8]) ? (v1 > v2) : (a0[1] > 16)));
+        {
+            int i1 = 0;
+            do {
+                a1[1][6] = (((i1 ? v1 : v3) >= (69 < i1)) || ((i1 < v2) != (v2 % 3)));
+                v2 = (((41 + 17) > (v1 ? a1[1][11] : v2)) > ((61 == a0[6]) ? (90 ? v2 : v3) : (i0 % 5)));
+                a0[3] = (((a1[3][0] ? v3 : a0[4]) < (44 ? a1[3][7] : v2)) - ((i0 != i1) > (a0[5] <= 8)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+    }
+    v0 = (((a1[3][15] >= v2) && (v1 % 9)) % 8);
+    v1 = (((v2 < v3) ? (v1 <= 12) : (a1[3][13] + 81)) + ((a1[1][9] + a1[3][8]) % 3));
+    if ((((10 < v0) ? (v3 == v0) : (a1[0][13] >= a0[1])) && ((v3 || 24) <= (69 == 27)))) {
+        v1 = (((v3 > a0[4]) + (28 == 73)) != ((a0[7] % 9) <= (v1 + v0)));
+        v0 = (((v1 || 49) - (a0[3] && v1)) <= ((a0[0] && a1[1][2]) >= (a1[0][10] / 4)));
+        v3 = (((v0 / 5) > (54 / 6)) != ((97 / 9) < (v2 || a1[3][9])));
+    } else {
+        v0 = (((v1 * a0[8]) + (v0 + v3)) == ((v1 + v0) + (v2 - a1[2][4])));
+        a0[2] = (((v0 || a0[11]) && (34 != v2)) - ((70 % 9) / 4));
+        v3 = (((79 == a1[1][5]) != (v0 - 5)) == ((a0[15] && v0) && (a1[2][4] == 54)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        v3 = (((a0[15] <= 77) / 9) || ((v2 && 49) && (v3 <= a1[0][11])));
+        v3 = (((69 ? v2 : v2) * (87 >= v0)) == ((5 - 53) >= (v2 >= v1)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v3 = (((v0 % 2) <= (a1[3][11] && i3)) / 3);
+                v0 = (((i2 * a1[3][1]) ? (a0[2] + v3) : (v1 % 7)) < ((v2 < v0) - (a1[2][12] ? 66 : 60)));
+                a0[2] = (((v0 * a0[5]) % 2) / 5);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    return (((v1 || a0[7]) ? (v1 >= 37) : (92 / 2)) + ((58 <= v0) ? (v3 / 4) : (a0[9] >= 82)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,104 @@
+int f0() {
+    int v0 = 64;
+    int v1 = 62;
+    int v2 = 38;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                if ((i1 > i0) > 91) break;
+                v3 = (((a0[1] > 52) + (27 / 6)) % 1);
+                v0 = (((v1 || v3) + (a0[14] ? i0 : a0[13])) || ((a0[12] > 66) < (a1[3][7] * a0[2])));
+                v3 = (((v0 < a1[0][4]) == (86 + a1[1][12])) || ((v1 ? v2 : a1[1][3]) / 8));
+            }
+            v2 = (((v1 <= 54) / 6) >= ((v3 + v0) + (58 / 8)));
+            a1[2][3] = (((v3 == 51) && (a0[9] ? v1 : v2)) && ((10 && v1) % 5));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((a0[15] <= a0[10]) >= (a0[6] / 4)) * ((v2 ? v2 : v0) * (v3 - a0[4])));
+    v1 = (((a1[0][12] > a1[3][9]) > (v3 - 90)) != ((v2 ? a1[2][12] : v1) == (a1[2][1] % 4)));
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a1[3][2] = (((i3 < 65) * (v3 - i2)) * ((68 <= 12) < (16 + 3)));
+                v1 = (((56 <= a0[7]) >= (v0 != v3)) ? ((v0 > v1) % 7) : ((i3 + 83) || (93 > a1[3][10])));
+                v3 = (((v0 % 1) >= (i3 || v0)) > ((v3 ? v1 : v3) == (7 + 44)));
+            }
+            v0 = (((14 && i2) / 2) == ((a0[3] - 57) ? (v2 - a0[4]) : (75 / 2)));
+            v0 = (((a0[3] <= i2) ? (a1[3][4] / 2) : (a0[9] - v0)) != ((v3 ? a1[3][6] : 72) - (35 < i2)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[2][10] - 21) + (v1 - a0[5])) > ((v0 - v3) != (v3 != v3)))) {
+        a1[1][1] = (((v1 <= 57) ? (a0[10] - v0) : (a1[3][0] > 87)) > ((53 / 4) != (v0 == a0[8])));
+        v0 = (((40 % 5) ? (v3 ? 81 : v1) : (v2 == 10)) > ((v3 < a1[2][2]) != (v0 - v3)));
+        v0 = (((a1[1][11] == 17) * (a0[5] && a0[11])) ? ((a0[5] % 5) ? (74 < a0[1]) : (a1[0][15] ? a1[2][7] : v2)) : ((v3 / 2) || (v1 == a0[12])));
+    } else {
+        v3 = (((v0 - 6) && (5 + v2)) < ((19 <= a1[1][3]) || (91 <= a1[0][10])));
+        v0 = (((v3 ? 21 : a0[14]) * (a1[1][12] == v3)) / 7);
+        a0[0] = (((a0[6] == v1) + (a1[3][6] ? v3 : v1)) <= ((v3 != a1[2][4]) * (v2 + v1)));
+    }
+    return (((v2 != a0[5]) % 8) > ((v3 / 4) ? (v1 > a1[1][5]) : (a0[13] >= a0[3])));
+}
+int f1() {
+    int v0 = 17;
+    int v1 = 39;
+    int v2 = 89;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((68 > v1) && (v1 % 1)) ? ((a1[1][4] == a0[15]) % 8) : ((3 + v1) > (v1 ? a0[8] : v1)));
+            v1 = (((v1 <= 72) <= (v2 > a0[9])) >= ((v0 ? 30 : 69) || (i0 < v1)));
+            {
+                int i1 = 0;
+                do {
+                    a0[2] = (((i0 == a1[2][2]) && (v0 + a0[15])) && ((a1[1][7] - v2) <= (i1 ? v1 : a0[9])));
+                    v1 = (((53 >= 58) * (i0 != v0)) <= ((a0[2] / 9) != (i1 <= 52)));
+                    v2 = (((99 / 2) % 8) && ((v3 != 11) < (i1 ? i1 : v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v0 = (((i2 + 32) - (v1 == a0[6])) || ((a1[2][0] * v1) || (v2 / 5)));
+            v1 = (((v3 ? 39 : v2) == (a0[15] - i2)) > ((a0[9] * v0) < (v1 == 74)));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    v1 = (((v2 && i2) <= (v0 != 77)) == ((i3 ? 38 : a0[2]) / 9));
+                    a1[2][5] = (((v3 || v3) >= (i2 <= v3)) * ((44 + 99) <= (v3 >= i2)));
+                    v1 = (((i2 >= v2) - (v2 > a1[0][4])) > ((v2 + 3) < (v1 >= i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v2 = (((96 / 1) ? (2 > a1[2][11]) : (v2 ? v2 : 68)) == ((v2 || 86) <= (a1[2][9] == 6)));
+    v2 = (((12 + v0) || (v3 != 50)) / 3);
+    if ((((v3 <= v0) > (13 ? v1 : v2)) ? ((v2 <= 80) || (v2 - v1)) : ((a0[12] < v1) >= (v2 >= 63)))) {
+        v2 = (((80 <= 5) || (26 * v0)) ? ((v1 != a0[11]) == (a0[0] > a0[6])) : ((v0 >= a1[3][3]) * (v1 / 8)));
+        v0 = (((a1[3][7] && v0) < (16 * a0[0])) <= ((42 > v1) / 9));
+        v2 = (((a1[1][11] % 4) && (9 ? v0 : v2)) < ((v0 && a0[15]) - (v1 > v2)));
+    } else {
+        a1[3][8] = (((a1[2][14] > v3) >= (v3 ? a1[0][1] : 68)) ? ((v2 > v2) < (a1[1][9] + 20)) : ((63 + v1) != (v0 % 1)));
+        a1[3][9] = (((99 <= a0[8]) + (a1[1][4] * 55)) <= ((v3 % 1) - (a1[2][10] && v2)));
+        v3 = (((v2 / 5) ? (v1 > v1) : (11 % 4)) && ((v3 - a1[2][6]) <= (v1 >= a1[2][6])));
+    }
+    return (((v3 > a1[2][14]) * (a1[1][6] ? a0[11] : v3)) - ((v2 / 5) + (a1[0][4] > v0)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,195 @@
+int f0() {
+    int v0 = 33;
+    int v1 = 12;
+    int v2 = 96;
+    int v3 = 85;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v2 = (((a1[0][8] - v1) && (v3 + 73)) != ((v0 < v1) <= (i0 >= v2)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v0 = (((20 <= v2) && (v1 == a1[3][4])) != ((v2 != a0[14]) / 7));
+                    v3 = (((a0[12] && v2) * (v2 + v0)) ? ((a1[0][11] > a1[1][14]) != (i0 == v0)) : ((v2 % 5) + (v1 != v2)));
+                    v1 = (((a0[1] / 9) || (v0 != v2)) ? ((38 <= i0) / 1) : ((v0 <= v1) ? (i1 < v2) : (a0[13] == 12)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a1[0][3] - 29) % 3) >= ((v3 < a0[4]) || (v0 / 2)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[13] ? 20 : v0) != (a1[1][10] * v1)) / 9)) {
+        v3 = (((31 * 66) || (v1 * v3)) || ((v0 != v1) ? (28 == v2) : (a1[3][2] < v1)));
+        v2 = (((v0 ? v2 : v2) || (v1 % 1)) && ((12 <= 61) < (31 / 6)));
+        a1[0][14] = (((v3 * v3) <= (v2 >= v0)) + ((v2 / 8) / 4));
+    } else {
+        a1[0][9] = (((a1[0][1] ? 77 : v0) || (v1 / 1)) >= ((v1 && 51) - (v2 >= 55)));
+        v2 = (((a1[1][8] == a0[14]) <= (v1 || a1[1][14])) > ((a1[2][0] < v2) ? (v1 < v2) : (v3 + a1[1][12])));
+        v1 = (((90 ? v1 : 84) <= (42 == 46)) > ((23 && 17) == (v2 != 70)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((54 > a0[11]) > 77) break;
+            a1[1][13] = (((v0 || a0[0]) || (a1[2][12] / 8)) < ((a0[5] && a0[6]) ? (a0[14] == 72) : (a1[1][4] || v2)));
+            v3 = (((i2 <= v0) / 4) >= ((v2 ? v1 : a0[15]) <= (v1 / 3)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    a0[5] = (((20 - 42) ? (i3 ? v2 : v2) : (a0[13] != v1)) || ((i3 ? i3 : v2) < (v2 || 69)));
+                    a1[1][10] = (((i3 ? 82 : v1) <= (v1 + a0[11])) <= ((i3 == i3) && (v1 + a0[6])));
+                    v2 = (((v0 || a0[9]) || (v3 * v1)) >= ((a0[5] ? 77 : i3) == (v1 % 7)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v1 % 5) <= (a0[8] > v3)) || ((a0[12] > v3) <= (v3 % 9)));
+            {
+                int i5 = 0;
+                while (i5 < 5) {
+                    v3 = (((i5 ? a1[1][11] : v1) >= (v1 + v0)) ? ((26 ? v1 : a0[12]) % 2) : ((83 % 3) && (i4 % 5)));
+                    v2 = (((v1 ? 53 : v0) - (i4 * a1[2][15])) % 4);
+                    a1[3][3] = (((v2 / 3) * (v0 >= 36)) ? ((10 - a0[8]) ? (38 <= 87) : (a0[1] >= v0)) : ((v0 != 65) + (31 - v3)));
+                    i5 = i5 + 1;
+                }
+            }
+            a1[0][0] = (((v0 >= v2) < (v1 ? 90 : v0)) == ((74 ? i4 : 51) < (a0[1] != v2)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    {
+        int i6 = 0;
+        do {
+            if ((v2 * v3) > 88) break;
+            a0[3] = (((a1[1][9] > v1) - (16 && v1)) + ((v1 < v0) / 5));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                v1 = (((a1[3][10] ? i7 : v1) >= (v2 ? v2 : 95)) <= ((a1[2][3] ? a1[2][0] : 84) && (v3 % 8)));
+                a0[0] = (((v2 <= v3) / 7) ? ((v1 != a0[6]) / 8) : ((i6 % 8) != (v3 >= a1[0][8])));
+                v1 = (((28 || 59) ? (v2 != a0[3]) : (v1 == i6)) != ((70 - v1) ? (i6 <= 24) : (23 % 7)));
+            }
+            a0[13] = (((v3 * v0) != (a1[2][11] <= a1[3][13])) ? ((a1[2][10] > v3) ? (v1 <= v2) : (i6 && i6)) : ((65 % 7) > (14 < v0)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    return (((v0 ? 42 : v0) || (91 ? a0[0] : v2)) || ((85 - 76) / 3));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 87;
+    int v2 = 99;
+    int v3 = 42;
+    int a0[16];
+    int a1[4][16];
+    if ((((25 < v3) <= (v0 % 9)) * ((v3 == 87) > (v2 < v2)))) {
+        v2 = (((v1 ? a0[12] : a1[2][8]) ? (v1 * v2) : (v1 * v2)) && ((v2 < v2) < (a0[9] || v1)));
+        a1[3][2] = (((v0 + v3) / 4) < ((v1 && v1) >= (a1[1][0] % 5)));
+        v3 = (((v1 > v1) > (a0[12] / 8)) && ((48 - 29) + (88 + 57)));
+    } else {
+        v1 = (((v1 == 6) ? (v2 != 26) : (v2 <= v1)) < ((v0 + a0[14]) <= (v2 && a0[9])));
+        v0 = (((v0 >= v1) <= (2 >= v3)) <= ((88 < 71) > (a0[8] > 59)));
+        a0[0] = (((a0[0] ? a0[15] : v3) != (v3 ? 79 : v3)) <= ((55 < v3) ? (23 > v3) : (v2 + 24)));
+    }
+    if ((((a0[6] % 1) % 7) == ((43 - v3) && (a1[2][9] < a0[4])))) {
+        v2 = (((v3 || a0[9]) / 6) ? ((79 <= 28) / 7) : ((a1[2][9] ? v2 : v2) % 8));
+        a0[11] = (((v3 + v1) <= (v1 / 6)) || ((v1 ? 49 : v1) ? (v3 || 13) : (80 ? 12 : v0)));
+        a1[0][4] = (((a1[3][0] == a1[3][0]) % 2) * ((v0 <= 56) - (v3 ? v3 : v0)));
+    } else {
+        v1 = (((a0[6] && a0[5]) - (a0[0] ? v1 : a1[2][1])) * ((v3 + a0[12]) <= (14 != 14)));
+        a1[3][6] = (((72 || v3) || (v3 == 3)) + ((8 <= v3) || (a0[8] || v3)));
+        a1[3][12] = (((57 / 8) * (v2 == v2)) && ((a0[7] < 15) >= (34 - 83)));
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        a0[6] = (((i0 ? v3 : v2) * (v2 % 9)) * ((v3 ? v1 : v3) > (v3 >= i0)));
+        v1 = (((v1 ? a0[10] : 90) - (v2 == 91)) / 1);
+        {
+            int i1 = 0;
+            do {
+                v2 = (((a0[6] == a0[14]) % 3) != ((9 + v2) >= (v2 > a0[13])));
+                v2 = (((a1[1][14] != v2) - (19 + i1)) >= ((i1 || i0) || (v2 - 13)));
+                v0 = (((a1[2][6] ? v2 : v3) / 8) != ((i1 ? a0[2] : 48) * (v0 < v0)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+    }
+    v2 = (((0 && v2) >= (v3 == v3)) || ((a1[0][3] == v1) >= (a0[9] ? a1[0][9] : v2)));
+    v3 = (((a1[0][6] < v1) ? (v3 < v2) : (a1[0][10] ? v1 : v2)) - ((9 == a0[7]) != (27 <= v0)));
+    return (((v1 && v2) != (v3 || a1[3][8])) == ((a1[2][0] * v0) > (36 || v2)));
+}
+int f2() {
+    int v0 = 38;
+    int v1 = 22;
+    int v2 = 99;
+    int v3 = 39;
+    int a0[16];
+    int a1[4][16];
+    if ((((7 || v2) ? (a1[3][4] + a1[0][2]) : (32 > 16)) != ((v0 <= a0[3]) % 2))) {
+        v1 = (((75 - v1) != (v1 <= v1)) ? ((v0 > 61) - (a1[0][3] / 6)) : ((v3 ? a1[2][11] : a0[4]) < (v3 + v1)));
+        v3 = (((v1 + v1) ? (a1[2][6] % 1) : (a0[15] > 57)) && ((a0[15] - v0) <= (v1 != v1)));
+        v0 = (((52 >= 44) == (30 / 7)) < ((v0 * a0[14]) < (a1[2][1] * 89)));
+    } else {
+        v1 = (((30 < 99) == (v0 == a0[3])) && ((a0[3] >= a0[15]) <= (v2 <= v3)));
+        a0[3] = (((v2 ? v3 : 91) && (v0 + 46)) % 6);
+        v3 = (((a0[13] ? v2 : v1) == (a1[2][12] && 44)) < ((a1[1][1] / 3) < (93 == a0[3])));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[15] = (((46 <= v1) && (v0 < v3)) >= ((15 >= i0) && (a0[7] ? v2 : v0)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((i1 == a1[0][10]) != (a0[15] && i0)) / 7);
+                    v0 = (((v3 / 4) || (v2 <= a0[5])) < ((v1 || a1[3][10]) / 2));
+                    a1[0][11] = (((21 > 0) / 7) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            a1[2][13] = (((v2 >= a1[0][5]) >= (v0 - v2)) ? ((v2 < 69) - (v1 > a1[1][10])) : ((a0[1] == 6) >= (v1 + v0)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v2 = (((a0[14] >= 91) > (i2 != i2)) ? ((a0[0] == a0[10]) / 9) : ((i2 > 23) == (i2 <= v2)));
+        v0 = (((i2 / 5) % 5) + ((i2 != 76) != (v0 - v3)));
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v2 = (((a1[1][1] - i3) % 3) <= ((v1 > v2) - (87 >= v1)));
+                a1[2][1] = (((64 < i2) - (a1[0][11] ? i2 : a0[13])) > ((i3 >= a1[0][9]) && (a1[0][12] + 70)));
+                a1[2][1] = (((i2 + 55) == (v0 != 91)) == ((44 || v0) && (74 > a1[0][1])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((6 != v0) || (v2 && a1[3][7])) == ((a0[0] ? v1 : v0) - (v1 || a0[3])))) {
+        v1 = (((92 ? a0[13] : a0[13]) <= (56 - a1[2][3])) != ((49 || a1[0][6]) < (18 >= v0)));
+        a1[2][8] = (((66 <= a0[1]) % 2) && ((a0[7] || v3) == (58 == v3)));
+        v1 = (((v3 % 9) * (a0[11] || v3)) ? ((95 != a0[15]) != (v3 != a1[3][2])) : ((14 + 95) * (26 ? v0 : 28)));
+    } else {
+        v2 = (((v2 - v3) * (a0[3] ? 50 : v0)) <= ((v3 > v0) || (v0 <= 95)));
+        a1[0][13] = (((46 != a0[8]) ? (a1[2][4] || 49) : (a0[7] == v3)) - ((13 != a0[12]) == (a0[12] ? 32 : v0)));
+        v2 = (((77 < v1) >= (v3 - 56)) ? ((98 && 37) && (a1[3][11] >= v3)) : ((v0 % 4) ? (v2 / 1) : (v2 ? v0 : 34)));
+    }
+    if ((((v0 != v2) + (63 >= a0[11])) % 4)) {
+        v3 = (((v2 - 60) - (a1[0][11] ? a0[1] : a1[3][15])) != ((v2 > v1) > (81 != 2)));
+        v3 = (((46 == v3) ? (v0 - 68) : (v1 / 7)) ? ((v3 > v3) || (v3 - 69)) : ((v0 != v3) || (v2 || v3)));
+        a1[1][10] = (((a0[11] / 2) - (a1[1][4] ? a1[0][11] : a0[15])) < ((a0[8] > 54) ? (48 ? 68 : 81) : (v2 - v0)));
+    } else {
+        v3 = (((42 * v0) ? (v2 || v1) : (8 < v3)) >= ((v3 ? 59 : a1[0][8]) * (v1 * v1)));
+        v0 = (((v3 + v1) != (v1 <= a1[0][10])) < ((60 == a0[9]) * (v0 >= v0)));
+        v3 = (((a0[4] == 85) + (v1 >= a1[3][1])) <= ((84 % 7) > (51 + v0)));
+    }
+    return (((v1 < v0) && (v2 != v1)) <= ((a0[14] % 1) > (v2 == 95)));
+}
+int main() {
+    return 0;
+}
@@ -0,0 +1,68 @@
+int f0() {
+    int v0 = 79;
+    int v1 = 91;
+    int v2 = 95;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 + v1) <= (70 % 6)) >= ((v1 == a0[4]) == (v1 ? a0[6] : v2)))) {
+        v2 = (((33 ? v0 : v1) ? (a1[2][15] == v2) : (v1 || v2)) + ((a1[1][3] != v1) ? (v0 * v2) : (a0[6] <= v1)));
+        v0 = (((v1 > v1) != (v1 < a0[1])) ? ((v0 || v3) - (v0 % 3)) : ((24 < v2) || (v2 == a1[0][10])));
+        v2 = (((v3 <= a0[9]) % 4) > ((v3 || 42) && (2 >= a0[15])));
+    } else {
+        a1[0][10] = (((a0[12] > v1) < (a0[10] || a1[3][8])) > ((v0 - v3) < (v0 == v0)));
+        v3 = (((v3 > v3) != (v0 - 64)) >= ((52 == 17) / 5));
+        a0[13] = (((47 - v0) * (v2 >= a1[3][13])) <= ((v3 + v0) - (v1 <= a1[1][12])));
+    }
+    {
+        int i0 = 0;
+        do {
+            v2 = (((83 / 7) * (i0 && v3)) > ((15 <= v3) <= (a0[8] ? v1 : 84)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v3 = (((a1[3][8] * 77) ? (v1 * i1) : (v1 || a0[4])) || ((v0 + a1[0][0]) / 6));
+                    v2 = (((a0[1] || a1[3][6]) < (v3 < v1)) && ((i0 ? v3 : v0) != (a1[0][14] > 8)));
+                    v2 = (((v0 <= v1) % 9) >= ((65 < a0[8]) || (v3 * i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[1] = (((v2 / 9) >= (v3 ? 86 : v0)) / 7);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v3 > a0[0]) > 79) break;
+            v1 = (((v1 > i2) >= (67 / 2)) * ((a1[1][1] % 9) >= (a1[0][7] || v1)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v3 = (((a1[2][0] == v0) > (i2 || 81)) <= ((a1[3][8] ? a1[1][7] : i3) + (v1 && 84)));
+                a1[0][2] = (((a1[0][3] && a1[3][1]) || (a0[5] % 3)) < ((v3 % 6) ? (7 || v3) : (a1[0][12] > v3)));
+                a0[2] = (((i3 * v2) != (v2 < v0)) == ((v2 && v2) ? (62 ? v3 : a0[14]) : (29 ? 29 : 86)));
+            }
+            v1 = (((a0[2] <= a1[1][4]) * (a1[3][7] ? a0[12] : a0[2])) / 7);
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((i4 ? v0 : a1[0][15]) > 79) break;
+            v2 = (((a0[7] != 85) != (v1 == a1[2][8])) && ((v3 + v3) < (v1 < v1)));
+            a0[6] = (((a0[12] + 27) ? (v0 % 7) : (v1 ? v2 : 56)) == ((a0[4] * a1[1][2]) < (i4 * a1[3][8])));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                if ((3 != 22) > 54) break;
+                v1 = (((v3 % 3) % 2) ? ((v0 && a0[9]) > (i4 - v3)) : ((74 != 80) % 6));
+                v3 = (((i4 > 60) ? (66 < v2) : (a1[3][0] ? v2 : 2)) == ((v1 || i5) < (a0[5] * a1[3][1])));
+                a0[6] = (((v3 == 54) <= (a0[3] ? v1 : a1[3][9])) / 9);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 5);
+    }
+    v1 = (((a1[0][6] || a0[13]) % 5) % 3);
+    return (((v1 % 1) * (v2 <= 5)) > ((v1 != 64) || (6 != v0)));
+}
+int main() {
+    return 0;
+}
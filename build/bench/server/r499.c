@@ -0,0 +1,120 @@
+int f0() {
+    int v0 = 6;
+    int v1 = 63;
+    int v2 = 49;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][10] ? a1[1][1] : v3) > (a0[8] != v0)) <= ((a0[11] / 7) && (v0 % 8)))) {
+        a1[3][6] = (((v3 + v2) || (v1 > a1[0][11])) / 1);
+        v0 = (((88 > a0[12]) < (32 == a1[2][1])) % 5);
+        v1 = (((v1 != v0) <= (v2 && v2)) && ((6 ? 47 : v3) || (v1 % 3)));
+    } else {
+        v0 = (((v2 && v2) % 1) || ((v1 / 4) && (97 >= 49)));
+        v0 = (((v2 != a0[9]) || (v1 == v3)) ? ((55 >= a0[3]) < (a0[1] != v0)) : ((67 / 9) + (a1[2][15] == 87)));
+        v1 = (((26 > v0) ? (v1 ? a1[2][1] : 10) : (a1[3][12] > a0[1])) + ((a1[2][11] < v1) < (v3 > v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v3 = (((99 <= a1[0][4]) && (93 ? 2 : a0[11])) && ((52 || i0) < (v3 + 36)));
+            v2 = (((a1[1][4] && 62) > (i0 + a1[3][4])) % 7);
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a0[9] = (((i1 + 78) == (86 < 78)) + ((86 == a0[12]) + (i1 >= v1)));
+                v3 = (((i1 ? v2 : 82) - (v0 || v2)) <= ((35 * a0[9]) + (v2 ? v1 : v3)));
+                a1[1][7] = (((v0 / 8) + (v3 / 9)) != ((a0[14] - i1) ? (a0[2] * a1[3][4]) : (i1 != a1[3][11])));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v0 ? a0[9] : a1[1][12]) % 4) % 4);
+    if ((((a0[14] ? v0 : 40) - (v0 * v0)) + ((v1 - v0) && (v2 < a0[14])))) {
+        v3 = (((a1[1][8] >= a0[6]) + (30 != a0[1])) == ((v2 / 1) && (v1 > v3)));
+        a1[1][14] = (((v1 - 6) - (25 > v2)) <= ((v1 - v2) <= (v1 % 9)));
+        v2 = (((v3 * a0[5]) && (v3 > 48)) % 5);
+    } else {
+        v2 = (((a0[6] && v1) - (a0[3] ? a0[6] : 0)) / 2);
+        v0 = (((v3 * a1[3][6]) * (a0[14] >= a0[10])) >= ((v2 % 6) == (v1 > v1)));
+        v2 = (((v2 < v1) ? (a1[2][12] ? v3 : a0[15]) : (2 != a1[3][0])) > ((v0 < 15) ? (v0 != 7) : (v2 < 54)));
+    }
+    a1[0][6] = (((38 >= 68) ? (90 && v0) : (86 <= a1[1][5])) != ((v1 > 25) != (30 ? a1[1][14] : v3)));
+    return (((a0[14] < a0[3]) >= (41 <= v1)) ? ((v1 % 8) % 5) : ((v3 <= 37) % 1));
+}
+int f1() {
+    int v0 = 69;
+    int v1 = 49;
+    int v2 = 93;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a0[9] = (((v3 % 4) && (a0[2] > v1)) - ((v3 / 2) % 1));
+        a0[8] = (((v2 == a0[7]) == (a1[3][5] < a1[2][7])) % 5);
+        {
+            int i1 = 0;
+            do {
+                if ((i1 % 7) > 87) break;
+                v2 = (((v2 == a0[1]) > (2 / 3)) && ((59 < 2) ? (41 < a0[4]) : (a0[8] ? v3 : i1)));
+                v1 = (((53 < a1[1][9]) != (56 || i0)) + ((80 % 4) <= (v2 >= i1)));
+                v2 = (((a0[3] != v1) == (a0[1] % 1)) - ((66 ? a1[1][12] : v2) % 6));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        if ((v3 == 78) > 62) break;
+        for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+            if ((i3 != i3) > 74) break;
+            v0 = (((a1[2][14] == 73) != (28 < 59)) * ((a0[2] && a1[3][13]) + (v1 == a1[1][9])));
+            v0 = (((a0[15] + v2) - (i2 != v1)) >= ((i2 && v0) <= (i3 / 9)));
+            v1 = (((v3 - i3) > (a0[5] / 6)) < ((v3 ? a0[15] : i3) && (20 == i3)));
+        }
+        a0[6] = (((v2 <= v0) ? (35 ? a1[0][13] : 36) : (i2 || 2)) * ((i2 ? v2 : 90) + (a1[2][0] && v0)));
+        a1[1][11] = (((20 != v3) && (v3 % 4)) > ((88 < v0) > (a0[13] || a1[2][14])));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v0 = (((a0[1] * v3) > (v2 + 44)) * ((v0 <= a1[0][6]) && (a1[3][5] ? v2 : v2)));
+            {
+                int i5 = 0;
+                do {
+                    if ((0 + 69) > 62) break;
+                    v1 = (((a0[5] ? v3 : 77) || (a0[11] ? v2 : i4)) && ((41 / 7) ? (v0 == a0[11]) : (a1[1][8] >= i4)));
+                    v0 = (((13 != v3) != (v2 ? a0[5] : v2)) <= ((v2 >= 4) ? (91 != 39) : (i4 / 5)));
+                    v0 = (((a0[15] >= v0) * (i5 / 7)) ? ((i4 + 8) == (v1 + v0)) : ((a1[1][14] == 20) >= (v0 || v1)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v2 = (((58 || 95) > (v1 == i4)) ? ((a1[3][9] && i4) != (v3 < v0)) : ((v2 / 7) / 1));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 7; i6 = i6 + 1) {
+        a0[3] = (((a1[2][10] && v2) % 6) <= ((i6 && a0[1]) == (46 - v2)));
+        v2 = (((v3 != 17) < (v3 < 10)) / 1);
+        {
+            int i7 = 0;
+            while (i7 < 6) {
+                a1[0][11] = (((a0[11] < v2) % 9) + ((i6 ? v0 : 59) || (i6 >= i6)));
+                v2 = (((42 - v2) != (95 == i7)) ? ((v2 < a1[1][4]) != (v1 > a0[4])) : ((76 >= v1) || (a0[11] < a0[6])));
+                v0 = (((i6 || v2) || (v2 < a1[2][14])) % 1);
+                i7 = i7 + 1;
+            }
+        }
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        for (int i9 = 0; i9 < 2; i9 = i9 + 1) {
+            if ((72 + v0) > 84) break;
+            v3 = (((i9 >= a1[3][9]) % 4) != ((19 ? v3 : v1) + (i9 / 7)));
+            v2 = (((v2 <= a1[3][12]) >= (v2 % 1)) * ((v3 > v1) >= (i8 / 9)));
+            a1[2][12] = (((v3 == 19) - (a0[1] != v0)) - ((26 && a1[0][8]) >= (2 != 41)));
+        }
+        v3 = (((v2 && v0) - (v2 >= i8)) && ((29 != v1) / 3));
+        v1 = (((v0 ? v2 : v3) <= (v2 ? v1 : 82)) <= ((a1[2][4] / 5) > (i8 >= a0[4])));
+    }
+    return (((86 <= 42) == (74 ? v0 : 75)) / 9);
+}
+int main() {
+    return 0;
+}
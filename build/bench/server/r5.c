@@ -0,0 +1,170 @@
+int f0() {
+    int v0 = 30;
+    int v1 = 61;
+    int v2 = 3;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    if ((((58 - a1[1][9]) >= (a0[14] != a0[2])) && ((v2 || a0[15]) != (v3 <= a1[0][5])))) {
+        v1 = (((a1[1][5] < v1) ? (98 / 7) : (v3 > v0)) ? ((v2 && v3) || (a0[3] || a1[1][8])) : ((v3 * a0[12]) <= (a0[10] != v0)));
+        a1[2][11] = (((v2 + a0[12]) % 5) ? ((a0[9] || 38) / 1) : ((13 * a1[2][2]) > (74 + a1[2][11])));
+        v0 = (((v0 / 5) / 7) < ((a1[3][5] % 6) / 2));
+    } else {
+        a1[3][10] = (((7 + a1[2][1]) ? (a0[12] * v3) : (v1 ? a0[8] : v0)) % 6);
+        a0[12] = (((v3 * v0) % 8) < ((a1[0][0] == 83) - (51 && v1)));
+        v1 = (((a1[0][8] < v3) * (v0 <= a0[7])) / 4);
+    }
+    {
+        int i0 = 0;
+        do {
+            v3 = (((65 != a0[9]) != (v1 - v1)) + ((v2 % 9) + (6 * a0[0])));
+            a0[15] = (((27 * v0) > (29 <= a0[4])) || ((58 <= 86) - (a0[4] || i0)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v3 = (((a0[10] || a1[1][12]) * (v2 == 46)) / 5);
+                v1 = (((i0 * a0[8]) != (a1[3][0] != 98)) >= ((v0 || a0[14]) == (54 ? i0 : a0[8])));
+                v3 = (((v3 / 9) <= (v3 == a0[13])) || ((a0[10] ? 11 : a0[3]) || (a0[3] * v1)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((44 <= i2) > 54) break;
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((81 % 9) || (i3 && v1)) - ((a0[5] || a0[7]) < (a0[10] / 8)));
+                v1 = (((v0 != a0[9]) % 7) >= ((v0 * 66) ? (a1[2][11] / 1) : (88 != 63)));
+                v1 = (((a1[0][14] * v3) == (v1 + i3)) % 9);
+            }
+            a0[4] = (((v0 % 6) * (v3 ? v1 : a0[2])) <= ((83 ? a0[8] : v2) >= (i2 < v2)));
+            v3 = (((a0[5] <= 4) ? (59 <= a1[2][5]) : (a0[0] % 5)) < ((a1[2][14] + a1[0][13]) || (a0[13] == v3)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((2 ? v3 : v1) && (a1[0][0] * v2)) >= ((a1[2][5] != a0[1]) == (v1 && v0)))) {
+        a0[14] = (((v2 < v3) / 6) == ((78 % 8) == (v1 == v1)));
+        a1[3][7] = (((v1 % 8) && (a0[3] <= a1[0][12])) == ((99 == v2) >= (v1 && v3)));
+        v2 = (((a0[14] ? a1[3][12] : a1[1][7]) > (v1 == a1[3][10])) / 4);
+    } else {
+        v1 = (((v1 / 6) + (a0[4] / 8)) == ((v0 <= v1) > (52 >= v0)));
+        v2 = (((v3 / 7) / 2) || ((10 > v1) + (2 || v2)));
+        v3 = (((8 >= v3) - (a0[0] * v0)) < ((13 < 93) >= (96 < v0)));
+    }
+    if ((((v2 + a0[13]) == (a1[2][3] >= v2)) && ((a1[0][7] ? a0[3] : v0) * (a0[15] != v1)))) {
+        v1 = (((v1 / 6) / 5) <= ((v3 / 8) >= (v3 ? a1[1][8] : a1[0][8])));
+        a1[2][15] = (((a1[2][7] / 9) - (a1[1][2] == a0[8])) != ((a0[5] == v1) && (a1[3][15] - a0[1])));
+        v3 = (((78 > a1[0][6]) || (a1[2][4] - v2)) ? ((v0 * a0[15]) <= (91 ? 90 : v1)) : ((9 % 1) / 5));
+    } else {
+        v3 = (((23 >= v3) * (73 || v1)) >= ((80 - v0) % 5));
+        a0[10] = (((v3 / 1) / 7) && ((v1 ? v1 : v3) && (v1 <= v2)));
+        v1 = (((v1 == 99) || (v0 > a0[9])) / 8);
+    }
+    return (((v0 == 59) ? (a1[2][7] == 51) : (63 * a0[13])) ? ((a0[4] ? v0 : v3) % 3) : ((v3 == a1[1][7]) <= (v3 && v3)));
+}
+int f1() {
+    int v0 = 7;
+    int v1 = 85;
+    int v2 = 34;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((a0[10] + v0) >= (a1[3][13] && v1)) != ((a0[9] - v2) <= (a0[8] && 20)));
+    {
+        int i0 = 0;
+        do {
+            if ((v3 || 1) > 62) break;
+            a0[14] = (((v1 < a1[2][9]) ? (69 || v3) : (v0 && i0)) || ((v0 < a1[3][11]) / 8));
+            v1 = (((78 ? 50 : i0) == (i0 / 6)) != ((v3 < v3) ? (v1 + v2) : (60 / 7)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    v3 = (((v2 + a0[6]) ? (53 > a0[4]) : (i1 && 11)) < ((51 < v0) ? (v1 ? 23 : v3) : (i1 || 81)));
+                    v3 = (((81 * i0) != (v0 || v2)) - ((v3 != i0) * (a0[6] - a1[0][13])));
+                    v0 = (((13 > 55) + (i1 / 7)) + ((a1[2][2] > 19) != (i0 < v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    a1[2][4] = (((v0 - a1[3][13]) - (a0[13] ? v0 : v3)) >= ((v1 - v1) >= (a0[15] - 28)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v2 + v3) > 53) break;
+        v2 = (((a0[10] != v3) * (v2 - i2)) / 3);
+        v3 = (((a0[11] / 6) % 4) <= ((i2 >= v2) - (v1 % 9)));
+        {
+            int i3 = 0;
+            while (i3 < 3) {
+                v1 = (((v1 < a0[8]) - (a0[9] - 77)) ? ((v2 % 3) + (a1[3][11] && 47)) : ((a0[8] == v2) != (i2 + v2)));
+                v0 = (((a1[0][9] ? i3 : v1) ? (i3 ? 50 : i3) : (a0[14] / 5)) ? ((i2 % 4) + (v3 < i2)) : ((14 + i2) / 7));
+                v1 = (((v3 != a1[2][12]) <= (i2 % 8)) / 4);
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        if ((v2 % 8) > 53) break;
+        v1 = (((v2 != v3) > (a0[7] > v2)) ? ((v0 + i4) > (v2 > v3)) : ((v2 * a0[13]) <= (v3 * v0)));
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            v1 = (((v3 / 4) && (a0[6] / 1)) == ((a1[1][14] == 89) >= (i4 - a0[15])));
+            v1 = (((i4 ? v3 : v1) - (v3 % 3)) % 8);
+            v2 = (((v1 > i4) / 4) >= ((a1[2][1] + a1[2][12]) / 3));
+        }
+        v1 = (((i4 >= a0[4]) != (v0 / 4)) == ((v3 - v0) && (v0 <= v3)));
+    }
+    return (((48 && v3) % 3) ? ((v3 != a1[0][8]) >= (v2 + v3)) : ((4 >= v3) || (a1[1][10] % 5)));
+}
+int f2() {
+    int v0 = 43;
+    int v1 = 65;
+    int v2 = 4;
+    int v3 = 58;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        if ((a0[4] / 3) > 85) break;
+        v3 = (((v1 * v0) != (v1 && a0[6])) / 3);
+        v0 = (((a0[14] ? 32 : v3) ? (v0 / 2) : (v3 != 82)) >= ((44 && 28) / 1));
+        for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+            a0[4] = (((a1[1][8] / 6) > (a1[2][2] + v1)) > ((a0[4] - v3) == (v2 * a1[1][7])));
+            a1[0][10] = (((a0[6] > i1) < (a0[4] && 29)) < ((a0[8] / 5) > (45 > a1[2][4])));
+            a0[7] = (((v2 <= v3) >= (a1[2][3] && a1[3][4])) || ((a0[4] + v0) == (a0[9] <= 66)));
+        }
+    }
+    a1[3][12] = (((a0[14] == 13) >= (v1 - 63)) ? ((a1[2][11] - v3) == (v2 <= v0)) : ((42 * 31) < (a1[3][6] || a0[7])));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    v3 = (((a0[3] || a0[6]) - (a1[1][0] ? i3 : v2)) < ((i3 / 4) ? (a1[3][10] / 4) : (v3 ? a1[1][5] : a1[2][12])));
+                    v0 = (((v0 ? a1[3][8] : v2) < (i2 * i2)) || ((20 - 51) <= (i2 * v0)));
+                    v1 = (((v0 && v3) / 6) / 2);
+                    i3 = i3 + 1;
+                }
+            }
+            v1 = (((a1[1][0] + 80) / 1) / 2);
+            v1 = (((v3 && v1) == (v3 <= a1[1][12])) && ((v3 || a1[1][14]) % 4));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((9 ? v2 : v0) ? (v2 >= 62) : (v1 / 9)) >= ((v1 == 14) && (a0[7] || v0)))) {
+        v1 = (((7 * v3) < (a0[2] + 88)) < ((v3 > a0[13]) * (v3 % 9)));
+        a1[2][2] = (((v0 - v1) >= (23 && v1)) < ((v1 || 83) * (47 && v0)));
+        v3 = (((a1[0][7] * v3) < (64 > a0[0])) > ((v1 != a0[9]) || (9 ? 93 : a1[3][11])));
+    } else {
+        a1[2][8] = (((a1[1][9] != v2) < (v3 / 2)) / 6);
+        v0 = (((36 / 7) > (v3 ? a0[5] : a1[0][7])) - ((v3 || a1[2][8]) + (37 >= v3)));
+        a1[2][3] = (((a0[8] >= v1) * (v3 - 87)) % 3);
+    }
+    a0[6] = (((a1[2][12] != v2) < (v0 % 6)) - ((v0 <= a1[3][5]) <= (76 / 2)));
+    return (((86 ? a1[2][1] : v0) % 9) ? ((59 != a0[12]) <= (14 || v1)) : ((a1[2][8] >= 63) ? (v3 == 21) : (v2 - v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,179 @@
+int f0() {
+    int v0 = 50;
+    int v1 = 5;
+    int v2 = 49;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    a1[3][12] = (((v0 / 2) != (v0 % 8)) + ((a1[0][7] || 76) - (28 != a0[15])));
+                    v1 = (((v1 <= 58) && (v1 % 1)) >= ((v2 + a0[9]) ? (17 == i0) : (i1 >= v3)));
+                    a1[0][8] = (((v1 != a0[4]) + (49 % 9)) || ((v0 % 6) ? (17 == v2) : (i1 - v2)));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v3 = (((69 > a0[1]) ? (a1[0][6] == v0) : (a0[14] != a0[8])) <= ((64 < v1) >= (v0 % 5)));
+            v2 = (((8 * v3) > (a1[0][12] <= 55)) ? ((28 ? i0 : i0) * (v1 * i0)) : ((a0[6] != v2) ? (v0 || 98) : (a1[1][9] ? a1[2][10] : v1)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v3 = (((v0 - 13) ? (v0 ? v2 : 30) : (41 + v0)) >= ((v3 % 1) ? (v2 < 41) : (v0 * v0)));
+    a1[0][3] = (((v2 ? v0 : 53) + (v2 ? 43 : a0[4])) != ((a0[3] != 39) >= (a1[0][12] >= 24)));
+    if ((((a1[0][15] != a0[14]) != (a0[15] < v2)) && ((v2 + 13) ? (v3 + v2) : (a1[3][8] && 74)))) {
+        v1 = (((v1 || v2) ? (a0[2] - 40) : (98 != v3)) % 4);
+        v2 = (((v3 / 9) - (a0[5] == v2)) != ((v0 < a0[0]) / 7));
+        v0 = (((v0 >= a1[3][10]) % 4) % 4);
+    } else {
+        v0 = (((17 / 1) <= (48 * 76)) * ((96 / 5) < (v0 ? v1 : a1[0][15])));
+        v1 = (((v0 || v3) <= (v1 != 36)) && ((a1[1][11] >= v3) != (a0[10] < 98)));
+        v2 = (((v1 + 91) == (v3 == v3)) * ((v2 - a0[13]) == (v3 != a1[1][8])));
+    }
+    a0[10] = (((75 < 98) >= (v0 ? 75 : 75)) || ((v0 - 5) % 5));
+    return (((v0 || 74) + (v1 && 27)) % 3);
+}
+int f1() {
+    int v0 = 15;
+    int v1 = 18;
+    int v2 = 33;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v2 = (((v1 + a1[3][8]) + (i0 - i1)) <= ((v1 != 38) % 9));
+                v0 = (((v1 * v0) <= (v0 != a1[1][1])) <= ((v0 * 20) % 6));
+                v3 = (((a0[2] > i1) ? (i0 ? v3 : 23) : (i0 - 91)) || ((58 - a1[0][11]) <= (v0 / 6)));
+            }
+            v3 = (((24 != 80) - (i0 || a0[12])) <= ((11 > i0) && (99 || 14)));
+            v1 = (((v1 / 1) || (v0 % 2)) ? ((35 != v2) % 1) : ((34 % 6) * (a1[1][3] / 8)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((v2 <= v3) % 1) % 7)) {
+        v1 = (((v2 % 8) ? (v2 < a1[1][7]) : (a1[3][6] + a1[1][4])) != ((89 != 73) + (a1[3][3] * v2)));
+        v3 = (((v2 && a1[1][10]) <= (v3 && v0)) && ((v1 % 2) - (80 > v2)));
+        v2 = (((v2 == 33) * (v3 && v2)) != ((v3 >= a1[2][15]) > (v2 ? v3 : v3)));
+    } else {
+        v0 = (((v1 + v1) - (v1 ? v1 : 90)) > ((17 % 6) < (62 - v1)));
+        a0[11] = (((a1[3][14] + v3) - (a1[3][12] ? 97 : v0)) % 4);
+        v1 = (((a0[8] * v3) < (v1 >= v2)) + ((v2 > 80) > (v2 != v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[15] = (((v3 < v2) || (a0[6] || i2)) > ((11 != v0) + (v0 > a1[0][5])));
+            v3 = (((v1 ? a1[2][3] : i2) && (v0 && a0[2])) ? ((7 == 76) >= (21 != v0)) : ((a0[8] - 35) || (v0 % 8)));
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((i2 - v2) * (i3 - v0)) >= ((53 >= v2) > (i2 < 67)));
+                    a0[11] = (((v2 || 56) && (50 * i2)) % 2);
+                    v1 = (((a1[3][2] && v3) >= (50 <= 36)) ? ((a1[3][14] / 5) <= (v3 && 84)) : ((a0[9] && i2) * (i2 + 1)));
+                    i3 = i3 + 1;
+                } while (i3 < 2);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        v1 = (((v0 < 72) % 2) >= ((60 * 86) && (a0[10] < a0[7])));
+        a0[4] = (((v2 / 3) >= (a0[7] % 6)) != ((i4 % 6) == (a0[9] - v2)));
+        {
+            int i5 = 0;
+            while (i5 < 5) {
+                v3 = (((v1 % 4) * (i5 ? a1[3][6] : 7)) >= ((49 + i4) && (i4 != 93)));
+                v3 = (((i4 == 36) <= (a1[1][13] ? 61 : v0)) - ((i4 >= i4) != (a1[1][7] || i4)));
+                v3 = (((v3 / 5) - (i5 && 15)) + ((i4 == 71) % 7));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    if ((((v1 < a0[6]) || (v1 ? 15 : 35)) || ((v3 >= 8) >= (v0 % 3)))) {
+        v2 = (((v0 < 7) > (v0 ? v2 : v2)) != ((0 < v2) == (36 + v1)));
+        v3 = (((a0[0] && a0[3]) >= (v2 <= 43)) + ((v3 && v3) % 8));
+        v3 = (((v0 <= v3) > (68 - v3)) ? ((91 < v0) ? (v3 && 56) : (v1 - v2)) : ((v1 != v0) && (v0 % 1)));
+    } else {
+        v2 = (((v1 / 8) > (v1 > 43)) * ((v0 % 6) * (a1[3][4] - a0[4])));
+        v2 = (((a1[3][5] <= 64) * (a1[1][7] == v1)) && ((23 * v1) ? (57 < a0[15]) : (a0[11] * v2)));
+        v2 = (((v0 % 8) + (v0 / 6)) - ((v2 == v2) + (v3 == 66)));
+    }
+    return (((v0 * a1[0][14]) ? (a0[11] % 6) : (v3 / 6)) < ((v0 == a1[3][3]) <= (87 && a0[13])));
+}
+int f2() {
+    int v0 = 65;
+    int v1 = 34;
+    int v2 = 33;
+    int v3 = 50;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[9] || 9) ? (64 >= 82) : (v2 - v3)) == ((v0 <= v2) && (26 != a0[4])))) {
+        v1 = (((v1 % 5) || (v1 >= 83)) <= ((v1 - 21) || (v2 < v1)));
+        a1[1][15] = (((a1[1][2] + 20) ? (v2 >= v0) : (v0 ? v0 : v0)) / 2);
+        v2 = (((v1 * 0) != (a0[6] != 69)) - ((v2 && a1[1][8]) != (v3 ? v3 : v3)));
+    } else {
+        v0 = (((v0 != v3) / 3) || ((a1[0][11] + a0[15]) != (v1 + v2)));
+        v2 = (((81 != v3) - (v1 > v2)) / 2);
+        v1 = (((a1[2][4] <= v3) == (v1 >= 28)) / 8);
+    }
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v0 >= a1[0][9]) >= (v2 % 4)) / 5);
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((v3 * a1[0][2]) > 93) break;
+                v1 = (((i0 * 10) < (a0[6] * a1[0][1])) / 6);
+                a0[6] = (((i0 > v1) == (a1[2][10] < v2)) / 6);
+                v3 = (((i1 < v2) != (a0[6] || a1[1][11])) ? ((i1 * a0[0]) ? (v0 / 5) : (80 < i1)) : ((69 != 32) ? (77 && a0[12]) : (i0 / 9)));
+            }
+            a0[12] = (((57 != a1[1][0]) > (a0[2] == a1[3][1])) <= ((v2 % 8) ? (v2 <= v2) : (i0 != a1[0][1])));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            do {
+                if ((v0 / 3) > 74) break;
+                a1[2][13] = (((v1 + v1) == (i2 ? v1 : v1)) - ((v3 / 4) ? (a1[1][0] % 6) : (v2 > a0[1])));
+                v2 = (((v3 ? i3 : a1[3][13]) ? (a1[2][4] + v0) : (45 * v1)) - ((i3 == a1[3][10]) * (i3 / 1)));
+                v3 = (((v2 % 4) * (a1[1][6] + v1)) != ((8 <= a1[1][10]) ? (v1 + v1) : (v1 % 5)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+        v1 = (((v2 ? v1 : 2) >= (i2 ? 45 : a1[2][9])) == ((v2 - 0) ? (a1[1][11] <= i2) : (41 / 9)));
+        v0 = (((8 != v3) - (a1[0][4] == 20)) * ((a1[1][9] > v1) ? (a0[1] <= a0[1]) : (93 <= 65)));
+    }
+    if ((((v3 || v2) >= (5 / 7)) % 5)) {
+        a1[2][10] = (((a1[3][10] || v2) * (71 != v3)) + ((v3 / 3) <= (v1 ? v2 : v3)));
+        v0 = (((a1[1][15] == a1[2][7]) / 6) == ((67 != 4) && (a1[3][5] <= v2)));
+        v3 = (((94 != a1[2][14]) * (v1 ? v3 : v2)) || ((v3 != 47) == (31 > a0[4])));
+    } else {
+        a0[10] = (((v2 > v3) != (v0 - 70)) / 9);
+        v0 = (((a0[14] / 3) || (93 > 11)) - ((v0 >= a0[7]) < (42 % 2)));
+        a1[1][1] = (((v2 < 40) * (v3 >= v0)) > ((v1 + v2) % 5));
+    }
+    if ((((a0[3] ? 15 : v2) == (v1 / 6)) >= ((a0[2] <= v3) <= (49 % 3)))) {
+        v0 = (((v1 == v2) - (v3 != v3)) ? ((a1[2][10] == 31) == (93 >= a0[0])) : ((a1[0][4] * v1) % 4));
+        a0[10] = (((46 <= v2) ? (a1[3][7] - a1[1][5]) : (88 / 2)) - ((v0 >= 15) ? (v3 >= v0) : (a0[7] || a1[0][7])));
+        v1 = (((5 > v0) != (v3 == v0)) && ((a1[3][8] + v0) || (60 >= v2)));
+    } else {
+        v2 = (((v2 - a0[11]) ? (v0 == 29) : (v0 > v0)) * ((v1 - v0) && (v2 ? v0 : a1[3][6])));
+        a1[1][0] = (((43 == v1) >= (v0 <= a0[13])) != ((v0 ? a0[9] : v3) + (a1[2][8] < v1)));
+        v0 = (((58 ? v0 : a1[2][0]) - (78 % 4)) + ((29 - 32) < (12 > v2)));
+    }
+    return (((76 || v2) <= (v3 >= v2)) || ((v3 % 1) && (71 != v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,48 @@
+int f0() {
+    int v0 = 89;
+    int v1 = 12;
+    int v2 = 83;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    a0[2] = (((v3 ? v2 : a0[11]) * (a1[1][0] + 74)) + ((a1[2][12] / 9) == (v3 * v3)));
+    {
+        int i0 = 0;
+        do {
+            if ((v0 ? a0[5] : v2) > 80) break;
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v2 = (((a1[3][10] >= a1[2][11]) ? (a1[3][1] == i1) : (66 / 9)) != ((i0 == 90) >= (55 < 55)));
+                v3 = (((i1 ? v3 : a1[1][1]) <= (a1[3][4] - 89)) > ((i0 || a1[0][11]) >= (a0[10] ? v1 : a0[15])));
+                v1 = (((v0 <= a0[1]) < (i0 ? 58 : v2)) * ((v0 / 5) > (v2 ? 23 : a0[0])));
+            }
+            v2 = (((v1 >= v0) && (v3 < a0[13])) > ((24 < v0) > (v0 < v3)));
+            a1[0][1] = (((a1[2][9] % 1) - (a0[13] <= a1[1][4])) ? ((9 + a1[3][0]) < (v0 && a0[0])) : ((52 < a0[6]) || (v1 < 90)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((12 / 8) / 2) ? ((66 == 0) >= (v1 != 61)) : ((a1[3][1] == v2) || (v3 && v3)))) {
+        a1[0][12] = (((42 == v0) - (v3 > 3)) * ((a1[1][14] ? 72 : 64) < (96 - a0[15])));
+        v1 = (((a1[1][8] + v2) ? (88 - v1) : (v1 <= 75)) ? ((v0 == v2) == (83 ? v2 : a0[1])) : ((v0 < v2) % 7));
+        v1 = (((63 ? v0 : v3) % 4) % 9);
+    } else {
+        v2 = (((v0 != v3) < (v3 / 9)) * ((v1 - v1) <= (52 < 97)));
+        v0 = (((v1 + v2) < (v2 != v1)) >= ((88 > a1[0][3]) + (a0[12] >= 67)));
+        v0 = (((v1 <= 47) >= (40 >= 2)) * ((a0[10] == a1[0][9]) ? (31 / 7) : (17 <= v3)));
+    }
+    if ((((41 * a0[9]) < (v1 ? v0 : 7)) != ((v2 ? 70 : v3) && (26 * a1[3][6])))) {
+        v3 = (((v2 && v3) < (a0[12] != v3)) + ((v1 / 4) >= (v3 && v3)));
+        v2 = (((a1[2][8] == v1) % 5) ? ((v0 == a1[0][15]) * (v1 ? v0 : a1[0][7])) : ((a1[3][3] + 18) > (v1 + v2)));
+        v3 = (((v3 % 6) >= (a0[11] < 71)) <= ((v1 < v3) && (v2 * 8)));
+    } else {
+        v3 = (((4 - v3) * (90 <= 88)) + ((a1[2][6] == v0) % 5));
+        v0 = (((96 && v3) ? (a0[2] ? v0 : v1) : (a0[8] && v3)) - ((a1[2][6] || a1[1][15]) + (v2 ? a0[10] : v1)));
+        v0 = (((a1[0][0] - 83) && (12 + v0)) * ((a0[12] >= a0[0]) / 5));
+    }
+    v1 = (((v3 < v1) / 7) <= ((a1[2][0] >= a1[0][14]) >= (v2 == v1)));
+    return (((v3 * v0) - (v2 >= a1[0][12])) > ((v1 - 67) || (v1 ? v1 : 17)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
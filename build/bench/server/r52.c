@@ -0,0 +1,121 @@
+int f0() {
+    int v0 = 53;
+    int v1 = 93;
+    int v2 = 37;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v0 || v0) >= (a0[10] - v0)) < ((v1 % 2) || (v2 - v2)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 / 6) ? (v0 >= i0) : (i0 != a1[1][7])) ? ((v3 * a1[3][12]) == (30 % 9)) : ((a1[3][12] || a0[5]) <= (78 ? i0 : i0)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a1[3][8] <= a1[0][15]) % 3) % 3);
+                    a0[13] = (((v1 ? a1[0][7] : 39) != (v2 / 8)) / 2);
+                    v1 = (((v0 * 83) * (23 + a1[1][13])) + ((v0 - v0) % 2));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v3 = (((v2 * a1[2][3]) / 4) && ((a0[7] ? 77 : a0[12]) < (a0[13] ? a0[15] : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v3 - 39) * (79 <= v2)) ? ((v2 / 5) > (a1[0][14] / 2)) : ((58 != v3) + (v2 >= v0)))) {
+        v0 = (((14 || a0[13]) / 6) + ((v2 || 96) != (v2 != 41)));
+        v0 = (((v2 / 6) != (a0[10] / 5)) < ((v0 <= 19) || (a1[0][15] / 3)));
+        v0 = (((v3 && a0[9]) == (v2 <= v1)) - ((v0 / 3) >= (v0 ? v1 : v0)));
+    } else {
+        v1 = (((29 ? v0 : a0[6]) ? (a1[0][12] / 9) : (77 ? v2 : 20)) > ((a0[6] && a1[0][2]) == (v1 / 6)));
+        v1 = (((a0[7] > a1[1][1]) * (a0[8] + a1[1][14])) || ((v3 < 16) - (84 || 66)));
+        a0[12] = (((v2 > v3) * (a0[2] > v1)) ? ((36 * v2) || (a0[10] % 7)) : ((7 / 5) * (a0[10] / 7)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a1[0][12] * v1) / 3) || ((36 - v0) - (53 ? 43 : a0[8])));
+            v2 = (((83 && a0[4]) <= (v1 && v1)) < ((v1 > 17) - (67 / 3)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v1 = (((i2 != a1[3][9]) < (a1[2][6] == 62)) || ((22 != i2) % 2));
+                    v0 = (((a0[12] + v2) + (11 > 9)) ? ((a0[12] != v2) / 9) : ((a1[2][1] ? i3 : i3) % 7));
+                    v2 = (((a0[5] * 90) * (a1[0][7] && v2)) ? ((a1[3][6] < a0[15]) >= (a1[0][7] * v2)) : ((a1[3][12] ? v3 : a0[2]) > (a1[3][13] <= v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[7] = (((a1[3][13] == v2) > (v1 == a0[3])) / 5);
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                if ((43 >= i4) > 64) break;
+                v3 = (((43 % 7) == (v2 - i4)) || ((13 - v0) + (85 + v0)));
+                v2 = (((v2 + a1[3][1]) ? (a1[2][14] && v2) : (a0[11] <= 20)) % 8);
+                v2 = (((a0[14] + v2) - (v3 < i5)) || ((13 * a1[2][0]) % 4));
+            }
+            v1 = (((v1 % 9) - (v2 ? a0[12] : v0)) <= ((56 || v2) - (v2 && 95)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((v2 > a0[12]) > (82 + v3)) != ((v3 < v0) - (a0[8] || v3)));
+}
+int f1() {
+    int v0 = 51;
+    int v1 = 18;
+    int v2 = 96;
+    int v3 = 8;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                if ((v3 + 62) > 84) break;
+                v2 = (((a1[0][10] > a1[0][2]) ? (91 ? i0 : a1[2][0]) : (11 / 9)) ? ((a1[1][15] >= 62) % 2) : ((v0 || 92) != (a0[4] > 49)));
+                a0[15] = (((48 % 7) <= (v2 + v0)) && ((v1 <= v2) < (62 % 3)));
+                a0[11] = (((i0 ? 73 : v2) || (a1[0][14] / 5)) || ((i1 ? 43 : a0[14]) ? (v1 >= v0) : (45 < 53)));
+            }
+            v2 = (((11 + a1[3][14]) / 8) % 3);
+            a0[2] = (((v3 ? v0 : v3) + (28 > 92)) - ((a1[2][13] && v2) * (a1[2][9] == v2)));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    a1[2][2] = (((v3 ? v0 : v0) == (v3 + v0)) >= ((a0[3] || a1[0][4]) + (4 >= a1[2][4])));
+    v3 = (((v1 - a1[0][0]) >= (v2 == v3)) <= ((1 - a0[0]) / 5));
+    if ((((v1 + v3) ? (79 == a0[6]) : (42 == a0[13])) != ((v1 == v2) < (a0[0] && v2)))) {
+        a0[13] = (((19 == v2) || (73 >= a0[12])) * ((v0 <= 58) || (a0[5] == 98)));
+        v3 = (((v3 == v2) + (a1[0][14] || a0[4])) ? ((v1 - a0[5]) < (v1 >= a1[3][9])) : ((29 + v2) != (a1[2][9] < v2)));
+        a1[1][15] = (((v0 == v2) - (v3 % 8)) / 9);
+    } else {
+        v0 = (((a0[2] && v2) >= (a0[10] != v2)) != ((v0 || v2) <= (v3 > 72)));
+        v2 = (((a0[9] % 8) ? (v2 - a0[9]) : (v1 ? v1 : v3)) * ((v0 > v1) + (v1 ? v1 : v3)));
+        v0 = (((v2 % 3) > (v0 >= v1)) == ((v3 != v1) / 6));
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[1][15] = (((v3 && 82) + (50 != a0[7])) ? ((v1 || 84) / 8) : ((v0 == 46) && (v2 + 28)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                if ((v0 - v1) > 68) break;
+                v0 = (((v1 / 3) < (i3 != v3)) ? ((v0 < v0) * (v3 ? 57 : v2)) : ((v3 && v1) > (91 == a0[9])));
+                v0 = (((v3 > v0) - (v0 + v3)) / 6);
+                v3 = (((v3 ? a0[8] : v1) / 9) == ((v1 >= 83) * (v3 * 53)));
+            }
+            a1[0][3] = (((v2 == i2) < (v3 == a0[9])) % 3);
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    return (((v2 ? v0 : v1) <= (v0 && v0)) > ((89 == v3) && (v3 == a1[2][11])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,215 @@
+int f0() {
+    int v0 = 11;
+    int v1 = 85;
+    int v2 = 62;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((86 || v0) - (v1 <= 67)) ? ((v0 || v2) % 8) : ((49 <= v2) ? (a0[6] - v0) : (a1[2][9] >= 52)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v3 = (((i0 && 42) * (a0[9] % 2)) < ((30 - v0) <= (74 >= 40)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((v2 <= v2) > 53) break;
+                    v2 = (((v1 < a0[0]) / 2) + ((v0 || i1) + (74 != i0)));
+                    v2 = (((a1[2][4] != v2) ? (v1 + 28) : (1 / 1)) - ((3 + i0) != (5 % 6)));
+                    a1[1][15] = (((v0 - 23) + (a0[13] ? a0[0] : a1[1][3])) <= ((a1[2][3] * v2) + (8 > a0[2])));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a0[9] * v3) * (i0 + 14)) / 8);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v2 = (((v0 * a1[0][0]) != (v1 % 2)) || ((v2 || i2) <= (v2 <= v0)));
+        v1 = (((81 && 49) ? (a1[3][13] >= a1[3][15]) : (v3 <= v1)) < ((v2 / 9) + (83 ? a0[1] : v0)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                a0[7] = (((i3 >= 56) + (a0[1] <= v0)) >= ((a1[1][12] > i3) ? (a1[3][10] + v2) : (a1[1][11] % 2)));
+                v3 = (((v2 + a1[3][7]) < (14 != a0[9])) != ((v3 && 72) % 1));
+                v3 = (((v1 ? a1[2][14] : 32) && (a0[0] || 50)) || ((i2 && v0) || (v3 * a1[1][2])));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        if ((v0 % 4) > 52) break;
+        v2 = (((a0[1] || v1) > (v0 * 32)) < ((a1[1][5] + 24) ? (a0[14] && a1[0][6]) : (v3 < v2)));
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            if ((a1[3][1] % 3) > 91) break;
+            v3 = (((i5 + v2) + (82 != 47)) == ((a0[15] % 6) >= (22 && a0[15])));
+            v0 = (((a0[10] ? v2 : i5) && (a0[12] == a1[1][15])) <= ((a1[0][2] && a1[0][9]) < (a1[3][4] || v3)));
+            v0 = (((i5 != a0[8]) != (v0 + 20)) < ((a0[3] || v3) >= (i4 % 9)));
+        }
+        a0[3] = (((v0 <= 55) || (a0[15] + v2)) == ((v3 / 2) > (a0[9] - a1[3][14])));
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            if ((v3 == v2) > 88) break;
+            a1[1][3] = (((a0[2] + 83) == (5 * a0[5])) ? ((a1[0][12] <= a0[8]) - (i6 != 97)) : ((29 || v1) && (40 ? 92 : a0[3])));
+            v2 = (((v0 * i6) < (a0[11] + v1)) <= ((80 && a1[2][0]) && (61 == i6)));
+            for (int i7 = 0; i7 < 8; i7 = i7 + 1) {
+                a1[0][9] = (((i6 != v1) != (49 ? v3 : a0[13])) - ((v2 == 30) / 8));
+                a0[13] = (((a0[2] > a1[3][4]) != (a1[0][1] <= a1[1][12])) >= ((i6 / 6) ? (45 == v0) : (i7 >= v0)));
+                a0[11] = (((i7 || a0[7]) != (v2 / 3)) != ((12 && 68) == (a0[15] - a0[6])));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    return (((v2 == v1) || (a1[1][8] - v2)) * ((a0[14] != 97) >= (a0[6] != a0[7])));
+}
+int f1() {
+    int v0 = 4;
+    int v1 = 61;
+    int v2 = 95;
+    int v3 = 1;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v2 = (((a1[1][12] >= 48) <= (a0[7] || v2)) > ((a1[1][1] != v0) || (a1[1][6] > a1[0][15])));
+                v1 = (((v2 >= a1[2][4]) <= (17 > a1[0][8])) % 2);
+                v0 = (((a1[3][2] - i0) && (v1 < 24)) - ((v2 != 78) && (86 ? v1 : v0)));
+                i1 = i1 + 1;
+            } while (i1 < 5);
+        }
+        v0 = (((v3 <= 47) ? (19 >= 73) : (81 >= i0)) >= ((v1 != v0) % 3));
+        a1[3][9] = (((v1 <= v1) + (3 - a1[0][6])) * ((a0[7] || i0) % 5));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            a0[1] = (((i2 && i2) - (a0[15] < v1)) % 6);
+            {
+                int i3 = 0;
+                while (i3 < 6) {
+                    a0[2] = (((v0 - 11) + (a0[6] * v3)) == ((a1[0][2] || 3) + (v1 * v3)));
+                    v2 = (((a0[13] < v3) && (77 - v3)) <= ((51 <= v0) - (i2 >= i2)));
+                    v3 = (((94 % 5) + (a0[14] == v0)) > ((i3 > v0) ? (v3 / 2) : (a1[2][14] + a1[2][11])));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((a0[8] / 3) * (v2 / 4)) != ((a0[12] <= i2) != (a0[5] == a0[8])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v0 + 2) == (a0[11] % 5)) == ((v3 > 91) && (82 < v3)))) {
+        v2 = (((6 != 88) > (v3 > v3)) <= ((v0 < v0) <= (v3 < v2)));
+        v1 = (((v2 ? a0[9] : v2) ? (a1[3][15] > 48) : (v3 * v1)) && ((v3 * a0[14]) != (v3 < a1[2][2])));
+        a1[0][1] = (((14 * v1) < (93 / 2)) <= ((a1[2][3] - v3) == (a1[3][6] ? a1[3][1] : 53)));
+    } else {
+        a0[7] = (((79 && 17) + (v1 || a0[3])) ? ((v3 && 50) > (v2 != v3)) : ((v3 ? v1 : 91) <= (a1[0][8] != a1[1][2])));
+        v0 = (((v1 > a1[2][11]) > (v2 > v1)) + ((39 == v3) == (a0[3] - a0[7])));
+        a1[3][9] = (((79 + a1[3][6]) <= (v3 + v3)) <= ((v3 >= v1) / 2));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            a1[3][15] = (((v3 > i4) % 9) ? ((95 <= i4) && (a1[1][9] / 2)) : ((i4 * 79) - (67 >= v0)));
+            a1[0][9] = (((42 && a0[1]) > (i4 != v1)) || ((v3 && i4) >= (v3 == a1[3][13])));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                a1[0][14] = (((50 > i4) == (v1 ? i5 : 34)) > ((23 * v2) / 4));
+                v1 = (((v1 != 20) != (i5 == i5)) != ((v0 ? 55 : v0) && (25 && v2)));
+                a0[15] = (((a1[2][2] < a0[12]) + (47 && 88)) && ((v2 % 9) >= (39 % 9)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    if ((((94 * v0) >= (v3 % 3)) >= ((6 == 77) <= (v2 && v2)))) {
+        a0[13] = (((v1 % 2) ? (v2 == v1) : (v1 <= 44)) / 4);
+        a1[0][9] = (((v0 >= 18) / 8) <= ((a0[6] || v0) / 8));
+        a0[13] = (((v0 % 1) / 8) && ((51 + v3) ? (v2 > a1[1][13]) : (v2 - v0)));
+    } else {
+        v1 = (((v1 % 7) <= (1 * v3)) && ((v1 - v2) < (v2 ? 85 : v1)));
+        a1[0][1] = (((a1[0][9] < a0[13]) + (a0[9] || v0)) / 1);
+        a0[11] = (((a0[14] / 3) || (v3 || 62)) == ((v3 != a1[0][4]) > (39 + 52)));
+    }
+    return (((v2 || v3) * (v3 ? v1 : v3)) > ((v0 + v3) && (a1[3][13] * 89)));
+}
+int f2() {
+    int v0 = 52;
+    int v1 = 97;
+    int v2 = 3;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((a0[5] <= i0) <= (v2 > v2)) || ((51 + i0) < (i0 % 8)));
+                v3 = (((a1[2][3] && v1) > (a0[2] / 2)) <= ((v2 <= a0[0]) || (v1 >= v0)));
+                a0[9] = (((49 ? v3 : a1[1][6]) > (a1[3][9] % 8)) / 1);
+            }
+            v0 = (((i0 > v2) < (22 < a0[15])) ? ((40 > v0) > (v0 * 33)) : ((v1 && a1[0][12]) - (83 || i0)));
+            a0[10] = (((80 > 73) - (v2 + a1[0][15])) / 4);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                while (i3 < 7) {
+                    if ((v3 / 4) > 99) break;
+                    v2 = (((82 / 7) && (a1[3][13] * 78)) != ((a1[1][13] < i3) * (i3 < a1[1][9])));
+                    v0 = (((25 ? a0[14] : 8) || (60 && v1)) + ((v2 >= 34) && (i3 ? 63 : v1)));
+                    a1[2][3] = (((i2 + a1[0][12]) != (i2 / 4)) || ((3 % 2) ? (18 <= a0[15]) : (a0[6] + v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            a1[2][11] = (((v2 / 4) || (v1 + a1[2][3])) + ((v2 * 63) - (v1 - v0)));
+            a1[3][6] = (((13 && i2) == (v2 < v2)) % 4);
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            a1[0][14] = (((a1[2][3] ? 9 : i4) + (v1 <= a0[14])) * ((i4 == v0) + (v3 > i4)));
+            v1 = (((v3 + v2) && (a0[6] && 92)) < ((a1[1][3] == a0[9]) && (v1 ? v3 : v0)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v0 = (((a0[11] < v3) - (56 || a0[7])) > ((a0[0] - v1) != (a0[11] ? i4 : i5)));
+                a1[0][2] = (((v2 || a1[1][2]) - (a0[4] >= a1[2][15])) % 4);
+                v1 = (((a1[0][7] ? v1 : v1) >= (53 ? v3 : v3)) && ((i5 && v2) ? (4 == i5) : (a0[10] && i4)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    v3 = (((v1 > v1) != (a1[3][2] == a1[3][11])) && ((v1 ? a0[13] : a0[10]) / 5));
+    {
+        int i6 = 0;
+        do {
+            if ((a0[3] || a1[3][13]) > 75) break;
+            {
+                int i7 = 0;
+                do {
+                    v1 = (((59 == v0) && (a0[11] && 8)) > ((a1[2][0] ? 29 : v3) <= (a1[0][5] / 4)));
+                    v0 = (((72 || 98) != (v0 < v0)) > ((a0[14] % 6) + (i6 ? a0[3] : v2)));
+                    v3 = (((v2 == i6) != (a0[6] < 64)) + ((a1[0][10] + a1[0][3]) + (v2 / 9)));
+                    i7 = i7 + 1;
+                } while (i7 < 3);
+            }
+            v2 = (((v0 != i6) < (v1 && a0[6])) && ((v2 == 37) <= (22 * 58)));
+            a0[2] = (((80 || v2) ? (a1[0][14] <= i6) : (a0[14] ? v3 : a1[0][11])) + ((i6 < v1) ? (a0[1] || a1[3][15]) : (96 / 6)));
+            i6 = i6 + 1;
+        } while (i6 < 8);
+    }
+    return (((a0[7] <= v0) || (73 < 38)) != ((v3 >= v1) == (2 >= a0[2])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,47 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 34;
+    int v2 = 75;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v1 = (((13 ? i1 : v2) >= (a0[4] ? 29 : 77)) ? ((i1 < 63) <= (a1[2][1] % 3)) : ((i1 && v2) || (v3 >= a1[0][3])));
+                v2 = (((30 >= a1[3][14]) >= (53 > 41)) + ((i1 / 9) + (a1[1][12] - v1)));
+                v0 = (((v2 > v0) ? (v0 ? 99 : v3) : (v2 ? v1 : a1[3][2])) / 9);
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((v0 * v1) * (v0 >= a1[1][7])) - ((v0 < v1) + (a1[0][9] ? a1[2][14] : a0[14])));
+        v1 = (((i0 >= v0) && (4 >= v1)) == ((56 != v3) <= (v3 % 9)));
+    }
+    if ((((a0[6] ? a1[0][0] : 84) != (v1 / 6)) <= ((v0 < 96) || (v1 <= a1[0][9])))) {
+        v3 = (((43 * a1[0][0]) - (v3 == 22)) != ((v1 % 3) ? (v0 <= 32) : (v1 - 93)));
+        v3 = (((a1[0][11] <= v2) == (37 / 7)) >= ((a0[8] - a0[1]) > (a1[3][2] && 86)));
+        v0 = (((42 % 8) > (v0 >= v0)) && ((a0[0] < 33) || (v0 / 6)));
+    } else {
+        v3 = (((v3 < v2) % 2) < ((v2 < v2) ? (4 < a0[10]) : (63 && 20)));
+        a0[13] = (((v2 && v0) ? (95 / 2) : (v0 * v2)) > ((a0[10] / 6) * (30 != v1)));
+        v0 = (((v0 + v1) || (v3 == a0[3])) != ((v0 > a1[2][0]) || (v2 > v1)));
+    }
+    a0[11] = (((v2 * 31) % 2) != ((v2 && v1) > (v3 == v3)));
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v0 = (((7 != v3) - (a1[2][4] != v1)) < ((v0 * i2) ? (a1[1][5] < 45) : (i2 > v2)));
+        for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+            v0 = (((59 / 3) % 2) ? ((v2 * 15) == (i3 * i2)) : ((v2 * 93) % 8));
+            v0 = (((a1[3][6] ? 47 : a1[3][0]) + (v3 <= v3)) / 8);
+            v3 = (((a1[1][13] || v3) / 9) ? ((46 != v2) >= (a0[7] && a1[2][0])) : ((a0[3] - v3) ? (a0[0] && a1[3][11]) : (52 / 4)));
+        }
+        a0[3] = (((a1[0][3] * 14) > (73 <= v1)) ? ((31 > v1) == (a1[1][13] < 15)) : ((i2 || 25) ? (i2 == 30) : (v0 ? i2 : a0[15])));
+    }
+    v3 = (((v3 ? a0[7] : a0[10]) % 8) * ((v1 <= v3) % 6));
+    return (((57 != v3) - (a1[1][14] || v2)) >= ((v1 * v1) + (30 + v0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
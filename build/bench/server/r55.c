@@ -0,0 +1,137 @@
+int f0() {
+    int v0 = 29;
+    int v1 = 32;
+    int v2 = 67;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[3][6] && a0[7]) <= (92 >= v3)) || ((33 ? a0[15] : a0[1]) == (v0 > v1)))) {
+        a1[2][0] = (((73 - v2) > (50 ? a0[14] : v0)) != ((v3 != 20) ? (a0[13] / 3) : (a1[1][13] - v2)));
+        a1[0][6] = (((v1 * v2) / 2) ? ((v2 && v0) / 1) : ((v1 ? v0 : 48) / 8));
+        v3 = (((v0 ? v0 : v0) && (v0 < 90)) == ((a0[6] - v0) % 6));
+    } else {
+        v1 = (((v2 - v1) > (v0 ? a1[3][8] : v0)) >= ((v3 * v1) + (v3 - a1[1][15])));
+        a0[14] = (((v1 != v3) != (76 > 37)) * ((a1[2][7] * a0[6]) - (v1 != v1)));
+        a1[1][15] = (((v2 < a0[8]) ? (v3 ? v0 : a0[13]) : (v3 != 44)) == ((52 || v1) || (v2 >= a1[0][2])));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            v2 = (((a0[3] ? v2 : 95) || (94 ? v3 : 85)) <= ((51 <= a1[1][12]) || (v1 <= 64)));
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    if ((a1[1][6] == a0[14]) > 95) break;
+                    v0 = (((i1 ? a1[1][10] : a0[12]) < (v1 > i1)) || ((i1 == 11) > (a0[5] >= v2)));
+                    v1 = (((v1 != v0) >= (i0 + i1)) % 3);
+                    a1[1][15] = (((a0[10] <= v0) ? (28 * v0) : (a0[0] != v1)) == ((v2 != v0) && (44 < v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][3] = (((70 + i0) <= (v1 && v1)) % 1);
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        v2 = (((i2 && a1[1][8]) / 9) || ((v2 > 47) / 6));
+        v0 = (((81 + v3) == (a0[9] / 8)) ? ((10 < a1[1][3]) ? (67 ? a1[0][7] : v1) : (v0 % 1)) : ((a1[0][5] != a1[0][10]) != (v1 ? a0[7] : 6)));
+        {
+            int i3 = 0;
+            while (i3 < 6) {
+                a1[1][4] = (((a1[1][7] ? 54 : i3) <= (v1 < i3)) ? ((v3 / 3) || (v0 > a1[2][8])) : ((i2 <= v1) - (v2 && i2)));
+                v3 = (((a0[2] <= 80) == (i3 > a0[2])) / 9);
+                a0[1] = (((v1 >= a1[0][7]) || (v2 == 50)) > ((a1[2][0] / 9) / 9));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((v1 <= 25) || (v1 < 77)) ? ((v0 ? a1[2][14] : v0) / 2) : ((v2 && v2) / 9))) {
+        a0[0] = (((47 != v2) || (17 ? a0[5] : v3)) > ((v0 * 10) % 8));
+        a1[3][8] = (((a0[2] || v0) >= (59 + v0)) ? ((43 || v2) % 7) : ((v2 || v1) * (a0[10] - 47)));
+        v3 = (((94 || a0[1]) && (v3 >= 19)) ? ((52 + a0[4]) - (53 ? v2 : 44)) : ((v2 >= v3) != (v1 * a0[8])));
+    } else {
+        v3 = (((v0 == 5) < (44 % 1)) && ((v1 - 58) % 6));
+        v3 = (((a0[3] || 18) <= (v3 + a1[2][12])) == ((6 > 37) || (v1 != v3)));
+        v2 = (((v3 ? v3 : 92) % 6) || ((v0 / 2) && (a1[2][8] / 3)));
+    }
+    {
+        int i4 = 0;
+        do {
+            a0[6] = (((i4 ? v2 : 17) * (a0[1] + 52)) && ((v1 >= v1) % 8));
+            for (int i5 = 0; i5 < 3; i5 = i5 + 1) {
+                if ((i5 == 82) > 63) break;
+                a1[3][2] = (((v2 || 50) % 8) * ((a1[0][9] != v2) > (21 == v3)));
+                v2 = (((a1[3][6] && i4) < (a0[7] - i4)) == ((96 && a1[3][10]) < (v3 == 10)));
+                v0 = (((v1 > a0[10]) <= (a1[1][15] < 4)) > ((a0[14] % 3) ? (v1 == a1[2][12]) : (i4 && 94)));
+            }
+            v1 = (((83 % 8) && (v2 - 95)) == ((a0[7] < a1[2][2]) < (v2 && v1)));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    return (((v2 % 9) / 5) ? ((v1 ? v2 : 69) % 3) : ((v0 > v3) || (v0 / 9)));
+}
+int f1() {
+    int v0 = 44;
+    int v1 = 94;
+    int v2 = 18;
+    int v3 = 31;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 * v0) ? (a0[7] != 42) : (13 <= v1)) && ((v1 != a1[0][5]) > (a0[13] < a1[0][15])))) {
+        v0 = (((v0 <= v2) == (a0[14] + v3)) && ((v2 + v1) ? (36 + v0) : (v1 ? a1[1][10] : v3)));
+        v3 = (((v2 ? v2 : v1) > (v0 ? 14 : a1[1][1])) ? ((v0 % 5) == (v2 % 5)) : ((v3 && 11) - (v3 || v1)));
+        v0 = (((a1[3][10] / 8) + (v0 / 8)) + ((a0[11] < a0[4]) / 1));
+    } else {
+        v1 = (((v1 != 29) > (11 < a0[3])) ? ((v2 > 66) && (v2 % 5)) : ((a0[9] != 65) ? (a1[0][4] ? 11 : a0[2]) : (v2 != v1)));
+        a1[2][9] = (((a1[3][8] == v3) ? (v0 ? v0 : a0[15]) : (a1[1][10] == v3)) / 4);
+        a0[2] = (((v2 / 8) || (a0[3] || 86)) / 5);
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        a1[1][4] = (((v3 > v2) % 6) != ((47 % 2) != (a1[1][12] || v0)));
+        {
+            int i1 = 0;
+            while (i1 < 6) {
+                if ((v2 - v0) > 86) break;
+                v1 = (((v2 + a0[6]) ? (i0 % 7) : (v2 || v1)) * ((84 * i0) / 2));
+                v3 = (((85 ? 57 : i1) && (i1 ? 37 : a1[3][7])) == ((i0 && v0) < (i1 || i0)));
+                v3 = (((i1 + 50) <= (i0 > v1)) || ((i0 * v3) == (77 < v3)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[11] = (((a0[13] - v3) == (a1[0][15] / 9)) / 4);
+    }
+    v3 = (((69 <= v2) >= (v0 > a0[15])) == ((v0 ? 54 : a1[1][15]) + (56 ? v0 : v2)));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v2 = (((61 > v1) && (68 / 8)) > ((v3 == a0[14]) || (i2 || 49)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                a0[4] = (((a0[15] || 73) / 6) ? ((v0 || v3) < (i3 != a0[10])) : ((a0[8] == a0[2]) < (89 != 58)));
+                v2 = (((v0 / 9) + (a0[1] || v0)) || ((i3 < v1) == (52 ? v1 : v0)));
+                v0 = (((v1 ? v1 : a1[1][8]) + (v1 == a0[2])) % 8);
+            }
+            v3 = (((i2 && v3) ? (v2 >= i2) : (v1 / 2)) / 9);
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v0 = (((a0[3] ? i4 : a0[0]) <= (25 + 48)) ? ((29 - v0) || (v0 / 3)) : ((a0[4] != v3) != (a1[2][8] / 5)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v0 = (((v3 / 5) % 6) * ((a0[7] / 7) == (5 - a1[1][0])));
+                a1[1][11] = (((i4 && i4) == (81 ? 95 : v1)) <= ((57 ? 12 : v1) && (a1[0][5] || a1[0][0])));
+                v0 = (((i4 < v0) == (v2 < v0)) ? ((v1 % 8) == (v0 * 69)) : ((a1[1][14] + a1[1][1]) > (i5 / 9)));
+            }
+            v2 = (((38 <= 98) && (i4 && v0)) < ((v1 > a1[3][0]) + (9 || v1)));
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    return (((a1[2][14] || a0[11]) && (v2 / 8)) * ((a1[2][0] * 46) * (a0[6] > a0[11])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,155 @@
+int f0() {
+    int v0 = 55;
+    int v1 = 34;
+    int v2 = 89;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((a1[2][2] && v0) ? (a1[2][0] / 6) : (5 ? 55 : a1[1][5])) + ((v0 < 5) <= (v2 && v1)));
+    a1[0][15] = (((v0 ? 57 : 46) <= (v0 / 3)) * ((a0[7] > v1) || (v1 / 2)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v0 = (((v3 && i1) == (a0[9] ? a1[0][8] : a1[1][12])) != ((v3 != v3) ? (a0[4] || a1[2][15]) : (v2 * v3)));
+                v0 = (((i1 + v1) * (v2 ? v2 : a1[0][2])) - ((6 > a1[0][12]) >= (a1[0][12] - v0)));
+                v1 = (((a0[8] % 4) == (a1[0][12] == a1[2][2])) / 7);
+            }
+            a0[6] = (((v0 && v1) + (v0 > i0)) * ((v1 != 48) && (a1[1][6] + v0)));
+            v2 = (((86 + 1) && (87 == a1[3][11])) && ((a1[1][12] / 4) % 9));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            a1[0][14] = (((a1[0][4] < a0[4]) / 5) ? ((45 ? a1[1][7] : a1[3][4]) / 5) : ((a1[0][6] / 4) < (48 < a1[0][2])));
+            a0[1] = (((v0 * 76) ? (10 && a1[0][10]) : (i2 >= v1)) ? ((a0[15] != v3) != (a0[0] || v3)) : ((76 >= v1) && (46 + a0[0])));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                if ((a0[5] % 3) > 51) break;
+                v3 = (((v1 >= v3) % 3) + ((v1 > v0) >= (v1 ? v1 : 86)));
+                v3 = (((v0 / 2) + (v2 / 7)) / 8);
+                v1 = (((a0[14] == a1[0][0]) && (a1[1][8] * 58)) >= ((i2 ? i3 : v2) < (a0[13] / 8)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            v1 = (((i4 && i4) <= (82 % 2)) || ((54 != a1[1][13]) * (a0[15] - a1[2][2])));
+            for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+                v2 = (((v0 && 23) != (v0 > a1[0][12])) / 8);
+                v1 = (((49 + a0[9]) <= (a0[10] < 5)) > ((i4 / 6) || (i5 && v3)));
+                v1 = (((a1[3][11] <= v2) <= (17 - 72)) * ((a1[0][11] >= a1[2][5]) != (a1[2][0] < a1[1][5])));
+            }
+            a0[9] = (((v0 > i4) <= (v0 + v1)) % 8);
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[2] == a0[10]) ? (v0 ? a1[1][10] : a1[1][10]) : (6 % 6)) && ((v1 ? v2 : v1) - (52 == 7)));
+}
+int f1() {
+    int v0 = 74;
+    int v1 = 70;
+    int v2 = 20;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v1 = (((67 >= i1) > (v3 ? i1 : v1)) ? ((v0 > i0) || (v2 % 1)) : ((i1 == i1) > (25 > 9)));
+                a1[3][8] = (((v3 + v0) - (a1[1][15] - i0)) && ((a0[7] ? v2 : v2) < (v1 && i0)));
+                a0[9] = (((19 * 98) + (v0 * i0)) && ((15 / 8) < (85 || v2)));
+                i1 = i1 + 1;
+            }
+        }
+        a0[0] = (((i0 / 3) - (i0 ? i0 : 30)) || ((v3 != 30) ? (i0 ? a0[4] : 23) : (a0[7] && 18)));
+        a0[9] = (((a0[14] % 7) || (77 - v2)) % 3);
+    }
+    a1[2][12] = (((84 * v0) - (48 / 1)) - ((v1 < 88) && (a0[12] < v1)));
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            {
+                int i3 = 0;
+                do {
+                    if ((8 >= i2) > 84) break;
+                    a1[0][2] = (((82 && i3) - (v0 && v0)) % 8);
+                    v1 = (((v2 / 1) * (37 - 67)) - ((v0 + v0) != (i3 + 14)));
+                    v2 = (((34 > v1) < (a1[3][1] % 3)) < ((i2 == 65) ? (56 ? v2 : a1[3][15]) : (65 / 9)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v2 = (((25 != i2) || (54 % 4)) - ((48 || a1[0][15]) > (91 != i2)));
+            v0 = (((95 && v3) + (v3 > i2)) == ((a1[3][6] != v1) && (52 - v2)));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v3 >= a1[3][6]) != (v3 * a1[2][13])) > ((a0[6] % 9) && (9 != 30)));
+    if ((((v0 == v2) && (a0[0] - v1)) / 8)) {
+        a1[0][6] = (((28 ? v0 : a0[12]) < (a1[3][8] == v2)) || ((51 <= v3) <= (29 || v3)));
+        v2 = (((v3 * a0[1]) > (v0 + v2)) * ((v1 >= v1) && (v2 > a1[2][14])));
+        v0 = (((a1[0][8] - a1[2][5]) != (v2 > a1[1][9])) ? ((a1[0][4] ? v1 : v2) != (a1[3][5] > v2)) : ((a1[3][7] < v3) * (45 != 13)));
+    } else {
+        a0[15] = (((78 == v0) || (v2 % 5)) == ((75 >= 50) % 8));
+        v3 = (((a1[0][8] + v3) == (v2 - v3)) <= ((73 != v3) == (v1 != 18)));
+        v2 = (((v2 > v1) ? (v2 - v1) : (47 * v3)) && ((13 / 6) ? (v3 < 52) : (v0 >= 81)));
+    }
+    return (((v0 ? v2 : v3) >= (a1[3][7] > v2)) ? ((v3 > v1) ? (v2 || 73) : (v1 / 3)) : ((a0[11] / 2) ? (a1[3][0] && 98) : (v0 != 60)));
+}
+int f2() {
+    int v0 = 20;
+    int v1 = 16;
+    int v2 = 35;
+    int v3 = 25;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        a1[1][1] = (((59 || v1) && (a0[12] == i0)) / 1);
+        {
+            int i1 = 0;
+            do {
+                v1 = (((v2 / 1) && (72 < a0[12])) % 6);
+                v2 = (((31 < 47) > (v3 <= i1)) ? ((i0 % 2) >= (v1 <= 86)) : ((v2 > v0) >= (a1[3][7] * v3)));
+                a1[2][10] = (((i1 == v1) && (v3 ? v0 : v1)) <= ((v1 == v0) / 1));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        v2 = (((77 != v3) > (a0[0] == v0)) ? ((v0 < a0[4]) ? (a1[0][11] != i0) : (65 * i0)) : ((66 != a0[1]) ? (v0 + i0) : (i0 % 7)));
+    }
+    a0[11] = (((v0 * v2) && (a0[14] && v3)) + ((a0[7] / 2) < (v2 ? v1 : v0)));
+    if ((((v3 != 53) || (v3 - v2)) > ((v1 - v0) ? (v0 ? v0 : v0) : (a1[1][1] + a0[12])))) {
+        a1[3][10] = (((89 <= v1) || (28 > 57)) + ((38 ? v0 : 28) == (97 + a1[2][1])));
+        a0[9] = (((8 * v2) >= (14 && v2)) < ((a1[2][8] + v0) ? (84 * a0[12]) : (a1[0][8] == a0[6])));
+        v3 = (((v2 || v0) ? (v0 == 10) : (a1[3][14] <= 79)) == ((a0[7] >= v3) > (v3 + v3)));
+    } else {
+        v2 = (((a0[15] < v2) ? (v0 - v0) : (v0 && v2)) <= ((v1 < 78) <= (14 / 3)));
+        a0[5] = (((v0 >= a1[0][6]) == (77 + v2)) || ((14 && a0[7]) && (15 > a0[14])));
+        a1[3][1] = (((53 + a1[0][15]) != (57 == v2)) && ((v1 >= v1) - (v0 && v3)));
+    }
+    a0[15] = (((v1 == v0) >= (v1 - 13)) < ((a0[8] * v0) > (a0[15] && v2)));
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v2 = (((i3 ? i2 : a1[0][4]) / 1) != ((a1[0][11] || a1[1][11]) <= (v2 % 3)));
+                a0[7] = (((a0[0] - 55) ? (v1 + v3) : (v3 + 5)) || ((27 ? a1[1][1] : a1[1][5]) ? (i2 < v0) : (a0[5] >= v1)));
+                v3 = (((i2 / 9) ? (v3 && a1[1][1]) : (92 % 7)) || ((i2 != 30) == (v1 * 24)));
+            }
+            v0 = (((67 ? 94 : a0[8]) && (a1[2][12] || i2)) != ((v1 || 83) >= (a0[11] + 0)));
+            v1 = (((v1 - v1) < (a1[3][1] && a0[0])) >= ((67 ? v2 : 76) <= (a1[2][5] && a1[3][11])));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    return (((v2 || v3) <= (v3 % 5)) && ((v1 >= v1) > (a0[14] > a0[13])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
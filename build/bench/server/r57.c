@@ -0,0 +1,67 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 72;
+    int v2 = 47;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][5] < v0) / 2) % 7)) {
+        v3 = (((v3 ? v2 : a1[3][3]) || (v1 == v1)) ? ((63 || 2) - (v2 <= v3)) : ((v0 >= 37) / 1));
+        v3 = (((a1[1][2] != v3) ? (a1[3][8] != 80) : (74 / 3)) - ((v3 && a0[12]) * (5 < v3)));
+        a1[3][11] = (((v3 - a1[2][0]) != (a0[3] || a0[8])) == ((v1 * 89) != (6 < a1[0][2])));
+    } else {
+        a0[1] = (((v3 || v1) ? (v2 && v3) : (v0 > v1)) / 9);
+        v3 = (((a1[2][0] - a0[12]) - (a1[2][7] < 13)) != ((v0 + v2) > (v2 % 4)));
+        v0 = (((83 && 84) + (a0[10] ? 7 : a1[1][2])) && ((v2 >= v3) <= (82 && a0[3])));
+    }
+    a0[12] = (((a1[0][12] - 39) ? (v1 ? a1[0][8] : v0) : (27 || 69)) % 1);
+    if ((((v2 / 7) && (v0 != 26)) / 7)) {
+        v1 = (((v0 < 58) && (v2 <= 89)) ? ((v0 > a0[8]) ? (v0 ? v1 : 30) : (v3 <= v3)) : ((v1 && v2) == (0 <= v1)));
+        a0[10] = (((v3 - v0) > (81 >= v1)) * ((v0 <= 37) >= (v1 < a1[0][6])));
+        v3 = (((v0 >= a1[1][10]) % 7) >= ((a0[8] ? v1 : 90) - (v3 <= 75)));
+    } else {
+        v0 = (((v3 < v2) + (v3 || v2)) % 8);
+        v2 = (((v2 % 9) < (v3 ? a1[2][4] : v2)) / 8);
+        v0 = (((a1[3][6] > a1[3][8]) > (v1 + v0)) * ((v1 / 5) <= (a0[5] >= v2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v0 = (((v2 != 79) ? (a0[0] && a0[8]) : (a0[15] == 84)) / 8);
+                    v1 = (((63 * v3) && (a1[1][7] >= v3)) ? ((a1[3][0] + v0) ? (i0 && 29) : (88 == a1[2][3])) : ((83 && v1) > (a1[1][13] >= 15)));
+                    v2 = (((93 ? v2 : v1) + (a1[0][0] < 26)) / 6);
+                    i1 = i1 + 1;
+                }
+            }
+            v3 = (((a1[0][15] && v3) * (v0 ? v2 : 56)) > ((a0[10] / 5) || (v1 && a0[9])));
+            v3 = (((v2 >= 74) > (19 * 11)) ? ((a0[1] ? v2 : v0) + (i0 || v3)) : ((40 || v2) + (v0 < a0[5])));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((3 >= v1) <= (34 <= i2)) - ((37 > a0[1]) >= (69 < i3)));
+                    v1 = (((i2 >= v3) - (i3 <= v1)) == ((a1[1][0] < a0[1]) || (a0[9] <= v3)));
+                    v2 = (((95 < a1[2][2]) / 8) > ((v1 || v0) - (i2 * v3)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a1[1][0] = (((a1[1][10] - v2) % 3) < ((a1[3][7] || i2) == (v1 < a0[0])));
+            a1[3][0] = (((a0[0] || 66) * (v0 == i2)) / 8);
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    return (((v3 < 68) != (41 > a0[10])) / 3);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
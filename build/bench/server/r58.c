@@ -0,0 +1,105 @@
+int f0() {
+    int v0 = 93;
+    int v1 = 96;
+    int v2 = 73;
+    int v3 = 27;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 ? 27 : v3) < (29 || a0[6])) >= ((v2 != 57) % 2));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            if ((a1[3][9] >= v0) > 86) break;
+            v0 = (((v0 / 3) >= (a1[3][12] || v2)) / 4);
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    if ((a0[4] != v3) > 53) break;
+                    v3 = (((22 <= 7) / 8) && ((v1 != a0[6]) - (i1 != v2)));
+                    v3 = (((a1[3][13] + 25) / 7) && ((i0 ? v2 : 52) ? (a0[15] == v3) : (v0 - v0)));
+                    v0 = (((v3 || i1) + (v0 >= a1[1][13])) >= ((a0[14] && v3) * (24 >= a0[15])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[1][1] = (((v2 || a0[11]) < (v1 || a1[1][7])) + ((a1[3][9] ? v1 : a0[2]) ? (v3 == i0) : (v0 ? i0 : v1)));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((a0[12] * a1[0][6]) <= (v3 > v0)) % 4)) {
+        v1 = (((v1 ? v2 : v3) > (0 && v3)) % 3);
+        v2 = (((97 >= v2) < (0 > v2)) == ((v0 / 9) - (v0 == 70)));
+        a1[3][7] = (((v3 != v0) || (a1[1][10] < 65)) >= ((22 / 5) < (v0 ? v0 : a1[2][6])));
+    } else {
+        a1[2][6] = (((v1 / 4) ? (a1[1][13] > v1) : (64 / 7)) / 9);
+        v1 = (((a0[3] % 1) ? (v1 < v1) : (v2 <= v2)) && ((a1[0][14] * v3) <= (a0[14] % 4)));
+        v0 = (((v2 ? v0 : a1[3][4]) && (95 + 88)) && ((a0[8] != v3) != (v3 >= 73)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((34 || a0[2]) > 90) break;
+            v1 = (((v3 + i2) ? (a1[1][7] <= 96) : (i2 || v3)) > ((v0 * 48) < (a0[7] * v1)));
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a1[0][3] = (((a0[3] < v3) || (a0[15] > a1[1][11])) <= ((i3 / 3) + (59 % 8)));
+                v3 = (((v0 - v1) < (74 != i2)) < ((v0 % 8) && (62 >= v2)));
+                a1[3][3] = (((v2 == 4) / 6) == ((a0[14] ? 14 : 87) <= (a1[3][7] ? 39 : a1[1][4])));
+            }
+            a0[0] = (((85 - v1) ? (i2 < v0) : (v0 ? v2 : 18)) < ((v1 == v3) * (88 < a0[14])));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+            v3 = (((v1 ? a1[3][10] : v1) && (v1 % 5)) && ((v1 && a0[14]) != (31 != v1)));
+            a1[0][9] = (((a1[1][10] > a0[8]) <= (93 != v1)) >= ((a1[0][10] ? 27 : v3) + (v3 / 7)));
+            a0[1] = (((41 >= v0) * (v3 + a0[9])) > ((58 - i5) == (18 / 9)));
+        }
+        a0[15] = (((80 >= 20) || (a1[1][6] == v0)) ? ((a1[0][12] - v0) ? (v0 ? v3 : 0) : (v1 == a1[0][7])) : ((i4 == a0[13]) - (a1[3][2] <= 2)));
+        v1 = (((a1[2][6] / 5) / 8) <= ((v2 < v3) - (a0[9] ? 27 : v1)));
+    }
+    return (((a0[9] < 92) == (a0[14] == 94)) % 1);
+}
+int f1() {
+    int v0 = 37;
+    int v1 = 34;
+    int v2 = 73;
+    int v3 = 43;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 ? a0[10] : v1) > (83 % 3)) && ((a0[8] == a1[0][0]) / 7))) {
+        v2 = (((a1[1][13] != a1[2][6]) - (v0 % 7)) - ((v0 * 52) % 1));
+        v1 = (((a0[10] >= a1[3][10]) == (v0 * v0)) / 3);
+        v3 = (((92 ? 56 : 52) ? (53 / 3) : (v0 % 7)) > ((v3 - v2) || (a1[0][1] >= a0[9])));
+    } else {
+        v1 = (((a1[0][9] + 35) == (v1 ? v3 : v0)) + ((36 >= 79) - (a0[12] % 9)));
+        v0 = (((a0[0] ? v0 : 80) / 3) ? ((v2 ? v3 : a1[1][13]) > (v0 == a0[15])) : ((a0[1] == v3) % 6));
+        a1[1][2] = (((80 ? 17 : v1) >= (v2 - a1[2][6])) != ((v3 * v0) && (a1[3][14] != v0)));
+    }
+    v2 = (((52 ? 37 : v3) % 7) > ((12 == v2) == (v0 - v0)));
+    if ((((v1 ? v3 : 16) < (68 * v1)) / 2)) {
+        v3 = (((29 - v1) - (64 - v2)) % 2);
+        v0 = (((77 && v0) * (v3 + a1[2][3])) != ((64 + v3) && (v1 ? v1 : a1[1][8])));
+        v3 = (((a0[3] * v1) < (a1[1][2] > 58)) * ((v0 + 78) - (a0[2] && v1)));
+    } else {
+        v2 = (((v0 && v1) && (v1 + 0)) % 2);
+        a1[2][7] = (((84 ? a0[0] : v0) < (v3 > 29)) % 1);
+        v3 = (((v0 ? 24 : v0) && (v0 < v0)) >= ((a0[0] >= 14) != (a0[15] + v2)));
+    }
+    if ((((16 && v2) != (68 - v0)) % 1)) {
+        a0[2] = (((a0[3] || v1) || (a0[13] ? 5 : a0[11])) - ((v0 % 8) * (v2 ? 0 : v1)));
+        a0[14] = (((v2 && a1[1][7]) == (v1 > a1[0][3])) > ((v3 % 8) / 6));
+        v3 = (((v2 + v0) * (24 >= a0[12])) % 1);
+    } else {
+        v2 = (((v3 >= v2) <= (51 ? v1 : v2)) % 9);
+        a1[3][3] = (((75 + v2) / 1) != ((a0[5] % 3) != (a0[11] ? 75 : v0)));
+        v0 = (((v3 > a0[14]) / 8) == ((64 * a1[3][9]) >= (17 ? a1[0][1] : a0[15])));
+    }
+    v1 = (((53 - v3) == (v2 ? a1[0][12] : v2)) - ((72 + 53) + (v1 || a1[0][15])));
+    return (((v1 || v3) > (v2 == v2)) / 3);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,160 @@
+int f0() {
+    int v0 = 1;
+    int v1 = 17;
+    int v2 = 50;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    a0[7] = (((v1 || v1) != (7 > v1)) ? ((76 && v3) != (7 != v2)) : ((v1 >= v1) || (a0[8] + v0)));
+    v3 = (((v2 ? v3 : v0) > (v0 - a0[8])) % 6);
+    if ((((v3 + a1[1][15]) < (v2 + v3)) && ((62 ? v3 : v1) * (v2 > v0)))) {
+        v1 = (((76 % 8) && (9 > 44)) - ((v3 <= a0[2]) + (99 >= 94)));
+        a0[14] = (((a0[9] <= a0[10]) ? (19 <= 68) : (v3 * a0[9])) <= ((v2 % 3) / 3));
+        a0[5] = (((v1 && v2) >= (a0[0] - v0)) * ((a1[3][11] > v0) == (29 + a0[12])));
+    } else {
+        v3 = (((v3 - v0) && (v1 ? 86 : 14)) && ((v2 < v2) - (v2 + v2)));
+        a0[5] = (((a1[0][11] || v2) * (v3 % 8)) != ((v0 + v3) != (20 % 1)));
+        a1[3][14] = (((a0[13] < 90) != (a1[2][11] > a1[1][15])) != ((v0 ? v0 : v0) * (a0[6] < v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                a1[2][0] = (((a1[1][3] == i1) % 4) ? ((v3 > v3) || (v0 <= 29)) : ((a1[3][8] / 8) || (i0 * 35)));
+                v0 = (((v0 * a0[9]) / 7) ? ((i1 >= 13) == (v0 ? v1 : 16)) : ((89 <= v1) ? (a1[2][4] % 7) : (a1[0][10] / 8)));
+                v3 = (((v2 != 20) && (i0 % 4)) < ((v1 != 25) * (a1[0][9] / 6)));
+            }
+            v0 = (((26 && 83) || (a0[10] - v3)) % 1);
+            a1[2][0] = (((31 < v1) <= (85 / 2)) % 1);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((v1 < v2) % 1) == ((a0[5] != 54) && (i2 < 60)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                a1[3][1] = (((4 >= i2) > (a0[10] / 9)) < ((a0[12] + a1[3][6]) * (v1 + a1[0][14])));
+                v2 = (((v1 >= 39) >= (v2 || a0[14])) && ((i2 + 74) % 5));
+                v3 = (((a1[1][3] && v0) <= (v0 <= a1[2][7])) == ((v2 % 6) / 4));
+            }
+            v1 = (((38 * v1) ? (a1[3][8] || v0) : (a1[1][11] >= v0)) > ((a0[12] + v0) >= (v3 != 27)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    return (((a0[8] == 64) % 2) % 3);
+}
+int f1() {
+    int v0 = 4;
+    int v1 = 91;
+    int v2 = 1;
+    int v3 = 90;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 || 52) ? (a1[0][10] && v3) : (v0 + v2)) || ((v3 + v2) && (v0 >= v3)))) {
+        v3 = (((v2 - a0[7]) ? (v2 + v0) : (a1[0][15] % 9)) + ((a0[12] % 1) / 5));
+        v0 = (((v2 % 4) / 8) % 4);
+        v1 = (((45 >= v2) % 2) || ((58 * a0[1]) <= (v3 == 9)));
+    } else {
+        a1[3][0] = (((v0 ? 58 : 87) >= (v2 <= v0)) / 1);
+        a0[13] = (((v2 || v1) == (26 == 33)) <= ((v1 ? v1 : v0) >= (v0 - v0)));
+        a0[8] = (((a1[1][4] % 8) - (a0[15] + 40)) > ((41 - v1) - (v3 ? v2 : a0[2])));
+    }
+    if ((((a0[8] ? a1[3][3] : 72) == (a0[4] == 64)) ? ((4 <= v0) / 6) : ((v2 ? v0 : v3) + (95 && v0)))) {
+        a0[9] = (((v0 >= 34) >= (27 / 1)) % 6);
+        v3 = (((v2 == v2) > (a1[0][0] ? v1 : v2)) + ((v1 <= v0) && (a0[12] <= v2)));
+        v0 = (((v3 + v3) * (25 <= 27)) || ((v0 && 90) * (a0[1] / 7)));
+    } else {
+        v0 = (((v0 < 48) <= (v1 / 8)) || ((v3 == v1) - (v3 || v1)));
+        a0[4] = (((v3 >= v1) || (v1 + v0)) * ((a1[1][1] != v1) < (v0 || v0)));
+        a1[1][5] = (((a0[1] == a1[1][1]) ? (a1[2][12] ? a1[0][13] : 89) : (5 == v3)) < ((v1 > a0[14]) * (88 + v0)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            v2 = (((v1 != v1) != (a1[0][9] ? v1 : a0[7])) ? ((32 <= v1) / 7) : ((v2 >= a0[10]) * (v2 + v0)));
+            a0[7] = (((v1 < a1[0][4]) >= (v3 > a0[0])) >= ((v0 ? v3 : 96) && (a1[0][7] <= v0)));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v0 = (((i1 ? v1 : v3) > (i1 >= 15)) - ((a0[4] ? v1 : v2) == (v2 - v2)));
+                v1 = (((77 > i0) && (a0[5] == v2)) || ((73 <= i0) != (i0 >= v2)));
+                a1[0][10] = (((v1 * a0[1]) / 7) || ((v2 + i0) - (v2 * v2)));
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 ? a1[2][0] : 16) && (96 % 9)) ? ((a0[9] * v3) != (a1[1][13] || 63)) : ((28 - v3) * (a0[9] + 59)))) {
+        a0[9] = (((75 ? a0[11] : a0[5]) + (v0 || v3)) >= ((66 / 3) == (v2 ? 71 : v0)));
+        v2 = (((v2 <= v1) >= (v3 < v2)) + ((66 / 3) || (v3 == 35)));
+        v2 = (((v0 * v3) < (v0 ? a1[1][14] : 40)) ? ((v0 % 2) % 2) : ((5 % 1) + (v3 || v0)));
+    } else {
+        v2 = (((v2 <= v0) <= (v2 % 6)) || ((70 + a1[3][13]) / 1));
+        v2 = (((a0[2] % 3) % 6) && ((v1 && 13) ? (27 - a1[1][4]) : (11 ? a1[2][2] : a0[13])));
+        v3 = (((v3 - v3) % 2) <= ((92 && v0) >= (53 || v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                a1[2][11] = (((v3 % 3) / 3) - ((a1[0][1] % 3) % 3));
+                v3 = (((61 <= 39) % 5) && ((45 > v1) + (9 ? a0[10] : 37)));
+                a1[1][9] = (((1 != v3) * (a0[0] % 6)) % 5);
+            }
+            v3 = (((86 < a1[3][0]) + (62 || 89)) >= ((v2 && v0) == (a1[2][6] <= 92)));
+            v1 = (((v0 <= a1[0][14]) / 7) >= ((v0 - 34) + (v2 < v3)));
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    return (((v0 > v0) ? (v2 <= a0[7]) : (v3 >= 80)) - ((v3 % 9) % 3));
+}
+int f2() {
+    int v0 = 89;
+    int v1 = 10;
+    int v2 = 31;
+    int v3 = 62;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v3 ? v0 : v1) > 80) break;
+            {
+                int i1 = 0;
+                do {
+                    if ((81 ? i1 : 27) > 89) break;
+                    v2 = (((51 >= i1) <= (23 % 5)) == ((a1[0][0] >= i0) - (34 && v3)));
+                    a1[3][7] = (((54 < v3) + (v0 && a0[13])) ? ((a0[11] != a1[0][2]) != (a0[9] * v2)) : ((v2 + i0) ? (12 <= v3) : (70 * v1)));
+                    a1[0][10] = (((19 + 81) <= (57 != v0)) == ((i0 / 2) || (a1[0][1] >= a1[2][14])));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v0 = (((i0 <= v0) <= (8 <= 53)) > ((v0 == v0) + (91 || i0)));
+            a1[3][13] = (((91 + v1) >= (94 + a1[2][7])) ? ((v0 < a1[3][13]) * (v3 <= a0[10])) : ((16 - i0) || (a0[0] <= v2)));
+            i0 = i0 + 1;
+        }
+    }
+    a0[3] = (((v3 % 2) / 1) != ((v0 < v3) || (v1 + v0)));
+    a1[2][3] = (((v3 + v1) / 9) * ((a1[3][0] ? 76 : 23) || (v3 + 18)));
+    v3 = (((a1[1][5] < a1[0][4]) >= (86 / 4)) > ((a0[11] || v1) * (a1[1][5] != v2)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v0 = (((97 == 4) || (v2 % 5)) > ((i2 ? 0 : v1) % 3));
+        v3 = (((a0[10] % 2) && (v0 >= v3)) + ((i2 - a1[2][7]) > (v0 * v2)));
+        {
+            int i3 = 0;
+            do {
+                if ((v2 - v0) > 75) break;
+                v0 = (((v3 > v0) / 6) ? ((v3 / 3) + (84 || v0)) : ((a0[2] || i3) <= (v3 >= 56)));
+                v1 = (((v0 * v2) == (v0 ? v0 : a1[2][1])) < ((a0[4] - a1[0][12]) ? (a0[10] >= a1[0][3]) : (v3 != 34)));
+                v3 = (((a1[3][15] <= i2) == (v1 ? v1 : v1)) && ((v3 == i3) <= (a0[11] ? v3 : v3)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+    }
+    return (((a1[3][0] > a0[7]) && (74 < v3)) / 6);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
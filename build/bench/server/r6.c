@@ -0,0 +1,39 @@
+int f0() {
+    int v0 = 15;
+    int v1 = 92;
+    int v2 = 21;
+    int v3 = 86;
+    int a0[16];
+    int a1[4][16];
+    a0[9] = (((a0[7] < a0[10]) && (v3 ? 40 : v2)) < ((79 <= 2) ? (v1 - 27) : (v2 >= v0)));
+    if ((((a1[3][3] >= v0) != (60 ? v1 : 50)) * ((v1 <= 1) && (95 < a0[3])))) {
+        v3 = (((a1[3][4] != a1[2][9]) % 8) / 3);
+        v3 = (((v1 <= v3) == (80 == v1)) != ((v2 == 61) && (v3 / 7)));
+        a0[5] = (((v3 > a0[7]) - (52 + a0[6])) % 5);
+    } else {
+        v0 = (((v3 && 92) <= (a0[0] / 1)) <= ((v0 > v2) > (a1[2][10] >= a1[1][6])));
+        v0 = (((v3 > 41) % 2) ? ((v1 == a0[15]) ? (v1 && 81) : (a1[2][11] != 75)) : ((v1 % 1) <= (v0 != v2)));
+        a1[3][1] = (((a0[4] != v1) % 4) || ((55 * v1) % 9));
+    }
+    a0[2] = (((8 / 9) % 8) ? ((73 && v3) || (7 != v0)) : ((74 <= 96) ? (25 % 8) : (a0[1] && v3)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v1 = (((20 + a0[11]) < (a0[10] && 47)) < ((v0 + v3) != (a1[1][13] >= v3)));
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v0 = (((v1 == a1[2][14]) && (4 * v0)) == ((a0[4] % 9) && (37 < 24)));
+                v2 = (((i0 || v3) < (a1[3][5] >= i1)) / 7);
+                v0 = (((i1 < 54) * (i1 >= 42)) >= ((i0 ? v2 : a1[0][7]) * (v1 <= a1[3][4])));
+            }
+            a1[2][2] = (((64 > a0[11]) / 2) + ((v3 < 36) ? (v1 % 9) : (i0 == a1[1][14])));
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((0 + 36) - (v0 * v1)) <= ((a0[0] || v3) + (2 || 2)));
+    return (((94 || v2) >= (v0 <= a0[5])) / 1);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
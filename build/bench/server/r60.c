@@ -0,0 +1,51 @@
+int f0() {
+    int v0 = 11;
+    int v1 = 6;
+    int v2 = 70;
+    int v3 = 96;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[1][13] >= 35) != (v1 ? v0 : a0[3])) == ((a0[8] <= a0[3]) % 2));
+    if ((((a0[5] && 74) * (v1 / 4)) == ((a0[4] % 3) && (v2 % 4)))) {
+        v3 = (((v3 ? a1[3][14] : 0) / 4) * ((a1[2][10] > v0) >= (90 == v3)));
+        v2 = (((47 ? a0[13] : v0) ? (96 + v2) : (a0[6] <= a0[13])) <= ((v3 * v3) != (v3 && a0[9])));
+        v2 = (((v0 == a1[1][4]) || (69 - a0[15])) < ((v0 * 62) + (v0 ? v0 : 10)));
+    } else {
+        a0[2] = (((86 / 5) - (44 == v0)) || ((v0 >= v3) ? (v0 != 28) : (33 < v2)));
+        v1 = (((77 + a0[8]) + (65 && v2)) * ((v2 <= v3) ? (v2 ? 75 : v1) : (81 + v3)));
+        a1[0][2] = (((53 + v3) == (v0 || v3)) < ((v2 ? v1 : a0[12]) || (97 - 21)));
+    }
+    a1[3][6] = (((88 + v3) * (a0[6] - 74)) - ((a1[0][1] > v0) ? (98 != v3) : (v3 ? v1 : 38)));
+    {
+        int i0 = 0;
+        do {
+            v1 = (((3 == 25) || (36 / 5)) && ((v0 != v3) != (a1[0][0] < a0[15])));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v1 = (((v3 < v0) ? (v3 == i1) : (a1[1][0] * v3)) <= ((a0[14] % 1) - (a1[2][15] || v3)));
+                    v2 = (((i0 < a1[0][9]) < (47 > a1[0][5])) == ((a0[6] ? a1[0][11] : i0) && (53 < a0[13])));
+                    v0 = (((v2 && i0) % 8) - ((v0 <= a0[1]) % 6));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v2 / 7) - (12 % 4)) || ((24 % 1) ? (a1[3][4] / 5) : (a1[2][5] || a1[1][13])));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    if ((((v3 * 32) == (v0 % 7)) > ((v0 <= v0) == (63 - v0)))) {
+        a0[4] = (((a0[7] % 7) <= (v3 - 63)) > ((v3 < v2) * (v3 % 3)));
+        a1[3][6] = (((a0[2] || a1[1][3]) <= (v0 < 50)) / 8);
+        a0[9] = (((52 == v0) < (v0 / 1)) >= ((v2 == v0) * (v0 > v1)));
+    } else {
+        v3 = (((v3 <= a1[3][6]) - (a0[5] < a0[14])) % 2);
+        v2 = (((v2 <= a0[9]) ? (4 < 3) : (v0 != v0)) ? ((v3 && a1[0][0]) ? (63 / 3) : (v1 < v2)) : ((37 != v1) % 3));
+        v0 = (((v3 < v0) != (v1 && a1[1][6])) * ((v0 || v3) > (a1[3][15] * 31)));
+    }
+    return (((v1 / 5) >= (v2 && 50)) ? ((a1[2][11] == v0) || (a0[4] != v3)) : ((47 / 2) - (a0[15] || v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,94 @@
+int f0() {
+    int v0 = 78;
+    int v1 = 24;
+    int v2 = 53;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    a1[2][5] = (((10 / 4) && (a0[3] % 1)) % 6);
+    if ((((24 / 3) <= (87 >= 47)) ? ((a1[1][6] * v1) - (75 ? a1[3][5] : a1[3][3])) : ((a1[0][7] ? v1 : a1[0][1]) >= (23 && 48)))) {
+        a1[1][14] = (((a1[2][7] * a1[0][5]) <= (v0 % 2)) ? ((v2 > v2) <= (a1[2][10] < v1)) : ((v0 == v0) != (v0 != v0)));
+        v2 = (((v1 % 5) <= (a1[3][7] * v0)) ? ((50 < a1[1][4]) < (a1[0][12] == 90)) : ((v2 >= a1[2][2]) && (v2 && a1[3][1])));
+        a1[3][5] = (((v3 * 19) % 6) - ((v0 / 9) <= (v0 && v0)));
+    } else {
+        v1 = (((79 < v3) && (v3 % 4)) - ((v3 == a0[1]) % 8));
+        a0[1] = (((v1 == v0) == (a0[7] >= a1[2][6])) ? ((a0[12] ? a0[4] : a0[1]) + (a0[11] >= a0[7])) : ((v2 == v2) ? (v2 <= v2) : (v3 || 28)));
+        v1 = (((a0[5] / 6) < (v1 >= 65)) == ((v0 < v0) || (v0 || 56)));
+    }
+    if ((((63 <= 53) % 9) < ((a0[8] >= 9) <= (a1[3][2] - a0[12])))) {
+        v3 = (((a1[2][12] ? a1[2][5] : a1[2][1]) > (95 - v0)) != ((v2 || a0[8]) >= (v2 && a1[1][1])));
+        v2 = (((v0 / 3) <= (79 && v1)) ? ((40 > v3) ? (a1[2][8] + v2) : (49 == a0[15])) : ((v0 || 38) < (96 + v0)));
+        v3 = (((a1[1][12] >= v0) || (v0 % 9)) - ((70 >= a0[2]) + (a1[3][11] + v1)));
+    } else {
+        v2 = (((v1 || 9) * (v0 == v0)) ? ((a0[2] % 3) % 3) : ((v2 - v3) != (a0[15] == a0[9])));
+        v0 = (((v2 ? v3 : a0[6]) ? (25 || 59) : (v1 >= 8)) != ((v1 > v2) > (v0 < 80)));
+        a1[1][9] = (((74 >= v3) != (v0 * v0)) % 6);
+    }
+    a0[2] = (((v1 > v3) < (v0 % 6)) - ((a1[1][2] * v2) - (v0 <= v1)));
+    if ((((v0 || 22) > (71 > a0[0])) > ((82 && a0[14]) && (v2 && a0[1])))) {
+        a0[10] = (((v3 >= v1) != (12 <= 16)) >= ((v2 % 7) * (a0[6] == v0)));
+        a0[3] = (((v3 <= v3) != (v1 - a0[7])) - ((12 < v3) > (v3 >= v2)));
+        v2 = (((v3 * 90) - (v2 + v0)) || ((a0[11] >= v3) ? (a0[9] + 15) : (a1[1][8] <= 19)));
+    } else {
+        v0 = (((a0[7] >= v0) ? (40 <= 49) : (v2 - v3)) || ((a0[7] * v1) % 6));
+        a0[14] = (((a1[3][9] || v0) ? (v1 ? a0[12] : 96) : (v0 * a1[1][9])) || ((a0[5] - v1) || (v0 / 8)));
+        a0[8] = (((v1 - 91) && (62 < 0)) * ((a1[2][9] == v2) > (v2 || v3)));
+    }
+    return (((v1 + v1) > (v0 < a0[4])) + ((99 != a1[1][15]) ? (64 > a1[3][0]) : (a0[13] && a1[3][13])));
+}
+int f1() {
+    int v0 = 42;
+    int v1 = 6;
+    int v2 = 75;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    a1[0][15] = (((v0 != v0) != (37 || v3)) > ((a0[13] / 2) > (v1 - v3)));
+    a0[10] = (((v1 < v1) <= (v3 + a0[6])) - ((v1 && 25) % 3));
+    for (int i0 = 0; i0 < 6; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v2 = (((39 / 5) ? (i0 / 6) : (v0 < i0)) <= ((v1 * a0[11]) < (v1 * a1[2][12])));
+                v2 = (((a1[1][2] >= v0) == (v1 * 1)) % 5);
+                a0[8] = (((18 % 8) - (v3 || i0)) == ((a0[14] - v0) && (v2 <= 96)));
+                i1 = i1 + 1;
+            } while (i1 < 4);
+        }
+        v2 = (((a0[0] != a1[3][8]) % 3) != ((v3 % 2) >= (98 && 63)));
+        v2 = (((a1[3][12] && 3) + (12 >= a0[9])) ? ((v2 != 38) + (v3 * v3)) : ((21 >= v0) || (v1 <= v0)));
+    }
+    if ((((76 && 12) * (v1 ? 25 : v0)) || ((v1 ? v2 : a1[3][6]) / 7))) {
+        a1[2][11] = (((91 / 6) < (v3 % 7)) * ((a1[1][10] % 8) ? (v0 && a0[3]) : (v0 < v2)));
+        a0[12] = (((6 == a0[4]) || (a1[1][6] % 3)) > ((a1[0][3] ? v2 : v3) >= (a0[13] ? v2 : v0)));
+        v3 = (((a1[0][0] / 6) <= (a1[2][2] == v2)) ? ((45 || v2) <= (v0 > v2)) : ((96 * v1) + (70 < 55)));
+    } else {
+        a0[8] = (((a1[3][11] != a1[3][2]) < (v0 < a0[4])) <= ((14 % 3) % 3));
+        v0 = (((v1 && 15) + (v0 + 10)) && ((v3 < v2) ? (8 == 61) : (a1[1][10] ? v0 : v0)));
+        v0 = (((32 ? v1 : 95) - (v2 >= v3)) + ((v1 < v3) / 4));
+    }
+    {
+        int i2 = 0;
+        do {
+            v0 = (((v1 / 6) > (v3 < a1[1][4])) != ((a1[2][4] ? a1[1][10] : 72) <= (a0[1] || v3)));
+            {
+                int i3 = 0;
+                do {
+                    a1[0][6] = (((i2 ? a0[2] : a1[2][9]) ? (v1 > i2) : (a1[1][10] == v0)) ? ((v0 != i2) - (v0 > a0[8])) : ((a0[4] - i2) || (v1 % 2)));
+                    v0 = (((v1 == v0) == (v0 && v3)) != ((26 < a1[1][7]) == (9 - 39)));
+                    v1 = (((v1 <= i2) == (a1[0][6] == 93)) < ((v3 + a1[2][4]) + (v2 - 9)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a1[0][10] = (((v2 % 8) / 8) != ((45 >= a1[2][8]) != (a1[3][5] == i2)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    return (((v1 * v1) <= (v3 % 4)) - ((v2 >= v2) != (v1 * 0)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,196 @@
+int f0() {
+    int v0 = 72;
+    int v1 = 52;
+    int v2 = 55;
+    int v3 = 79;
+    int a0[16];
+    int a1[4][16];
+    if ((((v0 == v0) % 2) ? ((a0[14] - v2) ? (a1[2][12] > 54) : (21 * v1)) : ((a0[12] ? v2 : v3) * (a0[8] && 69)))) {
+        v0 = (((v1 / 3) < (6 <= v1)) % 1);
+        v0 = (((21 / 8) ? (v1 > v1) : (6 <= 85)) || ((16 > 57) - (v3 - v0)));
+        v0 = (((a1[2][13] + 8) <= (62 + a1[0][9])) * ((a1[2][11] % 7) > (87 + v2)));
+    } else {
+        a1[3][12] = (((75 || v3) % 3) == ((v0 != v1) - (a0[4] + a1[2][11])));
+        a1[1][15] = (((v2 + v3) - (v3 * a1[3][2])) || ((91 % 3) && (46 * a1[2][4])));
+        v1 = (((9 < v2) && (v2 && a0[4])) >= ((a0[7] + v3) != (v0 != a0[0])));
+    }
+    a0[14] = (((21 >= v1) && (v1 + v1)) == ((v3 || a0[7]) / 1));
+    if ((((a1[1][4] != a1[3][2]) != (v2 ? v2 : v3)) && ((v1 >= v1) ? (43 > v3) : (38 * 86)))) {
+        v2 = (((74 != 3) + (v2 / 6)) + ((v3 < v0) % 4));
+        a0[15] = (((v1 > 64) && (v1 >= a1[1][2])) <= ((20 < v2) < (a1[2][3] >= v3)));
+        a1[3][6] = (((a0[4] && a1[0][6]) * (1 ? v3 : v1)) > ((37 && a1[1][0]) % 7));
+    } else {
+        v0 = (((a0[0] == v3) / 4) * ((a1[0][0] % 7) ? (18 * v2) : (v0 >= v3)));
+        v3 = (((v1 <= a0[13]) ? (2 && v1) : (85 >= a1[1][15])) ? ((v2 && a0[9]) == (72 * a0[11])) : ((v2 <= 55) ? (91 + a1[2][5]) : (14 ? v2 : v1)));
+        a0[5] = (((a1[2][6] || a1[3][11]) >= (v3 || v0)) + ((a1[3][4] * 59) ? (v3 == v3) : (4 != v0)));
+    }
+    if ((((76 ? v2 : a0[6]) > (a0[4] / 8)) ? ((v1 ? a1[3][5] : v2) < (v2 ? 46 : 70)) : ((v0 || 79) - (a1[0][13] / 3)))) {
+        v3 = (((v2 < v3) <= (v3 || v1)) % 3);
+        v0 = (((v0 <= a0[3]) ? (29 - 21) : (v2 == 59)) && ((38 * a1[0][1]) + (a1[0][2] != a1[3][6])));
+        v1 = (((v3 && 14) > (v2 * v0)) == ((a1[1][14] * a0[6]) >= (7 >= 72)));
+    } else {
+        v0 = (((v3 - v0) >= (v2 <= a1[2][13])) / 9);
+        a0[9] = (((v0 <= v2) <= (v2 < v2)) < ((43 != a1[0][1]) == (v2 % 5)));
+        v1 = (((a0[15] * 87) ? (77 ? v2 : a1[1][14]) : (a0[8] && v1)) > ((44 != v0) <= (v2 < v3)));
+    }
+    if ((((93 / 5) && (v2 * 63)) * ((v3 > v1) == (v1 ? 26 : v2)))) {
+        v0 = (((a0[7] > v1) ? (60 ? v1 : v1) : (a0[2] < 54)) < ((36 == v1) ? (v1 + 4) : (v1 == a0[8])));
+        a0[15] = (((93 <= a0[15]) > (a0[9] >= 23)) % 5);
+        v3 = (((a0[12] - v3) || (a1[1][9] * v0)) || ((v1 ? 78 : 15) ? (v0 < v0) : (84 == a1[2][6])));
+    } else {
+        a1[1][14] = (((51 < v2) / 5) && ((84 % 7) * (a1[2][12] / 9)));
+        v0 = (((v3 % 6) > (v1 < a0[1])) >= ((v0 + v1) < (v1 + v2)));
+        v0 = (((v2 && v0) < (v2 - v0)) ? ((v1 || v3) * (v1 < v1)) : ((a0[13] / 6) > (v1 == v1)));
+    }
+    return (((a0[1] % 7) && (a1[3][6] || v0)) > ((a0[6] % 3) + (v0 - a0[3])));
+}
+int f1() {
+    int v0 = 67;
+    int v1 = 38;
+    int v2 = 1;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((a1[3][7] / 8) < (v0 + 20)) != ((62 / 9) ? (55 == a0[1]) : (v3 >= 40)));
+            v0 = (((v3 % 8) * (v2 > a0[11])) % 7);
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((v3 > 20) > 71) break;
+                    v3 = (((a1[3][8] * v0) % 5) <= ((v0 && i1) && (i1 * a1[2][8])));
+                    a1[0][8] = (((v1 || i1) == (i1 / 9)) ? ((i0 > 47) * (53 == i0)) : ((v1 / 5) <= (a1[2][14] + v3)));
+                    a1[2][15] = (((i0 > a0[15]) <= (i0 < 91)) <= ((62 ? a0[8] : 12) <= (v1 + v0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            v3 = (((a0[13] - v0) && (v0 >= v2)) + ((i2 != 85) != (a0[12] + v1)));
+            a1[2][11] = (((v0 && a0[4]) ? (i2 < a0[9]) : (42 * a0[8])) <= ((15 || v0) && (v1 % 4)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                a1[1][15] = (((v1 % 9) != (a0[3] - i2)) >= ((7 == i3) - (72 * v3)));
+                v1 = (((v0 <= 61) != (a0[7] ? v2 : 5)) || ((v0 % 8) != (22 == v0)));
+                v0 = (((58 * v3) ? (v1 + a1[2][3]) : (v2 > 80)) >= ((a1[1][6] ? 98 : 27) == (a0[7] != v0)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((v2 && v2) > 79) break;
+            v2 = (((a0[5] % 9) <= (47 - v1)) / 5);
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((v2 / 1) || (v2 && i4)) || ((v2 || 50) && (a0[12] / 1)));
+                    a0[11] = (((v2 >= 52) * (a1[2][7] ? 98 : 87)) % 6);
+                    a1[1][5] = (((23 - i4) == (48 * 22)) ? ((a1[2][0] < i4) == (3 != i4)) : ((v3 ? 68 : a0[11]) ? (i5 + a1[2][2]) : (a1[0][4] == v0)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v2 = (((v0 == i4) ? (76 == v1) : (v1 ? 61 : a1[3][4])) / 5);
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    {
+        int i6 = 0;
+        while (i6 < 2) {
+            v1 = (((v0 != i6) <= (a1[0][1] * v1)) % 4);
+            for (int i7 = 0; i7 < 5; i7 = i7 + 1) {
+                a0[13] = (((96 + a0[9]) == (a0[1] * 94)) ? ((a1[0][7] || v3) / 2) : ((98 == i6) < (i7 != a1[0][9])));
+                v3 = (((77 ? 54 : i6) >= (i6 && a1[1][12])) + ((a0[3] == 13) % 6));
+                v1 = (((i7 != v1) * (84 ? 42 : a0[10])) % 9);
+            }
+            v2 = (((21 - v2) == (6 - 55)) * ((37 / 7) && (58 != a0[14])));
+            i6 = i6 + 1;
+        }
+    }
+    for (int i8 = 0; i8 < 5; i8 = i8 + 1) {
+        a0[5] = (((v3 <= v2) != (a0[12] == a0[2])) ? ((a1[3][2] && 60) ? (v0 <= a0[4]) : (a0[13] % 6)) : ((a0[15] * 22) < (a0[1] ? v2 : 46)));
+        v1 = (((a1[1][11] <= i8) >= (v0 / 5)) < ((43 >= a0[0]) > (a0[10] || 68)));
+        for (int i9 = 0; i9 < 8; i9 = i9 + 1) {
+            a0[2] = (((i8 ? 94 : i9) * (v2 <= v2)) - ((27 % 9) && (v3 * v1)));
+            v2 = (((a1[1][9] < v2) * (i8 ? i8 : 32)) % 7);
+            v0 = (((a0[5] == a1[3][11]) != (29 == 87)) - ((v0 % 3) && (60 * a0[14])));
+        }
+    }
+    return (((94 / 1) && (v0 && v0)) || ((v1 <= v2) % 1));
+}
+int f2() {
+    int v0 = 15;
+    int v1 = 66;
+    int v2 = 31;
+    int v3 = 59;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            a0[0] = (((a1[1][2] + 74) && (v0 - a1[2][13])) + ((v3 / 7) >= (70 ? a0[7] : a0[1])));
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v3 = (((75 ? v0 : a0[4]) ? (a0[5] / 4) : (v0 * 58)) || ((i0 == v3) % 2));
+                v0 = (((99 * v3) < (i1 ? a0[0] : 49)) - ((v3 != 21) ? (68 + a0[14]) : (2 + v2)));
+                a1[3][1] = (((a0[15] / 2) / 4) <= ((v2 >= i1) % 4));
+            }
+            a0[9] = (((i0 <= v1) < (v3 + a0[1])) <= ((56 > v1) || (v1 ? a0[0] : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    if ((((v2 - 30) ? (v2 + v2) : (v0 / 7)) / 5)) {
+        v3 = (((83 || v0) * (v1 || a1[2][12])) / 7);
+        v0 = (((89 ? v2 : v1) / 3) < ((v3 / 1) < (v2 == v2)));
+        v1 = (((v0 && v2) <= (v0 && 90)) > ((5 ? 13 : v2) > (a1[0][15] * v1)));
+    } else {
+        v0 = (((55 > v2) * (59 % 7)) / 7);
+        a1[0][4] = (((63 * v3) % 9) % 8);
+        v2 = (((v0 ? v1 : v1) + (a0[8] || 46)) + ((v0 - v0) == (a1[2][0] == v1)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a0[15] = (((v0 ? 40 : v2) <= (v0 && v1)) ? ((a0[13] ? a0[7] : 50) - (a1[2][2] < v2)) : ((v0 * v2) ? (i2 && 89) : (v2 <= a1[1][3])));
+            a1[3][9] = (((v2 || v1) || (10 / 7)) % 1);
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                if ((v0 > 48) > 62) break;
+                v0 = (((i3 <= 87) && (95 || v1)) || ((a1[1][8] ? a1[1][3] : 87) && (i3 ? 24 : i3)));
+                v3 = (((v2 >= a0[15]) + (a1[0][4] ? a1[3][11] : a0[2])) * ((a0[3] > a0[7]) < (85 >= a1[1][15])));
+                a0[9] = (((v2 ? 30 : 47) || (v3 >= 99)) - ((59 < a0[3]) != (a1[0][4] ? 47 : 83)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 4; i5 = i5 + 1) {
+            v1 = (((i5 % 4) || (a0[13] != i4)) / 9);
+            v1 = (((v0 == 11) - (v0 / 6)) == ((v3 && v1) != (94 ? i4 : a0[5])));
+            v0 = (((28 / 1) >= (v1 - a0[10])) + ((v1 && 41) ? (i5 != i5) : (a0[3] < a1[0][11])));
+        }
+        v2 = (((v3 >= v2) >= (v0 ? 26 : a0[13])) || ((i4 != i4) < (a1[2][12] != i4)));
+        a1[1][15] = (((i4 + v3) != (v1 ? v0 : a0[11])) < ((67 / 5) <= (84 / 8)));
+    }
+    if ((((90 <= 24) ? (v0 ? v1 : v0) : (a0[0] * v2)) ? ((v0 != 35) < (v0 * v3)) : ((60 * v1) + (92 <= v1)))) {
+        v2 = (((79 != v2) || (a1[3][9] ? v1 : 57)) ? ((46 * v0) > (a0[4] ? v2 : v0)) : ((v3 <= a0[10]) % 8));
+        v0 = (((61 != v2) && (v3 - 76)) - ((53 % 8) - (a0[4] != a0[1])));
+        a0[0] = (((v2 - 68) / 4) == ((v3 - 25) <= (a0[1] ? v3 : 79)));
+    } else {
+        a1[0][12] = (((a0[15] - a0[8]) * (42 / 3)) || ((95 ? a1[2][9] : a1[1][2]) != (a0[5] / 6)));
+        v2 = (((5 && a1[3][1]) - (v0 + v2)) / 2);
+        v0 = (((v0 <= 3) < (v0 >= v0)) || ((81 ? v3 : a1[1][12]) - (v3 != a0[2])));
+    }
+    return (((v1 != 14) <= (v3 * 21)) && ((93 / 2) ? (a0[11] > v2) : (93 && v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
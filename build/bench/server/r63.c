@@ -0,0 +1,61 @@
+int f0() {
+    int v0 = 48;
+    int v1 = 38;
+    int v2 = 87;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[15] <= v2) != (v2 ? a0[4] : v0)) + ((a1[0][14] != v1) / 7))) {
+        a0[9] = (((78 >= v1) || (v2 > v2)) > ((v3 + 31) < (a0[2] ? v3 : 99)));
+        v3 = (((a0[7] > v3) - (a0[4] || v2)) - ((1 < 64) <= (v0 ? 23 : 22)));
+        v1 = (((a0[6] ? v1 : v0) + (86 <= 96)) ? ((a0[4] <= a1[0][0]) ? (58 / 9) : (68 - v3)) : ((v3 - 8) ? (v2 == a1[1][14]) : (a0[5] % 7)));
+    } else {
+        v1 = (((v3 <= 8) < (28 > a0[15])) + ((99 + v0) ? (v3 != a1[1][11]) : (46 / 5)));
+        v0 = (((v1 * v1) < (v2 >= 52)) == ((a1[3][11] != 28) >= (v1 - 15)));
+        v3 = (((v0 && v2) ? (v1 <= a0[15]) : (a1[3][2] > 48)) / 2);
+    }
+    if ((((76 < a0[2]) == (v3 ? v0 : a1[0][1])) || ((v1 ? a1[3][13] : 9) >= (a1[2][3] % 9)))) {
+        v2 = (((66 ? 23 : 61) - (v0 + a1[0][1])) && ((88 ? v0 : v3) + (v2 > v0)));
+        v1 = (((v3 % 7) + (81 >= v1)) ? ((v0 - a0[0]) ? (a0[1] && a1[3][6]) : (a0[11] >= v0)) : ((a0[10] <= 35) != (a1[1][12] < a0[13])));
+        v2 = (((7 && v1) < (a1[1][13] + 92)) * ((a1[2][2] / 1) == (v3 == a0[8])));
+    } else {
+        v3 = (((v3 % 7) && (a0[14] || v2)) - ((a1[2][9] && a0[8]) <= (44 ? 98 : v2)));
+        v1 = (((35 - a0[1]) <= (v0 && v2)) - ((a1[2][14] ? v3 : a1[3][5]) || (v1 / 7)));
+        v3 = (((74 > v2) || (v3 && 58)) ? ((v2 != v1) / 2) : ((93 * 42) ? (a1[2][13] >= v1) : (a1[3][3] % 9)));
+    }
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((v2 / 3) > 80) break;
+        v0 = (((a1[3][1] - v3) && (32 != a0[7])) * ((85 * v3) / 8));
+        v3 = (((27 != 30) ? (v1 * i0) : (43 / 2)) != ((6 - 8) - (37 != v3)));
+        for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+            v2 = (((a0[15] * a0[14]) + (v2 + v2)) != ((v3 && v3) <= (52 ? v2 : v3)));
+            v0 = (((v2 || a1[0][8]) ? (a1[0][4] != v3) : (v0 - a1[1][6])) * ((a1[1][6] / 3) < (a0[0] - a0[13])));
+            a0[5] = (((i1 * v3) || (v0 != v2)) ? ((a0[6] <= v2) == (11 == a1[2][7])) : ((i1 >= a0[6]) ? (8 == 46) : (a0[14] && v3)));
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v1 = (((i2 ? i2 : 88) - (a1[0][11] + 10)) != ((v0 ? 99 : a1[0][13]) - (a1[3][7] > 23)));
+            v3 = (((44 <= v2) != (v0 ? a0[6] : v2)) < ((a1[3][15] * 71) % 4));
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[10] >= v0) > 97) break;
+                    v1 = (((i2 % 2) < (v1 == v2)) && ((49 == 57) || (2 != i3)));
+                    a1[2][5] = (((15 ? v0 : 63) > (v2 == v1)) && ((11 ? 44 : v0) > (52 % 1)));
+                    v0 = (((a0[5] == v1) + (i3 >= v0)) >= ((v0 >= 5) ? (a1[1][14] >= v1) : (i3 <= 60)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    a0[2] = (((a1[3][0] * v3) ? (16 <= v3) : (v1 % 5)) || ((v0 && v3) > (a0[3] < a1[2][5])));
+    return (((v0 <= v0) >= (v0 || v2)) ? ((v2 <= a1[0][9]) % 6) : ((18 % 8) ? (a1[0][4] ? v2 : a1[0][6]) : (23 || a0[6])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,157 @@
+int f0() {
+    int v0 = 16;
+    int v1 = 52;
+    int v2 = 55;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[2][13] != v1) * (v3 || v3)) == ((67 ? v2 : v2) <= (a0[12] ? a0[10] : 82)))) {
+        a0[10] = (((v3 <= a0[10]) == (v0 % 8)) / 7);
+        a0[4] = (((a0[2] * 58) < (v0 > a1[3][6])) - ((a0[10] * a0[6]) != (v3 % 8)));
+        a0[12] = (((20 != v2) / 3) || ((v0 ? v1 : a0[0]) - (a1[0][12] >= v0)));
+    } else {
+        v3 = (((v1 && v0) / 6) + ((v3 < a0[14]) && (v0 * a1[2][14])));
+        v2 = (((v3 || v0) && (v2 == a0[14])) + ((a1[1][10] % 5) / 4));
+        a0[4] = (((93 < v3) < (a0[15] ? a0[3] : 72)) * ((29 % 4) * (44 >= v2)));
+    }
+    if ((((v0 > v0) + (v1 ? v2 : a0[9])) < ((v2 % 5) / 4))) {
+        v2 = (((75 ? v3 : 55) > (a1[1][0] ? 85 : 99)) == ((10 && a1[2][15]) > (a0[9] > a1[3][2])));
+        v1 = (((v0 > v3) % 4) ? ((v0 == a0[11]) == (48 >= v1)) : ((45 ? v1 : 63) - (a1[3][12] < 19)));
+        a1[3][7] = (((v1 + v2) < (v2 != a1[3][11])) < ((v1 || 81) - (v1 % 4)));
+    } else {
+        v3 = (((a1[1][4] ? v1 : v3) ? (v2 - a0[14]) : (24 % 3)) >= ((a0[7] / 9) * (a1[2][14] ? a0[10] : v0)));
+        v2 = (((a1[1][8] ? a1[3][1] : 74) && (a0[1] * v1)) + ((23 / 8) != (v1 <= v3)));
+        v2 = (((v0 ? v3 : v0) && (v2 >= v3)) - ((v1 >= v3) || (13 >= a1[1][6])));
+    }
+    if ((((v3 ? v3 : a0[13]) * (v2 + v0)) == ((a0[0] * 55) && (a1[2][0] * v3)))) {
+        v3 = (((v0 ? a0[9] : a0[1]) / 4) >= ((92 % 1) < (94 ? 87 : 20)));
+        v2 = (((a0[3] || v0) <= (v3 % 9)) <= ((v2 / 4) == (a0[13] < 28)));
+        v2 = (((v3 != v1) <= (97 || 30)) * ((20 + a1[3][10]) ? (96 > v3) : (82 + v0)));
+    } else {
+        a0[0] = (((49 % 8) - (a0[7] ? v0 : 53)) && ((92 == v1) / 2));
+        v1 = (((80 || a0[8]) || (v3 && v1)) <= ((a1[0][12] || v2) >= (v3 <= v3)));
+        v0 = (((4 + a1[1][11]) != (v3 ? 79 : v0)) ? ((v0 >= v2) % 5) : ((a1[3][11] * v3) ? (a1[0][7] == 40) : (84 / 4)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            a1[1][5] = (((a0[9] ? 85 : i0) - (v2 ? v2 : v0)) || ((v2 || 16) ? (5 < v1) : (a0[1] != 43)));
+            v1 = (((55 + v2) == (87 == a0[1])) - ((v2 + v1) / 8));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v0 == a1[3][4]) < (a1[0][12] * a0[8])) || ((a1[2][5] ? i1 : 75) || (a1[1][5] ? 99 : 28)));
+                    v0 = (((v2 + 14) * (v0 <= v0)) <= ((a0[7] ? 91 : v0) * (a0[14] <= 56)));
+                    a0[13] = (((a0[1] ? a0[2] : v3) || (v1 < i1)) % 8);
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((53 <= v2) >= (a1[1][6] < v2)) < ((a0[5] <= 1) < (v0 != v3)))) {
+        v3 = (((v0 ? v2 : 2) > (81 <= v2)) ? ((a1[0][4] == 68) / 3) : ((v0 <= v2) <= (a1[2][0] >= a1[1][15])));
+        v2 = (((41 || v0) == (77 * v1)) >= ((v2 + 61) == (v2 % 3)));
+        v0 = (((1 < a0[7]) < (v3 >= a0[3])) >= ((v2 % 4) ? (v1 ? a0[3] : v1) : (52 >= a0[2])));
+    } else {
+        v3 = (((33 || 46) < (a0[5] + v1)) <= ((v2 > 46) - (45 % 7)));
+        a0[7] = (((v0 == v1) && (v1 != a1[2][0])) ? ((v2 - a1[3][2]) - (v1 > a0[1])) : ((38 % 6) ? (v1 / 1) : (v3 || a0[11])));
+        a0[14] = (((a1[1][11] + 40) != (8 || v1)) + ((v3 == 42) >= (17 % 1)));
+    }
+    return (((41 / 8) || (92 && v0)) != ((v2 * a1[1][1]) || (50 % 3)));
+}
+int f1() {
+    int v0 = 14;
+    int v1 = 60;
+    int v2 = 48;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((v0 >= 41) < (v2 && v3)) ? ((v0 && 97) >= (i0 ? v1 : 70)) : ((i0 < a1[0][15]) + (v3 / 6)));
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((v1 * 12) >= (v2 == 1)) == ((v3 && a0[8]) <= (a0[2] ? 98 : i1)));
+                    a0[10] = (((i0 ? a0[8] : 92) * (a0[3] ? a1[2][12] : 50)) >= ((v0 != a0[11]) < (v2 <= a1[0][11])));
+                    a1[2][5] = (((91 > v3) == (i0 % 2)) / 6);
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v1 = (((v0 || a0[6]) % 1) && ((60 % 1) || (87 || a0[9])));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v1 = (((v2 < v3) % 6) % 4);
+    v3 = (((v0 / 1) % 1) * ((31 > v3) % 9));
+    if ((((v2 >= 8) < (v3 == a0[3])) / 8)) {
+        v1 = (((a0[5] <= v0) / 6) >= ((v3 < a1[2][5]) >= (v2 < a1[2][14])));
+        a1[2][6] = (((v2 ? v2 : 48) % 5) != ((v2 ? 17 : v0) > (v1 ? v2 : 54)));
+        a0[2] = (((v2 != v3) / 7) && ((v1 ? v3 : v3) % 6));
+    } else {
+        v2 = (((a0[4] * v2) % 6) ? ((75 % 5) == (v2 || 89)) : ((v2 % 7) + (v3 ? 84 : a0[3])));
+        v0 = (((70 / 5) ? (v3 >= v3) : (38 ? v2 : v2)) + ((v0 + v1) || (79 <= a0[9])));
+        a1[1][2] = (((v3 * v1) < (v3 + v0)) != ((v1 + v3) % 7));
+    }
+    if ((((v3 == 30) == (v2 == v2)) + ((a1[3][14] ? a1[2][11] : v2) ? (45 == 28) : (v1 == a1[2][1])))) {
+        v1 = (((v3 / 8) < (40 >= 38)) / 2);
+        v0 = (((52 < 73) != (v3 + 45)) < ((a1[2][1] || 34) % 1));
+        a1[3][0] = (((v1 * v1) ? (v3 ? 91 : v2) : (a0[5] % 7)) >= ((94 >= v3) / 3));
+    } else {
+        v3 = (((v2 % 4) && (6 / 3)) == ((v1 >= a0[2]) < (65 || v3)));
+        v1 = (((19 ? v3 : a1[3][15]) + (93 ? v3 : a1[2][7])) + ((v2 / 9) - (v2 / 2)));
+        v0 = (((a1[1][12] || 55) / 8) || ((v3 ? a1[0][5] : v1) >= (v3 + a1[3][9])));
+    }
+    return (((75 || 34) + (v2 + v3)) && ((62 / 6) - (a0[1] ? a0[13] : 91)));
+}
+int f2() {
+    int v0 = 4;
+    int v1 = 81;
+    int v2 = 19;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((32 - a0[7]) <= (a0[15] ? v3 : v3)) != ((v2 < 30) % 8));
+    if ((((89 && v3) + (33 == 43)) + ((39 || 61) && (74 != 41)))) {
+        v3 = (((v3 >= 47) <= (v0 != a0[6])) > ((a1[0][6] ? v0 : 77) != (v3 && 69)));
+        v2 = (((v2 ? v0 : a0[11]) % 1) / 3);
+        v3 = (((v1 == 63) * (49 == 43)) == ((v3 && 53) * (v2 >= 25)));
+    } else {
+        v3 = (((a1[0][13] != v0) > (67 < 27)) + ((a1[2][5] <= v1) || (99 != v1)));
+        a1[0][5] = (((v0 && 10) <= (27 - v3)) <= ((7 % 1) <= (v1 == v2)));
+        v3 = (((a0[15] % 1) + (a1[2][12] / 8)) % 1);
+    }
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        a1[0][5] = (((v2 >= a0[8]) / 1) ? ((a1[3][11] % 7) ? (v3 && i0) : (95 * 23)) : ((8 != v3) == (66 ? a1[1][9] : 22)));
+        v3 = (((a0[9] ? v2 : v1) ? (v2 < 70) : (v1 / 4)) && ((v1 % 7) >= (v0 || v3)));
+        for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+            a0[11] = (((a1[3][9] && i0) > (58 ? 72 : v2)) >= ((a0[6] == i0) / 4));
+            v1 = (((91 ? a1[1][4] : v3) < (v3 || 19)) < ((i1 <= v1) < (40 % 5)));
+            a1[0][7] = (((v1 * 50) * (45 * v0)) % 4);
+        }
+    }
+    v0 = (((v0 <= v1) ? (v3 + v1) : (v2 % 1)) < ((v0 || v0) ? (16 == a1[2][2]) : (v0 > 28)));
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        v2 = (((i2 + a0[13]) || (44 == v0)) + ((v1 + 72) > (a0[8] ? a0[13] : 88)));
+        a1[0][1] = (((i2 / 8) < (9 ? v3 : a1[3][2])) + ((a0[13] > v0) % 9));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((a1[3][8] && i3) || (70 / 4)) <= ((a0[4] + v0) % 3));
+                v2 = (((a1[3][13] > v1) <= (a0[2] % 1)) || ((v3 + 23) < (v1 != 88)));
+                a1[3][2] = (((a0[9] - a1[2][4]) % 4) || ((a0[6] - v2) <= (32 - v2)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    return (((v3 < 57) >= (v1 || a0[0])) || ((v0 - v3) / 3));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,49 @@
+int f0() {
+    int v0 = 19;
+    int v1 = 21;
+    int v2 = 34;
+    int v3 = 65;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 * v3) < (v2 % 7)) && ((a1[2][10] == v3) && (v2 == a1[3][2])));
+    a0[11] = (((v0 % 1) % 9) > ((v0 != v3) && (v3 ? a1[1][12] : v3)));
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((a1[1][6] % 1) > 93) break;
+        for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+            if ((v3 ? a0[9] : v2) > 83) break;
+            v2 = (((6 * 30) % 2) && ((i1 - a1[0][8]) < (v3 != a0[0])));
+            v3 = (((i1 != 32) && (v2 * a1[2][13])) == ((v0 * a1[2][1]) < (v2 + i0)));
+            a1[2][0] = (((51 % 9) >= (91 >= a1[3][5])) == ((29 + 63) - (0 && 50)));
+        }
+        v3 = (((v2 ? a0[9] : v2) > (v2 / 7)) > ((39 - a0[1]) >= (v3 > 41)));
+        v3 = (((a1[0][0] == v3) % 5) ? ((a0[13] - a0[8]) > (v2 <= a0[0])) : ((a0[9] ? v0 : a1[2][3]) != (v1 - v0)));
+    }
+    if ((((a0[9] - 66) > (v3 * 58)) != ((a1[2][3] || a1[2][11]) == (v0 / 7)))) {
+        v1 = (((v1 ? v2 : v0) * (v1 % 9)) >= ((v0 / 3) > (85 || v1)));
+        v2 = (((a1[3][11] ? v3 : v2) > (v2 ? v1 : v1)) * ((v3 < v0) < (v1 && 65)));
+        v3 = (((6 != a0[14]) || (a0[10] < 21)) && ((92 * a0[15]) != (a1[0][9] / 8)));
+    } else {
+        a1[1][1] = (((v0 < 44) < (a0[11] || a1[2][13])) % 9);
+        v2 = (((22 > 64) * (v1 > v0)) <= ((93 - v0) > (v2 + a0[8])));
+        a0[4] = (((v2 ? 0 : v2) > (a1[3][4] * v2)) < ((v1 < v1) != (v3 && a0[0])));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v2 = (((v1 < v2) && (v1 + v0)) <= ((11 <= 19) + (a1[3][5] * v0)));
+        {
+            int i3 = 0;
+            do {
+                a0[3] = (((8 && 81) - (v2 == v3)) + ((v0 ? 29 : i2) > (v2 >= v1)));
+                a0[8] = (((a0[15] / 7) ? (a0[11] >= 27) : (a0[5] / 3)) / 3);
+                a1[1][3] = (((4 < v2) <= (91 || a0[5])) * ((v0 % 6) % 8));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+        a0[12] = (((a0[8] ? v1 : a1[2][2]) || (v3 > 59)) * ((32 ? i2 : v3) != (v2 == a1[1][5])));
+    }
+    return (((a1[3][15] < v2) / 6) >= ((v1 >= v2) / 9));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,136 @@
+int f0() {
+    int v0 = 99;
+    int v1 = 26;
+    int v2 = 79;
+    int v3 = 76;
+    int a0[16];
+    int a1[4][16];
+    if ((((59 + a1[1][8]) ? (11 % 1) : (87 >= v2)) + ((7 * 42) == (v0 >= a0[12])))) {
+        a1[3][13] = (((a0[9] <= v2) > (a1[0][11] < v3)) <= ((v3 > a0[14]) > (v2 <= v3)));
+        a1[0][4] = (((a0[14] == a0[11]) ? (43 == v3) : (a1[2][1] <= 22)) / 1);
+        a1[2][7] = (((a1[2][9] ? v1 : a0[13]) == (a0[8] * v2)) / 4);
+    } else {
+        v3 = (((v1 - v2) - (85 ? v3 : v0)) || ((v1 != a1[0][15]) / 6));
+        v0 = (((a1[1][8] && v0) / 4) && ((79 ? v1 : v0) - (a1[0][14] ? v3 : v2)));
+        v3 = (((v2 <= a1[3][13]) == (a1[1][12] ? 6 : v3)) >= ((v3 % 8) || (a0[2] % 2)));
+    }
+    if ((((v2 >= 48) && (v2 == a1[3][11])) / 3)) {
+        v3 = (((v1 ? a0[3] : a0[3]) < (a0[2] != v3)) % 8);
+        v1 = (((v0 / 6) && (v2 == v3)) < ((v2 % 1) > (v0 < v0)));
+        v0 = (((11 >= v2) / 3) ? ((v3 > a1[2][9]) != (v0 ? v2 : v1)) : ((12 * a1[0][10]) == (v1 < 9)));
+    } else {
+        a0[11] = (((v2 != 40) < (v0 < v0)) % 7);
+        v0 = (((v3 % 6) + (a0[15] % 2)) && ((a1[1][9] - a1[3][3]) % 3));
+        a0[9] = (((v1 && v0) >= (a1[3][15] - v2)) / 4);
+    }
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v0 == 12) ? (v3 + v1) : (a1[0][12] + v1)) - ((v1 != a1[0][7]) - (v0 >= i0)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((a1[1][13] < i0) > 63) break;
+                v3 = (((v2 && a0[5]) + (89 + v3)) >= ((v2 % 6) * (72 == v1)));
+                v1 = (((12 ? a0[1] : i0) ? (88 ? i0 : v1) : (v1 > 5)) == ((v3 && v2) - (v0 ? a0[0] : v1)));
+                v0 = (((v1 * v0) / 3) - ((a0[0] + v2) % 9));
+            }
+            v1 = (((13 && 42) || (v0 ? a0[13] : v1)) <= ((v1 >= 49) <= (37 && v2)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v0 + 49) - (v0 ? a1[0][5] : v2)) ? ((93 || 82) < (v1 ? v2 : v0)) : ((a1[0][8] >= 77) ? (v1 ? v0 : 77) : (v1 - 20)));
+            a0[11] = (((v2 <= 64) / 9) ? ((23 % 7) * (v1 && a1[0][12])) : ((v3 < v1) < (v3 % 1)));
+            {
+                int i3 = 0;
+                do {
+                    a0[1] = (((i2 || a1[2][9]) <= (v0 ? 25 : a1[1][14])) || ((93 && 72) != (v3 ? 5 : a1[1][0])));
+                    v0 = (((i2 * a0[8]) + (v3 + v3)) > ((v1 < i2) && (v0 >= v0)));
+                    a1[1][11] = (((79 != i2) ? (a0[7] <= 23) : (a1[3][0] < v3)) || ((v2 != a0[13]) && (v0 / 2)));
+                    i3 = i3 + 1;
+                } while (i3 < 4);
+            }
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    if ((((v2 > v0) == (57 % 2)) * ((v3 > v0) + (v2 - a1[1][1])))) {
+        v1 = (((v2 + a1[3][3]) <= (v1 / 4)) > ((a1[1][7] || 93) && (v2 ? v1 : a0[5])));
+        v1 = (((85 != v3) + (a0[5] != v1)) <= ((v1 * v0) > (v2 > v3)));
+        v0 = (((v3 % 9) + (v0 / 7)) ? ((a1[1][4] != a1[2][15]) / 6) : ((v1 % 5) - (a1[2][10] + 64)));
+    } else {
+        a1[2][0] = (((a1[1][8] <= a1[1][3]) + (a0[3] && 30)) >= ((v0 / 9) <= (a1[0][6] && a0[12])));
+        a1[0][1] = (((v3 * 92) > (v1 + 97)) != ((v0 + v1) && (a0[6] <= v2)));
+        v2 = (((61 + a0[5]) + (v0 * v0)) - ((32 % 1) % 5));
+    }
+    return (((59 * v0) || (a0[10] ? v3 : a0[0])) && ((v2 >= v0) || (v1 > v0)));
+}
+int f1() {
+    int v0 = 67;
+    int v1 = 97;
+    int v2 = 13;
+    int v3 = 88;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    a0[1] = (((v0 - v0) >= (a0[4] != 23)) < ((v1 / 8) - (38 / 6)));
+                    v1 = (((i0 + v2) % 3) ? ((a1[1][10] * a0[6]) && (v3 > v1)) : ((a0[14] / 1) >= (a0[4] > a1[2][10])));
+                    v0 = (((i1 ? v2 : 36) ? (v3 < v1) : (v1 % 6)) ? ((i1 + 93) == (a0[3] - a1[2][10])) : ((v0 == v0) || (v1 ? 24 : v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((a1[1][4] >= 73) % 3) < ((a1[2][3] != v3) <= (v1 ? v2 : i0)));
+            a0[10] = (((a0[6] != 27) <= (a0[8] * a0[0])) >= ((i0 * a1[0][6]) < (96 * 88)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((a1[1][5] == 98) && (a0[2] - v1)) <= ((a0[10] <= a1[1][6]) > (41 - a1[1][9])))) {
+        a0[11] = (((v0 == 99) >= (28 != 65)) ? ((v1 - a1[1][4]) >= (v1 == v0)) : ((v3 < a1[1][0]) < (v3 ? v2 : v2)));
+        a1[0][12] = (((v3 ? v2 : 95) != (36 || a0[5])) * ((11 + v0) + (v2 || a1[1][1])));
+        v3 = (((a0[10] < v1) ? (a1[2][0] % 6) : (v0 == v1)) + ((v1 <= a1[1][8]) % 5));
+    } else {
+        v0 = (((v2 + v1) + (37 <= v1)) < ((a1[0][4] >= 42) != (v1 + 11)));
+        v1 = (((v3 || a1[2][15]) + (v0 == v1)) ? ((a0[1] * 44) > (v3 == a1[2][0])) : ((v3 < v3) + (v0 && a1[3][11])));
+        v1 = (((v3 ? v1 : a0[2]) >= (a1[1][7] * a1[2][9])) && ((v3 || v0) ? (82 + a1[1][11]) : (v0 || a0[7])));
+    }
+    if ((((v3 ? a0[9] : 54) != (v1 - v0)) <= ((v0 || v0) - (5 + v2)))) {
+        v2 = (((v2 <= 57) + (a0[7] || v3)) / 1);
+        v2 = (((v1 - 49) < (v3 ? v1 : 86)) || ((v3 * v3) % 7));
+        v1 = (((v0 + v3) - (v0 <= v0)) < ((v1 || v1) == (96 ? 54 : 78)));
+    } else {
+        v3 = (((a0[13] >= v2) + (v3 == v1)) * ((v1 < v3) != (38 <= v3)));
+        v1 = (((58 + 83) >= (65 * 18)) > ((v1 + 63) < (v3 && v0)));
+        a1[3][10] = (((v3 >= 91) / 4) * ((v0 - v0) != (a1[1][3] + v0)));
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[2] = (((v2 ? 75 : v1) / 8) && ((7 >= a0[8]) + (v1 >= v2)));
+            {
+                int i3 = 0;
+                do {
+                    if ((a0[6] + 37) > 60) break;
+                    v1 = (((37 + v2) ? (77 <= 56) : (v0 * 72)) || ((96 && a0[6]) ? (i3 != 47) : (a1[2][7] == v0)));
+                    v0 = (((v2 < v0) > (a1[3][7] * v1)) ? ((v3 || 50) && (v1 * v3)) : ((i2 % 2) >= (v3 >= 41)));
+                    v1 = (((i3 + a1[0][9]) % 4) < ((i3 >= v1) <= (v1 || i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 8);
+            }
+            v0 = (((a0[4] <= a0[7]) < (a1[0][3] && v3)) || ((a0[11] != v0) ? (i2 ? 62 : v2) : (a1[1][3] ? a1[3][3] : v1)));
+            i2 = i2 + 1;
+        } while (i2 < 6);
+    }
+    v3 = (((v3 < v2) * (a1[0][8] != a0[10])) > ((a1[3][6] < 0) || (v3 == v1)));
+    return (((v3 && v2) ? (v2 || 60) : (v1 % 9)) <= ((61 <= 96) + (v3 > a0[3])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,204 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 35;
+    int v2 = 69;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 % 7) * (v1 ? a0[4] : 76)) || ((v2 >= a1[2][5]) ? (79 ? v3 : v1) : (18 > v0)))) {
+        a0[9] = (((v3 % 6) * (9 - v2)) == ((v2 <= v1) * (74 > 97)));
+        a1[1][5] = (((v3 >= 12) && (a0[9] ? v3 : 5)) - ((v1 * a1[3][4]) && (a0[15] == v3)));
+        v0 = (((0 && 57) < (28 && v2)) <= ((91 % 2) % 8));
+    } else {
+        a1[0][14] = (((a0[11] + 43) ? (v1 % 4) : (v2 * v2)) > ((v2 == a1[1][10]) <= (v1 < v3)));
+        v2 = (((v1 && v1) >= (a1[2][9] / 9)) ? ((60 ? a0[6] : a0[12]) + (v2 + 68)) : ((v1 / 4) ? (75 != a1[0][9]) : (44 < v1)));
+        a1[0][15] = (((a0[5] / 9) - (v1 == a1[0][14])) + ((24 && v2) + (93 - v3)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    if ((v3 + v3) > 87) break;
+                    a1[1][13] = (((27 > 58) != (a1[0][9] > a0[11])) >= ((70 ? i1 : i1) - (67 || v2)));
+                    v1 = (((v1 * v2) == (v3 ? v2 : v0)) >= ((a0[5] < 21) ? (a0[8] || i1) : (i0 % 3)));
+                    a1[0][9] = (((67 || a0[13]) < (a1[0][0] % 8)) % 9);
+                    i1 = i1 + 1;
+                }
+            }
+            v0 = (((i0 > v3) <= (85 >= v1)) != ((v0 * i0) ? (v0 >= v0) : (v2 == 20)));
+            v0 = (((i0 % 2) % 6) - ((a1[0][5] < 77) != (i0 >= 88)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                if ((15 || i3) > 65) break;
+                a0[5] = (((a0[13] >= a0[15]) < (a0[1] ? v1 : v2)) * ((i2 + v1) > (a1[2][6] > v0)));
+                v0 = (((a1[1][7] >= v0) % 3) && ((v1 >= a0[5]) % 8));
+                a0[4] = (((i2 % 1) ? (i2 != i2) : (a1[2][5] % 9)) * ((a0[13] + a0[2]) >= (a0[9] != i2)));
+            }
+            a0[11] = (((v1 > 99) >= (a0[4] == a0[0])) == ((a0[1] || 34) <= (70 * v1)));
+            v3 = (((i2 || a1[1][8]) > (v0 < a1[1][6])) != ((v0 != i2) != (v1 >= v2)));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 4) {
+            if ((a0[12] == v2) > 92) break;
+            a1[2][12] = (((i4 % 7) > (a1[0][1] * a0[2])) ? ((a1[0][10] < v2) || (a1[3][11] != v3)) : ((i4 % 5) * (a0[15] != v0)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    if ((a1[1][9] >= v2) > 93) break;
+                    v0 = (((a1[1][11] ? 99 : v3) && (a0[13] * 21)) + ((v1 / 4) >= (v0 - 85)));
+                    v2 = (((v1 ? i5 : i5) || (a1[3][15] <= v3)) >= ((66 ? v1 : a0[5]) + (v1 * v2)));
+                    a1[2][7] = (((57 < i5) % 5) ? ((v2 % 6) >= (v1 || i4)) : ((v2 != a1[1][14]) ? (v2 && v2) : (88 == 9)));
+                    i5 = i5 + 1;
+                }
+            }
+            v1 = (((46 == 85) % 6) ? ((v3 + 8) % 2) : ((0 / 3) || (a1[2][0] ? 40 : v0)));
+            i4 = i4 + 1;
+        }
+    }
+    a1[2][11] = (((v3 + v3) / 1) % 6);
+    return (((v3 != a0[15]) && (v3 / 1)) < ((76 / 5) ? (v1 != 99) : (v1 != a1[1][6])));
+}
+int f1() {
+    int v0 = 40;
+    int v1 = 19;
+    int v2 = 48;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((92 == 17) > 86) break;
+                    a1[0][6] = (((26 < a0[2]) - (11 != 23)) / 9);
+                    a1[0][1] = (((a1[3][10] >= a0[15]) ? (25 % 6) : (42 / 9)) <= ((i0 && 56) > (79 < v3)));
+                    v3 = (((v0 && v1) < (v2 * 78)) < ((99 < 67) >= (a1[2][8] + v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((89 % 5) ? (v0 == v0) : (a1[3][6] - a0[15])) ? ((82 ? a0[14] : 77) - (24 != a0[8])) : ((34 && v1) * (v2 ? i0 : v2)));
+            v0 = (((77 == 4) / 4) || ((v1 % 3) / 5));
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        if ((12 * v1) > 53) break;
+        {
+            int i3 = 0;
+            do {
+                v2 = (((v0 < v3) * (a1[0][13] >= v2)) ? ((30 / 3) == (v1 || 1)) : ((a0[12] * i2) > (v0 / 4)));
+                v1 = (((a1[0][12] - a0[9]) / 1) <= ((v1 / 3) && (v2 ? a0[1] : 93)));
+                a0[12] = (((v0 / 4) + (v3 > a0[8])) || ((32 ? i2 : i3) ? (i2 && a1[1][1]) : (a1[1][9] && v2)));
+                i3 = i3 + 1;
+            } while (i3 < 3);
+        }
+        v3 = (((76 * a0[2]) * (a0[12] >= 66)) / 9);
+        v1 = (((v3 > v3) && (76 <= v2)) < ((v0 >= 24) >= (a1[0][6] || a1[1][3])));
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((i4 - 59) || (v0 * a1[2][0])) <= ((i4 == v3) < (55 != 43)));
+            {
+                int i5 = 0;
+                do {
+                    if ((67 + v2) > 74) break;
+                    v0 = (((0 + a1[0][2]) <= (31 % 6)) >= ((29 % 2) >= (v0 - a0[8])));
+                    v1 = (((v2 <= a1[1][5]) && (v0 != 65)) ? ((a1[2][12] ? 31 : 32) / 7) : ((v2 < a0[1]) >= (52 || a1[2][5])));
+                    a0[14] = (((i4 ? i5 : v1) || (14 ? 70 : a1[2][13])) - ((a1[2][13] ? a0[11] : v0) >= (a0[3] + i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v3 = (((i4 >= v3) || (a1[2][15] > v2)) / 8);
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v0 = (((v0 + 1) < (85 <= v3)) >= ((v3 == 38) - (a1[2][8] >= 39)));
+    a0[1] = (((a1[2][7] > v0) && (34 ? v2 : 9)) % 8);
+    return (((42 && 74) == (94 == v3)) ? ((v3 == a1[0][6]) * (v0 - v2)) : ((v2 - v1) % 6));
+}
+int f2() {
+    int v0 = 12;
+    int v1 = 65;
+    int v2 = 91;
+    int v3 = 68;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            while (i1 < 3) {
+                v1 = (((v2 == a1[0][9]) + (a0[7] && v2)) || ((v3 && v3) / 2));
+                v2 = (((22 < a1[0][9]) > (10 != i0)) > ((a1[1][5] > 83) || (v0 > i0)));
+                v2 = (((a1[1][3] || a1[3][8]) && (a0[2] && v0)) < ((v1 * a1[3][8]) != (a0[5] < a0[0])));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((79 % 7) || (v0 + 84)) * ((v0 - v0) % 3));
+        a1[3][6] = (((v0 >= v3) == (v2 && v3)) == ((a1[1][1] <= a0[7]) * (v2 < v2)));
+    }
+    if ((((26 + v3) >= (35 < a1[1][2])) < ((30 * v0) ? (a0[15] * v1) : (v3 == v0)))) {
+        v2 = (((v0 <= v3) ? (a0[0] + v3) : (a0[7] ? v3 : 66)) ? ((v2 <= a1[0][7]) + (a0[11] < a1[1][6])) : ((a0[1] && v2) > (54 / 1)));
+        v3 = (((a0[13] - v1) % 2) - ((v1 || v3) >= (v1 % 4)));
+        v1 = (((v2 == v1) && (v1 || 89)) || ((a0[11] % 3) % 1));
+    } else {
+        v1 = (((v2 <= v0) + (a1[3][7] ? 37 : a1[0][9])) == ((v1 + 21) != (55 - v1)));
+        v0 = (((20 ? v2 : v0) >= (v3 * a1[2][3])) - ((v0 ? 7 : v2) >= (v0 <= 68)));
+        v0 = (((v3 < v3) * (v3 - a0[12])) + ((v0 != v0) ? (37 % 4) : (a0[13] == 81)));
+    }
+    if ((((v3 || v3) - (v0 % 1)) - ((a0[7] || v3) * (v3 ? 32 : v2)))) {
+        v3 = (((51 >= v3) % 6) > ((v3 ? v2 : v1) <= (a1[1][13] % 3)));
+        v3 = (((v2 >= a1[2][8]) == (v3 <= a1[1][3])) == ((v3 == 5) != (v1 >= v2)));
+        v0 = (((v3 + a0[4]) <= (69 - a0[10])) == ((a1[1][11] && v1) >= (v1 / 6)));
+    } else {
+        a1[2][12] = (((v0 > a0[2]) || (72 && a1[3][1])) - ((a1[1][6] / 6) || (a1[3][6] < v1)));
+        a1[0][1] = (((57 >= a0[14]) / 3) == ((86 < 83) && (v1 == 54)));
+        v2 = (((v1 <= 38) && (13 < a0[6])) == ((v1 ? v0 : a1[0][0]) % 1));
+    }
+    if ((((v1 - v0) <= (a1[2][11] % 5)) + ((a1[0][1] * 96) ? (v1 / 7) : (v0 / 4)))) {
+        v3 = (((v0 ? a0[9] : a1[3][0]) - (v0 - v1)) == ((a1[2][10] > a0[7]) <= (a0[7] ? 43 : v3)));
+        v0 = (((97 > v1) == (v3 < 69)) ? ((v1 && 70) || (79 % 7)) : ((75 + a0[5]) == (97 ? v0 : a0[2])));
+        v1 = (((v3 <= v3) >= (v0 * 82)) % 2);
+    } else {
+        v1 = (((v3 < 44) % 7) >= ((38 > v0) ? (a0[14] ? a0[8] : a1[0][10]) : (82 ? 27 : v2)));
+        v0 = (((v2 > v0) > (v3 / 5)) ? ((v0 || 18) >= (v2 <= v0)) : ((84 == v2) ? (a0[2] + 69) : (99 && 62)));
+        v3 = (((v3 != a0[11]) || (v2 + 79)) < ((v3 && v0) >= (a0[13] % 6)));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a1[1][8] = (((v0 ? v0 : v2) / 8) <= ((i2 < a1[0][11]) == (i2 > 2)));
+            v0 = (((v0 < 88) - (v3 != v2)) != ((v3 - v2) != (v2 ? i2 : v1)));
+            {
+                int i3 = 0;
+                while (i3 < 3) {
+                    v0 = (((40 * a0[9]) >= (v0 + v0)) ? ((v0 && a0[3]) ? (28 <= 11) : (i3 >= a0[7])) : ((v3 ? v3 : v3) * (53 + v3)));
+                    v3 = (((a0[3] - a0[8]) >= (i2 || v1)) < ((a0[9] > a1[1][4]) < (11 >= v0)));
+                    v2 = (((v1 >= v3) != (19 || i3)) ? ((85 + v1) > (i2 + 24)) : ((95 ? v3 : i3) + (a0[15] - v0)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((v3 && 96) >= (v0 % 6)) + ((a0[7] == 70) <= (v2 >= v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,72 @@
+int f0() {
+    int v0 = 74;
+    int v1 = 18;
+    int v2 = 18;
+    int v3 = 72;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        if ((v0 * i0) > 75) break;
+        for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+            v0 = (((15 != a1[2][8]) * (38 % 7)) || ((a1[2][7] == 5) && (i1 % 4)));
+            v0 = (((a0[7] * i1) != (v3 > a1[3][12])) > ((a1[2][7] ? a0[6] : a1[1][0]) ? (56 * 0) : (a0[15] <= v3)));
+            v2 = (((v0 * 84) ? (i0 + a1[2][3]) : (v1 * a0[9])) / 7);
+        }
+        v2 = (((v2 && v3) || (i0 <= v3)) > ((34 && a1[3][8]) ? (v3 % 9) : (v1 <= v3)));
+        v3 = (((i0 <= v3) - (v2 ? a0[11] : 14)) || ((42 + v3) != (a1[1][6] <= 86)));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v2 = (((v3 * a0[12]) ? (54 + a1[3][14]) : (a0[11] + v2)) ? ((a0[2] >= 19) / 8) : ((62 > v2) ? (i2 ? v3 : i3) : (v3 == v1)));
+            a0[15] = (((v1 ? v2 : 51) <= (v3 && v3)) >= ((i3 || i3) < (v3 < i3)));
+            v2 = (((v1 < v1) * (18 ? 57 : a0[2])) - ((i2 % 3) && (i3 - v3)));
+        }
+        a0[8] = (((a1[2][4] <= a0[14]) == (v1 != i2)) % 9);
+        a0[3] = (((a0[13] ? 73 : v3) != (v1 + 42)) / 7);
+    }
+    if ((((v3 == a1[0][7]) != (v1 <= a0[12])) - ((a1[1][8] ? v3 : v1) * (95 ? a1[0][2] : v2)))) {
+        a0[14] = (((v0 + 42) % 9) != ((v0 < v0) / 5));
+        a0[6] = (((a0[12] || v0) <= (v1 && a0[13])) * ((a0[8] < v0) ? (v3 * a1[1][12]) : (19 != a1[1][10])));
+        v3 = (((v0 / 6) < (a1[3][12] != v0)) ? ((v2 ? a0[6] : a0[2]) < (a0[6] - a0[9])) : ((v0 / 8) != (v1 == a1[3][12])));
+    } else {
+        v1 = (((v2 ? a1[0][13] : v1) > (v0 && v1)) >= ((v2 < a0[14]) < (a0[3] != v3)));
+        v1 = (((a0[3] < v1) / 3) / 1);
+        a0[1] = (((a1[0][5] / 6) || (v3 / 5)) != ((v1 + v2) * (1 == v2)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((i4 == v3) || (v3 == 67)) ? ((v2 > v1) % 8) : ((18 * v2) < (a0[1] != v0)));
+            a1[2][11] = (((a1[1][11] || 73) ? (v1 > i4) : (38 / 3)) == ((62 || 90) >= (a0[10] + i4)));
+            {
+                int i5 = 0;
+                while (i5 < 7) {
+                    v1 = (((54 ? v0 : a1[3][15]) / 7) % 4);
+                    v2 = (((i4 == v0) / 5) - ((a1[2][15] + v2) && (i4 * v0)));
+                    v3 = (((i5 == a0[15]) % 7) % 6);
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        v3 = (((i6 >= v2) == (78 || v3)) <= ((v0 <= a0[4]) >= (v0 + v1)));
+        v1 = (((v1 != a1[3][3]) || (v0 + v0)) || ((a1[0][2] * i6) + (38 / 7)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                v2 = (((i7 ? i7 : a0[8]) ? (99 == v0) : (i7 ? v2 : a0[6])) != ((v2 * a0[12]) / 2));
+                v0 = (((i6 == v3) >= (i6 % 2)) * ((v2 % 4) || (92 + 67)));
+                v2 = (((v3 != v3) / 7) / 4);
+                i7 = i7 + 1;
+            }
+        }
+    }
+    return (((v0 != 31) >= (a1[1][3] + v1)) * ((v2 < v1) || (v1 + a1[3][10])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
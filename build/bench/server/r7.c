@@ -0,0 +1,119 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 48;
+    int v2 = 81;
+    int v3 = 29;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((a1[2][1] != v3) * (i0 == 73)) ? ((a0[9] + 5) != (v2 && v3)) : ((37 + v3) >= (a1[3][13] - v0)));
+            v2 = (((v2 - v0) > (v2 != v3)) && ((v3 % 4) < (v3 > v3)));
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    a1[2][3] = (((v1 >= v0) - (29 % 7)) - ((i0 + a0[8]) - (i0 <= v2)));
+                    v3 = (((80 / 5) > (i1 == 36)) && ((v1 || v0) + (v3 ? a1[2][6] : i0)));
+                    v2 = (((v2 <= a1[3][13]) < (56 + 2)) || ((v2 + v1) ? (82 * a0[2]) : (80 <= a0[13])));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            if ((v0 * a0[3]) > 67) break;
+            v3 = (((3 <= v0) > (v3 - v1)) == ((a0[3] != a0[10]) * (a0[12] == 22)));
+            a0[1] = (((v0 <= v1) != (a0[12] > v1)) <= ((a0[8] && 12) - (12 != v0)));
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                v2 = (((41 < i2) >= (v2 * i3)) / 5);
+                v2 = (((51 + a0[15]) * (v2 ? 81 : a1[3][1])) ? ((v3 || 74) - (a1[2][5] && v1)) : ((46 - a1[0][1]) && (i2 || v3)));
+                v0 = (((86 + a0[8]) > (i2 < a1[0][1])) - ((v3 < i2) <= (a0[2] * a0[3])));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a1[0][13] >= 19) + (a1[3][9] ? v2 : a1[3][5])) / 2)) {
+        a0[2] = (((v1 > v0) ? (a0[13] > 82) : (3 != v1)) < ((25 != v2) ? (a0[6] % 5) : (v2 - a0[6])));
+        a1[1][15] = (((a0[15] != 59) / 1) != ((v2 || a1[2][7]) <= (32 != a1[1][3])));
+        v2 = (((a1[0][7] ? v2 : a1[2][3]) / 3) ? ((v0 != v2) + (v0 < v1)) : ((v0 <= a1[2][2]) + (a0[7] ? a1[0][2] : v1)));
+    } else {
+        a1[2][3] = (((a0[11] * v1) < (8 < v0)) + ((a0[8] && v0) - (76 && v2)));
+        v3 = (((18 - v0) != (v1 > 69)) || ((83 / 2) * (v1 + v1)));
+        v0 = (((a0[6] && v3) || (a1[0][7] - a0[8])) / 8);
+    }
+    if ((((v2 < v2) >= (v2 || v1)) * ((v2 != 78) != (v3 - v3)))) {
+        a1[2][10] = (((51 <= v2) * (43 > v1)) > ((a0[1] + a1[3][5]) && (73 > 97)));
+        v2 = (((30 ? v2 : v3) > (v0 && a1[2][6])) < ((v1 != a0[11]) ? (v2 && v1) : (v1 + 72)));
+        v1 = (((a1[2][10] >= 41) <= (v0 ? 87 : v3)) % 8);
+    } else {
+        a1[0][4] = (((25 == v3) || (v3 < v0)) ? ((84 != a1[2][11]) ? (v3 / 3) : (a1[0][1] % 8)) : ((47 + 70) ? (v2 - v3) : (v1 != 49)));
+        a0[15] = (((a1[0][6] * 27) > (a1[3][6] ? 16 : a0[3])) ? ((v3 + 44) != (v3 <= a1[3][14])) : ((v0 / 5) < (80 ? v1 : 76)));
+        a0[10] = (((v3 ? 30 : a1[3][5]) != (v3 <= a1[1][5])) * ((v1 > v2) ? (v3 ? v3 : v1) : (v0 > v0)));
+    }
+    if ((((81 >= v1) * (a1[3][10] < v1)) + ((31 >= 74) + (49 > v3)))) {
+        v1 = (((v1 || a0[10]) % 4) == ((v1 < a1[2][0]) * (v2 >= a1[3][13])));
+        a1[2][5] = (((v0 <= v2) ? (a0[7] == 39) : (v3 * v2)) - ((98 <= v0) >= (45 == 90)));
+        v0 = (((a1[3][6] - v3) ? (v3 && v0) : (76 / 4)) / 7);
+    } else {
+        v1 = (((v1 * a1[0][7]) && (45 && v0)) < ((85 % 2) && (23 != a1[3][8])));
+        v0 = (((6 <= v1) <= (59 != v2)) < ((v2 / 8) == (a1[1][6] - a1[3][13])));
+        v1 = (((a1[0][13] == v1) != (64 * v2)) >= ((a1[1][12] ? v1 : v3) * (82 == v3)));
+    }
+    return (((v2 && v3) == (v1 > 7)) / 5);
+}
+int f1() {
+    int v0 = 4;
+    int v1 = 88;
+    int v2 = 60;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((a1[1][6] < v1) * (v0 >= 79)) < ((a0[12] && v2) == (v3 % 6)));
+            v1 = (((a1[0][8] >= a1[0][8]) < (46 % 1)) + ((85 < a0[2]) == (i0 >= i0)));
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    a1[2][14] = (((v2 / 8) * (a0[14] ? a1[3][8] : 91)) < ((a0[12] ? 86 : a0[4]) - (84 / 5)));
+                    v0 = (((i1 >= i1) == (v2 >= v0)) - ((v1 - v2) > (98 - v2)));
+                    v3 = (((v0 * 74) * (89 < i0)) + ((v2 + 1) > (v1 != 16)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a1[0][12] = (((v0 ? v3 : v1) == (95 * v0)) ? ((v0 || i2) >= (a1[3][13] <= i2)) : ((89 && v3) <= (v2 - v0)));
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v0 = (((v0 == v2) ? (v3 && i3) : (i2 / 6)) == ((a1[1][1] != v2) && (v3 == v2)));
+            v2 = (((50 <= a0[12]) ? (i3 + a0[9]) : (v1 % 3)) ? ((v2 + v0) != (17 / 2)) : ((i2 / 7) ? (18 / 9) : (v1 / 5)));
+            a0[12] = (((a0[7] ? v3 : a0[13]) <= (18 != a1[3][0])) && ((97 && v2) % 9));
+        }
+        v2 = (((a0[5] || a0[4]) > (v0 + a0[4])) ? ((47 + i2) < (a0[3] < i2)) : ((50 % 6) ? (a1[3][12] && a1[3][15]) : (v2 - v2)));
+    }
+    if ((((v3 >= v0) == (v1 != 19)) || ((22 ? 64 : v1) != (v3 ? 13 : 28)))) {
+        v3 = (((2 < v2) + (a0[10] / 2)) <= ((81 - 72) != (78 <= 94)));
+        v2 = (((a0[6] || v1) % 8) * ((v2 == v0) && (v0 ? 77 : 36)));
+        v0 = (((97 ? v1 : v3) < (a1[0][10] < v1)) ? ((a0[4] / 6) <= (a1[1][0] != v0)) : ((a1[2][8] % 2) && (36 ? v0 : v1)));
+    } else {
+        a0[2] = (((a0[13] / 7) + (v1 * v0)) <= ((33 ? v0 : a1[3][12]) % 4));
+        v0 = (((a0[14] + v0) >= (v0 || a0[12])) >= ((a1[0][6] || 43) ? (v2 || v0) : (8 || 46)));
+        v2 = (((v0 ? a1[1][10] : 41) % 2) != ((v2 * v3) || (47 / 9)));
+    }
+    a0[5] = (((v2 / 7) <= (v2 != 77)) - ((v0 < 16) < (a1[1][10] * v3)));
+    v3 = (((v3 >= 89) % 9) >= ((a1[0][5] + v1) <= (v2 <= 70)));
+    return (((v0 - 53) >= (v0 > 47)) >= ((v1 ? 24 : v2) - (v2 > a0[4])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,135 @@
+int f0() {
+    int v0 = 23;
+    int v1 = 37;
+    int v2 = 71;
+    int v3 = 55;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v2 = (((v2 % 6) < (51 < 20)) * ((v3 ? v2 : 65) >= (v0 == v3)));
+            {
+                int i1 = 0;
+                do {
+                    if ((v2 && v0) > 67) break;
+                    v0 = (((v3 ? v2 : v1) ? (80 / 5) : (v0 + v2)) > ((34 / 2) / 7));
+                    v0 = (((6 == v0) <= (v1 != v3)) ? ((i1 != 12) < (i0 - a0[5])) : ((v0 >= v3) / 7));
+                    a1[0][8] = (((23 <= 95) - (v2 ? a0[15] : i0)) / 2);
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            v3 = (((v0 != v2) == (v1 - 3)) - ((v2 || 8) != (v2 ? 87 : v3)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            if ((v0 || a1[2][2]) > 96) break;
+            v3 = (((a1[3][6] ? v0 : i2) % 9) != ((68 || v2) <= (v0 * v2)));
+            {
+                int i3 = 0;
+                do {
+                    a0[4] = (((v1 % 2) ? (a1[2][7] && v1) : (a1[3][4] > a1[2][15])) || ((v1 * v2) || (i3 > a1[3][15])));
+                    v3 = (((37 ? v3 : v2) != (16 > a1[2][5])) != ((v0 % 2) ? (a1[3][1] % 5) : (i3 * v2)));
+                    v3 = (((v1 != v1) % 9) <= ((i3 ? a0[1] : v3) + (v0 >= v1)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            v3 = (((53 && v2) != (i2 - i2)) >= ((23 >= a1[3][8]) ? (95 || i2) : (a1[1][11] < v3)));
+            i2 = i2 + 1;
+        }
+    }
+    v1 = (((v1 < 39) < (v3 / 7)) + ((49 || 21) > (55 <= a1[0][12])));
+    if ((((v2 <= a0[11]) || (v1 * v2)) != ((a1[1][6] || v1) == (v1 % 2)))) {
+        a0[8] = (((52 / 8) < (v2 <= a1[0][11])) + ((16 && 88) != (v0 ? 67 : 38)));
+        v2 = (((a1[2][14] || 33) - (v0 || v0)) % 4);
+        v0 = (((a0[3] > 11) <= (v2 + a1[2][15])) ? ((a0[6] * a0[14]) < (a1[1][9] - v0)) : ((v3 ? v3 : a0[15]) && (v0 + a0[3])));
+    } else {
+        v1 = (((v3 % 4) / 2) != ((14 || v1) ? (v3 ? v2 : a1[0][8]) : (a1[2][13] ? v3 : a1[1][14])));
+        v3 = (((v0 && a0[5]) ? (a1[1][4] != v3) : (a1[3][6] != v2)) && ((v1 != v1) % 9));
+        v0 = (((v2 / 1) ? (v3 || v0) : (v3 && 94)) == ((v2 && v2) ? (a1[2][2] == 53) : (61 > 7)));
+    }
+    if ((((9 == a1[1][5]) <= (v1 && 70)) * ((v1 <= v2) < (v3 != a0[4])))) {
+        a0[13] = (((a0[2] == a0[11]) ? (v2 == a0[12]) : (v1 && a1[1][12])) > ((a0[1] - v0) % 5));
+        v1 = (((v3 && v3) ? (v1 > v3) : (v1 ? a1[3][15] : a1[2][3])) * ((v1 <= v0) != (v3 <= v3)));
+        v2 = (((v3 <= a1[1][10]) && (v3 != a0[5])) ? ((a0[12] > a1[3][1]) ? (v0 >= v3) : (73 < v1)) : ((v2 >= a0[8]) % 1));
+    } else {
+        v2 = (((a0[0] ? v3 : 44) > (v1 || 95)) < ((v3 || v0) < (v1 == v2)));
+        a1[3][1] = (((v2 ? a0[4] : v3) && (v3 <= 8)) == ((2 >= v0) / 8));
+        a0[13] = (((v2 == v3) != (v2 / 8)) % 7);
+    }
+    return (((a0[7] == 56) > (v0 - v0)) <= ((v1 > a1[1][4]) ? (a0[5] && a0[3]) : (a0[5] <= v3)));
+}
+int f1() {
+    int v0 = 4;
+    int v1 = 26;
+    int v2 = 81;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    if ((((49 > v3) * (50 * 96)) != ((v2 > a0[11]) * (a1[0][10] < a0[1])))) {
+        v1 = (((a0[4] >= a1[2][15]) && (a0[7] * a1[1][1])) - ((v1 > v1) ? (v0 + a0[1]) : (v3 && v0)));
+        v2 = (((a1[0][3] ? v1 : v0) || (v3 ? 41 : v2)) / 6);
+        v1 = (((58 >= v2) * (a0[7] >= v3)) >= ((98 == a1[3][7]) % 3));
+    } else {
+        v3 = (((v0 >= v0) % 9) % 2);
+        v2 = (((16 || 27) > (v2 + 64)) * ((v3 > 25) || (v0 != v2)));
+        v2 = (((a0[8] <= a1[3][9]) % 3) && ((v3 == 61) >= (a0[1] > 93)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            v0 = (((a0[8] ? v3 : 27) < (v1 || a0[12])) % 4);
+            {
+                int i1 = 0;
+                do {
+                    if ((27 != 1) > 58) break;
+                    a1[2][12] = (((68 <= 52) >= (v3 * 95)) * ((a1[1][10] || v3) == (v2 + a0[15])));
+                    a0[15] = (((a0[8] <= a1[3][8]) >= (i1 / 2)) >= ((a1[2][14] <= a1[1][0]) > (v1 ? a0[13] : 43)));
+                    a1[2][2] = (((v2 == v2) % 5) > ((a1[3][9] <= a1[0][2]) && (1 < v3)));
+                    i1 = i1 + 1;
+                } while (i1 < 6);
+            }
+            v3 = (((v1 != a1[2][7]) + (v2 / 4)) < ((47 <= 50) > (v3 > v3)));
+            i0 = i0 + 1;
+        }
+    }
+    v1 = (((79 >= v2) * (v2 + 18)) / 6);
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                a0[12] = (((34 % 9) && (a1[3][5] < v0)) || ((a0[3] - 46) / 2));
+                v1 = (((a0[4] / 9) && (v3 && a0[2])) || ((a1[2][2] > a1[2][2]) + (a0[10] < v0)));
+                a1[1][3] = (((77 == v2) * (50 <= 76)) / 9);
+                i3 = i3 + 1;
+            }
+        }
+        a0[8] = (((a1[2][2] + a0[4]) ? (89 || a0[1]) : (i2 >= v0)) && ((v2 < a1[2][1]) != (43 * 53)));
+        v0 = (((99 <= v2) * (48 - a1[0][10])) == ((a0[6] < 82) >= (i2 ? v2 : i2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 3) {
+            if ((v0 / 1) > 77) break;
+            for (int i5 = 0; i5 < 7; i5 = i5 + 1) {
+                if ((40 && a1[1][4]) > 89) break;
+                a1[1][4] = (((v0 - v1) != (v3 / 6)) > ((a1[2][12] / 9) != (i5 && 31)));
+                a0[10] = (((v1 ? v3 : v3) >= (48 && a0[11])) % 3);
+                v2 = (((v0 == i4) / 3) - ((95 || 81) < (71 != v0)));
+            }
+            v3 = (((29 <= a0[7]) * (v1 * v3)) ? ((a0[10] >= i4) <= (a1[2][7] == v3)) : ((a0[8] >= i4) < (v0 ? v2 : v2)));
+            a1[1][0] = (((v3 <= v3) == (i4 + v1)) > ((86 < 66) ? (i4 <= v3) : (v1 || a1[2][7])));
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[14] < a1[3][6]) && (v3 ? a1[0][9] : v2)) % 1);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
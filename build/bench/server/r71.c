@@ -0,0 +1,162 @@
+int f0() {
+    int v0 = 80;
+    int v1 = 43;
+    int v2 = 30;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a0[12] ? 33 : 28) != (20 >= 57)) || ((v1 > v1) >= (a1[2][7] * 87)));
+                    v2 = (((v3 < v3) >= (i1 ? 30 : a1[2][5])) ? ((i0 || a1[0][3]) + (i0 <= a1[1][15])) : ((v0 || a0[3]) != (a0[1] - 72)));
+                    v3 = (((a0[0] - a1[1][12]) == (a1[2][12] / 3)) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v3 = (((i0 > 5) ? (v3 * v0) : (v3 != a0[12])) % 9);
+            v1 = (((a1[3][7] ? v2 : a1[0][2]) != (a0[8] != 22)) != ((i0 ? a1[2][2] : a1[3][12]) ? (v0 + 19) : (a1[3][2] > v0)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((33 - a0[11]) && (24 + v0)) == ((a0[3] ? a0[9] : v0) + (v1 ? 65 : v3)))) {
+        v2 = (((33 ? 95 : v3) ? (v0 * a1[3][1]) : (v3 <= 6)) >= ((v0 ? v3 : a1[1][10]) ? (v2 <= v2) : (v0 || v3)));
+        v1 = (((v2 <= 21) < (a1[3][0] + v1)) && ((v0 && 73) == (48 >= v0)));
+        v3 = (((a0[10] ? 49 : 74) == (a1[2][9] < v0)) - ((58 != v0) >= (v2 + a1[3][5])));
+    } else {
+        a0[14] = (((87 && v3) ? (v0 % 9) : (a1[3][8] - v1)) ? ((4 > v2) % 5) : ((a1[0][11] + v3) < (v2 && 97)));
+        v2 = (((a0[0] * v1) > (v2 % 8)) < ((v2 && a0[1]) != (91 == v3)));
+        v0 = (((v3 - v1) <= (v1 - v3)) % 5);
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a1[2][12] = (((35 > v0) || (a1[1][14] ? a1[2][3] : v2)) <= ((i3 < v3) > (40 / 8)));
+            v0 = (((v0 ? 90 : i2) - (i2 == 0)) <= ((48 == v3) - (59 ? v1 : 27)));
+            v3 = (((v2 && v3) > (v3 + v1)) * ((v0 / 4) < (a1[0][0] >= 45)));
+        }
+        v1 = (((v2 < a1[0][4]) < (53 >= v0)) > ((10 || v0) != (v0 >= i2)));
+        v2 = (((a0[9] ? v3 : v3) != (a1[3][9] == v3)) - ((v1 % 7) * (90 ? v2 : a1[2][2])));
+    }
+    v1 = (((v1 % 2) < (64 <= a1[0][4])) - ((23 ? v1 : v3) < (v0 && v3)));
+    v0 = (((v1 == v1) * (64 && v3)) <= ((a1[3][6] / 6) >= (v1 || v3)));
+    return (((a0[11] <= a0[2]) * (a0[15] ? a0[14] : 86)) > ((v2 <= v3) >= (v2 / 8)));
+}
+int f1() {
+    int v0 = 99;
+    int v1 = 66;
+    int v2 = 61;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a1[0][15] ? v1 : v2) > 84) break;
+            v0 = (((25 % 4) || (v3 && a1[0][10])) % 1);
+            v1 = (((v2 / 5) ? (v1 > i0) : (v1 <= 20)) / 6);
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((v0 != 84) > 53) break;
+                    v1 = (((a0[13] > i1) >= (a1[2][13] - i0)) ? ((37 != v1) / 4) : ((a0[9] <= i1) == (v2 == a1[2][11])));
+                    v3 = (((33 > 26) != (v2 ? i0 : a1[2][2])) / 3);
+                    v1 = (((v2 || v2) / 8) || ((i0 ? v3 : a0[7]) < (v1 + v3)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+                if ((a1[3][6] < 36) > 59) break;
+                v1 = (((v0 < a1[1][2]) == (39 > 67)) / 3);
+                a1[2][2] = (((79 <= a1[0][7]) && (54 && v2)) > ((a1[3][14] + v2) != (v3 ? i2 : 28)));
+                v1 = (((a1[1][15] != v0) >= (i2 ? a0[8] : 25)) >= ((a0[1] == i3) / 3));
+            }
+            v1 = (((v2 % 9) / 4) >= ((90 && 64) - (a0[15] >= a1[1][9])));
+            a0[15] = (((v2 + a1[3][11]) + (a0[15] > 3)) != ((i2 == v1) * (a1[1][3] != v0)));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((v1 < v0) >= (a1[3][2] / 7)) % 3)) {
+        a0[14] = (((90 * v0) ? (11 * v3) : (97 != a0[7])) < ((v1 == 35) >= (v2 % 1)));
+        v2 = (((a0[3] && 59) < (a1[3][3] ? a1[0][14] : a1[0][5])) * ((49 <= v0) && (v0 != 43)));
+        v0 = (((a1[3][2] % 4) + (v2 > a1[3][1])) * ((a1[2][8] && 4) || (v2 > v1)));
+    } else {
+        a0[15] = (((80 <= v0) > (a0[15] != v0)) < ((v0 + a0[1]) / 1));
+        a0[15] = (((a1[1][15] - v0) && (v2 > 59)) && ((v1 ? v0 : a1[1][3]) ? (v3 == v1) : (62 == v1)));
+        a0[5] = (((87 ? 92 : v0) != (v1 || a0[8])) ? ((a1[0][5] == v1) - (a1[0][14] <= v0)) : ((v0 - 1) != (v3 % 9)));
+    }
+    v3 = (((a0[9] / 3) + (v0 == a0[0])) && ((74 - 13) + (a1[2][11] - v0)));
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v2 >= 97) ? (a0[8] / 2) : (v0 * 78)) - ((i5 ? 52 : v1) < (i4 == 61)));
+                    v0 = (((a0[2] + 57) * (i5 + 85)) || ((v3 / 3) && (42 || v2)));
+                    v0 = (((i5 && v1) + (67 ? i4 : a1[0][10])) ? ((v3 + v1) != (v1 * a0[0])) : ((5 > i4) < (a0[10] % 1)));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a1[1][3] = (((86 > a0[7]) ? (a1[0][9] == v3) : (a0[12] != v2)) ? ((67 > a0[2]) <= (a1[2][5] + a1[0][10])) : ((v1 ? 83 : v2) <= (a0[3] >= v3)));
+            v1 = (((5 > v0) ? (v2 / 2) : (16 >= i4)) - ((50 - a1[0][10]) % 9));
+            i4 = i4 + 1;
+        } while (i4 < 3);
+    }
+    return (((v2 || a1[1][3]) / 7) < ((64 == 34) && (a1[3][7] == v3)));
+}
+int f2() {
+    int v0 = 79;
+    int v1 = 30;
+    int v2 = 66;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    a0[10] = (((31 * 10) < (v0 <= v0)) ? ((v2 ? v1 : v0) - (a1[3][6] * v3)) : ((83 > 52) >= (a1[3][10] || v0)));
+    v0 = (((28 / 2) + (0 && v2)) / 9);
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((i0 != 74) > 57) break;
+        v3 = (((v3 && i0) || (v1 + a1[1][13])) * ((18 != 74) + (v1 || a1[1][9])));
+        for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+            if ((i0 / 4) > 78) break;
+            v0 = (((a0[9] < i1) < (v0 ? a1[0][14] : 5)) < ((v1 < v0) < (i0 != 3)));
+            a1[0][6] = (((v1 % 5) + (37 ? v0 : 10)) % 1);
+            v1 = (((v2 / 6) > (v2 <= 59)) || ((a1[3][9] || i1) >= (65 <= a0[5])));
+        }
+        v1 = (((a0[8] >= i0) > (v3 * v0)) + ((i0 * 25) <= (27 + i0)));
+    }
+    if ((((27 <= v3) - (a1[3][4] % 1)) ? ((v2 > v1) != (v0 > a1[2][9])) : ((33 - 40) > (v1 ? a1[0][9] : v2)))) {
+        v1 = (((v0 < a0[7]) != (v0 % 8)) > ((21 >= v3) - (a0[1] > a0[15])));
+        a0[10] = (((a1[2][1] + a1[1][14]) / 9) / 8);
+        a0[6] = (((v0 && 20) < (a1[3][9] < a0[3])) == ((8 - v0) > (74 && v3)));
+    } else {
+        v1 = (((v2 % 1) >= (v2 != v1)) * ((v2 * v3) ? (v0 / 8) : (v2 > v1)));
+        a1[2][4] = (((v0 >= 30) && (v1 * v3)) || ((a0[6] * v3) + (v2 + v3)));
+        a0[13] = (((40 < v2) % 3) - ((v0 <= v1) > (v0 <= 1)));
+    }
+    if ((((v3 / 2) || (28 != 56)) * ((v0 * v3) % 1))) {
+        v1 = (((a0[11] && 44) * (87 > a0[10])) == ((13 == v0) > (0 > v2)));
+        v1 = (((a1[1][8] == 83) && (a0[3] + v2)) * ((v1 && v3) <= (a1[0][5] >= 76)));
+        v3 = (((a1[3][10] || 12) % 5) / 6);
+    } else {
+        v3 = (((v1 + a0[4]) * (v3 ? v0 : v0)) % 2);
+        v3 = (((a0[6] % 7) < (a0[11] * v3)) * ((27 ? a1[2][14] : v1) + (a1[2][4] != 78)));
+        v1 = (((v2 / 8) != (v0 + a0[8])) < ((v0 * 7) ? (v3 + v0) : (v0 + 96)));
+    }
+    return (((24 > v3) == (a1[3][5] && a0[8])) * ((a0[4] < a1[2][2]) * (a1[2][6] < 93)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
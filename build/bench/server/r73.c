@@ -0,0 +1,132 @@
+int f0() {
+    int v0 = 54;
+    int v1 = 51;
+    int v2 = 81;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 && v1) - (14 != v3)) != ((v3 < v3) || (a0[1] < v0)))) {
+        v3 = (((v3 > v2) == (v1 >= v2)) + ((a0[5] > v3) == (v1 % 4)));
+        v1 = (((a1[1][5] ? v0 : v1) ? (a0[3] && 25) : (a1[1][3] - v0)) + ((v1 + v2) + (a1[3][10] > v3)));
+        a0[8] = (((63 + 92) < (88 ? v3 : a1[3][8])) < ((v1 ? v0 : 68) % 9));
+    } else {
+        v2 = (((26 ? a0[13] : v2) && (v2 * a0[4])) || ((68 >= v2) / 9));
+        v1 = (((47 != v2) || (a1[1][7] >= v3)) ? ((82 + 44) != (32 == a0[14])) : ((v0 + v0) != (88 / 9)));
+        a1[2][15] = (((24 / 9) % 9) == ((v1 <= v3) && (86 != 4)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            v3 = (((v2 && 68) == (v3 ? v1 : a1[3][15])) != ((i0 || i0) ? (32 != i0) : (50 % 5)));
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[14] * v3) > 90) break;
+                    a0[5] = (((59 > a0[12]) % 7) < ((v0 && i1) ? (v3 <= i0) : (v0 % 3)));
+                    a0[7] = (((93 || v2) ? (26 != v2) : (21 == 20)) || ((v0 || a1[0][7]) || (a1[2][15] == 5)));
+                    v3 = (((57 ? i1 : 17) || (i0 ? v0 : i0)) + ((53 || 95) && (v1 - v0)));
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            v1 = (((a0[9] < a1[1][14]) <= (v0 == 80)) <= ((v2 ? i0 : a1[3][13]) ? (v2 / 8) : (v0 >= a0[1])));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((v3 > a0[11]) && (v2 == v0)) % 1);
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    a0[0] = (((v2 != v3) ? (a1[3][4] - i2) : (v3 == 29)) && ((28 <= v0) && (44 <= v1)));
+                    v2 = (((v2 <= i2) != (a1[2][12] % 4)) && ((v1 < a1[3][12]) != (i3 || v3)));
+                    v2 = (((i2 <= v3) <= (a1[3][4] <= 26)) + ((v2 <= 14) / 5));
+                    i3 = i3 + 1;
+                } while (i3 < 7);
+            }
+            v1 = (((44 % 5) || (i2 ? a1[1][2] : a1[0][13])) < ((36 == a1[2][1]) < (v1 != 16)));
+            v3 = (((95 + 62) > (27 > v0)) - ((v2 + 50) == (v2 * v0)));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    if ((((15 ? 34 : a1[2][6]) ? (v1 ? 48 : v3) : (73 * a1[0][4])) + ((a1[0][9] + 11) + (85 && a0[1])))) {
+        a0[14] = (((v2 >= 0) % 7) && ((a0[10] + 90) < (6 * a0[3])));
+        a1[0][2] = (((v0 % 9) == (v3 || v2)) / 3);
+        a1[1][1] = (((v2 > v2) - (v2 + 76)) ? ((14 < a0[12]) != (v2 ? a0[11] : v3)) : ((a1[0][8] ? 63 : v3) == (a0[11] + v0)));
+    } else {
+        v1 = (((a0[7] == 0) ? (96 % 4) : (a1[0][7] - v2)) == ((a1[3][8] * 76) < (a0[4] / 4)));
+        a1[1][3] = (((a1[1][15] + 94) > (a1[2][8] * v1)) || ((v2 * 37) > (v1 ? v2 : 64)));
+        a0[6] = (((v3 < v1) != (v1 ? v0 : 79)) && ((v3 * v2) >= (a0[13] ? v3 : a1[0][14])));
+    }
+    return (((v0 <= v3) + (v0 == 67)) * ((59 - 5) == (54 >= a1[3][10])));
+}
+int f1() {
+    int v0 = 45;
+    int v1 = 77;
+    int v2 = 6;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    a0[1] = (((39 + 56) % 6) % 3);
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        if ((20 && a1[1][14]) > 72) break;
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                a0[5] = (((13 * 8) - (a1[3][3] >= 92)) % 3);
+                v3 = (((i1 <= a0[5]) ? (v1 == 92) : (i1 == 93)) * ((a1[1][10] - a1[0][11]) >= (a1[0][15] < a0[2])));
+                v0 = (((14 < v2) < (60 < a1[1][3])) <= ((7 && a1[1][12]) >= (v3 <= 63)));
+                i1 = i1 + 1;
+            }
+        }
+        v1 = (((a1[1][1] % 1) && (v1 || v3)) + ((72 ? a1[2][11] : 74) % 4));
+        v3 = (((v0 - a0[1]) > (60 < a0[0])) ? ((v2 || a0[7]) || (a0[15] < 76)) : ((80 * i0) || (v0 % 2)));
+    }
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 2) {
+                v3 = (((v2 + v1) > (i3 < 61)) ? ((v2 < v0) && (18 || a0[10])) : ((v1 || a0[2]) * (a1[0][7] > 38)));
+                v0 = (((a0[1] > 4) && (49 && v1)) < ((v2 ? 56 : v3) * (v1 || v0)));
+                a0[4] = (((a0[6] >= v3) % 7) ? ((9 == a1[0][3]) / 5) : ((a0[13] && v2) >= (70 ? v3 : v2)));
+                i3 = i3 + 1;
+            }
+        }
+        a0[4] = (((v2 == a0[7]) != (v0 <= i2)) != ((v2 != i2) / 3));
+        v3 = (((v0 ? 35 : 40) < (v0 ? v3 : a0[3])) ? ((v0 < 99) + (a0[7] || a1[2][12])) : ((v0 / 1) > (v3 != a1[2][0])));
+    }
+    if ((((86 ? a0[4] : v1) + (62 % 9)) <= ((v1 < v1) < (v1 * v2)))) {
+        v1 = (((v2 <= 14) <= (v2 >= v2)) + ((92 % 4) + (a1[2][12] && v3)));
+        v1 = (((v0 < v3) < (4 == v2)) * ((a1[2][14] == v3) - (25 % 4)));
+        v3 = (((v1 % 2) / 6) == ((v0 * a0[13]) ? (69 / 5) : (96 ? a0[6] : v1)));
+    } else {
+        a0[5] = (((v3 < a0[2]) != (6 - v0)) || ((v3 + 41) ? (v1 + a1[1][2]) : (a0[0] == a0[0])));
+        v0 = (((v0 + v0) + (v1 != v2)) ? ((v2 <= v2) != (v0 * v3)) : ((v0 % 9) >= (v0 < v3)));
+        v0 = (((26 ? v0 : v3) % 9) >= ((v1 ? 41 : 62) <= (v0 ? 33 : 25)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            v0 = (((7 && 45) * (v3 * v3)) > ((1 > 67) - (v2 > a0[9])));
+            {
+                int i5 = 0;
+                do {
+                    v1 = (((v0 % 1) <= (a0[11] * 34)) + ((v1 % 9) == (a0[2] <= 25)));
+                    v3 = (((i5 == a0[5]) + (33 - 47)) ? ((i5 % 2) >= (32 * 47)) : ((41 != 96) > (a0[6] / 7)));
+                    a0[7] = (((37 >= v2) ? (i4 + a0[5]) : (v0 && i4)) - ((i4 < i4) != (72 / 1)));
+                    i5 = i5 + 1;
+                } while (i5 < 2);
+            }
+            a0[2] = (((v1 - v0) || (i4 ? a0[15] : i4)) + ((29 == 58) && (a1[2][3] || v2)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v2 >= v1) / 9) < ((v3 <= v3) == (v3 != v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
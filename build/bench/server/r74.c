@@ -0,0 +1,167 @@
+int f0() {
+    int v0 = 40;
+    int v1 = 80;
+    int v2 = 95;
+    int v3 = 13;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a1[2][0] = (((v3 != a0[11]) ? (v0 - i0) : (36 - 66)) ? ((v0 == 4) / 2) : ((v2 / 5) % 9));
+        a1[2][4] = (((i0 != 51) || (v0 == v2)) * ((a1[2][0] || 78) < (v0 - a0[14])));
+        {
+            int i1 = 0;
+            do {
+                v1 = (((26 == 20) >= (59 != v3)) + ((31 - i1) + (68 || a1[1][11])));
+                a1[3][10] = (((85 * 97) != (3 == a0[15])) || ((v3 * 2) >= (v1 || i0)));
+                v0 = (((v1 || v0) - (a1[1][11] + v0)) < ((v1 + a0[9]) ? (a0[8] / 2) : (49 ? 25 : a0[0])));
+                i1 = i1 + 1;
+            } while (i1 < 2);
+        }
+    }
+    a1[3][0] = (((v3 && v2) && (v3 - v1)) - ((v3 && a0[1]) < (86 != 34)));
+    v0 = (((v1 ? v1 : v3) >= (a1[0][3] != v1)) < ((a0[6] <= v3) ? (a0[8] / 6) : (a1[3][2] - a1[2][11])));
+    {
+        int i2 = 0;
+        do {
+            {
+                int i3 = 0;
+                do {
+                    v1 = (((v2 < a1[2][15]) || (i3 <= v1)) != ((83 * 16) % 9));
+                    v3 = (((v0 - v1) - (50 < v0)) ? ((a0[13] && a0[13]) == (i3 || a0[0])) : ((a1[2][5] <= i3) != (87 >= a0[11])));
+                    v2 = (((v3 == 67) - (i3 == v1)) || ((v2 >= a1[1][12]) ? (a1[3][9] >= a1[0][0]) : (i2 == i3)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v3 = (((v1 ? v2 : v1) ? (a1[3][13] || a1[0][14]) : (i2 || 46)) ? ((v0 + v0) > (21 * 20)) : ((i2 + a0[7]) * (21 < v2)));
+            v2 = (((v3 < v2) ? (a1[2][9] || a0[2]) : (82 >= v2)) / 2);
+            i2 = i2 + 1;
+        } while (i2 < 3);
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    a1[0][12] = (((v2 ? 37 : v0) - (i5 ? v3 : 71)) || ((v2 * a0[6]) != (v3 && v2)));
+                    a0[2] = (((a1[3][9] - i5) > (75 / 4)) < ((41 * v1) >= (33 ? i4 : v2)));
+                    v2 = (((15 && i4) % 4) && ((a1[3][13] && a0[15]) - (52 ? a0[5] : a1[0][13])));
+                    i5 = i5 + 1;
+                } while (i5 < 8);
+            }
+            a1[2][0] = (((a1[1][15] >= v1) + (92 < 12)) == ((v1 == 48) + (v2 < i4)));
+            v0 = (((i4 || v0) - (v3 * v2)) && ((56 <= v3) != (v3 - v0)));
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v2 ? a0[3] : 45) < (v3 > 30)) != ((a1[0][15] - 94) && (v1 / 3)));
+}
+int f1() {
+    int v0 = 44;
+    int v1 = 70;
+    int v2 = 80;
+    int v3 = 46;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 3; i0 = i0 + 1) {
+        v3 = (((29 / 8) && (a0[1] == v0)) || ((a1[3][14] ? v1 : a0[6]) % 8));
+        a0[4] = (((v2 % 4) > (95 < v3)) != ((v3 ? 59 : v0) < (v0 >= v1)));
+        {
+            int i1 = 0;
+            do {
+                if ((45 + 35) > 58) break;
+                v1 = (((v0 - v0) == (v2 - v1)) + ((v1 ? i1 : v0) != (60 <= 46)));
+                a1[2][10] = (((a0[6] ? 56 : v2) && (a1[3][6] % 1)) + ((v1 < v0) < (a0[3] ? v1 : a0[14])));
+                v2 = (((46 * 70) + (v2 - a0[3])) != ((i0 > v0) + (a0[13] - i0)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+    }
+    a1[3][10] = (((a0[12] != a1[0][4]) > (37 / 7)) % 2);
+    if ((((39 < a0[14]) ? (a0[13] || v3) : (97 || a0[6])) <= ((v3 + 0) - (a0[8] < 75)))) {
+        a0[7] = (((v2 >= a1[2][9]) <= (v2 / 2)) > ((a0[15] == 35) > (37 + v3)));
+        a1[0][15] = (((a0[4] == v1) < (v1 ? v2 : 24)) % 4);
+        a1[0][15] = (((77 / 5) || (v2 >= v0)) % 8);
+    } else {
+        a1[3][5] = (((v3 || v2) ? (25 && v0) : (80 != v3)) - ((v1 % 2) + (a0[12] <= v1)));
+        v3 = (((a1[0][3] - v1) + (a1[0][9] / 3)) >= ((v3 * v0) < (v1 == 38)));
+        a0[1] = (((43 * 58) + (a0[0] * a1[1][13])) > ((a1[1][13] != 87) / 7));
+    }
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            {
+                int i3 = 0;
+                do {
+                    v3 = (((a0[11] - i2) != (i2 / 9)) > ((v0 <= v1) && (v0 || 36)));
+                    v1 = (((v0 ? v0 : a1[1][2]) - (59 % 2)) > ((74 == v2) > (v3 / 2)));
+                    a1[1][12] = (((v2 / 6) > (i3 == a1[0][14])) - ((a1[0][13] != 46) / 8));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            a0[12] = (((a1[3][6] <= v2) / 5) < ((i2 || v3) % 3));
+            v2 = (((v2 >= a1[0][6]) * (i2 || v1)) < ((v0 > 3) - (v0 ? v2 : a1[0][10])));
+            i2 = i2 + 1;
+        }
+    }
+    a0[3] = (((v1 && v3) != (41 < v1)) + ((a0[11] < v2) ? (99 - 70) : (v0 % 1)));
+    return (((a0[2] < v3) > (v1 - v1)) - ((a0[3] > v2) ? (v1 ? v3 : a0[1]) : (85 ? 72 : a0[7])));
+}
+int f2() {
+    int v0 = 25;
+    int v1 = 51;
+    int v2 = 13;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v3 - a1[3][0]) && (v2 % 2)) / 3);
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            a0[7] = (((18 ? v1 : 13) < (a0[10] ? 52 : 46)) / 4);
+            a1[0][10] = (((93 % 3) / 8) >= ((v3 && v2) * (a1[2][3] > 49)));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    if ((v3 != i0) > 51) break;
+                    v0 = (((v3 && v0) ? (v1 > v2) : (i1 ? a0[5] : a1[3][15])) - ((a1[0][11] ? v0 : 23) && (75 - a1[3][11])));
+                    v1 = (((a0[7] * 47) && (v3 * v3)) * ((a1[1][15] ? v3 : i1) % 6));
+                    v3 = (((30 && v1) / 7) + ((v0 > 63) % 4));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a1[1][4] = (((29 % 2) <= (a0[15] ? a0[7] : v3)) + ((68 ? v1 : v1) <= (a0[0] >= a0[7])));
+    {
+        int i2 = 0;
+        do {
+            a1[2][6] = (((i2 / 4) ? (69 >= 0) : (v3 - i2)) * ((94 - v3) > (a1[3][11] ? i2 : v3)));
+            a1[2][8] = (((a0[8] - v1) > (v0 <= v2)) != ((v0 < a1[3][12]) ? (a0[7] != v1) : (i2 >= 16)));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v3 = (((v2 * i2) / 4) || ((a1[0][10] == v3) - (v3 >= v2)));
+                v3 = (((i2 <= i3) > (63 < v1)) ? ((81 ? v2 : v3) && (28 > a1[1][9])) : ((v0 <= v0) <= (v1 ? v3 : v1)));
+                a1[1][9] = (((v2 < a1[0][4]) ? (50 / 9) : (31 && v0)) <= ((42 ? 33 : 43) > (i3 % 4)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((a1[3][14] * 15) == (v3 == v1)) + ((v0 / 7) ? (v2 * 61) : (81 < 94)))) {
+        v1 = (((77 * a1[2][8]) != (v3 || v0)) || ((a1[0][8] * v0) > (v1 - a0[14])));
+        v3 = (((v0 && v2) % 4) + ((v2 ? a0[13] : 4) * (52 % 5)));
+        v1 = (((33 >= v3) ? (v0 / 4) : (a0[6] && 42)) >= ((a1[2][10] ? v1 : v3) ? (84 / 2) : (v2 - v2)));
+    } else {
+        a1[1][12] = (((v1 - 71) ? (v0 && a0[7]) : (v0 - v3)) == ((a0[3] > 42) % 3));
+        v0 = (((50 - v1) && (v3 || 97)) * ((a0[2] || v1) != (v1 ? 81 : a0[14])));
+        v3 = (((v2 * 53) - (37 % 7)) / 7);
+    }
+    return (((99 - 73) > (91 >= v3)) + ((v1 < a0[8]) / 4));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,84 @@
+int f0() {
+    int v0 = 9;
+    int v1 = 71;
+    int v2 = 35;
+    int v3 = 24;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 <= 39) % 4) > ((a1[3][2] <= v0) ? (v1 - v2) : (13 > v1)))) {
+        v3 = (((v0 ? 60 : 18) <= (v2 && v3)) + ((a1[2][13] < v1) ? (v1 % 9) : (v3 - 8)));
+        a0[4] = (((a1[0][4] == 2) == (61 * v1)) ? ((2 > v1) % 6) : ((v1 - 59) || (v3 / 2)));
+        a1[2][8] = (((87 || 85) * (65 >= 99)) * ((v2 ? a1[2][3] : 33) - (v0 - v2)));
+    } else {
+        a1[3][12] = (((v0 * v3) || (v2 - v2)) && ((a1[3][1] + v1) * (v1 / 9)));
+        a0[9] = (((v1 * a1[3][2]) / 3) < ((v1 - v1) > (92 <= v2)));
+        v0 = (((70 * v1) % 3) && ((v1 % 9) / 7));
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[7] = (((94 > a1[3][8]) - (89 + v1)) * ((a1[0][14] > a0[2]) > (94 != v1)));
+            v0 = (((25 * v2) || (65 - 83)) <= ((v2 && 53) <= (v2 != i0)));
+            {
+                int i1 = 0;
+                do {
+                    if ((96 / 8) > 78) break;
+                    v0 = (((i1 <= a0[5]) > (56 >= a1[3][15])) * ((i1 % 3) - (v0 < v3)));
+                    a0[3] = (((v2 && i0) % 1) >= ((a0[5] >= 68) == (26 < a0[0])));
+                    v1 = (((v2 * 48) >= (24 / 7)) ? ((i0 <= i1) ? (20 - 30) : (v0 > 76)) : ((40 < i1) >= (a1[0][6] - a1[2][11])));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[15] = (((v0 + 58) && (30 < i2)) >= ((i2 - a0[8]) ? (v2 ? 61 : v2) : (17 == a1[0][5])));
+            {
+                int i3 = 0;
+                do {
+                    v2 = (((12 / 6) && (v2 > v2)) > ((50 ? 58 : v2) != (67 ? i3 : 36)));
+                    v3 = (((i2 ? i2 : 56) ? (87 + i3) : (v3 % 4)) > ((v1 / 6) >= (96 / 7)));
+                    a0[9] = (((i2 || 27) < (v1 == 21)) == ((4 <= a1[0][10]) > (31 == 2)));
+                    i3 = i3 + 1;
+                } while (i3 < 6);
+            }
+            a1[3][2] = (((v0 % 3) + (a1[0][8] + v2)) && ((v3 ? v2 : a0[1]) || (a0[3] - a0[6])));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    if ((((v1 < a0[4]) || (v2 > 94)) == ((a0[5] ? v0 : a0[15]) ? (a0[8] <= a0[0]) : (84 <= v2)))) {
+        a0[9] = (((a0[1] || v0) + (a0[8] && a0[5])) >= ((v2 < v1) % 3));
+        v3 = (((94 <= 57) + (a1[0][12] || v1)) / 6);
+        v3 = (((v1 > 95) >= (v1 + 44)) <= ((v2 == v0) || (a1[0][11] >= a1[1][9])));
+    } else {
+        v0 = (((v1 != v2) >= (a1[3][6] ? v2 : a0[0])) == ((a1[3][13] - v2) % 2));
+        a1[2][11] = (((v1 > v1) >= (v2 >= 38)) <= ((v0 % 3) % 9));
+        v1 = (((a1[1][8] - a0[13]) >= (a0[14] - v1)) == ((v3 != a1[1][12]) ? (v2 ? a1[3][10] : v2) : (v1 < 15)));
+    }
+    {
+        int i4 = 0;
+        do {
+            v3 = (((v2 < a0[10]) ? (45 != v3) : (45 == a1[0][14])) == ((v3 % 5) == (i4 - v1)));
+            a0[4] = (((v0 == a1[3][1]) % 1) < ((v0 * a0[10]) * (59 - v3)));
+            {
+                int i5 = 0;
+                do {
+                    a0[4] = (((v2 > v3) != (41 / 4)) < ((i5 % 4) / 7));
+                    v1 = (((61 / 7) ? (v2 == v1) : (v1 ? i4 : a0[9])) <= ((a1[2][6] > a0[5]) - (a1[1][10] || v1)));
+                    v0 = (((19 * v0) <= (v0 || 9)) < ((i5 / 3) ? (a0[11] % 3) : (i4 >= v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 6);
+    }
+    return (((v0 > 18) + (76 - 30)) * ((v0 % 9) % 3));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,117 @@
+int f0() {
+    int v0 = 55;
+    int v1 = 55;
+    int v2 = 8;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((a1[3][9] ? v0 : a0[6]) == (v2 ? a1[3][12] : 16)) ? ((v3 + v2) != (v0 == 28)) : ((v2 ? v0 : a1[1][12]) && (1 + v3)));
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            v0 = (((v1 / 9) == (v2 % 9)) % 2);
+            v0 = (((v0 == v1) + (v1 >= a1[2][11])) == ((i0 / 1) == (v3 ? i0 : a1[2][15])));
+            {
+                int i1 = 0;
+                while (i1 < 4) {
+                    v1 = (((a0[13] && 86) ? (49 * i0) : (i0 <= v1)) ? ((76 - 39) + (87 || v0)) : ((i1 + 88) && (i0 <= v0)));
+                    v2 = (((v0 ? v3 : v1) / 5) == ((v3 != a1[1][12]) * (i0 || 35)));
+                    v2 = (((58 / 7) - (v3 < 50)) - ((a0[5] ? v3 : v0) - (v2 ? i1 : 6)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a1[0][14] = (((a0[2] && a0[12]) / 4) <= ((a0[7] % 3) / 6));
+    {
+        int i2 = 0;
+        while (i2 < 6) {
+            v1 = (((46 <= i2) * (a0[11] == v0)) >= ((a0[9] - v3) ? (v2 - a0[2]) : (98 && a0[3])));
+            v2 = (((a1[1][10] ? 92 : i2) == (a1[0][1] / 6)) < ((v1 == 70) ? (v2 < v3) : (a0[6] < v0)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    v2 = (((73 != 33) || (32 < i3)) - ((v1 * i3) % 1));
+                    a1[0][13] = (((60 ? v0 : i3) * (i3 / 2)) * ((v2 && 97) * (v2 < 50)));
+                    v1 = (((i3 >= v0) <= (v2 - a1[0][0])) > ((a1[1][11] / 3) ? (v1 != v1) : (v1 && 80)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            {
+                int i5 = 0;
+                do {
+                    v3 = (((a0[0] && v3) ? (a1[2][2] * a1[2][8]) : (33 > a1[1][2])) != ((a0[9] - v1) || (a1[3][12] || v3)));
+                    a1[1][7] = (((i5 - i4) < (a0[2] <= 82)) == ((i4 % 1) - (70 + v3)));
+                    v2 = (((i4 > 26) || (61 || v3)) * ((i5 > a1[3][13]) - (i4 * v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 4);
+            }
+            v3 = (((a0[3] ? 85 : v2) != (a1[1][12] >= a1[0][14])) > ((v2 >= v1) >= (59 <= 44)));
+            v1 = (((v3 != a0[9]) || (a0[11] < a0[6])) == ((v2 ? v0 : v1) != (a0[15] >= a1[2][2])));
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((v2 ? v2 : v1) > (v0 - 47)) - ((a0[6] >= a1[3][6]) < (v1 && v2)));
+}
+int f1() {
+    int v0 = 92;
+    int v1 = 52;
+    int v2 = 46;
+    int v3 = 28;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        a1[0][10] = (((a1[0][9] && v3) <= (v2 >= i0)) + ((v1 - a0[15]) ? (54 - 42) : (v2 >= a1[3][14])));
+        {
+            int i1 = 0;
+            while (i1 < 2) {
+                if ((a1[1][7] * v1) > 78) break;
+                a0[3] = (((96 < a1[3][5]) % 8) * ((19 != a1[1][6]) <= (a1[2][2] > i1)));
+                v0 = (((v3 % 8) - (v1 - v2)) ? ((v3 <= 58) >= (i0 % 2)) : ((v1 + v2) == (a1[1][6] == 78)));
+                v3 = (((14 + 22) <= (40 % 6)) >= ((39 - a0[10]) >= (v1 - 59)));
+                i1 = i1 + 1;
+            }
+        }
+        v0 = (((7 % 8) - (v2 / 6)) >= ((a0[4] * 0) % 2));
+    }
+    a1[1][10] = (((v1 ? a1[1][0] : 17) ? (v0 / 9) : (v2 != a0[0])) + ((v0 < v0) * (v2 ? 62 : 39)));
+    a1[0][6] = (((v1 >= 86) <= (39 && v1)) || ((v3 * v1) < (v0 >= 48)));
+    for (int i2 = 0; i2 < 7; i2 = i2 + 1) {
+        v0 = (((68 / 8) >= (v3 * 84)) - ((a0[1] / 8) + (76 && v2)));
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            a0[13] = (((v3 && i3) ? (i2 && 25) : (a1[1][13] <= 79)) % 9);
+            v0 = (((a1[3][3] < a1[3][15]) ? (i3 >= v2) : (i3 <= 61)) < ((v0 ? v2 : v1) / 1));
+            v3 = (((i2 != v3) || (a0[12] == 30)) || ((a0[8] < v0) + (80 || v3)));
+        }
+        a1[3][11] = (((25 >= a1[2][15]) && (i2 && a0[14])) < ((a1[0][14] || v1) > (48 + v2)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            if ((v1 / 9) > 82) break;
+            v1 = (((19 * v1) != (v3 % 3)) < ((a1[1][8] < v1) / 3));
+            v2 = (((a0[8] ? 6 : 91) % 7) >= ((v2 % 1) ? (v2 > v1) : (v2 / 2)));
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                if ((a1[0][11] != a1[2][9]) > 61) break;
+                a1[2][2] = (((v3 && 24) / 4) / 4);
+                v2 = (((a0[3] / 1) + (i4 && v1)) - ((a1[2][0] < v0) - (a1[3][4] ? 98 : a1[3][4])));
+                v0 = (((31 * 9) && (v2 ? v0 : 84)) ? ((a1[3][7] > 82) ? (a0[11] || v1) : (v3 % 6)) : ((v0 != v3) ? (22 + v0) : (i4 / 5)));
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((2 ? a1[1][15] : v1) <= (v1 ? v1 : v1)) != ((v2 > v2) % 7));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,145 @@
+int f0() {
+    int v0 = 73;
+    int v1 = 26;
+    int v2 = 79;
+    int v3 = 4;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                v1 = (((a1[2][3] / 2) ? (v2 > a1[2][2]) : (72 <= v2)) / 6);
+                v0 = (((a0[0] - i0) % 6) % 4);
+                v1 = (((i0 ? v0 : a1[2][6]) || (a0[6] ? a0[13] : a1[2][10])) > ((60 + v2) && (16 % 6)));
+            }
+            v3 = (((v3 - 34) ? (v3 > v1) : (v2 || v0)) + ((v1 <= i0) % 3));
+            v3 = (((v0 % 7) + (v2 * i0)) + ((a1[0][8] == v3) / 7));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    if ((((25 % 9) - (v2 == 21)) != ((a1[1][5] + 79) / 5))) {
+        v2 = (((67 == 24) % 7) > ((a1[0][3] / 2) ? (a1[1][7] && v0) : (a1[2][12] - v2)));
+        a0[7] = (((v0 >= v1) ? (a1[1][1] % 2) : (83 > 23)) >= ((a1[1][6] % 8) != (a1[1][15] * a0[2])));
+        v0 = (((v2 || 14) % 9) && ((v0 / 3) <= (v0 / 3)));
+    } else {
+        a0[2] = (((24 / 9) >= (11 == a1[2][14])) < ((v0 / 4) * (75 * v3)));
+        v2 = (((v3 >= 27) ? (45 > 69) : (v1 == v0)) == ((56 < 62) && (66 > a0[13])));
+        a1[1][11] = (((v0 && 73) || (79 < v3)) + ((v3 || v1) - (27 != a0[4])));
+    }
+    v2 = (((a0[9] / 7) % 4) == ((v1 * v0) < (v2 >= v0)));
+    v2 = (((14 <= v3) <= (64 + a1[0][11])) > ((24 % 2) < (a0[11] + v0)));
+    {
+        int i2 = 0;
+        while (i2 < 7) {
+            v3 = (((v2 / 9) < (v0 >= a1[2][14])) - ((v2 % 4) && (v2 + 38)));
+            v0 = (((a1[3][15] >= v0) > (v0 - v0)) / 4);
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                a0[2] = (((70 ? v2 : a0[12]) <= (a1[2][3] <= a1[0][2])) + ((i2 <= 30) != (i2 * v0)));
+                a0[6] = (((a1[2][11] < v2) == (a1[3][15] % 4)) <= ((i2 - v0) == (a1[2][5] == v1)));
+                v1 = (((25 > 85) != (26 + 9)) < ((v2 > a1[0][12]) * (a1[1][8] <= 86)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((a0[2] * v3) - (a0[1] % 2)) < ((a1[3][10] % 4) != (45 > a1[2][5])));
+}
+int f1() {
+    int v0 = 90;
+    int v1 = 2;
+    int v2 = 30;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[8] ? v2 : a1[1][14]) >= (12 >= 55)) == ((v0 || v1) ? (41 % 3) : (v3 >= 96)))) {
+        v3 = (((95 >= v1) != (35 % 6)) * ((a1[0][2] != v0) ? (v3 + a1[1][7]) : (v0 < v0)));
+        a1[0][3] = (((96 || v1) * (21 >= 60)) && ((v0 ? v1 : v3) >= (v3 - a0[4])));
+        a0[3] = (((v3 == v1) ? (90 / 6) : (a0[15] / 7)) <= ((a0[6] % 2) < (v1 == 91)));
+    } else {
+        a0[15] = (((v1 + a1[2][5]) <= (78 + a0[2])) - ((v3 && a0[2]) ? (v0 - v2) : (28 ? v0 : 21)));
+        a0[12] = (((v0 / 2) || (v0 ? v3 : a0[14])) || ((v3 || 3) ? (v0 != 72) : (46 % 6)));
+        v2 = (((a0[3] % 8) * (a0[13] && v0)) % 1);
+    }
+    for (int i0 = 0; i0 < 4; i0 = i0 + 1) {
+        if ((v0 / 5) > 76) break;
+        v3 = (((v2 / 2) <= (3 == 18)) ? ((v2 / 6) == (38 * 58)) : ((16 + i0) && (98 * v3)));
+        v1 = (((i0 ? 88 : 77) / 1) - ((a1[3][1] != a1[2][10]) + (81 ? v3 : a1[0][10])));
+        {
+            int i1 = 0;
+            do {
+                if ((v0 > 28) > 71) break;
+                v2 = (((a1[3][0] * 51) % 3) ? ((v2 <= i1) < (90 - v3)) : ((v2 || a1[0][11]) == (47 && i0)));
+                a0[1] = (((v1 * v0) > (a0[15] / 9)) > ((45 * v0) ? (i1 % 9) : (19 <= v3)));
+                v2 = (((9 % 2) == (a1[3][8] <= v1)) + ((a1[3][5] % 4) * (v0 / 4)));
+                i1 = i1 + 1;
+            } while (i1 < 3);
+        }
+    }
+    v0 = (((a1[2][15] / 3) > (a0[11] * a0[2])) < ((29 ? a0[1] : v2) || (v0 * 48)));
+    v2 = (((97 && a1[0][13]) % 4) % 9);
+    if ((((a1[1][10] + v3) / 9) - ((a1[1][7] % 9) == (v1 == v2)))) {
+        v1 = (((71 <= 62) < (v3 - v3)) ? ((16 / 6) + (v1 != a0[12])) : ((81 ? v1 : v1) >= (36 < 99)));
+        v1 = (((a1[0][8] > v0) != (a0[3] ? v3 : 27)) <= ((a1[0][5] < a0[3]) / 8));
+        a0[0] = (((v0 % 2) != (v0 / 6)) && ((90 && v2) && (60 + a0[9])));
+    } else {
+        a1[3][1] = (((a1[1][10] != v0) <= (v3 < 35)) >= ((v1 + v1) < (v1 != v2)));
+        a0[12] = (((v1 >= 23) >= (v1 < v2)) - ((31 || v0) && (a0[9] < v0)));
+        v2 = (((82 != 75) ? (a1[3][0] + a1[0][8]) : (v2 / 3)) >= ((19 && 23) && (40 * v1)));
+    }
+    return (((v1 + v3) / 6) * ((10 ? v1 : v2) || (v3 > a1[2][2])));
+}
+int f2() {
+    int v0 = 98;
+    int v1 = 81;
+    int v2 = 15;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    v3 = (((v3 > v0) ? (v3 == a1[2][4]) : (a0[2] / 2)) && ((v0 + v1) - (58 / 9)));
+    {
+        int i0 = 0;
+        do {
+            if ((i0 < 75) > 72) break;
+            a0[6] = (((v2 ? 20 : a1[1][12]) == (8 < v0)) / 7);
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a1[1][11] = (((v1 < 85) || (a1[3][5] / 4)) < ((v2 % 9) > (a0[7] != i1)));
+                v2 = (((a1[1][12] * a1[3][6]) ? (v2 <= 43) : (41 * a1[2][5])) > ((a0[11] ? a0[3] : 55) - (v0 && v1)));
+                v0 = (((v3 || v3) % 5) > ((a0[12] - v3) / 5));
+            }
+            v1 = (((a0[3] >= v2) == (a0[3] <= 67)) * ((v0 + a1[0][6]) ? (v3 % 4) : (i0 == a1[3][12])));
+            i0 = i0 + 1;
+        } while (i0 < 7);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((55 % 4) > 96) break;
+        v0 = (((a1[2][5] ? 68 : a1[2][14]) % 1) || ((a1[0][14] - v0) - (14 && v0)));
+        v2 = (((v0 ? a1[3][13] : i2) - (35 - 69)) - ((a1[1][14] < a1[2][15]) > (37 < 11)));
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                v0 = (((15 == v3) * (50 >= i2)) + ((v0 < a1[0][9]) != (a1[1][15] != a0[12])));
+                v3 = (((a1[3][12] / 6) - (v1 != i2)) % 2);
+                a0[4] = (((a1[1][13] >= a0[1]) || (v0 == v0)) != ((v3 && v2) - (v1 ? a0[8] : 8)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    if ((((v0 != v0) >= (a0[9] && a1[2][4])) < ((64 ? v0 : v2) < (v2 && v3)))) {
+        a0[12] = (((a1[3][4] > v3) / 9) != ((a1[3][9] == v0) * (v1 >= v2)));
+        v3 = (((a1[0][6] * v3) && (36 ? 90 : 17)) != ((86 / 3) ? (v3 > a1[2][6]) : (v2 % 4)));
+        v3 = (((v1 ? v2 : v2) - (v1 < v1)) == ((95 <= v0) % 3));
+    } else {
+        a1[1][11] = (((a1[3][10] && 15) && (v3 ? v2 : v3)) && ((v1 ? a1[0][5] : v1) + (49 ? 51 : v1)));
+        v2 = (((a1[2][8] % 8) ? (v2 <= v1) : (76 % 5)) && ((a0[11] < a1[2][5]) % 1));
+        v0 = (((97 == 19) != (v1 - v1)) / 7);
+    }
+    a1[0][11] = (((a0[8] != v2) / 6) % 3);
+    return (((v3 < 64) > (a1[2][2] || v1)) >= ((a0[9] + v3) * (36 * v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
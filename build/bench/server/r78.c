@@ -0,0 +1,68 @@
+int f0() {
+    int v0 = 39;
+    int v1 = 13;
+    int v2 = 82;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((a1[2][11] * i0) > 81) break;
+        v3 = (((11 % 8) * (55 - a1[2][4])) != ((33 * v3) || (26 > i0)));
+        v0 = (((a1[2][3] || a1[0][11]) ? (53 != v0) : (a0[4] <= v3)) / 1);
+        {
+            int i1 = 0;
+            do {
+                a1[2][0] = (((v1 + v0) != (v2 ? v1 : a1[1][10])) > ((23 <= v1) <= (80 * v0)));
+                v1 = (((v2 <= 53) >= (42 == a0[6])) * ((v2 >= a1[1][2]) && (i1 % 3)));
+                a0[1] = (((v0 && v2) ? (v2 ? a0[15] : a1[2][12]) : (36 > i0)) != ((86 ? a0[15] : a1[1][8]) && (i0 ? a0[3] : 88)));
+                i1 = i1 + 1;
+            } while (i1 < 8);
+        }
+    }
+    v1 = (((v2 % 6) <= (v3 * 55)) != ((v2 >= v1) / 3));
+    {
+        int i2 = 0;
+        while (i2 < 4) {
+            v1 = (((v3 > v1) < (31 + i2)) != ((a0[11] ? 74 : a0[7]) > (v2 ? a1[1][3] : a0[8])));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v0 = (((v0 ? v0 : a0[15]) == (58 >= v0)) ? ((61 > v0) <= (a0[1] - v3)) : ((61 ? a0[14] : v0) / 9));
+                v1 = (((i3 > 47) || (50 * v1)) + ((v1 && 84) ? (83 >= a0[1]) : (a0[3] % 8)));
+                v2 = (((95 + v2) ? (v3 != a0[12]) : (7 - 95)) - ((57 <= v3) < (a0[5] % 9)));
+            }
+            v0 = (((v0 * v3) * (26 * v3)) + ((76 + v0) && (i2 || a1[0][5])));
+            i2 = i2 + 1;
+        }
+    }
+    if ((((a0[7] + a0[5]) >= (a1[0][12] >= v2)) >= ((a0[14] > v3) + (a1[1][12] == v1)))) {
+        a1[3][11] = (((v1 != v3) ? (99 + 24) : (a1[1][10] / 7)) < ((73 != v2) && (51 > v1)));
+        v2 = (((v3 + a1[0][7]) % 6) % 1);
+        a0[12] = (((v0 >= v3) <= (v0 * v1)) ? ((53 > 65) != (a1[3][10] >= a0[10])) : ((v3 || 23) ? (a1[2][5] <= v0) : (a1[0][0] <= a0[7])));
+    } else {
+        v3 = (((v3 != v2) ? (v1 >= v3) : (a0[15] % 4)) > ((a1[3][0] % 5) * (v0 || v2)));
+        a0[1] = (((v2 ? v3 : v0) ? (v1 ? v1 : v1) : (v2 <= v3)) ? ((a0[10] ? v2 : 66) % 1) : ((a1[3][7] >= v1) > (87 ? v0 : v0)));
+        v2 = (((v1 == v3) || (a0[8] < v0)) != ((v3 == v1) || (v2 + v0)));
+    }
+    {
+        int i4 = 0;
+        while (i4 < 7) {
+            v2 = (((i4 && a1[0][11]) && (a0[14] / 2)) * ((a1[2][1] >= v0) == (v3 < v0)));
+            a1[3][1] = (((v3 + 85) && (i4 < 56)) / 9);
+            {
+                int i5 = 0;
+                do {
+                    v0 = (((51 / 4) != (i5 % 9)) > ((19 % 9) ? (11 != a1[2][9]) : (69 + v2)));
+                    v0 = (((v0 / 7) ? (61 - a0[15]) : (v3 - 5)) - ((a0[15] > a1[0][2]) + (a0[10] == 19)));
+                    v3 = (((a0[4] ? i4 : a0[5]) != (v1 < a1[1][7])) <= ((23 ? v2 : v1) * (a0[6] || 94)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            i4 = i4 + 1;
+        }
+    }
+    return (((a0[6] < 86) % 7) > ((a0[1] % 7) < (56 > v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
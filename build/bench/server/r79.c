@@ -0,0 +1,109 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 8;
+    int v2 = 62;
+    int v3 = 19;
+    int a0[16];
+    int a1[4][16];
+    if ((((v3 == v1) < (76 / 3)) < ((59 && a0[12]) || (v1 || v3)))) {
+        a0[3] = (((98 ? v3 : v3) != (v3 < v0)) ? ((55 != v2) ? (93 != v0) : (a0[13] && v3)) : ((a0[6] >= 53) ? (27 && v2) : (v2 < v2)));
+        v1 = (((73 ? 12 : 30) != (v0 % 6)) >= ((v3 ? 95 : a1[1][2]) <= (v1 + v3)));
+        v3 = (((v3 ? v2 : a1[0][0]) > (82 != a1[0][8])) * ((v1 + 95) + (v0 < v1)));
+    } else {
+        a1[3][6] = (((v0 != a0[7]) && (v0 % 4)) < ((v3 >= v2) > (v3 % 3)));
+        a1[2][12] = (((a1[2][3] + v3) / 4) != ((a1[2][9] - 33) + (54 > v2)));
+        a1[1][2] = (((56 + v2) && (a1[0][2] && v2)) ? ((v0 + 43) || (33 < 26)) : ((85 < v0) - (v1 < v2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((a1[2][13] > v1) / 2) / 5);
+                    v0 = (((i0 / 3) ? (a1[2][6] || v1) : (i0 > 44)) == ((74 ? a0[3] : v1) != (i1 ? 81 : 57)));
+                    a0[8] = (((v3 && i0) == (v3 ? a1[0][15] : a0[6])) / 2);
+                    i1 = i1 + 1;
+                }
+            }
+            a1[0][7] = (((i0 ? v1 : v1) == (59 || a0[2])) != ((8 / 4) ? (v3 <= i0) : (a0[2] * 33)));
+            v3 = (((v3 - 9) * (95 > a1[1][12])) || ((a1[1][11] * a0[9]) + (v3 == v1)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v0 * 35) > 85) break;
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            if ((v1 == a1[3][12]) > 83) break;
+            a0[13] = (((v3 + 16) + (a0[5] != 69)) > ((i2 && i3) != (v3 + 0)));
+            a0[7] = (((v3 < v1) && (v1 && v1)) + ((i3 - i2) < (81 && v3)));
+            v3 = (((v1 && i2) && (i2 + a0[12])) || ((89 < v1) ? (v3 < v1) : (99 % 6)));
+        }
+        a0[3] = (((v3 <= a1[3][3]) * (v0 > v2)) * ((v2 - 74) - (v1 != v3)));
+        v3 = (((31 && v2) % 9) + ((a0[11] || v3) || (v3 % 4)));
+    }
+    a0[2] = (((v0 % 1) ? (a0[6] ? v1 : v2) : (v2 / 8)) && ((63 / 5) == (83 * 41)));
+    a0[14] = (((a1[0][11] < v0) / 4) == ((v0 % 4) <= (27 >= 44)));
+    return (((2 > a1[2][3]) + (v3 - a1[1][13])) <= ((a1[0][11] % 8) <= (a0[1] && 6)));
+}
+int f1() {
+    int v0 = 70;
+    int v1 = 78;
+    int v2 = 49;
+    int v3 = 77;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 >= v3) / 6) * ((v3 + a0[13]) >= (v0 * v2)))) {
+        v2 = (((v3 == v0) < (51 - v1)) - ((a0[14] ? a1[3][9] : 51) + (51 > v2)));
+        v1 = (((v3 % 9) * (v1 == v2)) / 1);
+        a0[10] = (((v2 < 19) != (v1 - v1)) && ((v3 || a0[10]) ? (v1 / 2) : (31 < v1)));
+    } else {
+        a1[3][15] = (((93 || 80) + (a0[2] % 4)) != ((v1 + 56) % 3));
+        v3 = (((a0[11] ? 44 : v3) * (v2 % 5)) == ((93 >= v3) ? (v2 != v3) : (v2 || v2)));
+        a1[0][14] = (((81 / 7) == (v1 / 7)) > ((v0 * a1[3][14]) / 8));
+    }
+    a0[15] = (((v0 % 3) - (a1[3][3] || v0)) != ((v3 ? 15 : 34) == (a0[5] || v1)));
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            v1 = (((i0 - v1) < (69 <= v3)) == ((a1[3][14] || i0) == (19 || 20)));
+            a0[14] = (((52 % 8) >= (a0[12] - i0)) && ((v0 >= 55) >= (22 * a1[0][14])));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((a0[2] / 8) && (i0 / 1)) >= ((i0 - 97) && (a0[12] ? 78 : v0)));
+                    a0[14] = (((v0 < 51) && (i1 * a0[12])) == ((a1[1][9] > v0) - (a0[15] % 6)));
+                    a0[7] = (((v2 - v0) != (27 < i0)) % 2);
+                    i1 = i1 + 1;
+                } while (i1 < 2);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        if ((1 + 86) > 63) break;
+        v2 = (((42 + i2) ? (v2 - 87) : (a1[1][13] > 18)) && ((19 / 6) ? (v2 ? v3 : 87) : (v3 < 21)));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            a0[0] = (((v1 * v2) + (24 - v2)) ? ((v0 > a0[0]) ? (v2 <= i3) : (a0[12] == a1[1][12])) : ((v1 + i3) && (v0 + a0[7])));
+            v0 = (((53 ? a0[14] : 51) ? (a1[1][3] * v2) : (32 % 8)) * ((v3 ? v0 : i2) - (v2 - 23)));
+            v1 = (((37 && i3) != (a0[15] > 21)) != ((v3 && a1[0][4]) <= (v1 < i3)));
+        }
+        v3 = (((v3 < a1[1][0]) >= (v3 % 4)) + ((v0 > v2) >= (69 != a0[2])));
+    }
+    if ((((a0[9] != v1) == (v0 ? v0 : v3)) > ((v1 >= v3) * (v3 || v2)))) {
+        v0 = (((79 ? 67 : 22) >= (a0[6] || a1[1][6])) < ((v3 && v3) == (v1 >= a1[1][2])));
+        a0[4] = (((78 && v3) && (a1[2][3] != 55)) * ((a1[2][4] == 72) ? (v2 < 35) : (v1 * 28)));
+        a0[10] = (((v0 / 3) >= (v3 > a0[12])) > ((v1 - v3) ? (v1 <= a1[3][8]) : (65 < 98)));
+    } else {
+        v3 = (((4 ? a1[2][12] : v3) ? (v0 <= a0[4]) : (19 + a1[3][7])) == ((14 && v3) != (a0[3] % 8)));
+        a0[6] = (((85 || v2) ? (86 != 58) : (85 / 2)) < ((a1[2][11] ? 14 : 39) && (26 * v2)));
+        v3 = (((a0[0] < a1[0][7]) ? (v3 && v0) : (v0 != v3)) == ((a0[10] >= a0[0]) - (v2 < v1)));
+    }
+    return (((54 && a0[12]) - (75 % 8)) - ((v3 == 70) / 7));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
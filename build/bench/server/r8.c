@@ -0,0 +1,149 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 88;
+    int v2 = 74;
+    int v3 = 97;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 * a0[8]) > (21 >= v1)) ? ((28 ? a0[10] : v0) > (v0 + 87)) : ((a1[2][4] * 26) > (6 ? 28 : a1[1][13])))) {
+        a1[1][7] = (((v3 == v0) >= (v0 == 34)) < ((v1 % 2) ? (32 - 20) : (v1 < 71)));
+        v1 = (((a0[2] ? v2 : 86) - (v1 > v1)) / 6);
+        v1 = (((v0 != v0) ? (v3 % 2) : (v0 != v3)) / 1);
+    } else {
+        a0[3] = (((a0[0] >= a1[3][13]) * (86 * v2)) == ((65 == a0[5]) / 2));
+        v2 = (((a0[1] > 38) < (v2 % 8)) % 4);
+        v2 = (((47 ? 22 : v1) == (v0 != v0)) && ((a1[3][5] && a0[2]) > (a0[10] + a1[3][4])));
+    }
+    a1[1][3] = (((v2 == v3) < (v1 && a0[12])) * ((v3 % 6) > (v3 > 41)));
+    if ((((1 || v2) <= (a0[12] > a0[8])) && ((v1 ? 74 : a0[7]) * (v3 && 78)))) {
+        v1 = (((a0[0] - v0) <= (v3 == 9)) < ((58 ? v2 : v3) ? (83 / 6) : (v0 >= v1)));
+        v3 = (((a0[6] % 4) + (a0[6] % 5)) - ((a0[8] != v0) * (v2 % 6)));
+        v2 = (((12 > v2) % 5) ? ((v2 > v0) ? (v0 <= a1[1][0]) : (v3 == v3)) : ((v2 < 1) && (65 - a1[2][4])));
+    } else {
+        v3 = (((v3 && 29) ? (a0[6] + a0[11]) : (v0 ? 54 : a0[2])) ? ((v3 ? a0[11] : v1) ? (v2 - v0) : (81 % 3)) : ((v2 >= v3) * (v3 - 84)));
+        v1 = (((v1 <= v2) && (a1[1][12] == v2)) - ((96 >= v2) + (v2 >= 52)));
+        v3 = (((a0[5] == 36) / 8) * ((43 >= 68) >= (65 / 6)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((v0 || a1[3][9]) > 65) break;
+            v1 = (((v3 - v2) || (a0[5] * v2)) ? ((a1[3][9] == a1[1][5]) % 2) : ((39 % 2) / 8));
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                a0[15] = (((40 && a1[2][7]) || (i0 + 1)) >= ((i0 + i1) >= (i1 ? a0[11] : 75)));
+                a1[1][12] = (((v2 * v3) || (55 && v0)) * ((i1 * 49) - (a1[0][3] < v1)));
+                v3 = (((5 < v1) == (v0 || i1)) + ((i1 >= 19) < (85 && v2)));
+            }
+            v2 = (((v0 - 24) % 1) - ((i0 + v2) < (a1[2][15] >= i0)));
+            i0 = i0 + 1;
+        }
+    }
+    a0[11] = (((v0 || v0) || (15 - v1)) * ((v1 == v3) && (a1[2][0] >= 31)));
+    return (((31 * v0) <= (28 || 20)) ? ((77 < v1) ? (v1 * 73) : (v2 - a1[2][1])) : ((v3 + v2) * (a0[2] * a0[14])));
+}
+int f1() {
+    int v0 = 95;
+    int v1 = 59;
+    int v2 = 92;
+    int v3 = 74;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((v2 + a0[10]) % 1) == ((v2 * a1[3][3]) || (v3 * v0)));
+    {
+        int i0 = 0;
+        do {
+            v3 = (((41 >= v2) > (i0 - v1)) < ((64 / 5) <= (52 + v1)));
+            v3 = (((70 ? 51 : a1[0][13]) * (a0[15] - 2)) < ((v3 || i0) && (i0 > a0[4])));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((v0 == 51) > 62) break;
+                a1[0][1] = (((v2 - 2) ? (v1 < v1) : (i1 && v2)) >= ((v1 * v2) >= (45 / 4)));
+                v2 = (((v2 <= i0) ? (a0[1] <= v1) : (v3 == a0[7])) ? ((66 || 16) / 5) : ((v2 != i1) || (64 <= v3)));
+                a0[5] = (((67 || a0[13]) <= (v1 % 9)) ? ((i1 != i1) || (i0 <= v0)) : ((v1 >= v3) == (8 < a1[1][5])));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    for (int i2 = 0; i2 < 3; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                a1[2][15] = (((v0 != 14) % 4) && ((a1[2][11] + 26) % 4));
+                v3 = (((v1 / 1) <= (v1 ? i2 : v0)) < ((v2 % 4) * (i2 % 1)));
+                v1 = (((a1[3][15] + a1[2][1]) || (v1 && a1[1][6])) != ((v2 == v2) != (i3 <= i2)));
+                i3 = i3 + 1;
+            }
+        }
+        v2 = (((v1 ? 75 : v3) ? (i2 / 6) : (v1 == v2)) ? ((a1[1][6] * a0[3]) <= (a0[13] || v0)) : ((a0[9] % 8) > (v2 < 42)));
+        v3 = (((76 && a0[7]) != (74 - a0[2])) ? ((a0[13] < v0) == (v2 - a1[2][9])) : ((v1 ? v3 : 62) || (50 + v1)));
+    }
+    v3 = (((v0 && a1[0][11]) - (v3 - v3)) != ((a1[1][12] + 7) != (a0[13] != v2)));
+    for (int i4 = 0; i4 < 8; i4 = i4 + 1) {
+        if ((a1[1][14] == v0) > 64) break;
+        v0 = (((7 && 28) ? (95 - v1) : (87 * a1[2][10])) && ((v1 != 25) ? (i4 && v0) : (65 < 11)));
+        {
+            int i5 = 0;
+            while (i5 < 4) {
+                if ((a1[3][5] > 89) > 96) break;
+                v0 = (((87 ? v2 : v3) >= (i5 ? v2 : v2)) - ((i4 && a0[8]) != (i5 == v0)));
+                a0[7] = (((v3 == 77) - (53 * 74)) / 3);
+                v1 = (((v1 / 4) != (v0 / 6)) * ((v0 >= 87) >= (4 % 9)));
+                i5 = i5 + 1;
+            }
+        }
+        a0[1] = (((a0[1] || 84) % 2) ? ((48 ? 98 : 64) - (v3 <= v1)) : ((i4 >= 21) ? (v3 && v0) : (i4 - v1)));
+    }
+    return (((a0[1] + a1[3][12]) / 5) ? ((25 != v1) >= (a0[12] + v3)) : ((v2 < 96) / 8));
+}
+int f2() {
+    int v0 = 59;
+    int v1 = 32;
+    int v2 = 87;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[1][1] ? v3 : v1) && (v3 && v0)) + ((a0[15] ? v0 : a1[0][12]) > (a0[12] / 5)));
+    v3 = (((v1 ? 16 : v3) / 7) != ((a1[2][3] % 9) % 5));
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v1 % 4) >= (i0 || 33)) > ((a0[4] / 4) == (a1[3][3] - v1)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((i1 + a1[0][2]) * (i0 ? a1[2][14] : 83)) || ((v1 ? v0 : v3) == (v3 / 9)));
+                    v2 = (((v2 != 40) != (a1[2][15] * i0)) % 1);
+                    v0 = (((37 > v3) ? (v3 ? i0 : 16) : (v3 % 6)) && ((i1 ? 39 : i1) ? (v2 > a0[15]) : (a0[2] == 69)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            v0 = (((i0 || i0) ? (a1[3][2] - 67) : (v3 ? v2 : a0[12])) - ((v2 == 90) <= (v3 && 17)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+            v1 = (((62 != a1[3][14]) ? (86 >= v0) : (v2 - v0)) ? ((22 + 48) >= (62 / 4)) : ((20 - 60) ? (v0 >= a0[15]) : (i2 == v0)));
+            a0[11] = (((v1 - v1) == (42 * i2)) >= ((14 > v3) ? (v3 != i3) : (a0[15] * a1[0][4])));
+            a0[7] = (((i2 || a1[1][7]) - (39 % 9)) * ((43 && v2) == (74 && a1[2][6])));
+        }
+        v0 = (((a1[2][0] ? v2 : a1[1][8]) ? (a0[0] + v3) : (i2 * v1)) > ((a1[0][0] >= v0) % 8));
+        v1 = (((68 && v3) ? (i2 + 62) : (a1[2][0] <= a1[2][6])) != ((a0[3] == v1) + (v1 % 7)));
+    }
+    if ((((v3 - v1) != (14 - v1)) > ((v1 < v3) && (29 ? v2 : v2)))) {
+        v1 = (((a0[4] && v0) >= (v3 + v0)) / 3);
+        a1[2][8] = (((a0[10] == a0[5]) || (v2 < v3)) >= ((v2 * v2) >= (4 ? a1[0][8] : a0[3])));
+        v3 = (((52 == v2) ? (v0 != v3) : (a1[0][13] < v2)) <= ((a0[9] <= v2) <= (a1[1][8] + a1[2][0])));
+    } else {
+        v1 = (((v0 <= a0[1]) / 9) ? ((20 ? v2 : v0) != (a1[1][10] - a1[1][8])) : ((a1[0][12] - 57) % 1));
+        v0 = (((67 % 9) + (a0[0] > v3)) * ((v0 / 2) ? (a1[2][1] >= v3) : (27 != v0)));
+        a0[4] = (((v0 - v1) > (a0[14] ? a0[0] : 53)) ? ((v0 / 2) < (a0[2] >= 21)) : ((v2 > 53) - (v1 + 93)));
+    }
+    return (((57 / 8) + (v2 <= v0)) + ((v1 != a1[3][4]) - (v3 < a0[8])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,166 @@
+int f0() {
+    int v0 = 75;
+    int v1 = 13;
+    int v2 = 76;
+    int v3 = 38;
+    int a0[16];
+    int a1[4][16];
+    a1[3][11] = (((a0[1] < a0[3]) < (v0 - a0[5])) - ((v1 > a0[2]) >= (v1 < 63)));
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((i0 * v0) > 52) break;
+        {
+            int i1 = 0;
+            do {
+                a0[0] = (((v1 / 5) <= (i1 ? 73 : v2)) - ((a1[2][9] < 64) <= (i1 && a1[2][15])));
+                v2 = (((v0 <= 58) <= (a1[3][15] || v1)) || ((22 >= a0[1]) ? (a1[1][15] != a1[0][0]) : (v3 < v1)));
+                v3 = (((0 != v3) ? (a1[3][12] > v1) : (i0 >= i1)) ? ((v1 >= a1[2][0]) ? (95 % 2) : (87 ? 84 : 21)) : ((v0 >= 89) && (42 || a1[2][2])));
+                i1 = i1 + 1;
+            } while (i1 < 7);
+        }
+        v2 = (((v1 > 16) && (55 || 63)) ? ((v2 >= v2) == (86 || 86)) : ((i0 % 3) || (26 ? a0[6] : a1[1][9])));
+        v0 = (((v1 || v0) * (v2 < 10)) <= ((a1[3][13] / 9) / 9));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        if ((a1[1][3] * 65) > 61) break;
+        v2 = (((98 == 12) >= (v3 <= a1[0][4])) == ((87 ? v0 : a1[1][4]) + (v0 / 7)));
+        v3 = (((v0 + a1[2][11]) ? (a1[0][3] && i2) : (v2 > 73)) && ((v2 ? 14 : v0) / 7));
+        {
+            int i3 = 0;
+            do {
+                v0 = (((v2 || v1) + (i3 < a0[13])) + ((v1 ? 9 : a0[11]) == (a1[3][4] / 4)));
+                v2 = (((v0 ? v2 : a0[0]) <= (v3 || v1)) * ((v3 - 4) + (i3 ? a1[1][2] : a0[14])));
+                v2 = (((v0 < 53) && (65 % 9)) == ((3 || i2) == (4 < 33)));
+                i3 = i3 + 1;
+            } while (i3 < 5);
+        }
+    }
+    a1[3][11] = (((a1[1][4] > 14) ? (90 <= v1) : (v0 != a0[0])) % 9);
+    for (int i4 = 0; i4 < 5; i4 = i4 + 1) {
+        a0[13] = (((v1 - v1) + (v2 < v3)) <= ((a1[3][2] - v2) > (36 && a1[2][2])));
+        v3 = (((80 - a1[0][10]) > (v1 ? v3 : a1[0][1])) || ((10 >= 92) ? (v3 ? i4 : v1) : (v0 ? a1[2][2] : v3)));
+        {
+            int i5 = 0;
+            do {
+                if ((v2 / 6) > 51) break;
+                v2 = (((i5 != v1) <= (19 != 85)) && ((v2 ? a1[0][2] : 1) < (76 >= v1)));
+                a0[13] = (((i5 >= v1) && (30 / 8)) || ((66 || v2) >= (10 % 5)));
+                v0 = (((a1[2][5] < v0) && (v0 + a0[13])) && ((i5 % 9) != (a0[11] < i5)));
+                i5 = i5 + 1;
+            } while (i5 < 8);
+        }
+    }
+    return (((v1 * 98) % 5) ? ((71 > a0[1]) - (24 ? a1[3][1] : 24)) : ((v0 && 73) * (v1 || a1[2][3])));
+}
+int f1() {
+    int v0 = 36;
+    int v1 = 11;
+    int v2 = 66;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    a1[2][3] = (((v2 <= v1) > (v3 == 71)) ? ((a1[3][8] <= 27) > (a0[0] - v3)) : ((22 ? v2 : v0) < (37 != a0[5])));
+    v2 = (((v0 ? a1[0][1] : a0[1]) != (93 % 4)) ? ((v1 == v3) && (40 != 90)) : ((v0 < 25) || (v2 && v2)));
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            if ((v1 > i0) > 82) break;
+            a1[1][7] = (((19 != v2) ? (v0 != 93) : (v1 ? v1 : 38)) <= ((v2 / 9) && (34 ? v2 : 41)));
+            v1 = (((v2 % 4) >= (v1 > 91)) ? ((v3 ? i0 : a1[3][15]) / 2) : ((v1 > v1) || (70 * 20)));
+            {
+                int i1 = 0;
+                do {
+                    v2 = (((15 / 9) + (a0[10] * i1)) >= ((a0[6] ? v1 : 54) && (i1 > i0)));
+                    v0 = (((52 > v0) ? (5 ? v2 : 84) : (a0[0] < v0)) ? ((v2 >= a1[1][14]) ? (v3 - v3) : (v1 / 9)) : ((v3 == v1) * (a0[1] >= i0)));
+                    a1[0][3] = (((v3 / 4) / 7) >= ((i1 || a1[0][6]) == (v3 % 4)));
+                    i1 = i1 + 1;
+                } while (i1 < 4);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        v1 = (((v2 > a1[1][2]) ? (a1[0][9] / 8) : (v2 - a1[1][2])) % 2);
+        v3 = (((v3 - 88) || (v3 && v0)) / 8);
+        {
+            int i3 = 0;
+            while (i3 < 8) {
+                a1[2][9] = (((v1 - v0) ? (28 || a0[15]) : (69 > 86)) >= ((v0 > a0[11]) < (a1[3][13] || i2)));
+                v2 = (((a1[0][1] != v2) == (v0 > 31)) < ((29 ? v3 : a0[11]) ? (i3 != 58) : (12 != v3)));
+                v1 = (((a1[0][11] - i3) >= (v1 && 36)) - ((a1[2][13] + a0[4]) + (49 > i2)));
+                i3 = i3 + 1;
+            }
+        }
+    }
+    {
+        int i4 = 0;
+        while (i4 < 5) {
+            a0[1] = (((v2 && 11) && (a1[1][2] < 58)) && ((64 == 25) != (v0 || v1)));
+            {
+                int i5 = 0;
+                do {
+                    a0[2] = (((i5 > v0) || (53 >= v2)) == ((a0[10] && a1[3][11]) - (v1 || v3)));
+                    v3 = (((a0[3] <= i4) == (v2 / 8)) && ((i5 == v0) - (v1 / 4)));
+                    a1[3][11] = (((v0 % 5) && (v1 >= i5)) <= ((i5 ? a1[0][6] : v3) > (i5 <= v2)));
+                    i5 = i5 + 1;
+                } while (i5 < 3);
+            }
+            v0 = (((32 ? a1[0][13] : a1[0][1]) / 4) || ((8 < v0) - (i4 <= 83)));
+            i4 = i4 + 1;
+        }
+    }
+    return (((v3 != v0) < (10 > 82)) == ((36 >= v3) < (v2 != v3)));
+}
+int f2() {
+    int v0 = 56;
+    int v1 = 37;
+    int v2 = 67;
+    int v3 = 3;
+    int a0[16];
+    int a1[4][16];
+    if ((((a1[0][11] <= 5) || (v1 / 8)) + ((v2 - v2) >= (v1 != v3)))) {
+        a0[5] = (((v3 <= a0[15]) < (a1[0][9] && a1[3][6])) % 3);
+        v2 = (((a1[1][11] % 9) ? (a0[14] > v1) : (68 % 6)) >= ((a0[15] - v2) <= (v3 >= v3)));
+        v2 = (((3 && a1[1][12]) < (v2 && 16)) != ((v1 - v3) % 2));
+    } else {
+        a0[3] = (((v2 >= v2) <= (v3 ? v3 : a0[5])) < ((70 + a1[3][9]) + (v1 + 17)));
+        v2 = (((99 ? 78 : v2) - (10 < 90)) ? ((v0 / 8) ? (86 ? 53 : a0[3]) : (v2 != a0[14])) : ((81 * 42) % 7));
+        v0 = (((29 < a0[11]) / 5) == ((a0[4] * v2) <= (a1[2][14] ? a1[1][2] : 22)));
+    }
+    v2 = (((v2 ? 21 : v0) ? (65 / 7) : (a0[3] * v2)) <= ((v2 * a0[15]) * (v0 == v2)));
+    v2 = (((15 * v3) % 4) || ((a1[0][11] % 7) % 6));
+    if ((((a0[6] && 9) ? (v1 ? 4 : v2) : (v1 ? v1 : v1)) >= ((a0[15] != a1[3][7]) / 3))) {
+        v3 = (((a1[0][12] == a1[2][13]) - (a1[0][1] ? 97 : v2)) <= ((v0 * a0[2]) || (a0[4] || v0)));
+        v2 = (((8 % 5) == (v0 + v3)) ? ((v2 + a1[1][9]) <= (v2 == a0[15])) : ((v0 / 2) ? (69 >= 93) : (77 >= a1[1][3])));
+        a0[15] = (((v2 ? v0 : 96) - (95 < 95)) % 9);
+    } else {
+        v1 = (((v2 >= v0) % 8) || ((a0[10] != 6) == (70 / 9)));
+        v1 = (((v3 ? v2 : a1[3][10]) <= (1 ? 10 : a0[4])) >= ((a0[2] * v0) ? (v1 || v0) : (v0 <= a1[3][15])));
+        a1[3][5] = (((a1[0][4] / 9) > (v1 + 40)) % 3);
+    }
+    {
+        int i0 = 0;
+        do {
+            if ((v0 != i0) > 69) break;
+            a1[3][7] = (((84 - a1[3][8]) * (v2 >= a0[9])) < ((a0[4] ? a1[2][5] : a1[0][15]) * (v0 != 16)));
+            {
+                int i1 = 0;
+                while (i1 < 5) {
+                    v0 = (((v3 <= 11) * (v0 - a0[0])) / 8);
+                    a0[1] = (((v2 <= 66) <= (v3 >= 34)) % 9);
+                    v2 = (((a1[1][8] == 1) < (a1[2][9] > v1)) ? ((i1 / 6) && (i1 == a0[8])) : ((10 >= i1) + (a1[3][4] ? a1[3][0] : a0[11])));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][11] = (((v1 && v0) + (a1[0][14] + v1)) > ((v2 == v2) && (v2 ? v2 : v3)));
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    return (((v0 ? a0[14] : a1[1][12]) ? (v1 && a1[0][5]) : (a1[3][8] == v3)) == ((a0[6] % 9) / 8));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
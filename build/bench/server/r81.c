@@ -0,0 +1,68 @@
+int f0() {
+    int v0 = 51;
+    int v1 = 94;
+    int v2 = 3;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v1 = (((i0 >= v3) && (v0 <= v2)) ? ((v1 == 40) - (a1[0][0] / 3)) : ((a1[0][1] >= v3) + (v1 % 7)));
+        a0[5] = (((a1[0][12] - 13) == (a0[10] ? a1[1][5] : v2)) != ((80 ? 57 : v2) / 8));
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                v2 = (((a1[1][8] && v0) && (a0[13] - a1[1][14])) <= ((v1 >= 35) / 9));
+                v1 = (((v1 ? 54 : 90) * (v3 / 5)) / 8);
+                v0 = (((v0 ? a0[8] : i1) == (i0 == v0)) >= ((a0[0] + 53) && (v3 && a0[4])));
+                i1 = i1 + 1;
+            }
+        }
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        {
+            int i3 = 0;
+            while (i3 < 5) {
+                a0[5] = (((a0[9] != a1[1][7]) && (i3 >= i2)) - ((83 ? a0[9] : i2) * (v3 - i3)));
+                v3 = (((54 <= 54) >= (v0 > a0[3])) || ((43 && 51) == (76 * 60)));
+                v0 = (((i2 < 88) || (0 <= i2)) != ((v1 * v3) || (v1 - i3)));
+                i3 = i3 + 1;
+            }
+        }
+        v3 = (((a1[2][1] && v2) == (a1[3][6] / 3)) || ((a0[5] < i2) ? (v1 ? a1[1][2] : v0) : (v0 / 2)));
+        v3 = (((v2 + v1) <= (93 == 25)) == ((71 / 8) / 1));
+    }
+    {
+        int i4 = 0;
+        do {
+            if ((a1[3][4] * v0) > 66) break;
+            v2 = (((i4 <= v1) == (v0 > v2)) ? ((i4 > a0[4]) == (v0 ? 37 : i4)) : ((v0 - a1[1][2]) != (48 != 73)));
+            v1 = (((15 != v1) > (a0[4] - a1[2][8])) != ((v3 && a0[4]) / 8));
+            for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+                v1 = (((90 ? i4 : a1[1][11]) && (v2 % 1)) + ((i4 > 71) % 8));
+                v0 = (((64 < v2) + (i4 - v1)) >= ((a1[3][5] || 84) && (v1 >= 15)));
+                v3 = (((v0 != a0[9]) && (i5 < 7)) + ((v3 > 71) == (v3 - 76)));
+            }
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    v3 = (((94 == v3) + (v2 * 77)) - ((78 || 96) >= (v2 < v1)));
+    {
+        int i6 = 0;
+        do {
+            a0[0] = (((a1[0][2] <= a0[2]) > (v2 && i6)) * ((83 >= v1) >= (v1 - i6)));
+            v2 = (((68 <= a1[3][13]) - (i6 == a0[14])) == ((v2 * v2) % 8));
+            for (int i7 = 0; i7 < 3; i7 = i7 + 1) {
+                v0 = (((v2 == 67) + (v3 - a0[11])) < ((a1[2][15] ? v2 : v2) <= (a1[3][14] == a1[0][12])));
+                v0 = (((67 <= v2) ? (a1[0][4] ? v3 : v1) : (a0[11] * i6)) != ((v1 != 38) > (i6 - i7)));
+                v2 = (((v0 / 1) ? (28 - v1) : (i7 - a0[10])) + ((v1 >= v1) || (i7 || a1[3][1])));
+            }
+            i6 = i6 + 1;
+        } while (i6 < 2);
+    }
+    return (((v1 - a0[0]) != (v2 * v1)) <= ((63 <= v0) ? (v1 ? 84 : a1[0][14]) : (v1 % 5)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
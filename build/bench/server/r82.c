@@ -0,0 +1,107 @@
+int f0() {
+    int v0 = 18;
+    int v1 = 71;
+    int v2 = 88;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 8) {
+                    if ((81 >= i0) > 60) break;
+                    v1 = (((a1[2][0] && a1[1][9]) < (i0 + i0)) + ((a1[0][9] != a1[1][14]) ? (24 - v1) : (v3 ? v3 : i0)));
+                    a1[1][9] = (((a1[2][9] * 97) / 6) && ((v3 > 54) ? (v2 + a0[7]) : (v2 >= v1)));
+                    a1[0][5] = (((a0[15] >= v3) ? (a1[3][7] % 4) : (83 == a1[0][8])) + ((v3 || 54) + (i1 && i1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((a1[3][0] && v1) / 5) > ((a0[15] <= 8) || (v2 * 75)));
+            a1[0][14] = (((a0[13] || v1) < (a1[2][1] * 76)) != ((59 >= a1[0][11]) * (25 || v1)));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((33 <= v2) || (30 + a0[2])) != ((a0[8] <= v0) ? (v2 ? 92 : v2) : (v0 - v2)))) {
+        v0 = (((65 + 84) || (a1[0][8] || 9)) != ((v3 != v3) || (v3 && 71)));
+        v0 = (((a1[3][12] == 47) >= (36 - v3)) < ((v3 / 9) / 3));
+        v3 = (((v2 <= 72) * (a0[7] && v0)) - ((a1[0][11] - a0[9]) || (a1[1][10] && v2)));
+    } else {
+        a1[0][5] = (((59 || v3) * (43 && v1)) && ((v3 ? v3 : 32) != (v0 != 19)));
+        v2 = (((52 < v3) + (v3 != v1)) / 2);
+        a1[0][9] = (((32 * 91) == (a1[3][5] <= 83)) < ((v3 - a1[2][6]) == (v2 ? v2 : v3)));
+    }
+    if ((((18 != v1) > (1 == a1[0][11])) <= ((a1[1][8] >= v0) ? (v1 * v1) : (v2 / 4)))) {
+        v1 = (((a1[0][4] - v1) + (a0[10] ? v2 : v2)) || ((v1 > v3) < (a0[1] <= 90)));
+        v1 = (((71 > a1[0][4]) || (v1 * v2)) && ((v2 >= 36) == (85 / 2)));
+        a1[1][1] = (((a1[2][0] / 2) >= (a1[3][4] ? v3 : a0[3])) <= ((a0[14] * v1) && (22 % 2)));
+    } else {
+        v1 = (((a1[1][1] ? v3 : a1[3][2]) % 3) ? ((50 < v2) ? (v0 + 62) : (v0 ? a0[11] : v2)) : ((39 / 1) >= (v3 || v0)));
+        a0[6] = (((v1 < 55) == (29 > v0)) || ((73 > v0) * (v1 / 6)));
+        a1[2][6] = (((38 >= v1) % 9) * ((v0 ? a0[2] : v1) ? (v1 <= v0) : (82 && v2)));
+    }
+    v2 = (((95 && v0) >= (v3 + v2)) || ((v1 > 39) - (v0 == a1[3][3])));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v2 = (((v2 || v3) <= (27 && v1)) || ((a1[1][5] > v3) / 1));
+            a0[4] = (((v3 >= v3) && (v3 * 14)) % 4);
+            for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+                a0[2] = (((i2 >= v1) > (96 % 2)) < ((i2 / 2) <= (i3 ? a1[2][14] : v1)));
+                a1[1][8] = (((a0[1] / 3) == (a0[1] < a0[7])) ? ((v2 ? v1 : v1) - (5 > v3)) : ((a1[3][4] % 8) / 3));
+                v1 = (((v1 / 6) >= (i3 || a1[2][1])) % 2);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    return (((a1[0][8] != v2) > (a0[7] > a1[3][3])) != ((v2 ? v1 : v3) - (v3 ? v2 : a1[3][3])));
+}
+int f1() {
+    int v0 = 55;
+    int v1 = 98;
+    int v2 = 19;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    v0 = (((15 && v1) <= (a0[13] >= v3)) && ((10 ? 65 : v1) && (v3 / 7)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a1[1][4] = (((v1 <= a1[1][3]) < (v0 + v1)) / 9);
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v1 = (((82 <= v3) ? (55 + 51) : (v0 && a1[1][1])) ? ((42 <= i0) / 8) : ((19 - 44) ? (a0[11] - 75) : (v0 != a1[2][7])));
+                a0[9] = (((88 % 5) * (16 % 4)) >= ((v3 && v3) % 1));
+                v0 = (((i1 ? a0[3] : v2) < (a1[0][3] >= v3)) + ((a1[0][14] < a1[0][13]) == (i1 * a0[1])));
+            }
+            v2 = (((83 * 44) + (1 ? v1 : i0)) + ((v2 / 9) >= (a0[5] ? 77 : a1[1][11])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v1 * a0[11]) || (v0 * 7)) != ((a0[9] <= v1) == (61 == 30)))) {
+        a0[15] = (((v2 < v0) - (34 != a0[7])) < ((v0 > a1[3][9]) <= (v3 - v0)));
+        v2 = (((92 >= 70) != (v1 <= a0[13])) ? ((8 % 7) - (v2 * a0[4])) : ((54 + 15) && (v2 + 96)));
+        v2 = (((a0[14] % 8) < (v0 != 67)) > ((v1 ? 0 : v2) + (a0[9] / 8)));
+    } else {
+        v2 = (((a0[5] + 68) * (87 != a1[0][7])) / 5);
+        v1 = (((v0 > 89) - (v1 < 64)) >= ((v1 == v2) % 4));
+        v2 = (((v0 / 7) * (4 || 15)) >= ((v3 || v3) / 1));
+    }
+    if ((((a1[1][9] ? v0 : v1) > (21 + 16)) <= ((v3 % 2) + (v2 || v0)))) {
+        v3 = (((v1 ? v0 : v2) % 3) || ((v0 <= a1[1][4]) ? (a1[0][9] > a0[1]) : (a1[3][13] % 3)));
+        a1[1][10] = (((v2 ? a0[1] : v3) <= (31 <= 71)) ? ((a1[1][5] || a1[0][10]) > (v0 == 19)) : ((v0 ? v0 : v2) < (49 != v1)));
+        v1 = (((81 - v2) * (81 <= a0[8])) * ((v3 - 36) % 6));
+    } else {
+        v3 = (((a0[4] % 8) < (0 * 48)) <= ((v2 > v2) && (v3 * v2)));
+        a0[13] = (((v0 <= 94) && (v0 == v2)) != ((3 / 3) ? (v1 / 2) : (a0[15] && v0)));
+        v0 = (((v1 ? 53 : v3) >= (55 + 88)) > ((a0[15] % 6) == (a1[2][1] ? a0[0] : a1[3][14])));
+    }
+    v1 = (((68 % 8) - (v3 + a1[3][12])) / 7);
+    return (((a1[1][9] - v3) > (v2 == v0)) && ((v0 ? v1 : a1[2][1]) ? (65 / 2) : (v0 != 35)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,168 @@
+int f0() {
+    int v0 = 54;
+    int v1 = 81;
+    int v2 = 49;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            for (int i1 = 0; i1 < 8; i1 = i1 + 1) {
+                a0[4] = (((a0[13] <= 63) <= (41 && 13)) / 7);
+                v0 = (((83 % 9) >= (v1 / 8)) * ((v3 < v3) % 2));
+                v2 = (((i0 <= a1[0][11]) > (48 >= a1[2][2])) % 2);
+            }
+            v2 = (((a1[2][1] > a0[1]) % 5) * ((v0 ? v3 : v3) * (v2 + v0)));
+            v1 = (((47 > v2) || (a1[2][11] - v1)) % 9);
+            i0 = i0 + 1;
+        }
+    }
+    v0 = (((v0 ? 35 : v2) / 9) != ((v1 < 78) / 1));
+    v1 = (((46 <= a0[1]) >= (v3 ? v2 : v1)) * ((14 > v1) + (a1[1][10] + v2)));
+    if ((((v2 / 7) % 5) != ((a1[0][8] + 53) * (a1[0][7] < v3)))) {
+        v0 = (((v0 || 88) >= (68 >= 90)) == ((a0[8] % 8) ? (v2 || a0[3]) : (59 || 61)));
+        v1 = (((v3 != a0[15]) < (v3 ? 86 : v1)) % 3);
+        v0 = (((v2 <= v2) == (80 < v1)) <= ((a1[2][2] == 44) > (v1 + 89)));
+    } else {
+        v2 = (((97 ? v0 : v1) > (54 && v2)) >= ((56 < v1) ? (a1[0][0] ? v1 : v1) : (87 * 31)));
+        v2 = (((v1 * v1) + (a1[1][6] > v0)) < ((v1 || v3) < (v1 - v3)));
+        v0 = (((v2 || a1[1][9]) == (v0 % 6)) * ((v2 < 31) <= (a0[15] != a1[1][2])));
+    }
+    for (int i2 = 0; i2 < 2; i2 = i2 + 1) {
+        a0[4] = (((v0 % 7) ? (a0[1] ? v1 : v2) : (v0 ? v2 : 70)) ? ((95 * v0) * (35 > v0)) : ((8 >= a0[15]) <= (v3 ? a1[0][0] : a0[10])));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v1 = (((v1 == v2) / 6) && ((v1 ? v3 : v0) == (v3 == v2)));
+            v3 = (((1 % 3) + (17 > v1)) * ((v2 ? a0[6] : a0[4]) <= (a1[3][11] >= a0[11])));
+            v1 = (((a0[2] == 63) + (18 / 6)) == ((v1 >= v0) + (v3 <= v1)));
+        }
+        v0 = (((a0[4] >= a1[2][2]) % 9) <= ((i2 % 2) <= (v3 == a0[2])));
+    }
+    return (((23 > a0[13]) / 9) * ((v1 + 26) <= (v0 && 36)));
+}
+int f1() {
+    int v0 = 78;
+    int v1 = 71;
+    int v2 = 42;
+    int v3 = 87;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            for (int i1 = 0; i1 < 7; i1 = i1 + 1) {
+                v3 = (((71 - i1) || (i1 || i0)) || ((26 || 29) % 8));
+                v3 = (((i1 % 5) - (v1 != i1)) * ((v0 / 9) && (v0 - i0)));
+                v0 = (((v0 >= v0) / 1) < ((i1 >= i0) > (v3 <= v0)));
+            }
+            v3 = (((78 || 46) + (v2 > i0)) == ((a0[4] + 42) > (a0[2] % 2)));
+            v3 = (((68 <= a1[0][13]) == (v0 % 8)) / 2);
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((a1[2][5] - i2) && (94 % 2)) < ((a0[14] != v2) <= (96 != 16)));
+            v2 = (((v0 - v0) ? (a0[8] || v3) : (v0 % 9)) ? ((a1[2][9] ? 53 : 5) / 7) : ((i2 == i2) >= (i2 / 4)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                a1[2][0] = (((a1[3][14] <= v2) <= (79 ? 6 : a0[3])) / 8);
+                a0[10] = (((a0[3] % 3) > (v2 && a1[2][1])) || ((39 >= a0[14]) == (v0 > i3)));
+                v3 = (((6 * 22) > (a1[3][6] == 19)) - ((v2 <= a0[12]) >= (a0[0] * i2)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    v2 = (((v0 / 6) ? (89 / 9) : (v0 >= v1)) ? ((v0 > v1) >= (v0 ? v0 : v2)) : ((v1 || v3) ? (v0 == 73) : (v3 * v3)));
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 2; i5 = i5 + 1) {
+            if ((36 != 57) > 98) break;
+            a1[0][12] = (((v2 && i4) == (v3 >= a0[5])) || ((v0 > v0) % 8));
+            v2 = (((a0[4] <= i4) ? (a1[3][2] ? i5 : v1) : (v0 ? a1[3][0] : i4)) == ((a0[9] || a0[11]) == (v0 - 40)));
+            a0[6] = (((v0 / 5) && (68 + v1)) >= ((i4 != a0[13]) % 5));
+        }
+        v1 = (((i4 && a1[3][10]) >= (v0 ? 5 : i4)) == ((51 > v1) || (v1 / 2)));
+        v0 = (((v2 ? a0[9] : a1[3][0]) <= (32 ? 21 : i4)) || ((v1 % 9) != (v3 / 1)));
+    }
+    if ((((v3 >= v3) != (v1 * v2)) < ((v3 - v0) == (v3 / 8)))) {
+        v3 = (((v2 > 53) || (v2 == v2)) ? ((v2 ? a0[5] : v1) >= (v0 - v1)) : ((46 || v2) % 9));
+        a1[2][12] = (((a0[3] / 4) <= (v2 - a0[10])) > ((a0[6] != v2) % 3));
+        a1[0][5] = (((v1 + v2) <= (83 * a0[7])) - ((v2 ? 8 : v0) != (v2 == 70)));
+    } else {
+        v2 = (((v0 == v1) * (42 != a0[5])) * ((v3 ? v0 : a1[1][7]) || (v1 == a1[2][11])));
+        v1 = (((v2 && v0) ? (v2 % 5) : (v2 && a1[0][13])) != ((a1[3][13] && a1[1][0]) + (88 ? 61 : v0)));
+        v3 = (((85 > 94) * (v0 * v2)) + ((v3 % 4) <= (v2 > v3)));
+    }
+    return (((v3 < v0) + (v3 || a0[2])) > ((66 ? a0[9] : 17) >= (v1 != a1[0][15])));
+}
+int f2() {
+    int v0 = 93;
+    int v1 = 63;
+    int v2 = 4;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 2; i1 = i1 + 1) {
+                v1 = (((15 ? a1[1][4] : v1) == (a1[0][2] ? i1 : a0[2])) * ((v2 || 75) ? (a0[0] * 0) : (69 == v3)));
+                v2 = (((69 - i1) ? (v0 ? 64 : a0[5]) : (4 >= 28)) / 9);
+                v2 = (((v1 ? 27 : v1) != (i0 - v0)) - ((a1[2][9] <= 22) ? (v0 > i1) : (50 % 5)));
+            }
+            v3 = (((18 && a0[2]) % 3) % 1);
+            v0 = (((a0[4] % 9) <= (v2 < v1)) || ((v3 || 49) <= (v2 <= 76)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    if ((((37 >= a0[6]) / 2) ? ((v0 || 93) || (a0[0] * v0)) : ((v1 && 20) ? (v0 + 79) : (v2 > v3)))) {
+        a0[1] = (((11 / 7) >= (v3 ? v3 : a0[13])) || ((a1[1][11] - a0[12]) % 9));
+        v3 = (((68 > v1) <= (a0[4] - a1[0][14])) || ((v0 || 46) * (77 * v0)));
+        v2 = (((v3 * 8) < (53 < v1)) ? ((v1 / 7) > (18 + 12)) : ((v3 ? v3 : 42) ? (v1 > v0) : (v1 ? 30 : v1)));
+    } else {
+        v0 = (((a0[15] ? a0[2] : v1) < (50 > v1)) > ((v0 < 58) && (v3 - v0)));
+        v2 = (((v3 || v0) * (71 >= v1)) - ((28 < 81) >= (v2 % 3)));
+        a0[3] = (((v1 >= v2) && (50 * a0[1])) ? ((53 % 2) == (a0[4] != 48)) : ((a1[1][12] >= v2) < (11 == a1[3][10])));
+    }
+    v3 = (((a0[0] > v0) - (a0[3] > 78)) || ((11 / 5) / 3));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            v1 = (((v2 / 8) != (a0[10] + v2)) >= ((v1 || i2) && (v3 > 29)));
+            {
+                int i3 = 0;
+                do {
+                    if ((47 ? v1 : a1[0][2]) > 69) break;
+                    v0 = (((10 != a1[3][1]) >= (v0 < i2)) - ((a0[13] * v0) - (v0 < i3)));
+                    v0 = (((v0 / 8) ? (a1[0][1] ? i2 : v3) : (a0[14] > i2)) / 5);
+                    v3 = (((v3 || 72) || (54 == a1[0][8])) % 8);
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v2 = (((v3 >= a0[10]) * (a1[0][2] - 96)) % 4);
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v3 = (((i4 + v2) ? (v2 % 7) : (v3 != 31)) < ((23 > a0[3]) ? (i4 >= a0[8]) : (a1[3][1] == 69)));
+        v3 = (((a0[12] - v0) > (v3 < i4)) == ((v1 >= v2) / 2));
+        {
+            int i5 = 0;
+            do {
+                if ((v0 || v0) > 65) break;
+                a0[9] = (((v0 || v0) < (i5 == i4)) ? ((a1[2][15] || a0[6]) % 9) : ((16 / 7) >= (76 <= a0[5])));
+                v2 = (((i5 ? v1 : i5) != (a0[9] > v0)) > ((i4 * v2) >= (i5 && a0[1])));
+                a1[0][14] = (((a1[3][1] || a1[0][13]) > (v2 > v3)) + ((a1[0][5] == a0[11]) < (63 * v3)));
+                i5 = i5 + 1;
+            } while (i5 < 6);
+        }
+    }
+    return (((v2 > v0) < (24 / 4)) % 9);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,51 @@
+int f0() {
+    int v0 = 26;
+    int v1 = 80;
+    int v2 = 81;
+    int v3 = 64;
+    int a0[16];
+    int a1[4][16];
+    a0[3] = (((v2 != 29) - (v2 % 1)) * ((15 / 5) > (a1[1][6] / 9)));
+    if ((((v2 <= a1[0][11]) > (v1 == v3)) / 6)) {
+        v2 = (((a0[3] && a0[13]) + (a0[5] - v3)) ? ((a0[2] >= v1) ? (a0[5] + v1) : (v0 >= a1[2][0])) : ((a1[1][12] && 99) < (v3 ? v2 : a1[0][15])));
+        v0 = (((v3 / 2) == (v0 - v3)) % 6);
+        v1 = (((a0[4] > 9) != (a0[4] == a0[8])) && ((v3 && v2) * (32 * v1)));
+    } else {
+        v0 = (((85 % 7) > (a0[2] ? a0[1] : a0[13])) ? ((24 - v0) + (a0[15] || v3)) : ((92 < a1[0][13]) <= (a1[3][6] == a1[1][12])));
+        v0 = (((v3 >= 53) - (v0 ? v3 : v1)) <= ((a1[0][3] >= v3) ? (35 == v0) : (v2 != v0)));
+        a1[0][3] = (((v0 != 23) ? (v3 + 26) : (a1[1][8] < a1[1][10])) < ((63 <= v0) > (v3 - 89)));
+    }
+    for (int i0 = 0; i0 < 7; i0 = i0 + 1) {
+        v1 = (((v3 / 4) + (v1 + v1)) % 4);
+        v3 = (((i0 ? v1 : 49) <= (v0 + v2)) < ((a1[1][7] + v1) + (a0[1] * a1[0][14])));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                a0[10] = (((v1 > 4) < (v1 + i0)) >= ((a1[2][9] >= a0[2]) ? (v0 || v0) : (95 && a0[7])));
+                v3 = (((a1[3][15] - i0) ? (v1 <= a0[12]) : (82 + i1)) ? ((i0 && v0) != (v2 ? a0[8] : v0)) : ((v3 < v2) ? (v2 || i0) : (45 < a1[2][11])));
+                a0[7] = (((59 + 73) > (a0[3] > a0[5])) % 5);
+                i1 = i1 + 1;
+            }
+        }
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v1 % 3) ? (v2 || v1) : (2 / 8)) <= ((v0 >= a0[5]) - (i2 < v0)));
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v1 = (((v3 / 3) == (a1[0][2] + i3)) / 3);
+                v1 = (((41 || 1) / 8) || ((i3 == i3) ? (a0[0] <= v3) : (71 > i3)));
+                a1[3][6] = (((71 <= v0) + (v3 < v2)) % 5);
+            }
+            v2 = (((v3 ? v3 : v1) >= (a1[0][14] && v3)) ? ((i2 <= a0[11]) % 3) : ((a1[1][3] || 74) ? (a0[13] % 6) : (67 > v2)));
+            i2 = i2 + 1;
+        } while (i2 < 4);
+    }
+    a0[5] = (((v1 + a1[2][5]) <= (48 >= v3)) < ((v2 * 85) % 8));
+    return (((v3 / 7) != (v0 % 3)) != ((81 ? a1[0][6] : v0) <= (v0 >= a0[5])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
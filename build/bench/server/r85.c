@@ -0,0 +1,103 @@
+int f0() {
+    int v0 = 28;
+    int v1 = 48;
+    int v2 = 92;
+    int v3 = 32;
+    int a0[16];
+    int a1[4][16];
+    a1[0][10] = (((34 * a1[2][13]) <= (v2 ? a0[4] : a0[12])) || ((a0[0] ? 63 : v1) >= (v2 + v3)));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            a0[13] = (((a0[6] / 1) > (v2 / 3)) == ((v0 % 8) + (v1 || i0)));
+            v0 = (((a1[2][9] != v3) ? (v0 > 52) : (a1[2][7] - 12)) / 5);
+            {
+                int i1 = 0;
+                do {
+                    v3 = (((i1 * a0[0]) > (v3 < 11)) % 1);
+                    a0[3] = (((v2 == v3) / 8) != ((v1 != a0[13]) || (34 >= v3)));
+                    a0[7] = (((v2 >= 40) || (i1 ? i1 : 51)) != ((i0 / 2) ? (i1 + 79) : (v0 < i0)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    v2 = (((a0[6] * a1[1][12]) % 4) == ((87 == v3) / 8));
+    if ((((a0[11] + a1[2][9]) ? (a0[0] >= a1[3][3]) : (v3 < a0[7])) >= ((22 || a1[2][0]) >= (v2 != v2)))) {
+        a1[2][0] = (((v3 ? v3 : 17) % 7) <= ((v0 % 3) >= (v3 ? 1 : 75)));
+        a1[2][4] = (((25 == v1) % 7) <= ((v3 <= v3) || (v2 - v2)));
+        v1 = (((v2 >= v2) == (a1[1][14] || a1[0][15])) == ((37 == v1) ? (41 % 8) : (v2 ? v3 : a0[14])));
+    } else {
+        v1 = (((a0[3] + v2) > (v3 ? v3 : v2)) % 8);
+        v0 = (((96 != a0[5]) != (a0[6] < a1[3][0])) ? ((a0[2] != v3) < (v0 == v3)) : ((v1 && 2) || (v3 % 1)));
+        a0[0] = (((a0[4] ? v2 : 68) ? (83 || v0) : (v2 <= 97)) && ((v1 ? v3 : v2) + (39 % 4)));
+    }
+    v1 = (((v1 || v3) || (44 == 87)) ? ((v3 * v1) - (76 == a0[11])) : ((v3 != 83) > (v0 && a1[2][13])));
+    return (((v2 ? v2 : v0) == (v0 == 32)) > ((58 >= a1[2][0]) * (63 - 26)));
+}
+int f1() {
+    int v0 = 48;
+    int v1 = 27;
+    int v2 = 56;
+    int v3 = 45;
+    int a0[16];
+    int a1[4][16];
+    a1[3][14] = (((v2 < a1[3][1]) - (a1[0][3] || 40)) < ((v1 && v1) - (a1[0][5] - v2)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 6) {
+                    v3 = (((27 % 3) == (i1 > v2)) * ((i0 <= v2) - (v0 || a0[13])));
+                    v0 = (((10 && i0) >= (a0[0] < 36)) < ((a0[12] < 20) - (i0 <= v1)));
+                    v3 = (((a0[5] == a0[5]) + (a1[3][0] == i1)) / 3);
+                    i1 = i1 + 1;
+                }
+            }
+            a0[7] = (((70 == v2) > (a1[2][5] % 6)) * ((a1[1][10] && 64) - (26 % 6)));
+            a1[2][0] = (((a1[2][13] && v0) % 6) > ((v3 % 2) && (i0 ? v3 : i0)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    for (int i2 = 0; i2 < 8; i2 = i2 + 1) {
+        if ((v1 >= i2) > 79) break;
+        {
+            int i3 = 0;
+            do {
+                v0 = (((a1[0][1] || a1[2][3]) == (v0 / 3)) / 4);
+                v0 = (((v0 == a0[10]) || (58 ? v3 : v2)) + ((a0[15] <= i2) % 3));
+                a0[5] = (((v1 >= v3) < (i2 * v1)) / 7);
+                i3 = i3 + 1;
+            } while (i3 < 2);
+        }
+        v2 = (((a1[0][1] >= i2) * (v2 <= v0)) < ((a0[8] - 52) >= (v1 * i2)));
+        v3 = (((v3 <= a0[11]) >= (a1[1][15] <= v1)) % 3);
+    }
+    if ((((54 >= v0) ? (v2 > 98) : (57 != a1[1][7])) <= ((v2 == v0) % 2))) {
+        v1 = (((a0[8] && 83) <= (v3 || v2)) % 7);
+        a1[0][3] = (((a0[6] * v2) * (v0 * v3)) >= ((v1 >= v1) != (v3 > v1)));
+        a1[3][7] = (((23 * v0) % 1) % 9);
+    } else {
+        v2 = (((v3 && v1) / 9) > ((v3 > v0) % 2));
+        a1[3][9] = (((a1[0][2] <= v0) < (33 + v1)) - ((v2 < a0[8]) + (70 < v1)));
+        v1 = (((a1[3][10] > 31) >= (v1 % 7)) == ((v2 != a0[4]) * (a0[15] + v1)));
+    }
+    if ((((64 == 35) || (v0 && v1)) ? ((a0[9] > a0[15]) != (v0 > v1)) : ((98 * 43) < (v2 / 5)))) {
+        v2 = (((20 < a0[14]) || (a0[12] && v2)) == ((v0 - v1) ? (a1[0][1] > v1) : (a0[0] && a1[3][8])));
+        v3 = (((v0 != 19) / 4) < ((v0 > v3) / 9));
+        v0 = (((a1[2][3] == a1[0][4]) < (v0 + v3)) + ((v3 + v3) < (52 <= v3)));
+    } else {
+        v1 = (((v2 * v2) * (a0[9] != 5)) || ((27 / 4) <= (a0[6] % 5)));
+        a0[0] = (((v3 / 9) != (34 / 6)) ? ((a0[5] == v3) * (v2 + v0)) : ((v3 + v3) == (v1 % 6)));
+        a1[0][6] = (((a0[13] / 7) / 6) != ((a0[1] / 9) % 2));
+    }
+    return (((0 - a0[14]) - (a0[7] || 76)) >= ((v0 == a1[3][4]) < (64 > a0[6])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,143 @@
+int f0() {
+    int v0 = 90;
+    int v1 = 13;
+    int v2 = 3;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((39 ? a0[10] : a0[0]) >= (v2 ? v1 : v0)) != ((v1 != 96) < (v1 / 2)));
+    a0[6] = (((a1[2][14] && 30) / 1) < ((v1 < a1[1][15]) <= (v1 || v2)));
+    if ((((a1[0][7] + v3) ? (v3 < 36) : (75 <= v0)) && ((46 - 11) == (a1[0][2] - v1)))) {
+        a0[11] = (((v2 % 8) > (a1[2][13] <= v1)) ? ((7 * 80) != (v3 * 92)) : ((75 + 36) * (v2 * v1)));
+        v2 = (((v1 / 5) - (v3 >= v3)) / 5);
+        a1[2][8] = (((v3 % 1) * (48 < 26)) && ((a1[2][12] * v3) < (53 <= v2)));
+    } else {
+        v2 = (((39 - a1[3][3]) / 2) && ((v3 != a1[2][12]) == (26 == a1[0][7])));
+        a0[7] = (((v0 && a0[0]) < (a0[1] / 1)) != ((v3 && v3) == (v2 ? 79 : a1[3][11])));
+        a0[10] = (((v1 % 7) != (a0[15] <= v0)) == ((63 % 1) + (93 > a0[8])));
+    }
+    if ((((a0[11] + v1) >= (v1 ? 93 : v1)) + ((a1[1][3] % 7) / 3))) {
+        a0[7] = (((a0[10] == a0[13]) ? (v2 + v2) : (75 + v2)) < ((a1[2][14] >= v1) != (89 == v2)));
+        a0[10] = (((v2 == a0[6]) >= (v1 && a1[3][6])) <= ((a1[3][2] >= v0) != (v2 % 7)));
+        v0 = (((v0 >= v2) <= (v0 + a1[3][10])) / 3);
+    } else {
+        v0 = (((a0[4] && 16) % 9) - ((v1 != v0) == (a0[15] || a0[1])));
+        v1 = (((87 || v1) ? (7 >= a0[1]) : (86 ? a0[0] : v3)) + ((a0[8] <= v3) * (a1[2][14] >= a0[8])));
+        v1 = (((v3 >= v1) == (a1[0][8] == v1)) > ((v2 && 67) >= (v2 == v3)));
+    }
+    v3 = (((v0 && v1) % 5) ? ((65 == a1[0][14]) ? (v3 ? 86 : v3) : (a1[1][9] ? 80 : a1[0][0])) : ((95 || v2) || (v0 ? 41 : v0)));
+    return (((v0 >= 66) <= (39 ? 93 : v3)) * ((a1[0][9] / 3) && (v2 != 89)));
+}
+int f1() {
+    int v0 = 90;
+    int v1 = 68;
+    int v2 = 92;
+    int v3 = 70;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a0[7] = (((84 >= 15) < (a0[1] - 17)) * ((v2 % 4) ? (63 || v1) : (48 + v0)));
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                v0 = (((a0[15] == a1[1][5]) ? (83 % 2) : (i1 || i1)) / 4);
+                v3 = (((i1 < v3) > (99 - i1)) % 2);
+                v3 = (((11 <= 25) >= (a0[1] >= a0[6])) != ((a0[14] - v2) > (v0 % 1)));
+            }
+            v0 = (((v2 >= v3) % 5) <= ((v1 * v3) || (89 / 6)));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            v2 = (((40 > v3) >= (v3 > a0[12])) * ((v3 < v3) > (a1[3][8] - i2)));
+            v2 = (((36 || a0[0]) == (v2 - 21)) * ((a0[10] == a0[11]) != (v3 ? 8 : a1[0][5])));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                v1 = (((99 % 1) ? (v2 ? v1 : 11) : (v1 * v1)) >= ((a1[1][9] + i3) / 7));
+                v0 = (((49 != v2) ? (a0[3] > v0) : (26 || v3)) + ((50 || v0) || (v0 <= a1[2][6])));
+                v2 = (((a0[5] != i3) && (a0[2] || v0)) >= ((59 ? a1[3][5] : a0[9]) < (v2 >= 17)));
+            }
+            i2 = i2 + 1;
+        }
+    }
+    if ((((53 || v3) < (v1 >= v3)) <= ((53 == a1[1][8]) - (24 % 3)))) {
+        v2 = (((v2 != a1[2][12]) > (10 || a1[3][3])) > ((v0 ? v2 : a0[0]) || (v2 && v2)));
+        v1 = (((v1 * v3) >= (60 * v2)) ? ((45 == v1) / 8) : ((21 == v0) < (a1[0][13] >= v0)));
+        v2 = (((v1 && v2) > (v1 / 7)) < ((a1[2][1] / 8) - (a1[3][15] < v1)));
+    } else {
+        v0 = (((42 >= 34) > (v0 + v2)) ? ((v3 >= 82) <= (v3 <= v3)) : ((v0 - a0[7]) != (v3 > a0[13])));
+        v3 = (((v3 == a0[13]) > (v0 < a1[1][5])) || ((v0 || v1) % 1));
+        v2 = (((v0 == 7) == (a0[7] - 29)) > ((v2 == v3) ? (a0[4] || v2) : (85 <= v1)));
+    }
+    v2 = (((v1 != v3) / 2) * ((22 % 3) % 6));
+    for (int i4 = 0; i4 < 6; i4 = i4 + 1) {
+        if ((v3 != a1[0][7]) > 80) break;
+        v3 = (((v1 || v1) == (a0[5] <= 25)) || ((v2 ? v3 : a0[9]) > (v2 ? v1 : v0)));
+        {
+            int i5 = 0;
+            while (i5 < 3) {
+                if ((a0[5] - a1[2][13]) > 52) break;
+                a0[12] = (((i4 < i4) % 3) <= ((v0 || v2) * (i5 && i5)));
+                v0 = (((i5 || v0) > (12 ? v1 : v3)) % 4);
+                a1[2][11] = (((v1 && 31) > (a0[11] ? v2 : 54)) == ((6 || i4) >= (a0[5] == a0[8])));
+                i5 = i5 + 1;
+            }
+        }
+        a1[2][7] = (((a1[0][0] == v2) + (46 / 8)) || ((v2 >= a1[1][12]) <= (v2 ? v3 : a1[1][12])));
+    }
+    return (((v0 % 2) >= (a0[13] < a0[0])) / 7);
+}
+int f2() {
+    int v0 = 28;
+    int v1 = 3;
+    int v2 = 58;
+    int v3 = 7;
+    int a0[16];
+    int a1[4][16];
+    a1[2][12] = (((a1[2][12] % 8) - (a1[1][6] >= a0[10])) && ((v0 + 83) < (v0 || 35)));
+    {
+        int i0 = 0;
+        do {
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v2 = (((i1 == 31) ? (v3 - v3) : (i0 > i0)) * ((v2 ? v0 : a1[2][8]) + (a0[9] && a1[1][13])));
+                v0 = (((v2 * v1) - (a0[6] >= 62)) >= ((a0[10] == 5) - (41 ? a0[15] : 20)));
+                v1 = (((v2 / 6) ? (55 <= v2) : (a1[2][6] ? v0 : a1[2][12])) && ((a1[2][8] % 7) < (v1 ? a0[8] : a1[2][14])));
+            }
+            v2 = (((22 > v3) < (35 <= v3)) != ((v0 >= 17) % 8));
+            a1[3][15] = (((a1[3][3] - 61) / 2) > ((a1[2][3] - a0[5]) >= (v1 != 35)));
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v3 ? a0[8] : a0[9]) - (v0 != v1)) < ((v1 == 98) - (v0 * i2)));
+            v3 = (((a1[1][7] != v1) / 9) || ((i2 ? v2 : 98) * (68 <= 52)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v0 = (((a0[14] % 8) >= (75 != a1[1][8])) >= ((52 ? 14 : a1[2][6]) <= (v2 >= v0)));
+                a1[3][7] = (((v3 < a1[3][1]) * (a1[2][11] / 8)) < ((v0 % 2) + (v2 ? v0 : a1[3][13])));
+                v0 = (((v1 - i3) < (28 ? 32 : 25)) ? ((v3 || i3) ? (46 != 46) : (v0 > v0)) : ((33 != i2) - (v2 % 7)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((a0[5] % 2) / 5) <= ((v2 + v2) >= (v2 ? v2 : a1[3][9])))) {
+        v2 = (((a1[0][3] < v3) <= (a0[14] / 9)) - ((v2 >= v0) == (v1 && 24)));
+        v0 = (((a1[3][0] ? v0 : 13) ? (a0[4] ? a0[1] : v3) : (a1[3][7] * v1)) ? ((v0 || 50) * (a0[8] - v0)) : ((v2 - a1[3][8]) && (18 <= v3)));
+        v0 = (((v1 == 10) != (v2 < v2)) != ((v3 * 89) / 8));
+    } else {
+        v3 = (((a1[1][6] == v3) / 1) + ((a0[6] ? 71 : v1) - (a0[3] ? v2 : v2)));
+        v2 = (((v0 ? 88 : 34) + (41 ? v1 : 25)) != ((2 < 30) <= (v0 * v3)));
+        v1 = (((a1[0][12] > 18) >= (a1[1][15] + a0[3])) > ((54 % 7) == (54 || v2)));
+    }
+    a0[7] = (((65 ? a0[10] : 27) == (a0[11] <= v2)) && ((v3 ? a0[8] : a1[0][6]) < (74 || v3)));
+    return (((v2 / 6) || (v3 - a1[0][0])) + ((62 - a0[13]) || (a1[1][5] / 6)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,63 @@
+int f0() {
+    int v0 = 84;
+    int v1 = 52;
+    int v2 = 11;
+    int v3 = 9;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[5] > v0) > (v0 * v1)) % 8)) {
+        v2 = (((a1[1][1] % 8) <= (46 >= v0)) && ((a1[1][14] && a0[5]) / 5));
+        v1 = (((a0[3] > v0) > (10 ? v0 : a0[0])) <= ((a1[2][9] >= v1) >= (v1 >= 66)));
+        v2 = (((v1 != 67) <= (v1 > v0)) % 2);
+    } else {
+        v1 = (((0 % 2) != (a0[4] >= 33)) ? ((a0[14] ? v3 : v0) == (v3 && a1[1][10])) : ((25 >= v3) < (v0 == v3)));
+        v0 = (((a1[3][7] % 4) + (a1[1][0] - 18)) + ((v0 * v0) <= (a1[0][2] ? v2 : 2)));
+        a1[0][14] = (((a1[3][11] <= v0) != (a0[10] ? a0[5] : a1[3][13])) && ((v1 || v3) > (v0 <= 75)));
+    }
+    {
+        int i0 = 0;
+        do {
+            a1[3][9] = (((v1 * v1) / 6) / 3);
+            {
+                int i1 = 0;
+                do {
+                    a1[3][11] = (((16 <= i0) == (v2 / 1)) < ((v1 > a1[1][8]) ? (2 <= a0[11]) : (44 == 35)));
+                    v3 = (((i0 > 77) * (80 ? v1 : a1[0][2])) ? ((a0[5] && a1[2][13]) || (v2 && 1)) : ((i0 != v3) <= (87 && v0)));
+                    v3 = (((i1 || v1) && (a1[0][14] % 9)) * ((i0 ? 59 : a0[7]) && (a1[3][0] || a1[1][9])));
+                    i1 = i1 + 1;
+                } while (i1 < 8);
+            }
+            v0 = (((v1 == 93) == (24 && 16)) / 2);
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        a0[1] = (((v0 <= 35) / 5) - ((71 % 1) % 4));
+        for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+            v1 = (((v0 != a1[0][0]) != (v2 - i2)) <= ((15 != i2) > (i3 ? a1[3][6] : 93)));
+            a1[1][3] = (((a0[5] >= v1) && (41 + 80)) && ((v1 / 2) ? (a0[3] <= v0) : (v3 != v3)));
+            v0 = (((i2 <= 62) || (36 <= v2)) ? ((30 == i3) == (v2 <= a0[13])) : ((i3 % 4) + (v3 < 43)));
+        }
+        v3 = (((v2 == v2) <= (a0[14] % 9)) != ((52 != a1[2][12]) < (a1[2][10] == v3)));
+    }
+    v1 = (((v1 - 48) != (a1[3][15] == 48)) > ((v1 != v0) + (v0 < v3)));
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v0 = (((v3 >= v1) * (4 - 50)) ? ((v1 == v0) || (v0 == 3)) : ((a0[6] == a0[9]) + (37 != v2)));
+        {
+            int i5 = 0;
+            while (i5 < 7) {
+                v0 = (((78 == i4) >= (i4 / 1)) + ((v0 < 65) <= (a1[2][0] * a1[2][6])));
+                v2 = (((v0 * i5) / 7) >= ((a1[2][6] + i5) >= (81 - a1[0][0])));
+                v0 = (((v0 / 2) % 5) ? ((v2 != 27) || (a0[13] - a1[2][14])) : ((46 <= 20) / 5));
+                i5 = i5 + 1;
+            }
+        }
+        v1 = (((v0 >= 64) ? (25 > a1[0][0]) : (v0 <= 23)) <= ((36 || a1[3][12]) ? (a0[11] >= 67) : (v2 > a1[3][9])));
+    }
+    return (((a0[15] - a0[7]) < (v0 + 48)) / 7);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
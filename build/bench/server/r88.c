@@ -0,0 +1,149 @@
+int f0() {
+    int v0 = 71;
+    int v1 = 6;
+    int v2 = 4;
+    int v3 = 89;
+    int a0[16];
+    int a1[4][16];
+    if ((((50 < a0[11]) <= (61 > v2)) % 6)) {
+        v2 = (((a0[5] == 22) ? (v1 && v1) : (v1 % 9)) > ((v3 ? v2 : v1) != (a0[9] != v0)));
+        a1[2][0] = (((65 <= 18) % 5) / 8);
+        v3 = (((v0 && a0[1]) * (v1 / 4)) >= ((v0 % 9) ? (v2 || a1[1][12]) : (v1 * 12)));
+    } else {
+        v3 = (((v1 + 17) + (75 ? v1 : a1[2][15])) || ((52 + 24) < (a0[15] != a0[13])));
+        v2 = (((v0 != v1) == (16 != v3)) < ((v0 > a0[7]) ? (v3 + 20) : (84 + a0[6])));
+        v3 = (((v2 <= a0[5]) != (v2 * a1[1][4])) && ((v2 <= a1[1][13]) ? (v0 != v1) : (v3 >= v0)));
+    }
+    if ((((v1 || 70) && (37 / 5)) ? ((a1[0][6] <= v2) + (10 > v1)) : ((71 <= a1[3][11]) * (27 % 1)))) {
+        v2 = (((73 > v0) >= (97 < 39)) >= ((v2 % 4) == (v0 * v1)));
+        v3 = (((v0 && v0) || (v0 + a1[2][8])) * ((a0[2] >= v0) - (a1[1][15] > 96)));
+        v2 = (((a1[3][5] != v1) + (v3 > v3)) - ((a0[3] || a0[12]) > (v0 / 1)));
+    } else {
+        v0 = (((99 > a1[1][14]) >= (v0 > v2)) <= ((45 < a0[4]) < (a1[2][3] ? a1[1][13] : a1[1][2])));
+        v1 = (((v1 >= 38) + (v3 < a0[13])) >= ((12 < v0) == (77 / 1)));
+        a1[0][6] = (((99 < v3) != (a1[3][0] * v0)) < ((v2 != 69) != (61 || a0[12])));
+    }
+    a0[3] = (((v3 < v0) + (v0 ? v1 : v2)) <= ((90 && v1) && (v3 ? 75 : 81)));
+    {
+        int i0 = 0;
+        do {
+            a0[8] = (((v0 > 35) != (v1 * i0)) <= ((53 + i0) + (i0 ? a0[8] : i0)));
+            v1 = (((47 >= a0[15]) != (a0[10] / 9)) < ((i0 + a0[12]) / 4));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((v2 < 44) > 88) break;
+                    v3 = (((93 % 6) != (v3 ? v2 : v3)) && ((80 ? v1 : v3) || (v3 > 25)));
+                    a0[0] = (((i1 || i0) == (a0[4] + i1)) % 5);
+                    v2 = (((61 ? v0 : a0[13]) / 5) != ((73 == v3) * (a1[3][0] < 88)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((v2 ? v1 : v3) > 99) break;
+            {
+                int i3 = 0;
+                while (i3 < 4) {
+                    a0[7] = (((i3 < v3) < (v3 >= v1)) < ((15 || i3) > (a1[0][0] ? 79 : a0[11])));
+                    a1[0][4] = (((i3 > a0[9]) / 9) % 4);
+                    v1 = (((v1 != i3) || (v2 || i3)) + ((19 + i3) || (a0[8] && i2)));
+                    i3 = i3 + 1;
+                }
+            }
+            v2 = (((a1[3][13] >= v1) % 7) % 7);
+            a1[2][0] = (((64 && v3) == (a1[3][5] % 2)) - ((v3 || v3) < (v0 ? i2 : 27)));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((v3 ? v1 : v0) <= (99 == 60)) <= ((v0 || v1) < (v3 ? a0[6] : v2)));
+}
+int f1() {
+    int v0 = 86;
+    int v1 = 60;
+    int v2 = 40;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((v0 + v0) ? (a1[2][10] != a1[1][7]) : (39 > i0)) > ((i0 && 8) == (a0[14] * 61)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((87 >= 98) == (v2 >= v1)) + ((i1 && v3) > (a0[8] - v2)));
+                    v2 = (((a0[8] && a0[11]) % 5) < ((a0[6] - a0[11]) ? (32 + i0) : (a1[2][1] ? v1 : a0[9])));
+                    a1[0][14] = (((v0 ? a0[9] : v0) > (70 * v0)) < ((a1[3][4] + v0) / 1));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            a1[3][3] = (((a1[2][2] > 37) && (75 ? v0 : 11)) * ((45 + v2) || (v2 ? v3 : a1[1][13])));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[4] = (((80 != a0[3]) || (i2 / 9)) > ((v1 < a1[0][4]) ? (v3 == v0) : (67 + 65)));
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v0 = (((a0[6] * a0[7]) > (a0[7] <= v3)) ? ((a0[5] % 7) ? (29 ? v2 : v1) : (19 < 37)) : ((53 + a0[2]) * (60 <= 35)));
+                v3 = (((a1[1][5] >= i2) + (94 - a0[8])) < ((v1 >= v1) ? (58 <= v1) : (a0[2] <= 98)));
+                a1[0][3] = (((v3 <= v1) + (v0 > a0[3])) <= ((39 * v3) ? (i2 / 1) : (a0[1] % 5)));
+            }
+            v0 = (((8 || v1) || (a1[2][12] > a1[0][9])) - ((29 + i2) < (v3 && a1[0][11])));
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    for (int i4 = 0; i4 < 7; i4 = i4 + 1) {
+        v1 = (((a0[7] ? v0 : v2) + (41 ? v2 : v2)) % 4);
+        v2 = (((v1 == v3) > (i4 / 3)) ? ((v2 == v0) <= (a0[11] || v0)) : ((a0[2] <= v0) || (v3 - v0)));
+        {
+            int i5 = 0;
+            while (i5 < 2) {
+                a0[11] = (((v2 <= v0) <= (v0 <= v2)) == ((34 < 34) <= (i5 / 8)));
+                v2 = (((8 && i5) + (a0[11] <= 64)) * ((a0[1] || v2) >= (a0[11] != i4)));
+                v2 = (((v3 && i4) + (v0 || a1[3][6])) ? ((v2 && a1[1][1]) && (2 >= v3)) : ((63 >= 92) * (i5 > 95)));
+                i5 = i5 + 1;
+            }
+        }
+    }
+    {
+        int i6 = 0;
+        while (i6 < 8) {
+            if ((i6 + 4) > 97) break;
+            v3 = (((a1[3][14] >= a1[1][2]) > (1 > a0[15])) || ((a1[1][7] != a0[15]) - (a1[0][12] / 2)));
+            v3 = (((90 && a1[3][6]) != (v0 - v3)) ? ((86 ? v0 : v3) != (95 - a1[0][9])) : ((a0[7] - v3) % 1));
+            for (int i7 = 0; i7 < 4; i7 = i7 + 1) {
+                a0[14] = (((i6 >= v1) ? (57 ? v2 : a0[2]) : (v3 <= i7)) > ((v3 != a0[12]) > (a1[0][5] && v2)));
+                v1 = (((a1[3][11] - i7) == (i7 > v3)) && ((64 != a1[2][15]) + (a0[5] || i6)));
+                v1 = (((87 ? v1 : i6) == (48 - v2)) - ((a0[6] ? 87 : a1[3][13]) == (v0 >= a0[13])));
+            }
+            i6 = i6 + 1;
+        }
+    }
+    {
+        int i8 = 0;
+        do {
+            v3 = (((i8 >= v0) == (v0 != a0[6])) == ((v0 > i8) ? (a0[9] < v1) : (40 % 8)));
+            v3 = (((a0[4] - a1[3][5]) ? (68 ? i8 : v2) : (87 % 7)) - ((i8 < v2) % 5));
+            for (int i9 = 0; i9 < 5; i9 = i9 + 1) {
+                a0[8] = (((a0[1] * i8) + (i9 * 41)) || ((v1 ? 95 : v1) ? (i8 <= a0[2]) : (a0[3] < a0[0])));
+                v2 = (((i9 && a0[9]) - (32 <= v0)) + ((i8 % 5) / 1));
+                a1[3][4] = (((v3 > 73) ? (51 * v3) : (a0[9] - v1)) / 3);
+            }
+            i8 = i8 + 1;
+        } while (i8 < 2);
+    }
+    return (((35 - v1) == (v1 >= a0[1])) + ((33 + v0) - (a0[13] > 82)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
@@ -0,0 +1,182 @@
+int f0() {
+    int v0 = 79;
+    int v1 = 25;
+    int v2 = 70;
+    int v3 = 11;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v2 != v3) - (16 ? v1 : v1)) || ((v1 ? 84 : 75) == (v0 * v1)));
+    v3 = (((v2 ? v0 : a1[2][12]) % 4) >= ((v0 >= a0[3]) ? (v1 || a1[1][12]) : (v2 / 7)));
+    if ((((v2 > 95) % 4) / 5)) {
+        a0[6] = (((v3 - 63) ? (v3 <= a0[5]) : (a0[14] - v0)) - ((a1[1][1] / 2) / 4));
+        v0 = (((v1 < a1[1][8]) < (v3 ? a1[3][8] : 22)) - ((a0[2] == 7) != (v0 <= 61)));
+        v1 = (((v0 / 5) && (a1[0][10] ? v0 : a1[1][7])) < ((a0[11] ? a1[0][11] : a0[8]) > (v2 < a0[0])));
+    } else {
+        a1[3][7] = (((v3 > v1) >= (a1[2][2] ? v3 : a1[3][7])) > ((84 / 5) % 8));
+        a0[9] = (((v3 >= v2) + (v1 ? a0[2] : 9)) * ((26 < a1[0][11]) >= (59 / 8)));
+        v1 = (((v3 || 56) < (v1 == v2)) % 2);
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v1 = (((79 ? i0 : v1) && (i1 / 2)) % 3);
+                    v1 = (((a0[5] ? v2 : 14) > (i0 / 8)) - ((i1 / 8) || (i0 % 9)));
+                    a0[15] = (((v2 % 1) >= (65 - v1)) > ((a0[5] % 5) % 3));
+                    i1 = i1 + 1;
+                }
+            }
+            a1[2][11] = (((11 + v1) % 1) ? ((85 || v3) == (a0[11] && 49)) : ((i0 >= v2) <= (v2 != a0[10])));
+            v1 = (((v2 / 8) >= (a1[2][10] == 9)) || ((a0[8] && v3) == (29 && 35)));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v0 = (((v1 + 11) ? (v0 ? v3 : a0[0]) : (v1 == v1)) >= ((v1 + a1[3][4]) > (v1 > v1)));
+    return (((v3 + 12) + (v1 == v2)) + ((v2 * v3) > (v1 % 4)));
+}
+int f1() {
+    int v0 = 81;
+    int v1 = 34;
+    int v2 = 61;
+    int v3 = 21;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 2; i0 = i0 + 1) {
+        if ((v3 > 98) > 74) break;
+        a1[1][2] = (((v2 <= v3) < (v2 == v2)) || ((v0 + a1[3][2]) ? (i0 || 76) : (a1[1][15] && v0)));
+        {
+            int i1 = 0;
+            while (i1 < 4) {
+                v0 = (((v2 <= a1[3][8]) && (87 ? a0[8] : i1)) % 5);
+                v2 = (((a0[6] ? v3 : a0[0]) <= (a1[1][15] <= v1)) != ((v0 && a1[1][12]) < (v1 - v2)));
+                a1[3][3] = (((v2 && a1[3][13]) + (v3 + a0[3])) == ((i0 * a0[1]) != (v2 ? i0 : i1)));
+                i1 = i1 + 1;
+            }
+        }
+        v2 = (((i0 - 28) - (95 <= 29)) >= ((11 < 81) / 2));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v0 = (((v3 / 6) != (22 ? 97 : v2)) > ((a1[1][1] < 37) ? (v2 % 6) : (i2 / 8)));
+        v1 = (((v0 == v3) / 7) || ((v3 || v3) - (a0[14] >= 46)));
+        {
+            int i3 = 0;
+            do {
+                v2 = (((47 % 4) >= (94 == a1[1][8])) >= ((i3 && 62) / 7));
+                a1[3][3] = (((a1[0][1] / 3) / 8) ? ((v2 || 25) + (v3 && i3)) : ((i2 + v0) == (31 * a0[2])));
+                a0[12] = (((47 ? a1[2][4] : a0[13]) > (8 - 88)) ? ((i3 && v3) == (i2 / 2)) : ((a1[2][14] * a1[2][12]) * (a1[2][4] / 8)));
+                i3 = i3 + 1;
+            } while (i3 < 4);
+        }
+    }
+    if ((((a1[2][9] < v1) + (v1 ? v2 : 40)) > ((a0[2] ? v0 : 72) < (71 || a0[14])))) {
+        v2 = (((v1 > v3) >= (v2 + 58)) - ((10 > v0) > (92 - a1[0][1])));
+        a1[0][5] = (((72 == v3) == (a0[9] == 41)) < ((v0 <= v0) > (v2 * v0)));
+        v3 = (((v0 + a0[0]) > (40 + v3)) * ((39 ? 60 : 72) / 1));
+    } else {
+        a0[5] = (((82 && 78) || (v3 > v1)) < ((24 - a1[0][15]) % 2));
+        v3 = (((a1[1][5] <= 55) && (v2 <= 92)) > ((v3 <= v0) - (a0[9] && v1)));
+        v1 = (((v0 % 5) >= (a1[1][15] ? v0 : v1)) || ((v1 ? 40 : 78) % 2));
+    }
+    v3 = (((17 || 64) ? (v1 - v3) : (66 || v3)) == ((v3 ? v0 : v2) > (v3 % 8)));
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((i4 || 21) > 55) break;
+        a1[1][4] = (((v3 / 6) > (a0[3] != 19)) || ((i4 / 3) ? (a0[2] % 7) : (73 ? 29 : v3)));
+        v3 = (((v0 * a0[2]) - (v1 != a1[0][1])) + ((v2 < a0[8]) * (91 > a0[15])));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v2 = (((8 ? 80 : a1[0][3]) ? (a0[13] / 1) : (21 != i5)) || ((11 + i5) > (v2 == v1)));
+            v0 = (((a0[9] ? i4 : 81) || (v1 % 6)) >= ((v0 - v1) % 4));
+            v3 = (((a0[2] == a0[1]) % 5) <= ((v2 % 3) < (i5 < a0[2])));
+        }
+    }
+    return (((v2 && a0[12]) != (10 < v0)) % 6);
+}
+int f2() {
+    int v0 = 51;
+    int v1 = 53;
+    int v2 = 46;
+    int v3 = 57;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a0[10] == a0[2]) > 81) break;
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                if ((a0[3] > i0) > 98) break;
+                a0[5] = (((v3 + a0[7]) || (a0[0] <= v3)) % 1);
+                a0[5] = (((v2 - v1) > (i0 * v3)) ? ((a0[13] / 4) || (v0 % 3)) : ((v0 == i1) >= (i1 < v2)));
+                v1 = (((6 > i0) + (i0 >= a1[1][6])) - ((a1[2][0] >= a1[2][0]) && (i1 && a1[2][2])));
+            }
+            v0 = (((a0[11] - v2) == (68 * v0)) - ((v3 - a1[1][9]) / 8));
+            v0 = (((i0 * a0[8]) == (i0 % 1)) * ((v0 > v1) % 1));
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    {
+        int i2 = 0;
+        while (i2 < 2) {
+            if ((v3 ? a0[3] : v1) > 94) break;
+            {
+                int i3 = 0;
+                do {
+                    a0[12] = (((i2 % 7) / 6) || ((73 == i3) * (i2 < v0)));
+                    a1[2][9] = (((a1[0][14] < 66) && (v0 <= a0[1])) > ((48 && i3) ? (v1 >= a0[9]) : (41 >= 25)));
+                    v0 = (((v3 > a1[0][7]) - (a1[2][9] < v3)) - ((52 > i2) - (v1 * 54)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            v2 = (((a0[8] + a1[2][11]) / 7) % 4);
+            v1 = (((v3 || v3) ? (v1 <= i2) : (a0[5] ? 15 : v0)) * ((55 % 1) && (v0 + v0)));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 3; i4 = i4 + 1) {
+        v3 = (((v3 || 95) && (v3 > v0)) + ((v3 * a1[2][13]) < (88 <= v3)));
+        {
+            int i5 = 0;
+            do {
+                v1 = (((i4 * a1[0][2]) / 9) != ((3 && v3) * (a1[0][3] || v1)));
+                v1 = (((77 % 1) > (i4 <= 38)) != ((36 == i4) && (3 >= v1)));
+                v2 = (((a0[8] == i4) > (v1 >= i5)) < ((v2 > 2) * (v3 / 9)));
+                i5 = i5 + 1;
+            } while (i5 < 2);
+        }
+        a1[1][12] = (((v2 < 26) * (v3 ? a1[3][12] : a1[1][10])) - ((v0 - 63) * (v3 && v2)));
+    }
+    if ((((v0 - a0[5]) == (v1 < 60)) + ((v3 % 7) * (v3 + v3)))) {
+        v1 = (((58 == v1) > (v2 ? v3 : v2)) && ((29 <= a0[8]) * (v3 != v1)));
+        v1 = (((v1 >= v2) == (57 <= a0[1])) || ((v0 + v3) != (13 != v3)));
+        a0[3] = (((v3 * v1) + (v2 <= 89)) ? ((a0[10] == v2) < (a1[1][6] % 1)) : ((92 && v0) - (50 >= v0)));
+    } else {
+        a1[1][8] = (((15 ? v0 : 37) && (v0 ? v2 : v0)) % 7);
+        v0 = (((v3 ? v1 : 72) * (77 && 26)) + ((a0[4] || v3) <= (v2 && v3)));
+        v2 = (((v2 > v3) % 6) >= ((v1 % 3) != (v0 ? v1 : 89)));
+    }
+    {
+        int i6 = 0;
+        do {
+            {
+                int i7 = 0;
+                while (i7 < 4) {
+                    v0 = (((v2 * v3) != (v1 || v0)) ? ((v0 + i6) % 9) : ((v1 != v2) ? (v2 || i6) : (12 != v2)));
+                    v0 = (((v1 + v2) && (v3 != i7)) % 4);
+                    v1 = (((a1[3][2] > a1[1][15]) || (a0[15] > a0[12])) * ((a0[10] + v3) ? (v2 % 2) : (a1[2][15] * 33)));
+                    i7 = i7 + 1;
+                }
+            }
+            v0 = (((a1[2][6] != a1[2][15]) ? (v2 || a0[11]) : (v1 > v3)) > ((66 <= a1[3][13]) >= (42 ? 41 : v0)));
+            v2 = (((v1 ? v0 : i6) && (v1 ? a0[12] : v1)) + ((45 - a0[2]) <= (i6 ? a0[2] : i6)));
+            i6 = i6 + 1;
+        } while (i6 < 5);
+    }
+    return (((v3 % 1) ? (81 < 83) : (v0 >= a1[3][5])) / 9);
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,61 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 5;
+    int v2 = 32;
+    int v3 = 67;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((73 == v1) > 71) break;
+            v2 = (((60 > a1[2][13]) ? (i0 || i0) : (79 != 79)) <= ((a0[13] == v2) * (9 * a0[11])));
+            v0 = (((i0 > 34) && (v3 % 3)) * ((v1 / 1) ? (i0 && 5) : (a0[7] >= 9)));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((67 % 9) > 89) break;
+                    a0[14] = (((i0 > 64) || (a1[3][12] * v1)) < ((i1 - a1[1][0]) <= (i1 && 26)));
+                    v2 = (((v1 + v0) + (45 / 2)) * ((i0 * a0[0]) * (a1[0][4] || v2)));
+                    a1[0][5] = (((v1 / 8) + (a0[11] == a1[1][11])) >= ((a1[1][1] && v0) && (a0[5] + i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    {
+        int i2 = 0;
+        do {
+            a0[1] = (((a1[2][13] || a0[7]) == (v0 && a1[2][0])) != ((36 || i2) < (v1 * v3)));
+            a1[3][5] = (((v0 == a1[0][0]) <= (v1 > 7)) == ((a0[13] && v2) < (v1 / 2)));
+            for (int i3 = 0; i3 < 2; i3 = i3 + 1) {
+                v2 = (((a0[0] - 2) * (66 <= a0[0])) && ((i2 + 80) <= (i3 * a1[1][11])));
+                a1[0][11] = (((60 || a0[3]) - (v1 - a0[3])) * ((34 < 44) <= (90 + a1[3][8])));
+                v0 = (((a1[1][10] < 3) && (a0[10] % 4)) - ((i2 % 5) > (a1[3][7] > i3)));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 2);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 8) {
+            v2 = (((v3 * i4) >= (31 <= 51)) / 6);
+            for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+                v0 = (((74 != 41) - (53 <= i5)) || ((v1 < 56) >= (v0 >= v1)));
+                a0[1] = (((10 == 69) * (a1[0][8] != 3)) || ((97 != 13) > (i4 * v0)));
+                v0 = (((i4 != i4) <= (a1[0][1] != a0[7])) > ((i5 ? 74 : v3) || (v0 >= a0[13])));
+            }
+            v2 = (((v3 > 57) <= (v0 % 2)) || ((i4 && 23) % 7));
+            i4 = i4 + 1;
+        }
+    }
+    v2 = (((54 != v2) % 1) >= ((a0[10] || v1) == (v3 + a1[2][9])));
+    v3 = (((v3 && 15) >= (v1 >= a0[7])) + ((v0 || v3) && (19 || v0)));
+    return (((a0[2] >= a0[2]) < (24 && v1)) < ((a1[0][6] + v1) ? (a1[2][8] <= v1) : (14 ? 34 : 86)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
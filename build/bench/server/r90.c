@@ -0,0 +1,59 @@
+int f0() {
+    int v0 = 58;
+    int v1 = 62;
+    int v2 = 38;
+    int v3 = 94;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a1[3][14] = (((a0[12] >= a0[10]) < (16 + a1[2][4])) && ((i0 + v1) / 4));
+            v3 = (((83 ? v0 : v0) > (v0 / 9)) / 4);
+            {
+                int i1 = 0;
+                do {
+                    v0 = (((v1 + i0) ? (54 && v2) : (v1 < a0[10])) > ((i0 == v3) && (v3 ? 55 : v0)));
+                    v2 = (((v1 <= a0[7]) || (99 < a0[13])) && ((a1[2][1] * a0[8]) == (27 + v3)));
+                    v2 = (((a0[5] >= v2) ? (a0[5] >= a1[1][3]) : (v3 == 90)) < ((i1 <= 74) * (99 && a0[6])));
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    a0[12] = (((18 <= v1) + (a0[3] <= v2)) + ((17 == v3) == (a0[10] * a0[2])));
+    if ((((42 / 2) + (v0 ? v2 : a1[1][12])) && ((27 * v2) < (v3 < v3)))) {
+        v2 = (((8 > a1[2][4]) % 3) >= ((48 + 51) < (v1 + 84)));
+        a1[3][8] = (((a1[3][0] || v1) / 6) ? ((v1 * a1[1][6]) >= (94 < v0)) : ((98 != 91) ? (64 < 42) : (v0 - v2)));
+        v1 = (((v0 * v2) != (v0 ? a1[2][6] : 95)) >= ((v2 && a1[1][7]) ? (89 != 31) : (v2 != 48)));
+    } else {
+        v3 = (((v2 % 4) && (a1[2][3] < a0[2])) % 2);
+        v2 = (((v0 % 6) != (v0 / 8)) ? ((v0 ? a1[2][5] : v0) && (v3 % 7)) : ((v0 < v3) + (13 + v2)));
+        v1 = (((v2 != a0[4]) - (a1[0][12] + v0)) ? ((56 < v2) ? (v1 % 7) : (v0 % 3)) : ((v3 ? v0 : 38) < (v2 ? a0[4] : 41)));
+    }
+    if ((((99 != v2) - (v0 + 5)) < ((v0 - 45) <= (v3 ? v2 : 28)))) {
+        v3 = (((v3 / 3) >= (v1 - a0[1])) - ((39 || a1[0][0]) <= (a0[11] || v1)));
+        v3 = (((v1 || v2) ? (v0 + v2) : (v1 && 39)) && ((a1[1][8] + v2) > (a0[7] > v2)));
+        v3 = (((a0[1] <= a0[2]) && (a1[2][13] - v2)) && ((v1 + v3) <= (v2 == a1[2][13])));
+    } else {
+        a0[3] = (((a0[6] == v2) / 2) ? ((39 >= a0[12]) ? (a1[2][13] == v3) : (a1[1][1] ? v1 : 13)) : ((a1[1][15] || 94) == (60 < v0)));
+        v3 = (((v3 * v3) + (v0 % 1)) == ((10 != v0) / 6));
+        a1[2][4] = (((a1[2][11] < v0) + (a0[7] == v0)) * ((v2 * 49) * (64 - v0)));
+    }
+    if ((((a1[3][14] <= v0) < (27 == a0[2])) % 4)) {
+        v0 = (((v2 || v3) < (v1 / 5)) != ((v1 + a0[2]) != (a1[2][12] < a0[2])));
+        v0 = (((v3 || 66) / 9) < ((97 != v1) + (v2 > 1)));
+        a1[3][6] = (((a0[12] < v1) ? (57 && v3) : (v1 && v1)) + ((v3 < 61) / 4));
+    } else {
+        a1[0][3] = (((v3 % 7) ? (0 ? v0 : 21) : (a1[1][11] && v3)) != ((v3 > v2) > (v3 - a0[8])));
+        v0 = (((a1[3][5] >= v2) > (34 + a0[13])) + ((88 == a1[3][2]) >= (v0 ? v3 : a0[11])));
+        a1[1][5] = (((v2 ? a1[0][1] : 41) * (v2 + v0)) > ((a1[1][14] * v0) ? (95 ? a0[0] : 57) : (v1 >= v0)));
+    }
+    return (((a1[3][12] && 21) >= (a0[9] * v1)) < ((v2 == 59) || (v1 % 1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,126 @@
+int f0() {
+    int v0 = 70;
+    int v1 = 50;
+    int v2 = 35;
+    int v3 = 10;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[2][14] % 6) * (63 || v0)) != ((v1 > v1) != (95 && 60)));
+    {
+        int i0 = 0;
+        while (i0 < 4) {
+            if ((85 / 6) > 92) break;
+            v1 = (((v2 % 1) || (4 < 78)) + ((v0 >= 48) % 2));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    v2 = (((v3 == a1[2][11]) + (19 ? 60 : 54)) <= ((v3 || i0) ? (v3 != a1[1][0]) : (v1 * v2)));
+                    a0[10] = (((v0 && v1) > (v0 > v1)) == ((i0 != i1) > (v3 - 28)));
+                    a0[6] = (((89 * v1) + (v3 || 38)) == ((i0 ? 75 : 55) * (v3 + v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            v1 = (((v3 || v2) || (v1 < 16)) ? ((v0 < v0) || (a1[3][11] % 3)) : ((a1[1][9] <= v1) % 8));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 3) {
+            if ((v2 && a1[1][7]) > 80) break;
+            v0 = (((v3 ? 83 : i2) * (i2 < a0[1])) < ((v1 || a1[3][8]) <= (v0 + 42)));
+            {
+                int i3 = 0;
+                while (i3 < 2) {
+                    if ((11 % 8) > 80) break;
+                    a1[2][5] = (((v2 >= i2) <= (v3 * v3)) < ((a1[2][13] + 24) - (v0 <= v2)));
+                    v3 = (((v2 >= 80) / 4) && ((v2 + i3) != (a0[6] ? i2 : i2)));
+                    v2 = (((a0[11] < 43) * (19 > 72)) || ((a1[2][1] < v3) && (v2 <= 59)));
+                    i3 = i3 + 1;
+                }
+            }
+            v0 = (((a0[8] < v0) ? (v1 < a1[2][15]) : (68 || 81)) - ((v1 >= 66) * (v3 || a0[8])));
+            i2 = i2 + 1;
+        }
+    }
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        if ((v0 ? 98 : i4) > 52) break;
+        {
+            int i5 = 0;
+            do {
+                v0 = (((i5 > a1[0][10]) && (i4 + 6)) == ((67 * 69) <= (v1 == v0)));
+                v1 = (((99 || a0[5]) + (55 ? v1 : v0)) + ((v2 > a1[1][0]) && (v2 * 72)));
+                v2 = (((6 * i5) + (a0[8] && v3)) < ((a1[1][7] >= v1) % 8));
+                i5 = i5 + 1;
+            } while (i5 < 5);
+        }
+        v3 = (((i4 <= a0[2]) ? (a1[2][1] == v3) : (v3 % 3)) < ((v2 / 1) / 9));
+        a0[13] = (((a0[2] ? a1[2][5] : i4) < (i4 != 5)) < ((86 != a1[1][6]) * (57 % 8)));
+    }
+    if ((((v1 || v1) * (a0[0] == 55)) == ((v2 != v0) - (v3 / 1)))) {
+        a0[2] = (((a0[7] >= v1) > (25 <= v3)) / 9);
+        v3 = (((v2 && v1) ? (a0[12] != v1) : (v1 - 47)) ? ((v3 + 0) - (a1[3][0] / 1)) : ((v2 / 9) * (44 + 70)));
+        v1 = (((v1 || 86) % 4) ? ((v0 ? a0[15] : v0) * (v3 >= a0[1])) : ((92 < 37) != (a1[1][8] / 9)));
+    } else {
+        v3 = (((a0[15] != v3) ? (v0 ? a1[0][3] : a0[4]) : (v1 <= 8)) < ((a1[1][0] - v1) + (v1 + a1[1][15])));
+        v0 = (((v0 != v0) * (a0[15] < a1[2][1])) <= ((a1[2][6] + v0) + (v0 >= 96)));
+        a0[4] = (((a1[1][7] - v0) % 9) + ((v1 > v3) * (3 && 30)));
+    }
+    return (((96 >= v0) < (v3 * v3)) <= ((25 - v0) || (a1[3][8] >= a1[3][5])));
+}
+int f1() {
+    int v0 = 41;
+    int v1 = 16;
+    int v2 = 34;
+    int v3 = 53;
+    int a0[16];
+    int a1[4][16];
+    for (int i0 = 0; i0 < 8; i0 = i0 + 1) {
+        {
+            int i1 = 0;
+            do {
+                v3 = (((v0 ? 6 : v2) || (16 * v1)) * ((a0[8] - v0) > (i1 ? v1 : 18)));
+                a0[11] = (((3 < v0) ? (87 || a0[2]) : (56 / 7)) != ((i0 ? v2 : 68) + (v3 - a1[2][12])));
+                v3 = (((48 - v0) ? (v1 != v3) : (a1[2][9] ? 9 : 62)) * ((v2 ? 12 : i0) > (82 == 54)));
+                i1 = i1 + 1;
+            } while (i1 < 6);
+        }
+        a1[3][1] = (((36 / 5) == (v3 / 2)) + ((v3 >= 91) > (a1[0][5] % 7)));
+        a1[2][1] = (((84 > v1) * (v3 == a1[1][8])) + ((v1 > 91) / 7));
+    }
+    if ((((a1[2][14] - v1) >= (v0 / 9)) || ((a0[7] ? v1 : v2) != (v3 || v3)))) {
+        v2 = (((80 ? v0 : v2) != (v2 > 98)) && ((a0[2] > a1[0][4]) ? (v2 + 97) : (a0[8] ? 21 : a0[15])));
+        v0 = (((80 ? a1[2][15] : 88) != (a0[14] + v2)) <= ((a1[1][10] ? v1 : 22) - (v3 == v3)));
+        v3 = (((v3 ? 76 : 69) <= (v2 == 71)) % 8);
+    } else {
+        a1[0][12] = (((v0 + v0) ? (a1[1][15] ? 71 : a1[0][6]) : (a0[12] < v1)) == ((a0[9] * v3) == (v3 % 7)));
+        v3 = (((5 < a0[14]) ? (78 < 34) : (31 + a0[14])) ? ((56 != v2) && (a0[0] || v2)) : ((v3 < v3) || (v2 != a0[5])));
+        a0[4] = (((v3 > 56) != (v3 % 1)) / 6);
+    }
+    v1 = (((51 > v1) - (v1 * v1)) - ((88 == 0) && (a0[4] * a1[1][11])));
+    {
+        int i2 = 0;
+        while (i2 < 8) {
+            a0[14] = (((v3 ? 83 : a1[2][15]) ? (v0 % 9) : (65 / 9)) != ((v1 <= v0) <= (a0[7] ? a0[2] : 83)));
+            a0[0] = (((2 - 1) % 3) < ((v3 >= v0) != (v3 == 98)));
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((a0[15] == v3) ? (19 != v0) : (a1[3][6] + 26)) != ((i2 * v2) < (a1[1][10] > a1[1][7])));
+                    v0 = (((72 >= a0[13]) ? (v1 && v2) : (69 ? 78 : 91)) - ((v1 + 15) <= (a0[1] / 2)));
+                    v0 = (((40 <= v3) == (a1[0][3] && v0)) != ((i3 + i3) + (v0 - 44)));
+                    i3 = i3 + 1;
+                } while (i3 < 5);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    v3 = (((v2 % 2) && (v2 - v0)) < ((v2 > a1[0][8]) - (13 ? v1 : 7)));
+    return (((53 > a0[8]) != (v0 && 9)) != ((v3 != 99) * (a1[1][2] && 44)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
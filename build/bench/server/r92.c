@@ -0,0 +1,178 @@
+int f0() {
+    int v0 = 37;
+    int v1 = 99;
+    int v2 = 60;
+    int v3 = 36;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v1 ? v2 : 21) ? (v1 / 1) : (a0[4] >= v1)) <= ((a1[2][14] % 8) < (a0[3] * v2)));
+    a0[7] = (((v1 < 53) || (a0[7] == v1)) > ((27 ? v2 : v3) < (v0 == v1)));
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v0 = (((v3 % 9) == (v1 != a0[10])) / 6);
+                    a1[0][5] = (((1 != v3) ? (i1 && v0) : (a0[15] && a0[6])) + ((v3 ? a1[3][8] : v2) ? (a0[13] / 8) : (v2 >= 30)));
+                    a0[15] = (((79 ? i0 : v1) % 6) < ((76 - a0[11]) * (52 ? i1 : i0)));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((v0 - a1[2][15]) * (49 ? 63 : v3)) - ((a1[3][5] > a0[11]) > (a0[15] / 4)));
+            v2 = (((v2 <= 55) ? (i0 <= v1) : (41 >= v0)) && ((v2 >= v1) + (i0 ? a1[1][10] : v2)));
+            i0 = i0 + 1;
+        } while (i0 < 4);
+    }
+    v1 = (((a1[0][7] || v1) ? (v3 ? 38 : 49) : (a1[3][13] + a0[15])) <= ((v3 < v2) % 6));
+    if ((((75 * 18) > (v0 + v1)) % 2)) {
+        a1[2][7] = (((v2 - 74) ? (v3 == a0[12]) : (7 + 3)) ? ((v0 + v1) < (v3 % 9)) : ((v1 * v0) % 2));
+        v0 = (((v0 > v1) / 5) - ((v3 % 9) * (a0[13] >= 42)));
+        a0[11] = (((v2 < 98) != (v0 + v1)) - ((a1[1][4] >= v2) ? (5 ? a1[3][6] : 52) : (v0 / 5)));
+    } else {
+        v3 = (((v3 ? 77 : a0[13]) ? (v0 * 39) : (v1 || 75)) % 9);
+        v0 = (((a1[2][5] < v1) - (a0[5] == 24)) <= ((93 || v0) || (57 ? v1 : 37)));
+        v3 = (((a0[8] / 2) && (78 / 9)) % 1);
+    }
+    return (((49 % 4) ? (v2 <= 6) : (52 || v3)) + ((84 < v2) * (43 && 91)));
+}
+int f1() {
+    int v0 = 69;
+    int v1 = 89;
+    int v2 = 32;
+    int v3 = 91;
+    int a0[16];
+    int a1[4][16];
+    if ((((42 % 2) ? (11 - a1[2][9]) : (48 < v3)) != ((a0[15] != a1[3][11]) / 7))) {
+        v2 = (((v3 < a1[2][4]) <= (v2 < 92)) && ((v1 >= 36) * (a1[1][8] || v0)));
+        v0 = (((v3 * 81) / 7) <= ((v2 - v1) + (a0[7] / 5)));
+        v3 = (((v2 <= a0[15]) <= (v2 * 32)) && ((v1 != v1) + (34 != v0)));
+    } else {
+        v3 = (((v3 + v2) % 3) == ((v0 >= v1) % 5));
+        v1 = (((v2 * a1[2][9]) * (v3 + a0[0])) % 1);
+        v0 = (((v2 || 15) ? (v0 > v3) : (a0[7] == a1[2][7])) % 7);
+    }
+    {
+        int i0 = 0;
+        do {
+            a0[10] = (((15 / 4) != (v0 >= a1[1][11])) > ((v0 % 5) == (20 % 1)));
+            v3 = (((a1[3][0] != i0) < (59 && 20)) < ((60 / 6) / 6));
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    v3 = (((a0[12] - a0[8]) < (49 % 5)) <= ((89 >= i0) >= (69 ? 81 : a0[9])));
+                    v3 = (((i1 % 5) <= (v1 == v0)) ? ((a0[5] ? i0 : 8) % 4) : ((v1 > v3) == (v0 ? v1 : 36)));
+                    a0[6] = (((0 ? a0[15] : 68) - (7 != a1[2][15])) % 1);
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    if ((((v1 == v1) == (92 / 2)) ? ((a0[0] ? 22 : a1[0][1]) / 9) : ((v2 != a0[9]) * (v0 * v1)))) {
+        v1 = (((a1[1][4] + v3) / 3) / 1);
+        v1 = (((10 >= 65) % 3) == ((v1 <= v2) ? (v2 % 7) : (v3 - v3)));
+        v3 = (((67 - v1) * (a0[6] <= a0[14])) || ((v1 ? a1[3][10] : v3) < (v1 + a0[7])));
+    } else {
+        v0 = (((v0 != v3) == (a0[13] == a1[2][15])) ? ((v0 <= v3) && (21 - 51)) : ((v3 % 2) - (v2 + a0[14])));
+        v3 = (((a1[2][14] / 4) > (v2 || v0)) >= ((v0 == 92) || (v1 * v0)));
+        a0[0] = (((68 <= v0) >= (v3 % 3)) || ((v1 - v3) <= (a1[3][2] >= v2)));
+    }
+    {
+        int i2 = 0;
+        do {
+            v1 = (((89 * v1) * (v2 ? i2 : v2)) > ((i2 == a0[9]) && (i2 ? v1 : v1)));
+            v1 = (((v2 + 75) - (18 / 5)) ? ((v3 + 94) < (61 || v2)) : ((v3 * i2) % 9));
+            for (int i3 = 0; i3 < 7; i3 = i3 + 1) {
+                if ((43 < i2) > 76) break;
+                v0 = (((v2 ? 55 : v3) != (a1[1][5] <= 24)) != ((27 || v0) != (v1 ? 34 : v3)));
+                v0 = (((72 > v3) <= (a0[15] % 6)) % 7);
+                v0 = (((v3 % 1) < (i3 / 3)) ? ((v0 ? 37 : 56) + (a0[5] < v0)) : ((58 <= a1[1][2]) ? (20 > a0[12]) : (i3 + a1[3][15])));
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    if ((((1 > a1[2][12]) - (a1[1][12] != 62)) <= ((v1 * a0[5]) / 7))) {
+        v3 = (((v2 % 2) >= (v3 ? 89 : a1[2][13])) - ((v2 ? a0[11] : v2) - (a1[3][3] ? v2 : a1[1][11])));
+        v0 = (((47 * v0) ? (a0[5] / 6) : (59 - 81)) * ((a1[3][10] >= v3) && (40 == a0[4])));
+        v1 = (((a1[2][14] > v3) / 9) / 8);
+    } else {
+        a0[12] = (((a0[4] - 12) * (a0[9] / 7)) && ((a1[2][8] <= v1) != (a1[3][7] / 1)));
+        v0 = (((v2 != v2) / 9) - ((a0[4] || a0[9]) >= (v3 < v2)));
+        v3 = (((v2 < a1[2][1]) * (v1 && 88)) / 1);
+    }
+    return (((v3 ? v3 : 73) / 8) >= ((v0 == v3) + (62 - v0)));
+}
+int f2() {
+    int v0 = 24;
+    int v1 = 16;
+    int v2 = 11;
+    int v3 = 69;
+    int a0[16];
+    int a1[4][16];
+    if ((((a0[13] == a1[1][15]) != (v1 / 5)) % 6)) {
+        a1[1][5] = (((a1[3][4] < a1[2][5]) ? (v3 ? v3 : 59) : (v0 || 91)) / 5);
+        a1[3][5] = (((a0[10] <= a1[2][9]) >= (a1[0][0] == 75)) || ((v2 && a0[6]) % 4));
+        v2 = (((9 % 2) || (a0[0] || 79)) ? ((18 ? a0[5] : 13) == (v1 ? 57 : a1[3][4])) : ((a0[14] < v1) != (v3 + 67)));
+    } else {
+        a1[2][0] = (((v2 - v3) * (v1 / 7)) + ((50 * a1[0][7]) ? (50 + a0[6]) : (v2 + v0)));
+        a1[1][14] = (((v0 + v3) <= (v0 < v2)) - ((v1 / 8) != (a0[10] ? v2 : a1[0][1])));
+        v3 = (((v0 ? v1 : v1) != (v0 >= 0)) - ((v2 || 45) * (v2 / 2)));
+    }
+    {
+        int i0 = 0;
+        do {
+            {
+                int i1 = 0;
+                while (i1 < 2) {
+                    v2 = (((v3 < v1) + (v0 >= 28)) * ((v2 || v3) / 6));
+                    a1[0][14] = (((v3 * 85) / 9) < ((a0[2] / 2) % 5));
+                    v2 = (((v1 / 2) - (v2 >= 82)) >= ((i1 || a0[6]) / 3));
+                    i1 = i1 + 1;
+                }
+            }
+            v2 = (((88 ? 72 : v0) == (34 * v2)) || ((a0[7] > a0[12]) >= (a1[2][9] || 39)));
+            a0[9] = (((i0 / 1) >= (80 + a0[4])) ? ((v2 - 11) + (a0[11] || a0[3])) : ((68 <= a1[3][10]) < (v0 - a0[8])));
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    if ((((v3 % 5) && (a1[2][6] == 31)) % 6)) {
+        a0[4] = (((a0[11] ? 6 : v3) || (a1[1][6] || a0[14])) < ((v3 != 42) || (v1 ? v3 : 56)));
+        a0[5] = (((v3 < a0[4]) <= (a0[1] + 63)) % 9);
+        v1 = (((v0 + a0[10]) || (v3 * 10)) > ((v1 - 34) == (29 ? a1[3][15] : a0[10])));
+    } else {
+        v0 = (((v0 * a0[8]) != (a0[15] == v2)) ? ((v2 % 1) == (25 || a0[13])) : ((v0 <= v3) > (73 * a1[1][9])));
+        v3 = (((a0[6] && 50) * (v1 && a0[13])) < ((a1[2][5] % 5) == (v0 <= 26)));
+        a1[2][13] = (((31 != 58) <= (75 == a0[12])) % 2);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 6; i3 = i3 + 1) {
+                v3 = (((i2 > 63) > (i3 ? 4 : v3)) - ((70 * a0[9]) == (v1 ? 1 : a1[2][12])));
+                a1[3][12] = (((v1 ? a1[0][8] : a0[5]) + (88 % 4)) == ((v3 ? a1[0][8] : a1[1][0]) % 1));
+                v1 = (((v3 * v0) == (v3 >= i3)) + ((54 ? v1 : v3) ? (a1[2][3] > a1[1][4]) : (a1[2][0] % 8)));
+            }
+            a1[3][14] = (((a0[10] + 8) == (i2 * a1[0][7])) % 3);
+            v1 = (((99 && v1) + (v1 % 8)) % 6);
+            i2 = i2 + 1;
+        } while (i2 < 5);
+    }
+    if ((((v0 * v0) <= (36 < a1[0][11])) == ((v1 || v1) ? (12 == v2) : (v0 <= 15)))) {
+        a0[5] = (((v3 < v1) == (44 && 1)) ? ((v1 == v2) < (a1[3][1] || 15)) : ((v2 % 3) >= (76 ? 9 : v2)));
+        a0[8] = (((a1[3][12] == v1) || (84 * v1)) ? ((a1[3][15] / 3) * (v2 == v0)) : ((27 ? a1[2][9] : 9) > (a0[10] || a0[7])));
+        a1[3][5] = (((v3 % 1) - (v0 || v3)) || ((a0[0] >= a1[1][15]) % 4));
+    } else {
+        v0 = (((a0[1] ? 6 : v2) < (v1 % 9)) || ((a1[0][2] % 9) >= (78 && 66)));
+        v0 = (((a0[9] <= 36) * (v2 * v0)) ? ((v0 > v1) ? (a0[11] != v0) : (v0 ? 20 : v3)) : ((v1 != a1[2][14]) ? (v2 != v2) : (v3 >= 45)));
+        a0[9] = (((18 * 98) % 5) || ((a1[0][3] * v1) || (v1 * a0[2])));
+    }
+    return (((v0 ? a1[3][2] : 4) != (v0 == v1)) || ((v1 && a0[0]) && (a0[5] != v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
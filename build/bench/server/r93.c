@@ -0,0 +1,60 @@
+int f0() {
+    int v0 = 27;
+    int v1 = 98;
+    int v2 = 72;
+    int v3 = 33;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((91 - 96) >= (v0 ? v1 : v2)) > ((0 ? 27 : v3) * (v1 > v2)));
+    if ((((v1 || v0) / 9) == ((18 ? a0[11] : a1[3][13]) > (a0[15] * v3)))) {
+        a1[0][7] = (((v0 && v2) / 5) ? ((v3 == v3) == (a1[1][8] && a1[0][7])) : ((v2 * v2) == (75 || a1[0][4])));
+        v1 = (((v1 - v2) >= (a0[13] >= 40)) ? ((v3 * v3) % 4) : ((v0 && v3) == (v3 + 95)));
+        a1[1][3] = (((98 + v3) && (v2 % 9)) * ((94 == v0) <= (7 + v1)));
+    } else {
+        v1 = (((19 * 32) > (v2 / 5)) - ((a0[8] > v0) / 1));
+        a0[2] = (((a1[0][3] * v3) != (42 == v2)) - ((v0 && v3) / 3));
+        v3 = (((a1[1][1] ? 87 : v0) / 1) - ((v3 == v1) > (v2 > 9)));
+    }
+    {
+        int i0 = 0;
+        while (i0 < 3) {
+            {
+                int i1 = 0;
+                do {
+                    a1[0][10] = (((v0 || v2) && (i0 || i1)) + ((a0[0] / 9) / 6));
+                    v2 = (((i0 && i1) < (a0[15] % 9)) / 7);
+                    a0[1] = (((7 % 6) <= (v3 + 12)) % 9);
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            v3 = (((16 % 7) - (i0 * 82)) - ((46 ? v0 : 43) != (a0[10] / 3)));
+            a1[0][6] = (((v0 > a1[1][11]) - (81 ? v1 : i0)) + ((v1 != 17) && (18 == v1)));
+            i0 = i0 + 1;
+        }
+    }
+    v3 = (((v0 / 4) < (64 >= v1)) * ((v0 * v1) * (v1 < a1[1][2])));
+    {
+        int i2 = 0;
+        do {
+            v2 = (((v3 && 70) >= (a0[5] <= v1)) / 5);
+            v2 = (((88 < v3) <= (93 || v2)) > ((v1 == i2) % 2));
+            {
+                int i3 = 0;
+                while (i3 < 5) {
+                    if ((55 == i2) > 84) break;
+                    v3 = (((v2 ? i2 : 59) != (v2 % 9)) * ((v0 > v0) ? (v0 || v2) : (5 < v2)));
+                    a0[10] = (((i2 * a1[2][8]) == (i2 % 1)) > ((a1[3][11] ? a1[2][5] : v1) < (v1 == 94)));
+                    v3 = (((4 && a1[2][12]) % 3) < ((a1[0][11] >= 33) * (51 <= i3)));
+                    i3 = i3 + 1;
+                }
+            }
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    return (((50 <= a0[3]) || (53 - v3)) >= ((v1 + v2) || (v3 < a1[3][10])));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,140 @@
+int f0() {
+    int v0 = 10;
+    int v1 = 17;
+    int v2 = 3;
+    int v3 = 30;
+    int a0[16];
+    int a1[4][16];
+    if ((((v2 == 35) <= (v0 - 75)) && ((v2 * v3) < (81 / 6)))) {
+        v3 = (((v0 || v2) / 1) && ((35 + v3) > (v2 / 5)));
+        v1 = (((a1[3][13] && 8) != (v3 || a1[1][4])) && ((a1[0][1] ? v0 : v2) ? (v1 && v0) : (48 >= 87)));
+        a1[1][6] = (((a0[3] - a0[9]) * (v1 != v0)) ? ((v2 * 39) - (v2 || 49)) : ((v0 + a0[15]) <= (v0 > v1)));
+    } else {
+        v3 = (((v3 || v0) == (v3 > 20)) != ((50 > 84) >= (20 + a1[1][14])));
+        v3 = (((v2 / 7) == (v2 || a1[1][14])) >= ((38 / 1) < (v0 ? v0 : v2)));
+        v1 = (((90 == v3) >= (v0 / 9)) / 5);
+    }
+    {
+        int i0 = 0;
+        while (i0 < 5) {
+            {
+                int i1 = 0;
+                while (i1 < 3) {
+                    if ((v1 / 6) > 78) break;
+                    a1[1][15] = (((i0 * 73) || (v0 < i0)) != ((82 != v0) == (v2 == 9)));
+                    v3 = (((i1 && a1[2][1]) % 1) != ((50 != v3) >= (v0 >= i1)));
+                    v1 = (((a1[3][14] >= 33) >= (0 != a1[2][15])) / 3);
+                    i1 = i1 + 1;
+                }
+            }
+            a0[2] = (((a0[8] >= v1) ? (a1[1][8] == v1) : (i0 && v3)) <= ((v2 * v2) >= (i0 == 1)));
+            v1 = (((v2 + i0) == (11 - i0)) == ((v2 >= v0) && (i0 || a1[1][11])));
+            i0 = i0 + 1;
+        }
+    }
+    if ((((v2 == a0[15]) ? (v3 ? v2 : a0[11]) : (v3 - v0)) + ((69 * a1[0][2]) ? (v1 <= 3) : (66 && 87)))) {
+        v2 = (((a0[3] < v0) != (v2 + 46)) + ((v3 % 5) || (21 <= 52)));
+        a1[2][5] = (((a0[0] ? v1 : v3) && (v3 % 6)) < ((79 >= a1[0][10]) > (v1 && 92)));
+        a1[2][3] = (((v3 <= v1) || (v0 > 71)) % 6);
+    } else {
+        v3 = (((a0[14] ? v0 : 1) ? (v3 * v1) : (v0 + a1[0][9])) >= ((v2 && 83) ? (v2 ? a1[0][5] : a1[1][12]) : (79 * 85)));
+        v0 = (((v0 - v2) == (v1 ? v1 : a1[0][7])) / 7);
+        a1[0][14] = (((v1 % 6) % 5) <= ((a1[2][3] && a0[14]) < (v1 ? v1 : a1[2][2])));
+    }
+    if ((((v0 <= v0) < (0 ? a1[1][2] : v0)) == ((78 + v2) / 4))) {
+        v2 = (((v3 || a0[12]) - (38 == 19)) || ((v3 - v2) == (a1[2][2] * v3)));
+        v1 = (((v2 == a1[0][1]) / 4) >= ((v3 / 2) + (14 == a0[5])));
+        v3 = (((v1 >= a1[1][9]) ? (v3 * 93) : (v1 ? v1 : v1)) || ((v3 % 4) % 6));
+    } else {
+        a1[2][3] = (((v3 != v0) * (v1 != 44)) == ((60 >= v1) < (a0[14] >= v2)));
+        v2 = (((v1 ? v2 : v3) ? (a1[0][0] >= a1[1][6]) : (v3 < a0[8])) < ((70 && 68) * (40 ? 83 : v3)));
+        a0[14] = (((58 <= v1) < (20 && a0[3])) < ((v3 ? v3 : a0[8]) % 9));
+    }
+    for (int i2 = 0; i2 < 6; i2 = i2 + 1) {
+        v3 = (((62 <= v2) || (v1 > i2)) % 2);
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            v3 = (((a1[2][14] && a1[2][1]) || (v2 == 15)) >= ((i2 && a1[2][11]) * (i3 <= i2)));
+            v3 = (((v2 > i3) + (74 <= i2)) ? ((28 > a0[3]) ? (a0[6] * a0[12]) : (v2 == a1[1][12])) : ((39 + 83) == (v3 * i2)));
+            v2 = (((69 ? v0 : v2) < (a1[1][2] <= i2)) <= ((57 && v3) - (63 > a1[3][6])));
+        }
+        v1 = (((i2 && 23) || (v2 ? 33 : a0[7])) < ((v2 == 3) ? (v3 != a1[1][9]) : (11 ? a1[2][0] : a1[1][3])));
+    }
+    return (((a1[3][5] * a1[3][0]) <= (v1 < v0)) >= ((v3 > v2) + (31 * v2)));
+}
+int f1() {
+    int v0 = 43;
+    int v1 = 51;
+    int v2 = 85;
+    int v3 = 93;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 7) {
+            a1[1][3] = (((i0 > 8) <= (i0 - i0)) * ((a0[6] + 83) ? (v2 ? v3 : v3) : (v0 <= a0[4])));
+            v2 = (((v1 - v0) < (a0[8] % 8)) < ((a0[13] > 1) + (i0 && v3)));
+            {
+                int i1 = 0;
+                do {
+                    v1 = (((i1 ? 38 : v2) ? (6 ? 14 : v2) : (31 / 9)) && ((a0[1] < a0[15]) != (66 != a0[2])));
+                    v1 = (((i0 >= v3) * (a0[6] <= 49)) ? ((4 != a0[2]) <= (i1 % 6)) : ((v0 < i1) / 5));
+                    v3 = (((17 ? v2 : i0) < (i1 != a0[4])) + ((a0[9] % 2) != (36 && 98)));
+                    i1 = i1 + 1;
+                } while (i1 < 5);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    if ((((44 > 95) && (a1[3][9] <= a1[2][6])) + ((v2 >= v3) && (79 ? 48 : a0[7])))) {
+        a0[15] = (((a1[1][11] || v2) != (v1 == a1[0][10])) / 7);
+        a0[2] = (((v2 - v0) || (a1[1][8] <= 31)) ? ((a1[2][0] / 1) != (v3 > a1[1][13])) : ((v0 > a1[1][8]) >= (v1 - v0)));
+        v3 = (((a1[3][1] ? v3 : v1) != (v2 ? a1[2][11] : 97)) <= ((v1 % 2) && (v2 * v2)));
+    } else {
+        v3 = (((v2 + 0) != (v1 % 1)) || ((v0 + v0) % 6));
+        v0 = (((v1 % 4) > (v3 < 10)) + ((42 ? 20 : v3) ? (v3 > v2) : (85 <= v3)));
+        a1[0][7] = (((a1[0][10] != a0[5]) != (v0 ? a1[1][9] : v1)) <= ((a0[15] >= 15) < (v0 >= v3)));
+    }
+    if ((((1 && 86) <= (v2 ? v0 : v1)) <= ((a0[13] > 68) && (a0[2] / 5)))) {
+        v1 = (((a0[3] ? v2 : v2) ? (a1[2][0] + v2) : (16 - a1[2][3])) * ((18 <= v1) != (v3 >= 23)));
+        a1[0][3] = (((23 ? 1 : v2) + (v2 || 37)) >= ((v1 ? a0[6] : 54) > (v1 && 65)));
+        v1 = (((0 < v0) ? (v0 == v0) : (v0 && 89)) / 6);
+    } else {
+        a1[3][15] = (((a1[1][14] ? v0 : v1) % 1) - ((v0 + 92) >= (v0 * v2)));
+        v2 = (((v0 ? 95 : a0[14]) == (4 % 2)) < ((32 < 21) || (v1 < a0[10])));
+        v0 = (((a0[5] - v0) - (v0 != v0)) ? ((a0[12] < v3) && (v0 - a0[1])) : ((a1[3][14] != 84) ? (v0 ? v1 : 98) : (v2 >= v1)));
+    }
+    {
+        int i2 = 0;
+        do {
+            if ((28 * v0) > 96) break;
+            {
+                int i3 = 0;
+                do {
+                    a0[2] = (((77 ? v2 : i2) * (a0[9] < a0[12])) < ((a1[2][0] || v1) || (a0[1] == 47)));
+                    v1 = (((v2 / 4) + (v2 <= 58)) - ((22 <= a0[11]) % 1));
+                    a0[2] = (((34 > i3) > (v2 > 18)) - ((v1 <= i3) ? (a0[1] || i3) : (v0 == 4)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            a1[1][8] = (((v2 + 14) ? (i2 || a1[1][7]) : (49 ? 49 : a1[3][6])) || ((v1 ? v3 : v3) > (i2 >= i2)));
+            v1 = (((2 ? 61 : a1[0][13]) && (a0[1] && v1)) < ((27 > v3) ? (a0[10] - 56) : (v0 + a0[12])));
+            i2 = i2 + 1;
+        } while (i2 < 7);
+    }
+    for (int i4 = 0; i4 < 2; i4 = i4 + 1) {
+        for (int i5 = 0; i5 < 6; i5 = i5 + 1) {
+            v2 = (((v2 - v1) - (1 > a0[12])) - ((a1[3][6] - v1) && (97 * 67)));
+            v0 = (((v3 / 6) * (v0 != v0)) - ((82 > a0[15]) % 4));
+            v3 = (((54 * 92) && (v0 * i4)) == ((v1 || a0[5]) <= (i5 != v1)));
+        }
+        v0 = (((v3 < v3) || (94 >= a0[9])) <= ((a1[3][2] ? a1[2][7] : v0) || (v0 - i4)));
+        v2 = (((i4 + 81) / 9) * ((i4 ? 59 : 79) % 3));
+    }
+    return (((v3 + 75) < (v3 || v1)) ? ((53 != v0) > (v3 && v0)) : ((v1 * 18) > (v3 % 4)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
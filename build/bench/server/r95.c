@@ -0,0 +1,115 @@
+int f0() {
+    int v0 = 72;
+    int v1 = 42;
+    int v2 = 18;
+    int v3 = 16;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v0 = (((a0[2] <= 8) || (a0[3] - a1[3][1])) % 7);
+            for (int i1 = 0; i1 < 5; i1 = i1 + 1) {
+                if ((4 && 13) > 51) break;
+                v3 = (((i0 || v0) <= (a0[4] == v1)) + ((i0 + v1) && (19 + v3)));
+                a0[11] = (((a0[7] >= v3) ? (a1[1][8] ? a0[15] : v3) : (49 - v3)) >= ((a1[1][4] / 8) % 8));
+                v0 = (((59 > 17) + (59 >= 53)) / 3);
+            }
+            v1 = (((v3 / 8) ? (1 / 7) : (a0[6] && 23)) - ((v3 > a1[1][5]) * (i0 ? v0 : 8)));
+            i0 = i0 + 1;
+        } while (i0 < 3);
+    }
+    v0 = (((v3 != a0[9]) < (a0[0] != 51)) % 2);
+    v0 = (((v1 + a0[14]) - (a1[2][5] - 51)) * ((24 ? 37 : v0) ? (v2 < 25) : (29 || a0[8])));
+    a0[14] = (((v2 - 27) ? (a0[13] % 4) : (v2 == a0[7])) != ((11 ? a1[2][13] : a0[8]) != (a1[0][4] && a1[0][9])));
+    v0 = (((v0 <= a1[1][0]) - (v1 > v0)) && ((v0 > v2) ? (v3 != a0[8]) : (88 - 49)));
+    return (((v1 - v3) && (a1[1][14] <= v3)) ? ((71 - v3) % 2) : ((39 - 74) * (a0[13] <= v0)));
+}
+int f1() {
+    int v0 = 7;
+    int v1 = 49;
+    int v2 = 2;
+    int v3 = 92;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v3 = (((i0 != v1) == (v2 * 35)) == ((v0 && 54) > (v0 + a1[2][11])));
+            a0[3] = (((34 < 48) / 1) / 1);
+            for (int i1 = 0; i1 < 4; i1 = i1 + 1) {
+                a1[2][14] = (((37 == a1[3][0]) / 4) <= ((a0[14] <= i1) / 6));
+                a1[3][15] = (((v1 || v0) == (i1 ? a0[4] : 44)) * ((v3 == v3) || (v0 ? a1[0][9] : a0[15])));
+                v2 = (((v3 < i1) == (v0 + v3)) != ((i0 >= 30) ? (v1 - 24) : (a1[1][6] ? a0[5] : v2)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 2);
+    }
+    v0 = (((v3 % 4) % 2) && ((v0 ? a1[2][5] : a0[9]) * (a0[7] || v1)));
+    if ((((v2 % 1) + (39 ? a1[2][9] : 57)) == ((v2 ? a1[1][6] : v3) > (v3 < v1)))) {
+        v3 = (((a1[2][6] == v0) != (65 < a1[3][13])) == ((39 * v0) % 9));
+        a0[0] = (((v2 / 1) % 3) && ((25 <= v1) >= (54 > a1[3][11])));
+        a0[4] = (((a0[8] || a0[7]) || (v0 * 15)) % 8);
+    } else {
+        v1 = (((v3 ? v1 : a1[3][3]) && (a0[1] || v2)) * ((26 - a1[0][2]) ? (v1 || a0[12]) : (a0[4] < 39)));
+        v2 = (((v2 ? a1[3][9] : 16) && (v0 == 74)) != ((a0[9] < v0) < (a0[4] || a0[9])));
+        v1 = (((v0 != 54) > (v1 == v1)) || ((a1[3][10] > v2) ? (v1 < a1[3][0]) : (v0 == 99)));
+    }
+    v1 = (((a0[14] < 58) + (10 <= v2)) || ((v0 - v0) * (a0[1] || v0)));
+    v0 = (((v3 == v1) == (v3 + v3)) != ((48 || v3) != (v1 < a0[14])));
+    return (((v1 * v2) + (v0 < v2)) >= ((v3 ? 1 : v2) || (v3 ? v2 : 78)));
+}
+int f2() {
+    int v0 = 60;
+    int v1 = 94;
+    int v2 = 72;
+    int v3 = 17;
+    int a0[16];
+    int a1[4][16];
+    if ((((v1 ? v0 : v0) || (v0 / 5)) && ((11 == v0) >= (a1[3][13] && 66)))) {
+        a0[7] = (((17 % 1) != (v2 == v1)) != ((11 >= v2) ? (a0[13] ? v3 : a0[9]) : (v2 ? 81 : a1[1][1])));
+        v1 = (((v1 * a1[3][3]) ? (92 % 8) : (98 && a1[2][11])) < ((a1[0][14] ? v3 : 17) != (v2 != v3)));
+        a1[2][10] = (((77 < a1[1][6]) > (a1[0][9] >= a1[3][6])) - ((8 >= 76) >= (29 > 50)));
+    } else {
+        v1 = (((v2 + 25) >= (9 > 82)) == ((13 ? a0[14] : v2) != (v1 * a1[1][5])));
+        v3 = (((v3 ? a0[4] : 44) + (77 == 43)) && ((a0[10] * v3) < (v2 || a0[15])));
+        a1[1][2] = (((a1[3][2] - 76) ? (v2 % 8) : (v2 % 4)) <= ((v1 - v0) || (v2 ? v1 : 83)));
+    }
+    v3 = (((v0 != v2) % 5) == ((v3 != v0) ? (v3 + 59) : (a0[11] && v2)));
+    if ((((v1 <= 55) / 4) && ((a1[2][2] || v1) + (v2 == 48)))) {
+        v1 = (((2 - 26) * (v3 > a1[2][10])) % 7);
+        v2 = (((v2 - 84) <= (v3 >= a0[7])) == ((50 + v1) ? (v0 != v3) : (a0[4] ? 72 : a0[5])));
+        a1[0][13] = (((34 == a1[1][11]) + (a0[9] && v0)) >= ((v2 == a1[0][3]) + (a1[3][13] < v0)));
+    } else {
+        a1[3][13] = (((v1 > 6) == (v1 * a0[14])) > ((a0[11] * v1) <= (v0 == 69)));
+        a0[5] = (((51 > v2) > (v1 * v3)) == ((v1 ? v2 : 77) % 1));
+        v2 = (((v0 ? a0[14] : v0) ? (32 < 25) : (57 + v1)) * ((a1[0][3] > 11) % 3));
+    }
+    v2 = (((a0[1] - 54) != (v3 ? a0[13] : a0[14])) ? ((a0[9] ? v2 : 63) < (69 <= v2)) : ((a0[1] || a1[1][6]) > (v0 % 4)));
+    {
+        int i0 = 0;
+        while (i0 < 8) {
+            a1[3][10] = (((a1[2][0] - v1) != (v1 / 9)) - ((a1[3][14] != v1) / 1));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    if ((17 ? i0 : v2) > 68) break;
+                    a0[12] = (((11 < a0[4]) && (a0[13] || a1[1][8])) % 3);
+                    a1[0][3] = (((a0[13] < v2) && (v0 <= a0[13])) ? ((i1 * v0) * (v2 < i0)) : ((v3 || 17) >= (a0[10] ? v1 : a0[5])));
+                    a0[12] = (((v1 >= v3) ? (i0 * a1[1][14]) : (i0 % 6)) * ((a1[3][6] <= a0[15]) && (v3 ? a0[12] : a1[2][15])));
+                    i1 = i1 + 1;
+                }
+            }
+            a0[3] = (((i0 < 86) * (29 || v0)) && ((v2 % 7) + (79 && a0[0])));
+            i0 = i0 + 1;
+        }
+    }
+    return (((a0[2] != a1[2][9]) < (v2 + v0)) || ((a0[13] >= a0[9]) ? (53 || v3) : (a0[12] <= v1)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,90 @@
+int f0() {
+    int v0 = 42;
+    int v1 = 67;
+    int v2 = 41;
+    int v3 = 75;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            v1 = (((v3 || v1) ? (46 ? i0 : v3) : (i0 + v1)) ? ((a1[0][12] % 2) == (47 + v0)) : ((a1[0][13] % 8) % 1));
+            a0[0] = (((a1[3][12] < 51) / 7) / 3);
+            for (int i1 = 0; i1 < 6; i1 = i1 + 1) {
+                v0 = (((i1 >= v3) / 2) ? ((a0[13] + v2) && (i0 || v2)) : ((37 == a0[5]) ? (i0 >= 50) : (i0 / 7)));
+                v0 = (((31 * a0[6]) > (95 % 7)) || ((v0 + i0) > (v1 + v0)));
+                v3 = (((61 != 69) - (13 != a1[2][14])) != ((i1 % 7) + (a0[1] ? a0[14] : 56)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 8);
+    }
+    {
+        int i2 = 0;
+        do {
+            for (int i3 = 0; i3 < 3; i3 = i3 + 1) {
+                v1 = (((52 + 43) >= (a1[0][5] < 38)) == ((a0[1] <= 15) == (i3 - v2)));
+                a0[3] = (((87 >= 70) + (18 + v3)) % 9);
+                v0 = (((87 - v2) % 3) > ((v1 * 81) || (i2 + v1)));
+            }
+            a1[2][14] = (((i2 ? a1[0][7] : a1[0][14]) / 4) >= ((59 ? v1 : v1) ? (v1 + v3) : (34 + v3)));
+            a1[0][7] = (((a1[3][7] < v1) == (4 % 5)) % 5);
+            i2 = i2 + 1;
+        } while (i2 < 8);
+    }
+    {
+        int i4 = 0;
+        while (i4 < 6) {
+            a0[3] = (((v1 ? v2 : v1) && (a0[11] == v1)) * ((a0[4] - v3) ? (v3 >= 15) : (v1 != a0[6])));
+            {
+                int i5 = 0;
+                do {
+                    a1[0][15] = (((v0 + a0[7]) % 7) * ((v3 - v2) != (v2 - a0[12])));
+                    v1 = (((14 * v1) * (v2 != v0)) ? ((24 > a0[13]) % 2) : ((a0[12] <= v1) + (v3 && a1[3][6])));
+                    a0[3] = (((a1[2][14] >= 76) != (i4 * a0[0])) ? ((a1[3][10] || v2) % 6) : ((62 || a1[3][12]) != (77 && i5)));
+                    i5 = i5 + 1;
+                } while (i5 < 5);
+            }
+            v1 = (((12 == 19) > (v0 < i4)) < ((76 >= v3) / 8));
+            i4 = i4 + 1;
+        }
+    }
+    for (int i6 = 0; i6 < 2; i6 = i6 + 1) {
+        if ((a1[2][8] ? 23 : v1) > 93) break;
+        a0[5] = (((v1 - v3) % 9) <= ((i6 - i6) <= (41 < 97)));
+        v2 = (((v2 >= 4) > (90 >= v3)) != ((v2 * a0[10]) - (i6 != v3)));
+        {
+            int i7 = 0;
+            while (i7 < 4) {
+                if ((a1[1][3] * a1[3][11]) > 84) break;
+                v2 = (((64 - 10) * (v3 - a0[8])) ? ((v3 * v0) / 4) : ((90 <= v1) == (a0[11] == v0)));
+                v2 = (((v1 ? a1[3][15] : 78) % 8) + ((i6 + 21) ? (v3 + a1[3][15]) : (v3 <= v2)));
+                v0 = (((v1 > a0[1]) == (v3 ? 12 : i6)) ? ((a0[4] >= a0[8]) > (28 && i6)) : ((81 || a1[2][10]) <= (19 && a1[0][11])));
+                i7 = i7 + 1;
+            }
+        }
+    }
+    {
+        int i8 = 0;
+        while (i8 < 2) {
+            if ((a0[2] / 8) > 66) break;
+            v0 = (((59 > 30) && (v2 - 31)) > ((28 <= v3) != (v2 && 10)));
+            v0 = (((26 == i8) ? (v1 > 90) : (a0[9] && v0)) == ((a1[0][11] / 6) != (v1 == 16)));
+            {
+                int i9 = 0;
+                while (i9 < 4) {
+                    v0 = (((60 - i9) != (i8 < v0)) ? ((a1[1][14] == v3) || (a0[4] > i9)) : ((v3 && 59) < (a0[3] + v1)));
+                    a1[2][6] = (((a0[12] ? 41 : i8) && (a1[0][12] == 49)) - ((i9 ? v2 : 91) ? (v0 > 50) : (a0[11] % 7)));
+                    v1 = (((i9 <= v0) || (88 - 51)) < ((a0[5] * v3) && (a0[13] <= a1[2][3])));
+                    i9 = i9 + 1;
+                }
+            }
+            i8 = i8 + 1;
+        }
+    }
+    return (((v2 ? 59 : v3) > (67 / 2)) && ((v2 < 77) ? (v0 < a0[4]) : (65 < v3)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,141 @@
+int f0() {
+    int v0 = 98;
+    int v1 = 26;
+    int v2 = 92;
+    int v3 = 51;
+    int a0[16];
+    int a1[4][16];
+    v2 = (((v1 != v2) == (a0[10] <= v3)) >= ((v0 <= v2) <= (a0[10] <= 26)));
+    a1[2][15] = (((23 ? v3 : a0[13]) != (v3 * v3)) - ((3 + v0) <= (57 ? v1 : v1)));
+    for (int i0 = 0; i0 < 5; i0 = i0 + 1) {
+        v3 = (((a0[12] && 7) != (a1[3][3] > a1[2][8])) % 4);
+        {
+            int i1 = 0;
+            while (i1 < 8) {
+                if ((v1 ? i1 : v3) > 62) break;
+                v0 = (((a0[13] && i0) == (23 == a0[0])) > ((a0[13] == a1[0][12]) < (v0 != a1[3][15])));
+                v3 = (((v1 >= a0[11]) == (3 + a1[1][13])) % 7);
+                a1[3][15] = (((i1 < v1) < (v2 <= a1[3][5])) ? ((i1 >= a0[14]) < (a1[3][10] % 8)) : ((46 % 4) + (v0 < v1)));
+                i1 = i1 + 1;
+            }
+        }
+        v3 = (((v3 + a1[1][11]) || (a0[14] ? a0[2] : 74)) - ((v1 >= 65) ? (v3 || v0) : (a0[13] ? a1[1][4] : v3)));
+    }
+    for (int i2 = 0; i2 < 4; i2 = i2 + 1) {
+        v3 = (((40 ? v0 : a1[0][0]) >= (a0[2] < a1[0][9])) ? ((v3 + v0) < (v2 < a0[9])) : ((a1[3][5] > 56) >= (a1[0][4] && i2)));
+        v2 = (((i2 <= a1[1][15]) ? (a1[1][1] - v2) : (22 < a0[2])) <= ((v3 * v0) != (v3 < 53)));
+        {
+            int i3 = 0;
+            do {
+                a0[2] = (((95 && 17) + (36 && 97)) <= ((i3 == a1[3][10]) - (i3 % 7)));
+                v3 = (((a1[0][4] % 7) && (a0[9] / 2)) || ((79 == v2) ? (a0[15] * v2) : (i3 || a0[2])));
+                a1[1][13] = (((v2 > 32) + (a1[3][9] - a1[3][2])) <= ((v1 * 57) == (a1[2][5] ? v3 : 85)));
+                i3 = i3 + 1;
+            } while (i3 < 7);
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v1 = (((v3 < 75) <= (v1 - v1)) - ((v1 != a1[2][10]) < (v2 + v0)));
+            v3 = (((58 % 8) && (2 - v0)) && ((a1[0][10] == a0[4]) * (v1 % 2)));
+            {
+                int i5 = 0;
+                do {
+                    a1[1][13] = (((v0 - v3) % 8) > ((a1[1][10] / 6) || (v2 != v2)));
+                    v3 = (((v3 > i5) > (v0 ? 1 : v3)) ? ((v2 % 9) || (95 / 4)) : ((i5 / 6) * (34 - a0[7])));
+                    v2 = (((82 || 3) + (v0 ? v3 : v1)) / 9);
+                    i5 = i5 + 1;
+                } while (i5 < 6);
+            }
+            i4 = i4 + 1;
+        } while (i4 < 7);
+    }
+    return (((v1 > a1[3][3]) * (30 % 5)) ? ((v2 || v0) || (28 == v0)) : ((31 != 2) ? (56 < v0) : (v2 == v3)));
+}
+int f1() {
+    int v0 = 41;
+    int v1 = 51;
+    int v2 = 61;
+    int v3 = 18;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        while (i0 < 6) {
+            a1[3][7] = (((16 <= a1[3][7]) <= (93 && v3)) && ((v0 - v2) + (a1[1][12] <= v2)));
+            v0 = (((v3 <= v3) == (a0[7] ? 28 : 37)) == ((v0 % 2) >= (v3 / 3)));
+            {
+                int i1 = 0;
+                do {
+                    a1[1][7] = (((a1[2][7] - i0) && (v1 < a0[15])) == ((v1 < v3) > (v1 > v2)));
+                    v1 = (((v3 || 35) == (v0 > v0)) - ((v3 >= a0[12]) * (v2 >= 51)));
+                    v1 = (((v3 ? i1 : i1) % 5) % 6);
+                    i1 = i1 + 1;
+                } while (i1 < 7);
+            }
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            v1 = (((v3 == a1[2][7]) > (v0 % 9)) + ((a1[2][13] == v0) / 1));
+            v2 = (((i2 == a1[0][3]) ? (a0[9] - a1[3][7]) : (a1[2][0] - a1[1][15])) % 6);
+            {
+                int i3 = 0;
+                do {
+                    v0 = (((i2 || v2) - (a1[1][6] != a0[5])) < ((26 > i3) <= (a1[0][1] + a0[14])));
+                    v3 = (((i3 < 52) || (i3 / 4)) >= ((i3 && v1) * (i2 > i2)));
+                    v1 = (((v2 <= v2) / 7) < ((i3 > 50) != (v2 % 8)));
+                    i3 = i3 + 1;
+                } while (i3 < 3);
+            }
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            a1[0][11] = (((a0[5] ? 82 : a1[2][10]) % 8) * ((v3 <= v3) / 1));
+            {
+                int i5 = 0;
+                do {
+                    if ((52 / 8) > 54) break;
+                    v1 = (((57 != a1[2][3]) * (25 / 7)) / 6);
+                    v3 = (((a0[2] % 6) && (a0[5] * i5)) == ((v3 == i4) % 2));
+                    a1[1][0] = (((17 ? v1 : i4) && (59 >= 23)) || ((v0 != v2) ? (v2 + i4) : (v0 >= 3)));
+                    i5 = i5 + 1;
+                } while (i5 < 7);
+            }
+            a0[13] = (((i4 >= v1) < (v3 == i4)) + ((a0[9] < v3) % 5));
+            i4 = i4 + 1;
+        } while (i4 < 2);
+    }
+    for (int i6 = 0; i6 < 6; i6 = i6 + 1) {
+        if ((a0[3] ? 89 : v3) > 52) break;
+        for (int i7 = 0; i7 < 7; i7 = i7 + 1) {
+            a1[3][15] = (((v0 ? i6 : v3) + (48 < v3)) ? ((a1[2][6] ? 67 : v1) > (a1[3][14] ? v2 : 56)) : ((v2 - i6) + (a0[6] != v3)));
+            a1[2][8] = (((i6 % 4) || (a0[5] == a0[8])) % 2);
+            a1[1][5] = (((v3 > a0[4]) - (v2 - a0[7])) > ((v2 * a1[0][8]) + (i7 / 5)));
+        }
+        v1 = (((16 ? v2 : v3) != (v1 ? a1[0][14] : v3)) || ((a0[13] != 16) % 3));
+        v3 = (((v1 >= v0) <= (a1[3][2] + i6)) - ((v0 ? a1[2][7] : 46) ? (a1[1][1] <= v3) : (i6 || a0[7])));
+    }
+    if ((((86 / 4) / 6) / 9)) {
+        v0 = (((a1[2][1] ? a0[1] : v3) - (v3 ? a0[7] : v3)) < ((a1[0][2] - a0[11]) || (v2 < a1[3][8])));
+        v2 = (((v2 ? a0[8] : v1) * (a1[1][5] == a1[3][4])) && ((v1 / 5) + (88 <= v0)));
+        v2 = (((v3 || v0) - (a1[1][0] * v2)) ? ((a1[2][11] >= a1[2][15]) || (v2 >= v0)) : ((a0[15] + 55) >= (a0[11] && v2)));
+    } else {
+        a0[3] = (((v0 || v3) + (a1[1][0] ? a0[7] : a0[12])) / 7);
+        a1[1][9] = (((v1 / 9) || (v0 % 5)) - ((v1 - v0) && (14 / 5)));
+        v1 = (((98 / 4) + (v0 < v1)) && ((68 - 34) < (v3 > v2)));
+    }
+    return (((v0 > v0) ? (v0 / 6) : (v3 ? v1 : v3)) || ((v2 ? v3 : v2) % 3));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    return s;
+}
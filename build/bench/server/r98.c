@@ -0,0 +1,167 @@
+int f0() {
+    int v0 = 1;
+    int v1 = 59;
+    int v2 = 61;
+    int v3 = 0;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((a1[2][3] == a1[0][13]) > 65) break;
+            a1[1][12] = (((v3 || 52) >= (i0 < i0)) == ((v2 < a0[1]) * (v0 ? v3 : a1[1][3])));
+            v2 = (((a0[11] >= i0) >= (a1[1][12] / 8)) * ((42 > v0) ? (v1 != 62) : (27 ? 35 : a0[9])));
+            {
+                int i1 = 0;
+                while (i1 < 7) {
+                    a1[3][12] = (((a1[1][12] < a1[1][15]) + (i0 != 92)) + ((v3 == a1[2][11]) / 6));
+                    a1[2][7] = (((a1[3][8] % 7) * (v2 > 27)) > ((v2 * 7) - (3 || v2)));
+                    v3 = (((22 >= 38) / 1) + ((i0 - i1) != (v2 == v1)));
+                    i1 = i1 + 1;
+                }
+            }
+            i0 = i0 + 1;
+        } while (i0 < 6);
+    }
+    if ((((v3 + v2) < (v0 / 3)) != ((v1 / 8) || (a0[2] + 44)))) {
+        v1 = (((a1[3][0] ? 26 : v3) / 2) < ((v1 < 18) + (v2 != v1)));
+        v1 = (((v1 <= v1) != (v1 >= 94)) ? ((a0[2] ? v3 : 31) >= (70 - v2)) : ((90 != v1) ? (65 && v0) : (v0 * v0)));
+        a1[3][1] = (((44 && v2) ? (a0[7] <= v3) : (a1[1][10] ? v3 : v0)) == ((v3 ? a1[0][1] : v0) < (18 / 9)));
+    } else {
+        v0 = (((v0 == a1[2][7]) % 2) ? ((v3 && v1) ? (27 + a0[15]) : (v2 >= v0)) : ((v3 ? v0 : v1) ? (25 / 8) : (v0 && v2)));
+        v0 = (((a0[5] <= 31) >= (98 >= 66)) ? ((69 / 8) * (v3 * v1)) : ((v3 < v1) % 5));
+        a1[1][4] = (((v2 == v0) / 7) <= ((v3 == v3) == (95 < v0)));
+    }
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        for (int i3 = 0; i3 < 4; i3 = i3 + 1) {
+            a0[10] = (((a0[13] ? 81 : v3) ? (i2 != v1) : (0 <= v2)) % 2);
+            v2 = (((v0 < v1) * (95 - 39)) ? ((i2 - a0[8]) ? (6 != i2) : (9 == v1)) : ((a1[3][14] > a1[2][4]) || (v3 ? a0[10] : v3)));
+            v3 = (((a0[2] < 95) % 6) < ((a1[0][15] % 5) >= (75 < v3)));
+        }
+        v3 = (((v3 * v0) == (a1[2][7] ? v0 : v1)) * ((v1 != a1[2][14]) ? (95 || a0[5]) : (33 / 4)));
+        v1 = (((v3 / 6) / 2) > ((v0 != 56) || (a1[3][6] ? 14 : 70)));
+    }
+    v2 = (((v0 - a0[2]) % 5) * ((0 * v3) * (v3 * a1[2][3])));
+    for (int i4 = 0; i4 < 4; i4 = i4 + 1) {
+        v0 = (((v3 ? a0[13] : a0[5]) >= (a0[8] > v0)) ? ((v3 <= i4) ? (v3 + v0) : (45 / 9)) : ((v0 || v1) + (v1 || v1)));
+        a1[2][15] = (((v0 / 9) ? (a0[2] > a1[3][14]) : (7 * 79)) || ((v1 + v0) ? (30 >= v2) : (a0[1] * 89)));
+        for (int i5 = 0; i5 < 5; i5 = i5 + 1) {
+            v3 = (((a1[1][9] > v1) < (i5 || a0[15])) >= ((39 < a1[1][13]) || (i4 > v3)));
+            v0 = (((43 % 9) + (v3 * a1[3][13])) / 5);
+            v2 = (((v0 < i4) != (a0[13] % 5)) + ((v1 * a0[15]) ? (i4 * i4) : (v0 < i5)));
+        }
+    }
+    return (((a0[2] >= a0[5]) % 8) <= ((8 >= a0[12]) * (a1[1][14] != v2)));
+}
+int f1() {
+    int v0 = 37;
+    int v1 = 75;
+    int v2 = 53;
+    int v3 = 95;
+    int a0[16];
+    int a1[4][16];
+    {
+        int i0 = 0;
+        do {
+            if ((2 != 85) > 72) break;
+            v1 = (((i0 > a0[7]) - (v2 / 8)) < ((v0 < 95) && (81 == i0)));
+            v1 = (((a0[1] < i0) || (a1[0][14] < v2)) / 3);
+            for (int i1 = 0; i1 < 3; i1 = i1 + 1) {
+                v1 = (((i0 / 3) - (87 == 79)) && ((a1[1][13] + i0) % 4));
+                v1 = (((i1 >= a1[3][2]) / 3) < ((2 && 3) < (v0 * i0)));
+                v0 = (((v1 % 4) == (2 <= v2)) < ((v1 * v1) != (i1 < v1)));
+            }
+            i0 = i0 + 1;
+        } while (i0 < 5);
+    }
+    v1 = (((a1[1][5] != v2) % 1) && ((29 / 2) / 1));
+    if ((((v3 != 91) % 7) < ((v2 <= 4) && (47 - a1[1][10])))) {
+        v2 = (((21 == a1[2][12]) - (v0 > 78)) != ((v0 == a0[8]) == (45 % 7)));
+        v2 = (((a0[7] >= 43) != (v0 ? v1 : v3)) >= ((v1 <= 8) < (3 < a0[14])));
+        v3 = (((v2 != v0) >= (67 + 85)) ? ((26 ? v1 : 7) > (52 == v3)) : ((v2 < v3) ? (v3 + v2) : (a0[1] ? 7 : v3)));
+    } else {
+        a0[13] = (((v2 + 23) < (v0 + v1)) != ((v0 <= v3) ? (55 <= a0[14]) : (v3 > 90)));
+        v3 = (((a1[2][3] * a0[14]) > (a1[3][15] ? 19 : v2)) / 7);
+        v0 = (((v2 * a1[2][8]) ? (22 >= v0) : (v2 - 75)) / 4);
+    }
+    v3 = (((v0 < a1[3][5]) && (76 == a1[0][14])) * ((v1 < 28) < (v0 == v3)));
+    for (int i2 = 0; i2 < 5; i2 = i2 + 1) {
+        if ((v0 ? v2 : a0[1]) > 73) break;
+        v2 = (((v1 != i2) <= (49 ? a0[4] : v1)) == ((51 != 69) - (3 > i2)));
+        a1[3][15] = (((v2 == v1) != (a1[1][7] ? a1[2][0] : a1[1][0])) < ((a0[2] < v0) ? (81 > i2) : (i2 == a1[3][1])));
+        for (int i3 = 0; i3 < 5; i3 = i3 + 1) {
+            v1 = (((a0[1] / 4) <= (i2 > a0[3])) >= ((a0[5] * v2) % 2));
+            v1 = (((i2 >= v2) - (v0 && a0[10])) && ((v3 >= v2) ? (80 == v2) : (v2 < i3)));
+            v1 = (((74 == v1) / 7) <= ((v1 && v2) >= (73 - v2)));
+        }
+    }
+    return (((a1[1][8] * v0) * (97 ? 97 : a1[1][11])) % 6);
+}
+int f2() {
+    int v0 = 57;
+    int v1 = 85;
+    int v2 = 5;
+    int v3 = 40;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((v2 / 4) / 7) - ((v3 * 44) != (a1[2][7] - a1[3][1])));
+    v0 = (((81 / 5) + (a1[1][3] || v1)) ? ((v2 - v1) != (a1[0][11] == v1)) : ((v1 > 5) < (v0 <= a0[6])));
+    {
+        int i0 = 0;
+        while (i0 < 2) {
+            if ((i0 && i0) > 81) break;
+            {
+                int i1 = 0;
+                do {
+                    if ((a0[10] <= v3) > 95) break;
+                    v3 = (((i1 + a1[0][10]) == (a1[0][1] >= v2)) != ((v2 * v1) % 5));
+                    a0[15] = (((i0 - 45) + (v0 / 7)) != ((a1[3][8] == a0[3]) && (a0[9] && a0[9])));
+                    v1 = (((i0 * v2) && (a1[0][9] % 8)) ? ((i0 + i0) % 3) : ((v1 != a1[3][3]) <= (54 != i1)));
+                    i1 = i1 + 1;
+                } while (i1 < 3);
+            }
+            a1[2][15] = (((v1 || i0) > (18 >= 54)) ? ((v0 >= v1) / 1) : ((v1 % 6) / 6));
+            a0[7] = (((94 || 94) < (4 == a0[4])) ? ((v1 && v3) >= (48 ? a1[3][4] : v3)) : ((a0[3] * 6) / 3));
+            i0 = i0 + 1;
+        }
+    }
+    {
+        int i2 = 0;
+        while (i2 < 5) {
+            if ((v3 + v3) > 71) break;
+            for (int i3 = 0; i3 < 8; i3 = i3 + 1) {
+                v1 = (((v2 != i3) ? (i3 != 75) : (a0[8] != v1)) ? ((a0[4] + v2) && (v3 ? a1[3][3] : v1)) : ((20 >= 32) || (i2 > v2)));
+                v3 = (((i3 != i2) + (82 % 2)) * ((i3 != i3) ? (11 >= v3) : (v3 % 9)));
+                v3 = (((50 < v3) && (40 && a1[0][9])) < ((a0[6] ? i3 : v3) ? (a1[2][2] - v0) : (a0[10] + v0)));
+            }
+            a1[0][9] = (((a0[12] < 1) > (v3 < 45)) || ((27 < 53) && (v2 || 75)));
+            v1 = (((v1 ? v2 : v2) <= (a1[1][0] != 21)) + ((i2 < v0) <= (a0[12] * a1[0][5])));
+            i2 = i2 + 1;
+        }
+    }
+    {
+        int i4 = 0;
+        do {
+            v2 = (((a1[1][5] || 55) - (93 < a1[2][15])) * ((a1[1][9] * i4) < (v3 >= v3)));
+            v1 = (((i4 / 4) >= (99 * v0)) * ((31 && 96) / 6));
+            {
+                int i5 = 0;
+                while (i5 < 4) {
+                    v0 = (((45 * 6) <= (i5 * a0[1])) + ((v0 <= 31) != (i4 > i4)));
+                    a0[9] = (((a1[0][1] || i4) && (v1 || i4)) || ((a0[9] >= v2) + (i5 + i4)));
+                    v2 = (((i4 - a0[11]) == (v0 >= a1[3][12])) <= ((i5 - v1) >= (v2 >= v2)));
+                    i5 = i5 + 1;
+                }
+            }
+            i4 = i4 + 1;
+        } while (i4 < 4);
+    }
+    return (((v0 > a1[0][7]) % 8) <= ((v3 ? 97 : a0[12]) >= (v2 > v2)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    s = s + f1();
+    s = s + f2();
+    return s;
+}
@@ -0,0 +1,27 @@
+int f0() {
+    int v0 = 40;
+    int v1 = 12;
+    int v2 = 95;
+    int v3 = 99;
+    int a0[16];
+    int a1[4][16];
+    v1 = (((a1[3][4] || v3) / 4) ? ((66 ? 47 : 83) * (a1[2][2] > 80)) : ((94 <= v2) / 2));
+    v0 = (((v3 || v1) < (v2 + a1[0][14])) % 1);
+    v3 = (((v0 >= v1) || (65 || v1)) > ((7 != v1) * (v0 ? v2 : a1[0][10])));
+    if ((((23 - 92) - (a1[2][6] || v2)) <= ((a1[0][1] + v2) * (a0[14] ? v3 : v3)))) {
+        a1[1][3] = (((a1[0][0] != a0[6]) % 8) + ((v3 < v2) > (v0 || a1[3][5])));
+        v3 = (((a0[3] * v0) / 5) && ((73 * v2) ? (a1[0][9] >= v0) : (69 * a1[0][12])));
+        a1[2][3] = (((97 % 2) != (0 * v0)) + ((v2 == a0[7]) - (v2 - 54)));
+    } else {
+        a0[6] = (((a0[13] % 9) - (v0 == v1)) / 2);
+        v1 = (((78 + v1) < (v1 != v0)) > ((v2 && v1) % 5));
+        v3 = (((v2 < 88) != (a0[12] || v0)) ? ((v2 + v3) / 6) : ((v2 > v1) == (a0[0] < 85)));
+    }
+    v1 = (((87 != a0[2]) && (29 && a0[6])) - ((32 != 77) <= (v0 <= a0[7])));
+    return (((a0[7] ? v1 : v3) % 6) > ((v2 == 47) - (v0 < 97)));
+}
+int main() {
+    int s = 0;
+    s = s + f0();
+    return s;
+}
@@ -0,0 +1,2029 @@
+    .file 1 "-"
+.globl main
+.type main, @function
+    .p2align 4
+main:
+    .cfi_startproc
+    .loc 1 1 1
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset %rbp, -16
+    mov %rsp, %rbp
+    .cfi_def_cfa_register %rbp
+    .loc 1 2 5
+    subq $8, %rsp
+    .loc 1 3 5
+    movl $1, -4(%rbp)
+    .loc 1 4 1
+    movq $0, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    addl -4(%rbp), %eax
+    movslq %eax, %rax
+    subq $1000, %rax
+    movslq %eax, %rax
+    jmp .Lmain_end
+    movq $0, %rax
+.Lmain_end:
+    mov %rbp, %rsp
+    pop %rbp
+    .cfi_def_cfa %rsp, 8
+    ret
+    .cfi_endproc
+.size main, .-main